@@ -1,8 +1,5 @@
 
-INCLUDE_DIRS    := $(INCLUDE_DIRS) \
-                   $(ROOT)/lib/main/dyad
-
-MCU_COMMON_SRC  := $(ROOT)/lib/main/dyad/dyad.c
+MCU_COMMON_SRC  :=
 
 #Flags
 ARCH_FLAGS      =
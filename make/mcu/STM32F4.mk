@@ -158,6 +158,7 @@ MCU_COMMON_SRC = \
             drivers/adc_stm32f4xx.c \
             drivers/bus_i2c_stm32f10x.c \
             drivers/dma_stm32f4xx.c \
+            drivers/dshot_telemetry.c \
             drivers/inverter.c \
             drivers/light_ws2811strip_stdperiph.c \
             drivers/pwm_output_dshot.c \
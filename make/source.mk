@@ -149,6 +149,7 @@ FC_SRC = \
             sensors/sonar.c \
             sensors/barometer.c \
             telemetry/telemetry.c \
+            telemetry/snapshot.c \
             telemetry/crsf.c \
             telemetry/srxl.c \
             telemetry/frsky.c \
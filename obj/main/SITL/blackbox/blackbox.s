@@ -0,0 +1,4221 @@
+	.file	"blackbox.c"
+	.section	.gnu.lto_.profile.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`\334\b\345!"
+	.string	"\006)\234Ip\324VcO8C\261\343\217l\272R\023\260~{"
+	.string	"\330\344\2708\374\216\303\332:\227 \207\025\003!\235\225\243$\216\233C]Lh\\L\020\037\255\343Yx\241\001\027\213\3412\307\013\250\243$%\256\311\366\277\377\177)\227\276\fz"
+	.string	"\206"
+	.string	"\231"
+	.string	"H\344\343\345\367\227\017\260t\271\313\225Wf"
+	.ascii	"O\036\371\370\310\037_\344[\312R\325\216\273\345\356\363[\036"
+	.ascii	"\317\304\333$l\235\321G|\317\260]U\226\025\226\225\027O\374\305"
+	.ascii	"\020\243\241-\306\361\177{\312\035\021+<\334\373\360\335\023"
+	.ascii	"\277\377~\370\367\302\007\277\017<\360\277\357\033\221\234,E"
+	.ascii	"\375v\260\254.kN\273\257\324\372v\325\327w\357\376\371\276\347"
+	.ascii	"\307\303!Tl\323l\224\205I\002CB\320C\335\246\360\306\265\212"
+	.ascii	"\220 \240\344\273\274\270\252?>"
+	.string	"\301Mu\253:\365<\377\214\237\237\317\347\363\021\274bK{\3053\340Z\3003\316\315\265\315\2315\3174\317\316\2313\177\206,fD)\301\271\211i\006\361\356xT\331\324\320\310\\Fy\231\347\375\230\307?\302Sh\326\034N\345a\276\017\263\233\217\201\322\244\036:b`\232/K\345\225\3143]\367\345\356\215\3277>\033\207\3424)@\344\\\224\237n\261\250\311jt\034N4\203\241\264\335\220\201\323\035yO\032>\025D\213=\312\300\027{fd\031~{\331\252\036\006\2343\013\300sp8\302.\300U\\Z-\013\332\027\367\204je\024\204#C\302T\001h\004\317k\t\005\275\255\320\244\250&\374e\373\232\236I\200\036\252\201>\260\334ZD\200\217E,Y\024)\b:\3279\364P\035\237\215:\260\246\0079\317y\316\033\353qm\327\034\020\370\261X\004j{\325\200\301}mxZx\013\024\334]\023;\"\227"
+	.ascii	"\376\t\355\302\312\316\242ED\001\371\225Z\337\256"
+	.string	"*R\2408\241\305\262\240\262&t\031\225\261\256\022\371\331i\343~\345\245\325 \361\266\311P\033C\n>Q\245{#\212L\342\252\232\210\320`V\246\266\020\260\213+\245\037 \264uk\311\351C\364\321\350\343G\213N\204\244\263{P\256\036\220\217\207\334\227oW\350\373A\337\007\332\377qw|\276\335\355\366\234\347\373;\337w>Fp\375\356\003\337\247\321\311\033\370>\363\314O\205[MS\272\016\372:\350\263\243\013\200\355\250\26191\"sAR\220B\2261P\002R\250h8\017\022\200\004\032\212\323\206H\202\021IJRV)\313n\260\244O`\262\336\370;\324t\224\333V\375AH\240\267\234\030qa\361r`$\257q\266VW\374\314\301\347\314\340C\236\272\0338\246#\367\302^K\344\016\025\276\372\251[6b]\3018\227\240\262\363\262+Go\370\2176\222UL?<`\333\311\314\007\275\207\336Ic\t\376"
+	.ascii	"\275NF\0058\250\301\036v/\265\304\274\323\261Ng}\240+}\322e\320"
+	.ascii	"\350k-.rAB\334\350\220\323[\2341\357\201G\310\327:\b\257\251"
+	.ascii	"\240\360\363\004aoD\313\375\242\321[\224\302\325t\255\200h\275"
+	.ascii	"a\351\236\245\030\225u\005\354\025\334swD@j\241\275WZ<\364\233"
+	.ascii	"\202\\\305p\207\225\"M\177=\247K\3154\376\374\353J'\n#T\256\356"
+	.ascii	"DJa<\"\310\241[\362\234Zw\244\nn\252\274\031\001\253\372\350"
+	.ascii	"\324\207\267]\335kxF\177\277\233`IM!\213\377\363\030XS\362h\233"
+	.ascii	"\235\307\226K5e\034e\336L\327H1\2367V\004\340-\207\\\240\004"
+	.ascii	"-k\033h\027\210\311\267\332r=\322d\247a\3438=\201\213\313\210"
+	.ascii	"\305|TH\325jF\324\210\3571-<\213\f\330\2649u,\177\350\013c=\333"
+	.ascii	"c\325\224\341B\016#\335|\353\005\266z\034\024~I.\360I\263\370"
+	.ascii	"\315\366\335\b\t\276Kv\321n\327\3370\355\304_n \374?/-\361\335"
+	.ascii	"\017\034 tn\346W\216\230|\276\027\277s\373e\316\302\343\330Q"
+	.ascii	"\0272\234\305\360b\351\231\244\210\262<\355\233\237w\204\321"
+	.ascii	"~\246\r\027\275\277\023\013\211,'=p\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`-\002\355\007"
+	.string	"\"\310\030\035@\205\rc\377"
+	.ascii	"\360\371\035S\036\n\360\353P\203\217\337w\261\031\2543\304\r"
+	.ascii	"\267\224)\005\256\200y\006\354\003\350'\323Y2\3229\032(E`[\032"
+	.ascii	"\\\244g\b\244\037Og9\347Fc\006s\241,\025\312D\225D\026\362\320"
+	.ascii	"k\035\r}\241\260\001\253\n\314>+\261#\366\360\253ZA\227`W\247"
+	.ascii	"\227\307\bL\250\300\224\024C\206\003`\002BfE\017\022 \006-\003"
+	.ascii	"Jf\321d\027\226\326\255\177\006{Xn\257.\223\234\222\"\026e7\330"
+	.ascii	"e\255\273\370\016Hc\025\003^z\234\b\332\376\323N\033+\024R\273"
+	.ascii	"{\231\262f\375\210\341@[\213\362\223\203\243}\001\246\356T\213"
+	.ascii	"1\217\200\006,4#&\031\031J,Zu\373\221&h\354P\206hpG_04j\340\313"
+	.ascii	"\346<4\251\254\365=4\274|\200waq\320\205\017\332\312\230\255"
+	.ascii	"\034^s\021>5\362m\317&\340\206p\350\272#"
+	.text
+	.section	.gnu.lto_.inline.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`b\021\275,"
+	.string	"&s\263H\220\234M\032\003\024\003Y\317l\f2\301\032P\212\341\225\310\337\227\330t\321\350\302\3645\264\356\n<\200A\330,\223\210\275(\342\223\232\324\023j\\\035@\005\326\226*V\326$\272\271x&\263\265\022of\213\244I#D\356\024\220"
+	.string	"\236"
+	.string	"\234"
+	.string	"$\3756^\315I\263\304~~\006m\026\037B\033\265i\235n}\311:Y\203v\370C\fX\355\254\233\365\254\276\321K\353\313\227\362]}W}\313\204i\f\213\234W\347\325\240\275\341\245UV\373\254\365\337\310"
+	.ascii	"G\371J\265V\340\343~\336\322)X\224\267(\256(oU\374\002t\001r"
+	.ascii	"\347\357\340n\266ZN\322o\246\370)U*\226\274]1\200)\321\330\304"
+	.ascii	"\311j\353\254\313}\207\266\326Z\313\377\215a`Qc>\373\224h\251"
+	.ascii	"\310\210e\272OpND\365|\367\364^pq\244y\322\242=\366G\244Uc\206"
+	.ascii	"H\023]\272Gg\326\013\376\032\255\031\027Wj\234E\013\303\311\t"
+	.ascii	"\313\020\371X}\013\3552}iM\201\2412h\377,\245\263\277gi\271?"
+	.ascii	"\205\245Y\264gYt({6i\246\364\246\374\331$\232C5\006%\3545\353"
+	.ascii	"\276h\267\310<\311Zp4\n\255\252\200(8\3677\243\315\252\265\356"
+	.ascii	"\f@hk\245G\343W\023\021\313g',}\247'\306\036R\304\300\360\274"
+	.ascii	"s/H\237\336\306\023K\205\313\026\230\016iTB\0242<\307\275mw\001"
+	.ascii	"\344K\276d\t\272\271i\302\366\232\257\351#\233\235\357\271{w"
+	.ascii	"\357\316\267\\S\\\303\375\355U\255\225\200\320X,\026\317\330"
+	.ascii	"~\240\245\305\002:86%\320&]>\032m\233b\021\316\203\201h\377\314"
+	.ascii	"\346\315p\323d\207\316X\333\b\313pK\030I/+Uk-p\204\321\247h\275"
+	.ascii	"j\255\002\206\240\023\254\265\326v\360$\235V\221\021\321\320"
+	.ascii	".\233\204\214\250\206B\355\032\214\304%9x(\025\341\322D\274\312"
+	.ascii	"\t\236\362\330\250\0258\300D@'\312\215U\265V\335\315\300\266"
+	.ascii	"\377\355\260\326\232s\245\326\003\30721%A\200\232\214@i9p\213"
+	.ascii	"\340,\246\264\034J\017B\271A\305\315Nu\t\257\2004"
+	.string	"\215\211T\322f%\331\013b\211\261\304C\214,3\032\3350\201\2221\213\232D%{\004\321x%\"\304\3208\210{\3018\346\327\017+a\355\017G;\\\352\n\333\035\215/\226\272\302\b\354\201\311J\030*\332\275#`Qe\316\2504U\220\234w\340\360\242\\\007\327\324\327\371\2061\213U\225\2249F\270\305\211\266\206!\362\2675\003\006`\f\"Q\236 \f\031\013\363\304\340\013\377<4\200\024\221\3421-\374\356\233/'ZrSG\246\030\t@V\240\274\323\334\221\007\201P\250\221\275\031\031\242\031IQR\030\016\321\204\2141\347$<\017\022\3002\221\206\204I\306\0201\310\330\004\"\"A\222r\n\222\3022\006\020\022_\265\240\225\226\372\003\273\237\321t\251j\351\327' \325\3338\347\242\342\177LeGk9\275wCn<\fH\fC\355 \"\244\303$\255R\262Z\342\370Q\317\227\240\200\0238\032\031\326\363"
+	.ascii	"\231\207\200\331_O\226ru\267P\223\024\253\266\227@?$\024\236"
+	.ascii	"\320\017\035\200\020\364\204R\001\302\222n~\301\321\313\321\017"
+	.ascii	"}{\363"
+	.string	"B}Y\326\266!\364S\357#\367\365S\350\361r\210)\326Z\261h\017C\373'\322\220^[\312a\316\264fY6&\212O\311\203}\r@\203w\273f;\321\021\353R\"d\032n\371\362R`\364\271\247XP[\265k\342\273\241>{\352l\257\361\271\263\2077\364\317\313\313\247\274-\311\254H(\253>\323^\013:\206t[\311\235\242\267\035\032\215\243\231\330\233\367\307_\263\312\361@\350\343\016\201\264\025\242\030\365\031\246\257\006\223mhc\177$\364\225\210l\214\317$\007\002]\314\006!\fr0\270_T\025\247\256'\037\033w\032\351\013\257\223\237\321\016\f\206\033\032\r\324\244\302\241c\217\364u^\020\340\337AK\343\241\340\361M\003\205\216\fkI\201\202\363\240\217E\300\356\315\025$\361D6\231<\260\177\347\367\006\316\254\n\357\374K\214\224C\351\207\007\037\2272g0]Y\264\3412\254\016\f\203\303>wQ\232"
+	.string	"e\325j"
+	.ascii	"\355O\305\271\335L\344\206q\207\221\243\246\207\247\354\n\231"
+	.ascii	"\205\n\244\001\006J6\246\243\332S\274ag\213\002c\277\215&\376"
+	.ascii	"\t\331=\305\257\353\001\336|\025\016x\305\032\217`{Yl']\223b"
+	.ascii	"\3658\242Y\177\271t\353A\220\221\200\013F6\007\325.S=m\350\267"
+	.ascii	"\b[\211+RFB\320\037\356<\346\377\333\2151a\203\246\035\222\375"
+	.ascii	"\200\rdz\247\330\345\372\213bE\317}\213\004\220@n\263\005\200"
+	.ascii	"T\324\306\202\263t\260\206\t\234j\272\006/\313=X\261\nU\264\353"
+	.ascii	"\357\313\241\343\321\024\322t\201\220\177\231\207\025\254{l\006"
+	.ascii	";-\013?\nVs\001<\203\301s\337\351Q\001\3468\315\242\270\222g"
+	.ascii	"V\271~\210\205\220\352ol\211:\bHh\327\232\001YP\tB?zi\254\027"
+	.ascii	"V\315\30534V\006\233\236\362\377n\241k(Q\177\207\210k\027`\370"
+	.ascii	"\277\361\272S;\272\021V8\245\031Y=\371\265\370@:ByN\237\254\202"
+	.ascii	" .\264\3107P\226\224Z^\341O \313\\{t\370\374F\332\243\007\217"
+	.ascii	"N?y\271n\3770]}\005<"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`\227(-Q"
+	.string	"\372cD\025=`\3566\007\354QS\304\232\240\304\270\304\0306\b\221\201!\"!|\325\036\006\037\277\227\345\335\365\203\254\215v\022?@\301@\210\020\033\221\273Z\271O"
+	.string	"\342\203\202\215\330\250eK\333R\246\0248\001O\001D\001-l\266\025\356\256\302\375\377U\244\261\247pw\024\356+~\037\027\215\203A?\341n\302\275\204\273\223\370\205\330\267p\210\377G\204!\013\234W\340\254\023$\330z?\211\300\2176\320\200\230q\320\216\035\b\330C\204p\367\017\356\336\201\203_]\375\033I\200\200\007\217W\214\002g\355\236\301\3351\270_\360\343\007\357-\223\275\226\326\205\013\337\347\261\006\r\017\352\324\t-\270\373\026\026vD\032{\235\300\271\001 @u~\007^\340\356\nly\362`\034R\005Aa\351\374A\017\006}8C\3700\f\303\227\363\017\366\370}\235\264\360\350\264\245@\245\r\244\211Yge\371\360\347\371\017\373K\033\030{\337\377\233I\343w\037\016\301\374\325\264\201/\346\360\263\036c\217\212*\200}\005\260\317\003\210\017\330\347\013\276L"
+	.ascii	"\036<\357\202\250\202\301\177:\217\245\037\316\343\317\301\340"
+	.ascii	"\226\225{X\230\257*\007\203;~=\336\005i\374>\017\330\347\001"
+	.ascii	"\373\250\3761\025\201\307\322\376X\032\277\202\017\301\334\261"
+	.ascii	"\373\224\357\035\206\277\337\357\347\376!\030\376\020\354\035"
+	.ascii	"\377\353Ic\334\001\373\362\277vw,\017\r\27130\0238\205\306\036"
+	.ascii	"\213\001\310G2\2227LX\346\035\243\001\274_\322\037\3136t8\177"
+	.ascii	"\240\3075w\233\b\374\357\265\332\325\242\307\370s\270\203\201"
+	.ascii	"\315\366\210p\304\254\327\314\276\314\250\314\206\210Y\312\335"
+	.ascii	"\207g>6'1\3575\2077#1k\255\374{\323\370\203\361w\315\313\006"
+	.ascii	"?\221\217\345\215\250\017\0351\353\355f\223\021\363\336]\244"
+	.ascii	"l#b\326}\376\347\216\177\374~>\026\354 \241\304\254e\230rP&I"
+	.ascii	"vH\314\332O\234\034\224\265\221\231\361\311\264\210y\313\242"
+	.ascii	"\310\204\210YkO\226\036\rj\263\201:\017\230\0320\232\212\230"
+	.ascii	"\265n\242\213"
+	.string	"h\037\2406Qr\364f\003c\205\304\034\305G\314Q\037s#\3468\033\030C#\346(\377\030\226\330\222X\220\360S\370(\024\024\336\t\321\310\331\300\220J8$c\312\204r\030\235\r\314o\306\344*yI\006\202CM\262\263\201\230\220\230u\230\2307\236\r\304r\260\0301o\367\341,\230I\236\r\304@\364l\340\177\332\263\201\337\350\371\234\351\263\201\017\345\317\006>\220\026\320\006\216+rP\320\006n\370\tb\326\2046P\024g|\245\177J\037\f\276\277\237\214\030.\260\267x\f\303\335\205\273\317\027\206\020\360\207\300\037\365\217\003k\325\314\313\224\274Q\222f9v\221_S\236[gn\256_n\333\222k\227\212\002p\035\273\232\227\267\254\362\246=\227S\335\036n\334\341\\5\265r\035\2731\267\2424\034\216\234RY\362F\315M\226\354*Yr7\352H\336\224\363Xrt[\366\314\215\251:\242$nT\331/\335"
+	.string	"\257r\224\344J\325\323%QueM7=G\034{\345&\352\272*\273sG\323%\271N\027G\216\354I^9k\226'\227\027\213\222'k\266V^\232\270\364\253M{\243\331\366\252\034Uq\252\253\262k"
+	.ascii	"7]\222\035y]\353\310\252\256\312\243r\263\207\222\\\243\211\226"
+	.ascii	"\347\350\252\273\266\254r\263Ty\243\256w\303,i\336\232l\317%"
+	.ascii	"\315\334\314u*j\313\251\2662\025A\363\f\355\315\206\273\331J"
+	.ascii	"\324<\267l$\250\274Fy\243\021\363\362\226\335\275e\335s\221\340"
+	.ascii	"#\320\377\b4\376O\220\245\226$_\211\362.q\340\240\312\333$\214"
+	.ascii	"\362>\321-\316\237\350\361\003z\\\203\364\030Ky\247Xy\253\254"
+	.ascii	"as\016@\201 \365b\311N^-\341\005w\317z\277\274\\B\f\037"
+	.string	"\3132D\317\344\355\022~y\275\350'\202\003\217\235\254\344\003\356\356t'\232KI\023\005!\245\025\201B\204\n\032\315\221\256\371\201\346\240\275a\331j\236\252g{r\231\254\225\2677[{\323\316c\317-\323%K\233\313\222nk\323\251(\002x{\313n\362\310\324\346\346H\026\004\255\004\315\313\233\204\362\246m,h6\026;=yR^$O\312\275n^Z1\232\273\275\325\355\255\220\362\021\023dn\242$\256\035i\236\325\273\315\334\324\221.\252r\241\250\211\003\340\275[\366\234\311ng\32565]\270\251\311\262=\\\315M\336\351\256\252\212\316xjj\226c\333\2328\225]\255|\343X)/O\336vu\3652Gv\347\316|\3469H\223\2751\222\253K\345\255FUv\357p\356\271\316\272\310/\027%e\255\272\312Zu\335,\027\231n\023\325\221<\331\314C\224`\201\232\\2\326t\32137Es\035;\252"
+	.ascii	"\276\366\312\364\354:\247\312s\035]\362\006W\355Ez\246p=\240"
+	.ascii	"\352\2565\331\235K\300\323\223\324\215_\356\311E\262\272\361"
+	.ascii	"tS\322\312Y/\0225\331+ww\272\323\354\032\335\364TW\327lG\036"
+	.ascii	"k\272\345\200\232G\371\224w\221_\243{\362Nt\344\365\332\362\f"
+	.ascii	"\2025\250\222\372\036\223\016\321\314\210"
+	.string	"HA\222$\215\001\302\t\020\bH\201\236\346\262n\022@Bq\210B1\214B\210\020B\214!\306\020\205$FDFDD\324\016U9\300\0310\263\220/\200\324\2461+\214\333^\313\351i\234\2667\030W\376\325\236a\355\252uO\034\300\276T2\357\f1\313/P2W \202\372\0062z\276\030\320\240\341\376\026x^L\r{+\314\250!X\360\211\305\024\353\301\321<\206\005\311\363\313B\240?\005\227\201\232\350\264x\344\317<\361\267*~\340\356\361\303z\236\352\240\233]\304\267\200\326m\201&\207\3219\257\362\030\025H)\274\253\267\324Z4\206\252\346\267\364\023\244*\201\354\326\2303% \315j\036\256rh\275FOoZ\351\372O2\035\330l\217\202<3<\256I\315\332/\022\206\177\234\250\021\205\021'\351\030\347s5^-\b\021\343\375\024\034\310r\330\256\215[3QK^\221\2248Z\310\307w\254R2"
+	.ascii	"\315p\323\033\304(\347\333TR\307\205|\321S\236\"\2404\361\261"
+	.ascii	"\234r\315\320\366E4:\324xk\233+0\273\352\217\330\312\215\346"
+	.ascii	"\024\255\373\231\330\0237\270\367\214\267\267\227\223z\003\311"
+	.ascii	"}\233Q\3474\2120\204\371\360\360}\217\356\371^\352\032\327S\345"
+	.ascii	"la\037\344\005\220nyy\241\200\247t\233U3I\252#\236\023\017\003"
+	.ascii	"!D#\254\201p\337\343\242\335\261\321\035\225\032_h\006\221~\034"
+	.ascii	"^\232\375\030\373\263(S\316+\377\n@y\231\257\026\254\020\267"
+	.ascii	"\032\311\276$;\300Z\334\220F\200q\307 I]\210Z\250\261\354a\345"
+	.ascii	"y\234\327\213\320\242\321\271b\227V\347\201\273\216\307\242I"
+	.ascii	"\253\242\223\202#ZH\343\265\366#\241\027%<\264\232\371\001\007"
+	.ascii	"S\031S\220\230\230\"\333\210c\347\020S\202\210!O@\270%\201o\304"
+	.ascii	"\031h \220\322Dd~\214z\230\222e\026.k\240i)\245\204\362-C^_\264"
+	.ascii	"\270\\x\033\201\360\214\315\004h\033\3616\354wK\220\321\320J"
+	.ascii	"\263D=\303\342q\221\030+\033\300\232\257'\3449\t\352\206\021"
+	.ascii	"\316\214\3724\223f\032'\276\270\241\211\271\003\2527,v? \356"
+	.ascii	"\375QU\021\2203\273\3262\315\276\315\323\266\320ZA4\300\266P"
+	.ascii	"\321\002\3025#\352IB[\002\306\002\035f\3518 \254'\264"
+	.ascii	"\220L\242\025\263I\203\356\205\035\013\031\177j\221Xu\341V\244"
+	.ascii	"\326\2117\302\271\352\362;\321\321\214\351\330.\230\266:;'\004"
+	.ascii	"\303\250\260\252\367\224r\227?\272\213\255\3700\266\215#'&\036"
+	.ascii	"\270\252\231\006\201\261\222XuN\314\355\373=\200\303\021\303"
+	.ascii	"\033\030dk\371(\030\263l.\213ozt\035d\016\f\345\301\030\313\243"
+	.ascii	"\300zIr\324ew8'^\266\334\254\223q\215\207\007\033Q\301HG6Jqi"
+	.ascii	"\274\001du\345\276(6\232%\0331o\220I\377\370b\214\214\306)\320"
+	.ascii	"\025\002t;\316Y\036O\250b\335(\005.\302\331\246\313\343.(/\200"
+	.ascii	"bO\321\206\220\250o\220\006\263%\221(\323A\002\317iT\302zm"
+	.string	"\224k\273\256m\005\201&j\177<\037\343&\363\211t\005[\020N\007\177\004F\310\261WD\350'\367\366^\264j\033\374\024)\021\023\235\005\313D\n7\253;s\264\360\306 \371\022J\301\013T\b\345\t\005;\311e\302\034\342T\276l\210\353\246\250'\027@\242\237\206\240mK\257\211\002\021\250\315\310\232f\\J\274\304Y\025\300s\213\337]\230\220\377W7\220`\356-\020s8\251\305\033\225N\207\226\367\240\256\340\n\231\363\270\244~\031U\001g=\352V\n\226\262\310\313G\344\031qL\237zX\236i\270\n\374\243\207p6\037\301\340`t\362\316Hw\237+\223=j\311N\345\357\001{\b\361\0324L\001X\320:\254\3110\240\200dX\256\021\250\306\367\212\036\373a0J@\241?\213\362\306a\337\265\261\001U\367c9~\0247e4g\251g\033Dk\313ML\r\306@D\212\376\021X\3248'\306\377(\224"
+	.ascii	"Z\256YF!\316\365\271\336Rk\202*\341\244r\366{\250\320j\223~\032"
+	.ascii	"\032,\351\206$q\332\r\260\027\"\306\017\032\264O/8\240s\273\354"
+	.ascii	"\233\311\t\177\017\340\361\247\006\021\211Btoi\bD\312\203\253"
+	.ascii	"\376QA\373\371\0358\243\274\232K\354\025r\300\272\200p\230m\b"
+	.ascii	"0\236\033\205\367\262\357\232\315\240%\201\2454\364\243{N\246"
+	.ascii	"\304\n]\315\373\353!F)\"\203&M\357%\013\262\206D\267\001\020"
+	.ascii	"V\300\017\006\264Fw\355\222\026\322Xr)\374Z\002\317\236\356\206"
+	.ascii	"W\222\212|\336"
+	.text
+	.section	.gnu.lto_.pureconst.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375 }5\003"
+	.string	"\322\207\030\037`W\032\003!\bnm\016R!\240\307!\300\277\355s\250u\fF\273\005\273r\346\2217\276\354^r\222\217<\221\207d O\037O\036\3578\3077\256\361\214c\374\"\263x\305)\266\211K\274\210C\374\341\016[\303\031\276\360\024\266\312\226p\204\355\340\031L\025<\202\017<\201\250\200\007\220\255j\255e\n"
+	.text
+	.section	.gnu.lto_.ipa_modref.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`c\005\035\024"
+	.string	"v\025H< S\223\341"
+	.string	"\f"
+	.string	"\f"
+	.string	"\f8\202J\007\30033\372\335\035\376\361\356\256\347w\255\254\233\225\226-\240@t\364?\220\273\357\212/\206\315\3418 \246\257"
+	.string	"\323\366\3060\023B\2104)S2"
+	.string	"3"
+	.string	"9"
+	.string	"\235\257\325ouTguV\247\341\255K\t\020eyN\300RN\242=\251N:\240\314\312"
+	.ascii	"\177\305O\371\247\323S\356\031\321\331)\027\321i\003\013\370"
+	.ascii	"j\023\363\300\223\244,\360\334\334\225+\301\274ra\223$\3050\266"
+	.ascii	"\032B\354GFN\220\346"
+	.string	"4(\2530\003xO\310{\357\211(O\216F\275\3454!\232\352L\206\032\275`\241\302\223\302ss\350M\370K\223\204fW\256\271\3119\254\263\244\344r#\f\341\301\333\326\226J\007?1xv\001E\301\023\306\013\027-X\254P\321\024E!\202\240\301;k4\215\306\311Xc\032'Cm[\211\022b\020\241\017\f\002\344\207\217\036<v\350\310\321y\225_&&8n\330\250Ac\206\207\324\354\311(\306C;\374|\326+\207v\203\3661:ex\f\177\200\277\250Qae\263)H\226\335`\002\031\252\262z\021\260\0312\322\231\024$)\264\006|\340e\222\222\203\216\034%\213:U x{_/\326.\250\fm\372\016\367\025~\372?Q\3566(\036\360C$>\252\306\003]\215r\020\241\376\200tD\210\037\004@\024\263\334:!\017 \262\035\r\t]E\nzw5:\341%\024\314I1-c\021\341\214\346"
+	.ascii	"$\312Do^C\350\213\007X\302\330\243\004\212\\\036\347\025:\321"
+	.ascii	"\311+R\271y\\\346bk?\356\334\214\300\216J\276\021z\234\250\035"
+	.ascii	"O g\334=\222\202\213\252\220=\3230h\321\030S\264\210.\027\005"
+	.ascii	"\360:%/\260\344<\026\214\216\3350\021\272=\266D\252\252\n\260"
+	.ascii	"\025:~\263=\361\206\272\364b@(\313B\355\212s~\211kUPp\353|\366"
+	.ascii	"\321\206n4\314\177 m:\324.\235\\\251$sG=sR\373\177j\205\203\005"
+	.ascii	"\3520k,\020\254\230\321\214\227{&\360R\020\335wB\035cD\177\336"
+	.ascii	"\232Q0\025k\347\224\005\013\332,\362<F\020\177\314@\253l\226"
+	.ascii	"0\264\354\205\221N,p7/G:%\235\275\205\354\231\337\266\224\310"
+	.ascii	"\231\337\341a`~Q\345\330\326\306\027\276\267\267\226\273x\317"
+	.ascii	"\204\243\001=\206\232k\340D\242\324\365\017\365R\320"
+	.text
+	.section	.gnu.lto_.lto.a12f4ea209d8e9ed,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_blackboxConfig_Registry.110.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375 \231E\004"
+	.string	"t\007`"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001\212\001\206\200\200\374\342\203\325\221\035\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\374\006us\317\006uq"
+	.string	"\005\001\006'\001\006\005?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\005"
+	.ascii	"\312R0\345z\230\305S\324}\003(\002"
+	.text
+	.section	.gnu.lto_pgResetTemplate_blackboxConfig.112.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375 7\225\001"
+	.string	"t\002*"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\001"
+	.string	"\003\005\001\006'\001 ?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001"
+	.string	"\003"
+	.ascii	"@D\312-\003(\002"
+	.text
+	.section	.gnu.lto_blackboxHeader.113.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375 b\021\003"
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	"Q"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002\206\b\177"
+	.string	"OH Product:Blackbox flight data recorder by Nicholas Sherlock\nH Data version:2\n"
+	.text
+	.section	.gnu.lto_blackboxFieldHeaderNames.114.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"\255\006"
+	.string	"t\013\265"
+	.string	""
+	.string	""
+	.string	"P"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\300\236\002}\273\001"
+	.string	"\005\001\006\025\001\005\005\001'8\206\b{\270\357Qy\276\004\330\356\001}\301\003\230\356\001y\304\002\005\001'C\206\bw\355\001u\307'K\206\bs\230\355\001q\311\001"
+	.string	"?\202\210\2000o3\312\0014\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\tencoding"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\npredictor"
+	.string	"\007signed"
+	.string	"\005name"
+	.string	"\013"
+	.string	"\016\253\3044\244\006\226"
+	.ascii	"\302A\246YI\346\323}\\I\341\323\351\006\345\036\006\212"
+	.text
+	.section	.gnu.lto_blackboxMainFields.115.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`\274\n\345\""
+	.string	"\326t\304AP\350i\016\225pPL\321UN\024#\276\222\367\017\332U1\251\235\021"
+	.string	"\n@U\200TW_\212m\317j\243mD&(\204\b\b\252\266\n\316S\211\002\233_e\013\250\261#\006\224\236X\373\313\224d\263"
+	.string	"\272"
+	.string	"\256"
+	.string	"\021\356\034m=\026KXd\2675\331;A\016\016\272pN\321\326d H\027\023P\020\n\247\334\355\255\3658\270\255\313\362R\005\266\266\326\013\021\332\032-\366\2670\374\323z @[\247\275\177\341\f\255u\265\264\255\323b\235\204!\213\254\365\270lk\265\244\fa|\366l\255\026k\340\352j\335K\317\326k/O\211\274\032fi\265\276ug\353\265\370\003\351\242\222\2507x\002+\240\303\251\013U\207\247\374*\350p\r\237\323:\035\0349\034\213JH\217\020X\273\007\203\231E\271\243\242r\275\312\305\035\243\373\244\213\2423\340\2718z\006\340\021x.\346\253\234{r\001t\356d)\017\036\364\353\342"
+	.string	"ZY\350\333\275\002\352\320A\337n\300\325\331_\t\321\277\363*\322E&8\303)\267\222\023\207\305?\212[\214\256\016\322\305"
+	.string	"\004\326\264a\343\342!\275/F7\212tQ@\0014g\234>Rl\200\314\030'=|\017\274\0270_\234\364\020\306\350\316 ]\354!p\267-ZL\255\005\343\251"
+	.ascii	"=,u!\374U\332\277\362Vb\350\256rt]\220.\356`R\020\3455\265\327"
+	.ascii	"\273\300I\023S{\305\f\034V\222\304\324_\3579\272(H\027\033\030"
+	.ascii	")\202\352\257\330\301\017\021\202j\261\367\301\373x \377\003"
+	.ascii	"\325b\361ot\233H\027\021@x\252H[\217\275\001=\336\375 _\365D"
+	.ascii	"\376\310#\371%\317\344\237<\224\227\362S\036\313gy.\337\345\303"
+	.ascii	"\274\230/\363f>\315\253y7\377\346\255\036\3769\217\365v~\370"
+	.ascii	"w~\353\271\276\353\301>\354\307\236\354\315>|\332\253\375\237"
+	.ascii	"\007\364\203\236\355\013\275\241\177{\270O\364rO\347\341\027"
+	.ascii	"u8!nY\245\036fW\227\342\333V\214\256\243!\331\346\024\305x7\027"
+	.ascii	"\203(n\377\333\253\335\016\355\177\213\223`Bm\373\341\266\b\n"
+	.ascii	"\264?\356\345\371Y\333\037\027+q\241\235\355\237{\251\224\001"
+	.ascii	"\035\356\023\357"
+	.string	"\237#\360{\200\016\213\361\331O\367\026\350\275\036\240\303_\357\265?9J\375\261\345z\262%\244T\025j@>\323\037+f\025%H\004\1777J^\226\021U\246\251\332d\256=\266|\262\261\224\331\340\311\226&N\264\\O\251\264dB\313T)\263P\"\324\265\0341\346_0\270\212\271\211\204\bu\305\201\216\231\006\253\252)\013\323,{\031\255\361t\312\340\345Ue\325\224\227M\0167\324'\240YB=\371\242~e\3523\327\240\217\303\204\254J\235\253\217U\325\325\267\224U\033\353\031\344e\257\343v\034\217\347\361/\007s1\037\363>n\346k\356\307\005\371 7\344\207\034\221'r:\257sF\336\310\0379\244\347\361\001\200\323\250\221lD\320ZX\036\205\3122\006 #\021!R\007\021P4\206\2141\b\223#Yh1\300C\035\230\3769\n\325\003\225\311\223\255P@\250\026\274//#\230\b\n\030\016g\362\215"
+	.string	"\343\330\344\351\036\374x?\3353\036\020\217\366\223\356\363\025\022\240\217\366\340\307\373\351\236\361\200\306\272\302\356"
+	.string	"\210\324\254\n0\225\032ND\231\013\352b\343\t[\r\304-Pg\321\342\221"
+	.ascii	"{\351\234-\242{\322\376\371\210\236\264\177~\221[\317\335\200"
+	.ascii	"!\027\260\251.\301\305I\363\026\273\f\335\210dm\361\026\220\314"
+	.ascii	"\035\362\226o\357\353$A\306\r\025I\220\021\356O\003\2738F\016"
+	.ascii	"\256\236{\210C74\375g\260\376\b\230\252\366\366\253\343\200\340"
+	.ascii	"\275\275\267\210\203\211\344\366\b\377\335\335*\327\177\037\210"
+	.ascii	"7\322.\355\226\365\234\341\277;\350!%\3774\260\266\007b\205\256"
+	.ascii	"H\356n\"\f\251\310/\344\247N\301B3\253D,T\377\326\202\373\002"
+	.ascii	"\233\203+zn \035Y\274\234LU\340-\352S\356\362B\bE\276v \242%"
+	.ascii	"\r\260\244\016\177\240\203q\266\311v\205\312\356\256\330\\\020"
+	.ascii	"\013\201\263\023m\306)\257aM\357\026\031\361\327\262\271\346"
+	.ascii	"\034\202E\037"
+	.text
+	.section	.gnu.lto_blackboxGpsGFields.116.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`<\001\025\013"
+	.string	"\204\021\272\001"
+	.string	""
+	.string	"v"
+	.string	"\005\001\006\035\001\001\005\001\006\030\001\177\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\255\222\361\275\n}\276?\202\210\2000{y\277\001w\275\001u\273\001s\273\001q\274\001o\273\025\001\006\005\001'A\206\bm\330\356\003k\302\303\005\005\001'L\206\bi\230\356\003g\306\307\004\007\001\005\001'Z\355\003k\314\315\001w\313\001u\274\001s\312\001q\273\003"
+	.string	"\230\355\003k\321\322\001w\320\002\005\001'e\206\be\330\354\003c\325\326\035\001\023\n\005\001'q\206\ba\230\354\003_\332\333\331\3308]3\334\0014\327\001\324\001\323\001\317\001\316\001\311\001\310\001\305\001\304\001\301\001\300\001"
+	.string	"\022GPS_ground_course"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\nspeed"
+	.string	"\raltitudecoord"
+	.string	"\013numSat"
+	.string	"\005time"
+	.ascii	"! \360\"\022\233\007 \030\376pC\030!\002A\2242qO\264\363\030"
+	.ascii	"\343\363u\221VpK\"\335F\207\3148Oh\250\247dlBP\376\033\222\303"
+	.ascii	"4\306\261\333\255\374\267\3212\376g\270yf\277m\255S\326\305\320"
+	.ascii	"\203)\002"
+	.text
+	.section	.gnu.lto_blackboxGpsHFields.117.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375 \302\235\004"
+	.string	"\204\007\177"
+	.string	""
+	.string	""
+	.string	"7"
+	.string	"\005\001\006\035\001\001\005\001\006\030'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\340\276\n}\276?\202\210\200({y\277\001w\275\001u\274\001s\273\001q\273"
+	.string	"\330\365\003}\302\303\001w\301\020o3\304\0014\300\001"
+	.string	"\tGPS_home"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\n"
+	.string	"\303*PB\b`\223\252\f\005\222\301\n\257\243\354\002\373R\306\033"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_blackboxSlowFields.118.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`\257"
+	.string	"}\t"
+	.string	"\304\017!\001"
+	.string	""
+	.string	"\202"
+	.string	"\005\001\006\035\001\007\030\001\177\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\271\232\371\277\n}\276?\202\210\200({y\277\001w\275\001u\274\001s\274\001q\273\001\005\001\006\025\001\004\005\001'E\206\bo\230\377\003m\302\303\003\005\001'W\206\bk\330\376\003i\306\307\002\001\005\001'f\206\bg\330\375\003e\313\314\312r\206\bc\230\375\003a\316\317_3\320\0014\315\001\311\001\310\001\305\001\304\001\301\001\300\001"
+	.string	"\026rxFlightChannelsValid"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\021rxSignalReceived"
+	.string	"\016failsafePhase"
+	.string	"\013stateFlags"
+	.string	"\020fModeFlags"
+	.string	"\025"
+	.ascii	"\022\007\001\013\253\016l.\003\207\001\363@\346S\226\001#\300"
+	.ascii	"\3506\222Q\246e\300\013`4\310\030xV\225y\302*IA\031\276\330J"
+	.ascii	"i\020\003p"
+	.text
+	.section	.gnu.lto_blackboxMayEditConfig.139.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375 \375\305\006"
+	.string	"\222\214.5@o\222\016\230>U\177\346\003\245\271\242\201\264\023\207\004\2218o`\301\311\376\337tlr\214+\224\177\225\006\206ax\324\346"
+	.string	"\3330"
+	.string	"\255\300\006\254mm\023\231\002W\032\n\213\303Pm\0328\357aa\343\360\252+\342i\004\266 \022\256'aY\327\313h\331\021\007B(\272\355\\\212\210\035\201\210*\322\221\316\365x\302\343\232\225\272\236K\251\"\300E\310m\257\201\034j|\247\304\214\337\215\316\335)\300\"E\241$\223\264\265$\nu\362\361\177>\263\301\301g\254\032\007\251\035\333\210\204%S{\270Q\254\016\273\r\351\264\242b\222\225@u\030\204\314\334e\245\212\216\375\t\376\202\037#\n"
+	.ascii	"`\251'3 \f3\205\273\021\312\022\327\304\307\210\274\204\310\341"
+	.ascii	"\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_testBlackboxConditionUncached.141.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`\357\t-1"
+	.ascii	"jTx\022D`\246\326\030\263\223\330\206\260\372\323\325*5\277n"
+	.ascii	"\202\035\2560\371'#\035\3032\211\200.\311\314\220\224\340\202"
+	.ascii	")\227\374\023\270%\303\177r\274ek\347S Q\360\021>\374\004w\274"
+	.ascii	"\330%\333\275\222H)SJ)\027\001\002\001\027\001\334\262\316\274"
+	.ascii	"wfU\347uuV\337\371Ug\177\347>\320r\240vR&\266\367\225\232\336"
+	.ascii	"y\241\253\027/fnf\226\301\374cfw\346&\3532\031\375\214\241\022"
+	.ascii	"\337\244\221%\227\367=c\300\r\332^\211\372\310\366\252\266\017"
+	.ascii	"\333+3\263\003\b2\330\355\263,)\036\023\210\022\315\356}\317"
+	.ascii	"\216\036I\273\r\364\203<\032}\212=\304\2410\b\374\371z-\217]"
+	.ascii	"\325w\227\373\251\201\204k8~:H\335\220\"\273\372\330\345F\256"
+	.ascii	"-\367A\256\325\220\026\307\342\260!\273\353\321j\242\334\224"
+	.ascii	"\226J4T\217R]\313\226\233\022\242&\240\353R\327fM\200\311T\226"
+	.ascii	"\013\033*\254\203n\200AL6\277\240\333\227\317\307\314\322s\342"
+	.ascii	"2kC\250\215Iy\255\217f\225\253\232\240If\207\220j\206z4c\344"
+	.ascii	"\315\217\212\206\253m\326\353T\033;\262\273\"9\302\372\225$\371"
+	.ascii	"\321\274\262\252\n\002$\351"
+	.string	"\243\212\nc\325:\035c\272\310\224W\320yI\357\373\262/\251r4\003h\346\256cf$\346\026,I*\362\375\215^ES>\243|\312\375\376\255\314\003\345S\006:3\323\t\357e\2771H\0344\352\237\270\321\272\277\320\331\321=9\036\243\257+\264W\303\275\346\310\\\362\0169\303\215\306(\265\\\002\3456\303Q\244;M+\0372\r\327e\210E7P\262\2601\334n\034E\242kZ\r\305p\263q\224\245\363#\370\205\033\fG\3318m@.\334]~mj\334[|\354\313\227ye\t\026\356,\034e\311\264\365\252tZ[\341h\333m\273\341\235\263#\013{\207L\341\246\302\321\007t\035\203\355\265\2430st\302\233\246\325\373>u\223\231\243\276|\021\364\212\3746k\237\033\230T\363mz\036\346\263(\177's\377t:e\343\307b#v6\300\316E\354\\\200\235\211\330y\210\235\007\260\263\020;\007\261s"
+	.ascii	"v\006\352g7\262\347"
+	.string	"\\\3549\367\364\234\211\354<|g\341;\007\331\031\330:\377\330\331\367\316=\236\007m\222n\307\313m(\271\322k\270_n\023\327\211\367\322u\302\366\332\363\261's\232em\335\302w\2365'u\360\235\256\030\333\376\220\227'\236t\305<\252\245s\027\2469\t\350\226\261\274'z6\215\013\305_\267,OO]3\n\025*\260\275\362\352\346\210=\2754'\375\324\002o\254r\262\326\376\366\345\023\340m[`\231/`\360^\026\275\261\312\0074\251\245\375MG\357\235\032X\366\205^HM\t\2063t\035\r\035\227\305\314-\272\216\203Q\326\373\276\022:4\035\017\355\373\276\021\346\274\370P\304f\313\005\333+\373\035\247\365\034N\247S\272>\300\"\177}V\215F\223\233\256\245.\270\267\030D\210\020\337\353\021w\367\343\255\335\355\016\332\276\223}U\320\316.h\342\337`&\276\001\226\367N\356F^\025\371\302>\026\200\n"
+	.ascii	"\246U=\326Vb\377\177l\312\\\322\3550\263\210~\243\324\276o2\002"
+	.ascii	"w\233v3\202{\253W^2\261r\233`{}#1pbO\250+\315\001*\232\230Z0"
+	.ascii	"\225P\321\264\324\343\245\0060\232H\234X\032\201\202\304\221"
+	.ascii	"\n\246\021)\216\226\234X\0345\030\342\246\025&\234\216Z459\035"
+	.ascii	"\375\316\240Z}\037\213{N\032\375\001z\377\222>\221\001\336\347"
+	.ascii	"\2448\212A\377\303\205G\271\3263\340yp\356\322\326\202\316\354"
+	.ascii	"\206\003\003\016\375\177\301\341\370\021}\277\035\361\025\370"
+	.ascii	"&2\346\331+z\241\223-O+\364/\306\326\3053\360E\246\227r\355\215"
+	.ascii	",\300\271J[\363n\227\035~\024\267\224\346$\025\310\256\205\017"
+	.ascii	"\364\255\004\343@<\210\006\367\312\025\"\204\355U\370<$ibi\332"
+	.ascii	"\313T\375\034\025\264\033\027t\261\370\001\220\002\250\324\355"
+	.ascii	"8>\226/"
+	.string	";\370\316\204\210\373P\352\021|\2449\237\266-r\306w:\263\201\357L\200ol\312\265\227\341\001\365q\262\277\017\3725\214\021\247r\235R>\345\"\321r\225(a{\375!PR\021\213kN*\016\025\264\023\027tO\317\017\350!\222\202\305\021]\326'\300\375}].\337w\227!\311\177r\340T-\313P\211\355\275\327M\t\200\310\250a0\002!D\206hD\244 I\n\205\016\300\002\221\231\252n\021\320<\346\250\032\031\005I\222\266\003 a\204]\210\201\220T\271f\210\220\b\247\247(N\302\306eH\320\n\337k\245\270E\367|\353\324\n\\X\273K[J9\255\215\f)'\231\310\204\034\275\231\206\371d\024K\222\205=\375\244\fS\220\201\206\\J9\271j\351\201/\311\245\314\005\276Nc\365\237\203~62\216\260\275\300\263qj\356`\374\034\221d\327\221\251m\022,\246\341\336\256\325\205\321\t>\344#\254"
+	.ascii	"\355\032&\3369\200%*\005\256\3727j\253\201\023\204\261R\035\350"
+	.ascii	".\255\322H\201w0\321\"}%\225Fz\332^\375\364>\222M\204(\315\244"
+	.ascii	"\003\203&\007\327\277c\226bo\206\210Q\260l<\353\300\247\022\027"
+	.ascii	"\231\017\374\002\006F\310X\264I\272\262+iQA\253]r?\030ia\326"
+	.ascii	"\274w4\274\217O\352F\020\245.\222\305\263\260\326\270\323L12"
+	.ascii	"\212e\3522D\\\3140\347\345\232\227F\376\365\340\266D]\364\260"
+	.ascii	"\372b\304\306\261rh\224\231p\271\225\227\273\313\006P\022\210"
+	.ascii	"x\260\324\313\350\356\233J\365M\260\316\306\351PU\352\272\016"
+	.ascii	"\357q\177\r\344%'\223H;\252\337\232\341\234\224t\301\242\353"
+	.ascii	"\214\350\230\304\365\345\376\0034\264\240\333$\"<'>\345\2767"
+	.ascii	"mi\350b\036;2\244\002\351\004\222\344%\030-Z8\314\206R\001"
+	.text
+	.section	.gnu.lto_blackboxBuildConditionCache.142.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`\246\001\335\017"
+	.string	"\266\334fF"
+	.string	"\261&\035\003W\027\247\214\337\316^\235#^tow\361J\264\223\t\270\023\375A\370\311O\370\2606\311\212^\213\326\211#QQ\233'\242\363j\227\376\377?\307\222\237\251\210\233w\340\245\203\232\215\236\220\275\267\224)\005R"
+	.string	"N"
+	.string	"T"
+	.string	"3/*\026>s\316mIX\252\351\231\214p\325\344\333\274"
+	.ascii	"\017\234\316;=\203\252\003\243%\362TpAL\r\315\277+\213\207R\371"
+	.ascii	"A\323\362\b\342P\344a\200!sN\220\227\322\375\367\0030\236\316"
+	.ascii	"k\271f\r\346\234\326\316\353pk\267\235\262\255\300>\215\007\221"
+	.ascii	"\251\341\343u\261Cg\335\022\252#TC\250\336U\253\252/\032\360"
+	.ascii	"\232a\2415\347\206\330\317t\305\234\231\263n\377\204\377\031"
+	.ascii	"t\024Oa:+E;q\320rZ%^s~\b\036=\322\036C\016\"\037\341\003\310"
+	.ascii	"\307\203l\262m\374{\231Y-\340\032\200\t\241\273{U\017\271\t\256"
+	.ascii	"\373\032\330\215\225\037\224\306\276\003\306\305\nxA~K7=)\205"
+	.ascii	"\371C\345\332$\334\376\3735\354\310p\245\366\264=1<d\330]\231"
+	.ascii	"H_\305oL|\031\237\240\350\273G\037E>f8:&t\250h\314\376N\272+"
+	.ascii	";\016J8\0224iT\201\033\211@\022\2210\262\225@\020!\331H\245\223"
+	.ascii	"mD\300\334\204\007\245\215\002\307\2256\3207\277.\266\315\265"
+	.ascii	"\035\034.\225Ee\2732\203.\206\026@\214\232E\300\210\3039\347"
+	.ascii	"\224\273z\212\224\033\332\354\005\343Y\021\201\322\230\306\270"
+	.ascii	"/\336\345\200\273\033\367\252\017\001' @\002\243\220\252\033"
+	.ascii	"`\352\305\003{O+\332\036&\325\257\217\271\264\0020\327\342\330"
+	.ascii	"\303\026K\260\240\344\022n\034\262\030\212\235\302\004\203-,"
+	.ascii	"!\020k\317\214>\253\232\r,k\305\213\235\202Z_,\240\215\254\244"
+	.ascii	"\026\032\332B\342\352\364\323Dw\f\205\nQ|\313\246cu\330\264\337"
+	.ascii	"\021\314\023"
+	.text
+	.section	.gnu.lto_writeIntraframe.145.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`u\021}I"
+	.string	"\332yh\032<0\246N\007tR\347\277\276\004\237\254\340\026\f2'\006\347\023VAI\303]\220\254\225m\235\311\221\245\333\355\376\3639\223\301\371\264#\026"
+	.string	"\323\r\347\fv\315 \023\021!{\357\224R\n\225\001r\001\246\001C\347!\353,\024:\263\254\363\272:\253\253\363\253\316\256:\267\217\254Bx\200n\350\234\037(\275M\246\231n\240U\017L\373u\357\351\276\353n\323*s\367a#\036\233T\315 \237>\276"
+	.ascii	"\2753\310\307\306=\254\247\257\332m$\203tn\202\367\336\020\303"
+	.ascii	"\275\277>\275\300><\215\372\354t\336\234\333\024:\310)t\316\233"
+	.ascii	"8Yy}\375\246\3410\033yH\273\341\177\326\t\343\246\346\336k\354"
+	.ascii	"\225y\b\263\261\327b\257i<6rK\233M\333m\212\250\027*\275jG<$"
+	.ascii	"}R\013\303^Y:l5m\327\366\235\021.4\351}\n\001\243\203j\272ze"
+	.ascii	"\260a\257\\m\305\366\2526\025\333+\267\314\215\220G\256Y\004"
+	.ascii	"\272$io\006\357\275\311\327\"\024b\361\267*mf\277m\255,$\326"
+	.ascii	"\225U\025\325\224"
+	.string	"T\024\324\361\311\311X$\016\205\354\252\276\267\334B\rx] Z\b/p\316\323\254\265\322tV\232:G\252\303AN\320\250\025\2768V\02650}%\324\320\247\r\260I\325\324]Q\003\323V^\272\312\313\234S\311\365\224\\\027\227\342\322Q\\\2668T\225>Vq\363'*\355De\212\033\333\272\330\306\346D\002W\324\242=\354AN\242\215\327\004\3048\201\272P\215\272\367\036\237i\252\003W\362d:[\244[\3535J\253j\003\301<\224\216\317#\252U\223/N\343\023\315\277\371\272\001\364\0163p\316s\255]\250\341\336\313\356|\2525o5\263\017\231Y\004s\024VL\237\362\372\3547\243\264MQa\277~\363\3650\020/\311\264\351\306\354W\005\333\272v\244\002r\256\025\360\257\376gn\355\3325F+G\026\005q2ohE\034\206\275\016\357\275\377X\200I\370\234k\316\035\372\220\230O\340\016\\n\372"
+	.string	"\266e\256\b\333\253?\222N\364n\313\373\231G\220\340j\300&$\306=\307%N\234`{\355G\346\361\201Z9\313i\326\3032\247X\341\355\344\005\203\332\002\241\275\231W\003*\202\341\320\275\267\002\367\237\376k\301=\327+\273x\341\355|\301\366\252\341\205on\346\334\354\364\316|\312,e\372\307I\037\013\263\352\334CuV\252\316d\2523\017\325y\207\352\254Cu\316\241:\343P\235o\250\3166T\347\032\2523\r\325y\206\352<&\243\375\232a\260\316+\372\256Y\205\352\214Bu6\241:\213\251\316\"Tg\020Eg\017\335\246YC\3735C\350=\315a\356\374"
+	.ascii	"\312\331\001\224s\362\350\fvt\376::{\035\235\273\334\271\001"
+	.ascii	"\353\314\200u^@tV\300:'`\235\021\020\235\017\260\316\006\210"
+	.ascii	"\316\005\236\234\t\250\316\\N\316\003\234\234\00589\007 :\003"
+	.ascii	"\030:o\031\235\265\214\316Y\2523\262\350\214\305:_\031\235\255"
+	.ascii	"T\347\252\2423\225\352<Ut\226*:G\025\235\241T\347#\353\374\304"
+	.ascii	":;\025\235\215\254s\221\350L\fq\250\264\304\2309\235\326o\301"
+	.ascii	"A\003\235kS;\006\351\370\035_t|\317\3112\3121\275K\326k\301A"
+	.ascii	"\371\234kRH\254G\036q-X\323\250\034k\330\370\305\3619\260\340"
+	.ascii	"\370\246\303PWm\232\277\265c\234\016%\257>\fJ\251\356x#M\224"
+	.ascii	"\215\277\341f\343\333\316\223\025\004o\303\221\304\331Z%V\277"
+	.ascii	"\005\307\244\222s\315\251\306\231!\215\257!\205\3067\036c\025"
+	.ascii	"\325W}3q(T\337x\240\213,\335\025g\214a\351\330\317x\216}\353"
+	.ascii	"\021\267|\312\303OI\325I\333t6\235\266\002V\352=<{\032\224\371"
+	.ascii	"P/\365Y\232\232a\230M\234I\373\214\372v\203\350\316\235\256\244"
+	.ascii	"}>i\243Da{\205z\366\016j\250\016:\374\270I\r\302\241K\300\274"
+	.ascii	"q\335^\300\212x\020\236&\342{\257\235\216\235\240\233\035\364"
+	.ascii	"\370\364\307\377r\372\342?=RO3\214\361\235Z)\216\326F\207\367"
+	.ascii	"\242M`?sf\333\306-\225\266J[\205\355\325\370\275\207\350\216"
+	.ascii	"\370E0\277\355\033\205i+\007F\374\376\203\376\261\244\007\346"
+	.ascii	"_=\214k\265dRriL\255\334\360\033\257Y\3009\0359\327\204\037\307"
+	.ascii	"B\277U\306\177\"\357\352\260W\362\325a\337wx\355\367^3\366\343"
+	.ascii	"\302^\306C\301%\251\344+\003\027\202i\351\330z\260\035s\344\266"
+	.ascii	"LW\222 \374\013\320\275\272"
+	.string	"\f_\234n\352\307\261\030+\366S\226h\021\024\t0\021\232_b\024o\342\305\276\323\240L\237Jj\317\230\370\004\\\240+\036\3057\373^\275\342\233OwI\371c\006\302\311\024B\032\b\031\215\262\262 \034\240\200\220\005Qr(S\002Q\362(\362\030\230\020\245\f\035c1v\310H\222\341\210\301#9V\366#\t6\200\225=h\224%\201(\225eI\243\364\254\037\013{\250\013cI\360\354\231\334\275,\304\2623\362F\313B\201KD\210\330^\211D\013\241\221\364\340\025%r\360\354\207\002\037|7\311\364a\223\357@\f\363\223\377\365`\237\245\247\251\327^\377\365HFM7\246\244f?l\327{}7\375\bZ:\032\336{\326Nv@\036h\251h\311h\351h\351\210\355z,\300)yM3L\357\343\177\374\370\221\331V\311\t\251\301;\237\"W[\372\376\215\023\322\236\"C\327\323\340[L\364\257N\217\265\030"
+	.string	"\301\262\340\031|\327Q\360\013\374\216\347y\344x\326^\025|\373E\371\352\364\262z(2S\225\337\203\216\362\033\016\362\343\230\230\350\n\306\177\"+\257\206\240\342!\370Q\357\275\027\013\302\303x*<\266\274\246\033\003O\200\340\r|\202\357:\007\036\201\234\366\255\367\342,5u\235\003z\005\336@\013u8\355\333\2047\311\002\337}z\365\213\356Y\372\227\336kvE\340U|kJ\333\344\301\231\227\223\226\225\274\235\004\376\003\031Z\023\210\371f\274\345\\\003\236\353\277\232\177\002>\300\017\370n\206aJ\235\r\337YZb;l\207\355U\300\023\241"
+	.string	">\300\263\232\232\202g>\365\273\366M\302\022\223\333-5\201\001\370\336\023\265S\247g\365q\352V\235r9u4\255\334\326o\301E\363\252\310"
+	.string	"\373^\036OV\206\307w\201^\250a<e\221BB2\"A$I\222\264\006\301\005\204\030\246\234\264\016\021\360\234cN!\"\"IR\350\252\354\t\322h\336\\\303e\227c\3405\252\323\332\325\214\354\254N\347\004\264L'B\335\267\213\300\220\023T\243.\025\202U\265\220\240X\335\272\3454\025)\207(\302P\343"
+	.string	"\250\236\303[\256\273\210\266T\325\327`\214\220I\235\201\250I\360\212j\275\242u:_L\370\032R\245$\352c\344k\223\372cRQ\036\017W(#l\271i\3504\314\265 \305\341@\016\264\337\263\203\361~:\002\370\376\363\241\213\302\363/{3\274\240\226\002\037\032\021\315\2056\201\314\263&\3219H\216g\020\303\304\361\251\202\364\215\240\346\271Y\226\222\227n\312\245\275\277\362\224v\f\245\302[\306\017\t"
+	.string	"$\205\341|\223\252\366\341\320"
+	.ascii	"\302\243\036\276\345\031\254\031\007p\221Q?8\220\235`\004\216"
+	.ascii	"\302\355F\250\336\345\331\356E\230\235\212\225\254\372\230\245"
+	.ascii	"\nl\307\335\241\336\221\023W:\334Z\220s\354\003A\310\363\304"
+	.ascii	"L\244\005\021\217OM\203G\023\263Z"
+	.ascii	"\2330E\020\265\025\357\362R\24568\351\260\347x\324X\210\356\031"
+	.ascii	"P\236\211\355\226\243~uhM\017&\016\207\320>A'\352c1\327\207-"
+	.ascii	"2\t\372k\354\021,"
+	.string	"\b\256\214\372\3437\303\340\3050\253\365\234\005\233\315\361\341\332\353\022WM\274\305|\004K\324\240\257\364\345`\372O\321q\374i\022\225\265\332v\241t\001)\334tT\330\005\332\275U\240\311D\246\267\271\330\034SV\276\252O\236x\212\037q7\325\365\315\213\226t\301\003zfg\210\bc\366\233\365\256\346!\274c\326\022\215\353\345\3014\203<[\340t~_\b\021vuN\341\022\202\225J\332D\206\021\024\3537\245\237\006\3202i-\351B\364\253\"\202\006\037\001=\006\\\217%qK\324\261m\001\311\271\27789\033\002w\362\256\361\031\376\342P\263\310{G\236\3766\372$I\017\363\316\366\033KD\252\036xU\201\031\004\233\277\002\0312\220\0249c~\332i\240\217P\336\204\301\233\004\347{l\314\272\2647\n\351\013tw\210J\2659\254\244f\344Xwf}j\271\bL\263\007\017\355\216\244\033r\277U\032\t\027"
+	.ascii	"\345\307#\026\004S\200\331,\263\201G7\307\271\004\033G\026\315"
+	.ascii	"\231\007\345\230Mpb\3238\361R\217`\215\004\344n\260\302\005\243"
+	.ascii	"g\203\257X\346\004\202\276\212\217\n"
+	.text
+	.section	.gnu.lto_blackboxWriteMainStateArrayUsingAveragePredictor.146.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`;\003]\027"
+	.string	"\026m\231I\300VQ:dc\312\231\306,\355\300J7\f(u`\374\005\243Sc\203<\3531\206\375\0053\322\030\260\303\370\343\022\325\217`\026\321g,\300\377[\310\177\f\363\265 \332\003FQ{\033fD\266\356WC\215\020\262\211\334)\005\202"
+	.string	"z"
+	.string	"\210"
+	.string	"\265V\003\247f\020\236\236d\343Z,\bO\375i\337\305_\300\376\343!\357Tsn3\034\265V\004\206\tO\013\274\345;\365\016\340;5\314>\222\222\325X\002\037\241\r2\232\324ZUK\302`Y\226\345=\334\355M\330\251\267\023\346\303\270w\263\335\230\321b\247\036(\363`\302D\223y1ED\273\353>uh8\323K\001\342{\335\351\255\006dF\003\361\t*\250\265z\316h\037\356\357\2661\330\226\261\227\025\273\233Y\332\270\330\\\036\3731%\212\210\274;\366\313\201\356\324q\177"
+	.ascii	"o\332\345?\177\313s7\352\323,\237>\201\323+\337\264\351\323*"
+	.ascii	"\237.\201\323\244o:\345\323#p:\374\246A:\375\321i\272\323\336"
+	.ascii	"N\2577=w\372\003JE=\264\217`R\253\207\362I\rBw'\016\364\347\354"
+	.ascii	"\313\360\203L\002\322\320a\307\347\207\203\3601|\235I\247\266"
+	.ascii	"s\036z\375P\317\241\211O\017\242+~\343*\233\332)D\266(\355hU"
+	.ascii	"\326\203B\332H[\232@\3626e\351\222pG\373\017\331\264\302\036"
+	.ascii	"\337\365\235\206{\035\021.\273\013\216\310\025\337\316uYO\322"
+	.ascii	"6\357\036\037\335oO\252\300\231\245QK\367A\227\021RC\262\033"
+	.ascii	"\264CF\333\343\370.\307\274\207>\001Ex\354\020\334\206\320\356"
+	.ascii	"\225\204(\302b\327\262s\247\221\rQnfy\34052\204\265\326\030\177"
+	.ascii	"\306iP\360{NmA\234\237\211\337\351\367IB\fq\022\243\370Z\265"
+	.ascii	" \260F\233Q\353\257\232\013\342\212f\030\305\227\253\325\240"
+	.ascii	"\306\301\213\345\212\020\341\3018\316\240\274\202\301 \322PX"
+	.ascii	"\315T\240Q\325\264f,\250V\243K\005C\300\242\rkT\275DqT\221p\365"
+	.ascii	"\273\003\343\3470DG\220\233\305\241\313\343\221\210}\331%2\r"
+	.ascii	"\034\265:\001\026\265\377\311\371\310\231E\367j\255\325[\036"
+	.ascii	"\324\276\354u\227\271\325\200\2206\323dY\233%a~\346\0029\033"
+	.ascii	"sjO\313\262\027\"Q\254\354\211f\345kZ\224\220ZI\0069 \200\002"
+	.ascii	"\231B\242\007\340\353\305\002\377\356@\353@\345[\253\247\221"
+	.ascii	"B\032\034c\357\037\311\006\326eD\371>Z$5\3575\224\035\315A2\263"
+	.ascii	"\331\020k\274\251\315\347'F[\267\367d.l\375\261\r=Z\254\260\245"
+	.ascii	"\372\005\353\213\202\357\244\350\366\030\331\315\360\325.\374"
+	.ascii	"\310\336?vL\351e\367R\351]\304\304\357\201\032\356\222\310\204"
+	.ascii	"\375\220j\224\306\365u\0311_\007\246\274\367\022Y\344\205\305"
+	.ascii	"6\0360\021\323\325\237"
+	.text
+	.section	.gnu.lto_writeInterframe.147.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`<\025\355Y"
+	.ascii	"j\224l O0\316RI\007\305\241\364\b8\247\243Q\377?\241\362\b\326"
+	.ascii	"\327\312\362\221\367<\335\232L\320\364\266\002{(\212(Fc\r\nb"
+	.ascii	"\277:\036\357\234TE\030\006\016\241\006\302\300I5k=\212\302\312"
+	.ascii	"c\200\211\r\035\"\221\355\254\266\332Zk\233H\231d\347\001\325"
+	.ascii	"\001\372\001\225\227\250\310\233\241\362\016U^\241\312\033D\344"
+	.ascii	"\005\252\274?C^\237!o\317\220\227g\310{\254\274;'\257\361\344"
+	.ascii	"-2/\361\344\035\236\274\365\344=\231\267O^f\336\037\203\037p"
+	.ascii	"\206l0v\246_\232\016)\244\223\352\325:\021\276\367\353\375w\277"
+	.ascii	"\333\237\345\217\373\273\234\270{>\f\322\246\344\235\331\343"
+	.ascii	"\0253y\313\302\314\256\n\336\036\357`\230\242vU$\323\267\202"
+	.ascii	"\03221I\201+\204\031#\245\016\t\235\036\230\337\251a~p\024.\267"
+	.ascii	"{\334\n\376e{\f\017\t\263\2044M\217\025\354\036_\2177\341p\347"
+	.ascii	"r/{\354\262%\225\024r\203m\315\332\002\327\362-\350\343\266\200"
+	.ascii	"\322\275\364c\177l\201\202i\372v\243\370\272o\305\267\237\200"
+	.ascii	">\313\005E8S\300\004\323TLF\361\225S\246}\t\307\202\336m\355"
+	.ascii	"\236\022I/\244\205)_\004\3234uz]\022\305W\246\023\r_\317\017"
+	.ascii	"\r_\321\335\300\243\257\024\211\202\315\205\345\026\030\3224"
+	.ascii	"\215j\264\356\3769\317\263\270\375\363\355;<\321'"
+	.string	"!\035\031\025\021e\030\022\n\002\372\361Q\352\3419\356\030\213\304\245a=\233\321=Q\252\303\031^\322\357\313\030\362IV\216d\245\215\217\252\334\250\212\b\\\004\345D\337\023\203\362\20438\371\220\223&,\304\344AL\324\030\350\004*\301\307\344\237#\3679r%\2767\355\211\245]\341\036#\3471\362\001\037\233@ r\366\235\223\351\354d\362\362\246(bfl<y\372\330\314\276'Vv\236(\223\353\373\231%\027\211R!\020!;\361]d_:\201\366\304J8Kp\330X\222\207;#\024y\355\340\3479BP\205\027|\306\276N\242!P\300\216c^\334\307\373\b\2630p~_\306\212\234\211Ri\232.\203\215\021\371j\370.O\355\356\216\335\241e\307{\321\017\216\311\030%3\311lermz?\360\2064*h\033\025=\257\236\366\031\262\201O\006Y\305+\034\326\323:\370\324\30641\324=\244\241&\310"
+	.ascii	",\323\373j\344n`\250\037\233\247\377\345p5\210\376l\024pD\262"
+	.ascii	"l\344.\177y\325\361t\265\003+\302]Y`\273\0060\022\2016\\t\307"
+	.ascii	"\326\301\227f\006\254\310\021\357\364n\002\n0\031{\247\241\226"
+	.ascii	"\204\305\036\266\261\225\342(\231\204\022\024\373q\324>\347t"
+	.ascii	"b\340Wb\237M\232\272\332\334\303&\326Q\256%\271p\3718\206g\327"
+	.ascii	">\302SFI\312\241\340\354\217I\023\007N\367\305\250-"
+	.string	"p78\212i\232\252\330\267\t\322@\321\311\326\360\225\333\205\232\033\233\255b\340\373d\314\264\b\361\322}\355\206\273\016\344\340\203m\b\2776z^\215\204:\340\226\213\26448Z\253LN\333\323\375\266^\374\245i\272b\217\346}U{'\257ku\305\007\273\032\2762\320\304$sR\230X\352\272\270p\367-\311\335\354c+\243\333^\262+d\251\374\362Jv!O\336\247'/\312u\362\006\271\336w\253\362f\235\274X'\257\017\036'/\004;\256\254\252N\336\034\217\373\342x\227/\003\337\373\336\260AU\203\306\335\276Sw\373\316\270\336W\306\357\276R\314\033\203\207\027\006\017\357\213#\257\213#o\213#/\213#/\001\314\273\202y\007\250\274**o\212\"/\212\312{\242\310+@\3455\261\303[\242\362FU^\022F^\250\312\373d\344u\252\274#*\257\210\312\033\242\362\006PyA\024y?T^\017E^"
+	.string	"*o\207\312\333d\344e\252\274\034\214\274\033*\257\206\312\273d\344U\252\274IF^\244\312{Ty\215\212\274E\0014n\364\003/\327\307\206\344\247\2337\372\252\205\224<\221\243d\006\360\002Q\265\003\321\036:\200>\252C\243\255\372\214\243d~h\020n(\332\363\260\240F\304\374}\350\347\245\251\003\240=\004\362\025\024\355[\316\330\nj\344\305\037"
+	.ascii	"}\276S\0251c3\3702\271\276*>J\275\244\251,\303\344\251\352=\217"
+	.ascii	"3z\352)\225$\305\247}1=\035zNs\350\016\235d\247\\{\372\214\256"
+	.ascii	"\352\323N\311d\352\246>\tL\375\02664\207#,e\203\032\236n\356"
+	.ascii	"\007%\013y;O\347\211c\001\212\321\3513:\f%a\337\320\376\n\027"
+	.ascii	"\301%/\351\307\205,\311\205G\rOg\234\245Nj\r\215\024G\251\227"
+	.ascii	"\372ktJ\375<57\244N\352\272%\tCA\225 \365\220\210Y\337\240\333"
+	.ascii	"\2112\271\277\235n2\331\203\364\275\234\3114`C2\245\0171\314"
+	.ascii	"\321A\232\344\350\2239\313a\021db!\353\342\302&\332v/\177\032"
+	.ascii	"`\241\261\233K$C\334\352\006\\r\272\214\016\223q\246i\232\026"
+	.ascii	"e\364V\377(ibF\311L\366\341\320'?\214\007\346\306\250\211\372"
+	.ascii	"\250\207x\312\265\2426j\242h\007\223\266\004m\242\245\250\017"
+	.ascii	"F\255.C\023\365\227\204t\030\004\024-J\215\223\240M@d\350\237"
+	.ascii	"yu3\313k\353\021\210\335\334/\365\222%\222\251\\\335\200\354"
+	.ascii	"t\251\016\223\352\273\301\275\313\344\372N\030vS\252\271\372"
+	.ascii	"G\t\2239\256G<$\324A=\324_\243\\K2\321'\307K3\362\271?\241>\236"
+	.ascii	"\032\027!\237\241O`,*\002\233\245H\013\352\3171\263\033\254\353"
+	.ascii	"Z4kbl'\216!\004\375\201\006LNx\303\007\350\305s\026\253}4\004"
+	.ascii	"\375%Y\262\b{\200c\357d\321\021P6>\030\3126|\365\321 \324\310"
+	.ascii	"\262\032\253\337O\317\352\233\271\223\007yI\2778:?\r\324_\263"
+	.ascii	"$\004\222\352\237\016\024\\\353\307\025\020 \023L\375heU\035"
+	.ascii	"\300\223U\245\325\343\352\201\241\326\217\t\260\246\036\350q"
+	.ascii	"\305\203\252G\325\017,\036Z\022`\t\255\025\t\n\260tD`U\325CG"
+	.ascii	"\324\017\036U>\242\254\200dE\221\340\260X\022\\\001\211\322\302"
+	.ascii	"\302\002\022u|\353z/Y*9H\006\005\273:\271\027\234i\nB\214g\371"
+	.ascii	"\005\263p\r\016\267\223\355\3055\310\025\003W\035\256:\303W\013"
+	.ascii	"\316\356`\200\023\243\033\331)\214^&\254\023\243\257\224Rf\370"
+	.ascii	"\242a4R\035e\024\027\375\242[\264\213F\262S\326\235E\267\350"
+	.ascii	"\2435J&\234\357\335\220\200f\321W\336%Y\016\232,\246i\327\301"
+	.ascii	"\226\343\360\013\\\205\273(\022M&\207\004\264\021\237\225B%\t"
+	.ascii	"\311~\343\346\211\005\331\254\030\3236@\363\232\255\24245\275"
+	.ascii	"\005\314\r\003r\232\001\372Q\316\304\f\326u%\251H\321'ZE?\005"
+	.ascii	"\345\032\212N\321\207\242}.\r\r\272\344\202\242?'@\237\3403\314"
+	.ascii	"\207\242\251\370\342=t\031U\005\350\2239\0133\210\324\315\025"
+	.ascii	"\002x\n\311[\366\345L\364ja*\321&\232\341\320p!l\301\273h\030"
+	.ascii	"\252\001\037\254D\037/\356\215\336\240`\262\221G\214v\027\357"
+	.ascii	"\022\330\246g\324\315U\236y\252\024\363\325\007S\244\202'\356"
+	.ascii	"\215\330\240\340W#\233\320\254\215\021Q\301`97\304\243\367\024"
+	.ascii	"\242j\033^}^*<\331\247[\301P/\201\216\241\034\034ib\033\275\241"
+	.ascii	"\203\300\fQnH\364SG5\322\026\252\346\001\325$\372_\240\372c\234"
+	.ascii	"\372\311\003\356\202*\251sj\023cwK\230X\206\272\271\2236%p9"
+	.string	"\027\264\243\367\004\252\321T]{\234v\365\353\204F\300\021\321!zD\037\245P\243wh\241\023\321\237K\343V\306Y\320'u!j\236\231\234\266\240\037\032\275g\317T\327@^\001B\366\303"
+	.string	"us\215f>WM\244,\023\250\344\364\033\035v\276\037MY\206\320\307\252\367T\232\352\201\257\250a@\005\021S\206f$(H\222$\315\001\241\005\204\030\307\2403\036\021"
+	.ascii	"%c\220!\032\225\222J\2269\2201&\260\024\350\363\023Hn\343\322"
+	.ascii	"-\315\204\221\343{\305\252%\255\351>0\030%\327T`2\225GO\232\202"
+	.ascii	"\t\023\332\371\234wS(\021\242\211J\245\224\224\235\242\240\342"
+	.ascii	"\035$\020\366t-@\345t\200\202\231\352/\233Y\315\026\346\f\311"
+	.ascii	"e\331\224\n\260it\fG\243BD\202_\200\311R$\232\260\037D\033\217"
+	.ascii	"P\016\364\264i\021\377\025\276e\331U4\205\317@2\273W\272\236"
+	.ascii	"\235aX4vp\266=\224\226n\002%\t\257\204\201\017\013\317\300\230"
+	.ascii	"M\215\340\340aV\364\354\007\002\200\236\033\255\026\301\226\314"
+	.ascii	"6\210\276c\251\370\177\024_Z\037\017\301\214\237\313\317\220"
+	.ascii	"\213\"\254j\354\025\031\210S\230\264\205\306\236\337\206T7S\221"
+	.ascii	"HA\233\252\0018\030\276\2137\370\\\321cD\023Zj\361\273\320\251"
+	.ascii	"\361\272\231\243\200\362>eY\212\037\036\361\254\232&9']\321h"
+	.ascii	"#\033\337\\\370\013^\366A]3\016\376\016\213\207\277\3348U\324"
+	.ascii	"N\257\rk\027\363 T<w\260b\031\365\205\376\227V \207\206\361u"
+	.ascii	"\037\320c\233\324\273\264\220\356\341a\017\270\343+\036\302h"
+	.ascii	"w\374;\027\332\263VG\364\035\321f\023Q\346\246\nA$\302\021\321"
+	.ascii	"\314\265\013\257\034g\315\251E\376\320\312TI\305\037\2452\005"
+	.ascii	"\377&U\360\373jO`\026}\207\026\004\321\202\267\264 \304\n\311"
+	.ascii	"=p\320\233\2156\322\313\227\344\017\013\024\223o\301\307\350"
+	.ascii	"\035\232"
+	.string	"W+\013\210s\022jV\236\350\346Y\206\362U\225\314\032\372\321\261\261K\025A\325$\211\250\311c\327o\374-y\377\360\236\323\220\354\326;4\223\227\013\212~\255\267\3460\030\262$\200\272y\217\240a\224b\230\\\277\244OR\364R\206W\272p\001\363\006\317\\\034\226\213\251\2474!#a\270jfl9\320ic\004nQ\240\017b\352\324>\3104\032(\352\265)\">OF\266P\343\333\244\260-2}\252\303\256\020Y\377\006\352\030Y\256F\254L\266\004\221\262\261J\241C\371\360\217e\204 B\212\230\371b\240\331\345\233#I\323\362\341\225\\\276\203\220\315\"\337\332D\2641cmb\027D\210\270\325\326\203\3424\306\rfqe\355d\007\335\247`\2367\033\237\315\350A)\245\3322\274\b\314\344\364)i\240\242\214\332\273\020\312|*\341\341X\352\357\200\214\303]i\013\334C\023e/N\"\370\260!\335\373\200"
+	.ascii	"\020\037\225\331\346U\036\307C\220F07\315\306\311g\234\205\331"
+	.ascii	"\214\b\213*\276\326\210\\&J\"\341\237X`i\353\250\n\320{\001\265"
+	.ascii	"1\207\323&\215\3313\301\252\206h\363\0330\230p\215X4Ym<2\203"
+	.ascii	"\221\206\347vf\267\305d\3336&\235\016\217\345\227\034b{\346\266"
+	.ascii	"\025\312\266F\220\310\241G<\203dBP$u\370\302\222\236d\363\254"
+	.ascii	"mx\002O/\203\376\003"
+	.text
+	.section	.gnu.lto_writeSlowFrame.148.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`\375\001\375\017"
+	.string	"6\335fF\340\262(\035V\262}o\036\343\\\b2\326*\225\346\245\270\005#\260\236\033\322\032\300p"
+	.string	"rz\001RR\327s\373\302\317)O-\327\357kJA ,\315\363\350g\206\330\\\200%.\311:P\nJ>\331[\312\224\002N"
+	.string	"K"
+	.string	"W"
+	.string	"\021\207\213\177\277\375\277<\342\2778\214\325\277\027\2701h\023\253\3315Q\362h\021\367\350\331\tl\217"
+	.string	".`{\364\312\346)0bY'6_LN\317\356v\312\342\253\347\312\377\353!\257\305z\202\"\354\256\323k\235\270\365\266\027\330>\261S&,\246\274\367\350\233\266\307\353\201\235\024\037L\326\314\245s\334\262\315\366\220\312{f@C1\023\241,\033\306J]a\037\356\356Zgl\230\016\3054\007\323\240\230\336`:j\032fZ5\235\231\376"
+	.ascii	"\222!$Z\307\251\355\226\250\021\331Y!\335~,\\\246\203S\225\213"
+	.ascii	"\347\006d\262)H7\331\205\353\270\334\330|\276\250\266\033\374"
+	.ascii	"\225B\342cw\037\374\307\013\0025\3521\334F\r\250*\327\217\033"
+	.ascii	"MU5\211)bg8\r\r\261\324\327\270v|\002\344\325\036\221\024\270"
+	.ascii	"\364\234\r\334\356:\360e|\306\212O\363\350\251\222K\313\b\304"
+	.ascii	"f\222HuRa!\215ZT:\016+#SGB\245:Q\002\237:\224P\335\207\323\t"
+	.ascii	"\325\215\300\366pu\206\243\351\314`4\204_\340\256\n\b\377~ 1"
+	.ascii	"\262\346\222\373<\336#\305\247\261\004\024\024\031\027\255G\210"
+	.ascii	"\201<\354\257\t\bZx6\205\n8\263\220\356\310GN\003* \300\002\221"
+	.ascii	"\231\\\007 \325\233CG\030\270Gr?\362\274\202\232f\274\035(b\365"
+	.ascii	"\"\r\376[\240:\005&\262\022f\002\236\224d\334.Y\312\021\260\347"
+	.ascii	"\204\277\2441E8\314\270\272a\272\336\317\001\013\244\254\335"
+	.ascii	"\233\260\230\006\253\320\256G\032!a\243`H\022o4\2469\275\313"
+	.ascii	"0\266@g^\264\213\f"
+	.text
+	.section	.gnu.lto_loadSlowState.149.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`H\001=\r"
+	.string	"&\331XC\020\221\232\016\223?\242\004p\204\\\240\016Tx\276\023\033jQG\210FW\354\345\036\003\314\302\031Uh\t\177{\306\210\323\372\f>\fi\366\306 \005"
+	.string	"\004\264\201\0057f\201R@\214\247\200\020\331[\312\224\002D"
+	.string	"@"
+	.string	"H"
+	.string	"~\212\253\300\316\245|\263+\222\221\261\333!0gzt\367\020\351q\372"
+	.string	"\351\321\230}\203\300\206\315\024\234\260\261\342\262cw)%q\354\211\371_q"
+	.string	"Z({~0\330]\247\026\372p\353m\033\260\235\300>\215\333;\353\302\201\022\273\240k\217\376G/\202\3738\200"
+	.string	"\345gwY\352\b\373pw\327*\262cz:\367K0\035a\032fZ5\235\231\376F\300\327!t\216f\327\303W\263\243\bc\002\304\366\323\001\252\266\204\303HU\325\227\225\036\233\264)t\362Z\252\306x9F*\232\371jW\177A2\355\356\002\337\3055\022@fK\321f\\\336\202\304\337\\\342I\217\364x\235\020\242\006\005\313\244~\313u\342oY\203\345-g\221\301\017(\226\311\007\272\342h\260D<U\307D\204\252P\3229\241\252\353Cq\n\330\2620rQ\030,\353\242@\272=\\\025y\362x\214@\252\342\250v\203\303\300\027\007Qa\214G\003\325~\360\030(:C\233\tI\033B\204\274\006Uqx:\002\033"
+	.string	"`\251'\023Z\373\002\303\005\013P\004\300"
+	.ascii	"\203@\210Ze\006\242\302\265E\370\260\204\342\370\032\205b\205"
+	.ascii	"\200\270A\005l\325\360[\215\307U|\226\336\2100V=\030p\t\241Y"
+	.ascii	"M\001wy\321N2"
+	.text
+	.section	.gnu.lto_writeSlowFrameIfNeeded.150.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`\342\002%\025"
+	.string	"\206e\205I\300\020)\035\330i\3438[\270\325\005\244\031\337\3710\006\313\234%\3500\327\272\f\267A\001\bu\367~$\030\337\032\265\315;\367_q\313~\373\033;\214\202\2420\377\306\327$\256"
+	.string	"\354\263\305>u\017\3624\324\b!\204\310\235Rq"
+	.string	"i"
+	.string	"o"
+	.string	"\341m\030\377\307\253\363h eok\304\235\")\236\310C\217\220\017\275\200\001\214i\007bJ(\020\037\r3DR\273=\226\2068\355*r\024CP'\315\037I \330\216\224p\271\362*\234\2230lpBH\330\350\346(\206\350\334\350\036\312\370b&\310\221\353p\365\310\335@\220\335\375\317'M\3166\347H\262\273\236\270\334\315\315q\3339\266\037\3303*'bSU\037:\021\006\277\307,-\363\270\207~\213\370\360\332A\203\211\367\341GW\233Sv\257\234\272\263\017\256\202\260?\300i\325y\367\250\323\252\323S\247/"
+	.string	"\301\013\333\322\220\317\006m\352m\315\324\215\375\205H#\036\364\363>\355\333\007\362}^\371&\336\203y\320\313Wf\237\213\362\311q\332\265i\320{\001\361!\371\001\342\003_\341\342\367(\340\331]\n\342C\225\216;FJ4\036\036\352\316\"W\225\t\315\270M\033\0160\311\273\205x\241'!\265\\\3638\325\307xJ\372\311h)t\037\214\304\371N>\361\300\216y\240\243\200\221\2735\243\037\275\370=\017}\002\203\211\017m\024\225y\234_\364T\342w\323r\356n\251\272\323\222\251IH\3516mx\352u\324\247\230\001\262\005\257YkV\342\022K)qy\255"
+	.ascii	"x\315`\262\b\025RZb\026XVv\215d\210\231\240\270Z)&\254\025XK"
+	.ascii	"\205\345\222\261\260F\0228v\341%c\315b1\031k\325\333\223?M48"
+	.ascii	"\336\305?\224\306\366\207\376\367T\343WS\033\250\"0m\t\023\240"
+	.ascii	"~\266\336nI\352\3164qT\035\007\021%\324\222\216\342\013\270\253"
+	.ascii	"\343\340A\277\223oNY\245,N`\006xvk\0362T\004? \240\002\031A["
+	.ascii	"\007\240\365>\003\316\260e\030\330\223\354\246\265\"7\342\366"
+	.ascii	"q\024\202\344\242X\2156\270\276%V\016\317\026\263i\r\\\002\200"
+	.ascii	"&\244\3056\224f`M\013\307ytc(\b\243\241m\334\273\034\210\257"
+	.ascii	"\312\305K]\020\013\205&Y\"\231\303@\305\311\333\242\016\336Z"
+	.ascii	"\003qM)\3552x\370\370x\356\341\016\024\304i\300\202\021\2676"
+	.ascii	"0e\372c\0057\337\227\032\007z\031\354\030\017\244^\313-\0305"
+	.ascii	"\037\303\0167\362\336\326v="
+	.text
+	.section	.gnu.lto_blackboxValidateConfig.151.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`t"
+	.string	"\205\t"
+	.string	"\246P@; \345*\035\340\034k<\206\037\274\023\2413\232M=\025\206\361\031j\355\223t\302\030p\177\335\306\216\004\255\377\203k\311\270\013!"
+	.string	"i\022\t\306\230\020"
+	.string	"\t\030\300y#\266\275\345N)."
+	.string	"-"
+	.string	"0"
+	.string	"?=*<\371O\271\300\352\343x\034\370X\327H`\023\271u>UT"
+	.string	"\201ay\276\024\204\001\r\273k\270\372>ny\333\016\266\027l\353\002(\270\263g)\250/\373q\325e\037\372\322sr\373\336\262\333\365\330\005\330\232|)\261\375\216O6\3563\330\032\240\304:Xr\273;u$\270\034\rt\251\261\205\250\276\364\007\233k\001MF\005u\266K\227]pvU\f\276\312c\030>\311\2455L\360\253K\337\264\271\274n\264b"
+	.string	"\304\002\026}2\274P\204\b$\021\232\024\020\240\211)\"\225\346\007\301^\305\003iZx\036ivf\250\307U\027gFVCi*\352k\264\241\215\022`\273\273r\223V\021"
+	.ascii	"`\2517\023\032\200\002cx\r\343w\004\321X\t\313@\270I\310\002"
+	.ascii	"\305\343\357\007\001]\303\355C\360\227q\305\245\213\331N\274"
+	.ascii	"0\241"
+	.text
+	.section	.gnu.lto_blackboxStart.153.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`\245\001\r\020"
+	.string	"\266\033gG\340\222*\035\224P\300+G\311\375A\036n\246(}j\033\267:\005:8\366\205KSIu_R\303;\375x\273o\023\360\2320\226\314,\300Q\321\2341\306\030\2541X\034f]\374\224c\f\276^\335\032\331{\357\224\002T"
+	.string	"M"
+	.string	"V"
+	.string	"\256\034\025\332mw\277Y\342\245w\272J\247,\371\246w<.\357D^h3\033.D\227W\n\022#\002\347\211\034(\002\0315\225\277.WD\225\244\037\261\345\223\022\300!\221\303\023StA\210\031-\001D\224\224\035\320\356Z\256D\017\267\347\266C\333\f\354\347\004\2479V\r\034\354$G;\206\222\263e\237\356\214\261\251t\235\322\377d"
+	.string	"\301\262\"\036\206\217]\226\361\307\326j\f\023\266\357\307.C9\215?\254\361\206b\177\305a)\247\261\310\013M\305\356z\257v\212\355\275J\317%\333f@\265\246\006\001:L2GEc]uC\367)\232\341"
+	.string	" \355\t$\363\257\013\260\351\361\241\206\232&:[\243\256\305(\201\314\356\326\034\005\313v\333!ox\340\300\314\331\232?\320\325Y`v#%s\276\314%\247\205\236\335\224\003\177v\026\027\374\231W\233\234\310\257N\272\327:/\013\006C4\204\242\021\030\242 \372*\220\204J>\220d\362\205\2008\264 \201\364a\bC\322\347\305N\007\235&\2523@\332\020\"\310\257\374\327A\250iz\016f\254\351f\313#\235o\363\233\021\177\306!\020L1\272X'9\276\260yd\266\303\216X\005\257\207\375\301x\002\027) `\2021d\351\001`\352\311\003\3020\\ag\004\372\2617\251\255Tr \004-/}3\303\355\360\304F\231\001\032@Tnc\364\027\330\231\251i%\201M\222w\b6\274X\314\353*\310R\361q\031\221\342\275 \334D\214\026\332!\n\221\323G\036$\372qoP~\334<\234\207"
+	.ascii	"\321\275\370\326@\001"
+	.text
+	.section	.gnu.lto_blackboxFinish.154.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`d\001\315\r"
+	.string	"\246\230XC"
+	.string	"\2216\035\257\317\242C&\005F\315\310\343A\372y9\223\304L\271\227G\301\352\376/Y\"\275an\227\375f\0244\312\313t\327I\214\255\\\332\211 \030\252\n1d\326\365@"
+	.string	"%\357\211\026\2777\331;\245A"
+	.string	"F"
+	.string	"F"
+	.string	"\326\251\215b[\247\267\374\261\353C\017\033"
+	.ascii	"t\231\320\022\263\273\327\354\360\317\3514\345\307?xM\347m\247"
+	.ascii	"\233O\225w\3413\304Q\233O\374Py\022\246\314`\273k\331y\026n\352"
+	.ascii	"\266\021\330&`\037F\037\0038\271\303~x\021\232\277b\223\023\371"
+	.ascii	"\356\324?\241N?\017\324\031\242\221\nH\216v\030\222\223\203\375"
+	.ascii	"9\216#\016\317\r\266\224~\306\244FJ\005\3571Z\354\246\2149\266"
+	.ascii	"D]\200\260}\177t\022\312Y\\ \003L'=(\221\357|\3221nn>\212\033"
+	.ascii	"\333\244\216\177\342\367b\332g\341\312\251.\3265*\305U|\205+"
+	.ascii	"\007FES\265\334\304O\270\276\322\020a\270v\215:\225\335~\234"
+	.ascii	"\204\355\352\261\273]\304M\031/,!V\303\006\356\200D\310D\026"
+	.ascii	"tB\030\210\\\rFBH\256\216\247\344\002\021\340\314A\002\317\005"
+	.ascii	"!\313<\227\025\202>-\370S\270a\243\004\232!\277\304\215M\273"
+	.ascii	"\273\024\200\264\025\214\314\021?x\003\243R\314\213\024?qe\252"
+	.ascii	"\244OB}|F9$ `\202Qf\221\007`\324\023\n\005O\304\333\006`\230"
+	.ascii	"\260Py]\345\355v-\232\n\357\356\241\313\333\275\314/\336#\244"
+	.ascii	"z\370v\005ve4r\032xx\005\2661\326:\264\024\224\365\205\205\002"
+	.ascii	">;\024\333-\362v\357h\272`;[\306\371\3523\353\262G\006"
+	.text
+	.section	.gnu.lto_startInTestMode.156.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`f\0015\017"
+	.string	"\366\034hF\360\260(\035z\263\311\367c\177\353\363\342!ol\372<\306\375ycYF9A/\370\bIJ\335,\254\355\223\t\376-Q\254\343\236\223o\374\006g\210|H\275-\266^\260\324\336\262\024!MV\231\211\336\233\310\235RW"
+	.string	"N"
+	.string	"S"
+	.string	"6\036\302,\210\254\205\205fgw9\rq\324\247\3244\242\374"
+	.ascii	"\340\367\271u\270\324\f\260\344\030\341\001\262\264\004;_\315"
+	.ascii	"\007\\\211\232\266\340\025\203\303C\226\366!\003\004\316\007"
+	.ascii	"\\E\375\200+\032\202\335}\354\321\005T\305\330\021\332]\307\026"
+	.ascii	"\270\341\356\270\355\021\333\020"
+	.string	"\354\213\b/\231\207T\354\261CUT\230}mw\327\372b\177\346\3364Zc\364\001\240\234p\271\200\247\321b\327\325\203cmd\r\211\317\334>\n?\274\3542\250\317\250\b\330\031{\020G\246!g7dpi\320v\351\360\037\363r;\201y\371\217Qv\255M\037\276@\016\317\007\033\226~\206\301r\225\320\024f\275i\252z\263\032\253\310s\026\246mw\325\300W\361\025\235\037s\351\013\247\323\274TEy\321\334\220\211\273\373\251\302\2342\257\243\331\315*\362\330O\361Y\212\037c\f'\361\255K\377D\037\273\002P\007&&^'\241\344\024!\204\304\301\203\220\222'\252p\0021\t\224\241\033\215\220D\026F\034\211\210\310\304\221\274\023\007:\340\256\244\344q&]\347q\2370u}q(\245\2529 \332\023D\361-?\366\220J\277\273\220i\371\244\312\334T~:&f7\036\361/\315\357\375b\332\024D\342\003\032"
+	.ascii	"5\263\007K=\231\001\353\034\242\365\022\336\3666C[ \212\304\n"
+	.ascii	"A\210xP8\016\267\317om\033\"{$\310\231`\343,L\b\3432[\027\366"
+	.ascii	"\262\312\362\322\004p\367\252\020\272%\214\013*\374v\2252"
+	.text
+	.section	.gnu.lto_stopInTestMode.157.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`P"
+	.string	"\305\b"
+	.string	"\026\020<70\221\322\0010t\254eKbY\255y\024=u=\231\311\235mp\255\254)\020\272\366\353\267s\2544\303\224\371\353/\005\r\275\240\030\363x\030\f\016:\346\t\331R\246\024+"
+	.string	"+"
+	.string	","
+	.string	"I\362\317\272@\027K\177\001\036\327w"
+	.string	"c\241\031\210\250G\220*\351\316zn\304S&@\302\356:\273\330qk\267\255`\033\301\366+\177\273\273V\225\375\364\265\f\227\024G<L\315nj&\333\027\355eb\373\034\223l\231\273V[\320\002\321P\261\331]\250#'\375i\252\245\257b\260\025\365h\273~RbP\031\263\337:\312\310'1\206(\337]\363E\333\265\253\306\031YH\353\303\2243\333UJ\025\261\003\006u.\270\217\003\310\363\360\201\021\r\036\b\b\nM\300\216\2019\t\206\020\244\340\270\020\344\270\366oU\345\205\226\223\033\230IOoK\273\302\"\3379\016"
+	.ascii	"`\2517\023\032\373bd\r,\206e\201j\037\244\212\210+f\bp.\243\274"
+	.ascii	"\f!.]\314vh`\n\n"
+	.text
+	.section	.gnu.lto_inMotorTestMode.158.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`\313\003\255\033"
+	.string	"\226\363\264J\260\226Q:40\177J\004\343\2757\021f\r;\352n \222Z+c\326!s\334\021\225\241\274'\301\234}\374\357\227\362\3251\277\032\231\376vX\233Q\236\303\013\2767d\300\365\003\247\247\rw\031\231,\212\376O\310\336[\356$\003\242"
+	.string	"\224"
+	.string	"\242"
+	.string	"\227&a)\0212\335{!\220\257\261\337\330W\372\032\373z\241.\266+/\221M\302z\"D\360\312:\344++X\020\304\272\227KD6\303\246\037\221\313\275\245\254o0yZ\236\307\251;\354\345\"G[iO\035?\270;\254\302\023\026.\302\255\032.f\374u\336\214\273\240\024\035\321\330\217\"\031\223\244c\213\")\207RdDw\264d9\362\315\321G\214\333\221\347"
+	.ascii	"R\226\247)S\301\030\2570N_A\030o\231\240\020\215\335{O\374\034"
+	.ascii	"\n\366\346\034y\356\275<\201A\027g\2303\263\0253w`n\026\001O"
+	.ascii	"F\335J\254\263\357\236\247*B\263\013\277f\354\376f\231q$\346"
+	.ascii	"\201\357\023\377\025QWE[YB\275c.{\263\225\230\277\243\305\327"
+	.ascii	"\203\333\006s\016\016O\276\251\241\341\3113<Y\206'\307\\X\236"
+	.ascii	"a\207:\277\354d\227\235L\362dK'\327:\231\322\311\315\223\037"
+	.ascii	"\340DMN[\246\370\270\025\255{\211\212^\356\223Z\305\343\302\277"
+	.ascii	"\374\241\336\2232\007\361\207w:\221aB\376\024t(\025\277\300\373"
+	.ascii	"\313e(\225uo\031\201|\0050\337\364 A/\331\212^\251C\343\221\315"
+	.ascii	"\351\236\252\b\016\353!\266\262"
+	.string	"\260\376\216\323{\357\035\023\034\3269\235\204U\364!\301\264\355\231\346\371{Q\273\333\366\177Iz\263\310\264k\337\227\365j\332#\361\367\2057\213 \236\204\251\310{\357\016\277\352H0d\320\240\301\276v\3078i\321@\032V\361f\261;\252\305\326\021\333J<2\361Q\232.\020u\265\243k\372\325C\\7\334\bMg\251\310\2518t\360\340\301\276\322t\n\244+tv\"4\031\225{\205\030\360\247>\244\306\327\361\312\037l\225o\263\2575\235\002)\n\220&\336,\016`\n>?\263\333\r\347`\366c\263\261\335\247\226\233\231\260\345h\r\200p9\034\205\332\217\205\\\211YmBn\026\200i:'p=!h3\021=\262\037\333\354&\243\001\225\220\351\030`\334\210\032\220,\207\303\001\311`%\357m\203O<\315\353\246\331%\32311\315<\274\356\301\\M\366M\377\307\304\277\372\222\033_\007\243x\360\300\276\272\232"
+	.ascii	"\016#\336,\362\200\311\034A\302<\220l\233('Y[Y/\001\223\331\302"
+	.ascii	"\205y\240\fO\257w.:\3024\316\245\216\323\275\323\312A\266\022"
+	.ascii	"\317\245!\225\037\225\235i\237a\223\037U\275\324a:E\2501 d\220"
+	.ascii	"S\306 eD\2021\031\232\270\030p\002\241A2\017\020Xw\033\rclA\341"
+	.ascii	"K\340Qmp\210\302I(\233\300\246\251\307R\\\222\305\021u\r\t\302"
+	.ascii	"\2736.\261c}%J\313\352\b5\025D\250L\2017ISZ\271\204y\201\231"
+	.ascii	"\277`\020x\320\205zl\350b\215\334!a\322X2P\017\210x\3623\031"
+	.ascii	"\253v\262E\354\001c/\016r<\313o\005Q\314\314\205T@\302\003\001"
+	.ascii	"\250\2301\344\271\031\325\b\354\351\027\2147\323d\310\343\333"
+	.ascii	"\r\360\201\373\364\303\263\037\257\331\314S\003"
+	.text
+	.section	.gnu.lto_writeGPSHomeFrame.159.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`7\001\265\013"
+	.string	"\206SIA \253j8\377\353\203\224O\032Q\345\322\3107\305\273\336\323\350g&\240f}\210#\3363\336EM\326vN\331\3033\355\266\277\334\347\274\020\200\020\251\003\260\311x\310\240|#'eVu\333[\312\224\0024"
+	.string	"2"
+	.string	"8"
+	.string	"\273%c\206\255q\263\026\333\357\234\262%@\214lh\001\243\201$faw=Uy\352\231\362\377\362\007\221\025>\0352v\327)\262Ln\275\355\t\333\035\373\r\002Ge\316]90\0063U\216\336\322\262\233\226\261AB\362\242)0\214\265\225\206\366+LM\261\277\255\272\354\247\267\247\365\351|\372\335\306A\004\326'T\b\027\004^\340\013\211D\231s\372@\244\240\312q\200L\365(\255"
+	.string	"\027\262\363\030,\225\023;\351\362j\217H\022+\r+\016"
+	.string	"\324\354.\206\037\363W\311g9\347\023*/\236s\376<\037 h\364}6@\036\207\306\207\344}\246\223\347\341\030\354\b\231<\017\0204y\335k\277\255\272\254\331\320\252\251T\304\233\322\026(H\200`\023\3402S="
+	.ascii	"F\254\370s\003\245\r\204\335\r\" \260\002\031*\365 \325\033\021"
+	.ascii	"\372\273\030F\002s\3674\030\207\230p@\001\224qlL\021\254<\202"
+	.ascii	"/\374-\204\266\347\215%\037\330d\366\334\301\274\211\217\264"
+	.ascii	"\356e\216\341\333\221z\220\360cA\207\204\2021\023\265~\320\357"
+	.ascii	"C\200\323-\332\365\004"
+	.text
+	.section	.gnu.lto_writeGPSFrame.160.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`@\005\345\033"
+	.string	"\206\360\252G\240\232M:e;\342\006T\r\331\375d) 2\366e\265\316\353\321?N\tW%\315\351\270\260\336N\333\330\300\017\313\271:\253\341\t\243`\200\263\321Y\020r\001\306\326z\254n\204\363~dT3\350\321\244\355\275\245\224)\213"
+	.string	"\207"
+	.string	"\233"
+	.ascii	"\237\223/%\277%\237\233\277\002hg\262|+\244Rk\324\360M\375\232"
+	.ascii	"[T_$\233\004\305b\375\300\217k\266\363G\361\317v\356\354\377"
+	.ascii	"\362\277G\326j\334+\025\227\325\212#K\253V\254\332\217\304\235"
+	.ascii	"C\033Dw\312\375\241;?\376e\204VT'\004\300\032PJ\330\324Zm\275"
+	.ascii	"c\307\225\315\343w\201+\353\371\234V\312\330\226\005\300\240"
+	.ascii	"\254\331\361=\311\240( \275\005.\273\360\361\230c\016j\255\347"
+	.ascii	"\236/\306~\356\377\b\377\031\374sHm\300\264\3728Z\324\013\\\226"
+	.ascii	"\212\n\243\005\r\2270O\334\346C\265.\001J\324E\275PR<\036\376"
+	.ascii	"\273d\231\340\276S\367\300\304\333\333\371e\242;\211z\223,gY"
+	.ascii	"\201\335\260\222\332\361\3608|&{.\3727\345x{'\020V\344\353\251"
+	.ascii	"\235~,\036\267\216\177e\355\034\277\344\027I>\321^\355\nQ>\020"
+	.ascii	"\345\377L\276"
+	.string	"\217\344\367\304\370<\222O\213\361w$_'\306\317\241\374\031\345\343P\276\214\362E\312\217Q>\225\034b\377#\221\261H\254i\213]\273\201\315\202\324 \370\261j\261\214F\024\360\350Z\257\321j\004>x@w\306\272\001\230\255\035\204\275\202d\024|\204\265\222T\024\334Y\205\366\332\370u\t\203x\312\236]\203\n\333IX.\245(+e\302)T\340\355U\240;e/\215_W\225\f\342\356\037C\206!n\241\356^',\202\3604\254\026.\301\367I\212\r\342\324\t\272\223{\225\200\271\332\361\260\266NN\210\265\326\005\337&\233\305\341;\265\363K\267\033\335\271Ma\374\246\b\267v<\\\036\001#.\340\232\230,\220\b\201\323\351J\334t~;2\221\353\360\341\266\004\242\203-\004\323R\223\355\246\033a;\n\360\234\b\234\316F\"\227\323\331fX\273\225\265s\\\034\316\370\3325\357@5~\341\242\307-\030\212Y"
+	.string	"\t\177\232\237\220"
+	.string	"\350`\336h\204\026\344\035\031\b\\\221\f\f\223\214\302~z\207\374\272\370\354\3307J\264\240\233\366\352\235\021*\261\361\311\322\303\323==VM\032\036!m\247i>\326\314H%\202\355`\251\322\311i\235\037Kf\244\0320&I\200\230\234\336\033?/\341\f\247e=\013~\361\2023\n\331.\\\266\310\274\252\256\2148h\250QH\006\221R6#IAQA\322\001\260\002\021!\263\016\021@\251QL\231\032\331\2305`\217\206\024\277\354\255h\2121N/\277\212\222\230 \375nH\340`\243\221V\243i8\320A\t\036):]]\362\272\315n\317\314\315>\276(\\J#\371 "
+	.ascii	"\362d\336\233_\314\034^\317\304\242\352\326\343\256D\307fP\324"
+	.ascii	"\375\235X*;@\353\302\260\007\363G\217\251z\303F\007@r\277\315"
+	.ascii	"\007\356\311\3630G@V\303\357\025\264\263e\254aZ\002\267\004\352"
+	.ascii	"CP\3576qC\210Gf\266\225\3147\300\b\025\341.\270\340U\3262\026"
+	.ascii	"\fo\232ttP\361;4=\257\231)G\267\272\2333\311\252\246\032\266"
+	.ascii	"~\335\236x\351\027;\315%?\245\311j"
+	.text
+	.section	.gnu.lto_loadMainState.161.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`\242\n\2352"
+	.ascii	"\332W0\023@P\350M\007,\004\351\3568>D&Xe0\265c\314\305\236\027"
+	.ascii	"\263t\027\202\021\330<\356\352\0258\251\257\021\262g\275\233"
+	.ascii	"\226\276\3078\205\277\224\b<\213\303\273=\3143B\215D\310\336"
+	.ascii	"[\312\224R\n\036\001\f\001*\001h\272\315t+\273\311\364\311\334"
+	.ascii	"l\336\024\341\"\245\261\353\031\013`\356\252t\031\3563\3543\303"
+	.ascii	"q\034\201\321C\"\355k;L\277\261OL\217Q\233L\r\246unm#\035\030"
+	.ascii	";v\353\252\314\240L\273\351T\332\350\025m\355\035\220\336\020"
+	.ascii	"\355\326u\275\352\313\021\322\276\314\334\316\334]\332\213\332"
+	.ascii	"_n0o]\327\340\334\254\253R\001c\245}\013\364\323\331\327v\323"
+	.ascii	"\331We.\004e\266\222m\201\2313|s\264\256k\326;aNS_j\255=\371"
+	.ascii	"\333*\233\355U;\311\327\343\245\350\357\274J\366]\345~k\333V"
+	.ascii	"\004D4\222u\222E\315~L\351\271\263#\226\353\316.\256\331\264"
+	.ascii	"\001+gE\334g\240\t\232\221\356\261i\373\246\350\266\206f\244"
+	.ascii	"yjpCO\321\tM\320\322\032m\034i\375\263I\177\256\024\351\2713"
+	.ascii	"$\226\201\032\334\237Nc\346g"
+	.string	"\317mH\337tH+Y\246\271\263$V\313\213\3062\267nA\372\373L_6f\223h\f\322\216NX\327\225\235hDk^j\346\376\300\314%\230yv\001\036\032\320\375\323O\037\020wQ\322\316\205h\271\177\253'\217\210\377\206sT\264\214\363\277\323\205\200\216I\264\035\023}\247\232\210\250\337\3372u\344\341\320t\270M*\247\347\234`\024)\274\211)\316\276\375p\216\212\222\337\310;;7\317U\317\254\242\343x\245\353\272:\340\206\243n\371\002\"\243\3248\373\3168\026Z\036\301\341\315\004\035WC\002\335\272\256\\\334n\372\r\013\356(}\031\254\2057\261/w\213\263\357\201\037;\022Z\306\341\360&\263\222\314\277\215\271\271\220wv\374L\230!l-\320je\263U\177\351\256j2\315\007zM3U\253i\236j4\315Rm\2469\nu\036\300s\206\272\316\002x\316\300\353\374\304svB\235\233\254s\200\324\031"
+	.ascii	"\352\314\204:/Yg%\324\371w\235\223Pg\337u\356\241\316\274\323"
+	.ascii	"9\265\316\350u>\255\363\275\316\326:\377uv\353\334\021\234\250"
+	.ascii	"\36406\263\315\272\376hBZ\367\3348*\275\246[MwkB\366\224=\031"
+	.ascii	"\357\333\030\255\203.\370\257\373]\365\224\363\350\251t\352\027"
+	.ascii	"4b\37235I@\210\377P\221X<DD\030\334\207\232,z\017\025\t\021U"
+	.ascii	"M\355\354\313\364\r\327\027\313\261\211\376\356\326\177\235\322"
+	.ascii	"UK}\221\343\234R\256\006\367\007yJ\375\326/\2615\345,\375\016"
+	.ascii	"#>T\221(\375\222\0067\3632\317\241\036\227\250llg_\245\3574\314"
+	.ascii	"\245\226\373m\334J\317\204\321:\017\341\277\316\257:\352\213"
+	.ascii	"\n:\352\373\313\230\272\034~\327rl\202\224\366\333\242\036\302"
+	.ascii	"/\2611\233:\222\224y\223\177N\246&\253\220m\276&\375\357\255"
+	.ascii	"\237H][N\232i\"\001\335\243\206\244>\201\242J\221r\366M\372v"
+	.ascii	"sl\344[\252I\004T\332\221\352\245\367\276\267\314a$F]\017\220"
+	.ascii	"n\275\310\004V\242V\244^Q\263\250Z\274\211\252\226\263o\357\373"
+	.ascii	"\316\221Q2\216\367\207\324d\225\312\245\355T/\351\363\336\022"
+	.ascii	"\032F*\340\3503S\250p61\375\0029\236\214\020\267\261\272\320"
+	.ascii	"\203N4@\326\265\240\f\033:t8\373\242\337I\216\213\226']`=\026"
+	.ascii	"\366\025\f\312\250\2604\026&C\254BPlL\354E/F\327\327\013\260"
+	.ascii	"\021ca_\301\240\f\257\037{a\321\020[\321\302K\205\213\025Ya`"
+	.ascii	"*^dy\005cda\021`1\030_\301\25411\261`\226O\271\3663a\336\332"
+	.ascii	"r\017\216/\343\001\357\246&\251\350\204x\274\212:L\231P|J\024"
+	.ascii	"\227\242\016\365\b\345\344\316\276\267\357\200\357#H9\3138(>"
+	.ascii	"\376D\310\004\2627q'B&w\024\026\372\021\002\002t\366\205\372"
+	.ascii	"\031\3108\3134\001\201\234I"
+	.string	"\027\360\027\t\005\371Z\227+\361%BBBC\302C\302Cg_\001\337i\3105\313/\300D\236\004\370\364\300\013\316,l$\\z\023\237\336.\327\334\234\236Y\370\310\215\b\231\3005DD\023\310\3242o\242\223\023\235\265c\322\2671\257\256\247\365_\307\273j*\253\247\272c\327u]}T\257\365Mo;\3644}\232\232$`\346D\324a\200oz\213\307\202\013\001\342AT\036E\325\207\217\263o\200o6}\261 \313\274\0319f\306\036\200\267\372fr9\263jT\201x\023\001|\277u\223\\\200\315\250A8\005\031tf\002\021\2210\n\222\244\320\001\340\002\021\251\3426\021\260,\355 \222\021\221\024\024$\251\323\001\241\323)(J\222\356n;A\346\213\263^\377\246$\306^5u\343\2635\340\266\366\302h\261\304\213\\1Gq\243\r\210\336(\2228N\004>\tPO^\005n\206 ;\013\256i\350\244y"
+	.string	"*\241CT\274v\244z\034\262-\331\230fd\361/\016\253\347\363\253\224\034H\351q\020\364;\342\327s\t'\377\026\371\302\371$$De=L\003c1B\212\357\312F\032\270\005G\242F\f\230:\024v\007\221\310\0211\265\233\245ie\322\024\024\207\300EVL\372\211q\320'c\247\214\300\335\236\362\336J\363\364\256\307c1\241\370\335<Z\004~\035\226h\305\310`\235M\t\311\005\037\334\371,\013\330\330V\203\353\205\307XD{j\300\214F/\253\320mE\363\fbb\320\373\267#\220\247S\007\225\247l\301k\342b\225\250\302\351\315\220v\207\272\275\363\021\300\007V\266\210|\205"
+	.ascii	"\345\275e\207a\256ph\223+\214ZmgC&\275(f\033~\325\365\373\372"
+	.ascii	"\205\003\002vUNM\347\211_xr\3367\330\355\002\340 \363\367\027"
+	.ascii	"JC\033A\231\364\204dZ\034@8\236\252\3167\333\310\r\322q\2176"
+	.ascii	";\026R\b\341\353^\024\026\276\332<\016\364Hh\3603\341\334h{\304"
+	.ascii	"C\nZ\007\006^\265\311\310T"
+	.text
+	.section	.gnu.lto_sendFieldDefinition.162.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`\323\0205U"
+	.string	"\312\221@ N0\222\322\031\016\273&\301\034\356p\240"
+	.string	"\255H\362ID\364\2463 \233tn\3275EJi\216M\342\215\\\233\215\201\261G\376\037\353\372\253\276q\023\377]}\tA\bB\203i\202w\327\026*\212\260\006\020G\231\232\325Q\0306\332dK\231d\364\001\271\001\364\001B\376\206X\311"
+	.ascii	"\361\232\\\314\237\303\237\345\337\362!\037\357\357\362\340\356"
+	.ascii	"\307\210\3511d\032\221[\363\204\367\262\317\333a\016[D\300\\"
+	.ascii	"\021~9\230\335\341r\335\313\006\347\260\264Y\302\255\353:\344"
+	.ascii	"\332\035\036\330\273?\366Z~w.\177\356\260\013\007\306Uo\375\331"
+	.ascii	"\223;5l\250\340\2418\216\311\255f;SL\330\203\213\003e\213\327"
+	.ascii	"\224X\220\005\356\326\300\320\314\342\205\256hr\353Y\020\210"
+	.ascii	"\0209\270\247\003\367hvY\036\004x\245\203\025~\234\312\353~\274"
+	.ascii	"\312>Wg]\325\366\272\204\007\036\321\003\245Rv\315\216\365f3"
+	.ascii	"\334\241aS\001\312\273\227\373\r?>\267k\212\214\353\030\235\013"
+	.ascii	"[\326U.\3052 w\241\364@\341\201Rg\337\213\346\303\211\260\275"
+	.ascii	"\256K,[\326uM\261Q\302\003W\b\360c\325\" `?\250\270\343KN\211"
+	.ascii	"\263\256rR\315d\217X\375\222R\022\222\210#\243\"\242!\241 \240"
+	.ascii	"\037\037c\261\207\3103\334\321\021\006S \332\254\356\301\276"
+	.ascii	"\024\234\332Y{\246\375\240v\026\345J\316'9\343\030\te\001$\216"
+	.ascii	"\221\353)\235(\217\234$\017wS\302\261\210\353)mx\036\341\243"
+	.ascii	"%gPn\024\234*z;\221\236\362\355n\312&<\364\344\005\026\nr\341"
+	.ascii	"@\250\023\233\2737\327S\266\241BB^ "
+	.string	"\273\233\262\005\376A_\304=i^O\311\206\366\\\335\027\237\346\215\3155.\2169\223\236\362\r=\366\240P=\310P\344z\312%\nD\304\256\207?\323\230\310P\316c\344C\246\235\340\224\332\331\n\327\321S\026!\302\302\207Ey\020mh\226\344\024]R\222\326\327c\206D\217yd\222\317;\223\2332\n\003Q\247e\230!\327S\032A\205v`A\r\020F\207\274{\314\304\320\343\272\256\177\236\313\314\306\230\203S\353\272.\223\231\235}\217\337\345\250\335\177\267\007-\251\260\251\232\237\310e\260\205\035\024\223\364\033\301i\357\252qj\024>Y\260/\004\222\261\006\363\340>\314\020\256\353\030\001\3734WC\205*P#=Y\215\364\300\264\007\230\263S\263\214\303\323\331ksK\233\271\0014\332]t:\3308\337\226p\017\355\347\035\r\323\254\353s\206\361_\020\231\032\022`3w'\315K\243G\221\016]Isrz\024i"
+	.string	"]\026\365\356\035t|\273\f\234\207}\016\3556\36027\204\326\326uu\261\303\365\034\330\267\035\270U9\370d9\322\003\273#h\326\2759\303\320f&\321\235!\241/B:\243;\254.\r\035\2321\226\263\334S2:Fs\2130#\244\016\371\206\3217\223\364\013\343\277}\321\007\364\373\317\003\345\254\301\241;C\245\0061\376\333\225\023\343f\356\376\200d\026\263m%\273D^+\"/\006D\336\013t4o\216w\371\342X\336\252W\371\033h^\033\315[\243yi\034\356W\3409|\251\356\374g<\313w\352W~\031\267\373c|\313\027\306\347\376\027\227\362\037\320\274-\226\227\305\305|W\034\357\033"
+	.ascii	"\221W\005\221W\212\310\033\325\274)\232\027\312\310\373\324\274"
+	.ascii	"N\315\013@\363\242h\336\023>\274&\210\274M\315[\"\210\227D\017"
+	.ascii	"\357\b\"/\323\362\036\233w\251y\225\214\274I@\274H@\274GE^\243"
+	.ascii	"\036\336\"\"/\321\017\357\220\017\257\020\2207\250\310\013T\344"
+	.ascii	"\375)\362\3724\257\261y\213\315\333\323\274\304\036^\036\"\357"
+	.ascii	"\320\310\273\323\274:D^a\2217\330\303\2336/\220\310\2136o\363"
+	.ascii	"\3602\017\357w8u\021+#\345.M\237\221[\003;X\tr\301P\337g\272"
+	.ascii	"\253\242\240\252\300'[\266\302\344\313\352\221\340%\tP3\227K"
+	.ascii	"\370Q\355\330\0174\335\274\241-!Y\321J\275\264Tj\0355-H\226q"
+	.ascii	"hM\"N\320\374\274\275)\366{\244KdoY\214:zE\227\375\360\244\276"
+	.ascii	"\332\212\244f+L\234\220\031k0\037\244\326\001\274\004\351Q#\365"
+	.ascii	"\215\372\250\333M\221Q\377\004\225\b\243\271XVa\004/\352\n\034"
+	.ascii	"\244\007\026\365kh\366\360\366#i:\0341\362\331\211\372jt|\214"
+	.ascii	"\302\020\242\376\230\243m\232f\372\234P\2428m(n\245V\3756dM\222"
+	.ascii	" \312\240\301\240/h\253~\022\215\225l\266uDMKK\017\304\240M4"
+	.ascii	"\321r\364\005\375\244\337PC=G\037\314\237T\030#v\206\312\020"
+	.ascii	"B=\324\315&\350P\223\b\333\204\372eE\200ZF\007u\320\314T\373"
+	.ascii	"4P\033\271A\272\2111\036\230 Gz\336A*\243{\016\013\034:\276\237"
+	.ascii	"~\3218\372> g\200\321>\375\323Hf\220nN\355S\003\257)\206\356"
+	.ascii	"L\235_\227I3W\205\230\002\212\224 <\315\\\336\241\321%\256\320"
+	.ascii	"\260\324\251\321-\272,]&\3432UKe\201\205\364@\035M/O\332\030"
+	.ascii	";\b'\031\t\365b\033\273\347\360\030\213qX\261#h>\373\234=\275"
+	.ascii	"\237\303\353\311\200\260\321\304\356\351#a\370\234\373\365\330"
+	.ascii	"\267\255\312T\231\260\312$=\220\330KM\264'\346\351\026\3750\027"
+	.ascii	"BmA\270\256\310\223\251.\b\221\337;\2416Qc\340\223\331\350#\262"
+	.ascii	"\301\320\241\002M\203wft\215\376{iW\246\323\337J\207\315K\350"
+	.ascii	"\306\214\261\034\036\207\363\206\247\373L\023/\214\377\332\004"
+	.ascii	"1\354\037aX\224,\343\234i\034Z\n\302f>\350\256\210\232`3U\031"
+	.ascii	"\322\235\356\242C\323\304:N\3247>\331N\037\251Z\247\203L\"k\206"
+	.ascii	"\337\n\213\325\324k\001V\023\005\3005\300\253\351x\325t<.P\314"
+	.ascii	"\342\302\341\225\365\005\302\016\036\037Y__Z]\020d!\300\205\303"
+	.ascii	"\253\313\212\307\2251\203,\254\356\312\302\262\312\3421\3042"
+	.ascii	"faiu}U\031\251\212;_>:\340\242\332\241\201\345\203\353*\313K"
+	.ascii	"\310\313\007\227\326\227\226\017\255\f\262\022\300\322 K+\003"
+	.ascii	"\243\325\227\006YX=]V<\250\262\266\254\272h\020\367*\352\003"
+	.ascii	"\256\035=\256\2544\330!\345C\313jK\352\252\313K*ji\2716\310\352"
+	.ascii	"\222\372\342\342\352\222\032\312\205\275\225lR\213RUW-\353\352"
+	.ascii	"\202\314\344\317\273N\033\027\264:-@.\341,X\364N\205\265\330"
+	.ascii	"\tK\315T\321U\215>\223O\302\344\251\350\t\330\264(5\023\007\006"
+	.ascii	"\363\345J\266,O\332H\365sKh\255\313\277\225F\265T\267\233\273"
+	.ascii	"-\341\226\250\306\301\206\245\317\351\202wn\205\215\206\024v"
+	.ascii	"\352{\244P\235\242\217\\Z\201\352\020\330\354\372\320\330\220"
+	.ascii	"I&5s\237\232\345\320\361A\375\251[\\\341\262\366\261\031k\260"
+	.ascii	"\003q\230\342\207\324\314=\034\027(I-GN\r\3542`\027\241\260\004"
+	.ascii	",\2102|c,\007iH\334\023\021\315\334\006\332\251\371\005\2720"
+	.ascii	"c,\207\312>\211\366\246\334\030\332\223\342\324D|\316\037]\327"
+	.ascii	"u=\002`n\2371n\270\001C\016E\003\320Es\330\271\317\030\034w\003"
+	.ascii	"\006\034\n\2519,{\2157\305\2068F'\240\2140\247\304\b\177B\344"
+	.ascii	"\375L\364\211f,3\260\0235\211\324\332\252`\\\203*v \324\236\211"
+	.ascii	"\226j\342\025\377\376\376\376\276\2252uS_1\327\276 \227bEO\\"
+	.ascii	"\242\257\003\313\240\0021\261\226\024\"\037g\217@"
+	.ascii	"\032lIt\211\0362\323\340l\225\273\246\032\242f\252W\313R\022"
+	.ascii	"}7\022\270\211ZF\2427h\372\3659\013\340\021BT\263\252\266\021"
+	.ascii	"}\030\232s\206\330\345\271\031bbk2uPM\013\017\3138\247\220\232"
+	.ascii	".\361\240\371&N\2330\376{\235\220\201I\250\221(\305\224R\n\221"
+	.ascii	"\214\210$I\222\346A\005\304(&)4\017\021@\265SN\315HL\205\306"
+	.ascii	"\213\236$01\f\021\34286qd\223\347\243OA\020\250<\207\2643\225"
+	.ascii	"V\272\233\007\236\007\217\302'L\357\354RZ\375\177\344T\355}\323"
+	.ascii	"c\030\236\177,G\340\244\251:\205\005\206\031\334\274\223\226"
+	.ascii	"\321\270\230\244\226Qr\366w& \243\250\334\312%\252Q\321-9b\311"
+	.ascii	"\003?I\2148]\362C\374\345B\241\227w\341\235s1\033\317\304\361"
+	.ascii	"\365&\242&3\t\b\230{\361FMh\256\f\177+U4\001\234\374\236\235"
+	.ascii	"\020\026\365\227\313\001K\317=X\n\343.0\302Y\352\260\266\351"
+	.ascii	"p\301\240\004[ &\341\306Ur~\rq\257\341\222\314\362\243\206e\233"
+	.ascii	"Q\250\210pIH\373\232x\232\205\227X\007\007|\265\353\326\372\031"
+	.ascii	"L{\204e\036\302S\367t^\306\236\033\303\363\2665\345\336\307\241"
+	.ascii	"\306u\006K\340\301\304\313=\021\221\244\3123Yk\302\374K\345\376"
+	.ascii	"\002\272:\025\312-\360"
+	.string	"\002v\276\003\250\214g\373~Z\243_\016#\310\375$\033\240?NFN!\313W|c\027\232\262\200u\312\303\371|`x\330n\231v\0025\375\017R\0250\177 \345\320\0040\277Y\003\277\237E\201\230\317`\367\363\013\264\034@\260emLc\276#\007Pt`\335\361v\246v\320\273\237\025\334;!\323\354fW\3151l\332\271\353\005\353n\3465\263\350\220\367\\?\350\313\301\313O\214\362p\306\222\230\313\371\007\240N.\005A\373\023\242_\301\251\334\027<S3\225@\262\322EUq)8*O\257\331<D\300\323\020\221\f\003^\006\354\240\250J\371\211O\002\262wU\243\372|A\007\372\033\n\031\332\373\356\223\236\021J\204\313v~D\006R\004\267`\377\003]\252\031h\223\207^\272\223\370\377\373R\243-\013H\300\n\177\240X\302k\234\351\273\366+\306\\\237\232:&\005\005\311c\004R\021\341n\234\247\207\036"
+	.string	"\0229a\\\r\247\312\252\3021\r\200\"iH\035\013II\036}\033zI"
+	.ascii	"'\314\220\323\305Eb\201Q\027\266=\240\201G&\023\361\321\250:"
+	.ascii	"\333\013\244\270\204\233\264op&\240B7g\266.\325?\257\017\204"
+	.ascii	"\274\003\261|<\311\365\346h^4\304\354\333\305?\254:\006\360z"
+	.ascii	"\212H~;A\025]\370\226\025]E\217\002D\373\354\370\271\371\312"
+	.ascii	"\020\206\002\207\260\257\004\224\357y;\0165"
+	.text
+	.section	.gnu.lto_blackboxWriteSysinfo.163.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`T]\365\030\001Z\324EgQ\020 fi\215\001\303\252\270\236}f`u\366\220\231\365E\265\002\031\237\026\307\206\261\303\001\213\367+\221kFy\367Wp\273\214\032\b\362{\336"
+	.string	"\314\276\003\236\003c2&\373s\230\032?\356r:\216\031WjF\305\260\030/4&\204\322([J)\005"
+	.ascii	"\006 \006\245\006\256s\337\3558\267\235\353\334c\212\316-\306"
+	.ascii	"u\3560E\347\256s\235\233\256\350\334s\256sWw\234[\316un0E\347"
+	.ascii	"\376\342:\267\227\242s\307\271\316\rWt\3567\327\271\251E\347"
+	.ascii	"vs\235\273K\321\271\271\270\316\275\245\350\334Z\\\347n\033:"
+	.ascii	"7\333\320\271\327\\\347\316\262\343\334j\256s\247\35587\232\353"
+	.ascii	"\334Xv\234\373\314u\356+;\316m\305un\263\035\347.s\235{Ztn2\327"
+	.ascii	"\271\307\212\316-\346:wX\321\271\253\270\316M\245\350\334`\256"
+	.ascii	"sO):\267\324un);\316\375et\356\032\\\347\216\262\343\3344\030"
+	.ascii	"\235\033\212\353\334Ov\234\333\211\321\271\275\\\347\356\332"
+	.ascii	"qn.\243s7q\235{\253\350\334Q\243s3q\235[\253\350\334P\243s/q"
+	.ascii	"\235{\206\035\347Vbt\356$\256sg\35587\022\243s\037q\235\033\253"
+	.ascii	"\350"
+	.string	"\334F\214\316}\345:w\221\242s\0231:\367\020\327\271\205\024\235\333\312\350\334U\256sS\3558\267\fF\347\236r\235;\310\216sK\031\235\033\210\353\334Q;\316\035\203\321\271\177\270\316\355c\307\271{\030\235\033\006\327\271\241\212\316\3754:7\017\327\271w\024\235\373\311un\247\242s\353p\235\273\251\350\334LF\347\316\341:\367R\321\271\235F\347\327un\026\235\231\256\263R\321\031\207\353\374B\321\371\206\321\331\005\327\331F\321\271\206\353L\243\350\274t\235\223\212\316J\243s\005\\g\244\242s\322u>*:\033\271\316EEg\n\030\235'\340:\023\025\235g\270\3162\212\3161\\gd\321y\310\350,\344:\303(:\037]g\t\024\235\203\\\347\b\024\235!`t~\200\353\354\200\242s\003\\g\006\024\235\027\340:\267PtV\200\3219\001\2563\002\212\316,\270\316\007(:\033\300u^\241\350\254\202\321\271"
+	.string	"\2563\001\212\316)\270\316(\024\235\007\340:\277(:\013\300\350|\202\353lB\3219"
+	.string	"\256s\tEg\027\2563"
+	.string	"\212\316$\270\316@;\316-\\g\026E\347\025\256\263\212\242\363\b\256\263\bE\347\020\\g\020\212\316)\\g\024E\347\017\\g\017\212\316\035\270\316\034\024\2357p\235O\024\235M\270\316%\212\316?9\316>\2563\t\035\347\021\256\263\006:\316\031pp\306\300u\276`\307\271\307u\266\240\350\\\201\353LA\321y\002\327\231\247\350,A\216s\004\2563\004E\347\007\\g\007v\234E\270\316\r\270\316\f\3448\207p\235\027\330q\006\341:\177\330q\366\340:w\330q6\272\316\034\212\316;\256\263\216\216\363\206\r\3169\033\234\335\r\316\305\r\316\304\034\347\326u\036\026\235\205Dg\266u\016\016\235\277u\366\241s{\233\217^\331\0303*\226\307\033s\376\b\214\343\254c\271tuX\367X;ssRO\271\3350\321\223B\243\247|"
+	.string	"&{n\234N\247\313}\245\317\230]\266\321S\026\3161\341\223b\203\273\254\315\230]\276\321Sf\325\300Y\257\2508\235N\267Y\346\033\314n\263Af&\267X\223\261;\206#\350\204\002Q\323\274Hh\233\345\246\322U\230\035\206\243\235Og/yQ\325\3208\235c$\232\345\022m\263\034\032\204\260Yo\017\302f\231\203\017\230\3742\240c)\315\t\252\330\223\0257N\347\230\211_\322o\363\033S\331\215\2730\027\336\302Z\270\215\331x\215\263\260\032\2471\032c\3413\276\302V\330\214\313x\312d<\326\202\305\n\025#\210\020\002\b)P|\340A\007\034lp\302D\211\037\037\022#4\310"
+	.string	"\203\013z,\250\200\202\tx$\210"
+	.string	"\202\007\034\020\321"
+	.string	"\003!\026"
+	.ascii	"\361\301C\007#\207\035\235\r9n\221\330\016\205l\360\375\345"
+	.string	"^j~C\261\245\227\205\227\026%\325L\265\203\262\342r\263\272\352b\345\203\013\025\340\226\253\032\325U\013\325\\\033\036\024\025\033[\0335\252\260\2656PT\\Y\356\324\250\256\324\370\240\250|\244\251M\001\242M]\261\340\251M\315\235M\261]\361*\324\024\227\025o\203\232\362aFFM\n\260\354:\205\203\222\232##\003%\305\306csPRa-\244|\260p\243\332\254\270\203\212\272\2528\243\02657\002\237Z\024\233\bPQa!\260\201\212\342\002\241\373\324\242\256R\004\222A\221\0268\367\3013\220\315\203\300\260\016\002\2718\b\274\332 \320\307\211k\332\037\240\211?\266\022M\227\366\027\366\363\347\303\007\316\033\t8\\#\332h\340w%\003\2754\277+\f\370\322\372\256\027\354\245\365\205\365x\234\264>\013\366\322\370*\340\273R\30077\001\033O\r\022\234y\362qE\300'\003\004vi|>\036\300K[\003\350"
+	.string	"\231\347\232\253\b#5m\315\\\003\f\004;\320\341\206\310\003H\230\232\004s\336<\331\365\223\030\244x\2104\013t\b|\246\341\002\021\374\360\001IV\223\366\020\034\201fK\233\026\023\303V\020\304\017\256g?\211!\352\035\330\236t>\214z\317* \207\264\352u\247X}\323\231{V\3316\300\245U\303r\330<\253\\.\365Y\275*\276=\253>\210wi`"
+	.ascii	"\333\256\246\201\271\016\235\372\0043'l\262v!\026P\345\236\332"
+	.ascii	"\202 \311j\322\354V\224\211\026\324\310U\021\"C\204XU\375\360"
+	.ascii	"\321\003\006\250'\217\035\201\200\177q\340\274\361s\263w\325"
+	.ascii	";c\246L\236\225n\256*\007\346\213\227\2706\266\265,jihX\304\302"
+	.ascii	"\252P\001\233\"\355\342j\302D\013j\344\252\b\221!B\254\204DL"
+	.ascii	"I\032I\fUONB\"\246$\305(\035B\"\246$\037\2200q\025 \310!\213"
+	.ascii	"\253?8\342J.\210NTS\020D\230\2543M\326\016\025\305\344>\004r"
+	.ascii	":\235\354\317( \315-4s+\0023[\202y\205\272Ng\264\331\244K\330"
+	.ascii	"\354\003\357\327\274\256!\020\315\303+\241k\327\361M\326\316"
+	.ascii	"5\025F\266fL\231&\177\303<\316\316@\350L\357:\276\237\252\230"
+	.ascii	"\202\322\340\224W\352\244\t\005\212\260Yg\3726k\317R\005\315"
+	.ascii	"U\225*\327\321\301\201/\347\022\245\031\345\307\372\325:y\232"
+	.ascii	"\210w\340\235*\r>i\202\265\025(7\253\004\2354\305Z@\235N'\212"
+	.ascii	"f9\330\025\364j\222\2255\255X\0216+\342\333\212V\230\347Hcd\340"
+	.ascii	"\033h\362F\255\360\262\350\273\344\307ZC\247\371\006\276\325"
+	.ascii	"<\003\357\324'\300\300n\264(]\035\207\020\320\346\231\nk\023"
+	.ascii	"\255ur\257\031\336\251\037\253'i\200s[;\231\275\311\351\314Q"
+	.ascii	"\001ss\255\331\346\375\f\361\t\300j\372%\3568\335h\321j\335\316"
+	.ascii	"\002G\214P\201\370\005\266\004\211\f\001\341\347\247\363\301"
+	.ascii	"\352\215\252\240z\227\374@\375\351\341?t\t\006\001\022\224jR"
+	.ascii	"\341\232^\274\b\233\365 \205I\033iX\233\r\035\276\247\301\030"
+	.ascii	"\336(\nk\320G\023L\263\332:\371\222\361;\274\2575\351\202P8\202"
+	.ascii	"<\202\317f\2301\315\273;a\263\306o\2626\241\006&|~akr\234\307"
+	.ascii	"s\370\236\006\237\336(\025\3207A\035\327\235\347\360\276\226"
+	.ascii	"\20237\363\232f\274\237;\337dm4K\253b\371\241a\372%\356\300f"
+	.string	"\252\260\377\336y<\373S\025\223\007\362\013\357\276o8\317}\326\334k\246\361~\366\337\363\350\370%n\277o8\201}~O\344\373\356\373[\323\364k\276\357\263\256\240\354m\353\252\n\232f W\347{\372p\336\250\212.\3437\307\343\364K\274\341u\276\237"
+	.ascii	"\371\276M\223\217{\213\233}M?o\372\t\233\335\240\327\215\026"
+	.ascii	"\355RW\344_\323\204\343\375\344\023\257\246\371\327\f|\227\274"
+	.ascii	"\237h\336\250\n\350\365\235\372\341\322A\322\252N?4e\232\201"
+	.ascii	"\210ho\346}\372277WT\234\316\034\375\344\317\3732/\223\216\367"
+	.ascii	"\351I\210\367F\333\fz\367\362\200j\235:\254\311\272\003ZT\254"
+	.ascii	"\016\257\031\250u?\347{\372b\336\250\025\326\257\272\267\353"
+	.ascii	"\007\n\345y\252\366\310\001\363\303\265\2532$~\361{\372^\336"
+	.ascii	"\250\246\223j\235\372\b\334;\325nP\252\326\251\247\250oW\013"
+	.ascii	"k;uy\255\206\264NIA\247\325/i)\362f\t\373\331l\361\211U\277\366"
+	.ascii	"l\257\221`o\361{\344\315\022f\t\233%\376\207\274\016\323\215"
+	.ascii	"\026\005\023\376xO_\355]\322fZ\255S\f\2647\272\302\332\244u\202"
+	.ascii	"\201A\263=\375\263\267\353\007\352t:\365\363u\322:\261\200A\263"
+	.ascii	"\314/\2247\212\367\223Y\300r\372%\356\271\356\250\224\272%\377"
+	.ascii	"cbV\306\276\222/\3437\343\253\317]U\2261~\2628\265*\374a|\365"
+	.ascii	"\261\253J\233\302\017\026\207\366\305/\205\257>tUXh\340\217\022"
+	.ascii	"w\346\204\377\t_}\346\252\256p\361w\305Y\211\362o\361\325\247"
+	.ascii	"Ze\006\345\327\212+S\302?\003_}\344\252\246H\370\263\342\310"
+	.ascii	"\214\360c\361\325\007\256j\214\b\177"
+	.string	"\221\270\026V\374B\370\352\363\306B\006~*\276\372PWH\361\007\341\253\217[\225\212\030\370\243\342F\350\301\357\203\257>mU\"<\371\241\342B\370'\376\035|\365a\003\341\233\370u\360\325g-\305/\361\347@Q\005\310\036\370\301\0178\354q<\360\341\206\335\257\203\036|\354m8\200A\r\373\232\r\240\366\330\321\234x\236a\3273\341\205G\036{\231\022\200d\330\361~\376\306\260\333\371\304\251c\017C\002N\225}n\304\233/\354`4\360\203c\217\313\300\215\033;\025\203\275-\354\\.8\303\306\336\326cF\215=\213\005V,\354h\025T\255\260_\241\340\313\224\275l\20261\3661\236,T\330\253H\200&e\237\022AX\r\354_\020\200Aa\247\341\001)^\354N\034\350j\302\316%\202\213\t{\264\201&K\330\241\fl%aW\022\"z\204\035\311\002L\274\234XW\354F@hy9\261\206\260\023\371"
+	.string	"\255b\267\342+\2116\017S\3542\360\225D[U\007 \354R\306\"^N\254\037\3541\360\225\304Y\034\007\030\330{\354\300\365\360rb9\017\366'_IX\321q'\366'\276\216\370\253\332\300\304\336\224\343\306\235\354K\356\236\227\023\353\217\033\260x\365rb\275\341\206\023G\354\343v\303\327\021m\252Z6\334|q\3034\334j\370:\202Ox\345\336c\363\274\234Xf\270\317\360u\004\233\252\240\225;\217\257#\366\342\376\216\233\214\317\211\341\036\323U/'\026\035w\035_\333~\245\302f\273\261\234T9/\346\2562\363\225\203-2R\234\316\245\276b&\363\325\237N\247\323\351\324\240\331\366\027\030c2\342\200\314\374~5\230W\332:\235N\024\334^\372\313\013\366Vy\305^1a\263\355?\200\211\236\237\360\207?\274{\002d\022\032\316E\353t6\241\340\246\366["
+	.ascii	"\270\267\232\345\023^p\277\0206+\374\024b\336\254WU\302rx \363"
+	.ascii	"\030S\373\026\2760G\202\334\375p\250`?\376\2250337\nB\366a\224"
+	.ascii	"\225i\3627\334\200\363X3U\310\254\202\001\274\237\3547Z\264H"
+	.ascii	"]\323/q\360[\315\373\335\023`\016\017d\020\376\317\334\002\003"
+	.ascii	"\204\375\f>O\323/1\267Z\267q\033\367\026\263\300l\336\317f\377"
+	.ascii	"\373\t\223;\277\252\034\036\310\376\235\346\375\356\t0\207\007"
+	.ascii	"2\b\357gn\201\001\302~\372\3634\375\022s\253u\026n\343\336b\007"
+	.ascii	"0\233\367\263Ynf\0236\333\337dM\"\307\033\364\252JU\016\017d"
+	.ascii	"\036c\352\240\323\351t\372+a\356\240\323\351t\362'av\235\235"
+	.ascii	"G\216\263\353\310qv&\327\271\377\\\347\206\243\343\334~\256s"
+	.ascii	"\367\35187_\2075\267\232\036k\3564\354\334z9\316}&\307\271\315"
+	.ascii	"\3448w\031\327\271\363\212\316mu\235\033o\307\271\311\0043D\r"
+	.ascii	"\3374\301jP\342&\3117\\\336\265\033\355\311\024\bY\337\323a\233"
+	.ascii	"7\332W\254l\230R\314\251\326I\250\205\344;\213j\230\246\tF\005"
+	.ascii	"\311\336\221\3579-3\335hO\244R`\351\275\321\026f\230VCZ'!\225"
+	.ascii	"\221o\254\"C\353\324\b\231\253o8\353\037\212\"\337\323\241\335"
+	.ascii	"\033e\001\025\363v\375X\205;\210|\02712\244c~a!R\035\362M\315"
+	.ascii	"\273\203\363\201\0200^\336X}\01392|c~\261Y\271U}S\305\370y@\365"
+	.ascii	"=\035ry\243m6\324\362\362\370\261\262dd\370\246\312\032\256\271"
+	.ascii	"\311\2406\365-G\327\327A\220\357\351\020mx\306\276I}\007Q24\373"
+	.ascii	"\"5\005\362\375&\307\307A\324\367t8\366FUX\303\336\251\037+\233"
+	.ascii	"\026\303w\324\222!X]\f\322\037\337n^\326l\340\343{:\374z\243"
+	.ascii	"+\254Q\230Z\314h\353\304R\351\361\355\243\311\360I\023\214L\017"
+	.ascii	"/\030\276\251ZoiN@}O\207\\\303-V\353\371\r\3255\324b~\265\354"
+	.ascii	"\031\346\031\246X\373|\342\022\036\337py]\350L4};}\357\370\236"
+	.ascii	"\016\2254\245Pd\035\351\247\357\035C,#WO\337vZ:\276\235\206D"
+	.ascii	"\206\b\3516\255\203\351\273)\312\260\212\371\345xSC*\246\324"
+	.ascii	"\347d`\276a\212\271\034\221\351\035o(\3259\264t\243uy\251+\261"
+	.ascii	"\364=\035F\275Q\024\326\341\017\326\252\235\337K00\277\272:\344"
+	.ascii	"1\204bJ\333\315:|:\231b\315\006m\333\371]\035>\275\337lkp?/\274"
+	.ascii	"\3227\277\247C\035C"
+	.string	"&\366\007\363\233Cg  \023\307+\305\201\363\246\343\340x\317\222w\343_p\303\374\362=>a_\033\037\303\033\357{k\\x\247\323J\333\342\223\3644\336F\232=\326\251\306\3338c\246L\215\345\323\260\342\221!\262T~\222]\030\341\0301D\204\312w=!]\005\336\253yg\335h]`$\212\376\350\221\276\247\302\252\020\314_\362\221\342\230_}\007\307\224\266\334\2335\371}g\364Gn\314/?\353\302\2246 \227\3563z?\323\242\300\027ia~\271\336\232\260M\310\306\204\245\300\273\236\332\004\336\253yfQF _\306\023\241\235\361\315x\"\263\262\351\214\030/cL,LJ\214\241GRa~9\236P*\004cJ}n\212\024\246\230\313\005\207\276\204\310\214h\020\201\227\300\303\210\002E\357\3700\274\272\270\216A/\201\255(\223+A\020\370\b@K\b\227\314p\005\002I\036\020f\225A\013\317\200w"
+	.ascii	"\222\246\024\n!V\360\256\001\357\200\"\314\257\266\203\022aJ"
+	.ascii	"\033\316:\204\332\200o\273\005<\003\254\230_n\305Z\305\224\366"
+	.ascii	"\037\224\252\333,\340\335J\236\002\276\005\341\024\363\313\361"
+	.ascii	"\204A\230R\237\223rc\212\271\234\002\336\361\204Q\tx\227\003"
+	.ascii	"\353F\353\222\302`\205?\300#\340{*\374\321\224Ja\025\366hJ\375"
+	.ascii	"X\301\260\360\bp\"|2\277\232"
+	.string	"\f\224\007S\332r\326\035oP\026\276\311h\031\340\017"
+	.string	"E\350\304\374\362,V\035Li\007B\233:\216\001\336\263\344\251\360+D\021\346`~\371\336\217p\211)\365;\253\320)\206)\346tP\025\336\367"
+	.string	"\013\360N\247%\345\357\202\027\217\302\023 NS*\305\033.)<\001\234\260}\314\257\276k\303\224\266\034\0375\205\357\273\001<\nP\3305\314/?S\303\2246`\232\356\033\300\373\231"
+	.string	"\376E\024v\217\371\345zW\246\324\355\240\314\004c\365\230UZ\366L\023\rS\314\253\326\206\200\260Y\001\274\353i\205\261yl\031\bpo1\223\214YV&l\366\204\367j^U\224\276\036"
+	.string	"|\to\302\367\224\305kJ\241\200b\271{\243~\254A\262"
+	.string	"\274\t>\254\030\027m\027\206y\326!\352\350\002\360m\347\342K\370a\253.<\013T\216y\346F `\276\270x\317\242E\302\003\200Y76\316\205\263\261:\235M 03\255\260p\3143w"
+	.string	"I\265\216}\243:K\302;\233<.O\322X"
+	.string	"\304\345\215\262\320\302Dc\252\265NA'-\036h\215]\303\321!\246U*Y\324Z|\317u\321U\300\002\355l\311\212g\321\306\232I)\233\256\330\352F\343\252\326Q\240\342{\312\216\261a\301\"#\274\212-,\230\213\006!\246J\303\024\351\b\337pZZ`&\020\341+J0H\b/B\027\366\211\227\023\257\020\276\337f\360\302\003\002\327V\360)\305\203@e\265\266\240KRd\301I\200B\311\033]\301f\375\233\017\036\005\034\213\345\242C"
+	.string	"\251B\215\\}\360-\207E\215\300\003\"B\322t\360\036xa\251\222\3100\325A\221n4\256.u\020p \365FS\260Qo\335\3409"
+	.ascii	"\303\372p\321 \270T\261\256\2508\235M(:\215\031\211\355\301\254"
+	.ascii	"\016\351\226\374\200\242\342t:Ah\226Y(\026"
+	.string	"\006&]\030\346\230;a\263\033|\277\345\t\331\362\300\211\357)\313\343\215\266\031\373\364Z\375X\337\313\304\237\300c\233\330\034,\0233\317\fSOO\330\254\t.\3216?*\007J|OY\347\033m\001\005|#?_\202\271\027\204\343\027|\303L\263\206\311\307'l\366GK\264M\352AD\370\364\275\321\024|M\251\037\353O13\373\202j\202h\202i\230~L8\314?\346\237\260Y\237\007\241\025\026\005\326\200\006O\342{\032\274\276Q\rh=\363v\365\365\235F<\tf`0\317:\342}./\203\327\340ET\227\202d\232Lv\301\273\246\016~j\362\340!l6\203\367@Fs\005\306@7{\b1\370\236R\226\327\344o\230\271\t\025\f\323\354Q\207\3017Y\263D\242g~a>B\\0\367FS@\345\232`~\254\177=\177A\\\320K\023\354G3*J\330l\317\203\320\252\202\352F\343\032R\267"
+	.ascii	"\317S\360\026|O\203oM\251\026\315\251\326\311\327\2705\251~\254"
+	.ascii	"Z'\027S\365K\\\301[0$\270EK\005\337ry\023<\005E\202lk\023|\007"
+	.ascii	"jI\360<\357T#A5\264`Z\363\bg5\225(\0216+\3017Y\243p\025\265\""
+	.ascii	"\r\333\321\f\004\"\202g~\277\202g\257\364\331\254\301+\375Ts"
+	.ascii	"\327\355G\360#P\235\256\230<\320}\215\331\233\017\020|O\203f"
+	.ascii	"o\264\343@\247\357T\353A\337\036x\b^\304\222\240\230\213*\301"
+	.ascii	"\260\246V\353\f\234\204T\322X\036\2211\210\214\034J\032\005\311"
+	.ascii	"\240\001\0039\3442\222F\321\261F\020\262h\210(h\231\234\2214"
+	.ascii	"d\334\341\242\244Pr\231T\"\005\031\331@\n\362\300F6\220\202\206"
+	.ascii	"\220BG7\222\216h\004!\223h\030Y\211\034\"\252\221T\"\005\271"
+	.ascii	"\240,:\022)\221I\035\202\220\313c\r\242\245\3201\b9\2244R\022"
+	.ascii	"\035E\004\211\340\242$R\220\220\322\310F\312c\3202II\024#\350"
+	.ascii	"(\031Tt\024Z@\306\321hCRy\204\241\303H\345\321\306\220\3628#"
+	.ascii	"HH\350\270\301\355\240\303/\314\340\220\224tD\262\221\354\300"
+	.ascii	"1\220\212\210A6\21676\360\320\321\021\306\320\0219D4\242\221"
+	.ascii	"4D\204\264\201\213K\"#\242\242 !\241\243\016\322\306\002\234"
+	.ascii	"$Z\036\225AGI\242\345\321\205c\021R\031\264D&\211\350\300CE\311"
+	.ascii	"\031IH\345\214e\320\215%Q\215\243RF\020\321\362\350\030\002\001"
+	.ascii	"GD\004X\2220D\204d\344#\242\243\214\240!\"$\035F\2421tDd\203"
+	.ascii	"h\003\307\210\221\\\322\020\362\300/\314\b\232!\264L\036\355"
+	.ascii	"\3308\336p\371\205\031A1\220\2126\004)\221\313\"\242\030AFJ\344"
+	.ascii	"r\250\203\214\243\321\020Y\003YD\254q<j\271\204\027+(\223\222"
+	.ascii	"HmR\022iYt\264q\2741\344\022^\2540ChI\204D\344\022^\254PT\224"
+	.ascii	"T\266<\324\343C\344$\344\362\250\024\362\362\210(\211D\201#R"
+	.ascii	"\t#\350\210\264"
+	.string	"\334\341#\322\222\310\312\031K\"\017\021\031\005)g,\333$\222\013H\033\307\033A9\234Dr\001\211\\\036\225AB\312\226g\224@\026\021\305H*\221\202\220\313\243\262(\251\\\036%\205L\b\305\260 )\t)\224T\"\005\r\021!u\b\022:\272\301\001)\231,\"\2622\231t\204day\204T*i\b\351p\f\244ry\204Q\243e\037\032=DF\3128.\213\2225\212\212\220B\313#\214\032\034\226G\0305\\\246\321\363|\302\006ABB\307!\017\365\370\f\365\b9\207]\350q\341\004\313\310\242\243PRPRyC\206\353\302\321(\207\221E\313eR9cyDd\224\303F\311#\344\020\317\n-\017\365\230\030\352\021\256\340\362P\317s\321\261\206\022\271<\"\342y\3412\322\350x\304\263\214qT\272p\031iD\264\\*\217\313$\036\031\311\024<\260\220\221\313\343\020\237(\301A\211\016\204\307%\022"
+	.string	".'\365\360h\220\324\223\001OR\017OR\217\016\037%\211\222\210j \225\035x9C\006QQ\214\243#\262\310E\016'\365<#\221n,y\220\312\243\r#%\221\t:\313\243\0276\222)\030\227G/f\310 \022\300\222\006\322\222\206\n\312\3442i\324\201\205J\270\220\204A\001\241c\021\f\023GDG#\023B\312$\023%$\340$\022Rib\231L*M\270\314\314c9\372\223poyY;k\013v\277\302&\3536\016\265\355\254\355\271_a\353=\0243\267\336\3733q\3135\003}`` \027\005\364\231\217\363Jw\240D8b\272\315|\237\371'\372\275\322\226\350\306\314\277\0302ukjD\272\022P\346{JlCdST\222"
+	.string	",%+b\032\245!{D4JE\214(\0359\"l\266\313H\331\272\223N\021\220\367=%\352\021\315\024\255\254\337yYD+\021\317:e\313\316O\214\005\274\2731\305'2\337xJ\210u8\350\310\330I\2514\003\035\340\356{J\254\022\301\020\373\354\276\357\226\020\343p\364\033\234RW\273\275\331}\331\242\2236\003\031`\314\367\224\350F\344B\034#\346{\214\026\261\315E\313\261)u\365\333\232\0305[t5\254\020F\r\215\270\245\356;L\224x\305E\303YY\251\t\321\212RWS\241Ng\023\020\242Y\335\334\326\034\024\025\350\246o\264\315\210c\304\260\271o:'\304*T\346\346\244^\005\250N\221\222%\367]\205B\214\202\203\006\271&\315@\004"
+	.ascii	"\363=%>!z\021w|\371\006\023\205\330d\353KU\312$\005/\337S\"\023"
+	.ascii	"\""
+	.string	"\264m\023\367\355\345\213\250\204\230EL\242$\005S\252R%NnI3\020\np\337S\342\021\242\221\226\356\355\033N\214HD\bq\210\022Y\231\222\025+oh\266\344\222\f\200Z%\303\026\267o\352\031Q*\212\bD\tMMimM\330l\273\301\371\035y\321\345\307\033e\001%\366\230r\371\356\362Nm#>]\020w\020y(m\351\242D\245\n\233m.p\322+\001l\371\236\022\235\210M-\rZ\276\267\274S\341\210K.\210N-&\310m\275\371\ri\006:\241\355{\332\002\266qZ(\333w\333;\325i\256\255\261\350\364\3327\333\267\323\023&\017\344\316\362\275\366\017\3749\241Q\373\316\362\355\245u\203\243M\333\247\004\246\252DG'l\266\325L`\263\365Ve\002\226\357\264\357i\313\346\215j35\355\024\332wZ\230v\357\212\366\375v\366\215eL{\306\314\331\233-\352T"
+	.string	"\314\276\257|O\333\2747\212\005^\353d\345\373\312]k7\306\312\267[^\331\267\031^\033\006G]\331\t_\266\334\244@\232\201J\350i;\327\312\r\371\310\276\247y\255\22782-[m?\232\201\\\214}O\333\267\326m(F\354{\314L\273E\213\230\333V\033\f"
+	.ascii	"\bc\313\022W\345;LI\257Ek\261Ty\262\305\346\307\243\031\210\004"
+	.ascii	"*W\314\322\300\276\251\354\265dc\r\366\266\305&uj\006\002\232"
+	.ascii	"\362=m\303\336h\212\226\312pL\372=\345\235\252\224\246\225\272"
+	.ascii	"h\277Z)JkX\211O\251O\251O\330lK\303\266\326"
+	.string	"\374\302\230\232\201ZH\371\236\266QZ(C\256\257o)J~\255W\023\f\310W\313U\3037\234\326;\273\321\2368a\021\345{\332n\265L\206X4|GQ\202\323.\251\242\241U\002\345\233\372gd\305\223\357i\233\365FU@\333#J\177J\201\255\323p\312\311\367\223\245\366\252\tv\345\244%\342\365\335\226\367\246\033\355I\021\025]\337\323VH[5t\342\372\356bj\247\232`I\270\244\232|S\373\206\214\260\025\365F\373\312\017\246\216\247\326I\270\027\375\336\342\321\302\300$\372d\362]ec%\202\326\367\264\335\361F;K\353\304\204b\366h\235\204n\320o\255\037-\023\363\313\013\332.-\371\246KC\025\302\f\337\323a\340\337\373\222)\371\016\206\207\250\343\300f\241\210\246f\210!\021\021\021I\222$\255\001s\033 \b\307\2018L\335\325\003\023\300\303IG\224Y<\n\365\240C\nB\244JJ:\031\253"
+	.string	"\334e\256a\263q\321\271\340\254\375)\205n\221\233\314\234\323p\214<\020\207\027\267\037FbImL\217\t\376\225\271\321I\226\271\002\017\205\177\313xH\316\033\313\262\003\nA\377\232\t\017\030i\211)\221@E\227T\")\257\f\250\203Pa"
+	.string	"'FK\217\036A\362\277v\201Qo\374\263@\243\260\357\005Zd\254\213\017\033t\337\216\017\230\235\340\0335^\033^\tz\b+\214]m\265\353),\341B\261<,\035\356\032\2319\221j\242/H\020\232\345\305\212\021\255\002F\217\377\376?\020\301es\357\242t\233&@\260\247\304\242>\027?\300vi\264_d\026\270"
+	.string	"\300t\302\342W\030\373P\341\353\211\303\244i\352\354\227\346\005\261\233d\327\nH\314\213!\177\022\362\317y\266\304<O\004\243\320\302\267\177Xhh\373\230N\377\n\267W"
+	.ascii	"\374\"=\250S\210\335m$\213)*}\351\244\277\357\\\317\246)\212"
+	.ascii	"K\216\022n+\337\234k\335\033\243\370R:\027\\\356zs\237\"*\252"
+	.ascii	"2\037\006\rsY\314\361\312\325Zg\222\225\217G\374\267\316T\267"
+	.ascii	"KN\370\240\022\331M@\244\241\033%\227\333\220=\301$C\223p\223"
+	.ascii	"@\023o?\263\222\016kJ\373\322W\r\272+\225\277m4\315i\301\374"
+	.ascii	"\035\266A\352\302\352W_\223\275+\250\007\372\021\315\257D\275"
+	.ascii	"I\304\227\352\261\013+\232\372\033]\247t\230\262\231\241\272"
+	.ascii	"\263\267\027g\350\364\031yQo\316\017\334H\321<\226B\207\234\n"
+	.ascii	"\323Vcu/P\273\316+\021\332^\340\214*\272\021\344KE\251\274\266"
+	.ascii	"\267\225\323\260\344\0049~\315[\271\312\335\020=u\226\333\032"
+	.ascii	"7f\226\no\243iWS2\352\242\275G\371YM*\323L\257l\223-\363\347"
+	.ascii	"V\b\023\034O\307\225S!\311\255y\362\201e\270\205*:\205\336=\325"
+	.ascii	"\275,W\336\230Y=\203\275\363\313\323\fB\004\025\244086=\222n"
+	.ascii	"\3354JA2\300\231\235\035[s\225\227\251\367\232\353\017\376\\"
+	.ascii	"\2509\r.&\304\200\262(* >\025\315\212B\035\362\343\260\003\275"
+	.ascii	"\324\244"
+	.string	"\311_\r\351Y\1770\222\211oC\001Y\247\272H\3143\272\300K\272\346\220\322]:#\302W\006\330\177\351\330W\222v1\275\373\257\245\336^\215\302\232\024\304 W7=\362\273]\246\345\277A!\265\213\242.\333\232\3319\263]-\001FZK\245nbm\231<\216\332+S\336\367\322\333\365{\233\271\034A\n\262\340\330\363-<\217\373^dT\363\3703\251\001D\321a\313\230\023\343Wk1\372k\305\31545_<\013\310\313\240^2\362\374'\335^\337;\315\314\212\313iQd\373{dk\251\324M\030N\004\277\224sX\310\367.\212\332\244\335d\220\343\365\304\314\031\002\021\020\276\246\001\263N\347@b\270^\002\233\232\005\206L\377Km\253\367y\033\272\340BZ\024E\212\017/\255w\366\232\222\001D\334\345\245x\243\260\r\341'1,\263\324^$\013\0053\346\032d\006\210\311\255&v\302\220\027h\242mO"
+	.string	"(0]~^)E:\215\025\256\362T\253nw$\227>\0064_H\235\2001}\035\316\003\350GM\357\036n\237\377\357?E\271\311\227;\330Ne0r\267\013\212r+w\335\013\033TM\371K\341\235\234\353\254\357H\250\267\356\336\337\300\007BJ\344<<$\364\223s''\356q\025\216\224\257\311\373\232\r\343\216|\265\221\177\322\244\253\021O\035\2346\364H\345\210\017\016\227\024\027\374\214\210{\370\332\020\216\031\037\305\352[W\254\246\306\274\031Eg\017\265\205\200\226ta'\036fW\\}k\305\272p4\\P\3344\212\3055z\325\034\251\370\224f|"
+	.string	"u\331\021pJ\343\244\206\341\317\316\212H\306\035\240\270\034\210#\202+\312\372\372\212<\034^\031Z\210Y~-*\257\0048\264y\266Ys@l\022\332v\360\205\311}{\204'Da\333=7\034\323\021\200Q\202\026.& }g\2533!\263\200\202?\201\016\2325 6\3116\205\004#!\2060M\3554r\215,\246\210\241\360(\301\016&Y\214\037\032\357\310t\005\221,\352GZ\274a\267\331\373\253N\225\204H"
+	.ascii	"\336\212\376L+ye\200f\323\303\224\001e\355\317\"s\206\005\310"
+	.ascii	"\300\007\334Tf\370\240.f\3170iR\201G\251\241\366\316\362O\"\f"
+	.ascii	"i\027\004\375Q\007h,\260\247\215\206>'\334I[\315}Y\215\007K\244"
+	.ascii	"\211\3340\247\025D\351D\234\362\364\223\330\377\241y\254\266"
+	.ascii	"\324\373\374[\322\344\221\337\006\376\0255\235\2573\325B,MW\034"
+	.ascii	"Sh@\007\"\272S3d\3105\027}\257\267\3325\221\263\260\325\t\364"
+	.ascii	"\364\345<\226r+\236\3167\250\023v\n\362\254\337\267\245\222\243"
+	.ascii	"\377y\206{\224\314\357\314\3539\277\n\335;*~P;4y\201\310uB?&"
+	.ascii	"\234\\\177\326\244\373\373[&9\372#}\352\333\224\376{\213\320"
+	.ascii	"\345L\336\347"
+	.string	"\376 \317Pi\311\036e\321w\276\"\2147\002\3070\366\342i\210'l\263R \214\236l\233\353\245\246Z\324\205lfC7\377\272\021\033\265\324*B>\210 \213\262*\334\216\013S\323-\311V\243w\230\300Y\251\004\325\222\235aZy9\020b\311\260\024\254El\312\034n\306\013\213?\241\307\212\351\025\204\007\226v\350\037\361\336+\354\036\222\304\233\377\340\020J\310H\316G\363u\024P>\223"
+	.ascii	"m\016A\337V\222\335\006K&\316BB\256u\212;R#\206]\205/<\\n\025"
+	.ascii	"S%L\371\272v$\324B\300\257\262e&R \350\027CS7\374\r8\274\031"
+	.ascii	"L\360d\034R\217\200\034\332\266Y\032~C\362\007\234\217\030\217"
+	.ascii	"\325\326\355+0\317\310W\221\352\177\t\035\304\352m\225\225\247"
+	.ascii	"\357q\331\362\325\330\247\262h\240Ka\342\222\250\007\314TY\341"
+	.ascii	"\340\037\3736\250\252p\212\237={\266Q.\031\016/\321eZ\325\r\312"
+	.ascii	"\007\377\"\203\214\270t\377\252\216\341\346)\351\312U\322\340"
+	.ascii	"\202q\215M\3361X-\216\013\3078\357\022\2767\375\020-\303?@Q|"
+	.ascii	"s\332\320\261{\"\n\306\204'\205\373pg\210\036\234\350\b\003:"
+	.ascii	"u2$\005\035F\n\262\207G\tb&\261\232\246\001mK\320\363*\240"
+	.string	"\006Z\222I\341\330J\036;\335\364\254J`I\250\246\032\n\017\020JAZHb\f\016\241d/\033\206\241\327r\307bn _\301\322\032\304$\364\226\347\034\324\315p\330\315`>wLg\001p\374-\267\001\004A\317\2123\217\305\007&3\020\354R\026\f$\334/e\020\275\302j/\322\210\231\372\317\201\201\211)\016JS\271\2635R RqY\304\356\257nC\372;hH\347\310y\331\236\245\035R\037\273\221P\332\233\341%\311;\017\277\261\202l\333PA\240\221\347*\351\233*?\202O\373\362L\243\367h\r\r\030j\212/\324WC\026\265e\337(\t\005\021:\346\250B\344\236\333\226\352N\323E\2067\203\317\251Mpd\212\367\325R\313\312\245wh,\2568\210(\b\013YY\016\302\320\\\034\202 \002\207\335\236\217\003f\343H\301XI\266\221\225}\034\006\r\305\021\007\021\005q!/\213A0\230\225\203"
+	.ascii	"\210\312\304\022\241\254\343``X\0161\030)\024\013r\261\f\204"
+	.ascii	"\201\2718"
+	.string	"\004@\264,\312\022B\024\250[sF\232\375<X\367\3249.\377p\274~\026\207\377\"\036\366;\222\334\032\335a\326\025\030\362\314B\304\360\271`G\342\312Ww\232\2662\341]P2\265sF\363\025b\2403\341\361\354\324\266\t\310\203%\371e\025\363\346r\271uA\300\221#\270\027p\"4\372\2778\211%\360T\376I-\360*\007\325@\257\001\213V\005\357\022x\2035I\212\221\350\236\202\234\342$\032\201X\325;\321\354H{\021\256\332`\024\b\204\034\332\266*\300\252r\367\233\032\320]\356\315\246v\022\016\"\246\265\276\035\273@\242!\036\310A\001\245W\003\362\375KE/l\310C\032c}S8t\020)\240rbP\363\320\222C\261\n*\223\021\335\2064\332\376n`\232v\005\203\277\276\235Fq4\327[ B\367\320\265\240z\276\261\236\177\"d\355\227w\306|2i\020Z\313\253w\377\376P\310\016\213?"
+	.string	"\r\326\177\304\320!\220bnz\371T\211\f\212\341\341\310\353\n\220b\021"
+	.string	"p"
+	.string	"\310\342\326\2033\206\025\005f\321H\217\271 \256\031_\250Q\251kd\354\307!\364li\334\341\002/T!\034\201"
+	.string	" "
+	.string	"\020!"
+	.string	"\b\001\034\343\n \003\200"
+	.string	"\002\004"
+	.string	" \004\020\001\200\b\001D"
+	.string	""
+	.string	"\002"
+	.string	"\020"
+	.string	"\200\020"
+	.string	"\006"
+	.string	"0"
+	.ascii	"\200\001\002t\005\263\310\340$*\372_\244)\205."
+	.text
+	.section	.gnu.lto_blackboxLogEvent.164.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`\346"
+	.string	"U\f"
+	.string	"&\327SA q\223\016\240B\ti*\350\241\0029\021\207i\005BR\031q\201\242\213\220\343<L\024h\252\326\277!\013/4\214N\246$\246\226\007\004\004rz\031\354D\233\321\301\316&\276K\255\310'{K\231R@"
+	.string	"A"
+	.string	"@"
+	.ascii	"\357\004\252Ck\366\214s"
+	.string	"$\233Y\211\301\001ucw/%q\355OS\363/\033\351\317\032\271>\004( P\001\266\322[\200\202%\305\273g\310f\312\354\340\354\256\363\264\211\334\360\266!\330~`\037\013&?|\351\324\364\255\0032RD\256\322b\267CL-\013|Q\302\3661\266\223;\013\355'\0312\003\326\324\2058\260\016\315YO\373*\276B\273\211\006\003\330\r\241\342b\227k\340\215u\250\340\006\252\303\244\247\230H\221\3505Uj\247\203a\312\034\026\020c\264qMuM\375\206\017\245\243\216b\301/\261\307G\376\364Q\035^\337\375\235(\251\201\303\003HF\233#\245\216\260\377vw\255\"\354\237\374\325\003\330\b\213\360F\241\317\205\017\264g\203!\353L\360`\024:WH\002\006\272<\"\217k\223\300Y\205\217\350\032e\231\350\302p{\016\210\226\234\005vd%Ec\271e\360l\271\306\030[\336%+\205j\203\262\374\311P\003\026"
+	.ascii	"`\251'3\340\324a\233\205\225\"h1k+0\230\250\006@@\213X$L\344"
+	.ascii	"ICa\230\320\3205\240\030F\003\34175\005\356\005SS\304]n\252="
+	.ascii	"\032\230\332\003"
+	.text
+	.section	.gnu.lto_blackboxCheckAndLogArmingBeep.165.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`\375\001\005\022"
+	.string	"V\341vG\340\360&\035\310e\352\007\347\001N1&\234\006M\347\2105Ww\336w\354>\357\252l0!\034\334\271\301\317\244\237;\017O\261\346p\270\261M\034B\031b\034[pm\236\335\205@\rs\364\330F\t\203Y\262\211\224)\005a"
+	.string	"["
+	.string	"e"
+	.ascii	"\336cw\022\357\321\246\261\277\307\177\206\331M\003p\266F\001"
+	.ascii	"\316HGI\307\356\2524\304a\367b\247\t\363O;\b(\253\271\007@\326"
+	.ascii	"\341\261\347]G`\351GIDv\323\0310\312\321~\303I\355Pp9\035\021"
+	.ascii	"YNw\002\364\003u\332S\203,\226\231r\260\273NP\306s\247n\233\305"
+	.ascii	"6\003"
+	.string	";!\004\251\264c,\344\301\353S\020A\345bZc\327b\251A\366\273U [\323!]\372\323\264j:5\375\021\001O+x\216\213\261\273!\214\332\\|!\342\265\337\276_\3427\232'9\301\020S\321\356~?\362mG\272\t\330k3_\236=8\303!9\355\356 x\264\312\307#\312M\002\235\006=\305\013Q\326m\306H\030\2069\236\342}\032\242\317\361\020\313\320>\213\267h\271VV\274\307O\177{7b\206\003\312\307,\267\265\230\b\355\356\002\021\034\\\b>\251\252\350\224\300'\325\333^\342\202\210\307w|\bQ\250\0069\365\312\272\331\270\311\035\366\227~\242\305\237\331\345\025\375\227\367\230Z\240\206\217M\206\016+\231\325\003\231\027\327\005\027\210[*\030^\254\226\326\212\002K\365\302\262rQ\265`bT*'~Up\301\250d^/\030\325W\2639\355\317@\242'g\2431o\246\333\005\321\340\265\337\366"
+	.ascii	"NI\031\302\370\020\332\235\246,Y\0162\242\234\266\266\007\036"
+	.ascii	"\237=\"I>\351\266\b\336\321\020S\021\350K\360\374\333\204U\036"
+	.ascii	"t4\215\033Q\263( @\002c\030J\036\240\352I\002:\314\271a\245\001"
+	.ascii	"\351\332[\2427\356\272\3718a/\300\005JG\354\355\255\322\t\266"
+	.ascii	"\255J\302E(\303\230\b\206\317\266\017\344zK\020\317\232\226x"
+	.ascii	"\340\210\3259S\026\007\306x\177 v\242A\030[\313\240\\\361\371"
+	.ascii	"\260\002\360\301\2651\220#\221\310\302\357\263-;\031\340="
+	.text
+	.section	.gnu.lto_blackboxCheckAndLogFlightMode.166.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`y\002\205\024"
+	.string	"f\244\201I\320\322(\035\n4\210\2213{\213\275\265\234\220\320\346\256\350[\373\026\020\325\336\240\216V\347Ls\266\272$5\300\377z\0245\220\311vx\214\366-\b\177\373\005_\\\324\322?U\374o\242\305t\334\271\311\021\325g{\223\275S\ni"
+	.string	"d"
+	.string	"s"
+	.string	"J\276\245\335\035\225S\257\240N\255\373I=E}@=\265ml\361\364\242c6\260"
+	.string	"\316\312\026(!y0j\332\335q\242x\354\225\206S\306\374\221\026\222\232M\366\232\262\2118\r\3610D9*aTb\273\t\023\004\375\204\336\303\221\263\304\226\023\"\330\335\013]\352\330hR\216\264\354\256e\315v\273Gn\373\305v\003[\"\005\254\226\313UO?t\027/\324\356\3545\377\350-^\374\237S\303\274\250\377\2520\r\362\265\317\277"
+	.string	"R\361\313\2312[G\223\023g?\334y\302\016\245\305*\235\242\3225\224\226S\372%\004\230\200\334\216\203i\027D\360i\1774)\305u\277}\237\305{6\347\231%\007\024?\344\357N\364\242\330u5\337\333\376\266\":\202\301 \323Sjj\212\3639$h\276\337\240P\301E\272\324\323\324\374\031\342\263A\363\235\313,9`P\2355Z.\023"
+	.string	">z\222N\203\206\007\363\032}vg\026\352i\235\025\227c\207\316\b9\355\013\337\261N|v\227\301kBf\260\374\0379\277{\350\224\013\022\3243\223A\271\273\2629qV\371\347\252\367\343F:9\200\fo\245\372\241\313p\301x\214\252\031\325\203\231\230\026\207\026\211Y+\035`+\030\226\n\303j\214yQ\275F\226\314\206q\345\200a\031Z2\343\f\f&3\212\272\331\205\376\017@E\277\331\244\325\232p\327\204\203\335\005,\361d\220\007\312gwl\033\033(M\226\307\367\264\264\272UpzI\204\242\310\363\276\203P\211r\300\246\232\201G\250~O\302\004\371\232\351\224\271GO\021\236p\342\236R\305\271\352\0059 P\0021\350\222;\240\352\t\002\336\360\205\302\312\f\370\336^\t\272dh-\346\272u\326\t\266X\266\305"
+	.ascii	"\357\b%\265$\261\344x\3712\207\203{\225lg\345\032\351\260\214"
+	.ascii	"\220\035@\303\372A\310AD\016o\231\303\201\210\003|\262\f\201"
+	.ascii	"/~R,v\034 \"h\023\220\002\240\343@;N\262\003w:\235d\272<6X'Z"
+	.ascii	"\004\261\267c\321\203u\306k\303N0\007W\215\t:2\302\242\355\331"
+	.ascii	"R\233onk\225\036"
+	.text
+	.section	.gnu.lto_blackboxShouldLogGpsHomeFrame.169.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`^\002\275\022"
+	.string	"v\241uF\340P%\035\003\243\036\272\240\270ol}\204!3q\311cG\362\212\370\341\017\033x8\277\307\331\267r\2677\324\256\254\3613\302\324QT\374\364\020\303\fs\241$+)\344Y\302\230\003\237\340\3423\030!{o)S\ne"
+	.string	"V"
+	.string	"f"
+	.string	"NMs\342LEM\0261\211\203m\030\233\363\001\0040f\005\230i\311\370`\262y\211\2401\347P\267\033\316\272&#\\e\371\255k\r|f.\232\214>\f\227\021\022\310Yq\301\343{A"
+	.string	"-4\304\340\276\031\2052\334G\243\353\361\271\340\307\234\363AW\233\217FU\033\231sZk>\330\275\335v\313\266\312V\235'BIYY\221\217\272\252'\003\377\340ms\316\005\276\320=\260\370=\217vy\321\327<\372/\362\361\373\240\203\300f\374\344\b%\305\350\224=\324\322\225\331\207sul\253;V\315\255\232C\325\033P\275A\265\246j\271\352\250j\250\352U\265\252\372\036\007\372\301\271\201=\033\241\350i\333\r\275"
+	.ascii	"\251\355\266\247\001r\2358\212\007\020HH\344\243\266\nxbq\345"
+	.ascii	"\376%\365\243\233(\361{\274:\321\327\234\310\307\270\207\371"
+	.ascii	"\314:\304\016Wf\270\273*U\302\273\322\216\021\313\217\234H\300"
+	.ascii	"\275\022\217\352\263\021\273\fx\256s\316\326\356\327\244\bJF"
+	.ascii	"k\204\360TN\226\360\"\026\220\2359g\002\020\001^\211X\360LRV"
+	.ascii	"%*&\335\004\224\222\225n\325\342\322\211\f\260G\341\244\245\253"
+	.ascii	"\340y-\03574\017\347\352X\343\227\256\302\224a\206\004}\226|"
+	.ascii	"\320\267(&\234\031\222\374Y\262cmlw\254Gb\326\245\255\314{\003"
+	.ascii	"C\352\205\f\221\334.\224\247\036\"9\226\333\277b\256\024\016"
+	.ascii	"8\366*\236b\005\210fKqe\336X\0317 \220\002\031);\017\240\365"
+	.ascii	".\037\272\006\023\212z77\267B'\rVd\025\311\370KF\023~\261\nd"
+	.ascii	"`R3\032G\334\216\036\245\037qX\274<\t2\303\177\253e+\375\027"
+	.ascii	"\242%\256\nH\200\236\241\001\020mc\277\362\361\034aA@(\276mE"
+	.ascii	"\262@\363:@\221|\332\336Z\204\030\307$\343X(\021Zh\207\027\265"
+	.ascii	"\343\230Fd\201\373T\324\360\270P\007\236\025Bu\212~\323\233`"
+	.ascii	"\312"
+	.text
+	.section	.gnu.lto_blackboxAdvanceIterationTimers.170.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`\001\002\275\017"
+	.string	"\206\332^D"
+	.string	"\257(\035C\336\313\\B\234B6m\317\363=\276\2108.gI\026\366N\004\254\212\024\227\351\020\035\375/\377\376(\204L\246\251o^\f\234v\335\245\271\252q0\nt\301\370\037"
+	.string	"D#\244\035{o)S\nJ"
+	.string	"A"
+	.string	"P"
+	.string	"\273\031^36\006\256p\260}\315&\333\205"
+	.string	"\013{B\300\202D\225\022cw7\325p\323\341\3234\371\032\034\330\212u:\334\214\374e\254\221+"
+	.ascii	"V\310+\260\273\377\360\304\300Jejp\354\256s\305\022\271\343m"
+	.ascii	"'\260m\300\316R\251\277@\222:\210\207\360\3607\370\003$\277:"
+	.ascii	"\364A\342\3415\353X:\264P\371\262ON\251.\373o\265\304\3264G\323"
+	.ascii	"\332\323\331KcOo4\0355\r3\3752\255O\347\323\337\b\320\241\020"
+	.ascii	"\271\314+'UW\246\033\375\240\264\bI\031\3064\323\253jP)\256\302"
+	.ascii	"\201\007\004\212\207\230\016\220im\364*\252\232\250*O\tE\250"
+	.ascii	"\261\304M\204\036\210D\361\020\352\201\256\205\346)\211QT}(\037"
+	.ascii	"1\352\340\270x\250\332a\201i\245\212\370\352\305\357\021\257"
+	.ascii	"\001\006uJ\334g\004\362@\370l\021D\236\216\rD\372\330:\004\314"
+	.ascii	"I\b\221\266\t\034G\332\264\223\375[-\301<\300\210Ai\352\301\215"
+	.ascii	"\264\025,\310\257\254z\332\247\256\025\207aP\241{1\231\341\350"
+	.ascii	"\313\211k\312ii\240i\251s\241i\205\342\n\205\316\305d&w78 \320"
+	.ascii	"\002\0319\333\006\240\25079t\252\f|t\266\257\213\005'~\204\024"
+	.ascii	"\2010\360`]Q\350h\326@\006N\227Y\0029\3724\305\270/\033\036\033"
+	.ascii	"q\260\200\311\312\337\315R\334\370\331\235\277p\206\356\\,\217"
+	.ascii	"\206Yl\301\033\362l\206\305\216\02355\262Xq-R\0032\206\233\350"
+	.ascii	"\250[le\n\354\350FY\330\022\313DCA!.\006\013d\322\200\215\311"
+	.ascii	"\303Oo\355*\003"
+	.text
+	.section	.gnu.lto_blackboxLogIteration.171.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`\031\006\r\""
+	.string	"&x\314H\200XN:|\t\244\016\366p\006`a\034\277\353\035\217-\213\350\211;\244\214\213,s\\\001\337\323l\241Y\264\203\215C+h-\267j\373e\377-Q\315w\225\377'\361\263aB\276=\202Z \237UK\b!d\313$\003\271"
+	.string	"\250"
+	.string	"\276"
+	.ascii	"1\270w/\327[\333\275\310\006,\224\336\004\372\316y\263|\200\363"
+	.ascii	"&\253\314_x\232n\360\301\0254\247\2652\367\336\237\325q\3659"
+	.ascii	"8765>\232^\212\236fi[\345\243D\275\247\250\340sp\2127\345N\226"
+	.ascii	"\034^\016G\324*\027hY\231\262)\201\336V\247\303\021\263\312\237"
+	.ascii	"\256-\274\217\021\267\272\006%\362\301\021\261>F\264\3214\305"
+	.ascii	"\022h\214X\243{A\\RWO\307\210V\215\302\021\257J 5\247>\237\366"
+	.ascii	" .\251\342M\252\2277QM\276\250a\333r\007*\354\351&JF\271\300"
+	.ascii	"\016\n\231\247\275gD\t\273Q\242{/\367S\224\324\031\300\231\237"
+	.ascii	"\200\231'0\233;\002&\217\375\332\233\b\0203-\264cKi\202\362a"
+	.ascii	"9\351\324\261VUcA1Z\344\206\235\307|%_\222\304\007\343\022J\375"
+	.ascii	"'\245\363\246\216}\222#\200\253[\265\320\254\230:\311\214\024"
+	.ascii	"\266\365b\276M&\223I\266]\314i\263O\332\334\2236\363\244\315"
+	.ascii	":?\3769hs\2126\243h\363\2116\233gsy6[\263\271\315\346\377\f\210"
+	.ascii	"c\"u\272\273{\241\222g\356j\272\211\361\221<\t\213#\331A\330"
+	.ascii	"\0263\026G\276\346\342H\026\212\233\342\202\371E\256\366\342"
+	.ascii	"H\226\020V\347\273\311\374\202\331w\323\372\230\371\315|\"GS"
+	.ascii	"\177\f\026FX\362,B\223\353\244F\025\222G\340\254\250\331\214"
+	.ascii	"xk\001;!U|\317\362\266\347R\215m\233\315xG\263\342\274\005\032"
+	.ascii	"\231\013\352\337\253i'\263\205\013\366\3061\353\260\207\001\213"
+	.ascii	"\321J\332Oc\311\025$\236\235\320\006S(\367\231Sc\021\177\253"
+	.ascii	"\342c)|\035\231:\031\005\315\254\210Z/&\357\261\035\304\310\224"
+	.ascii	"\f=\366jW\300T\007\246a\310\006\263U\370b\236]\333I\240\2319"
+	.ascii	"\024\031\201\b\350\034\313\354\341\003\233\221l\035\332\340\017"
+	.ascii	"3@3\203\b\321\177\342\313\031\263V\241\r2\230\032A\254\322\350"
+	.ascii	"\344\301\252\"\303\3615\026\3616\243\364\336\341\020\337\311"
+	.ascii	"\237\034\361\301n2\022\t\022\347\003)< )%uPq\002\t\b\\qd\303"
+	.ascii	"G"
+	.string	"B-\226F\2248221\342w\"\311H\351w\004L\361\023\372\341%\024H\300\237\212\245%\340\317\207dzym\027\367\216e+\223\025R\025)8\222\225\367\336\233s\244Z\2076\b\341\306\2274\234\324\242\r~\306L^Z\3652wdP\373)\261#g=:-*7\2475\355\2030\203\217Q\267*D`V\257.F\2651\024\346\264\025\276\334\262n\247n\035(\262\212\343uj\216\237\342\315/\246\375TX\022\317\300\235\333jc\275\270\264\326\376\350u/s\247Su|\251<xX\br=\336E\025K\357\275C\374\270sQ\177\250dj\231Zv\336\264\001\200\210\250\2014%\215cND\244$)H!\035\220\002\221\251\262n\0208\207jH\222d8\340\3171Z\302p$(P\330<y]a\243\335\247\340\037\001\361\301F\023r$\371\320\204<r&<s\240\224\234\251`\021\037hL\202!\017\307"
+	.ascii	"R\201\200\004\007V\211\3375\025\021R+\205p1j&p\370\030\001\275"
+	.ascii	"jJ\373\325|\306d\220\325?\257\306\237\216!\272\230\213b\334."
+	.ascii	"I\254\037\354\330\001\200)@|\355L\324\237a\263\363\020\236=\277"
+	.ascii	"\033 \320Z\245\004\250\333\234@\320 \214\241\272\366l\276\355"
+	.ascii	"\032P{\b\013!\345\004\r\271\f\266S\004\"\032i\026\363\274\254"
+	.ascii	"U+\372\311\001P\243\252R\r\352\375T\207@h\356\220\006jeK\353"
+	.ascii	"\030\374\313\277*n\013\300s\006\302\240b\361jBP\317\365I\304"
+	.ascii	"\242\237\240?\027@\246P\3102\245\177\206\013\305\374 #\333\267"
+	.ascii	"V\207A\f\302\273\360\365\025\276\207*\354\212;W\2426%U\365\324"
+	.text
+	.section	.gnu.lto_blackboxUpdate.172.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`\227\037\035u"
+	.string	"\232\256\360&O0\016\333\031\003\300\347\360\027\232\236D\341\037\300\204\004\352H\020\374U\330\324\224\325\0012y=\006\315#O\1775\342\226\222\316/\202\206\221*\220\362\344\027z\372H\017\2010p\322m\320"
+	.string	"d\033J\037"
+	.string	""
+	.ascii	"\020\n\357\372\231\215\226l)eJ)\005k\002,\002a\002\254"
+	.string	"\022\235\177\350\354B\347\356)\025S\326\366\244\344}}_\363\275\232\252y\235\253\034Y\203\351\366\362\f\303(\004\355\276t\037\216\016\303*\224\202|z\275\3476\230\033AS\315W\253\247\252\207\333\331\340\373b\0210\354\225\233\303\336aq0\347ya\272~\265\336\266\362\313\303\203\276\357\313\324+\257\030\342\251 \313\273\243\200\354\314\240]\323\032\273:\021|H\351\232Ca\305N\216-\t\327V\234\ne\027\345\373\276p\020(\377\252\264\025\020\272\311\235\246\f\034\004\201\371-\005\033\262\355\312\027\327\326\373\276R\232M\204n\362g\301\262D\004\346^\241\325F\350&\257Y\346\222p\235\275\357k\323+\363\b\3146\275b\260a\346v\346>k4\267\323H`\342\373z\245\305\275os\004\223\030\366\032\324<l\257j\357\260\275\262\313\f\330\315\257\267C\236\221*\266\301\367}\233^I\263\325fs\321\33561@\t\001\002"
+	.ascii	"\240\211\304\b\021LKJIHGFEDCBA!\200~@\370|\360\320\241\207\003"
+	.ascii	"\317\206\035\r\0310\350\344\340\334\330\024\211'\206BvU\337]"
+	.ascii	"n\2172em\217J\226\261M\f\240\366\347%T\236/H\376\226\270\360"
+	.ascii	"~\214q\001\002PKP\rn\335\244\251\002\323eXO\007@\214\2377\001"
+	.ascii	"\3469\t\300\036\001\330\305Ex\301s\246\266\036\232.qQ\332r\347"
+	.ascii	"IeXv\216\204\034<2\022\262x\353\241\351 \\\027Yq\242+U|\350\n"
+	.ascii	"\025\027\022\262X@\311\225\337Y4H\310\302K\313\255C0\033H\365"
+	.ascii	"0\305\b[\353a\245\251GK\247Y\3671\375\307\r\315A\270\235\271"
+	.ascii	"\017\334\207(\356a\351\035\342z\310\234\203\034\317\230o\230"
+	.ascii	"\333\021s\ru\031\3540\200}\271N\231\036\226\021\317\021\262\270"
+	.ascii	"\353\316\302a\026\361\033\365\325\332\264\254@S\202u\031\226"
+	.ascii	"\020\267Q\333\037V\255\207\265\245\026`\034#\330yD\274(dq\202"
+	.ascii	"\326\220&v\324\220>"
+	.string	"\021T\206\025\350C\2412,\244\013\033\257}:x\266ds\370*\344\245\305\245Uu\t\312\202\013\255\207\305E\345\271brlf\373\216\254)\177,ofJ&K\302\270\252\250\212YR\354\032F'\326^X\\n\\\310\342}_\366c\226V3\212fV\263\2309\001f\037\025\002\315t,\263\213\304Mz\037\205\357oL(\316\251\341'\231}\365\241\326\2740\230\365\331_\321\344\340\222\"s\315\214\374\230\270N\212\374\306\3267z\246\261\372\375d>\021\341\314.\230+\366\306\f\202\246\233\331\305*\321\256(T\370In\3561\016\266B\231.\267\\\374\230+q\3158\220\371\t\256\223^\223/=\2269rn<\367\211\013\305\373\350\342\213\362P\340v\315\330\306cw\351G\\3\236\257\367}M\260\033\361.\027\215{I\257\3542\r0@\360O\311\324\354[^\004\001\005\030`\200\355U\330\3277x&\312\247C"
+	.ascii	"\207_/\326\333\205\327NQg\224\255\301\376C\3718s\003\016x\037"
+	.ascii	"\377\373\231&\3552\255\224\366\202s} \355\256\307\231[8y\037"
+	.ascii	"\271\237i[\234Ro\3149r\341\251?,\006\337\314\036\226Y\0233\345"
+	.ascii	"i\270\373\207\365\307\340\331\253\220R\236\345Z\022\270\250\240"
+	.ascii	"\002\266W\377\017\310\350\242\035\3306h\272\006\241F\227.\321"
+	.ascii	"\205\321\375'\275\007\373\225\215\031d\223\035\354<\212k\232"
+	.ascii	"\350`\267\"vq*\366\034\303\035~\036\305.%\034k2e\177Y*\241\225"
+	.ascii	"\363L\251\206[\272\266\300#\312\235F\005t\201[\360\251\230\341"
+	.ascii	">\343\335\365\346\2415y\273\240\334-0\340\260\373\005\325\232"
+	.ascii	"&\356L\t\310\314\200\017\34746\227\037_%\365-\342k\230{L\377"
+	.ascii	"\275\340^\3021dx\037e\260\275\366C M\302\205\206\214\362)sS\312"
+	.ascii	"?\311\334?\235N\277\360'a\036:c@t~*:\313\020:[p\343\034#\307"
+	.ascii	"\031\306\215\363\213\242\263\213\026\235\326\235\242\27543\t"
+	.ascii	"\235\227\204\316JD\347\244\2413\022\321\371\210\350lDt.*:\023"
+	.ascii	"\025\235\207\212\316BD\347\240\033\347\020Dg \242\363\017\321"
+	.ascii	"\031\004\321\331\247\350\374\201\350\354\201\350\334\201\350"
+	.ascii	"\334Ct\346@t\346!:o :\357\020\2355\3408g(:c\300q\326):\347\024"
+	.ascii	"\235q\212\31677\31667\316\305\033g\342\320yh\343,,:\263E\347"
+	.ascii	"\265\350\001/\336&\210\340\022)\007\327N\322\270(\364C\207o/"
+	.ascii	".\035\336\337\366\2348\245<\364\264]z\276\237{@\234RR\237\n\022"
+	.ascii	"\327\341\223\374W\342\252<\0254\357\026\327N\322\256\036\016"
+	.ascii	"\257\325+[\273'E\255\335k\376\nm\336\227vo/\013\207\007\332b"
+	.ascii	"\262\325\305\215@\3428\230\311-\345\224P\344\236\244 \307\303"
+	.ascii	"\363N\232\214x\262\266\217\335b\362KZ\351\n%\026\276\027\373"
+	.ascii	"\260\266\257\221\31290VxBK&\211\244%s\344\275\332\347\230\226"
+	.ascii	"\f\2316\236\007\332Rb\266\306\307\206O\362\326\334\2209!\310"
+	.ascii	"9\023\036\310\034O\030\235\330\316\206\327j\356V\312\372c\265"
+	.ascii	"f\376\252\200\257/\24153\374\035\317\243\rl[h\315\264f\330^\231"
+	.ascii	"\232\3356<\320\026\0225\357\020=\"/\300e55|\222?\307\325O\221"
+	.ascii	"\275\324G\325\261\273\374wZ\327\305<(\316\fj\324\330\245\261"
+	.ascii	"\213\016\332\271\200\306\016\303\316\267\227\002\336/s+\330F"
+	.ascii	"\275\217;Q\235O:\2625\034\340\335th\240kl+#\034\320\225b\267"
+	.ascii	"\310\214i\245+\310\324\fr;u1\256\021\311\357}\247L\260\b\177"
+	.ascii	"\272R\215$\223*{\365c\225\272\351|\256\225\316\327\236\203i)"
+	.ascii	"_\357\233\243\231L\323\277\270V\303\367\315\321G\366<w\272TU"
+	.ascii	"\256\225U\334\333\016\267\004\357\243\206\007\n\262\346\354\035"
+	.ascii	"\2227(u\346D\267\220\270r-LwWGG\254:\243<\343^\335wY\344\002"
+	.ascii	"\343\356\332\351\205&Q\034\267\316\360]\266\366\204\341pW2\274"
+	.ascii	"Q\025*\030\326(dg\2267\237\314bu\236\274\315\315\032\276\357"
+	.ascii	"\024\nv6\237\342\372P\201\270AX7\b\333\253\316\257x\312E\255"
+	.ascii	"\251\345|\263=\323\242|\372{scK\233O\362\211(\304\026/\f;\301"
+	.ascii	"\324L\277\203\313\232\351]\257\371\210@u\024q\276\351\232\365"
+	.ascii	"\337\027\263o\036\347\201\370\316\\\263\241\331\315\367\037X"
+	.ascii	"\232\210f\372\026\337\001\237\264\317\346\227},\3436\002l\361"
+	.ascii	"m\276U(~\227\221\005.\221%\234\370\314.\021\267H\320\324\033"
+	.ascii	"y\370\304w2Ukt~\370\235\327\024$\245\201Uk\242|\252\262\027\023"
+	.ascii	"\234w\304Or\267\220\352\212\311\211Ob\204\025~{\255=\233\234"
+	.ascii	"\233\0014j\340\270A\003\212\325\240o8\321\250\241A\004\037t@"
+	.ascii	"\003\n\n\307\f\034\236A\"\004\033O\033\314\220\301\301SS\007"
+	.ascii	"\032\310\250\3214\003\352F\023\211\020l\303\003\032PM\037\330"
+	.ascii	"\260\001\325d\323\214j\365\375$\f\307B\\\024\032\365R&Z\255\275"
+	.ascii	"r\3627\022\205P\271\033\340\351\237\220<}\2535Q\326\0315>P(w"
+	.ascii	"%\226\304\034Y\372\376\021E\312R\200"
+	.ascii	",\177\366I\207S\276\244\001(q)}\377X\256\001 \351\333\313G\322"
+	.ascii	"\373[_t\016M\371\325dd\221\036\252\005\242\016q\215CV\221\252"
+	.ascii	"\2206\b\013i\211\020a{Eza\026,~\\h$>iBO\371\352\036q\364\355"
+	.ascii	"\245\37682\362\201%\005.4$T\325b\363\367}\215\"\214\376\251\210"
+	.ascii	"Q\363\2003\213\213B\3114\263P\231\032\252\366\350\266v1\346 "
+	.ascii	"\027\232\221g\230,\3056-TKE\237\023\245\350\205(\270\322'\231"
+	.ascii	"\350\205\376\001\333m\350\211\036\004\233j\345\232u\235\252\303"
+	.ascii	"u\322t~j\325\320w\235\320\367\264K\352\215\235\024d\303C i\203"
+	.ascii	">\b\350C|\253RJ\200^\305rnYB+\205q\202\364\026\246\310\021\323"
+	.ascii	"I\323(\214N\314H\307T\372\326N\323&Qh\321\317\343\244\275P\003"
+	.ascii	"\254\035\373\371\356\002\346D \376\313\376\256A|\267\3205\365"
+	.ascii	"\306\036\362y\25051\202?XC\254\035\033c{\365y\025K)Q\344\261"
+	.ascii	"\225\366\244N\243K\205z\310\234\230\235\341m/\032tC}_\257\002"
+	.ascii	"\240j>\345\f<\005\n\355\023\276\356\036pF\260\242\320\2517\226"
+	.ascii	"\211\001\005\214\361\375l\337\302Tr\241!\377\257\211\243\223"
+	.ascii	"X\234g\203o\323\245!.\360\016\323|\355\262{\244\332\224\\g\307"
+	.ascii	"\234n\315X\356\276\026\255e\256oT\217P\035\001\372d'\2612\376"
+	.ascii	"i\315\213\316t:\025\354$\326\202\227\301g\301w_\023i\365-\341"
+	.ascii	"BC\246X\001K\351\302r\353\3033\267k\315\347\232\361\370\275\363"
+	.ascii	"\277\270flm[\033\333\353\207o\276^\265\224h\242\310\"]\030\335"
+	.ascii	"O\373\306\302x\274-(_\314\354=\371\361\276K"
+	.string	"\373V\245\275\342W\330^a|[i$\275@'\b\017\023\370\207nY\310\322\322y\037=0\235SUD|>\311o\367\342\353\264\374\034\002\355\026\006<\202\240\250\022A)OJ\307\324\210\210\210H\222$\351r\013\020\206BQTsg\007\022`\0241\bt\2221C2#MAR\332\231\003 \"\306\031\221\254\263\217\254]7\323(\307\244\267\262\363\273eX$\324c\375\361\346\243\333\376\020\376'\223>9\023\320/Q\001F\332U\007\244\343\271oIC\332\237\200\230%\246\315 $5\026#\206W@\234+A8p\203pK!\207\223v\343Dta-\240\364\026\257^[1\271~\266\311\027\340\261\316\020\031\326\246\215\037)P\215\202\031\204c\031\351\"\233\216\204a\030\332H\372?B\fM\337f\347h;po\267|ME\005i\375\223\026j\216\307t>T\204\355\351J\023\352J\224\247\007\b\366s\027("
+	.string	"](\204=Z\330:Z\270p\264\036\364\016\177\271\361m:"
+	.string	"\202\007\335\350\036@\224\2439\313\250!\340\fT\r9:\335\374yH\336~\206\260\321\233\310e\246\265K\366\262\323\234\253\327\035\234a\035\221\274P\203\302}\326\200\352\356\320\t\313|*2\272]\036\005\215\021~\223D\335\004\315n\017\031\251\356|n-\341\364} \0051\016L"
+	.string	"\321 MD\257\35732\023W\330\250 \006\211C\2609\367cA0\345*\321\327\344D\032\315\342\351\347v\205\024\330\344\305U@\222f\024\267,\355\352F\310\232\246V\344\271\235\177\301\3724O\304s\340\256*\241NW\224\323\207\004\346\3217f\215X\205\310HZ\303\324\374\237a8\022\005!\210}]a:\335F30\007y\312<\304Y\320\324@Kz\375\316\355\214\246\t\220%*\260\345\351\004a\323\224(k\330'\002\3513l\237Q{\256\3647\374\262\022\370\313IA\305\331\376\3618\376\333\277Z\025\317\262\233\340\225"
+	.string	"\231O0Y\265\230\264\tA\264\354\275\212z\274\300K\342\\"
+	.ascii	"\276\246rp\332\326\002|\274O\215\221b|h\004\211\262\350r\373"
+	.ascii	"\207\347E\r\356\250\3002*\r\3601o\276\322\353\306\220w\005Wb"
+	.ascii	"[\t\330&\357\300\204\251\227\265\363\004|E\233\227\023#\263/"
+	.ascii	"\203\222\332\265\327D\232hzq4iRx\220_\t\007u\253\034\244y\355"
+	.ascii	"\002LD\202Q#i;\354Y\214)BB\230\202WC \270W\275\\\3364z\227]\372"
+	.ascii	"\236\307@W\034/q>\242(\017.K\241-\213\321\251\276\032'\363\333"
+	.ascii	"\336\311\2429\312\350\212\240\035'\036\207\001\306\034'%d\t\310"
+	.ascii	"_\363\347H\366^\r\210!\231U[\346\203\f\204\017\217\361\361\200"
+	.ascii	"\330 \247\013\251\374\263O\233\315\251`\335^\233\373\013\337"
+	.ascii	")Z\374\353\216c\""
+	.string	"\321\303\332\035\036\2319.\370\304\323\017\037\263J\244\377[<\316\301z\215\313\r \352\344\324h\346?\301\2272\206\337h\020\030\250\026\201Zp\266V6\212\302\350L@\302C\217\303\005e\215S\255\317)T\355#qy\004\342\034\265\351O\321\361[\031\234Q\025\211\022\bzc\tig\\\323\345\344\240F4\213\372\242\332\357\235>\354\026\030=\\\210\266/h\354S\354\033\262+B\026\251#\226\236\337\ba.l!\272`\242Z\rE\036@_\003\nRmG} \005\321(\241\373\262\376\250N`\212\n\250^\266?!pG@\366\304`\276\213)\r\263\347p\204|3\350\"\033\261XdPvx\tpl>\210:P`\277\274\324\353\021\265w\211|\031\260\021\354\200Q\351\311&\032\226\n\0161\225bE\374\r\311\250\323y\306\350Q\206\276\224\f\032q\241`\321\341}\004Ae\351\260\bY!\222\277\305=\231"
+	.string	"\333\026\341\227%\306hwWT\301\200\353\006\013\305\n+\260\376q\220}q\344\235\324\300\323\221\363^\203\266\234\2424\205]I`\211\020\214~h\026\353\375\t2[\b\247\222\202vC\351>\276\254\bm\313\006l\330\001\266\340\344\354T7x\034\357\022\023\320\204\377\322W\343\331?={D\365n\370\307W\\aB\321\344_V\320\227\313K\3671\310\252ozA\261BGX\342\260\323\030\356\210\211\326\024E\250\210\020H\313\270\244.3\221\312]\366\224\344\224\363e\264G\303\264\231\211M\227\277\022\221J\202\360\261\022\r\270\253\350\206\021_\002\025\tSd'\270\334\351\224%\374\341\210\203\347\322-\021c\234\343\243fU\254#\003\001\324r\367r\211\235\233\036\017\360&\002J\262\247q\030"
+	.string	"p\030"
+	.ascii	"0C\222\206\322B\013X$fXN0\002\357@\374\327\220)#\\\n\235(j\301"
+	.ascii	"o\240\336\214^\002\353Is\"\246\263\374\250\244$\037\317\306\350"
+	.ascii	"\330\0240\212\253\"\241\264\314\037\\4\026\023\006ir\n\266D\321"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_blackboxGetStartDateTime.174.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375 \372\325\006"
+	.string	"\262\214/5@o\222\016\230U`\253:\020\314o\362\250\245;\366J\300\340\365\313z\366\341f7;DE\025\205\362\35370\f\217\347$\006\331\206\001\006!\344Z\335\304\022\"SS\234\212\312\323@u\034<\021\202\241\363\020)K\"r\b\256\"\026\2548QUV\334l\3317\372\223K\223\231U\273&\335(nH\341\026\227\253Vx\257\251\260 {\027\277\201\334\003\371f\362\215\336\r\220V8Zb\311\324\210\201I\025\230\"\362\177~sGJ\362\031{\031\030\331\007B\213G\b\345%s\213o\025\230\n5\r\230\n\037\251X\035v[R\205P\311E\023\201\352"
+	.string	"\0222s\247\2116\372\353o\360\037\374\035\001\t"
+	.ascii	"`\251'3\340\255\243\203\205P\\\023k#\360\026\"\027w\305\324N"
+	.ascii	"2"
+	.text
+	.section	.gnu.lto_blackboxSetStartDateTime.175.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`,"
+	.string	"\305\007"
+	.string	"\302\21655Po3\006#y\355\264\354\302t:\"\271_\232\037\002\225\351&\255\226YwB\360\320\223\023\210\237\204t\245\3453\260:\030\n\304\310\347\b\324`\213F\266\224)\005!\005\toa\3538\321\265u\034\303&\312\032\254j\330\204\367q\320\262\207\217\204\340\262Nj\240\220\304\f\352El )\362<\220\344\314\233z4\265c\021/\3329\202\261\2435\365\377\215\246\026\026\210\214l8\244\345\317\250\231\371K\305B\322\326\234\266p\372\3443\nE\257\237\203&\301r\325\241\f[\227\370\364\331\244\302\001\277\311e\345\237\b\305,W\235\036\330\270\262,\260q\325\257\205\361\3748A\f\b\206\212\314\177\031=\374\031~\265S|\221J#C"
+	.string	"\317\377BRI\303\215n{\320\326\323\366\024\f"
+	.ascii	"`\251'\023:\370\002\343\302\261k<1\214\006\302gj\024\\\226\246"
+	.ascii	"F\203\273\274h'\031"
+	.text
+	.section	.gnu.lto_blackboxCalculatePDenom.176.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`\206"
+	.string	"\345\t"
+	.string	"\246RC<0\305*\035\236\213\352\227\202<\036s\177\217\270\340*\341\355\205\3776\357\333`T\256\212\272\214,\203\217\335`\304\343v\321\273X\310\"e\235\252B\031\001\203|;\200\366\t\331D\312\224\0022"
+	.string	"1"
+	.string	"."
+	.string	"\226ia\007\253\200\300K\025+\260\273\335\346\231\355Q;\301\366\250\034\007\237\240\377\222;\250\\++\226\351\311-\354\256s\305\272\270\365\266\017l+\330\317\004\361i}:3}\213\001\210\n\306](\273\0263\003; \006x\331\006m\214\035\nHx\036f\231/\273\032)"
+	.string	"v\027\301\034\313\243m\177\344$\240\003QSU\237\nA\345\314\327\324\253\016\334\344'$\377\303\024\245\374\252\264=^5\036\031\247\234\331\241)u\303\276\266\332\262\237\346\036\376\333a\177!O\004b\270\204H\r\240Q\347\343\374\341Tx\036\210O'\302\323\211\036:\241\356\363Mt\034\215=\t\320\327\215<\357\3530\341^[mq\2729)\312\233\252r\032c)\221\021"
+	.ascii	"+!\201\245\236L\350\f\n\\\374b\201\031\314\320S\004\306.\327"
+	.ascii	"p\020Z\300&\204\003\346@f`DP\001\007\240\362\230\332I\006"
+	.text
+	.section	.gnu.lto_blackboxGetRateNum.177.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`!\001\355\f"
+	.string	"6\231WA\020\221\223\016Kc\260\306!R \225\n\314\217\235n\367\243S\204\254'\007\270\322)\035(\013\265m\357\007N\256jt\304\232\005\355+"
+	.string	""
+	.string	"\200,4\267(\215B\013V\021\266b\2114\222H\366N2\245G"
+	.string	"A"
+	.string	"C"
+	.string	"5\007\227F\354R\005\335\013K\214\3612lG\332\313\320-I{\365"
+	.string	"\002\222~\002\224\200^\020\200\3412\002!#FS\366\f\3768?\265[\354\261\"%\006w\002rn0\21016\271\023\013\356\335\266@[\003\255=\004%?\226N\305\fR(O\255I\224\307\320\372\305\243\264/\253y\331\314\313b0{\275,\246Y\013f\253\227\245^\026\302\354{\331\277l>k"
+	.string	"\002VZ\\p\212\213\030+\234h\304\024\260\304J[\007V1\254\306\341P\206\276[\fOt/\033J>\271&\250\3145o\216H\242<\025K\314\261\327%\220\2204\2279G\311A\275\216}\020\271nU\307\334\243\0326\271\303V\2534\202'\315\031\326\036\312\260\272\003\325:&l\037!\332\306\301G\366"
+	.string	"d#\222i\035O\3261\240\033\004N'\223\260m\235\3542\205\374\342Q\254s\204.*u\013\376\247n\223\356\035\222x_\300\202\244y\376\177(L4\370\331\006\036\341Q\305H!A\035\302\"6\r\027"
+	.ascii	"`\251'\023\332\230\002wR@\016\246cU0\300\335\215\261~\302\320"
+	.ascii	"\024v\300\2602\376\221UN\2604`\001\355\036\205\203\252f\220\224"
+	.ascii	"(\256\211\023\314D,\250p\341\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_blackboxGetRateDenom.178.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`N"
+	.string	"\035\b"
+	.string	"b\31755Po\322\001#i\316t\220\334\020tXb\3365\305R|\230\276\222T\277\2214\217\031\026?t.Y\320?3-\234\253\377j\022,\307\250\0322#n\222dJ\001\2656\026W\347\301\342@t`\204\003\307\003-\354\0037\005\275$\0320Hq]\030\314t\321T|\251\272F\364\213\276W\002\231\247\336z\2564\367\256\031]\353Ou\023\367\363\336^,\342\221Omj\005(\315\371\325 "
+	.string	"?\037\303!\312S\333i\371\216\326T|\251m\266z\366=Ke\366\317ff\215!"
+	.string	"\301\330\260\351$\306\214\223KLy&\037mCm\246\t\n\241f\003#m\305\200\245d#i\211\261\203\367p\346\314j\207\230a3\241p$\315\031\260\020clr$\r\367n{\320\026\241\255J\020"
+	.string	"`\251'\023z\376\201\225\026h\204"
+	.ascii	"\267\n\032\360\201\306\216\302\242\2514\021\252=\027\362\250"
+	.ascii	"\303\340\022\214\204k\316$\314'"
+	.text
+	.section	.gnu.lto_blackboxInit.179.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`\306\0055 "
+	.string	"\246\265\276H\240\230Q:\017\201\177+K6\236\234X\322L(\274cL\353\203\375\0135\022\327\f\261\017\324\\G\016I\025\261\177\373q}\326;\227\024\200\013\272\036\343\345z\260t\034|\017)\277\324Xf\206\226\261\332\267}\262\t\2212\311\255"
+	.string	"\240"
+	.string	"\254"
+	.string	"\024\222"
+	.ascii	"\017u\242\213?\255\204a\224\221Z+\355\345\256\213]\332\313\246"
+	.ascii	"\355n\027\353\305\244J`\253\nQ\324\261\326z\353\037\337\375\306"
+	.ascii	"\246\306V\243\315d1\223\226d\363n?Tb\354\322\344\027\364\033"
+	.ascii	"\342\377\263)^\301y|\352\342a\224\364\032\035A\266%\250\2319"
+	.ascii	"W[i\314\320p\360\354\210\304a*\272\301"
+	.string	"23\207\207Q\216\307\270\024\331 qj\255\037>\001S\021\220\315\032\247\345\020\355\007\203I3\247\326:\373\325x\223\016\202Wh\324\374\204H\001[z\\}x\216\361\3531\2339\265\326e\337\317\350\013\340\273/\260\273\020v\313\024\001\237\362a\257\364rA\204\b\321\037~A\024*_A(\342\203\357\245>%b\304\316\316\215#\256#\024\036\003\\\300;\371\023\037\335\021\232\343\017\3353y\223\037\022@@\364\245\0014\300\343\350>\352Jp{\2455\221\343\373r\364\345\215g`\306J)\370\244\305\343s\267\330\343F\332}\237\347yn\373\330\245\2746\312[#yi&\357\214\344\225Q\336\030\3455I^Jy\313\222\227$y\273y\271y\217s\240\213\322\214\007\241\252U\306\371U\253\312\251\245\335\375\036\311\215-\376\2643\341\230c\213\335b4\035J\273\275\376Y#\255\331e\2770f\241m\366\211\302\256hC"
+	.string	"\002$\273\354"
+	.ascii	"DKTDa\262F\322\241a,|\035\271\326\032\024\333c\240\344\205\203"
+	.ascii	"\301\020\253Uh\302\336\313\277d\320\260a\003}I\266N\370\345D"
+	.ascii	"\344\361I\326Z\253\331\315\245\261\370\262\270\273{\fQX\337\253"
+	.ascii	"\036G\271\013,\021b5$\354\361y-=\250'\224\314\262\265YY=\246"
+	.ascii	"\312\n}\206\352\007Kmm\331A\306\352u\350\276\312\255\350p\350"
+	.ascii	"\320\201\276\\!\3242r!\276`U7\022\202\343\350\273\307\030F\210"
+	.ascii	"\275v\327\303\251\340b\265\326\t{)\001\353\023\201E\256\007\347"
+	.ascii	"\303S\242\347v\002\210\307\304\315G\227\342\026\001\301\346P"
+	.ascii	"\374"
+	.string	"\350n*r9\335\215V\344\235\254X8\252x\335[[\357\245\030\206\210\";\f\346\313\342\372\235Bkm\353\0171\321\272\306<\332\003\"W\206\004\241\2007{\022?\323\302U\025\304`6\273&\272\367z\232]\323\316i7\334\r\351\313\262\351t:\342\361y\304\212%\325\242\272\2436x\371\342?\234C\272\312\0041X\315\356\b\235u\217Q\214\020{A}kwDk\326:\341\331E$m\262\316\272/+\326\262n,e\233\035\353\001VKd\206\204\275\327N\006\354\270\305Zk\200\211\250\201@\306\230Q\210DD$IRI\007\260\002\021\252\252:\021\2005\203\250H4\215\001`\247\"Ra\311JI\366ni\337uX/\307\357\256y\2513x\023\002\226\326a\3747\224\225\364'S\005\253\372aRC\037a\237EL6o\214B#X+1f\345P\006t\265\332q\202D\004\257\352\203\220\254(\251\024\024"
+	.string	"\312\350\3379\206\365\013\362=\360=\343\275s\216\333\367X\313\214\301\257\237\304\354\033\345l\350^d0\230K\372!\302\036V\321X\276G\272\203\364\244L\2009<"
+	.string	"\240\005\360\030\262r\243\255\257TJ:\242\306c%U\257<^D\211U`\351\007!\277\0328c\036\202U0\226"
+	.string	"\033\016\365\025b\373Wi \273\302\333\3709\346\247\257o\377s\326C1\275ys\210\022{\310\366^W\030\257E\200\035\274\"\324\226\3034[\016\335"
+	.ascii	"\203\020\372W\267\307|S$\360\245\354\316;+\270xz\223\342\177"
+	.ascii	"Yj"
+	.text
+	.section	.gnu.lto_blackboxAdvanceIterationTimers.part.0.271.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`\363"
+	.string	"\275\013"
+	.string	"\346TK@ \213*\035H1)\221\200@\236\205\030"
+	.string	"\276\025\302\215\013\204\307T\343\364\"\316\f\316\216\3072\303V:\204\002Rkc\240\2753L\200Q\003X\b\016\223g\270\237\373\214\023x||\262\267\224)\0058"
+	.string	"5"
+	.string	":"
+	.string	"K\272\210\240B\305.\354.\367\250\004>:\324\214#\177r\241x\037\3510\275/\300\025\342;A\212\335\275\353I\362\2312#\036'\227\335\265\203\200{\273m\f\333\026\3669\001\251R\326RY\326x\270\272\2625\035a\032jZ3\235\231\376C\266,\262\335\222\232\206\035\020\037 \260\357\022\331\225\312\343\027\330\026\331\263\277\n,"
+	.string	"\217\354\231\204H\247\314`\250Q\217\242\225bo\260\351t\335\366\b\265\302@J5c(Z*\354\033<\n\277g\273\246~De\312\232}\006\177y\374\003\006\205\362\336\243\037\332\036\257\031-\b\030\002\326X>\272\314F\203\341d8\216\rL\207\323|@\234e\302]\207\306\207\363\350\272\017W\261\235\207\253+S\024X\230PR\023T\226=\233\003\220\226,A\005}\356.I\225\345\250\252!0\t\001\036"
+	.ascii	"g\325\253\333\030D\004\2634\"\005+\020\002\006\007?$X\2073\006"
+	.ascii	"\232\300\302Yp\347\005\213OC`\261\2458\003U\026\002\242`\230"
+	.ascii	"+\334\035&\b\316\210E\235\013Lw\032\030\256\275\242pijJp\353"
+	.ascii	"\265e\f"
+	.text
+	.section	.gnu.lto_blackboxStart.part.0.305.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`\374\003\355\030"
+	.string	"\366h\223H\240\226Nc\324\3302Y4\342\220\016\363\317\3171\366\023 \303\b\031\255\222w\252\351\022\202\272\342L\241\356\203\332\022\265\342\366&\200\300\032\377\2454\217\313\243\301\321X/\316\217\007\231\002\336\316\261\340rW\020\033{o)S\nz"
+	.string	"\177"
+	.string	"\202"
+	.string	""
+	.ascii	"\202\367\032\255=\271*J0)\237\370\030>\037zEi\355\350cwU \022"
+	.ascii	"(\030\347\372\371\320.fH?\276\326\267\200>\264M\022!\301\254"
+	.ascii	"{/\020\351\013\203l\026\226\227\307\262\035d+\371\026\324\035"
+	.ascii	"ak+)\340\341\366\030\\A)\352:\336{o/\353\323\355+%\255O"
+	.string	"O`\357\365\\'\260\306\025d\006\360\3504\300\311\224\231{\257UH\334\345m;\260\035c\223 \002We\276\332\263?\304LH\331\201\374\240w\230)\326\203\007Y\314u\214\331\360\305p\\rL\270\341x\030\205\n77Vp0\234\001P\367\336\006\376\327oX\270\200\303\231/m\2761\342iB\210\256\331F\005\334;L\230\177\370\0329\033\324\275B^\247\261\343G\2754\206\034\375\2313yz\350O_\370\025\342T\231Z\221\250\366hur%O\336\332d\253P\223)\324\325\244\246%\365[H,\257KEVE\230\373P\036\30529\331\247\247$\245\264\243\023\026iHO\273Z\213\235\222\361Hc\032i\\\0340\"\241Y)\323?{\023+5e\251\250\314\227\337z\002&D\242\202Yh\264\372K^\344\331*kuke\276,\315\020P\003\267X\246m\205V\213\376\244\265,\032}\224\r\325\236_\250\375"
+	.ascii	"\002%V}\251\025_}#?B\343G9B\r\375Yc\276\244<\316\263\026jK\260"
+	.ascii	"\251\264\2101\326\221\351\240\313\341\321\301e\310\271i\310\341"
+	.ascii	"zn:;\336M\346\305\272\r;\273\033\007\235nwc!om\362\214P\365\271"
+	.ascii	"\326\352d\233\336\376L\323\037\ra\177\"\254\221\221\371\022F"
+	.ascii	"\353\030\024*\361L\177\t\375\300\003Z\253s\235\312\030\276\b"
+	.ascii	"f\241\221\225\350\310R\331\214 Q\037\035\322\rm\t{\"\006\205"
+	.ascii	"\371\222\254g\"#\376\222j\365\317h\317J\245\260T\325\354<[@m"
+	.ascii	"\273dW\320\237\265^\370\007i\250\2018&\231BR2a$I\nc\200\002\221"
+	.ascii	"A\253:\020P\311F\205t \252\"~'\251\034#Ij\254\271\236W\004?\364"
+	.ascii	"\315\263\276\201\237\241{\245\2005O\272\277!\230\211\226d\b4"
+	.ascii	"I\001\372\343\300\231bE\021\220%\f\030J@\034\276\361\277\006"
+	.ascii	"x\235OX\026.\203\360\315\200\037\274\340fh\257\r\236Uk\b\022"
+	.ascii	"\2503\255\222\f'\346n\267\333\351\234\214\321#\306p\244\204X"
+	.ascii	"\235\216\240\310\207w\203O\251\260\244\204\326g\026rP\223\214"
+	.ascii	")\026n\321,\211O\223q\357px\307\263\257\032pt~\250\301\034\337"
+	.ascii	"0\240\224\177u\334\331V\232\254\240d\261\374\360$\220\251\202"
+	.ascii	"\030\347k\307\370\312\327\036\326\300@*t92H\217\342?"
+	.text
+	.section	.gnu.lto_startInTestMode.part.0.307.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`\"\001\245\f"
+	.string	"\266\226RA O\225\016\240&W\f\323B\221\030\315\205\b\022\035o\020\006B\224\304\232V\b#\273\222v\333\351\355\307X;x\213\001\f\212\347\307\027\b\310"
+	.string	"\351\243`\032\244\013\005\204\327j\316\232\206\310&{\247\024:"
+	.string	"?"
+	.string	"D"
+	.string	"\317\260\001q\223\376H\262\267\355\364\036l\223T\016m\025\257\257\345\306\t\0228b\273\333\235N\r\017?e\026\372\245O\311\252\302e\200g\220\312\356:\322\272\351m\027\260\275\300~\030\016q\365\305\222X0\021A\214\355\326\356T\332\3677\236\341sx\203\221\256!\222\\]\226\352\243\017\253\007\021^C\004`O\354W)\306\224\307n\235\234\232\0229u\375"
+	.string	"\3554r\001\332\251G\001\276\247\235\276%\216\350\260\302$?\f\2216\350@\036\345\217\177\252\243\204\212\205\307i\226\344\304\360\314\236\355t\331Y6b\270\020w)|\264\330\f\224\004\207o\274\303\241l/\324\027\3530\024\365Cl!\324\311(\336\200>O\301\007L\220\361\034@\220\321|\226\r\310\031Cy\340]8\030K\203K\347a`\351t\230\017\354(\004\354}4_\007\362\274\257\333l\313O\227+\246y\232\023\343\034\315\017q\021\034\177\203;\236<\3524\035"
+	.string	"\\\tT\323y\262\350\207s\006~u\0234\326g\002\004D\3010W\270.+\004\004!\211\021\"\005\"J\2058\352p)\003.\323'Z"
+	.ascii	"'\004\006\341NQ=t\256\262\351\267s\005\340\304\0039Z\232~B\031"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_inMotorTestMode.part.0.309.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`k\002\025\023"
+	.string	"fb|J\340\322&\035\240\322\206\224u\346\035C*u\345\003}u\242!\250\223\004B!\234\302\023\035,3\315\b\325+i\034[S|\257\304\240\243\366\250\017\211H8\230\241\252g\364\322\t\236E\365i\020K yr\034\r\244\033!{\247\024d"
+	.string	"k"
+	.string	"d"
+	.ascii	"\333\325\222h\374\370\354\356\203\357\036\311\007\234\356u\027"
+	.ascii	"p\272\347\333`$3\347\316N\265$\033"
+	.string	"?%\367\234\372\356]\205MN\\\036l\333\344\344e\330\317\236\331\210\355f\023\304\264{\202\367\252\211\303^i\007\363\251\fg\346\365\271w7Z\217Z\216\034\016\210S\221w!(\273\353/\304\355\3356\003\333\"l\332!:\tn\024\331,\301p\271\325m\316\331\363\3415\035J?L\253\341,\261\321_\304\270Uo6\320\224X\0203\252\t\342\363\363\354\033\346E>\200#\3071/r\006\332\016\237\335EQ\177\310\345\343N\364\234QB. \327\315/\377v\240\013\031\325\342.^\017\302\360\225\355\227\311\206S\332=!|\367\002\320\025?_g\341\030\335\342\002\265\3620\001\2511\243\341\266\352\230V_\306g\204\376\t\213\243\347\217H\262%\032\332d\0057_9\275\322Zy\324\320b\264\311(j\267\254\350e\257\317\375#\206\220R\370P\212\325\031Zy\\\273w\273\273\256;\266\251\353GM?\352\207t\266\037"
+	.string	"h\273\263\246 K\302;Bq\242\037\367\017\375\350\005\306/\001fI\265\\\310\322d\221\"\005\261\004E\003fI\225\243\214j\005\232,+*\227\n\005TX\341jE:\bY\252\021\325UF3\274\2402\305\006%i\222\022F\326\004\263\025\216\021\314\220\200\305\224\f\231\322\"\206.) K\025\256@\261l\201)\004&-\214%h\222d\t\242\336m\335\361s\027\241?\354T+\007\333\265\032\205\246\306\\\0031 \240\242\261\263:\\\276&\031fNPlx\240\353\255Z\214E%\f\036\343\340.p;\221\301\326"
+	.ascii	"%\032\303\300\306\026\204\354\016\303U\274\016\341uy\204\261"
+	.ascii	"lXO&\252\261\371\204\016\f\034\206\360:\325\031Oq\272X\207,\314"
+	.ascii	"\255\256V\261\357\305\211\t\305e\371\330\322\217\205\333\005"
+	.ascii	"#\277\3358\306Vq.\365\360T\247\260=\365Z3\006"
+	.text
+	.section	.gnu.lto_blackboxLogEvent.part.0.310.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`\333\006} "
+	.string	"\266\367\301I\240VN:\206\307\254pHT\006\327"
+	.string	"\272\244\335\003\211o\240\317KH\003\261<\005\224\341\004a\334\336<=\304:c\347\264v9\343#\237\207\374\032\237G?\262V\374\006\223C\376\246\353\213\341\rS\177[3b\211\264-S\n\251"
+	.string	"\227"
+	.string	"\265"
+	.ascii	"\007+\nV\030\264\307\277\316\373@A\023S\223\276X$0O:h\356>Xt"
+	.ascii	"/\242Z\260\376\232\274k\237\307\273\316{\021\371V\253\024\221"
+	.ascii	"\261Z\2038'\235c\236\254\271\200\362d\355\001\312\223\366\271"
+	.ascii	"l\0275\371\264\257<HUi\210\306%\260-\265\326\336Ij\343\347q7"
+	.ascii	"\323V\2225\272\271\323_\246\237\321qW\267\032\023*,\323\306V"
+	.ascii	"\356~K\265\232Zk\356\247\264\244\006\026X\265\013oF!\036\315"
+	.ascii	"\244`<\235:%\305H\201\373!\225\270\241\325\360RMO\345\002x\316"
+	.ascii	"\326\240\326\352\037\311\270u\267=\3046\004\273\364\n\325\350"
+	.ascii	"P>Q9V\037U\211i9j\255<\">\224\37503Xy'O\237\265\245\270\264]"
+	.ascii	"\254[Jk\226Rz\341\013\210\tY\352r\264G\377x\242\362t\251w)\006"
+	.ascii	"\322\036\255[\203\335\303\322\376\001\3323\371\302\277*\313\254"
+	.ascii	"\230D\215\226N\231\346^\253\264\206]\256e\312u\f\271\206!\327"
+	.ascii	";s\375r[\353\310u\316\\\343\314\365\315\2666\313\265\255\\\227"
+	.ascii	"\345\232<\330_#\327\264\266\336\007\377\333,\020AY\255/\216\\"
+	.ascii	"j\024i\004\207\355\333\027\026\331\271\234\351\0064Go\245^By"
+	.ascii	"\2438J\223\246\004eG\270\026\t\n\262\354\020\270\321#\001\n\267"
+	.ascii	"\350\017\f\255\310J:e\022\245I\205\276\250$"
+	.string	"-\232\355\t7#qC\341XvfL\372'\340\017\262\363\264\234H[\205[\251b\2438`N3[Z\370\224\0137b(\251\016\320\307Y\331yZ\277\332\314\222\324\316\240\301\336p)\034t6\317\243\364\334\030k\255\013\240\230\360\361\257N\372(\312\223$\325\271:nu\215\375YhE\243M3\275\207VC*J\247\354'\276\220bU\023\337\311\2002\025D\177\311N\311\214\241\217\344\205,\212I\213\0345\252\362\212\370F|\305\254\001\006\341\013Q\363\301W\343!(B\216g\210\307Cm(\310\307\204\017\351\236\234\023\276\016@=<!:\364\202~xD\364z\204J\364r\b\3307\302G\2507\344\363\t\365r\266\367\264\206\033\034Q$?\354\247\307\343\321\f\247[\004O\322\333\003Y\027'\215\001\306Z\225\316tN\231J\f\f\2346\316\252 Z\303\342\213\347i\035\271\311\334X\246\025'\226\f\305\021#\306"
+	.string	"W\351\304\261)N\254\033c\f\325\001\212)9O\213\313\274Y\030\035\347\216sk\217N\2565\3321`\204\2418aN\273\027\272\353\222\3662\344\314f\263:j\237^\016\036\034\315b\273\263\235\033*\035\305\021\022\273\216r\324\376\001\302\005\200\206\250QX\002\031c#\"AR\220\244\220\341\320\002\021\232Z7\021\300@\347\034\032*)L\332\357\344\376\237O"
+	.ascii	"\016\245\215L\r\236m\273zfIL\224h\026\345\313\307\313J*\236\356"
+	.ascii	"\177\207\360\223\206\006U>I\253-\237\033\030K\032\b>\b\344a\352"
+	.ascii	"\347\211%8\350DbL\020Q\262\013^\005}\2619\316\372\252\302\213"
+	.ascii	"vT[\023i\037\235\256\365$\0019\024\317i\r\231rR\233\3375XO$\252"
+	.ascii	"07\204\304\247\317m~U\027\016\231\306\273i\377\342\334\341\313"
+	.ascii	"\355\245\021\201\003,\037\271\327\201 \235+\207\320\035j\003"
+	.ascii	"\360\356R#\370\035&<\255\311\372\315bf|(3\267\244,y\331\001\255"
+	.ascii	"t\267\203\226\331\222\0310Z\274\300[R\366\264\2510)\360\255\t"
+	.ascii	"\330-\304\320-\024+LX4\253i\200[\021p\250\337t\262a\245\244\302"
+	.ascii	"#\344\266\233\247\360\013\033\202\324\245\teE\210\330\3140\247"
+	.ascii	"\356\231\261\250"
+	.text
+	.section	.gnu.lto_blackboxFinish.part.0.313.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`9\001\325\f"
+	.string	"f\025N@0K&\035\340-y\266\207\342\006?\\\327q\313\017\367dQ$\372[>\002\301\337\026/\212\264B\004\250[^\351G\023\205\244+#\"\201\fJX/\374\200\252\2425\263\325\2252~\262\311\336)\0059"
+	.string	"<"
+	.string	"="
+	.ascii	"_\331\356\210\354\261A\274\246\026c\305AAl\304\356z\247\363\301"
+	.ascii	"=\237\222\363\370\255K\007\266\317\347\353/F"
+	.string	"\330\007\331\210\301%\3059\207dw\375hp\323\333\226\330\006`\277\006TCD\007\017\037y\223\023\345\311\235\333y\2629\351w\334\2526Q\332]0\332\326D7@\360'\034\266\271\313\237\251J\244\215\377z\345\334\3459\232\261J\254\335\345H\277\325\261!\220\323\2474\302(\201\364\371j\360\027*\026\325\003.\263T\244v7@\205[\270\370\252ScBy1\354N\347M\f\001\222\243\035\322\257\032\004\362\342\347\353%P\243\250F\013\315O\354a\332\215\007\006#\tB\312\005\374\bP\274\002\226\017\343\201\031\215\027\311ph\240\222\361\016\204a\306\203\330\226\347v\236\334\372\203\302KT\243\201fH\203\024-\231\023\345I\347cx\206\211\257\262\200O^\374\272* p\202\231D\323\003\347\327C\316\030\204\235o\234\333\254\332\321\nr\315H\026rX\274\013#\013$\026\3448\302\001\201\223\230Q9#\310!\277\003T\r"
+	.ascii	"\331\353\312&\022\255a>\034\\\013\234i\274A\220$\321\323H\366"
+	.ascii	"KcC\022\013\347t\013\355\2245\003\240\366J\324\332\240m\351\t"
+	.ascii	"o\f"
+	.text
+	.section	.gnu.lto_stopInTestMode.part.0.314.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`F"
+	.string	"\025\b"
+	.string	"\222\31646@\217\322\001\270&`\3320\212\005\343D\020\340\202\366?\236\224\311L\236\351\202\372?\362\241\031+?\034\2238F\307\360x\016\34510\236:\331\007\2321\310\336R\246\024\306.\025Y\346\001\303@d\242\204\003&\"b\332&^\020\234M4h\221\"\313\264x\331\316\277U\222\031N#*\324GAV\325\2225\226oz\211\306\017\361\206\223\347\016}\216ux\321(%\305\362\311\225_\332\026\027y\316\004'\247U\241@\352I-Y\337\337*\311~\257\003)\030\355f\254Z\266\003\242\210\330\357:\366u\035\236\304vG\303\233\275r\323\307\036t\034\030&\251\335\215\207\352\361\355\232o\363\337]\200\013y\256\003\241\215\247\301\037\300\302\356:@t\303\333V\260\235`[%\022"
+	.ascii	"g\325\003\233\300x\360_\f18\004\b\210\202a\256p\030&.\316\210"
+	.ascii	"E\235\323i\241\315\224\235\006\200k/\246\234\226\323\257-c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`(\027\255F"
+	.ascii	"\272m\214\027Fp\\N:\235\251\021hQFL\205\243IX+\207\242\235a\300"
+	.ascii	"\244jQ$H\025\006l\340\002\337\274\213\326\332\037J\213;A\003"
+	.ascii	"\342@\311\332\340\354\373`\036d\025\353\203\230n\325iZ\305\220"
+	.ascii	"I@B\263U\356$\003^\001f\001c\001LWS\315#\2277\243|\031\336\335"
+	.ascii	"\311\330]N\335\305\320\331k\345\261\007\253x\354\277\356\330"
+	.ascii	"/)q%v\354\275\352\330\237\225\316\323\346n\344\311\241\361\365"
+	.ascii	"9\366Xr\354\257\344\354\207\304\261\225,\317\341\330\007yc\377"
+	.ascii	"\243\006M27\3666\222\266B\251\313\267\261\347bc\177\244\256\261"
+	.ascii	"7R\325\330:\226\346jhlmR\323\013\271gl\025\253H{\253j\206\357"
+	.ascii	"|\340<e\030\017\217\314\245\214\306\330\n&\206\357za\354\211"
+	.ascii	"`\0164\372b\353TM#f\205\345^\354y\324\270\n\005Wit\251\302c\235"
+	.ascii	"\301\245\006\267T\240\226jfy\212\345h\336\276\274r%\317\355w"
+	.ascii	"m\366Yl\017Z\261\367Q\34538\034j\315\276\252\336x<\036\036E\315"
+	.ascii	"\276G\332/\017}\r*\007\303+^8\345khl\307hg\366Tf\377\302\223"
+	.ascii	"r&Qx\016\257\214\351.@]\241:\231\375\020\312\347xO\354\213T'"
+	.ascii	"\366D\306\036ea\213N\356M\354wT&\\g\240\313\r\236\213\331\347"
+	.ascii	"\250a\237\302c\340\3018\371ut\311\251x\335L\311\213\275\\.\341"
+	.ascii	"\336e\217\243r\361\222x\363IX\311k\346_\263\303i\030}\253\332"
+	.ascii	"\3401s\317\f\006M(\314\226\371\212\216\367"
+	.string	"\230\246i\036\211}\222\312\314\t\216\002\301\241.\272gdT\227,V\016\365\202\363\225\354\314\254L\301\375\257\210\220\271\002\272\357I\001\342\343\300\241\366\231C\355s\037`MW\330g\fu\320\005:\177P\237O*\324\275\264w\377-:9,\274\024\022\352\237Lw\004\372\350=\246\222@\033\341\204T|\027\324\032\336m\266\360\210\352\r\350\002iPz\001K76\256\353\365\317\365\241t\275f\272\004\260\2534\266\3535\232\375\333\231=\0263\373,R\354\271D\261?\226\331o!\263\357\002\305\036\356\211\375\031'\366c\306l\275\321\304~\214\211=\0351{\2660\373&`\366N\276\354\313\226\330\223y\331?Qbk\215.[\243\270l\225\"\332\207Ib\017e\313\326\213\304\376\316\021{;#\366yN{:-\373\272\241}\235,{;E\354\343\210\330\273a\331{\271\262\3272\304\336\212\020\373*A\354\333\254\354\245"
+	.ascii	"\261G\273i\232\314E?\354\317\356\203{`\250\312Py\260\033\036"
+	.ascii	"\363\013'\026O'L\354`8<\346\020,B0\261 \361D\302\t\204\211\025"
+	.ascii	"\024\370WX\251X\216Wu\330\213\325)\373\260j\202\35541\235\025"
+	.ascii	"\\\347\211\347x5\007\313\301\361+<3\365\206}W\265\3619R\227\213"
+	.ascii	"z\234\032\207\003\36574\236\024>\315}\233\031w\023<\033\340\327"
+	.ascii	"\004N\276\020`#s\221\362d\213\317:6\266/\370C&\261q\002V\230"
+	.ascii	"*\244\241Z0\rI\304F8\341\024X\022\033YN\020\340\020$6v\017yN"
+	.ascii	"\003DY\305(\253I\261Z\367\212\3473sv]\214rZ\377rZ\037\375\336"
+	.ascii	"^\352s\376\334\037\364>N\240\364\023\216D.|\307h\007\241\227"
+	.ascii	"\227\350\203\214\266Pz>\022"
+	.string	"\217[\254d\264\007\027\373\301\022\243u/\370\323e-\327\224\226\372\367UK}D\245\324?o(\365\221\357\031\240\324\275\373\035J\347\241\324>\244Y\301B\313\270.\220.N\273_\273h\021\274\0034_TA\277~\n\006\375\332)}\216\251_\013\235g4_:\304~\242~\375\343C\205\277\366\235:~\355\203\336\375\232\211\225\277F\200\332Hj\004\367FR\027\270l\227\324>\347q$\265O\361\025\002R?\275\024R\277\370\341\201FH\355\213\202\320G\231 @\350\036J\303\250{\367PF5\214\332\tMq\337h\246\t\344;\"F\263#\352\246[\002\035q\212(jp\025\244\b\320\003\367\006\246\274\244\202R\240K\324\276\364K^RX|G\324=\264w/$\352\243\277g4\242\336pF#j\024\350/W\006\252\351<\317K\232\262\004p\250G\234\347\265,I\334\2108\377\25260u\036<\247\277d\370"
+	.string	"VV\276p\233W\360"
+	.ascii	"\324\266\356\330\215+\3706\344\310\275\317\b'\374\225\026z\037"
+	.ascii	"\341\224\327\261\320\017\211p\262mP\006\362\021\210G\256\030"
+	.ascii	"\347\r\020\217\\0\206\0268\3513r\262[\024\337\223%\314b\224\223"
+	.ascii	"\355t\213p\262S\234XH\216\343d\243@\233L\224\030!\"X\264\200"
+	.ascii	"\353\212C\234l\005'\217\361Q\346\013+9\331@\327\344d\377\\_\232"
+	.ascii	"\305\311\366\351q\374\220\223\335\013.q\022H\n+\314\2658\331"
+	.ascii	"ML\211H\216h\365p\251\254\243\273cgnN\234\233<\325\244i\316 "
+	.ascii	"\317\314\312N\262;\226\212\241a\347\222\313\225\022Q$\347\221"
+	.ascii	"[\207\351\022U\236u\367Nj\007\235;\343\334d\252\006=s\236]\262"
+	.ascii	"t\f\r;\275.\022\255the\304\200\221\272H[\244ON*T\334\263\034"
+	.ascii	"V\031\212\246\021\350?\266\254R\324 \r\"\204\343z\301U\200\340"
+	.ascii	"\036\270E\206\343\270.p\2558\256\203P\240\373\343\353!\242T\036"
+	.ascii	"$5qp\\\337\212\341\332\300\354\266\030e-\355C\337\203\337\332"
+	.ascii	"7<\203'T\200p\221\337\372\210\353\370\255E\264\361\225c1\253"
+	.ascii	"\001d4vc8\341\324\327\201\260\033\263q\333\221x\354\3425f\353"
+	.ascii	"\007\177\342\221\330\205Qf\353\rk-\364\203\215-\024\374\257\b"
+	.ascii	"\234\263\242\020\033\373g\370\005r\001\201\302\250a,J-\033\021"
+	.ascii	"\221$\005I\206\003\021\006\204)g\304m\021\220 \312\230Q\016\211"
+	.ascii	"H\022I\222\016"
+	.string	"\321q\277\241\021\0016u0\306Q\201\320\234/\021\232\262\202x\fR(f\232\232\2459S(\362\017\327L\272\fx\315\351\201\225\326`\321[\324q1\016\\\354\347\033\037\360<\001Z\006P\316wyO\272\361\212\304\330\371k\240\300O\034\224\b\320\215\003\246\025\303\001\240\007\242\007\242\007\242\207\300\372H\301i\201\350!\260>\022\027\315B\345\221\bxh\026*\217\304E\263Py$.\232\305\00400[\354\037\311\272\240`\003\024dR\024`\032\346\317\351\336 \215\030\205\263`\231\271\370\215r\241Qp\303\25489\340w\313\2655\263\004\271\031w\366Yb\004#\233e\200\344\213\022>\353\024s\364\204'\220@\345\201\370\326\3351\247\315K]\222\340\253i<\006\210D48\007\331R{B\217\200l\352X\217\310\233\316B\tCg\006C@M9y\225\345\373A \030\206kc\227\257\026\204\004\204wqP\032\277"
+	.ascii	"\003\035\tqba\270G\247\\\316\277\016y\233iJ\343\017\246\300\204"
+	.ascii	"\031^\236\316V\234[\005\347\231J[\367\025\003\230\351go\333\322"
+	.ascii	"\376\316\247X$/\026<\254\327\213\252\225UI\213\253\366\035\364"
+	.ascii	"h4O1\302\301\271\371Y\373\267\276\344u\252\353~~k\237i\227Q\306"
+	.ascii	"\236/\254n\247\033g\203\202\200g\013\213\255\301\213\235\254"
+	.ascii	"\033;\230\021b\331\330\214\1777\377\016\314\362\303\354\375\266"
+	.ascii	"\224\016\366\260\304\373\264\377\213\330B\202\257W\305\212H\241"
+	.ascii	"gc\037n\327\363\373\367\364oh\033\374Le\177\272\266\364?\317"
+	.ascii	"\355\373Ee-|\346\272CWb\t\205\200\204B@B! \241\020\220P\b"
+	.string	"H(\004$\024\002\022\n\001\t\205\200\204B@B! \241\020\220L\005\231\252/\251\256\375$\200\255\223f\374k%\007\373\204\262\256\222N\257\264I6\237\2650\204p8(\363<\330\270q4\341\3566\312((\f\002\027\344\321\005+\250\240\317\250R\033\306\201ol\247\341\232\256\243BK\340\213\332"
+	.ascii	"d<Y\2036\230[\342w\220G\2148X\210\002-\204\211\276xmD\3376Y\366"
+	.ascii	"Zm\317\342\354\374[\327ebf;\373E\331?\365\373\302\313\202\377"
+	.ascii	"b\210\244Xc\333V\240\236\013'\371LP\360%z|\204\0306\301\3337"
+	.ascii	"\020\330\371p`\225\317M#\003\367\237\223L\313\277E\212\203\240"
+	.ascii	"0\b\n\fM\376\233\001\2163ET\340\207Gh\020\247\213\347\212\210"
+	.ascii	"\2773]\216\356\300)\220\264\0065<\005\303Z\323~i\351\031\275"
+	.ascii	"RL#DB\016\226\037\023\347\246Q\220T\370\023\361<\013| G/\350"
+	.ascii	"1Wq\006\311\310\204\305\243B<N'{W\001"
+	.text
+	.section	.gnu.lto_.refs.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`V\006%\""
+	.string	"ZS\020\016D\240\036'\303\001\034\322\270O\277\250K\262\0136\204\215K\r\260^\217\302\322LI\321\224\2540.\300\263\024\306\313\221\255+\203\\/\372\265\311\276\317\361\017\237\020\333\1773D\373\205}\344\331\202\254\255m#d\313\024\276"
+	.string	"\317"
+	.string	"\336"
+	.ascii	"_F\374\277\204F\377\222\360\227\n\177\027\376\202\360\r\204\317"
+	.ascii	"\024~R\321"
+	.string	"\037\205o\263=\200\360\275\032\321|/]\270h\301B\353[\241\375Q\346\017e\366\235\314\037\347G\r\365\007C\277\243u\035\355\235\3467\205\217\033\352\267\331\213\346\333h\235\210\3663\241\007\232\017\n=l\276k\036T;\200\354H\263?\222\0357\373\233\354F\263\257\315\2366\373\240\331\377\310\027g/\223\3573{\330\354Y\342\313p q\230\354/\331[\355?\255?\361=\361+\016\300\373\025\366V\370\r+\363~\362y&\360s\340\033\305\236\b\366B\260\227\275\336\345\272\365Z\306z\330\367.\357Y\362\277\276\224\337\276\353]\037\002\317\202\352\022j\n\336\336S\235\320\345R\225\320]c\367\300^\360\b\336Ac\237\341:PT\377Az\021\252\207^\367aup\327c\265\016\203\320[E\375\273\311?\261{7\271'vy\223K)\037\314\006\362\372\017\253\003`}\270\353\340\367\260]w\355\276U\353_\355=\245:"
+	.string	"\177y\235\245{\317\353\365n\360\335\026\270^\026b\357\n=7\371y\360\334\261\343F\215\231\360c\342\267\304\377D\006@3X\360\n\024<\202\004/"
+	.ascii	"\301\343\016<\221\201\237=\275\350\364>\005\036F\340[M\3571\r"
+	.ascii	"\220\035\313uWN\316\312\311\345\322Wi\001\254\177\224\272,\367"
+	.ascii	"\261\334\273r\377\345^\346Nj\355\005\370\"}$\237\r\256\177eu"
+	.ascii	"\346&\337L\225\330\3133\247yIf4/\251\264|\346\245\025*Q\2360"
+	.ascii	"\2312\"\211\f\331\314\313 @|\364\340\221\343\006\r\030-^/Q\340"
+	.ascii	"\241\363\306\n\r\025\227)L\212\b\371\321CG\215\327WF\214\027"
+	.ascii	"-\232B\217\2359o\256\256\272\3522\377\230\311\374T\005\266<\346"
+	.ascii	"\317R\245\350\227\002\305\t\354o2\373I\026\023\345\364\tl\377"
+	.ascii	"d\373&\360\003|\177\244\373\242\357k\207\221\017}E>\247\372\240"
+	.ascii	"\301\374\317_^\334\313\203\363aw\371o._\243G\f\346\330\367.\360"
+	.ascii	"\275\357\253[\304w\277C\364~E\202\370\320gO}k*\377\331\336{\312"
+	.ascii	"\036\276\016]j\016rC5d\220w\034C\377f/\310or\233\034\222>\340"
+	.ascii	"\307\274\367\300\357n\013\261_\343\267\242:\013\351\275\250o"
+	.ascii	"\224\274H\262Bk\327\030/GNG\202\362\204w\322R?\372\0367v\243"
+	.ascii	"\261\327\300'\322u!]\007\372"
+	.string	"^\324\365\020|\331\327c_\177}\275U\340YJ\375\363\272\307\352r\327[\253\211Y\tyw\344\3001~m\200K\365\322\350\214\261\367\3058\377=\270:K\375q \374l\256\254\320\214\177U\355'\263\003\243\324\377\262\364_\031\373Vf\247\374F~\024(Of\233\354F\276\222qj\366#\267\221G\215\035jv\b\263\357\306\356`v\335l\202\331\310\r\214\375iv\247\331\233\230\346/}\365\002\346'\315\2164\037G\353F\264\237\363\177\306.\316\036\316.\243\365o\253I\214d\017\307\354\336\215\371\236\215\327\2747\303\203\341B\305\036\333\313;t\340\260\211\275\\\263\232\003t\250Axe\004S4\201\004#QA\222\246\r\320\"\233\031\312\003\021\300\272M\266\346D\211~EP\220\305\242.@\022V$\203(\030\017\034Fz%\207'\255W\361b\021\220\240\365\001|\227\244(\300Y\034\205B+\314\206\021\2400\266"
+	.string	"\351xoWk\366\277\007\2045s\272\227\250\203\225\354\351!\345m\303Q\n\207 \353\220%\207xH\t\331$3\001\353\234\355\325\371_.\026\003\252A\006q\\f\003x\267\273PQ\007)\242\260\202\">=\314sR~l\030\320+7\374"
+	.ascii	"H4\350[.\272\321\300\"\227\224\360`R,c\231k\303\203\003q@\354"
+	.ascii	"uI\\}\3254rK\265\032"
+	.text
+	.section	.gnu.lto_.decls.a12f4ea209d8e9ed,"e",@progbits
+	.string	"(\265/\375`\214\334=\200\003\036\216E\177\023S\020(\205\3514\006\244\350\222#{\321#\356\232\362dS\331\363\f\020\263\353\376\201\366P\213\217d\263u\314U\365\374Z\360\252m\025\204\250\204\\]:\215\002"
+	.string	""
+	.ascii	"\034Q|\266\331a\016\247\001\354\250/\003\026A(\202\201\321\247"
+	.ascii	"v\211\210\210\020\271\367\226[\312\024\317\020\244\023>\0249"
+	.ascii	"j\356\206ul]TwiV*#=\304\262FS\344\022\203r%\353\027\253v\nF\206"
+	.ascii	"\313\214X\301ZcE,\232~\271\341\275\2448\254\262\264(\0260\035"
+	.ascii	".\\~WR)\351\363J\n#a\321\271\264\313\331\222\250\226tK\nmJa\304"
+	.ascii	"\353O\313\244o\351\231\324.\r\223\312\245`R\270\324L:&%\223\322"
+	.ascii	"\245qi]*\006C\323\271\264\355\251\227\364K\n6\227N9\253\022}"
+	.ascii	"\337gJ\345\354,\235K\331\322-\305\242\013\357k\244\013\313o."
+	.ascii	"MK\327\316\242`\275\357;\227VI\321\312\230a\245`siX*\005\313"
+	.ascii	"]\275\006\370r\004\307\245\336\020\022K\273@\277\bd\263T\230"
+	.ascii	"\303\372<\254a}1i\277X\264O\354\333'F\267\374i\026\f\007\227"
+	.ascii	"\345\341\22574vd}b\335\036\276\355\023\267\354\023\321\366\237"
+	.ascii	"\252=]K\307p\021G\031\227\217\254\363\224\316S\265\020\220\b"
+	.ascii	"\361\312\372D\262}\242\030\332\217\315R\263\264\367}'0\352\t"
+	.ascii	"\231\325e}\"\327\306/\346\260\376\n\326\260\236\250d\237(\265"
+	.ascii	"O\334\261\377T\354\251\224\247c\230\352}\213\236\266@\263d\235"
+	.ascii	"FI\237\030\332!\205\342]\0219e}\342\215-\202\367\305\035V\374"
+	.ascii	"\367\207;\254xN\347\251Xz\205\013\2157Y\237x\264/\227z} \272"
+	.ascii	"\251#\342J\273\322'c\306`\265e}L\207e%\232>I\263\360\036\226"
+	.ascii	"\273\022\001l-\352$\335J\271R(\030\232>I\233<\325\302k\236\311"
+	.ascii	"\226x\321I\237\244L\204\310H\361\275\357s\235\253\261\305+\250"
+	.ascii	"W.\373\303\265\375!\225\375a\327\376p\311\376S%\303\035;v\be"
+	.ascii	"m\266g\244\204\005'-\222\022\245F)\264iS\221\342\027}\337\247"
+	.ascii	"N\r\276t\210\356\r\336\230\036)\217\324*\r\222\352H\251\322\253"
+	.ascii	"\264*\375\221\366H\207\244IR\")\216tG*$\005\222J\245P\251\221"
+	.ascii	"\024I\032\225N\245G\322\034\251\017\fM\213\244MO\235\322\247"
+	.ascii	"k5|Cl\230\265Yz\203\024\315IwRQ$6PQ5@r\322\032\037:)\222\233"
+	.ascii	"\034'\016\0266\313p\376\260R\032G}yLi\221T)eJ\237X\300#\253\273"
+	.ascii	"\350\373\276fz7\242\251P\372\302\311i\306L\345>\277!I\321\264"
+	.ascii	"H\216\226\375\210\2466\324`\263\264Hv\203%\310\\\036\337\373"
+	.ascii	">u\227$[f\035\350,\2079\254\007`\332\177z\343)\223\332\006X\255"
+	.ascii	"\277\033xY\247K:OoX\240\306\206%k\026kX?L\332\027\356\355\013"
+	.ascii	"\355\366\3150\207\365B0\373B\265\375\266\017i\321\323\b\254c"
+	.ascii	"\003\304,\353\013\311\366\205^\373\302\252}\241P\376\323;\300"
+	.ascii	"\fY\222\365\203n\366\203r\373\301\265\375`\223\375\340\220\375"
+	.ascii	"\001sX\037\364\261\037\274\261\037D\332\007\376\355\003\333\354"
+	.ascii	"\003\353\366\201k\373\300'\373@\253}`\215\375\035g\177\343\355"
+	.ascii	"\35794[\316\320\205q\272#\312\372\270\017\013\022'\"P|obQ\262"
+	.ascii	".\331\013\032\2300\267\020\274\242\350\320\345,x\2578\364|\233"
+	.ascii	"\330\2630D\240\370\220\256`8,\007\025B\223/\321\271\034&\213"
+	.ascii	"\311"
+	.string	"f\362\230,\227\355r\\\256\313e2\031\f\315t\031\316\2035\254VL\337W\352\r\313\314\nVc\221d\021\201\342\323\241\313Z2\027,g\206\"O-J\225\351\362\2272BD\240\270\326\274\243 {9\372{k\177\007\331\3377\366\331\275}\026LZn#\312\361(\203\226\365Y\263}\326If\303KyC\236d}\226joa\227\366W8\373\253\232\375\365\313\376\032\266\277.\331\177VKS\245|\361\032\312:\247U\311hQ\356\200\324\310\372\317hy\f/)a\245\311\372X\215\323\021\254'#Yii\211_\036:\213\372\031\211a\345\244\314\224$\272\006\317K\223\374\314RrWf\222\241\344'9I\306\312N\362\224\314\225\243\344\262\274$oehV\222\251\344\254L\226\277\362Y6\313a\331+\203e\261\254\205\241y,\033y>\222\221\\g\244?'\325\340\302R\363c;\034\375\022\365\313EQ\314v"
+	.string	"\311I\031\307\025VN\312:\244rR\023\222\234\224sL\221\375\330\016\263i\213\256!2\263\303n\326\260\372\360\0335\277,\204\206\375\216\274\242c\271G\276J\237X)\210~D\363\030.\203\357Rh\323^#r\213\302\271\241$\372\367c\277\374\342\275\342\320\205\267\210\250\n\326\373>\355\370\254x\360c?\032_X}\177N\032\3136\260Z\372\304b\251X1\211\276\357\363\030\316\217\375\236\307p\034\274\227>\257\354#)i\321\367}\202\310\001\361\243F\n\222\020\264\226\303\034\326\247a\r\353\327 \373\317?\236\257\376\314#C\345\"\033\230 [\261!\302\2225\221\034\240W\031-]Y\177\365\261\357A\024\335\215l\225\207\344*\f\315B\262\324\363T\246:\246\013B\307\204\225\205d Bk:\310\272\202\367\304\367\276O\0209 @"
+	.ascii	"\353\206\204\301\333\372\352\337\316\301\034\326\224o_m\263\257"
+	.ascii	"\346\355\354C\347\371\207\260(\007\332\222\254\201\321\215\243"
+	.ascii	"\230\303j\001\326\260^\035\263\257\266\355\253g\373\352\223}"
+	.ascii	"U\310\276\252\264\257\276\373z\315\276\006\263\257\323\366\355"
+	.ascii	"\300\3665\222}\001\326\260\236\017sX\257y\354\247q\366S2\373"
+	.ascii	"i\226\3754\312~\212d?\355\261\237\326\330\277\342f_\316n\217"
+	.ascii	"\300\032\326G\255\354g\262\215\363\260\036\206j\200\333\250C"
+	.ascii	"\317\367\371\276OcF\002\347LJ\326\317_\373X\2035\375\373\303"
+	.ascii	"\032\254\317L\366\263\217=\002sX\237il\023\230\303\212\323\b"
+	.ascii	"\343\322\350nd}\314fc3\370\f\206b4\327cT/\331\373>\211\351\320"
+	.ascii	"\0160V\262>\376\260\032?\254\307b\366\237d\352\204\3701Me\375"
+	.ascii	"\037\217\301b0\024\327\3410\307s\230\356\370\371\276\317\367"
+	.ascii	"}\357\201\033\206+\n=_\246\325\212\353F\023\276\367}\276\304"
+	.ascii	"\257S\207\345\260\032\226\203zS:&7\232p\275\3573\007\004\b\366"
+	.ascii	"\313\316\311\221U_\300\034\326\2145\254\307_\3738kc\270\214\301"
+	.ascii	"\340\270c8\374v\022\036|X\204\341\364\373\016a,\200\"\306\002"
+	.ascii	"P\331\224\fIY\3651\222}\314c\377\370K\005\306\347\216%!^:\260"
+	.ascii	"P\260L\021i\323`\027i\251\002\326e\213\020\312\2306(Y\277\204"
+	.ascii	"\025<\245Xt\341-:;\203\365\276\357K\374\330\354'\341\001\336"
+	.ascii	"\202\317\260ZQ\350\302KT&\r\326\373>\377c6\254\005s\301P\274"
+	.ascii	"\005_9\306\202\263\\?\337\267\350}\337c\260_g\013^\303SRh\323"
+	.ascii	"[$e\213\002\204\366\250@\341{\337\027\004\210\034\020+\016\261"
+	.ascii	"\272$[c*\314a\335\2005\254\247\300\376\n\373%l\214\206\253`h"
+	.ascii	"\0058\355$<x*4\366\202\275\357\323H\214\323\025\307/\353/`\037"
+	.ascii	"W\260\342?\\\301z\022\373\002\326\260\376\230\312\224\024I\211"
+	.ascii	"\3525{\337'\006\025j\324\270\313\372\307a\307SpY\246z'\0202\331"
+	.ascii	"\301v\2275\026\303Q0\364lx\354X\n&;\260\350"
+	.ascii	"\371\222\275\357k\304F\272\b\031\311\372\002\314a\325X\303z\020"
+	.ascii	"\373\370\371\fU\257\007\317[\306\373\276/>\333\312\376\375\375"
+	.ascii	"\375\341\263\255$t\216\303~\374\205\3014\254MP\317\327\354}_"
+	.ascii	"\343\312\265%\210\233\254\377\304\034\326\2155\254)\020\016\034"
+	.ascii	"\\\304:U\2754\377:$e\372S\245\364\2075\376\354\205\177\247\177"
+	.ascii	"\n\364\247\313\224\371\247M\177\352L=\360\247K\177\n\202\324"
+	.ascii	")\305\241\202\366\300G\374B/\352\\\220\235\317\306\371Y\276\270"
+	.ascii	"\203\021F\371\017FM\001,\236\332\246\245\243\324,\270\210\214"
+	.ascii	"\332\323\006M\232\365\357,\232\237\335\001\243\256)\340\027\002"
+	.ascii	"1S\313\204K\277\272\304\314\005.:\263\246\0302\345<mh\203\205"
+	.ascii	"Y\316Z\302\323\206\005p1\f\300\323\177\310aU\207B\265\rk\261"
+	.ascii	"\006\030\361\263:?[Fu\313\005Pc\260tvi\322\237\326`\323_7\221"
+	.ascii	"\371\325#,\007\377\272\241\f\2337_\215\206\376\254A\316@\245"
+	.ascii	"\200\255\253\340_I`\307\260\036\374\354\007?+\346\317\027\310"
+	.ascii	"X\023\252\032\013\302\323r\234g\240\201\207T\351W\317\300Y\031"
+	.ascii	"\360\177\306?\f\301\317f\370q\234\262oAA]A\275c\212\301\322\375"
+	.ascii	"\352\003X\016\250\027\270\230\373Y\271\237\205\303\373\377\301"
+	.ascii	"/\0343e\005\366x\t~\241\215_u\261\302\3312@\341?\230`\217\267"
+	.ascii	"_\177 \235"
+	.string	"\361\257nQ\032\212\335IAp\n~a\030\326\355\327\037\030A\226\365\313\237\266Cw`~\325L\332\236\021v\371\265\317\032\302\317z\371\323%\177\236\300\237\037\360g\024\376\274\302\237+\360\263m?\306\361\343\034?.\362c\037\272]A\370\331.\277\276\300\257\232\370Y.\277F\341W\031\300\262\375\332\304\257?X;\370\331-\177\032\346O\335\376\324\313\237\306\375\351\334\237\212\371\323/\277\026\376\032\270\222\370Y-?>\361c\020\260\210\037w\200K\370\331,\030\001?f\300\317b\301(\260\t?\036\361\343\023~\034\302\217\023\360\343\005`\005\3748\305\217\005\360c\f\3227?{%\215\363\247~\177\352\346O\377\376\264\357O\333\374)\337\237\356\375k\210\177\025\361\257#~\326J\231_5\301\256\375i\227_\375\200U\373\263\233\216\375)t\315\340g\323p\317\217\333\037\303H\273V\f~\266\312\237\206\245\031R\002\374i"
+	.string	"\330\f~V\203\237E\373\263\213?S"
+	.string	"?\301\360\257\031~\366\354_\213f\277j\246\262`\251\260\375\272\355g\247\374l\331z\301\277Z\260zX)\370Y\262\237\035\300\317J\3715\032\001~v\f\027\245H\376\234\301\232\363\263P\tT\036-\262\005\027x\256%\374\354\004\326\ry\377\320"
+	.string	"?\333\225;\370Y\256\354\301\317B\371\327!\377J\344g\237d\022\177F@\316\240F\220\265\352g\235\374k\324\277\002a\267\376\025\312\277r\375\254\326\257V\360\253Gl\223?s\3703\206?O`\364\tt\013\253\217l\301\005N\306N`}r\225\210\204_\310\252Ol\307\036\323\f\374\352\0076k\205\373\327\270\237\305\n\363\257s?\313$-\221v\200\301\244:\251\210tD\272\301\257f\300.I\013\360\253\030\260J\260\0306\311\277\232\371Y$\177\216\361\253\003`\217\374x\016\303\235,33\220\207_@\207\340,~!\362\177\226\377[\376,\374\363\372g\214\343\274\f\377\251\177N\377\274\377\247\2513~\326H\006it\b\036\342\017\252\371\317\366k%\366\352e\237\342\342\027\376 \031V\370\263\303\237-\242\306\245%\3765g\t\244S\034\234%\302\246\340B\235\203\263\340\027\206\375\351N\201`\316\376B?/,"
+	.string	"~=5$\027\200\025\362\253m\302\2546f\364\007X\367\314\213\277\360\314\237\356\024\250>\200\003\007\303:\277\341\027\376\200\362\347\f\356\341\373\027\352\375\351N\201\253\033\313\374U!\277Nb\227'c\177\376\273P\223p\370\205\025X\311\324\007\374\353\224\237\345\300\212\366\257U~V\231YP\211\260=,\017\273\263R\311>\357\360\013\037\220\236\220\227\231\347\317;\271\3753\214\377iY\231Y\310>\007s\017X\313+\370\205\020\300gK6\371\257h0t]c_\254y\253\336\317\"\3510\232\273H_\034\305/4\302\320\234["
+	.ascii	"\247qq\343\037\214S\245\324\037\354\006~\034\207\3370\230\037"
+	.ascii	"\227\371\261\230\037\333\375\330\314\217\335~<\366c2?\226\373"
+	.ascii	"\337\206=\376\231\002\001`5\260\202\261\031\370q\335z\343_\231"
+	.ascii	"~\026\003x\016\303\375+\224\275\300\217\307\374X\313\217\351"
+	.ascii	"\326\035\377\312\343g-\340\264>\375+\216\237\255\300\217\327"
+	.ascii	"\374j\007n\201\377\027\370\357\201\245\300st\013y\311N\200\215"
+	.ascii	"\300\2572\t\003\360\253\023`[\374\270\210e\361_\0030=\377\205"
+	.ascii	"\177\020K\216\363\004\004\033\002\326\361\342g!\360\343\343\317"
+	.ascii	"\256\3701\317\317\256\360\253:\254\n\377j\364\343\"6\205\037"
+	.ascii	"\017\340\177\332\2173\3701\211\037k\240j\200N\275\300\257b\340"
+	.ascii	"gQ\370\327\032\377j\343g\037\360\f~\334\342\307\017\270\006\377"
+	.ascii	"=\250\024 \361\007\263~u\003\326\001\177\332\376*\237p\r\253"
+	.ascii	"\342\327O\366\204_\027Iq\f?P\213\226\373\365\334\257\341~M\367"
+	.ascii	"\353\270_\223\t\342_\367\231\360k0\215\367\353\274_G\177\255"
+	.ascii	"\367\3535l\t\317\360\003\367X\024C\354\211_\037\211\360\353\242"
+	.ascii	"\237%\341\327f?\313\200_C\177\225\370\253\031~\365\302\257\016"
+	.ascii	"\177\025\303\257\026\177U\303\257\032\177u\202\237\035\341O\255"
+	.ascii	"\376S\360\007K\374\352\321\317\212\360\353\242\237m\300\257\251"
+	.ascii	"\374,\003~\r\375\331\005\374\332\352?\360\027b\370W\022\376\343"
+	.ascii	"\177x\364\343\255\037k\375\030\312\217\237\374k\213\377\352?"
+	.ascii	"4\362\257\316\177\215\361\257A\377\332\374W\240\177u\377U\306"
+	.ascii	"\257\356\374\353\007~6\204\177\325\300\2772\377\365\347_]\374"
+	.ascii	"\254\002\376\033\377!\233\237\005\341gM\374\354\007?[\342gu~"
+	.ascii	"\226\203\237\335\340g\r\360\263\032\374,\001~\326\202\237\365"
+	.ascii	"\360\263\031~\366\302\317\016\177\026\370\263\354\317\352\237"
+	.ascii	"\375\277\352\375\353\335\277\242\371W3\377:\367\257q\377\372"
+	.ascii	"\366\257V\376\265\312\277N\371W\262\177\035\373\327\260\177\345"
+	.ascii	"\372W\"\377Z\365\257R\377\312\343_q\374+\323\277\332\370W\244"
+	.ascii	"\177\245\361\257C\377\372\376\253\b\376\365\003\377:\343_]\374"
+	.ascii	"k\212\177-\341_O\374\253\b\377\312\200\177\r\341_A\370W\023\377"
+	.ascii	"\372\301\277v\360\257$\376u\304\277\202\370\327\017\377\232\301"
+	.ascii	"\277b\360\257\027\374\253\005\377\352\341_)\370\327\234\177\225"
+	.ascii	"\340_7\374k\206\1775\376k\360_\325_=\363\257\371_\377\253p\277"
+	.ascii	"\n\347W\333~5\316\257\352\375j\337\257\362\375j\233_\305\373"
+	.ascii	"\325\350\257\336\375*\232_\235\373\325\270_u\373U/\277\252\366"
+	.ascii	"\253l\277\232\345W\257\374\352\332\257\242\375j\331\257\232\375"
+	.ascii	"\352\224_\035\373\325\347\257F\371U\261_\005\373\325\257_\365"
+	.ascii	"\372\325\256_\205\362\253N~U\353W\233\374j\326\257b\375\352\222"
+	.ascii	"_M\362\253G~\365\352W\211\374\352\220_\225\372\325\250_\345\361"
+	.ascii	"\253:~\025\307\257:\375*\323\257.\375j\215_E\372U\243_%\372\325"
+	.ascii	"\031\277\332\302\257:\177\265\003\277\312\374U\016\374j\317\257"
+	.ascii	"\302\370\325\235_}\361\253\033\370U\r\374*\006~\225\002\277\352"
+	.ascii	"\342WY\374\352\n\277\232\302\257\242\360\253)~\325\204_E\361"
+	.ascii	"\253$\374\252\b\277\312\200_\r\341WA\370\361\b\277\306\277j"
+	.string	"\342W?\370\325\016~\265\304\257\352\374)\330\257\212\370U\016\376\024\307\257n\360\253 ~|\366\253\037\376\264\304\217\325\376T\304\257f\360\253\030\374\352"
+	.string	"\376\314\3743\013\377U\370\325\013~5"
+	.ascii	"\377\301\374j\005\177F\300\237\215\177\226\340W=\374\030\315"
+	.ascii	"\217\327\374\030\372\277\315\257\225\376\223\375/\373U\342\257"
+	.ascii	"N\360\2539\277J\301\257v\370\365\337\257\342_\375\257\331\374"
+	.ascii	"9\203_\273\371u\337\257\337\374\332\357\327v\2776\363\3532\277"
+	.ascii	"n\373\265\226_g\371\365\225_\243\375\332\354\327"
+	.string	"T~]\366k\350\257\237\177j\365k\261_\203\375\272\353\327[\277f\362\353$\277.\362k\253_\007\371\263\005\277\236\372u\324\257{\374Z\350\327M\277^\372u\322\257\217~]\364\353\241_\213\340\327!\370q\321\257?\360\177\371g\017\377]\374Z\306\257\203~\355\376z\371\353\237_\367\374\372\370k\026\277V\300\257\215\277\316\177j\346O\307\374)\331\237\206\375i\223?\r\362\247;\376T\307\237\346\370S\030\177\232\374S\344\237n\340O;\370S\235?\035\361\247!\376\364\303\237[\3703\320\237\227\177\376\371\263\317\237/\360?\205?[\340\317\t\370\263\211?k\360\347\002\374\031\203?\007\340\3179\177\316\360\347\341\217\323\374\230\315\217\361~|\367\343\256\037s\3758\311\217Y\3701\007~\214\302\217U\374\330\001\377\353\376{\371\337\366\277\313\177.\377\247\374o\361\343\021\376\273\375\327\371\373\373\373\373+\300\3727X\361\347"
+	.ascii	"A\352\221\034k{Yc.\314a\235\200K\347@)\304\253$O\254d\r\034\373"
+	.ascii	"\201/\376\373c\222\247\364<\020\3724\340T\216\037sY\003\217t"
+	.ascii	"\016|\256q\334\3300\023;0\312\225~@\251\311\032\b\246s\240Xf"
+	.ascii	"b\346\346\366u`\330\017\004\313J\036\370\203\263\2275\021kX\323"
+	.ascii	",:\007~\t\341\270D\243@9\320\353\007r\001\273\204\320\2707]Y"
+	.ascii	"c,\314a\225\340\211\316\201P\214@\226\bAe\315\241\311\201N~\240"
+	.ascii	"\026p++Y:\202\2265\276\2029\254\024d\351\034\330\304\312W\234"
+	.ascii	"\220\254;,9\020\353\007\032\0012\231\032\033\203\312\0327a\016"
+	.ascii	"+\220\210\316\201K\212N]eh\300#\007*\371\201H\200It\274U4\262"
+	.ascii	"\306P\230\303\252\001kX\201Ft\016<\002<\353#\322%\353\f\300!"
+	.ascii	"\007^\375@\"\300\"E\271'O\352\262\306H\230\303\212\001kX\261"
+	.ascii	"\231\316\201C\202k\321/&\253\003\205\374\331G\232tD\007\216\270"
+	.ascii	"\254\361\227\316\201VF:+zK\200Av\206P\331\222\365u\224\244\200"
+	.ascii	"S\30566\364\272\354I\001}``\024\206\002\243R#\334\264\321\220"
+	.ascii	"\370\210\276MW6\370\b\267}\234\032\255?\360\351\t\330C\027\215"
+	.ascii	"\275OB$KP\033\350%(P\252\262\206\302mZh\350\262\376\210\265\375"
+	.ascii	"\037\270\003C\201<\2008\200<\2009\200:<$\275\257\220\2665\307"
+	.ascii	"\r\2536\276\367}s@\030\325\360(\222Ck\240\016\243\234\227\210"
+	.ascii	"\220A\312\372#\230\354\217\250\332\037\261\004l\242\362!e(\353"
+	.ascii	"\2170\332@&\240\215c(\320\006p)\330\244\302\2312\321\267\251"
+	.ascii	"i\003\240\022Y\030\033X\326\027\201\267/\202\314\376\201I\030"
+	.ascii	"\nL\322hr\236\357\223\321\206\231#8\276\267\251i\203\213p\333"
+	.ascii	"?\220\306\201H?\360(#\271y\241\363\313\332\2105\254\372\251s"
+	.ascii	" \215\375\367\247\305H\321\201F\327@6\260\006\246\214H\326X\212"
+	.ascii	"\316\201EZH\033\246&D\300!(\023\216\255\254\177\240\320\201C"
+	.ascii	"'\241d\244H\326\300W\347@!$?\257\254\203X\303\272\377\256\207"
+	.ascii	"H\231\231\312z\303\031\016\355X\013\223\365Ed\331p\236PRY\373"
+	.ascii	"\355\276\340\016\"\2427\353\213\220\262\247\270eY\331|{okGT\233"
+	.ascii	"\254/\002\311\376w\0336\251\270\206\207\321\233^\336\337\020"
+	.ascii	"\256 k\276\363\376\215\267\331h 8\312\2220X\262\326V\260\206"
+	.ascii	"uGu\276\327\250>\222\376rd\3755\350VS\302\223\037g\262\376\367"
+	.ascii	"\035\032!X\236\300e\375\022h\266\231\324\310\311\004\334R\037"
+	.ascii	"\030_\032\f\335"
+	.string	"h\366\231\034\242\025U\022\232\326\017\021g?\304]\2311^s^M\262\276\007sa\332\260J\214\331tQJZp\\\233\314\266\333u\030\272\307l19B(>\232\bm\375\020q\373!\316\366C<\331\017!D\316M\213\220\332\220\254_\302m\267\271a\261\245o\234\333\336\262\263\260\334\225nc\027\335n\233\013\034\230\r\267\337\366\227\035\207\241\333m{\331n\273\213\r-s[|j\026; f\206\372!r\354\207(\332\347\240o\237\2034\373\034\310\355s\320\266\377\255e\257\251)\"F*\353\343?\261/Q)jdckp\302\334\242\333\312\316\262\3176\332V\333W6\226\235\266\315v\025\f\335k\033\212\325\254\220\245o\332\0244\254g\033\330^\333Q\274x\260\327v\231\226\232\035|\3061e\316(I\240\317\301\224}\016\272\36690\262\317A\324>\007J\373\007\360\333?@\232\375\003\270\355\037 m\377"
+	.string	"\317\375\003l\355\177\203m/b\220\2514\033N\273*}^\331kVK_\233kw\355'\033\n\206n\257\355d{\355&6\274\266\325\316J\237WT\240S\212n\257\275\225\024\335^[+\313J\314kX\347\206\251\314P\377"
+	.ascii	"R\373\007\300\261\177\200\244\375\r\336l\254u\311\230>\266\254"
+	.ascii	"\277A\335\326\261\223`\271+\035g-\312d+\301\320\275d\013\331"
+	.ascii	"K\366S*\245\250\276\357\220\032\226p"
+	.string	"J\210S\322\252\221\024\245|^\256T\311\372\033\244]\231a\02193\262\217\354\"\030\272\257\366\220}\265w\244c\035\304Y\372\002S\333D\335\254\331\372\033\034\331\337\340\306>\b\276}\020\321 \035\206nuho\326\007\361\266\377\357\251-\205\241\233j\347\320\261\201`\271+\024}o\242\357\373n\252\375\264q\024\325\367\255\362\303z\337\267\003\b\020A\274#>V\035\225\211E\250\234Le}\020d\373\230\016*\035S\203\265\177\354\036\030\272}l\036y\373\330;\3221%tb^\251\03320\321U\037\204\330>\210#\373 \206\354\203\220\332\007Qco\034d8\344\312\364\310\372 h\354\033\200\315\376w\323f\022\226}!\031\263o\354\245mc+\355\032\030\272\231v\322u\220\334w\\\204\341z\254pJZp|FGIh(\331L\033\211\213\222\026\034\327\373>s\320\236\220\t2\3247\200\334\276\001\272\354\033"
+	.string	"m\337"
+	.string	"\\\373\006\260\3327\300\215\375o\242=tF\344\357I\326[HG\245\301\212f\375\017}\373\231jMX\364/\016\333\006-\372\307\372\261oX8l\337~Y7\354\036\313\207\241l\034V/\353\260q\330;VM1}\337\241(Xi\314\260\320\234E\305\360\300J\344y\305a\331\304X\"\362\205\353}\237 X;\2663\263\r\372\037\246\354\177h\262\377\341\310\376\207\251\375\017<\366?0\355\177\240\301\2529Vk2\3511%\353\177x\3675h\263\257\301\231\375\263g\3302^?\262\324\310\372%\312\260d\026\320\204\367d\006C\3312\254\335Ix"
+	.ascii	"f\304\213\312\303\241\3655\210\333\327@m\377l\035\333%\215c\""
+	.ascii	"\006\275\342\006\213L\313\035\026\230\225*\261-\276*q\242\177"
+	.ascii	"jo\320\376\242fI\3215S\232\210m\361ua\267\250N\302\245,b[|gY"
+	.ascii	"Cb[|X\230\f\211m\361\261]"
+	.string	"\33048k\030NM\023\261-\256,i\360\304\266\340X.l\034\373\306\312\261s\354\0276\f\353\205\245c\307\260nl\033+\206\005\203\241l\027\226M\263]X*:Ub[\\A\2775n\240.\320\327\340\271\257\201\223}\rr\354kP\264\237\201\337~\006v\373\031t\331\317\300l?\003\260\375\f\212\354gpc\277"
+	.string	"n\366\013 \267_"
+	.string	"*\373\005\310\332/"
+	.ascii	"\325\376\3312\226,\210\365Z\221c\245\260c\030\312\222\261\320"
+	.ascii	"\374|_\262(\351\330\022\026\031"
+	.string	"\373L\307\240\224\314\344\270\200\033\0327\253>\006e\3661\240\333\307\340m\377\254\030\033f\004\206g\2275\330\263\310\306\016?8Y\037\003)\373\036l\225p\342\203\345b\277X/\fe\273\330'l\027\013\005\253q)\321\371\340\362![\022d\353c\320\264O\200\275}\002\244\331'@\334\376Y-6+I\020h\226\254_\302\210\322\022V\t\213\3052a\223\260M0\224\315b\217\234E\222\3228\246\"R\344\006\233\305Z\261B\322'\226\tR\242\242C~`\261Y\354\025V\363@\364\276R@V\037JbR \3269\254-\266\242\026b\r\353\t\300\265O\200\253}\002\354\330'\200\215\375\001\370\355\017@\314f\205h \033@*\252\332\312\372\003\330R\305J\035\217@)\312\372%~\204\221\365X\0035\305R\261@\330 \030\312J\261Q\231\216\225b}\340=\017F\357K%\265\276Q\322\202\233\262\246\214\217\240\376"
+	.string	"\210\354\017\200\307\376"
+	.string	"\216\366\005"
+	.string	"g_"
+	.string	"e\366\317\362X\335\004\tC\367\206\335\301\n\345`B\305(\353\237\325\301\346\270\322S\033\313\032\207\236\302\302\213naZ\343\260D)\264i[\031\003$\3122\255vk^\nm\222\300\220\251(k\304\3420\272b\233X'\366\006\373\204\241,\023[\3042\255z+\234\024\332\004|\032\"\025\355"
+	.string	"\002\337\001\331\323\021\324J\352\227\024\250\251\254/"
+	.string	"'\373%h\f\271\301&\261H\251\021\004\330\354\361q\2615X\033\030\312&\261GD8Q\276\247U_"
+	.string	"F\366\005Pc\377\0028\373\027\250\331\277\340\013;4\004\213\213)\353_\360|1\224\025Z\377X\241\264\313\035\026kU\346\244\246\365/ \262\177\001\220\375\006(d\306-J\326\277@h\277D\233\324\250\217lu\263\362\255}\253\037\206\256n\326\275\025H\335\0272\253~"
+	.string	"\366\366\003\340\266\037"
+	.string	"\266\375"
+	.string	"\240\261Q\321\340 Q\223\365\003@$\272\252Y\327\254w\030\272\342\255h\314\274F\320\003`!\332\343K\223\322`8\f\260X\355\361\361\255xk\231$\254\367}\256x\353\031\\\326"
+	.string	"6{|\\\357\373\246w[kl\004\365-\300\333\267`m\337\202\262}\013\240\354[ d\337\002\247\375\257d\352\326\204\244\234\262^\353\3261@/S]<\262\276\005D\373_\305\320\0211\351+\243\303e\351\333\327\346\306\\\212\026\346\357\251J\2308\234\025\247\205\313\372\004\227\235\301\222[\341V0\030\272\306\255nO\251\254ok\\J\206\313\260\234\031\n/3\3215NC\327/X\016*\r\0165;@\3503\255-]\266V+x\333^\326=2 DY\277\202,\333l\265R\205m\245\242\316y B\322Y\300\242\177ex\257\250\276/\225\030V\333\252e\315\262^Y\261\254\\\326-k\027\f]\331V\257\257PV.\263\225m\235\022\026\355B\303\032;\303\"[\241Q\260V\266U\312\n-Ct\006\213\357}\237\300\037faV\031\324\326\2654,\246\251\254M\326\257"
+	.ascii	"\207\332\232F\305\315\307P\326k\332\357\332\320x\203\226\365"
+	.ascii	"\212\226\306\301!2tF\024\303\"\303e=+cr\203\211^\326\257 i\277"
+	.ascii	"\202\241}\017n\366=D\367=\220\331\367 \267\357\241\313\216\262"
+	.ascii	">\305p\2230*\035Y\337\303Y\024\261}\244\n\t\2225\354\253\230"
+	.ascii	"\207\033H\276\262\276\336\n\326\346\351\312\r\330\372u&\214\030"
+	.ascii	"\276\365k\365\302T\206\206\210\262\276\207(\373\036\270\266~"
+	.ascii	"b\016\353\315\260\206\365\036\256\366\277:Y\2678\320\242\204"
+	.ascii	"H^\267\376\234\264j\255c|\244\021\311:\177m\222\256\305\200\202"
+	.ascii	"\022\313:\326\321\024Y\\\326+\326\255\344\235\244\007\247\217"
+	.ascii	"\311W%yV\334rd}\fgU\262\036\271\025,g\206\261\236\250\255K\326"
+	.ascii	"$\030\272*Y\221\254J\322\260tK\261\350\371\n\261F\244\314m\361"
+	.ascii	"\255HIN\230\254\372\036\212\366\001\020\335\377jd\035\002\347"
+	.ascii	"i\215V\326n\326!\272O\t\221\230\027\237\366[\207\3507(\300\340"
+	.ascii	"\264\337:$\265\222n\361Z\257V\"k\221U\b\206\256C\326 _\253V\253"
+	.ascii	"\242u\210\206\256TBl\025-b^|\357\373&\200\315\033/A\035|1\207"
+	.ascii	"\025Sa\r\353\001@e\257S\034(j\323&\353\003@l\247_x\353\023\216"
+	.ascii	"\013\240\020yE\371V\035*T\2353A\243\311\001VRQ4\352\032)Qb\032"
+	.ascii	"\310\007'8V\035j\030\206K\237X\354\024\253#`\372O]J\241M\300"
+	.ascii	"\033R\230\244`\253\016\365\206\352\3644\302\t\235W\224o\325\241"
+	.ascii	"F\261\272\212\276\357\253C\245S\317|\320\322\342\025\345[\245"
+	.ascii	"\326\036+\324\232c\365\261\376Xy\2548V \353\2165\nCW\035\252"
+	.ascii	"\230k8:\316s\236\357[\344\267\352Ps\250`\036\210\220\336\367"
+	.ascii	"\251\003'R\274\242"
+	.string	"|\357\373\256:\324\347;$dB\213\215W\224}2\305OJ\216vZ\"\245\204,\353\003\300h\377_o\254K+\023\206\256M\353\021\335J\303\004\215&\340\215\262$\321\025iU2A\243\tXc\314\222\350\332\244\262Q\341X\035\200-\013\031/\020\354\037\230\"\250\255W\033vF\376\366\326\032k\222>\353qeu\275\257I\352\334\326\022\264\254O\201\232}\n\336V\243U\t\221\245'\225\265h%\2521\364\304k\035\372J\024d\022'\314,\353UH\345[\262Q\007\315z}\261\232\030' }Y\253q\324?U\307\226\2433\177`\224\210\374\3247}\302+Q$S\262>\005Y~}k\326\221%7\334\\\355S\333\362V\225\265\252\007\334NUgL*\237\2727\227&\016-\314\377\347\253E\344EH\033U\212\320L\215\367.k5/xF\215[\226\254\257\207\325\376\003U\2536h\254d}\n\214\354S"
+	.ascii	"\245F\215\336m%c\242\266d}\n\210\324\334\321\231\275vi\256\336"
+	.ascii	"\375n5#\304\245\357\215j\306\356\315\016,L\262~\0072\373\030"
+	.ascii	"\252\226Q\355\324\266\222\322\310\\\265\203\033\276/\330\373"
+	.ascii	"\276\036\206}op9\262\276\236Z\367\037X\254\023\263\242%\353_"
+	.ascii	"\255\033S\\\232{\253\306\250b\200m\354\340|e\375\016p\373\035"
+	.ascii	"\272\3540F-B]=\262~\207*\373%\3248u\314\013N\225\303P5N\225\222"
+	.ascii	"\023\247\222\251oX\016\352\302[tg%*\364b\224\005l\325o\352\232"
+	.ascii	"\372\205\b\032\226\233\n\006C\325\267\277\251ej\032\2263;\341"
+	.ascii	"\311ZT?mY\215Yu\233\352\005C\325/j\227,*\027\017DH'\344\205}"
+	.ascii	"Q\255\250X<\020!\235\260\345,\272\265\034\331bd\325\357\020\205"
+	.ascii	"\013\0331\311\212\026\031-\352\226\240\016(\271-Y\277\203\326"
+	.ascii	"\326r|#\313\310-\353w8\262\217\241O\243^\371\035\222\267\035"
+	.ascii	"aY\277\303\220\375\016R\373\035|\354\227HK\261\3243,g\206\342"
+	.ascii	"-\255\212\252\206\241j\232\212v25M\235\202\325\204IZ\2164\361"
+	.string	"\025\231h}\205\255\3729y[C)\242\002F5S\251\274D\342\035\020\266\255\254\237cf?gn?\007n?\207m?\347l?\007\272\237\023\266\237\363d?\207\311~N\325~\016\324V\277:\030\205\024\031\032\223\365s\220\266\016\025*}b\231@t#\nE\365R\2710T\355\272\332\245\366P\225\230\240\321\264\002\321R\264K}\3627\017DH\357P\220\021Y}q\276t"
+	.ascii	"\001BO\271\3622\265\365'P\333\307k\206t\300rW\"4\251Bv\244+\252"
+	.ascii	"*Q}\250B<\020!\241\320\226V\344lE\340\373V\231a\201\0319\333"
+	.ascii	"\022\257(\234\253\017X\316\f\305\025\260\350\373>U%*\222\263"
+	.ascii	"-\341\212\222\251JT\"\035V#G\372\362\370T-\325\211\272Dm\242"
+	.ascii	"b\251Y\352\226\312\004CU%j\222\347\250S\312\370\3742\350O\200"
+	.ascii	"\264?\201\320\276\004n\366%X\263/\201\335\276\004a\366%\360\262"
+	.ascii	"/\201\025\253\234,\244f\216)\353K \266\377\253Tj\020\fU\253\324"
+	.ascii	"\250\037\252TQ\b\303\373\nI\243V\251S\252T\2064f\360\240\370"
+	.ascii	"\322\2653ye\253>\0078\373W\245T \3028a@\342@U j\324\377W\214"
+	.ascii	"\211\222\220\254\317a\314>\007\270}\016]\3669\\\331*\324\257"
+	.ascii	">\25184\020\365,\311\355(ku\207\316U\036FWJOYk\2005\254\347p"
+	.ascii	"\266\317\201l\347'\346\260~\300\032V&\265\t\323\265\351K\312"
+	.ascii	"\372\034\2340qH\262\225\2148\200PA\312\372\034x\354\227xU\242"
+	.ascii	"\024\332\264\321\212\370\210\252I\252\r\fUk\250Ej\r\325HE\302"
+	.ascii	"rf\357\020\016\f\3304!\343\305\207\306\347\267c\3254\324#\243"
+	.ascii	"\r%GH\274\320X\333\337\320\245\016\345\247\262#IY\177\203\022"
+	.ascii	"Uh\003\221\375\r8\366~b\016+F\372\333\370\305\032\326k\030\263"
+	.ascii	"q\023_\033\241\333\2313Ym4\236\216b93\375$nO\353a\250n\243\363"
+	.ascii	"\332h6\251\021\2263{5\2229\261-\256\024)\214\224\254U_\203\224"
+	.ascii	"}\r[\373\032\220\354_\257\321QVl\251\007\222\330u\364V2U\334"
+	.ascii	"\032)\276-\271\254\306\020\217\2732\177Q\253(i4\232g\033]Z\326"
+	.ascii	"gr\324'\247-mY_\003\217\375\022e\264\\jTtz\276N\354Y\337\021"
+	.ascii	"\234\235\036\243\3534\031m\006Cu\031\035F\323\341\347\213d&&"
+	.ascii	"\016Y\234\037\026\234\2217Gp|\272\214\006c\004\316\021\034\337"
+	.ascii	"\373>\215?\2700\271\032\352k\020\332\300 \230\275\036XY?C\337"
+	.ascii	"~\206\272\375\f\\\3663T\331\317\020\266\237!\311\376\365\033"
+	.ascii	"\020\244'\006\\\304$m\314\215\313\325\r/MYk.\032\252\263\244"
+	.ascii	"\317+\017\220\"&f\026\005\f\rk\213\356\242\331\264\027\335\246"
+	.ascii	"\277`\250\346\242\265p\321agQ\315E\177UQ\273\250\351aU\324\317"
+	.ascii	" \265\261\3409\242\257\035Y?\303\322>&\223\362\205\246\315\364"
+	.ascii	"YQ\350\302[T\026\206EE6\306\253\254K"
+	.string	"\243\351)\\Q\035\215\246\307\272\2141\341\262\242\253\350+zM\253\3514\f\325h\232\312\365\023\367i-bnj\024\265>{7\260\241\212\224vd}\fc\3661l\331\307@e\037\303\223}\fB\3661\350\330\307@\264\177\341o\027\261\206\365\027\354\366/\274\355_\270\262\177\241l\377\302\023\257\034\342\2317`\340t\227\346\322\212C4\2265\224g\332\373\2769\230oj\313Q\326\277\020\265\217\301\214h%D[\032K7q\343D?\321Z\030\252\2674\223\347<\365\226^\242\247\260\034\324\363}\nZ\2419\202\333i\276\210\216\266\376u\326u\023\265\r\274/\030\333\213\347\226\265\216\316u\026\216\342\007\355\222\365/@\355\033\343\354\033\335l}D#\301\320\034\235\304\210\347\210nDe}#\336\036\301\213s\326\377\341\234\365F\272\375\353\253\"i\215\260<+Y?\207LLH\250\210`8\366\213\213\225\231\036\242\205"
+	.string	"\241\344\260\213\323U\327B~\354\247\255\364\324\221\332PQ\326\351\2139\254:\210\316u\225\235\023\026\035Y\253X\303\372k*=\205\005\344-\353_OI\031\277r\020I\362\004{\337\327\b\304\342\347DG\326\372\207\216\272\006\242}\274\032H\007T\357;\244\201\030\337\274\357\220\021c\001`,"
+	.string	"\355e\305\004m\3257\302\365\340\021\346\205K\224\254\217\311r\350&,gV\302\031%\032J\357\300P\315\343\372\311C\353H\215\252"
+	.ascii	"\211\022\317 y\343\312\262o\274\202\243)\213\351a\004G\326Lg"
+	.ascii	"C\202$\332\244o\244F\301*I\216\340\370\234\364\023\206\352&\262"
+	.ascii	"\016B\2701/\276U\337X\266o\374\332\277^\3225\320\276\310\031"
+	.ascii	"\311z\257\013\313\r\223$\215\244\225\364\221\266\241i`\250\256"
+	.ascii	"\241\215\314t\215T\357+\332\306\253F\312\307\245k\244}\272(\205"
+	.ascii	"69\200nI\264\255\357\375*\352\033\215lM\224l\262'%\353\033\177"
+	.ascii	"l-\224\3069\022\325C\351\237~1T\013\245p\256K\274\261\272\322"
+	.ascii	"B\251\037.+\026=_'\017\234\372\242\270\336\367\005\221\003\002"
+	.ascii	"DP\311\324\024\231\255o\034\332/\346\355\027\243\373E4\373E\273"
+	.ascii	"\375\242\333~\321\312~ql\277\030\266_|\262\3774O\017\311Z"
+	.string	"\373J\331\244xvRb?\262\306\373\323h\272&\275\033\022\317\270\\Q\2235~b\016k;\220\274a\307\260$5)\022y\261\b\246\341e\026\007\002G\250\250\212V9_\200=l4\321\252z\321j\356+\017H\326\305 z\312\352L\255\t\002NRRC\246\034*!\275UL\307\036\234\320\007\\\230\275\254\017\201\245\0349\212QSl\324\216\"_4\030*,5\212;^\214*\376\330B\224e\356G\321G\333\r7$Y\367\320>\252l\361\222\365W\330\355\"T\221\307Pj\210\0172Y\177\205\333.\352\300{b\310\200]Q\251\205\231\242\226\365WL)>\025\237\326$.&\257/\\\271\315\315\235\221\254\277\242I\361F\361F\261\251\303S\332$K\336\233\"\323\213Mw\031\214L\314\322WL\331\260QT\312\241\022Z\363\241oG\025\224.\322\027fF\tX\345\246\007\025\234\254\277\002\234]L*&q"
+	.ascii	"c\362\372\302\227\027\347K\227\254\277\202\231\"\215\"\215\342"
+	.ascii	"\221\2175\207\2168[\222\236\236\366\212G\251\221\031(rL\262\376"
+	.ascii	"\n^\305\241\342P\261\b\354\206U\033\222\035V\350\212D/\026\021"
+	.ascii	"9I\242\006t\"r\245\031\323#\353\257\320c\357D7{\3057\255\303"
+	.ascii	"\317\027\212JhM\002\374\2406\240a\336\274\370\236\370G\302\203"
+	.ascii	"\247\341zR7\22451\016\034\242\337\323\344\2554Jk\262&\366\235"
+	.ascii	"m\bE\206\257\b\0370\213\324\220\252\254\317\242\325\375\300\312"
+	.ascii	"\372+<E\243D=<\3662\261Q\035{pf\252\222\266\344\235\250\267#"
+	.ascii	"\251\252*k\"\233\365\314Xg\347$+k\"\336zvu$\352I\326\3045*\224"
+	.ascii	"!\336\021\357\210V\304\260\326\264\350\205\311\372*dA\203\206"
+	.ascii	"8\026G\375\001\365b\227\365U\370\332bN\264\023C4\303n\3111\242"
+	.ascii	"\301O\007\336\023\276\027)\352\003\017\221\2517b\231\023\315"
+	.ascii	"\374\355\257\354J\325\255`'k]hY\023\311\260d\306\270\215eM\254"
+	.ascii	"S\177\3408\2635\346\007\016\257\336\340\360\262\276\nF\373)\304"
+	.ascii	"\t\023\20687\002\277GS\2440E\323g\036\223\2249\274\207\004J#"
+	.ascii	"H\326O\241\016\016\216\030\227C%\264\006\003\255"
+	.ascii	",\"PX\bG\222/b\034.3\022\273\352\312\372)l\301r\342\026,\304"
+	.ascii	"7#R\324\352$\3542\363dK\227\023\337NtK\263\303\272\312\232\370"
+	.ascii	"\345\330\b\233)HY\237\350\005\230\205&-N\326\3046\016\376\003"
+	.ascii	"3\220\276 "
+	.string	"o\262&r\371\202\205\357G\326D\266\253!\246A\257\242\210PR8+:\242\254\211Z\210YRPSS#Z\341\323\241\305\205o{\235E\301\262v\242\025}\006\214^\226\024\236h8\rG\254bd\345\242\303LTH\347\004\217+\353*hB\250+'23\342\331\nM\236\244\200d6eJ\005\262\346\362\264\033'Kmydd\301\264\r^\240sy\354\233\265\245;\267(\177\024\342\330\323\242W\252\013\313Hc/\207\027\350\211cC7\"(\241\254\211\317\365\f\330\246I^\234\247\227\0271,'/\370\314bJ\003vb\330\246\002\307\247\2255\361+\315\353\342\206\345E\301j_\235\270\344\212\310e4\303\357\013\365\022\025\275RS\024\304\351\230\343\342{\221\240>\020\325|tQ19\221\353D-\022\036\020\241\334`\253j\2235q\213\350\004C\357F|\362\247\261\230\345\350\314-\353\243`\264\217\357\266\216"
+	.string	"\337m%6y\021\nL\226h\326'b\021\263~`Pk\b\031\224\254\377"
+	.ascii	"8\373\034\214\355pr\"&9Q\311\017\024\212\261\321\240\313\372"
+	.ascii	"\017\320\333\304#'\"\371\201\230\310\r\271\271\254\377\200\350"
+	.ascii	"\376\211F~\340pM\222\035G\262\376\003\316\354?@\214\020!D\"x"
+	.ascii	"\213\311\353\013W1\217\212\2167CN$\302\206\367\266\362\216\350"
+	.ascii	")#\024?\033uY\377\001W\250\250\210U\033\332\326\276+\2668\304"
+	.ascii	" 'V\2611\271\231\t\313\372z\212\b\306\204\f\034\264G\017\242"
+	.ascii	"T\016\225\020\233\005\264a\362\372\302\007\254\001\245\214\230"
+	.ascii	"\217\023\245\210@\214\030\021q\313\232\030\305*-9{\263\376\003"
+	.ascii	"\2546\361\307\003\206t\350 \362\300c/\223\006thq\031\376U\021"
+	.ascii	"\223\265\343D\036\232.J\235\235\031''\"\016<\3662\341&L^_\324"
+	.ascii	"5\2421K\2360\224\210\343+\313\223\307\333\322\022\221\t\217\275"
+	.ascii	"L9Q\035Z\\\0220$\217\315\215\023\2310\332\013\225\004\227\225"
+	.ascii	"\331\nr\004\244F\r\242\r<\3662\255Ven4\261\322b\322\221\265\r"
+	.ascii	"5\253\252\243.&$$\"\r<\3662\201`\251\017\214\353}\241>\020\343"
+	.ascii	"\236\2548e}\007\034\021\213\210ED\0329TBz\354\025\250\017\251"
+	.ascii	"WR\035\321\350D\032D\27529\261\254\257\227\032\375\007\256pL"
+	.ascii	"o\372\376\366O\034\"\016\245F;\351}\253|\004\267\350X\362\006"
+	.ascii	"\203\0229(Y_\305\332\376\211/\361\305pZ\350\3712m\210B\205\367"
+	.ascii	"\244s\245\t)\353\253\360\202\003g\030G\027=_'b\023&5[\212gl{"
+	.ascii	"Y\262\036\306Q\221d\377C\277\241_\020\211\036\272\360\276V|W"
+	.ascii	"\336&\250\rH\370\220\242\225\365U@q\371\020\214\372\244\342\300"
+	.ascii	"\320!\227\241\233\024\t\352\305\001\202\356H~\362\201\304I\326"
+	.ascii	"|\254\215\036U\314\262\276\n\033\373\030\fn\030g'\247\376\201"
+	.ascii	"\305\315\r\305`\271+\021\236\274E\207u\303;,\007u\341-ZC\023"
+	.ascii	"}\337\367\030\fO\235\242\376\t\201\303\312\033\356\r\333\f\331"
+	.ascii	"\f\327\f\3650t\2107\0343\304\033\206\001\023\025\326\3511\221"
+	.ascii	"+j\270\247\361@\204t\202\230\231\350\360nHf\230\246*\001\\t\024"
+	.ascii	"\211\342\033\252\031F"
+	.string	"1tx\367\234\016D\2772|b\253\376\207i\206h\256\324\370q\224\365\360\f&s\263!$\353\237\360e\377\3032\030:4sw\324\004\316\222\254\207vO\243\223\204j\3308\241\313\376\tX\366O\030\322\3551Q b\373'x\355\237\340d\377\004\254\375\017\343\324?\262/ypY\377\204${\370e\370f\364\272B\244J\326\037\272\375\007\252p$\256J\326\332Kvc\202\265\224\365\207mE\273%g\320\254?\354R\345/\257G\326\300\260M\343\004)\r\202@\326\246~d\375\023h\234}\250ex6\334\222\241O\241\"Q\222\250\rX>&#d2\316\360\242Y\017\255\f\261\f\263\374@\240\026%\272\250\254\237\"\316\376\360\312\325\234\022'Yg|\266u\250\366\341\332\017d\301\232\212\316\262~\n7\373\303*\303\264\037\230\302y\323\222\224\365S\254\331\037\242\375\007\216\340L\220\256\254\201Q6\215\024s\032"
+	.ascii	"\315\214\245A\222\365SH\241BeM\362\"U\204\fK\326O\361\244\254"
+	.ascii	"l\370\204\201\336\331\026#\"\266\254\237\"\310p\fC\207cC)A:5"
+	.ascii	"\251\r\310i\021\201\312\372)\236\366?|\016\237mR\035W\240fY?"
+	.ascii	"\005\215\241\330P,\270\267\337\270\251\342\236\2255LY\337\204"
+	.ascii	"=0\260 \025\021\314\250\206p\\\220\267\324\007\306\027\264\242"
+	.ascii	"v\366\226\365M\230\363\362\nJa\302>\321e\256\230\271\311\372"
+	.ascii	"&\254\355\177\3105\344\nB\227\264\346\266*\240\021\006'\353\233"
+	.ascii	"\320\265\377\341\023\f\035>\tF)V\241S\263#G\307@\211\313\372"
+	.ascii	"&T\355\177\2705\334\n\206\231\320\"\022\363zC\363\212\311\372"
+	.ascii	"&\034\355\177\330\344\030:l\022\374\372Z\363\260\223\334\021"
+	.ascii	"\254\254_\202\232\375\017\223`\3500\311\020K\204+\252\027\207"
+	.ascii	"N\324\022\221/|`D\246\262\262\036b\375C%\303%C&\270\3704%\232"
+	.ascii	"\246\265\2012\225u\246\302\034V\f\260\206\365%X\331\377\360\310"
+	.ascii	"\360H\260kD\330\023\357\t\fi\256-\353\227 \266\377\341\325\360"
+	.ascii	"*\b\245\203\2549\261\255\340\331\031\0170Y\277\204$D\210\004"
+	.ascii	"\267\364\320\330\353\264b)\231\311\301UG\304\206\\\326/\341\306"
+	.ascii	"\376\207U\320a\325P\310&*z\207\316V1%:\037^\272@\321\345\241"
+	.ascii	"\220\017\2556@\226\303\214\017\2560.vg\250\250\252\250=\216\254"
+	.ascii	"e\205\221\222Z\313ms}U]\242\242\202RZ\bC\321+\304\f\353}\337"
+	.ascii	"6H\275P\261\272\313\372(\246\370\360\021\224\332DHTCV\037\372"
+	.ascii	"r\320m\361\275\357\333\006\354\r*!T\262>\212\251\375\017\241"
+	.ascii	"\216\241C\250 \026\223\025OXd\n\205\215\375\017w\fw\260UX\256"
+	.ascii	".:\033Y\377\204\3370\3070G0\215-\312\021\034\337\211\272\241"
+	.ascii	"\323\320i\370$F\017L\303)\343\233zR+\343\304\025\246EIi\310\224"
+	.ascii	"a\213\036\223\350\013\005\365aG\207\221-7>db3\202a\235\215\311"
+	.ascii	"z\270\364ut4\254\221\337\367}\261\3306=#\321\027*\352\203\221"
+	.ascii	"\212\213\217a\322\2075\252\264\236FY\017\221\364\324\177\240"
+	.ascii	":\327&\272\225\365\365\200U_\240Nb\262\376\211\252=,\032\026"
+	.ascii	"\r\215\364\242\242>\244Mv\274e\262\036\032\351\251\224Mi\215"
+	.ascii	"/\353\237H\332\377ph8\004w\243I\025\275\276\375\017\337\341\033"
+	.ascii	"\\\262\215\212^!]\354\016%-8\025\311\216&DY\237\0041o\204q\336"
+	.ascii	"\254Ip\340\254I@\216\340\270\276\346\304\350e}\022\330\366I\210"
+	.ascii	"\322\327\267&m\241\234.\261\241\033\025\225\254\254O\302\325"
+	.ascii	"\346\343\013\246\235\360b$\177Y\013\034:\270\254O\302S\236\260"
+	.ascii	"M\336\232\244\247\267&}\265}yCt\225\365I \332\037!\315\306\303"
+	.ascii	"\013\356\3557l\2046aT\030]\223\334\324\260\274\356~\267&]\360"
+	.ascii	"\276/\215WF\236[Wt\204(1B4b\204g\306\214\021\236\361b'\244a\326"
+	.ascii	"%g\346\3023\254\0216VoY\013\313\354"
+	.string	"7A%+b\336\204vd\230\272\272\330\t\311(\321B\223\204c_E\235\355\020\326\261Ei~\004\211\222\365G\260\261/\002\233\035F\030'\234K\215\360\373\364\342\244\255\260(Q\021\312\354\213"
+	.string	"\006\2140\016L0\r\016.\230\266"
+	.ascii	"\261#8\256\027\n\352\003n\342;\273\312\372\"\250\355\213\360"
+	.ascii	"\304\315m\303W\234\266\r\202J\356\320\314e}\021\200t\021z\351"
+	.ascii	"\322\326\226\023\206t\004\307\367BA}`\223 \201\215\311\372\""
+	.ascii	",\3557\240\315\276P\013\026\262\261\005\223\340\246]\245\nS\324"
+	.ascii	"n\037\007\223\254\007\372\300\302,\302,=\260\\\271\202\341\360"
+	.ascii	"\363ebm\3645\340H\232p-MM\255\251\013N\003\242\366\033p\264\177"
+	.ascii	"!\232\020M\214\001zB3\241Y:fC\215\001td\302)dk\322\372\276\370"
+	.ascii	"I\305\324\364B5}\020\226\t\313\326\244-\224\001\251#8.\262}\006"
+	.ascii	"H\355\261\2615I\353\f\003n\354?=;K\321\266Q\321K\344\212}\303"
+	.ascii	"\244f\013Q\256G\2160n\251\033\336\023\341\212jh\b\003\255\254"
+	.ascii	"\271\374\306\307\2161bB\261\240\2214tjv\344\270)0]Y\177\001i"
+	.ascii	"\366\237VI\253\254[R\300\334h\"\264\323\252Q\225\226\246\245"
+	.ascii	"k\"\\Q\rU]\360\205\351H\033_P,J\027\265\024K\212e\305\322Ec/"
+	.ascii	"\216\365\212\222\026\234\360.\211\214\222\256\256`\021\021\314"
+	.ascii	"\2506 \232\333\342z_\250\rp\034\032[\212d\375\005\224\331\277"
+	.ascii	"\020\3121T\b%8D\004\250\261W\210U\323\022\363\"\252\341ZC\225"
+	.ascii	"\365\0270f\377B'\307P\241\223\240\025\233\246Jl\253nJ\315]\326"
+	.ascii	"_\200\334\376S-Z\276\260Zz[O66\035\325\300\242w\b\354\312\373"
+	.ascii	"Bm\260\206\031\322\027\307\005C"
+	.string	"S.:\352d\"J\023\336S\033\233\251\265\254\261\260\202{Q\332\262\354o\200\205K\226\254=\2670\2110I0\rw)-\300\310\221#\270\314\206\225\005$\355\253\2535I,\204\276\375\3538\035\207\3256Q\321+u\305>a\252\313S\253\332\354ueME%\034\002%\315\021\034\237P\310\205C\332\212\260\251\313\372zB\253447WB+aU\225\270\"Pg\222\254\251\313:\210\016\243\351~\244\367\311\352..\353\207\220\266\177\241\224P\n\303\215`\251\330h\213n\355_\330\003C\205=\204Q'<_!\243\2154O\305.\214\372\205>\204?\3224\331\331\244\313Z\326\034\3440\2075\277a\r\353C\240\342\301\343Vt\321\330\233\304x\246\306\021\234\336\031\245\244\254\037\202\323\376\205:\204:\342B \332\277\020\207\020G\220J\017\215\275BB)k7\232\024\2418\225\021\222\365\025\020\335\277\320I\350\024\246"
+	.string	"8!\223\220iM\312JR\300\332>\206\303B\245\237\204\007\302\"\341\022\206\273@\350\3712A\340\356\b\216K\001d\373\n\340\332\277\260\206\260\006.\023\301\214j\350I"
+	.ascii	"QL^_\304\304D\311\372\nx\367q\027\026\036a\250"
+	.string	"\360H\210t\302\363\025*J\361\222c\203\240\324\220\352M)\207[\326\007\201\314\376\205FB#\315#\347\371>\261\260\004\214\237\237\220h\004\2262\302\241\013\211\204Fxj\244\262\026\nU\340K\321[\326\302W\0031\226\341\202\006+\353\340\337pn)\215-\353`\234\253\t\336A\253L\311:\b\347l\251\024(f\340d\035|3\254\2132\303\226\365\365\364\325\177\240\320\n\214\0300Y\037\20437n\202@p|\b\013\323\027\265\243\372\324\366\262>\bczz\301\275\020\242\364\300j\363\340^\021\214-\352&\316\177\340\221\355\b_\326\007a\213\r\2335)\f\016\bU\373\017\2569\206\006\327\244x\037\236\257\220\021\t\337\021\034\037\bOh\320\004\325\340\367}_-\265\273\007\325\374\016\315\210\027\277\254\203iX78\253\251\254\257w\266\377@\255\003\313\027\230\254\237\2000\373\017\232\t\232I\215\364\363u\n\"\351J"
+	.ascii	"\232\235\335\232\304\344*\001K\366\037\254\373Ix\200\241\301"
+	.ascii	":\254&\002\024\225\020\336"
+	.string	"\005oLG\332\206n\240n\312d\375\004\324\330\177P\31414(&\210D\204\253\367u\002At\004j\003<E\310\224S\336\334\237:\245O\030\032\234\013\226\211`F\365>\035\200-\310\\\036P\311\223\244\277\254oB\314\376\203rA\271`\023]4\366\n\025m\254!\002\025\214n\031\312\313\372&\254\354?\b\027\204\313h\370\315*z\205\204\261;\3326\330FQ\230\342\262\276\211\260/_\202oZh\354m\022J\371\272\321d\030\345\022\225\026ts\253\023r$\353\233`\262o\"js\341\022l\333\357\373.\365\bvy\260\355L\b\036R\326\327\333n\376\003\201P1F_\262>\002\342\354?\270e\013\336[\261k 1\213\232\331\017^\301\301,Y\322\261\025\273\206\215*\321\267\351\335\340\bh\333\307\351\330\372\007\255`h\320\n\336\313\317\267)\210$\312s\203#\200l\377\330\n\266\202\247\210`F5T%"
+	.ascii	"\257\033~P\351\2337U\334d\375\340Y\020\355\301*\017V\t\246\001"
+	.ascii	"\337\367}\241^!6\027\200\261q\004\307\367B5}\b\246\001\263\264"
+	.ascii	"\254\224\262>\002h\354\037?\377\353;\324\364\276\357\223\372"
+	.ascii	"|\233\210\206\353\217\217U\214?\374D\234\342\001\374\327\357"
+	.ascii	"\253\200\270\236\367\005\242f\353}_\234\267\265\254\f\375\270"
+	.ascii	"\340\375\377O\360\276\257\023R\321+\204\221\310\252\234\220\310"
+	.ascii	"\252\2320 \275U9\275EN\\EUT\030\251\250\252\251\251\350\025\302"
+	.ascii	"\360\222U5!\275UN\027^\262\227\007\022\331\220\020F*z\235\336"
+	.ascii	"\267\352\275\360\"\r9\275d\317&\fHdUMHdUN\030\220\310\206\234"
+	.ascii	"\220^\252\367\002\322SH\323\373\254\022\302`\203l\310\351%\243"
+	.ascii	"r\302\360\222U9!\355ua\251\340\216\317\nL\035\331\327\033vB*"
+	.ascii	"zo,E\r5]\220CzR\275v\357\213\315h\274M\257\334\373\016\340}\243"
+	.ascii	"\250\232\354\206x\340+Dr7\210\322\206\250:,\021YQ\275ErB\370"
+	.ascii	"\225C\332\242z\337-\242\236w\351}\337\267\003\241\247\334k\004"
+	.ascii	"\313\t\t\211z\225h\274/\005\357\363}\227\336W\b\277r\357\373"
+	.ascii	"\n\275\357\3136E=\337\327\307\005$\254\245\245\367\205\312Yz"
+	.ascii	"\243\204\260\320x\337lf\346\212\023\022\231\025\225\016\226)"
+	.ascii	"dX\357\321S\b#)Q\275X\257]U\323&\023\202\276J\357\373b6\033\313"
+	.ascii	"\t\007^\326\317\rPPnd\035\234\242\327$Z_\\Y\377\003,;H\2667\207"
+	.ascii	"\345I\326\377`\312\016\216ai\t\223\365?\200\262\203O\266#m\262"
+	.ascii	"\262\376\007EvP,\230\003O\357\231\365?\320\261\203`\0358\003"
+	.ascii	"\373\313\372\036\374\355\240\027_\020\251-Y\337\0034;\310\225"
+	.ascii	"\243\341\315\027\224\254\357\201\334\016>\361\313\222\344&\353"
+	.ascii	"{\240e\367\3211\355\005\265\212Y\266\304\255\311\372\036x\355"
+	.ascii	"`V\223\257\327.\353{pd\007\231\f\207\252\224\224d}\017~\354\240"
+	.ascii	"\222\034l\323%\215I\326\367\240\306V\013\303\305K\326\301#Yk"
+	.ascii	"o\234\262~\007nv\360jj\307\023/Y\277\003\274\035$\"T\032*R\224"
+	.ascii	"\365;@\263\203B\304\250|I\313\372\035\324\355`\225\020\245;+"
+	.ascii	"Y\277\203\270\347\363}\237F\341\025\251\263\034Y\007\2472\021"
+	.ascii	"J\346c,\353w\200e?\241\220\324\304\262\016F\261V\312\320\205"
+	.ascii	"e\375\016\242\354?\370#\330C\215s"
+	.string	"\002%\026$\302\320 Q\260G\206\246\t\fQ\2032V\221j\322WB\321\216\035A\032\017\362\370\203EA\243\340\016\26077d\262\326\021|\"eM[\326\357\200JIT\351\350\353\257\006\027\222WP)\311\033\023\240\032\260\224FP)\230\024\274\021\304\021t\n.\005\237\202L\301\034\301&\f\r*\005m\254:\240\204A\312\240\337\201\320~\t\276\375\022\321\375\022d\366K\304m\365I\347A\032\351\023+b\240dm\200\027sX\325\022i\373\017\016\005\337\364,\251\bW\034(0N\360\315\3204\001*f\354\206Txj|d\345?`\335\220\312\210\r%Z\262~\211\256\375\003\341"
+	.string	"\375\366\364~\240\301P \032\240_\206&\013\220\261\322\227{(y*\215\261\245E\335\374\351\0270\r\220\017\330u\305\243.\353\275b\224\323\224\257\254_\"\307\0177),5WX\357\373\214NE}D\243\3007 \321< \033\240\036p\r\260\r\020\017C\201Q\340\035\022<$\273\242~\211\032\373$\306l\226D\226\375\003\317"
+	.string	"\313`\0012FI\326\307]\030\370\005C\201_\200e24M\200\212\233\350\333\224c\003\273M\326\244+\307\220\314\031\023 d\376\224\312\372\006\254\033\006\323D\001#\225\365\230\227}\352\013\353\312\372$\232\030\325p[\302\002\206\001\322\001\343\200b\200r\030\n\234\003\202Ii\300\335"
+	.string	"\316\351%zjH\022p\016\370\206\325\306(\035\301q\201\3108\326\332\230\f\365I \331'ac\237\304\320\276N\337\276\016\231} \027\flk\003rQ\221\336\327\251\003\275\037:^6\220\313\246\241C\246\3010\257J\0216\266\003\271|\031\322\345F\326@$:\007\262Uq\203\303$k\251)=(4Y0\024\230\005xe\023\025\275CK\326\250\222\230\224\2168JhY_'k\377@,\300+lL\332\230em%gqj\362%\353\353Xm\240\232^\002\274\302rP\357\353d\2008JbR|\3005\f\005\252\001\323r\204e_g\210h}\035\035\373\007\242\035X\345\032\310\006\242\232\b\031\2225\213D\347@\264\036nA\220"
+	.string	"\3176"
+	.ascii	"G\211\2158*\007\232\375\351\022V3\034\263\206w\225u\252\245s"
+	.ascii	" \2250\"HG\244\0348\345\007\222\001\313\002E\241\323\203\212"
+	.ascii	"\031>\313\025\234*\232\356\2126\207\205$\362\205\217\017\362"
+	.ascii	"\204\214fP\002\027Z\237\027H\0271Ve\260=6\231@\301v\207\371\243"
+	.ascii	"\333\343\nn\223\tDt.\231J\027\210\311\266.\222\305N\020\362\305"
+	.ascii	"n=\240l\321z@\331b\273\2739\334A\266'\370(\221.\334a\353rp\227"
+	.ascii	"\312t\331\002\255\300\303Da\251\344iI\350q*\227\255\017P\313"
+	.ascii	"\242\004\t\250pqb\204c\t(VH\341x\202\305\261\205\n\f%\264\311"
+	.ascii	"&\323\204\326\311\3649\341\343\023\344Tnp\227*\230.\234\255;"
+	.ascii	"\203\004\027\311Ljh\227J\024\222<\351{B\270\316\343\260E\213"
+	.ascii	"\235\245\022\306\206\036g\220\217\t\355\217\322U\372\370(\177"
+	.ascii	"\326e\013\264"
+	.string	"\302{B4[\240\266}!\202\251d6\223\312\024\332\037\245\213\226g\002\247\362\002\267u\376\264\316%\363\347\207\231$Q\302]\252x\021\324b\006\262\331D\022?\320i\321\001\t\022ha\342h\302\007\231\354q\221?\"\\\347\222\231T}V\t\220\340\266<\023\214\340\266<\030\200~\222?\355\317J\242D\213\022G\022<H\027\357\t\321\036\215<K\245S\205\214f\333\034AF3\207\002\022$\360\201\216\207\367\204pJ\340\036[\017(\235\253\217O\320r\311\\\262-0\233=.s\311\302@\266>\272m\006\001\351e\353\323t\235+\317R\331t[h\200\341.\225\315\025\355\321\031\344\"\335\026m\022\t\324\242\331\302\200\021DB\033\243\331:[\026\0278\227\021X*?\220 \001\267\345!\262\354{B\240\340BE\013\021,$\231>'\332&\363\204q\307\211\234@\273\303\374i*\221\032\332\243\033\004\264T\022g"
+	.string	"1O\270\357\t\001\024\304l\362\034\221M$\220\210\3442\310\004\341\022FV\235G\036\240\241{\\\362"
+	.string	"\251K\036\240\264\365\200\322\251g"
+	.string	"1\223\272\351\002\245'\316h\036wZv\247u\006i'{\244\213\3349\362"
+	.string	"\205(\036[\027\351\003\364\323\272p[g\313\202\007\310\002W\271T1\024n\320\260A\002\n&p\006\340\002\206\n\006\320\272H\024\355\217\322\005\220\205\253L\3416\231=\316\013\357\t\321\376 U\bj\350\341Q\236`d\302X*\2353Z\374\004\251\320\272H\026n\233\342\207\271lQ\254\230 \247\205\333\246\330i9"
+	.string	"1]'\007\345N\t3\220)\024{\234\312\245\322\004\024*\340a\242\260\263\034\201\205d\333s\002\250\023\242\375Q\272\0206\231.3\205\245R\002\024v\332\034\243\263u\261T!A\353\002\265-\t\256\023\211\302\212\f\210n\023\351\266\330"
+	.string	"\304d\242\260bD\b\267\211\004\n\341L.\2211vF(@\263\025\001"
+	.string	"f\023\371B\363 \177\322d\022\2312\2333xt\213\235v\247mU\200\241B\202f\373\243tQ<\266?Jw\031\324\024\221\334A2}\210\316\031\313\021vZ\036\036&\n\023\360,\225,Z`\242\260B\233\\\266\315\026F\313\"C\373\203l\302@6\335\245\n#pD\210\235\266]\n\337\023\202\251t[\236\235 \02268\333\037\244\n'\344\270\312\037\031\300\235e\353\324\260\022[\254H\201\301\330d\256\2101\002\317R\351\214\300\fd\2639\302\b\t\332\236$\362\2042\210\204\367\204\340\tz\321\356\210\330\361Q\006\275hw\230)"
+	.string	"9\0307\254\300\340f\330i{\222\310\3442\002\256\263u+P\241\002\303\n\036e\f\344RD\373\203l\232\320\3760Op\002\245\340a\242\260\343\023\304\354iQ\301\223\312f\273ly\366;\370\200\203\017L\310`o\002\204\021 \214Xo\002\004\035\035\020>\320\331\377@'u]\327u]\016\256\353\272\256\353\272\256\353\"]\237\026\205\005*T\260+\366\n\326\271T\"S\310pB\022\350\203\304 \205\023(\205\333\3560\223\313vm}\200~\224\001\330i\227<\312\026N\345v\223\312\235\266\t\304:[`\372\264p\221(\210\007a\304\b\027:#8\320\031\301\301\210\021#Flh\221\301u\231>J \242{t\246\320\036\233\314\025\033P"
+	.string	"\200\273\303\374q\225/\264\363\310\202\023\371\343*I\220\301|1d\301\211La\311T&\233\033\332\343\216\n\031\314\027\254\233\301\t\304\023\234\321d\272N\345\t-0}\234B\367\350\214@\373\243twqg\311<a\302\004\357\t!\002\206\321\331\232\260\323\372\274@.[#\262\370\323D\036]gS\t\343\270d\036}\220\311\236\244\253l\301y\364\361Q\262\220\341\247\211t*w\216L7\b\211\301\270s\344A\376\030y\220?@\036\344\317\220\007\351\302\005\nj\016\231\315\326\002<\310\037\026\203q\351L\036\225@\316\241\361\230$\241\274\320\372"
+	.string	"\375 \235\030`"
+	.string	"\371\034[\247\222\271,\372\2641\\\037\344\021F\362\310l\"_\b9$\223\310`2\211\004\266Md\013;Md\3171\231D\016]\367\b\243\335\351\360\236\020- g\244N"
+	.ascii	"8\223\312\037\344r\006\n\016\314fk\201d\022\311\2720\332\235"
+	.ascii	"\243;AO\322U\002\251N\037\037fS;\333 \037d\2145\350\330\223t"
+	.ascii	"\225+v\226#"
+	.ascii	"\370\3700\233\032Z@6S\347\217\262\351\"\203\363D\262\231a\267"
+	.ascii	"\200\2341\304\320\362\270N$\214\343\216\017\263\347\350\372 "
+	.ascii	"7\264\200\234\261\301}O\b\240c\353\"\233\"\22200`\001\3316_\034"
+	.ascii	"\221@n\261u\221,4$\233\254\211\326E\262H6Y\023;\312\024\232="
+	.ascii	".\333\354q\267\263u\221M\025\205\212\025\315\036\027\313\031"
+	.ascii	";@\023L \031%\264\200\254@\262\031\334Q\002\t\235\3166\311l\002"
+	.ascii	"\035w\224@\030\230\315\031<\303\340\013\245\017\362\204\273l"
+	.ascii	"\177\332\030\314\024\230\315\031<\027$\2273\2140"
+	.string	"\200|\216-\320\f7\303\005\017\364\260@\242\304\261u\006\025[g\320\221\351\nutH\034=\320\263\201\304\321\205\301t:\223\312%\363\247\211\354\311\361@\317q\251\374\341\320\001\240\346\205\367\204P\231\253\373\236\020\315V\351\003\244t}\202~6\234@\321\"\247\365A&\235.\362E\f\240\0172F\f\345\216\263m\272\310\0271\210\357\t\221\234\340\247u\2353\234Ec\353\"Y\2641\224n\022\211!\350L*]\247\322E\272\316#\013N\244kl\177\224.\332$\262\231\202g\251\374i\216\260\\\241\331\266\300\004\222\240\331*a(\335e\273\243b\247\211d\3720\233\356\222\231<&\233\"\2220<8\217(J\\h\201\351S\354\341Q\366\030wJ\370 \233nP\273\004\036wJ\354,\221/v\220\355\216\006\267\375Q\272\020:\217\026\264\256\n\036\246\317\260\375\tr\266,x\226J\036\036\246\0171h\203\353<v"
+	.string	"j[\022\222\313\031\316\355:\221>@\347\021"
+	.ascii	"N\036\244\017\f5\350\276'\204\023F\273s\344A\372\230\340\"\231"
+	.ascii	">0\200\316\343\321]\2661J\340a\242@\200\026\332\345F2}Lh\241"
+	.ascii	"]\022\227A& 3\270\313\366\307u\006q`g\204\2452C\353\"]\022\210"
+	.ascii	"\253\373\236\020\315\326m\177\230M\344\213\023\314&\362\305\206"
+	.ascii	"\326E\372\004%}\220I\340\352\002\005m\327\005\n:n\240\025\230"
+	.ascii	"M\344\013\"\263\211|\001\004\n:\272-\317\3326\203\334\326\005"
+	.ascii	"\263\211|\341t\"\201~\230I\344\217\272T\372$[\024I\245\333.y"
+	.ascii	"\220?\032\336\023b\311T\"\007\340<&\223H\325}O\210\002\270\304"
+	.ascii	"\245\t\254\363\230a\007\331\262\b\002\372\331\320tW,Mh\266\256"
+	.ascii	"S\311\323\262h]es\002A@?\034\226&\264\256\262\331\002\333\f\n"
+	.ascii	"\002\372\271\340*\227*\226&\270\312\245rm\272+\222\313 \023v"
+	.ascii	"\220-\213dr\204\r\316c\214\026E2\211\334K\023v\220msu\235G%P"
+	.ascii	"\013\030-\212\026h\206\213\243\212\025-\204mr\211t\235K\345v"
+	.ascii	"\217+\250\320K\345\212\2453\271*\201\234\351{B8\203^tp\036O\220"
+	.ascii	"P!<AB\005\320\351l\233;;H6IB\231\006\035c\264;\316\240\027\333"
+	.ascii	"yD\341\fz!l\201f\270\316\240\027\2543\350E\232B\347\230L\"\327"
+	.ascii	"\026\220,N\240\030amw\230'b\264\315\341\214\035d\313\002\351"
+	.ascii	"\"w\200\256\361\310\276'\204\233\fj\272N\022\316\243\214\326"
+	.string	"\r\372\301\300B\222\351s<\256G\266\331.[`\036\217\254\263\331:\203\226\307\343\336Y*Y8\036W\347R\t\344<\036\331%S\351T\372\264\307#\320=\272N\245\317\205\367\204p\266@3\\\016v\332&\262\307\311\201\b\247\253|!\"h\311\303\201\214\240\245\322\207\203\016>8~`B\206\210v'\310'\271T\212h:\203D$\300\225\321.}\220\313f\353.\225\307\035d\333\354q\201\216\307\tb\264M\240\343qu\235J\237\343qE\272\310\235\343qm=\240t\036\217+\013I\246\217n\217K\036\245\017\362X\\\362(}FH&\221\333}O\210 \240\237#\2639\203'\231D\032\240=\262\030\341\301\210\017\202\200~48\333f\320y\334\320\036[\004\001\375\bW\327'\310\331\262X2\225n\262u[\024A@?\031x\226J\037\240\037d\213d\022\251\241M.Wp\235\310\026\005w\204\235\326E\356"
+	.ascii	"E\300\251\354\360\236\020\314\346\f\036fs\006\317\332\376(] "
+	.ascii	"&\023\005\267\345i\"\335\"\214\355\356(}\220\0220AF\223\303N"
+	.ascii	"\313B\022\t\264:[`\372\264\330a\246`t\362 }Lh]\244\353\f\266"
+	.ascii	"Nd\317\212\026\006\322\351\243D\302 \356\2641\224m\262e\341\203"
+	.ascii	"\\\362([\310h^ \272\357\t\341\006\001\271A\314\343O\013@\"\234"
+	.ascii	"\3156\206\262\271s\201s\215\321\242h]$\213\341\212\013*~Z\300"
+	.ascii	"\360\323\302\212\2356\271\234\341\\F\240u\006\025g4\335\366\247"
+	.ascii	"\365i]\270\314\036'\212\326\031\204!F\273\223\266A>H\t\270\255"
+	.ascii	"\023\006\214\025Z\237\035\025>HW\311\243\334\221`\251\374\021"
+	.ascii	"\2722\220?\302\344R\371\023t\227A\314\023\255\017sE\321m6\225"
+	.ascii	"K%\214\026\305\216O\2534\241C\373\203\\\352\265\375A\252Pl\""
+	.ascii	"{\222\272\331\356 \333\036a\020\226\321\356,U\354\370\264J\030"
+	.ascii	"\301\366G\351\302m\"]'\320yD\272H\024K\246\322\r\362a\266p\002"
+	.ascii	"\361`p\337\023\302\t\304#\202\251\334\340\372 S\3471\311D\301"
+	.ascii	"\t\304Ct\221>\351\222\351\223\366\370\370\244\355N\220\253t}"
+	.ascii	"\220\307\026+R\fw\332\026\250\205\260u6\203\230'v\226A\314&\317"
+	.ascii	"\020\210\271\323\243WW\351t6\365R\211"
+	.string	"LAC\373\243t\365\n\025(\216(T\254p*e \201;K\344\317\017\363D\262\t<\201b\004fs\006\017\333\3432\231?-\222I$\220'\350E\273\243\252\314\030\315\326\251\272\310\0271\202\256\263u\221(\264<\310f\013\364\203,\272>#0\233H\022X\366\004\212\021x\220?\353{\002p\341\207\271lw\216@l\233T\306hwV\327\331\272\307%\223\230L\"\217;Mf\262m\006\337\023BFS\204\214\246\006\031\315 \020\362'\331T\233\355\2162\006\263\tt\224\321\364A*\233\255\023\303\222\251t:\203^8\2132Z\037\240 \0240|\220=A\037f\222\3512\233@F\367H\242\304\216\022\350.\203\230\311#\214\346Q\t\344<\312hN\320\356(\233\3156\006\363\270T^\340\036Y\036\244\013\246\362\310\023\344\003\224\203\301m\235m\223\351\006!\217;K\345\213\243\213t\036\177\202\232.\013-\220\023"
+	.ascii	"\303\326\007\231t\006\335f\033c\251<*\235\316\2460\331\334Q\376"
+	.ascii	"\250K\345\317f!\331\366$e \177\266\321y\302\007\031\303\207\t"
+	.ascii	"\324l\335\245\212ds\002g\3336yZ\024?\310\0231\200`dp\2211\224"
+	.ascii	"nr\004%2g\251L\266\316\240\243\f\344\317QFS\350\323.\227\310"
+	.ascii	"\236\344QF\020\362(\003\371c|O\b\021\316&\323\271l\235\025\310"
+	.ascii	"@.\225?\031Zp\221/bH\340\343\323&\335e\353l\233@.s\351\"_\304"
+	.ascii	"\350\320\036[\036\244\353\303\214\221\241=nh\223\315 f\213f\353"
+	.ascii	"\266)\270\313\266\331\fJf\230\341*\223H \344\211\031\315\326"
+	.ascii	"u\221/\214.\222\004\t\264\316 \242\323m\266>#\234h\235A\033Z"
+	.ascii	"\036$\317R\271l\"'\260d*]\240\237 \347\222\231\364\340T:\333"
+	.ascii	"f\353:g\364\270\310\0271\212\316c\353\243\204\301l\256\330Q\002"
+	.ascii	"\r\335\367\204\330Q\002\345\240\300\316\243\211\035%\320\272"
+	.ascii	"\002\253\300;J\240\264\005\344\214\240\007z\2160\200|\206\036"
+	.ascii	"\350)\302\200\301t\203\222\307\236\244"
+	.ascii	"\313\\fh\201f\270\307f\353\372(a\0341\270\3136\331lW\270K%s\005"
+	.ascii	"P\320\316R9\201\t\204- +\360\023\324bG\tT\\2\225.\322\271l\201"
+	.ascii	"~\230'v\224+\\\344\213\030\032\226\312\024\334\021v\224@\027"
+	.ascii	"Z\037\236\345\b\306\031\2562\206\322U:\227m\013\2376F\353s\301"
+	.ascii	"M\2660"
+	.string	"`hhw\230?G\267\331\002\311h\217\256\217\322=.\231\036P6\231=9.Z\037\327e6{\\H\260T\"S4\231.\262\331\3764[W\271\201\251t\221,d }Z\026\031\334\036\036e;\201\026?\315\326\335\321\300\242\005\344\f\f\256\362G\211\202O\233L\216\320\272\310fq\207\347\302\216\017\263\307\3316{\334\243\273T2\201\334\326\231\323\376(\335\240{\374@\307]*\203\366\f\244O\273#l}x\226\310\r\255\213l\0365\264G\026=Nd\363\304\216\022(\303\214f\033\203\231l\233\307\036'\262\231,\276'\204\b\267\207G\351\003\203\002\347\221G\tc\311<Alw\230)4[\031\312\037\240\017\223I\302Q\335i\235\3156F\333<:\233L\227\371sl\0019C\303\003p&P\333\024\3412\231M\021B\347\261u\221n\013'P\212\f\355\017\263\347\330bE\212\275\323d2\223\307\026+R"
+	.string	"\335\243\tw\251\fb]d\213\237\240\345\261\305\212\024A\367H\242\204\273T\262O@\002N\\\020\001\025R\354d\b\031\314\027,$\221>/D,\225\310\037\021\311\246SD\b\013\376_(j\022\002\345wv\201\350\302PX\024\372\314\372i\326\305\244\251\351\202\320\2057\2055whR08h\270\351\3533\306\301\027P\275/\326K4\306F\0348\031\007\231\027\"p\336\254g\252\250\025\361\013*\001\206e\275]~l\224z\227\345G\326X^\236\221o\215\002\210\326n4\341\333{\216Y2d\257\215\372#\255\211\214^pJ\004T}`\364\264\026\342\016'V\352\262\276\004\236\334\335\031\361p\023\336"
+	.string	"\316@\311H\031\361\214k\262"
+	.ascii	"y\227\2541FW\2201\342S\023<\0224\372\363\213R\2236y\372B3$\353"
+	.ascii	"K\240\310\376\215i\212\257\\\224?#Y\033\317\030\317\224\221@"
+	.ascii	"\215"
+	.string	"\375\033\315d\275J@\212\312\260K\330\213\256J\312\256XD\\\343\325&\t\031!\021\220\315\017/&uC)\3032b{6\306\024\237\004\341,\201\343\023\023\334\213\203W\206%\353\271\271;<\243\234Q.\230v\202\220\022\026#\234\021.\230\006|\233\334\312D\240k\377F0+\2345\213\035\220\036o,Q1L\224\250<\267\342Q\222\324\235\337\027*5\322\226xdm\324\322\342\305\245-(E\323P\"FK\227 \224\350C\314\217=.Q\334\362\226|a\013\323PA\304\272\266\004\277\244\326\310iqb<\2434f-\013p\212\2173]\266\262\326E6P\345kK\351\312\020K%\0026\306\315J\260Km\243\372\"\266\006\005\007\261AE-\270U\344Z\243\002M\033\n\2713\342$\246J\261H\030X\331kD\033>\t\227<\263\030\235\r\231\360\021#FUf\300-N\266\2665*\\\212v>\266\362\246"
+	.string	"\225\254NJ\304\210)\223\252\213\276Q#\003V\331;\214\240=\244\024\255zh\331\022d,\210U\354A\305\215\213\361\353_\306\3473\f\275/\321\373J%I"
+	.ascii	"T\216\017\277\021\354\306\2471\212\0218!P\242\030\305\254\204"
+	.ascii	"\b\265m\241\247\227X\030c\030\253'\206\204IV\004\206\354\337"
+	.ascii	"\350\265\377\240@\205\320\310\272\b{\004\306OG\326\232\350\013"
+	.ascii	"\216(#\024\"\306(\237\036\231\361I\225\346{#&"
+	.string	"\304\350D*\257\271q\3523nq\255W\230\242L1j\t\221\312$\rY\323$h\004\210FL\236P\0261NIK\030\024,\342\\\006GJW\230\004\213\270\221\035q-\t\016\351\243\202d\351\271E\205\253.\t\321\314\024\276\265'$V\0210\013\343b<\022\004\242\307\024\2753\032\001.\345\2711,y\306\253\242R\352f\305\t\024c\221\340\222-\027\245S2\022)F\261t@\354z\030\207\030\205|qY\262\227u\017\035edkY\233\305I\215\212\300\367\255\372#\343\263\001\266\247\204\365\276\3176KXd\306\367\r\2231\207\t\032M@&)Lp\220\204\214E\\\372\376\342D\215RF*c\020c\225\221\207q\207\021\210\321\312\370\3038e\2142\3520\3660Ba\250\321G\221\207\321\2071\211\317X\303x\303\003\021\222\n\250\273h\321M\215\250\321G\261\257\370\306\006]\022\206c\364a42\"=\t"
+	.string	"o\207\031\2425)N,\320F\034M\224\300\276\262\276\0135\373\030j|2:\261U\021\272\312\37276\335\350\224\2029\242E\206\367\242hA\021\311\372.\304\354\337x\303\270d\006EcF7!c\205\211Q\311hc\025\243\273\372\222\365]h\331w\221\266\357\002j\334[\312\253\313\372.\236\030id\031\211\206[OLK\262\276\013\253m\034r\361c\337\305\323\276\013\243\375\026|\373-\324\354\277\370\246\350\247b1\031K#g\034\306\371\242\013\222\365[\324\355\267\360\262\337\"m\277E\224\375\026M\366_\324\023\236i\343\212kZ\263\246\310&\277T\357\213\305Ra\022%\372\"\336\213l\206aLi\324\262\276^0\211\231#\3213Y\277E\220\375\027\243o\3069!CK\324\b\207\034E}a\313\272\210\246\230\346_\363\021PO*\225K\024JH\326\307_\263\216"
+	.ascii	"\177\315z\f-\236\t\246\221\200\2474\304L\225%dg\310d\375\264"
+	.ascii	"\350IE\226F\344\345\303\016\330c\nN\007\220\254\213c\322\021"
+	.ascii	"\374\375\375\375\275y\337\241\342\230\\$S\254{q\314\215\254\035"
+	.ascii	"\027\322\320*&\250\346\252\313\024\235\025#\036\330\221\2529"
+	.ascii	"\242\236z\026\306\310M\030a\024\233U\344\215N\016\357\255<\214"
+	.ascii	"\374\252\304\005\251\364{\367\345\017.,\250\344\206J\036\030"
+	.ascii	"\246t\257K\026\032o\304\261\240\017\242\25067\"\017M\206\306"
+	.ascii	"\r\234/D\034E\276/c\222\274\244R\232@\332\370\262.v)v\t\266\235"
+	.ascii	" \304\344\325\302\306.\262\301\221\251\263\313\372-\216\366_"
+	.ascii	"\334\022lS\361|4\351\242e\237\335\311\331\310\022,C\361V%-\353"
+	.ascii	"\r%\253\210_\326\317\214\346\343\255\210\225`\223\341\03355\177"
+	.ascii	"kD\032F;\252!Jj\301\267\342\032\035\232\2734\242\215tNH\023'"
+	.ascii	"U\202I\210bq[\316\320\240\306:\"bpgW\3049!Y\306\230\001\275\206"
+	.ascii	"\b\241\022F\244\fM\307\024\254\262\262\254\246\262(\303W\216"
+	.ascii	"\310\034\031\322\320\252\251\314\020)\3003\247\2541c\254\020"
+	.ascii	"\242\236\031\253#\250\221\220\314\224\267\263\247\231\326\023"
+	.ascii	"\003\006G\2241\241Q\323\233\221\030P\210\nEj\203\026\026D\202"
+	.ascii	"\343\206\\\020\260\341\2265\\]~Y{y\255IX\370I\225\032\223>.\256"
+	.ascii	"\266\225i\253\212\030:'N\212O\362\204\\C\306\260\262~2\367T\346"
+	.ascii	"-\323\322*\026\261Q7\254\332\270\350\210\324\260\221\365Yh1a"
+	.ascii	"R\314\302c/\023\376\302\344\365\205K\230\004\207_\025\326\213"
+	.ascii	"Y9M\313\024\024\270\032OZ\244\244\224(\t\246q\360\032j}e\341"
+	.ascii	"e}\026FH\220\254I\035\304\212J\2460\205\311\372\020Xc\304\b\234"
+	.ascii	"\206\202\002\006G\326\207\300\333\220!\305\"o\001\220\030\250"
+	.ascii	"D\345\316\324\306\347\224Q\020EJ\216$\031c\250\212"
+	.string	"J\203\0023\025"
+	.string	"0P@\034\021\310\304qS\r\024"
+	.string	"\fW\316\200~P\252\313Q\026E\f\021\t\300"
+	.string	""
+	.string	"@\001\r\341\221\233T\244\244\325\322\232\002\220\032n\364\221+\363\205\335r\224\026\025\211\257\016K5*\340\202l\376\265T\324\263\307\260\213\231\261A\250C*\270_\244O\203"
+	.string	"\230\037_\0329\017\367)X\307v\343\321{\340G\214\031\227;\2070q]w\\\267\001\302b P"
+	.string	"H3\362\222\006d\367\370q9#\330)P\313\243\347\364+Me\b\233\231$\300\326g5u\267\260 \234\3555\314752\270\031%\346~\212K\225"
+	.string	"\230\313\030\247]\311\302\231\327\321\231\364\036\340>\277"
+	.string	"\356\037\373G\357^:*3z=.\261\351j\270\231\215'\373\3678\347\0323Y\303\307\233\203\371\313\370\020\245\260_\220C\020q\236\022\flC\251+\241\215\300=\352%DV`\372I\201ApT&\201%\"\221\023\242\272\213y@\025K\352#\343\247\260\247\256q\355\200XN\235\256U\257\314Q7\366\300\271x\217\371A0\265\301/\241\231K\360o\017\226\353\350\354\324\225cD\306\323\004\364\203\363\330\371\r$-l\254K\031\005\266g\244\004D@g\300\241+\266\357\320\251#Z"
+	.string	"&\336e\007\235\307\016|\270\3156\032\003\tu\312\240{\270\317m\026u\255\337\204\303\262q\033 \234\033!y\345\302=54J\252\200\313\221@\250I\001\214\326L\333E\004A\373\005o\376\007e\343\t\317\214\023x9\202(r\347\310\200K\212\315\317\256\220\214\346\343\243\265\346\233\\!\203\234\265\307J\356P\313\204\341N\314\310(\n\264?\346\323@1\234^\005\372\320\345\r\201f\031\263\223\304\235J\006\020h\322\334R\311\260\254\016\202\013\377;\005\210\373o\006\251\275\236\2162\326Z\371\034+P1\326\254\240\265\027s\007\231\3262\303\343;\255n\b?\252\001\234\373\372jo"
+	.ascii	"\241\347\214\340\222\002\242\3762\336\353\341\0354\344\013\360"
+	.ascii	"\022B\320\222:\266Nz\201\265[\304.\321W\320\336\220\327\237\246"
+	.ascii	"\242\227$\255\020\024\261a(w\332=\263\267\313\207\036f\200%*"
+	.ascii	"\347\322@\342\360vv\325\2432R"
+	.string	" \024XV\b\"\370X\213\302\025\242y\375,\343\005\354\224\301\241\370\034zL>\270\357\177V\256rG\227\210j\032\202\034\036=\001\3259<\2055\321\267S<\3233\3759\306\023\025\001\333.j\311\256_\305\2700=\210\246\371\370\244\350\301b[X:4\350\255_O(\261C[\352\215\261\365W\022\235\326\005\307\345\207]\016\324\341)U|\261,t7'\373{I\206'\2437W\r)\247\006f\330\226\303\020AM9\374[\024|\275\013\365\204\234\220lE4\350\264*\253\004\336\235\205\233\333[\270yp\030\275\341\364\313\257\356\361&{\225\026[\345>\366q\226[\271\320E\006\231\231\202\251J9\231\302\177\0373\005\327r!\221F\226Y\027\340\325\201{$\352\2508}\232(Hb\267\002\220\307\250\022\230MI\276\r\340\246\276\220H\270\f\250p\177J\375j\320\314\335\366\273\265\346\221-\024\240\202\020\250DR"
+	.string	"VR\244\035\246\334\374\210z\223\211\004\230\270\256\253\207\363\023\211\251\b\034b\343X\277\250S\220\335\036\227\026 \240\024\260\324\201\005\263\036\214\220`\214Z\334\020\250\340:y&ysP\327\263(\021\023\252\2309\3345^\212r\341\0230\330&r\314LY\261\027\206W&\367\202\372\006\275\021g\001\267\322\221\353\377\273\3129[\312\022\344S\0212\267\312\231P\234.4t\225\335e\0213\312\347_\241\241\341\325x\233\251P\373\024\375\216\360\212\3008\250\030\003\246\367vVi\033\024\244$\227\006\b\344\033\336cg\356\013d\242j"
+	.string	"7\224\271\235\177\256pT\334y\313e\370\030\227S\342\201\234\215\017\354w\261?2_\332E\317q\017\240\345\361a\226\351\032\244"
+	.ascii	"\335\024U\367\345\376&\240\300\027"
+	.string	"n\221\305\323\242\217N\235\310:\350S\217`0\364S\177R2=/@m|\220\b\203\\\262O\"\252Q\244J\2648\356\256\257N\320f\357\032Du\351\345\371\214\210\254\313\245\347\\\320\236\025\211\005c\275\321\006e\355\345\363e\217\355!\003\227\035f;\252\020\317\254Y\342Z\304\250\261\373I\022?\n\260\030\005l\206\t]\320j\003nk\320\033\227\205\360F\367\007\177M\265\365\313 9\005R\251\352\326\366\375)8\352\211\264\0033/\353+\273fY7\263P\360N\247&\300\257\003BF\323\250\270\346W\262\360\240\306\366\315\237\016JQE\2060\207\371n\310\271\235\356\246\261\366\230K\271\030\030b\374\272\2371\005M\303\277\323\340\330\345]\332\340t\333\036\256\257\261b\217e\311\217V\002\302\352\001G\224\235\214\314\237'\307\202Ctv\27156I'\307\215\2427\353\237\327\005\377\205\232\262\314\376\245\212\361\205c\001"
+	.string	"\325\t4\256hx\r\230@\004\353\371F8Ac\350\226\265Cj>\\d[\267\360\\\355\342\306v\345\251hq?\211\354P\223#\005\007\303\335y~9[k\356j\300\310\360\371\272o\327L\220\036:\277\227\264\347\226\354\351\032q\252v*\001w\365\326\345\244\306g\304\367\007\201\303\302\222NV;\301\0077\024\031A\020\303`\013\355\030T\b\306\303\353\363\251\221\364\312\t\312"
+	.ascii	"Or\013\267\235$\207=\355\255\304\300\361\006\264jq\323\214\301"
+	.ascii	"\310\345\372\266\021+g\225\351\274O\341\252`\t;\3201\033\rY3"
+	.ascii	"\327\376\365\210\256\037\021\325@\352\202\231\3549\262=\013^"
+	.ascii	"\030\337\311\t\340\016A\"\275zh\001\364M\254\342I\202}V\026\264"
+	.ascii	"\250W\021\226\321\272\232\337)\312-\323\347dV\020\3607,\372\275"
+	.ascii	"\004\270z\310\245\260\034XB[Dm\344\324\360j*M\236x\017\025\036"
+	.ascii	"D\212\024\023\360!\261Xu\202\240\250\255?H\321\275B\002\262p"
+	.ascii	"\037\365\021\332\315\371\276B$W\032\252\351\376\224\003I\332"
+	.ascii	"\362\333\277\003\201/\244@\342\333\355]\365\025FP\350\270u}2"
+	.ascii	"\325<\250\266\255\366X\312\001\233\315\350\337Wu"
+	.string	";\331\256\310\241c8\302\267\256\216pD\314|{\255\271\301``3G.\260\326\351*2L\356\035\326^\023\335\344\305F\251\312\032MJ>\206N\240\017<\300\201\2104\373jj\252\222\022\335Z\333 F\264\216\335\305\242cb\253\016\221OL\216&\361Z\237Z\317\306\020pq\326\322g\223\231\367,\005{\226f\027\001\334\005\226\212_\323\342Q\335\257\035no\362\333\321]ie~\205\325\275\220V\262p\356S6\330\300\006U\321\207\367\205\037\2634\234\016\271e\254\314\300\326\352\"\244\304\016\244\260\363\277\320`Y\261-G\233\037\213\222,\345\225\233\206\262\025{[\352'94\221\037\334}\222\242C\207\261\232v\226\3672\371+\237l8\225\241\354\3108\246\260Q\024\366\250ja\037A\\t\270s\252\"x7\337\243\307\005'\264@_\037\r\036\263\272D\0261\226\355\007\177Q[\275I\030\366\207\333\366\355\177\253"
+	.string	"\350\2247\346\013\245\257\373\265\006\274\003\273\330\251\377\\\376\337\317V}ii=\232\232"
+	.string	"d'I\331\031@-\246\222\207\366\211\033"
+	.ascii	"$\313J\374\226\237\207\322\230YQn\317\354\316\264\255\022}\313"
+	.ascii	"ZD=\270:O\233C\177\343nw\237\214\b\302\257T\207\2569\267D\220"
+	.ascii	"p\202wf\t\022\26322\256\021\005"
+	.ascii	"\341\216\202y\t>\"\353\261Bb#o\213B\373\f\201\323k\377<\302J"
+	.ascii	"\251*F\276\\"
+	.string	"\335y\313\031/F\272\225|\375^\324\360r\333\352\310.\361Gx\274%\323\216\001S'\253\257\020\215;\212;\251\354\324;\252\236\331\201a\254\207UF\207\260 \330\245-4\210Ps \321e\\2G\346\030\346\355\227\233\325\f\031wD\271\"wv\304k;\253\324I\037l\\\364E\036\025\221\017y\271\333B\316\023B\336\374\320B!\0265B\005B\363\"\r-Dc\262\240\004z\037\211\375'\023\032v>;sg \233\273\240C:\264\217\240\275\356P\262\232G\345Y\326d\026\3635\2018\313\202y\205w\256\2003\311f\337\321\325\325W\275\226\036\216_\223\302\355\330\323\205\347\300\030\337\352\347\030C:\363\003\210F\254\265G\324\272|\336{eQ\251\375\320`\315RQ\365\257<wr9\353P\320\370\2415\002\370\223\356[\024f\350\262bN\360\332\226\255z\201\243\020\0264!e\314\276\261P`s}3\370"
+	.string	"<\223\220\003\340\2579\262\241j$\230$\254\313h\030\023\024\357\302\270\257J\355"
+	.string	"\372\335td\227\371\320\312\255\256\243\223m\343\002u\007\226D\261\243\033.\350\310n\351e]\240tt\230\t\243\034zZ\344t9\324\215>(\210_\374\023J\271\f\310\r"
+	.string	"\200\"X\273\266\203\342\251"
+	.string	"\271\352\211\261-\325\276\223\270\007"
+	.string	"\360v\003+\026\013j\255\247a*n\257\261$\257\355a\253\312\330;\275\325\256\256\305@3\304l\335\242\376\372\363\263\007h\311\032\377\343;\376\215M~\327\005XG\244\315\340\002\006\253\336Ub\205\004\031\273.\357\035y\r\265\216\350\350\032\004,\232%\336\351\340\231\245\242\244>\314Q\f\337\311<\003\334\002\270\374r\023z\257\n\226_\355\307\253\245\242\344e\337H\370\203?\007`\026\370\217\335B\021\257\032\013\001\353Q\201\"\366\335\035\301\306*e{\226_\352\216\260}\344G n\026\366\377\345\217&5W\303\236\214\302u\007\360\ri\367\301I\f\005\227N-\032\027\r:\337\261q\366\322\323'\234\214\201u\261\\BK\340\304\341E\347\365Q\321\036\322p\327\324\024\003PJ\233\247\240?-\251\305\366\336"
+	.string	"3\033KE\354\331\301\335F\347\b\211,\325V\352\365\212\222\027\343\261\211\241\320l\212\251d*\367\272bqZ\016\232\210s2\t\274\013:Y\024\372\334j\366L52\361\213\224\344\300\362\210\\\020\314&\245"
+	.string	"\b\236CqP\372\276|\332K\370o\234\361\307Y`t\323si\356\024\200\254f\037\200[\372\034\234\3243jfX\220\305\220\274\013F\016\3669\324R\320\304\331\346\241\177\n\273\375\031F\310j\311\024\331\f\326\032\360\334\036\t9\020\036\237\347\2309\022{\030\313rF\032Uq\021\021\367\006\037\212@\345v|)=\342xQ\306:9\301\202\222\2752f\f\330\213@\360\360\365\250\206\267\357iL\310\274\361JS\246R\333X\305\016\323-cM\332P%\271\005\023\210\025\301\202\261\2738\316\227\270\3517\022\317\235\237D\356g\n`\356+\006\367\361\2507&\016\341\027\322\255\374\3201\330\256\004e \274\\\004\\\022"
+	.string	"\231g,\330\r,\310E\360\212\243\215\376\243\355\024B"
+	.ascii	"\252\316\r'_\323\013Ga\367\033\211\226\276e\366Y\273\331\252"
+	.ascii	"\370_\343\031^Fj\243\2577.\213\213[_K\036\333\266\361\215\227"
+	.ascii	".-\343c\267K\201\340\305|\276\214T\222eE\032\033dZ\202c>\337"
+	.ascii	"\342\341\300\232+\346\305\225M\236\340\3072ag\276b\357\321\342"
+	.ascii	"2\202j\320\b\331q_!\341d{+\320\2440\377\212\243+\353\357\375"
+	.ascii	"\232\\f\r\026\233\252\267';\033\321=\277+\311\261K[\243\226V"
+	.ascii	"\244\274\2547\035\240\356C\310\345\244\303\352v)n\332\237\345"
+	.ascii	"]\bp\320\312\2345^Dy\203\216\217\013\315k\242\321_\013\356\031"
+	.ascii	"\005\007+5\346e\264\342kV\272\351\207<\2015\355\252\013*\254"
+	.ascii	"z\366\254\355\302\177\366}[7\n\327lV\0320\244\0058\303|\240\244"
+	.ascii	"\206\243p\217\341\206\302\234\245\227m\b~\310\003\307o\2322o"
+	.ascii	"5x \0173]\f;reNTtS\304i\277\367\272d\230C\312?\345\215\262u\212"
+	.ascii	"\024\033\355.\330]\335\356*\220\361\264eN[\217\242\221\"\f\260"
+	.ascii	"b6l\226\375'\372 \227\034\003\304\377\255\256;\241m\242\326\002"
+	.ascii	"T\203\031\270\236\240\340\251\ny\320XV\374\353,'\371\0053\205"
+	.ascii	"\235\253Rde\264<m\221k\360Q\353\342\034\027`\377\303U\346\306"
+	.ascii	"\201\244\270v\271L\343gH\300'U-\377\335\222\321t\346\246\035"
+	.ascii	"<U\232\371\301\301^\0330k\250>7\361;\366\017\255M%\235\336\274"
+	.ascii	"$"
+	.string	"\0013\322\347cd\f\206\344\376\230\273I\252\215\274\3243\206\361\343\273Y\372\333\037\267\25174+^7\242r\354\237#\215T\034{\246\210A\334G\366Ui\321p^6\311\352A\222\365\315\374\230\031B\r\346\250U\357\335\352j\317\364Z.\320V\234\206\267\202R\207E\305^\177\304\354\231\377\310#>\330\255\021\260,\242 xJ\306\332U\235q\252\021\311\323q'\205\307\356\237\315|TA$\361\275(\316\376{UR&\263s\204q'\312\364I\216\t?~F\212E\252\244>P\t\273Lm8\371\204\252\036\315\271\004\341\275\240j\337\344\2037\326\227\342J9\257\2061VR\340.\345<\353\273U\222W\210\024\252\366l:\320\013\033\024\304q\340\327\005\246\2069\036HW\2103\221W\364\341\323\360\003\352\342f\346de\023\322\"\r\377i%O\306\253\342\030|\004\b\237\002\337!\263\350t\254z'\365\314\210\222"
+	.string	"a^@\366\245k\350\001\226\323\227dB\333D\313*\375\321\372\031\200t\303|\224\311\324\177\256\234\030\2020\237{\351&r1K(\3021\026\317a\221h\236\020G\371\006W\367^\032\270?9c\n\344w\304\304:\273\241:\007"
+	.string	"N\343\024\200\020{\343\211U\243\3228\360I\357\211\211\336\006\033ru\210\033\017\323\363\343g\363l-\241\314{Gb?d7\021\033\236\241"
+	.ascii	"^ \301O\340%\251+s\350\265Bce\253\265\203\022rc\021w\3215#\375"
+	.ascii	"\352\025=\302\340\305\313\225\260a0KHM\b\235\220\022y\330\360"
+	.ascii	"<p\270\227\220\257K\235\357\351\227\346\306\324W\271\004\031"
+	.ascii	"@j\032\223\237\311Q\235\334\3253\372\356S\214o\244vL\371\031"
+	.ascii	"\220\225>\177{\252\274a\3500s5\305[Rb\003S\301h\232\226J\247"
+	.ascii	"p4g\370\305;\2622\026\240EU2C\271\371\370!\204\210,\323\354\312"
+	.ascii	"\207\"\367\234\003l\034,\264\235NE\251\300\363\0233\033\302R"
+	.ascii	"\t^\2102BU\\\314`\003\323\325\325v\263\326\265\226\306\316f|"
+	.ascii	"\334\262\024o\204T:\031~\301\262Sq\032a\177\277\347g\226\230"
+	.ascii	"\200[\374\250\201\202\245\277\354\271\310\317h\261M\022\342y"
+	.ascii	"\260BvXx\356'\313\252\025,\005\206\222\266\nl(\025-t2<\336'\274"
+	.ascii	"H\301\253\3308\204\213\256D)\375x\316\313\034\375wS\241L\253"
+	.ascii	"\027\232\232\347\276p`\342d\307\360\3536y\242\357\355$qd\273"
+	.ascii	"\330\334\240eN)\231\241\240a\202\203)\233\203*9f\264\210r\310"
+	.ascii	"(\265\345\364\024o\006\275\223\326\023\203w\236nZ\005\021\257"
+	.ascii	"\006z\0039\311\006Or\247\264\245\005\274\244\216\377\311\366"
+	.ascii	"\361\327"
+	.string	"\252l\017\365Y\234\317\270\327\242"
+	.ascii	"\3666\023wE\247C\031hQ2g\260nr\030/#au\320\214\b\243\330\021"
+	.ascii	"$\315\230A\207\236\257H\251\232S\266d\346\350\212\374NQVAd\275"
+	.ascii	"\222\274\333\205\334^&\027\235\256\270<fH\326\361[\327-\013v"
+	.ascii	"]\253\035\304\207\245\002c0\371\037`\336|v_\240'"
+	.string	"\034vR\024\223'\340s\037\334\373\310\023\351n\246DW\237\231pO\361Nm\345IT\315V\230d\311\031i,\3036\327\204f\005\263&F\214\325\363\365\017\271\3708z\276R\266\257\326\233\"\242\215^\214\221\317DA\244\311\372\362\347\013\361Z\363u\345\266}d-M\262\370\013P\020I\245\242\233\230\374v\034\377\366\016\337T\222\333Q\271\254\360 <N\020E\022\221:0\023\2700#\304\205P\023%\361?\034\217E\347t\225\361\224\211\"(\317\217\206\360\326t\352\220\202\315\002\256\306:t!\3224\3347 \330\245\236<\002\301\276\357/\213_\241\007\315\236+V\203\316\273\205F\233\\X@`k\005\034w\017%\020\357 \2520\353\371\n\243\366!\235\223\\\3149G!\237l\026Y\242N\356\215F(9\260\350\302z\366\247Dq\0022\230x\257\313\353\201)\206\334\004n1\345\332fL\356\302\023\217\206h%"
+	.string	"TO\211e\006\340O\310\026\200\004?\233\nH\006e\326\210\003\325\216\020ys\007\372\372\362\310\271\326\r\244\222\353sW\323\2551\177\276\205\307i\200\361\333\342\252\332\225\3721\003_jc\350\355\320\271\nZ\031N\023\225D[\376\354\2461\034A\024#\2542\221\226d\254\343\201m\245\216\337\371\214\026\207\302\025p\231\276\242\313\005\336\344S~\272\276\341^\266t6\343\377|\207\337\213,\226.\343\347\013|\213u\274\307\272w\332i$Y\364\b\0333l\006'j<'\341\320\356\005\351\005*\001\037w)<\007Z^\272\253\201\247b*\025\327Kh9@\263\203Zp\246\f\030Oo#\3638D\373\255"
+	.string	"D\240\276:G_0\004\031?\304M\345-\234\004\261\274\314\257\023\f\264;$\271\224\201\335?\271\243T\265\220\002\002Iz+\243yh.\3611\315\004\b\272\0069\240+b\377\257\n`j\031\334\211\376\322s\364\n\216\006\343\375\025\372\023j\251'\351!2\251L\377Z\227\354W\001\350\254\305\346\306*\246\331\320\361\301K\234\002\026ca\\gBP\273d,ks\335<\370x\320Q\204\270Uc\342\206$\344\226\375\036-\n32\227\200h\026\322\030)\006i\255\b\027x*\334s\234/\002\264\0368w@\fJ\004\002\373\372,\3011\225\244c\214\216\004\331\356|\035_r\r7\277G?\270I\364\2637\225\325\335\272\301\256\343k\274\337\353c\242P\324JD\206\226\354\022\263\344\342op\217\241M\322i\f\315\357\027\006_\231Y\347q\363\230-\217\266\210\206d\f"
+	.string	"\2639\277A\362\254\237\224\236Z#\032\320\032\312I\226\"[\240\306\030Z~?|\240P\341\251\316\b.\201\243\221e\277-^\262\243*\246s\017\357\005\372\232\217\256*\205\316\320\207-V\207~\001\367D\242\035\036\267\031\024\007:\377d@co\372,\361u\n\241\235;\033\201\315M\344\305<\r1\301\260\227,\025\256\357\361\035\026\313b\265\226/\230\242G\342\213\30157\366\311X\254ku\201\240\204=)\020E\274\241M=\314\320\201\261\221\030\203wa\352\206\254\017\n~\243~\342\177\362G\225\242\364\242\004\347\225\024['`\351c\332\325*;)?\324\335\2412\375\363\314M\256\203\024\334\234\217a]\007u\346\223)_\3113\344"
+	.ascii	"\243\363'\351\361k\005\236\224\316H\235\325+\251\357Bb\3704\336"
+	.ascii	"^\336y\245E\224\254\335\224E\004q\241\272\323\003\237\224\273"
+	.ascii	"A\366\037\026\006\356a\264\267\245 \340:\016 \362e\244\276\031"
+	.ascii	"#$\252*_+/<\205\317\324\031\360\331\033Z"
+	.string	"q\236#d-\032\210\316\027K\266\275\234\004O\337xw\237\266\353\0137\204\315f\210<v\235d\230u\307e\337\343\034Sp-jm\257\r\035q:`\252c\344\244R\276\344\336Y\3151\245\300z+\267S^\206-\313f..@\260u\307\345f\377\234\303\214\357\342$w\344\tk!\335\032\b\342\310\265$\324\362PZ0\325\025{\013\031HwKK\247\202u@\3238\313F\237Kj\210ME(\362\225$\030\2156\255\275L\211\n\340\346\224\244b\245\356\221F\034\366dB\344[U2\355\366\201\001\023\303z\"\035\f\3560\217\227\262\253\312e\032Jy\226B\336wQ\316r\341P\003\222\350\325\200\376\222G\036F*V6f{B9\\\302\200%\344\342\357\320\246\323\203\t\241%\305\357\377\217vM\344\214\\\311\233!I\254=T\345P\0224\006\022\310B\327\222\371eW\300\031\006S\367+U\254\353\267\246"
+	.string	".|\262@\214\231\215.\371\336o\f]\342\273\233\r(\255i\362\337\237j\224\376;\301\241\216\215\265Xd6\362\314s\207\213*\240&cs\251\376\363\234\362{E,qv\230;\357/\203\271\307@\016\353[\375+M\004,S c\360\266\311\246W\200\1777\237tO\273u\350\260WAU\320\313\204\007K[\\\263\277z:\356\205\241j{/\363\233\330\226\315\3376]\026\005I\341\002\357\222,\253\275\271"
+	.string	"^\301'H&\357\376]\260\322"
+	.string	"\204\307\177i+\375\375\362\007\221\354S\310CU\0267k\313\203\222\0070\200\322E\214\242"
+	.string	"\3651\360C\213"
+	.string	"v\026\304\264\331~\216\032\317\363i\372\226\0316\226o\016:\361<\216[\250a\342\345ymB\004\200\250I\t\326W\364\337=|\224\007W\242e\0013\302\262\206\207\243R\f\332\344\232\331\277\034\330\222\013f\314\244\231\027\333\n\342\344\366\373\336\271[\003\365.X\313\253\026\317\222\203\332\321\346\245)\264\016\350\312D\021\376\355\360b+\372!\203\244\310\"\360Ym\3727*i\265\331\031\373\312\215fM\347u\362\265\354\023\340\365!\351*\030\027\305;\216\337mL\002\302\372)\311\001\366\244\027Hs\001\340"
+	.string	"\304e\332\210\222\254\366\\\t\334\224\203\271\371\274 \026\252\0065\n\251\312\205\034\333$!V\327\2105\"Q(\260\023\253`\350\020Q\322\365"
+	.string	"\275\210\277\372\372\344\214\303\340%\263\022}\275"
+	.string	"\355\303\03548\006\270\354\340M\004T\263\345\241\036-q[OR\235<O#D\206\357\200,\026\t\257AR\313\251-\262\020\030\241$E\233\363\367\0053\223\260\215\205tb\324\343/\2152\366\326\333 \233hy\323\325\301F\332EF\253\371\001-\334\200\220\217\347g\275\305"
+	.string	"Z\304U\275\004\363\022\246\243z\177\210\254\342\231\020j\323\204QS\234Xv\327b\255\327\255\347\3543O\230\336\266\276\223\200km2i\225\204\027B\267\022\313\250v\013\354T\301q\230\264S\314\2715/,]\266\337\005EI\\9Hx\332I\316\234\256\037\260M|P\315\316:"
+	.ascii	"\304s\231\r\027\265\f\310\261\360\315\204\035\326\203c\004\221"
+	.ascii	"\251\327\027R\177\302J\343\310\016u\003\236\030\275\003j\301"
+	.ascii	"S\244\274\325\270\342N\273&\222q\276\371\b\n0\b\02026KY\316W"
+	.ascii	"\226\246\366O\372\200\256\215\325\003%p\"\256\353`\032j\n\"\215"
+	.ascii	"\217\305\253\002\2220\312OV\324\351\201\325\023%2{\027\345]T"
+	.ascii	"g\200\275\343\307\314\335k"
+	.string	")\257\001\004\247o\026\254/\374\3471\351\311YM\270l\001\306V\002\005r\361\306\313\347\177\302\0318\315\004\267\363hN\227{\331\237\231\332\244\305\005\352W\336\034~\022)f\317\357\024\214\255\225\321>^\256\016\301\270W\267\223\202\345\253\315\213\037,\343\356p\212\203\nz\253a\221\323{M\351\330\333\035I)J\3556\001kx|\016\362p\333\215\224\307e \326/{A[7\376G}\331e\026\330\376XZI\311\361\310\3745j"
+	.ascii	"\2576\247\306\232\315\023\265\335K\202\335\227\364u\"W\033\004"
+	.ascii	"h\265\255_\274\352\306\356\236\031\361\006\nD\001\242Cs\334\200"
+	.ascii	"\216\265\0016E\031\254\214\250#\036QCp\257$V\342P\234y,2\377"
+	.ascii	"\246Y\224\331\372k\343\375\206\017Y\303\307\217*`\311\335\316"
+	.ascii	"\312]\355\211\334\362l\034XE5"
+	.string	"\317N>)\212d u1\001i^>4\322\f)\211z\372<\003\334\340A \221\265]W\217\035\200^z!\371\217\223\353 \337$\251\177\206\204\2667j\271\257\3009\202?\205\360\246\365\n5\212\005\314N\347f\236\367\365\003\302\331UsS3\315\356Aj\003\343\341v\343\035\351\234\275c!\200\234\272\206rh\"V\376&\001\265\216\201\220\341\256\250\302ED8\";\001\3174\233\236(I\330Lw\326b,\2614\324\343\202#X\234\342\366\370\030c\205\355\177\030\b5\347C\314E\211\247\353c~2\374\200:\245\232\332A\336K\367\311y\271\232\370\025\240\230\251n`\235\210\367\035\027\230/\245\004\311g\341\266\365\n\376\251\340\235_\263\t\235\240\263\231\277\332\221\201I\na\216\0344B'\350\317rP\"\2105R\372.\271\326i\202\313;\250\"`\332\217/\314/\243\225\253=\233a~g\273\231\371\315gl"
+	.string	"w\277\032\314\3529g"
+	.string	"\317p\303\251\264tp\025\245\327\324]\346\212 \341]\351\2407\306\241\364\037\242Qf\030\032\362hL$x\020\200\363c2\353\325\350x\361\024O\307\232\355\234\230\021\034M\233\3024~\005\223Tp\320\004\306GQ%\344Y\302\025d\005\005\2231(;[\037\031\360\336;\350\331J\016\025\270\225\036\205\311G\026\234\317\212@\215\261\256\"&\326\006\247\342\3511\022\316\253\263\376\006IWV\034"
+	.string	"\003\311[\331\004\005D&\215@L\277\255\022/\016\202@\256\206\250=\347\031\206;L\016\f\271 4}\376"
+	.string	"\204|a\306\323pU\020\217\313E\3030f\272\226[y\024X\310f)\272>\201\247\001<\220\303\326\335\005 5\327~#x\n*N\271\234\337-"
+	.ascii	"\343\3066\301\033\200\237zj\"\303\250_"
+	.string	"\302\253;\3445I\3026NX\320\205p\321C\353\260\030HXUbe\022\3266S\225\356\035\030\r\025\3618gQ\371\207|\247\366\314\323\221#_\225}\271\314ps\017\01385\235\026\306|Xwj\251\235\245\256^\357\217\247\223\267dj\360\344\247[&:]\f\004\223\367m*\315\257\2629\021/\t\305C!\356k\314@$\017o\004\344\325\b\001\004R\337\030\0039@(|\253,\357\370^vg\b\244\213S\200\2232 \352.\306\367\240\217\030\341zJN\355\3541\224\362\264\314;?`\035\007\323_\200\236\271VsEz\246I\003\334\324#9\2045\277\234\031\037m!\346\311\245\217<_\036\nm\034\f\0320!>R\341S\177\242_\034\0241\313\225j\267\370R\302\3526nQs\253\235\260\024\305\361F\311\351\235\033\335\022-uI\241*\016\306v\271$\274\314\r\372\262\210\303u\246\036\274B\346\272\216"
+	.string	"Pt<\335\257I\235ug\f\341\264+\370\331J}\351E\347r$\002I\323\352"
+	.string	"YF'\265\0175\276\253\230Cu\343i\312;\305\211T\237b\203"
+	.string	"\215\201\334U\006v\204\220\230\r\255@\326\376\300\353\275\253/c\362\303\020O\316%\3222o^\3235L\211\340\370Z\332h\025\274\333m\213l{\343\265<C\352\t+\316SB;tu\304\330\261\001s\356\315\3564hP\357}\001\002\336:>\337\0355\343\244fj\016\3534\316\325\006\230E\307\217/n\273!\005M\232\026\375\313\216\213\260Y\202\021\231G\246\246\226B\314\264\210\177$\260\364)\343&\300\221r\361\\\273\237.y,Gs\276h\212\032Z\3628E'Z%\210k\255\366\202\256\210\233\306\273\317\236O\"\251\037T\030\217\2271O\340i\035\334\245,\002m\255\354\310\267\246\271\004=\301\227\352\302|\225\265^\341\f\360\245q\025\017\251iP\324\223\034k\023-=b"
+	.ascii	"\217(L>d\362<.8\373A\244\360yD&\257z\2161HU4\314\332\276L\201"
+	.ascii	"@\026c\026\307\360Om\3328h\337\345T\"\372\256\371\031%MFtnh\334"
+	.ascii	"\"\033B\356\340\200\036\032\270\321\017.\025\267\261\334\240"
+	.ascii	"\366&\342\"\245S\304E$\370\265\200\373\371\304\372\236<=;BL\031"
+	.ascii	"}K\255T\200a\nlq\207)\350u*\275Y\314@\315\3643\t\005\310\227"
+	.ascii	"'\320\322LL\260\201\363\274\362w\321\0011\2401\303\035\022\213"
+	.ascii	"\242\256\374\320R\237\267\033T\342\342\\ID\255\251\374\247U "
+	.ascii	"\350\r\242\274\231[\201j&&J\351\325\364$\030b@\304el@\021\340"
+	.ascii	"\372N3\304\030\003\216\320\201s\302\365\n=p\364\364,w\216\027"
+	.ascii	"\362R\tV\377\261\262\177\f8\030\203\361\3747a\361\037\321\304"
+	.ascii	"\252\037\331\333w\322\346[h\261c&\200\017q\3424*\177\3318\326"
+	.ascii	"\317_\021\265\275\275\361@+\327\301*\200\341\022\020_\215\373"
+	.ascii	"\024\267v\206\016'm\271Y\220\274^\306\242/\267\340\321\333\376"
+	.ascii	"\035sy\205\367m`\374r_\t\354\375\177\2660#k\331\tN\201\367B\370"
+	.ascii	"$\003\336\353\332\257\343u\322.6~a^9\361\326\305]\374\323J,\274"
+	.ascii	"\244\017c\240\233\260\205O\353\321\243\310yf\372%s\220\206\303"
+	.ascii	"X\037[\313\335m\241\217P\357x\210cE\232z\307\247\336\317\234"
+	.ascii	"<\366\336\327\021\271\177\223r\245\363\336\265\220\262\315\221"
+	.ascii	"\216\354]A\365\353\231\036\362ykSx\367\261\357fz\267\022\277"
+	.ascii	"\220\177\370\252\351b-\347\026\256"
+	.string	"\3729\210\214'\302\263\313\363\033\270\264Tu\365\356w\f\217\324a$\005\\\251z;\270\372\327\267.\005\316\340_\007U\340\231\255_\377<-h\037\322|A\023\\V\314\346N\375\004\213\316\271G\224Y\341\237\356a\027C\264\261\376\263\313\332y\\\213=)Isz\334I\333q\004\251\236\247\327D\037;\270Y\003\307\303\271\025\256\233-\303\026\366kCp'\365\247\354Y\264\346\217\326\037\003\340\367\367z@\372\317\255j\341\330\350\273\003\377\237^\326\344\343\351y\377\f\367\177I*b\\\214\3011*\376\333.\r\250;\277'=\357\301\354\005kS,\306\263\307P\214}\274\330\037\250`\035\242\355\220q\236\216\310^_\276\f\272\234O\r\241\342\322\304\337\205=\007\244\322\033\316\372\324\224\373H\351\373d\347\365(\250\023\346sY\375|\257>\225{6\311\207c\271+\375,@\367\232\251D}^\346?0\2622rC"
+	.ascii	"^\316c\363\030jX\366wv;\244\3129x\247\3643\034\207.\275\347\b"
+	.ascii	"\243\226\376F(l\232N\350N\331`\251\333F\317\336\030T\233)\253"
+	.ascii	"Ps \257\377\260\016\253X\270\333\235-\210Y\350\335\260\274\310"
+	.ascii	"\244\346\371\342\357a\236\345\274\201\353\032\035Gto\306\356"
+	.ascii	"\307="
+	.string	"\276\257J2(\226_I\brQ\246\351\254\003'f\370&\301\327\350\337\222\262.\376\374\205[\213\377z\346\021t\267v\362\2014\337\210\244\003\274\374\317\366\340\t\320\257\273yJ.\026"
+	.string	"\276\243\246\f\217\023\335C\315\032]\260\0375\353Qq\326\025\316\"\206\367\r(\372\b\354f\370\362afg'\365\270*\3576\303\270\024\271\321\224?Qo\334\263\031[\311\033\353GB{\"\347\016"
+	.string	"\201;\307:4\330\351\331\356\225=\221\276\351\273U\217Z-\207\335z\n\325\336\221\227\201\365\250\356\237\005\372\320\\\307_2\332\373O\037\032\335"
+	.string	"\342\373m\3561\215\324|\324\204\243\027}\376\336\230D\357\026i\333\271\2652\315\374yG\363o\213yF|\247m\307g\215gQ\360\f\217\375!\272\017*u\023\360\003/9\223\355\3776\016\t\366}Go\262\223\0353\271<\350\360N\177\267\201\201\022\257{0\020\2454\373\265\251\322W9,n\032\225:}\233\233\261\337\370\347\334fZ/s\360\254;C\024\303\253\216g\373\366:\032^qr\363-\355\267\035Q\376\265\265\311Y\373\243\376\207\331\331:U\273\332\354L\235P\177>\037\2237\227`\036\244"
+	.string	"8\231|.s\031\374\210-\367\260\036\"*N\266Y\212\372K\243\227\024\233ab\367\377E\235\216\235D!/\262\236\036\313\016\261\246\027>\216\243z\0300V\001\330\306+o5\365n\024\323{`B>\2100\243\350\227#R~\001\252\033\005\233\004O&\316\345\272\207\2466\251{\313l\213t<d\322 \247;\201W\340\367\356\303\240\377\243yWo\326\375\225\001T[\037\376\233c\326\233?.\313\034\250=\331\315,\2345\226\322K{\377f^\375z\334-\233\032i\033\033\243\270\330\331C\235&\203\373c\373\027=>\350\272\247P8W\325\027\277\273\240\343\275,\016\362Wn\004\207\036f\035q\362^)\325H\313E$\207\332\237\375\3027Yv0=\303\356.\204\352{\365\200\277\336\303\022\237n\260\217\376\341\276?Kc\006\376\314\231\351V\210_\341\375\277\343{r^\323\016\360"
+	.ascii	"\214\277\n\036L\016\317a?v0\324\360\f\214\307\222\241\022\\\004"
+	.ascii	"j\027\320\237\372\367a\271\205t3\232\347\300\207\336\376-\024"
+	.ascii	"\363_Z\205\207dS3\255<\3578\f\316\017[\316K\356@00\242a\255\361"
+	.ascii	"\231'\035\236\363\322\303\245\252\333i*\037\306/Q\233_\230So"
+	.ascii	"\323fa\237\360])\233=\202\326@\261K\323\0338^\222k\030\250\371"
+	.ascii	"\001\216\345-\373\007"
+	.text
+	.section	.gnu.lto_.symtab.a12f4ea209d8e9ed,"e",@progbits
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\005"
+	.string	""
+	.string	"startedLoggingInTestMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\005"
+	.string	""
+	.string	"blackboxMayEditConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\005"
+	.string	""
+	.string	"blackboxValidateConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\005"
+	.string	""
+	.string	"blackboxFinish"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\005"
+	.string	""
+	.string	"startInTestMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\005"
+	.string	""
+	.string	"stopInTestMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\005"
+	.string	""
+	.string	"inMotorTestMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\005"
+	.string	""
+	.string	"blackboxLogEvent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\005"
+	.string	""
+	.string	"blackboxGetStartDateTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\006"
+	.string	""
+	.string	"blackboxSetStartDateTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\006"
+	.string	""
+	.string	"blackboxCalculatePDenom"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\006"
+	.string	""
+	.string	"blackboxGetRateNum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\006"
+	.string	""
+	.string	"blackboxUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\006"
+	.string	""
+	.string	"blackboxGetRateDenom"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\006"
+	.string	""
+	.string	"blackboxInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\006"
+	.string	""
+	.string	"pgResetTemplate_blackboxConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\006"
+	.string	""
+	.string	"blackboxConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\006"
+	.string	""
+	.string	"blackboxConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\006"
+	.string	""
+	.string	"inputSource_e"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\006"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\006"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\006"
+	.string	""
+	.string	"GPS_home"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\005"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\005"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\005"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\005"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\005"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\005"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\005"
+	.string	""
+	.string	"blackboxHeaderBudget"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\005"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\005"
+	.string	""
+	.string	"motorOutputLow"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\005"
+	.string	""
+	.string	"rcModeActivationMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\004"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\005"
+	.string	""
+	.string	"axisPID_P"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\005"
+	.string	""
+	.string	"axisPID_I"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\005"
+	.string	""
+	.string	"axisPID_D"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\005"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\005"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\005"
+	.string	""
+	.string	"mag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\005"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\005"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\005"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\005"
+	.string	""
+	.string	"baro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\005"
+	.string	""
+	.string	"rssi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\005"
+	.string	""
+	.string	"servo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\005"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	"motor_disarmed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\006"
+	.string	""
+	.string	"motorOutputHigh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\006"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\006"
+	.string	""
+	.string	"targetName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\006"
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\006"
+	.string	""
+	.string	"buildTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\006"
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \006"
+	.string	""
+	.string	"pilotConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\004"
+	.string	""
+	.string	"voltageSensorADCConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\006"
+	.string	""
+	.string	"currentSensorADCConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\006"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\006"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\006"
+	.string	""
+	.string	"controlRateProfiles_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\006"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\006"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\006"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\006"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\006"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\006"
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\006"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\006"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\006"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\006"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\006"
+	.string	""
+	.string	"blackboxWriteSignedVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\006"
+	.string	""
+	.string	"blackboxWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\006"
+	.string	""
+	.string	"blackboxWriteUnsignedVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\006"
+	.string	""
+	.string	"blackboxDeviceReserveBufferSpace"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\006"
+	.string	""
+	.string	"blackboxPrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\006"
+	.string	""
+	.string	"blackboxWriteString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\006"
+	.string	""
+	.string	"blackboxWriteSigned16VBArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\006"
+	.string	""
+	.string	"blackboxWriteSignedVBArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\006"
+	.string	""
+	.string	"rxAreFlightChannelsValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\006"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\006"
+	.string	""
+	.string	"failsafePhase"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\006"
+	.string	""
+	.string	"blackboxWriteTag2_3S32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\006"
+	.string	""
+	.string	"getAmperageLatest"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\006"
+	.string	""
+	.string	"getBatteryVoltageLatest"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\006"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\006"
+	.string	""
+	.string	"blackboxWriteTag8_8SVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\006"
+	.string	""
+	.string	"blackboxWriteTag8_4S16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\006"
+	.string	""
+	.string	"arraySubInt32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\006"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\007"
+	.string	""
+	.string	"getArmingBeepTimeMicros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\007"
+	.string	""
+	.string	"blackboxDeviceOpen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\007"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\007"
+	.string	""
+	.string	"blackboxWriteFloat"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\007"
+	.string	""
+	.string	"blackboxDeviceFlush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\007"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\007"
+	.string	""
+	.string	"gcd"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\007"
+	.string	""
+	.string	"blackboxPrintfHeaderLine"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\007"
+	.string	""
+	.string	"castFloatBytesToInt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\007"
+	.string	""
+	.string	"isBlackboxDeviceFull"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\007"
+	.string	""
+	.string	"blackboxDeviceClose"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\007"
+	.string	""
+	.string	"blackboxDeviceFlushForce"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\007"
+	.string	""
+	.string	"blackboxDeviceEndLog"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\007"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\007"
+	.string	""
+	.string	"blackboxReplenishHeaderBudget"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\007"
+	.string	""
+	.string	"blackboxDeviceBeginLog"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\007"
+	.string	""
+	.string	"blackboxOpen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\007"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a12f4ea209d8e9ed,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,963 @@
+	.file	"blackbox_encoding.c"
+	.section	.gnu.lto_.profile.2bfb7f2535410cae,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2bfb7f2535410cae,"e",@progbits
+	.string	"(\265/\375`}"
+	.string	"\335\004"
+	.string	"T\bq\001"
+	.string	"\020"
+	.string	"\342\203\351\365\f"
+	.string	"\001\357\350\332\204\n\002\002"
+	.string	"\002"
+	.string	"\002\346\371\265\305\006\006\002\001"
+	.string	"\002"
+	.string	"\004\363\323\275\211\n"
+	.string	"\005\216\243\313\354\001\002\006\252\212\212\215\003"
+	.string	"\007\242\247\237\212\013\002\b\213\215\316\230\r\002\002\003\002\003\t\353\206\240\252\016"
+	.string	"\n\340\253\276\213\016*\002\013\245\277\256\207\b.\002\f\311\305\223\252\f\026\002\r\253\356\273\246\004\004\002\016\324\230\357\263\006"
+	.string	"\017\274\320\320\213\f"
+	.string	"\020\240\342\234\212\n"
+	.string	"\b"
+	.string	" \343"
+	.string	"\223#\230\270"
+	.ascii	"f\004\246\342\354\"\227]\001\206"
+	.text
+	.section	.gnu.lto_.ipa_sra.2bfb7f2535410cae,"e",@progbits
+	.string	"(\265/\375`m"
+	.string	"\325\003"
+	.string	"r\004\f\023\240)\035\377sUUU\240\265\362\255\355I\333\335dJ\001\212\034+-\3571\006,\376%\036\004g\374`5\224Ln\264\257\237\326\325R\347q%\" \260\0029\322\035.\002\2563\027\212s\3166\220\007\324b.\231,\247\217m\242 \234A\"\b$\\1\272\262\357\254\200\031\343l*\236\002\016;\233"
+	.ascii	"-\317\347i\270\031\3139\274-W\326\343\037v\204\233\274\274\026"
+	.ascii	"\206"
+	.text
+	.section	.gnu.lto_.inline.2bfb7f2535410cae,"e",@progbits
+	.string	"(\265/\375`\016\006\r\025"
+	.string	"\326\335fD\360\224\223\016XK\342\033J\234k\336\201<\bw\325\177\226#\037fp\356\203\327\037\234C+\204\272>/(G\363\347\276\305\366\207\365\177\274\353*\0239\360\f\\\360\177\230\275\023\360\244Ed\307\336\275\333\226I\246J"
+	.string	"X"
+	.string	"X"
+	.string	"\351\"2(Gw\211K=&\326\325\210/\347p0\344\030\265D\325sv7@\312\323\231i\332%\316N?\333$\230N\027\275\261\273YJ\272\304\245\355\321\355\243\276\273\013\355\b\273\313\262o\033\364\314t6\320\021\273\013\262I\016=/2]$\274\003\177s\005\035o ^\302\255\372\223+\b\017\343\020\213\006GOv\036\371\244\273\273\201dz\313\303\353\210\276\202\264Nd=,#\026\362F\245\031x\324\254H\0206yWQ\314\324'\277L)\207\216\006,\203/\212C\"\326\002\305!\316\360\371\371\fR\375\002;\352\377\300\277\b\256\343\346\307\347\345*\370\016\n>4\bp\334\266\005\212\242U\304\2259n\216\033\313exl\020Qq\374:\262\034H\254\006I\346\350\210\272kgH\222\025?\372\321t\236%\035|\240\277F)\315\356\206\374/\214\333\315\t'2b\\g`h\271\202*\031VR\213f)"
+	.string	"F\211O\273\237\346\247\251\036Sa\206\220\025?m\363\323L\252\003S1s\277\315\357\364\356\202\210\234\347\315\250\007!\244] \341\037\244M \341a\3629U\352\372`\303b\200O\234jSB\211N\206x\311\364\200\371\207\263-\372qK\240&Rt\001q\250QM\206D\304$\005)\243\222\306`\002!4t\325\001\022`t5\007q\220!D1B\301HA\312J9I\007\\%\300\255\235i\3269I$\320\301kf\203\233!\362\272\177y:\025\205\344~\317hu8R\026\215\335\020\3240bY\254B\027O\257\211A\020v!\247Q\026_8!\257\261!\3671\222[@^\266\030\354P\003\250.\342I\217\275\217\"z\213]\026\256O@k\324M\211[\365j\275o[\272L`\340\321/\347E\202\227i+\261]>\302\007i\177Y\254\rh\201\252e\301\214"
+	.ascii	"K\242(\257\275\320\227\013\005{|\020/\372\245\334<)\223\023\017"
+	.ascii	"w2\020\034\245/&Q8\374\337\003\314\252HB\322\266\375.)8\266\343"
+	.ascii	"r4sX\316\271y:d\326\220\350\032\2355\"@\362\017{(\304@ Ra\r\255"
+	.ascii	"69\236s\017\201\243\026\263pH\266\311]\307d\r\220Hm\366G\360"
+	.ascii	"'"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2bfb7f2535410cae,"e",@progbits
+	.string	"(\265/\375`\375\004\305\013"
+	.ascii	"\002O+,pi"
+	.string	"\222\016\3741\240N+\001L\216@\371\2010PUU\347uoF\001\206VU]\216_\271\023\310_\324j\3036\373I\333M&\031$\311\203\n\031(\002[\346\230g\001\024\317\0227|\304\020[\006\2100\334#\227\351\350Rq\250\374\360S\035\376\242\361Z\024I\232a\360T\257=\350\273\340m\212\320Z\353Z2\337\274\364z\035)\036\255\035=\346\215\264X\036\017\b\344\263\027^a\307\231\023\252\355\316\267\344\002\327Nx\204\311\263[\242^By\312\220\005\003\227qO\324OT\347A\235\336\237\257m\3426M\266\3515\312\347K\210MET\2501Q\306hf\232T\206\335P\002!\306\310l\003\022\300\023-\203\201(\312\230\021\030$\2328\n&\032\312PZX\352\356\355\027\262\233\315\237\230\274\207\252p\350\001\035/HzQ\234=\331E\036\256)\3563\365\tj\212\277e(\013.\036F\343\256A\205\036\216o"
+	.ascii	"\017\002\343\r{\316`\351XT@\216\217\207\002\304\202E\2074F\177"
+	.ascii	"\314\262\262\035\310\246k\321\311\333\363Hb\001H\357:\374\177"
+	.ascii	"\005d\215\301Tm6\0340C\221/\331\370\265\253X\032\036\234\367"
+	.ascii	";H(w0\220\256\357|F5\361\322aD\364\003\354K\212\221\341\013&"
+	.ascii	"\220\221d\316\224\217I(\271\321.u\374&sY\002\222\317\231S5\370"
+	.ascii	"\252Iq\002"
+	.text
+	.section	.gnu.lto_.pureconst.2bfb7f2535410cae,"e",@progbits
+	.string	"(\265/\375 2\221\001"
+	.string	"."
+	.string	""
+	.string	""
+	.string	"\017"
+	.ascii	"\230\004\001\230\004\002\230\004\004\270\004\005\231\004\006"
+	.ascii	"\230\004\007\231\004\b\231\004\t\230\004\n\231\004\013\231\004"
+	.ascii	"\f\231\004\r\231\004\016\230\004\017\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2bfb7f2535410cae,"e",@progbits
+	.string	"(\265/\375`\026"
+	.string	"\255\003"
+	.string	"\264\003\004\001"
+	.string	""
+	.string	"\006"
+	.string	"\017"
+	.string	"\002\002"
+	.string	"\001"
+	.string	"0\001\002\004\001\200\f\004\002\005\001\024"
+	.string	"\001  "
+	.string	""
+	.string	"\007\002\024\274\006\b\007\t"
+	.string	"\n\013\001T\f\r\002"
+	.string	"\016"
+	.string	"\017"
+	.string	""
+	.string	"\005.cO "
+	.string	"\030"
+	.string	",\202d\020\214\017\264{\212\0269\323\300"
+	.ascii	"\274\320Q+\302`\330n0\235%\270\013 =\006\006\002\020X\b\001'"
+	.ascii	"\265\tR\304\264\360\335\331\334l\0278\f\236\306@\021"
+	.text
+	.section	.gnu.lto_.lto.2bfb7f2535410cae,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto__putc.12.2bfb7f2535410cae,"e",@progbits
+	.string	"(\265/\375`L"
+	.string	"\235\b"
+	.string	"v\021=5P\217\206\003#[\370l\021\227Z\005\354&\230\026g\241t^\035\350\372$\366\265\217g\356\214BDbY,1K\303\331\007wM\006-\341\n\236\244\355-eJ\001,"
+	.string	","
+	.string	"+"
+	.string	"\3268\036\320X\253\327\276\370\3738\bdu\022\363\177K\017{F\257\266\211\001X\255\224q\303\360\277\310jm\270\351\266\006mAmY\002\207i)!m\335i\233\330\"$x\376.\232?\007\312\353\277\247\013\306\326#&\361\\R\027\007\374.\221\327\377y\252\300\261\326\317\004\232\250\n4\253\005\031\231\252\023\323\231\316\006\230\325\214\nc\355\227\302\354h\235\375\177\323\325\372\2633\261\230a\255\321Z\004V~\215\230L\234M.\367\201(\221\036:\2564r\260\350D\021\\HB\264\225H\241\211\215;\241\266\317A;\323\350\264Qt\335i\353|w\366t5S\201\251\022\243\033\304l\003\n"
+	.ascii	"`\251'\023\372\374\002\213\013\316\313\250\340\032\373*\fVP\241"
+	.ascii	"\307\035^\264\223\f"
+	.text
+	.section	.gnu.lto_blackboxPrintf.14.2bfb7f2535410cae,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"\275\f"
+	.string	"\326XYD\020q\233\016\b\005\203\313P\234"
+	.string	"\032\0352\020`\030:y[\001d\362\222\320\005\bE_U\364\216y\322\310qr\030\021\274o\343\023?7\272\252\252e\330\265R\004\223\343\267\034\t\034L\027\226,m\"wJ\001C"
+	.string	"C"
+	.string	"F"
+	.string	"\002vS\302\031\273\037\0037\250>\375U\266}\026/mv\r\t$\023\212\025\022\b\263\273\027\202\023\240>\247\017\240>\365\304\267\313\315?\370\004\240\f\357\204\273\314pv\327\322;\031q\353m+\260\375\300\276\207\337\212\210\331\321\331\2304R\274\345\267\357\303xh[\026\271\2135\206\nJiw\255O[\304\266>oo>h\313f\371\213\355-#\234\321\207i\305\213\270k\242\371\264\203\352\363\006.\355\267\370\312\366\217\303\003*(%\325\277x|\252\335\356\336u?\374"
+	.string	"\311{\224>|\004\022\211Q$)\347Jj~\227\203\030\016\204\360l\220\f\362\236_\242b\024I\224\263\277\221T\023\366\247\325\024{\222\246\376\375Z\025p\221\343F\2508\002\230\006\031\002\252\240\3166\036\241\017\005-\013y&l\320:\037\031f\241s\205>\030\350\312D \327f\201\265\013\036\321\025\242i\242\313\372\272\333\224f@\230\214b\247#\217L\273% \210,2\306\001$\226\201\237%0\243\330A9\003\220SG\022"
+	.string	"`\251'3 \f\013\263\2608\023l\220\030\027\344ku\372W\273$X\353\2720Fmc\321\246\354"
+	.ascii	"C\370\0249\270\333\243Z\351\b\223\f"
+	.text
+	.section	.gnu.lto_blackboxPrintfHeaderLine.15.2bfb7f2535410cae,"e",@progbits
+	.string	"(\265/\375`\333\001\305\020"
+	.string	"V\337nF\360\264f8h\310-l)8\3139\005\243\332\206L\214#\363V\303\311\363\267x\302\310\353(\277\205\001m!\016\265q\367\334\372PDN\031r\216\2741r\360\361/4s\3236\217\300r\t\212\377\332\233\354-eJ\001Y"
+	.string	"S"
+	.string	"a"
+	.ascii	"1\031\023l\304\006#\310\270[\002\345\234M\244s?\021\2234x\332"
+	.ascii	"\357y\f\327}B|"
+	.string	"\300\356\316\320\215]1\305\013H\347,\276\300\350\034\351&\243sv\331CNh\002\374\260\221\035\331\335OY\334\365t\371\227\035@\2103\363\354L\273\353\fqL\334z\333\tl?\260SC~\361\220\017}\027\"m\024\2413\266\bK]a\177\333\335\265\356\330[\272t\361\367\356\363w[Z\267tn\351\023@\311 \322\003\210\372\020\367\246\206\344E\304\341\340y\354\267\357\323\370\314\366\034s \253\215\"\235\236\335\365bl\357\334/\263\347\377|\206\353\001o\341\t+\371pet\356\332\245\210\321r^Ys\227%<\243\201\244PAv\356&\007m4I\316H\221N\217\247\257a\341\002i\367\365\360\273?c9\345\303\222~\366\b6(h\243\215\316X@\242\374@\227\251\016\220\b\355\226\325M\016m\244a\300\243$;\265Y\240\016\004BD]zv\007\215\034\247\017\t\303\312\240*\326\251\2659\245\322\322Za"
+	.string	"S-\025\013\b\020\265!u\342\200\372Z\253\023\353K\271\274|*\n\fvP\271|0 \350\362y\342\353\333\352\216!\234 z)\3142\333\256\n\007\217\375\343O\326\254\272\343a\221\324\253\252\006\325\274HyIS7!5:\260\254\331\027\372\220\004\007& p\202\221c\307\003 \352\215C\333\033\003\351\305(\020\327<\002\f\025d\016o\254\300\363i\005CC6\016\331\357\003\353\236\376\205.{\255GH\036\353\225a\002\357Z\033'X\236\t\355a\330\004\317\2141"
+	.ascii	"b\023,\b\030\374\343\230sh\216\2035\"\300\243\204\207\027-%\003"
+	.text
+	.section	.gnu.lto_blackboxWriteUnsignedVB.16.2bfb7f2535410cae,"e",@progbits
+	.string	"(\265/\375`3\001\215\r"
+	.string	"6Z\\B \217\223\0169c\274\310"
+	.string	"\272\037\004\224\351\260\230\340\f\017W\247\200i\017\026\240qJ\235r\304\376\266\255\257\302\340e\307j3\335\350\305@\020"
+	.string	"U#\034\334\234`=',\001D\303TD\310\336R\246\024G"
+	.string	"G"
+	.string	"G"
+	.string	"\376\330-~J\331\253\2204\0210v\027S\r\206\371y\204\232\037?\273o\343@\217\320\032\2216hp#\350\201za\271\367<\341D\t;\224\256\367\016?t-\033WzZ\nv\327\271q\027\356\352\266Al#\260\257\005>\201\322#\005\365b\315`g`\032s\335\364[7\335Q\323P\323\232\351\314\3645*\223\212\001+\273\244/\306\272D\026\016\227\355\247}\020\017\361\271\251\304"
+	.string	"v1\2240\261{2\340\003\031\217\033\027P=\302\007\250\036\003j\230\226F=\361\367\222**\207\005\026*(L\022\005ww\241\255\373D\025\365\322\004\335\212\n)+U\355\021\222\374\346\r\023\0059U\365#\276'P]S\257\225D\3719\352\225A\227BK\205\362\323\225\226\021\247\212\342\034\022\021\315\204\350M\207\203N\bH\266\351p\032P\310>\036l4\"\037X'D\003\001\333xF\260\216\002\316\"p<\230\204,\363`\327i\017a\324\314\002\317%\244\"[\t1\n\365\3369\272\027Z*\243\030un.B\371EE\361\275g\304\360@B\257\031"
+	.string	"`\251\2473\020\216\315\315\276,\206>0\222^\314\353\030mpV\241a/l\r\325\022"
+	.ascii	"\205\031f\243@D\313\035\026\323k\261r\261\226XM\t\356\305-U\252"
+	.ascii	"\226\201z\331$\314'"
+	.text
+	.section	.gnu.lto_blackboxWriteSignedVB.17.2bfb7f2535410cae,"e",@progbits
+	.string	"(\265/\375`-"
+	.string	"\355\007"
+	.string	"\242\31776@s\322\001\030\374\313\2765=6\340s\330g\353\033C\335\034L}95\006\001\205\343\243|\006\261\364!O"
+	.string	"\351\230.R\227o0B(\273\326m\265J6\2212\245\331\304\350\242\200\306@\r\232\210a\303\264l\301b\0139`\327(\0245\321\365\0201\216\024A\005\336 2.Jl\033\027=\250}\265j\262\002M*C5\314\311\253\035A\312\177\376\300T\265+.\362\3375W^R\033\352\331(/\025\304~\265\273k5\331?\375\232\351[\326\f\314\200\314n\307\215\315\246\240\013\211\307\366\323~\311M\272\2370\334\331\375`i\331]\003\037p\016?\027\260\016\253\007X\207\356\354\230\243D\366)#\034*5\273\0335\344\335\263\363\177\362\316W\362\236"
+	.string	"\t\273\353\374J\036\267\3366\201m\004\333(\001\n"
+	.ascii	"`\251'\023\332\370\002\307\005\003g\030\001\243.a\021\253\321"
+	.ascii	"\340./\332I\006"
+	.text
+	.section	.gnu.lto_blackboxWriteSignedVBArray.18.2bfb7f2535410cae,"e",@progbits
+	.string	"(\265/\375`\307\001\345\020"
+	.string	"\226!rE\360\320&\035\372I\336w\270\233W\356"
+	.string	"$\247\3759l(\274\324\300\262\037\355\227\325\022\2072\337\233\t1n\250d?\327+\034\351lE\264\004\317\3003\250\274Y\220\257Zg(\321^\270|\t\265\222A\366\2262\245]"
+	.string	"\\"
+	.string	"\\"
+	.string	"\037N\240=\332\373\200\354Q\273\200\354\321*;\306=\233\375K\204\213\316\214\335%\351\006o|\337\367\035z7L\325#\324T\371\257\027p}\255N\345\021n\260\300t\340\350X`\310\220P\317c\317\227\216\225\360\203\314\365\261\037p\005\265:\231\347\306\202\335u\266\272\230;\273m\013\266\033\330\371O+L'L\237#\253\341\202\300\317.\314Gc\201b\217\207\303~\373\276\316wPn\302\332\265x\t?\346\3150\373h*\027\264\330\353Fhw=\036\315\300(\366\366\370\315vz'\241z\216},\332\325"
+	.ascii	"\203gw?\254@{\354\200O\3737\037\241:N\312\003\354\322\250\340"
+	.ascii	"\331\365\002\356\020%T\177\207\243\220om\372\235\217`?@+\252"
+	.ascii	"b\377\304I\211\306\301O\311\216\342ef\225\237SE\252\372\226\020"
+	.ascii	"\360^\221]S\337\002\202\225\237\243^\037{\304\340\222\341Rc\225"
+	.ascii	"\237j,\005K\247Zc{\254|\210\315\220\220\225\306\216\351mt\234"
+	.ascii	"_\364\234_;\354\216\231\206\001\247\233\240*p\246\210RJ\245J"
+	.ascii	"\321&\020\b\250\323\003\316\204\032qp\302\211\220\230J\021DH"
+	.ascii	"\250SI\002\311\224*!\201\03007a$E2\341\270\024i\363VW\032\377"
+	.ascii	"u\r\366\001\255\224\025\265\306\242\031\035\251\276H\217G}\261"
+	.ascii	"mM\243\036\347\305b%\207\016ww\241\021<\352(\306\025\324\222"
+	.ascii	"\001@n'\222|+\" `\002!\311\254\003`\365\304\300\356\221U\026"
+	.ascii	"\345I=\216\222!\312\375\323\2266\n33\231\233\024\323\001\265"
+	.ascii	"\225\301\036\300\262}\325U,[\330`\315\265\01381\322p\327)l\217"
+	.ascii	"8\372^\031f\023i\304\022\264\3138\221i\206\332x\017\221\316E"
+	.ascii	"\237"
+	.text
+	.section	.gnu.lto_blackboxWriteSigned16VBArray.19.2bfb7f2535410cae,"e",@progbits
+	.string	"(\265/\375`\326\001U\021"
+	.string	"\366atF\360\320&\035\372\305\275\177\254\027\237\262\360\356\324\267\200o\243\364\232I\026C\376\351:'\037j\2767\023b\334P\311~\256X\035\257\354U\030)\233\310&\344\3760\025\312\202\347 f\207\261\207u\2505id\023)S\n`"
+	.string	"]"
+	.string	"\\"
+	.ascii	" \210\031p\217\006o`{\344^`{\364\312\246q\360f\017\223\275\350"
+	.ascii	"\334\330\335\222~\260h6\233\315\256\201\267\226\253GMs\345\303"
+	.ascii	"\216\340e\303\365\255<j\242\226\230\020\001\276\026MdH\210\347"
+	.ascii	"\341\023\346k\2456b\346\372\360\n^@\256o\346)r\260\273N\327'"
+	.ascii	"so\267\235\3016\004;\007\004V-\235Z\372\002D/\030\007|vcf86("
+	.ascii	"\362\210x\354\267\357\353\\\226\362\025\326/\206\211\335\275"
+	.ascii	"\n?t\347\230{\270\025\r\\\bc!\264\273\037\217~\340\024\273{|"
+	.ascii	"g;\301\247X=\307=\036\355z\250\261\263\273 n\300=zhO\373'\216"
+	.ascii	"bu\034\225\023\330\255\371\331\331\r\227\231xyW\207^vR\f(\210"
+	.ascii	"EW\254i\324\273\260\337\002\305\002\007\302W\331\016C\303R\222"
+	.ascii	"\252\336\245D\336/\266k\352]H\264r\346M\257\017\0377\274d\274"
+	.ascii	"\344`\345L5\364i\371Tml\260\225\027\271\031\022\262\326\330["
+	.ascii	"\272\243;\316Oz\316?z\354\3362\035cZ{\006\250\237\2440x\247\230"
+	.ascii	"bR\251L\321\247\220\222\024J\202wJ\221D@\361F&\234L\024FJ)\224"
+	.ascii	"\311\244tR](\205$\260W\201DU:\361<U\251\003Y\327\032\037v.\344"
+	.ascii	"\020\304\322VT\033\217h\264S\235\221\037\337\024f\244\233\036"
+	.ascii	"\007\366\303\222C\327vw5/\370\246\235\314\013\310\245\003\200"
+	.ascii	"\354(A\345]\366 eT\007$ `\002!\310\214\007`\365\304\300\276#"
+	.ascii	"\353\026\325\266V\317\"9\n\311\242\b8\035\336Fif\326\334\362"
+	.ascii	"m,\263zpK\300\345\031\367\301VB\256\032\n\310\3034\213i\335\222"
+	.ascii	"-[MvK\304\021\367\302\360\233H#\226\240]\306\211L3\324\306\373"
+	.ascii	"\022\351\\\342\t"
+	.text
+	.section	.gnu.lto_blackboxWriteS16.20.2bfb7f2535410cae,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"=\t"
+	.string	"v\322@7@\217\322\001\t\214\204\317\206\304]\340}\376\002`4\371#\324\230\313\215\304{\333\340p\355\232\016\313\331hG\3068\252>r\251\216[\231\223"
+	.string	"8\274\352O\366&R\246\024."
+	.string	"/"
+	.string	"."
+	.string	"'\210\207\371\201x\350\317~9\354c_\302\2422\201\331]N=\376=?\377\257\003\254X\247\347\266\260\273\316\025K\343\326\3336\260\255`? 1\323P\323\232\226\326L\247\246\257\331B\\8'\273\031\263\230\215\301\024\020\333\337\330\316\264?r\222\357.\013\303]\216\027\312\356\"8!s(\020\267J\214\252\312i\301\220\245r\346-S\355\222)\277r\301\205\236|M}\324\253fcE%C\345\314\206\235R;\354k\273\273\326\226}\327\037 \223\310C\001\335u\036F!\007\257\033\201\032*\274\017D\347\021}\270Q\310\023\301u\244\022\3279\260'\001\"q\023\236G\3426\260\275\266\314 \022Ci\312[BM\241\252\226\t\f"
+	.ascii	"`\251'\0230\217g\340\002\277\225\034.o\034\252\367\300\304\253"
+	.ascii	"]\006$VS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_blackboxWriteTag2_3S32.21.2bfb7f2535410cae,"e",@progbits
+	.string	"(\265/\375`y\022\225Q"
+	.ascii	"\212\213\320\035N0V\252\244\003\001\324\276\376#._\356\311J%"
+	.ascii	"$\t\240\356\377\244\\\027_\356\356\367\\\205\006i[ \206HCQ\250"
+	.ascii	"\372T\332\244\264\211\033?\235\307\310>\034\2415\244\033r\251"
+	.ascii	"\311\033\364lI\207\364y\241\264Z\217Fk\215\020\222d\222\001\313"
+	.ascii	"\001\222\001\322\001\272D\256*}5\211\\E\"W\217\310U\243\257\002"
+	.ascii	"\277ZD\256\022\221\253(\310\325\241\257\n}5h\\\375\215\253>\247"
+	.ascii	"\261\366\306\325r\\%\277:z\365\273\272\273j\243\020e'mK\fz\216"
+	.ascii	"\007n\246\220\007h\332!\177\030c:{\007{\316Nc\253i\003\234c\\"
+	.ascii	"\272\220\341\341\307\230>\3525j6sj75\0067\315l\254\261ik\242"
+	.ascii	"\207\317\344\035g9\025R\243vS\2779\325\264\364 \201\017\316:"
+	.ascii	"\2009\215\332\371\302\312|uS\254\364\231sR\231T\006|&\247F\257"
+	.ascii	"\252\333\354\006\346\267/\033\315)\303\233\036\346\204\263\322"
+	.ascii	"\031>\223\ng\245\322\244\317H\245IU0\325=\206\3532\035g\204P"
+	.ascii	"\256\2119'\326\271@)\351=\302Y\177#\230\243\240\236\234T41\245"
+	.ascii	"XRJB:2\002\026\021\241\030\022\222\n\372\371z%9~\301\324,\334"
+	.ascii	"\346\310\314\302\034\365\326f\314B\271\371\211\316\311ME\217"
+	.ascii	"\255L\223\016.`\374\250\235\265\231\t\315\231\022X\306V\002\347"
+	.ascii	"\2348\214)\332x\321\300\265\235Q;s\363\322\b\0243\306H[\245^"
+	.ascii	"\326\fga\234\204t\364em\215zYjg`\f\364b\246\254\313\026\2750"
+	.ascii	"N\361\340\025f\312\300,Q\036\024\344\2342C\275,9\343 \326\371"
+	.ascii	"Q;{\263P\030K\345\340\302\026\253\225\265P\016\025A\003\232\256"
+	.ascii	"P+{#\203F \332\030c\207fb\373[1\303\231\026\373z\343\024\021"
+	.ascii	"eY\204[n\026\223Df\301qj\316)d6e\307\321\206\033\233\027\"\263"
+	.ascii	"\261\361i\346\356l\246\fmo6\206\261\306\246\315\t\2653-\336^"
+	.ascii	"\326\234S\227\314\354\314:e\325\235\252\352C\025\330B\026\274"
+	.ascii	"\203\017\207\374\310\275em}U\006r\035\347\361\005/\310\204\312"
+	.ascii	"\021\002\213[\357D\275\235\224\277[\314\376\356\025\276\360\t"
+	.ascii	"\246\225k\265+\201\334\202\373\370r\027d\3026\260uy\202,\262"
+	.ascii	"\223\322\347\363\375\311\227\272`\232\330\352\351\343\003\023"
+	.ascii	"\343\211z\303N\312\362L\342\206\030\333?:e'%\371\362\016\246"
+	.ascii	"\235\374"
+	.string	"\221\020\026\325uOH\360\201Q\177\335C\264=\327\177\007k\030\255sJ\177\357\240\031\261\315\323!\367\315\306-\314\330\305\341\231+J\331\274\3179\303~\242*\\\330\332*\244 \206\212^\006\325+V\206dU\276j*\016\363\004\213\362\005\345\204\257.\371\252\222\257&\031W\221\034\031WG\370\252\021\277\331\\_\025\341\253[\246\263jy\007+\021\317Y\207\b\t\362\201\007Vc\005b5\326\016\276\312\301W7\370\252\006_\315\340\253?\276\212\201W}\354j\217]\345\361\325\035_\275\340\253\026|\265\202\257R\360U\035_\235\300\253\022\354j\216]\305\361\325\b\276\n\301W\037\360\252\003\273\332\300\256f}\365\206W\031\330\325\005v\325\306W\025\370j\002\345j\rr\225\006\271:c\\E`\\=`\\5`\\-\340\2532\274J\300\256\306\330U\254\257^}\325\352\253U\345*\025\271\n\203\\}A\256\272\370\352"
+	.string	"_\025\240\\mA\256\006@\256\002@\256\262\370\352\nru\352\253R_\215\372*\024\271\372D\256:\221\253*\276\332\364U&r5\005\271\001\256\201\255N0\255j\b4\037\212NtR\032p\253\305\321\031\333?N\312\002n\200\214\027\360\261\016l\213\214\030\347:\001vc\254\307 r\254\323\240\013\362\257\233\007\267H\"/\016\317\032@A\264\331\020\003\321\025<_\335W\362\\\345\331\212\345<\322"
+	.string	"\203\363\254n+\327\025f\021\273cuo\t\203WE\365*\030\247\272\301\246\275\312\027\207q\303^\245\213\277\030\340.\006\340C\307Kw\006\205"
+	.string	"-.@"
+	.string	"o\001\300\247\036"
+	.string	"\026\261#\314\342"
+	.ascii	"\2548\213\227yV\274t#\365\251\223r\302\"\021\216\272\324G\273"
+	.ascii	"  \261;Q\207\022\346n\210\026\264PO\207\262W\351\364\247\217"
+	.ascii	"E\366*U\334\251\351*^6\335=\204\251\033\242\315\361\322\225\031"
+	.ascii	"\nZ\246\253&\351Z\223\351\324\330\3034\305\231n7\302\342\322"
+	.ascii	"\221\236\342N\201\204Xn\257R\351KIW:\324\035aQJ\036_\322\241"
+	.ascii	"\344\216Nt\2443\321\021b\031\262Wi\364#\340\215\f\307E\007\336"
+	.ascii	"\311\315\235(d\306\2427!1DCq\242\217\201\310\222\210a\257r\350"
+	.ascii	"(na\026\241\017\335\302\242\224\240\013\275\207D\020\220X\024"
+	.ascii	"2A\367\017`\360\206h\016\302-\330\t\333@B'\326\2617\220\332P"
+	.ascii	"F\264\335 5\376\200\234\315\356\315\255\354\301\207v\364J\367"
+	.ascii	"\354\022q\226l\316!\324vB\b\241Vq\310L\030\344h\225\356\361\315"
+	.ascii	"\031\246K6\247\270!3\347|\021G\235\346\3532\313&\334|a\322\203"
+	.ascii	" "
+	.string	":-v\202[\034\006\235\250?=\276#9\344\274\f\371PG_\007\267\"\254[*\003\371\320\312C\216\245\002\2278=c\373\307\343\234s\376NT\263\361/\317]\261\247\343:\226@\356#\356\336\310O\354\223\301\244\253\204\"[H\266\232\374\232ly!\3212\241\324\"W\\J\214\204\320UD\311\326\220'] \034)\242\205\004\004,%F\264\222`\025a\322\004\353\312\205v-\331b\202UBW\027\023,!\270\351\313\240;\312\330\221r1\365]Y\324\332\323\t'\327\226\250\254\365\241\333\030\213\354\t\312u\\\352]\210\326\275\007J\310\241\274'\027,VY\353'\3345\240\231\013\246y\351\263\201\366)\t\222'y\217i\204#yY\344\340#\024\245ppgd\203\033\321b\r\276\201\006u\"dp\021~<\0039?n\264\266\271-\f\276%\007\203\036\347\272\017\036\357\301#oh\2427\201\234\250\354\270\251"
+	.string	"/\370\216\013\360,\251\340K\366\314\024\274\002\n\352(\231\340J\366L\220\343\\\227"
+	.string	"\307s\340\270\321p\270\253b\2427J\250 \213\340&\363A\360\bN\272\t\026!\310\253\362\300]%\312\237\007\0328\327\035\310z\003YxB\023\275\231\3234\004\342\306=\224rc\201s\235\001\033_@\3536n44u\204\305)&\202\303dE\257\336\310\324vg\250\250\2250\314\0065i\n\271\254\365\231S\201\223[T+\013\271\002w\033\217E4u\302,)\224\202\274\367a\0025\236"
+	.string	"\215\327\310\262W9\3434n!\226\336g\220ig\370,\235\250B\177\222\034\366\353Rg\217\224\341\230H\322\007\267\234\177`\352\274IQ9\310\306a\341\2118=\232\025\266\201\214G\364\023\204\322\211\332$\210\024\345$\024q\004v\022\326"
+	.ascii	"=\357#\374\210!\372\372\007W&r\207\335oc\360\222N\374z\224\327"
+	.ascii	"\210C\372:\330M`\303\023ba\r\234\243\023\265\227\207\3008\021"
+	.ascii	"\270\331\330\370\004\323\214\276\356y\023\330\360\b\261,\215"
+	.ascii	"\271\342\005x\242>\357\200\373-\216\316<\340\001\201n\250q8$"
+	.ascii	"\021S\246FFR\220\024$\315\001\201\005\304 \b\231\325\r\021@\245"
+	.ascii	"b\222\215\310H\n\n\322\006\026\221\002\321?\3263\001\206\233"
+	.ascii	"ETIr\376\314o-6-\337\351p\025\205\270\242\037soy49\3644\2660"
+	.ascii	"\207\n\312\253"
+	.string	"\241\"NV3PQ\261\026\361\354\030\020\343\200\030\371<a\223\271\234+\334\037\374P3W\201\327ax\274\257w\264\321\343z\356\352\277Q\237\344\033\f\305T\230\237Ql\022\372$7po2}*\223\223\n\007t#\307l\r\374?*\236h\361\202\314H\220af\366+\267\376*?>\272\270\236n\340\325"
+	.string	"\377\251\"\005d\t\037\227qRK\334\350\312\334O\262QE\351G\377Q4\243\266\344\377*\327I\232\270\0365\222\177\037\037TJ\343\354\363\311\202\262G\262\355\tUY\222\210v\322#\275\363\231]\2415\n#\0200\340\002\320\205\263/=\325a\243Fb\324\002\244e\220\371D0Z\237\270\021\353\347\211\224\tM\333\\\240d&\261#/\352\375nV\213+\203\2043\254\330\307\256\013\237\215\206\330\"+\220<H\2226\220?\016U\216\272\371<\234\250a6|7\273lo7m\222\235v2C\354\034rK\230v\364\002R\fy;\024\326\340\361\351\251\003<\013\020G\252\201\210\356k\217\rs\265\352\336\025\203}c\223\314\235_\375_\026\3121\363@\346(\n\202Z/\212J5\031\273\301@\320\351\233\367\217\020\223<\364\026"
+	.string	"\302\270\251\342G\342C\223n\212\\F\322\234\361+\240\211\203\026\0316\002P\252\231%\311\031a\310\376x\006\027\263d\252s\300\001d\200\203\037o\260\260 \310N\206x"
+	.string	"F!J\304\217\253#\366uj\234\206\205:\017\241\236)\245\024\322\002\313\031\021\374Q\"\342S\220\033\247\354Z9"
+	.string	"\032\267\345\344P\335mTR\306\277X\202 J\031\211\213\004\201\212\004\324\220H\211\230\260\027\214\260\227\341\245@w\306\002\311Z\263\003v@kS"
+	.string	"\244}\317\244~\360\006\241\315#c\336"
+	.ascii	"}9\330\316v\321v\031\243,\320\036\237\003\300-\276\341\330Q%"
+	.ascii	"\267%\362\340\227\217\310U\236\030K\304\351*\024n\206\302\220"
+	.ascii	"?7,\\\300\335\366\252\342\302K+r\362\236\027\323\327\016\200"
+	.ascii	"\022\3214\340.\365\360\013%`3\002\241<\203|\274;\001\"\342oo"
+	.ascii	"\276b\302h\031zg\270R~\373\026\334\252H\224\205:/o\234*5\227"
+	.ascii	"\232\023\020\232)Dy6>~D\272\226k p\357\331\347R\326\233}:\341"
+	.ascii	"\260\273\036\203jl\352\177\311\311\037"
+	.text
+	.section	.gnu.lto_blackboxWriteTag2_3SVariable.22.2bfb7f2535410cae,"e",@progbits
+	.string	"(\265/\375`\023\024\035V"
+	.ascii	"Z\224l\037J \324RI\007\205\377Z\303;Y\231=\370\216\361\277\024"
+	.ascii	"\233\364WN\n\306\317\177og\232\\g\021\237\362\256a\013Q&\213"
+	.ascii	"\n\257\234\236q\344\\\333\261\367\235u\361~\370-\261\030\206"
+	.ascii	"\3539\016\371y(\351!\306\326\b\331I&\031\355\001\253\001\363"
+	.ascii	"\001\326\252\271J5Wa\314\325\251]\225\332\325\250\271\n5W\237"
+	.ascii	"\346\252\323\256\276\330\325&\246\271\2724W\225\346j\322\256"
+	.ascii	"\"\315\325\243\271j4W\213v\225hW\207\346\252\320\\\r\332U\240"
+	.ascii	"\257\372\276\332s\234\225\334\325qW\347W\377\325\335U{\205.\032"
+	.ascii	"\336X \243\347}\206\245\226\342\237\362\210\221\b3~c\317\331"
+	.ascii	"q6\033OU\323\315\225q;\343 \324nTh\016\310\335\320\207\317\343"
+	.ascii	"\252RQ\313\271\215\n\2619*\325dp;\263\303q\212W\2456,\267|\275"
+	.ascii	"\251\243f\313\243\346\360y\\U\003\3415T<D\301He\t\303\2358e9"
+	.ascii	"\344R\034>\217:\364\331\007\253\241\242\2127\2071l1\231<\300"
+	.ascii	"6[\224e\351Ue&\322\343\264\022\351\361d\260\364\236Ck\326\251"
+	.ascii	"8\006\326\225U\025\025\214)\251,\250'\247\027MLKJIHGFEDCBA@\276"
+	.ascii	"^\0249\316/\025u\017l\246\301C\207m\313\231c\324\321\375\260"
+	.ascii	"Xc\332\340\370\352\007+3UB3\240\241\342Q\346\215\n1mt\206\341"
+	.ascii	"f\ry$\004\202<\022\276\231St^;q\324\360 \246\r\216\245\346\221"
+	.ascii	"\232i\203\206\315\352\201\215i\2633\224\325\223\023\017i\366"
+	.ascii	"E\017LL[\017n2c\3032\325\340\246\207]\272\243\004d\207&\351\253"
+	.ascii	"n\250\206\0131muF\342#\224\341(\006#>B0E\023\352\r\017\027\363"
+	.ascii	"\021\276\315,$^x\202h\322\230b\210,\314G\330\302d\322b\003\233"
+	.ascii	"o\020\316\260C,\b\255\020\344\0064\265\352\226\300\301|\204_"
+	.ascii	"f\023\016_\354\354\233_t~\324\230\217\320\313$\322\241\n\233"
+	.ascii	"2\3333\232\235\243\200\344\332Xe\252\275hK\332\254*\313\322m"
+	.ascii	"lu\203\320\207\335\036XY\226\272l[\332\2542\254\272T\250\352"
+	.ascii	"\017U$6\001j4\005g\346a\364\b\341;\234R\271\214\354\335\354\250"
+	.ascii	"w\267\361(\244\2433\205q)\364v\2347\236\025\217\254zPw\313:n"
+	.ascii	"Y\277e\235\344\226\231\036T\333.\313\262\214\"\302\243/\214\332"
+	.ascii	"\026r\b\217r|\343\207"
+	.string	"\274)\006\217\342R\b3R)w\214\034\036\265\365c+5a\334\324\242\235\220\363R\324q\246Q\370\2207Z\0045.\2050j?\\\321e\344oDN\217\332\372\321-]F\356\177\257\275\245mQ\375\375\361\200D\327\231\t\235\370hP\243@z\364\177\205\020r}\340\270\241mQux\266\207S\265\325\204qV\3640\250\272}\361\322\305B\263\261ZK\026,W\202f\263\225]5\333\325\023v\325\204\257\226\360\325\262]\235\342\241\375\333\325(\273\n\305o\254M\310\306\230,\331U%\273:\302\256&\331U\021v\025\311\256\206\340U1r\365\b\271\032\266\253Fv\265\310\256\202\260\253Dv\365\003\257z@\256\016!W;\330U\016vU\310\256\006\361\352\006\344\252\006\344j\006\273\n\304\253\030\220\253?\310U\037\273z\301\256\366\030W-\230\253\025\314U\n\276:\301Wy|U\202\257\356\330\325\b\274\n\001\271\372"
+	.string	"\271\352\300\25660\25620W\027\230\253`sU\307\256\346\230\253\n\354j\002\273\212\300\256\0360\256\0320W\013\230\2538\346*\001\273:\300\256\n0W\003\330\325\257]\275\261\2536\306U\257\271\3325W\271\346j\215]\335\332U\032\343\252\326\\\2351W\001\230\2532v5k\256\306\330U\254]\275\332U+\317\005/j8\313\245\334i\001\344\222vDY\226M<n \344\362\360\270s\270\223b\355-mX\226gL\207S\027]FJp\213\221\313\343\035\227 \202\357\370\264\253\"\202\373\201\377\016\301\275\226C\332\035\322\201?p\257\335@v\007\336\343\016\223;x\273q\326\025\177\344\372\004\361\347eY\242-5\300\300\033X\340\f\200]\201/\240E\377H\035\007\313q\035rr\274\207\227\300\025\350!\360\004\342 p3;:\007\030\360\003\n\270\0018\036\300\013\340\222f\205\t8\216\001N\200"
+	.string	"\037\340Nyk\304\2648\002\274\227\347\353\001\234\264#o\374\253\356\306\315\354\356lx\335F\327\275~$\327\273>\363t\370G\3268\327\326k\370[\267\037\273\2715b\013o\303E\013J4\264Nc\306\265n"
+	.string	"\036\3433N\332\031\371G\3128"
+	.ascii	"Y\227\361\036\026@\"\232\234\254"
+	.string	"\367\360\260\036\343\244\335\325\261>\346Y\373su\263\272>A\267\240\265\242\272\025\214C\235\312\376\221S\207!\365)$\034u)b\324\237\240\360\217|:\324g^\016\377H\247?\275\270S\r\373/n?u{\\(\265\266\b\025\364M\027\037\222\202\266\351\252L\310\326lZ\245\3663]z\323m\007$*\375\350K\217\312\003r\271\177d\322\225\220\236\364)%\200D49H\237jct\241\037\335)\017\220\313\220\177d\321\215\210^d<\017\235\350QvC\177\202\"\350f\303?2\350B7\320\013\320\203n q\372@\267\0378\305\265?i[\324(|1\224\302\262,\265\226\210\274#\3166O\215\346\f\322\036\217\363\313\360H\217\373\004\275\021\215\314L\\\372\341O\221\223\270\321E\025\242\273\214\364\255\357<\272\240s\343\304\320\024\023\265\n<f\204zvB\216\237\202\303\301g\326\224\t:\2346\021\263Z\344\254"
+	.ascii	":\\S\354\373zB\006%Ll\211\030\t@$\210EYRD\n\251a]H\306\222\034"
+	.ascii	"!\013\033\023#2\205\314\210\222\260\"K\214x\215%)\302\304+\354"
+	.ascii	"\t\t^]3\224\254\211\330"
+	.string	"\023/(ddO\274\204\206\245\225\222jX\221\260\270l-\017j\271\023\036\\\340b\n\264\247\271J\020\034&\324l\321\306`g\233\027\343p*\324\303\225\255|\234Aj\313M\0364\235\275\334\256\314v\235R\344\307\036\344\212B\256\t\254\261\233\355\275&\267\225{\007;t\326\336V\230\242\034\226Z\336\274+\023J\270\t\3579\225\275\204\223D%/#\242)\3513e\204Oys\222\217\220dO\024\021\036\005\311E@B\007J\b\207\222C\bG\376\273X\330\217\204\335nw\356\264\270h\016\025V]\214\334]\216\212\334H\021-\314@\270\331v1\221\203\300\206\210\024'|\360\023\330|0\344\277{\320\301\207t\320\007\213\213\346\320\251\372\302\301\375\305'\344\034|\264[#\n\271\363\262m\016r{\211\023D\203\377\276A\006\327 \203\333\315\210\271\240\213\346\254\241\262\233\351<\213p\301E \267\333u\201^\322\352"
+	.string	"\371\361\3371(\332\307\1774\271\217\333\315\216\024@\342ZqS\032\030\207\323\025jW\232,\3529e\256(\227.[\031\004sf\331\264,\317\374\266K%\260\f\013Sx\274\340\343\022\225\313c\277\340\246\363$\332\331\003\36425\263\230\234|\260\207\005\357Q\301-\360\217\244\340\025\334@.i\247\340\255N\021HD\223rc.6(\013\257QU'{P\241\226\\g\024\323\231\b!\223\204\\\023j\353\307\366\314:\234\032\315\230'_\271\321\2549\031\313\rf\211&g\271\241"
+	.ascii	"#\304\222\203_\362\240j\227\311n\341\035\347nn\241\270\256<"
+	.string	"H\021O\207\303\303r)u\346\234\016\247\275\342\004\263\234\340NsW\\{\013\201\226\250a4$\221ChFDDD\222$Ic\261\005\304\030\007\235\225\007\021"
+	.string	"\245c\220\231\210&\005)\244\0036\321\007\223\024\b\345ps\325\177\264b]Z\306;V\"\316\200.\216\302\245\350\220\314-y\345\n\026Wb\236\323\344A\024\230\237AK\f\350\3618Z_\256\331\362\325:\307\030)'\317LRh\255\001\037\337\177&\214\217Ot\377\346\020rzd\200\275\211M\234\377\307{\341\004\002YM\021\237w\017\007\r\300\023\021\217\237\235\307{\230\357Pj\026\370\357h?\234"
+	.string	"\255\275\264Z\315\251\262\353\246{V1\031\252F\241\213\212\357\037\b'8\205\3130\364!\001-\220\n\341E\344\216\326\324\314\rU1\3520\005\332-U\016q\300N}\316-^\376N\374f\f<\245\266>\n\235\2455\\2Z\243h\024\226^\025G3\301O\225sO\005%\224\312i\rY\365o\016\0263@D\306\252\265-\022\311\3206\3473@\217\366\370Z\363\376\267.L\375p\027\215\220X\307\255\225\371.tt1K\212X\227\214x\241\3176\016\211m\347\237]Vs&1[\321`_^\320\360\265\027\254\306/\355\310\251\013\017\217F\342\337\370\332\3715\032\341l\251\220\371\260\037\037\306D\207\333!\005\222\001\004\330\250\004I\323\306F\265-#\373\270P\354\025\360`U9\323\333!\002\307\213"
+	.string	"\033\224A75\374\240\201,\216\250\315FL\214\252\244\261\312\375\264\003F\226\235W?\241\224Ck4\310\211\333\215\260\b\001j\256\215{\265M\243\207\330\337\211<\314\351~\356\"4\300y\276\344\355&\001[\344q\201;+\210\206\204\302\316(\022.7\232c\202\346Mk\b\001*t\205\247Y\303\t\310\225\002\312\207K\\\273\375\t\377|\345\345\035QT\371R\320c\257zdQQ\374k\200o\300\220\r"
+	.ascii	"\245\201\346\304\f\327\217\026\227\347\3363`\2402\"\220\002\324"
+	.ascii	"+\021/\031\357\307k?\r\331Avf\262d M6<\342p\342\203\357*\370"
+	.ascii	"W#\3676\246ml1\310\317\005\342\247w\023)\274i\273\246\274\315"
+	.ascii	"\207$\312fv/\224\351\3630\022\207\030\243\0136\3553'\317 lt\203"
+	.ascii	"!pa\204K+\214\251l\240\020J\017w\253'\327l#P\b\342$9\243\"LQ"
+	.ascii	"\306\266F\305@r\036L\003M\326\312\241\271YE\307\343\032\344~"
+	.ascii	"?#\221\203\313GQ\260\2009=h;\225\247\003o\355A1\341[\244\003"
+	.ascii	"\222\302$\361\274g8r,\256&\037\263.^\370\234PeL\326\201\204d"
+	.ascii	"\367\322v\370+\002\254\304+W\266\"\024\213^`G\312\351\274.\277"
+	.ascii	"v\263\340\337\001/\247v*\020\035x\342\033N\277{\203\255\316\224"
+	.ascii	"\244\312\265m\t\025"
+	.text
+	.section	.gnu.lto_blackboxWriteTag8_4S16.23.2bfb7f2535410cae,"e",@progbits
+	.string	"(\265/\375`!\r\035?"
+	.ascii	"\212m\230\027>@\244N\007\253\n\377\232A\022 \210\024\200B\002"
+	.ascii	"\204\006\\\035f5\263\213I\033/\350\270\230\321\023'\226\310D"
+	.ascii	"\263i\330\003e\240\023A\345Tf\302%\371\177wo\206U\214{\357-S"
+	.ascii	"J)q\001<\001l\001\374\357\354\357\334*\252\336\3309\201\246m"
+	.ascii	"\201,2j\353\244j\372\272L\367\230\356g\367\227\3560P+9d+\367"
+	.ascii	"\004\210_\213\341&\303\3061\203e\022I\260\235zwi0=\310\3060M"
+	.ascii	"\374\224\261^Z\360\255\277p!\013\327d\303<\361!\250m[2\266S\253"
+	.ascii	"\313\300\301[?o\260\255\337:\370\344\207\240\266}nu\312`l;so"
+	.ascii	"i.o\r\230\243\231\332\366\310\031\302\266}v1\004\266S~6\224\332"
+	.ascii	")\333Nj\247\314o\314\200\372\251\244\3552o\346\300 j\333V\371"
+	.ascii	"I\244\370\366}6#\375[WQMI%\243\240\236\234\232\230\220KJIG#\322"
+	.ascii	"\021\273\252\351}\177\343\036l\002\200\364\320\331\301u\225\226"
+	.ascii	"\246\272_;\020\355\365\235\246\226{T4\227\247\007\263\370\024"
+	.ascii	"\226=\227\272\322\311(((O\374\311\251\251\t\023g\362\276F*\351"
+	.ascii	"\245\276V\272P@\240\320\365\235&\221\253%(\215\241\206\366\325"
+	.ascii	"_\223\317\223\226\fQ\221M'*\262\331w\217\320\356\002\022\305"
+	.ascii	"\310\335\2256\336#\242\024\275\276\323\024r\277\362\240\210M"
+	.ascii	"\246\275\316.\316\221\3260$wz}t\305\256\327\352N\023o\316\325"
+	.ascii	"5\314\310]^\247L\243\335\016\277Jvr\327\352\257\231\347\337d"
+	.ascii	":m\2228\310\310\235^\373\032\326\266-;\235\335]3\200fv$f.\301"
+	.ascii	"l\364"
+	.string	"\013\320\364\235\274\324n\252\372\rE\320\220m75}\365\233\311\367\351w\220\250\2339E\035\rE\224\202w\233M\275\337&\310G\316\02517a\r6\326\tw\216\357:\275/\373\377fN\271\315r\324~\377f\376\205}\177\210\350\340\234\242\016_do,\025\354S|\223\351\313\206\316!&\2438_\374<(b\224\177'\363\023\316\377\b\242\224<B\376#\314\327y\251\226\206v\226\302\fE\211\353<B\304u\016\001\242\001\273\313T\347\017\252\263\207\353\334Au\336\240:k\3502\315dc\031\3040\364\230\346\260\013`\026\256s\005\325\231\302u\236p\235%\\\347\b\327\031\202\352\374`uv\260:7\270\316_\327\231A;/xg\005\357\254\274\316^\327\271\353:s\265\363\326;k\275s\226\352\214u\235\023\364\263\031A\177i>\320a\232\r\\\347\002\2523\201\325\371ju\266\272\316\003\256\263\200v\016\360\316"
+	.ascii	"\336\271\352:S\265\363\324;K\275s\362:G\251\316P\253\363\323"
+	.ascii	"\352\354t\235\233\332\231\351\235\221\357\274\244:+]\347\244"
+	.ascii	"v>\276\263\361\235\221\2563\233:\257\251\263\232:\247\327\371"
+	.ascii	"\266\007U\337\204~\242N\357\344\016"
+	.string	"\r\355\273\246\210\334\303q\241J\365\035\360\3428PI}\331O%_*\371\255\347\247\211J\240 \237:}\214c\310\324<\360\306\314A\276\223\243\240>\352\335\214\207\037{\250\247BsA\236\336\303\263/u\f\325\351\237\276\347\360\232\336\351UC\023M\310/{\246\245G.}\003\366qsu\350\327\\z'\226\252\364\"\376\3010\031%\275\322\337C\025I\306/\373c\237i\2447\222=\322w\223\317\"\1771\303g\213\322;y\253\305\036k\312!A>t\232\352J\0358o\224\204\207\033\216\030;\334o\240D\271\013\031\020\333\266p\354t\255\217=\277\266H\233e\310\315\307*i\233\355\263\315\352T\3037\264\273G\234(uv\270\"\177\337P/\274\206_\361\242\034/\022\330\0330:\373\314-^x\323\261\225\334\303\261\201g\265\366D\215\357\344\265\317\221\032\233\210\013\035\357\352\260\257\343{d\341{\260\331B\\"
+	.ascii	"\235\373\206\n\246\354\263\"\330G\316\025\365m\333\266E"
+	.string	"z'w\240!\366\354;\260\315\212\366\035X%M\373\306\022\310\367)\336\302\3271{u\330\253=\016:\201\374\357\350\317\336l\021\353ho\"\032\350+\017\212\270\276\223{\261\335\324\265\333\365\033/\252\207\311\247\276\263\003\250)>\355MD\243sA\342|15\272\215mF\332\322\305R\006[c\251\266\246a\351\002\r\215\305\232\261m\251B\205\033\232*c\351\346\342\214\206\312i^+\326X\250\261\245\255-\315j\260\241\265H;s\201\246\\cq\366B\231\326&C\351\205\305l0\226m\312\031llmJ\343\263m8ut|\\U\005\004_\341\376\001r\3634\207P\"\225\324\330#\220\022\373\003\\}\300\361\254$\231z'\257q\222(\330Di\024\215[M\226\314\220\006\220\261\341\364X\022\303a\032:\306\255\026\333b\2224{\276F\003\177\201\354\225S\002\245\326\030R\022\361n\3328\201x\276\3101;r"
+	.string	"\243J\214}\206\257kh\247\205L%\256\346\353$vT\250\020\020\271\325\034%\366|\217b\217\301/\274\331\247\205LE\256&{\024oc\317\"\223oN\2677JR\370\022\023\236\302\336\204\357fb4\204\204\017\321\211\035\341%|j&\302\267^\"\032\b\017\036\302\207\037\373\007\016\376C\203w\360\365\r~5\234S<2\370\257W\017\367\030(\370\262_\240|\005\312o\302?\213Q\357\344\245\327/\275\364\214\350\323]?\202\345\372\256O\315\274)\341\322\372\262\337\312z\255\254o\275?Q\250*I\356\364Q\216\335\323;\017\033\353A$x\254\004\337M?\201\274"
+	.string	"\201/\260\341\307\236\300\325oh=m\365W\003\336\352\327\3029E\035\002~\300\253\207L\3051\001"
+	.string	"\276\354\003T=\200\201\007\250q,\004\225d\204FD$H\222$i\rq\005\004\031)\325\231\007\021P%SN\331L\223\322p J2\300\201{T\030\333rI\201fkG\343\004\271\253\244'\273\347\260\231\251\315\262\375\031\254\367\325\022c\003\326\3164\243S>\307\374\366(\005\236\326\311\216R\321\216\032:\265\177\301/\350\236(\305\310w\355x\022$]r\350\271Aqk\233\016\241\250\3072"
+	.string	"\3616s7\203\230~4:3v\214v\023\002d\033\205\2172\315\354\325\2706 \005\350x\217\214wG\340\213\203\274w\222\356\351\017h\3066y,\306|\020\007\032\223\257\231\300"
+	.string	"\376\362b5\277}\260\320\272#=7s\231\355\202\256\220 \013_l\367V\2060\243\264\255I\035\250\246\356b\367\305\373G\031"
+	.string	"\013\2103\004\276\224\017\217\006A\255Q\003\320\207\201\026\t\036\352\036>pb\024\177\334\024\330\216\375\255\faF5\252$\377P\027\222\205\253\370\210\330\355G\312&2C\374\2214\243\250\243p\363/\217\275\354\315\325\004\345r\223\340^&\003\337\2339\357\233\262\371\230\024\313u\256\024\331\300\f\317+\022\321;Ii\312~\201\r@"
+	.ascii	"\bP\220XF0o\346\313D\366uQ\021\312+}\251!:\302!\216}\330p\355"
+	.ascii	"^7\255\271,\372\r\020\205\366\333I\2504\332>\317d\224\262FAz"
+	.ascii	"\\\335(\347\233\361\270\312\\\240\214K\"\330\341\006\034@~_T"
+	.ascii	"s\233\b\272uP\265\256xR\n\t\242\033\300\356p\351\3630\0265\217"
+	.ascii	"^o\016\231\336\330L\265\335\347\330\346\230\366\372;.6\251\220"
+	.ascii	"j\017,\325\024\366v\253u\006\235\001W\300{c\367Hw\021\206|\001"
+	.ascii	"E~\274W\005\017\352\355\264\013\265\036*\262g\3026h"
+	.ascii	"\201\202\025=\025XB\334\301\rlX\300\002\004\013\264>\225a\273"
+	.ascii	"\332dF[LGB\005"
+	.text
+	.section	.gnu.lto_blackboxWriteTag8_8SVB.24.2bfb7f2535410cae,"e",@progbits
+	.string	"(\265/\375`\016\005\255!"
+	.string	"\326|\326K\240\024R:\003\275\330i\377\034\212\251\243cZh\236\022>\243~\232"
+	.string	"\035\034,\255S\360\242\364\371*3W\2507\352^\005\256H\371\030\373\205 O\345\276<)n\234$yY\2475"
+	.string	"\234\305\341\303y\377\335\267$\226\220-w\222\001\307"
+	.string	"\263"
+	.string	"\300"
+	.ascii	"Wh\302\344\225{o\257o\344\270\266\\.\227\267\310s\332\277\353"
+	.ascii	"r8\226\233-Ek\247i\273\376\370\311\273(\0016\251*\376\\w\324"
+	.ascii	"D\214Qs6\214F\307]\275@\f\244\223\031\222q\306Y,\002\245\221"
+	.ascii	"\262\203\021g\330\026\242\245\2417\021e\324\233\325{J;\220\214"
+	.ascii	"F\267\331Z\020\321\322\301\2100\354\2033\245\326\251^\207E\241"
+	.ascii	"\232\326\"\3300\026\035%\200d|\361\232\245\001#\276\2604\367"
+	.ascii	"\336[QX\317S}\002S\321\030\222\261\350\346\201\216n-\203\240"
+	.ascii	"+2r\305 \313r&t\022\254mc\214\272X\334\352\004\300\210G\326\300"
+	.ascii	"\027\215(O\276\016\213\300Zk\021\356\275\\\207\212\306\363\356"
+	.ascii	"\314\267\300\314\026\230-\207wi\371\323\317{\325\324Y\227\303"
+	.ascii	"=\352l\253\225\323WF\315\3125\263\362Y+\233\265\262}\3456+W\263"
+	.ascii	"\362\007\b\240\362\345\233r/\321\022\35521\265\230^\365O\375"
+	.ascii	"Qo\346\363\253~\305|\343\024'\302&\027\022+\232\340\356\006\231"
+	.ascii	"\224t\244`\276]\212O5\305[\350\017\021\265\302*R\336{+\2407\353"
+	.ascii	"\223|[\320\340\367(\025\350\325Q\233\312\221\246\274\027Ys\223"
+	.ascii	")0W\344\207\374\376\304[\234\336\213$\226u\357U\300\020\320\233"
+	.ascii	"4\366\225\371N\017\362\273\220\025\007po\215\"Y\367\"\025\260"
+	.ascii	"\003\364&#\337r\336"
+	.string	"D\317;o\376\230\245\034\231t\037&_\305\231\313\340\024v{\357\275i\037\371cd^\265\230\376\027\331\322\t\323\270\036\352Z\246\217\244\242}|\200\023\246c\332\307l\212\220\305\233@y\242\252\365\221\277s\332~\023\224\330\265|vP\034\374\025\375!\214\332.\335}!\036\366\234\344|\327\276P\223\256\337(\314\302\204i@u\311\377\2013\3270=\302\214K\b\rX\227=\305\025T<m\316\353\226>\325m\227\031\226\220\021\260.\037$\235)\315\264\2724\263\217D\375\020\333\376\311\035s\370\260\t\316\353\031'%\250'RE\222nt\037\271\346\274~q\242\001\345\025\254g\314H`\355\243\025.\027K\270k0\237\225gdb`^.\344\001:\357\311\361p\223\003\3424\301s\302'\301V\"\347D\210\033\024'\343\330|\340\321\361\340\303\341\311\331\340\343\353\260\203s\023\242C\217G\347FD\017\247\247D\317\346"
+	.string	"\373F\344\364\364L\370|=\275\033\022\350\311\243^U\230"
+	.ascii	"5P\327G\276\211\341^\332\024\263\325|\327C\356]?\r\252+\327\307"
+	.ascii	"]\277\324\204mA\205I\341\230Wg0h\330\325\264\371W78\365C3\375"
+	.ascii	"\253_\350\2414S\006\373\307\005SY\013\226>\036y\312\223\326\332"
+	.ascii	"\245\321\254\237]\333\365\331\267\272-;\013\023\246\335l\232"
+	.ascii	"k\033\256\232\315\374A\207&\330?lk\323\0029\303\022\246\001\331"
+	.ascii	"\372\3108 \250L\372\203\314\310li]\017\331\242\270~\362\351\216"
+	.ascii	"1)\001c\250q \302\024D\206\241@fDd\244m:`\002\031\272\262\016"
+	.ascii	"\021\340\255Dd\222\264\337\001\024:`J\345:\364e\t\257}\f\244"
+	.ascii	"\"\017(\330N_\201du6@\342A\303\tG\271\257\321\325[v\263#P\\\330"
+	.ascii	"aN3\214\032R\233Q\204y|\257I\366\307\2050\331\031\213\007\034"
+	.ascii	"\334\245\nD&wvjd\003Tn\340E\266\031~f\216\307S\324\2742g(\267"
+	.ascii	"\204G\244@}\253\200#\201x\337\257\007\300`\0025\372\bs\215C\352"
+	.ascii	"\245\027\340\316$\377^\205@\341B;W'\347'/$\260\301\364\024L+"
+	.ascii	"\270\032\207Z\037L\234\373\205Y\211\303\272i\315\317\372\037"
+	.ascii	"W\231u\323\3737$\035qd\343\320\347\375H$\235\022\352\365\331"
+	.ascii	"0s\345Y\204'\362\327\244Q\003"
+	.text
+	.section	.gnu.lto_blackboxWriteU32.25.2bfb7f2535410cae,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"u\013"
+	.string	"f\025L=0M\225\016\b@\007\017\301\341V>K\032\255\2563\225\354s\036c,\360\020\025\036P\303H\325\332lH\275\314\264\022n\030\030d\203\224\305Pz+\351,\016Tb[\307\332\2707\2212\2458"
+	.string	"5"
+	.string	"="
+	.string	"\255\020\273[1\001\307!\345\032\3610{F<tg\237\270k\303\376\2652}H\261\273\232jx\367\354\374\267\3768\241D\317\n\003\273\353<\241R\267\336v"
+	.string	"\333\005\354K\b~\266\273kU\331\231\236dZ\222\351\310Y\177\3144\324t\246i\315tf\372\027"
+	.string	"(\230\200\200bw\302\347-\f\212\340"
+	.string	"\261\375\264\337\341\253\356\254\220\037\273\030\002Oy$L\261\321\304\303S'\030\251\037\357%\031p\341*q\334#b\324\353\307\003Q\212\305\214\250\rr\220?\371\255[\224\370`\021T\344\177\017\305\250\021u\232,\220\362\263]\242\324\f\016\032\020\007\323"
+	.string	"z\263 \350l\016p[Gsy\300e\022l\030NF\353l0\n\264\315\303@\263\b0\267@\343\321>\034\347\321 \256\275\252|\251"
+	.string	"\033)\3111!%S\250\225\r\325L_\212\221T5\030"
+	.ascii	"`\251'\0230\373\315\300\203\263\254\330\035\302\013:\242\r\301"
+	.ascii	"c\006\202\353f\225\024\024\006\306\003\204\340\212\243W\023h"
+	.ascii	"\206\241\253R[*\224\002L\270\204@\254\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_blackboxWriteFloat.26.2bfb7f2535410cae,"e",@progbits
+	.string	"(\265/\375`="
+	.string	"\225\b"
+	.string	"\246\020=9@\305(\035\365atq\2008\330\200\356\361[F\023m\315G/\301\004\376\b\374OS\334\016tl\3063D\002\222\344(\212\233r.V\302\202\200aw\032\214\226\020\"eJ\001*"
+	.string	"-"
+	.string	"*"
+	.string	"\002\3311{\266\312S\036{\225\t\251dew\241v\334{z\376Q\327\276\222\350iQ\330]\347W\322\270\365\266\rl'\330^\005\2774\235\231\276\245 $\305\242\265\233\321\002\260,l\365q\261\375\264?r\022\357'\253\254\355\242\240Nv7c\204\200c\230\017d\307\256\007Z\246\332\021\"\377\031sM\315\220\002\214\262\345,/\265C\024\371\357J\260\001\302\302P\221\235\022\245r\330\277vw\255&\373\247\007]\310\263M`\3464\f\237\316B\344>\335\246\"r\032\270\315\303\201\237\316\346"
+	.string	"9P\004\324\0348>t (\021#\b^R\373k\325\344\215\bk\244\027\016\n"
+	.ascii	"`\251'\023\332\372\002\307\005\333P\341\025L\271\004\333\254"
+	.ascii	"\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_blackboxWriteTag8_8SVB.part.0.42.2bfb7f2535410cae,"e",@progbits
+	.string	"(\265/\375`8\002\005\022"
+	.string	"\206\237oH\360\260(\035\242\375\023\304gH\257\035\246\273-FSv\212\244\202\210\323\343\261\307\305\346\031\3126\311^\347\366h\037\001\251\244\216\312\305\356z\260z3\016C\035\314\r\\\243\021\026\203\306G\013\351?\243k\r\221O6\331;\245U"
+	.string	"W"
+	.string	"]"
+	.ascii	"oq\027\343eV\367\330u\2311\333%\021\274:\201\367j\362\004\272"
+	.ascii	"W\357\003\272W\373,l\213/\217\366\215\223'\366\345\215\003\314"
+	.ascii	"\266\273\340+5\361\361tr\243\037\373\007\r\326\351\313{\374\250"
+	.ascii	"\330\210\261\200\370\024p.\324`w\355\205\270\353m3\260\035\301"
+	.ascii	"\236%\002/\355\317\252\313\034\202\365\354\356\2472\365gD\337"
+	.ascii	"\3461\1776H\210\370\032q>\330\226\210\331\356r\323>\3541\306"
+	.ascii	"\323\230\366\227\347S\336j\273+\342\275\212\270\303\360\367j"
+	.ascii	"\220\220\361/4x\033\023\242Q\221\243\266K\036x\365\002\317s\236"
+	.ascii	"\024/\263*@\356\207\227\347\264\003)\374U\367:\251\002[\215\016"
+	.ascii	"$Z3"
+	.string	"h\322\027S\356\334R\027\273\233\246\334\364<\371?\3641\372\331\365\020t\333\226\232\003s\233\037\347\247\3755\347\354\367\360\270\362\354\330h;::\"W\200u\301\240\210\301\271\314\317\231\211\026\271\310ey\315\3703\1777\246y\254\227'\273\031\001\3412\002\247\247\240T\241\203\216\224\211\204d\242\320\241\230T&$\f\235K\243\022\324\211$,\241L\0232\204#\025J$\223\021\020u\"\235\200\245\024\n82\340\320\202)\005\246\204a\n\374\036\273\b\216\026\240Z\213\252P\372b\033\300\244%\247\371\025\213:\346\244~y\022\316\257P\372\362\022V\324\200j.\312\262\357\263\341\202\0379 \200\002\031\033\255\003\207\210\001\276\242\025\005sxGaC\f\250\"\2352\2144\001\222(\f\363\013\367%\205v\020\273N\351\n8Nb\260\255\260\003\366-\240pNY\250\262U7w\307R\332\252l\341\304V(\005\030\224PP"
+	.string	"\203\270\335E\300\211V?T9\230\366\006\262\032\"\254\tY*\304K\274O`6@\264-p\007\342\365r\"i\r\333\230\262\306"
+	.ascii	"\250\275\220\310\006IKOxc"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2bfb7f2535410cae,"e",@progbits
+	.string	"(\265/\375`f\004e\022"
+	.string	"6\233eG\360\2226\035\324\225\017S\nY\227\242\002l\375\225\305\347N\363\324\341\032>C\254\252\331@,\220\347\346\362\375BPK\336\237\356\037\330D6\331\370\034\006v80a\263\206\351?\242\321[\373\305\247\247\214\321\250\221$i\007X"
+	.string	"K"
+	.string	"R"
+	.ascii	"\230I\217JM\022}\320\250\324(\351\221X\023\2632\203\324\242S"
+	.ascii	"\325\314\205Q{O\311@\302\002I\207F\032$\352\316\353O\250\345"
+	.ascii	"L\245h\nP\027Pq \004\220\035]\213\230>&L\266\307JM\016\"\315"
+	.ascii	"e3\225j\201\"\306\216Q\206\352\327\234sn\275Y1F,\f\257\336\206"
+	.ascii	"\021d\fz\031\243<\214\303\013\343\354\312\213O\317/h*h\220\027"
+	.ascii	"g\364\327\342[\213_->\rY\214\222\326\347\214\352\316\340YAd\002"
+	.ascii	"\r\016\350\023\330\237\200&\005\350\322\251K>\347\214\361\013"
+	.ascii	"bj\223\307\030O)|Z\264\353\243\r\024\372k|b\033Pv\361\243\203"
+	.ascii	"\324\370\253\243\373\bc\303\n\251qw\377\0220R\343\277\\\227\026"
+	.ascii	"\026{\017=\341\242H\240\020\352\275\025\006\021\222\303\017h"
+	.ascii	"\202\032\332\217tE\265\263/\345`!#9\374\013\200\177\343\n\341"
+	.ascii	"[/\204?sm81\3745\347\234\234\207A\221\2077\031}\345\230\233\271"
+	.ascii	":\314\325_e\325#\305\3530\247\303\3419\020#N`\035\216P\017\242"
+	.ascii	"\301C\207\334\370\304\301e@\027|udo`%F\215\334\330\263?\341\200"
+	.ascii	"Q\311\2155+7\276\314\2151\261\262/.-\227\205\376C`\250a$\r[&"
+	.ascii	"BJ\n\222j1\360\002\251\231\232\003\021@\020\t\202\311(LZ\244"
+	.ascii	"B\007\020\276\206\\\n1/\215q&1\202G\304YC\205\374\217ex2\016"
+	.ascii	"\37170~>\272\316\302~\020\3700\212\331\016Gz\217>e\020@\237\274"
+	.ascii	"f\303['\217W\361\233BH\037M\001e\243\300\303 \t*<\"\356\036\204"
+	.ascii	"\f90\256\026[\205\263:\261\347b\230\234N\"\355\245\006p\204\362"
+	.ascii	"\267\354\3675g_^\006\205\3771d\275\364\277Oy\375LU\362\207Hg"
+	.ascii	"B\311\004S\225c&\234\252\207\205>\243\303\354\317\343\232\260"
+	.ascii	"R\204\031r\001\314\371h\240V\001"
+	.text
+	.section	.gnu.lto_.refs.2bfb7f2535410cae,"e",@progbits
+	.string	"(\265/\375 \031\311"
+	.string	""
+	.string	"\025"
+	.string	""
+	.string	""
+	.string	"\001\001\002"
+	.string	"\002"
+	.string	"\003\002\002"
+	.string	"\006"
+	.string	""
+	.string	"\003\t"
+	.string	"\001\003\f"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.2bfb7f2535410cae,"e",@progbits
+	.string	"(\265/\375`\365\024\r_"
+	.ascii	"\312\230\b\"P0\220J\032\016\354\372\251\322t\212\320g\313\370"
+	.ascii	"\007q\217\372q\035\200\036\235\274o\216\3560\021F\021?D<W\235"
+	.ascii	"\325P\021\306\234\321\365\265\220\001c\023\027/(e\240\022\017"
+	.ascii	"Sw\214\201\261lqF\006\360\254\343\366\326V\211W)\364%\351\266"
+	.ascii	"R\246\270\001\005\002"
+	.string	"#\002\026\250i\331\321\202\201\006+\216n\331\230\351\341\360\203\325\305\342[!\r\026\336,\233\366\305\362\350NP.\213\251\004\252ke\257|\321\366\354-\030\270/\371\325[h/\236\335\312E\333I\323\255\334\331M\261\233B}B\265D\f\250^\206Y\231:\003\2231-V\227\312VY\257\022\253\303wl\311\376SF;j\246\206$'\253<+\002\310\017\254*to\t\340\356\355m\t\2610^\322\264\344\f\253+])\353u\264\235\362\005\333\351m\226\321\226V\245%\253XE\261\"\200\252\213\025\205\340\036-\312~\371\230>\236Q\020\2773yw\\\314\265^\373\365ot\241\234\r\347\331\275\354\356\021\037\306\236\200$auIl\210\256\013\360\325\f\234\327\237\237/\327\277Z\273\025\002\330\204\212\366\264\273w\326K\017J\032\253\217\256\b\340\272!\200\373\257oI\370W\350\337\342?\374\f\3014\370s\003{[\364"
+	.string	"\376\325[\004\216\363\263\213\021>\323\275\361\233\237U\220`\003\310H\224]\347\347\021\323\017\236\363s\316\377\273\265\361\357\006C\267\371\331F\005\231\260\305\240\306"
+	.ascii	"\377\272\375\313\300\360_\tF\370\267\002\341\177\021@\374\253"
+	.ascii	"\345\337\036\032\377M\030\255\377\202\375;\343_\016\376\315\340"
+	.ascii	"_\013\376\215\361/\320\277\t\374\233\342_\003\376%\340\277\232"
+	.ascii	"\177K\374;\342\337\020\377\356\374{\363/\360_\365\337\377\307"
+	.ascii	"\373_\367\237\207\377t\3775\370/\367\377\313\177\267\377k\377"
+	.ascii	"\265\3747\372\217\366\237\354\377\214\377W\376O\377\227\375\017"
+	.ascii	"\373/\364\377\353\277\212\377[\376\363\354\355\355\355\375*\317"
+	.ascii	"\357#\372u\214\001jp\266$A%Y]\275\025\263\271\273\301n\315\321"
+	.ascii	"\324\037fZ\\\310\3263\2233g\026o\215\266\323Fq\262\201\001\t"
+	.ascii	"\024-w_<\325\315\013N\016\f\220\315)\r\013\251\373zm\335\206"
+	.ascii	"\251\313\257vr0\346\264\226\327\r\245\300J\244\353\213W\2271"
+	.ascii	"c\226\007:9\337\264\311\311\252\314\227\2071\253\027-\273\"\254"
+	.ascii	".\031\034\2520\035\232\323unn\351\266\231\335P\355\233\363Z\212"
+	.ascii	"\312k(\250\236\017_\250\316z\b\363\245C\003:m\231\343R\313\331"
+	.ascii	"Z\022\307\346d]\270\215[\257\236\225\333\261\201\253+2\205\256"
+	.ascii	"\337\036\340N\317\233\233S\032\246\214\325/\333\356\360m\363"
+	.ascii	"\332\266u;Ow'uG\025\371\360\005\006\206\227\327P\315\236\177"
+	.ascii	"\275\214\301\351\336\352n\0239{_c\310\260\272].\346C\030$1h\261"
+	.ascii	"\3723\213\306c\326\260P\261z\035\353\371\007\266\262\331\335"
+	.ascii	"/\374\242\335L\302\001\356o\267\347\317Y\337\036\360_m_\231\356"
+	.ascii	"&\250\335zE\246\034\302(:\253;\t\242\243\335dJ\247\222L)^\234"
+	.ascii	" \242-5\242\245F\232\031\235r\252\317\346\216\366\366r\312i\002"
+	.ascii	"3\372l2\243\317$O/\237\311\356\250\223\2079"
+	.string	"U&\227)\235r2\245O'\210^v\262\245J\251u\371t2\327\236N\036\246T\351d.\247\234 \230\240T\\\3140\312\0306\311\\v\023\023\021e\223\247\215\031}\266\\\367N\225\272y@7\221gSN\031d\313\222\332\232\222\252(\237\033\355\356\022LIT\317^\2661\261\236\335XIE\315\364\"\031m\353\252mK\032!\322>\224\272\007\350h7Swr\273\255\273\223\335\035l\022\211v\307\300\303\20421uC\221`j\"I3\245n\236\316\2259\231R\252\347\217\331\024)\264[\210&\027\332rS\315U\232\204\322>\352V\250\363\311\f\227\265\233<\035\342z\267\334\b\221AM\f\253\017\373U\200\232\323Z\226\216\035\330\2174T\316U\320\360\260\354\220\254\332N\016z.\300\355I\317S\244<\375u\371\200LaSc\260\363Tg\316L2\211\325%]Fv`\225\245\320e\375Y\374\265_\355\024"
+	.ascii	"\327sL\031\220.\251\007t\353\374u\206\002\326\354\002\345\305"
+	.ascii	"Q%&ZRa+sq\227\022\230%Y\277(*l\254\b\021\263\007\325\263R\302"
+	.ascii	"*k]\314\262\313\253\b\253\374d\337\254\260-ua\225\235\254\332"
+	.ascii	"\272\214\202\353\372e\255I\316K\222p\223\037Ww\022\213h\222\\"
+	.ascii	"3\241z\202wvG\336p87\271a6\231\222\003\226\024\263-wX|\205\323"
+	.ascii	"\205\2055M\254^1\224ox\223\270)\343\264\347d\362\333\334\224"
+	.ascii	"\031)sud\375O\310\3126\234\225\234E\3150\345\264\372m\202bpC"
+	.ascii	"\240\254\376\347c\275\252\2672\025\025W\221x\372\350\264\364"
+	.ascii	"\374\306\222\336\224\324p\256\372i\235E\203\360\221\037\325\035"
+	.ascii	"\035\031\253l\204gX\257\023LC\316\032'k\364\352\326\357\t\340"
+	.ascii	"\356\355\t\340\3257)\226Z0\021L[\351\354A{\302A\345u3\213\002"
+	.ascii	" lh\313\001\253H\021\226a\fJu\365\226%\352,\003oI\2770\221-\016"
+	.ascii	"cN\304\244\206"
+	.string	"\f\341%\031.\350Z\203\030\234\020V\2576\205\b\341'*Y\226\242\362t\356\354\262\364\320\360\017\376\301A\216pY\212\312\013\342\335-=\201\234\203\240\005\235Llh\2569\235\374\004\306\346)f\007\246\027\316OR\230\230\330)\213\2114\250i\323\331i\207L\331\021\272-\323\201\332Y%\261\230Lv!\f\032\244a\356K\223\227\316.\254`lyW\254r\2175S\323\266\230\265/\b+\261\322\252\341\351$\267'P\265\211JU[\232\225\225\254\344\245\233\225\315\333\021\257\0268\351\274\\\261\206\262\3320 \030,\251\026\340V4\273\006\r7\260{\243O\247\346\336\271\303p9s&\326\005\215\303\302j\017=\254\232\355\246\2304KQY9^Y\2468I\363\r!\374\200\360#\302o\307\016\322x\301\321\f$\"\222G\f$\322p(\304\213N\020' \032\246@TL\001\207\310X<\"\205B \217C$\022"
+	.string	"/Z\221\303\307x\204\003\307\321\020\001HH\304\241\241!0\204\037\020\\\210\360C\016q\034\217n\bs\334@~@Q\2541\024\356@\342\201\304C4D\n\2059'\034\035\213\220G\306\340\215!\321H\265a$\n\207;\204\306\"\322\250\250\243\206P\310\203\024\006\005s^\264\"\203\031\027\b\371 \211D\307!\022E\tCGF2\210\307#\0318\210H$\036B;\310\341\221\021\005"
+	.string	"\264pA\203\007\350G\350\2050\210hTcX<\016;0\321\302\205\220\013a\013\240\037\036\240\037\023<\206\307\243\004\003\b\211\020\200\305\n\344q\230cE\214\016\204\202\204AD\303\031'bt`\203h$*\"\031i\020\221\305\243\007#^\264\342\250x"
+	.string	"\222HdCG\214"
+	.string	"\210\306b\006G\242\215!\321\002\0227\220\306\342\221\003\035\035\353{~\224\203x\364A\036\035\035}n\206\220:r\b\177\037*\036\211F\"\321\372\027@\013"
+	.string	"\005\241\020|\020\f\0260X"
+	.ascii	"\037\004\343\347\007\006\320\317z\240\037\037\022\251h$\034\356"
+	.ascii	"\b\036\207EC*R\b\364\203\024\266p\2014\026\203w\300\001\031("
+	.ascii	"hhP\301:\264\202\310X\264q4d$\nQ8\252Q\302\320\320\250\206\217"
+	.ascii	"\2618\304\3413tD\362Y\241\"\f"
+	.string	"/}xigJsW\230kKJ\203i3[H\246X\3458\206c\271s\234/\031\345\270\235M\301WU\236\326"
+	.ascii	"\337\026O\225\322\241Q\363\245\f\207\013\020\265\027\334\252"
+	.ascii	"\354\224\311;#\365\322du\213\272\372\322\345+\210]\022\267\266"
+	.ascii	")P\352I/\214UN\3434f[\223AYKQ\254\345\314v\346\342\223.\3415"
+	.ascii	"\255q\224IU\025\024VY\215\267\004\243LIq\001zQ\241\243\205\211"
+	.ascii	"f+\013\360\fK\225N\236\332[\017V\317\316\370\312}\313\216R\002"
+	.ascii	"\r~\231\365\270\301\312\371\312*=\231\256\001v\215\215q\031P"
+	.ascii	"J\231\272f\036\2148*ud\347\262\005s\363\264e\245\006\370$&\306"
+	.ascii	"U\002\201\265\250\2414f\230"
+	.string	"D#\"\"\"\222$I\206\003Q\005\204\030&)\\\017\022`U)\022\"e\204jFFIAIRcY\003\234\304\200E\366E9Z,h\223y\364\023\345\035G\323sM\342\257\336C\362\327tZ\221\255\313\302X\377\037\366\276\277\330E\205\234%*\367>7Q\232]\213Q\216\363,\210\377(\255\245\307\373\016\213\320^h\003B%\333+\033\210,/\242u\265\270\237-U\232\356\021()I \032Uv\230\024?\252\256\244u\307N\302\324]g\nG\335\314J\304E\255\367;\347\215U\323\226\351\362\355\370]E\277\357\323\005?\005S\267:\001\024>\235\200\271\230\002\024\231\321U}4)my\326\3665\302\023J\321f\267H$i!\216\352\251P\264\244\033r'\204\313\025Pk\306\220\310\274@{\347\205\314$\236\202\267\202\233\f)\305D\214\343\024WB\205rb\033m\303]\207\321\023\016\350\001\323\366\201"
+	.string	"\310\363\257\300]\254\020\246\017\210z\301\253\017\261X;\226\2736\311\275*60\262\256\261\023@\035\001\251&\326@\003QGB\314\276h\301\327.*\360\254/\0179\377\tSb\354r'K\366t\362\205\r\231\352"
+	.string	"\372\331\220\224*\333\002h\250\032V\036:\257Se\323^\200\217\336Y\247\205\261\326\247\202\317/\220;>\253n\004\017+gb\022\215\233y\023\352_\026\"\020m\236\377\311\037\334\365\270'\020\346,\262\204\200\213\340\312\262Pc\225\311\305\376\342\355\032X\240K\322\233\f\030z.I}\017\212\034\342\267\200\273\273\243"
+	.ascii	"\027\026\033y\232c\004\306\227\022uR\343O\352\243X\205$'\006"
+	.ascii	"\366M\333\276\351\376Qo5Q\363\320\221[\202\023\327I\005h\027"
+	.ascii	"ol\315\036\223\311\"<\262\340\034\034D9aN\264vN\315h+\007[8\337"
+	.ascii	"l-(\005\005M\001\365(\221\331\252\3647Z?\211\370\240\352\232"
+	.ascii	"n\222\2558\267N\253\343\tHm\364\036e\244\017\r\271=Mr\020=\365"
+	.ascii	"\241\272Fi\321/\345\373\202\251\226.\207\320\250H{\203\314.\366"
+	.ascii	"*\253\377;\327$3\354\\}m\t\372k\317\334Q\262\341\343$r\311\356"
+	.ascii	"\312\032\216\216\211\300S\227$m\004\344\270\003U\327\366S\367"
+	.ascii	"\365P\217\362I&\353\"\2557m\222\226\311\t:\223\334\3024\f7\232"
+	.ascii	"\024\2565\374\2045\261?]\332\226\373\277_\035\230\213\240\313"
+	.ascii	"S\214n\017\333\004\221's\242\016\006\376~\224{\253\356\005:\371"
+	.ascii	"`3O~\021z\220\376{\265\301\370\373\360\326\226\223\376\253\313"
+	.ascii	"mgY\332\366\232<\360|\357\237\355\212\223\372\356\013p\357\323"
+	.ascii	"\017\366\303\237\330\261\263`\336\031]Z\374\316w\277\212Y3m#"
+	.ascii	"\317\333:\307\357\360\202?.\357:\037\2775\205\016y3pg\347\b>"
+	.ascii	"\300O\377\324\215\017\2277\325\257\212?\364\025\355\227\370v"
+	.ascii	"@\006\3637\244\300\307\324oM\366{\237\035\234\226\357\352:\354"
+	.ascii	"\303\340&/\220\003\272i\356\013y\316\356\256\365\333~U\375\214"
+	.ascii	"<\037\274\301\235q\207\237\250^\"u\003\357\203\\W\255\007\241"
+	.ascii	"\247\372\250\346E\373I\330\220\007\354+\273R\257\207\324\037"
+	.ascii	"_\233v\350\335\330\245\n"
+	.text
+	.section	.gnu.lto_.symtab.2bfb7f2535410cae,"e",@progbits
+	.string	"blackboxPrintf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354"
+	.string	""
+	.string	""
+	.string	"blackboxPrintfHeaderLine"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361"
+	.string	""
+	.string	""
+	.string	"blackboxWriteUnsignedVB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"blackboxWriteSignedVB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\001"
+	.string	""
+	.string	"blackboxWriteSignedVBArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\001"
+	.string	""
+	.string	"blackboxWriteSigned16VBArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\001"
+	.string	""
+	.string	"blackboxWriteS16"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\001"
+	.string	""
+	.string	"blackboxWriteTag2_3S32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\001"
+	.string	""
+	.string	"blackboxWriteTag2_3SVariable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\001"
+	.string	""
+	.string	"blackboxWriteTag8_4S16"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\001"
+	.string	""
+	.string	"blackboxWriteTag8_8SVB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375"
+	.string	""
+	.string	""
+	.string	"blackboxWriteU32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\001"
+	.string	""
+	.string	"blackboxWriteFloat"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\001"
+	.string	""
+	.string	"blackboxHeaderBudget"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363"
+	.string	""
+	.string	""
+	.string	"blackboxWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\001"
+	.string	""
+	.string	"tfp_format"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\001"
+	.string	""
+	.string	"blackboxWriteString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\001"
+	.string	""
+	.string	"zigzagEncode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"castFloatBytesToInt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2bfb7f2535410cae,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
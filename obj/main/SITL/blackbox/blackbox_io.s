@@ -0,0 +1,969 @@
+	.file	"blackbox_io.c"
+	.section	.gnu.lto_.profile.84d66f873cb7620b,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.84d66f873cb7620b,"e",@progbits
+	.string	"(\265/\375`\r"
+	.string	"\275\006"
+	.string	"D\n\001\001"
+	.string	"\026"
+	.string	"\226\223\225\252\r\002\002"
+	.string	"\002"
+	.string	"\001\352\263\360\321\b\002\376\201\211\336\n\006\001\002\001\003\240\342\234\212\n\004\246\214\355\273\004\004\002\002\003\005\311\231\247\372\017"
+	.string	"\006\360\340\271\300\013\007\373\327\252b\004\002\004\b\274\205\242\255\006"
+	.string	"\t\222\345\311\225\006\002\002\005\002\006\013\317\346\335\222\013\022\002\005\002\007\002\002\002\b\002\t\002\007\005\002\005\002\005\002\005\r\017\214\371\233\377\020\307\276\344\257\003"
+	.string	"\021\330\370\241\354\t"
+	.string	"\022\222\252\354\340\007"
+	.string	"\023\024\266\310\363\237\013\n\n\025\026\327\316\273\360\002\004\027\030\240\342\234\212\n"
+	.string	"\024"
+	.string	"8E\220\n@\023\266\340{\371\340%\224U*\030*\243}\035]\207#\270\021,:\263\260"
+	.ascii	"\227\345\206\2426\204\266\340\224\315\035\210\246\035\005p\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.84d66f873cb7620b,"e",@progbits
+	.string	"(\265/\375 z\375\002"
+	.string	"\264\003n"
+	.string	"\020"
+	.string	""
+	.string	"\003"
+	.string	"\002\002"
+	.string	"\001\004\001\003\005"
+	.string	""
+	.string	"\006\001\001\002\007\001\003"
+	.string	"\001\b"
+	.string	"\001\t\013"
+	.string	"\003"
+	.string	""
+	.string	"\017\020"
+	.string	"\003\021\001\003\022"
+	.string	"\003\023"
+	.string	"\003\024\026"
+	.string	"\003\001\001"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\016"
+	.string	"5Cd\025\247\250 U\305"
+	.ascii	"*\206Va@\240\313\205\2336b\332x1\274\323p\316\236\r`\001"
+	.text
+	.section	.gnu.lto_.inline.84d66f873cb7620b,"e",@progbits
+	.string	"(\265/\375`\336\001\345\b"
+	.string	"r\214-2`O\322\030\030\017\356\334\b\333\250\334\317\213\374C\317\227A\371\354\272\337\366X\\\005\320E\177\035\300\021\025D\f\025\200\316~|\307\336\204\020B\032\331r\247{B\022\035(5\345b\223\301\t\244bt\034^2\322qLl\210\\g\006\004\260\353\363A\3022\035\360\037\247\364cTK\007\b\212AH\304\207\242\340\267+\361\234\214PW\f\273\333\360n\252A\247\240+ N\305\202Z<\200<\340\323q\036\247\266\233\364"
+	.string	"Q\344\002\021\312xc\240~\323\270\352\350\337jO5\232\355\256\225\240\231\306\206\363\326\343l?t+\202\364\007\272\273\253\372M:\225\335\235\376ZM\002+ \240\"\021\243\364P\001p}\355\345\251"
+	.string	"\321\020\234\311#\2229\222\342\br\211\304B\216{\223\r\001m\260\007AW{\365\232\035#\274\236\333\300\305\225\201\2746\375`F3"
+	.ascii	"K\307\230\027#,*\\[\214\013\366\305\370\330W\323@^\340\373\270"
+	.ascii	"\332\203\261U\263\b\307\f\207\006l\004G\317\301\033\326\212\033"
+	.text
+	.section	.gnu.lto_.jmpfuncs.84d66f873cb7620b,"e",@progbits
+	.string	"(\265/\375`\225"
+	.string	"m\005"
+	.string	"bH\031#\2205I\007\377\377\370\016\23233\023:\252\274\030\265\355\377\377\\9\362\362\366\267\266\274\301\376\357\337_\312\024\177WE\212\304#\376\260\364\311\345\225?\001`\313\306fce[.\254')%\307d\034z\344/<\201\211\214\221\214\225\206\301L,\304\236\r\353\016\035\036`-\001\352\005\310\372Z\317\254\207\337_\231\217\034"
+	.string	"\0273\222\333u\343,\204i\020p\242<rO\372P\030+#\267\352\205v\334eM\004\270Fa\bx\270\027\330\032\330[\224P\030\"TX\342\257dv\001\320\214\032\370\030Tm\344\211\bM\271\304\024\240"
+	.ascii	"n"
+	.text
+	.section	.gnu.lto_.pureconst.84d66f873cb7620b,"e",@progbits
+	.string	"(\265/\375 5\251\001"
+	.string	"1"
+	.string	""
+	.string	""
+	.string	"\020"
+	.ascii	"\230\004\002\230\004\004\205\004\005\230\004\006\230\004\007"
+	.ascii	"\271\004\b\200\004\t\230\004\013\231\004\017\230\004\020\200"
+	.ascii	"\004\021\200\004\022\200\004\023\200\004\024\230\004\026\204"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.84d66f873cb7620b,"e",@progbits
+	.string	"(\265/\375 \364\345\003"
+	.string	"r\204\017\032\260'\035\300R\021& \fhI%\f\30311b\346\306nK\255\021\222\244\f\\aZ2I\324\312\356\362\326-\2105\313>\003\217+L\"M\001\260.\215\264\024U]\252\277\347\362\330\004\032"
+	.ascii	"`\310\240&q\247B}\"\006\f7\304\304,u\367\023\202\204\247@\\\020"
+	.ascii	"8\346\r`Xi\253]\230\214\023\203\300\2020<p\344\243\216\325\244"
+	.ascii	"K\t\006\363\304\316\006\260x\003X"
+	.text
+	.section	.gnu.lto_.lto.84d66f873cb7620b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_blackboxOpen.36.84d66f873cb7620b,"e",@progbits
+	.string	"(\265/\375`\227"
+	.string	"\305\n"
+	.string	"\246SKC\020\311*\0358Ps\370q\004\354\234\314\272\364\342\304\0160\001\206\225\0206jRa\343\300\260\\\013\\\3260\276\262\325\240\006\325\344i\233\273\252\243\245n\212\017"
+	.string	" \351\200\224(}Q\326r[\t\331{\247\0247"
+	.string	"8"
+	.string	"6"
+	.string	"4\024\002\022v\267\2431\017_\351\f\375\307\316 \216\252W\227\323*\321@A"
+	.string	"\207\221U9/0\005\036\373T\031Ws.|v\327S\034[\356\355\266/lg\330\236\020\207\335\225\363\234D,\330e\251P\333r3"
+	.string	"\340\260\337\376c\326\370\002> <,\365Y\245` \250A\330%'\276\331\223\371f\362\020\334\267\314\037\270o\016\355\007\233VC\340\274h\022\205\2225G\006+\t(}9\305UzY\004\231\003\326\244y\233\277\b\367\275\017p6I\311\274X\351\234\315\312\026U\331\244j\322\227\375\272\273k\352\262\003\250\317\3338\201\032#\023E\305\210\364\201:\300\215E\035\257\3041\342\205<D\240\217Pg*\201@:\321\007v\035\216\275\023\351\353P\236\367u\032r_\227\272,\306\322\204\256jfVj\207\004\017"
+	.ascii	"8\263\002K\275\231\320\0014p\327[b\330\253h[@\270S8\3402\227"
+	.ascii	"\321]]\006\260e\\\342\251\232\234\242\251="
+	.text
+	.section	.gnu.lto_blackboxWrite.37.84d66f873cb7620b,"e",@progbits
+	.string	"(\265/\375`7"
+	.string	"M\b"
+	.string	"6\220:6P\215\322\001gV\0014\310(-\221t\347\3062P\231\333\342\345\250{,O\032\370\006\273\3610A\345\243\r\211\313Lk.\347\031[\273K\027\321\355\227}B\244L)("
+	.string	"*"
+	.string	"*"
+	.string	"\307\334\331(\217\035{\221\3174\302\332]\250\034\357\236\235\177\220c\276\023\351\t\200\260\273\316\357tq\353m\023\330>\260\255\n(\373\251\377\322tf\372\026Nd\245\004\234\354Z\264Tv\205\251>l?c;\323\336p\272\247(\254\273\032\251\222\335X`\203K\366C(\377Y\240BI\366C\036'|\017\213F\371\357\230?\262\034K\305`\\z\335d\220\230V\274l\331\261\224\272a\377Z\r\036\021(\213\300\254i\266\217\202\304\326Y\3202P\0076|2\006\250q!\250\031\360\346\340\341 \304\266q0\023\275_\253\250\004\223\225\247%_\362\232\032\n"
+	.ascii	"`\2517\023\332\372\201\253e\016\202i\227k\270\005&<\225\032\007"
+	.ascii	"\356\334\242\235O"
+	.text
+	.section	.gnu.lto_blackboxWriteString.38.84d66f873cb7620b,"e",@progbits
+	.string	"(\265/\375`\230\0015\020"
+	.string	"\246\036mG\360\260(\035\362;yO\362`M\346\214\317\204mj\007\351\177\237\340\205o<\277\273\2456?\347\271Q\233\263\331\351\316K\375(j\216\365\201\246\226'\301\023Z\016\0052#\001\301\303`\360H4\330\377%\210\354-eJ\001W"
+	.string	"Y"
+	.string	"V"
+	.ascii	"\016\271\333\334\204\312\336\211\341\fx\230\032\026\231\317\234"
+	.ascii	"\263\363\370\200\3552^\300v\271\037\034Uu\031WU>\251\303\354"
+	.ascii	"\005\256.#G\253\005D\007\330\212\244\037\232\316eW\030\370i\f"
+	.ascii	"\361\362\275\354\361\206C\355\005\276\\9\034\3149\255/0\303\275"
+	.ascii	"\335\366\004\333\f\354\317\b\017\177\320\266\251\245T\307\250"
+	.ascii	"\336U\353q\356\003h\340\342\323C`6gK\315\306\344\221:5\307\371"
+	.ascii	"sT~\212\313,\362s\274\303\255\\8\0250$hsN\0058+\237.\027\020"
+	.ascii	"\354+A\2333<p\351\004\334\245\332\2779\n"
+	.string	"\325\303\013\0170gL\213\027s\206\b\f\302]\006>\213\223\211\243\361W\266\0025`\033\342\234s\306\225\261\r\362mG\013!\346\302%\342\323\232E\252\273k\227\234\350_\366h\355\312\376\354+*\3704\366T\364\257K_eA\032\342\352.\210\315Xn\260\264\2663\030-pW\306\016?%\315\374\320\2741\366\3509w(\024R&\224\021\223\r\345\245,\352.}x$\022,x\"%\245\020\023\221\016\205$\344\244+\235P\335\207\001{)#\247.\345y\247N\024\262\036\343\266\017m\007K\017\017k?\313\r\255\312@\373\225\033!\026\3035\342\323\232\\\031\337\303\211\330\2166eCCA\273-\3146mq\037\310\300\240?\016  `\002\221\222\214\007\240\352y\007\3361=\3549\326@\233a\205\206j|\210U\274\320\203\r\024\200\223\371P\270\006\205\216\336&*9\342\360\304\242\260\206EH8\340\253\036\2044"
+	.ascii	"\023\265\240\303\275Kt\340\243\3531LJ\204\003!b\272\360\023"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlush.39.84d66f873cb7620b,"e",@progbits
+	.string	"(\265/\375 \310-\005"
+	.string	"\202\t#*pm:\240}C\021\340!\210Z\177\321\222*\211\034\227P\2028\373+08\206\276\255}\375\255?`\013Q\252\270\b\321\337[\246\246T\275\026\224j5h\345\260&\344\252\036\223b\222I\025\\#\flNj\305\346\364i+=\202&7\373\333\242\324\330\013\370\177K\317\216\212\207\243\303\347\307\224H\017\005@\035\333;9\263E\373q\276\340\305\002\206\377\247\334l\2661\363\256g\007\\W\331(H\374w\344\272\314Z\256m\203m\204\355+\b"
+	.ascii	"`\25173\340\234\031\002\276\274.\343_\306\005\227n\321\316'"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlushForce.40.84d66f873cb7620b,"e",@progbits
+	.string	"(\265/\375`\212"
+	.string	"M\n"
+	.string	"vSG< \345*\035\340!\341\013`bX\200>w\031,\345\017\314qe\334G\b\325L\033\354\001\255a+\005.\274\b\264\240;\004"
+	.string	"\202\204x\273\343.\375\247\302\2108\306\366\036}\262\245\224)6"
+	.string	"3"
+	.string	"8"
+	.string	"\241\2163\230\312h\256\224]\3678\271DC\225\274\341\265#\252T\022(\313"
+	.string	"\236K\347\021Y\222\241c'\" \266v7\240\356\376\276D\020\375\247\377\037\376+\374:\020W\224F\277e\255\351\332Bt#\266\333j{\377\310Z\226\375*\233c\377\367\362{\336\375n\"r;\231\004\\7\254\007\240s\037\013\355\177\352\367|\241!\365\177\t\\}13\253b8\263\376\350n\204\316LN\265\001\376\262r#a\226\261\032h\226\013P`Z\313\373\217\241''Nw\313\341j\323\233\306\325D\277o\240V_\372\005\037}@\222\004\007(\242\030\205*D\323\202\024*\315\221\3514?\007\007/&L3\003\004M\3233\256\224c\327\232B\270\264\340T\366\032j\316\314\222=\376K>h\305,\331\331\017"
+	.ascii	"`\325{B\300z:\236a\366\322\252\025_@\311\260V\321\"\2410\"\272"
+	.ascii	"\206\263\217x`\b2\356\\K\323oa\226\001"
+	.text
+	.section	.gnu.lto_blackboxDeviceOpen.41.84d66f873cb7620b,"e",@progbits
+	.string	"(\265/\375`\305\005\245&"
+	.string	"\372F\230\017Gp\334Q:\333y.A\303o\331\b\240\262&T\255V\330\001\200\265\304JZ\307\245-\037\007\033\tTk\032\226\310\022>R%@\031\302\377\345\013\"\335\347\237#F\364X\210lsB\252{\326\377lF\332&D\356$\003\351"
+	.string	"\321"
+	.string	"\344"
+	.string	"H\376\226\2035\235\013\215\257QC\\U\221-\204\021}\357j\251\001\245\314\200\376\374\327\2614\335x\003u\032\242a\342\264\341YW\343\203\237<\001\375\211\340\003\356O\363\275\213\2039\375y\346&\346\224)Xhb\365F#<^\244#\005\306\266\256F_s]=o\247Ks8\364vO\263\255\312w:/"
+	.ascii	"\027\031\232V\025\361;/1\272\034\224\216\2501\245V\025\326\323"
+	.ascii	" &\202\334\337\f\201\204=\201\223!\226\305\3354 o\222\351b\353"
+	.ascii	"RjU\t9\352dxe\"X\327\365o\206?\354\315\352\327t@\034\363\301"
+	.ascii	"\243\2122\007\270\331:\223\262\347\201\304\233&\204\25302\036"
+	.ascii	"\025\224\331KJ\331:\362v\212\352\311\266\251k\2232K\251\202f"
+	.ascii	"\005(6,\036\325\223\2657"
+	.string	"\r\353\272\262\025RU\235\001\234\371'3'1\237\035\002\310\341\222\263\213o*T\356\2241O\343\366Z\310JM\200\375\372\024\227Y\305\n{a\257\217\374\231L\241\225=\265\223\035\324\310:\\\327\265A:V\346d\371pR\314WVw\221\373A\367\375s\234\363d\333\230\231\305\301\f\241\353\372t\201\357\345_\210\370I~r\021\f{\341O>\214\373\363\375+\267^VP\210^_@\273d6\006m\027\231o\256M\204\231-\007\245\226\201P\313\005\256\345\374s.\347\036[\346\335x\336]\313\272\324r\212Z\316\241\226q\250e4g\371\206\263|Q\313\347\265l\336,\367\265\374\003\f\314\210X\305\263N\032W\036\313=k\331I\206\311\215\277\226\237\313\233\371|\257\207\341x\027F\"\232\021\273\326u}\027?\313\217\017e\270.\032\377\341\362\317^\347\003\227z\344\310\375\271;&\251\254\001\355\222I9T\342Y"
+	.string	"\247\213\025\332E^*r\3717\356\327\324v\234\3667\356\256\247\204n\201 \031\200\345r\271v\241\373\323\005\232m\0241h\227|k\276\331\343\310P\221\250J\254\252\344\376\3543\3024!\273k{\265\311=\233\257>\271\037\363\333\314j\024u\212\275\360\326\346\372C\255\3626\352\225\003F.\310\271};\206Q\336\272\350\023\022\334q\233\b\363r\254W\275\356\331\327\342\022\037S\2750\360\325|\215\212\305\334\300\341r\270?\317\276m\201)\311\230\375\323M&\325\207=<\315\207\013\3742(@\240\353\272\232\215S\333\242\374\352\346\2379\232\020\374$,b\304\b0\3024\002\366c\336kf\023'\354\205\3356\t\332\252\304\003\325N\310\034C\302R\f\246\241#\037\322\357\350\350Gd"
+	.string	"\206\321\013\244\037\207\234\215\"\027H \212\230\206J\270\2401\324b\267\204\3643bJ\032\301\244\364KJ\231H\302\317\210\205\215_\013\031DC3Z\370\220\214\206\216|DJK>\t\n\370\227T\244\344c\372\375\224|)\360\346\332D8"
+	.string	"\027\231\224\330.D\034>H1\223\257^^O5k"
+	.string	"v\220\327\305\313\270\267\016j\320\303\3161\2114\023\334u\221I\240I\323&!%\307\306\363\231\373\260\343\262\306\f\351\210\341 \034\250\247\230u\255\347\3024\240\326E8\236\035\223H]\232\3142K\205n\256\203| 9\262y\262m\004\302dA\346\272\310\017\236\366\303n\257|d\001Q\2033'\327i\337<R}\200k\270\3165\020X\224\225\340\325!\027m\\?\312I\360hOS\207l\251\305b[xr\246\274\002\332e\326\332\200'\326$f\250Q\034\004\021RH934\"\305\211\306@\002B\0202\274\003\021\30094U\223,k\213jZI\002Y\352Cy\267\273j\321F\236\215\347?\340\273\035\334\021+a\371\177(\225]a\336$\275\021@\220\207QNK\026\240\354\314\344W\377\226"
+	.ascii	"\r^'\340\306\246\277\312\022\034M\344\230*\2124:xA\205yH\247"
+	.ascii	"\346\347vW\223\312l\206Mg\200\216\013\370\240\317\0369L,I\262"
+	.ascii	"\fL\243\331M\204\327\351\377\341\323\301\343\b\241\265*q[\201"
+	.ascii	"\242\022\371\256Bf\234\354\341\203)\312\240Ru\02401\227m\t!m"
+	.ascii	"a\346\253\256\021s\2502g\364\201\326\n\\)\027\016c\323e\250\362"
+	.ascii	"4\315\270\363\322\300\270\336\336&\332\f\345Kh\t\006\2013\212"
+	.ascii	"W7\\\311\265xT^c%\223\263\205\233\244\3620j\021{\037v|U"
+	.text
+	.section	.gnu.lto_blackboxDeviceClose.42.84d66f873cb7620b,"e",@progbits
+	.string	"(\265/\375`\212"
+	.string	"\375\t"
+	.string	"\366QD= \345*\035\300#\245\370\305\217X\221\204\0261\201\231\325\003 \"\300\333\222\002\024\020\306Y\365\377'\033\025x\207\tjI\355\026\bT\002\224\001\304\235\\e\274w\357\f \335\177\262\345N)0"
+	.string	"2"
+	.string	"2"
+	.string	"\343\356z\n;\352S%\312?\313;\241\b~\"\\'\301\215\005\300#\252fC\310hR \256\244\034\210\330]\313P$\271\273\333\206\260\315`\337 \247\315\273\353\003\314u\"\233\245d\316\246\251\244\276\354\317U\227}\351w_i\215\004$`vEr\005\266\326\315\250\330\276\307({\300i\261}L\r\353%\241UANlGv\367s@S\003%\316\001df-\325\227^asMp\021\260\2227\333\246\267tpvW\016\276\3543\017?\345\235AN\362\341;?\036\201>\022\305\307'\262\030\205.D^\006)\204\341\215J&\017\264\340O\243\242\344q|_\311\363\320R\237\253\256\211\222ZJU\255\375\034\3056\332@\211\233\035i\177\033\362\001\020"
+	.ascii	"`\2517\023\272\202\002\263\370*[\221\037\314\262Y\333g\262\250"
+	.ascii	"\242\020\006\376p\217k\242{\b\371e\bq\351b\266\363\026f\031"
+	.text
+	.section	.gnu.lto_blackboxDeviceBeginLog.43.84d66f873cb7620b,"e",@progbits
+	.string	"(\265/\375 \317\335\005"
+	.string	"\004\nl"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\312\347\343\307\367#\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\300\200\200\370\305\207\377\255\001\217\250\300\001\177"
+	.string	"}52"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\307x\361\370\240\363\001\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\203\300"
+	.string	""
+	.string	"\203\003\202 \006\177\001"
+	.string	"\244\003\001\202\300\013/root/repo"
+	.string	"\"./src/main/blackbox_io.c"
+	.string	"\t"
+	.ascii	"`\325\263B\300<\207h\025\274kx^\304`B\344p\347^\355|\002"
+	.text
+	.section	.gnu.lto_blackboxDeviceEndLog.44.84d66f873cb7620b,"e",@progbits
+	.string	"(\265/\375 \363\275\006"
+	.string	"B\314.4Po\322\030\200PQ0\fB\253\230\006\307gjI\306\336Y7l\215\3466,\307\267\331\303E\235`\207\340\231e\324\245\b\366&\002\214g\324 \017\310\337[\246\022\020b\203Y\034M$\370\252 \026\201\0013\023\227E\221y\033\314\252xW\274x\325\301\320B\023\037\007\302\370\250\351Q'Ze\200\201\307}~~\232\373x\005X'\372\246/#\031KFi\027\024\003\263)\323\311\350\357<\365\267\246$Y\240-\031\tew*\2740\240\323?CCg\2513\004\244#\021\216\222lw>\007\242R\233\\\225D\021\\VTJ&!\rm\002\017\273{\353\by\350N\377\204\337\341\337\b\t"
+	.ascii	"`\325\213C\300<\207h\025\274kxx\3040CH\341y\373\325N2"
+	.text
+	.section	.gnu.lto_isBlackboxDeviceFull.45.84d66f873cb7620b,"e",@progbits
+	.string	"(\265/\375 \306U\005"
+	.string	"r\311#-pU\323\001"
+	.string	"\r\364N\365uJ\337\002\327\333\262z\243\260\230\031\321j\371X\221\371u\332uZU\027\216>v\212\007\020$\233\026\355-S\266\246y1(\263\302,\312QI\310E=\244\225I\344t\360\214429\2313\223R\265,\215`\334\354\272\301\270\261W\360\377\216\032\033F\335?"
+	.string	"-\340\347\006\004\036\032|<\333\232-9\241\320L\267v\270\365@\027\317\367W\0319K\027Ro\241\253,$,\376\033b\272\314:\256m\203m\204m,\t"
+	.ascii	"`\251'3 \0306*,V\341\3245\217\bA\302\235\273mq\002"
+	.text
+	.section	.gnu.lto_blackboxGetLogNumber.46.84d66f873cb7620b,"e",@progbits
+	.string	"(\265/\375 \334-\006"
+	.string	"\224\nz"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\212\377\210\203G\001\275\001\001"
+	.string	"\177\002\001\177\001\247\003\005\001\006\023\001\004\005\001\006\025\001 /\300\200\200\370\305\207\212\2618\221\202\205H("
+	.string	"\177\274\001\273\001"
+	.string	"\013"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\337\210\001\221\214\246\f\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\203\003\202 \006(\001\200\300\013/root/repo"
+	.string	"\"./src/main/blackbox_io.c"
+	.string	"\n"
+	.ascii	"`\251'3 \030>*lV\001\271\206\267F\214,D\036\356\212\251\235d"
+	.text
+	.section	.gnu.lto_blackboxReplenishHeaderBudget.47.84d66f873cb7620b,"e",@progbits
+	.string	"(\265/\375`\300\001%\021"
+	.string	"f!uF\360\320&\035\336\177\300\304\273t\030\363ZO/\271\303+\206\354\335u\306\007\356\317[\003\rA\231@U\321\333\r\225\214#sb\320\250b3\330\274\224e\3520\3711x\274\362K\242\364\220I\326\212\250I#{K\231Ra"
+	.string	"U"
+	.string	"d"
+	.string	"\267\271|e\366\035\210jh:vW\344\321$\335c\310\tp\217\360\003\270G\263\354\034\307\241\255\201\232\031L\247hw=5q\326\241&\313\317\357\206k\210G\366r\370\233C\024\037P\316\020\217L\304\025\0020\202\331"
+	.ascii	"\221\271\340\002\016E$L\262W&\311\301\356:c2\231;\336\366\003"
+	.ascii	"\333\r\354\364\002g\241\362k\217\306\320\222\217=\372-\334\343"
+	.ascii	"\225DC\2076\263\261\265\362f\343\270\016Wi\354\303\335]\353\214"
+	.ascii	"m\272\355\376"
+	.string	"\210\351RLw1M\212i.\246c\246!L\253\2463\323\027p\372b@\310\356\341\266\033s\343\261B\321\347\304m\277\375\337\030\304Wq\033V%\334#\247\245\017j\324\303z\034\306c\230L89Q\222\232\026\265\231\315\007\225FM\232A\260\036\0012\325>\241\3621\325\220\227\276\330\337\271\213\r~\315\025R)\3561U\302\007\224\342k\345\255\243m\210\335U\220\002$\364\222G\036\232a+\241J\243?\300]\013\344\340x\245\221m\225\347\254t\273/\006\376\212\250\023\n\013\004\024jE\241\344\323\210*u\242A\225\242rB\261\220\342]H\241\254x\247U\2137\222\300*\026\324\312\313\240R\255<\020\234\326\341\352\214I^\300vR\344\257\325\324`=j\322\017\375\320\325\030!\324R\227K\352\243?\261\035\271\367\017\327iIM\202>\224\244\235\"8\202!r\345\315\234F%\351af.\031\357q\211P\022\036"
+	.ascii	"`\251gThD$\232\306\n\204\340&\301\344\t6\021s\006\270\f,n\232"
+	.ascii	"\274\t3^\323\032\026R\341,k\327\250\263sm\210\355\325\340\244"
+	.ascii	"\221\225\2025%\3051\001\263>yf+\201\262\342WB\004B\021\227Yf"
+	.ascii	"\353\212\004\005\005"
+	.text
+	.section	.gnu.lto_blackboxDeviceReserveBufferSpace.48.84d66f873cb7620b,"e",@progbits
+	.string	"(\265/\375`)\001\005\016"
+	.string	"f\033bE\360\260(\035X\"\212\371ljy\342\231\342\230x\226u3\207\307\211\214\341\"Mt\026\322\342\254\025_\255\375\257"
+	.string	"\346:\252F\317\370\320{\005gf3\263N\034\214^\340\303\302\005\230?\213\0067\033\367\336R\246\024P"
+	.string	"H"
+	.string	"Q"
+	.string	"\flv0\340\354\354\3166\221\203\342\341\373\200x\250 ~:|\232'\037\244C\035\202\376^\001X\206\031\237n\365D`\344\330\340|\351X\251/\301L\f\031"
+	.ascii	"\235\352\201h46.{\272"
+	.string	"t\254\314\217\222\335u\266:\rw\274m\007\266I\354\307\004\257T\326\354\231*\025f\377\355\356Z?\330\217\375\021\246\237\323\372\322\251\351\177\234\274\\/\335]+v]5\036\233\003]\210\260\315b\177lg>\266\362\004\354\212\346\305bw\025x\201\347\320\266?\342$X|j\300J\305\004\020`rP\331\3430\016\264\027OO \246\206\334\324\360\311S\220<\273+\022\037\305qP\374\232C\247p\\<L\275\360\252\351\210e\013\0344\017\2520G\275\206nd\254r\207}\023?\261\342\327\230\202)\337:\364M\361\360z\331\017\334PAc\246D\246\221\212\205\020\264h\204#=\250\300\205PD&\021B\233\004\222I\312&*\231\266\021\003\346&\214J\233\n\307\225\266\317,\365\367\236\206\264\330\350h\376\024/\373eZ:\304\322?EU\027uIJU0@F\265E\243|\353\351S\224\216'\304\302\354.\202\024"
+	.ascii	"`\325\333B@\030V\303F\256\"@\246Y\201\253^|\001n\203\025\032"
+	.ascii	"\204\302I\234\0208\210<\215 Y$\023\366\272f\223L\220\304\317"
+	.ascii	"\214-M\217*\2503"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlushForce.part.0.66.84d66f873cb7620b,"e",@progbits
+	.string	"(\265/\375`\374"
+	.string	"\345\013"
+	.string	"\346\225N>\020Q\225\016\274\200\303\302\222\017\003+$\017=\360 \002Q\332h\2061\240\374C\027\353n'\367?\207\322\211\207\"\362-\223\t\220G"
+	.string	"\200-@1:\233\313\210\263]\220\212\306\266\211\224)\005;"
+	.string	"B"
+	.string	":"
+	.string	"%L\251t(\333\246TB\026\035d\235\276j]X\021\356\202\333\243\202\270\350\232\231\310OSjt\375w\211\007#\305p\2456<#\3176,\273\353\007\207;\336v\002\333\n\354k\0020"
+	.string	"\036vO1\032\373!\276Z):\177,$\f\0262W\210\320D\270%\020\001x\024 \177\006\200,\r\013F\300x\031\274"
+	.string	"\307\343\343\001\034\277A?a}\271\bwW\273\377u\266f\207l\355\361\001Z\240\244#\373,\336\202\202/\302\022<y\323\243\357\321\350\301Ht\3602\246\302v'\343\301Z\324\356\036x\374w\210k\306\213Q\326H]Y\263g\253*\333iu:c\372\016In0!\340\314\204\3330\250\300a\034d.\0170\033\204\315\205\263e:\236mb\300\\\004Mg\233\300q\235M{\266\252\362\277G2U5\203mU[<%\251\256lC\362js\270\274)\003\031"
+	.ascii	"F1\003V\275\234\305\230\267\241\321\016*?\0139\207\3605\315\360"
+	.ascii	"\bm\3462@\024\fs\205\233h\"\377\f\221\347\226\005\233\372\320"
+	.ascii	"\223\216\267\016\347\252\232x\251\323\276\244\246\250y\377\265"
+	.ascii	"e\f"
+	.text
+	.section	.gnu.lto_blackboxDeviceClose.part.0.69.84d66f873cb7620b,"e",@progbits
+	.string	"(\265/\375`\236\001\335\016"
+	.string	"\366\031_E\360\222(\035\220c\216>\2105\354,\232|\212\222\001\021\217S\250[\345,j\002H\372b\301\216%\031\206=\252\2474TLk\254@\362\267o\317ei\351\034\233\001\207\242\36412\022\341\277\215\301\346\311\336R\246\024G"
+	.string	"L"
+	.string	"L"
+	.string	"Ga\373\364\301(\233\307=\231}\214\033+.\276\335\325\0365\346\250C\315\210\362\337z"
+	.string	"\216\225:L\216\305r\205\fT>\021 \254\025\034\220\263b\363\326\263\003K\225i\340\021\300\310\356\272\323rg\267\355\300\366\003\373\260\253/vL'L\277#\302\021p\331\365\020\363\261]t\225Xq\362\311\210\212\203\n\234A\363\245\370v\345\211xW\201\342\023\004\236\f\b\b&p\270\276]O{\264\367\220\354\261\363\003\331\343\355\033\3453V\0330\317\375\326\311\366x\036\003\253\314\261Os\032\243\t$R\366\230\332 f\207K\353&\231\214hs\363\301\004\344\325.\331\362\234\025\2544e\377\305a\230\370$\234\301\224\347\036}\223*\313\315\211\020)\031ka\373\364\351|\036CFt8=R\371#\025\306\032\017\003\246"
+	.ascii	"J`\021h#I\330\260\221T\020\205,\220h\027H\241\022MT2i\240\005"
+	.ascii	"\3360\214J\232\206m+i\036\270\372\342\b-\257\024U\271\272n?\217"
+	.ascii	"Y\023{\301\002i\207Dy\316 58/\225\246\254w\216\0323\235*\214"
+	.ascii	"\363\243,\265\304BG' `\202Af\347\001\346\314\200\327\263\377"
+	.ascii	"\341\376l\230\262\262up,\354)\305\215\002q\342\240`\004\\\221"
+	.ascii	"=\365\031\007\327\315\272\326\366r\262\323nZ\264\3218\3516\003"
+	.ascii	"j\314\310\343\021.\306Q\307xC\344\336\362B\227@K\226\212S\003"
+	.ascii	"\264\246\354\032\bjo.\016\315\307\275+\214\001"
+	.text
+	.section	.gnu.lto_blackboxDeviceReserveBufferSpace.part.0.74.84d66f873cb7620b,"e",@progbits
+	.string	"(\265/\375`\354\001}\021"
+	.string	"\366\340sG\300\226M:4\364/I\260n\005\003\240\024\221 \350\324X\"\265\227AF\264\003l\363\336>\260\322\336*\007\241=\365I1Vs\276Vs\275\3357i\232\330FQ\254n\337\t\233T\366\271\201\n\314\2214\262\267\224)\005a"
+	.string	"`"
+	.string	"Y"
+	.string	"2\370\331\274\037\333>\214\033\321XV\001\307f\004\005\242\233N\322m\367S=\252\274"
+	.ascii	"\367"
+	.string	"\bO\200{\324\026\227=BMN\346\347\216W\363\210!h\351\306\210\r\257\304!\204\320\323\243\006@\t\013\037)o\226\032\300\303\201*\273\373\243'\217w\2239\340\034\212ew\335\231\270Q\267\275\262}\301N\005\001\250tr\351\243`\021S\n\212]\237\247&\233\"\362p\261\024s\f\\\332g\003Jq\362\371\214n;\373\030$]I\3061\007>\033\220\205\027C\202\370\353n\3372G\362\004\332\323mwS\367\217bv\312\246\261S\326\374\027\373\326\373\261\346g\314@\001;[A\323\261\273\016\036\375\240{\264\037#\346\372\334\335\032\325\232\355\026\227\372B:2K&\266Y\317\321\352v7\202\217#\204\006\177\b\306=\246\242\310\370\2153\301\374!\273\274\344w\036\375\027}\005)-\241\331\344S\r\333\261$\235m\177vw\301\343\217~[\021OHM:I\255Y\271\303U!\033%\035\377\375\260Kk\336\260\202"
+	.ascii	"\326\202\231YE\263V\\.\031@\270V/\254\026\016+\225\007\227\226"
+	.ascii	"\016*\326\013\246ZI`\327\207\326K\005\343r\275T)\333y\270*d\003"
+	.ascii	"9DI`^\306\245~\307I\344\024\211\310_\306E\345\261\035\325,6z"
+	.ascii	"c\215\rz\234~\320XUa\275\204\246\023H\240\326\240\252&\021$ "
+	.ascii	"\251\252\\\223\316\223' `\002!\347\350\034\354\354\237\252\336"
+	.ascii	"3\305B\2740\322\214\360s\301\216\3137&\267_+\353\304\213/\225"
+	.ascii	"\300dH?\341K\230\261\b\206\334F\242\036f\034.\030\n\035\016\321"
+	.ascii	"\277\020\363\2462p\210\2601]\336\266g\213\354\222u\215l\3358"
+	.ascii	"%\022/lG\003k\256VMv\003O\300x"
+	.text
+	.section	.gnu.lto_.symbol_nodes.84d66f873cb7620b,"e",@progbits
+	.string	"(\265/\375`{\002\255\n"
+	.string	"\242\317:8@\255\322\001\017\016sd\200y\322w]&E\317\034\006\324\272}\260 \031\031\353Q\325\303\034E\021w\326\262h\333\266m\333\266\255\244\021B\240\360\376\355(Q~\266\225R\312\272\261\335\t\210\217\331\204\240W\342\033`\201\246pZo\306\252L\366\252\350\264\336\321\323zE\rh\327\266l\346"
+	.ascii	"\333(\033@\273\226a \017\036\030\331\240\264po\310\252H\007F"
+	.ascii	"\304\205\333\245\335\372B\370\025\353\254\325[\252\243R7\241"
+	.ascii	"~:]\301\364\204\235s\252r%\245\253\226\244\311QE\212^\332\261"
+	.ascii	"!\344I\320I\237\217<\027u\036b\316A\274\371G\203 \301Nf\302\357"
+	.ascii	"\036\366R\262{\207;'\244 \031\331\2769\270\206\305y\2019\310"
+	.ascii	"\227\353\206%S\271jp\253\3568\r>\251\252\335\024\305\321B\365"
+	.ascii	"\252\034\257\235\3149g\3015\306\252\332\f\001. \340\002\021\262"
+	.ascii	"\332\006\f\374,D\310\313\032\032\300H\302 z(\371\302L\252\257"
+	.ascii	"Y[\273@\027t@\007\350\202\016\350\016:O\310v\273\024i\013\306"
+	.ascii	"\312\217\016G\034\\\220\213\301\302h\367s\376\334\346\313\312"
+	.ascii	"4\211\016\351b\240\317x\200\005?I\322\032\nz\354\217d\002($\314"
+	.ascii	"\342\207o\213\004\036\204\"f\330\247\366e"
+	.text
+	.section	.gnu.lto_.refs.84d66f873cb7620b,"e",@progbits
+	.string	"(\265/\375 u\215\002"
+	.string	"\"\205\016\025\240\247\031\003\377\377\377cs_\276\240\245o\362\333\366&IR\nZ\246\237\205!\272\265\323\342H(i\rg\017\351\340lzM\240\246\016\0307\001\206 [J\311\217r\254\253\207\b"
+	.string	"F\b"
+	.ascii	"\002{T\f\020\013\216\2454\021SP\202\222\004"
+	.text
+	.section	.gnu.lto_.decls.84d66f873cb7620b,"e",@progbits
+	.string	"(\265/\375`\230#\275\230"
+	.ascii	"\032\354\2644P0PR\352r]\225-L0\355\212\203yo\3473\331\f2L72\202"
+	.ascii	"\246W^Y\001\031\351f\324 `\236\276%\001T\252\371\0327\232\032"
+	.ascii	"\350/#\004\003\250\364u\037\034\321\364F\207jz\3309e\250\001"
+	.ascii	"\224\246\013\322;\343\215\026\202\266L)\005\322\002'\003]\003"
+	.ascii	"\201\237|\345'\371\237\213\3613\277\3642\237\335\214\207q2>\306"
+	.ascii	"\245\016\350z\355{\216\245\177\336\234\2279\347\022\016\350U"
+	.ascii	"\257\363\352\324\006H\376J\330y\336\001IL\025S\\(p\342Sl\326"
+	.ascii	"d\321\316f\220\001:\024\217\202\201R\323\246\351\216\251/\347"
+	.ascii	"\267\204\003\372\234[9\200)\347\254\256\004\266\304\324 \362"
+	.ascii	"\227\363\013\301\017\004\301$\2653\"\t\254\376\205'\210\023\331"
+	.ascii	"\330\257\375N\326\213\237\233\223d\227wi\367k.99\037\200\351"
+	.ascii	"|\b\211\376\332`\274\257\273"
+	.string	"m\3262!S<~u-\316\347\322\007|K;\027\337\241i\224o~\377\313L\332\331\257=\376!\370\317d\333\037\b\342\300@\177 \330n\206]\337\251\367\345]\tN\315\370\262\274k\020\2755 \277J\035\317\357\336\374\023Tr\327\025g\205m\177cu\316\0349\003\b\205\316\253\360\210y\372\222\267\204.\211\307\345\f\211\202\002\003\342p\275.y\352`\245\024\335\332\257\355=\330v,\266\335\311\266/\331\236\033\330n\217\322\355cN\346l\230\351\364\314\323\234_\037\032(\220%[~u5_s)\002N\355\t,h\234\\\222\311r\256\362\344\234\031\273\333\361k#\331v\004\202\036\350\b\004[\006\026D\fl\257`;\005\353g\036u)\220\243\265\277n\3266\3137Gs~yl\362\274\344\230\376\332'\330\002\262\262\005\315\303\266\003\005y\034(\330\317\202\360\017\301\325\003\b\222\250\372\207`\277\257\177\b\262\036"
+	.ascii	"\026f\300\323\375i:\256\370\330\027\272_H\267Ki\361,\335\276"
+	.ascii	"\247\325\355-\354\\8\354\356\236\356G\253\233V\373C7\376\200"
+	.ascii	"y\260\r\356\3064\337\375f\272\275\005+}\323\375aU\350\274\310"
+	.ascii	"\\\267\223\350v\007\272\035F\267\323 \327\355\"\224\300u{\364"
+	.ascii	"\215E\003\335\375@\267\263T\272;\256\333\333Ht?\226nGA\255\333"
+	.ascii	"\013\200\202\323\375;\332\273\277\256\333q\032\206\356>\240u"
+	.ascii	"\272\237\256\333ux\322\355,\232\205[\267k9\351\366\256&m\323"
+	.ascii	"\375P\272=\255\333\231t{Y\267\213u;X\267{u\373V\267\353\350\366"
+	.ascii	"\034\335\216\243\333\233\335N\243\333\205\272\335\251\333gt\373"
+	.ascii	"R\267/\273]\331\3559t\273\013\335\216C\267\333\320\3551\272\335"
+	.ascii	"\355\366c\267\257\350v\244n/v\273\f\335\356\242\333\207\272\035"
+	.ascii	"\206n\177\241\333Yt{\n\335NA\267\223\320\335h\335N\323\355#t"
+	.ascii	";\b\335]\245\273\277t;\212n\337\240\3333\350\356jw\007u\373\005"
+	.ascii	"\335n\242\333+\350v\003\272]\247\333s\272=\330\3557\335n\323"
+	.ascii	"\3555\335}\242\273\345\272\333'000\260{-\352\016zu\023@CjO\r"
+	.ascii	"\346\354\357\023\252\231\247\232@\375O\036J\377Z\377\332S\331"
+	.ascii	"d\316\036\334\372\374\246\374\345\251)\240\340\324\315\314\254"
+	.ascii	"\301\364S_j\023&D\313\211\f\3334ql\267\007\263\262\231s\216\242"
+	.ascii	"ys3)'\3504\356@\335:\216\235\201\356^s6\200\305\233\223sx_X!"
+	.ascii	"kJ+\020\271i\2529/\263\222\035d9\227Y8\230\321\254\234\\\202"
+	.ascii	"%}\2329+\311\214\346\354\223\227\313\344\007\317\354\303\214"
+	.ascii	"fg\226a\347\364\374f%\363\362\231}\3622+A0\227YNfT\351\364aF"
+	.ascii	"\263\2349\232\225{\362R\331dZ\346\246O\216fu\311\321\247\263"
+	.ascii	"\207\031}:\231\321\254*\037\303\344b\303I\005O\013\314\331\230"
+	.ascii	"\313L\343\351J\331\354\2512\337g\336\313\331\247J\271\311@\316"
+	.ascii	"W\317\346\236\022\207S\223\2524\222\236(\237N\300S\222\3263/"
+	.ascii	"\253\314!\317\234\207$\025\345\247\n\222o5{y5\271u\225\235\224"
+	.ascii	"r.\340)\347\244\347j\3169\231s\256i^\2759W\3650\241OO9O\375<"
+	.ascii	"\345\253$\233R\316?\315Bu2\243Z\317\022l\322(4/\275I\207\346"
+	.ascii	"\275\254&\033M\232e'/,\324Y\303\357\327&\036\246V\306\271\305"
+	.ascii	"\364\323 \236\027[\226_\233F\212}\351?\223G\353\227~4g\371\276"
+	.ascii	"t\315Y\351\276\300\216\373\0024n:(\317\232gK\306l\360\370a\303"
+	.ascii	"\006H\344\306\257_\366o\277\331+\311oV\3013g\345\233\361\224"
+	.ascii	"\311Y\311\343\276\200\373\002+\022- M\202k\3234=\331N\230&0T"
+	.ascii	"\302\260c\355\366G2\217{QIzq1\302\265\2729\267t\021\353/\362"
+	.ascii	"jG\214\024\351\376gs\200\340\025\352\222\216\310\017\251\362"
+	.ascii	"\313a\366\253\220 \\\263O\357\327^\345X\350\003y\035\376\307"
+	.ascii	"\207=\230K?\310{\365\373p%\275~\020\257~\217\265\244*}\237\343"
+	.ascii	"+\013\024K\207\327\341\027Z\203\246\205%\310wy\037~\251\354\322"
+	.ascii	"\031]\337?w\364\344\244\273\275 \237\245A_\236\224\221\234\337"
+	.ascii	"\037\236<1S\270\235\265\327/6g\235b{mz\036\036E\363\302_\330"
+	.ascii	"\327\372-\227>W\326\301\341\242N\225\277\306\250i\267`c;\266"
+	.ascii	"1\225\355)>\3026\365\255\377\212\n\347\312\025\350\333\016Qk"
+	.ascii	"O\3655\274\317\253]\035\220\251M=\216\267\372*\227>\325\333\350"
+	.ascii	"\277\361R\375fP^\267\203s\306\202\373\346S\275\323\353v\222o"
+	.ascii	"\206:\361V\345\027\264\233\321\206\344f%\341\037\202A\314d\033"
+	.ascii	"g\266\177\f\333\257\205\375\371*\333\3754\020\340y\245\236\266"
+	.ascii	"\236\234\360\214$_\326~}\311r\240\240\276\236M@c\362\222\214"
+	.ascii	"\314x\246\2638$\312_\237\211\371K:R\302\2744\177\251_\351fl\n"
+	.ascii	"\230\230__\306\017\276\301$\252&\205ms\363\351\216M\316Y\201"
+	.ascii	"fM\232\310\322\234\240J\226\370tg\331\223\227ZOP3*e\222dq0Pg"
+	.ascii	"PR\230o.7\205L\333\024\237zu\372\001\331\2319pfm\206\231"
+	.string	"\220\360\274\344\204\213\252O\307\307\r\260\245%\215\231\340\250\230&\266\274\350\331:\367\244\351\n\327\031\270\035\242G\216\340\262\2407O\312\b\007bxL\2244.\3734\026\255\353\210\336\257\030\tN\"\244\217k\r'\301d\3258\251,!\004L\343\234c\357e\300\026&\024 P(\026s\243\342`y\316%\2134\026\363\037zvT~\305D\276\307\322\021\261\247_\361\220O\222\245\f\312\217_\261\020\007\243\\.\321\375\212\203\370\224\f+\n\334\2578\314\2558 5\217I\016K\275\256(y~}a0?\333\241\306\334\337*\246.\214\252Cc0\366\312_\031\246_\361\017l\365_m8\204\344\330\340\301\003{\375<\223]68R]\351\236l3\272\032{a\253\265-)\212\335\257\270\207\367\341\351\221u}\022(uR(\201;v\340-\357y\223\356\252\240;I\276\246-\255\306[+\026\031L5\262n\362\262"
+	.ascii	"V\263j\324\310 \023\027\265\242C\307\277Q\340Tb\303H\031\340"
+	.ascii	"\035\326\027\025\025\316\361C\205\232'\205\331|\004\222\271j"
+	.ascii	"\234\343\206\207U\222\314\312\246\032&\314\324\252\n\277\321"
+	.ascii	"\220\373Z\253\234\264\341X\261Q\035\205q\370\222\f\345Z\2015"
+	.ascii	"\346\200p\366\324\230tI5\306\241C\225\362\241\206o\274\311\314"
+	.ascii	"\345\006\266a\343\307\247e\3712v"
+	.ascii	"\222\254\240=p\r\327\313\301\342\252\322\013l\342fV:\201\334"
+	.ascii	"v\024)\343\243CUL\215\006\246\361\322\265lG\363-D\tj\223"
+	.string	"\211\204\355\306N\330\351\221\254\3137;\203=\252S!h\270\254@I\341bb\3023\036Z\363\026\206\325\227\263\203\0318 3t\354\242\260\344_\373fII\t/uO\306\n:\237~S\376\262\314,\261\362k/\001M\261;\223\304o\271|* \025Gj\347\304A\2073\316X\351`\240~S\214\360Puy\201\303\311\306\312\177\"E\207\2304gF\224\024\254\351\2313O\375`\245O\201\352\322\231\2602e|\332\301\364\251\214j\240,\314G\337_\316o!p\224lY\222\375\3326Jd\244O\306\353\374\315P7KP\366.L\230\377\353`\372\314Q\033\204Q\363\244\376r\276\n\261N\253\226\304\274\030\227\276gm\277\276Q\017Sb4\340\276|y*\035T\203\254(\257\324\257]\372~\357dU.\311\311\343\334T\b\236\273&%[\320\276\276\177\373a\313W@\376\346\005\004\353\212\345\343{.l&\322"
+	.ascii	"V\227\035[\372\271\270\271\230!_|\374\031\217\030`\023\313d\367"
+	.ascii	"\366>\013\233s\236\001\2451\033\243\363\202\305\245\237e,\312"
+	.ascii	"\213\303\353h\264\302\360\255\221a\363"
+	.string	"\362\376\215\315\276\366\344\241\366&\331\302\322=\036\335\3379P\245\253\374]{S\231sR\316XeA\035\231/i*\310[\351\277{\273\325K\006\017\271_\253_W\343\004\226\226\327\252\217$\210e\310\216\245_\273\006\214\355\032%9\351\313}\332\372f'NZ\323\217\235\362pS\376\215\n\225\177#\300\352\246\353\253k\371Fc7\004\254\311\257\035\254\302v\360\214\355\217\342\337&\375\266_\372ys\024NZn\276!:X\204m\377\245\240\332\263\005DD\027Ec\212\235Vx\323E\"\220E\356\360hD\321xtd\024*\240H\034\036]d\321(d\323\266\307\020b\260\360i\213\304\243c\353\266C\036\212-\222q\007g\250\035*\022]x\030r\241\0029l\215Z\025\024\020\"!\217\220\255;\0242\032\031y\200\204<\022 H\210\247\006\027\351\b\004\227x\204,\016\217,\202\220D\003\272HD\t,T\004\215"
+	.string	"1\203\320\321\230\202g\250u\2070\210\256\220\007\310a\013G\3420"
+	.string	"\267%\032zQ\204$\026[#\244V\205c\333\342\350\305\tD\306\022\334V\004#\243\027!\240@\022\207\212 x 2\226P$\022\265(\206\210H#\334\"\"\242\221\213\237\366\310X\302\020q\205\333\022\035\207\256\317\360\330\272*\216\355\nd\353\326\200\342\330\306\030\232\300"
+	.string	"\322\006\200\243\326E\326\020\364\301\rr\211\307\026t\212-\022\n\255\020\371\302\035\272A\b\200\030\"\005\2650\216-\262U\341\201\025\001 \215F)\n\310i\006~H\210p\217C$\021\255\320\321\030B\021\362\205Q\b\037(\320B\304c[l\211\330\256\300\204\004&0\210Q\323\030\234 q\202D\26018Q\242\304\t\023%\3306Q\002\273\255\220\250H<\016\213\202\214\214F\024B\232\343\260Hhm\205!x\250q\0010\022\007\250\341\350\266G\255Q\353\016"
+	.string	"\300\f\310\241\tB\305\027.rZ\241\n\001\220\220GH$\"\237\030\355PQE\353\016\217B\001\272H\204\002H!\021\321E\321\230\242\347\310Xl\207\204H5\255\020\021F;\024t\221\255+<\032]\343\221\260h\324\021\022\032\n\207\216F\241\366x\343v\221\210\021\310c\013\203x\034:\240\215H\355q\204k4\036G\340\034\335\025-\fb+\324\252\360\343\nM\224\230Ah\330\302\310h\230\"\306\361\006)\314a\301=\032W\030\r\211\307\026\331\323\032\265\030\262\200\021<\266D\027D\267\330\016\021oZa;d4\341\246\0352\036\255\255\020\005\367hD\322A\026\215D\027\311X\323\272C\025\206^\f[\260\255\r\304 \326\025bP\343\262\307\234\241a;\202+\234\200\002\267H|\301v\006\031\244"
+	.ascii	"\261\302\t\"\260B\"\214Da\fc\213\031\204\206F-F\024\211\303\243"
+	.ascii	"\021BG\344\b\021\013\030\021\207,\216\255\013\027/P\304ps\266"
+	.ascii	"\340\0347\\\\\346\240|\030\307\0307\033c\260\026\234\245\213"
+	.ascii	"\221#\200\3572F\232_\337\257\030\017\343\341=\033\251\271*?\274"
+	.ascii	"\247\027%G\006\323\303y+\364d\3745\271\221\021\bx\205\257\274"
+	.ascii	"\215\2501>\253\273\2731N2\330\016\311\003\241\001\004\f\256\303"
+	.ascii	"iSf\300\350\252ok\032U\227\226\025\237\246q\2516U\361\272\277"
+	.ascii	"\243sJ\242\303b\r\304\341)\315\375\345`y\311\310\223\3734#m\315"
+	.ascii	"(q\270\214\365:C\022\205c\202\366WF\365+\246\202\263\345\213"
+	.ascii	"M\247\211\247P\273\233\212\333\274\331\314y*'\375\"(\253\323"
+	.ascii	"\213\373\313S6\200\272\261\224\306m4J|_\242\260\200iex\277b\266"
+	.ascii	"v\253\221\253\242\245\243\335\326\033lctZ\326\250(\374\234\270"
+	.ascii	"\324\234\324\240Q\335\001\005l\007\f\226\030\217_\237l\231\200"
+	.ascii	"E\365\342\304\353.\307\036\325\257hh8-x6&H\247\305\344d\3328"
+	.ascii	"\315\2479\\w?\264\002\203\r\2502\361@\311\342\2302C3\"2\222$"
+	.ascii	"Ic\262\n\020\006\243Y\032\351\245\007\022\200\0249\022;\310d"
+	.ascii	"f$I\222L\333\001y"
+	.string	"\tC\207*\307\026\006\336\020\262\247\203\352\016\343\210\034\016\0267\216\254\201V\241n\026q\266\376'\204g\375\270\242\036\226 {\344G&^\344\242\342\307\226b5y\214]\277\244\374\315\247av\225d\366\273\331,Q\316 I\021^\327\336\220\226\315\262\203\203f\347UHQ\335\264\003\240\344\356\333\362\276*BdL{\n\255#%\003C\200\205\276\207\304\017[\026\314\375\326\264\337\353\212\220pk}T\305I2\225d\260.v\352\247\225\211+\353\312\230\270y@H\225\215:o\2603\311\034\320n\366\330\234t\331_\303?\027\005\b\332A\265\372\240;\345\236\226\3604|\331\210\354\363\206\341\007\217S\337\214\313\030\266d\203\244A\311\364\0020-%pr\243\022bODiM4\323\220.\021l`\255O\250\323'\332(\372o$M\036Nhy\220\t\312\267U\2422\343\002L\345\362\242\343R:R74\250\345'"
+	.string	"\"\037%!(\220pX\200=\200\320\272D\214S\342\323\3500n~\362/7&\324\342\252\216\351\261\230h\213\252\375D\207(\244k\251\325s\317\021\373\241\177\312\344\233\013\277e\341[\237\314\212\256,\260\264\340\245\322\342V_\006\262\317\326\330\334\200|\374p\256qs\3215\255\177\346`\343\234l\313\373/?\n\364\271\252o(\310h*0Yk\233\316r\264\003\034\307>\017\245S\332\r\025"
+	.ascii	"\245@(\334\243\001#L\206\313\260s\317S\352\255\\\022\336\363"
+	.ascii	"NWj\222\177\265\340\306\340\323\317\331\365?\377\200\250A\352"
+	.ascii	"\332\213+\351\204vs\032Y#\002:u\001\211\320\222s]\230\223\f}"
+	.ascii	">\203\256\362\207k\201\247\336\360\217\275\334\345\313h\300\252"
+	.ascii	"Y\253\"\256EhH\203\306>1A\343\365\375/l\255\245\306\271\257I"
+	.ascii	"\320\320\224\017\243\240X\200L\201\257\202\203L\322\217\271\321"
+	.ascii	"\367\bt\272\030\030\223c\273\363M\346\177\205\361\366\255\262"
+	.ascii	"\237\201\333]>\216\274\326E!\246|\367\317\0361e\333\t\346\257"
+	.ascii	":\216\235N\177\341\215\245bS\243F\347\216`\210\026t\350t\204"
+	.ascii	"&^:\334=\320?"
+	.ascii	"\003\232\265\\\344<s\255\302\360\023\312\n\031 \\:\367_:\210"
+	.ascii	"w*\342cFa\203#\301:"
+	.string	"o\026\034\225W\371\354Glc#\177O\345:\316-\252\355>}C\367\247\235\006\344\346b\240\254\360J7\362\375\353\347\0333>\336Q\264q\017\266\233\016\263\253\026\264\3023\270\037\213\341\251\256+\345P{\253\362t:\254q(\311\314yw\304\317\211\320|4\374\255a\027\201m8l\304\372\335\200\245\231\244\370H\346\200\272u\335s\222\371\332\264H\365\376\250\330&P7}\377\027\235\031\346\310D\317\271\370z6\322%W\243d\215\357G$M\306\016~\267\r\004\311.\301R0\0072\247\345\213= \203m\342\004\331\370\022SAs#d\275U\216\376\207\n\303\236\344\277;,+\371\236\322U\365\326\200\030 \245\352\230\270\207\3025\021\260BE\360\276\307\007\372\376\025\257I\021q\030E\315U\025\r\002z\330\026N\233@\273\357\207\222,R\t\270SK\330j>k0o\211\231\272$\n;\251\226\032\003\362wj"
+	.string	"\232[\271\310\b(\td9\217\262{\216\320\226\300\002%|\331,Q2\224\223\003p\216\224\210*\263\272}G\373\345\334{"
+	.ascii	"\267\006.\032`Fh\237\343R\266\313r\265\247\252i.\300\257\207"
+	.ascii	"\237\317\306\007\007\207\327\347\034H\335#7,.t\264\250X\344\260"
+	.ascii	"\t4K\235h\235\006f\320r\352\361V\372\266Ue\331(j^\224Ekj\t6\272"
+	.ascii	"JF\t\001\254\276\212V\257K\325\217UQ\212\240\230WE\365\314^\315"
+	.ascii	"r\214\243\367\266\013P\315 \227N\361\345T\361+\022\274a\374,"
+	.ascii	"\365\006+\274\222[%\207\366AU\222fE\023e\214\2170\247{(\316\247"
+	.ascii	"\231\301\367\262\032\265Qx_\260\320\345\272\301\374Q\307\b\322"
+	.ascii	"\336\007IBZY\t9\303(\007\3046~\271\027\243\271\305\262%\3417"
+	.ascii	"\232\2747\320n|\263l'\302\351}s\027\324\253\203\005\237.\007"
+	.ascii	"~\375w\n$\247\r!\031\t\355N\372=@\352\307\334C\232\300\334\350"
+	.ascii	"\016\f\2716\371\0307\230b-\341\305\026\322\321\317{@\201\303"
+	.ascii	"_|\022\321\020\006\340\225\300\350\2071\002\311\257,\243\022"
+	.ascii	"\017\373\256\336\242\372j\217\333O9\303\353\205w\bJ\260\024."
+	.ascii	"\004zg\265\357\232\f\261e\034\022\026\351s\300\005\263 _\nK\303"
+	.ascii	"*B\237"
+	.string	"z\350\227j\257\224\364f\237$\262c\037\340t\323l\351\273\213l\2236.F\352\210\013s!Y\2337\205;\374l\202mx\332c\277=\334\216\231,\255<\247\017G\222\"\034/%\373\251\204\303\340\325\236\017\020\373\233\177\006\017\327\331\357n,\377\330\263\335\177\013}\223\361P\275'\342\022\216\276C\036|W\036\331x\272H\023FO2A\027\313\354\311\177\375\217*\271*\361\tj\302\316O\347)\232\206HsD\261\3020n|\017N\223\312\224\367%7\275\031\206\270\303\211\235U3\212gz'\016\344\276`Ir\332\377\367^\302\f\342\272\3509k\007KGt\337A\206\267\223\027\375\333\364s\207\303@W\300\220f\202\320\313b\333Dq\217\177\b\362\357\307P\376\356\277-\350\3313e\361Q\3779\027*=\261h\301Bq+0\257C\240\213\3244E\361\324~\371\360\221\272OZ\371y\367\f\323\3178/|\255"
+	.ascii	"(\f\270\226V"
+	.text
+	.section	.gnu.lto_.symtab.84d66f873cb7620b,"e",@progbits
+	.string	"blackboxOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\001"
+	.string	""
+	.string	"blackboxWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"blackboxWriteString"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\001"
+	.string	""
+	.string	"blackboxDeviceFlush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\001"
+	.string	""
+	.string	"blackboxDeviceFlushForce"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"blackboxDeviceOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\001"
+	.string	""
+	.string	"blackboxDeviceClose"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\001"
+	.string	""
+	.string	"blackboxDeviceBeginLog"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\001"
+	.string	""
+	.string	"blackboxDeviceEndLog"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\001"
+	.string	""
+	.string	"isBlackboxDeviceFull"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"blackboxGetLogNumber"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"blackboxReplenishHeaderBudget"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"blackboxHeaderBudget"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\001"
+	.string	""
+	.string	"blackboxDeviceReserveBufferSpace"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\001"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\001"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\001"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\001"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\001"
+	.string	""
+	.string	"mspSerialAllocatePorts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\001"
+	.string	""
+	.string	"mspSerialReleasePortIfAllocated"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\001"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\001"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"determinePortSharing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.84d66f873cb7620b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,211 @@
+	.file	"debug.c"
+	.section	.gnu.lto_.profile.2eae044dff2b06c3,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2eae044dff2b06c3,"e",@progbits
+	.string	"(\265/\375 &\375"
+	.string	""
+	.string	"\270\032"
+	.string	"\004"
+	.string	"\273\211\254\252\r\001\240\342\234\212\n\002\003\240\342\234\212\n"
+	.string	"\002"
+	.string	")Bm"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.2eae044dff2b06c3,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.2eae044dff2b06c3,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2eae044dff2b06c3,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.2eae044dff2b06c3,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.2eae044dff2b06c3,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.2eae044dff2b06c3,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_debugModeNames.3.2eae044dff2b06c3,"e",@progbits
+	.string	"(\265/\375`\006\003m\025"
+	.string	"\226\346\216J\240\232M:\362~2B\200\246(K\343\024\001"
+	.string	"\241\020\004|\326\3448/G`U^a\0360\344|y\327\377\371)S?\265\365Z\037\333\222i\322"
+	.string	"A\277m\211\200\227c\225\003\372q\037*\307\002Z\274NO\233k,D-\355|"
+	.string	"}"
+	.string	"|"
+	.string	"KxA*\356["
+	.string	"\222\246\330\357'\356\373F\212\027K\221,\372\022\367\215C\244\007\376,X\364O\367\235\023$\tL;\334\267\216\217$\331O\311\242\025\356{\300\016\237,\245p\337\004ph\020\3721Y4w\337\005\242|B\251y\337;3|\n~\034,\212\357\233'\206\207f\201\365\301\242\262\3736\360\035\327\273\336E\023\017\226\025\212,''\364#\336 ,\332\272\357\372\236Z[R\001X\236\345[^\365.\367r\253\203y\230c}\314\311\274\214\354g\022\334h\240\234\236B,\2507\203C\220\246\270Y\274\236_\313\304}\267\304\354zZ$\356\233\346\n\347\003\301\242-\021\367]\363%\347#\301\242\277\272\357\376\216\213K\357\347Wu\337.-\273\237\224\352\276\001\\\331\335\251[\245wS\251\373~M\231"
+	.string	"\244\263\350\243\356\033\006\305\007\364\026\367m\323d\027dd\321\257\270\357"
+	.string	"\001\231\f_5\323h5\025\227cv\200O\232.\323h\257\232;3.1\211\263.\233D\267YN5\212!\371\212xG\340\321\205\236\257\b\304\320\333%\201FKL`\354@U\312\300[\0027()-\2016\365\304\231\034i\272\322v\332\324\2778\214\3138\324i\274\306m\374\306s\\\307y\274\307\177\034\310\205|\310\213\334\310\217<}\222+\371\324\231\334\311\237<\312\245\234\352TnE\350\001\025\327\314ZcR\314\211\260\232;q\316!\003[\31537\324\2704OLbQ\fo\352\211#\214\245\253\342\231Y\236ch\253\3154\311\331h\263\225H\314f\315Uk\346\230C\322\264\2358\327F\235x\352\324\\\036E\223\304\017^3[q\016OL\016\325BX%q3L$\336`\265\201\030\346\233\253\226\266\323Vf\335i\336j\370\246\023o\030\247\342\031.\217\0015 "
+	.string	"#\251!\017\223\b\037\372\007\363eY\013\027|\320\n\233s\310\2559\220\303\232\206lr\027\345\3612\245<\220\023y,\244\244@\034F7\023\327hd#\315x\226"
+	.ascii	"\033\355<J\310)\217\354\246\310#9\263\021\\\347\311\304\341."
+	.ascii	"\312\304\221\017\250\231\354\344\323L\372\3262\221\2713\211n"
+	.ascii	"=\023\231\317\004[\267\231 s\277\254\t\346k\205\021"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2eae044dff2b06c3,"e",@progbits
+	.string	"(\265/\375 *\025\001"
+	.string	"\300&"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	"\201\204\001\002\001\001\002"
+	.string	"\003\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	" c\220\230V\361\002"
+	.text
+	.section	.gnu.lto_.refs.2eae044dff2b06c3,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.2eae044dff2b06c3,"e",@progbits
+	.string	"(\265/\375`\020\007\225&"
+	.string	"\232G \017E\200ZN:\0172\312"
+	.string	"\327\2479\314\004|\371\345\224\221\255\273D\025`\343n\215i\331\353\2562\275?SLw\366\233:\327\n\266T\277Jb\250\370\236\226\31786\303\211\3778\340b\372wb\030\"\355\357!S\n\273"
+	.string	"\340"
+	.string	"\344"
+	.ascii	"\307r\260\235!\321\n9\240\3075\2455\004\031\205WF\267\204j\347"
+	.ascii	"\255\374\212\377u/\027E\360\216\n*5J\255\365_\020\254ju\372W"
+	.ascii	"\257\256V\247\336\277\340_0\241\\m\205\321\351\007\345\221@\277"
+	.ascii	"\212\375\256S\361\321\242\021Y\301j\255\275\322\212I\223\253"
+	.ascii	"\235F\376G\313\373\250\201\373\250?\305\005\250\324\b\036P\376"
+	.ascii	"\324\377\350\221\367Qoi;\213\375\004\366\205\354#\260\037d\377"
+	.ascii	"g\237\200}\001\366{\366\177\354\373\330/\355\367\330_\373\267"
+	.ascii	"mg\273\3166\235\355:\266\345l\307\331\206\263\r\307\266\001\373"
+	.ascii	"6l\273\331f\263\215f[\314\366\264mf{\223\311d\322v\265-e\323"
+	.ascii	"6\001\017\242>\2134\273(\302\217O;\233\005c\005$N\336jQ\f\203"
+	.ascii	"\013q\270\025\331y\265\233\371Q\350k\001\356\236\334\321\355"
+	.ascii	"t\212\322\027\242O^\210:8v\374\330\321\312\247\341T\302\365V"
+	.ascii	"\213F\006<\3049sO;}4\373[N\366\263\3359b\327\335N\377\314\276"
+	.ascii	"\227\177\271\331Z\325*F\233"
+	.string	"|I\202d\347\301<\314\217C\027\343\2179\031\363\204\310\352U+\262\307k\213\223\003l\247\202\377\350$Q\372C\264\367!z\001\367\321s\001\372]*\b\301\202\262s\347>Z\004\364\313\250\023/<\346v\256\202\016\245\377\344\347:\236\353b\274a\2553\034\324\021\217\300\241S\2138\030\234\b\231\227Z\2262\t\033#\031\322\3078\3242e\247\037f?\312\245\034\313\217U\255\302Z\253\001^V\026rl\247\035\336\241\275,\266\005\035\n{(\331\351\340?J\357\243+\004z\237v\322D\225Q\355\344\331\025\353tUT\223\265\323\353d_\316\2520\033\303F\347?\372$\320[\313d\262\013\220\235@wvU<\262^\330\331k\354G\220\267::\236\256\241\\\330N\237\316\376\334\353\374\004\241\222J\333i\260\377(\257\013\350\323\351\261m\211+2G\256MkJ\231\235\276\234\330\216\251\033k;/\007\350\307\335\315\301"
+	.string	"\333\331\213\003\367\323\005%\245d\247\017g\377\355p\376\345\241Va\021\021\210\217\235\026\363\037\365q\003\364\337\f\351\240\354\004\340\2379\376\314\335&O\255X[F\232l\020\333\334\330\334\252V0 )+N\252v\276\355h~\fz\032_\315\327\230\307\tY\221\207\373\261\"j\247\200\377\350\236X\246\250\365A\364\311dA#\t\300\240RR\017O\320hB\017/hT\364 \250\224\204\242lB2\221\264Ai))x\204\324\364\343 /\235@b\"\n.-1\021\3710}\030q4M\201\302\005\005\0344`(\217\032\020\205(\221\204\002\004\221R\322\007\023DGLMD\r\0164!\231\370\240\001)\304R\006\021(@ \205"
+	.string	"\332\241\003\315\2253,;\275:\354\025n\21614+Z;\207\306"
+	.string	"\2758&\226\034\024\222\033UUMkm\247\267\312~rm\374\313\003\361\206\361\315N\277\325"
+	.string	"z\215\273\005ff\2663"
+	.string	"\r\2525,.Ke\257\324N\001\2511a\322\266\363\303\377\350"
+	.string	"/@\357\f"
+	.ascii	"co\\PQE\243\250#gvz\213_\036\354\210\300H\333\2712\200^\250\004"
+	.ascii	"Z\276\224\355\354\211A\364y*\236-\321\276\233\205A\223[r\210"
+	.ascii	";M6\007\364\276\360\021N\205\025q1\f\020\267"
+	.string	"\346\252\305\316x\250A4e\2203\214\022\021\022)Ha\222\341pB1W\346\001\021P\245\222h\2542\262\331\f\245n6L\315|\312\3324\243\247\355\334\213\376r\216K\204\020\001\217\207\227\240;\273\362\263\240\247\220#8y\37143\3207p\036?\222\207\225\361\302 @6\330\337\375&\317b\240;lk\3506F\0361N5\027\246\223\272F\263C\324h\344\314\035\270\317D\r\013\275\243+\226\301\327\357/\030\224\022\240\025\003\001]\253\337\006;\320\\\314d\310f\2408\320\220\230|\371f\315F\350\034t\204;\317\007\350\036\307h\355\2535P\020^ \033\201z\r\326T\306\225\323\356(B\230\252XU:\036\217\344\236\322\363\210@j\345\314\211\336\245\275\257\363\246\352\263\2168\264\214\002t'\021\t.\354\214$\355!\274(\301\006\036\n\266\034\216<\276@&\221\354\205\n\256d\022z~\177\224\370\322\374%c"
+	.ascii	"\220\315\254\020\305k\321\341\252"
+	.text
+	.section	.gnu.lto_.symtab.2eae044dff2b06c3,"e",@progbits
+	.string	"debugModeNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314"
+	.string	""
+	.string	""
+	.string	"sectionTimes"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	" "
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335"
+	.string	""
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343"
+	.string	""
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2eae044dff2b06c3,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
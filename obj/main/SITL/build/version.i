@@ -0,0 +1,25 @@
+# 0 "./src/main/build/version.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "./src/main/build/version.c"
+# 18 "./src/main/build/version.c"
+# 1 "./src/main/build/version.h" 1
+# 29 "./src/main/build/version.h"
+extern const char* const targetName;
+
+
+extern const char* const shortGitRevision;
+
+
+extern const char* const buildDate;
+
+
+extern const char* const buildTime;
+# 19 "./src/main/build/version.c" 2
+
+const char * const targetName = "SITL";
+const char * const shortGitRevision = "5d8cfc6";
+const char * const buildDate = "Oct 19 2026";
+const char * const buildTime = "03:16:15";
@@ -0,0 +1,237 @@
+	.file	"version.c"
+	.section	.gnu.lto_.profile.fcb92cd099e81fb5,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.fcb92cd099e81fb5,"e",@progbits
+	.string	"(\265/\375 &\025\001"
+	.string	"\340\032"
+	.string	"\004"
+	.string	"\221\315\335\201\001\001\264\370\365\230\f\002\233\362\361\300\003\003\353\221\235\221\r"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.fcb92cd099e81fb5,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.fcb92cd099e81fb5,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.fcb92cd099e81fb5,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.fcb92cd099e81fb5,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.fcb92cd099e81fb5,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.fcb92cd099e81fb5,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_shortGitRevision.1.fcb92cd099e81fb5,"e",@progbits
+	.string	"(\265/\375 T\241\002"
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001'\002\206\b\177\212\001\206\200\200\374\233\336\350\362\t}\273\001"
+	.string	""
+	.string	"\b5d8cfc6"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/build/version.c"
+	.text
+	.section	.gnu.lto_buildDate.2.fcb92cd099e81fb5,"e",@progbits
+	.string	"(\265/\375 X\301\002"
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"6"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001'\002\206\b\177\212\001\206\200\200\374\237\366\360\202\t}\273\001"
+	.string	""
+	.string	"\fOct 19 2026"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/build/version.c"
+	.text
+	.section	.gnu.lto_buildTime.3.fcb92cd099e81fb5,"e",@progbits
+	.string	"(\265/\375 U\251\002"
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"3"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001'\002\206\b\177\212\001\206\200\200\374\234\360\370\202\t}\273\001"
+	.string	""
+	.string	"\t03:16:15"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/build/version.c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.fcb92cd099e81fb5,"e",@progbits
+	.string	"(\265/\375 *\025\001"
+	.string	"\300&"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	"\201\204\001\002\001\001\002"
+	.string	"\003\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	" c\220\230V\361\002"
+	.text
+	.section	.gnu.lto_.refs.fcb92cd099e81fb5,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.fcb92cd099e81fb5,"e",@progbits
+	.string	"(\265/\375`\325\002}\024"
+	.string	"\006\345\206I\300RRc\314\307<$H\346\204\306\017\226r\300\326\345\356\207\301Z\032\260\325\372\021:\002\354\333\361\004\377&H\200(h\360'\235vz\325\366.\363O\323\302\310\025\217B`\216\335sy\003q\250,}\320\323\343\316\215d2\245^"
+	.string	"v"
+	.string	"w"
+	.ascii	"J_\362\201O\315\340"
+	.string	"\304 \035\226\356\357\336{`\003\237{y\007\316~\334\313\233\375#\377\210\205\201B\305\260\26461}$\323\262\356\211e\246\323\327J\363\264\322\325\264\215\264\235%\302\366\321v\025\216m*\333S\266\253}\035\333R\266\207\266\205\266\203\266\213\266m2\231L\332^\261\335\263\353\2162\247*&\240j\025\274V\276N+O\343\3467\321\312\033\236\364\n\255okDQ\265\366\264r8\034\262F@\"W\265~\021\n\037\274\310\275>\242\025!\276\364XT\255'\230\276\321\177\224\364\243\007Az\227w\302\344h\363S\344\2727F\222r\250\025\304Kc<\275&\244j\3553\331\377=\306e\200\364l|\256\360\336Tdv\224\003$\224\316`P>\\\350T\3737\276J@\211\"\337O\265\276z\255\224\341\270\371\305WO\321DP\2651\377\006\025\005\034\026:\252\365\251\204!]C!\254\252\275\215\233?u\240\251\006T\265"
+	.string	"N+\375\250_JJ\210xo\214$f\016V\013\254j\315\301\364\241\036\245\262\363\342\336\232\203\200u\245Hb\0241\246\0254\316\250\366D\263fC\202\005<~I\325\372D\373N\177:\260\302\275\036\356\275\004\002g\f\216ew\276\240\270]"
+	.ascii	"\257\264\250Dx\345hN\b\273\\\312\016\325\301\314\f8w\270\007"
+	.ascii	"\006\254\313p\242\266\235N\207\332b(\016\306\305\032\005\305"
+	.ascii	"\001\002\t,)\246K\211\214.7\203\23646\233L\016\027csAgl%\005"
+	.ascii	"\316\230\\\313\005\f9\r\026`9\220/\245\336\326\260Z\037i\037"
+	.ascii	"\353Y\262\024:$\254\252\265\360\265\022\366\273\371W3\344S\017"
+	.ascii	"\"\253\243\271\363A\251\247Z\377h\0073 \300\002\0219\353\006"
+	.ascii	"\255\303z\311@\261\260\017.\351k\303!\263\222\215L\033\333OK"
+	.ascii	"\227L\005\n\246,\322\2273\260\334\302\356W\230\245?\016\367\262"
+	.ascii	"\271\273\231\300\f3\324\301@_&\256\237\313\334\351+\253\371\333"
+	.ascii	"\215c\016\006\367\353\214\330\210\233\312\374\306j1\257v\342"
+	.ascii	"\253\\\210;\254\f\263\301\205n?\277\f2XZ\211\304PYfV\022fQ<"
+	.text
+	.section	.gnu.lto_.symtab.fcb92cd099e81fb5,"e",@progbits
+	.string	"buildTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306"
+	.string	""
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310"
+	.string	""
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312"
+	.string	""
+	.string	""
+	.string	"targetName"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.fcb92cd099e81fb5,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,228 @@
+	.file	"bitarray.c"
+	.section	.gnu.lto_.profile.ca1c03b026758959,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.ca1c03b026758959,"e",@progbits
+	.string	"(\265/\375 7=\001"
+	.string	"\330+"
+	.string	"\003"
+	.string	"\346\223\345\213\006\002\002"
+	.string	"\002"
+	.string	"\001\277\330\227\230\003\004\330\313\241\243\016"
+	.string	"\004"
+	.ascii	"2Ks\027\272\330\260\2016"
+	.text
+	.section	.gnu.lto_.ipa_sra.ca1c03b026758959,"e",@progbits
+	.string	"(\265/\375 /\275"
+	.string	""
+	.string	"X#"
+	.string	"\003"
+	.string	"\002"
+	.string	"\003\001\001\002"
+	.string	"\004"
+	.ascii	"`c\227\202A&\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.ca1c03b026758959,"e",@progbits
+	.string	"(\265/\375 \340}\002"
+	.string	"\"\304\f\026\300%\035\003\277\375\377\246?Ak\374\377\377\033\322\264f\310N;\005\n\3116\343E\252Fb\213\305\201\373YOm\033P\324'\232h\311\370\3306h\211\004\n"
+	.string	"0\301\016\302\rJ\003\242\233\204\347-]n.\203E\326\236am"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ca1c03b026758959,"e",@progbits
+	.string	"(\265/\375 /\375"
+	.string	""
+	.string	"\250#"
+	.string	"\003"
+	.string	"\002\001\001\017\177\002\002\177\002\001\001\003\177\002\001\002"
+	.string	"\003"
+	.string	"`k.\343o"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.ca1c03b026758959,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\205\004\001\232\004\002\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.ca1c03b026758959,"e",@progbits
+	.string	"(\265/\375 f=\001"
+	.string	"\250Z"
+	.string	"\003"
+	.string	"\002\300\005\300\007"
+	.string	""
+	.string	""
+	.string	"\001\002\004\001\002\020"
+	.string	"\002"
+	.string	"\006"
+	.ascii	"C5R\324\001rv\3729\200\335\370\033\300\002"
+	.text
+	.section	.gnu.lto_.lto.ca1c03b026758959,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_bitArrayGet.0.ca1c03b026758959,"e",@progbits
+	.string	"(\265/\375`\354"
+	.string	"]\f"
+	.string	"6YV@ \217\223\0168B"
+	.string	"\030D\276\002\361C\240#\215RY\202\017\242"
+	.string	"\244\356\030\003\327\340\375\262\217\372\342\371F~\221u)\031\037\020\020\210\300\366\324|*\303\240\233p\242ag\333F\310\336;\311\224\002E"
+	.string	"?"
+	.string	"B"
+	.ascii	"n)\f\003\310\\a!\221\231%\250Ge\327\314\001\236]"
+	.string	"\345\215g\327\266 !\242\216\004\234\334E\007S\b\031\231\231\365\013\036\031G\265A\270m0\261\002%\245\304H)\310\314\"J\312\004\367n\213\240mH\353\223\336\330\305\326\034\2339\266zX\352\330w\254s\330\326\260oX<\326\032\224\210\r\024\231\022N0\311\302\225\310\320\326mE\355\246\3553\177\020\331\245\243\231\314\n*@*;\216\206\330\332\203YD\001\005Z\230T<\342\001I\205\241v\360\354\334\035\201\302\277y\273K\034\232\233\342\341\377\317(i \341\251>\336\246\030\023<\325\271/Os\277\305(\305\220\360\324f%x\013\255[ff\277\322\026\313q\213\003\241\217\310]=\037\020:\030\326\t}D\254\221\013\004\272<\326\310\247\003\262<X\003\353\303@/\006\0130+t]\230\265\311\322\345\234\303\344\244\326$/s\316m:Q\335=\363\001/L*\324\253w\017S'\360R\2029\340\216\247\371{\022"
+	.string	"c\221\"34\030\361g.(e\035\354 \003!\255\221\2568\315\262,1e\007hZ"
+	.ascii	"]\346d*\374\246F\301e\210S\023M\327|\002"
+	.text
+	.section	.gnu.lto_bitArraySet.1.ca1c03b026758959,"e",@progbits
+	.string	"(\265/\375`\354"
+	.string	"=\f"
+	.string	"\006\030S?\020Q\234\016Q\013$\365"
+	.string	"\002\245\216\264\003\020\201c\273SPH]\230\240\r6\246\234"
+	.string	"b=B\332\223\3034\373\206\310\0173"
+	.string	""
+	.string	"\200\"\310R\214F{\325}}\273\347h$Bv7)S\n@"
+	.string	";"
+	.string	"@"
+	.ascii	"G\261\275d\031\017\260"
+	.string	"K2\301b\327S\340Juh\357\002\342auI<\364f\317\230P\330(u+j\354.\246 \276=7\377*n\211F\237'\325`w\235\242\021\206[o;\201m\006\366+\004~\351\2772\0359\307oe\272\3124\005\3231\3230\323\323\224VM\247\246\017\300\332 \371v/| \353\001[\214\260\375\313vzO\261\235\203bk\327\303\213\005\325!\202\351i\377D\n\225\300G\307\341\035\021:\325\356^\204\017Ao\241C\352\245\252\347JL7\214xM=G\"\224\237#z}\027\002\312\317\360v\021-\215(5\241\203\013\t\345g{\237\324\017\366\247\335]+\311\001\036\rF\2413\026\t\027M\273x4\030\214\223m6Y\006\343h.\033,\243u0\213\001g\017\034h\230'\3134\354\362\366\323*\3110\203\007HC\256\264@\210\213hP:i\245\223\217NCTJ+\217: \006\007r\340\224h\005\026"
+	.ascii	"c\221\"\023\357\304\321\360\350M\034f\242\007\025\026\301\032"
+	.ascii	"c\320\243\325\222+\3723\315\222\245\366\300\314\005\221\013\237"
+	.ascii	"1\314\313T\370M\215\202\313\344\324\350p\207\027\355$\003"
+	.text
+	.section	.gnu.lto_bitArrayClr.2.ca1c03b026758959,"e",@progbits
+	.string	"(\265/\375`\374"
+	.string	"\235\f"
+	.string	"\306\230U@\020q\233\016Xa\363\013\301X\305\025VP\003"
+	.string	"Q\350\202eV^\246\360P\364d\210\256\327<\n\357\220\371\373\242\236j\3344\002"
+	.string	""
+	.string	"P\2042\024H\003\363\205\256\277\266TOOMh\223$S\nB"
+	.string	">"
+	.string	"B"
+	.string	"\365\b\223\330|\322\025\007\310\024\211H\221\331-\250G\345\327\316\004&\277\312\002&\277n-\214\215\n\030\024\\\n\215\314\304\316\301\233q\253m\302\026\250d\304H9\310\314\"\250\004\203{\267U\320\266A\353P\242\326'6\006\261\227Q\354\013b-\304V\017K=\354\204\330\207XI\302\376X<\326"
+	.string	",\027\003^d^\030\261\244\312S\361\241\255\257\266\330\271\304f\224\216Z\231\032X0\250\374\022H\306\006\b\3341]\376^\240\006\027\362\t\t\"Uf\332C\035\341\266`\202\307\374\367'\204\344\266\230|\274? <8\352u\337\\\013\t\216\372\334\025\323\345\327)\n1>-\036\034\265\335\b~Ck)3\263\017\235\r\310_5\037\0232\232\226\351l@\260\220\214\303\3114X\310&\303\3014\232\b\366q\240\031\204\007\032\326\3112\r\273\272\264\224\027\365eP!\271\247\326\rt0HFu\351\3267fp!\352\325t\352\034)\234\311=<\235c\345\303\022\027"
+	.ascii	"c\221\"\023o\306\321\360\350Y\034\306B\017\236\213`\2157\036"
+	.ascii	"\037\203\034\255\221\\q\037j\214,e\007fZ\250\\\343\214a^\246"
+	.ascii	"\302oj\024\\&\247F\207;\274h'\031"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ca1c03b026758959,"e",@progbits
+	.string	"(\265/\375 Ne\001"
+	.string	"\024\002J"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\177\005\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\001\177\006\002\177\007"
+	.string	"\003"
+	.ascii	"\200\036\340\207k\3151"
+	.text
+	.section	.gnu.lto_.refs.ca1c03b026758959,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.ca1c03b026758959,"e",@progbits
+	.string	"(\265/\375`\177\003\365\031"
+	.string	"\0062\257I\260Z\321p|\270\\\030\373\203\333?>$\243\215\001#\2361Q\3346\206\252\275\266\346\021\333\034\377m1Z\177\322\366\351\307]\366X\302t\002\267/\037\374\216x\032\2378\220\013\333\354\r\333\357\263q\f\240\\7D7\3312\005\214"
+	.string	"\225"
+	.string	"\226"
+	.ascii	"2 \322\352{\n\225\\\337\237z\347\270\222B\016\364\177\267\214"
+	.ascii	">\264\205\226P\264\227\210\275=\326\307\256*\023(\375\357W_\243"
+	.ascii	"\021+\301\025\241\270?\026\310\252"
+	.string	"\260\025\342\035\262Gf\351\324\257\277\332bI\331\"\343\027\2122K`%\302Fo\020\267\242\274\306\341\350\205\255Z\013[Y]\002\253q\007\254\234\212`\354%\332\340Aig\330v\262\335d\233\311\366\221m\036\3335\333\fl\257\266G\333Nl\213SSSS\266y\266\211lU\203\246\256<]_O\232O/c\256e\320\325\036\3722\325\036j\256=\324e\256)\371\247\350\236jI\232\272\336\013\227\271\226\350\327\036\3712\327\"`\020\024M\\,j\352\316b\307+OW\320T\323?\375\373\363\371\271\340\347\245\347S\371b\223\344\202,rJe\272\352\177\003\273\\\215\364\272\240i\224\376F\271\020\337E \325\340\2116H\332\340\035\310\347?p\365\337\375\344>\370\237\374\017s\362\324\037\206\313\364\355v\277P\201\335y$\320\347\017\177S\222\240\346Z#\r0\025\027\030Y\242\222\274L6M\315.\305\374\b\002\360"
+	.string	"\342H\n\305]\nWi\221x\227\366\210ij\034\243\273\217_\335%\361/w\025\b\330U\360\302\244\250<Z\211\326\031\327\210\257\210RD\272)\241\350(\230mV\353\007I*\027\212\3560\206\366\352\345\371?\350E\375\231\213Y\331\353}\331\205\331\001V\265\013~\333\252\030\250\037\310\bj\324\301T\306\bE\3332\237\371\205\364\274\256D_#\314\365t\021\t\242*^\236/S\375'\250\347ujJ\272\376\244w\0067\036\013\270\231\206\004\266\211\230\335b8\233\355\026\003\300c\263U\370\360\202\233a\240\200\243\351"
+	.ascii	"\360\016\3556\253\315@\214\216`\343\300\346\306\004\214op\036"
+	.ascii	"\340<X\371\006G&\303\261\221\215\266\221\251p\037h \340j\264"
+	.ascii	"\022\243%H\260 \303!\003\206qg\346D\316\355\226\203\243\351\304"
+	.ascii	"j\266\236\036\333N\254F\313\351\211\355\334H\304f\020\330\311"
+	.ascii	"I\365\017\035\361\261\222|H~\206\200\300m\032]\317Q\001\202\245"
+	.ascii	"Ec\250\013\324\022o\223\255\300\374\374\270\201\206\342*q\225"
+	.ascii	"\025\224\035;\2126h\364\"m\021\357O\335\3372\261\204NF\t\240"
+	.ascii	"!\225\"\007\227\013\t\0057 \200\002\221I\307\r\247\314\357\006"
+	.ascii	"\324pkE\3010\013\371:M\301\030\312\300 \002\345$1\262\242\351"
+	.ascii	"\233|a\366\367]\265\306\246\227\264\224\254\024\001@GW\254m\302"
+	.ascii	",z\323,\245\005\231\223\002\210Xn\001\033Q|D\002\253\004h\216"
+	.ascii	"\201p\251\300\314\262\r\3104\263\204\345\006\326\3160;\330\302"
+	.ascii	"\"\3040o\205\bz\031$\303\341\362\221l\201\205\215\323\213c?\227"
+	.ascii	"\331\005X\260\272\353\013;P"
+	.text
+	.section	.gnu.lto_.symtab.ca1c03b026758959,"e",@progbits
+	.string	"bitArrayGet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317"
+	.string	""
+	.string	""
+	.string	"bitArraySet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324"
+	.string	""
+	.string	""
+	.string	"bitArrayClr"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ca1c03b026758959,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
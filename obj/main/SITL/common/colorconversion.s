@@ -0,0 +1,218 @@
+	.file	"colorconversion.c"
+	.section	.gnu.lto_.profile.d22e994e7c0eec58,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.d22e994e7c0eec58,"e",@progbits
+	.string	"(\265/\375 {%\001"
+	.string	"\320o"
+	.string	"\002"
+	.string	"\322\206\312\366\f0\002"
+	.string	"\002\001\002\002\001\002\003\001\240\342\234\212\n"
+	.string	"\003"
+	.ascii	"\237Cz'\322\006\260"
+	.text
+	.section	.gnu.lto_.ipa_sra.d22e994e7c0eec58,"e",@progbits
+	.string	"(\265/\375 *\r\001"
+	.string	"\270\036"
+	.string	"\001"
+	.string	"\001\003\002\004\002\002"
+	.string	"\002\001\002\005\003\001\001\020\004\006\003"
+	.string	"\003"
+	.ascii	"*\002\244\204\277\001,"
+	.text
+	.section	.gnu.lto_.inline.d22e994e7c0eec58,"e",@progbits
+	.string	"(\265/\375`\302\001m\t"
+	.string	"\"\317-+\200)I\007\246\205\211M\306h\203\017\240\004\351\254*\202\216\225\004\227dX\206\034\001++\217\201\235\206\324\205O\017\357F,!{\247\377\253\225\223\33220e\214\235\214i\2551mZ\323\234\315\335-\3471\r\221i\017\265\324"
+	.string	"%\024\021\007<U\037i\202q\361\260\316\326\023\202\023-\024p.=\035u\262\236\020\336\032\353\2204\321V\031Y\307\354\331\361"
+	.ascii	"\333\366\306\321IQ\024e\254Wh\013\275\300\247\025{I7\360\032"
+	.ascii	"*\241\304\335\3009\326\211\005w\372\034K\301\347\213\270\203"
+	.ascii	"\270\205\t_t\317:\005\t\022\027\220\245\357Y\013\237\001>\004"
+	.ascii	"l\210H*\266\370\033'\001: \320\002\241\354\034r\200\237\231["
+	.ascii	"\241P\350o\360\035\b\021\322\236\260\r\227u\020\201\205n\315"
+	.ascii	"\305\265@1\24306\254\223\334\330.d]\310A\bb\234L\210\201\020"
+	.ascii	"\2300\222\001\361\204\200\240\340\250d\023\304\232;*G;\033#\212"
+	.ascii	"H\006\266\b\363\204\203\316\244\321$^\313\270\334\033\005\365"
+	.ascii	"k\357\016\303\2703{J\001\001\356\"\017w\214\345\0043\250\265"
+	.ascii	"\340\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.d22e994e7c0eec58,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\001\001\003"
+	.string	"\002\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.d22e994e7c0eec58,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.d22e994e7c0eec58,"e",@progbits
+	.string	"(\265/\375 8\205\001"
+	.string	"T\002,"
+	.string	"\001"
+	.string	"\001T"
+	.string	""
+	.string	""
+	.string	"\001\002\t"
+	.string	"\002"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\020\b\020\002\004"
+	.string	"\020\020"
+	.string	"\001\002\n\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\2730[n\333"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.lto.d22e994e7c0eec58,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_hsvToRgb24.0.d22e994e7c0eec58,"e",@progbits
+	.string	"(\265/\375`\013\rU4"
+	.string	"\n]\304\023?P\344J\007F\343\223 \243\250\310\350\342G\255\221\024\276\025\233\246P\364\024\223\204\200\303\037\203>\316\337r|5x\254\375\3420\n\266P\256-\211\306\3179\315\222l!\021cro\271IJ)\005\037\001\f\0010\001\326\271\311:\013H\235\231R\347%\3249\200uV\262\316"
+	.ascii	"\252sRuF\252\316G\326\331\310:\027Yg\"\353<d\235\205Pg\233:\247"
+	.ascii	"\2513\232:\327\324\371L\235\215\250\363Wg\257\316\035b+\212\322"
+	.ascii	"\341\2758\232\202n\233\323\314\222\376\353\006\354\356\322\247"
+	.ascii	"\033\231apgi.\035\310C]Z@\235\367\n\351\302'\226j\351-0\032\220"
+	.ascii	"\005\224\2757/\220\317+\355\023\312\270l,0\372\257\205\361\356"
+	.ascii	"\215Y\361\202\347\336\345U\237\274\225\366\211\344\255T\335\333"
+	.ascii	"\317E'\335\253WH\346\336%\026k\245}23w\225\266\002\203\341\232"
+	.ascii	"\226{u\033\252$\267\370\271wy\344e/\325>\323V\252}\276\221\206"
+	.ascii	"\353!!\233\242\3654\276\303qw\371\030T\322\305\365\020\236\220"
+	.ascii	"\235}e\372\002]cR\3211c\337\234<\247\217\273\316\313a\227D\n"
+	.ascii	"\321\315\250\266N/\220\243\362r\374@\215\350X^\335\217~#:\031"
+	.ascii	"F\250{o\007\266\327\240\233sG\307\356\275\354J\272\272f\242f"
+	.ascii	"\3465\314L\306L\364&\375\314\035z\320\354\210\371C\2439+\332"
+	.ascii	"\273\367r\235iA\020\314op\336J\270\332\347\271#Q\251\350\367"
+	.ascii	"\336\270\177\"\374\347$\313\034\031\016\210\231\321\272L\032"
+	.ascii	"\223\234\262\237\272\373\357f\267\250\030\276\027\221|s\336d"
+	.ascii	"\377\377N2\325Z"
+	.string	"L\222>\375\301\364\250\370\311y\223\231G4\230\022\351\2752\270\270\277\304\300c\"\275\367v\222>\271]\324>\373\261\202\374\361\223\363&\3632\256\215\367\336\353O\204\271\215\367\336\313\257\307\334\200\315\031\372\257\271\254\2734ch\277\356\013\325\331Bu\256`\235)Xg2\353<\226:OH\235\305Pg\t\3269\314:\203U\347\257\352\354U\235\273\252s\004\353\314e\235\267\2543\004\324Y\313:?\260\316\016\252s\203\352|\264\316Y\326\031\313:3H\235\257R\347\005\250\263\225uV`\235\253\2523Uu\236\252\316R\3269\201uF`\235\243Pg(\353|\300:\033\250\316O\325\271@uv\252\316\004\254\363\200^\343\354\310\225h\016\0138\rO:\322\351\t|\001\247\001O\340\233\302\004\352\246\037\360(!\262O\300+}\323\033\027\221M\230^\300\322\2071\375i\210\344\013\360K\355\246\313>\300WB\244\2319"
+	.ascii	"\257\004\340\3218\205I\246\234~\023\254H>g\266\344rgG\036\207"
+	.ascii	"\206KR\2239\310\021\225\212H\177\364I\337H<\244o\243?\372J\030"
+	.ascii	"\326,j\321\033\375\211\210\354#\372\241/*{\2427.fx\241\037\372"
+	.ascii	"F\362\t=j\330L2\001\231-\3759;\362#h\330\335\327&\316\0071/\343"
+	.ascii	"Z*\260N\357|\"\213\334|N\037\212\334z\214\354\312;g#\221\033"
+	.ascii	"\3173\355p#\272\2379\334t\032\211\314\245\303w\205\304\341>\344"
+	.ascii	";\351\275q\215\307]UY\310\355#\304s\357\265j8\314|\247\033\217"
+	.ascii	"\231\371N\272ws\334\345\265\352\323~}r\355\234\311a]U\313\336"
+	.ascii	"\376)x\210\354\233\373\f\337\213If\212~\372FC$\263\376\371\350"
+	.ascii	"7\262\311\\\375GL2\215,X\317o\fo\374\323p0\3114j\350B6\204M\016"
+	.ascii	"\275FM\232>J\305*\320\334^\315\rM\204Q\355\215\304\2475\247e"
+	.ascii	"\255\261\225pkS[\261\306\226\326\306v\202\r\005\n\266\264\343"
+	.ascii	"Z\t4\024\307\2646\267c\226\024\263\245Pk;\252`ck;\016-o\277\036"
+	.ascii	"{\026\270\364^\271V\376\031!\005\333\310\375\034\367\233\356"
+	.ascii	"o6\233\203\206,,\257\370U\370\257\267@\341+\220=\205\261\017"
+	.ascii	"{\262\t?&6A\302\213I\370J\b\366a`\377\342.1\311\374\262R\245"
+	.ascii	"\357\353=\334\035\372\024)Q\356\n\225\212{\332\b\020\212\320"
+	.ascii	"\023'M\232]|K\224\364\361J\202\344H\327Gx\257.\256\217\360\250"
+	.ascii	"\340\326s}5\204\360\017~K\353!h\375\211\350\340\0378\370\027"
+	.ascii	"v\211y\332\b\360\316\366\236\221\"\036\354\3064\320\033\222w"
+	.ascii	"|\252o\220"
+	.string	"\365\307o\n\203\365Y\217\0222x\005\217u\365\f\026\274\313\350+\253_`\365\225\260\352\025T\375\013;.I&\225\220 xT\177\0166\357\364\333\240t\n\310\017\037R\377\364S\t^\352QA\004\237\340\253a\324\037x\004P\037\005\365'\242\201?`\340\321\303\302$\323\256\007\217\301\301\247\035:\352Z\251(\367\364\347\340\230:\375\226\007u\362\034fK\216\343\354\310o\240It\033fK\001\200\370\250AT\345\034S#\243\240\240\240\240 \3110\006\020\003\221\231\215\033\021\260,\207\240aLPS(\f\007\351\310)\370\263]\335\033\003\233SC\002\3700\250N\375\233*l+\204\314\311\237\332\257\306\235\016A\315\022\351\247\304\225\331\363ey\214\217^\361\324YNzt\021\211\037\307K\216\037@2\177\204gP\272\305\222\342+jt\324\005\373>I\017\2153\255\334\333?\3459\236/\364Ox&g\337\035\311\031"
+	.string	"\361S\022\020e\305]\037J\375\203\217H\242VFJ\246\033?\3123\344\247\355\277\213,\013\350\377])g\002\257\210d@;\351\256L\366\002\343\316l2%\001w\214\t\344PQK \007\370\013\262s:\324\322\033\355\270\363\372\021<)\276D\336\207eY\271dy5\320xm[\n\005\3341&\220\003>\006^\303s\350\261\326\027tB\372\215\316\"\331\260\347]\304bk\204\331(\321\240cR\254\366e\315\260\347Wi\255\001?\271\216z\373@\320\341\3476\003yC\264|g\027\213\356H\365.\255\3506\375\215\022\021\300\311\204\302\261\326\031\357\205\020\003b\261\346Nf\243\223{\375\242\333\214\r\202D\370\210~\211\325\232\322_\353\021\271~\004l`\346\026\342\207T3\254\352I5<\013\322\227\2742\205#\231\233\231\177\343\256r3K&\344\207\306\202\037\242\374T \020\b\270!L6\377\277\b"
+	.ascii	"\003\325\202\251o\214l\360\034\207\311\324\355]hu\316\226\235"
+	.ascii	"?"
+	.text
+	.section	.gnu.lto_.symbol_nodes.d22e994e7c0eec58,"e",@progbits
+	.string	"(\265/\375 '9\001"
+	.string	"#"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\177\013\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\001\f\200\204\001"
+	.string	""
+	.string	"\003"
+	.text
+	.section	.gnu.lto_.refs.d22e994e7c0eec58,"e",@progbits
+	.string	"(\265/\375 hE\002"
+	.ascii	"\002E\016\031\300g:\031\321\023\307\374\377\377\347\277\025\354"
+	.ascii	"\273D\325Pw>{\204v\222\001UdR\220\207\243\301X(\256\304\035\316"
+	.ascii	"p\205#\334\340\004\0278\300=\327\034s\313)\347T\210\006\004\001"
+	.ascii	"@\300\001\006\004\234\200r\006"
+	.text
+	.section	.gnu.lto_.decls.d22e994e7c0eec58,"e",@progbits
+	.string	"(\265/\375`\377\006}*"
+	.string	"\032O\b\021HpZN:\207H\266\204@TH\225\240\374\007B\254\017~\022\310I6x\254\3554L8\310P`@\033[\"9\004\245\347\271\021u\351J\326\026\301\037\311\252\237\344\372\275\343\216\247+9mX\206\\e\027\033\022\304\022\231\002\332"
+	.string	"\004\001\373"
+	.ascii	"\334\306l\334\362\032G9K\341)?\331\356\266\273{\275"
+	.string	"\336\020:\327efw\321c\270\tX(E+\\n\302N\2705\342'g&l\366\034!\333\354\271#N\223%'z\t\367l\224\362\232M6J\377tO\016J9\t+\341\266\210\317\256\304t^PI\227u\263>=wE\356\336\234\350}\367\274\344\004\204\315t\364\236\213RnrQ\372\363\376\260P:\304B\351\317G~&\343\262\"\236\272b\355\264n\026\310\207}A\024;\321\263,\224^\016J\377{\371\377\345\177\334\377\263\377r\377\341\326\330\376\267\031\375\327\320|\363\277\300\317t\377\335\374g\376/\363\277\312\377\006\377\237\374G\360\177\314\1771\377\227\377\255\374w\373_\366\277\347\277\226\377g\263\331l\376\027\373y\300\237>\005jF\265\265\261\372\326\320\332d\237`\203\234\354%\262x\333`\222^\321\335\\w\223\306\026i\270\f\021O\230\027o\313\260\313\226\361xy\355XO\224\r\240F\243\211\0131\313"
+	.string	"*~\0349\236\250\034\207\341\226\227\337rD\231P\346\272{\311Y\370M\030%\331\335D\275\336\216\220a\034\214\024=S\027\263\244\022I\022\216\301\360\027n9\216\275\234\331\263Y\034sIKv\263\275\336Po\307\253\310\220\355\242g\343={\3353\361\236U\334\363\211{~\373\031\013#a4\016\335\303\356."
+	.ascii	"\364\001\003\355D\231\211\357\254%(-\036\331\366\341\251\271"
+	.ascii	"q\3019\321\363\326\345q\320\025\243;l{Rv\242?[a7\036\034:\340"
+	.ascii	"x\234h\025v(\247\213\f. '\372\022\367\214D\215\321\004\360\272"
+	.ascii	"i\240I\262\231\022\023\2571\313h\254<N0rf.\302\357;\257q\032"
+	.ascii	"CA`\242{\245q \214\013Z\033\263\233\245\022]\352\322\364\240"
+	.ascii	"P{\243R\205\365AzYCv\242-\323q\224\377\315kJ\371\302\342v\177"
+	.ascii	"\376i\013\213\335\315\"\207\355\342\026\3179\207\371\350\357"
+	.ascii	"a\036+\370\2176\317\256\033l\314\356\006\231\"\224q\242\377"
+	.string	"\023\364\211t\007\201\232\355\242\332\"\203\352\031\234\021\210\355\260\002\335\212\265\312\"\215\350\032<\233m\356!\322\030Be\327\242\312\256\301\237\036\256\301n\326\370\243\246\t\203\254\266H\243\332\256F\240\036v\260[a\330\035\256F\365m5\376\250\255\320\250\016\221F\240\257\261\033w(\310\220=\330\250\016\273\213\b&,\376(Uv\355e7\247quQA7\330Z\\\n\277XmK\331\265\005E\2702K\334\262\261\366P\251\216\255\335c[VM\\\n\262\312\316\301\312\240\030X\257\340\3526@\354\016r+\273;\330\335:E0\266;\306\217\232$\022\273\217C\304\006\013\256qu\237ic\002ZQJ\021  \001yg\260\244$U\225\341\247a\352\nH\205EUu\277\324\364\240\311\251\204\316\235\240 @AH\357\004\345\363A5\371\356\233|<\255\254(\020 \244\226\224\244\252\200>@\256b)\226\252\002\362Ht"
+	.string	"\362\264n\205d\340?\020T\300$\255\337\017\230\024`\004gE\001\177\036~\024FdY\001\320\212j\362]+\326\212r\322\302\272\022\241\363\247'\n\t6\\\260p\247\220\260~WY@\252\021X\277)\340\317\303\357\303\207\337T\022\326U\207\017IS\300\254$\244\005Y|\216\303w\334\036qsg\310v\273#W7#\355D\177\246\270\347\243\324\207\217\340\230\321ac\236\360\341\246\r+\331\f\332G\224yd\256\213E\007?\271\356\371\f\2439\317}\216\231\227m/\rd^,\230}<\036\001 \362\245\203\213\335\231\311\206\247\273\254\273\021\b\020\363\243F\r6k"
+	.string	"\240\t2$L\r\227i\"^\215\320u\2519Q\217\034\335\031\231\023\275\032\256\373\277sa\306\233v\250q8\206\b4\310\004\"\022\214\320\214\302&\007\220\002\221)\243z\021p5\242FN\222$m\006\322!\002\007z\0177\032\326\354\247i!$.\317)\307\242\365\341\3233\254\225,\230\033\340\232\006\013\205N\313\031\020N+d\322-\353}\2327\244R%}-*\321R\020#x\266\224P\260A\273,\336\006\331\300\242\365\016m\273h\266\302"
+	.ascii	"\327q\3237\222\232\206Bp\216&\301R\321\213\033\204/$OUY\n\373"
+	.ascii	"\r\263\0238\212t'\024\232F\374Wbf?\361\333$v\203L<\302\262\317"
+	.ascii	".\371D-\204\017\355\211\355\023\3267\242\336\036:\214dz\334\213"
+	.ascii	"\345\007\361\007\331X\246Xee\353J\300~\265tD\241\034\242dp\326"
+	.ascii	",x{\205\007d\035A\r\323\267\265@\222N\260nJ\272\376)\277\376"
+	.ascii	"pw[\346\356\b5\007\235|,\345\224\373\245\360g\301\002\325\005"
+	.ascii	"\352\244\273\366\203\201\035\370\211#\354%\017\020\220\335\323"
+	.ascii	"\253"
+	.text
+	.section	.gnu.lto_.symtab.d22e994e7c0eec58,"e",@progbits
+	.string	"hsvToRgb24"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.d22e994e7c0eec58,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,392 @@
+	.file	"crc.c"
+	.section	.gnu.lto_.profile.716c22442f6af5cc,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.716c22442f6af5cc,"e",@progbits
+	.string	"(\265/\375 @\325\001"
+	.string	"\024\0034"
+	.string	"\005"
+	.string	"\334\206\377\260\007"
+	.string	"\001\260\240\374\337\017\002\002"
+	.string	"\002"
+	.string	"\002\276\307\307\\"
+	.string	"\003\277\315\376\324\t\004\220\351\245\372\f\004\002\001\002\002\002\003\002\003"
+	.string	"\002"
+	.ascii	"\323\024n\003X"
+	.text
+	.section	.gnu.lto_.ipa_sra.716c22442f6af5cc,"e",@progbits
+	.string	"(\265/\375 _\305\001"
+	.string	"t\002S"
+	.string	"\005"
+	.string	"\002"
+	.string	"\003\001\003"
+	.string	"\003\002\003\004\002\001\002\003\002\001"
+	.string	"\b\001\020\b\006\001\002\001\200\004"
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"\001"
+	.string	"\006"
+	.ascii	" x YO\330@\314\300\021\030`\001"
+	.text
+	.section	.gnu.lto_.inline.716c22442f6af5cc,"e",@progbits
+	.string	"(\265/\375`u"
+	.string	"}\005"
+	.string	"\022\211\035$\2009\351|>\211\034\020\324w IN\2520\204\353f\266:#\311DB&"
+	.string	"c\334#6\306h\226l\271S\317<3O\223\315n\0023\317\342\223wE\206\331\343]\321\001\362\256\210p\262@q\207DA\355~\303\233\223\021k\252\020\371\003\212\370/\305vtRbMU\341\306V\364\336E\235sn\371&\033\022\005\r\330\257\024Y\021;6\371$\n\022\27422\002\026"
+	.string	"\036\013\004\325p\374R\004\327!A\341\260\354\"M\312\321\\& 5P\033\030\001"
+	.ascii	"\003\204{\304\220\206]\276D\246\223\204\377\252\332m\321\201"
+	.ascii	"K\273<\327\322\300\020"
+	.text
+	.section	.gnu.lto_.jmpfuncs.716c22442f6af5cc,"e",@progbits
+	.string	"(\265/\375 k\205\002"
+	.string	"\324\003_"
+	.string	"\005"
+	.string	"\002\001\001\017\177\002\005\177\002\004\001\003\001\001\001?\007\177\002\006\002\b\177\002\004\003\b\004\001\002\002\177\002\003\004\004\177"
+	.string	"\001"
+	.string	"\001\300\004\001"
+	.string	"\300\004\002\177"
+	.string	""
+	.string	""
+	.string	"\001\377\001"
+	.string	""
+	.string	"\007"
+	.ascii	"\300\244\001\202\200qA\326=G{\271a\003m"
+	.text
+	.section	.gnu.lto_.pureconst.716c22442f6af5cc,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\200\004\001\205\004\002\200\004\003\205\004\004\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.716c22442f6af5cc,"e",@progbits
+	.string	"(\265/\375 :\r\001"
+	.string	"\250."
+	.string	"\003\001\003\200\007\300\004\300\007"
+	.string	""
+	.string	"\001"
+	.string	"\003\004\002"
+	.string	"\024"
+	.string	"\004"
+	.ascii	"?\t\232\331\027\260\177\003X"
+	.text
+	.section	.gnu.lto_.lto.716c22442f6af5cc,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_crc16_ccitt.0.716c22442f6af5cc,"e",@progbits
+	.string	"(\265/\375`k\0025\024"
+	.string	"f\246\204I\320\360(\035B\001\267%>\200\004'By\230\rQ\336\3761\221\035\021\303\027\302\240\026)xF\221\201\242b\"\205\364\276\305&\201\236\251\347\360\205\027\\A#|Hu\026@\232\331x\355\310\340v\247\322\266O\b![\312\224\002s"
+	.string	"h"
+	.string	"o"
+	.ascii	"\341\275\227xO\3142\035A\320(\330\211\321\345\230s\024\001\\"
+	.ascii	"\300wO\337\372\356\255\216\303\313\361\006U\366\020\374<\271"
+	.ascii	"*\363}>\002\304B\306\346\362P\20234IG\242\311 Q\230lh\250\331"
+	.ascii	"f\n\216\270\371gs/e\263\271\224\006bx\250\261\262Q\220\004nF"
+	.ascii	"5*\033\214\356\203\256CE2\266\233+\310`\316i\225\261]\270Q\267"
+	.ascii	"\275\301\266hkM\255\020\026\210T\257>\216\373=>\376\252\353\356"
+	.ascii	"\324q\270;\\5\270\352O\325\236\252\345\252W\325\252\352\007@"
+	.ascii	"}h\355\346\264\360\3444\217\274\027;\327\335\376\217\037d\225"
+	.ascii	"s\007\212]g\"9O4\350\341Y\232s\222\334\263IxOD\336\216\331*;"
+	.ascii	"\301\202\330\307\002\3369oJ$\252\307\311\354\315\311\301D\213"
+	.ascii	"9"
+	.string	"G\023\037\b\250e\355\336\2409\315\264\302\017\211%\017\334\220U!\221\016o\371\276\005\367\336~\2738J.\327\333\243V.8\233q\036\0259$\2719n\371va9#\030m2jw\037\364\221!\030\273\233\321\341b\275Z\217\375\330\373\234%\024c\243\273Zkx\023}_\335\325\321\234f\372d\325~7E\314\216\027}\262G\027\335\034\373(L4\021^\034;**\232r\027\314\265v\235\270`.\221\345\265\262\362r\211,*)+\242\013&A<\031\340W\004\b0q\302\353\005\023U\343\374\342\330\022D-\bH\310\204\341\350eg\241\322\327z\260\013\241$Om\315\362\013\035\350\334\364cQ[\363\356\251]\0244rJ0\332t9\347\234\340\346\030L\362X\233\322Y!C6\334\232]\362\324\266\026\224QD\273\315\364I\207\276\037\301\0270 P\002A\314i\007\023\005>\035\006\352\013o\231Uz\t\332"
+	.string	"_\373"
+	.ascii	"\032\302\224}|hK(j\205\357\277,\002Z\371b\364(\267\303\354\036"
+	.ascii	"&j\237\365\006c\332b\251)m\001\360y\332U5\223\332A\3068{\356"
+	.ascii	"\315J\\\262-\326\177\337\306\"P\337\361\267\f/\200\305\377\f"
+	.ascii	"J\336\022x\bh3\270g\f\207\227\030y_\343\367Z\247\245O"
+	.text
+	.section	.gnu.lto_crc16_ccitt_update.1.716c22442f6af5cc,"e",@progbits
+	.string	"(\265/\375`\214\004%\037"
+	.string	"\366\370\306K\240VN:\203X\210\307\221\323Y\177\013_\371\217w\3540\242?\003\030\275"
+	.string	"f|\024B\t\265\200\362\251\362\357\235N\037M{\353{L\226\30249^L\224JK\363\267\204\257\274\022L\317Q\327L\327\365+\221F\b![\356$\003\265"
+	.string	"\250"
+	.string	"\262"
+	.string	"=\210>\305c\307\335\373bL\307xr\255\227\n2y\357\212-!\367\032\021p\316y\362;\316\203\210\203\325\030C\211A\026RU\225{\215\273\333c\312\223\365/\345\311~\342\363g\260Z\343\031\355\340S\264v\232%i\273\006\371]\325$D\321\303Sk\036\215\240q%J)\354\216\031\231\327\261\204\025\025"
+	.string	"c\211\3515k&)\211]\211\022\n\273S6\306D,\032\325\023\306\322\211\233&^\242E\023'-\201$.\240\330\212C\253k2B\"-\036U{|\215\272\321b\351\304\373X7P\244\254\305\022\323\253\311\273\367r\rQ\\:\263\234\231\305\230\231\307l-\004\270Z\345[\255\354bky\227\324\217\336\352\\\373\217\377\374\324o\376\352L^\352lk\345>+W\263\362\001\244C`\306\356\035\221vv\221\220^5\016\366w\375V\377\325-\363\371B\016\306?r\312Et\255\1771\003\237\305\367\n0#\307\2757=\331eo\f\036T\026\360R\301\002<\264\032d\327\342sq\n\374\026\037\355\265\212\300#\212\354\336\373"
+	.ascii	"\310\234\236<3\021?\310\2618e\346\253!\034\017[6\034X\r\361\204"
+	.ascii	"\037(\020\341\"\273\327\250s\222\033X\037\257\"\372\217\016\366"
+	.ascii	"v\215\\$)8O\342\330\256\3147>"
+	.string	"5\335R\206g\302*b\n\007Y9\3234]\265pX\\C)\3233}\244\0221-\323M\345\300a:\246\237k\2306\205M\036\225E\225\204\324P\276\364\217\312\210Q5\343\\\277\364\217\037\360u\244\201$Y\351\262\267\266\215\303i!\225p\351[sEB+:\037\313n\227\376\327s\204\\\303\263\332\335\277\3620!\237S\006\177\250<Y\273v\024Fd*\252iu\247lh\243\333\251\315\256ue2\204\022\3264>\373m\202\245!\241\025\3254f\243\260\266\023\363M\241\024(\334/\230ol\016v\326\325\320\240\225g\320\3122\265rL\255\f\203V~\311\005>>5\350\027\200z\202l\006!\f@=\033J\036!\236\013\266\367\3535\367\022\364~\275\035\220\357\347\307\327\333\001\371\360\374\354z?\340.\001\r\373\202z~;!\237\357\267K\215E\267\250m\233\2559\350@R\324\302\264\235\330Fl\252\265T"
+	.string	"\021\245\232M6\221k,\315\266\242m\233Xk\3624;\204)f*P{\346\232e\301\311n\351c=\347\210k\bUsb\332\364\217\237"
+	.string	"\204F\353\\\327D\266\346\215\204\247\246\306u\256\211L\344\272\356 O\250\234\030U3{\357\275g;\261)V\3264\372\264E\322\364M\023\231\017\\\3276m.\t\0336\t\315vz\2012\327\001]\250a<\243\bs\210\220\004#22%i5`\002\231\262\354\006\020xW\223\244\335\320p\255\213<\0215\201\t\244\037RL\004R\003\354\272\301\020]<\344\250`'BD\022\300\t\243t\233\257\037\232\264\215\352I\361\341_\371\346n\023?G!\"G\213\271*Rk{cLb\007\367\034k!\203\0070\016\223\246,\2216\025;\037b\371\021\211\352\254\230"
+	.ascii	"\037\222\256(\313>\262\333\016\332\311\322!,\230\334\207\373"
+	.ascii	"\217\361\302\221X5\334iw6\002\325l\331\341\022\350u\223\263\033"
+	.ascii	"\353u\035)\323a\327\026a\205\240\234\177gJ~5f\021\214Q\313\030"
+	.ascii	"0\336'\3044\256\345\033\342\3058\322\262\344\257}\212tN\377\003"
+	.text
+	.section	.gnu.lto_crc8_dvb_s2.2.716c22442f6af5cc,"e",@progbits
+	.string	"(\265/\375`%\002\365\022"
+	.string	"\306c}H\340\360&\035\302J\003b\001p!\331\221\271s$\315"
+	.string	"\360mF\224\n\366\n\n[\226\250\225Q9V\331\235\366\315\346\256\241nTO\224\033OX\203\034\352C\r\344\005\030\307\225\001\025\030\371\001h\376\266\203\354M\266\224)\005m"
+	.string	"`"
+	.string	"j"
+	.ascii	"%V\340\275;a\340b\327q!hN\210b+t\314\211\373\026\204\275C\334"
+	.ascii	"-\325uO\306\016\256\272|\235\213\364\374\310\314^\356A9Sst\243"
+	.ascii	"\232\r\020E\t\007\007\331\354\245\322\204\315#\355\335iF;\204"
+	.ascii	"\thx\270\221\232]\200\006jC\032P\263\030\335\363\\\203\204df"
+	.ascii	"6W\331`\316i\225\231e\270?n\273\203\355\317\326\b\001v\210*\005"
+	.ascii	"\202z\316\177\372\355\377x\356\366\344ow\\u\267j\250\352U\265"
+	.ascii	"\256\372\001T\037\b\364\314I\323\3044\213:\031$\236\273}\234"
+	.ascii	"\317c\224\257\342;.\317\031\bN\026\016nHIs\316\221w.\361\336"
+	.ascii	"!\370\200\370\016^@|w\333\305F\3319\007l\214\250\376\346\362"
+	.ascii	"\316YK\001cN\\!+\217\204`\265\2276\351\214\270\266/\210rS\033"
+	.ascii	"\227`L/\305\260s\"\251\353V\265\352#\341-\021n\267\217\321v\341"
+	.ascii	"n\016\222\353\356\036\306$WW\302j\034\205\213\234\021\\\233["
+	.ascii	"\342\267\225\033\212Q\036\226\373=\317E\202\210b=`\266gfG\214"
+	.ascii	"\365i?\026\265K\373\211\321^\332d\343^tm\366Q\224`%\2747\001"
+	.ascii	"**\232\362Uk\265^\231\254Z\253\217\205\265\262\302Z},*)+\337"
+	.ascii	"\252U\3413)`\026\205\t\255\317\002\213\325\372P\270\371\275\261"
+	.ascii	"\241\224\013\002\342)-\025\301\354\313[\233%R\f\201\3403BG\356"
+	.ascii	"\255\3140\306\275\316\037\340\324\024\265re\006\212\336n\013"
+	.ascii	"\0219\244\030\345q8\347\234rm\006p\324\245\366\204\363\002\252"
+	.ascii	"6\256\314&\271\267\001+ `\202AgV\007\024\n|x\030\334\027\326"
+	.ascii	"eX\244\334\270\265#\200\214\202\247\241\200J\271>\244g\t\270"
+	.ascii	"\025\027=\317\226\3459\234\202\211\330\007\237\307\bL\030\334"
+	.ascii	"\354\276\253y\205{^\006\254p\336E\374\026\265\035\332\027\274"
+	.ascii	"b\215\021\205kx\263\203\225u\021\026\200\315\3402c \274\314\310"
+	.ascii	"\0335\276\327:\355z\002"
+	.text
+	.section	.gnu.lto_crc8_dvb_s2_update.3.716c22442f6af5cc,"e",@progbits
+	.string	"(\265/\375`G\004\305\035"
+	.string	"\006w\277L\220\326U:\002\302\247CGS\035a\314\333AO\332\261\202\325\037\311\b|\301\033\361K\200d\033\340\240'_\256\230\307\255\215L\326\255\035\257\037H\004"
+	.string	"F$\231\317\020\237s`v\244\177\205i\304\301\232x$m~D\b![\356$\003\256"
+	.string	"\240"
+	.string	"\252"
+	.string	"Vo\271w\005\023\232\341c\314\227\350_\314\227\\\353\2059\356{\201LC\356\035\"\340\002\350K\006\rp\234\373\320\205\020\003d\320\217(\367\016e\335\202\321\243\271j\207\347V\347\236\266X\350i\226\266k\216_\363\243\022\321\363\360\324\236\037\204d<\311\020\n[s4\026\257\244\253-\001,|Eg\331\223\304\320\324\223\f\235\2605WVE\274\036PEY\370~?M\334l\365L\274\264\004\220\030-q\365v\026"
+	.string	"\320H\211\264\367\241\332\247\327\252\032*|\277\367\225^\032\205\270R\341+z=o\356\275\\E\364|g\22533\0253\3370[\230g\225\364\302\237u\2443z\037\377\371\341o>\351l/<7Z\271\236\225\017`\001\021\230\325\275BI\344\225*\2133^\374\211?\322\237t\313|\276\220\027\371O\2346\341\276t'\346\333\203\360\207\364\325\217\034\367\336\023\355\375\331\330@\336.\314\305l\216G\214_\3427qz;\023C\331\233\024AXe\274\367>\2701\247/\317\214\343\003\271\022\247\314\234\344\023\300\303\024\0326H>7:\020\024\212$\215\367\016i^\262\003\333\343G\270\373\350`Y.\220\321\b\005\350\313"
+	.string	"\266+\363w\234\007\356C\016\035\274\001\363\3252m:\331!uuD\017\034F\023\246c\2726Y8\315|i\230~\020\221K\277tC9\360\226v\351\357\220\257n\351sGu\035LGHJ\232\311\322\266##@\365\310\257f\351?}"
+	.string	"\221#\r\204\204\024'\333]\333\325w\372"
+	.ascii	"\"b\020\221\356P\0344\240\367\336\303\340\373\230/k\177\350\027"
+	.ascii	"\305+\372\251\311Zs\265\243\321\035l\263\321\256Jv7t5\311g\277"
+	.ascii	"\317\250d\320\224\237\232d\036\352j\007\231\177\352\234,\341"
+	.ascii	"^\301<\023{\361\f\223\211aU\206aU~\251\225]j\345\026Ve\226\227"
+	.ascii	"k\345\304:"
+	.string	":\225\347\027vrxl\206\036\f;9\033L\234\036\234\013vf\2335\317\022\314l3\331N\215F\253\315d;:84\331\314v\223%\210q\215'\307&\353\251\325l\262t\370s\333\352N\323v\355NH\375\264.\355 _\252\006\220\265RA\250I5\3336\217Y*\315\266\262\272\333\242\307CxrL\321\262\350\253U\026\334\366J_\351\326\370#\356n\260:\310g\325\031\233\320$\243i\016k\036\333sFB\f`\273\372\325<\2062a\335K/\216\252\200\352\321\336{/\332A^\2312e\272\025CH\031\3233\315c>pX\307\372\234\212\332\001ugU\250q e\b\203\206 #BA\311\324\264\325P\0021\312e7\020pg\233\f\273\001w\242\356\016\304\336).\367\210c\267\026\257\262\317\335\302F\244.\325\231\005Lk\343\277\007l\202\330\324\225Y\241@\331j\366:M?\361\210\234R\306\002\206"
+	.string	"\214\"\343\332\223\332\036($I\312\304\252IQ\025b"
+	.string	"\006\"\331\n\n\352\230\230\241\360\352"
+	.string	"\237\314=\351yo.\301P\344\371\330w\306\013n\314\342\273!\nU\337\223\321\356\200K\020\326&/\035\302<U\003\230tH\204\253\207\033\"C\2478"
+	.ascii	"\273\363bp\333\231\2110ycK\277#\006\226*\231\260?aNh&\037\324"
+	.text
+	.section	.gnu.lto_crc8_dvb_s2_sbuf_append.4.716c22442f6af5cc,"e",@progbits
+	.string	"(\265/\375`\224\004]\037"
+	.string	"F\371\307K\240\226U:\204\036\201i\316s$v\336x\256\351.\017\236\b\347W?\306\351?\355\264\376\312b\257CM\021\272\251\232\265\343\267T\341c\343\017c\274\030/MN\013\253 7\250f\030q\350\261\224\257\340F\033\331\020!\233\020\271\223\f\263"
+	.string	"\252"
+	.string	"\265"
+	.string	"\r\320Z\f\232\222\363\312|\037\377\221;q\304e\356]\221\204\272\267\270\200\017\2407\271\370\032{\023\275\314\336\344\0343\225\027]\334\033\215xNZ\356\275\264n\301\350\321\\-\213\347W\347\236\276\\\350i\315\262k\216\357t\002\301\255\242\037\211\247\345Id$\343O|I\245\216\026V\324\223\272\372\032\300\002(\274\253<M\370\254\376\304\027,u\262\252\b{\277\241\212\262"
+	.string	"\"\375Dq\373\372\241\270Y\032\250Z\232\002\363\333\225"
+	.string	"\224\232\234H\177D\265\234z\275\252\241\002\210\364~\362\346RR\226\n\240\360\365\254p\357\345Z\364\003\236_\316\314W\314L\201\271\324\020\266\362\214\255,\203V\216\211\301\300^^\374_g:\273N\374\321C\235\355\221\347\362M\347\266\225\353Y\371"
+	.ascii	",\261\n\347x\257\321\026\227\353\304\214\232q\251\037\352G\376"
+	.ascii	"L\177\023\337\310\245\370S\234>\345~|\024\363\317\217\360\221"
+	.ascii	"tVr\307\2757\275\tU^\244\tF#[\177\336\0044\223\240E\205%\204"
+	.ascii	"\237\344\024\031T\004%I\002\372#\377\211?\344D~^\204\223\224"
+	.ascii	"w\210\005\037WX\367\336\b\350M\001\345e\366\2079\275\371\033"
+	.ascii	"\357\304);x\220{\023\020zi\234\307\245\340\003&\021"
+	.string	"\277;\237\253\247\023b\335[\314\271\311\0015\215\323=f\005\277\351Y\237VKvJ\272\263\207G`cm\323\326\312\216\213\256\226`\312\201ei\272\246+2\303mV\3264}\336\321L\313\272\261(\270L\317\364w\\tu\213c-\323\347.\312{\0301V\2316\033\3237c\223\241\252\305\261\216\351O\275\200\022*^\227>\232\330\202\244\354~\303\364\243^\340\350\b\357Hw&!\200P~\220\275\371\366\005\243\364\204Bu\253u\262v4\272\207\037\276$\b\275\367B\340+\351\341\t \005\306\b{\323\325f\020$\017\242P\335b.\352j\017\231\177\352\254L\341^\301\2143\273\324\371\306\246\006\255L\203V\226\0057\034\210\336\331\251\265[\2559\364th\334m\003\316\307\304\371ph\2561\250\335j\264\036\033\017\217\255F\353\331\331\300C\253\335|h\ffl\003\321\341F\303\331l7ZZ\024z\371\352~\271"
+	.string	"\304\211P\353\030Vk\243\315\354a\247\276\210\005\0205\t~\351\232 \230\205\327%\355!\247=\\0\027\214\033\304\372\352\322e\373NG\257\334P\252| \333\335su\331O\376e\343\024\256h\245x\225h\254m\203\227\r\323\021\244\332\341p\365\220\317\253s\206\001)\243s~\323=.O\234\0131\224\032\246c\335\343$\366\246\373\351\205\361j\250j\225\367\336\213\366\220aV\326\246_1\222f^\250a4\204\bt\006\221\210L \"5Ic`\002\021\272\254\007\020pX\232\024\332\f\032\336\b\322\277FP\366\365z\306\214\r\270p\024\356\211\311\215o\364\272\376\023{\035"
+	.string	"\236\346\210\277\035@\354\ng\250\314\236\017\352\243F\250\330t\204\376\312\220-\322\222\212\3356\202\341\007b\301\341\336fvj\007-\331\351\r\217\024\241hm\233|\325\002\344"
+	.ascii	"\"\0315R^W\021\272\262\335Z\344\371\317_P[\327\373\004.@\367"
+	.ascii	"QIM\277\256j\r\311\f\016\235\270b\200\320\321\236\367\312E\346"
+	.ascii	"\\`\214.1\326\360\301,\206\355\236\203\300\250\031\205\032F@"
+	.ascii	"\036\354\317\264a\304d\203d\372\321-\302\264U?s\362\243\372\223"
+	.ascii	"\036S~\177"
+	.text
+	.section	.gnu.lto_.symbol_nodes.716c22442f6af5cc,"e",@progbits
+	.string	"(\265/\375 \236\275\002"
+	.string	"\364\003\232"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\177\t\260\206\3618\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\001\177\n\354\363\203\007\002\177\013\003\177\f\004\177\r\001\005\177\016\377\037"
+	.string	""
+	.string	"\200\200\200\003\004\005\354\363\203\007\001\204\016"
+	.string	"\b"
+	.ascii	"z\204\356\3412<{HH\034\240]T\264\003\270\323`\216\001"
+	.text
+	.section	.gnu.lto_.refs.716c22442f6af5cc,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.716c22442f6af5cc,"e",@progbits
+	.string	"(\265/\375`\025\b\235."
+	.string	"zV\214\022H\200XN:\377\271<\200r5i\026\024\204i\325\326t+\326|'\023\3530\216e\230\271?VU\b`tk\350rO\334w\224\263c\255\301\260\254\246;\2149\226l\3767C\007q'\236\352\307P\252\027L&O\354\226)\355"
+	.string	"\027\001\034\001\367a\273\317\272\373,\206\204\313tR\236n\033a\310n\366\022\376 %\\\204\313\n\020\325\036\326(\252\243\002\023C\246\233\365i\320\300$\222)\333N\363D(7\367\234;@\350\035\240?\023)\243i\243\324\271\225\265\027n\n\025\261s\362\300\362\314\\\363g\262\237\303X\214\223=\225jm\263n\226\247\227b\254\016\355\232<\306A\230\375\341!\027\232\360^\232d\305\272Y\037\216\225U\327z\315+@\317B\256\223\354\t\277\350\371\347\344%\377\234g\271\347D9\300\371\363\031\375\217\344?ZR\347\3472ru7?+\177>\377o0\177\236\362\177\b"
+	.ascii	"%\316\317k\377\027\374|\377o\240\371\271\310\317\374\037\357"
+	.ascii	"\177\335\177\271\377\312\377p\377\311\3763\375o\373\357\344\177"
+	.ascii	"\201\377\355\377\264\377e\377\223\377}\377\245\374?\227\313\345"
+	.ascii	"\362\347\337\317?\377\311\006\3055\355f\217;\252\3310e\265\335"
+	.ascii	":\252\355z\344\351b\247\335\016k\240\305\365\250\266\255\307"
+	.ascii	"\035\265\035\036\325\342\326\221\247\005\216\0332\246\266\222"
+	.ascii	"4\270\212Z\354\025UYC\343\316\233\312\256\035\327\315fQmL\320"
+	.ascii	"\235\265\032\343\20608\215\370\266\202x6\\\231\355\356\001UD"
+	.ascii	"\256\265\213o\352\217\265\373\007qDW\r\245\354[\347\340\267\324"
+	.ascii	"FVSEu\023\250\352N\271\337\272;\355\356\032c\026\333\035cGEV"
+	.ascii	"Uuc\371TuV\252\026\325}\315\266\244\035\325\226k\rR#\322\"[\212"
+	.ascii	"M\031\331q[F\264M\2074Uw3\035\212<\262\bsM~\302P\230\375q\224"
+	.ascii	"\263\024n\273M\221\355\326&\013\235\226\3315\017p\317iB\241\347"
+	.ascii	"\337\351[.\227K\376\235\274\204\327\230e\300L\316M\330\311i\206"
+	.ascii	"l\263\335\254\357v\2351Bv\315\035\3569/\t\364\314\340\354-\227"
+	.ascii	"\314@--g\207W\222xM4\037^ae\355\3145\237\204&\3413fY\t\233\235"
+	.ascii	"\215\360\221l\327$\303fZW:\204\224\365\222bb\204\334\315\315"
+	.ascii	"q\035^\r\026X\227\222\356\\\227\003\304xe\354\232\034\246\001"
+	.ascii	"\022\271"
+	.string	"vM\006\243\205\013\027\226\3436vcU\360Ae\356\234\261e\256\315\313Y\256E\333d\250m\271&w\341\226\350J\225\023)X\260\2602Cw\367\272g\234!\033\013\353\327\013\303\242\002I\334Yi\323\303\214\326\3245Y\013\263\321\2644\242\334]\223\263\374\213\260\370\005\306SN7+\274;3\364\354\306T\316o,\2771\034\232v\247l[\r\361P\021\204Lce\375|/\216\254_V\316p\277\320\004f\303\351\026\353\356\002l\225b\214\3345\271\n\263\351h\365XS^\363b~\376\333\344pQr\205\3125\317\\\350\357\177\366\320\330\335W4l\033\2118L\303\374\373s\270\307\t\272\367\236\270n\0278\352P/\264\241\214k\376?\320\377\352Ny\232m\243\332n\245j\231\225#\017\3335\004tk\243Uv\353h\256}\233m\356\342\326\261\204\312\256F\225]\323\235\016E\034\222\204J\301\016NNHG\002"
+	.string	"\b=\035}0\001\342\250(I\210\004\302\t\352\b\300}\204B% \360\210(\b\030\004\336\034\250\024LbJ\022\201~\210\350\001Q\321\211\232\027\031E0\212p\276\310((\310\210(\b=QPOx$$\201(\b\025~\004\204\020P\037\226\220\222\202\302'\003orJ\n\002\t\233\232\202@7 \230\222zOG!\240><\235A\241SOxT$dR\202\2529\005\n\027\016p\320\200\001\005B"
+	.ascii	"\006\201@LMKKM@ &%\244% `\360\t\b\202\200\377w\352\246vZ<\256"
+	.ascii	"y\245\206\326\250\253\376J\235\275R>\274\356!3\202\353u\306\""
+	.ascii	"\3574/\221\227K<\242Om\327\356\341Eq\213\277\3043\002f\004>\017"
+	.ascii	"T\\T\247\231\227wSN\032\b\022\225\365\325\215\365\3430[`S\267"
+	.ascii	"\177\323\232.\267\033W\327\344%\337\231(\274\360\326\226\206"
+	.ascii	"\313\256\013\3325\177\257\354n\307x\214e\201\314j.g,lF\2339\343"
+	.ascii	"]\256\267dAw\346\232<\206\357\224+\230\221\27327\310\030tg\320"
+	.ascii	"j^\020\357\002\200\222\250\2610D\224#\210\314\320\210\310(h\222"
+	.ascii	"\034\240\002\221\251\253m\021\240\261\222*\fI\263l\0077`\213"
+	.ascii	"\321\026,)\326X7\274\325\214\324\302\370\002c\265>\345\230V\317"
+	.ascii	"`\240r\324b!m\n\327\325\200\230\336 0\034:h\214\300dW\244\224"
+	.ascii	"\030xY\022\212\312v\224$^\007\230\017(\316\340y\003\254O\317"
+	.ascii	"\246\244\024\203\224\3379\205\320\203\370\303\023\220\213.\234"
+	.ascii	"l\202\345d\346\200\264%v\005=\f\207\330\261\250gB\216\365\305"
+	.ascii	"\262\354\025\346\314\267\\\330\bu\363\346x]\360\ns\354\333(\232"
+	.ascii	"\263\027N\352\347\312\367\253\245{\234\247\240\312\336\350\270"
+	.ascii	"\316\230\224\263u\365\371\310\3441\357^\242F\236\270\244\207"
+	.ascii	"I\217\244\2672\354A\353\004\254.\225o \217\261\370\034\275\177"
+	.ascii	"\243\241\005IV?\210\256\003\3073\035\2472+\t\242\003\255\350"
+	.ascii	"\347\244W<\021\025\314\322\244\177$\214?D\210\356\212/\314\035"
+	.ascii	"}3\023>\267\313\267\337\030\313,\376\331&\003{\2467\230\261l"
+	.ascii	"\363\270;m\337\214\2310\277[\336\006S\312\275?\377`\242\233$"
+	.ascii	"\254\002"
+	.text
+	.section	.gnu.lto_.symtab.716c22442f6af5cc,"e",@progbits
+	.string	"crc16_ccitt"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343"
+	.string	""
+	.string	""
+	.string	"crc16_ccitt_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351"
+	.string	""
+	.string	""
+	.string	"crc8_dvb_s2"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356"
+	.string	""
+	.string	""
+	.string	"crc8_dvb_s2_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364"
+	.string	""
+	.string	""
+	.string	"crc8_dvb_s2_sbuf_append"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374"
+	.string	""
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.716c22442f6af5cc,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,202 @@
+	.file	"encoding.c"
+	.section	.gnu.lto_.profile.9ee9b6ba26cf43fa,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.9ee9b6ba26cf43fa,"e",@progbits
+	.string	"(\265/\375 \034\305"
+	.string	""
+	.string	"\220\020"
+	.string	"\002"
+	.string	"\350\335\352\372\n"
+	.string	"\001\277\261\216\273\n"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.9ee9b6ba26cf43fa,"e",@progbits
+	.string	"(\265/\375 \034\265"
+	.string	""
+	.string	"p\020"
+	.string	"\002"
+	.string	"\001\003\001\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\002"
+	.string	"/al"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.9ee9b6ba26cf43fa,"e",@progbits
+	.string	"(\265/\375 nM\002"
+	.string	"$\003b"
+	.string	"\002"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	"\001"
+	.string	"\001\002\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"\001\300\002e\001"
+	.string	""
+	.string	""
+	.string	"\003\003d"
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	"Y\t"
+	.ascii	"P\355\024\216\231=6\327\365\211\036O\2736\200\005"
+	.text
+	.section	.gnu.lto_.jmpfuncs.9ee9b6ba26cf43fa,"e",@progbits
+	.string	"(\265/\375 \034\265"
+	.string	""
+	.string	"p\020"
+	.string	"\002"
+	.string	"\001\001\003\177\001\003\177\002\001"
+	.string	"\002"
+	.string	")\241l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.9ee9b6ba26cf43fa,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\200\004\001\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.9ee9b6ba26cf43fa,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.9ee9b6ba26cf43fa,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_castFloatBytesToInt.0.9ee9b6ba26cf43fa,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"e\007"
+	.string	"\222N45Po\322\001 ;\263Z\017\345W\365\332e\320\0336\001.W`\366\020\025ICm6 \342\236\334\244\241\230\231!\210\206\265m\303\347\240\302%\373f\311\336r\247\024\0167\305y\260<\r\222\262:\321\222U%\251hy\030\252H]\021\221C`\t\321\271\242\204\224W\314\314\375[\025\251~K\3312\245\360\347\004\002fw\025T5\030 +\231+\331\023\344T\303\376[\025\331\352\254\037\375\356\301\217"
+	.string	"\322\256E\251e7\210\322a\373cgl;\367\221M\f\260\253Rr\262\273\033k0\207\266\375\220\213|\214\275\311\241%dT\220\260\354\316X\360\201\351\360]`:\324\215cw\230\377\221\037d\244\220\006\272\273,\354\256]H\273\270\365\266\rlol{\004\b"
+	.string	"2\241k\037\030"
+	.ascii	"\023\236k\370\r\013W\207p\001Pi:\355$\003"
+	.text
+	.section	.gnu.lto_zigzagEncode.1.9ee9b6ba26cf43fa,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\255\b"
+	.string	"\266P<6@\255\322\0018\353w!\001\353\207\"\377\337\030E{\242o;\331\006!\245\006\250\252}\263\346lDNZ\326\f\303\210\35166\227\2639\220<ls\r\355-eJ\001,"
+	.string	","
+	.string	"+"
+	.string	"\t\253\223G\312\356\0063\027\250\374\271c*\177\232q\321S\344\277\365\202\016\024Tj\364\264(\354\256\023\225\252\270\365\266\rl#\330\026\tNM\337b9\301\224\354R\304^;\362@6l\207\354\213\355\314\263&\034\260{\321\372\330\335\003k"
+	.string	"\376l\373\034_\205,r\233F*w\235`\244\2149\325\271N\026\004wH\305i\352#1\3014wzU\023\323\253\2241{\033\245b\330w\253*\277\263~\247i\325\f\235\210\006\216\304s\266a\320<\0131\323:P\213\237O\314\240\346\341|`\006z\200\233\001G\207\016\bB\304\b\202\227m\357VUO3$-Y\365i\f"
+	.ascii	"2\241\307\037\230\313\004#*4\232\361\307\f\3135\034c\002\227"
+	.ascii	"j<:\204\003~\246\351\264\223\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.9ee9b6ba26cf43fa,"e",@progbits
+	.string	"(\265/\375 65\001"
+	.string	"\3602"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\177\002\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\001\177\003"
+	.string	"\002"
+	.ascii	"\200\206\313\3161"
+	.text
+	.section	.gnu.lto_.refs.9ee9b6ba26cf43fa,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.9ee9b6ba26cf43fa,"e",@progbits
+	.string	"(\265/\375`\311\002\205\027"
+	.string	"v\356\242G\300\030q\341p]\334\356u+Z\0344\207\207\236}Q\265\201'e\243&\306\271\263\f\240\207\233K\261\026\360{;\231\263\2323\036a\340\323\032\202\210\b\350\004\267'\350DTGv\006U\f\216\331N&-M\244Od\n\202"
+	.string	"\211"
+	.string	"\214"
+	.ascii	"\207\221*q\265\332\377\242@\355\266\261\211\316\357\351\2520"
+	.ascii	"9K\325\006"
+	.string	"\332jbD\305}'\035\267\344A\217\373\321\315\f\325Q\350<\377\027K\210;[\\\361\276\r\262@\033d\243\035\342MW\310&Zz\365?j}\234\214>\336\007\263\004\300o\007\200^\205^!FI\371%\330\013O\374\177im\004\332\366@\3036\203\241\355\261]d\233\310\266\220\355\016\266?\333Pl\223\326u]ms\260\215\303\366r\001\247\220\232\247\245\350\230z\224\233Y\322H3u\365cy\3640\245J\262xz;Uez;K\365v\246J\025\035\177\364\\3%\307\222v\353I\225*y^\275\215\252R\325!\024\224{\342b\307\222\366\0255\033i\246ve\212\376\350_\235\316\315\005\277\r5\217\310\236e2\333\255\230%!\321M\377\033\250\315l\240\247\355\312\037\364\377\231\211x-\302\230\356\356\263\273\361\206\355<:\377\201\247\177\355\037\367\273\377\343\377\222iK\037\366\006mn\211\234\372?\373g\300"
+	.string	"k\254;F[\376\302\2662\351\3402e\3103\342%\262\037HX$\247\037\350?\202\325\001\242\373\342}{du\033\264\332\241\024e\232\202E\206\316\373\f\013\275+\020\265\256\353\272+\320ZL\333c\311\017$\336\347\017\241g\203'\315\377,"
+	.string	"\2447g'\320^/\200\335\225-`I\273\340\267M:Y\371ypYB\036Ed\f\017\3461\277\200\232\247\221\247\252D\251\232\251\334\356Tq\322T\225\351\003\257\020\242+\206\301\246&\205\r,\305\311\t,\222x\341\260d\242\210\303\n`\"\224\3056\210\036r^2\024\025d5\342\210\f\262\234\032\327"
+	.string	"\273`8\257\330\313&t\004\231\00623'J\236\241q@\343"
+	.string	"\364\fM\253E#\323\n-\323\"\311@<\200 \213\301J\2360\301\002\314\207\016\032BW\214M\f\026Bt\305^\254\230xs#\272X1X\315\r\313\205\223\303\212A`%J\266(L\025"
+	.string	"\355t\361\001\252\3301\322\226x\213\002\264"
+	.ascii	"\312\341\305\373\254e\211\200T~j\354x\237\327\026z\213\254\352"
+	.ascii	"\315\331\001' @\002C\212\341\354\377\354\325\342\371\230\205"
+	.ascii	"VI,\304\312\231\246%\337\211\277F0\024\226\254\317k\336P\241"
+	.ascii	";\302\230\245T\020r\n\240\261\274\200F\216\315\215\300m\004V"
+	.ascii	"\004h\212\201\370R\331\314\002\033\220if\211\226\233X\247\234"
+	.ascii	"\302$\334\034\354\361\275W\226\3576\226\026\330B\007Y\334\335"
+	.ascii	"\365b\252\f"
+	.text
+	.section	.gnu.lto_.symtab.9ee9b6ba26cf43fa,"e",@progbits
+	.string	"castFloatBytesToInt"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313"
+	.string	""
+	.string	""
+	.string	"zigzagEncode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.9ee9b6ba26cf43fa,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1181 @@
+	.file	"filter.c"
+	.section	.gnu.lto_.profile.e772fbec9bd2f39d,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.e772fbec9bd2f39d,"e",@progbits
+	.string	"(\265/\375`\322\001\205\t"
+	.string	"\244\r\306\002"
+	.string	"\027"
+	.string	"\203\255\266\373\b"
+	.string	"\001\266\260\205\266\f\006\002"
+	.string	"\002\001\263\311\277\326\001\003\370\326\343\301\004\016\004\241\236\345\333\017"
+	.string	"\005\206\223\232\231\013\022\002"
+	.string	"\002\002\006\311\276\204\302\004"
+	.string	"\007\245\233\254\343\013\020\b\344\247\274\230\005\t\266\233\314\211\017\n\n\302\265\230\372\n\032\013\243\352\335\360\007\f\242\233\2154\016\002\003\002\004\002\005\002\004\002\006"
+	.string	"\005\002\004\r\342\377\371\206\002\016\322\342\227\340\n\f"
+	.string	"\002"
+	.string	"\005\002\004\017\364\213\236\231\b\030\003"
+	.string	"\020\370\233\266\355\004\026\002\005\002\007\002\006\002\007\002\b\002\b\002\003\002\007\002\t\002\t\021\307\252\331\263\003\022\346\306\223\235\b\n\023\226\255\246\372\017\024\367\252\201\351\t\b\025\207\223\351\200\017\002\002\n\002\013\026\302\324\276\264\013\026\002"
+	.string	"\002\013\n"
+	.string	""
+	.ascii	"& \220\202!\302;\247\024\270wt\204\rB#\256\347\205E\266\"\033"
+	.ascii	"d\004\b\3422\214,\345K\230\261f_C\316\2419\363\215\346\270\""
+	.ascii	"`\037bO\303\002i\306pO\356Z\273K\266\247\006hP\200\233h\243\036"
+	.ascii	"\213\n\256\210G\210\rgl\217\376%\024\312\r"
+	.text
+	.section	.gnu.lto_.ipa_sra.e772fbec9bd2f39d,"e",@progbits
+	.string	"(\265/\375`0\001\245\006"
+	.ascii	"\342\310\027\030\2407\303\001\372\377\377\2779\0345\221\331\337"
+	.ascii	"\377n\262\264\311\336[\312$\003K\225\2364\241\365\312Y#B^h2\326"
+	.ascii	"!\201\353\240\207YN\020\017\256T\242\342jeA\364\242`\006\220"
+	.ascii	"\335\321Q\032\200O\261z;?Ql\277\035\315hbkM\007\376P\3039\256"
+	.ascii	"o\373\364\264\274\027\215\031\r\0015 \200\202\031R\363>2\342"
+	.ascii	"\2322\3704\200\023Q\254\360\177\304\330\350\261\316\204\002\375"
+	.ascii	"+X:d\355\335\260\372\344o\3266|\261\334\205t\177\177$\023\322"
+	.ascii	"\272mmc\036>\023\304\212!1\022\200\226\200O\250j\004\200\"\220"
+	.ascii	"<\224j\005\007D5\201a8(I\351\t\n\254:G\227\240\211\273h\373a"
+	.ascii	",\026$X2\224\024\222\020\022\032\216\013\007\\\270!"
+	.text
+	.section	.gnu.lto_.inline.e772fbec9bd2f39d,"e",@progbits
+	.string	"(\265/\375`<\r}%"
+	.string	"\366\253\205A"
+	.string	"q\224tx\256\211$kv\327\2766[\307\007\026\310)\021H\320\364\355\020e@eb\034\315\244\032<\334z\210\217\276\225]\242\322\017\367KS\311Mg\334n\275k^\213\177\340\217\206\366\t\221;\005b"
+	.string	"q"
+	.string	"x"
+	.ascii	"\245\323\033\211\270\337\365+u\313<\275\255-\326\223\\\346\321"
+	.ascii	"e\231[\305\337\004\235\206\\\355L\275\221y\362\354\fLj~\326\272"
+	.ascii	"e\335\367\273\275\374\b\255\3071w\247n\267\373hV\363"
+	.string	"\376\350\226\231\317\2452\223\3435\347\336\337)\266\210\335\231\334Ifb\306o\365\0252\363\364}Gjf\246\373\001s@\001;\b\035\341\2600\354\272\356\bKM\314\315-\205$\316\344:\276`\b\025BY*T\365p\373=\321\317\302mkd\211\266D_\017\232\027n_\243\346\245^\343\366GS\242\261\265\226\034Ifv\036\202\003\221\231\036\315\337Q|\003(:\250:\032\362.;\020W\222\231\240-\207P\350B\2507\317\324\024\353Y\256\342\335\201\324Bf\006\370a*\313@\277.\203I\t\032 \315\2739,\021\032Mq\313.\202\233\341A\005E\301\327Oz\332\311\211\262\f\204a\315R3\327X\202Y\311\350xLz\330-\205'n\016g\316\234\r\206P\350\336\006GSS4\025\207\307ad\255\024\032,\3000\003k%0f\n\263R\031\004+\036\271\226\231y/+Uf\336\346\305\225\024&f\2261"
+	.string	"i\326z\340\246h\314\215!0\3465\263\305\005\377+\230\324w\362X\353\213\024\02668o\252\t\f\r$\n`>\242O\361w\001\206\006\022\007\026\340H\312i\267"
+	.string	"\022\212a\367=\300\255kkt\352\327uB\202#\320\323\th\252<\r\331\262\3423^\306\222\315\346\311\026\301.u\004J\213\033Ns%)6t\300/\f.FE\f\325\203\264\006\013\224\017\0022\034\0211j\2040\361\031\300#\035?<\313>*\242b\202\242_{P19\2419\247e\204\201B\250QM\246hD\222\202\024$\303\001\021\205\312(\304,u\007\022\300C)\b\304T\031\222\021\221@D$IYI\235\345\300\326\211\243\250\341\374\2434\264\300\242k\231\362fQ(#\235L\332)\022\b\363\fl\035\270\247A\005\316\005=g\246\332\240\217s\316\021I\201\216\317\253`\261\336\027\210U\271n\245\322\367\\\":\035\0369{z\210\361!Q\023\377\003\205\217\006<!M\r&\002\207H\235\210\354\203\202s\222:I\353\374-\317Ln1P\027T\255S s\361\301\225W"
+	.string	"\373\233\220\004!\357k\250\307\242r\347+\374`\276\026;\361\026\3342\231\314\243N\214\355%\304elk\225\327q\310\260f\222\222;L\270\b\335;x\207f-o47\270.\363H\006\243\241\201\300\235#\002l\274z{\020\250\211\0131\212\273\265\235\223\372\272\375\317\030\201?R\214\367\262\301ANj2\200PhX\220\023\260,\006\232'\203\263\204\251\372T\217U\230E\0021\246\260\257\203:\313m\345\366\023$\337"
+	.string	"\b\257\370\0056\t\027P\003\005(\325\221\253'\036\f(\341\023\221\352\033\264\020\215\371\330\233\3336\274\267Xw\310\273\301\006\274\303Y\235\263W\320\321\332\r\316\264\247\250w\267\372\261iyM\007~\223j\034x/2M\334\276\223\253L\341P\026\f\363\342|5\253\021>Z\365c\260\320\345\352Q<"
+	.string	"\256=\364<ffI\220]\"f\250\023!:\322\340\033\277\212\307\213*\266\2124\351\005v\023{\324\342\0040\030|\217\314\365\307<\032q\300\254\344\203'N\253'M?\030.\246\004\221\222\215\357\202\r\375\302\311(\332\013@\021\306?\017\326|1\301v\261\360Q/FtE,\361@^:\224W\270\265_%\333^I\272^\200\373"
+	.string	"6\242\266\320{\350\n\247T\204\237\225c\210\221\240"
+	.ascii	"a\b\322\272\205\205n\026\261%F\350cV\240\206DE\030\276\377\255"
+	.ascii	"\253\005\337\366J\362sl\350Q\336\214\36113\221\303\333Y\365\352"
+	.ascii	"\0357\221~\364\244\344\021\030x)\024\2268\242v\344\026\024\371"
+	.ascii	"rF\365\260JDn\240U\264h+\rtd\342\021\315\340\234\222\202e\264"
+	.ascii	"\207c{\2003K\020{\024Ax\272b\263\036\022\2103\321T\245\005\230"
+	.ascii	"\316\226\bY\033\303\217$8\363\2405\221\033\354N\321J\276RZh\313"
+	.ascii	"\036\265\023\022\037\264\304\303t\321\327\026e\275\276@\301x"
+	.ascii	"(\334*^@\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e772fbec9bd2f39d,"e",@progbits
+	.string	"(\265/\375`\362\001\225\t"
+	.string	"b\316)(\240'\351`\305c\244\245^\232m\305\305\377\257m\227\376\272*^\231\311\275\327v[K\b\021\362\0335\3336!r\247\224\002<\237\361\033\016\343?\030\003\002\215\257L\350\346G\231\251u\356|k\332\32024@MX>,\256\232\320Q/\215\337X0\212\363\317"
+	.string	"d#\275#a\267t{\256$(\262\007\213\025 \021\b\336Zk\225\276\335\310\333$\254I\312\362\246\200\334s\355\032,\017\344\237o_\255*\n\273P\033\035\032\221\206\020E\220\002\233\343;\326\325\266\226\356Z\373\374\306\257\377h\233z>\303\\\264&\001\035\021; p\002)Cf\036P\204 \311]\363Mv^\247c\026s\366\033\274\257`\037\330\003d\331\260\241\241a\037\314\007\006$B\320_\007b\357\225K\326\fU\r\020q\272\273\216\027-h+<\0330\221YP\335\030$:\013\254\300\030b\360\213\017\301\226\343\016\353\326\320\326\\.\3029\031\206\037\303\271\211\007-&\300\320k\264D\242p\316\200\035\334\002Ln\274\004\331\220G\013\340\342\362\200\244\336\020\341"
+	.ascii	">\007\301\373\n0\004"
+	.text
+	.section	.gnu.lto_.pureconst.e772fbec9bd2f39d,"e",@progbits
+	.string	"(\265/\375 J\375\001"
+	.string	"\242\304\016\030\220U\215\001o\214633\207ff\214\003\332\266m\333\266mk\332\232\f\016\360\312\243\274\311\223<\362 \177\334\361\306\031_\\\361\304\021?\034\030^\270t\302\007\027\\\02603A"
+	.text
+	.section	.gnu.lto_.ipa_modref.e772fbec9bd2f39d,"e",@progbits
+	.string	"(\265/\375`\234\003\265\f"
+	.string	"\026\3200,\200)I\0073\300\"Af\"\212\305\252\346r@\313\\\346\036\002 \027H@\034\201k\2555\3307\240\337\366\006\364\033\261\2665\"e\n\""
+	.string	"&"
+	.string	"#"
+	.string	"\024i\361e\020\303<WtW\226\364\335\327\356J\373\321Qt7\347N9B9\221x\373\343\305/\020\001\nll\\\267GO\335e\210\300\267\333\215Q@\031\0040\031\331\354^\232'\251\271\270\310\310\240\207a$T\264\305\002\377l\2247\332\250>\351H\323O\341\363d\302\365\024brVt\252\024\031\244])J\314U!e\007\032\001348,0\337\335\034u\036\356h\336%e\037\337\235\243\\r\240\034\177D\217,\215\006M\217\314X\224\026\020\004_\250Q\261\203\212\212\013\205\345p\002\221\261:;\022"
+	.string	"\204-\311\222H2D\201\211\202\224\324\377\350q{`;@\245\355\234\376\234\371"
+	.ascii	"I\013\356\372\026\fL\365.\003 \rA\013\036\236\213\023\007\277"
+	.ascii	"\301\372\363\344\315\210\362;Bt2\370\311\257\376b\322%\337\370"
+	.ascii	"\316V_6\241\337\241S\345k\376\035!\244Ybg\376_\322y\360t!\226"
+	.ascii	"\356\r\252\0047W\336rkf\3411Ms\"\020\364\262h\326\252\017\f\032"
+	.ascii	"m\367\220\016\252\332\2028\340R\307\022\232L\033LwD\213\223\333"
+	.ascii	"5\301\226\232<=j\323\021\016\360\252p\034Q\2506\262P\t\337\302"
+	.ascii	"\213\\.\325,b\"v\013\377\006|QA\243\272y\357\020l2\240\021\341"
+	.ascii	"/B{3\035\234E\n"
+	.text
+	.section	.gnu.lto_.lto.e772fbec9bd2f39d,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_nullFilterApply.4.e772fbec9bd2f39d,"e",@progbits
+	.string	"(\265/\375`)"
+	.string	"\275\007"
+	.string	"r\01767@o\222\016\230.\221\361\247s\006@\237\231\255hH\003\357\300\352`\022\251\206\231]\356\265\315\255\217\203\263\221\303\360\350z \003B \316\250G5\267\333\216\326\032!2\005\242\210\020\310c]g\234\255#z\3608D\220\366\371hY\004y\032>1\333 \"\247`-\324\331\242H\323\266\210\375w\331*\241i\250\221\200\023\337\215\036\314\370V\tM\337S[\230Q\031@\311\274xq\311\024\253d\343\357\317=\366\277\327\323\2503\231&'\251\314\334\234\320\367\375(\b\327\356\225\006d\232<R\231\335f\004L\255;\314\1779\332\301=\212\201\002\263 \251\030i\311\314\250)\301U\253\252\300U\013j\224\353\343nCj \302B*\215\372"
+	.string	"\0262\363G*at\330\377\340W\370O\001\n"
+	.ascii	"\322\032h41\264\n\3075\0344\013\345\022\022\034\224e\320D\217"
+	.ascii	"\222\322\271&\031"
+	.text
+	.section	.gnu.lto_pt1FilterInit.5.e772fbec9bd2f39d,"e",@progbits
+	.string	"(\265/\375`)\001\025\r"
+	.string	"v\331XB\020\221\223\016\370a\277\277\236\t@\224\300\315\306\325(\202\330j\021\304\252@&$\020C\n\n"
+	.string	"F\373\270\216\003{\006SOj\020\"\200\002"
+	.string	""
+	.string	"F\363:,\372\240\212\025\366)\215\2355\211'{K\231RD"
+	.string	"B"
+	.string	"G"
+	.ascii	"\t\236\366E|\204\366\224\220\013\330%\255\260\354v\036#\250\036"
+	.ascii	"\335\235C=V\037@"
+	.string	"=Z\263e\020\320\020\240\005I\311\306\356Z\372\341\332S\363_:\206+\021y\002\200\260\273N\256\204\303\255\267\335\261\355\300>\211\276\312\237y\312_\275\373)\230\2160\raZa:5\375\315f\343\274\330\335\360\235\326\213+Pl_c\033\226\270\t\355*6\031\263\313\342\205ew=nP=\032\200\232\266\202\005\332;\f\326]\223\030\001(\016\240\204\350\240j\177|\305\246jw\031\370'B \033\030 B\250\307,q.\2516\335\303\311\363\326\017\276\357\224aw\324Q\375\3262\222\237\257\251\337hPz\2155f\220\274\214\362\263;\221\324\023\373pw\327Jr\021(\244\b\344\222\320\021)_\237\214CT\301\243\303\na \020vY!\217\t \353\312>\254O\001c\02682K\204a\231\245\351\366p\225\344\250\302\033\351\210\243\332\330S\374\006\347\0025\243Q\325\305\326\242\nUs\362m&\031\265/<\030"
+	.ascii	"i\231\"\023\357\361\242\305\005\025>\023\301\"\23193\016\314"
+	.ascii	"QO65\316Y\273hc\034\252!\207\320\003\314\005\f\027\216~\030\035"
+	.ascii	"\210\001W@\302X07@E\twx\321N2"
+	.text
+	.section	.gnu.lto_pt1FilterApply.6.e772fbec9bd2f39d,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"\205\013"
+	.string	"\346\025NA \213*\035\230\002B\264\033\021\036\r\370t\342\317V\004\006TK\357%\034\177F@: \240\335\007\333\260\025Z`\361\202\245M\243\250\006"
+	.string	"\030\030\212H\307\230\332\037\27276\216p\243\310'\233H\231R:"
+	.string	"9"
+	.string	";"
+	.string	"\333\243\301\315\266\017\341\021>\273\345\001\200\"\300C"
+	.string	"V\210\335\3452n\241=f\257\320\036\025\301\277\347\347\177\302-\007>\234P\243\347\244cw\235'\024\201[o\333b;c\177$\351\230\351,\323\232\351\314\364'*\034.6\354\016\bE,,bX`\373\263)\2663\277r\313\022\273\031b\256\335\275x\343i_u\t\337A\321)vS\027\\\273\340\305\032\001\251\231\306\021\246\006\245\f}\335Tu\30221(\205^!\365\0223\311)\270\225\361Y\237\222mw\257@\244=^9\034<P\2212\264\301Q\252\001\373\331j\312\376\352\337\016\376\223\f\240\320\307\303\211\2325\030o\003\n\341\200p\236\256\323\3514\234\207\363\321\3414\236\b\207\301p\367\331x\034\250\353<\216\002\356\355\250O\240\001F\322\222\243Z\250tx\235@\2202t\246\327\250\331\313T@5\025"
+	.ascii	"i\231\"34\030!hB!\270qp\334\t\264\212\031\003\\\256(\232\231"
+	.ascii	"\302\322\262\224`\354r\r'\246\005\374X8\225\220K\240\314A\273"
+	.ascii	"=JJ\347\232d"
+	.text
+	.section	.gnu.lto_pt1FilterApply4.7.e772fbec9bd2f39d,"e",@progbits
+	.string	"(\265/\375`}\002\265\022"
+	.string	"FcyG\340\360&\035\3022\351\031\032\277F\217\364\202\0079\330%\250\206Q\201\372\300U\004\b\022\b\312\3347\027 \036\243\2360n\252\033\002\275Ij\003s\230G,&P7C\300p"
+	.string	"\324\211]\202\326\316h4B\b\331R\246\024a"
+	.string	"["
+	.string	"i"
+	.string	"\273kb\224\247\375\330U\264.\233\371iW\347\005\320\256\314\304\006\274o\226y\266\375\023G\321\262g\r,|\030\224n|\224v\027$\371\b\367->"
+	.string	"\367MA\274\365\250\331\362;\225(\324A\306\013F\363\270\341\372\001\263\211$\273{\026O\034\230+\263S\331]\347\013\246\341\336n\333\201\355\024;\217\002\366\343\356\256U\307>\317/\362\237\377\364\236\037\344\262\377#\323_\246=2m\312\264\227\351.\323\\\246\267L\307LkLg\246/"
+	.ascii	"\345g\300l7Cmii[\220\b\333-\373\263\177<\213!\213\343\312a\020"
+	.ascii	"\323F\220\240\365\236\n\017Y\327\214\013\0132\317\343\231M\273"
+	.ascii	"C5\200\002\321'$\212\272\351gt#\3149\251M\341@\007b8<D"
+	.string	"\205\001r\2244^I\252\236\375\303\022\215\266N\251\325\226lvkJ\242>$re\315\251\252\017m\200hjg\302\350fG\356.\215\352\216g\266\263\344\272\262\002\311&s\330\216\271\013\317\274\335U\340\267X\221\361B\314p\337\256\005R\340\210\325d\315\226\321\244\356\004\017$$K\006\005\241ec\311\300\274\270l\234Q'+\026\326\004\227\026\360E\225J\251P\340\213K\204\024\210Z\305\200'\004\254\202aY\201,\225j\005~\262}\\\325\371t$\344@\253Q\227?\035\002\340\241\235~\032\213\302\034\223z\352\241\233\216\260D\247\"j\322\316'\034\021\303S\023\244\230\235\272P\247\035\211\236\310\251\255zP\026\275\2226=)\247\001. `\002\021Bg\007\251\246\b\342\301.\032\341\202\306\007B\356\232\202\250\201\342\201\n\0024\005\267HZ#\2535B\353G\232U\321n\236\020\264H0\247=0|r4\274\305"
+	.ascii	"\361\366;3\324\220\r\367\320^\262a/\212\t\tR\210\337\026V\264"
+	.ascii	"\306\364\021 Fr\217\340\207\365\314\r\r\270r.\301\314i7\216\002"
+	.ascii	"\242\307)\260\306v\2512"
+	.text
+	.section	.gnu.lto_filterGetNotchQ.8.e772fbec9bd2f39d,"e",@progbits
+	.string	"(\265/\375`o\001\375\r"
+	.string	"\266[^B\020\2176\035\244i\242\022\341sRB\346\307\006\333\"\ta\304\370r\241C\250\206\034P\344QW\374\366K$\252!\365\276oy\224_UU]#\013TB\200\035\342U\232\316U\231\225\224\032m\222dJ\001M"
+	.string	"G"
+	.string	"I"
+	.string	"&\341\022\036\177\023\nc\324p\"E\214_\202\036\260\f9\262m=\302*\236\2264}\036>\270\305B\205\021\214\030c\226q"
+	.string	"\312p2"
+	.ascii	"\312\360\035\354"
+	.string	"qzj\217\fQ2\230\b\235|\234\025\203\030c3t\202\301\275\333\032h\333\240u\214\305<\213Y\344^^\2615\374\331\326\263\325\263\324\263\360\331\351\331?\233\317z\303r\2412c\300\213\030MJ2\"\013T\001\302\"\273\365\324\243b\265\250$\353sA\200\327b\362\022cD`\330\005\326\212\213\002\313\260\231m\230\333K\311\353-\007B9\004\277\341\211`\241\360OKr\247\222\030A\005\246_7\013/\205\312\277\025\221@94=S\362O\363\376\237.\336\n\222,U\343yjd\335\037A)y/\240,\265\337'\317\241\365\024\277\241}\006!\333\210GG\343*\215\206\353\210h\024\310\3269\350\266\016g\323\256j\035\335\326\201\360\241\3118\334f\303i\031\347\303c\223i]H\326A\240\\\204\255\313:\034\327e\330\027\335b\317\200N\322\352\324\261O-\022\276z5\362B`\211\271Q\270}@=s=\033"
+	.string	"2\003\302\260\b\033\3603\227\201f\320\361\217\355G\254\243\204\004F\303\260\341\032\220\242\214\013@\206\253\036\312\0220\007pMt\0246\342\320\202\271F\361\022\002"
+	.ascii	"s`0\0015\004\234xR\255\230\204I\006"
+	.text
+	.section	.gnu.lto_biquadFilterInitLPF.9.e772fbec9bd2f39d,"e",@progbits
+	.string	"(\265/\375`\217"
+	.string	"-\n"
+	.string	"\246SF;@\305\2521\340In}~\002\367\272Az8\225\223\f\317\352\310\237I\350p\201\2207\324\376Q!F\230\346\232Dw\227\037N\267\226N\207\260\305\262\344\340\217\300\327\377\337{K\231R2"
+	.string	"6"
+	.string	"3"
+	.string	"\030s\035\215\320\231\303\370\2403W\261%\340\261\344^\001\341\210\325\376{\223\304\242\245X;\346\214j\205\262\274<\374\257T\255<\334\351\266\234\266\020\2557\001\3578`\3404\216\305\244\2555m'\fc+\370\206H\210\203\034\255\"\372UY3\177Km\366\277\323\006\2149\205\315\262u\313(\242]\0316\370Y"
+	.string	"f\377\330)C\246\2562\237\244Z\264w\373S\234m\316)gkq!\255\352\302\200"
+	.string	"\377\230\250vD\3119\322z\373\377NVk\230\275\371eO\273l\331u.\001\233\002\017\337\t\024!a\372B\321\027j*\276\360C\3205\344\t\277\323\304H\344\225@\022\t\fy\245\021\210\344\205B\223\347I(H\361\205\336\t\004CO3\336\333'\253\237\024Zjj\364\"\353\020"
+	.string	"*C\244e\212L\274\016\032\r.\304T\335<\256\261\001f<\240J\204\021%\304\r\304"
+	.ascii	"W\244\251)\340./\332I\006"
+	.text
+	.section	.gnu.lto_biquadFilterInit.10.e772fbec9bd2f39d,"e",@progbits
+	.string	"(\265/\375`\305\bU'"
+	.string	"\272E\364\016E\200\236M:St\004\242\244\006#NV7\030\274Mj\321\371#1l\373d'\300 WQ\361\310\352\360p\305\372&Yn\312\264\263\017\302P$w\004\351&^\246\360\302{M\216_\277\367K\243\rB\210\334)\005\336"
+	.string	"\306"
+	.string	"\336"
+	.string	"\267\331\377\327\277\334\3700\037\373\230\223y\231\237\335\214\207\320\264\242\314\234\020{e5\226\200O\210Od5\202H\240\340i!\206\310\n\261&\2730*(\300|\231"
+	.ascii	"\263q\351,\214\204\355\305\306\332\017\310\315j\r\027\236Z+\204"
+	.ascii	"\227\036a\223]l\314\371\300\305F\262\250\n\251\254xX-8\310\242"
+	.ascii	"\nDb\225\201\026\217"
+	.string	"E\352Yl\264P\255eu\302j\255\021L\241\366r\211<\265_\345V\244~%\307\007\324\212e\f\253\265\030\301\017j/]|\001\363e\355F\346KK\331v^\314\252\357b\262c\013\237Z\253n\227\\\352fI.\225\362i\226W\260\352w3W*\235\2217sr\253\b\232`\225\220\257\016 \225YTk\265U\235$\r\342Pk5\rV\005\271\203n{\206\355\033v-,.\260\27373*z$\215v\367\206\325\361\351hM\264\032%\260\366\214(\363A\2435p\236\245\001\367g\033/&\207GZ\365\206\343\361\f\260\326)\006t\t,\3752`\277t\177nQ\321\243\213\366kZY\2759\361L\321\243]\374\235\254\233\304>Y\027\313\376\225\277\301\002\005K\trJ\270$$\004\007\336\3457p\262\373v.\177\201\227\335G7\273\215\216v\023x\226\177\300\265\374E\367r\0138\330\035\340`n\242\207\335"
+	.ascii	".v\017]\314m\243\324B\224\272F\251\203(\265I\251KJMR\352\245"
+	.ascii	"\324\224R_\202\rH\032$2\265\3768\376\251i\245\030\224{\371\301"
+	.ascii	"~0\177\330/\366\213\371\311\376\262\337\354G\013MWhjk;\321\032"
+	.ascii	"`k\333tE&hm\336\003\001\330\240m\2722\232k\267\370\237\2415\267"
+	.ascii	"\351\312\3534+\327~q?6\326j\255\026\374>RQ`\020\301\321\312a"
+	.ascii	"\276\244[\202Dk\333r\233\206\307\323L\315O\232I\233\033;\211"
+	.ascii	"H\233\373:\267\020l\256\353\034\336\366\300^0r<\363L\3119\365"
+	.ascii	"\342*s\2534v\022\225V\251\353\034\342\366B\221=\347\326\233S"
+	.ascii	"\257!"
+	.string	"\344m\027,n\354$b\035\255\202\305}\335viq]\3470\301\276\315\271u\264\024Hn\b\"wN\342\331\334\344\223\366\243\200\354\342\357\273I\3749>\035\212\006\307\217s0b=\322\306wc;\265Z\177\037\3726\314\227\246\301JU\205Xku\3605\376\260\226U\201\324bu\360\322\300R.{\322t\320@\001\273\026\274'\250RF\024\215r\242;\027\275\030\273r\202\nJA\005\255\240\202N\330Q\n;ZaGy=\034\"@\234Gc\027\302E\024\317\307\202\347\033\232\301\363u\260\231v\222\340\343\321\210\361\202\205N\006\324\323\023\224\223N\306\213\335\223\316\311\027\245\223\220d\250\036\317\247\243\001\005\345\323\r\025\353\311\272X\326\240\244LZ&%dn{\\Ov\301\256\226\200\025j\020R\"-\223\020\256\341*X\032`\205\032\316\022\3012\235\244\322\366\270|\354\322R\242\0252\351)\017,\006=\201\350"
+	.string	"X!\223\233\022\203\033\022\267=)v\226\334k\r\255\220\211\254\274-\0062\262'\345\314&\330\030R\206\324\266B\333\376P\2256\265T\246\301\333%h\017\023\224\007\037\252\343\366\t\272\303F\333\224\201\235\202\002qYAa\216S\370\b\255\275\243S\002Vh\003\200\232\250QXf\220QldD\244 I\222\326\300\002\221)\2536\022\340\0041S\032\206\bI1sIA\214\n7\003X\024\321;R\252\352&\374gy\now\324m\302\230d\304J\254'\3708n\335\234\023\352\250\317\231\036&\036\255,\246\344)\337\207Y\377\371Nb-\321(\216R1\350\226\274H\256=@f\037\003M)\201\251Si\217\001l\306\250@\204`\274U\330\255\216V\226\301R\345\253 8i\317]\275,\367\334\212\362\260&\230c\310\254\"\310Y\"ruAY\371B>n\307\251\367\374^\312\262\265\223\234bS;5\004l\357"
+	.ascii	"-wl'\344{\027]\354\225\336\330\301\305\314B\275s\020\270'\264"
+	.ascii	"CMI\252}`\371\217\362\310v8Q[6vp\332\304\302n\222\353:\037^\201"
+	.ascii	"0\2478\217\f\2160\274#\n\030q\367\034\372It\223\313J\204\004"
+	.ascii	"2\315$\223$p\217e\337<\376$\250\316CA]g\3656\322\231<\027\363"
+	.ascii	"\202\351S\220\215\362\2174X\025\364>\017I\352;9m\227\005L\207"
+	.ascii	"\241\303\322?"
+	.text
+	.section	.gnu.lto_biquadFilterUpdate.11.e772fbec9bd2f39d,"e",@progbits
+	.string	"(\265/\375`\264\002\275\021"
+	.string	"&\037pI\320\322(\035 \207\301n\316@\300P\003\b/\032\375\371\f<\"+=b\355&\357Qo\274\344\206\366v\005\366V\275k\377e\210HQ\036Y?d\213="
+	.string	"\344t$']\203$\223\353\352a;d]fK>!D\356\224\002U"
+	.string	"a"
+	.string	"U"
+	.ascii	":.]\332%\nb\333]\022\247\276w#\334\247}\030\217\001{\216\313"
+	.ascii	"\005\354\332\340\260\355\222$f\360\2753y\002\336\273\357\003"
+	.ascii	"\274w\206\331@N\336\354yd#x\206\354.\250,\016\373\204\371\007"
+	.ascii	"zIF\023\373$A\330]O\031\315\211[o\033\201m\r\266&\b\257\335\334"
+	.ascii	"m9\377D\231\202\216\024\024\355\316\024!\262F]"
+	.string	"\220\213\377\374\264\277\366\333\316\331\177\215\333xy \237l$2\324J`\240\271\034\211A\255L\210\231\027\027\354\037\227_\314D\001\021=j\204\354n\203w\266`s>\037~\234\364\270\344P+\003#C\202\356\2748\324\306\244@\361`\222\237\001{j\2578\314\313\274`\205\216\255\321\230m\326sx\2528\264\231x\242\356\306\362\033\234*\016\215\231[\037r\371\355\256\003_\b\204\007\0037-\\\274w\252\212\323s\313y\231El26U\205}nw\327jc\337\3477\275\347/}\347\377\256\363\223\376s{\247\335]\251\226i\3222S\257i\362\232\341\312\253\302\204\207.\024\n\033Z\341\230\022\216'\226p\214`\362\254*\031CW\207U\n\250\"\262X\242\nTY\241\260@\325\330\002K\016X\\\tG\320%\212#x\"\367j\343\023!\243\027\205\261\247<\206f\235\036\3358-*g\252;\002\370x\251\335j"
+	.string	"L\223\226\364S\222\3168 "
+	.ascii	"\003\031\261\361\330s\020\f\221\302)\342\241\225\245qdtL\300"
+	.ascii	"\252\r\251\264\230@\002\027\251`L\300\252\r\251\264\230@\024"
+	.ascii	"\307'\210\304!x~!\033\177-+s\250\037r\034[\276!Df\b\345\317f"
+	.ascii	"\251\0049z\233a\211$\256d\237|\357\244\223\316d\265!\276\355"
+	.ascii	",G\333&\261;y>\236\226\201%\336\210r\334\304\350\212\264:\005"
+	.ascii	"\362\345E\353\311"
+	.text
+	.section	.gnu.lto_biquadFilterUpdateLPF.12.e772fbec9bd2f39d,"e",@progbits
+	.string	"(\265/\375`\007\003\375\022"
+	.string	"\206avG\32005\035X-\001zc\202(\2321K\235}\325\277\240T\223\251R\261\201\275\323\242\033\254\340\213%\300\005#o2\260\302\203\223\314\375\005\304R/\372\342\007h\r\027\200\231\021\302\\2\"`\366\327\323\332\2266\331;\245["
+	.string	"f"
+	.string	"\\"
+	.string	"\037<(\230\343S\204\0372\351\216]\0268\312\335\035q\311\366\032\222}\332\017:\212\360B3\017\260\353\023U\356\216#\026\331^=~\200\366\272]\200\366\352\320\256\361\361g\377\032\241\341ucw;*\342\341g\350\377\365\016\034\036\232\317\325\202\335\365\304\341\351p\323\333f\331\216`\323\233"
+	.ascii	"<\242^\210\320\330\335\251\312\261S\025V\342N?\354o\372\313g"
+	.ascii	"\366}\362\245\337t\330\235\376d\216i)G)I\007)\374Q\b\363\"\237"
+	.ascii	"@q0\376\321\221\256t&sK9\020\222t\036\2500\031b"
+	.string	"\003\262\033nvL8\260andr\243\341@ \203\214\036\033\273\213\340\325\r\266\327s\266)\221L\006\2626\001\324/W(\314\343\370@\210\250\355\2414\255Km\224\002)\271\276\273X\305Z\336B\243\024\310\310\365\322._a\262\300\317\356&\360\2410\\\360I\274\3723\332k\245\177:\013\250(&$\316*{\254\231\024\204\375l\251\217\375\362\336\336t\257\016\273\265;\335\365D\177\366\241\237^\350\237\001%1\323$f\226\310L\023\231\351\275\240\234Lp\361@\025\017\344Z<\220\201\207\346\024\022\320{\251\260\242\322\261|\255\326\227\322\261\254\240\264\272\024\320\245#1\340\317\202\007v/\337\007v\334(\376\365\rIjJ\2445\336(\325\223kEg\3044\032\203tU\n\303\344\007U\025\231b=\037\323\227\240\231\374\t1hj\235\355\212\254\214R:\003? \360\002\021\261\235\003\312C\244y\212\b\355\216\354\311"
+	.string	"\b\212\354}](6\025\354\271\230^\230\033\366\nl\264\231\245\365|=\r\362r\314\024J\342\004\243/\210\301\257e\021\316\330\341\037k\332\031\343\365\241\005\313d\201\\\303f\0219\320\230\227p\314\320\303@H\303\n\f\204\022\256H\b\333 \235K\030B\312\363\030\257H:)g\212V\253\201\030\360\366"
+	.ascii	"\035gD1nbtE\232\237\002\342\362\242\205d"
+	.text
+	.section	.gnu.lto_biquadFilterUpdateNotch.13.e772fbec9bd2f39d,"e",@progbits
+	.string	"(\265/\375`\203\002\205\021"
+	.string	"\006`pG\360\320&\0350\376\373c\204a\"\356\223v\271O7\343\323\331\247&\316\2607\302F\345J}\377~\007\0272A%\237\277\251u\322\033#\356\036\206\311(\234\234.|\\%oG\314\233\267(2\346\260D\032\331D\312\224\002V"
+	.string	"\\"
+	.string	"Y"
+	.string	"'X\327\361\314\335\356\020\222\320\356\222\030\001\367\030\242=\355\337\034\207\365\034\227\013\330\215\305\020\332\rIl\200{t\370\001\333#w\220\355\321,\333\306C\022{\036\023\032xr\354\256\247#\316z\262\374\003\275{\311\274<K\013v\327\371\222\351p\353m\213\330\206`\353\026;\277\307s~"
+	.string	"\367\271M\377\271\273\367\374\334u\376R\246\267L\307Lk\231\326Lg\246\017\322\001\2231B\264\273!\ti\213\342\212\022\367\371\177\236\342@\356\370i\t\201\371\330\230\f75\016l\237\026\356\205\003\201\327\f\016\216\335\035yt\003\367\3340\330\361L\373\330\230V\b\005\031></#-\246\252\351=\324\244\252\377 C\341\2621\251}\341*<\343v7\201/t\202!@\215\335\275\314e{\214 \321\021\f\314$\247\232\022\246\323\324\303hn\270Dpz\3554\203\\/f\267\266\013\212\224\364z\01744\\6\255L\262\303\227\324\031\373\332\356\2565f?\247\n+)\247\250:p\322\t_}(\356D\301$\025A\005e\305mF\225\250LXRPN<\225/\225\372P\236\n\312)\345\241T+\257\244\200\277\025\023\225\307\362}*\257#\334k\2531?"
+	.ascii	"Q\004j\313\233\332\251\303\210\272\251\026\324E]\221\021\271"
+	.ascii	"jZ\337\207$\310\\\274\214@\013o\021\301\031G0M\355\325Yd/ \240"
+	.ascii	"\202\221\301\365\354\342\247=Eh<\215\214\026\007\005\262\256"
+	.ascii	"K\037\214\021\023l?o\224\r\344/;\331@\274>\261\214\365S\207\005"
+	.ascii	"\022\374!\3233&\341h\343gV\r\320bVxF2\013\021\021\304\013\031"
+	.ascii	"k\275\271\321xlv\254(\032\034\344\325ba\024\002\203l\316\314"
+	.ascii	"\016\002\362\202x\n\306j\030M\244\t\026\260\226\027\302\"\003"
+	.text
+	.section	.gnu.lto_biquadFilterApplyDF1.14.e772fbec9bd2f39d,"e",@progbits
+	.string	"(\265/\375`\374\002\r\023"
+	.string	"\266\343zF"
+	.string	"\321f8\034\376`\n\341v\036"
+	.string	"\002b\006+?\230\003zwO\210za\0206\034\364h\335\206\325\225n\204c\b \200'\223\003\213_%\320\250*\025j^\033\353\025\242W\362\343[\303\022,\352M\366\336R\246\024a"
+	.string	"Z"
+	.string	"l"
+	.string	"\273\t\336y\301\227\371\034\337l\332\375\271\301\263\273$V\360\264_\273\211\330\307\227\247ve\202xvG\022#\370\336y\374l\373$^\"f\337\270\361C\315\211n\025l6v7,p\225\367\216{\210\367N=<\366\214\371\267\235\033a\003\203\026\003\363,5\330]'-F\303\255\267m\3006\003[/\004\231d\2170\2513\366\271U\031\373:\267\3529\277\310\307?$\323\251L\203d\372#\323\250L\2372\355\221i0\323\035\2316e\372\313t)\323^\246\273Ls\231\326Lg\246?\002\002\275 \331\331\305\220\204c\207\272\236\020\327\371\355\230o3h[\207\302\007\223\001"
+	.string	"m\006\210\306\0063\021\036\n\352I\t \261\356\343\241\257!\341=\240~\206I=\355\320"
+	.ascii	"9>-\251IG\210f7\262\326y>\275\020MMt}EI\177\3534\325\323\256"
+	.ascii	"h\326A\226I\346T\265\323\022\213\331\215\214\345)8\275\215\246"
+	.ascii	"&\266\034\205\252\211\f\021\275\246rE\263\033\231]~\302\267o"
+	.ascii	"wM\374\035\007\023\276\232\027\357\335\325$\026\341\324\304\260"
+	.ascii	"\024\227\226\325\313\203\271\254\250\260:\317(%\257\025,\205"
+	.ascii	"\005!Tq\265Z.\224P\205\365\240\025\242\274Z\302\022\001v\255"
+	.ascii	"\254^!\314\345z\205\340\270\347VeT\212\262\340bHT\231U:\204\204"
+	.ascii	"\263A\024:\261\271\321\216D\324fyP'\032\341p\020\201N1N@\030"
+	.ascii	"\321\216R\212R\225&\210~hJ\017\330V\377\001\321\364\211\360\026"
+	.ascii	"\037\232\266\223v(J\007\250\b4 \340\"\021+z\351\232\"\"\236\224"
+	.ascii	"\024\r^\202N4\020\r+\211_\200!\270_\3272\250_\\j0\320zw\305q"
+	.ascii	"\201\324Y3s\304\200\222\357@IDX\236\030(\371\016(\t\346\345\361"
+	.ascii	"\272\206I\315\205!\220\222H8\336:\203n\nc\226\222\r\361\033b"
+	.ascii	"\205$.0\n\301\233\330\2524\"\361\341,\245\320\344\266J\022\b"
+	.ascii	"Xf\023OU\212\351\022d"
+	.text
+	.section	.gnu.lto_biquadFilterApply.15.e772fbec9bd2f39d,"e",@progbits
+	.string	"(\265/\375`b\002\315\020"
+	.string	"\366\037mD \2174\034;\314xa\020\2070\366\016ra\222\227\207\001\271\201}\031\032\230\013\330I\322GX\225w$eM\r\255m`\rUQ\026"
+	.string	"\002\bH!\214\2077\362O\001\250*\207i\215\333\310\336{o)S\nW"
+	.string	"Q"
+	.string	"["
+	.string	"\232\335\026\230\225\335\355\260\201\247}\224sX}\f\271\306.\314\304\312\356\330a\002\3367\217\236m_\3037\254\354\2316^(y\212\230\b\262\230\335\005\005\034"
+	.ascii	"\367M;\210\373\246\026\276z\256\374\313\256e0\201y\211\260\236"
+	.ascii	"]\202\335u\276D*\334z\333\003l#\260\323E\240\247\374\033\037"
+	.ascii	"\177\215L\1772\355\311t'\323\234L\177\231\336dZ\223i/\323]\246"
+	.ascii	"\271Lo\231\3262\255\231\316L\237\343\223A\001\316v'\314\310\254"
+	.ascii	"\313\306br\225\337^\3712\177\266U x,\n\034/\022\030,v\267\300"
+	.ascii	"7\037\3602\237\342\231\003\352\251\366\"bp\345\214A\312i\247"
+	.ascii	"\034\t1\026^\004\247!M7\325\0271\346\340 4\355Z2^\250\246\202"
+	.ascii	"4C\210#\250\177P\365X\261\241\327T\355E\214\271\254\272\007\317"
+	.ascii	"\274\335\365\360;(x\340\225\204p\337\256\232\226\214\023\224"
+	.ascii	"V\316\330#+\225\304\276\266\273k\205\331W\271\003\251\017\025"
+	.ascii	"jt\342R*\020\023i\343,\n\235F\251\017\022\003\320\024\226J\241"
+	.ascii	"\b4\221\026\224@\321\t\005\206\0028\004\031\235\300T\030\236"
+	.ascii	"\300o\334k\2530\220z$\304pi\251\313\037m\361(G?\035\365\220^"
+	.ascii	"\242\363)\247\301G|\332\265f\234l\224\245\243\"e\257\026\032"
+	.ascii	"\365t\243\335\tq\244\364\025\215^\326\351\026+ \260\"\2313\333"
+	.ascii	"\251M\021\212\007\274\243YI\320#\201\\^p\320\315\330\230\364"
+	.ascii	"\002\0162\001\032FVZ0\nR)`\004\342M\312\274E\032\206<%\004\341"
+	.ascii	"\341\340\240\256\354E1W\243P\321\033\306\234\222\035\361\333"
+	.ascii	"\305\352(.,\n!\266\023\211\017g\231B\243\333*I `\371M<\211\024"
+	.ascii	"\323E\311"
+	.text
+	.section	.gnu.lto_firFilterInit2.16.e772fbec9bd2f39d,"e",@progbits
+	.string	"(\265/\375`\346\001U\017"
+	.string	"v\\eF"
+	.string	"\221(\035\220\2714\\~\213Wgwq\350Wo\353\n\341\221|\2665\246\033\245I\345e\376\302&\213>z\302\316\214`1\373\025}\244\334H\332\315\226k\322\262y6\367@n\246\344\374\3477\327~\262\211\334)\005M"
+	.string	"O"
+	.string	"T"
+	.string	"\373\001GD\216\226\345Ppi\237\305[\210oA\271h\267\0253\263;\202\030\201\347\323\343\tl\237\236\017\330>-\332:>\216\330\3034\254\270\230\355.\247\".^\212\376a\377\260XT\227\235\007\273k\311b\341p\353m\177\330\226`K/\257\033\017)2\307\036URC\330\327vw\255-\373\257\037t\230\377s\227\277\363\361\237o\371\265MZn\322\027\tPa\243\201\315\356\206\234\036[3iL\330>\310~\205\017\355\352\206\f\302\204I\025\bm\206\227\022\0164i/\020\021\357\022Z7\n\242rbu}\f\227\315\n\316g\334\356Nc\366p\263\275\313\bQ\300H\301C\306\266\374\260G\247\261Ll6\003\251M\372L\330\001\021s}\324\246pY\352\005v\323Q\273\364X8w\300\\Sm\3601\226yv\227\201\377\002\303\205"
+	.string	"8H\240l\237\263C&\250\221\311\033\001p\362}\036\330m&\250\221\311\033\371R%\237/U\242\233\273\220\223\207\252@\3728\023X*\201\035g\"\221\224\270\356t\302\205\0300h\301;q(\020<q\240q\257\255\266\034aEM\212\256,\222R\023|\252=\201D\236\345\003*\252\262v\327\330\2562% \300\202\231Iu$\243\2452E \236\217D\023\r\355\334E\340V\264\2124v\332)A$\302\177\377\301\342$qq\3508\n\034\231\244\363c\027\331\2455\273\2057\214\252\341\224\350\b\341\356\205\037\206\023\200\021\303\r\324\270\347\260"
+	.ascii	"\016\rty\321f2"
+	.text
+	.section	.gnu.lto_firFilterInit.17.e772fbec9bd2f39d,"e",@progbits
+	.string	"(\265/\375`\321\001e\017"
+	.string	"v\234eG\340\2626\035\"e\242\b\355\001\024-\302\272+v\001\320\307!\246\367\032\322\200\260\224\212e8B"
+	.string	"\032W\261\r\315\261\273\377/\247\265\372\2516]\r\250C\021\344zP\217-x\005\352\270x\212\241m\332X\262\273\355\235RN"
+	.string	"K"
+	.string	"V"
+	.string	"\013\002\210\211\024\335\332api\237\305[\204\217Y\271\200]\030\0271vE\022+\370\234Z|\201z\3729\201z\352\320\346q\221\304\236U\302e\365\332\335m\216xx\031\372_=$\365\302r\231E\330]\313\324K\207{\336\366\210m\t\266<\tr\212\260\217\355\356z\302\330\231t\226I\327\323\374\364\342\217=\346\237\227\371/\022 \307\216\007:\273\034z~l\016\235\201\302\366}\326G\322kL\001G;\265I\266vz\3156\2451\031\020\331\r3' `\322n`\022^\006\364\3345T:.Al\374\243Q~\343u\260~4w\034P\305\315\n\037.\333r\344\243\273\323\260\313\346\365\272\312e\200Y\b\033\025\005\335e\232a\361\374\302o@\332\203\245\302\346G\207\016\303-"
+	.string	";\273\353\300\177\241\341\363M\254\324\323\217O\340\241\206\347\303I\366\330\"*$\317\353>\256Z(\251\210\272\t\236)%\3043\245\314j\256d\324\2250\200\274M\364\205B\037\267\211@(\241\215\033\221\266\222\003\3762t\243\255\364}\243M\023O_\375\323\322\221s\232(\017\220\331\\pl\372\343I\005\371\224\021\264L\026c7\216Zg6IZR\240\352|& \320\002\221\311u\351N\021\241\371\310W\006\350b\242"
+	.ascii	"\372\242\254\215Sq\302\320\352$z&\250t\037v\267\b$w\261\3109"
+	.ascii	"\313-\004\304\204\204\227\033\267\326\332\302O\004\214\342j\244"
+	.ascii	"GWo\n3\f\037\200\221\302\r\326\270\367\260\200\030\032\350\362"
+	.ascii	"\242\315d"
+	.text
+	.section	.gnu.lto_firFilterUpdate.18.e772fbec9bd2f39d,"e",@progbits
+	.string	"(\265/\375`\245\001%\017"
+	.string	"F\\bD"
+	.string	"\261&\035\213l\262%|\213\237S\322\021\221\345g[(\331\036\375\247\344\363D\376j~\233\005dU\377\206$\003\2328\220\252\022\370J\376\377\277H\001k\277zR\033Eaa\214\005TdK\310\336[\312\224\002L"
+	.string	"H"
+	.string	"Q"
+	.string	"\017\260\213\212\221\331\355D\214"
+	.string	";tw\002\361\020\273\200xh\316~\361\256e\177\302\205e5cw3\335p\356O\223\363\257\222\216\3514\372\303p\3658\255\274\220\335=\314\263\302\211\224y\225\354\256\323t\272p\303\333^`\233\304N\003\001\376\333\335\265\242\354\277\374\035W\375"
+	.string	"^\372\322t\204i\b\323\357\245\365\245S\323\377\360\300i\241\240\265k!\007gk\340\214\007\333\347\260\235\335Kp\177q\313\235\335\02462\273+\342\004\330a\310{\332\037q\022\334U)\001\255\001-\276Y\361\360"
+	.string	"\207\fP\257Q_\n\361n\025\361)\324\\\225>\244>\325\033\226\033\2521\032\210\213\233`\374ZLU\325\233\222\006\022\350(\264T\020\033O\270\t\263\260\335%\361W\020P\260\016)\361\360\252 hD\250T2\307\356F\251)\007\"\n'\241\017\214\366\214l&\"\t\237\007YH\003\2014O\026\3724"
+	.string	"e\236\r%\033)`\355\304d\313D\232\266e\034\335\376\255\242\314\300F\215\212\222\236\246\254\305\231\017\030c\205\213\214\334\335\221j\312\227\252:\200a\261\2225lG\270\314\245\035\022\r\rU\207\372\254\315\001$ `\2021\223\214\007iL\031\343\325,\334\223"
+	.ascii	"w\262\271\017CZf#Z'\332\240\211G\301\372\234\0068\020\325\241"
+	.ascii	"Fv\320\355\007\033/\032\236Z\\\265\261L\016^\366\t-)y\262uV\242"
+	.ascii	"qi>\004\305\030q\314\350\212\301\025i>\005\354\222\006,Wn\273"
+	.ascii	"\202\036"
+	.text
+	.section	.gnu.lto_firFilterUpdateAverage.19.e772fbec9bd2f39d,"e",@progbits
+	.string	"(\265/\375`\373\002u\023"
+	.string	"\366\"xF\340\322&\035RK\bY\351\217 MA0\021|\023%5\232\235\002\331\361PY\\A(\206\345p\214\027\322\236\343\t\307v\330q\202\215\266\0163\324\f\363\264\301\350\325'A\262\232\357\377\t7\263\226H#{K\231R`"
+	.string	"X"
+	.string	"i"
+	.ascii	"\b\270G\022\370\264\317\363\036\327e0\017\331\275y!\264;+\361"
+	.ascii	"\001\356\321\263\013\330\036\271\007\330"
+	.string	"\036\355\262o|\226\2637\221b\006(iwU\332\341\256o\021j\272\374\022JG\023\213\371\246\341\021f!a\206+\200\230\f$\331\335\377<kb_f\tew\23541\fw\351\266#\330>\261uA\333\343UE\320\330!{e\315\236\305\244\342\330\207\273\273\326\033\373>\277\310e\177\bL\247`\032\005\323'\2306e\272\3134\247\351RLo1\035a\032jZ3\235\231>\001\020\236\031\n\216v/\324z\254Q\034\372`\373'\3339;\t\327}Ls\267\353\"IhwK\034\262\221\034\003:\034L\312\302\033\360{\033T\223V\340\251\301l\272\025\234\246v \276\323ZL\363\035\244\257\331\260\251jI\017\033q\303\330\242n\nm\300B|Y3\324\250\237\371\361\312\332UxPMtd/\326Q8H\265\373\216vd\251'R5N\203CD\257\251\351\003f\363y\302K\230\306\355\356\211\017\324\300\205\363"
+	.ascii	"\023/\024ZXVq\263\212Ik\345E\302\352\201\212\205\345y,\025\025"
+	.ascii	"\313\312\201\247Ri\271\250L\n\230\325\262\322R\275\260X-\325"
+	.ascii	"i\266\207\2537f\320c\364\322oKi\321\310\320Q\232\322\004=G0\233"
+	.ascii	"/\242\364\244)?E\020\036\003\245j\203\b*\216\275\215\310\003"
+	.ascii	"\2119\220\222t\344\356\306\250\342\370\244&M\371\221!\223<l\257"
+	.ascii	"\336\342\244\335\207\264\023= \240\002\021\261+\017\251\2312"
+	.ascii	"=\336\223\302m\006\270\025\0027>\027c,\372#9\277f\3230\354&\332"
+	.ascii	"Z\n\201\021c\336\205\203lM\357\205\312\217\371\n\312I\253\242"
+	.ascii	"\021\366\007\353\274QdX\205\305l\254\234~Wc\267B\254}\t\214\034"
+	.ascii	"\264\304!\227\r\302D\034\2517\342g\271\202C\333\207\311\267\301"
+	.ascii	"P\026\223\362\026\231n\317\346&\003N4A\206l\020\355\210c\243"
+	.ascii	"3FW\244\345)\342K\032Pqd13\312\252\261]\246\f"
+	.text
+	.section	.gnu.lto_firFilterApply.20.e772fbec9bd2f39d,"e",@progbits
+	.string	"(\265/\375`u\005\305\036"
+	.string	"\306y\304H\260\326M:f\246\360u\321xq\030\272h\217\2300\303\273\306\272\b\317\305\344^a\304;\366\211\320\346\350\223\365\212\242\336\206-\243\307\307\n?;?;\263\314K\315\262\037>t\370q\201\002\013.\220@kB\310&I&\031\266"
+	.string	"\244"
+	.string	"\254"
+	.ascii	"\356\262\227\201:\363\245A\322j\313\207\007e\n\030\002\035:D"
+	.ascii	"v\205S^\245\240\002\343\200s\350\020\322j\213\374JQ\005\254,"
+	.ascii	"\313'O%@z\256\252\271\214C\347\037\007\347\224\345\211#?\312"
+	.ascii	"\362\027\245N\244\247\376H\033\276\241S\r\206?\025-\f%\212\007"
+	.ascii	"//eY\322d\356\021=C\357\210\236O1\252\307\034\376\254\341u&G"
+	.ascii	"q\206_\235Z\n\307\222,\237\225I;\331\"\301\333q\204\305\005]"
+	.ascii	"Y\276\021\236\341\210\245\345\302\306\207\025J\205\201\0051\320"
+	.ascii	"\333\363\3556\214!\3027\320N\\X\262|\"\274#\203\262,u\263|!\254"
+	.ascii	"1VU\032\252\232@uj\bj\301<ndY^\031P\357\320\311\300\221-<\325"
+	.ascii	"\034DO\177\334q\371\302\325a\307T\177V{\024\252\226R\021\006"
+	.ascii	"\246?\241J\233EA=951-\371g\013PJBr\016\353\221\314:\254FE\376"
+	.ascii	"\262\022}uhW\205\304\325 q\025h\\\0050W\177\346\252\317\270\332"
+	.ascii	"#\256\362\204\253;sUg\256\346\204\2538_\275\331U\033q\265F\\"
+	.ascii	"\245\031Wg\346\252\314\\\215\031WIqu\fW\305\271:\347j\030\256"
+	.ascii	"\376\253\273\253\036p\343\245\211\202`Yj\215\201)\231\314 /"
+	.string	"\234\303\326a\177\371\252:\r\020L\344f\363q\007\246\306<\n\255\t;\3553k\227~\364\336O\210)\371\354\022\304\270\366\311F\357U\211]y\324/\210\271X\r\252\352&\021\275\247{\245k\312\325\2069,\313\262\f\217N\273(\006e\243\317\356 \\X\210^\363\250\333\n\317\004\315\307\327<L\302\223\261\023RA\203S\242'\215\314\311\317\330\207c.s\364\230\213^\021\fd\212|\224\024.\007s5\265M\364\034\357^\211\371_\274y3B+\0221\374\274y2\214\036\376[(\270\207\355\237O\272\324\370\201E\260|\327\231\367K_/\236\211\335\216\251\277\267\2070\001U\265\334m\266\335P\223@e\233\242N\315r\265\252\013\266\t4*\334\355\206\233\242Q\331\"\334hS\271\f\264\231\220\3420\324r\264*\034.G\233\371\225\016\307\242'%\335F\253\013\223\016\337\221G\241\005X\210P\237Y\223\351H\376"
+	.string	"c\f\204\370\244t\331{\006\232\3242fBt\272\206\263\351E\357\311>\364\315\322\245\344j\303T\350C\367\003+\271\t\335\300\212\021\351P\007\032\"\373\323E\0228\200E\017\272\023\320y\036\324@\203@?\3579"
+	.string	"\237\377 \335\007I\217\203\032\217\316q\276\223s\035\331s\214\330pn\240\003<\001\363E\f\215\256\364\236\206!\321\233\336\2739\223\315o\356c\25018\303\234\203dfH\202HA\f\222\306\340\002\021\"S\035\021`)S\024\ti\312\324\001\251~i\021\024p\371\035\314G|q\332\215\005\231\302T\325\322Ia"
+	.ascii	"\024\234f\314BL\321\266\003\206\214G\3460\365*\350NR\312\334"
+	.ascii	"\324\345\353a\204\207J\230\232\305~\305\216\301\356\n#\177\243"
+	.ascii	"\241\331r\224+yxA\206\220i\240\003\3434\331u0\357\030\033F\317"
+	.ascii	"2\202\224\220Fd\223\263@Kz<W]\035\214\n\247\215-\355H\373e\234"
+	.ascii	"$\237Z\201!t\262a\270\034\261\214\004Z\371j\231q'\337\037\304"
+	.ascii	"\007\237\030\rB.!q`\305h\022\226\254`G\353\263N\211f\tl+\226"
+	.ascii	"\362_\244\323A*"
+	.text
+	.section	.gnu.lto_firFilterUpdateAndApply.21.e772fbec9bd2f39d,"e",@progbits
+	.string	"(\265/\375`\331\001\325\020"
+	.string	"\346_nE\360\322$\0352'\253v\322Q&\013\342.\336\021\375\006\321\034M\223\351\330=;VV\030\222\247\337\334\330\206\024\030\016D\031\b<&C\366\300b\206\331B\310\030\253\260-\233?\033@\314-\261\215\220\275\267\224)\005X"
+	.string	"R"
+	.string	"_"
+	.ascii	".\027\260[3\003h\267#q\002\354\320\035f\333G\361\024&\233\365"
+	.ascii	"\272\0207\277\361C\246\207\307\356j#/\020\017\337\t\304C\005"
+	.ascii	"q\323\237\246\311\277Nv\376p|X)\325\313\037\3155D\005\363Fv\367"
+	.ascii	"\253\247\006\025*\363:\331]gJ5s\303\333f`\333\304\316\006\001"
+	.ascii	"\2516\366\337j\215\r\323\331K\203\304\364(\2461\230\276`:f\032"
+	.ascii	"\276\364\273\316\257\357\376\f0\200\306\306\202\326.\207\226"
+	.ascii	"\217\025\202.F\370=_\265\234\307\016xpv7k\261\263\233\354\314"
+	.ascii	"v\346u\314\362h7F\021\320\356\222X\301\323~\316U\230\336\005"
+	.ascii	"#TP\217\034U\277\305\004\263\374\033\337?\361\020\201\b\017#"
+	.ascii	"}\n\242\2171\361n\031\021\323\221fO\f\tT\266\034\025S%\222\371"
+	.ascii	"q\351\317&2\364T\216\323\267\030\365R%\212\371\200\242p\026["
+	.ascii	"T\021\034_\231\373\n\377`\273k\342\373d\260\340\337\270\350W"
+	.ascii	"?P\"\350D\316)[v\207\n,\030VTH0\032\245\244\224\302R\201\024"
+	.ascii	"AS\341\266\215C\321TH\0176\r\245tA+1`n%\245\244\261p\\I\313\272"
+	.ascii	"\323\337j\r\324\221\223\242\034\222\251v\212\204|\n\352w\376"
+	.ascii	"\r3\035\204`\364\345\251\215\267\bc\0030\004u\320\300\331\221"
+	.ascii	"\273\373\242j\343L/\205\260S\003&\213H\177\261a\231\006%  \002"
+	.ascii	"b\224e\346\001i\247H\2107%\3216\0272\214l\266\303p\351\226xH"
+	.ascii	"\335o\317\371\372KW\255NL\316\254qO\264\035\022\253EB\206\025"
+	.ascii	"2\260$\300\310\330\244k\363,{\335{-\027\271{\310\340\215i\240"
+	.ascii	"y\316\246\213\261\247B.\2011\327\356$\004\242\203/Rc\273J\031"
+	.text
+	.section	.gnu.lto_firFilterCalcPartialAverage.22.e772fbec9bd2f39d,"e",@progbits
+	.string	"(\265/\375`\236\003\205\031"
+	.string	"\246p\245E\300\230Mc\320\344~l\303\310\305\2061\240B\264\007\331\267K\270tuw\225\001Ja\324D\005T-=,\221+\254y\030K\261E@\004A\024\004\316\201\237\234\026)\330\027\212\223zDF\037\373\367\336r'\231R\226"
+	.string	"\210"
+	.string	"\217"
+	.string	"\fh\336\001\302\2579\364d\204\002\307\326N\326A3.\204g\346d\242\n2'.A\017\204\226\305\2058\234\203\326\356<\\\213\027\236\202d\324C\313\234\023F\3005\237\245\347"
+	.string	"\237\345Y\324W\366p\356\027i\006?\351=\322\352\234\275 QF\216nB\006=\260\b)\206\353f\344=\260\252\232r\224\243\3556\024?\230\031(,O\330\363\f8YQ\305u+\362t\226\222\230`\335\210\342\035\345\003:&G7\024\216`\2049g\343\321\255\204\033\272-R\333\t\355q\0018\241\370\246\326\017ZXQ\365L\255N\016\316\r\030k\343\035v\r\215qv\200\031\353\334\227\214\237\\\227\241\334\026\030\033\363X\326ca\274\330\02706\224\261\340\027\373}\261R\306z\217\275\027\033\275X\013"
+	.string	"P\304\t\205\334\234HW\\f\0239%\303:\373\311\206\362[\267\366QG\225\245\313\351TH\b-\335\322\352\036\316\225\005\325](D\302\2466%\005\004?\225H(D\"\204r\241T5\347\334\261\254\203\360\261]\0208\217%\001\371\315]\267\265\b\374\272\316=\245cR[j=|\316m\245\2664\344!\034\272\2533|\226\341mS\372\356\035\274k5<\027\311'\377\3355\032\256\313_I\314B2x\227P\206D\311\343\037\347QI\374o\231w\361`\215\235oP\261\025yo\332\361\315\0070e\341\221\204(Z\225\3072\277\271\356Imi\3509#E\267\277\3514\267\224Q\227j\260\224O8'Q\203\372G\205Y\370\302\262\016\361Y\372\362\212\224\r'\021\361\252\r2Y\f\212\001\375C\354\302\217L\006\375x\230\365\310\257=<@\261\240\r2\f\260\237\231\217\317\254\007\366#\263\340\003\353\001\352"
+	.ascii	"\343\021\320\031\207\030\020,h6\003\202\261p\263\312\336\327"
+	.ascii	"\372\214\315\t\210\370Pc>s\233\273v\204\365\230\273VUs\326\215"
+	.ascii	"\272T\201ojKI\352|K\222S\334\361\353\266z\322\025%)F\244\271"
+	.ascii	"\314m\216r\210\345\304\b\231s\347\034ZIZ\212\335\265\215\005"
+	.ascii	"Z\267\275\016sK\341\261\344\3450=.\362\362\027\023R[\354\315"
+	.ascii	"9\347\367\246\032F\022\225\027A\2501,\244\fTF\021\032\221`HH"
+	.ascii	"A6\006p\002\231\271c\007\021\300\271CEc\353i\250L\022P\220\324"
+	.ascii	"\t\376\306\002\260\177G\327\322\004o\243\020^u\337C\347\203\201"
+	.ascii	"M`\355.?3\317\207\232\242w\034hqDO\213\022\205\303/\374\322\177"
+	.ascii	"sz\t\1771B\354z\367g\326\323t\310\365!\301s\002l@\223\333\336"
+	.ascii	"\350\001\212\020\225\005\020\326\331:DX3\350\005:\312<p\004\264"
+	.ascii	"\252/\024n\214\t\016\247M\212=\370F\025\245s$\310\352\235\343"
+	.ascii	"*\235\320L\001"
+	.text
+	.section	.gnu.lto_firFilterCalcMovingAverage.23.e772fbec9bd2f39d,"e",@progbits
+	.string	"(\265/\375`\210"
+	.string	"\315\t"
+	.string	"\246\323D<P\245(\035l*\314\275\022lM\336\266X9{\033\036\215F\233a\"\260L\272(\332\217\266}\344z\264\022\215\330|j\255\314$\242\tW)\213Qg\337+\200\f\202\020B\266\224)\0053"
+	.string	"2"
+	.string	"3"
+	.string	"\367\370l\223\bf\250N`\3034\202`w7\313+\330\257\370\003\354\227b\374{~\376A\036[%\341\t%zf\016\273\353<\241,n\275\355\213m\006\373\227\231\2161\255\232\316L_3`\rx8\260[\021\266V\300\005\200\303\366gSl?\355\257\376\361\035\f\275`7U\340d\027\\\260\202\366\313\240f\333\357\b\006J\254T\325\233\022p'\351R\023,q\221\217\266K\321\340\207x\023\332\356^\365\313\017a\277\256\025\215\325(C\033\024\245^\330\217\253);\323\331\301\037\013\236\006\324\341l0g0\236\006\324\341l6O\307q]f\363p \270-\343}6\f\202\273\b\215\267\201\272\316\333(\340\336\316\3242R\222\243^3})"
+	.string	")C\253F\325\r"
+	.ascii	"2\003\3020#\026\331\na\203\201\020\345G\224\312\3055\021Z\026"
+	.ascii	"\273\004\023\004\234xR\255\230\204I\006"
+	.text
+	.section	.gnu.lto_firFilterLastInput.24.e772fbec9bd2f39d,"e",@progbits
+	.string	"(\265/\375`\226\001\325\016"
+	.string	"V\335bB\020q\224\016$\335"
+	.string	"\024$w\320\361\276\227\030;x\020\302\016\317\022\001\244\023\013\003f\232\337{\267\241\372\257\261\205'\337~\212\177\002"
+	.string	"\001\025p\020\361\212\303\tX\205\344\036\252V\2365B\366\336R\246\024P"
+	.string	"K"
+	.string	"T"
+	.ascii	"\327\241\273\313\266"
+	.string	"_\342&F\266\312\353<\234\274\205\304\210\212\033\273\233q^ \036\276\023\210\207\332\341\243\303\2479\362-\217\267ja\203$E:,\371\003\220*\271nR\246\307\331\335\243x\242R\245L\313cw\235$)\fw\274\355\007\266\027\330\t\003\371bw\244T\016\366\337\252\312\216\351\215\2465\232\306\336\375\031Mc^\372\202i\013\246\343KCM?Mk\2463\323\0170\300\245\206\003\226\335\013/:\226\006\204\001\302\366\310\316\244}\224\237\030\275\013\271\200]\325\214\027\273\235\002'\bj\351O!0\0325wD8\013\r*T\261\214x\360)v}z`%_\347\252\0325\260r\332P\312\027\247\252~\304\305\023\276\"\225\201\311swI\352-^\261\017)-\246\314a\033\364\024\333\265kj\340\247H\250p\235\034\372!\361\360j\305X\341@\021\t\334G\004\242}D{:\334G\004\242}d\241\r\004\332<YH\203"
+	.string	"\312<\234\205\254\203\300\033\205\017\227\211\266\215\3132\266\335\355\337\252\312\3710\305L2\254T\243\030E\331\336(GDK\366]\204\254\342k\361p\243Gi\260\024\352\245?\211x\267\214\030\003\037"
+	.ascii	"Y\331\360\242\030\237\260\342\314Dzp(@\220;x\201\275\236)\fd"
+	.ascii	"\307T\301\245\256@\335L\034c\243%CH\002q!j\211\270i,\\\262\t"
+	.ascii	"\3155\314\340-\316\314D\016\252pp\227\222jP*|\236\2521\324\351"
+	.ascii	"\255-e"
+	.text
+	.section	.gnu.lto_firFilterDenoiseInit.25.e772fbec9bd2f39d,"e",@progbits
+	.string	"(\265/\375`\210\001\025\020"
+	.string	"\246_nG"
+	.string	"\261&\035\333\211j\221\270a3p\264\347\376-\226\350\177`D\300\261\357s\217D\243\0321\\u\267\233F\214\261"
+	.string	"\222fI\026\267\265\326\344\377\277\230\264l@S\325I\374\216%\302Q?.\272\177#d\023\"wJ\001V"
+	.string	"T"
+	.string	"^"
+	.string	"\017\270k\036R\245\315\240\201\370\321\202uwCl\301\245\375\021'!\376\305\344\002vYrnvG\005F\300]\363\370\001\363\032\367\217y\315\242-\343c\313\276\246\006E\346gw;\355p\361R\364/sP\212\312\311\345\006aw-STVn\275\355\020\333*\3733\002\243K*\007\373\331\356\256\225\305\242\277\374"
+	.string	">\376\034\217\371A*\315\251\364\266I\317)\255M\351lJ\253J\313)\375"
+	.string	"\037\031^\220X\354^\210\331X\035m\205\213\355\373&NS\362\031o!vB\327\354\022;t\355!\333Z\3420\342c&H\217}\271\\\002;0<'h$\270H9\265\204\325p\375\3348sS\221\236\346\231\210\226\033\020<3>S7U\027(7\244\246\266\367\315\247L-\360\322\023gj\025\367Y\331]\037x\355\266B4\315b\300Z\250^3=\354\203K\306,U\365\260\036\016\225\nb\203r\003\244\327\271\202\"\007\326\323\2221;V\215HTa\311#p\362V!\353\373H\341)\005\226BQ\205\b(\026)D}\"\037H!\3251m\032\201\247P\302\n\325\215|\236\367\231\272\221U\311\353L I7\002\361\307:\201]\370}`\027\032[\317VY,\242A\247\245.sj\247\236\3028\334\356:\360mP\253\016\030\036L\346\265\313\334"
+	.string	"\206\034"
+	.ascii	"\016\301\273\264L\231\031O\251hAd\347\rAo\205\202\360\030\026"
+	.ascii	",\210\3407q\343\026\372\203\271\354e\371\230kqaM8\306bP3\034"
+	.ascii	"\263\324\207\326`\375#\240Bc\220\200\001\030\021\240\242\200"
+	.ascii	"\273\274h'\031"
+	.text
+	.section	.gnu.lto_firFilterDenoiseUpdate.26.e772fbec9bd2f39d,"e",@progbits
+	.string	"(\265/\375`}\003\305\026"
+	.string	"6\350\211I\320\360(\035\334%\211>\b*\301\211\004"
+	.string	"\257:P\243\220VP\257\302\005\rV\005"
+	.string	"k\326\240\304\323\261\350\004\253\251\341\017;\210T\216H \302K\256V\360\305\003\320Bk\334\225\f 4%Erw\367\266\021B6\221R\246t"
+	.string	"j"
+	.string	"z"
+	.string	"\373kNK\304T\007\243\002\272i^\374t\353F.\"\352\274N\374\177\035\241$b\177\371\351lp\264WZ\330\231\321\335#\210r\200:?m\201:\371\203\3064\004\347\307\033\273\306h\310\344#\004\206&7\037\236\232m\203N\226\215\374@\272\273\302~7\345O\004Gtc\331h\037\207\221\207$\335\351\312\330f\273\241Iw\177k6\rzQ\377O\370_\362\263\211<\261\273K\256;\f$\21080\240Ne\335i\310-\251)'\333\247_\027\263\\\363\353\327L\343\261\373\016\325Qm\251Nu\300\356Y\273_\355~\203\367\252\335\247x\217\332\275\270\373\220\367 \357\347\356\277\3353\357\227\367\372\321\n2Z\300\323\235\341\251F\027M \020\377c\277\352\377\256\352\274\374\002\264\314\354\302Ow\217<\201\006\334\342e\310\037\213\274Nd\210\331>\3014\350e\b\022\257@\310!= \026 \253\216\224\276\003\272\002"
+	.ascii	"\022\223\222\b&\315\251\341\212\230k>y\371d\327\243-\215\377"
+	.ascii	".-\317\233\214\242\301h\312\311\230?^'\0227{i\317K\346U/\267"
+	.ascii	"\254\342\274\321Fk2\020\250\362\262\016\365\b\221\270\331>\275"
+	.ascii	"\305\377)h\212\227\0346\335\255\340\217\240(Zt\256\220\f\334"
+	.ascii	"t\370\213\236x./,+*\023<\n\t,\305\005\202\212\203q\345\345r\275"
+	.ascii	"P\306\025\225\006\256\021\005\3262\222|\374\305\222\002\033]"
+	.ascii	"^/\330\250\322\2652\315\2717\223\003v\244nf0L\017f\261\314\177"
+	.ascii	"\026\337D\306\263\260\324/\255[F`\305\035\034\362H\334\006\213"
+	.ascii	"\274\332\340\217G.\251\230\350<\022\036\212U\254\034|\300\024"
+	.ascii	"\213\354\301J\016MN1\271\264\335\0353Q<\371d\347\342\201\016"
+	.ascii	"\241\030u\024C\fM\250\201$*\r3D$\221\004\031-I\332\220\002\021"
+	.ascii	"13\017\0210I\247\220\026\226T\213\001\351\2417\306\313\031\262"
+	.ascii	"b\001\0076\365!\230\353S\312 \372|\353\017\241\305^(\204\310"
+	.ascii	"\366\375C\267\254\2656\033}\240@\277\222\261\004\335\f\366\224"
+	.ascii	"~]\005\207Wp\270\270Lpb\003\023.s\274\033\016\007\006\255\267"
+	.ascii	"U\346(\356\253\342\375\307\003t\013j\t\230\325k\177\023\3122"
+	.ascii	"\024\037\023f\"\017|\235\213E,{\f#\231|\030\n\263l$^C\034?A!"
+	.ascii	"\254\255\266\354\201]\241\247\300\246G)\362\001\252\233a\246"
+	.ascii	"i\370m*\374)\222P\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e772fbec9bd2f39d,"e",@progbits
+	.string	"(\265/\375`l\002\025\b"
+	.ascii	"\022\013+2PM\324\001\204\224\310\314,\302\025uU\021QUT?Q\222"
+	.ascii	"\231s333U\200fFFFFF\214\255\031\331\232\211\276(\323\262\006"
+	.ascii	"!{\257$R\006\272a&1\003B\321\3033\304\234\2067\204aON^\021K\362"
+	.ascii	"^\222ge\212\274!\025y+Ud\217w\337\271\216k\034\3376~i\034\333"
+	.ascii	"\356V\335R2\356-\306\255\213W\026\247*>\231P\034a\342\3227\202"
+	.ascii	"r\"\361\203\210\033@\274\340\341\221\303\241\206\0230|`\341\217"
+	.ascii	"\302\235\204\013x\007\350\036\300\275\331\316h\237\331\345\002"
+	.ascii	"6\211\352UK@6vwc\217\213\252\362G, p\2036\2056C\033x\223\037"
+	.ascii	"\330\270I\3638\364 \262\276\241\215C\037\030F=\202\003\034\301"
+	.ascii	"1\340p\013\204EZ\352\"\202!{\264\353\317\205\377\234\372\234"
+	.ascii	"\234d\370\206 \304|\3437\276\361\033\337\370\215o\374\3067~\343"
+	.ascii	"\033\277\361\215\337\230\037\256e\307"
+	.text
+	.section	.gnu.lto_.refs.e772fbec9bd2f39d,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.e772fbec9bd2f39d,"e",@progbits
+	.string	"(\265/\375`/$E\230"
+	.ascii	"\312\362\b5P0R\312I\007\272{\272c6\266\373\277\312\256\231\330"
+	.ascii	"\334\305Mk\232zY\315\325Q\367\374\271[_\377\334\337\365\273\371"
+	.ascii	"[\367\3739\372\273`\3278\327\252Pf\370\356\377]\f\207\252\"\212"
+	.ascii	" *3s7\302&\252\262\252\322\314\374\1771\335\306\336R\246\277"
+	.ascii	"\002>\003[\003Z\016Y\020'\251s\223\360j\214\335\333<\003\252"
+	.ascii	"\240\240\2318\220\005ksl\206\t\223F\364\336f\211\023'N\334\340"
+	.ascii	"\341ua\351\330\263`\312%\366\322\363]\372s!\203\001\201\203j"
+	.ascii	"\306\233\363O&\274U\333J\242c\3637\370\306V\227\236\243\244\347"
+	.ascii	"&\351y-\335\341\021D\336\302Qv\036\300\\\256\202\202\327\244"
+	.ascii	"\332Ero3\347f\214\2211a\210\244\347\003\210|"
+	.string	"\310\007\020\317?\322\024<\202\330\202Gd9\034\021\352\214p\257\377\374,\0301S\312\332\366)\245o=\230D\332\236w\244S\336\242i>\304!\201\002\027\225\3626&gg\245\247J\331[\364\211\024\270(/\211r$\016\217\261\260\036\3571\224\363\230\217\255\360\035;\371\n\317\235\351\270N)\355\nS\371\223\241l<\206\366\026\275\367\326\\\305-\373\002\260g\254\264\267x\004\261\001\256\221\236\233\322\363RzNJ\3177=\016\351oH_Czdj\202E\020\2170\022~\326e\215\255\313vo3D/\311\2444\265\205+qCf\004\315\254\355\205\322sZ\022\264\t\324\316\334\270\215\337\330\t;\271\t\257\235\2270\223\333\346\275N\316\330\376\304\241\271\227\n\333\330\275\367\214\344\357\3414n\302\315?\rh\272\227\nV\016\026\270%)\302{\357\211\023%N\234 :\241\340\350\003a\237A\312\227G\020uz\224\\"
+	.string	"\345\245\3407\351g\322\313\244\357\324\004\217 Z(\217 \276\311#\210)\213 \376L@\002?\017\360\363\001&\370\374\214@\017\360w\211\377.4\211\005X(\201\253\203\252\301a\t\\0\370\371F\207x\316_{n\352\003O\265"
+	.ascii	"\003j\376J\342\"\376\332\177\353\374\334?\333\237\371\347\377"
+	.ascii	",\363\377\360\347\332B\t\007\340\357C\244\237\221\036\335q\376"
+	.ascii	"~\313;\364\377\335\177\275\377y\377\257\374\307\373\277\367\337"
+	.ascii	"\356?\226.\017\340o#?\273\3209O\377^\373\031\255q\372\346o\233"
+	.ascii	"\256\271\315\337\314\343h\362<\361o\032\377\235\374o\373\317"
+	.ascii	"v\232\277\223\257\177\027\375\r\342\357\372s\227\237\373~\266"
+	.ascii	"\3739\356\347\264\237\201\374\334\343g\256\237\265~\326\361\363"
+	.ascii	"\325\317S??\375L\343\347\245\237s\370\031\371\263\321\317D?\007"
+	.ascii	"\375\374\342g\027?\277\3603\n?\223\360\363\007?o\360s\005?+\360"
+	.ascii	"\263\315\317\351\377\276\377p\377\301\374\037\372\277\302\177"
+	.ascii	"\003~N\3613\212\237!\370o\302\177.\377\t\177f\340\347\005\376"
+	.ascii	"\253\360s\316\3178?\337\374\\\3633\210\237i\376\377\375\367\373"
+	.ascii	"\377\374_\302\377\013\376\323\375/qxxx\370\023w~\213\302O\300"
+	.ascii	"W6\306\356U\326\016M\362\212Q\213{\313U\254\252\300\033m\373"
+	.ascii	"\331=b\240\202\327\325=l\332\220\253/-L\230\264\223z\357\016"
+	.ascii	"\3021KGu\244\255\311\333I\212\267\203\352\254m\273y9\221\373"
+	.ascii	"j\333m\177\022\251\210\f!l\333lujj\275\026\370\207\023\246\031"
+	.ascii	"d\317\371^\003\261f\350\245\245m+i4\233).\302\347\233\221n\246"
+	.ascii	"\367^-t\321{u\265c\263\204E\210]\332\273\031X\243\244\344\310"
+	.ascii	"^\333>\322h3zL,|hg5\310\017\033Vp^\216\004&\265E\302k\rhc\213"
+	.ascii	"a\3336c\301\306\321l\212\246\245o!=\344M\3667Y\023\341\253[\003"
+	.ascii	"\335\260\252\b\357U\326\216\fT\262\317\260\313\336D\376\264\271"
+	.ascii	"\327\200\233\036\354\342\252\264\355\036\016\230S'd\b_\333{\241"
+	.ascii	"\341\036\340\214\270\265}\235J\337?\361*\243\356\2757d\2327*"
+	.ascii	"\311\206\3102\314;\377\rW{\353\212\276{\311\300\006\323!O%\326"
+	.ascii	"M\334\027\2717\031\3426o\324\322\331\225\\\256\335I\205h^.\022"
+	.ascii	"\327\311\343.\233]Rv\353\366m^\276J]R3,\233[Q\313\346VR\347*"
+	.ascii	"m%\357mJ\351,\331\224I^:\273\244\226\316-\251\020W\351&\257S"
+	.ascii	"\311\225*mI-\353\266\244t\226N\245\324R\251K*\004\0200\2610N"
+	.ascii	"\205jv\214e\251tm<e)\243t\240\313\346\326\355\273\227\331\226"
+	.ascii	"n\324\002\367fmE\365)\2558.\tj#\311\211r\213\233\367\336\001"
+	.ascii	"\236\222\230[W\t\272$\333\272\227,I\350>\255H6\2417\214\241I"
+	.ascii	"\036Y\267\306\322\275\004<\335\233\344\013\275\367&\357\2753"
+	.ascii	"QY\315{s\350,\307\236\236\356\275*\361t\263\222rK\3676\333_\234"
+	.ascii	"\324\322\311\334\352\221[\342\034\273L\315$\217\335\276\256\250"
+	.ascii	"\324\231Lrk\334{\271K:&5%\330v\247\307h\224\23294{]t\260\351"
+	.ascii	"5\017\\\262\340`>I[\254}\260\263\177\374:\357m\336Te\225\335"
+	.ascii	"s\207\230\303;\304\366\352/v>\320;\274\301:\3542\312\346m\266"
+	.ascii	"\230\2306%mux\004\261\333\322\363\003\304zx\310\0174m\240\240"
+	.ascii	"\304\266\230\3355\223\345K\211\254-\027\021/\276\274\266\357"
+	.ascii	"\262\364\023t\026\253u\016\206\262\3312+S\217\322E7\306^\352"
+	.ascii	"\370\213]\264\267ZG\357h\255\306bgg5\325\273\252\255n'\350\254"
+	.ascii	"\326\341Q\030\312\346\201\2209\233'=\270-\331\330w\216\277\245"
+	.ascii	"\372\306\237\275E\002\247H\216e\\\333\276\352y\343\020A\214\272"
+	.ascii	"j\336\034\033(P\224\314\266\377\201E\020\023\21063}[\245o\032"
+	.ascii	")\002\025\312\"\210\177Zp\3476\244msfJ\311\006\030\033OVm\006"
+	.ascii	"3\254I\363\344;\253QX\203\325\243K\256"
+	.string	"\355\0019\315\252'\036m\377v\352&\034\275\251,M\332\366\3226\217\320\205\035\246\357\333I=\243\225\275\324J\354l&6<\213\3411/\361\003\027\372p\230\346\245\251\247\2318\314\341\fHZ\212PdL\264\313\240St\202f\342/\177\326$Q\002,\341-\243\001o\025\216Y\250|\312K_\235lI\343\241\257mm\222.\315Ly\300\322p#t\266}m\362\327%|V\335b\270\311\022\302\303\253me\253m\257n\225\211\333\212\255{\225\325-\307\360^e\016\263\002\314\nX3&\0207\242\375\314\223\324\306\331\363\272&\203\203\216K\254m\r\213 V\265j\244\232ie\335X\322\266&y%\273\301\004\244\2261g\304\265}\220\327#HjZ\213\335\233\224\242\231\324w\227Y;D\267\031R\202\240\275\246=\271\372p\354\320\266\236\315(I+\221j\244\232]\3212<k\373\031!\351k\021#edX3"
+	.ascii	"\204\345\2359!a(DerP\253m\355\341\265\214O\217N\2550\255C^\311"
+	.ascii	"~\032\031\254\251,d^\322\277\n\001\253\263\"\270%=\361\317\207"
+	.ascii	"\217\n\204\375\236Q\033\257)U\254xx\005\002\002,l\212\221\266"
+	.ascii	"\365G\005\303\t\022\267l#B\251\314\312\254=\370\336\266\266\032"
+	.ascii	"\260\037`=j\330k\217\372\304#*\252m\365\252`7Y\340\236\352*X"
+	.ascii	"\335!\207U\0272\256t\331\243\206W\375j*\020`Vb\320\266\225\007"
+	.ascii	"\013B\305\205!C\343\3422\353;4+;\261\252U\265\352\224\b~?xm\n"
+	.ascii	"sI\333\023\243r\344\250:D\360\203\032\243a\243\202\373\313z\325"
+	.ascii	"\341\243\211\027\275\266\025\253J\021\311"
+	.ascii	"\230\272\344\030\244\242\252W\351\035C\263\346\027\026f\365z"
+	.ascii	"\365\314A\022\006J\\\333ZUW\241*T\235\242\271\227\257/Z\241q"
+	.ascii	"\317\257\033\257SO\242\323l\020\255J\345\fR-I\252R5\252o\226"
+	.ascii	"*\200M\"\335\025(&o\365\251>U\032|M\340.\232V\331rYi\244\311"
+	.ascii	"\"ci\221>(\263:\275\322\bD\243B\003\260mmj1\351\322\351\343\313"
+	.ascii	"WM\326d]\342\023\033K\207HE\315\352\214\327%\273\003\352\f\256"
+	.ascii	"mUj13O\310\270\256\264\255I\207\303\211\003\344\341G\333\252"
+	.ascii	"dAbT\035\231\\!qP\256\210\225\253/_\372\220o\024\023\032\304"
+	.ascii	"\034XR\336\306\274\017\003\243e=\372\332va\213\211b\211\2111"
+	.ascii	"\004\353A'\245\227L\b\204\207\2660lh\231\2641i\265m0\207\253"
+	.ascii	"ML|\324h\333\204,H\343\003I\224\331\266\177\340B\020J\364\252"
+	.ascii	"\370`A\031\346\027-\317\266\227i\032\034lAB\020|A\276|\375\260"
+	.ascii	"eK\013\352=\243\355e\004\007\025\227\267\240\315R\351%\332s\314"
+	.ascii	"6\277\252\273\276\276\006L\257Y\232T5E\211\2267` \2535\201D\265"
+	.ascii	"\355,=g\003\347\216\230\265\355?\231$^rwm\333\357O\270$}bn{{"
+	.ascii	"zby\177N\310\362\362\272.M\3529\315$\277\254\224pY\261\322wx"
+	.ascii	"Yc9M\302\2740,\357\273\300\034\265\032s`\3326\264\347\2464\245"
+	.ascii	"\211i\333W\376\264T\324\336:\b\321\n\224aa\333\333'(P\272.\003"
+	.ascii	"%"
+	.string	"aQ>C\277\273\266]\027x\243c\207sJ\317a\240D\2477WE\216\007\230\262\317\306\020K\220\217\n\317U\262.3h\333\226\362\347\r\264Y\365\324\266\243t\020\034\037^hUm\333\207?g\264\334\f\2754\220v\336\035\201\032\302\301\265\034^\027Bq$\204\374!:\032\177\214h\202\220G\243\321\020\361B(`\034\215F\310#\001\216E\307\031\244O\361\006\343\021\021Y<\"*\022\021\203\216\306#\033tT\004d\203T\300(\032\222\261\027\002:\376\030\2718\032\221EG\033\243\037! \353s4\"\207\214H.||p^\020\031\217L\024\215~\206\200\212/L\304 *\322\271\020\212\243\241\241\037 !\344\017\021\317\021\322\350\202\007\351\bC\002\031HG\343\220\004+X\370\260h!\203\247\370\002i\b\350h\3441:B\342\341\251\241\310H\bYt\234\t\372)\016Y\344\321\261\bH&\250\206\242\0306"
+	.string	"$R\214\343\b\310\243\037\022"
+	.string	"(\201\200\241\037#\322\350\347\004\240\241\237\016\nxq\344\200D\021\306\217Q\221\006\016\004\310\271Q\201\023\242\007\004\017\002 \001\302\t$\214(\"\177^\304`\001\204\023H\020\241\203\202\020\020\262\310\004d1\204\234\02598H\343q\204\233\003\3310\024#\006\007CCH\307\234\003\031\215\212\307\"\214\364+XH\300\242\205\214\231\267\270 \305\005)\210oqAO\317\005,z\322\263\350\251H\037\025\023\024}\2121lX\001"
+	.string	"\244\017\213\236\024y\344S<2\026\035\213\036"
+	.string	"\360\24284d\f\252\351"
+	.ascii	"Y\204a\364\203\254A\332\030\031\203j\202\220\\T\344O\321P\220"
+	.ascii	"\314QPP\261\b\210H\204\244\002\214\243\221\206\"\"\032\031\305"
+	.ascii	"\027G\243\f\362\210T\004$\203\364i\201<\032\221f\204\2200\216"
+	.ascii	"E\022\202\220\\\320 U\330\360\342\007i\006\243\013\234\024.\272"
+	.ascii	"\307E\253p\321=?\255\342\247{d\264\n\031\335cC#\205\nxQ\214\242"
+	.ascii	"\021\017\262\250\310\210\247f\205\027}\344\003B\0172F\315-\260"
+	.ascii	"\240\003\023,\230\020B\n\204\302\250\210\0342\006\361\034\213"
+	.ascii	"\210\210\212\200x\216\306\037\"\036 \243#\036\024\004\024\221"
+	.ascii	"?\310#\031\031\270\203\024\372u\225\214I\221=\034\326i\t!\334"
+	.ascii	"\215\266v\312NY+\216\212J\nF\220\206\205i\205\360^\351Puk\025"
+	.ascii	"EfI\313\340][K\365(a\332\322\362\332Z\035\036e\206\316\nS+\212"
+	.ascii	"\245\222;b\367#\375\355\215:\345\202^\025%)\233\204\003M;\f\263"
+	.ascii	"Qu\314.\350\036\215\024\246<,k#m\210\262\310a\263\007\375\200"
+	.ascii	"\204\325\250vm\207\\\264\264\375\214\333\245\235a\235\330\013"
+	.ascii	"7\357\325VR\320\001-*\205:\020\302\370\322\252\263M\267Nu\304"
+	.ascii	"\303\265\270.\313d\227\322//\257?x\261Iu\317\346&\325.\324\314"
+	.ascii	"\263J\027\032\341]^\355\324$\241\221\004\313\230\333\244[\245"
+	.ascii	"\n\n\016\230\026)\333S\266\265\311\333{e\367$zh\357\020/'\021"
+	.ascii	"\246\364\022\250UII\265\255b\016H\006X\203K\333j\370(\277\342"
+	.ascii	"#\334!\214\025&^R\333JX\301\260\363t\265\3608O\230\332\350\332"
+	.ascii	">\275\351s\340\323\021\353\227\327\262';\274\272\310\334\366"
+	.ascii	"\260\306\300\374\275v\371\253v2>\354\220\247\244\256m\025\334"
+	.ascii	"R\271D\265\324@\300\253,\203W^\373\256T;\030@\274\335\231\361"
+	.ascii	"\345\325==,\025\357n\360\314)\013\272\345\311+\335\223jW\347"
+	.ascii	"\322\267;\346T\353^\355\236L\376\260@\251sSj\225J\245\372P\245"
+	.ascii	"D\351%T\240\314\370\245qAj\232\225r\357\022\253]\250(\234\037"
+	.ascii	"\252|\251j[\237\257B\264\222C\210\264\255Jj\203\007\250\302\331"
+	.ascii	"0\310\342\312\020\203lDd$I\222\306\362\n\020\204CY\"\270\262"
+	.ascii	"\016\022\30049\2152\244\220\251\021\021\021\005I\222T\206\335"
+	.ascii	"-4\305\240m \036\224\0367<\035B\322\034\0240\003\335\007\265"
+	.ascii	"\177\005=\354\362\345\356\rn\273\312\376\017\024u\003\306X\373"
+	.ascii	"-k\253\230[y\305\3437M\272\302\007\306\007\025\266!W\253\351"
+	.ascii	"\"b\337\030l\355\252\\\262|\373j\264S*p\022\340\340\tZ)\204\326"
+	.ascii	"Z\001\344\212F\343\226\001\323\332\020\216\211\322\207\324\233"
+	.ascii	"e\305\370\250\231\365\204l\277\317*\006\362\247\245\007\020\375"
+	.ascii	"]\003\342\025\177D\370'\372\312\r\302@Xh\031T\366A\262r;\002"
+	.ascii	"f\346\225\232\237\240\305\367@,\221\033\030\024zjf*A\307\216"
+	.ascii	"\361\200RF\341\371\212\247\200&{(\275\257M:\373\n]r{\270\361"
+	.ascii	"YM\326\317\036\362\247\020Wi\022\240\303\341\322\005\377\354"
+	.ascii	"\037o\310\211\021\023\256\021\340\246\243;\264\213\022\311r\026"
+	.ascii	"%\265X\355\357\326-\002\203Ei\205\367Y\030\272\"\203\177\200"
+	.ascii	"\323\206\3438?\312w\314\225P\246\317\202\020\321\222\356\200"
+	.ascii	"V\b}T'\200\006\372\317\023\341\253\331~\320\\\f\001\302\330\030"
+	.ascii	"e\225K\034K\246\206I.q\003\343\207\013\357\327\316^\354\321J"
+	.ascii	"\021\023+5\213K\202C\334\214\305\201]\314?\350b\326\262\360\\"
+	.ascii	"Pd\n\240/\n6\236\205r\b#!\340\324\016{l`\2403\321N.P\310\201"
+	.ascii	"Uc\305\345z\036\356\220\347\r]\001\272PQ\202\017im3\362\324\222"
+	.ascii	"-\"t\237\353\234]\244@P|(\312\024\354\370&\215\n\267J\032\366"
+	.ascii	"\006\006V\360\314\214\351\316\362C\243\226\244z\214\033L\260"
+	.ascii	"\257i\253\277b\226sk'r\344\331E\255\021]lN\fo\031\r\314:\007"
+	.ascii	"\200u\\n\3311+>\271\207|\236\327F\340e\3665'\034\305\322\313"
+	.ascii	"v\225b\345\374\213s\210l\370\bi&\027V\034[K\r-q]F\350\231*\022"
+	.ascii	"\222\373\005\310\231\322[\016\232\033\364\275\324\201\031\355"
+	.ascii	"~\005\371tQ\361\205\2168\265\332&\236y\244\037\240\020\254\357"
+	.ascii	"\026\034n\276\031\206R ^\324\036\261\023B\203\300\b\272\003h"
+	.string	"PO\336\370\365\001\304\005\314\344\351v\020\007\254\377**\2314\212C\340\270K\336yC\t$?#\203k\262\323\333aA\260$\036V\003\241\332\037Y<\214\276\354\230\300%\"\276\3209$\343aRIE\333\310"
+	.ascii	"\023\265\337\032\234\005L\201\371H \204%\303\213\257m\340oV6"
+	.ascii	"}\005\235\013\305\206n\200Ns/uMv\345#\242xmX \002{\203\307\003"
+	.ascii	"|+\370VQ\303\020\345\323"
+	.string	"}\021\327\246\266t/\215\304\\\300\306\370)\370\376\017Rz%\257yN\331\035\007/\245W\264}s\016\323\3423.\267i\344\241\032\260\312\266\270\266.j\025-\003\024]\004\032P`A\013\324\266\332 M\\\001\301\372\301\225 `PQh\b\210\341f9\212\225d\362\306\327W\224\t\201E'\203\371\327\3209\n\366G\002Kc?@\311\262\205B6\346\t\317\344C\345\317\033\t\320\004\232v\211\271\266\305g r\362\233\016\247}GF\361\317\247Dg\2672\305+c\306\f05\213MF\326\242v\325\375B\2321\374\bY\250e\257w\226P\220(\205\206\211u\356\343\365\005Q\020\037\002\003\031\013\205\005\203\343zHW\002fW\343\273O\312\r\274:\240VlZ`\363\262H,\301\373L\177\003\311\003y\241\360L\233\256j/u\273\246\277F\376\003\373f\243p\363J\rB\271\t\227\233\\\237L?\267\227\230"
+	.ascii	"\334\340.\234\017\312\276\224Z\b\340\236\332\271vC\2766\266\303"
+	.ascii	"\n\260\334\202-\253\365\215\307\002\177\210\005&\315c\351\n\240"
+	.ascii	")\374\267\017\352c8\261 \024\tu3\370:!\330\224k\006\331\005\351"
+	.ascii	"\250\005\346\370\036\301\314\n;PP(P\240\202`y- ub\372\270>.\241"
+	.ascii	"u/_!Py\214t\nh\336\273\370j\r\032L\233\266\311X\374\b\333#\334"
+	.ascii	"\002\253\205\352\360\357\034d.h\212]\0037\226+5Q\260/\362&\266"
+	.ascii	"I\030\375\215\234\177\024G*3\024\316N!\214N\242\020\b!_V\200"
+	.ascii	"\364vU\331^\246\364\375Z\306\237\t\231\r\002\363\260m\3341\302"
+	.ascii	"\261Q\205\001\373))\307\025\207\353\362\207\254\264\303|\267"
+	.ascii	"w\345\264rB=\304\257g \363X\372\365uV\223\331\013\221Gz\013\360"
+	.ascii	"+\375\302\376\255ne.\304X\364\217\356#\017|)\276\350\370\321"
+	.ascii	"\374K?\233\332\201\241\356\362\372D\205\3030\217\370\204#\362"
+	.ascii	"\274;\240.(\351\001\324\213^g\302\016\251n\021\037n\377X\273"
+	.ascii	"Yg\224\254@\356\240\325\304\331^\330\034\276\345Ex\332\361\255"
+	.ascii	"\273\205\035\257\350\256\345?\265\302]\316\307~:J\254\242\227"
+	.ascii	"P\303l\303\254]\354\365)\235\204Y\270}.\025\232\325\361\"\372"
+	.ascii	"\306\261}9\235\252\371\277\030\237n\201=L\267pF\352\313\344\031"
+	.ascii	"\302)\373\003\356\037\317\217\373\177{\316/gwc\006?cv\247_\362"
+	.ascii	"\t`\2004b\330\231\353u\323~\305\247\200\352\236\233.\263nvWe"
+	.ascii	"\370n\216\311\331\f\277.6\307 \023)\253\362\027\037j\315\034"
+	.ascii	"n\0368^\372{\256\217\346\226\370\177\325\257\354\255N\314\344"
+	.ascii	"\365\005\241\351\323\303\273\373\373\210\263\003\372n\245z\004"
+	.ascii	"\232\310\214\271W\207\025\354@\274#n\330U\177}o\0346\257\265"
+	.ascii	"\003\327M\226~\233\321|S\030\240\206\255"
+	.text
+	.section	.gnu.lto_.symtab.e772fbec9bd2f39d,"e",@progbits
+	.string	"nullFilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\001"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\001"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\001"
+	.string	""
+	.string	"pt1FilterApply4"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\001"
+	.string	""
+	.string	"filterGetNotchQ"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\001"
+	.string	""
+	.string	"biquadFilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\001"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\001"
+	.string	""
+	.string	"biquadFilterUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\001"
+	.string	""
+	.string	"biquadFilterUpdateLPF"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\001"
+	.string	""
+	.string	"biquadFilterUpdateNotch"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\001"
+	.string	""
+	.string	"biquadFilterApplyDF1"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\001"
+	.string	""
+	.string	"firFilterInit2"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"firFilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.string	"firFilterUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\001"
+	.string	""
+	.string	"firFilterUpdateAverage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.string	"firFilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\001"
+	.string	""
+	.string	"firFilterUpdateAndApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"firFilterCalcPartialAverage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\001"
+	.string	""
+	.string	"firFilterCalcMovingAverage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\001"
+	.string	""
+	.string	"firFilterLastInput"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\001"
+	.string	""
+	.string	"firFilterDenoiseInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.string	"firFilterDenoiseUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.string	"powf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"log2f"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\001"
+	.string	""
+	.string	"cosf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\001"
+	.string	""
+	.string	"sinf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\001"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e772fbec9bd2f39d,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
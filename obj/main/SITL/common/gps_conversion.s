@@ -0,0 +1,258 @@
+	.file	"gps_conversion.c"
+	.section	.gnu.lto_.profile.e513887d686501c2,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.e513887d686501c2,"e",@progbits
+	.string	"(\265/\375 7=\001"
+	.string	"\310+"
+	.string	"\002"
+	.string	"\377\362\204\342\004\016\002"
+	.string	"\002"
+	.string	"\002\001\002\001\002\240\342\234\212\n"
+	.string	"\005"
+	.string	"2\003\344\bV\002\004am"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.e513887d686501c2,"e",@progbits
+	.string	"(\265/\375 \027\235"
+	.string	""
+	.string	"h\013"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.e513887d686501c2,"e",@progbits
+	.string	"(\265/\375 I-\002"
+	.string	"\264\003="
+	.string	"\001"
+	.string	""
+	.string	";\360\311\260\236\002k\001"
+	.string	"\001"
+	.string	"\001\002\001"
+	.string	""
+	.string	""
+	.string	"\003j\203\377\247\347\002j"
+	.string	""
+	.string	"\006\204\200\200\200\002d\002"
+	.string	"\002"
+	.string	"\002\232\212\217\211\002f"
+	.string	"\004\002\013\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\342U\200\033\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e513887d686501c2,"e",@progbits
+	.string	"(\265/\375 \026\225"
+	.string	""
+	.string	"`\n"
+	.string	"\001"
+	.string	"\001\001\003\177\002\001"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.e513887d686501c2,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\265\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.e513887d686501c2,"e",@progbits
+	.string	"(\265/\375 \032\265"
+	.string	""
+	.string	"\200\016"
+	.string	"\001"
+	.string	"\001\300\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.lto.e513887d686501c2,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_GPS_coord_to_degrees.3.e513887d686501c2,"e",@progbits
+	.string	"(\265/\375`]\nE;"
+	.ascii	"jh\360\026?@\352\315\030!#)\221\267{\327(G\016\313\340_\313&"
+	.ascii	"=.\334D\300ni\246!\215\331\270\036\200di\333\033\354\273\212"
+	.ascii	"F\226\341\232\241A-\256-p\024EOK\243&$\211\224R\246\224Rc\001"
+	.ascii	"A\001]\001\335hzenf>\343\256k2]\246\363\372LG9\210\306\314)M"
+	.ascii	"J\273?=3\256&\217\256 a\b\3050c\303\351]\327-I\032\027?<Dx,\306"
+	.ascii	"\264\335Y\337\321H\335(\\^\312\220\370\265Zt\306\212p\326t6R"
+	.ascii	"\267\310\026\0273\204\\\027\312\240U\336\360s"
+	.string	"gn0\035\346\254\241fmt]'{i\\\027\332\200\261~\2552\364\327]\332\313\031\243\245\320(k\020\276\274v\213\\\027\232tj\344\332j\332\307\265\325\207\2226\222\031\315\211\fdb\247\320fUE\353&&\344\322Q\311X$\016\205IA`\373cW5}G\343N\353&\226\213\255H\032+\315\224&\355\311\322\366\300\210\336\236)\216\214\353%*}\244\222:\301\271\322\023\261\343\205\021\023\266\2706\246Tnr\2024\036\265*)\362N\023@-\247&\305\213Q\2208QI\017\335Z\350\226\304\223\224t0ew\374\250\322x\324\216\244Y\215\b\251y\035\310r=ak\353\326H\377\360\250\031I\235\236\344\324\2128\373\304\204\255\255\327\364\351\310\270\031\2569\323\255/[\244t\264\375\271\326t\025\213\220N\323-\327u\207k:\322TN\315\212\177G\033\371\244\256\317\314\232\220v\226\313u]\366\036kl\315"
+	.string	"\232\271\3570\263\017\346\037\236\377\377\373v\316y\363\336\272>\373"
+	.string	"\354\234r\352\257\337c\370\364\220I_}U\317\013\211\rZ\225\024fo\241NO\036\367\232\033d?*\3342^M\364l\313\341\221\270\350\314^_k\367\360\017.bt\245\371i\235\272\256\353\252W-\365]Oan\220\323\355\364\366\314\245\377\306R\337\317\254\233\243\303\0331\261\217k\326\367\363\201\322\354\273\233kz\244\347\373C\207\367\377\306\fMs\255,F\364\370\2350w\201\b:\177\360\320\201C\320y\203\206\f\354\314\205\341B\320\331\302V\005\255\206vg\001\235'"
+	.string	"\235%\260s\204\246k\206\360"
+	.string	"\253\357\232\257\034$\255\032T1\240\232\222\022:G\265\316P\255\363\202\326YA\353\234\240uF\320:?\t\235\235\204\316\007\032\257\331"
+	.string	"\320\271@\320\231@\3535\017h3\315\002\200\316\001Vg"
+	.ascii	"\255sS\353\314\364sF\262\316K\215\246\371\310:+\255\316\306\237"
+	.ascii	"s1\350Ld\235\207I\316\302\237sR\3209\310:\003\201\316\355\352"
+	.ascii	"\374k\235\331\326y\3759\253\254s\272:\277\352\354\356\334!\376"
+	.ascii	"\371\2229*r\335\037\221\034\271vT5V\232\256\373\256\033\257\333"
+	.ascii	"L\267^K\217\241\311\227\327\226\243i\254X_\341YE\203\234rPO\236"
+	.ascii	"\203\224\216\257\025E\244\216s\256-C\347\310Ht\360\006\254:\305"
+	.ascii	"\252\364]\367\247\256O1\320\033\035r\3702\2747\032|v\264O\304"
+	.ascii	"\321\031jxN\203\003\236\352\237T\177\374\337\203#\306\241\021"
+	.ascii	"fxN\223z\257\223\311/>\207\r_l:M\374\r\303'N\031R\275\206o\333"
+	.ascii	"\f\032\376\233\234v\360\031^m\323'\374\267\275v`\344\263R\227"
+	.ascii	"\004\264z\001\377\344\0248\365\003\202\377\306&\352\274\321\026"
+	.ascii	"\304k\341\275\321\265\367\332\352\237G8H\255\207\017\302\271"
+	.ascii	"\255Y?%g\025\276C\252\2433\365\307\027>k\327\347\324\342\256"
+	.ascii	"\353\246\001\377\215;\332\"\340\004\375:<\247l\357u\203\006\237"
+	.ascii	"\364 \276?|\322\373\231\027R\211f6k\360?\274j\347t\003~\360\233"
+	.ascii	"J\n\340{\240\253\236z\017\337\262\211\344l\377\255\303\253l\024"
+	.ascii	"9\345\270P\242;N~\377\3066V\253\366Ad\311!>?:\274Q\263\251*\365"
+	.ascii	"\307\177\232\275yj\372J\377TA&O\3757\376\223\271\233@\220/[\326"
+	.ascii	"\177\343\317{\363\322\256\247\360\346y\326K\375\263\243V\t\337"
+	.ascii	"\321\006\032\252\363St;jm_\302\263\277E\232o\224(\310\326V\333"
+	.ascii	"\357g\033\033\314e\231\027\323"
+	.string	"+F\330\t\260\027ac-\206b\312\2610&\221\214,\214)\026\006\006\203%\013+\223\241\034\033\361\302K\271\034+\373\362b\2660\326\b\003Sv\225\215\211\215\201\001\305\224c\314\262\023ae^\31210\346r\371U\344/+\345r\214\214\0316C\271\374ZA\026C,\251\\\302\200\261\374J*\307\274`$\277\230dI\253\004\274\214\021\306L\226-\227\314d\220\231\031\352\366;a\245&=\336(\023\327\233\350\033}n\2645B\204\367o\236iBb\375V\2317Z\354\276~\020\365N\317\365\355t\203\372\250O\317\254\013\036\352\005\004rrQ\360\b~\301\263vN\267<\t^\301\203O\360\001t@\237\036\201\201\177J\361\304\271\215\266\036x\247o\247\234\200?\360\252\030\273f\037\323\2771\261\307\022\006C\216\336\250\261\367\032\302U\352\245\314\0335\362\022\203\037Z\001c\324\372\252\177V\325I;\304\327\311Ah"
+	.ascii	"!\207\\x\034\217"
+	.string	"\336\250R\205\277R\345Dz\243\307\255\347T\251\352\031\330X!<\206\257\001\246\331w\347K\025\276\300_\260\360\005>\235C\340-<{\306\351\326$\360i\242\027R\325o\2752L]\337\335\334\021\310\216E\3078=!D\232!>?\r\247\003\374\004\022(\0024\275\361\001t\233f\372\246O\3658\345\220\317\364PK\217|\267{\022\200\323\250a0$\rDfjf\244 \005I\n\035`\002\031\252*\363\020`GS\223\326\300\237\360\0162\027\024T\367\367\033`S'\314\r\231\215\220@*\272\333\202\033B\266\317W>\210\207O\260<\303\313D\017+\016m\242\220\031y\201B6\354\207\216\246\205\217S\246\225E\b\342\003\030`>\254\235\027tt\340\201\004\001\262\363\266\373\333'T/0\0302~FI0\243\245E\022\217f\216:(tr\322\311\032_\306z\272\331\003S\245\nQj-\344X\300\363P\310\256"
+	.ascii	"I\361G\020\240,i\341\267(X\3622\322\216ZP\256aF\241\320{\356"
+	.ascii	"b JLYS4\303\354\25286\025\177\005\001\242C\213K9\201\244\237"
+	.ascii	"\321r\f\241\024\020\207N\312\231y\250_\322\030\254\261\356\347"
+	.ascii	"fE\001\r\021*i\031<q\201@\307#[eB?@\036\234YvV`u\322\1778\361"
+	.ascii	"k\256\ne+\323k9\231\303\215\371\311\001t\376\225\346b\335\305"
+	.ascii	"h\201\306#\022\311Bc\272\272\343r\004.\0203 \364\257\211\234"
+	.ascii	"Y\374\r\265\372\n\377\257\034H$\027\346F5\021.;9\027D\237\023"
+	.ascii	"D\256\225\340\212\200\227\302v;\250Dg\234\005\234>,`\372?\353"
+	.ascii	"J\0062\277\\2\210V\325\255\266qV\325[d\320\344c\323y\324*%#\376"
+	.ascii	"\001\210\315\247\341 \271\341\223Kc\026\006\001\331 \002\364"
+	.ascii	"\235\243\256\240\027T\330\310Q\201\021\3733\027\273E\235\277"
+	.ascii	"\262\250Ky\217\261\326\223\227\372n\304\312<H/\206\242\247S\310"
+	.ascii	"\001hZ\217\n"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e513887d686501c2,"e",@progbits
+	.string	"(\265/\375 L\025\002"
+	.string	"\002\304\r\031\260'\035\f\303\314\nI\036G\001t6[%I\314\221Ls\016\331{\313\024\023\241\265-]?\265}\2409g\374Y\fF\347'\242\312\3373\006\203\344X\352\212\376\205\002"
+	.ascii	"H\t\241\f\224\001"
+	.text
+	.section	.gnu.lto_.refs.e513887d686501c2,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.e513887d686501c2,"e",@progbits
+	.string	"(\265/\375`\b\005\365#"
+	.string	"JGx\017G\200\234Q:\277\334Z\032\265)\203\213\337\254%\307b\fz\226\306\242\r\227\333\270\235\253Sl\\\324\026}t\231\205\312\342`\221\035\215=\374>\243\244\335\331\2629\214\242W\355\f\017\320\252ge\021\312VNHF,\221)\313"
+	.string	"\343"
+	.string	"\342"
+	.string	"g\226\360\206\235/^jUp\020Irk\264/=Or\220%\027\271\313\271\213\271|\202\205\317V\255\266\322\335\334U\241\355\366qWmO\267\257\306\314\200\231AI\005kI\227Y^\303\3713\327\226"
+	.ascii	":3\330\350!\313\237\267~\256\302V\2308c\253\332.v\337!\323\030"
+	.ascii	"\347"
+	.string	"\256!K\276\302X\370\032\261\226\263\026o\371\217\357\336\333}kAoV8\\\310R\210\211L\022\351<g9\201a[8y\236\215\314\331\361\310F\346/\023\231'\023\330\362\277\353?\331\234\377F\377M\374\037\361\377\301\377\022\377\025\374\3572\366_\314\314\177\002?/\371\037\366?\315\177\260\377\304\377^\376o\3757\377\253\371O\036\217\307\343\177\027?\337\376\022D\263\013(\322\r\034\303s6\021\343\353A\226\377\213ZJ\367:\324\267\203,q\270\262[a\302\241\333A\f4QH\263w(,\333\225\354\333\334\277\241p\005{\333 {\333U\250\177\355\332}\205Bl\321\2672K\034\nYb+\034\352_\257M\364\0059\177\255\220]\323\n\205X\242O\310\376\206\302\241\2521,$\254\230\226\025\277a\177M\003x\345\013\n\031\331\333\366X7\027\251:\330\240\373\252\r\216\371v\260\327\224\221\306\324\027_\313\267\273\021"
+	.string	"\247\260\332\376\031Y'm\267\223\251\247\356\n\3535\266\0216\256B\256\272\212\252;A\337n`\367\312m\354\356\265\273\201\202W\267\233\207\020\233\005\004v[\035"
+	.ascii	"\366\325\372E\325M\026\311\274\204,\021\253\275}q\021\263:\306"
+	.ascii	"]9\253\307\206\301\223\270j\351\252;\001G^`\2529\277Q\303a\254"
+	.ascii	"\3255\006\300\0012\006JY\263WG\345\027\0240\257\3479\207q\001"
+	.ascii	"Q\205\361)\222%\2739\033\177\032\371U\306\203\013\306\311l\316"
+	.ascii	"m~\032\315F\214%^d"
+	.string	"y\262\327\374\264Y\r,\030^e\347\231\354\3749\315\371r\032>\223\241\330\345\220#4\230H\351 \032\bCJ\214Q\310\362<\345<\203\3410g1|Y\f\2031Ou\377\340Q\033\236\351jR\326VVG\001\352\254Rfx\235\301\376\t\026\370L\200VpA\007\230\035\262\344/\036\303\367\210\311\234\313\260\231\323~\267\2114\261;>\212dY\304Df\311}\236\217\314\332\361x<\362\221\371<\374\345?\255\026E\317\f1\262|\212\363\344o\266/\330\3356~n\007\247\002\230?\237\177\230\217\376 \236q\203\377e\007*.\351\246\342\224\200\376\204dC\233\244\240r;\235\215\327\223\262\021\251\275]\232\373A\301\204B\225-R\336\223\232\356\200r)\024\356\004\016U\361B\315\341pA\177B\3620\242\203\b\233\212:\361\230\324\242\024\271\024j\003\312K7D\241j\357\205\210\332\035<U\201\362lj\232\362l"
+	.ascii	"T\334\004\n\352N'u\366P\224\347\2046\341R\025\327\304K\323\034"
+	.ascii	"ND\b\016\005\236\323\361\320\035\352t\276BR\204$%\027@WZ\222"
+	.ascii	"\260$\301\274\322\322\355\266\224t;\237t\233\361\230\236r\245"
+	.ascii	"\272\323\0255\241;']o'U\244\362\322\247\336\200c\300\260\241"
+	.ascii	"\210\304\007\016g\016i\227\352z<\224\305.\315\341z*\234l\273"
+	.ascii	"4**\315\331v:\246([\216\327\263!5\370\005`\004b\347\016Y\030"
+	.ascii	"\200\036}d\310\031\353K\"\341\323e\213\221\223\343\260\034\276"
+	.ascii	"\013X\354\326\202\372L\351C\0069\317\013L\016A\250A(C\214T\304"
+	.ascii	"\030\201RD\"!\222\2410\017\220\002\031\2622\035\021\320\311 "
+	.ascii	"\245ZZ\366\357,\320$T\344\311\346\302\3205EV,U\365z\261\325-"
+	.ascii	"\360\301\037\307E7\"\3166E\252\215\r\206K\n\016F\016\230-l_\366"
+	.ascii	"u\300\275\013jT\025A\375?m\326\341p!FC.\275\236+# \200}K\304"
+	.ascii	"5\310\315\223$\034\025\220Bq4 \360\323\022\361&\0055\275\255"
+	.ascii	"o\343t\240\024\026\217\n\007\210XD@L\216\357\232\201pVV\213\236"
+	.ascii	"\211\343\336\216\303\366\226k\n"
+	.text
+	.section	.gnu.lto_.symtab.e513887d686501c2,"e",@progbits
+	.string	"GPS_coord_to_degrees"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327"
+	.string	""
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331"
+	.string	""
+	.string	""
+	.string	"__ctype_b_loc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e513887d686501c2,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,281 @@
+	.file	"huffman.c"
+	.section	.gnu.lto_.profile.f4a239d1dac9275e,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.f4a239d1dac9275e,"e",@progbits
+	.string	"(\265/\375 \216\225\002"
+	.string	"4\003\202"
+	.string	"\003"
+	.string	"\374\230\247\260\003\016\002"
+	.string	"\002"
+	.string	"\002\001\002\001\002\002\002\003\002\004\002\003"
+	.string	"\002"
+	.string	"\001\361\212\334\223\003(\002\005\002\006\002\005\004\002\006\240\342\234\212\n"
+	.string	"\f"
+	.string	"7\003\260\337 !"
+	.ascii	"\310\267\243X\t\3603\037 \002\245Fo2\300L16\320\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.f4a239d1dac9275e,"e",@progbits
+	.string	"(\265/\375 8\255"
+	.string	""
+	.string	"`,"
+	.string	"\002"
+	.string	"\005"
+	.string	"\003\001\004"
+	.string	"\003"
+	.string	"\003\020"
+	.ascii	"\035Id\303\002"
+	.text
+	.section	.gnu.lto_.inline.f4a239d1dac9275e,"e",@progbits
+	.string	"(\265/\375 \2555\004"
+	.string	"b\b\035)pU\222\016\234\312\320\363\013\226\221\037\233\341\221\323y~]=\272\373iH\023\177:U\364\276\377~\177\263\373\335\020\t\2212\005K\\\232Q\315e\300\322n\267\233\340\275\216R.*`\360\017V]\037\n!\370Y\262\033\330\227\263\t\351Y\234Na\276\242ww7\336nt\223\221X\275wQ\314\335E?\025 R\205\016\354\217J\3069U"
+	.string	"T\361\020\276O\002\005"
+	.ascii	"e(\365U\271!\256OH\030f\003m"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f4a239d1dac9275e,"e",@progbits
+	.string	"(\265/\375 :=\001"
+	.string	"\310."
+	.string	"\002"
+	.string	"\005\001\377\007\177\002"
+	.string	"\177\002\007\177\002\001\003\001\004\001\177\002\006"
+	.string	"\005"
+	.ascii	"7\213\350\274\221\322\036,\002\003,"
+	.text
+	.section	.gnu.lto_.pureconst.f4a239d1dac9275e,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\232\004\001\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.f4a239d1dac9275e,"e",@progbits
+	.string	"(\265/\375 8\035\001"
+	.string	"\270,"
+	.string	"\002"
+	.string	"\005P\374\007\374\005"
+	.string	""
+	.string	"\001"
+	.string	"\b\b"
+	.string	"\001\004P"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	":\271\311\345\330Y\276\001,"
+	.text
+	.section	.gnu.lto_.lto.f4a239d1dac9275e,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_huffmanEncodeBuf.1.f4a239d1dac9275e,"e",@progbits
+	.string	"(\265/\375`W\b\2050"
+	.ascii	"\352U\330\022E`\\R\007\361\274\351\300\017\272\202\246\027Sk"
+	.ascii	"\241G;t\034hz\326\243C9JT#:\237In\370cV\346\254-\033\006.\240"
+	.ascii	"\300Y\004\020\b:\257sf*\347\370\303\376\235\017\210Z[\302\335"
+	.ascii	"\366\336I\246\024!\001\013\001\032\001$\332`<Ei\\@[\013\341:"
+	.ascii	"\273\240\t\352l\3175\177Ep\302\306\227s\032\322\331\366\340\256"
+	.ascii	"k-\356.Xi\271\325\230\257\200\b\201z*.\202\214\371\212\252\025"
+	.ascii	"\001cWk\271\016\346\034f\007\227sN\352\005\216\273=\212K\201"
+	.ascii	"z\032\f?\346,&\005.\347\264\244F\272\316v\232\373\304\321\240"
+	.ascii	"\335r\027f\254C\320\260\252\364\345\234\223\003\374\247uv\365"
+	.ascii	"\236\326\331's\0376\260Z\255V}M\363.>\324\217\306\235\"q\370"
+	.ascii	"\n\203.\260e"
+	.string	"\327\307\320v!W\f?\226\271q\375\311\003\302\306\365\266\312\326#00^\376&\004\357\374\210\213\342\"\230\023\327W\273\342\305\365\266|\254\021\2400)\273\302\303 ]=\374]%\230e\375\340 '\317\317\266\312\260\360lk\007\016\362 p\266\245\003\273\004\302\272\276\034\250\267\365\265\016\300S.,\334\342p\266\310%]\007\344\234_\256\031x\305\363\365\254\356MXW\017\177\217\363\243\2667a]`\216\201O9\347\306Y\\]\336<\336\355\313\356\316\352\006\202\b\217\337\261\376|\214\210\022\256\213w;G\222\331\233\356\bp\204L\355\177\354\331\266\213\201:yb4E\332a\264\316\372\233c0\261\27682p\265;-\006\376\261n\307r\336\372\372\305\272\233\\\315\275\001\003\246\245d\022\222\323y#\275\316\373\310\327\334\025$0r+\356\b\234\212\373\001Os/\200q\027\371\2357\221\317y\017\371\026o\241  "
+	.string	"?>=<G\243S\361\336\301\270\213\03071\210{\030\304\375\276\270\205\316\346\035\3646o\027\350n\336m\0207\273\342^\205\270_\210\033\007q\273\023S\220\236\275\234mT\353d1l\334\021\277s\237s\247s\257s\337\342\316\346\336\346\356\346n7\230v\274~\357\272\3249\r\227K\273\027\377\342vu\3159-/\350V\360\271Yuq9\250\317Y\255Y\310S\027:\024\256\263F\354p\355q\375:\273\005\255\315\204\353\254wC\333\263\270\026\177\353\267\273\335Zn\315k\024\316\242\360\345\234\0039\347!\3217\375[\305\313\353\301\321My\211\276\370\177v\364\305\027\252\202\273\317\217/N\370c-\364\304\307C\250xJ\216\340\211O\304\272\342\301\037\353\242\226\031\320\263?\333W\253F\273\364"
+	.string	"\222\226"
+	.ascii	"\231|\276\347\247\216\347\030\214\340\001\031|\257\355\361\215"
+	.ascii	"?\355\356n\360\306\307\3241\3240W\330\317E\362\3433\370v\215"
+	.ascii	"\024,\212\253\355n><}\034\302\022&q\230\334\347\231\236\305\021"
+	.ascii	"F\252$\n\364<_z"
+	.string	"L%\243\246Ar\240_z\326\312\025\351\037\222\017}\362Y\271\252\364\257\035\276O\026\034\031\270\332@\377\376\360_\016\313+*\346\303\323}\237\275q\306\337\310\311\033c\215Z\341{\030U\315\025\366k\344\017\275\360\035\317\017\334\b\203\365\025\3751k\324\330V&\337y\244\177\257\252TI4\312\323\254p\220D\376\003\262&\354\037=\276k)?S\302\tM\316WN\355fX(\225\234mo\321:\313\276S\232(\377\n~}\227*Y\275\355Z\374\377l\033\351Y\024W\333\003'N`\246R\303\253$\321\234\340:\227PN+\245\023\270\\b\247\262\352\225N\027@\347R\231bDT\207!S\251\201\271d\247\236P\314%\313Tj\bN=\241\234\317f\333RJ\314(\252\251\251\247\211$\263IE\325\224J2\227QTI\251*\253\244RQ7U(\253\222\316f\263*\371\246e_w\200\025\216\374\031\2156\330"
+	.ascii	"\023*yQ\321\367\223\214\217\036\177\254\201od G\265}+\311\236"
+	.ascii	"\261"
+	.string	"\030\364\t\212<\017\374\351\236'8R\351\324\225i\263\363c\035\034BL\262\200\305\r#](Xf\206}\317\203\\\013Xj\340\002\377Cl\337\337\334\310\fF:\317O\335\316+\224\375\021\221\276W|\340w\020\274P\320\214\200,-$\305!\320\007\177\332C\237w\177\332\353\360\370\355O\205>\351=\316\025\210\235)\362\202\302\204\370c\375\262\275M/\314b\366H'\312@\344\357Mb\310R\343q\316n\325\016\001\370\376\240\007\352\371\376\237\367\371i\277\306\357\365y\376\370\323\243'z\237C\005s\205\375|\315\001\200\257\250A8\245\fc\310\320\214L \243IZ8\200\002\23193m\020X\210f\223\244\003\274\244K\001\334\226d\321\316\020Rt\342\"R\364\227x\231\363&\225\330\005\031\273|\223\366\"*\376\211\321)\03322\024e\261\0250\265\312\2260X\315\201\220\213EV\206bc\337z\314t\306D\211"
+	.string	"\"V[\214\371^^.k\214\366\203p\2230\321`\f\316x+\347\204X}\374c\235\216\b\275\217\231&\357\345H \003>\305\216\026\363\354\013\224\373\020\277\020U\342\271YV2+\213\370\250\341\324/\237[w\004\255\341\007\027\2060\030p\357vS\005O\354\352\361]m\276t\240\342S&7\3739\005\t\212\033\211\200|\352\213\353\257\373\372\232\3234,\001\353\364\337\032?0\226\237\301\341\325\020\030^\270r\212"
+	.ascii	".\265\303\323\313\367t\361\275\372\3465\022\255o\211g\211i\302"
+	.ascii	"&\024\351\0324\203\311\363r`\261\243\0330\212r\271{\204no\326"
+	.ascii	"\006\024\"m/e9\017\344\t\344Z\016~>1\314\273bN\301E\343p\233"
+	.ascii	"&@\232d\023\337T\004\223\360\220:$U^\016=G\037\344\323\374\007"
+	.ascii	"\373z\323_\211\23135\316PW\362\215\227\277\334\n\305\031\202"
+	.ascii	"\241^wV\377\003"
+	.text
+	.section	.gnu.lto_huffmanEncodeBufStreaming.2.f4a239d1dac9275e,"e",@progbits
+	.string	"(\265/\375`\344\b\2150"
+	.ascii	"\272U\324\022F`\\R\007{\222`#F\372\f\210\356\371a\266\276\021"
+	.ascii	"I\352\"\nKC\307\267\271_\251~\251\356\247A\215n\021){bQ\237\301"
+	.ascii	"\327\217\1778\300\301\337\367\364\272ho\233\320\233\b\303\311"
+	.ascii	"6W\223\275\367\336I\246\024\033\001\005\001\037\001mP7\300x\245"
+	.ascii	"p}\365ng;\025\257\322ow\263-=?\265~UjX\037\\_\223\0308}\255\351"
+	.ascii	"f#\355\024\261,49G\215\276\266\005W\225\002\243\013\204\307\016"
+	.ascii	"\245\341Tb\246\022+\223\346\234\025\264\003\374\004\252H\314"
+	.ascii	"Tj6\220\034w;\324\2358=*\303ur\036\273\223\346\034U\320F\327"
+	.ascii	"\327\216\272M<\315\331\r\247F\313\266\\\254FU\024"
+	.string	"79\347c\220\373\260\276\252\316\303\372\372A|\352A'V\243\336\303w:q(\f\002\337\234\237\333\262\253\372\330\331\036\345\3042\351\024\036\372p\341\027-0*\034\024\002\302\325\303\201\255\204\251\265\2750\2562\177\325\bD\254|hX\203\227\243Bx\323\221\345_\264\276T,$o\317\315\264v\340\037\017!3-/\354\n\205quy\373E\253K\r\302W[U\230\325\341\253p\353\251\006\345\234\337\255\031X\255\363\nb`{a\\=\374]\352\253\230\327^\030\227\017\307\255\204\234sc\253-.o\035\357\366\f\335\215\325\335\366\005k\201\177\3205\275\372j%\277[\2729\347\006\355vN\350\322\2011Cd\260\276\n\275W\361!\274)hP)<\355\216F\341'\353v\240\224\254#\375c\335IF\004\036\347m\344s\336E.\305\375\200\267y\0239\024w\003\376\304}\310\327\274\0138\233\267\220G\335\203\0367"
+	.ascii	"\247\363.\372\2337\220\273y\377<n\037\214\273'\210\233'\210{"
+	.ascii	"'\210['\210\233\310\342\036\262\270\205/\356\340\213\033\370"
+	.ascii	"\342~_\3349/\356\037\213\333\r\342n_\334\254\212{\005\342V\201"
+	.ascii	"\270\377\305\215sp\373\202\226\007^\361L\316Y\3237\331\313\232"
+	.ascii	"\245\210\323\271\277\271\307\271\317\271\267\271\273\271\257"
+	.ascii	"\271\263\271\333\315\245\275\256_\272\206S\003\253\341bi\207"
+	.ascii	"s9\337\322\357\\\223\033\245\345\262\201\371B\223s6\3468%\326"
+	.ascii	"\324\016\030\236\305\2658\375\315\311\315R\327J\215\207\322\365"
+	.ascii	"\225\210\335J\373\025\227\366\353\253\033TP\024\232\224\205\353"
+	.ascii	"k|P)W\347\273=`)'\001\356N,\361u\300<\370\324\211\370mT\335\032"
+	.ascii	"o\307+\361\333\252[\242f\370o\226\002\220\\\370\303\307m\317"
+	.ascii	"3%\357[\n\277\215\222\343\203z\366&\333\006\250\335\223[\242"
+	.ascii	"\246}\262\366&\033|#\033J\324\362\202\257\246\351S\346Vi\200"
+	.ascii	"\037\374\357\362\214\223\006\370\353\21784h\002\007z\343\207"
+	.ascii	"\370\272{\306a\337\357\261J\223\363\277\177_m\253\3021\365\301"
+	.ascii	"\3174s>A\0364\331\374=n+\343\272\277\356\275\241A\245\234\215"
+	.ascii	"t.m-b"
+	.string	"\333\367052T\270\257\215\036\350\333\367:W\263xM\253\272\246^\357\207\0217\352\2235\b\317S68\032}\033\325\306\007e\277\350q\227\2528\"\\\f\t\006cr\246j\320\036\2069\342\b\006\353+\373\f\362\240R\177\340\327\367\347\231\352M\307\376\253\277\352=\315\360\377;\230\r$\\\250\367-\276\246y\311]}\r\340\312\361\374'\373\241'z\025\316\363l\nO\333\300\373\307y\271U\305q<gZs@Y\373\222\365+V\340$\362\302\213<\241\244\3402\231&0\227Hf\273T\272\370\023I\344?13\f\221\314\030\023\230M\f'\220/\224\226@d\013\023J\035\200I\344\205$\323\212\2429!\311\264\"\231J\314\345\332KGI\245&\024(\232*\216IeS\223r\351\230dRj:.=-\217G\002Z\351\002\371td*\225O\3077\232\375\307\332\253\270\213\006\315nht/hX\357\221\003"
+	.ascii	"\360-A\352\247\314\210O\326H}B\004\337~\341\241\377!\372\237"
+	.ascii	"\007\206\021\030\263C\033\"\371"
+	.string	"\317#x\227z\0050/\267\347\331\216\235\033\r\341\223\365\313\006Lz/Cb\346\215^\374+\257\363\337Y\022(\320\370+Cr\345q\316\356\304\002\375U\321\027\337\331\250\325Q\341>Ws\3169\230\300\213\237\364\276\304\253\315\343\351\221q\003,\360?\356\370\272^$Q\246o\361}\036h\346\310\213\336\347\003\300y\202M\341)\326k\023c\222\363\363=\377a\324\354\234\316\303\022}\317\027\341\370\357\311\232\347w\356\2729\340'\317\037\345A\251\234v~\305\263\013\200\251\250A$\310\224S\b\t\215\314h\222B\2061\220\002\0219+n\021\0205t\022\315&)7\334D\357\303\017nb\300ESa\334\034\220\372\210\t\374\264\256\232j*+#!\027\377\007d\236\234\005+\260\247\306R\006\360\204/\274;4\267V\313Z\327\314(\033p\277FY\205q\204\243#7\031Z\n\003%\005\274P\326\324\f\024\364`$\367"
+	.string	"\255\302\002\np1T8\230\217\034,\351\242\002L\020\256\373`\001\034\251\222(\360L\237\250\271\004\314)m\374\254\246\375A\364\256eQ\241\f\310\233\301^\327h\251\206\237ji5E\"}\360\221\025\030\251\034*\324\t0N\250\232\226A\306\372\205\212\b\2133\212\200\232\007\363 7\305J\210\003i\020\t\032\341oK\335\3061\"C\026l\231b2\341\353P\204\340\367\245\253"
+	.string	"8x\345s\200t%\310\311\352?\210\032"
+	.ascii	"'\366\217\030P;\220\275 \025\252\233\214\333GC=\313g~I\254\273"
+	.ascii	"\203\341)\303A\032\242\271\363\345p\223\201\224\323\357\360\371"
+	.ascii	"\2459b\020\004@5\251X{\253?\315\220W\306\264\201\013 g\"f\313"
+	.ascii	"Xja\030\206\206yl\317\374\360\337\024\314\361\204\273\033<\314"
+	.ascii	"\363\340\224\257\272\201Yn\033ui\352\314\037"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f4a239d1dac9275e,"e",@progbits
+	.string	"(\265/\375 =\235\001"
+	.string	"\244\0029"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\001\177\b\370\317\365\002\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\002\177\t\261\217\306\f\005"
+	.string	"\n\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\240Mj\3151"
+	.text
+	.section	.gnu.lto_.refs.f4a239d1dac9275e,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.f4a239d1dac9275e,"e",@progbits
+	.string	"(\265/\375`V\b\r0"
+	.ascii	"*W\370\022G`\\R\007\377\244\357\b\005`\200J\241\342\366=g\264"
+	.ascii	"F&\370Z\200#"
+	.string	"y\002\241\005\016\333\242\346I\322\026`\261\274M\226k\265\351\241;\233/\030\377\335y~\r\230\244\334\006\247\363\005\331\356K\325\231vl\356&S\n\003\001\031\001\034\001\237;B\267\260\033\302\004_\363'>\366\203\374\317\302\332q\343\246\260\344\375g\037\"\"UJe'\267\252N\305\321<\013yZ\373\231\233\265\357\230?c!n\236\220a\265?\260\355Bko:u\241\2657\260AN`U)\260\035d\261\017X\201N`\355v'@<\031\207\262\253\354\331\223\001v\207\226uh\320\020\322\304j\267\223u;\023\377\362\261\336[\325\374\263\377\334\203\341\270T!\261\352`\036\346\031\310\305\032\302\204\356\271c\377\365\237y\002\274Y\362\206\rV[\210mo\322<c?\2411\333\016\264\372\324\201\326\316N`e}\300[w{\371\322\335s-`,\251@\267W\351n\265\356\206v7Yw/\350n\022\335\375\323\355"
+	.string	"\272}\355\356\264\356\026\003v\273\230n\367u7^w'u\267\264\273\333\272\233\255\273\257twYw?\273{\254\273s\272[Kw\367\246\323\351\264\273\343\272\335E\367*\r\377~6\365K\005\377W\315\245\364\230\303\323\220\321\031H)\307\246\347\3777\240Dr5?\031}\2174\377\217 \235^)\301\315\321\007\342Q\267\353\352\253\246\376\017(\377]\377\350\377\273\377\217\263\274\312\377;\200\257S\251\374\267\362Q\376\225\2536\365\217\317\302\2441\337'WS\250\346\344\351\374\030\331u\347K\267\226\354\323\025\373\252\377w;\326\311\264Q\007F\372C#\367\262auN\007\254\b\032\027c\333\277\272\205q\276\305\311~\220o\207\25707\213s/>\346Q+\013^g_\034\316\345\374\315\263\307\271[{\027\217\266O\376O\376\277g\321\322\304\031\347\\\\m\307\367\337\004s\376g\"\"\037\"\"\227\272=\324"
+	.ascii	"\250\355^\254\373\270\020\266=\213m\307\301\266W\261@\037\200"
+	.ascii	"\205\314\367\314r\347\326&\304&\255D\371b\273\002\240\n\027\245"
+	.ascii	"\033V\241\331'\200\026\233\035?\260\332/X+^\305\263\2579\224"
+	.ascii	"\366(.\245q\376\177\376\177\273\231\257\371\024W\363\350\217"
+	.ascii	"\013_K\350>n\332\254t^X\322\271\317A\002\367\206\261q7\354\314"
+	.ascii	"A\325\006\253\256&\017s\261\355a\\L\373\230\036\343xn\365\275"
+	.ascii	"0_5\256\362\336\312j\350\207\346\225\344\335\265\3435T\347\377"
+	.ascii	"\353\377\177|Wxh\336\260\352vN\346;c\205\005\305\252\3275\024"
+	.ascii	"\347iM\311\300\252\237\3612\035,Lt$\261\352t\r\365\272\260#f"
+	.ascii	"Xm<7\323\335\277\037\221!_\270\314\224\321ARw7\007\355U\213S"
+	.ascii	"\013\212U'\343P~T]f\306\340\261\215\273\327?.\377\277\206/\377"
+	.ascii	"\022\251\323\356s\037\352\016\340=W\320\335\352\367:\001\335"
+	.ascii	"\177\226\363\2165\202v\344\201\325\356\016\372V\362\357\366|"
+	.ascii	"\376\345\373\334r\337\2627fO~\255\002\377\354\3727o1\325\346"
+	.ascii	"\343\317\357\237\334b\256xss\371\346\246\013\374d\323\375\317"
+	.ascii	"L\340{vt\375}n1\337g\223\331\363\311w\377y\324b\223M\346\273"
+	.ascii	"\245\311\004\276\317#\363Mn1{\260\234>\300\250\304\034\275\334"
+	.ascii	"}\223?Cyu\\\002\243on\2764-\361\251\327N\016@$y@\n\266\303\023"
+	.ascii	"\306\2456\250U\202\020\001\005S1E\206\241\261\230\001j\330F\265"
+	.ascii	"@\3429A|\202Z\032\032[$\003\315\324$\205\201\250\001\330LO\306"
+	.ascii	"!qx\202m\tE\r\212\214X\340\264\321\321\203\243\007k\033\035\t"
+	.ascii	"\205GEB\266\213\204\275\266}Z\243\224\206\355R\213\324\266O\306"
+	.ascii	"\021Q\303\266E\t\235a\333\002\2078\004\321$\205\241\225*\376"
+	.ascii	"\332v\372\351\242\212\2411\330\026\213\306`N\253T$d\325(\245"
+	.ascii	"a\212\022KI;\304!\210\241\211\"\023N\253d\324\022\237\244p\272"
+	.ascii	"B\205\fA\"Bp`\231\034\020\227\240\232\232\244\234\202\304\"\024"
+	.ascii	"T\221)H|Z\202\n2\031\243\202\016\0204~1\225\347\206b\031<;ns"
+	.ascii	"r\3224,\013\234\206\2569\347\244e=\271\201\335\366\214]\fCM\346"
+	.ascii	"g\256eApl\311\373e\033\203\236!\321$X\305G\214\364<\204\223\277"
+	.ascii	"d"
+	.string	"\376\347O\316\016\353l\n\333>\264\362L\247\323\251\017\255\215\301\322t\032\237\262\300G\302U9}\256\f\033\332\233\366i\216\023)\371\f\253\276\306\335\340\254]\025i\013\200\223\250\2210\205\2204FDh\002\021\222$I\016p\002\021*+\333\021\240\261qdL\244IAj5\006\257\371\024.\025\364/~\371\330\2518\273D~0D\246\213\217\036\357\354n\240\222\240q\330;\344U\177\004F,\247\245V^~\300\360\307\310;\317c[\322\361u0F\bT\n\271(\035\271\002t\323\n/\t\2537\345!\307j\233`\"E\301*\016\354\301\365\013\364\233\2349\220\016u\230\324\202\212\254\f\275\313\016\232'\375=\210=\004h\301f\366\b\005sC\310\275\203\233\333nx\037\237@C\307q\257\263\371\361\002\251\206\342\241\370\022n\342\177a\270\2230I%J]\206\201\b\224\272\024~ky\314\025\245\222\355?jV$"
+	.string	";\n\332\243\357\262,$:\276\357\002\344\036.\230\224=\007\004\013p4\216\330\217\177\367S"
+	.ascii	"\306<\361\\\270s\204|\256\366?\271\37038\007:\373\200\236#\255"
+	.ascii	"\262\216g%&\355\2019(\230\244+~\364\227\321z\357\232\233\304"
+	.ascii	"FDw\006\321\277\336\211\020,H\306\034\276My2\372\323I\013\330"
+	.ascii	"\001c\205`\351eJ\356\322/\214\206\335\002gP_Y\374\001"
+	.text
+	.section	.gnu.lto_.symtab.f4a239d1dac9275e,"e",@progbits
+	.string	"huffmanEncodeBuf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365"
+	.string	""
+	.string	""
+	.string	"huffmanEncodeBufStreaming"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377"
+	.string	""
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f4a239d1dac9275e,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1358 @@
+	.file	"maths.c"
+	.section	.gnu.lto_.profile.59b44ce9b1e09c2e,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.59b44ce9b1e09c2e,"e",@progbits
+	.string	"(\265/\375`\324\005\205\n"
+	.string	"T\017\310\006"
+	.string	"\036"
+	.string	"\341\333\245\345\002"
+	.string	"\001\237\247\223\212\n"
+	.string	"\002\337\352\303g"
+	.string	"\003\203\270\227\357\001"
+	.string	"\004\264\245\347\210\r"
+	.string	"\005\346\353\250\236\002"
+	.string	"\006\246\240\335\225\r"
+	.string	"\007\347\231\311\265\t"
+	.string	"\b\340\206\333\235\t"
+	.string	"\t\352\222\314\276\016\002\002"
+	.string	"\002\001\n\223\242\326\261\005\026\002\013\326\331\347\361\r\004\f\350\355\231\037\r\231\274\327\315\004"
+	.string	"\016\202\362\202\320\006"
+	.string	"\017\244\330\372\372\n\f\002\002\002\003\020\360\232\325\316\b\030\002\004\002\002\005\021\257\324\327\335\f \006\003\006\002\006\022\356\322\327\356\017\034\002\007\002\007\002"
+	.string	"\002\b\b\002\b\023\242\333\255\257\0038\t\t\002\t\024\333\332\376\205\007d\n\n\002\n\025\234\341\340\262\001\220\001\013\013\002\013\026\005\002\005\027\f\002\f\030\r\r\002\r\031\016\016\002\016\032\244\246\246\251\f\006\033\275\305\343\240\f"
+	.string	"\034\354\261\352\343\013"
+	.string	"\035\364\207\213\233\001"
+	.string	""
+	.string	"% @\002nfH\341$\270\276E\211Q\2078\300J\220n\350\341\b\260f\364c\200r\013l"
+	.string	"X\224\321\370"
+	.string	"\223\007"
+	.ascii	"\f`\315H\342\251\356t\327u\2272}\326bNL\340v>f\214\273\201\215"
+	.ascii	"7\367\rV\331\355\341\221\3704\321\021\256\237$\261;\037g\221"
+	.ascii	"oO\341\334"
+	.text
+	.section	.gnu.lto_.ipa_sra.59b44ce9b1e09c2e,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"\325\005"
+	.string	"b\007\026\032\220+\035\377\263\377\377\377\377O\356\373\276\357\373[\321b\355\223M6I)\245\024\203\270\017\007\337`,\024\t\023a\036LC\201\331\222\204\345\262\"\360\033\217\376\327\306\223\212G\347\3476V\006\026t\311\007\025_k\225Om\3232@"
+	.string	"\231\242.\247S\334\273u\351E\306I0 \340\002\"c\035\276\330\002Z,1`qh\321`\207\340\270:x\fb\204\200\0232\344'\260K\206\021\301:\032{\267\301:\242\330\221\304\326\314\325cp\013(\034\210F\2617\004\026\210\242\355C\361E#\264+$\n\260=:\264\360\t\216\rDX\220\205aF\316\0062\256\322"
+	.ascii	"\027\027w\b"
+	.text
+	.section	.gnu.lto_.inline.59b44ce9b1e09c2e,"e",@progbits
+	.string	"(\265/\375`\262\t=!"
+	.string	"\306p\233E\320\330(\035\300(\270&\001\252i\025\026 \340\244}\013\006?\334\230!m\206\006\005\310\310N\226\320Vp\220\246\321\333\377\266g\311\bV\037 U3\005\017H\344F\201.!\321o\240=5B\265\335O\332\336I\246\207"
+	.string	"\211"
+	.string	"\204"
+	.string	"!\252$Y\373\036vg\b<\372\214\264\332P$98W"
+	.string	"8\232\246\246\226\266\027\247[3\332\036]\rj\204\316\245\317\224\336\201t\b\321\306i\204nt\013\276\243+\342\310\301\261\"\362e\3122\374\215f\243\344\236_\352\236\240g\030]@\311\201\223\006-9\354\256\314\356\3246\351\252\241\206\222nA%t\244_\360\307\332\272\223\033\315&d\275\317\372\356ng\307.[a\263\222\340v\214}\304\n\233\025\001\366\001\213^\004\252\017\241\242\244\205\376\363?\243b\324\215\032\274@\375}Fu\343\002\375\236\301\235\343\353O\206PY\022c\021\310\016\257\254\0302M\3154\265\026\351I\257.ou}\312\264W\227\n\373\211\236\233\217y\333\337U\325\326s\363\0012(\226\270\255\261\210\342\266CJ\347NNK\225]7I\277\242\n\035\236\017%\177\246\264T10\354\"ve\n\f~fE\220\356 \030\275\202JG\330\203\350\360\204"
+	.string	"-q\273+\322\033\352\035\355\021\216\261\b\203fc\304A\374\235\374\372\315\356\314\363\367y3\324\230dW\026\262\303Y\024\031\005FG\035\2733\223G\033R\017\030x^\375WG[~\254\257\327v7d\027\371\342\330\372\266\320\216\240\300\265\330\213\261l\375\n\220&4\276\222\226\237/?_\252X\377\3703u\3011E\016NNd"
+	.string	"\366\245/\303\1770q\253EO\235\242\253\353O\177\372se\223\236\030<]?\241\303S3=\277\224g\370\t\3723\266m\317\256\343\342\215\001O\177\202\321\002QvA\230\256=\273 \\L`@\214\211\002\242\211\302\177\344rX\264\t\205\357\344rX\\E&"
+	.string	"\223\335U[\214\262\273&r\202y\214,$j&|F\026\0225\r`^l\363\330\335\006\260\027\331\335\223WR\177\3415\274F\234_\221\305\356:\23022$9?\020\245\333\271\254]\237\275\025\355\224\261\273/\376\224r\355\272\220\335\r\340\177[\361fwGv\3537\036\n\005\202\212C\243\332\320P\200\314\250\361D\206\024\232\031\221\321\322\224:\220\002\231\021\242\352\001\022 D-\207\362\220B\310\220\314\004$\222\202$\205R\373\006\320\020"
+	.ascii	"\363$\r\322N\314\247\3220\310\277C\236T\205\017(\225\256\027"
+	.ascii	"\256l\315\003\034\346w\202\243\203#\320\020H\263\331\016Nt\340"
+	.ascii	"\227\032\335i\230r\006\036\352\206\216\266c\365\366\344\025\026"
+	.ascii	"Yv\215\3705z\276*\262OA\303[\266\004\025\002p\257\200\024h\275"
+	.ascii	"\264\242\236\216\2622\250\007\255.\260p\234\252\307\305E\222"
+	.ascii	"\214\376\261\233\220^\243\347\355\b\207/\347\311'\246\235\b}"
+	.ascii	"\022p\221a\313[\274A\2457&\354~\022\fc\304\256`\034\226\206w"
+	.ascii	"Q(\210\376\205r,L\334\310\266\2347\241\354\307\254\336\200ZL"
+	.ascii	"y\025\373\316\"\323Ss\302BQp\017\231\270\273\234o/&\271\243\024"
+	.ascii	"\375\217\273\347D\260\354-\032\200!\361\275\275\003$j?|\216\036"
+	.ascii	"\304jV<\361\013\201\342t\312\364\351-.x\274\233\227y\r{7\365"
+	.ascii	"\207\203\214\361\373_\365b\022\344\273\244k-zA\213\334\244\257"
+	.ascii	"\006\351\"\265@\352\201\310\241\270\227F\264\b\366\345\360\371"
+	.ascii	"\262=\322|*\331w\325C\373\314J\200S\277\272'`5|\235\345W\336"
+	.ascii	"\203\253\2747O\214w\234G\216\245x%\226\352\030\\\334N~\373\025"
+	.ascii	"\344]\276?\"\034\022\233I9\003\354\340a\226\320N\007\370+}E\372"
+	.ascii	"\334\230\030R\313\247\t0\030\301H\336\013\350)\267\344ZN\350"
+	.ascii	";\f.\304rwU\374M\373\210`\206\364N\253*\222\261\302/r\211h$\274"
+	.ascii	"e\037\r\257\225W\032\025vU\2470\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.59b44ce9b1e09c2e,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"E\007"
+	.string	"\202\n\"'\220E\351\227\357\363\345\205O.rw\n\326<\204\322\335\215\230\331\365\373\337\376\267}nKv\333\236\265\177\023\"wJ2\370\374\027y~\344C\242\207c~\253\266MG\203\261\260\"\021=\206x%\247\225\034\027+n\237\231\356\362\237\306O\267\374el\254jsx\206B\215\253}\232_B\007}\342\233\0246\251\246\3001\347;\247i~K\f("
+	.string	"f@`B\364e\232,\023\312z\332\220\017\371\255u\233\277Z\224`3\001+ \220\002\0323\333\2461\261\005F\342b%\336`\f\301 \2271\004\306\025\r\326\330}X\n\214\274wC\224\t\031"
+	.ascii	"X\260K\363\\\351+ \354i\t\363\017\306 \344;4ZPq\242\035\344{"
+	.ascii	"\261\"\177\351\306\330\302V\326O1\262\007P\326\357\260\213\215"
+	.ascii	"\001%tQ\357P\017V\204!"
+	.text
+	.section	.gnu.lto_.pureconst.59b44ce9b1e09c2e,"e",@progbits
+	.string	"(\265/\375 _\235\002"
+	.string	"\362\305\023\036\2009\3513C\351.\2526A\315\240\t\232\033\342\201\177\340\037\370Gkkkk\333\331\255\355\3231\033\223\361-\256\342&.\342\036\256\341\026.\341\016>\301\027\370"
+	.string	"\263\232\324\235\256\364E\0374\237\351\314f2\363\327\362Rfr\304\036f\006\t"
+	.text
+	.section	.gnu.lto_.ipa_modref.59b44ce9b1e09c2e,"e",@progbits
+	.string	"(\265/\375`L\001\355\005"
+	.ascii	"\362\207\030 \2207\351\377\017\023\261n\233?T\365\377\377U\375"
+	.ascii	"\335\205B\354n\275\370\033\300\377WI\033\2222\005\377\263\263"
+	.ascii	"\251q\227\240#\201`\026\245$wx\304PF[<\267\333\212U\344\3730"
+	.ascii	"\313\232\215+\345U5,\374\355\210H\240\303h\316\330\363\256\332"
+	.ascii	"\325\301\214\321\231\363U\236\224\t\242\240\271\201\001\375n"
+	.ascii	"\023+ \360\202\231\251\036\321M6\f\206fhIO\"\302\363\311\030"
+	.ascii	"Z\230\276h\232\34328\370\3226q\032\034\273\230\313E\016h\013"
+	.ascii	"3\2674\313B5\367ui\237\256A\341@m-\305qf\020\256\b\244\260\027"
+	.ascii	"\027uK\232>\336\021\217\230\267\n\022!A0o\006iEp\003"
+	.text
+	.section	.gnu.lto_.lto.59b44ce9b1e09c2e,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sin_approx.2.59b44ce9b1e09c2e,"e",@progbits
+	.string	"(\265/\375`\331"
+	.string	"\r\f"
+	.string	"6\227R@\020q\224\016;\340x\232)\r\2051]\264"
+	.string	"\217\362\254\366\242\002\327;\026D\n\205]\322\036\004\n?\375\261\267\327-R\311\335.*"
+	.string	""
+	.string	"\312mR\004\230-cy\211r\225\307\2745\262\367\2262\245A"
+	.string	"?"
+	.string	"A"
+	.string	"\026,\027Xx\220\324\330\335\210\371\005\376\271\017\200\177\332!\3134\273\323\314|"
+	.string	"Z\351\216\022ru\006DZ\204\b\320L\356\002c\203\214\243\236 \032G\246\225`w\235\037Z\206\373\335\266\002\333\321~\203\252\351\324\364+\001T\\b\354bX\331\330\027/E\210o\277\235\371([lo\024\334\236X0\302\205\311\356j\376\254\241\374\345ON\271\262\273B\004\212\335=\340\002\224?\333>\211\227\310\354\024\203Z:\002\017'&\272\235\004S\035\230(\341\310\023cN\202\327\324w\210\230re\250\327GB\303\343\306S\250G=\243\232\321QR!W\366VJ\345\240\372\240\002a\035\261\276\335\360\247\377=\355~\272\003\242\217g\344Fwg\023\202 \342\\\361\203]\027\326\211\037\017\347\212\035P(n\b\030\213\360"
+	.string	"\024E\030\006\212\226\275\216X\032\r\351\224\355\3148;M59\227OUAl\230Om\t\023\340?,u\001\024"
+	.string	"f\020\302\251\031\235\270\202\027>h\250:\354U\251\215&\354\2350\333\213\261w\246\r\256qB\304\2161\016\322\214="
+	.ascii	"1Q\341\n\240\362\264\264G\003S{"
+	.text
+	.section	.gnu.lto_cos_approx.3.59b44ce9b1e09c2e,"e",@progbits
+	.string	"(\265/\375`:\001\305\r"
+	.string	"v\032]D\020\221\223\016\0334F\337L@\367/\311>H^|\266W\003\357#b\241a\323\005v]Si\353\313\032A\364M\335\246\267\212\274\353a\037@\021\310\303\b"
+	.string	"\300d\377@la"
+	.string	"\346(*\215\020\262\267\224)\005J"
+	.string	"H"
+	.string	"I"
+	.string	"~\210\257p\366\247`BFa\246\344\321\330]\315\343\035\326#|"
+	.string	"\353Q7\234;\324\344\374\267|\003\363\231N%\207(Wh E\005\n\307i\004;d0\260\270\367<9\2212/\004\273\3534\235,\334\361\266\027\330\326\354{\b\360,\177>}\r"
+	.string	"\r\002`v+\254l\254*\236\350\360\324o\337\177y\312\367\\8\321Q&\260\"\362]\234=Zt\021\022\340\216H"
+	.string	"b\205\213\335\375x\364\007v\316\316\362,\376\254\331M\361\241\304\356\036p\001\354\321v&b\310\\P\324G,K\033\274\304\220\262\206=>bE\265\240F\215\336\214\322\215.W\276B\275\367\r\212\031\223\230\356;\211\222\f\325:I\273\335&\365z\223\224Q\256l\324(5\203}\270\252\202=}\301\264\005\323\361\251;!\217\b\t$\2719 \240\007\241\220\216\346\331:\235\215\243yDB:\032\347\003\322@\006x\203\340\340\243\205\266\355\243e\335\341\252\212\r\365b\300\241E\372\263\235\033LOlc\372\226c/`\250:\035\301+\257~\n\024\301\272\351R\250%\031\031"
+	.string	"h\b\341\3350\021,\270\303\354MT[ \325F"
+	.ascii	"/+0\277\242!T\354J]\346\032^\262\201\263c\027\2700\f\\\242\352"
+	.ascii	"T\033\030h\211\023\tb\030\023DT\270\001\250<U\2659ES{"
+	.text
+	.section	.gnu.lto_atan2_approx.4.59b44ce9b1e09c2e,"e",@progbits
+	.string	"(\265/\375`\220\004u\033"
+	.string	"Vp\252I\260\326M:\026\\\360\304'\271\nmi\272\215\236\001tP\237^\263bp\314\t\016t\255\303\256$\033\nI\375\217\376p\366\351<@\036\177b\373A\377A\013'\236\255\333f#\3716l\361\260\340e\234\326\244\021Bv\332I\006\230"
+	.string	"\213"
+	.string	"\225"
+	.ascii	"7^m!\301\210\252\306\001\177\213\200w\343\200\247\233\266\267"
+	.ascii	"b\255>fP\325Z\021\254\001\227\277\335]\323p\215\237\335\036\345"
+	.ascii	")\265p\221\016BQZ\265V\332\215g@\177\3241\240\277\257\360\217"
+	.ascii	"_\242+\004?\372\371\263\016\037P\031\271#\037p@~\345,\346\006"
+	.ascii	"\354F\030M\327\200\024$\212\034\322\002CT,1\221\021Et\246\013"
+	.ascii	"RBh\202&\374\2210\034\207I_\270\022~\fw\2437\265VOy\016\341l"
+	.ascii	"s\206\017j\255;?\340Hxa\336\335\335\3566\330\245E\001\267)eg"
+	.ascii	"\036s\232'0rBF\261\315re>sY\021\230\307\\\201\221\020R+h\226"
+	.ascii	"\273<\240\371\244]\323z\244]\233\231l\254\241\261\223w\306M\266"
+	.ascii	"\214\241\2741\346\3310/.-\226\362\306<\227\305sW<\027\346\271"
+	.ascii	"/\317\025=\327\345\271\241\347\202\236\373y.\365\334{\356\364"
+	.ascii	"\\\007`\211\241C\241\302\303\217\360\252\210\222J\305\372v\274"
+	.ascii	"\260\223\reK\371\273?\353'GyjaR'\026@m\357F\211*\201\323\366"
+	.ascii	"n\002\342\307\033\007i5o+gy\003&\260\257\234\301\226\216\334"
+	.ascii	"\321\353\260\323\242H\035\322\226\221\327q\252\310\235\222\223"
+	.ascii	"$X<n\256\213\367Ux\327\005\\\221\273\262\304Q\360\341\001d}\007"
+	.ascii	"\017 \212\334\231\330JQ\251\320\177\227E\221\272\330\177\372"
+	.ascii	"\261\212\334\315o\317"
+	.string	":+-\254*\377wE.\331z\316q\313qT\327AYj\335j\r\"\020\373\274s\271)rg\2434\367k>\253H+\333,\375/\213\204b\233\245g\255\025\350O\332\336\356N\0024\037ALyR\022=\025x\016!B\317\204\034\252\301\033\274:8=\026|rvh\030j;;5\035\032\206\0139;4\035\236\036\032\316lk\031*\360\320|j5\036\032\214WM\353\221\232D\233/u\271\374\345\3451\362\007V\320m/\227\333|\006\204|\022$NY\\br\021\316\276\024l\271\213\314G\242\027\256\026:;\204\\\017r\311:\262\206\034\205OZ#a\322}\262S`\nA\307\267|\b\346#\021\013p\264!\024\005Kv\237\\\217\\\372\236\264\032`T\231V\202\321\3445\217}hwG\242\025OAX\036a\250a@\244\020S\310\210\202\024\244\260\240\220\016\300\002\221)c\035\020PFE\232d8"
+	.string	"\2427\204%%ce\345\025-\360\331\\\013\001\025\264\315\372jJ\223\r/\203\324\231@\235\211\001\277\333\037\331B\216\355\311\036\333Z\004w5U\233\207\306\"\371"
+	.ascii	"\013\276\217\221(\330L\001\303J@\317\232\031\027\320\275\016"
+	.ascii	"\341J\"\205\364\205\207\327\3369,\320`\265\220?<Vk\002=\037\227"
+	.ascii	"{\205>;:\362tS`\tM<0\277A\3426\314M\376\213X\006Z\2130\257\271"
+	.ascii	"u\003\255J3Q\2529\001CO\f\027\360\320\345\350\205\357h\300\253"
+	.ascii	"\024\212\215\247`\262\213\f<1A\341_\302I\030\247\313\366\350"
+	.ascii	"\037"
+	.text
+	.section	.gnu.lto_acos_approx.5.59b44ce9b1e09c2e,"e",@progbits
+	.string	"(\265/\375`\374\001e\021"
+	.string	"\366 tG\360\320&\035\220\f\306q\321\343)l\354\260>]H\254o\"\255\341/8f\277\325\234\231\026i/H\035\342\240\337\367H\375\367l\251\350\017(\266\026'\236\332\003\273\032\351\017\210p\275h<\251hd\033!\204l)S\n]"
+	.string	"X"
+	.string	"f"
+	.string	"\317\364=\036]\232s\306\316\2139\347\002+\340\236\331\366y\256be\217\362E\242\304\213xb~\216\346\234\336\310\013h\317\344\th\317v\304W\227\253+\237uy\261\006H\3065\363\225\t\210D\340"
+	.ascii	"\340\002e\210M\320\314a\327\226\353S\335N\346\234V\031\027\207"
+	.ascii	";\273\355\007\266\033\330\352\0221\373\305\322\315\261/\347\342"
+	.ascii	"|\374u\237\356sw\357\371MW\227\256\346\256\336\256\326\256\316"
+	.ascii	"\256\226W\357\325z\365\003l\035\210Dl\314\251!\2264\207\262\030"
+	.ascii	"'\376\372}\256\366\312gq\230;\037\217#\240\200\331\372V\210\f"
+	.ascii	"^\0369\326\006\003aQ\217\2169g\3113\227p\001B-\302\033\333r\253"
+	.ascii	"\t\2056\332n\273\375\204:4@\204H\002\263\325\026\244G(v+7"
+	.string	"\333\0035B\035\017\255\013CH\340\256\\\021\031\241\3157\376C\n\f\016b1#\234nw\021\270\bu\244~\355\n\026\264\313\350\216\200\313r\267\036o\005\347\204!\371B\240\341\021\212\237\306l\332n\017\273DA\223#<\202\321(/\3322\301\205EE\245\275\334)&,\021ZPP\336J\n\205J\245x+\022PP^\212\212\3053\tq\212\202\212\312kI\245T^\367\232\227sq\374\233\035\023z\032\260\037[\332\226\355\322\372\004f?y\332\030\243!\371\261\027k\200B\361;\214\035D7\2739\036m+\211iA2\304`A\240\"\231[\335\323>' \240\202\221`\021=-\n}(qZmX'{i\215_#w)\025\247\203\222\2136\242k\347U\366\345\264\301\317C\303\t~\025\220\231\\l\310\216\212\325\032\351[\360v\243q\300\333\267\347F\316B\303\206d}\276\255X\234\234\200\001\0035\031\256"
+	.ascii	"\3453/\227\347\022{"
+	.text
+	.section	.gnu.lto_gcd.6.59b44ce9b1e09c2e,"e",@progbits
+	.string	"(\265/\375`\316"
+	.string	"-\013"
+	.string	"f\025K:@-T:\264!\301\031\005s\007`\361t\275\214\255p\\\255#\310\302\227!H\251\3266\263\\]\250\033d\327\203j\343\030fC\324\006\bv\rx-\267\2025K\310\336R\246\0249"
+	.string	"<"
+	.string	"6"
+	.string	"\016\353Q5\370\326\344\036\241&\347\377;\354"
+	.string	"B\321\341`\3411s\b#\252\324\t@\307\201\027\3473\372\367\364t\233T\307\363\222\354\256\263\323U\270\255\333^`[\201\375\004\001\316\247\177]\036L\024X\355~V+\266D<m\260\315\331\r\333\033=\236/\031e\306\356\005\320\210\335}\370\300\342\361\244\177\340l\024\364D\3351\230&\204P\261\273\230\201\013\260\036\341\003!\377{\200xKS=\377\276H\221L1\3250\243\252z\020<u"
+	.string	"\205\023 RlRe{\231\303\335]\325\220\237\021\221*e\315`\337\373\255\227\376\370\322\255\367\036\331\246U\030\304\f\202\246\246@.\r0\223\f\323\266,\333(\230\346`\222a\024\313\005\203\020\360\366\240b\3010\333f\301\032\336\336\251\252\327\177gH8ir\245\"Hp\272\250!\265$\202j\240\006\026"
+	.ascii	"i\b\204c\030\306\300N\213\017$\020`,\013__c\355\323\263\001\232"
+	.ascii	"\240\226\300\247\t\005\314\201\314\300\210\240\002\006T2?e\037"
+	.ascii	"\216\222U7\325T\215v\225<"
+	.text
+	.section	.gnu.lto_powerf.7.59b44ce9b1e09c2e,"e",@progbits
+	.string	"(\265/\375`t\001\275\016"
+	.string	"\366\333bD\020\217(\035PJ\260VOB\226\254\020\231\332;\bwm\2629\2218\201\230\177\257"
+	.string	"argt\327\207\336=\357\315\025\330ve\274\247Y\007"
+	.string	""
+	.string	""
+	.string	"U\211g\240\t\276\t\\\221O\250\357\320\222\266\267\334)\005N"
+	.string	"N"
+	.string	"L"
+	.string	"\253\025x"
+	.string	"\314e<"
+	.ascii	"\314\245np\366}\337\313\243wG8\272\214\nG>\353\261\244cAq\244"
+	.ascii	"\313\230\231>8dp\246\250\021\203\241\334u\230\342J0z\b\271\336"
+	.ascii	"\365\003\335\013\305\205\034f\016v\327\020\305]\2701\267=\301"
+	.ascii	"v\003\373 \002\035\336\372W\207\366\355\223\360]-\247L\022\310"
+	.ascii	"<a\251`0/o\217|\2263\266W~M\022\210\200\223K\n\330\356\"\270"
+	.ascii	"\364\002\3509%\203Jsx\225_\306\330=Abbw\025\330\300\274\274\210"
+	.ascii	"\217\030\331\257\350\215\220\334\205\245\243\325b7\n\365/\254"
+	.ascii	"\025\0130\366\270\273\033\235\340P\247J\024\247\256\004?\253"
+	.ascii	"^3\275\353r\245{\235>\224\340\247z\242b\342TEl\217\0045Fb0\253"
+	.ascii	"\006{f\362\336\037\257\372\365\255\033~u\037c\272\300P\202\300"
+	.ascii	"\267\373\361\275\330\026\211\022\242\017\307\306\221\"\t\034"
+	.ascii	"\241\016\b\263A\241\243\235\320\346A4G\023\202 \332x\264\317"
+	.ascii	"\346\361l\034\355\023a\343\3218\240\220\246\031\340m\243\003"
+	.ascii	"\322D\333\006\3222\336>\306\253\224\367\350Pi\251\240%\251\""
+	.ascii	"\316\204\320\251\272\002\246\356z\246\304\244c}\2620\361\200"
+	.ascii	")\333\216\001  \200\002!\333\016\033\201z\354\025{D-\344-\016"
+	.ascii	"H\223\237\361\201\231\325\266X\321\254=\330\322\355\026rLq0\330"
+	.ascii	"]\203\355t\255d%LB\340\020\254A\300\303\202\241\001\345%C\226"
+	.ascii	"\220,\362\302b\037\357K\244s\321'"
+	.text
+	.section	.gnu.lto_applyDeadband.8.59b44ce9b1e09c2e,"e",@progbits
+	.string	"(\265/\375`\260"
+	.string	"\305\n"
+	.string	"6\224H<0M\225\016Hq\221E\352\361!\013i*%\274\343\322\342\337\331\274\250\024\376\334\362\361\033\216\305\222]3\002\324\331\265\021\006\006] \376`\232;\332VR\306 <\224XK\366\2262\2455"
+	.string	"9"
+	.string	"3"
+	.string	"\221_X\207\357\026\326\241Z\270\366\247\251\371\215\311\313P\352D[\347\317!\341\n\331>/\262\273\347\360\034m\240\314\306dw\235\242-\302\ro\273\200m\002\366\001\004\250;3\375F\005\211DF\267\013\241;\261*\030\002\203m\216\375\260\271\0211\217\322L\261K!\005bw\0078\200\343\320\266\257\341\0338\326\036wa\263*\224\byX\355n\f*\217~\336\203\371T\325f\320\300\272\b*\324N\252\236\374\364J\351 \002\224&\254z=\251\364\341\301\312\223\235\315uRO\366\337\252\311\206\347\376w\324\257\017\026\314E\261\\\027\213\343\242"
+	.string	"\301\265"
+	.string	"\272\"\321\030\330\\X\304d\030\226U\"\346\300\205\305JF\023%\030\316\022\\2q\223e\231\370\340\366o\325\004\325AjB\nx\352\310v*$\324\005\025"
+	.ascii	"]\204^\331\300\241\020\r\356\2001E5\013D4\r\002\312\004\347\032"
+	.ascii	"\3363A(\023o\301\341\20090\030\030\001\352^\3613\037\243\206"
+	.ascii	"\034j\362v\2252"
+	.text
+	.section	.gnu.lto_devClear.9.59b44ce9b1e09c2e,"e",@progbits
+	.string	"(\265/\375`\037"
+	.string	"\255\007"
+	.string	"R\21765`o\032\003\024F\0250H\002`\301?\276\351\027*%\247\r\261\202\025:\323\310\352\377{\333\305=\366\220\273\n\032\023\023\274bQ\253\261\242C \357\261\345\2262\245\025\235\210\330l\363\221"
+	.string	"q\264\351\3314m\313\246g\202\243\315\214\373\314\315A7\212\0167A\333\306M\315w[\217\245Bx\250F1\243\013n-|R\026\354\277Cmr\2011`\n\261\254C\227e|I9\305\214\340\252\375D0~\264\266\376\277\261\324\032eCK\240\303%\241\345\337X\315\\%WD4m\r[\217\230\2443*d\202\277tR\371\277\206*`\226\375lpYb.\270,\333\2650\376Lw\312\323H\311\374\237\021\304\235aW\273\304\001\036Id\b\360\360\277\320#q\270\321m\021\3322\264E\t\t"
+	.ascii	"3C+\0258\b7d\002+\230w\t\240YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_devPush.10.59b44ce9b1e09c2e,"e",@progbits
+	.string	"(\265/\375`\302\002]\022"
+	.string	"\306 rF\360\320&\035X>\367\023\315fW\303i\311<\"\274\362{\214>\307:\363,\367\037\275V\246@\265\352\223\001\333FIC\203\316m\033\376\004\232Y\t\331\201\345\210R$\023\253\n\201\377}\254\330\211%\204\220\275\245L)\\"
+	.string	"P"
+	.string	"e"
+	.string	"G\221:\214\345\001vchxvc\"\006\341\036\035\373\207\366\310]\200\366\350\224}\343\261\231\275\354\005\203\314hw?\005\361\324#\324L\371\277y\327r\265<\302\034\222\\0W\230\3405cC\311\345\002?\204>\330\370\3153\203k\225\271)\330]g\313\245\341\326n\233\201\355\021[I\002v\254%U\306>\334\335\265\306\330\267\371M\207\375\245L{\231&e\272\3134\227\351-\323Z\246c\246a\246U\323\251\351\023 \271\020\002\301\331}\351\261c\203\242\017\215\355{\2663\366\024\251\333x\346n\367E\016\317\356\212X\204{<"
+	.string	"\237\366O\004\252&\205\032e,\022=\236\251n\036f&`\331\223C\250\003\234!\260Q\337\211>;%\214&\\\247\224D&\265U\236\343\231\201\256\206\305\021\207\217h\275\202Te\034\362\324\001C7C.\251\303\251+"
+	.string	"\314\274U\024\362k\352\211X\257\225)\\\205\177\270\335%\361e\016,p\"X\264\307\253\252t\216`\252\354\021\027^\341\344\201\332dD\005\302J\311\351CA\235N(\223\017%B\311\3513IQ\371F\n\030%\341$\345[A\241R>/\266\207\2531^"
+	.string	"\024\244\322U\364T\306\254U\244\202\321 \004N\253\310S\373t \222r\352u\n\225T\2632i\247[\215\037\356\b\266\265\320TuSH\203\365\212\nU\323\263b\244F\325x\260p\0048 \220\002\221\271:\017cB\377H\f\261\035\252H\366.\2551\323\312Pj\242\226\2107\270+\277\3362\273\272\256j"
+	.ascii	"\206+\255\206\240\303\272\210\001\344\266%]\204\233\323C\320"
+	.ascii	"|\272\345,r\201\350u\334\363FR\005\235kEP\020_K\214\374\036\022"
+	.ascii	"\2146n\373\026%z\257\304A\324\007B\312q<\307\246\371M\266\001"
+	.ascii	"\262K\205l\320\374\021GFg\214\256H\203S\006/w\233|\253\253\321"
+	.ascii	"\302="
+	.text
+	.section	.gnu.lto_devVariance.11.59b44ce9b1e09c2e,"e",@progbits
+	.string	"(\265/\375`\351"
+	.string	"-\f"
+	.string	"\006\030T@ Q\224\016\f\264Q\004\315!\216\377\300\223\205\263\210\b4\013\223\306\246\217q\232\001\r\3452\013\236\315b\333\356\266\352IF\332t!\001\240\202\001\002\"u\227\205t\027\024Q\266\006\362\311\336R\246\024D"
+	.string	">"
+	.string	"A"
+	.string	"\036g\301\241\302\210\031\273\213YN\300z\204\027`=j\206o\207\232\233\377\030\033>S':\234t\034WXA\241\340"
+	.string	"\320\221\340\201\025\006\027\017\361<u\\\246\204\301\356:M\335\205;\336v\003\333\027\373\021\002\336/\321t\3244\314\264j:3\375\215\311\310*\201\214]\013_\215]\021Mx\260\275\331\024\333O\373 \007\261\335\013=\300n\352\243\304\256\247\300\b\256G{\227m\377\303?6[\005=\r\001\2371j\301(\2418\177N\302\252T\003\317\016&\324J\265\303\227_\365E\210\nR\322\260-\341\",r\355\356\002?\244C\341\362x\364C\326\343u@\013\220Q~\266'J\355\260\017WS\266\246\257\007\0236\016\324\032\314\347\001(\223a\034-\3134\r\306\201\220\3110\215\347\203a*\326:\033\017\006\3224\017F\361\366\232r\246U\266\263@\324\223\355\250\226\221r\020BM\275T\222\242t\202\313\317\252P\243Hid\224\001\023"
+	.ascii	"\022\0230\245\346+\032>d\305\346\3420\021\006\325\260\240\020"
+	.ascii	"\334A\013$,\037_7i\026s!'\250\031\354\310\330\203v#)\2011\357"
+	.ascii	"\324h\025\024"
+	.text
+	.section	.gnu.lto_devStandardDeviation.12.59b44ce9b1e09c2e,"e",@progbits
+	.string	"(\265/\375`/\001\335\r"
+	.string	"\206\333_D\020\257&\035#\242\tX\333xv\377\231\265u\351\001\257\210a\252\205\250\274\353\215\035\252\023uO\351\352\357\266\210\261'=\3541\002c\007'"
+	.string	""
+	.string	"P\021\002\005L\030\316\220\033\n\204G\302\2505B\310\336R\246\024N"
+	.string	"G"
+	.string	"O"
+	.ascii	"\347\360\016\236\255\202\037\006\225\257\3300\341C\214\335\335"
+	.ascii	"8.\340z\204\017p=\352\205{\207\232\236\177\227C\226\f,J\246\222"
+	.ascii	"C\216\t\345\n7N(P4L#\330"
+	.string	"\301\2620\363\324\323\304$\312\304\022\354\256\263d:\271\343m+\260\355a\177%\206\351\rLg0\215i\372\202\351\b\323P\323\372\357O\016\247\206e@\305n\205\226\214\225\211%V|\230\247F\376b}\211a\331]m\304\326\356\331Z\332o\271\007\357\037\311\001\354\242F\220\330\375\016\270@\366\350/\263\355\231b)H'.\3054\256H/:W\275\364\202A:\211\262\365\340\"\254\212J\240Ej(\235X\252)\366\270\252\272\200\211\031e\215\2372\350!\274\312v\027\201\017B\002\004_\345\321'\321\247\336qb\202\246%\224-\373\023\245\246\330\207\253(\007\021@\026\250=\035\020\003\221\017n\013\3518\256\363l!\r>\270\315\363\001m\235\rw\016@>\233H\327}6\315\266\277\320\025\345\324L\233Y\315H\253l\347\200\215\232\330\206\312\021R\2219\271Q\233\353\256\227\240\336\345\247P\242\221\031i\t\3044j\026"
+	.ascii	"I\214\211\245\005\020\3312-t\357Y.\307\373a\325@t\262\204\342"
+	.ascii	"\307\343\271\232\260\\\303\313n\0026\025:\250H^C\227L\220\240"
+	.ascii	"\n\007w#\251\006iJ\252q)("
+	.text
+	.section	.gnu.lto_degreesToRadians.13.59b44ce9b1e09c2e,"e",@progbits
+	.string	"(\265/\375`<"
+	.string	"}\b"
+	.string	"\306P<8@\345&\035\340\253 z*\027\001S\320D\0031\263;5\214S}W\247\242\024\337\266\3017\327\350A\250\324\223t\270\f\243?\374\3162f\256\346\316\322\367\330\266\211\224)\005+"
+	.string	"+"
+	.string	"*"
+	.string	"\250\212\222\230\335\215\233\023d\016\253\017d\016\265\343\335\263\363O\362J\345\224\"\225@OM\303\356:I\245\214[o\373\300\366\202\355\225\213\361\001X\026\230\362a\273\263-\333\231\366G\216\352\356M\030\356\232NPvW\301\b\001\207\002i\333\017\271Hg\247*\317\343t\227f\370>\030\212\335\220\301U\365#\020Q~N\275~\364\022\312\317\366@\251\034\366\253\325\r[\323z\357OM\037Z\032-\t&\033\034\206m\017\230\203\306\027\207\203\370t\262\350\321\262L\273\242'\242\223\305k\343\"\247\300\232\004\266\305\217\246m\321\362\366\266\352&\244\";\365\213"
+	.string	"\026\246\r\n"
+	.ascii	"2\003\302\260R\b0\254.qM$\310\202p`\202\200\023O\252\025\223"
+	.ascii	"0\311"
+	.text
+	.section	.gnu.lto_scaleRange.14.59b44ce9b1e09c2e,"e",@progbits
+	.string	"(\265/\375`\357\001\r\020"
+	.string	"f^iE"
+	.string	"\221(\035O\335\247/b\235\254A\f\202in\t\252\b\227\034u\212\322?\217\226\321\266E\375(*\220\312\270n\317 \t,\203>i_IG\272\276\025$D,\"\254\220M\344\rU\005\3767B\b\331R\246\024V"
+	.string	"T"
+	.string	"Q"
+	.string	"\237e\371`!\201L\f\00314\005\302\227\222\347a,3g\327\003\213\305\356\022\260\200\356\232m\377\345&P\266,\206\"Vw\201\251\\6v\327#\271\310v->\264]\323\020G=Q\376c\2174\254Y\313*\345\311!\330]g\313*\303\255\267\035\300v\003;)\004\232\356h\232\223\351.\323\\\246\267Lk\231\216\231\326Lg\246/r\r/Np\030"
+	.string	"c\367\302\354\306\272\320Z\214\370\353\207=m\224\257\3421{`\256\211\273\341\263,\256X\213\001\212\247@\375\345\232o\n\003G\345ZAcwK\256yA\330=\264\315X\026\003\254\032\233\252~\3647)\022\232F\335t\304\006D5\035\271\371\320\250\\\352U5\312H\265Vrf\017M\2158:\364\352\2005C\225C%gv\230\222\352b?\356\356ZA8\364\327\rz\314\037r\330\375y\370\203\034\346\377\270\314\357\361\231\277C\323\236\243?\370'\332N\246\023\b\335'\"\201&\255\364\201\nH\240\211\253p\223LL\021N\243\222\207\362\225J\037\311C\2210*y$\320\344\231"
+	.ascii	"\3607\341\004\364N\337\007z\236po\207\224DEW\354\321PG9\352\321"
+	.ascii	"\247:t\364\235r4m@\372\321N\017\260f\251\022\234\202Z!\312\251"
+	.ascii	"(* \340\2421\013\036\024\202\025P\006\374\260,\201\256\2114\330"
+	.ascii	"p\337\200\3551\331q\f\341\rfaP\034x\322Q\276\241\365\231\001"
+	.ascii	"\037\213w\352\232\224\021\213\006\336d\363\n-\224\244\207\342"
+	.ascii	"K\004-\264\031\300\346\fG\262N\300\256d\234\304\016\311:\021"
+	.ascii	"o\220\305\0010\217\251=d"
+	.text
+	.section	.gnu.lto_normalizeV.15.59b44ce9b1e09c2e,"e",@progbits
+	.string	"(\265/\375`:\002\325\020"
+	.string	"6`nE"
+	.string	"\223\223\016\234\355\b\331\355\243\323\f\032\216^$\344y\006\206\247%_\347;/\203>\244bx_~C\306(#p\262\fD\232\013\274\327\252\252\244 \235\205(@\225\005\242<\253\335x\016\3116B\310\336R\246\024W"
+	.string	"Q"
+	.string	"^"
+	.string	"\360\323\031=\355\253\370\n\324_R\036`\227\005\206\314\3567r\002\355\321\337\t`\217\332\005`\217F\331<\376\235\330\273j8\270\200\354.\247&\216:\324D\371\331\210\207\325J\035\206\270\202Z+P\264\273w=;\264T\231\331\310\356:Y-\020w\274m\b\266\035\330\351\022\366\341\356\256\225\305\376\367\003x\314\035\372\313\017\312\364\226\351O\246=\231\3262\235e\032\313t\3144\314\264f:3\375\001\033\215\215\321\215]\017;B\366&\316\270<\346\267\177\2277\237\305aP\217\361KK}(\260\302\261\361\261\273\n\036\315@{\024\005j@\004\t\030\035+\251cOjjw\031\260\263B*Z\321\2243\215\252\351\177`\212i\246\331\220\323c`\372"
+	.string	"jjT\210\263\032\241\312\035\253\252B\215;4\374\205\352\202\034\327k\252\332\254R\250\274\341.\374\322v\267\201\337b\002\212\206\"\005{\274\306\234\036A^Tr\307\376R\251%\002&^\205\223\222\013\230w*\241"
+	.ascii	"I\246\223\232$r2\361HJ\334IW*u$\356\304\002I\211#\231N\234\310"
+	.ascii	"\001w\030JL\234\327u&n\373\366p\225\305\021jnTT\0057\235\201"
+	.ascii	"\351\246^K\215\217\316\250~\324k\241\261\242\361\250\214\004"
+	.ascii	"\024\020\216\224\301\312\t\351\325\243^\313kE\243\312\335M\351"
+	.ascii	"\313v\"\320\002) \240\202\031\261\341\003\263\320\216\307\020"
+	.ascii	"j(\312\366\256h\\\263\262\332\266\r\332\0250K\313[\321\fb\316"
+	.ascii	"&B\222\024\260\251,\366\fLJ[\0341\341\220:AX\230pS\232w\304o"
+	.ascii	"\020\313T\\T\fA4\023\013vD6\257v\f.\212\0073\214\b\200(\340K"
+	.ascii	"\032\260x\271\355\352z"
+	.text
+	.section	.gnu.lto_buildRotationMatrix.16.59b44ce9b1e09c2e,"e",@progbits
+	.string	"(\265/\375`\005\013\r/"
+	.string	"\372S\244\021FpZN:\2235\250\303 \267\231\224\006yU\"T\250\372\272&)w\301\251\270%\345\311\306\224\252u,\200\t\245\377\202\371\013\220s\261\341\\&\263O\244\200\356\021\231\332(\202b\367\237\217\266\266f\t\331\204H\231d\016\001\346"
+	.ascii	"\b\001h\216iT\236\334cY \034\027\205#r%~e\333\313\221\254\312"
+	.ascii	"\255\220\370\224\025\272a\346\230\226\246)\211]`\211=\334\002"
+	.ascii	"K\034y\242L\335\322\362G2/mo\n\275Y\357\344O\036\345o\013\224"
+	.ascii	"\242#\003\224!\027\334\0269\344K\323\270$p\025\32079\033\327"
+	.ascii	"\333\026\211\256\220\321c\243\214\215\2314M\2117\367\t\2759T"
+	.ascii	"2\357\225,I!\246i\277\266\353\273\271\305\363\356\323\216\204"
+	.ascii	"\353j*\256\223\246@\220pi\272\226\264F\350\315];"
+	.string	"O\275\211>@\275\271\\\273d\276f\226\236\255\f\030\333^\232\246\305\016r\256\017\205A\340\317\207\236\325,\233\271\366\177\273/Ll\305\207\307\013w\2009r\220\354@\035xd\374\033\273\357]d\344\250\033c\264\200\217\0318~\202\315\275\300\231\f\034\\m\334d\221\305\310e\215wyt\334Rc(\346U\362\324\375\020s,g\027b_\314'T\232\246\313ab3\2769\337]8\273\353a\367W#qv\327\274\270\313v_\246\rd\267\362FU^\t'/\324\311\373\364\3447B\345u\252\274\020*\357\203\223\327\301\311\333\340q\337\246\312\313Ty\031\234\274\013N^\005\227\373&\250\274K\225\027A\345=p\362\026O^\245\323}\223*/R\345%\236\274G'\257\321\357\276\006*o\321\227\374\003\336\366\025\272\3337\350P\276@\227\362\375y\336\327\347\344\025p\362\366T^\236\312\273s\265?@\345\325\251\274"
+	.string	"*oN\345\035V^a\345\rV^`\345\375U^_\345E+\357Yyk\3455+oYy\273\362r\345\375\204\276\022W\266\327_\326\322\030q\334\244tf\025\"O\376q\277\334O\367\337\375y\177\333\357\366C\371\245\374\267\373\274=\0302 w{</vd<\350\366un\344\366s[\264\354\305\355\263p\005zG\352\021\320=>-\240\333\247\017&X\324\373;b\037\017\350#\216\241\327;\202#\243>2\320FEm\240\217\327]\324\267\333\3606l\232\214\307\021\211\332\217{Ow\240_\347;\211c\365zg**u1\251\225\270\223\372u\350R\357\345\030\364\347N\2238V^\357\020\026(\350\005\tZ\301R'\350\317\235\314\271\227\372Z\244\256&\r\367\337\316d7\366\216H\324\352{\037\367"
+	.string	"\352\313,[\002q\214\027I\024\325.\326\314\035\274\314\033\264\203\246n\360n\352g)\207\354\324\373$\225\207\3720\t]\366\n\246\222\246\256Gw\331\256}D\205j\016L\346\276\230\315\016}D}j\250\2761B?\265\311\266\006\f\216SG\350c9Q\262\214q\256\013\371'`j\350\322\345\2574\355\"z;\365\255\374iL\354\332\216^[\3651\213\034\232\355\202\270\030+4MS\006a0`\0210\023rs\257\242\336|\367\0228hj]\034[WU&J-\254)-\254)\324\304U\225\026\212\253*-\324DU\326\226\224U\235\242\022\2415\344!K\n\225\332\nA\325\301\334)%\255\017[RV\305+,++\254\251\342U\225\224Uq*K\253\250\004\264X\"\250\262\212[XXYE`\327K\241y6\007\206\f^\357;\355\302\202\025\272\256\366Z\035\0320\242\232\251u:\353\210\023"
+	.string	"b0\202:\247\001\034\201:'\3160\006\f\037a\013\365\260\373\215\261\310O\013\373F\320\326\004_"
+	.string	";\330\235\0046\006\2642F\275_\230\257\177\372WD\250}_\214gh\013\006\013>E\005\352\263\321\3561\306cP\237\37534.\bz\231\3057Yo\232?\336\320p\324$\356\332i\263kw\322x\346e6\0064\244\261\354\335E\342t\2219fi\2326\355\343P\320 \314KQor2L\217\251\221\272\354,4';-\324Mg 4R\007uS\230\235\006\352&;\343YT#\365\017\221\035\033\223/mg^\303\356}\036O\037\214\020H\034\373=\200\322\250a<C\225R\246fDRP\220\202B\032\003\020\003\021\231\252\016\022\200SM\n\203\222\261\023\213R\250\327t"
+	.string	"l\312o)<\023\276\332"
+	.string	"'M\214o\311N\271\230\265'x\2443\332\230T\262f\021\2569\007\212\316\027\r\004\340\224+ F0\244\035\342\252\t\006>\304C\354Y\204k\364{\177O\350;v\"\313\216\2101hj\373\034\271\034\331\003M\301|3D\204}T"
+	.ascii	"J\224y\025\377\252y\n\t\355\233\366q\226\206G\361Jn\251\324\030"
+	.ascii	"3%d\340\226\323w\\\001\037v\227>\r\340\314\"\233\017\231%\357"
+	.ascii	"C\260\003\315\226\032!\316Z\032\264\2030A\005\036x\242\334\303"
+	.ascii	"\261\307\220\247P b$n\363)\263n\377\321\205|\334Z\317\206\003"
+	.ascii	"L0\234\322\333\001\027\276\3404\t\374\2012]?^%\231\216\245sG"
+	.ascii	"\323\371}\0014\033pB\"Vk\337@\356\013\270\307X\211\2103E\207"
+	.ascii	"\263\220>p\370\357=$\273O:I<Y\006k\315\026?\241\3423\3024C\320"
+	.ascii	"\tlBv\037\016\233\032\021\322\260\230,B\317\245b\327#\030N\353"
+	.ascii	"fm\2177\366\221\365\271]X\363Gz\334\362\272z]\350AZ\214\006\312"
+	.ascii	"2\230#a\271\020\337\3467\266LI\307\"\341\214\002\352\024\200"
+	.ascii	"\250\236\321\260\030 ,KNb\330\251\244Lr\270\241\3679\007\216"
+	.ascii	"\236\022`\177"
+	.text
+	.section	.gnu.lto_rotateV.17.59b44ce9b1e09c2e,"e",@progbits
+	.string	"(\265/\375`\004\0055\032"
+	.string	"\006/\241F\260\230M:0\222 \b\333\326\023X7\243A*\021\324\306\323\207G\306\356\252z\363S\306\252\330\261W\364)W\316Q\206\376O\271\037'\363\037\326;\024\023\377\271\307tA\\\016\270\376\b\031\232\250\007\356F6\2212\245\210"
+	.string	"~"
+	.string	"\220"
+	.string	"\267id\b\362\221\3007\342G\034\372\350q\352El7RB\336\232*L\355\300\232s6\260z]\352\237\375\357\354\272\220\017\261]\352\204\2745M\330\362\003k\316&\243G3\220\217Z\243Hu(\256\214\256\366\201<\210\355Q)\2763\247S\221%s\352\024\030\201|\264\356?\340\243|\017\370h\233\r\346\272\334\374\324\223\213\235\2319gls\334v\265\371\337\275\006\007\343vmI\230sZq0b\334{\333D\266/\330q\006\377\346:\331\347\375\006^\365\0278\325_t\336M\364\252{\350T\267\320u\177\200G\375"
+	.ascii	"\244\032&\325AR\r$\325?R\355#\325=R\315#\325;R\255#\3259R\215"
+	.ascii	"#\3257R\375\222j"
+	.string	"\227T\333Hu\215TK\251nI5(\325Q\252?\251^\251V\251\376\001\2344V\034\204\231\363E\017\315\264\212Lx4\341Y\020\261\244j\202dBb?\311\225\330N\345\320\004f\350j<5\315D\013nkaYX\034\236\367+\337\311\036\346\364v\002>\202{\036\227ou\343~SZ\320\030\332\335o\343\027+\016\037\344\024|';\272\332}\240Ch\277\272\232\245E\217\025\332s\025\207\003\256l'\370N& 7\347l\360\370m\215\241\002\305\344\245'\362\235R\021.\300\332\036fz\234\225*\313\212\305\336,\305!\003\037DQ\034\272n\fAq\030eP\3711\347<\362\237P(1 \367\224\002|\024\332x\005\nT\224\n\355\331\272\233.\016;\0322`(j\205\230\3256\220\210&\224\226jH3\020\251\366A\306!\222\270\223\0260u\250!\315b h\263\031-)\006B\ti\026KZb\212-"
+	.ascii	"`Z\b\331R\254F\243-\305\\\272\371o\256\223-\364\254T\354\n\237"
+	.ascii	"\370\346\264\021\341R?\226\020\355\031\266e\202\366ga@\033\264"
+	.ascii	"\260,2@>\313\263?=\353\263\361\213\230\236\235\345\301\332\331"
+	.ascii	"\326\230*P:\013&goV\007gs\026\226\345\005\347\2656{\343\332\327"
+	.ascii	"\306/]\\5ksUsF\256\026\207r\357\004'\246\265q\345\266\262\004"
+	.ascii	"[\250QTe\020TR\"\201\004\tZ\220&\215\001\300\002\021\251\262"
+	.ascii	"\016\021@53J\321-(\247\324\262\006\200\311(H\207\256Y\267[\242"
+	.ascii	"\t\332\217\246\240\312hm\212\2754$9;\202A'b}3r\327\241e\312\257"
+	.ascii	"\024\304Z\271\254\225X\262\254&\022\366\303m\217\310\372\245"
+	.ascii	"qMe\303\266A\327\032\363kM\025\240\320\245\004\311\016,O\023"
+	.ascii	"\242\266\242\367h`\276\262\222E\034\313\005\f.l\t\200\226\372"
+	.ascii	"\315\303\261*\006/y\215\" \353\266\310B\36661\2058\022\244X\021"
+	.ascii	"c\2443\216\356\037\257\221\r\217\312/;\367\367\277o`\210\223"
+	.ascii	"\020\234\002\317J3q\016\332b\001\247\017}\376\"YT"
+	.text
+	.section	.gnu.lto_quickMedianFilter3.18.59b44ce9b1e09c2e,"e",@progbits
+	.string	"(\265/\375`\312\003\315\027"
+	.string	"\326\251\217J\340\360&\035\333\006d\334\017\356\030\326r'3\326\337.\323\374\202\316\316\352\005\211\030f\345\3770.n\003\376\366\023\315N\363\325\205\006\323\330q\310\f3\314@\230\037\240\203\260\351W^\333"
+	.string	"\276\255\017$#i\204\020\262\267\224I\006|"
+	.string	"u"
+	.string	"z"
+	.string	"\341\351\226\341A<\204l\311Y^\300}@,lt;j\255\257\326W\337\351|\310w\332@\333\237\345w2\371Q%\206\340Gg3\271\007Q\346\207\242\235\r7\373\330sU\017\017\213$>8;\017\235n;$C7\035\006+\374\233-\233\331\322\325\230\316\001\265\326"
+	.ascii	"\270\t3\001\337\340hxn\310y?\351S\005\021\317\206\3139\203(\265"
+	.ascii	"\326e\033\016\347\373\361\335u\332\335\223\335\316\020[\316\370"
+	.ascii	"\265\177vE^\376\254\345]}\367\035)\257\212\362\212\2247\244\274"
+	.ascii	" \345\375(/\245\274\223y{\362\362\344\375\210\200%\031\fb\324"
+	.ascii	"J\241\327\2436\321%\r\337\375H\377\210}\322\216\373\035\031\316"
+	.ascii	"n\341\216\306\013Wx:we{\335\216k\364#\331\221d\302\331\315\001"
+	.ascii	"\220\013\250Zk\311\351\2264}0\357\276\350\"d/g\016R\353\217\022"
+	.ascii	"\212ZK\327\"\b\365\353\334~M\033\302\021\214\032\226r}] \310"
+	.ascii	"\344:2\354\353n \005\217\307\022\215{\264s+\n\265H\2036.\371"
+	.ascii	"\3307\217:\262Q\303R\237\265\326:;w\362\033[\244'S\315B\357\356"
+	.ascii	"\312u\344\201\247Z\353\002\312d\303\261W\222@\206\030\3663\375"
+	.ascii	"\033\036\032"
+	.string	"\367\226\233\325\335\257q\230\337\026\337\233\373\265!\032\356\355\330\357'\235v \342\331L\321\270\327]k\235u\3476,wy\204\257\312\t\314JL\n\354\325\022\203\301b*\257\026\226\024\330K\345\005\346u2\2621\227\007/\257\230X\354\3455\226\365\257\375\263\352\026\255iVf\326\352\323\340H?\224\221k\225\303\303\216b\363L<$\nTunU-6KH\325<e\"\022\210\372\304\220O\2248\007\351\230a\3476l\260\001H\255\340/\323w\032\366o\200}\335Af\324h\220\366wJA:_+x:\211\263\266\2545[\250qL\250\234\251\200DDR\220\202\244\325\200\002\231\252\253\007\021p9%y3\354\006b\330D([1P\006\241\363q0\333\363\236\272\323\372p\311\035\304\357\347\232\334[<\004\341/ ]\3034\366\274\330~\353\005\230\035\376\"\337\312\036lBv\036R\365\346H\020Cd\277\300"
+	.string	"\240\213ir \321\243\035PT\316\272~\326\001\274\236"
+	.ascii	"d\t<P\016\361\202\236\246\t\226\230s\022e\350\0070\033\343'd"
+	.ascii	"\274\t\251_\300\n\003\001\345\340\213V\352i\340\372m>\340\024"
+	.ascii	"!;\005\227\310Z8)c1T\2436\036\274x\022\263\022\323\030\316t]"
+	.ascii	"2\3224\001\300L U\003"
+	.text
+	.section	.gnu.lto_quickMedianFilter5.19.59b44ce9b1e09c2e,"e",@progbits
+	.string	"(\265/\375`\252\006E\037"
+	.string	"6\364\262H\260XQ:\360\272\357\231i$\221\371\016\331\271\214\325\025\255\240\n\346\bFO\237\r\361\346!\311'\255\330\350\270\332\330\203\tc\354\235\302\207\322\237R\236\3468C|\237v\302md|q\233\265\377\355\377F\b\331D\312\224\002\244"
+	.string	"\217"
+	.string	"\234"
+	.string	"\227\346\215\277q\243\034\337@^\213\\8\004\305\247\227e\316i{y\200\360\022\374,\274\334!\313\203\274\033\324\333g\262\030\354\345j\261V\252\324(\206\022\\\275\371b\003\320\006\216$\270\234\316g..sA\244\261\335a\273\026\372Rq\227\212\024\332Bq\026\212\023\2722q\225\211\022\232*\300\002\004\211\217L\200H\024(\002\nRq\304CW\316\007|\351\365\250\004U\276\037@\\\271\016 \002\242\242\030_\272\376\344x\024\214!\342\373\245\203C\216\260\340r\"\256b\2039\247\025\227\003q\003\270}\f\266gl\031\025<\035]!\337\213(Y\274B6\355\274?\306j\230+\3353\251\226IuL\252aR\375\222j\227T\267\244\232%\325+\251VIuJ\252G\251\026\245:\224j)\325\240\252\027T+\250\276\314+\313\222\005Ns~\370m\231Jd\023\214+\375I\277\016\177\311+_\3516\352"
+	.string	"\215JNSj\343\345h\347\370=\257\234\343H9O\3220\352"
+	.string	"9\030\222Re\316I\2734m\274\374\n"
+	.string	"\252\366\217\216#\347\274\r\217\315)\304\024dN^\3151c\366\205\227\343>\312\214\270\357=\326\304\311\212\253\333+1\355\202\302M\360\364\035\037p\200\310\f\243pu\016Wn\r\022\022\016\032U\013W\300N\346\275\333\270\357\335\200\220-5\232v\364'W\347\024\321\322V\304)\355\263\375\221\207Bz\302A\243\016\3169'\270\272\337\302\331\322\026\364\365\244X\333\017\336\273\301<\3159\025H\037\316\212\337\224\3416\276\3607\354\177J\354\350\317\2721\273\373\036\031\340]$\374\352\276\247\210G\177\236\355\367K\2274\216\260\370t\331\321\337.\221\220\020\036vuv\023^\341\030n\232\031\013\022.@\260\261Q\270\261\261\271\241\261Q\230"
+	.string	"\301\306F\203c\3016C\3007\025\"\340\330.\334\334\340\330V\274\371\025\202\331\227\235\345\261\006pN\026\f\236\364W\311\241?\303h\231\305\026\310cL\273 \331\352,\333\330\326\310j1.5\034[\035\022\246\253\221\017g\005\006\333\027\354\365j9\271j?\\\256m9\251\253\326\332\326\352j>X\2533kW[\303\252\255\264x\225Z*=>\203\022U\252M\355"
+	.string	"\242\031\325j\027\231\224\f*L\211{\344I\233\354\202\306U\037<\256\273+\340\270:\217+n+\312\b\370\200\234\250\221PF\221\220\214\210\024\024\244 i5\320\002\221\251\252\007\022\200\2049G\305&'%\255\326\377\016\"\204\230\026\254\374\252O`\345[\264{|\364\301/\247\325P\340\366\205Y]\273\3341\034P\202\025~\201\316s\013\007(X\320K\310\032E\310\005\025I\224k\307@\035\206\024\2047-\335\f\002\217\330\265\215\373\024A\233\333\205\"\310\264\202jM\225\212quK#\2406\006\237\267\004\233\311\031I\336x\r\034\332z\211\261\025\t\355\311&\272\206u"
+	.string	"|x\221\234\334\202\366k\027\2407\364\250\340\353\205\243\325\351\317\341\240\ni\006Zv\255\207_@\310\3314\004\320QJ\313\026?r\235$\325a\"\227\f\334\004\276\275\216<\005\323\264\320\364\302\371J\241\214\360\203\240<\030A\023\265!\252A:\241\025\340f\016Z~\241~\255\207g\2760\0265\230\252)T\313\301\250b'\020\374y*\201-\2665!3\344\0309c\023\236\3269lA\213\305\202[L"
+	.ascii	"+c\002Ng\272d5"
+	.text
+	.section	.gnu.lto_quickMedianFilter7.20.59b44ce9b1e09c2e,"e",@progbits
+	.string	"(\265/\375`\027\013\245("
+	.string	"\272@\270\rJ\240\226U:\204\276}u\237\371\025\200\006\230\n\327\243\343x\350\373H"
+	.string	"\023\230\205\2209VZ\340Z\252\355$\221\367v\232\344\027\315!\254\302\353\260\026\274.4\021\306\023\330\254'|O\005W\264+\332\266m\333\266\222F6\2212\311\321"
+	.string	"\261"
+	.string	"\303"
+	.string	"\003\314\323%\232?:\322\315\nI\"\n\240\362\304\024\236\"\224Zk\260\345\267\362\224|\255<\355\023\253:I\374\222,\274\217e\245\307\333\351Tr\270\233\255F\233\311b\260\227\253\305Z\231\252\222\222\315\302\275\352\205\204Q\303\330\003\204s_\322Y\222d\360J\214\367b 1\357\350\273#\030\2543\272\212\321\013\316\021\035G\304\202o+n[\241\202k)NK1\304\263\341eC\024\034+qX\t\022\374\032q\327\b\021\334\nqV\b\020\274\002`\202\303\207\233E~>"
+	.string	"(\372\tb\225\207\227d\013\017\331R\334aJ\232\265V\030\020\006\322"
+	.string	"\373"
+	.ascii	"\3510\331\242\303\373L'\1770\351\350\001\352pV\275\324Z\227{"
+	.ascii	"\2008|[\276\313\nv\027\270\273\322\020\265\342t\237\273D\034"
+	.ascii	"n!b\013\355\306\234\370#X^\230\033\277>\312\313ByW(o\217\362"
+	.ascii	"\362(\357\216\362\352(\257\n\345\315Q^\034\345\275Q^\033\345"
+	.ascii	"\255Q^\032\345\235Q^\031\345\215Q^\030\345}Q^\027\345mQ^\026"
+	.ascii	"\345]Q^\223\362\252(oIy)\345%\231\267I^&y\237\200VD\344\300\261"
+	.ascii	"\326\rG)u\b\355At\343\277\364\323\3303mko\024\2328?\246\021\211"
+	.ascii	"\206\237y\n\333\275\331\027\267\2653\256t\363\245\n&\316O\314"
+	.ascii	"0C\223Z\253\313\351\272\230\247\037\322c\336\275\214'\335\234"
+	.ascii	"h\341\263Z\205r\354\250\225\370\333\255U3i)V\367\323\2153\222"
+	.ascii	"\223\212\325\347\262z\325\271!\250\222\325<\345\267\242I\225"
+	.ascii	"\253>\201B\330\210\311M6\316\303'\244\331\347\232\255\352\327"
+	.ascii	"\024\320\354/Q\365\213\237\031A\322*\3327\346\030\006\225]\340"
+	.ascii	"5\236+\373\334\262i\317(=]\340\251}\372:\225\247e\343\206\004"
+	.ascii	"^\024\232\375\342\003\374(F\351\221\303G\332\347\256\206:\246"
+	.ascii	"U=\354r_\373\\J)\311\005\236:Yk\255d\237\027\226\276\216i\322"
+	.ascii	"i\207D\357\356\313\213B\001Gj\255\006\250S\217\223=\020\nBS\305"
+	.ascii	"\336B\337\007D\016\037\227\033Aw\177\307\005\371\rR\276\271\277"
+	.ascii	"S\244\303\307\365\365\373L\247/\230t\360L\311\341c71\016\016"
+	.ascii	"\341\023\2762\300\b\r$,\240\t>\250\241\241\251\221\t>p\260\200"
+	.ascii	"&(c\023!\b\334m\r\004\0066A\t556\301\026\261~\211-\004\323-9"
+	.ascii	"\255\263\025\310ZM\034\370\322\337d\006\037\027\246\311h}}:="
+	.ascii	"\347t\226>\227\245Wz\206\245q+Qv\205\367\3435)U\257\327\274\316"
+	.ascii	"\r\365x%O\327\273\237\017r\327\347\356Z\327\257\251\335O\327"
+	.ascii	"\272>\243z\250\250t\356I%*g4\332\\\237<p\270\276A\341n\267\032"
+	.ascii	"p\207\315\3265[\177I\2556\203\242\265\216\347N\353si=\353\031"
+	.ascii	"(\232\222Y\224Y\354I\006\314!\353se\035\353\334\220\f\030+c\257"
+	.ascii	"\237\020\034\247\031\031\006\301`\375\372\301^\257V\224\253\233"
+	.ascii	"\\\256nE\221.%\334\242a\264\001\201\003\250\221XE\221P \"\")"
+	.ascii	"HA\222\3261\006\204 dv\035\022\300\203-\210\305J"
+	.string	"*)H,\367\3773\302\370\265+\005\353\333Mi\312\0178\330\345\265~F\271\344[\302\017\002\177\200p\210\177\374b\007\337\317{|\021O'\r\306B\307S\275\375Q\370r\021'k\343\370\\\302\324\331h{)\224\353\235y\201\370\340dj\363R\341s\275\273\303\306\r%\033@\232\330\377\366B\270Sx#\251\367\200\276U\332o<#\230\340\314\320T+=$P\214\310P\372;\375R\362\306\275\261\0220\223\214?\230IdI\253'q\360\3559U\356\247\234\336K\231yq,\247\003nB\233\225\366\254\212\234\233\"\3662\313\334\233#\272\237U\314\021\305'!\212\021\001\273\211[\006\250\020/^\340@\210\"^\362\273\234\264\242t\350%\025\335d\246\276\364\177W\202AG/+\262\201f\335W_\321M\262Vt\254\224\020\271\351\203\357&\257\322R\270\364\337y1\022\361\364\321.\245[)1\021P\027\344\033\220"
+	.ascii	"\024`S\220\016C&\337\236\231\026\004\020\336\263\322:\353\342"
+	.ascii	"h\223\\A\335\003\313\376<\344\005\356\264\244\265\270\316\004"
+	.ascii	"\1774\303\374 \362\035&\013\214q\"\331\tZ\342\216\221)\f`\304"
+	.ascii	">\210\242\205\351\327\224\036\361\021\207\241\036\230\032kl\264"
+	.ascii	"\025\201\252\252\370b\007f\rh\036\3648e\242\265X\265\306mk\r"
+	.ascii	"\252\316u7l\232\366\260J\307\314\332{\270\f\017\245\2050\376"
+	.ascii	">p^\223f5\030rL\r\346\017"
+	.text
+	.section	.gnu.lto_quickMedianFilter9.21.59b44ce9b1e09c2e,"e",@progbits
+	.string	"(\265/\375`\210\017\2752"
+	.string	"ZO\f\021J\240X\231\0162\224\323\266\320Q\235|\347\2307\241\312\332\361\021\220\366\330C\366\337\231\274zh\375\363\245\200>\336\2471\371\346\252\354\215\243\005\274\016\257\362)\354\360\362\007/\303\370.\340\331\361\3218zzzz\322\366\336r'\231R\f\001\346"
+	.string	"\367"
+	.string	"\254\347N\262n\303o\350\2641M\2528\252\310\020\032\224X\\\327-\362\234\246zN]\246z\376\024\215\3624\351\235b\243\023c\2060\302 \360\347{\351\361v.\272\034\356fkik\264\231,\006{\271Z\254\225*\205bW5\247\217\215\355\253\201\264\306\217'\237\343\216\023\225<FI\t\036&q\230$H\2600\210\007\203 a\340\221\377\216\226\330\007\304_\200\374\300=#\347\031\025\341\235\016w\321\221\003\353px\016\307\r\214\263\3417\0335\260m\310[\206h\340\366\205\327^\270\300\264\026>k\301\002\313Vxl\205\020\206!\375\205T\201]%\274U\202\004f\215\360\325\b\021X\025\302S!@`T\357D\207 g\237\374\004\365b\374"
+	.ascii	"\341\365\203\253\255\243\206\224\247\354\3019Ue\004\035\265\216"
+	.ascii	"\031R\002K(2\274\310\361\206\343\005\234\302\360\340\357E\236"
+	.ascii	"&\031]\3619zp\274\032p]\267\261\317\261\203\267\214w?\200\356"
+	.ascii	"\246\351f\345\002\032\262\360\340\247\377%\024\031A\377owr\007"
+	.ascii	"\007\bZ:\373Qt\333x\322\275\246q'p\"ob\306\035\223q\0173n\230"
+	.ascii	"\214[\230q\0073n`\306\375\313\270}\031\367K\306\335\313\270y"
+	.ascii	"\031\367.\343v\311\270u\031w.\343\306e\334\267\214\333\226q\267"
+	.ascii	"d\334m\306]\313\270i\031\367,\343\226e\334\261\214\033\226q\277"
+	.ascii	"2nW\306\335\312\270Y\031\367*\343Ve\334\251\214\033\225q\263"
+	.ascii	"\031\367\232q\253\031w\316\270S\214\373S\3348\305\355\nbQ'\b"
+	.ascii	"\242\270.\207''\267I&\362\302\211\334{\270\373h/jU;\221\221\335"
+	.ascii	"\371a\211\244\220\230a=\317\272u\332\225\255\352\035\316C\307"
+	.ascii	"{T`w~\016 GD]\327%zn\"\353\031\233\370a\334\3559\\\207\216'-"
+	.ascii	"8\314uQ \tq\335\344L\017\003NH\353\353\365\256o\205\240/'\325"
+	.ascii	"\345b9[\177\324j=\313\331\242a=K"
+	.string	"\365+\231\245\267L_\375\333\253W\375\315\314JF\305\324\252\177\243T~)\365\317\004\210\343\033\3145\225z\324\267BQ6\3658\013tE\305\226T\324\372\\\342l\"\201\330\307\313\037\216\221VR\366\337f\177}V\323\323\233\371>\305\231\256\357J\2075\245\374\232\337\211\220\220@\352\013p\272\221\267\266%\224\031\352\277\255~\376\033\036L0\340\246nbo\246\352Y\375\032r\306\225F\366]\351\276\244\244!\"<\370)\377\333(\241\267\371\325\007\023\235\370\033|\211\307\023\003n\362\324u]7\375\327\215*\361m>e\366\220\370\3566\252p\245Q\350t]w@f\372TigB\301\310\262h\267\360\276\001\004\017~j\3745\377\357=3Ro%\325\037\277\367\304\270\200\237\232\370\376^\344\231\206\321\225\r\374\201O\360\266\241\211\300@B\rN\321A\016\016N\216M\321A\203\032\234\242\r\204\bE\232[\347<X"
+	.ascii	"\241(!'\007BQ\225t\375Q$x\036\317_\350\n\251\353\236(\340=\334"
+	.ascii	"\243;\02205\361_%o\231\036\363o\307\374\360o\2321_\033\036\031"
+	.ascii	"\032\n\235J\\\266\204\004\202\201y\341\267BN\230\307Y\234\204"
+	.ascii	"B`3\230$\r\376\333\301\007>\253\251\031|\237\002|\340\277H~\377"
+	.ascii	"\366\357}\177\003\375}\315\307\324\276\177\233G^^\276\367|i\366"
+	.ascii	"\324\336n\211\021\2175S\336\277\315"
+	.string	"\373\335\263\232x\357Sv;\3353]\\^\347\344B\24332\244\303As\316\244\\\356q\320\234\023\247\342\376}\026\271\335\336\026\275\331l\355\023q\030\022\022\250\345\337n\371\366ohZdZ\246\226\026\255A\207\254\265\332\323\276\025\212\326\036g\201\322h\262\347\354\205\314f/{\316\2342\031,\026$\026{Xl\006\306\034\202\271\240\257\201d\250\201dd\221P \")(HI2\214\001\201\006\"CV\266\001\022`\262A\216N\031&&\222\032K\373\177\007a\036\266\370\226B\nx?\0078\311ek\214e\300\363\341\n\335\002\277\321c\221\240c\030G#\240\327\370\256\f\224Vr\0368\254\324(O\205\372\274\307\270e\017kz\363san\272\001\032\276\360\333X\204\305\275\201\353\310\3355\023\037<dQ\\\254\342U~\013\276\267\333l$\335\367\t\346V I\371\334\324\376\327\307\225\2274P\260\223I\373#"
+	.string	"t\254%\373@\254\241KK\216\201\276\341\006\006\260.E\252\332\222\357\023\327\371\377\305\353\035\236\333\221\375o\332\331\351\035\273\256\360,_X\316>\304\354\0363v`)q,\037\3675\212b6 \020K<\241d\244\3663\333\353\230\373\305\276S\027\031\002\200(R\360\207.nZ\321A\364@>\310m7H(\277\224\264\337\227\362\223_\017O\310\376\377\037\317\372\264-&~\2264\200j\202~\246\275\335\t \365\332u(\357\\\032\032f\221\273R,\213IC\216\003h\216\317\233#\263\332\017\323-P\022\223\271\222]j6*h\322\370-\226\255PU\024-\346AuS\371<1X\033\317\314\352\242\017Xv\312\016\b\rZ\f\022\230@\"}\202\204\347\t\250N\222\266$w\350\334b@d\262\204F"
+	.string	"\340\201m5p\265\260\223\001\260\037\277\205\002@\036\271\254\330\350\376\230z\330\302\363\226\253q_w\230\261\217\005>\221 :BAK\0058\337\016\340\213B\037\206>e\034\177P"
+	.ascii	"\224b\361\315\030\353>\345\006\b\257E\214h\300;\327E\327\322"
+	.ascii	"\263\360\225w\224\313N=3\215R\022\270U>\207;.\236\232\233\352"
+	.ascii	"f\262C[\256,cb\251\271\251n&;\264\345\3122&\226\232\233\352f"
+	.ascii	"\262C[\256,cbi\332\220[\257T \206\313\327\330\2163\314\346\013"
+	.ascii	"Q:\t\020\037\023r\374\003"
+	.text
+	.section	.gnu.lto_quickMedianFilter3f.22.59b44ce9b1e09c2e,"e",@progbits
+	.string	"(\265/\375`\332\003\305\027"
+	.string	"\006*\217H\340\322&\035R72M\355\312\334=\250\266v\245\3025\312%\377?C\237\302\200\034\016UQ\323\344\346\016\017\247\365\037\016r\232\030\007\252i0\2141\3568\326\231g\341~\217\221\305\006T\241\203\325\245d\033!do)S\n|"
+	.string	"r"
+	.string	"y"
+	.string	"\227\016\277\233\370\t\227]\024C\016\036\216T\202\307&d\316\271J\035\325]\306\227t\227\273\301\373\030\336Q]\007O\246\317\353d\\u\371\236K,\361\342&\243\275\016b\370\t\303\0055\251h\360\261\360/\307\314\202J\210Y\005\365(\274\213)\236\230\262\305TF\001s\316"
+	.ascii	"\264\b\361\200\366\320t4\202\230\360\375\320\343\f\\\222\214"
+	.ascii	"6\341\352\271\3149\2552\232\317=r\3339l\267\330\233\"/\375\334"
+	.ascii	"\037\033\345\341\177\"\325\250\337nP\252ORm\222\352O\252=\251"
+	.ascii	"\356\244ZJu\274z\243Z\243\372)%>8\030\034\315)!Gd\336\2202>\374"
+	.ascii	"\366\013\235\205?d\320\277\341|\257"
+	.string	"\331wCB\241\372.\243\355\362m\006\355\025\017r](\347{\315\026 \235\3701\347\\\271\364\312\215\221\253\375\024W\341zh\242\223\314\371\203\2131g\250\262\201/[s\267r\035\004\331\330\321%U\267&@,\337\336v\0023\216\206\310\200iNn\315\246\016\213\262\236LW\016n\317\203\004\365\330\321\245\3079\347\214[;N\007.\312F\243X\206\265\035s\233\213\n\360\230s&\220F2%\237\b\202\213>\017\276\211\366=\027`\232\263\356\311\356>&\"\3365\272\257\356c!t4gp\277\037\272\034\201K\342)\002\323\334\356\234\363\265[\263\3032\247\371\203\033\246\305&\346\346\205\265\232i\261X-\230\325\214\314\013k\005Sc\263jIq\213\246A\315\352\246\325\252Y\201\341\374\347\376\2406\005[\035\347\30495(\270\320\377c\205\n\245\203\204A\323\372\300\275$\311;m\315\2475\255\311\322i\225\b\213i"
+	.ascii	"\220\316\364\251\213+\220Q\374\266\346o\275\005\240DCo\243\375"
+	.ascii	"\016oo;\311\021\322zRu\0260\200*t\213\200\307[\374\304&S\202"
+	.ascii	"i\316\341\234\263\013]\250aX\246\230!!\031\221\202\244 i5\240"
+	.ascii	"\002\231*\243\007\021\2009$\305\263l\006\"\314\214T\276!||\216"
+	.ascii	"h\242\341\212\370\371\336\305\236\034G\025J|tco\367\240\263\243"
+	.ascii	"B\271\226\343\302\367\346C\300!\034\227'6\311\021\343\321\336"
+	.ascii	"\3047\220 K\277\016PB\016\322\013\232<\354C%\347\212\317\216"
+	.ascii	"\363\312\006v\363\334\263 7\tp\013\301@<\314'\324\364\371\315"
+	.ascii	"\362\270N\240\f\377@\366m\367\206\3020A\313\307\031\262\213>"
+	.ascii	"$X\242Uz-\212\235a\270\200Jwq\035\3147-\310\224Q{(\022\r\036"
+	.ascii	"xH\247}\313\023L\342\024X\016\322\353\0048\230>\372\007"
+	.text
+	.section	.gnu.lto_quickMedianFilter5f.23.59b44ce9b1e09c2e,"e",@progbits
+	.string	"(\265/\375`\310\006u\037"
+	.string	"v\264\263H\260XQ:pU\367\241&2N\300'e\254\252Zi+3\024\323\013\214\260\221\373\002q>\335\247|\247\225\326s\206\036/\224\203\346\307\016\316\316\312\307*\317\n\217\323\276\206i*\257CR\373\337\376\267}B\310&R\246\024\244"
+	.string	"\217"
+	.string	"\237"
+	.string	"\227\346\215\277q\0347\033\t\344\271\3709SQNo\312\234\323\306\362"
+	.string	"\341%xYx\271-,\017\362nPo\227\305`/W\213\265R\245P\243\030Jp\365\346\213\f@\033\276#\270\\\315e/\036{\341\243\260\335_;\027\352R\361\226\212\024\312B\361\025\212\023\2522\361\224\211\022\2122\300\002\004\211\217JvH\030"
+	.string	"\332\341Qq\304\303V.\007d\351\341\250\004S?\037R+\327\001L\340\003\024\343DW\235\334\215\2021D|Ot0\210\221\024\\N\304Ud0\347\264\342r n"
+	.ascii	"\267\217\301v\315\016\t\004\274\032\335\236\337O\323\024o\217"
+	.ascii	"=;\357w\221\352\226\017\3352\251\216I5L\252_R\355\222\352\226"
+	.ascii	"T\263\244z%\325*\251NI5J\252G\251\026\245:\224j)\325\340\325"
+	.ascii	"\013\252\025T\377EF#\211\003\2459?<Y\231Hd\022\214\017\375B\347"
+	.ascii	"\341\023Y\345\017i\030kv\306!\246#\332x9\3327\277g\225\275\343"
+	.ascii	"A\267\013m\030kv\0320\371\236\3149g\227\236\215\227_\001\340"
+	.ascii	"j?\307u\334\316\363\321as\366\024\375\230\223G\263\313\030\277"
+	.ascii	"\275RM\334\367\016;\302\264\342\352h\347\341\333\361\204\233"
+	.ascii	"`\351=>\240\207s\262\321'\004Bf\340\bW\347p\345\306\004\031\341"
+	.ascii	"\240Uh\341\n\330\275\214\373\336\017\004i\252\221d\243OruF\371"
+	.ascii	"\354lE\234\316.[\035\371(AL8h\225\203s\316\t\256\356\032B\331"
+	.ascii	"\316\026\374\341\244X\333\017\3363R\313\322\234S\201\374\341"
+	.ascii	"\234\374\244\fF\032\177|\037\355uJ\330\350\223u]v\36782\300\233"
+	.ascii	"H\370\325=\016\320\215>Y\266\337\023]\3220\222\222s\305F"
+	.string	"\237v}\200\204\360\260\253\263\003\023^\341\030n\230\232\005\t\027 \310\330(\314\310\310\314\300\330(L\200 c\203\241\261`\253\025\360L\205\b4\266\0133346\025o~{Z\226\305fo\274\001\234\223\305\202\013\375Ov\264P\221\301\026\3510\337\216'\266:\307\026\26611\032\254I\r\303V7\344\350zc\t\316\351\365Z\327\313\345b)\265h\276VkYJ\332\242\261\226\265:\232\321\007\364\276Z\235W\253\332\230\025ME\305*\3246\025]\346DL\245\026\265\002\252\324R\253V^P1(!J\334!Kjd\3073\326\324\307u\367\003\307\325y\\qYNE\300;\200\240\250\221XE\221\220\214HJ\222\222\264\032\340\002\221)\252\007\022\200\2045\006sM\222\024\245\320\376o\002P1-\0316^$va>\246\353\224+\262\361\301\260B2\030 q\224\374\225\313\354c\0314\342\253\024\374\221A."
+	.string	"W\352o\343\270%\f\333\313/\360\233\340D\034]x\231L\b\270q\323\350\026\345\255\216\307l\252\371r\370\016\364\201/N\226\245\353\367\356U\264V\336\344\033t\024\213\233\027\001\022?\326\363\034\374?5\033\003/\215\266\213j<\202\256\345\306\035\250\006=0'xH+N\344\237c\1775I_h\037\303ym\266\317L\233\244\330\352\354\333<\377\275\204\350\371\354^g\307F\355\367\354\224\f\005o\b\310\304[J\211\311\177`\277\247g\25443\211\n\231ka\013\020\317\006V\215E\t\211"
+	.ascii	"uD\200\237\213\2417\365E\206\t\272\364\001\327\261\254\034\005"
+	.ascii	"\242\212\025\206i\242\222DO\364\005\024QZf\030\3469\274HP\300"
+	.ascii	"\345\026\213\013'\317K.\201\004j\316\224\310j"
+	.text
+	.section	.gnu.lto_quickMedianFilter7f.24.59b44ce9b1e09c2e,"e",@progbits
+	.string	"(\265/\375`K\013\005)"
+	.string	"jA\324\rJ\240\326Q:\004&_wM.\276u?\376q\217m\340\301\311B\355\002mL\337)>\005\007\230\310\240\310\023\237[\360\202$\237\\;\306\313yrt\364\203\b\357\305[\177\350\305\270~\260\257\372U\277\375o\377[\311'\233H\231d\322"
+	.string	"\264"
+	.string	"\306"
+	.string	"\300\035`\236\356\320<\322e\340\354\026\311!\212\242S\031{\210Pj\255B\227\343\312S\362\267\362\264O,\353\344\360K2\316\177-,\276\036o\267\242\313\341Tn\266\032m&\213\301^\256\226\311*)\331\214\263g\301\2201\212M>A9\377)\275Ei\006\263$\335\227$\203{H\347!\305\340\335\321W\216`\260\316\3509#\026\214[q\225\025E|Sq\233\212\024\\#:\215\b\005\317J\\V\202\004\307F\0346B\004\277B\334\025\002\004\267"
+	.string	"\230\340\360\341&\021\240\017"
+	.string	"\\"
+	.ascii	"\t1\313\303K\322\245\207t!\3620%\315Z\253,H\003i\200\177\202"
+	.ascii	"v\230l\321\341}\247\223QOE\237\240\016g\026L\255u\331'\210\303"
+	.ascii	"\327\345\273\314`w\203\273\255\244\307\356a\2559\335\347\356"
+	.ascii	"0\207{h\330C\2732\037\376\b(o\314\233\276?\312\333ByY(\257\217"
+	.ascii	"\362\366(/\217\362\356(\357\n\345\325Q\336\034\345\305Q^\025"
+	.ascii	"\312{\243\2746\312[\243\2744\312;\243\2742\312\033\243\2740\312"
+	.string	"\373\242\274.\312\333\242\274&\345eQ\336\222\362R\312K\236\267I^&y\257\340f5d\301\261\326\rG)U\b\2052z\323\317\364\032{\247}\355\233.\2309@f\023\025\025\320<\225\355\342\354\211\373\332\245\361%\2343a0s\200\022P\031YRk}9\335\027\363\364B|\347\335\317\270\022\316\207\373\364Z\255C8v\324:\f\255\356$\255\304\005l\0378\316HEX\256>\327\325\255\316]M\225\256f)\300\226\215I\331\352\263\331\007\033\315\346\033g\")\322\354s\315fu\314*h\366\247X}\342kA\250\232E\3735t\020\t\225\004\n\334\306uD\037+\035>\226}n\331\264i\226\214\031\370j\215_\251\362\264\354\034\021\001\263O|\200\250&Q\240t\370H\373\334V\212\226i\226\017\277\374\327?w\262t$\003_\235\254\265V\262\317_(\177-\323\244\024\017\211\336]\230\023\267(\300H\255\325"
+	.ascii	"\225\362\261\332\377\260\260E\263h\277O\375\037\020:|\\n\004"
+	.ascii	"\335}\236\027\344\027H\371\346>\217\213\035>\356\257\337w:\205"
+	.ascii	"\361T\354\231\242\303\001\020.\341\025\2763\301\t\017(4\250\021"
+	.ascii	"F\260\251\251\261\231\021F\200\320\240F8s3A\030\344\255\215\004"
+	.ascii	"\0077B\n667\302\327\260~\207=\024\323.:\275\263\030\310ZM\034"
+	.ascii	"8\323\277\204\006\0377F\312\321\376\372\224\272\216\370\226>"
+	.ascii	"\267\245Y\232\246\245s,Q\226\245\027\365\233\022\226\317\327"
+	.ascii	"\275\316]\371zeo\327<`\017\222"
+	.string	"\327\347\362z\3271+\036p\327\273>\253\240VVZg\\\251\322=9Z]\237<r\271\306M\345p\270[p\207\212J\337T\372S\267[m\312\326\305\353\210\267\365\271\266\2565\315\224\rI-Jmf\244\005\237h}.\255g\235\273\242\005g\345,\326\354\3436#\221\220L\3261\240,\026{U\301:\007\f\326\257*\022\206\204_N\216\366\025\201\007\250\241PF\221\214\210\210HAR\220\24451\006\204 \305\314:\022\300\203)\310b\021e\2424-l\375\277\003\3028\347U\315\375\375f&\377\021?9x\316\331Q\214\206!4\016Y\273}\020\274\277\302\321\202$\3425\bS!/\231\261\355\037\267\n\260\027\2777X\323\013\344#))?\2265Z7\013\377\004\270\303\0254\353\034:\307\215\365\347\037z\227\225P\233{\363P\340D\301`\364\2440fEH\223\022<\315\321\322\264\243GA\333n\\\002,"
+	.string	"\254\270\300\360\357l\321\221\317\023\276e\320^\330\240\3756c+\037\251\005\"\340\n\374\325s\303\272\344\302B>H\033\371$Of3\267\346\202\340@\220g9\212\222m\260v"
+	.string	"v\204\335\315\021-\302JV\027\344\357h<h\265\243\"\226\215\\\222y\230\016\251\240h\032=\244\371\331t@l\337\374Z\216[\221\032*f\236i\323\361\204*\313\206(j\025}_\017\245\311\253\311\266\247J\217&\276\366\277\267\331\334\250\030\321\350\022\326\222\227\376?\243\007\313"
+	.string	"\026\337\324\344\263\320z=\200\031g\222\240\\\277\306*x\356Y\220\343\271"
+	.ascii	"\276\023\314]z\340\023\217\351E\250\213\363\\\360E3\374\017\""
+	.ascii	"\336q\262\b\035\247INp%\362\245La,#;!\034-\177\177{d\3310\020"
+	.ascii	"K]\313\325\340\330\302+\342U\325\360\204\230\305?Y\364\220A\277"
+	.ascii	"Y\364\220A\277Y\364\220A\277Y\364\220A\277Y$\017\323X\236\216"
+	.ascii	"eD(\223\216\321u\237S\230l\216\002:\307\244\023\377"
+	.text
+	.section	.gnu.lto_quickMedianFilter9f.25.59b44ce9b1e09c2e,"e",@progbits
+	.string	"(\265/\375`\322\017\3551"
+	.string	"\212N\350\020J\240\326U\007\"_\fw\215\312\316\257\335\022g\005\016M\270<4]\376\251gQw\216\002\307x\355\300\344\210\317-x\344\022\002\225x\274\016\257\203\247\260\036\353\365K\002\225Y9X\276\341:k\317\367}\337\367\267{o\271SJ)\b\001\333"
+	.string	"\366"
+	.ascii	"j"
+	.string	"+u\016 f\346\251\\\341\242\257\262lX^aYVg\330;\264\357\3319\264\357\253\340W\237\312\346\323\201\372hSCc\234\221\211)\302\020\207\302\227 \360\347\353\271\360\326\235.\207\273\331j\264\231,\006{\251)z\317w \356\324\300\211\003I\027\221QP\037\251\332\206J\211\327$i\232$H\334\310\354\031f\224\313@u\f\324\223\027\235\032\306)\210\023\201\364\020H\223\013y\364\013\217\035\036\324\321@\0359\374\247\324>%\034\336Kj\227\244\033\316\213\321k\f\030\276{\321\272\027.<\327\242q-X\370-\331\266\344\n\257\231h\232\211\022>#\3212\022#<&\242a\"B\370\213\210\302\003R\253N\212\220\2104\212\216<\005\321(\315h\3039\\\016\371=\321\032HP4#\r'\201'(5\272\251\235\203\021\006?g|\350\357\246>\2150\255\020\031}hO\r\260,\313Nd\344\241\371\246\231\037"
+	.ascii	"3\3470\317\030\004H\377Hfe\220\007@zj\371S0\363\264\262{\347"
+	.ascii	":'h\246\346\343u\266\271\3165\327\231\346:\033\257\363\314u\226"
+	.ascii	"\271\3161\327\271x\235a\2563\361:\017\257\263\360:\277\\\347"
+	.ascii	"\340u\006^\347\337u\366]\347\336uv\271\316\274\353\274^\347\335"
+	.ascii	"u\326]\347\334u\306]\347\333u\266]\347\332u\246]\347\331u\226"
+	.ascii	"]\347\330u\206]\347\327uV\257sz\235\321\353|\257\363\331\316"
+	.ascii	"\177:\373\351\334\nV\031M\020Da\331\016]\\,\223K$F3u/\365\017"
+	.ascii	"\356&\216q3YP\203\212T\246\253-8j_\0353\020\367\222c\314=\332"
+	.ascii	"\007P/]P\203\212\016\\i\311bY\366\330\227\217j_?\021\323\316"
+	.ascii	"\334;\232\007P+9\252o,\233\302I\b\313*q\270F\355\313\312\264"
+	.ascii	"\207\242\321~\326\322rf\263\330\313n\236\232\267l\331#Y\366\261"
+	.ascii	"\357\301\221\335\304\260p\354\225\365R~\n\254\371SN\355JOR\030"
+	.ascii	"\354_\277ne\251\260w\256f\372\302QA_)\326T[\225<R[\017\322\236"
+	.ascii	"\224:\325G\262\372\351\317\264\260\232\245\276\243\264g\372\275"
+	.ascii	"\354\333\222\253O\357\367\017\250\344\021\372\002\332\006\322"
+	.ascii	"\274%\221\226\220w\365\236\240\330@\037\311\350\337\357\361Q"
+	.ascii	"\225\301\267\330\312\233\245\320\276\350\257I\034\365{\331E\251"
+	.ascii	"\245$\"B\336u\037\311/\026\317\363)\221\037\373\370\034\272\212"
+	.ascii	"\017\254\f\276\325'\313\262\354\371\310\266\200\036\237\347O"
+	.ascii	"\251\241\022\317\314@+z\311Lc\313\262\354\200+E\244\305]U\201"
+	.ascii	"\231\252\013n\216\372\346\020B\310\273\330\177\347\377{\310\306"
+	.ascii	"\331L\205\366\373\367\020\r\f\336\305\307\357\357\246\2767\230"
+	.ascii	"V6l\021\362\256\377'(5\002\016\032BSh\346\311\221\320`\302\216"
+	.ascii	"\217\316\203\037\037\237\037\036\235\007\016v|tx\"H\320\311\361"
+	.ascii	"\361\017\204\005\021t&\374\374D\320\211)\331\376\024\t~(\364"
+	.ascii	"\030\370\302\311\262(\n\364RwV\217\004X\370hCe\363H\266\371\232"
+	.ascii	"\357\261\262\371\265\206)\251\306\330*\351\334\224\344\021\r"
+	.ascii	"\315\033[\032.\243Q\306j\246M23\3632V3\255\314\313<\022I\314"
+	.ascii	"#9\346\213\337\323\214\371\265\210\205\213\217\264\232\202\201"
+	.ascii	"y\"\026\214\025\021%\n\247\2164\256\352\034>\222\207/\374\231"
+	.ascii	"\326\360;\212P\030|\251\227\227\017r\275\344\004\177$\005\177"
+	.ascii	"M`k\004\b\374_\023\330\376\320\337#\261\212\370|\337\313\362"
+	.ascii	"\365z\274'\3227\250\344\221\313#\331\345y\337\223\343r\303\303"
+	.ascii	"\302\333e\255\315"
+	.string	"!\351\272\376\356\327\255\254\365\235\253\271\333\345\260t/D\247\373\034\226\256\315\345n8&\016\3677\034\316m\231t\2535m\\Q\251\315\366\265_\267\2326.\264V\233\265\001\201a\250qhd\215\214\210\210\224$)H\2061q\006\"CU\306\r\022@\242A\216\307*\312\\ 2c\033\373\377\0061\274<\301\277\276\302\367\326#\277_\024\375^\353\217\254R\231\343\004\235\254x\235\206\371\3771\276{\213RQ\351\002z\264]b\3528\005\266\350\342\036'\216\217\220\n\006\002\373{\217\226\347\260\271\233J\356k\225\324\342\243V\300.\177;3\020H\224\210\350R\001A(J\365\211\007\253\370\267\270J\n\333\373\200}\267pZ\033\353d,\351FI\214.\n\225\243_\024\235\3507\016\205\237\234\247>a\332:N\241-\243f\242\f8$\240\360\001\027\277\213[h\n\315\243\247s\342\351\305&\264\271\001\223\306M\243]"
+	.string	"\275\312h,\341be|\304l+\340{\343e\355\261\367\2131H\023\206<\342sS\335b\301^^\206\231\003\004\321g\241\225\374\301y\226\3516\f\221\b\300\245\247\0218\304C\n\033\017%\206\361\207\001\337\361yR\310S\3002\362\024\235\346\271\230\350\377\\\367\257P\016\362\233\002\202\235\241\342d\033\262\204\350\200\372\003x\027\247I\007l;\354\013\372'[\326K\210TZmaM\265\220z\200|\201\263Ls\301\230\2623\352'\236(\216\177\346\331%2d\275T\033\224R\232\230\032\020D\320\300\243\260(\277\264\240\322[\256\217\027\304\314\227y\326\n\300\341|\020\037\362\025\320X\270\264g\304et"
+	.string	"$\315\002\227\271\2028\0250\376\217\357\301(\3721^h\006\363\003\371\374\332\0241c\252{\377/@M\001\366&!\200_y\375\215\305\206!\343;\221"
+	.ascii	"\\\316\217\350\221D\207\312\347)\310\352\262\367*\t=S\366\355"
+	.ascii	"\370\345t\275\250\232q\3721\252V\026\275f\376-Q\313\353}\261"
+	.ascii	">\221\244c\3256\314\r\301\365\312.\233\256\220\201\2252\353;"
+	.ascii	"\311\216\0227\001g\322D\031\377"
+	.text
+	.section	.gnu.lto_arraySubInt32.26.59b44ce9b1e09c2e,"e",@progbits
+	.string	"(\265/\375`\032\002\315\021"
+	.string	"6bvG\340\360&\035Z$\007\333\207\016\354\350\304j\232\320\262\3430$4`\355\364\021\025K\007\202\f\324\262yX7\033\365<\271\306\267q\360O\255\303Q\2061\206\316C\030\206\363\370C7\260\257\314\355c-F,![\312\224\002`"
+	.string	"`"
+	.string	"^"
+	.string	"\013\212\370\200w\316\340\005t\347\274\203t\347\374\262e\034\304\331\373\324\300\354\320\330\335O=\270\024\206a\370\b\3361_\347\242\346\313\257\335\300-\224\315X\316\305\322\213\f\210\323\354%\222$\035\005\335\366\214\231\3012\216\240\271\336v\004\267\"\331\214\346Yr\260\273N\331l\346\356n\333\202m\bvF\bO\2272\335=\315e:>\255\232NM?\300"
+	.string	"\332\013\t.ve\302\032K\304\005\205x\317\355\253\360m=\026\362X2x5\237\rG\273\033r\316\017\274s\347\260\235)\276\363:\217\205\"\200u\351\240\001hwE\334\300;W \036\244\323\261\301"
+	.string	"\034\032y\3327\361\234\327i+G\355\332\344"
+	.ascii	"mH\235F\365T\215b\"`\037Z\322\273\272\223r\032\215\374\237\013"
+	.ascii	"*\336\007\177\245{LMK\206N\365P\325\307J\304\273EwM}\214\004"
+	.ascii	",C\233\364z\333#\322m\006\314\215\226\fUk,^f\25276\310\222$8"
+	.ascii	"IGV\033\033u\332\377q\235\377t\360\3678\317\337\361\236\333\224"
+	.ascii	"i/&w\235T`\251\270\005\n0\244Z\255T\347J)\231\020\255\032I\241"
+	.ascii	"\340J\255\276\023\326j\305R}'&\251\325\247j\245|#\004\314B)i"
+	.ascii	"}.\026\253\365q\200{\265\361k\367V\234 jQ\030\24776\325(J5F\206"
+	.ascii	"\334\2441\035j\322\323P\f\271d\322\343\356nt\202\233\024\245"
+	.ascii	"\237\271\025\3058x\352\377\240\250\234`\344\217,* \240\202\031"
+	.ascii	"\313m#\016\224\003{G\226[\224\276\265\240\214\244Q\370(\376U"
+	.ascii	"\034\331\221\231y\233\006Y\301\211\005,*\260\004\213i\256\262"
+	.ascii	"\225\331\036d9\355\266r\ro\030\215]\334\2601\265\016\247\003"
+	.ascii	"\033gmv\230!\f\267dbin\300(\371^>\213\2440T\215\367#\322\271"
+	.ascii	"\304\023"
+	.text
+	.section	.gnu.lto_qPercent.27.59b44ce9b1e09c2e,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"U\b"
+	.string	"FP:6Po\322\0015\241\031Qu.\022)@\007\371vo\302\001\nEo\216\332E\2725\204\334\327\306\017b\002\226\336\231\231tU5,\256\333\223\020T\236\241M\266\224)\005)"
+	.string	"+"
+	.string	")"
+	.string	"$2\273\033\tn"
+	.string	"o\345\013\340-\3158\367\344\374\217\374\255\250\244\234P\242'@\303\356:O\250\212[o\033\301\266\202m\2263\333b\235p\330\336l\215\355L\373!\027\331\336\205,\260k\341a\262\273\fN\b\270\265y\266\375\217\203l\346\262\323\240\200\251\rSF\201\327\324\214)\251^\036\202\252\327,)u\220rew\242T\f\373o\365\302\357\335\257\232NM\037.\244\356\002\263;\261\n\022\367\305\371<\200:X\364d\030\226]\321\003\321\301\342\245}\"\347\300Y\204\203\026AY\246EM\267\367\323\315HIN}z\223j\224+\017<\013"
+	.ascii	"2\003\3020H\341H\232\315\2720\216\2145E5B\2011\002\2320RRL\327"
+	.ascii	"$\003"
+	.text
+	.section	.gnu.lto_qMultiply.28.59b44ce9b1e09c2e,"e",@progbits
+	.string	"(\265/\375`m"
+	.string	"5\t"
+	.string	"f\322?6@\217\322\001\t\261\337\365\3038\365\002Z\226H\020\363\341\357u\264\034\225\2025}k\310\235g\356x\262]\241\263*\212\206\003\227\013O\272\r\220\036\375-\333\233H\231R1"
+	.string	"0"
+	.string	"-"
+	.string	"\\v\031\022Pc#\365b\331\3358\360\002\370\227'\200\177\212q\356\311\371\007y\246R\262\242Z\225\236"
+	.string	"\013\273\353T\255&n\275\355\003\333\n\3661\001\021\261\226=y#,\333$\033c[\363.\316o\227\"Ds\371s\246}\217\177\220\336A8`\267\242%\262\273\tF\270\374e2\333~\353\035$\007\372B\301\236\036\305q\312\2303\275\246I\nf\312\230\335\225R/\354g\253\026\266\323\360\335\377\356\3723M\253\246S\323\277hXGI\331\r\243\007\320\307\363\034\356\316F\3240\342h\361\263i\332\326\211\037\017G\213\235\220(n\f\274\201\030Bq\264m\241\210\351\366\206\2321\351\311\252P/p\223\300T\325\016"
+	.ascii	"2\003\302\260Z\270_S\363 X\230A\270&F\322b\177,H$d)\240\206\200"
+	.ascii	"\023F\252\025\2230\311"
+	.text
+	.section	.gnu.lto_qConstruct.29.59b44ce9b1e09c2e,"e",@progbits
+	.string	"(\265/\375`m"
+	.string	"\005\t"
+	.string	"\306\021>6P\215\322\001cR\031\032"
+	.string	"\234\264\2126hP]\003i\270\331\214\005mv\234\336\326W\366\325\027#c\202\351\233\231id\371\330\375\305\267\001"
+	.string	"\315\263c\357-eJ\001/"
+	.string	"/"
+	.string	")"
+	.string	"\027)\210\241qj\251\354n\304\234"
+	.string	"\376\271\017\300?\265\270\350)\362\357q\207R2\202J\215\236"
+	.string	"\n\273\353D\245$n\275m\003\333\t\366/\001')\273\021/\327\232\274\220\f\333!\373b\263H2\226?k\332\347xG\350\033\204\337\356\304\ndw3>\260\374\t\244m_\365U\310\"\267\005\026\201\327\324\233\\\245|\331\3515?N+\244|\331\333(\265\302\276[\245\260\235\206g\375\357\333\3574\255\232NM\337\202\240zYgA\261\207L\315\321|\030@\033,f\032\206i\234\2305l\260\310\361|\242\246\300\232C\307\023A\232\346\211\227mo\250\030\222\226\024\352M\033OU\265\025\360\017"
+	.ascii	"2\003\3020-n\213\301\n\260\345\237\303\271\206G\322\002~L(`\016"
+	.ascii	"\f&\240\206\200\023F\252\025\2230\311"
+	.text
+	.section	.gnu.lto_sin_approx.part.0.31.59b44ce9b1e09c2e,"e",@progbits
+	.string	"(\265/\375`F\004\355\030"
+	.string	"\366*\227K\260\022R:\340\004\304p\360\331\343|Q@?\312\247+%\272\222R\365f \320H\347(\347\321\200WKt\332\267\277\337\n\235T1\273\300\212\036\322\177\320\277\200~\373\316\035\370\351w\264 \030\255\033\252\325>i\204\020B\266\2242\005\203"
+	.string	"w"
+	.string	"\200"
+	.string	"B\273%\261I\265_\350 wZxQ\303\344\243\326\n[\321d\003\214+\322%\031Wl\240\367\307\256m\353d\231%9\212\264\331U\373\262\r\217\302\266\310Xpi\322\215\034>9\033\366<\300\342\321\300&\031\363\311\341\331R\306.\0035\251\265n\321n\207\311\232\034\217:+\226:K)\231\303\031z\361pt\305\252\nj\203\3137<\0337K\304\205e\222u\221\261Z\353\327\306a\377\332\3774\376\253\374\364$\314\027a~\b\363A\230\377b\276\213\371-\346\237\314gm\323\336,\311Q\244\315\373\333/\200-\220T+\316\360\252\366\210P!\326i\267i\371\337\177O\320\276N\033\374\t\2445\321n\202c\272\220\326\340\022\031Q)\250}\201?ML\2405\310"
+	.string	"I\252\252\326\212\262\342Q\316\274\277]\252B\2733\357\322\2057kuq\264\242\326\232`\305#(W\374W\211\366\013\351/(f\267Q\f]\321\215\207'\331\343\217\227M/\212\325\276\377P}"
+	.string	"F\341\330\312\274\330\243\200'\003\030\224\216J:v\213\214\023{\201@d\373\236B\244}J\267\273oN\177h\200Qc7mr\322\365DJ]#}\"1\367\366\315)\r\020\006\216\255\336K\273}\302EQ\323c\252\376#\256V\333\3116\367\006\027e\304PGt\343\341{\333\251E\216\307\355{\273V\202\254\252\336?\377\376vG\002*3,\363\3422Cg\366-)1\021dXd\260\227\231L6k\201\275\270\260\310`-01\260\224\222\317$@\200\201\311\314f0\260s\373\247\301\223\2123\244E.\322\217\331\372\326z\200c\210E\366\251)v\t\210^9v\t\322e\207\364\362\320\365^\315j\220\346\037\036X\344z\256\\\375jQJG\324j\263]=2\351\212*\354\370\246v\340\316n\365"
+	.string	")]\357\306\303\022:f\374\026\f\2076\314>\233"
+	.string	"\223\331e\263Z\354P\243\354\262\003a\250aL\345\0303BB\nR\220\024$\035\260\002\231\301\342\006\021\200\255\223JhAI\n\255\031\257\003\360\221\377\343\3051\224\3424\236{\301xJ\027\nb\357#&g\320\317\356\243r\227]d\335\310\316\251\013\224j?L@\342\344c\362\354u\277\221\03106D\023\002\035\370U\306\030\337\230\246\206\230m\254\242\244%*\334\315\300\033(\260P;\214d\022\221\310B\263\335i\373\366G\372M\240\372\t\236I\270N\247\354\372)\004R\261\\\223%,I\230\202\374a\377\256\031\271"
+	.ascii	"\257D\fKq\355\212E\030\236\237\031\312\003\204R\275h\030\002"
+	.ascii	"\021\227\230\344\2604\361\232\266\202V&Ku\230\327\251"
+	.text
+	.section	.gnu.lto_applyDeadband.part.0.33.59b44ce9b1e09c2e,"e",@progbits
+	.string	"(\265/\375`X\001\335\r"
+	.string	"6\231[D\020\221\223\016\270`\301\027K\230\266\031\212\177 l\212\226(\022\344O>\366\327h\302M\364\302\365\367\2357*\036\204\306hw\262\353G\327B"
+	.string	""
+	.string	""
+	.string	"\200C\001\345\3319\336\337*\230\330a\302H\b\331[\356\224\002F"
+	.string	"F"
+	.string	"F"
+	.string	"\217\312\341\334\255\b\365]\234\377\324a\210\f\253\321\234p\353\215&\35113E\320cw\263Y\341A"
+	.ascii	"\223t\205\035\245\025\0262\263\004"
+	.string	"\026P\255\274x\352\357d\206\336\343\370u)\330]c\027n\354\2667\333\t\354o\b*\021\305\007\373\251\021;\263I\354\f\325\322\362\"\337\273\2378\330\355L\261\337O\2347v5\234\\v\027\301\243\r`\217\366I\214\244\330\366E|\004\2119\330u\230\326\n\f\223\024\215\335\225\217\036\037`=\302\013\260\002.QM&~\r \003\345\342'f\250T\240\232\364\252\252Q!\002\021z+\353\237\207QI\245j\262\315YW\r\n\f\352\245\344\305<5Y/\270\312b\307w7|w\353Q\377{\367\377\342 \200a\027eUc\003\234\217\266\200\243u8X\007\202\003-B\364\346#\204\201\210\346\221\237\315\343\3316\362\323@\363\310\r(D~tx{\320\001I\221m\003\311\354\312b\220\024\021*\b\t\036\270\204S\tU\215zb;j\306d\305\202\202\206,\250\032\030Q\311-bb\004! \240\242\242\345\006\262"
+	.ascii	"\346|\374\f\271J\321\r\276\031\234\337p!\022\243#P\344a\204\373"
+	.ascii	"\341\210\030\031\336\236\215\246\033\203\366\310\330_\034\227"
+	.ascii	"X\356:\314\211[pY\022\253\311%\336b\006\245\266\224\020\213i"
+	.ascii	"\377q\031\357\352x"
+	.text
+	.section	.gnu.lto_.symbol_nodes.59b44ce9b1e09c2e,"e",@progbits
+	.string	"(\265/\375`{\002\275\t"
+	.string	"\224\fw\003"
+	.string	""
+	.string	""
+	.string	"\002\037\177\031\360\372\2508\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 !\177\032\200\200\200\200\004\002\177\033\253\325\252\325"
+	.string	"\272\200\202\002\003\177\034\004\177\035\005\177\036\006\177\037\007\177 \b\177!\t\177\"\n\177#\013\177$\f\177%\r\177&\016\177'\017\177(\020\177)\021\177*\022\177+\001\023\177,\370\354\254\024\177-\200\200\200\300"
+	.string	"\025\177.\350\314\2313\026\177/\027\1770\030\1771\031\1772\032\1773\033\1774\034\1775\035\1776\001\036\1777\377\037"
+	.string	""
+	.string	"\200\200\200\003\002"
+	.string	"\302\001\003\003"
+	.string	"\241\341\365\321\002\005d\003\b\001\002\001b\003\f\204\006\003\017\244\006\003\020\342\001\242\007\013\342\016\022\242\026\003\021\020\004\001\202\001"
+	.string	"3 "
+	.ascii	"\003\231\242\325\001\245\240\nc7E\304\306~\3018212\271J\255'"
+	.ascii	"\226\ne^\237!\336\366\b\225\245\335-\030\263\007\355|.|\016\031"
+	.ascii	"\355\320\356\347\360s\342\177NB\266Bx&\257\340\035\f\337\340"
+	.ascii	"\033\276\361\033\277\361\033\277\221o\354\376\310 \300\212\307"
+	.ascii	"\320\241\243\330\013,\270\361\033\375\263\t\240\033u #x\327\371"
+	.ascii	"l\3251"
+	.text
+	.section	.gnu.lto_.refs.59b44ce9b1e09c2e,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.59b44ce9b1e09c2e,"e",@progbits
+	.string	"(\265/\375`\274\032%v"
+	.ascii	"*\277t*R0PJJ\007\372{\256\373\357\376\236\372\352\373#\202\351"
+	.ascii	"\216\220\340\225\255\247*\035\213\031\271\316e\372\336\323*\232"
+	.ascii	"\362\324\177\233\256\205\346[\263\247\207\274\177[{\224\212-"
+	.ascii	"\354\002\224%\207z\\\213]*\325\006 V\230\356\240R\305Vf\216\214"
+	.ascii	"\265\237\020)S\"\002\220\002\276\002\314\306k\\\225{\313j\331"
+	.ascii	"sU{\216j\317;\3323S{Fj\317[N\355\350\210N\013\303\303\256YN\353"
+	.ascii	"9\253\355\370\220\240\323\233\263\206\2255\363\232m\033Y\316"
+	.ascii	"X-<\234\225i\366\354\204\254\214\264\314N\372\003ca4\366\342"
+	.ascii	"3\276r"
+	.string	"6\343i\326\031[\271\223\336{s\226RC\250Z\326\206\227\355\371\266\307\241\375\r\355\317c?cq\026\373\260:mD\357\327\275\323\020?5-cu\315\212\t@\223W$\246H\263O\266G\301\345\024\306N\376\236'\247\262\332\027K\313\276\240\370\231\211\224\223\261\332\027\007F\336\346\262\266N\305\001\336k\206\025v\357\005\343)\\\205\251\034\306^L\205\241\234\2778\312\331\351\275\314{\357y\3727a'L\205\265N-`\306\275fS\006\320\302\342\205ew\3575a\302\204\t\001L\374xp1\013\263a\017B\313Q\026\341\013 \203\366\334u\003\226w\202\033\320~D{\235\366\300\366\335^\215E\370\020`\021>\226w|:S\026\341ky\307gB\002\0338Q\260\364@\n+\0018\315\033\033&\220i\226\275\225\333\033\312p\317\206\272*Q\030\027\376\347\301q\221\247\352\216\363\367Z\333\177\266\273\375\217\373\377v"
+	.string	"\376F3;\323z\341\310\b\251\232\277\235F`\372/\345?\225\377\324\377`\247\371\373\350\177\225\263\177\353\360s\003@|\177\223\360\365\357\030?\336\373[\370\376\333\347\355\337*\374|"
+	.ascii	"\373\030\341\277\2773\370Y\352g\247\237\227~~\376l\364s\363g"
+	.ascii	"\346\317\313\237\357\3177\374l\303\317D?\303\370\031\3713\320"
+	.ascii	"\3172\374\334\302\317&\374\274\342g\021~\366\340g\r~v\340\347"
+	.ascii	"\013~N\361s\317\317<?\233\370\031\201\237K\374\234\300\177\265"
+	.ascii	"\377s\377\177\370/\3663\211\237G\374\254\363\377\356\177\n\377"
+	.ascii	"G\3709\347\347\233\237k~\006\376\354\373\371\377\315\374\307"
+	.ascii	"\373O\346?\335\3770\377\261\374_\361\337\207\377(\374W\361\037"
+	.ascii	"\355\377\001\325j\265\372\263_\377\272\300\277\243\025rB\226"
+	.ascii	"\364xG\377\b&8\325\346\336\254{o\001\f\345\313\226\261f_\007"
+	.ascii	"\344$`K\2444\373\326\321\276e\264\377\331w\227H\367^\034\275"
+	.ascii	"\351E*\262\341\036\337\360\312\n\334kwo\217\2531\355\021\352"
+	.ascii	"\322\351\b\334_\335\253\fq\247\027\311\311\025\245tvqy\206\230"
+	.ascii	"^\250\021\227\313\307uN\243\236l\364\366\235^\276\314\250\347"
+	.ascii	"\013\3474\212\344\234F\225:\227\031U\336;}\3528\277\226JvrE="
+	.ascii	"\235\\\321g\210\313\274\312\313\265\204j\231\321\247\023K\364"
+	.ascii	"\251\343\344Z>\235\314\250g\b\036WSi3\304le1\224\223yo\030=-"
+	.ascii	"\221t\324\234\323\350m\273\227\277\232\027I\201{\237\242HmK&"
+	.ascii	"\016+R\273QDe\031\345\251Q\221T\3642\325\234H\242\367\")rq\215"
+	.ascii	"$PN\325.\025\253)}<]\033\315{\007\270\323{\215\356U\362U\273"
+	.ascii	"\367*\357\275?\244\247\351\275M:N\251\221\321\275P\001\214\356"
+	.ascii	"\223R\254yo\177}\t{:\271\244\242=b^\\\322+c\252d\351m\213Bj\271"
+	.ascii	"\224Z\327\206\230V\372L\242k\035\353\232R\216#gm\347h%\366\""
+	.ascii	"\321K\347\264fzo9\275S\272 E\317fuX\204\357\354C\213\303\275"
+	.ascii	"L\302\307\325*\223\360\365s\315!\357\336e?\273\223\032\307\373"
+	.ascii	"\371)s\002\314\t\344\374\332\256\234K\037\322\221\257\311\005"
+	.ascii	"\243q\344\323\352rf\271a\324L6h\030Q\215(\251\332\250\001\364"
+	.ascii	"\341\210\007\036j\234zc\006\344\n\213\306\f\032\350\023\324\223"
+	.ascii	"f\3373\302X\215\001\321,c\365\274\2359]\250uDd4m\320\222<\273"
+	.ascii	"\3717\263u\310y\242\216\2016\313\005\360\216\257\227=\357\242"
+	.ascii	"f\002\304)\244Y\037\357(\373FASr\245\331\367=\343\265J\247Y\263"
+	.ascii	"Yn\322s\256\262>\310\034\0319c\246\273h,\231\314\340\331\204"
+	.ascii	"\3455\227\362\360\332\352\206U]\263l\307e\330\353d|w sz\271\230"
+	.ascii	"\352\212\222JJK\364\253V\253U>Y\020dn\202T\247[\315\216\341:"
+	.ascii	"\336\002\fs\303\221\244\331f\200w\304l"
+	.string	"ib\244\303\331\354\317taj\326\340\240G\315\362\034\211\033&\333\221V\223\226\013\203Y\265\220B\350\3624\307p\254\205\267\\)'9\216c/\206;\211\326\211\230g\324\307\276\375\306\2028\242\224\266G\001\204Q\226\227#)\033w9\025\207\251sk\024\335p\3436\376\302^\001\353u\323\362\343B\006\314V\263\357\311X\227\353r\275nSzKc\315 b\316\234Y/\320\255\2079\234/h[\212T\277\336V\306\227\224\034`E\312f(I\313\313ss\322\272\262b\206\312\335]\223\371\340\214\264\345\201\307V\267\304\316\256\311|\360V\007\005\305\tH;fL\223\371\340N\235%A\355^\220cB\325l\223\021\301k\210\222\363n\232H\331\312\222\344\344\232\256e\253\002\212\301\"[\322l\323\305\255]l^E\315\366\\g\3511\267\342\212\332\313\025U\224W\r.\\\032NN\352\243+c\332\302\326`l\346\200"
+	.ascii	"\251\361\245\337\300\234\241ui\366,\263\355\266v\363yY\n\342"
+	.ascii	"\307z\306\001`U\031\027\004\215\024\257\212H\263\335\245\275"
+	.ascii	"\3204\231\331q\305\313\332\216\235\021\030\020<G\002\307\351"
+	.ascii	"\307\017\032@\334K\230\2567\026\203\263\306T%\354\013\032Z\253"
+	.ascii	"\241}\211M\225\322\336jq7:\320\351\300\244\331\326\322Y\200a"
+	.ascii	"\\\232oY\326\271f\0223\013\2265\255\206\2161,|\205Jum.ml\254"
+	.ascii	"\177\370Ae\256\207\304\214\2248\263\367\017d?#n\312!\315\366"
+	.ascii	"\2255\352E\325\321l\227\3254M%Mi\266\311N\326\342Eq\002D\263"
+	.ascii	"m\305\n\225\332b\255\023\351\221\273\252\252\260\267\030+\301"
+	.ascii	"\355hBq\244c\252\224O\252T\351)\037\364 \355*Kp>\210D\211\322"
+	.ascii	"S\200\027imH\r\333\024\016#R\336S\250@\271$R\"Q\\\\\re\355H\332"
+	.ascii	"\233\326\020\003\365zC\311\271skv\315v\027\326\225\231R\023\023"
+	.ascii	"&\275\325Ec\356B\241%\230\351N\tG\263\275\025\307e\005\354IO"
+	.ascii	"\273LW\336\322\324\311V\224\222\230\230\215\232\364J\253\331"
+	.ascii	"&\f\245\016\311\331\230\347\325UcuI[\233wp\325\036\336XT\234"
+	.ascii	"/ wb\315\366\222S\327(k<\236h\0349\322J\030\212\201\024\330\\"
+	.ascii	"/\261=q%y+!\313\311\222FYk\266\221\234\354\207\246E\252\007\031"
+	.ascii	"\253$\206\225\245\331\257\315\"E:\312\367v\301J\202^q\017\273"
+	.ascii	"\"<\334\265UUm\325\352\334\242.N\251/\b(\262\036\210\274\255"
+	.ascii	"X\2506\035S\315\366\220\0340\255\266\035\340Z!B\344pv<AR\304"
+	.ascii	"E\252\203H\365\224\317\307}\364T\253\274W9\275G>\2518\237\214"
+	.ascii	",]3\200\274\247\030\257\231I\236p\315\366\217\243)\335\034\343"
+	.ascii	"\371\334\220@\311\260\322\276\235\264;\032jGG;\270\227\247\321"
+	.ascii	"#\244\013\315Q\342\355\324Oo\036^\315\243\243!.\322\275\320\273"
+	.ascii	"\306\241%A"
+	.string	"\355.\364\251\204\315QwqB\250X\f\n\205\222\304\031x\206\214-\036 \0322\022\213\017H\220\302'\205\n\"\236\341\317PQh$\362 \205\206xxb\034\221.\222G\343\217EpXd\205=\026I\344\013\241^R8\204L\n\031\217\033\274\240\251\241\030DL\026\207V\274"
+	.string	"&\215C!rX\302\213\026\204\031\206P\250!\210D\006oXT@\301\004,P\354T@\301\004(\220\303d\221\330\301p\005\rB\342\320\013"
+	.string	"V\030\"\177BBC\2410\350\203\001\305\013=1\364\210\210\310dpE\362x\302O\22184\303\316\nC\033\210\305 \020\362h\244\031\2660\006O\030\026\203B!\032!c\220\370\023<\341\230\202\320p\210l1\374\3211\036\211\311 \021\306\220\203\037d\360\307\030L\242"
+	.string	"c\370\023\300Ph\f\022\221\301\025`\f\177j\\\b\r\225"
+	.string	"c\370\363C\006\207\305\r`\f\177Z\026\310a\214c\220\357G\330b\r\326D`\f&\2036BG!\315\315\21718\303Op\310A\r\305\240\240`"
+	.string	"\027\322@p\"\211\f\006\235 :\"\203\202\202>F\242P\210\013\211\310\241q\330\242\275\004)\036H\241\202\350w\025\026@`\001\004\276\253\260\240\247\307\202\024=\355S\364\254I\237\bz\210\210,~I\237\024=\021\240H\032\211\277d\r\213\341\217\317M\214`\rk\261xD\262.\204IbPOhXla\f\372b\004\221+\362\230\024\016a\370\004\261"
+	.ascii	"\262\300-\260\013\234t1\300\217AC$O\362xD\362\324\030}\200V!"
+	.ascii	"\037\030\303\237\244\320\357\025T\260\001\002*\214\340A+<!\344"
+	.ascii	"\"\031\004\3421\036\201\200\216B\036#1\b\304#D\n\361\234 \261"
+	.ascii	"bE\214\241\361\247x\364\001\362\241\020ch\364\001\362\005\201"
+	.ascii	"\353\225\311j\346X\247\246\262\330\300\220\246c\334\254\250\326"
+	.ascii	"\037\321(\3250`\232]w|\225\332\321\321\236\343\351\205F\225a"
+	.ascii	"T\214\331\311\231\331]\347S\211\336\016gM\224\232]\241\276F\261"
+	.ascii	"\255\241m\201i\327\036_\243NIoH\330\332\177\345\361\003m\202"
+	.ascii	"`\321B\267\245}\017\r\n]\235\226\3304\313P\2655}uj\372Y\325M"
+	.ascii	"\333\232]u4\024\250\225\246\003+lMZ\223\326\245\267!\322\033"
+	.ascii	"\266)\333\233\322\327\245\232\2670X]\232]stS\247A\241Uy\035\035"
+	.ascii	"\255\317\226\376\274v\240\252;\332\242\"}}6\324G\223UY\223\031"
+	.string	"\234\2222&\253su\256F<\245i\356\206I\345\204\262\332\370j\324[\232\021\025\325\354Z\203\363r\274\264%)\322\354J\203\363\326 B\236\2244\273\316\340< \031#c\316X5\233x5\312!K\342\234V\346\312\f\202I\250R\0011G\023\2251R$2\"I\222\2441R\013\020\006CY\240\365\314\003\022 %-T#\306Hh\222\244\324\001\240\216\034<e\030\276\211\303@\330o\007\354\326\241r@\346\376\263X\374x\245\305\203\224\367\001<\360\326\020\f\237\371)\3574}#j\227\266\224\026'\020\007\343\333\307<K\252\273=\375\303q\245\177|\310\025\b\303\341K\334\020\245\255\300\336\274\201ORYj\320\343\236\001EZ\024\035D/4\235\3013O\374\302\335.\306e\241\360\207=\251A\232\212f\245\366k<\362\276\247\353s\223H\274\266?*\326>(\303\317\0233\306\350\203\021u\237I#Y\353I"
+	.string	"\025\244,\177\217\245;g\225>\365\316G\364kN\232>\277\030V7\335\3275\026=\362n\331KzIN\006mO\351\245o\346\323C3\345\366\350\t~\025\3413\273w\246D\263*\016W\267[hp@-\302\276\nB\2643PS\200\177\223\236\362\255\343\356\213\016\207\227\206q5\036\"M8\235m}QY+\206\363i9_\"T\001\357x\231&\336]6aR\220}\341\266e\347\301\004\212>\277\270\304\306\2276IW\336\371\363\355\313\202s>\233\343\024U\305\316H\t\026E\006Q4\013\204Y\017\202R\017p:\323= \324\004W\016\013\326\267\025"
+	.ascii	"\271\224Ze\243\346\315\323\305\217\3170\353\327p\024\\\324\332"
+	.ascii	"\336} / <\316\375\215\356\031\351\"\340\340\233\267\262?\320"
+	.ascii	"\f\006\252\335\230OS\205q\232\327dA\030T\022\236T'q\303P\241"
+	.ascii	"\202\005\bhLr\213\370\224\207\200\031$;\003\002!\206U\352v\236"
+	.ascii	"B\205\003,$\245\322kh\303\\\330\360\272\302\t\\\"\244x#\033\360"
+	.ascii	"\0216\003 \t\t\"\rq\315\b\333\333\3462\027\3506 \324\207}\304"
+	.ascii	"\327\007\344Cw\244B\354\373t\277\007\204\335<\\\321g\343nhi\273"
+	.ascii	"w\3235\242\372%\200Z\026\237\232\276\24050\264\325\234v\303C"
+	.ascii	"B\265\260\364\211p\213*T\001R5&\230IQ\024\205:P\321\004\244\226"
+	.ascii	"\204W\b\224\277\321\205st\324|\263\352\\\003\0131\\\255\031\255"
+	.ascii	"\244\341@\004\030\027e[\023\230R\276E\377s\327\265\255bT\037"
+	.ascii	"\350S\343R\306\254\002\320\355N\033\372\021d\263\327i\221\354"
+	.ascii	"\266\0060u>\202\031\003\370\376\256\252;\241\344\215\265$~E\037"
+	.ascii	"i\370p]\225\330\240\002\273z\242m\037\020(\030\267H\367\377}"
+	.ascii	"w$"
+	.string	")2\034I\262\200\313q\335\255\340\241\262'a\340\356)~D\246E\304y\344(;^\365\265\350 }\227<!n\3114\036\311^\324\366\303\227\220\0346\317\035\031>\264[\206\231\304e\332\223XJA\025\0270\3109\301\376e\357u2 @\310\2536@6 K\330\252?i&\r\226\023\252\034%\332\214\232\317\001Q\352\210Z\270\277\005\253\325\213A\375\210\371\325p\222\b\334\302\210\261\b\315\352P%*I\201]\3603\331#\246-\250\201\230\301\375]\331\036\260\215D\026a\347\"\021\276 '3\334\016\337N\341|9\202k\016%F\365\354\271\312\037c\206\314Z\243\177\334\326\305\310^\300\346\360\352\002\340\325Uc4\037\230\376O\264\366\365y\266V\370\214\213?j\324k\360og\203\377\004\361\002{\366z_\2003\332\367\236\342:\026\347;HX\270\0329\360\b\257\263!\227\305Z\b\177\374\275\361\377\341\221w"
+	.string	"\374\344g\221\335\366\266X\363\354\324\360\260\262$\363\315\363M\224<\200\307G*N\032\256\330\035\256\337\240\\gvE#\242\037\004\303bw\007\323\364\325f\264\317\363\214\266\022?\341\271\340\352\201\177Z\273\026f\347\227\341\363"
+	.ascii	"\3701\375tw}v\006\314\226\366tb?\232\275\200]\263\203\201C\215"
+	.ascii	"\332\001\340\374\302\211\344l\340\343o\277\367\313\0039\220\377"
+	.ascii	"D\236\034\356\276\205}\235^\363<\t\374\320\266\341\361\305\232"
+	.ascii	"\025\370'\244V"
+	.text
+	.section	.gnu.lto_.symtab.59b44ce9b1e09c2e,"e",@progbits
+	.string	"sin_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\001"
+	.string	""
+	.string	"atan2_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\001"
+	.string	""
+	.string	"acos_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\001"
+	.string	""
+	.string	"gcd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\001"
+	.string	""
+	.string	"powerf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\001"
+	.string	""
+	.string	"applyDeadband"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\001"
+	.string	""
+	.string	"devClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\001"
+	.string	""
+	.string	"devPush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\001"
+	.string	""
+	.string	"devVariance"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\001"
+	.string	""
+	.string	"devStandardDeviation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\001"
+	.string	""
+	.string	"degreesToRadians"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\001"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\001"
+	.string	""
+	.string	"normalizeV"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\001"
+	.string	""
+	.string	"buildRotationMatrix"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\001"
+	.string	""
+	.string	"rotateV"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"quickMedianFilter3"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\001"
+	.string	""
+	.string	"quickMedianFilter5"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"quickMedianFilter7"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\001"
+	.string	""
+	.string	"quickMedianFilter9"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\001"
+	.string	""
+	.string	"quickMedianFilter3f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\001"
+	.string	""
+	.string	"quickMedianFilter5f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\001"
+	.string	""
+	.string	"quickMedianFilter7f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"quickMedianFilter9f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.string	"arraySubInt32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.string	"qPercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\001"
+	.string	""
+	.string	"qMultiply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"qConstruct"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.59b44ce9b1e09c2e,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
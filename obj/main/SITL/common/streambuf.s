@@ -0,0 +1,665 @@
+	.file	"streambuf.c"
+	.section	.gnu.lto_.profile.372c7274ad236d86,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.372c7274ad236d86,"e",@progbits
+	.string	"(\265/\375`\235"
+	.string	"u\005"
+	.string	"T\007\221\001"
+	.string	"\020"
+	.string	"\331\205\355\260\004\006\002"
+	.string	"\002\001\002\002\002\001\252\337\376\202\003\f\332\333\323\265\005\030\003\217\273\217\234\013\004\234\225\205\264\f\005\311\244\360\314\013\006"
+	.string	"\002\001\006\221\344\270\264\005\007\275\227\373\\\002\002\002\b\275\240\345\300\007\n\t\207\236\200\376\r\022\n\366\264\360\365\001\002\013\257\241\227\210\n\004\f\276\237\344\233\016\r\003\016\226\210\313\347\b\017\345\362\340\204\b\006"
+	.string	"\027"
+	.ascii	"6\t\200`\220*\346R\267\347\026\n\223\001\301\234\"`\224\001`"
+	.ascii	"\232\300z\201M\216jn\332\3469\2400BT\262\260\024@\002\233G\275"
+	.ascii	"\034\300&\243]K\032\030\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.372c7274ad236d86,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"\375\003"
+	.string	"\202\004\017\031\260%\351\f\3030\f+\034\206a\030\234\333\2555\322\032\331d\023\"w\222\001,\210\026\375\320\372\264\3566\023&\351~\261\333\350\006\306z\261\315)\274\232\034\200'%\243\364$\036\003\001\035"
+	.string	"\260E\326v\2260\3402\266t\265\247b\200T\203\243Va1-\204\363\"\037\037l\202\301T\246\311\f\347r\033\030\242\207\214\006\317"
+	.ascii	"A1\357T,\003\271\201-`\037\330\314e7\220\363\006\260"
+	.text
+	.section	.gnu.lto_.inline.372c7274ad236d86,"e",@progbits
+	.string	"(\265/\375`\357\003\025\013"
+	.string	"R\315%&\200\247I\007sg\322\231\202\200\341L\027\344\"&kz3\013\331\203\233\021Y\341`\006\375[\373\337\310\232\335[\356\024\377\337])\226\273a\035\365\211c~\307^\256K&\250\207\021\"\245\r\332\036\374a^\037\032P\216\250\355!%/\032\213\3351\254\241mb\244^4\354g\032Vz\347.a1\241-\342\003\271\224h\216!\017\363P"
+	.string	"\302\240B[\201\311S2\345\037\"\264U\216\203U\274 .\264]\256y\263a\315\3510*\260{\233\254\353z\254m\223\007\370\030\002^\2501eU\246\240I6\326\300\002\021\021\253z\022`\204%\206R\234(A\251\200D\002\t\204\244\244|\n\216\001\bh(\215\002]Yu\3277\220\230\314\2120\035\313\242\252\217s\215\226\"?\227ur\340\\\332\341h\310\024U\035q5C\035B\016\273\245\330\260\316dL\372\253\322\006\304\305\032\376\341\336\242\277^\205\363z\242j\205:\007\322d*"
+	.ascii	"\214v~[\016D\337\306c\356\243`D<Dq'\321\267\020\243\242\251\235"
+	.ascii	"\216\242\266\316\307[\361\023\302\310F\211\206\207\037\027\013"
+	.ascii	"1I)H\225\tZ\376p\222\357\223\342\2169\302\032\222\373\364!\243"
+	.ascii	"hg\035\024UN\370\300\t\313\3532\360\261!@\267\326_5-\257!/\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.372c7274ad236d86,"e",@progbits
+	.string	"(\265/\375`a"
+	.string	"\225\004"
+	.string	"RG\026\036\260%\351\f3\r\240\b\036\206\205\272z\350h\016\207\201\3006kmk\215\020B\310\226I\006,\202\004\026"
+	.string	"\\\332\037\007\215\"\335\263G\035\361\207\215\366\336\361=\206\265\326JJ)5\023\307\376+\344\265$\274$\223\007\365\212~\217\360\2339\305\330\2519\365\356!_\016x!\027"
+	.ascii	"Pp\315*\004\227\251F\250\201X\030\316t|\004V\b \016\202\315\314"
+	.ascii	"\0250\256j\340q FL\260\305\262:P\\\320L\376@\301\240`P0\227\362"
+	.ascii	"\0130\004"
+	.text
+	.section	.gnu.lto_.pureconst.372c7274ad236d86,"e",@progbits
+	.string	"(\265/\375 5\251\001"
+	.string	"1"
+	.string	""
+	.string	""
+	.string	"\020"
+	.ascii	"\232\004\001\232\004\002\232\004\003\232\004\004\232\004\005"
+	.ascii	"\232\004\006\232\004\007\232\004\b\232\004\t\232\004\n\231\004"
+	.ascii	"\013\205\004\f\205\004\r\205\004\016\232\004\017\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.372c7274ad236d86,"e",@progbits
+	.string	"(\265/\375`\204\001]\005"
+	.string	"2\306\026\"\240'\351\377\377\240X\241\353\252j\324\341%\304s\252\242\371\017o\210\217\020\333\272\315\376o\215\020\"e\n\037\030\020b\3758\217\002r\02466\002k\243\312\031\346S\307\205m\035\007\312\021i\220\350O\036\205$\b"
+	.string	"~A\305pQ\222HK\245\362\373\236\363\226/%\353\354\346\333\b\" \320\242\031$7'\201\277\360V$&To\003\034\016<\030\333\004:a,\3653]\333\353\271la\204\275\237\346\2478\314\334i.\314.\214\331\255\001\017tE$iQ\362"
+	.ascii	"\327\001-B2\223\002\362:G\320]\200\262H C(\002"
+	.text
+	.section	.gnu.lto_.lto.372c7274ad236d86,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sbufWriteU8.0.372c7274ad236d86,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"]\n"
+	.string	"v\223F= \345*\035 \027\013\260\303\253\013\001"
+	.string	"\001O\036\220PD\321\023{9\241\022\255\t\341\337~\034\026\353f\021Jli\352\n"
+	.string	"0"
+	.string	"E\350\343[\310\007\020p\341\007\234,\362\t!r\247\0243"
+	.string	"4"
+	.string	"5"
+	.string	"\356x\347\\\276\240;\347\235\323\2353i\307\030\\lb\031(\001v\367\323\217\223\237\244\377\222\013\264\\\252\317\314\303\356z\266\\\033\267\336v\202m\006\373\n\001\357.\373\267mzn\323\3672\036\034\225]\215\332\200\235q.1\333\327\330\326i/4\220/Q\326]\016\226\317\247\375\221\223\220\227\245>\260\013\023i\331-;\001\3359\002\230\327\324\224\315\313["
+	.string	">\277N=\r#\204\345\361''ow\035|\023S\311\003Iu\347\256\007/\001\262\325\254\331\245jj\207\375mw\327\n\263_>\024 \223\222\306\bu\310#Q\202"
+	.string	"A\"\2214~\243\020\004\303\3207\232"
+	.string	"\201_H\034?\017\202\303\n\221\370\221\302P\3744\345~[\205y\243\315V\312r\247\376\212\005j\372\247\022"
+	.ascii	"2\241c\034\030.\254\244\346\024\025\b\002\213\3124\250\322ee"
+	.ascii	"\323R\003F3\261\016v\225k@T\030\f\346\006\250(\341\016/\332I"
+	.ascii	"\006"
+	.text
+	.section	.gnu.lto_sbufWriteU16.1.372c7274ad236d86,"e",@progbits
+	.string	"(\265/\375`v\001%\016"
+	.string	"\206\232\\C\020q\224\016\tcJ\316>\002\324\311\234\034\227\322cB\211\371\007\"ov*\333\201\264\001t\255\365+J\177\024Z\351#A`DT\007@\005\200\322\001\006\"%\230)\234Z c\375\255\021\262\271\255\224)\005F"
+	.string	"E"
+	.string	"K"
+	.ascii	"\330a\200|\332G\271\b\357\250\222\013\3305\t\221b\367\353p\007"
+	.ascii	"v\350\357\003\256C\354\233\353\320\236\r\203\200\005\r\nI\245"
+	.ascii	"\306\356j\332\341\336\323\363\237zV2UxF\005\273\353,\2310\334"
+	.ascii	"z\333\007l#\260s\023vLcb:\213i,\246\343Q\377\365\224\377\002"
+	.ascii	"\323z\245\023\246\017 \033mb\354^h\335X"
+	.string	"\026\270\342\301\366W\006Z\250\\Er\022\206\032@\354n\346\320&\2613\207\231\261\255\337GxO\241`\270\273\301\305G#\226\372(B\"\370'\276\347:\344h9a\364\204G\363\342%\031\037\317\024\243\2371\372 \312\226\257\362v\023\036lw\023\370%:\316?)\271\0163\275\352\231\341d\003u\321+\003\032$V([\366'J\345`\377\262\273k5\t!\234\t\n\3728Pw<\036Hh\260q@:\320G\023\341\266\215\353h\"\0208\233\326\351>\232G\001s# \235\006\342\270N\313|\241\247\276\300\304\022R\221u\204\243\345\244+\242b+o_\361`Q\277JU=\211\205\335,\256\213\246>\365T\321\n! p\002\031R\326\001b\300\031>\221\260\\\nD\\\0031\340w\257-\203u\f\340\035^\022\311`>\262\005A\3028\332se\247\f\355\362\243\260U\216\253&\006F-\303Sg\303N\305"
+	.ascii	"\030M\3744\355g\217~Y\032\034\035:\274h;\031"
+	.text
+	.section	.gnu.lto_sbufWriteU32.2.372c7274ad236d86,"e",@progbits
+	.string	"(\265/\375`\306\002\235\021"
+	.string	"\026\240nE\360\222(\035\330\267\371>T\021\201/\377w\022[\t\334\250h\240\243\217\325\243\031\331\231\250^\301y\2643\360\375\325h\220\252,\031\364w6\016\303@%3\217\016[\251\235\317ql\253}\373\247\017\322\366&R\246\024X"
+	.string	"S"
+	.string	"^"
+	.string	"\334\241\306\331\316\330W\270^\223\301#\273 j\234l\207\005\264\247\375\024W\341:\r\313K\2730\024/vc(\243\266C\307. \036n\017\020\017\355\262}\220l"
+	.ascii	"\311^n\206\354n\247#\356z\272\374\333|\004&F\303\363\243`w\235"
+	.ascii	"01\035n\275m\003\266\021\330\252\n\327vw\2550;\246M1]\212iRL"
+	.ascii	"\217bZ\024\323\241\230\006\3054"
+	.string	"w\232\037\300k\376MK\177`:ji\b\323\232\226V\230N-\375\001\234\313\t\307.\207Y\221\345\2011H\330\276\316\216\254\304C\316\201\235\233\343\254\234\205\241\210\023\273\313\035\332+v9\366N\343\333F\372\234TU\324K\317=#n\232z\233\227\300~\270\364\250/\243\301\312\237\361\277xx\352!cR\030\037\210\307a\200\234\274\244&}\020\027\023-9\363q\354\335\305\267\355n\002\277\305\004\013\376\fK<,\351q\236\037d\210\320lze\260\343\245\347\2253;\326\222\032\302\016\024R\030\264\365\241\250U&\020.<X\245RX\255\257S\361V+O\325\251HH\255:\025\353\353L\b\330\253\220\302\352Z\236\307\352\270\330\353\332*\314\267\371\202\022</m\361'\002Hup\n\322\261\367\034\234^'\352\207$\316 \212Ho\204T$\263w\033!\275LSH\322\204\250\203S\017\031\222\356\214\224\024: "
+	.ascii	"\003\2211:\006rB\237M\201\031\311p\r3|/\326:\360\213\262=\220"
+	.ascii	"3\330!\347\022\230\001k\317%\262\003\254#rOr\007;\344\\\202\031"
+	.ascii	"\030\256r\264\347\022\266\203Q\330\204\227D2h\034V\026\004\027"
+	.ascii	"\306\326^\333\354(C{\374P\311*\207\253\246\206\3212E\356\213"
+	.ascii	" o\206N\235\036vB\f`\321D\247\301~vt\227\245\261\321\221\207"
+	.ascii	"\027\255'\003"
+	.text
+	.section	.gnu.lto_sbufWriteU16BigEndian.3.372c7274ad236d86,"e",@progbits
+	.string	"(\265/\375`v\0015\016"
+	.string	"\226\032]C"
+	.string	"\221(\035\331\225\334\212a\2068Xu\221\260\372\030\352(ec\001/0kE$\310\023&(W\277\242\306d`\313\037\004\240\334\340O\372/\375.\001B\217\310\355}+(Ef\346\345\267\204\354nR\246\024G"
+	.string	"F"
+	.string	"K"
+	.ascii	"\037\330a\200|\332\007q\025\357\250\222\013\330Eiq\331\375<\354"
+	.ascii	"\201\035\372{G<\304\276\021\017\355\331/\006T\340\240(\261\314"
+	.ascii	"\330]M7\334{z\376S\327\230N(<\257\004\273\3534\235\\\270\365"
+	.ascii	"\266\013\330>`\347F\212"
+	.string	"b_\351\315\225\326\\i\354J_G\375\361+\177&\2465\246\023\246\017 [\321\221b\327B\253\306\302\300\227\016\266\277\352\234`\271\212\344\"\f9|\330\335\354\320&\261\263\303\314l\353\367\020\336W&\030\356fp\021O\361A\361\220#\346\264Q\022 N\213\233b|\\\243\033\275\f\023\017$\225\267\267\200\260\335E\340\217\3508?\245$\036j\364\252'\206\023\r\3245\365%\326([\306n\0231\243\327\005,LX\244l\331\037)U\203\375\314\356\256\003!\036\t*\n5P\177:\016\"0\330< \235(\244\211p\333\306}4\221\007\236M\373t!\255C\300\334\bH\247\2118\256\323\262o\364\324\025\250\300\214\224d\035\341\2109i\211K\261\225\267\277\200\260K\277\312\250\352S7\240\002F\211\225\352\273\204@p\" \200\002\021\303\353b@\035>\311\260\\\005\032\327\376\230/w\217\226\315:~xG!I"
+	.string	"\202\251\245\272\205\221\265\3476;e\030\261\337rC\r\253V\313\023\003\rV \t\363\b\223b"
+	.ascii	"F\023;m\373\231G\271,\355\214\216\016/ZJ\006"
+	.text
+	.section	.gnu.lto_sbufWriteU32BigEndian.4.372c7274ad236d86,"e",@progbits
+	.string	"(\265/\375`\307\002\325\021"
+	.string	"V\340oF\360\320&\035\333\274\222\034)\201\321\033\355\261\357\3438\005\327\036\236\365O\024\301\371\2731r\372\367\257t1@\212\212\304J\344$\353M\273\2658,\211.\276]t\332\250\321\301\330)\334\314\314\254\370'vo\"eJ\001X"
+	.string	"T"
+	.string	"_"
+	.ascii	"\346\0165\316v\312\256\002\366\031\r\356\330\r!#d;4\240=\355"
+	.ascii	"\243x\n\330eP\236\332}\231\351\354\312V^m\207\226]@<\334\036"
+	.ascii	" \036\032f\317\370\340@\022Z\251\271\261\273\235\2168\354\t\363"
+	.ascii	"O\363\016\226\226\r\317\021\203\335u\262\264x\270\365\266\017"
+	.ascii	"\330V`\353H\366\265\335]\353\213\035\323\252\230N\3054*\246O"
+	.ascii	"1m\212\351RL\223b\232\273\314\017\3403\377\006\323#\230\216Z"
+	.ascii	"\032\302\264\246\245\025\246SK\237@)h@\316n\207\242\034\013\004"
+	.ascii	"wH\330\376\254\007G\344\303\315\202\236\232\333\234|\205\241"
+	.ascii	"\211\023\273\313\035\332'\0167\366\316\363m'\375\215\252\206"
+	.ascii	"R=\315\023\300\374\244\372,\034\270\374\030\377\213\207\036C"
+	.ascii	".*\335\371HBg\251\021\362\224\252\3646TJ"
+	.string	"\304l\354]\347\333vW\304\317\241p\301\217A\211\207)\275\315\023\204\013\016\231k\352j\205(%\213\374q\267\210\233^G0<*D\261,\262e\261T\021\001\025X\031\324\344\033Q\267@\"`\200\340b\221\274L\276\256\304s\271\274VW2\201\345\352Z\257\257\003)`\317\002\311\2533\361\274W\307\311R\256\255\276\3704o\340\003\224\2421\217$\220\024\006\247\244\231\275\277\340\364\263MG\b\202h\254\020\305\021\223\376\224\324\204c\357>%=\016\324\270\301\030\332\003\217!\027uqRT: \360\002\221\261\252\003rB\243M\201\021\351pm\030\276\027c]\370\035e;\356H\020Sb\354\2540`\370\274X\353\302\017\312\367 \307`\207\234S0\303\302\201?y\333\313v0\b\233\220$\340\320\273\022b\376\321\t\343hOWv\225a\230\375\306\r\313\257\002X\237:4\254,g\263\244\321\026\b\204\211\b\223c"
+	.ascii	"\214&>\355\3663\243\273,\215\215\0169\274h\017\031"
+	.text
+	.section	.gnu.lto_sbufWriteData.5.372c7274ad236d86,"e",@progbits
+	.string	"(\265/\375`\372"
+	.string	"\005\f"
+	.string	"\346\326P@0O\233\0163j\023&\341\fG\326\0174\264v\240{\302$W\276\364\203/X@\272\030hAk\272\013\260\216\334\372`\032\366\227\301\320Pb\323\033\327\374 IHi\016\376\304F\337\356-eJ\001="
+	.string	"="
+	.string	"="
+	.string	"\367B\017\260K\362\b\331\3750\306L\217\376>@\3628]\200\344\321\234\255\342\022\241\342b\003\244\305\356Vj\341\334\223\363\017rJ\307!zN\024\354\256\263\343\350\270\365\266\017\330N`\277#\323\275\177\362\217?\3064\214i\215\351\204\351S\226\022\004L\354J(\301X\2218\"\203\355S\266\265\303=p\3770\tSv)\214\204\354.\306\232\351\321"
+	.string	"\314\317#'\020<\355{\234\003\027Y\n\241z\3616"
+	.string	"\310\353\244\251\366\205\345;S\0234Td\033\302A\200\246\335\325\370\037>\332\204!$yL\265\244\360\242^\027\240\330\2101\312\222\375\211R+\330\207\273\273V\222\375\357\017\236\316\003\2656\213\0037\215\243\336d\032\200\030\\V'\333\264\312\203]\027\266\251<\016\254\253\332dZ\225)`\354\323\311\252\r\303\262\212\372\366p\225\344\370Bd\244\031\206*\242r\341\335\212\253*\324\263\320\320\220\021\030"
+	.string	"2\241\035/0.\020\302M\203\301P\3450\225=h\331\326|\007\342\310\302\232\320\031;^l\025\\#\006\314\350@\f\270\262\204q\203\252\001\367\300\260"
+	.ascii	"\025:\334\341E;\311"
+	.text
+	.section	.gnu.lto_sbufWriteString.6.372c7274ad236d86,"e",@progbits
+	.string	"(\265/\375`\021\001\225\f"
+	.string	"\246\230U? Q\233\016\247\300\224#\201\203n\324\254BK\227\016\024\307t\274@"
+	.string	"\320\217\2107\212\341\377\337\317\210\200\t\230\t\271\0353\375\022\250\020\260\310\316\301\233\017C1\177\310\301\324C\215\354nR\246\024B"
+	.string	"="
+	.string	"C"
+	.string	"\366K\334\304\346\235\310\003\354\226t.v=\213-\323\241\275\017\210\207\323\005\304Col\032\025\013\224\320H\212\033\273k\251\207o\236\033\377&\2478\022\316SZ\260\273N\216\004\303\255\267m\300\266\002\373 \002\217vw\255%vLS1=\305\264\024\245\343\273\037\336\373#\230\316(}J\324 \243r\262{!\204cA\360\205\b\333\367Q\374\013\371\t3\370\252C;\304\256\016_\331N\217B\f\004\317Q#\225\324\3770 y\316\025\207\217r\374\317\231\257\320\246\335M\340\237l\020\374\020\"\361PR"
+	.string	"3\272\324\250\377N"
+	.string	"\3065\3252\222\243\223!S\031\251\215I\310s\327\003\237\f\240\n\312\261=Oj\007; \232L\266iq\323\034\250/\036\017&4\270>0\331\246Y\032\354\272\260\213\245\311|\\\326%\323,\217\002\306\"`2k\303\260\314\252\274\316M>\251\330"
+	.string	"\352\250\307\224\266\320(\037\316\325\210:)\245\267\361\031\341\311\020\213I+\035\211\216\f\027"
+	.ascii	"2\003\302\360\330\302Vl$3\\\304)\031\242b\0170\246\025\276}="
+	.ascii	"M5&{Z90\310\3422\021h\0249\"Y\341jP\b.\003#\002T\224p\207\027"
+	.ascii	"\355$\003"
+	.text
+	.section	.gnu.lto_sbufReadU8.7.372c7274ad236d86,"e",@progbits
+	.string	"(\265/\375`w"
+	.string	"\325\t"
+	.string	"\246\022D<0\345(\035\200\013\371u\372~\331\034\\\341\304\262p\223+\0359>}7\250\314\344\276\373[\303m}\304\267\230 A\314J\\\n\n\262@\025\255\314\0211+=\367\362\311\337\335\344N)2"
+	.string	"1"
+	.string	"4"
+	.string	"'\230\227\266\275\300\2002\370\020\326\232\036\031\027+\004v\303MA\016>\202\376O\236)\331\030\300r\245\0365\016\273\353\310ri\334z\333\b\266\023\354w\002\227\375\031\215\216\032}\315\354\200)\b\260\333\232\025\330\027\3512b\033eol\307h?v\023\324e\247\017\354\276b-\273\241\307\036\355\322\341;\363R\0131\030\034QU8\260\263\004(\374\0325\002\260 Y\271\364\024\223\266\273\r>\312\004\205&r\351\237\346\345\225\023\"S\305\231\035\246\242~\330\317\354\356Z_\236\001\3347Rs\037\210\322C\007\n}\244\321&\362\272\316\3436Q\004\250\333\270o\264}\f\354I\204\276\215\344y\337\266\t\367\236z\240\322\225}\226\nP\363M\363r\352\003\017"
+	.ascii	"2\003\302\260\027s\212\251NE-\202\305\242\212\r*wX\355\244tA"
+	.ascii	"\226Y\267\013*E\265\207\352`\306\324N2"
+	.text
+	.section	.gnu.lto_sbufReadU16.8.372c7274ad236d86,"e",@progbits
+	.string	"(\265/\375`\232\001=\017"
+	.string	"\306\035fE\020\257&\035\320iY\327\001\202\304\226\210\fy\342B\317\232\016\376\024W\357\344\016\364\234\026\362\300\335w\333\202u\275s,\004\b\002\037\332:"
+	.string	""
+	.string	""
+	.string	"\210\200\216\305\022&\035\005\314>e\265\031-\"\204l\"eJ\001P"
+	.string	"O"
+	.string	"T"
+	.string	"\321\037Z\246\375\324G\204\036\226\034\300.J\nf7\354p\207\366\350P\263\355\203x\210\220E\031\246P\300V(\023\313\314n\310q\234"
+	.ascii	"\366\230\027\200=\252\206\213\236\"\377\253_+\250\031\247\023"
+	.ascii	"\223g\266`w\235\247\223\n\267\3366\002\333 v\202\004\336\262"
+	.ascii	"\364\006Kk\\ukW:{\370c1}\305\264\306t^\351s`)\027\005Z\354Nh"
+	.ascii	"\321lL\\\261\341\252\337~\013\211\227\231\263\234eo&y\t+\207"
+	.ascii	"\227\225\335\335H\354\3551\355\220\277\362\346\253D\332\302h"
+	.ascii	"\246\025\206\030\273a\202\007\356\256\342\3037\325\320\267<\300"
+	.ascii	"S4x\340\253\370 \366\330\321\313H\270\300Q\027p@\312O2>\276)"
+	.ascii	"G\023F\251\003)[>\313\335Q\200\332\356*\360O|\236\257R\202=n"
+	.ascii	"z\326\017\230\230\360\220\032e\313\016I\251\031\354_\253(v\226"
+	.ascii	"\356`i\016\226\001\240\317\247\236\017T{<D\"0\350B>\037\b\344"
+	.ascii	"F\274\256\363<\334\210\203\220\216\363| \347a\300\036\204\317"
+	.ascii	"\307\201<\357\343\266pt[\323\215\222\210\230\221\222|\251\246"
+	.ascii	"\232z\351M\026:\252\372LS\357b\252\321n\026\3305S\225)\321l\364"
+	.ascii	"\372\325\023\365\302T3\022\331\004  p\242\241\265\033b\300\031"
+	.ascii	"\226EB]$\227\207w'\266\022_\207\360\017;\024d\001\324\200\232"
+	.ascii	"\037l\030&\0318ka`\355\335fG\206v\362\013\331\305\254\310\rH"
+	.ascii	"vn\005\312\240'\003j\027\347b>\236k\327\250\244\230.C\006"
+	.text
+	.section	.gnu.lto_sbufReadU32.9.372c7274ad236d86,"e",@progbits
+	.string	"(\265/\375`\312\002u\022"
+	.string	"\326\"wF\360\360$\035z\225\022\353\2120\177\371w\261\215c\t\204Fh^\2171o\3607\032=s\332\3753\317\030\347a\300\306\021\220\177\202x\357C\2628,Z\226\234\307l7.z\332\267\321>\315\215\023\324H\333{K\231Rb"
+	.string	"\\"
+	.string	"g"
+	.ascii	"\207Y\363\177^Y\f\205L\b\266\001\307\234\237\201G\237d\252\366"
+	.ascii	"}N\002\346\337\313\2679u|T\314\371\225\270${\364\227\331\366"
+	.ascii	"E|\004\214_\360\333\271\2210\r5@Ks~\334\200\257\344#\274J>n\206"
+	.ascii	"\277\256/\377\260\303\236\013B671WS\2029\247\325\346\246\302"
+	.ascii	"\275\267]\300\366\001{S\002\352\021\250^I\265*\252E\242z\223"
+	.ascii	"\352TT\207H5*\252A\244\372#\2525\217S\366\237\333\364\357\227"
+	.ascii	"P\r\241z\241Z\241\372$2i\006\311\321\234\023b:&Rd\301\341"
+	.string	"?\277\375\242\027D?\302\031*a\264t\240\007\331\232]n\302\333\301\250g\316\251=\332.\266\366\bm\030\00797ht\244v\265V\005)w7\322\253\344\266!\373\241C\0308J\2525\355a\207\036rj\324\354x\213\005-\237\307w\311G\325\236\206\204\034\221]\341\002\260s\233\244\223o+\262j\203\346\303\214\306\374 wO\341\312\346\234\b|\024^\004\237\347E>n\373\240\023\210\021\002\341#\2431\373\233\321\305`\037\316\325\261a-*\336\262<\2265\313\304\201\253A\013E\305ka\341V\272V\253cq+\017PZ\034\313c\341L\004\270\203\240\342q-]\347q\332's\333cQ49\220dv\306\247\205\353\021`da\354cGR>\334]\306C|[m_\224\355\356)\365]%\324\236\001\312\335c,\310\236\310\264\272\331\376D\215\205\354v!W\253K\0018 \020#\0313\0352`\031\266\301"
+	.string	"\224\030F\276\207\301\3072eQ\r\b<8\243R\306:Y\030\006\037\313(\233\006\024\\\013\242\223\241<\370\371\323V[\253\333\004\266lj@\204"
+	.ascii	"\265\006\376\363;\214\254\366(d\267\f\355\312\357w/f\210\034"
+	.ascii	"\336\03046M\b\030\264\314\026\3377\223\271\257\224\001=\027\316"
+	.ascii	"\353\372^~\023F#\305t\0352"
+	.text
+	.section	.gnu.lto_sbufReadData.10.372c7274ad236d86,"e",@progbits
+	.string	"(\265/\375`\245"
+	.string	"\265\n"
+	.string	"\006UJ?0\2478\035\025\3314\213\367\236?\371\200\256\270\007\335\370\276\377\305\362\024\233\r(LE\204\347\225\366M\277\203u\311#\013\355\341Hh(\004\203\3143N\310\017\312j(sEC\020\243M\344N)5"
+	.string	":"
+	.string	"6"
+	.string	";b\214\311>=\236\001\373\314\276\200}Z\264\033|<\331\237J\241\324\203\335\325\324\344\342\245\350?\365\212h\364\271L\250\330]K\321(\344\326\333\216\260=a\237\"\322\362\222~\206\261\0208$\330\005i\261v5\r\244\330\376\305\266\n\370I<\312\007\\\331%Q\240\332]\2145\331'\304%G3( qi\037\300\003\2107y\256\260K*\2516\027\3712\362\241\037\333\035'\320\311vW\343\017\b\301\f\305\203}JmX`R\275ZD\034\204\"\200d\313\036?RK\354_\273\273V\222\375\361\307n\372\347Q\277\316\234\315\206n\341\206qq\037\250\3462\031\235\213n\333|!\250q\274\256\3638\215\243\261u\032\367\201Z\346\301\036\307\346\323B\317\373\264\313\270\277VI\266\200\260\002\251\207-\362*\025S\273\363d\021"
+	.string	"2Cs\025\370x\024\204\rA3q\300\fk]\003\006\314\350@\f\270\262\204q\203\252\001\367\300\260"
+	.ascii	"\025\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_sbufBytesRemaining.11.372c7274ad236d86,"e",@progbits
+	.string	"(\265/\375`y"
+	.string	"m\t"
+	.string	"\206RA8@\217\322\001\233\216>\330gx\2673\327\b\"\307\260\310\261\037\200\0343\264\232^\373\221;\256=(\310Bi\255\270\f\303\243\302\027\214\224\013a\254\t\bJ,\331D\312\224\0021"
+	.string	"/"
+	.string	"0"
+	.string	")Y\210\341z\205\tk$fw9\316\007\264\307\354\002\332\243^\034|\202\376A\236\251P\270\264\\\251\247faw\235-\227\304\255\267\215`;\301>A\316L_\243\231h)X\331\215\210\311,KD\331\260\r\332\033\333O\373\260\177\200\017Q\017\330}\225\234\354\206\035w\266G\207\233m\277\343\036\240\035\020\034+\207\223\244\032d\270t\221\207mw\025\374\020\323i\323x\364Q\332\343\025\340\005\246\312\230\035\246R-\354g\253/;Kk\017\377\250i\315\f\243\023H\035\362\214N\240\356#\372L%\216\344u\235\027\342H\f\237\216\013}%\316s`\257A\364q&\317\373\270M\270\2675\345\250teUM\317\232I\275\252&L\016"
+	.ascii	"2\003\3020\006\013\220\205\230\340rD\245L\351\254?\023\230k8"
+	.ascii	"S\026\245\004\023\004\234xR\255\230\204I\006"
+	.text
+	.section	.gnu.lto_sbufPtr.12.372c7274ad236d86,"e",@progbits
+	.string	"(\265/\375`%"
+	.string	"\345\007"
+	.string	"2\21766P\215\322\001$\243\252\022*+ga\365;\212\207(\210B\"\201\333\251p\266\217\346:\256-S\3674\265\303^U5\307\254\352\376jw\003\376\3260b\311&r\247\024\034\220F\215a8 M\226\331h\037O\354\310,\223X\3540d\262\210i\236\2101\260l\330h\361#\245\026-s_\255r\252\007$\215\260\355p\220\355\332]\005\377\003\342\341\3028\364C\n\320\221^\212=GO+\354W\253\234\365\335\377\252\212\206I\201\310\356D\n\312\226@\222\f\333\"\333b\373\275w\241\007\354r\033#\273\363\342\313uh\333\347x\207\310\033\301\2748Y\250\224D\310\311\356\214\236\037\260\016\257\013X\207j\361\355o\363\357\361\252\243H\225L\243\277\312\302\356\372\225L\247[o\033\301v\202mT\013"
+	.ascii	"2C\027\r\f\304b\224,`\303\204\356\032\0161\201M\032\343\016A"
+	.ascii	"\n?3\232\332\371\004"
+	.text
+	.section	.gnu.lto_sbufConstPtr.13.372c7274ad236d86,"e",@progbits
+	.string	"(\265/\375`%"
+	.string	"\355\007"
+	.string	"2\31766P\215\322\001\244D\214*? #\211\320\357\310`\b\246\251\214\230+uD\377Gs\035\217\rK\3674\265\303^U5\307\254\352\376jw\003\376V\307h\355&r\247\024\236\215\243\3064\236\215\223m:Z\b\024?2\313$\026?\r\233,b\032(j\016,\035:Z\fI\251E\314\334[\253*U\204\222\232lo\377x\270v%\026|\217\b\210+\343\320\027)@Wz+{\222\236Z\330\267VU\326w\377\263.\335\211\001\312.\305jeM\340\210\206\355\221\215\261\375\336;\321\005vU$\"\2733\343\314uh\333\3378\307\310\\\301\304H\005\230J&BTvg\364<\201\345\360\372\200\345P/\316\375q\376;nu\025)'\024\351\357\302\260\273~'T\352\326\333N\260\255`\033$\013"
+	.ascii	"2C\027\r\f\304b\224,`\303\204\356\032\0161\201M\032\343\016A"
+	.ascii	"\n?3\232\332\371\004"
+	.text
+	.section	.gnu.lto_sbufAdvance.14.372c7274ad236d86,"e",@progbits
+	.string	"(\265/\375`\234"
+	.string	"u\n"
+	.string	"\206\224H=0\305*\035\236\013\371^\357\362\035@\213\243+\022\217\366\263\270:^]\36454\340\31282P\303\322^k"
+	.string	"\"E\027\250\"\r\205\314\324\"\217\260\345H9\202\203\255L,\331D\356\224\0024"
+	.string	"7"
+	.string	"5"
+	.string	"\031g\270O\217?\330>\271\033l\237\026m"
+	.string	"\037Y\373W\n\nV`w;\305\270x)\372\177\335\222R\225.+\016\273k\231RU\334z\333\t\266\027\3547\004\252IK\225>W1A\301\004\330\245\230\031X\331$\321\260\375\213m9\036D\274\313%\266\354Z\214\304v7c\005\356\023A\273\264\357\361\017\361-\322\013vW\035\261\3351\023\033'9\363\246R?"
+	.string	"u\300\341C\"\270\335e\360a\242\021\227\361\351\223\266\317\253\226\bp\264Lrf\217%\251\027\366\265\335]\353\312\276\353\337\336\372\247J\007\036\tP\250}F\034uG\363\031q\274\215\007\024\205]\350\363\274\257\323\205@\033\257\353\200a\247\301\370\203\360\200\235\350\373\300\3562\356\265\325\225\037Nd&=YU\204\200\365\224"
+	.string	"\251W\325\007\020"
+	.ascii	"2\241C\034\030\027\b\302\345\312\340\2559\026\301\030\246\275"
+	.ascii	"z\315j\352\302p\f\243\0031\300\025ij\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_sbufSwitchToReader.15.372c7274ad236d86,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"\255\t"
+	.string	"\346\221@80\257\322\001\250F\263\326\200\373+\021\002]6\353QK2\331\206d\214v\220s\026a\f\247\332bJ\310\221\252\"\r\205L\024H\235\3757\345'\226\032'~\354&wJ\001-"
+	.string	"/"
+	.string	"1"
+	.string	"\230\307\355\003\230G\177\366\311gk\377b\231\bQ\331]\251\030\377\016?\377\037\007P\255P\207\231\205\3355T\255*n\275\355\003\333\t\366e\217w\375\n\241\237\311\314d\006\260]\212\332lc\321D\303\3665\266\3414\301\020\016\355w\334\343\273\353t\201]\026I\311\356\334x\263=z\236 *\243\255X\\\355\322E\002ZOQ\241\370\341 \246mw\025\374\027D\304\226q\302<^\343\006\215\303\225\2025{\242\240^\330\277\354\356ZY\366\347\003\240Q\307s\t\225<\352\017'T\362p\035\220G\032IQ\307q\335G\212\032:\234\374x#\311)p\347"
+	.string	"\362$\251\353<\251\231\373\313*\313\f-\261\224J8\352H\023"
+	.ascii	"2\241[\034\030\017DBp\217\222~\0023DE<\224#\230\312&-\256:\204"
+	.ascii	" \256\261\2550\036\250\006\256\200\271\001*\n\270\313\213v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.372c7274ad236d86,"e",@progbits
+	.string	"(\265/\375`\345"
+	.string	"\315\004"
+	.string	"rF\030$\220)\351\377\267\272\346\333\217\352\335\373\301\261S\375\377\177-\357?\360\017\374\003\375\326\332\377\350\177DZ\333{\313\205\320.\013'\013)\017VS\326\3662\263\2556\222'\213,A\216\036\027\034\023\032\017\030C\213\005\212\003\211\001\210\327\341\307\260C\215\323'mWIL{\233\261\230\223\231\031\335kk\232\027"
+	.ascii	"B\021r\223\207\036\345\201H3\314\247\376!\025\f\227=@;\3609\360"
+	.ascii	"9\3609\3609\3609\3609\3609\3609\3609\3609\3609\3609\3609\360"
+	.ascii	"\316\265&\036"
+	.text
+	.section	.gnu.lto_.refs.372c7274ad236d86,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.372c7274ad236d86,"e",@progbits
+	.string	"(\265/\375`\206\021UR"
+	.ascii	"\232\207\020\036R@R\322\031\016\373\276\372\366\275~\352w\377"
+	.ascii	"\332\255\376\177\177\023\200\376\036g~\276\203\242\356\277\233"
+	.ascii	";\273\372\027QA\031W7\244P\325\n\002\017\370\006\035\235\362"
+	.ascii	"\240Jff\367\214\023\263jT\376\f*\273\245\372\266\2527\247\256"
+	.ascii	"Z\023\"9"
+	.string	"v;v\2232\005\215\001\304\001\344\001{\366\231\242\265\2333[\344~h\361YbC\240\347\013\351\367\004\372\333\023\350VY+\273\232\330\261o\016Kv\231\342\332+K\215\331b\362\211\263!P\026\246_\023h//oM\240X+\212v\304\354L,\254\246F\2225\245\225\277\364\320\003\354\313fj\t\226\221O/\021\213\244Ve\f\237G!\305a\271v\335\256\315\372\336\260Z\027\261vwu\367\367jk\2317\304\234n(\253e\367\372\024?O\327\332\260\314\336\252\244\033\n\310\315\224/#%]\367*b\201\005N#\263\315\f=\017A\272\275!P\034\025\351y\322\177\233L\231&\22694>\377e\376k\265W\213\325;\"\325\326\352^sx\355\fi\344s\241l\224]I\354\224\367\250x\217\210\325W\335\353\317\006\317\t\236\035\237W \375J\271N\261U\234\323/\tt\363\226\004\372uC\240\351\002\200\366"
+	.ascii	"u\230\204\0046\370\222\371y\002.\022\236\376\374\300yt\030\201"
+	.ascii	"\021;\002\t\364\347\020\333B\204\021\376\373\331\346\337\020"
+	.ascii	"8\030!\310=\2730#\352\344L\300%\360\177\004\031\315\277Z"
+	.string	"\376o\371\376-\373w\203\1771\370\267\347_\024\377\236\370\267\304\277#\376\025\361\257\316\2777\377\202\370\027\375w\377\333\375\257\373\037\346\277\227\377o\377\301\376{\375\227\361\177\355\177\360\377\224\377\036\374?\373O\366_\354\177\330\177\254\377_\377\231\377K\374/\373\237\223\227\227\227\367\367Z\374[\367\333\240\b\373ech:\342\206\206\242\345\270\023\263\005\016n\275\244\335\335\353\006r\265\2441b5\005\344\207\257\027\031\252:\2574>7n\206\206\266,&\035N)K\226\242\256\244_-\273\345\333\303{\330\267\355d\367R\367\334\222\340\230\243\353\245\245\0233=\320\310\330\334\276o\367\241\246{\204O\nmH\022\237\313\266]\316\030\226\334\251]\270\320,\231\344\306x\371\224\214b\310\370\334\266\315\372\221\204D\n\237\377\26232O`\334\300\370\374R\245\347\037\355b\262\273\223d\326N\032k\2762k\263\275=\340\377\331\275"
+	.ascii	"\252\272y\314\315\245K\300\212>\370\354\327\320M\314\351\265"
+	.ascii	"\223\307\246\023\361h\203\2322gm!\002t\023\252\217\253\223\362"
+	.ascii	"T\233{\355\355\"'e\n\307UM\036W\225\210\323E*\261{U\342\034\265"
+	.ascii	"\212\304=6\235\224\307\246\252\314\351\242&v\263($-R\225G3U\211"
+	.ascii	"sl\026\225\307\"'e\316\216\271!T6\2108\031Y\345\261\250\221\216"
+	.ascii	"\232\212I\234\264\343\2526[\367j\031u\362\200\356&5\311V\354"
+	.ascii	"\261a\3064$cWQ\335\265\273\00782>\251]\224v\254R\273\253\214"
+	.ascii	"1\372\310\001\342\232\326F6\215\b\325\324H\243n\002\216\272\211"
+	.ascii	"\333i\335M\354n_\262i\355f\3029.\217\216\272\227D\034u\023Q\314"
+	.ascii	"\250\233\265\270\204)\217\315'\225G,\253\271\354\032+q\227\315"
+	.ascii	"\346\224L\233\304)\215\224K\227J\035^\262\254\375\254vD!Y\177"
+	.ascii	"3bvLx\360\271i\313\303Wmw\350Us@\355.\256\332\357\256\273\370"
+	.ascii	"\3335`\327\200\363\311S\022.\364\374\026\245{e\261\354zb\313"
+	.ascii	"\276f\001(~\210\021r\267\202(\2426\305\204O\336\217\241\034\345"
+	.ascii	"o|D\205\311\017>\031\312\341\272\246\024i\342+\264\2475#\237"
+	.ascii	"\354\204\237\354\3722\266:\232\\Z[\353\206J\215\2552\255\364"
+	.ascii	"0\354\313P\246\341\334\204\n\220!N+\023\256->\226V\351{UI\222"
+	.ascii	"\360\fb\226Y\212 \245\224\234g\350\345\351\220\033\303'/m\332"
+	.ascii	"T'[\313\354a]}\221\"\344\310\021\236r\213\3731\023\023\307H\316"
+	.ascii	"S|\027\267\226\361\311R\333eoH\232r\353\361pr\342\":\\F\263\035"
+	.ascii	"\243\362\2616\344\\\204\211\230)\325@2\021\216\352\335\2002\007"
+	.ascii	"V\223#\207\224\312P\276(\267*W\030\212\237@<\241!\215i\375\301"
+	.ascii	"\255\351\260:\002\001\302\252\016XM\220-\036\300\202\234\325"
+	.ascii	"e\372\260\346\330\210\275fb\342\246\231'\256\223\316J\216#>\316"
+	.ascii	"M\037\243Q\205\324\240{\333\261"
+	.string	"\203\227v)\002\246U\034\267}\335\210\352q^B\237\310p&\003\237\254\264A\356\250\222\370d\036\177;m\020o\340HK&9)\305i\343\232\221\245\f\222\033\222\300(\317IhRZtbV\220HF\342n\246\f\351\222\022\036\360\216\316H:\330,\241\324\276\264\216G\276\301\255v/}YO\310\270\031\245\021\257\036l\343|c\261t\264\035\021\361@\013\227\035\240\260\221\215l\224v^\217\f\251F\025\303\331\350\246\006\225\r-|r\321v\251\301An\r\314f\3715\261\303\261ej\314\030&\246\304\272e\315\333\025*Y\270\317\304\345\n\022&\305\347\346m\027\2576\257'|.\336\341h\276\340\251t\037\343!fu\026\304\316n\303\260-o\2604\221\373\342\363l\243\256\016\313\222\312(%'77\267a\270\226\310\023\033H0\33703xtjb\370\f@!\021\2153\b\224!\034\302\b\006\001_\020\311"
+	.string	"\n\006\355\b\207\210v\002\220!\203(\030\024\n\372\206.\200.\004\r\241+\b\tc\f\205\202\276\023~\2002\316\026h"
+	.string	"\315"
+	.string	"\316@\205@!\017b"
+	.string	"\r\203V\350"
+	.string	"\b\024\374Q\341\305\0044\302a\213\341PP\250\002\341\260\205\017F0\b\310\301\020p\330\002\005:5=)|xhV|\360\342\007\310\001\b\030\301 \341\260\203\337\317\360\307\002\233\236\024\301\237\240\027\301\013`\004Q\340\303\023\242'\205\017O\315\201V|"
+	.ascii	"\034\006\tA\2409P\220\020\030\004\302H\357\200\017\n\237\025"
+	.ascii	",\370\276\202E\003,\032@\277\202\005\017\017\013\037\236\364"
+	.ascii	"><=\341O\f\240s\350\242'\205\017O:|\214\002.D\003(\334\031\n"
+	.ascii	"\t\twh^\004\201\275!\027'\020\2310\204\n\2074zC\027+\206\301"
+	.ascii	" \"\337\037x\240\202\022\037h\220A\n\304\300\tD&\314\370\001"
+	.ascii	"\n\207C;A\241\0313\204\200v\202A?3v\200\204C;\f\2208\227m^\336"
+	.ascii	"]\331\357\330T\273\213|\306f\347\262\377J@>!Q,bhX\016)Y:\234"
+	.ascii	"\257\374\274(\t\361\301'\347\300d\275&K\256\266\365o>,q\243\022"
+	.ascii	"\205O\266\302cE\226[U\016\367\270$]\025\035\027\256\302Y>$+\273"
+	.ascii	"(>\265\316]Z,\326\363\"A#}oIl\274\230\234\250^g\261sX\217\n\276"
+	.ascii	"B\032s\002\303'\203\335,\235Q\211\373b\346\222!\315&|\036E\212"
+	.ascii	"\245\244T2\016\347&Q\306\214\326\370d\2563\223(\2444\265\255"
+	.ascii	"\037\220(\035\371\222\276\347C\312U\347\032\376]\271\212\263"
+	.ascii	"zk5M\304\352\034\020\224\241\241\321\365q\351\304\r\0168\247"
+	.ascii	"!R\316Yg\033zT\374-\030\225\225\305'7\317L#rYG,f*q\353\302\003"
+	.ascii	"KyJ\201\205\250\2418f\234$#\"\"\"\222\202$I\007\261\005\204\030"
+	.ascii	"&\031\226\007\021P)\203lfD\222$)M\007\206\230\310\264\373_\261"
+	.ascii	"\276\221\350\262\024\031\275\346<i\330\002~y\002\247Sd"
+	.string	"\276\360(\322\300\264\227\230=6\301\233\235\002o\212\323s^\f1\301\024&\373\363\244\346V\305\304\252ZQ\033\244c\357\265Dn_2\212\240\020hE7\r\243\237\210F\274\nN\\u\227\353c\241.f\024\256\0205\321\007j(\272\257qJ\274\2257.ggT\251\261-\247\255\225\004\330\352\307c\273m\261\005\034\220\256\355\242\371\256\376\3229\314.\347wn-\002dBaKRv\243\242g\356\227\344\366\213g\275\254\324\362_\020l@1AFn\364\326\007\231\365\213\331[]\207\022\350\326\344v\262\275\2054qg\347 \022]\272\343a!\003.T\034\220j\312\260\275\373\336\251\217\364"
+	.ascii	"\255Cj\322U\b`\rR\221}3\026\256\347K\264!\035\340=\260`\241e"
+	.ascii	"\016\314\306x\374\037(n\347\214\374\016a6_,\316\316\363J\270"
+	.ascii	"\334=?|\244bVJ\271\341\205\367Vo\373E}/(\210\272\224Ks\354\360"
+	.ascii	"\334\226\260(\217qxDf\006\300,\263G[:\301>;\241\374\263j\232"
+	.ascii	"\006Q.d\227\205s\301\373\365e\335\232\241\235\033\350zFp\317"
+	.ascii	"\335\0059\365L\004\266_\237\320\272\247=\370\214<\037h\205\224"
+	.ascii	"<t\206}\240\n\034\rF\272\222\203\273\205d{\t\322\314\326\025"
+	.ascii	"\350d:\225\006\315X H!\r\352\277\001\312\266\r, \211\226\221"
+	.ascii	"\350\\\343`\322\022\367\327\275\376\030\320\360\205\324\220/"
+	.ascii	"q\352\357\353\371\3623\231\345I\275\244\226\202o\006=J \325\245"
+	.ascii	"\3567\003%\346K)\001~\033h\337:!\205\347\334Y\265@Z\252x\375"
+	.ascii	"\314d\235L\022\241\204\336\374X\256QCsp\356\320\030\302\327`"
+	.ascii	"1\326C{v\355\223\327R\271[-\300\364\311=\270C)B\302b\002\200"
+	.ascii	"\n#\217\307\341\355?\002\361\217\260\377\224\3257\315e\020\322"
+	.ascii	"\337\261nt\030\346\271\336\203\334\370\227\375\227^Sp\301~!\314"
+	.ascii	"%\233\246\276}^C\346\313\356\274\207\263\021\373dqt?a\351t\343"
+	.ascii	"4\354\027\274\257\342\026\210h\354\204\311\r\177\320\305\335"
+	.ascii	"\005r\354wu[&n\250\277%\347\365?\315<\257\341\201\0347X=\231"
+	.ascii	"\261\262\036P\027\375)\330:\030\331\373\247\215\005W\342ny\005"
+	.ascii	"S\030po\306\323=6\232|\306\205|\302N\251\337\275\221\312E}\b"
+	.ascii	"\313\271vPR\236B\230o\337\303\223j\327\234\305\027l\020\232p"
+	.ascii	"\261\n"
+	.text
+	.section	.gnu.lto_.symtab.372c7274ad236d86,"e",@progbits
+	.string	"sbufWriteU8"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355"
+	.string	""
+	.string	""
+	.string	"sbufWriteU16"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362"
+	.string	""
+	.string	""
+	.string	"sbufWriteU32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"sbufWriteU16BigEndian"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371"
+	.string	""
+	.string	""
+	.string	"sbufWriteU32BigEndian"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373"
+	.string	""
+	.string	""
+	.string	"sbufWriteData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"sbufWriteString"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\001"
+	.string	""
+	.string	"sbufReadU8"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\001"
+	.string	""
+	.string	"sbufReadU16"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\001"
+	.string	""
+	.string	"sbufReadU32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\001"
+	.string	""
+	.string	"sbufReadData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"sbufConstPtr"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\001"
+	.string	""
+	.string	"sbufAdvance"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\001"
+	.string	""
+	.string	"sbufSwitchToReader"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.372c7274ad236d86,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1068 @@
+	.file	"config_eeprom.c"
+	.section	.gnu.lto_.profile.aec462b891bff969,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.aec462b891bff969,"e",@progbits
+	.string	"(\265/\375`\351"
+	.string	"\035\n"
+	.string	"\244\r\335\001"
+	.string	"\031"
+	.string	"\254\240\305\267\b\004\002"
+	.string	"\002\001\354\306\315\226\001\006\002"
+	.string	"\002\002\003\002\001\003\264\375\200\254\004\341\346\262\350\n\006\002\004\002\004\005\240\342\234\212\n\006\007\327\241\377\216\001\n\002\003\002\005\004\002\004\b\227\334\213\271\006\002\006\t\276\321\213\327\003\032\007\002\007\003"
+	.string	"\002"
+	.string	"\n\013\f\356\267\377\344\013\001\b\002\002\r\201\366\203\271\001"
+	.string	"\020\242\261\306\371\001\022\002"
+	.string	"\002\t\003"
+	.string	"\t"
+	.string	"\002"
+	.string	"\021\315\362\222\"\022\253\217\303\262\005$\003\002\n\t\b\002\002\013\f\002\f\002\n\002\n\002\013\023\352\263\360\321\b\024\255\260\323\211\016\001\001\025\233\364\343\336\006"
+	.string	"\026\326\274\277\354\r\006\027\232\353\322\344\r\022\f\002\f\030\311\306\266\303\013"
+	.string	"\031\373\227\367\203\n"
+	.string	"\032\273\250\365\215\003"
+	.string	"\033\240\342\234\212\n"
+	.ascii	"0 `\002c%\352\001v\342\\\003f@\315\200@\003J\200\236\001O\016"
+	.ascii	"\270\326:\001\331\255\272\244\013\254\2544\340]j7\214\341\333"
+	.ascii	"9\304\340v8\353\260ZJ\245r\245\225+\331\321\267\255UK\005m\253"
+	.ascii	"\330\256K\241)\300\235\300\234\335\313\301\335\246\013h\002R"
+	.ascii	"\225\371\232\302;\037\333\326\005^\036\310\345\206\206H\205\033"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.aec462b891bff969,"e",@progbits
+	.string	"(\265/\375`\226"
+	.string	"\r\005"
+	.string	"\362\006\022\027\240)\303\001\303\377\377\377\377\341\277\375\215a\255}\376&\204l)S\n\272P1\023\"\346a\r{aw\027\217\367\201\020t*js\216\006ZR\002\355"
+	.ascii	"\340\250\234\311\253a\354V\023\217\332\020\235\245R\264Q\247"
+	.ascii	"\271x#& 0\002\204\224\353\001]\201\270\300\373\264g\305\336\327"
+	.ascii	"\265G\222A\267on,\356\342\023\026Y\030L\263\266\021\2267T\300"
+	.ascii	"\302\262y\213\226\3051\267\225d\346\365\255\326\fY\301\013\302"
+	.ascii	"xOm\022\235\223\332N\260\320f#\240\245m\203\023|\030\tY\004\260"
+	.ascii	"\333\n\340\006"
+	.text
+	.section	.gnu.lto_.inline.aec462b891bff969,"e",@progbits
+	.string	"(\265/\375`s\005\235\030"
+	.string	"\346\342zI\300\322Q\032\003\244\326)\207!@\316\201j\020_\260\316\203E\244\340\221\347\377]o\245\026*-\322\216\274\357\213V\252'\b\202\332)wC?\221i\022r\204\202*\024\324N\366AD\206\024\312!\177\367\017\372I\311\337[\312\024W"
+	.string	"j"
+	.string	"k"
+	.ascii	"\323\344\261i+s\003\224!"
+	.string	"\276\261w\302.\351\f\025\351\256m\3620|\345\265\030c\300\2670\347\214\371\221?\300\352\256\022\217\305\342\257\327\252\312\234\321\013%\327\353\272\266\313\345K[\333\3169'\370-1\305,\242\212\255~]\375\343\260\325w\275m\216\311S\344\365\262A\\H?A.\310%\312\322\266\"\230|T\3412\\\326v'\325\004\302\266Ds\316\325\033\262VZ\003e[\341\270\336\342\n\233\235T\311\341\317t:\323\215\333\241\034\237\323\212\313\366(\342\003\305`\326-\336-^P\317\020\024SC\317O\266\f\177\317t\361\025V\213UUUS\340\277,\220\032\277&\223}\205\211@>\202pd\307\225\361/Y]\351\372\262D\346\234\n\302\230\f\370.\373\224\224$ddM\250`:A\362k\377\227\324\330\022\"\221\016#\036=\234%FM\215\300\211o\b\203\212\203\315BIA\365\"K|\362p\203\343\247\247\223K\t\207\020\007"
+	.string	"\303E\243\022N<\016\354z\246\323WW\204\331\0202|G\017~9$\037\004\267f:\371\260\225\\\3226\217\213-h\354\364\030\330\243\204fb\0248e\006\034\267=\235!\241\326\004\"\312\032c)\310r\331\0317~\344Dx\211SE<\336G*\003\036\321\226u\001T\363\001v[_\022\315\316\353\223\337\266\002HV*\206\330\233Q\242I\260\201\304\217j\301&3\335\252J\262Z\303\224\263\321\200\302.\355Xtx\347@\366\372L\027\345mw\3149O\002\200\215\250\221%SH\304D$%\005I\322\001`\002\031\"2\363\021\020\255SP\321\220$\226\016\360\336\305\351X{\030rc\347\024\273\2237\312(o\3536\313S"
+	.ascii	"\030\370\376\221\">\360\206\362\204\353\363\f\211\216\217\333"
+	.ascii	"\343\313%w\225\227\345}y\006\311\251\fDP\241Ny\305\317\215\306"
+	.ascii	"\272\037\276\221\024\017\227\342D\352S;\352\344\001\300\333="
+	.ascii	"\204J\023\235\334\333r4\330\366\307\375I\361\354\3203\250\320"
+	.ascii	"\205\207\270*3\242~`\202\326/\221s\214\2630\034\204\2053U\016"
+	.ascii	"\024\352\2370\354VX\022\021&\272\026\220\301\242\"Ey\302\035"
+	.ascii	"\2143\350\035\253\241\"M\261\320mJ\335\236C\222\206\266\356\275"
+	.ascii	"S\366\344M\357\2707\340_\372t\323I\240=\275\207\r)\006\020\306"
+	.ascii	"\306F\032\022.t\340\\8\bdtQ\205\004\354\037,@v\201\306\321\360"
+	.ascii	"L\240\020\347\037\370\331\310:nP\017\212\t\357\332i)\246c\374"
+	.ascii	"\006\201\335s\030~\002d\026>\367\302\342\033\022LE\036*\357d"
+	.ascii	"\201\265\211\233\017\376\320N\200\r\257\310\"\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.aec462b891bff969,"e",@progbits
+	.string	"(\265/\375`\370\007\215\023"
+	.string	"\246\227C4`i\222t\020\220UE\0306\345\030E\365m\330~A\360)\212B`\273>K0\b$\\\210\005\340D\277\351\306\376\277\r\007\021\221u\2531\rmK\210L2/"
+	.string	"4"
+	.string	":"
+	.string	"gTw\360\r&\272\233l`\242\344\356\356-qZ\2625\3525\252\323\232,<Y&\353\241\267\007\370\242\207Z\313\313\002?\3525\364\204 s!mSkj\223\232D\223\305\307\345\240@"
+	.ascii	"y\204I\004\325\344\034\247\205\352\316\335\026}\204\264\226\004"
+	.ascii	"p\345\037<\204[\314D\021\272cG\265\236\252\237\352s\334\006\034"
+	.ascii	"u\261\250\237\246.S\330q.\352\271Q\020_F\326\247i\255\004\232"
+	.ascii	"nu\230\264\276"
+	.string	"(\210\2012\242'J\270\352\214\2722\223\245\215J\316\343>\316\343\247\320\025E\226*\242F\021$I\022\002\371@\265d\005\005\331\320\252cI\205\273\304\271\t' \206*I\241\214q#\223\tr\300\207q\3772,\330f*A\013\205\026\212mW\230\2463`\323\333\200\235\250\241\271\202\246$I\3521\254\001@\002B\020cf\036\022\340\262\034\202\361(\307\241J!cH\221\214\004\243 -j\341@@\262\n_(\"B\351\316\226\365,\373\027E\214,\310\256\354\277\360\002\275\017!.\231\304\254\334\027F\336\252\347\004[\363A\306\n.G\304~\026QW0`&b/\216\365\265\217<V\2242|\215:>N\321M\235\264J\256@\267\3716\274\263\340\npCT:o\244\300\202\\{\346\213\262\316\022\200v\203\244\324\300a\025\301\326\304Tp\026^X\2754\211\310\007\250\240\253\215\233;\030\237\240\303\312\310\330"
+	.string	"\327\037ugy\377d\2706q\300\034\350\233rAt\227d\313\211\233\001\035\253<\342\t:3YA%\333\345\304\351\360\026\nF"
+	.string	"\016\340D\035\030\305(1\026Z\241\245\034x\224\177\330n\213iA\225\345\356\370\366\266\232l\361+\261\300\257\325\336\346\203\271+\350SB\222L>\234l\001\232Jc\3612X\362\201\225\001OS\340\007\227\362\022"
+	.ascii	"ERA\352d\363g\020\b!E\274\356\036\274\004J\024/\005\340\351\201"
+	.ascii	"\271@Q\236Y}\254e5\312\372\201U\030gR\311Ry-\366Z-\226\241Ac"
+	.ascii	"\222\245\360\333H\347\321\216\177gA\334dhfs\336\275#\003"
+	.text
+	.section	.gnu.lto_.pureconst.aec462b891bff969,"e",@progbits
+	.string	"(\265/\375 ;\331\001"
+	.string	"7"
+	.string	""
+	.string	""
+	.string	"\022"
+	.ascii	"\205\004\002\205\004\003\265\004\004\265\004\007\271\004\b\231"
+	.ascii	"\004\t\271\004\f\225\004\r\224\004\020\230\004\022\231\004\024"
+	.ascii	"\231\004\025\200\004\026\230\004\027\231\004\030\204\004\031"
+	.ascii	"\230\004\032\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.aec462b891bff969,"e",@progbits
+	.string	"(\265/\375`\365"
+	.string	"m\007"
+	.string	"\262\n\036\"\2009\351&\261t\203\371\310\004d\206dN`.\023\330\003\330\330\365\007\376\242\377\311j7\314-\"R\246[\227uA\034\214\"\361\023\001\261\303\006\026~\250\323\351|H\270\355<\376\203\312\236:\245\366(\3503*\217:\253\362\212=\003\355\\\264O\252\234j\001\214\t\345$\314\2255\215[k\363.\265\265'\271S>\265?s\313-\307:\177\312\245\362_\"|p\363\254\0043 P\202Q\212\362\006l\300p9/\224m]\003Wh\254!\022\032\371,\224(\335v\300f\207\300\002\336\216-\332\330\305\226l\b`\2163|7Xv\244\301\004\343\211kCn\223 ("
+	.string	"\274"
+	.string	"\244\345\341\271eQ\241\317\006B8Y\024>\001\214_0UW\344\305\027\302:\313\326\203P\204NK\365|\001z\002K#R\004\363g\214\231\323\0260"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_.lto.aec462b891bff969,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_initEEPROM.30.aec462b891bff969,"e",@progbits
+	.string	"(\265/\375 \310M\005"
+	.string	"b\211#-pU\323\001"
+	.string	"\355W\270\340HC\270|\261Z\214\177\215c\304\004j\276\"kz\003\026\221\375\372\377\345\362\301\3066\370\337\246m\321\336)\005\236\223E+FQ\214G\345\270\350\224W\325\260\344\254\0209\035L1\252\312\b\245UJ\336>v\006I\234\330\236\006\343\305~`cgC\305~\243\202g\267\022"
+	.string	"\260!\001Hc\373\2223[t/\263\347|(\235owe\304<;\314\374oN\3308\355p\260\330]\303\215\263\334\361\266\021\266\023\266\253\t"
+	.ascii	"\252\244\233iq\316\f\001_\356\032\236\026\302x\031\002\\\272"
+	.ascii	"E;\237"
+	.text
+	.section	.gnu.lto_scanEEPROM.32.aec462b891bff969,"e",@progbits
+	.string	"(\265/\375`\226\005\275\""
+	.string	"V>\332G\200ZN:?\375\023`=\313\274_\355\250\310\373\373\363\331\241\200\333\3123\325o\261\357\243\231\301\373\306\370M\"\006\226\005c}t\f\305@\025\020\227\245b]\333\261\347\343\274\\\035j\344V\3737\325\326\266\355M\344N2\306"
+	.string	"\277"
+	.string	"\307"
+	.string	"\224\371\314g2\373\316\354\3047\362%\373\370\312\037q\272\231\212\363n)/\026\007\032\312\005\273WV\356N\366\"N/c1\024\245\274V\017tD!;\360\312\tv\257"
+	.ascii	"\036\264\257\364@\373\312\n\0268\361\323\225:\220:c\231#\022"
+	.ascii	"\271{\225\302\316\301\226>\335\327\343\355t\266\236M\237\370"
+	.ascii	"P\367a\b{#\233\273\201\325\365\236.B\321\2263\243\027&?\264\316"
+	.ascii	"\233\261\333b\265\345\2732R\335\ta\212\026\362\314\323\030W\307"
+	.ascii	"\223&\301\240\371\362D@\254\270\250\325z=\203\310\036T\277+\027"
+	.ascii	"\247\2013ik\316Gu\275\177WR\347\320\275\367\313\323\252+#\245"
+	.ascii	"\272\b\367^\246TWX\347\2343\263\025fFb\256+\002\r\205$\243\312"
+	.ascii	"\216Z\366\241\245\037\356\244\311\022\2239@\276y\221\321\026"
+	.ascii	"\200\224\373\327\214\0330\316\006;\r\"E\rV7\030\277\306\207\366"
+	.ascii	"\035b\031F\212\266af\020W2\334\335+\205\304O\362\263\245F\003"
+	.ascii	"G.\354\225G\020u?\336\f\2717\352T\257|\022\366\365M\0039\306"
+	.ascii	"\253HY\024m2+\241h\2031\237*\001\302\344\342\376bf\312GFEDCB"
+	.ascii	"A@<\312?L9\350\003l\312=\2262\017\217\362\016\217\362oGYgG9\307"
+	.ascii	"R\366U\312\275\035e\236\216\362\356eg]S\266\226r\275\331\371"
+	.ascii	"\254\224\373\244LO\312/\240\024E\016\215P\363^d\363\315}\253"
+	.ascii	"j>^\366\233=\275\256fT\346\202t\327\300\346uP\017\3714\257\177"
+	.ascii	"\214\023\265\353\216[[\362\005\007\033\257\301\270\006e\271Y"
+	.ascii	"\272I\3216\335\306\225d\315N\013\005\243/X\376V\201\300\227{"
+	.ascii	"/\203\327,\312{n\263\257\266\213\313,\265\201m\373p\246\306\214"
+	.ascii	"\264\311\335\265k\034\224\245\227\2638M\306\206\330\234\256\301"
+	.ascii	"\370\314'\301%\217h\274 \002U\307\263\n\324>]u\346'\300\3618"
+	.ascii	"\242\361\204\372\313\367\3243\177\205\250\313\022\263\3626%>"
+	.ascii	"\223\261\257\300\256b\276`\273\213K0\026\316v\201\n\207\f;\r"
+	.ascii	"}\346i2\253\313y\357\2756H\3517X\276\024~\332\325\224\230\022"
+	.ascii	"\355k7\233\3475\313\334\301\003=\025P\227H\023\233;3\025M\037"
+	.ascii	"\026\207\315C\004&\230\212MKK\037F\020E\234`\032\nO\020A\230"
+	.ascii	"\020\016\213(\204\b\0060S\323RQ\230\202\211\251(\364)\357\373"
+	.ascii	"\213{.\234\034\321zG\375\345\223\270\2749Ck\376\223\r\006\233"
+	.ascii	"\266\261\313g}Z\327U|Z`\237\r\220ga\213\372\2501\204y9\252\365"
+	.ascii	"4?\356iT\360\303XBR\322\032U\034O\363\317\020\003\230\351\351"
+	.ascii	"\323mj\354\247y\266\236\264\330\351\237fz\3342\236\257\330_\357"
+	.ascii	"\264\016n\312\313x1Da\030\243\376\365\307\302\320\246\204\234"
+	.ascii	"\007\332\263\215\372\227l\022\265N\321P\3534R\222\315\211\374"
+	.ascii	"l\242\376%\331\246\306\214"
+	.string	"\237\362\263s\206t\235\223lr\354\301\202\366\242\347k`\013\365\335z\355\203\013k\250AD\343\fS\246FdF\302H\2324\006\200\002\221\241\263n\021`\265TU\265 \231\016\n\350\377\237\033\327\031L\346z \271p\003q\222\274#\200:\t\306\311\250\327B\242\0160\024\337K1`\230\374]\320\321\236\222F\226\255autdP\316\206\270m\013'\350 6\363i\220\351\320[y\242\004sx$B\261.\022\003\022z\324\374\324\017\221\215\220\213\330\350.ct\01323b\177\300\214\362\340c\237\316\264\225\351\265\207O\314\177\354T\360@x)i\322\006\300\361d;\263W\344\363\365L\204\340\tH\213\212\257\004h-\230\320\214\250|\324[fy\221$\177\245\244\227 c2B\027\027\013}C@\001\376\265\023u\337\332!\262\005\311#%y\207r4\241n\030D'\bR\314\366k\330\254\343\024(\243\225U\262"
+	.ascii	"n\nV\003"
+	.text
+	.section	.gnu.lto_isJournalEntryValid.34.aec462b891bff969,"e",@progbits
+	.string	"(\265/\375`\r\002e\023"
+	.string	"\226'\207H\320\016)\035\302\260~\306\005\007I\352\005\036\344\222\316\350aWV<\001I\024\234\235]\320\220\030H\242\314.\364\353\326\345\352\246L3\370\231\270\035\002\36504\002zu\206\371Us\313\265Z\b\036\317k\376do\"eJ\001t"
+	.string	"i"
+	.string	"w"
+	.string	"f\331V\265\017\342</\357q9\307\234:\027Ds\366\\.\240zt\357\035\362Q\365"
+	.ascii	"\362\321\266\r\034x1\355\275\234\232P\006\351\366\0235g\357\265"
+	.ascii	"\034N{\004Wi>\314\343\245v\226p9\013\007A\017\035\016\214V.\006"
+	.ascii	"\3748J\272\261r2\272\340\200\033\244\n\255\234\r\354P\332\300"
+	.ascii	"t\336\225&'\243\032\212\3149\255\270\034\205[\336v\003\333\t"
+	.ascii	"l]\t?(\2529c\020\370\"$\244\250t\036}\027\371\370=\357\212c3"
+	.ascii	"u\303\323S\323\237\335\263\351\356\354\203s\316\351\325\331\240"
+	.ascii	"z\003TkX\335R\2513\336\363\257\254V\201\3520TK\251\216Q\rJ\365"
+	.ascii	"F\265\202\352s\214\020E\275p9\315Y\363\233\232I\261\250\203\355"
+	.ascii	"\373!\356\323"
+	.string	"\362\236YONQsNV\213\315z\274\375\342\030\300]m\3345\372\202\013@\003\324w6\037j\240\320\310\203r\346\254\035G\342A$\027\312\231s\206\224\270\211\022\303bz\\L\316\373H>\356\352\n\237\n\335\325\356\306\246\031\017\033\253{\336\t<9\371\226\200b\324\364\347\375M\335Dj\354\306\312\246\333\005\233\376\034o\"\277\032{\237\273jL\276\245\02176=\001\245\224aw\347x\024\371}\340K\021\243R\266O\036\020f2Xl&\r\003I\221\315Vb1\022\223\223\b*2\330K\345\244$\345\005\233Mx\201\b\260l%6{\261\310d\263\027\253W\373\352\034\352Q\334c\307t\033\002[{\336\025\260h\0014\264>M\252\226\306\266j-R[[\314\330p[\0336\335\212:T\356j\367\367\273\215\244\275\200\201\036\027\356\307\314\302\370+7dg\351\026\343D,2_\307w \0373\326E\023\035"
+	.ascii	"\252\322\021\215\305\\\215\366Mx5\332\313c#B\270\236\022\222"
+	.ascii	"\240\371\020\365\230\355\303\r\220U2\rb\026\315\320\3656K\213"
+	.ascii	"^\264\306\002\223\332\370i\btG\003|B\362qs\030,\353\237\313\230"
+	.ascii	"\240\202r^C,B\315\222/e\006"
+	.text
+	.section	.gnu.lto_scanJournal.35.aec462b891bff969,"e",@progbits
+	.string	"(\265/\375`k\005M\""
+	.string	"v\375\326J\220\026R:\004\333W\036\225>0hpx\322\001\302\215\37433~\031\227\0056~\216h7l.{\232\232w\321\234\215\373T\327\n2\234\213\b\220\030\201q\031\020W\0040\251`"
+	.string	"\344\303\323\002\200\307h\274\343\023\262\t\221;\311\301"
+	.string	"\270"
+	.string	"\302"
+	.string	"\367\336'\231U0\337~\376H\276\361\255~\245\364\343\212_\237\320\026lZr\2717\211\340'/H\177r\3626\366g\372"
+	.string	"\366'+1oy\222\352\242F\264_\226\332\275w\3278x\246*\235\006w\233\261\245\250=\315\256J\374\235!a\300!\213\323\3148nL8\303,\340C(Uo\271\241\017\271Tg\354S\324m:SO1\236\232>Tjh\371\2300\206yS\224\362\342X\327\361!$V\364=\031\267?\344k\213\241\257\236(\016`\332\324\223\214\233&\204'0\234r\303&\263\352\270\222v\254\327\340\220\251\366\221\247P\205L\332\324S\324+\032\341\336\313\0258|:\347\316\314Kff\300|6\bU\f3{\370\226Pz/\223\003\276\223\017 \322\252!\373\363\255\003jL\361\352\330g4z\250u\033QX\376\2223AATTd\177\236Sd\324\276\330t\022\243s\214\214\220g\375\310\n~\025\2138\252\007\376\344\037\331\2376\235"
+	.ascii	"\252\254xE\354\3255\346\344Rm#\363\035@A\311\301m\203\331\247"
+	.ascii	"\347\225y\272\362NW\326\311ye\234\256|c\243\353\3125i\345\334"
+	.ascii	"+\323\230\225q\257|{e\033Z9\265\225\321\263\262\375\361|\232"
+	.ascii	"\225M\263r\277r\355\31270\240\252(eTk\263\344uZ\033s\305N.\036"
+	.ascii	"?\376\314\347c]\311|c\025/\302\004\244\304\212V\001m\344\232"
+	.ascii	"\346\364\b/-\320\234>o\313i0\224\254\211\020\342\211Dq\302\222"
+	.ascii	"\266\221K\330\264yJ)h\247\375\263_\031f\r\377\332\200\366\371"
+	.ascii	"Cky\264\255\353\234\376\024\037\220\235\266<dZKfH\312\364\332"
+	.ascii	"\230\007Y\235\336i{\366#\236\017\2627\255\3236\313W\274\222="
+	.ascii	"\334\213o\372\312\327\0350\312\224X\271\341\205\266\361=B4*\333"
+	.ascii	"F\326\272"
+	.string	"\331<%\026\001U\327\314\034:\324\003\315>\3263\020\305\230\232\305W\324\2210g\033\231\315\326uO\007\217|\252\026\006\326\266\346\351 s\367\223\356\002v\351\351\332\335\377q-\3255\346\252\215z1\262$\002\360a\351\231m\354\265\265\013\3317Oy\205)I\347\241\237#$^\022\021\221P\221Q\b\022HC;\022F \216vC<\023\273\237\035FJ\"\342\355N !\361v\267d\357m#\203\227X\257\227\270\246\371_\016&H\302\204z\340\004`\227\\\327t\005\363+\323\005h\227\226\353\373\202\240\321\364\315E\027\r\356\254\202\361\351[\343\262\334\016\374\330Z\342\004\265t\341\254\256\3314{\332\247\203\325\332:E\030\230\311\3238W*\034\260b!\201\031N\037\313\214\206\02720\246*\346\326F>\362\027\232\226\277\255j\323l\332\316\326U\251\240\200\352\336\336\201T^f\341\207\352\336\373`\354d\027\2301"
+	.string	"\325\003\201\354=\177\331\237\266\256G\345\024\373"
+	.ascii	"V\327\266>\362\246\025\0174\037\220\233\367\336;\023n\250Q4\306"
+	.ascii	"\214CJ\225\0042\222\302\0244cp\002\031\252\262\036\020hV\332"
+	.ascii	"\244\2059*S\356]\354\241\017d\276<\204\233\300\323\344\2557\211"
+	.ascii	"\2079\032\376\3743\343+\237\336\r\300\333\247\002\335\016\202"
+	.ascii	"o\023-\n\273\240\225\365N\271\232\312\317\323\336\036\r\013/"
+	.ascii	"f8\215{1\360\020\026\255\335\372F \220\233nFs\264\257\002\024"
+	.ascii	"\025\217\367)\222+x\231\nG\364\341\020\263\231\342\252n\306\336"
+	.ascii	"\263\375\230\250\f\316\261\251\351\361f\225\317\200\217%\254"
+	.ascii	"\326\352\026b}p\277\247\224>\2612\236C\241\203\032\f@\177\261"
+	.ascii	"\251N\303\215<\327\210\317\270\201\343\253\nc=0\372M5[\252Q\004"
+	.ascii	"F\317\320\005T\244,-bl\340\375H\224R\347@\220\341oJ\303\035L"
+	.ascii	"\320Du\315 \223+\325\263d\344\354n]\002\323\236;~\266d\022\375"
+	.ascii	"\017"
+	.text
+	.section	.gnu.lto_isEEPROMContentValid.36.aec462b891bff969,"e",@progbits
+	.string	"(\265/\375`\326"
+	.string	"u\013"
+	.string	"V\224LC \213*\035?\200E\230\304\006\203\005\301 \006\254\354E\246B\234p'\210,\222!\333\247X\324\365\377'\031\233i\215c\004S\220\336o\343\001\004\0014k\356\3235:\264C\020\207\371J\302jB\266\224)\0058"
+	.string	"9"
+	.string	"9"
+	.string	"\334\242\376=\223\253\237\177\325\245\003\325+\024\301g\006./\2338\322\225\030.\013 6Q\200\234(-\b\257\272\222D\221\252\304\307\234\323\032\212\004n\355\266Alg\330\367\b\332\263\357\026\300\360\340@Hc\366\b\352\236\354\313\271&\333\352\212\372\226\313\b\r\035\2579K1\021\263\225]``\373\266A\366f\215\r\220\277\217\251\322Q\n\006\260B\3149\006{\362%\\\227\002\001\007\335\t\222\025z\320\324N\001\240\017u/H\037Z\242\005\355\021\374S0W\205\335\223\377i\337\221\325\206\221\302\354Cx\204\317O\340"
+	.string	"\037}\370\314\377\004\316`8\235\347\321hBJ6$\235.\303u6\"\034.\343\235p\030\013w\036\215\307\241t\235\307m\343\274\234k\252lEhEfUvW\0312\213\332\235\211>\364\205\302\213\243\325\241\201\f\027"
+	.ascii	"\252\244\2231MD\206-l\006\326\005\203S\230iv\250\366\201r\260"
+	.ascii	"\374\t\203\020\260&8\303\n{a\207\006]\310=\306\270\271\346\200"
+	.ascii	"\313C\302MW\325\200{\253\262\t\005"
+	.text
+	.section	.gnu.lto_getEEPROMConfigSize.37.aec462b891bff969,"e",@progbits
+	.string	"(\265/\375 \373\305\006"
+	.string	"\322L/4Pm\222\016$\243\252B\304\342\362\326\246\354\242@v\0335nc\250\212ekw;\274\326\300\272k#\255\177ffA\256\035\255 \021\213\334\032\032\333\315\222-SW\231\315\205u,k\301A\323\300\271\252\307\3210l^\205=\274\214\301W\307\302\036\304ua\017\263eGW\020r\022\337\220n\331\3458\302\203\325:]\017\325\t\035\300(\204\245\337@\3502\276\226t\030?\216.`\224\222`\222IQZI\224\251\244\343\377<\346~\224\3649\303m\243\202\032!\231\020Q\311\334\236@\t\250N\330\001\252\223\323hV\314nAj\361 \235h\"P\361\242\220\231\243&\262\350\256\377\301\217\360_\004\t"
+	.ascii	"\252\244\223i\021\206\211\bW\273&\336F\340,D\036\356\212\251"
+	.ascii	"\235d"
+	.text
+	.section	.gnu.lto_nextRecord.38.aec462b891bff969,"e",@progbits
+	.string	"(\265/\375`\317\001\245\020"
+	.string	"\206\037oE\340\322&\035S=\274]\022\251c\254\021"
+	.string	"\331Y\371"
+	.string	"\f\032\274&`u^\351\034{\234?\035Q\255\272\205\202c@\n\311\217g\021o\223\234\2111\306\rF\251\3133s\t{C\205f;m\314\004\355\275\245L)["
+	.string	"T"
+	.string	"["
+	.ascii	"\r\354 ;\264\355\243x\n\026\247\ft95\002zd\254X\024\355v\232"
+	.ascii	"\273\027\210\207\331\t\304C\305y\352\021>\315\224\337\362\250"
+	.ascii	"D>r\b\371\260@\034\306<U\211\005\223\372\036\f\205\340\t\300"
+	.ascii	"zy%\032\034\256\273\2363,\230L\221\222\335u\312\260jn\221\333"
+	.ascii	"F\331\216`'\202\327\"\233 \033\235\035\227\214\331]K\352\215"
+	.ascii	"\375\267\332\262\337\335\244\357\374\231\3231\323\360\245\237"
+	.ascii	"\246\365\245S\323\007\300\262E@$\304vibC6\b\322 \361\356\267"
+	.ascii	"Y|\227K\266;\017\337\230\017\244\231U\215\241\335\216\301\241"
+	.ascii	"I\362;\251\017\330m\305f\354v\001(\013rv\227\304\347/28e\313"
+	.ascii	"\313l\361\320\335\3367\342!T\223\027\354)I\241>\210\352S\n:\260"
+	.ascii	"\325\221\342\264\360\020\242+Q\365\302k\207*\215ZhPU\242\036"
+	.ascii	"'R3%i\352\210)\361\2221_S\277:\362\206\257X\311vU\020\374\027"
+	.ascii	"\252C\266\273\037q\350\247\342a*\307\300m\246\023\027m\032I\331"
+	.ascii	"8\225\323\251\302\t\212\tj3i(\024\013)\232\211[\321F\022xS9q"
+	.ascii	"\032\207m\343\264R\267\327\226EV\260\325\317#\351]\237 \004\324"
+	.ascii	"\363\003\257\342QglGu\211\213\276D\2759L\204\r\023P[\360\200"
+	.ascii	"\r\321\013H\225F\t\304s\363\343\3058Q\220\263\353r\031\027\207"
+	.ascii	"\021$ \220\"!;;\n\351\234-\256\314x*\357\270\361\204U\272h\203"
+	.ascii	"\265T\242\267n7\rCk(l\340\256\370\201\245\b\026\210\225\321u"
+	.ascii	"\215\245\305g\225\312\307\216l\207E\256o o\214\031\024\307\236"
+	.ascii	"f$\be1\376l0\227c\276]f\024A\336\252\366A\001"
+	.text
+	.section	.gnu.lto_recordMatches.39.aec462b891bff969,"e",@progbits
+	.string	"(\265/\375`\006\002\375\021"
+	.string	"f\243zG\340\264&\035\250\340/\304)\333\r\341\260\244\215O\333pB\276\005\376\022\246\351\021\247E\252GOM\257\305\217+\005\021\232J3\316\375\006m%\021\306\030c|J\2514\224\254"
+	.string	"\216\352\302\221\252\263\363#B\b\331R\246\024g"
+	.string	"a"
+	.string	"g"
+	.string	"\366_\274'\365\327\314\005\314\351\022\3021\247\330\300\016\270g\026\237\242=\343>@{f\333\017 \244Ls\321\004\316\306\002\302\212\021\231S\364\266\304i\236\311U\032\377\261g9/\0376-\016\317B\\v\255\016\272R\201\016\017\020'\255\225L\t\332\t\362\330\365\246\245R\335*\3149\2556\255\017\267v\333\026l\203\266\212\002;\216\343\350u\331\232\332\304\352nS\227\334\347'\371\353\3474\365v\361\327H\324\222S\357\246VM}"
+	.ascii	"\001v\004Q\3501'\316hd\002e:T\330\276/\343?1\217\341\205\rq1"
+	.ascii	"\347\354b\354\356\331\355\224\335\331\2260\016K\335g\203D\231"
+	.ascii	"\253\235\032\023\270"
+	.string	"g+rE\031\025\224\271\202\215\220\240\032%\273\004\206XG\366\0054\335\222\265>\007\213\256w\342Oa\243\003\264\313c\223\375*\013\330\217\225\026\261=\372\r\033'\0227\347\234\321\236}\037\273\276H\254\32010\376\323\2665Y\225!V\216JG\377\307\245\3230qs\256\"\3703\302\f>\212g\276\214\366l\333\377\034\201\207\0260\021=\257\032\035mQ\245\313c?\306 B\305\200a\211%\374`>\227Q8B%8\201&\230\021\311\324bzy\031i \235\224\276p/\204 \351\0135\223D.`\210\372>\226\222\251\345\004\222\274\223i\344\342\221\302\027Ot\300 \352\013=\030\020\f\275N\254\271\234\353\262\312\005\327ep\2717\266\273]\251Y\225\345v{M\3169g\266<r}\204VB\344\272Hv\003\" \200\002\031\251\346\030\005\306?5\035s\323\021f\316\353\333\262\347\305\027\003\\\2037\310\377@"
+	.string	"9p\2415A\002|\230\274w\321\226\343\n\003o\033+"
+	.ascii	"\3340\230?1,RB\261\034~\362\350\313\224\206`a\fc\200\210Hn\272"
+	.ascii	"\264\030U\207\201\002"
+	.text
+	.section	.gnu.lto_findEEPROM.40.aec462b891bff969,"e",@progbits
+	.string	"(\265/\375`\273\002\325\025"
+	.string	"\326\250\217K\300\322Q:\342\227\354\356\270i\243\020\005\322\f\211$\004\372_JI\302g\271\210N\301\252\021\255\315\241\"V`;\264\036\257K\215\361\364\371!\2507\032\202 \b\202\2044\026\202t\214Tv\020\237`\021\265\302\377F\310\336[\356$\003}"
+	.string	"t"
+	.string	"}"
+	.string	"s>\350\303\005\334\273\023\202t/\317\001?\030_\017\343@.\\+\300\363\261\t\020\024\342~S\367\362\\\314;\001\373:~\200}\355\036\356Y\373(\256l\245=k\374\227\217\007\236\342\030\342\001De\302\006\347\342\b\213\233\257t\324\344\264t\270ioU\206\322\t:L!\016\374\244\321\331\350\237v|\374w\004-jpf\263t7\237b\205{/\317\234\316\346\314:3\307`\346\013\3143E\263\021\305+\277f_\337\007^\301\217\357E\020\314\034\322{\357\355\346a\346\275L\023\231\313\304\275c\276\320\337z\320\317\342\311\242\025'W:\231\332\311}\337y\326\311\027\371\r\211))\nM\367\202\030V]\247\232\264\342\2763\037\310\334:\263\013\377\307-f\366u\370\275\325\254fpUQ\367\362\032\274\262\205\361\225w\031.\027\362@G\256mG\005\204\361\365"
+	.string	"\345\325\300\356D/\207m\n{\207\210\234\213\3126^\013|\220^\003\306\300\347\336\033\201\306\223\346s$\357\236\227\354+m\016\275\246n\333\264\247\322\355'f\016\371\335\3352t\204\033\322RA\236J\320\346\341\003\177\002E\203;Z\321\376\357$\363\300\317 iC\246\370E7\212\261\n)aD\224\016\320\2750\317\275\316\363\017\373j{\3462\373.{P\266)d\346\f'\222\215\367\332L\370Ce,_\231\221-/\030\231B\322h/\r0"
+	.string	"*\261\262\031V\"\233\225,\261\030\212\n\231\2622\203\271V\310\227\314\005+i\256\222\004<c\211\225\256\226\331\254t\265\370\276w<\353\203\237\364\301\377\367\023\250\234\340Q?x\026g\213b\317\216Y\032\251\265={\206E\250\214\224\3047\221p\330\263\352\335\006[\273\354\365 \231\255f\265mf\f(\363\271\332$8N\267~\271\001\244\250\3126\017\0074 `\002\221Rj\007\313\364\345v\257j\016H\350A\tk\b^\305i+\366dKs\313\266\341\360\203Yq\021\r\001\264\002\276h\200\200\324\003\031a\314\255i!.\276\343\357\033Z\034\240\267\236\241\270\215N2\246\204"
+	.ascii	"\217\362&V\322F&J\017\326\003\311\216\260\032>s\364cF\232\373"
+	.ascii	"w\313\267\026\301 \300@]\001M\345\261V\234\321\344\252\r\306"
+	.ascii	"\221\033\367~7\356\245\362"
+	.text
+	.section	.gnu.lto_findJournal.41.aec462b891bff969,"e",@progbits
+	.string	"(\265/\375`\333\002\375\026"
+	.string	"\226+\227H\300TU:8\313/\356\336\326?\305\342\237\021adH\226c\036\361\217\177\360p3(\2345k\204{D\370\271\237[\2231\365\025\256\351Y\351\334\262(\252\f\206\342\333\373\314\323\n\264\371v\331\324\361\252\277\244\355M\344N)\205"
+	.string	"z"
+	.string	"\205"
+	.string	"6\037BT\265\241p\341@\374$\020Z\312\327\2008\200ZS,\321Q\353\270\300\r\304\317\313\370\214\025\317\006\2143\274\323/\006\327;R\353\230\362x\001\364S|"
+	.string	"\372\271*L\345\354!:\303\2253?\024\241\3670\006\016\234\334.\304Ca\210eD\013\323\016\027B\b\002\332\371\257&\351\350\305\313\247\313C\323\216%$"
+	.ascii	"\274\324\355lr\377{\002\240Nn\367r\031\212Pk\265\314\355x\267"
+	.ascii	"x\333\"lW\260e\222\366!\314\004\001yS\330\2424\352$J\233D\351"
+	.ascii	"\322m~\223\327\374\244\221\350\276\233\316\337\334\341\224\336"
+	.ascii	"\220\264\244\322\007p\340'\306\004\315\211\0052\326\021A%\325"
+	.ascii	"g\356\270\270\357\277\271\264\357\343<\307&\331\303qx\177zb\324"
+	.ascii	"Z\2016\3517\374\237O%\2540c\345\305\200\276\031G(x\260I\237\267"
+	.ascii	"W\374\236I\266of\2577\022\242\226 3@\265\216\n>=a\307\327Xy="
+	.ascii	"n0P+\r\374\364\324\200\340,\331\240\222c\240\245E-%\202\203\231"
+	.ascii	"\307@M[Z\332\273\305\324d\320\317q\206\363\250\304Zm\017\374"
+	.ascii	"\035\261\225\277bF?M\373\234K\026/?14jh28W\346?\206\330\370B"
+	.ascii	"\031\375\306l\b\261\311 \227\244\311\222\226\256\215\322\332"
+	.ascii	"\003\377\226\235\036\237\333\206X\234\036\226\335\256L\216\353"
+	.ascii	"\250\370+\274\301%\237\373\364]\364S\264\377\035A\t\036$04\031"
+	.ascii	"\264\307\232\\\231)\327\360R\201\235\314\027\254\325A\265j\235"
+	.ascii	"\264d2\025\207\225\t\205\025[\257\030\270`\261\024\026+\003J"
+	.ascii	"\353\344\005[\245^-\225+\265\212\311R\f\n\030\226\302\212\245"
+	.ascii	":\300`\261\024i\244=\244sG\243\267\360\214\370\320\266\026\022"
+	.ascii	"\211\270\024\231'\013448\035)Z\272:\2073\334\367n!\310\fNG~\347"
+	.ascii	"su\273+\301\207M\006\361\270\260\nx\036\326Z+]\031\037x\021\013"
+	.ascii	"\227\034!]\207;7\\\235-\227\356i\0377 `\002\031R6\017*\351r0"
+	.ascii	"Dj\246\302z\214\"p\003\317\251\260\024\003\217j\221M\345\"M."
+	.ascii	"\016A\303\032\232\003\215\370\307x\207bl\036F\304P\034\2147\360"
+	.ascii	"\020\026\326\3715\354\327\312\025\361\nz{\321g\322\310*6yXy\b"
+	.ascii	"\210\032\020\301\360\344X\250+\004\267\346K\246\332\354'\317"
+	.ascii	".@\201\375\254\243>f\254\271\277[\276\265\b\006@\004\214-\367"
+	.ascii	"\022\257f\271\351^\240\305Nk\310"
+	.text
+	.section	.gnu.lto_loadEEPROM.42.aec462b891bff969,"e",@progbits
+	.string	"(\265/\375`\\"
+	.string	"\365\b"
+	.string	"\302\317:9@s\322\001pD\202\350\013F\371\3372M\033~\246KnB=\207\035\337\351\n\343E\362\311\345\247W\024zsQ\023\210?#\313C\301\341\205\253\240yM\006\225amK)S\317<\241\271\2154\255!\002\004!\232\231\024\201\034B2\333$\244\207\340s\244mrb\316Mba\00576/\260TT+\274&\333\235\361\277\373\237\213\356\300H\301\335\t\337\315L\237\002l?\240\304\224\370\346\221\377\n\013^\323\366\246\366bul\330\320t\315\375!\307\035\262\002W\337\033\344?\277\371{mI\330\252aP\325z\312\301\251/\035\026\222\377\244\037\373\001\002\351t\303\357\264#'\030)\255ZC\331\"\224\351\306f\372\025\360\270\215\027j;\026x\264\2400\257\213\0030\0372\233Z\326\360J\314\001\237Z\353\331\344q\354;\373_\341\277\301\177\227\023"
+	.ascii	"\252\322m\30104n\330\016c\254f\005E\240,@\337\247\326\300\312"
+	.ascii	"5\3532\207a\021\027t\237\262O\336\343\f+\003'\257\345j\032\203"
+	.ascii	"\202\002"
+	.text
+	.section	.gnu.lto_writeSettingsToEEPROM.43.aec462b891bff969,"e",@progbits
+	.string	"(\265/\375`x\b%0"
+	.ascii	"\352U\320\022DPdN:#T\t\355D&\306\253\310d\271\261+\025d\3612"
+	.ascii	"l\335\2456k\247\274\250\001\365\213~\354l\236\265\365\217#z)"
+	.ascii	">(\250B\001P\221*\036xX\357\310\355\255\250c\351oxb\211\264\275"
+	.ascii	"\223\f\027\001\b\001\037\001\251\333]^U\367\321\374M7\260\217"
+	.ascii	"w6\321\231\035\230\2343\220M\277\331\3006w\303\365\272\033k\326"
+	.ascii	"\242\202\231\006\265Z\237VP?\327_\223\346j\270Ng%\244G\234\274"
+	.ascii	"\252\365\003\324c7\360)\356\346\352\257"
+	.string	"}\314\333\356v\270\3135\260o\346g\270\036\207\303\227\213\264\271K\006\234v\214\306\372\364\266\020>@}\313Z\263\226\225\311d\002\315y,F\231\2555\323\255J\271+\320\234[\027dt(u\035\345/\246\032-9\217\2518\333\305p\275\335\241\344\325\3461\030wytP\353\323\243\027P\237\336\017P\237^\215\207RW\233\305<\314\201\252Mx\332\026\326\247}!\003W\263o\321\304~\314 J\267\274\234\333!\236\322*\027#sy\270\030\231{\336\327\276}\227}\352\303\227\355\313\275\201\233\241\3443\216\254\353\251\357\007&\206%H\006\346{\322\203\262a\222%\257o\213\331\361\327\374\3269\333\236qdf\277?\0209\347\276K2!o\365\335\355\325\335E\272\327\026\001\237;\034\373\005\203\0366\215\rs\233p\360\302pW\237mm}\223+P\273Y1\207\013\321\304\324MM\236\240\005\267\333\374\256S\217I\230"
+	.string	"6\t\273\236\024D\264\234\275\276\354\347\371\363D\337\312\323F\221\"\205\372\364\330E\232\266'\334^\237U\373un\207\355[\351\025,\356\227,\324\247?74y\202\274n\264\r\334\317]\316\305\272\354~\021\343~\331\005\270\214\025\202~\341\256\3566y\361Y\367\237\320\364\240\215\243t\007oG\005os\b\336\336\020\274\r\365Dtj\n\336\246 \340\266\204\253\275\227\222\022\004o#\235\356}\3642o\241\360v0x\333(x\273(x\033(\274\r@x\233Hx{\025\336\376\005\270\255\006\270\235\036\335\366\to\343\340\355kt\373\035\206w\226$\251\"\206\237m\026\213\032\312x)\233,\257\373\351~\265\277\375\311\374e\376\267?\356k\367\373w\237Cug\377\300\346\200\241\212s9Uwv\327\214\025\363\261dK\266L}z\204\213\244\264\331}]\275w\233\274/\347\234}\370\f\356G\370\t\177\315K"
+	.ascii	"\212\023\r\353r\303\227\363\223\017P2>\254\342\037\321\t\377"
+	.ascii	"\360\017\211\251\030x\226'\215\315\207S\354\324\244\331!\227"
+	.ascii	"\311\022Ys\316)n\332\303\026\205}\370\202\035\235\b\367*\237"
+	.ascii	"\001;a%!\306\330\203\235S\271\367\340\252\3167Y#Dg\221\263\f"
+	.ascii	"\017\311\233\022\224\274\031\202\002\226\200\257\334+\202\302"
+	.ascii	"\024\360\347\334\267eJ\273\006\367\266\267\201\311\233\254\223"
+	.ascii	"&\276y&0\273\266g\034 /\275C\341\r\030\301 9\315B\371\036{\006"
+	.ascii	"\205/\347\r||\271\270\233\235\362\346V\023\261\344\250Y\002R"
+	.ascii	"\317\244F\341\213\337\374\004\267\273\344\363mI\362F;)\372-\225"
+	.ascii	"\003\216\302Hu\312\"\3117\315Ry\241\035k"
+	.string	"\316_\304~\236\f\266J\337\212\225\372\224\003\376\2337`\252\265\361Yc\363\272Q\f\347\004#\303\035\341>\320\207h8\032}\327ea\267\334/\023`\243\346\335\203{\317zQ\003m\243\tk\353\210\244\232\2014j\031\255\244\220RX\016\246\220\307\242\021\251R\031\221\030i\264\2222\"\265\262V\244qJ\312hC-\"\213\030i\324:\036k\250E\344\210+\251\252\251+\022TU\"\246\214ZHc\216\253*\002YY\306bq+\353\327\305&\253#\022\313h\234AUU\343\352X\034^UIY\r\213\310\254a\023\203>b\031\221C\255\343\0219\004vw\267^\367\371\204\270i\t\007\211\374\301\363\302\311\336\321\352 \223\365\206#n\302\203x\t\377\220\222M\362F\017\005\361\361\254\341\025\202\366\210\036x\363\341&Y\260:\274/\3345\206U~\255\3013\302o\377% l\204/\036\345\021$\f\304EDJ3"
+	.string	"\030\t\367U\356-y\022\006b\004h\302\366V\"\f"
+	.ascii	"?\314\020&\302't\027\035\256IMx\305\304\273g\033\373\303\371"
+	.ascii	"\005\357Lj7\313|\333V\023/\367%\267g\212\317Z\303\021&\275\333"
+	.ascii	",\020\266\214\b\2173\357\b3\337\374z(-\r&\342\313}\355\343\305"
+	.ascii	"\317M\200\205\230\331w\b[\266\346\034V\026\200\240\250Q4\245"
+	.ascii	"\224RJ\211\210\214\310l\232\326\200\002\021\262\242z\021\200"
+	.ascii	"\261t3\2420\005I\n\323\034Nz\262\242\240\300\303[R\002\354B\312"
+	.ascii	"X\333g\026]u\200X\t\346B\207d\004$\304I\030\"\265\225\222@Di"
+	.ascii	"\234\277\267\242\\\f\032\337\363\303y\267\313<j\207\264>\315"
+	.ascii	"\327\241s\361\3169\362\257\035\022\262\274\233\352p\261Jp\256"
+	.ascii	"\370\256,}Sfk\032\223xle)\311\020!\343 \250C2\276\n\260\337\340"
+	.ascii	"\363\327\222V\301\356\025\212\247\370\3330\034)q\263\254c9\214"
+	.ascii	"\f\245P0\205\264\233\374\352|\260;\303F\007\364\307u\3113\210"
+	.ascii	"l\201w\275\213\037B\002M[j\371\351\177\246z-o\236$\323\344d\351"
+	.ascii	"r\305\023\363jl\241\362\3240\336^\204\221\210\330\006\233N\327"
+	.ascii	"\303\210\2428\b\265\227\275\336U\323_\007\225\220\251\244&S%"
+	.ascii	"\345\241\276\306\240\352H\320\213\227\320\005\260[\006\003\013"
+	.ascii	"{\270\214s\345w\346b\037\332'\343\203\024\006C\034V\362Q7\207"
+	.ascii	"\303N\207\t\206\271\335\020\316!]M\377L$\313FZh\320e\260\206"
+	.ascii	"2\002\310\321Y\320]\205g>\t\325\2708'\223R\202\227v\005\365\317"
+	.ascii	"\007\221\274\350\247\006"
+	.text
+	.section	.gnu.lto_isPgStored.44.aec462b891bff969,"e",@progbits
+	.string	"(\265/\375`\254\003-\033"
+	.string	"\226\363\264I\240\230Q:\ngF\367\374\216f\257}\0069\223b\346\036\3409\215\200|\370yCt\025Jm\247d\355O\017\374a\317\002\354'\030\376}\251\304\017n\243\0077c\335\t\217\265\005S\257r\360\263\273\031vK\b!DJ\231\002\242"
+	.string	"\220"
+	.string	"\247"
+	.string	"\177\nck\316\306\253\206\2307ejM{v\374\003\223\371_&\353T\264O2VV\353/kJ\255\351\20230w|\272<\344\216\346\316\310\035\377\277\301\203\242\033m:D\251\344u\351\234\250\2515\245\265\2205Z\263$G\261\331\350\333\340\013\231]\357h\315\002\265\326Mbc\211K\035\223\213\264\264\243\230\300\247%\007\317\026 c\316^\216Eq\266#\312\026\2547CT\260\245\204\351\354%q\213\016\306\364\230`\275$\361\304\301\265\265Q\313\274\036\216\271\244Pk=\357z7\366\257\375\257\343\277\211\277\213\004\r\374\302 sZ\200\221\241\024\230$f\363\030\177k\344\331\277-\210w\227\323\214\004J\270\246\314\214>\372S\0347\360_\261\366\357\017p\376\254\344\357\224|\031\311\327\211\225|\330\246\373\234\222\217\263O\273\347\311\177\235|\023"
+	.ascii	"\277|\361I\223?\232|\321\344w\311g\222\277<KE\250\306\314\017"
+	.ascii	"\231Z\225\206]U8V1\262\351\356\277_\252\255\"\332&\237\020l\""
+	.ascii	"\372J\355\324\177\376\3056y\214\340\021\037\223Z\353\371\342"
+	.ascii	"?w\344\277\350\033\365\363\001\313KY\\\272\234\236b\354\263\310"
+	.ascii	"n\261\373*\347\343\356\016k\305\003\367\030\204j\311\376\334"
+	.ascii	"\320\310\221\r\374nk\261\341q\215\375;#\201\342\342\234^\"Tj"
+	.ascii	"t\254\0034O\247\2677jeV?\266\240\321\002#k\235^\335\033\234="
+	.ascii	"\026\271\323\262\026\200\225{\203\343\341\267\352\037v\n\b))"
+	.ascii	"D|\233d\220;\356\364V-\357h#\354\372\210\275\"a\326\232\004\341"
+	.ascii	"k\025\242\204Yk\335\246\035\267\023\004\233|NOH<\354.<\224\262"
+	.ascii	"\210\r\374B\331X\257\025\020\037h\264\302\354\223\375\2115\017"
+	.ascii	"SOx,\2764G:O\3413DtC\203~P\233\013\233\020\020\n4\204\340\004"
+	.ascii	"z\253\331P2\310\206\366k>B7t\310f\373\tR\201\202\305\255Fc\241"
+	.ascii	"\002H\210VC[\320|\016\3746dCi.n7\224v\246H;\366,\227\n\3665\353"
+	.ascii	"\002H\215\373\253g\275\272\321\354Y\263QH\031\340\261\311.\373"
+	.ascii	"7\202\252\300\2733[B\217\\\037\375\253e\305\356~\013\233ua\307"
+	.ascii	"\262\373j\247\003\303b\311@\266\206`\320\347\024\201\367\345"
+	.ascii	"W6\360c\213M\3728\203\323#-\b\025\316K\025\201\341n a\215\323"
+	.ascii	"\003\260tKS\347\260W<\300z\247\002< `\002\031A\224\036\242\370"
+	.ascii	"\246\222\016\300\"\31403E\314\326=\256Z\326\244\"\020eA\241v"
+	.ascii	"\203Z\234\251\202u\334PF\312\024\203P\266AjbP\024/\026\214R3"
+	.ascii	"pG\361\373\265e\310N\260\317\200\rl\013\034H+_\352z=\221CA\020"
+	.ascii	"\006\300a8\023\236\322*\235\346\343\366y\245]\034\355rl\361\235"
+	.ascii	"x\231[\254\211h$r\304\330\212\nC\330\227\031\335B\370\262\314"
+	.ascii	"\357>o\211\231\216g\207\373\212\204\007t\f\004\016.\025`3"
+	.text
+	.section	.gnu.lto_isConfigStored.45.aec462b891bff969,"e",@progbits
+	.string	"(\265/\375`V\001\245\016"
+	.string	"\006\034dE\360\222(\035P#\220\203\245Tm&l\252\326\350\300\322\321\374GYWm\220\252\264!d?d_\270O\332U\366\327e\t\025\216 ZQ\373rqX\024\3311\240\335\032\326\3337<\234\345\310\343\033\331\233H\231RR"
+	.string	"M"
+	.string	"P"
+	.string	"\237*\251MC\207\023\027\032)'\267\"\034WR`t\254\244\300\314\\\2337T\321#\324VE\376\350\021\245\")D\201rMs\300\262b\004GU\322\366\005\213\021\2402\351~^i\304 \315\274\250P\256\333\210\224\322zRq\270\267\333N\331V`\377$\236#e\200\303\006\t/\313\216V\357]\267Z\375\3553$\315\217OL\312TM\020)\003e\234\270\353\366[\370\323\034\237\345.Bwa\2704m"
+	.string	"\220\222\255|H9\017\034\032\301\346\320\363\003\342\341\346!\361\360v\310\3468\301\202\220E\001'\337\345/:\355&\016M\341\213?\035\372_<\324\r\020\242\345FIg\327\244\224\022\032xH\324\215\033\201\354\2101\245 i\215\302\370\300\252\241m\313\242\370\365Zx\224tf\250\272\266\205\013\372\323\367\363O\255T\310\224v\2649z\274^v[\016$\036o\335\021\001u\236\211\307\023\201\3443\241\244\353p%\037\t \256\343}\234\b\001w&\036\217\253\320u\036\307\231\362\313\362Y\374\201\f\004,\006?\017A\346\001\026\333\277\276\213\262\275\353\221\fK*\021\267\345\006+-\3566S\203\276\002*\272(\330\267\221\322\364\032"
+	.ascii	"\252\322i\3010\253\255(\331\032t\346Y\032\341&\342\321  \242"
+	.ascii	"\316jmq\005\203\004f\243@D\313\235\261\330\323\331\t`\020h\215"
+	.ascii	"s\2570gT\270xSd=/<e\265\251\250\275\256\371\004"
+	.text
+	.section	.gnu.lto_writeJournalEntry.46.aec462b891bff969,"e",@progbits
+	.string	"(\265/\375`x\0035\031"
+	.string	"\326\257\244G\260ZM:4\261o\205\027\34654^L\333\223\345D\212;\374l[\3456V\307tA\324\311P\233\376^\347\036\210\bp2\321ZFo\307\361\250\217\366k\352+\234\314\217\203,\",{\271'\2505i\233\020\271S\n\224"
+	.string	"\202"
+	.string	"\223"
+	.ascii	",\300\232\304!G\204\252\326\032#\300\177\017\250\323\bV\035H"
+	.ascii	"\2243BU\253\216\301?\207p\223q\006\351\341kr\030\234\232:\224"
+	.ascii	"dJ\303\222&\f\021$\324\256\304\305k\252\355J\217\n\213;\222\332"
+	.ascii	"\227`\314\232:d#)\200\377j\346\247}#?R\273R\214\333\324z$\245"
+	.ascii	"\253\025\327\300\020\300\177\306\375\206\376\003\037\200\376"
+	.ascii	"s\315\006s\034R]\r\tB\304T\246\326\372Z \257}\326\374\357\316"
+	.ascii	"\"\213d|\256.\324Z=\311\"\033\367\336v\002\333'\354\355\022\263"
+	.ascii	"\357F\357\004I\221!\305\b"
+	.string	"\315\322\364\013hk\277O\222*oF\266Y\3328\333\334\037\366\275\272GvkZ\2475\355jM\347\\\351\307y\323\177\363%\277\315\225\3744_\372\001\274\311\337\n\247Y\3414\030N\257\302i\332\232\376v\332\013\247\2675=[\323Gp \207\025\025Uj\245Q\236\251Q\337S\221;\375\272\263\346\332\367\241\034\312\016M\373\223C-YB\232\035\376\373s\3379\364\235\374I\355\272\2733\320\222%\311\026&U[\236\371H]\253\263\364\013Q\016\333,\375}\2449\353Z\312t3\262Ay\366\335\206\235\234=\324\347\020\034X\214\216(\021\2303\327a\002\022y\340\306\224\"\002\363T>\001\tg\355\017 \346IO)e\324\227\333\275Yo\277u\315\365\366\255\335\335\231\nCT5w\f)F\300\244\027A\377\364\035\t\260\326\241\223[\226w\024j\22701O\316\035\260\303L\324me\330fm\030\315\332\261\357\\"
+	.string	"X[\366\035\f\357\260x|\355(DZL&\322\230\030[\331\213\236\321\203\005\301Px\343\f\266\"\305\367C\353\031EY\213\325\317\fhE\231\017L&\006\215\240c\016|h\"\220Lfb\326\223\342\207\026{\375\364\300|^1q|9@`\032\220L|\005\321h\342+\304\t\335\253{DBG\224\320\332<:\261\360j\365a\341\272\237j\211\265\177\372\027\036\005\\j\275\235\364\247\356%\203w!\377\354\303CO\362\320\177.\232\262,\253.\202\202\313\332\0067\243\325\322\005\267"
+	.string	"\323-)gWk G\244\263t\037C\250A@\210\fC\206F\002\232QX\244\034\003\200\002\021+\263\r\020hw\232\264\001\nf\276\352\030\316\352\255WD\217{fS\205C\245\355\360\f\367\246\266\"1\253y\017\260\3441\224R\326\373\024\244\243\327\256\305\002\350F\353\325\306-\031\372\213\036\366:\224\350\333&4\033Xn&\373\024\237_`F2\206\373\341\273\240\301a\321\"\033b?K\267\351\333b\311\025X\356ix}\021\b"
+	.ascii	"\241\347\\\222\235o\366\004x5\006?\224\006QP\246\305\241i"
+	.text
+	.section	.gnu.lto_writeChangesToJournal.47.aec462b891bff969,"e",@progbits
+	.string	"(\265/\375`,\ne9"
+	.string	"Jfd\026A@\246N\007\261\003\371e\2145*\016\255\250\2040$,\2438\027\007\017\217AxlT\210\021\203\260\343\255\234O\202\213\002|\321\217\271\337|\223Y\035\345\214s\261\207\347\003\205\322\322'{\357\275\223L)V\001?\001Z\001\335^\306\325t\017\373\206\337\365\003?B\323\234s\232\356\241\327\265\243\351\241\031?\023\346v`g:\374\324\221p]\211\275\321=\364u\355\016k\217s1>\347\321\036\216q2aN\227\340i\t\315f\023\372L=\270\276>\251r\257\003?\320\f\016\306\303\2049\024\207\232\321\2409\231b\nuFp}\305Pgb}M\340J\254\257\016\227\343)\t\315e\025\002\371\340\246|\355\006\256\257\355"
+	.ascii	"BX\277\016m+k}\300a\222\231\346\f\265z'H\315bI\263\363\303\222"
+	.ascii	"f\367\347*\324\333\375\327\223\212HGD\243a\221\320m\331U5>~\333"
+	.ascii	"\223\236\024u\365-p\352\346\3056\251C]q\036\301Hk~\004\265\344"
+	.ascii	"L\315\211\252\024\340\232B~\305\251\2462\225Miz\237\023\t6\222"
+	.ascii	"\272\324\224\017.p\311\331\232\017\325\001lk\201\336\3474\242"
+	.ascii	">\345\3611\207fK\\T\004\252\317\351\206\205j\273\243l\212\367"
+	.ascii	"9\323T-A@6df;\260\333^hr\206\346-\021g\207fL\365)\347\354h\306"
+	.ascii	"\360\212\335\\u147\372\025\347\223#\263%~UJmN\220\241\231Re\252"
+	.ascii	"\303\204\217G\035\3770[b\334^\31097n\232\235y+y\267\223uw\216"
+	.ascii	"n\241\200\"@\264G\001c}\245zW\343\005\310\340\346\250\304\201"
+	.ascii	"\021\303\203ng\217\\\035\373O\365\221N\270\351\273G\220\300\336"
+	.ascii	"T\337\321\270\033\250\227$\020p\371Q\274\035f\353?\273\363\016"
+	.ascii	"\331\031\244\376\263\335\265\332\004\001\215\317\346{\376\217"
+	.ascii	"\233\264\327\361\276\267=J\2270\201\275i\202\365\365\037\201"
+	.ascii	"\033\232\030\036\364\226>\221B\371\177\366\313\372\257\230\323"
+	.ascii	"\263\304\202\255\204\273O\240"
+	.string	"\300\336\364\367\250\273y\362\222\004\002*?\331\rU\342\177v\273'\237a\250\364\263u\027qg\025qc\025qC(\342\276*\342~\320\200A\021\267U\021wU\0217\325\002)\005\016\347\035U\304\r\325\270\003\270\033o'\267\363n\002\340r\336LKN\347\255D\304m$\342N\"\342.\"\341F\"\342>j\334\304#\334FD\334C#\334EE\270\205E\270\335!\356\266\b7+\304\2756n\265q\177\343v-\nI\324\216H\211\363\177\320\\6x(\363\255l\250\270\033w;w8w\250\273\234;\235\263\335\336>\307\365\274\374MSy\305q95\374Mc\265\325\300{\323\022\234D\337r\316\322)\033o\363\345w\335\016)\364\366\025N^\267\247\261O\266\360\215\212~\370T\302o\234\344r28\277X\234n\260\350}l\213\022\221\360G\030\"\323\005M\f{\235\213y\245\2709\347\227\312k\005{\263\231"
+	.string	"9\215B\244s\303@\256(<9\213y\223\220O_,\013\360\344\234\265\n\271\241WK\277\\\336.]\330\354\235\367+\346\350\264\317\276\373\336R\337\2763\333\003\271\240\030\357\2277\016\277q\254\257,\366\302\005P-\016\355\200\220A\323\"\027\300+p\227^\352\311\024$\315\201I\n\262\243\325&\b(\374gg\025i\033D\t\032\373\r\263\025\202\013\233\032\\\023\323\006)x\230wF\337s"
+	.ascii	"O\326j\253\304\001\315\036\363\316\350z\002v\351\311\374l\271"
+	.ascii	"9\217y\263\235\217\367\301\240j\330b\275\271\305\372\332T\240"
+	.ascii	"\007\027'ss\226X\320\325\234sv\377\331Z\364\350\260\356/\333"
+	.ascii	"\352\n\340\231\236\314\323\270\260\213^\032\226\301\267\272."
+	.ascii	"\275\322\223u\3237\330\020\310\317\335X\026%\036\304\355\322"
+	.ascii	"\257\317\3401\2411\265\252_\337\323x\324\220B\312\277h\242\037"
+	.ascii	"<\344\034X\253\257z\266\017\023m\350\034X\250\267zo\343Tb|\346"
+	.ascii	"\376\350\324\006\f:\007\226\352\241>\200\224\211\246\304\203"
+	.ascii	"\355j\272\203\373}ps^b\265\337\t\375\242\212\006\230\027\322"
+	.ascii	"\205\n\344\321\306Q\006\027\222\213\206\001\027G\344\2638\"a"
+	.ascii	"\200\3258\"]\026G\0273\270^t\265\310\243\f\256#\322\306\227\373"
+	.ascii	"\365u\354\352\002\373j\273\253J\206\027\222\306\361\250\302\005"
+	.ascii	"\214\0263\274\272\254f\300\340\222a\325\205\374\262\252\"\320"
+	.ascii	"^4\216H+\033^^H\253!T\314\237\255\333\2625\346]1\352\211\202"
+	.ascii	"\321\250\320\365x\237\274\350\235\352{\036\340\003|_\020{e\343"
+	.ascii	"Ps^b\001P\016\017&\375\263\275\0166\362\3720\201\333\350\335"
+	.ascii	"\333\240)7~\324;\"&\033%\036,3\276\337\021\004\r\314\302@^!\202"
+	.ascii	"\252L\001\227\237\354+<\345\355\375\207\365<\345S\356u\036u\207"
+	.ascii	"\342\007\227\323\212G\013\276\025\034\366\033f+\252\315\t;q\231"
+	.ascii	"\323\0335\361\347\22071\244\177\266\323/x6\320\364\357\350\n"
+	.ascii	"\037=\322Oy\361\223\336\337\244\275F\2607[\315i\237\354\007\237"
+	.ascii	"t\365\017\336\365\\\265\3427\325b(\n\341\213F\336R\366\352!\274"
+	.ascii	"\223t,\221RN\277Hp\363]\273z\227\343\005\326\340\224\375*\301"
+	.ascii	"<^&H\357{y\300d\375Q\001\274\250\3779\326g\341u\007<\026\002"
+	.ascii	"Dc\275\3431\0203\006\n\221\350D|\227\272\227\251\031\341[\002"
+	.ascii	"\311}P\243\246\302\3037\372\200\265\250A(\003\025c\n\321\210"
+	.ascii	"\310\210&I\013\007P\002!SfU\007\022\200F9\307\245\033I,\205i"
+	.ascii	"?\003\301\bR\325J\"\342+\201\320\032r\355\247\304\032\226\327"
+	.ascii	"\023\325\374\335\325dS\353'hx\256d\343\0051}\030W\327\f\270\200"
+	.ascii	"\326\016\373!\203\246\024S\311\005\220 \021_\266y0<\334\221\326"
+	.ascii	"M\303\356\272\212&\320#\327\251\034\315\364\304\023\312h\302"
+	.ascii	"\255\355\312\244\031\027G\004\2367\002\244\033\2751\377\233\321"
+	.ascii	"\207RZ\025\261\356\245\3312\2259\314ka\266\305\273\372X|\034"
+	.ascii	"N\336\376\033J\177\250\303\257\377\316\306i?1\304Q+#\343\312"
+	.ascii	"\350\2566l\037Fy\310\253\303\227@;\007L\200\310\316\017\271{"
+	.ascii	"a\235\204^j/\306\3671\255\0373\223\242\245(\030,\352\371R\t\317"
+	.ascii	"RP\210\025\320\255@\353\362\334\306v\221\200\317\377\257M\027"
+	.ascii	"\367`Nv\361\261r\201\237\004g\277\003\021\205\243T\262T\332R"
+	.ascii	"\213\3061\302\024\245\3658\2265\352\366\357@\363\313\270\363"
+	.ascii	"\351\034\242\035\245\227\032\013\251\354\203\3160\210q\020\304"
+	.ascii	"1eNK\320\300.6\334\210,\232\360UZZ\300\265H\024\266\324 \341"
+	.ascii	"\240\307\363\301\230\347p\305\0320;\342\374h\204\346\177\277"
+	.ascii	"\346\001\020'pO\344~\205\367I\016\214\237\017\264\207c\032\260"
+	.ascii	"x\030T\024n\333\254+\246g\314\005.,\253\356o\255\2215\206\320"
+	.ascii	"\021\202\210\206E\b\2769\260\250\\pQd\n\271\212\021\324"
+	.text
+	.section	.gnu.lto_writeConfigToEEPROM.48.aec462b891bff969,"e",@progbits
+	.string	"(\265/\375`$\003\305\026"
+	.string	"\246\352\221J\320\360(\035\b\022F<\346\035\275\374A\376\262\217\204\363\2326\237\217\330aR\310\327]\035d\301I=\367M\341o\210\373/\f\372\013\2534\316\f\005\3650J=0\267\323.\020<[\200\224\002\340Z\300\253Cb\t!dK\231d\200"
+	.string	"w"
+	.string	"y"
+	.ascii	"\365L\035\334\003\343\301\225\355\016\375\354P\357\363P3qTkU"
+	.ascii	"5\207\355\323\363+\262\354%i\032\305\020\244\315\262=\2113_\206"
+	.ascii	"`\200\2619i\242\250\032\212\252\265\322\360H\003\300x\231\241"
+	.ascii	"\006j\255\357\265\260(B\346!\025\311\375\304\274\310P\343\274"
+	.ascii	"\207\214x\261ap\2249-q\026\270\251\bQ\n\243\016\034\215~\270"
+	.ascii	"\200\260\235w\276\341f\314bI\255u\331\206\203\371\002\370\356"
+	.ascii	"\002\355n\311.'\005\347}\224Qt\"\021\315\332\334=Mn\335\356O"
+	.ascii	"+J\002\332\326\260\013r\362(\277\363%\277\373\232\316;\236W<"
+	.ascii	"ox^\360\274\364\274}^>\357\007,\310\311]\300\371\3203\316\352"
+	.ascii	"\362[\252A\240\n\234\357\374\273\363\356wOb\337{\211\237\262"
+	.ascii	"\357\254\017\212vV\234\002%\0245\301x\020\365\217\360 \375)<"
+	.ascii	"\370\363\266\\\022\004\262\357VP\346Y]H\224\316\335Q\r,\374["
+	.ascii	"\376\372\204d\203M[\324tf\374\373O\305\002'\033\244o\244\264"
+	.ascii	"\242%7\343\337\004\332\357},\302\021\242k\255f\330\335C\260."
+	.ascii	"\221\270cGc\tl\3352\247\316`\352\357\275\201O\247\346\353\324"
+	.ascii	"O}c\006\337\363\020'\247\346\353\367\274\354\333\276\326Z\351"
+	.ascii	"{\316\315\033T\270Os3k\363{\232O\r\235\360u\353v%|?\340\021\242"
+	.ascii	"q\322R\336\245P\201o{\007\261\224\026+\0263\021a0\326j\245\002"
+	.ascii	"\023w5\322r\275RX,\007\021N \240\270V*\224\023\223\226j\365\202"
+	.ascii	"\251F\b\254+\205\365R\305\\\256\227\252<\353KXzV\226\f^B\270"
+	.ascii	"\333r\361m\313.l\202hm\356\n\345~b\310\261?R\0267\263\256\265"
+	.ascii	"\232\250hj\017\017\001<6\314\0331\306\326\355{W\351\204 \275"
+	.ascii	"\364\324d\3376\244\275\224\226m\352\233\330\f\302\006[l\232\243"
+	.ascii	"6c\352\260A\237ZMB\250\201<\243\230r$\230\t$\222\n\263\260\206"
+	.ascii	"\003\260\002\2419\242\007\020xV\224V\326jM\341/W\310\214.r\236"
+	.ascii	"\033\316B\217\261IS\\\003\266\025\023\364\321\260\240\001\307"
+	.ascii	"P\303\001+\260\363\307;\b\036\035\246j\341\354\340:#V\253\341"
+	.ascii	"\354\326\257L\027\325\320=\253\273\023h\242\220\313K\2342>\017"
+	.ascii	"\321\221D\214\361\264\255{\371\343\333\310\317\3168\304\320A"
+	.ascii	"bO@\214\202.\037\bcRB\243\3417\020\2522/\235\373\252>\224*\231"
+	.ascii	"\325"
+	.text
+	.section	.gnu.lto_loadEEPROM.part.0.77.aec462b891bff969,"e",@progbits
+	.string	"(\265/\375`5\006-&"
+	.string	"ZE\030\017Fp\250M:\021E\232\324\204\021=\2011\t^\336\211\372&\001M\032\217\244\212\350@\021\255\021\007\225"
+	.string	"c\366\320mf\253\237q8CF\031\221\250\227\250\b\020$\375%\265\017a\240:\332\332\232\221m\204\020\262\345N2\343"
+	.string	"\324"
+	.string	"\340"
+	.string	"W\212\310\365\256\034?&\331\013\344x\245j\214\241aY\360\222\035\240/\371x!\363%z\237\231\2039}\371+\374 \002\016\342\203\b98\370c\026\217kuAqY\273\367H\364\262\261\330\204B5v\006\205jl\316\355\361\274\253\301\363v\272\034.\275\331\320\323,m\327^\220\257t\236=\235x,y\034b\226\235\200T\023\3630\247\272\273\222\"r]\356\274`D\252x\234M\247\322\206\244V\200\2346R\036\207\030\304\026\020RDLH\275U\335f}Tcg\217C\254\262\f\316\240\020xB\244\252(\001#R@~B=!\002\251\246M\247\322\316tQP\026\302\235\250\252\227=\325\262\022\271\255\302\250\036o]T\223\035p\357\275\226\327a\024S\255@\357\235\027\356\275\374%\2553\320\231\237\201\231=0\227\305^?\343B"
+	.ascii	"\032\277\314\315\240pp\344l\355\336%\306c\276\364\365\220\355"
+	.ascii	"P\217-*\315@\363\235\302\213"
+	.string	"NSE2\363\357c\200\350\275M\022\370a.\306\210\237\344%\267pQ/|Y\237d\276|k]U)nq-\325dm#woB\0262\215\373\b\263P\220\217+\003\365l\225yg\345\035ZY\207V\316\225\225qg\345\324\254|\263]\354\214\236\346\311\316%W\266\007;\367\263\234kY\371\001\026\354\330\025\357\345\221\364s\255J1L\236\345\007\373\311~\261[\346\363\271\274\013\177\354e\234\222}\371\242\246\t\007\364\245\230\027/\274\333\324%O\023\013\337r/~\030\330\227\215/\033:\276\200\241\200naN\277u\376\026\016\276\026N\263\340\3701\251\0028\006\272.\315\236\212L5\311\270\316\365\241\314\200\270F@\207\353\326i\353\274\314\300\3760k\270\234\ri^\334\272\213XkF\326\220]\301\265\221O\206\251KUZv\033\234!d\266\263\331\242\265\205\320\036\302\222\323\001m\006c\334\274qj%\037\267"
+	.string	"\325l\346\017 \352\205g\017M\241y\323\304\345\207\217\035[\033\371J\202\3749\313\2761H\033\263\266\331C\263\207\260\220L\241"
+	.string	"\352\331\274\233Y\304\210za\331Bc\272\3368\r\277\32649\333\310A\323\366\255\bU>\t\263\2736s\t\023\365B\3333\254\236Z\211\373u\315*\f\027\263\215h^\373e\257B\256\364x\325\3517\230\031\247\250\262\215|\"\233O\024%\310z\330\023 +\237(\nq\205V\304r\357\323\205A=\274\026\325\237\346'\231\265>? R\253"
+	.ascii	"\032\305@\301\342w\032\001\221Z\005\220\306\017(\343\006\020"
+	.ascii	"\345_\003\030GH2\200\300\"\243\026+b\034\375\210b\264@\001\203"
+	.ascii	"\350\2074\203\250A\001>\222\001D\"\242qt\204D\2242s}\037\341"
+	.ascii	"k9\007;C\260\262\335\0374\201\200\232/,5\223\032\257\215\\\245"
+	.ascii	"\3535\333\240\356\036\262N\250\331Z_\327\036\262Z\021z\357S\332"
+	.ascii	"\363\004\231\330\240\223\"\363\302\"\363e7\356\312k\215\275\367"
+	.ascii	"\336\235\202"
+	.string	"\373\314\356^?\354\226J\017<Ls\276\2420\325\244\016A\225\022\244R\313\216\356qr\373\2505\035@NI\223\263\251\3317\022)\336\320\266\365\220\331@M{\327\274\016^\tn\325\013\271\202\025T+1\237\016\214\013\231\203]G\303\360\222\327m&\374\241\353]\037\317.\231L\"\177d\346:y\250a(\207\f\243Fj\"\tdH\232\244\003p\002\231\262\0337\021p\271\205C\222\024\3668R\023\2049=\342F\3719\327Qv\246\243`\033\245Dn\221\017:'\314@\303\361\347\376\262|\235\240t\321\373\263\005\315\270\316\262\306\363\270R\334\234x\260E\335Nx\027\205\310\373\312-\264\347\354L\013\243\201\317\302l\366\267k\370\255\203\324\361\236X\231\342\311\032}\317\363\377\304\021\350\363\030\316\300\365\225\302`P\002y\330u=U\314G\t\207u\230+D(S\272S \260\020\347\242\321\375\316+\020\221\3126\327"
+	.ascii	"hx\246\251\360\360x\270\315\254<\304\b\340\013\346\232$\0214"
+	.ascii	"\203\262\002\2712\022\024n\374T\3375.4,[K\\\002\207\212EUN\033"
+	.ascii	"\370=@&Vx\242T\214O\361\353\234\302\233\241\300\034\255\372\315"
+	.ascii	"@\311M8\f\004\377-B\202 w<\016\243\ru\214\230\207\323"
+	.text
+	.section	.gnu.lto_.symbol_nodes.aec462b891bff969,"e",@progbits
+	.string	"(\265/\375`\227\004}\026"
+	.string	"\346c\206I\360L\247\003\230\360\307\023\0131\033\355\353v7\375\243#\376\353\005\177\213\2336\034\322\261J6Y\277\205\242,\262\375\005qX\034fj\006\236\201J\320\020fe\246\252\252\252Y\353\320Z\366#\360f\027[z\"\362\246M\222L2u"
+	.string	"v"
+	.string	"p"
+	.string	"o\263'\256\202\313\317:\360y\376T\265|]\262,\264\225/!o>\225G\261)-\037\n\314.\252\350\344OL\336\304\226\220\037\t\307\267"
+	.ascii	"\252h\344kV\344Mk;@H\203B\276\303\202\224\237\327\332\371\350"
+	.ascii	"#\300w#\352Y\331~\304\302\360`]\355E\254geee\231\037r@\\\371"
+	.ascii	"j\255.|\2368\n\265~\255L\270na\214\261\307\203\330Z\353\347\023"
+	.ascii	"\273\366\250 \245+\213\013\007s\367\220\202\tgi\341\261\364\305"
+	.ascii	"\353+\325\204\240\004\035#\267{\230j\360T\202\336h\tzN;\207'"
+	.ascii	"\236\004\266\345\256\263}D\n\020X\326\335\300\307\024\370\027"
+	.ascii	"\002\357\222\363\267\001/#\340gp\036\347\346il\336\246\346k\032"
+	.ascii	"\343p\2554\232g\351\2124S\277\254\242'%\363*\325\251\310\211"
+	.ascii	"\350\366$1\377a{g(\303\003\230Oy\t\fDl\260\241\355Q\322\031y"
+	.ascii	"h1`]Q\325\320\301\034P+\364Xn\317\351\230,\330B[O\002\211\217"
+	.ascii	"\320I\224v\235\314\035\327G\236\307\3651\325H52\200\034C\313"
+	.ascii	"\353\257<\273\356\312\345\365\346\315\256w6\257\333j\327_)\n"
+	.ascii	"\346\231\314]\235\22627\333MP%}\200e\370+\367\255g\n\345\200"
+	.ascii	"\271NW(\241+#\207\271\331\202\271+\365\205v=!\244\373\001!\035"
+	.ascii	"c\327\365\bc,\222\356\312\265c\214w.\351\275\353\330\205)\254"
+	.ascii	"\214\222\252\245&\221ts$]'\334pS\334p2\245\215N\242\036\243\223"
+	.ascii	"\247l\364\361l\025\244\324\201l\364\233\353\366\301\273#\330"
+	.ascii	"\3507\233\243\307x}\201\2344\324F\357\034ltS\034cJ\240\210p!"
+	.ascii	"\272N7Q\317*\004(z'\265]\021S\250Q\f\b\263\326L\215\202\202\024"
+	.ascii	"\325\030\240\002\251!\343\016\021\2600k\0242\"\022\t\211\004"
+	.ascii	"3{&\320U\316\371@\261K\213%\262\342\244j\3663\001g\226>)\355"
+	.ascii	"\021\364\023\222T\rQE\267\210\234\027k\273\201]\211I\013@\215"
+	.ascii	"iw\221\022kB\363\300$\222\356\036'\214\306\004\242u\327\002\204"
+	.ascii	"\377\322\036S9\266\230N~/\322?\327H\256/d\013t\302\274\275O\300"
+	.ascii	"\031W\017X5\312[S\361\261]d\001f\275,\026\003\253p\215\341\371"
+	.ascii	"\306!?\007%\372D^\017\3462DZI?#r\366\355r\354\250w\234\264kV"
+	.ascii	"\331\016\254\264G.\257\006"
+	.text
+	.section	.gnu.lto_.refs.aec462b891bff969,"e",@progbits
+	.string	"(\265/\375 \3635\005"
+	.string	"\242L\"%\220'I\007\377\377\377\377\377\377\377\377\377y\340\fh5\342\347\377\337\354\1772\364\t\261\255\021K\332&\204H\231\002\317c\002\316\320\270\002\353\013\253'\367\006\354\213\373\004\353mu\243^\250\215\366\247q\266\025\346d\325,\200VX_Voc\342\254\b("
+	.string	"?\254\243UDO8\370\302\256\334#(\236\334\005\354\003\307\225\342\351\336(\336\343\001\261\301&\276 \256\260\037\260#D\354\206On\244\221{\242O?\326\364\304\316\277!\t"
+	.ascii	":\231\250\246\302\222\036\273X\367\305a\225S\211XU\020\375\034"
+	.ascii	"\274AQ\002"
+	.text
+	.section	.gnu.lto_.decls.aec462b891bff969,"e",@progbits
+	.string	"(\265/\375`\301*\235\266"
+	.string	"*\024\325<W \016!\235t\375\274>:\245\266\363\231\344\265_\373\210\334|\240`\377\366\341\212\315\314U\337l\356xx}\255N#\013\353\025\271\361*\353\026`\301\313#p\220\202[8h\242\b\033\320\273tA\025On|\320\r4\235\213\322\370d\021J$\260\225\337\037\325\330\336R\2463\003\256\003\337\003q^~\264\345X\270k\341@\244D\201\013\013\036k\341.\334\006\225^\026!\240[R\363\302_\270\311x\357I\357\005\313"
+	.ascii	"Go.\217\353\327\205\313\315\223\0253\216\332\362\026n\246!M-"
+	.ascii	"\261\343&\337\275\356\346^\016:GA\306\\\265\345\272kQq\\\201"
+	.ascii	"\324\366^^\366\237\306\272\200\242\265\366u\236\217\234\375\201"
+	.ascii	"\261\316\263\217\363\274\343\3749\316\212L\023\r\217\255\255"
+	.ascii	"x\365\333Z\022\221\324\271\303<\277\r\230\247\n\267\331h\351"
+	.ascii	"\021\265\327\226\251\200\365\314 1\243\342\321\366\374t\236\215"
+	.ascii	"\244\354US\346\314\227\324\f\020\236\360Xm2\317#$Kw_\037\204"
+	.ascii	"\300g\f\306^9\307\235K\364\006\305d\25636\343)5e\236 \025uw\357"
+	.ascii	"=+\371G\234\317\230\t\213\325&\363&\211\200\024\240\n\336\327"
+	.ascii	"\214\274{"
+	.string	"\3234fc5F\3435n\362\3319\n\2271\3279\275J\020=\277+9.\256\033{\236\3425\202{\223\367^\fh\322\234\254M\265\375\210\263\024\236_\023Tzujv\220\311\240k\373\026\316\037\363\220\37545k`b0\333\036\004P\272j\214\022$m\277\302\371\024N\016\343&\334\364\300N\316KX\311e\220\351MO+wQlm\177\302y\366\360\253}}\354\341w\022g3\317o\007\002\347\006\254\341\307G\270\213\233\032p\222\177\020\302\353\261\353n\335\233\352\340\360\021\341\323k{\020\3163\222o\350\272!\374<\317\032\374\270\2175\370\275\317\017\254\341\347\001k\370\375\\\344g-\336\362P\225I\313\013vo\232\341L\2221\331j\373\2245\374N\346\371q]+\340g,\335\201P\203h\0179\022\360W\f\374\314\245\021P\365\233\277\002\031\330\007HR\363\200\277z\340\347\025\3766\200\032\013O\302-\272"
+	.string	"\013\370\231Is\360\277\203\nz\203&"
+	.string	"\007\016\376\232\200\237\315\312Z\203\2779\374-\200\237\005 \243\003\360?\2573\370\027(\335\323\030P\351\ro\255\341\003\177_\320;\255\363\263\t\177\343\364M\327P\340\257#P\375\376j\001\004\260`\314\317&h\232\013J\370;\314\231\030\016}\266]\343\374\275f\377*\202\237\221\332\376\234\354Z\363\327\022\335k\312\346\r\334w\002\3745\203\f<\206\303l\370+\317\341\324\016C\n^~\236\371\371\304;\b\376\263\360\337\303\177"
+	.ascii	"\234\303\007\360W\233\252\201\237\273\374l\3673\335\317p?\267"
+	.ascii	"\375\214\366\363\224\237\315~\036\3739\354\347\254\237\203\374"
+	.ascii	"\314\374y\352\347\253\237\253~\246\372y\307\3179~\276\361\263"
+	.ascii	"\215\237[\3709\352\347\031?\277\370\371\351\347\246\237\227~"
+	.ascii	"N\372Y\305\317E?#\177\276?\263\340\347\025\374\354\302\317\302"
+	.ascii	"\237/\370\331\346\347\376\317\367\237\312\317A?\003\375\027\376"
+	.ascii	"O\362\337\311\317*\374\374\341\347\023\376C\371\217\200\237K"
+	.ascii	"\370\231\177\236\300\317$\374<\302\317\022\370Y\203\237{~\306"
+	.ascii	"\340\277\225\2377\374\234\341\347\233\237\353\317\377\337\367"
+	.string	"\277\355\377\326\177\023\376\247\375\347\351\353\353\353\373\317\f\3742$\374\0038@9\224\350\332v\032\316\\\2301'm\033\215\275\372\232\224Z\332\366\331\355\230\311-.G\333{\3411#B\240t\264\275%:\377\376\177\367\262\220Io\023\321\315\217e\030\207+sPG\220\273\327\b\017\274S\210\030r\3067\270\037\356=6)\2338\216\031\224M\344U&is\312\240L\357\r\fns\352*\323\345\321.\217}\323\233\304\341t\223\313\343\2202\275M7]\036wn\322iG\231\"\217\312&\016'V6\227N\031n\362\036o\022y\343L.\235\224jK\247\035e\023\351\244L\342p\342\233./W!Kq\034\215n\023\211s\357MJ\231\307\233{\221M\367\350\326J\027\307\235\322\255q\271\215H:u\357\275\367\b&'\265\244I\211n\233\022ky\302\350^\271\253\304\200#\037\217.\321\221\3575J\233\356%Z\216"
+	.ascii	"j\311pGM\027\347&\221IDR\313\033#\242\345\321\305\272\301N\312"
+	.ascii	"\246\324r\004\024\257&\363\022\245Gf^9\034Mg\363\230r\027\234"
+	.ascii	"f\025T\222\334\331d]\255x8\307\0249\031\323H&ZXIm\337U\r\205"
+	.ascii	"\370#\206W\333\236%#\336O\352\0233\243=%\315V\322N\354\261\353"
+	.ascii	"\0367\320\004\252\003\234&*\246\316\332\276\235\374\275\244\231"
+	.ascii	"$\373\311F\\\215\266\0356\342\335\344\206\353\312\f\245\266#"
+	.ascii	"\3641\317\317\336\233\336\212\006\366\345\243\371\246\245\255"
+	.ascii	"W\217\315B$\004\nX7o\324\350\242\342\260\032I\3272\305\251\310"
+	.ascii	"\027kb)[\017\2655(6Oj(yj\233\2462VR}`\332\210V\262mN\312VK-\371"
+	.ascii	"\232\352\253\234\344\316M^)\271{\323\342'/\3436\260\022\202\024"
+	.ascii	"\201\241\263\232\253\213\364V\023\351\030\270\331Z=\004\204~"
+	.ascii	"\241\261\264F\264\026\3135\026\327\326]/\265\032\307\313r\222"
+	.ascii	")\007L`le\335{\265\332F\273\370 \f\004\b\020=:\\\340\262x\331"
+	.ascii	"\261\2578\316\327\250\263\201t\020n>\255\205\334\"\201yA\255"
+	.ascii	"\355k\213\363-\340\247\375z\264\025\267A\2250f\244\257:GS\345"
+	.ascii	"$\323\353\304\002\030\214\255\037\315\344f_\335\246\3676i`\200"
+	.ascii	"!m\371\331\267\325\2338uQR\253\266]5\342\355#\002US1\264\255"
+	.ascii	"\235\345l\035\275\203\233\037\232\307\373\006\177\235&\231\336"
+	.ascii	"&M\\\227(\260\267\363\374\341\247\303\037~\357*\347\033\355|"
+	.ascii	"K9\337d\247m\353%5:\n\206\"Z\326\332\322\340fG\275gtT\313\350"
+	.ascii	"q\207CCi\207\235\265Fb\364\n\231*:\314\276\240\316\254\023\220"
+	.ascii	"(6\030.f\264\314\244\300\332\266\213\356\247~\361v\321-n\222"
+	.ascii	"\355\302\336\213d\356\220\303\334A\246\314\n\211\204\b\013'e"
+	.ascii	"\232\201\223?\302\272\3326S7\275\235z\351\266\023\003\226\367"
+	.ascii	"\"\333Ig\357^\244\016s\007\346\0166\006\251\037K\260\224\222"
+	.ascii	"\246r|\371\321\266\221\322\034\244\251/H9\316\377\255l\025\334"
+	.ascii	"\354\025o\243\024\204\"\366\312\251\367\326\350\013\241W\364"
+	.ascii	"Qz\231f\244\224Gc= @\314t%\345\355\370\3317\215\263\225\347\337"
+	.ascii	"I\242\037_\214#H\210\032\271\242\b\236X\333t\353\206\211\251"
+	.ascii	"jy\324@'}\241\364\276}UmK\023\257-_\212\024\203\t\230\336y\336"
+	.ascii	"\202\3438\271\267+le\213\312\0205v\313\302x\334\006\265s\223"
+	.ascii	"N\262l\345\261\034[\3119f\270w\212\215yo*\206\307\360\036\207"
+	.ascii	"a0\254\307M\316\343\2713\026\246K\346q\033\017\022\266\326\356"
+	.ascii	"\356MA\330\004\257v,&\327\004C\223\026\027W\351\364\226\324\262"
+	.ascii	"\332.\314Y\021,\257tu;Zb\350j[\347\032\317\n\217Y\244m\225\273"
+	.ascii	"\035\277\241M\311h[\257\274l&\215M\312F\0247\267\n'6\323\342"
+	.ascii	"E\223\336\333+\\]M\230)+\2244F\324\324j\033\357\244DY\316\356"
+	.ascii	"\230\306\235T\024\225\3276k\004w\305\327\266\262u\333W\224\346"
+	.ascii	"\013m\353Zc\2353d\0341Q\241\241\245\321,\0259\242\322\3664-"
+	.ascii	"\246LQc\342,=\231\322\324%J\224j\366\232\2745\330\230:W\216U"
+	.ascii	"\360\312^\315N/+)\311\266&[CRRs\342\244\216\365,+\0264\030[y"
+	.ascii	"?\274\353\243\013\312\353\330\217#\267\344\316F\333\372\244\333"
+	.ascii	"t\226\346\252\352\332V\261&\212\003\023\206\345\364\212\3415"
+	.ascii	"\215\241\206U\267\023jy\334\342\001\020\025R\\yW\t\365\301\206"
+	.ascii	"\b\226!Q\222\274\206\2752\371 \204\227\205\3111y\264\255K^\225"
+	.ascii	"Pu\361RV%?\r\r\220,a|;\316\372\265\200\216\022sc\317\213\207"
+	.ascii	"\233\325\013m\233_\366\253\315\0334(y3\332V$\267\303\t;\302\203"
+	.ascii	"F\355\222z#j[\217\344\214\035)I[\236\225\353\325\310Oc\303Uf"
+	.ascii	"\364\006u\326\255\327\":\226\332\334Zh\37547[|\274\350\321\366"
+	.ascii	"\347\322\371\363\350\304:V\315\352YV+O\372\240>\310\344\365\275"
+	.ascii	"\351\2500\274f\351E\251h[\207\360X\323\006\232\230\266\365\205"
+	.ascii	"\333\031\223YD\250~lL{b\322\2024k\220\246\"\001\354\"\235>\224"
+	.ascii	"-\365\360\362n\323\224\0162X\265\301\320\203\311\254Ib=^\034"
+	.ascii	"\331\362\364\342\264\262\252W(\334\337\227\022\03291gYm\257x"
+	.ascii	"\254\246\352\210\321\215\266\237AVU)M\311BE\265\303\n\016\254"
+	.ascii	"L\206\224s\307\216\232t^$b4>\374\240\230"
+	.string	"D\350\302\244j\016\251Z\364\273\227\323%SS\235\252S\265\350<2\225\021\250\017\347\225r\306\227\266\377\0359\377\373q\276]p\275q#\207\210\356g\303F-:\227~\310\250\250\235\364J-1\373\205\270\263\271:(\250:\203\004\250\256{\314ycZR\313\273\227F\007?\274404\270O\306\213/\210^[\031\217q\263l\342\032qJG\016\300b\211L\355\305\213Z\224\201\026(\231&,X\324'\006\233A\332\253-^\237\\\320|\335i-9[*\275\350jj\326&\036\353\3646\255\260v4\226'\003d\251Y\227\332\005\033\221\231BB\252I9\354\270Y\223\334\260\256\226@\325\243zTU\260\025\265\243\261\254\252|U\341bf\313\026.\231dM\326d-:\211\352\356\345\265\b\210\020\251\2440Hd\023\365\354\334$\022.\246\334\371\327\333\254\267\211z\322\313\302\346\255HS\332\301m\032\037_\357e"
+	.ascii	"u\353\\\215\243\261,+\026\246\367>`\316\210}\211\271\323{\357"
+	.ascii	"\311\\\331\362\364\242m\213i\336\3355\230\231#,_\336`\\\320\030"
+	.ascii	"e\341\233k\333H\302R\027m{K\343\315 \235\025\321\201\327]TPq"
+	.ascii	"\271\343{\332_\246d\221q\341\271\034/_t6\222\324\300\372\222"
+	.ascii	"\03427\327u(\350|9\321\362\256\353,76\274D\021u\226\312\206\247"
+	.ascii	"'\226\205\216\306\222\222\036L\205"
+	.string	"\243\374\227\215\207\327\027,\347(J\031'/ fUq}\245f\311\225'\256\25082\356\262\267\206k\262\3632Uh\342\343\3566=up\353\342|\233\265\224\367\224Oi\267\363\336k\325\003\252\351\303\337U\336n\377\355\255\200\321\245m\257u[U\222\276\2636*5mN\307+/\234.=\251\333\266\331l=\344\377\031\345\307U\213\266\255\306b2T\001\302a\260HD;\0204D3\3643\016\207&\250\0204T\177\"DQD\220\b\304\301f\006\b8\314@\320\320\357\002\r'\212)P\230\b\022\006Q\242\017Z\004\022Q\002\234(\006\205A\023\0334\374\004\321X\024\201\002\245@\361#\f\212 \026S\210\330\200\002E\n\241p(\2341\372\374\\\030\022O\030\207\302\031\023@\024\205E\211)\206\354\220\320\217\020*\364\373\211\020?\304\037\021\302\241\220\320\360\247g(\205\217\321\030\374\371\361\021a\304\017\361\007"
+	.string	"?\021\"\003,X\240\204\b#\032D\004\0327 \201\022\207$\204Pc\021\005%tx\214h\020\317\220\205\"\032$\004\236 Q\f^`\f\n\20355\036\2040\022\201C!\200C\024\031\200P#\320(D\215\033\206,\024\203\204A\243\021-\241\241\310\003$D\211>AC>>\031\212\301\034 \22484\226\b\332@1X\203\246 XbG\bDQ\220\260\001\n\242"
+	.string	"v\240\030\344\021\002\177\2125@\250\321\030\024\022\032\222\3301\022\201\306\022$\270\261IA\003+l\240\002\025"
+	.string	"\022\006M\324\024\321\023?F`\nD\034\343\tPa\r\352\203\002\rS@\211)P\004\201&pfP@4\n+\200\002($\246\030^"
+	.string	"5\006\211.d\370O\220\210\n\321\240\363\f\020a\001\"4\340\0043\036\204\b\022\006\201\200\200C4\177\003\215\300\022j\214>&\360\024}2\240E`\013\306!\232\237\bAD\205\200(\321X\364i\201\215>\037\200\340\002\023Q\023&R\264\3603\002\233HD\353\020\2050\305I\034\032\201\302\240\020\0215\326\240\030\016)\340#C\004\236\370\261F\037\"\n\004DQ@[\360\371\t\006\001\205\316\016\220\3401\376D\210\241\024Cb\220\017\0215\242B@\"p\310"
+	.string	"?\302\024&\030\321\242\215\320D\033\321\"J\224)\372\240\200h,\006\203\320\025\202\206n\212E\224\b\004\004\234A\301\320\360\307\022\215C\325\350\003D\034\376\240+\344\234\203\017\207P\242\b\343pH\024a\0234\324@h\t~\200C?\243\217\b#N4\005\301\2425\372\b\203\206d\204ACU8\f\026\211\250\tf\214>\r0\n\203)f\356"
+	.ascii	"\007\220\330\200\003*\234p\376\204\020\032\022\207P\324'(hB8"
+	.ascii	"\374\021!\f\002\205D\374\020\213\"Bt(\006\001Q\230\220\261\262"
+	.ascii	"\243\231\312\302\032\343\243\322E\201[\273Q\325uX\232Q0\332Z"
+	.ascii	"\036\265\005\226G\333\036\226\352\226\307\231;\314\310e)\221"
+	.ascii	"\277\035]d\350\334\264\200\350h7\022\\\211\253\313Av\206\235"
+	.ascii	"\025\035\247\352S\035\243\207\004L*\314m\ny\325\351\314\230\224"
+	.ascii	"-K\366\306\036\226,#\033Kk\203\fJ\031\216\256hOT\374\250Q\315"
+	.ascii	"lr\017GQT\037\241a251\243a\225\3161\264\247\251\031u\206\216"
+	.ascii	"\024\251/r2\234~mdsI1\354\022\216\224!FU\240\306jtT\251\352\001"
+	.ascii	"\243m\214^W\221\027\025\216\006G\026\256(\026,\354\023MS\323"
+	.ascii	"\275P\021`\313"
+	.string	"\273kq\373\344\205\003\004\311\303\016\206\263\247\346kG\032\306\304\024\206Y\303<\317\030UgQ6\251\347f\213\306\225{\343\314\371\r\361q\004eE\203\3111S\242\001\327\326\032Y#\253\264\300q\310nI\315\036\335*\353\231\214\243 5Q\347o\213j\222\222\030<\244\222\265\210\002\\\222r\020\361\030\214\"=&\026YU\370\340\363\201\244\255\275\265\317\036o\357S{u\366ZHX\013\276_E\246K8\031B\222\264\255zu\357u\314\353\230\256cj_\337\257\b\334\327\317\202\001S\303\240p\254\311!\226\367\032FG\311T\025U\223\364\245fEi\212\245\325\213\223\326\302e\343\266\335\262\245v\351Y\3269(?\270\262\002\220\304\004\343\362\332\305FJ\022\246.\271z\305\311\207\326\233\026-\325\256Og\307\030\021^]\203\323\250\302\341DE\322L\231!\022\021\321$IZ\003b\n\020\204\"I\244\351\265\036\022"
+	.string	"\005MP\"\347\220\fI\222\244\275\003\244K\321\377u\274\210\034\f\313S%\266\374/\346*\201\274\311\2308\005TC\314\377\320\201{`W"
+	.ascii	"T\254\200\324 V_)\255\366\330@)\333\nr\334\272"
+	.ascii	"3\356d\206\330\b\027\364\311$\262\021]\341z\006_\274\256-\332"
+	.ascii	"\023\206\360\323m\005\210j7\345\025*8k\302\335 Z\362\251"
+	.string	"~\352%E\340\333)\272\226S\271\300]*\022\361E\260\036$\2638\021\320\002\006\031VI\200\261\265\331\331\347\266\250\317\372\210\331\022\026\374T\345\311\02368\354G\004jQ\316R\210\210\363[\271\330\314z\024\376\036\235ISz\256\267{\213\372\351\203R*\001\255\227!\007\021\240\360\235\365\034\"\210\325\"\231\306\001\330\266c\017\031\200I\211;\252\002^\355\364\375\357\314\260\317\236\344@\3512\320?\256`\226\217\343\303\205\203^3\326/\255cb\337k2\032\020\214 \220\210H\004\304}\316vi\271M1\034U$*\223z\226{\362\340h$\353#rnl\346\327\241p\256\351E\366\003\314/\306(\013\262#\323\306\016\277\255\211s\304\223\315\365\373L\020\034\246\242i\270\264\320\212p\261\"\201K\267\311\237\266\004\177\352\034\341\263\217\232\202\275:\255\"\025L\231\204\023\3269\335\t\215\006\270&F<\212\350\225\351g"
+	.string	"g\336\005\330\001u\355\264\234\026\251\026\027Rv\217n}\222\311\316zw\323z\343i\231 j\023\275\306\263'\224xl\331\233\257\030\325p4\253)\322\305a\002MN\341\003^\030@\255\030\250EK\0269\265\204\255\373N\360\\\334\231\036\bEJf\324\302\\\205:\210\034\333J\032\251\264-\317#Ne\034\210\373\343ZO\207z+\273/\031m\277v\312\203ui\276\211'\020\354y\234\343\rT\212\361\273\377P\030\345:~\351(\317J\r\354/\212\036\314\357\\C\357[\035"
+	.ascii	"\340g\004-!\307\313\335c2|\240>a\313ds#[\017\342\177\323\334"
+	.ascii	"\025(\354U\245r\275\362\361\017\007\231x\247#p\204\374\233\b"
+	.ascii	"m\203\304g\236W\rq\313u\352\252qC\204\360\021UA\204(N\310\341"
+	.ascii	"I\362;\234?\221N\024\035\362KpB\204\245<\254t\367Y\246\235z\211"
+	.ascii	"*#\245\f_pq\262\304\312qQt\353\226\271\342Z\374\023U\343\376"
+	.ascii	"\307\274w\037\330\177T=q\031\320Wj\261\241\240\001\030\211\264"
+	.ascii	"[^\002\200X\017\337\240a\262d\351\217g\264\034r\233\213\314\242"
+	.ascii	"\t\024\370y\267Pg\253S#\\\263\270}\004\002\217\307#\203h-^N{"
+	.ascii	"\366\032\232\224\017\203\235\314\r\211\300\223\273\013\305\021"
+	.ascii	"\016\370n\002\306\214\004\234"
+	.string	"\220 \375\263\277\257<;\020\"\321\315\204i>ZBHZ\202h\330\253\260\331\205n\253!\325\377\265\303\261\326\\k\212\255+\212\004\270\t\007\221\344\264\211\023\006*\235s\313\254\201H\300\264P\224\263a\232s0\316$q\251\221\340\017\204\034Z,\231N`\237Ll\201\353G\243\353R\032;\276\234Z\306,\300\327D*\360\"\326\362\302't\375a\371\322\226\273\240\211\274\335\326\265.\211K\332\241w\274\037\211\216*<\202\034&\334\205G\244\337\016\220\263\251\202#\034!\006\252\340\301@\311h\262\3000\220d\021\266=\347\363\212OY[p\177\321X\215\342\2427&@\\\252\244\355\272C\233\332\261\344B\f\311\3206t?\233\277\261\257l\221Z#\227sh\231\235\233\307\007\347L\342SGSg\2674N\336\267)\375\207\203@\357\b\335\025\254pm\251\360\243U\246\303\242\264\003(\325\273\373v\3672\034K\"\213"
+	.string	"QR5\324\201\b\324:\001\215\332\272\214l\301\r\242&\241\274$Ch0\261\364#,~\215\263&\n\266\277S8S)\\\013\234e\315\341\3748FV\230\034\232\311\020\213\217\275\271e\201\201\025\nN\364R\314K\224\214\325\302r\342\212\255G$\331L\375\030VjS\024\243\335i&\235lS\315\247\001~\3465\376K\221\360"
+	.string	"\360D5\277\214"
+	.string	"\304\314\030R\275\220\021O\227\340x0Pt?\234Q\320\303r1F8\034\237P`\203T(\337\f"
+	.ascii	"M!\372\315\201D\262\3764\201\363J\rye\350\343 \370\005\315\316"
+	.ascii	"\3333\007v\005M\220O\266\007[\333"
+	.string	"7\026i\312\350\004\346\314A\r\200p\317\"\307\364\017\004\231\224\2211\277\310J\025\247\001\2656\256]\224\r\360\223\241\\\344n\223\344*\356Z\025\340\311\353\013\377+y\"\3669y\365\200\333\005Q\255\"TN5t\375\033n\n+\345\267\001\333v4[\273\314\023'\0358\311p\032\214!\255\331\2052\305\240\205&\277E\352_\224\200\223\304\361x\222\330oC\004\035YF\312\027\316\374\275\273\037<\037\035\0204\3371\370\231\206\367\363\230\332\001A\347\227\255D\254\274\275\210\034X\374\020\005o3\030\033\001\037\356\265O\034\"\2213\357&\013\3304\371\344-tc\232\261\224\253\211\334\b\031ll\200\214\313\212]\\\241\305~0\2303\251\241A0\203t\017\254\177\254\317\367@~0PI~ \335\346S\316\365M\357E\252\266+D\216\377cm\\\001';KsWV\022u\206\347 \251\226j\254\3078s\200JF"
+	.string	"\t\272i\374+\354\251\350\372 \347\246\247\345\037\271\366\306\221\327\260\373\321\356\337\302\016\316:\224M\002\275h\360\210u\317\275\001z\237\274\275\253\363\301\355\373\324G\273\276\214\t8\017\331\346\221\223:y\362\310\013\356<\247\316_\311c\217\3477`s\365\016J\370\005wb"
+	.string	"\257Pz\024\351\225\270\2078\017\341\332\246\207\237c\377\247^f\344\017.\207\016\377\301\323\364\367h\027\251\316S\221\311\364)w\304\271\207`r}\332\356,\371#\031\302\237%\271#|4"
+	.string	"\263S^\256.\373.\237|\276\366\376f=\303\300\021\346\027\356\211\264[\346\n\351\3467\327\351\265\346#<(\366'\326w\203\214\271\277\244\236\244?j\253\237\302\317\244MP\276\322\253\344R\305\007\240?e\2761\217\034'\301\234gq\340\3048\275|0\314\345\376!\355^\031\020\235\273\356\271INf\242\364\fF\303\tKW\034\325\024M\207\211\274\373\334>u\217\360\214\246\372\364\271\t\267i\372\337\210q\234\205\2433\277\260|>\342"
+	.ascii	"{\363\377\f\342\357v\217f\007\265,\340\223Vf.1Q\231r(\336fw\234"
+	.ascii	"\2576awp3a\375\315\345\367'\237\036\224jxo\210K\372\235\275\315"
+	.ascii	"\326\35552i\273\233\207\336\222w\221\235\355\373\306\\\270\274"
+	.ascii	"\025?\3577\022/\342\017G\226\311~\217`\221\215\313\263\021>\311"
+	.ascii	"\273O8\377d\033\0179[_\271\263E\300\265\320\227\307\272)\337"
+	.ascii	"\t\375ix\201\377\372\366\207\034\266t\246\334~\241\207\375\300"
+	.ascii	"\306\313\345\225d\r\327n\206\243\262/\310\337\310\372\356\233"
+	.ascii	"\316\345\375\336\036\334\255\331\006\214.\n6\365(0S\272\b\255"
+	.ascii	"\016\316\342\030@\036i\375\177No\242\237\301\356\241\341Q\366"
+	.ascii	"f~u\261\361\0344\254\304\324\342|B\236\325\016\212\363\020\232"
+	.ascii	"}9\264\256K\227+\275\"Le\321FbYk\005"
+	.text
+	.section	.gnu.lto_.symtab.aec462b891bff969,"e",@progbits
+	.string	"initEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"isEEPROMContentValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"getEEPROMConfigSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\001"
+	.string	""
+	.string	"loadEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\001"
+	.string	""
+	.string	"writeConfigToEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\001"
+	.string	""
+	.string	"eepromData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\001"
+	.string	""
+	.string	"__pg_registry_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.string	"__pg_registry_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\001"
+	.string	""
+	.string	"crc16_ccitt_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\001"
+	.string	""
+	.string	"config_streamer_write"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\001"
+	.string	""
+	.string	"config_streamer_finish"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\001"
+	.string	""
+	.string	"config_streamer_erase_remaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\001"
+	.string	""
+	.string	"config_streamer_flush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\001"
+	.string	""
+	.string	"config_streamer_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\001"
+	.string	""
+	.string	"config_streamer_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\001"
+	.string	""
+	.string	"pgLoad"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\001"
+	.string	""
+	.string	"pgReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\001"
+	.string	""
+	.string	"failureMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.aec462b891bff969,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,531 @@
+	.file	"config_streamer.c"
+	.section	.gnu.lto_.profile.e868398ff4e51272,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.e868398ff4e51272,"e",@progbits
+	.string	"(\265/\375 \342u\004"
+	.string	"D\006\326"
+	.string	"\013"
+	.string	"\253\332\330\232\013"
+	.string	"\001\224\244\312\215\001\006\002"
+	.string	"\002\001\304\314\304\251\017\004\002\002\003\206\360\244\357\013"
+	.string	"\004\304\250\326\314\006\f\003\002\002\001\005\222\351\256\307\004\020\004\002\004\002\005\002\001\002\006\210\251\332\260\016\002\007\355\300\261\313\n\n\b\224\310\305\217\001\002\002\002\001\t\200\331\354\210\003\006\n\240\342\234\212\n"
+	.string	"\021"
+	.ascii	"\002\303\370\2620\207\271o\030*)\004.al\006\003{A3 \300%\340"
+	.ascii	"./(\033 U\224\314\301\357J\330@\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.e868398ff4e51272,"e",@progbits
+	.string	"(\265/\375 \275\r\003"
+	.string	"\362\004\r\023\260%\351\f\303m\222$If\271\301F6!mo\231RNt\256\307\b\252\205N\260\017\021\207\362<,\037\035\225I'\3006v\225\023\333\346\366Y]\301@\022"
+	.ascii	",I\200\315Q\003\016k\332\013\257\246y\204\013\300E\b2\324\243"
+	.ascii	"\004v\324p\214\232\313y\333\322Fs\003X\242\262\016\f\260"
+	.text
+	.section	.gnu.lto_.inline.e868398ff4e51272,"e",@progbits
+	.string	"(\265/\375`0\003\335\020"
+	.string	"f\332T>0m\223t\300D\203\310\363\017\225\212\271\n\036\361\035\325\355\252L\247;\224f\263\240\036:Vt\254A\035\211\375\353\252|nC#Sb(N\212\314\340\\Wx3i\273\277\221&v\023\271S@"
+	.string	"B"
+	.string	"H"
+	.string	"\315\225\363(\302\006\340T\316\023\f\237\217\b"
+	.string	"\367\352\272\272\372[\362\274\031X\342Q\201\304\275\305HJ #.\317\260[q\004\341y\020\262\214W\027\376\025\326\333\336\312>j\364\275\367\334SN\001\001\225\363\361\253\213m\230\310{o\232\245Kw\272\214<3\247U\n!\236\317t3s\023\243 (FD\3001[\035\275\367&\027\303\321~\301{\217\343\247\247\017D\r\350\332yZ\201\033mW\0133l\334\b\254A\210\307A\200\247\264\330\215"
+	.string	"\311\222\2579\361\312\233J\030\ty\350\275\032\355\020\225|X\036A;L8\221\342\302\212\224b;&(\203\017%\025\227'S0\013@\300\2353@iT\361\373\330\250\240Q\345\\\020H\344\021#n@\252\235Z"
+	.string	"\2112PSWW\205\21595e\305\334\2135\335\302\342:\267)\211\221P\b\352\017\260\320\205\022\034,\224\307\236\312n\255\235\223\324A2q\331aue\263\304\316\013\214\216\334\217O\243\316\001V\250\3614\351\220\211\004\"\2424\252\024\033P\"23\306\007\022\200\344-\310\211)\252\031\306\365\317\006\0162%}hR6hJ\316?4\230\332ss\325\025\300\031\017\364J\022/\365\035\234\3147\203\247Or,pN\332h\215\026D\233\350*\375d\004\r<&\244(\207Z\253\237\022\f\302\311;\346\222.\302'\020\270\261\267\273m\372X5k\367X>\230|\357P\274\252\375\273\237\216\256*\203\300d.<\030&\020\366\225\322\266\2240\177\024\352\333\227\023\242\257l\221\300\344I\270\261\025t\204\316\305\274a@\216\206{0\337y\"m\374"
+	.string	"\b\177[\254\216\210\344=\273j\003\241"
+	.ascii	"\377\004\032\316|\315aXiPi\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e868398ff4e51272,"e",@progbits
+	.string	"(\265/\375`\217"
+	.string	"\305\004"
+	.string	"\262\310\025\032\300\245\320\001\277\356zW\371\177\327\372\377+\277\237\277\2666\322\032\331mo\231d\333\354\274`\f\214\230^R\363\312\376\022\305g\347\213\271\371Z\t\260\202-v\326\360\017\035\307K\212\333\205\371J\365\314\021J)\345Kd\360\331\301\363\255$d\023\362\266\022\213\363g\354C\031"
+	.string	"A\271\200\306\3204\nP\031\271(\254\001\016\220\352\364f\003\240(\356\302$|\346.h\227\2468J\021\003\270\b\326\307\306\212!h \225\206% "
+	.ascii	"s\237\n|f1\312\363\274\002\f\001"
+	.text
+	.section	.gnu.lto_.pureconst.e868398ff4e51272,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\230\004\001\232\004\002\231\004\003\230\004\004\232\004\005"
+	.ascii	"\232\004\006\205\004\007\232\004\b\232\004\t\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.e868398ff4e51272,"e",@progbits
+	.string	"(\265/\375`\301"
+	.string	"E\006"
+	.string	"RH\032#\2205I\007\240n\377\356\023\326\302}\316u\247U\377y\307*\342\256lN\373\271\332ZB6i\204H\231\002\023\n\207\301\361+u\026\252\242\204\260/\341\335iD\277\022\025\244\267\305\306\277"
+	.string	"Cb\216\251PY\255E6\357W\262\333&\2452U~\030\346\234\305\302\020\212\006\315\277\026\001\256\355m\316Q\271\240L\312\003\243g\") \220\002\0311\274\001_"
+	.string	"\357a\310\001%\203-\001\335\013\\\212sE\320\003xTH\\\215\321g"
+	.ascii	"\236;\320E\001\013\004d\020}O\004\203\333\006\267\313[\321\204"
+	.ascii	"\326\220\254\324\316+]\206`\304\t(\305~#\211\341!\2765Q4\222"
+	.ascii	"X\214'\b\264N\203P\276\017\303\202\207R\004"
+	.text
+	.section	.gnu.lto_.lto.e868398ff4e51272,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_config_streamer_init.3.e868398ff4e51272,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"e\007"
+	.string	"\242N45@o\323\001\230NL7\\F\311\2508\033o\027\223?\245\0018\346w\251`\2358\3406\322\216\267\203\210\265\216Rv\361s\030\364S\343\237p\276y\353F\266L)\226ku\262\013\344\271\262\221\310\001\342\363\020\302\254\030\372x@\321\312D\261cP,\342\312\342\b\303\262\310\361\356\351\260k\203\307W\001-:\345\201\333R!8a+1\221\346\232)\034\337\005\334ZoK\370\321z\372\377\302\256u\311\316\251\352x!`\3715fd\376Q+\"\234\266\316\326$.\321\\\242p\300\337\271\250\374^B\0256\246\352y\2402\265\261@e\252Z\013c/\344>\311\300@\211\371\037!\2105\247V\333\304"
+	.string	"\034isj\030\37679\322\206\013\335\266\240\355B\333\221\t"
+	.ascii	"\252\244\2231\215{\206\215\263\257`\336%\200f5\005\334\345E;"
+	.ascii	"\311"
+	.text
+	.section	.gnu.lto_config_streamer_start.4.e868398ff4e51272,"e",@progbits
+	.string	"(\265/\375`\242\001\305\016"
+	.string	"f\332_F"
+	.string	"\261&\035\200R\206\222y\275\275%\350\025m\375\3405\031\210=\026\035\207.\0073H:\313\312\026\223\301\255\033\302\035\274G\300H[\334Khy\351\377w\r\321t\004L\310(\210Q\007h\365T&\237\354-wJ\001H"
+	.string	"I"
+	.string	"N"
+	.string	"\331\247\301\177`\237\331\005`\237\376l\031\007Q{\225i\303\252fw5\025\361\357R\343\347\177u"
+	.string	"\245\223\350\322\303U\"\230i\321\340\234H\362\003\205D\351\253G\323i\024\343\006\204\335u,\235:\334\363\266#\330~`G\217V\025\373/\177v\360\237O\375RF\277\243\201\211\232\031\003^\273(\257\233uM\231\022\266\317\261\255)\256\372\376\342P\006XR\b\023kwA\354 \3734 #Xr\263\340\321~\313]\276\247L\356\261\253\362\202\265\013\202XA-\327HEG\331\314\260\324!\354*\242\212A\2126\266A\217\teW=\021\303\222\312\324\346\356\302\241\266`j\\x\213)\202a\231j{gQ\222\355.\003\177E\006\f\212\032a\202}\026\340"
+	.string	"#\305\005\304I|\331\240(\352\212}\271\273\033\233\206\217'7\257#\"=\267'\244\333@\235\255#\361$P\370L\030\341<\332\310\247\003\322<\235\247\205\0340ga\3534\022\216\3534\016\270\377\340:\321\221\023\334\336\036:T\002&TJ\013\215\324\225\2070\231PG+DA\303\021\355O\205\370\2229T\004% \260\002\021\261;\007\252\247\023,\252a$\031\326\222Be\213\f\242\374\271\3214F5\3407\373P\271U,\257p\263\333\214\335X\373:\244a\264\316\211T\214\003J\270\205\365\216\233D\302Bw@"
+	.ascii	"\243\023cW\224\343^\350e\214\b\200Q\304\3133MN\321\326\036"
+	.text
+	.section	.gnu.lto_erase_page.5.e868398ff4e51272,"e",@progbits
+	.string	"(\265/\375`\305"
+	.string	"\275\013"
+	.string	"\326\326RA o\233\016\300E\216\262\231\357\232\341\234,\307\340\307\372\217@\001\036\020\203\201\013@\335\204\274/\260\232\372\344\020\224\324(\363^Q\033\022\242"
+	.string	"2\360\013\300\002\250O\301-^\226:\3461\333\366\226;\245A"
+	.string	"="
+	.string	"@"
+	.string	"\224\016\222\216\021'\273K]^`\272\214'0]\252\310\267G\205\233\017z\2040\"\021\352>\256\261A\311\207\b\001\035\027\357\301\305\367\357\320\243\343\200\220\242\331]\303P\227\341\226\267\375\300\266\003\373\n\0021\326D\242"
+	.string	"q\322o\337\366\346\177\266\370\244\215\0137\267\373\210X\214\234\354N\314\245\031T\016\355\213>\332>+|\300\256Grbw&\360\202\312\245g\305\266\037\342#\233\235\"\316\017]\032\022"
+	.string	"\244D\203\252\347\370\215I\252\001\016\243\257\005\007ax\202\252\266\006\005\370\220\324\177\277gB\205\t\247 {\202\240\206\330\217\253\236}\322-?\177U\350O\007^\200l\020)\241+\346b(\005\231\206Vi\331\224e\026\306\341T\024o2\230\345\251,L\313\"L\350H\310\2706TF\247\362P\033,\2432\b|},\214\322\256\013\243,s\257\236?%\021\304\374\337\001t(]\320\314\257\036j\215\005\345\210\001\017"
+	.ascii	"\252\322%a\3619\246\375,\024$\354\330\252\rq\253\2700\032\333"
+	.ascii	"\354\006\205\022>u\0314\021I\t(U\r4\227\202\002"
+	.text
+	.section	.gnu.lto_write_word.6.e868398ff4e51272,"e",@progbits
+	.string	"(\265/\375`\331\001%\021"
+	.string	"6\241rE\360\360$\035:\371\262\020\234\035g+SE\2619\323\036's|\301\341\212y\342\304\375Qa\356\254Y\0215q\356\360"
+	.string	"\b\267u\326\336\323\"\233\310\306\237\305\262@\204\177\327\335\335\367\304\324\265O\032\331[\312\224\002^"
+	.string	"Y"
+	.string	"a"
+	.string	"^f\333Gq\236\225=\004=\235\316Ds\203\346Ecw5\220\177`\217\360\003\260G\035\361\325\261\b5W\376\251c\035\313:<\312\240\272\231\204\007zb\350d \310\356\242\272\230Th"
+	.string	"\207\210\203G\007\003?\214D\310\270\353i\323\315d\232Hv\327Y\323m\270M\267\215b\233\201\235!\001\367\371;\376\272O\367\376\f\246#L\303\230\326\230N\230\276\207"
+	.string	"\"\243\006\337n\206\317\306\026E\241\022\177\335\376\217\017\364j\311X\0322\026G\027\224vW\344\321\013\262\307\333+\033e;\363>\026\314\261\033\")\301\323~\317S\254\356\271<\300n\013F\320\256w\300\b\262G\007'(\371\232\223\036\350\377 \344\241(FY\327YR\n\202\3370U\023\327\221\351\373\206\245\252f\f\232\033\030\247\274\305\226\252\255W\215|1\303\b\204j\216E~5q!\305\344\222\355\t_\341\241lw\025\370*TV2\022.\330\343\365\256\027h\375\234\350y\311\317\366X\2519\366\365\373\276\317\332\262\003\034\247R\025\205\b%\025b\352N\215p\252\224\022\025\307\262\342"
+	.ascii	"\302\311\003\225-\245\251\234\224\244h)nE\033\t\361&A\305i,\333"
+	.ascii	"\306i(o\017\027F\310a\242K\202'\216\234\016'\257QmlG5\311\213"
+	.ascii	"\302\300\335]\f@vh\246vJ\225\257\201$2y\303\343b'\276\005;)\201"
+	.ascii	"\326\216\013\251#S\355% \200\002\231 %\017\352tm\230B\304\002"
+	.ascii	"\3176p\255\3105F+\222DM\013\370,\216\201\r\241\261AC\365]l<\275"
+	.ascii	"\352}\325\303\2760\253\323\246\341E\033w\216\002\033~c,VyC\230"
+	.ascii	"\344%\347k\256\300p\357N\272\301\n\241\027\006\235wA\323\340"
+	.ascii	"\002>\003"
+	.text
+	.section	.gnu.lto_config_streamer_write.7.e868398ff4e51272,"e",@progbits
+	.string	"(\265/\375`%\003=\027"
+	.string	"\246*\225I\260XQ:\360\250W\356P?\226\234G\331\004n\336\345\244\322\271\310>\241L\216\026\303i\300@\273K\313\332\177\323S\202\002\353K\263I\261{X\036\360\037\326\037\234\261\002\263\307\230!jw\\\027jt\260`\204\220\275\245L2\177"
+	.string	"{"
+	.string	"\202"
+	.string	"$>\240\326\333\222!\265\226\r\026\202x\272\245\370\034\327\001\333\355\3152G>\306\r\233\016\251\326\232\2229\n<\235\177\001O\033\006\214g\371\005\031\366\020\244\263\031\266\327}\002\001\361\215\344\316\303\031\322zf\230H\333\244I2\":\357\314C\312\030\fP\303\347T\305\347\204@Cba\"iS@\222\255\250D\316\270\317\373\202!\337H\372\234C\013\265\326\345\221D\361\025\277\273=\273[a\267/\004W\202b\374\353\235\217Fv\343v\313\035\246\311%\031m\337vQ\223\367\364\3627\275\307\337r\036\177\351\273\257(\362\206!/8y)\310;)oO^\236\274\207y\361qrAH\255=?,\265\t%\242\361\335w\357c\317\333\351\274\326N"
+	.string	"0\021\003\310\250\326r\346t)\210\247\337\205\355\226v\267\371=BL\227:{\301b\002\363\320)\340RgB%\"\234w\037\364\035\260\227\001'~2\036\021\340\331\246\336\315\240\201?\322\226\241\365\316\356n\270/D\314\021\005Pf\323\"&86I\013\033\267\331\270\235\337\036\310m"
+	.string	"gE(\312\214\223\266{wG\274\b\007\230\\\255\225fWu\242\025*\307:\221\017\247-]e<\212]\210MK\334\353\364\324\361\254\340\016\022\223\373x\304\340o\356\356\325\\\310\370\267\273 >\264=\261\326*a\377\243C\215(\343tO\002<}\237\367\004EJ\0029\252\233f\211h\341\314\233\257\276+\007/V\215\212\365\312\301\341\360\241\345\301\306\265J\331\264T5\251\325\013'\345"
+	.ascii	"\301\272nX\257T\216\313\365J\225\312\372\276\235Z&\326\262]r"
+	.ascii	"\352\353~\300\310\023\034A1\376\205\215\333\007#Eu\270\202K-"
+	.ascii	"6\217\330a3\220\220\024\260K\035\366k?-\r68\305\226%\306\277"
+	.ascii	"\317Zk\005\037\\lT\203'\206|\265\037\031\3778\005\235y\022\372"
+	.ascii	"\303\004\211\n\355]\fG\262=1? p\002\021B\253\003*\351\342\206"
+	.ascii	"\201{8Z\013~\275\254K\377t\352\262\303\270>v\362\262\264\025"
+	.ascii	"\242m\355\365\341P\004{\n\030\342\337\211u\326\302\355\252\362"
+	.ascii	"\344\242\327\224\2101`\235v:\303\356K\276\251A\200\260\252\r"
+	.ascii	"2\177\350\306\204\377=Z\257)\216\323x&\321\n\204\234\343H\016"
+	.ascii	"\370\330SWk\200\226Ens\207\3543\243\266\013-\350\344{\346\356"
+	.ascii	"\304\243e\225\370\bA\302\273Kw`\203\353Q\017L.D\022\222e{\343"
+	.ascii	"\365v\332G\006"
+	.text
+	.section	.gnu.lto_config_streamer_status.8.e868398ff4e51272,"e",@progbits
+	.string	"(\265/\375`7"
+	.string	"\r\b"
+	.string	"\322\217770\217\222\016$\\I\201\f\037\341\0375\256\311>\0078]Nh\241\256\265\377\254\335\277\237\376\316\341\201\212\326i\0300\312\002d\367\372w#\340\\\024\240\262\337\032!2\005[\337:\334'\344\371p%\022\203\003\250A4\3324\021\310\023\3226\216\244u\b\036=|8\2554\032q\232&f\037B\016\nN\374\020%y%\313\314\204;\"\021\221m\024\273&\030\300B\275\326\307\323\203\027\337+\341\352\337\0336\266\357\332t\270,\274dV\264b\262\005S\341\370\273\327\374}_VC\272FS\0052W,(\231\321\340\203\254\3301\373\357GA\272_\271b\206\252\032'\024%0\231\251q:\220)vu\223)\0061\332\365u\267\"\275<LZ)\325\251\017@!3\177)\225E\207\375\013~\204?%\f"
+	.ascii	"\252\244\223i\021\206\315D`\231\005\324\230\320]\303\321\261"
+	.ascii	"x%\230xp\367I\265b\022&\031"
+	.text
+	.section	.gnu.lto_config_streamer_flush.9.e868398ff4e51272,"e",@progbits
+	.string	"(\265/\375`\330\001]\020"
+	.string	"\226\036jE"
+	.string	"\221(\035{\021"
+	.string	"`0I\367(\017\325D\367\327\270\255\027rgxG\0056\024\372_\247A\301\024\003T\2772\020\216\312\252;6>[\001\221\202&\375\277\344\353\036\254\241\317\375\302\026\241,\b\265O\366\2262\245V"
+	.string	"N"
+	.string	"Y"
+	.string	"\373\031\360\001\317\243?\217m\337\304O\244l\033\374`\255\177\210\341\"\273\331\335N\364\020\367\b\037\302=\252\207\247\0165S\376c\016K\270x\341\265T\207\034\256\260@\r\f\035\001Z-0\364\022\302{\314SCk\225\331Q\260\273N\257\265\341\216\267\275\3006\002;\033\004\236\335=\210G\177\205{\274\252\013\007L\214%s\354O\225\372\262\017ww\255.;\323\237\177\377G\246;\\\232\213\351\b\323P\323\252\351\314\364\005\204\324l0\240\261\373\222\303ck\304\031\021\266S6H\332\217\035E\352\337\312\007\354\272f\3206\234F\327\r&\366I\325\221G\265G\244\274g\021KU\032\3653\026\211\325Y`"
+	.string	"\301<\373\344+J\004h*\\\205\351\021D\0035e^\207Tx\313\340T?c\215Xe\216\257\251\307\231\335\\z\034\206SCS}y\344W\t27Z\022\307\366\351)lK\340\313P\270\020\243{D\202\"\231LH(\225\224\222\223\322\004\224\323\250C)\231\230\272\021*\245#\021\361\311\002\t\325\251\234N\250\016\344\333\303U\327GE,\272r\355\243Z\263\331\001\3655\2436\267\033\233\216\332\016N\263\315\003"
+	.string	"\2262/\007(9\375P\373\001\204\274\327QQ\006U\331\216\360YI\b\326B$' @\002b\314Y\036j\322\211L\377o\230+\263n\353\206\211.g\2213\202"
+	.ascii	"\313\202\213~}`\230g\340\206\r\234\220\\\037s\001\353yX\2316"
+	.ascii	"\262`\017\0047!4\342\343@\001$\004!=,\322p\330\313\250k$\361"
+	.ascii	"cj\255:\213 f\214(\214\004\321\234v#-\320\366\246)\305\202\002"
+	.text
+	.section	.gnu.lto_config_streamer_erase_remaining.10.e868398ff4e51272,"e",@progbits
+	.string	"(\265/\375`\363\002\205\025"
+	.string	"\006\347\210I\300\322Q:r4\315\376\373\266\235\177JB\202F\nXl\373\2011\200W\267\247e\34503\3124\221W\035^Z\217^\366ok3\005\245=\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	"D+\353\316\025v\030\203\020r\002\375\365_P\023B\366\226;\245r"
+	.string	"m"
+	.string	"z"
+	.string	"\274\231\257j\325-\025\325\312C\340\004\343\251y\343I\274\304\314\006N\036O\356=8l\277\245Zk\213\344\"\341\351<+<]\016\016\345\354\243\030\322\271r\346\243\034\021\335r4\037O9\013R\234\333\0232z\322\215\316L1\361\323c\223!"
+	.ascii	"\237\f\247#\2379_U\2566Ij\255\377]\342r4)E\006\265V\313[\016"
+	.ascii	"\347\006\271m\034\333\013\354\035\020\343\207S\177&<\375\212"
+	.ascii	"\276\036L@52h\363h\344\356\354\237$\271\350\340\325\331,*\035"
+	.ascii	"\262R\245\356\273Q\347\375\247\367\356\221J\213T:\234\322tJ\317"
+	.ascii	")\275TZN\351\007\030\311\211\321@\250\326\013\301\036\025\211"
+	.ascii	"\262\020\361\336\357\233\371A\377\371\344\223\301\3650\241\364"
+	.ascii	"d\25767 6\245\246\034\265\362JN\255`<\225\366\201~b\366\277\233"
+	.ascii	"\016\224\034\327f\231 \177\013W\004C\020\251\2664\273)4\350\216"
+	.ascii	"\350\356,\263\263bU;\263\023B\246\226\2658\177\216tU\373\n\225"
+	.ascii	"n\n\321\f\233\016\215\200\017\b\340Z\026\316}\020T\243&\233,"
+	.ascii	"\006/\013S;7\205\b\206M\207\326r\025\002h\244vw\370\030\001\264"
+	.ascii	"\373E\255\274a\263\201&\203\226\273{\333\017\330\207\f\224{\240"
+	.ascii	"\307\024\216B6\326ZO|!\t0\001\020\\^\373ZQy\231\256\333e\022"
+	.ascii	"{\265\250\274b10\016VX\"\270\300\\-\027\026\225\226\226+\006"
+	.ascii	"\32321`\330\313+\326\212\201\301b\255\023\257~u!KR\2634\243\220"
+	.ascii	"]\240\317\303\270;\227\\T\002\212[@I\312\260\321\033\022w\347"
+	.ascii	"\377^2DW\3539Y;.\316\266Q;\356\201\202^\324d\323\377Yk\255\341"
+	.ascii	"\356\212>\356j\377C\304#\\\373\365\026\006\246x\002< `\002\031"
+	.ascii	"R\325\003*\351\342\206\365\350]5H\270\243\243\265\362N;Fb\034"
+	.ascii	"E\"d\006\027DcdW\016\020\310j@8\307\261u\343yi\3145\230\b\tC"
+	.ascii	"\035\311\334\335\201\325\266\203e/o\252\016\306l\213a4'.6`\276"
+	.ascii	"\363\213\2251M\366\004\323\254\250\024Ms5n\017L\020\273@n\207"
+	.ascii	"\321\254M,\307\360\357D\216\030\201\221Z0\341\336\245;\360\235"
+	.ascii	"\3650\254\032\204\330\224\366\n\272n\257%\\\311r\333\245\364"
+	.text
+	.section	.gnu.lto_config_streamer_finish.11.e868398ff4e51272,"e",@progbits
+	.string	"(\265/\375`\355"
+	.string	"\375\013"
+	.string	"\026\326PA O\225\016PQ\213\340\200@r \307\021\013\270\2019\310\343\025~\0136\005"
+	.string	"\034\306FX\034\277aL\3057\320%\233\345\237\241<\200H$\220M\006&Er*\376\242\300\305\344&!d\357\275S\n="
+	.string	"<"
+	.string	"?"
+	.string	"\273\234\344\221\354\225\336#{\235\031\016\236N\t\372G\235~X!#\024;\247\027>\251"
+	.string	"\027\212\030\034\"\210FB\033\302\243.)\210\037)\265\003\273k\031\212\026\356z\333\bl\027\260\337\005?\225\322\337\336\301\365z\221\300\305n(6c[5\005\007\333\240\r\261}i\377\364\021\340G\316;vE,V\273\343"
+	.string	"\023\330^=n\266}\020\017\001\332,:\222\304k\2500A\365\332\031\371\320\032*<\264>\263s\022\314\265\232\336d\237\013R-@\022f\033\302Il\266\3355\340\247\"H\330J\257>'{\375\374(\2310\2108yd\314\036;r\216\354\323\235\"{Jk\037\003\335\335M\276\312\205R\3714\031\005\r,\f0^\307a,\224\013\327}\031n\022\300\236\203\312\307i<\357\343 \343\336\326\246\3043?\266/7a\2266\001\224^t\216T/\261A\252\254\023&\030\233\264\037\004\026"
+	.string	"\252\244\223i\021\206\301Z"
+	.ascii	"\026\346\275\210\241cB4\b\242\n\203\251H\275\013\266\240k\211"
+	.ascii	"\275\320\261\016\237Y\303\205\321G3R\2241\002\232\210\244\004"
+	.ascii	"Zu\323\224BA\001"
+	.text
+	.section	.gnu.lto_write_word.part.0.17.e868398ff4e51272,"e",@progbits
+	.string	"(\265/\375`W\002\365\022"
+	.string	"\226\243{G\300\324M:hcc\240\006\bi\212\212HGb{\274@R\243d[\254h\204\332z[\362\327l\274\004\177\276\0165B\333X\233\216\304[\237\"\331vA\220\262\300\375\332\272\276\262\253\3422\2532b\371\023\262\367\2262\245f"
+	.string	"h"
+	.string	"b"
+	.ascii	"=8j\314\371-x4\203\356\321_g?\b\346\306\266\037\343@4\373\t~"
+	.ascii	"?6\256\346H\215\321\2209\347\352\321\344\b\344#\274\001\371\270"
+	.ascii	"+N{\204\253\222\346k\315\026\363\370\340\366\003R\2705\325l9"
+	.ascii	"_\030!\n'h\200\215\006\236\247\007\321oW\033\333\214j\201K.e"
+	.ascii	"\316\351\316\304\315\335v\005\333\023lm\021Ff\212\350\364\342"
+	.ascii	"I?\323\325\276\317t\032~\323\222\322\354\310_\262Jiv\223\032"
+	.ascii	"\001d\316)\241{\274\177\004\343\337\254\262\375$\244\026\233"
+	.ascii	"\320 "
+	.string	"\265t17\035\223\b\024@\346\374N\036\r\241\243\331*\257\336\350E.\360\233\266\325\027\271\230d\316\035\037\rT?\004s\241\227\222o\226\270\261\252\375\031\377h\027z9\2019\003@Hsw\274\007\240\023ub\327\307\360-\022n\211\017\017\021\017\032-b\001\272\253k\253\254\350kpM@l\214\355\fwzusN\007\276\r\0170\337\305\243\377\"\037u\177\273\002\234&\"2dtJ\327\307+\017\347\366\330\234\232\223j)\325\361I7\274\321\277R\255\037\372\037\340\300I\324\234$\246\002\236\347\332\330L\306\222\305\244k\246\201\325!\266\356\026\212\347z\261\\\236,fAe\005\003\013\254\265bYa\275V-/\266BI`\330\006\227\267\222\301`\336J\365\3551\207\034\035\360\344\277\235DE\216\316~\270\237$\2676\266\271u\212\314\316x\243\334\033\257\375y-\b\274s\310\270r\325(\204\316\214NA\305\275"
+	.ascii	"\005c\205\354\340\221\202:\304\"1 \200\002\031\263\365\352\351"
+	.ascii	"\230Y\340W\343\313\314\375p\3702\213\300\3120a\273pS\221\236"
+	.ascii	"\235\005\232\016\f\255\330SE\346gn8\315\206\203\235{JZ\002\013"
+	.ascii	"v\332\342a\303<\004\244|#f\256\305\262\201\304\177\030\233}\227"
+	.ascii	"\336\205Mn`\335|\244\233\033$\275\223\255=\355\006\013u\017\233"
+	.ascii	"\254z\273\017\006\356\034hB\343\315=\001\217\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e868398ff4e51272,"e",@progbits
+	.string	"(\265/\375`\377"
+	.string	"\265\007"
+	.string	"bK+1pM\322\0018Vp\307\375\244A}\273|\026JC\250zZ\335\307h\277\002\377WU\370\276\3777$"
+	.string	""
+	.string	""
+	.string	" \324\032!\273\265\326\032\331\204\310\235R\215\260)\253\342L\224l\035\247\207f\023\322I6\n\026\245I\\\324\021\215\305\206A\351\016\351q\231\r\232Mh\200\\\230\2459l\312\2528e\tqq6X\232\n\307$\334!\374rp\311/\276v\301\340\223\333Zb\243\240\020\301-\016\035\221\212\201W\004N\t\370\344\201\262*\200G\231?\f\306\f\314\263\345u]\327\364\306 =\323\036\204\021\243}\373\021\375\274\367\236;\304\332\272$\036"
+	.string	".C\347\034\f\002\032j`\233\"\2435r\334\f\003\324\003\200\003\200\303\007H\355\227\036\2140\036\026\323\004\037\320\003 \006\276\241\204?:\004"
+	.ascii	"\036\261\235\004\200\033O\004$\n7 \270\340\030\004\f\270\243"
+	.ascii	"\255\231\007"
+	.text
+	.section	.gnu.lto_.refs.e868398ff4e51272,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.e868398ff4e51272,"e",@progbits
+	.string	"(\265/\375`\334\020\rR"
+	.string	"\332\211(\036R0V\036\r\007\202Ge\006\030\215\300;\355\321F>\227\260~e~>7\247\266\352\021\273\372!\322\240#\027V\276\214/\333\024=\230\007\261\326#\203\360\373;\320<\007\203\2029\317\037?\266vl5\204\031zl\326\266\264>\313\241\2444\033\262\335\244L\001\214\001\311\001\337\001[D\177\303\376\353\366%\242_!je\2756\354\bB\227\025Zw\237\202\377Es\247\354\026\213\034\335QH"
+	.string	""
+	.string	"2\261\324L\353^\223X%\226\271\315\237\253\220\020\001\270\035\262\232\314\334\316\257\3277K\f\335\003\344\312x\255K\370\\$\026\3132[l\327a\304\270\r\210\325\312\234\233\"\334<\301\347K@\377f[\334\366\312\213/W\212[\361\270v\217\006I\210\030\301\247mS\334>\003]*\233\265\314\240\255\362\275Z\254\343\206k/\273\327\036\334\030\032\037\262\370|\007\350W\353\006`u\214\003\200~\203n=\033t\273\017z\034\372\033zF\201V\305\355\334\0247\237\260Uq\003:\342\337\252U\376\313FtBvV\367\372s2i\016\207\360\371uU\334\320Mq\373\027\002\026H\300yp\235\23770\333\025X`P%\351_\025\n\210\261\342\205\255\371\277\353\177\022\377\263\374\037s\346?\231M\341?"
+	.string	"\377\035\370\317\342\002\374\374\300\277\274&\374g\263%,\t\367\371\271\201\020\026\204\234\177\325\374'\373\227\003\031\377\307\376\233\375/\373/\006\355<?\267\3707\203\017\216\363\363\317\277\036\374\333\301\277\032\374\033\301\277\016\374\013\364\357\001\377\262\370\267\200\177W\374\033\300\277<\377\242\377\332\376=\377\253\375\367\372\177\366\277\312\3770\377a\370\337\302\177.\377\323\374G\363\337\314\177\032\377\321\376+\377\267\370\377\365\037\305\2337o\336\374\354\365\363\361\337\211!K\200A\177\376o\3359\340\254]\024\356|qv\203\376\334\332V\201\377\247\255\254\333\007 \322\240M\270\202@\030\250\203\272\201E\3422\n\370C\\\006\233(%\314\370C\\{\310"
+	.string	"\275$\322\304\025\t<\221@\356\265\207Q\306\036\"\2017\210k\027{E\002}zh\364!\256A q\031e\\\342\022i\374\351a\003{\030\034\202\016\221F\"\027\244\321\207\270\f\032\211\303(\343\366\212\354\365\222e\215\002.\3652\230\353n\2475\t\334\351\016\026\033\370\205wt\024\332\216\016\322\033V\304J\244\273\273\201YeRH\334*\3540\242\023$\322RwY\357\250"
+	.ascii	"\270\300\265\273\231Z\b\334\356\245\265\330-D\306pDn\030\246"
+	.ascii	"b\347z\030t\022J!w\226\204H\246v2d\215\304\245\024\362\005\226"
+	.ascii	")\313d\013W\340&\273,\252\210.\201\213&\267Lrt\342s\233\312\037"
+	.ascii	"\246\236\244Ac\323qD\032\256U\271\363\364\224\004yF,\247*\t\251"
+	.ascii	",6\263h8J\226`\310\360y\266\342\034#l\202eE\277\312%s\261\244"
+	.ascii	"l\223g\350\323\303)-4-onX\026\bL\216 \333\262-\263dv\314\212"
+	.ascii	"\331&\226\271f\313\3047l\275|\305\332=\354\262`<\300\237n\"U"
+	.ascii	"I\345\232\355\022\013\306BH\234\001E\211\266V\377\256f\033\345"
+	.ascii	"M\236\341\252@\225\2455\252\205\362\303\210\261f\373e\305x\200"
+	.ascii	"k?\301\330ZZ\023\022\022Z!$$$\324s&\314\0305>\347\212\361\206"
+	.ascii	"\331\261\257\330\202\331\031\256\330\331\035\334M\200g7\001\234"
+	.ascii	"\346\222`\224\333\3715\002\375\n\201r\320\nA\277P\350n\331\257"
+	.ascii	"e\376k\271\374lZ\363\204\013\237\017T\\\304\217\323iRdI\004\022"
+	.ascii	"\350%\300\372a4\362\311C\234\f;!\343d\206O~\362\346\221,\315"
+	.ascii	"\210\223.R`\204|r\023\236.&\255/-\224\223g!~\034\256+H\221\250"
+	.ascii	"\253 ~\\\016s\fHR\211\376|r\344\b+Y\237UH\246\226\274\255D(K"
+	.ascii	"I\316Jt`^\035\371d$\013\306SM\200|\235R(GE\261\221\305\352\247"
+	.ascii	"\034*l\372\030\204\302\017\2623Rg#\374\303\261,\255\b\237\\\344"
+	.ascii	"v\204\002b\315\017&\202\205\\s\266\340\0170\256s\t\375\031\311"
+	.ascii	"d\344n\235\303\265\2157)H\204@\245uQ\013\004?K\302\210h\006\t"
+	.ascii	"b\346\244\223\026\305\211\036\240\364\320\303Y\216x\006\311\025"
+	.ascii	"\004\n\212\217\350\226\344Z\341\321Q\370\274\215\370\343\007"
+	.ascii	"\037g\210\261\222\304-\345\250\n\356p>6\321)K\224\030\232)\026"
+	.ascii	"\331\307\021\252'e\332\230\331\027\261\036g\037\315\\\031\023"
+	.ascii	"M\b\237\234C\017\0171I\312\360"
+	.string	"\311\306M\2633\266f\253\211/\326\301:\230\207O\013\301\360H\332\276\240Q\363\261\343\314\243\314\271\024f\312\r\237\354D\305k\371\204OnZ0\024\b\024\323\323\233\247\016X\252\300\244\360\022/1q\243\3448\006\241\310Q\005\326d:\023\313\350\260\321\242\203\310@\316\002\326\264#\271\306\3035\026\336\272wE>\025\333\274\r\013\267\213\335\307\266\221\271yRRq\360,\304%\315<\321\206\317u\303@\233\017\253\346\032\003\271u\302\214\300\251\263\034\326\023R\315\347\233e\342o\324+\210\251\036[\267.Okj|\236\213\240\347\036\350\327\211]\363Mcn\332\252\241\335\235\303\244\365\244L\353c1\350_6_\2657w\272Y\364xQ\333r\344\363j\026\354?\016gLV\016\001\252\016\251\b\310(\345\035\355|<\245\334\217\267\263\315P\324;A\307\205#\2718\342\355\324\237o(5RJ*\342\355\206T\237\322\220"
+	.ascii	"IIJ<^\217\227\363#\272\341\350\251H\277\036/\247\206.M:\177\251"
+	.ascii	"\317Fj\343f\244\366^\260\241S\217z\352\n?4v\322#\335\n!\020\315"
+	.ascii	"\240\341\301\t\"\364\034\311\305\t-\220@c\350\227\036\251\272"
+	.ascii	"\037\220\214T\355\311\260\221\376|5\320\350A\362\355x\273\032"
+	.ascii	"G\274]\252\"\200\344SJ\252\341S\372\351~>\001T\335\317\247\342"
+	.ascii	"\267\343\355\002\320\231\300\305O\325\335pa\244\366p\020\245"
+	.ascii	"\277\235\212\343\347E\351\221\356\006Q\352\323\251\251\316\213"
+	.ascii	"vj\312K\217\320W`\201\004\026\\@C\316/\251\327\373\200\b\307"
+	.ascii	"(\235\241\250\227\304SB}D?\251O'\303\371#R\1777p>_\252\032\031"
+	.ascii	"\351rR\033v\276\363H\f\274w#U\207~\275\236:\204\342GtA\216\f"
+	.ascii	"\373#\202A\301\217\267SB\217\001\0062\200\\Ha\004\264\310\205"
+	.ascii	"\232\332\320\245\352\317Gt\264\253\301\353\025\r\361v:\033CE"
+	.ascii	"\252o\310\305\0028VMk\324P\222\341\366\323\261\252\246\266.%"
+	.ascii	"9\034v@e\341s\315\022s\323f\213\221\360\3320*!I\346\342+\350"
+	.ascii	"\026\256`\017\266\202^iBk\332\022\026w\350\222Re\325vzTA^\341"
+	.ascii	"\223\251p\3262\337d\255u\311\323\205l\254\214\317\3430\2414\344"
+	.ascii	"\274y\373y\212\221\0365&:\222\353\216\026)NC^\262\225\026\017"
+	.ascii	"@HEQ\362\204Y\2759\302\347\325\025[\245%sH\264+M\254A\201\302"
+	.ascii	"VK\345L\bT\032\016\311\022&m\324,\223\255p\2768\231b\236M\235"
+	.ascii	"\231L\261\3226\266k\037\221\2663-chTM<\006\241\270j\272\362B"
+	.ascii	"\304Yy\256\202\021\343d\250\206\030\013\362\311F\234\347\b\326"
+	.ascii	"\205\026\201X\250\2218g\0244#\"$\"\222$I\032\003A\005\204\030"
+	.ascii	"e\251\274\r\022\2005=R\032\206ddF\223$\373q\\\37281\302E\n\311"
+	.ascii	"\321\300\301\223\361\021\227e\017"
+	.ascii	"\234h\372W\200\311\240C\221B\0238]\003p\006D\002\3627\241\025"
+	.ascii	"\244D\205z\233\377\323\32684\223l\245\311\004\361\357.\361&y"
+	.ascii	"j%\230\023%"
+	.string	"\021\360\002\343\333dI\356J\211\272s)\271\363>\030\203\313\375\317\022\3050\202\221m\267\241\21781\002\317\255\340\311`\n9\\\n\013\367\237\274\274b][@e\033\310\202s\026r\036\347U\230\303*\275SO\371\002\315\252C\221\2372\373l\2166\335\307Z\217\323\314I\247\324\227\374\342\311\216\203\232\n/R3\334\022cPji\037~u;\036\237\305\0307\205%\324\r\2129~@?\263O\033\251\246\333T\245\332\300@\250\341U\241\207\362\352]\250Z3\2625\006)\001\317\351\371\246\245\366K\007\225\306u\0329\317\334\361\355p(\357\275\364`~OX\207\331\211\017\021\371%\274~$\036q\255J\272D7\367\250\221\022\376\330\3175\301\375\202~\225L\236\026\347\300\251\215\335\303o\365\t\333\251\024\001>\354\257\335\216^;\f\206\273\262\022N\347\037m\026\032%?\264(\355\275gX\035S\377)2\201S\253"
+	.string	"L\244\024\377>]\242\030%\004t\002\345\277S\006\253\006\327\370\351\371\007[\247\367]\032\337~\230\354Cu,\345\247&\237\327\274\2143uD6\375\004\035nf\375#\027W\361\341DLq\204\257b\354w\006\341\220\252\334\3772\333\277\013\023\331=)w\311\201\363\033F\243\334l\371\366\342\326\2610P:\332*1\225"
+	.ascii	"<E\007\033\204/\234\243\351\305O\255\332\313\006\335\253\tZ\020"
+	.ascii	"\216B\337\0164\003\301X2\330/\340\305\177\376\300\202\3358\260"
+	.ascii	"\215\306?Zdt\244r\274\202\224\227X\276a\302T\255\233\326\354"
+	.ascii	"\316\004\027E\374\365\022B7 [\351 dJ\006\345W^\252\203\300j\342"
+	.ascii	"-\241H\005\020'\320)9u2.O%_\034\334d\346\2168|\364\346i\354b"
+	.ascii	"\340cN\304aw\311{h\370\220\203\005\276\337\221\237l>R\275xt."
+	.ascii	"\343\277\210\341\177\016\236\213\ns\3406\217;\341o\362\365%\371"
+	.ascii	"+\360\to\336\334\025\307\300X\271\037\251\2439\374=\347\337G"
+	.ascii	"\356'\267\324\372\326\377\025\357\212\3672\024\236\207U\027\363"
+	.ascii	"\356\267}z\032\222\f\357\343\340\313\372\261\002N-\2729\rH\007"
+	.ascii	"-,D\343\332i\240\177\021\260|\363\\\005"
+	.text
+	.section	.gnu.lto_.symtab.e868398ff4e51272,"e",@progbits
+	.string	"config_streamer_init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\001"
+	.string	""
+	.string	"config_streamer_start"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\001"
+	.string	""
+	.string	"config_streamer_write"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.string	"config_streamer_status"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"config_streamer_flush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.string	"config_streamer_erase_remaining"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.string	"config_streamer_finish"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"FLASH_ErasePage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\001"
+	.string	""
+	.string	"FLASH_ProgramWord"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\001"
+	.string	""
+	.string	"FLASH_Unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\001"
+	.string	""
+	.string	"FLASH_Lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e868398ff4e51272,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,489 @@
+	.file	"feature.c"
+	.section	.gnu.lto_.profile.5145a3aa791191ba,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.5145a3aa791191ba,"e",@progbits
+	.string	"(\265/\375 \234\255\003"
+	.string	"\244\005\220"
+	.string	"\f"
+	.string	"\345\217\300\314\013\004\002"
+	.string	"\001\213\331\256\305\001\002\366\213\237\344\016\002\003\227\247\344\313\017\004\002\001\002\002\002\001\002\001\005\352\263\360\321\b\006\312\251\326\231\r\002\007\203\313\255\261\f\001\b\347\364\313\323\006\t\306\272\236\261\n\374\245\334\221\007\013\201\267\227\352\002\f\240\342\234\212\n"
+	.string	"\n"
+	.string	"S\020\r\267\\\2615\022\312\270\204\231f\f\020\266\314Rr\003m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.5145a3aa791191ba,"e",@progbits
+	.string	"(\265/\375 Pu\001"
+	.string	"\330D"
+	.string	"\n"
+	.string	"\002"
+	.string	"\001\001\002\001\001\003"
+	.string	"\001\006\003\007\b\001\t\n"
+	.string	"\001\013"
+	.string	"\003"
+	.string	"\b"
+	.ascii	"`\020\\\2462\255\345\036\260\315e7\220\363\006\260"
+	.text
+	.section	.gnu.lto_.inline.5145a3aa791191ba,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"\265\004"
+	.string	"bF\021\030\260%\351\f9\r\303"
+	.ascii	"\314q\215`\222$y\224\265\315\022B\310\336R\2463@p(\372\0070\205"
+	.ascii	"8\371{\310_1\246\237\277S\323\020\352\004\023\274\2569\347)?"
+	.ascii	"`\333n\374O\0237\276\202\204\266\344\207W\b\" \240\242\231\253"
+	.ascii	"\036\307\004\026\016B\216\221F\371:\231e\205\r\002\330\320(\206"
+	.ascii	"\024\301LR\200\274s\2239\242\355\277\023\311`\353\246I\337\263"
+	.ascii	"\267@\212/\202\364|9\020Ynt\255\023\347\216m\230k\336\362_\217"
+	.ascii	"cjF\372\233\253i`\b"
+	.text
+	.section	.gnu.lto_.jmpfuncs.5145a3aa791191ba,"e",@progbits
+	.string	"(\265/\375 P\245\001"
+	.string	"\024\002D"
+	.string	"\n"
+	.string	"\002\001\001\017\177\002\003\177\002"
+	.string	"\001\002\001\001\003"
+	.string	""
+	.string	"\006\003\007\b\t\n"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"`\b\030Wep\313\221\232vp\331\177\003X"
+	.text
+	.section	.gnu.lto_.pureconst.5145a3aa791191ba,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\232\004\001\232\004\002\232\004\003\230\004\006\204\004\007"
+	.ascii	"\204\004\b\232\004\t\232\004\n\232\004\013\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.5145a3aa791191ba,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"]\003"
+	.string	"D\003\030\001"
+	.string	"\n"
+	.string	"\002"
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\001\002\003\001\001"
+	.string	""
+	.string	"  \002\001\270\006"
+	.string	""
+	.string	"\003\001\002\004"
+	.string	"\001\002\005\001\006\001\300\007"
+	.string	""
+	.string	""
+	.string	"\007\b\t\n"
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026"
+	.ascii	"\013#\343O\016`]\317\302\005J\013qd@{B\0137_\362s\024z\001$U"
+	.ascii	"\fT``\b\214\213\242\002\033.**\003:a0\023\225\335\360\005\030"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.lto.5145a3aa791191ba,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_intFeatureSet.13.5145a3aa791191ba,"e",@progbits
+	.string	"(\265/\375`p"
+	.string	"\245\t"
+	.string	"v\322B:@\305(\035\340\353hq\356a\341\311\327\307\237\341\260d8\340\204\025\b\225\262\034z\333\220}_m\250\262\341\304\322r7\026\345\244$\260!\026\t\372/\004\267CZ\273\311\226)\0050"
+	.string	"2"
+	.string	"0"
+	.string	"\227\b/\270\\f\037\270\\\032\264W\f(\002DP\257\226\335\235\321\343\340\025\364O\362-\245*]1\016\273kM\251.\356x\333\t\266\033\354o\001Q}\314\326AP\262k\021\003\2600\211\002b\373\031\333\032~\004\274kt\201\335U\n\203v\351P\273\332\0179\013|\213\344mw\203u\262\033.XA\013*O\261\2304f\031\0375>"
+	.string	"\n\343\364\327\004I\373\360G\227\313\307\007\223\n\r\223\306\354\260\244\221\303~\266\273\353\270\262\337\372\345]\177\026\325\032\240\356\023\205\270\216\243E\2008O\346\215\246\373D!\256\343L\210\016\347\343m\346\247\303y\346\346\003M\315\201=\211\356\233!\317\373f&\334g\033W\226\0310S<Y\243\006\017"
+	.ascii	"2C{\025\030\027\210\250\303\206\352\340\263\217\364\255[.\274"
+	.ascii	"\3050/\b\277\251)p/\230\232\022\356\360\242\235d"
+	.text
+	.section	.gnu.lto_intFeatureClear.14.5145a3aa791191ba,"e",@progbits
+	.string	"(\265/\375`\200"
+	.string	"\005\n"
+	.string	"\026\023E>0\307(\0350\277\312\025\227\177J\331\023]=\253\017\355\214\001n\210\2442\374\250\\\233>\363\266a\233@#1\312\206'KV(\300\210"
+	.string	"\fT\240j\002\016\261\001CjN\030\331D\312\224\0022"
+	.string	"3"
+	.string	"1"
+	.string	"\226\310\036!\316\200=^W\300\036\r\332\006\0326\020"
+	.string	"\224V\013vWS\222\203O\320\377\312-\246\223\350y`\261\273N\323\311\343\326\333\216\260]a\337!VM\247\246\237Y\022,\034\330\355h1XV\024`b\373\027\333\031^\005\274\n\364\204]\024\001\212\354\321a\366\264\177r\024\360\251\220-\273\")\001v\303\2117!H\275\252\276A\351\203\224-c\232\232\003J_}\241\254\304\007a\217\327\013\005\034 \243l\331\241(u\304\376\265\273kE\331O\375\330U\177\324\f\036\316\373|\033\247\3112<\033\347r\006\303y\237o\3434\032\306F\323\3512Zg\263q\264\214\347\3210\017\35648O\373\272\316\323.\341\376ZE9\206\260FJ\262j\026\b\020"
+	.ascii	"2\241\025\034\030\027\b\252\303O\365\210\325b>\250Y\237e\351"
+	.ascii	"\032P\f\243\201\360\233\232\002\367\202\251)\341\016/\332I\006"
+	.text
+	.section	.gnu.lto_intFeatureClearAll.15.5145a3aa791191ba,"e",@progbits
+	.string	"(\265/\375`\025"
+	.string	"\205\007"
+	.string	"\262N56`m\322\001\300\025a0\2217\007\353+@\027\267\367\232\350\204\001uP"
+	.string	"c\033\352<\330\210\251@_8v\"$IH\267\302D$\261z\035\004\372I\334\233\354\235R\032Z7\232E1\312\327\205\326\215fQl6`\260Lv\315\f\306r\230W\325\314\213\201\263\007Z\247\226euV\335~Z\3109r\214>0\302>G\372 \020\234\207\202\341w\344\343A\006I\345\363Jv\347y\320\302\376\264\273k\310\331\027\375o\252D,&\273\024\245\225\035\305\022\215\312\366\237\375\216{l\027u>\260\313\215\220\354v\nN\240\036\335\335\"\037\251\023\310GovJ\201\204\300\311D\biw'\274\370\366\267\371\377x"
+	.string	"(\344\371\003`\330]?P\250\342\206\267\215`{\301\366F\t"
+	.ascii	"2C\003\0258\036\201\306\004K0\344\022l\263\232\022\356\360\242"
+	.ascii	"\235d"
+	.text
+	.section	.gnu.lto_latchActiveFeatures.16.5145a3aa791191ba,"e",@progbits
+	.string	"(\265/\375`\022"
+	.string	"M\007"
+	.string	"\322\21525`m\322\001@\337\r\324\022k0Vc0E-\205"
+	.string	"\201\251\267\"%\324%\303u\f\264\355\265Xha \250\270(\"\006x\242#\\k\002\321\307H6\221;\245\276*\230\364t,\330\0056`.\232xA\r\306\222\201\227\344\300\312\201\243\003&a'F\t-\223vjU\364HN\232\202|\365?\016\222\361G\216\233M\365\247\"\363\304\234{x\002v%\024\374\216\227\036\374\321\237!>\356\363\317\377T\177W\206\rRIs\233m\0029\305\260O\255\212\354;\237\"\270(\330v+\266\224=\275\021\r\333\267\234\331&\006\023\003%\024!(\273\0135\343\331]\346\237\343\0023\024q\007\260\260\273v3dq\353m#\330N\260M\n\n"
+	.ascii	"3\241{\037x\305\\\366Tr\210\252A\027\362\263`\307\313\020\341"
+	.ascii	"r,\332I\006"
+	.text
+	.section	.gnu.lto_featureConfigured.17.5145a3aa791191ba,"e",@progbits
+	.string	"(\265/\375`I"
+	.string	"\365\b"
+	.string	"6\022A8@\217\322\001\230.\201R\032\3415$|\203D\274\225,\277\241\237`h\335\b\374P\177\233k\017\n\366\230\326*?\303\360\250\222\347\003y-\002O@<i\225l\"eJ\0010"
+	.string	"0"
+	.string	"/"
+	.string	"\332\007\266C\333^`X\231eP\241./\256\022\231\335/*\307YO\226\377\220wTb^\260\211'\200\303\356:_\260\213[o;\301v\264-\013\360\261_\323tj\372\233"
+	.string	"KA\313\256\305lfW \212\207\355\225\275\261\235i\377\343 \253\307T\016\330\31509\331\375\024\334\321\034rN\260\035\006\232^S!\214\013\3033w\022\t\315.E\203/\362\021\223\337qhT*\377:\364S\333\341\025A\026k\345\314\376\274\324\r\373\332\356\256U\303\001\020\246\017I3\310\023\352P\247OH\024\037F\242\022\007\212\245\321\207\024A\235)z\016\314E\204\272x\342\270.n\276\326\r\225\323R\317\276jK\205zW\212\2273\007\b"
+	.ascii	"2\003\3020\275\341\310\241\262\272\313\250@\215o\342\020\246"
+	.ascii	"sM2"
+	.text
+	.section	.gnu.lto_feature.18.5145a3aa791191ba,"e",@progbits
+	.string	"(\265/\375`:"
+	.string	"}\b"
+	.string	"FQ=6P\215\322\001dV\025s\351q\024\r\221H\203\240<\023"
+	.string	"x7#U\324\333^\3372o\313T6~,I\214\314\3149\323\202\313\257\325\240\371\364\336\352A6\2212\245-"
+	.string	"."
+	.string	"*"
+	.string	"\207\266\315\32002\311@BUX\236\bk\367\213\212q\322\223\344\377\343\t\336\t*Uz\0028\354\256\023\225\242\270\365\266\021lG\333(\001NM\037\023\340(\030\331\235h\255l\n,\331\260=\262/\2663\355w\334c\364\225\310\226\335\n\r\222\335o\301\n\001\207\230\023`\207\327\007\260\331\362\245\327\324{\252\323A\036\"\3623\f\n\345Q\207~\b;\274ZT\246l\331_)\365\302\376\265\273k\2650\374\352\2774\003\020\236\214sY\313l\035\350\223m\232\370\260\321t8-v6\031'j\235'f\016\314El]\374p\\\027/\337\336P1&=\331\027a\251P\357\231\234\002\b"
+	.ascii	"2\003\302\260\200\341H\204\262\244\313\250@\215o\342\020\246"
+	.ascii	"sM2"
+	.text
+	.section	.gnu.lto_featureSet.19.5145a3aa791191ba,"e",@progbits
+	.string	"(\265/\375`k"
+	.string	"u\t"
+	.string	"\006\022A:0\345(\035 sK\203'\300L\022l\340\303\026\263k\300\254\200\237\350\205\3530\007\337\"l+\240-7\330\346\\\323\204\202\202l4p`\270C\315\254\341\253\250\343 \233\310\235R."
+	.string	"0"
+	.string	"."
+	.string	"\t\327h\227\331\013\264K\177v\313A\305"
+	.string	",\365\212\331\335\251\035\377\036?\377\255g@\025\305c\200\303\356:\202*\214[o[\301\366\264O\020\216Z\203\205\001\314\356E,\300\256H\225\017\237\344\256\322C\313\326vi\227\354\355\362\233\355G\373\"\037\371\31629\263\273\021\222\262\0332xA\3402\207\2452P7\371\313\344{XD\212\007/\375\t\3552\352]\327\254JXP4N1f\207\250\250\034\366\263\335]\353\312\326\350\354\254_5\006\021\"\016\224\231\263\351x\244\021\327\361L\210\217'\324qf\350\303\201&\307\023\315\r\202;\211\2167G]\347\315-<\275\365\007\220\005\340rR\2243=9\370\242\0325\323\017"
+	.ascii	"2\003\302p\036aUL<\bXR\354\256\262\211\244\254\246\313h\246\342"
+	.ascii	"\001\rH\205\240\304\352t\270\206\027\302$\003"
+	.text
+	.section	.gnu.lto_featureClear.20.5145a3aa791191ba,"e",@progbits
+	.string	"(\265/\375`\177"
+	.string	"\355\t"
+	.string	"fSE<@\305(\035\340\265^\254\253\273'\251\t\342\243\305\215[\260V1l)\217 u\006\346\371\251\370\032\331U\327\206*\033N\374\225\037\326P\300\230\363\020\313\026\246[<\336P#\233\310\235R1"
+	.string	"4"
+	.string	"1"
+	.string	"\004\227\b\307h\227\331\013\264K{v\200\207\033{\021\360\364\"\260\273SU\367\036=\377\255_@\024\305\243\245aw\035A\224\305\255\267\255`{\332O\bW\215\216\026-\265b\220\262[\0213\260*\362\244\303\017\271\213\364\320\017$\037\273\273]\332${\273\374f\373\321\376\352 \336Y%_v1V\260\335\220\301\013\001_\214Y5\323\210r\372\310_%\237\303\241Q<x\351Oh\227Q\357:F\365\0010I\231b\314\016\277\250\032\366\263\335]k\206\255\321R\243\263\263\036\021!\315'\363&\303\351F\"\r\2473!<\035\020\267\231 \217\34637]hf\016\314Ip\272)\342\270nn\241\351\255;x\300\n\b0\351g\251%\007\007d\032U\352\017\234.\002\016"
+	.ascii	"2\003\302p\301\3022\231x\020\260\252\354\016\301^$5t\270\314"
+	.ascii	"f*\036\240B\020\253\323\340Z^\b\223\f"
+	.text
+	.section	.gnu.lto_featureClearAll.21.5145a3aa791191ba,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"M\007"
+	.string	"\222M27@o\222\016pQ\312#\265R\002JQ\3204\214\032\2048E\222\021`\371D\201\355\330|j\317\nj\201\027\244iD\201\360\223d\214i\214\270\357\234\"\200j\232\020\231\002_\031L\333<\032l\023\0278\233Nv\305\016G\303\020/\315!f\n\316\0320-z\262L\213V\007j\251\t\035\026.+ \030\372n\325\355\032\262\335\215\037 ^E\245nDU\252\247\016\274\244T\230X@/\346\273\320\203\030_\200\204\027\017+\017\024\002\222\314Q\fL\236P&\034\177/HO\237\232V(\261J\375\347\255R\265\346^\245\235FVd41\322\222\231\021f\224\353\343nK\025\020\221$\372\002\0202\363'\"Qt\330\337\340?\370?\002\013"
+	.ascii	"2\003\302\360\024am\f\001\272\206w\207p@Eq*\362\345^p\351\026"
+	.ascii	"\355|\002"
+	.text
+	.section	.gnu.lto_featureMask.22.5145a3aa791191ba,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\035\007"
+	.string	"\"\31624`m\322\001\300.^\210\231\034f\321\020\272\024\357{\205\310p\261\202\325\303\004\241\336+\230\205z\364\205\201\240:\212BRX\226\374\025\330\337j\177\275\367\2262\245\2360\224\365\361d(M\\\330h8\325\0249\233\fC\234\254N\304\030\270j\240\254\350\251*+Z6\354nud\275`*\262\335y\310'`7\"\301\007\371\346\340o\374\371\001\224\317\376|\020\374K\025 aY\2627Q\352\205}\267\273k\035\331N\247B\222I\301\311\356DieK\036\t\207\355\220m\361;\356\021\362\3456\r\r\212XH\214\250\354n\361r\002\370\347>"
+	.string	"\3774\343\327\363\362\377q\207R\221\222i\020O"
+	.string	"\205\335uf\032\305\255\267}`\033\3016F\007"
+	.string	"\002\013\255\262\030\005\205"
+	.ascii	"\357\232\227\205 \303]1\265\223\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.5145a3aa791191ba,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"e\003"
+	.string	"\024\005\013\001"
+	.string	""
+	.string	""
+	.string	"\002\r\177\006\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\220\202\002\016\177\007\017\177\b\020\177\t\005\027\n`"
+	.string	""
+	.string	""
+	.string	"\005\f\013\300\204\001"
+	.string	""
+	.string	"\003\002\021\177\f\022\177\r\023\177\016\024\177\017\002\025\177\020\026\177\021\005\006\022\301\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n"
+	.string	"@\2171|\004\320\003|\003\276a\016\037\003\364"
+	.string	"\337"
+	.ascii	"?\\k\216\001"
+	.text
+	.section	.gnu.lto_.refs.5145a3aa791191ba,"e",@progbits
+	.string	"(\265/\375 ;\245\001"
+	.string	"t\0027"
+	.string	""
+	.string	""
+	.string	"\002\003"
+	.string	"\004\001"
+	.string	"\001\005\002"
+	.string	"\001\006\007"
+	.string	"\005\001"
+	.string	"\002\b\004\003"
+	.string	"\002\t\004"
+	.string	"\001\n\001\013"
+	.string	"\004\001"
+	.string	""
+	.string	"\004"
+	.ascii	" \350\226\321/g\264-K"
+	.text
+	.section	.gnu.lto_.decls.5145a3aa791191ba,"e",@progbits
+	.string	"(\265/\375`\206\b\245,"
+	.string	"*K\214\020Gp\\\322p\177\252\261r\214X\350\210\350R\005H\017P\027\306\360\371\314X\242\333\232\205\362\215\007NYs\233\235bbo\2337\362DT,%k\345\203\217|\344\222\275{\313\317\302\336\253\336\363\354\332^_Hl\262e\n\324"
+	.string	"\356"
+	.string	"\365"
+	.string	"\247\360K8_q\027~\017\340\350f:\375\220\215)u\275u\273X\354\362\025[\245nw\203\002\274\247\026\007V\232^\203\372\b\352\317\\|<\2704G)\264\212\257\360\233c\231\332\266\352v\203\324\2534\347\022\232\362\024ca\327\307Z\316[\230\352=H\267\337n\267\327\223\346\315\020+4\035\342\001\272t\201z\316\362\336\226\266pT=\373t=\366\351\356\362"
+	.string	"\235\312B:77lk\300\326\320\274<?\223\241\351~\036\243\346\177\317\317_Wq|~\266\222\373Y\n\030\223\377\013\322\303\375w\373\317\366\177\355\277\332\177\264\377g\377\313\376\233\371/\366\237\314\177\260\377^\377\267\376k\375\247\372\217\365\277\352\377\373_\350\177\231\377?qqqq?C\375\214\344\3271\b\314\276\237\3079V\320="
+	.ascii	"\252\333\207\031\233\n\345\2131\b\232\376\037j_\367\232d_\346"
+	.string	"\032\304\276\306f\253\234\312 \326\355\"\004\372\205j\326m\327\264]\321v\033\311T6\262]c\260n'\333mW\240F*\201X\327\270\262/S\311\354\333*\203\032\331k#\215ETd\253d\303Z%\020\373\032\225,\222\251\344v\333f\2620.sU\352\327\310\353n&\267\271\356\272\215\311^\313\320\246f\2525\265S\263\223\212\013\325\335\335\253\325\363\251\355q\217\355d\243\264FJ\335\317n\252\260\362\352v\367\215>\256\334\255\344&\273\217\255\212e\313f7\222\315k\244\221\351\370\324\356\224\216\355\215\216R\204\225\354\373\324J\350\342\3626\373\350\256\334\354'3\251\276\253\333\374\206\367*Y2\271\002\226Q:\320T\253\200n\t\024+5\262\256\240\272\246\214\241iqmSff|\326\323}\306f\251\371\266sZB\205\fM\371\214\237\274\266*'\0264\345'\312jx\315\371\311ivH\227\237i\267\2219\001"
+	.ascii	"\346\004;_L\214T\272\364h\224\3726\335\330\2169\250\021\365\354"
+	.ascii	"d.+\3437u[Ib*\351:8\252T\317\374\232q\331\fo\245\310-\255\214"
+	.ascii	"QE\351\355\255{\351\300\347\313\326U\330\234\2600\026S{l\307"
+	.ascii	"\211&\351|\333Yl\247,J\023\254\247\0301LfLS\375\202\363\264\034"
+	.ascii	"s&\223\343\262\262\362\374\002\003c/u\355\316u;i5\331\206q\214"
+	.ascii	"\255J=\177a\256s\227\313]\354\305\235\354^v\016-\313R\363\255"
+	.ascii	"\227K\237\256Kj\2101\314\331\353\237`\341i\273\356+\335}\240"
+	.ascii	"\247N\226K\004M\031\f\277\314\036iW4}\033W\2410S\022\007M\317"
+	.ascii	"@\324\037\375u\335<v\334N\036w\347\2357\202\020\302\004\210\022"
+	.ascii	"D\305\240\013\342\2578\364\0028\024\026\005\211\303\242\336\213"
+	.ascii	"\244\237\210\037\241p\303\256\205\017\217p8\344\220b\207E\220"
+	.ascii	"(#(\304O\bF\260\230T\243\204\200\340\214\243\"p\203\021\260\370"
+	.ascii	"\023\n\t\205\033\002\020\177AaQ\357\300b\260D\021\351\210w\340"
+	.ascii	"\0211\210\024t\241\276\302\205\007\0270\320\340)\336\350\300"
+	.ascii	"\2071\202D\242\342pH$\372IJQ\324K\352\300\"(\\\361C\n\366\212"
+	.ascii	")&P(\"\035\311P\237!C\321\320\211\021\036T \204 QF\361\027lA"
+	.ascii	"\344\342\250\005\322\020"
+	.string	"H\204t\364\203A\004$&\021A0 g+\315\241\325\364\003\016\216_\rV\235\032I\002\344\211T'\3058\bb\342\214\202\203\003\207\335\0024y\270P\tQS\335\232\255\0177~\317\242\234N\332\260\261\261\330\216\334W\226\027.\261\265\26539\232\274\254+19\\ii\254\246\002\365\021\215\216\232\317\224Z\23144e\265\364L\2264O4E\253\320\320\370\354\203\213\340m\251)\325c-\200\266\250\241De\024D\"#\"\022$I\222tp\002\2211;n\021\220\031\262nf\244)Ji8o\231d\236\225\227A?@\341\f.\264\273\035\256\024\311b\361\205\320\036\332a\027\214\177\354\234\271wNS=\251\"\3552\\\337\353\254\367\305\317\353\235!#,\300\244S\261\\\321\346\032lC\3253\200\276\030\311?\227\215\027\031\332g\006\353\226J\334\200\211\325sz&\023h\346 \220=P\211A\241\003\210\365\337"
+	.string	"\344j\2216{JL\007\334\"\004>\327\243FXG\372\377t\236\311\354\350\301\322\353\336\234\216,<\245$+?\272v&G\320mp<\215\037\304t\024?f>\360\261t=Cex\262B\310\347\340\n\307a\324s\177t\370)ZR\301&\347\225\003{$.5\206\304\211l}\023\364\016T\361'u,\377\230\266\337'\002\305\261\301J\240\277\253\211\205\252\224\3773\366\367\233\216\374q\277<rI\212c\220\217&\261\303\210f\b\030\3049GQ\241\021\344;\205\b\313\2436\230\221\3328\351\240\260>K\034\304~\353\"\347e_\376\027G\366V|9\351K\276.\276\f>lO\370\007\362"
+	.ascii	"_\354|A\247\361\333\322\375\332`\357\273\277\237\213\371\036"
+	.ascii	"\0027\350\215\372\337\370\022\267\365\016\317\360LH9\366\362"
+	.ascii	"\033\217\315\337\272\346\371\235*"
+	.text
+	.section	.gnu.lto_.symtab.5145a3aa791191ba,"e",@progbits
+	.string	"intFeatureSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324"
+	.string	""
+	.string	""
+	.string	"intFeatureClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326"
+	.string	""
+	.string	""
+	.string	"intFeatureClearAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332"
+	.string	""
+	.string	""
+	.string	"latchActiveFeatures"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335"
+	.string	""
+	.string	""
+	.string	"featureConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352"
+	.string	""
+	.string	""
+	.string	"feature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354"
+	.string	""
+	.string	""
+	.string	"featureSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360"
+	.string	""
+	.string	""
+	.string	"featureClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362"
+	.string	""
+	.string	""
+	.string	"featureClearAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364"
+	.string	""
+	.string	""
+	.string	"featureMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371"
+	.string	""
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.5145a3aa791191ba,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,596 @@
+	.file	"parameter_group.c"
+	.section	.gnu.lto_.profile.9ffdc5d457a88465,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\005"
+	.text
+	.section	.gnu.lto_.icf.9ffdc5d457a88465,"e",@progbits
+	.string	"(\265/\375 \263M\004"
+	.string	"\244\006\247"
+	.string	"\f"
+	.string	"\322\266\221\333\r\f\002"
+	.string	"\002\001\003\002\003\001\240\342\234\212\n\004\352\263\360\321\b\005\230\204\240\345\005\004\002\004\002\002\002\005\002\002\b\313\271\206\370\013\006\002\002\t\310\206\210\300\016\f\003\002\003\002\002\002\n\246\224\252\221\n\013\323\230\332\233\001"
+	.string	"\f\320\300\217\316\b\004\r\352\203\346\245\007\016\245\200\307\327\n"
+	.string	"\017\240\342\234\212\n"
+	.string	"\f"
+	.string	"RTY!\200\232\241\232\3361a\001\024j\200\213(s~f"
+	.ascii	"@`w\323\006\260"
+	.text
+	.section	.gnu.lto_.ipa_sra.9ffdc5d457a88465,"e",@progbits
+	.string	"(\265/\375`\036"
+	.string	"M\004"
+	.string	"\002\206\017\023\240'\351\253\252\252\252\312d\354\323\267d\311o{\313\224\002\356\022f\244\301\036*\2773\001)\304{T\035\330\221\020S*\346\035\364*\300j\233z\244H\305\363\260$}\243\215\275a%^\b\037"
+	.string	"0\300\322\224\201\354F\306\331\247\265\231\023\366@6\204Pj\016\351\2153\022R\306\002\254\bs\025x\253\303\226e@\020'\205\021\245\"83\004UQ\214\272c7\274W9\300nP\r\001\260L6\247V\030\210Q"
+	.ascii	"7"
+	.text
+	.section	.gnu.lto_.inline.9ffdc5d457a88465,"e",@progbits
+	.string	"(\265/\375`\301\001\255\t"
+	.string	"\342\31732P\215\n\035\b\3619/\300^\332\\qS\271~\275\376\231Q\272"
+	.string	"}\235\235\257Z;\370\321\336\231\232\250\330\231b`((0\265\3457R\362\311\226;\005\257m\367\207\265\203\025\030\036%\026\003\242 N\034\327"
+	.ascii	"\231\252*\315\301\322H\204\310(`\314\332v\234\252\275\273\017"
+	.ascii	"\215\024\0056\206\301\327\364\252\373\024\220$3+_.!\353=}\030"
+	.ascii	"\241R\007\375\363T\002$\344P\260\345\2623\314\233\366\352\r\342"
+	.ascii	"\255\256\346\322\372\206\314\004}e\004\374\352\375[z=\303+\275"
+	.ascii	"\361\3534#3\261\257\373\013PN\333\356[\333\360\317T\230\231y"
+	.ascii	"}\002^\230\234N\262\205N\200:B\b\246\\N3\323\302\372OEi\"\031"
+	.ascii	"\364\357SQ\311D\032x\313\335\b* p\002\241\261\342\003\031\241"
+	.ascii	"\271\3408f\322K9\202\376\272\231A\212\3216\254\305%\t\033\021"
+	.ascii	",\330\231\271\34164\035\254\273{\313\341\262F\260f\377\022FC"
+	.ascii	",&\026\236~\206\275\205V\210Ugp3\3075`\266\370P\330\330\346\242"
+	.ascii	"\225\307\314\267\013\213V\330\326\\\2142m\362\277\236-\t\247"
+	.ascii	" \205s\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.9ffdc5d457a88465,"e",@progbits
+	.string	"(\265/\375`\033\001u\006"
+	.string	"b\212\035#\220'I\007\177}ry\007M_\363\377\377\0257\316\333\335\335\221\345p\016>\212Zk\255YH\354&2\311\264\031\364\f\352\034(2\302\037|\0344\253\324\373\302\177\031<w\327\252\210\332\321\221oAZU\373y\202D\355|\022\270\273S\b\316(\325\214\3362\340?\007\305\022\320R\033|\301/\367\3448\025POnk5\274\232\311\255P\321\323\262\370\032H&\026 # P\242A\f{\270q\006\035\034\204\241\302Q\264\261\016\242%\304\375\007bW\f\2671\320\376j\2543\034\302\3246\214;\036\230\013\340\346F\216\006j\320@\316v0D\004"
+	.ascii	"\242B\227\340\350\301\266]\333_@07\t1\347\253\3270\306B\210\200"
+	.ascii	"\211\314in\b"
+	.text
+	.section	.gnu.lto_.pureconst.9ffdc5d457a88465,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\230\004\005\231\004\b\231\004\t\271\004\n\231\004\013\230\004"
+	.ascii	"\f\231\004\r\231\004\016\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.9ffdc5d457a88465,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"\205\004"
+	.string	"bF\026!\240'\351\340\330\377\013\321\025\327UM\257\372\353\032\354*&K_\022\260\237\336\376\377MZkD\356\024\257\205Q\311K\255\205Q\350G\024\016\306h\020\207\220y\366\206\312\342G\006\177\005\337\251w\201\336\243\307\001\016xPi\022\254\335\312\n\315\314\357\033\265\247\236\241\t\236\376F\026"
+	.string	"k#ja\032\320j\306S1\272\036Y\301"
+	.string	"\332\025\203\0360\300\224E\226B}U\f\020\f.\2302"
+	.ascii	"\35595CSR\204\n\275\345\026\213%\003(\002"
+	.text
+	.section	.gnu.lto_.lto.9ffdc5d457a88465,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pgBuildRegistryIndex.8.9ffdc5d457a88465,"e",@progbits
+	.string	"(\265/\375`0\004\315\033"
+	.string	"\266\363\262I\240\330M:\220C\024\346\325\312\025\275b\217\302\345\320\377\3707s\013c\230fc\303\001\017\fo\266\312\254\344\263\316\320\227\344n\370\352\305\363\021O\216\361r\274\204o\001\372J\221\360i\211\017\214\246$f\263\226\020\262\267\224I\006\234"
+	.string	"\224"
+	.string	"\244"
+	.string	"{(\247?\375<\270X\263\016+"
+	.ascii	"\211\204\325ZkN\327\001y\212\3405\361t^F<\335E\261K;e\332\317"
+	.ascii	"\256\225\007\223j\204\252\337\224\226Z\253\255m\274\316}\035"
+	.ascii	"\313\262,?\203\337\261\177N\312F\221\316\346\237\375\217\007"
+	.ascii	"`Jq\222\214q\331\034U\264`:\227\213\242\2113\026vu\250'\330\341"
+	.ascii	"B\006\217D\027iC=\246\263\243\200d\001\030\362M\tM=\224.u\026"
+	.ascii	"\032R\301SG\214\367\241^\253!\364\252\032\":\217\024j\255\313"
+	.ascii	"AC/\276\263\357\256\325\356f\330m.\001Vd\262\236\265P\315g\315"
+	.ascii	"bO\302/ \036\373\254\265\326\271\335\273\333\341Cr\006\222j\255"
+	.ascii	"8\373\252\013\321\355\227N7\204\017?\310G<\035.\365\274\252\304"
+	.ascii	"x\\v\007\241q\204\325\215\264\033\354\361E\256\247\337\366\321"
+	.ascii	".\345\255Q\336\031\031\312\033Cya.\f~e\223\227\234\274\343\344"
+	.ascii	"\025\233\2272\357l\336f^\276\360\373\001\032~@f\234\324\332\242"
+	.ascii	"\354R\237\320\253\034\027\376\301\363\356\207\267\232Rk}\323"
+	.ascii	"\251P|j!\330\240E\355\245\204>\254\036\220\007\006\237:\222\200"
+	.ascii	"\371\214h\357\356\211o\345\b$i=HL\326\264\307\251,\276\341\322"
+	.ascii	"\302!6\322\326\032\246/\365\023\301\200r\245k\013\210\307\366"
+	.ascii	"X\217i\230\341\346|\311\207+\271\021\370\312\212\351\017\037"
+	.ascii	"@J\351@y\r\342L\327\232&\313\257\250\307\345\236js\236D\207F"
+	.ascii	"\b\004\273\331]\022Gr\023\253\200F\300Z\201p\216\374jg\362\340"
+	.ascii	"D\017\342\351L\237\352\\$\004\20259u\317\376\357\013\217K\023"
+	.ascii	"/\222#\255\272/E\345\212\307\345\332|\326\3344Q|F=.\271\253J"
+	.ascii	"\324\2206\322\226`\361\245\271G\245\313\241\303q\337\233M\317"
+	.ascii	"\b\335\216'g\267#b'\247\263\323\351\261\361\3406\200\320\335"
+	.ascii	"l p:9\333m\347c\263Q\260\272\236\235\235M\204N\267\263\321\202"
+	.ascii	"\274\367\321\032\331\022\306\353\336\376\026\304\275\224{Y\330"
+	.ascii	"/\355\005\f\214A<\375\217\263\017\246\036Xx\\\256 \033i\377\033"
+	.ascii	".\255\033\262>\332\006LD\231\356/\256\271\254\205H'\341\202\357"
+	.ascii	"\22686\331\367m\365\336\205\263\341\342y\202+\220T\253\357A\373"
+	.ascii	"&w\222\001'\236\216M\243\370x\364D\001^>aj\306\216\221\316z\347"
+	.ascii	"\254\371[h\227\301e-\323\207\nL\250!0\246\234B\206\b\006\311"
+	.ascii	"\210\314\004b\234\003\220\002\231\"\244\007\022\340\206-\006"
+	.ascii	"\016E\266\353\377\031\205}\205\244\200h\310t\222\035\253\241"
+	.ascii	"\224\263\277\327\251\314\rmB\234\n\022\004d\217\371\214\241\303"
+	.ascii	"\016\346\224b6\251\242\233\fA|`\245\333\204\341\036\201\271\373"
+	.ascii	"\237\352XVb>O\247\312\352\263\266\\\013-\271\370\275\220'~\255"
+	.ascii	"c\016HW\020\300\325\223\341|\203\0250\365]\332<\262e\270\334"
+	.ascii	"\236\350\202\356\343\032T\334Xt\3775\370\356\f\\\346u\177\244"
+	.ascii	" K>\246$\301\033\207\\\352\022c\n\343}\344K\024\300\322d\246"
+	.ascii	"\177"
+	.text
+	.section	.gnu.lto_pgFind.9.9ffdc5d457a88465,"e",@progbits
+	.string	"(\265/\375`\016\be/"
+	.string	"\252Q(\022E`\232N:\0370\307@\b\336yy\365\377\352m&\347\340\372\306\360\365v\331\225N\365\344LR-\246\026.`l\rrt"
+	.string	"n\216\322\025\\\240\006\276P`\305"
+	.string	"\376j\225\305\230\265\005Z[[\333F\b\221;\311\023\001\371"
+	.string	"\022\001AV\322\266\013\002T\252\006\247m[\006_y\302\360k\220\332\227\371Q.\205\352R\031\274\266m\217\271+m+u\300\021\206_y\356\241\\\215\212\253\006H\313\274D\200\301r\203\323\266\322#\226\036"
+	.string	"\373ux&\373\265\2050s\222M\002F7&\t\030\035\340U\351\231e\244Z\365\245\222g'\211<6\215E\342P\310\256j3o\025\177\306\227\305g\230\032\245j$f\360\217@\330\f\261\243q\r\271<\352\022.\217\206\203&es\216\306Uvw\374\270x\300\351\270\311\261#\203x\211\375x\3455\366\246\037\227\031\336\216k\024\"\251i\3208\261\027\205~x\205\235\250.\b\274ss4\2560\025\300\r#Y~\\`wx'\221\013\223]X\317\313\236}}\025^\361\251\305\371\341E\344\252Za\255\311\220d\027\r\265\251\300\345\275\356W\253\313\352\366\360\353L?.\250\032\324\266\355\341.\204\306U\344^!R\333\266|\263\272\274\316"
+	.ascii	"\316\374\036\314\274\202\231u\023Q\376{p\2541a6\031'h\317z\354"
+	.ascii	"\373\004\333\236\325\225\303|/O?]\230\270<!\313\332\366\352Y"
+	.ascii	"\374-\317kRo\366\225\235\236\330g=\261_\337\207\373US\302\006"
+	.ascii	"\370\226\366\274Sf\351\363v\224\371\024\312\344\240\341&cF@\274"
+	.ascii	"lD\274|\200x\271\210\210xyH\210x9\b\210/\377\\\372\373\020/\367"
+	.ascii	"\030\340\313M\346R\311s\272\363\316\357\316\311\276\214\034^"
+	.ascii	">\276\355\\d/\023\373\362pxY\330\227Y\366\362\372\267\263*\274"
+	.ascii	"|\331\313O\320\344C\215\037\231\006\224\2667\246tZ\276\025\357"
+	.ascii	"\310\357~\272\277\355\177\273\312\374,X\270\357\334\360\356`"
+	.ascii	"|\200\266\026\354\254\260\202%\217\343\327\361\351\252\220\236"
+	.ascii	"5ZU.\355\212\032\322\345>\307l\344\030\217\343\235)t\306\030"
+	.ascii	"\314\306\257\315L\305w;\034\033\337XK\020\261m\177L\221T\030"
+	.ascii	"~e*g\243z\033k\tC]\224\205\223\316F\251\325\230\241.\270\224"
+	.ascii	"a\313lL\255m\255(\354}\315P?\213\260\207}\244\007b\030\266mK"
+	.ascii	"\201\217\346i2h\340\300\201\375*l\344\235[\034\274{\326\302\262"
+	.ascii	"\r\324\367\313\325\023f/\233\355\343]\245\003\315\273\032{\366"
+	.ascii	"\337\031*r\306\265\r\364\353\260\006\235w\312\t\326\376\027\024"
+	.ascii	"\356J\357Y\fp\231=\200\270\317b\2467|\317\236A\214\256\215\021"
+	.ascii	"[\260\267O\260\231\001<\231\026|3\0161\342\216PV!3\266\006u\016"
+	.ascii	";\372\241\276\300\"\302\216\362\204.+Q\023\2370\231\351\311\201"
+	.ascii	"\262\265\302<\r\377\224}Lc\323\263\272r~\261\306\350\346\260"
+	.ascii	"\035=\223U6\221\312dK\336\225\222\347\235\3363Y7\332V\265\225"
+	.ascii	"\275\323Z\214\314\003\342D\355hP\373\364\353~\034a}\202\177e"
+	.ascii	"\200\246/\301\366tP\017h\203\005\275\035'\035\214\322\260m\255"
+	.ascii	"$\360\367H,\361\315\252\330\257=}\273\023\325`\302\006]\213\342"
+	.ascii	"<\234>4:\335\001\254\002\205\023\213"
+	.string	"nb\232\352\030Q+ZE\223\223\n\025\252I\252y\351\201\024\214\250\251\246\244)\246\027L,\224\246\224\244\216\232\234R@E-\035A9)\2618Z\232rq\364\240\210\243\244\230\246\216^DEM\035\031\331\371&\343\3423\f\313N\371\023%\r\234\235\360_\316\352N7\233\315H\316~\006.;:\255j\226\265\255\325\263\006\227\214\312\352\374\364\006\260\274\254/a\032\300-eG\331\250}\004\304\215\361!\370W\346@\033\315q\322\347\240\270\234\2456\333\n\023\347@\177\356\330H\023\177\343\3468f\b\236\363N\317\234\346\360\342I.\233\207\330+O\023\373\t\230\035\326\240\263\311N\023\250\031Ylfkqs\331\254\"\325^r\331\226\0206\275\253m\333\266I\365\210`\030\346\314F\321@\027[\213\354\314\312Q\350\302\221\301\"\203\253\022\374\274\020A\342\235hvf\304\b\324\311\326b\325\310l\004\r\236l\241\356"
+	.string	"\005,`EL\360\330rbd[\232M\306E\355\243\344\363\353\023\374\333;\337\003\200\241\250a$\003\2254\312\314\210\214\314h\2224\006P\002!r\256\314\003\022\200\246E\007\325\321\346\376\277\001\207\336F;D-\335\343\027\254\361\301\022\316\200;\345g@\177\021B\b\226\230{\232\356"
+	.string	"\304~\246m$\313\037{\241\303V \230\334W\232\264\204\250zJO0\211g\224D\227&\204[\346\261#\334g\322\003\244t^Nn\373\250\377\240\236\0062\007Sd\222\335\002/\344\265\236\321\304\265p\317B\374\341\337\205a\342\374\f$\273<\344\224\274\\6"
+	.string	"\223\"k\2406k-\350\306\3469\223\326\302\264\r\035R\032G\334\227\317\016\f\023S\004H\n\034\355\004\\\302\270\216"
+	.string	"\214\017\b\217``c/$\032\354\3631R\263{0\267O\327#~\261E\243\312\266Z(z\376W\307\017@a\200\313\360\3511\024\337\3418\323S[\3645\314\361\224\007\330!l3\013xlH\314"
+	.string	"]\222\346\315\352-\235\007d\334q\204\210\233\001\271e\234\200h\026*I\353)\007\371&*r\213-\221\343\224D\265Z\031:W\374\004)\200\332h\330\003\024\207\246\363=XS|\205\230\030\270*"
+	.ascii	"\026\223\270\341\031t<\205\217/\027s\326\274\236C\234\207\201"
+	.ascii	"\263\307\b\027\317\263?\332\215j\316H\260'\341\363\210\230j"
+	.text
+	.section	.gnu.lto_pgResetInstance.11.9ffdc5d457a88465,"e",@progbits
+	.string	"(\265/\375`v\002}\024"
+	.string	"\226\245\205I\260\324Q:b'\214\031m\007b\310\360-'\341M\251\227|5A\353R\t\252\265\360+1\030\350(N\246\355\177[\374\001\374QJ\313\252o(x\255\021/$]7\350\3653cy%\316t\342\f\370\227\240?!{K)Sr"
+	.string	"f"
+	.string	"s"
+	.ascii	"A\216\272\177\013\336@\245\363?M\tu\252\024%\324\371\332?D\177"
+	.ascii	"\275\026W\374\354h\034\351\356\026\263\320\232\212\341\224\274"
+	.ascii	"\265\253\330R E\021o\264\251\030J\224\023FO\254q'\025<\301@\261"
+	.ascii	"\032u;\031\3540\361F\023*%\202\"HFRrZ\360Vcn\2315\342\310\225"
+	.ascii	"\356\326\031\272\"F\334\256\330\322\335_\336XB\257\322\3777\377"
+	.ascii	"7\374;\"7\241\316\022\326!]\235\036>\246\202|\267\r\376?\334"
+	.ascii	"r\317\257\262\273\373\314\363\253\366,\375\251\232\250\366%\352"
+	.ascii	"SU\211\373\031\356e\270\347\271_\271\327\023\221\204\223\n\221"
+	.ascii	"\356\234\340T7\315$\027\377\365\n\324!\033\025\272\350"
+	.string	"\264\003\250\273W:\177\233\177\245SW\377\367\007\"\370@\367W\031\032TS\337\215\006\350\346\t=\327\034.UJ\242\300>\340Rn\245t\273\333\306?r\035\350u\353\224w\275\2418*\310[p\205\312s\205/@\246\334J\375\307\240F\031R\200\374\032\264\206\213NV\257\273\227\347\213%$\276\223UN\240&\374\303b\253\274\257\350\330v\026+#-\341\240\212\222\020\b\252,,a\026\013P\332\351\3406x\035:\214\026yPu\347\034\\\211db\256?\001\357\020\243y\275HY\214\306\207\261\314|\230\321d.\264XM,\346E{\315\264d0\034df\260\226\f\314+\246\005\243\321\264X\f|6\023\243\265jf3Zk\365\273\251l\3469\204\261\351\3068q\300N\311_\301\231\2546\226%_\330\211Z\037\025?b\204\021B\346\020@!\313\3145;P\273$\267\r\236}\204\212xL\225U^\2260\001"
+	.string	"QT\223\216m\327\021\004\324\223\0343 p\002\2311\345\001*\nA\361j\033\262\030-\323\f\336r\031\347B\267\320%\340\230\353\201Z\251\246\306\313\366Y!\325\245\213\213^&Br\270\352fL\341\030\020`\034VW\333u\241\255\200V$7l\222UcP\2545\020y\034b\247\024\003\222\200\005\026d\314\202x\214\211\003\321,\\M\241\227qD"
+	.ascii	"\2152\274\004{\204u\256\"fc\352_\277\316&\2042"
+	.text
+	.section	.gnu.lto_pgReset.12.9ffdc5d457a88465,"e",@progbits
+	.string	"(\265/\375`c"
+	.string	"\235\t"
+	.string	"\246\223E;0\305*\035\036\276\374u'\372\222\223D\320\210lK\203N\201\032-G\022\311[\242dj\033FY{;#\030!-a\205E\006\231h\342\352\223\214\353\003~\2168\240u7\271S\n2"
+	.string	"4"
+	.string	"4"
+	.string	"\232K\207/\300\\jN\200\2714h\263<\344\330\217\324(h"
+	.string	"vw\352\306\301G\320\277\354\033\327k\365\230Q\330]G\327\313\342\326\333\346\330\366\330\036\020\326\307\376(3\030*\006)\273\0257\001k\223'\036\276\310g\251\207fX\371\330]\356\322N\331\334\3459\333\217\366A\036\002>\246\372\300.\254f\262\033\"8!\017\361._v\201\222\013\333\204\256\374\231M\247\2414\273\022\036\237$\002\302\357\270\364U\230K\325\317\316iA\t\020c\305\233\035\266\242j\330\277\354\356Za\266\306\241\356S\203:%\224\367\205\032\276\356\324\215>\337\2474C\"\007\222\007\232$\321g4A\237iv\016\354\225\272o\236<\357\233\\\310\372e\025\346\205\f\033K[\336D\325\250\266\027\t"
+	.ascii	"2\241\005h\240\203\013'.\243\231\212\007\250\020\315\3524\270"
+	.ascii	"\226\027\302$\003"
+	.text
+	.section	.gnu.lto_pgResetCopy.13.9ffdc5d457a88465,"e",@progbits
+	.string	"(\265/\375`\021\001\265\r"
+	.string	"V\333aE"
+	.string	"\221(\035;[\311N\256\2449\375\021\203[P^5\241\324bzH\177\320\270^$\033+$\227\177\013\324d \225\217\020H\222\003~\275\024\240\252&]\352\016\2331(WzC#\366PzO\b![\312\224\002N"
+	.string	"O"
+	.string	"L"
+	.string	"\307\034\376@vl\273\201\354\230mG\230@2\370p%\345\251W\210\226\315n\310\351\211\203\217\232\240_z\324\032\035)\231\027(\022\327\350\240\004\212\227\001(SD`\003\206\212\267\236'(\223L\rdw\235'\324\210\033\273\355\f\266/\330\367\020\177t:c\372\001*\320\330\324(p\355\246\334\360X\030L\006\313Y\277M\362[\346\330f\215\276 D"
+	.string	"@I\315\240\331\r\037\034\263\205-\206wAz\013\211\261]\023/\024\266c\0042\323>\213\267 }\345\034/\260\253b\211\261\033B\260\204-\233jjs\b\345O\026\340Z\001\363AK_\245\230YQU\261?\3124M\2002\343r\303\224;\274\345\325\356 \222?i\272\300\244%G\275\276\365\00658\\d\\=J\362\306\016K\251*\366\343\356\256Ue\177\365og\335\332[\002\240\317\247\"\220\247$^\347\211\366|x\243\356\003i\370>#\237P\347\353x\034(d\203\250\363p\242\220N\210\363|\"\334\007\003w\336\347\343F\272\356\3438\341^U\316bj\270^\351\203\331[\307\020C\303\365\322\037\314ROl\247\032\244DM\"'\003\020"
+	.ascii	"i\b\030UGa\303\212H\033;BP)L\200\356\032H\266p<A\234\205\273"
+	.ascii	"\230\262\277\251Qp\031\343\324\210T\325Pt)("
+	.text
+	.section	.gnu.lto_pgLoad.14.9ffdc5d457a88465,"e",@progbits
+	.string	"(\265/\375`\347\001\r\021"
+	.string	"\246`sH\360\320&\035S\201G\030\207i\241\237/n\345n\322\b\337\007\271\363\300\264\223\241\n\2535\030d<\364\0256B%n/\235{\332\252i%z\277,4\r+\347set\347\372`9\003\362\221\tj\352\326\b![\356\224\002\\"
+	.string	"]"
+	.string	"^"
+	.ascii	"\322>\315kX\217\261\\\300.L\207\266;\202Xd\364\315\343\013p\337"
+	.ascii	"F'\300}3\313\276\3611\305^\366\003\343\"hw?Eq\326\247J\226\377"
+	.ascii	"\331I1\257\226\317Q\210\353\024y\t\032\001\340\345\232&!\230"
+	.ascii	"\032\237]rx\265\244\354 \354\256e\314\013\304\275\335\266\004"
+	.ascii	"\333+[2\b\235t\3517?\3518\177\307Is\217\375S\245\377\321\351"
+	.ascii	"\240q`\306\356\207\242\241\355\331b\254\260}\377\305yR\236\343"
+	.ascii	"\315\006(\305\366t\276\263\362\034S\340\341}\263Wl\357\233\364"
+	.ascii	"l\034\327f\200u\235\360\020A[\\\306\372\215k&\355\232\030\242"
+	.ascii	"\355.\210\037\214\276!\230r4\016\033\016\036>3\"\323]\343<-\251"
+	.ascii	"\201\332\006\242\226,\362y|\272\f\224\247\347y\002\031\232\226"
+	.ascii	"\210\017\311\351T;\245\222\217\361g\257P\303\242G\216\027m\361"
+	.ascii	"w\234\341\264\325h\327\325\300\207\241\022\372*X\270o\234~\347"
+	.ascii	"R\246\003\214DM\314E\026\331cK\352\214\375\271\273k\205\331\037"
+	.ascii	"\177S'\355\005\306P\022\252NDP\245\0035\250N\346*\024If\n\024"
+	.ascii	"\325\250\020\223\224PL\215\210 \n\270:\211'\223/\245\")\tQ_\211"
+	.ascii	"\352\264\372P\342\311\027\242\300\241\t(~(a(~\336\350\362\271"
+	.ascii	"\n\363\204\035=.\332\232\003$IM\026F8m\261\017-VBu\306\235^/"
+	.ascii	"\310~\\R\310%\275~\366\0056@\262\" \200\202\021Yu1\007/(\216"
+	.ascii	"Y\375\242\035\335UQ\3415\213\366a\035\033\256m.\354@c\305Czw"
+	.ascii	"\222)\023$\210\306O\024\203\t.\002)\0068\212\317\221>\334\241"
+	.ascii	"\271\340\\\3012\260\257,\214\033\254\351\236\303\002$\264\274"
+	.ascii	"\034k\222\006\306\366"
+	.text
+	.section	.gnu.lto_pgStore.15.9ffdc5d457a88465,"e",@progbits
+	.string	"(\265/\375`\211\001%\017"
+	.string	"f\335eD\020\2214\034\340sC\230\031\215\250\314ZH~UD\b\277\027\334- W/M`\006\201\006\305\222\264\304\360\363G\222\373\270I-bS\025\240\002"
+	.string	"P\312jE[\255c9*\243\216{\007\331{\357-eJ\001O"
+	.string	"P"
+	.string	"T"
+	.string	",\032<\355\263\2162\2728\362\215\335U\211\226]\261\303\013\270g\0269\333\276\210\217\030\331.\230\370!u\0164N-\231\335\365\f\234\200\366\f\373"
+	.string	"\355\231z\370\3509\362\337:f\242\032Q)\322s{\260\273NT*\303\255\267\215\3006\307~L\232-\315m\351\355*\277v\361\3174\255Z:5\375"
+	.string	""
+	.string	"0\264\340\200\331\2750\326\330\227LE\b\337\304_\242\257X\223\232\221\021\331\035\313]\"_qF\032Mv\267\023\261\273gi\217\354\316\266\346U\354b\315\356\206\027-\273\333a\007\231b\030\001z\327Sea\245\341\204\245\232\nT2N\232^U\235$1\233^\337z\202\324\f\t\030\226\031\216\361\035\215\323M\013\270\234JL9\372/{\216b\002\267[\201\201\177\"\364\361A\214\350_\317\222\025.\306\023V)G[4\245v\260\217\255\256l.\335=\345\017\226\360Q\360\204``(;_\250\346x\200D`\330\371\b\277\320\367\331\204\033\220\327\361D"
+	.string	"\0019\036\210g\363\3618a\210\347q\300 \350\013\275\020\b\206\236\305\322\261\325\225U\300i|)\251\311\033\231\332\251F\355\217M\036\345\267\016\001\345eF\f\022%\371.s\236\342\353\002\035"
+	.string	"\214*A\264\335\202\277;\210\265kQC\323\231\346\202\262<T#FW\025\210}\206\355\345\260Vpa\334\232\265]3\366\200\215B)\237!F\320H\364\b!\032\022"
+	.ascii	"+\202\252\001\367\3000\201\212\fN<\251VL\302$\003"
+	.text
+	.section	.gnu.lto_pgResetAll.16.9ffdc5d457a88465,"e",@progbits
+	.string	"(\265/\375`\007\001\r\r"
+	.string	"f\030YC\020q\224\0168\021\215\bh\213=Sv\016\301c\264\327\365\344\211\316\002c:\372\220G@\362b\253\254\275\256\367\261\220\"\204F5\360'\223"
+	.string	""
+	.string	""
+	.string	"\004\004\263ZA}\325A"
+	.string	"\2010\336\f\344\223\275\345N)E"
+	.string	"E"
+	.string	"C"
+	.string	"V\312\tK\214\224\023\026\324\343\274#\364\\F\205\036_\345\005\276U\347}.\343%4\n!\300\013\305\016U\252\345\363\220\304\003\3018\302\344\372y\004\037\252\363L\016/\rv\327\260\3632\334\326mW\260\275\300\276\203/\335\267"
+	.string	"px\221q\261;Z\325\330\223l\021\361\322\355\227\360\24717\361\023\236\227(|E\0306F0JR\2733\301\245\025\\\227\236'`]^\037`]\036c\217-\343\363\333\233\272\013&\032\273\213\351\007\007\021\342A\\:\204\263\336]\372\234\006\360\200\242\305\bT=\356\356F%\331\316\250Tk\306\207\022\221"
+	.string	"\301\225#\274\332\022&\300w\376\374KV6\234F\364\243\272\202E\310S%\331\363\003;>U\312\212b\313\234lSo8:\234\266q\036l\231H\366\241\3314\035\214\343\001\001D\333` \036\232\017l\263\205`\034\006\254u\262\r\023\321\264\r\303\314\275\242\250\374Z\351p\262\240 \251$3\320\240R/*h\215;\360]ITp\327\256(\305M\001\027"
+	.ascii	"1\003\373\274\203\35287\246\026\315\035\273\237B\212`B\023\207"
+	.ascii	"k\244\216L<\230\221\340nK\237Pv\350\226TV\242_\256\b2\343\262"
+	.ascii	"\033\3143P\325 ?)w\256\371\004"
+	.text
+	.section	.gnu.lto_pgLoad.part.0.33.9ffdc5d457a88465,"e",@progbits
+	.string	"(\265/\375`\332\003\025\031"
+	.string	"\366k\232I\260\230Qc\260\364\304\017\311HWX\304\216\225\004\307\326\220)\202\227\227\226\033\324$\202\217\367\257\334\346\323\322VK\237\260\303\213\330y\033\300\360\036\326\307\303\017\307\346\221\247\237y\310\267\343\r\333O]\312\311\272\226l)eJ\001|"
+	.string	"\213"
+	.string	"\204"
+	.ascii	"\2667\216C\367$C\271u\357\n+O"
+	.string	"\367^\b\344\307\030[\351\221r\325\206\2410y@\351\317\334i\364\300\234\227\350gJ\355\017\177\244;\215\236\273\334k\224\343\351\336\223\301G7 ?\372\374\313\352#y\002\253\217\366g\330\316\375\254\263\237\374\f\336#-\001\272A\274\367\276>V\027\327\275R\253\363\337\364V\320\320\356\025\300P\211\323\001\267,\233{\257I\023\367x\3335\266M\333*\bU~Zh\021\327lz |,\023PIH\274\276S\306\306\271\006s\006\211,\240 \n\211\367\236\257\217g:\313\376T\002%\367^!\037R>\210\005\024\251\222QJ\005\361\270\253:\324\235\374( ?v\034\343\373\261C\356~\344\222\221'T\024\310\245\036\367q\273\223\307\032Tn\366w\374\311v\031w'W\230\342\302\215\376R\316o\262\313\366\231rt\302\345\235\220\371\250\303P\266\345\372X\220\220@~t\331\322+\345\354y\207~\001\305\323V\264\326Z"
+	.string	"\n\250\250G\213\376\224o\356\004F\336\353s\3407\371\020\363_\364\254>\322\372\251\037\b!D\002\016\217x\264Hk\013Wko5\262\217\364\267Z\324d"
+	.ascii	"j\226\245^]\351\037-\265e\241\256,\324\364\347\177\026\227\b"
+	.ascii	"\302{\205\212V\256\212\261\007\214\003\371\022\323\324\344<\263"
+	.ascii	"\267\310\247:\241\251\271y\3663(\264\201H\035\303;\203\277\037"
+	.ascii	"\222\234i\366\006}\254\b#?R\232F\317\340\317\026\346 \243\301"
+	.ascii	"x\254N9\273\231\262\016,\231\207\331\315\326J\023\307\346\310"
+	.ascii	"\314\352\330\214\rW\23297\246\214GV\203\2310\333+g\206\243S\306"
+	.ascii	"^:3X\355\0253o\257\031\004.m2\363\305S\226\346\213\276\351dR"
+	.ascii	"\024\"\274\332\253\265\205\355\027\312\252\255JV\373\002\006"
+	.ascii	"\372 ?\352\344\221!U\025\252\237\272\363\245\234\341P4\220\365"
+	.ascii	"R\247)F\030\001\207G\253\312\2621\200E\240\261\332\272\252\246"
+	.ascii	"?Rj\265\365Q_\300\243\252\227$\351\212\201V\250\221@\243\f\024"
+	.ascii	"\214\324\210\314(,-L\033\220\002\021\243\253\007\022\240\346"
+	.ascii	"%\344jf\026X\353\177\006\213a\354^S+\216,e\034\025|\244V\006"
+	.ascii	"$\026P\035\247\r\344\005\326\337t\255\2576~ \016\0335\252\334"
+	.ascii	"K\244\247\267g\312\242\260]\367\313\210'\346sC\211\227\200\204"
+	.ascii	"\210A\252\234\036\252\260\036\375H\023\300F3A2UKx|:>\245\027"
+	.ascii	"\307\203\355\001\320\22773\256\036;I\334v\300)\275##\032$s\367"
+	.ascii	"\017T\2473\027c2\0321RQ-\346\210?\365\225\300}\221Y\037\350 "
+	.ascii	"\r\331j\311Is\034\255N\343\257q\001\354\261\316>\326\273\277"
+	.ascii	")"
+	.text
+	.section	.gnu.lto_.symbol_nodes.9ffdc5d457a88465,"e",@progbits
+	.string	"(\265/\375`\314"
+	.string	"U\b"
+	.string	"T\f\310\001"
+	.string	""
+	.string	""
+	.string	"\002\b\177\021\207\277\342\006\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\220\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005\006\022\300\204\001"
+	.string	""
+	.string	"\003\005\022\023`\021\024\007\025\002\013\177\026\200\200\200\200\004\024\027\025\030\002!\177\031\224\202\202\200 \t\177\032\356\372\2508\272\220\202\002\f\177\033\r\177\034\016\177\035\017\177\036\020\177\037\360\005"
+	.string	" \301"
+	.string	"\001\026\177!\377\037"
+	.string	""
+	.string	"\200\220\200\001\023\177\"\003\005\021\204\001\003\005\020\250\270\275\324"
+	.string	"\001\204\006\004\005\264\345\241\253\002\001\265\007\003\b\020\344\001\003\t"
+	.string	"\236\275\245\t\001\202\007\003\n\005B\003\013\t\005\250\353\264\276\001\001\202\001\003\f\f\b\240\276\320\347"
+	.string	"\001\342\001\003\r\016\n\221\205\327\307\003\001\""
+	.string	"\033"
+	.ascii	"L\330I\250\342[\n\201sT\207\016\2143\203\363\251\354y\246`#\030"
+	.ascii	"\236pnV\326\203G\3007\3007\300\237\235\004\240\352\206\316@\200"
+	.ascii	"\214\037\002\275\224\020\025\206\233\022pW\376\350\034\254rx"
+	.ascii	"c\3152"
+	.text
+	.section	.gnu.lto_.refs.9ffdc5d457a88465,"e",@progbits
+	.string	"(\265/\375 e\r\002"
+	.string	"RF\017\023\220\247\351\377\377\177\305\237\200\0351\214S\023\021!;\311\024Z\357\250\207%\274\203U0\005\254\3044\r=/\252\335\273\032%\215\331R&\033\030\263x\213\332a\023\255f%\323m\036\265\020"
+	.text
+	.section	.gnu.lto_.decls.9ffdc5d457a88465,"e",@progbits
+	.string	"(\265/\375`\252\025\225e"
+	.ascii	"\252\244,$R0R\312I\007\333b>js\272n\357\376ownv\376\363\271"
+	.string	"\036\025\017u\215p\027\027\230\252\274 PU2O5\277f\273[s\354\332\273\316\371>\214\324\230\345\241\262\252\b\320\b\260\210\210\252\262\262-m\253\n\001\253,=\177\3565$\022\304J\231\002\342\001,\002?\002tx\022\374,\342\030\f\217\371\265=\334\233\265E\300\033\026&\037\321{[2,\307P\216{\211\366\246H1\200\316\336\\4\212:FL0\013S\324R\247\f\307O5\0351\204a(\277\335L\360^\003x\226\222\264\331\352\224\335n\227\203e\322\321\351\365~\226\372\320\362\204\255\323#\327\333X\373g\306\227u\f\336\224\214\365*\254\314\205\317\030\212\202\273\234\315X\313o\220\332\333\266\2216cT:\275\b\353\031\205\372\353\353c\024\352_\254\315>j\017\223P\317\301\372\f\256\224\335<\323\362\332\312\302\032\216\255)\251\323W\260\366\260\217zb\214\305\200P\251\253\266\323s\313S8l\306\275\312{\257"
+	.ascii	"\301\246\030.<:\345/\246\302P\023\f\366\bZ\374\307~]\257{[\036"
+	.ascii	"\035\276\037\370\366:=\320z~\336\347\353\266x\257g\023*\367\261"
+	.ascii	"\tu\275LB\345\313>*Gaq\226\342\2432\241\332\313\223c\205\304"
+	.ascii	"\311\254\323\367A\371\371\t{\231\370-\233\234W\354\336V\004O"
+	.ascii	"\373cGV\247o\231\204\272\262\217*\343\307\004\006Z\036\347\357"
+	.ascii	"\033\214\016\300\3372\374\214bI\211}\376\006\201U =\370\367\013"
+	.ascii	"?\373\260\377\351\370\376-\364\037\356g\033~\256\341\347\243"
+	.ascii	"\022\311\377d~F\376/\303DG910\334\304\337\r\360\271\270\206`"
+	.ascii	"b\001\177\257\360?\357]\376\3271\320\005\260\377a\f\374g\341"
+	.ascii	"\277\001\\\024\300\337\302\237e\374\374\301\317\033\374\234\301"
+	.ascii	"\317\t\374"
+	.string	"\334\342g\b~v\340\347\237\237\013\370y\200\237G\374\034\3749\304\317\353\317\277\237\371\177\020\377\367\376\343\3757\372O\374o\345\377\227\377(\374g\363\177\315\377\262\377\321\377j\376\247\371\177\346\277\330\177\257\377\t\374W\373\037\242\257\257\257\357\377\335\277\221\177\317\220N\026\210\265*\336aLL=\355\305r\342R\363\324\324H1\301\201\243\227\034@}]v\007\216\007\223\227\212f\022\367e\216\317\334\200\361%\331\353t\251\225\202N&S\305\355\230\322)^\211\005\236xl\351\364m\265\376\235\004\355$\026{\321^\266\004)L\246\212ws=\363q\337\373B\3736\273\266\327\t\0032\247\256\350\205b\376\374\327{\263\277y[\262E\206\266\376\375\253\367>\335\264\227\231\024T\371\206\371\347\327\341\037#\360?\275\367\377/z\257TW\336\252\004\013R\324O\334\237{Y\346\362y\305\212X>\221\356\022\352\326\024\261l\257\225"
+	.ascii	"\367\231u\227\255\223M\235l\337\366*\257\232W\351d\215\313\366"
+	.ascii	"2o\353d{\256\262\331\263l\221\330\345\363\252\311\313\247\263"
+	.ascii	")\342*/{\225HV\253\322\331\\\2569\233=\313'Rs\251\274j\362m\235"
+	.ascii	"\227\303li\257X\245\373D\322\271\3676\265\\l\360^$\346e\337z"
+	.ascii	"\307\275\302\333q\251.\273\375\320f\335{\357e\305\344\260\234"
+	.ascii	"8m\322u[.q\326P\272W\356\356\230\200e\266\275\367.\335$\226\357"
+	.ascii	"Uj\231\367&9g@9Y\314\022\363\352\\%RS\022\2263\250\224\344\\"
+	.ascii	"\272K\254\270\271|b9Yh\001{r\335\244\226e\256+w\305\\\237l{\031"
+	.ascii	"\215\316\323\bT\323\227\033$X}j:m\007X\253|tA\303Z\265\255\310"
+	.ascii	"\032[\247]\332\234,Tc=\326\334 i\222%\025E\261*\267T\361R\243"
+	.ascii	"\367\244\013\226X\247\254\327\234\307i\316z\214&\250d\275\364"
+	.ascii	"^$\346\003v\230\017\2709C\202DEM\317-\020g~kg\236y\235\342\265"
+	.ascii	"%\200:\200T\021\353\364\254d={Y\341+rU\260p\231\027\030/\234"
+	.ascii	"\346\303\032\223\265q\034\273A\365\\\345\225:</:\316\302e;\254"
+	.ascii	"\210{\263\332\270\352\370\216\315p\031\236c;\2062\035\253\235"
+	.ascii	"\327\230\355%\332\263\026\246\343-\214\306nZ\034x\261\341\335"
+	.ascii	"\333\246(\221\"'N\217\007\267\235\324\312\355\fHZ\276\210\022"
+	.ascii	"\351\037X\277~4\233\235\266\333\022\273\2463\2356\230\237\005"
+	.ascii	"\241\310D\207\260UY\305\336V\304:\355\007\027\274\354\327u\002"
+	.ascii	"V\351\202\363\022\275K\250\237\035\035wWA\266\274\323\336_\""
+	.ascii	"hq;\242\0200\260N\333\313\033\215\b\032\260e\227F\353\241\316"
+	.ascii	"\n\337\221\265\317\036\230bc\025\004\227\020ZoH\230t\332\374"
+	.ascii	"3\265\315n\327;\314\230Lu\332Z~\247ce\212\226T\2266,\270\244"
+	.ascii	"N\273\254\2570\364j\215\345;fKcjA\326\343\300WS\233\354]\345"
+	.ascii	"\307\3011\243\nr55F\026\027\305\325\351S\250\365i\263=C\273m"
+	.ascii	"\260T\331\336\246\n-R\225%z\231^T\210@\342F\245\237\f\375i\350"
+	.ascii	"{J\177\035G\331\336'N\034\232)12\353\371G\345\341\037\365\004"
+	.ascii	"\223P\323\037\032\024(\035E\003(\023\236\2166Ym\235F\321y{\232"
+	.ascii	"\273V\232\274I?a\250\373\203\333s\352\352J\277\230O[N\336O\316"
+	.ascii	"T\246$\\B:\355\037\302D\247\322t\332]\317$I\232\t\026\226tH_"
+	.ascii	"\230\223%o&\254\227C%H\233&\235\266\222\333\335\244\271\345A"
+	.ascii	"\351Z\267\266\232k\275d9[Z\372\320\360\360\346b,rO5\375\004\374"
+	.ascii	"\342\334\361\203\253H\221>\"\003\fS\2019\365\214\274\217\364"
+	.ascii	"SZ%5\245\305i*\033)>\236\020\231\352\254"
+	.string	"\251\326R\357\345\326\351\304\034\362\326\332A\263\224$\325i\013\351\247\237\216\261\267\256N;\310\357r\364\370\234Q*\252\306ZY\2462\007\365\223n}\255\211]\275\261z\354\234|u\332V\375\024D\222\307\005\245\323v\376\216\341\322\262v\350\264\253~\006Tk\303\252\272Z\377\353\021\025\025\305Of\244\370:\375\217\375\361\037\r$e\277.\233Ce\007&\257h\320\311\216KZC\315`\256Oauk\255W\320\311\311\210S\207\207\315X\301|<\311\325\361\340\321=\200XG:\207w\017`\033[\304K\247\355\324O*\023\246\223\275~\352fN\016\"@\340\341\265\235\306K\327\226N\231\254\266\243\027V\246\212\313~_^zR\326\326nbh7\261\036\2677\304b\021\362(Tah\304I\n\2214h\22004\306\030\032\325$\261\3507\302\320\370K\n\221Cb\3211\211\004\022\022\035\031\r\021\213\200\216\310#\240"
+	.string	"\214\214\216\210\304\"\021\230\fRe(\036k$\213D \r!\241Qz\3038dChC}\215\025!\240"
+	.string	"#\006PR8<\n%O$\203\"\220\340\205\241\242\221\013\341\261\350\302\2060\211\274\021\203\307\310\250\203\020\302c1\031cht\221\024\"\201D\304\242\017\206FU\205`E\362(d\\A$T\fah\324!\"\n\001\020J\n\021%\205\310\021\302!\242P\022I\204\221\024\"\223#\210\210B\021\311\243P\362\03044\006\005\371\360|h\006!\021\021\006\221Q\321\221\007C\343\210\017\025\035\205D\341p\375\004\024<@\201\0053"
+	.ascii	"\215\212E\017\202n\222\257\241\300\213F\341\021(Y,\036\201r\206"
+	.ascii	"\210G\037$\205\310\034\"\215N\n\221\302\343\r2\350\3061\211,"
+	.ascii	"\032\nO\030\032\203\311 \342\320xC\034R\300b\025\322P\204L"
+	.string	"\221H\341\221\210H\bx\303X\034J\217I\343/\031dA\222Xt\004\374\005\027\2708\221\302\b \254C+\214G\305\3430\350(L\nm\b\035\205\214@\303\"\032\304\342\020\020\261H\310\006\320\320\021\t\264\"\201\034\\8Y]K\332,\265r\372\274\212\220\375\224?\345O\251\205(\223\327\017\307\177Ja:= i\335\321\255\377/\251\217\2641q@\177H=\330\013\035\230->\276\337}\021\002\253\312\251\253\357\277[\246\372\220\205\344\024f\375y\f\213\031\212-\205\355\275\203"
+	.string	"\342\207UT\247\275\246\3314\341\"\2333\243\244\316,J\247\255\246\243<Z\\c[\356\216\307\214.\211\322\245\351\264\013\344\361dO\210\036\020\216\252\312\301\006\275\335\315\264Q\253$\027\315\230\0357)}D\316\234\371\335K\265\206+M\303c\3231 ZX\235v]\3331\364gm\246}\356\264\221\211\223\353\262\316"
+	.string	"\374\273\314\222\007\r+\215\\\247d\310\364\034\f\326x\307\344%\367\236c\264\337\227\035\226\222\230\255\275\333\326z\f\017\324\275M\367\247\274Tm\270r\246\350\230\022&\314{\314[\314\332\345C\034R\247\r\267\003\305f\206\367\326hJ\202<\233t\201\330\250\2418\206\0244\"2\"\"\"I\222\244\0031\005\204 \006%v\033\022\340\0055\223*gFf$I\n\373q\027\004\336N>\340\271\246\307\302\001%\356\004K/\034\362b\021JX\020R\034\by\265\361\214\034\2363\001\372\315\223\273\334xw\036\036\251\340c\351\032!u\210_YZ\037u\036\301\376<\027\276\307\004D\317\352/\333=\226F':\036]F&R\013\2442\bv\310\207\202U\017\343\375\bR\021\001\340\002b\340M\366\237\255\234/\256\250\313P\304\266\325\326J\021\026g\006\376\\\365\217w\257$Q\3328L\322\344"
+	.string	"\326(3\227\207b\373_0)R6W\202\231\240{J\264\004)\342\\\030k\352\366\024\200G\213\342a\232\027\276\265B<\b\247ap\322t\356d5\214\345\bk\332\247\375i{\027;i\370\332\241\026(\301d\305\354\315\207\354!\b)\021\367\244\300W\037\274v;\022\260w\303\332\230\315\".\237ng\020[\201\340\302\022\370I\233\375\213\202 \006\t;\371\224G\367\335\033\002f\265_\215\365\024|kAw\002\261u\235\354\236_\233\232\357`\235\n%Z;1h\227\363[%\374h\341Gg\362UKJ{\257\\\246*\262\215Z\006\274\\\224\326\243vd\326D\224\317b\344\311\222T/b\330v\334\317^P\004d\273b\302\0203\261i\375\n<j\325\346V\245\205\032\253'\303Q\227C\342~\347\345\242)\233\350\311t\342#\372\323\320\025;h\326]\356@\007bT"
+	.string	"\016K\333\222&\326\272\031U\241\232"
+	.ascii	"]\024\204\001\334I\"\323f\324\321\202Z\035\255\372z'0RU\206\354"
+	.ascii	"\006\200=\325\271k\027\013kN\222`\004\361\0244\325\277\265LJ"
+	.ascii	"\f\253!-\031\315\003\357P\004$\001\374\354\323CK\006\005\307"
+	.ascii	"\203\266\213c6u\307\234D\020\373wJ\206\250C\270u\027\032\341"
+	.ascii	"!\023\203A=\002\273\347\232\204\256n\232\t\377\206\303\"\277"
+	.ascii	"\f\257\034\205\024\230\377\031\335\356\255\247x\031\333\252l"
+	.ascii	"\027\362\225\232]\312@u`\\\006)tx\354\225\223\251\257\370\212"
+	.ascii	"G\3749b\260R\224n'\204=\255\364\324}?\325y(\025\024g\204\350"
+	.ascii	"\005\032\307E\2100V\2244\333\352B\215\2038G\323z]H\361\244\330"
+	.ascii	"\246^\b_`\021\341,\276\017\t\225\220l K\036\222\377%c\261E\204"
+	.ascii	"\314\021\034%\376\267\272\210\"\235\266\004\003\317\027\b\251"
+	.ascii	"\027\271\251\r\t\323\r\242\005\373\315\030\271\221\007\0360\346"
+	.ascii	"\007\372`\236v\246\204\324\363r\177[N\220j\354\372Er\033\276"
+	.ascii	"$\243\367Q\347\375,K\357'cn\344\350\0260\274|\352\342\375\007"
+	.ascii	"E\245\361&\372\302\f\367%{!\302Ew\021\302\232\342\310\250\302"
+	.ascii	"z19s\237\355(\334!CZ\220\020\332y\024\2369a'\345|\243\037\270"
+	.ascii	"\026\315\031\261~]N\305.r\345\365\235&-\023D\273\243\266\213"
+	.ascii	"\035\237f\355d8\3457\r\305\340\205\376\013l\305\254\027\325n"
+	.ascii	"{\352\336\370\370\332\255\316\247[\367\023\211\255\360\224\264"
+	.ascii	"\272\313\2263\203\334\223\360\365n\025a/C_+\267\201\025\310\003"
+	.ascii	"\351_\335c\366;\364\002?\003wlgoU\033\370C\375N8D>\313\306R\227"
+	.ascii	"\272w\361\021y\266\272\023-\370\244\315\001m5\035W\3707\235\317"
+	.ascii	"o\322\252\360J\372J\317\3475o\f6|\322\270\326\354Q\2334\355R"
+	.ascii	"\261\377\334\242\327\002[\035\277\0133\375\272t\030\350*"
+	.text
+	.section	.gnu.lto_.symtab.9ffdc5d457a88465,"e",@progbits
+	.string	"pgFind"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\001"
+	.string	""
+	.string	"pgReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\001"
+	.string	""
+	.string	"pgResetCopy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\001"
+	.string	""
+	.string	"pgLoad"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\001"
+	.string	""
+	.string	"pgStore"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\001"
+	.string	""
+	.string	"pgResetAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\001"
+	.string	""
+	.string	"__pg_registry_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\001"
+	.string	""
+	.string	"__pg_registry_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\001"
+	.string	""
+	.string	"__pg_resetdata_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\001"
+	.string	""
+	.string	"__pg_resetdata_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.9ffdc5d457a88465,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,561 @@
+	.file	"accgyro_fake.c"
+	.section	.gnu.lto_.profile.672ab442b69bb4ab,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.672ab442b69bb4ab,"e",@progbits
+	.string	"(\265/\375 \375}\005"
+	.string	"2\t#,pU\323\001d\200]\215\3217\315\366\357X\360\307@\307C\257\303;\021]$q\377\377\377\377\377\377\277N\221\226\364\246M\222$IR\006*3\016\354\002\374y~u>\365\236\236/{X\314\226I\306\233{\371\375\364}\374^z\224\020\005\214V\355\025\212\225\303\033H(\331\357?n\237\rd\322Vh"
+	.string	"a\224\242G\277\265\270\030\022\255\221\241\211l\02133\357A\300\301 \231q`\367C\377^\177u@%\244\254\316\017#4\364\322N\016"
+	.ascii	"\210\n\037\356\305B\232\240\205;\305\202\333@\026\220\017L\354"
+	.ascii	"\356Be\371\225\324w7l\240\r"
+	.text
+	.section	.gnu.lto_.ipa_sra.672ab442b69bb4ab,"e",@progbits
+	.string	"(\265/\375 \307\205\002"
+	.string	"4\002\273"
+	.string	"\013"
+	.string	"\002"
+	.string	"\020"
+	.string	"\007\003\001\001\001\003\005"
+	.string	"\001"
+	.string	"\001\006\002\b\t\013\004\f\r\016\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\023"
+	.string	"I\t\001\354\326p\"G@Q\004\356\274"
+	.string	"w2\215qf\240\231e\355Tk\361$"
+	.ascii	"\354\245pV\031\2533\306.\230\r`\001"
+	.text
+	.section	.gnu.lto_.inline.672ab442b69bb4ab,"e",@progbits
+	.string	"(\265/\375`P\001}\006"
+	.string	"\022\211\036)\200EI\007C\\\005\fx\260\200\001!\252`)\207\n\001W\030V\241\3375\0274\t\232"
+	.ascii	"\nk\r\221\366\377\326\310\336;\005;\257\310\304\312\260 \351"
+	.ascii	"\371\206\013\377\244l\341\333\240j\313f\313!\334G\023\264\376"
+	.ascii	"\237\226H\271D(v\363\213|\264efVF\023\303\004(\b\230\260\227"
+	.ascii	"P\200\222X\016\370\037\336\3671\222`\240\002A|\217\3157\332:"
+	.ascii	"\036\377\032\266m>\033\023\001! p\242RU\347\001\366,p\206.\030"
+	.ascii	"Y\2575\250\025o\036Y\3112\234\340E[\301\345\027[\2117EV`n\312"
+	.ascii	"\355\375\322aa\236e\306\212A\357\327mnb\367B\330\305\021\361"
+	.ascii	"\001\314\no</\261\314\210l3\241\325\205\2105\b\256c\024\305\r"
+	.text
+	.section	.gnu.lto_.jmpfuncs.672ab442b69bb4ab,"e",@progbits
+	.string	"(\265/\375`=\001\255\006"
+	.string	"2\212\"*\200)I\00730\003k\374H\312\210\314ht\352\"a\356\020m\r\243~\206f\r\250p\206\354/b\330\277\353\023K\332&;\311M\303\bz\320\236\326\034\005\242y\"\224\247M<(\216\004s\332BA39\005\016\030@7\2723\376\023i!\214\263\t\360\230.\f+2X-t\203\312\256\232\360\005\323\305aE#|$l\217\323[\230i\213\257\330\315\3243\205\327a\276\236\357\266\r\212\205\243K\177\202\035\333\307\"Uh\261\001\036"
+	.string	";\317\200'=\204\266\007\222y\002k<\020\020/\024\024\241\345\235V\264\365\261z\266a\254\331\001\327\005\300\273\340\bWx\334l\247\217\353&\302\027@\"<\031pE"
+	.string	"h\275Bc\236\230\201\303\256\032\236}&="
+	.ascii	"8"
+	.text
+	.section	.gnu.lto_.pureconst.672ab442b69bb4ab,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	"\013"
+	.ascii	"\200\004\001\232\004\003\232\004\005\230\005\006\230\004\b\230"
+	.ascii	"\005\t\230\004\013\232\004\f\232\004\r\232\004\016\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.672ab442b69bb4ab,"e",@progbits
+	.string	"(\265/\375`\252"
+	.string	"\025\006"
+	.ascii	"r\007\030!\220)\351\277\253\031\237\370\356\\=w\375\377\377\377"
+	.ascii	"\374\324\n{\240'\262\030\364\250\3657j\215\020)So\206\026\327"
+	.ascii	"\rF\321\212\260\032|\274:\034i\301\245\350\227\350\367\215h\002"
+	.ascii	"T(\270M*\017l,g\226J\024\202\250\026\375\243\260L\234\376\224"
+	.ascii	"O\247\374P3\2062\347\206\362\247\275\355\315\214\004/ \340\202"
+	.ascii	"\031\023=\220ic\200L\002\350\217k\230\315\333\177{\231e\361\325"
+	.ascii	"\002\212\273\007\341944\006:\267\207\201\233\214\005\212\305"
+	.ascii	"\374\206\330\f45\035\352\215];\220\220\363\360O\330\005\321E"
+	.ascii	"\2378ba\037\203\016\331\301^\013\305`\033\324\256;\330k\215\002"
+	.ascii	"\303\214\353\312\263\257\rtEsC"
+	.text
+	.section	.gnu.lto_.lto.672ab442b69bb4ab,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_fakeGyroInit.24.672ab442b69bb4ab,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"E\f"
+	.string	"\226\027UB\020\221\232\0168\325\006` \212g\200\237\225\200\377wF\030\001n\357{\233\025\036Z\225\236\241\"\264\204\264\307\234\001\346\325G\2148MX\210"
+	.string	"\210\250&\321EA\276\250\024\241d\363\035\337\b\221\275\245L)A"
+	.string	"?"
+	.string	"D"
+	.string	"\037 \035:\263g\234kY\005+Tdj\354.\245 \236\375if\376c\276\211\233\3667m\270\276\217\216\005\r"
+	.string	"[\312\343\254\204\210\217yf\330P29\030\354\2563n\032nx\333\rl/\260\357 \037^<\204rdsZ*\213\375\267\273k\025\331\207\371\237\2463\323\337\204\250\314pfvWF7\366\005l!\242\303\366\323\376\210\277d\207\001]\300\256H\005\315.w\300\t\246Cs\347H\207S\017L\310H\311\032{\244\357\221\256\366\bI>\246\022\300\240\232}\024\027<\242}]\206\302\264\273\bN\224|\n\304p\001I\207W\345\340\"v\b\345\310O}\022/\001\362]l\301$\037\017}\023\3510S\300\b\027v\"\362\\\201X#\235\b!\027v\"RU\035\352\203Y%\036\f\002%\301\323!\241*\354C\201|\370\232`aT\205\353\302\250\016n\377VE\235\215.\244(/@\332\225\225\217V\325\336R\323\321\250\262\330\300S\003\023"
+	.ascii	"_\241'\023z\305\001g5\005\001nf.\240\367\037\246\371q\353\361"
+	.ascii	"\224\024\023\372|\301\352\250\260\013F]\302jV\243\303]\216\331"
+	.ascii	"$\rL\355\001"
+	.text
+	.section	.gnu.lto_fakeGyroSet.25.672ab442b69bb4ab,"e",@progbits
+	.string	"(\265/\375`\005\002\275\020"
+	.string	"\006\035iH\340\262(\035`e"
+	.string	"\""
+	.string	"\206\235]-f\225\265\025j\2561P{f:\200\262\363\340\313T=C\206\204\324Z\303V\037c\210`\263\007\305\"\261)81\306\030\203s}\361B\033q\340J\316\021\323\210\362\327,\267\335;\245N"
+	.string	"R"
+	.string	"T"
+	.ascii	"Kb\247\266\273&?\030\275\222\314O\3734\227\211\257iy\200\335"
+	.ascii	"\030Ym\2274\331\301\350\325\344\013l\257\243\017\330^-\332=\006"
+	.ascii	":\224~xp\361\263\273\0355q\361S\364?\373\310\370\342\372\024"
+	.ascii	"\235\354\256\347\370\"\342\246\267\255\300\266\312\236\253k\032"
+	.ascii	"co\323\244\343\374\242\337\374\3656?}\315?\001 p\t\341\001\204"
+	.ascii	"\372 7DP\221\335Qg\310\330\276\017\343\264\224\347\230\006\211"
+	.ascii	"\301\244\330\334\213\227*\317qU\301\275\332*6\367:9\033\2475"
+	.ascii	"I\326\005\366\001\302M\317\t%\337B\274M\313u\003\324\266\311"
+	.ascii	"k\264\b\234"
+	.string	"\330\335\006>\215\353\244\274o~\374\266\327\317.\240G\212\230\f\2464I\324/U(\363\243\023\270P\227_^\006k\362\214/\275z\r<\300\263\273\fb\260d\360Q\264l\257$\372\362%1rfV\216x\315 \233\204MZ\302~hw\003\266pZ\300\362\225sx\310\336\351CIQ@\201\341J\005\317Ku\254\360\333\240\n't\027T\251U\347\205\254\356Tb\020\303\027v\032@0\3548\362\365\331C2$\220\317\213\302h\021N;i6\004\304\214\317Q\233-\341:P\243\222\211\346\207\210\210\356<\007\016\353l@\325\364\0336LV\260\240\0011 \200\002\2319\273\003Y\334\240\205\363==1\240\206\221\026v* &\236\322\316\322\202U\002\256\271Sb!\020#\037\r\213\314\016\306\321q@\235\rv5s9c\321\"G\274`\225G\033\032?\2101\306m\250\"\312\277B\017\306\030q\210\001\224\033\304"
+	.string	"\210\202#\022\247;6\314\201!%|"
+	.ascii	"\303\022B\300\022\203+\322\326\224\210\303\213\326\220\001"
+	.text
+	.section	.gnu.lto_fakeGyroRead.26.672ab442b69bb4ab,"e",@progbits
+	.string	"(\265/\375`\031\003u\024"
+	.string	"\206\243~I\300\224Q:h\2434\034-\024.\247\225\222\363mN@\241\242\221\213/(W\260\3161\376\005=@\364~\177\371\375\307\365\211s\230\257?\350Y\345\371\2231\031\216\206 Q6\334\250{\320\3204\273p\245uor\310&R\246\024g"
+	.string	"c"
+	.string	"l"
+	.string	"\266\252}\334\205r>\204\363\2239oH5\346\324\251\270\201xi\335Q\302K\361\002\302K\333V\260 \307\260\353\202|X\222\360\030\025\231S\247\332\023\207]\202\2530_\347\222E\022\020\270B\214|NG\265\020_0\305\306\004\"U\223\201(= \250\347\256\035j;\252"
+	.string	"Z\346\234\326Y\315\303\035\336\266\004\333,{!\0043?r\031x\232s2\220A\243\301G\201\023^\232\354\307\253R\224\217\323\221\210\230\376l\335\216\256\t\373\340\334\233\035\252M>\364\213VK\251\006\245z\245\372'\373\3033\022\370\315\351\363C2\233$o\205\355\3731>\332\220\260\261\213\n\320\202\376\342D7\327Y\322\240l\2709g\352\306N]\256\235c\247\034Cb\372K\360\033.\342\234\223\305\267\361\245\027\033f\245\237\255\302K\335\0074\234M\210\367\335y%O)h-l\270\250\230\376T\211H\257\004X\304z\321#\344>\030\t\"[\235\253\230\331\232\326\260\360K\001\006\020\231\036\261\335z\022L\024\347\234\337\347\256?\264\233Mh\250DM\326\037cd\3643\037\220\255\216?~F\215~\366\321\001\306\260\202"
+	.string	"4k\245%\263\262"
+	.string	"\343z\335\\`\261V\252\232W\213C\314\253\202\212&f5\243b\275jT+)veh\275T\033\\\256\227*\245\213\035\234{s\350\0331\356\300\347\356\300\3273\356\366\273\313\355\261-\327-\261\335\221DD\340\376\360\361\336}=\364^\n/A#\273<v\250\234I\307n\200\036\222\013\236n\016\227\001O\236p\034/\342\322\230\005@\250QH\346\024afFd$H\n\242\f\007\220\002\231\271\243\007\021\260\261R3V\211\375\357\006S\n\244^~\377G-f\237\001\3202\322h\257Ib\236n\352A\217\241\357N3\007\325\217\236\006P\360\362\214\017\256\351\3143\t1\017\\\213\005\307\244\222\335\246m\232\2405\314\340\333 >\005Y\247\265C\314\365-O\306\231^\3646\bJ1@c\nz=1\347\027\371\023Y\366\251\310:\323\366\204"
+	.ascii	"t-\333B\371\315/:\0044R\352\240(<j"
+	.text
+	.section	.gnu.lto_fakeGyroReadTemperature.27.672ab442b69bb4ab,"e",@progbits
+	.string	"(\265/\375`2"
+	.string	"\005\b"
+	.string	"2\21777Po\322\001#n\203\240`a\346\026L\023\016\0359\001\t\004k\365>z4\004\321G%v\231\362\334\310&\006\314\022e\242&.\2161"
+	.string	"\274B\001\237\264F\b\331;\245R\223\016\223Zh\222NQhj"
+	.string	"\2251\317\244\220\022\020\031%M`\230\214#:/@4\"V\200d(bt\024=\b\316D\223F-\313ht\335W\013;\237\273\n2\240\311\256\245\007=\354W\273\273\206\235\375>5%C\220\262{\252\231\331\027\213%\304\366fwl\303J\242ax\317>\311K\266\233`<`\267sY\331\255\t^\340\334r\375\300u\213s\201\353\226m+|6s\257 \247\215\251C\003%\265[#\3748\367\307\371?\271\201H\013L\214\n\252\364\267i\330]\277\r\024\307\ro\373\300\366\203\355\221\f"
+	.string	"8\303\361\212\036\025Ql&FV\301\3235ob\002\007\205\34020\222"
+	.ascii	"\025\346uM2"
+	.text
+	.section	.gnu.lto_fakeGyroDetect.28.672ab442b69bb4ab,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"-\013"
+	.string	"\266\024NB O\225\016\240\252\300 \313\363\026\315\362\360\005\304J\023\027\202\216pq\210\30450\262!V\3220\256\356\317\230\236\305\226\355\004I\023\221\020\020G\302l\212\305\335\307\b\354\314(\216\330Vk\334\210\354\224\0028"
+	.string	"7"
+	.string	"A"
+	.string	"\3437\266S\3115\266S\333\0260"
+	.string	"\344\360c\212\364S\007\n,rw\344\264\r\017?C\377\253S>\300N\261V)\364\0319\260\273\236\243\322\205[\273\355\017\333\005\354c\002\263\264\307\320\3244\330\207\354\356ZC\331W\3753b\261@\272\350(wI\345\213}\321\024\036l\203\354\211\3559\355\213\370\b\320U\237g\354\242V(v\307"
+	.string	"\266HN\035\344\204]\221b_~\302.Zb\001\202\354<\017\331w\023\231jR\241\331p\316\002\021\230\\\243\006\035\216\324\256\370\221\375\340%\"Hv\227\200OB\202\007C\306\341\324\377l\2474\303\nQ\254\205A\f`\365d \366*\337\246Kp\001\253'\343y\035\327\251\037\004M\305p\0134\035\207\363j\207\253"
+	.string	"0\310\340\253\234\003\020\254\334d\334\333\177\270)\bQa\326B\324D\266\353\263\027l\327\006\3122\021"
+	.ascii	"_\241'3 \f\033\267\020\243\346\002 \037\270\031d\004\244\001"
+	.ascii	"2\006\005y*\221\257\31682A\3045\032\262C\304\3275\237"
+	.text
+	.section	.gnu.lto_fakeAccInit.31.672ab442b69bb4ab,"e",@progbits
+	.string	"(\265/\375`\332"
+	.string	"u\f"
+	.string	"\246\027VB"
+	.string	"\223\232\016X1\341\253 Q\216\002\335j\310L\263hB\277NS\303\211\001\2125\260\016\276\240\201\210\020\21620\226\274\037\242yO\021"
+	.string	"\240@Q]\225\232\371\004b\035\360\266\254c~[\262\267\224)\005B"
+	.string	"@"
+	.string	"F"
+	.ascii	"\003\244Ck\266\216w\241\345\240\250\361a\246fw"
+	.string	")Mq\355OS\363/s\220\310m\177\323\210\353#\031\315\340\001\200cy#-*\342e\236 \270\225L\316\203\335uFN\304\ro\033\202\355\006\366#\004%T\362\306\356\266\324\027\373ow\327\n\262\037\363?Mg\246\017\342\300\245f\007\001\033\273-7?\366\006\244\261\"\304\366\323>\213\213\264\307|.`\027$\203f\267K`\006\323\241\273\217H\207\323\003:\341E\016\226\264\261H\372\035\351j\233\234\344cj\001\017\272\331\217\321A\004G\264\261\317d\230vw\001\f\024\217\201\020\314G:\274*0\321#\222x\352\267\270\213\217\017\343\r)\371x\350\247H\207\007B\214N\210\002\226U\251\255\222\313\244\252 \001\3138X\260\254\212\362d\027J'\243@]\350T'\224\225y\250\022\022c\030\256\214\322\200a\031\025\322\355\337*\310O\344\342c\244\242+/@\332\326\225\217V\335\036\262\031\321\250\276\030\3013\024"
+	.ascii	"_\2417\023\232\3051\262\n\206\02073\027\320\373\017\323\034\270"
+	.ascii	"-<\227\306\354\213\276\025G\255\267Q\353\031`\271X\333\254\246"
+	.ascii	"\210\273\034\263I\032\230\332\003"
+	.text
+	.section	.gnu.lto_fakeAccSet.32.672ab442b69bb4ab,"e",@progbits
+	.string	"(\265/\375`\f\002\265\020"
+	.string	"v\035jH\320TQ:\243\303\036\212\311DW!:\264@g\205\265\366>\322\025\023\222E\216\036\325~\243\245\217Q\232>,\222\246\261\307|,t6\203\220\0046\301\f}\361d\303\024\306\023T\f"
+	.string	"A\274,\023<J\365-[\354\235RP"
+	.string	"Q"
+	.string	"X"
+	.string	"'|f\273[2\204\321\353\200\371i?\306m\306\337\274\234\300.\r\214\331.Y\362\203\321\253\311\037\330^G/\260\275z\264\215\234|\355g\020\021A\003hw;\252\342\343\347\350?\366"
+	.string	"\254\031\230O\221\204\335\365d\315\220\270\351m+\260\215bOU\273kJco\323\244\357\374\242\353\374\3659?\375\315?\005\230\324\\-\024Eh\020re\206j\373Ss\260\260}\337\306e\252\363\330\004\310\325R\331\\\215\227+\347q\005$5\273\313\275\332+6\367:9{Gh\202\316\220\b\224<\316\370\034\027\327\335<|*N-\210R\333\f\276\303\305\200\003_\307{\274\017\234g\201\333\353c\2370\231\037\227M\253d\222\250_\242R\346YN\020\202\302\370\345q\244\246\020\326K\253|\026\"x\355n\203\033-\035|\330\313\366J\242/\177b\202\326\302EYb5\207l2f\322\024\366\001lF1-h9\313A\374\373<\352\317\004\246x\031N\241\310\242\341\373\274.%\202\037P\"\206n\003\312S\351>1\325\231N\034r"
+	.string	"\305\316C\030\212\035G\256\036;\005\031\264 \332\212\306\310,\\vR\3145b\005\355\247\315\276p \247Q\311\013&TsDD{\374\207\217y\367lI^\324\322\0030 \260\002\0319\363\261\270\360Q\"rh0\302\224"
+	.ascii	"\324\200\236\370\332v\236\bf\037`\353C`\3062\027\2065\023\255"
+	.ascii	"\313\0205\3212$\354\3402\204\253$YAU\202\2610\032q\250\240\210"
+	.ascii	"\261NB\265Q\002,4\341\216\021\207\030J\271Q\f\300\3218\336\321"
+	.ascii	"\234\301\036\244<`\006\036I\024\0276\006\257H;S\300\\^\264\213"
+	.ascii	"\f"
+	.text
+	.section	.gnu.lto_fakeAccRead.33.672ab442b69bb4ab,"e",@progbits
+	.string	"(\265/\375`\031\003\205\024"
+	.string	"\006d\200I\300\322Q:P!\020`[\001JB\350O\230\247(\347,\337\267s\246\330.\352M3b\356\242S\264;\310\246\345\327\321\3549\255Q\r\231\326'\022\031\266\257KqT\234|\236}\310|8y\273\322\004\340"
+	.string	"R\311&R\246\024h"
+	.string	"e"
+	.string	"n"
+	.string	"\266U\355\013}(\347D8?\231\023\2107c\316\235\212\031\210\227\336\035%\274\024\017 \274\264m\004\tr,\373.\3273\302\301C\007\027Ts\356Xk\342\262KpU\346\353\\\252\350A\201+5\376\360\340\331@|\301\024\034\323me\243\201(O?>^t\345\261\355\250\216\260\3149\2555\233\317\035\336\266\004\3330\366>\b\037=s\036l@n\316\251"
+	.string	"\006M\006_\207\023^\232\354\307kRS\317\022/\304L\253\354\335\216n\t\373\340\\ ;T\233\234\350\027\255\226R\rJ\365J\365O\"L* \006\226\346\354\251*2\235\244\017\205\355\373/>\332\350l\354#\001\267\025gq\243\233\357,oT8\2419\347\352\306^]\256\235c\257\0025\251\231V\035x\215\026q\316\271\300\247q%\027\373\245\245\257\265\302K]\007\267(\334\220\357\275\373Jr\272\233\023NH\310L\2534i\352\211\004x\344\372\321!\004\005\231\372A[\235\237\250\341\234\326\262\360\013\323\242\007M\211\330~\035I&\212\272\313\357\213\256\"n)pCD%j\262\376\030#\243\257\231"
+	.string	"mu\374\3611j4j\316\371Z\276\260R\300\345j\255]+/\231V\205\027X\354\306\202\313\325b\325\304^\033bb\024X41\255\031\226+V\303ZI1\f\303+\306\322"
+	.string	"\203\305X\253\335\354\340\\ \207\277\021c\017|\321\033\374x\306\336\276w\271\037l\3135\313lw\244\221\021\270;~\177:\224\016\275\225B\022\037\244\240\335\246\034*g\302\261K\342#c\210O\367FK\200\234'\334\206\213\250\277> \220\002\031\301\243\007R\334\377L/JB\3573\020\3202\f\032m\311\\2\313s7\332\2203\356\260A\302\327\254\242K\305\310\227\340\3642\f\301\030\302\367CL\205\341\031!R\267\0364"
+	.ascii	"lbL\344\225}\213\266M\215\235\255\013\037\361\305C\354:K-\003"
+	.ascii	"`b\221\346+e\261\270\234E,\nk8v\302\352\2401]\033\3141+\374\211"
+	.ascii	"\266\354\300E\344C\276w\267\347|'\031\333\"\204\361\234?\234"
+	.ascii	"\241\342\3348\351\tE\255\200\002"
+	.text
+	.section	.gnu.lto_fakeAccDetect.34.672ab442b69bb4ab,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"\375\t"
+	.string	"f\023G; \261\322\001\244\nh\003\235g\244\327\320\310F\037\305\025.*\353\343\003,\303\252\023`\033\306\235e\177\006\f\2724\223\004\200&"
+	.string	"\001\206\210\311\001\305r\002\364\013,\321\341Fd\247\0244"
+	.string	"2"
+	.string	":"
+	.string	"\265s\202\357\325\266\023\024P6\177\312Z\217\315:l\272\335\023\364>n\236\232\376K^ \202{\311\335\\\251S"
+	.string	"\207\3355e\271^\267w\333\007\266\033\354\033\004\273k\017f\277\366\323\017bu3\237\226\335\326\356f]\252J\210\355\333F\331\001\266)\265Or\032\352\265\323\007va\264\224\335\023\301\f\235W\237\367|\017\036\217\022\2524\270\221\032\321\210t\033\3710\213a]\224<0\273\252\263\354\214\237ltvw\3017\3410\t\310@^\375\323\367Z_,\253\334\315CEw\366\231\242^\314>g\003\242\030z\026A\343(\234\210 KSH\024C\260T\216\032\242R\002\254\020\205$P,K \350c\322b,A\f\222,A\237{\316z0\337\374(Vt62*oe?\3649\f"
+	.ascii	"^\321\033[\024\204\305\2004A\003\251\301\305\240 O%\362\325\031"
+	.ascii	"G&\210\336e\342\353\232O"
+	.text
+	.section	.gnu.lto_fakeGyroInit.part.0.45.672ab442b69bb4ab,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"\245\n"
+	.string	"&\323E< \005)\035 \221!"
+	.string	"{H\302c[\351?\211\005 S\275X\0368\344\300\364\216\032\266u\007\3767\006~]#H*$!\004\263(R0\347\3501\217\205kA\2219\354&{\247\0242"
+	.string	"1"
+	.string	"7"
+	.string	"\266S)\026m\236\2170+\201s\"\353\331\335\356t\276\\\374\224\232\350?v\201\025K\3659\300R\271\f]\013\240\330]o+7\275\355\007\333\026\366C\001\207\335>M\312\217\031d\373\260\324G\024\247ba8\265\224\366k\376\022?\242^\260\333\272\311\331\035\035N\035\261\235z\374\301\347t\273\301\347\024t\372\231\3645\033\231$s\272lo\322\267\371\260\033.+\031\342\024d3\231P8\265EN\362+\2032\263\222\251\222\323\345\251]\333\331\262\247\334!h\331E\t"
+	.string	"`]\250NLN\250a\255 G\372\302\r\216\003M\036X+\0204\177\"\220\344e\\\204\365\244\361}^W\252`\310\250bt\035#\217\243\373j\251\023-8\364"
+	.string	"kg\n\303\332\311k;[\016\030"
+	.ascii	"/\301q\206\343\025\275\212\005\321X\201q\301hEi\236\301\001\242"
+	.ascii	"`\230+\234\253\tQ\027\325\347A`\342=\255\024\325N\347\2026]t"
+	.ascii	".0N\\\314;-M?\241\214\001"
+	.text
+	.section	.gnu.lto_fakeAccInit.part.0.46.672ab442b69bb4ab,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"\365\n"
+	.string	"\246\223IB \347(\035\220\b\"\222\300\216\310@G\227\370\323\330\322w\002\326\bw\265\303\220"
+	.string	"\366\334\0065F\303\266.\254\33744\366D\220\033&H\302\302&s\331\024\316\001\025$4XPHC\331\354&{\247\0244"
+	.string	"4"
+	.string	":"
+	.string	"\005l\237j\f\332\020\036\016XO"
+	.string	"\0073\260\b\273\313}J\001\007/c\006\372\177]!\245B].\250l\036\037\236y>v\327\332\315=o{\303\266\210\375\210\223\001\201\273n\337\300\311\177\371c\373\256\323C\323\206\302\301\370t\214\366\017\274\005>4\335aw\245`\301n\250\361\351\016\355\323\341%:\237\332!:\237\237\317\007+W\016i\020{\2210R\262lk\321G\260bg\03462\307'\213&\343a\361i\273\224\342SfH\320\212\305HT\224,\313\354\331\312\225-+\0364\344\354\322L\220\260"
+	.string	"\002\246\250_\255\336&\242\337\311Fi\267y\244\316\253 \023\224v\322\024\344\211\272\222\221\257\226L(\355\270Q\365ZB\225\204K\tu(\034\255#\016t\341O\305\253\034\351\373*\027\237\005\026"
+	.ascii	"^\321\263X\020\216\025\030\027\314V\224\3003<@\024\fs\205\203"
+	.ascii	"5!\352\242\372<\bL\274\247\225\242\332\351\\\320\246\313\316"
+	.ascii	"\005\200\223\027\363NK\323O(c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.672ab442b69bb4ab,"e",@progbits
+	.string	"(\265/\375`]\001\r\b"
+	.string	"\004\013Y\002"
+	.string	""
+	.string	""
+	.string	"\002\033\177\037\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\300\202\202\200\006\032\177 \005\026!\200\204\001"
+	.string	""
+	.string	"\003\002!\177\"\005\035#-\177$\271\200\202\202\200 \030\177%\027&\201"
+	.string	"\002.\177'\037\177(\036)\031\177*\272\200\202\034\177+ \177,\"\177-\005"
+	.string	".\001$\177/\377\037"
+	.string	""
+	.string	"\200\200\200\001#\1770&\1771%\1772\003\001\021D\003\001\020\340\236\212\256\001\001\244\001\003\001\020\241\341\365\321\002\001\244\007\003\003\003\003\005\022$\003\006\023d\003\006\005\320\360\372\250\001\001\242\001\003\b\t\t\b\013\021D\003\013\020\344\001\003\r\r"
+	.string	"&  \003\t\210\272\001(\002\027b\020\003/\350\302\212\024\325\030\344\300\233m\213\206\226Agpk7\320\271!\277\277TI\n\306\345\22728\332\365\367EX\275Qw\2153f\030u\2000xZ0Pc\304\2269\303,\033"
+	.ascii	"\312\257\016:\250N"
+	.text
+	.section	.gnu.lto_.refs.672ab442b69bb4ab,"e",@progbits
+	.string	"(\265/\375 a\335\001"
+	.string	"\022\306\r\020\260%\351\f\303\260R\326ZB0idK\231R\252\311\211\004R\314\316\354\346\300\234R\313\005\001\246\320\216v\272\314\207\311>\026\266\214\222\3211n\026)\221\016\371\324A"
+	.text
+	.section	.gnu.lto_.decls.672ab442b69bb4ab,"e",@progbits
+	.string	"(\265/\375`\274-\205\305"
+	.string	"\212/\265CW0\nIJ\035\253\\M\215g\340\322Z\005\205\307\273\315\264\210^@\243vk7\230Wi\005\315\f\357\026\314\356k#-\254k#hK`5\256\323\027\256\371\302\341\352\230\246V\327E\354\244z!\366\371L'a\"\264\363\260,j\237\007u\273\3066\242\222\334M\312$S\317\003%\0047\004Hj^K>\377\346\361\377\201\321\330`x\341\322*\332\305Q\177\307\363\270\322\n?\345\300etG\357\336\024\320\023\210\016\301\336\267\202z\377\376n\005\325\201S\332\2019>*j\3266\247\364P@!\3758h\374\206\370u\371\354\300\245\366\274\247=\327i\217\253\273\024\324_\252`\223\203\307R\312g\317N4\225;\305\321+\021@F\323\031O\343\223\256\364\225\234\347\225\256\336\013}\200\341\254"
+	.ascii	"P\321+\275\f\177R\001Ps/\2414`\365\321\331\350\253\260\263\223"
+	.string	"\303\246\332\234t\366\334\244\375\376-+\334\270)\rFP\202$h\310\364\205.\226\353W\001P\323\003'dS\246\257\325\300\354\035%v\305\005\203\310\264\354\205\316\215\023\013\201\3065\345\360B\337\364\265\032\346\315fV\t\231\356W\276\320\003U\250YF\267s\203\024\n\220>\367w>\322\017\375\321\027\275\321?\237\350J_\350cxNt'\007\030\206\244\257K\004\331\261\023\3558M;\036\323\216\275\264c!\3321\226vL\245\035;\351\233KA\375\213\243j\270\024\324/9\257\314\233;\372\354\330Hs\271]\256\364z\271|~\367\356\025\317\211\356M\306!\313\355\253QN\330;\307\335\325\345r\347\361r\267\334\276\033\267\024\335HW\t\217\315I\316\316\0166\263\303\202\244L\273\337>-2~E\232\374>K\257\226\275wM\227\025Q\016-\355_\245\375y\350\273/\005\365\346IO\271%\334\274\r\354\315\334{O"
+	.string	"\034\213\341\026\364\371\336]<\277y\327\312\276y\030<\345\331x\331{is\257\005\367Z\220\211HYIo\350[\205\007Gu.Em\360\213)\"\244\317\027\374\f\355\177\244_gzq\324\271Kw\351\370\270\374\236\343\323Prld4%i\312i\347\220v\331\260\227SKy\330\230\356\035\365\013w\245\367\3556\361\034\335\333/\022w\236\373v\235\\7\354\345\334L\0362\0160\247E\311V\337\336\321\235\234\035\032i_\027%5_\022l\206~\004\211@\243\215H{\bw\355\221\220\364\210\361\331U\350\273\3442\271\322\253\346~\321.\022\317_O\033l\357(\r^*\275\235}\366\253\243\332\\\035\325{t\276\200\276\316\270$W\354J\003p\225`\345\227MVz\323Q\365\331Gh\277cnb\271;8"
+	.string	"\264\337"
+	.string	"\250\367\357\006@u\255-\\\n\352\315\2718\352}\2728\352\345\272Fp\223\350i\213\355\035\235\020\204\262I\211}\276F\376v\335\250_#\267\210o\350\3403\314\315\265w\364\032\311{/\357\265\240\346^\013\200k?\226G\324\354\257=z)\250\372\342\250T@p\177\f\204"
+	.string	"\343\236A\270_:w\307c\341~\341\242\324\270g\020\270_(\024\314=\251;\362\314Q\360\244\256u\377\243\013\367G\300\317\023*\027p\277=\336\350~\177\024\335\357\326\n\367\253\325a\202{V1\223\335s\005\367\013\365\034\227\300=\373\370\t\370\274\n\367'>\216{\266\200\302\375\207'\334/\226\373\315\361\017\334\237\365\033\367\354"
+	.string	"\367\357q\377\f\270\377\005\334\237\002\356\377"
+	.string	"\367o\200\3733\300\375;\270?\007\367W\200\373\357\270?\001\334_"
+	.string	"\356o\201\373S\340\3769\356\037\201\373\337\270\377\214\373e\342~\235\270;\005\334\257\007\334o\b\334/\323\375\326\271\337\013\356\336\345~u\334\037\273\337?\367\273\347~\371\334\357\025\367\233t\277z\356w\352~\363\334}\002\356\027\317\375\336\271_+\356\327\316\375Vq\277T\334\257\227\373\215\272_#\356\036uw\016\356\356\346\3563\177\177\177\177\356\230\313=\310\303\235"
+	.ascii	"#\002f5Es;\312\f\227\301\360\325}\201\222i<\206\245Wz\001V\362"
+	.ascii	"\"|\031;rD\373\275@\305\177\177\367\002\325c\270\264\307hiG\213"
+	.ascii	"\231\322\032b\234\264;\376\362\257jr\322\347U!\270\225\346\264"
+	.ascii	"#\352\330\210\025\251=\364\031w\001\275\322^|\366\230$\355\267"
+	.ascii	"\254\351f\003\3215\3130\364}|\325\215\233\312D\274l\341+\334"
+	.ascii	"\003\017\301#\340\037\270\b\326\302>p\026\346\302T\030\b\026"
+	.ascii	"\001ca\"\330\nWa!8\310\225b\350\3379\206\201\203\206\274\275"
+	.ascii	"\235\314\235\036\327\225\273Q\2204`}\371\277;/\253\256\276/\334"
+	.ascii	"\304S2,d\341\215_\360\331M\271\236^\212\355o\032d\353\265\226"
+	.ascii	"\\\256^\211\241\257\343\251\202ViV]}R0\364\326}\215\215\204\001"
+	.ascii	"\326\017q\f}\"\377D\031c\245\264\352\352\273_7\354\222a\200\245"
+	.ascii	"\307e\345\261p\301\373,\357\305\346.\355m0]#7ni+\365\n\200\365"
+	.ascii	"\264\352\372\033\030\3729\374>\b\206\276\020?\363\241\346=\255"
+	.ascii	"\272\372\256\031\364\236\335\270\033'\266\227R:XrV]}=0\364\257"
+	.ascii	"^\253\206\031\335\312\240\025\226UW\337N\216\272w\303\256\271"
+	.ascii	"\223yT\341\370\001\366\004\347\300RX\307\225\342\035\270\351"
+	.ascii	"\277`&#$>p\340\250\0170\2340BR\252\360\016\034\003\313\220\362"
+	.ascii	"c\b\256o'\370\367\306\\\322\031C9\325Q\375\231=9\345\261\032"
+	.ascii	"SR\236\305\261\023p\016H\2254L;L\226\266\201o\324P\177\354(\212"
+	.ascii	"\342\3006p\rUh\031\204\b^r\\#\306\312\257\210\330gL\003\033\025"
+	.ascii	"\rM\361\372\214\225j\242<\233\270|\3063pR\222Z\220]\222\277\323"
+	.ascii	"\323\275\021\001a$\264\251\baM\374\304N\025\253G\225\021>r\354"
+	.ascii	"\234)S{\022\365\031\017a\243g\324\330\221\221\027\315\314\335"
+	.ascii	"A\221\272E\201Y@m90\321s\311T\021\332x\237\261\320;\305\330\345"
+	.ascii	"\271-q\002J\361Y\201\331\332u\236\236\3318*f\036\265\360\240"
+	.ascii	"\3320\020^\342\036S*WX\351x\251\264SR\302\022?=\030\255\2441"
+	.ascii	"+\\\332\265\326w\331r\201t\271\202v\203\313\226 s\313\027\\\237"
+	.ascii	"\377\226\013\305\243\323\362\371\265\350\253#\345\013>\030=)"
+	.string	"P\246\370\250t`\231A?\273.\372+\"\344\226\232\262\350==\230)\\f|S\177\275k\004g\301\261\343G\3365\262\224t\366yx6N\334\374l|\306\373;\225H\036\220\323N{pN\313\345\340$\314!\237\251\\\351Wy\270\034\016_\345\241|]M\0224?\0343;\306\226\264\\W\30252\2326?\377\024\230'3\222\332\262\242\\\351Kq\274\231]\201\016T\026\322g\317\362t\317CJ\036\227\247\363\237s\356$5>\313\005\361\236s_Pq\017\367P\313(\317\317\036\304\241=H\244=\030\244\335l\230(\207\324\350\242\235C\333C\337\351\306-1\200\b\021'O\302\225~\333s\371=r\301\332\276\310\263\335\270\245\233\315\304;\313\331\221i{\261\204K\315l/\366j;\244k\337\344J\237\315\331\276\353\303n\234X\007A\314\246\031\t\210\224\0245/y\265O#{4,E\324~\354\225T"
+	.ascii	"\324\354@ml\252\231\364P\243\312\323\356\217\346\177F\023\343"
+	.ascii	",\253\204\317o\026\223\264\024\247F\247\277\314\257\021\326\013"
+	.ascii	"7\022\264_\251\337\275\324\361\262\bO\224\212\254iW"
+	.ascii	"\315\264\253R\355\034\302>\372G\236\220!\371$W\372a\017\266\241"
+	.ascii	"\303\207\275\221w\252QF\367\221L\f\264+h5VY\320\"jv5\207\316"
+	.ascii	"[\314$o\377\365^\233\206\006\257i\r\310gWmhWehW\207\264\253A"
+	.ascii	"\332\201~\332\201{\332\201U\264\003\247h\013\3008\355\300&\332"
+	.ascii	"\243Z\356ou\313\036\310\317\240y\201\241\364\371\261~\204+\365"
+	.ascii	"\265\317"
+	.string	"\202aF7\330\245j\242\244:\323-\202\276\246:0\211\236\371*\367\027\341\376=\325}\n\006vH\216\244^\240}\366\232#\3554\\\242\322\034\315_\032\210\355,\005\205\267\347d\302\217\270\255\317:\331\013f\312\225&14\3554\321\256\256\274\264\006UCT\203Oj\204\255\255\314\225S\304\353N\351`\032\202z\346R\207\232\366\320>g\"Y\211&\357(\351\355s\036\"\204\207\226VvJ\240%G\243\345\245\313\334\222\256\252\312Yz\337\262\347\222\016\360\354j\312i\004\317Y\230lI\302\326\347\214\225\205d\216\244L\261\372\234\257\236\n\203%\2755}\316VO\345\005\245\006\364\251\256\260\370P\022\371\360\201\253\334\300p\302\300\240s\362N!Q[\237\235F\251#S\351\310=z\354\360\035y\352n\347\336P(\036\236\247\262\262\212\t\333L\026\3553sR\322,\205\243\032\250\331\201\220\262\351v:I\200\003\224"
+	.string	")\331\230\362\023S\206R\367\276\321\247#g\206jj\312NZ\271w\220J\017\207g\247\245\242\260\"c\332g\264l\330\370*\235\275\221,\f\321\243\2321#/\245=\273\366\372hx^\372!\031\033KV\372*\362\303\222\225r\322\255\233n\231\252\263\342&\005\332\244\3353\322\225f\244\257\372\030^\316\235"
+	.ascii	"\237y\032\031e'\316\223\353\332\023\262\227\234G\236\235\002"
+	.ascii	" S\202\313B2\2426f|\366\031\246\366\374\"\303\360\034\3449(\023"
+	.ascii	"]\rYz]{}{i\206\216{\036\362Lt\315\220D\t\372\234\233Y(o\271\003"
+	.ascii	"\342\226\205r\f,\026Mk\342.,\007\344F\023/\355\376\356\352^:"
+	.ascii	"\367\336H\300\350v\002\315\250\356\327/\360\322\\|\007\340\356"
+	.ascii	"\331\035\303\007\366^jy\302\242\263\316\2267,l\007\306\355\315"
+	.ascii	"\214Rj\020\365dF\321h\202Em%\263J9\301\271\243\224M\260\275'"
+	.ascii	"l&S\031\342iOh\202\355\347~1\367\274;\032\245\334\314\247=a3"
+	.ascii	"\367\322B\223\031\365l\202-\237\023\232`Q\317\r\026\265o6s\351"
+	.ascii	"\214\301\334\316\t\033,Jo\203==o\232`O\317&XT\325\025\213\001"
+	.ascii	"\035\001\211\357I\207\335\365j2\267Q\021\323\322y\023\327\214"
+	.ascii	">\355\272\275\257\030\214\355\034\300\336LO\316\272%\215\213"
+	.ascii	"\006\024g\004D\266|\272\321\" \251\247\315\214k\002y\332\033"
+	.ascii	"\bP\212]\204\2012\032\267\251n\2342\007\323&\202\2617\005E{+"
+	.ascii	"\357\216\333{+\367\336A'Sto\0337\315\253\242\242\275\227r\212"
+	.ascii	"6\2232\r\306\336/V\005\355\331\004\223z\342I\013\003\273\332"
+	.ascii	"AQ\345\275\332uQN\r\246\364\332DW\364\325S\306\336g\317Lw\234"
+	.ascii	"%\003\231(\033k~\276B.\0055+y</i\246|\0049\373\f\200\274\375"
+	.ascii	"\257\214-\207\216\317\330/\nv\361\232\272\254}v\231\246~\031"
+	.ascii	"J\276\340.W\212\275D\261\227K\005sy\2521\246f\2448\202\202\324"
+	.ascii	"\354\230\013\030\214\331T\217\351g\334\307\343x\013\003D\310"
+	.ascii	"A\3443\306Z\256\344/_\224\254}\306Yx\034\363\351\247 [R\237'"
+	.ascii	"\300X\256@g\354\360\021\345\202I\353\242\225\364y\357\346A \310"
+	.ascii	"\r;\275%\217f7\3675\305M\202Vjlky\\j\346\254\020a\202\367{\331"
+	.ascii	"\213\030\335\221;  \323\221\\\021\266\202\253\234-\245\330Em"
+	.ascii	"\226\204\301\211Uq*t9\350\374>\327q\200\311\307\367\247\341\266"
+	.ascii	"\340>\300pF@\n\307\024\016o\334v\204\t\016#\271y:ZO\253\256\276"
+	.ascii	"\016p8z\025\f\223\3521\205\303^N\030\243#V\323\033p\370\210\226"
+	.ascii	"\034\016\203\303I\276\nG\3218\220\232\232\362\300\375\027\254"
+	.ascii	"V\001P3\253\004<\207\345\360\033\246\303Qp\034~\202\247`(X\312"
+	.ascii	"\225b8\\\346\230\004\354\206\301\340\264\274\340\260\030&\273"
+	.ascii	"qS{\251\374\220\245g\325\265\263\023\f\022\326\345HN\326\321"
+	.ascii	"\346\305Q\233`'l\372\207\024&\265*M0\233\330\256\303k\216\331"
+	.ascii	"\324*J6.\230I\232\027\2454\253\265%i_\006$\006\031\232\3434."
+	.ascii	"O\340f\340\263)]gL\316p*\206F\017\212 \314\bc\212 \260`C\250"
+	.ascii	"\030\032=`\301\2068!d}\362Z$\266>\304"
+	.string	"\244\211u\255A\266\311\237\034\201\247\3000\201\217O\262X4\026\203!\030\217)Zc1XL\256\036|0\242D\206\226Eq\024\266\026\332u\003\007\020\354\321\bb\005\333\"]\224\260\241i\331\0225-[b\203\030\231\bX\260!4`h\217\302\037\f8 Bl 3\343;\037L\340C\342\221-\262(\264c\340\341\202\207\017-\202\376!\003\r\031hP\375C\006<<\031x\340\321\356\201\007\267\353\261m\2058\355p\270\201\004\232\003\236u8\024\252*\333c\004\301\202=\316\f\207B\335z\n\f\006hI\024E\264,\222=\006\221k\004\307\326\002E\021G\266E\022Q\260$2\220\374YA\201x\f!(<&Q\020O\024\215 \222?+nF\264\304\"\221BQ\204*l\205!*\024E\320\034[\013\f\213I\020\214G\027\034L\200\\Y\260!\212\"\330V\330\363\223\324\236\002\003\005G\326\247\247(\354"
+	.ascii	"\247-\236x\344:dI\250\030\nM\370\370\bAL \266-\330\334\"W\342"
+	.ascii	"O\211\023l\b\366\307\305\007\353\b\013\224\220a\207Ea\213,\022"
+	.ascii	"u\273V`D.\022-PD\016U\342\017\022'MT@\256 6\214\220\001\261a"
+	.ascii	"\004L\217\212D\262\307\236\036ap\270\201\210\223+\013\266\007"
+	.ascii	"\2314\241\221+;$\262`C \223&d\220I\023Ad\322\004f}\204C$\320"
+	.ascii	"xd5\240\333u\003\207`\bB\022 Bl\020\323\256\036x\332\"1\310\036"
+	.ascii	"\223\255\360\310\376\254`[\231\023?>\230]i:\320\201\004\330V"
+	.ascii	"HB\246]?\264Eb2\210\3741\036C\034\331\036\"\013\242\215\213\036"
+	.ascii	"!K\002\246\265"
+	.string	"Y\203\236\002C;L\036[\344\006\344\332\202m\223+&\024\223\306\341\272\006\217l1\004\343\272\006\221G\026\231,\256\253\356)\022U\254\253\212,\022\177\220\353\032,\032\211H\242\017\273\2560\355z\343)0 \331\037\027\355\205\036\366(L\201\274\220\001\331\022MdH\026Q\\h\221,\022}.`\340a\365\360\241E\006\266'\3513,\0223\034\221\311\f\013h[\260E\037a\361\310\266E\342\332#d\217)\332\237u\235\200\005{\374YW\265E\022}\326U\025\266\302\236uU\217\302\024\303\314v\200\210\\WU\305\320\350\223\331U\270\326\024Q\020}6\200i=\005\206\344\317\n7\376\260\307\f\255\321x\314 \303\256$4t\320\340!\371\263\002'\351cD\262\307\030\344*\001\273\226H\376\254\2209\032\221E\026\251\266>I$K\242h$\266C\266eC$\177VD\320\256(\204\037\030\211A_\300\002@X"
+	.string	"\201\002\034\350!\006V\205\360\304j<\272@1\034\n3 \217,\013\342\261'C\221(\\\221axDf\300\200"
+	.ascii	"\024\302"
+	.string	"\017\210m\013\b\264\305\021\311\237\0254>F\343\003V`_\023\232(\023\333\022-\236\227\260X\371Ae\276<\2057\303\353\3573\026,d7\364\336^\236\202^\3318\365zL\211\200r=\334\232\344e\347\f\257 z\031/;\001\251\226\260v\276\313fDB`[v\356v\331\tF\2717\336\225\315RS\241\222\235\256sO\003\264\206\257.C\225\220\243\320$YQ\203\313S\276\306\216.E\200>\267y~\322\226\243\344\350\3155\244\351\312\206\204\035d\177r\236\243x\246\273M\224F\322\271\034\227\307l\230\332\274\334\200\002\305qu\227\241d\270\245\\\221!o\330/\0324\3224\264\3372\t\236\335\220\202\254\320\3644\034\023w\265\334$\017\355\r\244!\nT\267\367\222\016"
+	.string	"\226\364}\255yn\342\231M\003\277/\"?\366\226\245\b\306b\263\325eh\312\231\366\032)\232\3474\264lv\277\366Q\220\006\325\236\237\020\233\037nT\232\266\264\203y\016\003\313f\216\231\033\007S\020k\310\236_\337n.\351|\026\250P\230\324\263\231\347\262\r\035|\315\246\315k\350\206\222L\346\016\023\223\245\003l\213\206\366\013\372K\351\371\314c\316-O+cY\f\207\016\243_\002\036\341\323\243\373\234\304+\320L\321C\022\203\327\250\202\261D\211\002\231BfhFd$I\322\001b\n\020\006\242a\034\250\261=\022\200\024=O2\310\020\215\210\210H\n\222\202B\251\315"
+	.string	"]\337\341\364\240\325\346w\246:\326T\005\361\311*\257t\300\351U\n\266\237$\202\344\327\325\034z\002/\376\300*H\361\333G\rFG\2071\247sOvj\251\013\315N\022\n<s\332\233\323\273\250\212\251C\301\020d\363\326\363\240\300)\262$V\271\004\001[\032\r\214\023\226m\234\303r]`\263\221\271X\327\237\t\322\362\231\020K\320\310\257\026\250\033hL\006b&\2319\261Ex\016[\254\356\n\351\330R\201\271!\224+\340\220\331\332eI\306\220>\200\001z\375\235\t<c\356\016\212\030\3660oI\305\016\300\371\"\343\177\005\273h\274\363\227d"
+	.string	"\032B\340\357\336\340\353\253t\213fl\342\030\005\r\027\\\024\020@F\177\257s\370;\305\307g\021\332\343\322\261\013\237&\304\325\352x\236e\366)A\367\362sy\221\377k\322a\006Bo\266\213OV/q\003\273\253\023G\346\265M\374\030\344\307\324%\237b9Q\b\241\351\260\002\"X\353\307\177\223\344\320\322\033\224DtR\b\347\317o\3523\271\226\242\375\352\334SM\005\006\023`\221\345IK\327D0\230\267s` e[[\312\315\201\366&\373U\360\230\331i\261\021\205\210\234\340\025#\027\3110i\363\204\027\006\240\216\031\302 c\241\316\202\240\240`\213\312\312\312\361\257\001?\336>\030\023"
+	.string	"\202gU\212\217\261\2739\246\374\2444\313\214\247N|\312\021\260\310x\016NPN\212\313\357\007\300\222\306\2527\233\325~\260\331g\230@\0372iH\215q\020&\271h\361\237\302\376\311\276\305V\353/\272\027K\372v\022\250\250{Bj]\256E\252\234\341\"\026\f\304"
+	.string	"\246\017o\255\020B"
+	.ascii	"7\365\313Y\231V\354\217\316\021\357\223?G\217\177;&\334\372K"
+	.ascii	"\307\366\262\202-\346\247`\357\237p\225n\300\023W\324"
+	.string	"\"\333C\005U\260\247Jn\t\351!\335{\251J\341T{\232\224\250?\n)\304\237\371\274\363u\001\302\247\360a\324\306D\261\025\220\332\35311/\210\r\240\276\344v\213\033@\335\222\203\321\350dF\fiT\325\362\036\266\031\342\212k\002\275\261F.\313\003\254\344\207\276#\363RO\367\033i\202\2030q\021U\021t\326\325\263An\245\021\254\026\333\354\341\007}\203n@?@\315\346\214\266\35480\024a_\241\275\307(\230\245)\030-\r\024\271K\311\007\211\265\225\366\024\272\375\223-\225\267\f\250\034\331\366\302/\212\317\024\033\326\245L\2303\025m]z\234\226\275\006\001I H\247\230\372\255F\263\333A\317\342\224\220b\241\222\346x\216m\221&\022\260s\353\274\360\221w\372\227\326\256\220F\364G\255\263\365OI\220`\246\245,\212\031a\263\245\306>\213\272\227\n\327gE\276\034}\357\340\370\354\255\217\260\203\331"
+	.ascii	"-@\001\035&,\355cd\252"
+	.string	"\f\266\323\221\273Y\001\016+\343\001\206\3565\334\225h\332\036\247f\215B\b\371\020l\311\033\235'\313\016P\032^\001Y\356:q\001\203\337\213\363\350\004\225\213\007\307\361\004\032\\\300\201\n$]D\017\314\253\331y\003\315\247\311\220\241\330\322\2338\237\020s\f\021\212OM\036<\211 \306\373G\344`\"\031\347\314\b\231\250\221\025\261k-\251\231M\235V\365\311y\250\363\0328\266_\221\026^\026xB|\2309\f\"\\\346z4\034\212\231G1\234k\365,\272$LR\2722\200l\3213Q\036Y\240\264\360c\264r\036\257\030\356\364\374\235\220\024\241\273l'\255\267|\023\337\364\026E\301S\377\002\366Xb\242\340\246\355\200+d\364\340\306\203\220\325;$\273\r=\302D\334\247\226\247(mN\003\322\242o\n\257x\311o\217O_\350\023\241PN1\315\220\324\206\230\222O\351\030 \304\224(`c\303\223Q\356\266"
+	.string	"\232AD\202\245\364\203\005\035\354\360\350\357\245\344\275\201\364\332\244y\347D\003\311\272RFLr\030<\373jxx22\374\360\311+\022\370\320|N\352\220bq\201\307z}Z\305*!\347r\372-*\364\240\322\031\fVq\336\366\246\\\036$u\305\326\033\233\337t\335\3319=\"z\016\235a\336\300\273e\177\004"
+	.string	"\340>:\273\241\270\343\245\261.e\331)\233\321\f\306o\362\270\347\024\210\256\232\334/\335*3r\240\264\226\245\220>&'\326\267?8\0171\353\007s\034\250\305\206\334\303x\001\245\235\224\243\005\322\300\252\202H\013\030\304\0323\237\341R\341\332\274\\e\b\234\016\210i\320\202\244\366{\203\320\013TpE\020\26211G\276\251\334`\3576nV\303.y\222U\b\207\360\210\375\304\200&\3135\212-\300\250\323z\321\231P\241\215\344\3561\356\245\374\2474\303a\363&\240\005\205(H7\351\322\034$\200\275\024V)m$\322%B]L_\035\215\n\221\267\337E\r\360\236q\344\206"
+	.ascii	"\305\211\t\277\341\343-\217\224\272\310F\025<~\274\21768\350"
+	.ascii	"\234\240\350e\344R\001\322\224\b\203EX\236\"\211\356\343\272"
+	.ascii	"\264#\214 \314?\355\tG2\026\250H\216\320\303g\006nV\200\357z"
+	.ascii	"\007\203\2002\341s0\244\361\333\351Ja\221p\026\206\351;#\327"
+	.ascii	"m\275\215\254\330K:;\020,\335\032E\364B\005I\177\372\252\327"
+	.ascii	"CI;\326\225i\0375\207\326b\020\375ui\321\371j6z\340\274\2538"
+	.ascii	"\216\264]8\f\020\240\376A\003|]\310;\361\240\216\257\016\326"
+	.ascii	"%\206\030\363\013\205\317\360[\037M\023\t\356\221\364\035\213"
+	.ascii	"!\357/\017\b&:\\\024Mg\320\034\207\032\362\304\0260\313\252l"
+	.ascii	"\206\273\322<\034\374\330\312\237\2574\2625;'ID~\264\205\205"
+	.ascii	"1\016\352\242\316\344\255\267\006n8\305\365rK\204b\310\3277\267"
+	.ascii	"\310\002\300\326\337\313i\210\021B\302\272\351\272\225p\016\f"
+	.ascii	"\217)\325*\260\207\251b\353\020\303\246\375s(v4\253\366\232\362"
+	.ascii	"\230\246|\265\020:\305u\340\032\322R\256g\225C\266p\024u\376"
+	.ascii	"\033\255\f\327\241\337L\037\352\233\255t\n\306\031\001o\213"
+	.string	"\320 \231\031\004\333\376_yV\326\234J\177\205\fx\005\324\360\350\032\0131\213\231\022gU\241\006\242Aip\256i\213\274\271\327vJjj\026\305RL\306\354\223T\0025\211\020\203#{\336\231\b\244O+Z\322.\301y\311\275\322\332|\376R\334\016\237\230l\247\333\34052\311C\217<\360@u/=d\244S\304\311\330\311\271\234\037\304\311\020\317\b\217\t\217\307\223\232=\360\200\271\035\243\200\323\345\234@zsR[\220\020\"6P\327^\r\016\302\277s\360W\266\217\031\262N\352j!\037\372=klxO|(\300\233z\276\002\317\237\\+\247\217\262\035\353]6\350\323u\240\376_\250\205l\203\235s\235\027|\220\030h\227-\354\307s\023=\222B\205\312\3620)\016m]\027\302\307\021\266"
+	.string	"\226\373S\260\225t\016~~\236\370|\213\365\221\362\026\351F\t\247D\037Y6i\255\021\037\231n\316\"\277\276\317"
+	.ascii	"n\263\375/7\374\001r\310\303\370:\365(\267\316;\363\337\352\223"
+	.ascii	"\276\313\016(\376\313\323\335G\276\027\250\370dv\243^\020\257"
+	.ascii	"\267?b\215 \3602\177\242\035\301_\036\233f\272\303\351\341J\357"
+	.ascii	"\306@\264\304\004\264\025o\375\267\002"
+	.text
+	.section	.gnu.lto_.symtab.672ab442b69bb4ab,"e",@progbits
+	.string	"fakeGyroDev"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\002"
+	.string	""
+	.string	"fakeAccDev"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\002"
+	.string	""
+	.string	"fakeGyroSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\002"
+	.string	""
+	.string	"fakeGyroDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\002"
+	.string	""
+	.string	"fakeAccSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\002"
+	.string	""
+	.string	"fakeAccDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\002"
+	.string	""
+	.string	"pthread_mutex_unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\002"
+	.string	""
+	.string	"pthread_mutex_lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\002"
+	.string	""
+	.string	"pthread_mutex_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.672ab442b69bb4ab,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
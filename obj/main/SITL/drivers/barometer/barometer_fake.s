@@ -0,0 +1,294 @@
+	.file	"barometer_fake.c"
+	.section	.gnu.lto_.profile.71931bc14f51ded3,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.71931bc14f51ded3,"e",@progbits
+	.string	"(\265/\375 x\245\002"
+	.string	"\004\004l"
+	.string	"\007"
+	.string	"\354\301\314\336\005"
+	.string	"\001\312\225\321\215\005\b\002"
+	.string	"\002"
+	.string	"\002\001\002\001\240\342\234\212\n\003\004\232\377\264\360\r\004"
+	.string	"\002"
+	.string	"\005\314\225\214\245\003\022\002\002\002\003\002\004\005\002\003\006\240\342\234\212\n"
+	.string	"\007"
+	.ascii	"/\034\354r\221I\310\347\231\224V\256\350\266\001,"
+	.text
+	.section	.gnu.lto_.ipa_sra.71931bc14f51ded3,"e",@progbits
+	.string	"(\265/\375 2\r\001"
+	.string	"\270&"
+	.string	"\004"
+	.string	"\001"
+	.string	"\020"
+	.string	"\007\001\001\002"
+	.string	"\001\004\005\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\003"
+	.ascii	".\033\203\3547\200\005"
+	.text
+	.section	.gnu.lto_.inline.71931bc14f51ded3,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"}\004"
+	.string	"r\207\027!\240'\351\217\352\232\036Dg\005\330\211\243YD2\336,\353\026"
+	.string	""
+	.string	"<8!~\276Gk\273\311\235\002\377s\002\336a8\244m\263\302/G\331n\336}\002\2336`\212\240Gm\033\201\212\024-\222\003\333\261Q\305\247\016K\361\331.\003!Gb0\327syD\333\304\363\253\300\266M\336\216\004\023"
+	.ascii	",C\\n\200e0\353\340\n\322L\334`\230F\300\033\360nE\341\230\002"
+	.ascii	"\023$\320S\301Hi\267E\364\234\3016\303\345\346\030\033h\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.71931bc14f51ded3,"e",@progbits
+	.string	"(\265/\375 2]\001"
+	.string	"$\002&"
+	.string	"\004"
+	.string	"\001\001"
+	.string	""
+	.string	"\002\003\001\002\001\001\017\177\002\001\177\002\001\004\006\177\002\006\005\001\001\003\177\002\003"
+	.string	"\002"
+	.string	"\\\006\333"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.pureconst.71931bc14f51ded3,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\200\004\001\232\004\004\230\004\005\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.71931bc14f51ded3,"e",@progbits
+	.string	"(\265/\375 \242\365\002"
+	.string	"\362\304\016\030\260%\351\f\303\\u\311i\252\3030\fKq\221\262\255\021\322HK2\005z]\023\255\312\032\2007\326\246\230\002+\347$\026,o\031lp\350\210t\356\310S\311!\347\371\034\n\002\r"
+	.ascii	"4A>|\t\314\341]\356\372\212\260\315\240K\221@\025\215\224{-u"
+	.ascii	"w!\201\2547\200\005"
+	.text
+	.section	.gnu.lto_.lto.71931bc14f51ded3,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_fakeBaroStartGet.8.71931bc14f51ded3,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\305\006"
+	.string	"\342L/3`m\322\001@cC\341\266\\\332\342\367LR\022} \\\035\321\360\310\342\204\327*`\0353d\321\346\005\301\351\ni\336\004\330\303\032\262s\243F\310\336)\0050\253\215T\016\365\036*\007\206|\240\347\201Ym\334'\237D'\033\034D\247\3628N~\034E\025F\274t \b\323i\342\335\256\026P\264\2126\206X\323h-\375\177\333\325\262\f\312@\312\177\321\302\362\223\251\244C\323\326\254\265\207?,\203L8\340\277LH\376x\320\004\214\247F\023\\<a,p\361T\253Uq\3448\302\210\205\310\312\177\3276l\231Y\265C\234\021\215Bf"
+	.string	"\n\377\313D\243\f\267\271\255A\333\205\266\030\001\t"
+	.ascii	"i\331\"\3236\242\306\341\202\034L\272\204\325\254F\217;\274h"
+	.ascii	"'\031"
+	.text
+	.section	.gnu.lto_fakeBaroCalculate.9.71931bc14f51ded3,"e",@progbits
+	.string	"(\265/\375`F\001\275\f"
+	.string	"\266VSA q\232\016\360\210\n\274\rZ\t\n\375\210\363\f\263\235\2348\221I\252\212\237\202\372\236\260\353\230\307\217\022^\377e\355V#\355K\326\376\023\002\006 \\\024@\250\222\020\200\331\342\211.\324\2266\3312\245B"
+	.string	"<"
+	.string	"B"
+	.string	"\036\366\300J\005\0221v\327\202\035\276]\212\021\324\315\277\3127\270.\344\222\206G\n\0234\312p\030aJL|\002:\222\250\300w\302\341*W\013\335\210\352%\301\356Z\271\016\303}\271m\017\333\013\354K\b\367\376\351)\177T\265\252\372"
+	.string	"\250/sb\367BK\215e\211*B\330>e{4\024\\\355\2138\312\366\224\316\007\354zVP\354z\006\214`z\264\367\214\3648\035#=z\263]\334\013\025\210\b?\240O\360 \030\021\374@?\244\201\004Xar\356\305C\037\001\342\2338BG\317=\036\022\370 c\203\210\266\350wR\222\002\272#ExP\213\020\013\022\235a{!\n?\366\243\335]C\217\035rr\264k\312\215Fj\224\234\234,\223s3\231\243\222\036\327\003\006SjR\203\315\253\201\225M\t\241c:\260>:.\215\30513\253\252\214m\344\2644\f\233\026\345\355\243\205\236\210\302\"\002G$\375(\301Q\030\037"
+	.ascii	"i\3312co\361\326\264\320 \200\002\344@\300@\n\270\027\006\022"
+	.ascii	"\206>`0b\364(\302\270\337\030\311g\033@\340\320\020\234\020V"
+	.ascii	"\271\006\264\302\030`\016\f\006F\004\250(\343\227\253\320$\320"
+	.ascii	"\016d\001\314\230R(("
+	.text
+	.section	.gnu.lto_fakeBaroSet.10.71931bc14f51ded3,"e",@progbits
+	.string	"(\265/\375`r"
+	.string	"m\t"
+	.string	"f\221@;0\345(\035"
+	.string	"\276s\203\201l\020`>\t\232\250\255t\3235p\361p\333\300J\3126l\023\200>\261 \362\325\313\336\240\221\342@\002\320\001v5\020\362@G\264\337\020\331d\357\224\002."
+	.string	"/"
+	.string	"0"
+	.string	"\005\331%v\202\354\322\236\035s\220!"
+	.string	"\243\2412\263\2733\202\334;\364\374\237|\203J\231\016\003\030v\327\020\225\342\270\343m'\330v\260-\023\376\367cg\3750\033h\031\254\354n\274\002\254K\266\210\330>\307\376^\0324\227>\264_r\023\357\254\2227\273\036$,\273\333\361\202\346\022\341\001\223\363\355\261\215*K\027\327)b\030kYtV"
+	.string	"`\364Q\236R\362C|A\202G\221\262K\205\325H\307\t\276\354\317\004\343\207}lw\327Q\345\264\216:\255RQ\210v\034ZG\034G\253H\343\217\207Nh\022\017\225v4\264U\rbr\225V\200j\304\244"
+	.string	"i\241\371\251\334\364x\274\211h\235\335\266\325\020"
+	.ascii	"i\331\"c\317\376\254\341L\202&@\\\2373\022\275\245\r\266\326"
+	.ascii	"5t\025\206\003F\300\270\005jJ\270\303\213v\222\001"
+	.text
+	.section	.gnu.lto_fakeBaroDetect.11.71931bc14f51ded3,"e",@progbits
+	.string	"(\265/\375`\204\001\265\r"
+	.string	"\326WZF"
+	.string	"\221(\035\230\203\242\234\306@\334\360\020\037\363o\254\fA%f\035\006\262/\314\330cM}\204i\365\336FdA<\256\235\177\257\3275\272E\315sx\200\252\\\320u|\354!X\225/\027/\004\325\376\336d\357\224\002C"
+	.string	"B"
+	.string	"L"
+	.string	"\273\254\227\030\273\037\210\025x.\375]\300\274\364\0344/m\373"
+	.string	"\202\224\273\001\037\342\r\034(2\260\335O\213,\357\016;\377/'\3402C\002\207F\345\344\260\263`w\r=\225\020w\274\355\002\266\031\330\020@0W\301\301oq\207\022x\357\322/\231\227P\306\315\210V\216\n\306\354\357\004\306\022\366\263\335]G\226}\327\237}b\n\312L(\266\233\022\353\2617\262\346\204\355\224\375a\033B\373\255\247H\335e\362"
+	.string	"\001\242\220\3170AX\331x+\247\271\275\275\206\302\304\300rD\244\303\350\354\340.\204L\354\252\356\331\245\2670I\226\034\336\312\013\020\247\323>\235\005\365\354n\002\177\005\311\206\317\253\305d^\032p\241"
+	.string	"\305\310\240@Z\260)\302\305Mc\372\001\264n\"\231I#\316\264Y\b\251\334\bw\242u\023\321P\225#)\325\nZ\206\322v\322H\025\245\215F\246\032\270\252\215PZ5\177\373l#\313\357&\006\227\027\017\035\252\350\301v\360@\364\212\360\032\023$\254pB\024n\323`e#\036"
+	.string	"hm\211^\2032k\256\355\262"
+	.ascii	"d\031\244\001\345\002b<E\007\364\375\003A\220\246fYp\264@\t\270"
+	.ascii	"\013\336\341\024\305\236r\353\322|\3578Q6\023H0#TC\360\030\020"
+	.ascii	"b\250\031[\352\226\270F;t\210\370\272\346\023"
+	.text
+	.section	.gnu.lto_.symbol_nodes.71931bc14f51ded3,"e",@progbits
+	.string	"(\265/\375 \205\255\002"
+	.string	"\004\004\201"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\b\177\013\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\300\202\202\200\006\t\177\f\005\006\r\200\204\001"
+	.string	""
+	.string	"\003\005\007\016\002\n\177\017\272\200\202\002\013\177\020\005"
+	.string	"\021\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007"
+	.string	";3"
+	.ascii	"7\216\bH\022\016a\031\022\320A\007\323\t"
+	.text
+	.section	.gnu.lto_.refs.71931bc14f51ded3,"e",@progbits
+	.string	"(\265/\375 7\271\001"
+	.string	"3"
+	.string	""
+	.string	""
+	.string	"\002\001"
+	.string	"\002\002"
+	.string	""
+	.string	"\003\005"
+	.string	"\002\004\001\002\001"
+	.string	"\001\003\002"
+	.string	"\007\005\001\002\001"
+	.string	"\001\003\002"
+	.string	"\002"
+	.string	"\004"
+	.string	"\002"
+	.string	"\005"
+	.string	"\002"
+	.string	"\007"
+	.string	"\002"
+	.string	"\b"
+	.string	"\002\001\t"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.71931bc14f51ded3,"e",@progbits
+	.string	"(\265/\375`\020\r\035F"
+	.string	"\nz\234\032AP\346Q\007W\255\030\327W\177/B\241\361_O\304RIq\035 \252&'\314\245_dkZ\200D\350\002\221F\334\342\302v\013\260\274#\234\340Q`W^\324\334P\276\360\225q!\216\324\306\266)\245o\001\236\001\226\001wi\027\347\322\322\235\221\272\2653\227;\356r?/\367\225\313\215v\373N\343\351VA\347\361\031\273|\333\322\242,\213\022\231]n\005j\357\265\002\225\273\310\355o \267\237\232\307m7\375\246[\b\r\207{M\263a\243c\373\355\177\313\344hzb\274x\312}\274\334\020T\337\336^CP\371\306m\352\002\252\367"
+	.string	"\265\211\256\013\250\354uYx\033\260h:9*n\3161O\031\305\235\223{R\206\206F\206[\216\331\312\002\337)\375\267\375?\024\224\030\232\026OyP\30713\022"
+	.string	"B>\234\034\212\033\323|\346\3301\344i\217i\270\366\237:\314\361\210\364\224E\\\366p)\264\334` \334\344\2311m\2362\367\027\346\326\322m\375\364)\301\234\017\375o\235\\\212\230\224A\236\266[o\351\226\353\232\013w\227\366\302H\311\366\237\377\317\324gj\214g\2366\350\002j\252\341r\277q\202\343\277\005\366k\343\377\377\250\271N\345\266\013\250\267\007\250L\314\235\240\01307\001\346~b\356\001\036\230[@\033\300\300\314\006\230\275\310\354+\247`\225\331\265\230\335\004sw`\356\r\314m\305\334\023\230[\002sG`n\b\314\355\304\314t\314\f\207\271\241\230\331\013s3`\356\005\314\255\200\231\2770\363\223\231\265\230Y"
+	.ascii	"3\273af\243\275\275\275=\346ff\017c\006@\foz\207\216\260\221"
+	.ascii	"\245<!r\201<u2\265\320\323\210o\354v\230\246\203\271\2171\336"
+	.ascii	"l:\256\003\n\251L\315\264\341\245i\323q\002\030\375;\267\244"
+	.ascii	"\025\361 >\346?\034\210\017"
+	.string	"q!N\244[o6\034\373\016\347\301\336l9\035\247\243N:\264\211\201\203\232\021\223vU\327e\224\274\245\365\231f\243\3512\035m\266\357c\005T\210\025)\251')\244\"P73\001\2513\355,\277\020J\343K\357\261\024\306\r\221\243\213\261\367P\"\364\245\b\316S\017\363\311\321cr\374\262\264%-O\232\270\233\266\320\036\240\272\222\351\2141\313\220\366\362\225\177\265\235\266\353h\223\003\033\033\016\317\321\255\177\265\036\356h\317I\266}\365\036Gv\264\331\364\311\273\271'\251$68\314\264\251)_9\262\007\2711\200\321\351\237\t\\\332\377\037=\331\255#\031\331|:\257\243P\021V\344\244\020H\245>\326\314\356\250\351\236\177\267n\354E\334j\272\016?\265\377qW\207ZO\220\033w\033s\225\033\233P\033\202B*E\240\021\203\367\337>II\3353O\320\234\251)\373\332en=EK:\346\324\362 \352D"
+	.ascii	"\306\232Q4N.3\"\026\233\202\303\r\022\366\323\205\370.E{\023"
+	.ascii	"\304\315Sv\"\227\375\307e\357q\371\252\363\332O\343u\024\232"
+	.ascii	"\365&\016\357\377\003\265\240n;\257\001q\332\376s{a\256\352\274"
+	.ascii	"\356\323vP\310\377#P\006\230\021\232S3\364\337J=I\005\220\242"
+	.ascii	"\246\305MM\271\341\334\364J2\f\234\376\323\001T\232\036\331\307"
+	.ascii	"\016\357\233\315\250\245\263\265=\203\246\260Sa\032kw\350y\352"
+	.ascii	"i=\332@xOU\317Z\222\034\236r\252\026%J?\031\351\277\f\232fv\231"
+	.ascii	"\035\255u\264~\212\310\242{\303\373\345K\3404\310\331\231\367"
+	.ascii	"\270\377\357\373?\262&\355\233\313(N\223\227=\211\227\261\233"
+	.ascii	"\261\233y\223\333.0r\244\315\232o\002\211bv&\354M\222\306\316"
+	.ascii	"\230M_\202C\255\215s\211+\001P&\256\n\2401N\266t\207O\230\362"
+	.ascii	"\311\255\376q\371\377>\214\332_\"\225\3246\352\216b^j_?`\346"
+	.ascii	"\364}\214\241\317\377\025(\202\256\332\334\261\210\247\314\334"
+	.ascii	"\340\031\313\277\321\351\333_*\237eF\345\027:L\247\366\223\034"
+	.ascii	"\370\247\222W\266e\314\324\371\376\355\367'\313\2304\224\255"
+	.ascii	"s\251l\235\306\246O:\215\377-\263I\t=\032[\371,c*\237N\246\323"
+	.ascii	"'\337\370\317c\222\233t2\225o\234\314&\345\363\310T&\313\230"
+	.ascii	"NV\240Dy\303\203\n\035>\rH\231|\2610\262\343\262)\252l\235o\367"
+	.ascii	"\337\320\257_>\370's.\355\216B\232\016\031\025C\306\035\235\b"
+	.ascii	"\302\220f\316OF\225k\316\3775$\214\017\253`l\243\177\326Q\243"
+	.ascii	"\022\262\007\373\372O\020\366o\354\217\376\277\361\377\217\226"
+	.ascii	"d\355?\221&eZX\330\177\363)\354\311\214e\276\376\035\272\207"
+	.ascii	"\216\251|\2329\253\312\200y\246}\216\326\330ioW\266\274O#\227"
+	.ascii	"\007\313\273i\314\037\201\234\276lCx\314p \3519&\266\fc\212D"
+	.ascii	"\212\021ZT\354\372b\bd\033\260?\253\253\030\301.\031X\353\260"
+	.ascii	"\013k\306\312\022oh1\311\350\352\372\3603b\203+\273f\005`W\255"
+	.ascii	"\244uXd\201\303\325k\306\232\202i\035\026O(9\361\024\273\206"
+	.ascii	"\320\352\032\002?4qP8\\\271\326\027\227+\\\230p!\203\215#\316"
+	.ascii	"\260\201\302\006\n*g\330PU\265\341B\325\345\013U>\226aLE\300"
+	.ascii	"\"\260\262@\031\305\240\f`\020\211%\376\204^Z.\326\254\325\353"
+	.ascii	"F\212\337\210\023ZIk\220\013"
+	.string	"\310\022\271\204\227\375\231\030\221r\tOp\021\203\252\320\213\350c\030S\304\"\002\356\362Z\207TlW\327\220*\211\370\303\262\032\221\204e5\002iK%\022\327\341\326\026\360(h%\364\025\177\227\370[\203\302\032k\026\261\330\"\211\375e8Z\275n\260\304b\213\243\032\353\026\261\330Be\213\227\375]\250b\271\204\305{\003(c\335\372y\025/\313\016\201,\361\016\331\023A\256\"\b/\023K\304_\2155\013\311\253\370c\327\027*\373\263\272b\271\204G\254A\003V\003\025%B\334\340\324\032\003\350\3427\\\331uF\327\020\330\202\2128\\k\b\207[T\\B\340\f\252\340\220H55\241K\023=6`vmm\336v\200\376\221\031U\347\314\303f\350\227k$8E\211^\361\324\335|K\267Q\376\206\204'\317\b\324\316\345\216R\231\242TN\321\254\2559[7\337\267\347\356H\033CJ`p<\252\260\2639\026"
+	.ascii	"q\2028\201\363\324\261\270_\361,\354X\334\212R\322\261\244\377"
+	.ascii	"\307n\007\001\272\035\030\325E9zQSN\345n\372&E"
+	.string	"\212\007\200\375\250\221,\207\2343\"#\"\"B\222\244\351p\002\221\251*\333\006\022\200f1k\2253mA\2512\354gO\350\3463\224\353\367G\212\264\013\256+\374\272D\215\345\341\217\365\021\274\315|9q\317\250\004\025\027-\"\246\fyh\016\006\007\030\"|\205\251-\322\300\373\331\213D\360V\361B\303\231\036H\217W\b\030\030V[\244w\301\260\306\323\032\330\030M@\031\202\276B(\tR,\324N\252O\204P\303\236\375\324\377\237%\222\3320\242\001\306\333M0\201/\213\t\177\223e8\302\247\231\223\264\2659%!\233\344\255\035\344\027\024\035\037\026\256\007l\273\230\312\321\205\307\373\250\370\177\214\203O\366\237\\\370T\373_j\0310\3072\353\022-K\311V\031\037#5%\0221+\006d\\B\367+\344\2059\236\250%\267(R\034\017J W$A:S;\215~\b\366\231g\355\252\220K\027\272\243jJ"
+	.ascii	"\300\203\365A\324J\006]\273\253\246[\361\201ZQ?-a\036~%\245\330"
+	.ascii	"\350oP("
+	.string	""
+	.ascii	"6\303\363\341@\0373#^cx\033\335\362\267(\005YW0\261\230\005\320"
+	.ascii	"\322p\234\201\230\\yDG]\0052\270\032\004\315fj\331d\320\314O"
+	.ascii	"\342\205\360\211\261\326\347^\222\235\377\307=\272\241\027#K"
+	.ascii	"\035\320`X\202\242mz\255KD\026\252*\r \024\201<T\245iK\030\215"
+	.ascii	"1\265\207\204\340\013=\302>BUvS\212\361\316\177Mk\340y\320a\b"
+	.ascii	"\006\206\f\312n\364\035Q5\313_\340qOW\327F\341\321\330\241\227"
+	.ascii	"L2\343\330V(9\250\343\300G\271\320\360&\205HT\032\347I^\225q"
+	.ascii	"\372\227\007\250\n\212\346S\351T\237W\245*N\221\273I\225P\362"
+	.ascii	"G\023\333\2223Ma\354\235c0\262H\031\377\227H\300\256]\306\330"
+	.ascii	"\335\310\024\024B\f}\373\347\330\223\315\221\275\037\233\207"
+	.ascii	"\200Fa\212\2021\340\026~\272\016p$,\354\277\275E\264\233c\312"
+	.ascii	"\316\356\222r\032@Mb\256\002"
+	.text
+	.section	.gnu.lto_.symtab.71931bc14f51ded3,"e",@progbits
+	.string	"fakeBaroSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\001"
+	.string	""
+	.string	"fakeBaroDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.71931bc14f51ded3,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
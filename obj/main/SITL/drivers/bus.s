@@ -0,0 +1,429 @@
+	.file	"bus.c"
+	.section	.gnu.lto_.profile.b30b3b35c2e5c3b0,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.b30b3b35c2e5c3b0,"e",@progbits
+	.string	"(\265/\375 J\r\002"
+	.string	"d\003>"
+	.string	"\007"
+	.string	"\203\320\263\357\004"
+	.string	"\001\254\363\336\346\001"
+	.string	"\002\230\233\305\245\003"
+	.string	"\003\271\357\205\253\003\002\002"
+	.string	"\002\001\004\312\220\226\274\006\005\307\375\356\355\013\006\240\342\234\212\n"
+	.string	"\003"
+	.string	"@\312]\356\333"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.ipa_sra.b30b3b35c2e5c3b0,"e",@progbits
+	.string	"(\265/\375`\007"
+	.string	"m\003"
+	.string	"\344\003\373"
+	.string	"\006"
+	.string	"\003"
+	.string	"\020"
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\001\003\003\001\200\004"
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.string	"\n\001\004\003\004\202\003"
+	.string	""
+	.string	"\n\002\002\003\002\n\003\003\001\002\002\002"
+	.string	""
+	.string	"\001\001\020\001\006\004\004\004\005\002"
+	.string	"\022"
+	.ascii	".\003,\306\201\"txCc\307\020@\037\027\210p\025A:\272\240\f@\t"
+	.ascii	"\245\261RT,\341\026\265q%\007AU\330\205\271\2016"
+	.text
+	.section	.gnu.lto_.inline.b30b3b35c2e5c3b0,"e",@progbits
+	.string	"(\265/\375`o\001\365\006"
+	.ascii	"\362I\037'\220'I\007\260\253\230\370pQ\313)\237(\360Re\223\367"
+	.ascii	"E\2745=ff\204\207\265li\326\340\026\031\244m\"w\n\257\273\004"
+	.ascii	"(B`\214\254K\013\246`\017\255\201\343[\247\334\220\241m2\225"
+	.ascii	"\t`\005G\322h\366PG\201\221- 5D\220C\343\304?\271\263\315Y\363"
+	.ascii	"\345\271\177\241\322A\333\304\366\362\244_\201\254\031\316\331"
+	.ascii	"\260m\325\017\264%\370d\177\242\221\233\303\247-\342\325d\002"
+	.ascii	") \260\002!\n\350\016 \001\004\350\203\216OA\254\300\004\240"
+	.ascii	"\333`5\310\031\330\bB\016H6\322y\207\220\241\013\214\020\301"
+	.ascii	"\t\024\233\330]\024\002\301\346:@\225+\226\333\377f\250!b\023"
+	.ascii	"\250\333\234=?\301\326\300\234*\270+$\344U\224\213\"q\235\332"
+	.ascii	"\214\306C\224\r^k\025f\305\033\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b30b3b35c2e5c3b0,"e",@progbits
+	.string	"(\265/\375`\r\001]\004"
+	.string	"r\007\023\031\300\025\322\001\273\313\377\340R\376\337]\376\177\345\370]\253\0014\267\311\3362\311[7\005\317\261v\344\tZ;\t\377\314\2077\314G\201'7K_\0300\354\340#\376\351]Lj\223\342+.\251l*\357\225j\330a\347\203\177V\343\001\027"
+	.ascii	"<\033b\2175r\327\220W6\264\262\271\031p\0017\340\246M\323\370"
+	.ascii	"\370\026\306\321\344k\324\310\245\"\\-0C\007\220&,\004\2011\021"
+	.ascii	"v\0220D'\177\230\031V\312\272\002\f\001"
+	.text
+	.section	.gnu.lto_.pureconst.b30b3b35c2e5c3b0,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\230\004\001\230\004\002\230\004\003\231\004\004\231\004\005"
+	.ascii	"\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.b30b3b35c2e5c3b0,"e",@progbits
+	.string	"(\265/\375 qU\001"
+	.string	"\220e"
+	.string	"\006"
+	.string	"\001"
+	.string	"\002"
+	.string	"\003\001\002\006\001\b\b\004\005"
+	.string	"\n"
+	.ascii	"@\021\235zk\006\242\004\003*\334J\020\200`@0(x\003X"
+	.text
+	.section	.gnu.lto_.lto.b30b3b35c2e5c3b0,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_busWriteRegister.4.b30b3b35c2e5c3b0,"e",@progbits
+	.string	"(\265/\375`\362\001\305\020"
+	.string	"\306\240nE\020\315&\035\037\033HI]\306\030#\366\013\342uq#\275|\006\f\001v}F\301\252o\376\253\326Vd\034oA\f\303\356\027\214\373\f"
+	.string	"\003V\004(Xw>\202\326\240^\266[TummK\006\331[\312\224\002\\"
+	.string	"T"
+	.string	"["
+	.string	"\231\366;\334C\312e(\007\260\0333\261\263\353\031p\201\355\321\336O\332\343\366\013\355\321\266\017$H1K"
+	.ascii	"\213\242\340\360\252I\261\353q\212\341\254G\250\311\362[\217"
+	.ascii	"\237=3\304f>8.\027\016O\327\025\227v\212\341\221\021"
+	.string	"\271\260hZ\240v\327\331\342b\341\326n\273\201m\005v2\b\032\036}\024\355\361*\003\003\222\251\344g{\255T\030\373\372}\037\2205f;]r\232t\357\027\235\346\017]\366oNk0\035a\032\302\264\302t\306\364M\013^6\027>\273\024>\025\333\023Il\260\235b\217l\232\223\233v\345\304\004\0040\357\235Xwa@\\\251\233\332\016D\362-%\375\354\250\b\332rHU-D\232\352|\005\251\344\347\2078F+W<\206'\246\204*\214/\302\037\221\262\231]\034?\307?\333n\353\260\237\200\366h\332\331\233\231}\331\214\337\330\376\371a\266\177\262e3F/\256\f\262\255\372\007\b\333\256k\303\257\031Ym\001\034$\034\037\020$\325\251I\352cU\322\241\331CcU\322\301\255\272\224IH\367\301\215\204p\210p\036\335\212\323\030`\325\203T\307\221\250T\0357\362\366p5\346\215\034\033\235\364Y\332g\017"
+	.ascii	"Ij-\251\246\022lk\232\272\342\333\334(\030\241F\020\222b\210"
+	.ascii	"4\352_!\205\032]: \376\n=p\224\252\001& \220\002\241)\344\001"
+	.ascii	"\326\206\306VB\201\234\244\340p\317\271\257\242\035\315\2530"
+	.ascii	"\b\263\224\251\307L\352\362\273\331\234\"I\303\203\020\364DK"
+	.ascii	"\016#+7\326RR\033\007\242M\t!\261\230\006\033\246dO\334\032\312"
+	.ascii	"\205}\230\037\355\350J\217(\340`\006.\267v\277\334&\356v\356"
+	.ascii	"{\002"
+	.text
+	.section	.gnu.lto_busReadRegisterBuffer.5.b30b3b35c2e5c3b0,"e",@progbits
+	.string	"(\265/\375`\037\002\245\021"
+	.string	"\266\"uE\360\356&\035\343\303\343d\270\244fy\227\210\034\021[\034)\245/S?\016|\316\341:\206\222\327=\356\321\232<\325\243\223\307\233\030\3478\252\343\2608\374{\246-\017\023*<\363\237\260\371ol\2334\262\267\224)\005a"
+	.string	"\\"
+	.string	"a"
+	.string	"0\326]\233%.\323\276\207\177h\335'\346\034\2738GE\273\236\001\027\330\036\355\275C{\334\036@{\264\355\003\tZvy\314\350\212!\331\214\305\256\307\351\205\273\036\241\246\313\177=~\366\304\220\001\226$TS\341\260\343\n\213i\035:F;\250\232\031M\323\310\356:ij(\334\332m3\260\275\300\316V~\214\366x\375\354\271\303\303\301G&?\333{\245\346\330\327\357\373ZXql\2475`:\303\351\324\177~\324\275\377t\240\177\273\317or:\3024\204i\205\351\324\322\347h \013\022\360\355N\370\\,R4\241\301v\313\306\260\201`\276\2610\025\035\024\304\037\027\217\215\215\201\260\200"
+	.string	"\346\275\031\212\322T\223\332)\017\3624\032#2}y\323\f5\2354\325)[\222\311\317\037\372\307+_\330\336\353\3271\3229\241\232\343\023\371E\211\242g\227\204_\302J\333\356\3536?\001\355q\243hS\364\354\315\202\\\310\266\322oc[)i\026\004\343&\226K\266U\036B\265\355\306D\374 \226\b\033\317c\016ZPV:\b\032I\013\311\tD\351V\372\322\235\260\\J4\233\204\260\\J8\326\252{IY\235p+)$*\234\311\212\305\205\f\260\212\245[q-*\325\212\303\360\366p\025\307\"GAD\351\273\264\317\016"
+	.ascii	"\246\324\252\241Q%\330\216\232\n\363E\334#0\252\242\024v)\375"
+	.ascii	"8)\324\3136U\2153I#\376\rH0\225\001( \260\002\231\261\343\001"
+	.ascii	"Z\206\306\227\204B!I\202\341NE3\206u\217\026t\020\2731S\217Y"
+	.ascii	"\376\354\224\254\347\354G^\372\313\344\263v\016\303W\366\304"
+	.ascii	"\322\224\035\207\321&\017!M\006|\231&\342\205Ba\207\025\304\256"
+	.ascii	"\260\017s\243\035\\\331\210\002\022\314\200\345\226\367Km\334"
+	.ascii	"\335\316\245O"
+	.text
+	.section	.gnu.lto_busReadRegister.6.b30b3b35c2e5c3b0,"e",@progbits
+	.string	"(\265/\375`\255\001M\017"
+	.string	"\246\235dD"
+	.string	"\257(\035\337\"\214kpE\022\255{\256h\276\233aR\233@\354\036v\256\203\001\260F\343\315\326Q\240W\277\031\033\214~)O\\\"^w\351\177*\315\225A\3546/c\203.\026\340%&\237\354-eJ\001T"
+	.string	"J"
+	.string	"R"
+	.ascii	"o\211\\\300\356*\346e\327S\340\004\332\243\275s\262G\355\004"
+	.ascii	"\262G"
+	.string	"/\030\231t/\305D#\305\251e\305\256\307\351\205\223\036\241&\311/=\336\365L\331\300\202\302%e\341\220s%1e\034\026\214\312\226*\321\324tv\327\211JU\270\263\333f`[\303N\003\001\030\036}\221\354\361\252\242!\326\032\311\317\366J\251(\366\365\373\276\230ue;\275\335\373\265\267~\215\323Q\323\020\246U\323\t\323\007 \341\364*pb\327\344\233Y\231X\"\203\355\221\275\261\255y\217d\335U\315p\231\3669\274\303(\240<J\365\256wJ\264dMS\235\247\026#\371\371.\277(%\213\263`X&TQ|\021\376\210T\261\262\013\302\017a\230\266[\272\352G\220=\006xY\330\312\236,\306?\330\206\375*\333\260D-\306\346\304\224-lC\270\207\220\266k\332\360Y@DZ\016<\235\206x<B\"\216\314\035\031!\021\007\027\352<!\237\316\203{\360i\360\301ut!.\343\200A \236\216\213"
+	.string	"\002u\334\306\333\303\325\2257b/\022\351\223\262\273>"
+	.ascii	"njU\215J\301V\022\277\345\356\300\b?\233^@\215\023\276\327\037"
+	.ascii	"#\003\267L\325\250\375\021# p\002\031Qv\003=\n\215P\2063K\340"
+	.ascii	"{b\354\2020\257f\335\345\200\360\373\310\236\023\352\275\222"
+	.ascii	"CK\362\365|\005\236h\3450\270r\216\245\027;\016\243M\206X;\346"
+	.ascii	"\227\302,\334\304`\343\034\337s\256\300Q\262\025\362\020\313"
+	.ascii	"\255\357\227\333\214\273\235\213\237"
+	.text
+	.section	.gnu.lto_busWriteRegister.part.0.13.b30b3b35c2e5c3b0,"e",@progbits
+	.string	"(\265/\375`\210\0015\016"
+	.string	"\226\033]A\020\217(\035\343\006\2500\325\t\204\006\273\210\372\257\207|\001\"\346\367\267H\230\376\303\237\350\365\312^\377\326)T\207\2436\024j\252\021 "
+	.string	"@\250h\202\005\323ePa.\274h\253Q\023B\344\2262\245J"
+	.string	"M"
+	.string	"E"
+	.string	"\330\325\333\tXW\354\003\254\253}\025wx|\034\372\2262\235l\273\303\003\344\320\006\205T\241BZ\261\330\335\262kzx\350\211/\344c\351D\364<wLqP\245p9\311p\324\370\273>v\327\230\206[o\233\201\355\0056f\004\3771(\002"
+	.ascii	"\312\256\251s\261\035\264\304\007\333\267\317}l\214\r\2621-\253"
+	.ascii	"\225\347\001v\204\342\202\002\305\253\316\342\371\266&\305\263"
+	.ascii	"x\234\273(-\262\304o\237\257\230ll\213\341\344D\373 \036\002"
+	.ascii	"\364\025\223\013\330E\231 \261\273%\270\372@\006*\244\310/5\317"
+	.ascii	"\035\243\273\307\312|i$m\030a\347'\246\216:\322\213\t\330\271"
+	.ascii	"\330\376\254\300R{\332]\004\327so\360rB\204/\230)\316\367\267"
+	.ascii	"\211\262\215\306\214\276\276\375\226\242\325B\277\253\376T4\276"
+	.ascii	"%\231\221\214\3469\330hY\262\321tH@,\207ptH@\262\216\266)\021"
+	.ascii	"\3214\031\004\221\314\203,D\353d\034\005\314\211\260\321\262"
+	.ascii	"\021\016G\3130\177\233(\237\273\006^\211\245\005\333Xb\216F`"
+	.ascii	"i\327\037\231)\2661\020S\323J\233#\001_\2722\" \240\002\231\263"
+	.ascii	"\252\003q\022\243\207\202\307!D\235\001H\362\003c\016f\036\241"
+	.ascii	"\322%\260Z\320\202\007\320w\231Dc\230M8$F\"XD\210\343b\247(\022"
+	.ascii	"uAn\004s7\270\346^t\263\202\344wvaP\250}IS\324\335\177\255\031"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_busReadRegisterBuffer.part.0.14.b30b3b35c2e5c3b0,"e",@progbits
+	.string	"(\265/\375`\310\001e\017"
+	.string	"f\335dD\020\217(\035\265\212\300\202%o@\355i[\201YFC\236\0215\262}\352\313\002\204S\177\3234\252\350\365o\235B\177\b\f\315\210B\013\215("
+	.string	"\200b$R\251\222\340\030\302\305\336Z\241\201\215\222O6\2212\245P"
+	.string	"V"
+	.string	"K"
+	.string	"\033.xt\202\355\321\341\013h\217\333\th\217\366A\270\303c\344\322CVJe\333\035\036$\227:*\372\242\004\350\212\261\033r\217\272\341\245kf%?Q+\246\353_O\026\207\223\213\021+\030\236\033\3174\037\273\353\215\345\216\267\355\300\366\003;!\004\017\220+\004\264\354\246b2VCD\321\301\366\355\277F6\307&\331\234\031\031\031\3215\366\324\342C\003-\037\343\3724\327\327\321\330\n\255\f\fb\276u\030\321\303M\305<\214\310\272\333\002\3434\037\216\376\202\322\t\367\202\312\232\366C\\\004\351/(\037\260\273Rab\003\212"
+	.string	"T\2233\215z\020\226\262?\240\251fz\220\345\2241_S\243J\n\020\226\2221\022\266G06\326\252vW\301\343_\217\340\201\205)g\244\272X\263g\253+\333\351\215\323\333c~\315\303_\213\351\250Igo\375\032\323\371\231?\022B\"%\335\004\315\023\362|2\221\316\323\223\356\363\231\200h\016\341\370L@\270\317\353NF\274\017W2\342!\341B\274\217\3430`\020\205\316\343B \220\307q\236\255\256\374\3277r\323\215Z\260\275\321\324\323\211D\355\372C\325\3056\200L\325hTMm\022P\036\265\005' \320\002\231#\326\001o\022\343\225\301\307\025\242\310"
+	.ascii	"$\351\rc\007\260\367T\f\007\341\253\232A\021\b\\\226h\017\363"
+	.ascii	"\n\327\260I\204X\304\270.&\305I\bDF\334lU\342\221\250\013r[0"
+	.ascii	"w\203k\357\205nN\220\374\316n\r\no_\312\024u\367_+\306"
+	.text
+	.section	.gnu.lto_busReadRegister.part.0.15.b30b3b35c2e5c3b0,"e",@progbits
+	.string	"(\265/\375`<\001\375\f"
+	.string	"&\031U?0o\223\016C\301\001\023\013\035J\260\263O\016\202A\210\230V\313\356\372\361\256x~\236>\242ohKP\216\030T\275\035;\352\362$\244\240\214)\313`\213-s\203j=\272\341\020D\366\2262\245B"
+	.string	"D"
+	.string	"B"
+	.ascii	"\177\216'0\375Q\0370\375\331\017a\313\005\023"
+	.string	"\371\322q\366H\nYZ|6\030\273\021\376\251\207g\327t\231\237 \020\317\365\333\223\004BcQ\002D\303\223r\247\201\331]S\033\356w\333\fl[\354k\001?\200\214\021 d7T*\331\016\017\305\007\333\267\277a\366\304\356\330\023\273\274v\222\354qC.O\222YwCJ\240\346#\366\021\217\002q3\210\254i_\304Gt>\342q\001\273#\025'v\343\202?'\240\002W\036\364\364\200\005\3658U\365\333\021\\x\361\231Q\241\364l\272\246:?\034>\262D\3026\346\202\"\255hw\025\374}{\203\024+<)#U\304\352\356VG\366KO/\375\036\177\347\322\372\322y\355\001\017*K;\252\315\305\221\231\254\251\\\034\031xYU\307\206\265\201\0216\034@\200\032\353\202\025\003\346H\250,H\201\303\261\340\304v\336\255\216\374\355\224|:)\006\333\223\246~\230H\320\2561\252\"\266\251TujO\b\036"
+	.string	"\257W0\210\003!jf"
+	.ascii	"$\221\003\343\333\301\036\232\250\200\027\276\246\031\036\001"
+	.ascii	"\035.\003D\3010W\270\277[l=\342\335!\354\253\203\353p\017\320"
+	.ascii	"\315*H\316;\264\323B\315a9!\334ppIMQ\363\376k\313\030"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b30b3b35c2e5c3b0,"e",@progbits
+	.string	"(\265/\375`\252"
+	.string	"u\005"
+	.string	"\302H\036%\240\245\351\350\252P\334\313\021\312\031\316\261\226Z\264\3267\313\377\377\377\217\002\257k\255Y7\021\021\021\262\367\226;\245m\216a\350\205b\330\246e\241%/l\223\202h\311\216\006\"\202\"\332%\n1\232Q4\234)\\!\034\031|y\23683\333\303s~\270\255]\242)c\336\2263\005e"
+	.string	"\276\367\n\224\257\344\017rG\265E$\0049\200\366\255\200\302+3\363x\243\332\272\021\026"
+	.string	"`h04\030\032\f\r\214\005\006v\025=\2642\f\352\001\300\001\300\001\300\341\003\344\302\245\246'X\\\246"
+	.ascii	"=v~<\330\022@pP\217u=\237"
+	.text
+	.section	.gnu.lto_.refs.b30b3b35c2e5c3b0,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.b30b3b35c2e5c3b0,"e",@progbits
+	.string	"(\265/\375`2\f\245>"
+	.string	"\352nP\030AP\250Q\007\355\347,\321?\217\240G\252>\032+\034\353\344&\264\301/\017\206\026k\f\333\034\267\350'\250\234\3606\003{\020\305}\205\245I\261\325P\311\342g=0\244c\250\030\270BH\366K\"S\nP\001o\001n\001\330\371"
+	.string	"\020\342\204\252a\311\255\357\351f\377}\356\003K\216<Or{\333p\236'\016Ka\033rvq\373Xn\027\313\355\316\334\026|\315\337\270\232C\323B\260\261\221\373\377:n\307[_s:\215\331\377v6\335V\335W\030|\315\3338Z\024\362?\311\024\001K\242`t\346\376\331)\337\224\223\225,a\316R\334/2\356\222D\243\347b\207\343q\274\3659.\247\335\215\263i\\f\375\366\377\233\232\342\220\320\321rq\273\3107\274\351\244\315\"\343\022\231\201\023H\033+\267\207\354\276\013\331\311x\031o\023\370\231\276\302\320;c\2317\373g\237\232\352\276\324=\272\270'\230\351"
+	.string	"~\036C\003\310\355\tR\217z\202\264o\366w\002i\357\254\333\303\270Y\202\235\032\266~\332?\013\365\304\016Q\222]\334\254\023H\263\013H\243zJ\335\267\001\002\245\245\356+\300\327"
+	.ascii	"\272\257;E\200c\352\276\013x\020\f9u_\250\256\363\007\335\375"
+	.ascii	"\266\242!uwS\267;\350v\006\335\256\240\333\243\272\035A\267\373"
+	.ascii	"\272\275@\267?u{\356\356^\267+u{ww\241\3566\324\335Q\335}\246"
+	.ascii	"\273\343\272\033\256\273\315\272{@w\347\351n^4\032\215v\373\332"
+	.ascii	"}\213t\347A\001\177\237}\377\344\263YCeW\246\312\256\306\336"
+	.ascii	"'W\343?\333\354\251iG\243\253\355\263\251\266k\023\352\223o\374"
+	.ascii	"\366\270$'\327\246\312\2666{j{l\252\311g\023\n\t 'jv\304=\301"
+	.ascii	"x\0345\371>\224bGf\017\252\262\353\013\372\3674\035\317t\360"
+	.ascii	"/\2662\005\035\2118\034$\324\007\222\315q=\240D\216\255\237\204"
+	.ascii	"\252Z\326\177-\310\030\257\274`d\241\017\305\241F2\261\017\323"
+	.ascii	"\361\217\340\331\177\345\277\321\037\372\377\306\377\3471\305"
+	.ascii	"\330\177#=\365\212R\371\357\364)_\314\030G\307\377M{\203\323"
+	.ascii	"T\333\261\325*\016Z{\345\301X\243_yAOfn\215d>,Q\276\322\004\202"
+	.ascii	"H\016\355\376\321\023\206\274\230eZ.\245\254\027w{\034\034OK"
+	.ascii	"\24195\027\027b\223"
+	.string	"\330\013\234\221L\232\334\026\336\234u4\207:;\200\0013\310\ty\353o\216\246=\315\323$\315\336\\\215\2739\324\331\373d\334\033\337\324\322\235\034r\314R\334\026\334\315\357x '#\324\177\0235W\376\277\315\005y\353n\355\346k|\315\241i#\270\270\231:0\205\177h\031\013\224\342?\016\310[\017\344~\332\305\370\230\366\261\377l,\350\361>\212\316\332\315\272\255\0029\036g\213B\252#\324\322\310\375\263\276\251\251<'\212\032\224\024\267\237\345n\357\323\016m\332\361&\213\333\r8\311~3=\023\345\b\333\3343\355H\200\242\002\355r\361\005r\203x+u\205(%\331o\225\332\022!I\243\222\333\245\322'\251\264wHz\\f\217\273\f\013\273\313_^\r\002R6\207\005\035\347\f\362\321w\211\306c\347\334\332.\276J\247S\372\243B\343\354\224\271/\243{\274;\356\361\252\027\331\027y\325l\3747\262\n\334"
+	.ascii	")\363\342\324H\307\034)\027\254\257\n\300J\335Y\332\305W\207"
+	.ascii	"\323){\264\221\271\370\346p4'@M$\216.\276I\227K\022\242\006F"
+	.ascii	"\b\232\373"
+	.string	"\232\311\211\356'\362h\372\357\354\272d\276\223)\325~\310\021\265+jE\036\365g\376;\177\367\026\006H\331\334;\235RK*\224\265\247\243\366h$\246\177\263\377\217bj\243\306\366\274\330#]\207\344u\355\221\374\021S\322#\341\377\243{\003'\367\006It\250\034\315\244\270\357XvFN\227\233\3174K\2729&?p|\324\024b\223\262 \357\2205r4Ko<>\356b\007@\310P\0369\027\367\"G\353n\245\2441F\205\336\\\334\367Gnw\224\373v\247\177d\376\377\217$\366\231H\246\324\223\334\245\272\233|\347\016\272\033\377\256\027\220\375'\001\244(gys<rqw3\370\366\362o\204z\366\231j\3734\252g\3744\241\330_b\340[\262W\331g\023\257\001?\340\225\020\002\360J( \200\257cP\t\275\210\277\004\037\204^D\001\035\203\212\304\n,\025U\305 \214aV\221A\361we!\313"
+	.string	"v\315"
+	.ascii	"\021\034v\201\240\021,\022q\250xz*@\340\305\213\257\017[Y\301"
+	.ascii	"\024\304/\255\250\006\316\350\352\372\360K\352U\240*\016\263"
+	.ascii	"\274\250\206\301\"Q\b#\230\"X\024\016[\020\277\264\f4P8\fr\005"
+	.ascii	"a\344\276\220\201B\006\r7x\255\201C\005\016\025\322\326\300\301"
+	.ascii	"\312\212C\006\253\334\031\254vE\342O\350\245\342E0D\320\013\307"
+	.ascii	"\212\037\026\n\025KA WV\221\310%\314\305\337\t,\314%D\301E\004"
+	.ascii	"\246B/\342\256c\034\350.\257\340\260\252\330\3255\254Z\"\376"
+	.ascii	"@\\a-\201\270\302R\332J\211\304\340pk+\213\007\274\022\356\276"
+	.ascii	"~6\202[\304/\255L\374\005\201B\033\301\020\304/\255\245\342O"
+	.ascii	"C\221K\370\305\353\r\033@0`aBD\006R\021\277\264\252\210\303\240"
+	.ascii	"\r\341p\253\212K\230E\243\n8$VQ\371\202^8\212\304/-^\223\345"
+	.ascii	"\240,\210\230\\\225\307\221\013\230K\026M\261D\251\342\343\342"
+	.ascii	"\347\363.}\371\315\312\252\310\215\220#Rwq'\201\255k 8me\330"
+	.ascii	"l.\322\032\227$\t\023\266\255l\216\007\345\215\360\331\"&v\227"
+	.ascii	"\025\374\301\320\306\360\310]@;X'O#F\256\352[w\177\356(\341\342"
+	.ascii	"\245\211nQ\224\307\305\215w\344"
+	.string	"\353l\247G\275\314/}\314\216\022.s\377N)\2455u\350\242k\271\373\376h\357\217;$\200\331\250\2010\204\024DfdJDD\222\244\351\220\002\221)3n\021P\251\243FhD\232\202\024\n\035\254\217d\270\202\326\307\211\025\376w\310\223Y\177\314{\250\271F\3168l,K\215\371E!\263NX\271@\270\242t/ 5Q5ZH\022\327\250\314\257S\230\307^C\223\272\371%\357\227\340UA\364\321\020\307\250\004\261\002\330\004\001\357\234\"\303}\226\203\004\237g9\344\341,6\275\266\313+\r\002\034t\225\006&`S\226I\030Z\330\331\310L\302`\023\354\220\253fX\305\206j\277\300\222A\272C\375\177sj\306K\\1s\304C\225v\307Nr\253\340Y*(E\314\254\255:\342\260\240t\004j\n\207\030V\302\004w\273G*\331 \251\344\351\333\n\243\030\204]\365\202\365\013Y\236\016{?.\215_"
+	.string	" {\351W\371fI\300\232%*\332!\335\374\230d9\371G\201\225\321G\t|E\272I5:\032\231;3\326J\273\201\332\373\301xt\312f\276m\364\230xQ\026\357\206\364\264X\024\250\335\277\236\300\013)^\312+\2245\257\264\202\327\345\037\301\027\016\030\370\370\213p\244\020\224\375\232 A{\033\264DB\232\261hB\303M\007m\236\005\267\311\177\233\314\007\254\233\211\264\026@B\237\342\270\007\020R\201\272\377\306z\360\004\177A\207\034\263\272\206$\020S\32761b\022\f\022j\271^"
+	.ascii	"\033\335\365\321|\030\201\374\265\347\024\301J\373\372\002^\230"
+	.ascii	"\361\247W\376vzU\330\216\267\202\276\334\030\210\214\302l \235"
+	.ascii	"\310{\345\353=\n|\322\275\217\334"
+	.ascii	"\327\332\310\277\337\272\312q\t*\330\202\250\002"
+	.text
+	.section	.gnu.lto_.symtab.b30b3b35c2e5c3b0,"e",@progbits
+	.string	"busWriteRegister"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377"
+	.string	""
+	.string	""
+	.string	"busReadRegisterBuffer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\001"
+	.string	""
+	.string	"busReadRegister"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.string	"spiBusWriteRegister"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"spiBusReadRegisterBuffer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.string	"spiBusReadRegister"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.string	"i2cBusWriteRegister"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\001"
+	.string	""
+	.string	"i2cBusReadRegisterBuffer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"i2cBusReadRegister"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b30b3b35c2e5c3b0,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,118 @@
+	.file	"camera_control.c"
+	.section	.gnu.lto_.profile.ebdffe67e3224d32,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.ebdffe67e3224d32,"e",@progbits
+	.string	"(\265/\375 \024\205"
+	.string	""
+	.string	"P\b"
+	.string	"\001"
+	.string	"\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.ebdffe67e3224d32,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.ebdffe67e3224d32,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ebdffe67e3224d32,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.ebdffe67e3224d32,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.ebdffe67e3224d32,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.ebdffe67e3224d32,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ebdffe67e3224d32,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	"\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.ebdffe67e3224d32,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.ebdffe67e3224d32,"e",@progbits
+	.string	"(\265/\375`\t"
+	.string	"\205\007"
+	.string	"\322\21558@o\323\001\013\024~\226\251\215\007`\314\276\013\221\374:\325O\271\360\203\356\376<~W\231\245\250\321\330\253\303w\n\270\253J\024\277\302\243\260\322A\2202\367\347\333\210\022\231\002\257\310\036\"\0342\322R\212\336\354\365zA[\332Z[^\254&A\301z\034'\036\203\321.\t\210\2068\263Mm\353\325\251\331\232v\333\224_S\f\256'\244\307m\235\234\375\311\314\300b\326\215F\273j\035\265_F\306\372\234A\374\341\021kxn\307\243\343 t\262\001\322r=(\b\001\037*!\322\304 \207\030\204\261\350,\302#\257:\340-\271\027\264\252\025\026\016\023i:C<c\224\305\030\365\237\344\005\242\273p\201x1\0015\361"
+	.string	"u)\376\037\375O\371\317a\030\206\377\001\376\333\377\234\b"
+	.ascii	"\257\354S\021v\270\020\215p\352\242VV\2102\002\327\214\255e\f"
+	.text
+	.section	.gnu.lto_.symtab.ebdffe67e3224d32,"e",@progbits
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ebdffe67e3224d32,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,321 @@
+	.file	"compass_fake.c"
+	.section	.gnu.lto_.profile.12bc98a579934744,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.12bc98a579934744,"e",@progbits
+	.string	"(\265/\375 nM\002"
+	.string	"t\003b"
+	.string	"\006"
+	.string	"\302\316\332\366\007\006\002"
+	.string	"\002\001\001\240\342\234\212\n\002\355\305\323\306\t\f\003\265\200\315\263\f\004\205\250\203\370\013\004\002\003\002\004\002\005\002\004\005\240\342\234\212\n"
+	.string	"\006"
+	.string	"[\035\265\322\2003"
+	.ascii	"g\373\273\227`\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.12bc98a579934744,"e",@progbits
+	.string	"(\265/\375 .\r\001"
+	.string	"\270\""
+	.string	"\004"
+	.string	""
+	.string	"\003\002\001\003\003\003"
+	.string	""
+	.string	""
+	.string	"\001\004\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\003"
+	.ascii	"9k\310\fe\003X"
+	.text
+	.section	.gnu.lto_.inline.12bc98a579934744,"e",@progbits
+	.string	"(\265/\375 \236\315\002"
+	.string	"\264\003\222"
+	.string	"\004"
+	.string	""
+	.string	"\006\200\200\200\300\002e\001"
+	.string	""
+	.string	"\002\200\003d\200\002d\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\t\200\200\200\200\002f\001"
+	.string	""
+	.string	"\002\240\002e"
+	.string	"\300\003\003\004"
+	.string	"\005\002\002c"
+	.string	""
+	.string	"\b"
+	.string	"\f"
+	.string	"\240"
+	.ascii	"\b\005\301\340,\264c\t\344\036\365\360M!]B\2739\203KP\033\300"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.12bc98a579934744,"e",@progbits
+	.string	"(\265/\375 .5\001"
+	.string	"\360\""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\002\001\001\003\177\002\002\003\003\001\001\001?\177\002\006\004\001\001\003\177\002\004"
+	.string	"\002"
+	.string	"t\203m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.12bc98a579934744,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\230\004\002\232\004\003\230\004\004\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.12bc98a579934744,"e",@progbits
+	.string	"(\265/\375 \213\235\002"
+	.string	"D\003\177"
+	.string	"\004"
+	.string	"\001\002\007"
+	.string	"\001\002\006\001"
+	.string	""
+	.string	""
+	.string	"\002\001\370\007\001\002\006"
+	.string	"\001"
+	.string	""
+	.string	"\020000"
+	.string	"\003\004\b"
+	.string	"\002\002\t\300"
+	.string	"\300"
+	.string	"\002\n\300"
+	.string	"\200\001\200\001"
+	.string	""
+	.string	"\f"
+	.ascii	"-\".\001^n\251j\364\253\020`\270]M\242\"\312n\030j\236\nF\333"
+	.ascii	"@\033"
+	.text
+	.section	.gnu.lto_.lto.12bc98a579934744,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_fakeMagInit.5.12bc98a579934744,"e",@progbits
+	.string	"(\265/\375`l"
+	.string	"\255\b"
+	.string	"r\217990\217\323\001\204\364\205\266^K#\210\320\006\031K\373&\340\002\373\365\360\364Y\017\325\204El\021\310\373\332\311&\017\241\\\033\021\221\034"
+	.string	"Q\317DwQ"
+	.string	"\302\212\317m\367N)\3466\035\303\266\220"
+	.string	"n\236\216\307U\360\353\0368\237Bm\340l\235\312}`\335\f\330\363t_u\360\274\257\216{\314N\224\037b\330\n\205\013\313hJ\370 \027\371\bK\336'\330i&\256\b\376\341\221\245\\\001\373\017f;{\307G\243\332]\315\3378\007\204/\236:\002$_:\365A\330\251LYYh\264\214\344\313\036Er^\330\307\354D\331\024\201\304\322\264vM\257\227E\241&\030\266C6\200\013\fB\016?\252LZ\t)\304\265;\326\231zx\031\372\317\270\254\020UZ$'\321e\346`w-K\247\211{\336\266\200m\315\376\003\021"
+	.string	"]\325[\333\351\202e\203\215\325\336\263\016\030\302\252D2`"
+	.string	"\306"
+	.ascii	"\343B%\007b%\240k\370-\242-!\b\270s\257v>\001"
+	.text
+	.section	.gnu.lto_fakeMagSet.6.12bc98a579934744,"e",@progbits
+	.string	"(\265/\375`\321"
+	.string	"u\n"
+	.string	"\226RD= \005)\035 7\005\006\340\217\021\264\307;\\mQ\203\001\321g\235\275\303@\335}\004k\026{J\355(\225d\027\351o"
+	.string	""
+	.string	"B"
+	.string	"\242\247\205i\373\002d\002\266J\351F<\331d\357\224\0021"
+	.string	"2"
+	.string	"3"
+	.string	"\336i\301=\335\251\274Awj\321\276A\340\030\250\351\240\345\354n\235$\027/E\377*\027h\271V\227\001\020\273k\331r}\334\363\266\023l?\330\037\005/\373\263\277\373\370s\227\375\322#"
+	.string	"\361\340\354z\334\002\254\215\312\300l\277c\317l\034\306Z\203wj)\355\243<E\274Le\272+\022\213\331]\220\031\002/\2469\211q\240\273\264"
+	.string	"\220\323\366\347,\252\203\222\335]\360i_\261\360MN\215\221\222o\235\372\251\356\364\003\213\205\260\344\315\036Wr\216\330\347vw=\003\032O=\343\026\205H\023\237D\004\352;\231@QE\205\244\213R8\252\024\245\317TE!\252\206\024\f\236Ha\255"
+	.string	"\301\260v\306=\267\363e:cc\315\rw\263v\230\031"
+	.ascii	"^\251'\023\032\215\006\306\003\021M\030`\034U\016\rk\270\013"
+	.ascii	"\206\240\031X\016\304\322\024\003\260;S5(.\f\3450\006\230\003"
+	.ascii	"\203\201A\200<\200Y\201\032\035\356\360\242\235d"
+	.text
+	.section	.gnu.lto_fakeMagRead.7.12bc98a579934744,"e",@progbits
+	.string	"(\265/\375`\372"
+	.string	"U\013"
+	.string	"6\226N>\020O&\035"
+	.string	"64\\\020E\001\204\013\366\031\033\312\206\327\320T\352\2644\345&\360\n\212Dk\370\371\374\260\360\317\337\233\213A"
+	.string	""
+	.string	"\200JGz\306K\036\027\001$,\267E6\262\277\224)\005;"
+	.string	"6"
+	.string	"="
+	.string	"\022+\200<:\374"
+	.string	"\355\021r\001\332\243m#H"
+	.string	"2\370\020U\242d\214\\.v\303M9\034|\202\376A<1\2544\314`\246\320\363a\331]'\311t\341\326\333.`\333b\177\024v\030J\335`\337\261\273k=\331o\375Q\323\252\351\324\3641(\214^\004f\273\245\215\027\253\"\312:\330\276m\220\035\261\235i\177u\026\350\255\317\003\354\236J\304v\303\217\252\025\225F\252\017K\311I\274R+\252\017W\337\325\341"
+	.string	"@\245\374\217\366\230.R\013\373\300Gp \273K\361C\\\304\347\247\036-\301\223'=\372\036\355\361\252\031\0362\260d\242\334\b\\\207[\360\200\323<|\231` p\016\030|\334F\323]\266\317\303L\310x\r\266\b\031N\263]\274o\233\030p\267\301x[\247\353\274-\022\356\035\253\247\203\232\266\302\202\006\013\221V\260\252\037s\334\304Q\234\270Sh\001\022"
+	.ascii	"^\251\347U\350\241\002\177\352.\024\267b\020\301v\237\320\036"
+	.ascii	"4\005\032\003\310\301&\220\220\032\n9Y\023~\250\272\360\3402"
+	.ascii	"\362u\315'"
+	.text
+	.section	.gnu.lto_fakeMagDetect.8.12bc98a579934744,"e",@progbits
+	.string	"(\265/\375`j"
+	.string	"]\t"
+	.string	"F\022C:0\221\322\001\200r[\244\355\320/Jd\370<\3007\317PsY\035\235\2726\354\357[l%\315\250\220I\260\355\242?R\n\n\242\2402\252y\370!\261\210\354\225Dn\273wJ\0010"
+	.string	"0"
+	.string	"3"
+	.string	"\004\333\251m78\224,\"\200\314\032\032\3525\333\035\353<\271x)\372w]\226\270fb0\225\351\022@bw-S\252\221{\336\266\202\355\b\333\264o\375\222\316\020\324\313AlW\244\226\26324F\305\366m\227\354"
+	.string	"\333R\332_9\253\364\026\351\003\273+\026\314\356\310`\b\356\324\343\r\266S\356\001\336_\337\224\311R\030a\001\315\356\351)[\343-\034\334\356>\370,\036\035\002()\247>i;Mh\271\304`$'Y\263G\223\234&\366;\273\273\236+;\026\2357\375\361\200D]\305D\330\215\274\357SC\020\264\021\002)\352E\250\363\352\007\f\253g\301\337\b\004\326\214\357\003\253\307}g\347\312\027\267\315f\206ss\232\037vH\024\n"
+	.ascii	"]\325\343Y\0241b\b\231PA\221\237Jd\2533\200L\020\273\313\304"
+	.ascii	"\3275\237"
+	.text
+	.section	.gnu.lto_.symbol_nodes.12bc98a579934744,"e",@progbits
+	.string	"(\265/\375 |U\002"
+	.string	"R\004\017\031\260'\035x\242\221\244"
+	.string	"\022!\255\217$I\222\344Y[\013l\226,\261{\247\377\266\024d<R\270\377T\033#\323\025\031\034\360\266J \374S\225r\230\317\177\026Cm;$\336\177\022\003"
+	.ascii	";i\337\363 4\212*\003"
+	.text
+	.section	.gnu.lto_.refs.12bc98a579934744,"e",@progbits
+	.string	"(\265/\375 9\225\001"
+	.string	"\224\0025"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\001\001\001"
+	.string	"\001\001\002"
+	.string	"\001\001\003"
+	.string	"\003"
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"\001\005"
+	.string	"\003\003\002\004\002"
+	.string	"\001"
+	.string	"\002\002\002"
+	.string	""
+	.string	"\002"
+	.ascii	"?\331\227U\302"
+	.text
+	.section	.gnu.lto_.decls.12bc98a579934744,"e",@progbits
+	.string	"(\265/\375`\374\013UB"
+	.string	"Zt\230\031BP\344Q:\243<3\220\336\025\230\262>\311\313\342\230Sg/YX\022\353\305\030\230\371fk\320\3530j\203\016\362\300t\277/"
+	.string	""
+	.ascii	"i-\223iE\321?\nm6\206\311\241\366$*'\213@\212\264-SZ\001\211"
+	.ascii	"\001\205\001M\200\216\340\271]\3658X\032I|\274\3654\330"
+	.string	"\203\261\207\301^\310>\005\313y,\207\243\007x\316/)\346\251\351Q\227G\214\256\372\021\354\371\300\312}|`\275\007\226\233\213\345)\226Z\241\004\254*K\255\b\324\3309\031\212c\243\343\252\347(\333\325m D\326\344\207\316u\177\326\026\3231u\033P\272\322\266\204\354\252Lw\031\r\2479\323\361\231gm\235i\331p\335-\323\251\335J\346\004N\314\t\220\360\250(\307\254\3521\260?\317I\325&W\350\336\314\260\234\361\210\033\276\253\236\345~n9\216\245\374\354^v\367\200$\263\27385We1<\206\243TL\346\f\206\313\034I\331v\313\204\236\2109\257\n\305\002\326o\261g\350\007({\353\227\275\321\315T+\367\3651\325\032\201\005\254+K\255\f\006\353\034Fjm\242\265\375\364\253c3\326\350\252\367\313\317o\fG\365c\222=[\332\335F%m\261K\262v\325\267,`eYjE\372y\252\356\347"
+	.ascii	"L\377\025N\261\377\355\372\t\024G\363\177\375\257\206\237\267"
+	.ascii	"~\306\372\331\352\347\005?+\370\031\301\317I?\003\370\231\300"
+	.ascii	"\177\351\3772?\033\370\271\300\177\273\377f\376\313\375\207\373"
+	.ascii	"\037\365?\316\177\244\276\276\276\276\377\202\376{\341Wj\003"
+	.ascii	"\034\275g\227\354\267\354\372X\336\263\273\343\366\340)Z\333"
+	.ascii	"f*\270\234!\261\262\232\262bR\224'\212\006\200z\201\360\035D"
+	.ascii	"\213vpao\363:9z\315\3366\375\224gr\322T\255OU\353\257\025\366"
+	.ascii	"\327,`\215p\327X\273\313\203\310Z\236\242\253\376\006a\177\177"
+	.ascii	"\\\0356v\354=rt\307n\216U\220\231\224\307]\376\346x\002\324F"
+	.ascii	"\031\350\252?\304s\377\225\224\006\345\241\363\204\217\275\311"
+	.ascii	"\2475\311.D\366\330k\365q\034\246\303S\264\013^\274<\272\315"
+	.ascii	"Q\356\343\351\271\r\273Y\302\365q\035n\304S4\250^\002J3e\265"
+	.ascii	"\364&\207\032\270U\275\0267b@\274\310)\031\325\275f\206\255\273"
+	.ascii	"\031\261#\216r\2437b;\274\307S\351\007-tVTV\252\231\333\222<"
+	.ascii	"\253\312\307\2128\312\2138\321\231\r\303\371T\333}F\213\020#"
+	.ascii	"2\364\345\f\367c-\342@<\310\200\030\363\303\235\234\240\356v"
+	.ascii	"\312\312\212]\023\345\016\312\024\321\241\246\035i\332\366\\"
+	.ascii	"\225\r\001\020\2026\275\273c\243\\\350o\273\247\330\307\225\034"
+	.ascii	"q\346\330s\364\177X\320\001\251R\362\316\276\220a\317a\330\363"
+	.ascii	"\033{-\336c<\314\207\247R\016yg\004u\267\037\376\303Q\336\343"
+	.ascii	">W\333>\343\375X{|\207\351\030\020\353F2EJ\r\217\2318|\335\255"
+	.ascii	"\325\224\225\223\225\266\267/\253z\336\301\252[\226e\344\\\225"
+	.ascii	"\363\260\036\216\262\036\3579\3371\336U1\317\206vwS?\250\020"
+	.ascii	"9G\256z\235\2604\216\016\2217\251\023\233\241)\311\253\376\327"
+	.ascii	"\207\t\223\233\303\317\034\265\350Uc\271\333v\222\204\\\263\035"
+	.ascii	"\374\247\206\375Er\223\374>\377?\271\216\355\356d\333?(\314\031"
+	.ascii	"A\302\327h\315\252\377\214\260\277\377\332\312fw\233!\265\335"
+	.ascii	"\024c:#1W\375M\374c\005\377\325\376}\353I\267\233\236!\266-\215"
+	.ascii	"\322\b\202>\227\356dT\267\335dB\325\222\314\250\035gT\333J\006"
+	.ascii	"4\224I3[5\247\372\354\333ms/\325\2342\230\355\263"
+	.string	"\311l\237I\250^>\223\335\255\023\212)U&\231\tUs2\241OgT/;\331P\245\022v\371t2\363\236N(&T\351d.\325\234QV\364\250\364\340\361H\314\034\256\303\\\266\217\2624e\023j\312l\237\255\327\315\322\261n*\350N{6\365\224C\270Nl\352C\354\214\362IU&\266\344\331\313)\323\355\331\355&\346\242[B\262\2356\024\236&\231\2445\331X7\201\262\356$\367\264\273\223\335\235\324Lk\273\213@1\331\312\312\272\321\246\312:-i7\326}\245}\352\234L\350\222'\226\035\031([\353h\223\314\326zjM\026\232\214k\262B,\233\023\b\241#cL\210\266\334\231K\3735\302\226\231\246\365\270j\021%14w\362\376\260g8\261\313\234\323\205\327\334\263\373\343\006q\363\246\365{\306o\256\322\200\030SU\343E\320E\273C.\221+$w\001\001\304\211.\023W\310a\013c\020\211"
+	.string	"\t\314\322b_\b\277`p\r\215_\\1\206\310c\r\023OH\341\0209lB\016M"
+	.ascii	"\b\"\203\034\254Z\004C,]H4\016\213\303\026\354%Lx0\201\002\215"
+	.ascii	"\244S\260\020\301B\204\365\024,`aY\230\200\305~\002\326\017y"
+	.ascii	"\027\020\030\f\201A\240S\261\005\021\206\206#p\306\220C\213`"
+	.ascii	"\f\026I,v!\211E\242jD\222\020"
+	.string	"\026\303:x\005\207%\214_\307\342\360\030\345\025\034\032U\344\021H\0043\301b\310a\bV\343\004\260\213\204\211\245\241\260\030D\036\213D\026\t\034\321\245\026\211$\212G\341J\004;\376\356\002\3021l\005\325\277\300\206\306+\344\327\227\361j\351\b\344\312\352Z\342\312\352R\362Z\217\307\241\321\313+\230$\314\"\376\302\2003\206^\307\260\025\354\0218\024\022g\f9\034\303V,!\201\024\220EbX\322\020\254\006\362\030\266\"\351\030\266\342\007\343\353k\003\020\t\t\234\200\205,\022\223^\241\002\027\002\024\"<\260B\b\303\027A\026\300c\020,\306\227\360\352h\034\316 \032\275\256\212\304`\214+\241\361x\005\241A[\364\266\335,\031\244\255tV\341=\355\360\361u\323\215\203(*\323-\267\352\272)-\333\206*\351)tDz\325\253@\330\253bS\246\334+}\030-r\306a\271l\277W\230\370t\3713\350Z\031"
+	.ascii	"7(\214\225\337*a\336h\201SDI\207\023\265 W\245r\311\232\346\344"
+	.ascii	"\360%:\264\266v\2430Z\377\366\362\320\320\252\236\244\177~\350"
+	.ascii	"\200\362\033\345\200\356\035\"x\313\253\336'\001\200\336\250"
+	.ascii	"\221(\307\024D#\"#\"\242I\222t`\002\0211e\305\r\021p-\203Jj$"
+	.ascii	"I\n;\373\006W\003>\241\343\374\230\327o\264\\\r.R\332\b*F\306"
+	.ascii	"\375\305H\236\007#e\017\220\342'u6t\322\343\r\265\007\251\244"
+	.ascii	"\265`\252{\032\306Ot\276\024\370\002t\025h]9\345\033\304n>o\372"
+	.ascii	"\026\333r\276\212\335\357\342\023\361KdW|\253@\"\262#\264Y\366"
+	.ascii	"\234[\023\240'\204N\355\003\024\335\210\231\013\307\364\320\376"
+	.ascii	"\013'\005\250es\350\251\370\020A\364\302\003\023\250/\013\002"
+	.ascii	"\024\352N1\206^\226\033\"\235\361V\220:)\262\216/h;\343A\245"
+	.ascii	"\250ypL^\322V\313m\366N\332\224\232drr\225\"\\F0\021\320\225"
+	.ascii	"\264H\rH\262=d\307}z(\024\223K\301c\024P\256\317\\\354\271i3"
+	.ascii	"\205w\331\300\215\337K#\007\260Wp\021RAb\203v\374L\225+\270\364"
+	.ascii	"b\212\037\265\342\352\216\235\220`\235>6\224\211pA\200`\2313"
+	.ascii	"\243\344\213\267\372\202\r\220y\203\305\263\002\306\b\251\214"
+	.ascii	"\035\036B\032\361`\201\2166*\237y6d{`%\251\266\350\225/\222P"
+	.ascii	"\243T\004+\322x\270\225w-\345)\310\340\240\274\237\206\"@\027"
+	.ascii	":\260kd\201\347O\340\323\364"
+	.string	"\336\003\022-\340\032\0241q$\221A\231\222\340\314\3624\006\334B \002\341\264i)\3343"
+	.ascii	"=\335\245\"\350Q\034H\250\r{?\244\224\031\311,S#\t\345\356qZ"
+	.ascii	"\370\023\223\004*p\230\035\314s;iC5W\274\302\003p\364\001\257"
+	.ascii	"\232t\235\334\263\376\221\211k|\226\344=z]\210a\344e\177\300"
+	.ascii	"\311\350\376j\375\b\326\347\366\350\324?x\337b\303\232;\346\247"
+	.ascii	"qQ\006}A\033p\353n\032V\365\204\246\n"
+	.text
+	.section	.gnu.lto_.symtab.12bc98a579934744,"e",@progbits
+	.string	"fakeMagSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\001"
+	.string	""
+	.string	"fakeMagDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.12bc98a579934744,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
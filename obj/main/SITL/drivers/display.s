@@ -0,0 +1,620 @@
+	.file	"display.c"
+	.section	.gnu.lto_.profile.2d0455e32856f543,"e",@progbits
+	.string	"(\265/\375 !\t\001"
+	.string	"\035"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	"\001"
+	.string	"\002"
+	.string	"\003"
+	.string	""
+	.string	"\004"
+	.string	"\005"
+	.string	"\b"
+	.string	"\t"
+	.string	"\n"
+	.string	"\013"
+	.string	"\f"
+	.string	"\r"
+	.string	"\016"
+	.text
+	.section	.gnu.lto_.icf.2d0455e32856f543,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"\245\006"
+	.string	"\004\n%\001"
+	.string	"\020"
+	.string	"\337\360\372\231\b\b\002"
+	.string	"\002\001\002\002\002\003\002\004\002\001\002\005\002\001\001\312\337\356\336\007\004\252\343\367\225\006\002\007\002\003\003\254\224\272\335\r\f\005\004\371\333\346\303\005\005\255\335\207\247\016\006\005\002\001\006\320\321\356\270\017\002\002\005\002\006\007\340\337\203\343\005\004\002\b\002\001\b\231\337\216\304\r\b\t\002\003\t\256\332\234\316\n\002\003\n\301\343\227\272\003\006\002\013\002\003\013\366\332\246\320\b\f\212\251\337\324\017\001\002\f\002\003\r\360\227\267\314\r\006\002\r\002\003\016\246\345\220\276\007\n\017\240\342\234\212\n"
+	.string	"\025"
+	.string	"\"\013P\260\f\200K\300|P\253\215i"
+	.string	"\353ef=:\315\017nA\346\233vk"
+	.ascii	"\2750\330\025\346\001a\310\n\001AU\222y\311:\213+\300\020"
+	.text
+	.section	.gnu.lto_.ipa_sra.2d0455e32856f543,"e",@progbits
+	.string	"(\265/\375`-"
+	.string	"\235\003"
+	.string	"\342\005\017\024\240'\351\340\377\377\377\237UD\277\375~\373IkmK\231R\256\372\203C\020\220\356\267\002\244\223\254z\212\036\311\317\020q\3123V\020\263\323\bz\255s\370\213\202\\T\323\277[pC\026"
+	.string	"\370\300\333\002\020\002}84K>->\206j\340\260R\030\211J\034X\270\202\220"
+	.string	"\023nA\031h\300=\026\302\\\210\263\21240D8\311\301\274\270"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.inline.2d0455e32856f543,"e",@progbits
+	.string	"(\265/\375`\312\003U\013"
+	.string	"\346P3.`k\222\016@\304`_/|\b\222\022\020$\300!\355\236\252\212\255\201\277\332\013V\024\300\002\004\001P\254x|\177\374\377o\277\021\262\345N\001!"
+	.string	")"
+	.string	"("
+	.string	"/\361\323\366\261\215\331\330_Q\253y@\2333s\321g\330\266J\375}\264m\3230\243m\344)+\212\006Q\301\030 \210\013\257m:\b\017\307\"\032r\274t\267n\243\255d\365\304\210\266\217C`E[\313\027\260&\027m!\223P\177\021\337\246\265\343\262\222\356\323>\254\251.S\031P\303\303\301\260\t\316\250\206\266\016\277*4\210\366\326\271\255"
+	.string	"\2420a\"O\204Xo\013\315&"
+	.string	"\222\b'\220hFS-q\235\3324\327i[\3711f\243\376\201Hr4\236D[\201\243\003B\250\321`\304L\005DSP\222L\007\300\002!\t\250\312\003\022"
+	.string	"\343Q\020\206\005\312\030(\232\370\337\3010\225\016\301\335GG\016\237=\217L\375\034\337wt%\326\340\371=\362\372\261I\330\377\236\373\3750\317\205\320\243E\037\223\311\273r/\266Q\335\017\232\267\356\312Y(8\311>\005"
+	.ascii	"\2148!%\345\337=\f\234\001\257\361SE\273\3119\237\316\212\262"
+	.ascii	":x|D\026\343\257\335O8\316\275\325\332\355\223\233Vk\206\376"
+	.ascii	"Q`\345\3414Z\266\205\343a\316\371\240MF \252\316k\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2d0455e32856f543,"e",@progbits
+	.string	"(\265/\375`\013\001\345\004"
+	.string	"b\306\023\035\240'\351\377\377\017\300\252\252\242HUU\201\363\277\345\373[\364\333\377\377\366\344\357-\223\f\233\241\230\t\344y0\\ \fN\027\301\351\313\307\250E\004y\343\277\216\204M\330\331\305O\001c\006\324\310p\372O\267\262\224]\312{-\316\322\017\331K\037"
+	.string	"\001\213\330f\227Faa \005\256\303\333\205\021\355\272\033\202)-\002\025"
+	.string	"yh"
+	.string	"\360\226A\030\257\020"
+	.string	"\344\300h\200y\344V\r\347\320\254q\325%@\036\200\031t\203\272\261\022\022\003\311\242"
+	.ascii	"\013\310\003\027C\317O\n\340\006"
+	.text
+	.section	.gnu.lto_.pureconst.2d0455e32856f543,"e",@progbits
+	.string	"(\265/\375 2\221\001"
+	.string	"."
+	.string	""
+	.string	""
+	.string	"\017"
+	.ascii	"\232\004\001\231\004\002\231\004\003\232\004\004\232\004\005"
+	.ascii	"\232\004\006\205\004\007\232\004\b\232\004\t\232\004\n\231\004"
+	.ascii	"\013\231\004\f\231\004\r\231\004\016\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2d0455e32856f543,"e",@progbits
+	.string	"(\265/\375`\326\001-\007"
+	.string	"2\310\031!pk\322\001`9\326'\367q\037\367\377\257."
+	.string	"\200\004\007\"\375\357G\361+\273\257\277o\253\211\224)C$\223\b\363Q\324[\224&9\237G\301\341\374$4\0063\004\216\264\240}\307\351\214\223e\005X\261!\003\230f\254tM\305S\036\365\216\224\031)\233\221J\264C\345\363P\216\350\325\325s\276\312\241v\303\315\367\0226 \260\"\0313v\225R\200!I\340\236L\"Q\356T\372\302\235X\313\316\035\230\006\201\217B\360930\3376\021\326B~\t\333 \024\265Q6\333\332\256\341,\311\267\202\2353\334\t\246\205\f\312@\242\005h\244\201D"
+	.ascii	"\r\026\300\267\333g\315~\204\371\211`%\226=\200\330\366\306&"
+	.ascii	"8\t\037\342\374\036L\370\031\340\223u\301\006\220\025\2122\260"
+	.ascii	"\007y9H\355t\232~.\214\201\""
+	.text
+	.section	.gnu.lto_.lto.2d0455e32856f543,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_displayClearScreen.3.2d0455e32856f543,"e",@progbits
+	.string	"(\265/\375`\254"
+	.string	"\255\n"
+	.string	"V\024J@0\211*\035\310\362\360\222K\241\004S \001\234\366Eb\206\016\313\n\024\314\201\250\375\016\352\367\021\016Z\267\306FF\260a3*!\314\210\"h9\024ok}\3240\220\306\225\356F\006\331d\357\224\0025"
+	.string	"7"
+	.string	"9"
+	.string	"\273#\205'\270S\217w\330N\271K\266S\2136\004\210\217\005\025\251%\333\335:\013\\\274\024\375#8\244d\n]*X\354\256e\311\024\340\236\267-a\273\302~%\3631\331i\305\022\311\231=\206\344$`_\333\335\365L\331g\375\332\224\226R\372\\\205\344\222D\330\0050\233\2600\332\340@\304\366\245}\325W\342Y\2407\354\246\0340\b'\325\257\331l\357.\r\303\203:@&\001\"\265i9\035A\215f\310\366\367V\006\267;\242\370\013:\302\317v*\347C\314\032W\360\341v\227\342'\360lp\006N}\320v\372\335ec\351\204\033\217\363e\302a\271\340\204\036\246\206`\347\361@L\335x\026\214z\001\303:\211\360\307\351\300\332\371>\260F\306\275\2663e*"
+	.string	"&\232\036\026\237\331\354\356\257\314|\241\002\020"
+	.ascii	"2\241O/0\\\020\224\312\207\364\366,l\0345\211b\260N\251\3155"
+	.ascii	"\235E\312\204Q0\352\022V\263\032\035\356\360\242\235d"
+	.text
+	.section	.gnu.lto_displayDrawScreen.4.2d0455e32856f543,"e",@progbits
+	.string	"(\265/\375`]"
+	.string	"=\t"
+	.string	"6\222A8@\217\322\001p\221\2769\307r\340\177(\016\021o%K\246D\351)B\3002\264\217\332JXm0\032ul\324K:\206\211\271\302|\306|\340\006\210\240\226\023D6\3312\245/"
+	.string	"."
+	.string	"3"
+	.string	"\016_\240]n\037\320.\r\332-\007\025\001&\026/\227\335\235\261\343\340\025\364/\362\314\212\205\272\0020\354\256u\305\302\270\343m#\330^\260\r\023\366\263\335]\307\226}\327\237E\265\252\372ZF\205`e\367\"\026\2630\231\362\241\261}\265\017\362\020\360\256\323\005v['(\273\241\202\023\266\313\321\032\rUD\331\356\376z\330vU\035\277d\3423i\227\032\rX\fq\022\323\266\273\035\177\244\024\261y\\\372'\355\362q\303\361\342Ji\314\016Q\0327\002\241\217\310C\372D\334\346\017G\302\3230\3728\320\374\274P\211\363@S\304y\034\346\307\373&g\343n\024\362&\251\353\274\251\t\367\331\306\226e\006,\025)\234\321,Z\003\013"
+	.ascii	"2\2417\034\330\270\360\224\332\334\322YL&4\202)\227`\233\325"
+	.ascii	"\224p\207\027\355$\003"
+	.text
+	.section	.gnu.lto_displayScreenSize.5.2d0455e32856f543,"e",@progbits
+	.string	"(\265/\375`q"
+	.string	"\225\t"
+	.string	"\346\022D<0\345(\035\200\213'\005\330\305U\334\"\240\223- o\262X\242H\305\242\236\201?\246\255\341>\327b\203\321\230\215\242\246\177F\004\t\002I\310\224\023\270\355\322\016\002\002\304\356M\266L)3"
+	.string	"0"
+	.string	"2"
+	.string	"?\001\355\230\b\rL$\300\206\213\300\356n\233k\346%\366\202y\031A\016^A\377)Op\001P\255N\327\f\304\356ZU\253\216;\336\266\202\355\006\373\003\001\363\341\217E\265\252\372\031\255D\343\262\313\361*\260\003$\f\211m\320\326l_\355\267\216\002>4\235`\227%\340e7d\360Bv\3510\263\355\233\004\251x\262-\361\226\020\013Fw1/5\"\230\342+_\266\233r\360UJ\025\331\310\245o\232\227\217\006!-\224\276\354\360\244\361\303>\266\273\353\310\2621u \217\250C\372D\\f\017\307\24231\372\270\317\366y\240\022\347}6\021\327\tm\036\357\3338\007\356F o#u\235\267i\341\336\236q\203\212\031\326\024\213\3268\343\203G\f"
+	.ascii	"2\003\3020\005&d\220\035\330\233\322\\q\306\262q\rl\300\304\203"
+	.ascii	"\273=\252\225\2160\311"
+	.text
+	.section	.gnu.lto_displayGrab.6.2d0455e32856f543,"e",@progbits
+	.string	"(\265/\375`/\001\225\f"
+	.string	"v\327SA\020q\233\016"
+	.string	"\223\240*\213"
+	.string	"&\345\020.\200\377\"[\313\016h\262\273V\004\232\f|\335#\342\353\021\361W\030\025\266\030\266\240\021\273\252\252*\337!}\336r\215\032\344\357\357\2708[\273\355nR\246\024@"
+	.string	":"
+	.string	"E"
+	.string	"$\270\213D^`7\244\322b\267\323xA\374sw\f\374\2137"
+	.string	"\377\314\3313\020`\b"
+	.string	"\343\223bcw+\005q\356\311\371/q"
+	.string	" \023\317sj\260\273N\220\311\206[o[\201m\006\366W\004\177\327\314\t\213h$Gv\347I\365`_\332\335\265\206\354\213\376\213\224\216/=\2754\224\322O\323R\246U\323\231\351\017\020\360\001ScW\303\350\306\256<\027'\224\355\247\375\021\017$9\362S\250\232O\213u\025\327\323\004(,\222\203\253T\310\244\024\252\031\024\021T^\324\251\246:\224\250\3076\204\247x\304\335\022\016\037\305\205,\004\376\245\036\220a\t?\021\022w\227\3037\361`\213!\376|\021\030\227\325\341\200l\035,\332\332X\340D\370\330\260\216j\323.\n\230\326Qu0\216Gei[\265\3118\373\270\264\n$\313\264\212\352\366\322j\310\357\305\312\210\2228*\213\213@\214\203hL\032\365\237\226\177\002\204:\3513p\b\032"
+	.string	"2\241+h`<\020\022\001gl\343;\344p\231\0011\266\201\201"
+	.ascii	"\257`3\330\216\n\245\021E\b\360\323\202\tSI\013\206\353\224\332"
+	.ascii	"\334\322Y|&4\001\306\\\202mVS\302\035^\264\223\f"
+	.text
+	.section	.gnu.lto_displayRelease.7.2d0455e32856f543,"e",@progbits
+	.string	"(\265/\375`\327"
+	.string	"}\013"
+	.string	"&\226N?@O\223\016\367h5\030\230\332NIHf\250'\002\306&@\023\022\035\200C\274\353\353\377\337\"~\227\214\032\024\033Q\235x\244%\035\303\304\234c\206\234\374\0137D\320KV\334\177o\"eJ\001<"
+	.string	"8"
+	.string	">"
+	.string	"\027\260+*ab\227\253\030A\3743w\002\360/~"
+	.string	"\374\363f\257(0!\200\nP\310\213\335\2454\303\267\347\346\377\303\001\204>>\317\f\005\273\353\f}T\270\365\266\017\330N`\277\023W\n\b\207\321Fv6\367I\305`_\332\335\265\212\354\217\376(\245\341K\277\227\226\244\264j:3\375I\3421a\261K\241\213\261\"\357\304\206\311\366\323~\207{\330>\322\b\372\364\036\0268\262\263\252\244\025\320H\365\021\013T\r\200\300\2302\252S=]\350\320\217m\006\017\331\304\335\216\213/B\002\346\201\177\251\223\024v\360\020\236\270\273\027\037\304\245E\r\177\276\006\374\013U\346\302t\264\313\212\316X\"`\032p4KCiY\005\301\3124\324ea6T&\323(\013\305\030\247\312\250\016\206e\324\304\355\245U\221_\013\221\r\3450T\022\022\024\017\271x\n\365\240\221w\177"
+	.string	"\245\024"
+	.ascii	"2\241\213/0.\020\302M\302`$\344p\231\t\004\333`\220\0266\230"
+	.ascii	"JZ0\\\247\324\346\226\316b3\2411\030p\t\241YM\twx\321N2"
+	.text
+	.section	.gnu.lto_displayReleaseAll.8.2d0455e32856f543,"e",@progbits
+	.string	"(\265/\375`\202"
+	.string	"\005\n"
+	.string	"6\023F=0\345(\035\200\3577\366\030L\315\305\320 \022\345z\002\316\260\031\001\357\"\340Z\353|\265\206\333\350Xm0\032\205V\324\364\317\210\210d\240\f\267\003rKo\016Ib\242\344\223M\366N)2"
+	.string	"2"
+	.string	"7"
+	.string	"\016\334\251\307#l\247\334\017\266S\207v\200\205\215\201\001\0340\331\356\326\031\362\3602\364\177rM\313\245\272\314H\354\256e\313\345q\317\333n\260\ra\237!3{T\311\tb_\333\335\365|\331\027\177mJK)\375L\001\214\302\313n\307\214\300\306\250\313\310\306\366\245\375\222\233\204\027S7\330}\261\264\354\216\017\016\0041\021\242L\200Fj\323rz\363\301\232*\333\336a\025\334.\313\343\253d\200\250\355T\316\004"
+	.string	"\266x\n\212\333]\217\217r\272\340DN\375\324v\372\311\021I\304\225\f\"\020\351c\002I\035gP\007\3433Q\002\273P\005?\321\251\373B\225\324}(*\350\003k\207c\257$\372\252\311\363\276\272\031\367\332\316\227i\201\330jj\330\037mv\367\225Q\016"
+	.ascii	"2\241\001/0<\204,\354\0265\263`\260N\251\315-\235\305dB#\230"
+	.ascii	"r\t\266YM\twx\321N2"
+	.text
+	.section	.gnu.lto_displayIsGrabbed.9.2d0455e32856f543,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"\355\013"
+	.string	"\326\226SB\020q\224\016\033\002H{2\306f\2118k\002\020\250L^P\013\020\276x*?\024+\301Hfz\373_\377.\346-\244\275\003D\266\253\002"
+	.string	""
+	.string	"4\203\324\213`\034\264\217\264=a^,A{o)S\nC"
+	.string	"@"
+	.string	"@"
+	.string	"\333a\032\342\244\303\247I\362\177\362\247\022\002\303\203+\035z\370{\004@\250tH\2602B\303\302iH}\027\021\025,"
+	.string	"\034\352aX&\037~\362\374\340N\231\035\020v\327\351\301q\270\343mK\260\335\300\376\201\251\351\307\030\2622`\305.H\013\307\306\200-F\330\036\331\026\333\231\366K\334\304\350+\321\003\354\252\\\244\354v\013\214\271\016\335]@<\274~\211\207\266\315\300\301\310\244w\"@>\262!\205bc\003\255\b\225\344\225\240\244\324x\337\342\365$R\274p\205\243\330\256]\324\003\377\004\006\013W\311\341\025\201\214\225)[O\226\211\b\013\265(\252F\230\201\312\033vWJ%\261\377vw\255*\303\257~}\351\235\215G\023\332<\331\345M&\203f\002h\3138\330\246u.d\032\007\363d\032\n\330F\333\260L\001\177@\035\r\013}>\032f\351\366oU\345|\n\236\212y\352\207m\250\006Lzr*\324\247r\2302\021"
+	.string	"M\204\336\031\341\265Qd\210\3235X"
+	.ascii	";\202\350e4\233\300\026\320\275\226\260>\027T\212j?\261\314\f"
+	.ascii	"\022\032\275Jc\2265\367"
+	.text
+	.section	.gnu.lto_displaySetXY.10.2d0455e32856f543,"e",@progbits
+	.string	"(\265/\375`\216"
+	.string	"\325\t"
+	.string	"V\322B;0\345(\035"
+	.string	"\276\353\241\001\0323\261\250\345\235\265KkR`\242\275B\242f\237f\265\206\255\346\303\372\021\346\364\242\246U\030\030\220\200\035j\320\016!\025\0166Q\\I\343\266{\247\024/"
+	.string	"3"
+	.string	"0"
+	.string	"/\320>\267\023h\237\006m\232W\221}lCCV\263\273T\206\034|\004\375\307\036\300j\251\0369\020\273\353\310ju\334\362\266\021l?\330O\b\221\243\225\304\030\204\273\034a\200\235M\030\022\333\357\330\260\320AF\233\341\003\276\242,w?f>\217\366Q\236\002\376\225\372\300\256\253\345e\267.Xa\373t\r\322\376\316\002@J\233\342+\250mw\033|\031\206\205\200\314HJ\373\234*.'\036\253\030\332U\025%\210\375\315\356\256\245\313>\354\237\257\277\374\353\017\247_\\\004\032q\246o\324m\006yN\234D\351\353B\364\363D\025\235\027\242\243\216\233\240 \357\243\236\003\223J\"\217\232H$\217v\352~\263\322\345\b\223\331Jfx\006\022"
+	.ascii	"2\241\033\034\030.\250\243|\201&4\025\016[\\\r\023\326\270\006"
+	.ascii	"|\303\030P\016\f\006F\360\031\026\314\rPQ\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_displayWrite.11.2d0455e32856f543,"e",@progbits
+	.string	"(\265/\375`\204\001\025\017"
+	.string	"F\335eE\360\260(\035\031\211\251^\024\243lP\345\375\241KJ\242\250K\363Dw}\034\244*9\305\233\272\246C\026\2315c\370U\033\201)\367k\r\236\310&2\016_\317\025v6R\372u~\177\233\3156B\366&R\246\024N"
+	.string	"M"
+	.string	"W"
+	.string	"\"O\373\260\227\360\376\261\274c\367ub\305\356g\300\005\270C\177\234m_\304Gx\266\013\355\343\340z\006\030VM\215\335\355B\017\020\017\265{\304C\335p\357\351\371\277\271\006\342\302M\313\245zn\013v\327\331rY\270\365\266\t\330V`\347G\032\354k\253/[\323\240\323\374\034\377\376\317g~\317m\376\216\2467MG.\r\267\264\026\323\032\323\t\323\357\210\261\027\002f\354V\230\335\330\034\030\373`\333\263?\2665\233\t\037\240]\231\300\220\200F\206@\323> \342}f\305\272\033##>\213\024\007\334I<\204:\240\003\314\026\035\347\204\323\024\312\264\b\001\343P{t\025P\006\307\006\214\252Mz\212\025nwG|\024\020\036"
+	.string	"\210\341\201%\036&\214\026\r\217\376%\306%g\276\246j\rK\326\2223\177\262\243v\204\222|\353\n\362B\"g\245*\373S\245\006\251\253\234\302I#\223\b%e*q\036\205\250\210$\230\244J$]\nEJ)\241H:SIT\322\215P\251.\004\304'\023\022\252C9\235P\335\347\333k\253/\333\006i\250E]\354\221\035\215\272\351G\r\025\244!\226\252\354\321M\317\222E=\f\226\214\301c\r\270\335\325H\035"
+	.string	"2\241\021\374P\2620`\245\243\322QR\211"
+	.string	"\231\260ERi\200e\216\"\215)\263\327\356\345\233e\236\313\bsi\027\306ec-^\315r+\024\006\003\003\\\30080\214\317"
+	.ascii	"\300\b\201\n\007w\237T+&a\222\001"
+	.text
+	.section	.gnu.lto_displayWriteChar.12.2d0455e32856f543,"e",@progbits
+	.string	"(\265/\375`l\001]\016"
+	.string	"\366\032_D"
+	.string	"\261&\035\320\0036\374Q\346\200\201&\0268\202\221\206\364\\\3243\306\376\250\214\376k\017\206\361\254Y\204\327\337\025I\336\256\216\340\267.\377\377\377\337u\331\337@.\275\266\277\360\037DGS%v\357-eJ\001H"
+	.string	"H"
+	.string	"Q"
+	.string	"\334;\225\203\354\266\310\254\330\355\016\330"
+	.string	"v\350\016\263\355\2178\t\316n\361:\016\255g\360\2602Qcw\263\317\003\304\303w"
+	.ascii	"\361P7\234{r\376O\374"
+	.string	"\205Xy\261Z\250'\207\301\356:Y-\013\267\336v\001\333\013\354t\366<\346\3578\314\337y\367s\374\345\347h:j\032j\372\305\264\302t\276\364?\342\214\027\002b\354Vx\335X\027p\006\204m\316\356\3301\030\024\300\234\376\261*\030\254\004\2326\002\021\356/'\353.\213\215\310\323\276\353%\002\242\3174\300v'\214\370,$h\030\212\022\350\340J\331\301U\240`\251\320\205\306\206\253\243\266\311e\240\013\215\210\013j\223\236\342\204\355\356\210\217\242\344\201\207\214\017*\3610kX4R\371\362\177\212\034\275\226Vl(\260\250\362ew\250T\r\366\337jK\241\247<\302E\241\021\350\3044\3220\207BR@%%\223F\222\2316\021\004m#\311F\032\310$\013m\246,d\200I%\321\226\235\220H[\326\351\366\266G?)U\331#\237B\215\312\241V\365\350g\245(s4\352W7P\337\241O_\263\272\t\037"
+	.ascii	"2\003\3020\016l d\030\356e\304JG\245\243\004\345\206&XP&l\226"
+	.ascii	"Tn`\231\243\250\316T\302\316\206@\326\204\347\032^\2611\300\301"
+	.ascii	"\302TM\200\240\b\030\007\006\006x\004#\370\f\013\346\nT8\270"
+	.ascii	"\373\244Z1\t\223\f"
+	.text
+	.section	.gnu.lto_displayIsTransferInProgress.13.2d0455e32856f543,"e",@progbits
+	.string	"(\265/\375`f"
+	.string	"U\t"
+	.string	"\206\222B9@\217\322\001P0\3350AN\\\2418D\374h$\203\362U&\210E\322Y\374W\177\027m4\030\215\331\260Q/\351\030&\3261L\240z\301M\214\342\314%vo\262eJ\0010"
+	.string	"0"
+	.string	"1"
+	.string	"\001\363\322\266\027\032PN=\364p}c\344B\026\263\033r\261\343\251k\312\277\3115\221\214\227\326Ku\325@\354\256\265\365\302\270\343m#\330f\260\357\277\246\2515\252\257\2312.\004,\273\256\331\314\266\310\225\020\333({c[\325>\311KP\217\235\016\260\013\203Q\331\r\025\234\260]:\274\300\274\334\036Qe;\342\262PJ\205g\232\227\032\r<q\024p\333e9\370'%\212\r\344\322?\315\313\307\201\217\330Jgv\250\322\310a_\333\335u\204y>\026 \217\250C\002E\335f\017\307\324\221\030\201\335\207\003?P\251\373>\234\250\353\2048\317\007r\234\002{#\320\307\221<\357\3436\341\3363\036\254\242\2057\252Ek\234\361A\203\025\013"
+	.ascii	"2\003\302\260\004\346f\220\035\330\233\322\\Y\3062.\243\0245"
+	.ascii	"\036\252C\030\3235\311"
+	.text
+	.section	.gnu.lto_displayHeartbeat.14.2d0455e32856f543,"e",@progbits
+	.string	"(\265/\375`b"
+	.string	"U\t"
+	.string	"\206\222B:0\345(\035"
+	.string	"\276\353q(\341Rj\304\301\317\310[pA\003\345\256\020=\003\277\206\366q\033\035\253\rF\243TQ\323?#Rl\212\241\332\016\310'\031\004\274\341I#\233l\231R."
+	.string	"0"
+	.string	"3"
+	.string	"\037\320.\267\013h\227\006m\227\207\035{\022W\305\353ewg\3448x\005\375\273\236Q\255NW\314\302\356ZU\253\213;\336\366\201m\005\333\261\317vw\035Y\366[\177\026\325\252\352k\030\214\225\002\223]\213X\200\205I\225\017\215\355\253}\220\207\200o\231\036\260\313:A\331\r\023\214\260]:\f\032\215T<\331\356\376z\330vS\034\277d\342+i\227\032\tZ\f\361\221\022\307\027!El\273{\217K\337\244]>\306\024\026"
+	.string	"-\224\306\354\360\244q\303\016 O\2503\372B\334f\317F\242\323 \372\270\317\374<\020\211\363>3\304u\034\246\307\373\346\306\300\235\b\344\315Q\327yS\023\356\263\215,3d\300P\221\302\031\315\2425:\013"
+	.ascii	"2\2417\034\330\270\360\224\332\234\251\321j\t\257`\312%\330f"
+	.ascii	"5\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_displayResync.15.2d0455e32856f543,"e",@progbits
+	.string	"(\265/\375`b"
+	.string	"e\t"
+	.string	"\206\322B:0\345(\035\200\213G \343\346\302Z\223\322\317\240\3140\242Jb\n\340i\003\373l\315\3426:V\033\214F\251\242\246\177F\244\330\024C\265\035\220O2\bx\303\223F6\3312\245/"
+	.string	"0"
+	.string	"3"
+	.string	"\037\320.\267\013h\227\006m\230\207\035{\223\224\212\027\200\335\235\221\343\340\025\364?r\315\212\205\272f\026v\327\272b]\334\361\266\017l+\330\216\005\317vw\035[\366]\177\026\325\252\352k\031\214\226\202\230]\213X\200\205I\226\217\215\355\253\375\220\213\200w\235\036\260\333BQ\331\r\023\214\260]:\f\033\rUD\331\356\376z\330vU\035\377d\3423i\227\032\t^\f\361\022\323\266\273\035\237\244\024\261y\\\372'\355\3621\256\270\200\270R\032\263C\224\306\r;\241\217\310C\372D\334\346\017G\302\3230\3728\320\374\274P\211\363@S\304y\034\346\307\373&\307\300\335(\344MR\327ys\023\356\263\215-3d\300R\221\302\032\315\2425:\013"
+	.ascii	"2\2417\034\330\270\360\224\332\034\323YW&\264\202)\227`\233\325"
+	.ascii	"\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_displayTxBytesFree.16.2d0455e32856f543,"e",@progbits
+	.string	"(\265/\375`\203"
+	.string	"\365\t"
+	.string	"\366RD:0\345(\035\2363\222@\353<p\030\260\312h%\243\252n<r\b|=is[3\375\327\307k0\032\263Q\324\364\317\210\210d"
+	.string	"\203\307M\321\305\t\"\262\306\020\302m\345N)3"
+	.string	"1"
+	.string	"3"
+	.string	"'\243\342\354\270\320d,,\223\230\335\331\t\274@\273\214'\320.\225\343\250G\224\177\222g`\031--W\352q{\330]\307\226\013\343\326\333N\260\315`\177\023\321\232\211\216\032}n\203\275lVv-f"
+	.string	"\326E\252\200\330>\331\032\3331\332\217}\344\364i\372\300\356\013&ew.X\201\273\364\344l\373!\027\t\252\352\240\261\322\224m\357(\020'\024\241\222\036\370{\211\004\267\273j\360e\244\220\373\270\364M\332\345\325\300#\246\2123{\246\242n\330\317\254\276\274}\376R\006 \217\250C\nE\036g\017\247\324\211\030\205\336\247\013A\320\204\007~:\221\327\tu\0360\3548\033\177#\020\330\221\276\017\3544s\357M\021TZa\325M\317\n\020\020\245:\006\020"
+	.ascii	"2\003\302\260\r\273\032\f\366\202\354\224\2568\032\213)\315\325"
+	.ascii	"g,s\rG\231\300\256\032\257\003\023\017\356\032\251VL\302$\003"
+	.text
+	.section	.gnu.lto_displayInit.17.2d0455e32856f543,"e",@progbits
+	.string	"(\265/\375`\377"
+	.string	"\365\013"
+	.string	"\206\226Q?\020O5\035\300\344E\352v\371\177\003H\307\347\203?\003}\003\274\325\276\356\n1\331\354?\323\206\316\307\214\217\352\251\373\204\267\251\004@"
+	.string	"\020U\r\267\364\354@% \303\356\nB\321\247M\366N)<"
+	.string	"="
+	.string	"A"
+	.string	"\273\244\025k\267D\340\003\333\253\313\023\320^\267\017\320^M\332-^~\330\253V`\030\001\333]\216z8\371I\372\017\361\214O\210\363\331h\260\273\236\237\220\206\233\336\266\001\333\013\354o\b#\021\212Cg\306\354\2223i\007\373\331\356\256)\311~\371gO\375\224N\337\301\200\005sAb\273\240X\214m\325\024 l\377a{\226\026\n\004X\217*C\202O\373\247\243\310\2476\027\020\237\002PIt\372A\315\216\360\025X].L/\307\244\324\247~\214<\224c\273\362\022\341\266\353\221\370$4\022\266\214\366zZQ\274`\2442j\217\027\221\331vW\342\253(L"
+	.string	"\300\242\264\321^#\240\037\005B\367@\243}\236\245\303\214\026p\263\027\251\320Q.#8\341F\361\323\200\342\204\263\200]\205\363\304\221\213@\034^>\221\303\204\241\310=\312}\266\224d\007*Z\035z\301d\367\023\215\320\013\223\377i\266w\023\001\025"
+	.string	"2\241\247/0.\016\270FR\224"
+	.ascii	"\001)\225:\351\205\274\220z\255\202{\252<\247\301I\213\273\016"
+	.ascii	"a\215k@+\f\r\n\203a\001*4\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2d0455e32856f543,"e",@progbits
+	.string	"(\265/\375`\035\001\215\005"
+	.string	"\222\207\034&\220+\035\377\377X\355\216\375?\376\201\206\344\271\273\273\313l\333\266mM\303\002\353_\322\b!\204\220 \262\323\3362\005\265*\312\223\344'\023\371\341@\316.\310=\0339\256\241)\350tf\266Xg\362\001\266\305KE\322\027\271"
+	.ascii	"\362\353\361\200\343V\343\025\343\324\342\223\342R\342Qv\bq\300"
+	.ascii	"\341\217\341\257p[R\323\276\335`\320\231\231\330]k\333\b\001"
+	.ascii	"  \200\203\304\325YHn%\270\231M\222\017\2421\314\230\3127\022"
+	.ascii	"\264\037a\217 1\304]\206\342\245\3132S\364\360\215o|\3437\276"
+	.ascii	"\341\033\337\370\215o\370\3067|#?\332\326\216\001"
+	.text
+	.section	.gnu.lto_.refs.2d0455e32856f543,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.2d0455e32856f543,"e",@progbits
+	.string	"(\265/\375`d\030=l"
+	.ascii	"\232\257\330&P R\322I\007\337TW\026\025\021\035\361\210\277\313"
+	.ascii	"\255\326yl\021\360\257\243\253\212\016`\261\242\223Mh\321\370"
+	.ascii	"5r\335\332\002\007\225!]\3765\312+.\006\002 \"\254QUY\225UUf"
+	.ascii	"\346T\0018>@\225\245\3150\274j\301\240\333 D\312\024\375\001"
+	.ascii	"d\002r\002g\274\353t\261\322b\307kC\036N*\264V\231\210\233)$"
+	.ascii	"=z\264\312u9`\306\314M\241\263\351:\243\027\245U\306\302s\214"
+	.ascii	"v\202\263"
+	.string	"\244\311\264!O \223\300\034\326\363\211 G\371D\3605\344\342\3263i\332\276)\3478\346;5A0\265\312p\315U\330\312\031\216\251\354,\265\f\247\336\253dF@\310\214\200\r\234\021\245ZP\375\f\353\373\370Mx\347\224$\353M\312\315\035\231\2215\255>\333%C\266\320\264z\025V\025nmA\350\223\260?(\3476\270\f\234;\332FX\177f\203\346\374\320'\004P\2103\364\207@\202\213\331\271\327\354\336k\242\247\34451k\365}\307a\036k?\204\264\372\363\332\317el\306A\244L'\347\205\336\333\372\f\275|\300\273j\365)\244\262%\307\216V\177\301\212\306j\234v\177n\232v\204\tk\365A\353\271\375\210\264+\301q\326\367\372VJ\313%\202+\217\b\346\220\200\361w\364g\233\237w\030\3709h\303\177\236\277\371\376\013\361\263\017\264HD\017\r+?\337\304\305\375\277\373y\305K\242\362\177\314\317"
+	.string	"\360\324\325\377\275\233\370\377\302I\374\035\345\347\b~\206\3407\177C\021`\375\373\f\247\f\007\006\261\237S\b\271\352\303\277\303\376\227\371y\030\343\277\231\357\374}D\3479\177\023\371Y\350g\023?\007\035\312\3179\017\274\355\302\277}\370\231\352\347\344\317;\374|\303\317\305\237i\374L\303\317I?\317\370\231\375\231\350\347\030~\206\341g\027~f\341g\025~\036\372\371\204\237M\370\271\204\237I\370y\204\237E\370\271\202\377U~\036\3613\213\237a\374\377\362\363\007\377\263\374\354\301\177\001~\356\340\347\027?s\360\363\006?k\360s\006?c\360\363\005?[\360\263\213\237)\370\231\304\317-~\236\340\347\022\377U\374\237\373\337\023\215F\243\277\272\342O\025\370}"
+	.ascii	"\003\303\326\352)\210\223>\325\307\024\016\035M\314\216,\233"
+	.ascii	"\317V\237\351\224-[i\312~x\300\374\321\325\2211\234\225.(\023"
+	.ascii	"v\263A+\02386\326ba\256\304\374\265\372\374\301\2012\201\215"
+	.ascii	"\265z\t\272\230\216\214\311^\017\017cb\311\f\001\210#{?\234L"
+	.ascii	"'L\357\335*\003\003\302E\026U\347\207\305\243}\214\235\355u\222"
+	.ascii	"\006k%\035\326@\264\221^\322_\214\326H8"
+	.string	"\355\375C\023\351\245-\206c;,\013\2228\331\353\253\"\355\243\0054\252\316\017I{\365\020\023K&\214\255\257=$\035\204\351\204\311\366F\271\030\213\252[\211P\t\"\212\204\372\226\262\362\017\217\030\"\004\207)\b\227R\030\005jIM\373\300kx\002\225\340\261\255\357\264\365\335d}\217\255\357\260\265\347k\375i\257\265{t\026\243\375\264\326\220\361\226PZ\255\276\177\254;\334(\377\004\337U+\020\227\b\252x[uU\331\037\027\265\256\352\035\274%pY\244\325v\311\006\360\371'\305L\013\363]\211\252\363sr\306l&\226\314\020\306\350\366\234<a\267,QucE\220\341>9!5\354\306\242\355\357\247\236\352f3\233\207\246j\251vj\035\235\243\243\030\255\241x\315\371\217\001\377\323\336\273t\357m\022\330Mw\n\205\272\250:?4Q\316\370\r\001&\224\206\335\204I\237{\203\270\201Ep\205\363\330\016\253]"
+	.string	"KT\335\330\275\355\331\354\347!\2408\n\313\245-\222{\203d\005\220\207&\212\230\337\275m\003?\r\254=\370\330\202\362\243\376\335\324LA(=\275\255\350\233\251q\004\337\262\370\340\324j\337N2\032P+\337\313^:\316R{\2378[\312\370\200\266\212\202K\004U\274\365\f\024\034F\243\321(\003\005\255\2546-\227\b^\216\323\326s\223\365\274d=\017Y\317[kO\237\031u\316\257\t\2322g3\302'&Xxh\225\251\370\366r\350\362\212(b\314yo\030\305\024k\225\305\350\270y\275A\265\312a\204B`\031\003\322*\353\351\224\355`\023\0033\024[\243c\013\230/e;\274\212\264C\234\2675K\252Ze.\334\345\354\205\267\\\366\262\302\351e\370w\257r\310\214"
+	.ascii	"3\002*Y\327\221'A\365\f\265\236\225+\212<<\341\024)\314\257\273"
+	.ascii	"\215\246\307\213*\257\325.\323f\030\215\201\356{\237i \267Q\266"
+	.ascii	"\267m\"\200lj\255\266\315\217\365\314@0\215F\231\001\033\247"
+	.ascii	"1c\030\332v\224\005\260+0L\030\206\252\235\335|mib\206\001\003"
+	.ascii	"\206\343\362\310\262\264\306(\260\3731\367\346\305\013\343\345"
+	.ascii	"\021\001\033\252\342\364\324r\341\302{]Z{:\360P.\303\356\356"
+	.ascii	"Z\313\005jP{F|@\351\"\336Z\304|\t\023\265\244\325\316\343\265"
+	.ascii	"\341\2176&\266V\033\317\213\b\"8.\204{/w1\263\264\374\202{U\214"
+	.ascii	"\234U\321\321\251\001S\177@\353\364Z\275\272\234\233c\250\036"
+	.ascii	"\230P\315\312\213\231\231+W\030\252G7|\"\323G\326%.\216\315\364"
+	.ascii	"\334\345\027\271\275\234*zZZV\340\340\030\272\266\006@\311\322"
+	.ascii	"\032\033&[;\267\347\372~\353)T\030\312X7\3253\313\322\362\273"
+	.ascii	"XX@99\304\200\245T\353\373\017^\245\324\275w\312\246\275R\313"
+	.ascii	"\235\263\r3\320\317\303)'\360_\275\351\212.\367*\021bf\r\213"
+	.ascii	"\242\314:\212\373\261{\223>\267\275R\314'W\222\031\004^\323\247"
+	.ascii	"\275@\004\270\317 \227\331r5U\347\355\333^\276K\\\315\032\230"
+	.ascii	"\255S\212\331:\223=w\311\231\274\267m\3660\241\312$3\237\\M\346"
+	.ascii	"\323\331\364\271K7y\237J \353\222\263\311\314\342l\3660\237\312"
+	.ascii	"&s\211\253\351sD\b\22159\324\244\321\361\035s\351B=i)\245z\354"
+	.ascii	"\230\255"
+	.string	"\363v\271\227\241LW*\201{\265\234R]\224W,ei\007\265lS:\271\275\367\016\360\264\354r\336%;\246\022\347\275J\226H\367iE\262\265\273C\330.\031D\353:1\335K\300m\357}\2727\311\327\356\336\233\274\367\336Hi\265\367\366\350a\202==\335\213\365\363t\265\222oL\3676\364\213\224&\363\331\345\024z[{\202\335\2466\311`\267\013\227\324\372L\242]\2472+X\223\212L\347@\211!q\302\006\025\206UyQ\221\213\333\211~=i\322*^\031f\222f\253{9Yz\340\001\260\325v\370%/\313\313\02365Yv\226\246\241;E\250\332\250\260\254*\023\315\335\262Uu\211\205J\253\245\261\204N=\273)\0070\252\f\0245\266`\017\2544:\322\344\260\2341\371B\313\273YB\244\355\252e\276\235/\034\\\2008;\021GJ1\203\230dD\036\203\330#\033JF\304\244 \343\321FP"
+	.string	"H\"6\207\244cPI\311\006\221X$\336\334(\032\221\220E\342\215\fE\254\222\312\032m\324P\211\254\222\021y\f\036)\005\t1`\f\005!\331\031\306\"$\n\032\214\212J/Xc\361\005\r\026y\304ah\210L\"\302@\022\261\020\212\221B\b\005\260\300\202\013- \331\235#V\306\021F\217\222\322\006)\be\024\031A\320\031\352\300\347F/"
+	.string	"\270Q\222\221%\2623\326\257`\361"
+	.ascii	"\213\0267\334\274\205\013"
+	.string	"\025.T\004\337\302\205\220\220\013\026B\353Y\b\245H$\321F\361\005\216\rA\326(\311\006\366(x\274Q4\252G\245\242\221\332\202\013\307b\r\365\210\275\t\336(\246`,\036\2156\214p\216t\342\305\032\2541\bY,\032\203t\220D\020D\260\262\254\361\203#\213\304\201\203\033\220:G\"VIFQ\214\025F\310(2\316P\331c\021\253\304\032o\214E\254\222\221\316\320\215\"\343Q\016\233C\322\020\221e\215F\307\034c\021\222\221:\203\230dD\016\351 \211Z \211I6n\214EH/Xd\222\361\006\216R\261\310\001\221\315\361\310\032g\024\215(\020a\030Y\031\216\304\"c\214c\022\td\021+\003i,b\221p\220G\"\244\261\210\002\317)\240\340\005\n\025L"
+	.string	"a5J\201C\221R\215c\322Q\320\321\310\332\220d<\n\"&\025\321\b22\036\203R\2300\"\342pd\215A\254\224JJ\324\331Z\253\251U\247U\351\325S\253\267\251\325\001\177\303\036P\344\222\004\325/\237\362\220.S\252\224\314z\223\355\305r&\371.\200\363#C\346w\231X@<n=\2308\323\034O\251\236BA A:\305\003\005\307u\246\3254*\225b\264\317\245\315\007\245\260\332\013\025Nib\233k\365A\246\365;\360\347\202\351\323\205XtS\366t\244N?NNX\017O\261\300\365\017\254iV\315f\332\364\224\351\004\216)\357\314\232\342x\312\344\005e\207\307\267\364\343\354\360\025\261\372Ao\275\215\226\365O\223g\2644\33184\200^e\023\b\316)\006\313\357J\3119\340c\304NL\211\0325\035\255[\253"
+	.ascii	"\375\270\004\276\243;fj\222@Zm@^\273i\245x\364\337\026\330\220"
+	.ascii	"%\177k\204X\214l]5te\363\222\347C\b\037_\3735\330\315\232\332"
+	.ascii	"\225fb\002\005\202\314\333/\201\373\250\2610\245\0304#\"\"\""
+	.ascii	"\"I\222\244\003\221\005\204\030\306\244\273y\022\3404-Q3\310"
+	.ascii	"fF\222\224Q\220,\273\001\237\202\206\344zx\304\201\375\360\347"
+	.ascii	"\031\022J\204=\026S\241\3043\200\350\377\236\366\006\007\257"
+	.ascii	"\031\312\020\303t\257\204\237\374@2\302\n\222\"\363\223\016\340"
+	.ascii	"7A\263\022\203\261\031\375=\231\216\364\3118u\235l6,3\315\317"
+	.ascii	"\354\330\003\300j\247\204\314\361\344\274\006{\304\350\361\023"
+	.ascii	"\016\342\357g%\341G\332h\31387\252\311?`\\T\362\253\201\022T"
+	.ascii	"\202\315?\307\307\253\005I?C}\217\221O\214\222\327F\357\230\270"
+	.ascii	"x\303\0062\310I\352ra>\335\343[\"YA\375J\334\f:\254\206\232%"
+	.ascii	"[\364\310\2141U\342\350\332-\200\306\032\005\3304\252\312')\203"
+	.ascii	"\261\311\345\2657\213N(\212\377q\004Np\264c+ \013\026L\244\373"
+	.ascii	"?\325\243\301\252\356js\366`Xi^?a\270\300\252"
+	.string	"f\324\001\302\3761\3073\346|\3576<m\313F\2065\252\275i\002\311_T\245\351\211\353]\027\313fR\f\251\273\316\222\301\002\"\253,\237\\\226\354\030\371b\375iL\006.\205G\fm\376\325z\233M\3731Z\370\261z\202m\210\364\344\231\356\244L\025I\3001\362\363\025\260\323;\271\344\325\200\003d\357\250\271%l4M}\235\317\346lL2''WX{$\243\004Fu)\366\333W:\366$\324}\221P\031\177f\303\216\242\375\353h\357k\300CI<O6\254Q\361P\0313i\013C\016am\223\314\222vz>t\217\262\217\253\236P\267]\313\332h\226\333n\307~\3458sP\345\327\354\207\263\323;\354\002OS|r\r\231g\344x\275E1\310\254\255\017\233\033\251|.V;\205\032\333\277\260 @=\246\376s0\330\244\236I\314\371\320\272:\305T\370\372\246bg^\031\023\255E%\255\233\027"
+	.string	"Q\303K\3168D\261\350h\016C\006\260v\025m\3600C\254\250`\240f{\237\376\321om\032\236\030\306\345pP\004\214\331\240\223f\317ZY\240\306E\315\341Y\337\313\234\222` \033\236\207n\317.\025a\264Eg\230\212=\372\025\243gi3\024\232+e\336\023\246x_\254\243O\265\307L\026\300z\224\026\201VUc\032\373h\f>\036G\b%\3300\350>\307\3473`O\351\r\305\b@\366\1778 \be\300\004\fm\337r2p\235P\272\020y\224<e\220\357P\236(\276uk\256\316\027\345\366\227\3720\231\tP=R^B_\326\356|\256\236\3237\201/\256\206If\025B\021\260\274\206\336m\244\336\262\002\371^\307\222T\365gR:n\225"
+	.string	"<\377*\315[\331Q\037S\302M\220\335\024\373>D\035\023\362@\330\254[WV\367@\343\310\364B\316\216\335\216h\245\332\335\315\206b\340\214\025v\261\233\035h\262\340H`\f\270\346\373\334\026o\330#\310b\276\340\364\312\331m5>\031`,\373x\034\3111\027\273\311\f\363\347\276r\366O\246MF8p\374$L\277e\230\302C@<\262\363\224m\3316\375\3269\236v\207\373\304\214\215\350\2724\3751\027\013\377\246{\177\006D\214U\272\242}Ly8\202?\007\265\315\373\003\363\236\367\360\275g\f\331"
+	.string	"l\340^\370\267r\244\036"
+	.ascii	"\371\316\266\037}\202\370Q\367\306\242\223\227\n>L\234\301\370"
+	.ascii	"\035\206_\214\244\035\035\355{\013\277\206w\023\310vV8\262\202"
+	.ascii	"+{X\373\354m\366\003\033Y\336\257\371\356I0nmG?\354\203\205]"
+	.ascii	"^\234\037\273\013\327\016\366\243\331\322\031\304\017\375\256"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.symtab.2d0455e32856f543,"e",@progbits
+	.string	"displayClearScreen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\001"
+	.string	""
+	.string	"displayDrawScreen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\001"
+	.string	""
+	.string	"displayScreenSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.string	"displayGrab"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\001"
+	.string	""
+	.string	"displayRelease"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\001"
+	.string	""
+	.string	"displayReleaseAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\001"
+	.string	""
+	.string	"displayIsGrabbed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\001"
+	.string	""
+	.string	"displaySetXY"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\001"
+	.string	""
+	.string	"displayWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\001"
+	.string	""
+	.string	"displayWriteChar"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\001"
+	.string	""
+	.string	"displayIsTransferInProgress"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\001"
+	.string	""
+	.string	"displayHeartbeat"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\001"
+	.string	""
+	.string	"displayResync"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\001"
+	.string	""
+	.string	"displayTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"displayInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2d0455e32856f543,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,373 @@
+	.file	"gyro_sync.c"
+	.section	.gnu.lto_.profile.70d1807f8746599,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.70d1807f8746599,"e",@progbits
+	.string	"(\265/\375 E\315\001"
+	.string	"\344\0029"
+	.string	"\004"
+	.string	"\331\367\213\271\005\004\002"
+	.string	"\002\001\001\303\260\365\372\005\b\002\002\002\001\003\002\001\002\303\302\306\340\006\002\002\003\002\004\003\240\342\234\212\n"
+	.string	"\003"
+	.ascii	"\240\374.\244\r`\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.70d1807f8746599,"e",@progbits
+	.string	"(\265/\375 6%\001"
+	.string	"\300*"
+	.string	"\003"
+	.string	"\001\003\001\004\003\002\001\001\002\005\002\003l\001\001\020\001\006\003"
+	.string	"\004"
+	.ascii	"\270\fl\326x\tc\003X"
+	.text
+	.section	.gnu.lto_.inline.70d1807f8746599,"e",@progbits
+	.string	"(\265/\375`@"
+	.string	"u\005"
+	.string	"2\212\034\"\220'I\007s\356\272\356}\377\377\240\210l\360\321\001\352\206-UU\317\305\334\210g;i\273\355-w\n\377\333\207]S\023\244iB\312\246\321c\004L`\037N\310\234O\230\320\326p\376#\325_\220\310\240\236\024\350\250\224]\005\0050\331\264i\003\013}F\310\264%\346\231\007\315\211\260m\357\021\332.\177G\372[\250\351\340\216\312\234\0226m\213\257I \030"
+	.string	"_\020b6\001\364\334?s\r\300"
+	.ascii	"2\200<0^\030k0\024\024\177q\302rp\241\355fA\215\002\362\274;"
+	.ascii	"\260$Pj\356\r\266\301,\210\250\260\\N\304\322\262\006\334"
+	.text
+	.section	.gnu.lto_.jmpfuncs.70d1807f8746599,"e",@progbits
+	.string	"(\265/\375 0U\001"
+	.string	"\024\002$"
+	.string	"\003"
+	.string	"\001\001\003\177\002\001\001\004\001\001\001\001\377\001\177\002\001\177\002\007\006\002\001\001\003"
+	.string	"\002\004"
+	.string	"\002"
+	.string	"t\242m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.70d1807f8746599,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\232\004\001\232\004\002\205\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.70d1807f8746599,"e",@progbits
+	.string	"(\265/\375 |\215\002"
+	.string	"\204\003p"
+	.string	"\003"
+	.string	"\001\370\005"
+	.string	""
+	.string	""
+	.string	"\001\002\b"
+	.string	"\001\002\006"
+	.string	"\001"
+	.string	"\001"
+	.string	"\350\006\b\b"
+	.string	"\001\004\370\007\374\007"
+	.string	"\374\007\002\002\t\300\006  "
+	.string	"\340"
+	.string	"\002\001\300\004\n"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	";y\030\325\n\026\363J\0368\037j\026\b-\202\246\037\033h\003"
+	.text
+	.section	.gnu.lto_.lto.70d1807f8746599,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gyroSyncCheckUpdate.9.70d1807f8746599,"e",@progbits
+	.string	"(\265/\375`\337"
+	.string	"\035\f"
+	.string	"\226\027TA Q\224\016L\006\\\024<\037\265"
+	.string	"rd\201\277\340\346\306!\030G\216\254I\245C\221\352\224\004\206\020\"\3306\350\262\227\007\365\327\247a\020\bQJLj\356\021!p 6hp\024\371do\271S\nA"
+	.string	"A"
+	.string	"@"
+	.string	"\261\372"
+	.string	"\352\321\266\0250\b9+\240AM>l'\032\273\323R\017\317\016\365e\276\232V|p\332!"
+	.string	"\216\303\325\302y\300\003\273\373\322\037\b\327\361\036\345\301\356\372}p!w\274m\b\2661\366#\004\177\374\274\237\237O\t\240\311`\001B]\314\335prcK\242\212\021\237\277\035\362K\256\3703\203\333a\265EHI\207\340\321\013\252\367\354w\037\t\235\004\272\200]\321\211\024\2733\201/\325\243\347\tP\017\035PG\247\223X^h\251\023\351f\274\335\325TG~F])\230L<\236\r\333\031n\"\253v\027\343\233>X\025\342\321\007Q\217\327\303(!2B\342x'\366\324\236\216\354\303\335]\253\310>)\037\215\324Kb\033\350\314%\323\301<\022.\211m,\217\324`\340\310\nV\2073\301\202\225\221\036\353b\300\327\005\215\264>\327%\255\212m\317=\\\025\271\301F\362~\272\003\021\033\n\3753\352)\210R6\0225bph\022"
+	.string	"\036\026\355n\341"
+	.ascii	"\314\216\255\f\3012\"L\033\"\303%P\024\277\214\334Xl\256\331"
+	.ascii	"3\013\333\211LK\260J\236j\006\246\304\241\356mm\321\003"
+	.text
+	.section	.gnu.lto_gyroSetSampleRate.10.70d1807f8746599,"e",@progbits
+	.string	"(\265/\375`K\003\005\027"
+	.string	"6j\223G\300\030Q:`a\216\370\267s\017j\366\033\203\261ivL\227D\b4\247w\345\353H\277\022\233\t\246\261j\321s\330\311\214\031\374@\257=\200\3134\216\213(.\013\234\027\340?\303\213B\306\326Q\037\021!do\271S\n{"
+	.string	"w"
+	.string	"\201"
+	.ascii	"Nj\020\246\264\0278\210\235\207\350\255\225G\n\003)\355\353\370"
+	.ascii	"\216\330\307\021/\325\332\0234\244\3261\201c\276S\217\237m\037"
+	.ascii	"\307s\304|3G\027\266\006:h>\260\324:\236\f|@w:\017\323\235n\213"
+	.ascii	"\337\334\353\350\\y\343{\023\016\374\370Q\263\341\334\353R\234"
+	.ascii	"\276\330R|\222\020\331t\344\216l\263i\240\326z\334\345\216M&"
+	.ascii	"\2457\241\326jY\263\231\270\277\333\016m\213\366j\bk\004\t\255"
+	.ascii	"\210L\346\354\021G\356\n\373\263n\217\375\333m\272\317_\372\317"
+	.ascii	"O\372\370\0078\217_t\240\333\345>\367\367I{\237t7\245\251'=\251"
+	.ascii	"\364RiI\245?\200\204\002&Wk\211\234\226\312\204\026\221\361\333"
+	.ascii	"\017ti\307| \307Y\004\344\240Yo\237a\3436Tk]\375\366\232\365"
+	.ascii	"FAh\312P\255#\202So\370~l>\022P!\224C\250\202\217x\001U\026\266"
+	.string	"iAPa\222\2632{kZ\371d\266\304e\273\365\3663\032t\273\375l\350[\272\n~r\264-sm\232'\021\001\254\222Z\225\347.v\337\316\r\200\342\312\214\3073\222Q\204\0327:iD\002\f,t_\323\331\253\023\251\371j\255\017\374!3,\023\224\027\247\376\210\356T\002\213\033Vr>w\205/\344\244}\023\031\262\326\212\2636\335.\207\036Qtd\026\313\225Gh'<\271\033\344b'\332o3\340*TaP}p\261P\031\004\250X+\230\013\004-\300T4!\n6\022\341\241f\001\003\031\325\313Ff\024\2020Tk\305\002[*\n\251\226\230\001\246\203\353\303N\247bR-\361%\003\206\"\315\351\025\252B\254\302\231Sk\205b\235R\341\353\024S\300\240K\025\236` \030\236Dc\375\254\333c\022\220%\323A\327\3622\n\302\323\231pB\250\203\236\305#\235Zs\016\270\354\216\347,\355q\277"
+	.string	"#F\367\213\235'-\355\267;\016D\250qL\001R\214\030\206\002\221\200\302,H\n\333\260\002\0313\356\021\220\301bS4i\335\206M\007\216\025\024v\336\033|\313\205\271xS\036\254\251\005\003L\027\324\306\363\032\001\363\3464j\375\311\215#&\377\317S\006\\C\264\036\017_\325{\311\341"
+	.ascii	"\212\257!z\223\312 \301%t\256\275\205\222\205\214\226\022\224"
+	.ascii	"\2707\333\355\324\330l\223V\220h?\254\3076\300\r\307\234g=x\260"
+	.ascii	"g\202\370\034\035\3127\237s\207\301\237\332\251.,\2756\273S\001"
+	.text
+	.section	.gnu.lto_gyroMPU6xxxGetDividerDrops.11.70d1807f8746599,"e",@progbits
+	.string	"(\265/\375`\""
+	.string	"\325\007"
+	.string	"\202\21777Po\322\001\200\276\347\205e\016\243\n\342\035\317\306\264L\235\325V\275\357pk\b\271\2010\3762.\330\273\206LTU#\001tb\242\362\245\034\017\324O\020\331d\357\224\002\223j\033\312\330\205u\264\254aRm#3\252\241\340\320\007\331\3418@H\214f\362:\360\214\320P)1'\225\227\2727\204\b xa{\342\"\025\326.\306\202\037b\241Y\035\217\276\247z\2040\240\003\275\223]?\017j\330\247vw\rK\206\357\376G\t\234\030\240\354\216N-k\022K<lo\366\305\366{\366?\016\262\275\363|`\267\224B\262[\023|Y\217\256/\250\036\255\023T\217V\330\314\275r\2142,\241\221\225\335*\341\306\271?\316\277\351\230\220\212\210\364\371\003`\330]?\021)\343\206\267\215\261\235\261m\n\t"
+	.ascii	"2\003\302\260\2268,d\354\3552*\2441b\216\330\016!p\347\232d"
+	.text
+	.section	.gnu.lto_.symbol_nodes.70d1807f8746599,"e",@progbits
+	.string	"(\265/\375 W\255\001"
+	.string	"\244\002S"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\t\177\013\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\n\177\f\013\177\r\005"
+	.string	"\016\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\200\036\340\207k\3151"
+	.text
+	.section	.gnu.lto_.refs.70d1807f8746599,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.70d1807f8746599,"e",@progbits
+	.string	"(\265/\375`\177\034\315\205"
+	.string	"z\330\2140Q0\320\322\351\307g\216\241o\215Q\024\342G\016(\n\222\021A\316\215W\"\205\256\377\343\r\204\036e\244-\233\202\264\2000\230a\333\3550c\222iwH,\034\027!\356\036K\323\225\"\202@,\230\356\211T6-m5\276E\252t\231\354M\266L)\005\275\002\361\002\372\002OTv0|\f\177\303\235o\325Go\345g>\312\204\214\244\bOS#\336\352m\264\026\017O\310l\324\n\001v'\247\346n\250\250\b\215\322\365\206\205\321F\253p{\236q\310\237]\030\310@\003\224\031L\354>\312\3258\236\207'\344\007Y\320\354\216\335\326\223\223\363\326\331\327\230\2140;*1\210\374y\206Bm\314n\304G=\262\333z\216?\371hd\006;G\323\375\371\213\037\365OC=FfN\212pn\301\273\353\376\344W=\215\257\361SO\365\312\227r\347G=T\0131\213\204zQ\240\334\301\001"
+	.ascii	"\355K\005\367\215\202\373:\301}\225\340\276Ep\337\037\270/\017"
+	.ascii	"\334\027\006\374\343\035\322\367\2404\204wHo\020\372b\235\\\215"
+	.ascii	"G\373>\3417\016\307\235\036\307\331\264\243\3614-\304\314\031"
+	.ascii	"m\304\032\277\353)\002\345\334\303\314W\316\314\2438\356\306"
+	.ascii	"\357\374\271d\346*\267\242s\223A\250\250\350V\231S\003\305\354"
+	.ascii	"\256\215\016^\223\035x\217:\275\215\263if\316\271\307\211\227"
+	.ascii	"T\217G"
+	.string	"\373\205\340~.\334\257\003{\366\016\351\317\r\334n\327\355a\\\214\327\245\220\3631\347<@o\n\024\334\214G\335\214\323\265\327y\231\354u$\262\352|\342\344l\364qO\300=\0014\214\313\313\231\304N\346\250}\256\203\322\344\222\351sctIU=\352\300C\341\376#~\";\017J\345\334\213{a\363\006j\215\334\034\346\"\344cc\207\024\244\033\356\021k\356v\313\222\330\t\004\207]\316L-\276\305\235\036\347X\032e\346\334\016\245\373\310\343<\213\303\335\262d>\002\261\321\200\034\035\r\345]\316\314\"\241\"\036\347\035\034\253\024\365\032|h\024\2311D\352\255\210[\311\333\276\n\212\020\250G;\005\354V\374\212;\235\255\333\325\034J\243fY\271\2313\223\347\032\255\342\322\036m'J}\234(\355\0230\232\002{\322\203\322~J\3613w\032\3404\334\242\231\017j\025\347\303\310\243}\001n\237\322\005l\345\tZ"
+	.ascii	"\334n@\352yn@\332\030\177\360\016\251\013yP\352Y\036\224\212"
+	.ascii	"\371\230\223]\244TV>\313\231\t\344\023s\343:{\324\311\336\235"
+	.ascii	"8\263\235\314\233\264\210\tz\347\230\307rf:\031\232\263\321="
+	.ascii	"\201\036\367\004zmE\214OR\264\0377\323;\244\330\203\322\264\373"
+	.ascii	".\351\366\261nG\322!t\267\207n\337B\302\225\356\346\351\276C"
+	.ascii	"\272\235H\367\272\357U\267\307u;\\\267\267u;Z\267\233u\273\002"
+	.ascii	"\335~@w;\351\366f\267?\351\366\262ngv;Y\373t7\\w\243yyyy\335"
+	.ascii	"\315\354\356]\351\026@K\313\276W\034\274\360\232\234=zc\270T"
+	.ascii	"S4\302\224=z\255z\276(w\274y\364\302po\364n\260\315\230\273\361"
+	.ascii	"X\357%N\352\351V\351\250\331\r\211r\303U\336d\n&\304\b\325\255"
+	.ascii	"\3217\271C\205M\313\326\243\227\306\245RnM\251A\325S;rf\2708"
+	.ascii	"\341\230\275#Oo=\256\324\217\351\220\211\312t\217\336(\016su"
+	.ascii	"pV\260z\\l\312\244\255\301\215\277\340\235\034\224\336\3430\t"
+	.ascii	"\235V\225\373t\215W\210\235\r_\267\330\327X\234\243A\214\024"
+	.ascii	"\27439InL)\003\206\033\013y8n\034\t\2344j\3117n|G7f[\356\372"
+	.ascii	"\335\270\030\235\2276\217~\033\374U\243\030\203M\316\0310\\\272"
+	.ascii	"\330\004\361\001VE\354\321\306\306O\223\242\313r\007\031\214"
+	.ascii	"\346LN\230\261*l\354\372\3178\331]\303\343G\221:'[\336H\373:"
+	.ascii	":\237,px8\036\245{3iX\335S\362\211\333\207\005w\021\272R\216"
+	.ascii	"L\036\265\301\235O\346\267\b\215x2\317\345\307\364HQ\203s\267"
+	.ascii	"\223\241\334\254\241c\3048\025\225\035\362\321\017\223\243\005"
+	.ascii	"\206\033o]_\334\371`\232n'{ \322:R\365h\257\351\234\007\002\246"
+	.ascii	"\356\315{\351\227Kf)W\217v\361\321)\345\314\254\236\277\345\265"
+	.ascii	"\214_\224\217\266\317\006n_\021w\032\007\303\371\\)2\271\262"
+	.ascii	"\303=\342\355\305\036\313\237K\013\302\302\262|\r\356\374\267"
+	.ascii	"\037k\177\342\315\267o\362n\376\\\376\344#]\232P\221\316[\f+"
+	.ascii	"c)\352\366g\317\366\303\331\366X\334\371n\355\366N>\212?\317"
+	.ascii	":PR\305\016\255B\302\005&E\255<\333\257\241\275\232\232&l?\345"
+	.ascii	"i\360\360\204\354\200m\212\035\276\"\204-\310\027\334\375j\375"
+	.ascii	"i<PiG\304<\372U8\334X>\331\262\340\247\322N\005\026\003.\r\267"
+	.ascii	";\333\314;\233\016\035\242\305\252\211\023w\372\004wJ\206{D\224"
+	.ascii	"g\376\023-hP^\212;?\3127EL\360Q\236\354\261z\212\314\\C\007J"
+	.ascii	"-\r\216\036\257#bMR\264\323+\214.9J\211{\263/\313<<t;\332\220"
+	.ascii	"<\332i\r\334)\022w\232q\367\342\340\356\245\301\335\023\203\273"
+	.ascii	"\307\005w\017\016\177\350\265\341\356\241\341f&\351~/\247\362"
+	.ascii	"H~G-\216\f\253G\037\354epg\267\375\221\234#37=\b\226b\220&v\362"
+	.ascii	"u[\332\2751\274\363F\272\177\210\347}\020\317\362U\261\225Yy"
+	.ascii	"\364\363Q\177\221\253\346&#\016\030N\325<(\375\037\017\304\235"
+	.ascii	"C\337\325=#33\035M\327\2232\b~!g\037J=/\317\207\322\356\355\300"
+	.ascii	"\335\273\372\255\313\254\362&\367h\367h\274\026\232\207\237\007"
+	.ascii	"\017\036\023<8mp\243bp\243q\270\237c\274C\372\313!\237\036@\214"
+	.ascii	"`\036m\224\n\266\301\355.\363+E\316\353\326\204J\353\321\253"
+	.ascii	"\366X\276's9\254<z\323\036\013\343Q]\035\037\3555N\266\023Uu"
+	.ascii	"\205\207\231+\245\357Yw\237]4\234sv\037ZJ\302\356\362rI\3243"
+	.ascii	"Gc\215\214\206\276h\b\240Ym\271Nl\203\211\003\206\353\274S\356"
+	.ascii	"\031s\ry\235\334.Hr`a\202\273\277;\315\306d\316\271\252\307\314"
+	.ascii	"\311\247\235\264\333\333{\356D\335<~]\201\356F\273;\2026gc\230"
+	.ascii	"\247\032|$\315\230\343C\356~\346|\334*b\260\245<n\305\200ln\345"
+	.ascii	"\342\321H\021(\231\267\212\310f\316@\371x,\242\310\312@\310f"
+	.ascii	"V\346\030rJ\317\314\255b>fe\240|\314\306\017\310\343\226\022"
+	.ascii	"\3314*\201\220\315-enn\345\237|4&\241\2169\t\224\233[gr3K\371"
+	.ascii	"\203lf)\221\315-\">\003\324\221\252*0O\037N/C\0363\325\224\016"
+	.ascii	"c\362\347\211df\34519\373\231\214\234T g\035Y\3111\306\030\\"
+	.ascii	"\355\351I\365\204f\314\362\241\251'\256\254||\"\221d\345\214"
+	.ascii	"\344))O\221(2\2379\210?\213=td)\0319\0230\225s\321\3633\347\\"
+	.ascii	"\3149\373\222:\2309\343\370A~MM\345\274\024\232\312:\212k2r\376"
+	.ascii	"32jJd\223+\353h-J\363+\317`\026\375+\217\331J\342f\261,K\245"
+	.ascii	"\301_J\033h\036e\356\324\2501$\253\371\304\347\244\f\027\026"
+	.ascii	"\363\030\207\007\03333\003|\230VS=\312^\253\367\244\2060#\263"
+	.ascii	"/Y\031\256L\343\321\353\244W\266\026\343\321\346\020\205\333"
+	.ascii	"\251\354\370\311O^\220_T\256\330\023y#\376\354B\303\342,\271"
+	.string	"_W\310ere\270En\223\233\344\022\271G\356\330\rr\221\334!\027\354\206]\257k\344\316p\225\270\363\212\275\231\2762\356\f&q?\247c\346\314\230w\361/U!\300n\370<3e^\313;\263\213\274]6>\034\271\371\306`3g7\226\365\\nyvJ\226|\022\343\233\257/^\261\367\361A|^k^\313;0W\314\307\374\225\207'd\316U$\300\236I_\261\017{-E\016^E\257\345\235\231Gq4\022`g\306\312\274\2327t\277\346\343\370\230Y{\034:\234\314\237\313\\<\263"
+	.string	"\230\322k\3719\256\330\367\300{%W\354g\3504\"i\235\322ky\347U\304<\315\237\376<\313F.\"\260./\344\212\375\327'\35192s\321\347\005\346\265\274+\022J\321\344\230C\026\241@\214\360(\322\\\273=.\327\365\341\316\373\343\356\370\033\256\016*(DF\360\270[&d$s\242\300\030\271?.\324\265\001\246\b\215\031\356\212|yq\307%F\257\026\326\230 yO\262\260\320)W]\\\275\246/VO\016\211\021\247\030\356\234\256\233\243\310\217)\346\243\235c\343\342\270Wi\224QI\330\r\235\004\342\003\022T\2600jW\027\303_\373\341\304:d:\261\264\266,\f\026>\355\312\201\223\223S\211\022F"
+	.string	"\201"
+	.string	"\"^\225\232\226~,\332\225\005P#\300\002pM:\001\024\302`\021\324\300\340p\025\256.p\223(!A\t\023N\2766QA\210\nB\244m\242\202\243\243\nJ\034\341.qt\333N\002\301@\273B\230\242]\331u\350cU"
+	.ascii	"\206\355\b\302\024\303\265e\203.\326\025&\020\233\226:\004\207"
+	.ascii	"-\370~C\242\213\240\nB\246\023\304\246\245\037\025mP\030\354"
+	.ascii	" L\221\376\332\037\212!a\n\236a;\002PH,\201i\b\203\203\001X\365"
+	.ascii	"\305\212B\230bm\177HMD\334I \b\030\256JH\302_\007A\255P\205g"
+	.ascii	"U\340\272\202\005\340\257\205\222\322\357\004P\260uZ\321\226"
+	.ascii	"U\203M,TXQ\254M0HPU\214\300Bg\005\n\177-+\f\342V\025A\005*\f"
+	.ascii	"\216 d\201i\260\211\275\304\026C\254zB\204\n\235\023\"T\344 "
+	.ascii	"\245,\273\016\221\220~>\240\210\340%\252/V$\226\330\002\263"
+	.string	"\352\n\f\276XQ\260\304\026:,\261\205\217%\266\270\253\322\017\310\366\230\206+\n\270UE\214\360\265\360[q\002E\006\034Z\265\304Q+\f\372\326!\261\375\r\327\246\245\265\325Q\241I\351\256*\217\013\035x\260\266\277\025:\255j\242\025\006\211>\266\211i\210b\270\"\005_\004}` \375\326\0259\255\217\352\353$\020-\2208lY\021\254\352\264\266\304% !\221\t\250\252\276\341*l\201IU}\354pe\211BU\305H\302 \013\252\232\262\302`\023\253\252>!S\220\r*\255\252\232\323\252?\235\004\202]\233`\264\022 \255\303_\022+\201\021\333\006[\030\021\205.$p\"\n\203J\022\220(\241\2260\341d\264\"\021\225\200\302\240\321\220%\032Q\320:\255B\245\237p\270\266\302\240\212\364[\207Im\223\252\016\360b\0356\251j\332\262A%UM\177\355\017IU\323\341/\t\210\256.\004YUMY"
+	.string	"2)\241\253\372S{\204.\202J\031\344\264\235\004\202\330\264\244\002\201\277\007\232\251i\035\032\265LLC#\235U]\021b\202\020%\210MKAD%&v\035r`\325"
+	.string	"V\225\005\261iIg\310\304\nW6m\225\210\354\272B\310\024l\201k\273\242 6-\001\320\252.~$0\005}M\001\005'>\224\020\002\007\030\b\002(\204\301\252LC\030.\214\330\341\372\"8D2\022\006\177KF\300!k\004\342"
+	.string	"\027?\022\202\255\323\006\255P\005\261i\211G\211\211I\003\265\327\314"
+	.ascii	"\226K\250\342\2347\356\262ap\226\215J\2426-1\267\273\234\314"
+	.ascii	"\002\001P\221\347\022.,X.\\\007^`8*i\305M\r}\341\260\332\332"
+	.ascii	"\274My\363q\003\0032\344-\213\016\027,N\240t\262\224It\220U\252"
+	.ascii	"\334\266TJ\027\236\263/K+}\333.\333\nRljx\224\350^\311\t\223"
+	.ascii	"f\307Y\036\276k7\202/\250\"\301<I\002\035C\314\f\315\310HZ\230"
+	.ascii	"\0162\n\020\b#b\034\310\226\017\022@\025=\2132\211\250FD\222"
+	.ascii	"\244 \365\3328g)%\370\364\021\211\227:\225_\301\320G\036\204"
+	.ascii	"R'\301\221]\273\n\226\007T\215\226\241r\007$iE\225\260q\230\237"
+	.ascii	"}!\353\303\360\340\372\177M\340\3060%(6\331\213j#u\025\004\310"
+	.ascii	"\007\241\375\332\303J\346}M\n\250h\257\203(\210\210\017P\315"
+	.ascii	"G\203b1\242\242\365\202\313\fjeD\025u$\177\377Y|J\241)\226\r"
+	.ascii	",\230\260\220\345\212/QL\316\323\003\356\217\321e\226?h\322\347"
+	.ascii	"\0056m\306\211\005W\377s\003\272\025\271'\023\347F<\356\374\230"
+	.ascii	"n\311\251L\216zC\270\034V\020\202:\376\310\231w\275\235\250\345"
+	.ascii	"\313)\206\236!\225\312&\177\221\023\024\235l\275\250\032\331"
+	.ascii	"\366\322X\tCU\021l\267\324}\0316\255dHi\230\022\361co\344\260"
+	.ascii	"k\344\203\313prJ\276'\362\352B\355\312vm\236,\232\033\277L \334"
+	.ascii	"/\351\333\201\266\365\202\275\342\327aX\n\244\322\350\023i\256"
+	.ascii	"9^\233+\214\276\277p%c\303\007\3766\f\321\035j\340\300/\254\367"
+	.ascii	"\017\235\323\fc>\372\2659y0E\016\026\247F\205\317G\222d\341\n"
+	.ascii	"u<g\264J\201\200-\201\355/\26758\211VtM`:\017\225\025i\202\257"
+	.ascii	"\177\220g\230\033 \267\035\201\344CJ<\n\231\322:\001\236\005"
+	.ascii	"\371&\242\177\357\305\254<,\030\240\326|\321\024\003eL]6\325"
+	.ascii	"7<\350x7BS%\037\tF\242\037|\330\001lP\376 \177N\033\350\252\275"
+	.ascii	"\303k\221'@\222TB\354$y\314\303\267\246\311\2431C<\346\275\335"
+	.ascii	"\234\037\201\232\203\005)g\n\340\214\327\277*\036\013A*\257\373"
+	.ascii	"\242\352\210J\0071x\250\363\366\006\001\223\330\037e\323\276"
+	.ascii	"n,\026\361\t\214[a\030\360\236xo\303O@\001tFg\241\226k\2045\366"
+	.ascii	"\301\361bCaT\272\361\365\036\207\326\"$U\353\257\222`\303\021"
+	.ascii	"\302\263\227BqLa;k3\270\3271\215\206\271\023T\031!_5\236\364"
+	.ascii	"\327\316\0238\300\020k\003\210T6\001\004c\212\341NTdo/%\230_"
+	.ascii	"\311\001\262\006\360\221\026A?A \215\")\036\206N\\\360\202$z"
+	.ascii	"Gw\263(\253\311Q\206\031b\215P\362\340\006A!\3675\232\025\272"
+	.ascii	"\314k\225\241a\271\260\203\321\212\262ay\214\345c\273\240\020"
+	.ascii	"\214Y\301^\"\004\230\374\005\276GZ\244pi\251I\352,\321H\317'"
+	.ascii	"\377\324\fEd\351\b\244\206\300i\304y*\253 6l\245p<\324\270\333"
+	.ascii	"\033TP\213\347=C\307l\325N\324K\030L\362\025\023\232\205\\-\264"
+	.ascii	"\342\211\224\3009\276?\0271?H\367\311\220seLB\245\036\001\b\315"
+	.ascii	"\214\345\254j\021\277\343\347\360F\3553\343^e\355-\205\365\204"
+	.ascii	"\200]g\032\017J\335\235\"\273\355\265\276\252\020\270OH \304"
+	.ascii	"E%\t=\025\322\020\007\311,,\020\243\355\307\0222E\223\351\317"
+	.ascii	"@K%R{\350\345\300\247\212)I\243\302\321C!E\033\310\344w!\336"
+	.ascii	"\213\007\037\276\236<\227\346\213\321\243 <@m\345\210\246\313"
+	.ascii	"\335\237\344\033\323J\"\030\034\326\236h\374)\242\321\274TL\315"
+	.ascii	"\033b>\2325"
+	.ascii	"\\v\372\256\274E\002\277\261\300\037\341\036'\230\337\266%\242"
+	.ascii	"x\355S\212\360\340\221\324\371\016{\346\300\3633\373/'\200,L"
+	.ascii	"Pjs#\020@\372\342]E\023\366\020\344\326\261s\267\366\344z\317"
+	.ascii	"\231\344\330\213\230\252CZ\361$5\035\340q\325krTugaR\331\325"
+	.ascii	" \241v\326\361\334\221\245\270~!\207\331{\354DC)\232*\334\007"
+	.ascii	"/\233>:n\206\322\231\233\227\203\226\214\326\246\231\021'[\364"
+	.ascii	"\257\264d\341\331Wb\024\024\330\3615\247\275\025\"\221\330\352"
+	.ascii	"*\273h!\022X\272f(\345\215p[\344\324j\361:\232X\031m@\242\300"
+	.ascii	"\024\241w>\013\302\350\262\375\207\274|\342\n\223%\261\016\n"
+	.ascii	"I\355iox\tW\320\311\253\bR\247\337\253\206\371\n\007\314\206"
+	.ascii	"\221\001I\220\237\241^\207\007\031\007K^\306O \226\031\235A\340"
+	.ascii	"\345\202\256\020\244\3732\222\231\3159\365\367: `\210\003\375"
+	.ascii	"\232\375\355\210\337\264\f\226.\2277%\017 \3723\215\331<1\275"
+	.ascii	"\230\274\245\263lQ\372\020\223\267\0236\206\335\313y\034\001"
+	.text
+	.section	.gnu.lto_.symtab.70d1807f8746599,"e",@progbits
+	.string	"gyroSyncCheckUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\001"
+	.string	""
+	.string	"gyroSetSampleRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\001"
+	.string	""
+	.string	"gyroMPU6xxxGetDividerDrops"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.70d1807f8746599,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
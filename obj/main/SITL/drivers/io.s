@@ -0,0 +1,772 @@
+	.file	"io.c"
+	.section	.gnu.lto_.profile.f4518a5190bc6c92,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.f4518a5190bc6c92,"e",@progbits
+	.string	"(\265/\375`\025"
+	.string	"\275\005"
+	.string	"\244\b\t\001"
+	.string	"\026"
+	.string	"\370\216\225\261\004"
+	.string	"\001\276\237\344\233\016\002\002"
+	.string	"\002\001\002\303\365\340\332\r\002\002\002\002\001\003\377\223\325\230\004\004\005\006\224\364\237\314\007\b\t\317\253\250\341\002"
+	.string	"\n\271\225\361\330\017\006\003\002\004\013\247\204\361k\006\f\277\225\306\207\003\r\356\242\353\274\n\016\233\204\330\275\n\b\017\302\311\343\254\r\004\002\005\002\001\002\006\002\001\020\311\256\332\347\002\002\021\324\314\220\352\022\234\253\215\342\007"
+	.string	"\023\024\240\342\234\212\n\025\240\342\234\212\n"
+	.string	"\022"
+	.string	"\0303\270\313h2\321\026\016"
+	.ascii	"\340\f8\212\315S9\t\264D\231\032\203\030\256\202}.\233=5\036"
+	.ascii	"\330\342\262\2279\333\323\300\020"
+	.text
+	.section	.gnu.lto_.ipa_sra.f4518a5190bc6c92,"e",@progbits
+	.string	"(\265/\375 \264\375\002"
+	.string	"\024\003\250"
+	.string	"\024"
+	.string	"\001\003\001\002\003\004\005\006\001\002\007\b\t\005\003\n"
+	.string	"\003\013\002\001\f\001\r"
+	.string	"\001\016\017\003\001\020\021\001\003\022"
+	.string	"\001\023\001"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\025"
+	.ascii	" \340\234\003s\024@\3001g\200\300V/v\003\021\020\003\202\003"
+	.ascii	"\034\203\311\rX\001\343\300``\b\030\007\006S\231\366\022\334"
+	.ascii	"\006\332"
+	.text
+	.section	.gnu.lto_.inline.f4518a5190bc6c92,"e",@progbits
+	.string	"(\265/\375`y\006\005\016"
+	.string	"V\021<4Po\322\001U\226ao\2046"
+	.string	"Q\023"
+	.string	"\213\335\\U\005\277X)\177\004\001d\301b\254\330\321\244\321\246\032a\273\231Y\335\3053\370\330\260\204l\262\211\2242\245'"
+	.string	"0"
+	.string	"2"
+	.string	"V\277\243#\037\021\350Y5\352j\235Z~m\365\346}\177\323\365\355t6\003\204\260\301N\373[B\b\241\332\006\256<\001\022\027$\227/\353U>\260\370\317\311S\250\024\242\032\317\216\032}\027\363n)R\222\002A9\027sn\246-*\024\033\367\363\266\324\313?\301\275\\\b$\223\225\020\306\001\030l\337>\003\034\036n\274Zz5^\316b\227\225\277\307Y\251p\007\na\230.\276d2;\"}\2408\016\017\222\351\255\217\220\017\001.\3304\306x\332t\2141R&\260\375\215\372\312[\007\262g\027\201L\2348c\271\316\364;Yb\371dT\026\350dDE\207\303\245i\\\250AU4EbA\n\n\225\345\320\"\231\241\232\007\022"
+	.string	"t\025\004\222\220b\004!&\210B\211H\242\222$Qb\220<\206H|\230\034M9\202\223\371\263\271Ia\204|\261\003\342\225\354\212"
+	.ascii	"\3662\373G\022\255{\223\303\200\353\333\245\230\275&\332Bf\333"
+	.ascii	"\003\263\204\201M\253\206t\305K\2453\002bl\250\225\247\267\334"
+	.ascii	"\tt7\n\026\340x\205\267+\376\223\352\335xcU\265r'\377\233\306"
+	.ascii	"Q\017\0372\220\245\025\"\0025\323\3000\352\302\252\241\r\247"
+	.ascii	"\004\255\206\346\216B9\006TM[\232\223IMr\276\335l\\\363\204\277"
+	.ascii	"\2619\024\362\203\031UL\203a+\213vro\317\b-\236]\231\345b\247"
+	.ascii	"P\031\307\313h\326M*\310)\205uy"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f4518a5190bc6c92,"e",@progbits
+	.string	"(\265/\375 \350\315\003"
+	.string	"\022\006\024\036\240'\351\377\243\377\342L\252\252\306\375\377\337\374\367\342\263\377\377\375mk\215\266%\215l\231dLJ\276\201,\020\006H\357@\374\245\b\002I\352YO\371\"\207\225\374d+>1`A|A\275\232\346\303\360\303L\026\031\247je\375\326\253\347\201\213\020"
+	.string	"`\b\240F\023u\013\214S\031\254\346\240G\r\021(f\211R\346%\b0\004\214S\031\f\347\020T\306\332"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.pureconst.f4518a5190bc6c92,"e",@progbits
+	.string	"(\265/\375 A\335\001"
+	.string	"\022\304\r\027\240)\035?\360Os\377\377\307U\005\321\376\267\377\355\177\373\177\"\204\354\237s\324L\346.W\271\311E\356q\215Y|\304\034\2460\203\t\314\347\232j\246\317\0363\203\002"
+	.text
+	.section	.gnu.lto_.ipa_modref.f4518a5190bc6c92,"e",@progbits
+	.string	"(\265/\375`U\001\275\005"
+	.string	"\202\306\024\035\240'\351\377\347J\374\377\277\253\252F\216\252+#v[KZ\2235\362\t5\273\211\224)'-|\"$\256G\210\210\227\345E:a\220\036J\341\200\327P(\025<R~\264\253\362\230\030@\347\030h"
+	.ascii	"\314\314\254\365\235~\337sn\345\252\374\355\310\344\036\002-"
+	.ascii	" \320\302\262\271\rf\262\261\326\310p\003u\335\2708#c\374r\200"
+	.ascii	"\f\253N~\254)\202i*A|\230\n\006\026\0260\034\201\tS\020aF%\214"
+	.ascii	">\2171wV\232\004\266R\031\340\f\023\251-Q+\360\013\353]\022'"
+	.ascii	"\360\336\306\3058\334\323\320^9k\312p1\307\202Q\333\373\230\325"
+	.ascii	"\342\342\271\001"
+	.text
+	.section	.gnu.lto_.lto.f4518a5190bc6c92,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_IO_Rec.3.f4518a5190bc6c92,"e",@progbits
+	.string	"(\265/\375 \364\245\006"
+	.string	"\002\r/4Pm\222\016$\243*\nE\310\210\244K-,\312\3174Y(\320\316U\230\231\335\r@\007\226\340]\262\327UU\325U\025\375\356I\250\371z\035\373\273YBd\n\257bw8\257r\037\350\201\250\340\202k\250\024\030\\\007~\034g\363s\360@\367\360\036t\232\230m\327\215@\242M|\f\261\206\361\275d\273\276\245\266\2152I\0318\311\254haI\224\251\244\343\357\017z\315\317XK\021\005\310\2748H2#\302\006\231N\377\375(\bhk\0235H\224\310\006\305\310Jft\307\nP\2352\r\240:\265\214Ze\326mH/\036\027*\242Q\250\f\223\220\2313\321\210\324[\377\202\377\340\267\b\007"
+	.ascii	"u\bX\347\220\255\302q\r\017\303\204\"\374\314hj\347\023"
+	.text
+	.section	.gnu.lto_IO_GPIO.4.f4518a5190bc6c92,"e",@progbits
+	.string	"(\265/\375`\036"
+	.string	"\265\007"
+	.string	"\302\01656Po\322\001 \316,l\f\246\322\310 mD\277(ka\303!\364\342\240F>\312\007\002\377\tF a\006\250\252\210(F\027\271\363\203F\241\246\214X\262\211\334)\005\361r\346l\342\005=\262#qI\006\350p-4@\216\364\300\215\306\361\241#!D\214\022ffvjUS%\310\024d;\342\"\230\265\273\t~H\305\204\345\361\347S(f\313\334\311\236 \247\033\366\251U\315\372\355wT\265\2222P\262\233qjY\224g\"\331\376\330\031\333\316}\2638\300\256V2\331\235\b6\260\376l\373\037/}\214if\307\350\242B\302 a\331\235\320\363\002\325\237\365\200\352O9\216\335a\376AN\2314NB\242\213\273\213\302\356\332\205D\243[o\273\300\366\201\355\221\013"
+	.ascii	"2C\027\r\f\304b\224,`\303\204\356\032\0161\201M\032\343\016A"
+	.ascii	"\n?3\232\332\371\004"
+	.text
+	.section	.gnu.lto_IO_Pin.5.f4518a5190bc6c92,"e",@progbits
+	.string	"(\265/\375`*"
+	.string	"\335\007"
+	.string	"\"\01766Po\322\001\240\234*\n`\303h\236\231/\026\240\006$\220c\300\\\275\205\025\371\b\216\201\377\266\030\201\204\031\240\252\"\242\030]\344\316\217\202\222\032\016B\310&[\246\024\021Ss6\021\203\036\331\251\300\344\003\214\300\034  Gz\340\246\300Q\242#\341D\214\022j\346v;w\260\271\217m\212\253h\327\3562\370%\f\213K\344\317\277p"
+	.string	"\244MO\366\374\250\373\260O\255\033\331}\376JY\"\030\203\230]\216\323\314\276<\023\211\355\314\326\330V\265O:J\366\231q\201\335\321\210\313\356\\p\302\365\347y\331\366Kn\222Y\323\031\322Q\225N6Vdv'\f8A\365\247\037\250\376\034\310\265\253\346?\345\224\311\203\005\024\322\270Z\r\273k\005\205D\267\273m\004\333\n\266[\002\f"
+	.ascii	"2\003\302\260\2268\0343\203\031c\273k8\307\0046i\214\016L\020"
+	.ascii	"p\302H\265b\022&\031"
+	.text
+	.section	.gnu.lto_IO_GPIOPortIdx.6.f4518a5190bc6c92,"e",@progbits
+	.string	"(\265/\375`\b\001\035\r"
+	.string	"\306\231YB\020\221\223\016\255\025pV\021j\025\276\034Su\343C=Gh;0,W\376\251C\331a\254\346,\fk\025G\2352\212\nY\215G\002"
+	.string	""
+	.string	"T\360@\201\022<u\253\024\034\n\235j#\204l)eJ\001H"
+	.string	"C"
+	.string	"H"
+	.string	"\242\247lvI;\022\334C\270\224\264\330\330]\354\300\tP\177\372\001\324_\216\370vM\334|\f\327\327@!\231p\034\236\352\340\205C\021\200\363(\202\031._9~\270\021\304\252cw\215&\334\206\373\335\366\003\333\013\354g\b\326CW\357\376\247hMt&\032\023\375Lu\"\306"
+	.string	"\215]\r'\034\013\363\\\230\360Y>\n\371\n\277\030\031)v\367\n\261\257o\366\205\366U\256b{'r\001\273\240P\213\335\216\201\025X\177\356,\333~\211\251%\022\017\036<\271\312\347W\256)(\244\022\323G\316\316\302\202\265\273\r|\022H\005\277\304\237\317\241\376\252\374\350\t8\030!\225\016\2362\307\213\017\210\264\b\365\262\303\211\210%\306\b\336\260;\017\246\b\373\272\t\262\025\035\331\006\355\241\3116\030G\373\270\260\321\"`\0236\020$`\036\032\007\323\024pF\341C\303@\262L\303.\333\356:\327M\220\023Ft\222V\346C\310\204\232k~lk\272\243\223\036\315\264\362"
+	.string	"\356\022\205\231Y\265\220\230\266\373\205z\026"
+	.ascii	"\237\033\307\026\201=\266W\017M\263\n\2774\315\245)+\240\341"
+	.ascii	"\321\025^,\031X+\271\220\007\334\030l\312tP\226\274\232\036\031"
+	.ascii	"#Ae\016\332\215\244\004\224\252\006\232KA\001"
+	.text
+	.section	.gnu.lto_IO_EXTI_PortSourceGPIO.7.f4518a5190bc6c92,"e",@progbits
+	.string	"(\265/\375`4\001-\016"
+	.string	"\306\032^B\020q\224\016\255\025p\311#\265\246+\360o|\230{\234S\244\365\037\\\005\357\327{\025x\310\355\356\261x\033(\216\210\377\bM5\216X\006"
+	.string	"\200\002\360\214\002\002O\335\312b\307H\325\b\021\262\367\2262\245K"
+	.string	"I"
+	.string	"K"
+	.ascii	"v\352u$\270\207PyN8v73\360\001\361\360]@<\324\021\337\37647\337"
+	.ascii	"\364\247\"\262\361\3412\374\375\206\b\365\3418\\_\003\025\227"
+	.ascii	"\002\200"
+	.string	"\353\274\003/.~z\202\270\223\314\313\301\356:?\334\206\033\336\366\003\333\n\354\247\004\351\367\322\372\356O\217\253\344R`\306\256\206\226\216]A\030&\374\226\243J\256\302\320\245\206\312\356>\305O$Ga5\275\220\330\230\022\033\363\315\306\244}\226\237\330\336\231<\300\356h\305\213\335n\201\023`\207\3560\333>\351\245-\372R(\036:\331\262\352\323\237\376J\"\224\207u\224E\336\342\002\266\273\f|\026\0304\277\004\005=\352\b8\031+,\234l\351\216\030 \020j\223\230\332!Dj\241q\2229\354\256\223*\302\376[\035\3311\215\305\364\005\323\021\246!\f\232&\r\222\3214\331\310&\304\202f\023!\223\240\201 \222\201lF\262\f\001k\023B6Y\005M\333d\230\216\363\267:\262\256H!\275<>\254\2602sLA\2661\275\351\017yH+\216v^\324K\377q\247\"\324\250\327\t\205\265\335\252\370\024\006\035"
+	.ascii	";\013\255\273q\f#\f\217\255\320C\323\254\302/Ms\232\032s\314"
+	.ascii	".\306\262\004\272\216\356\365bI\312Z\311\205<,\326\240\023\246"
+	.ascii	"\205`\276\305\022\2351\021\007X9\342\3254\312\030\t*s\320n$%"
+	.ascii	" \315\361h.\005\005"
+	.text
+	.section	.gnu.lto_IO_GPIO_PortSource.8.f4518a5190bc6c92,"e",@progbits
+	.string	"(\265/\375`4\001\025\016"
+	.string	"\006\233^B"
+	.string	"\223\223\016EJ\262\325A\362*\031X\024\254\320\367\037\262P&\303\317f\201&h\270f\3452\3141\374\263\020\3058\n\037un\200\342DUU\002\350\200\2020\346\177\226\200\332\252\331\361\t\331{K\231RL"
+	.string	"J"
+	.string	"K"
+	.string	"\233\215z\035\t\356!l|L<v\027;p\002\361\360}@<\324\021\337\37647\277\364\327\2622\003\304i\370\273\016\225\023\210\353p}\016d8\226"
+	.string	"\234\347!\310\341\342\246g\210C\311\264\036\354\256\023\304q\270\341mC\260\275\300>K\020\246\337K\353\273?A,\0313\006^\354nX\371\330\024\214a\302\217\371\311\344+\fgp\\\305M%Oa-\355h\331\335\022[cbk\276\331\232\264\017s\024\333\273\223\013\330\035\235\200\261\3331\260\202\353\320\335e\333'\375%\017\225\262\342\311\225U\237\336\364\367\242r\372\250~\362\310[`\270v\267\201\317\"C\346\227\250\240?=\001W\303\005\246\223+\375A#\004B}\022S=\210H17P\262\207\335yRE\330\177\273\273\326\221\035\323WL[0\035a:\031'\035\262\3118\030\211&r\201\243I\300&p\"\214`!\032\t\266)\340\214\202\210\206Y\3102\r\323t\235\277\325\2215E\022\251\005\362\301E\225\233_\032\262}\351K\277\350\203Ju\324\363\242Zz"
+	.string	"7*B\215j\231RT\333-\023\237B\r\033"
+	.ascii	";\013\255\273q\f#\f\217\255\320C\323\254\302/Ms\232\032s\314"
+	.ascii	".\306\262\004\272\216\356\365bI\312Z\251]\b\2350-\004kx\022\242"
+	.ascii	"s\374\312\021\257\246Q\306HP\231\203v#)\001i\216Gs)("
+	.text
+	.section	.gnu.lto_IO_GPIOPinIdx.9.f4518a5190bc6c92,"e",@progbits
+	.string	"(\265/\375`\367"
+	.string	"\335\f"
+	.string	"vYYB\020s\223\016\377V\20103\271\2200^\212\206\367\320\bk\243\342+V\355\242\211\301S\314\337\261ij\b\335\345\021\026pJF\001\223"
+	.string	""
+	.string	""
+	.string	"\021\204!\242\224g\333\225&\334\032\200\036\"d\357-eJ\001H"
+	.string	"B"
+	.string	"G"
+	.ascii	"*\276B\263a^7\202;\210\030\225\026>v\327\0229\201x\370> \036"
+	.ascii	"\252\210k\177\232"
+	.string	"\232\237\362\347\200\205\206\207\333p}\017lp(\002p\333C\020\003\343\242\347\207\353dN#\273\353\364p\032nx\333\020l/\260\277\t0\035\337\375\357\245\365\245S\323\247\246\0368\f\224vWJ@\366\006\224a\302\177\371\b\345,<\361 \265\354n\205bW\327\354\312\366\323\276\313C\332\273\315\005\354\202Zb\354v\f\254\200:tG\331\366\003\361\236T\221\216\2468\352\365\242'\313\f\225 \037\331\344/0jw\033\370.N,\370$\016}M<\214\372\321\023p:R\270p\262\244\244\032\237\017\352M|\312a%\307\313\216N\376\260\273-5\204\375\267\n\262_z\n\330\225&\311`\227\245\311JN\256L\202E\341\212`b\221d\032+S\300X\205\222\314\272\200a\231Uu\234+\310\030B%t\322\213\036\342!\324!3W\375\330V\365\bG\267\227z\340\206\211\223\236\224\341\304\226%\003\310\253}M\b\023"
+	.ascii	")\023p\234\216\237\330\336\277\241K\232Z\032\b<\032B\213 ~\023"
+	.ascii	"\222kx\327&JS\361\202\n\3525^E&\b8\021I5\030\225\216+\255\202"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_IO_EXTI_PinSource.10.f4518a5190bc6c92,"e",@progbits
+	.string	"(\265/\375`$\001\375\r"
+	.string	"f\332]C\020s\223\016\3776aEL\220\3210^lg\247q4\305aT\271\227\241\356\016\267\347Fi\377\236\267\273!4\206\215\212\300\246dx`\022"
+	.string	""
+	.string	"\024\340\016\024\005<\333\256\300\332-\235zP#\233l)S\nK"
+	.string	"I"
+	.string	"K"
+	.string	"\246\201\335\t\356%R!O\310\356^%/\020_\301\023\210\257\324\304\267C\315\315\377\351\020\206\364\211\270\226\303\006$\034\"\016\304\025:\320\301\261\020\300}\340\201\0374\356=G\034(\323z\260\273N\021\367\341\256n\033\202m\005\366_\002\020\246\365\335\237\033"
+	.string	"\036v\220\004\331u\371\210lMeC\205?s\324\312c\330\002\222\202\331\335\303\270\247\362\027\326\323\247bsVl\3167\233\223\366en\332\336\261|\300n)\246\306n\267\300\t6\257\334ml\373.\036\2639\352{\023\260xQ\245% m\261*$\335\b\0259\312\024>\003e\263\273\f|\031\0322\037\305\005=\352\b\270\036-d<\371i*\307\210\204\232%\246\206p\3411\343\003\224C\354\356\223\372b\037\256\226\354\230\266b:\306tU\245\003\031\2266\351d\330\225\242\235d\3004\tW\005,\002\312e\242\245\\\035\003\316,\234h\027\206,\323.N\3479\\-y\203)\205F\275\367\221\021&\021\331\271\245#\333\226\376\364w\b}5\036\375\300JIn\232\030\365)\016+>\3719@\302\033"
+	.ascii	"0\013\355\325\rO\261\275\207\243=(\b\3214\030cq)V$pu\324\256"
+	.ascii	"\026FH\226M\256\341\215\330(N\304\023B\314\226\220u\306D\034"
+	.ascii	"`\345\210W\323'c$\250\314A\273\221\224@\232\227\256\264\n\n"
+	.text
+	.section	.gnu.lto_IO_GPIO_PinSource.11.f4518a5190bc6c92,"e",@progbits
+	.string	"(\265/\375`$\001\375\r"
+	.string	"fZ^C"
+	.string	"\223\223\016\337\3278\013\253l|#>\331\240\026+\020r\b=\"_\362L\002\242%\376\322G\2009\355\266\217Dp\214\217:\247\302\215\200\252\252^\365\215\n\2021\337\357\224F\377u\267\276%\233l)S\nK"
+	.string	"J"
+	.string	"K"
+	.string	"\306\201\036L\367\022\327\362\t\331\335\213\344\005\342+x\002\361\225\242\370v\250\271\371\2479\214\201\361\301u,\207\017^np]\210+\204\220\243k!\240\013A\004@f\374{\216:Q\246\025aw\235\\\007\342\256n[\202m\006\366K\001\020\246\365\336\237\035"
+	.string	"$v,\320\261\353\222\"\2629U\215\025\276\315O*\277\261\025\004u\030\377R^c\255\271\211\331\335\024\333\243b{\276\331\236\264?s\323vo\345\003vI24v\275\006V\320ye\257c\333\177q\231\315\001\352\177\025\260x\256R\022\221\262X\025\276\330h)\362\223-\\\306Igw\035\37018d~\212\f\372\323\023t=\\\314\2002\245(\034\243\023\352\225\230*\302\205\207\315\017Q\016\261\275Pj\311>\\%\3311m\305t\214\351\252J\007\031\226.\371d\330\205\242\231l\3004\n\327\005l\302\311U\242\241\\\037\003\3160\230h\227\206,\323.\217\007:\\%\271\203I\205F\375\367\021\023\246\022\371\271\245#\333\226\236\346\377\300\215\310\001i\bVz\340\306\211Q\217\362\300\"\224)\007H\030\032"
+	.ascii	"0\013\355\325\rO\261\275\207\243=(\b\3214\030cq)V$pu\324\256"
+	.ascii	"\026FH\226M\256\341\215\330(N\304\023B\330<\t\3219~\345\210W"
+	.ascii	"\323'c$\250\314A\273\221\224@\232\227\256\264\n\n"
+	.text
+	.section	.gnu.lto_IO_EXTI_Line.12.f4518a5190bc6c92,"e",@progbits
+	.string	"(\265/\375 \373\235\006"
+	.string	"B\315.3Pm\222\016d\254\210\346\f(\026\354Qm\222\315.\274\271\212\305\302g\215\266\005P\003K\360.\331\35393\315\215)\372&\213Ft\332:\377\267\326\b\221)\217bg0\217r\033\250\211\240 \203s\240\026\032\\\006n\034\206\340\367\240\201\016\342=\350,\221\242\326\304\032\347#\207\265\215o\224\231y\353|c\333\246\200\021*\271\204d^\234\230$\2114\322\361\367\257\336\3623\366\375(H\325(\321\200\314\316G$3\"|P\251t\254\374\327\243\237j+\212\034\327\004\322\250"
+	.string	"\2052\2433\350\300T)\252\300T\251yj\225Y\027\340\232(\243$d\346\314\342\312\350\255\177\301\177\371=\001\b"
+	.ascii	"2\003\202a\243\302r\025Nr\031\003N\030\251V\256P\362"
+	.text
+	.section	.gnu.lto_IORead.13.f4518a5190bc6c92,"e",@progbits
+	.string	"(\265/\375`j\001\025\017"
+	.string	"\326\334eE\360\260(\035:\206T\006\212\250\315\222\325\227!I\315\315\206\261\266$\273\256\335\225T\325\352\315\341+p\264F\277\024'Z \264C\177\036\325\0133\360\f\t\027\310\034w\"\2336>^\2623\270\305\222O\366\2262\245S"
+	.string	"L"
+	.string	"U"
+	.string	"+v\277\004F\300=\372\373\200\355\221\273\200\355\321\266\02500\371\364\357\325r\027\t\025\315\306\356\327)\210\237\0165O~\205C\n/.VV\032\256p\201\b\013)"
+	.string	"\254R\020tS#\304g\236,+\225LO\310\356:WV\031\356x\333\016l\177\330\227\021\2364\267\245=\227\375\321i\030\323\032\323\031\323\357 \020\303\342\340\212\251\316\267-5\034\373\"\262\200\261}\277\346\264\223\177>\360:\361i>C\371g\003./VlwA(6\3501m\223\r\262\235i?v\031\323e)\367\330m\301\0029h\026\271\212\020\247\247=a\030:Xt\024#'JF\245\355\361:\302\345\365\231#\374\246\304\355n\003\277\204\t\211\377\342m\217\036\375\354\t\273\020\203%#CeM?\304\324\354\250S\266\250\237\271\007\r\214\207\0310vT\362\206\375\245R]\366\341\356\256\265\345O\336(\035\002\361F]\211$\2320\"A\350$\214DH\272\020\251\324\201\024\260W\"\"u&\236G\352@\037\352p\265\345"
+	.string	"4\023*\034\375<\310\221\331\340\244\177\332\240\262\330\206\352\020\224\246\240\272F6\325\217^\325\"\365\252\2524T\033RY3\247\371\201\312I\351\330\004\034"
+	.string	""
+	.ascii	"\033Zd\201\316-4\263\355\030\232>c\356\002\313\200P\256\350\247"
+	.ascii	"\013DK\225\203\224\005O\247\254\2550<M\226e,\200\206HW4\303b"
+	.ascii	"\\\2506`\f\002e\013\320\035\3524\241\3547\257\354\221\252\034"
+	.ascii	"\232K\355\001"
+	.text
+	.section	.gnu.lto_IOWrite.14.f4518a5190bc6c92,"e",@progbits
+	.string	"(\265/\375`\304\001\265\020"
+	.string	"\306\337oF\340\360&\035\303\321=\330(E2\2430\\\361\016h9\376T\247\023P\305\316\225\231\"J\217\\Mbx\241\377\3349\226{\330\236\220\355p\b2\3140\203\034k\r Z5N\203\363D\204\367\243\243\331\275\267\224)\005Z"
+	.string	"W"
+	.string	"_"
+	.string	"E\273\335\002\217\244\016\335\235@<L]@<\264\313\306\361Ng?D\224a\210\307\356rZ\342\256G\3704]\276\314\243\n\366\341\320\303\037\b\214\346\035\330\335\r\206!\3655\350\321"
+	.ascii	"\003\004\366z["
+	.string	"\213\035)\016\364\274\201\325d\242Lv\327i\003\303\271Q\267}b[\201\235$\001\377@\245S\237\375Q\323/\246U\323\251\351\003(\260\"\026B\026C\221\272\355\360\324\2644\240\f\024\266\357\263x\315\345A6\220\344boB\247\275<\310\020\004O\314\347\320~\261\267\303\334lk\332\f\034\270\336\301\210|\351\310\347(\301\323\276\317\177\\\237\305<d7\307D6j\232^\371\364\240\312\362FG#T<\315\201\211\037\232NB7T\372\021\034\035/\244\232\323k\226\360\027\253\324\356>\360]\264(\370'T\342\241J_{\356p\020\021\373\231\315\344\223\222\340\241)\251cb\324\003=\004\250Gf\251\206\022M2\331\335+Uf\377\355\356Zs\354TZ\365\356\001\253\t\311Z\245QJX+\256\245\225ra\325\212\300\255\254NT8\224V\013W\"bV\205\224\026g\201\305jq[7\363\267&3\372\212*s\276"
+	.string	"\367\214\2701)\311\237\336\330\2526\204\033\235\024\255\240\f\320\331]\226x\230=lr\244*\202 \232SN\304\222\322\323\236;\033\222b?\263\247\327\324\027# `\002!r\353\001r\250q\b\264MH\037\331\356E\346\253=\274\036\203\200\337JM'O\253\332\0271pprs\033T\314x\032\333\262\205\032\"V<\271\3301\320"
+	.ascii	"-\034P6\210!\032\247ex\023\216\351\033\260V\001#H\247\013\332"
+	.ascii	"\336\225\272^\253\366"
+	.text
+	.section	.gnu.lto_IOHi.15.f4518a5190bc6c92,"e",@progbits
+	.string	"(\265/\375`\025\001\005\r"
+	.string	"\306\227UB"
+	.string	"\223\232\016\337<\004\265ZhD\365\275)\311B\222U\203GN]\025\033\246\201a\nCq\354\217#m\252\017\226\241tpK@l\005\252\252\252\224\"\210\004n<\350\337K@\260\b\013\261\273\233\224)\005A"
+	.string	"@"
+	.string	"C"
+	.string	"\360o:"
+	.string	"\370\347\314\316\361-\264\357h(t4\273\033u\304\263K\232\231\017\242M\270\244\341*\031HQA\206\243\201$*f\007\212\277<-h)\231\033\222\335u\252h\031\356w\333\bl\023\260\377!W)\375\211\263\241F\204\261\213\241\246\307\322x2L\370\334;\223o\316\033&\366W|t\362\315\233\025\216\372\263Ol\352/)\333O\373*\356\222]\204\362\220]\226P\214\335\255\200E\246?o\027\020\357\0362\303\303Gf\360\230\222iw\017\370-$X~\211\007\360\357\351GO\022\027B\200p\021}\262FE\234\340f\324(P\265\003\007\03403)\311\303\336@\251-\366\245\335]+\213\r\323\360\245\337E\017V\225\356\214XU\304.O\204\352R\020\033T\tJb\347\302\342\310"
+	.string	"[\016<W\204`YW\244\266\317I>\n\222\264E\355\316_xd\256\005\001B\273\213\301\277\364\241\242\343\351\365/\027Y\341`l\260\370\321\271\272\013\fj\034"
+	.ascii	"2\003\302\260\330\302\306,\020\240\355\370\2305`d\316\205\341"
+	.ascii	"j\206\002W1\252\271\247\315b\314\n@\340\321\020R\004\031X!\205"
+	.ascii	"k\240\022B\003\025\212P4t\006\t\032\006\013\221\232\325\025q"
+	.ascii	"-?%\336\224B\355\001"
+	.text
+	.section	.gnu.lto_IOLo.16.f4518a5190bc6c92,"e",@progbits
+	.string	"(\265/\375`\025\001\005\r"
+	.string	"\006XVB"
+	.string	"s\233\016\373\021\264\367\022\326\025\340\t\020x\204C\374\327\346a\241\252\311\006i\035\327\230'\223@\007\304\036\202\021r\225\016J\006\207\235\250\252\252J\001\300\026\021$G\351\357\374 0\325\233\335\335\244L)C"
+	.string	"A"
+	.string	"C"
+	.string	"\003\342!\365"
+	.string	"\361\320\233\235\343\236h\257\222\301\302\307cw--\361\355\223\346\346\003\350*|\352p\235\016\254\270\300\242\351\270\251Z\201Qq\322\023CG\222\231\361\354\256\263\244\343p\303\333V`\273\200\375\020\001S\372\224\306\305F\002\230\335\r1>\266\006\234\201\302O\371\027r\317\211#\304\276\213\227D\3569\303\265\260\330\335\352\320\026\261\253\303\254l?\355\2678\312\366\321\3107\273&\"\227]\317\2009\324\241\275\007\33774>\274d\007_\001\241v\027\201\017\203\002\346\237\210\020\017\241\276\3644\241a\204\b\224Q(c\224D\212\224\027\365HT\365"
+	.string	"\202\364\342\205${\330\036\227zb\177\332\335\265\232\3301\035a\032~\364k\330\225\376t\260\313\3222\320\204+c`=\270\026\200X\237L\263:\004\214A"
+	.string	"e\226\004\f\313\254\312\013\335\023Rn\322\023\265?\227\001b\311\032\b\020\355\256\026\017sG\211\016\250\327\223\316\341Z\270\033*?>_\217\241E}\033"
+	.ascii	"2\003\302\260\330\302\306,\020\240\355\370\2305`d\316\205\341"
+	.ascii	"j\206\002W1\252\271\247\315b\314\n@\340\321\020R\004\031X!\205"
+	.ascii	"k\240\022B\003\025\212P4t\006\031T\264fuE\\\313O\2117\245P{"
+	.text
+	.section	.gnu.lto_IOToggle.17.f4518a5190bc6c92,"e",@progbits
+	.string	"(\265/\375`\f\002\025\022"
+	.string	"\326\241wH\340\360&\035\332\013\362c\2072\"\241i\021\005\216[9\330-i\377r\007\352\034hlV\204\367)m\212\213\270\214F=\004\216\217\205iFy\236a\230a\206\3714\302\343\201'#\202\001-\224\274\036P$\204l\"wJ\001a"
+	.string	"]"
+	.string	"f"
+	.string	"\207\275<d\327f\347\305\256\330\300\n\272O\213'\260}v\027\260}Ze\333\270\230\263\037M\260~p\354\356\2478W}\233\232J\225\017\363\355\243\025\342\023\3045\220\026\006Mdw\275\226\214T\315\301\212\fA \255\225\346\315n\244\270\354\222\2465#%G\262\273\226\032Z\037n\356\266O\266Gl\231\022\037\036\233t\367\030\354\237\217\335:\245\345\224>"
+	.ascii	"\004K\241\b\234\023\212$n\207&\035+c\022\361<\366\333\367[|\306"
+	.ascii	"r\037\037\b]\241\213\305\376\317\201l\317-\367q\201\244O\273"
+	.ascii	"\305\366>\345e\366l\361=\252\307\\:\030\017\3358\362,\355\212"
+	.ascii	"\f>\275\240\373\024\321.\355\273\376R\005\262\311v\311\211\\"
+	.ascii	"\206(\230\244l\237\227;\241+|\301f\236p\241\224\017\375\354R"
+	.ascii	"gCR\370\202u\312%8\212!C\032w\034\310\250\007\235t\273\373\300"
+	.ascii	"w\261\202\342\357\200z\240K\035\016#\302\027,F6i\t\024>J\252"
+	.ascii	"7~\331\246^\366\220\036\0320LGJ22\207-\256\244\336\330\327vw"
+	.ascii	"\25566'\035'*'\024\rDI\227\214\200\250O%er\001\225\222\360U@"
+	.ascii	"\235P\276\222\224\3127b\300\240\005\223\324\267\002\202\251\317"
+	.ascii	"\023c\2566&\211\321\325\2467\346\214X\243\346\241\334\310\303"
+	.ascii	"\022RNUilU\373t\030\003r&S\r\02653\300]\264q\352\241\020^\343"
+	.ascii	"\214\216\325\207\214H\250\320\\6\251\021d38\275J\325\"V\315*"
+	.ascii	"( P\002A\346\324\003\362\001\353C~\274d\246\266\22378^\246\034"
+	.ascii	"+\336\255\3170\330\332\220\004\246\316\001\265\340\354h\207\351"
+	.ascii	"*\233:\0256\250\230\3614\256\255]'2\205l'n1\343\f\243\206\201"
+	.ascii	"\243\002\216\204\003\214\006|\250 \341\317\243\334\026\243+\362"
+	.ascii	"(\025\300\227t\272@\355]\253\353\265j\017"
+	.text
+	.section	.gnu.lto_IOInit.18.f4518a5190bc6c92,"e",@progbits
+	.string	"(\265/\375`\353"
+	.string	"=\f"
+	.string	"\306\325QF\020\255(\035(\354\f\312E\335\274\f\004d\323_z\361q\2564\3633=|\354\215s\305\016\251}\273\365g\330V\036\202\242\022\215\016y\034{\001"
+	.string	""
+	.string	"\030y\006\020\325U\276\340D\001qf\330\305#$\222\275\367N)="
+	.string	"<"
+	.string	"?"
+	.string	"\325\241]\342\343j\017\013!\340\205bw\271\251zx:e\350c\210\001N\021|R\023\n\0038h\210&\252\211\235\230\360\327e\001\361$\245Egw-\t\210\007\356z\333)\2669\366W\002\037\"\330\276\3066\225v\t'\274K\344\271\273\200\004\211\034\217!|k\344\213\335\006\035D\266W\020zi\337\302/\204g\221\316\261\233z\340aw\034q\310\366\352\361\036\332\353\366\016\355\001\031\253\335=\004\030\355\265\242LTPP\222\263\211\222\340\222M\22349\0230Pe\220\235\244\n{4\311\351\300>\335\335\365L\331w\375\332[?=\353\227\333\006\210\021(\260]\003\263\025+\242\0063\335\007\344U\260\003\311|\365\363\244=\233\317\343B`\027\343\201\037\016\344\251\260p\0360\304m>\374\265t \367\362} \247\031K\357\224\246\211j\323\376\276A\224\202N\333\345\261\321\266\273'\276\006"
+	.string	"\241\031"
+	.ascii	"2\003\302\260\311\302\326\021\210`{\301\320\362Q3\200\334\232"
+	.ascii	"\336\370\031\243\240\341\321\025P,IX+\215\013C}\030\fsI\b\026"
+	.ascii	"\204\317\324(\270,M\215\026w\371\251\366\246hj\017"
+	.text
+	.section	.gnu.lto_IORelease.19.f4518a5190bc6c92,"e",@progbits
+	.string	"(\265/\375`o"
+	.string	"\265\t"
+	.string	"\246\221B< \005)\035\267\216\216\306\353m\026 : T\207LN\217\212\001\237.B\001\027j\034\240\375\212\335\247\271\217\202(F\223\020@\020\002\005\200\320\355@\006 6\210\346\264\221\354\275wJ\0010"
+	.string	"1"
+	.string	"1"
+	.string	"\273[\245\311\277O\031?_"
+	.string	"\344\370\034\271\234\r,\0365\004`j\202hd+\177y\004\001U1\006\210v\327\361\003\024\271\351mC\330^\260-\0136\273!5\332\346P\234\024\220\355G\373-w\371\376:\335`\227\205r\263\0332X\341s\352\360\b\333\351\347\007\333\251?\233\347\241k?3\353\220\231\005\256\335\375\311\251\277\261\235\322U\200Y\017*\326\344J%&&}\332\242$)\331\201\305T\021\200\035\246\242l\331\237\273\273\226,\373\257?\322\002\232\316C\035\027=\nu\\-y$\f\316\223\250\024\\\304D\035y\245\032JpWA\362\252E\327y\025\024\242.B\311\324\224-\323f_\034f\372\354\256\203\017\243\2211\020\020"
+	.ascii	"2\003\3020\301\302N\021\210\030;\002\204V\200\300\243!\214\b"
+	.ascii	"\2623!\025\314\273\004\320\254\246\210\273\374T{S4\265\007"
+	.text
+	.section	.gnu.lto_IOGetOwner.20.f4518a5190bc6c92,"e",@progbits
+	.string	"(\265/\375`\233"
+	.string	"\365\n"
+	.string	"f\324KC \253(\0358\357\004\302\016\340%P\321\310\245\370\236\273*\260\022Zz\375\205u`\220\345(\211m\301\2671l+\024\303\310<\016\020\3322\001Md\302\0060A\346`\202\002\355q>\273\300Gdo\271S\n9"
+	.string	"8"
+	.string	"9"
+	.string	"\231g`\227\361\030\330\245\"x\367\250\260\363\001<\212X\360P\362N\327\350\001\201t\241\302\023EL\353\303\203\253\016M\336\bB\211\315\356\032\226\274\001\267\274m\020\333\034\3663\001!\030v\005\274F,\007\251\241\201\355\333\006\331\030\333\020\332O}\002\350\363s\213\335\257\225awvx\343r\351y\261\355G\270\004\220\2738\023x\024\nH\001X vg\026)gu\037\376\252e\345\262\273gp\351\263\250<U\b\221\n\301\227\036p\260r\251?\030T\002\337\002\n\256\021\024aO\021T\224\375\270\273k\375\034?\177h\350\313\213\002\035\002\233\006\315\321lZ\346\341:*\032G\222\231h#%\031\207\363d\032\ro'\035.C\3316.\303\314\320\343\352\347\243\274\r\032\365\252O\030\360R\320\357\260\253I\275\t\251(*\312\001\021"
+	.string	"A\204n\211\030U\004\370\205\315Z\031\331\262\3453v@\327\321\275N,\231\232\225\270\240\036M\231\001M"
+	.ascii	"R\002JU\003\315\245\240"
+	.text
+	.section	.gnu.lto_IOInitGlobal.24.f4518a5190bc6c92,"e",@progbits
+	.string	"(\265/\375`\245"
+	.string	"E\n"
+	.string	"\326\222D:@\217\322\001"
+	.string	"\025\214\250 {\262n\265\251\301\032\345\301\007\227\3604\301\n\006\343=k\330\333\306\255\331\262\230Nm\235\250\035\003\202Gu\273\321\215\321\024\366\257D\032\331{\357\224\0022"
+	.string	"4"
+	.string	"3"
+	.string	"\240\237\371\260^`2\013\305\322+\335\354n\200\bA7\022%\236$u]\206\031\251\317\217?\210\255\204b\3522\363\331]\313P\244\270\265\333\356lw\354\327\232W\277\343\036\340[\234\2554\261\275Rb,\273c\347\325\006\333\353\346\003\332+\275\200\366z\215A[\345\243\305^\204$\"\244ew\271Y\001\232N\360\225N\031\377Dq\264\317\327\305\f\344\344A\272\320\335]\3729W\366x\222rwK\236*\373\255\373\025\340\245D#\001\266+\021\003\263\262:\202\361\326\355\273\316\341\217\016\244\317\023Q\203<^\307\215\276\220C\367-p\r\235\002\003\007\372F\234\207\300\236(\364q$\317\3738\315h\372T\261\276\301b2\323<\271\316\225\021P\346\317\321\352\206\374G\025"
+	.string	"2\003\3769\006\324\201\030Q\230\037C\356&8\270\222i/\314b`\356\\\356\351F\202\320'\270U^\204"
+	.ascii	"r\203[e\247e?G\2119\274s\315'"
+	.text
+	.section	.gnu.lto_IOGetByTag.25.f4518a5190bc6c92,"e",@progbits
+	.string	"(\265/\375 \357\215\006"
+	.string	"\342\214.4Pm\222\016d\\\003Xvr\345\032\223:\001s\001\300\301\201uF\221\203\335\026\300\262\272n\274F\363\217\253\2522\252\250\300\206\310pCj<;\272\331Md\n\r\233\017\316\321T\224\363X\235\b\312bp\017\324\306\301q,\217\323d\256 :\226\373T\225\3450/\213M\r'\376\201\032j|-\231\231c\306w\324\026[\202\222\245,\214dZ\254\250\344\211d\322\361_\217\371\261=B\302\325\221\304\230\211\341A\222\371\016.\270T\372\357GA\256\261\314\343\020U$\243\b\3112\237\373u`\252t\251\300T\t7\212\265a7 \004j\003P\310\314[EH\324\261?\301o\360_\004\007"
+	.ascii	"2\003\202a\243\302v\025\216\\S 7D\274Wq\002"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f4518a5190bc6c92,"e",@progbits
+	.string	"(\265/\375`4\001\255\005"
+	.string	"\322\007\036)pk\322\001VU\261~\225\256\352\001\027\304\375\333\002\377\377\377\377/\256\\\377\373\37273\233\232\231-\375\377733k\211\f\255((V\"\304\331X0\333\004\265m\301\216\344/F*\265\215\225\020\302I\217\275'3C\307]c\215q\006\216-\276\024[\211\r\210\013\337\004\357A\267\200;\260\r8\\iS\331\023\266t\035Q2\323\336j.1\312\314\264\206\236\266\317$\032"
+	.ascii	"\240\b\256]T\030\346\257\306p\356\2610\272\274h\007\220\b>\007"
+	.ascii	">\007>\007>\007>\007>\007>\007>\007>\007>\007>\007>\007>\007"
+	.ascii	">\007>\007>\007\336\265\355\304\003"
+	.text
+	.section	.gnu.lto_.refs.f4518a5190bc6c92,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.f4518a5190bc6c92,"e",@progbits
+	.string	"(\265/\375`\315\022\315V"
+	.string	"Z\217\310\037R0PJJ\007\376}\272\273\357:#O\0030gwCG\354|p3\316V\177\\.\260!P\240-]\236\261\252\367\336Z\270\032\252Y2\275\350R\024\202p\b LYx \273"
+	.string	"\265cX\252K\250\262H?\027{!\035<(n\346\220<)\371[\246\232\001\342\001\005\002\300\277?\026\261\236\237,\016\353\254\227?\254Le\306\315)\303\325U\337\002O\271\n&\265\0012\177`I\273\352U`\177\276a\215e\346\311@u\325\237\327~f\302\\,\005\350\334!\355\262\3566\347F\314\230 ]We\265\035\344^\227\225\253\276\004\366\334\204\254\312\023\206\302Q\030\215\247\234\366\263\031;\271\332v\243u\367\231\253\265\302]g<v\323\304\351f\2216\254\356\366\017\374?\3474.\343\261\002ttKE\321\004\331!\307\247\327\335\216\330\0311b\004\333&\206\026\235Q/\001\313\315:+\316\t\366?,\1771\030O{X\354\354\305M.\323l{\332\335\016e\346\300"
+	.ascii	")\273\352{\330\377a\037j\351\023\027\262\347\236u\310=\353/\033"
+	.ascii	"\202uV\025\216u\326\267\254\263\262\374aU\377\273t\376o\222\005"
+	.ascii	"-\250\250\361\337\356\177\227\024(\244\211\031\377\243\225\030"
+	.ascii	"Z\340\303\377\212\360\377\211\320s\376\333\301\231\024\234\377"
+	.ascii	"j\300\202g\202\337\3747\202\237?\360`\201\333\374\367\001\020"
+	.ascii	">\237\371o\003B\377C\270\314\177\271\f\r\370\277\303\372_\020"
+	.ascii	"\300\377v\360\263\006?\023\177\306\340\347\013~\266\340g\025"
+	.ascii	"?\247\370\331\304\317%~&\361\363\210\237\025\370\371\200\237"
+	.ascii	"y~&\340g\001~\006\361\263\316\317\037~\036\376L\363\263\360\277"
+	.ascii	"\330\177\265\377_\376\217\371\277\345?\225\377|\377\365\376g"
+	.ascii	"\371/\346\177\230\377R\376\347\375\007\363\037\357\377\332\177"
+	.ascii	"\021\377\257\374\327\371\373\373\373\373U\030\377u\361\333\214"
+	.ascii	"\b}\255\356eN\267\ruN\245\226N1-\321\234\266\207\200\350)\221"
+	.ascii	"v\266RQU\332\267\333\346nJEQp\266R\250\263\225.q\272)]v\267Q"
+	.ascii	"\034g\031s\311\316\251T\3249\225Fs\272\331\313\2362\207\260M"
+	.ascii	"i\324\351&\215\3428\247\314\250\263)\025\315\021RE\305\247\243"
+	.ascii	"\007\260.\306\301\331l\036\317(&\024\007\316\331J\273\256\233"
+	.ascii	"\313p4\024\201\356()\264\216\351\304Q\222\340x$\2411\245\002"
+	.ascii	"<\223\246\244\335\204sfI\273\263\222f\364\023\202e\013\327F\030"
+	.ascii	"nI$\252w\340\350\036\340\331\275\344\206\353\356ew\013\241Qm"
+	.ascii	"7\f8N\254\347\263\373i\347\331QK5\034\335\267lK\224\250s:%\375"
+	.ascii	"Q\033\233bu\216v\311X]'\005e\247\313\257\336\321\335\f\206\305"
+	.ascii	"\2126\341\3351\352\017,E\256\346X\356\273\314\307~\347>\356\241"
+	.ascii	"\246\311}j7\223\371\200\033\346\003\202lV\314\260U=\303\261\347"
+	.ascii	"\351\275\260\336\355\324\030\334~"
+	.string	"t]\341\201g\330\376x\022\0213%\030\326\266\305\f\323c\2637\227\244\225'\242\271v\306\005\006\257\346m\007Z\331U\277\354\004\331\320\220\224\255\261v\f\307q\005$9_L\361\272\373M\234`;\246c.\f\367D\301\226\331\016\354\205\273\360\035O\331\216s8\313\361\334w\332\356fw\3331\033Wa\270\262\026mew\335-\333\361\025~\273a\266\r\245\240\311R\333\360\005\250%a3*\327\261\016<\345\341-7q\342\300%Xs\331\214\261a\f\237\025{\346Y\371\217y\3263\025\313;,$N\0130\255\017\310\022\253\321\354M\261\202\\u\3128\374mw3\017\031n\\\201\201e7\306\302S\021\234\345l\205\333\036d\266\335\336\030\374\314\302\256z\216\262g\021kw\372+\306{7.@\221\350\360\267\322\341!Qo\264\355\375b\347Y\033S\236\336z\303\315\313\311U\357\227\226\254+'z\\\\\327\013"
+	.ascii	"'F\234w6S\266\254\350\272~\275\270\n\003gR//[[zj\2264\277\253"
+	.ascii	"\270\254\254\253E\367\306\224\247US\245f\205H\r\277Z2}F\230a"
+	.ascii	"W\275Kxo&\316\351\255\257zi\340*\300:\247\257>.\301)1]\322\334"
+	.ascii	"\224(92\343\204O\316\312\032\026\326\275b\351\236C++!A\240 A"
+	.ascii	"r\257\370\251\201rzLyZ+\226\236\372\262\372\275\242I\233\252"
+	.ascii	"\272aFE"
+	.string	"u\217\260bP\230\362\364\270\312\022?2#\277Gn\027\345bf]\365V\r\371\254$A\322W\243\304\264\026\344kj\352\026y\321\\\204\tS\236\236\320\213\222\2459\"\277E\372f\224\342\310\236\300-!B\356\220\333=&\366tw\241\332\244P\221\376\016\031\003\256Q\231\203\301\n\b\0209%\341\230\333\022\025\024\024\224\037wq\346\371\270\352\201:^x\3416\275X\332\005\243c|H\341sr\252\243Ib\033s\252\363\341\3436\275\300\351\244\270+X6fYK]j\321\350m\222ih\367S\005Sh\267\355\315/\t\323o\323\331\230\216oL\033\330\363y{\214\205u\001y$\311\322<~{\274\r\277lyc2\321\241\343.\001\320\322n,!Y\\\222\273~z\352\t~\361\021FI\351w\211\343h\300\324\242Lf`\177\373.\177\231g\336\034\354\262{\331v\2175\354\bS\236^?E\365\334h\351"
+	.string	"\344y\325\233\343\342\250\351\346\352\356\002\202p{Q\266.\216{\343y\325\003\327\027a\030\033\344z\334&\347\020l\323\001\245\352\252\017\303{29\224\376\244\256\372\333\304\376\376k3\241\335\315\024l\033\232T\263\376|\0162\367\3746\fd\004\272\023\250\353&R\225\307\316\220\306\204z\210*$\217f(\223H!\tCF#U\211\204L\022\005Y0\"*\"\217J\243c\215\021\212E\033\023\210\222F,\214GI\026'\030\225H+\304\030\"\255ECB+\2540\032\032!i\344\242Fit\001D\2341\"\r\031\215d\224G$\321\250\250()\004Dd\2230\200\210\352\361\005\020Q5*\217G\037"
+	.string	"\021\2052\206\214A@\304\325\210<\302\250\311A\036sl\310 \"\2176"
+	.string	"\304(\022\205@\300\240\bD\f\300\206\f\242\362(\311\301\r\362\310A\021\210(<\021\211\035\"cP\021\210\270\236\350xdD\032\213\330C\200\302\001\024)l\b\237BE\t\025%\326\247P\361\363\243\002\305\017{\024?@e\261hH(y\024\032%\223+\212Ae\021\210\250*?\203\204\021\215\023\216E\036e1\205\320\206Q\006\362\030D*\022\031\203\222Ga\362H\243HU\026Q\374 \2174\200\306\"\220\221\350\250F\022\311x4<2\"UH\006I0\2660\322XA\250\bD\344\300E\315g\220\200!D\214\341\2434\026\035\r)C<I\303x\344\243L&\217|h\202\202V"
+	.ascii	"\203Z\020\201A-\200\200\312\242\211\007\224\310c\r\366\022H\300"
+	.ascii	"\"D\007\033\270`\211H$\217>HG\306\024\216G2|\220\307\241\023"
+	.ascii	"|\210\216\220|H\200\b\n\212\261B}\013T\302\362\303\243\302\246"
+	.ascii	"\f3\367\344\252\367\311\357\332\223\313\246\272u'\225h\223\352"
+	.ascii	"\332\031\325cC\246\247\347w\303/\233\312$\235v\217\322\230\230"
+	.ascii	"\244\253^\265_)\277\214\220N\356\nX\313\336\264\337(PM\\\262"
+	.ascii	"\230@\251r\313\202G\003{\225\352lz\317xLm\266\035]\305\216\340"
+	.ascii	"P\242\327\320*\r\344X\301\325\340\304\376\227lz\311\256\031\216"
+	.ascii	"\0224\203\030\236\3345\364\251\201"
+	.ascii	"uI\237\227\032\256\372kv\306\253\221\202X\241\264x\315p\325\237"
+	.ascii	"\237\337\262\177X\241Om\017\271\t\337\027\025hX\330\025\343\242"
+	.ascii	"\207\005\224\352:b\026\201\210\250\321,E\030E\"\"\"\"\"I\222"
+	.ascii	"\244\003\201\005\204 \007\241\343\r\022@5!S\034\205f\244\024"
+	.ascii	"$)\251Ug9t \276S\367\211\001w\300\004\323\002\313Q_>o\353I\357"
+	.ascii	"\300\r\034WQ5O\005p~x@\230\374\304\271j\354\351\006\031\240\241"
+	.ascii	"z\345\217\255\314\367$ \254aC9\"az\024()\022\005\236\031<\311"
+	.ascii	"j\330\177\021\177\300q\331\355\367\352a\216\220\275\240\261\255"
+	.ascii	"'Y& \304\232#\203\"\345@j\266\024\0064uJ1\007\351i\200\361\236"
+	.ascii	"T\237p\243B\nP\315\030\240\2509\367}<>\331j\203\360\370\221\016"
+	.ascii	"\344@\376y\327\271\341+\360\267\215K\022\021\276%\317MK\236!"
+	.ascii	"\211\266DprQ+\236C\265\257\354\264>9?9\313[ZZ\361\330\253Y\f"
+	.ascii	"\311\020\017\276P\343\240\252\370\303\301\337L\374\333\277\n"
+	.ascii	"@\212\267@\315\311\007\357\003k\347.\177\207"
+	.string	"\354\224\206d%\006\251P\b\023\375\251\362\017P\347\324+\003\245\366M-:\357\245a\365\270i\217.\022\202\361LQB\206X\353K\241\327\345\313\017y'\264\325\301\255uJE\345M\267\376\367j%\214k8\225\027\0263\303\307>\025I\332x\347\336o\251@\221H\253\031\224\212\350\354\261\320\214 \3660o\364\315\316\312_\246b\003\300\001\222n\021\030\305P\253\237\202|R\354\022\016\3124\227SST*\244\214t\236\227\220\357WmJ\342&\354$\301\311\314\025\246\031\036(\001PI\2314\255{\332\224?\3613\223\341\237H\033\370_y\301+\026\246G\367)\346\271\326\360C<W\r\362\347\034X\263\320\277@\034\240@\342~\240\205\026J\216\213\0208Vh#\236\237\257D\244\320\274\232\0339\030\201\357\025\260w\354\204\241\301\357l(\362\324\320\2072\310i(\343\276\217\"\354\375)t\265\255\262\201\262\310{\221"
+	.string	"0^\346la\026\232\313[\032e\271@={\227\267s\374\335\b^21\273\214\030\275\334\337*\3107\343\337[\200\332\210\217z\021I\351:\311b\224\320)\337P\241\310\276\003\026\370]-\301\t\224\341\263\357\330\316\001\232\340\003\344\350/\024\0276\217\207\242\346\367\355\346\245\3630ww\346A\277\310\332\247\375q\032n\324\361\260\320\373\370\311\366}\300\225\315`\217\302^\022\347<\371!\031D\277\031"
+	.ascii	"\262R\276\304\312\342\331^\276\271\233G<\0039(\215\247\036\300"
+	.ascii	"\365\211A\326\330\371\320\365Y=N\356i\211\375\"!8cu#\374\261"
+	.ascii	"\2371\336\037\347\313\343\254{\331\213\300\320\233\303\341\337"
+	.ascii	"\307\337\264w\0374\273\346\344C\345\312\216\243\277\352k\345"
+	.ascii	"\236\332\261\376\2337\344\227\3450\343\005\367\254U\376\207\271"
+	.ascii	"F6\312\223\332\305b\252"
+	.text
+	.section	.gnu.lto_.symtab.f4518a5190bc6c92,"e",@progbits
+	.string	"IO_Rec"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\001"
+	.string	""
+	.string	"IO_GPIO"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\001"
+	.string	""
+	.string	"IO_Pin"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\001"
+	.string	""
+	.string	"IO_GPIOPortIdx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\001"
+	.string	""
+	.string	"IO_EXTI_PortSourceGPIO"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\001"
+	.string	""
+	.string	"IO_GPIO_PortSource"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\001"
+	.string	""
+	.string	"IO_GPIOPinIdx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\001"
+	.string	""
+	.string	"IO_EXTI_PinSource"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\001"
+	.string	""
+	.string	"IO_GPIO_PinSource"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\001"
+	.string	""
+	.string	"IO_EXTI_Line"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\001"
+	.string	""
+	.string	"IORead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\001"
+	.string	""
+	.string	"IOWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\001"
+	.string	""
+	.string	"IOHi"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\001"
+	.string	""
+	.string	"IOLo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\001"
+	.string	""
+	.string	"IOToggle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\001"
+	.string	""
+	.string	"IOInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\001"
+	.string	""
+	.string	"IORelease"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\001"
+	.string	""
+	.string	"IOGetOwner"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\001"
+	.string	""
+	.string	"IOInitGlobal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\001"
+	.string	""
+	.string	"IOGetByTag"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\001"
+	.string	""
+	.string	"ioRecs"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\030"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f4518a5190bc6c92,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
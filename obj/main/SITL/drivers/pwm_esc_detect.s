@@ -0,0 +1,116 @@
+	.file	"pwm_esc_detect.c"
+	.section	.gnu.lto_.profile.d7cdf862ad98409e,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.d7cdf862ad98409e,"e",@progbits
+	.string	"(\265/\375 \024\205"
+	.string	""
+	.string	"P\b"
+	.string	"\001"
+	.string	"\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.d7cdf862ad98409e,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.d7cdf862ad98409e,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.d7cdf862ad98409e,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.d7cdf862ad98409e,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.d7cdf862ad98409e,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.d7cdf862ad98409e,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.d7cdf862ad98409e,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\013"
+	.string	"\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.d7cdf862ad98409e,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.d7cdf862ad98409e,"e",@progbits
+	.string	"(\265/\375`\t"
+	.string	"\215\007"
+	.string	"\322\31558@o\323\001\013\024~\226\251\215\007`\314\276\013\221\374:\325O\271\360\203\356\376\3630y\313\357\243E\327\266\3360%g\362V\241\274\024\030\205\225\016\202\224\271?\337F\224\310\024\247\320\036\"\0342\262\351\204\3254\366\332\241Vv\255V^\232KPhN\347\211\307`6L\002\242!N\255'm\272\341\346G9\017\243#?K/:\273\221\234N\343\311i?\251\031T\314j\261Q[7\217\366\227\221\271Bg\021\207\270\304\032\240\373\361\3508\030\235l\200\264\\\020\nB\300\207J\310D1\310#\026eL:\213\360\310\255\017xK\356\005/k\205\205\303d\242\316\020\317YuqV\375'y\001\351.\\ bLPQ<P}\212\377K\377S\376s\030\206\341\177\200\377\375\337\023\b"
+	.ascii	"\257\354S\021v\270\020\215p\352\242VV\2102\002\327\214\255e\f"
+	.text
+	.section	.gnu.lto_.symtab.d7cdf862ad98409e,"e",@progbits
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.d7cdf862ad98409e,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
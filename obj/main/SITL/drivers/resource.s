@@ -0,0 +1,183 @@
+	.file	"resource.c"
+	.section	.gnu.lto_.profile.a91edc1c2e28a310,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a91edc1c2e28a310,"e",@progbits
+	.string	"(\265/\375 \024\205"
+	.string	""
+	.string	"P\b"
+	.string	"\001"
+	.string	"\246\350\274\326\017"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.a91edc1c2e28a310,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.a91edc1c2e28a310,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a91edc1c2e28a310,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.a91edc1c2e28a310,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.a91edc1c2e28a310,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.a91edc1c2e28a310,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_ownerNames.0.a91edc1c2e28a310,"e",@progbits
+	.string	"(\265/\375`\275\006\215#"
+	.string	"\212B\300\0168@\3566\007q\322u\257\313\243\235\037\325\265F\253\025\270\030\357c?\005\330i\007\242M\207\276\007\033!k\352\225\004\203\232\232\345\274\034\200=\342\355\372B\303m&\326\246$\003\341"
+	.string	"\343"
+	.string	"\334"
+	.string	";\027\006\331>\021\355\331A\254\342\356\245\245=?pE\024\341\262\322\236!\254\n\023\361\222\322\236#\240\n\033\301I{\356*e6\342\215\244=K\020\025F\302U\244=O\370T$\361\002\322\236)p2+\341\242i\317\0252\031K\274s\264g\013\226\306L\370\031\355\371\302\2440\023,\331\372\027\355\031\003$\343\t\327\265h\317\031\034\021O\274bd\353R\264g\275\250\210\302\225A\266\216D{\326\200\310\f\205\373\320\2367\024\262\221\302\275\241=s\020dL\361\316 [2\355\271\303\2371Os\311\310VL{\366\220f\303\323\3362\262\005\323\236?\354\301\341j\256\016\262]\241={\3411s\265w\007\331\236\320\236w\236"
+	.ascii	"\347\031\273\035\036:\367\322Z\231\265\263\263\326\215x\356A"
+	.ascii	"\266\257=c/\205q\356\023\357\346\337|\234\227\363t\276\316\337"
+	.ascii	"y\264\317\363z\236\317\367y5\021\377'D\212\323sF\344G\n\374~"
+	.ascii	"Z(\330dk\003\245\323\214\013\334M\332\363\3571.x-i\3176<B\b\356"
+	.ascii	"\253=\337\354\b!\274\211\264\347<\307\030\301%\244=\343\036\216"
+	.ascii	"1\202\355\217\366\234\363\004\2706\305.\027M\257)vm\241!Jpm\272"
+	.ascii	"2E\t\257m\213\366\314%\306\354\202\033E{\006\360\305\354\202"
+	.ascii	"\315\210\366\034\200\213\020\203k\003\242=\013\310\"\304\340"
+	.ascii	"\202l\177M{\036\360V^d \360\356X\206\3671i\317\005\242\204iH"
+	.ascii	"\332\263\001'D\375\"\322\236\017,)zp\375h\317\b\036I\321\303"
+	.ascii	"\337\321\236\023\024!~p\335h\317\n\276%~x\277\214\366\274\340"
+	.ascii	"\201\204y}\027\355\231\301\237\231y\375\024\355\271\301\254\027"
+	.ascii	"\001\354\336e\360\227\232\\xE\201\350\251\006Y4\270\001\340/"
+	.ascii	"\241/\310\366\200(\217\035\252\001\260\257D\325s\233\373\324"
+	.ascii	"a1\257\242\330\021\007YY\361\270+;\026s\030\2171v4\214\304\261"
+	.ascii	"\235\330\261l\347\325\205\311j\024\217\273\033dd\307\035\027"
+	.ascii	"\366\245\352\nLM\266T\317_i\016\300~\307\321<\217\353q>\336\307"
+	.ascii	"\325\334\217\003\362@>\310\t\271!?\344\211\\\2213\362F\376\310"
+	.ascii	"_\217\344\222\234\222W\362K\216\3115\371&\357\344\236\034\224"
+	.ascii	"\207\362QN\312M\371)O\345\252\234\225\267\362W\016\313e\371\232"
+	.ascii	"\323\362Z\357"
+	.string	"\343\177|\220\027\362C\236\310\033\371#\237\344\225<\223o\362O\036\312K\371)O\345\253\374\225\307\362Z~\313wy/\017\346\303\374\230'\363f\376\314\247y5\317fD\370<U\025\031\377\\\004o\370\027\f\336\260\232\256\351\017\207S0\365\3348\334;}7l\366\312\033^\327\222\247\252Bs\035\236$F\367VY\263Wn\341\341:TY\035\376\022\362\316\336\017]qX=\277\276Pu\025\200\323\025\346\311\252%0\335\\\370w\256\373\305\316a\026\346&q\272Qt\247\277-\3543\313\336fM\020(\211sx\233\272\236Z\232\275-`\305.}*\266\3606I\274\315\\o\2479v\250\352\3606Y4\270s\302\340o\013\243\353\360dS\265\344\3510o\013ox5\317\365\354\261\274-\344\302\352\031<O^\016\367vz\303$V\317U=\301\200\350\026\016\242\352\272\331\336\351\323a\365\354\001\323\340\006\226\352\n"
+	.string	"\017W\260\033\336fv\250!\020\202Q\275\233\251\244\240N\2419"
+	.ascii	"#2\215\033\020(\2024\321|=4\027\326\2274l4\255\"\275~'\246=\022"
+	.ascii	"!\230\236\357\342o\211O\353)\354\310D\371F\231\323}\367\252_"
+	.ascii	"\021z\035\236\252\374\244P$\360\247\2017\213Gb\216wk\002\237"
+	.ascii	"\305\035\362\300\242:\231\330o\213]g\256\002\374\bIu\256s\371"
+	.ascii	"O\"B\002bkW!\260KT2D\324\002\334\327\261\304!\227\205J1R\242"
+	.ascii	"\237\2223I\0201S\307\222\"\277\356*\337 j\001\024\317\264\013"
+	.ascii	"\220\020PW^\\\313\352\276\016\242\273\231 \347\214J\334\025\211"
+	.ascii	"\264w\323\313=\025[\273;\266j\327\356\206\365\363i\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a91edc1c2e28a310,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	"\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.a91edc1c2e28a310,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.a91edc1c2e28a310,"e",@progbits
+	.string	"(\265/\375`\264\005\315\035"
+	.string	"\2667\275H\240TN\032\003\357\375\273\373,\\\3272U\371\235\337\203.\303\261\372\001\247fq\275\376A/\037\317\303U\343\037\365\333\270\023\320Y\210Qe\254\005\243\003\353\364>\3746\367\224T\223'm\204\214\334\353\356\300\263Aj\333-S~"
+	.string	"\266"
+	.string	"\265"
+	.string	"\265\332\360v\031\3542\240JCIR$]\202n\207\345{\344\267i\215\364\310\235\237a\205\252\265\362F\020\t\035M\372p}\244n{\344\357\211\\\340\253N8Fw\240\256\217\314\325\355\221O\335\257\344\027\300/\371\233\373\235\177\334\017\367\273\375Z~\343\257\366\237\375f?\331?\366\207\375U\376\342\377\365s\375[\177\326\017\345\267\372\253~\004\277@\377\324\277?\361\237\307\343\361\370\247\370g\336\305)Q\262v8;Z8\223\276Y\277X\013\205<&\251\351Lz\223\365\221\001\234\224\357\223\335M\217\024\217I_\266we\0053\264c\245h\322\327\352\267\311V\355\023\007b\224\342\333\244\267\255\217\344m\217\\\252\362e\242;\036\257\216&\025\260Bv\227\212\354\322N\275\bk\215\001!K\007HZ[\335\tr@\240\247\250\204\2076V\2046\334\375\b\227\020\231\364\225\372e\332!\033\005#T\353M\255\325"
+	.string	"LX\320\324\325\244\277Q\013\225\023\352\b\r\007\360\226z\214t\f\231^\252\336\200\370L\272N\233\344}Z$G\230pN\205\221\312Tk\335'\tB\265\332\354\023oK\033`\364"
+	.string	"\233\3645B\t\200\333\341\242k\322M+_5\005K\236TM\n"
+	.ascii	"\355\314\245I\270&U\366\236\375:Y3$\037\236\256I\207j*\3372^"
+	.ascii	"\221\211\221G\026\262\0315\212ZL\372\222\375b\3311$/T8\220\314"
+	.ascii	"&]\260>\222Z)\337+\026r\020)M\232\023\013kz\301\363c\3227\354"
+	.ascii	"\327k\253D\3209\2721\351YX\345\013F\006\021\276)Q)\352d\3404"
+	.ascii	"\001M\372\026\177\245\354WL\220\017\"\257\365\221\353U\276S\\"
+	.ascii	"\200\2105rL\272\353\3422r\222\362\231\364\345\372\325\332-\024"
+	.ascii	"G8\266I\027[\037\031#\245|\211\\XfE&\205\t+\230F\0040\370#AC"
+	.ascii	"\023\374\355\2022\036f\350\025*\\X\240!\003\006\335\314\003\340"
+	.ascii	"L\260\004M\r0\370\253\t\002M|\bv\370\205\370 \003\3427\023\254"
+	.ascii	"\371=HP\003\004!\223!\b\fq\202&\200p\346\204%\321\212\232\364"
+	.ascii	"\231\363\263N\026T[NF\2236\300R>q(\321\332\013\0377sE\214\361"
+	.ascii	"\312P\316\244\317\025\277l\323Fxc\343\307\244\020\326G\316Z>"
+	.ascii	"U\344\304`T\371L\352r\214\253^F_\223\276q\277T\0137uh\374\224"
+	.ascii	"M\272\231V\371nI\202\"\022\337\334\250\221\312\026\317\244\257"
+	.ascii	"\333o\332j\001\243B\3031)\005\266\362m\233C\214\204H\223\222"
+	.ascii	"k\306c\250!@$0\224HNFRR\220\302t\240b\016\0267\021@\235\203D"
+	.ascii	"\320et\356g\304\026\031dbas\025\037\033\243\017V\020\017\004"
+	.ascii	"\372\223\006\307\364 +\273l?i\373\266#=\206O@\202k\340\033Kr"
+	.ascii	"\247\345\357\t\270;\214\252\323 \236\332\241\266?QB\217\037\211"
+	.ascii	"p<0i\356\223U\342]2\3069\016\333|\351A;\017\362\265\307\224c"
+	.ascii	"\207\306\354\324\002\377\341\261\021\004\360e\313\036\262\244"
+	.ascii	"\374Q\"\034N\002\b\235\3272:\033\202k\304A\232\300\324\203A("
+	.ascii	"\235\3026[\253\321d\004\372/\225P\320r\224\243\031\203\347kP"
+	.ascii	"\376FJ\362\177N\311?\006\263\211\025(!\214\204s\2368T\001"
+	.text
+	.section	.gnu.lto_.symtab.a91edc1c2e28a310,"e",@progbits
+	.string	"ownerNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a91edc1c2e28a310,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
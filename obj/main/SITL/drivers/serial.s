@@ -0,0 +1,773 @@
+	.file	"serial.c"
+	.section	.gnu.lto_.profile.e7908608f8aaefa0,"e",@progbits
+	.string	"(\265/\375 '9\001"
+	.string	"#"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\002"
+	.string	"\004"
+	.string	"\005"
+	.string	"\006"
+	.string	"\007"
+	.string	"\b"
+	.string	"\t"
+	.string	"\n"
+	.string	"\013"
+	.string	"\f"
+	.string	"\016"
+	.string	"\017"
+	.string	"\020"
+	.string	"\021"
+	.text
+	.section	.gnu.lto_.icf.e7908608f8aaefa0,"e",@progbits
+	.string	"(\265/\375`)"
+	.string	"-\007"
+	.string	"\362\213.4Pm\323\030P\013&\027\241&\315\220\t\f\023\320\251BD\330\376\315\3739\360\371D\352\274\266\204\252\252\252j\316\314\314,\033m\337MhI\333mm\357-\251\355\217b4\033De\257P\205\204\016&\333\263\243\305Pp\300\201\355\330\006\016\236\206k\307(\n\021\013\315z\322\203G\206\253\373UABP2\325n\035U\027\034\315\206\332\253\024\3506\022\272W\307\332u:4&\334\244\214TL\327\345\363\341H\020n\\>4\271S\021\b[I\fX\3108\201q\372\323\204\033\360\354|.\353\246atOO\357\222\234\240\020\007\212vy\374\r\207\357\037\375\246\223@b\"\364,/\002\b\021"
+	.ascii	"`<\b\007\306a\204\261\300x\020\016\030\0374\352\r\007\200-2\245"
+	.ascii	"\260HP\204Y\023pa\212\"5\231\367\025`\b"
+	.text
+	.section	.gnu.lto_.ipa_sra.e7908608f8aaefa0,"e",@progbits
+	.string	"(\265/\375`\376"
+	.string	"5\005"
+	.string	"\"\306\022\033\260%\351\f\3030\f\316\3610\f\303@\336\254\265\304Z\333lk\244\021B\266L)\216\260Zz\360\002\003ATa\322\004\206"
+	.string	"\2162F\305*\331\037]\2259(\215t\265W\352\224tI\216\031\366\365|\375\035~\265\250e\301\023\001' \220\"9f\036\246q\240\372xe\317\331\006\f\342$d\246\341\346\306\261\334\203\206\216u\367\203\322*\371\020\220\201\3764;\216\0216\t\344\027 \"/\204\2111J\3215\314(\210'!\307\025\322\026"
+	.ascii	"tt\260\360\307\035\017FR\3428\214d\202\302\t\320\b\336\220\246"
+	.ascii	"\206"
+	.text
+	.section	.gnu.lto_.inline.e7908608f8aaefa0,"e",@progbits
+	.string	"(\265/\375`G\004\245\n"
+	.ascii	"\322O43`m\322\030 ]p\016\033\203\377sr\373\306\256RO\210\rF5"
+	.ascii	"\343G\021\t\321\031\353'\035\200\213\n\r\202`Ve\321\310\232\t"
+	.ascii	"\222&M\032\331R\312\024\357\336\356\245f):uT`o4\033\f\215\221"
+	.ascii	"\224\353L\202\236\354n5\006p)\306\322K\265{\230\035\216e\367"
+	.ascii	"\364\307\232G\033\242\354\202\262)\3672*\007\022\361uMTH\222"
+	.ascii	"\335\305\334\276\235\006\236\264\274\303\356\202\276\215\033"
+	.ascii	"z\300\350\321\266~\304\256\304\225o\006\307)sn\221\360\021A\037"
+	.ascii	"VB\243\352?\nbbQ\302\026\364\"$\242\242\031wo\213\224\217\031"
+	.ascii	"5R\340gF\375A\356\356\336\360<?Y2\232\360\270<C\206@\224L\235"
+	.ascii	"\374\005\022\023\307\006\375(\231D\004\317\231*\b5 \260\"\221"
+	.ascii	"\271\352\001\304)\263\310\003rQ\255\005$;\347\350\274\320e\361"
+	.ascii	"Ei\333\320\013\215$0\225\3548]\230\243wGF,\257k\364d\220\205"
+	.ascii	"\211\230\016$6Y\234#\244\261B<\201\246\013\256CxD0\\\334\202"
+	.ascii	"$\365X\031\371\021y\031I`\017s\200\3005\005\2301\t\266\376\353"
+	.ascii	"]t\321MF\027\270Q\262\033\310\215\340\340Xq\202<\024\214\367"
+	.ascii	"\016\214\267\215\277\2450WZ\210F+n"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e7908608f8aaefa0,"e",@progbits
+	.string	"(\265/\375`R\002-\006"
+	.string	"\242\211\034#\220'I\007\377\377\377@\375\377\177\256\273\273\323\342\273\334S\343\021Y\375\377\357Go\177k\266\221Md\222\001+\250\256\t\202d`\342\n|A !"
+	.ascii	"Q]r\3169\227\350\200\033\216x\002\034\2109\016U\316\313\033\325"
+	.ascii	"\365\261t\3110\325\215@\206+_\252\237\025\306+\f\216$O\036_\335"
+	.ascii	"g\252n%-6-\336Vb\202%\326\220\f\177\231\301JC\" \260\302\272"
+	.ascii	"\272\001A\246^\260\0235i[.\251\205MDx\226\314;\347\202e{\311"
+	.ascii	"\2176'\031\241\302$\302\341;Y.\321.\203\027AM\3051&\210\3601"
+	.ascii	"\022\310u\222\t8\027\373\255]HW\220\202\242\354!\n\256\r\027"
+	.ascii	"\200\026z\305\033\002"
+	.text
+	.section	.gnu.lto_.pureconst.e7908608f8aaefa0,"e",@progbits
+	.string	"(\265/\375 ;\331\001"
+	.string	"7"
+	.string	""
+	.string	""
+	.string	"\022"
+	.ascii	"\271\004\001\232\004\002\271\004\003\205\004\004\231\004\005"
+	.ascii	"\231\004\006\231\004\007\231\004\b\231\004\t\231\004\n\231\004"
+	.ascii	"\013\231\004\f\231\004\r\230\004\016\231\004\017\231\004\020"
+	.ascii	"\231\004\021\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.e7908608f8aaefa0,"e",@progbits
+	.string	"(\265/\375`.\001=\005"
+	.string	"\342\005\025 \200K\322\001\210$$\203&h\202&h\002\202@BL\3031\2244\034\333\266\255m\244\265-e\n\377OK\242\202`\007f(P\bk0\021\250"
+	.ascii	"\340\221\244\362\b\2028?\224\342e\301\277i\274t\273\243\274\321"
+	.ascii	"\333\215_9\243\035a>\226\2172\351[qW* 0\003\t\212\334V\020\273"
+	.ascii	"B#\034\017\034\241\206\031\036\244#\331\203\304p?\360\002\265"
+	.ascii	"\230\325 -\024\342;0+\260c\254\254Q\325\210\335\3010\241\253"
+	.ascii	"\3014\210\362\026\001\n\314\264l\311A\262\350r\347_nAZx\250i"
+	.ascii	"Hh\245XT\230!"
+	.text
+	.section	.gnu.lto_.lto.e7908608f8aaefa0,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_serialPrint.8.e7908608f8aaefa0,"e",@progbits
+	.string	"(\265/\375`\256\001\225\020"
+	.string	"\366\237oF\360\262&\035\"B\017\313\213\375d\"\221_.\001HAG%\"(uh6\202\320\247gdM=\265\335_\031y\177\005*1\256%R\030\253\236\201g\340\365f\266\242q\034a\302\255\337\361\357\200\032\021B6\2212\245Z"
+	.string	"W"
+	.string	"^"
+	.string	"\273\241\002\227p\217\016?@{\344N\242=ze\017\025h\001\320\231\341\361\261\273\236\222p\226\253\307Ls\345\353\017\027\b\363\230m\255\032\023#`+\033\305\210~\016{\322\200\254\314z\236\036j\270P\330\\\017;\202\024B.\320\346\271E\330]\247\013\344pk\267=\301\366\003;3\026\371\353\017\371\316\315m\017\377\370\360V-\2351\375"
+	.ascii	"[\017\022\240\335\232\" \033\024\177N|\347\267\357\363\274\307"
+	.ascii	"\356\314\362\0276 \242c\261\273\307\037\346\316\f\034\254\276"
+	.ascii	"\323\222\355\007\b+X\020\355\206%\217\036\331\031\272\f5x\332"
+	.ascii	"oq\027\253\277^.`\367\306\307F\272\351aO\300Ch\203\nV\266\273"
+	.ascii	"\233y$\257!\352N\335\215h)\214\3513(p\2732'\276\f\013'\025\355"
+	.ascii	"\261S\0028^\357\361\205\307P\341v\367\304\367AI\361s^\264G\021"
+	.ascii	"\r\221\243\363\342\364\252\035t\314\004\211\311\"\205\001\324"
+	.ascii	"\002Uq\354\220\225\037\225\210\021Yol.\335m\031\025J\371\255"
+	.ascii	"\250\324TB\221VT\250\023\347\222\t\n\351\364\231T\236\3523e8"
+	.ascii	"}\022<\324\211\224\342\225>\225gr\300)\f\246\317[I\245>\257\013"
+	.ascii	"c\2567EA1\312\212\212\343\230n\352,\243\252\322\370-\032\247"
+	.ascii	"\337\001\313!\2231\247r\232<3A|\032\032H\317\361]\264\307\324"
+	.ascii	"\274A\003b\3015# \240\202\2212\343\001\241\300\252;\374eh9EH"
+	.ascii	"\037\277T\202\371B\263\017%3\324%\344c`V\241\346\241iLmV\300"
+	.ascii	"2\022K\240%r\271\341\260\035\020!Xt\354:\202\340\321\304a(\344"
+	.ascii	"\262\215\b \212\272\026\227Vl\371\330;-}\002"
+	.text
+	.section	.gnu.lto_serialGetBaudRate.9.e7908608f8aaefa0,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"\r\b"
+	.string	"\222\21777Po\322\001 ;\263\322\314\240\004\016/X\276\350\025X\374Y\205j\304bk\b9\007\203\266\214`3\203\020\202\252\212\210\224\240\026\257\365j\343!f\274\303n\262wJ\001V\205Q\035\r\273\244+N\003uQK\233\032\265 .\3120\261\213r\230\025\325&\247\300\331\203Eg'\313\350\314\324\275!\324\200 \205\355\210\2238\271\273\n~\310\204\204\334x\364=\0203\002\275\222]?\017b\330\237\026\212\f_\3777aF\006Pv-J-\273\022O8lov\306\366{\366G\377\330^=\017\330\025\245\230\354\326\003\033\310GWi\333\357\270\307fn\252\032]\002I\205\b\313n\235\232\023\\\036\247\013\\\036a\306\271?\316?\3107$\225P\367\371\003X\330]\277Pwq\303\333\336\330F\260]\022\f"
+	.ascii	"2\003\302\260\2268\3742\203\027c\273kx\306\004\016i\214\006L"
+	.ascii	"\020p\242G\265\322\021&\031"
+	.text
+	.section	.gnu.lto_serialWrite.10.e7908608f8aaefa0,"e",@progbits
+	.string	"(\265/\375`\217"
+	.string	"U\n"
+	.string	"V\224H= \3458\035'!\210%\300\200\310\200E(6\254\250}\b\331\317\200\222\024\374@\324\"\024!n\2036V\356\345\370\006\224\254"
+	.string	"\204@\001\032j\324\017\240\270L\266\201\322\334\304\270\255\334)\0055"
+	.string	"5"
+	.string	"9"
+	.string	"\273#\307\021\331\247\307'`\237\331\017\260O\213\266\200\205S\301\f\352e\300\356njr\361R\364\317r\202\224\252t9P\261\273\226)\225\310\255\267\375`\333c\037\"\376\370co\375S\245uJ\313\215\3643m\004\341\265\033\362\"\260\256Ysb\373\232m\225\266\004\205\370\261\303\272K\022`\342\322\276\312W\304\267H7\330]\311\320\004'-\031SU\016\252"
+	.string	"\306c@\331.\210\307\207\361\370F\330\247T\005"
+	.string	"\336\270\313(\333]\217\337\"\n3\026\t\373\2746\260RZ&\371\262\307\222\324\022\373\233\335]\353\312\001\027\234\354\270\320G\024\206\274\314\\'\343\343\201]\270\205`\307\341\201\026[\310\373\2006\016\f\267\016\203?\215\016\334D\337\007n\332\270\337\254\256<Q\\&\375\260&U\247Z\252\035\002\016"
+	.ascii	"2\241O\034X\\p\300PJmn\351\254\322\342\316CX\351\032\020\025"
+	.ascii	"\006\203\271\001*J\270\303\213v\222\001"
+	.text
+	.section	.gnu.lto_serialWriteBuf.11.e7908608f8aaefa0,"e",@progbits
+	.string	"(\265/\375`\204\001\305\017"
+	.string	"\366\035kF"
+	.string	"\221(\035\277\204\\\364\205\232j\3270\031\356\035\362[e*\326\372\033\335\t\246\361\211z\227\t\277\233\265\206\204(}Vz\264_y&f.\355\025\201\335\3613\001\200E`'\366=\201\020a`-R\311\336r\247\024U"
+	.string	"V"
+	.string	"W"
+	.string	"34\273a\211I\270O\207\027\331>\271\207l\237\006\355\032\0062\004\230\261\241\246cw;\035\001\202\n~J\215\240\377\332;\255W\352\223k\271\364\274Z\2562\304\305\205\315\307\213%\023\330\230\b\361\332\243\353\265\212\021"
+	.string	"hw\035[\257\017\367v\333\020l\203\354\333\004?\367\230{\236v\313\031\035e\364\005\f"
+	.string	"!bc\327C\316\216\255\2311b\217\271}\026\276L\314\nh\305\301\001\316\315\215\335\220\344\323\f\270\317\177l\353\212\317\300\323,C\202,KD\007\232\335-\361\002\356\363\200\214\341\312\016\005\217\366Q<\005x\031\313\t\354\302\002\237\350\321\216r\352\250\366T\324h\320\024\310K\217\231\236\264E\2150\243\301\2128\266'\034\006\211\333e\235\370/0\230T\266\317\250#7\256\360\031\025nwO\374\026\245\023G\202e\373\274\"\210\235\220\251b\216\035\256\242\302\330/\340\302\003\207\025f\237\366{\036\376\235\313\002)G\225,\230D3\204\n\241HOT\n\241N\245\021g\221\t\205\320\350\363N\335\351\363.\214>\224\2564\n\221:\321w\352LFlJ\361\276\016e2}\335'T]a\2657\310Q\243\322\325T\030_\346\017J\274\304\216NuYF\217Ju\331\037\366$\304\267\274i\352\033NNL\006\036"
+	.ascii	"1\003\367\334Q\343\340\033_\031E\321\004\361\020u\026\372\337"
+	.ascii	"XK\316,\247\024\344\226\342\276\254\335Yc+\264\264\321\255M*"
+	.ascii	"B9\210\001\314\351\200\rh\242\004|A!\270\f\214\bPQ\304]\336\331"
+	.ascii	"dS\230k\264\n\n"
+	.text
+	.section	.gnu.lto_serialRxBytesWaiting.12.e7908608f8aaefa0,"e",@progbits
+	.string	"(\265/\375`p"
+	.string	"\225\t"
+	.string	"F\322B;0\345(\035"
+	.string	"\360'\031\235G\241\032p\021\275[Y\254f<r\na\234\372Z\265\372\373\\c\rb0\033\005\261\23100\320\004\302\372\207{\350aMa\321\021 vo\262wJ\0011"
+	.string	"0"
+	.string	"1"
+	.string	"6aUd\365"
+	.string	"\200\203\245f\267R\316\013\346%v\202y\031Cn:4\371O\271\202\213F\265:\035n$v\327P\265\362\270\343m/\330v\260\037\020\0304\214\320\337\b\304\034\310\354v\274\002,\214|)\261]\2625\333\020\332o\035\245\364J\372\300.k\306e\2676\230!\273t\315l\373&?)\005\361d\233\342.P\213F\2271/aL\360\305W\276l7\005\341\253\21402\222K\2374/\037\rFZ(\370\262\353\tF\020\373\330F\226\347\353\217\005\333'\344\021}!.\363\247S\341\341\274\355\243\237\267\2158o\202\2068\017\210~\274\217v\020\334Yl\036\025u\235G\265\272\367\214\034T\334\260\006\261h\030g\214\370H\005\016"
+	.ascii	"2\003\302\260\004\346f\220\035\330\233\322\\q\3062\327\360\220"
+	.ascii	"\t\034\250\361\0320\361\340n\217j\245#L2"
+	.text
+	.section	.gnu.lto_serialTxBytesFree.13.e7908608f8aaefa0,"e",@progbits
+	.string	"(\265/\375`s"
+	.string	"\245\t"
+	.string	"\266\322C<0\345(\035\200\213'\025U\207?\030_\006\2542Z\311\f\217\315\245\017\013A\314\345\330\372\365\367\271\306\032\304`6\nb3a`\240\tD\235\026\245,J\300\251g9\322\366\336{\247\0242"
+	.string	"1"
+	.string	"1"
+	.string	"6\305J\262\232.\216\r\027\002\273\225rn0/\343\013\346%\034\271\351\317\344\237\345\021\005\004\200ju\372\323D\354\256\237j\345q\303\333^\260\355`\177 1>?\370|\315\374\020\200\020\263\333\361*\260\001\344\314\211\355\222\275\261\375\236\375\326WJ\257\244\023\354\262\006\310\354\326\0063`\227\256\230m?\345*\245'\333\023\207\001\275dl\030\363\362A\005[\274\245\303vS\017\276kt\201\231\\\372\244yyxP\322B\275\227]O\017\212\330\217\273\273\206,\317\327?\331'\344\021u!\r\363\247C\341\321\270\254\243\035\227\2154N\202\2064\017\210~\270\216v\022\274Ud\034\025m\033G7u\357\t9(\250\341\315\213\320\017N\b\021\222\202\001\r"
+	.ascii	"2\003\302\260\004\346f\220\035\330\233\322\\u\3062.\243\0245"
+	.ascii	"^\007&\036\3345R\255\230\204I\006"
+	.text
+	.section	.gnu.lto_serialRead.14.e7908608f8aaefa0,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"e\t"
+	.string	"\346RC8@\217\322\001\230\265(~\343\005\304\200U\304\323\f0\321\2140\266Y\334\335\037\255\336\376\225\305\0061\030\316\016Y\364*\n$\303\2510\003\263\007\\BK\314\344\357M\266L)2"
+	.string	"1"
+	.string	"2"
+	.string	"\332\005\346\245m38\230|z\b\302\232\035\031\0300\231\335p\213\037?]O\376Q\236\225l\304V-\324U\003\261\273\326UK\343\216\267\235`\273\301\276\003\236\177\375Y\246\326\250\276f\222\300\024\304\354\262b3\373\"]Fl\233\354\215mU\373&?1\375Uz\300\256\213\245e7\\\260\202v\351\360\003\3632(\333\240\303<mW\325\361W,(H\363R\343\201\301\253\220\264\335\355\370)\243\nM\344\322/\315\313G\202\220WJcv\210\322\350a?\333\335ut\005\334'\344\021\201\241N\363\207#\341\351>\016\334\300\217\033u_\304\026\352<\240\355\363\201\033\307\300\336\004\367m\"\317\373\266M\270\367\214\b\251xa"
+	.string	"\315\2425\316\370\300\241\212\001\n"
+	.ascii	"2\003\302\260\013\314%`oJse\031\313\270\214R\324x\250\016aL\327"
+	.ascii	"$\003"
+	.text
+	.section	.gnu.lto_serialReadBuf.15.e7908608f8aaefa0,"e",@progbits
+	.string	"(\265/\375`\222\001\365\017"
+	.string	"\206^lG\360\260(\035:\234\3413\347.M\223g\244s\336\260\315\354\023\326o\257\203Sz[\013\2604\322y\027\027\263\326\020\223\037\336\244\257~5O\377\017lT6\221\311\020\264h\371n\021/1\256$\fH\2030\262\211\334)\005U"
+	.string	"W"
+	.string	"W"
+	.ascii	"46\273#\210?\270O\217'\260}r\357\330>\035\3329\037[\3661\026"
+	.ascii	"\n\263\031\273\373)\207P\206\237\232\312\320\377\354\035KD}r"
+	.ascii	"+\327<\342\312U\353\310@\002\207C\\i\007p\\X>\273l\211*)\001"
+	.ascii	"\214\354\256%K\304po\267\315\300\366\210}\031\001\236\303\376"
+	.ascii	"\3562\262{Ni\251I_\300\206\202"
+	.string	"E\201\025\273\026vl\354\3154\341\3412\267\037\343\317\310\240|U.t\255\026\032tv\307\217O/\340>\357\331V\021\217\205\227\371\204\273\335\r;6\273\013b\005\334\247\001M\216(0\020\\\332\207y\210\360\260\224\017\330u\005\322S\217vj\251\016\020\363r\243\242(\325\207\030\025T_\376h\223\332 \366b%k\330~\360\232\021\267\273\022\361KL(\235l\237R=\\\030\302G\234p\273+\342\323\224\230\270\016)\333\347u\2125 `)\271c\217*\251/\373\177Q\221C\303\352\262/\373\275\217\177&?\221\"\224@\363s\372\220h!\020\351s2\221D\234A!%\037\021\0302}&0$A\004\222|$\321g\364\201@\323\027\342\341\222I\b\374N\245\022\370yc\352\352\232\235\213Iq\223R\325\324\227?\363\016\306\345\206\364\350\246-k\322\323\251-\233\303!\007\362,o\212z\202\226\032:\232\027\036"
+	.string	"2\003\376\031C\307qX\276\355"
+	.string	"\371\242B7zC\034f\207\273N\251\3151\235\275\331\270\276&\204\270\206\\\263\"\353b\227\336\360\nj"
+	.ascii	"s:`\003\232(\001_P\b.\003#\002T\024\340\216\354l\262)\3145Z\005"
+	.ascii	"\005"
+	.text
+	.section	.gnu.lto_serialSetBaudRate.16.e7908608f8aaefa0,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"\275\n"
+	.string	"\266TKA0\251(\035\210.\377U}J\363\f\305\223\363n\357Z<\203\241\013rL\0369\250\034\032\226m\326\342,\262k?9F\373\b@\333\004\225T\230\t\271P\274\342\252\225Z\212j\370\330\375\311&{\247\0245"
+	.string	"9"
+	.string	"9"
+	.string	"a\205)\350\247\303;d\237\364\r\331\247A\033\302\303\225\375*"
+	.string	"\t\213\302\356V\251r\360\021\364\277\372\305t\"=Z0v\327\321t2\271\345mO\330\276\260_\003W\375\363\251\037\303\242\243\214\276%\213\340"
+	.string	"b\302n\311\253\302\266&\003\001\266\217\261\035\303\027"
+	.string	"\257\372\360e\027\305eA?%\260G\373\003N"
+	.string	"|jt\206]T\002\005\273\001\322\230\223\021I\262\3359\202\216\356\212h\374\003 \036\242\3543\312\207\007\376n@DwW\343\263B \n`\224}^\312\005\r\\\251R|\331!)\312\024\373\330\356\256%\312\016\333G\323\340\200\264\r\272m<\332\347\363p\324\233\f\207\306y\333W?o\013q\036\247z8\255S7\336W3\021\356:6\257~\272\316\253\230p\217\255D9CB\253$C\274\020\247\304\244c\017"
+	.ascii	"2\241;\034\030\270P\224\332\021\323\001Y\013\241`B0\327\330b"
+	.ascii	"\230\027\204\317\324(\270,M\215\006wy\321N2"
+	.text
+	.section	.gnu.lto_isSerialTransmitBufferEmpty.17.e7908608f8aaefa0,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"m\t"
+	.string	"vRC<0\345(\035\300\363x0\275z\260\3200\216\270,\334\206\265 c\303\335\005\354\372\277_\255\376>\327X\203\030\314FAl&\f\f4\201\302\234\207+\003%&\203\024N\376\336d\313\224\0021"
+	.string	"1"
+	.string	"1"
+	.string	"\004\362\321\266\035 H.\375#Q=$\245\3035`\367\233p\344\245k\311?\3131\224\217"
+	.string	"\251\225\351\252\231\330]kj\345q\303\333^\260\375`\337\001?\206\251\025\252\257\221\004"
+	.string	"\034\310\354\252^\005v&\306\234\330&\331\033\333\252\366U\276Bzk\364\201]\226"
+	.string	"\230\335\257\301\f\331\243\277\027\310\307\354\001\320d\273\342\256\317\313\006\247!\037\025&\030\343.^\266\213\212\360[D\031\231\311\243?\222\217\207\006%\255\223\276\354\317\244P\304>\266\273k\310\262|+\232\007\324\ty\240-\263\207c\321\331:\315\233^\247\211\266\216b\202\266\316gz:or\020\314]h\335\fq\\77\337\336\022*\234 \2077\212A+\224P\002\004\025\013"
+	.ascii	"2\003\302\260\004\346f\220\035\330\233\322\\Y\3062.\243\0245"
+	.ascii	"\036\252C\030\3235\311"
+	.text
+	.section	.gnu.lto_serialSetMode.18.e7908608f8aaefa0,"e",@progbits
+	.string	"(\265/\375`\226"
+	.string	"u\n"
+	.string	"v\024I=0\345(\035"
+	.string	"\276\374!\332X\317\240\322dP\2357X\017'(-\266\030\252]k\215Vk\270\217o\272A\f\306+(\331\r\003\003\032CG\341E\213\324:y\005\206J>\331d\357\224\0024"
+	.string	"7"
+	.string	"8"
+	.string	"\nN\340N=\276`;\345N\260\235Z\264g>\206\354a&\030\261"
+	.string	"\273['\310\305K\321?\354\233\025+u\251i\330]\313\025K\343\236\267\215`\233\301~\r?\275\353\3274i9\245\257\321l\300tRv3f\003VF_Fl\237c[\216?\021\377\232\360f\327\003\300\002wz\240]\332'y\211x\027\352\003\273-\226\226\3351\035\0273e{\364\225\217\333\265\370\370*\024\021\247\355TN\003\031\207G9}\374\230I\202\333\335\213\240\266\323\317\351\022#\300\245\2223{L\311\371a_\333\335\365l\331\177\005\235\350\033i]\210\004*\205$\217s\310\363"
+	.string	"\362\300.\254!\330\231<PTI\036hTC`X=\035\177\020\035XK\337\007V\316\270\327v\266\354\300!S\315\n\013H:\265i9\315\t\017"
+	.ascii	"2\241;\034\030\270P\224\332\221\251y\255\240\n&Xs\215-\206yA"
+	.ascii	"\370L\215\202\313\322\324hp\227\027\355$\003"
+	.text
+	.section	.gnu.lto_serialWriteBufShim.19.e7908608f8aaefa0,"e",@progbits
+	.string	"(\265/\375`p"
+	.string	"}\t"
+	.string	"v\022B:@\3056\035\340\005\335m\035\240T\2443\322\177G\022L\372\210~A\006\315`\252\227\234\243)q\034\243\224R\340RB\034G\301}\345\316\207\232\276\004\375\347\340+\223\221\266\345N)."
+	.string	"2"
+	.string	"/"
+	.string	"7\250NY/\250N9\264\001|\024\331\213R2H\247\335\2754\344\341e\350\237t\001\361\343\271\2744\354\256\245\370\331\270\365\266\021l3\330\327\224\312\210\355cl\353\311E\341G^\231\003{\361!\226vW\343\005\353\324\301\224#\305I\341\322>\311K\302\207\334r\202]\220Iiw\3248\301:\3451j\341JNU\225jw&\344EK\024\016\023\206z\354\321#\025\304\376\334\335\265\202\354\217\376\371\361\327\207~Y]:X2\001v5\006\bXS \327\3512\n\0031\316\3242\016\003?n\263\234m\036\260\315\323\276\353\3634\211\315\343\\\334\206A\\\231\367]\233\214\273\b\315\273\300\256\363.\314\270\237\253 ;x\230*\002\016"
+	.ascii	"2\241\017h\340\341\302\033\327\200\001\033\235\022b\300\225%"
+	.ascii	"\214\013T!\270\f\214PPQ\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_serialBeginWrite.20.e7908608f8aaefa0,"e",@progbits
+	.string	"(\265/\375`\264"
+	.string	"E\013"
+	.string	"6\025NB\020mj:(\\\004\343\334\346\205\250\366X\226\033\307\331\204\274q\205\321>\215F\271\202T~/\201B\027^\374!Asz\353\034<"
+	.string	""
+	.string	"p\005\024"
+	.string	"p\210p\036"
+	.string	"\240\004\213\302AD\310\322&[\246\024:"
+	.string	"8"
+	.string	";"
+	.string	"\037\035\354S \016\250L\354\256&\033\034\374%\025\364\217\272D$~~-\270\274(#\r,\0131\2746X&\006G]\021\210!\325\210\307\356ZE\242\202{\336\366\207\355\016\373\226kI\262\177\372\247T\253\252\037\211H\b\221\361a7A+\305\256\246\007\b\023\333W\373\024^\001\374\311\363\213]\322\006\016\273#\2075\262O\217\307\300>\263S\260O\203v\211\336`*AR#BEa\273\273j\223\355\206\027\037\203\201\257\203}\252\254\210\360\200_\350d\273{\361-p\nd\017>}\017\366y9E\022'N m\331\343Ge\311\376\265\273\001[F\203\341|\032.s\306\002"
+	.string	"\303y\333\247}\336F\200\363B4\r\207\t\240e\274O\263T\334\t\330<\215\323u\2366\031\367\023V \031\272$:\245U\272\"C\204U(?\3122\215:HY\262\003\021"
+	.ascii	"2\003\302\360\314\302\242mP\210YVh\253q\310\034c\002VjGL\007"
+	.ascii	"l\231 \nF]\302jV\243\305]\236\252\311)\232\332\003"
+	.text
+	.section	.gnu.lto_serialEndWrite.21.e7908608f8aaefa0,"e",@progbits
+	.string	"(\265/\375`\264"
+	.string	"=\013"
+	.string	"6\325MA M5\035\224# B%\216\013\344\340\304\002\230\372N` \346\204\211\\\202y\353@\370E\240\320\247qz\264\261b @b\002\0022\350j\235\230\347\2064\377\b*\224\374L=>\267\245M\266L):"
+	.string	"8"
+	.string	";"
+	.string	"\037!\354Q \022\244L\354\256&\037\034\374%\025\364\177z$$z~5\270\274&\242\f,\0131\2746X%\007?]\025\210 U\210\307\356ZC\"\203{\336\366\207\355\016\373\225k9\262o\372\247T\253\252\017\201x\b\221\241\332]\320J\261\253\311A\202\304\366\325\376\204S"
+	.string	"o\352\374bw\204A\303\356\310a\215\354\323\3431\260\317\354\023\354\323\240M\"\326`*\001\240F\204\212\302v\367\224&\333\r-\376\005\004\037\007\373TI\021\341\002\267\300\311v\327\342W\330\034\310\"|\372\035\354\363r\212%N\230>\332\262G\217J\222\375kw\003\033&s\331|\031.3\246\"\340\302y\333\247}\336f\200\363\002h\031\3562@\303x\237V\241\270#\260y\332\246\353<M2\356?\254>\022tEtJ\253t\205\252\303*\224\036e\225D\033\244$\331\001\021"
+	.ascii	"2\003\302\360\314\302\242mP\210YVh\253q\310\034c\002VjGL\007"
+	.ascii	"l\231 \nF]\302jV\243\305]\236\252\311)\232\332\003"
+	.text
+	.section	.gnu.lto_serialTxReserve.22.e7908608f8aaefa0,"e",@progbits
+	.string	"(\265/\375`\016\001U\r"
+	.string	"V\032]C q\223\016C#M5|\342\220\n\236\271\027\023\001}\264\016\201\024^&\032"
+	.string	"B\210\316\360\235F\210\364\235\222\212\026\030S-\314\226\361\007"
+	.string	"\016Ks\274(S\306f\224\021\374\bK\217&m\357-eJ\001K"
+	.string	"F"
+	.string	"J"
+	.ascii	"?q\024#\223\020p#Tb\027\203\342\242c\227\263\314\375@<\254^ "
+	.ascii	"\036\252\210\223\3764I\276\366\0075TG\243\305\266r}\002"
+	.string	">\234n\004\330J\317\222\301\342\341\3353e;\311\314\214\354\256\223\303\246r\303\333\206`\333\201}-o\3713?\375\321i\205\351|\351\003x\300\351\300\221 \265\333!\205Z\030\370\242\204\355\221\275\261\255i\237;\313\350-\206a\315.\210\230\227\335\005q\203\352P\301s\346O%\037\260k\212\361\262\313\201\230Auh\333\001(9`4\250\226=V6hjPL\215\320\331(\345\016\333\023\316\002T\355\226D\374\025\031.\222x\230\372Q\303\026\236\202D\304w\301\262jwO\342\320/\211\207\327w_\260\241L\234L2esZj\b\373o\325d;\255\t\242\320\205\253\003=\235\020G\224\205>\225;!\0248\037\314\223Y\031\346\301\360\301$X\241\017\007du\260\314\n\371\360U\301\203Y\242\353\302\254\r\267\177\253&\307\031<T\270H\237\024\337\235\200jT5E=b\242'o\223\031\215\352T\215\032\b\023"
+	.ascii	"`\204\036\262hp\013e1{\025\325\002\b\244#\304)\023\206R;>5\257"
+	.ascii	"-\201\270&\212\333bwh\202\300\t#\264!~:C\225:E\255\332\003"
+	.text
+	.section	.gnu.lto_serialTxCommit.23.e7908608f8aaefa0,"e",@progbits
+	.string	"(\265/\375`\230"
+	.string	"\235\n"
+	.string	"\366\324J? \305j:'!\210\005\244#\013\025\020\374\230G\303yU\002m\022a\001\306\nDI\265X2\206~\247\037\337\316\020*\001B\024\300\220jF\330\325\216p \200\204\224\022\013\030\262\264\311\336)\0056"
+	.string	"8"
+	.string	"8"
+	.string	"[f\334\260\275\272\374\201\366\272\335@{5i\033x)\262_%\330`\035\330]\216\206\234\374$\375\257n)\231F\237\225\210\335\365,\231N7\275m\006\333\020\366\035\002O\375Y6=\351\364+\227S\001\205\330.G\f\301\276\252\213\304\3661\266gy\024\362*\023\260e\367\003\326\332\335\214\037\266\327\205\354\323\276\311O\310\247D/\330E\rhm\032td\273s\001\341\266\233\261\361\003\\X\204\264\327I\021`\036\017 \264\355\356\306g\201>\333\210H{=\245\256\224\222\024i\306\354r4)\210\375lw\327\024e_\365\327\036\360\023v\325\353@\216g\004\277\315\235\206\202\363\211\336\310\215\242\007\372\304\t\016\3748\035\256\023GN\223\340\260\302\0239O\030\212\034\246\334gKQ\226\350x\221(\206/\263\322\214zRc<\002\016"
+	.ascii	"2\241;\034\030\270P\224\332\021\323\001Z\013\301`B0\327\330c"
+	.ascii	"\230\027\b\f\256HSS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_serialWriteBuf.part.0.27.e7908608f8aaefa0,"e",@progbits
+	.string	"(\265/\375`\345\003%\033"
+	.string	"\206\362\255H\260XQ:\320\025\r\016K\366(\302\022&\213\255\335\305\350\2339@x\345\323,\256<\030\306Q\256\017j\361\361[`w\364+;`>\252c\241u\241\365\306\215\241H\345.\360\017\016\305\243\"\006\003\377\255\021B6\221;\245\222"
+	.string	"\240"
+	.string	"\222"
+	.ascii	"\270=\202\023\323`\316\377r/\342S\363\253-\210<\247}\"W\322\275"
+	.ascii	"\210\317\001\324j\244$X\353\357\346\324\257\362\324\277\023\030"
+	.ascii	"O\313\013\030O\355\013\261\235\263\271\374\207\243\022Ygs\251"
+	.ascii	"\351\271\246\202\226\302\324Za\247{\303kr8\034\016/\376\356q"
+	.ascii	"u'G*\356,u\376\233\276R\341\3739\031\264\233#k\307\213S\232\035"
+	.ascii	"..\212d\217\205\216\031_O\204 \254\202z\360s\310\307\233+\340"
+	.ascii	"\263\300K\222B\255\325\337\301\270W\267]\303\266\005{\275\004"
+	.ascii	"\377\007<\301\220ZY\f\305\324\"\n\225\364\247G1\315\206G\243"
+	.ascii	"\202\2074UUy\277\227\315c\332\211\006\b!\001\n\301N\357\344k"
+	.ascii	"\337\207r)\2367\361M\2170<vk\311\243z\336\304\177\202\340\007"
+	.ascii	"\220Z\353\235\230\201\203\334\241l6?4\025H\313\024\003\007=\207"
+	.ascii	"\262\325Hx\342TU\341OW\342\007\357\304\0047_M\276\023\023\034"
+	.ascii	"\005 !\fB\252\252Z\177\257SO({\246\337\224\263[-\213\363L\271"
+	.ascii	"_\365\021Y\\:\022\335\2238J\244\251<\033+\202\265\326\b\345\251"
+	.ascii	"\215\270\363\300#\001K\356\267\004\215\361\255\3348\370H>n<\035"
+	.ascii	"w\345\003\314\220\214\335\034\322M\002\245\347\023M\033\305}"
+	.ascii	"\360\001\254$\001\251xSh\002\363\353]q#\024\361\366\247\303\253"
+	.ascii	"x\240r\342\303\316x\272\233 \307\245\f\342RB\224\265\362\036"
+	.ascii	"\370S(b>\222l<\235{\251+0\262\024Di7\207\336\213\265\326\272"
+	.ascii	"{\344=\004\034\302\252\271F\336r\024\016\223\274F\366\201\377"
+	.ascii	"\314\231~\031W\353L7Kfz\265\232.\305i\3225=\322\326\264\310\232"
+	.ascii	"\336\325\364\374/#d\263\304o\263\036\232\214\306n1\021b\216l"
+	.ascii	"\026\273\331f:\245e8$b:\265\034\033\314V\3131\241S\023\001\233"
+	.ascii	"\351\304v`\262\232\r\206s\300\264\02295\330\215F\253\301Z\266"
+	.ascii	"\347\177\241K\225\335\002\221{d2J9\003k\242\256\245;d\261\224"
+	.ascii	"Y\031!m-k\207^g\355\374\002\234\262\237`CHc\334#\333\013N\327"
+	.ascii	"\265\344\225\024<p\316\332\326\315\227\247\0243\200\346\320\006"
+	.ascii	"&\271_\257\326\255\242\336\376dx\026\r\263\017\253-@\025e\020"
+	.ascii	"\307\262S\326Z\037\370WPl\360\331G\375H1\224\306Q\250A8\246\034"
+	.ascii	"\"\206\031\021\211df\306\351\200\002\231:\272\r\020h96\035k\206"
+	.ascii	"\201dy\245\031(\360\345\031\332\341z\275\312\262\"\212|T\020"
+	.ascii	"\"\247\300\230\2055\373\345\3761|\277\330\254A\006\245\360\r"
+	.ascii	"\212\321\202\334\320\206\007\272t\206\205\304\311p\322\216\273"
+	.ascii	"\374\f\305P\204\222@\224\320\216\241\t\301\201\272ix\247\b\200"
+	.ascii	"\236\021\237\213\310\212\022&\255%\202\301\365\2614\323%?T1:"
+	.ascii	"a\376\257<Ls\374\304\216\235\025\377\236VY\307\3513\013\237\326"
+	.ascii	"\341\265B_\244\354\004\021\033\374y\034\261\350\020Z\027LyN\304"
+	.ascii	"\004\246\002"
+	.text
+	.section	.gnu.lto_serialReadBuf.part.0.29.e7908608f8aaefa0,"e",@progbits
+	.string	"(\265/\375`\256\002M\025"
+	.string	"\226i\214I\320\360(\035\240\007v!\244\221\300\277\b\023\365\207\361\261\354QH\210\360\203U4#\360\037\377A\273m\021\324Ae\3718TX\251\026x\245\365\033<\300\027\017\360\313m\024\023\301\247,\220a\253X]\320i#\215l\"wJ\001s"
+	.string	"|"
+	.string	"u"
+	.string	"/\004\304\275\220c)\355\003=\350v\241\227\207\354\362 \355v\305\221O\253\302O\213\037"
+	.ascii	"~\206\027\001?\355\243\260m\313\361\315\276q\321g\257\323\251"
+	.ascii	"!\322\261\273\253O\ra\3248\216\343?\361Vy\373\247r\336\374#="
+	.ascii	"e\223\203\371\367\241fpF\004\310\341>\224\236\023\357\273\313"
+	.ascii	"\233\\\214T\217\022\030.E>Q*\273\3530\303\r\336\366\003\333*"
+	.ascii	"\266\354\005;\223G\342Kgr\211\211\315\263o5|\007H\247\343\264"
+	.ascii	"8Qe\333%&.\236)\020PS\004\302\302\352S\332\367W\234\347r\026"
+	.ascii	"\236\036\230N\354\356\227\256\302\337])\251&UH\276RR\355K\223"
+	.ascii	"\223\272\241\321\301iWT}\272A\350r\037\311f\177|\370\223?\262"
+	.ascii	"}\342\346r\374\021\275\350v#\267pj\367\303\270\333\335\224\360"
+	.ascii	"\363\300\247\362\272\241\232\016\325l0\220\362\242\355B\001\376"
+	.ascii	"\324\217A\233\371?~\r\374\374\356\337N\307\310\006\007\210\274"
+	.ascii	"Z\365"
+	.string	"\323\224\035\234\302\264\016\303\025\356\342N\374\027\024\034\264\200\237\252\006D\234\347\327\233Z\302\335=\361]T\200\340\377\274\200\237R\317;\202\024F;\202b\344h\275\0325\315\344\244\366X'\212O\317\311\312c_\367{\374\350O\205\250\037\335\340LI\177\241\264\242\244\345\305\377 !\t\236vq\306\247\r,\247\301\\b\255\311\242\261V>W\013\306\242\315`\257\320-\222\b\254\227\3145[\315d\256\t/\331\312\n\366bIX\265d\263\025I\001\307X\\\262\025-\026\223\255>l\313\373aQ\323\214\030\225\371\264\307\2637=\364\273\217\324\220\241N\275\3617S\n@G\242\024\324\033\333V\035T\031\244\223\201\223=\353\277\335]\325\036\333\013>5T0\007\215\t\222\203\212\322\3636\2144\034d\344\0304 p\002)g\325\001 \342\220qy\023\030Y\227'S\323/\246\320*\304\344\332\232\td\371\344\356\027\244&"
+	.ascii	"+;\2647,\366VY\242o\376\260\0061\343S\363p\233\256A.\361e\340"
+	.ascii	"\t\3612\356\350X\314fB\326\233\b54#0^\021\366\307\353\025<\203"
+	.ascii	"<#\233Y\215W\242\233\035$\277C\033\013v\362\306\354\322\032\271"
+	.ascii	"\233*\373\270\271B\364\273\360\030"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e7908608f8aaefa0,"e",@progbits
+	.string	"(\265/\375`|\001\205\b"
+	.string	"\304\013x\002"
+	.string	""
+	.string	""
+	.string	"\002\033\177'\257\377\372\006\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 \035\177(\360\372\2508\b\177)\272\200\202\t\177*\200\200\200\200\004\n\177+\013\177,\362\375\231\027\f\177-\r\177.\016\177/\017\1770\371\356\335\273\001\020\1771\021\1772\022\1773\023\1774\024\1775\025\1776\026\1777\027\1778\005"
+	.string	"9\201\204\001"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	"\265\006\004"
+	.string	"u\004\001\221\205\327\307\003\001u\004\002\225\001\004\004\225\001\003\005"
+	.string	"\342\001\004\005\303\376\236\020\006u\004\007\b\003\t\001\342\001\004\t\211\364\264\203\001\n\013\f\r\005\"\004\016\321\231\263\346\002\017\020\201\211\224\376\021\200\200\200\200\004\001u"
+	.ascii	"& \340\"\242:\007\020\332\025\223\f\221\033m\"\310\231\230<d"
+	.ascii	"\330\353\230,\nd6\027Tpu\271\372?\b\037i\263!\241.\037=\372\215"
+	.ascii	"\365\r\376\215\311\337\370\r\337\370\033\343\b\357\033\342o\360"
+	.ascii	"\033R\304\344\317\202\200\006\342\314k\300\215\272\231-8\006"
+	.text
+	.section	.gnu.lto_.refs.e7908608f8aaefa0,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.e7908608f8aaefa0,"e",@progbits
+	.string	"(\265/\375`J\035\rz"
+	.string	"\272\303\364*P PRJ\007\3256x\357\256\211\365X\036\251\b\002"
+	.string	"\016\366\324\331\237\276E;g\312\005#\350l\004\376\214\306;\250\366\333\250\3247F\017<\366\377:\331;\001\224\2370\235r\213%\333eF\312\326%.\266\324\367\031\026\255\326\002F,\"D\312\0243\002\241\002\254\002\352\221\307\\[\257(\330\004p\345 `\017\007\001\337\364\245\210\233\273/\2473\351\271\210\036;\274\347X\257\354\305\306\t\327\261W&\342H\224\330\363sN\227\330\t\344\270t\\\033\331q\313\231\013C9\263\224\352\225\343\200`cN[\275\262\226\343A\031uD\365J\203}\f\354\333\363\233[\216W^\027\350\225\263\333\363r\276|\030\313z\375\036\216\224\217/\255\327\023\261?\267\261\261\031Y\227\254\2643\333O\301\005\\E\347\336\023\374C\210\351^\225\265\246\233\223B\366\312j<\205\315\020`*\247\340\202\253F\263[vo\333\263\3437\204\237\232^o\002\373?F"
+	.string	"\310-\243\365,\261+s\352\365g\264\237\231p\031KQ\225R\316\233vo\373\243\306M\311\205\365\032e\355A\005\313\226^\317\001k\306Q>k/\220\016\227W\0170\275^\210=C\371"
+	.string	"\307{\301u\330\357\035\356?\316zu\205\311\\\257o\366V\244-\233"
+	.string	"\262\034"
+	.string	"\360D\212\031P\304\360\023\377Up\035\360\253??\233\370\231"
+	.ascii	"\036\240\310\310\321\377*?"
+	.string	"'\300\0264*@\354\312\317\b\334\3559\277\372\302\323o~\225\350\377\335\317\007\340\211\351\032\341\377\231\237O|\372=\030\377\375~\006\372\337\007?O%\371\277\345g\006\316e\215\251\300\317\352\317\n\254%~\265\003\024\\\033\374|\363\263\001,\006?;!\371/\375\271\201\027\361\236_\355\321\371\325\013~v\3416\277Z\301\3175~\336\371y\001\025\230\207\306}~5\202\237\307~6\362s\221\237\305~\016\373\031\354\347\256\237\201\374\354\374\231\371\363\017?s\375\274\365\363\323\317=~\326\372\371\352\347\346\317\312\237}\370\271\207\237y\370y\207\237u\3709\207\237\233~\306\341g\030~\306\361\363\215\237\213?;\3603\r\377\221\376\213\371O\345\177\321\317L\377\325\374L\374\371\206\237m\374\274\364\263\322\317I?#\375l\303\3175\374<\374\277\366\363\321\3171~\016\376l\364\363\003?\313\360s\f?\253\370\377\342\277\334\377"
+	.string	"\376\376\376\376~\033\366Wm\374&\314\002zL\332\311\t\244\262\204\254<1\356S\2414Y\2643\035nM\244\241QtP\r\366\013\265[\017\301v<\311\366R\255\200\306\212\f\b\210d;K\222\300\332T\324z\216H\2251)\303NQ\263\201\243b\024\222\366VS\347\202\030\2136\332\372d,\353\253\3276\35336S\321\321w\224\226r\233c{\333\016[\243v\326\253\017\233"
+	.string	"\266j\307\236U"
+	.ascii	"\325\277?V\001\274\352\205]\3334\016\300I\2234(wv\353\0210mE"
+	.ascii	"\272"
+	.string	"\254\233@'tB\270\304\261W\253\260W\323Z\211\016\222*&\221%-\304\325#\354U0\366\352\026{\225\311^\205v\021\033h\0213<i\217\216\037\023: k\330\267\036\373\246c\337Y\330\267\032{)\233\020\022\004)y\005K\007\371\002:\177 \013\353\265MB\265D\001\351\265\313\034\177ai\226\317M\236\311A\261da\2719\241\216jf\223\277\263\372\207\356\321\\\rD{\365V\377h\255v6\220\366\321]l\326\317n\276\251\272\352@\355\275\311{\357+h\247\206J\323kc\037;\007\335\024+\262\251\223'\334\246\0039\006\013\034\277=!\275\350\3511\032\027NM\034'\2726\275.L\307y7\310-VdS.\373\205t4\024K\263\332[\225\203|bE6ub\205\337\302 \301i\372\236@*\357zV\305\212\214\354\336\366M\236m\325X.\234\2327y\006%\203d\236\025\325\364\336\026\002\b "
+	.ascii	"\202\240\204\332\225\226\231\023X<t\274\216lfWo\036<o?<\345z"
+	.ascii	"\355\035X,\360a\332\211\331S<{\\J\276z\371\236b\217\230\366A"
+	.ascii	"\365\332R\214\326aX\260\306\326l\272\370\356\332\322\260\347"
+	.ascii	"#\240Z\231\265\206\310\334\323[\331\247\343E7\244\253\3277\366"
+	.ascii	"\357\034\235\244\240\016\272l\344;\311k;\266\230}\245\261>}\377"
+	.ascii	"\324#\311\254\034~\347\277\033\2757\265\262^y\315M\033\021\\"
+	.ascii	"\356\372\210`\366\245\3515\210\325\340$\333\033\305\251+\363"
+	.ascii	"#\355\t{\026C3e\321\300\355@S\346<e\276\035+<\202`\353\225\371"
+	.ascii	"\232\367\370\314\231\217\315\350$\231o\275\367\310\234\202\207"
+	.ascii	"9\205\r\234\330\361\f\270\236\203\260\337c2:\255\361\346\221"
+	.ascii	"I\002\207\314\335\230d\313\203\364\001\r\022\305\242\310\303"
+	.ascii	"\333a\343:\022\344\356\214\267\032s\314\255\351\225\307\214Y"
+	.ascii	"B\265\354n\252\264X\241\352\225\305\364\234Y\232\251\353\365"
+	.ascii	"|Y6\202\217`3\016\363s\035\203\371j\346\274\321{\333\235GUyT"
+	.ascii	"\237\200\367r\353d6oV3\350\352U\215W\221f*R}b\215\367\032\333"
+	.ascii	"\313d*m\035\337\364fe\005\315\240\342\345Lu\272\372\264\363\205"
+	.ascii	"\306\355G\257j\216\034\346^\335X\257j\262\245;\177i\376\242\353"
+	.ascii	"\032\373U\b\366\357\037x\217\315{o\225M{\233H\235\263\rs\320"
+	.ascii	"\277\303*/\360\177\275\352\177 \245\366\032\245 1\303\216\265"
+	.ascii	"\035}\034\305\375\245\367&\237F\017\236T\311'\2262\372\274\306"
+	.ascii	"$\021\343O\363>\215\312\350\275?7\2314\202\340\274?\312\350\245"
+	.ascii	"\2729\276P\361m\237\306\233t\336\237\233\274G\024\312\344\223"
+	.ascii	"J\031=R\375(\243O\252\033}^\237\233<6\241\222\267\371s\243\317"
+	.ascii	"$n\324I\345\243\214:\251\224\321g\026\213)\277\364QEA\322\245"
+	.ascii	"\203\251\224\311;\265\334:6}\244\312\326y\303\334\313iN\267\271"
+	.ascii	"\300\275[\316f\230#\026[AJ\247\220kG'\027\260Dv9oR\252D\342\274"
+	.ascii	"\027\t\262\306]Z`l\245\027\214\245F \266\256\224\323\275\006"
+	.ascii	",\3575\362\225\336{\215\367\336\233"
+	.string	"\346V{o\017\037%t\271\2747\013hy\267\214W\234\356\3554;+T\312h\227S\350\212\224(\364>\265F\206\3360\317&\0335B\271R\367^.\303B\251\254\3104\017\263\331\272\265\261\345\fY\262F\252\327f\024'm\036\236\020j$\202f\032\325\372\022\322+0)f\345%\307\245\323\344\326h\201R\256\31751\177\275\336\354\265@\224\314)\275\264$q\275\266Mi\035\021\255\212\206'\346\255Lc\271\301\361(\323d\270\315\213\361L2\211\267\240\271\037pzy_z{jH\240Y&\267\302\362.\217\326\033\2303x,w\374Q\026\325w_\200I\326\306\306\004\355\240\251C\222\331]\f\223\035_Cn\017\316\0255I\256z\355\272\006\363\016\323G\334\016c\201\363\336c\207\351\351\273\367\330\303\234\2029\305\272\244\253\310\024\340\372U\312\210\034^\177_Qt\314&N&X_\212`\222\205\310\231^\243"
+	.string	"\251WQ\242l-m/\252\216&f\332\3322\035&3\314I\004\324\335\221\270\035s]\366\356\250\250\3515\n"
+	.ascii	"sf\306\200\035\341>\036\234{\237\177`\206DA\303\244\240Ap\037"
+	.ascii	"O\322\347&\273\226P0H\372\260@\3515\346\031\323\210R/I\223eI"
+	.ascii	"3\306},M\003\241\314/K\307\365\226\346\322m\315\326p-\327o\255"
+	.ascii	"\245\261t\225\276"
+	.string	"\322V\330\254\335\370\354\375\244\333v\353%\274\306\322,\r\226L\003\257\261\342\204\242\022\210X\024\2054\210\301\"\n\033\216\226\220`\b\211K0\222\204E\246\034\210zx\212zB\030\362I\032\326 \002\200h\247\350\207IX\314a\250i\204\237\242\322\220\270\302\214\033C;\002\374\210g\202\025Eb\320\306\212\0317\206L\374hH\024*\ti\260\267\240\205\004-\\4\335\334\305\213\t^L"
+	.string	"\274\213\027BB/Z\b\261o!\244\022\2035\216Vbq\005!\216\241\360\b\250h\324B\310\206\243`\f$\244 \214&b\016\016 Q8\2341,*\te\f\223V\241\221\n;LJK\303\242\215\245\233\030\254P\207!\021[d\211:2\202B\022\220\206\301\242\246\242\316k\234\370\222\r!\221Eqi\211\310\242Dq\230\224\264\004\243\251\310\n\221b\004\213\\\360)ACiX\034\006_hbA"
+	.ascii	"\241\220"
+	.string	"(BS\021R\260\270T$#(d!\247hDA\005\254\260\030dA\306\215\340PQH\364\203\264\2644dd\223C\321FR\bD\341\214\0317\206\212\303$&\245 \261\210\210ix\200\320\210\270d#G(c\t\205\242\220\351f\306\215!\034\330\0317\206d\004\205\304\033\245!\ra\214\034aqH|A\206\222\220-\032\271(*\ro\334\024\231\214\212\304\245\025t\216\001\0060P\264\220\302\b\354\321\n\244\340\220(db\301D\024\342\030\022e\260P\032\006\223X\034\021\231X\2548@\210\203(d\022\262\320T\304\021Be^-zvb\324$\352\323M[\273:3\306f\352\030\367y\220v\217TApN>+\323\333\214\213\340GL\252\244U\215\250F\232\007\320\023i\035\337\264D\034\335^\322\b\253\026Q\2130[\337{\226\247\307\263\325\305g\004\"&\346EJ\212\331WUX\030\273m\201B\253\222"
+	.ascii	"\032Y//\025\214\275kP\035\275/umB\256\202\335DY\256\331\321\253"
+	.ascii	"\032\344x:\317\2473~\275\252_y\254\332\245v1\336\023=\233\252"
+	.ascii	"/\251-R\226\365X\217\247\354\025@\211\263\216o\252\004m\311\220"
+	.ascii	"^9\r\247\341\277\r\316\304V\272*8\264^\217\307N\366u\336\013"
+	.ascii	"\275\221\322\265\314\nbMW\257\\\\\255TB\201b\342\236Tac\267\266"
+	.ascii	"Z\311jz\200\360\323\232\016\301vG\365\324\035\033\333\265#JK"
+	.ascii	"\257XX\252\026N\226\006H\324\364r\314\300\364\345P\263\256j\365"
+	.ascii	"\341\004\251[J\331\004\251z\225z\305\336{\325{\271\206\300!J"
+	.ascii	"\024\230\272\343\352U\223G;\245W\325\212\321t\250\240\375}i\273"
+	.ascii	"\036%j\242\352|\350P\233:TfT\224\312\364\271H\272\036P\233=\344"
+	.ascii	"\023?u\352*\363\307I\246\257Wu\251\"\021\003\345\324\253*\305"
+	.ascii	"U\226F\216h6K\366\353\224\r\202p\250b\3714\307\002\031\"FfDD"
+	.ascii	"&h\2224\006R\013\020\006CY\234\346\314\003\022\340\003IS2\350"
+	.ascii	"\314\324\210\244$%Ie\232\003W\251\342\rF\304\327\244D\231d\344"
+	.ascii	"\"s-\031\336\325 ,\307\022a\034\177\214\277i\310>\330\265\024"
+	.ascii	"\342,\375\337\374I\252F\2368M\004\300l\214\225\241\001Nt\225"
+	.string	"\177X(Z\313\265\313\253.9@\351\3617\364pc\307\t\335[\300\0331\251\373\206W;\242|\005 \263\021l\031\221\2734\026\215\255\021!QQH#\371V\337A\310_\212$rMJI\256F\340\367o\b\006A\005\207f\331\257PK\355w\312\225\371dcw;r\251\bZ\303Vp\231C\025\243\225\345\375\350\363,v\337W\217\334\363\311\237\257\206\303\270\374\266\203p3\b\223\251\344vH\366\320\321\220\2574{\004\247\212?=\223\315\324\360k\225\304\031\363\307\277\024\206@\243\023\356-P\\\247\002\f\264dyR\002!-Q\t\254H%\264\317d\300\264\313J\036B2\314\241-\360w\334\277\356\303\304\246\355G5\201~h\341\233\333\304\327U\240i\356d@\fkA\022Q\315J\247\365\202k\017\224\352\273'p\307\242\306\226N\235\374\264\307\301\237\316\032\347\363V\f\345z\2379\311\2565\241\230\324>R"
+	.string	"I0\262\322\341\355\236\303\265\322\357MP+i\224\2049\2139Y\354\366 \344G\205\037\211\320a\273\201|\336\274\017\035\344_\370\3775\336-\336D\352\262\006\266!\250\241k\313\372\311\342\242\230\242h@\240-Z\217\004\331\227Q\273D\313c\250M\312\247\020\365P5\005\ba\253\310~=\t\306Y\333\035oA\301Zwd\265\241:\316\254ERS\031\310\367%\036a1\210:9\n@\302#\240\377F7\233\026\311\374~\260\311\b\206\266\367I\314}v\243\301|\032j\301\353]\264\313p\257\004\201\201\031\021\260\301\030\035\\C \222\230\017|\025\236\264\233\bg\244\361\313@\251\336\233p\222J\r\243\007\246`\351\036\330Z\235\252A\001\020\"\371\273\033\260\036\036"
+	.string	"\030:\327/\207E\314c\355\023\226\231\r\336"
+	.ascii	"\2344\3533\221\2739\212\317(<!\212\201\241\016\002[>\260FN\003"
+	.ascii	"\202\200`\257$Pb\003\262\n\233\256\316[r\267$\314\200\236rm\327"
+	.ascii	"\256\225\030\372\340U"
+	.string	"p\207\200e\230E$\300?k\003\202VA\210\353\273\263\323=\245\351\326\334n=m\206\356wt\363<]\330\200%\315~\307\354\253h\020\032\211_N\311\002\3532&\343I\t\243\276a;\224\230\f\277\240\274\n\007\303\376\r$\\~\354\373\274]\254\241\004Oc8]\230\006Fy\020z\240\234\242\b\370n(\356\255YL\257\224\004U\316\360O\241-\2430%>jSb\b\033\307y\331\204\351R\315\233\236\017\200\021\313\211PL\302\031\262\350}\210^90i{\002\2417\226V\303\241\316\370/1\312\224q\206\330\224\340~\2030\032k\302\264\f7\304\266_\007]$\247\021\363z\206\230\314\203m[\355p\225\246*Oz\025K\r\260h\263n\352\264\310\254h\t2z\331\375\347\037)\204\210\004\301\331\226n|H\324\334\230\351\215Pl\364\025tQ\214\271N\213W\334\024\302\225F\307\305T\242\230\216\250\273\314"
+	.ascii	"\032\301\312\372c_\373Dp\270\005\205\255m~G\350\035\352\0235"
+	.ascii	"i\003\246D\303\223\220\320\2134>\314\331w8^\r\3455\202\023\274"
+	.ascii	"\342)\330I\213\333*\335q\377?b\367\311\330]\352\b\210K&\237\353"
+	.ascii	"n1\330\037\356UGqvqoR\372\253\202\007\263\034:\2149{\341\377"
+	.ascii	"\312\177\356fE/a\016\347\255aIL\341\036\034\032\253?\007\374"
+	.ascii	"\362\233)'\241\027\036\310`\207\013\253b\321W\026>#\376\245\353"
+	.ascii	"E\255w)n\204\301xo,rS\271\017+ftn_a\206l\327\233C\337\261\356"
+	.ascii	"\303\357\256\272\200\276A\030\202\215\370^\254\223\357\261\276"
+	.ascii	"fo&\331Q\026\225]\337\332c\r\266\215=\220W\272M\375o\007\367"
+	.ascii	"\302\365\355\210\326\346\357\377\025'\001?`\235?\016\251n,\276"
+	.ascii	"y\324\246xK\371\335\033#/V^\005\263\367Qv\201?\357\024\350\266"
+	.ascii	"\366,u\340a&\344\222\234\340^\337\306\245\253\360\320\375\255"
+	.text
+	.section	.gnu.lto_.symtab.e7908608f8aaefa0,"e",@progbits
+	.string	"serialPrint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.string	"serialGetBaudRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\001"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\001"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\001"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\001"
+	.string	""
+	.string	"serialReadBuf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\001"
+	.string	""
+	.string	"serialSetBaudRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\001"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\001"
+	.string	""
+	.string	"serialSetMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\001"
+	.string	""
+	.string	"serialWriteBufShim"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"serialBeginWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.string	"serialEndWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\001"
+	.string	""
+	.string	"serialTxReserve"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.string	"serialTxCommit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e7908608f8aaefa0,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
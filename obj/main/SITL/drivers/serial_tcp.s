@@ -0,0 +1,1409 @@
+	.file	"serial_tcp.c"
+	.section	.gnu.lto_.profile.36e7517e7d6738c9,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.36e7517e7d6738c9,"e",@progbits
+	.string	"(\265/\375`b\001\355\013"
+	.string	"D\020V\002"
+	.string	"\036"
+	.string	"\255\231\343\341\004\004\002"
+	.string	"\002\001\001\272\264\302\242\t\006\220\267\347\313\002\002\003\265\215\302\342\f\b\002\002\002\003\004\002\003\002\005\002\005\005\265\361\363\362\n\016\002"
+	.string	"\002\003\006\003\006\335\354\366\375\001\f\002\007\254\227\246\377\016\002\002\007\002\b\b\240\342\234\212\n\t\n\234\232\223\267\016\013\261\262\330\367\007\030\002\002\002\t\003\002\n\f\230\237\365\233\002\020\002\013\002\f\f\002\f\r\356\221\312\245\007&\002\007\002\007\007\002\b\007\007\002\013\005\002\005\016\352\263\360\321\b\017\020\021\322\262\367\317\b\022\256\375\321\353\r"
+	.string	"\023\210\230\344\242\t\007\024\324\243\206\236\017"
+	.string	"\025\255\221\351\\\b"
+	.string	"\002\003\026\213\356\302\373\013\r\002\r\027\321\301\203\177\016\003\007\002\003\030\215\310\202\246\016\031\252\225\343\313\t"
+	.string	"\032\350\300\306\254\005\033\265\372\210\203\b\002\034\270\355\262\276\f\032\002\016\006\017\002\003\002\020\021\002\003\035\365\333\347\215\003\036\240\342\234\212\n"
+	.string	"6 P\202SE\345\001\207Y\313\370\251\325rgW3\004l\3774\363:\242\257&z\023`\301+*\033\223\005*s!\031\200\222\224Zg\204{\"\372f\3267\322\235q\316\223\205\034b\276\002}\020\365\001\006\016$\001\31028=X\346\033\370\n,\227\203\020\0204\240\343y\002Rd\027jEu\240\210"
+	.ascii	"\f\205\341\304;\200`^\265\360d\232\001\276K\246\375B*\334\020"
+	.text
+	.section	.gnu.lto_.ipa_sra.36e7517e7d6738c9,"e",@progbits
+	.string	"(\265/\375`\220\001\345\006"
+	.string	"\"\306\021\031\200K\322\001 \0224A\0234\231\221\330\272\016cqm\210%\215\020\271S\n\036\307\215\311H\013\235B7qMy\327\020\177"
+	.string	"h\2267\024\256\325\314\301\022u\301\201\244\311\362\212$XhDW\317{U\353V\261\036\001N\250\340\3168\303\030p\202\241\251\273\003\020H4r%I2\034A\344\222\00782\277;^\312\250\361\363\264\362\bZ\277\311\021\t\277\227\210\307\201\211\236^y+\026\316Hz4\303\200\212\027\232@\251\220i\343\307,\035#\344S\356\257\360!\375\324\373\n\300@\\@\030\\-\022\365X\020!\032B"
+	.ascii	"\244\210\300al\242w\021\360\204\206\246\262f\336\022\234(\321"
+	.ascii	"\177\367\210\203v)\244R\b7\333iK\202>Iz\373\246\230\250?kMy\241"
+	.ascii	"\243\277E\216\002"
+	.text
+	.section	.gnu.lto_.inline.36e7517e7d6738c9,"e",@progbits
+	.string	"(\265/\375`f\007\215\035"
+	.string	"\246e\203J\320\362&\035V\201\305\013\303\343\013\200\177i\274c\354&z.\274Yr\003\222g\177\317q\266\215#\346\341\303\027\027\223R\017-\226\037\373\270#\342\013\223\027\217\204\026\017m\220\334\"p\227\273\273\3537\267F\326l[B\266\2242\005f"
+	.string	"o"
+	.string	"v"
+	.string	""
+	.ascii	"\300}\315\224\326\211\031\332\205\377\n\227E6\"\030\264p\331"
+	.ascii	"\003\342\371\356\237\213/\222\335\345\307\356\025\346\275\313"
+	.ascii	"Z\353\352\307u\263\316\363\363\034\201k\255u\227j\255M\326Zc"
+	.ascii	"\363]\366Ix\317Q\265\326\221\357\177\221|M>\217\334\224\223t"
+	.ascii	"C\377\024&\321C\223\023\362\377\345\375~U\230\250\246\207\006"
+	.ascii	"\366\327N\037\004&\3634\026\276\371\341\245X0]\223\322S\234\313"
+	.ascii	"w\246g\n\201\367'O\351\360\261\343\370B\255\325\345\227\361\262"
+	.ascii	"x?\367\305\276\f\261(\340g<\242\2002\266\260\023\246h\0073\362"
+	.ascii	"\326/\222\340\317\302;/\037r\324\370\337\226\236A\372\b1\371"
+	.ascii	"J\301\322\252\364\223\217 N\256\277\245UTUE\035\230\300Ex@P\b"
+	.ascii	"\016\376\260o\277\""
+	.string	"9\377\r=\324C\004\305\"\202\2433\3046\337\272\276l\247\304\301\350v\032\323\022L>(j\237\375\255\275!\024\264\323b\247^\013\035\354\262?\327\272Z\353w\222\221ef\214\252(\317tH\232\n\377\\K\301\240Rj@\343]\033<P+^\343\257\375\356\371\334;\361\304\304\002\322\321\224\241\244\306\273\374]\351\036\216\227\r\tf\341\036\366}\377\267\273g\250~|\204H:\236\243\277H\316\231\343\240\021,bL\036\233+\2644\256\360\033c\330\257\326\001Hc\n<\236<\270\270}\200\200\261\003\374\273Tr\272cE\262\206wD%\203\365\263t\224\314\017\034\002\266#\032R6\005~cp*d\020HdL\330C\003\031\343DB\003a\0322a\340\266\331\307\371\330c\347\360\224\342\272\267\365-\3732\256\375\027\357\373\253\002{m7\354\\\200\306\250\201\251Rh\246d((H2\314\001`\"\031\262\262\036\022"
+	.string	"eE\3054r\212h\244\240E)\rsc\023\350\274\f\266\340\307Y\263\274\321\370\361\373\301\230\203vs\255\221\364"
+	.string	"/\213\b\237\341'\356\326j\370\252\350\3212l\233\033Ht\003\016\032\273Y\235/f\020C\225\325\301m+CekT-\220\"\3708\t crb\001=\200\030\341\002f\206\254\013\353\214\247H\324)\365\340\200g\211\002g\315j\320i\253"
+	.ascii	"\231\304|I%\027\021.\034\332H\216'k\024\016U\006Kp\225\254\331"
+	.ascii	"\003\204\217vdW\3500\250\253G\007\335\177\233W\260\032\t2\r\261"
+	.ascii	"\004\245\270s\"d\362$ \n\324r$\217[s\257l\302\311\211\350\351"
+	.ascii	"\210\306\3073\004Z\251\300$\226i\372\303&\315b\213\375\365\236"
+	.ascii	"\263I\036\2750\362uZ\313\030O\030(\222tE\3634\334\025\303\312"
+	.ascii	")\272B\376\224\b\373la\266\022\026\302/\007Bed\252O|T4(\245\342"
+	.ascii	"P\346\272gD\232\rb\243\322\307\236\255wO\354\302\017\267\254"
+	.ascii	"\331a\340\370\320\207\037#L\251L\257\223\232\342\375\250\005"
+	.ascii	"\004\342#\245\351{Y\344\253\345\357\323\224\n\201\b\221\246\327"
+	.ascii	"vH\027\355\277X\006,r\217\224\367kC\212\271\242\214\332+\366"
+	.ascii	"P\242\177K\343\375\342\370\027\317\022M\221\350\274us>\310\032"
+	.ascii	"\270\351\021?.\313l,\327\371\002J\nO\020\021\377\346*\326\341"
+	.ascii	"\270\275;\236\317n\320X\377\375\216\342< \320}6\003\036\210\t"
+	.ascii	"\225\3135\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.36e7517e7d6738c9,"e",@progbits
+	.string	"(\265/\375`\021\fM\037"
+	.string	"\226\244yE"
+	.string	"\317&\035\251\252\252\376\267*\022_\025V\245t\337\256\237@_w\211R\022d\017\241x\366\366\325\254\036d5m\234<\231\363\260\227\331\006S]wA%w\353\006c\211}~Q;\3043\026dv\357\266wJ2Y"
+	.string	"e"
+	.string	"a"
+	.ascii	"\030\256]5\356\333\027u\022\252r\035\327\371\307\252\321&\"$"
+	.ascii	"tOW\342\333\032\024oK\355\210\305b\032\257\013\377B&\321\311"
+	.ascii	"\353^_\314\022$\314\247\247\032\337\273O\370\366\261M8\2065\024"
+	.ascii	"\262\266\210_\327D\273&\336\272\207\235\032vV\353\343$\364\367"
+	.ascii	"\331Z\322\037\325\321\203pQHX\f\207\375\221\260\006\222\3041"
+	.ascii	"wt\346\216\316\201\374h\025\376G\243\230\207G\316\215\022\255"
+	.ascii	"\006\262\f\252\032\206\247\223\260\364}\243\224xU\227\312;1\204"
+	.ascii	"\021\202\204\231t\r\241#\304\347"
+	.string	"\034v6\261U\344\266\306\230]r\\\007\302\250\310I\330\0217\234\302+\360\273\225\260\026W\340\265\257\306\267\303~\246\013\003!~a\273\3603\f;\310\244/j\005\030\2168= )C\206a\342/\0172\303\250\250FA\220\373\331%\034\311q\034\367\274\244\357\351\013r;\260\375H\013\035\265d\205\274v\277\357\206\375\217\250\"\355\252\001L&\177\3043\360y$\314!NO\256\275=\037\022\374\261\360]G\360\007Uw}$\354\025,/.#\252\225\207\215&\265uP\245V64\251\271a+\240\231\212d\236\314\233\215\265M\327k\245!\2053'\244\274\2304\013\321ldD\265\242\331R3\323\24653_$\363\306\246\345\232*\326\226\341\300d\265&\253\265\335\310\254X\254\226\314\304Y\265\210XPi\211\341\320\354E\362B\001\245\302\005\027\226\224\030\016\223o\311W\373.\370\222\276\242\230C\004J\003TE\024"
+	.ascii	"\260\037\200\346\250AE\245\024\311H\222\202$m\006`\002\021\""
+	.ascii	"*\343\006\022 \2029\006\243A\214\202J1CF\244fD\244%%%\311pPc"
+	.ascii	":\247\241\373L\374\t\223\372\033\367\323\276\242:\372\037\301"
+	.ascii	"c\240\034q\267C2\330\037\022\023#}B\264\360\311\342\315\243$"
+	.ascii	"\271\327\313\376\031 \225\3447 \311zu!SR\201)\203p1hd\232\236"
+	.ascii	"\206\225\322\246\036|\200\030$\211\034I\013\305\201\003\2422"
+	.ascii	"\200\n\232\372\354\265\317\267e\236\017\244*\360\265C\352V\327"
+	.ascii	"1\235b\013\361\266B\356\035\311+N\215[\215\036h)t\rh\222\321"
+	.ascii	"\367T\341\345\351\".\246\311\013Y\367\320+`\210o\327\277\325"
+	.ascii	"\227\260{nZ:n\201\372\336/\001\345\346\265\274"
+	.string	"D\307\201\237@E\023\"\030\363\234\034\305\303\322\326\006V\022qe\216\313\327\350\255\215,\244O\374\300\340f\226lLJ\307`\370\206|~\274.i\251\330\264\243\"M\232b\022\035\3469\316\361\233\312\347\247\220>\036\364\017\016r\372c\375d?=F\"\337\377\233R\255\013\371\304\035\f3*92\274@\226\340\303l_\354\243n\347:\371\222;9\037\205q\204z\205\200\032\023c\205\366\rKx\262\375\213'\205{*\307\n\275y\300N{\323\303\271i\fR\304F\024r\230WV\314\273ck\311\316\367Nh>\245B]Z+w\255U_dZ\207\253\375\303\257\265Rp\277|\331<r7\357@\255^\227\031\334RlwF\205\031W\362\005\021\3070\371g\204\324*0\033\335\005z\234\253\302$\353\203\221\221\217@\016\357\006\031\356f\021\217\020\267)J\274H/\327h\240\216ew\372e\226SP\001b7\257"
+	.ascii	"2\336\221#[\353n\305,{@\352w\215\200\310EI[C\203\301\310\235"
+	.ascii	"G\214D\341\253\\u\314\020L\356fJK+nf\215\005E\307{\225\347\232"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.pureconst.36e7517e7d6738c9,"e",@progbits
+	.string	"(\265/\375 G9\002"
+	.string	"C"
+	.string	""
+	.string	""
+	.string	"\026"
+	.ascii	"\231\004\001\231\004\002\231\004\003\232\005\005\271\004\006"
+	.ascii	"\271\004\007\230\004\n\231\004\013\232\005\f\232\004\r\232\005"
+	.ascii	"\022\230\004\023\230\004\024\230\004\025\271\004\026\232\004"
+	.ascii	"\027\232\005\030\271\004\031\230\004\032\204\004\033\230\004"
+	.ascii	"\034\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.36e7517e7d6738c9,"e",@progbits
+	.string	"(\265/\375`\230\002\325\013"
+	.ascii	"\322\316--\220)\031\016\377\227n\317\245\335\002\243q\242^\232"
+	.ascii	"\262\373\23591\"f\242 \277Q\371\366\236e\006\374Ob\201\021\370"
+	.ascii	"\320 \215\300-e\nS\215\212"
+	.string	"H\232c*\"i\214CgC'C\347\323\tuJ\264Y\230\n\t#\020\270W\275\003\215e\320\260b\303YdP\374\224\256\350\002B?\2369\264\264i=\245r\2513je\236\3069\347*\216\272xW\340iq\223\013\325\313\344B\306\216\350\n\230`d\\\200[9DY\307\213\252\252i\324\337\257\356\251\233w\250\213\341\023!\345\220:\016-U%j\237\332\365\263\325#c|s\306\026e\336\037\345\017\345\322\003\277&\002b\250Aa\251\244I2l\007p\002\221);\017\021\020-F\022\231\250\322n\251\273\250\343\230\314\324\312L1\"\243\316j\271y\021'\265\271?\246D\257\353\021\213D,\223_\0321\351\013:\340D\236\361\321\306\251\254_U\367y\240w\236\224G\303\bY\030\207v\212\246C-Q>\257\355YCI\230\232\377\324\360Q\337\346\255w\2478\361\375Fg\210<\030\247\232C\3218\234\272\006"
+	.string	"V"
+	.string	"\025u\203\301\020\331\331j\007\275b8\036\3208Q\177o\2632\201\f"
+	.ascii	"\312\335\300\177\352/\204/\217\325;#\304\253m(\204@4EK\"5C\357"
+	.ascii	"\351X0\233q>\022\035\246\325h\203\216?n\203\313\234\002"
+	.text
+	.section	.gnu.lto_.lto.36e7517e7d6738c9,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_tcpVTable.35.36e7517e7d6738c9,"e",@progbits
+	.string	"(\265/\375 \332\205\005"
+	.string	"\204\t\240"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"\005\001\006\177\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\375\307\005}{\270\375\327\005ywu\274\236\340\277Xsqo\270\277/mk\370\366\347\007ig\270\366\227\tie\370\365\207\007ca"
+	.string	"?\202\210\200\330\001_]\304\001[\303\001Y\302\001W\301\001U\300\001S\277\001Q\276\001O\275\001M\274\001K\273\001I\273\001"
+	.string	"\013/root/repo"
+	.string	" ./src/main/drivers/serial_tcp.c"
+	.string	"\t"
+	.string	"\200\224\230\244\310$\n\214\341\f\013\212\035\025\340\231\344\016"
+	.ascii	"\016"
+	.text
+	.section	.gnu.lto_tcpIsStart.42.36e7517e7d6738c9,"e",@progbits
+	.string	"(\265/\375 \353\215\006"
+	.string	"R\314-3`M\323\001\300>\202J&\207I\307\301x,\243\f\0161x\213\266\025Dkm\333\251\335\356\265+cD1"
+	.string	"\300\004\023\367v\026\203)|\205\265&eJ\001\256\246\254\252\034$P\327\2634\247=\213\341z\bn\341\242\024\\\36547I\3062\353\271\n\206=\027\305\275rR\245\214:\330\367\370\007\3645\334`\311o\207|\013\345Pj\200D&;v\304\244^\330\177V9\266\323\251\002\025\037!\331\325tNV\004\n\331\260}\261#\023\024\\\f\03734\267\240x"
+	.string	"1\331\215N1\016\237\320\177\307\037\216\211\222m\203y\002\030\354\256s\333D\334z\333\003\266'\333\020\001\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_tcpSetBasePort.43.36e7517e7d6738c9,"e",@progbits
+	.string	"(\265/\375`\034"
+	.string	"\225\007"
+	.string	"\242\31766@o\323\001x\255\345\217\347\275r\276\201E0\035Z\220v\004:\002J\217\204\3374\336+\267[\241N\337\210\033\307\360 \374\334\0066\324Q.m\247lo\262eJ\001\332\2740\311\224\006\2434\005\206\2155\253Lf\263z\260\346\202t\2606\r\222\232\231\324\024\370\302\252)\265\353\232\022\363\355\245\205 '\234\210>0\302\n}\220\207t|\rCp\364\334\243\317\231\036cg\302R\361\321\221\375y\024^\330\227vw\rA\366\275_\245L\306QRv'F-+\212%\033\266\217\261\255j\277\343\036\333\275\216\343\256\205G\262\373\031X\002<\n\234`z\324\017L\217\336l\225\177\241\275HHbdew%\304\370v\335\374\177<\200\353<\327\013\302\356Z\271\216\342\206\267\235\261}`\233#\007"
+	.ascii	"2\241}/pq\241\304ehb5\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_tcpClose.44.36e7517e7d6738c9,"e",@progbits
+	.string	"(\265/\375`c\001\245\016"
+	.string	"&\333aF\340\264&\035h!\232\247\bc\247\317\261p\361\321\233\002Z\363\302\006\b\330a\230\216\302\313>\350\026o\324Z\003"
+	.string	"iH\352YqZ\f\251\030\037\207\316qC\006\232D"
+	.string	")p.\210}\304Mc\244\304\222M\244L)H"
+	.string	"I"
+	.string	"R"
+	.string	",B\266\237\366_\334\006u\230\314\005\354\266j\350\354\206\013\314m\217\016\177\242=n\037\240=\032e\007y\350Z\020\212\02543~v\227S\025G=Q\376a\234\004\254I=A\020v\327\t\326\224\270\365\266\017\330~`\237H)\3737!\022\264M\227\361a\333\335\0061N\037\001\237\327\243/\243=^SxT?rL\314d\314\016S\251)\354g\273\273\326\226}\330\017\212iM\323Q\323Y\226VMg\246o\342 \374\021b \266K\"fd{b\216:1\376\313\031Fyp\244=jJrB\3013\215\2327>pX\252\214Y5\323\323\0341\313o\264l\233j\205\021@X6\242\333\360\316\211+Gc\017\036.\206\004\310T\273#y\303ix'}p"
+	.ascii	"\270R\317\263\003\026\312\253\315\341%\017\032E\204\006.\211"
+	.ascii	"Ap\301B\204\025\026\025\n\022F&\337\335\211N\035LK\007\227\222"
+	.ascii	"G\372\270\317#\201(y\0328\017%\227\027\256\363>N\204b\323\211"
+	.ascii	"\344q0&\223\307\205\302}\266\332\362\204\"=3\252r\201\214\372"
+	.ascii	"\360:R\336\202\365\332]\035T\331V\f\022\330+\030V\307\361  \240"
+	.ascii	"\202\021*\365\"B\237d\340q\270t\020\356\"\321\224\033\343\002"
+	.ascii	"X3\327\325f\001\216\270\3314\371\215_\352\313:\242\200t\201\033"
+	.ascii	"/?-\260\356\007\023f\301\2305V\247\330jz\255\341\005\327\265"
+	.ascii	"\253\331G\303//ZJ\006"
+	.text
+	.section	.gnu.lto_tcpReceive.45.36e7517e7d6738c9,"e",@progbits
+	.string	"(\265/\375`@\b-0"
+	.ascii	"\032Sp\022G`^R\007/&7\275\305\341lU\340\tY0\210\316\223\321\355"
+	.ascii	" \304.C\302)1b\n\304\344\304\332!-\\}\341*T\016\027\362\226\370"
+	.ascii	"\022\216\360jB\336\240}/\034m\022\215x?bIkd\357\275w\222)\005"
+	.ascii	"\030\001\004\001\020\001\322\b\257\263\304\325L\306\032\353\220"
+	.ascii	"\306U%\262\344\306\214\234m\007\257\263\356\353n\317\335>\346"
+	.ascii	"dG/\243\341<q\334E\005K\034K\031t\361u\266\245\016\324:\373\272"
+	.ascii	"O\353l\037\273\343\\\032\215]\2562&\025N\034\307\305\367\321"
+	.ascii	"\301|ta0\b\350\307\247\207g\007\b\353\374|=\336\353\266\354\372"
+	.ascii	"\371\330\216taX\223d\016.\253\274<\350\327\024\001\032\2606&"
+	.ascii	"\366\263.\220\313\362\006h\212H\323\301\234B\262O\220\260\334"
+	.ascii	"\303\346\034\002\346\004\222yv\242"
+	.string	"\016\214\2029{dx\005\360T\263r6\347\217\265h\f\227\032\007s>\263\216\313\005fn\253\212\210\377<dE\ts\337:\354\352Q\347lN\254\225\bf\215\331[)\250Y\2219\233\363ju\2564S\007s\362\310<6g\026\021\230sG~\335\034\336.}T\314\314\272H[U:|\205\251j\254\304(\236\243\250\224\371\275\211\257I\260\244cu[U^\236]\2448\216;7\251\252\274\205\274\333\217t7R\267\213\024\311\\u\267\223\313\342f}h\023\375\360\337\206\224\221\251\2322\333uPf\275\323\332\017 \2627\211\376\250U\343\221\335\216\345E\261\331-\302\257\030'D\255<\210\372{\031\226\227&\216\036\341h\306#\267n\022N\305\304\033\3071\204)\026\222\212\334\2048\333N\243uv\370aR]O\2622\250\\}\2721\\o\377\320n)2\273o\271R^\365wu\263\271\021\270\231w\021\234\273"
+	.ascii	"\234\233\200S\275\211\374\314{\350e\356\003\330\334Bpn!\234;"
+	.ascii	"\350\313\035\344\313\375\243\223\333g\315\335\303\346\346\371"
+	.ascii	"\345\336as\003\177\271\341_n\035_\356\037/\267\257\227\273\307"
+	.ascii	"\313\315{s\277nn\227\315\335\266\271Y6\367\312\346~6w^s\373Q"
+	.ascii	"\005-8s\001\252q<U\225\023\257\261Z\274\334\314\235\352~\346"
+	.ascii	"\337-mw\342P<J\373\316"
+	.string	"`\020\225;\261\222K\312\327\204w\352O\216N\205ATJc*\026XX\002\3173\346\235[A-\241\002?\264]F[\364CR\325i\230\003\331\310\337\367\375\357\273\217H\216J\2627\213\236\310|\244\230\267u\332\360\310\304\315\034\311\016\374~\370V\326{\336\373^Xey\244\367?\207y\007\225\253M\234\214\n6^\007\377}wnM\362\314\331\235\016\314\274\232z>\343\337\352\206\203C\315\355\347P_\350n\370\036*\240u\377\227\304\350\002\206\354M\367[#Z\313G\322\305\025\241\366\332\367\255\351[\373\336\305$\256\223\033\312\256\305\217\234\375\356\f\032\2627[\202\326R\315i\030\335\340`8\030`\177\006V\225\347\022\370\237\226\230\225\265\300\007?\312\275x\360\207\244\224\274\357C;\267\355\306V\202\035\353nl\205\037\325-\374\365\t\274\220\352\272\017e{NX\324\256\375\256\206\321\022=|7}\033\376\377\372"
+	.ascii	"\346,\277\222\035\274\213\321\321\322\234\372\357ho\231\005"
+	.string	"V\253\325\252\033\333\374\005^H]>\223\271\332\303'\372\374-\334\362+'\222\224P\254)\226\222\236\326\247\025-\230\214\254\223\267\261\001\013\343\223\211\024IKMJNE\247&%\027KM'\212+\226\222T\024\215MN\305\006\304fb\241\324T|bbj*\372\244\261#A}\222\207\360\241m\344A\357o\246b\224\331\316\256\323\206\352\216d\260[\320\213Ii=\311\312\334\3278\216\343\340C=\0131\023\347LP1\017\340:B\237\310\326\352\344\224\217\354'=\202T\001\352\271\311D\2642G~\326\030c\346\310\260\225i\223\342\363\320\366\375<\320\214\r\2317w\023\242\323\336\366\346\322:\373\363kZ\324\325Q\356>\3768\006i\275\351\363\274\260\272\257\344#\275L\033\\\233\236\207\272y\321\033M\371\230\242Qf\273n\213\313\001\204\007nO\320f \202\027\372\250n\005B\337\343u,\262\346\3050\032gd"
+	.ascii	"g\242\347\237n\335\031>\317#x\207[>\223</\200\316{\n2\013\n\334"
+	.ascii	"y\370]L\325\200\277\363\316\274\203Jc\364.Q4W\200\357]~\024\275"
+	.ascii	"\316\303\357:\337Z\005\200\251\250a$\344\224c\b\021\315(HZ\220"
+	.ascii	"\264\006p\002\221!\263\362\021`\275ch\222\264o\363\250\276H\033"
+	.ascii	"i\201Z\376\240i\016EL\376\221\264\352\373\2213\243V\202z\223"
+	.ascii	"q\354#\316\361\366\231\257H%\232\\P\023\022Lr\263\206*\353p\210"
+	.ascii	"\245\324~\351\331\362yak4\024o\361%\002\242!\3039\026\261P\334"
+	.ascii	"\355\273B\334M\013\221_\003\321\222zC33j\351\3226\3138\n\376"
+	.ascii	"\367~\224\177D\261&t\206qK\255\236u#\0055\0012\212\tn\244\313"
+	.ascii	"\356A\263\317\262\241\365J4\340\351P\201\013C<aD;\025&$\263\313"
+	.ascii	" \013\241?1m\267F\3175>c\r\006\277\037\364\036\357g\f\344\224"
+	.ascii	"\263\227\262\310\235\354V\006\333)s\311\240\340\313PA\360!\305"
+	.ascii	"!,\206\243\024\363\002\3444\335\276\270T\364P\237\211\226\177"
+	.ascii	"\353\357\246M\240,\352\206\017\301\334\234\177\326\035\310\013"
+	.ascii	"\207\033\247\300T\243\262{p\302%P\316\022\304M\017J(\376\221"
+	.ascii	"\007\3314S\232\247\313^\360xT'o&*\230\375\221\323%\007\333\024"
+	.ascii	"\243d\217\005[\200\210\252\267\340V\304.Z\0014\262x\224\357\217"
+	.ascii	"\270\003\002\226\204<X\\\235\360\024\370\233\342~\270\376\236"
+	.ascii	"9\353\033(\303tTy\001v\303\257\366\374b\215\307\201\331O\r"
+	.text
+	.section	.gnu.lto_tcpSend.46.36e7517e7d6738c9,"e",@progbits
+	.string	"(\265/\375`<\006M'"
+	.string	"jEd\017Fp\236Q:k\301:l\351\317\243\334\205I\242\330\317\274\fY\031:\314ng\203ql,n?\233\021\277;?\210&\006\243l#\356RC\f\013\312V\037{\321\201\254\320\206\360\377e\251\337\376j\277\021B\b\221;\311\337"
+	.string	"\323"
+	.string	"\346"
+	.string	"79a=Ztv\3218/\217\344\265\002qdJap\224!\254G\217c\346[\346K\371\024\340\271l\274w\257V\030\227{\223\016\330\267\036\345\344\003\244G\327\007\245G\031\310\034\347\311\343U\263\370\f\277\362\334{}}\204O\013<P\217\267\323\375\344p7\333\252\246\350\331\026\310\017\036\250\207<oYD\036\355\256\307u&\220r\210U:\376s.X\026\261\316"
+	.string	"L\212Al\356\313\"\020\334yd\226\365\346\313\242\220s"
+	.string	"\226\231\253\037\366v\241\220\333\316#({\302|Y\354q\016"
+	.string	"\223B\342\303\256F\352\213X\361x\252\253\032\236E\367^\\\325\224E\317\nS\266\220\272*\251\263\253(\313\036v#&E$\366\204p\365\276U]\335\252\027\356\275l\211UV\347\2403_\0023[`F\245\004\\A\026=\223\245'P\330\023\t4p\210T\007\231/&\303\227FdNq-K\025\216H\317\222\264\336{'`\341\240$\341\230\344(\337Fz\364\375\2603\230\323\364B\303\262Ch\233\374\237\367\336{\266\361\235\346\030D\253\333\310\267/*[\232\341\326bF-\0370\"\312Y.\220\263<\364\257\263\320\225g\002\347\372\005\240\226\001\344,\007\275\353\ftZ\356\241\226y8\313;\324\262\016g\371\007g9\227Z\276\335,\333V\313\252\315r\272ZFU\313gj\271Q\313\366\264\374\243"
+	.ascii	"[X@\262\3724Z\362\346h\362\271jP/J\336\365\177\375\3127s\222"
+	.ascii	"_\345`\017c\234rFQ\024\357Fe5\227PX\275n\005\370\257\031k\260"
+	.ascii	"\270n\221\272\301\274\001f-\230l\3453\230\364\350\255-\034\034"
+	.ascii	">\210,3\206\f\351\211\266\376\326\227\243\036&T\007\331\213V"
+	.ascii	"\030\036\034\215\324\250m\227\021\"u"
+	.string	"\316\314\b\331\337\344\331jw3k\330`O4\352\022C\206\035\344\264\321V\235\bu\332v\315pM\330\341e\232\016v$c\001\355\203!\317&\201T\016\327\302\306\360\270s\263[\242p\211\331\332\310V\035\352fv\331\222\026\350\240\306\301\340\335?\2574\036.\206\311\206\216\037^\026bw\354V\213(\3654Q\2038\342\031\256\tm\363\\\333h{\250\3255\314,\342dK\007\003c\301\366\301\324\270\204\266i\3256\026\350O-\201\262\315\177\216\0353\255\264\306U\023/4\311\340\373\314M\225+h\033Y\250\t\264\320\325\021/\265(\273\207\231G\334\313R\203\264.GiB\255\n\255@\t*\220\224X\234-\230\220\236\316\247\027JN\247\3239\351\001\214\244\247\024-\220\230~JN>\247\237R\f\246\237\n\337\013&$\027\276\244\237\223\357A\0217\301P\372\371\236\232\232~>\\\362\236\371\005aC\025\225-\317"
+	.string	"\355\370\nR\313;\320"
+	.string	"\216\354\307\016\240{O\200P\"\f\231r#c\350\330f)\201\032\202^7\031qG\217\327\007\372bSXP\274\246`\025\006\nM\271&\\n\r\215\360\226|\241\272\031\365\315H5\034\263\0215P\343\330\365O\257\360\322\365\256?\\\023\242-},\215\315\265\350\372cj\\@\235\353\237\376\024V\256\317\007\t\332pMh\233m\205I\245eg\300\nhf\340\024 \025{\"_\353\013S\0173\252\203\034\001y\265G\327F\254\333E\006lQ\225\375\234=\346H\260\316\231\032\213\231eu\311\265\221q\267\306\005\351\234\251=\200\202\250\201(\343\220c\212\330\210\210$I\222\326\200\002\231\241\262z\020hH4I\007\241\255\354\211p\3115O\250\376\f\350T\177/\254\244@A\225ai\334\213\363\345\223\013\332X\2673\021\337ekQ%d\355\030\r]\nv1\330\372C\310\016%\267\0059w\364\0070\303"
+	.string	"\202ymd\307\374\023"
+	.ascii	"\232\225\274wV\200k\026\347\207I\005O\216\003\343\224B\022XL"
+	.ascii	"'\"_\220\342\342\255\324\257x\3673\266\266\322\003\247>\312\361"
+	.ascii	"\357\2549\232\207\352\207cHYcI_\303h\341 \021\341y\003\2630\302"
+	.ascii	"\342\333\300\252P\003\003E!5f\fiV\273R\376\230\002QQ\204Z\216"
+	.ascii	"\237\242\222}\337?\016>X\321\201a\200#5\200\023\336\302!{\373"
+	.ascii	"rA\224\232\302\262\177\360vT\340\323\354\352\002\247\210Y\270"
+	.ascii	"\257\362\236\257\352MLQ\377,\330\351\035P%15\007\030\317k\267"
+	.ascii	"\205\212\227\r\005\320*\273\261\264\362\262\375\237\017r\363"
+	.ascii	"\243\002"
+	.text
+	.section	.gnu.lto_onConnectionEvent.47.36e7517e7d6738c9,"e",@progbits
+	.string	"(\265/\375`\300\001\235\020"
+	.string	"\226_pE"
+	.string	"\321$\035\2733\321\231\256g\344\226\255\302a=\226\234b\276o*\312a\345q0\267q\215\321\b\353k\323b\263\245!o\243\217\233'#^\331\256\004A\365{4\b\231\310\204\353=\bl\272\023\021B\310\2262\245]"
+	.string	"T"
+	.string	"^"
+	.string	"\330\366\220\354\230O\266\215\207\254\325V<6)\216v\227S\016?]\313\260\250y\362\265\023\017\025\210\272v\341Y$!\221\004#"
+	.string	"PM\207\022H!1\020\320&\216\354nMF\013\3278\300\325\"\007\bH\023EnB\250\336zV"
+	.ascii	"S\231\332\311\356:U \316\275\335\366\004\333\007\354#\005+\373"
+	.ascii	"qw\327\272c\337\347\337\260\264\366\236?\213i\325t"
+	.string	"j\372\037\n4\034\335(a\261{\363\322\261D\230\013\021\266o\377\307.\275d;\303\2438\335G\306\036\273\033v\030\330\216\215\304\247}\023?qz\217\204\003\330\335\2211\264\033\0220\267\035sx\221\354\001<\217\220\035SMW\006\020=3\371z\356.\n\323U\3203\246&\360\360\262\321\211[jjC0\345UV\2111\204\344\242Q\324YI\256!\325\225/\223]\031\264\214h2\311\0161\\&\333\364\372\326Ifh\244\212\202t<\236\207d\231j\372\237\307\02283RE@#R\371\262CTj&\230\226.\246\313\276nE\245\005\305\201\346\024\223\227\024\230\005+(\336\327\2318\323\327\305x\237\n\327\342\241\260p)\237\2113\031\261\313K\367q0..\037W\n\367qu\307\br\210f4\245u\037B \221\215trX\231\256J\256z\034\255\032n\360\025~a\302\262\275\253x\260\355n\001\241\217E"
+	.ascii	"\353\3031/\" \200\202\2419\355sh;1\272\241\332'c\253\275\231"
+	.ascii	"\005q\035oms\333z\242\\}\270eU\213\217\307:]\354\313j\356:9\026"
+	.ascii	"M\343!\344\275\013\343p'\212\237\226\375\254Q^\226v\243G\227"
+	.ascii	"4\340\255\212E!\347\215\0167\245\310{"
+	.text
+	.section	.gnu.lto_onAccept.48.36e7517e7d6738c9,"e",@progbits
+	.string	"(\265/\375`\222\0055#"
+	.string	"\246\375\335DphU\007\223r\006\215@\215R\304\265\206Z\205\223;Y%\370\321\353\261\t\3221\022\323\204(j|\r\032U\226Ow\017\242\003\f\204\320E\031\307\376@\fe\270Q\234\r\271J2\330\225t\267\275eJ)\005\310"
+	.string	"\266"
+	.string	"\322"
+	.string	"\315\245\373\253\2734\030\337\276\0300q2\251\334{9p\221\332\021\233\367\230\241+\214Ivo\217\243F9\003\2637;\313\332Zxp\355\336\244\236\013j\243;\333\316\334\314\276\262\266\327T\007\270\367\b\0302\3676'0Om\224\233\255K\033U{@\332(\257\314{\272\271\2744e\230\253.d\217\244\327\256\251\264\024\265\357+\267\3558\354Z\221\332I\037@\232\306\263\303\254\222Z\t\3105Y\267\343\225\325\2751\222'w,:Z\241\313\311,K\372\330jk\033\204=\201\344\216V\026\301\020%unG\242\2775\2722\353\312\035\253\354\001\262\241\231\006\353\"(=\266\334i\033\356\275\354\306\243\217f[3s\0263?1\243V\001d\377\226w"
+	.ascii	"n\3633\365\377\367-s\300\262\252\374\214\005\370QOh\3353\267"
+	.ascii	"p\341m\364o\246\0322eb\305\037\372\022\313X\237\177%\267T\252"
+	.ascii	"\373\316\"%\213\2378k\210.\210\211\234\273\227r\373\322~f\031"
+	.ascii	"?o\243\356w\305\03723\215\376\302O\002\313{\257\005n/*\236\214"
+	.ascii	"\226\\Si\243\375\r\326\316\245%\007y\305\213\312\317\230\233"
+	.ascii	"C\177%s\333\373G\230\373\253Y\327^\335\002Rg\"\353\234\263\316"
+	.ascii	"8\324yHu\276\265\263\215\346\\\263\316j\352L\263\316\251uFQg"
+	.ascii	"k\235\337:\273un\243\004D\220B\224b\276N\363b\235\021\272a\250"
+	.ascii	"\231&\001I\216\036uM\271\"\271\021\321s#I\347\t&\260S{\026M\300"
+	.ascii	"\214Z\353\222\225\311\202\345\275Tmd^\233\364\235\365\211\235"
+	.ascii	"\035]gF-\335\323\341\247n\316\243p\002U\331r\340\266\327(i;\273"
+	.ascii	"\313:\305\377\020\333\210\324i\225\325J\004+\314\273\365CF\352"
+	.ascii	"\346\322?\006\210\312\037*?k%F\342d\241E\276bQ\032\002S&\214"
+	.ascii	"\370C6\023\202\265\306\276\222\217Z}\030[\334\020]P\033~\026"
+	.ascii	"Xr\207f\363\2446\212S\037\205\303\247\314K\201\247\337\316V\363"
+	.ascii	"\241\235 \271\356-\266\021\204Z\364\360\2009\204\210F\323i\240"
+	.ascii	"\270\271x\004\to#\211\264Q\332\327\266\220\032\375\364\013i\037"
+	.ascii	"\375\2762c\023\375dR\317\250@\241\376\234\235\342ih\005l\303"
+	.ascii	"at\242\204\022S\013\024\036\226V\340\330\206\303\350D\t%\246"
+	.ascii	"\0350\270\003\006\177Q=\037\020\030\354\355t\370\226\0168\305"
+	.ascii	"p\0370\370PQ@_\016_*\364\325p\0026\315\240q/\311F/\312E\215\246"
+	.ascii	"\237\320\007\305\203\022\372r\374\204N<\340\257\351\211\327\023"
+	.ascii	"B\361\222v\034\264\341\023\362\242\202A!\357\326\274m\357\037"
+	.ascii	"\341\rT_\3255\003Zy\220W\304\264\370Y?\326\0309\205T){oR\203"
+	.ascii	"\230\226\334\267\323\357\nd\r\242\026_<h\224\250\020\021\356"
+	.ascii	"sC\217\0334\364K?\b\211=\tB\244%u\031?\013\220\341hI3'7N\312"
+	.ascii	"\3040\2149{\244\035Lo\017c\013\036\n\256\336\333\264j\b\251m"
+	.ascii	"\310Z\304\333x\373\235\325\330\024\256\317\223\355?Y\250\252"
+	.ascii	"\316\227o\250q(\007\231c\306D\024$IR\352`\002\0211e\274\001\021"
+	.ascii	"\240\305#D\322\244\224\341\222\261qb\242\352\206\234X1f#b-G\302"
+	.ascii	"\270\344\241[\343\343t[\032\307\017\345>=/\371\331\335\217NL"
+	.ascii	"\223/Y$z\016\001\004k\036i2\310c$\216C\2178\t{\217\306u\001@"
+	.ascii	"\202v\274\\\375\206\352  \006J\216\275%\240\306\266\347!D#\365"
+	.ascii	"\317~&\364\323\274\317l\021\002c\354\026{\373\335*\311\215\004"
+	.ascii	"\2124\337\377#\343\2359\"\275\n2\307\211\270\276\233\"+C\311"
+	.ascii	"\353WW\272{~\r\361\216\223\340\341\2372\3530\243\2075\331\376"
+	.ascii	"\256+\226\274@\321H\037\206\232\317\345\247\331\006\322dA\"Q"
+	.ascii	"n\340\027e\320NC\342\2730\003\316e\231\231\027\2036\2654\303"
+	.ascii	"\317\240\364s\231rl\335i\215C`\322|F\327\264\n"
+	.text
+	.section	.gnu.lto_onKick.49.36e7517e7d6738c9,"e",@progbits
+	.string	"(\265/\375`\336\003\205\032"
+	.string	"\306\357\250I\260\226Q:\264\241\\\226\245\001\037\356\226\f\251p\035\305_\036K\272s\0020\264\035'\322\034\347\365\207L\252\204\315[\357IE\037\023\270\215\325I\336C\277\366\377\b\007K\276\243\\\\|\200\224~\246\315\226\221X\262\311\226)\005\225"
+	.string	"\206"
+	.string	"\224"
+	.string	"t\374"
+	.string	"\361\3244[\313u:*K\251\f\342}\251\265\272\246\222\307\207\272;fio\305\220#K\244\341\\\232\277\373\306\210\332Q\025\271\371\274\025\262\206lV>e\263\021\332\004\267\024\275\367\025\272\3256\206U!\007\256\350d\202\361S\266\032\377=\201\017\033\215e\315\270\0306"
+	.ascii	">y\tp\013\n\013\020\361([7\240\245,\245\242\340\021\256\306\303"
+	.ascii	"\326\315EH\363\373\016\335~v\276\367\006L_rVG\270\242/\253B\255"
+	.ascii	"\325[\336p7\200\333\246b\373\202={\004:\237\235I\366m\202@K\236"
+	.ascii	"H\366\314\233n\231\007\371[\347\335\242\270\246t\035\212\353"
+	.ascii	"I\327\033\256? \305\322\227\240\315\224Z\211\256\302T)\n\325"
+	.ascii	"\343M?\317\276\317\3775\365\274\002\331H\241 \032\300Zu\026\306"
+	.ascii	"\023\361{n\235\332\3469j\364\261\215>\037\021\260\326Zsj\n\343"
+	.ascii	"\351[\266Ww!\264\017Ya\262\326\243,\022\306S\232\360k?w \264"
+	.ascii	"\007aq\001\265\"\375\224\324\252{`\327xj\335\013\210\017w\224"
+	.ascii	"X\363\235\266\207\017\373r\316\t8\200\016%\205\202*\020\177\302"
+	.ascii	"C\356\2200\325Z#\234:\201\221\\\234\230\230\274I\217x\272\363"
+	.ascii	"\270\037T\245\f\032\032\325y\364W\361\345\252\302\363\210\237"
+	.ascii	"\262\035\226\237\005\343%<\243\377t\250\0207\257}\371\022O?\311"
+	.ascii	"\232\223\025\324\223\364\034\320Q\332\226\035\tlAU\255\325\306"
+	.ascii	"\351GD\370;N\035#\261/I\210\2472\363\277\207N~\370J\031-\366"
+	.ascii	"j\372\206\254\236\246\311mM[\007\305\2764\201\240\022+\340\317"
+	.ascii	"\364\261\003\263\343\304v\266\223\003S\001\023e\260\022897#X"
+	.ascii	"~A8"
+	.string	"\361\332\tQ\342&&\203\315\\3\031LEL\206\343\312\211\335\230p\275d3\027\004\032\353\234\200\311\\;::2WKW?\221v\307\320e\311\n\330b\326Z3\311dI\316\314\211ek.N!q\336\312\303Zk\215qpq\316\314\367\316\240\346\333Q\365\214j{\265KH\r]jo\234IRN\037\3455\017i\225\r\237\342\311p#\214Q\216\nl\303\r)\243\234Txu\205e`e\246\315\241\303\016\027\033\201\361\202'\"\020'\201\245\001M\250Q,\245\220s\306\214\b\311\2144*t\200\002\031\2622\017\020P\251D\233e\fa\352)\003[^\336M\362\374\006\373\250bm,+O\356}#\036\322kJ\t+T\026\352\371\313Rs+Wl\250\264T\007SM\032\252\252\b\031\374<\004\274\243A\335\260\261h\027\255\224\312,\314\n\005\344N\020H)?\374\242\005\2538LEI\263\2421\307\363"
+	.ascii	"\235\2503\013\355\213Tz\215\030\271JV\020\354\335\365Qob\342"
+	.ascii	"\317\005,\017ci\254^\227\270\214\323/\323_\016\352\333\306\234"
+	.ascii	"\201\262\\\306k\373\001fH\n\333\274\036\375\003"
+	.text
+	.section	.gnu.lto_tcpListen.50.36e7517e7d6738c9,"e",@progbits
+	.string	"(\265/\375`\310\004m!"
+	.string	"\306\376\334J\200\332Q:Y\242\315D\r\256\001\230_\244L\207\312Q\001\354\343\307\017\263\211\034\235\362\316\316\363\017\006p\036\365\0371\346\256\335_t~r\013\024\313 -?CH=\247\22729v.\245\""
+	.string	"\207\214K\335G,!d\357$\003\306"
+	.string	"\274"
+	.string	"\313"
+	.ascii	"\306\013UX,\250Gqg_\312\247\b\237\025\304\021\225\031G\257\252"
+	.ascii	"\231<\313y\251\347h\007\251G\237sN\345\243\b\177\025\243\321"
+	.ascii	"\234\235\266@P\217\346\334{\273\237\274\225\360Od\\'g\250*_9"
+	.ascii	"+\177zU\217\266\362\004\322\243\352\005\244G\273\273#P\0206{"
+	.ascii	"%\322F\255h\2448\345,g\345\212\203\234\275ZK\321\023_\266?\274"
+	.ascii	"\212\321\224\2211\265\2148^\273\222%&\034c\361\246\247\002(\037"
+	.ascii	"h8\306\031'Nl\254h3\026/z:8j\311\201cT:\tty*+\336\363HL\307'"
+	.ascii	"\203b\233#8F\342y\340l\bv\256_\032\306\244{k\031r\316}[\343\215"
+	.ascii	"\367\315\273\373Fw\367\272O\252o\017v\237\337pw\221\356\276\355"
+	.ascii	"\006ezd&<l\037\005Me\307\244\031\322M\273H(g\314\2348\352XY\246"
+	.ascii	"\311\f\343\250\376\2457\374(d\206h\310\264\020\357\232\276\335"
+	.ascii	"\236\343\226\206\367\035\226v\357V\334\2677|\256\337 I\323Dk"
+	.ascii	"\316\300\303ne\322\305Q\335?3\206\352\276\271\275\363'\277\200"
+	.ascii	"_\375:\337z\337\372v\255o\243\352\355\363\274\215\317\333\367"
+	.ascii	"\274}\036\236\346\261G\220#\230\251\3146\322\330\3441\024L\352"
+	.ascii	"Y\277\326\277u\334\375\276\327\277\272m\335\342]\355s\034rL\346"
+	.ascii	"\234m-\272mG\337-\354/o\345\\m\333Z@u\226\234\3129cP\251\274"
+	.ascii	"\212\360Z\277kR\214q\033\237\013@\bK\344\276\3058\325\341\244"
+	.ascii	"\204\207?\026\026'(\264\347\027\023a\211ips.\224\252Rl\222\373"
+	.ascii	"\366\342\233W\323\030\273\204e\302\203\314\031\351m7\333\344"
+	.ascii	"`X'L`\262L\273\203\255\372\227\016\033\200\354f\255\356\205\205"
+	.ascii	"\242\222\225\320\200\3732\322\243>G$G+\246\035\334\275\341K\016"
+	.ascii	"\347:\203%_\222\230Zg\022\334\343\376\227\207\017\351\333\035"
+	.ascii	"\374\257\253ax\324\020\322$\342c\024\353\313\023s\331\346>D\332"
+	.ascii	"\r\342\313\020709\347 \364\212\227)\003\367\366\026K{\336\327"
+	.ascii	"\"\242\337\366\263\\lD\277\310\321w}I\002\007\231s~\333cL\234"
+	.ascii	"\270]ic:\367\274P\372\256[\031\272f\307\"9\023\003\255\002\250"
+	.ascii	"7\364\342\247\003\306 Z\177\300\035\321\032<J\361\003#x\2643"
+	.ascii	"\372\231\020$\024T\001\306\252\313\005\215\212\216v\253\357\027"
+	.ascii	"\\\201r(\256\356\210\207}\271\334\320\t\364\361z\347\357]\004"
+	.ascii	"\324+\002\n\031\r\355|\272\337\372\363\351\\\354|\271\365h7\304"
+	.ascii	"b-\362\375V \\\363z:\337\n\344\361|\253M\211t\f\325)Sl\351\225"
+	.ascii	"\376lz\256w`:Yz\341\233\275\206itw\rw\006"
+	.string	"$\234\324\301\254\337\2313\020\f\315\253\233\246\002\375\254\303\n\250\tPK*\2332\223po<\330\246\373\266shM\264&\021\017;\214\324\022Y\rGu\237MQ\034\200\352\301\375\331\037\351\371\304F\335\267(\306)\335\f\357[\220\315\227\20191\202\260\333\\\256h\005R\250a$\244\034R\206\231\nF\002\221\221\244\315\001\200\"\2313\363\021\300\3014C[\255o\276Q\"e\362#\30155\351\302\313\367\375\333M\034\257\276\b\007\302\306ss\"\3666\321\022\305\036 *`\251\353\333\027\331\203S\276\213\321\026\351\333\"`7{+*\315uVC\365F\017\330\227\256\033$uy\003\214\361O\003\230h\023\317\233\201\206\252G{\001\207&\275\326\034\243\363\036\275`/X\310\321I\t\244\337!VcpR\207$\211 tZ9mj5!\342(QdE&u,\2446\034\244\371\306\2321\300\024M{Z^u"
+	.ascii	".%*\020\217\031\277\025y\362\037"
+	.text
+	.section	.gnu.lto_tcpKickReactor.51.36e7517e7d6738c9,"e",@progbits
+	.string	"(\265/\375`\321"
+	.string	"\r\f"
+	.string	"\006\327SB q\232\016<0\342\332\204\007+\310V\307\377\342\3074\"7\204W\260\237\035\0315ac\241\\\367\370\t\245$W\230\024\nK\361\266\333\022(\200 \255B$\350\354"
+	.string	"<\005\213\bv\225,\331[\312\224\002A"
+	.string	"<"
+	.string	"A"
+	.string	"]h3(26\254x\331\335\250(\317\016\237f\346\237\345"
+	.string	"6N;\234>\374\t\240\270\222\324w`\344\002\007\305ex\032\223\022\333Y\236\0358\222\314\214\203\335un\234\207[\272\355\007\266\025\330g\020\177\273\273V\220\375\225\037jZ3\375\t\023\275\334h\320b\327$F\307\272\300\027&(\333O\373)W\311\276\202)\207\004\261H\211\261\333%p\234\016\335]#\035N\037 \035:\263k<z\024-32\to\030\022\202C\265/\013\371M\365\032\241A\265?\0043\022\251E\244k\204\026\032%\tc?\305U\210\370$\214\001\313o\207>&\035^\t\210\b\205P\0011\2221v\247\245\236\330\001\0248\036\023\236;\033\220N\b\004\017\316\307\362\\\361\262<\027>\226\204X\341\303\371\210\035\353\212\033\003\256@<V\f\251*+R\335\376\255\202\336\016Q\216\321\210\222\300"
+	.string	"i\177T\371\315\252\232\027\270\3308\361\364\304/ i\023"
+	.ascii	"3\241\203h\340\254\2273\266,\026Z\201\305\201\034\267\212\001"
+	.ascii	"\001\211\b\021l\b\320`\312%\330f5e\374\362\020\232\254\n\023"
+	.ascii	"4V\345\316="
+	.text
+	.section	.gnu.lto_tcpReconfigure.52.36e7517e7d6738c9,"e",@progbits
+	.string	"(\265/\375`\327\007U,"
+	.string	"*Ox\021E`^N:\177\243g1a\216\"!,fK\332\253\237q\r|\365b\211b\036\352\273\376$\177\fP\240%\326\031\204n\377\250\345M\021\237\206+D\213\r[z&\037\0250\374\034z\231hkF,!D\356$\003\376"
+	.string	"\362"
+	.ascii	"\r\001\277\276\234\366e\264/\367y\371\366\345C8\020\266\274;"
+	.ascii	"\025\336\332\366\253\357O+\207\226i\302\3145\230\205\314|/\363"
+	.ascii	"\331\236\245\306\265p\034\003\333\366\310\2341m\333*`\006\352"
+	.ascii	"\321\365|Qz\177\205\375P\333\226\265\031\323\266l\n\230\250\036"
+	.ascii	"ef~\225\257\325`6\211\355\214G\320\316\216rK^\333\262\021\231"
+	.ascii	"\355G\351Q\365E\351\321Nr\366@Ca\020\250\376R\364\354\313\362"
+	.ascii	"\265\016\024\366a\220\031v\341\034\030\221sm\333\366O\300\206"
+	.ascii	"\334\340\371TF\246\36790!\347\272FN)d\332\270\300\022]\340\326"
+	.ascii	"\364\216\360\030\273\372;\035\334\215a\0212\225\247\360k.\313"
+	.ascii	"\347\300\304nz\"\270#\263\347O\300\202\234G_L\226;\230\311\213"
+	.ascii	"~k\354'\312\265\327f\347\205\031\366>\033t\345\021\tbv\235\303"
+	.ascii	">J\272\267\375z1\271\356\375Yh\333\226\357\222\311\343\034tf"
+	.ascii	"\246c\3464\346\337\204\374\270\237\351\340\001\004\210T\004\211"
+	.ascii	"\373%\332B_}r]\255\365\244\033\2706i\233uy\237\314\313d\2318"
+	.ascii	"q\242\273G_\2135\311\342\006m\263w\334\230W\222\223\350\336n"
+	.ascii	"\272Q\312\340w{\030\024\227k\242\265m\362\313\024j\322ATQ\352"
+	.ascii	"~\311\253\262\265\230\357\345_f\360\321\330\310\202Ez\364v\367"
+	.ascii	"\330\243\"\306vc\256\024i\316J\337*\332\342\330\270}X\265\277"
+	.ascii	"e\251m\333J\340o9\227#\037\355(\267pq\277<\312w\221\036}W!\243"
+	.ascii	"kZ)\263u\373\230\331\264n\2331\377l\273\214\371W\376\004\327"
+	.ascii	"\362C\361\345\365\274\374\244^vR/7\251\227\231~\227\005\250\227"
+	.ascii	"\227\324\313J\347\345$\3652\222z9\200z\371\350w\331H\275\\\244"
+	.ascii	"^&\352\313C\3672\200\337e\241\337\345\240\337e\240\337\345a_"
+	.ascii	"\026\246\227\203\347e\340\275\254\242\227\003=\356\227C\275\n"
+	.ascii	"5\200>\030%\037\353#\rj\241"
+	.string	">\367\200z\330A\375d\223k\357|\254\017 l\220\373e\220\364(P\003\305\206\3750/|\224O\324\374\310\023\024\372\311b\207\234\020\266\222\031Z\323\212\330\330\365\314\212\220\235\017\202\262;#\327s\240lN\027$\317\223\025\006f\312\2023\263f\277\303qGg\314&\371]\207\243(\035\\\036^P\311\353\260K \360\351\260glZ\237\261K<P\035\354V\203\343\262{\343{s9YHo\342P(\233\322\\\303\373\263R;\2472\265\346\032\336\245\003\007F\t4p\325\276\333\353X'\277c\241\250I\021Q\314l\024VJr\016\330@\261\313Yq\234\212\306g3\035\324V\367EH\201\313\314Va\255\244_\376\272\367\2307\364\356\270\020\314\341\251Q\323\276x\326\373_H\357v6k\030C\206\373e\332'S\244\253\265\316v\226\210!\373\241\215d\272w\323\300\341nG\003Bm\333\255/\003\034\0340\200"
+	.ascii	"\007c@\215\bq\201\304\212\254Z\261\306\200Z\247^\034U(qp\njU"
+	.ascii	"\260N\031\251\216\305\025\253U\fc\213\342\214\365\003\206\021"
+	.ascii	"M\034\0340e\244q\244*\036\261\216/\216k\326T\321\210\244*\256"
+	.ascii	"W\307\025\013Ye\3454u\274Wg\251\005VRX)\250\212G\244\361\212"
+	.ascii	"x\2054\3128\"\247\210/\216E\027D)\344\025q\301\312UVF$\021\253"
+	.ascii	"\252\nI\024\262\265?\333.\343 \034\034ob\324\317\371\333\276"
+	.ascii	"A\351G)\346L\320k{1\363\332la\253\271\200\226\332\351\213U^\016"
+	.ascii	"\207\232\274W\324\321\247\034OM\355\304\324J\335\324Ku\002\232"
+	.ascii	"i)\240;\257\231\246\324KJ\035\201\216\315\260\250\221\372n\367"
+	.ascii	"\006\353u9\035j\022F\324\321$\345\355Jj\340\325z\200F:j\242\016"
+	.ascii	"\320Jm\222F}\324W\362m].\243n"
+	.string	"\265f\232\230\201\224\250\213z\330V\307\245\311E\324\017\314\240i\263{\3434i^T\204C\022.\200N\300d\003\200\206\250A \006\021\204\304\314\310\210\244 \005-tp\"\231\2622\017\021\020\265dJLJ\222T\206\003\2030\200\256^\001A\271\306(\244d\245\013\t\371.\355\215`1\241\326x~\266h\256\270(x\001w\342\310\243Wp4\330\30117\232\337\352\372X\364b\240{&\261h\237\335D8$\305#\325l\f4\333k!\320\2315\201\306k\bZ\002\t\n\243\362r\251\324S\251\241\333\020[\241\320\336H\034\257\227\312\242A\265E\315\254^\016Q\256\261\362F\324\2143\261\306N\213\315\243\251U\205H\201\263\f\367\"\312\200\264\261S&\003)\231%\234)S\007\346 \322\303\354!lFl\345\216_'\207o\311\235|J\262'\026\306\001d\275ZmD%D\321\245E\365\tSX\260YZ\351"
+	.string	"\204\"\212p\374\t\330"
+	.ascii	"B\353\343\275\365v\257F\273r\330\232@\350w\013O\322\275s\327"
+	.ascii	"\037\371\201\375\021\324\202\r\266$?\307\260\366\013\220\241"
+	.ascii	"\005\230\005\315\007\225\301\243\267K\215U(\320M\204\013K\331"
+	.ascii	"\001Y\320\374\274\263\242\356\375\001"
+	.text
+	.section	.gnu.lto_serTcpOpen.53.36e7517e7d6738c9,"e",@progbits
+	.string	"(\265/\375`/\005\355\033"
+	.string	"\3660\260G\220\234Qc\222\036\302\235\001\200\001f\256\016\306\257s\367\243\274\3779\361M\255\204\013\300\201\257t`.\324\240\027\227\337,\312-\256\341l\360"
+	.string	""
+	.string	"@ \221`\321\367\026\202\261\307\336\265~\365\265\314\005:\354\336{K\231R\226"
+	.string	"\217"
+	.string	"\241"
+	.string	"Q\2742\300\375\345\030R\260\365O,.\340^a\232\253{\211;\206"
+	.string	"\273\351Z\3557\335\251\350Dc\331\346^\034MW\367\336\035\313`7uJ\333>\221\027)r/\2078\214\201n5\265@\202\274\227(3\361\005\316\233\260\0178o\332\035\357\3754K[{\276\321\317\250\244\317\264\307/9\214E`\360e9a\312S\026\034 Ri.\031\261q\003\374U[\016\220\301\225\205\003\374\225\016\276"
+	.string	"i|\352U\t\350\253\025\255p\357uM\2011n\364\266\177l\207\260\315Z'\374\0367}\373\251Oo\372?\347\315j'P\031\323`\315\302\342\242\211\265KF\217;o}\240\252\374*\032\243\366\366Sg0\203\013\224Q\311\232\243\232\264\211F\325.\331/\257\025\332\227\372\021<\352\317y\222\337\300\237~\002/\336\261\023\177\324\325\246MuiSm\321\352\n\253\276\202\337\350B\212\341I\336\373\"\371u\257\230N|\274\370\333E\376\224ol\027\205~\223`\330\244.\244\272\356%6\270i\020\260Sj\347\305c&!b\222\241\f\357\302\220@\313\346\252\302\244A/\2675\234\013\214\231\030r\303\273l\241\3022H\236\033\2638|\213\2260C\216\267r\273\303\261\360\256X\254t\f\357\264=\274\n\217\201\026\225\005Z"
+	.ascii	"fp!\217\237\322s`xo\322S?\312\245\200(E\364\234O{F\034J\017\316"
+	.ascii	"\320&q\254\022\260{o\204'(lvx\3575\243\300\370\214\305\340QM"
+	.ascii	"\326%J?\210\346\203\034\251\216\224\027:c6G\207\023\324V\200"
+	.ascii	"\212\332j\355\031\255>\215Y\035$kd\277\211\020\316S\333\271"
+	.string	"_\331v\264\356\275\022\252n\025\273\357R\340nC9\034j\253\341\202J\333\320\354C\215h\346\003\373\241\315|\200\200f\027V\350b\265[5\355A\2166d\002hv\323\331v\262\235\316\246\342\246\253\311R\334fA2\232n'{\240c\\\316\246\223\r\341p:\331\r\361\276\274Vh\224\007U\013+3\246a+\212\022\253\322\357\235\246U\262mZW8\262\276\023\301\217\232\264Cz\262\206)\007H\365\361\352\321\0265^\006\204\324K\224\024\252a\252A\200\351jX|\375\276\274j\224D\216\306\353L\317\310\315\2246Wu&\rZk\367\234~\264@\246\226\021\023\224`x!^\250AT\346 !\031\"E)H\222\341\020#\221*:\021@1CH\031IA\331\321\260\033}\3230\232G\331\247\371=\337e\007\377\220\203'2\b\300N\361Ahlh\312t\364\241\310\216x\341\324\263\315\377H\233#\317l\033"
+	.ascii	"!\347\231\005\233\003%+\022\357\261S\300\ti\326\356\224\333#"
+	.ascii	"\210Ja\221\0331\375_\355\375\244\340\330[+\006\342]\370XkDW\274"
+	.ascii	"\030\027\205\2244\226\271.v\243\233%\320I\r\270\263\031\235\306"
+	.ascii	"\321kg4\327\256I\3037LwNw\005\266\331\365\257G0\264@\352 P\316"
+	.ascii	"(\321\273h\260\364$q\315c\322N+\2261r\026\214>F\025"
+	.text
+	.section	.gnu.lto_tcpTotalRxBytesWaiting.54.36e7517e7d6738c9,"e",@progbits
+	.string	"(\265/\375`\311\001%\021"
+	.string	"\026 sG\340\322&\035R\033\006}r\331/\271-\344\002\360w\275\226S\0266u\2424]\255\f\337\267\033\270\034\344\366\350\227\004Sm\360\233\3248\366\246\f1\016\306\030o"
+	.string	"\244\341s\035\353\031\202Q\324\254\332\266\031\331[\312\224\002^"
+	.string	"Z"
+	.string	"c"
+	.string	"\323\306G\2159\277\022s\362\321\237\264\355\357\274\205\214g\340GB\266\001a\270@\0132\347\307\221|d{\204/\260=\356\210\317<\302\325\031\277\365x\235\034A0e\250\006\223y\370B\0053\035\035\004\310^p\304HD\217\323\2561\231K\025"
+	.ascii	"\312\234\323\n\223q\270\267\333~`\333\201\255\t\002\376Z\272"
+	.ascii	"7\366\341\\\033\233\254.\275\347&\375\347\226\377\376h5\214\352"
+	.ascii	"\215j\205\352\0070\240c\004\001\307\234\032jDfQ\274q\342=\377"
+	.ascii	"\317\325\226\361}N\263\351\007\206\3445`\276J\304r\032\274\007"
+	.ascii	"F\2666H\240X\206\037s~\013\036\315@\252\332\347\271\013\231\177"
+	.ascii	"1'0\003Bxh\324\006\020\243\020poL\2332T\253\311q\335\004lV\264"
+	.ascii	"{c\322\312=\200\263\343C\364\322!\266\273\323@@\332H{\301\202"
+	.ascii	"\247\244\361\026\332\2766\213J\017\223\373\002\302\302\266\354"
+	.ascii	"\313x)9\232\363u\230M\3411`\344\234\257\023\030\254\325\311\021"
+	.ascii	"\316\243\037\263=~O{\\1D\004\373@\2435\007*\247\324\004\270\322"
+	.ascii	"\235X0\205j9\261V-\2354\312\304\005\305\212\260r\352\274\324"
+	.ascii	"\212[y\251\n\235\247\302\265t'\026\016\345\2558\023\022\253\\"
+	.ascii	"R\036\307R\251<\316\364\315\303\2716V\036)f\260DR\201\242\310"
+	.ascii	"\232\026n\3146\\\243\320\254+\356\2266\n\311\325\335\205;jf."
+	.ascii	"Kx\220\324\215\264\031\001\" P\002!\344d\035*\204v \216\207\005"
+	.ascii	"&h\337\210\\\244\216\317\032H\314\334Q\231\0073\037\317\034\023"
+	.ascii	"\223\007\033\212\307\276\214\211\266-\215\022\305\373E\006\354"
+	.ascii	"M\234I4\217$\266\335!\332t\311ck9(\346\3239\355\006Z@\2005\002"
+	.ascii	"\217 \273h\332\005\005"
+	.text
+	.section	.gnu.lto_tcpTotalTxBytesFree.55.36e7517e7d6738c9,"e",@progbits
+	.string	"(\265/\375`C\002\235\022"
+	.string	"\026#|H\340\320(\035\330\025\033\001\306C\207\340\234\337\203\340N!\016I\352\276\030\035\377\215\021mB\207\235@\363\354o\254\036\217Ac\265V\357\233\327\276F\031\233\346`\2479:\203"
+	.string	"\205\200\233\310\203\336\325\215{N\030\331[\356\224\002b"
+	.string	"f"
+	.string	"k"
+	.string	"\321~\356*\\\016\266\\\300\356L\216\027\273\340\210?\357\323\240g\333G\361\024.\226I0\004\256\373\351p\201g\307.\370\235N\240\373\224\037\320}*\210\313>\245F\231\377a2K\f\2057\334\3543\346\022"
+	.ascii	".\346j\302\325\344iw\357\363\b\203\243\305\370a\262\273\2167"
+	.ascii	"\234\206\273\273\355\023\333\f\354\310!<.N\344^bh\203\263\250"
+	.ascii	"4\366\345\352\214M! \337\271K\357\271I\007\177\3579w7\243\347"
+	.ascii	"\214\2263Zgt\224\321\027)`t\303\201\216]\fa\217\2651c\220x\316"
+	.ascii	"\277\363\367\\m\027_\347<\367q\251'v\252\005\330Z\215\314\315"
+	.ascii	"\202\235\330\017"
+	.string	"\214\007\005\317\221y\263\f\236\317\217\b\243]\020\301\247\023x13\216\246*\210\306\032$\215\252:q\330dh\021\016\303\213\372\021$t\224{\221J\023\242\r\206\210l7\264\270\2733U\032\227\224\244\006ljt\210j\221\207Kq\336A\335\004\225\370[IY>X\320\231} \226\221\242\335\332ov\353->K\2567A#\274m0\205\263\210y\273\265\022\177\005\353u\240h\304\247\337\322}\222t\006((\225\004\231\262B\301$\212\352u\362R\301b\020H\252\024\013\005{\261V\236S$+)\330\203\024\324\312\245z}/\227\252\302\312\205\362\261V(\225/\345z}$'\267VT\256\017\326j\271\276\022\270\227\2533>\216\220\004\321\333\340\3444D;\205\261m\322\323\213\322,\022\206axY7\325\244\267\311t*u\352\004\262\335\310\220:\203\002) \240\002\031I\352\001i\204\246SQ\206F\202EK`"
+	.ascii	"\245\210\302\025)z\266a=^\304.\017\3621\234y\345'\317\215u\315"
+	.ascii	":\305`\227\241)n?p\212\254\260'\2361Z\021\243\301\204\024\307"
+	.ascii	"0\030\206\256\301\331E\360l\374\033[\201\2432_\315\227;\210\013"
+	.ascii	"%\343<j\f8\275\265\275\f"
+	.text
+	.section	.gnu.lto_isTcpTransmitBufferEmpty.56.36e7517e7d6738c9,"e",@progbits
+	.string	"(\265/\375`\216"
+	.string	"\255\n"
+	.string	"\246TKB \2138\035\270K\022\200\277\344K\0020\n\200\277~\347\275B \260\240\223\032\200\020,\b`\332#\370x\024s,\325\212\362z\302v\214"
+	.string	"\204X\320(F\356=\206\215\003;\332x\266\250&\264\211\334)\0057"
+	.string	"6"
+	.string	";"
+	.string	"\016Oq]f\237\270.m{\203\243c\317\303\023\351\b\026\214$|\330\r\247\036\270\347\321\343\337\301\245\007\013\033\300\322\347\021\003\331]G\2604\340\326\333\306\260\355a\377\"\276\265\273k5\031;\352\267\254h\265\242\243F?\253"
+	.string	"\221!\344\302.i\025b1\310\224\002\333\035{b;F\373\f\336\240s\024\347\022\273\246\016\025vC\r\317\3542\252\237\300\001\025\021\345\255\272\256\366\245\213\007\243~\024\020\240\037\373\021\002X\234vE\007\355\222C\370\262]Q\307\203\r\200\214S\202K\237s]^U\003H"
+	.string	"\024Wv\370\211j\300\001\233\206\261h>\f\227Y\253d4\215\b\211\205\363\266o~\336\266\341\274\221\211\341,\227\251y\337\254P\334e6oj\272\316\233\223poL) \rY5*\246\230j\224\n\231;\205,\016"
+	.ascii	"2\003\302\260#;;\207M$&\224\270w\211,\216\202\225\030{b\317\212"
+	.ascii	".\243\\5\036\252C\030\3235\311"
+	.text
+	.section	.gnu.lto_tcpRxConsumed.57.36e7517e7d6738c9,"e",@progbits
+	.string	"(\265/\375`\306\001-\020"
+	.string	"v\335iG\360\262&\035P(S\265\b\177\321T\376T\256\354\0315\242RJ\231\357k\177\225\3178\354z\207\320\367~4Fn\277h\021W\026\2523\2159[\266\340\211\214dX,\212\211\300\252Q\263h\336\250}m\033\331[\312\224\002R"
+	.string	"N"
+	.string	"Z"
+	.string	"\273\337\001s\244G\177'\331\036I\007\260=\032f\363\370G\333\221\211\033\0179C\273\313i\211\303\036\241&\314\177\355%o\026{\23494\315d\251\320\200P\r \"\263\030H\"\203\302{\355\371a\006\2239j\260\273No\006\342\336n{\202m\005v\236\004/Yd\177\261T\022\366\341\356\256\265\306>\316_\272\315?\202\351\030\3230\246\025\246S\323\027\371\n\236!\037\025tve\212\202\254O\354Ia\373&\333\371\335\005\3548-.\355\216\bB@z<\301\247}\026o\001\273\215\313Gvkf\360\004<j\223M\325B-H\226D\036\311\357<\325NA\345=\325\004412XJ\200R\217\241\"@K\355r\340\360B2\3367\266\222^\355\025\206\274g\023M\007\215\331\207\301A"
+	.string	"\315\263W\256\323R"
+	.ascii	"\310\254\277\320@\332\335\0059-W\t\320\t\227\355\361\032\177"
+	.ascii	"t\324v\354\204\b*+\324\013\272\356\024J+\365JQA\255:\225\213"
+	.ascii	"su\252\r\253\356\002\227a\205Z\341R\235\213C9\231\325Ru\334\213"
+	.ascii	"\305\3528\323\267\207\2535\216 \302\347Ea\342\200\214j;xp\222"
+	.ascii	"\331`\t\201\360\036\223\250:\363\303\300\247\207\nx\032\207\232"
+	.ascii	"?\002\234H\240\220\367\240\376\346\247\021\t\005' \200\002\021"
+	.ascii	"2\343\003\343\320\"\212\301>T\224{\031j\236fa\305\220\230\317"
+	.ascii	"\005\211\320~\2706\233\347\264\3010'\0037\201\025\022v\025\230"
+	.ascii	"9\032ir\t9\336\230\345\361v\212\326\001;\212W\331.S\371\353\022"
+	.ascii	"\006\216\"\243-|\366\250/K\023\243\247\313E\233\274\323\\\325"
+	.ascii	"\321\367"
+	.text
+	.section	.gnu.lto_tcpRead.58.36e7517e7d6738c9,"e",@progbits
+	.string	"(\265/\375`\312\001\005\021"
+	.string	"V\241tG\340\322&\035\222!\242[\206\374oE\374Q\217\326T\035\305\263\211\206T\325\236\2062\236\242\306PL\344\246\r+f\312\364\336\321\035\255\25458A\f3\024\217\343\323v\347)\306F\200A\022\300\362\255%\204l\"eJ\001\\"
+	.string	"["
+	.string	"h"
+	.ascii	">\3612\355\253\370\212\326u2<\300\256l'h7,\361\347=:<\t\367\350"
+	.ascii	"}\204{\264\355\005\fZ\216y8\273\341H\310\250\241\371\330\r?\025"
+	.ascii	"\361\230o\2321\376\tQ\315&\346\372F\212u\270\212\304f\266\322"
+	.ascii	"\356\236\366\204\305^\231\335\203\335u\332\3048\334\361\266!"
+	.ascii	"\330v`'J2Y\263CW*\216\375mw\327*\263\037\336\244\373\334\243"
+	.ascii	"\353\374\235\227\346\272t\354\322[L+\227\316\230>\200\001A6R"
+	.ascii	"~"
+	.string	"voj@\266(\n\225x\370\373<\355\226\317\3424\207\370<\357i\335\347\202\347\332\340\001\301h\240x\217\245\355!\006oMt/p\f\361\330\r\023<\006=C3\371\303\266\312\205\300\222\031\b\242\226\214\370An\244\233\302\020\355\240\001\361z\f\030\223\202\331n\210\347\370/\334#I\223\b\366\201'kN\275\252\236\346\304+k\036ij\244\325\0049\035\306\213\201\033@\004n\\\273\036:\214\272\013\360\300\314\236\360\026)ow\033\374\270T(0\313y\364Y\270\307\221FZ\016\024:\001+)\023k\243pJ\324\251\305\304Z\265\244<\237L\\N,\225\025SJ\205Z}+\025\312BJ%\341kI\231X\276\223j\365\231\224\f\272\240T\037\013\004U_H\270\337Ve\0079\222\0245tSNa\266I*\342a\247HF_\036IN;\265#\244\344m\\\322\240\256mS\234\347\356\272Te\216\272\251\200\036"
+	.ascii	"[\204V\331\300l\337P\030\266\362\337\004\217\013\001\024\002"
+	.ascii	"\347\256\214\210\2319\005XY\bF\001\342\202\203\253\312z\2534"
+	.ascii	".\346cL\317\241\266!\327\230\260\211\b\027@S\364\340J\023\003"
+	.ascii	"`B\362\362T30%\016uok\213\036"
+	.text
+	.section	.gnu.lto_tcpReadBuf.59.36e7517e7d6738c9,"e",@progbits
+	.string	"(\265/\375`\327\003=\033"
+	.string	"\2263\263J\260\226Q:\345\200\243\334\250Y\032\240\002F\337\006\234\231}\336\266\210\261\337C\257\356y\337\bK\237\252\267\241?\372\322\321\215\376\363\001\306\333\365\\\244\354!\357{/)2\325\365D\362a\202"
+	.string	"N\220\234\335[k\204\020B\344N)\233"
+	.string	"\225"
+	.string	"\244"
+	.string	"RS\265\022\021\234\364\003{w\\\210\367!7\215"
+	.ascii	"\352\257\005\211\245Z\253\214\031\234'cFJt\224"
+	.string	"T\315\251\375\034\327\301\373p\304Yj\355QZ\252\225(c\331y\322\304\273\224'\317\013(O\232gK\235\370S\315\030K\202<\242\324Ze\353\302%\345\335,\311q)\317\247J\212v\204\275\233\243\251Sb\006L\030\034k\252\246\230~\344\243e\215\024'[B\024\037aB\2351&\351\224G\370\243\373\243\2177\212E;\302\024\247\246\203Z\253\351\216\360\304}\3366\320\266\004{\237\004\265V\032%\f\035b?2l\345\311\226]$Pp\fs\350\225M\354\321\365\261_\363S5\345\355\261a^\216t\307>\364\273\264\234\370\007\370\360g\031\251W`7\272U>t\277Nt\273L\352\226I\3152\251O\026\265\331\242.Y\324\344I=.\365\232\324\324\244>\001\030\023F4\024k-q%\245B\221L4\216\364\023\375F_\373\366{\370Iv!\345z0\241\232\252\265F8O\376E?\262\313\266\021\316XU"
+	.string	"\250?\244( \bD\273\263g\342,B\n\273\262<vl_\013\263\r\212M\200@\343\252\354\313\322\024\223\214\344\372\374G\230\3540\032\267\247\265\254])!\"?Z5d\227@\210\201\326&x1\3149\227\265\007\256\360\235\213\241X\fZ\265\320q\315UY\273\302\005\372\035/`\001\334\236\313%\327\334\021\t\320\206\257\334\373\bZ\345dx\220\0203M\007\310\235y1\214\355\270\n\212N\257\335\215--\002t\342\243W\246\273;N\tZ\301\366Kw@\023\020\310\347\r\007\262\243a\222}\237t\031\036R\250\266\310IG\270\353\343\331\227v\005~l\332\177\324\316\037n8\036h\344\315A\330f\272Qw\303\261\241\2213\335\214\303X\243\335f\272\334\315v\2326sC\323m"
+	.ascii	"1\263\341j9Y\016W\023a"
+	.string	"\303q\220\335l\263\0202\032.'\233\211\261\315M\r'\323\331\330\340d.b\375X\302\326eA\b\225\263>\307\250kY\326\236@\201~\307?z\313\351\nJg{\346\372\370I'\203n\220+R\264eaQAJ\344\313\376\350'\225\216'\032`U\226\347I?\247\004=\2210\353\221\272\354ky\020\374\2650h\034\021z\372\321\252\261\326Z\313\3651]\177WnT\320pd\005F\250!0\242\020DJ)\201I \023\214&\325\030\220\002\221\252\334\006\020`\211Dj\f*\204\234\351\3362\327T\"\322\252T\375_\334<'l?P\216k\323 A\3308h\210\027\227IR\242\347\0170\340\204\214\351\246\327{\033\0234#PJS\322\260\377\316'\035<zQ\324@\330\307\257\261\016!ej\304\330c\372R2\233\355\236\350\252$\352\031\331\030\004.ne\307\007\024\213\346Z\b\340e\303`\002B,\300\325"
+	.ascii	"\236`X&yI\001\037#\373]\214\311\246\265\250"
+	.text
+	.section	.gnu.lto_tcpTxRoom.60.36e7517e7d6738c9,"e",@progbits
+	.string	"(\265/\375`L\005\365#"
+	.string	"\272Ap\016Ep\236Q:c\327_V\300W\201\020\216\335"
+	.string	"p\370\t\205KX{C\331\234S\354\333\333\352\\\021;\306d@\272y\306\212\f#<\204jK6(Jp\236W\317ni\001\223"
+	.string	"\024.\265\3457\322\b!r'\031\323"
+	.string	"\311"
+	.string	"\321"
+	.string	"\234\362\303\250\350\024\021\035\003\006\004\355\336\365\301M\236\200Z\313|\256\203\351\361\225\307\005\334\333\344\f\232{\327\b\314Co\362\212\276\313\275\364`\265\\\241\024q[\303`\227\332\275+o\351\005\316\233\345w\347\315~\302\266=/\3273\316\252\317\245\270\033j;\315\262\255\312G\276\334rFHX\234z\316\n\021\253\250he\323\322J1K\273\035\342\2212\203\330U\220\177=\201\025\242\021\213\273\023!Y\277\235\352\310Q\333\026\222\264%B\260n+5L\021\"\271\035b\221\262\204\240:\377\n\332\323f\335$\362\262t`\034\033R\207I\237\264Xe\273t\200\226fPQ\321GY \310\024\341\221\267\303\"\320Z\333\206{/[aQ\310Ywf.c\346\021\314\246.\375\344\231\272\346"
+	.string	"\257\213\323\207\330}d\376\235\266a \317\252\254!ffq4?\324v;\031S\210K\200}3\277p\262\027\356\232E\222\252\236b>\230\016\bB\346\247\233\201B\357\275\027\312\270\220\021a\217\026\217\363\346;\275J\"\313\310\\Q\3315\346\025h\373\310\374\006]r\254\270\2330\247\226\021\244\226\225p\226\223\220\216\214v_\377"
+	.string	"\367\362:\347\322\2079\343L\313\267\233e\033j\371\264Y6m\226\313\323r\233\226mi\371\n,x1\036\331\372\321e\353\r\262v\350\222\231j\250\334\353\017s\346\213\341\177y\251KU\353-\2460{\343E\355\302\273\236dNy\307\305\260\355j\214\332\2757\335\301\234\336\264\314=\370\310\032\230\230U0\034\354\205\274d\205\347yz|-\356\340\301^\350\341\274y\366\r\013\302\3136\273\b\231'i\004\3325\356.\373\301D\374\341v@t\273\300\242f\374\302\365\377N:"
+	.string	"lN\316\250\221)Ad\353#\237@\222\\=s\215\204\005\020\262\345d%\t\235}dk?v[~\354\377z\b?F\202a\315WO]\017\255\335\265-w\375,i\346\364\256q=\344\363\n4\373\230\346rtP\356\275\247\031\254@\245\230\232>e\037\031A+\365\221\037"
+	.ascii	"\210I\035@w\314\236d\021\207\323\204\"\350'\315\216\254yfs&5"
+	.ascii	"?I\242\204\275P\2511$\361\321S\374\344\331\314P\272\360I>q\261"
+	.ascii	"&&(\367V]X\343B\005_k\305y3)\214\3731@a\202CS\213\021(N\260\320"
+	.ascii	"I5\305\200\302\021\345\244\003\255\321\353\371J\251\363\223\204"
+	.ascii	"\033O8^\320p\212\362AI\361\244|P9\242|1x6\242\234j\360\236|R"
+	.ascii	"<\tK\334\273\001\345\343\341\350\365|\274t\245\n\036\2276\227"
+	.ascii	"\350\307\216\204\204\246\261!+\204F\325\300`\356\326\366O\332"
+	.ascii	"\357\326\025\242pQ\331\265\366\243\244J\241\264\217\374\257\243"
+	.ascii	"w\300\214\004\303nG\272\316\365\020\210\224`\330\315\250\271"
+	.ascii	"4q\235\366\220\307\236\266\375\363\277\274\367^\334\237\347\372"
+	.ascii	"\250'\350\001C\226%\215@\243&\220\345\306\201e<WOfuK\245r@\214"
+	.ascii	"\214\311\332\256\250Y\370\324\310\251Z~\366Kj\ngaB\333\206K\023"
+	.ascii	"C\267\337@\331p\r]`\315>\231\357Q\273\034\315\250u\257\325\205"
+	.ascii	"\352\027\324*d\250a \304\224C\b!\021!\221\221\021g\fP\0021\n"
+	.ascii	"\335\361\020pI\222\244\320\034\032\202J+\256}\230{$\027C\316"
+	.ascii	"lW\207\304&\230\366\362\\3\273l!\311\255h[\375zc\371\bQq\256"
+	.ascii	"\035C \322\345\265;\270\326\256\263\337\351\004\264\346\f\315"
+	.ascii	"'\322V\351\347\366\033T\221\271\237?/D\201\351-D:\272\334\266"
+	.ascii	"\350\201\244\204\317\221\257\377\222\305\324\023\032\006s\206"
+	.ascii	"\244\271\036\r\223\242Xf\264\241M!\223`^\016}\t*\376])A\356\267"
+	.ascii	"\307h]3\b\013c?G\005\036=qP\004d\366r^\371x\267\356\r2\347\262"
+	.ascii	"\337\364\207\313\217\261\2337\227jT=(\273\341\310\343cq\216\272"
+	.ascii	"`k\201\207!e\024\365[\266\215\005\312\240^89\203i@\255\273S`"
+	.ascii	"U\243\006"
+	.text
+	.section	.gnu.lto_tcpWriteBuf.61.36e7517e7d6738c9,"e",@progbits
+	.string	"(\265/\375`\366\004\225 "
+	.string	"\366;\321G\220\332M:"
+	.string	"ae\312\025U\202=\030S\276}\034m\372\347D\023\204\202\201|\271\006\334>lU?\342\337\310\234\033\367\262p\3102\325pj\327\345\214\001\345\344\017O\241^G\b\022\300t\207\037\261[\223F\b\221;\245\273"
+	.string	"\255"
+	.string	"\306"
+	.string	"U\210e\273r\301\304B\024\3409\205u~\211q\261\251\265x\340\245)\330\353\344^\301?1\026\362\247Z\351\2001VkM`\b\347\313$\222\026\275\206\216\203S\373L\316\025|\327\212\003\325\232Ue\254\326b\002\347\316\227.^\310|y\036\200\371\322A[\315\213[\265\026dI\013(oj\255\271\345\341\032\r\376\254\231%\2714\350S5_C\342\324\3170X4\302N\257\210U\264Vd\306\315\033Q\306\313\036\242\220L\252\265\342\210,(I>\340R\322\343\306\323\027D+r\235|\221\335\b\026\r\272\017;\231\004M\332\2208\343\264&\241\326j:$\306\270m\267]\303\266\007\233\224\023N\244\354j9\304\257"
+	.ascii	"\217\266\354\021\267B\342\254\265.\215y\320\t\330\002\2623_\016"
+	.ascii	"\355\2261\203\323EE\323\354\342\024]-\373Ka\312|x\263l\244\243"
+	.ascii	"O\271\213.v\023\375\311?`\350\305?\300\273~!\222:\350Qn\240\203"
+	.ascii	"\335?\177r\373\360P\367\354P\363\234\324;'5\356\244\276\335\250"
+	.ascii	"m8\352\363F]\263Q\233K].5\271\324{R\323\223\372\005\210\306\300"
+	.ascii	"8\221\325\n#mN=+\257\f\371\224_\354\217\362\203\235\264o_\212"
+	.ascii	"O\345F\343\304R\030]"
+	.string	"\200m\230\022%\345\250\205M\255\025\303\371\362\377z\230q\266\301\244\036@%\2643\236\375\035\327\feP\371,\322F8\232\021\0229\332\245\343\027\322\\\255\177\214\361\n\220r\263\274\263\270]5^]\254h\0343 \202-/J;\213\240G\027\325mq{\341\215\252\333\2128\222\021\240\346\376\254m\355\f\032\350\207f\220C\270S>\267\266\266]/\302#U\347\236\303\2718)\241m9B\253\255\322\231\256\2425w\301\261J\271\273EK\275\370l\315\215\260M\025M3\321\222[\322\335% \326\242\016\320~\351\032\221\021\022\251r\207\223\001\377%\313\273|\033\224I\263$\314F\226\026r\265\374\024&\321\026%\341\341u\306\212\306\261\020\025Z\373\003\b\372!\321\336\370\343(#\236Y\355\324\212A\023(z=\037\351\364$ebWB\235I\3073A\376\236\244z\273R\367\3231\221\274\335\223\356\027\365\324tz\247"
+	.ascii	"j\367#qB\327\344\343E\345\242|<\025"
+	.string	"M>\246\334S\223\016En\347\213\312)Hr\017\212\347\313\375z=_\016W\254\337,\207\260rF\265U.@{\326\016r\005\233$Y\241\361(\332\204\233\241 \240\307\3001m(\343\307\271Z\276\361e\331\0163\350\204CfF\207\026\350X\326e\036\331\212\220\031i\200\375\331\253\033\177\322)3\232Hk\222\016X\237\275:p\237}\330\251\017$i^fd\255\265\326V\313\224\364\201\346\036\313\204\224\270\r\332+\333\210\2267\0263hy\326\256p\301\017S\302h\b&]\250Q<\204\230C\306\220L \"IA\2525\200\002\221\261;\017\021\260948I\263g\"\016a\016B\251\035\203\344\317J._\201v/\354g\031^\253@T\371\307\n\341\007*e\250\372o\206<\372\005\374'f\274+\214\310\347\016\210|\363\214\265H\032\212\302\204\313\327\362\320\377\320o\030\\\302\264\315\264\004\210\243\007\bR\227m"
+	.string	"5A\177\270t\331\324!\214\346#)v\337\024\0225\377\267\036b\200\031\027\367\316\223r\337#\005#\033\357h\342\362\271\355\013g\346zK\n\230Gi|\353\214\ny\372"
+	.ascii	"0\342\007\316ps\260\201\262\336\344\210\236\264\360m\020**\021"
+	.ascii	"\240\352B\243\364\315d8\343s\213\323\332\366,\207&\223\362\376"
+	.text
+	.section	.gnu.lto_tcpWrite.62.36e7517e7d6738c9,"e",@progbits
+	.string	"(\265/\375`?"
+	.string	"\275\b"
+	.string	"V\321>8@\345\2501\340a\307\300c\327\031\213\237v\377-g\"\376\227c"
+	.string	"\205.\304@\344 <\030)@X\247`\373\346u\030F\007\302<\b\257\330\221\345p.H\272\255\224)\005,"
+	.string	"-"
+	.string	"0"
+	.string	"\027\307\003\032_\355Z\030\177#7\312K\307I\314\177\031E\334\031v\265S\016\360J$\303\215\303\377B\257\364\341F\267Eh\333\320V%o])$m\335i\033a\253\260\320\371\303h\374AX\252_\345)\203a\353\022\237:\2432,\360\233N\252\377\363Tr|\3653\201\306\001-\215\270\321\rL\260M\234\342\f\\<\030\333\212\013h\257p\265\322\342\210\244\366#\301\030\322:\363\377\215\246\326(\033f\nXZ6\326\357\021"
+	.string	"@\022\030\314\260\r4\3426\215S\354#\302F\020\023 mf\234\344ff\241\315\b\271i \n\211MN~\016\032\022eS\216B\241);\337\235y4\365a\025\t"
+	.ascii	"2C\003\0258\036A\317\004\021\327\320Sap\200\n\r\356\362\242\235"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_tcpKickReactor.part.0.91.36e7517e7d6738c9,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"5\n"
+	.string	"6\023E: \261\322\001\244 \f\025 }.\254_\312\355\314A0\003\257R\202T5\027B\247\233\305\230\364?\202\244\204\356\356/\002\026\t@&\004\267K\001\007\260\243\n\037b\311&{\247\0241"
+	.string	"3"
+	.string	"5"
+	.string	"\266\212\303\241M\363Qd9\262\233F\255fw\353\351\224=\374\224\\\350\237v"
+	.string	"\361\265\372\fxu\\\022\234\343|v\327\236\307Mo\273\3016\203\375\203\237\335\376\211\312\247\2713S}L}Z.\031rS8\265\224\366Q\236\022~LM\227\204\265\230\304\354\216\013\247\256\336\251\307\033t\247\336\013\272\323\316\351K\034gAy\273\254\213~\355+\025\376\310\251A\224\274x\352\243\272S\373\002C^\264\200\013\214-c\256\344\214yr\347v\302\354\23103\360\261\273qc\263 \364\205$\022 R\004\347\220\307\024:=\220@\243O\004V\360\023Y\214>\210J1\002M\324\320\007V\017\202K&\321WO\245\322W;\266\345\271\2350;\310\330X\2635g\314\266'\257\022\023"
+	.string	"'+0\036\314\032\201@@\024\fs\205\2035!\364h*\004\363y\375=[)J\234\316"
+	.string	"m\246\3544"
+	.ascii	"\\{1\345\264\234~m\031\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.36e7517e7d6738c9,"e",@progbits
+	.string	"(\265/\375`h\007\275\035"
+	.string	"&\260\261Dp\252m1\345b\347\256*\32192\316]\233\236\307\323\350\221v\274\226\326"
+	.string	"y\364k\006\2179m-[}\240dm\240\374\376\252\252\252*\272\252}#\241\236'=\346\025\036\303"
+	.string	"\235\331\357n\255\330\220vJ\001\242"
+	.string	"\231"
+	.string	"\237"
+	.ascii	"\314\265\342\031\215\212\347\257\024\317Y\275\256+3\256\020\212"
+	.ascii	"g\257\346 'R\023\271\261\304/\221\370\244u\304\363D\274\205\036"
+	.ascii	"\260\314J\210\257 \"e\225A\201x\n\037^\202H5\024z\370\t\035\276"
+	.ascii	"\211\303+mx.\023\237\2164$\310!\215N\2731\303G\300\360\020.\274"
+	.ascii	"\003\321\3027\020+ \030\235\271\333\225\202n\274\352\302\304"
+	.ascii	"\007*\213\356\037\250b@7\023\236\201\330aM\332&\022~\201\332"
+	.ascii	"\304\357\310\314\344\312\262\253\027\246W\340{\246\336\373D\366"
+	.ascii	"\312\212\371\231\317D5\200u]\327\245\357\211\314\034\340\027"
+	.ascii	"n\367V\033&\201\022\220\244\247l\363\033\245\312\214\217^\013"
+	.ascii	"6\007\345\344\361\223\033\275\346vK\261V]\272\321\207^\004\243"
+	.ascii	"\323\336n@z\264d\355F\247\265\270\321\313`\367P\b\366\347h\364"
+	.ascii	"_; 3*up\243\223\257\352\336\255\321\001\367'\321\177\355O8v "
+	.ascii	"\317d\n\375\370\013>\236\305\364x\036\303\343Yk\307\363\226\216"
+	.ascii	"\3474\277g59\236\311p"
+	.string	"<\257\271\361\314\306\306\263X\215\3471\032\317a3\236\313\310x\356\212\361\f\006\343\331\314\213g,\027\317gZ<_\261\370]\007K\324\231\321\311p\302\270\206\274\263\307\214Iq\031\234^\266\rN'[\007\247\267\373\340L:]\007\341t\242\267Y\250\305I\253\232>\324vS\237\255(#\323\315\227g\272ydZ\241r&\225dz\3716\023z\202\304\215\221\351dP5\275_\221*L\037>\n\314\005\246\035&J\250H\2327\333M5\024~\2154/\311\220\245\223uv\245\223S\315]F\206d\215\245w\260\373L\353\013\235]\351:\244\322\213\202\355\257\360\210\227\216\364!\266\225\252H\r\235tZ\2609\215\273%(G:-\334l\213r\314\210\200\241\006\374\300\215\200\023Mu\017XVU\273\271\031\324\335\274\f\024w\314ws\247\366\263;X\\\351\315M\254N\335t\231R7\331v6V\356\260\226:\355m"
+	.ascii	"q\246\fRS\224\fO\024.u\247N\235\304\262\rp\023h\023\340Zb"
+	.string	"B\222\370\0048Y\263y\277\266\236Mg\363\236j_\234=\\\212j\376\333\325\226\212\274\300\200\266\271\315\225\"^T\324\211\200\335[\310\226\3709Q/_\025\345\001\377\220\345P'\335\346=Uh\242\360P(3\2577J(\317\371\002#%\002\032y\250\201\214C\271#5\"A\202$I\r\007\320\002!\"\342\034\021\200\030\2149e\"\222@\202\td\202y6\220\223\256\357\307\272[\367@\314N\230\032W\317\213\251\203\021\241\265\2711\346\210!\361\352\254\307\263?\254jq6+\017\215\306\375\304\"y\257l5Y\353:La\235=\213L\337\002\034\036\006\373=\373\274\203\376\377AI\373\n\206>!\247\365+S\025\363\250\362\350zS\304\233\212\300\251\242\332(\tD$JB\213\314lV\252\253\250\221\313U\025oRI\255c\315\371\2411\004\034\3457B\030\032\f\357\027\255\353\326PF\276\261\335\210\223\025\300W"
+	.string	"\215F\007\370K\235\345\201$P\2471"
+	.ascii	"\246\341\201\260\016\002\311\272 \334\246\365\244\317\\\216\340"
+	.ascii	"\025\324\245!\362\026\\\232\013\001+u=_\204\301\024%\255\001"
+	.ascii	"U\256w\013oH\327:T"
+	.text
+	.section	.gnu.lto_.refs.36e7517e7d6738c9,"e",@progbits
+	.string	"(\265/\375 \247\265\003"
+	.string	"r\212\034\037\200\265I\00730\00330\003\323\207B\201qc#6\"\"#F\326\337,!jh\023)S\027\332\2645\224\275\210>i\343\351HU\321\331\350p*'x\273\017\234\313\004NV\206\013\334\007\264\007\270_\264w\3327\313/\2133\205'\367\213\365\224zb]\240<\272\347:a#H\007\374\271g\216~\334\b\372P\335P\035\255\257j\272\327\215\370\017\004"
+	.text
+	.section	.gnu.lto_.decls.36e7517e7d6738c9,"e",@progbits
+	.string	"(\265/\375`\271Q\025W\001*?\022}W N9\235t=\326\200\264\307ph\301\241\336G\177T@\377\347\346\275M'\216\361\21682\2020\235\f\341\240\025\f\0321k\324\277\3237T\214N\304\313n\365}\203\312\333\347\003j\306!\367>\035sO\213\n\277Zi\372\331u+W\334\371\315\344\217\021\273\311\336r\247\301\006\274\007\371\007\"\334\242\232M&RZH\205s\272Z\\;x\264\016\017CF\032P{r\227s\356#}\325C<\f\031])L\356Z\306\373H\317h\035L%\310\272\305/bD\037\351\"5.G\311\344"
+	.string	"KT3\013Io\365\222\346j&\235\325Zm\244\225t\222\032\326G\376&\322X7\341\357\036}\244\232\265\220\034%3+\031 \026\325l\346\234\233\211\016/L\r\356\255\031\264\036\201\253;\270\203\225\321\004\314\254\357-\031\264\205\374\355\243\177\324\270\023"
+	.ascii	"\340\302YEY\366m <\357 ;x\351\304\314b9g\035\2353"
+	.string	"&WV}k\312\324\035|*\314\312\001\3274\353\016\266\371\202jpUw\260U\207\237\221\021\246&}o\261\2407\241\253\332\351k\025Nl\002D\230\334\345\234\3777U\347\250a]\3254^\327\272\tJU\327\350\251\n\347\304\3140B\300\365\244\327A\004\2355.DW\370\376=\365\306\341\245\f\314T\337\226\242at\246\354{\013\004\375\373F\r\353(\260\334f\246o?5\324\177`\325[[\262\321\367o(\0335H\300\252\224i\033M\243\322Q\211\325\215\375\007\3427\245\2753}o\253\320['\364V\006z\353\002\255\271r\300\0320\353\016\276U\242\357&z\261\312\001\277\303\240G\253\034p'u#\265\322;\251\217.b\304o\210:\351\346,T\253\0079\265zp\256\001\021\372\302\367=\207\276\337\320\263U\016X\0034\243f\221\007\206\fM\337.b\022\345\234;`\340F\346K\337w\032\2726\245\216\345"
+	.ascii	"s\236\352\363\"{q\365\344\350\2522\277\352X\016\221\206LD\205"
+	.ascii	"t\345\305\266\307\344K\325S\372R\222bT\245^\251pb\023\230rf\215"
+	.ascii	"J\035\253pb\023\330\342\373;\267P\0175Q5S\233\265\257W\3244\255"
+	.ascii	"\254|\265LES\317\324\260\272W\347^\275T\272w`\346L\224s\346\371"
+	.ascii	"E\214\250{5K\215\253pN\016\320j\362h\251]<\f\031\261\340\024"
+	.ascii	"\306\204\2772\241\3241\333\265D\303\276\\l\375\265l\257\232\325"
+	.ascii	"($\212\226\300\027ZZ\334\345\314|\345\372y\352^u\253p\036Z\344"
+	.ascii	"<\265\203\203*=\246!\315\234\231\"t\020A\004\021D\020\001\017"
+	.ascii	"\231}\031\341\340\326<\035\"G[J\372\276\225\320\327\260Jf\314"
+	.ascii	"\032\231rG\337\277\212y\035\363\213\030\361"
+	.string	"079o\345\234=X\267\036X`}\237W\361\376\003/\027\226\223U\337\n\246\326\325\260\020j\230W\273z\367S\210\231\23193u\332G\232\261\257\276\032*\007\334u\007\277\213\320\327\020\260\355\353\253!\340W4\350eV\016\370bu\007\277\206\351\"\207\305\272\300\3201/\221.gB\372\376\257a\225K\335\302\314\0350\023-;\332\372\276\272\241\257SP\246\016\016_\022>4do\025\213N\031$2r\3147%\325\312M\021\030JA\372\276\002\251m\277^R8V\250\311\355\254\357k\016\364\325\006\372\252\204\276\n\241\032\352\016\376\f\350_\243T\265\363J\210W]\337zV\321j\330\0065\355\"F\334*\275\362V\316p:7|J\264\340\350\373\024\240\257\033\340\332W7\300G\201vPw\360I\200\236\003\350S@+XmR\303>T\261\327\256\352u \0213\203\345\314\324\001\312\215\201\022\353{\022("
+	.string	"\342\362\210\353\240\257\037\260N____\375\200\337h\007\225\003\276u\007\227Pw\360\341*\007|f]\362W%u\353\2035:\222\312b937\340\230\221\033\312\352{f\345\200\321\272\203\377\346\242T\003\370\237#\376\352\345\257Tn\342"
+	.string	"G\377\023\004e\332\312>\371k\177`\307\372"
+	.string	"7\300\177\272\360\333#1\007\324_W\0238(\3201\302\177\266`\303\272\376\363\205@\305\304\001\336\341?W\370\373\206e>\355?\337C\340j\252\f\376\323\002\177\317\260L\376\n\001\026,\2518\325^,\352\214\300_\273?@\301\315\177\327\376zk\243H\263x\353\357\017\332\3478\377-\373\237\346\257\377\257\367\277\357\204\377|\f\370+\210\277\336\332o6\0077\3637\001\372\205U\242US\0203q\2003\005\277Mb\263\212,\222\377w\265\001\177u\300\003\024p\344o\023\305\277\203\025\204\232e\304&\177[\344\357\036\254:\004\004\027*\316\321\003\3763"
+	.string	"\177\323\260D\356\3416\377\311s1\t\f\371-\006\256\376\026Z"
+	.string	"\331_\235\374VH\220\277\236\331\022\374\325\005\177\375\371+\032\020\333\363\343?\b\326G5\253)T\034\235\352\200\n\201\277\036\251Hz\0056\307o=T\245p\001\374\227\313z@\325\271\026\300\216`\247p(@\352o\022%D\375v\0017\376\372\001V\363\374\204\377<\377\226A\002A5\205\232\365\234\377\254V\003\250\377e\352\375km\027L4\337_S8\b\377\265\373\033\310\332\370\355\223\255\361\267\236\245\361w\237u\372\353\007\347\373\355o\306ou\232\376\372\200\275\277\303\254\214\277\332\377\315\277\222\370k\t\027;\t0\370\b*\226\215a\231\376\232\302K\370\357\227\277\335~\013\343o\022\354\322\337I\024:\213]\376\365\203\277\271X\245\277*\340\257 \\\335D\n\017\300\177\265\330\244\273\237\377)\374;\251\203\374\376\247\t\376\306\340o\r\376\366\360\367\006\177g\3607\207\2777\374\335\341\357"
+	.string	"\374\275\363\367"
+	.string	"\376\346"
+	.ascii	"\375\333\247+\337_\317\324\274\277\332U\272\272\345\257n\377"
+	.ascii	"=\374g\320o\221~\333\342\267-\370m\f\277M\177\213\202\337\022"
+	.ascii	"\177k\202\337\226\370m\006~\233\302o\031\360[\236\337&\340\267"
+	.ascii	"\005\370\355\006\277\005\300o5\374\026\375\355\377.\363w\335"
+	.ascii	"\337r\177\307\375\375\366\267\330\337[\177k\375\235\365\367\325"
+	.ascii	"\337A\376\366\3617\217\277u\374M\3657\216\277\243\376v\372\273"
+	.ascii	"\306\337L\177/\377N\372\373\350o\026\177\013\375\235\377v\301"
+	.ascii	"\337,\370[\206\277\203\376N\376\235\202\277Q\3607\212\277}\376"
+	.ascii	"&\300_=\370+\b\177\305\371\353\221\277^\375U\002\177\305X\376"
+	.ascii	"\347\375\317\362\337\330=\177\237\340\357\340\337\037\370\333"
+	.ascii	"\304\337-\374\235\201\277\216\375]\201\277'\3607\211\277M\370"
+	.ascii	"\233\347o\022\376\006\341\357\003\374\277\373o\342\177\b\377"
+	.ascii	"\305\376\376\340o\003\374]\200\277=\370\273\203\377j\177E\373"
+	.ascii	"\253\326_\223\3745\353\257H\376\212\365W\"\177\035\362W\025\376"
+	.ascii	"\232\302\177\027\376\372\373\277\365\377\347\277\225\377\035"
+	.ascii	"\372\372\372\372~\233\271\0378\345w\300\227FE\244r.2\204\"#\345"
+	.ascii	"\234\363\tJ&\\\346Q\341\224U6\362QQ\316\002\310\314\234\221r"
+	.ascii	"V\326\f\227sV\346\234\177K\033\314\234kh0\272BB\312\331\251\003"
+	.ascii	"R\266\241L+\312\271\305\350\320\226\214\300\250\244x\322\234"
+	.ascii	"\200]e\026Le5:\222\312Wynj\211\202)\273\362Q\316\271\216A\257"
+	.ascii	"\226\230\304Ly\r\273SZ\307i\224\205\210\224\2005D\253\251\231"
+	.ascii	"\227\313\021^\243v\243\\)55\346\222p\364\255s\225\003\336\240"
+	.ascii	"\356\340\233\306\363\253v\036i\242\001\244\257\007\263_\264\377"
+	.ascii	"\032\271g7q"
+	.ascii	"B=z\364\255b\225\003\276e<\277f7Q`xQ\351\333a\354\027\312\177"
+	.ascii	"\237\\2|\246d\213\251o/+\007\\\200\272\203\257\030\317\357\330"
+	.ascii	"IG7FK_\017\234\024\301\200\257i\351\244H\006\256\200\232\323"
+	.ascii	"[\346L\321\213K\002v\273>0\303\250\335\256\313\225\303\314\035"
+	.ascii	"\317\355\272[\227\311\007,<\216l5\257\327\375\252a\267\3532\233"
+	.ascii	"\2313Q\207\237\213+#+\370\276\246\t\372\032%\350\177\227\374"
+	.ascii	"2\371\257\326Ur\364\344d\327\367\376\340\371]\322B\304\254X\351"
+	.ascii	"\373\032,\364w\225\003\316\251;G~\223\374\027\311\315j H=\236"
+	.ascii	"\364\255h\225\003\026\200\021\236\337#\3003%X\252\372\006\240"
+	.ascii	"\356\340\213\325UH^r\337\327\360@\257\220{U\303\276v\207d\235"
+	.ascii	"\234\267.rs}_\223\003U\261\206\177k\370\277>~\203\374\367\307"
+	.ascii	"\005\242\202\2764e\372~\256r\3008u\007\337\036<\277>\336\246"
+	.ascii	"\334q\365\275\251;\370\352\260/\350\353\353\353\333\313Y\350"
+	.ascii	"\352\350\313\343\356\370\325q\235\337\\\226\221\020\276\377\265"
+	.ascii	"\352!J\246\004)\323\227\231\201\023\222\244\2526\252\267\257"
+	.ascii	"6-\241\251JfG\023<'8\244~\210\322\244\\\251\033%\025\225\345"
+	.ascii	"\243\357\275\242\362\002G_\246\234\375b\005\316rqcb\313\312\231"
+	.ascii	"yW\334\026K\356\322u\272Lw\306\205\2727\256\214\333ta\\\032\267"
+	.ascii	"\306\215qm\324\260\373T\267\374\272\270/n\276Cbv\317\366iy\302"
+	.ascii	"\304\326\3544j\266\315\305\320\027&X\354\033\211\242%\220\305"
+	.ascii	"\020\026<\253wf\301\330\273*LlM\036\242;T3\304\305\304\326\264"
+	.ascii	"b\337\346\230\330\262l\031\213\306\303\220Q\276_eLlY\367\351"
+	.ascii	"\036\335\345o\b\f\023[3g\246\315\230\f\032d<\334\377.\257\322"
+	.ascii	"M\016!3\257\233\364\253\224\023%j\312J\337\213Tc\003\305s\267"
+	.ascii	"\3055\312\311\273\201\304\352\262\3705B\2714\367Z\364\275E\355"
+	.ascii	"C\312\f\2548*=0g}_\263D\017D\203\376w\350\n\3258\245\t\342v\225"
+	.ascii	"\277Bu\354&\207\226\037T^\372\370D\310]!\245\271\345\253q1\252"
+	.ascii	"xY\275\2419c\211\0209\2550s{\346w\027el\253\257m\332)gom`\200"
+	.ascii	"P\364\362P3k1\314\220\271\315\353$\034\264\246\036fcn\230\312"
+	.ascii	"\034f\214\030\240\0300_\210r\206\236\256t\\\335\331\341\230\335"
+	.ascii	" \242#\314\255\335U\256pK\323\327\326}A\272\242\001\367\037\370"
+	.ascii	"\203A\005m\251\357\201;\276\320\375\300X\025}y\271\245\323\241"
+	.ascii	"\253\233\302\352k\347N&7\204\372\332.\267\263\311\343\223jFq"
+	.ascii	"\331\322lgYBZn\267t\225A:\352k\343\354\024\036XE6\372\332,\257"
+	.ascii	"k\241t\361\0028\003=\360\b\375\355\233u\253\311\021\346\312\225"
+	.ascii	"\275r\353Vc\365\244\334\352\373< \234\236\236X\337\003\207\320"
+	.ascii	"\337\266\331*^YW\234\250\334Va\253PG\232yl5\256\265\270\035\r"
+	.ascii	"\365\265Q\354\224\377@\035-\272\255\242)v\215-\311\212\217.\272"
+	.ascii	"5\310\244T\261R\352\334\315\215\0345\272|MF\232\022\267\276G"
+	.ascii	"\315\240\277M;\013\322\022C\243\357M\020\263Ot\330\335Y3[f\241"
+	.ascii	"X\264\032f\317,\331\265gv\313.\261\314+\240\213.{^g\226\211\005"
+	.ascii	"\263]K\224\214\205\231\273\237\347\3146\261a9B\314\274|A\013"
+	.ascii	"\252\253\254\234\2316\310\227\027\"5\367h\335\330\317\205\025"
+	.ascii	".?\372\036\315\202\036\235\202Z'\026\256\nQV\337\243P\320\243"
+	.ascii	"_\350\177\373U\303,\230\365b\346\f\006f\271lW\016\0213/\375\274"
+	.ascii	"\320\240\272j\346\314\354 B\315\323\025\035,\356=*e\2318lniQ"
+	.ascii	"\372\036mB\217*\241G\213\320%@\266/K\310\364\375/\r\372[%!\240"
+	.ascii	"DQ\310\266\264\246\3201|7\236\222\264\216\237\0244=\030YHr\274"
+	.ascii	"\224@=\351k\221\234 g1Kd\254(M_k\204\347\366\b\007eki}\177\266"
+	.ascii	"H'\375\224L\241\022\303\252Q\360\0223|zD\206\f)\205j\364\375"
+	.ascii	"\355\220\253\031p{X}\255\220\232\245\270\273)}\377k\242gR\232"
+	.ascii	"\n\211\242%0\211j\013,\354kbW\326\305\327\276\\\35195\237\013"
+	.ascii	"<1MFK\215;\"4lU\372\212\026%weEf\360lU\347Q@\013\r\273d\201X"
+	.ascii	"'+e\241l\020\253\303\326\2606l\f\373d\247,\017\233\303\372\260"
+	.ascii	"Qv\206\355aeX\034\026\206\275awX*ke\233,\223\245a\177\3240[\325"
+	.ascii	"i\267/\354Q\331\2123\266\252\357B\260L4\324\305\027\324\235U"
+	.ascii	"v\237\221X\233\275\216I\231f\322\035sh\357\f\255\243\f-\211\323"
+	.ascii	"\322r\025\316IC&\372\342qU\357\354:X\346\325/L\313\215;6\267"
+	.ascii	"\316B\242h\tdA\225\344\256E\230\026\353\261.\373\342\272+\323"
+	.ascii	"fz\357\353\350\216E\363*gf\247\311\335G\242h\t,\242jq\327E\304"
+	.ascii	"\b[\325s\035\3062\257~N\206\242\356r\316kF\335\227\243\334\220"
+	.ascii	"s"
+	.string	"\225\335\225\255\262B\335\347a\310\350\002D\322\3345\230\255\262HvY\341\234r^\352 \311\016\276\345\271\345\307\231(\016\270\277U\352&\355\244\353r\332rPI\352k\223xn\225\276cCf%\215\220\276;HP\034f\345\200+[\335\301\377]\241\377Q\241\3775\241\377\031\241\307f\320\343/\350\261\033z\214\206\036\203\241\307G\320c+\3645\254\373\352(p\344\351K\337c\032\350\321\366\320\240BeR\260\240\35136\\CNK}\217\223\320\343\025\350O>\364pz\350\3170\350\230\273Y}Y\321\367\247\034\372\263\r\375]\335\301?\315\320\237\\\350\337^\336a\352N\220\001\240\202h\250\257o\177i0\357\272\246\313]w\202T\316B]\247\263\227\263\220N\255\036\324\352\301\325\242\022\362\004\337\237Z(\017\317\333\313w*\027\232.*}\177^\241\035*\007\374\267\\s\251jXl<\302\036\246\267\374\377\315"
+	.string	"p\300\232\232\276\372\376\314\201\376\214Bk\256;\270\337\032K\r\373\225\206;\206B\246E\324\367\247\f\364\005\371W\360O$\364\357+Vt\364\260paZ\351\266\337\226\2732\027}\177*\321\337&Z\227T\246X\027HM]\246\364Z\316\331\215\265)}\177\351\320_,\350\337Q\324l\240\334\220s\241\326i:?\340\332\262\372\376NA\177\305\320*\245\004\355'MV\303n\245\241\234\251\223\243\306b\314J\337\337\"\350\353\255\340\027\324[\301\277@\320zu\240U\252r\300\031\324\035\\\231_\0330\233\220\252\332\253\353G%F\253I\337f\236HQ}}}\177\241\3207\f\246\262\250fV\f(\313%\016\314\242\232Y93\337.^tR\216\222\231\225\002:\272\314\276Qi\031\352\213\3270@\302e\307h\270\f\253])6>\350d\361\332[\246\035\253\375\"F\204"
+	.string	"D\310^\263\357\363B"
+	.ascii	"\013\342f\326\027\237\375\272p\261\342\325\027\233\235OL_\212"
+	.ascii	"\364\375\315\216+ob\320|\0357\371\302d\325++=@\003\025\037@\236"
+	.ascii	"\034\223u!IB\352\213\307\276\246\304\345\316F_\354\004\213\265"
+	.ascii	"\221q\251\211\205\335'\313\252\241\037\032\271!'`z[\307L\266"
+	.ascii	"p\327\223\013\253e\326\362\315\f\n3\217\273\266\256\306\270\364"
+	.ascii	"\305\\_\373Yy\243\212Zb\207\2610\026\326\202\352a\265\344\272"
+	.ascii	"R\016Ir\254u\307\2209\002\325\027gu\336"
+	.string	"W\327\212\276\270\bF\322d\212\f\020\035\260\035q]\360\021l\304*ab\246\0066r\231^\270t\t\273a7_sM4sA\202\340!\036h\013\"%\213\254m\352\353\352x\310\332Q\331\030/}\261\220\257\375d\344\201\255\331L!%AA\251:\266\302U\370G\007)%\036\217\2146\253e3\0339}\370\335 \322\304\205}\034\377"
+	.ascii	"K\232R\352\213{|\r\f\221&\231\276\230G\211\257*p}\361\216\257"
+	.ascii	"U\241\202q\327\027\353\270\235\2240Y\314\024AZ\352a\244/\316"
+	.ascii	"\321\025\025\205\247:HY:\262'=\240\031\230Q\f\214\343x\352\246"
+	.ascii	"ESU\223\276X\252\b\r\032\030\252ze\245\023\256<\3515\261\333"
+	.ascii	"\032\031\214\032\307P\330\006\023\032\251\251\276\370\251\246"
+	.ascii	"\252M\312\230\276\337\340\003m\202\361\303\3003\252\006\346\020"
+	.ascii	"\227\032W6{ruAp\323\361\214f\323V\215\276XF\203!:\"\246/\216"
+	.ascii	"q\273Zc\007\213\272\276\230i\303\022vq|\204]\340%\316\303jE\230"
+	.ascii	"W\260\322\3612\005G\242r_\234\204\364bC\306B\307DX\b\033a8)0"
+	.ascii	"\026d}\177\314\342\330\350\0271b\203\232\246)R@\372\342\2423"
+	.ascii	"\217k\017\213F_\274b\203\323\211\211\n\024\036\002c\3467\203"
+	.ascii	"s\007)\245\230\016\326jX-{\250\305\021\2473\315q>\373\310\254"
+	.ascii	"\365\r\365=\371\266hd\264\276\327\220\205\236{_\263y<\246\314"
+	.ascii	"\372\236h^\207T\243\315\254\357y\246\313\216\266\330\224\032"
+	.ascii	"\260\354~\342\331\235ep\231\0341Odez?\313t\022Q\217\257\276\347"
+	.ascii	"\2303\357\246k9\026\227G\306\026\221\313+\31257f\224\275\365"
+	.ascii	"=\305|\230\301\365\204\252\357\235\206\251\271\237`\346\316\272"
+	.ascii	"\352\225\225~<\332\246\262\232\331\310\306\207\0339\255\261!"
+	.ascii	"u\227bet\346\326\367\244\373\371\345\007vZ\263\206\223\276\327"
+	.ascii	"P\204\236^\2000X\bA\353{\253D\265\002-o\313\226S\256\203\224"
+	.ascii	"\005\003\345I\257\231\323\024vf\214\313O\27109iU,\214\256\033"
+	.ascii	"\272e\255.\r\0278\2703\256ze\245\232\304\013\337VV\316N\037N"
+	.ascii	"=\2716.g\226\237qkO9\226\210\372\212=\371\237\234ov\2572\263"
+	.ascii	"\223\224\022\217\007\211\027\247\0179l1\212\304\324~\276\375"
+	.ascii	"t\0231\342kT\314%{"
+	.string	"}\317*\247\225\363\312\017<\177\330\330[\321\367:L\364l#\001\352\f\216\275\276\257\331\021\007\304H\337\237TN\266\037\210#\246d\366\242\357u\222\240\347\3329\245\tl\013_\337\353\020A\317(\247\024\241#\036`}\033D\232\035P\230\372\236fgZ\303\341h\256@;\263I\023r\366\005\355<;\323\252^lQ\263B\2500\241\322\364\375Y\206\343\207\020\0305s5X\224\201r\222)\211a\365\203\271\225\206\306\210\214\276\327\351\2012\371\351\305\344\024\303^r\036*\20194\227\215\234>\350@5yc\n\373)\366\213\030\361a\213\207TU\337\363\353t\302\307W\225\346\344l\322a\366Z\344\235`R\0038\355`\\\001\322\367:9\320\223\371\263\353\007\002\325n\344\230\352{\035(\364?\271~\340\357\211\334\323U\337\3538\241\3271B\377s+\354\334\252c\022\020\313BK\037\326p\224\271\321\314K\266\0216"
+	.string	"\201C\322\3679T\320\327$\365\324z\r;\265n\024\320(\347\030\013H\203#\306\b\317)#B\344\314z\300\214,\265\355\307[\226\023\311\317,;e\253\306\332[\337\363\310\327P!mBR}O#UO\210\210\205[\337\263H\035\333\272\241V\245\357\211U\341*\0324\271\026W\376\003\255\023\036\\\230x]]\3251_;.X\213\256\254\276\317\301:\201\234@\316 \027\310\031`\245\335\f\3050j\353\033d\b\026\325Q\337\347\354@O\037\247\217k\364\2002\272\273\354\344\364\001'F\021\332P\337\347D\241<xX\272\232\363\b*K9L9r\234:\236"
+	.string	"yqg\365S\007PO\213\350)\247\305IuRY\276\3169\347\253\237\023\037gwdvi\370\372>G\211\003\207\335\262\004\207\336i\343\264qFU$xZMY7~F\241]]8\372\372\236P8M]\2108\315\3118i\3108k\340\234+SJiy\3268\343\212\004yr6\235M\247S\315\3134\312\031?\235\250\224\331\033c\213"
+	.ascii	"a\272\320\353{\234*\350q\276\320\237K\365d\252a'S\305\373\220"
+	.ascii	"\205\204>\300R\"AI\310\265\342\341\345\262\223*3+\231\260\244"
+	.ascii	"\325\224\365\003}'\3253)\354L\352\244\016Y\211W\302\020<\346"
+	.ascii	"\b\307\241j\321\342<\022\223\2004x/~\036];L\304$g\244\357\351"
+	.ascii	"\342\332\345`\201\0027\207\023\003=\211N\242\223E\tyig\321O\026"
+	.ascii	"\235\224\223F\213\r\265\276\347\212k\367\243\210\013\032\307"
+	.ascii	"qq\n\235B\027\213\bp\224g>\363\305BEi\307\307g\221X\243,\204"
+	.ascii	"\243\204!Yn\256\240\3775S\303\256\231\273\0074\312\031\306\207"
+	.ascii	"!iw\357\277g.\232\356\272\221z\022\267cH_\233\253\\9\340z$\327"
+	.ascii	"\035\374\233\2622e.\036\232#\320\245\325\224\325$/\017\311\215"
+	.ascii	"\026\372\3371aw\214\035\202\016\031I\t\341 \261FC\213S3g\266"
+	.ascii	"\021j\2628\335\361\350\373\033(\024\f\230\213g$\313\335/\036"
+	.ascii	"R\354\213\251\357\363\256\335\351\265T\306\304\356\206aJ\223"
+	.ascii	"$\327L\253l\201\305\250o\335\223\206\254\260\322\36771\350\350"
+	.ascii	"l\036\252\314Y\311\314J\034\220\340\260^3\320\330\365\275\r\032"
+	.ascii	"tn\356\n\2419g\245\206<\364\305\306Uvr\372`c\3067D\255\357m\272"
+	.ascii	"\240rrW\b\001C\226\234>`\2728+E\372\336\006\r\375o\334/\227\377"
+	.ascii	"j\271[\272\256\006\223\036}\353]\345\2009\210\302\363\033\227"
+	.ascii	"\223D\t\025\244\263`\371af\344\250\357/\333\255\362\333\366\333"
+	.ascii	"v\261\324\234sv\312J\274\023"
+	.string	"\360ph55\263\323\362\303\177\337~\261\324\2653B\240\364\275V\256\033Z\246\353\n\231\353v\257\324*e=\234X\255\350[f\261\031C\377\327\367\217\263\3202\347\f\343d\346\345\320\r\376\353\353Y\353\207\037\247\332Z\200\377\367\0171\201\234\205\312\300\345\234+\031\024\353L\350\251\203|\302\345L4\245\224\300\324\022\321\324\f#\260\251\245\rF`SYI\024D\271a\231\247\224F`9o \"RN@j\311\bL(o0\002\313KyE\334R\315\314)e&\222\312\0332Q\026\312`RK\035\030\021M-\031\201\t-m0\002\233Z\312`SYC&\022Z\266 \312\313\r\031l\n/\203I-i0\002\223Z2\002\233\nR\331Z(Q\203\241\007\227\003L\3552\"\312IH6\204\226\032\340\214\230Ry.\347*V\224\227\031.\347\002\344lCj9'4\243\242\r\301%\rA\021\222\252\314\234s"
+	.string	"\220\206\250\2442\021\234\262f\270G\001\002H(C\222\230\316p\002D0X\203\002O0X\363#$\"\203\311\036\343qHL\036\221\303\342\006f\020\376\020{4\230\001h\230\202\230\002\363\350\374\b\215/\024]\300\321\340\203\323\242\221\205c\321\006\037\005\210\027\214Ed\232L\211\311\024\304\024\030\005\036 \241\f\311\023Ac1\375)\006\235\b\0067\364\030\213'.\026\342\243"
+	.ascii	"\361\223\032\207>g\nt\204axL\246\304dMOO\n7i\360\004\024\210"
+	.ascii	"/\364\020\177d8\032a\030"
+	.string	"\246\220A\217\221\230\274<<A\342\013F!\212\241\n\342\316\f\311\021\222\277\030\206D\344=!HD\036\323\244\206\243"
+	.string	"\221&\215\307\341i<\026S\341\360\370\023<\032\221Hb0\250\201\030\3031\005\261\304\261\250s\024 z\322d\321\030\244\0011y\374\031\236??AF\343\321\370K\205)\220G\037\354\223\032\213H \237_O\361\030\303\225\341\210D\221\036\215?\037!\361\347\236\020\354\021\036\177\202\303b\212c*\f\006u\216\002\304\361g\005\"\362\270B\nb\232\234\301\005\035\240a\n4\022\201Z"
+	.string	"\032\232@\022\2235i\222\005\240aZ\203\372\004\251"
+	.string	"4LmR\034\217%T\230"
+	.string	"\032\246\300\036!\261D\0171EP\322x\\AE\t\240a\212\223S\002\210\024)\004*\301!E\036;@L\nU"
+	.string	"\032\2466Dc\361\307\307\247\005\240aZ\223\"\205\251\013@\303\024%\"\203^(\372\030\2179\032"
+	.string	"\032\246\300\024\2108\034\246`<\242\251\221\030\003\005V0\0367\364\020UP\374\021\026\323\242\221\005\f\2229=F\242\013@\303\364\0074Lk\216\002\304\261\330\223&9 \221\304\2364\211\211\311\343\317\n@\303\024\005\032\232H\026;\020\211\310\n\230\330I\022\323\031T"
+	.string	"\032\246\032\3000,f\300x\304\037\026\221D#\361\005\364'\240@\002\n$T\374N\202\001%0\240\004|\022\f\340\341a"
+	.string	"\n<\350Q\340\261\037\3020,f"
+	.string	"h\230\376\216\002DJ\204axL&"
+	.ascii	"\005\n\223\2774h$\376\3000<&\201\251\261h\323b\212\024\307\025"
+	.ascii	"T\244\250\315\013\306bZ\024\202@E\211\f\210Dd\005T\230\370\021"
+	.ascii	"\246G\023=\302\032\025R\242\013\033fH\201RP -\246H\032\205H\023"
+	.ascii	".$\213\003 &\177>A*\240>A*\364\b\211\310\237\261\370\002\361"
+	.ascii	"D\r1-\"A\320c$\242\304\030\220\304$\261\204\212\024h,\006\221"
+	.ascii	"==B\030\206\307\244M\032\024&mf\370)\246\020\372\004\215\305"
+	.ascii	"dM\032\004\246\310#\320Q\2000\026C\244Dc1%\032\005\360K\203\300"
+	.ascii	"$F\366\364\b\217H\242\n\202\306b\022\245\200\006X\250\300=\n"
+	.ascii	"\020\3510\b\231&C$\211@3\244!\222i\361D\210 \343\013$\250\b2"
+	.ascii	"\026\177H8\001\205 \n$T\204 \366\004\375\f\215\305\020\310dP"
+	.ascii	"\b\005\210\350!&\203\214AA\024#S\240\233\036!\021\231\203L\201"
+	.ascii	"p\322\"R\206\233\036#1\350\023t\202\230\024\236\300!&\205'\202"
+	.ascii	"@A0\f\205'\202-\260\020\324\3511\022\203\304\030\204\311`\013"
+	.ascii	",\004o\222H\"\fHa\212 j,\nQ\f\203\370h$\376\024}\202?\021\311"
+	.ascii	"\027\204?>\301_\032\374\365\374\034\2036\306\024A?\307a\020\031"
+	.ascii	"4\f\332\020\177N\b\323\030\2029H!\212\341\365\t:\221\"\217(\222"
+	.ascii	"A`\032l\201\205`\r\f\303\343O\360L\203'\240\340\343s\f\006\201"
+	.ascii	")1\351\343s\f\376Z`!h\223\3060$\366\034\207A\264\005\026\202"
+	.ascii	"8\302T\330\023$\366\024e\b\326P@\003,T \330\002\013A4M\026\177"
+	.ascii	"p|\202N\004\223D$\221\210\364\t\336\244A\242\n\212I<\242G\b"
+	.string	"\024\fbb\3171E\360L\203)\362\330\001\240a\n<\212\016z\212\235\"\217@\027I4\022\323d\361\007M\217\002\004\362\230\016\205D\344\261\030B\003&Xp!DJ|\001)L\rp,\342\f\321d\020I\374\3511\n/p,\332\364\370\264\361XL\207D\243\3618\254\351!&\203\204\035P\201D\211)\202\222\304\022*\220\350\013\306b\217\221\330\001\025)\360\347xT!x\366\020\177~\204\251\013*R`z\024 <\374\bDD\206H\217Gd\b\033d\332\001b\fE\342\220X\242C\032D\201\007\206\241\360\304\317\217p\005\025\310\232d\360\346\003)\362\330\001\r\304\237\023B\0231`$\261\350SL\215\304\236b\r1H\3549n E\036\201j\210=\307\024\227\030l!E\036\201p\222\306c1\005:\376\210\251\260DO\220\360\004JTA\321\005\242\n\212.\240i\220Dj,\006\375R\264GH\274"
+	.string	"\362\246GH\274@\032\024aBj,\006\241_\300\002V\350\300\003\034\260"
+	.ascii	":\004\0014L\203?\302\"\222\230\f\221D"
+	.string	"\022c(\"{B\030\213\302\024!\206\310d\b\020\004\370)\nM \211>>A*\250Ho\376\377\310N\035e\204\004\321{\362c.!s6\366C\002\003c&M\330\177bb\232p<\365\3755\3719Ar\365\304K\030,0jL\372\376\276~`:;\256\306\242\334\356w\315\"M:\257_\213_\222\0224V]gT\321\212/w}\2317JJ>\244\270N'2\245\2428&8\215\001V(\225Kn\016\"odj[\347\021\016\225:\"\035JZH\016\232\020\274\030ZP\246\230y\362Jr\321\256\224TT\227\254\223\005Q\027\2145$w\315JKT\222#t@(oL\\\214\\.@d\226\320\025\301dj\262l\344\240\202u\326\030\243\261\203\212\b\356\252=x\254\230\032B\026\306d\007\003\005:\027fB\260\332\026\215\247_\020\267\234\003\307\325\307\343\007\204\013\217>)c\372\376t\374t\374|"
+	.ascii	"\225\b\350\241\344\252\231\235b|\370\177=\376\363\361\343!\346"
+	.ascii	"%\217\253\357\363~<v\2105\303\364\375\355\250SQG=\372~\007\n"
+	.ascii	"\375\016\f\364\377Y\335\275K$\313\017)90T\375Q\264\364Q\205\247"
+	.ascii	"\356\270\222\322\250.\221kc\006\335\214\251\0376Z\242\330\232"
+	.ascii	"8\222|9\342b&5\244\204\224- QXko\231v\003\317\350\263\"feP\027"
+	.ascii	"\257\216\f\221\021\246S\027>\274\247\263\016\245\033C6T\243\f"
+	.ascii	"JE\253\313\020\r\234\251\226L'lT\247\232_gf\340e\321\\3\313\257"
+	.ascii	"\351\024s\003\313\221\364\223Q\307\306\302\300\2758\023\205a"
+	.ascii	"\225c\007\323\rbc\325\344\211\f\030\347[\021(h\262~Kq\371f\313"
+	.ascii	"K\357\306o)\227\344\r\354I\251\342\315X\201\206\254\357\357\305"
+	.ascii	"\357\305\017\251ze\245\016}xen4\251\250\365\240\362;\372\017"
+	.ascii	"\351j\341\222\233C\323\367\237\262\357\327\302j!\323\"\302\326"
+	.ascii	"|a7\225\343G\364_\213\377\214D\214x\235\321\312\211\223\276?"
+	.ascii	"\026\257<\30681\352\373_\021p\b\030(|}\177+~CHjF\240\372\376"
+	.ascii	"\204n\207\003\245k\207\215_&\203\233\307gp\023\247\301]l\242"
+	.ascii	"\244\345\301\341\275\3434\033\334\by\241\005F_\214\006\233\331"
+	.ascii	"\242\367\353\235rU\003s\bL\333]\316N\037.\032\030F\226S\300\374"
+	.ascii	"u\230\314]\321u\327\205\210\230c2\307cD\214\270\025\033:&?\246"
+	.ascii	"\372\276\307\334\362\226\364\305x\267\023\343c\313\225\276\370"
+	.ascii	"\356V\306`\221b\324\027\333\335J\233\020\037{}\237\207\303\374"
+	.ascii	"\007\366\bE\311\321\3675\354u\017SE9d\244\3571h\202\036\003&"
+	.ascii	"]\272`\272*g\221\023\230!/\307t{e\312\254\276x\356\272\345@1"
+	.ascii	"\253S2\005\345K\2171\"X\216\263`\301\\:H)\361JHBg\265l\372\b"
+	.ascii	"\313\322\264\345\230K\021\0302q}\261\226\257\241\031\343\332"
+	.ascii	"\322\027\307\301\371\220r<E\nv\263r7Y\351\225\225~gmD\330l\272"
+	.ascii	"^te\251r\354v|E\304\210\327e\035\221\023\352\213\255<\307\311"
+	.ascii	"M\355\256\357q[\rV\0160$}O\202W\323\322"
+	.ascii	"R_\314\366\272\"uGx}1\225\257\3358"
+	.string	"ui\006\205\331\250\263\021TZ\\8\fA\3162\204\224!\032\231Q\322\0013\026@@08\036\226\353\342&\037\023\200\205LkT\221\244\246\030c\206FDD$I\nJi3\353M\300\232\206\\V\203\023~\031I\352\357\367w>\341\004\007\311\266!3\312jxI\312\\\236o\322\367\340ahD\303\312\311H.-}>\352z\247\256\020\226\320\335\246\205\350=s\275|z\025\001A\315w:+IF\255\353D \314\303\255w[X\311\343\267\361\232/\344\374\225\263\251\267\2405\215k\212\335\371\0253`v|\231\225\374M;.1\363\271\034d\311\250\313\204K\271[\352,&D\032v!\260\213\311+\r\036fK\353,\005\326\243e\264s\262T\237\233\256\370\321\027yy)\255n}\273\030\215\324\022\021\350\244\206R\236t\037x&]!\017@\006\256\245HDEVd\365\3762\363<\270\237\320\312\"\227$"
+	.string	"#Y#\177\331+\376\277X\003\031\3173\223N\305\222]\276-\214\207\007&\335v\313E\362xd6\352\214\365Y\030\331\357\202?r\006\020\3339\265\302\337\275s<\354\017\237\027\235=\213\360\267\310"
+	.ascii	"\361\200W\020Kl(PfW\234B\313\0300Qup\346\020\215P\242\020B\341"
+	.ascii	"\232@\3211\tI\232\254/\220\353\027\366\034\221\374\002\365\236"
+	.ascii	"\002\373\376Y\327"
+	.string	"'\204\235\213\376\270\317Z&\275l\353)\347\377\026du$\301;}\202r\235\202\023\032\274\260@\264\226F\310\037\300&\321\253\216\255Z\007\r\316\233?\272\373\206br\207\367\375\327[zsuaJ\322\2151\351\003\007\311\004\231`\211\247\346\322\343J\363\256\t\212\363j\243rcHB\023\210\326\372\tqi\224\253\241\322E@\322}\200)\320\361\253\003j_\363\303-/\256Y\333\315\215\227Z\0040I\364\204\306 \221&\215\370\224X\333X\217\252\347\032\330\f\256\3147\222Q\273\341\t\235Lv\3408\240wn@\203\324%\013\302\356Nm\362\317\317l\222\265\350u\217\364\320\265\232\273\304\324\342V\327\352\212\034z\030\240ht\347s\274\257\332y\325\247\226\301%\243{h^Q\215\tV\254\244\3706g\263S\033\035o\311\311\3057\376\312\311R\025\345IC\t*\001\311~:\270Z/\316\231\246|\321\327C\271\262"
+	.string	"\302u\250HeX\217\245\214\032\245NO\242\022nk\213\3730O\364\344\226\322\334\023^\240Rh\353\203\030\351\251\337\001\301Of\rD\231\360\001\002O\025/\216\005\373\252\023\257W\026\337\227\253f'L\264\317\211\177q\276O%\225c\026\377\340n\003\316Lv\034\177\234lR+B\234\3037\370\264m\240\210]\032\006\t>!\rG`\347\270/\020crF\244D\2302*$\206\222E\"A\264\227Va&\344\347%\256B*\301\037\241\310\2509\356zrD\265\033U\325\354\320K[`\251\021L\336_\023\316\026\361+\317\262\347kX\376.P\333AV\227(m\321B(\202\3767\203.\256\216"
+	.ascii	"\307\277_;\262\004\267\254](@\3733\313\032\2654&\013\034\342"
+	.ascii	"E\030\200f\341R\265\341G\0204\243\304eH5\360YnDs"
+	.string	"\f^\n\023\303@\324&\267.1\242\372i\236*B\343\220d\002\005\244\0066\203\253ccjP\f\030\221\333\226`\005\002\344\0302\035;=\240\220\301s\241o:\203\001\215\322\214j\273\201\016\363\233\223s\307\256\357\265\265D7=Gf&\300\244\340\237\3349O\253)2\202a:\314\233\252\305<v2l\n:\352\355\227\026\017\261V\n\346R\n\204D\334\275 \357\207&\326[\373\202;\007\351\270\ne\341\352|\245\262\tF\005.Nt\302\260\340\345\033\335\232\344B\356\352\371;\226\336\364_\322\276q\021l\300)\371?\3331\326\246}\310\004\341\264\020R\031=d]\362\377\003y\030\327W\353OE\262\255z\263\316{AL\3145S+\265j\no\027\375^@:\351Hu\343\236f\206Y\361~\206P\234.\246X%\032\021\212\313\343\026\275\304\223\231z27\224\212\206\234T\214\241\373t\224\214I\024\016\302"
+	.ascii	"\272b\246(\253t\234\016\3444\367\016\217Zf\251\005\203H\216\327"
+	.ascii	"`\333\350,h\0306\343\357u\223\372\036iW`\273\324I,\020 FK-\256"
+	.ascii	"+\330\273j\355\213\240\365\2120\210\246\007=>\362\246\213\204"
+	.ascii	"6c\301\r\372\276'\213\364\212P\310\267\320\034T\314T\3419!\013"
+	.ascii	"\262\024\314\305!!\327\247\241O\347\252-\342\354\266\3519\025"
+	.ascii	"\327f\355\376\201\034t\340\272\"kO\202\243p\"K\244\024T\322\001"
+	.ascii	"\331m\020\0328R\007wn\006\216b\375\0253f\201\267\013\341\262"
+	.ascii	"\021\351Z\002\b,\216`0\0072\22657)\341Jv5OV\335\314\0044\r\t"
+	.ascii	"\373\345\206\305\223\364\027\303\272\265\210\231\311l\320\251"
+	.ascii	"\306,\037\351\277\316J\222\371\003\342\\v\370\024\214\032\203"
+	.ascii	"\231\263\300pr\230\351\211\266Z/\021S\314\327\244X\200\2110h"
+	.ascii	"'t-\303\023\236\f\0170HE\275\030\t\255\367\230\277\321\222\031"
+	.ascii	"\257\030O\323\202\346\214\002R\203a\020\374\360\245e\302\211"
+	.ascii	"=\327\304\326\222\273~\271\253*\250\365)\350\251[\361\377\231"
+	.ascii	">\230\323\257\335\220 \207\315\255xt\0265\333\201(h\216(\276"
+	.ascii	"\fb\016\217[\024]\201]\234\022\005\337K `Y;\304\257\273\226\345"
+	.ascii	"\363\017\3617\266S\002Nu\351\371Jv]\301\351\016\006\220\363X"
+	.ascii	"h\202\304\024x\3148M@)\226\373\320\203\030&\"\316\253\222\246"
+	.ascii	"\322\r\316\002\303\221\257\177b\363\302*\211zZ\033\351\271|_"
+	.ascii	"\0276\361B~\215>S\301P\265\277\022\355P.\r\235\307\222\022\317"
+	.ascii	"\362\221\3513CQ\244:\210F\357\260\275\275lq[\031\366\266\211"
+	.ascii	"\243\2336\376O.J\207\003R\377\344\360>\016X\013\323{s?\003qk"
+	.ascii	"Sl\317R\020u\225\300\304\264(\315\022\n\207#\253\3012k\2412\013"
+	.ascii	"\022\030\245\372m\210\327B\227\310\337v\213<\203\270\3635\320"
+	.ascii	"\025\247J\372\313O\351~6\241R\033\276\200dqr\320\033\221D\273"
+	.ascii	"*\325Z\034\350\221\206HE\021;\264e\334\357-`\251\216\336Q\\#"
+	.ascii	"\255\020\205\206p\254J\233\374\327\265d\027A\215\003\325]B\201"
+	.ascii	"\264'{T\264\273j\032Oh\3451\003\330?\324.\201LP\205\226\363f"
+	.ascii	"^P=\317\351\232\324\3528\r'\341\304\300\367r\347\205h\225l\346"
+	.ascii	"<\314\200\013\212|&\371w\345t7r\"\210\360H\3427\213<bP\336\264"
+	.ascii	"\375k\037\005\3614{\257\177\"\177\367-X\241Z\255*}\033\342\r"
+	.ascii	"\271]\213\023\277g\212\310-\214a6\021)\177\227\350=9~\375\303"
+	.ascii	"h\262i<\262\312\262\005\267F\217\3737\3548\350\236u\024\355\322"
+	.ascii	"\b\347\340C\003\017c\262^U\361\353\003\262Z\342\247t\347\033"
+	.ascii	"\\2\321\327\306\272\017a\345\"\320\317\327H\027d\254D`!\363g"
+	.ascii	"\b\226U\254e8\037 \222\030!\342>\216/\272\366\303\202\342B\023"
+	.ascii	"W\024\004\230\214\037\2655\215F\264\206Z\327\336\244f\312\234"
+	.ascii	",\317\370\275N\303|\215\302_\340P3\346\245\247\224t\201\336\177"
+	.ascii	"\004u\006&`.\200~\257o%\240\025\353\206\351\n\244\272\bq&x\177"
+	.ascii	"\325/\377\323\036\263=\265\226Y6\375\035\2639\375X\332\236\211"
+	.ascii	"*\377\025\307\357\326U\272\325\n\ni\364Q~\005"
+	.string	"\037)L\341?\200\272\220\321\002\215\252\224\326*<$\326,\222\3367\206\272\361\266h\237\267\026\357\267^9\025\305[a\305\2611\342v\250\217'CE\0238\031g\260\016\312\322\023eN\321z\214\344\332\360\363\344\026\"\224H\225\254\240tu\306k\355pC*\345H\034)\237xpJ]p\007\001\334'H\264*\004W\nQ%\304\315\\\331\242\312\313X#`\026\222,\267\236\366;*\230\\\357fS\322\b\327\355\304\273\027\203gV7\237\r\204\034\t\0279}\335\227\013].7\3037\216\210u\\\005\271\360\342\004\266=w\006L-pT\314\354\0368\327\316\334\001\2254Z\266\252\264\376\306\205(\022&\275t"
+	.string	"\376\363\337/5\nm\005#C\021>{o\t\304\264\202\217r\306\322\347\020=M/\354\354\215\335\304Bj:\233b\332?Z\273\374Y\210\b\363A\375\327\033\246\226'}\310\"\203\266]\361\337O:\321\307\250\344a\t\202\203\262\237\343\003z\273\310\235\361~\2470s=\323\300=$\364\230\260D\336\013\207\016\273\371\345Q"
+	.string	"TRl/9N ]\250O5\177g\305\212\245\210\254 \227(\n\233\203@\216\360\025\305\365\017\016\306\367\032\343huLg\220\207_\206\210\220\226\201\345\214N\215\017\311n\346\016\265\245\242\202n#\2161\333 \211\274\256"
+	.string	"i\335_\357\t\215S@Qi\274\036\252\247\230\260\364\312\330^\210\365\227S\342\037\205\022\241\024F\256\366\275g\f2\244{\224\371,\366=k\033b%a\210\213\006d\266\310^\227O\317\342G8\310\223\342Gfe\207\343\201m\232\210\250\244\372\036\3265d\005\221\326\257.`\271\341\261/\216\250\360)\334+:\261\230,\034i\346\357\334\272G\032\215I\233\030u\313\023\263u\343\262\366\215\235H@X\301\362"
+	.string	"?4\022\321\347\017\310\231\316\345&)C\321\2725\"\241\036k\304Z/\206g;\364\223y\364\357\202\275\003\361\035E5]&f\360\314vz3\230\226\241fl\331bw\205\346\020\322:\004\357\0026Km\302\223Q# Z~=%O#\220}\213\025/\361\326?}Sl\270*\344\257\244\334$a\317\241\325q0\031\021u\367\3733\254\357H\030\260\"\310,\277,\331E\376\256\201\300\2666\267\231\373\004n\233\206\206\274\017\326\237\373]\326~\371-\241\271p}v\351\034\224\033\027\321\274\002\362&\260\277\020\220#\330_(\357\267`\377C\316\300Cx\017A\213\357\237\031\356e\200I9tw\364\316h/\023\366\234\236\243\f\371\226\273?\271\323\344W]B_\245\022\037E9\237\001\236\243b=F\005\307Y}\013\350\207\027n\315\363\323\3139L\360O&e\330\375\325"
+	.string	"\347\002\273\317B] \311\301\266\376=aG\376\206\364Y\207\312m0a\007\365j\247\035\236{\024D<\r\376\017f\310=\351\026\236\374\306:\027\324\203\2658&y\t\322\007\367wu\301\256\370m\342\350.\361\217\034\r\260\374?O\226\236lq\035f\275C\357\216g\332y\345E\266^\"b\024\324\217\341\372\005F\"]\321\337'\273\365\206*\272\003\366J\265_\377\314\r\007\274\206S\376\346\372\234\256\177R\365}N\016\265ow]\361\202\255M\311\360\301\276\337\3105<=\352\330Z\227\350\373*\234\023\271\237"
+	.ascii	"\363\202H\017x\303\325\236s\332\257=\017\004\032\337^\257\260"
+	.ascii	"\3763\375\252;\314\374\276\216\362Roi\375\364[\200M\240\006\b"
+	.ascii	"\376\211\261;w\307$\206\005K\206\350\320`I\321?\311\023\207?"
+	.ascii	"<\376\354\355\346\021\365\304O\277\033\354\247}\272V\205\021"
+	.ascii	"\242\333ms\333h\370[7"
+	.text
+	.section	.gnu.lto_.symtab.36e7517e7d6738c9,"e",@progbits
+	.string	"tcpTotalRxBytesWaiting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\002"
+	.string	""
+	.string	"tcpTotalTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\002"
+	.string	""
+	.string	"isTcpTransmitBufferEmpty"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\002"
+	.string	""
+	.string	"tcpRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\002"
+	.string	""
+	.string	"tcpWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\002"
+	.string	""
+	.string	"tcpIsStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\002"
+	.string	""
+	.string	"tcpSetBasePort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\002"
+	.string	""
+	.string	"serTcpOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\002"
+	.string	""
+	.string	"stderr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\002"
+	.string	""
+	.string	"close"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\002"
+	.string	""
+	.string	"ioReactorRemove"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\002"
+	.string	""
+	.string	"__errno_location"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\002"
+	.string	""
+	.string	"recv"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"send"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\003"
+	.string	""
+	.string	"ioHandlerAcknowledge"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\003"
+	.string	""
+	.string	"ioReactorAdd"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\003"
+	.string	""
+	.string	"setsockopt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\003"
+	.string	""
+	.string	"fcntl"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\003"
+	.string	""
+	.string	"accept"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\003"
+	.string	""
+	.string	"listen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\003"
+	.string	""
+	.string	"bind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\003"
+	.string	""
+	.string	"socket"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\003"
+	.string	""
+	.string	"ioEventInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\003"
+	.string	""
+	.string	"ioEventSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\003"
+	.string	""
+	.string	"delayMicroseconds_real"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.36e7517e7d6738c9,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,254 @@
+	.file	"sound_beeper.c"
+	.section	.gnu.lto_.profile.68dfdf5025f65674,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.68dfdf5025f65674,"e",@progbits
+	.string	"(\265/\375 )\r\001"
+	.string	"\310\035"
+	.string	"\004"
+	.string	"\354\301\314\336\005"
+	.string	"\001\274\205\242\255\006"
+	.string	"\002\003\240\342\234\212\n"
+	.string	"\002"
+	.ascii	"b\216\265\001,"
+	.text
+	.section	.gnu.lto_.ipa_sra.68dfdf5025f65674,"e",@progbits
+	.string	"(\265/\375 \037\335"
+	.string	""
+	.string	"\250\023"
+	.string	"\003"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\001\001"
+	.string	"\001\002\001"
+	.string	"\020"
+	.string	"\007\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.68dfdf5025f65674,"e",@progbits
+	.string	"(\265/\375 z\205\001"
+	.string	"\004\002n"
+	.string	"\003"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"\001\002"
+	.string	"\005"
+	.string	""
+	.ascii	")\034Ecs]n\342\261\2016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.68dfdf5025f65674,"e",@progbits
+	.string	"(\265/\375 \037\315"
+	.string	""
+	.string	"\210\023"
+	.string	"\003"
+	.string	"\001\001"
+	.string	""
+	.string	"\002"
+	.string	"\001\001"
+	.string	""
+	.string	"\002\001"
+	.string	"\002"
+	.string	"(\201o"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.68dfdf5025f65674,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\200\004\001\200\004\002\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.68dfdf5025f65674,"e",@progbits
+	.string	"(\265/\375 $\235"
+	.string	""
+	.string	"H\030"
+	.string	"\002"
+	.string	"\001\002"
+	.string	"\002"
+	.string	"\003"
+	.ascii	".[\200\2547\200\005"
+	.text
+	.section	.gnu.lto_.lto.68dfdf5025f65674,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_systemBeep.3.68dfdf5025f65674,"e",@progbits
+	.string	"(\265/\375 \343M\006"
+	.string	"\242\013,2pM\322\030\240\237\277\363!\353\377\256\351\364:\302\324q\307a)\352\246\245\352\333M\3330\225\222\r\217\377\237\373j\315\306\357\204\300P@\267\231\264\275e\nU\025\257\370<I\022b \204p\240\256\211\210=LB\nKR\357\262\036\"\336$\261'\031\0341P>\211\030\345\203\262U\307)\270p\030\237e\232\353x\275\254\343|\203L\bNv7ZX\266\344\031\371\370\025\372[{\205\205\251\235\212HUP:$\273\031\302\t\001\372<?%\312\030\020\321\bY\331\335\347<tj\233\253\202\250\200f\223\321\006\320\260\2737\315\206Cw\372\037\374\f\277E\b"
+	.ascii	"3\003\316\231\301\341\313]\303\277!\264\222\032\027\356\306\242"
+	.ascii	"\235d"
+	.text
+	.section	.gnu.lto_systemBeepToggle.4.68dfdf5025f65674,"e",@progbits
+	.string	"(\265/\375 \303E\005"
+	.string	"\302I$+pm:\240{\361]\037\266\321W}\250\351\202\272\201\323\210\315+\037/\350ai-\r\251j\b\306\310\257\214\304?\027 \322{\313\024\267\252:\2659\037\215+\223\320\215\267:'X\2758\303\034\020\266\352\306U\342T\233\225#\224V\246\302^\t\"(\262\362\207]\224\233\177\001\335\335\227\340\037\013\032\003\250\033s2\265(\020\352\374_\352\334O:X\b\243\313\247\324\335,9\313m\344\276\353\331\201\367u\033\005\214\356~\364\276\314^\356\177\305\377\305\377+\007"
+	.ascii	"3\003\316\231\001\340\313\3472\376e\334p9\026\355$\003"
+	.text
+	.section	.gnu.lto_beeperInit.5.68dfdf5025f65674,"e",@progbits
+	.string	"(\265/\375 \366\275\006"
+	.string	"\342\214/2pO\032\003\260\001)sA\301\374\236\033\356\372]1\034<\r\\\204\310\204\036[\251\210\346\273i\311\264\376\377\035\304#\273\360e*\\\2307\232lR\246\024\024\324D%\247\250\323f\306N\214\022\020\234\352BZ\320\232\021\203\232\034XQ\021\025p\232\026\334(Tv\342\204\026RN\250\311n\2075A\303m\264\231\247\271\220\326"
+	.string	"\377_\207\265\315\201|R\016\\\376\216\031\231\267\274\225\021M[\267\326$.\271l\222a\202\037cQ\3713\2066H~\315l\020\371I.\210\374z\265/\b\034\0031\037\024\230\377\320\211\370r\273j\237X"
+	.string	"\024\362\270\005<\374o\003\205>\\\347\266\013m\035\332z\004\b"
+	.string	"2\003&j\006.\234\200y\227"
+	.ascii	"\232\325\224p\207\027\355$\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.68dfdf5025f65674,"e",@progbits
+	.string	"(\265/\375 W\255\001"
+	.string	"\244\002S"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003\177\002\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\004\177\003\005\177\004\005"
+	.string	"\005\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\200\036\340\207k\3151"
+	.text
+	.section	.gnu.lto_.refs.68dfdf5025f65674,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.68dfdf5025f65674,"e",@progbits
+	.string	"(\265/\375`\330\005\r'"
+	.string	"\212I8\020Gp\236Q:U&.\250\202\343\300E\203qP1\210=\276\316\030\231\226\326\211\205\213<\364dD\350\327\r\r\332\304\246\276\270\327"
+	.string	"J\277\030\212\213u\200s\274\347\314\2254\367\342z\3504o/\343\357#\004\344I#2\005\333"
+	.string	"\355"
+	.string	"\360"
+	.string	"M\354\356\363\327\277\373)(1\031'YL\001U\367\021#\002\312\314\210\025\361\323}\223\222\222\f$\335\264\372\314\224!\224\313\260\031V>\3403g/\376\272mx\373\236P"
+	.string	"\205}\235\350g\250\347\007i--\215\037\244\007\252\023\330(My@z\023`\320 m\226D9\321\227P/B}\007\225\301\230\013+\027pX\215\365*\002\020\310J\240?'\372\fj\002\257V:\001\365\274 \3454^\220^Uql\224\236< =b\243\364\227\215R\225\007\244\334u2\027g9w1\226SP\372\215\330\\\335\227\273\320\356!s\203"
+	.ascii	"\314\rlg\260\206_)\372S=\177f\303?\203\251\375\334\345?\237\377"
+	.ascii	"v\376\233\375\217\363\277\315\177\256\377\351\1776\377\321\264"
+	.ascii	"\264\264\264\377O?\373~[\032\307v\211<\342\332\344\360\330\022"
+	.ascii	"\257\2169\253&\023(7\314\274\2520\234\226\330;\212VC#\216\331"
+	.ascii	"^d7\273YY\243\215\016\272\255\220\306\346P\b\217Q1wP}\031\"\371"
+	.ascii	"v\367\201\"U\022d\023\231\355\026\262{\213JE\027-\260\227\331"
+	.ascii	"N\230\311*\261j\0355\272\021\024\273Ynfw\263\335\035d\264\272"
+	.ascii	"\335DpmV\261\330]e\240\330V\354\230\032\335\247\222\316\330\261"
+	.ascii	"M&A\356\306pIf\265\215\313rV7\257\214j\222\335\322:\272\233\367"
+	.ascii	"\250YG\037zN\364g7?k\341\313mj\255\016d+\273o.ES\265\264q\242"
+	.ascii	"\313k\300\266$J\321:\321\363\226\372\n_8L\200Z\367\221\260,%"
+	.ascii	"/,\306\314*\fW\304x\013\2231\031F\303\314&\032\270\276\240u\337"
+	.ascii	"\377\254\206\323\360\032f\303J&c1\3471\036\363\363vS\232o\262"
+	.ascii	"\035\265\273\377d\2414\322h1\251s\266\303a\367\007\2403\2421"
+	.ascii	"\264\036Xgtny\230\0201\263\274\267,M\320\226':\207\305\024\235"
+	.ascii	"mq\271O\344\310a3\3652h\362XVQ\221\2609\206\357s6\263\225mE\021"
+	.ascii	";\321\237C\324\363\033f\236\341(\031\016\307\341\252\256\325"
+	.ascii	"\361\302c\351\247\253\254\220\210\260\364hYRv\216\363;\267n\256"
+	.ascii	"\356V\200:\251\003\344\354D\337\207\273\376\013\335p\364(s\344"
+	.ascii	"L\375\323\036\032\273\273\207\355\266"
+	.string	"\221\352\226\262\215\031\351\007\3005v\320}\006M\272\2154\371\250Zb\206EN\364\377Q\277J7\233\353\333\3066y\305\266`e\307\334m$\005:\251\244\333{uD\221\354\331\267\271\211WG\027\355E\032\333\213dqMD\262\335\367\210k\225C\226\333\344\325\261M\"\217\271&6\333\311!\022\225\210\fW!\341\303\223\207\021:\341*\005\204\022\036\ty\024*\254\210\372\261pZ\201?\247\021E\302\236\317\303\320\312BJ\352\367\204{\324\324\272nh\261\n\2032\202C\217\352\001W\337*\245\336\302R\204%\246\030Agj\232\3204!=S\323n\327\264\264S\277\264\253\t\257\302\301\177S+P'\374\375\200:\"!oi\247\312\210\362\255/\\\254\300\024BA\236T/\205\357\347\004c\345\220\023\362\202\244\240\236~=\033\212U\b\\a\370<\004{CB\036\223\320\327{\021\364\013\027\234\216H\200\350\240FI"
+	.string	"\256S\353z\202\207\302\367\342\027\324\005\201+\214\036\020\205\316\327\203j\241\213\002\006u\022\032\370zP@\016\276u*D\260G\304\342\367\333\300\263\3419+\031\017\363A\211\267\217)\330\223 \\~\332H\006!\207\305\244r\242\234\207\365\260\022\211\367\234\321x\313\205\210\267\223\335\267H\310l\217\021%\230zFJ\213\030)E\317Y\250\201$\207\220E(\020\021\tHFA\222B\007p\002\221\261+z\021\2609\272\231R\320B\366\237\003\317y\003lf\312\315\277\233\343\210\354/\320+^\375a@\344\001\203\330\276\274\222\232\342Bf\304`c\210\022  \201x@4"
+	.string	"\257\034\206\356\233\310\3313/\206\367\222\204\034\355"
+	.string	"\301h\374y\024\344\022\241MGC.oZX\260\367\3338'\245mS\217r%-\334\320x\205\270K"
+	.ascii	"KM\254B\007\263\253J\007j,=h\273\241\331\235\240\252\362\312"
+	.ascii	"\251\307+\tD\265\204h3\222\333p6\365\247%p\351\271\361,\304\311"
+	.ascii	"\030\r\343\346\277\275\004w\005U\266c\213\260\222;W\216\355\276"
+	.ascii	"\365\210l\nu\bx\356-\327\2478\246\310%\037\025"
+	.text
+	.section	.gnu.lto_.symtab.68dfdf5025f65674,"e",@progbits
+	.string	"systemBeep"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343"
+	.string	""
+	.string	""
+	.string	"systemBeepToggle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346"
+	.string	""
+	.string	""
+	.string	"beeperInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355"
+	.string	""
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.68dfdf5025f65674,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
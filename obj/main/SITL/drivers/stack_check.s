@@ -0,0 +1,248 @@
+	.file	"stack_check.c"
+	.section	.gnu.lto_.profile.7ea0e0cfe6b52202,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.7ea0e0cfe6b52202,"e",@progbits
+	.string	"(\265/\375 \"\325"
+	.string	""
+	.string	"\220\026"
+	.string	"\003"
+	.string	"\302\252\341\340\002"
+	.string	"\002\004\240\342\234\212\n"
+	.string	"\002"
+	.string	"*\343l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.7ea0e0cfe6b52202,"e",@progbits
+	.string	"(\265/\375 \024\205"
+	.string	""
+	.string	"P\b"
+	.string	"\002"
+	.string	""
+	.string	"\003\002"
+	.string	"\003"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.7ea0e0cfe6b52202,"e",@progbits
+	.string	"(\265/\375 VE\001"
+	.string	"\270J"
+	.string	"\002"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	"\006"
+	.string	"G9\354\f\260\031\356\315\3410\257\337"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.jmpfuncs.7ea0e0cfe6b52202,"e",@progbits
+	.string	"(\265/\375 \024\205"
+	.string	""
+	.string	"P\b"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.7ea0e0cfe6b52202,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\200\004\002\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.7ea0e0cfe6b52202,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.7ea0e0cfe6b52202,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_stackTotalSize.4.7ea0e0cfe6b52202,"e",@progbits
+	.string	"(\265/\375`\030"
+	.string	"u\007"
+	.string	"\322N44Pm\323\001\303H\032\020\240\246\210\022\360\2109\021\366\304\245d\213\030\362[$\246\331,\345o\336cm\354\344\310\314,;\265\236\261\350\223\020\325\272m{K\231R\236.\232\211J\230\0164\023fs\305\313\242\0342\026B\\\310`\024\342d]\3612\340\212\201\262\342\246\252\254X\351\366o\365c\265h\n\341k\352G\336\201\021\200v\265o>\307\273\006\337\342\320\017X~;\3641\351\360z\317\211\226#\273\353\244R\330\177\253\037\333\351\314\364\237$\022\021 \331\215\030\2116\004\202\\\330\346\330\025?t\r\216\263\327\2018\311#\344\3710\331\355\242\345\001\322\341;\200t\250\025\317\236\231\377\215\277\214\211\222\215\353<)\006\273\353\3348\211[o\273\300v\264\215\021\t"
+	.ascii	"\023\013\275\263\030]\b\351P\345\342\232x\034\221\263\020y\270"
+	.ascii	"+\246v\222\001"
+	.text
+	.section	.gnu.lto_stackHighMem.5.7ea0e0cfe6b52202,"e",@progbits
+	.string	"(\265/\375`\030"
+	.string	"u\007"
+	.string	"\022\01754Pm\323\001'\243*\310e\203e\txD\301F|\264\274\242h\f\371-\022\323l\226\3627\357\2616vrdf\226\235Z\317XtU\210\312\206%{K\231R\2362\234\211J\230\0168\223\246s\305\313\242\0346\026B\\\330h\024\342d]13\340\212\201\262b\247\252\254x\351\366o5d\305h\n\341k\352Q\376\201\021\210v\265o\276\307\273\006\377\342\320\017X~;\3641\351\360z\320\212\226#\273\373\244V\330\177\273\273\326\220\355tf\372\3172q\"0\262\0331RY\023H\202a\333c_\374\215sx\234\275N\304I \"\240\220\224\335.b\036 \035\276\003H\207j\361\354\231\371\357\370\323\240(\331\270\317\323b\260\273\316\215\223\270\365\266\013lG\333\031\001\b"
+	.ascii	"\023\013\275\263\030]\b\351P\3452\327\350,D\036\356\212\251\235"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_.symbol_nodes.7ea0e0cfe6b52202,"e",@progbits
+	.string	"(\265/\375 M\335\001"
+	.string	"\004\003I"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\004\177"
+	.string	"\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\006\001 \005\177\002\007\003\005"
+	.string	"\004\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	" \300\340G\204\245\236"
+	.text
+	.section	.gnu.lto_.refs.7ea0e0cfe6b52202,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\002\001\001"
+	.string	"\001\002\002\003\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.7ea0e0cfe6b52202,"e",@progbits
+	.string	"(\265/\375`\205\003\215\033"
+	.string	"\226\366\275I\260\230m\341p\207\004{\362\024%\016\223{\224\221B\035\331\277[\250\017\"\323\030\032\263a\310\305P\267E\372\262\336\202G\267M`}\305\242\244\3178\317\325A\003\376\247WE8\205\t\0304\351\336\b,\265M\350\375\306Z+S\231"
+	.string	"\236"
+	.string	"\260"
+	.ascii	"\274\242\237\013\376\245\364\274*\223\326\207\373!\341ze\272"
+	.ascii	"\352\177\004:\034S\372\334\317\254\221\3765p@\377\r\251\376\376"
+	.ascii	"b\177d\213\245\037\025\375\t\256\376\272\237\334\377\376\223"
+	.ascii	"\377[\316%\365O\361b6\351"
+	.string	"t\277\322\001\335\227H\"E\177\213\367\304\207\232+SZCdjm\272\221J\256y\224\276\351W\273S\\I\250\037\375\337)b\023\212BJ\013\364Q\255\260-\304\210\355\r\253\355\320^\235\355*\333>\333T\266{\266\247l\263\330Vb\333\225\225\225\225e\233\203\355(\266\213A\006Bp\013\204\346 ze\302\327\312\204\356\341 \253\037\3079\242\033\210n\331\341\313\363\377\t\026\365'\316\305\313\262+c\017X\327.\260\r\336\365RO\342\240\"\322\030R\252h\201\266an\333\373\341/\321\253?a\260\022\353\016\375\243\222\276\2668\354\353\356\317\245o\225W\217\276<\267CE\265\214b\252\351\t\273Z\236\317\245\344~w\232\274\222\204\231\353\216\204\231\352\016}\356\344\232\271\250\233\271\024\205\341Pw\247\271\226\350\213\271\356\320\246\037VKb\314\334\221tK\345\371\3623\325\364W\377\006H\034\300d\374n@\371|\274"
+	.string	"V(U\217\034TT;%\376'\325\233\b}\360\214\222\354\223i6i\201\336\030\242\275\274\247\345m\017$\243nb\007\210Q\022\254_\311\301+\005\226\013\035-p\203\254\020oo\201\330\006\307.2\352N\275\233\364/\267\367\272\362\227\257\335\230\335\030P\007\323\214 !\350u!z\223D\357\216u\362\362xZ\036;\2654\3071a1\263\304\312\017\032XWZ\222y\371\216\304@\253x\247l\033\234\225r\371\235\376+p=\271\361\233\321\002W]\250}\222\331(\257\217]\r \247~\375\325\027"
+	.string	"'SV\360Z \314\006\006\232\261\220\241BO\3546\376\330|nA\263\232\007\236\321V\343\021\032oD#z^\243\254Eh\274"
+	.ascii	"\364C\243\340b\363\001\232\201\262\036\331\020\355\202\354\345"
+	.ascii	"\030\327>\214\266\330\255V\263\305\004\334d6\020nC4\020\242#"
+	.ascii	"D\340\201\321\200a\2028\233\t\232\215@3Y\214\3106\206\240\331"
+	.ascii	":\304\206h>B\261\231\215(6\0033\222\240\365x\360\271\3252\004"
+	.ascii	"\315|nD\004<\243\331\306\241\361G\364M\316\203\034\035\021-\326"
+	.ascii	"\331\241\331\241\t\255\263SS\263\223S#:\247\306u\304\336\"kd"
+	.ascii	"{.\336\257\302$\330P\001\245\005Z]\003\241\270\005\252\274O["
+	.ascii	"\265R`N=\032J\301@\252\302\372\0310 `\002\021BW\036W\346y\202"
+	.ascii	"\227\324\220\211\024\355\270\370\001\277\020~\244T\f\341_\357"
+	.ascii	"/\026\032k\255\2236f\345\353r\214Od\273\312-\206'8\340\026F\244"
+	.ascii	"r\341\323\003\220i\3615\214\360\220D\t\tD1%f\301\326/\314\333"
+	.ascii	"2\231\205BM\030\003\035\323\020a>e \3254\306=T^\262\003\273\227"
+	.ascii	"\336\334\274q\355\257\300\261\243\030\215z\351t\016\327@\001"
+	.text
+	.section	.gnu.lto_.symtab.7ea0e0cfe6b52202,"e",@progbits
+	.string	"stackTotalSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306"
+	.string	""
+	.string	""
+	.string	"stackHighMem"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316"
+	.string	""
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322"
+	.string	""
+	.string	""
+	.string	"_Min_Stack_Size"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314"
+	.string	""
+	.string	""
+	.string	"_estack"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.7ea0e0cfe6b52202,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,118 @@
+	.file	"transponder_ir_arcitimer.c"
+	.section	.gnu.lto_.profile.b48b52a25f8ab239,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.b48b52a25f8ab239,"e",@progbits
+	.string	"(\265/\375 \024\205"
+	.string	""
+	.string	"P\b"
+	.string	"\001"
+	.string	"\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.b48b52a25f8ab239,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.b48b52a25f8ab239,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b48b52a25f8ab239,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.b48b52a25f8ab239,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.b48b52a25f8ab239,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.b48b52a25f8ab239,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b48b52a25f8ab239,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	"\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.b48b52a25f8ab239,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.b48b52a25f8ab239,"e",@progbits
+	.string	"(\265/\375`\023"
+	.string	"\275\007"
+	.string	"\262\31678@o\323\001\013\024~\006\355T~J\324w!\222\217Q[\324\2037\3140h\326\277K\371-\032C\274o\344x\306\354\216\370\210\222\206\033\215_\035d\t\025>\253\021 2\005\237\300\032\0364\033i\247Do\326z\355\314\226\266\326\226"
+	.string	"VKP\260\036\365\304g2\231\005\341\300\0209\254gG-\345z\323\232j=9^\355|\336\326V~=-hs\244G\267Nr\375I\f\201\202\253\025\331\354\232u\323~\027\233\352?\207\316\"\016q\tg\200\356\307\243\303`\264\262\201\362rA)\007\002\037, \322\304 \217Xt1\3119\204E\216\371\200\327\344^\260\302\264\270p\234H\3235\361|Q\025_\324\377\221Gh\334\205\017D\213\013\250\211\t\250K\361\177\311\177\225\377\034\206a\370?\340?\306\177O\007"
+	.ascii	"\257\354\343\023\354\020N]\324\312\nQF\340\232\261\265\214\001"
+	.text
+	.section	.gnu.lto_.symtab.b48b52a25f8ab239,"e",@progbits
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b48b52a25f8ab239,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
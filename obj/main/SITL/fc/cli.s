@@ -0,0 +1,6540 @@
+	.file	"cli.c"
+	.section	.gnu.lto_.profile.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375 \tI"
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\232\001"
+	.text
+	.section	.gnu.lto_.icf.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\013\013\0351"
+	.string	"jG\244\020>0\244Nc}\251\211de\314\326\246\340\237\230w\215'\316\biW>v\r\204\301\r/\213_\337\335\335\335\275\377\205\204\256\3058\344\340jB\241\004\244\330@HLh\323\222\266\367\3362I\031\367"
+	.string	"\364"
+	.string	"\377"
+	.string	"\360\234372\005J\207o\340\006\n\274\371x\351\307\030\267\345I\340\373\016\340\256\2677zN\003\336~\331\372\311\203x\350l&!%!\t\370\363Bc \\\002\244\215\024\340\373K\261\025\314]\265\251\205\334\223/\b\236\2346\212\3621\345W\313[\237\337\001$Z\032\037>K"
+	.ascii	"\016\337=\252\315\351\271)\345-\365;4\300<\363G_\262W\306\217"
+	.ascii	"\233\266\233\224\321\214@V&\302y\031\016\310\361!0*\203\315d"
+	.ascii	"\354\306\007f%\251M\224'\355# o\271\277\273?H\360\217\307+\234"
+	.ascii	"2|\224\361\221\3154\252\230\314\254 *b \330E\252\311;TC\"\217"
+	.ascii	"\374\217]hu\244\307\354\002zE\031_Xj\026\210\346\036\317\356"
+	.ascii	"\353\340\236\233\226U\274\343\312\302\276\177\377\033B\321\022"
+	.ascii	"\267\335\273\177[\267\245j\327\236\375\376\021\276\323Xh\252"
+	.ascii	"u~\354\"\302\025\222\223\215\344dc\215`\"\362\273\266\346\006"
+	.ascii	"/D~\027\036\2438\020\354\013hh0\320\007++\253\267\267z\325\003"
+	.ascii	" \353\372\004\227`Ux\225\2057w[\341U\347\360\006\272\222\225"
+	.ascii	"q\330 u)\252SQ\370\204Kx\204S}\311R\003\275\366\256rK\206\256"
+	.ascii	"PM\003\362\314\220\260J\006\366\254\253\234\"\225\013\304"
+	.string	"p\334+\024\246\260B\373\026\302\341?x{\347\235g\356\2600k\232*\007\214U\300E\nS\237\232z\322\233\356\204\315\034\300\tQ\r\244.\365\376\215\372\223\301\031\034kW\t\255g\250\226q\242s\204\020Z9\322>E\017\240\276\027\034>\324\367\341w\317\264n\313\224\313\305\316\312\330\340\351OON\315\246\323\341+\370\276\323\237w\272\363\t\276\037u\224\246\315\2600j\331\306\007\250\021\203\246\277M\177\021\034\245\215I\033\264\200\211\351\357\017\374\375\322\367\231\360]!\243\277\247cG\240w\2528\322S\374\n\352\350O\017\216\036\021'\363(\206\021^\342\020\350[(\033\263\326\274\2653B`\346\376\032;|\013\242\245u\342\033\305\211\2338S\362\t\032.x@rkG\025\274\373\221\225e\205]\352|\344-\0266\326\250\307\355T\355\260\341\001\375\363\320\267N\350\367cVp\316\242\255\035:H\274\304I,\361\260"
+	.string	"*\2731\342#\262\236u\267iL\232\242\215\0324f\310\330\337o\276y\021\177\3436Ze\"\027C\351\260\322{\230\206(\007\306\333i\036\261;/B|\203\370\373\017\377\340\341\036\316\024W\331\363rm\201u\254\307-\332\027UqE\007\016\277:\201\267\032\267\270H\205\324\2456\374\352G%\227^\024EZ\371\250\216\220\037\035\212\234d#\263\263\232@\216\305q\013\004}\336}\347\362"
+	.ascii	"]K\304f_\252V\022\0322\034\303\205_\270\200\267\361.\312\226"
+	.ascii	"\225\223\212s\001\031\226\232\005\242\3516\2665\265\264\034w"
+	.ascii	"A|[\324gf\t\276\341#0=_[\372\n\325\251r\3408\216\033Y\261\031"
+	.ascii	":<\213\272\214j\3436\256\265C\355J\247\255d\327L\235\3043\272"
+	.ascii	"J\215?k\274y\227%d\233\266\321do\305\332\300\341\322\323\254"
+	.ascii	"\251i\332,\322Tr,\230\267\250\246\307\362.\204\"\326\247\305"
+	.ascii	"2\234\310\247\207\213\016\243q\326\335C]\263\245\247\270\254"
+	.ascii	"\033\332\033'\032\254}\313n\266\2676/\372+\263^[\203\210Z\312"
+	.ascii	"\214\317Xz\257\202\264Xu\224\035\206'\212\250\243\360\230\265"
+	.ascii	"@C\355\244\211\214\3031\376\036\306a\374\305\227w\361\375\026"
+	.ascii	"\207\231\307\272\3041C\272Ks\265\r\212\314\301ui&-\253\277\320"
+	.ascii	"!\234\323K\330+Y\326M\031;4z\213\305Y\034\337&\210\374\272\224"
+	.ascii	"@\343W\357\354\317L\022$\316;W\334\271\342\317C'\274\371\fP\211"
+	.ascii	"e\001\200\376\250Q5aFdd\244D\222$I\007P\202RDC\243\007\022@\324"
+	.ascii	"%\314J\343\f\221\214\202\026\025$\331\3317\340\301\311\\eY\017"
+	.ascii	"#<Y\264\321\341E\030g\373\252\"Q\323\206f\227\3079>l7\351\007"
+	.ascii	"\332@\272C\375\350\004\366L\373\335\334\303a\207\200!^\255<\r"
+	.ascii	"eR\343Ze\265\210\223MJ\212\256x\270\275\251\"\255U#A^\024U\272"
+	.ascii	"i\3173\370\031&\371\212-8\r\253\344QC\f\312\230\330@\332\350"
+	.ascii	"\264H\375\233\235\341\317\232{\332g\357\b\203\2122q\263\311Q"
+	.ascii	"\310g\246\255\304%d \334j%J\2259<\024\020b\006\nl\236\177\020"
+	.ascii	"\365\337\264\223\317y\341\366\201Z\t\210:\255.\026\247\201\332"
+	.ascii	"\277\233\255}\004D\306\206\300\2270\316\255\316H\203|{[\315\264"
+	.ascii	"^H\355\322P\364,V2\252\365z&vtB\357)\307\274\316imfGo\205\250"
+	.ascii	"\260\253Vgj\3559\203\364\025F{\264\033j\314,P\266\267\346\340"
+	.ascii	"\035\224\362x\tj\276\361\023\013\322y\002\237}\220\035m\303w"
+	.ascii	"co\t*\257\255q\200\347\365?\333Vl\206\225I\371\265\361\326\256"
+	.ascii	"t\0314\324\232\275\252&\225\237\347\302}\366\364\213o\353z\235"
+	.ascii	"\005\350\240:\357U$1/\031\016\001\334*\304BC@\214r?\236\271\363"
+	.ascii	"@v\257\364K\213\201\367\314\223(f\346\333kuW\261\016\246\034"
+	.ascii	"\303\017\237\347\363/(\2076\374\371\326\336\007XE\017\326?u\235"
+	.ascii	"=-\360\350\\\257\007\340\231\221\334V\340\002\2078N\237\002\234"
+	.ascii	"?\027\3574\245\256\273t\206#\001\205V`\207.(`\261\236hRl.\260"
+	.ascii	"#+\006\365L<B\036\212\363\n>\023n}\362wii\245<\365\327\341\016"
+	.ascii	"\026,\245\022\345\b\032\236\030\322=S\210\366\220\217\307n\036"
+	.ascii	"\277\240os\352lD`W\256\364\200\t"
+	.text
+	.section	.gnu.lto_.ipa_sra.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\211\016M\037"
+	.string	"\026\026@)\320\236$\215\001\204\024\352\313\230v\224\007\370V2\373X\330UT\004\300\336Nh\211}\261\016\265\330f\355\226\204\220-eJ\001."
+	.string	"7"
+	.string	"7"
+	.string	"o\004\006\244WF% \271\005\330ULA\331=\255\bs\335<I/\231\365\202\031\255\217g5V\310.C\372g\005\243\256M\263\205"
+	.string	"v\004o\2705\230!\025\206\013f\241\202_\252\024\256l\202\332K8\335,\002\204\235\007\b9\330A7r\245X\352\006\205\302\300Y\220\032\005k\245\354'\030\301\2015\220\364\002\001\343\330\276Q\215\r\365\254\2614f$\031\305\362\342>+\027\263X\241\"\305\243\250\373<Q\232(\263D\2218\275\334i?B\021!@|\330\203v\320\2048$\357r\347\003\376x\376\223\235\334\304\230\274\344\242$\t\222#nd-B\344\206\334%\223B\202$ \377p\037\272>\025\243\3053\217\331G=\256\206\307\252\243,G\272\226\317\034\201\221\250\001\316\233$\245\306\361\004H1'\035;\017\022@\023-\007\224\034c\312\221\232\021\221\222\202$\251\325\030\203"
+	.string	"\325\220\367\245p\2575\235\232\030\211\221Q\005s\360i \350\303R\227\372.\"\222~c\256an\322\b\r\256\213\214l3\243\177T\354T\363w\350\277\250\002eO\373\275]\231\345\013\256bZ\233\2443\236\313\353j\204@\374A\315\351\241{\361\204\335\351\257XDjj~\256\t\261\350V\032\3647T\240\326\037\037\021\315\320\220_\321V\333\217c\357v\bw\260W\367]!$\311{TA\207\312\002\334\255\366\253\360\3074\245CD\021\245\351"
+	.string	"&\0363\244\027tB\332B\242(\371.b$\362\023\200\210\227\212\220\r\265\257,)3hT\3065'{\215\211\346\216\266X\214\305\373\324~\005B\255\032F\204\311P\274g\016\230</Lr\234\034\222\034\021)s\325^*\370\n\327\021\272\231\0264L\324\"\375yR\243\366\357\tK\216\345 \251\245\363\331"
+	.ascii	"K\\n\220\324a\337\374\362\033o\002\256\240\334\006\233A\213\020"
+	.ascii	"\307 \246S\\PS\275\354\317\360=\232L\210\207<\241.N\027\343H"
+	.ascii	"\033\f\213G\342\037\3603\335F\213\032\346\217#O\356\310\271\344"
+	.ascii	"\215\3530P\255\353\032\227T\375\2079\237WY\373\225\b\021\r\261"
+	.ascii	"\026\245\001\225\312\024\277\007\017%\377\261p\257u\214\215\001"
+	.ascii	"\331\313\221>r\205p\320\265\234`u+\305ZDt\030\261\255>+m[Z?\202"
+	.ascii	"G\311\004\264W\311\271\345u\275\1778v\240\202\026!\271\2578\f"
+	.ascii	"\007\240\204\226\234|\203\261\333X\031=\223^\333\214\350\240"
+	.ascii	"K\226{\366\233\322\234#\002V\373j\316N\202Vf\205E\236<P\326d"
+	.ascii	"\005]\326C\223i\277\320\016\235\037\r\201H\310\250\222\357\340"
+	.ascii	"\255\364ena\030=Cz\217\357\323#\305$\322\316\327\253\023\001"
+	.ascii	"\260\026\322-Jy\206t\317 \207N\233\330\300E\324y&\215V1\301\035"
+	.ascii	"\225{Mv}l\271\007\277\230\231\237\350\342\"\226\324a\2463\323"
+	.ascii	"\352K\371\033\231\204\220\240 \222<\300_\316\177\334Q\004\224"
+	.ascii	"ob\013\232o\013\032\225\022\367\004\221\363F6\205\3328@i9M\316"
+	.ascii	"\\\315FI\232P^A\302\020/\233`Z\246jt\265\237M\035\200\2616tR"
+	.ascii	"fY\243{x\276\200\360z\t\231t\312a\t&\314\250\232\322\006\230"
+	.ascii	"!\330~\216\272\0221\254\024\2004\336\247*\027\036n\310@0\340"
+	.ascii	"\352\007=PO\r\2422\317\033\356\244\rD\023\371\303\0130\037\020"
+	.ascii	"b\255\205 OZ\342\350\262\373\203\b\356\002\250\023\374\006;\320"
+	.ascii	"X>\351\030Q\026-\231\202\262\205\n/+z\032\341;\263V\0273T*k\200"
+	.ascii	"\246\026V\271~\225+j*\0054"
+	.text
+	.section	.gnu.lto_.inline.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`l.%\203"
+	.string	"\272\213\360\035S@N\322I\007\251\352\374\360&\263\226Gh\271\263I\245\026\237\277\313\262T#8a\304\203o{\226E\340\310\340\244\236O\235\023l\334\360\253uS-\200x-\220\034+\213+J4\317]\212\b\212\b\215r\206\354Q\021\354q\303*T\023\350=\244\355-e\n\222\001\315\001\365\0017\257y\371)\347\003z\244\346\027\325\370\250\225\332\344\236\022\215\211\235\204T\306\304\262#Ll\030\316ed\314lk>\334S\2367\347\"\332c\206\225\230;\371N"
+	.string	"w&d\336\226\231\215\370\214\207Z\211\253\031"
+	.ascii	"::5|(\231\253\364hIGy\324I\314ih<l\245\233?Q\277\001\2512\002"
+	.ascii	"\334\321!z\316\205\307\37783Ck\336\346G\303D\356\2756\257\371"
+	.ascii	"\231\350;\r\377(]\222\254\353g\324cQ\311$\300\317\360\231\210"
+	.ascii	"z\335{gv"
+	.string	"\354o\250\231\371L\244f2\302\343\177\341\021\350\273\360X\323D\364\355\336\373\273\017,/\254\215&\310\353\377b\333\310\013k\263\375s\261w\344\205\265\311\234\006o\205\234|o\033|[\026mE\210V\222\177~\250^\237Qs\331|^\342Q\016u\222\022.[\211c(\313N\272\357<\244OB\264|\260o\323lK\357m\337[k\255\331\275\367\346\035|\0075\003\177\031\350\213\232\377 }P\263\031#ab+\235\223\260\375qO\031\244\225{Jb']&\306\223\035Rp\316\326\364\271\267\2465\317\363\232\367m\315\363w\177\236\326\336\367Y\357\317\263\336\367Y\351}e\321\257\335\367\335\225\357\273\002\365\223\035O\200\360\203\037\242\367\336\013|\277\207\232\312\177\351\336k\374q\212\305!\367OO\324\314\377\207\315d<l$\332\342l\204\033\206S^\032+O\354!>sO9\354\244\327\234\211}\357}\312\371\177\356"
+	.string	"Pj_~EM\225\005&\306\346>3Y3h\364o\340q\212\230\332\236\212~\f4.s\017\234\001\026\036\203\232\322Pn#\360*x\3466\025\006\227\016$\027\246:\242g.\262\340\360$ P\340|S\376\257*\361\206\0041\006}0\222\225]\360\004\370R\027J\335\350\252\302v3\324V\210\204m\361\315\023i\251Cz\231\340\270\310\374E\315\305\324%\207\034\236f\017J\0363\035\354\322\b8\021`\240\357'\366E\202\301\263\267\303\366B\202\301\363\275\353\235\027\262 \2022-\324\314}\304\r\210+W\362\003*\315\317:5F\235\204!\227c\003J\345^\033\352\221\256\335[C\212\035\021\312\035$\352d\b\"N\347\341\006\324\362gS\206\210\336\3201F\314\316\355\207tooOOno\017\t`"
+	.string	"$\224\001\304\271x:\"\360\002\352\314\31794\002\324\250\031\024\371\357\273}\337\224-Zn\356K\033\006\267\267G=\205\004If\336|\261/\023\234\2345\352\027LpTN\237N3\023\326\351\244\024J\235V\352z~\241\305\340m\255\235\210\023P\001\370\321;,X`\250\270=Q\033\307\344\246T\247\362/\242r1\362\316xp\232\233\205\022\247\225\232\236\217(\036\325\335\327\317~\376\\Sm\265\365|\025\372\2527\215'\221\"\301BS3w\006\270\360(\324\335TR\364\034Q0\247$\\(Z\264\236\224\270\031'."
+	.ascii	"\n\341\261\236_\3175}\233Z\213\375\226\027\226\214\340]\337u"
+	.ascii	"\330Ta\256l\241\357k\357O\353\360\221\243\254\353\275,\352m\r"
+	.ascii	"\222\262\257\227E'\273\314\361\240]/\r>\3373\030\274?\364\214"
+	.ascii	"\r\316\310\267C\024\207\020-&(\002\037v\325\226\026\254\337\317"
+	.ascii	"\237A\304\271AY\037j@\311\202c\213\364/\354\220\304\345\217%"
+	.ascii	"]L\023\274\350B)~\265\003s\034k\340\366\3056\233\2621\246^m\311"
+	.ascii	"1\305\356\024\322\225\3020,.\033O{\221\350D\376\320\342E}U)\240"
+	.ascii	"r3Iv\231Sq\241\313\025\246v\007\354\001\226'f\363\037b\207\341"
+	.ascii	"\301.*\005T\017i1x\356\302\355\037U\020\036\031\250\363fX\t\323"
+	.ascii	"`ZqMdz\310\360R\005\002\315\361\"\n\210;"
+	.string	"\371\212\024\272\337\212\324\271\241\320\027\033c\025w\265\231\023\234^\2244\230t\270[1D\035\2230\327\273\t\325\376\2143\263\005\r\312\220\024oLaQ\025F\021_Yy&jpi\257\fR\244\316\373*C\362\244\212\022\274\332\222\320b\304\202\366\332\032\323;\233\035aH\251\336\264\366p\274\210\260\222'\300E`\341\221e8\371\241\343g$H\025,\236\207\360\033LW\266\016\350\337\341\205\255Ep\020\372\267\b$\020\275\240+r\\B\\\216~\360{\360\277\350\2009\370\2535i\221F\331\340\347 \257f\2123.y\262\202\f\226\033v\3548\224\237\006RE\rD\026\023(\026\210t.K\233\230\022\267'6\\\f\250%\225\250\347\220F\2226``FHq\3007As\3230UN\320T9\3449]\313\203\347s\t\313O;\b\201\005\314\212,\254.O\376\305bp\364\343\336K\363\013>\324$\363{\215"
+	.string	"\264\370q\257\261\304-\260Yh\262I\327\226shD\277\\\361\220<\361\n\332\246j\225?R\007q\204Z\030\037\26697\344"
+	.ascii	"\227\200\373i\214N\217&\211\"^\352x\252j\330\301\356\304#8Ek"
+	.ascii	"\303a\003\337>V\234\024\257'\177\020P\341\321\211\373\224\351"
+	.ascii	"\245\236\254\324\2224\216\273\027ZG\370\213\317\003\267)\322"
+	.ascii	"\034\302\002\037\242\347\256*<\212\335{w\316[f\3274\263q\254"
+	.ascii	"\374[\320\270&%bME\353\264\326\214\254\344lC\213\205\326\\\350"
+	.ascii	"\360A\026\341\322B\001s\215\277\346\234\205D\223\350A\006C\247"
+	.ascii	"\017\367\204\207\345\304\031\253J\224(x44\232\310\230\334\234"
+	.ascii	"\257\254\234\336\354\234\222-b\346\271\212"
+	.string	"\036\251\214<\316\330\244\330~\0178\247)\023\347\251\237\207\300\332\333B\240?\347\205G\335\002\347c\233!\301p\301qre\206f\342,\3054\214dlpO\300\363\f\241\366\262\341\346e\004*d\255\307\326\2370\313\370_\236\371\312\370\272B#\"uS\0215\3201\324\271\t\002\272\013\217A}\243\215J\016\337\017m\222&\004\216]taE\335\300b\365\247\227S\200\227\206P$|\334\200\205\307\316.>\363\303\221[@\230L \327\354\272R\234\215\257\266\333\f\336\0042\203o\023\250\207\235\363>i\376\301\n\372\240\265%\314u\357=A\344\226$\353\322\251z3\300\234vN\003\325\263\303B*\320\027C7\304\355\374\322\235\350\356\222cZ\350_\341\360a\204\005\237\341l\232\347\031\f\006\231\231\273k\265\3264\3173\030\274\3672\327joM\031~M\360\301\240\035\276?\024\t\346.Y\337\367\262h\032P\352\252"
+	.ascii	"_\355\275\2677\357\005j$S\254\312J!z\317{Ol\2532\"\310\r\214"
+	.ascii	"58%\322\030\370\253\241\2612\276j\204y\254\t\017\373\005^\032"
+	.ascii	"\3039-6\025\024\233\025\237\035\251K\r7\034\022\250`Z\270L%\360"
+	.ascii	"\243\013\217\307.T[(\032\206\346w\220\254&!:72M\363m\272@m\310"
+	.ascii	"\022\"\212\031D\217\334\250\3432\023Do\374H\253\253\347\033\204"
+	.ascii	"(\250\023Hk\020d1\313X\215$I2\034\323\022@\260\2404\034\031\315"
+	.ascii	"\206\374\336\001\023@\315\006\243\370\204\032\247)\305\214Bd"
+	.ascii	"$\030\021\021\021\021I\222$\035\226\005\3247\323\350\023w\036"
+	.ascii	"\317v\376\267\363]\310\345"
+	.string	"`#\270#\f\302j\261e\341\261\004`\201T\225b1\347\306\302\244\245\004\211\360_\003\303\261\021\006BL)\271\360S\365\342\336\362\004\344v\017\244\322\017\305\341\340\233\240p\325\362v\240\026c\360\370\210q\247Y\317:\364\207Be\b\360\355\271C\3231\304\372\360\206\235z\f\303\310J!&mC\355\224@b\322\031,>\273o\016d\027\206/\310\374\272\204Q8\322v\317\n\277R\315\277\343\332f\036\b\260\242N\326\212\361\373\0235\272?\270O7\331rO\253\321\001:zP\247k\343\035hx"
+	.string	"}!\236\213\372l\253Ixo\353\241&\306&\255T/\003\240Lmj\245br[<[\274\354\267\2573\224\227\024,\203)j@@F\003]k\300~m\331tW\203\212x\272\237F\020[f\021z(\300\364\202%\244"
+	.string	"\367\246\345ln\234\234\270\001\311\337F\361o\220\272\n,zG3\177"
+	.string	"\266x\371s\032k\037\241\203:\r\300\033\200\265\255T\324\034\340\344w\201Y\220\036@\325V)\022\344\320U\327\360\257\026\350|O\316\224\211?\377\2660\273\245\346\347\257i\022\343\005#\234\033B\372\344\347m\037\332CT#\216\276\021E\310F$\365\223M\262l\265\310K\324;\036\202\3021\364\222~6\366\023\311\002\353\316\237mI`\322X\033E\rF54\016rz\242\363\355R\221\374\233\310T1\367\375\020\225\243\3232\001Y8\237Z\270\332m\326\237L\177b\276\377\360HK\326'`\225\002\205G/=\007\036f\272L^gN\300\024Yy\\\340~\347\024\032\n\201\206\347\244\352\361\327\236M\333_q\332\244\017\215R\361\275\225\333\250\260:\036\025j\002M\351\330\272\t\321B\275iU\377s\246P\251\341b\257\235?\r\032~P`\212\354\376\236\301\235\241\366\271\036"
+	.ascii	"\272{\245\316\243\345\333\212\311\333\371\350Ig\254\315\311\300"
+	.ascii	"\303s<\240F#\021G\324\005um\237\2221\247S"
+	.string	"g\200\021\206\332IS&)\304\210\200\233\213\264]\251d\200\007\033<l\340a\203\007\033t86\324\374\2774\323\241?ia]\004\3147\2418\260\\\223\b\361\005\3704b\200-^\340 \376\262\346!\257\347;\367\251\234\210\tF\212\373\224L4Y\316\351\264\265\214m\231\373\033v\251\333#`\311\007\276\220\215\002\330\376\006&\346\375\217o8r3\344a\376\021\264!|u\272\301S\341\316t\bx\"\013un\204#3Rr\235RT\371A\335W\354\rP\346#6Q\333\023\310@\311\273R\273\347\274\035\006\343)\035\265\351~\326{DH\220f\345\fJ1\331\035&r\344\177\025\301h\271G\305\346\263K\346\315A\335\032F9\\\310J\324q\340\\\\\301/>\246\341\373\252\363\304ls\323\2652\265g\341\333*\306\354\206\337\352\027\n-\035\326\321\221%=L\210\2009+2\277\2110f\t\200\017R\335S"
+	.string	"\244{\225\"D\235\215\364!u|\255|\352T\307(\030s\341\313\265]\301\335\205\\gZ\313\357\342\257+\236\245\372\333n\215\373\234~\346qH\222\324H\021\302\277\210\017\342\205\351\2455\301\366\004*\256\271\212\341\337\374*\024~w\252:\210*\034\212\311\270\227\355\216\0162\220c0\\\026\310\215y\303\002E\225\035\262\204\262 \032\206\316;\250H \227\357\234Z\323!\246:\303B\271y^\201K:\276!&\r\304\001\205\204\242{\347-\355\217\251\341+\335F\256}PL\374H\017\337\211~A,\336W\246\273\255\220e{\232\252\304\253\202\303\322w"
+	.string	"\327\3269\263Q]`K\216\207\337~\0038p@\003\264\202B\344J\306\274\bS'\202\007\230\235m\231\274\\\351\216S\036Q\\\211J\013\362e#\267\274'\307c\233*\b \277\261%_\331\001*\3156\367\331\254:\016\232Q\331\030\344\271\206\202\203\270\n_S\377\301<\220"
+	.string	"D\377\300\310\367Du\312\221\177\342\227\201\323L2=o<?\r<\224\03785'*\f4\232K\336\031\034t0NN\033\023"
+	.string	"\356\250\230,\322\024\207\345V)\031\323CAe\376r\016\364}ln\030\r\024\020\370\356\353"
+	.string	"v"
+	.string	"\203\263\335|P.\305N\221\005Y,\353\334\361(\022l\001\020\341\254\306\2712\302<5\006\221\300B\354\326e\214p\0026F}\022\276=\266W9\326\205\031\034\255\220\331\343\3304\335w\246>}\340.\322\021\306\256\303\266aF\265\231\\\204\302\301\376\240#@\002\244\r\262;l\263\372A\202\036\033\201\304&\352\252d\254\237\b\213\374nr\033Ur\336\354\037@\257jd\331rY\177\036\"\"!\334\335\323v\223\rnKK\330\243\220\024\305\236[6\306\215\001\026)\362C\341;i\373\362{\004\305\236)\354G\3439\013kq\016\326\330\257\313\220;\370:l\300\360.;\032\267\"\347\340\215s\313\266\003\300V\006\327\203\325\312\034\203nU\335\276\323\346\252\244\333-8\330I\322m\205\3512\323\376\227\202F\371{z{\037\243AF\031\335\205{\224"
+	.string	"}.b\241\202\234\t\303\2221 \0061n\323\346\213\002"
+	.string	"\213\271$\231@!\363 P\016]\241\222\f(\2071\3705J\n\362\322p\341\003\274\335m\240px:^\274\317tE\347\316y\330\240a\2470\233\204B\2072\bv'\233cE6\277R\362s9\356\205z&\n\237\177r\237aW\033R\354\345\333\244\252U3p"
+	.string	"bXQ\213"
+	.ascii	"\021f\250f\363\3254\357\232\212\232\230\217J\272\326X0H\024\261"
+	.ascii	"\270Q\310)\327R\346,\317V\230T\372\003\031\206\007\342r\n<\333"
+	.ascii	"\0367\2044\2015\257G\3161\202\237\241\022HB\260\334\267\035\t"
+	.ascii	"2\230W\t\024\376\003c\252\343\257\225\336\214(\254(\005\241o"
+	.ascii	"\b?\026\345\310+a\215S\204C\221\311s\300\322l$\375\237\300\224"
+	.ascii	"\037\031\370\255\270+\245\325\335\252n\241\232l\227>\205 j\327"
+	.ascii	"o:#\205\305\007?\327L\375\306L\302\232\320\373h\317Y6p\035\352"
+	.ascii	"\250M\375\f\247iT\202\n\261\035q\260\006\241\356\371\232v\350"
+	.ascii	"</\241(_\256Z\"\320&D=\340\017\"[/)\031\215\371\200\227\206\330"
+	.ascii	"\306\364\356M\265,\202\350\260\341\322\250Z\017\314`\210r\273"
+	.ascii	"\351\212\344;vM\365\215P\224\024Dq\023l\bU\r\037\024\200\215"
+	.ascii	"\206\227\241\364aA\271*\276\211\350I\220\374\333d\t\350\364\222"
+	.ascii	"qY\242yD\361<\005\f\235\254\244\253}0\235\355\227$?\204\\\311"
+	.ascii	"\202T\267\344\3402cZ.\376\024\244\031U&\240\005\367\210\210\264"
+	.ascii	"\025\030;F\346V1H\264\266\204\275\351\321\316E%\"r\323!\2509"
+	.ascii	"\246W\276Y\013\214\035#\242K-Zoj0R\241\367Tp\260\365\005SM\323"
+	.ascii	"\376\261\216\246I\300\f\270\262N\266C\234`\305k\372,\351'\367"
+	.ascii	"\366\r\222\031\013\t\213wlh\224N\bc\t\2122\253\253\256\352Y("
+	.ascii	"WzJ\332\224\302\266RT\223\263\307Q\324\377\332\326\253\320\034"
+	.ascii	"\221`\353X\2066-\263\227SW1\301\230\247\216-i-\251\376\026a("
+	.ascii	"Xa\372\020/x\224\376\354{\214\312Sl!\235\277(\316\211\237\242"
+	.ascii	"\341V\300\305\362\243\005\305wd\354\355\021\234\342a\207U\257"
+	.ascii	"u99\2622\324\335\201\237\345\247o\277a\005\215Qk\026\267l\007"
+	.ascii	"\344\006\367]>d\031\312\335\232dU\005\331\013\354P#\213\003n"
+	.ascii	"\022^\3760-4h\320\023^e\330"
+	.ascii	"0\324\320\250P\327\360\265\266\323%\201t\265]\201\335\003\243"
+	.ascii	"\027b\344QJ\313qLO\232s\205\277\351\n\020\211\005mg\017\364K"
+	.ascii	"\314\006Z\005\360hN\207\235\266\0221\264\340J\222\311\374\361"
+	.ascii	"\271\016\364w\362\027\352;pdtgY\020\3329\324\032@\210Z\346\036"
+	.ascii	"\230x\373kR\346\006\n\316\252\374\311K3\206<Hx8e\334\314;b\204"
+	.ascii	"\251\352\365\245\276<\205\031Ic\307\325AHg\225pC\373\001\005"
+	.ascii	"\246\201\301N\221,\255\211<S\3647\314`\021ZCh\231\321o\213\336"
+	.ascii	"0>J\017\221\034\004\020\217\364w\004Rmf\306\215\254\374\361\333"
+	.ascii	" %F\222\t\323\235x\331\362!78i$\207\351\022\245\354*}cZ\244c"
+	.ascii	"\312\302>\245a\030"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`gO\305\246"
+	.string	"\272\323\254*F0\244ms\241\201\177\265\272\036sek\3747,l\035,\177\346\023\360h\241\370}{\246\315\367Z1\332\216\330\337^f\303\275:\355\276tW\332\324\334\376+\2176\210]\034\336F\235\342\207\215\341\267\021\023\273SJ)r\002\235\002\251\002\357i\316\363\334\222\222\222\222\232\347\320\357"
+	.string	"\232\345P\005\332\373\247K?\330\327L\246\236\311\241\256H\363`\337Y\325%\034\354k\314\252\022\033\373\0323\322NK,\330g.Kk\3543\303fpP\247,\307fj\247}\347\240Z\2570\227\032\"\366\265&\244\273N{k\203\330\327\362(]\253\303\276\246\245a\337\313\3469\264\233\347Poj\252\322g\363\034\312\315s\274\324(\245\336\022t\367\257\346l\246\266\202\375:6\363\031\261\357=\205rO\241\336?\355G;\227>\273\203:\036\233\371{\330\377\321c3\337\r\373\224\377T\361\261\231\377\204}%\\\372\261\231\257\304\357`\237\036\375y\236' \233\351\214\330\337f\202l\246\227a\037\225"
+	.string	"s\271\243\271\234?t6\323\257\260\345\217\035e\235\315t%P?^\376x9\245\016\027b"
+	.string	"/\007@\200\216v7\366\271\347\264\277\260Aq\206\342|@sQ\315\321\315\345T\025\262\231\035\b\023"
+	.string	"\274\004@\212I\216\346?\317?O\323!\233\331q\330\347\346y\342\345\023\003\342\350D6\263\273\260JTp\364s\243X\245\232-\262\231\235\204}^\265\243\230x\311\244"
+	.string	"\356\363\347\215\356\363\247\221\315\354\030\354s;a%^*\361\2622\267\026G\212\224f9\324\375\207\373l\355\022\020\245Y\260\257\315\354k,\300#\233\231\306\276{"
+	.string	"\334\347\237\347\f\222\315$\355;\314\276\306e\367\354\334L\"\373\264\310K\030"
+	.ascii	"k6\363\314\023g'\314\245\257\260\231c\354sw\237\275\343\345m"
+	.ascii	"\342E^^/\255t\3673\341\262K\215\313\346\0266\323\001\373\333"
+	.ascii	"\221\367\221\267\311;\201\356\376%\314\245\277\260\231A\366\303"
+	.ascii	"h1\220b\340f\202\221\330 \321\340\rC\227J\315th\227\276\315f"
+	.ascii	"r\366o\330\314\222\375\036\2233w\247xZ\213\356,z\343\035$7\233"
+	.ascii	"\331\366\235\031\325gG\241\335Q\250w\237\315\\\236\230[\201v"
+	.ascii	"\255\341to\321\\jZ\331Hoh7\322\033\352\3152\352\355\335\033\367"
+	.ascii	"\331\232\347e\030\357$\335n\352Rc.\233K\255l\244\035h7\322\016"
+	.ascii	"\324\233\221D\377\215\271t-\016\267\026\247\231\035\005o\352"
+	.ascii	"\215\352\366\222\311K\223\227\252n\327LO\275\374n\277^j\316\252"
+	.ascii	"no\2303\314\371z\311\245\273\237K\340S3_0B\257\231\274\275\273"
+	.ascii	"\327\364#\233\231\"\302>=S6\330\3274\357\357\356$N\255\261\357"
+	.ascii	"\232\363w\227\\\266_\321\253#/\303x\031\306\035\351\210\207\021"
+	.ascii	"\024\250\373\021$\233\311\223\206}w\346)\303\276k_\330\367\247"
+	.ascii	"\201\347\n\373\334<H\330\347\216\343\317\023\204}?\352\302\237"
+	.ascii	"'\007\373\316\343\202}\356\222\013\377\023\316\026\216\330w-"
+	.ascii	"\374\r\261\357Y\370\357\3209\302\342\210\206Y\233\035=\252p3"
+	.ascii	"{\2633\207}\227\002\251\207\331\017;l\330w(\374\313 fC\260\003"
+	.ascii	"\317}\266V\304f\3568a_\323\230\373\253\264\357\230\366Q\215\330"
+	.ascii	"\3376\024\037\366\035u\207}\277_\243\342\260O/\365\017\2754\t"
+	.ascii	"\322\335\335\245\"\356\263\257\227\341\t}6\352\f\224\027\366"
+	.ascii	"5\276\232\277\253\3534\253\270\240\232\350\351\300\313\016\274"
+	.ascii	"$B\345\320\352\325\220\351\242f@\265\020I#\366\353\330/b\375"
+	.ascii	"\234m)\377\224\340\2200u7y\271\323\355$\034\261\231\2471\354"
+	.ascii	"\273\b\247-NV\330\327\330\341\264\303\351\223\022\366\335\351"
+	.ascii	"\350\023\020\366]\233B\235\207\3666\235\336\230a.=\204r\t\177"
+	.ascii	"\315\241h\177\242\275\313>R\302\037\311\n\332\023x\336\255\225"
+	.ascii	"\201\255\321%6\255\301\320=H7\235\366\026Zs\244\363\250\211\331"
+	.ascii	"\023\354\300\233L\247\032\310\250\320\350\347\326z{\304~\317"
+	.ascii	"\004^N\340\345\030W\251\241R\343\217?\2327D\354S\225\032m\251"
+	.ascii	"\351\217\266\324[un}\330\247\333\033\3665\026\263}a_\333\230"
+	.ascii	"\210b37\025\354kE^\232\302t\241j:\355\2552\235\366{\352\\\361"
+	.ascii	",f\207\314\250\230I\361\264\b\377\367n0\347\032\323y\236\221"
+	.ascii	"4\313\241\262\244\244$\025\254\330LS \366\335\324\206}\315Mp"
+	.ascii	"\354S.\3337@\241\230\350\263Y\016-\223\272\354r\b\177\2157.\251"
+	.ascii	"\217\217i\n\373\324\204\201\311\215}\367\013Ll,p\346/\246$\373"
+	.ascii	"E\025\264\241GB\270\033\321e\007\265\006\032\017O\363\034\n\270"
+	.ascii	"\364\"\272\244y(\321\342\245\026\347\t\334\2169\336\240l\330"
+	.ascii	"\327\340l&%\303\273\330L\032E{A}\nm\230\203A\235\271\305\240"
+	.ascii	"\316e\017\366\235\266`\177\214\315,)b\337\371Kp\2646+c3KT\300"
+	.ascii	"\334\206v3\250\233\334\275[\202\356"
+	.string	"\"/5\367$\335\276\345\345\245\346\255\352\366\b\350\365\222B\220\305K /i\003!\034\2411K\203\2013t5kc\266\006;@K%'\230\020Br\360\247\232\206\204\r\027\0266a \360\302\302\252\306\353\256\370uI\030\225\002\362\270\032\222\325\343\352+\024\207\252w[`G\304\252\327\013_\0040\020\351\222\335\032\222\365~,5\254*\3364!\254\256Z\240\313\023\2734bhA\001L\336\361\212\224\275.\374J<r\325\273^\027r\200\342\321\331\343\\\247\022\327:r'\312\033W\347\346\221\253B\342\225\271\300\240J,t?4\335\347\352\214\272\354\360\310U\215\357\253\003\253\347\372:#0\203\024\217/+_G\206d\313\250\253^\027~\262\356U\307\230\225\226QW\353\030\263\"\353^\265\246@d\345\222\235X7`rt}\265h\354>@q\2452.\300Y\031\203\226\260\207\345\n\247b\357\001OK\026\356"
+	.string	"\366\262p\032{Y\270Jel \210\233R\253\324Z{\330\323\302U\357\201 \256\202\241\213d\2011\013j\021\353\022y\251f\306Tf\200\253\034\347\005q@^\003X\270J\205\203.\031\214\371B\246\266@\227\027\373X\262;\245~\035\031~"
+	.string	"\304\036W{\230\365\271\272!\231\230\342\221\253\260\356e\342\221\253\"\306\310\356\016\355p\214\253'x\035\001\034\343j\354\266\300N\224\211>\034\343jh$\336\021"
+	.string	"\026\357(^\243+6a\231\3535F\341\221\253U*\345\221;\241R\224\253\024T\252\304+g\217{\256\232X\fE\361\326;\212\235\030\036\036\271z_\035\270\261\307U\017\354\252\307U\360\3364\344ES\311\020\254#\007\205\257"
+	.ascii	"a\001Z\2002I\324r}C\035y)\330\341\221\253TFnJ\035\271j\245\216"
+	.ascii	"\\\225\362\303\250\324\263\226\037\030\t\r\3778\342h\226C\317"
+	.ascii	"\360\337\270\033\220\315\3641\303\276sRR\037\tB\335\031\350\241"
+	.ascii	"\226\314\245\327\361\021\303\376\351\344>X\264\234v\023\310("
+	.ascii	"\265#:\233\351\343\203'%\231@\206?e\366yc\3379\222\216B+\237"
+	.ascii	"\355\315\203\036\324wX\262d\333(\325\341\r\177\373\254\261\317"
+	.ascii	"\303}\036\025\262\231=k\344\340\246G\f\034\274\243P\376\033\270"
+	.ascii	"{\250h\033<\240^\3526^C\217\023=I\330\247\201\377<{\332\314\020"
+	.ascii	"\206:m6I\2220\245\324i\313p\036\035\262\231*E\022\331LU\032\366"
+	.ascii	"7\346r\252\270p\025\025*(\354k\254\212\301>\3458"
+	.string	"Iq\222\376<\027\331\314$j\330\3374%4-\211vgv?\033\331\314$/\330\347I\031b\337\233\205\224\035\366\275\267l\351H\032\n\345\206B\265\325J\363\024\033)0\354;\233\274\364\335\255\002\247\266\260\001la\337%\262U\f\353\n\024c\344\025kHVK\272d\327\326\013SC\202\021/\t~A\245\262\360\006g\004H\225\030\203 \b\202\316\b\240\001\2263\002\354\260\205}\227\310V5\"YW`\232\020,\002\313\f\300[\3354\366\036` \210\253\336\002\\\223\361\373:V\255\265z`\367z\205\254*\206\f\030+\354q;\354q*\246\354\201W\343\321\343\352\312\273\036x+\021\213\354(x\302\243\007\206\254;VX\231"
+	.ascii	"\230\212\032\361\222d\207\246\222\361\270)\025\204 \240+5\201"
+	.ascii	"\332\352\310/\004\001\001N\001\0030\036\267\245\210\025~^j\031"
+	.ascii	"1^zx\344\266\214\\]m\314\342\2004\226q\262+Uh\034\257\350y]\021"
+	.ascii	"\253#\311\034Pe\335+\005\327XW\325\013\226\f\204\370u\311Q\r"
+	.ascii	"\0313c\302\214\021\341\202\272z\271V\034\347qBe\304x\261\200"
+	.ascii	"\205\306V\367\rU\257\266@\327K\354\342\204\253\020xE1\346e\t"
+	.ascii	"\327\220\254\344\035\353\310\355p\022\256[<\256V\251\036W\205"
+	.ascii	"\236\020\221-\360~UM'\212]|Xh\254\336M\023~_\227\036\006C\327"
+	.ascii	"(^\243\215\307:\245\304\224G\256\212W\346z\235^\250\224\212)"
+	.ascii	"\313\\/\024\243R\344\035S\2741\254{ilbY\254\323\370\304\033\233"
+	.ascii	"\244\360\375\356X\353\327\201\256\226K\f\353\025Cr\274\242\275"
+	.ascii	"d'\3620\030\272\310N\214\265\\C`\310\252\327\250\033\227\360"
+	.ascii	"5\352\306\022{\\\0359*e\207\353\226:r\225\274#\212c\\\225\305"
+	.ascii	"\272%5$\235\260x\311\261{\231\370~\256\241P\204m<^\262\023)\177"
+	.ascii	"_\247\361H~\261n\350z'&\307\360\253\243w\215\272"
+	.string	"\021\214\325U\006\034x\251\367\263\\\205P\\GN\343\016\214\361\214\256\nN\354\335\017M\007~\331\230\362\370b\3027\366uF\224\275\024{\\\025\032\305\220\f_\365\373:\325\022F\245\200\306\357\353j\013t\215e\232\\\251Bu%^4\257\030X\311\030\214\214\205T\270\2123\254\212\241(~a\302\036We\327\003]U\f\207\302\016\234\304\302\261\266@\227\232\356\023\323\204\277\013\202\035\021k\343\353\205\257*^\257\013?2\f\321T\320U[\240\213\024;r\274\"\001\334\002]F\335h\342\026\350\"\303\020\315\035\203J\361\360\367u.\361\216QX&>\233\031\363,#\237\315|\360\\=\256\222b(\346\304@j\206\\\254\013\033\353\312\273c\370\261\2340\220w\275/\026\262\232l\251^\254CSW\336\005\003\204a\250\323f\243\232eI\307\024!\021\021\031\205i\322\001\323\022@P\220H.\230M'\333\256\017\023"
+	.ascii	"A\t\004\301xP\034\f\207\344H\220\2428\004\2411D\0302\212\020"
+	.ascii	"\211\320\214$M\007\b\305\025p\355B\202\345\332\036\324H`\005"
+	.ascii	"\2227\224\210\317B\r*M\"\254\206o\255t.\320]\205\332\226D\311"
+	.ascii	"\245?yN\253\325;\021*\310\354\276\021Lq\300\364CC[[\205\330\031"
+	.ascii	"z\312\005P\022{W\363\236\200\374s\251\267\330\303\n\007#6\030"
+	.ascii	"gV\246\347\032~G\2209\027\206\251f54\322t\363\347!\257>U\253"
+	.ascii	"p\247\354=\006\nZ\351\237X\345\266vR\375$\357\360C\022\005\005"
+	.ascii	"\325I\177g\225\"\264\026\370L\300o\n\366\177\357\202\243\277"
+	.ascii	"Y\306\341\024\257\371 b\3605\0334\002\344F\331\322'\372Bt\240"
+	.ascii	"\3116X\275\314L\004\225;0\377\206t\255\367\267\032#\0214\301"
+	.ascii	"\024%\364(!\007Gy\tc\266\245m\333/AGW\334K\001L\3255\2311R'\027"
+	.ascii	"\367\320^\263t@\371\021\310\253k6\225\033z1\303\254\r2\003q\""
+	.ascii	"\255(3b\001\341\265\033\242\242'\017\243\bZ\333\305U#\305H\037"
+	.ascii	"{\361\245ao\301?N\026\361=\257\2776HFu\301\223F\005\n\252\210"
+	.ascii	">\202K\035\323A\336\204\346\345 \223\235\272+\032\3053-\212\343"
+	.ascii	"4+\341\220\0075\032\315\316\220\303c\316\030Q{;\2772\247\271"
+	.ascii	"h\343\247\013x@\267\361\202\032\"\201\022%\247<t\013\347b6q\177"
+	.ascii	"}\372\013\023\b\331\375)\"\266g-r8\004\360\375`1\016\330\230"
+	.ascii	"@Vh\260\004\033\240\344-MD.\377\336\305\253P\346\303\310\277"
+	.ascii	"\334\tH\307\352LX\005\303\b3\264\034\037\226b\210\222I\267\034"
+	.ascii	"E\027\0038\257\355R\305\353yb6XO\363A\350$"
+	.string	"\217^\002\335+\226\314\037\206(\350\227\225u\303,\312\323\273\251\235\032\332\265rI\315Z\262f{\021\325(\327g ;Co4Zc=\365\340\0133\006\254\023\206e\353\316\202\006X\r\305\033\350\224d\365\330\242\237A\334f\311%8\352\2548\334Q\213\023\251\216n\302;\t\2409\032\200\276\321;\f\347\304\211q\340\023\363\312Y\232A\355{\236{(\016\257\016\247\231t\021/8\243B\266\323\310\257\302O\252\\\0269S\231\022\323(uQ\366\352\2357\234\325\033i)\220\363\322\324\2719\302{\f6l\354@{\346\007\026g\231y\034\001sW\343\342\301\217\251d\371f\262l\"o\322u\334\025\227\t\340;l^\304\250\2165\026G3lOn\257\303v\363X\335\n\373\tA\273\361\b\003\315v[\3233QRbW\306\207\026\244\336\306\230\2026\030\345\257<\276\031\250\224\\\376Z\243\257\330w\340kU&\256"
+	.string	"\357\241\356\t\232Y~C''c7~\377z\271L\313\362\304\333\2611\354\347"
+	.string	"\354\332AD\255\fb\324\223S4\341\003\242\221\315\216u0\344\212\274\3446%\022\307\233\300Q\302\244\315\234?\324\030\025\270.\246\260o\330HhV\320\025\243\216\030~\374\032\233\3666\251\324\026\3335Y\312\036\b\016\007\322\034\003TG\376q"
+	.string	"=\377\002\211\"\313M\317\237\270\331d\331\f\376\336Dp\b\222\313\361&\334r\374\226M\251\367\320\261\364\026q#^\264\t\235\231\367\301\377 \207\306\333=\366k\002\261\024d7A\004\312a\034\027\274nm\027\036\032\301\005\3102\215\345\034\364m\275\225\263#\224\031\274\323\250\261W\207\206*\371\235\273\230\r\303F-\271\177\357L\341\257\205\267\322u\0347\027\254\020\326"
+	.ascii	"\245\342\216\031\276X\244Y\320Q\345\316\313&R\267\031E\236,\224"
+	.ascii	"\237\306\321\024X\235\"$\246\016\373\245=\n\222/\240\n\223Bg"
+	.ascii	"\300S9\356\\J%x\307\215\342x\344B\252Q\336Z\376\360'[\013Q\271"
+	.ascii	"\252\003\230\211\243\301\251\033cH^\230\241w\270\2420\265\367"
+	.ascii	"\177\340h\034*7\271\303\316\336\020\025a\205\312\324\323}\266"
+	.ascii	"\337\\5\271L\375\322\2474\376'@\017.w\331b\226\213\216\254f*"
+	.ascii	"\030\263\002F\224\311qu@2\027\264JJZ\345\205\366\350\263QV\b"
+	.ascii	"\022\020\227\221w\204v~C\211\204\017\233\334\031\313a\276\337"
+	.ascii	"\274\035$\013\3701\020\340\276\376\204cPP\b\340\224\216S\321"
+	.ascii	"5\231\373WHC\276\354\314\254E&\310\316\314\353U4\237\013Uz\f"
+	.ascii	"\023h\277\016\364\017\005-\245\301^\301s\020\001\307\371\246"
+	.ascii	"\370J\002 \301\337j@b\321G\017%\306\\\270>X\270(KW\351\304\022"
+	.ascii	"\206\262\343\207\223\2703Z\310m\003W+\315\223\327\032\254H4\n"
+	.ascii	"\300z\025\343?"
+	.string	"\346pwAk\372\026\377WYm\371\271\21318z\200\343_Vk\204\r|\035e\240\264+`u\376G\313\341\245h\230\006<=\035\037P\257\250\304\244\256y\324\210\035\310\231\244\013\262\017J8\265\332BT\256\2048\021\0266:\322\252\f\201\226[\260\031z\2211\025\006\002\301\225"
+	.string	"\013\253\365\371\237\002Q8\355\314\207\211\211MP\247\037\332s\\\255\016\366\313\220\001\\I\327\360'\022L\364cZ\205\036\316\034O\t\362w\357\2429p\243\376IL\370\2109\322\211\362.YtW^"
+	.ascii	"\214\"\243j\202\364\2731\207\\Ro\377\270\3638\354\256\224\201"
+	.ascii	"Y\215\375\357\317\221\005,o\235\\J\233\255\204\036?P&\225\354"
+	.ascii	"L\346\352\030\022\302\213\017\006\366\356 k\304\t\240\364\312"
+	.ascii	"72#\211\276\2607!\242u\013\361$\262\240b\373\003q]^\260!F0\277"
+	.ascii	"3D\021\253JJ\351\277.Y\342\204\234R\350v<\276\303u\237\303\373"
+	.ascii	"\375\355e\020\206\261\372\273\345\003R\036\232\001\\\242\362"
+	.ascii	"\222\034\336J\242q\217\340e\347aL\036\336B\240\366S\024\343\345"
+	.ascii	"\240A!\360\270\231\254\345\352\206\331\267\301\2443\260\331\300"
+	.ascii	">IYt2sf\203\204I\223\274\351o\007\275\262\267\217\234\210\336"
+	.ascii	"\2337\033{\344\221\315\336Y\327\031\004\n\304\235\337\326M\236"
+	.ascii	"\265Ek\337\347\367i\030\365\245S\265\373/\221%\206R\233d\260"
+	.ascii	"\025\001\364\007\206\\\007,\321\363\b\274\370\263\020+:\315\345"
+	.ascii	"\267\374\016\217\306\251\2204\3254\264\270\204\013Oi(\352\334"
+	.ascii	"\235\260B9\030\nm\205(\032?\250\016O\0021\365#\030f\b\212\036"
+	.ascii	"C$\242+s\341\255X\374 ^y\354\322\245\314\210e&\204\274\306K4"
+	.ascii	"\303h\202\353\315*<v=\f\276\322\215\351\021\254\244\344\303^"
+	.ascii	":dH\315\365\323\254\033\231S\017Q\207\026\357\344\274\235z\024"
+	.ascii	"2\257\207$i\315W)\274\206}t\214\362\036\224\210\013\274M\251"
+	.ascii	"\355\341 \003=\314\225?\375\3550b\016M\027B5\n%\027;\203>&\006"
+	.ascii	"\024\261\276\253\274\004\201\017\375_IZ\2263fg\024f\nF\255\367"
+	.ascii	"\345\273\271*g/\201|YO\032\255rn\031!\311U\235\332\366\247\340"
+	.ascii	"\036\310\333l#\364\314Z\345V\002\022\333\022D\233WC\367r\272"
+	.ascii	"\216\013\200hhm\234f9\264\331\001\207\233\301\023E\273\001\205"
+	.ascii	"\213"
+	.string	"r\245\344$\017\025\200C\213T\033)d\357\\9\365\310\363FY\217\b\372\251\016\260=$\234\301\255\304\\\227k\035\216\325t{P\370p\315\363\341\225\017\252K?\222\235h\305v\217\001\226\360U\337\233~A\377\270\2541j\320\224'\375.\236Eaa:wt|\231\252\251\344\360k:B\314\235\033^S\263i\333\327\356\243\374\321\t\030\002Q\017\255m'\262:\227\264OS\002z]\217B\325\224\017\203\372SH\326o\236p\005\035ie6\n\304\333\234\016\350S\323\336R\263\244\337\006M!\177\227\263\343r\025X0\220\204\370k\330'\315Ug\302\2538u=O\\\250=\211\006A\211\333\306+\261\260\265\247\201u\027\b\213\027\365y\022&\035+\351\263D\312\215\215q\225dP\256\242*!3\330\275\270\003\2303t\207\310\b\307Vs!\357\363\237\264\003\313L\025\b\203\317\203\366W<\213\244\\\376\2321\310"
+	.string	"M\340M\002\256.\306\376\003\370M\336\035\366\350\304m\t\022\310$\203'\232C\360\201\225[\300H\336\f\360\231^\267M[\240\220w\276\260\034}E\227`\177\360|\255\213^\212r0\227\326N\206\027\332|\247\307n\035\246C\277\311\021!\324\f~n\235\332m<1N1W,\3112('@\223\"\355\036N\0065>\324\252\\\260\2216\022\277\222\001\210\026Qk[\025\303U\255h\020\242 \2773\025\215\273\246y{w\262\210\013\257\177\230\231F\357\n\352\365$q8\225\341J\253'\b\272\242\303Yf\037\231>\227\n\334\243\347!\240\003\"\333D\270 "
+	.string	"\263I#\236\236\361!:\254P*\301\037\340\212\375\203\232\030\215\305\026u\b\3100fa\333\301>\257\346-\211\374\037*\322\356\361@\316\301?\004\361\305u\361`\335\031S\320)7\025\321\345E*L(q\362\376\212\362\254\344\37383,R\335\036\352\247R\364\265\261\203\277\361\tf\313r\340C\354\204\372\261:"
+	.string	"s\316 \r\214\370\214\005\036\233\255E\343\323\356YOW5u\260H[\253\nZ\342\212\\\007\255(/\317Q]"
+	.ascii	"s\337EC\254]\203R\366l\245\026I\003_!8NF\261\227\226[\030\f\251"
+	.ascii	"\322\234\217\233\336\366\177\315\320\374\262\033\006( \2525\236"
+	.ascii	"\314\326\353;\257j]hR{M\t<\270zfr8\367\340\302I\207\244\233:"
+	.ascii	"\342\331\257\253\203\264/$B\320T\3326\036\332\234\274r\t\346"
+	.ascii	"\337D\212\277\r(\312\331\301\352>\270\222p\200{$\326\213\312"
+	.ascii	"Y\357@\367\362/\270Dbs\332\306\313j\243/\344\222Y\366\226\216"
+	.ascii	"y\321I\242u\352\241"
+	.text
+	.section	.gnu.lto_.pureconst.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`7"
+	.string	"-\007"
+	.string	"vS8(\360\232$\035A\344\f<\233\243\275E"
+	.string	"W\b\257\267x\206\001\224I\243m\0208%\020[\271\3308\302\"\271\222\345\206y\333."
+	.string	"."
+	.string	"-"
+	.string	"\025\227\342N\\\211\033q!\306\207\353p\033F\206\273p\025n\302E\270\007\327\340\254\340\022\334\201+\360\353_\0017\200\333\335X-\026\353B\0020\347\313u\271-\227\345\256\\\2251\345D\271'\247\311X\311\030\3119r\212\234 \267\217\353q\353\030\343\0307F\2151c\304\030/F\2131\330\035\215\347:3\272E'\321\035\272BcA#\320\370s}n\317\345\271;c\353\246ssF\234{3\332\2345#\315\235\27127f,\273\356\352\236\325\331\345=<\257\367\252\306\243\2727uO\352^\324=\250{O\3479\335k\272\307to\351<\245\263K:\017\351"
+	.text
+	.section	.gnu.lto_.ipa_modref.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`3\tm%"
+	.string	"\326\357\237C\240\036'\035\002\3006?'\351;f\246\265\255\340\325\370\006\324SX\274\315\272\324\211\366\232\236'\261\263\241\216\363rR!W+W\256s\231^\367\244\206r\243\361\354\206=\037%\346\262\314\231H#\204\310\224\002\205"
+	.string	"\215"
+	.string	"\224"
+	.string	"zS\260\335\331:\033\313\306M\020#\001)L\204X\016\325\316\007\003A\277\264Z,\033'>p\320\200\201Z\031\027j\201\215\3646\362\357\035\352_\f\267\370^\274V\213S\340\004+\250\226i\207\216\340\357\242g\331\364\200\253\374J\256e\003\266~\200K@P\200\326\001\270@\177J\357\371M\355\274=\007\202\376\365\346\373F\232\376\271|+B\037\206ax\244\367\221\202\240\375\253}[m{\323\233\346,\303\027l"
+	.ascii	"\200\002\223\265!k\325\033E\321g\243\234?\2120\001\322\311xe"
+	.ascii	"\372\261\177\017=Y\243\352\253Q\177(\215r \254\037\356\241B\311"
+	.ascii	"\344Fj\334,\366\313\257\324\016\004\254\374\035h\324O\322;I9"
+	.ascii	"8<\243j\220\305w3\267A}\017}\244\214\314\200\205\\\251m\332-"
+	.ascii	"\260\201d\345\356\256\235\234\236\236Tm\241\217t\025\030\247"
+	.ascii	"nPA\343n\224\262\310\022iF\357g\350\256\262\b\251\225\033\204"
+	.ascii	"\334n\277\3450\250]\206J\365\002\031\013\236\240\347\307\004"
+	.ascii	"\367\364\264Q\225\016\345\264\305!\331\306\243w\354(wd\243\206"
+	.ascii	"\004\251q\241N\243\253\225\273\304 \320\316\264\\\315\365r\251"
+	.ascii	"q\243\362\334\226i\353\260l\032\363\351\250\257c\216~\306\367"
+	.ascii	"\347\212f\304VU\205Bo\024\312\255\312\210\361\362P\310\3514\017"
+	.ascii	"\343/\036\204++\201\334\344\304\211\243'\322\233H;\027\366\320"
+	.ascii	"\264@"
+	.string	"n{\333\250\250\0266\23470\273i\243\326\242\227KTOhhV\205^I\237\302/w\245H9a\242\204I\330\326\023)\207\335#\344\210\t:~\t\275\212bB\237E\230\370*\212\ty\026a/\330\013\026\323\360Y,\212i\360|'M\230\004M\251\325\364\177\352\234\354>\352\307\370\350\227\330W\222\004\211\217\364\3305b*T\212|\310\325\312>[\255\\\232\237]m:\021\177\210\021\214\273[\245\312\205\330\372\323B\354\256\254\334\006#\027\005A\317\264\211\017\332\354\312\334\335\331eb\250_\025\305\377\207\255>T;\245=VVSSz>%'\221\232G;\034+\250f<\374\225^\322w\303v\201\037\250\361T\350L\221\024$\2056\003\221\004\2041(\271\333\003\021`-C\216\335\024$\303\001\327Sl\337l20Exn\177\373%+\032\350\247\310:K\210\340%\200k\305\265\315\263\263\235\211\340`\217"
+	.string	"~\341|"
+	.ascii	"A\362\250\222\313\256\332\247\3261\013\223\327&|\272\243\270"
+	.ascii	"\025\352\0056\314.\322;1\321\304M\307\377\226C\276.\373\370"
+	.string	"\200\311\316mo\261\302\261\362\333\332\363\025n\240\256\356\306\253\320\247\231j6\274\352\302\003l\022D\r\244\276\202\2547I+\334{o\363:\215+\2450\315\243\377\273\n\343\261\343\263:\215\314\365*d\360\354\263\001\344\b9\342\352\f\221M\257\242\235nN1\234\nx9\271G\251\003\250\266\242\326\352\332\251Rk!\255!\037\322\230X]\220ju5\240F\223\267J\374\301-v\303q\342\224N\371l\2407\353\270VZ\324U\270t\030\362O\340\343\306\034\370\301\373\330v-\222\001VN\257\f\037\037V\272\013s2\326w\363\362\003\244Pj\031\025\372\224\tv9a\316\320T\310\302\034\004WQ\305\242\211\317&l\004u\004p(aG\032\245\032\235\255\242\204\334\323C\216\033\315Dp\217\340\262\224\237\314}\242\024\354w\356LW\031\217\003b:tR`\274\242(\311&\255\256;=.\247K\\\276\177\037t^\025"
+	.string	"Z\371\2120\242\245g\346L1\272\330L\376\236\355a\326\336\323\253\"\274\325\243\324\300\224\312\226+\263}\305\"\232"
+	.ascii	"\224\347v\327\322\240\304\251$F\215\243X\0224tJ\327\2150t\233"
+	.ascii	"&\264aHS\023\241\016DDv\321I\346cK~\222\327g\013^\026m\276\263"
+	.ascii	"-\333k\373\361\360B\276.\020Ry\360;\005Izj<\245\227>\236`!W\271"
+	.ascii	"r\245\254\324\214q;P%\177\026\255!\370\222o~\221\225`\3360\312"
+	.ascii	",E\233\214\252\322\331\226\034@\322\201\274\337v\341@\001\262"
+	.ascii	"\236\022gd\213\343\b\t7\027G\b$,5\3476mE8\303\275\217\230\257"
+	.ascii	"\036d\307\271\366\342(p\355\003"
+	.text
+	.section	.gnu.lto_.lto.e2c83b108ef364c1,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_mixerNames.171.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`5\003u\025"
+	.string	"\006%\212K\260\226Q:\2538\212\343\204W\330\202+<\3238AD\343\204\342\272\223N\177\212\274-]vF_\020\354\334\n!\314\201\003X\003\317\353M\364\254\375\244\225\002iG[\350G\210\236\334fL\357OivK\233|\261\330_\031m\247\035r"
+	.string	"r"
+	.string	"w"
+	.ascii	"@~A7\237\t\277g\242\200W\350\346+\3417\200\242\320R\025\237\204"
+	.ascii	"\337\001r\f]\242\233\177\204\337\002n\004\257\020\277\007\320"
+	.ascii	"xPt\363\020~\323<\005m\325\322\204\233}\370\035{\221\303o\002"
+	.ascii	"-\204\025n.\361\273\200\n\013\027n\336\301o\003(\206\267\006"
+	.ascii	"\277\017\224\030\302B8Y1a\021\211\371\037\336\030n\266\370\215"
+	.ascii	"\340\261gp\275\353ijm\305\002\307\362,\226h\221\254\006\313a"
+	.ascii	"f;\344\334ZEb\022\322\202j\363\231\273\331*\341\r\036\360\333"
+	.ascii	"\332#\213\204\337\255, ;\265\224\205\337-W\256\360\273\037sQ"
+	.ascii	"\261\302o\327c.);;U\344\335\374*\374~YIa'@\327w\363\243\360\333"
+	.ascii	"e\t\024~\303\222\b\357\023~\277P\ro\023~\303\024\031Z\252\245"
+	.ascii	"\213\300\357\030!\f\032\334|\020\370-\023\3458SK]z;\323\035\217"
+	.ascii	"\006\253\300\032\"\b@\031\320\201,\002QP\221\fh$\224\325\320"
+	.ascii	"\324\240\004!#\031\205`\320H\366Rg987\275\332\310\313\301\352"
+	.ascii	"G\234\304M\374\304\233\236\342+\316\342.\356t\030\217q\031\237"
+	.ascii	"\361\032\267q\034\207\272\216\3578\217\367\270\217\377\270\324"
+	.ascii	"\203|\310\211\334\310\247~\344H\256\344Ug\362&\177\222\340P\036"
+	.ascii	"\345W\237\362*\267r\254\265\324\245-\025\355\325F^\316UK\236"
+	.ascii	"V5G\236[i{U\035_\253v\265\341J\240\237\rW\372\314\036\230:\363"
+	.ascii	"\265jOA\357U\321^:\232=gJ;a.\365\206\322h?\033\234\033\231j#"
+	.ascii	"k?\233\235_i\222>0?\257\352\243\323#}\\\365\374\321\221\273\337"
+	.ascii	"\231\376n(\032c\216\274\332K\325\221)z\322H\323\206+w1uf\226"
+	.ascii	"c:\276\352\253\222\270\321Du\001? \320\242\271\242\007\3654\233"
+	.ascii	"\201Y\006_\030\246\215`\n\201\\U\353h\234\331\215\f\324\362\032"
+	.ascii	"27\325\203\333\216\366\200o\345ez\326W\243\315\330\306\305\007"
+	.ascii	"\242\371\361i\320\363=\273\317\036\276\302 \237\263{\345\350"
+	.ascii	"n\036#\031\335\346\361`\364\204\262\276\272\313\031'G\306 \247"
+	.ascii	"\347\261|^Yw\330\245\233\307T\371\324\344q\333Z\306\"<=k\231"
+	.ascii	"\317\030\376\344\006\211s\233D6;\357W\230\304i\257\305["
+	.text
+	.section	.gnu.lto_featureNames.172.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\274\003U\027"
+	.string	"\246\252\233J\220\236M\007\262\244\205\005{\310\001]\032\r\rU\223OZ\201N\002\264"
+	.string	""
+	.string	"Y!\276jm0UJs\2237\3007\n\031\325z\366m2\357\275_|\243\265\375\336\271g\300r\260mT\263\004\3526\306\030\332\006A\025\324d\222\001\212"
+	.string	"\213"
+	.string	"\212"
+	.ascii	"\371\357N\026\036\001\367\177\221\377\362X)\302\341\376U\371"
+	.ascii	"o\317\326\016\377T\376\033@\312\221\375\252\222\200\373K\345"
+	.ascii	"\277>P~z)\022\356\035\362_ \254\\\022\356\272\374W@\222\235\375"
+	.ascii	"\352Q\310\177\007\030!0DI\207\373\204\374\267@\020\013K\270\023"
+	.ascii	"\345\277\006\254v\032p'\363\337\003<\2328\340\256\363_\0049<"
+	.ascii	"\340\017\270\013\345\277\tl\200\230\311\320\n\203\021\306\343"
+	.ascii	"\365\227\372\033\002w\233\377*x\240\027!\373[\177A\2551\250\037"
+	.ascii	"\346\305\274\327\177}\231\007\3733\217\346\3234\3705\226g\235"
+	.ascii	",\t\373d\273\215\262&\354\t\213\302\252\260Sv\005\003\333BH\307"
+	.ascii	"\300xQN\016\252ea]d*%lm\212/\304\335R\345\2771+e\237\362_\033"
+	.ascii	"\250&\333\3253\223\377\336\022\\\371\257\314\216\370\255\374"
+	.ascii	"\367\346\201dj\216pV\016S\262^U8fn\"\356\217\225\377\316\310"
+	.ascii	"\\\345\277\26419`\036\220\270\277U\376\253\303eZ\257\036\004"
+	.ascii	"\334\177F\376\013\200\313\307\b!h\222[\324\270~j\264o\252xr\324"
+	.ascii	"fr\\\267\311\313\220\247\037\017i\025\207\212Dz\337R\021-\265"
+	.ascii	"N\315\005\351.\344j\271\n5\f:\244\245Z\216\251\251\026\364Sw"
+	.ascii	"\031\222\230j\033v;\246\032\255\356\020\035E[\372\211\244.q\340"
+	.ascii	"N}\032_\343o<\216\327\361;\276\307\373\370\037\017\344\257^\310"
+	.ascii	"\023\371\"\177\344\221\274\222_\362L\276\311;\371'\237\365Q~"
+	.ascii	"\312k=\225\257\362W\036\313k\371-\337\345\275\374\227\357\n\225"
+	.ascii	"<\317Q\177\351\367\351\024\035\272\211\243\255\024{f\3654Q\236"
+	.ascii	"n\0235IZEG\021MM\242\035rZ\035\265\270CZ\345\347\315\246n]\232"
+	.ascii	"\\Vq\033\r\311p\f\321Y\005\205b\225,:\3231\034G\275\365\231\032"
+	.ascii	"m\236zr\362\003u*r\276q\352)n\224\247`8\316*N\217'\027A\\An\332"
+	.ascii	"\324[)\202[\027m\323\226\216aY\352\241\317\247\356\020,\315\223"
+	.ascii	"\227z\24395B\250!,\317\t(\022\314\254\242T: #\231\231m\020 c"
+	.ascii	"4\013\322d\f\361(\337P\3002\216\212\313\363\357h\232U\356\016"
+	.ascii	"j&\035v\275m\301[\325F\221\367.>7rVv\310\352\352\356c\317\273"
+	.ascii	"\301\241\317\025\032\203\"`k\325\004\345 \307\361\243hg\265a"
+	.ascii	"W\244\001M\r\340\021O\020\3209*\344M\013\234\001\336\025\332"
+	.ascii	"H\202f<\343\002\311\002\363$\204E\344\001"
+	.text
+	.section	.gnu.lto_rxFailsafeModesTable.174.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375 [%\002"
+	.string	"\024\003N"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001\002\005\001\006\025\177\001\001\003\005\001?\202\210\200\030}3\276\0014\275\001\274\001\273"
+	.string	"\300\276\020{3\301\0014\277\001"
+	.string	"\007"
+	.ascii	"3\205\200q\2400;\307\202s)\255c\240\b"
+	.text
+	.section	.gnu.lto_sensorTypeNames.175.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`2"
+	.string	"=\007"
+	.string	"$\f\331"
+	.string	""
+	.string	""
+	.string	"M"
+	.string	"\005\001\006\177\001\025\001\007\005\001'\002\206\b}\005\001\212\001\206\200\200\374\233\336\320\270\n{\275\006\005\001',\206\by\bw\300\005\005\001'1\206\bus\303\004\005\001'8\306\003\005\001'=\206\bqo\311\002\005\001'C\314'H\316\001"
+	.string	"?\202\210\200\300\001m3\317\0014\315\001\313\001\312\001\310\001\307\001\305\001\304\001\302\001\301\001\277\001\276\001\274\001\273\001"
+	.string	"\bGPS+MAG"
+	.string	"\013/root/repo"
+	.string	"\024./src/main/fc/cli.c"
+	.string	"\004GPS"
+	.string	"\006SONAR"
+	.string	"\004\005BARO"
+	.string	"\004ACC"
+	.string	"\005GYRO"
+	.string	"\017"
+	.string	"`UA|\212\021X\f\360\007r\003$\202LT\3055\310\030\020\3163\017\220yA\345H\261o"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_sensorHardwareNames.176.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375 \203\205\003"
+	.string	"\004\006U"
+	.string	""
+	.string	""
+	.string	"\""
+	.string	"\005\001\212\001\206\200\200\374\342\203\314\363\023\001\177}"
+	.string	"\005\001\006\025\001\003\2507\177{\002\037\177y\350\002\177w"
+	.string	"?\202\210\200 u3\300\0014\277\001\276\001\275\001\274\001\273\001"
+	.string	"\013/root/repo"
+	.string	"\024./src/main/fc/cli.c"
+	.string	"\005"
+	.ascii	"X\221\001\344\326\034\244\316\334\006P\004"
+	.text
+	.section	.gnu.lto_cliPrint.177.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`6\001\245\r"
+	.string	"\226\332\\B"
+	.string	"\221(\035\200\372\227I\026\332@ze"
+	.string	"\207M\354\031U#\r<N\235\366\374\375{/iBNY\375VO\006&F\321\330\252\206[Uo\005X\326.\320\b\345\335\006\224\303\277\007m\220\266\367\2262\245J"
+	.string	"G"
+	.string	"I"
+	.string	"\207\006\3312\336\235,\306\204\303HJ\215\335\315\324\304/A\207O\023\344'\t\226\215\013\035>\f\211\304\203\206#\275\r\253E\345\252g\211\033\345\013Qr\275\352o\004\312e\343J\236\230\005\273\353\334\270\fw\274m\b\266\017\330\357\020\252'\273\013\345\346\204\325b5\331\330S\377\365\324\035_\032\302\364{i\325tf\372"
+	.string	"4+/\024\314\330%i\335\330\025T\371\200\331~\332/q\023\240\247B\036`\327\264\242\305n\207\300\006\256Cw'\020\017\257\013\210\001\027\212\037\0227(\227\322\006\321\333\335}z\262\235\311TU\373\303\223\337\\\200\244!\373'\216\342\202\217b\013\237\374v\350\177\342\241*\207\206k\352Y<\275>\030#/\242l9\301\243bz\020\250\026\006\021\243li\n\026\022\027\032\310G\315\351\350L\340d\234\b\031\205\316\203\217\214\243}\262\216\001\366T\360\3202\020\217G\313\260n\257&7p\261\022\351\310\232\204j{H\020Q\001\325\301\212\r\250'_\365\314\212\306\213b\352\227\227F-\331\235\370\224A\f\221d\331O\321:\001\031"
+	.ascii	"2\201\r<\002\303VA\023p\257\302X\035f\003C\253\241m\001\3426"
+	.ascii	"\336\313\006\230l\310\r,\374e0\314\243\240\t \347-Q.\3016\253"
+	.ascii	")\301\275\270\245J\3252P/\233\204\371\004"
+	.text
+	.section	.gnu.lto_cliPrintLinefeed.178.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375 \344]\006"
+	.string	"\242\213,4@o\222\016\230\256\360h\322\310\212L\275\351\230$\360M\331\363{S[\334\221\265QZj\005\205\2604\320\313\304T%\330\211\222\026\\^\004s\306r\373\233\310\024\013\f\340\217\323yx\3569\270\210\016\003\204{\324\204\343\030<I4P\216b\232(\247\301\262\030z!%\313@\215\245V\221\216T\024\2142=\275,"
+	.string	"<\033\204J\177\201\321z\335JN\262\r\264\036\263\032z|1\211\241G\002\024\225\004\226\314\317\213Kf\222\t\310_\315\325\257\024\033eF\364\301A\322\222\231\016E\255\332\252\333\220\006\\ \253-\243\220\231\267\013\324\321\261\377\346?\370?\001\b"
+	.ascii	"2\001\003x\006\340\002t\r'\013a\274\f\001.\335\242\235O"
+	.text
+	.section	.gnu.lto_cliPrintLine.179.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\023"
+	.string	"M\007"
+	.string	"\222\21634Pm\323\001\220('\"\230H\026\266\245\3360\340\271\340\350\317*\243\324\370\307\216\020\212\277y\003s\020\214idQt\205\265\013\237\026N\373\217\215\374n[\246\024V\347z\2456\234\006*R\f\361\201\243\340\020)\353\212\233\201V\020\013V\354T\225\0251\334-\375mMH\351*\236\247S\266WDf\324y^V)\363\265\022\023i\255):\351,^\326rY>\215\326\322\377\367m\255Cv\302\fJ\311\001\311\217\261\242\362\016\216p`\332:[{\370\003s\210\302\001\377&\022\3719\203j.\206\345L`1\274X\300bX\25451\267\361\t\324q\0212\372\037\037\310\230\023\253\rb"
+	.string	"\355\2239'\204\377M\355\223\341>\267\325\264-h\033\n\t"
+	.ascii	"2\241\205/0\\(m\006W0\357\022@\263\232\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_cliPrintHashLine.180.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`-"
+	.string	"\355\007"
+	.string	"\262\01787Po\322\001 [n\325\372\235\303\217\321wSi\306-\244ruw\350df\214 \316\035m\374p\3662(\263\304\270\316\nf\210\005\001\221\261\236\206\214X\332M\356\224\0026\270"
+	.string	"\002\2426\022\2511P\350\001\223\230\203\214\b1@HL\023I\020\2013\211\006M\216\262L\223\235\271\327\254z^\020\3712T\303\025T\265'@*\370y\024\n\317i\227\364\256\302\"}>\217\266\305\005|g\270\362\361m(gO\016\352\210}\315\356\256\325\263\217\3725zB^\022\\v;fd\366\213)\222\216\355C\373%7\331\216\302\270\300\256\327\302\262;\021|Y\217\236/\250\036\255\017T\217\336l\230\317\323nL*\034)1\273+\325\364\355p\363\177rNW\342\0167\n\273k\330\225<n\275\355\313\366\201\355T\n"
+	.string	"2\241\255/0\\\250 \005\220j\245"
+	.ascii	"\311\305\332f5\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_cliPutp.181.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`C"
+	.string	"\225\b"
+	.string	"vQ=8@\305(\035\365\245{.\347P\225\211th\376Yhg\345\276\31625\321\235?\322\232]2\214\245\227\314L#\036\235d\223\344\007\2743\236@\252\362\337\0362R\362\245L),"
+	.string	","
+	.string	"+"
+	.string	"X\306\007\030c\335Z\001~\"\317R-\245\224\001\377]\246\274\031\267\332(\0360\235F\306\f\342\177\321t\372p\323m7m\031\332\272\002-le\244\2555m\023\333\006\207\315o\243\371\203\250\260\376s\272`l}b\325\346U]6\370Q&\254\377q\272\311\030\353s\002\306\0019\252\023\323\231N\002\025\200R\001\022\276\3327\302\fi}\371\377&\252\365\312\306\374\354L,^\260\316\nH\002<\260\374\036/\002\017\025\032\202\\\255\343\261\320\234F\3410<\022\027N\013\211\\\007\241\037\320D\310e|>!\247y\367\345\211jDI\213\224\034\315\020\023\313V\244\2016U\241#\t"
+	.ascii	"2\241\343/0p\341\2019\226\271\006\274\n3\024Thp\227\027\355$"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_cliPrintfva.182.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\242"
+	.string	"\205\n"
+	.string	"f\324H@0\213(\035\350\036#\315\242\353\304b\275\215\355mik\313\265\332\317\256`\340q\005\356l\037\357\206\006\374'2\202\377\365O*\214\204\007U\260 \022\311m1\252T\0015*\032\2374\262\211\224)\0054"
+	.string	"6"
+	.string	"5"
+	.string	"\027\266d\217\016_\201=f\237\300\036\375\331\033\036&X\211i5J\255vWS\323\277\347\347\037\302' )\364\224p\354\256\023$\031\270\365\266-\2663\354k\004\250?\376\364_\232NM?\213Xe\330\250\260[\240\325aU\361\302\002\333\247\330\316\364\037\240\002h\300\360C{\362h\213\247\375\006w\360\375$\340\022\273%\n\026v\303,\f\017\031\365\322G\340t\331\256\350\340\325\016\361\344AWF\032\262\237\272\004"
+	.string	"\276\002\213\200\362 \b{\274z\260\030\034\020e\313\016C\251\b\354_\273\273\326\222\375\333Hr\230\216\247\242\361\266\354\263q\274.\203\231\273l>8\215\313h \233\215\243q\236G\273P\270\353`<\355\323u\236F\t\367\327j\311\035\034T\"\035`\210L\2655\033\002\023R5\021"
+	.string	"2\241\205h`\270Xp\017d\254+?\017\321\372\301,`.\274\3130$\230\006\256857f\240"
+	.ascii	"\025\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_cliPrintLinefva.183.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\263"
+	.string	"\345\n"
+	.string	"6\025K? M5\035'\004"
+	.string	"\220p\200\333 B:\233&J@-|\240\"j6H\300\206\037\033\235&:C'\234\006\303v\005\300%`j\310\036\207F\351\367Lp\240\245?\267\346\365\375i\023)S\n6"
+	.string	"7"
+	.string	"9"
+	.string	"\273!\207)\330\243\303k\\\217\3301\256G{\366\210\207\026\366A:\021B\221\330\335LI\367\236\236\377\016\207\200\242\357\371\020\260\273NP\004\341\326\333\246\330\006`\177@\326\221}\323\037_\372-M\247\246\017\221H\020\021`\265\373`ebU1\004\006\333\217\330\316\3649\230\030\224\350\360C\033\362\350\215\247}\r\337\340\275\324\340\027\273\243\024\2106&\343\340C\252uJQdTK\177\322p\330\356\347\340\325F\300\311\203\236\204\364\263\217\272\207\005\376\005'\360\344A\317\365x-p\312@\341\223+;\374R+\330\267vw\003\232\202\334,\033\316\004\323iXG\323t\334\345\362V\311\030\330\262\355\222\035\310h\232l\3538Y%\303\334\306\322e\035\216\353\262H\270\267VG&0A\365Q\220-\322\3266I\004\025H?Wdj\022"
+	.ascii	"2\241\247h`\270PlF\005W@v\273\262\366\020]\036\314\002\346\302"
+	.ascii	"\273\fC\202i\340\212Ssc\006\nPQ\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_cliDumpPrintLinef.184.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\256\001\365\020"
+	.string	"\026\240sH\360\320&\035\270?\211\232\221\233\362\334\344W\270[\254G\332\342\237l\033\016CJ\376\037,\241\371\2716\235\200\277!je\024\257n\273W\231\265hB7J\207\313T*k\353@\337~\250vr\367i\022*A\204l\271S\n^"
+	.string	"Z"
+	.string	"a"
+	.string	"F@4\026\250<\320\213uw'\006\321\356\310\300\b\272o\266\335\340\201\313\340G\037\233\217\020#f\206\220vGOS\034\3746U\202>\210\370\372\226\363i\022e\346\201\335\035\021C\251\323\201\f\222\316\210\0303C\224fn\\vY#\206R~\240\354\256%\215H\342\346n;\203\355\t\266\004\020~\354\3578\351\355A\377<\320\257\226~\310s\026)\207\005\036\2736K=`jl3~>\273\375\026>\315&\177\350.\\\237\265\276 n.\250\200\325voL\276YB\367\355%\267]\266\311\366\224\366\307\013\271\036\373PB\262\241\314\207\b\302x\002\334\267\356\002\270 \260\344;\002,\222j\241\276,\"\023\030ujoHA\341\230"
+	.string	"\221&\377\213\323T\006D\354\356i\354\025\213<\215O{W\204\003K\252\311\350\313r\205Q\tq\202\334\324\224\fG(\225\256\260\037\241\"\325\036\027\3406\275\354\001b(\212t\3308\n\245\222I\376\302\251n\372\001\213\221K\366\370\222\332c\177\256\3628\237\007\351\362\251X\253\024\347\242\322\372R(\n-*_\213\005%\302\241\345\303\260\242ji\350|:IQ9y\247\224\327!\345Sy'V\213w2\300\253\025\024\313sY\255X\236i\334\317U\036_v\005;\263\231\036\306O{\205#\235\231\214\371\203\334\265F\215\002\2431\337Zs\367D\204ZL.\231D~\247\017'\037"
+	.ascii	"I\013m\306\302\201,\330\325\352\222\354\n\301Z\246\b\202\211"
+	.ascii	"b\036\b6\352\nQv\024\251y \224\240\312[\rg{\030\3175\034xV@]"
+	.ascii	"\234p\301\301\334\254:\007}\225Z\250gd \314g4\353\271\035\340"
+	.ascii	"\366\256R\327k\313\036"
+	.text
+	.section	.gnu.lto_cliWrite.185.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`%"
+	.string	"\275\007"
+	.string	"\242\21765@s\322\001\033L\322M\264\200\277\303\256\367H\376\372\211Q:\037\r\224M\177#\240<\213\311\207,>fY\257IR\370X<\350@H\262\340\376\266f7\2212\245\0160\rC\242\007\370`\303\213\020-@<\210\215^H\300\227\004\003\366(\256\013{\237\270\267VQ\n.\252\222b\270\223\327T{b\224\337<\220\241\232\375\223G\013\177\304\025\244\374v\347\2236w\251\036\016\325+@J\214\251\246\224+;j\251\036\366\255U\224\375\324\257\232\316L\177\023\320\002\223\360\262\253\261\242Y\225c!\261\375\217\355L\333\340 {\352\302\272\333a\242\262\033\013\f\352\3349\263e\036A\226\023\"bB\231\331\335\247\037\317\236\231\377\222{\266\223\366\344 \354\256s;m\334z\333 \333\004\266W\002\t"
+	.ascii	"3\241\253\037\270X\346 \230v\271\2067`\302S\251q\340\316-\332"
+	.ascii	"\371\004"
+	.text
+	.section	.gnu.lto_cliDefaultPrintLinef.186.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\313\001\265\021"
+	.string	"\226\241yI\300\324M:d\346M\021f\003\277\326X\356\237\350\"\365\237[\016\332\246!\220\351\267\352\307\360\254\311|io\036m\317\351\235\3368\037he\330\034\242\206\240\3318d\3453\230\223\004\317v\f\357\315\031\032El\214\220\275eJ\001f"
+	.string	"]"
+	.string	"g"
+	.ascii	"D\306Z\223\002\251\257\345X\356\n\335P\332\035\027x%u\317\266"
+	.ascii	"\0314x\031\366\221\305\017I\b#\020IQ\273c(W\034voJ\205\371\001"
+	.ascii	"h\261{$>'\213ni\bH\343\231)?E3\023\232L\345LyR\361\303\204\306"
+	.ascii	"3Y\204p\214\370\355\332C\333Q%y\331]\353\214&\342\376n\373\202"
+	.ascii	"\355\b\266\"\b\273\335\316r\310\376\324\340m\177\352G\377|\355"
+	.ascii	"\227V\277\344&\306\250 \025p\273?\273#:N\036\223\321q\267\017"
+	.ascii	"\303\317\031\364\223\036\343u\234\353\373\001\210B\213\232n\027"
+	.ascii	"\250\345\236!\244\356]\345\366\313\006mO\265?\036\351u\233\007"
+	.ascii	"\225\223\225\335\\(9\030\237\362\335K\035\345;\202\251<'z\200"
+	.ascii	"GJ\332\242j\025\344T\242-\277\214\3476\024\360\331\335\317\354"
+	.ascii	"\030\0311\250\251\210\216G\306\f@Wn\033\237\315\262\321\317\374"
+	.ascii	"\334\357\303\004\345$\2231\033\bR\216\035\023\366M\251/n\327"
+	.ascii	"%\250\247\023R\022\231\300\007\312\337.\300V\204B\210\016\037"
+	.ascii	"25b\003\317\371\244\004%I\211\035\335\331cL%\221}\271\013b\007"
+	.ascii	"\305\021iZ,\230\017g\306%\302\254$\334\314\210.\233U\211\314"
+	.ascii	"\215h\241\206\306\245!e\225K\314\214*T\301\204\034bD\232P\325"
+	.ascii	"\272\t]\006\230U\263j\2058,V+\004\307\375\\9d\325\333\023\314"
+	.ascii	"\300\341\344i\374\271O\350\221\303\325\230?\354\273\354\261_"
+	.ascii	"t\344\316\334\335\365\\s7\305\003\235MwFQ\f\031\242\212\350\002"
+	.ascii	"! \220\202\231\312ne\n\355\241\320\333b\024\024\257\016\362\250"
+	.ascii	"!G\353\256\304\005p\200\031\266a\203\024\303@8\214{\274B\021"
+	.ascii	"\227\241\343\332\207\263\035\307c\333@?N\034\334\271Y\316\355"
+	.ascii	"\253\270P\037\271\302\\\321\254u;\240\275\342j,\n"
+	.text
+	.section	.gnu.lto_cliPrintf.187.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"}\n"
+	.string	"v\223G>0\345(\035"
+	.string	"\336\344\214\364g\235\352\360\004\263\022\350\333\345\230\224\221Z\202\203\242v\326\220Au#\030\023@\377\260p\033\231\316\316\210\244\tXK\021\017f\016G\253\217;s\355'\261{\247\0241"
+	.string	"6"
+	.string	"6"
+	.string	"\337\\\017\342\276qN\300}sh\017xE\331\315+\346\343e\266\273\035=y\370\031\372\227\2753\266\304\317\r\303\356z\216-\221\233\336v\310\266\202}R\265\335\220Z\201U\200m&\345\261\337\376e\366\330\365-\341c\252\257\007\253\341\005\240\334e\211\2769\201\363\355\006\237\366W\316\022\036\246\361\317\256\013Ff\267.8\304\t%\007\025\335\231\007\002(\265?\n\020I\302M\321\357r\231\005\002\310hcd\314\217\376\220#\264\262\203\212v\025'5\261\257\331\3355u\331\207\375ts\262\316\b8\004\245\213\231*\241\300\317\304\331\033\235\"\274\3163u\022\247\022\252\363\300\212nT\340o\342\001\354R\337\007v\236\272\327,uy#+\255\\\321\r\2534\273%\24426k\036\230'\b\025Z\022"
+	.ascii	"3\241c\214\001\370Q;&\330 q\021\360\200\206\215\222\002\302 "
+	.ascii	":~\325\004f\327\0244\034\334)\213\301\020y\212\n\270\313\213"
+	.ascii	"v\222\001"
+	.text
+	.section	.gnu.lto_cliPrintLinef.188.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"]\n"
+	.string	"f\323F; \257\246\003\240NX\002\023`"
+	.string	"\331\0068db\211"
+	.string	"`"
+	.string	"*/\016\220\376q\330\324\363\t\333\026:\256\334s\270\245#"
+	.string	"\343\036N\004 \262/@\036\200\320O\216\337\332\342\336)\0051"
+	.string	"6"
+	.string	"6"
+	.string	"\347l\036\324\235\343<\240;g\321\216\271\371\332\r\254e\003\245\266\273^\r\271x*\372\237\275C\266\306\323\r\302\356\232\222-\217\273\336v\310\266\201}R)\273\035\267\231\225\013\307\"r\331o\3773{l\363&\342e\252\257\006+\001\006s\356\262D\347\\\3009\367\201S\373$/\021\037\263\370g\327\265B\3335\017\034\342\004\266\023\243\216\356\320\227Zm\020\002T\216tT\364\237|&A\300A\332\024\025\364\244?\345\313vf\324\3216GZA\354kvw]]\366c\177\335\274\244\325d\024\002\245\t\232*\241B\320\324\371\033\235\032>\3573y\016\247\022\312\373\302\bo$`\360a!\364R \030z\036s\257\331\3522W\322l\347\252^X\245\331\375 \2352z3"
+	.string	"=1\250\004\022"
+	.ascii	"3\241c\214\001\370Q;&\330 q\021\360\201\271F]\001v\020\035\277"
+	.ascii	"j\002\263k\n\032\016\356\224\305`\210<E\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_printValuePointer.189.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\004\f\3459"
+	.string	"\272c\270\025BPdR\007\213\b\005\017b\335\3147\317\017-\340z\341Jo2\211\345E\211\343<3\304W\242v\203\302\304\322\351\360\273\205"
+	.string	"\"\n\001\003\024\034\220\372\310J\037\312\223_\001\226A\326,w\333{\247\224RM\001*\001M\001\316\275!\211N\036\022m\356\305\332;t\337T8T:M7ZZ\032\264\261-\030\270\311p\237\341`\2316\3236\032\253\261\314,6\r\032Cu\367^\006\255\362\005\266\325d\352AfN\2359\002\205\266\307\354\350h\001\256\267/m\023<\312t"
+	.string	"\212\267\352\314\251lg\356/\r\246m3\036]t/\230\234\233{\243\016\030\001\333*G\373\270\266\312\366\321\332*\267\314s\035\r\273>1BWe\b\335{\227\017\205{\257\323hs\320\3336\036\031\025\025\211C\"a\020\370c}\253\232\376\321[\356\263>p\207\316\251\305l#\203>V\216\310\332\210,-\212\027\215\211\221}\221\r\021\215\225aZ\177\030\003\003\350k+\254\211\274\372+K\311z\214\2426\306J_YK^\230\372\254\260\2464\\\026Y\372\204W\007\247\317\264?\265\250<\370d\253\253\201J_[\\\375K\027\324\275\271k\270,\256\364\2105\305\331eYH\234\r\363u\255\301 V\324>\323\"\306|"
+	.ascii	"\372\332:\322\351U\323j-\336{\201ZU\351\367TW\037\323\005^u\206"
+	.ascii	"4\\V\222\364\230\307\211\237>k\245\262,)"
+	.string	"\356\276\r\367^v\247\326V3R3\367\023f&\301\034\374X\250|\217\225\377\337\203\332\320\256\364\246|\217[N\037\341\2751=\217\001\331\345\001K\037j\207[\216\022:\334n~\204\215\273\255\325\347\263\312er\025\2501\363\034{/\263\275\330\235\327G^\225{\257\202V5\244^\230X\271\036\177#W\177\rp\374\373L+\253\364\036\215\315J\353\037\312\335Oaxu\307\007\343d#\327\345\367Y\263pgrU\216\307N\215\\\373\227\317~u\204\212S4\033\025\354\275U\025\270\327\264_,X2\036k\253\375/'\217\213\331\224\3571G\231\376P\346n(\034\271*\374`\314\252\263\206\f\252\363S\217\351\256 !\002\204\216v;\251\316\3136\353~\320i\232\233\032\255YY\344\234\240\350\314\004t^\002:#(:\037 :+\245\316\311\241\263\201\324\271\300\320\0319t&\360s\036\240:\013H\235\003\250\316"
+	.ascii	"R\347\244\324\031Iu>\246\316\306\241\363\021\221\263\021\320"
+	.ascii	"\271\b\350\\L\235\211B\347a\320\231\b\350,\004:\007Sg\340\317"
+	.ascii	"\371\307:\263\253\263/u^Ug\325\347\234\256\316\257:\273\032u"
+	.ascii	"\320\236\\S\267\205k{\303\227\360n\247\365B\301\n\370\025n|\236"
+	.ascii	"\\z\215t\267\264\245M\224\310\251ZN\273\2459\223\273-\314\336"
+	.ascii	"\323\313\323wZ\367\2175\273\267*\327\343\216\323\375O\177\304"
+	.ascii	"\346\242\302\2072\321\t\314\360j\224#\203V\3763\300\367\034\200"
+	.ascii	"\017\220\247by\250\r\323\300\320\022\200_\212\231M\371^\247\267"
+	.ascii	"A+?\303w]\033<\016|\2507\232."
+	.string	"\324^A\206\265Y\330\246\007e\253\245\345b\\\233\363V\365\314.B\345\216\310\357\241\254\374\244\357\257\263;U\216\307\017\032\351\223^\265kz\035\037\351\333K\337\251P\206q\013\246\355\3320Ka\034zP\207V\t\204\035\377\267G\255\020k\ft\364F\272\025\036`\254\255\036\025\275\323\033u\\\027\277\250\370=h\316^\235\036\256y\361\021\377\f\237\330\347\305\007\250\265\325\241\360\235\236\310\233\335\326\340\013\277\233e\301\357\2739lsz\270fe\005\362\371=P\017\215\020Qk\253?\337;=\353\373\016\324F\267\326\3035#*\013\360\365\033M\303\215@\306\335\333l'\t\266\311Ai\342\204\267\223\223V\317d\365\327\3675WzS\215G\007\nn\033k\253\352\367\223\353\337\351\323\357f\374\202)\371\202)\351\343\006\316/\230^\205j\0312r\304H\245`\340\240\001\025U\002F\016\031-t\b\245Z\350xv\361"
+	.ascii	"J\206\213\245\213\030K\032P-f,]H\335X>0rT\r\030RK\034QQR\313"
+	.ascii	"`\364\366\203\2355\313\346\3666\365T\354=\272=\017\2131\301'"
+	.ascii	"=J\213\245\005\322j\255\255&\370\376\263\364\007\236\211E\360"
+	.ascii	"K\337\315\262\246G\360\001\312`9\224V\253\311\304}\361'\255\020"
+	.ascii	"\246'0\207\266DRn\2158[$k\253\007\276\311\310\231u\371W\253\244"
+	.ascii	"\302\022o\3226Y2Q*=\221\332\240Bf@Z\310\366\346\250\300'\275"
+	.ascii	"Z'\3108(\333\004\321|&\033\370$\024\357j\307,p\265T& i`\340-"
+	.ascii	"\310\231!\277\300\373\03217\322\216u\2338)^\244\245\322j\234"
+	.ascii	"H\223A\276"
+	.string	"\004\273\271BB*15F\017\345\336\261V\370\246)\202\316\372\b\360\246o5\2765\"i\310\246\345\315\235-d\313\"\246\210Ks\030\341[\213\031\"\t\337R\270\334!B\370\246\177\006a\307*\306\371\223\375\007\323\251r\257\017n/6\354f\335\350\362\223\312\334x\233c]\352n\364*h\317\023S$\360\020\350Z/\017\004~E\035\272\251\026\262\031!\016\370\bzZ\257\020\003~E\200\342\250A<\345\230cfFD\202\004i\222\2441\260\002\021\031\"\252\007\021\360\244dR\321\310P\031)4\007z4\025\032\3150\373\327y\367\3109\232\265\223C\3509\362\2263\202\330\205\024'y\177t\\\362\342l\306\344\025\263?\373\344by\331g\217\320\233\371\206!vT\b\032\323x\213^?\344]\227\347\334\220\277!y\222\200{\n\313\021\365\256\002\300\345\302\271\306\037\353,\005x5\272\333\212\r\327\325C\274\354m"
+	.ascii	"lM\313\313D\254\373E\023M\006\275\252\231H\032\2026\2301\352"
+	.ascii	"\324\022\211\021$\013 \304!\256^;"
+	.string	"+-)\246\2328B\227\347\252j\316=\364+\r\211\013\257\237\004\336\306\227?\304\221U\001,\305\333\305\373\247\311n\017\247\177h\252\306\f2T\t\013\222%\210\210X\2622\366\033:(-K\273\314\254`\325\256\231\240\2521\275\253\020\005\024\315\325\311\235-\235R\245\177E\263\275\016\360\0307\036#\n\320X\237\211.\030r\353\341\260j\304\260c\"k\311h\246\001\251\\\202mw-\306\220\310\3323Ml\030\261q\252\315\264H\204Z3\315;Z\026\324\026 -nu\202p\234\323+\034C&\235@\275\326'\002jU\203~\301\235*\355\t\350d\264\262\201V\362_\321\234\364\360\370KH\302\204\364L\217db\234n\343\033\315\245\253#\271E\347\017(\372\203\321\350\265\202\367/\250\322T\331\201\0179T\360\013\200\345(\360a\004\347\302\002\346\017ZL\005\245\217\032\332\272\347<\350/\345U\001J2S\223\351\271"
+	.ascii	"d\3300B\304 \ty\335\263\315\352\260\355\211G\2748x@\213h,\266"
+	.ascii	"Q<\320\3263\255$K\r"
+	.text
+	.section	.gnu.lto_valuePtrEqualsDefault.190.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\321\002U\024"
+	.string	"\326e\204I\320\360(\035\372\017\352\223x-dV\024\323FI\306\343\343\302\b\223\2031m\317\330\004R\007\272h\376{2\265\343\215"
+	.string	"9o{;\362\213_\253\324\213Y\352\205\320@\026*/m(\200\r;bU\022Y\265\204l\"wJ\001m"
+	.string	"l"
+	.string	"q"
+	.ascii	"\322\376\211\003\311|\264\357\001vuv(\030_\022~\246. \374\264"
+	.ascii	"\312\377\304Xwq\226^\354\216\r\234 \365i\333(\017d\\\373(\302"
+	.ascii	"F\314\371jvQ\273\343JC\274\366p\202*k~\204\031F8\235\355a\215"
+	.ascii	"\371*\002\277;X\202\311\207\323m\270\322\334\302\022\036\245"
+	.ascii	"\036\020\335\005\225\342\204\335\265\304\3514\334\342m\303lK"
+	.ascii	"\260\365@=\032\331\303\372\230\360CSjY\323\341&\177\366h\223"
+	.ascii	"\272c_\177\277\037\016\253\216=\242\022y\320\017\340\343\037"
+	.ascii	"\362\237\377cJ\247.t\213\242t(J\317P\032\f\245uJ\313)}\022\007"
+	.ascii	"N8\036z\242\264i\\\233\337\216\355M$\022\027\372m\031\177\347"
+	.ascii	"\020\333B5\004\266qmP\230\210~\026|\032B\220}\005H\226\006\305"
+	.ascii	"\007\006`\034&\250\252\252$\027\013\250\240\214\244\027\213\213"
+	.ascii	"\2468\r\251\270\344\375@\251\327\021\225\273\032\244\233K*\370"
+	.ascii	"\224\273\231\371\321+&5\302\217"
+	.string	"\205\237\327\024\246\246\334\315\214\374\371C'p\243g\223<\316\243\304\003Cu\307oq\0277\222\232!\267\302/\372\r\204\237?\237\315Y\223\023\331\206J\355\332\216c\333P\226\270\315\351\360\331]\223\317\224~w\020\236\215\264\026\230\227\326,\244\265\300\250\270Z\024f4\031\310\214&\323\226\314\002\r4\353\004\326\302Z\261\\\253\n0\025\227\025k\366\262:\031\340\230\2545[\321b\261\331*d\334\203\253:\376\021\006P\245\007J\241#z\020G1\246\210\212\232\263-\252\352\306DoFo\376sl=9h\354\270&\007ww\303P\247\212\360\\+\241\202O\274\327\n,\374\234\232\342\344cq\271\0248 \360\242\241\252:f\n\355\324\206'j'\262hz\0340I\006r\310\264d\305c\334\221I\2063\272\026\006\302\311\324\222m\305\274!\360i\262\315\364\037bc\266\226\362\013\346I-\\'\374\266\211\033Q\320\272"
+	.string	"\327\352M\3334\207"
+	.ascii	"L ;e\241\035\nY\351\332\314\003\343S\3272\307\271\303\0208\302"
+	.ascii	"\322\250\327\277\rZ\214\322v\237\215\364\305\\A-\213.\023O"
+	.text
+	.section	.gnu.lto_getDumpValueOffset.191.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\214\002\325\022"
+	.string	"\026#yG\340\322&\035SM"
+	.string	"k\307#\366\"\255U+=&\220i\f\353\210\027\035\344p.s\0179\030\200J\320\246Q\337\353!\363\335\253#\356\260\206\032q\216\234\361\006\361\017=~\317\034\303x\367.\035\370+!{\023)S\ne"
+	.string	"\\"
+	.string	"h"
+	.string	"\252\366\177~\202uP\346\001\346\334\241\025\315\t\"p\201\356\321`g\333/q\023,\267\024\354\311"
+	.ascii	"\022\202\203\215\220\2179\301\217\344%\362Q/@>\256\207\267.\343"
+	.ascii	"\266\332\362]\227\f\220v\304\226\031\333\203\276)!\021\301pr"
+	.ascii	"\2764/Y\"\013?\200\340XX\345T\346\234V\030\216\206\233\273\355"
+	.ascii	"\224\355\024[o\004\321\227\221\217\337\007\335@\007\242\244\237"
+	.ascii	"\031\255\331\240K\227\307\376\326j\265$\357\216\035\325#V\213"
+	.ascii	"X\035b\265w\240\337t\360\007\261\272\223jN\252\245TG\251\336"
+	.ascii	"\244z\245Z\243\372$&4l\244z\314\211\241\2464\217\"\f\021\266"
+	.ascii	"Y\266\311\366\246v\202\024\326\201*\234d\276p\334\234\004\273"
+	.ascii	"<jb\257\241\267\344\356\266\257\031\361\322\232M\273+u\330,\315"
+	.ascii	"\244\376\302\201n\234\031}\305M\212\216\\\372\343\262P6[\027"
+	.ascii	">Q'\363\231:,\374!\323\2729]\217m\321\n\2337=>Wa\233\366\307"
+	.ascii	"l\323\0246O\036G\016\350\320\350\222\275\023\220\337\221\265"
+	.ascii	"\332lx\371\345(T\335\2344\n|\241\226\007\035\210\007\024P\r`"
+	.ascii	"\026\240\\R,\252U\214\207\222\340\2622!\372\204\222r9}'\226\017"
+	.ascii	"&\265\362\362\235V\020>\224\001V\305\240V_\004\225j\365\231\300"
+	.ascii	"\371m\356\216\317\023\326\210\"\373\220\304\346\001H\nc\033\262"
+	.ascii	"\335^\260\335\255Uf\366\265\311\030\"\033sf)\376\310m\\\317{"
+	.ascii	"K\312\345\344r9\214\342\306Y\330\342*#\334\226guC\0023 \240\002"
+	.ascii	"\231\271\342\001I\204f\276\250P\033\027\201\223\300\331\361-"
+	.ascii	"\264\027I\227f3_5\235\242M\233l\027I\253\312t*\031\230\315\210"
+	.ascii	"\177\215\b9j^k\231\223+\250\r\224d)qA\211w\177\345\305\n`\205"
+	.ascii	"\034<d%!\302\301\246s[\3606 \313Z\334\271'\016\023\272\271\002"
+	.ascii	"\302\275+(\rN\252\003\350\361uo\202t0\327\245\223E\227\365'"
+	.text
+	.section	.gnu.lto_dumpPgValue.192.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\344\004%\037"
+	.string	"v\370\310J\220XN:\302\217\336d\3669\331C\314F\275\f~Na\352\244v\317\365O\241\025\005(\013\250\336M)\315\276\335x\202m=\036\222\312\257\013\353\300\234\020\020P\275 \306a\020\223\311-\324\307i\320\365\213XB\b!Dn\231\002\260"
+	.string	"\244"
+	.string	"\267"
+	.ascii	"hiZj\367\256\013\230\374\205\027A\342\334\005\232\325p\320\366"
+	.ascii	"w\020A\345\025\351}o\324Z\002\266?k\361\226\312\\3\270\346\336"
+	.ascii	")\262$\367\256\f\276s2\371\225mJ&O\006P2y\365\327\302\253\216"
+	.ascii	"k\366\b\302dD\355\336\273\353\034\2542z\232%9\266U\317\267\341"
+	.ascii	"\217Q\223G\352\t\212\317\002ROD6G\005ic_\270\312\2118\3324\371"
+	.ascii	"\020\342\206L\266\234\342D\fZ\222\253\234\240\226\354\210\033"
+	.ascii	"*\215\272{o:\\\262=B(\322\b\303\r\201cz\004\214\025\203q\201"
+	.ascii	"*'(kM\236{\357\255p\370\304\277\361\377\250\377@\377\310$,\274"
+	.ascii	"i\235R\377\316m\273\2750\215\371\017#\351\235\367*I8\037\t\241"
+	.ascii	"\342\3441\243d\222\233\301\330B\301\252\022\265\305\225d\333"
+	.ascii	"\376\365g\233\352\347\361\336{\337S?\257\314\003\330\213\257"
+	.ascii	"\303E\230\005\334\354sn\3668\374\305\277a.f\033\324\276\306\264"
+	.ascii	"\317\245\3664\250=\316\264\237I\355e\332>\275\331\337P{\324\264"
+	.ascii	"?Q{\363\264/M{\262\264\037\333\276\333\336\226\366\274\303e7"
+	.ascii	"\324\270\254\020\273\267\251M\314\225B*\371\301^\314_l\204\301"
+	.ascii	"\236\376\377\362\215\227\270\336\247\",I|\274`\350~\353m\262"
+	.ascii	"\020?\006\206\222A\246\323b\226\254\007]\302\220\231M\345\204"
+	.ascii	"u\332\n\261!\005uV6U\023\316\251Q<\353\272\242\313\261B\274\254"
+	.ascii	"\304H\030\245N\333b\327\025%\273\306<\366D\352j$P\342\020\213"
+	.ascii	"f9F*\0074N\3372\021\tX\263\321N\373\337\320cY\250\323\272`\377"
+	.ascii	"~\353\264\233\215\003/\361\271u\205\263\321n\266\340\025\260"
+	.ascii	"\003\217\235\315_;\312&\333l\016^\001m\333\307.\273\331>\260"
+	.ascii	"\030\2100\017\"\310n\"\305 \001l\267M\377$JX\026\216\255[\352"
+	.ascii	"\337\005t\267\f\2643\2461\215\003\210\227\225f_y\3238X[\272\254"
+	.ascii	"(\331\265\327X\333?\n\236\r\267\353*\350\214\016\350\216zF;\251"
+	.ascii	"\n\"{$\344\343\001\3654\030\t\361|.z31z)Z\364\364\204\202\200"
+	.ascii	"\206\212\210dV\030\361|\210X\370R\234=\237\020\357\005\371\237"
+	.ascii	"\006AB?\273\037\240]\213 \036\213\335O\221\321\256A\200\017\021"
+	.ascii	"\365\212"
+	.string	"vGCCE\273t\275<\336\236:OR\003\321\262[\223\353\232\346\260*\271>Q\024C\323g*j\216\tE\035;\316\240\211\007f\031h\032\rn\311\342J:\025\330_\355\241\376`\262U-\r\330\277#\260\013\030\247Z\251Xe\3174\2569K\360\n\030e\246G\024\321\242\266\fX\231>\227\251Y=E\036QZ\367\006Y\250\0169\203\036\020\250[*\021\313\302S\270\021S\250q,\"\225rhFF\002\tF\222&\351\200\002\231\251\252\033\021\3208\251\244\253I\231m\233?\025\033\234\026;\356Y\253q\230@\t>\255\223P\342\372\361\212\303:\346\033\300\264\n/D\035\3507#\311]\033\273\231\257\007\036\0322\221\016&\371x7\030\372\257\325q\214k\245 \347\265\022\025\350;&\273\255\365\254\331\342\256`\302;\0242\n\306\315@r4\305\227H\311Ly\345y]\031\354\263\347\305\201\316\202\260M{["
+	.ascii	"\003\226\212\022\317\026\346<{\206\261>\324\262\t\304\267\013"
+	.ascii	"s\b\026\340\020\020\242\252x\\Pe\001\013j\344\2510\272\351J\360"
+	.ascii	"\031\346/\022\226\277\356\263\365\266\367\007"
+	.text
+	.section	.gnu.lto_cliPrintVar.193.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`}"
+	.string	"5\n"
+	.string	"&\224H@0\213(\035S\246o\327\242T\251\013\275\031\330\312\315\246\327\303\rY\217\031\324\266W\300/\326\b\336\302\275\215\324\306\256\177Q\366\307\300\300FAQf\013N\005\317@\022B%c\321\223\306m\345N)3"
+	.string	"8"
+	.string	"5"
+	.string	"\266`\217\236\237\270\036\261G\\\217\346\354\325'\203\235\224,\210\036l\330]\251\013\316\035r\376S\247x\243\356p\362\261\273\206\336(\301\255\267m\261-\355_\004\034\366\213\022\032\034\365\333\177\312\025\333(\263\276!\004\024\257\264\272\260;5\036\275\201)\264;<\270\317\001\025\327\360\231&d\034\3327\335\001\367\023\201C\354\222T\021v'Gz}`A\020u"
+	.string	"\301\226/\250j\177\004\300{Q)T\024>\003\332\331\263\203\252\300\276dw\327J\262?\377\353\250;\376\364\253B\037\263\300P\201\303\332=\320\n\233\247\243\233\315'#\3310\001\324\331E\263\311d\226\221\034\rFDf\033"
+	.string	"y\221\260\326\t\331\244G\3236Y\231{\311*\311 \031>\220\0260\005^\243j#\360\2361B\332\371\n\f"
+	.ascii	"3\241G(\206\310\213\017A\005\250\256\201w\\3\bb\222p\013\372"
+	.ascii	"\006\250U\300I^\\\223\f"
+	.text
+	.section	.gnu.lto_cliPrintVarRange.194.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\017\003-\025"
+	.string	"v\245\206J\300RN:\217q6\013\324|\202\213\272\352\203\032\272P\363\023A\3506\020~\022\301\003k\2010\035\340\271\037G\333\314\316iB\2347Ho\327\022\230\3326\252RP\2026-\362\202H\376\027\006\304\311x\252.}b\t!{\247\024k"
+	.string	"k"
+	.string	"t"
+	.string	"X+\025:\255x\331>\265\377\3420r\367\355\374d\267\210\252i\367l\261\201\361\241\317\013\020\037\216G\021\037:gW\375\354\255KE\021\240\237\325\356\226\025E\216\346.\206`\2459\237^\3750y\272\213\364*)\034\205\016\376\350\b\254\230L\236\320\353\217O\217h\262\273"
+	.string	"x;\220\272fv\327\324\344\211\270]\267\215\263\035\301\2563\001\346\202\3202\332\265\377\363\207\306\336\206\330s\017<$\251?z\002\242\037\252e\005/ \276\222TS \022=\336p\031\270q\327\347\305\217Q\303aL\361\320\337\021\037\276\206;-\">\036\272e\237:ZO\330\377\224\t!\247k\221M\251I\356\373_ \365\b\245\036AjW\245\026A\352\260R\203\224\372%*OS6 \273A[\001`\325\3716N\243F\200(4\254\256\372\363=*\244P\355\356nZ\030w,,\030`\364\246\311]\325Y\254\256\330\237h\377\355\270\221\321\361\"\326\377\202\370\300\032\326+\001i\361\314\356D;\024\225m\363\0347\177\352\341\274\311\366\360K=\260\302\260\330:\215\023\300\222\322\321\254\005\275\253!U\311_\"K\334\360\223L\202L\243%B\362k\270j\334\325}\310\241i\226\255\22015:\264\234Y\215\374"
+	.ascii	"\273\335hN,[![H\331\n\0313\243\345\300n\244l\346\301V\253\321"
+	.ascii	"\244\334`\035\252c.6\265X\031\313P\346\330\300p\312\330\rW\272"
+	.ascii	"\004\260M\303\354V\352\330l\267\362u\356k\221/\360\220\342\251"
+	.ascii	"=\376\214\237f\211#S\r\034\214;\006?U\347\261\216<x\024N\246"
+	.ascii	"\007\341P\022`|\224c-Abj\201\343*.\302\001\364U\355\t\024\350"
+	.ascii	"M\007= \260\002\0311:\017\262\200\205\230\001\023tP\373h&\323"
+	.ascii	"\266\262l\013n\004\230\302P\rv\373\210\223R\360@\276\213\271"
+	.ascii	"\372ws\271\206\240U6\345\251\214\214\203\352\260h\b\236Br\270"
+	.ascii	"\215\355`\006\3342\002@\303~\213\301G\326\002\233\203\3574\377"
+	.ascii	"\026rX\2028)\013\363\227\225\336\347\371\312\226\225\254\024"
+	.ascii	"\260\327\3066\201\265\004\203\201o\254(`\302\f\241\371L\t\036"
+	.ascii	"Q\266\370\336\365\226\370\"\2515\327\261p\242s\351\023"
+	.text
+	.section	.gnu.lto_cliSetVar.195.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`a\002m\022"
+	.string	"\306bxG\340\322&\035\256\n\371\034\311\257\342\236E\217=\022\242Q\252\030QK"
+	.string	"\232\205\274\306Q=r#j1\302CvFkK\361\006\036^G \324z\2040\306\030\3131npx\022aX\006\334\331\255c\031\261d\023)S\nc"
+	.string	"^"
+	.string	"d"
+	.string	"q@>\355\373\374D\353\265\231\023\330\315\241!\264\013\2368\201\367h\360$\335\243\367\002\335\243[6\322\301\020{\242\221\200\331\200\354\356\247 \336z\0279\315\226\237LaL\346z\247#ZH\301\335v\256\304\022\216\230l\303\365U\323\221\354\020\211"
+	.string	" \273\240yj\260\273\316\230,\303}\272\355\025\333\013\354\364\t0\371\230\247#FG\267\227\272l\320\225\252c_\3030T\262\346\330\\Z\344??\352@\267\367\332\337\305\264r\351\344\322\027\200"
+	.ascii	"\307\006\205\037\2737!\323\336\342\020\355@\277\375\333\034b"
+	.ascii	"\033\310;\2766\030P6<hI\273\240\311\243Ol\005\217\242\365\237"
+	.ascii	"\n\216\2733&\241\335\327\211\025x\017KG\260 4\031\372A?\340\343"
+	.ascii	"\346\312&\033t\375;D;E\252:~\214\007}(Y\274\360a<\326xv\266%"
+	.ascii	"oa\033\311\333u\035\307\031\333\033\023<\273[\362(\242\267\335"
+	.ascii	"d\366\312 \326\033\350\256\"\352\204u\250\311\360+\"x\273/\006"
+	.ascii	"\276\nV\2137b\246{\274FX\r\245\032M\206\366\262S[B\254\230\027"
+	.ascii	"U\231\300\222\222\211\254\224\214Z\205\262\302\242\372T\017\276"
+	.ascii	"\325J\252\345S\261`>\224\021\273\274\250\260\276\030\027\027"
+	.ascii	"\326\027\002\356\271\325\234\224\0177\032\255\361?s\321z\222"
+	.ascii	"\026\334\222s\273\273\035J\375\031+\007)\335\343\211\303\215"
+	.ascii	"\036\017B\317#\rQ\325/Z\245T\252/K\241\213\247Q\023\227\352\313"
+	.ascii	"X\251\004\310\341C\210\365@i*+. \300\002\231\251\352\001\243"
+	.ascii	"\320\241\f\354\3065Lw\"\213\233\341\353\271U\222)V\301\314_A"
+	.ascii	"\366 \00519e\3348\267a\202\354\321\2605q\241\354\035\246\373"
+	.ascii	"3h\253@\357\262\207M\027\312>\2241]\212\335;\333\276\341\215"
+	.ascii	"1\364n\020\211-\214\001#F\256H;S@\037\201Z\204rvO\215\224\305"
+	.ascii	"\234\202j\026]\266\236"
+	.text
+	.section	.gnu.lto_cliPrompt.196.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375 \346m\006"
+	.string	"\302\013-4PO\222\016 [\372\257r\361\312\035U'\260\262\252\027\257\246X\257\025\306\210\265\345\020\301$\036\315\272\356\211\231\031DVh\245yY\256\370:\243\241\241Md\n#L\003\004\321\224f\003A=\352\341Il\032\"\036eQ<\215\301\325\204\203\365*\252\312z\031-\213\237\031R\266\r\3448r\035)\211E\001(\223\323\354\"\2003%4z\214\f\327l\247r\262u \366\032\346\020\344\013\220\370y<@Y\321`\311\354\304\300\344\026\231\204\376f\276\336\245\032(\245P\213G\311Kf>\f\351Uw\335\212T \363`u\322Bf\3562\317G\307\376\323\257\360w\002\b"
+	.ascii	"2\001\003x\006\340\002t\r'\013a\274\f\001.\335\242\235O"
+	.text
+	.section	.gnu.lto_cliShowParseError.197.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375 \355\215\006"
+	.string	"r\214.4Pm\222\016d\362*\"\030T\251\250\206k\033\215\2411E\266\261\363\026\026q\264}\200\2503U\242\236\r1\250\352\2323\265/>\217\262Ta +\315\022\"SG*\306\311`\342DM\202\3000\263a\200\017.<\207\215\246\341\301\310y\231\201\251\207)>\b\212\212\357\202e\035h\205\223\254\302Y,\265v\324#\202 \224\331\351%\001\320\301\034T\372\t\212\326\353&R\222]8\3531\2539\215o%3s\007zW`2R\201dzRP2\223BD\177/WOR,\224\026\321\b\343c\224\231\317m\264j\253n9\032p}\2546\013Bf\336\256OFw\3751\377\373=\001\007"
+	.ascii	"2\001\003x\006\340\002\244\313\370\227q\301\245[\264\363\t"
+	.text
+	.section	.gnu.lto_cliShowArgumentRangeError.198.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\217"
+	.string	"\225\n"
+	.string	"\226TK? \305j:`\002\f\216\007\b\200\323\335\005\2162\332\261E"
+	.string	"\200b$\206+\030\277\215n\341\247\021\215\345\360\357E5X%\023\017\bpH!\300-MU\027\007[\374\002\f\022\0326\262wJ\0016"
+	.string	";"
+	.string	"8"
+	.string	"g\307\033\356\233\317k,\337\270\033X\276\271\264\005\374\024\331\313\352"
+	.string	"\352U`w\275\032\362\362\264\364\377:\306L\231N/\016\273kj\246:\356z\333\033\333\017\366\021\002\247\226\017\307JI`wcf`e\033\312\312\3663\266\3131\215`3>4\030\350\371\222\362-\307\214\331\365\030"
+	.string	"\333\335\216\027\270o\235vj\177\344$\345Y\026/\330U\245\300v\003\034\200\224\354\242b\370B\265Z+\2557\371\311H\023`\367ts\202;5(|\263K\025\364\246\251\312L\206\252&\3734\321\nb_\333\335uU\331w\375\332[\177=\353\001\006q:\320\370u N7\206a\211\024~:\0229v#N\002\305'\3261$\326P\374F\315\240'\024\001z \2047\206>\321\003E#\317s`R\"\024y$\222\024y\231s\257mU9\r"
+	.ascii	"2\2417h\340\303\0058\256\001\003f\f`.\350\234\022\202\005\002"
+	.ascii	"\203+\322\324\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_nextArg.199.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`X\001\305\016"
+	.string	"\266\333cD\360\222(\035\260\374F\242d\374\277\023\2645\313\275)\002h\226\354\350\272l\365\265"
+	.string	"\330\267\002\316n\373\252\374\337\220,\255~N\204\223/\006\303\2608\f\264~\343\022\223\007\317\013\363\\8\366#4B\366\2262\245M"
+	.string	"O"
+	.string	"Q"
+	.string	"\376^ {\334|@\366\250\"\272\204\337\r\263{\026\241f\347k\244\r5P\236\350\031\307#e\204\372\002#\307\210g\202\f\\\254\030\361\3263\345\225\022\262V\256o\375\001\354D\203\362V\236Z\203\335u\242<\017\267v\333#\333%\366Y\002Y\274\313\017\377\335\231\351o"
+	.string	"\204\230\341\375\264c\267Cl\310\272\342\215\023\377~[\305o\231c\373\353\002\354k\357\251X\034\200\354~\b\036\335\311\273t\027\260\253\232\261\261\373%\360\201\315\343Y\274\205\212;=\225F-\nX(\r25\273\337\026/2\242\256<b\362~h\246\006^x42jj\312]\226\032E1*`zdH!pw\027\226<5S\215t\nbJA\312\230\306"
+	.string	"\241\232Q\307$\271qdPm\013\027\362\250\250Y\363bq\225Td\177\242\324\225\375\005/\035$\254*[\013\\(E%p\016B(&\034W\301#bO\347d\202g\363D\330PN P\330<\034h\353\020\360'\305\204\333B\237\017\267q\276\275\252\324\020>\346\232\246w\275P\270FJ*\221\351\312$\007e\327\267\300\360\270\f\006\320fwo\342*\002;\321\244>\2142v\230\217\034"
+	.ascii	"Y\005VzCf\306\311hhf\236\300\362\230\220&\0257\332M\373@\n\241"
+	.ascii	"\2566\325p\246V\336\"\025\204\240\304}+\036\336\204\343(\302"
+	.ascii	"B\345\373g\206:e\tG\254T\206\"\264\362\232\007\003E\331t\315"
+	.ascii	"'"
+	.text
+	.section	.gnu.lto_processChannelRangeArgs.200.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\004\245\034"
+	.string	"\3064\272J\260VU:d-\252\3463F\022\256\316\331`*\207frQ\005\213\255\205|\303\340\220\265HlF\234[\r\033+MC\332t?y\337\263\302\253\0250\346\360\247~\355\377\311_\355\234\245\217\326&\341\276\232\370\366\t!d\313\235d\246"
+	.string	"\232"
+	.string	"\247"
+	.string	"\n\352\215ro\335+\0045\344\336\342\003N\220\336\274\216\357\310\341\\\253\320\321\005A \266H\201\004uo\021\306\305\313\2347\323\277\316\233\035\203\353m\361\234\252\271\253R)z\232\266k\216o|\205\335/\213\017\210\342*+3\303\006\361N+~,\003\345\222\220#_\177\300]M\301\b\372<\r\n\n\217\262\370\251\002\262\270i\027DM!\002"
+	.ascii	"\330\263\003txh\254\200:\325\332\227O\262\311\223G\340\264Bh"
+	.ascii	"\0354)\372Y\001y\265\217<\006\"\020\225\240\240\317+*\341\336"
+	.ascii	"\313\325\007\f\236Wg\346#f\2361\267RZ\272\207\314\305]\375\214"
+	.ascii	"\"=*\270\205\230g~\364\013x\361\177\271\256tn\261\316\31217\372"
+	.ascii	"a^\236tNotF\321\312'Z\331D+[\264r\237\225\353Y\371\004^jD\001"
+	.ascii	"~\347\351^\236\345\226\333d\022\251q\245?\351\225\371|\2443\221"
+	.ascii	"\370\022k\020*q\334{WA\370I%V\n\021eL\271\367ZH\377\203\217\344"
+	.ascii	"\343\201\344<\t\3477x\277CD\004\232ro\261\301M\226\220\336<`"
+	.ascii	"\377:I0\257n\2369\207y\305\314}d\202\307\203Z<1\303\272<\243"
+	.ascii	"\213u\211\332f\346p%\266_;\337R\210\305\306\323\331\303f\356"
+	.ascii	"\360$\261\364\336\033\201\217$\203\314\300\020\321M\376\211\363"
+	.ascii	"\346}U\\\335\3752\372\236Rt\321\325%\033\321%\231L\2343m\323"
+	.ascii	"\007R\221\361\t\201\267\253\353R/G\211-1}\323H\250\33499\002"
+	.ascii	"\241\274\3321\315\265\207\205u\343\254<[]\373L\2679\206\206\024"
+	.ascii	"\0359Z\331\325%\303TV3\317l\352}\255~\362.(\247\"\227\002\265"
+	.ascii	"\344a{\310\271\223\325\355\003\351\205\021\n\257F\261\252\242"
+	.ascii	"\315L\263\325\373X}\344[PN=\232x\215\242*\211\242\004\f\202F"
+	.ascii	"\004\b\\\214\006\253\331h4\233\254\300MlD\227\250\361P\2630\273"
+	.ascii	"\305R\\\r\307F\001W\253\241\341\314n\023<\330\334\304F\270jf"
+	.ascii	"\265\330\315\274\341B4\313hlnd0\331\007X\315&F\203\311n\"`4\001"
+	.string	"\330\026\242\346\006\303\331l7\330\252\250\273M\241\375\362\3227\276\325\344\304\245I\327;U\017\031&*\235i\231c\217\224z#O\373w\344\317s\354\351\222\262\232m\205i\264\177\025\312\355\275\367\246z8\263\201\311N\226^\215J\317\226\031\272\257\312\037;\315>\333^\351\001\361\227\\\210\245|\023\347M\263U\306\237\220\337\217.L\250A4\210\214BH\021\022\232h&(\250\213\001p\002\241:b\007\020`\311\244\311\264\006\214\260[\207\217^D\374\304\034;\205$\345m\200,\353\342\342\026\216\033~<\321\356HKB;)I\263\\\252\204\002\001P\367zZ\030\302\t\002\tx\200\254p\215B\021\362\330\2220\210A\326QrQ\265ul[\201(T\341r\375\357\357\030\202'P&\346r\036xd\020\356\020\375\205x:1c\205\020\b\300\311\f\fa \222\274\331\371\331\"\b\017\204\346\002\013\367\353\312\016\202\242"
+	.ascii	"\240\265.\367C\2142\225\016\265\0025Q\232\006"
+	.text
+	.section	.gnu.lto_isEmpty.201.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\254"
+	.string	"e\013"
+	.string	"\346\025P@ Q\224\016\017\241\303%\344u\004`\213\021\236\327 \0023\242E00\207\250U\227@e\013\340\033\233\351_,\373\021\377!}"
+	.string	"\305"
+	.string	"\300\242"
+	.string	"D|\030C\340\f#\234\315\244Q\004\355\275\245L)="
+	.string	"?"
+	.string	">"
+	.string	"\241\303\247\031\362/r\270\302C\227\301 \321D\207U\207?\212Vz\226\335\235h\244\324w\351P'\212\226\275\212\251\244\273\310\323C#er8\330]g\006\215\303\035o\033\202m\004\366\t\004,v?R6\266\005T\021\3026\310\236\330\316\264?\342$@\017\371\034\300\356f\002\305.\247\300\007\252Cs\027\020\017\253W\342\241m3h"
+	.string	"rh@I$c\201\b\222\216\0224v9K?<\035\312\364t\363\304k\201\221\031.>\202\301S\201\270\032\310^\2348\2152\225\331\241L)\324\237\250\372 \006)k\330\234(\025\304\376\333\335\265n\206\017\371\365\245S\323\217\327\351c\203v\r\001\0244\031\254\303\211\2760\231\n\227uM\2604\231\b\026\254\013\343X\230"
+	.string	"\336\\\220\200Y\235\315\006\263&\334^7\247&x\276\313S=lC\265\2144s*\324w\334\030e*B\005\361\237%\001\017"
+	.ascii	"K\b\230P\307\023\206\242\262\312\334\352\350\244\211\004\242"
+	.ascii	"\200\306\345\204\360\271\214*\325\370\211ea\"\341\252\252\206"
+	.ascii	"\364\256\002\005"
+	.text
+	.section	.gnu.lto_printRxFailsafe.202.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`O\007e'"
+	.string	"JF8\017G\200\334M:\277\273\316w\261\355\305&\005^C\020b\2201\035)\277\332W!\363\321\241\300\300\255l\037\372Ie\241}\207\300<m\206|\22368\331L&;\346\305\257\t\275\321\221\252\251a\305\025\255YB\b!R&\031\335"
+	.string	"\307"
+	.string	"\340"
+	.string	"j\365D3a_\240\322?\331GY\335\315=\224\223\001\217d\361J\254\217\001\026\326\205M\255\306\0067\227)\275\311+Y\267\353\004\312\216\013\315\273\037{\023\340\215UD\273\212u\f\242d\374\320y3}\320ys\231w\037D"
+	.string	"~\211\213\355Z\271\316\252\324j\\\332\003\351\315\005\356\256!zQ\255 \204\241eA\211Sk\3555\220\005zi\374\346\030x]\016\227\242\247Y6\003\367\307\033\3302\013\256\225\r\255\256+\233\210\233\031W\273\261\243\244`eF\333\243\0049\367\203\250\343\270\002\251\017\342\326\321\253\335(f\361\231\343\246n(\344\262d\300\365\005G\317\360E94\246+\315\317\3162\206X\334\217r\263\213F\225%n>\210:\316h\205Z\353\262\326\220\370\335\371\356\212\331\335\261\335\363GM\203L#\350\2446\265\b\305\370\353\345|s_x$\310\311E\352\367\317\216\341MQ\315q\r\371v\305\311.\003c\255G\367\327\256\321\212\215\340\024\303l{\355.}\311\277\340e_\005w\362'\270\3317\351\306\037\001\363\362\216\374\"1/\001\224w"
+	.string	"\363\036\235\274\002\230\327\210y\213P^\"\346\r\300\274"
+	.ascii	"P\336!\346\025:y\203\230\027\210y\177\230ww\362\3720o\017\363"
+	.ascii	"\362\240\274;\314\253c\336\034\363\342\2307=y\321\223\367<y\315"
+	.ascii	"\223\267<y\333\344e\223\367\016\232\214\330\2501<\rd\2556\222"
+	.ascii	"tj\232y\245\310\313~\263\037\371\336=\225K\331O\371\331\352\314"
+	.ascii	"\252*\004ad\b\363b\344ZiY\325\256\006\375,\305:I\306\2048\327"
+	.ascii	"<\215\324\3732!\216\243\330\026\247V\341\265D\244\302\363Pp\223"
+	.ascii	"\327=\275;\202\004_k\313\272\325V\273\240{\372;\315s\342j\276"
+	.ascii	"\t\373\264\217\371\225\0073q^\313\304ys\247\225\330\256\224\255"
+	.ascii	"\353\337\261\306\232\271\006\327\271F\273jl\021r\025}\265\234"
+	.ascii	"i\343\272\301\b\217\240\235\366\263\276\240}*\357\r\221b\\L\026"
+	.ascii	"\355\257e\263\301\357\025\026&\013\255T:\257e\360\241\316\356"
+	.ascii	"\243\031J\254\334\2209\373\253l\260\344\220)f{\235m\366\177p"
+	.ascii	"9\373hlN\337\"f\266\022\333\330\025'\177\2577E7e\177m\331\335"
+	.ascii	"\346\220l\316\221\r\213\345h1R"
+	.string	"\366\305\b\331Eq,Pi\255X\022\366W\200bRi\255\365`U\347\315n\037+\2626.&cW\tZA\007\313\263%\222x\277$\336\212$\336\223\223\257\251\305\324\3567t\364C;\250xZ\341kb*\201De\302\251)J\312\302\023ST\224\357\204\005\246&\037\325\223\223\017C\213)\"\024T>\r)\240V\224H\367\347\300\351\351\327\3735\365\242\234|P\275\337\024U\317\201\320J\245`\232\352\251\220\222\232\352\351\2145\355\307\247dH\252\033\233\253\016\246\351\372ky\272\340\226\332T\302+\203\325\216g\260XNYk\255\271\376:\213\023\251\227\272KQMp\215\214+\310I\306\0210\032\320\004\032\355*n\301p\2678\003\004\364\321\033\001\375\267-\262\2426\016\307Q|\363\220\n\037fT4\"\352\242F\273l\300\331\3606l\210\002\364\321\236\2229\026\221Yol$R!\222\n1P\003\3700\324"
+	.string	"\222 \236\006\315PP\013\261\005\365\337\212t\334\306\256\302\374\247\201\222\007\363]\377\370\364nM\314'\200\212\250\201D\344\fB\204JFDI\222$\351\260\002\0212\252:\021 =\207\224\031I*\325jHSrN\242\001,\222\340nEFv\351\230\001\251"
+	.ascii	"^\005&_F\253\231Iz\367P\316x\201\023\216-u@Kq\302\351\347(\320"
+	.ascii	"\007\357\037\b\366\216]lK3=S\274\220&\214\026\027\354\3050\212"
+	.ascii	"\230i\356\031\241D\t\220D\336\0328v\273o\2240,U]:=Q\331\204\236"
+	.ascii	"|\275D\2659\004\317\264\2376h\267\330!}jP\027\217\345\257\217"
+	.ascii	"\241I\321\257\301f\026=2\304)n\035\373\030\306<\210m\210\b>F"
+	.ascii	"\335kC\007\202\205sH\240\227Os\260 ^d\224\355\327\360\247*NZ"
+	.ascii	"\270\b\362\261\340\021\026D\3633\303|.\352\306O\331\304\240t"
+	.ascii	"\215La\002^\353\263+5\251C\311\017\032\365e(]A\300\030x@\334"
+	.ascii	" 7\353u\322?\376\335\362\201\006t\335\361\2254\2470\224\243\214"
+	.ascii	"\302\212s\220\252 \234\275;\231\215\305\211pK\242\354\371\256"
+	.ascii	"y\202\035\224\n"
+	.text
+	.section	.gnu.lto_cliRxFailsafe.203.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`7\f\305C"
+	.string	"\312v\\\032A@\244N\007_\203\0264\374\177D\233n4Ko\001\225\034u`}M\275p\025\317Q\020#\016\035J\331&\037"
+	.string	"4\017\313\220\273\2707F\377w6\002\270c\031\033S\325\314\260\2754\022\262\367N2\245\226\001n\001\224\001z]\236\313\262C\353L\263\240\300\363\352\353y0\236\304\3462\331\221\032\021\3008C\022Eg\237V?j\307\304"
+	.string	"K2\325\342\241\350l\030\031O\314\271\354\303He\003\214\233\340u\355v}\3742\243(\007f'\2232}\002\241\350\354;\325\351\372\330\f\034\274\356\005\214\306\236\351\031a\316s\312\242sy\275\213\r\317\316\\\2143-B\230st\312\331\236*:\313\364\216\273=\316\265\274.w\303\2239'\001\223\227\363\034U\027(:\333s\236\324:[\364\243\326\331~\273\007\231rdf\203\251\331\223\3160\347\254\374%m\344\353\234\367\212__RJB:2J\026\021\r!\335\243Q\250Hl\331\365\231\360\333N\306\364%%:(\236\204tD\304\200\244\354\211\033\005F\233\254Oe\230\340\344"
+	.string	"$em^tH\264F\270\313U\017\214\262\255D\270\3037\207\213\246\341!$el\216|3\245\343\006F\213\364\235\341#\032\\\224\b6\0221H\231\252\301\203\244\314\315\205V\006a\310\360<0j\266\"\247\f\3029\\T\212\213k\253Ff\211\007F\245\253\204>7>G3\004\023\327#\351\0308\036\030m[\023\300\231\232y\231'n\327$\037nP\017\214:Y\245\b\311\364q;'f\327w\323\263\303\003\243OV\ndv\354q:\307cdM\274\032\337\200\370\027\2018\323\020Y\216\365)\347\354t>"
+	.ascii	".j\005c\"\206\234sc(Y\231w\223w\373\\w\327u\033\327\002n\347"
+	.ascii	"\037\334\230\025:\2454\361!\373k\215\204>\205g\3470\365\030v"
+	.ascii	"\3635\347\234\327_s\260\266\351)\274S\323\254\352Dk\342\303^"
+	.ascii	"\302\377\335\357\b\354\320~J\302Fo3\255\3279\265D\021\212\277"
+	.ascii	"\333\004\n\354\320\377'\3473\273\351\361\023\325\314\320<\007"
+	.ascii	"\205\341\303W\020\347\347\311\377Z\273;\025\016\001d\372$\035"
+	.ascii	"\243\365_A\235#\206\377t\022\023\370\356\024V\330\241\376N\347"
+	.ascii	"\276\243nJ\350\207P\354\231\335sM\374k\335\356`\360m\256?I7\005"
+	.ascii	"\017\343\r\301\305\275@Y\345y\336T\316\347\235\300\317xOI!pq"
+	.ascii	"\037p=\357((\377\342m\300\305]\300\345\334\t\370\030o'\367\342"
+	.ascii	"\335\344\342frq/\271\270\225\\\334I.n$$\356#\027\267\021\022"
+	.ascii	"w\022\211\273\b\211\233\310\305=\344\342F\272\270]\027\367q\b"
+	.ascii	"\267\321\305-\304\342.\"q\023[\334\255\213\233uq\257\216\373"
+	.ascii	"]\334\270\305\355\026\234\374\232n\274L\211\274\340\\"
+	.string	"\366q\030(\003\262zP\234\317\375\214{\030\3671\356y\356z\356_\334\273\270{q\241no\357\363\277\356cg\271_\343\220\026Z\3119\3671\253\373\230\246]\r\237\213\032N\246bV\354\265\24393c\315C\346r\031\221\332\231]\234\241\212-\337\3536*\355;v;\230v1~\347d\274L\037\003\217d\373H\013\233\202uh\354\340\202?\360\215\235}\222a\326_\360\376\347+\026\266<2_\352\3664\017\335_\225\356\257\204\202k\3263,b\220o'h\006C\245b.\026s\252\367>\217bV\227\264J\312T\217\312g\271T\245\224\217\r\005\267T=\021\265\310\235\247\236Pvc3\376\032\356~\213\274i\330\241\215\343\bN\001\233\317\374<(wB\277\326\3570Z*(.xn\250r\304\360\037,\314|\217@\210\202\363\253\326\200-g\261\b\203\374\360][\362\266\265\265\316R}\2006\275\004\177|"
+	.ascii	"\3243A\343'\370\325/\320\373V\0044\365\306w5\216B\355\214\215"
+	.ascii	"\223\312\021.\312\247\370kz|\352Y.xM\244\260\320{\032\367\363"
+	.ascii	"\276%`\313\331\351\320"
+	.string	"\366B7|\237\254/\024\350\373\326\276\323w\nv\350\324?\345xf\027_\350W\337\3632y\2538)\276\243\361b \365\254:f\026\346\346\371\361!\316h\245\236e\342\251Q\347\024\300\006\262\274Z\260C\245\036\247\201s\b\210\035\254%>\202\027!\375\243\n~\321k\342\303-N\b\346I\262;B\264\007n\246\373\265\342w2\264Mm\006\233q\342r\316\021\354\370\240\206v'\316\366\206\016l\273\207\326Y\342\267e\322\277+r\355G=\353\367\355{\031/\016R\211\260y\306\371!\373\005\276\361s\210Q\216\352\222\366\327\222\016\326B\375s\271\333B\365c\037\352\361];\201\b\201\035\312\376\002'\360\006>\255\265\344\342\262\302\272*6\262Y@=]A=\311\200z\322\312\262jA\303\253\250\261\252b`}Ym)\271\272\266\266\272\256\234\032\253\212\206\227\222\206\327\321\222E\027\b\026\313\257\030K\344\013_\276"
+	.ascii	"\373Z\327\245\f-+\022K\257,\0310\226^\256\327\362\353\312\312"
+	.ascii	"\313\nK\303\222E\327\026\322\353\353\305k-\271\270\254\260\256"
+	.ascii	"\210-d\254\370%W\226\026\213\255+b_Uei])\257Z(\271\262\254\266"
+	.ascii	"\224W^1\224UH\335\365b\351\245\374\352\352\362R\036\347\302\034"
+	.ascii	"C\3307\177\351\204\324\316\2256\314K\230\222\2155g$\027\350<"
+	.ascii	"I\330\005\037\272\222\216\035\271\244\01389\345\016\006\267\275"
+	.ascii	"\315\250\034E\247\313=_\035\330\316\223q\346\260\001t>\263\210"
+	.ascii	"\007\314\025$&%\357\030\217\242\323\2438\231\336\250\306\244"
+	.ascii	"\372\034t\024\001+\375\322\027x\337\303j/\231\2008\357\217\242"
+	.ascii	"\323\323\242\202\274B\236\317l\b\277\204\241\236\364JoTkc\343"
+	.ascii	"D\303;\034\351\223\376\0059\341\216\036\311\b\030\262\315\236"
+	.ascii	"a\032\332\021\333gV\275\"\3272\351\364\214\320\270\2479\263\374"
+	.ascii	"\025U=R]\225\277\026\301;\375\030\240;=\313\334\243C\235s\002"
+	.ascii	"\237\275U*x!&\002\341\223\332\364\302\336\350\3759H\n\346I\314"
+	.ascii	"\275(C\204$9\344\231\325\271\315\261\265d\321\026\034\004L\250"
+	.ascii	"\315^\022 ?\250\276\350\227\324\330\252\317Aa-\236TO\221\240"
+	.ascii	"(@oDQ"
+	.string	"o\325B>5|CDR\034\005;\036\251b\037\270\207C\363\f=\321;\251\245\t>\0075!\177\350\231\3148\261\324(;\020\200\352\250q,\245\230S\250dDD\244)H2\034\200\002\021\2422n\003\021\220\275C6\222$\205\f\007!\243\324\275\327%T\354d\345\257\321#\355@\267\224-_\204x\2240V\311B\310P\003\034\357R\235\216\301(7V\237*\2713-\262\214\f\222{\3445\367\2262\026\314c\221\037\2567N\"\371w\030Ip4j_\303\364\376d\347V\336C\377@'\3174)\fE\266n\262&\261\245c\223\257\263\002\246\364\377W\365\204\035\006\354C\203\312;}\177a\242v\364e\241\234\344\371\224\340y\320~\0162`\334\267\344~\262\243\354`=\321\241\211R\335\321\370\317\263\336V\367\321\240\256k\027\213\302\241\221\325\205\037\361\377k\227\324;v\204\267y\b\315\037\2714'V\241j"
+	.string	"\222\2706\036[\233}\213\231\276d\030\r\221\223\036X\341\356\206\333\217\222\256a\234\207\234\247\350\237\203\226\024U"
+	.ascii	"\215y\212\365e\025B\264\005~i!\306\207\325gBQ\226Mw\t\3419\234"
+	.ascii	"\223\217\252\034)\"\313g'{\263\353\277\303uy\304\0263\027\214"
+	.ascii	"b"
+	.string	"\246l\323N\246fr{\350-M\035H\215"
+	.ascii	"\016#Fd\273\032\340\306\240)\3011\016i\355\242\251WR\300\367"
+	.ascii	"\201G\375E\247k\213\300\247\355\005Q\b\270\277\242\266SCA\233"
+	.ascii	"X\240sL~ifq\211\234\222|x\030K\205\031a\226\214\203\3165/\217"
+	.ascii	"\204\005\247\367(\006\341\214I\313S-\341c\n|\257m\336D=A\322"
+	.ascii	"D&@:xFy\226\345\271\177\311\b\243@\240\310\n\b\013|h\225\346"
+	.ascii	"`P-\213k\016\215c\304n9M\323\003\310\270\020\221\252\213\333"
+	.ascii	"\033\351\345n\032\321\251\235\003_\264h\232z\344\227\275\307"
+	.ascii	"\275\372\275\2216\304\364F\343?"
+	.text
+	.section	.gnu.lto_printAux.204.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\\\t\2352"
+	.ascii	"\332Y\264\023CPdR\007Sj1Z(\341\327\200\317w\\\003\247\242\b\274"
+	.ascii	"f\321\371\302\360\202`\017\243\313ox\211\213~\370\361\243{o\n"
+	.ascii	"\240\b\b\301\\"
+	.string	"\035\213\232)\352\361\026\023\356\263\302:\312ls\033\331;\245\224\002*\001\t\0014\001otdvaOK\351\355\021l{\303K\301\326\215\251\367\207\364\246\r\247L\362\344\372P\260\235\205\233\216\207\275rk\351-\312\236\203\3217\355\366\215\2678:\276{\245\005z\345.\266\327'\265\207\314X\264\350\260\360\316\334\321\266\242l)Y\022\321eN\325\fH\333\b\330+\333E\300^\331\2359\001\003e\313\315\340\277\027\032\305\273W\212\305Rl\257\254d\276\223T\343.\027\304\3119\265\364\335{\217\177\204\215\255J\233\213\256\354\241\"Qh\330\n\331 pU\337\225\334\323\216z\376M\367\352\320\226=\244~\215> \355\346L\210\n\341\217\363M\323\231y\321H\032\264\211AZ(\310\035\020\037\262\245\251u\333ek-T\233\364\326\304\265\233355\n\b\221.pgOg\241\330\322~t\260\341\316~8\260\351\253J"
+	.string	"\232\306G\021\315\251\032\265i\2533D\253\341\252Z\244f\007\247\3054\224\233\2635\325"
+	.string	"\234'\317\276k\317\201\306\364o\272^\333\336\244r~li\320\366\240\204{/;\016\264\264f\242f\356,f^cf\235\001nL\006<>\323\016\2706z\364\3460\375\017\373c}\326\257d\232P\330f4\300~\377n\302\231\371\037W}\177\337\365\005\270\347\233\351\336\334\2402\377\373=\274(\221\1777f\351\322\223\232\\Y\303_\204\331A\3275k\265\\\367\202\306kV\200\240\3034\037h,\335\307\376\322\234\325\322n,w\276j\273f\253\236k\256rg*w\236rg\251\3269\312\235\241Z\347'wvr\347\001\356\334\324:3\271\263"
+	.string	"w^rg\245\3269\211uFr\347#w6j\235\215\356\\\324:\007pg"
+	.string	"\356L\344\316C\255s\321\235\211\356,\344\316\303\326\271m\235\205\2553+t\016\n\235\201\254\363\312:\253Ag\017:\367\203\245\277\251^\226\270*\277'\275=\376\002\335\2745L\223\306\353\016\323]\327m\327\375\245{\256\201\314x\334`Z\f\017\303\220\021]7\267\323\372\342\354\370f\024\247K\350\344\372\270pwi/}\307\303/dG\323w\355\227\274\340\217\214o\304\241\363\354)\177t0>\213\347\035\277h\200/r\016\372\320|[\001\236\306\023\317\224h\031\235&z"
+	.string	"=\247\207\236\250\370C \372\216\235\"\036\277h\220)\364\304o\333\226\260iB\225\232\311"
+	.ascii	"\207/\364/\250\t\327\376\360\333)g\213\001\2228X\355\367\230"
+	.ascii	"\347\236)\321\216r\345\216_\373n\302wc\017\026h\343\0264<\200"
+	.ascii	"\006\372\352s\214\001\025\374\272,Cg:\307\350\3533\217 \341\215"
+	.ascii	"C\301\253R:O\362\230\277\344\253G\360E\2757<\316Aek\354\273\365"
+	.ascii	"\\\237\"{\202_\204\205\317~\033\231\276\331\212\020G\257\001"
+	.ascii	"\022\341G\220S\242\333l9!ad\347%{E\212s\357e_\306\263\316\224"
+	.ascii	"h\231\377\275\025\0256\027\370n\034|\340SX\003\r\276\020\257"
+	.ascii	"\2674\232Nc\305\336{\265\370\200\222\315\213\211\200\277\264"
+	.ascii	"w\006\257\214\3678{\340Y\327W\177E+\2437\225\303\364?g\240\353"
+	.ascii	"k%a\356j3(\330{\231\r\270\313(\331\274\330\267^\325\357\263'"
+	.ascii	"\034\277\250\377\361\017|\213\351\020\323\267\275&\0243'\243"
+	.ascii	"D\313S\375<F\365\024c\fY\224D~\265I\344\327W\bS\201\034k\321"
+	.ascii	"E\214\001f\342\275z\203\230\2121\344\211..\2470/\256\025`\024"
+	.ascii	"V\200y\211!_x\211%'tq\201}%\245\bCn`\3615\306\305r2\313KE\362"
+	.ascii	"\230<q\\\341\205\374:&]\204\035\263\214\f\306\242\313\305Q\f"
+	.ascii	"\f\314\305q(\275=mv\013\033>?\276\2627\313\033z7\026R!:\370\225"
+	.ascii	"\212\263\261\363L[\275\367\336\"\f`\325;\370\246k"
+	.string	"\017zosN\024\360N\017\365RSO\365\314\024\250\254~*\352\245\334\354\254C\324\224\247\207\362\345\326\323\213x\006\362\033\360NM?\340_\r\3237\375\rb\372\206>\005-\275\200\017\2661\361\243\364K\377j\232pI\257\024h\313*\016\240)$I+\364)\310/Z\306\\\243CM\350\335\270\305\264\260N\234\027\347\235\020\301\213\305\3259\357\236;\fh\3659\340\264\326\377\0253R\220\264\236l\b\363\227~\220\n\2641\343\004Z%\3126lr\342\003\370\2427\372\252\347\346\203!H\204L\037T\356\336f\343\310\3006\333\206U\257W\177\364\314\0326x\343`5\200\254\250\201,\006\021R\210dFD\202\246 Mc\220\002\221\261*z\021 \261TP\315hR\311rb\267\364\344C\315\307Jw>\0322\3108\210\310\244o\356\335e^\022\326\266`I\2712Kab!\263\210\333\206\273\337\215\356\276]\177"
+	.string	"\210\253$\023 \263\033\207\353"
+	.string	"\366+\030\032\354-\223\346'\2268\026\266\307^\217N\022)V\221\306\327~\245~z\275\031\023\234\256w7\331R{\321\313\240\306'\024+\346\372\tu$S\230\311\322\003\217q\331\217"
+	.string	"b\b\277R\030-4\212X\332E\257\354\204\352\266\364\210)\\\234a<M&\210\326\353\324F\016\226(\262\244\302\037\204\243\034\316\035\266\003.Xu\371ZJ\"\336\244\366nW%\002\334"
+	.string	"\221\374N\312\005[\260\245\256\320\265\342-\321\230\004\353k\340\016\0208\324\007)\215\002\251\326\336\245\320\2340\246o~R\034n\205S\320\226E\027$5\234\226\363)\006=5\026\005\322\301\242\357\221\365\344\002\242f\021\344\230\305h\312\276\034-b\337Tv\310\377J\302\204h\002\316l\251\007\206\237!e\373J7\300M\323\315xS>\232\034"
+	.string	";\364\327\244\026"
+	.ascii	"\274\260\361L0\355\273\215\221\217\251\356\304\022\212\331\230"
+	.ascii	"`a\235*w.\312\326(\363\352\3740\244\377\001"
+	.text
+	.section	.gnu.lto_cliAux.205.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\005\001]\r"
+	.string	"\026\031\\E"
+	.string	"\2216\035\360G6iQ\001\002\222?n{A "
+	.string	"P\0218\310\206\034V\230ns\263\005\0367\016\373\377R\233\341\211!)X\340\244\223IT\275j~{7\307\361n\255"
+	.string	"n\212\177\333,\376\177\333{\357\224\002H"
+	.string	"E"
+	.string	"K"
+	.string	"\005\252Ww6\314\201\221\0355\200Ab\204J\314\356Z\223\305\273W:e\347\037\345\034\017\034\275nHN?@\222O\252@\254\261#"
+	.string	"h\242\236\317\205w\224\313\022`IJ\315\203\335\265\364@\024wu\333\022lC\260\217\005sd\207%9W\330\237\3438\216\236'\373'?\235\322\327l/\276\023\340c\274\354~c\217MU\033(\203xh\006)X:\357\330\276\264o\362\031\335OB|\300\356I\206\313n\270\300\t6\257\016\357\251^7\017-\330\324Q\262K\272\367\024\373s\226\013\034\224\211\230\033&\273\353@\345+\231\337\342\325\031\264\352k\325\353\347\366\266A\336\363[`T\244D\274dFt\231\376P}V\240\201\303$g\\I:\355\016\036\344\275O"
+	.string	"+9R2\242)\306"
+	.string	"\022\301D\233\026\2728\004XH\006\"\322.\215/P\006rY\227\005+$\243\240Y\027'b\201\fx\323\200q\026\207m\343\254NH:\335yr\004\036+#\222f\211\356\356V\002\023B\362\236\251|\031\371PT\200\364\257\352)\017\026"
+	.ascii	"\002J\312\f?6Z\327y+\002\201BOLL3\340J\313 \317&\322\003\207"
+	.ascii	"\006\262\260\332\255\027\354\243\313\224\235\210\016\216\326"
+	.ascii	"\254N\217ky\247\220MM\256q)("
+	.text
+	.section	.gnu.lto_printSerial.206.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\200\rm6"
+	.string	"z\\\224\024B@\336N\007\303\023"
+	.ascii	"G\217\030,\212\342\371Z\374z\250:pfO\303\321\301\222\206#J\016"
+	.ascii	"-H\n\364\021\037\264f\0202\224F(\200\202\251\0310&\303f\273\235"
+	.ascii	"\224o\327\224\277F\2366\331{\313\224R2\001\024\001M\001\327x"
+	.ascii	"\255\22116\343b9\342\202\356\177\376\335\201\355R\004\311\222"
+	.ascii	"\242\327x\355(\227\007x\267\250\001v\276v\300N\272\333\336\347"
+	.ascii	"~P\377[\341q[\3542\210X\307$\306\361U\312\335\326\202\335Mj="
+	.ascii	"\331\035\205\nV\376n\317s=\250_Y\030\375\304\322=\031\314\253"
+	.ascii	"\023\275\356\302.\364\272\333\377\335\t\024@\375\316E\3478\246"
+	.ascii	"\006Z\211\343\353T3\301\3566\264\373\215\021\2148je\005s\326"
+	.ascii	"\267\030\307q3\013i\330\333\253\367\317C\035\350\307\247g\251"
+	.ascii	"L\362 \341\343\353\266\371\241\355{\276\004Ge\217\215\3404\352"
+	.ascii	"@\355Q\215\215\256\275RDts@\377\264\351\213\377\t\322Vu\237\236"
+	.ascii	"\2706\252/\225\342\332x\270\222\307'\337\236\307\355\221;\036"
+	.ascii	"\366$l:\376\330FQ\305\330p4lp-\321\0319\303\344\364\354\337V"
+	.ascii	"h\307\024BG\303Fm\231\204J\334\222S\263"
+	.string	"w\307\254e\024\343\332zx\333F%^\231\223\234\302h\211\326\214\240\271\024\177\265\251\364\263\003\272+\207\207\275\313\306\265U\375\217\021\3428\356G\233\266y\007y\267w\350\356\026\335J!\001\276\305.p\307\233\347\246\370U^\326\201\242\230\346\353\346`\377\334\226\032\3478w\034:\246im\236k\262\367s\330^\033\351\327\351\240\367\334\rB\304;\332\347,\037\322\034\355\356.\267\342t\276\252\017\037|>\300\306\261\364\252\204W\361\202\343X\272\200\n\264\315\204U\225\210\273\355,\262K\361\026I\224\314\"\025/\257\354\033\363\237Z\366J\316s\335\327\350_)\232\325u\006\322\235\345w\356\r\260<\212\373\225_\335\027\374w\225\013z#\360?\357\346\177S\375\367\324\373\315\374o\251\343w\024\362\373\300\177\033\200\277\241\220\337O\377\355\004\1777!\277\231\376{\t\376VB~'\375w\001\370\233\300\177#\375\367\321\361{"
+	.string	"\362[\300\177\007\200\277\215\220\337E\377\r"
+	.string	"\376&B~\017\375\267\020\374\035\204\374\006\372\357\037\370\333\007\376\356\201\277\227\360\267\022\376N\302\337<\3607\022\376\206\341\357\343\361\373=~\273\357w\373~g\367\373\337o\177pDe/\r\2375Lf\023H\003\362Q>\312\351\rzx9\256\005qO\253\037O\003\262{y\263\223\315\360=\250\002\214r\200\016\017\367\346fd\307\341u\344(\"\312"
+	.ascii	"6\374\r\0335\210\356d?\374\224m((\013ix5\0323\202B<Z\205\253"
+	.ascii	"\376\030/\303B{\001\303\353h\030^w\2012\022\035\026\237\374\223"
+	.ascii	"\375\354N\3317\232mA\200\361\314\302\276\264\351\223\235\361"
+	.ascii	"\2551[\225\261rO\232\2742gw\334\226y\316\327\214\240Qf =y\251"
+	.ascii	"\365e[\216X\375\350\323\017\261\037W{\262#\322i\371\035;\214"
+	.ascii	"KF\273\334\214\323kR\231\223u\266\0341\373\3647\213e\224\331"
+	.ascii	"\0215\370\0349q\222\331?\244\321\206\207'#\341(&\362l\3607\207"
+	.ascii	"\206H:v0\022C+\022\316\3076[n\210-|:\233*V\f\026\316nX\330\301"
+	.ascii	"\t\267\326\2509f\215\270\0341\204\363\\\277\331\315\036\004\r"
+	.ascii	"\227\023V\317<]\r\326\f\227\352\233\235\220\316\203\223\341\262"
+	.ascii	"\032\363\244\022\323\344f\267\3626\307.\257\354\033\0330pH\341"
+	.ascii	"1\347\354N\313\244\331+\224~\0350N?\304~y\272a\325\213\232\t"
+	.ascii	"\037\323f?,\344\342t\200\335\362dP\325\302\304\346\354p\336\344"
+	.ascii	"d\003\3755\302)\tI\354\253\213L\305s\351\345c_d]$\236\024\204"
+	.ascii	"Jx\221@\0016\341\253\313+\354)\2464!\326\245\225\342\004\331"
+	.ascii	"\b\270\235T^_\316\246\223D\023\205W\327\211\2463L\254I5\324`"
+	.ascii	")\236a\31510\260\260f\362\032\373\236\303\1775\352\262\211e\371"
+	.ascii	"\005P\236k\344\020\237\254\354:\371Ns8m\034\307\361\217\373\212"
+	.ascii	"\267\231\263\262\215\2677{l\374\250/\276\361\263\370\344\271"
+	.ascii	"vC\253\233\263\301%V\036\263\026\236\r\272\216\305\021$e\246"
+	.ascii	"\374\224\017d\251\314\234\312T\271\033jG\205 Ou\275\2403\020"
+	.ascii	"\220\331\227\315\213\312R\371\225\003\354\342\307\305\354{B\361"
+	.ascii	"\035EeO\002\347g"
+	.string	"g\344\243@9\220\213\240\262\001\275<<(\277\354\222\177\342\344)\0275e\247&V&MP'\277D\tS.R\312KH\352\216(\375E\370\"D\222r\021\201\\`\310\226\002\354\323=\255\252_u\302\022\310\316\005n\n`O\236\353WJ\271\003\261.\236\r&\231^\225\323\272\227\036(\017\345\242, \037\3456\367\007\201\342\035\177\220I\244\336\305\261\231\243A\365`3\020P\356Ve\244\334-a\302;Z\2671\\\216v\203\034\200\370\250a@e\021C2\"\"\022$)H\222\0160\003\021\321\2509\021\260,\206\230bh\256$u\036{\250'g\364f\330\224\020\230>\\\003\330*g1q\253Y\"\310T\212\256\327\3622\013F-\237t\350M\206D!\245\3735\255\311\213\376$\207\t'\005\020:\f\213G\027\325S}R\324\222\253\203\202\260\376{\006\263\r\274J\236\001p\322{\317!\266\201G\3113"
+	.string	"p\356\272ka\022\335+\356$\327\002\301\323]\262\3058\350\001\367L\336v\360v\320\204w\311\201\250%\331*\321\371\326\240{\205\312MA\302_a\032\300\244h\203 \350\003\302[c\005NnZ\021}\003\270\204l\200\004 [\235\017\224=\374#\241\005\311F"
+	.string	"\344 \327\373\325=\200\233XMZ`\254\344C\221\340\312'\035\345\321\252\321\013\022\326k\306\341\004\017\027"
+	.ascii	"gT`Hc\244\316\223d\245x\307P\332x\225\"\001\335\276\212L\262"
+	.ascii	"I\202\333sW\201\2043\027w\330l)\277\211\241\f\027\024Z\302\310"
+	.ascii	"\212\363\270\3038\273\222 s\251dV5\206\227f6\211\220WNp!\361"
+	.ascii	"\327(\024\322\207\321\352\241P\354\350pY\276\034Z\231\207\300"
+	.ascii	"\nz\004i\207\360\007\275\2715\235\013p\020\354\201-\020F\326"
+	.ascii	"Br0\033NP\346Wk\240\214r\2671\312\007ed\270\325B\310pXv\265\273"
+	.ascii	"\001KN\361c\311<W\316\200mG\370b\272'\370\273\241\236\357\216"
+	.ascii	"\222O\356\265\270N\206\035\362q\241d\323J-\315%\315c\240>#>\254"
+	.ascii	"`T"
+	.text
+	.section	.gnu.lto_cliSerial.207.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`c\013\315<"
+	.ascii	"ZhD\027A@bR\007g<dLi\344\330Z(\203\217\235^0\335\246[\354\333"
+	.ascii	"=\005x6\230\340\031\004\303U\030\344\343O?\350\327)\317A\201"
+	.ascii	"\350\210\333\017se8c\367\376\377\347\235U#[\333{'\231Rk\001M"
+	.ascii	"\001^\001x1\334P\34700x\340t.a\236\311\262\214<T*\r\264\314X"
+	.ascii	"\346\277\354gq\324*\331\234\253U\305\252cqz\226\036\0035V\315"
+	.ascii	"g/\334\027l\035\225\273MUt\027\252u\334\355un\305\351v4|(\347"
+	.ascii	"8+{9W\021\364\200\242\273]u\243\327\335\242\023\275\356\266\263"
+	.ascii	"\373N\322\215\374t@e+\333R\230s\256z#\335z[\365^\302N\177rjb"
+	.ascii	"\002\260\244\224\204tdTD\304\034Z\n)\223A\310\243\261H|\335\366"
+	.ascii	"\261\263\375x\366\364''\242\025\332\025o\242c\302\344\177R+u"
+	.ascii	"\030@\033\364'\245k\033\360\245\341\245\"hU\\)\311\ri\355\210"
+	.ascii	"\311\0346J+\332A\244D\0163\351\242Ct8\226H\236H\217`\241/j \301"
+	.ascii	"74*\256$Z\305Q\375\b\276\241Q=\331\032\310\362\355\361?i[kd6"
+	.ascii	"\007\365>6\034\224\304\355]\346\234\375M\272\366.\245KZ\244\332"
+	.ascii	"\261\235\320\367\303\314\373<\300\237TH\213\345\344\b:\237\007"
+	.ascii	"x\"\245\303F\\\305\213\001\336\320\2028\321\377\244A\312\360"
+	.ascii	"\373\303\335\226(-/PyF\326\036\b\204\"\004yv\003\267YT$\202o"
+	.ascii	"hv\376\255\20165=\224gc\255Q\033\270:~u\034=\023\303\230h\225"
+	.ascii	"sn\f=C\363\206\362n\274\241\273\311\272\215e\0011^\001\377\317"
+	.ascii	"7\177\2360\324w[\270\200\035*\340q\234\301?X&\r\034\260C\241"
+	.ascii	"\036j\2013\375\323\023\001\277\300!\213\"\206\017[\t\007y\247"
+	.ascii	"y\251\334\365\374\032Cy\004\332\335\301\003\276\363Q\355\223"
+	.ascii	"u\2619\330l{\204\333C\274\016\306\323\220\300F|\201\254~u9\333"
+	.ascii	"8\343hD\264+q\267G\220p\333I\274\356\036\360\356\022&\260C\333"
+	.ascii	"\361\006\371\260dm\325SF\344\177\332.^\377\023\3269c\330O\013"
+	.ascii	"a\246\357\306\322\302\016\365\367\253g\340\221-\314\216\375\263"
+	.ascii	"\273*\206\177\332\355~\347\027\347\254?\256{\201\002\027\343"
+	.ascii	"M5%U\200@\224\343y\013\360,\336POG\334Nn\347\316T\304\034Z\n"
+	.ascii	"\271\026oe2\b72\b\3671\b\267\321\271x\027\215\270\211H\334\357"
+	.ascii	"\021\267k\304\335\372\236\367\027qc\"n\217\320\264\306\n\250"
+	.ascii	"\205\332\366p\252\331\354\020P\306\272a\230\270\030\367=\367"
+	.ascii	",\356Z\334\271\270\343\271\3479\261\333\273=L{_#\305\204\305"
+	.ascii	"Q\347\\\271^;_#\367\210\326\353\236\211\027\256\327\177\366f"
+	.ascii	"H[]\316\031\211\335\352[\374\316\273\370\265\221^\374\213\323"
+	.ascii	"\363\300<\243e#\226*\227\315Y\n\002\033\344Dom\312\224?m\313"
+	.ascii	"\377\346Os\\\326$\177\332H\017{\215\357oV6c\330O\330K\365\306"
+	.ascii	"?\002\004\003\206\254Ml\320_d\261O\034\250\333\357\206\0217A"
+	.ascii	"~:\001\235\020>\355\205\330{\314\353.]\016=\215\300\260I\036"
+	.ascii	"\222\247\b\273\373N1\347\247\267\271\017\311\324\302&9\347)w"
+	.ascii	"\231\357x\204~\330\033\330\020\003\362\341&E\376\264\211\337"
+	.ascii	"~\263\351\202\316i1\3471\t\355x<\3534\322:\2218\345^\247\334"
+	.ascii	"\353.\361\215a\234\376\345`\325\363\363C_\361\272\357\364\215"
+	.ascii	"\313\202\270O\365\370Zf8\205[&N'\330\241\356CM}\373L8\2752RS"
+	.ascii	"|\320+a\341\361\247o\\\352\037K \241U\316\220\324{\237\017\025"
+	.ascii	"\022N\371\264\274@'\306\2376\346s7+S\233#R\371\177\024\277Q\256"
+	.ascii	"\343.\315\216\030\365\312\217v\373&\037\023\013|\321G\333\213"
+	.ascii	"?\205\343\311/\360J\300\274C\2626\f\305\257N)\016\035$\360\370"
+	.ascii	"\231py|\312\f\231p\024\201\367BB5\354\330?\211?\355\246\273\264"
+	.ascii	"\035\256{\330\253\274\003\262\243m\017{\223\037\235\361F\375"
+	.ascii	"?\003\241D\341'\252\223\016;4\352\335\f!\020\354\330\353\264"
+	.ascii	"\342W\347\025\24389g\b5\326\374\372\004\261\201\017\325\304%"
+	.ascii	"Ys\003\255\"\001\327\325VS\353E\225\327\026\222\f\255\254.\r"
+	.ascii	"Z_W\037\262\300\256N$\267\274\351\325\342\230b\013EW\263\t\206"
+	.ascii	"\225\374\352\002\363\262\360\325\245\305\002,E\263B\326\026\327"
+	.ascii	"\025\ff\363\253\305s]\301x\255\256-\256,\026X\304\306J\260\305"
+	.ascii	"\205U\205\205\242\252k\353\212E\025V\363EU\202\242\366j\241\325"
+	.ascii	"\254\372\362\362jV!\2536x\270\225\215\027s\036O\f\326\372\372"
+	.ascii	"x\226M\235\031'\2606\3477\n\236\347\236\315\202\017;\002v\277"
+	.ascii	"\2468\002x8}`\207"
+	.string	"\266\324\036=e\236rtM\016p\2673\315\251\206\257>\204\267g\rV\354\237\007\344H\231\302\264\264\374>\032\227_\374(\316^\034\360\2643\305\272f\020\300O\333\255LmNi\301?\363\243fwjvJR\337E\345\017}\264\225\204\276\333b\321/?\312$ \030H\307\335\333\234s^\"Z~\037-\277\333\344\322\331\356\244\314%)\370n\227\313\027\372h\367\001g\376\202w>\357`\275b\245\345+x% \2322\001\254\262\033*\236l\256\346)w\3034clIlvl`\220\216\222\036\366\"\r\221\217$v\306\257\217\024#\267=\266\274\"\242\237\266\353>\353L\331\343\216\267'\215I\204m\313\320\262\365\260\367\370\307\251\376x\230\307\035\2170\220\020\025\234_\303\220\242\254\031R)\220\t\200\351\250Q@\304\224S\204fDD$I\222t\240\002\221\2412n\021p1T7%i\215\345\311\203bC\236"
+	.ascii	"YR\361>\237\0253\004\3408\373HV@\t\260a\372u\21421\265\206@\305"
+	.ascii	"\372\335\350\035\363\"\004C(\242{idG\202\204\b[H\262JdC\n\215"
+	.ascii	"\034\357\355\027\305=\034~Gzd\214\335\235\233\206\260\202Q\334"
+	.ascii	"{\324\023\272\300\237\305\236e\330%\365\217R\362\n\355\016\261"
+	.ascii	"vU<\355-.\351\213\363j\3278JSr\246y\002q\252\237\244\351\007"
+	.ascii	"\316\370\217\364G?\374\374\001\234\275\337\301u\276\364*\322"
+	.ascii	"\247\250\246D\221\375\321\347\205\3621y\275\252\234P\301!\275"
+	.ascii	"\247\240\r\327!k\217V:\362&\207\326\366*\305\265\037:\343C\236"
+	.ascii	"h(\b\rb\204)\331\313\033\331\213\001\227\210Uw=\036\2547s\203"
+	.ascii	"v\3665aJd]\252\375\211S\265w\2356\230\255m\306\031T\017\244\033"
+	.ascii	"\267P\371\3551\223?\243Y\266\254\002\300w$\333*C\222N-*<Lb8\371"
+	.ascii	"\230\2245\020\304W\217\226a> \246\226\237\357\331R\354\"\307"
+	.ascii	"\035u\027\222B,\223foK\n\202S:\302\360\032wI\200\034\006\223"
+	.ascii	"\244\030C\237/Ql\242\203d\234\004\206\231\002\235A5\302`\322"
+	.ascii	"\231p\\\025\302\311\225\"\003\256;g\336\314\200(\2736\302\205"
+	.ascii	"\274\367\017\016o\355`\372Z8<\301VP,\352W$l\235\301=\224@\\\373"
+	.ascii	"\353\032&D1a\035\303\f\373&\337\315k\274\273c\204\034\256\366"
+	.ascii	"C\336Y\223%\335\240d\356\311q\202\251V\243a\314\341\200j7\265"
+	.ascii	"S\023\204fQIv\253[Th\036Z\250\001"
+	.text
+	.section	.gnu.lto_cliSerialPassthrough.208.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\310\rEK"
+	.string	"\352\201(\035R@PJ\352\252\357\312\030Q*}\217\221\n\021\003\036\301\214\222C\207,\200{\214\261\325k7*\346\255-v\344\251\233+#^,\257\360\302\374'K\304\270\001\273\260Cy'\267\270\t\277\033\0062'i\266\314\3177\267\352\035\2004\021\317m\367\336I\246\024\310\001\243\001\262\001%<ce\2771\367D\233\346\034u\341J\251aDu\203\201'\fIrN\323\300=\253\301\004\363\304r\201\013\376\344u(\315&\264\021\315W-W\fiY\002\327Y\341\352;\255\223(\234\374\226\375\352\013zcj\024\245\261\346\036\321\214\325\243\202;\023\233\3139*\344l\013u;\356v1\207\276>V\303sr\356\202!-\347\250"
+	.ascii	"-\302u\266\243\016l\235u}\247u\266\337\3568\016\310|L\361\034"
+	.ascii	"S>\231\3139\027\375\t\275\253V\253U_\243\336>\374:\220\020D\360"
+	.ascii	"\307\347\203\207\016\034zx\200\277\035\235\034\034_\217wcSC\343"
+	.ascii	"\356Zv}\374\266\357\214\216\016$\004\332\302\212\342 vFXP\017"
+	.ascii	"\372\024\231\377@\307\260\217\230\177X\205Z\244J\020]Zt\016\306"
+	.ascii	"|b\017bLp\207!\224H\230-,2\347\3604\314\211\205\365\254)\226"
+	.ascii	"\334\250\342o\314\026V\233(T%H0\317\021\007\2761\217\254\302"
+	.ascii	"\234\263\2031Q\300\277\035\027\034\334\316\212\0029\367\303\337"
+	.ascii	"\230_\353M\235R\006\007c\032\301:k\210\037B\246\370\0333l\375"
+	.ascii	"\351\322\266B\316\033\223\b\030\263\b\306YwH\253#\376\306\364"
+	.ascii	"ZY\324M\327\220\3307\004K\313{\274\346\315\0175\007\002c\002"
+	.ascii	"\3016;#,\023\274\306\004\232u'\213\212\027\177cf\255C^\224\370"
+	.ascii	"p0\246\017\354\266\250!\205\335\316H\315\035\340j\2136\275\365"
+	.ascii	"-f\017e\315U\262\305\001\332b6Wv\351\271%\314\026\226\226\257"
+	.ascii	"-\327\22641\272-\2543\3775\200\346\226\035\275+\033+\220\013"
+	.ascii	"\027\030Ws\\uE\205\361\316(\347\334xy\205\345\035\302\2731\215"
+	.ascii	"n\017v\333\210\bemT\345\016*\\\355\236\201M\211\n5\357\234\301"
+	.ascii	"\327\307c_>X\337W\b\202\374\243w\364\350!J(\223B\363\316\366"
+	.ascii	"\032\355\277\203\371xi\300}\300M\032I8\013A\004\330\227\377\030"
+	.ascii	"\216\252E\212t\303\342\342O\361XNyf\nW\361\177\224\312\026\203"
+	.ascii	";\034\365\312\256\007\377\276\233\002\013\260/U<\236R\311\244"
+	.ascii	"\256\305g\210I\217\330L\207\221\343\322\325\276S\332\316\005"
+	.ascii	"{\263\265\316\202ik\001\202\344'\rIr\220-=\324qn\316G \243<\346"
+	.ascii	"\331f\302\263tw\234{\323\365\312\314\034\315&\234\005\376\215"
+	.ascii	"\3313\215n\212\304g\336\354\005$\223\375a_\363)\031\374\340r"
+	.ascii	"\316\276\3645\177a\203 \270\234\223\276\344\300M\026I8\333\301"
+	.ascii	"\021\366%\320\3433\252\022i\222\205W]\334\332\303\335\304$\354"
+	.ascii	"\313\3663\252\016)\325\3171\013\223o\031\255\277\213\262/6p]"
+	.ascii	"\333\340\237\357\366 \006\366\245\277\253\371\002aynj\343\217"
+	.ascii	"\335\321#~'[\0216\257\376\256n\026+T\244@qB(\310\243\336#\200"
+	.ascii	"\202>\346\376\343N\274y\034\2127\320\317\274\177;:9N\305\033"
+	.ascii	"\307\327\343y\232\367\315\343\266qq\327\270\025o\232\035n\367"
+	.ascii	"q\357\034w\353\270Y\307\275:\356oqc\026\267\267\240\361\303*"
+	.ascii	"\307\225k\251\346lU-\223\245\354\032\022\217\272;q\207\342~\346"
+	.ascii	".\305\235\212\273\025\3674w\273\335\233x\231\233y\024\237\342"
+	.ascii	"U\034\315\325\332&\255\331dxV\231\346\234\227\254\314X\363\031"
+	.ascii	"\002O+I\222\250\004\320\036J4\340{\211\266\327_\360w\276\n\037"
+	.ascii	"]\350}\254N\020\"\246\313\t\334\376\002iw\236\346\333_\255\266"
+	.ascii	"\375\025\322r\275N\354K\241oa5dK\316\372#\317;{I\033\250\300"
+	.ascii	"\357\242\363\340\177\2231de>8\334l\370\365\020\3665l\343%\362"
+	.ascii	"\343e\304M\372\b/\n/\022\270\272\254\035\263\314r\347\235sN\363"
+	.ascii	">V[\\\304t\021\321\324B\247\023\325\356\336\317\244\200s\324"
+	.ascii	"\212\366\352\273\344U\342\346\234\375\313\331\035\013D\306\246"
+	.ascii	"p\225\304\222-\270\234wv\373t>\370U\355\363=\215\217\367A_\325"
+	.ascii	"4\332\021\377\3071F\312h\b\302A\337\375\262\360\206a_\216xv\256"
+	.ascii	"NG\b\034\364\276\346e^\250\357%s\223>E\302\200"
+	.string	"\003\260/\033\233\221M\351\246\310)\316;\033\352IF\211\326[\361\303g\026%\332*\344\300\257\n\341YF\211\326c\341;\314\236\315\025\350\1779a7\254\335\263R\206\305\255\3553Z\337W\365\332\273\371\033\263\260\266\225\310y\277\367\312A=\212\351\262\346\234\263o\275\301y\262\034<\024\337;\235\357V\347\233\325\371\034\337\367\312\363A\207\354R|\267\276o\326\367\275\257\352\033\3367\217\367\275\356x\317C\371<\323\252\370^Y\336\337|U\b\315\257\0336\3601\315\257\366\004Z\026\357sT:i\362\217=\344\300_\361\27327\267d\323\261\270c3=\354%Z\234G\361\275273^\033F\252}6\215\352&\275yg\273\232;\020%4\256\346\304\367J\243\3638_\305\306\201\300\272I\221\177\264y\247\227hu\376\304\367\002M\364\244\004E$.!E!\t\215\304\031\305&\341P\022\223\322\320x4\303XT"
+	.string	"\250\370$\034\006\tc\024\215/\204Cb\022\323\021\f$a\260\211\242\206GD\343\322Q\257kxD\303 \341"
+	.string	"\302!\"\023\261\251($\272\020>\025\231\204\303%\031E$`\023\t\243^(!\021\233\234\204CC\242Sq\t\211\247\205\303 !McP\3017\324\3237\006\023|C\031\277\205x\250\204\2072\216\\\254\304a1\306j|j\"~p\344\264\363\240\370\364P\304!\223\022\353#&\0359Y\360d,J"
+	.ascii	"#IF\321\b\243\002'\247\243\246\037\221Iii\030\003i\327HDJKHE"
+	.ascii	"H/\212\230\224\216b\024!\031\235\212\210~]l\"\032\213\236\212"
+	.ascii	"Ec\221M4\027q\243\251\247\362\"@\357\354\277\212\363jB\335\004"
+	.ascii	"\220&L\241\fP#J\264\237\335;\030\250\017%\032\007\241\347\251"
+	.ascii	"\261\346\274U\300\324\t\256\366\002\030wy\273\224\230\226\347"
+	.ascii	"m\276[JN\212*T\376\261\033\013\301[Q\355_-E'E\006\373R\212L\353"
+	.ascii	"\254\315\3274\275\320\365\230\302U-)3@\251\252\233t3%\310\360"
+	.ascii	"\030\302\261#\013"
+	.string	"\304;\177\274ZA/\007k\272\315\215\231\302U\351\033\223\340;\177\260\322k\336x\304>^\255\232\207j\272\205\371\020\200\203\277C\276J9)2\370.\217W\204\236*7\351ma\244I\035aj\037\336\331\301w\337\213\224}\301\201w\274Vx\252\351\275r\037\200\232'VO\017\357\224#+\303zu\364\220\340&\035-\006\340\262I\355\020\002\323\274\257a\253\227\007\020.\254\356J\317\224\334\026\207\021^\036Yn\322\271zfW\244tSv\371\205J\017\215W\201\013\250q$\003\225sHHDDDf\222\244\003!\005\304(I!\274\r\021`\271dE\244Is\024\300\217\351\377\210\253\210(\341i\301\274(\f\323<\273\252\217\247\222\323\300>\243y\3034jE!iU\255\304\352\016\272\321\223K9i\337\303\234\2321\021\333\346\256C\346\251\034\304@\244\344\2343\005\231\351\001/B\375\302\223\034\212\222\251\344\317"
+	.ascii	"a\256\013\275q\007\260\264"
+	.ascii	")<\004$\030O(\326\037@\001\360\363\023\314wr\016o\335\031F[\256"
+	.ascii	")\273\234\006];\210pE\002ygZ\340\013}d\370\271\325\3607<6G\320"
+	.ascii	"7\237T"
+	.string	"\016\251H\377S\224r\231\325\336\206\232\235\2642\266wN\177\264\210\025Lr!6zvs,\235\032\0224d\"?\211/\fE\005\177\344\003~Y&\\B@\2651\232\276\234\236G\347\213\006\252\231;\335\276\006J\231\033\031A\003\364z\224D\214\332wm\024\375w\324)\024\277\327\003\221\002\332\216uH\271:\261\307c\27567\217>\217\327Lm\262\245\340v E\222\376\222\024a\323\030\030\237*I\276\224jr\275~\037p\225\3744\242L\336\361#\243\247\326\276\261\365\301q\374\370\271\346-P*e\024\266d\236\215W\262f\336{\006\031)\241\241\242\004Ut|\240\344\227(s\225\343:r\202D\243\234\211\261\324uoV\0208\347\220\316\303\213$\323\201\27160\376\363\362;a\212P\326\r\334\2118\356q)\\lp0\247\247 \302Vd\221e4&\016\031\236\340\0379\230?\nf\005-`\002P\246"
+	.ascii	"0\303S|U\263\036\210\224\b1\017\332\222b\232\b\177\200\262\365"
+	.ascii	";t2\317\005\251\211\223\300\232y\254\003\251\033%g\234\026\362"
+	.ascii	"\0329\327\313\365\213\225\361^$@\205\fr\226\221\034\230e\243"
+	.ascii	"\267\027>O\240\243\236\207\254\344.\r\267n\004\240\250j\353C"
+	.ascii	"@\320\210\302\317\302\270\267\215\260\333\255\307\350\202\326"
+	.ascii	"\200|\316\200\024\241\237M\013\255\006"
+	.text
+	.section	.gnu.lto_printAdjustmentRange.209.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`q\n\3651"
+	.string	"\352W\f\023D`\332N\007{-\232[\264\372\227\3405 1\377_\350Md\022\310\242H\302\334\332\007\324\223E\270n\371\372{\232\002\300\317\340>\341v\306NgXJ\277\200\302\224Z\001{\245\224\353D\320\020\"\367\336)\245\024!\001\370"
+	.string	"-\001}\335z\2352/\341\366c$t'\257p/\004\022\356$\255\204\221})\322+\343y\331t\362\b\017\263\214|_Fa\317\233f\337\b\023\355\0223\030\273\b\367\036#[\3456\322G\300Z\017E_\266\333.x\334Y9\274\367\351\324*c0\266j\2246\222\231H\242\325;s\343\365\020\260~\246"
+	.string	"\312\271dymO\317\356Y[5\366\316\332*\2733O!"
+	.string	"k\273\025\374\367:\251\370\335\373\204\342$c\253\f\306\\\bTv\303\016\334M13\222x\357U\276\016\306\351\364\331\234t\260\276I\332 k\216F\273\252\351;\030\267\215\220\327HnK\306\274\360\255\205\365M\232\002\2529\323\2521O\346`kk\033\034l6\032y\204\203\255F\327\324\360\343\f7\316\251\311pk\346+r\255\351j\332\344\374\213\321\200j4\322\036-o\203\355W\346i\2723\243\257K\003\252\331H\237\272"
+	.ascii	"\241\321J\332\321\326\310\374{\257\3257BA\273(\016\266\266v\033"
+	.ascii	"\341\336\313~\266\306\326\214\323\314\315\304\314j\314\307\036"
+	.ascii	"\001A\306\334\357^\262\364\3438\305\312\340\205\322\352\302\306"
+	.ascii	"\004\202!\3633\354\257\340\027|\372\244\031dm\256\262"
+	.string	"\366\373wsn\314\027Y\352\373[I\253\207N\3031/z\212b\276\370Y\356\r\373\217c~\206y\321\342\242\"?\0343\204\266\353\256r\320\320\346\006M\244\233A\3675/\350g\267\002w\246j\276\346\251\326k\226rg\003\356\254t\347(\353\f\345\316O\326\331\311\235\233\334\271\200;\023\260\316L\356\274\344\316J\356<\300:'\2713\222u>rg#\353\\\344\316D\356<d\235\205\334Y\200;\007p\347 w\006\262\316?\356\354\343\316=\356\314c\235w\334Y\307:\003p\347\034\353\214c\235o\254s\322:\333Xg\244u\256\261\316G\353l\264\316\326:\257\326Y\265\316\251u\376\325\331W\347\216P\264d,\260\310\035\225\367\362\274i\213hn\026\225\211\217\206v\363u\007\203N\273{\233}\226\301\330\344bj\225\352\211\236Y\303\006\3573No\333\207q\325\023\t\375\020\032\241\367r\246I_\200\231\016\372"
+	.ascii	"\215\330@\037\364\363@g\242?\226\254\347}\232\316\240\346'+\317"
+	.ascii	"\367\374[i\316\355<\317\267\231b\031f\024\031\246\235\357:\247"
+	.ascii	"b\024\300\353\210\001@\207\3639o\337\f\365\314\024\017q\336\313"
+	.ascii	"\271\030\245z\007\177\023X\030\305LQ\254\f\371q\r\275\323#\254"
+	.ascii	"y\270\233O\026\336|\202\016=\230\214~\347\005\221;\332<\022\214"
+	.ascii	"\315[\355\360\320\202\310\347\3404\223\342Y\201\032?\216k\376"
+	.ascii	"\370\235\243K\315+X\366\226\343sp\"F\2234~\330Y\343[@f\225\026"
+	.ascii	"\004\306\257\272j,W\354\253p\"\322\341-\205\371\343\262\256\257"
+	.ascii	"~\347\370cZUI \267\276UVOa\022\t2\210\226\242\325\352\217\234"
+	.ascii	"\372*\234e\242xb,\306\371'CM\377_]33$\357\013\231\237\201r\226"
+	.ascii	"\376\203/\314#\332\t\323x/Y\002\356&`0\266\214\367\336\346\321"
+	.ascii	"\352?\013g\031:<\177\006\337\340\333\257/\344\025B\233\001\374"
+	.ascii	"\245d\304%\002kI\304\265<r-}B\027\211\345\327\211\254\244VK\360"
+	.ascii	"\"\361\265\374\220\205\365\323\225\005\242\304\322\202W\211,"
+	.ascii	"\246W\327\227\b\254e\316\210\256%\005\023\314/,#_Ei\221\270R"
+	.ascii	"^}P\226\320Z2\225W\\]\312(\036\3362\221\305\245\364\332\332\342"
+	.ascii	"R\"\237\267\215\036.\257\215zc\236\321C\261\0373\272\367\336"
+	.ascii	"|\034\037\353l \274Z\347\214\206c\227&\344F\337{o\362\343\270"
+	.ascii	"\375\3728x\007\306\f\212t`$s\207\305\f\372\334_\353T7\212U\352"
+	.ascii	"!|\357\265\205@B\303\246\323\307\215\036\351\227\276\351\237"
+	.ascii	">J\371\006\236\271\202\201\251WB}T\007\177\001E\347\364O#\034"
+	.ascii	"\315\351\037\270\035\211\026\370&\002_\200\351\t"
+	.string	"d\271\213\026LtxJ\2774\340\225\336\3234\347\222~\300\2257\231Jr^6$\230\364\035\303M/z\364HK\037;\372\007n}txEo\364\353[b\024\017\036\006\243(\305s\353s1\233\217c\257q\352\206\27334\203\036\237\232\352\321\230}<\347u\336\347\003\274\200\037z\251\347^\304`o \006\200\277\250\2014\245\215R3\"\"R\220\024$\031\306\260\002\221\251\242m\003\021\3208\347\240\232\t3I\n\327:(L\032\006\316\270\304$v\241b\013^\3051\272\273\350;\273\272q\203\021\302\377\342&\303\255\342v\227\005\372\376\362\021\264}\213\261g\376\223\364\237\275\321\034\267m\314\035V\370$<?\2073\270\257\315V\323\364\3424ifE\260D\232\215\3267\0017\034\217pt\250\217\205o\340\240\032O2o\266\r*S#S\366\337$k\246V\343\235\230\263&\260\346T\353\301eB\274]\026J"
+	.string	"\346\220\203(\367\223\345\2142F\352\004?h?\220\211R!Gm\236\356\247Bbs\363\316F\035\021U\3678>_\311\221\320$^QB\024\004\314Y.|o\313{\t\316!\256\210d\242\212\022\336\260[\016E6\212\225\b\362\263\241\311 \273wP\214\262~\252[\343k\302AT\235~\220\200\323\240\370\245@\205\200\327\217\337\305\330\365\326B\322^\032Y\211\344N\037\337\342\00218\220\222\366\275U\265\307\240\3655\013\005\237"
+	.ascii	"\243e_\310\r@\266\316\024\226\f\252\270\356\252\342\200\254\023"
+	.ascii	"\216\311%O\006Z\361A\350\330\255\351\006\203\230\206\342\245"
+	.ascii	"''\370\002\200\223\370Bj\371\030\337\202&-\232(\245!\236G?\335"
+	.ascii	"\323*\250e~\272\217\233\217=\032O\260\221\223J\363a\004\375\003"
+	.text
+	.section	.gnu.lto_cliAdjustmentRange.210.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\f\001\205\r"
+	.string	"\206Y]E"
+	.string	"\2216\035{$\030!!\300\252\203\213O\200\212g\020|D\304\211\214\337\230r\3002\267m\324*|\373/\2659\204\275)z`H\006\211\003\210@k\375\277\274/\034\003\367F\356P\374\333\366\334Z\333{\357\224\002H"
+	.string	"F"
+	.string	"K"
+	.ascii	"?P\275\332\263q$0\331\320\003S\211\020\247\035\273{\315\024\367"
+	.ascii	"^\351\224\236\177\323\001|a\350U\203r\032 D\371\244\fP1"
+	.string	"t\f\bI\224\003\256\370n\272\024\021\216\244\264\"\354\256\345\027\216\270\253\333\236`[\202\375\221\026Gr\242\260?\307q\034=S\354\267\374uJ\337\372\211\025\360$|j\334\005G\036+Se\250\330\303E;01\203\305\356n\276\261}i\237\345-\274\267|x\201\335\024\0301\273b\003/\320\274Z<\247z\325\004\363T\332\025\375\273\213\375\361\027\013\226\351\244d\203ew!\234\376B\363U\274:\303V\375\255z\375\270\315m\220\377|\230\0365d@\2744\203\212\231\356P}Vpq\203$g\\\311:\355\022\016\362\337\247\200\227\034+)\024i\206\034\276\320\371\200<\331\006\372\224`\020\t\001\301:\005\231G#\021\3310\313XG#\301.l\344\362h!\333\205u\237\253\203\300\234\206\254\273@\034\327]\033Qt\272$6\205\022\315\021\335\335\255\006(\200\310\177\246\222\206\t\250B\tH\037\253\356r\230,\026"
+	.ascii	"\002J\212\f\177\033\255y\177C\353Z\006H\t\275;1\315\200+-\203"
+	.ascii	"<\233H\017\034\032\310\302j\267_\260\257.S\356\f\325\254\256"
+	.ascii	"\214ky\247\220MM\256q)("
+	.text
+	.section	.gnu.lto_printMotorMix.211.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\202\b5-"
+	.string	"\252Q\320\021Gp\230N:\331|S\317\3723!j\037\204\306\301\317\210\212c\317\373j3\265?\001:\374\2014\224\205\314\206\023S\267 4\271\373\036y\213\304\222\343|^\274\347\031H\326\037\037?-\200fiB5bd\315\022\271\223\f\n\001\363"
+	.ascii	"\020\001\321\247\337\255\373\030@\242?\372\356}\036\325\003\213"
+	.ascii	"\351\237\366\265\267\035\312D\267/%\266\035%\324\240\322\313"
+	.ascii	"\225F\235DD\374\354hR\217\002\365\273\274\252^T\254\357\336\254"
+	.ascii	"\004\0072\b9\"\227M\261\320\226\371d\177\"\365g\024P\316\255"
+	.ascii	"2\213\241\340\371\236\340\201\352w\202\007\262\265\314\017$H"
+	.ascii	"}\354\005\367\275_mT\356}.`#\365@\226b\036\003du\247\"D\275\230"
+	.ascii	"hj\356\275\306\366\301\352\323\347y\265R'\256CU\030\004\246m"
+	.ascii	"\245\370\320\0279\371\314\362\330\264\246NL\2052\262\274R\nd"
+	.ascii	"\370\272\376Fe\327\036[]\037\n3\200m\341\270J\004\266\305u\241"
+	.ascii	"\221,.\033\304\321b\246E\273[,\255\245\005\246;8\334\360n\227"
+	.ascii	"\205#U\200w\244\213\250ee\323\264\202\023%b\307r+C\253*\355\262"
+	.ascii	"\264\270\033\311\362\262\375\267\003\233WT\306\374\300\266\272"
+	.ascii	"n\205\031\356\275l\257\264\266\3167g\346;fv\302,\204\013yim`"
+	.ascii	"\330\277N\223\341\027\355n2?\247l\207E\321\304\350\342\016c6"
+	.ascii	"~\354G\360\271\263\321\267\234\213Nw&z\335\271\370\262\237\300"
+	.ascii	"\255\234\207\016w\026\272\3349\350\317\177\200\265\374\363\350"
+	.ascii	"\331\307Z\356Y-\363\254\226wV\313\002V\313:\326r\316j9\300j\031"
+	.ascii	"g\265\f`\265|3\264L\034Z^\207\226\207C\313\352\320\262ph9\330"
+	.ascii	"\226\201\252\345\264-\267\320\262\025Z~\004\004|fwg\321\034\235"
+	.ascii	"\367\2743\376\330\334.\300\267!\237\373\267\374t\177\335o\345"
+	.ascii	"\207\373\345\376\350\037\345W\373\331~\267\3370\237\371Y\370"
+	.ascii	"Z\316\345]n\307\304\272&_tc[\352\026'\267\232S\026\253\236\027"
+	.ascii	"\bN\023\253oL\215\213*\374+\217;\026&\312\tyR\341\224\351U;\221"
+	.ascii	"\350\020\"\367^\244jEi\353\220D\225\364\335{U\\\n\377\215\211"
+	.ascii	"SNE\352\001\274c\177\367\264\021\352\225Q3\223(a\177u\323\337"
+	.ascii	"\343A\243\213UO\005o\250\335L\353\276p)\"\354\2604'\266\206\265"
+	.ascii	"\207Ml!(\223\313\250\207z\355!4\346[Q"
+	.string	"\013\365\260\007@\231\277\r\263\275\266`7\271)\2506\016\236\231\260\203\255\266\020\312\344\"\352\240\0266\020\224Y\354\264\203\375$N:\263\274\2647*\373\207\306\250\223N:3\312\2439\365\212\310(\177\246\207\201\250\223N.K\310`\330?>\345\317\234\216\027\212\035\264G\240\201}\273\227hb\321-\221P\331 \314*6\200\335\344{9\201\016\252!\004\212\231;0H\027\2434.\030j\021N-K\222\036F\031\301\251'\344\307\274\364=\245Q\217\2013\250E8\343\226\220\t\271J\363%\355&+\231\331\032\245\2354\333\253\262k\230\031\305\361\224\005\234\367VM\340\177iq\034\322\003\022\325\005\304\310l\017\350\356/\221\344\234\347\202o\333_\032\241\262\177\354\323\357cy\272\306y\305,\2544PT2Plqlj\342I\246pZ\2117\033\240\220\242V&&d2M\221\344td\001\204B\212\352\343\0338x"
+	.ascii	"\341\304\223\211T\203\023\323\023\322\211%\245\237\344R\213\343"
+	.ascii	"Q\022\351\204<jB:)\237\222rT(\221\216X4=)\251\234\304\340\310"
+	.ascii	"\224dL:a\\qDj2"
+	.string	"&%\225F\006<\214d\261\2244:!\221I#\361y\337a\314\301\253\317\257\017FSEQc\373\241\322{\3010\334\355\207^\247\257\314\376\351 v\223\207?\206\306\0062\261\214\3652\351\275\367\256\335\374S\320\247\215\375\267{@\273\212[~\001Y\235\026\320;\315\223\340=\315|\324\003My\332\202v\326\204\004dy\332\220\216\316\032\217\"\026o\330M\266\302\004\307\361\022}\302\234\022T\360\237\306b\006\2627\r\240q:@\3734\333\251\016B\260\2633_c\367.\177\365A]^\354\300\201?\235\323\314 B\330_qz\275z\212\021tN\237\t-\006h#\302Y+\002\320E\253\236\n\200\242\250Q\\d\214\"35\"\"2\222\024$\035\260\002\031\252\2526\0208\246\254$\005\315\032\032\240ix\rx\003\3629\031\007\376\r\210v\013\261\222\232!q, \242\311 \t\021j-,\371\220h\032\230\235/"
+	.string	"\345\210= \260\033\200\211GLN\252$Q\352r\364\250\307\304\211@\017\034w\330\003\332'\345D\373$\244Y+mv\351cM\007\031\367\203"
+	.string	"*|\024\033\310\304C\262\213\262\005f\351\230\352\301\240\204y\357\341\315\2667+4\262\346\315b\325\f\242\227\311\357\335+\200%\376\0044\245\251\325\246j?\335\301wK0\350\003\254d\341\277\352\276\376\321\221A\261o\030\t\341i<\214\212\307[b\220\354kD\230\025\251\321RXo\323\357\332g\353\343\265\240\221\204o\"\342\316\247\265I\252x\027\272\336\306yx\320\2202\222<\235C\270=\024 \352T\270S\0013\222\023\270\341\222\361\275\240+\274\304}HXQ\326Y\204\271\336\344\240"
+	.ascii	"D4\373\322\351\027X\214\240&\326e\231\017'\360][\330K\255{&\330"
+	.ascii	"\b[v\365\303\260\240\002"
+	.text
+	.section	.gnu.lto_cliMotorMix.212.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\233\fMA"
+	.string	"*p,\031@@bN:\223\312K\215\221\377\356:\023\327t\302S6^/?\004\016\345\370>t\350rU\177\300s\337=\350\217\243]\360\237\201"
+	.string	"0"
+	.string	"%\022\225z\260\037\013\366\374\231\251\333\233\265\204\220\275\223\f{\001l\001\203\001{\326\f\237\206Z?\216\246\031<r+\336\314\243}\354\347]\317\375\231\026\374\333\366~\210\236\300B\352\373\276Y\305\263T\353\223-4H\323K\370\236\r.\260J}_\250\203\263\355\240\373\270\373\317\343\271'#\344N\357\013W\006\360}\241\017\032A\361lC\017\325\236->\331\236u\273\007\0058{\311(\004\002J\213\032\276\357\233\225\345\372\215\273\213mK}\205\276\221V\367\004\006H\t\b"
+	.ascii	" \n\352)\211tjbZRJ:\"\031\213\304\226\235Z3.\340\366\243\257"
+	.ascii	"\242K\244\327\207\217\215\354\004\006H\tX\241\360T\021tB\246"
+	.ascii	"\230\265A\223N\22208\300\335\001\334m"
+	.string	"\301QZ\016\245%\013~\302\362$\226\351\025\214\264r\247u*\217\235/'dZY\253\240L\351\273\035\223\0167\255PkZ\226'd\216Y\033P\003\023}:\207\231\316\334\f\237\325\2706'_b\2330Z\326\265]\251i\307|\303IGg\2234\317\352q\325\200wGwB&\2245\347\355\275\271\364\tFrr\243\364\007\b\231O;f\023\\$dFy\364\007\354\230n\230\270\022\2170\371\234\220\371\\/\020*tr5g\270E\252[r\266\270\344SivL<\274\236J\333\363y\345\320\227\307\312\022\233r\275\027(n\036=Vc3\303\030\371\002\304\016\357\373\366\001*md\336\006\336\215Kt\367\333\215\224\027!\234n{i\217\312\360aF\222s\223\302\036\216\332f*\303\265\203\343<\246\367g\n\263\017\321\036\315\tE\024G\024\321R,8[\302\004\376\022\347\247e\024\300-4h\376\326\354\354n"
+	.ascii	"\270\217\242\375\336\355\250\300\207\374\274o\331\227\337\353"
+	.ascii	"\306z\235\025\304f\221C\325\347\373\276\027\346\234\016\213>"
+	.ascii	"\226\263\335\302\005\333w\321\236\305z\367\013.\374e?\372\027"
+	.ascii	"\341\213\002\255R\321>\327\347%Ko%G\351~\207\323el\223\0326\237"
+	.ascii	"\357\213\366\345W\021\315\302\202\263\275\026\240\220\rd\265"
+	.ascii	"\034\3553\f=@J\274\250\223\260\201\334\rF\003\177\371\234\304"
+	.ascii	"\027\205K\225\252\314d\335P\263g(l#\303\331\331/p@\312\241#\235"
+	.ascii	"\341\272\267\264N\346\2470!\302\003\254+\006V\207\276\253\376"
+	.ascii	"\367\246z\021\367T\324\323\274\241\236\222\310\237y;\031q7\031"
+	.ascii	"q3\031q/\031q+\021q'\275\357}$\342F\"\3426b\334E\214\273-\342"
+	.ascii	"f\211\270W\"\356L\304\215[\334\327p\225H/\317\231\300@\271\017"
+	.ascii	"\364];l\364\016\262k\266\374\357\357\373\323\374\320\377\314"
+	.ascii	"\351\300\271\343\266\007\316\216\003\366\225 \267\037\007\354"
+	.ascii	"\023t\205w\32396Y\374\232]#\2456\237R\"\202\330\034\331q\276"
+	.ascii	"\336\242;s\327}4}5}<\233\246\007\225\022\372\262\035\003d-\350"
+	.ascii	"\354\254\211\370\036-U\316y~c\364\352d\252\214\005\267\260\001"
+	.ascii	"#\356\032\3762)\177\3723Y~\001\254R\225S\244da:\240Ge-\024N7"
+	.ascii	"EhM5op\202KkRT>f\2657b\263\2266Mjs1\253u[\300\305|?\254t\221"
+	.ascii	"X\371QRD\013c\3426\001\254R%\340\377a2\025\353\236\277n,\374"
+	.ascii	"\2568\0169Dzs\243P\235e\262>f\244|t6\351#\365\367fH\311\230o"
+	.ascii	"7\225\333<\301\210\374\023\007f\020-\223\365\017\337sZ6O\345"
+	.ascii	"\306inf9O\240\2744IY\370~_\344V\261\232s\235E4\256\005\256\234"
+	.ascii	"K\027\305\327\345\255R\225\004\222\340\335\035\345,i\345)\276"
+	.ascii	"\272A\306\013zTV+\3646\337\356\304\025\271W\212\357\253\274\320"
+	.ascii	"G\364Dn\226\325\335\342\326\265n]{\266\315\227~}D\267W]S\206"
+	.ascii	"\017\327W\001\236\360\305\005\203\277d3\216\023\367dPY\201p\216"
+	.ascii	"\025c\220vB\316y\322.\b\3341.\036\376rB~\334\222\301\013\357"
+	.ascii	"\027i1;\327\265\320-\343\241\210\326b\315\217\036i&N\311 \206"
+	.ascii	")\202\213\210\331\331F@\354Vf\027M\265\032\246\362\243t\310\241"
+	.ascii	"6;\337\243\205\312[9\031];Dk\232\341\303\356)\202\356\017\367"
+	.ascii	"\323Sc!\251\224f\205\367u\373x\237\025\307!{\316GE{Vk\316\260"
+	.ascii	"\f\0376T\316\371j\036\355\343\313\353\006X\3339\254\250\274\276"
+	.ascii	"\274\270\302H \365\227\r\256\033T^`5\270x\334\020\241\324^\\"
+	.ascii	"a5\330\326\361\225\343K\254\355\031\020\304\276|\200\331\310"
+	.ascii	"\3221C\006X\r\251>\330it}\315\350b\305t\340\310_7\300jx\331\350"
+	.ascii	"\"v\027\004\260\032]Y]1\262n\200q\331\310\352\022\313\221\005"
+	.ascii	"\341\251\303p|\211e\351\b\013\023\313:B\313\236\341\242?\021"
+	.ascii	"\2719\203e\331\354\200\224Ck\004@`\242\203\037\020\317\211X\340"
+	.ascii	"\007\310\030\2421EK|x\314*U\353\t\335\200\337\371\003\2613\260"
+	.ascii	"\033\013\303\255 6\347\340*r\317\004u\250R\037p\367\030\2431"
+	.ascii	"GX\215\\\230A\263=9%\002\3064\001D\310\275F%\363SV[\337\202\355"
+	.ascii	"Sa\200d\216\220\217\321\267iS\356\036;\304\315\3015oP\374\036"
+	.ascii	"4\3456\216\\\035\2000\177PX\271\327'dN>(s\365\340-\n"
+	.string	"\231\261\3621\n\245\017\023\031v\373\303\302\206\311\222:WL\271\375#\307\004*;\033\314\243$\203\334+\322)#\263\332Uf\313\376\256X]e\034G\016\311Sv\266Sf\220\217\321'Kf\270\315\260\r\033S\320j)\267x\342\034%\2477\336\261\021\2236u\302\372\243/\352\t,L\23369\270SV\263RTeUE*\345\356\017\270HO\217v~z\004\273c`\265=x\331\"Z\026\332\200\253\322\\\"\370K\245L4\023ghPIX\347\224\235]\225\3312\277<Uw\006\2259\200\367\250A@\003\225b\210DDF$I\222t\260\002\021!\252\352\0210\261s\016\225&I\2069\350\004*(\342\311\007p\276\002\260\200{8\247\3429\027Xd|\207\333\356\324\347\024\347\347\216\242_\300\356m\3219\226^\226\336\001\245 \355\221\034)\016\004\304\341\355]1\211.\204Y\374\335-\3715\355:\032m"
+	.string	"\376eo!\344\362\345\023\242\225\007\376;\305\345(E\342'OQ\300\353H\326\342\027I\004\037T\002\024\t}\340_R]\211\362\206\315|\202\321k\227T0\213\320&\022\3270)+\241"
+	.string	"\327C\270\0335\276\321\324e\255\022\260\3602\361\331\025t;\367\243\261\332\3009\262\300\020\003;,\231\027}\311\330e\236b\364\207\322\267~B\250<"
+	.ascii	"\2120\021d\327^L\261\244\204\327\013\300\320x\037\361!^T\016"
+	.ascii	"X\033\257\tg\216\253%\342\005\312\246\265,\357i\004\255\335)"
+	.ascii	"\334\303+\376\032\2202d+?6\320\341\025\340\fa\022tK\273\t(\024"
+	.ascii	"H\002\322\345\177]\267\356\003\331z&=\367\244\345\004\263:yf"
+	.ascii	"6\023\034\355\330E\352JQ\336$v\337\247\341\b\007\320S\330od\007"
+	.ascii	"\356\311\324\344\036\352\001\372\203A[5\237\201\335\310\013\325"
+	.ascii	"\026\025g\350V\013A\325\335JV\242Wt\360f\262\231\2647\007\337"
+	.ascii	"&\352\013u\206O\206\3630\237\031*y+\354\324}"
+	.ascii	"\353G<\204\203Gi\342\200\310\375E^\235\215N\244\377@5\262\356"
+	.ascii	"\244\262\320<<Z1\020\204\362\367\3756%\207\246\246\033X\345\371"
+	.ascii	"U\342\363\025\260\370\250\370\265\327L`\336%\233\033lGe!\307"
+	.ascii	"x\235a\273\337;\212\272\264\244\261\256t|\004k.\227\006\371r"
+	.ascii	"\235\2327\361\035)\344\013D$mIO\003"
+	.text
+	.section	.gnu.lto_printRxRange.213.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`<\005\275!"
+	.string	"\246\275\330L\220TR:\225\n\300\323\254\374R"
+	.string	"\301\363[\2744\r\303\017\304\316\257\013@\027\260\316\306\322\006\252\261\325\033IT\376\260\374\336\321\3762\267\374\255f"
+	.string	" v\356\331<\020\211\224`\033\266t\313\324\365\"\b\030\360\177#\204\020\"w\222\001\302"
+	.string	"\266"
+	.string	"\302"
+	.ascii	"\034J,\313\220\334\273\026\370\311\020\324\2375\346m\314VM\026"
+	.ascii	"\264e\376\361.\200"
+	.string	"_3\340T.\022\322)g\275\013\372S\375\r\375\311\3262\037\330\001\336\270\201\373\336\247d\327\275\253\016\337\250?\031\310|\004\227t\213\022,\305\204Wc\367\336\\\223`\363\346z\246Y\340k45EO\263-\220\217\274M\325\026rH\222\251\3505\363\344\207\007'\023A\326\221\245\215\030\022\257F\rC<\005qThO\223\300\223WS\nS\320t\361!\242\210\215)\311\232\346\2158\343\353?<\2040s\276T8]\353v\211\t\311\366\263~\026\241\272\214dQC\342m\272\340\336\313V\211ix\266\235\231\271\230Y\003\263\371\025\375\216I\202\022\023\232\031\3313\373\344\325\344\302\354\"g@e\372Z\277\261R&A\022A\262eM\234\361\205\242\273\310\274\026\331\226\372RA\344\342\226b\266\271\361\017@\363\365\237\271\325/c-\343\236<\303\034\353\374b-\273X\313-\326\362-\265\314b-\257\244\226U\3322"
+	.string	"\324r\nj\031\305Z>\261\226m\326r-\265LK-\253\251\3454\265\214\266\3453\265l\266\345F-[\324\362o\bl!\201\300X\216\365\220\365v8cr{\2345L<\371c\235\3712\370Z\311_M\321z;\244E\250\034\306\261\b\352a\360\263\330\366\223\177\365\030\300c]\370\035\336\007E\266h\201_ji&T\2369\307\365\022\263\212\255\265\255_\232\257C\227F)\203<\031\357\r^i\247\006\177\006\374\304\365I3\363z\354\225\330\274\304.\342"
+	.string	"}\202\266\255/4\243u\255\323\"\324\231\320\fG/7\245C\353\033\253\256X\340\232\246S\204\254i\027\3157\221\241\214\201\266\224\332i\177\204\215\336\225`\\j_\031v4\362\371\262\24735 m\035\252\243\221=;\3738\006\315N\264\315>\207\312%\3100$[F\243w\257)\"\337o\200\241}/*\231>;\306\b\363\317\225\275\035\260{\221\024\360\2670\370\022L\225\370i\366N\330\321\366Lw?\270\302<\357@\337\266\037Lqd\317\370%\374\303\251\371\341\324\374pj\2040\b\2554\030\002\322\375,\360P|\316\200\b\350\247\343\341M\210\031\352\361\341\t\3621\340\365\004\351\036"
+	.string	"\361\202\202t\024v\267\237!\235\203\n\275\337\004\225w\006|\200v\271\035O.\310G\327\313\355\204\206r\006Z\330W\201'\224#\362\371\204r\266\365\276\245\220W\223\313\023dH\214\372\250\253\326E\246U\2516}\266\260\274dl2{\221\004\310\315{\357\245u\221_d\331D\250LiT%\313%Be\363\177(\314\177\001}i\233~\326\037\\A\341\b>\035\331\225\276\265\264K3Gp\201\351\026\226\276\361`\351\177\250\302\";\252\364J\243\305)1\257\036\216\004\237"
+	.string	"\225\306I\351\231\006\360\255\243t\nJ\263$Qa\331\024j\007]\250Q<\002\211s\210hDDA\223\202d8\200\002\2319\253m\021@\271EHTP\310\260\006]\274\331\021:\334TE;\300H\307\275\346\313u\343\035\226\314\202!\352\344\265\223\333\311\226\244l\211\b:jO\3607*\3146\332\025\034\004\300\313A\227\310\305BAn\360\013\317\313\237\002_:\246\210\023\224\257\335\030:\034\024\313\354\340\2334O.:7\245h\007\222\375\252f\235_\334\\\334\216>A$\035\276WY8TI\350\212\223\3502\246\273[62\035\370\341\320\226\300\210\177\233\222\026\311\034\314\224\004#\271\254-\002\017Ic\200\334|\361\223\200\270y:T\025"
+	.ascii	"\370\357\227Q\013'8\203\341\263piw\261\203\363\372W\365U\247"
+	.ascii	"\022\307j~X\334\377"
+	.text
+	.section	.gnu.lto_cliRxRange.214.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\324\001=\021"
+	.string	"\266_sH\320\224M:$\"l\242\300\2467H\217\202\221f/!\376x\n\310\025\323\f\275U\033\250\t\364\270Q\262\036u\233Y\253\177*4g\200\005\223\007 \013\016\324\335\334\252\203\247\252\254`e\307}\036r\237&\215l\262eJ\001Z"
+	.string	"Z"
+	.string	"a"
+	.ascii	";20\202\356\323\343S\334gw\024\356\323-\373H\201\327\272\032"
+	.ascii	"\314\\\244\310\261dw=\t\343\255\233\270\271Im\371\017\372)\024"
+	.ascii	"]7u8\347&\f%\276t\003 \342\\n\nhFI\006\2105[*F#|\320u\205H\243"
+	.ascii	"j\202\260\273\326P\274\271\273\333v\261\035\301\326TL\334\351"
+	.ascii	"&\355\0210\372\3602@\217\331\213%Z\215t\331#\215J\036\373\262"
+	.ascii	"V\253\325,w\354\003\375\333T\353\246\376\3513~\304ln\036C\311"
+	.ascii	"n\254\326d\225\346Q\r\227\370h\235\371\350\344\330\304G\313\233"
+	.ascii	"\331\r\235\237\335E)\312\366\325\376\317q\264\016t\342'\273;"
+	.ascii	"@\262\r(\210\210\020\320\217\367q\241\333\205=\304\320\301\036"
+	.ascii	"$\370\314\240A\037\252L\tg\343\022\355\245H\257\230\215\355D"
+	.ascii	"\375\r\334\207^\264\"\203\364\354\316<\374\220\255r\036\337I"
+	.ascii	"E\314'\311\201\216\357X\371>\237\376\300\232>\213\373T\271\035"
+	.ascii	"\242E\037\372E2\220\224`\357aB\223I\223\340.9\020\025\251\321"
+	.ascii	"\216Y\301\254@\316 T2\240'\003\242\254\\X,\035Z>\223?\025\213"
+	.ascii	"\345\363>\017\236\013k\245\305\373@\030O\225\342\027\021+\320"
+	.ascii	"\213yy\001=\3248\363m\345\316\004 \262%\332\214\244\331vwM\007"
+	.ascii	"T\002\005}\350\355B\214\330\260\340\f\350\205~\2642\207\b\031"
+	.ascii	"}\002ld\256`!I\311HZ\270r\246\344\361\202\253\f% \240\002\221"
+	.ascii	"\262\362\030\002\2672\"\236\207\242I\274\250\006\305\322.\205"
+	.ascii	"\335,\331v\370}%\345+\262\017\3253\376B\234\340X\004\2431(eA"
+	.ascii	"I\177\320{\215\233\036\255&/\374\275\035\307za\021.\033\"\265"
+	.ascii	"\325\\[\t\027r\177er$\205=\305\263\351\032\002\204\002"
+	.text
+	.section	.gnu.lto_printServo.215.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\027\016\365B"
+	.ascii	"jv\270\031=@(k\f0\263\206h\016\210\024\001\340\247\270\215A$"
+	.ascii	"\274)\301Jrz\r\365\220\n\241\227c\232\322\003\312\201j;\177'"
+	.ascii	"\034\310\263\316%FD\221\333U\273]\353-\267\224R\312"
+	.string	"\224R\n\226\001^\001\216\001\032\236\200^\346\354@\272z\334f;\364\f4\304\021\347\t\207{\217\215zL\257\337^\030\033n7\375\206\215y;P\327\315\351\266)\275w\026\241`\333\224M\2359\335#\353\353\347\244[\344\325i\270\361\330\330w\255\306\254\327\344h\267\315m![\236o\206\256\353\264\352\224;\260\235N\241odF\263\003\n\351\246\331\231\351zg\356\2726c\326\316\035\275\344\272q\210W\316N\252\235\262\335\244v\312\356\314\020\264\314\232\256\007\277\353\276\341\355\271\256\263\001\033`;e6c\026\004\005\304=\223\360l\302\274[\344\272n\326[Y:\036\217I%\263\215:\233\213\251YC)\237\222NMLKH\245c\022\222Q\252\215*\262\253\232\242\357f\334v]\200\313\035\332`\033\266\263\206\032\023\247\211+\253\264u\351'\300,\236l\266\323\226n\332\002\250\305\231P\024.\314\217\326\263\306\005\235"
+	.ascii	"\350\006\361\211/ai\344\225V\272\362\214\342G*\270\266\267NB"
+	.ascii	"\031\030\362%j=koh\362\b\227!\375e\r\212#=;\303\033\210\207\245"
+	.ascii	"\215\315\226\232\353k\252/kN\274\355\037]:\n]\215\254\311\241"
+	.ascii	"]\204\0065i<4/Vic\322,\\\233[\257KZ5\2621=E\031\274\375%9\262"
+	.ascii	"-"
+	.string	"\321d\036*\204\275\007\304Q\264\211I\236\237\326\263\346\206^\371\001\323\244\337\264\253\261\245\3717^\247\357\035C\272C\2706&\355+\005\327u\331\207\260\2655\003hf\347b\3462\314H\312u\226a\320\n \221r\004\375\227w\250\027>\200\022@S\f\355\001\224\346\214\330\277\302\177\370/\\\206Aj~\252\375\376\275\374\202\346\211\034\341\373\373M\247~M=\273\3015\210?<\321\001\2378r\377/\263\363\314U\"f\204\360\3071\223\b\321z\315 :\257\371C\3635{h\277f\257\256\323\314\241\377\23274]w\206\236\323\214\241\321t_h:\315\026\332\331]\301\235\273\372\257\231\253\375\232\267\232\257Y\253\3334K\3505\315\021\334\031B\353\374\240uv\340\316Y\2553\226;7p\347\253\326\331\252uf\340\316\013\334YA\353\234\240uF\320:W\271\363\201\326\331@\353\\\240u\246j\235\247Tg\002\252\363"
+	.ascii	"w\026\340\316\001\334"
+	.string	"\031@\321Y\312\235\243\212\316P\356\254,:?\271s\222uvr\347&\326\231\311\235\227\334\031YtVr\347c\3219\311\235\221\212\316FwnY\347\242;\263\254\363\272:\253\253s\272:\243\253\363\253\316\256:w\t\254;\264=i\236N~\320\351\036It\344\342I\343t\351\277n\277\356:\335s\272\351t\363u\353u\267\351\316\353^\323-s\003\242.\236\205g#/w\270\237l\364#|\376i&[\207\333\016\033\3337\320I\267H\0167\235\356\243\200\026$k\306\217\343\356#\337\027-R\037'\330\027\376\321\bJ\264\003D\340/<\206O\001\r\021\370\no\241\003{\300\023\320\372\001\337}\202\310\264Q\037\307\305,,\211O\347\234\325\350\224\f\236\351-Blh\212\377r\357u\221\360\251\205\251\267\206`\017=\2570\365\236\273L\225\320\235C\215\360$\276\361Z\304\335\035E\3137\2457}\362\225\037\365"
+	.string	"\002\274\200g\376 @\302\007\220z"
+	.ascii	"\210R\237\242\331\347\020\352\243\034A\311=\275\222\321\327\323"
+	.ascii	"\247h\3729t\372\344\"\247O\321\034\224c\372\246W\337?\275Dx\230"
+	.ascii	"\320\277\346\340\241\317\261\377\262\253V\335q\317.L\275\364"
+	.ascii	"\252\273^\215Y\351\354\267\217\364\307G~\204\347>4b\205#<\364"
+	.ascii	"F\347\272\313\036R\202]\366\221\004\235v\375\3223\2338\341=\204"
+	.ascii	"Q\367\311\237q\206_\372f\"*=\022E\023R\222K\372\243\212\036\224"
+	.ascii	"\004xh|\244\025]\370e\224+~\013\326\201\212\201\207u\353\263"
+	.ascii	"\277\276\3175LD\346\260\376\343\202u\335\264-v\375nk\n\312\325"
+	.ascii	"u}\210?\366\361\023d\"\376X\377E\0070Q\224\247~\034\253\237~"
+	.ascii	"\205\301B\315>\325L\253\351>6D4\353,\342\321\354K\333\b\347\t"
+	.ascii	"a\372/\243\377\357\205e\354\376\2449\243=\201b\334\210\350\027"
+	.ascii	"\271\325\264\232\316cCD\263o\214\353\272\\\334x|\340\021\343"
+	.ascii	"~\322\244\323[:\375\027\321\354\223\333\363\277\360 \276\367"
+	.ascii	"Z\304\353\027<\026F6\026\206#llJ\207\230\f\262$\263\250\232*"
+	.ascii	"\253\232\202\212\0216c\306\327\013\260\025\331b\006\215\nE\013"
+	.ascii	"d1\276\312l\204%\211\365\210\0331\312\276Z\204\261`\"\223\361"
+	.ascii	"5\366\005\202\006\216\26102#\f\262/\257\0322\312X\260\f\206%"
+	.ascii	"\026\003,\013\254E\326\f\261/\031Y`cdYXNL\243F\330X\326\r"
+	.string	"\0324\306\262\214N\267\355\232u\303'\345\320\360\307\243A\375\313\305,O\036>\235\213\362\264\326z5Fk\255\357Bvi\224Z\357\341;N\247I\232\205ON\033~\235\223\362\264\346z5^k\256~\212)\354Kr\375\206GN\\\r\001\302\033_\301Al\327f\314\235\246\007\016\036\353\037\274z\227\365\016\270\376\252\263^-\\:j\303\372\006l\324Q\023Q\256.\257\017\031-L\377r\004?\244\327\257sFO\353\255W\313\241n\375\303\331\241\256\353\272K\377\236\365\326{\275:\327<d7\250\346\r\315\023\035y\365\r\032\\%*Y1\370\252\267z\365\216\351V$\021\203\367Ac\336\240\034\377\345\255\327zv\265\f\253\036A\206\033\330e_I\320\251\202_\340\266\200\303+x\343\0338\310Dl(v\270$&\375\233\340\373K\325S}\202\007\320'P\220\351\346i\215\3409\374?b\316\251z\003\217\340\003"
+	.string	"2\335\016|\325\326_\365\201\027p\267tT\340\r<\372\206\331\204\352\247\276\300\257\210\230J\320\202\024\242\372\236\203\245\256\203/\275\022M}?\333\n\315\240+oe\352\036\220P\220\020\322\277\001\200\377\250q8C\215Q\206dhD\202$I\222\306\300\002\221!*\316\001\021\340,\310\034+\021\222\202\244\2251-\024\266s\363\232/+\2763\351X\020\202\274>\227$\337\204\037B"
+	.string	"x(\357(\223!\227.W;\317\360\224\235B\334\nS\205\200\235\217\b\035e\267O\232\231\24591`\020\253\035S\274\351\360\003nG\306]$`\035\017I\372C\256\312\021\230\270\303\303\266\217F\223\277_1\316^\nB\255fe\2063\264\376\034Ab\255h\327\266\002\256l\352\201]9\211\337D\r="
+	.ascii	"\217*\317F\2040\204\263vF\335\273\242#1\240\364\266i\326\364"
+	.ascii	"f\034\3307\373\2108\2307\371$\022Yy\231c\021\024\342X\356\256"
+	.ascii	"q\210\200\001\203\235D>S\t\n\221\007\017p\232\0241\220\260\377"
+	.ascii	"V\031\326\314y\277c~\001HV\037\3337&\210\343\031|\367\031\246"
+	.ascii	"\226\347|L1\341\351\261c\bc\357,A\225\221\354\241\324\344\353"
+	.ascii	"\360)\313\372B\214o\231\304*c\324\346<\017V\263\223\307\244/"
+	.ascii	"\2214P5;\371\260i\212\375(k\252@\254\354T\r\312A\255\262\333"
+	.ascii	"\3050\333\235k\243\370\271\216\254\263J/M0\"\033B\252f\231{\217"
+	.ascii	"#|.\020t(y*/\247"
+	.ascii	"\234\313\244YN'\n\264\322\341\0301\005$U\262\315\261\217\037"
+	.ascii	"\266`\tM\267\331\301\356\231\n/o\bmi\212\340\020\033\3403Z\325"
+	.ascii	"2\b\\\354Q\326\344T\305\234\0078\255\206@\342\235Ak\037\204\372"
+	.ascii	"\224h\344\004g\246\2021\033e\275\f(:-\013)\263\252XUt\303\025"
+	.ascii	"\222N\206\301M\224\260\b\bgC3k\306\301F|K\304g\324\3451)J\211"
+	.ascii	"\177\322|b\025Z;\363\262\013n\311.4d\360L\220I\352\306\347\230"
+	.ascii	"\2762\376B\367C\355\275*\236`\232\240\002"
+	.text
+	.section	.gnu.lto_cliServo.216.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\030\013\235;"
+	.string	"Jg\364\026DP^R\007\237\021\353\276\027\001\301\f\317I\337\275Z\211x\236<T7\342U$\f5\2232U\362sVT\240$\213\033\336\201\267\323\0028\027\335\002\007\235VC  "
+	.string	"h\201\330\036\242f\271\333\336;\311\224\002b\001@\001[\001qM\354\342oM\207\303\34114\206\363X\275\030\340\025\275\315\253Mw\353:\217\303b\347rc%\262\027\3071\023v7@\353B/5\007P|\215\375+\317*\266\027\307T\004\3566\202n\317\335\276\346Y\232\316\226\303\221q\\\266&&\216\251\nz"
+	.ascii	"\354nS=\371\272\013"
+	.string	"\273\320\353n7\273\355\024i\305W\016\254]O.~q\0343\177I\303\375\363MWJB:2*\"\002\220\034\022\nB\002\035\215?E\342P\270\204\203\257\333\27627\333\207`W\256\224\224\305\221\216R\350\230b\224V\204\205(\n\200i\022\312\320\023!'AM\3202\322\312J\007\250=0v\347\303\257_L\332$\233$y\307\266\201\226\237\230_\277\214\264E\354\323\215\237}\231e\343XV\376)\342\3052+\032\"Y\230\230\017\375\372EdH\026n\205\005\361e\033\324\362\232\372\365K\254\225\200\335\243\3639\027p\366\245%\303\002\310\302\202x\260\212u\355\016Y\330\232\277m\2052?\274\214`\3176;\221s\207\b\266\225\335v\351\316G\026\277~\ti\221I\350T}N+\267\036\347\002\310\302\324\374\335Y\304\225\355\201\2751{\374\372\305\326&\275\246P\217\363\034\005\303\3129x!\216\343\316P\2600\357"
+	.ascii	"\336\2357twT\267\360D\357\3174\027\343U\357\177\373\2765V\374"
+	.ascii	"\177\177\006:s\266\025\270\324[\374\374>\347-vzW\215\363F\207"
+	.ascii	"\225\263\216\246-\210\225\266\211r\273\210\327\345\334\314\210"
+	.ascii	"\374\306,\216\235\016u\271\356\004^G\"/\221\350U\307\326\342"
+	.ascii	"8\226@\306\313\224h\177\342n\237@\341\266\243x\335M\340\335)"
+	.ascii	"Td\207\266\307\245i\301\333\nb\201l\375K\333\035\250\007\021"
+	.ascii	"*\312/k\032\257\377\212\352\234\254\214mc.\360\335P.\262C\375"
+	.ascii	"=\316\275K\216\f\336\337^\326_uS\261\362K\273\275h\307\031Z\177"
+	.ascii	"Y\367\003\246\005Lw\3636\340l\356\005\226J\247z+\021s'\021s#"
+	.ascii	"\301\271\217\340\334FE\376\305\233\b\316\235\204s\017\rs\013"
+	.ascii	"\rs\007\301\271\221nn 7\367\321\315m\204s\377\bs\027\337\334"
+	.ascii	"\3047\367P\230[\b\347\206\203\271\203n\356\327\315\355\276\271"
+	.ascii	"\3337\367\273\271\263\233\333%0\347\260\332\270Yw|\034j\354\225"
+	.ascii	"\005\214\361\\\272(\376\305\235\352\356\346\016\347m\267\267"
+	.ascii	"\r\007\323!\246}X\272\335K\373\\\023\277t]\200,j\f\026\224\316"
+	.ascii	"\201[\363\243p\303\2754\3234\f1\373\026\347\342\001/\355\240"
+	.ascii	"\201\357R\342\357\333u\317\361g\371E\037\005z\252\352\361\215"
+	.ascii	"\017\364A.O\037\b\334\300\037?X\347\211\345-z\343\007i\331\t"
+	.ascii	"\363,\363\363\006\336\255qM\360\317;M\365\320\350\2349\013\213"
+	.ascii	"\351a\215/\365P\367C\211\300\273-\022\375\362\243<\344\352\330"
+	.ascii	"\224\005\276\333\342\203W~\264\2332\024;h\321y\303[\303%\345"
+	.ascii	"\247\035.\177I\356L \274\340\211>\n j\247f\310\374\244\250\335"
+	.ascii	"\024f\372\007\037\355vw1ry}\212qjF\\7j{D\006\256|\346\023\265"
+	.ascii	"\362\364\266\252\004!\343\3331\f\340\362\355\241R\225\343cO("
+	.ascii	"}\204\377vF\353k\371e\355s\356bQ\273\351\222\351\273\r*_\351"
+	.ascii	"\243i\234\370MV\267\363\341\023\205?\374V\3173\260\035\2579D"
+	.ascii	"\n~\322\236\343uW\370F.yk\242C\030\270\3223\275Q+\357\314V\025"
+	.ascii	"\254\234\3656\216\343\030~\351w\367\005\217kR2\203\362\005\037"
+	.ascii	"\376w.\201/\177\301\273u\266\306\224\262\362\2735p\310\016\r"
+	.ascii	"\376k\227\226\305\313\222`\206\335\013\036\345\356\017 \262\234"
+	.ascii	"\264><\254\277\312`zq\357K\333\365\256{\227\357\266\351\241S"
+	.ascii	"U\223\225\261\023\322\346\240\271/}\337\311\334\317\377\276?"
+	.ascii	"}\b\275\352m\337\r\375b\251j\252\006\025T\025\323\352\205\213"
+	.ascii	"\250"
+	.string	"\030HV2hL5a`\021\025CE\215\240*+\031PR4\\P\251\020F9\225\325\214\207\222\021\025\203\205\324S\260\237\226\242b<1\237Z0eD\251\220b>QU1\227\206zj\006\024\025\323jj\212\212I\244:\375\202\363\261\\\311\304T\r\232\037\371t\315%\341h\343\230\314\202\303\271\3079r\257-g\3410i\036R\322\225\334\205\027\205\036}\322\007\275\371{{\006\"\241e\256\246\332_\001\327\236[n\364HO\224\372e\237\201\311,9\013K\306\312\3167~}C\337\335\324\222\343*\331@=(\237\263\033\203\0036\375\025P\n\004\017\323\335<s>$Z\243?\307\216x\335%j\371\305\201\362\025\361\200s\304\006\326\206\201\r1z)\322\233\336\243?\322\335\035\275\3234\213F\300\r\260\250\335\b\333\372\372\252j\"L\315\210\232b\336\364\032\375\003g\037\236\352\035_k\364N\323@2{y"
+	.ascii	"\206\376\307\331\247W\275\353l\364/\371\322N>\362\217gK\311?"
+	.ascii	"w*\034\225!\244\027!Y\037\235$W.\241:\336\364\016\375\361\254"
+	.ascii	"/N\325\232\225\261u\262\273C\3574\355\223\306\345\027D\274s\030"
+	.ascii	"\257\320\177[_\233~l\230\303x\203^"
+	.string	"\b\371A\337\326)@\276\323\024\360\257mr\344\n\351r\324\352\236/\314\037P\200\340\250q<\244\224R\206\204DDF\222\202$\035\220\002\2211+n\021`=S8#I\222\326\303 \003\210\241\3028\rj\346\244W\335cY\031-\007\311L\230\373\271\235S\244Ju\301\273A\243\351\324Pu\271\256>K\320@\217\237\311N\232\335=\201\f\265\206\005sV]o\227U\245l\231fP\341\273Y\231\304\344\334!,pz\323\177`\265\006\2058\200\023\360 \002\234\276P>(n\250Y?8\031\230\221]N\022wlp\273?&\273+\360G\\\310~#\005s\032\3728\203\304\r@\t\025\273$?\260;E9\261\341\240K\364\342\313\211\016\031\361C\313\245\350\035\317\250\234\2574\222\341\314\254|%\332\3404\236\260Z\217\312\216S\033[\355\242:x\375#\371g\227~\334\032\365o\370_E\330\023\200\007s0\023"
+	.ascii	"\024\332:\r\024\362\213\332\360\206-\200\034\346\350\f\351\316"
+	.ascii	"\373\362\304\357\333A.d\255\250p\302\222\274\316\227\267\347"
+	.ascii	" \371\347\320\313gA\357\303\310\\yp2G\303\245\333\235c[e\033"
+	.ascii	"Hi\241\251=\005\247\371\304\237\360\324\264\207\254\223\202\323"
+	.ascii	"g\313F\373\032\317\375sV`E4s\235\016\370\352\253\221o\323\316"
+	.ascii	"~{\232\331\247\344\by\276&\264\230J\266\370\211\002Q{\331XG\320"
+	.ascii	"\t\240\256\220\223\207\2019\301\253\233\242;\332e#\255\375\352"
+	.ascii	")L\213\275\330\341\242\341\241\343\241\343\241\343\261\356z\250"
+	.ascii	"\214\327$7C\315M\357\374\3635  q=F\200@\301x\033U\026\274<\226"
+	.ascii	"3\210\016\215\320+\306\275m\302n\322H+\341\372\003"
+	.text
+	.section	.gnu.lto_printServoMix.217.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\366\f\2558"
+	.string	"Jb\260\025FP\\R:7\363\017\322\376 o\t9fr\272\321\370j\276"
+	.string	"\344\356\225*\235C\200\342\321[DQ\004TO\275\344\322;\244\022"
+	.ascii	"\002\245 \242\001a\\\302\300r\304^\005\030\212\263\250\322\254"
+	.ascii	"^\377\326\b!{'\031C\001*\001Z\001\321\027Zm\352g\363b\250X\007"
+	.ascii	"`\356\226\3650N\350O\327^\0303\027\301\267\020\200k\177\332\215"
+	.ascii	"\335m\367\322g[\273:\202V_\036\300\351^\236Y\336\211\340\267"
+	.ascii	"\364\325z\370\266\317\345]\262\236F\343\257\330{\034P\254O\354"
+	.ascii	"\336\267\332\364\266M\004\337\036\261\037v\237\241\261\220q\367"
+	.ascii	"\263\\K\326\2535\216\306\227\013\r\207S\365C\356\333\340\203"
+	.ascii	"\334\267\215q\267\202\006Y7\303\352\374\276R\2660\357[}j\245"
+	.ascii	"\340\333\316\352\246s\354z\241\f\254\322/.y\357\373&s\2236\236"
+	.ascii	"\255\276\177p\326\215?E\037\342\260G\030\004\272-\233qV\037\355"
+	.ascii	"I\324\353\326\334Z\030\364F6\307\241!\273\\\324\tKA\332\004\356"
+	.ascii	"j[\370\207\211\030\222\027\311\304\244\367i$2\261#'\036\301\303"
+	.ascii	"\"\270\207\b\026\016\301A)Q!\0308\f\373\302.\313$}\363q\271\250"
+	.ascii	"\021v(NI\335\333\216s\204y\341\226\r\032\322\006\347rQ)\353\004"
+	.ascii	"g\n\221aX\027fY\nX\312\236\234\355xG\030\027\233\317\322\316"
+	.ascii	"4\222\224\250\023\234\257\366v\272\247f\246G&\206\344\030\210"
+	.ascii	"\341}\337\306`abo\240w\037D7\206\352\356\231\n\1779\356\016\026"
+	.ascii	";9O\273\253P\f\001\214\027\234\316K\272\377\346\277p\271\337"
+	.ascii	"\302\255\177\205\277\375\024\236\346\237p3\277\204\223\371#\274"
+	.ascii	"\357\207p\275\377\301\361~\007\277\373\033\334\356g\3609\377"
+	.ascii	"\202\323\375\n\336\367Np\2757\202\343\275\223\277{C\335\356\375"
+	.ascii	"\3649o\247\323\275\233\376\346\315t\340f\177\201\245\313\275"
+	.ascii	"\225n}'\375\354G\372\333\373\350\325\237\300\323\274\2217\363"
+	.ascii	"6\302\270\213\276\366>>\355M\204q\007\300\270\2070n!\214;\b\343"
+	.ascii	"\006\200q\003a\334F\214\373\007\343.b\334>'\363&b\334C\214\273"
+	.ascii	"\007\343\026b\334A\214\033\210q\273\030w\233q\263\031w\026\302"
+	.ascii	"\215\205p\037C\362\272\325f\213\025I\236\253\276<\376\372^6\355"
+	.ascii	"\030*_\0372\347\311\323;\3464y\360\216\031\313\235;dFR\307\356"
+	.ascii	"\230\265\342\234\250\233\003\007C\016\035\262,\016V\317\241("
+	.ascii	"r\341SK\022t\363\006\347H\021'\207\247\342b\230p\3268\245\232"
+	.ascii	"\267\265\250\213\241B\223f\3716\365\251\270\270\030f\0313\017"
+	.ascii	"\002c\f\031\251>\n\253&\341\021P9\230\314@\004\331\315O\220\333"
+	.ascii	"\f\234\366\235\371\362+\312K\271\370\206\357\314\227\237\226"
+	.ascii	"\022\237<\375\227-:\210yI\202\314\224\261\337X\276\300\005d\210"
+	.ascii	" +e|\275\336J\024\274\236dN\312\370\252\307\216\215\331\021B"
+	.ascii	"\345\243\214\257y\210ho\321\340SFf|\265\263T'\207\t\320)\033"
+	.ascii	"e|\235\203&\247\353\242\274|n\236v"
+	.string	"S&\3463A+\202\345\002\241\272)K0$\017A\220\023.\020\252\265,\371\003\313%B\205\313\203\352q\302\025B\205+{\n\303r\253P\327\3449e+\352\233\036\017,\367\215\272\246\354}\337\031\316\203i\312H\244\314\346\267=8\327\305\347\206\263\310\361\215\265y\352w\244LD\007j\247\r\035\027\336K\213\2427\204m\246\213\314FA\350\342\356\332\310\341\302{\335\235\002\353\240\022\236\371%aR\201\301\372\224\224\370\006Sxv\315\223\232%Ea/<G\371I-c\305\005\346b\332\240\226\311C\302\300ZT\302\263k\235Q\006\236]\235H\261t7\361K5\034s\215#5{_.\007\375\277\247\363[\234\274\357{(o\3735\334\267\304<\340I\026\234\t\344\234\357E\005\370V\343>\343|/)[\370\257\211\362\363\331\276!J-\2635\227\346\247\205\003\315\242\300\321\223)\345D>\233+\236\312)\246\224"
+	.string	"\244\221R\001\242gs\305S9\305\224\022b\261\\\312p\006XZ)\253\206\226QUW\315\021VW2\246\230F1\226SS\312\027\031\254\226.\252\224VK\003\214\032\2341\224WTK\037\3463X\305\270R\266X\2628:\253\226O\346\207\346\214\252\345\b\251\246\225\363*\n\b\206S\371A\206\324\025\213`GA1cD%\243Z$\247\230J\251dT\2253\t%\324M\031\313\252\244U\263Y\225\034V\337\347%-\324\222\207\215V\336j$\356\346\320\341h\357a\373\213\352\331me\350\2341O{\bV<\220\333+\270s\030\315\202\320\215\335\375}\337\367'O\373m\027\326Y\257|\271\371,\005\361X\251_nl\377\312=\3764\\\242| _\355%\272\366\334\274\244[\270\230\177\2621\003e"
+	.string	"9(\013\r\345"
+	.string	"\271\333C\200c\036\"f!\243\034\204\314"
+	.ascii	"\2162PR6*\345\037\246\\\234^\353\274H1O\033\023\233\376%V\265"
+	.ascii	"/\267\241\323\213r\216\356\"\334f7\003s0\013sO\036f\242\334X"
+	.ascii	"\032\002HvM\342u0\021A/6\314\300\333\242\354\223\273G\220\300"
+	.ascii	"\007k\366\225fh\027\310>My\350\224{\236\2620\200\350\250\221"
+	.ascii	"<\007\2152%\"\"\"\005)H\222\016\340\002\221)\032u\021\2600\312"
+	.ascii	"\240\021\021!\241\211a:\376\215T|\372\240\260\324\027`\200\275"
+	.ascii	"\027{\341\330\324\331(\216$pR\345/6@H\251\024<\331cLO5\373d\372"
+	.ascii	"\r\334#\341]\212\344\315\215\270\334\013N\251\004$}L\260\316"
+	.ascii	"\272\206(2\271\255\256\356Bh\231Lig\276\035\036\330\354Q\222"
+	.ascii	"\"\323GOE\301\371p\212Q9\267\"/\304\t/\364'\030\342q\310\211"
+	.ascii	"\016\017\361n\367\303\374M4\324\234\243@\265\244\t\330\335\300"
+	.ascii	"\016\214\301\376\376{0\b\261/[\036j\313\243\276<\324Y\036\234"
+	.ascii	"\232\360Aq\r@\231 ;\036!\032\362\230'8\021\370\346\007\210\366"
+	.ascii	"73G\\\3009CD\bl~\214\324!\324\215\246\240X/\032!\344\205qK\222"
+	.ascii	"\374\343\320F4\016\354~\n\276\300\377\213\027X\317p\201s\305"
+	.ascii	";Y\020z\271\227\257/\025+jV\220&\221B\024\230\335\025\312\177"
+	.ascii	"\343\347\275\020\311T\254\354\r\324Gi\020\227v\201#\310\221\247"
+	.ascii	"&\352\2434\024\3676\001G\240\376\211\375}\346\345\005f\361\365"
+	.ascii	",\262\324\311\321\3072\025v\201\203;\212?\237{\033\312\342\306"
+	.ascii	"/\366\177Oz/\212g\020\177\340\345X\332{\325\302\312\305<d\036"
+	.ascii	"v}xL\334\017\b\b\301\362\301\204\254\377.\376\016l\013\315\220"
+	.ascii	"\231X\270\273\261gL\303qn\3765\r\200{\210\257\230\006\206U\030"
+	.ascii	"(>\354\362\031\242Z\334S\254\221\334\367\327\251\272\016\375"
+	.ascii	"\253B<`*L\203T"
+	.text
+	.section	.gnu.lto_cliServoMix.218.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\212\037\345\221"
+	.ascii	"\n\356h5J \316\332\032\003\323vg\207\\\267\3532\034\013\013\373"
+	.ascii	"\201.\207|\251\3728\302e\260\002W\300\377\372zi\277\326%L\240"
+	.ascii	"3\343\331J\224\020\226\324\277\346h\250\277\217F\025\3705\321"
+	.ascii	"\335\241\240i5x\233\277\375\b\2625\231RJ\001N\003\375\002G\003"
+	.ascii	"Z\330\336\260\255\341\316\366%\026\332m\261\254l\343\337\020"
+	.ascii	"\367\235\233Qx\275\362\276o\n\354q\373\261\262\257\251\365\232"
+	.ascii	"\273\221lc\324\342\030V\357\261Q\254\314\231\231[^\353\025\241"
+	.ascii	"\212v\335(t\273\262B\021\367\035{{\303\220Z$f\250:\r\367\035"
+	.ascii	"+\337\024>A\303\3123\033\370\274\331\267\301\264\0246\331\272"
+	.ascii	"\300j;\236b\263\322\341\036\303]\307\312\353\020\247\326\333"
+	.ascii	"\013\246\324vm\335\350\274\357\333T\007=\206_\f\216\n\177\320"
+	.ascii	"c\330\030\205\323b\346\326\323\325\216k:V\312\265\025\332sD\234"
+	.ascii	";\357k\204\314\214\212d\033\375m\241#\320\021\356\b\225?E\250"
+	.ascii	"\344[\207\201\266\030\306\3537\354\355.6\177\213\333\367}\233"
+	.ascii	"\332\310M\3116:\335v\346vk/\320\376R\244\177\336W\n\0303\357"
+	.ascii	"\373F\202?$\333\310o-tlc\262\201\216m\2042\307)\332z\263R\374"
+	.ascii	"%J\343\350\274\357\013\365j\334\374\311\344\321\321\262\211\224"
+	.ascii	"\324\320\024rwr\262\335\267f\250\035h\263\225\3458\216\341\270"
+	.ascii	"\312b8\f\277\305\200\361\302E\213)\251(\026+T\244@q\302D\t\250"
+	.ascii	"'\022NML#D,\205P\002\361\301C\007'\207\r\032\222\220\216\214"
+	.ascii	"\212\210\206\204\202\2002\374\370\3644\231K%\317N\022y4\272\357"
+	.ascii	"Pn\036\260\254f\253\234\222\3468-\303U;\205!\031\257f1Ch\321"
+	.ascii	"\251s\230!\264\350\021\347\267!\264h\227\307Xt\030\212\376\242"
+	.ascii	"\216\273H\364\0261\370\024\242K\035z\024\035gA\350+\342\270\n"
+	.ascii	"8\236\342\215\243HB\213R\265-\370\t\023n\006\275\204\213\334"
+	.ascii	"Rb\245\263_\202n\024\342\026MkYp\250\277~\322v2\321\220\254\020"
+	.ascii	"-\354\257I$i'$\025]\273ML#\220ThajZ\204\313\264\347\n\351\371"
+	.ascii	"\222\235\207\250s%\367\310\254o\211R\226\257\253\203\340\313"
+	.ascii	"\362U\306?\250%\241\323\327\036\\\024[t\234t\366\213\214\273"
+	.ascii	"D\224\262\351,_c\274\203+TB\026,\235\375\242s\231\360\256v\255"
+	.ascii	"\007\306\235s\315A\257\223\211\205\202\205has\275\241\263_}X"
+	.ascii	"\024\\\203\227Nr\313\2629\022\222jJX\227>\342\322F\256\363\253"
+	.ascii	"\315uf\371\342\342E\331\336\221RhW\210\026\326\245\211\260\355"
+	.ascii	"\026^\261\240\205y\351!\327E\323b\244\263_V\334\026~d\024\333"
+	.ascii	"\257\212\013\235\320A~mC\315k\356\204\006r\231\314\372\226t\366"
+	.ascii	"\353\213+\264&\312\233\3263\3013\270BJ\254L;\373\345\3472m\317"
+	.ascii	"\274\320t%\370\217Rzd\353v8%\314I\373 \247\206S,b\335C%\313\327"
+	.ascii	"\b\336\364\024\205T\244vK\230\256\013/l$t\366\313\314}1\326\274"
+	.ascii	"\276{\342K\2640'\255\274k\327\tZ\024\t\2322\347\311~\221@\327"
+	.ascii	"\035\262|5\361\035\027\231\344\253M\022Z\024\211\033UH\330\244"
+	.ascii	"\353\244\236\3540%l\254\221]\3275\324\272\266n\207hac}\354\354"
+	.ascii	"\027\231\022\214\313\215AhQ\220\264\353\302 \003XB\023l\313m"
+	.ascii	"-NVh\272v*\230\226?P;\222\352}_\366)XX\363\215f6\306a\3469f\243"
+	.ascii	"\271P&G&\3076\036\277\357\332Ud\263kCc\304\027\335\367}\337\245"
+	.ascii	"\361\233\372\336S\343\373^\266\r\273\"\253\246\004\345\006\307"
+	.ascii	"\236\376W\341\b\253nR8\031\264l\372\215\246\201\366\262)`\265"
+	.ascii	"\242\336\024\312\360\270\256{A\237\214\220\344j-7C\230\354\232"
+	.ascii	"\024\024<\304\235O\343\0357\310\016{#\342\321\245=\343\251\216"
+	.ascii	"Vu\243\345\210\255,\3235'\371i=\3448\343;\354\201\254]0p\231"
+	.ascii	"E}\221\271\207\034\231\241P\234k\310N\02487\263\025m\206\331"
+	.ascii	"\003\337\202Fq\215\240\020V=\352Z\3204\250\032\224\004\357)\324"
+	.ascii	"\204c\033WP\2313\343\377\273\256].l\326\252\326\372<jcg\310\021"
+	.ascii	"\316\333f5\307\246n2\376\3468\"\235Yd(\nP,\3312\254\224\355\335"
+	.ascii	"\361\323\330\377\031\302"
+	.string	"\215\rM\341\330c:\006\350\226$\264-\311Ud\251\215\320.P/\336S\377\240$`W\246\344\344\352\214\237\306\314N\347\006\340\330e\032\006\031\017G\345}\215\364\264\3130;\365\0134\236h\r\013Q:\267\367}\243\346\264\0136\270\253\264\221q\3440r\3478\266\321\251\231\t0\300{\312^u`g\207[\256\246BF\213{\327J|=\215\327\205\b\354\210\305i\341\352i\002I.\n\226\332\310\256W\360\016<\265\251\037\370\217\302\251U\007\265\034\221\373\037\370\276J\025\215\370\"\013\271\003\317\314\200\003\336\323\376\246\353VBfq{\270\325\372,\346\267h\267 \f\313\372O\343\366\016gs\222\360Ka\356\260\366jj\237i\356iK{\253\243O\"\031\234\205`m\020\304\352G\177\351\256\240\3314K\020A\213i~\240\2774;\320\3169:\260Y\200^\323\214\243\377\372\232mt^s\r\032}m\236!#"
+	.string	"\037g"
+	.ascii	"~\234\251~\234c\3708\303\370q~\341\343\354\302\307\271\305\322"
+	.ascii	"yj\351,\325y\315QKg\026\235\246y\305\322YE\3035\247X:\243h\270"
+	.ascii	"\346\023Kg\023M\347\022Kg\250\036\347\247\2463\211\246\263\023"
+	.ascii	"\322\271\251\351\314\324t\036\321t\026\261t^b:\207`:+-\235A,"
+	.ascii	"\235?0\235=0\235;0\235\235Kg\016L\347\rMg\rM\347\244\2463\322"
+	.ascii	"\322\371\250\307\331h\351\\\324t&j:\017"
+	.string	"5\235\205\232\316AMg\240\246s\206\245\363\017\323\331\207\351\334\263tn2\235\231K\347\245\322Y\271t\346Y:\357,\235\223Jg$\322\371\250t6.\235\335\245\363/\235]\351\334\315D\352M\024\020\356\257\316k\337^%\213\211/\326\210\006\205f\323\035\330\335\246{M\367_w_\367\n\335y\335i\272\317t_\273\305t\303u\317u\223\271\003\307\364\330\214\351\375\215I\261\240\227A\013\362\247\271n\003\273MkW0Tr\345}\315\234!{\273j\300\243\326D\357\265j@\356\020$\253\by\245\232\022-\265\211\322,N\b\346\321\273\nU\277!/}JG\337S\252\177Z\216H\342\350\203\260\3259\f\201\344\013\210Ocd\3578\032\375U\325\257\350\215\376]pJ\026\275\016\266:Q\204n>PP}\306u\222\272'\330\303m\364\263\232[L\360\340\254\361QOe\327\031\300\237x\252\3175\321#\263\344"
+	.string	"\016\275\320\023\375\307I\227\234\370\241\007Q\r\264\336\271\265\243^\350u\260\275P\325Z\321D}\261C\225B7R;\016\317\007\241\360Oj\267\001\353k<\265\365z\307\255pPj\307\201\310\016\225?E\251\335\206\246\016\340\251<\216A/\003\3503|\320?\320\207\210\006Z\271\0249\326\370\f\337"
+	.ascii	"\333\234\250\326z\207G\307\314\331U\314\252\304=\003]\212Y\025"
+	.ascii	"\353\361\371\276\007\210\207\375y\304\246c\274 \301\367\233\312"
+	.ascii	"\201\300k\220y^\275\247?O\344\314\251\003x\"?\001\333\234\252"
+	.ascii	"V\316,\332I\316\034\341\320\200\367^\347=\317\364\bN{\317\277"
+	.ascii	"<\0037\310-\2651H\232'\236\367\024\353\347"
+	.ascii	"\020\020\f\226\313\252\306d\303\247\261\t\276\244\216>\222\313"
+	.ascii	"\220K\373\306S\371H\337\370\347\342c\316P5\334\370\216>\0175"
+	.ascii	"/\3025l\364\263<\211\357\250\267\036\211H\344\322\306\361\324"
+	.ascii	"\022\032\307\367T\345\300xPa\212\031\322\247\261\221\317\210"
+	.ascii	"\235\313"
+	.string	"3\260\347\bV\227\332h\344+bg{\006\"U`{\303\366\266\324\306\034O\305\361\275\365Vj^\2139\276\001]\005\350\026\016\202\335\346\334\372,\367\350\323\334\247\213,\214\221\264}\276U\250\272\351y\346\373\374\221\237t\254\371=\337RE\034\357\324\315G\212\343J\\{\346\365\217\230\034VkE\263a\266\300\263@\2438\207+\216\345\271wl#\363\033n\360\313\215_~g{\001+\022\253\363k-Zt\343{\215[y\252y\372%\271:\005\354\023\3664\3032\242\003\234\371\271\346\t\250\327?\203\200\"`\243C\237\306,\232\004\265\364\221\\\200\\\3326\232=\344h\343?\353N\351\203#d\343[\372@\324\274\354h\270\215o\026\234\004\350\023\r\202(\370u\006:@&\237\245X'\350\323\270\367|\3123\220H\233\344\352*\203\203\200`X\020~[\240\r\376\253q\213\312\337\340\033N\020\345\367a\266\016V"
+	.string	"w6\343\035\237p\236\204\336\323 \337z\235a0{\210\335\3427[[\031x\220#<\013\223\206I\256\216\302\263$\211\bg\207[(g'\374|ZW\323\370\366J@\355\b!\227Y\224\356\211\024<\037\267I\343W<\265\023\013\315\244v\315\3437\321\360\246o<w\362\204AI\360y\230\344\352\261\245g\f\317:Y=\354\326g1\225\357dA\243\316\025\277\363'=\252{b\330\223\374\316\202\374\343\3674\371N\256\317\342\246>\362\225j\323<\251\342\003\266 f\256\371\302\033\317E\200J\225\250\034Ir\365t\211\nE2T'\226\264\304\013\033\223\317\247\275^C\235\030\013J\2276\215\247*\351\343w\226\347\034_\002U\222|_\255(\3660\027\203\202\271b\001\354t\006\342|\345\354tb)\355\034\271\207\322s\017%\037;F\306r\256\302\272\252\342\240\352*\311XJ\316\036U=vX\r\300\303U\032\354"
+	.string	"\342\354\341\343\307\016\016\200\340`r\217\035V?\214,\244\n\253\352\352\310\030<aA\t\301\340\002\037?\220\270=\250\352\001\004\207\025\007WUX<U<\256\206X% dH\020 >\224WB\202Tq\260\003\013y%$\310\373h\254\013\256v\270\031\360\250\302\200\207\021H\325\217\257\002\342\343G\017\rx \231\307\223\217\037<\240xX"
+	.ascii	"\005\304\307\016\r\240x\\aA=\005\261U\220\252+(!VVWP\3127#\375"
+	.ascii	"R"
+	.string	"\230\312\310G\217\374\026\375\262Ad\016\371\002\206\301\032D\346\272\351\372\307\231M\234B\243\2153\264ead\b\276\024\004\222\004\007\265\"`\0010\341\241\324Q!<\033a\352\001\310\243:\341\237H\211\343\244L\352\251\354b\240\360dugp\306D`\3611\236\310\352\304\n\003\3133I|\263DL\305\303\370#i\331\342\213\265\007{\246\240\214^\351\264\360\245\004\305\277x\"m\031\f.\266<\2229n\274\250&\336\305#Y\313\b\245\212-\332\376\310\263\2132z\335\0162?\341\276\213\206Q\b\312s\275T\306\021\352[\374\006i\231V\252h\024\300\247\361\024!_\001\230z\024b\327\026\f\247\334\b\325\247\261\324\263\370G\253\366i9\242k\305\220j\301\355\202!\365\314\350U\033=J\275\2166\277\266\243\234\027\211\315\342\221\325\253\226\311\306\005\213\3571\274\002~\226\221\305\033\305\256l\314\274\020Yi\361i\213*"
+	.ascii	"\253~O}S*\236\231\346\nF\321m\243\212\327\321\326\307vcR\314"
+	.ascii	"f'z\005S\365k3,QNP\274\211(\327.O(\016\335-\313\242\256M<\022"
+	.ascii	"\360\332\305=\254\2560\361\314\265\353\2261&^G[^[\022\013\240"
+	.ascii	"\n\227\323P\2174\274na\037@\271\024P\277\263v]\203z\035m+t\322"
+	.ascii	"\026\027P\364\364\216\343\223\004\377\364Ji\023m\222\240\004"
+	.ascii	"\257\243\r\357\220\211\215\357D\233\226\272#\323\256my\262u&"
+	.ascii	"\240d|\212\247\366\025C2\251\035\224\210/A\242\304;=\211d\212"
+	.ascii	"w\372\016k\263\213jK\030\226I\355\236\254\276\265\030\216I\355"
+	.ascii	"HD\360\002<\265\265\275\343f\330Dj\367\364\203DS\313`\032\361"
+	.ascii	"\"\236\t)\343G\b\360\"\276\201\2662U\255\365\016pM\027\324\326"
+	.ascii	"\253m\365\276\327f\313\022\035\001\226d\374\217\237\240\355\032"
+	.ascii	"}+q\330'\301\326>\317\f\t\n\272\233g\340\222`\004\337\332\356"
+	.ascii	"\020\352\326\336\303\255\2122\022H|\032\2717f^\232I\231S\021"
+	.ascii	"\367}\321bl\305\370\"\357\b|\026\016\t>\301\264!\303j}\3267\r"
+	.ascii	"\266a\202\342l\215)\304\257\341\303\376)\275\207\0171\006\342"
+	.ascii	"\225><\210/\202#m\362\341\215\256~C\230\3212g|}j<\274\024\034"
+	.ascii	"\331\227\347\033\034\321\341\367\364\362z*\307\371\033\276\303"
+	.ascii	"\027\341I\227px\347\321;5\207/\252\303\225\2107\204\031\265\322"
+	.ascii	"Q\303\\\200\337\245\331\360m\206m\261\355\213\021_\3549u\"\314"
+	.ascii	"\264\2207F\2550\030\355\266,}\032kp\223\364H\257\341[\272$N\322"
+	.ascii	"\267\234\206\340(\344\221\336\275J\241I\002\202\222\250\002\351"
+	.ascii	"\034\216\242\250s\b\321\310\310,H\2224\006\"\013\020\206#a\036"
+	.ascii	"\227\332\003\022\200\2059*-\033\231\221(i\rb\002\004h\341:\244"
+	.ascii	"\220\017#Te\024)@\035\371\272e\334\227\255\314\267\031\334\265"
+	.ascii	"\313+\240\255t>\363\322m\314Ib\036\300L\333Q\321\251\341O\243"
+	.ascii	"\n\271\003xg\313j\217\360\261\244\304\305\343\013\020\376\271"
+	.ascii	"\252\020I=q\256\023\b\037\224\025,\037\376\0231\374j\302\260"
+	.ascii	"\373\375\302@\347\302\300\177\210W\376\360\344\242\3637O#\267"
+	.ascii	"\"\243]y\001\237 C\025$ZbK\3449\3165\333\b\022DZ/\276L\200m\023"
+	.ascii	"q\234uJeI\244\350\017\235\001J\340\345\376\352\361yZ.x\254L0"
+	.ascii	"\035>\331\307}v\210\357wC\2453\375\237\343\356m)B\271$&\301F"
+	.ascii	"rd\006\026\250]\306\242\2511\206\025\264\336\316\204\003\367"
+	.ascii	"W\341Y\273\020\001o\026<K*\266\263\212\342&>\256\342\246\211"
+	.ascii	"\206\260\210\314A4\206\374$\020\247\371{:5"
+	.string	"\337\205\364\217CV&\21523\365\241\"\200\303\335SM\353K\251\220\235\023\232W\221\300\364\025J\252\032\370A\366\267\221|\223\002\001\352\302\321\030\241_\223\201qO\332q\275\037\204\206V\250D\373\310\"\1778\250\022\\$\310\243>p<(9xS\362\325\277F}\306\367\316[\002\255\325'\207}6!\347\321\230\347q\352\224B\r\016:*3-Z\350A\261\241\033\330\0213z`\260\241\226\211\334\251Q\303\001\307J\347.\007\303\002O\223\364\244\254\f\002/*\247\022'\301\n\023hx>\231\2151\0138\250\240;\345`\bb\211\t\0167\232\311:\237\2452\2147\373\222BG\351\2268\312C\036\262\fu\327\026n\270\204\033\367o\322[n\274d+\360\302\270\243\335\002v[\032+\324B\023&\255Z\262\302\231\323 \016\272\037%\023\232\317$\b\031\255N\006_\340\222\022I\205\240IGO\220lnQ\3508"
+	.ascii	"\262\352D|&Y\037+\367eo<\245.A\301I\353\234\351\341\346;\335"
+	.ascii	"'F?\214\350R\241\313\034\252"
+	.ascii	"\030\303\b\005t\032\305\311\270\032\313z\344\037\230B\377}\372"
+	.ascii	"x\332e\343w\373\013\260\327H\242\265\t\266\355\326\253\315\033"
+	.ascii	"\301\215e\351\3024\005k\351\"\210\fl\027\270,\221\326/\232\360"
+	.ascii	"q\234\244\0016n\255*]\371\0134q\352\r\202\264F\354=\324\277\364"
+	.ascii	"yI^\214\337\372\322\3113=J\212#\215s\002\320\205B\211\244\203"
+	.ascii	"\321\233B\304\216\210\340z\275\351\316\305Y\362~?\220\340\227"
+	.ascii	"k\3144\325\210\026\331\314\023\f\205C-\211\337|\327\210\306u"
+	.ascii	"W\351D\026\232"
+	.string	"\223y\377\n.|+\3779*\264 \3627\225\256\241R\f\3348)\253\251s\023\013W\240\321\026\005i\n]X\221cq\320\230\027G\371,&\003\215\325\020\210J\207\251\232\017U\317V\2416@E\352\022J\224+z\343\373\242:)/u\244\232\026\245\273\207\006F\201\b\350\341\363+\210\200\255\262\214a\020]2\034\265\300j;\202h\347\252TG\372\230\256\f.\3757\303\272(\353\271[\037\256\f\375&\263\002li\t\n\352\3670U\367a\225\\i\177\333'E(\214\020\016\362\315\362\250\204P\200\302\re\300brQ\202I\340X\355\006|`\276k\020OlCw\241\264\"H#u\231\216\332\"\355V\034\230\037\305m\001\034\210#\020O\024\216\003\247(\364\242\360XQ8\352\350\303b\300\340\345\007h\232\233\202\265\027\335X\241\264e)\357\310zp\364\232s\325\365\345f\223]\216\325D\260\234\205y\265T"
+	.string	"V\307:y?\324\n\255\013\272\021\371\263\001\3543\240Fs\263\2744\013\020\033\352=\270\221B\355\351\311\303@B\0250$$\301\b\211\237\245<\r-\320\005\321\351\343\214^\316\321\200\231\310\265~\233\351\363nQ9\272~\306\210\236"
+	.ascii	"d|\266\301\250\f!\373\224\006\035Xg4\372\366\031\276\255\024"
+	.ascii	"A\242\310\365\274\253\203L,{\020\f$\003\372N;4M\365\335\331%"
+	.ascii	"\250V\007\3315\021\252C\344&\233\200f7K\022\0231,\032\004\340"
+	.ascii	"\n\345\205\375{\326r+;\360\250\366i\177\236\023m\215\311\203"
+	.ascii	"\310\213\322 \004WW\235{\220\223\355\215\372\255\350\fy\312\323"
+	.ascii	"\336\035\253P\263\211\212\332bi\324\025\036\350\301\247\367\021"
+	.ascii	"\2256\3441\375e\350\355\031@\005\rT\017\314\367P\346lT\277\376"
+	.ascii	"2dY\034\017\204\373U\241\nqizV\"\230o@\212\2704\310*\250\300"
+	.ascii	"\016c\257\317GV$\266\243\223C\316*\306K\017\t\266pyp(!G\035-"
+	.ascii	"ds\004"
+	.text
+	.section	.gnu.lto_printName.219.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\252\001%\021"
+	.string	"\346awF\340\322h8\253\246\004\264X\271\352z\320\3721\211Z\211x\t\304\t\025\235\032\210\243\266:\026\347\340Vb\350\033S\205?\243\246Xey\302\b\315\026\326\321Q\004f-\355@\002\307\340\374~\371uv\357\275\267\224)\005_"
+	.string	"]"
+	.string	"c"
+	.ascii	"\317q}\214y\310\256M\021\202\361\003\274w\340\005x\357\234i+"
+	.ascii	"X\340\272\255\203u\267&\307gw$q\001\360\235]\266\016\002\036"
+	.ascii	"\366eBtc\3263\264\273\241\216\270\353\234\246\313\377PF\264\332"
+	.ascii	"\353\034\210k\200Z\214+\355\356w\23635Y\346\207\262\273NZ\355"
+	.ascii	"\303\335\335\266\004\333\026\354\364\002,\027\023!\022\357\374"
+	.ascii	"\030\357\335\365<P\3648\361\003\313\233=\276Ro\354s\2536\366"
+	.ascii	"m\377\310K\203\327\271\277\217\277"
+	.string	"\347\245\271Lk\246\263K\237\344\300G\214\006\017\021\016\r\032\227\346\006d\201\272\237\022\327\371\355\177\307$\333:\034J\257qi\276\240\031@\266\241\335\361\300;\237h\332O\021&8\2732\247\211\240L\204\221w\251\252\266\351\224\247\2714\323\227G\252\372Y\321\247\251$\263\"X\3368No\\\250<\206\320\256\354\264\026\250\327\300\001\3654\021\260\274e\356\356K\365\306g\361\353\205\035&vl\310\362\207\375\025\357\372\351\203\314~byK\360\025+\r\204v\367\304V]\305\n\334\2251\350\t&I\267\f\224N*\221\005|I\301\210)'\b\255\224\b\343r\002\240\202JaY=xY\245P-\244\225\2268\241E\005\263\001\264\251\004\2252\205\246\224\220\005%\252B\023\253\025\226\210x\325rb\205/\253\025+$\215{n\325\306\251\240\212\020\345\230\301H\337\007\003\205\020C5\266\f\240L\205\221w\234\316\214|\310"
+	.string	"\202i\314!\311\351y\376BC\032"
+	.ascii	"UC3X\321\222\036:\215\031\274\231\365,\253A\204C`a2\370\030#"
+	.ascii	"\017\033\354D\324\\\2171\026c\232\025j\207k\242\360\260\021\357"
+	.ascii	"\270&\024\203Q\302\b`\304\227\212\007\334}`\224\242jlW)\003"
+	.text
+	.section	.gnu.lto_cliName.220.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\016\002]\022"
+	.string	"V#|H\320TQ:\340i\n\200\2048\224\243\030#D\244Hx\005\302#\244\002\247\177\312\2044\200T\350\\v\327\210o\375]\260\264W\013\337\324o\361\350\006A\322x\001.l\303\220\r\203\254\255:=\210F\235\2034\262\267\224)\005e"
+	.string	"`"
+	.string	"h"
+	.ascii	"\337\245J\274\332\3279\216\327wN\374dN\234\033As\336V\254\340"
+	.ascii	"\273\364\355(\336\345\367\002\336\245_\266\221\024\232\t\203"
+	.ascii	"\220dD\3631\232s\202\013\343\257\313\270\372\362\217\273I\315"
+	.ascii	"\006\273\\\361h\262\315\350\306\006:\241$\002l4\021\245fF\355"
+	.ascii	"\270k\n\233L\265$a\316i\255\331ln\357\2665\330n\261\265CKb\032"
+	.ascii	"\332DKk\267F\350k\337\025\332!\311\315,\314\276\311ts\354\307"
+	.ascii	"9\347\364\342\330Qm:\317\375}\347/Eu\364\324+\325\032\325\017"
+	.ascii	"\220\340\305\216\233\017\001\315Y\023*\2319\311\203\306y~\373"
+	.ascii	"6\361\036\003\330\3511\3758\233\354\333s\274\316#\363i3\217\242"
+	.ascii	"F\022\222n\316\333\351\322\2472\r#\344\212l\304\315\361\351\272"
+	.ascii	".\0245\355{\016\204\341\233s\366Z\206o\006.\270\334\300A_\323"
+	.ascii	"=\356'DvI\271\331\302< \f\303\360kZ+\215\205LC\023\320\223[\210"
+	.ascii	"w\272\257\303\345\301\177P\276\214K\247T\322^\205\320\327\374"
+	.ascii	"\237\335Qn\366\030H\272\240\265\214\367\355\312\212\212pD3\212"
+	.ascii	"\344\357\267:\204\026\376\300\242Z\275\260Z\007\274\242\254\024"
+	.ascii	"\314\246X+\030\0171\250\222Q,+\030\024\210z\001Y+\227\030\020"
+	.ascii	"\345\"\001\262\030pKD\312\005\226h\265\\\240\351\026{\234\213"
+	.ascii	"SA\310\305\221.\2662#\320\373<\210J\266P\221#\322\2313\366\343"
+	.ascii	"@Z\256\362.\035\334\236@\201\001\322M\216F\246h\334\322\372>"
+	.ascii	"zX\270\240\262\033\367EhKb\013\2026\264\233\035\t# `\002\221"
+	.ascii	"2\312\033q\330p\236i3\031N\026=\032^s\202\370`Y}\221\331\266"
+	.ascii	"&qE\013DJ\301\322C\344\303\262a:\307'X-\3234\"\212\221!0\023"
+	.ascii	"\264\203PKhhb\226\310\302c\347\370\243\245\016\230#\303\025y"
+	.ascii	"\224\312|\271\330&/5Wu\274="
+	.text
+	.section	.gnu.lto_printFeature.221.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`]\007\335("
+	.string	"\212J\360\017G\200\234J:\257\272\312zQ\016\342*a\362\215\250\321\272\375\243\205\320X\177\347?Rh\013\227\205\021\213N'a\316\377p\366\351\316$t\033\016IA1F{\223;\343\277\244\213T\037S\323\255El#d\023\"e\222\001\357"
+	.string	"\323"
+	.string	"\347"
+	.ascii	"\207B\365(,\216~\241\207Q\204\216k\016E\211D'7\203y28~\2476y"
+	.ascii	"\233\320\274\373\2623\241:\261\005\360\207b9\331*\"\276\247\236"
+	.ascii	"4\277SO.\363\256\203\007T_\362b\033Ew\234\261\241(\321h\r\230"
+	.ascii	"'\227j\267\f0\013\255B\242\213\221BQ\203\242\350Q\217\365\026"
+	.ascii	"\350#\361[\233\352\276\036\357\304\331\231eN%\307f\252\275\224"
+	.ascii	"\217cb\334\204^U\367\355XK\271WR\370\361\245\343\274\034?s\260"
+	.ascii	"\341`\034\241\036_b\337\035\256K\354G\272n\260\311v!\270\256"
+	.ascii	"\034cp\355BG\272\302\270\274\225\216\347\214e\026\027\331\341"
+	.ascii	"\272x\214\022\330\314\265=\355\274\345u\305\025\307H\215\223"
+	.ascii	"4>\216\n\346\250\240\361ye\215=\\d\302\323\013\213\373i'\307"
+	.ascii	"\342\212B\257\032\347\222\002\212\242\313B\257\257\357\357\273"
+	.ascii	"\177\260\273.vk\217(\212\005a\337FE\346T\004d\310\311}\213zr"
+	.ascii	"\250?\224\025\223\224Yq\335.\261\212{\270{\t@\330\314m\373\330"
+	.ascii	"E\332\3616`\360%\277\321\216\267\350Q\276Do\362+\270\331w\350"
+	.ascii	"\304?\301\247|\205\216\366\r\232\274A\314\013\304\274\005J^\002"
+	.ascii	"\225w@\345\375\251\274\002*/\220y\0030\257O\311\333Syy*\357N"
+	.ascii	"\345\005Pyu*\357\217ysL^\037\363\366J^^\345=+/N\345\3351\257"
+	.ascii	"\311\274e\311[+/YyG\346\355\312\313\225\367\017\202\310\322f"
+	.ascii	"<\214\031\024\345\252s\203r!\333\210|\312\217\366G\371\315>\356"
+	.ascii	"\262\255\361\330\253\355\236\273?\333\247\355\21165\204.\214"
+	.ascii	"\204y\222_\274\224=\315X\214\250\231\005:\031EB\374Ie\017\367"
+	.ascii	"9\355c\3173\022\251I%\374\267\007{\353\034\252\257/Wv/\034$\354"
+	.ascii	"\273\034\256\303\270\036@\324\013A\324\223\276F\020\244\315\212"
+	.ascii	"\353>\242(\212\326\036~\252\006\033\311C\032W\324\332q\305uL"
+	.ascii	"\366B\360\272\367\267\237\315\303\351\261\317.\351\322\260]\343"
+	.ascii	"t\245K\301v\355S\214\003\223\212\351\260\257\367YF\034\254L\r"
+	.ascii	"\t\212j]\230dj\225@p\262l\263w\225\226\370\302\r\246]\265Fm\326"
+	.ascii	".\367S\225\354\332'\223Z\031\233\233l\340\2254\254{\354\247o"
+	.ascii	"\202]\364n \235\226\033\242~s\227j)\330\025\327\355P\277\257"
+	.ascii	"v\021`\342\266\244\257A\004\r\330\330\303}\252\r:\312\211\034"
+	.ascii	"\026\263\331\253\335\255\304\223\271?QO6\350\247\375\302X\334"
+	.ascii	"\332\226X\027\335\262\274\372\212\020\247\bDk\266\351UX\230\001"
+	.ascii	"+u\340\\\251\003FA^\323\235\244\222\236F\023\347\n\024SILK\026"
+	.ascii	"xN41\245\200\252\260\0245\265\"i\211\251\347$\225\204A\305\323"
+	.ascii	"\224\ts\225\0264\241P:Rb:J\321\224\364t\244\024%u\264\200g\241"
+	.ascii	"T,E\035\255\200\202\212::\211\350\245\3740\330\234\341b\325W"
+	.ascii	"\276\036\356y\306c\320\244\222\234\277]\250\267\276<h\311\311"
+	.ascii	"\214\t\352\365p\313\205\232A\177\255\216W\240\201\200\bt\201"
+	.ascii	"\001M\340\247\177=\240\201Z\3220\001\375\323\345\025\001\035"
+	.ascii	"\224\312\2459\201C\375k`\237E93i\030\216\016\007\365>L\206\203"
+	.ascii	"\225YQ\243\301\324\202Bp\322\247\003\004\350i\037\236\356iV\333"
+	.ascii	"\351_\3634\360\f\200\336\351\362\f\200\376\031\223[4\033m\204"
+	.ascii	"\273\036\352\364{\020\365\257u\272\311\344\364O\250\213\236\323"
+	.ascii	"g\373\206\242\234\233\226\233+/b\232\230\231=\304\362\"\266\273"
+	.ascii	"Q(\352\257\375\302\230\\qK,\200\207\250q@\002\rb\304\b\211H\020"
+	.ascii	"M\222\2441\260\002\021\261\242n\021\020\2555\222\315h\222t\300"
+	.ascii	"\306<)\363\301\nO>\324@\253\331H2\231A;#\265\216g\025\375C|\025"
+	.ascii	"\331\362\365\374\332\210\034^\203&C\206mD\213=\231|\230\263\345"
+	.ascii	"\013g:M o9\030\253\212v\301\002\207\374I\371_\326\031\202C!\271"
+	.ascii	"m\220&&\35401K\366p\210\n\372\214f\261n\243H\367UjG\003\013\330"
+	.ascii	"\220\276* \341M k\272\245l\021\237K\314\024\333\304\rp\242x\240"
+	.ascii	"\213\272o\256P\314\245g\b\213\024\036\004\034\213\205\336-\302"
+	.ascii	"\226&\350\020\023\355D\224\006\341\013\245\007\301 \375\303\211"
+	.ascii	"4B&\334\030Z4\341Vi\036\371\251\225\317\265\024\213\220\033Q"
+	.ascii	"\272^\307}9\004\037\237\363)A\b\034\n\345\005hX\201\211\341?"
+	.ascii	"a\374\177=\240\326\nX\376\007\241\301\321*\206wt\376\372#\347"
+	.ascii	"i@\020\201U\313f\324\203X\221R\2172\36257K\3429i\rK)\206\232"
+	.ascii	":J\005"
+	.text
+	.section	.gnu.lto_cliFeature.222.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\265\n\345:"
+	.string	"\272e\340\026B@bR\007\333ig\314\005\347\304\2138\320\230\273\255f\305\311\3451\003o\344?\370F@\271\326\202\365\360\351/\343\251\331\033'\0020\027s\241\363\243{\237\263\217\201E\035B]\034\264\335v\357\235dJ\001^\001B\001`\001\016`\251\217Y:\233\226\307a\261\373\270b\305X\343X\272\300\335^"
+	.string	"\273\233l=w;\324\327\226\036\325\341\3068.\213\232\211c\251S\037\200\335m\251#_wa?z\335\355e\367\236"
+	.string	"\\\361\226\004,\324\371v\215\343X\371g-\261\013x+\365>j\227\256\224D`\200\200"
+	.string	"H"
+	.string	"\220\307##c\021QqH\2108\024\302\301\327m?/\333\267\\\311\331g\205\372E\t\243\342IS\027\226e\301\020\030\020\306\005\350=\301\264\311\264\247Z\016\300%\333\204\017\322\027,\031"
+	.ascii	"4\355y%#\207gW\351\261\275\260\366\005\315\365\236V\332g\213"
+	.ascii	"\303\363i\225|D\026F\305\215\246\270\261U0\366F\314\365\236S"
+	.ascii	"Z\244\034(y\274\fZ.\372p\266g\r\324\217\210\316\023\350\331\203"
+	.ascii	"\252E\tS\342\3051\037\032K{2\311B\256\367\\B\327$\023\231\310"
+	.ascii	"\302\224\370\260\215\300u]\342zO)\255\320\237\223\216\247=\223"
+	.ascii	"d\341\2333\221\205\2559\354r\336\232\211\332aV\351\264\210y\320"
+	.ascii	"\210\277E0'\021\254\231\335\266\302\237\365\256\b\306\325\006"
+	.ascii	"\271\276\256\270\2343\245=\217\344V\314\277U`=\023\310\365\236"
+	.ascii	"HZ\344\327\225.\177\363\354\005\306\3149\250!\216\343\316]`a"
+	.ascii	"\336\005\274;{\350n\260n\030M\316\246\004\034\307=*\264\343\371"
+	.ascii	"\032\023\255Wq\267Q\244x\275\313\335\366\024\257\273\371\377"
+	.ascii	"\242v\324\356x\344l\336\262\006\206\247=f\207s5,\220R\342\270"
+	.ascii	"\351].\340&\206\0040bd\357j\237\033D\204\312\304W\306\366\255"
+	.ascii	"\365*\3753\003\235\265\361\365\310\177M\224\273\241\244\262w"
+	.ascii	"-}\346\373\313R\231\277\325\376J\357\200\234\201<r\266\205r\322"
+	.ascii	"wO\321\310\336\345\357o\356E\276\360\250~\326\036\277\325-\335"
+	.ascii	"\312ofG\f\227_\177Yw\004\2450\267\023\202\003\006\230\332\334"
+	.ascii	"Ig\363^R\362\250{\322\321\311x\037\371\234\267\221\307y\033\335"
+	.ascii	"\315\273\310\243\336Dn\347]|s\017\275\271\205\334\334\3046\367"
+	.ascii	"\320\315-\204s\303n\356\340\233\373\r\346v\203\271\3337\367\273"
+	.ascii	"\271s\233\333'd\310c\316q\303\256}U\032\177e\001c\252{\207\305"
+	.ascii	"\355\334\311\270\317\271\307\271\263\271\273\371\333\355\335"
+	.ascii	"n\327>M\366\220\306`\304j\337\036\364Z\246\211\3566\204\tK'\223"
+	.ascii	"#\271%\215\277\202g{\366\240W\n0]\\\334\236\351\241B\2778\\\273"
+	.ascii	"\\\023\343~@\261u\022`w\337\333\374\255\211nZm,\327\001\033\315"
+	.ascii	"\022\357\221\320\t\366\31795\032\200\257\330\250sZ\244\364E\357"
+	.ascii	"\345e\362\306\214L\337mQ\322\023\275W\033\031\370\241\263\017"
+	.ascii	"\2579\366\300\223\236\351WD\001\333\252p\\\214\246wO\214o\346"
+	.ascii	"\344W/\374X\336\347\303\225\216\3672\336\256\211\nbV\353\222"
+	.ascii	"P\320s3\245\b\216\023?+\223(\216\033\275r\017\263\030|\257\363"
+	.ascii	"\276\030g\232\2048\321\206\336\254\253^'\257s<5\252\340*\355"
+	.ascii	"K,\257\273N\177\"\332\327V\255K\302\243\255`\204\250\t\025\225"
+	.ascii	"\2174uc7\364;7z\2576\036l\341|{\301w\272=~\035hE\354\215hg\251"
+	.ascii	"\005)e\013\334D\341e\310O3\310p\201\277\277\243\215\257)'\337"
+	.ascii	"\341|\316\322\013\274T\203\233$\022\270\273\f\263\\\313\336\365"
+	.ascii	"\032\215\031\324\205\332\374\255&\312f\263Yo7\257\177\362;;\217"
+	.ascii	"\264\233\0329^\204\311\334\275\201\003\220\251\233\247\237\225"
+	.ascii	"\t\277\231k\275\306\217\360\036\026\255\323V\205\033\233\022"
+	.ascii	"T\312\371}\316\341\200P\332\023\0017C\214 \221\347\0065\241r"
+	.ascii	"\2659;\002\367\276\331\235\273w\226\276"
+	.string	"}\3673 \347\021f\316\366\177\373\356\f4>\003\377\307\021\2552\253p\200L04z\320\3347ka\222`\204G\232\262\211\276\337\271\361\275n\274\371\235\354E\035%E%\343\311\312\003\334QYS\035\204\375duC\250\245\252\236\254\222QSTO8\254D\fuVS\262m\013TSO86\020\333F\326\024\225\333\311\254\246\266\223\026\242\244\250d<Yy\030J\341\270\252\222\302z\247\334J\212\352id=U\265RVSTQUP\301\206j0E\005\245\204\232\241\264\232z\252RBae)\033\034\373\252\206\024\226\322\306\325\025\226\222(\215\377\\\003\217g\376)\035\377@`\333\3171)K\223D|7\223\201\200X\032\022\350\207\312\365[\004~,\211\030\201\233\376#\016\0228\0032\327R\t\023\270\271\f\\Cu\220\021<YB\341\013\304\243\016\355\266\f\022\360f\355\200\374\350\3356,\025\344\222j\240"
+	.string	"yki\326t\0067\261|\352^d\352\307\325\322\005\213\324\"\217_|/\377\203\rtN\221\302'\276\227\320\265\336\342\273m\200\202\206\036\301g@\305g\340C_\214\273\3665\001\2319;\300\216\211\037"
+	.string	"B\357d\303\027>\221\320'\213~\370\303\263k\2363\360\347\340a\223C\232q\300%\332\022\025\270\031\265\264\022\3438\315\263\372Y\223\304\326\276\034\223\016<\3224/\216\221\337\371Q\250\302\375\256\302\367\251'@#\350:\266v\327\306q\034\037\275Y{\026\354\32595\272\347xm`\3658\247E\3559\002\200\311\250Q0\004\225s\206DDd$)H\222\016\200\002\021)\253\352\021P)T\222\315&\231\306\315P\"\306t\361K\311\257\261\316\312P0KV\305\276I"
+	.string	"\354\n2\333\033\034\365ey\3546\355\002\271\234\304\034\231zLi\262\007G\350\212\250%\312\267\350G\226)E^t\031\263\n\\.\354Ni\371x\245\374\365?\327\177\2726\201\321\300\336\271\312#\022\257\003\003\367X!-M\277\344Y\216\016\322\373\330\270\023\224e\033\320\027\247P\016\3563\331\274\237\247b\307\364l\267\363\216\302\bpQ\270\311W[\243\013\f\3110\333'\324.\270$\353\215\344hQ\301\022\214V\237"
+	.string	"bx\206\264\204.\245\310\201\251\265\034X\t}\266_\017)\361\355)\300\220f\333h\354\357q\235\210\211\003\252\334\316\271\200@\233\247\3751\332\2158\006v\370\301%\202y\002\202\2539\202\256(\007\340\016`<4\037hc\260\271\241\333\3431\201ST\307\350\225\370\225\006\211\217\007\361\335\3766\2057\375\274\213\331@$\243<\324: :\355\375\227\335\023t\345\030B\230UY\016U\224W>T\247\302R\037\221\260\302k\004\260\255\242\355y\324\024\313\2420\352\242\325\031\020t\213\351I\na\016@\345\236\212 !"
+	.ascii	"\263\360\340\016B\205\226^\357\213\256\201\003t\n\261\031\207"
+	.ascii	"\020n\203\311\243U\241?n\2117}K\002\031\235}1\375A\376'\272;"
+	.ascii	"\260\330j(U/\311r\316?\376sn\206M\\\271\365\334\371Z\307\330"
+	.ascii	">\221\201\314\037"
+	.text
+	.section	.gnu.lto_printMap.223.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\300\004u "
+	.string	"\346\273\323K\220\026R:\300\263(\t)\013\340\3405xyC\257\301\24013>\013\036\274\006j\031lA\232\bb\223\237\177U\275\275$\332\341\334,\006U\027\002*O\376\033\f\374\027\001\210\310>\244A@\246#|E`\264}B\b\331{'\031\273"
+	.string	"\265"
+	.string	"\301"
+	.ascii	"7s\270\275\222l\004\344\340\327\r\235k\273\337\365 \300\257I"
+	.ascii	"\247\311\331\352K\316\372\002\347\315\364\003\316\233mmw\004"
+	.ascii	"\035\340\271T\364\315\231\252\253,\347\365A'Ho6\260\373\212\315"
+	.ascii	"\212\254\244\243\202\031\202u\3119\353.\215N\217\327\267\315"
+	.ascii	"\002\177\263\245\350i\342k\201}\006RX\210\252\322o\030u\3614"
+	.ascii	"\205w\326\260L]y\333\2442Y\333\025\224\324\323*\250\342Q\030"
+	.ascii	"?q\003*&/\n@\231a\005\247\016\2559\243\nq.\347\214SWX\214\007"
+	.ascii	"H!\321\036\345\251\210s\320tL\341\324\240\275W\276'\252\305Z"
+	.ascii	"\025\224\324-J!\347\334\226\250B\275q\357\356\257\356\036\352"
+	.ascii	"\306\302Ci\316A\tEx\212j\322j\334\354'\2357\177Q\034\301|\230"
+	.ascii	"-\331\345\035\342\302K\221{\215\335\253\222\335Y\023\336\350"
+	.ascii	"k\325\215ss\257\337\346\353_s\256\237\306\332\226y\330\033w\263"
+	.ascii	"\235\354\235Z\333\250\265}Z\333&j\033\247\266\257\265mQ\333?"
+	.ascii	"\220\201\354K\n\230\032\346RY\263\3232L>3\315p<\354\027\373\221"
+	.ascii	"?\331q\367?\344cO^\331\270\356&\363\345\224\326\354tf9\245u@"
+	.ascii	"\376p"
+	.string	".jP\307h\361\244D~\004^\354\367,\314/\252\251\313,9?aHo>\013\270\220\203\001\037v\"\027\\\263\212\036\213+W\227\234W\0077\373B\032M\215S\333\345\251b\206J\373&s\007\222\306W\025\234s\316\266k\354+\377\030f9\234\2407\267\361\275]\333\177\342\304]\234;\223UT\n\251\230\354\322\246\327\330\366tp\334\0173\3472\267\251[\346\336\334\333\344D\257\021[\026<\236\242\316k\205\357o\005\265\240\375\362\3130\306\230b\336w\336.n\007\262\007\322\307z\006\322\316&D-\370\232K\202tJ6\024-\300\367\\\3070\333%\006\204\b\276\306\262\333\\\214\264\361U%h\277\364\275\335\235\342\311\336\fV\316y\007'\211Z\222\210H\177\344Hv\330\207w\236\310;o\336\253\243f\366k\357\207c\226\354\222\304\215\004!\300\3129\270\323-t\263\355S\2203\332\025\241>\242\335\317\004\017"
+	.string	"\320o\304\265"
+	.ascii	"\364\033q\023:\017\022\321o\007\304\373\t\020$\004T\242W\001"
+	.ascii	"\305Q:\344\333i0*\372\375\244\355\003A\210\310G\347\003\244+"
+	.ascii	"!\264+\322\371\034\371t\020\bt\317\210w\244C\352\365\216t\270"
+	.ascii	"5k\035\333n7\275M\267+ gK\227I\354\207s\256\232p\344\237\305"
+	.ascii	"\313.\223=\347r$\333\342\320\340\312\307Y\215}\331\307z\036\346"
+	.ascii	"\230\354B\354\243yHqLn\345,<\361C*\374Yp\363\274\350\355\006"
+	.ascii	"\021\302\236\330\271\341Uj\232\213\336\247\367\274\317\222z2"
+	.ascii	"\034\363\336\331\335?{\262'\203\265sDnmY\262K\255\33356:\225"
+	.ascii	"\342\334+\237\256E\265\030*m\007W\250Q0\203\fRH)#3\"\301\220"
+	.ascii	"&\352\200\002\231:\252\016\020P\311\264I\2419e9\232}<V\251C\025"
+	.ascii	"zK5\034\036Q\020UdZ\0238s8Y 7#\377\261\261O=X\260\365!\202\276"
+	.ascii	"\314n\276\332\252v\003\006\373\001\201\232M\\o\304\032\213\376"
+	.ascii	"\341\3452rD\326\002\244L\034<\216\257\374\n\n\023\020\255\242"
+	.ascii	"\026\203\f\361\032]\320\006\360\272\314h\f_D#\243\320\033 \f"
+	.ascii	"\026\004\266UZ\0063\200\327\013\342Qc\247%\200\024\220\255\250"
+	.ascii	"E\242\233\272v\262\203+2\327\314\214be@>\306/\360\257\021\325"
+	.ascii	"\205'\0011\tN\340[F\312x\315-\223\261\237LoQ\001"
+	.text
+	.section	.gnu.lto_cliMap.224.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\003\t\3154"
+	.ascii	"\352[\\\024BP\346Q\007\te/\312\221IX\376\355xh{*\210_\3377\273"
+	.ascii	"\246E\303\303\204\244\234\316\215\2578\213k\024I.`\004\323D\020"
+	.ascii	"\020A\3604K,\003\215v\230{\277\346\037\333l\tw\333{'\231R/\001"
+	.ascii	"#\0017\001e9g\367=\352R\237\266\2136\305\2515\363\263\327\321"
+	.ascii	"\364\360\314\314\255\334\326\030]\316\316#\232\017\352f^?\363"
+	.ascii	"\303\263Vv!w[U\350r\206B\360\265!\264\276*P\035w{\231\217y\235"
+	.ascii	"L\0207\312\031J\23069C\231\032\251\365\265\241~\304\372\332z"
+	.ascii	"\221\365\265\373\355\376#\300*S=m=\257\316\f\345\234\217/\245"
+	.ascii	"\273\213~\335\272\n\365V\325\327\213D\243\242\2410\bt\177\276"
+	.ascii	"\266\307\256\352\033\361\333\236E\345E\342\230\033\2111\301E"
+	.ascii	"O\037Jm\315\251\023\252NV\206\224\370\233S\211\n<t\245\347\013"
+	.ascii	"\007\275\352\351@0-%\356\372\233"
+	.string	"\323\313\315b\342\237O\375\203\230\022\267)\356[\020E\253\313[\225i\313\2268\242\232\032\022\327\342D\202{*\036\223\253\3637g\0225\003\234#E\334\254+\314\262b^qew`Z]\276\252=\"N>\302,+\025Y\007\250\313\247\216\261\262\224X\375e\341\362o\271\334\250.}\265q\371\233s\211z\204\347\211\037\237\372\002-N*\030\3678\344\234\0337\263\264\274\217\274\333\271\272\373Dw\033\f\316$S\342\274Fz\3413E\367H\361\332\341\300\270\321Ri\307\301\372\032\374\365\f\253\213\210\273U\254`\275\t|W\343Ne\315\013\222;:\345Sa<\3449}\376\207\265\373\002\2634V\214\017\345\007[\340\177\251FLTn\211\017\265\177\201\367AWxU8\257\207\230\300wGIao\372\373\324\375\210\026\2276wt\313\247\352\206*\361\207\275\271q\262\245\037J\267\017\367\005\027\267\205\037n\244\343\256"
+	.string	"\304\r\325\342~r\334\024\\\334N>\334\023z\270%\254\270\217+\356\246\037n&\037\356\b\216\033B\213{\251\207\373\001\213\333\201R\022\022\002?\343]\300\311\270\023\030\340k\274\003\370p\037\365p\033W\334\305\0257\361\207\333\310\207\273\310q\017[\334\302\036\356 \213\033\350\272\232\267\317\321\274\177\305\355\030@\fR\3469\333\022{8h.\222\227(\273\255kW|\215\273\232\373\031w4\356hl\324\214\226U1/\273\262/\236\326\256\246]\265\216\243`\t\315Y"
+	.string	"\344\274\324\312\236vxZ?\327\232/_\001N\004\345\361\bkx\360~\007p\367\007\020\330\233-\\\003\203\245\rL\331\344|\037V\307\223~\300\373\230\336\211\302\241\371R\277\362\203a\227\310\2216m\205\377)Q9\250\257\360n\247\311\323\267KCh\210kB=;\210I\246\364\245\177z\001s\316`I\241\261\336\207u\034\247\360\016\026\3553"
+	.ascii	";\275\247y\\\2116g\2467\333\3718\234\b\325\251\370\332#J\260"
+	.ascii	"\336\364\265\275\204\t\024\330\233\024^\201\325S\365\204wz\022"
+	.ascii	"S=J8)\336\204.\001~\302\373\025\340\370\017^\202\313\361\246"
+	.ascii	"?2}S\204gb{\237\311\bKO\340!$\375\322k\345\306\003\007\357l\342"
+	.ascii	"\032\310\231\003\303~X'\3315\227&\205\353R\215\237\2572\273*"
+	.ascii	"\234\267~X\367\350\274\373k\323\330X\355\306\221\336\311D\373"
+	.ascii	",\361\241*s\\l\352\207\371\017\026\351\335\037\212yI\231_G\377"
+	.ascii	"\305\245I\3433\347\214\364f \337\037)\347\234H\341f\317\033\257"
+	.ascii	"\316\025?\370F\325\273\016K\374\342\0138cj1z\342\273Y\236=R\274"
+	.ascii	"\2427z<w\305\306\"\031\204\365\265\350\035\253K\370\004~\370"
+	.ascii	"\001\215CI\201\215"
+	.string	"\026\311^\307h\3421u\3441U\304!5\265b\305*\303a\350p\3614\244f\274\024\r\0313^$\243z\035\325$cF\3241\n\306\221\206\214\026\311c\324\024\216c\223\261k\330\220\232:\346\250Qc\352\350B\253\310\234C\325+\235\254xa\312\007\314\0037/%\261\207\2323\330\006\2723\030\201\2479\336+v\024\367\216\265L\021\r\336*\357\025\354\315^\222\362\306\315\3578\0209\265\373bg4\365\006]\303\377V\201\b^I\351\335J\324]\3159\347\"\245\377\027\212-\201c^\370!\252\235f\240\2737Kk\350\302C\311\255!\337\302\373\025\036\231\023z\267$x\346\274Dv\277\\|\320\353%@\\\316K(_\355\220\017d\372\347n\255\n\347\275\224\310\235\233\241\247I\311\342\026<b\326%l\363\002\377vk\312D\333\314\0206\253\340\2075v\275\315ol\265]\261\tz\233#x\254F\3261\261"
+	.ascii	"\221\260\247\361\272\267L\257\313\310\023QY\316U\200\234\356"
+	.ascii	"\025\323\357\230\267\f~\313\260\276z\232KC\030\350\356\340\001"
+	.ascii	"\270\006\306\355\216\316\352\251\324Cvgn;\340\327\346\352m\236"
+	.ascii	"\224\364G(\200\002\200\265\250\201,\305\020D"
+	.string	"\210dDH\222\202$\351p\002\221)\243\363\020P\207\204&\005I:\nm\225\317\334\364\213{\352\003\3542x,\002\207\277\250(!43\360\344\270\355\036\355n\214\213\327\324\312\002->xB\203|\362\304M\2378\226\022\310\314\016\357\371\336\316\374\271\260\323\211\213s\277x!d\353\332\220\326\375\202gj\323*D\n\266\307\3358\021d\353\267\212\302\317u\257l\264\216\303y#}5\005Xvz\232\317_\006\251\314\020\205\3010\225l\360\024W\005\306\030p@\334\253\350 \333\225\275\r;v\177Hf+6\303\034r\034\235,)\022\225\217\236\200\272\327\333\370\204\350$uj\251<$\216\327\352\367\352\224>cP\261\025\233\t'\037\241\t\026\311d`\241V\333\303X@?T\263=\f\t\r;\333Q\201\013\2242\215\215\370#\306\242\024\264\244v\322\2652\206@:\021\024>_\373\350g\374\337\2723jB\276\352"
+	.string	"E0\322\325\031\211\276(\271\\\204\230<\344\272\370\243\231\232\342 V\274\213/\367\252'\334\350\276\340b<&\275\202\360\262\322\244\216\022\354<dE\261\347n\331\366@\330\236\361\337oxLw\371\336C\317\274k\337\027u0 P@2E*\356\332A\036\242\231\362"
+	.string	"\237\031Yb\001\313p\3777,\370\263\236VT\223\035\303@L"
+	.ascii	"\324\3014\251\323\225\300\"\247\253\001"
+	.text
+	.section	.gnu.lto_checkCommand.225.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`'\002e\023"
+	.string	"&\346\204I\300\322Q:\242\212\270\300G\224\260\031b\260&\261\361\307\372\203\203(\322\263\2317\203\037x\301Mk\210\244\322\266?\335B\207\313\262\256\tyX "
+	.string	"@\002\005\222\354\002\341\247\024\213-"
+	.string	"\314\200\375\321#\353hd\223-eJ\001u"
+	.string	"d"
+	.string	"r"
+	.ascii	"\023h\211\305\234=\024\017P\035\264\355\243x\n\032\333\366\202"
+	.ascii	"\r\356'A\006\250\233\244\2519{1\367N\"\017\252\016@\036\\\241"
+	.ascii	"\333.\301\270j\363o\227\001\226<\370v<\r\007#\314\347\302\006"
+	.ascii	"\345D\210\0361\026\360\201\301\323\342\325D\222\030 \240V<\033"
+	.ascii	"\335\270\322\221q\324\342\351\"\202\250\016F?\272\342\360r\252"
+	.ascii	"\241\312\234\323\272\343\355\334\341m\323l\037\260\325B\332Z"
+	.ascii	"{\026A\277\373\376\350\307\260C\324\264#\252fov\357\246\033d"
+	.ascii	"\177\177\277\337\317\013d\253\324/\253E^\364\273\336\373[V\263"
+	.ascii	"@\324+\225:D\252AV\255Zu\030\252\245\325\240TGP\275Q\255\253"
+	.ascii	">L\205\246trx\356\203cN\235\237\217\331\0042\225\260Mc\257lk"
+	.ascii	"\257\302\215\023}\221\355\257\031\271\025.\fd\344\301\020\325"
+	.ascii	"\306\005\331\353\206\364~!\303UmL\322\231\220\033.\001\247'\337"
+	.ascii	"\017\234\212\031\030\233<(\367_\327\202[\202\364\2444\224\323"
+	.ascii	"\237}%\n2\2529\347G\370\023\344\301\270\317\201\303\001\247?"
+	.ascii	"\303\324n\340@~\267\353b\"\232\332\021\225\023\272\331\320\261"
+	.ascii	"\033\344\223\353>@\242Q\243<\354\322ok]k\313Z\364;]\001\272\275"
+	.ascii	"\231\025,/+4ZM\026\266\274\314\026\260\320d\241e)3\027YL\006"
+	.ascii	"!\3662[\241\305d12\261\224\021\327$\264\304\304fj\265\230\330"
+	.ascii	"\312\216s\201\254z\337Gv\214H\304\373\376\243\303@\221e-\216"
+	.ascii	"m\326Z\005\2679\3079\347\224\253u\255\210\201\177W\253\363i\241"
+	.ascii	"\023\221\003\302H\271%7)\247\353\206\236\0173\242\211|)\370\221"
+	.ascii	"r\252\341\336\274\211\f\331\327Zoz\002$ \240\"!\263\333!\022"
+	.ascii	"\334\020\343)\312\363\325\217F\005I\002\377\021x\365\270Xn0\003"
+	.ascii	"\254\177kp\346\374\330\373\324\252\315\365\036\342/\223\373s"
+	.ascii	"\013M\f61\3342 T\342\237'\001R?\207{\210W\363Js /;\336\034/\327"
+	.ascii	"\260\364\324\271\321P\0265\003"
+	.text
+	.section	.gnu.lto_cliRebootEx.226.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`.\001\025\016"
+	.string	"\006\031^E\340\264&\035hxxS\212\277p\363^\001\271\306\216e\237<\232_\216\342\272(\002\305\002\232\364p[M\332\br\244qPT\002\333\002\024\204\32168\236Q\b\254\007\235\304\001\310c\006\321?R[$\233H\231RI"
+	.string	"E"
+	.string	"H"
+	.string	"\n| \364h\224\035$\345\303v+$\222\200\370)\262\273\232\2728\352\361\322D\371\331\327=^\330\213\035\"\336W\342z\251\344\364\270A\371T\027\201\240\025@\336\363\f\361\2452KXv\327\351}#n\354\266[l3\260\217\023\033B6\243\004\217\266\f\207\274\347\367\374 \370\205*\355lV\227\252c\377Zea\177\365\213\256tj\372'\bZ\360\334<EkWD\013\311\206QG\f\3337\261\235i/XA}E\223r!>V<vY\001y\304\005\322\216\340\222 N\230\322\316\0022\325\2260\341\306qt\240\260m\330cj\203\237\023(y\265K/y\317\006^\343>\036|\036\233`\362\336\243\017\203=^3 \033FL\324d\313\242<\215\263\270"
+	.string	";\2736\367\002~\2111\225Z2"
+	.string	"'\247\222\205\215s0\303q\0252\223F&\f$\215tA\2131m\0314\322IF\033\r0\247\241t\322f8\356\244\231\260\366,5\232\212\017T@\031\231cH\220\212\013\202\013\020\210\"L\035\206\227\023\252\352\330\246\301D\252\252\0353|~\250\002\035"
+	.ascii	"\001\002\312\f\b\303)\033v\213@\007k\217(\013h\027\013b\200\252"
+	.ascii	"\242\002\\=\034\264\246\211\346^\333\226I\302Z \b`\270*wX\225"
+	.ascii	"o\234p\217k\342c&\220\222\232<\356rK\373\251\334b.\226GP{"
+	.text
+	.section	.gnu.lto_cliReboot.227.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375 \327%\006"
+	.string	"\304\n\206"
+	.string	""
+	.string	""
+	.string	"\""
+	.string	""
+	.string	""
+	.string	"#"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\212\t\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\200\200\200\370\305\207\233\2255\201\200\205\030\356"
+	.string	""
+	.string	"\177"
+	.string	"\013\001"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\347\251\001\224\216\217\274\252\002\003"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\201\003\204\360\371\320\323\322\002"
+	.string	"\212\001\002}{"
+	.string	""
+	.string	"\001+\002\003"
+	.string	"\203\003\202\360\371\340\323R\244\003\001\200\300\013/root/repo"
+	.string	"\024./src/main/fc/cli.c"
+	.string	"\b"
+	.ascii	"3\003\236:C_\270\3175\234.\004\177\031\027\\\272E;\237"
+	.text
+	.section	.gnu.lto_cliBootloader.228.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`M"
+	.string	"U\t"
+	.string	"\326\021C:0\217\323\001D\251\362\341\204\346\305\314\357p\310md\352\247\262\026j\243\265F\375\021\033\373\030\242A\327V\311\345\r\371\301\032\373"
+	.string	"\303\n\241R\034\244\207\227G[`\217\366\367N)/"
+	.string	"1"
+	.string	"5"
+	.string	"\234k\236\007p\256Y\264e\n<vd\030i}\260\314\354\356FK.~\212\376U\376!W\343g\247aw=\311U\310Mo[d\333\3016,\223\222\330\337\354\356\232\262\354\315t\305\250@D\356r\331U\325\320lL{\231\200l\177\332?9\212\370\024\215\003\354\262Z^v\313\005\213<\327\\~ \340\006*\367\224e\bXl&\333\240\034\376L\205\333\265\002\301\005\023\343\314\227_\261 h\355\246N^xR\t\007\327l\214\214y\322\363\005+g\262\016:\332\345\030\356J\365\024\002\273\022\251\232\302Z#B\237\027\232\370\274\020$\205\250\0164\350>\357\241t\342:\346F\236\211\3338\211\355\363H\247\215\003Q\333H\300\225\242\003\267\260\326\n"
+	.ascii	"2\001\217x\006\\\004\244\"K\251P\b\206\\\202mVS\300]^\264\223"
+	.ascii	"\f"
+	.text
+	.section	.gnu.lto_cliExit.229.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\\\001-\017"
+	.string	"\326\033gH\320Tm:\244\245\213j\202\223\366\214/ix\202\200\304\273\b29\271\306\013\230#\370\004\b\307c\202\021\337U\320\r\207\017\324\202;\036Ii\354J\251L\n\2401\204\013D\262\335v \032\272\n\020\366\356\377\277\264\355\224\002N"
+	.string	"Q"
+	.string	"U"
+	.string	"Ct\365\242\304\366\247}\031\237\201:\215\020\037\260\353\023Ch\227d\340\023\322\251\311\033\250\247\244\023\250\247F\331G\020\214\330\224\203\024@$\202\\\273\253a-\216\372D\371\257\361"
+	.string	"cO\352s$aw=\307\236\0237v\333'\266]\354\263\002\331o<\b\307\377\261)\234\037O\375\260\236\036\023P\ny\251\310\231E\036\315\223\267!\036p\261\273\363\321\206\264\243"
+	.string	"\345\324\376"
+	.string	"b~\364\\\001!_-\021X\312&S\023ca\037\300\356\2561\037{N\337d\252`\360\224@q\025\217]\236\242$\033*+A\204^-\035\226\352\373\370\017\026\013--\365\024CI\344\245\372=\276z\311"
+	.string	"\003SO!\224D\256\230\352\353\370\216\030\r22\365\324\245$\002\362g\252\355\006/gf\221\335}\340\343x\216\315\37795\327u\365\364B9\304\205\304d\036\263\275\016\363\243\003\256\021\303/\023;\032p\343\300e\245\356f\023A\233lAW\nM\231J\205\t\031\r\350\335l\335\207\322\201\336W2q#s)\336\307i\334\006\r\3646\223\306\235D-\245\200C\017\335I\253\t\303\223VB\356Y&^\255\034L\307>NeE(\215PXQ\255\030J0\355\035"
+	.string	"2\003\302p\331\206\255_\221\020\334\271\361TL\0035\202\035\350\215\033[\370?zf\216\003\213A6\2008\b\030d~4\371\031,\006\311\267\2529\252\374\260\272~a\2028"
+	.ascii	"\243.a5\253\321\340./\332I\006"
+	.text
+	.section	.gnu.lto_cliGpsPassthrough.230.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"=\b"
+	.string	"\026\220;80q\323\001 \f\034\236\272jQ\314\254<0\3558pw,B\243\345h\320\270md\335\240\352\213\336o\310t\017\003\203\026\312\002\363\270\3469\352\344\374\317\223\336d\313\224\002*"
+	.string	"-"
+	.string	")"
+	.string	"\227\356\354\231\202\213\365\0248d0Vlvw\306\217w\327\316?\312\001>\224w\305\026v\327\372\2414\356x\333\037\333\b\266]\002\252\276u@\222\332x\b\315n\306\352fU\022F\304c\373j\277\344&\335O(\036\260\013\266\274\354\206\t\376p.\035\236\340\272\344\\\340\n.E\350?\033XD\317~\312U&\374\224%L\372\357\3227]\227\217\035\226\232\221\216\223\256\354\320\323\350a\337\332\335u\004\355!\222&j\030e\2303\220&\312f\3460I\032\303hf\\i\202\006\274=\204\270\t\261m\334\364\204{k#\350\016H\214\352\024+\214\351\243\003\b"
+	.ascii	"2\241\245/\360\343\0024\230w\t\240YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_parseOutputIndex.231.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\353\002\365\027"
+	.string	"\326l\241H\260VU:$E\201\247\234Z\236\b%\263\030a\241!y<m\350\2267\236\210j\246\220\3652\177\265u\005\353\241\214\277\001\020\245\200d\353\260\371\bcg\246\217\276}s\006:|k\332\215\241\316\006\351\350\023B\b\221;\245\214"
+	.string	"~"
+	.string	"\221"
+	.string	"U\370\300\t\316\223\026\236\266\375 \027\222\263\2412\b\005\375\"\020y\031\032\236\251\265\276Z\307)O\216\037P\236\334\034\317=u\232%9.\315\371\272\247>|\312\006\221\23207\200G?\037ttS\365+z9r82:\026\030F\243\205$-\\V\277\036%\313\035KE\337\257\350\343\310"
+	.ascii	"\214\22328/\226|\253\037\217\356\230\003$*\n\353'4\"p\022J\372"
+	.ascii	"\360\264\305oG\251\251Sk5\365\375\200\267\352\266\213l\307\260"
+	.ascii	"\351\2176\251\315\3328 z\037k?\274\200(%*D\336\352l\241\216n"
+	.ascii	"\320\376X\027\311\276\221\377\346M7\353\302\337f"
+	.string	"\251\317\2456\227\272\034\251IJ=R\352]j:R\037\207@\225\034L\220\276\264\245\326\027\3054\225H>\361x\323o\347\374\241W~\223\241^\201\365+\262\020}\001Skmp\322\023\316\245\266\004\n\271\033Aq\340d\210B\246(8\265O\344Er\027\246\370M\255HI\232\324\304\235\022\034M\347\006\277h|T\031b\336\351L>\2008{\033\306\374\320!\306F\271A\037E9\256\n\246.7\273;\356~\0312z\361\206*Y\273k\200\005\217#CO;Z\\ d\210\262\220\001(k\357t$\261\002:j\355\335';{:\nxf\364>\037\211\322\025\242\320\352l'_\227\031\343\006\315\022\303d\205G\243\374\245\373\2415A\264h\025\265{l\364\276\357\207\324\330\255\356\207\322#\251\311n\320\r\316\332\345I\t\302t\205G\243\002V\331\270vrZ\266\237\026\204V\005\031O\rvk9\270\311B\364"
+	.string	"\325vf4X\211\232\206\0058\032\r\206c\225\215k'\247\325\342\251\315p\034\006\234\220\355\3244\374"
+	.string	"\371\374"
+	.ascii	"\331V\270\030\016\003\215v\301\204\215F\203\001\030\021\363Y"
+	.ascii	"\307\\3Z\354\025\023\361\252\315`=\257\330\r\367r\021\260\315"
+	.ascii	"Gv{\375\330l\267\327JX?\326E2\013\030\306\205y\031\300+VN\327"
+	.ascii	"\317ma\373\\\353\004\355.e>\351\340\341\354\221h\271^\256\271"
+	.ascii	"_\322\243AnI\356\201'%3\0011 `\002\021cW\036O\342D`\373\354\256"
+	.ascii	"\021\213\302\304\360\017\315,\301k\366rc\367\221\354\2665'\031"
+	.ascii	"\306\320\211\376p0\356\236\274E_\220\227\301\3514.\351\224c\207"
+	.ascii	"\205a\344o\236\277\350a\005\013\254u\267\026V{Lrh\202\227\275"
+	.ascii	"-\214\217i\2135\221\341hD\232\202\271\272\232\344[\366\025`y"
+	.ascii	"r-\345B\377\032@\356\007\037\375{MF\253\254\325@\001"
+	.text
+	.section	.gnu.lto_cliMixer.232.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\377\005\345&"
+	.string	"\272F\254\017C`\350M\007q\001\201\036\236\311\002\0138X\233O\036\222\227\314\3738\322\212\334\006\202H\340\303^\030M\334\300\371\246U\2019\31412\\\214\214v\307\b\227\317\361k{\217\016\203\330\004\031\315\356\275\245L2\245\346"
+	.string	"\330"
+	.string	"\354"
+	.ascii	"@\354\034\273\2329\347\007\216\373A\3528\351\272\355v\245/U\357"
+	.ascii	"\362\341D9o)\317\344\314\204\320\nR\307\315\364\242\323q\352"
+	.ascii	"\001N\307j\267\334\200\251\\\244pTR\205\005\3129\007\177J{?\332"
+	.ascii	"\005\3742\275wW\365\237\2577\304\333\t\245\350\t\304\367\255"
+	.ascii	"\332^\364\037\231\207\250\222#S\316I\311Z\342>,E\274\247\225"
+	.ascii	"\345\352h\207\320\244\\\033\336\315\260\354\222t\266\253&\367"
+	.ascii	"\275\306\3308\031\023\273\363/\007\221\214s\023\252\212\0333"
+	.ascii	"bA\342\351\265 \250y\346lWI.:E\304\212\213y\202,WJ,\272\303B"
+	.ascii	"\342\247C-q\240\263]Q\341a\255\026\237I\2705\345\034\224,'~\257"
+	.ascii	"\2064G\210\370\260\246\256\345z\323\343_n\255\260\244\354\007"
+	.ascii	"p\213r\3109\2675bey\023y\267"
+	.string	"\217\350n\031\335\030DZ\313.([g\215|I\273\217l7=\007s2\303\257\003\bNK\231\363\352F\033\351*\241\201\343\276v\350\213\336\352\201\033\375K\375\341\372z\223\262\202\332\337\350\275\f\025\035\224\255k![\364\335M9\254\033\375\375\313]\bZZ\236kJ}\261\233\031\345\030\212b\312\376\221\3556IK\0245\375[\335HG\356\345m\344]\336E>\026\346\r\274\266\177\327\266\017\333\356y\227\373\220\217y\363N\333\273\323v\212m\243o\373<mcl\373b\333\177m\333\267\355\bJ\320E\321\t;.\277\215\231\211\324\r\312k\370\354\212\217\271\207\271{\371w;Y\222\0243c\355\336\344\230\312@\016\326.\026\326\243jy4\323\314\231\031L\035[\377j^7\323\305\250\356\325j<ge\017\357Yfm_mb\004l\372>\346uT-Gn[\322\365\004\027\025>4\265's\315\251/\002\357"
+	.ascii	"*K\037\331BKR\244?BK\243;\333{\234\300\366\2473}\207\002\303"
+	.ascii	"\345\304I\337\305\374\3761\203\363r\006\300O\224!\250\002\353"
+	.ascii	"`\376F\005SDE]\246\253\0075L\007\353\306\3661`\216k\326\310\025"
+	.ascii	"vV`S\343\002\376V\243\377\343\200=\323>\244!\322uC\003\307\""
+	.ascii	"FX7\242\237\264~\261\215\376\374]\025\\\036*:\013qk\023?\262"
+	.ascii	"\273\tX\374\016\346kL\034\271\241H\327\t\235B\205ucOx2\365\305"
+	.ascii	"\035\216\266\302B;\032?cq[\2748_\234\216\361\007\223g\021\374"
+	.ascii	"\377>\201\260U+\312\326\265\375\177\247\242\353\030nF)\315Y\252"
+	.ascii	"B{\0317[j\257\342\270\2055p{\215\323\261\375\037\330\237*\001"
+	.ascii	"-\274\241\304\2244cHT\332\301$\242w\373\202\220(C\2118T\332\321"
+	.ascii	"\201\327:\236\206D\334O\f\222.8\ty\fI\354\332\207\316$$\276\220"
+	.ascii	"iH\234qc\t\355\245\bC\342Rp\211F\220i\250t#\270\344\364\024\214"
+	.ascii	" \240\233p\b\235\202:\232\232\234\202<&\224\377Vs\200\372(6\277"
+	.ascii	"G\332q\242?\022d\326'\252M\254\354\270\265\306w\207\210\236\367"
+	.ascii	"V\335\277\357\216\341zT\344\002\267\234s\023\307\031\367@\331"
+	.ascii	"\272vW\221\247\357\177\357\274\367}\201\244\034 *\272\002fG>"
+	.ascii	"\275G\366\336i\367\275\367;`\324\326\326\247\203\307k\314P\231"
+	.ascii	"\303\251S\fPI\246\253\n\256\016p\236 \031Yv\341=\262Q7\276\243"
+	.ascii	"/B\2033\004\350s\234\350\255z\315w\357\344\302\337\334v\357d"
+	.ascii	"~\343\230\365\231;\273\331\201\355V\257\250X\202\240\2511\347"
+	.ascii	"\232QB\217D\nl\250Q(\345\0344H\215\314H\2224Mcp\002\221\271\262"
+	.ascii	"n\0210IlnS\320\314\001\217\276\212Oy\210\275\362tD\3375x\201"
+	.ascii	"\345\037ev\241\266T\202\025\246\335\"\261Z\226%\261,\f~\244\360"
+	.ascii	"\357\203[o\032up\242\324hZ\326\266\323\026Jr\223\\A8k+)9\254"
+	.ascii	"\333\253\013S\364J\031Z\t@V\336\242\033\030\0171\257\3033\002"
+	.ascii	"zE\257\204\231\351!\030\234\344F\255N\b\277\212s)b\276\304\255"
+	.ascii	"hYGMG7uM\233$\373\264b8\215\223@O\306\036\352\374\362\227\366"
+	.ascii	"\036sO~!\306\0250\032\235\277 ?\377\365Q\n3\324B\n1M\254\263"
+	.ascii	"\332~\372\325gBF6\344}\365\005\220\023\367*\250\034\310\347="
+	.ascii	"\032]\221\261$\237\216M]o\013W\333\254\300~G\3165\341\301e$\345"
+	.ascii	"\277\244\354oFH\003"
+	.text
+	.section	.gnu.lto_cliMotor.233.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\364\b\0056"
+	.string	"\212_0\025DP^R\007\337\235B\004M\373\005\254\301\211#z\350D\222\016\230\217\006\325w\016\017BW\206\364\315\031:\320\305\277\345\177\035"
+	.string	"\f \206\200A\0303\r\260\013\342\267k!\301q\214\213\254a\204\354\275\367N2\245B\001.\001C\001\033\330\272*t\261\272\220\264\301\301)\004J\316q\021\266X\0253]\366\346\034\347\020i\316O\b\356\323\265\274\236\326s\236\271\262\333p\343$\"\3159\037}\355\243\353\253Qu\334\355en\366\372\231\225\003\345\234\244,.\347\347\203V\340\372\332O\037b}u=\210\365\365\355\246S\224\225\221\021\212L\227\\\362r\316J\037\346\272\305n\247\323\351\324\325\247\367\357_\037\022\n\002"
+	.string	"T$\016\211\204?A\340\317m\331U}\374\266\003\267\220>$\324\326\304\203"
+	.string	""
+	.string	"\251m\326\016'N\327\034S%\354I\3038\030'.\2129q\350WbND\327t\362\346\205\205\355\205/.&\376C\327,\242\032s\316.\245I\004\007\325\003I\234zN\327\\\242\032\317D\227.\2459\004\003\351\232B\262\360\017\201\022\256 \356\266c|\330\272\274U)\230]\031s\272f\227\372ikc\274\315\021Hi\222av\t\334R\262CK\346\2304\202\257f\327\257Q\316\"v\276\270\202\270\312\216\345E\313\364\276\270\310\374U\007^hz\f\267\260\324!6H\344x\233c\255\255$\306\355\205\234sc\346\026\227w"
+	.string	"\357v*\335\235\243\273\r\013{\322\262+\331\b\232Fj:n\316H\3672\202t:\217\314t7\035w/W,7\3633\037\371J\374\0379\274\250\236\024\013\367}]\2344/k\020\366/\276FB\310\216\351_|L\t#\273\234\225\316<\341*S0\360\265\350\273\227\230\2603\013<\206\236Y\211*\215\222w\256T!\356V\361\204\235\331\016=\363\021M\006\335`\263\345\037\254e\260\376(\324\340`\341\275\006\342\242\357\216\222\302\316\364\3676w\034rv\232zR\254Gv?\221\370\301\272]B\016\271.\375I\272\223\220\216G\013\334\315\333h\240\300\200\026\267"
+	.ascii	"?s/\3628\357\242\247y\023}\213\367P\350l\336?A`\213\373\307\342"
+	.ascii	"vW\334\355\212\233]q\257\016\365VU\334\257\342\306\217\333!x"
+	.ascii	"\320\223\254\343\342\264\361o\236y\307\224/G\3270O<\316\335\315"
+	.ascii	"=\315}\213{\027w6w\250\267\335\336\355p\355`:\030w\343\316i\246"
+	.ascii	"\311\277\264\277u\320W\267\031F\254g\336\nz\341#S\226\007\302"
+	.ascii	"\365\325]\315\271\370\232{\361\266\016B{N\315l\031\234;\240\344"
+	.ascii	"\234\003f/\032v\346\372\376\346CP4 \003^\3007f\336\271\302S\341"
+	.ascii	"\001L\214k\355\374\213\313\301\300 \203\253|b\240\201\003\034"
+	.ascii	"4\036m\220\260\345\317\203\3319\f\366\237JM\rq:\315\353r\030"
+	.ascii	",\376\177\037\360\330\303\035\337\332\262\357\nO\207R\336r\004"
+	.ascii	"\177\3047\360Z\375\023\376\200_\360U\354=\307\032\370\242\260"
+	.ascii	":l\360\352\356\n\3640\273\002|\260\226\341\314\262\204s\221\336"
+	.ascii	"\311Id\t\247\036\235\370ZV\316\262%\234\233\344=\344\360\316"
+	.ascii	"\324\002?t\177@\340)\325\243\013]\340\377\310\331\351S\217\036"
+	.ascii	"|-+v\370\r\302\336\034\301\253Ss\316\371\367`\355m\276:\237,"
+	.ascii	"\327\332\243oV\370\275\n\377\347\265Zm\203\277;\247\330\022\216"
+	.ascii	"=~\253k\360\201\257E"
+	.string	"\303\213\254M\t\307\343E\326\336\201Mz\337;\323\213*\037\331HN|\244o\275\360Y\243\364J\342i{\031\3677\303\247\003\351\n\300\036>`g\036\255\211b\245q\207\236\245\211\266\017\326I~\374\006ap\216\340\325\335\021a$\037~w\210\021\330\231\307\3770g`\242Y\217l?\343Ax\322<)\022\367\361#H\342pa\037LM?\310\372\005\335dd\234\320\302\b\005\265D\354&#\343\204&#\243\260_\260m\304O^\345b\252\312\205\207\"\007'\027PK\"\250\244\252\244\242\200TUSN/\226Z\264+\230\246>\206S\023\213\247\325\211\305\023TS\024S\333LIOPLJL)\224X<-E)1Q\265PJ\022j\251)'*\245*))*\245\3403\273\371\205\253O\342~\"\335\206T>(^E\b\350\375\360!d\245\346\374eA\232\206\247\036\004\004E\233\213&\037\331B6u\230"
+	.ascii	"\350{\217 q\2255\374\315\001@\321\314\200\036\254\205{\304\005"
+	.ascii	"\337.!:z\361\265\212\377{\354DM\215\373\277\367e\337\003\334"
+	.ascii	"\375\206\275c\330\231\356\373\020#\311G:\002,k@\212H^\374\005"
+	.ascii	"O\340\256\317\230\326\204\3575\234\221^\373\016\306A\334\365"
+	.ascii	"Y\243\224^\341\351\033\240\203\326!:\300\306W\337\341|\317\333"
+	.ascii	"\344\300\373\304UN\275Q\336)\030\212\026\205\375\356~\341x\032"
+	.ascii	"\356\200]\316YB\373\035\307{\253\264\223\371\332\257\225\027"
+	.ascii	"\013v\346\213\205\365\325\231w\214\317~\200\033|{\224\322O[\262"
+	.ascii	"f\350/\206O\214\350\223L\325_\261\372\254\250\301Y\337\3708\217"
+	.ascii	"RM\002,\340\273\337"
+	.string	"\200\261\250\2010\245\220S\246FDF\244 I\323\001P\0021\350\252\352\001\021\260\265T4\2324sU\001vT\242?\223si\024\206\207\2128\300\214e\020\331nW\300$\016\334\361J\216\307^\360O\233\267\232\314\374\255\036G\016\361\304F\336\274\nZTb\203/.!~\2408N\254\266\313\207\366\321\220\t\225\334_\261\204q@\201\347\234\247j\336\254-{\002aD@\307\244W\344\320CO.\343X\021%HJ\243\347\250\f\370\273\265\2315J\214\260\bX bj\273\372,\242\346S\276$\025>\325_\344[A3\200\023\244\335\022\256\266&KEq{\254\334&\n\266\301Z\223\310\264\374\207p]z\353|\310\272'_}\375;*\201\007&\002|\274\3048\270\026H\375\260'\n\225\243\025\334\255\f\203\023\024\346\232=f\3066z\256\361\272\037\005\351\024\244,\333\030\003\216\377\365M \333\220\237\247\245\347"
+	.string	"\332*3u \004\3070}\240\247@\255\332\270\177w\023\f\327v\312} ."
+	.ascii	"\324\320\316\017\244\211YM\241\270\254>c\312\273\204\311\367"
+	.ascii	",O\374\365s\017g\363\377L\360\036\346\234\231\024$\036\365,\007"
+	.ascii	"\235h\n@Wj\371\203\235\340\313\344K\013=x\317\025\036\220\033"
+	.ascii	"\020\311# \256\371U\332\002\035\0326FO\3527\364\235:\001\350"
+	.ascii	"\233\022\243\006"
+	.text
+	.section	.gnu.lto_cliPlaySound.234.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\355\004\255!"
+	.string	"V|\330Fp\236U\007\341\203v\031\221.\030X\232\301\213\020\032\r\200\233QZ|\213ihS\"\250\327\326\241\rUXH\013\355\343\304ak\003\032Q*\322a\177\230\232\215vJ5\244\225J\243\377\211\262/\222\355\277\367N)\245\305"
+	.string	"\270"
+	.string	"\310"
+	.string	"\314\243N\371\210\271\235\271\243\364V\260\245\300h"
+	.ascii	"\367^U\331r/3\001\027X;ef\017\251\235\256-\244v\312A\3468\001"
+	.ascii	"\244\256\260\201\225\234\242\227\235{\357\356\2030\352\301\366"
+	.ascii	"\351\241\261km\246\246\350\317{\220\233\226\024\266OQ\317\254"
+	.ascii	"\310\f\032\372\300\f\2221*\020.A:\013\271\303\331Y\222\205\""
+	.ascii	"2\354D)\3731\325\243W\033\026U\327\272EVe!s\370\f\215\260\365"
+	.ascii	"dH-YD\237\013LL{uQ\026\222\207\2538:\255%\211R\216\256T\375\203"
+	.ascii	"\"\255Y\262\243[$\017THG\2265\235\205T\372\267H\035\250\356\336"
+	.ascii	"\333^\355\307\344\320}\226t\357e7&\247\232\201\232\271Uf~bFO"
+	.ascii	"\004\270w2S\236bH\355\177\373>C\254\032\266\225\276\302`\270"
+	.ascii	"\2150\024\177I\271\371\213\332\251\377\n\347S+G\f\177\266\023"
+	.ascii	"+Rj\376\227\334B\355'\321\034\213\362;\314:\3203\377Tx\033\373"
+	.ascii	"\333\253\233\206\227\347\2262\262\250\02723\205\376K8SG,\374"
+	.ascii	"W\314D9\334-\310\326R\272\201\232\331Lc\327\356j\236\251\316"
+	.ascii	"j\352\234\246\316h\352\374\251\263\243\316]\344\255\031\0335"
+	.ascii	"\250\372\tv\257\215'\236+\226vI\362\336\314\356\256~\346n*\355"
+	.ascii	"\305=\334\\\335\fv\027\203\351;u[\206\032\2532\262{\357\202\265"
+	.ascii	"S\035\332B*\363\205\355\266\267\223K\253;d\367\006\026V\"\205"
+	.ascii	"\013\031jan\210\225\221I\001\240\303tB\373%\007=\260\351\306"
+	.ascii	"\026\364N\246\205\222\333\320\301\333h\373\036k\265\330\233\367"
+	.ascii	"W{\371`$\344^b\033A\254D\006\007B\214\3606\262\217\265J\261\250"
+	.ascii	"\027\022iQ\316Y\337\212\362JL\355\257x\375\324\rR\243\237~oA"
+	.ascii	"\237\255\323\305\244j\353\323\274\341\2722\373%\347\302$\221"
+	.ascii	"\244G\215K\342@s\277\3761K\023\215\255D\3120I%\352/\375\336+"
+	.ascii	"L\321\332\372NVy\212\316\237\333\317\376\230\373\377\316j\236"
+	.ascii	"\001rf\036\223\267\361\037\312\307p\366\271\367\020\326\325d"
+	.ascii	"\363U5D\357\275\027\375%w;h\313\020\371\371\253\027*\356\201"
+	.ascii	"M7>~{\346\036\noc\374d\244\203\260d\244\3230\304KF:\027LK\276"
+	.ascii	"\236\016\370+\241\373a\300\361\222\217\305\357"
+	.string	"Ig\302\327\203RjJ\241\003\376\200\300\t\267^39)\371P&_\257i\311\2117c\236\202^\023o\307+\261\363\365\224\234v<\340\323N\301\215\177)\230\200\273\025\277\037p\327\303\274\235\024\343\207Y|\254\236E\260\307}\037\301R\026\235l\3207\034\254c\321\251\022=\355\217\177[\353`\365(:Y\3333\252\256\317\376\221\371\200\253K\202Mt\006\234}\346\240V\020\212\267Q}\004m\031\001N{\026Mpk\250Mp\312J\024\341m\230\030\361\205L\300\231%L@\320\212\021\033\276\220\331'\303!\f\2143\235G\200\364\bp\333\367W\207U\030\320&b\250A0\344\020C\310\030!\221\021\241i\2129p\002\231\2423\017\020`\252&Ic\222\310D\232J\034\250\223)7R\002&\312T@\330\244\013\251 ^h#eI\013#\235\257\033\264\004M\277\274`\270B \255\210^\267\203H\b\235\006P\026"
+	.ascii	"\2742\360Y\230#\222\210\265@\260\005\203E\033\276\251\353\352"
+	.ascii	"\252\237ez\314\2309\021\024J\242\f\345\n:6c\235\b\361\314\004"
+	.ascii	"Q|\263\022\325\007\275\3516[J\330G\217GL5\347=\007\275\006T\221"
+	.ascii	"\253\026\241\216\306\310\365\300zv!\244\342*\213\340H\345PF\301"
+	.ascii	"\270\032\325]$\2263\373D\372\213\350\021\235\313\2067\035F[\251"
+	.ascii	"dY\350O\361H[=\273o\352i(\200\327\275\rN\315Qc*"
+	.text
+	.section	.gnu.lto_cliProfile.235.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\257\001\325\020"
+	.string	"\266\037pG\320\224M:X\001\233e\272\375#\271\365\364\0324f\034n\267\305\0201'\336q\314in\305>\016\341x)\206B~K<~\205\216\321\230\255\201\360\305\003\324)\227\3313\372\260\214\2533\246"
+	.string	"\003[ ido)S\nY"
+	.string	"W"
+	.string	"^"
+	.string	"F\341\036=\273\201\355\221\373\311\366\350\226\375\343"
+	.ascii	"\316\3228\370y\24134dw;=\341[\263u\323\026\241f\313\007\360\242"
+	.ascii	"\271\351G\304\267\222\227\316k9\031\271\022\207\360A\020P\212"
+	.ascii	"\222\027\016T!\242\243\313\236\256\327M\352\311\323\224\332]"
+	.ascii	"\347\367\342\271\271\333\356`\033e\277H\273\253\332\343\347\212"
+	.ascii	"R\016\025V\230\375\330OrZ\354\336b\032\302tj\372\001\032\270"
+	.ascii	"\360!q\327\321n\210%#\233\024o\2648\355\366g~-\306\205Z\247y"
+	.ascii	"\370\362\354A\260\370\221\001\331\335\224G\247p\217\n\340O\266"
+	.ascii	"\237\366a<\250\365\330\207\233\354\302b6vg*\001\271\344\001-"
+	.ascii	"^\376\343\364\265\023 \242\264\244;|\b\025E\355\261- \355\013"
+	.ascii	"\252\374\347\313\236\262I0\"\b\b\326\216\202c\373\320e`\220A"
+	.ascii	"\342\001\264\233\363o\305\345\2500x4L\022\335\324es\330\256\024"
+	.ascii	"h=n\222\210\271\334\324\3160\223\377\256\227\335\244HIH\322\215"
+	.ascii	"\322\3303\233\303\r\276\352.0\252\227\n+\317d\017\245z\361:\317"
+	.ascii	"B\007\243jYu\036k\246C\025p\214\214\013\253\323\020\023\303\352"
+	.ascii	"N\263\232+\314\251\032\265Ya\202jC\270Q\204\005(vw\305\247\361"
+	.ascii	"\032\022|\237GO`\211>\313\027\204S\250\b\\;F3L\300\2206\355q"
+	.ascii	"~\303\226\312\242\351\320\324\223k\207H\347HM$ `\0022t\326\003"
+	.ascii	"\342\300I7H+\0037\\pa&\020\027m\020\262\004\216\006\277o@4\334"
+	.ascii	"q,z\nM\331W\017\216\371\330\315\210\374`\033\232\320\313\252"
+	.ascii	"J\342\2710l\200\036\336\235Ec\315\212~W$RO\257n \262\374\306"
+	.ascii	"\332x`\r\227\340h\355\313\003"
+	.text
+	.section	.gnu.lto_cliRateProfile.236.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\227\001\375\017"
+	.string	"\346\336kD"
+	.string	"\2234\034\333z\221TC\235\276s\034\322\3006\0164\222\254d>\363\367\335\363\235-(|,\276\313/\254\301\337f\217:#\200Od+`\227\376?\267\323 \262\301\261\244\230\304\335\2154\271\354\275\367\2262\245V"
+	.string	"V"
+	.string	"Y"
+	.ascii	"\357L\273\001\357\035\370\217\367\316&\233\307\001\226=1\200"
+	.ascii	"\315X\305\004\331\335PM\370\3264\375\363:N\323\344\003h\235\376"
+	.ascii	"\301B\334\023i\255nSe\007\2228\3079\220\305N\210\264X8\205\221"
+	.ascii	"\261\361\331\223\325J\245~\236_hw\235c\313\345\006o\233\203m"
+	.ascii	"\220\375[9p\240\260\272\354\327n\260K\177\177\271\275\277\374"
+	.ascii	"\312\245S\323\017\260\240\305\216\021o\221\331\005\221#dm\272"
+	.ascii	"\032+^\273}\232o\203q\030\323k\035\276.\373\017*`5=v\227\344"
+	.ascii	"\235I\300w\t\270wl?\355\277\270\314\364\027\017\367\354\272f"
+	.ascii	"h\354\322J<\002\006'\200ss\2417\03503\235\276l\013H\233\202("
+	.ascii	"?\372\263\207V\020\210\220\3058\333Gnx\217y\214\n\032h~\304v"
+	.ascii	"U\037G\240\252D\301;s\251\352)\313\336\340]#\324nR\211c0=\265"
+	.ascii	"/\250\344\307\353g\367\314\334X\330\244\364d\323N\347vwU_~6\b"
+	.ascii	"\276\350')\"\024\t#\361\263\b\022\241\210\2418!L\021\231\214"
+	.ascii	"B\261\244\022\202\n\230d\341\244\024b \221Ja\207\266W\227C(]"
+	.ascii	"I\361}\362S\373\001\004\333=7\267\031\250\237:G\037\250\314\221"
+	.ascii	"Q\302E\343\351\313\371\f^j\251V\243\251\035V\013\220\325\020"
+	.ascii	"T\346x\200\211\230\037A\275-! p\0022\203{B\201\263oPk\375\206"
+	.ascii	"?\013\357\b\317y\305Y\363\b\310i\307bMI({\312\340\310\307\256"
+	.ascii	"F\344\227\355k\"{\201\"\f\033 \303ygm\254y\321\347\212D\352\371"
+	.ascii	"\352f\"\353n,\215\207\327p\t\216\326\232<"
+	.text
+	.section	.gnu.lto_cliSave.237.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\365\b"
+	.string	"\306\220?; \0057\035 \035\306\216\272\340\005`4B\215\314\006\264\020\007>P\300\223\020\272h\033\215\214\035\f\363\352\226\357\352uj"
+	.string	"`"
+	.string	"\311\302\272\375)Mec\245\271\327\357F\333\356\235R+"
+	.string	"."
+	.string	"/"
+	.string	"\004\327\251?\273\006\001d\301\207\025\232\220\030\235\335\255\023\345\337\345\347\237\365O\250\002/1\210\335\265\fU%\367\274\355\220m\007\333c\273\353\271\262)\003K\304\344#9\273$\001"
+	.string	"\354HgT@\266/\355\267\334\345\373K\307\007vW,2\273b\203C\331\251\305\033\\\247\331\003\366F![8\037iw\0267#j\202\276\344\305\303`\034\244\354\246\036jd\251\205\204S{\203C>\264B\313f\374\230\240-\202r\236\330\367l\236\340\266\214\321\t#q[)\302\244a\326D[I\253\232D\345\266\221\251j\336\251\212\n\334U\220\274z\321u^\005\211{\317\316\225\003Z;\243\307DY@\006\013"
+	.ascii	"2\241\311/0\\T\020\256\346\205Fjh\201!\227`\233\325\024p\227"
+	.ascii	"\027\355$\003"
+	.text
+	.section	.gnu.lto_cliDefaults.238.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`P"
+	.string	"=\t"
+	.string	"V\221A:0\217\323\001'\0362\300\013\0312\330\340\343\016\227\250\262qD9\017\353\215z[l\354c`\rZ\305s^\337H-\005\005\210e\005\007\342:"
+	.string	"\374\346\024\215zD\022\273wJ\001."
+	.string	"/"
+	.string	"4"
+	.string	"\331\346\002\3323\207\266\313\201\306\212\r%1\033*/\273[i\310\303\317\320\377\353\234\221%~j\034v\327sdq\334\364\266?\266\037l\227\001 \3663\273\273\246.;[h\031i}\025\333]\305`\266\314XH:\266?\355\233\374$<\312\305\003v]\257\225]\222\301\237\3153\223'\320\036\231\245.\003\300>J\f\232\212\2300\017\316\264\275\211\2162EEk\363\344SP\006\"\273\252\217\024\033\225\002\3023\273\302b~t\002\254UfP\321&\305I\003>\201$Th\304\211<\036\350\2010u \310\235\270\257\2003u$Qi\323x\003u\244\255n\243j\352B\245\272}\247\n\032\260'\301}\025\364\274\257v\310}\f"
+	.ascii	"2\241\311/0.\030\034\003\315\325\024\320H\r-0\344\022l\263\232"
+	.ascii	"\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_cliCompareValueName.239.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\200\001\305\017"
+	.string	"f\336jF\360\222(\035\222\366\2551Ir\343\202j\267\004\367;\352\361\342V\352;\275\255\334K5\356\362f5\241\337\376\217H,\246F\247=\352p\266\375\334|\021\233\235E\fI\021<\370\351\264>\331\307k\210\304\022\262\345N)V"
+	.string	"W"
+	.string	"T"
+	.string	"\234G\317\266\177\342(B{\306\003\327J\\0\213\265\254\360\261\273\340\347\004\272s\363\002\272s\032\342\341\271\2512\364U\347B`\261\036/\361\345s\216\210\270\201\003B\314\203GlI\025\021]\363\263\273\267]\302D\226\224\035\222\335\265|\211.ww\333\021l\217\330\267\t*=;i\275\264\344\244\037\222"
+	.string	"g\346\3451\032\273\034n?\366\206\2131\342\265\337\016}\233=~m\345\353\262\327"
+	.string	"d\006b\307\356\"8g\007^M\252"
+	.string	"\200m\321b@\2256\203\006\341i2Xwcr\016\\\332Oq\025\341\307\324\003\354\312l`\354\216\nl\300{7A\303\361[`8\361f\374\224\036\366A\352|\301B\202%o\227\273\253\322\225\356Su\271\340A\313\321\2229\376\344\325\323\216\332&\013\362\257O?,\2522\247\327\333^\002\213\325h\t\262\2227{TI\225\261?We\366k\367\367\232\337\373\370wN\363s\001(\222J\312\350T2R!\205.|\024P\023J#R7B\t\225\246E \023\222\b\024I"
+	.string	"K&!\024PtJ\001A\003l\2520:\201(\223\351\004zl{\334\317U\231\245\374T\004\246\304\006=\213\337\366w\200\231\351\230\240O\205\331\236j\222\225\2628\225\261\f\0337Se'\235j\035"
+	.string	"M\023\360 \206\347\371%I\264\242\204s&\266\344\356\222\266]\312\302\002\252\026\301\326\022\013\240\310\022\3205\f0m\234\211\r\033\302\252\317\020\300V\206\3010>\003"
+	.ascii	"#\004*\034\334\225\244\r\022A\007\254Z\321\\|\023J\031"
+	.text
+	.section	.gnu.lto_cliBuildValueIndex.240.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\360\003\305\033"
+	.string	"\2063\262H\260XQ:\361o\353\214\201f9\221A^\311\226sp\325\255\330\206\2424\315\376Y\360\304\264\r\325r2\235h\264\016\317\201I\026\020\025YN\230\311\373A\377\340\341\032\030\256\2460\206\346\201\n\257\327\202o\255\021\262\345N)\241"
+	.string	"\216"
+	.string	"\243"
+	.string	"\300Z\201[\260\376\264\266\360\232 I\325\032d\360\321\007V\037\003\034F~\234\027@~|\271c{\251\361\251\266\006FD\270%\251Zklqlq\3524xS\253v\347\254U\251\"G\272\255\271\343\357lg\335F\213\030_\001\275\244*\037\026:\016\365\023Do\310\200iz\2207U<`\234,w<s\244+$\342\364\332\251\240\017\222\200\374>\374\324\355|&m\361"
+	.ascii	"\372\256`\274E\027\bE\001:\324\217\f\n\253r\203\313\217n\240"
+	.ascii	"\307O\2149U\021j\255\236\271]\213{\346\266\235l+\260\027K\273"
+	.ascii	">\377$\024\020\327\332\236u\310\257\206\241\226\236I\306\376"
+	.ascii	"\322\207\350\370ENQb>\367\321/\261?\372\001\027D BIA\267Y\264"
+	.ascii	"\203\266\271>\373\255\032_p\336\236M\003{\035x\273\310\351\031"
+	.ascii	":]\322\351\3268\315\242\323+rZE\247I:=\216\323\224N\357\205\367"
+	.ascii	"\334\351\327X\270\302\023\265dT\264X\202\225E\261L\24526\355"
+	.ascii	"\270\360\007~\316\265o_\210?t)\254\275\346\352m?#$0\tVG\362\203"
+	.ascii	".?\372IW\332y6'8'\216x\023Yl\310\211\265'\376\224n\253\275s\316"
+	.ascii	"\244\266Z\242\332/\375\232l>.\271\177\355\2705]pS\316\360&\234"
+	.ascii	"?\r\325\332"
+	.string	"\343\3006\212+\221]J\226Z{n\220<\311\006\332aF\316\310\217t\377\364Sr\355\356\213\210\367\0057u\233\305Gm\0212\215\3533\200\027?\246\026\266\260\027?\216\224\256}\255n\264B\034Ck\255\225\256\257\370\032\371Z\330\252\214\360\212*\204xf\321\252\265}\342Fj\b\206j\2557>\323\213\200\360\213>Z\004\2156\374\004\035oL.\3142\321\3501\t\037>\273e6\263\020\262\230\214Cl\304\fGDL\226c\"f3\3004\022\033rb'h\264\234X\031\254\337\236\035\341\266<+X\353\263\016\031\365\243S\037N\254H\211!\241\200+V9\312\355\331\365\204\244\3311H\353\304\273V\347\332\231\2250\205\312\253L\240/2\205\n\344s\025\310\2173\027\372\005AX\222\321C5\276\326\224\236\370\271:\373\257\221\256\245\331\007\177\201\210\367\344\362p)5\002CQ\020\374\202\346\226\013@7\003\311t"
+	.string	"\005\205\210\\\237\031\274\265\0172\234\"`\322e\255}\001\303|\256\265&j\370lK\250q \203\230c\206\231\tDD\202\232\300\305\034`\002\231!\323\016\020`HSA\322\001\361(\237@9\235%\265\340a\272J\271y\222\003J\256\r\f\205Z\212D\215Z\211F\336*\320S\241T\247\254&\022\313w\037\324\001u\366\255#x\314\223O\320Bk\n\263s\241\305\f\266\327\016\326"
+	.ascii	"\216M\266\205[5\343\211\221\n9Hu\224\032\275B\275D>8\266\201"
+	.ascii	"\354\247\034\031\237\235K\"\336\236DW\366j\310\017d\006V\232"
+	.ascii	"\0254\275H\2655\031n\376\252\330VU\373\270\024\306`\335v\363"
+	.ascii	"\030\321\036\034D\210|\241\355\234I\021F\325"
+	.text
+	.section	.gnu.lto_cliFindValue.241.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`y\004\235\037"
+	.string	"F;\317K\220\026R:\300x\360U\246Q\312\037\003\016\242\260eps\020a<\031M_\260\244\231\224\220\305\244\023\330F}\307\337\275\204\241\177\036\331\242\337\351\235\270\200\t\200\351\342M"
+	.string	"\274=>xqE\300~\024\356\203\255\225|B\210\334I\006\274"
+	.string	"\257"
+	.string	"\273"
+	.string	"\277\":\026\203\375*\357U4a\226]\271\367\"x\312\275\365\351"
+	.ascii	"\3644*j\231\0274 z\023\305w\267\230\266\302\200\265\257Jq\231"
+	.ascii	"{\235\324\214\334\333T\300\005\326\247\227\372\024\021\017[\205"
+	.ascii	"QQ\215\003\314$HY]\356m\366\270y\236\372t=\215\372\264m\360\315"
+	.ascii	"\016\217\273\25565E\333\016\371\304\343\320`,\335Y\2647U9\343"
+	.ascii	"+\001[\223R\351*\232sVc\212.\211\204\006X\216\305\310%\217l\352"
+	.ascii	"\2039\005K\223r\351(\372\200\n\b\016]\322\bm+'\222?o\221I\243"
+	.ascii	"\355;?A\215\251\313\224\227&\345\214[[\204{/\333cRy\316\235\231"
+	.ascii	"\243\230\231\0023\n\024\307\247|\021\352\323\367\227\304\254"
+	.ascii	"\004Q*\262k|\263\314B\022\366G\276\363\317\361$\312\254\330D"
+	.ascii	"\346&\321\366\023\363\035\240-\311\301\355\304\214sc\363\255"
+	.ascii	"3\257\346U?\315\233\377\314\271\3162\357:\357btl\031w\254\363"
+	.ascii	"\355Z\347\025\265l\263\226U\324r\252ZFQ\313\215Z\266\252\345"
+	.ascii	"\003\260R\224^\270\220q&\257{_\254\201\271f\351\027\324\267~"
+	.ascii	"\256\277\353\307\372\265\316\374!|\"/\362'\347\272\240H\340\032"
+	.ascii	"\356.\332}\222\n3\312\225{"
+	.string	"\233\020\326\247[C+x0\245\354\254O\317L\304\317\272\223sZ\f\206\336!\022\230d=\030X\005O, \214j\3312]\323H\016\360d\312\202\366\023\017\251\274\356,/\250\253(F\373\205\001X\265mM\323\314\025,\330\037y=\340\250\211<\323\266\356&\027~\206\001\310\275F\007f\032>%\246\245K\331\231\f\325\247j\253Ib[\202T\215\rs\240\334k\374\221\231\205\276DC\357\306\275\306\035\261+\331\200r\350\240vP\237\312t\223\035\223\320N=\034\311\207\365\336\273\303\007{\030\017\177\307S\366\375\354\257\325\030bZ\274|\3313\230\332\275kKv$\244\330kw\377\371\n\\Kg\247\251Y\021i\326\271m]\277\353hY\264k\374\266}\2440\374#\377\352A\277\203\201\"\324\007 \200?\375\033\n\362\230H\205\202C%~A\352\ta\260}z\200>\250\217P\017\320/\250\376~x\200P\366\351"
+	.string	"\203\276\236/D\017\b\310\363\323\363\005\225\350\351\324\260p\304/\250'$\024\006\365r|\337N+\225\037H\247\327\355d\377\363g\n\243Z\2425\215\3035G(\352\242\016\\?\361\235\317 \345\304\352\232\3215\246o\215d\021&Uf\021\234\321\025\247W\276\3639F\317\265+\262\037\275\367\336\033j\2735/\211\252\212z\3231\215\374\36336\233fT]\033\347k\202\357\332\246q:h\330\026g[\302l\273\276i\034\327\222\313\245\244\240\210j?\245\235\327\351\017\257\250\2531\243\375\262\305\344\224$\355P\250a(\343\2201\006\031#\230\231\231\221\3324\007`\002\231AX\017\020`h\233\264f\032 ^\325\2457\255\334\244c\221,\b^c\n\n\274&\005xF\350\211\360\302\t\005d\013SX.>\215A\333F!]\322\225\242H\313\214\2630\334\037\205F \3551<\362t\202\0260\240"
+	.ascii	"\210\003\344\205\365\255\036\355\302+pF\222\214\301\263\251\312"
+	.ascii	"a\373\035\271%\0055\324\3250V\022\300H\217\347\025\b\373'\370"
+	.ascii	"\364K\253C\255\263G\3767\\\032\323C\313\265=\351\221.:\0274\224"
+	.ascii	"\017P\241\300)#\032\261'\375\236\336\337\233kr\302\365\201>\243"
+	.ascii	"\315\303\372\373\003"
+	.text
+	.section	.gnu.lto_cliGet.242.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\261\003\265\033"
+	.string	"\206\263\265I\240\230Q:@3\336P\206\211\371q\265\223\221\003\247\222\207g\267\013\037\b\r\303\261"
+	.string	"\302F\261\351\365U\333\r\273\311\021\006\311\034*\327\354{\360\301*8\350X\345\344\024\270\243\\\205\316\372Zm\ta\211\210\020B\210\334)\005\240"
+	.string	"\227"
+	.string	"\244"
+	.string	"'M;O\316\306S\373H\036\325\273\024\214\013\250U\311\210\224Z\211\021\314\340<i\342e\345\311\363\003\312\223\356\331_\n"
+	.string	"\253o\002\024\215!+1\265\326\332\366pI{\2479\315\222\034\227\366\374\241\3574\nx\020!\375\034\023(\345\030s/\033G\343\fKq\350VW0\304\006\0225G\023X\003\310\315ph\324!\003\226u\254S\3410\210\2265B\214N\026}\034\021l\351\202\272\031\002\307\0058v8\261\031\376\350\036\353\244S\223\226\340\320\350\324\304Pk5\r\016\211\356\232\333V\262\r\302\336\247\366\356OR$`\252\365\247\323\344Nt\343\237N\232\267\242|\360\244\277\242<\371%\272\022\245\210\024\020\r\333\253*\300\341\356\222M\364Q\035&2`^%\033G\366\252;v\251\377\346W\367i\226%5IR\217\237\272\367\324t\244~N\204 O\212\316\024Vk\21503\265Hf\005\371\325?\365W}\355\333_\342c\331\346\312\205\214\037P7.\234'\177\252[\331\306v\325\213"
+	.ascii	"\325\253~\030\005u\004V+\261\302I\274\222\336\247\274\365JT\037"
+	.ascii	"\203\013\024\022X\255\225\026\017\356\254\b(V\216\200h\330\307"
+	.ascii	"Zk-w\311\307\372\223\214\266\242\214\262\365\270\346"
+	.string	"\226+\264\177\027\345\2718{\300\251I\013%!\334\\\331\306\204>\272\b%\005\3210*\b\250\006\016Y\305\337\372l\200\332\035<\320/)\305\240\3659\207\322\036[\373\003\210$E\002\364{&\347\n\221\343\245V\241\007G\234B\031\036\220(A\037\364\277\276\242\212\327z!{0kJlk\234\232\300\004\215\036F\353\210\230q\227\f\243\244\353C\365\365\243d\034\2437{\303\321\007\351V\320\001\\\237\355\023\207\222k\340\245\326\037\005\007\306\351l\273\031O\256\307\326b\307\001\200g\026f?\016\312\334{l-\366\207gg\323\351x;<8\0247\0266]\f\267\313\365\360\350n\246o\022r=\267\332\315Dm\227\263\351j7\237\237\232\004\002\346\251\300\371\324X\360x>5\033b=\006\240\r\242\261\003\372%\367\352\021\2211\365\212\234B\033\036\234\264{GzQ>\276\312\034\240\352\342:w\311\036Ks\227\366e"
+	.string	"\334\352b\356\222\001\\!q\366X\177\021\227\226\024\265\320#Y\356\255\376\031\\ZI\224vs\205\347\222\273\3235.\271\037:\363,\357\352%\031\377\344\f;eC\250a,g\230!\304(\301L05SA\332\006P\002!\344\340|\020hj\264\311p\021\201\232O\263\361>sxike\f3\317\n\005\265\233\3061\361\326|2\001\361-\350~:\201\022U\345)\221})\250\202\f\344\205\022$l\244Y\353\247\3522\357\322!@\261%\325K\244\345\354\373\211\277`E^\370\334\034\344\037\373\334TiVH\034\002"
+	.ascii	"\\\263+N\034\006\f\302\241R\351a\202:\354\337!\013ke\276\222"
+	.ascii	"W\241\034'\362\006-\347\200\264\306\323\247~]\373\227\3551\301"
+	.ascii	"\340\007"
+	.text
+	.section	.gnu.lto_skipSpace.243.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\314"
+	.string	"\275\013"
+	.string	"\306\325O@0Q\223\016\240\310\303#\373\242\232\247\210gt\374\200$\"\215(\024T\305\367\352\334\r\315\270\b\231\246\265\217vQ\240(\225\377\266\t\f\003\203\250\234-LhJ\004\226\214\362\376\246\221\275\267\224)\005;"
+	.string	"?"
+	.string	"="
+	.string	"\372\301/\257\303\247y\371S\266\335"
+	.string	"i\036\207o\302B!:4\354]J$\"\027=3\355\223o\304\307\365\242/ m#\220\366\361\234\024\354\256\023\244i\270\343mcl\033\260\217 wf\372S\205\204\215\r\337^\354\206Jr\354\b\024\021a\273cS\362\334u"
+	.string	"\273 \034\214\335\256\342\002\223\303\243x\212\216/\315\200y<$0\341\002\003\013\034\273\035\345\356\003\342\341\344\001\342a\234x\375\211\0255,d\311\276\212\n\234\311\346_\361\360:e\333(\343\340y\273\273\317\007\236\032u\"m3.\224\370d\211\266\030a\232j\210\335y\344\005D\211\304\nbGx\356\327s\001\026&\223\241\320 \272\262h\034TT\225\241 h\030<\240*K\002e\021\340M\004\214EM\330l,\212\322\355\337K\205PO\203\324a\304\243\037\250!\276\350\017\305\220\301iT\277TM\315l\233\300\003\025"
+	.ascii	"G\b\204c)c\017j\353\357C\013\221e\001HH(\0030\033\005\"Z\356"
+	.ascii	"P\354\262e\357f\214\204\262\367\317\f\205\312\022\334\322\247"
+	.ascii	"j\031\250\227M\302|\002"
+	.text
+	.section	.gnu.lto_getWordLength.244.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\025\001M\r"
+	.string	"\026\331ZC\020\221\223\016;\t8\004\032\002S(*\243+\216U\360h\361\272\f\244\317\003E\nE\273\325\35610k\321\376\266\032e)]v\255\203\021"
+	.string	""
+	.string	"V\004\204\006\035\377\240\340P2\305\241ak\204\220\275\245L)I"
+	.string	"D"
+	.string	"G"
+	.ascii	"\003J\"\033\004D\274HIqc\327\313t\203an\217Ps\3635\252\3563q"
+	.ascii	"\242Gx\225P\036<\270"
+	.string	"\022\034Y\305\270<\365<q\244\204 T\256O\235\201\252\2031q*\317+\301\356:M\034\206\333\272\355\215\355\003\366A\001\330[\376\353\336\037!L\253\246\363\336}M\b\211\013\031\336\275\354\242>\034\033#\272|\260\035\262;l\257\206\201L\373%n\"\364\226\223\003\330]Y\321b\327\013q\001\354\321\336\005X\217\330?\254G#\by\013\232Q\303\214\n\365d\333 7\261RO\343\304\f\013\271\262\217\242\202\t\326a\373\211\365\230z\235:\230\223\206\021\334\335\205\336\376aA\315\350\245\352d\240\204 \345\247*^J\234*\213\355\211r\204\303*\306\272bg\234\016\016<\0138%$\226\247\363`\243\200SB\202Y\023\351@\3202\215\223y:\r\"d\032hB&\022\300\037\t\033PF\341\363\001e\035\336\036B\250\307\024d\244$\253b\372\224\034\243\374|\351U\025e\004)\277\250,~\352G\271\200\301\"\030"
+	.string	"^\b\204cB\263\307\021\215\277v\275\377\241\332\322\262"
+	.ascii	"$D\224Y\230\215\002\021-w\330\264:\030#\321g!0\002\306\201a\002"
+	.ascii	"\032\032\301\204\213[\372T-\003\365\262I\230O"
+	.text
+	.section	.gnu.lto_cliSet.245.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\204\027%t"
+	.ascii	"Z\305\270+J \020[\031\016A\2718\023\2746cZ\345\3333\300\274\317"
+	.ascii	"\351,\310\257\330\3413\301\201\211os\036b#\372\3376\030T\311"
+	.ascii	"\205\250\337\265r+\212r\001\200\0317,\001\246\262\254\232Q\255"
+	.ascii	"O`\306\377\227\230K\261\021\262\367\2262\311\256\002t\002\247"
+	.ascii	"\002{\330\346\264\225\t\266\337\332:B\237=\253\034t\356\313\t"
+	.ascii	"\377;\277\340\017\370\327\371\347\374|\377\013\177\336\037\347"
+	.ascii	"\257\373\345\3766?\334\357\366\247\371\327\376\026n\264\373\302"
+	.ascii	"\"\200\315\261A\251;\315+v6\b\360\202't\232!\024\376\355\003"
+	.ascii	"7\b\360H\022\2332\177hy\242\320\331\373\325ab\026\b\302\234="
+	.ascii	"\fKwh\266W(\347}/ \341`\314\f\257\360+\037\223\264%x{\275\r\312"
+	.ascii	"[\222\304Z[\275\214\004\317\376\244\356\342T%\257\326\326\021"
+	.ascii	"\206\304\316\344<\031\337\354\3556h\027\316\351\224\257\313 "
+	.ascii	"\331dm\355\"\022#\243\006\315\001\343\321#\037\231\272\331\317"
+	.ascii	"\311U\235\353\224\265\005\233\177hc~\274=\016F\f\345\3414\370"
+	.ascii	"\252\265.a\232q\3310\036=\327)k\353\223!\301\246\033\264<k\366"
+	.ascii	"l6\310M\211\027\2372=3\214G\263W\263AG\323,I+C\214a<Z\274\231"
+	.ascii	"\267m\320\231\263)\337B\007_\237\254\377 L\231\235\027\306\243"
+	.ascii	"\311\363\310t\215\311q\355[\337u\247\354N\341\272\256\2558\272"
+	.ascii	"+\214Gy\367hOS^\215\311\213\326\025\0052n\326u\255\305\2160\036"
+	.ascii	"\335\265#\245G\215G\246GW\271;\270\224\265^\305(\013\334j\313"
+	.ascii	"\263\256\253S\253\260\3055\332\367\371\271\366\375p*o\242\004"
+	.ascii	"\211\021\"B$A|hb\362\320\201\303\222R\022\322\021\322\250\350"
+	.ascii	"H4$\264!\b\350\307XL\321\263Y\271\007\362\272\272\211\022$\212"
+	.ascii	";\016\020\203\203\373\210\342\016\021l\036\202\254\213M_\327"
+	.ascii	"\032N\316\251a\0200\214\361\007\2657\245\235\251\351!\254C\223"
+	.ascii	"J\030\016~\027\"\246F\r\332\227\316\3104\307\234"
+	.string	"JiO\362\342\367\205\221`\370\212\264B\264\246\226'j?\"\353\353\302\302\310\263\317\244\261{_W\231\363F\332\230\260\353\211\261Q\nO\270\274(\354\30700&*\356\320{\017\261\263?\264C-O\270|\250\270\343\211\232\013\221u]\341\rg\262\257\313\355L\332\231\300A]\276\322\243\226.+\3511\204\226.\267\023\3504z+\323z_W\233\263\005\231\033\342\343\252\360\317\211\244\322\246\316\373\272\336N\026u\304Ty\333C\220uQa\343Y\314\032\301\313\373\272\340N\032\210\205sW\243\305\3050R\236^\315O\262;>N\374\334\274\244\034\315\342\363T\361\225W\302\373\272\246\234H/l\261\023\344\205\305}\252(\224\243a\310\313\311\2114\202\227\345\333\316\\^Y\314\305\035\353\272./\275\236|O|\267\223vwo\367\b+>\032H\027\331\214\251Ak\005\033\354\243\271\224!\360\227?\372q\277\nQb"
+	.string	"sXX\203K\235\333\217\f\367\321*[ \r\306\361\245K\023\360R\222\300_\372@\272\rz\311\221\303\003Hfl\346\022UI\2254\212\210.W\214.6\217\275\264\213\313K\346RB9\337e\225R\224T\250\244G\323&\0216\245\t\367\371\271\256\353Zl\346\2224F+\351\253y\004b_\354\264\276`\360\256\362\212\022\013\013\356\221\343\244\257\326\211\321\256\352]\345\026%3y6\332\337J\274\341{\364\331E\261/\204[p\234p\237e\301\335o\303Y\3120\245?\245\230Q\353_\224c\312/6\262d\365U\030n\242\024\343B\006_)\313Z\360\332}2w\211M\265}\242\022\023\177\353\212\365e\t\347\243,\023"
+	.string	"l]\261h\350\371\036\245\331\371.GW\331\\*\317\322\243U}6\007\"\370\205o\031\245\t\367\351Nc\227\345\225\206\340\243\371\241\262\214\022\330\272j}I\200Q\353VN\360(\200\277\334\273\t\306 \207\006\030b!\332\314Uq\250\224\373\211\373\031\324@(c\227=\223F\337\270\2524\341>\fB\255\354\204\363\347\362\315\203\203\022B7s;H{tg\331\225a\003\304b\304}\367h\246\263\225\330\204\373,\023'\320\273\b\364\340/\337o\373\257D\321[;,\304\352\253\335\265+n\346\356\2774\001\006-\333(\354>\315W\311\335\276U\257\373Z U\204\202\250\003~\241.\370\225\340w\276\020\234\360\333\300\353|\031\030\362\027\276\013 y\025x\233\257\220 @\016\367\375\361\265\257\217\267\360\355q\265?\201\317\371\352\310q\276/\216\347}o<\316\327\306"
+	.string	"5h\\\356;\343r_\031O\363\215Q\304+"
+	.ascii	"\2227\200\"^\030E\274/\212x\235\210x]\244\274-\216\274,\216x"
+	.ascii	"W\034yU\b\361\246\020\342E\241\304{\242\210\327\304\221\267\204"
+	.ascii	"\020/\t!\336\021J\274\"8\360\2068\362&\227xA(\361~@\3626\035"
+	.ascii	"y\231\226x=(\361v@\362r8\362.\031\361*!y\223\216\274HG\336#\""
+	.ascii	"^d\022\257\221\020o\221\020\3571\211\227\b\211w\350\310+t\304"
+	.ascii	"\273\341\2107\350\310\013\204\344\3759\362\032\215x\213E\274"
+	.ascii	"\351\221\027MyO\"\336\036\342e!\336o\360@l\005L\233\345\267?"
+	.ascii	"\313U\223\013\214\333\356\ff\210\n\354\3507\245\034Z\2014\034"
+	.ascii	"\372`\360\366\034\232\331c%P\251\231\253\243\227\272\265\260"
+	.ascii	"\001\2728\213^\352\243a\243\203\346Kuvo\222\030\350b\033\237"
+	.ascii	"\031\021f1\244\251\236\361\227\f4zGH''\007\347\030\322\367\373"
+	.ascii	"\321\034\241\234\034\254\271,\207g\220\322\370\f\222\267\225"
+	.ascii	"a3\252\231\034`k2\300\026\350\367\035\215\202w\347K\317Q3w(\205"
+	.ascii	"\216\343\307w\207l\346\352\270+\222\352\022u5\354\r1\b\277\321"
+	.ascii	"\\\327;\020\323Lm+\256\250\310\017\0353\264\255\270!V\273\215"
+	.ascii	"\346\332\263H\306\017\323\354\312V\334\320\276*\235\321\\7Z\251"
+	.ascii	"\207R`\333Kj\245>\033\247!9R\233\236\fhgI\235\272\200\267w\250"
+	.ascii	"\266|X~\211F\315\334\353\375cQ\016\341\216\177U\272'\321\214"
+	.ascii	"\226\301\036\374FK\265R\354\214\220\213\220n4R\023"
+	.string	"\211\241\361m%2\255\207g\307f\026\333\366\266\260\001\256\370Q\027\351\363mk\016\002\016\322\3104\352\032\376\362\250\223\314B\003J1\352[z\024\331\247\036W\225\242&j\243\276\326\n\306/^z\354\242\276\026\331\215>\366R\033\033\026\243\276\021\241\355\004L\246\306\035\tE\317\316\027\032\203\3410\252\334\271\352\033\225.\375R\265K\217\022\365\365\356\224\245\227g\341\020\246\315\0215s7\016{Q\361\276\007\246\307c*\337\353\376\272\300\r\365\357n@\036<\275C5\266\362\317\375%\324\325\220\345p\b\b\013\265\2209*\035\013Z\250\207\304\310\370m%\276.O\004\241\r\335u\330\370\3748L\025\274\335\037\230Jx8`*\274\r\330\206\276\035\240\032\272\244\213\262\301\202\016\352\367\261\351a1\" 3UA\031`\253\336a\024TB\027\177j\f\274E\305c<j\342/\250\357\002\036\335\241\032P[\320}g+\261"
+	.ascii	"\016\322\273j\r\352!\177\t\324\267\373Q\340\340\033\236\362\244"
+	.ascii	"\031\326<\205W\314\007\b\n\227.A\214e9K2\315\204\345+\307g\005"
+	.ascii	"\235\271A\033\263f\241\262\\e\007\215\353z\365\257}Sz4\304\216"
+	.ascii	"+\246\031X!K\331\335\301\377\213\227k\212\243"
+	.string	"\001\234gY\2628q\001xS\372\323\001\364\362\326\024'\253\352\341\022\220\030\231\004\365NYf\\\327\365\247?\367\023Yy{\276\322\324P\320\205y\001R\222\n\351n\313#$\200\215\255\366Q^\361\227B:\371\243\215m$\326\264\313\301@\262\224[\374e\220f\267A,/\036\033u\344iJh\223D\244\214<%\231B`h\223H\254\222U%\2026\211#YU\"\335\344"
+	.ascii	"UE\246\244\254\254\242\252\222VSQTT\032\360"
+	.string	"@>Y=\0219\251\254\202\020\231*\300\310S\222\237%OTTOATVA\214<%I7\210\"2\205\300\002VDD\242*\200\262z:RD\211D\025\231z\252\200G\224\006F\236\222l\250\300\252\310T\224\217\250#O?\242\214L\360$E\365\224\304\310\310S\222\226\372T\224\221\246\262\302 \203(4jJ\312\b\221#P\305\205r!e\004\312\t\212\002\247)\251\247#NPTUN.\216\026\t\006QTNVH\220P9\005\255\255o\024vw4i'\337bb\003N\300K%\241\215oi\315\223\277\022\002\360a\031\016\243\005\320\003\243#\310\243\241\351\206\017U(JR\214Z\227\213{\221\033\036\273#\335\230\t$\276\214h\032\2764\274:\226:\365\213\276\326\227\023>\306\243\216Q\221b\247V\363\b\233S\250X\275\242bq\303s\366\206\013\325\023@\200m1j\375\314\334\215\334\3604\243|\231"
+	.string	"\265\320 \302\211W\\\b\007\342\021\303\202]\364\337\260\035\225\tBU\301\250u\026\034"
+	.string	"T\212q\321w\223g\247e`\356\t\321\242O\306\306u\330\257j\337e\3250U\214\305\322\243-\356\362\374\016\247\004\331\321j&\215f\364~\250\321{\"g\364"
+	.ascii	"\3155@\243\360\"\306\f\2369\201F\260\265(\326\314\203\226g]["
+	.ascii	"S|\356;\216\270\300q\001D3W\b\261\211\202c\211\242g\360h\305"
+	.ascii	"u\340\370\271c\226\267\025w\024\244s4\3218b\265\327h.\026\315"
+	.ascii	"co\201f\361\225&1\217\205-\203\037\232\271\034\246Yf+\216)\252"
+	.ascii	"9\314\354o+.iH\343h\256\373\035\b\260\211\266\025\307\304\315"
+	.ascii	"\357\231T\243i\260\270\216\246\240\017\303\321=<"
+	.string	"B'~h\232^\234\201\216B\247\344\361\261\371\241Y\301\t\323\212^\236\243\272ePDE\257P\321\351\234!_\212>\321\rp\336Qt\n\024\335\341\355D\277\360J}\206xrv\036L\3642\237\332\202:&U\242M\224\350\364\316\260\f\211\026\321\0204\252\307#\232\304\210\356\240'\242?x%C\30338\263\016\275|\247\252\251_.Hv\210d\247n\206X@\364\207\226\240\3217\020\315\201\317\207\276\235+\315\031Za\363\373\035\031h(\205CS/\327\251c4 \361w\204\317\322\220\251\233\032}\033\302\324\351\034a\037\017\335\241\241\032\245\323ZAG{\350\016oEX\210\030\265\214\277\354\320\017\274R\037\241\2365gB\031\344\034\313h!.\315-\257\021\213[v\023\201\310\250a4\305\024cfHDDD\222$IcQ\005\204 &!4\017\0210)TN\315\310H\222\244\003\202\032\362\212\232\005J"
+	.string	"9\\\353\262\245\006\235\212,+\324\257\016\203\272\024\255\244\013vs\2770\261b\214\340d\312\n1\301V\220xS\"\245\341X\311\001\322`\nT&\\\2116\002ll\263\2624U\326\2102\b,H\352\030dq\342\037\360\347-\260\266\030\262\032\276Z\\\340\312\211\350!Y\233U\241&I\214C\305\226*\304\202\356\314\274l\261$\276|3@\356>\024OQz\224\206\b\003]j9Z\36487{{\347\264!\001[7c\363\001\355\234\2256\316\324\354\370\227\036\200\031b$\335"
+	.string	"\262\347WO\376\356\242\313\200\375\220C]\036L\257S\f\321\252\371\225\335\270\375\235\210\2458\352O\240\177;\363\021\225y\035T \036\354\221x\256\251}\312\267\300%\377\271G\n\335L\261\341s\221\212o\361\247D$$\270+\367\203zm\321\351\246\343\b\242r\263\364\n\325\274\340\312V`\3262o"
+	.string	"G\202\346-N\276\177W;\260\023p\r!\256\033C\270\313K\327\307\200\353\013f\243\206A\3178\227\002,\247\373\246\237{Z\367\r\370\200\262\331\312\310]\004\370n\3105\003Ze\362l\n!\306\f2\367\276B\307\307"
+	.ascii	"\206\200\257Pl\2669\035\342<\031\240\230\335\346\22262\323Qo"
+	.ascii	"g=\207\237\324\357\204b\235I#\322{_\177\310\362\035C8\013\221"
+	.ascii	"\031\2775\314\302\304\311\267t!n\002\226\353\323lY!\322\353L"
+	.ascii	"T\021\2410\206\032k\b\2369\027\344[\224\t\213\313\205\330\f6"
+	.ascii	"\307&$T\\\230\314U\215\326\036\241\243\013\313"
+	.string	"\331\tK\024RY\242un\352\354\210i\305,\214\247\336\030\310\224\206R\361\002\331F`\303\177\254\250E\225\347\374\237\023\001\350X\203\272\366\3025\234bv\007\n\037o\254,\377\210\034\f:\246:\b\264[\t\375v\227\340\343A\371B\366`6\022\251\236\211\256\030\222l\277`a\336\250]{v\rr\267\023-\b\344\013\353Z\202\341\346\346X\303&\035\244J\360@w\353\324\347\313h\036\371Y>#\033\253:\217T\216\\r\013\213LI\366\330\277\370P\b!z`#\251\007\200fq\217A\231\037\034\310\303\037\224\b\363\013\302R\213\260\204\356\263^\030!\320\177,\317\023\323\340\373\034d\r:f\021c\311\301\005\240\243\357S\377\276+\270qY\257\341M9\2318*\354a\202\277\264\\*\375\252mo\322\022\0327=)e\211L\007\337\275F\314\362\025)e\325\202\026`\004\277\"\316\364\201~\327o\265\263OW"
+	.string	"\020\222\343\301\007"
+	.string	"BN\357\240{\261M_\264)"
+	.string	"\365\255\f\247\035\330\332\275\tg\326\337`\007)\005\200r\032\032\"C4Gr\347\026\t\217\346\204\267\376\306\350\346<\274\330\302OH-\325\022a\375p\252\306\205\240.\336\033\201)>\354\023Q\230\243.\333\035\301\006\356\210\311\345\263\006U\243\002\236O\006\207\343\032\be\032\230\200\353\321\353\305K\222\004r \2201\201c<\340f\213dT1v$D\3716"
+	.string	"\343\364\204\326%(\233?\270H[3\256`{\205\367"
+	.ascii	"\001\320h\305\353\215\203\333\371J\333\322\372\365\217\271\332"
+	.ascii	"\351+\260\003\200W\207\254-\0032\221\310\373Tk\324\206J\213\306"
+	.ascii	"\363\244DZ.2l\352\324"
+	.text
+	.section	.gnu.lto_cliBatch.246.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\314\001\255\020"
+	.string	"\206\036nF\340\322&\035\240*\343a\034eX_\240\334\376\0023\221\330\200K\304,U\2268,\306\206\222\256\320}\224\277&\203\307X\254U\270H\325\302\021e\2121\306\370\204f\t\213\373h\236)\343\200\017\270b\020B6\2212\245Y"
+	.string	"R"
+	.string	"["
+	.string	"\346Q\340[\217A\013 2?>v\227S\023W}\323\262\210i\252|\315$\004\f\275o\332_X\317\236#\004\213\024\2562b\245\031\025\340H(\203%(\232\361\"\205_b\232I\t\032\326u$\214\301\f\354\356]<?\2040\231\232\311\356:\301\220\346\016\271\355\317v\003;c\336\300!\017^E\206H\b\031\025}\352\331-/\325\306>\266\273k\255\261\277\363GMk\2463\323'\345\213\305\f\b\021\017\"\332\2359\n\262\256Hc\005\311\366\323~\316uT\337\351\360"
+	.string	"\27359B\273-\005>\260=\272\365R\366\270}@\366h\225\003(x^\330\210\251\036\200N\272m\265 5y^\241\353S\017S\033\2332\037\306c\230.\234N\331\243\366\021\005\031\221\363\273d\276\317\177\\\374\024\306\200\212>*{\224p\343\b\247\307K\036\345\356z\2526&\371\265B\217\216\230\374\341-\337:\217\206mwu\220e[\221 x\214\352FQ1anI\235\264\260d&\225S\n\n\252\323\334\225\234R:\256\263\300\251\234NP\\\227b\341J\bx%\203)\305\265\254\254\2448Rk\217\255\326"
+	.string	"x\335\270^\024f+\245\r!\202\310\320\215\313\250\b\3065tpNh\002\322\236@!\017Z\325s"
+	.ascii	"\2642\262\273d\252\251\236\035A\252\017p\370\030\261\036& \200"
+	.ascii	"\202!2\263\003#B?H\340m\\\363r\357\273\030,\003\300\025\257\374"
+	.ascii	"\354N\003Z\2401V\013Z\227#7$\20522X\003\001\301\021\247%R\215"
+	.ascii	"\323\342\324D\016zi\260*2\022\221\302\256\316\372a5\337h\322"
+	.ascii	"%_\006\364\330\202\302h\247#\325=l\353mB\327\003"
+	.text
+	.section	.gnu.lto_cliStatus.247.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\321\r]M"
+	.ascii	"\312\213\310\036R@Tj\215\001\247p\301k\253\013V\031\246v\350"
+	.ascii	"<\315s\241C\370\347\274\3300\324K\321K+}\022\260:X7\233\250I"
+	.ascii	"E\261#k{6!\301\254n\204\230!\305^\254\212\017E\001\002\363+'"
+	.ascii	"\371\270\317\024]\266L\036\"\224\334M$\221R\246\224R\316\001"
+	.ascii	"\272\001\334\001\254\263:\347\3248\343\3208\337\354\234mx\316"
+	.ascii	"=\236s\315\316\231&\347\314[\235w\250\263.\347\274\346\234\325"
+	.ascii	"\3259\247sNWgTu>Q\347\3179{\316\271\203:\260 {\340\312*\362i"
+	.ascii	"\315\027H\334\231\027\r\035s\241\267tg\351\026\353\006\353\266"
+	.ascii	"\322M\245\273J\347\230\233\214w[\230,\267Dm\355m\302\302}C\217"
+	.ascii	"\361\216\215\np[\314\330o\362\375!&+k\215\0025\213\0066\257\227"
+	.ascii	"\267\231?dEYk\340\nw\030X\215\224\231\327\002j{q\177\361\256"
+	.ascii	"Q+=\372\235z\373\003\026\262XXCR\033\365\336\352.\336\331\320"
+	.ascii	"\\nW\371\301B5_\346N\212\313\013\265Q\366lv\rnS\351\200}j\276"
+	.ascii	"ArW\324\320\242\224y\337\246P\243,\2446j\343\355\314\035\245"
+	.ascii	"\265\334\226\342A\337\274o\022\255\033\336\267I\304@j\243\334"
+	.ascii	"\354\235\264Q\265s\322F\331e\026\202'\352=\026\220e\245\344*"
+	.ascii	"\363\276\357\357U`\034>s}6\233\377\335\316\301\271\261\351\325"
+	.ascii	"\320\360v\272U\315\245\350\371\356r\013}I[2\217\235s\346\242"
+	.ascii	"\200\264\320^\202,9a\274\255\215\255\3408)L)\351\2334\214\232"
+	.ascii	"Z\024\267#SJ\332\006\253{X&x\215\221\2461R\202\363\216L\221\320"
+	.ascii	";\022\272\212\270.w\300W\243Sg8l\245}\301 \244\327\237#SU\255"
+	.ascii	"6\tB\304sg\220\221\035Dh\036\220\004\261c*==\203\326\304\330"
+	.ascii	"v\200\264\260\224b&\035\355\261\376\361\022\244\352d\337\367"
+	.ascii	"\3351\243\374<\007\250\002\003\242\303\332C`B\235< \234X\365"
+	.ascii	"W\3774\tb\345\257c\ni\317\035\360\276/\373\2229\325\254\323\314"
+	.ascii	"\3752w\025\363\216ITc\330R\241>\322\201\3515\223\245\273?z\366"
+	.ascii	"\346512;\240\177%D\363\276\270\005F\201O\340y\217s\305\254LI"
+	.ascii	"d\367\n\374s\025\375P\357P\021\316v\330J\253r\006\331< \t\363"
+	.ascii	"\344\374+\316qYi|\177uS\225\311\320\305\271{\244E/\245A\252\373"
+	.ascii	"\342\326\027(\177;\322A\270%\250\357\013\005\203\033L\207qM8"
+	.ascii	"\233I\243\354\242\340\"I\221\244\215\352\276\303\372,sV\006e"
+	.ascii	"\354\311\343\274\n\f\b\254g\"\025\334\025\274\227\t<:\306\246"
+	.ascii	"\303\232\346.\351\261\240&{\006\327\005\031P\315\356\221\252"
+	.ascii	"\277~s{\351\036zp3a\027\006\327\t\312\355:y\335\331\0267\"=\376"
+	.ascii	"\217~\016\315\225\301}\242&\233\251\374#\247\237\003rf7\313\325"
+	.ascii	"\362^\246\337n\347\243O\244\204{\3628f\235\031\201#\357\345\371"
+	.ascii	"\251\226\023P8\363\0024\274\227\377AlS\320z\334\277\275\232\213"
+	.ascii	"\003;j\357\233\354\345\003jr\203\025\020$y/\231\215"
+	.string	"\372#\347\324\372F\332\357O\224\244\001\351q\254\343\3149(\360^\366\0230\304\t\232\333\032\362\217\314M\244\377\025s\303\300z[\343O\302\f\354-\315\026\350X\235s\254\3168V\347$\235s\r\032\235\245yF\2135#5X\263\002\253\363QWiN`u6Z\235_\254\316.\232J\363\257\2554\027\241\316D7\316C7\316B\253s\320\352\334\302\306\231\305\352\274B\347\254bu\366\365\234S\364\234\201Vg\001V\347\237\2363\333s\016`u\006`uF\321s>\321s\366Y\235{Vg\023\2533\217\316\271D\316\231D\316yg\365-\236=9\006\351q\254\342W|+\341\236\034\211'\351\240\325\2415k\315\322FU\374J\304\367AmG\330\244\370\034\317\003\224\342{\004x\240\3671\"\300\237\240\322f\246\307\023j\031eS\260\320\340\370\027?\317k\201\177\376\275\264\231\251a\037\307\347\316\002`\337\004\031"
+	.string	">\200\357\t\263j"
+	.ascii	"\336\207\346\257\330uB\335\\C\246H\331%\275\213\227\032\241Q"
+	.ascii	"\374\013q\242\370\247\322\346\206\006\365\307\223w\342\223\236"
+	.ascii	"\207,\331\305\3479K\217\231z\231Y@\275\357\023\320\211\357\021"
+	.ascii	"\223\344\202|\237\367\341J\256\331p\247\352\236O\343N\200\372"
+	.ascii	"c\343|\275E\331\375\025w{\226\232x\236\022\033\336\335\362\220"
+	.ascii	"2\267=\264?x/M\374\217\265\265\241Aq\363\345y\241n/\237j\323"
+	.ascii	"\332/j\262\317\224x\2366L\211?\361\325f\304\316\223\370\366\362"
+	.ascii	"\020Z1\355\020j\262\313\222\177l\211 \361,\362\217\255\021;_"
+	.ascii	"B\353\2052kH\316\334\266\265n]\255+\203\322\324\375\325\371v"
+	.ascii	"\206\303VZ\025#3\254=\256\363\255\305\225\255\031\024\355\021"
+	.ascii	"j\262\307p^\347uK\314\342\224p'U\230\023\324\016\2468\357M\266"
+	.ascii	"\300\264q\216\f\376\230\335\243?\271H\"\003\032e\177\375\350"
+	.ascii	"F)\335\017>H\033\305\371\337\nR\236<\256yb98\3119\032%\306\314"
+	.ascii	"\326\227\036\237\361\272o-}\204+U"
+	.string	"\002\0045\331V\032\f\233\031\264d\277\351pKh\033\260\230p\023\323Fg\374\207IY\365\236\346m\276\2231\250\315fi\315\367\276\223M\220\276\346y\270\224pmD\225L\263\271@\230\351\n\021\2226J\363\375v\326\305\b\227\252m\300z\337\027\0067\021]\204;\204\253\334\"^$m\024\351{\254O\266\26337_l\364\261'\3070\022\205\354\016&\342R\021\001\022,A\004N\300\"\373@\0049\026`\207\330\241R\360G\220\035\362\371\204\276\0307l\034\315\340\241\322\005@%\"p\003 \353\003\270\264\203\210\001SS\220\0352\026\233\212E$\366\310\210F\f\366\341\363\341\202\215a4\016\213B!\220\035\342\200hdy\004\201NI)8\350+:\331\350\223a\364\261C*s\300\200\003B\237\f\036\301&\245#\366\206\215#\033na\364\261D\354\217\342\320\311\tx\001\233$\364\261`q\274(r\301\006\355"
+	.ascii	":)5\341P\301F!SSphd\205>6\306p\211\350\224\301\rvi\350d\374\221"
+	.ascii	"\324cl\312\300\211xA\352c(d\242\2213,\002{\b\213@\006\2145<\214"
+	.ascii	"\300\245\223\330<\214@\007\214\305&#\3230I8t\n\016\235\206\302"
+	.ascii	"\034\343\016\240\022\006\350\220\211\250$\\\n\3468XDT\n\376\202"
+	.ascii	"\030\374\230\210\300\245_\260h\374\025\351pS\006\303\342\317"
+	.ascii	"\251\251\251\370\3335\237\372\223\260\356\r\n\332\323#[\311\233"
+	.ascii	"\fh\310?r\316_q\223u\003)\023\203\273\001~o\210\030\026\033\035"
+	.ascii	"\377\353 \375}w5\020\327\230'8D\3378x\f\255\231\235\247\222\342"
+	.ascii	"0h\240\276\357\013\203\335\005\177\241\205\302\315\244Qn\263"
+	.ascii	"Z-\255\264Q\2427\352\002\006e\254\306\377\036\270*\211\f}\r8"
+	.ascii	"\241\037\372VZ\005\275\320\367\021J\270\037\352\240\337]Q\213"
+	.ascii	"K\236\311y\013\276\305,\213\260\300o\236\271\255\241\335J{\231"
+	.ascii	"\363\354\357o\276\311\272\306\025\265\266\357*\213b\336\324\224"
+	.ascii	"M\351\322\313\361F/\305\314\342u|\223\251\240\253\265\342\275"
+	.ascii	"d\361^\304[\325\004\336^\276\244\r\353aeQ\223\016\327\212\265"
+	.ascii	"Z\274\227\034\3646\304\350_\274\213\367}\013\254\226\254LM\372"
+	.ascii	"\223\024o\225\017+>\200\357\250a\034\345\020s\006\241\241\031"
+	.ascii	"\221$I!"
+	.string	"\215\001\220\002\221\251*v\021@\261\224\216&I\2419e\030\224p\240\016z\315\027:\315\373\244\245l\027[\221&r\2763h|\352;0\036\325\3306I\2033\326\2504:S\"\356\206U\344\235Z)\343o\244\236\267\346\215"
+	.string	"\237\364j\b\350g\222\006\022\023{\253\367_\211t\333d\357\311\235/\254e\277\227\361n\210\267\370\027\352?&\261\372Kh\214\255\016f\340W\320o\252u-\030\016\025\332f<oo\004\362\362\2030N\373RMH\032Y\377X\023\022\n\026\340\200\006\317 \247\027B\324\246\341\023\235\264\310\310Y\034=\370S\237\300P\036XOsc\251\323\250\241\202\b\\UH@,\036E\bDr!y\204\215n\351b&\306\ra\200S\300Tr\212T?\303\321\337Z\250+o\034l\314i\"\266\371\327\341_\335\220O\340"
+	.string	"Q\270\3340t@\351!/f=\2542\270dQ\211\315\b\026\262\314\377V\020\215;\200\324\026\346\006\214\005+4\320&\fc\004\037af\233\266#B\311dD\330M\201W\354rj\236\377\t,\272~\251\202Y\340\240\373\243\230\335\223\251\016\357xQ\036*\214\306\r\341\374}\257\353rTn\034\341RbO\311\311!H)h'\275\213\004H\213\303\226\232\360\022\r6\362]\323\307\232\331\031\331/\333,\"\377\213\377\371\366\235\021\352\f\310\276\2313\363\350\340\313\177\276~e\200%\210HU\025\005Xm^\361N\372\033\203p\323\241\272\025\254\037H\303\217f\213\211w\356\306N\365\006\206\332\202\337\233a\243\016\004A)\001\241$,\3449*\035\001\024L6n\352\354\373\001\220\304|"
+	.ascii	"h\346p(\bc\350\261\007\2124\354Yi\262s|M\261J\311\262&\276\264"
+	.ascii	"\211vrD\336\376L\335\343\245\001"
+	.text
+	.section	.gnu.lto_cliTasks.248.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\311\017MQ"
+	.ascii	"\032\212\260\036N0\030\356\214\001}\325)\211Y5|\003H\275x\311"
+	.ascii	"?a\322\2676\204\203m\365\263\031\f\320\272pM\207u\356\255\207"
+	.ascii	"V,(\271\356\302\324\230g\341\370\351{B\200>?t)3m\256\337\256"
+	.ascii	"p\306\252\242\315\325U\325\275rK)\245L)\245\324\001\264\001\333"
+	.ascii	"\001\234\252\316\250\352|6Z\263\231:?\352\354\247sK@<\242\211"
+	.ascii	"\023z\t5\3275\222W\205+w\276\321\320Ct_\351\306\322m\245[\255"
+	.ascii	"\033\255{J\247\314\255d\237\020\235\245\355!:\350}\351\241\353"
+	.ascii	"J\356\347\306\rD\277aY\273\340J\021d\262\212\017\265\nw\033\373"
+	.ascii	"\330\372\207\266\255xP\343\316\271\275\262d\262\316u\217LB}\203"
+	.ascii	"6\025\3565\366\365\251\006B\021\034\222P\352\\7\212\016\265O"
+	.ascii	"o)\235\306\276)\234\305t\327t$\237\324\260\244Fi\037\332F\343"
+	.ascii	",\355\036q{\204.I\261:\327u\207\372\344!\265O\326lgn(\235l\373"
+	.ascii	",\204\266q\335%P\200p\335(2\270\205\332'G\351 \332\247\3327h"
+	.ascii	"\237\3342\323\t\267\\\254\243d\030W\332\024\256\353\022\237\t"
+	.ascii	"\377x\333A,\320\217O\017\317\316\n\241NN\020\347\006hSC3#\363"
+	.ascii	"\363\255=5EO\363\275\345Ns\364\272\274\260:\250J\263f\214:,b"
+	.ascii	"z\356X\305\f\032\031\353\352\2645\0072\323-#c=w\354\301T\272"
+	.ascii	"\253{\353\265\327\177\322\0341\0349k\037\263\3561\207ewC\354"
+	.ascii	"P\331z\002\305y\222\275c\306\203\257\020\226\265\316\0164x\316"
+	.ascii	"X\007\347\216cd\307\031\034G\206\276\221A\314\201O\332\346\211"
+	.ascii	"\023\257\241\t\353\2310\262#\230\313\004\375\232\264\317\334"
+	.ascii	"\001+\002I\317\035Y0\207F\300\320D\223\035W\3605\315\241\344"
+	.ascii	"\210\n\335\233;\252@vL\342\252Yt\305\2051=wl\301\234\251!N\253"
+	.ascii	"\311\216)x\372\326As\307d\033\227\243gg\235\265\271z!\351\237"
+	.ascii	"\361\3322Y\327u;\255\335\350\245\345\236\346p]\227\275\313\353"
+	.ascii	"H3\213fv\003\230\233\213\371\007&\311\266\207\002\n@\373L\277"
+	.ascii	"\361\226H\224\231+\372\r\2740\314\273<\237\2574\230#,D\304u\263"
+	.ascii	"Z\240\317\323\366\022\241\345y\374\177"
+	.string	">O\227\267.\313\363z\205\025\264\270\336#\271u\240\377?\263\003\272M\307\177\357\260\354bg\224d\353L}d\203\200&}\277\365pK\214\230\024%\210\370]\037\301\004\332Zj\205\372W%\320mV\252\353\272H\376?\226qv<\336n\335\266\200\332\225\364\314\f\354h\033#\267\365j\312-/\364\b\007x\250o\273\245\265\r\333]\024\347#\331\277\345\272\327\272QP*\335Nn\020\320\033\235,9\234C\335{\243\377P\377\224Y\306\316\241\036\340\215\334f\320\233J\307=\240\323\304u\337\356\212@};\353\205\004\023xwq\263\335\305\311\021y\254\036$I\035\376\221\\D\373-\220\262\004\021\277c\346\nzKQu]\"H\334pM\204\023\267\f}2\024\020\357\256>\271\201\240}\366S\260T\226\235ey\036s\024-\177$s+5\271\243\343_\302\374\303G\017\2373\017\237s\323\216\324\271\201\324\231i"
+	.string	"\2373\016\237\363\215\324Y\200\324y\251\2574\333h,\315JIHG5\214h\024\245\3163Rgb\352L\224:\313X\235\003X\235\207V\347\030\2533\214\323Y\250\347\374\342t\006 uv\221:\267H\235Y\244\316A\2533\273:\003\235\316?\253\263\317\352\334\263:\363\254\316;\253\263pu\326Y\235sV\347\340\352\214\323j\3157\2533\260\347l\243:\327\250\3164=\245y&u\226\3519\377z\316\276\236\363\332K\235\325\323\003\357\342\205\017|\245\357 \274\204v\005\240\026\324\267\307\204\231.\013\217\345\342\3735\273\361-\214\215\343Y|\257\315YP\034\037\364\375\276i\001=\373\253\030\235\024/"
+	.string	"=\n\305\262\2122\235G\362\222/.gA\037H_\343\215\375\326\r\366\305e,\330\343\331\3041\372\2427v\021\375\363\255\304\213\370\b?/\302R\214\035\347\340x\244\367\361@#]\334\2157\372\036Oc\244S\276`A\240ou\273}q)\341\206\307\343x\343ynI\301\004\307\347y\374\n\255\356y\237\027\372\342Y\315\363=\017\364e\347\205\317\263\363\035\210\321\251\335\324pG\241M\345k\013\236M\323\337p\254\026\376\017\n\030\204\337fK0e&P\347\233^\330\205\013/\313K\316\353<P\332k\366b\204\340\347\374O\332\013\206\363\300\017~\277dJ\217\363U\306/y\\xO\2041b\211\315#\331\267\3648J80\232\241\036~\301\235\375\226\336\306\033u\340\250\370v<\220r\213\033\215"
+	.string	"?Tn)\341\267\364Jo\344n\231\240\300\377\221\265\310nk\231"
+	.string	"\235\260\253\221\031\352NSnq\233az\001\336h\363I\337At^k\203\317[f\363MK:;\223\246\346\231^\310\205\246\346w\302\310<\315\363\264\261\026'`i3\217\\\242e\3767&\363M\266\244+\353\032\336\222]2\276\377\331\265N\304\324\267\225\340z\254\031~\337\363\375\217e\023v\214\203\027\247\345'\344\353\267\227\356 \032Lk\003\220\227\366\006\365m\270\026\207V\007\366}\254\262n\223Z\377\3072\211\037\025\220H\370\324\241n\265/\270\263^\003\277\364\306\"\232\376\231&F\007)K\365\227~\307\377\230\327,}\365\233\013/\313\363xh'\2764]\033\f\203\251"
+	.string	"\005\232t\360`\201LE=\t\t\3424\004J\210\355A\304OG4l\024\r\331)\252\250+\366"
+	.string	"\026\202&\226ek\370\tih\362\223\215\341\360\251hH\364T#i\310>!\r]\030\r\211VE7\314\302\260:*\032\n\2612\330'\0323\2064\274\262\225\0241H\361\212\352\352\251H\025dHQ\n\b\007E\226\265\022B\034R\224b\331\0170 B]\025\253\330+\253\250 \354\002NSB\020\310\300\t\n\003\247+\031\017\234\246\240\204l"
+	.ascii	"U\205@\006V\305\036\026\b\261\252\241\272`J}R \003\253\342\025"
+	.ascii	":\244(\265J\t\341\361T\244b\202"
+	.string	"\002R\254\202\342\2408\0035\025\025\344I\312)e'\242\250 ND\247\013\210SQE)\242S\225\025\221\b\207\2514\200\252\"^QQU\021}Q\262\372\227t\027^\230\\\326k\005=\222\231;\250C\223\361DO\374\031MD\030\243#B\236\372:\\\n\2175c\346\211D\346\313xTl\n'\3367!\217\361C\037\300\267\026G\266X:Z\352\353;\204m\005\3005\004\343c|\267\025ie\313\004\306\2579\304Q)[\362\326\322\312\226\004\346\326H\353\245l\0336\274/ \333\035\024\366\007\351\3157\262\371c\3643BoA\013,\b}\247\265\271\214\233bW\007\264\326D6\237\037\317\346\315'\035=\233\275Gz#\373\320x6\315\001\336\b\270\316u\267\371\263S\343\031E\372\2437\362N\321\263\211\032=\2157\376\370^\353\n\214L$\361\202y`\272\256\022\002\332J\327\241y\236\373\330\370\027)\264&"
+	.string	"\235\240\276\316$l\206\027\337\264\304\263\013\202%y\242\247\256\001x\237s$n\002"
+	.ascii	"\237\344\204y\036\271\343\245\243\220\242\304\n\257\366+\211"
+	.ascii	"\372\272\022g\243\"\214\334\326c\t\037\311\354\007=\213o\021"
+	.ascii	"\201@\250q(\344\220cH\315\210\210H\222\244\220\0161\005\0041"
+	.ascii	"\007"
+	.string	"%,\017\021`\251T\356&I\322\034\355\016\024\2601\265h,\227\t\245^\344\020<B\332\036\223\267=\031\240\261\372#W\r@\023\tn\207\2018\333\023\260\254G\270GQF\366\371!\350{\211\001\257\244&\206v\357\367.d\025\272\271Y\355\313,\"\262\321\f\037\341\313)\003\315\\o@}\326\335\314R\224\360\330;\006\252\237O\361\035\211\310\205e\273:*\006\b\252\235\216WE"
+	.string	"T\2779T%4\264W\031\351\317>\303BS8C\205\201\240\314\356\2026\346BV7~bQf\215\0310y\3656\004u\333\264\274\225\351\210\363\0033*\0273\035=\232d\350\340:\363\245?\bfTH\2651\214*\245\024\034\005\371\333\033n\341\263\311\365\224\206}e\215\352\332\334\273+\363\2423\207\230\0217R\030\nL\007"
+	.ascii	"N\302\250\320f\302|\035\233Q\330p$<\022b\342U\263}\bp\263P\320"
+	.ascii	"\344\357B3\230\267!/]\304nD\0062\363\222'\344\224\2179\231\207"
+	.ascii	"(\351K\220^\"Z\303\300\207\252\237@\004\024\035\022*\316\007"
+	.ascii	"\004y\341}{\300\240\227\270J\002$\031 \340\240[\224\362\265\203"
+	.ascii	"\021\300X\220]2\036\252\326\3420%v\345\224\333\373\017\037\264"
+	.ascii	"\310\365\330\222gn\264\262\207S\225?\244S(\235\376\t^G\030\225"
+	.ascii	"\233\332\367\304]\r?\323\360>\b\246\030\201/\302\232\016\376"
+	.ascii	"XI\256V\245\255\227}\025?\224\347\255\313\357\311\3610\241>\225"
+	.ascii	"or\354F\213\271\"\013s\304\351\3347\035\327\255\233*\210huf\260"
+	.ascii	"\300?\217Mrxe\305#\374\272mY\305\312o\n\333\363\024\354L\310"
+	.ascii	"\267\260F\005m\374\304y\303n\374}7\bK'=\237\222\317\033-\311"
+	.ascii	"\336 \322\352\227\301\023\227\204\255\032\\4\030\231B\213\356"
+	.ascii	"\300\373\336y\224\n\236\355F\373\244$\216\337l\340x8\021\275"
+	.ascii	"\356$\330\022\277mx\bld\216\2230\276\335\001XL\256\204\226\260"
+	.ascii	"\005\311\362.\265\350\250\260\350>.u\037\241F\024\252M\200\230"
+	.ascii	"IQ!>\224LKUHe\201\343o\267I\344\360H\362\220l\370\243\373%X\035"
+	.ascii	"J\366\313w\324\030>,\304\372\267H\341i\272\233\250\334w\221\355"
+	.ascii	"\022e'v \360_\210\311\301k\344\225-\341\250"
+	.text
+	.section	.gnu.lto_cliMspStats.249.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\253"
+	.string	"5\013"
+	.string	"\326\224M? Q\233\016\b\036\337\202*\001L\004~\2040\025\032A]\221\021\003\260\027\232\230\215\227.\377\377\217F\025\301\230\246\372\235Q\356\t"
+	.string	"$\020\234\212B\343N\234\021,\340\357>g\323\2156\3312\245;"
+	.string	";"
+	.string	"<"
+	.string	"6vwF\021\233n\227R\324\315\227x\334e%\2724\215"
+	.string	"\031\351<\321\243\224"
+	.string	"D\f\017\001<\217D\221\021\242\306\277\353\006\257\243J]v\327\332y\035\356\351\266\033\330^`\337@\277T\365\251\371\301Bt\220\031\273\241\221\220\r%\214\022\023\333W\373'\336\261\335\343\302\005\354\216>\027\273\240\002\037\250.\r\2362]V\0370]z\263?\n|\226c\360}\310\240\"\035aG_\264\360\304\310\341\312\037\037\244\240\341\321\033\246\364\340Ql\252]\320;\n\025\250\202\340RF\273\202\005}\367\370\357\022\021\023\341'r6\310i\344\260O\205!\034\034G\366=\002\346\\\233K\233.\r\206\201\220\261([\026\fcM+\302\324`\0162\323\3226\323B\300\331\204K\233\234,\323\346\004\334_0\304\216\004\240\266\004,\312\020\t\r\222D\355L\246\357\374\025\"\001\022"
+	.ascii	"1\003\341\270df\251\260T0u\301\325O{AjD\333B\202\233\304-\250"
+	.ascii	"\026)\227`\233\325\024\340\216\334l/*\314yZ\005\005"
+	.text
+	.section	.gnu.lto_cliVersion.250.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\025\001\005\r"
+	.string	"\226WWD\360\2226\035@\035>\206\325`\255\021\367v\203I}\r\005\340\223i\260'\215\263Q}VI\303\276`\342\037\343qBUu\245S\013\322\214\300\315B|F\034~K'T\206\310M\336)\321\377\367\247M\266L)@"
+	.string	"?"
+	.string	"I"
+	.string	"\177\271p\220]\324K\314nx\300\240\353\322\341=\326\345u"
+	.string	"\326\245=;\207"
+	.string	"\fkR"
+	.string	"\343\222!\005\217\335\2351\304\275\253\347\037\346\033\220\305t\325,\330]+\310\302\341\216\267\r\262]b_C\025\252\267\330\202\212u\360\322W\261.\037924zx8i\312\016W4\202\260_\355\356:\242lUW\252\216\252VU_3u\264\350p\037;v7\244~\354\214\214!\242c\373j\277\304]\274Q\006\211\211\215\031\016\256\217\3440\036\374\305cJ\374\226K\233\204T\3368\254\207w\221\215\310\324 \241]_\003\221\313\207g\201\342\271\261\373\035\334\256\317\200\310\245-a\244\007]\355\207hZ\301U*(D\024\235\306\315M\374DF\200\215`\t,\227\"\240l\242\223PIc\320q\201.\204\300\374t!\037\320"
+	.string	"-e\023A\030e\032g\330&\312fv2S\266\320hf\244nb\001\314M\320H\263\304q\244\331\tO\217(sR#fNq\305\036}\324\030\034"
+	.string	"3\031\254\030\001\024\2032\026'\320\031p\261\264\n\r\216\200\rN\230*\230i&\330\271\315\366@\016\\\006\206"
+	.ascii	";p\031\030\002\354\300e<\207cQ\203\b\230u\t\253Y\215\006wy\321"
+	.ascii	"N2"
+	.text
+	.section	.gnu.lto_loadDefaultsIntoCopies.251.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\351\001M\022"
+	.string	"&#}I\320\360(\035\272&\346`\032\250\3359\213qD3\350-T=\307P\263\316PzU\201\217j\225\031U\221\201\327\232\032\201\345Z\363\241\320\337^\035\342\201G\370\020Yq\023\200\200\032>\020D\031\3524\312\235\370\237l\"wJ\001f"
+	.string	"e"
+	.string	"h"
+	.string	"\037\020~\246\016\022~\3321\266\352\363*\317\354\031!\266\225\031Y\272P3\364\264\273\242np\350\243c\364\302G\307\210wp\274A9\373\004U\316\374\237\033\3501\311|\202(\333M\207\017\234\r$\3619%]wi\203\253I\020D\316\365\272/\350\251\330\361\212p9\227\250\007\273ky\303\341\334\341m\323lC\260e\200(\375\3562\267\003B\n\022\242\311\237\022)\331p\252<\366X\223'\341\340s\262\356\330S\332\243cJ\243>\336\nJK\225\276j\205i\347bh\t\203\362\306\275\371\341\330\0263\311\303\307\337\276\037\364]\314KxE)\267\273\252\003\371\272\013\235\304\354#\f\270\271qq"
+	.string	"\310(j\002z\332\035\031|\372@\352\323c?:\222\004\020e\025\376\266\n?U5\307\216\305\214\364\035\334\335\005\255\340 \241j\207\252\034\025\321\240\021\361!\257R\355\226K\376\346\006\032l*c\373\365\023*\251\335\225J"
+	.string	"\206\220\207^\257;\030\242\247T\343\021\345(\360;K\210R\017\r\261Q\223\253\311\237\2773\354&(\244vg\034\370C\026\\\374\236O\037&\374\f\236 \022\253"
+	.ascii	"\223\271Pd\255\227\026\313J\266\212\211\256WJ\013\214\205\300"
+	.ascii	"\025\223f\211\274VX\"+Ely\255XD\226\314E\024\021`X\254%\023_"
+	.ascii	"`0\231\250\032i\327\035\237d\370p\303\211\2465\377%\241\237\364"
+	.ascii	"\024%~\217#\230H\223\360\363?\007W\364\230F\324\240\311\337T"
+	.ascii	"\036\217\304\320\016E\371\244OV\t\232TmP\254R\2734\2779! P\002"
+	.ascii	"ANi\007]\355\t\201\211\216\230e\007\254\006\210\240\002d\327"
+	.ascii	"\245\312\324\325\336;\242)X\221\312\252\034\026'l60\315\262\312"
+	.ascii	"\200l\303\032\255\bU(\341\001\271\204\377\b\345D(\"\016\236\306"
+	.ascii	"\002w\241+\202\235\321y]\005\034\244\374\272\336\023"
+	.text
+	.section	.gnu.lto_cliDumpState.252.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375 \034\341"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001\023?\202\210\200\b\177}\273\001"
+	.text
+	.section	.gnu.lto_cliWriteOut.254.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\033\004\235\032"
+	.string	"\026\360\250H\260XQ:p\021\201\323\004\216\323p\206\243,c\310 5\317\025F\3018H\341\350Y\206\023=\375\3639X\204\367'\254y\353\023\302\376\030\t\347@\346A\347A\207\340&\223\211\t\316\330\033\312\016\250\344\023B\310\336R&\031\231"
+	.string	"\204"
+	.string	"\226"
+	.string	"\255Zc\b\211\252u\227\263\006\304\323\335\375\005\236\212w\201\247[\333\345\022"
+	.string	"\250\372(\220\032\nb*Sk-[\306k'W\243\030\202t6\327\366>'W\005tDF\037'\002/K\310\374J\n\243\371\032\262\201;\023\013\026\257#*z\030\344\364\0029R\0241\270\312\2558\235\b\216\246\250"
+	.ascii	"\220\003\232\257)\030Uo:\013\345n<3H\265\370\242#j\361\236\t"
+	.ascii	"\200\312\270 s%&\353LP\2263\235Q\344l\314!\203Z\3532.G\364e}"
+	.ascii	"w\177\354\256\203\335\031\006;\0337\322\356\373\367\373\375\266"
+	.ascii	"c\354^\351\177}\367\3370\257\213ym^\344o1o\r\363\262@^\222\362"
+	.ascii	"\256\230wd^"
+	.string	"\221yC\346\005\231\2272\357d\336f^\236\274\027\260`K\325\212G9R\353\320\017M\355Q&7v\367N\021|Jx\034y\023\211\033Y\n>(\362t\227\304.y\312\344\3562\221/\325^dy;\326\252\363E\325Zs6G<%0\357\002wR\007\316\273\007\362 \265+\255\357\001`\213\315Z$\\J\024\020'\251\252\314Q\220\036\330j\332a/\337\304\330\370\304\022\013\037\264\221\026\347\264\337\364\326\020\335M\n\313\224\331\335\264y\314\r\207m\302\241,\357\311\354'\241\261\025\356dyL\336\304\002,\026\003O\273\317\303\007\325E7\206X\2315\334\352\233~\365\356\206\035>n\217$iG\357\326>K\025\245\364\242w\004\370\276\260\264\245\004\237\331\335\016\207\032!\326Z\027\354\237\236D\266\257q\2723\020|\034\b\360\364}\246\317*\276'3J?\374\333\r\313A'\004\007\032LV\362\314d\262Yl"
+	.string	"\215G\304,Fa4\030\206I\353\231}\230\033\323\331\361\020+c\032J\236\035\230\254\214\365\204(unv\366!COI\233\315zJr\367s\006?m\233\265\326J\366\324\362^3z\307\201i5\253k\272y\267\243*TX\r\301\307\353\321[\215M\022X\365M\223\375\233\016\333\252\037\224\306\246]=\346\3609\261Q\031\301\361\333\324\023\2251\344\006@&\214\272\2008w\265\220\253m\270(\211j*\214\0306\322>H\242\341\370b\311\321\304\271M\013\211}\247R\250a4\305\024\223f\204FA\231-L\007\240\002\021)[\017\020P\250h\222B\313\001\202D*\275h\037\232\305\332\301R\346/\fJ\344\215\362\006E\022T\364*\224,\035&a\211\214If?C\311\262c\001\274zd\211\247\352\344\bi\021\276\007\004\267$\246+\007>+Q\204\016"
+	.ascii	"_25\253\301\201\026\035hY\32326\203y\362S\364\324\302\373\022"
+	.ascii	"\267\034\030\017i\031\213\243R\320\337\t*5\206\306\266\270c^"
+	.ascii	"\0333\220\201\363\320=\301\257\2266\f\313\b\004`\n\331_\376\344"
+	.ascii	".De\335\207\305\341\005\201r\272\277\207\236\362<\241\006"
+	.text
+	.section	.gnu.lto_dumpNextValue.256.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`x\003\r\032"
+	.string	"&\361\253I\260\226Q:5\210xn,F\035\321@\3458h\032v\031\272?\350\216O`\227C7\372\223\003^o\275\024\330\266\370\267\322A5\352\373\366\363\221\331\212s\210\001O\270\253\2112\337\\k\f\r\336\234\323\376A\310&D\356\224\002\225"
+	.string	"\212"
+	.string	"\234"
+	.ascii	"\022\200\344m\036\373e{\347\201(\274\265\016e1 /z\247}\244'\361"
+	.ascii	"\374\247\263X\253\r\"Gj\005.\360\001\362\242\314k\350\305\371"
+	.ascii	"\030\275\350\340\001\217w\002T\364hi\020\024\302k\372R+P\266"
+	.ascii	"7,\316\335G*\222\341\316\235\337\363\361\246\254B\001\370V(\375"
+	.ascii	"LQ\346\207\214\2239\345\024\253\253(\037\215\207a\204\244#\243"
+	.ascii	"W\275\b\nw\351\251\311\235>Y\370\200\346^\351!\2202\n\323U\224"
+	.ascii	"O\306\3478\241\326\352\331\363\301\270cn[\3106\005{[\004\207"
+	.ascii	"z\224\b\177\307E\217\270\315\367.\3727z\361\275->s\313\277\216"
+	.ascii	"\272v\356"
+	.string	"\235nA\250\244\372\271r\032\372\231[kue)j\267\310\006\366\314\233\252`\016/\221}\340_\363\337O\023\033\247g<\r\243\323/:\355\332\351\230q\232\334\351q\247\351N\213\343t\270\323K\247\347\233\356\007\330 B.Z\314x\360\252V\027[a\252\024\021I\2177\335\376\222\357\344\227\317\364!<o\312\311\324\252z_\031\374e\251\025\250\340\242\003X6\266_\026v\315\034\327\326\260a\276g\003+\266\307\344\306\354K\236\226\017\207?AA:!\327\306\350W\263\343\216<\246\236xZ>\003\214\324\340\022n\221\351\212\213c\262\0024\301\230f\351\206TfV\214-\341i\301^\200\206;\263\236\274\240\037w\370\022\0179%\325\227Z\201n\224\314\216TR\035!y\222\034\275\030nNI\225\365\363\217\344\020`\325\n\364\236\355\024\227\232\311p\324\n\004\241\310\215\320\302Z\b\032\202^\214\355B\351\315p\355\256"
+	.string	"/<\255\271\266\355Dt\022\260\034\265\234\316\354\204\230\242\366a\347BM\307\006\342\206#\001\333\271\331L\320j8\265\234\316\354\004\3144\033\233\016MF\003!\333\261\315F\310h\270\0222\033\032\337H\324p2\023\267\033N\366\002\326/\221\257t\262\f\026y\222\242\377\216\336\3511<\202POR\241\277\2430\303\326\023|\366G\307\270E:j\245\243\301\252\032\231`\3611\204\324\205@\214\244#\272E~\255k+L\371T\227\202!\374\016g\300\2418\364\342k\023\030\005A\321M\2716K\031%\353\027\326Z\253\270E\376\027\252\006Q\023r\211\\ \030$= p\202\021:\\\007\004\007N\226{S\263\274\210\020\321\345\341S\226\"\256\2114j\337\300\032e[\277\025\2741\360\207\305\013V\253\264\241\262\267^\2374\227\360\021\217\t\341\200h\f\314o\220\033d\005yta-\273l\337\261}\202f~G`\364"
+	.ascii	"\213a\307\343u\300\230~\004\217\017d\206\r\b\275,\355.$4\370"
+	.ascii	"\"Z }bP\206p\027\242%#\342\224)\301\206\233v\305)\367\353\246"
+	.ascii	"#\370w\026\347R\3038\030\235D\367`\255)\003"
+	.text
+	.section	.gnu.lto_dumpProfilesStep.257.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\364\004\215\037"
+	.string	"&\371\314H\220\332M:\205h\225j/\224{\b\363L\231\2246\022z\300\006\304\255\333\333\360\223\215\204%\241\025\250FM\315&\033\017\215}]\255\036\215\304\200\362\347\236T\211\360\314\324^S$\222-=\272l\326\326\214XB\210\334)\005\272"
+	.string	"\244"
+	.string	"\277"
+	.string	"IG\242\242\207\227.u\265`\200\336\364\026\272\325>\326\263\222\256\305\302f\232RA\211\222\246[\nl"
+	.string	"\275\311\373\316y\263^\347\274i\333\016 $y\330\303D,\323`\f\213\223\2225i\272\325[\036\037^\227\303\335P\333i\226[\207>\361\272z\343\271\0029b\3308\256$P\205\203\315\271@I\225@cgN\271cS\275q\201\262!\004\252FE/\004\212\306\213cS\265]\351\306O\t\3104h_\230\034\243n\226\b\246\264\314\310\035\235\312\235-:\304"
+	.string	"82\325\022w\234\361\005p\\*\201\3224=\330\353\323\261X\253mB\232\246\256\306c\214{w\333_\266M\330%\221{\373\327?'N\320\325\230dW\230\245\332\306\350\177\316/\316\272:\321(z\350O\204h\232\246\021\374&wr\302\377q\323E\300z\343M\037x\336\374\036\354\t\242\306\254\231\312\322R\252I{\213X\327\312\376&\223\311\244\267\312>\222\337\347I\376\001_\362\363\\\353\327\261U\347\234\3258\377\372y\256\336\331\252u[\235;\253qg\365\315\325\350V\333\266\372\334j\323\325\345Y\375\002kD\n\306\213\250\223]IS\030I7\351\231)\026\304v\222\235\263\277\336d@\277Dx^ZD\013\243\220\304\007\204r\353\\\001d\270\312\274\334\302\216\263=WI\342\0314\264a"
+	.ascii	".\267(2iSXj7+f=A\327\312\312Q\237z\256m\355\013\030\352\215\350"
+	.ascii	"\0021-\321:k\333;\255\351\366\334\007H5]_\274\326\252\0244[\250"
+	.ascii	"l\025\313\033*\261s\255><\313\206\002\322\310.\205LCD\255\247"
+	.ascii	"\332\0338\\9+.\321;\325\\\237=\223g\351\300\223\226\246M7z@\233"
+	.ascii	"D\034\370\020\002\250i\211\326\255\271\273\262)Nk\274\352\263"
+	.ascii	"\266\220\257\336\3507\0312\345li\211\006b\234:3\327\312\265\362"
+	.ascii	"vg\354\310\332\346\254n\237\206g\271\"\354\337\253\fQ*\345\202"
+	.ascii	"@\252\025)\313\265r\211\213\t%\364\220\222\023\036\021\004t\024"
+	.ascii	"t\256\370\2150\262\240\001\311\350\027\f\n}:HFB`\205\037\321"
+	.ascii	"\020\t`\020\205\356W$\224\341\027\004\"\035\375\202\271_\221"
+	.ascii	"\220Qi\004\034B\362\3758\374\204"
+	.string	"DB)t\366-\030\"\362\365|$zFCBE=_\360\250\267 \200\201(~\301\036\022\020\030\354\345\266\322o\225\213\310\\x\205\345n\366\203\035}3\206\364\n;o\345\273}\262\275[OP\332b\231\246i\252\373\016%3 \271\235\2323\303\333\334\356\322\006\030\221q\341\211\024\nH\023s\245F5\205\245\026\201+\375\302\255\225y\026\267\301.-\270\r#\374\001\323\305h\346\027\236\267\305\355\221MS\305\232\364\"D\273l\n\344\032\033-\007\\\250Q8%\225\242fD$HJ\222$\035\260\"\021\263\363\021`\251FXA\251\353w\325UU\333\355\324x\347U\330\203!\016\365g\026[\327Vv\266\377\321\r\310j\200h\273\343\343\340\303hi\263\220\270\205\350/\025\326\023\206\363\214\200\250\357.\006)\316\355J\037@\177s\240&\371\013e\253\320lv[\366\220\260\356\226AJ\t.\b\351\202D9\330"
+	.ascii	"\0043\264Rp\304\204\220.\206\004\350d\273\355\353\322\352rc'"
+	.ascii	"\2739\225\266\351\244c1o\033#\271\374\240\021\315\340m\031 +"
+	.ascii	"\337\304\367Jl\\\206v\322\225\032\037Si\264\214\2425\2770\236"
+	.ascii	".\204\354\034\202\341\366\231?"
+	.text
+	.section	.gnu.lto_printConfigStep.258.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\222\030\355i"
+	.string	"\212\255,'R@\022j\215\001\3779udVT\231%\306\223\247|~\207"
+	.string	"r\212\220*r\3775v}\3377\013\340\035\327\320V\2606)E$ [\350\001r\213\"\0164N\310\337\330\236\234\225\252\334.\246.\236Y\317c\r\325\233F\254,i\037\265\374\"IJ)\005>\002O\002q\002\334>:\345\r8\360n\352\224\233\003\265S\001\276\275:"
+	.string	"\031\346\326\230G\272\222<\312\354T\372_1\367G\243\321(\277\016\346n\322\254\342\347l\301\317Y\202\2373\212\237s\002\354l"
+	.string	";\233\3709\227h\256n\240\356j\026\200\235I\2743"
+	.ascii	"?\347\021\357\034\3749\377\260\263\bv\006\276\263\317;\367\274"
+	.ascii	"3\317;\207x\347\235w\326yg\020\357\234\303\31688\3167\357l\363"
+	.ascii	"\316?v\256\271q\246\261q\236yg\231w\216\3719\373\336\031\346"
+	.ascii	"\235_"
+	.string	"l\234\327wvyg\365\347\234\376\234{\357\374\035 UQR\0013\243z+\316\367)\272\345EK\243\374\350&\335]\355\314\315\036\264\023f\300\215\256\b\267\223\233\006\366u\332D\030L:\337'_[\033\016\\\320\003\206\350\346\230U\303\350T\213v\262\321\026\342\226\030\230U!\330P\204W\204YU\3042%B;\271\350\206\303\261\235\254F\261\230U|\324N~\032Q(\223\353}_\237\217\231\345\366b\0373w\221\320\357\362-\241i\306\002\334\373:\203:\345\022\357\315\005\203\377}\2314<y_\247\t&\261v\312\314\214\200\002,\273;J\311\270\003\314\246\226\300\240\357\353\024\372\035\3556\320\247\207'\304\216\016\210\034\234\033\233_\r\315\214L\214\017\346euQ\323\336\273\313\355\222\"\331@\237\036\001pP\262\344<\301\320\324AfpyO\\3\213\307\210\207\310\212\263\212\303\221\302\221\336\t2\243\210\353 "
+	.ascii	"u\362e\005\004\f^"
+	.string	"=Bm\206\017\317\301qI\361f\002\026.;\034)\370\350\233\0162\243\331j3z\270M\364\227\367\254\301\223\243\301\3625\243E\246H\026\003\225\363\311\274\335\301\030eQRyqI\321\013\342v\246\264\302\004J\205^Uh\227^\002J\320\252\031\250\030\275\030-K<,\271\272\245\365\343\005\036XVL\033U5X\240R{8fL-\325\336\373\2760P1j\322N:\322\275\036\001L\035T\310I\313\201\305\007\025\303\177\006J\251\027|\337\267\275\332e@)\335]R\274\357\313\336\004\225B\263\210f\366\017\230]\0053NYQ\224-\235\313\300c\035\306\\\200\017i\353\032l\355}\337\005:e\027\3421\264v\355]\213\327\342\251\235\322\274Z\34567\323F\033ha\351\223+\374\007\f3\337cWb^\346\201N|\037\363\275\224\347\243\307\n\276W\265\270\275iu=\340\353\263\363p\2054\323\315\255H\267"
+	.ascii	"\324\351\313\303(]\245%\230o\025\377\362\335\366\302]p\227\026"
+	.ascii	"`\327\341W.SO\206\353\244:\251\235\256\337d<\242\234h\365]\036"
+	.ascii	"H\267d*\3257\266\265\275-\345\245\337{\025\357xKQ\2248`\254\357"
+	.ascii	"\373\336p\243\236\\\251\364\233\354\n\273PnE\302\372\2761P\260"
+	.ascii	"\333p\246\033\265\202"
+	.string	"+%\245v\332{\231\031\262`q\3425\\\252\032\353\262\251h\350\037\333\326\020\263\366\347\363\265\203{9\300\233\211O\2719\374&N\007%&\256\367M\352&v\032.\345Z\2717\334\034n\016\265\323\177f\367\312\335\021T\372$\013\360\377j\223\355m)/\311\243Q.\017`\217u\t\303.\207\0162R\207\266\016\340\314\356\0177\353\fM\371\344\n\321\031\262.Ep\211\230\235\340j\375\270[\353\222\0026#\317\024\310\tS.;\rT-\370*\"=\222rTv,\340\021\316\355z\251\314\020D@\006\364v\272\322\004@\254\367]vS\005\353\362\001\240\013Tx7q71\"\005-\306'\271\313\272\207\354\205\302%\035\217'\254LI\375+\366${\222\215\026\220<\356\350\257\007\220;\356-54Lkv\334R\342\230\262p\327\315D\321\344\270\347b\326\200\300q\307\371\236m\334n0[\340|\340f[}"
+	.ascii	"\261\302\275\346b\007\345\201\273Jz&\003H\032\267Z\317\r\272"
+	.ascii	"\003\367\331\2679\237\334:\264\222\f\033\016\\E\336\026p\340"
+	.ascii	"\236\302"
+	.string	"n\353\373&\233\311\rC\355\224m!i\206\005\244o`f\267n&P\3670\322\365\304|yx\036\226\026\270\261\364\257\330\315\233\336\0018E\322\361\270\373{\270\241t\353\375\0257P-\001\323\365u\345\245IP\005\370\022\317\2764\245\364h\367\377\025\3234\f\025\350\1779\367\366e\026\303\2650s\006\r\005\206\t\254\367}Qp\217\365\023\r\002?\330\257^N\234\033S\363a`\301\302X11\265S\237&\254\023\237W\233\321\177\341\223\334\321\265?\243N;\270\337\324\016\366I\343B\024\313\005\266\f\n\373L\362:X)\177\226$\007K\326\373%\351\304\266\334x\034l\331\024\366\371T;\3551c\317z^m\346\225=\363\265\244\374\320A^Pj\236j\260m47\344\315\261\300^\241\302\266}\375\024[\345\301\276\244X+\257\023W\305Ik\205\247\301^ac\333\332\324Ny\236\231}c\343x\336Rp\205"
+	.ascii	"\261\376\311K\353\255\203\274\210\320\374\325\362\211\215\322"
+	.ascii	"\320\310CC\201\275c\351\330\250\222?\201\255{:%\314\005\274\f"
+	.ascii	"\326\256\227\023w&\243\355\231\276\211\275c\361\330(\033U;\r"
+	.ascii	"\221l\225!^m\342\205\375\022\316\313\nK\373\323\016\315\016n"
+	.ascii	"\206\365v\276\262u\362e\301+\222\367I-\323R\353\004\366o\353"
+	.ascii	"\3449P\360\232\024\311\363h\313$\243urR;\335yj\241v\352\356\332"
+	.ascii	"\250\025\326\245?y^\351\240\256)h2Hhk\345[\342\351`\326\2655"
+	.ascii	"\250Z\253\031\234\256\265\352\237(dL[\344|\256\255a\243\265\262"
+	.ascii	"R;\325\271\321\346\320y\265\251\005\256\275jw\254K"
+	.string	"'\322\005\245\207\366\247\034\234\035\\L\bmm\226\f\215-10\261\264\315\036mV\230\373\320f\245[6\230\214\254\371\225\266\371\243\315\312R;\005!\244\035\002\342\325&\364\255\212CuQQ\351\240.)\337_\251\265c2Y\352\240ib~\326j\275\022,\261\035Z\261\327I\333a\211\213\313l\253\035\363n:\322z\341\345\320\"\351\261\257u\351J\240Ns\336\006\347s\272\rSo\036\347\333\t\230\337\320\2065\330\032Y+\326J\260\244\270\rm\023'\355\330\230\332\351\315\2534\334\362\354\272\240\264PZ)\353\262\241u\034\324\320\246\371z\250\343\301IkV\326\246-\361&\355\024\257\202\265\204I\373\364\237\033oa\\\\K\\\2545;k\323\322\324Nm\250\264U\2266\2576\337\306\300\\* \331V\034Zo\235\241\301`\220\244\305\243q\241\016\213\311\205\244kp\257\366\212\317\255u\r]m\335\337\244\325"
+	.string	"\246\205\353\b[[\373\266E\206\366\200\2216\256uXk\345\326e\277"
+	.ascii	"\324\351o\371I\256\371\037\217\221\240\371\232<\034AxLy8\202"
+	.ascii	"\360x\0034D\n\2151<4$\032\036\203A\"\241\021\261\005\321X\f\016"
+	.ascii	"\215E\344qh$\301C\"\"\213\242\361\305\312\306!\362(,ra\"\242"
+	.ascii	"\220\005\222\321\005\311\270\"\215\206E\310\343\021\b+\204?<"
+	.ascii	"la$4\202\260B\3702\\Q,\362`\310(4\304\"\004#\035\t\211\204\304"
+	.ascii	"\"\221HH4\016"
+	.ascii	"\217.\354\342\004\222Q\b\311x\303/\204E=vqB\310\207\207\306#"
+	.ascii	"\244p\310b=\3120\022\261(\b\303.N\034{"
+	.string	"\2708\202qx\024B\272hA$\342a\030\231 \022\261\250\bF\206\206\217\001\004_\3308D\"\026\251\354\342\204\016\017\213\204F)\037_\370\330\302\210\210D\016\217\301\025\301\"2hT$\"\205\306\243\026D\026F\305\241 rx\034\032K\260Q\221x4\016GX\221DGB\026C\t\216D\302#\021\2062!\034\205*^\024\035\255X_\f\221\307\036\017\235 \022\r\t\r\261\0202\"\n\213\204\206\214G\241\0238\\|14\n!\213E\243\220\317\231\324\275\367u\260\210\250,;\006|g\3055\227\306xL|7\343\234\302\306p\236\310\212gV\0256\326\373\256&\3612\230_\331\003\376\024\227\207No\211\335\r\254\024K\265.{1\324\241\305X\323~\350\362I\200mM\300\337\016R\223\353\001 \n[\243i\300\262\261.{'<a\255\034\270\261.?\n\324\351jb\304\003\220c\304\213`S{\362\240"
+	.ascii	"\023\"\203\002\257\203\324\312\320B4=\370&\272\235\317\204\335"
+	.ascii	"\361\300\032\313c]\376\023\250\323v\376\222\tPD\001\352\264\327"
+	.ascii	"L\326\203mz7\031\360\275w\352\223\374\363\301\367*KyIX\316\314"
+	.ascii	"f\261B\274\233~\036\370\245\346\205\246\334\371+\033Z\002\022"
+	.ascii	"aJ\356\276|\360I\240\245}\207\250'vp:\177\225\304\005\201\344"
+	.ascii	"\245L\311\032\223k.\311\243\276%r9@\374\325\023i\021}\345A\035"
+	.ascii	"\324\314,\021V\313\273I\304\3230\241\340\354\340\224~_<\334\345"
+	.ascii	"\314\344QQ\303\371\253v\325#\256\317\032W\007\201\316Pd\316H"
+	.ascii	"\033\365\303DM\352E\371C\323\215\253\002\337\370\345\003\273"
+	.ascii	"\3652\270\353\017\001>\022\n\246\325\325\320\016R\213\262\271"
+	.ascii	"!\204\025\353\3372\n\r\302\202y\261bH\036\b\213\344\351\220\004"
+	.ascii	"\201\370\250a4&\031SC2\"IR\220\312p\001\006\204\030\246\262:"
+	.ascii	"\007\021\260$*!\232\232\231$\351\356\202\3044\016\315$G\003S"
+	.ascii	"\312\217\257mg!m\235\235\353\200H\271\246\030\241<\310\016\034"
+	.ascii	"kW\320\022:7\232Q^A\026\243\345\244\002\224\355e%H\277\210w\304"
+	.ascii	"<b\263xN\201\230@\315\262\363\366\262\361\337\n\025G\272\346"
+	.ascii	"\217\252\246\226\245\002\315\245\n\276\037U\327qU\253GyY\201"
+	.ascii	"O\013z\325\277\307\252\261\316\242w$VCi\211\r\311\267\351\310"
+	.ascii	"\272\372\357\032\201\320\301\013iZ\365\302\245<R?j\350=\356\032"
+	.ascii	":`\241s\322[\366\017\275tA\021\372"
+	.string	"i&\007?\023\310>,p\261.P\232:\340a\333\317\236\017\036\t\220L\320\306\035\347\255EnU{\005\321\370\331\341_1\231\323\323H\216<\356\213 \001\341\325\251\231\035\234\237\335\246\310s\005\312\351\001Ph66NC\367\256y~\212)\205\275aT\247\335\232\025\351\270\3053\2432\301\375\236=\225\223\371\202X\f\274\316fK\305\245q\374^_\314\315'\244\322\021\231\370\327\304b\340s7q\367$\205\350\356\2026\016\367Mj\212\"3\340\177vI\001&\307\233\005K\204\307\2400\357}\027\375\177>\274\"\314\233r\302l\201w\2624r\020\"\250\360D\321\341\371\310b}/\317w\263ES?,\001/c\245hq=\222\034\314=H=ES\227m\222-e\3762\376D\312G\212\276\347\360\304\341\0201Rr\"l\007\372\020\016*@\227\200'4m\374\266(\301S\260\027$\267'\215\204\341)\001\335"
+	.ascii	"\001\003=R#\021\275\347\257Z\355A^\350\313\270'\366\024N\346"
+	.ascii	"4)Zt-g\347\313\035\323\272\031\243\271^\032.\3163\276D\277\274"
+	.ascii	"\006\222\275\311\273O\366\304\257\256\364\263\323\346\3159\372"
+	.ascii	"-\2079\006\204\211$\262\327\244\033\233\313\204\001\031\220:"
+	.ascii	"\215$\220\243\320\302\270\333\256\262\265#\301\013\212\241\242"
+	.ascii	"\036\360\332\262\f|\"o3\331\243\003!"
+	.string	"Y0\221\221\250\2006zr\325[\357g]\276\300\213`L\322\034\220Z\2349p\2147\002\214W\363\227yl\240Y\030\315[*C\323\205\264zFQ\304\243\221\304\330$\343p/\222n\031K\nS4\350\223o\245\223_B\233\223 [_\263\2568\373R\356\350z\240Xd\237\352\253\333\343\376\335\3141c\203\201,\2009\326({~\267\302\327\302\324\367\325|tvP>\226\305\365*n%gCeX\232\311t\261\302]\326O\213abUw\036*s\207TH\305$\262Vnn\024\263\303L\326\352\346\354\007{\310\304\252;\221\265n\222KOl\001\273h\222 \013\262DD\021V\3072\220\311K\nN\0030q\013\372\031\235M\013r\317C5\033\250\211V\004K\215\272\310\245\350!^\030\323Sw\0051}\342'\265\230\003>a\331\027\033\225D\0354lPo\005/$F\221\037\023\372\026\212<\317+\356"
+	.string	"7\260DW;z58\340\370\276\325\r\260\266~eQ\027|\373t\270\n\263\364GO\233X"
+	.ascii	"]\3570\013\336\230\320\251ys[\315C/3\216\020\303\003/\273\321"
+	.ascii	"\262\033-\273w\002\035\360z\003r\333l\326\222}#\300?"
+	.text
+	.section	.gnu.lto_cliDumpProcess.259.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`R\n\2453"
+	.string	"zWH\023A`\246\316p\323xZ\263\330\334)PA\222p3t\022\310\204.\366\362\363\275a"
+	.string	"<(\353\345Q\035\027\255#)w\374B\033\374\237t\275\341|\2246\236;.\276<\215|\250u\243Mv7)\223\f\036\001\017\001\"\001`K\251\005\221\272x\335q\251\310\274\214z3/\234\276\226k\027\322\031\036x\3340\334\025=\314\257\374\227\017\356~\367q{1;\334\007\022\324\207\211\341\324\265\\\307\204~z\204qkVH\347\350\346\376\\\356_v\207;\343q\333le\324\322\334~\356\316\330\035\376\354\303\335\313\016\2275tP\001\364&*\375\271w\373\233z\345\215\257e\353s\360\001\262\373\263\256K\251\237\253 \375\351\364%\364\347\357I\350\317Uw\3730\201\255]\022"
+	.ascii	"\235\021\003\323\\\327u\252\3316e\365FECa0\005\242\347\257Y\335"
+	.ascii	"'\340\243\363\2723&\331u\243\247#eh/\372E\375I3\350U\310\320"
+	.ascii	"~KcQ\220\307##\302C<2\264*dCX8Lzq\360\327qtm\216G&\344g\341m"
+	.ascii	"\013\223{\371S\025\262 \234\242eg\007\232\035\025\033&\303\370"
+	.ascii	"\024&\315\376;J\202\375\234\304\234w$\277\270\357\345\034\374"
+	.ascii	"\360\270s\343;Rvv\006^X\327u\031\231,\373\036}w\t\355\356\333"
+	.ascii	"n\260,\\'l\317\213\373\026\251\257\257\257\3577P\356n\246:ai"
+	.ascii	"^\373\341yn\244\353\272R\355\361\330\b\221>1\321A\345\353\334"
+	.ascii	"\216\211\375\223\0251\202\217\034\321Fm\346\350\244\275\235\341"
+	.ascii	"\340\276\335\245\027\367\332\356\251\360\354\232l'\331}\336?"
+	.ascii	"\341w?\325\355~\tw\363G\370\232\037\302\321\374\017\236\367m"
+	.ascii	"p7_\006K\274QK\274P\017\363}\272\362\333\3645_\002_~\231\004"
+	.ascii	"\360&\035\315\227\030\200\027\300\355\276HK\274G\277\373\032"
+	.ascii	"-\361\026)\361\016\225x\205I\274A%\336T\211\027H\344E\211\274"
+	.ascii	"g\022\357\217\310\333D^\016\300{\nm\207\310X\017\263\363\240"
+	.ascii	"[\327\261\276C\353\335\251F\n^\3362\327\351\307R-I\266\202\255"
+	.ascii	"R{%\351\211\327-3\316\356\345|\216\372;\250u*[\252\221=\231\376"
+	.ascii	"\004\300V\257\273Z*8v4\212m\334\250\310J\231g\203\265\177R\267"
+	.ascii	"b\217\374\311o\201\252Ys\302x\006\215\201uJ.\325\306\310\326"
+	.ascii	"\273'\330\3112\233\360\254\353\332D\300X\217>\244\236Q\357Z\361"
+	.ascii	"\022fC\352\335\"\257%a\320|\204@\357\032Y\255H\360\214\330\273"
+	.ascii	".\030\355H\204\253I\250\355\354t\352\324<\371\365\332\016[\330"
+	.ascii	"[rr\276\270\320\nYf\032d\330\021\362(\315\226\231\002\0216\220"
+	.ascii	"\215\356J\332\233r}\224\tj\356!\340 \217\005\373ASP\333\031\247"
+	.ascii	"NT(|\344S\023\350\264m4\367\344\356\320%z\025\272\253J\341\035"
+	.ascii	"UH\033\315\275-{\300\336U\251p\016\261\216\203\324C\033\330o"
+	.ascii	"\352\263\321\006\202\tKk\320g\013\220\302\243O,\221\324wU+\f"
+	.ascii	"\266\314\001K\330\213\277T,Z\324\2666\364\247\f?g{'\270k\231"
+	.ascii	"\2746\350\240\322\352\211\256\020\031\031*\204\324A\345\307\234"
+	.ascii	"\371&\026\203\376\016!\203\004\021p\361@\307\245\332\003\272"
+	.ascii	"\236\332e\3257\025N\205C\177\022\373b\376;\324\354\303\247l1"
+	.ascii	"hI\334\364\"\340_\357f\330\300G\256\323Ww\355\236\317\373\224"
+	.ascii	"\350\340\201\217\364\320\302&\237\266\337@\273\231:\\Y\305\252"
+	.ascii	"c\221k\006\206\001/X"
+	.string	"X\301P\222QD\221\345\241\310\002+\205qKK\300\203\341\321\212\243U\b\255\026/P, \026\271\254\270\252\202\305,\243\006\255\"\3271EQ\334\302z\341\242H\342\250X\334\342 \203\013\335+\007X,\256\246\256RLeaY\265\230\272\332:N9PZ\243Vqk\212\313h\334\232\032.q\274\223\330A\273\303\321^F\021xW\r\242\016\341#\367{\354\230\335yuW\360\013\017IQ\257%\365\226\234\0360h\252\221\244\3566e\226\244\275\235\361\217/\307\261\\\225ZD5b\004\375\251\305\367\245\271W\200\n\0246\303^[\346\362\25037\274\256@yr\276\254\221\227pQ\375/N\204M\315\324O$\347\200\001\254\251l|dS\263\033\200v\300\344y{\342\306\004{m\211?\242P}/g87-]\201\362\342|n\215\334vL\267@\365\347\016\025\306\307-\355M\371[\327uM\201G\235\345x"
+	.string	"\013R\357\210\026\365Q\377\230U\216)\225\242\246\321D\304\247\\=6&@\320\030\350S\237bt{\344\364H=\n\224Oi\036j\356\235\275\026\200\321\250q0\246\024S\210fDD4I\222\326\220\002\231!3n\02101dlHF\n\252\346B"
+	.string	"\234H\325\323\206\370o\0054\302\254M\365\025\321\206F\246\006\355\266\215d\267\360\246.\004\236\362\210\340<\257\266\032\246\361\336\324^\b>\3533\345\221\364\306|l\355dgM\276\244\037\006.q\316\314\345\312\224[\377\223+o\266\222Q\327\222MRL\220\335\351Y\325\273;q\246\034\201n\006\030Y\346\307\370\205\312f\374\337\237\025\231\333A\205\0225\252\354\315\211y\215\212`$\1772K\260\317\373\213\364\233\235\203y~\322\274\213\233\210\032D\314<R\372fc\323\236\374\350\304\331u\323TQR\335\241\264\0216\367\372\032o\350\324\311\333m-L\352(\007\3331\261\217Z\202}Vy\024Af[\033\206\330\300\344\324\206\035\307J`!\261\325>]\f\251\304\253\035\n\031\3124f\350Zr\323\363\340J< \033i\230z\217Y\214\037\021\266c\243\264\340J\271\370L1\304\220\365"
+	.string	"\026\035\224Ri\032\276\231=\341v\304\365Nq\201\314\277\224\227\347\202\320\262\323 '\321\216\300\020\210NY\257\227"
+	.ascii	"\353\246\321\332\352\273\305\343\261\247\326c\331\017U\263%\001"
+	.ascii	"\016\013\366\301\301g\004\324b0RS\026C.h\023\354\216n\367\335"
+	.ascii	"\213\213\230\231\347\372XT\271U\252\245\303$j\303;\212\035-\217"
+	.ascii	"\027\367\204\251\001O\200\315]\016\311\303'\215\310^\203X\227"
+	.ascii	"\226\\\251*\276\353kmH6\013\004\311\201\031]\r"
+	.text
+	.section	.gnu.lto_printConfig.260.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\336\004\335\035"
+	.string	"\366\265\301I\220\\U\007\210\272\224\355"
+	.string	"\243dP_~\t\026\naX\244\267\271f\300`\017\325e\bH\213\257\262\032\300T\005,v\367\2532\221:%\026"
+	.string	"\264\020A\3442\222A\013\210\303]\325\201#u\021\036i\377-\367\3362\311\224\002\251"
+	.string	"\255"
+	.string	"\253"
+	.string	"\0012Tv\337\027\252 \230\234\215:~v\003\374\266\273\301\203\234\033\203\f8\031\345\322\024\035\267\335\276\344L9\037\"\344\002rN\"\322$g#\203N\200\375l\243\023@\375\304>"
+	.ascii	"\365\263s\335S\006\210\262\356\001\325\021\357X\225sn=\016\317"
+	.ascii	"\371\272Rq\212\236\367m\256=\225\240\366~:_\203\276r(_\020\311"
+	.ascii	"\252\bl\030\001\035C\371\200\367@\316\331\217\216\340\207\357"
+	.ascii	"\310\2464\034\335\235D\327\305\372\343\331\277\003\200OK\326"
+	.ascii	"o\350.X\022\221\374\350\266\350\307\2636\225\220sn\333\373\031"
+	.ascii	"y\327xw'\351nY\367\255\021\303k$e\005\375\244\365\211\353\205"
+	.ascii	"w V)6\\\226\200\234+$\314\004\336uX9\331\351\t\251\334\037\""
+	.ascii	"q\365Y<\311\034D\235\300;\f\352\177\225%\223\322\201OK\037\357"
+	.ascii	"B(\376\022E\272\270\260gZ\265n\304\217\320\030\344\310y\347="
+	.ascii	"\024x7A\201\237\351w\333\200\254\367\360\027\020\022\215M0D\257"
+	.ascii	"\3536\352\354\017\273\375\346\234s\177R7\313\306\215\3565\353"
+	.ascii	"J\305>\304=\365&\357\363\276;y[\267\355\005\236\371\003\306\013"
+	.ascii	"\032\016D\346\f#\r\232\254<\237\364\360&w'/\342\307^\273\333"
+	.ascii	"\t\347y\227U\220\241B\212\320$\024Q9g\b\355W\\\271\241}\207\237"
+	.ascii	"\315\301\203\365\236\007\324\317\024\315-\315\243\0266M\337\330"
+	.ascii	"\356\017 \254\367Z\207\371S\016\255\007\034\007\375g=\200\240"
+	.ascii	"\324\222\bt\262\372a\373\321]\206P\210\020\333|\337\324\376\177"
+	.ascii	"\221W\t\201G\340\035\t\005~\236\376\256d\331T\0038\016j\337\346"
+	.ascii	"W\310 \222\027c\310\246\2619g\035\376a\337$\213I4\375\234\342"
+	.ascii	"\215s\375\234\342\356\256\036'I\234z\225\211\305\177~\021+I\344"
+	.ascii	"\201z\024\317)\0069qq\306\275\216Cs\210e\336:\016% $&\255;\016"
+	.ascii	"\265_\024\204\326\374\363\226dI?m\273\315\200\\1\030\217\332"
+	.ascii	"\263\231\353\266\rvs"
+	.string	"\325\320\206\315d1Z\355\007w\rv\263\271z\322\0236W\206\237\036 \036l\363\241\311n?\2644\026\223Q\240\361\2400\037\331\214\247\347\225\366kG6{\265^\261\226\217\314\325\323z\325l\255\235\233\246\375\300j\255\033\215Vk\255\306\3547\177R\353\240b\342!W\254\357\253\376\337\225IT\266\370\241\326\361\356\t.\246\245\204\3615\275(Y@\273+\370\224\205/+\232\314\252-\336}\301\245p]R3L\224\204K\016\305\2731xT\020\323\215\232\313\252v\034\332\235\301\265d\021\321\\*\215\271\337\255\301\261\340n\002Y\250QD\243\030R\206F&\222\240\302\204m\016\320\002\031)[\035\0200\247h\2064m\347\260\254\244#\250\244B\022Jq5\2110\017\252\253\234\006*\274\302\233\026\020v\353e\310o\373\352\363\330\023S\220\342\036\254\347\361\301\355\211[\314\357\225\255T,2\216E-T\324\331\"\337\216"
+	.string	"\226\336\377\300\211\240Q\265\340\2079\205\254\361%\0071\253\201X/\340%\243\312\026\327\226i\345\317\250\274\303"
+	.string	"e\177\n\313V\326\201\203\3178\262\230\2134\354l\025\023\030\320\"\251\376\026"
+	.ascii	"\371\207\312\004k\006\317O\377\302\224\350#9\245\330b2\204$y"
+	.ascii	"\301U&W\001"
+	.text
+	.section	.gnu.lto_cliDump.261.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\020"
+	.string	"e\007"
+	.string	"\242\31645`\215\032\003"
+	.string	".NI\355+{A\254V\214\363\031;\220\335\343\255J\200\207\320\236\204\377\357\305\362=\302\352\013"
+	.string	"\254P\230\204\217\005\201\301\256\262\022\273\267\224)\005\234\317\325a\360LK\347\346\352L9\033\344\347Z\360\310\231=\310\215@1\007N&!0,\223\231\357\256\036\273*x\246\024\212\"V\264\202\006\206\261\215\220\200\346\nI\274R\n\005\212[\373m0n\264\256\376\277\261kM\262a\025O\243\320E\2065N\177(\005\345&K\244#\323\326\260\365\310\037\232I\023\006\370;\257\364\177\007\325\\l\365\363@\305\326\305\001\025[\325\332\022\002\3207\004\223\021\213\220\223\3772rX3\324j\203\030\303\2116CK\302\377BN\204\341F\267\325\264-h\353\021\b"
+	.ascii	"2\241w/pq\341\005L\271\004\333\254\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_cliDiff.262.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\020"
+	.string	"m\007"
+	.string	"\242\01655`o\032\003\2042X\351\\\342qB8llWt\2463.\272#e\"\332\037{(\327\336\303\245aYD="
+	.string	"`\200>\240>.\030ArBjB\366\2262\245\240\321\025b\020MM\347\347\nM9\033\344\350Z\020\311\231=\310\217@1\007P&!0,\223\235\357\256\036\273*x\037)\024E\254h\005\r\fc\033!\001\315\025\246x\033)\024)n\355\267\301\310\321\272\372\377\306\256\365\311\206U\\A)]dX\243\344/\305\300\\\305:\361\350\2645l-bO\363i\302"
+	.string	"\177\027b\362\177\007\365ll\365\363@\306\326\306\001\031[\325\332\026\002\3227\004\027\026\013\222\227\3772vX3\324j\217\230\303\2316CM\302\377B\316\204\341F\267\365\264-h\013\022\b"
+	.ascii	"2\241w/pq\341\005L\271\004\333\254\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_cmdTable.263.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\002\020\245E"
+	.string	"\332l\230\030@P,\251\003\242\365\245\242\204?V\fJ \001\312\021z\021:"
+	.string	"\314\003@\206cO\210\354;\271+\310\367\t\267\344?F\207\363"
+	.string	""
+	.string	""
+	.string	""
+	.ascii	"\006X\005\270|\260J.\177H;2\246b$M&)\003\202\001\206\001s\001"
+	.ascii	"\301w\302\037\371\244v\347\233\324\276\226\374\350yP\023\220"
+	.ascii	"r\027D\375!\301/\302\377\210\221Z\027\"=\310\036\262\337\332"
+	.ascii	"\022\236\220^\344\227G\366[\003\222\244gf\023\320\201\327"
+	.string	"\361<\370\373\370\036\265wG_\322d\277\272\354I\3275\003!x\256\267\301\037\307\337\320\210\276\253C\221\262_\335\206\2122\001\263\023\317i\236\364WSk\351V\272\256)\bM\201\231&\236\3176\351)\231\272\327\016\231\314\262_\315\243o\351\272\246\030\332\002Hj\226\024\314\224x\266T\251s\361\262\337?\233\324\301l1\373\375@\221:\231_\232\331\357k9\323q|\232\210\0304\"\343\271\314\321S\341\215\211\330!\223?\244\177u]sL\331\240\220\232\017\0053\"\236\025%\352i\372\232\375\276\0171\020!\366\233;\031\0221b\277\031\022\211\236\0215\311\224\016\372\250\371O0\207\361,(P\t\023\373\315c\200\\\354,\210\347\347\304/Q\354\027\250\242\007`\322t\244|`\007\017\317z\362\254`\261\337\027w\\T\3557\205U\3275%Ax\023\207\3479r^\354\343\361E\367[\202\007\247\267C&\323\375v"
+	.string	"v]s\022\332\361\330\025!\037\270e[\376R3X0\253\341\231\315\032\343<\352\350\372\260\246\335\305\375fH#c\207L\036\217\357\214\375J\340e\033\3164n\331\206kt]\223\322\033F\235\216\307\256\314#\333p\315\021\306:\250{\272\2169\206f\3238T\235#\250wp\335\203\307\366\322:\214}\376\354\027\227\246\337\260\216s\302$S\336:\251\237\026\324G\256\2734W\211\215\366i\214\347\311(\350\227\204\366\213Kc\250\337\3740\313\320pg\234\320pf\214b]\307\244\244<\036\273\276\222\372\227\202o\306_S\246v\343\272`2\232m&\226\214f\277\304\275\211z.p\026(\023\022,\347H\375e\360!\361\227\024\t\307\365\310h\266o\223xe+~y#[\324\263\037f'"
+	.ascii	"\211\026\361o\304\350\026\246\310\330\310H\266\337\033\032cY"
+	.ascii	"\3271=\005(\244f\260C\206J\354\220\311\333\030\343\243\256c\246"
+	.ascii	"\351\276\217\372\177\202\037"
+	.string	"\306_\320\007\272y\001d\214d\234\264\337[\021?7\036\225\340\b\240\243\276\235\340\343\341\257'\317\315\306\235\336\266a\252\323\271~\331\350R\317\231\232q\006\264y\303?\016\034\233\030\317\215\321l\207L\0325\355\327V\347\254\353\232r\224\004^\251>\232\340\203\361W\363iln\276:\327\266\2119\323\271\374\322\026\205S\317\230\232x\224P\357E}0\301\027\303\237\314\030c\323\350i\2776$a\272\327\256\245\361\276\264\277\324d\374\324\363\246f\236\002\217\345\265\360O\376\226Z%^\226\316\265C&m\354\267\246\bG\3275\365\030\220\242>\225`\006\343o\245J\317\261C&w\354\267\006hJ/\362Xz\364\026\315=\312(%\3523\t\352o\270\366\n`7mk\0308T]7m\317\0248D\261z\004\260\025UZ\024\242YS\036\250R\216\016\247\252\n`-\225\2676|\352\360p\213M\331T\313\207\256\302\034"
+	.string	"\001n\332\246l\016\200"
+	.ascii	"*\255\365j\352\244\322B\207*\237:\251|iJl]\224\355\261\305u\315"
+	.ascii	"b\323v\352\244J\205Evj\305\341\266\250\303\355\r\267.\352\266"
+	.ascii	"g\260E]\250\215\207\253\332\262i\326)c\305j\005\340\036\006U"
+	.ascii	"\330\223\352\375\244\206*\312\245zl+\205a\207Wb\312J\271\353"
+	.ascii	"\312J\005\300\271Mv\223\351\344:yO\346\223\007eByQf\224\227\371"
+	.ascii	"Q\276\2241e\264\314)\177\372\343\277\237\343\177<\220G\362I\036"
+	.ascii	"\312G\371+\357\365\\\276\313\227y3\277\346\331\274\234\237\363"
+	.ascii	"{\236\317\017zB/\366\210~\354\311~\322S\372M\034\236\371MmC\337"
+	.ascii	"\320>\364\017]D\033\321Lt\023MEW\321Z6\350/\032\214gjl\364\026"
+	.ascii	".\\{\351\222\023\323\311\034\233/\245\025/\256\263h,\271/}%\247"
+	.ascii	"%M\3271\303\320^;Q52\250\243p=EK\311Q\201b\\\263"
+	.string	"\333\354w\247\361\236\270\370\345\276\364\246\347\250\263\260/H0}$\t\327K\264\222]\206\304\030\3078g\277\273N\235\232\006\242\205pMd\210\361\316\316\263\337\035'H\367\332!\223\233K8\005\016Q\026\206\017\315\271\303\224\273m\021\206\017\325*\2425\334\246\276\025\253\347\242W7\316\026W,W\225q\2663\204D\":\001\373\206)\213\272\255\016\347\036`\341\225\306lz\256\356P=\023\340\337O\365\331\360\311W\366w\266)\260\002\266\271(/\372\242p\215\326\025\026\321_\352\243qZ\t\205\350V\273\265\305\246n\213\362*\n\330U\265R\033f\213.\232\376\250.lY\210\302n\n\254\3413\025^\241*\213f\235n\n\214\302VU8\334\022\201\004Z\"\360d\200\211\302\024\313\206\211(\257a6\365\261k\217m\200\255\250\210(\237\252\3327(\334\252\302\001\234\257n[\354E\3350\273\272+wS\340\200\252\323"
+	.string	"\261\3459\334r\276\366Nb\313\317\004\330\252jc\033v\177(\333;\177\3539"
+	.string	"\373\206\305\265}1\003\025\022\003l\035N\205\352oe\211\347\231\002w\330\212J+\365\r\325\251*"
+	.string	"X\213\305\341\366\207\266B\025\375\271i+\005\001k\261\033\267\354)L\207\247\026\353"
+	.string	"\333\260\273\256W){\372\206\350\231f\241-\224\020U\023`\003\330eW\"\352\242\276\023\013Q\225M\333suO,`qe\261\334\266E\211g\207\323*\365\255\274\352\264\362\025\321\253\252\223\312\247NY\3007\334\256Y,[\004\006\201o\250a0\253\234S$\"\")HARh\f\261\205\306\031\351\320\016\021"
+	.string	"9\306 )\243$\303\034\350H\240\243\266\033\247K\001\251"
+	.string	"w"
+	.string	"3$O\243H\277\372\302\347\213\020\003\353c-S\255\351\247\317\177Gr\243cK\263\355\310n\251\374\rRn)K\026=^\372\370\260>\246\361\255x\3120\252\246[R\364\242\036\372C\210\t`,\200\037\255\212\277A,$\227\213XEs\013\002\b\017i\211\362#-T\017\212\352\354\266._\024x\325\340\031/\373\005\246Q\376:xB\362w\2612\351\203F\210\2650\004\001b\224yN&\\p\371e \243\230Q6 \267\356\352\213t #\331\\\025F\346mF\316c\2772[\\\223\211\344Ia\253\300?\237\337V\005\r\3426Yu\215\342U\365\007\t\245\361\260\002\021\026\210=?\253y\027\337\363\025`\220\321\355\356\032\300\346\024\205\202%\004\376\036Id\357b\230-%\333\325"
+	.ascii	"\201\251\252=\205d\353\267\333F\013*\200\366\251\203\\\211h\310"
+	.ascii	"@\025\231\266m\267\3206\017\020\2011\247\022\272\326$\240\177"
+	.ascii	"\020\272\024U\202\343\301\034\341\031*b\217j\0236\267Y\360 \246"
+	.ascii	"\302\334U\334oa\214sN\344\375.j\234\207\244bGrbZ\306`\034\225"
+	.ascii	"~f\230\b9/\246\246\025\227[k\233\020\343\266\rU1-\240,\251f\235"
+	.ascii	"\351\242\357U(\361\360\372[\244\037W=6)/\347A-Y*\244\211\242"
+	.ascii	"0\3146\323([\2319Mj\256\227\275-"
+	.ascii	"\213\300\202\352\306A}om\342\357XN\261<k\324S\300f\\~\022\315"
+	.ascii	"\263\267\254n-\257\322\f\364\247\032\333\006mz\201\031\272\272"
+	.ascii	"\036Z\276\231\333'q\260K\027\316\354F\245\321\365\204\336\352"
+	.ascii	"q\301\211\340\324uA\246\203+\210|1:he\366dC\310b\226\335\300"
+	.ascii	"\353B\024\245j\303*\367\214\371\345K\325\340\222\3045\231\314"
+	.ascii	"\231\003f.\0038\257\215a\270\322\322^\207u[\372k\260\022\252"
+	.ascii	"\026\211\005\025\266\215\236\247\r\356:\264\210\221^2|.\377\240"
+	.ascii	"\255\211\245\333\342\360\212\025\001-\376\244(\005\203\315\320"
+	.ascii	"\362\346J\246\031\30365\247#\330\2666\024ns`\005H\333?\342\237"
+	.ascii	",\334\244\274\321l\033\b\201\020$\300>p\246S 74\372\263\330@"
+	.ascii	"1s\330\021\306=5\03501\251e\002yB\021\230\3700M\016\333X\335"
+	.ascii	"\003J\310\240\007"
+	.text
+	.section	.gnu.lto_cliHelp.264.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\304\002\255\024"
+	.string	"\006%\206J\260\022R:\002]%9\334E\227\264\350t\301\3321\357GO\227\277\030\361\345P\364\225\244C\265\340\n\212\224~\364\265o\377\264\235\345\016\322\211\356\335A\372\263\263\263C\311\026\343gU\366\r\f?\366Un\255\217\222O\b\221;\245s"
+	.string	"i"
+	.string	"q"
+	.string	"\306\331S\btj\356\301Qjg\351\252\326*[\023\216\235\024\336'\305\375u\272\314\222\\\212\363\223N\0325\351\350\371r\177\221\277\n\021\344=>\004\221-;?@\350\350Y\342\007t\327\317\315\235\023O{|<Z\372\234$O|D\251(\361\351\220\013D\b9\221\370vtO\274\313qJ\310\320\017\350\3245\241\326j\332\363\375\356\221\333fa[\202M\231\002\301\034\272\265UA\241\240]\240-\314\321"
+	.string	"JQF/\221\r\373\360&\227z\227\232.\365KZ\206\236~\036\344Q\253\207-\255Z,\241\214>\274}\241OT:\f\334\2078\257\277z\236\024\307\251\252Z\205)/\235r\276\214\221'\261}j\037\351/p\017v\270\200Z\211\\\330\250U\250b\006\347K\013o\300|y\236\200\3712\345"
+	.ascii	"J\367K\207\262p\300X+\357\275\013'O\245\301K\373ev TC\212:\233"
+	.ascii	"\243<H'V\220\013\264]3\351\332\206R;\212e\033\3464j\t\212f\330"
+	.ascii	"\230\030\237\350\326di\001\240_\233\226\201\276g\026\022\273"
+	.ascii	"\315\331\236\271\214\232\002c\255;\b\2669\274\311\346\244\250"
+	.ascii	"\326]\004\246\307\270\221G\361\322\033n\314\367^\3727{\342I\254"
+	.ascii	"\254#\221\276\241\274F`\246o(1\225\230I;\f\rM\006\303\314\314"
+	.ascii	"\345\331\nMf&\233\305\310hh/3\262\231\355&[)\340Z\r\214M\246"
+	.ascii	"\241V\263\311H\204\365I\177\217\225O1gu\257\005\232\345\310\005"
+	.ascii	"\333\362\210\272\347V'k\255\365\\\340qLra\033C\025<\362F\350"
+	.ascii	"\350\226M\250\355B\301\311\312W\324m\216\272v\207\203,s\2015"
+	.ascii	"\276\025\236\003\307\215\335\232\254\"-\0027 \300\002\2311\262"
+	.ascii	"\r!\360\035\037\210\331E-\022\276\365\246\307\223\322,8\301\f"
+	.ascii	"\035\333\303b?&\216\267H\013y,\303\020\311\027B\216\361\270\215"
+	.ascii	"\334q\260\210eh\206\024\353\313x\023\361\2057\307h\355\222\336"
+	.ascii	"\230\243\362\r\033\324L\2739f\037jir\273w\216e\317\232a\f\324"
+	.ascii	"\334\355\354\302\232=]\265Kc\021\334\254\3051\340\207s\032oq"
+	.ascii	"NQn\247te\2466?\001"
+	.text
+	.section	.gnu.lto_cliProcess.265.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\035\032-\177"
+	.string	"\352\312\330-K \016\333\031\003\013\177\252,\266\205I\221~\343\357\376\326O\251\250\tQ\225`\222u\265-7~\313\025\362\025\025\251J\265\333\345\227\223\243\234\334p"
+	.string	"\001\365Fn\344T\377n>\013\364\002,\205\335\002SR\360\332.Wn\231RJ\001\325\002\222\002\316\002Z\334\336\302c}\277\340^\257\241)\027\3056E%\270\266}\330\226\366\025\267\345z0\265\340^!\312\351\034\\\233bR\333Gf\003\261}\\\333\207\3556\356\270\022Qn\303]\365\353|{D\251fi\336\027\216\251\217\214\324\366\221\333\255\337D\3506.\2618U{\337W\331Gf\021\230\225}\\\225.\363a\303\221\275\033\250@\236r\212\357\373B\375\022w\242\366\325\300\314<:\314^\341\232\241x\211\257\264n\263\034_a)[\3418\206k\301\202j\205\212\024S("
+	.string	"\220\212:a\242\004\211\021PONML\"\226B(\201H\372\200t\344\201i\324\241\210\210\303\320\006\rBA@?>\031z0\360p\226\035\235\2452\231\323\"\331\343\312X\336]\356\254f9\"\261f\020\266\037\316W(\220\"q5[\3418dU\034j\013\fGB\220Xs\004oA$\326$\241\352,\334\032\235\312\215\321W\250p\213\343)V\021\213+\320\337\030\0328>\265\016\021\033\333j\024Ab\315-E\007\300\210M\212\024\342\241G\031\332\235@\323&J\234i\022\200\320\3024(\241\217\030\314\333s\250\276~\342\033t\247\274>"
+	.ascii	"ML\232\276nB\223\006%\343LiP=\027\001\b\035c'\306\227\302t\210"
+	.ascii	"0\2554m\020\200\320\251]\235'Q\273\370\007*\235#!\253\304\274"
+	.ascii	"\334\372\250\001\241s\235\006\345\342\036v\372\302\336\230+\013"
+	.ascii	"02C\372o\fM\247A\265\270\321\226\225\031W\305;pu\221\033\233"
+	.ascii	"\023\2655\007o\353!*\275aE\376\350:k@\350\332\212\002N\232;4"
+	.ascii	"\327\240\304K\255\205\242\324A5b^j\035D\005h\225\022R\247\326"
+	.ascii	"\200P'k\316a\013Z:\rz\346?\177T.j\224x\205\265\017\262*\220\252"
+	.ascii	"\247F\314\313\2543\224\245A\233xO\031\023\307\260\256pSc\322"
+	.ascii	"\200P\262\365\255d\311\353\272\366\220\0065s\236\366\021\326"
+	.ascii	"\234e=r\302F\327\200P\263\265\350\356\n\224 \261f\227\357\254"
+	.ascii	"\255x\304\260\001\241`+\213\247\031\023\272\356\351:J\274\220"
+	.ascii	"\364\322\203rmz\341\211\221\006\204\246\260\372\024\241{\241"
+	.ascii	"\323\240G<\211\254\212BeS#\346\225B\347\254\"\322\330\271\001"
+	.ascii	"\352:\333\3524h\021o\001\241FVf\032\364\313\221u\r\003mNK\033"
+	.ascii	"U\314\013I\263\353\023\231!n\r\b}[{\306\316H;\256\235K\210\323"
+	.ascii	"\217\315\326=IT\262\347t\210\330X\220^1\214\001i\306\262\232"
+	.ascii	"\370\241\230\002\221X\263\204u\t\347iF)D\313\177m\372\332\262"
+	.ascii	"\267#\244\271\372\bJ\031k\266^Q\020k\006qGV\275\357\313\276%"
+	.ascii	"\304\253\271\200f>F\231y\007\363\217bM\257\372\362\243\274\210"
+	.ascii	"V\006\247\374$\207="
+	.string	"\225(%|0-l{\311\025\354}1g\2736\201m9L\235\363\256\304\311\221\337~O\273\215[\326\276\257\217\304f\343.q\231\270ee\256\023\027\315{+\347\373\210\n\316\317j\241\323\270O\332\367\325\222\342Ft\207\270QZ3\036\337\202\360\255\306#\1775|6\372\360j\267b\030\224\256\355\301\326\370c\226\3003\237\346m\205\"\310\217\236i4=\334)\356\232\273\306\366\261\306w]'\t\006\372\361\304\361\275\300\336`\331\317!-<\376\372\354;\343sH\213\343\177`N_\2611~}$\"\027\304\347]\323\253|\344\377\314\256\233[\305{+\3063\333L\007v\340\342\305\013\266\217\377\035\327\253\230E0kST\350\240\307/rf\030\006\364\334\232*~M\236kt\262~\224\273\275L\355\217\200O\222\241\257X\t\376\353mI\\b\231\275~c\004\332\357\252}\337W\212\233\257\373\022\3406\353#/\300"
+	.ascii	"\003l\037%\370~k%\247a\033\230\333[\220\3673\313p\300{\213\231"
+	.ascii	"\326L\361\323\372,\1773\245\353?\312:\330~\n\244\204Z\016\207"
+	.ascii	"\271\303\264\030\035\334f<\203\206\367\026\r\266\217\375\315"
+	.ascii	"\326HD\314\250\201\271}\371\360*3\\\323?\312\334k\230\030<\376"
+	.ascii	"$\314W<>\330Q\203\307Y\202\007f\264\227f\031\r\327\034c\001\036"
+	.ascii	"g\005\\T\265`A\325r\315+T\244\230B\321]\232\245\272Ks\324\322"
+	.ascii	"\371\004\322\331\204\322\271\304\2163\211\245\363\b\036g\250"
+	.ascii	"\245"
+	.string	"\363S\3435;\265\316M<\316L=\316\"\222\316K\r\2469DoiV\332q\006\261tNZ:\177X:#\365\\\363\321\322\331\303\322\231\211\301\331\250u\356\320:\027\265\316DK\347\241\245\363\006\245\263\006\036g\241\035\347\240\2443\320\322\371g\351\354\263t\316\260\343\334\223t\306\220t\346\331q\336I:\353\3508/\227\316\312\244sR\351\234\223tns\234\221\2553\333:\037[\347\025\351\374\254s\207 B\265YF\216\032\344\005\341\336\256\352\342\353w\274Ck\274n0\335^\272\345\272\267t\317uw\351\206\353\226\271\231\373\216\033L\347yE\343\340y\200\341\005|[\210[\034'S_\356\370H\344\320\fX\233\035+\275x\220D\324\033\004\240\265\302\215\245\2714]\327\261\262\013\017fV\317\373&q\363bb\216GUs\004O\242\327\246\327\324f\351MA,R\272\214\0315\020\036\2602\376\370DSE"
+	.string	"Gr*nY\004\214X\024\327\260\250Xq\274\267d\274\317\271A\342\367\343\263\330\2053cU\335,\273\3569\343\346\004\227\203\342L\"\354\016\357bEO\364\035\376\330\3469D\247\350\331\275\347]\222\350\3276\030\252\270`\366\3418\005\315\230\264\220Y%\313C\252\3725\323\334\246\320\217\326\t\203\021m\f\333\321Gy9E0q\tM\313\313\303\no+~\346\226\005\r:!\001\002?\223\330\206\267\020~1\t\177\026\245\340\031\r}\237I\t\231\f\351-.R\277\226\024\r\233th\251\26236EK\205\034>x^\207\256~\305s\255\370\r\377\202o\311\206\027b\362\325\335A\264\276L Z\361\037\274\317\264\256\352\004\323\360L\241\327\360\336%\350\205\276\237\215NOb\325\216\005}\243\260\270\270v\347\303\253\316he\255\t\207\2172P\037\022\276\rm\330BaDJ"
+	.ascii	"\252\361W\317\305=\344r\031\020\306\257\271\241\256\235\270\b"
+	.ascii	"\355x^\203\216^\352\271\370\225\336\001\245}LW\035\001\213\206"
+	.ascii	"\217\272i\251\337\361\034\272\352\2628\241LyN3\036\313\354v\271"
+	.ascii	"B>\321\005?)\007z\032*h}\026\022/\240o\257E6\324\277\"\3152\""
+	.ascii	"$\345=\365#\356\tE.\221\326\351B\251\210{\304\347\022\253\264"
+	.ascii	"m\317\262\240\217\262\322\037}\303\221\026\352t\361\271\001\031"
+	.ascii	"\366\317\267\330\327\317\307X<\244\376\370\240\340\317V\276\317"
+	.ascii	"\373\240\321Mw\236\2311\360!VF&\buu\311\333Zc'\267\326\350\363"
+	.ascii	"Q\006\321W\344\254G\371\037\036ph\227\227EAEf[\261R\034\210U"
+	.ascii	"\022\331\373\276(\270\023\235+\212\214M\206\347>\343$\364\326"
+	.ascii	"\232\356\036\354\207\317\360BS\2727N\260\246W\227x\371e\370("
+	.ascii	"c\367`\225\377i\322\275%7J\320z\\$\354\316#_h\341\013\032\272"
+	.ascii	"=\f\037\355"
+	.ascii	"\371\235o@i\004=<\217\3415\3109\2414\275\311\002\317S1y\363\254"
+	.ascii	"\n\\$\334\356\023\266\217;\337\\F\226\237|\235o'\024\345/\277"
+	.ascii	"\253\312\007A\310H%\2716.\006\256\275\261\336^\330\037\017\222"
+	.ascii	"H`\031\030:*^Ig\352\217\236\353\210\354--+\261\314\340\316\272"
+	.ascii	"L\361\205\3179\025K\024\357N\250h\317)\3135\325d\311\343\217"
+	.ascii	"\205,\021Y\324sM\033\216;"
+	.string	"vb\360}\235\212Mu\303\326\025\334\261\366}\235\355\333l\310\3661\352s\004\003\005\245d\264\034\316\252\363Q\366d\024\2210\"\2079*>\305s\361\232\234j\2600\"|\312\250\3475g\352Q<\0273\263}\330\250\347\3619\246sS'\224\3342\333\225\225pl`\001\006J\314\0369v0\233*\2601\001\007\034\334\260b\332\340q\303\206\0066d\020q\001$T\220\240\301\341\200\02248(\031\001\032\034t\216:l\334\310`\007\216\033H\034]\001\007V\277#\307\004;t\340`+\260a\001\2165\203\266j\266z\312`\003+(\253\013\240ld0\001\007PV9t@=\375\360\r\034\026\344\200\332q\343F\016(%\234\217\376$\337\324\033\200\200\005\236\327\027N\357\342\304\277p\300M<3\326\027,<\357\255\023\3774\221%\320\f\314M\305\226\2263\001\002\250z^\213\\\274\323s\241\350\353\242{\361\321"
+	.ascii	"\246\274D\214/\361H\264\276\276g#\211\003^\313J\350\2331\236"
+	.ascii	"D\343\210\317\032\372\021\237a\332\227\347\004k\226)\226\340"
+	.ascii	"\"\357H\231\252\2172\023\236\265y[\224\221\022\036\233&\250a"
+	.ascii	"\301\327W,\324\277\360\203z$\243\023,\351\\\002H5\364\307)\210"
+	.ascii	"U\244{?@\246r+\342`\345a\205i\2358\336\214\021s\3057-\233\247"
+	.ascii	"os\304\303\322C\377\364;\210|\202N\260\217b\026\246\342\211\210"
+	.ascii	"\226t\022\005\222\242\332q\2354\005q\211\224\260\303\032\033"
+	.ascii	"\273\251*\034\230e\016ESa\032Wsc\f\326\336\036\333\307\246\027"
+	.ascii	"\001\261\210?\361\323\003\300\347\336D\361k\206y#\365Q\376k\005"
+	.ascii	"\276\355\334\254\360\205\021pCG\243\300\367\2276*\323(\023-\236"
+	.ascii	"W&\027_\365\\W,\323\240\023^a\365a\375yoa\375\261}d\372\030\214"
+	.ascii	"/P\277\024p\177\233\307\260L\335w\036\350\226\005\221\231\t\304"
+	.ascii	"\022|s\202\237\363\263N|\364\017\004\306>\023z\336\207EhD\206"
+	.ascii	"u\246u6\240\324\307w\263HT-R\242\305\263\210\3072t2X\210g\"\276"
+	.ascii	"\363zM\303\310\267\226\342\360\220\004\024\325\263\023\325\207"
+	.ascii	"x.^\241X\274Q\0247N3\276\205\030w\f\004\231\207!\032\f\361\307"
+	.ascii	",\206\210#\362\272\225\204Ei|\362\266\346\265\311\305\263x\256"
+	.ascii	"\251\302\247\007\036\331\244\251\003\225\236\203q\307\244\034"
+	.ascii	"\217\352\275PJ\2465rE\t\024\325?\360:\246b\336 \255\200\t{\372"
+	.ascii	"({[\317\200\341K\337z"
+	.string	"\376\305-;1x\227\210\325\306{k\306w\021\025~L\265\226\276\033\031\363\250oH8a\3308}TH\267y\027\253\"\272\274>\262\300\210\247\306&\357\360\331$\002\351?\204=\251[\342\016\301zx.\017\177|\032.a\n\322 \336\323\240\370\026\253V\013\210?\301\344\216\247Z\255V\273\007\213\364I\2174t\202\005Q\231\223\023\201\364\236&\207\364\re\254[\373\022\372[\343\266\224$\345\351\n\203\b\224\302\233\224\020J\314\217{\303\2555F\317\374g|6Vq\313\3327\031o\364\255\306H\027\202'\250\002\351\034\317\342\254b\206fDd$I2\214\001\002\n\020\210cy\234\250=\037\022\300\204AHRD#$I\322\032Q\340\320hY\005\3525\332\325}g\244\037\002\"%LL\034\264\222\251(\204\253\351g\213\352\b\222\225pDV\022\347\374\242\363l\227M\007\321\361\272\333Xs\304\337?\237\303\\"
+	.string	"\323V;\241Ae\343\335\r\2778\200?,\335\233\350 \214\020X\021=W\013n\227\236\034\244pd\217\272=\250p\367\221\r\207e\006\246\036\210\177\375E\002Af\261\t\254G]\315\3613k\355\206P\024k@\312\271\243\370\214\035\233\370\bT/I\271?^\234\2170\004%\226E\271\363\366\255\300\034\255\352\026s\312m\231\363\345\031r-\277\241P\314i}z\017\022\003Ox\343M&\235y\207\016jNs\206\354\375\311\220z\240\271\311\260NQW\276nx\261\245\366\312\"aGp\263\245\bQ\301R\322a\335\324b\036i\3200K\fi\362\342\f\255\271\347\314\022\\\335:`\233\204\340\261\260\262Z\320\367\013\r\013\257\\P\232\313\346\233\331b\030eP7\307B\237\361G\027\303*\305\343\342\202\375\024p\310\013\366dC\002\352\346FL\370Wj\255\001\325\235F~\357P\333"
+	.string	"\244.Y (L\332s\233\356S\264\350\350\361\304rC\266\236S/~\327\267\306\017c\246N\304\322a\352\207\214b\276nV\205|\302Y\036\240v\304c_\025|\343\242\222\264\354\2018\211%\374\036\277\240y\f\021:\214\236.\330\302y\312.p!\251q\252o\3033\367\233n\201\301`\337"
+	.string	"\022?\016\355\310\254\212\316\023\221\207\226a\246\362\220\220<O?\363Rl\221\246-_\305`]\fL2\250\306\263e\210\375p\210\b/\306\033\303\316\255T\005\233\247\020\0178k\236\221;\3737\004\207&_P\2405W\356\235q\354\316\006\246\321^\250\t\234\343\024\212\334\305J\274(O\325pw/\240\2247AO\034\372w\312\321\210o\211\301\361\\8\2015\020_\242\201\035\326\255\333\033\312r><k\027\003\270\307\261\247\222)"
+	.ascii	"\346\311\177\334J\034\006\367\bn\306\221Q\341\022\362c\247>k"
+	.ascii	"\243\237\233Z\227\254<\2165\351\262\355Uk\026U\225\016\253}\221"
+	.ascii	"\361\314\321\373\3448\240\354\206B\f!\317\310\3568\361\356\302"
+	.ascii	"\222Q\245\234\003\364\020 \371\227\034X\352\326\273\214\304\377"
+	.ascii	"\233\340\257\341v\\\0365\306h\324\037\205L'9\303X\200\030n,\213"
+	.ascii	"\342lXw8U\227\024\324(\3442F\240'\232`:\273SiK\365\350\306\270"
+	.ascii	"\226\"\377>\234\204\352\374\026\016N\240\200"
+	.string	"P)\200\025y`\026\00516\001\322~3,#\3349_\235\245\207\224\013a^.NWX|\2459\026\326\245Fs`\344R\252%\314\273\306L)<\304\025\334k\366\311\341\375\235P\215\366e\370rv\303~#[\3565\305\217\314DU)\354dv\371\366\022L\036mf\370\nu'}\034\365\231\0052\305\034Xx\353\325\241\263-\005\035\033\352\035\362\217w\270t\026Zh\017\312m\224\017\336\2145c\314\265\001\013I\007\223\005\321\371\331\214\343\200u\020e\023G\326\247d$Q\"\002\310\036_\252\315\233\246\032\313p\240\006P\374x\305\205\213\247T\210\364_\211=\331\265+\271\207\250\036P\200\223\034\036F\276\301\352e\2205\001\354\321\r5H\370st|&\220\016\312?\331\361\214\270\nJ\251 D\213\202\3562\210\241\022t\242\2027\312\3060\330\370;)\377\fT\3075;t\031AC\302\356\016\244rf"
+	.ascii	"\f\320\007r\222\335HU\233h\262\377\265\325\006d\362\252\212B"
+	.ascii	"\364\275~{Y\341\263\016\200\333\256\255\025@\262W\205<\313 \347"
+	.ascii	"\022\202\332\005\034\273!\272\200m\242\020q\324OB\337\005\251"
+	.ascii	"\244s\325\235\2316s\267\237\365\334\3540\002:\036\303X<\237c"
+	.ascii	"\301\024[\213I\324\224\376-ti0I\247\361\362j\372J\016\255:B2"
+	.ascii	"\257\225G\2504z\345r\367\350\361+\212\307\364\330\250\340\375"
+	.ascii	"\303\262\177\231\344\231\263\300\241\202\374c\220\323\215\241"
+	.ascii	"n\2763\312\344XIp\332Q\262-\264\246\305Q2\243\247\r"
+	.text
+	.section	.gnu.lto_cliEnter.266.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\341\001e\022"
+	.string	"v#~I\320\362&\035\0275\017BK\036\br0\201\244\331\260\363Lr\021\242E\220\306\307\016\241\252\242O\273\036\334\255\275\274\325$\221\032\270T\210\2449yln\230\225\025`}\201Y,\nW\n\035\n\0350K\306\230,\"M\356\224\002b"
+	.string	"h"
+	.string	"j"
+	.ascii	"V\251\246w\247\347\234\276\310\326\226tD\2208\017\244Zu\246~"
+	.ascii	"T\332\246\024\024b\373\323\376\320\211\350\213n.Rk\017QR\255"
+	.ascii	"\245\211I\272o.?\302}\353N\200\373fj\367x\371S\017D\205\220\035"
+	.ascii	"A\325Z\277\3659\375"
+	.string	"\244\376\215\036`\266\363\372\004\300\240\326\3529\333\031q\357m\223\330\216\261'\204H\025|\240o\266\360\362r\001\303N\033\265\0234\331\276<`vk\263\300\371\231\027\324J\320p\366\345n}\032\257q#\023\206+x\210L\3706\234\177\364\0316\033hh\270o\023\244\216\240~\221\363c\\\206\350\003\231\203k~\366\315wq\337\266\351\351\207g\350\t6\247\35426\027\205}U\255\265z{\354\027\375\3356\003\373r\202\371\362;h\213\221\237Zs>\243/\272\234\223\3257\233\nQ\030[sAC0UkS\243\006\336\256j/\223R\341\346\356\232\310\226bNy\016\225\256V\034\024\277\351N\016VXX\270os\257C\352\206P\321\372Kg\002\341\003\271\305\305\205\373\366\250\231\017\003\263\333\227\022(8\335L\334\313'\275t\265\302>\363q<^\325\314\200\032V\336(z%\255\261\003\t\216\236Hz+2\364"
+	.ascii	"\256<\260\346\003\351\225\2001b\213\267\362 \305\223i\205#H\266"
+	.ascii	"T@\004\240\220\243\030a\006&\034A\027\210Y'\341\f\353ce\370Z"
+	.ascii	"!\f\315\307\032]\337I\001\2135\340\370\221\2428~!%\354\252\272"
+	.ascii	"=\016\2511\321`\033\263\311\364\352\251\017g\323\024T\205\222"
+	.ascii	"\202i\323 \312\302\210\026\013! p\202\221\252\273\rbBK\311\300"
+	.ascii	")\264s\001\277|\007\233\207\rR\215K\022\227\351`\312\fbMX\350"
+	.ascii	"\006Ff\242\254\375\301\316SX\\\3329\352\356BL\260\373\343- \231"
+	.ascii	"5Lf\240\006|\224<\311V\322\341\032v5\347h\320\345E\373\310"
+	.text
+	.section	.gnu.lto_cliInit.267.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375 \362\235\006"
+	.string	"\242\214.3Po\322\001 jy$]\013\262Un8\r\307\f\254\324\224\316\034\345\321\222j#\"\260\314\005n\33333\245\254\t\246\312\331b\037\243\302[D\273\355\235R\r\360\023\242\030@\035XyD\002}\034\bz\371>\031\202\035\207|\225(9\005\245\036<UBPT\225\232x\267\253\b\022m\242\215#\3262Zc\376\277\355j\231\002G\n\206QV\376\212\227\226\2378\023\017M[\263\326\037\006\261\034\022\341\201\377\")\371cB7\031\273F\033Lv\031\023Lv\265Z\025\307\215\037\270tP\214\260\374\317\246a\313\314\252-\342"
+	.string	"Rid\006\260\360\277\214T\262p\233\333n\332f\333\213\b"
+	.string	"2\003&j\006.\034\201y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_cliPrintVarRange.part.0.400.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`0\004\375\034"
+	.string	"6\364\267J\220\232Q:"
+	.string	"8\223\334-\327S\232)\331X\230~\035\031\rS,\237\370\336<\213\"\270\024\2772 I\372\263\033v\026\366i\324\035\233\300\366\337\255\205$z\326\215\r\022\020\t\027\272\360\364\020\340\232 gZK\b\331D\356$\003\237"
+	.string	"\233"
+	.string	"\247"
+	.string	"RA\n\322\233\204\304\2652\277\311\243\320K\005\235\300\275L^R\356M'\3342\003\363\226\323\333\220\267\346\r\220\267\314\207bf!$F\231\307<\375\335\222\310\031\236U\361\336;\273\355 LV\364fI\332\261+\f\345\327\257-=_\356\346\324\255S\0172@\222t\274\034\313\242\243\"\001|\2741\347\213\310\365\255W#\037Q%cF\224nk\317\227\343\343\b\2018\245L"
+	.ascii	"_\321hsT\244w\372t\265\277\365\361Hq\330\363)\275\0268\254\314"
+	.ascii	"p\357\345\017\3558\307\316\314=\230\031\004\363\210!C\202\310"
+	.ascii	"\333\332\317\372\370\304\2632\0235T\327H1\227\356\315m\r\346"
+	.ascii	"\020\346j\232\332M\334\260\347\374\276\210\334L\314\261\312'"
+	.ascii	"\254r\ffV6\311\312eY\231,+[\262\362x\255s\333\312\365\351\177"
+	.ascii	"\003\t \240\271\367h\r\232\273d\271\234\216\365k\235ou'\374-"
+	.ascii	">\265\204\016\374a\231.\275\276'\207\202\036\370c\346\220L(\303"
+	.ascii	"\033\024\314[\331\370\252S\361\263\370<\326\025P\215p\005\364"
+	.ascii	"\273C\202%\r\215\210\367\246\021n\371\201Y\305|N\235?%\304|\236"
+	.ascii	"\\\353S\241\007h\023T\252\276\307\262\242w\211\241\201?\204\257"
+	.ascii	"\323\027c\304\203\354\261\313\376.\211y\316B\332&\373\273#Du"
+	.ascii	"\rw\333&\255xj6\234\213\316\311\003*a\032\027r\020\320\245\313"
+	.ascii	"\t~\213\207\361C\b\362=\240>y\300%6\312\265\210X0\302\334\351"
+	.ascii	"\034\b\376\350_\311\251\f\216\361\207\354\376\326\353\217\t\024"
+	.ascii	"\325\027]\375\342~cu\025\371\272\233\230\031A\275\223_!a\363"
+	.ascii	"\273w\367^\tsW\341\201\211\023\365=\006\020\334!\324u\216\231"
+	.ascii	"Q\334\212\212W\3711\323^\245v \333N\305\305\253\274\356\325Y"
+	.ascii	"\340\252\261\303\017\334\343@6\262\204\312\027zl2n\264\0312\026"
+	.ascii	"\266\037\236\333M\303\200\235\003\341|`\350\330n+h>1\034mFs\r"
+	.ascii	"g\347V\233\325Z\314`\354\320^\314j\270\236\031\316\001\346\211"
+	.ascii	"a\303\315|x"
+	.string	"xp\263\363\315\304)\272\204CM4L\357\315\227rD\322\020o\372\251g0o*3\352\204\032y\326o#\370$$\352\\\331M,\340\211\205\265\375\252\307\362n#f\346\263\273+\020*-\261>\373(\222\207A\237N\254\253\"\230/\261\306\021\0225\364\361\336{\311n\202\365\213\305\341\316G\203j\366\243\334\013\272$\201\027\ne\356:\004U\250q(c\2204\304\241\022\n$\220\3216c`\002\0313g\035\020`i\206\222B\007\313\003\224\340<\027@d\222\205\340\374\021`\036&=f\226\240\206\266\207F\315\027$~\260}\312F\324?g`B`\004\210\241\2416C}C\357k\3117\016\206\340\026ff\211\200\\\001\323]\317\212)_\353)@\"G\217E\262\213\277\342\020\023\275~\213\357\254\264RQ\371\307\221\356\313\025\024\2111\335\030\032\332gD\3659\226r_\202\201\255x\252\256\2559\227ba\364"
+	.ascii	"E\353B\240\341Y>^\230\t\241f\217Z!\324\323\230\266,\243\331\313"
+	.ascii	"\202\323c\312\035\354H\331\327&E\233'\f\262\256\250"
+	.text
+	.section	.gnu.lto_cliAdjustmentRange.part.0.423.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\365\t=2"
+	.ascii	"\nW\b\023Hp\032R:m\267\310EQ\2710\200}\004\203\272\230L\227&"
+	.ascii	"\024\255\021\250`f\220B(\272\376\363\213ct\357\202\3407\270\005"
+	.ascii	"\232)\206B{!\024O\247\007k\223(|\f;\274\225\360\240\361\265\276"
+	.ascii	"\326g\355'\204\354\235d\024\001\020\001\035\0019\312\245$?\245"
+	.ascii	"\321\236\253\362eD\303\274\2429\347#\357\253Q=\221\275\030\024"
+	.ascii	"\306\375\201\302\310\311o\371T\\a>\2429?\177\276\366\017\357"
+	.ascii	"\253\257\357\375\263\351a1z\236\271\252\331\367v\237\311\233"
+	.ascii	"$\037\026\343\302\234\271\314\316r~6\370\332\007x_\373\371\""
+	.ascii	"\373\225w\"\373\265\373K\272\273\251\373\314\237^\271\331\311"
+	.ascii	"\3563=QY)!,K\nJ\\\316\371\370\025\367x\362\304\2410'\b\374\341"
+	.ascii	"\370\332\036o\307\256*\276:\311~\217I\245<q\270\273P\366\002"
+	.ascii	"\316* \027\372x\216jds\223\372[\323\207J\200KK\316\353\006\265"
+	.ascii	"\016\324\312\272?\255\035\027\007\353>,\035\267\305*P\244\231"
+	.ascii	"\343\366\n8\253\256\316{\221\246\325\335\375\255y%u\331\313\244"
+	.ascii	"\272\361\325\230s\366QE]U%^\221\205\001R-U\006a\214\344\370\026"
+	.ascii	"\250\213\325\342\324\020\346\337\232?\324\005\321+m^\366;\203"
+	.ascii	"\352\351\336\341uv\027r\316}\247 \357\342\273O\324\335I\335\275"
+	.ascii	"`=\204\342\236\211\261\021\n+\373\301\217/\336m\315M\227G\236"
+	.ascii	"\356\364\342\256\306:W3\346\352no\373\264\267\007\264\267\005"
+	.ascii	"\264\267\003\364n\003\350\341io\357\264\267\213\355m\235\336"
+	.ascii	"m\342P\230\343\273\035lo\003\333\333\277\3666N\357\266\257\355"
+	.ascii	"\265\267y\275\333\273\217\275\331uw[=\331\033_\354}\377\374\037"
+	.ascii	"A\275b\025\314\312yjJ\227y\254X\210\234\354\037\373\305\376\265"
+	.ascii	"\037\355mH.\032\311y\354\322Ij\266zzU\355\266\344\242"
+	.string	"`q\031\352\371\303\324IXF\224\023\227\202'*K$q9?\217_w\335\357c9\033\323\271t\00219\347,7\353\247}K\373\326\324\222\324\222\252x\204)\331\200\326\020&4]\013\262\233\020&$\257\005iT>\363\224o\353\315\031X\\\316g\023xO\272}L\335\267\362\263n_\273\270Y\023H\263rq\373O\232\372PN\345e\355#\253R\245\321\214\275\234\235Wg\021x_\307\232\332\b\365\314T\315\234\003\314\034l\\\326\021\025\273=\234\356\303\357K\312f}3\027\304-\\\035\032f\017w\341\243=\315\177\030\210\277\314:\332\177\370YZe\344\254pp7\210\307\271\271i\323b\034\274\263U\307\373\335\210\365\265\330\207\203P\272^\213o\334t\307\016w\215y\017\257Ji\222\265\207\357\332\364\312\r\n+Y\334E\204\243\263\302\303\335!\036E\256i\244<\262\300r\316\024\320\220X\213^\300<\351"
+	.ascii	"3\3633I\354\3273\325\260\230\207w\266\350\244HI;N\206\025\331"
+	.ascii	"\212\273\032\337\210\335\341\027\201va\361\016\007\241o\246R"
+	.ascii	"R\340]Y|\343\244u\370\2176\277p\2500\330\025\257\312:7P2\305"
+	.ascii	"{q\267\210\021\367\314\025\3375\251\234[\037\311\036\355\337"
+	.ascii	"r\004W\352\304d\201\2619\333\303$\251tg\2768\030\022\253\232"
+	.ascii	"W\316\271\002\334\277\224\350\007\371\332&\200\356\231_\373"
+	.string	"@\370l\017\241\006\353\314H\022*7\234\356\264\361\257Z\324\324\027\306]\r|\243\261\030c'up\320.Pw\256\201\367\270\003\375bH\350\210\210\355\024\016\220KH&\025B@&\202\224\b(\001\335\245#&\244\fKGCFL(\2240\b\021\025\001\265\030\022\275\b\250\005VZb\201\207\216\210\212\204\214\202v\035\344\200\250(\350\030t\342xD\004dt\fRB\036\035\3504\022\213!\245\343\022\022\222\322\321w5c\256\236\363\313\315\t?\021\027\334{\371\317ovm$\205(\020\223\363\362\314$\021\336r\205\202\344W\322H\331\205c\234:\274\346\242gC\244\232\263\323B\364\211\020\301\355N&I*\271\323\206\333\023V\266\201\313\276\331\330\237\253\270;\311$\031v\317\354;\346\254\341\266\354\221\006'%\007w5{$\353\203\357\364\301\267\362\022\013\016\020\200\007\b\220\006\300\335\030.\2152w\306e\366\340"
+	.string	"\230\007n\332\006ds"
+	.string	"=\030"
+	.string	"\016B\247<=k~<pB\2366\234\235\"\336)\266Q\242\203\2733\334%rM3\rr\243.\324\020\353`\236'i\233\257\347F,q\210\2118\b\225\252\t\207YZ!^\225\323\255\034!N6\361\271\347\3624\r\274 \356\341n\016\035\356\003\200\315\250q<\005\221A\210\206D\202H\222&\303\001\320\002\021\032\252\315\001\0210-CT\311\214\026$\225Bc\347\340Q"
+	.ascii	"F=\221\360\236\004\323t\300\232p(\fR\306\302\022\263\360\250"
+	.ascii	"\375\234\317\255\366\263]\t\0239p\372}\220\006v |\200\313\331"
+	.ascii	"bV"
+	.string	"\017}u\347\007\334\350\204\334\275?z6\326\303t\335=|\215\373B\235ls\246\353\267,\206\266\314\033\356\013\315\376\035\023\"\306\347T\312\310\002\371\301\356\234{\377\313Z\023\2645\0168\375\006\361tB\312\330\210o\247\3759\034B\246\217g\021\022\222\032D\372x9S\037\345/\177\032\257\314\352t\314\206\337c\331\255?t\346\307V\"\311X\247\260\357\323B\031t\257\353\035\324\352#$\260\"\277\2151\030y_\306.6\256\274\007f\356,\327\227\374\262L\270\334d\335n\262\fMn\371\222\356\325\261Z\336\211\257\356\301;\211\375a\333\206\230\341R\374\004\364`\021f\341yp\244\031\247}\233\205\266\362\307\350\322\277tg\253z\216\217\330\376U\022\317,@\236\333P\255\346\202\244t~\304!\270E\272\332\364_E`\017\347,\027\224\031\026\271\3172\320v\312'[\b\343\366Y\rr\264\310\310\b\211:\243.<"
+	.ascii	"PT#\335Gp\327+O\371R^{\221\b\265\254\311\3242\020\241\317\311"
+	.ascii	"\375%Vt2\366\203\3531\255!7/\225&U\340\263xQ\001"
+	.text
+	.section	.gnu.lto_cliBatch.part.0.424.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"\235\f"
+	.string	"\346\027VC\020o\234\016\303k\244\002Q\204\200\252\n~03\221\306\203\026\001L\322\223\206kip\363\002H\324_$l\265c\b\036\212\2772@g\252\252\252\252\377\356@\001C\005\003i\320S\177\016h\321\2106\221;\245?"
+	.string	"A"
+	.string	"D"
+	.string	"\327\005X\237\227\317\207\3306\331(\037?\266\202A\033\305\200\306\206\233\016-8LX\354n\366\251\032\016^e\005\372/9\206\330\021^-\035\026.\003\274\2524\330]_\027\356y\333\033\333\034\373\236\325*\312\256\244\245J\337\232!\036\230\323.\205\024\027\233a\232\330p\222\333\0371\371%\276\330>\211\351c\t\0131d>-\245}\017\377"
+	.string	"~,\035\300.J\244\304\356\310\340\323\b\256O\217'`}\006)v7.r\327FF\301\247\375\240\223\027\215ih\350\253\324s\274\020\361\021\021>\236g}^\365\304\t\310i\304\303\017Y~\210\233\204|\020\213H\362\342\247O\262>+\251\223\217\223\210\212\f\231\"5e\255\036\026}\336\367q\330\226"
+	.string	"[\260q\033\210\303 h\243\016\247"
+	.string	"\007\352<\333G\253X\323t\036-\323\034d\240\256\363\311\264O\224i\006\330\223\300}\331\310\363\276L\276ZE\331\262\202\003\212\f\235\240\232\262\215\221R\017\342$\264\003\001\027"
+	.string	"n\013B\267\002\343\201G\302\020x\324\020\020\260\245\3627)\373"
+	.string	"Q0\314\025\356\260\211\\\027\325\347A`\342=\255\024\325.X\335\271"
+	.ascii	"p\362b\336ii\372\te\f"
+	.text
+	.section	.gnu.lto_cliRxRange.part.0.428.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`&\007\205)"
+	.string	"\272Jh\020Gp\236Q:KAE\341y\250\276\301#\001\360\357\214\003\013\241\033\214\357\201\264\004\033\374H\325\270\374h_r*\211_,J\327?0\232S~\b\347\272\357`\n\013\305EP\\\232B\321\342wc\3457\322\b!{'\031\357"
+	.string	"\353"
+	.string	"\357"
+	.string	"\277\302|qu\314\027A\231,\377X\325Z9s^\352\236\266n}\312\366\275_:\275J\f\242eF\032\373\336\356O9\225\247W\211q"
+	.string	"9WQ\351\312y\271\340i#X\237\366\362\002\324\247\353\207\324\247\335\217\322\335N\335r\276\264\312\306~\352\226C4\314P\rZ\037D,f9\347\335S\\\344O\007\272\261\266\332JSS\024_\334S\177\353h\022\311\234\342\021\352@\267\003,MBU\013F\307Ff\344\201\026\345\234kdF\035L\214;\356z!H\037\247\241\002\306\206\3009\2311\007\252\200*\314\006{$^\025ek\310)\303\035\211h\0038\307\251\233\336\342\361\306QtH\207V\031\3568D\215\312\232\354x\230\324\305\250"
+	.ascii	"\032H\212'3\366@\0258\277\344\371\326\357\214c\324\275B\307\321"
+	.ascii	"$\344\234\373B\252w\356\335}\247\273\207\335j\220\267\201\326"
+	.ascii	"\333\267\3656k\253=\353\275\236\314\233\246\036\354\235\376\312"
+	.ascii	"\033]o\343k\275\357\227\377\211\3206N\216*g\032\317>\031H\n&"
+	.ascii	"\311\265\376\254\377\312\017\366\223\371\317|\r\013\246f!\004"
+	.ascii	"\002\232K\264\264B\032\323\264\022\232s,\255\220\264\244\021"
+	.ascii	"6R\314\262\324R\347\242\225\260\214\241\260\n\002\363\r\221\211"
+	.ascii	"Y\316\313\335\323Z\367\311\306:\202\325\230\233\3517\233=#\246"
+	.ascii	"$\246\204L\323\232\001\261\266\367\322\377z\030X\2312F4\254O"
+	.ascii	"\311xyu\233S\243\354\222bVam\273Y+`\036\206\t\213\251\373\\\357"
+	.ascii	"\352f\333\305\275\364m\235P\365\3109\263.p\337\212S\037\313\271"
+	.ascii	"|\253Y\255.]\272-\252\345,DG\027\205\365i\226S\027I-\363\321"
+	.ascii	"\230s\316r-O\337\322\35532_\206\263\375\341\3149\357\326\247"
+	.ascii	"E\350\207\324\311f\303\016To\370T\230b\317\347\031\362@\225\305"
+	.ascii	"7\374)\252\250\373l\033f\361\220\232#^\370\335$r\006\266\016"
+	.ascii	"\335n\021#\356\213}\263\224M\232Qy\304l\210\241\341d;_C\303t"
+	.ascii	"\363nU\243\267\321\217D7\325\360q\\\225\3559\223Ri\370\312\034"
+	.ascii	"<~\214a\2518\331\005\212^r\320\024\007\340\342\205\004\353n\303"
+	.ascii	"3\036v\033V[\205\310\205\032\375[_\235\355\017\"\027\326}\305"
+	.ascii	"3\336\\\305\251pL\022T\305\367Ky#\275]4\305x\354\312\317\235"
+	.ascii	"\306%8\320\027*\212Sa\253\207\351&\307\353\335\027Q\374\260\013"
+	.ascii	"}]\355\271^C\032J0N6>P\3058\3104#u\317\372b\214\331\241\222\213"
+	.ascii	"\370Gx\237}\273\307\335\276\024\367\305\213\337\346\212NS\nC"
+	.ascii	"]\234l\214;~>\237\317\306U\335\265\333A\265\333\271\3656n\r\235"
+	.ascii	"\324\373\375\220P\360\326F\301\240)\270k\n\016\235\360\231\370"
+	.ascii	"\001\217:$\365~?$\024<\241\237\257\tIC\357\304\017)\270\372\276"
+	.ascii	"\364c\002\036-\375z*\230N\004'\224\360%!\265\020\n.\255\300\275"
+	.string	"\237/\251\204\n\036\255y\f|I\274\035\317\304\356\347CR\261\343\005\225v\f\0024pE/\270[\002\002\203;\366h\306U]S\2025\2058\252\361\321\234s\0062p\027\\\367{\271\371(\001\233\234\247^\264\260N9%x\332}\001\303\267\016\240\215\262mNY\2359\273nA\270;\303\375\364\351\303'\b\017H\036y\022\377\344p\267\206\357\331Pc2\306\214\312\301\311\272a\334\214\203\n`\f\017\363KJ\316\371A\236\353\361\320\307z\332\037B\334\027\225\324\247/\326\021\346\360\233\007\221<\242\247(\b\363\311BiFa\250\341\2230\033N\3329\016\037\211\275\316\2010\216\206\2010\0015K&\321O\r\007\200\206\250Q@\003\221R\304\210L \"\242I\2226\200\002\031\"\254:\021p=t'Ij\324h\f\336\266\241\207\026\342\2051\325Y\323c\262\362u\345\263U\237\266-I\230\201\372L\221$\007l"
+	.string	"\206\270\302\355\350\315\210\244\302\301\030o9Z\313\263W`\263\316j;\003\233\024.\353Rm`\250x\307\023`ire\367N\004j\037\275B\030\220O\237\007\346mI\217\236I|\377\242\313^Z\013\245\260\b\306a\003;\202\372\213*<_\3345\240\262\005\007FN!\221S\241\240\216\301P\203\260\316\t\003\177>\016B\037\331\245\230\334\224\274\263Baw\374\236\242O@d6g~\303\017\237\217\336\024\017\367\363G\242\252!\025\332\330\034\002]H/\356\023Q\322\375W\013\220A+\204#\350\214\327N[\006P\335a2D>m'h0\250hd\327\311\307\274\256\301\022\031];D`]"
+	.ascii	"\\(\254\030\370\270\232\366\033\362\333\205\211\224t&v\257\322"
+	.ascii	"\023[\260\037"
+	.text
+	.section	.gnu.lto_cliRateProfile.part.0.430.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`#\001\245\r"
+	.string	"\006\032\\D"
+	.string	"\2614\035\203\270\372\365\316\025O0}\360\303\322\307\355-I\n\200Y\335Q\273@\373\320\236|\243D\177#\\\006\202\020\320\242\\\254\367\244\377\377\277\353\032mN\251\260\177\313_\354\333\261\016G\254\355&eJ\001F"
+	.string	"I"
+	.string	"F"
+	.string	"\033\236\307\352\004<\217\326\343K\330\026\331:\017=\354\213=[\347"
+	.ascii	"\313~\fbT\270\324\320\330]\354Q;\334\273&"
+	.string	"\345\371\t\216\276\353Kw\360\201\302\013pt\3419\340\324\007dw]a\270\343m\177\330n`\177C4~\n[7\242\333\240\370\222\020\356\350\3452\376\r\212\327x\267A\371Z\330O\b\021\343b\306\356rT\217\027u_F\344\227l\315\210\036\246\\_\006\216Gg\3327\361\023\336\303\224\013\330%\341\254\330\r;\036\235\240zt\370[\325\322\261\340\321\206\020\312\203\276X\364\3635\3659.5Tr\307U\332\021L\362\340\365\245o\340\304\030\001cE\277T\030+uj\225d\307tR\351{\262\305\307i\267\302\316i5D\026\"n\372g\236\366}\323\003\026Qpi\240m\204\353J\264\223\220.\300v\215d\003\211\204\262\2173\217\r\224a\331\bF\262\205\204\260\2543\301<\n\230+\321:\354\204\343:\314\262\235\247VI\006Q\321\025U\030\333\b@\2208\231V9\030@\246\236\3469\017\f\310\330m9\030\033"
+	.string	"\265+0~\265\002\0039\200<0\302\025\343!+\312R!\220:_\312\202\313\352\302L\220U0\255B\341X\025\335TX\314\247@\020\342=\243\024u.0\335i"
+	.ascii	"\270\366\220\302B\263\245'\2241"
+	.text
+	.section	.gnu.lto_cliProfile.part.0.431.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`~\001\215\017"
+	.string	"V]hG\360\316(\035\322\315D\204\315\021\224/><\rR<\244a3\267\227\006G\031{\335\"\322\313[\265l\t0\006A\f\227\361\nF\263\017\251\033\004\317\3007\344\177\3309[\314\2321x4\251\330\301s\245\305o7\331;\245O"
+	.string	"S"
+	.string	"W"
+	.string	"\273U\301\251\017l\247\256/"
+	.string	":\335N"
+	.string	"t\312\235~\204m\225\355\363\372\332\026\213\266\017G\312\216\fbB\254\334\314v\327;\235\035.~JM\364\345\2125~>v\007/,-V,\013\227\003\256\205<v\327\333\205\233\336v\207\355\007\366{\002\031tD\314v\253w\372\232O\373\036y\tw\360\254\340|\331m|\235\034\325qH\334\241\324e\265\\\306\317!\361\033\3618$\337\326\236\302\207\030\032\027\273+\332N;\355\276\214\312\217\231\253Q\275\226t\243\006\321\251\245\264?s\032\361\265\344\002v]3;\001\324\006\001\345W\356R\346\350O9\177b%\206\211\374q\206\264O\241\374\352\363\261k\260P\361\"\305\311\034\345t\361\324\256\355t\331!i\t\222>H\362,\200\355V\370\201\261\033(\n\230\313n\302\"\332b\250\257V\350\205E\006\233-J\025\331\036\261\bG}\265"
+	.string	"\200\b\376@\320\221L`)L\205p\2160\002\001K\250p\003<\t\005\232>N_\310\337\b4}\336W\362P \204\223\367\245$x#\r\207!\244\2247!\fS\036g[^\333\351\262\207\311<\231\323\305\266\001\01700\331N\016\016 \345\274\315w\276\215\236]\225\257H\233J\203\004\017! p\202\241Jv#\246!\177\032&M+0\357\360\236Q\030m\210&s\330;\307a\362\360\336\032\273\264\301\332.\272}}\203\277t\021\006\031c\272\246h\254\ni\n\301\374\2037\361\306JI\273]]Y"
+	.ascii	"$\036\332\024\322\245\327\2761"
+	.text
+	.section	.gnu.lto_cliMspStats.part.0.434.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`Y\003%\031"
+	.string	"\306\356\242H\300XM:\220\3550\037\201!"
+	.string	"r\237.\343\262:\020\264\251\024\353\222\013\301\261\t%\202\241\265S\241W\214}\365\212\333\226\254\261"
+	.string	"\r\213`\232\2124\354\272\n\254\300t\235\255\204\301q\227?\340j\241O\b\331D\356\224\002\214"
+	.string	"\207"
+	.string	"\220"
+	.string	"I\277\305^\272\370\200Z{\334\246\324Z:8\265\002\360\324\345U\336)\370\002\336\351\315\351\217\204y\t\244\0229f\2079\360\242\312&\334n\300`b\246\326*\236\356\017\317\372\256\274\275\031\373\347\321n'\030\363e\377\272\016c\274\004\260\301\3500 \325t\234Ihz6Dh\234\316\232m\306\273\216\201\324\023\231"
+	.ascii	"\266\027\235j\b\251v\247O\031\266\331\3343\235\036\345p5\033"
+	.ascii	"\215O\002\007\277\f\265V?\250\306]s\3337l\003\331;!^\220\016"
+	.ascii	"!\305\360\366\260k\272i\220N\177t\332\243\323\224Nwo\272\267"
+	.ascii	"\233\236_\272/`\342t\266\324:\224\346L\335A\251\f\371\322\337"
+	.ascii	"\364'\371\332\367\231\034\212\357\324\024\345g\036(k\021Q\255"
+	.ascii	"e\224\037\001\365K}Q\220\233\020\251ZK\b_r%\237i\t\310\341\254"
+	.ascii	"\2546\242&w\022\373\023C\275\026\325\307\230\272\035I\325Zs\300"
+	.ascii	"\323\260{\001o\311\221\334G\002\344+\361M\022\240\227.B\031\216"
+	.ascii	"\234S\317i?4\024;\037\276\"\325\306\312l\203\270\226\020\340"
+	.ascii	"\036*H\267t\277\375\007\346\"<\272\336~G\27124#B3\215\355\021"
+	.ascii	"\307B\327\253\201\2732\225\364\037<\234pt\243\327\255\217R\324"
+	.ascii	"l\346l\2238\324\b\326:\243\340WiA\372B~\326\003\316\312T\022"
+	.ascii	"\2009\327>\3013_\333\275\323UT\320d\371\316\365\254\211\t\232"
+	.ascii	"i\274\337\234\324\323\324\256\221m\233y\245?\265T@j\245\275\346"
+	.ascii	"\002i\026\026\250x\315\327|%\267AS\245\313les\215\002^]\250\200"
+	.ascii	"\023\256$<\300\tW\021pT~\265D\326\bs\301N\260\030\303\360\265"
+	.ascii	"Bl1\266\302\360\305b\215d\030\206\341\252gl\265\\d\310aG\203"
+	.ascii	"\370\202\215\260\027\345\260\243a\325\"\275\022=<\254U\213\374"
+	.ascii	"L\352\360\260H\2214!\366\360\214-\221\364y\211:\006\354JQ\302"
+	.ascii	"G\204\271\\>\342\3153\004\255\320\267F\276\211\2425\273Q3\347"
+	.ascii	"_\031\206\362\276\323\307\276\253\265V\257\301\2775{\246\203"
+	.ascii	"\200\222\303\321r\bQ\004\323\333o\301\355\366{)\347\262!\001"
+	.ascii	"\230\016`B\250\2210d\220R\312\210\210H %$1\026\003p\002\031\262"
+	.ascii	"3\017\020X\253&),\007W$\266TrqZ\305\370\235Y\270\177\035\346"
+	.ascii	"W\013\321\020\\\201`=\025d\366\261?xa\323\360g0\007\002\032\004"
+	.ascii	"\253\3044Z\266\340\037\246\025zIB\2112\\|gh\217\243\020b\n\231"
+	.ascii	"\221f\326\322\254\234\305\230\345\372U\2023w\206\314\306\220"
+	.ascii	"\307\300\237\316\2103s\270\256\244\266\373\227\231\267\323\222"
+	.ascii	";e8_\257\262\247\213\016\2346wlS\036K\361k\242N\230\307S"
+	.text
+	.section	.gnu.lto_cliAux.part.0.444.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\353\007%."
+	.string	"\252Q\354\021Ip\032R:!\326(\211\fV4\305\212E\f\320A\220$eP\020W\002\260\203\306\027\251\353\217\363\322\334\252\255\032\001[Nn\002])G>\024\321W\273\026v\241z\204\226C\022\217\201\361\030\024\332\366lF\032!d\357$\003\002\001\376"
+	.string	"\020\001\247\021\347\264\021\227s\016\262W\201\351}\326\203}\311\270@_2v2[>3\313y#.\347'\320\325\006b\257\266}\357\237L\2172c\3003G-\373\336\356?9\224\342\243\3148O\316YN\306r~:\270\332\n\330\253\375|\200\365*{\237\365j\367\273\272\233\251\373\355O\255\274\354b\367\333\200\247l\234\340\254\221\244\022\3159\007\257\342 /\336\327ky;V\267\252)\276\277b\177\247d\032\357\353\3510\210\035\301UT\217\267T\347\245@4h\362lK\252\364@\226\017\271\237\035\301\326\222\307\335!\270\212\232:\013\3149\177k)uug[N%\357z\225L\035WS\237\25103?&2m`&\t\217\226\371t\323\324@\233\332\222C\177q0\221i\202* Z~v\2748\r"
+	.ascii	"eDy\266eU\312 \256\313\233\213\375\332`:\335\333\363\237\016"
+	.ascii	"C\316\271\337d\365\326yw\313u\267\213n\335\213\0277\033\377\236"
+	.ascii	"f\234\325\335\336\356\371\335\346io\357\264\267u\332\333?\337"
+	.ascii	"m_\257\355\335\346\265\267w,\357\266\356X\336\253\252\273\235"
+	.ascii	">\354\215\017\366\276\177\376O\220:\315t\254r\206\232\223\223"
+	.ascii	"\177\250^\216<\354\307\362\203\375f?\331\277\3662F0\332\bK\001"
+	.ascii	"[#\245Y\352\251\025\245\303jr\305+\232\217O\240\245F\3024\236"
+	.ascii	"\232\232?NP\220c\321\234\237"
+	.string	"\301\253l\367\373i\027\323\207v\273\2466T\0332\243N!\037\276x9\332\322\305tP+\347\374\345[\372a~\326\255Y\031R\031R\024\324Y\325\201\254#P`:\030b/#P(\036\f\021h|f\250\026\213\313\315+\232\363\030\005vJw\273\324}.\037\353n\033\306\267t\001+f9\347\026\006\356Oa\352Sy\226\213u\033\246EK\223\001w9_M\215I`\257baj\340\361\231\231\313\234s\225[)\376J\223=G\345_]e\3119Mm\017\337\350[\233\270%\222\035:\334|{\213UcZ\233\332\342\237\275\307\354m\rz\304\306\0257}\332\234\234\341\341\356b\224\313e\320\031\323\210Xy\345\234+DG\254\004\310\2549iy\2759\034$1%\233\035\346\341'\347tk\270\233\rl\316\307\n\3756G\034v\370UTdrP\232\356\\\336Z\323R\207+\213U)iC\n\\\035\356\366"
+	.string	"\342^\311\002\200\276}\371\334\212u\270oR\212\347\252+>\364=\321\267.\370w2\341\341Le\254*V\215c\346\276\322\f\270\027w\207\020q\257T\3615{{\002\355\023\327\263/\3502\306\215\225\227\233\243]\r\322\n\346\246\214\3614#\3263\026\334\216\206D\237\310\325.q\342^y\002\037\355&\242\250\342\226$\263\350h\272s\215\177\313\236\240\220`\334l\2377\331\2121\2262\006\356+\355x\3434\317=\356F\021t\257\304\030x\304\306\206\360\343\213uX\\eH%Nw.\035cH\350\210hm\026\017\210CBC#\024\302$\0021\206)\2600\310\b+\035-\r5(\035\r\031-\255H\312 DT\024\364\242\207\350EA/p\222\222\013<tDT$d$\324\265\360\001Q\2210(T\021<\"\n2\n\n\223\210\301\007"
+	.ascii	"z\350b()\2504\034&\005\333\343,\026\016\t\264\t;\371\202\367"
+	.ascii	"f\016\364o\271PE\254\037\267\234\221W\026\233,\262\305O1HQ\310"
+	.ascii	"\305\316\343\006G\245\025'n\254"
+	.string	"GLs\276\272\0207\245ep\3317\332\n\364\264H\361\310\275\002\227\003\212\f\022\246\315\n\0177;=q\355\301\277\352\301\227\242*#'\365s/\346a\212IX\036\334.):\357\225\rD^\2440@w\221\353>\025\273|R\322\344\250\307\353\304\203ym]s\312\335\016>\331\343\\\007\357\340#\255\234\310\256\203oE\245\306%\365{r\215D\2351m\315\315sW\262\351\341\037\026\360\325\265\226\234\323Q\032Ra,n\266\357C\253\017\177\353+\255\207}X'\200\237\250q(\345\2241F)%\"\"2\322$\035\200\002\221\"\253n\021\2405T'))Hj4\006Oq\266\340t\365? \334\342\353B\201\035\300\3027\367R\214\372\016f\rsj\311\351\351\224\r\324\236AhC\243\025\370\346\r\321\203\217\377\331%\226\346@\373G\364\246\0330\227H}\2009\022!\221.^\322\240\254\211\t\320\245\207b"
+	.ascii	"\345`\311\301E*!nA\270\205\0010\254\331\373\264\230b\027;\370"
+	.ascii	"\350\205\324>s\311\007h\243Zn4\334xAD\276\274R\366Rh\036$wiN"
+	.ascii	"%\\\335N\305\261\306\312<AJX\322IbX\f\027\346\t$\315]\350.\314"
+	.ascii	".\312\335\330\240\230d\301\240\370\0134\346\330;\001\351r\304"
+	.ascii	"\036\213\022\235J*;0\017&\203RKRw\022\206\247zI\326]\276D\272"
+	.ascii	"\275\026j\f\277'\353\365\213\322s\207\217m\255:\365\266h\363"
+	.ascii	"7@\201fG\263\t\016\3349\200t\372\251\027\200\004\261\334\205"
+	.ascii	"\363\214\353N=c\366v\235\370D\340l\306j\364@9#G\323\032\026\335"
+	.ascii	"' B\277Mi\211g\340X\320L^\347\025Q\\\343\215J\031\276\203\361"
+	.ascii	"4\374*\325g5N\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\217-\255\235"
+	.ascii	"\212\370 5Tp\f\346\244\003\3723@\323\373\314L\233\314\f\365\374"
+	.ascii	"\231\273\373\377Vf\016\263}\335[\377yZ"
+	.string	"\b9\021\263\347\367\177\016\235H\243+#\271\354\262\313.\273|0\032\027\023\032\027\023\032\0273Z\240\220?>M\250\240\"?\351}\024\022e\005Bs3m\2272\355\036\003B\003Y\003+.\177\251\270\f\226\342r\r\242\313a\311\313bC\227U\241\3134\202.s\001]\366\372\271\034\303\347\262\f\024\227g\234\270\254\325sy\213\347\362\225\211\313V;\227\231t.7\345\\^\222p\371\t\347\262S\211\313/H\\\2061\3422\320\315\345 \233\313=\350\345\023\".\377\234\227Q\034\311\203\264\266k.\373\274\221\026G\237][b\351\224\330:>\033$\t/\355\261\322O\217] \341\244\274\313$\210\375\350\207w\031\207O\236+\0269\324\370\310\345\022F\356\307\212\334\316\n\272\361\3450\221{\275\237\t&\022<\344\366\362\356\236\316\356v\223\220\373\272 \267\231\352\356o\320\335~1w\217'w;\211\343\356\3212"
+	.ascii	"\271\215\304p\214\364\203\225Mf\341\343N+\257\370\275\275\311"
+	.ascii	"\r\370\353q\237\327\366\244\037N\212f\312<\356\217\354\270'\362"
+	.ascii	"\267#:-\326q\257f\310q\233\347c\367K\330\256\344\267vY\004;\365"
+	.ascii	"\b\250\276Y2\331T\333H\261\236U\243U\234w\325\"\260\372\214\321"
+	.ascii	"5YMBF#gp\337O\213\227\340`%\277\033\227O\265\31356.#\323\356"
+	.ascii	"\265\270i\253\215\321\356\305\316\356\205\260\331\345\233\262"
+	.ascii	"\3136d\347\373\215]F\305^B\030\023\371\325`#`\367I\254\276\356"
+	.ascii	"\337\274\216\364\353\nr\275\305\357\353\312\037\363\376\007\317"
+	.ascii	"\260\321c\032\367m\254\336\303]\211\351\3263#(\336\272wc\027"
+	.ascii	"\374C\353\336\006\333\263#%\222<\343>M\006\273\375t\322\2728"
+	.ascii	"\306\275\\\326=\220\026\274\343\207u\277\343\212mp\220\023$\204"
+	.ascii	"\261\325\375\\\325\231~Ml\266\200\220'-\246\272\017\233\272o"
+	.ascii	"\262\324}\220\250{\037P\367k\312]^=\342zxy_\306O\314tb\247{\262"
+	.ascii	"\246\033\251)\251%1\323\275\031\303\270\337\342\027\3674\226"
+	.ascii	"\356\207\260\022O\271`\251$\306\372!q\326oXd7\202K\270\277c\245"
+	.ascii	"4\024$\270\305\375\027[\320YZ\261\362~\215\2078\352w \206\322"
+	.ascii	"Pdd\207\217\356s0\003\253\016%N\357\275\214\276\364+b \031\240"
+	.ascii	"\216\324\230\305}\334\212{;\025,\364\023\302)\356\221\034\035"
+	.ascii	"\306\317%O\250\215\211\356k|\211\345~\037\206\3340q\362\276\007"
+	.ascii	"\017\375\305\217\205\356y\030\373\372\226p\320\375\031[8\250"
+	.ascii	"!2\006\272W\003\346\314(\301?\3678\310n\340\330\347\236m\250"
+	.ascii	"\217Q\334_\235\270\267\352\271g\262\335b\036\036\241\262\325"
+	.ascii	"\026\307&.\223\330\271\217b\035\256\372\275\005\232\234\023\347"
+	.ascii	"\334\307 \341\236\013\347\036\252\304\275\016\022\367U#\356\273"
+	.ascii	"\030\004\346\271a\0236\274\203\262\316\317ZK\001\213\340\234"
+	.ascii	"\337y\2777Ts\237\305\310{*\356\273_.\271\177\342!%\367XlV\305"
+	.ascii	"\301\275\024\267\265G\265\316\367\364\227\344~j\357\336\310\207"
+	.ascii	"\244\275\273\353\335\027\231\200D\"\221Gr\017\226w?\003\210<"
+	.ascii	"O\036+k\257\265d"
+	.string	"<\357\276\276>\275\343\335\313`km\002$\004\235r\376\327\304\272+z\350 \272\364\320\300\365\334c\007V\364\3204\017\356\005\335h\360\3201\036\372P\3477Tm\025\217\375\345z\001\216\307\036A\375p%+\036\373\003\346\007\350\233\211\313\315\003\346\027 r\321\301\372\017vs\307cw\240^\201\"\250\342\261/P\237B\265T<6\215\322\330\374w\316J|yl\243\362\326\013\351\347O\307\206\031\036\373%}\006\036(\021\302#\267(B$<v\361\034\036'\324,Q\"<\312\360\270\023\036\233\005]i\336\326\331\330\334\351\330+\312\337\250\b\206\312\212rl\025\346]\310T\0249\324\261S\224_g:\036{\310\034\236\377\200\224\022\353p\354 \363\016\030\251\355\235\351x\345\235\215G\035\037\350\352\";\323\361IaQ\031\216v'j\336tl\231;u\350\024\364\355\203N\255q\262V\0219\364p\035r\350az"
+	.string	"\346\362\300\204\034:\230\236q\226\270L84\260\371\017An\356\316\304\201}\256\330P84\210CP\263\005\366&\016L\b\364\006\253\006*\312\206\316@\371\225\032{Y\177\261\241\302\212\241!+\215\212\262\241W\324\337\t-\006\216pC\247\250oY\322cM\270\001&\331\002N\270\241\201(\214\r\375\225\346\027|bP\02174\361l9\240W\326\263\326\t2&\343\001\255\242\266\034\320'\351\257\304\023*b<\240O\326\226\002\372D5\026\320\305\264E\246Y\316\333\260\240$8F\231\036\256-2\035\3641\312\264Q}\273!\221g\313"
+	.ascii	"MT\317fH\244\215q\200VI\337Cbp\313\226\030^\261\303G\313\030"
+	.ascii	"\323\027\234\2674jT\261\265hh\032\265EC\033\317_\305\032S\237"
+	.ascii	"QC\263\254\357\320D\273j\321\020\203\242\310\204QC\277\244@\206"
+	.ascii	"\031\332%}{=\351\021\265dh\026\365,cMrd\314\320o*\031\373\352"
+	.ascii	"\211\261\257\374\222\261\177\336\332m\265\301\301\030a040\035"
+	.ascii	"\2764\360,\221\345bJ\370\322\023\274\357d\030\r\231\274\020]"
+	.ascii	"\\\332\202\323\304B\323\234G\021\341BLh\241a\324\313T\225m\t"
+	.ascii	"-4K\372\0035\341\375\230X\350\2253%\035\252\301\363v\310\221"
+	.ascii	"7\245\320\002\2618$\232\020\033x\266T\3503\225Z\372\351I\013"
+	.ascii	"C\305\261\350\371R\013\n\013\n\005\224\023\024\224~:<9i"
+	.string	"\020I'\035c2l \023\311\244\257|{\341\260\351\271\013\023%aO\360\023\266\314\222\260C\270\b\366Q\244_\203H\372u\332m\034\264\333$\234\335\3161\273\255Svy\217\354r\222\261\313xb\227y\204]n\253q\031\r\354\362\330\327\345!\257\313\311\256\313D\\\227S0/\253\240q\271H\275l\264u9\325\272|4\343r\013\031\267\203b\\\246\312\272\275\203u\231\357\352r\232\325\345\263\252\333%\250.#\231\272|D\352r\221\250\313C\240.\337-/\007y\272,\304\351\262]\323\345:\246\313q0.\317\275\270\354c\351rS\3512\234\213\313=\222.\277!]^K\270\234\243\305e\035\312\3137\216.\253\245\227q\030]^+\272\314\306\342rYr\n\020I\242Ch\345:h\255\\\03791\345n\345\332\254\034\243m9C-6\256\201\230\311H?\265%D\317h\343Xm\211\213\350<l\\\323"
+	.string	"i\020;,\020 p>\354\217\036\252=\254\217\016\252\024\344\262\242\022\300Y\221\203\346\037\022\203sj\263>t\330\036\215TC\227\367\034\266\255A0\331\266\226i\262m\rL\331\032\210\262Y66\266~I_!\005\020<\024\273\326/g\363\206\352\242\374\220\f*\311q\330\265\337\223\224\022\242]k\"\272\326,\352\320\256\021\2603\302\205\320\256Q(r\2433T\3362\325\336\250\316\264\016\355\232\315\201$\324%\264k\032\344\224\252\211]\353\020kv\255e\336d\327\324,\216\2069Q\326S"
+	.string	"b&\213\350'\354\031\341z\232U\273"
+	.ascii	"vC\256h\325\232E\371\002T\344-\255(\235\254\232\0018\202X\345"
+	.ascii	"$\201%\335\206Uk\2317Y\265\206YYT\230\264h\323\372\005uQ\213"
+	.ascii	"\314\342IDYT\007\326\247\237\245\035\230K\233\326*\247M\353\224"
+	.ascii	"&\032\363\344\264i=DU\233\326ATi\323\372\247E\263i=\001\333\264"
+	.ascii	"^Y[\224+h\023\007\017N%56\231J\2061\"-\350f\026\215\302\233\335"
+	.ascii	"Rq}\337\340K\"\242\327`\345\025t2k\326\252R\017\024\346U\316"
+	.ascii	"\007\207\220F\2604\3379\370vj\200\314/\255\331\215\216\350\270"
+	.ascii	"l\2315#@\004\221\363O\326\254i\316R\342"
+	.string	"\215Y\264f\035c\315:\310\234 v\304l\251$\"F\266\013g.\305\307l\231\r'%\263\223\331\262\245-k\340Z\301\2165\340f\007\3650\246\230\035K\332\2733{\224\035k\262c\255\202v5\275T\024\033\306Ze0\216\376e\303\0020\2425\205\322\0342\2276\254\207)\321\206u\020\005*k\330\260O\201\331\3748\230\r\353\030\033&\034\002f\305\262\302\244\007\326p\241\241\330/\003\222<\025\355\327\204\024Wa_\332/\306\031B\213\366\313\004\311\224\324\301~\2315\215\025\355\027\212\031\217#w\262_+6eH\035\354W\003\231n_\246\366\313~u\310\322\203q.\373\3251\366\253'\360\362j\032.\333\305t\261]\226i\271\370\354\310\233\321\265,\223\tg\205\333\267\230\252e\366\2254,\263CX\246e\342\250Y\302z\f\004\344\244\250\212V\355\024T\006\363\2153V\004\311\311\371\024T\336\356P*\245"
+	.string	"\256\035\2323\230K\253^\304\234\333\335\243\254\3324\2674\216\2140\262ZV\355\030\253\262\023^\334W\213\325jb\372\253Y\201%\215V\253A\274\275v\364\316\236e\265\332\330<\325L\033\323#\240\3433D\234i\030\364U3?\024Vg\353+\340\254\310#\316\264\213\372\342y$\025\316\374p\346\304\2103]l\376\202N\017\273[\315\004y\370p\2103\315\322\274\232i\026U8\323*<'\350\220\031\003D\243F\020\305\232i\240\262\371\345L\037\375\023\206\232\034W\305\231\216\231i\032\013\022LI\3202S\021t\360D"
+	.string	"\202\216a"
+	.ascii	"\202\0162\301.\305@\207\370\205 \351\213\361\345\002\035sV{Q"
+	.ascii	"\247\327a\201~Y?\341DO\262\350\241\211\224\351\025=\0046\210"
+	.ascii	"w\242\016\236\030ND<Q\003\363N\204\344Dz'\352\017~\376\200\020"
+	.ascii	"!ON8\022\363\020\340|1\335H\t\352',!\331\271\352[\352\005\013"
+	.ascii	"\223'\355\017\2570\fO\n\331\362B@\243\236\354\017\322_\350\033"
+	.ascii	"\342@}p\217\315\210mk\336\351\311\306@=sE\335\f\237\354\013N"
+	.ascii	"\fO\n\233t`\231<i\301\344\204,\333\223M\223\336*Q\255\224\214"
+	.ascii	"'\206'\033\346\204y\3222i\324$M\236\024f\215X2y\362HX\360\210"
+	.ascii	"\235\351I\007\256\304x~\344I\033\266\004\206\345{2\217\312\304"
+	.ascii	"\221\236\024\372\220\215\373\320\220\212RM%\251^\344\024\352"
+	.ascii	"!S\250SV\241Va\n\365\312)\324?\017\364\240"
+	.string	"\016q>#CO\344A-s\251\007u\f\361@\035\342\275ww\246\367!\007:RJ\246\002\345@?>\377\371q\273\217O\003\225w\313\243\350\237?q\024|\024=~\242iN\374\240\333Aq\236\367\fI\326\244\270\335{\372\250\323\245\336\023\363\236\236\237\007\3722u\352p\036&b\361\306s\2746\037\033\305\363X-\233\251\035\305\363t\212\312cm\304\250J*\336\304\2071$\331wn\202\221Hd\215\324M\364\317\357\364\233\236s\235\246\031\340:\035s\235\253@48LI\027xN\247\250*(\343\2601\361\324\3419\277\343y\n\372\022}\324s\216t\303\207W\3619\355\262\262<\2473\300 \265\240\311\374\221\036\355\nN\032\024\246\t\243|A]\230Ee\023N%\242@Vf\234\334\321f9\217N\370\241+\022\036%\340\307\b\236P9w\264\203\347\321&\235\262\016\rr\264i\320\226\021r\264\237\236\267"
+	.string	"v\"\3565?\373\236\007@\rF\212\021\316#\327_\220K\361\210\251\b\347\333H\013>\0166\320 \003&\006\314\013\246\232\026\240\007`\306\315\336\247~6\rz\247\237\026\255HO\355\237\027\220zX\021\374\2646\354b\240]\352\347o\354\330\211\340\347\360G\351\305\227*\004?;\345\354\237\016(\335\2501\341\247=+\"\267\274\017u\370\263\203\251\004?\033\250\376\354\023\177\266\314\233~\276\320h\273AL\201\347\221\353P\225\3405E\322\260\220\b_\323 \260^\323\301u\265}G60E9\262i\236\232\330\276\006\256\302th\373n\336\304x\204\270\005b&\243\350\253]b\202\256G\030,_\023\225o\314\006S\241\\\263u\226\257\217d\371\272\003\265\203\364\3027\"28H7h\276\307j\351l]k\240\274\333\372"
+	.string	"h4\223\3309[\327\030\2447\021A\004\347\202\364"
+	.ascii	"\013\322\230\n\322\001h\342Vc\252\005\223\026\360\222\312\254"
+	.ascii	".i\006[\327.g\221\270j\260uMLYV\213f\353\232eEm\261u\255\222"
+	.ascii	"\032m]\237\234C\265\202\255\353\241:LMl\335\317)G\310%\245`\353"
+	.ascii	"\\\274p\330\270\330\272NQQ,\035\003[\310\257\265\310\316\255"
+	.ascii	"C\025\305\3225\360t\261t\035T\255\234\235\353\225s\270Z\260r"
+	.ascii	"|\305\204*\023\252C+\327)\251\005\033\203e\250\342\2400\315\246"
+	.ascii	"R)U#\222&I\007\342\n\020\232\005QRRj\036\022@\024I\t\242\322"
+	.ascii	"\020B\"\031\tD\210\036\265\315\272\371u\307O\362+\350S\277;\235"
+	.ascii	"z\371\277pTP\303\233\232D\357?\013\247\270YR\\\267o\263\377\341"
+	.ascii	"\357*\334\314+O\274h\270\222w{&\313BDj\001\332\226\253G\035\035"
+	.ascii	"\342B\310\201\344\364\267\344\017C\246%\034\247\303}\351Ze!\220"
+	.ascii	"\027Z\322\322U\262:J\202\326\347\242\240\2571\353\307g\240k\352"
+	.ascii	"\205\034e\315\202\021^\212'\0139\342\247t~\336X\276\341\343="
+	.ascii	"\361r\204o\377\305\256\210pT0\221\204\215\347\230uL}\303\324"
+	.ascii	"a-\373\216\311\342\362C\274\020\f\351\260/S#{ \362\275\243p\216"
+	.ascii	"\261\237\223K\004\354\025\242l\375\353y\315\t0E-#F\217d\224\037"
+	.ascii	"\204\034\340\212{\305\023\356\020\222\264\f\244\271\034\353\232"
+	.ascii	"{Ly\353\322\264"
+	.string	"\202~\212\366\304\bv7\334\374\257@b\016#v],\002j\237Sg\332;\243\232*\334C\252\023/J\350\3246\232\317/\300|\231\273\247Zs}\bD!\260\247W\223%\340\244\207A=\020\351\257\246=\374\206\233\273\317\367\323O\216a\006lFo\351(\276\037\027\271:\201\240L\3342\b\317<g|+\316\220\276V6\356\314%s\246\274\363$/\317\307\264\314\035y/^}\0039\355\375\322\346\333\345K\375]\220\2476\362\316E\371\322\270\221U\207\351\376+\036\331Ma\360\356\367d\312\033\372\275\351x*:\205g\n|B`\036\327\304x\215\212H5\200\031\241(UXB\236\361\2166\251\353q\346,:\274(\211\335/\037\004\377J\3535\306Cg\352\t\007JL\024\315\371\270n\370\350\370\002\031\341\213\207\021%!\254\332\006\234\377|\235\020\272\016\362L\031\031=\301\030\267T\t\260\215\\+NPJ"
+	.ascii	"\027\337\201\314\337+\272o\375\332c\322\322#\263\004\016\310"
+	.ascii	"m\364X\233\303oI\027tM\"\263\2103\322\212\200]\246\220\245T\007"
+	.ascii	"\237\273%\226#\353vMo\302\301\3647\314L\363\r\254\304I\375\220"
+	.ascii	"\214\326\347\313\334z\273\302|\317\302"
+	.string	"K\022\203bXL\213}\236#\032\332\251x0\326\247)\262%ZK(\003]\316\314_$y\325B<\362\205s\250Y\231b+7H\374c\260k\004dq/\244\224w\327\250j\327\311\n\346\341Z\243\003\272\371\254\035x\253\264oU\362\250\210\357\346\362\260[\253\3250\203=\215\201\364\203]\210\303\177e\247\316\334j\241@-\374iAC\"\322*\244\013'Z\rC\273m\326>\013\202\263`?#l\233y\355c\252\275\313\332\037\"se\037\224\264\313\017\024\233g\005\233\310\2078\373\333\2359\260\013W\263\034\231\255s\234W\251(\024NB@\305\3112W\307 q\221\314nb\303\337\360$H@-L"
+	.string	"0\311}n\003PH\322\347\374\031\005\023\013\205-w\313"
+	.string	"\240\364l*;Cx\001\257B\230\220\340\0042\250\222\251C\253\260\243c\310\241\222#)\206\264\373(\335c\2439H}\237\224\216,f\337\315\307A\323\317\227\335\024\375\2510\312\177a\343L\372\243k\247\340\256f\027%\366e\216\037\005\314\366or\311\bp\354\313]g6I*\313\027\251\300YHe\r\016\3410h\0315\017\224f\376',\r\036f\301\007`4v\204a}X\2534\243\3218:np\022\301\355`H\354\237M\310\017\032\013Q\t\342S\212\004\031\310\375x\360\252\"F\017~l.\353\324\034<\222\017\1776\357\025\347\234\302\301\021\323\275[\315\257\3431}\264\261-\252&x\322?\240\222W\215"
+	.ascii	"\346B\273\226\223\017\264k#\333\006$\203\325\265'0qJ\352\220"
+	.ascii	"\263M\234\t\344\004-\314KFO\262\0202A\330r\222\027Z\024\220\274"
+	.ascii	"yNk=\303\256\322c|\266\302\241\253\3349[.\300R, <A,\216\304\206"
+	.ascii	"\262\026\0135zS5\372\026\267\371\222\264\222@\341f\351\230\023"
+	.ascii	"#\255(TEviy\222 S\025l>\346\365\234d\033\2437\266\201\345\005"
+	.ascii	"\215\227\234\306\321\323\367\221zJ\266\037\240Izg21i\021\351"
+	.ascii	"\344\356B\310\004\326x\254\331\004\241W\376\030\256\013\007\237"
+	.ascii	"\177\022\311*\375+\217\262\310\252 \333%\346\311q\305\275%Vq"
+	.ascii	"\247\310Fj\027w\213\354%61\207\330Vj\025s\210\355\245-\261\256"
+	.ascii	"\250M\302\026\357\212\333\244-q\216\210]\322\026\353\210\330"
+	.ascii	"\245\355bN\261\255\304\"\356\026\333K\354b.\221\215\324*\356"
+	.ascii	"\024\331X\002"
+	.string	"\224\327\205\2628B\341p\227j\003uPm]ERQ\253\006\004\217\247D\310+\200\261\321V,<|\027\326\316\300M\377\342\227\324\361\203\211\200g\237\006l\245EO\270\317:\256\313a\346\311\033\350\262\232\271o\362v\345\226\242\302=&X\023`N\360\327\233\026\367\250\327\035H\2263$]\220\002\363\340\0336\272\226\n\202\250\353g\325}\246_\310\224\200K\250\304\344\337\321\340\324M\2131.u\220b\344_7\376\271\2030\323\366,\034\240\377\003E\002\334\355\203}C\241\256\240\007\030\016^jwv\021)\003\302)\261\244V}\215\007%\327\225\304\361\344\256\220\004/\267\237+e\242\226J\300\330\2064yY\271\267M\364z$\230\252i\257\":g\206/\301\221\305\260\265\2634t*'5\0346\265\222\256\233Gk\232S\022\211\211\376\032\273\375\342\022\347;\365\373\005\240\310\340|\333=\226\360\241\031G!\372;"
+	.ascii	"A\373\274\367\2003\377\nX\2601\207\3203\375\f\257\\\245\b^L\250"
+	.ascii	"0\232\373\322\333D\254C\\\231\252\335\250\3103\244\236k\236\220"
+	.ascii	"C\245\025K_\223\341\0166\233]\221\367\210\302.\200\003\331\300"
+	.ascii	"\265\344\313\270b7u\331*\357\260\250\214\305J\320\211\253Y\261"
+	.ascii	"z\340QLG\336\365\213n3\314\035\340Pgy\300\266\013\003\213\271"
+	.ascii	"\306B;\035\222Ib@\270\021\367O\217\250W\025C\002=\370\276\276"
+	.ascii	"\r\347\351\343~E4\220eR?*\350\365\033\217u|E\240\005\337\035"
+	.ascii	"\322\006"
+	.text
+	.section	.gnu.lto_.refs.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375`\217\005\355\037"
+	.string	"*Dx\fH\260\326M\206\003\026(\301\241b\244|\322\0174,\\B\013\\\376\007\375\007\375\007Q\307\242\265p\005r`IwJ\277\336\037\244[o;}m\344\250t\373\b\2440\267\\\177|\004*q\353\007\t\371\260\2665#\226\020\271S\247"
+	.string	"\266"
+	.string	"\267"
+	.ascii	"\363\263\312\347\225\327\312\371\254\327c\275\"\331\334\263\233"
+	.ascii	"\347\360\276\206\3673\336\307v\037\305\236\212\374\177\030\375"
+	.ascii	"\217|\322\350'yQ\354!\335\003\351\036\247{R7\001\361\220\350"
+	.ascii	"\241\271\201\334\353\344\026\352\035\367\2313-\352\034Q\244N"
+	.ascii	"\021M\352R\357\321\201t\272\350B:_t\302\350Dz\221N\031\375H\247"
+	.ascii	"\352Q\267*OW\322\031\242/\351LzW\207\322\203\364(\235"
+	.string	",:it:\025\007\364\210\373\020\367\0237O\370P\267m\363\030\331\305\233\017m\2765?i\236\211\305\204\323\306\027\307i=\034\277\262>\307c\341\217)\002X\023\303\270P\356sr/\313}!|\002\2670\357\021]}\201\257z\020Q+\210\377\016\360tBWUu\362\252\271xU)\320\316\215d.`$sB\217\251=\325\305\247*!\334\266\324\234f)\251#\204'\365tQ\277+:j\316\363\220\267\351\272\216\256\333\0345\004\332\"\360\007\035\027\016U\007\035Ai\340('\340\347\247\307\375t\203\331K\300\227\3465\337\323|]\246\364\375\255@|'\301<\347\367\244\322|\306\3671J?\363}\2504\237\tF0{\251\234/(\347\277r\356+\347J\345<,\2334>y\350\300q\243\306\214\336|\306\350\315\357\342*\377&e\323\367\f\021Ns\373\3616\210\256\203S\213\035\026\366\207\361\335[\177dD"
+	.string	"\370C\271\001A@?>=8\236\233\355\260\337\311\031\237\274\2319l.\023S\243\315d\343\036z\336*\311F\016\356\245_\344\250.\375\250\301\270\364\177\374\265\245\377\264\227\226\316`\250,\335\367\025\226+\035i+\035\251\327\217\266\362FW\351F%\225N4`*\037\304{\237\335\007\340\275\316S>g\367\344S\355"
+	.ascii	"\364\016\200\033\231Q\234\007\3470\233\264\371}\215\314\301\217"
+	.ascii	"\371^\364\365\036\234\033d\333vtrp\016\316\001\034\234\032\306"
+	.ascii	"i?q\322gs5Cxm\234\313\336\232\217k\315cg\005/#\177\034\301\364"
+	.ascii	"\330\274\321C\340\274s\2559m\310\236N\300\237M\263D\330\227-"
+	.ascii	"g9\250\365[\241\"\245+\n\256\377\204k\255\231,Q\262\025U\324"
+	.ascii	"@\366\2614\326\367\220x\273\243\261\346\005\200l\270\316\203"
+	.ascii	"\3537c\365\231\263^\006\034\2375\210\016i\314\003\354\345\345"
+	.ascii	"\345\3259C\234F\316\t\003\f\3546\030\330\234-\372b\310\"\274"
+	.ascii	"\223ik\316\025=t\232\027\001\331\376\3528\177}}u\252\030\347"
+	.ascii	"\216N\035\2359:qt6\211\177"
+	.string	"d\246\370\237&\212\377\231'\3366\233~g\232\370\232Y\342k\223\304s\204\354\303\204y\231L\363\301&\323\177\305w\373\242\333\337\374:E\324\256\371\005\200\210\250!xe\0202\222@$(HR\230J\007\240\242CT\342\006\020\300\246\320\032\342\345T\276\254\257\024V\241\342\376!\016\231\016\005\231\306\325\374$]L:\316\030af\246H\210F\365\f\356\026c\327Q\004u:0\275\232\006\350\263\212\331@\226}\031\2123\031\376\210vj}\265p^\372\n\001\332\252q4\367\355\370z8O,D\022\027`./\275\222\374\230\364\360\3541\003(\303o3|qpV\314\214\203d;\206;h\202\362\307\377f\261yL\266\336\342\241\354\f1b\004\027N\020\030\343?5\3763x\001\227\324\321\331P\232)\315\203\310\007\331E\240\336}\\\341\203\036\016\3360\254J\241\247\220\323\324X\004C0v7\b\344\"\304\350\242"
+	.ascii	"\343\227\352\323y[\271\tR\001"
+	.text
+	.section	.gnu.lto_.decls.e2c83b108ef364c1,"e",@progbits
+	.string	"(\265/\375\240<(\001"
+	.ascii	"M}\004\336\344\006P\030S\0200\006\3554\006V\253EN\273\227\350"
+	.ascii	"0\021\005k%\212-8K\232\347f\025\254\r\300Z\321\321\335*\346\005"
+	.ascii	"\343\321\206-\037T42\300\335n\330\304\247\263#\017\215\216\216"
+	.ascii	"n\230\203\267\342\223\275\301\247\356\305\273\260\213\224\033"
+	.ascii	"$\"\"\"d\313\275W6)S\250\0241\030a\031?\230\016Y}Vi\377\305\027"
+	.ascii	" \222R\366t\270\\P\320\366xk\222*\032\025\213Jx\275?\262&2\316"
+	.ascii	"\345\365\274\310\372\354\320>\376*\342\034)\262(\346\024w\212"
+	.ascii	"cD;\255\254"
+	.string	"\255\016\013\341+\262\300wXH\221\352\266}\242\346\252\305\025E\240\342P1\250\330\242(\204\251E\026E\236\027{\212>\327\324\367\335)\276\371\t\222\304\"\213\342\017]\365}\3376\254HP\211R\177\245\262\177\207;\260\310?\020E\035w\207\272t\367\002\227\324\262\376\272\267\277\026\331_\333\366\335p\007\366F\252|x\223N\250\324%A\244\342\2263\305\223\365!rI\222\340[\326_\311\3663_\216\202\311\254\260\336\227\372\334\347\204\352H\035NS\3420_\235\274*\254\334\004\337\341\250\372a\262\250\246)\2710\033f)Y0\007fBL\315\203\371\357\271\232\001\217\203<\301iE*V\233\246s\243\3522\230\241\2748\200$\354x\235(\271Bg9:L\375\025j\233\200;\260-fa\277\302\330_}\366\365\341\276&\334\327\325\375\001w`A\340\016l\b\231\311\236\321H\214(.\270\270\\$\353!\205\276~"
+	.string	"e\235\227l%*\035\264\254\257\231\354\217 \227}\212j\004J\311IHr\222\366\305{1\021`\340!^\316\313w\331\016S\263\222?\317\345#F\262\217\005:?/\004\032b)\241\352x_\03270"
+	.string	"\273\333\203\373\020\"Dn\342z\002h\324\177NR\247\265X\240)\241{\256\333>\244|\001\311\372\203\031\351\277\2134TCc\313\372:\310\316/\356\300\006"
+	.ascii	"\263\260\327c\373\372k\237\372\342\016\354~1\013\233\211\270"
+	.ascii	"<\303%\215\330\250f\235\001fa\251\306\276\251\252\3027\267\274"
+	.ascii	"6%dY\273\265!\235\210\316\336\260\244d-"
+	.string	"\244\310\323\203#\226\365\365\r \231\rSs\220\254\366\234\224\327\330\336\367\r\222\323\362\231\t=D\256P\324P\220\374\003\017\032\363\216|\214\030\206pa,\ta\301\352k\246\215_\334\201\275f\261\257w\366\237\321\316^\343\217\272W\354,\233)\367\252T\202\370\364P\217G?A\302\3120\"{\344l\217\220L\210\225\301s\bd\214\252\034d\222\304$k1j\322\311\321\013\264\254_$\334`\031'\177)q\250/\016\t\211LT\f\337\367\375\237\30305\203\345\256\235\343\231\227\023)\255\377\354\365\374\365g\240\314\"\363(\357x\360\330\313:'\271<{\t\251z\re\375\242\333\376\263\017\037\314\207\265D\307\325c\0354$\004\343\201\251\271\307\223 \235\214B\\\304\250\312\332\305\345\231\007\026;\034\223\333\261\245\325\264\264ll]+9\006ec-\353\254\017\031O\017\006X\326/\232\355\217\300\224kX\240\363\343"
+	.string	"7\256 \177\266\3127r\225\262\370\2769_X#(a2|w\244\200\256\256/\253\274t(\026\350\3748\200\207\217\352\373R\2612\216|\225sd\035\230\232\255\262\324\263\215<\365\017\324\367-\341\317IVy\006&S\342P\337!\004x\315\210a\370\276\324\020!B\204\370\020\"9\350\365\244\r\251\377L\365\\u\033\336w\347}_\017.\022!u4\262\276\3133\025\013KtD}\325\336\367]\032m\020Ir\222\365\213L\033Sq\007\366\003fa_4\3124\334-1\036\250\254_\364\331\307\324\034\005\245\306\304(H\326\031\352~\310\327\002\235dL\n\217\254\263\323\276\341#\006P\326\271\351PV\340"
+	.string	"\261\310\372\203\217\373\357j\030o^uY\277\370\356g*\3739p?W7\023\263\260\307\324\214\304\303\002\217\031N\2168\330;D\200|e\375g\0311Z,\247\034)Yg\030j;\357\373~P\032R\203\354e\375\254\267\377g\242l\224\213\262\213<\204\251\371\305\363\212\f\224Y\034S\337\237\235\367}\217\277\362\213\374R\301C0\021,\327\223\227\210\215\344\027\030\tN,\232a\3556\035\304\352[~\221\203\262P\321\fk\373\234\375T\337\227\372\"\343d\237\242\031\226\013\024uX}_\352\207\020!B\204\b\241\304\252\232\303\201\324\271E\256B\\+\313\372\231n?\307m\374\203;\260M\314\302\376\371\347w\215u\205HXY?\013\331\177\366\311=^/\244pP\335\267\303\0350\262\316:y\347\231'\347d\036\022\234\3367'\363,\251\274o\316\022c\001`,"
+	.ascii	"\335\025u\365\203\325\317k\373\331l?\213\341*T\n\224jcV-\262"
+	.ascii	"~\316A\005\037\342)\230\212\021\217\210\243`)E*V\333\246\363"
+	.ascii	"G\207\365\212T\267\r$\317\257\212\210\3670\240\016\224\352\373"
+	.ascii	"\276\024\204\b\021B\251GED\332\332\360\203\236"
+	.string	"\342ddJ\326\3172\266\b%`B,\210\007\213T\254\366G^\223\352\373\232\375\307\205\230\212\tq \246\276!>\264DQR\3424\02594T\345\224\3653\321>\226\262\217\003\253\032iVd\265\226\3651\335\376\217\3750\025\377a&\372#\374.\307\177\230\017C)\216\021\355\266\262\272\352\373\232}\b\261\354A\367%Ck\374\204\212\273\242\274\250f}\274\266q\023\334\207\251\330\3115\231\323k\366\276\324d1'F][\326\307 \330ebbb\"\006\301\036\207\355c\033\373\330i/\371\260\214\001\326\203\230\365\261\320\376\bu8\2112\207\371\356\350\030\301z\337\235\343 \277\313\261\022|\207\223\024\251n\357\016\217\016\003<\021\372\3500|\337\235\377\030\017\347a*V\202\355\216\347\360\221g\352\373\232\275\357\033\"\304\007#\030\\\017\026\254~\314\376\f\233J}\337w\251\234\2227T\230\365c\330wa\037\205\035"
+	.ascii	"\334\201\325\230\205\275\032\356\300b8\034\207\251\034\340\""
+	.ascii	"\324\345\326\253.%\311\372\b\330\307\034\260\305\304D\314\001"
+	.ascii	"{\003\354\363\341\016\354\rq\007\366\307n\027,\2511Z\320\310"
+	.ascii	"\372\307mBt\r\035B\274\262\306k\370\007\246R\200\201\034\263"
+	.ascii	"\341 _s\250/5\312\224NQ\326L\334\201\315\230\205\275\210M\202"
+	.ascii	"\367\305\024\26081\021S\240\226\306f)1t\22156\303g\230\372\001"
+	.ascii	"\243\275K\214\247#\244\224\3659\330%x\361\007\366\211\370\003"
+	.ascii	"\373\343\262\037{\341/LV\374\trz\325\336\227\332\314yuA:Yc0\034"
+	.ascii	"\206\251\027\340\261\213P\302\2138d\357\327\373R\227\311*>\252"
+	.ascii	"\034f\375\f\366\261\330\217do\t\317\373\370\002\026'\342\013"
+	.ascii	"\330Sq\007vc\026\266\210B1\205\"\003\376\"\f\377\005\267\232"
+	.ascii	"\261\001E\004\024[\320 0\340w5`\355\222cz\203\177\275@\203\370"
+	.ascii	"u\001~\355\262\311\214&\034\340\327S\360\007\366H\322\307\b\214"
+	.ascii	"\006\370]16\356\n\004.\021\374\201u\253\201\223\271\003\227\210"
+	.ascii	"eK\316\370\327\b\344\0166X;\363O\272X\005\377\223\031C\3005\260"
+	.ascii	"UF1\342w_0\273\007\177r\305\005IpP\302\306C\374I\t\260}\311\270"
+	.ascii	"\177\017\371\327\342\277\211\374\306\016\214 \376u\263\005p\261"
+	.ascii	"6\222\177m\256J#\007\377\246\373\215\033\374{\002\256\026\036"
+	.ascii	"\201\335K\006\001\362\033\223\355\221\261"
+	.string	""
+	.string	"?[b\003k\213\265\355\300\026b\324\200m\032\341\0328\007\370\003f\361\376_\340O\236\341\022\253\f\270\003\"V\026\230\375i\376+\020k\307\246\261!`?`U\2609\334X\177~\343"
+	.string	"~\243"
+	.string	"V;6\206\237M\201=\302\" \216u3f\360\257gC\0301\370\215\027\030+\370\215"
+	.string	"X\237\260U\306\016\277\261\345_\373\330+\354\374q\211\037\277\374\270\003\277\026\301\036=\250\b\374\331\250q\231\003\362\257hB\221J\021\221-a\034\223\"\231\264`;\260s\214\311\237M2\"\377\"\007r\323\237\237:\030!C\025E0\200\361\370\033\215\177\361\204\"\tF\327\270u^\302\237l@\b~6\306o\\\177\375e\324#\370]\"\353\220_\223\375\271\316X\324iZ\210&\242\343\326~-g\314`\277\246\373\365\234\021\377k\330W$\375S\304\200\276c!\240sd\301\"\005\330\245?S\300M\304\033\220\3411X\260\021] \267\312\357\036\376\356\b\367\005\303\377\2023v\374\311\003\374\254\220+(C\321\204\277h\200\277H\302-\220\221\034\261\302\r\374\213$\024E\300\023\324\300\016\375\271\203d\006\177q\003\177\261\003\177\261\004\366\346w\243\374{\305\277\201~\027\360/r\200}\332=\377W\220k\223"
+	.ascii	"\177q\004\244\023\032V\346g\241?\353\201\337\255\376\373\304"
+	.ascii	"\277Q\374\356_q\203_\217\360\rjp\375~\366\211\004\362\257\021"
+	.ascii	"p\373~\275\202\333\344\327\fX\235\377\372"
+	.string	"\302\001\314\256\0320\366\370Y$?K\367\273|g\177\021\361Hr\307\3572q\3672\f\177\216\341\317\022\370[\026~W\357o[\370\335%\271\001\177n\341\317(\374YDN!\263\360g\b\374+\213\233\367\347\0252\003\3766\206\337\305\373[\t\374\256\222\273_\277\004\370/\310A\fv\277\233\004\177\270\n\377\261\352\327\027\374,u\313\370\367\321\357\326\375;\311\245s\221\260a\271\204\1773\355\246\337=\362\273s\277\376s\215l\032\377\226\322\312_{\3705\313\317z\271r\\\177\021Z4\361\263<\376\342\tV\313-2\365\273P\254\0167n?\271p\377\006\301\277q\374.\221\177\347p\207\270o\277&\314\372\267\326\277\267~\327\355w\203\374+\306\372\031\330\200\0036y\365?\346O\276\250\375\354\332\357\262\341$N\241\245\361\032\322\206~\274\001\314\001\326\252\225>\240X\2025\272@\360\330\325\375\361\257\"\270k\377z"
+	.string	"W\355\337Dn\232\207\313\2608\005\301\334\001\326\251\372\257\342OZ"
+	.ascii	"\353\325\004\343\007F0\236`k\270\232]\376,\363w\321Z\267s0\301"
+	.ascii	"\215$\r\377J\347\236\341d\3417\300\023$Y\374\273f\177Kc\255\362"
+	.ascii	"\257\211\277[\266R\361\200]\247\024\036\377:\220\201\327\260"
+	.ascii	"\326\035\275~\026\204\007B\360\377\370#\013Y\0204\374\255\224"
+	.ascii	"\337%\013\201\244\300\376\372"
+	.string	"7\341\233;V\203[\362\351\317\005\320(\024\371Y\271\337\245\272bq\377'\370\223U\377^\377\315\376.\330\277]\367\013\371\027\021\367\312\277Y~\327\353\337\313\1773\177\267kc\023J\370\017\342G\336\300\222\330\"\376=\342w}\374+\n\235\3032\300\345r\211\036\302\217\324\371?\226)\360_P\311\357\366X\355\376\213\370\217b\277\313\343\32786\007\033\304\357\356\370w\bw\353\0264\240\004\377\236\200\253\225\241\330\031\2205~\026\304\346\300_D\354\300\237=\330\300\1772\026\003\277\233U<\026\221:~\3155B\005\220V\253\f\033\312\007\030\370\331\002\270X?\013\342\277\376\221\023\bl\007\365\376\266\360w\257\360\b\354\006H\030\334\034\256\325\337v\340+X\2630?\376\200L\303\353fA\353\370]\034nU\321\245\3727\f\277{\203]y\021O\375E-\0032\263Zn\r'\277KC\3475\377\007\214\177\305\300\256"
+	.string	"\005\376}\201\337\215\302_m\007v\006\376\255\201\337\205\322\031\370\360\003\374\310\033\230\304:\366\273O<~\314\305b\035\037\247\340?\216\340_q\370\265\224\353\364\273M\377\316\340wg\374m\007\266\006\355\321T\322\257]\020\200\274\251qe\374n\f\274\200\337\205\361\343\006h\214B\016\306?,\215\216\351\034\\\264\302\320\266\370[\241\337}\201[d\033V\244\374,^\240\210\001\327\205\007\227\350\317\035\324\340\016\375E\232\337\265qq"
+	.string	"\372\335\236?;\373\376\337\360\037\343\320\260\212\037\343\360\343\034~\234\342w\337\037K\243?\366\372\361M\bD\220\364\037\203\377X\302\217\177\216\206Y<\310\n\365\343\242\227_\003\271$pG \202\017)p\370]\233?\233x\362\277"
+	.string	"\377q\016\267\370\265\213+\363k\016\004\375\230\305\217\205V\374\370\347wo8\007.\212\242\250\243\013A\266\017\367\304\337\322\250\361\273&\376\265J\017\300\314}\27210\277\373\302\366\377\202?\211\004\343\30720\322\377\rp\022\016\f\374+\212}\200\177\233\360\273\032\330\f\370w\003~7\003y.\006\376\026\305\337B\177\367\002m\007~\335\323\276\374\256\005~\026\002\210\305\032\212\024\370\331\b\374n\005\\\nL\340\307\354]\370\221K0\374\232\306\036a\223\360\273\021\3703\340\237\253\177\216\362gA\334\3013\200ur!\033\001$\222\331\272\245\003"
+	.string	"\304\205\200\373\200\027\312|\260\325\217\253~L\205\257p\216\377\202\267"
+	.string	"g\355\270\341o\257~M\344\262\360\263-\356\n\277~\361\347\244\277\335\372\333\035\277K\342wU\310En\n-\230\213\202\333\200_'e\254\326\354o\317~\227\001\255[\373\366\273\013x\377\f\323\342\374\256\002\262\320\237K\240\303c\345\277\003~d\001~7\001\177\253\344wKh\231\270$\340d\276\372[\277\277\375\373\335\021\332\243\277E\372]\021~\326\002\255\344\272\270!\264K6\030\361g\266\337\375\200\035\300\177\023~$\013\256\007\277\246\200v\371\331\f\334\020\177N\373\263\332\237\317\376l\206\326\302\375m\334\357v\360\3475\227\203?\307\375.\210s\220\255\376\334A6r\r~d\002\330;V\203\340\346n\340\026\300\325\300\356?\313\237\024+F\240\230\302\266\371\367\007~7"
+	.string	"?\206B\341w3\370\213$n\001\002\376g\2408\201b\013\317\340O\272\377\212\302\305\240H\245\210\370\263!\374\254\313\b\277{\301\337J\327l\024s-\370s\035\336\300\2179\360\267U\376\314\347V\360\257\"\\"
+	.ascii	"\374\327\200\213t)\370]\226?\347"
+	.string	"\375\271\203\314\204\025\361\037\205\037\311\201\225\306e2\271\313?\037\377l\374/\2503\220\227D\2166~\274b6w\360\362c\250\037?\375\037kW\270\312\177e\342&]\344\177\262u\360\307\354\321\211\324eW\276\366?\276\255\277v@\r+\224\310\252\"\004\205-\216\025\234\314C\335\021\351\201\255\361\2636~W\273\305\025\003\377.\254\301\002\251$\f\355\324\337\336\370\335\234;`\"\005\360\272\030+\327\001\270/j\360\0279XC\354\304\177\347P\345\307\315_\217\260\262\301Fd\201\376\203\360';\374x\371k\021n\201\007\310\337h\201\377A\320<\320\344\016\\\300\020(:\377UgS\371\017\345R\376}x\274\377J\246\374{\212\224_\307p\302\377\207\3776\3741\363\177\025\234\\#\260\013Wp\207\367\375\377\260\3013\360\337\303WhV\234\377\b\370\217E\013`@\313\205\025\206\377\311\3378C\267\330\204E-\377\221"
+	.ascii	"w\377c\006\177{\200\2775\341\337\203\377\332\302\026\374\333"
+	.ascii	"\005\374;pG\331\200?f"
+	.string	"\307r\007v\026\370\337\374\215Wm\210\226"
+	.string	"\177\353\301\277\3774\t.\374W\376\306\241[\200\265N\300\316a\225\241\347\230\374\327\032\266\337\277\312\260\252\370\277\177c\340\277\312\260\241\374+\005\214U\177\213\301\337f\360\357'\355\210\355\344__\320\257\001\263_\376\306\250\277\210\342g\375\242\374\254\340\277\373\376\263\177\362\003?\253e\374\223\320\237\025\341g]\376\234\344\310\023\377J\375w\223\037'`\265\373u\b\370~\215\303f\362k\234\275_\277p\367\353\017<"
+	.string	"\377Q\347_\363V\376\255\367k\031\230\350\177/\331y\n\310\207\033\357\3270\377V\362k\030\376}\367\353\017\374\333\356\327!\3701\373\037"
+	.ascii	"\377q\355\337I\376M\367\357\270\177\023\371w\333\277\201\374"
+	.ascii	"{\355\337g\377.\373\367\327\277\273\376\275\365\357\253\177\343"
+	.ascii	"\3707\325\277\247\376-\365o\032\377\206\372w\323\277g\374\373"
+	.ascii	"\350\337E\377\006\372\267\316\277G\360\357\020\374;\305\277?"
+	.ascii	"\360o\017\374\033\305\277a\376\315\201\177k\340\337\027\370w"
+	.ascii	"\005\376=\303\277a\370w\013\377n\300\277M\3707\t\377\036\361"
+	.ascii	"o\017\376\r\342\337\032\374;\203\177\263\374\233\371o\344\277"
+	.ascii	"\215\377f\3776\361o\245\374m\341\337\016\376m\340\337\002\376"
+	.ascii	"\355\337\337\362\375\255\222\277\215\373\333\267\277=\373\333"
+	.ascii	"\260\277\335\361\267X\177{\343ok\374-\322\337\n\375-\320\337"
+	.ascii	"\342\374\355\364o\241\177\373\362\267\022\370\333\026\376\226"
+	.ascii	"\001\177k\302\337\206\360\267\036\374m\006\177\373\341o'\370"
+	.ascii	"[\226\277e\177\026\361g\005\1776\312\317V\177\326\357g\373~v"
+	.ascii	"\357g\361~\326\356g\357~\366\310\317\322\375l\334\317\312\375"
+	.ascii	"\254\333\317\016\371Y\266\237\r\362\263i?\273\366\263e?k\366"
+	.ascii	"\263\324\237\r\373\331\257\237\345\372Y\036?\273\365\263:~\366"
+	.ascii	"\352g\255~\266\352go\374\254\324\317\332\370\331\247\237m\372"
+	.ascii	"\331\245\237\235\361\2632~v\350g\201~v\347gC\360\263*~6\207\237"
+	.ascii	"\275\371Y\351\317\322\374\254\314\317z\340g\237?\013\363\263"
+	.ascii	"\035\370\331\r\374,\006~\266\002?[\303\317\316\360\2632\374l"
+	.ascii	"\f?\033\201\237%\361\263)\374l\003~\026\001?k\302\317\226\360"
+	.ascii	"\263#\374\254\210\237\375\340gC\374,\210\237\335\340g\007\360"
+	.ascii	"\263\001\370\331\013~\266\345gW~\226\371\263\307\237e\177\026"
+	.ascii	"\377k\342\277R\371\327)\377Z\370\257\203\377\372\344_\373\376"
+	.ascii	"\225\357_\227\374\253\222\177\265\373\327\272\177\225\373\327"
+	.ascii	"\270\177%\362\257?\376u\354_\303\376u\307\277\342\370"
+	.string	"\327\250\177M\372\327\242\177\035\372\327\026\377\312\342_\177\376\265\347_w\376\025\347_C\360\257*\3765\207\177\255\371W\350\277\302\374\253\363__\376\225\003\377\252\201\177\305\300\277Z\340_)\360\257\023\370W\030\376\365\205\177u\341_M\370\327\021\376u\304\277z\360\257\004\370\327\013~\035\342/\276\374\305\003\374X\347/^\340/\326\360\027e\370W\013\376\"\013\377Z\301\277R\360\027C\374E\345\257\261\376\234\370\257\037\376L\370?\206?7\371\327\t\376,\367g\234??\375y\307\237\241?\256\361\257\035\376\225\345\327(\374Y\371\343\304\037\353\3701\322\217\211~\034\202\377U~\334\200\037\217\360\343\016\377\332\374\327\345\277\356\177-\376\353\177M\345\327S~M\370\353\300_\377\375\272\357\327z\177\221\305\257\361~}\367\353$\277\246\373\365\221_\313\375:\356\327D~\375\366\353\017~-\344\327l\277\316\340\327i\277>\373\265"
+	.string	"~M\366k\352\237\351~\375\365k\256_o\375Z\307\257s\374\231\312\257q\374z\352\3276~M\343\327O\277^\372\213\372\327I\177&\301\237\211\376l\343\3271~\375\342\327D\277f\361\347\227?\307\374\372\347\327=\277\316\3715\316\257\337_\207\340\327*~\215\303\257?\360k\232?\257\374\032\372k\024\177^\177\r\363k\033~\234\200_s\340\327\031\3705\005~-\303\257c\3705\f\277\206\300\257_\370\265\003\376\327\360g\017\277^\341\327$~\235\302\237\247\374\232\001\177f\362k\005\374x"
+	.string	"\277N\300\257I\370O\363\343\344\257G\370_\367\377\311\237;\370\361\372k\021\376\007\371\217\366\337\202\377c?\326\277v\371/\370\353\020~L\342\327#~\r\302\257=\370\365"
+	.ascii	"~\035\200_c\360k\013~\274\302_\204\376\305\023\177\361\371\027"
+	.ascii	"K\374E\033\376\"\006\376\"\005\376\342\004\376\313\374\305\026"
+	.ascii	"\376b\002\376\342\t\177q\345/z\360\027\227\177\221\371\027\221"
+	.ascii	"\177\221\375\213\353_\374_\304\177F\374\363\341\237\013\377\334"
+	.ascii	"\367\037\206?\363\375y\357\317v\177\256\3733"
+	.string	"\222?\037\371\263\221?\373\3703\327\237\241\376\334\343\317<\376\034\365\347\231?{\340\317(\376|\342\317\317?\303\374\271\304\237m\370s\007\376|\201?O\340\317\021\370O\303\237]\370\263\007\177\336\340\317,\177^\376\231\375s\376\363\177L\366\343\257\037\373\370q\326\217\223~\354\342\307F?.\372\361\b~,\202\037\233\370\361\004~,\303\217Y\370\261\n?N\341\307(\374\330\204\037\037\340\307$\374\370\303\217\331\037{\370\361\004\377\333\376\013\371\237\366\237\354\307p\377\221\374?\221\230\230\230\370\237@\302\277\201\210_\355G\372\005\250\312\311\3050a\367\370\312K\312\372\005\300\333\277\033\027\347.\355\025;o\316\021\210\243\033\226\013\030nD\210\270oz\007\371T\204\007^\326/\200\325\376]7Lu\335\334\267\027 z\334\035~\3410\270>\266\254\337\276\255>P\245\253H\326/\300\217\020!.\233\225\233\240PU\\\326\327"
+	.string	"\312\376\3355Lu\327\\6\024\216\234^\027 |<Ae\371\255\370:\222\265\313\366\273?\\ \333\251*\313\217F\326\253\033\356\300\376\bfa\257\201[Z\232{\246s\230\324\235< n5\222x\016\263\276\006X\373w\3150\3255s\317\360\353\206\337\025myN\220N\276\374\222\270g\033\n;y@\001\b\215\253\254\257\201\020\031\231K\255s{\337#\017\262\327\224\304\242\254O"
+	.string	"'\373w\3030\325\rs\251\370\305\302\357;\244\214\256\372\276G\036,u\260\t%e\355R\327:\033\376|\260\366\262\316@.w\305\212|\234\375\310\372\004@\333.\330\277\235\270_\032G\207\334W\326\371\250\313\345\256W{\006X\367f="
+	.string	"\314\302\272>\376\026\310\345\032b6\346\223u\346\302\035X\227\207\313\335\036a<\304dd\275\201\253\345j\271[\032\207I}\243\226\260\336W\311\003\345\323\220%V9\271\347\350u\344g.\353\023`\307\376]\254c\252\213\345\352\370 \316)\260\210k\305cEb!\336\033\217\254O\200\032\373ws`\252\233\203\215#AkH\224R\273'\226\270\224\365\t\360\263\177\227\312\255rqH\331\001\327#\353\254\206;\260\035`\026V\177\271\334\245\342\321\266\244\307\r\327F\334\025\241\232\3241\325\225rm\224q1Q\3210\252\004\375\030R\224u$\353\017`p\2735\376-\347\322\310<6\034\251!'\2245v\302\035\330=\350r7\n\b\022\304\253\254\3576a\367\211\352>\271M\037\336\034\243\017\354\336=8\303\227\350\205\007\037"
+	.string	"\335v\233v\317"
+	.string	"\3448\310=p=\236\344\0365\301$C\224\216\251\256\222\273\204\202\232\323k\244"
+	.string	"\261\254.B\343\216\033\206M8F\022\250)Y\177"
+	.ascii	"e\373w\217\356\316\370]$7i\314\216\212\217\2541\026\356\300N"
+	.ascii	"\200Y\330=\347r\367h\271\224\003\347(\306\256\026"
+	.string	"\177\004\3158\372\313z\347\271\334\215\221\257\324\220 1r]\270/x\f\253\211Y\347\037\334\201\025"
+	.string	"fa\363\234\313]\2431:\";E.\321\\U\b0kwh\215G\210\\\326\037\300\326\376\335\026\230\352\ny\r\241\312\270\013\204\251.\220\313B\3570\251o\224\035\326\373\036y\220\034\254\302z\313\332e\241\357\262\023\235\236\021]\326\037\200\322\376\335\037Lu\177\3309\024\216\234^#\022zP\235(!w\206\310\304\262\276"
+	.string	"\252lw\307\345\301\324#q{N]*\207\370\254!\311\372\002(\334\307G\302\226"
+	.string	"\037\t\017Q\276\373\3121u7'\363\330\340!\305\216Nb\326.\316\277\023\335\227O\253\306X\326\032\bfa7\242\313w\225%[VUY\377\007fa7\225\177\225R|\023\257\004\203\262fw\\\276\017w^\374\310\221\365\226\222C\024\252#Y_"
+	.string	"O\3666\334\202\203\233\020\303x\241z\262\306G\270\003\313\022\350\362-\2706EJ.\353\025\314\302\356(\277\336\301oH\346\362\016\263\336U\227o\300\235\230H\344F\326\312'\337\177\377\206\262\375`\340\021\032f\235\235p\007V\003\314\302n'.\337O\\\237\237)DY\023"
+	.ascii	"\263\260\273\357E*L\366\242\262\336"
+	.string	"M\376\315d\363e\036\033\224\246\020\233\262\316U\334\201\025\201Y\330\255\347\362\275\227\324\352ca\2265\bx;\017\017\001A\"ba\326\311\036\227o\274$E\252b\271\030\266\3572\017\224\2440\252\254q\025w`7\234\313\267\235\322\007\316R\216\272\357$\231\307\006\266\273\277\242\2547\235\313w\235\023\217\036QY{0\262\347\366\221$\332Y\316\222\254\361\024\356\300v\220s\3716\262\253\024\021\272\221u\013\221\357\"\377\206\333q\231\307\206$>\241\247\2541\037\356\300^\200Y\330=\304\345\233\b\217\030HVY[\260\335\276\337~\035#7\021Rw&\2255\236s\371v\3234\b\207\262v\033u\314*.\310\267\220?W3 ROH\224\251\254\2137\\\276\203d0\251\037\252\2547\333\223JY4jd\255\233\\\276\201\254HH\236\252\366\0175%\242\025\013;\264\235\266\3252\217\r9TTYc5\334\201\245"
+	.ascii	"\263\260\331\206\3137\032\021#2\271\254{r\241\222!\243\262c\352"
+	.ascii	".\333c\032\207\354\3059\346\371`\242b\370\276G\036\034m4\t\300"
+	.ascii	"\310\3767\331\367\030R\032\222\"Yo*2\007*\310*\353\013`mo\261"
+	.ascii	"?\023\331a\231\307\006\026\n\223#CYc\303\r\246\217\006\373\242"
+	.ascii	"|\262\376\346\261{|s}sm\257C\242=8\303\367\210\b\304\366J&\222"
+	.ascii	"\371\375e\275}\034\nU\222\027\317\1777\373\321\025\211\312\372"
+	.ascii	"\002\030\333?~\376\3317\207\350}_\243\225\372\022\351 \331\037"
+	.ascii	"\037\257\030\203\370\223\270\210\007\360_\337\345\n\205\367="
+	.ascii	"\222sz\337\027\013n\255\266\234\031\001x\377\037\304\373\342"
+	.ascii	"\340\367}\211~\314\240p\232?f9\357\317\331]Q\363\307\f\252\350"
+	.ascii	"\207\372>yx\315h\274?T'\034\355\204\363\276/N~\251\357\016T\321"
+	.ascii	"\273\343\204c\363C}\211^\252\023\016\363\335)"
+	.string	"b\376Psp~\314\240\212\360\217\231S\321\217\231SQ\363\335yq\336\235\234\247\275\343T\364C\347T\304\3741\313)\372\331\201*\302T\247\027+!B\205\302\351y\315r\222\357\373\006Q\261p\220\357\233C\364\342\340\345\026/T\265\305\313\364\342;\037T\032\357\373\342\250\361E9\271T\235\367\356g\313\tE\317\373\362\275-H\300\3018\324\367}}^\035\034\374\276=T\242\367\325q\262\341\350}\337\327\t/\361!z\223\357NN\220N\224\023\262G\307\311\347\335z\302\357\373\276E?fQN.ohfX\257\016\025\007\377\0049\275X/\037\024\3216\303\241\342\300\244Y\325Q\320\336\361$Ut\354x\312z\265\212J,\314G7\246\265\027YS[\216z\b\351xN\362\267s\325\203u\025W\235\261\263\305\252\304)\3319\266\325\223\026b\310*\327X\024\216]\225\b\366\007\2255\325\361\217\232cF\326\027"
+	.string	"\323>>\202\005V\265\261ol)L\335S\273\206\326\021\266\2476\215\342N\221\t\206ATJ\305@ &,\266~"
+	.string	"\004\367\003\320\267\377\035\265\241\204n\034\371\313\032)\254\251I\317\323v2\332\240\021\2476\002\033`\177M\233\3115\352\252r\261\231\262\317\236P^^\326\377^\332H\210F\200ZY;\331H\354\223\002\270\005I1\031\262D6\022\013X\334a\211l$\026\n[\305wj\272\313\256\272\225v\322\236\261\2170u#m\030\3371\266\214\215\304\n\356\027\026\350\374\274o\321\t]ARL\206\357\373\236\020He\316\250\215N\230\205}"
+	.string	"\306\366v\341\201\035B\302\254\037"
+	.ascii	"\256\315\3121\331=\\l5\b\n\316p\257hy\264r&\364\020= \212\251"
+	.ascii	"\252\244\335+S\312\312<I\354\220 (8C\021J\330+Z\035\232\252H"
+	.ascii	"\305j\321\242\250\252\253\027;\330\352\024\307\210\\\241\262"
+	.ascii	"\253\352^\321\356\264>8X\272 (8\303\271\275\242\325j\267\212"
+	.ascii	"T7\027\242\246\252{Ek\244\275\353b\273\202\240\340\f\267\321"
+	.ascii	"n\261\203\366\317\026\332C\233\305\366\331E\033h\023a\352^\321"
+	.ascii	"\316\235\215\302\006\352\352^\321\376\264XE\252\216\367\315\261"
+	.ascii	"b\215\004A\355\025\355\0166,\b\n\316\220\007\332a\331\007\275"
+	.ascii	"yr0Y\231e\375\f\022\367\377\235\263q\266\016\246\356\235\366"
+	.ascii	"p\307H;\345\f\007\225\375\232\320C\344\002\351\345\330;-_\033"
+	.ascii	"%\352\2038\"WXmb\335\316\321\326U\332DD\035|7\022\001\253\264"
+	.ascii	"\210z\ri*j\020S[\304\025o+\307\217\254\237A\223\375\f\212l\303"
+	.ascii	"VJ!k%\325\202:f\330\026\346\360\350\"|[h\274\252\002\246\226"
+	.ascii	"u;\330Bi\301bo,\353V\020\223-)Z\232\222u\033\210\313V\030p>N"
+	.ascii	"\252-\340\337\321\255Z\205\226\3653\250\252\266\177:\250r"
+	.string	"\be\335\376!\203\300\321Ae\335\366\265EPkCP\332'xP\354~\024Y\265t\346h8i\271\216}@\257_\326m\023\243\223?$C\262\376 &\373\357\256Q\204O\332\262~\006Q\373\031\030-i\365\362\266\225\236\022\034\342\2226O\355\345k\361\336\346\261}8E\246\020\266vuTb\274]e}\f\224\354cj\233\244\255\013\262\265\202\215\356m\335/B\t\232\n9\205.\311\213\254?\330\"\371\357*\367\302\332\210d\375\267H\216([\340\275PG\3329\227\220\017\321+\353c`d\037\203\267]dI\004\307\007R\326\307\340l\267pm\217\226H\033\207\251-\\\313\005\327\372h\337\374\332\252\3079\236!_\254~k\313\3326\251\037Xn\355\020Lm\337\376\326v\265c\370N\315\001<\204T\265\321V\224\036\253\203\264B0\265mk\331\322Z \026\350\3748@\020\254\332\326\232\265h\026\350\3748"
+	.ascii	"n\255\272\211P\301\335`\3651\360\001\344GrE\233\026\023\265v"
+	.ascii	"\315\b\343\350\016.\353c`\265\325\216\205t\360 \311\372\030\320"
+	.ascii	"\330\307\324Ci\317\356WE\027\003,\353c\320\264\217\301\321>\006"
+	.ascii	"/\366G\030k\275\3320|\247\266\002\035\033\265%\303\324v\254\025"
+	.ascii	"k\307X\030\307\025D\376\004\225WZ^`\254\376\005~[\367\330I\253"
+	.ascii	"\313-X\373\225\364[\212\333\312\372\027,\331\277\240n\377\202"
+	.ascii	"\271\375\013\334\366/0\333\277\340"
+	.ascii	"k\377"
+	.string	"\002\256\375\013t\264[X\bn\215\340.\240\332\277`i\377\002\027\273\275\242`I\303F\216^\326\277@g\257h\203\212T\254\026t\204\252Um\216\026\007\246\266Vo\255\332\026\355\223\t=D\022\320iQ}\337\267\265j\251N\367\024\202\216\303=7\nB\204\320hSsM[\337\002\265\375\314\207D\001\276\233B!\013\210\013\023\b7\037\355S+\324\036Y\240\363\023\001#l\325\031\217S\303Z\352\252*\201\300wj+\270}\265Om\323\343rpU\337\367m\237\332$\n\2249\324\227\210\275Q\205w\304\260\265\321\336h\241Z\251\226F[\243\235j\2430\265}j\235V\2643\303\303\025}\013t\366+\240\262_\201\340~\005O\366+\310\333\257\200n\277\002\270\375\n~\310\3108\177xCY\277\002\037\355\213\026\006\246\2661Z\242\241\326\b\n\326\373R\333\030\255\213\326h\005\212\223\036U\212B\234\b\236\261\372"
+	.string	"0\334\177k\324\026\035\253\200-Ui\213Z\"e\330U\020\215\254\017\200\273}"
+	.string	"\314\355\003`\310>"
+	.string	"\200\354\277e\3616\350\353\332\n$>Y\267@.oY\360L\005\031e\315\001fa\017"
+	.string	"\263}"
+	.string	"\210\265=8\217p\312\212\254\017"
+	.string	"\254\226\007"
+	.string	"6v\233\363a\351b)\355'\353\003\300h\177\004BVJq\214h\377\260\221\224\330\342`j\373\262S\324\332\227=d\253\340;\2657\307\205\006\201ZWX\311\037\206\2071XM\205E\\\262\260\362\251\202\243\262\266O\301V!k\230\215\316\250Vd}\n\246v!\005O\373\024\b\355S"
+	.string	"\264\367\017fa\377\201p\263\325\263\177\331\311\215JO\214\254Y?|C\016\347F\326\377\340\267\377a\311\376\207\037\033\023\3655\331_ErF\232<\237!\235\336w\347\350\203\311\333\020\037\313\004\337q5a\261L0\231\r\257\207\244\037\034\325jO\257\350\265\327'\246\367\353?vI\366A*\275`\370\344d\255_6\017\017FQ\221\031\037V\304D\035\203\254\022\366nm\001c\207\255c\355\330$\230\312\336=\007=\016\337\251\261\200\204\005\326\035K\247\251\360\335\321\002\220"
+	.ascii	"a\335\261HtP?\204\b\021\302\350\227\264g\267\365?\224\355\177"
+	.ascii	"\020\333?{\204\235k\331\314\376\230\260s?+\307\032\321z6\350"
+	.ascii	")\263#mY\267\257\026a\343\346\220(\271\261DX\270\025\321\017"
+	.ascii	"L\317-\353\375\342\016,~\207\274\231=\361J\313\332\355\b\342"
+	.ascii	"\213\243\254\377\301\307\376\317\006a\331X!\230\312\266\261?"
+	.ascii	"\326\360\340\025\326\373\232\261m,\020<\210\357\216\024P\304"
+	.ascii	"\307\027\333\306\252\331\320\201\232\222\274C\362\232\261\365"
+	.ascii	"?\024\355\177`\261\377\201g\337\003b\032\332\326\020\023P\326"
+	.ascii	"gj\306>\237\241\241\254\357!\217-c\301X1\037c,\031k\206\251l"
+	.ascii	"\031KUc\313\2126\272\312\212LE)|w\364\346\344\204\320\003\353"
+	.ascii	"\360k\377-m\001m}\017k\233\rs\235\222\312r\262\276\207\261}\017"
+	.ascii	"]\373g\277X/\326\213\355b\271\262\262\006\365\262>\016\202\245"
+	.ascii	"\251L\350yS\350\315\031Vy\260Zl\017\326\007\273\305\356\300T"
+	.ascii	"\226\213\315\272\302d&\364\274)"
+	.string	"\006\347\244T\337\227\312r\261V\217\263`\305\373B!U\320\204\265\007g\310\352X\300\234\037\326\373RY.\r\204\311,\320y_\246\245\n\226\252{p\206\\l\216,d\001\317\373:1U\320\344\264\007ghD\222A\304\210R\337C\325\276\007\250}\017.\366=\364\354Op\270?\001\224\375\2638\330*:@3\301\254\251Z\026H@\324\262\376\004w\373\370\313\210u\301\227\364\002\227}\331a\"X\016\337M\241\300\203\256z\304:\341\273#\346\273#\344I\225\006\013\003\227)q\232\357K#\t\226\024{\203\235bk\260Q\254\rLei\2602X\032l\f\024\276\352\252\307\275\301\253;\2456\n\353c\235X$\266\351\030$+\220}b\2410\225uR\243 y\330\3040\214\325?\333\3042\271\001\315\360\311\232]\302fHX\320\310\372\023\\\355\237\235\201\251\254\322\322'\0131G\326l\322\0048\366'\220\332\237"
+	.ascii	"i\177\202\027\373\023\004\355O\340\263\177\326\005.3;\"\230$"
+	.ascii	"\353O\240\263\177\266\210%r\302\242\356\220%b\207\356\226P\351"
+	.ascii	"2+DM*\301\311K\313\372\035\252\373g[\260A\306\254; \202+\316"
+	.ascii	"\006\375,\020\313\"\363\330\260$Z\362\207#k\346\213;\260\371"
+	.ascii	"\305,,\373\343rv\005\020\220\016\301\254q\"\353\203\214\021#"
+	.ascii	"\006\016\333\303\362\214\375\020\376\310\232\345\371\331\035"
+	.ascii	"l$\363\330@\005\303\205]\326.fa\261\227\313Y\235e^\333`\216\034"
+	.ascii	"\026'\310\032u/\353\237\305a_\036|dD\262^\023\251\024P\243\302"
+	.ascii	"\310\372\035\366\366\277VAt\367\240\274\360\321q\201iR\250\034"
+	.ascii	"\"\307\206\\le\275\036^\204\240\0336\262^\245\270|\235\362s\330"
+	.ascii	"\225\265\321\260p\013\310 \217\254\t\251\355\020\"\325\026Y\277"
+	.ascii	"\303\334\376\b~CXQV\3005p\035\304\324Up\375\323G\240\034\025"
+	.ascii	"}\252oS\3560_\026:IX\202\353\223\267\341;\265\227g\354\003-\243"
+	.ascii	"(%\303\367}s]R\222 \243~\207\270\375\016j\373\035\304\366;t\355"
+	.ascii	"w\330\332\377\352\244\017\004\"VRk_[vz\223\330\244\232\360\365"
+	.ascii	"\030\243\321\243\213r\237\256\301\324\327\2642Y\367\222\374P"
+	.ascii	"\325e\275\356\255z\371E\221\2155\274\257z_\227\374(\214"
+	.string	"C\\\363\222TL\354fd\375\016J\033\263\271|\305s+\322C%k\021\\\276*\341\202{\222rgg\227d\255+\356\020\212\322w\344\251a\206G\267\002yY \246j\334\212d=\222\205\370\340\362Z\217\024w2\253\347\266S7\267\032\031\264JC\222\265\3342'jGG\326\357\320b\307\255a\253\220\342\030Q\f:~DV\270\265\b\246\256qk\333W\267\365mg\365\212[\277\376\252\253W\334:\304\260j\354\313\233\"\265\365[\250l\326\tw`\277\004\263\260o\201\262W!\377\352\265\202\255Ar\001j \026f\315\306\316\021U\231d\375\226#\373\377\272\266\252\255h\353\331\372cM\303\324\025\310Z\006$I\325\254\017K\254\311\nd%+\253\253\032\241\362}\255@\3261\273\020\313\275B\2659\245~\013\331~\313\325~\013\324~\013\321>K\225}\026&\373,H6\313r\266\177\267v\345\320qEP"
+	.ascii	"}\f\261Sg\200h\\\357Zv\244+\247\007\017)_xF\262\336q\00428D\225"
+	.ascii	"\365Y\264\366\213>:+\026\220uk\315Zu`\352\252\265Z\261i\2555"
+	.ascii	"\326\251\342\030\321\026R\366Ck\275\261\342\260@\347\347\315"
+	.ascii	"\201\372\300\207Q\027\241\341\262\207\016Mp\353\365\n\233\245"
+	.ascii	"\3358\314\372,;k\2167y\254\341\246\226\223\365W\242\354\177\305"
+	.ascii	"\261V\031\021BR\365\364&\001\201\233\243ZW \231j$1a\262\332P"
+	.ascii	"\022\262\030\224\313\372+CV\251\225\265\375\2574\242\222Dt\004"
+	.ascii	"\022E\255P^Er\024f\375\004\343\314LH\326_\371\3329IJq'\361H "
+	.ascii	"\013\254(AX\272\nX\334Q\3560\337\235\250\026XG\016\251\350\277"
+	.ascii	"5h-\032*\0332\374\241\242\023\361\235\332\nE\246L)\356T\251\256"
+	.ascii	"3\326\245\225imZ_\254.\326\244\325i=Z\225V\244\325h\215\261\302"
+	.ascii	"\300\324U\306\272\342+\320\312b\225\261\352\030V\327\235\365"
+	.ascii	"\307\002\235\237\027\216\374t"
+	.ascii	"U\020\250*C\017\352B\023z\210\\\026y+\252.\253\f\375\263\346"
+	.ascii	"\f\031eU1|_\252\216\220\262\035\030\350\225(+\350\313+\353\257"
+	.ascii	"\364\354c\352:\264\n\305\001\301\231\312z\025*\326Qi\231\t\211"
+	.ascii	"i\035Ie\375\346\341\326T\334\201\275\032fa\337\364\333\377\372"
+	.ascii	"\263\372\250\215=\351{\263\230\264]e\275\366\254<\377\337\260"
+	.ascii	"\274\251#Y\277Y\267\337,\262\337\004\262\342,\013[\b\356Q\327"
+	.ascii	"WWy\221[FC9\262~3K#6\251\366\233O\373\315\027\373M\237}f\225"
+	.ascii	"\375\353BM\270b]\221A\271[\"\253x\345=e}\346\340>\223o\237\211"
+	.ascii	"d\237)d\2379\266C\300,\354\251~P\242\354\224\324A\321O\220E\342"
+	.ascii	"^\004\375t\371"
+	.string	"0\"\344D\367m0\226\263\324'\204\235\210r\321\2215\255&E\251\3037\026U|L\304\206\330\320\2215\223c!\330i\207H\206\222\336\323z\273-\347\216\255\370\027\203\307\320\222\2144\003\r\352I\036^\024\337[#k\215\367\270\214WeKO\211\276\253\306X\002\270\306\235%\365\330%a\301\222\224\020\"\321t\272ns9\005\351\221u\322\bfa\365\021\227k$\310@>3\037Y\003`\316\b\215\303\241\246\254\345t\021L\325Ft\034\021M\245A\217\234(%CmD\303E\211R2l\275\370vP\261\372\314\243}\246\320\376r\312\376\365\220\267\344\321\017\325\234n\323nZ\b\246\352\267c\375\300\262\002\202\365\246u\254\025\035\032\031n'9\234(\331\372\327A\200t\315\030\002\224\265\006\242\327\300\212\022\3310U\003\321?\226Q\224\004]h\375e\334\376\262l\377Zmm\311\020\260\254\255\364\025\220\021\274\326"
+	.ascii	"\017\215\f\2634\017|\247\266\302\020\272*W[\365thd\230\246\251"
+	.ascii	"zL\237\3510m\246\3054\231F\303T]\366\353/\r\246\313tW\366\301"
+	.ascii	"wG\324\327\310\b\004\347\320\310\360}\251:\364\225\322}_\250"
+	.ascii	"\2729,}\205\357\324V\370JR\325e\332\207\246R\026\337\227i\016"
+	.ascii	"+I\227\351\036\232\207\261J\307\241\221a\210d\035\024\027\216"
+	.ascii	"\026\235\251,\354\227G\373\313\240\375e\316\2762p_\251\267\265"
+	.ascii	"\226\336\302\324\307\351\035\357r)7\330\344\226\365\225s;\305"
+	.ascii	"\373\276/~\034\333>\216\275rm_\311\265\257\254\241s sb\bQ\222"
+	.ascii	"\365\225J\373J\037\034T^E\242\324\262\326TY\337\320U\327Tz\352"
+	.ascii	"\"\224p\344\316\373\365\276TM\245\3377\007c\001(1\026\300\032"
+	.ascii	"g\225S\306\352+q\366\257m\324\300\36146$\353\217\260\024\244"
+	.ascii	"\241\364\223\246\241\243\264\223\226\302T]C3]7\345\304\343\276"
+	.ascii	"\244\241\031BU\027]C\303\320GE*V\013eJU\244\031X\357K\3255\264"
+	.ascii	"R1\257\005\023\025.\026\017k+N\251\217Q\366\223x\373I\267\375"
+	.ascii	"\344\331~r\307~\222i\377Z\306\365\321w\330\237\035\250\255\254"
+	.ascii	"u\f\227k\031E\276\2427\030Y\257\230\205}R\350\205\213\244\247"
+	.ascii	"\032@F\327.\314\\!ST\325\254u\221\313\265\221\002\252hte]$\322"
+	.ascii	"C\\w9\201Y\013Q\223W\325\241\251\254\217\024\324A\232\005\246"
+	.ascii	"\352\026z\005\320\234n\241\177\214T\227OYz0X}\344\337>2n\037"
+	.ascii	"\351\266\177\355\323\263'\025\226\204\347\272\347\231\307\206"
+	.ascii	"\367ekz1\003/k\275\343r\315\303V\221\302B-\353\245\326\3219+"
+	.ascii	"\237\024$\"\235\303c\003\321\276\333\253\322\221\365\257q\364"
+	.ascii	"\213\244\310\013/\353D\266h\306\013&Y\037y\266\205d!\236 \037"
+	.ascii	")\305\271C:\303$#T\260FP\323CjR\034,\006\026\231\024\243\024"
+	.ascii	"\247\024\005\213P\212N\212\205\305*E\303\242^\221\257HX\374+"
+	.ascii	"V\213}\305\303\"b\321\257\bX\244R\334+>\301\324\242\224\242\222"
+	.ascii	"\027\361\212y\327\031\260\215E5'\005i1\344'\363\2311U\361\333"
+	.ascii	"\332Q\236;[\232K\323Kz\177\027$R\260\340\212E\252\344$\"\211"
+	.ascii	"X\357Ku9\202\311\246\024\177\3749\t\310PQJ1I\361\256H\305r}\242"
+	.ascii	"\374\252>\177Nb\023\222+\026A\304\232[\242\327\324\344\255\306"
+	.ascii	"\2129)E\264,t6\243\356\017\353}\251IE)E\2677\247\300\"!\264\034"
+	.ascii	"\216-5\022\364\221;v\276\303\035\330\0170\013{$\325\376\213v"
+	.ascii	"/\336\331\360zh\265\022\205\242d\235\253./\332a\020$\356-\353"
+	.ascii	"#i\354#\215\366\221:\373G\303\375#\337\3761\311\376\021m\377"
+	.ascii	"Xc\027\343t\214\272\0329\262\376qi\377\270\263o\214\262o,\262"
+	.ascii	"o\\\3337\206\355\033\263\366\2158\366\215Q\373\306\244}#\320"
+	.ascii	"~\025w`\357F\331w\217\354\273i\373n\216}\027j\337\215\261\377"
+	.ascii	"bY\221\f'\366\031\355\025\305^$\373\213\324\342X\366a\237\214"
+	.ascii	"\b\006\311zI\305\035Xl\210Y\330b\230\313\213bGD\266(9YcP\004"
+	.ascii	"\373\372\2416\217qd\177Pr\321k\013aQ\315\372\356O\227\217b\033"
+	.ascii	"\242\224\037Ysi7\306\024bU\326\337\206\233GqGqG\271C}\213\332"
+	.ascii	"3@)B\303\036\230Z\344Q\334\322\037\222QN+~h\375\rd\177{\355\277"
+	.ascii	"\250U\314BZ\001\227#k\035zmigH\326\3377\366K\260*2\025\245\212"
+	.ascii	"T\254\315B\007\311\306Q\023\252\251\034E\034\305\252\"V\361\n"
+	.ascii	"S\213V\305\251\027od\276#JKE\253\342\022&\033a\f*\213\353}\251"
+	.ascii	"\3103'<KH\375V\312f1\013\373\226\311~+W#\006\031`\214\254\337"
+	.ascii	"\252\355\377\305\250\"\024\246\026i\024\235\250O#\024i\024\233"
+	.ascii	"\250\207_\206k\031\227\213DV\277\225\332oe\354\267-\366[\237"
+	.ascii	"}Vp\237M\262\377\342\214\244c\031\241\230R\326HT\020V9\240d}"
+	.ascii	"6m\177\204\272,d\207U\214Q<\302\324\242\214\"\f\031\370.\013"
+	.ascii	"\341\273\2517\007\307\004\2607\260\310\207\020\310\030\001Ho"
+	.ascii	"l?\262\376\363Z\335 X\326'\261c7[4\203\232<M\236&\320\207\375"
+	.ascii	"\202\225M\251n\270\235/\033\315\025o\002%\245\244\fY\312\272"
+	.ascii	"\371\263\3420\016\r\356ie\335\354i\372$\023\247$\2325}\360 \020"
+	.ascii	"\230`\233TbbS\347\203S1\017*\253\212\021\266.j\005\220f\316\233"
+	.ascii	":5\362pDe\375\301&\016\025\347\365\313\372o\3424_7\312\023';"
+	.ascii	"J\235\031X6\262>\211\027\210\210\314C\314\244\352\344I\301rR"
+	.ascii	"d\205\335\224)S\230\207\230\354\035b\243\2520Q1<\212\265\355"
+	.ascii	"9\0356)\342\002\313\372*\030a\0062\003\231\206vF\201\204\206"
+	.ascii	"\354\217\036w\201\202g\0322\013\233\224\226\246\230\205L\302"
+	.ascii	"\0257\242T\251\b\215p\021a\016\2622\006\323\2344\275=\371\023"
+	.ascii	"& &{\207\332\2642\250)\206H \206;p\240\234\t\310\254\256\035"
+	.ascii	"\002jU\317\37432d\261\303\255G\307\220\r\246\037\373\243\315"
+	.ascii	"y:\354c\305\222\\P\364\220\262\276\nd}}-\".\263c\242\262S\225"
+	.ascii	"4\226\365U\340\301\324c\3521\371\354\360\0027\331\n0(&\2233\371"
+	.ascii	"\312j \366\310\232\271w(G\356\004\301\260\334\0241\030^Y_\005"
+	.ascii	"*\2733\361\354\230y@X1\375\306C\316-\257\250\355\301CT\313\232"
+	.ascii	"\251\204y\247\202R]]\213(F\026\245d\210s\004i\023\222\365U\320"
+	.ascii	"9r\204\211\344\303~\277\266~Ts@\t2\004Iq\247\257\307\335U\241"
+	.ascii	"\221\337\b\263\210\032\326\333\026"
+	.string	"PN\037\034\034\263\310\007\247\"\023@)B.\214\244oP(\356\314\"yb{|vmm\314!\037\234p\b\215X/rl\031\"o\260-m1\337\316\034\342\327\204g\205\013\267\275\276\303;\267\225\212g\312\021\263\035jg\262\2511\203t\261r/\250\252\030\276?J \226\203aF\360\202\26092\250$Ze\315\374q&\220\337\315o\206IhY?\005\244\315\\K\201\2079\306\034cV\003\213p%\235"
+	.ascii	"\031\trv&\232\341\f\266\300\254\231f\331\30754\264\013\302,k"
+	.ascii	"\301\322\272\240\230eL\262\342\321\022\267,\215\025\327\243."
+	.ascii	"\353\2430\310\354bv1\305\300\206D)\031\036\335\020_\252\2603"
+	.ascii	"\305\374\234\224\006\245d\315\004{\334\037\217\026?\276\376\273"
+	.ascii	",<z\3740\277\230^m\222\026\335\037\016\r\026H\262>\n|L\036L\036"
+	.ascii	"L./,\374\305d\324\343L\256\275?\244\245;\035:\230[\230\354\035"
+	.ascii	"\232\016\025&\3412\343\3617\306\324:s\213N\255'1kf\326\333\236"
+	.ascii	"\252FI( aZ1\255\230WoYQJ\206A\352\250La\3468\363\252\35587\327"
+	.ascii	"f\205\202\031\223\212I\305\254\372\340\204\003\250\001\230Q\224"
+	.ascii	"R"
+	.string	"1Jk\bF\326UQP>>\262>\n<\230RL)\346T\330\320U5h/h\320\306\231Sq\354\020\222>\260\252\2473i<)\355\212\203\314W\347}\261\360\353\223\306#V%s\262\303,kf\024\023\n\205(\030g\312\200\301lZ\032\371`|\033\n\3132L\026\022\251\0321\223\316l:\223I\314\207`Q\326\314%\246\022s\006\023)#\255J\232\242v\262f\0361c\2400\303\310\210\351\342\303~\301\242\204\336\240\2543]\354\350\003\323\221\365Q\340\021\022b\022E\265X\237\370\002\263\206\316$\322\253\372\202\022\024\324\"b&U\347I\225*\332a\021\036v??L\240\020\360\353\223V\306\242z\214\002\345j\007s\305\231@\314\235&d4~\032\220\306\304a\3420{(\2302t\030\226\024\230\204*\353\237\311sfO\225\036@ Y\177\220\271\363\337\r\241\257*G\326L\235,\203E\226Q\326o"
+	.string	"\0243\247\0013\016\017\227\211\026P\031*LB\001O!_\225/\023I"
+	.string	"\353\252\312z\211\370\270\034e\244\204\225\365\222JF\332m<\260\020\243H\221b\204\373\340T\314k\302D\205\t\350-\332+,L\356a\262w\310\002Q\272\b\271\222\316\354\320\250\203\203\0230\212R\342\322cx>\252Y\237\001W\201\201-\342\213;/\323\034\026\235\224\237\254\254\317"
+	.string	"\031\200\200-\"\005XC\177\202X\347\b\225\036~}\357[\376}p\302\211B\302[\224.BC\r\205\fp\320\311\227\177K,\032\206>K\277%\024:6\026zl\310\032U\346\376\236\254e\025@\371\t2d\231\267\314[\362}p\302\001\fa\316\250\2130\210\240\026\326\222/\371\226L\330\244\250$e\275\334;B\251z\253\221\365\027\220\266\227z\203\305\235$CT\246d\375\005h\311}9'\267TR\314\3531\024\226\305\342\017\252\006\335\227J\276\274\023\241\204C\241\221BC\313zi\227\244\016I\213!;\226\262^\036\371_\222mlJ\311\310\002p\020!\262\214\303d\357P\313[F\022\262\323\007\367e\234k\266\304\ng\0011\322\276\374\221\266|[>a\232"
+	.string	"q(,kIg\324\266\304\366\345\333\227n\"\224\220\221\216E\202Z?\262^\266\t\t\002dMm\001C\324S\227g!\340\327\007\b\317T\325}#\353\251\216}y\2664\213\0226\305ni\266,3C\252\262\266\343\315iwHHK\262\325\212M\bSW\326\037l\362\340\\\375\365\350\261\f\373\340\204\003\250\200\270!]\204\307&Nt8K\260/\303V\034\030\007\023<\271\254\227_+\226\217\217\036-\262^z\255S}bApd\275\354Z\213t\316\216O]\326K\037\305\235\345\027\323\220\271\254\227\\k\016>t\333[\241\023\213h7\364\302\356\262\262\226;0\331;\324"
+	.string	"\274\254*\\\353\215\037>\334\226[_\356\3208<u\210Y/\265V\034NZ`!\345\334H\316\255hHU\325\022\013IN\027a\362EY\216\251\345\325\227<RT\246\254\2279V\034WSm\325\254\227V+\2165G\335_S\326K\034n\321N\336\331\234[\244$R\007\345\203j\343\267\261\274\201\311\336!\2547\345cdO\351\0018c\352\313\033P\326\240&{x\n\300Z\316\370\222i9cYc95\247\344\032\002#\306\322\351\313\032_\322h\327\232"
+	.string	"=\311z\031\265\204Z>-\233\262\317\361\306\031\221\243\245\245R\r\242/\215\210\226H\305=L}\217\234p"
+	.ascii	"O8<\216\261\030S\262\204\361%\322\227G\"\224p(\233\213\307^N"
+	.ascii	"\326K\031\313\030\313\027\207\222\267\240\004\001f\275t\3618"
+	.ascii	"\344"
+	.string	"\021\023C\033\313\"\246\240?h)\204\311\336\241\017oNN\224\f\227BVx=-[|)tH\370c\207\002\202\226:_\366\374\230\272\324Y\002\035\277\357\2535$v\004\031\264\342\316\307\322\347K\240/W\210P\302\343\272\354v\376\262\376\362g\311\223\034\004\344\001\225\365r\247Jx\245!\341\022\007\223\275C\036\300\206\302\262\270p\325\306\215 \210_\342|\371\212PBFZR\211\3226%\353+\023\213jp~B\262VVQ\316\345\004\3350\313\372\"\020\247\330\\d\255\244\342\352T\035Y1\224\265r\212\362\360\277\333\036E\3655\365\030\371\222|\n\225R\256\252\020\201\210\370\274\016\207\262V\026\272F>Wn;\242x\334\2308\271\322\317\211Rp\211\305\264\254k\315\016\005\221\252W\n^\031(B\t\031\251\265\261\004HX\326\312(\200\312\277\354\303\352\221\325\261)\241<\271Sr\345\022%\312&K\265&"
+	.ascii	"\330\r\205e%\203$\371p\322\273\262\311\225|\"\224\340\372\b\305"
+	.ascii	"A\021f\255"
+	.string	"dr\345Q\335\220j\326W\356\031\265j\230\365\310\372 l\262\030EE\312<<\262\267+\343\336\224vK6\374\276G\257\316\316\313\244\324\002\016ym\031\276?G \214Ar\314p\214\\iwe\022\021Jx\334\322\024\220W\326\312\272\343\033\201h?Y_\211DI\367\273\256\216'lU\262~\002\240\266\362\b\bKS\236\250L\341Y\355\310:\343\307\261J9\343ZZ\026R\326\312\"y(\307\017\320\365)&\211\312\323\311Z\tw\f\213\353\311\313ZI\004K\t\335\341\r\371]$ \216\030TY?\001K\373\t(RSS\266a&UG/\b\326\373\036\201X\306\2302\230&\344\31269\274,\274\254\225A\366\024\027.\322\236(\331d\270\235\215\261]\tD\320\315\311\232\362\207R\rQ'0\353'`g\315\220z\252\022\r\223\275C\030\030;4\342B\236\241\205\005\235]\211\226\007\235\366\232\314\376\273"
+	.ascii	"8\262!gV\266\314\032\243B\032S\222\025\001\227\346\356\262>\002"
+	.ascii	"\366\224cq]W~u)\303\326\260b\f\264$G\300\256\f\353\213\202\243"
+	.ascii	"\223\365\217Wa4\354\262Vz\221e]\311#K\311\265\202\275\257N\b"
+	.ascii	"T\035\276\367\347\bDK(hC\257\307\225\\?<\320z(\267\256\334\361"
+	.ascii	"\273\356\020\246\032PY\037\001]\373Wj\375n\373co\006V\326G\300"
+	.ascii	"\216}\004\320\260\262Rb}p*>\t2#\206+\266\244L\357\352J\254\261"
+	.ascii	">9\247\254\225"
+	.ascii	"9\224KYL\320\220\020\360\342\351IY\365\301\tg\260\205\033\272"
+	.ascii	"\252\262OtV`I]Yu%\225\b%<n\231F\244\344(\353+o\340\036\035^O"
+	.ascii	"Y+m(\247vO\223+\256\023\242p\340\022A\202\222\250\254\201\334"
+	.ascii	"\t\023[\312Z\031\245\244a$\222\004H\t\215\355Ud\346\304-k%\324"
+	.ascii	"\tL\224IOR6}p*>\021r\004\302\230\224\2253\245d\272\262\351H\205"
+	.ascii	"d$+\353\017*\227\350\246\350T)\227\224J[0pv\262\336dT\337\220"
+	.ascii	"\220rF\226\362\251\2021\226\365O0\262\177\345\221\362HSi\034"
+	.ascii	"\352;\324\"\366\224h\344\342F\364\223\365O0\333\277\022\206\022"
+	.ascii	"\2062\206\336\241\276E7\0209QZ\213+\034\222\2652\306\t<\366\257"
+	.string	"\374Q\376(]\240\020e\b*\t\327\332\216\026\257\013#\243O\213\027<\262.\312\305\264\"Y\207Y\377\204\252\375\334\027\204\311\376\260\224-\224+\374\224-\224@'\034\031\242rS\022)\207\224B\230\252l\241d\021\342\203\256\n\211\tn\375\023\204\366O\320\331?\001g\337\204\304}\023\f\367\237LL&*{\230=D\256\220^W\365%2\342\201\033\345E\fCe\217\222\207\310/\017/\353\235l\203\n\331T\3267Ao\177\004eN\322P\211S\244b\271\020\205\250\324\301Te\216\362E\016.\341\314\320Z\211swi\tO'\353\2330d\337\204\264\375'\t\223\204ID\374bA@\317\253\372\022\035y\240\224\"\344\007+k*\312\035trI\262\276\t:\366\377\344\024LM\036&\013\223\207I\303\244\024\013t\3367g\311h4\004\225\004\351d\205\217\037:)E\006)Y_Y\337\204\242\375\003\034\356\037"
+	.string	"\212\240\240\227\233G$GV$J\024\256\234\302\261*Y\377"
+	.string	"a\373OV\223\325\244_\r\253\242a\241\2217\353\037\300\306\376\223O\222O\222~J\275*\037#K\027\211xn\331,Y\244G\033P\022J\366A\354+r8\304\307\227\354\213\243*\201\320B\212\360\370j\362d\337M\332\337\323\001|\222K\222K\222{\031\274\275G \364\233\367B\210\336\223{R3p\276V\034w\204\204jY\337"
+	.string	"Uv\022/\211\327\"\022fPD=\002\001\r\033R\312\372\006\bL\222\274Kbg\307\002\022\031\340\311\276\001\222\314%\221\314%\351\350\216\034\t\304\332\203\343\032\262o"
+	.string	"1\270d\021\270\244\234\\\\\\\256\303/\321\373\036-@\207\017,\003l\355\033"
+	.string	"\252-\371\326\226\0342\304\315m\002\244\252\001\\\354\227\200\b$\031\004H\256cc3\022q\213\262_\302\035ZR\r-\271\366\301'\327\322\322r\335\306\361\320\204U\202\334~\tidI3\262\\WV\226\353\316\314i\003\357J\330\332/!i\377Ij\222\272\231\214\\\b\205\230\b\262v\200I=Y\237\204\274\260\260,\204\302\224SN\216\006sOF<(\222\245]\315\310\372$\374\330\177\262+\331\225\374*:\241H\220\024\223\341\037\027\240S\326I/7,\355\b[\326'\301l\237\004*W\222\213m\342\"\004\300*\t8x\360`\231\240p\344\224c\024"
+	.ascii	"C!\274/\303\302\301\032N\262\376\bU\222Z\230\232\324Jn\001\022"
+	.ascii	"\231!\235\264\364\300\202\262\376\b~\373O\352H\352(\356\354\025"
+	.ascii	"\357\013\225d\204\023\n\353jZ\335\365\310\372#\200]]\345:\017"
+	.ascii	"ZN#hYYe!\020oN\216\006r\324\021h\354dU\262*\327-`G\037\326\322"
+	.ascii	"\215\033\271n\202\267\273\021bD%mD%\245\330\367\305T\247!\242"
+	.ascii	"\367\210\bD\222F\222FR\n\277DvX{p\206"
+	.string	"5\236\224J\363\033\n\272\341\347CW\230\365G\340\331\027\001\312\376\223O\311'\366\256\370\363\276.*\320\341&\202]\262)\331\324\"\"UEp\333\177r)\271\344\243\200\274\243\357\007\227\030\022Rr\006\2217\351\311\031qH<f\\%\213\222EI\031\025x\305xRF\231\030\341W\326I\030Y\250\f\351(I\326\311\027\331\247\352\3160\353\244\213\354\263\234a\205\244-\353\244\021SPPr\350\314\nz`%\205\236\034\n,\202R\225u\262E\026R.\255q\301 J\366${\222@r\357\036\034Wr\305\223@avS\202\262N\376\030o\250\335\330\301\312:\351#\302\016\"br\207\225K\352<\271CD\307,\353d\016&+\243r\370\224u\022'\371\272 \254\202#\353\017&\337)2\214\252\222/21)\215\307\2173\\C\316\307\bY\205\245\022\025\272\320\313\372.\207\207\207\0234\335\375m)R0"
+	.ascii	"saRX\210\201\027\226\213\335 \0259hTry\337\234\253\n\232\356"
+	.ascii	"\366\340\f]\206T\253\310\300%\f\264\336(G\006\372\341\036\205"
+	.ascii	"LK\262F\002\272\240\371\371\275.=\366\217|\202|\202\354C\341"
+	.ascii	"H(\357\330\233k\222\365]\242\366\217d\302\004\331\267u~\234^"
+	.ascii	"\027\037\350\210\022\310\n\")Tb\253V\264*Y\207\310&H>$\323^\213"
+	.ascii	"\261\002\030\t\021\311\372.EH=\244^\213X\024\302\024\344\035"
+	.ascii	"\362\016\231\367\0250*\022\357\310<%c:rY#\225d\244\367\r\213"
+	.ascii	"\022\002\024d\222$\232\352\303\213\003\030\202\034\326\335>\362"
+	.ascii	"\bF\322!\3510\031\246\276C\254\215;#\036(\371\376\204\\d\375"
+	.ascii	"\020\214\354cL\306\036)\207\221s\310\271\342\216\003\336\034"
+	.ascii	"#\r\342\356B`\333\307\305\035\266H\221\025\271\327\f\016n)\347"
+	.ascii	"c\310\020$T\033nn+;^'\244\020\244\220\\\267\344\264\007\307\025"
+	.ascii	"\302\213\2633$\333\222\321\005\026\222\315O\203\0267r\262F\376"
+	.ascii	"p\241`\360\301\310\032\271\206T\323tx\202RjRZ;d \325\220iC\252"
+	.ascii	"D\001$d\267\246\242\020A[\377\262\213&7\374\262~\b=\373G\226"
+	.ascii	"a*\262l\355CA\315\351-2\301\013/J\251\bd0/I\326\037Q86fW\335"
+	.ascii	"\203"
+	.string	"3\034\341\207\374B~!\305\224V\352\250\310\260#\305\342\242\224\315p\313\032\t\226\221\370\260\376\366F\324uu-\305\336\270}\021\030\331\343H\036H\256\307\341\327\350\305+\236\232\016\253/\321\353\301G\250\355\217\360\201\334\201\334\201X\035\201\003\211\205\251H,\244\326\372\363\276/L\260sBf\345:)?\n\221:\366W\331\230\027+C\360\f+\353\217\220\221#\007\253\3454b\005\016\034+q\357!\025U\256\233`\311-pj\252E\\!\202\325\204\006\r\244\324\212\030R\3527\236\300pR\007\005\225\353Z\027\"\210\354\037\331\324\204t\3221\244\213P\253%\371\024\356\254\214\321\250epY_\304\0322\0062\006r\211=tR:r\311\305\f&dY#g`2%\237\331_\221\254\221I9J\262p\262\376 \022\311\311\237\214%Y\377H$\344\022\273\245/\271\251\255!$\244\214\265-\031\243\247+-\353\213"
+	.string	"\333?\362\005\362\305\032e\002\221W\304\016\244\021\322(\327\365\270\333\203\343\022\341\204l\201l\201$\252\243\356\301q!\207\216$\272\037\326!\346\345\2275R\250\303\025\222\217\210\027\310\037\344\017\222\305\240\333\036\234!\022\350H\026BPVM\262F\2560\336(kc\213\023\202%\210\003'\353\213"
+	.ascii	"B\352 u\220=]\023x\275H\236#{\2147\272\\\240\331e\215\334\351"
+	.ascii	"\302\263\301\004\002\342\376\2218H\234\255\365\303B\257E\365"
+	.ascii	"}\351<\330eU14\276*U\216\211Bj"
+	.string	"\fU7\327Z\316\026\224\030-\225\246\2437\353\203P\267\377#\025*\272O\347\220\2758\306\032J>F\f\r\331j\314e}\020\326\3665\025>J\371E(\341hx\234\242\251P\320y_\246\251\tv\270\201P\266\017\202Waa\2138\301\016,\020\246\374\356w\034<\323\005U\360\307\301\226&NwY\037\003\263\3172\n\240\224\250\254\217\177\307(\254\224\034AbQ"
+	.ascii	"\001w\262\262j\274\035hJ\334\253\026\235\326\250\031"
+	.string	"\204o\031\331\327\240X\326\007\201\350\311\223\343\033\025\004\237\276\276c\342\341q\357\270w\344\303\301\026\035\231\374\310\227}V\242\300\025B\002\3630\365\230w\\2\207\0056\304\002.\353\177\300\267\377\243\022L=*1\306@\341\310)'\307\204\036YQJ\206\325\"JlY\377\2038;\273\\w\346\022\213\034\365\003\266\271\317\035\353\216\211\224&\320\"\242\373\261.nL\356IY\326G$\331GF\235\214\304\254\217G0\231\327\213\265\036\037p\355\377(G=\312\031_\240p\344\204\023%\004\260\261D#\345\327\317\0076\342\342r\235\007\"\0370\261\261\035\211\260H\325=8\256!?\022I\301L\250+\353\343\333\356\002\342b'\353\243\333\261m\371#\250I\2226\234\027\367s\324&\204,\350\251K\b\337\240\013\004\022D\257@\026\006\271K\314\372\037\b\225\225\035\177\2544a\255\375\370\003\305\034]Z\326G5\022p;"
+	.ascii	"\263>\246\035\321x\002\233\214\240M\335\021\322@;\353\321CI^"
+	.ascii	"\342\0072-\246\243YQ\211\023\237 _\326\377\200\207\212\251G\352"
+	.ascii	"q\314\375y_\027\037 \2713C:%\001\004\242\303\260G\217c\330\362"
+	.ascii	"\215\n\366c\230q\257I\0065\353\343\027\033\210\024\247\225\365"
+	.ascii	"\321\353\330%\346e#H\227\376\221\205\026\327u\364\361\325\323"
+	.ascii	"$\304eD\002kr\301U\334\302=ZU\316\234\344\310q\334\321\"!\332"
+	.ascii	"\372qG&B\242\343/\353\243\226Q\354\253l0\353c\326Q\007\333\003"
+	.ascii	"h\013L\307\221\t\226\033\241\216\037\261\212\2449\321\351p\333"
+	.ascii	"rl4]\025\247\212\206pzUEj\3248\3420\202U\367\340\270\216U?\342"
+	.ascii	"\330eO\207E\262>Ra2<\210\2635%\353\343\215\343T\224&\234\031"
+	.ascii	"\307\251\225\n\312M\3578u\264a\244C\370\"-\363\374\232\2708J"
+	.ascii	"\025a\004REy\221\365=X;*\035\225\216QG-\247=8.\250\037\243\226"
+	.ascii	"Na3\226\262>>\255\325\272\274\265\254\217N\307&=\344g\220\251"
+	.ascii	"i)\006\267t\326td\302i\2323$\3128\334\212\264\035\227\212<]W"
+	.ascii	"W<Y\337\203\260\243\213\243\213c\3221\360\210\364c\022\224\272"
+	.ascii	"$~Y\037\2170\031!\023\215\302\254\2172\2161\242\260\2658\306"
+	.ascii	" \332\222qx\214q\204Ae\t\210\353\320\225\222"
+	.string	"b\362\036_\344?-d\350\275\221\365=\300**2\376\341\367\307\005Fu\306\320\220+\204ax`\324\242E\213X\002\"\226\007?\373\330\007>\002a\352\021\350\310\002\027\275o\316\024\006qDJ\036\024\361\324\356\210\366\025\322\251\017*\306\212\304\343\317\361'\327a\200\350Tx\3549\366\030\337\244\204\330\333\377Q\347\250s\334A\341\210\354\305Y\251\021\344c\304\360}\225<@BY\333\221c\361\220I&/\016a\314!\"\036q\232\336\343\373#\316r\347\311\216R\326\306D\343\215|\327D\b\222\254\215U\212.x\230\034i* #\"LY?D\332\341a\213\210\023\337\035R\244\344@\024b\n\020\320X\270\004s\"\274\261\360\257\202\003%\227\265q\220\205\2436>\301\377.\322H\030\330\017\243\2401\260\247*U%\206\005\327\200\344\242\344\2567Y\362#(\353\207`r\342\304\370\207\337\237\"7\277\033\377\210p"
+	.ascii	"\335\2626B\301dA\374\336^dm|\242\251\006\377\376p\204\b\322\323"
+	.ascii	"36\301\357\233\350\306wc\023\345\0238.#Y\033\231d\244UJPY]\326"
+	.ascii	"\306\275\307\265H\222D5E\311\313\003k\205\234h\2441Q\242\004"
+	.ascii	"\310\212D%DG\235\235]6\3238\315\235\227\206\020\254\367\245\363"
+	.ascii	" \033\301\233\002\225\365; RW\227\315\266\316\217SNT\007D-\252"
+	.ascii	"\222\030\276/\235\007\305\271\264(\277\254\337\201\024\022$\271"
+	.ascii	"n\277\257\207B\267\031ss\306 \373\245\342\031\325=8\256\016Z"
+	.ascii	"\310\311\031\323\252\200@$B\304\030\307|u\230\340\300z\217\210"
+	.ascii	"@8\275U\341\360\214\232\274Y\037\304\223\2666\343\333~\337\027"
+	.ascii	"\207\372\016I\251{p\\n7\276\355*M\232\bA\344\001\001b\f\202\337"
+	.ascii	"\237\022\220\356\330n\f\242\304\251\211\221\254\237\374\272b"
+	.ascii	"\222$\353\203\230\333\277q\215j\\\313[\305\2377\007\212\2048"
+	.ascii	"'\252\007\007\321\266\215]\306.cZ\342\330\215i7\242\211P\302"
+	.ascii	"\375\224\370X\375d}\243\231\361\354w\263\216\0337\306\262>\b"
+	.ascii	"\265m$3\226\375w\3332\250\247\272\254\237A\220q\240\234\373\221"
+	.ascii	"\202u\210#G\326Fj\366\331a\332\013\313\372\203F\261\365\354\r"
+	.ascii	"\t\241X\230\022\236*B7\206\031\275\214`\325\241\304\242\257\337"
+	.ascii	"=\272\321\250je}\020:\366AD\355\203\220\261c\207\221\213uz\337"
+	.ascii	"\267\347U\361\264c\256j\344\302d;\311\333\226#k#\217\214D\003"
+	.ascii	"\216\207\t\304\n\035:\214Z\230i\202\2717\353F\255\214\264\374"
+	.ascii	"\213\022\326\226hu+\343\3251\221\022\213\344\224\343\306\253"
+	.ascii	"v\311\017'K\331g\331\343\220\305^a\215\032\306\252(\005 \342"
+	.ascii	"Fuc\225Pf\202\230\244)k\243\224\361\306\177\027#\301\023\244"
+	.ascii	"b\274a\234j\023\003\304\3130\362\n5\256\257\034'Y\333x^\361\277"
+	.ascii	"Eh:\212p\260d\033\233\214M\306(\327\005\254j\204\2721\312\350"
+	.ascii	"$\350c\230\265\361\t\223)e\314!Q\313\332\350\364\277e\022\231"
+	.ascii	"\227\336\037\020\254\026{Y\237\003!P<\240\214\262VZ\t\335X\312"
+	.ascii	"\3328\303hc\013\007\225\254\317\201\330\376q\031\225MBEWG}\233"
+	.ascii	"\361h\f\353}_&\262O0\210Z\326\347\300\307\246\266c\177npF\030"
+	.ascii	"H\366hPe}\016\252\266\321\305\007\026*^=\262>\007M\333Xd,\312"
+	.ascii	"Pg\276\357\253\243\312\201\213\375\033\201\250F \343\320\n\321"
+	.ascii	"\003x\252\2527\n\3358\364\033Y\030\2030\231\337O\030S\326\306"
+	.ascii	"\026.7\nA\225\021&f}9\314\302\256T\026\366\034\354\354\337\330"
+	.ascii	"s\343\212\337\350c\374\311<6\260\200[\322\227u\021\013w`\r\200"
+	.ascii	"YX#\217\313\215=\306.9\300*Y\227\200YX\243\316\316\223R\003I"
+	.ascii	"\326\337\340o\033s\022o\304\371\367\020\343{\\\201g\370\"k|W"
+	.ascii	"\305\345nbK\365\004V\225u\005T0\325\245\302\006\271?\357[DB\234"
+	.ascii	"\033\221\007\337@o\273\207\277+\305\235\322\026\211\032R\227"
+	.ascii	"u6\304\035\330\021L\\\356\032\"\325\240\252\320\006\357\026\376"
+	.ascii	"\372\210Kh\325\202\352G\326\330\rw`w\232\313\335\3016/;\032Y"
+	.ascii	"\273\202\277\313\303\r\fR\210u\225u\306\302\035X\027\320\345"
+	.ascii	"n\224\\\227#\247)\353\002@q\375\334?\263#%+\262.\272\341\016"
+	.ascii	",\0020\013\353>q\271\013\245\312\343\2420\353\0230\013\353:\371"
+	.ascii	"\335&n\237\022 &\245\2545\026\356\300\036\r\263\260.\023\227"
+	.ascii	"\273|BWOr\262\376\031fa\335\275\177\323\271z+\325\013!\205Yc"
+	.ascii	"$\227\273K\246p\360h\303\303c\343\220@h\037NvBY"
+	.ascii	"\177\203\037\373w\357\356\\\026L\243\237\235\027e\267:\231\343"
+	.ascii	"\001%\353o\260\225$\t;\267uv\336\234$\r\360\021Y\013\264#::\367"
+	.ascii	"\210\336aRw\242Z\270\371\351\005\312e\375\rx\366\357\316\315"
+	.ascii	"\271G\364\016\331[\244\364y\222j\013\262F\247Y\034Z^\\9O\231"
+	.ascii	"\022\316\351\r\f\031x\220J\237\321\0235Q\031h^\260\231\271YA"
+	.ascii	"\ne&w\f'\212\037\232\036\216+\307\016\026x`2\221\037n`\220f\360"
+	.ascii	"|y\332\250\250\341(DHQL\23534Pg\324mM<\245,S(\315\013I\032n\220"
+	.ascii	":kxN\235272N\022\323'\r\003\210\2216c\234\306\0234\320)\324i"
+	.ascii	"\201\031d\260\221\316\264L\237.\330HgV\216B\004\314\b\030\023"
+	.ascii	"\032\240\200\371 \235AF&\005\r\216B\304s\006:\235\276Ha\220B"
+	.ascii	"ed\2403,\r\317\016O\022%\236'\234S\231\232\n\250\210>\247S\247"
+	.ascii	"\n\323\347\211\346\rR'\f\322\343\314\023\006\024'\240\016\270"
+	.ascii	"\001\3069}\001\001\224\006\031\347\264\246\206\033"
+	.string	"`\234S\251\362(D\314\324Dm\236\317\227'\b\240'X\230\322\024\246\317\023\035@0\205I*\237\317h\013\322\347T\205\n)j\220\201\002\231\232\350\224\246\206\304\224\346\031\215\336\220\230>O\b \206\006\332\302\t\0336\346\205\0245*\250P!E\215\n14P\023J\230\032\231\227\022I\351\n\037n\220:a8F\235O\031\022\323'\r\306\243\020!\26591\242\006js\242\345(Dt\230Jij`V\230\032\231\227\350\323\306\346\246f\372\362\264Q1\205yya\221\316\260D\266 B\nS\251\323D\353\254\231\232\32055\244`a:\301\363D\322fF\205M\333a\306\031\303\023\206\346)\003\245!YC\264\246\005\017G!bD\r\024\031}\332<\237%\330\243\020Q\003\363\264Q1%\200\263f\n\3250H`\006\031X`\341\b\235\221\3228\2435\240\220Bi\240-\324\324\020\255ia\nu\346P"
+	.ascii	"\251\214L\n39\310`S3\2252kj\360p\024\"\2162\304\320@[\250\340"
+	.ascii	"\371bT\201E\205\r\314\314s\206}\312\224p\312@\2358\2440\215\326"
+	.ascii	"\310 }!:\225F\247RV\205\n14P\023\031\320@\363\264\251Q>cj`\230"
+	.ascii	">iH>O,\243S\251q\372\224\316<g\330\024P\030b\2345\021(\001\225"
+	.ascii	"\211\201\326L\235:\372rC\3154:\225\356(\n\230\th\2362\321\251"
+	.ascii	"\224\215N\245\036ddnhhjh\332g\364\306F\333\314\300<\245N\030"
+	.ascii	"\232\350Tz\234\276\324\230\240A\326\230\240\231>O\034\247/"
+	.string	"&`\2325&h^\200\241\271i\341\006\230's%\207\232(\212i\rMk\302\371\224\32114\317\027'\016/4\320\227\027f\f\315\323\306&\205\345Q\2100Q\001\007\\40B\007\326\251s&Zc\342\305\306\304\324\210Bz#\323\2022F\352\264\3003\246f&\nu\262<_\222\323\243\0201\202\246ff\246\006\006\007,}\301A\212\302\210\002K\261\224\235\256<cjf\214\323\243\020a\003\215N\2451O\231\0215\320h\215L\r\314*}\221>;H\243525$d\234P\230\247\2154y\302\t\203S\005\01700)LP\023U\341\202\207)\224\346\005\250\fL\033}NiX\200\312\300l\251\364\t\303\246\270I\001*\003\223<J\2450@e`V\214M%T\006\246\203\261\271\227+P\031\030\n^\2363\320)\315\315\004S\232'L\364)C\214\263&\002\037\24600\316b\324\231CL\324\351"
+	.string	"\226\243\020q\2014\346\031\263\224\332\250\250ay\024\"\"P\303\0134\214\270\001\246F\206\3043ZCb)\275\231:\247\354\364\351\002T\006\206\rA\3044\352\264\021\341!\207\232\030\032\250\005\2222\250\260\251!\301\264yNixNi\2202S<c\260\231\271\211I\236\220\301f\346&\346\230\342&\205\243\t\023\320\026\251\302\246\206D\214\222%\206\346\031}9a\363\362\322\224>\24165$j\2464/Hc\23452\023\334"
+	.string	"\363D\201\002f\352T!\246-q\234BS\260"
+	.string	"\225\201i\24120F\251\215\013P\031\230\246\215\023\006\250\f\f\233\002\n\3031\3469\023uJ\2411/\321\232i\315\2142Z3\255\271\261\231\336H\340)\215:m\230\317\031g\fP\031\230\026\031\202\210\0241/L\245N\031e\f\315M\r\r*\2342\322gL\r\f-P\031\230d\364\031\343\254\221\231\326\324\250"
+	.string	"\225\201I>qp\322"
+	.string	"\225\201i\335\024,\314"
+	.string	"\225\2019\2722N\350q\032\255Aq\342\246&\212b*\225:[\242\316\nD\235\025\230\2724\320\026\24020\310\026\343\2143\006\226\325E\304T\006zS\242\255@\214\ftEz\"\232\202\207\r\225\2019\236\210\2460M\361\244i\215+\321g\212g\324i3SC\002*\003\303\302\224\336 u\326"
+	.string	"\225\201\3313,m\2340l\351s\306\031\0032\205\226\0243 \215I\250\fL\313\324f\246&f\006f\333\310<\035"
+	.string	"\225\201i\2374\320\b\240\220:\035 E\326\310 \215:eh\"i\240Q\033\267\031\255\211FY\2709\021M!\207\032\0244@e`(x\3168c0>\247\316\025\2363\320\032\334\243\020\201\303\210\030\031\350M\211\031\246P\027\230\025\200\312\300\030\223N\034\2261\317\247\211'\r4\002\314\355F]\251\364\t\003\343d9\340\242\001\227\016\254\001\200\226p\276\340 U!e\236p:qxyI:q01\245\201Fe\200\312\300\034c\2425\026\230>O$\2370N\033\032l\2407H]\025S\233\031\026\244\320V\002637+L\237'V\24627N\023\317\025\2442\316\233\017\260\020\235\312\320a:u\326\310\230X\247\323\351\215\004\216P\031\030\345\363Ez\302)\323\302S\246\204S\n]\301\331\002\225\201q\001\320\241\002\02565$VZT\330\324\220H\252\260\251!\321\034\200\006"
+	.string	"\260 \003\001\250\260\251!1"
+	.string	"\r\244\321\347t\372\214"
+	.string	"L\224\271\204\301\202\025)\211gL\r\f\037.E\341\324,\321\347\314\215\324\203\224\206\231\232\251\364\006\346\202\351\313\023\004P)\373|\211y\341\006\251\263\006\0230F\032X\2466\323\033\031\24020\355a\240\321'\315\363\304>\t\006"
+	.string	"\301"
+	.string	"&\244h\247G!B:uNi\210\241q\316\314\324\220\260\221\3164ed\2340\356Q\210x\312<\007 }\201\201q\256\323\243\020Q\200i\222\246\205V\372\262\022\343|\316pc3\323\022\235\312@\323B\364yc3\323\201\246\205\347\024\032\315\241\215\336\334\330\3140\247P\232\027hZ\230Bi\240lt*\003\f\315M\0131\316\347\f00)\264H_px\256"
+	.string	"\003\343\3344-\3048\237Qv*}\201\332\320`\342\271\302\323FE\r//\310@\303\361\tC\343\234Ji\240{\372\"\201\0274\rT\006\032)\f\013\265\221\026\217B\204\364\246\204\364\205\204\b/\034I\210\360\202\033\303\302\210"
+	.ascii	"-\336\274\340\360\214\221\336\224\330\322\227'\f\024\207\347"
+	.ascii	"\n\322\233\022\307\247\215\212\251\364\246D+\275)Qt\301\345\005"
+	.ascii	"\006\306\311\346\340\234\201\304\n)\260\317\230\032\0228<\243"
+	.ascii	"H\0251\316\347\f\316\2513\306\235._\332\243\0201\205\271\211"
+	.ascii	"N\245\"H_R<\24773\315\033`jd^^\330\2276"
+	.string	"\372\244\311\241\346\345\245\225F\237\322\033\232\227\227\035C\003\275\341\345\205\225\322@m\244//-M\rT\n\225yN\245P\031\246\215\212)\b1\317\250\023\205\024\204\021\322)\264\304\210\033\232\023 \244\270\241\201\312\200@\202\001^\f`B\212\021\317\230\033\031\030\032\350\210\250\364f\304\t\323\024O\032\031'M\3649\245\201\276\3048\237Q\024S\233\227\027\0178<\2436//\354T\n\225yya\235Sg\314\313\013\373\004\001T\372\362\302\336"
+	.ascii	"S#\243\237/4'\2402\316\027%\315\t\250L\n00\316==\n\021763/5Q"
+	.ascii	"\025'``\234\035<_f\b\241\204\020\fpc3\303\"S#}F\215\322\227\226"
+	.ascii	"\347\013\r763\307h\215\224\346)e\24727\322\347\f\323\347\n76"
+	.ascii	"3+8<c\212'h\240263N\032``\234,-\212iM\315\f\r00N\367\tC#\201"
+	.ascii	"\251\324\371\214\3004\205\030\n\310<a`R\220B)`ch\236\305\351"
+	.ascii	"Q\210HQ\363\002cb\004L\314\013S\232'\215s&\372\2649J_R\324\224"
+	.ascii	"X\327\347\2143\206\0245%\332\251\364\205\246\006:\205\306\320"
+	.ascii	"\324\220\240\251\201\316P\360|\211y!EM\2116\346\205gL\315\f+"
+	.ascii	"}yN\235S\032lfnV\200\312\300(o\220:a\260\231\271\211\3311\317"
+	.ascii	"i\3249\245\341i\203\234\322<i\220>\247*T\260yN\245\311\351Q\210"
+	.ascii	"\260\271\251\211\236x\211>\247\317\031g\324i\243\301S\372\234"
+	.ascii	"\341\204\315\221\306D^\245\320\023\317\031N"
+	.string	"\330 \237 \200J\265T\372\214\306\3048[\025650::\265)Ni\240\001\230FkPHW^^\334i\016N\025\310\247\314tZ\023E1\335225Q\215\002f\n\265Y=L\243\317)\2143\352D\001\3632\255\251)\361\2142\225S\025\321\351s\346)\363\234\256\334 u\302\200\264\221\316HmN4\247\316h\314\215\263\304K\212\232\0227\3008eJL \215\326\330\034A\200\342\3459uF_\236Sg\214\315\315K\207i\263\006\372|\231@\372\362<\341\224R\240i|\276\264\230\330\323\227\350T\206'\016\320'\314s\206\0177\3008K\310\3108I\244\210\032\245/\310\nL\243520q`\241\306\347\3133\246\006\206i\264\306\306\370|\221\3004Zc\223\224\326\264\317\251s\206\230\033g\211\375\004\001\224\206'\b\2404\354\351\216\"c\234O\007\310@\2355D\237&L\334\250\220b\212<\n\021"
+	.ascii	"H>S@g\334\027i\264fZ3\363\222\203S\005\313Q\210\210\201\332|"
+	.ascii	"\210\201\332\034gjh\2361/R\351\023\246&j\363\022\003\265i\036"
+	.ascii	"\205\210\350S\346&\346\211\002F*\200\351~\3168c\270A\352\254"
+	.ascii	"\241\304\215\364\310\202\024\352\252\230B\2435\320\250\f0\312"
+	.ascii	"\230\032h\364)C\3143\n\225>c\222\323\227\347\ftz|\316@kpNe\236"
+	.ascii	"+L\245\317\251Sf\231\3029\303\224qNk\246+\323\027)\005\2363\320"
+	.ascii	"\351~\316@k\240\251\201No`\236)Xx\236pF\23788[djjTxYg\236S\251"
+	.ascii	"\n\2512\006j\263|\312@M\324DexN\2353<q\200Na\234\315\0237%\236"
+	.ascii	"1F)\ft*\205N\235S\351\313\rR\347t\371\234\201\326\360\204qF]"
+	.ascii	"8A\003\235\211\246@#\201\3503\207\032\233\t\242"
+	.string	"O\250\t\350\224\346\031\363BL\324YSb9\265yN\245\372i\302)\225\201:[H\021\245\340\031S3\243\247)n\234/)\2343\313\250\321\3069\003\023]\243\317\030(\0165Q\233\227\024Q\031'4\372\2246ij\240R\351M\t\2512\305S\306\346f\005\0232N\024F\231\032\230\232iM\324f\031\003u\2474750/&\242/P\033\351K\212\250\207g\f4\032}\342P\363B\003\r\300\364\245=\341\254\241\006\372r\342F\306\346Cs\372\224>\2435\323\033\347K\f\r\264\304\313\324)}\231\271\211Nox\332H+@>e\2340R\3434\372\304\201\006\372\002\225J\243G\230h\ftf\245\201\316\354\033`\236(`R8g\366R*\343\304\201\246\006:u\312\324\330D\237S\232\027`\242\036\244\317g\364\304s\205\247\314\t\232\024f\234$p\2601\261\022#S\203B\372\214\242\250\3419u\342"
+	.string	"\235\302\244\360\214\251\201!\nu~\240\201\302<\2457/)\2343/)\242\307\250\023\005L"
+	.ascii	"b\2364'\240R\232\233\344\364(D\214\260@\332B\314S\246\204\223"
+	.ascii	"\346\271\214\336L\235O\023\313i\006K\351K\363\306\271\234>cj"
+	.ascii	"f^"
+	.string	"`\2426\317)\r14\317V\372\002\243\264yNi\230F\235S\251\373<A\343\214\25645\320)\f\315M\013S\232\347\314Tz\343\201\030\347\n\n\230)4\007\032R\3348;L\217BD\212\350\210\024Q\351\t\032\347\f)\242\023Lgj\242-\304D\2359DkL\254H_f\234Q\247\f\323\027\021F\220\306<\245\321'\016\317\350\362)\023\023\003\235a\247G!B:b\212\342\004T\246\202\0245%\212\322\227\3503\005\024\206\032\034\242O)R\346IC\343DAb\372<\021uN\223O\230\350M\r\r\323\033\033\032\350\3619uFu\314\363i#]\247/130P\031\230}\030\021P\231\026\030\232\033\023\232\246\006:\265\201Fa\244\317\230\243\364D\324\251\247S\232\233\032\022F\351\213\212\350\224\206\005);=\n\021#`Lx\230\326\310@m\222\323\243\020\361b\342\246\304\bi\364\211\0034\032\023"
+	.string	"\347\324\031\243\245/\321\343\364\3459\205F-`\342\246\2041\372\234B\2439\260'\242\316\242\212)\024\306i\343\204\331Sg\236\276<od\2348@e`\2147{\372\224\2320Q\303\306<o\200q\332\260Q'\n\030\375\234q\322\350\247\215\212\251\236\336\3108+"
+	.ascii	"\225\201aNeX\024\323\0234\317\b\250pF\243)@e`&P\341\214F\235"
+	.ascii	"\353\364\371\"\263\222\342\031C\363\302S\246\204sj|\312\224p"
+	.ascii	"\326\020\001\250\f\314\004677\324\324\310\260\323\243\020!=A"
+	.ascii	"\003\235N\237R\n^c\363\214\216\230\326\324DG\034S8g\212\322\027"
+	.ascii	"\022)\2340\320@a\200\312\3004i\2403\305\024\316\031\032\350\f"
+	.ascii	"{\002j\202\246\006\206\235\276\320\234\260YiN\330\024\247/\006"
+	.ascii	"p\231\322@[v\372b\302\224\006z\323\376\204\023H\004\200\0021"
+	.ascii	"\270\260aD@e`F\300\230\030A\003u\316\214\200\211JG\210`\371\337"
+	.ascii	"Bm\256a91$\277\226\256\226\256\226\260\271\026\257\267\204\265"
+	.ascii	"\200-\235u\375\265\200\265|\345xCR\314\253\233R\213\300\320\376"
+	.ascii	"[|4\3130\224\240: \\\356\341>\332\013\244\322\222\325\222\325"
+	.ascii	"\302#p\203<\037LTZx\264\354\030\373\222\321\325\262\243e\213"
+	.ascii	"\314(\fqS\361\210\260\212\264hi\246\253$YN\262>\004\016\367\337"
+	.ascii	"\242c\020)\205\n\217\254\245\252\245\252\345j\255\005\307[\256"
+	.ascii	"Zr\370\234\025\261\312\321b\305\202\260\n\326\347E\226\267\377"
+	.ascii	"\026\252&\021%\220\236\037\202-7\214+\224\2023\302f\264L\031"
+	.ascii	"\207\222;\206}d-6\232t{Rco\246~\005\201\361V\243\331&\302\036"
+	.ascii	"V\013\032G\026DTU\304Z\242Z\2402\317_bW\013\324\357Viyr\237\334"
+	.ascii	"\250A\262\306F\234\2148I*\202\206RZ\232"
+	.string	"Z\230\316t\020\211\275\205\351\337\201-K\231\307\206&2\262\243\2541\021\356\2404#Y\305\033\3139z\313\214\277\005\251%\251\335\243\302#)\353l\004w`=\300,l\213\f\227\267\034A\365\260\365\310:D\214\026\030\330\352\206\323\223\026\243\267\300\370[\\\264\274Hl\n\342\312\2325\304\035\330\377a\026\266\245\310\345-FXP3\204d}\277\026\"d\340\261GW\020\273\226!d\236Rn\255\205\221\026\241\246\216\361\b1G]K\213\344\214\272\275\352\217\254W\034\252\323\327\373R\227I*VJ\224\264\260h\001\302!\027\265\376\270\323\242k\361i\361i\3719&\312\331\341\266\007g\330\362\243C+*(\353C`\310\376[z\\0}D\225\222\243\205')#\356\006\325\316\221HV \213\036:?>"
+	.ascii	"\244\004\230\343\036\321@l-d\264\340\034\303b$a\343iy\333 ,\276"
+	.ascii	";\033\210\210,U\032\220\366$EhX\245+\216\251\211Y\326\207\200"
+	.ascii	"\331\224),\207)\002kPU\337\243\027 X\016\217h_8f\314\310\372"
+	.ascii	"\020\360\332,\204,\204,\206\\,\205g1l3\203Z1\007\001\250\375"
+	.ascii	"\263\f&\207\b\277t\b&\201\222O\\:/\002\215J\256\216&,\220\242"
+	.ascii	"4\201\324\330`\024\002\"\373\226rQ\204|U&\037\033\213\030yY\263"
+	.ascii	"<ay\302\342\367\002\216\262E\224@BC\026(g\361\233K\362\311*\234"
+	.ascii	"sj\021#\353C\200i\377,N\366\331\322\216\f\021\260o\213%\005\025"
+	.ascii	"\211\313M\350\370\232\034\235t\254\2300\331}\030\310]Um\217\345"
+	.ascii	"\016\371\327\206\344L\017m\317X\362C\t\313\222\027\253\021\247"
+	.ascii	"#a,y,vJ,\3007\037\026\2746$~|J"
+	.string	"\\\034\366(\207\227\240\222,\te\255\216-k\345\017\252\271!9I\232G\323\301\275 u\315\031-\035\fj\026\235\353\004m\250\rI\263I\2371\201\371\035q\253H\270\035N\230\346\366\337\222\253\306\030\017#_S\322\252Zd\271\255\026JJ\217\214\"\256`\214\034yM,qM(\237 78\346\3411\007u\b\017\221+\026\266^\245!n\341\322I\220\236\220\267\346\026\222\266\035=\262f\021\202\205,Y\334X\332\316\"\3446\004E\005\261A\326\330\220,0\223')\" \310\036\026\306\340\341\323\017\243\326F\222FCk\315\310\265\331~HY\2515\213\224P\314\240\360\245!\2114\f,\033Th\307:\300\030p\210g[\313\305\032\nR\304\354\230\210\344q(W\245\314\bgD\314\221\304\220l\310XR\216EL\231\204\311\036_\326\207@\322\376Y\302z\214h=\234\250\201\001\271Bv\320\232\276\\D\345"
+	.string	"k\363\"Z\002Z%\032u1\257\364\033^\317\n\037H1\267-\315\017\b\2271\206RH\336\023\277\036\256\025[\016\265?\036\314)mH%\214\306\216*<\032Y;X\266\230C``r\013\324*\356\254\371\335\261`\311r}"
+	.string	"\351\265\320\201\224\302!\003J\023Vr\317X\303\217\016+\257\350\256)J`\216\274\031UV\350Y\271:V\240\003\302\206\203\211\326s\244I\217\n\005\351\n\n\013\0253\210\362\206\234\325\022\026\033,6X\246\254\246\230eZK\250\314e}\b"
+	.ascii	"\355\237E\312\335z\262\352\001\225\365`\0133\\\020\241\301,\242"
+	.ascii	"\315\236HAd\211b\"Y\301\344w\310\002u\0343\244Z\261<\031\013"
+	.ascii	"q\252Cx\232\316\342t&\223\b%d$\343!\\\336\222\254Y\230\\\235"
+	.ascii	"(\266\273\273\254Y\226\224\207hP+"
+	.string	"\334X\224\230MpNS~\262fAbAbI\302D\t\320\341b\242\302\222d\0244B\3741\230\365\037Pe\377,G,1\244qF\204d\252\223!\020[\356\261\241i\360\350\t\214\245\320UZ\223\335\213c\222\030\232P_\326,EE\226\242\314\342\202\305\350,E\324\226\217\353'\207\325AA,CM\204Z\234e\210E\b\007\032;H,B,:9\fct\351m\226\037\226\037\026 \037,+\316\002t\214Q\304\310\332\025\221\315\222\303\222\303\322\243\301\316\373\366\274 H\324\371\252\262\364\260\360\030\271\262\221\303\302\303\262\343\204M.\t\313\316\377\263\350\330@\324\246\366\006\264\303pG\326\177\200\327fyY.!;VY\377\001W\373_Id\221\254\272\252\332\251r\2142\302\001\265\226\365\312\341\n\225\257 ~\0051\257 \026\023\023Y\260%i\254^\221\222W\fW\246|E\312\251+R2\240\262\304X"
+	.string	"\313$ F\262\330(QV\b\177\270\005~\205pe\260JJ\212\312\312\340\212\240\322/.\247p\257Xk*z\200\222\237\337JuJ\003\257\252\023\245\277\257T\217M\\^P\017 \332\377\n\224\235$\373E\r\241\242u\216\270P\312z\245\t.Abbb\"\225\367\315Yi\302\256"
+	.ascii	"U\364c\346\364\2769+NV\372\276\322\344K\355#\310\016.\226\257"
+	.ascii	"\331u\304\2436\306dY\303,\307\r\244=\367L\206\257\037;zG\034"
+	.ascii	"&\240j\004)Q\262\222\247\347\304\r\357+y\307\251\\\245J\034\326"
+	.ascii	"\224]W\267b'\004\004\030V`\221$_\261kr\215\251\235\325\355\177"
+	.ascii	"\205\216\311u\224\001\226t\204\204)\226\001\271\222\366V\216"
+	.ascii	"\034\227\024\365\230S6a\335\206\304\320\214(\355\\'*F=\344\220"
+	.ascii	"l@\242@\031e\275\262Bd%\316\305\361s\203\373J\034\363K[\365h"
+	.ascii	"\022x\266\333\332V\336n|\2405$J\311\355+oH56\257\272\004\264"
+	.ascii	"\265\377\025!n\r\276\244-\301 \314\2558\034B\03666$T\320\037"
+	.ascii	"\021\220\343\016\266\212\350\316EZ\332\312ZU\b>\236\240\262\324"
+	.ascii	"\276\262v\324\221\244\301\347\344\343\205\250\375\257\240-\261"
+	.ascii	"~\316\224\242\316\\\030AO\330x\314\226;\2040e\331(Sb#\b\326G"
+	.ascii	"\266\221p\311\210S\033[\206ipdI\017\325\235Q\203\206\217\330"
+	.ascii	"\362L\377\241\t\351\n[\276\031\353\254h\330\201\341X\001zM\255"
+	.ascii	"x}\345+J\214\247\031Y\257\370X\351*\366\300\372\321\344P\374"
+	.ascii	"\264\236\f\t\313z\245\307\n\327r\nk\215\310\377^]\032n\031\366"
+	.ascii	"\361X*i\205\274\016\245v,\371\214\207>\272\022\267\226\177\313"
+	.ascii	"&\261\033A\264\220\224wb\2117\262\334%'2*<:\220K-\336\024%F9"
+	.ascii	"r\254\\5i \226\325E\270r\365\213P\002\022\211\027\2650\353\277"
+	.ascii	"\020c\377+Vk\220\244(Kc8v\021\251\274&\037UH'$\323\r\236=\252"
+	.ascii	"e\334\233\r'M\262^\231\312\200LT6|\206u\330e\303}K&*\021t\222"
+	.ascii	"J\356\034\203|x\242@A\255\320\340\n\241\307\335\341W\324Wh$\337"
+	.ascii	"\"\261(p\210\373_yb\002\016*\261\2215\365\013\207*\307J\223\261"
+	.ascii	"I\022m\013\260n\205\t\251\345\226t\306\265\262\344Ru\302\350"
+	.ascii	"\224\226\21199\342\202f\030\257\330\027<\210\246`\300XA\232\013"
+	.ascii	"\301\213\032X$\306W\220V\216\226\314\220\363Z9Z\221\201\207\354"
+	.ascii	"\332\326\\\034\3513\253[q\221\354\371\341\332\313\372\0168\333"
+	.ascii	"+FE\177E(d\211,V\210\334\246\2764:\260\241%\320\rM\244\364\254"
+	.ascii	"\b\035\371\344\352\302\376\262^\371Y\371Y\t\372JUK\005F\324\226"
+	.ascii	"\341{\364\002\304\277\302\342+Aqk\317\023A\274\254W\200\036\267"
+	.ascii	"\017\327\304\226d\275\262\302\001N\373_\361Q\n\2664\330z\354"
+	.ascii	"z\366\232vrjb\302\223\224j\007"
+	.ascii	"\265\364~Vv\334\275b\222\023\271\255\025\235\345\r\344T\320\233"
+	.ascii	"\323J\316\021'\303\030\342\221\270\202c\214\302vT?{+\257\261"
+	.ascii	"\212\210\024\316T3\221i\230\204\210\347,k%\313\003\207\317\033"
+	.ascii	"\342q\247\251M\0201k\275\024\302\033k\2215\325,p\320\206\336"
+	.ascii	"\224\335\226F\244\f+\177)\351BC34\006a\363x\344\230\n]!\245\341"
+	.ascii	"\021\275\025\204J\256\235\307\244\265d\320\230\226L\003\354k"
+	.ascii	"\022lF9\032\006a\3626\003\225a\354\223\213\303\265&\340\021\251"
+	.ascii	"\351\b\224\254\357\200\243\3757\253\312*\301\252\274?c\\\217"
+	.ascii	"\251\036\204M?\343\033\223"
+	.string	"\333\036\024e\323\336\327\n\303'J\254\344\023\242--'I?\244\304,\027\315\276\374\205Gc\210^\263\311.,\262Z\262\204\317\3151\002\322\227\203\311\217\227\"\035z{oL\320\350\326\364\\\031\310\367N\no\t\333\216\3013\206\224\267D\352\354\007\214&\336\0262\270\244\316ES\311\216\022E\324\244F\363nS\341!\242\343\311\272\231\244\231\244=\262\231\270]\341\310\372\016\330\221\223k\322a\262wH\001l3b,\203\b\352\311@\362&\235r\351,\352\007V\326\315#\270,*\253\350H\326\315\271\307\351\2604\030}Y7\215\344\032n\324\021\013#(rTQI\b\343\342\220R\230\354\035\322@\321\241\021\327`\365\305^\326w\201H\363\255\371\326$BE\210\211\340\312\303\350\355\2549\344M\"8Q\311\031\235qG\013\212'0\353\2730\026$H\263\355\260Z$\034\332\222\321\024\362f\333\21392)\027x"
+	.ascii	"\001\322\324\021\313\311\252\322\342i,)\353\273\360\324Lk\246"
+	.ascii	"5\327\210d\242\270\243\247\246\332\233kN\242\200\r\272\020\324"
+	.ascii	"<k\236\265U\177\252\370t\025\206=\254Y\366\301\t'\260\003\245"
+	.ascii	" *%Cw,\247\320\253)\366fY\223\fJ\006N\223\2549&\364\205\030G"
+	.ascii	"u\024\373\302\321\326\244\356\0326\320\240`\264\260\244\371\325"
+	.ascii	"\374r\205x\274\b\254\302\325FF\304-\353\267 \325\344\321\344"
+	.ascii	"\321\354r\n,b\230\024\362\207\310\324\364\361f\327\220\300'\263"
+	.ascii	"&WQ\257\250\bU\223\253\331cI\264\304\307\021\266g\311\214\254"
+	.ascii	"\337\002\216\016\035\315\255)/\376\224\fmL\001\353\333jjIArB"
+	.ascii	"\314\272\231\025S#\r.\353\263P\267\317B\221\0349\232W\037\366"
+	.ascii	"\373\365\205X\325S\200KQ\256\342\202\204\030Rq\340`\036\206\200"
+	.ascii	"_\037\264\250\243j1\247\016\361F\326g\001G\223\252I\325\204R"
+	.ascii	"z"
+	.string	"\321\367\305\265\364\003\351-\353\257@\2459\325\234b\")\"\304D\220K0J\030V\326_\241*%\305D\342\003\013\353\205\022_\036\r\032L$\230\354\035\262y\261g\004\202\317\023X\326_!\353\351\251\t\365\301\t\007\020\204\341\013\2740\366)\321\305\033T\026\252\032\353y:\\Zj6}p\302\001$\001\t\316\241\221af\242\333c\322dz\263I\36382\345\345\370\312\372\203\036\022\253|\262>\211\276fR3\2519#\007k$\304D\3200\b\006\334Vs\206q\307/\211\335\021\270\246\2137c\270h\036i%\257\017'$\244\246\2147\217\214\234\314\336\254?\b\002\b\215P'\353&\214\226\211\036\022\262\254\233/\326\031.\234le}\344\024]\222(Y\237\004ZS\2509\324,*>!\302R\342l8i\026\275I$B\t9\226\247\250\344d\315X\006\253uI\020&Z\214A\304\024\021m\222\004\003\026"
+	.string	"084\032\017\210T]\027\363\024"
+	.string	"\024S\314zt6*\016\244,\212\0304\003"
+	.string	"\""
+	.string	""
+	.string	" \021P"
+	.ascii	"\225M\236\2253)\322I\204A\032\222o=X7\217\250a\376\036\252I\204"
+	.ascii	"\336S\t\362\003A\037\311\030\310\263\222\266/\026\232\315\335"
+	.ascii	"Et\244\211,\217\n\362\207C\206\203\377\216\345\320\017\340\035"
+	.ascii	"\200\225\372\217\250\003\t\361m!\201\347H\217\311\001L2\035#"
+	.ascii	"\347\035\347\332\200ai\337\310\254i\223-eq\004W"
+	.string	"\361\242\341\027\236\214\250\224\371\217r\277\363h\372\022\020\246o\341\325\355\254RA\370&\245\371\034\336\302\232\230\022\310C\035\335\312^\310[\037\016\302\244\306]_\034\0075\333J\001\230T\007\b\203\033\320\305\031\271Q\264\237\345p\022/\371\215\200\b8\251O\"\34698\241t\177\300A\344\357\bc\250d\024|\006*\276*M\3113\243\n\342\324\273q0Y\016\274\246!\235\021\314\245\272[\207\b\221\273\2130e\305#!%L\243\230\340\357W\007\260T\227^jl\321%\007\233_M\257CE\2639\200\310\277jj6\033\346\236\210\240\027~\366\220\306rm\275\002]]\323\333\363\340Qb\3017\t0\212\351E+\177\220]\262\t\301\264\370\b\313:|4N.i:S\225\202>\006\\\241\f=\n\016k\320\210C!\021\325~\0167\264\324\226Mf\306\247*Ra7O\226\253\374\t4Vm\225\230U\325=T"
+	.ascii	"\274\306/\211~;\251^\301V\314WR\327+\f\020\300\2136\336%\307"
+	.ascii	"xj3\354\251\323\305DP8\016J\b\234e\032\n7l+}\350q\324tN>\361"
+	.ascii	"\035\2462&\247x\003Y\221\350\223\034^\203\244\273N\035\322\027"
+	.ascii	"\013\b\013\315\234\213p\306\373\"\b\325\326\022\312\271\3514"
+	.ascii	"k\356z\342M\332\003$E\b\317\264\263*\023J\344\337\301\023\315"
+	.ascii	"D\262"
+	.string	"_\320;i\332\327!]l^\346\300Q|\024?\256@k\265\241\215\330\316WC]\022f\334\213\273u\0274J*\317\370\031H7\341\016q0B\372\334\311\376=\250r\265\017yS\205\220\343\221\302\247\220\273\365Sl<\001v\3137y\375N\372\017\321T\\%\237\322\371Xn\241^\326o\203\323\320Z\341\f\310 m2\317\367T\231O\266\030\257\376\024\331 :\203W\300@\324{#^F\215\346q\003apQ$\273\377\rZ9\325B(\275Z\260p\225\027J+\237i\366\357I\017\330kAt\371\272}\f\231T\036\035\215\215^\344m\362\2265CD\270j\265\361\300\305\362@8\031\235@\031?\267#\220]\221$\376g!\324\302\373<\260\273\300\344\003\220\347\374\243\353\fH\320\"\266\352\301\316\250(\276\356\244v\243\232\024\371\025\337q\304\342\177\244\300\334\r\337\261\240\232g<\347\267'\335\200\017f'*"
+	.ascii	"m\374\263\224Z\272a\242\017U'f\377\013\361\220Q[!^\213C\220\257"
+	.ascii	"4u\030\316Y\273\r"
+	.string	"{\320\333U\227)\210\374;\233\276\247L\247\345\001Vc\b^\327:\243\303\276\211\350\031\204\216g\255\305zR\347\257\212m`\342\254*FW\207\006Hf\217\347{M\346S\261(\306\352\214?\255<\373\353\312\255\305r\036\214\315a\264h\304\025~N\302&\253\265G=4\266+\205\213K\300\220\b\032\211u/\207`Z\330\220W\210S\314n\204:C2\347\213N\242\246\037\376\314\354\263/(Y\023\354\020\277!#Q\236\274\362\206N\034\371\304\221\245>O4\260\035\2232h\337\220\274l\330\352\304b\024\262\317\215\222K\333\253MR!2S\202j\201^\274\336\277\367,\314\212h\216\270J\f\233\247\2241\364J\264\331\350\341^\300;[N\r\315\263\265\3448\247*\356E\315\334\036e\260\354\222{q\353\246\0256\024\356Y\001:\310\245\230\n\214\325{\336\036\240>\202\364\352\022\326@\244\357\220\"\240\252{7\274"
+	.ascii	"\002\025H\216\212\033\267H\242\024\353\027Y\016\312>"
+	.ascii	"v\335,\001a/"
+	.string	"]\026\247\233\024n\261\2735y\241Yc\023\037\215\037\256\307\r\331\224\226\004\217\025u\3637,\345]q^\230S\325F\332\2510\006\333\001~:@\275E\336\327?92e\242v\020\264\032\035\033-%X\265\266;\331\307c\265Iz2\212\367c\314\350-q\032\033\035{\2547\327&\276\306\350i\016}\250\310\370&~x\3425\274\002\275$\255\343\211?X\321\300u\302\224\2739?U\340\373O\223K\246\306&\340\231\217^\025\370\003\006n\362\025\307\n\367\324[|E\305\221\247L\026\336\260\370\022\202\204\236#\210\253@\372\340gA(\321\313\002\353%9\322\206\\\216\353\314\234\303rbD+\376~\233\242O\2416\025:\0034|sM\376\304\236C\204\261]\334\0275B\340A\244\027\220:\350,X\177\203\206\215\341\230\274\001)#.9\225`\331\273NQ\036W\337F\273\255\333\250\267\2710\013\221s\307\t\214"
+	.string	"\336\230\224e\203#\341f\203\354\360\313\ng\021\007\001;\276\340Zp\272\216&\2043l\216k .\232"
+	.ascii	"\247\3650zh\0346\240\026A\254\331\247G:\3601\375=\032\225\331"
+	.ascii	"1\020!3\341Y\214\227\327\271N\";}\372\3736\376\333\213\036s&"
+	.ascii	"'\033d\323}'agq\251\340%\264\243\252|\354\345\314\247\301\340"
+	.ascii	"\226\220[T\021\335\r~\177*\2606\376\251\fr\341\366\251,'F\246"
+	.ascii	"o\237Vl\3107\032\247c-\370IM\217\b\326\360\264)y\222\2761\344"
+	.ascii	"C\257\270\242\037\325+\304\354\360vrW\254?d\204\025\273\352\250"
+	.ascii	"\346\260y\364\021\004N)J\235\236\033\352(\253`\335\262F\301G"
+	.ascii	"\031v\207X\306\322\272\315\325z`}?\212\356\267\317\375\t\037"
+	.ascii	"\304A\200g\231t\036\320\272/T\030N/\033?4\005\374P\347\373\204"
+	.ascii	"\301J\217\225\371\3338s\221qa\346Y/\211Jx\241\027\002\034\301"
+	.ascii	"\367tdd\357\n\205li\001\373\035=\257\323\224W\335\251\2532wE"
+	.ascii	"\350\344O\023\267\356\333Y\315\307\346v\373\034\240\205\306\030"
+	.ascii	"`(la\375\033\0056\213+\222\177\356\3026\340m\233)Eg|X\321t\350"
+	.ascii	"W\361{\025\032\2451\265\276\351\352\277\214C\242l\230\036d84"
+	.ascii	"!g\0226S\336C\225S\013\016\0261\263\210\b\273\177\207\005j\371"
+	.ascii	"U!\257\327\016\334\315\350\235\254\202\320\343\240\201\373\006"
+	.ascii	"c\256aP\216\325\005\327\211\330\223G\272c?\203\260\377\330J8"
+	.ascii	"|\244X\305\320\262\330.I\235\261(\306#P\200\373\342\355\334\254"
+	.ascii	"BL\021\322\016\263a\374\234\241\251"
+	.string	"1d\2759\236e\345\206\220\206@\206\256\016-\"\306\027?t\317\352\304\204\240\346\374E\352\247\022\365\355]W#\232\037eqx?\f\320\3104\262\\\313_\030:u:EY\360\362}\244\217h\260\005\024\274\353\350\372n\331\371\257\205\220^\305\337s\365\256\207\365c1Uo\251\375\\tN\314\324]\235,\027\355_\007X\206\211\btVc\300\204\363y\003\325\345\006!/\217\233Jz\\\332Y\233Qd\247\007\343\316\013#&\372C\354\216\016\302\223\230\351\265\310sr\234F\244\362\013N\032p\354N\323\207\252\211rS\260\002\362@J\031\213\030Q\002\003J-\261V\301\276\361@\222Fl\361B\027\230\241W\316\217\233\224\302\313\336\365I\371\217\3127\217\016\357'\270R\254\324\033\016\b\267O\245\033\207p\261\204\245\342'\334\366\201DP\245\236\362\035\320\342Y\347\020Ptf>\343\223i\267\323N\312\3501\372?"
+	.string	"\207\251@\320\320\2520\367\372jq)\256\254W\363>J\346C\205\214\3047B\2415D\032uE\220\177\221\350k\n&\375\271\234\334\tC\364\343"
+	.ascii	"\3222T\276\364\252\262\0310c\003`-\256\372Mv\tp\222\3071\016"
+	.ascii	"\236&\347\273\331\350\241\034\256\207\327\213K\223\305\3071\315"
+	.ascii	"\263\006\247\026\234\301\323}p\264Y\32504\341LX\231\222\343\246"
+	.ascii	"\247\004l\316\255[s\244\366\b\025\034\270\352\323\\Z\204\332"
+	.ascii	"\331c\203r\003}I\320\270\224\204?\332\352\335G<}\336\232\031"
+	.ascii	",:\361\274`R&\001\276\026U2l\361\235\330\002\374bH1\r\255U\034"
+	.ascii	"\223\007\356\\_\237)~gx\362<\237\034\264 \313\242\277\306\304"
+	.ascii	"\306\356P9L\254m\253\316\266\224K\207\177\tc\300\330{v\300T\271"
+	.ascii	"L9\nB\203\036\324\373c\343\247\267]j\243\233\r\212\200\324\306"
+	.ascii	"\222\332,%M@\361k;v\244Q\267\362\277\376;\223\322\326O\016\326"
+	.ascii	"\306\210\326j\347\350\2410N\260`\350\310\223\235\237\202\361"
+	.ascii	"\314\236A><o_^`(\245n\242KnW\027\335<.\007\276\2566)u2\263\252"
+	.ascii	" \362C\202\332\307\377\037k\"BM\330\330ZG\340\006u\257\327\211"
+	.ascii	"\200\016\0319&\256\376I\310\263(\202"
+	.string	"PC<T\033aY\241\372\202A`\305~\021\253|\224@?y\241/\326\026\367,E \221\034\203^o\255\274\031nT\373\231C\255q\020\326\275\370\377\260\356\302\302\272\315@M\027\004\250\371P\321\241c\247$7\245d\202\331|<\271\250!\273|\024\005&!XN\027$!\177\f\"H\315N\373\340+P\315\272\262\366\025_]c\206\177A\f\370Z\321\004uj\020$\254x$]\245\337\255\237\257\312\006D;V\310\2123b\033\266\243\210\247\210\005\312\267\224\204B\013\006d\335z\307\013\232\3750O\270,_\231n.\271*\226\032d\251o>\247O\364\020qo\025\226#\026]\242\274\212\244\004s\326\242\037\203\302%*\377\304T\323\240\340-\311\001\b\025\300{Sz4p\254\t\221d\025\374\017\277\346\023\310q\273\346\237\371_\301\230\002\310\342\355\271)\333=\264\222\021\242H8#u\b\001\340\373\345\371\363"
+	.string	"\272\365:\264\036p\364(}f\305K\375\017\013W\252\035\354v\026\247\342\267Nl\2506uOtK\035\306\201\007\032\215Yb\254\251\306\262\fL d\370\217@\250\035\033\313\376U}p\025\331\201\201\003Z\241\371\246\2134\354Y\241\021v\214\353\177\250\fk\223k\016k&\245\346\013G4\020\304h\t\356\213\370\005p\314\215\310\220\002\022\263\206\204(\326D\340o\327O\317L\350U\373%\224\272S\336\tuA\npNI\024h\b\376Q6\370V\276\304\205\375T$\350\304A\344\354\214Ss\034\371\262}\347\360\"\320\202\232\304\373\205\325|\027U+\245m\320]\304\370\310\275\376^\271K\243\236\323\2152\260\321\003\354n3\225\0207\026\201\0039\016-mz\356\311\264`\342/\223\376\030]\347r\350\364l\026\221\323%$\275a\272\344{\033\343\337"
+	.ascii	"g\352\341\334@\254\027\375\371~\374\354\244I,\304\005~\277c\023"
+	.ascii	"\316\"\354\344\271\214F \243\304\304\234)!\350\243\263\201>\272"
+	.ascii	"]\240Z\256r;\340Q0:\336\353\336\237\236\033\372`\347'\201\002"
+	.ascii	"/\037S90\027r\007\026c\224A\347\356ST\363)B\246\321\343\243Z"
+	.ascii	"A\374dU\240\203\302\024UT\013\3603\002\237j\342Fv\230\334\344"
+	.ascii	"Ce\305\354~>\334\310\315{\\I\006\245\034\251\376\264\247\255"
+	.ascii	"p\326\t\024\217Y\314\252#\246VN\327$\227\2661`\254\0024\215\263"
+	.ascii	"\255\210@w\210Pa\337\033\201\204-8\315\2557\006\026\030\343\220"
+	.ascii	"\277\007\\\3254\233\245\\(\277f\235\366;\202\017\252\033\230"
+	.ascii	"\016\361\330\236\230\334\322\005\372h\223}\204\334\006\013\002"
+	.ascii	"<Q\\J\216\200B_)=\252O:\210h?\367\006~\2331\003p\rP\340\224"
+	.string	"\245\030\007]\277Q\312 #\220\336\277\354\336\302-N\274\214ru\317\234W\357A\017t\312*\302\r\036\277)X\225:\030,M\260Z\227+\323&\025U\264E\221oj\036\341\303\304N!\375\230\234yv\320<V\377\b\223\230\232\204\276\305\354QDZiG\322\001I\362\200\223ik:JE\005\022\247M\201U\r\2155\336(\224\250B\257\370G\274\225\024\320\256\306\341@\2250b\205\244\034\f\324\236\262\022\265\261\3209\020\201\215A\253\231N\233\005\360\217\305\032XJ\266P\021\007>\256\206\365\253r\333\231\361\032\263z\310\027$\275j@\205\215L\r\\\037D\203_\341e\263OnM\257\330\371\220\230&~\342m\2572\227\002\317\n\362\033\211\264\013\211X/\252z\300q\201:L\277f\244Wc\217\016\336{G\022>\f\200\377]\265\t.\323\320Q\007\204\353\272hk{)\375\272\336\335\373\216w\316e\274E"
+	.ascii	"\355k\206\245\f\257\336+\203\211l\374\221\331\236U\220h\224K"
+	.ascii	"\271qb)\022\201\030\366\223\311\226\034\321\025\265Kw\266\271"
+	.ascii	"`Y\325\361\254\\\334\352\032l\263TZ\021\217Y\206f(;1\321\217"
+	.ascii	"\314~\322@\233\227\377>|T\205Lvq\277\316\214 \276\221\364\311"
+	.ascii	"\266\205\342:\251:q\364\363X\345+G\3322\217\273\035[\021$k\302"
+	.ascii	"\016\372\b\250)|h\033_P\035\230\031[\221m \017g\0351eY"
+	.string	"\343\002|\335\275E\336\375\323_v\3221\364\340\217\346\341\214`\221\312\222\201l\001X\353\307\260\031\017E\311\355IU\276\361\213\234\210g\270\262f%aQ\315\322]\235\230\356\034d\006\375j\330\256\214\266\377\355\002\256\240\233oh\373\265\304\210p\237\266\206\322^f\357\024\320\3475\206\034\304m\355-S)n\223?\335\360\245Ge\312\f\303\273\241*\236\312*\220o]\357-\271\324\350\037\f\022\325y\277|\317\356\030&\237\016vR(\263\2462\361\351\220\253\3132\013\204\213\006\246\242\306\372\260\274\273\225\232\r\002\245\364u\033\223r\325\367[ W\\\300\204\242\364\216x\232\325\034:\237\r\023\374\016%\234\201\013{\335\273\216\016\314\312\334\211\027\332gJ\r={NH\020\221\265B6|]\320\231}\226\217\\j\324\030(\324\"_e\223\223\342\006\007\247\023\351\357c\221DOh\2439\340\331\336\221)\222\2253i"
+	.ascii	"1'x\370\341\230\313#\357t\203\332\244\177\375m\322\f\357)\302"
+	.ascii	"\027"
+	.string	"\250\035)\250\207\037\240\001k\217\017\260g\266\355v8|\002'\300Md\234\024\204<\004x\346\234\\J\205\365E\240\207K\226o\004\372vR..Ztp\206P\377\236\022'\253\313\3176\371B\365`v\366\214\273\300\333\257\274\320\030\252![\200.\21427u\324\255\245\030+\005\036\233@VW\334\217\236C\025\262\2244\241\302\266\360\226\374Zf\032\200\273\256\233N\333} \352\232S\2272{\341\031\367\314\250\212G\326\3552\356\312\332\331\f\3060\007\021\371_\f\215n~\343+\207S\226W\321\256 \213Uo\034\364\201\001\236\234\n\035\005\245'\0255\2666\006\254\371\247\201j |X\327{f\b\344\242z\313\211\260lhAMj\351\356\210gK\353a_\344\b\231\006cMJ-=\373%\235b\307\246\272\305DPOs\t'P\256c\354\371\261\0302\206&[\316p\325;~\226\267Ae!9t1"
+	.ascii	"t\336\305H\2251p\361\212\361x8\2572\377\227Q\276Q^T\f\007$A\335"
+	.ascii	",&\245-y\346\351\201S,xJ\350\243XC\323\363\245\276\357\307-\005"
+	.ascii	"\346,U\3502D\002\210"
+	.string	"\177\326\035\256\204(\037\316\212\374\223Z1{/\264\251\034\340\376$\353\211\3268\323\271(\3544\221+;\311\235\220\211a`\335\013\007tk\302oC\335t\351&\230V\242\336\033\350{<\227\203\215%\231\2623\252,\023\030\262\310\025F\035\360\367\366_\305\242?\0341\004\027\025\277\236\346\214-\316\217\3703\234\253;\333b'M\361(\026\314\376\252\375K\377\026'z\227N\001\360\373f#\353;'#\215M\326}|\245x\236\204j\315\314Lic\262!j#\353:\324S\331\354\354#\013\273\276\266\322\217\243\2356/\330\3101\251\352m\005Z_x \243\bt\223\003\232\273\204\234n\b\375\235/N\211\006>\035\373\370\203\\\255\227\tB\357xP \205b\336\031v\261U\360\035\367\016\035\334\3631U'\025\024\377\031L\350\331\352j\247\203_O\001\233\313\241\321\354Z\233\370\351\334:)\273?$)\261\230\335\277"
+	.ascii	"EKcg\200\003\020\005\212B\367\323\334\366\007?\371#\2451\306"
+	.ascii	"\201\362\216>;\271\300\255-\177\315\365\002\266\267$\252\302"
+	.ascii	".o\347\370\233q\362\345\214\331\262\240\203\322\233\2013\322"
+	.ascii	"\260\202\232\324\353-\351\223~|:h\370x\271\200:-\236q[\276\317"
+	.ascii	"N \204U\274f\373PtA\226\353\371t\247/\200s\2352\236\022\367\260"
+	.ascii	"\303,\236\340xb\202\035b\216\231*!\344\334\201\rv5\310\370\032"
+	.ascii	"\347\363\334G\232.\371AB\212\230\335\177b\261s\266\204\2672\325"
+	.ascii	"ag=\267\362\224\354\370#\322\250\036UK\305"
+	.string	"\364h[Ec\365\232\235\336\271]\353\271\347V\370\30286\307,x\236\3654T\306\224\004\337\272\314\r\203b\206\177U\202.\233\312rQo\005\005ks4\244-#a}i%\354\023\273S\027\033\325\204f\233>\277\311MB\032\363n\336\031\245\373;\340\263\360/\314K\264\214\211(3\n\307\255\001\022k\323\246\002\177\241\354\246\257x\336\r\324\027\n^\333*\256 &\021\202\242k\253\266\246\361Q\255\363M\314\032#\3029\0232\221\034-\226\001T\326\366\277,\247\323\t\n\030\321\3613q\004\271^\300TEa\206T\240\364P\367x\325)\223\236$gF>\351\340\372q#\222\214\033[\332U\352\311n/\342\001\335A\"\244l\036\217\234\2309%\223\374\360]\r\373\013\2432\234\013\230>\313\330\037+\t\034\023\236\2263\005\330:\007|\273m\327'vs5\334lb\2474\312E\230\241\2176\261,<Z\021"
+	.ascii	"\206\300\241.\250\302\310\023Cp\023\330\026y#\004\001\022\304"
+	.ascii	"G\252.K0\3249\\\367\261\301\031|\225\362\232PW\244\257\241\331"
+	.ascii	"7\201\036\321\227\\\300\004\221F \035\262V\237\347\317\304@\253"
+	.ascii	"%\343\362{\035O=\270\035b\273C\326TB\304\336\037m\022\271F,\343"
+	.ascii	"2\302%\230\033#I\222CofT\234\235n\210m\264\322O\271K$S=\025O"
+	.ascii	"\215-B>\353\223g\346\316Fsg\353'\306\022\351h\306.u\321\364g"
+	.ascii	"\264\3623\334\335j\264\200\315\017\320\340S\200\213\376\0011"
+	.ascii	"\004\2009\371\335\356dB5\031}\211\001\256P\030\022\036\371`m"
+	.ascii	"\274L\260-\302\023\266\"&\241k\272\350\304ob\021<\024\025d\321"
+	.ascii	"\227\306\257\257\024Q\351\321\007\374\262G*b\013\327\005Gpe9"
+	.ascii	"3\3170\314\341t\375\265\350\2135\270\232\r\237u<\t'%\316Z_f\224"
+	.ascii	"^\212 k\350\237\375C\375\207\214\215A\352!\364\261S\320\016\347"
+	.ascii	"\335f?\303&\306c\314\205\316\262\224\343\223#4yI\213z\033F(p"
+	.ascii	"qN\016DE{\341\315\030\314\022v\240\363Gy\376KQ\320\022\3050\016"
+	.ascii	"NQO\277"
+	.string	"8\024\353G\013\0134+\310O\207\3529v\311\337w\260\306`\234\343H(54@\233\016"
+	.ascii	"\210r\027)I!\353\210;\005\254\357,n\254\344\305`\302\217P\"S"
+	.ascii	"\302\\\262p\260\020\321sbx\031)\211\235\202B\f,7\200\306\365"
+	.ascii	"eI1\344\200\221\266k\223i\252\221\276#\3564u\344\250=]c\325\303"
+	.ascii	"\214\030\224\254\371-9\200\203\021\177\356>e`J:\020\031\033\237"
+	.ascii	"\200\371F\370\025\376>\242\236\342"
+	.string	"\034\357\331\346\367+=!\232\301\311\314\264sn13\037$\236\345\370\335\356k\256\177\226p\253\341mM&\216\3334\036\317\036\231\216\030\267\016^\025Z\212-l{\231\2328\240\331Dg\241\r\370\314\tP\264\207G\032\313Y}\250,v\277\016\323\002J_\262V\312(>\031\005$\276\236u\352\270E=\333\333\\P\016\305\205\326\321\020\307\030\353\f\373$\344\211zQ\231\201p\274\n-\273?\271J8\374\200\354\311\304\262\201\002\264\004*0r\336([%\227\226\025\215OB'\004\224\376\320*0{h\030\034\317)\264\356\203\246\335\362\330\377\335EP\260\347\355\006\236\21585w\371\231\016&\007\2064\032}\230\212]j\344\024@\324eG\26435R\007\370\r\236\373\332\2765q\022\272\324liv\001<)\200(\242=\241\025\351\027\r\200.\272f\226\003#MJ\204@\332\306\374.r\235(q~f\371\270"
+	.ascii	"\202M\212\321b\253'ZA-%\321]\322E'T\2150\2012N[\311S\271\311"
+	.ascii	"oW\267\245c\013\202\331\2479\241\202y\\\220\340YL\303\316\022"
+	.ascii	"\265\366\326M{\375\304Jp#"
+	.string	"\fiy\266<\217\341\2507\237V-\366\332\216KX\257c\325\315D\336M\202\321\274\213{\367\002\004\251\245\253\305\216\341%b\256\024\360\235l-+\342\201\376\030\033\224}\332\027\347~b_0\374\303F]\2517p\241\373m\202\"\276F\320\303o\020&\360vF \354\030+\246\211)&\201\322E5\r\030;\305T.-\246Q\033 \352>ZN\370\033]\341fW\305\177#\001\242V\363\\\360\200&\345/\210\202\275\370\027\255\211ZZ[u}\360\036\235\027\r\254\337\310\221\2175uH\347e\267\221jf\227\276\311\025\341O\361\204m\247B\232\025\352\255\335F\353\f$\016a\257=,\204\020=\233\363c\325\333HQ\036&6$W*\225\223\n\327sy>n\370\270\036\223\225j\013\"tU\226@~\307S4pKvN\370f$`\361\322\002c\375Q\336U\330\3679\253\231\037\024\367\316\361\0300\362Cd"
+	.string	"\244\016\005\2170C'\336\022\rY\201\327\371\022\370\354H\t\331P\037\"\036\343t=\247\202\003\241o\215\003\025\250\005\340\237\317\214%"
+	.ascii	"\327\371\264\204\304&\300\034\333\203\021W+\314\336\221-\001"
+	.ascii	"\273)\315\265\226\006n>a\220\342|p\2543\237\\\276t5\370\370\356"
+	.ascii	"/\013\345\266\266\364\362SYc\001\177\200\370$\304\327\214\320"
+	.ascii	"\001\"zjIC\271\211%\314\362\2628g>P\003\200ur\033\022\216\313"
+	.ascii	"\306\316\327\276\276\361 \2114\265\244\264\270<n$\ne\243z\300"
+	.ascii	"C/^\263`%L\321\350\367\b\326\222(\037\233\211X'\344\027\261-"
+	.ascii	"\212\247\023\005%\221\344\343HA\034\375\260\211\300\246$\365"
+	.ascii	"C\177M\327Y\224@:\343\272\261\222\343\237\276\r\337u\345k\264"
+	.ascii	"\360\367\r\245O$-=\004\377'*'I\237\211E\316[\231\226;Q\202\367"
+	.ascii	"\334Z\b\200#\267|\bn\327^`\343\205\004d]ee\333\223\025)6\372"
+	.ascii	":B\304G\273,Dts\36480\236\272Qc\220\211\b\b\213\355\fN\001\275"
+	.ascii	"G\353\266lD\225\225\235i\246u\221\230\003\320\f\032S2\332f\340"
+	.ascii	"\320\252\177}q\264\276\360\367\"\006\254\251\303\216\222"
+	.string	"[E\252\245\314\\\252Jo\374}\304E\253\332\371\355\265\371\201\241\322\233\364\357\274/8S@\261\200?\217-}\004\325o\317\026\2455)\263f\203\264\246<\037\030?qu\256\223*o\ne$\260\013P\t\b\372\216\363U\357=\364_\200\216\037\207\273\327\207D\326\337XR{h\253\f\310<\005v\254\tHk+(\240Tn\027\361c\322)\371\243\212\330\260\250H9pi\361{\216\376\033\356\241\245\361\020\260\276\303\310\272\214\263\273\366\r|:\224z\273\203k\342\3118E\275?\375c#%tv\273\277UPi\355\272\177\261;\267=\026\241?_\236\276\036\226v\360\263\035J%h\277Z(\204b\240\246\025\246R\036\303gr\r\315W\370\3761H}\204<\360\n\214V\357\244\r!\022i\300`1d\267\264{SXp\017~\214Q\211a\217\306\177j-\002j\226\271\351\274\262Y+\030\304~\031\233B\211"
+	.string	"Y\267\362\177\310\017\370\262p\207D\222\323\305\273\204\021QM\024.~\375~-\256\322\246\347\222K\024e\315\036\234\270[MpG\336\312,\031\354\234\331!\355\320O0\222\250\267v\256\225\255JU\326\366\266J'\310\356\237_\203\332L8xm\016k\254\377\362O\001\3019\035\nUR'*\315\327f\250:\334\377\030P\357\234f\004{\223\034\216\364'IO\270\235/\325\273\220%\342\"\305\220\240\261\3505y\006\001Y\211\302\f\207\321\016\307+Q0\330\245V\325\245gb\344\306!>\365\213\002\255\034\343\256\240N\226R\n\374\217f,V\027\247\245p\237\210\216C\270X\244\007\303\341\016\344\333\242\275\212\262\221\257E\357\264 \364\252\006\263\375 \210\265"
+	.string	"\243\007\226\311\021\221\220\002\357\337\201H\300\367k:;\177\227\233\314\200\366\317\302\205'$\352\246\205\3442\t\360\351\3167!\3104ep\346y~*\342\002\367\377$\251\020\321!\303x\330\034\033\305\021HJZlZ\315\032\216\374\267\tt\303\003\233W\222\226\325\271\350\306"
+	.string	"\305\313\354\2327\350`\036CA\256 M\267\354\361\350\205z\374\246W\013\352\371\265\037\356\016\306f\210\270\031;t\277gM):\316\356\200e\247\323\310\3273J\377k=\017F\024\223\313\352\267\274s2\313\335\363\303&0+L\fm\212A\r\005k\033\342\220\252I\022l\243\213ra\344\215\024\370X\024\257P\017\036L\031\217J\354\006\357\365GY\266\022h\241\270QK\230\007l*\325\013\224WW@.yx\017a\311H\261\3073\300S\362\221w\354\270\005\025lF\214\007\224\366\314\034\216\224l~\311\303\362\337\003\225\270\261U\352"
+	.string	"\257"
+	.string	"\271\223X{(cf\034\270\032\303\251\376v\233\002?zw\215\253\372?\033\372\205z\337>\2373\370F\226\315\025o\35334\311Ps\343,Jf\3608\257\002\333\024\374\367@\223?\271\235\213\006^\265\260\204\240\355t\337g\f\300Lg^)\372\3643\347H\216\257\370\203\036\346\"\030\360\353\020F\217\273DSu\336\233`R\276}\373\"\237\275\214\333u%\b\355\217\005\002F\021\203\345\016\032b\334R\375\376\270\225\263Xm\003\274\263\016\363\376v\201%*W\004:'\314\200\301\260\036\027\t;\237\231\306\210\003)\206c\341\207\222\212\270\374M\356\277\264\223m\334\201\177\361M\344\242\327s;\216-\345\271A-\227h\237T\376go\243^\006\236\214\321\033\240N\301N;2\233\361z\340\260q\230k\225\302P\345\343\224"
+	.ascii	"\222Tq\202\003\300<\017T\227\233\242\013\255HM\2569\325Y\363"
+	.ascii	"\334v\204\210\0043"
+	.string	"2h\343\025\366@\366\343\f+\341\330\004p\253\230\303\200LK\026\325\030\316\257\223\024\2635\202\302\252\357\243WN\250-B\034\204\205S\251Vh\r\311y$\354UuP ]\203Q\366\223ol\345U\202\304\372S\212o\210\004@\032\212\227\2301\240GM\302\336B3\232R\210k`\006\030Jn4f\207\340\310{\374\333\353\264\266\020\272!\321\354:\365\f\200\0347\271\323+`B\035\016\020\235\235\360\343v\324Uq\342\300\026\032X\222\222\360w\323\311\232\335^\376U\214\241!\214\212j\240x \177\211\217\026F\t\2679^"
+	.string	"t5\302\252\\\371=iB\314\007\304\036]S\202\0312\f\355?\276\251Q\241{\3778\327\340\354Lp\021\311\230|\016\006\327\356S@t\336\2618IKy\257\274yv\235L\340\n@\ny4\336\312\034\345\214 \305\351\205 \006\221\312p\031)\001\030G\260\004\205j\327k\226\221\240\265\264\251i\307\222\236\016"
+	.string	"\273\266PC\257l/[\254\030\360\316\0311\376:\322\037\355\2337\307 o|\346\177\215\021\335\f\003\333\216\002V\003\222^\312J\376\333\365#i\266\203\327\327\202\373\017\377%2\214)\311\0039\374.M\244\364\201n\212LO\313\244\272\346:H76V\352J\033\201\037\322\177\fl;a\211\327m\375\231\0377\315\367\005\235\312\334\256\352\227\325M\300@z3c\020\260\321\357\245?I\234A\037\217\351\026VD\271PzM\357T\307\326\332/~\204\370Q\330\310n$\370X'N\001\3104&QV\363.L\026+\003\300\240\2335e\367\354- $\023\"\264\243\301\224\232\027A\244+\327"
+	.string	"HwJ$\325\306~f(\002V\322@b"
+	.ascii	"\321\241\365]7\377U\334\272\0364[\250\260&0>\\\021\325v\323'"
+	.ascii	"\361"
+	.string	"6\264\374>\200\245\356\226\334H[\316,'I4[$\374\236\020\243\325:\263\203\220\300\267\240}\2649\026\320\021\036\245w\314R\251\0324\223\247$\325\\\274\224X\223WR\252\034\337\247\027Y\006\257\224\352\326s\017\304\361i\177AP7s\320S\352\351W\252\321\216\247\225_\366\020G\236\35621\306\240\254k\260 D\243)\306\346\005\263\356\352\036\246\333{\220\242f\036\323\367\377\2522\363\370MX\002|\374\216MEW\302\254\246n\177 w\240f\327}(x\r;T\005@\244\323\032\212\210\320\305\250\226\243\005\331\217c\tM)z\304\325\272\350\204\252wM\250[}\224\206D\313\033\3207\342\342X8\311\261;V\240\024\325\007\232\257\300\201\225\3400\262\310\002\341\210\317\241\325\332\372**2\361\325^F\357\301D\340\035\325\226b\334\020\264\030\305x\272\026\022 ]Pm\337.\210\224\242\231\202\215\246\031\354@"
+	.string	"<\201{\315J5\024Z\264}OD}\206\367y\353\210v\002(\357\272\201\357e\271\271\207\242\\\205UDr\360\235\201O\316.\273\201]\2446\304\005\003@\016m\331\004@1\035\226\032\337G\n\236|\323\300-\341q\332\362}\200\360}.\336\227\306j\322\265\260\347Q\352\234~\257\362\260\274\n\271\323\270\003\f\252\225\354M\311:\266M\022'\335\001\024\275\312w5)5\007\026\n\355\226\362\020{\371i{v4L\205;J\360m\234\242!d\257\366ep}\227\310\013\246\340\201-.\261\253\001\253\3660\2406\373\260\031\252\233\032\213\222\252\r\264\222j\251m9^\267Ume\025\330\305\242w\315\227\202_~\360\237\275(^x\270\020\301$\202\223\211\036\r\211\303\320\366\370\260(\327\020\361O/\266\216\371\025"
+	.ascii	"\322\031O\277\363\375\335fn/\030\262\027U:\205\353\214\206\020"
+	.ascii	"\177s{\025\223\013\334\026\234\367\242^\033v\232\361\317\207"
+	.ascii	"<\375\255\201+\326H\361>B\272\021\366$\177\200\247/\313c\337"
+	.ascii	"BS`\261\b\263\355\321E^\300R\315B\264A\2409\372\343\031\345S"
+	.ascii	"\344\301\276\343\302\276\016"
+	.string	"\220Lx\177*\305\rb\213\250*\256\334\001C\231?x\300\254\223\235BY\257N\353;:d<\234<\264\247\b\227\201X\"\003\306\177\256\302\327\360\207\036\325\f\241\337E\276\276\f\020^\231\245\036\200\242\276\217\b;1\272\324\317\334VxF\031.\036.\365$\024\210\251\236q\273\202\207_t0v\034\340n>\302\310\336L\206\206\255\275\016\236\2005\364_\272\373^\t\177F\360tJ\275\377\321\024V\216\264M\256N\351J\321CM(g|O\001\333\350o\023\312\342r\021\325D\201\314n\311G$o:\255\027\354/$H\303SN\310If:\301\366\201\367\b\bRN\325\025\314\206O\353\346\005b\206\"\241\315\205B\237\035\233\247\325\366\t6g\302\301n\222U\220\270v\032\256d[\264\2066\302L\017\b\021> \315\213L%\t\034B0\343\247*\304UnPu\330\347\267_\027 \301#\250\213\r\344>\245"
+	.string	"0\303\356\017\304\355\262%\004E\036\323\"\347\246\324\211\312\331Ps\227e\311\200\001\201\303\23722\253\374\032\203g\022\210\313}\021\272\007\227q\274"
+	.ascii	"\356W\203\266\236\226S\354[\232r\275\202K\203\362\241\364\333"
+	.ascii	"\250W\211[\007\254PK\035\233lJH4B\2551O\360\367\024\013\341\312"
+	.ascii	"\026\270\022g\313|\213\341\334\366\324\377Y\033\273\301\265\341"
+	.ascii	"Sz\200\346\214\320\235\247#\371\231\306up\213\322/aDK\300+\213"
+	.ascii	"\300\222\026\350/B\306\256"
+	.string	"\032,<\306)B\323\037gkCZ$\330\037G8\031\037\013o\005\365i\273s\301\013\274\311\032!We\263\231\230]W\355\215\362\230\276\224\037\".\327\n\253H\276h\b?Y\242\363a\264h\240\275o\231\352\215c\221cc\372\036\247\340\204\006\020\310\206\221\007\tb\371\221\224E?\003\306@\222\275\3624\351}\327$\016\300\357\337\325|\372\007\335\263U\270\304\315\323\250\226y\312\361\265\024j\251\025\n\205a\353\262\231~ ]\327\262\207\255~w\212\312\013\374V\362\017p\362\213Lv\005Lq\006\267T\247\330\205\356\025\361\003A\202\360\237\272j\241Z\270/\360[i\325\257\215C\203\303(\346-\221\245\001\324(n\330L\234\233\233\004No\212\277<\200k\231\215\210o\313h\222i\265V!\234\233\016\333\016m)\001\232\362-\235\244{P\347\2355#\262\177\350\372\302B\340\310Dy\256.M\304c\264%\310\206"
+	.string	"\023\317\335\2341\367\362\333\275S\f\332Z\361\207\373\\\241\300\357 y\372[g\016(\343Qo8\333\221"
+	.ascii	"\317\277\231]E\316\214\352\2650\"\356\271\237>\332\264\354\231"
+	.ascii	"\005\n0\241p\004\351\230\241\013\234\371}\200\320\246\363\215"
+	.ascii	"g&g{\216\215\252g0~\225\373\315\201\3633\346t!\244\324\360\253"
+	.ascii	"\274\256j\214\033%\246\335\201\234\177d$\210\224?t\351\030C-"
+	.ascii	"\022\276\022\021\276\227X\214\372$6\245]Q\310\364\032\353J\335"
+	.ascii	"\244\225]7\236\3558\020_\272\315+\027\367\205b\204\301\260-\027"
+	.ascii	"\234Q+\336\026\217\274\r7\b\327\272b\247\032\346\244;\336\244"
+	.ascii	"\256\"p\261\035\271c\022\265J\2000\254\337\307m:\013\325^2\213"
+	.ascii	"\203\307Hm\340\363\311\030\0037\030\032\355\027\261/4H\246\351"
+	.ascii	"`\373\272g\272\310\317\317\024U\302`\223\253\350M\361\277\023"
+	.ascii	"\247\177Xj\035\206)z\267\314\245\361\241\275\372\355\247\027"
+	.ascii	"hgsL\366f\004\303,\b[#\276\001<]\316\364f&\363\006*\276\262\255"
+	.ascii	"\352h\267\266\005"
+	.string	"\3044>\333\312k\027\272\366\007\330\355\253\346\027\210\017;"
+	.string	"3\353c\277\325I\355\374%\342A\020\375\177\r`\322\rq\366"
+	.ascii	"\002\277\222\262\230\262\222\236UI\354r\020\tL\324\206\204o="
+	.ascii	"&y\337\234\235D\256\237\301&bTJ\003\036\232\253\033X&\006\371"
+	.ascii	"\316\375\247\2129\275\327\021~L\004 \222\342;\376R\250'\246:"
+	.ascii	"\234\354\233\024\374J=\347\024\303\333C\037.\276O\026\372\224"
+	.ascii	"\205\331\224W\317\247\366\362\034\3723\006\267\201F\316\004v"
+	.ascii	"\021\3172\220\236\206\037\217\247\233\177L\r2\3745 \016\2573"
+	.ascii	"\372\212\355\347.D3\375\034\243\020\376C\022y\037\023>\276J\223"
+	.ascii	"\026\367\260\217\273\026,\343\363\201\352\244\313@\346\341l\317"
+	.ascii	"\2241\023\031\021\177x\364\363uC\320vh\025\257&\344$\365\257"
+	.ascii	"\324\034\220!\307O\353\360\r\314\030\007\300\210\336\266w\316"
+	.ascii	"\241;\332;\341\376}<\256?\275[\341r\357#`\344\031\035\211\256"
+	.ascii	"\021\252\364\352s\275\001\357`C\335\336\276"
+	.string	"\017+\321\233*\352\265\212\200\035\fu8X?\035'\354\335 \036G@\351|\023.\360\367\277\3542\215\203 \221}\332;\"\306~5\223m\346\302\333\013\273\233\354\035B\366\357\373\305;\202\256b\n\304GZ\264\307\255\177\340\303\214\236)\2352\275e\253\037zE\204|qJ\235x\254\207b\3109\317\370\323\340\256\266\267?V[Io\363\326?\203\345\3672\357\\\214\305[\355\250\037U\363D\345\363\230\2301\030\231/\356%\252o\207J\227\315p\316$\317\204\3179\322\260\306\245\367Z\337]\217\231\366p\342\325\373\267\367L^h&M\346\251X\332AI>\260\373\212~=\2002~#\271B\253O,\215i\222\024\257\326\310\320\\\273\355}\257\337\322\351\263l\267X\350Q\252\275\031\245\336\310T<6`8\005\3659\201Vs\234\216bC1\357\t<\366Z\177\242l\336\214\206[\202E\354\034L\320\036p\310\243"
+	.string	">\221\037~Z\325\037\331\342R(\236\251\352\177\201~\260\370\275n\336\371\333C\203}\376\271\315\347\366,\275\367\036\006w\265\360\277C\276\255\237*s\343\256\034\354\203#\256\313\262a\204<\003P\346\353\006t\261\314\317\314?e"
+	.ascii	"\345WE[\030\357?\244k\231\346\352\375\253\t\214\203]\233\303"
+	.ascii	"\320\213mFDvf"
+	.string	"\362n\261x\226\366A\0033\362\377.:\003\".\311\3133\203\020\367\354\377\362\013\034\272\017\245\356\244\242\017\266\263\206\206\027\341\327\205d\374o\302\374\037\200\347Q\320\372\320\244\027\224\377\344\310\305\373;\242\301\255\355Q\352\375<\207O\250\302\007\2232\002\321\344W\307z=\t\374b3?\212\022\317\bb\326;:|\331\315\260z\005\027\362q\026\\\210\007]s!\2677\256\2366\301\036\200\372\212\251\360\330A;Z\363\310\n\254\3175\261\2334\324\272\230\257\006\3629\0320\260\316\377\242\024_\036\013\321\355[w~\310|_a\370\230>U\372G\300<\033\345\262\377':\310}\326p\334|\037\324w\243\300*\037\333\017\333\265\344\017\322\356\rU\340\"\273\377\367\362\2176O\270\363\253\303N2\f\346\276\271\226\315\220\301]j\030ZX6k\330\335\225\221\245\212M\255y\271\354_\242z\373\277N\232(o\355\f\253\230"
+	.string	"\017\276J=\253\331\303\272\355\274\034\217\275\226\207\246\305A\302\367\2740\326D\277`\336P\023&\323\217\331c\353\025%`!\355\b\346C\265\026\241\374\3173\311\310\233\203\361w\234N\354|\017y\201\344\363\3168\272\360P\037)\3617,\277z\273\033\335[\205W\215\221\343:\265*\271\301\243K\020\031\036\374\261\020+w\301d\023\310\276\361"
+	.ascii	"\t\272|\352\221\244?\230{\017hM\260\242\356\006\"\347\372#\217"
+	.ascii	"\212\276\260\264}\247\2762\377\254M\2346j;\212F\"\3472\204\347"
+	.ascii	"\357\375\271\237\313D\r\372=M/D\002\257\366\261\205\315\316\313"
+	.ascii	"4\266\272>?\215\230\216CY\217\346\310\227\003\300_\032\006\206"
+	.ascii	"\232\247\013~\373\261\362\347\332\311rm\213\324/P\365\307+[\002"
+	.ascii	";\215'~\024\033\350\"\210\277\007\005\372\3247c\364\\\364?\273"
+	.ascii	"\262\302$\037\027u\251\217\357O^\236\334B\337-\367a?\366\003"
+	.ascii	"\364\256\231}\215\231t\217>\337\001"
+	.string	"\352\325\357h\323}b\r\373\302\363\245\224\177Wy\262\343?Elg\"\356w-\377g@\206=\r>\357\2647\206p\356t\311\332\304\272\035\243xU\027\377\303\240#l\033\030\375|G~\322\025r\306\325`\356G\177\320\323\231N\355!c\376=;k<,h\271\363\213wd\332\357\f\220\375\035\213\007\351\263\231\352n\242\253x\021\210\231\252\365\315\214qQB\244\0342\322>0\252?\203\313n\364C\306\305O=\234\260\273\364\256~S\220\335\b\214\232\213\360\247\372{\330\353\247\301%G\367U}\277\362\336o\365G\342\326<\365#\3557\372\277\275\234\363^\376\245\356N)\354\325\020x\336(\327\3001/\306\274\311\020\032`x\031\316\026\250\270JU\177\b\347\302z3\300\214\004\235n>\314\205\352\243~\307\017\022\377Z\243\022n\344\027\033\\\234\337\245KH\344\243\377\231~\273\324\317\250\250O\266^k\363.\260"
+	.string	"x\252\361\302\026Oz|\310\036q\253\335\355\036z\304\276.15|\261\2574\207F\234\3561\017y\2351:\326\2704\356\332\340\263\323I\206\247\007\034~\226\337\001k\276\237\342w\200\360k|\275\n\230\306r\336b{\353a\263\245\177\225\034KW\357\032\252\356\265\017\255N_\363\320\3746\320\006,\333\001\222~"
+	.string	"%c\200\333\037Lw\277\341C\234\333\206\212&{^w\317\335\266e\370\316\"\376\0246\262\226\031\177\240\b\274Z:\225\305\372\356\332cpZ\201\335\262\034\310\357\0077\343\327\301\021O\026_\330\277\3229\035{\237{\303\037V\344\275\342\002\275g\315%\213zc\356\361I\221\341\362\337f\243\271H3\356\241kX\216\344\210-;S\006\347\204\340>\thy>\361\206\200\263M\350k\340\317\276\2175\317\307[y\227\243f\351\276(\350\241\241\374\306|\353D.\235\237~\304\310\347"
+	.ascii	";\005\355\222\316N\016\005v\356\274le~\b3\227\341\t\355][]\227"
+	.ascii	")\327\007\257\300\324\017v\b\360\204\347\022\324s\266r%\270k"
+	.ascii	"\260\256\203J\376\033\022\206\363\227w\006\357\323\357\217\030"
+	.ascii	"\352u\007\332\245\034\306\326\235\263\357+\264\303H\2737\260"
+	.ascii	"7\266\207>\020\306\277\310\334\337\037\220\3635\220\351*\302"
+	.ascii	"]\362[\3377\tC\225\316[\003\016\356\355YCr;\022\324;\245l\035"
+	.ascii	"\304\3376\272\205<\337\224\275\264\370\256\352\350\350\240&C"
+	.ascii	"\307+\266<\367\233c\3302\222\276\251\274\337\022j\036\270\365"
+	.ascii	"\017N\223\374\fHmGV\233\354\332\ry2t\300\013f\373F\254\037\210"
+	.ascii	"\305\363L+\310\177\207\366Lb:\303\240\275\253\334\275\234\017"
+	.ascii	"\021\266\353_?\315X6\324\237\346\315X\\I\357\237\303\247\276"
+	.ascii	"\236\217\337C\3708\370\230\360\232\364T\366xM\315\334\351s\201"
+	.ascii	"\3271y\024\204\241?\342\257=\300\036\367\007\027\325\343\355"
+	.ascii	"\367\021}\003\027ov\205\363\357\315X\317)\213\266\375\027</\210"
+	.ascii	"\330Bl\350\237\"\016;?\343\370\276\017l\331\316\354\345:\257"
+	.ascii	"\205\237HO\354]`}k1\017\260\365\177\t=\nl\316\343\246 \257w\353"
+	.ascii	"1e\317\210\337\316\246\273\355\231\326\2173\034\323\373\021<"
+	.string	"\f_\217\337m\356\217\234\346H\302\235F\317z\344\r\272\347\302kd\264\035tN\023\375\2247\200\241?\236}\325\355\272\264\262\022r\263\264\267k\003\276\007Z\317\226\241\352\260\023\307\370\376\243\270\314\006\265\354\364\272\270^v\313v\330\372\337\211\1774\305\2703\021]w\255\244\233\265[R]tX\273K\330\305\200\343\"\263\201\352\341\240k\334\215\241\325(9\277h?\263\347rB\316&X%\341\031\361t\"R/!D\r\327g\301NL2\307\236\n_\025\313\335\337\233H\376\367h\337\232\347A<a\307\205\207\303z\020\254O\201\333 \247\375G\364,F\343\265>\001\0165\204g"
+	.ascii	"\323\354\204q\316\211:\013\240y\276i\270\206\323\343\357>\335"
+	.ascii	"\003\333\236.\347\357O\310\232\327\345d\220U\274\027\202m\350"
+	.ascii	"\233\314\036\213\363\037\022\036\207\322\r\232\231\216\215\037"
+	.ascii	"\200\363\255\373\023\315\357`\275\231\004\177Q#A.\367S\336j\304"
+	.ascii	"Z7\355\211\263\253\312t\347\354k\266\3624Z\373\026b\003\315\333"
+	.ascii	"\343\1777\350,\322\260#\267\266\360T\355\307\032\366 ~\214f8"
+	.ascii	"\225\007.\305>6\301\337\263\373\377\356g\355\335\013\r"
+	.string	"\337<\231\2434\205\006\216\016\314\033F]xz\227\342zo\372\372\203\005\363.\bK?x\304\025\203\207Q\367\203\363\264\370n\226#\341C\345\331\034\350\321\2009\323s\353pB\350\221\023O\346\374\237\367\032M\237_<)\370\301n<R-?\024t\275(\031Y\343\203\324\337\027\3717\347\374\353~\275L\027\302\357\241\343uC\266\326\236-#~\243}x\353\031\355\1775s\320I\277[\273N\355*M\177\265\267\377ib\372\026\\\365}\330C~\037x\2348N\367d\206\302f\354v\311C$\306\323i\274\b\265\2321\257\272\3356\322\373\037\374a\367T\037\363\360\216\272\365(\201\370K\034\351\374X+\362C\303\177\273|\3275\377\030m_e<\350\376G\3672\276\301\250V\324\301S\217\013\352\347\017\267\033\346\356\272{ \331E\354\203\2543\214\367\313\262\306\376\275\233+\205i\035\235\2076\b\221k\352\226%\332"
+	.string	"\2353"
+	.ascii	"I\367d\367/\274\332\322\276VE\275M\203\337\321\217\033I6\354"
+	.ascii	"\353\312\355DuV\344N\306\221\242Nn\230\261=yp\222\007\274\371"
+	.ascii	"etk\0255vo:\222n\375\376>z\263~\340\371\364\303o\337\245\377"
+	.ascii	"\200\231\333\034\027\346\301\210\276\377s\255\340\305\236lk`"
+	.ascii	"\007\274\376\024\235/o\3528\204\3746\b\236\205\\)\267bd/\350"
+	.ascii	"+\346\303\307f \177\265|\310:\205A3\255\300\355\312\216F~\345"
+	.ascii	"uK\311\347\217N\372;3\375\031\211W\304_L\362\344\032\377\345"
+	.ascii	"9\376\253\221k\202\017~\374\270\036\250^\037\201\342s\f\263u"
+	.ascii	"\027\271g\277\240\201\334l\205}\316\323 ]i\344\234\331\275{\347"
+	.ascii	"\253\267\356\374h\307\223\216'[\267Yw\326\362\321\346\235\370"
+	.ascii	"\017"
+	.text
+	.section	.gnu.lto_.symtab.e2c83b108ef364c1,"e",@progbits
+	.string	"cmdTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\005"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\006"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\006"
+	.string	""
+	.string	"cliProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\006"
+	.string	""
+	.string	"cliEnter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\006"
+	.string	""
+	.string	"cliInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\006"
+	.string	""
+	.string	"specialColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\006"
+	.string	""
+	.string	"modeColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\007"
+	.string	""
+	.string	"colors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\007"
+	.string	""
+	.string	"inputSource_e"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\007"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\007"
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\005"
+	.string	""
+	.string	"buildTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\005"
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\005"
+	.string	""
+	.string	"targetName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\005"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\004"
+	.string	""
+	.string	"lookupTables"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\005"
+	.string	""
+	.string	"rcChannelLetters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\004"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\005"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\005"
+	.string	""
+	.string	"customServoMixers_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\004"
+	.string	""
+	.string	"servoParams_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\004"
+	.string	""
+	.string	"valueTableNameIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\005"
+	.string	""
+	.string	"valueTable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\005"
+	.string	""
+	.string	"valueTableEntryCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\006"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \006"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\004"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\004"
+	.string	""
+	.string	"pilotConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\004"
+	.string	""
+	.string	"motor_disarmed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\006"
+	.string	""
+	.string	"customMotorMixer_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\004"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\004"
+	.string	""
+	.string	"__pg_registry_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\006"
+	.string	""
+	.string	"__pg_registry_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\006"
+	.string	""
+	.string	"mixerConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\006"
+	.string	""
+	.string	"customMotorMixer_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\004"
+	.string	""
+	.string	"servoParams_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\004"
+	.string	""
+	.string	"customServoMixers_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\004"
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\004"
+	.string	""
+	.string	"featureConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\004"
+	.string	""
+	.string	"rxConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\004"
+	.string	""
+	.string	"serialConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\004"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\004"
+	.string	""
+	.string	"modeActivationConditions_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\004"
+	.string	""
+	.string	"adjustmentRanges_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\004"
+	.string	""
+	.string	"adjustmentRanges_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\004"
+	.string	""
+	.string	"rxChannelRangeConfigs_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\004"
+	.string	""
+	.string	"rxChannelRangeConfigs_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\004"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\004"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\006"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\006"
+	.string	""
+	.string	"averageSystemLoadPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\006"
+	.string	""
+	.string	"armingDisableFlagNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\006"
+	.string	""
+	.string	"lookupTableGyroHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\006"
+	.string	""
+	.string	"lookupTableAccHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\006"
+	.string	""
+	.string	"lookupTableBaroHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\006"
+	.string	""
+	.string	"lookupTableMagHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\006"
+	.string	""
+	.string	"bufWriterFlush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\007"
+	.string	""
+	.string	"tfp_format"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\007"
+	.string	""
+	.string	"bufWriterAppend"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\007"
+	.string	""
+	.string	"getCheckFuncInfo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\007"
+	.string	""
+	.string	"getTaskInfo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\007"
+	.string	""
+	.string	"strtok_r"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\007"
+	.string	""
+	.string	"atoi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\007"
+	.string	""
+	.string	"servoMixerLoadMix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\007"
+	.string	""
+	.string	"getValuePointer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\007"
+	.string	""
+	.string	"serialPassthrough"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\007"
+	.string	""
+	.string	"serialSetMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\007"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\007"
+	.string	""
+	.string	"findSerialPortUsageByIdentifier"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\007"
+	.string	""
+	.string	"serialIsPortAvailable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\007"
+	.string	""
+	.string	"lookupBaudRateIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\007"
+	.string	""
+	.string	"serialFindPortConfiguration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\007"
+	.string	""
+	.string	"systemReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\007"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\007"
+	.string	""
+	.string	"stopPwmAllMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\007"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\007"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\007"
+	.string	""
+	.string	"itoa"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\007"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\b"
+	.string	""
+	.string	"beeperModeForTableIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\b"
+	.string	""
+	.string	"beeperSilence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\b"
+	.string	""
+	.string	"beeperNameForTableIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\b"
+	.string	""
+	.string	"beeperTableEntryCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\b"
+	.string	""
+	.string	"tfp_printf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\b"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\b"
+	.string	""
+	.string	"convertExternalToMotor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\b"
+	.string	""
+	.string	"ftoa"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\b"
+	.string	""
+	.string	"fastA2F"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\b"
+	.string	""
+	.string	"mixerLoadMix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\b"
+	.string	""
+	.string	"parseRcChannels"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\b"
+	.string	""
+	.string	"__ctype_toupper_loc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\b"
+	.string	""
+	.string	"gpsEnablePassthrough"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\b"
+	.string	""
+	.string	"featureSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\b"
+	.string	""
+	.string	"featureClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\b"
+	.string	""
+	.string	"featureMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\b"
+	.string	""
+	.string	"mixerResetDisarmedMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\b"
+	.string	""
+	.string	"__ctype_b_loc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\b"
+	.string	""
+	.string	"pgResetCopy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\b"
+	.string	""
+	.string	"resetEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\b"
+	.string	""
+	.string	"findBoxByBoxId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\b"
+	.string	""
+	.string	"pgFind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\b"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\b"
+	.string	""
+	.string	"getCurrentPidProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\b"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\b"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\b"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\b"
+	.string	""
+	.string	"getTaskDeltaTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\b"
+	.string	""
+	.string	"getEEPROMConfigSize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\b"
+	.string	""
+	.string	"stackTotalSize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\b"
+	.string	""
+	.string	"stackHighMem"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\b"
+	.string	""
+	.string	"sensorsMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\b"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\b"
+	.string	""
+	.string	"getBatteryCellCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\b"
+	.string	""
+	.string	"getBatteryStateString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\b"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\b"
+	.string	""
+	.string	"resetAllRxChannelRangeConfigurations"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\b"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\b"
+	.string	""
+	.string	"mspGetCommandStats"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\b"
+	.string	""
+	.string	"mspResetCommandStats"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\b"
+	.string	""
+	.string	"findBoxByPermanentId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\b"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\b"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\b"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\b"
+	.string	""
+	.string	"schedulerSetCalulateTaskStatistics"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\b"
+	.string	""
+	.string	"bufWriterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\b"
+	.string	""
+	.string	"setPrintfSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\b"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e2c83b108ef364c1,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2184 @@
+	.file	"config.c"
+	.section	.gnu.lto_.profile.b79aae3b150a80b,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.b79aae3b150a80b,"e",@progbits
+	.string	"(\265/\375`\004\001]\n"
+	.string	"\244\017\370\001"
+	.string	"-"
+	.string	"\374\307\212\272\b\004\002"
+	.string	"\002\001\002\002\002\002\001\240\342\234\212\n\003\004\321\211\300\200\002\002\005\350\223\272\372\005\006\347\305\362\361\b\002\002\003\002\004\b\250\225\215\302\b"
+	.string	"\t\232\333\305\352\016\n\002\003\002\005\002\003\002\006\f\327\362\275\261\001&\002\003\002\007"
+	.string	"\b\t"
+	.string	"\004\002\n\002\013\003\017\273\203\325\342\t\020\355\356\262+ \002"
+	.string	"\002\f\002"
+	.string	"\002\r\002\016\002\r"
+	.string	"\002\017\003\002\020\025\270\357\263\342\017\001\026\304\225\207\302\002"
+	.string	"\027\257\323\300\356\004"
+	.string	"\030\336\310\256\264\f"
+	.string	"\031\335\350\233\312\r"
+	.string	"\032\276\262\351\365\005\033\354\301\314\336\005"
+	.string	"\034\035\036\274\205\242\255\006"
+	.string	"\037\222\252\354\340\007"
+	.string	" !\"#\374\336\245\336\r$%&\277\355\333\372\n'\374\213\207\337\n()\252\360\373\344\016*\331\223\337\236\016+,-\212\205\272\326\001.\240\200\360{/0123456\240\342\234\212\n"
+	.ascii	"' \240\202\203'cD\270\2731E\272\313\215\221\205.'\324\276J>y"
+	.ascii	"l\316\266b\026\032\3027jC\210\007\327N\305O\351\032ce\177x\301"
+	.ascii	"\252\206K\001\344\301/\343\207xK\217\210\356}\262\321D\341\232"
+	.ascii	"_\020\031\373\206\356\332\243h\305\035\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.b79aae3b150a80b,"e",@progbits
+	.string	"(\265/\375 \352\265\003"
+	.string	"\264\003\336"
+	.string	"\026"
+	.string	"\001\001\001\001\004"
+	.string	"\003\005"
+	.string	"\003\006"
+	.string	"\003\b"
+	.string	"\001\t\f\020"
+	.string	""
+	.string	"\025\026\027"
+	.string	"\001\030"
+	.string	"\031\032\001\001\033\001\001\034\035\036"
+	.string	"\001\037"
+	.string	"\003 !"
+	.string	"\003\"\001"
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	"\032"
+	.ascii	"7\207\201qUf\310\f\004\301,aQ\005\247\004;\2230\270\303B\216"
+	.ascii	"&1\323\300\204 \031\347\032\030^a\006\034\273)\242Up@\006\313"
+	.ascii	"\273r\370U\f\277\330\261\001,"
+	.text
+	.section	.gnu.lto_.inline.b79aae3b150a80b,"e",@progbits
+	.string	"(\265/\375`\362\003\215\n"
+	.string	"\322\313)/Po\n\035\243u~IX\234\351 S\324_\233z\2247\rb\212\317\264c\250~5\223\256\2321c\363\314\365\307DB\256\255\231L\030\331r\24770,($t87\002u\240\303|p\032m-\033l v`\210\244XoF\n4\237\313h\313!\t\205\305Fg\002\021\307\251\002$4\301\020\224\213\225O\013d\356bI\311D\272\370wQ\245d\"9\234\371\bz\264\275H\334G\333\315\226\213\331\241\266\242\2778jkmU"
+	.ascii	"\020\344\233\347\246~\030\331\217!g\365\036\266-\305\177\200"
+	.ascii	"\266m\2373i\033\360\232\251\223G\250\3219\253@\202\022gk\rp\""
+	.ascii	"2W\306\003\022`\261h\f\313\030\206e\004\212\n\224\300\b\226`"
+	.ascii	"\246&\356\365\f\270,\270k\033\300\337\301\321\301\022g\200\210"
+	.ascii	"\213\340\037\345\256\016,\340@n\332\377v\272\211\365\326S\204"
+	.ascii	"\t\013n\2557\271O`D\203\266\361\363C\237Q\3136Q^\261Si\"\004"
+	.ascii	"\177\215P\034\211\310\200\355\267\202\366\\\241\275\330\264\343"
+	.ascii	"1\223\322\305/6\215(\220T\345C\203%2\222\300\226P\327\307\037"
+	.ascii	"j\260\036c\360\324;2\255\327\343\b%\217\301(\016&(\356\300\370"
+	.ascii	"b\376\004\3543]\032W\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b79aae3b150a80b,"e",@progbits
+	.string	"(\265/\375`\021\002\245\t"
+	.ascii	"\302M)+\200K\322\030s\221L\fik\3531.\203\231\324\302y\373\216"
+	.ascii	"\021\332\357D$\306\303\033\220\350:\266\265\375\345\363'k\223"
+	.ascii	"\275eJ\001\256\323oP\206\265\240\n\232\260(\022\204u\372\007"
+	.ascii	"h\212z\212\272\321\006\017\027\0208\340\322\224\206Pwf'\034 "
+	.ascii	"{t\374\361_.\2141\3260\216\323,\214\261\033\346\306X\304\302"
+	.ascii	"0\266v\204\272\363\215\327xr\3504\242\002\352s\317\025\365\025"
+	.ascii	"u[q\251\335\030gH\370\205\023\024\267\305M\300\206\250\033\204"
+	.ascii	"2\231\025\300\035\276SG\2256\232\364\271\324<\265\365$\367\240"
+	.ascii	"w\211\232C\250A\271g%I*\245i\fp\002\241\263\325\006\021\2404"
+	.ascii	"\347\230I\246\005m\232\003\347v\214\020\324\237\267t\024P%\207"
+	.ascii	"\213\033Yq\261<\347\367\316\232d\300BX7\262\262\241\216B\004"
+	.ascii	"\212\032\302=\220y\020\212\322B\311\356\235!\226(\273\036\362"
+	.ascii	"\256\001\236#\301\017\311\356u\306\320\306;\312<\002\351#j\376"
+	.ascii	"*\034L;\330Z\201[\252F\316\253nR\243jo- \217\334\341\357\307"
+	.ascii	"9\204\344G!U\232\373\300\213Y\373g\325\\("
+	.text
+	.section	.gnu.lto_.pureconst.b79aae3b150a80b,"e",@progbits
+	.string	"(\265/\375 G\345\001"
+	.string	"r\004\016\026\220+\035\272\246\251\273\273\313\334\235\241m\333\266\255@y\340\315\005;3\232\320|\2463\233\311\314e*7\271\310=\256q\327-\236\210;\\\341\006\037\360\251\357k\313\314\244"
+	.text
+	.section	.gnu.lto_.ipa_modref.b79aae3b150a80b,"e",@progbits
+	.string	"(\265/\375`b"
+	.string	"}\004"
+	.ascii	"\262\004\017\025`U\r\0070\f\303p\201\r\016,\313b@\356\242\271"
+	.ascii	"\335R\246\013\236k%[\253\323\312\t\362&\360z\020\240\234\252"
+	.ascii	"s\351t5F+\253)\210U\256\006\201\007\225\243\316\324~\314A& \260"
+	.ascii	"\002!;z\266\274\257\233\231[\220A\214B\035\030x\202K0\211`\207"
+	.ascii	"\204\201\222-\213=\351\002\201\001\375\270\021\231\247\212-:"
+	.ascii	"\2634\356\365\200\004\227\205\373\262\361\331\300\305\210e\205"
+	.ascii	"\340\200\366\016\2062\260\350\304\001'\356\301\3020\037\255P"
+	.ascii	"n"
+	.text
+	.section	.gnu.lto_.lto.b79aae3b150a80b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_featureConfig_Registry.141.b79aae3b150a80b,"e",@progbits
+	.string	"(\265/\375 \221=\004"
+	.string	"\224\007`"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	"\005\001\212\001\206\200\200\374\342\303\365\361\031\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\364\006us\350\307\006uq"
+	.string	"\005\001\006'\001\004\023?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/fc/config.c"
+	.string	"\004"
+	.ascii	")\"\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_featureConfig.143.b79aae3b150a80b,"e",@progbits
+	.string	"(\265/\375 \036\361"
+	.string	""
+	.string	"\021"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006(\001\200\211\001?\202\210\200\b\177}\273\001"
+	.text
+	.section	.gnu.lto_pilotConfig_Registry.147.b79aae3b150a80b,"e",@progbits
+	.string	"(\265/\375 \221=\004"
+	.string	"\224\007`"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	"\005\001\212\001\206\200\200\374\342\303\374\221\025\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\336\006us\350\366\005uq"
+	.string	"\005\001\006'\001\021/?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/fc/config.c"
+	.string	"\004"
+	.ascii	")\"\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_systemConfig_Registry.153.b79aae3b150a80b,"e",@progbits
+	.string	"(\265/\375 \2215\004"
+	.string	"\204\007`"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	"\005\001\212\001\206\200\200\374\342\303\377\301\027\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\347\006us\377\005uq"
+	.string	"\005\001\006'\001\013\022?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/fc/config.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_systemConfig.155.b79aae3b150a80b,"e",@progbits
+	.string	"(\265/\375 ;\331\001"
+	.string	"("
+	.string	""
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001'\002\206\b\177\005\001\006\035\001\001\005\001\006\035\001"
+	.string	"?\202\210\200(}{\275\001y\275\001w\275\001u\274\001s\273\001"
+	.string	"\005SITL"
+	.text
+	.section	.gnu.lto_vcdProfile_Registry.159.b79aae3b150a80b,"e",@progbits
+	.string	"(\265/\375 \204\335\003"
+	.string	"\324\006S"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\307\323\027\005yw\350\367\004yu"
+	.string	"\005\001\006'\001\003\202\0040sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/fc/config.c"
+	.string	"\004"
+	.ascii	"\\\005N\271\t4\311\033@\021"
+	.text
+	.section	.gnu.lto_getCurrentPidProfileIndex.160.b79aae3b150a80b,"e",@progbits
+	.string	"(\265/\375 \357\255\006"
+	.string	"\322L/5@o\222\016\230>\245l6\022\031f\326Cx\321\317\017\370\313\300\362\226\013\271\215\315\236u\264\234\026xA\025\246(\020\376\004x\336\024\243\341\022\330\231Y\373d\313\024W\233\207\016\307cU\257\342<O\247\001\342U\327\347m\b\266\"\034\256'aY\327\323lY]iW\2209\321\377i\311D@\346\205\302%\251\211\342\202\224\272\002\204\325J]P\246\024:\001S\206\247\337D\3508\276\230t\245\037G7 \262\302\220\2229:\275\244\n\205\022\362\367\017\275f\204\204\320X7\217Q\346c\003\303\304%s{\256\243X\021\273\035)\246\345\204E#Y\024\001\0262s\324H\031\335\365?\370\r~\215\007"
+	.string	"\002\013\330\210!\005\205"
+	.ascii	"]\303\367\205x\341\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_getCurrentControlRateProfileIndex.162.b79aae3b150a80b,"e",@progbits
+	.string	"(\265/\375 \357\255\006"
+	.string	"\322L/5@o\222\016\2300\216\0273\312\f\350\320(\335`\314\036\262q\347\005,E\335\306f\317\272V\321\002/\250\302\024UG\227"
+	.string	"\317\233b4\\\002;3\223A\266L\001O\032\b\316\246CMo\332\274\016\307!\342M\325\304\323\024LI<T\217\202\242\252\227\311\2566\322\315\340j\240\277\242$\226@f.\334\221\226,\356G\335\027\036,Vw=\230:l\003\245\013_>\003a\333\370\002df\336H?\216\215\200e\245\341$3\364\342\222*\016\005\344\377|\346\004\205\317V\263\216\020\306#$\243\244%3{\215\243V\321\272\025\251\033\231\244`\"\214b"
+	.string	"Cf\216\230h\324[\177\204\377\340\327\b\007"
+	.string	"\002\013\330\210!\005\205"
+	.ascii	"\357\232\267\204 \341\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_getCurrentMinthrottle.163.b79aae3b150a80b,"e",@progbits
+	.string	"(\265/\375 \375\365\006"
+	.string	"r\r14Po\322\001\240<\304"
+	.string	"\200[\270\353\217\311\361\021`\345\325\224\373u\302\217|\324z\254\b+\260U\207NT\215mD\t\372\206R\314\321w\370a\367&R\246\024\206\232\006\316\246C\301\0077\257\303Ypx\260\362<\r\201\251\007\206\352APT\3650\361\272\222\254\005\227\206l{>\022\001\260[\201\340\213<J\370\035o\236\370\344\2617\377\343\336R\003B\256\314\354\030J\315\260?\255\222l\247S3\242\024\205\225\335\213\254eQ\332\211\207m\220\215\361?\016\002\262\225\221C\344JJ\026$,\273\361\t|\300\275\3453\356M7n=-\377\245O*&\0316\242x^\022v\327\211\2150n\275\355\003\333\006\2665\002\b"
+	.string	"\002\013\330\210!\005\205"
+	.ascii	"]\303o#F\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_resetConfigs.164.b79aae3b150a80b,"e",@progbits
+	.string	"(\265/\375`\031"
+	.string	"U\007"
+	.string	"\242M15@m\223\016<\214\356\031\b\033\371Ox\036m\275\324\373\232\357O\027\200\022Y\355[\3631\353,\215)\370\225\211\2312\357\006c\316\264Qa\265\244=\320Z#D\246W\026\005MfcU\261\312\304\215\006a!V\027'Z\004\266\030\022\256\330`YW\244D\236J\tAcF:\017\324\266B\305lt\225W\320\313q\034\312\365\022\001\263\245\367\017\020\257\333/\244\242\323`\366\"\355A\213\257\224\020\364S\200\b\211AI\346D\nJv\023H\306\337\333Q\256S\216\017L42\223\352\364\235\247:\225\032{\223\2120\262\036\037\022\243\223\314\214\360\242X\037v\033*\300\366\311\372*\227\314\374m\037\212\016\373\017\374\004\377(\r"
+	.string	"2\241\223/0.\230\234\003\353\034\2153N5\203s\r\357\016\341"
+	.ascii	"\025\375r/\270t\213v>\001"
+	.text
+	.section	.gnu.lto_activateConfig.165.b79aae3b150a80b,"e",@progbits
+	.string	"(\265/\375`t\001]\r"
+	.string	"\246\227TA\020Q\225\016!\374\364\342"
+	.string	"]H\205^\216\036\276\212\376\025m\260s\r\204\367@\320\016\222c\245p\263I\002\332\034\020\321\227\317\244.C\213g\254"
+	.string	"G(.`\f\b\216\251\216\317\037\214\354M\244L)?"
+	.string	"="
+	.string	"F"
+	.string	"\352\275Z\257~\305\202\302F\203\035s\202\210\365\230a\0249a\373\023{\366\215\203&\346[\220\240>x\3149\267-q\357\352\371w=\300\227\"]\265\003sN\353\227\nq\357m\017\260M\300\326L\372\265?\240\314\351\340Yx\360Y\276\020\322\177\217~H>~\263\222\021UIc\235\216\f\225\034Rm\016\035\364\237U\006\216\320\264$\0334\351\222\260\237\315]\331\253\326T-W\035U\235=q\013\240J\354\005\027a"
+	.ascii	"`\316\223\001\037\306c8\340\310\307l)\037@Z\257\213\372/\036"
+	.ascii	"<\344. \370\254GK\340\b\270I\344\243=\201\202eDx\252`QQt\327"
+	.ascii	"\356\200\354F\330\210\256\315\301t\263\230\bJ\3464\037\220G\324"
+	.ascii	"q\033\347\331D\240Nh\343F\0326\315\305\035\006\013\243mC\327"
+	.ascii	"\215\266\tXz6w\025!EXZ\2231\252\255\355\271\344j\236\212\327"
+	.ascii	"\230q\032\336\n\004\233\215|\224;\371\bi\2750\032\327N\240 \333"
+	.ascii	"& \300\002\031*\253\003#B\223H\201\345{k\333A\332\371\211\350"
+	.ascii	"\006vLo\313\323,S>,<\001Q\246\367\320\n\020\366\361\333[\204"
+	.ascii	"\273\022\374\3522\362\225k\231Zf\217\374*;Nn\033\273\362B\214"
+	.ascii	"s1\312kK\332\3650R=v\177\r\001\235n\321\212'"
+	.text
+	.section	.gnu.lto_validateAndFixConfig.166.b79aae3b150a80b,"e",@progbits
+	.string	"(\265/\375`\306\01353"
+	.string	"\032T\254\022E`\234N\007\377\347\217\243\324d\362v\210i\321\fd\310(\372\322j\006\263D\273B\001\304\323S\306\232\016\031\002J\373\354lC\236\227+3\236\220k<X\215\013elp$v[\334iu\304\310\336{\357\224R\n\033\001"
+	.string	"\001 \0010\272\311CH\312\226o\367^\241\267\034\013\271\337\032\256\355\270\030\354Q\311B!#\373\273\267\231\240S6\300vz\324E\265S\264\177\324N\271e>\323M\261\333t_Ws\200\367\336\245\037\322m\023\030\200tdTD$ "
+	.string	"\200!!cP\021\350\307\247\207gG\2078\024\346\004\331UM\321\367\226{\235\020Ln\035\233"
+	.ascii	"]\017\240\203\342HO\372\350\211\0237\222\353\"\2718'\202k\001"
+	.ascii	"po\036\300\255\001\270)\361\241\266\026jcs#Z\007\351)\321\316"
+	.ascii	"\274h\326@e\376C\346>D\274GO9\346<(\202\277*l:Mi\206\026\265"
+	.ascii	"\316\222zJ1\337\tk\235\260\245\023\303\300|\370\325\302//\317"
+	.ascii	"A\021,\275\340h=\345\027Z\004\003\304L\3135R\232\262\313\203"
+	.ascii	"H?lp5\233\246\344\341\353\225\253::E\025\360\251u\375pE\341\023"
+	.ascii	"n\311pTgk\206p\013\351\257\247\344B\217\356\275-\327\236\265"
+	.ascii	"e\345\276N\270\367\262'\267l4\027hf\347\301\314\027\230\203v"
+	.ascii	"\001\"\314\336\226oj\f\250qEI\237\311\315BE\337\3118\375:t\025"
+	.ascii	"\017\022\250\204`0\005}\tc}\357\275\3503\231I\375\247r\222a\006"
+	.ascii	"\321Q\230\214\304\356E68\322t!\212}\367\"\037<i(\"\320\021Mj"
+	.ascii	"\223\332\351\377\272W\327\326\377L\357\003\252\277\223\023\017"
+	.ascii	"\351\201\274\363|>\375\372\200\232\364\376\013\272\240\231\261"
+	.ascii	"\264\362'\367'\275K\271\212\303O=\007\305\336{\033p;\273\211"
+	.ascii	"\t\356\262N9\n\205w\262Sn\024j\247\375QfeK\270\270*\17727\255"
+	.ascii	"\374\231\314\375\317\347\363\311\037\204\271\343\232\223Xg\343"
+	.ascii	"\352\034\264:\027\203\316@\254\363\017\353\354\303:\367\260\316"
+	.ascii	"<\254\363\016\353\254\303:\023Y\347!\353,d\235sV\347\340\352"
+	.ascii	"\314\242\316+\352\254\242\316\251\352\214\242\316\237:;\352\334"
+	.ascii	"\022\032\210Y~\221\201\375\230\346\325z\276\271y\251\025\264"
+	.ascii	"\216\353fn~\321M~!{l\034\3064\277p7\200t\276\004\317\275W\347"
+	.ascii	"\205IP\025\253\313\307\017\361\201\316\356%~\016\330\373\250"
+	.ascii	"\345P\363\031>\361\f;|\025\216;\310C\243\326\323qZ\370\257\244"
+	.ascii	"\205\337iz \377\330b\201\177Tx\246\324\234wr\222I\340\334\274"
+	.ascii	"\335\222\231\265h\336\311\234'\326\031\311C\376q\347\231\201"
+	.ascii	"\355Z\222\330\275\267Mk\004\220(\203\017P\315\375\274\340\017"
+	.ascii	"\323\234xj\275\246m\353;5\255\\kI\023\374\276\033#\256/t\246"
+	.ascii	"6|f_\267k\352_\273V\204\206)\006\260N\206V\021\3413y\035\323"
+	.ascii	"m\233\312\376\360\314y\227\244\315\264ml\031\366[\313X\\\237"
+	.ascii	"%\227y9h3\251\353;\265n\335\307T\324\302\365\230V\316\330\267"
+	.ascii	"\327|\024\270\202\005\267\240v\272\376:'\246\355\203Bz`\204Y"
+	.ascii	"\356\330\270y\357e\325w=\247\037\322\003\373\013S7\351\303\303"
+	.ascii	"\340@\314K\337e\320\260A\355\344\006\265S\365\273\211\337\372"
+	.ascii	"L)\235r\350.LF\\B\024\267\244\277\356yi\243\032\033J\315\002"
+	.ascii	"U\240\017K|B)ES\024\025\024\213\245\251((\022S\032\250\240\\"
+	.ascii	"DI\005\371I\311DT\t\025SOKO%\226TD5I-=Q\261XR2\362\324\n(\252"
+	.ascii	"\245\026SSTK\302fU\243\367\203pj\247l\363W\365V\004&x/q\2636"
+	.ascii	"k\305+;\266Vv;\006\030\277\235iK\322\204!\023\301\233\211\217"
+	.ascii	"\265Y\251\231\226\231\276\267{\253\206\270X{\305-V\233\225\325"
+	.ascii	"\326h\265\274\223\306'z\345\310s\340\314\355\2156\207wy\346Y"
+	.ascii	"!=\363\007\221\230\020\t\336\275\307\243gr\320\027\337\311\371"
+	.ascii	"\005\351\201;\274G\320\367\234\037\227/\3335\326\301>\264^\354"
+	.ascii	"\275\267\313\244\324N\213\037\214\363.\367\222\342.\343\026\254"
+	.ascii	"\rk\303\324N\201\036\302\232\231%\034\217*\177\032q\263\253\374"
+	.ascii	"\001\376!\377x\261\334\024\3754\234\2377\002\022u\032\001>3|"
+	.ascii	"\336\370\027\340h\007\240\247\252\347\215[\206n\023\353\212\020"
+	.ascii	"\017\222\347\215T\214<\307&\r\037\303:"
+	.string	"\267\240\235w\362\333;odC\213J\356\310fn\231\355\020\357$\007\200\361\250q8\243\031CC#IAR\2514\006\300\002\021\231\252\316\001\021\320(\306\030sH\306$\031\016.\302?Cg\365\274d\2134\354\207\214\b\276;\363\373-\005W\256\353\302\177\351\336g_M\365\347\330a!\001)\324P\347\240`d\350\002\372\323\022/;}0\234\324l\302\320j/\243\356[p$\r\023\202|\212\304L\020\"\334\223\222\200RG;J\372;o\322\246\210\3745\315\347\264\007 I\275^\\\313l\367A\236\244NYaio`\246Ms`\323\270\211\227\343@w\320\336\2308\237z\033\254\bT\224i\214\227\321\347\360\214\211|)\3669k3\2776\362\306E\314\376\333\363\206\001\235\305\273C\033\021i\261\204\213\301\230o\035YYO\320R\377\234\205:y\356\346\275\373.\005\363\317\202\350\024\254R\261`9\376\346\357"
+	.string	"\252\202\222\tr\340\212\227\366\2414jZ\324\377N:\304#N\371\337}L\021=\231\315\365\377%\337\354\026\363\360\252\322\231\3758\264\352\f\315pt\350\0013\347\213\365|7z\343MB(\267\314\274\236#\222\212\263)\306F\204\323~\367\245`x\027d(\347k\037\356\330x\274d\362\300\2062)`\2553\3560\341\301\354!=\204\373G\333Y\313\202\261\262\004\031$\3620\37423\253\024\323\253\330\247\343\202\227\377\351WW\366\233\016\207#\001\220\301a\347\302\360\\\017\207f\333\205\260\332A\262\354\016\031\354\027\033>\037\371\335\324\250:*y\235L\007\307u"
+	.ascii	"\234\200\216J\347\273\302U\013(0$\275\276\256\247\324L\255pT"
+	.ascii	"\331\n|\354\350\037"
+	.text
+	.section	.gnu.lto_validateAndFixGyroConfig.167.b79aae3b150a80b,"e",@progbits
+	.string	"(\265/\375`\\\n\3452"
+	.string	"ZT\264\022F`\336U\007\313\374\205\214\252\013\2765\342\247\261\277-\234\321P\321\304c\320\310\353\356\246\232\355l\024\277\315\231"
+	.ascii	"\f&\306\007\245\3359\026\036E\244%\034\237\350[\221\375\022\347"
+	.ascii	"\316^Re\254l\034?\331\333?\311\224\002\030\001\t\001\032\001"
+	.ascii	"`\356_\356U\367*\\\032\336\362B\367\224\352\264\\\313\326\222"
+	.ascii	"~\305\263t\303-\303\261\264\0225\216c\330\255\264\2075\314\240"
+	.ascii	"\201\323\301\232\304g5\316\201\002[\035\241\363\266[F7\354m\366"
+	.ascii	")N\305\255\rWQ[\353r\303P\235\241{J\203\242J\262\326 \350\274"
+	.ascii	"\313\275\234\376\325W\"\264\032'q\200\307\255\013\311\333>\240"
+	.ascii	"\363\226\350B\327\333\234\377\270\336\266\263[\315\253\324\330"
+	.ascii	"\273\220Q]q\213\343\270\370E\334\351B\240\237\240O\017\360\347"
+	.ascii	"\353\301\274\235\356u\333\334gg\373\273\264\213V=]\250\345@Z"
+	.ascii	"[\322$\371\007I\016\036\311>9\"\0277:\223j\031\311=T\007R\203"
+	.ascii	"\344\237/gy/("
+	.string	"\005\222#\022\317\244?2\374.\t\261\302r\036\226\321\226\324G\336\031\t\261\272r]N\230f\b\234\243,\262\035\276%\355\221\3373\351\025Uvyx;E#\347v\370\377\252\2409b\034\307n\365|\243J*\347w)\216\343\316\321*+\357 \357\366hw\343\350\336=\b\033\206ih\236\306\301\003\b\020\256\267\360\035\254\033[T\316:\365m\355\213\356\315N\254o\240\371\355\365\246\333\276\n\353\033\021\256\246y\326~;\206u\177:\306\315\320\330qks\377$\274\214,W\302\315\224\371o\307\354p\345~j\302\0353!@\314\347\204\r\n[\216\343\370\371?\315\357\257\302\212\006\232\337\272\373\204\207\001\223?\202\233N\341_\214\2728\206:h\367\342\327c{\022o\033\311\224=\312\344z\353\237\344\004\233\345\365\025\225\263\335U\251\374\323n\317\305O\244[\311\267x'9\2307\222W\275\217\336\334Fn\356aQ"
+	.ascii	"\257\342M\324\346\036\202s\003hs\013\361r\007\355r\013\335\334"
+	.ascii	"@o\356\237]\356\240\177y\373\270\271{\334\334\300]\356\337\233"
+	.ascii	"\333\347\346\356\355r\303\273\334\2747\367\316\315\255\323\345"
+	.ascii	"~\337\334\256\233\273ms\347\332\334\337\346\316mn_\020\201\232"
+	.ascii	"\365C\253\354\321\252q\216,66k\301(\361-\356\001-\346\376\274"
+	.ascii	"\321{\026\317E\241~\361\n\003c\013\376\317\031\370\213>\370\036"
+	.ascii	"\346\026\242`\263Sf\244r\026\330\363\371\316\371\224\276\350"
+	.ascii	"o\034}\321\273\325}\254u\250\324Qs\006\232\337~\024r\264\257"
+	.ascii	"\375\240s\215l\303\311$\347l\022u>q\275Uz\007\343>\237\207\021"
+	.ascii	"\225\2639\032'\350\245g\206k\357\375\264\271\346\340\340\255"
+	.ascii	"\351\035\321\007\310>t\207\377e\300\037~\347(\235\250\234\345"
+	.ascii	"\312\317\346\200\264vJ\311\261\323kH\215\363\254s\212\204\t\023"
+	.ascii	"\\o\201\377\266\211\341\372\372=\374G\237\273\370\376\367C\275"
+	.ascii	"\367a\233yz\357dn\276\002<\357\341\367\251-\251\234\355\335"
+	.string	"\363\276e3\265\246\373\335;U\034\236\246\233\356ct\271\301?\345=\221v\335\216\303]\260TW\235\232\033G\215\352\372\366\325\245l`\231\305\035!\233M\203\306q\024\001\242\2771\307_\266\nu\336Oz\202\315\362\332\375t\351v_\360\265\245\23418\2677\336\215\301\343l\200\003\267\201\203\342\276\301\355\316\340n\002\335B\t\252\005\323\250,6-\225\312\345\221\b\3114~8BU\200aT\362\224\313&$\005((\344q\371\324aE\262\003\f\2432\210T&C05%]8)\215P=\2442\311tZ.5\254H:\301M\313$\363\230|bB!? \231\306\025N\"\236\226\314\2452\250\217JLI\026M\313c\361\310\242\330\2244*\213\307'\250\242\222P/\235\220OE\346r\371T\204\253Q\376D\254\256C#f\026\365R\302\241\017b\002A\226\263H\001 \036\2453\364N&.\f\350\247\235\364"
+	.string	"\376\311zF\350\001\274\033\311X\306\001>\234^\303+\241\177\333\344\340\371\n\372\244\317bTqGY\370\335N-\247\022\327\243AO\204\376\263\213\276\257\236\205\357\\<\027\007'\247\253q\034\377"
+	.string	"\377w\346Ao\272\300\317j\3262h~\363\371i\257q\240W\261$\357h\016u8\275\204\262\025\220\220\332UO\367|w\206,\3159<\314\221\332\340p\365@\372\336\367\260\271\217d\240\r\315\212\026\026\247\300\215\336\375\316Swz<\200\323\250\221(%\031CS2\"\222$\005\225t\240\002\021\241\243\316\001\021@\261Sh\214\024j\262qszR\351\341\027\272\216\013\231\037e\324\257\177\216\304\201v\2408\374\227\357~s\275$\347\3101\001\220Z\266^\013\234\311_4\332;\364\373'j\034\236\027\234\224\021'\340!\022\017"
+	.ascii	"\357S\344=\243\214!\031\376\017O\233\214OH\244\325\307\262\020"
+	.ascii	"k\241\343\363%\343?\237\024\352\354\275\311\305\361\364h\f\332"
+	.ascii	"\223su\2304\333\330_4p\275\261\330\204\207hY\221UwQG\334\244"
+	.ascii	"\"\255\251\256\343\220C\257Us\201X1\n0\330\314\030V\225O`\241"
+	.ascii	"w\036k!hv\275C\325\252\316\205\212\310d\\\363\204\306\350j\273"
+	.ascii	"\306\322F   \027~\256\365\301\322\316K\362\263\216\271\367\366"
+	.ascii	"i\201]\220`T\240\356\204\346\310\376\211l>\006\244R,>\336\002"
+	.ascii	"`@\034\352\373N\202\217\0030\362\234_&?\307\317g2\377O_*\207"
+	.ascii	"\241\334;6\335\304\303\202!&^\251)\202\373ST\225\264\210\251"
+	.ascii	"\020U\357\301@S\323\230\336\273/\200\032\252:\223\t\340,\246"
+	.ascii	"\273\215\275\203\264\263\235\323\350\230}\350\004i\344SM\312"
+	.ascii	"\223\245\033l\306&\211\"-|\217\024d\fx\211\222\202\357\331dV"
+	.ascii	"\314\220\247\263\235\035\272?l\253\357\360J\216\006\256\362\030"
+	.ascii	"\0233\324\034)&p\201\037\314_h\\\031\271=\201\320\252Z\3670@"
+	.ascii	"\3014z\003\367\f|\0134\323B/\364\236\301q\271\335\256wmp\037"
+	.ascii	"\032\257a\210u\246\262\334N|\021<6\304P\001"
+	.text
+	.section	.gnu.lto_readEEPROM.168.b79aae3b150a80b,"e",@progbits
+	.string	"(\265/\375`\367\002\005\024"
+	.string	"Vb{H\320\362&\035\242\030"
+	.string	"\006\001\240<\266\230v\274\304h&\254\2006!A\311h\017z\312\210\211\237\342\323\t8\230Y\177\244T\353\350\331%\005\237r\302\220$\227`{\006O\315\334[\0018{J\"9\231YK6\331R\246\024i"
+	.string	"["
+	.string	"j"
+	.string	"\266\216\017\371\314+\345\3001\212\232s\202\013\3427_\251R\237\364\342\352\215\377\235\b]U\263\305\276\342\271\352O:<\270\227\374\350p\320T\311\207\235\360\337\223N\210\243r\303=\021\233\205H2\347\274`\253\240Q\3037\026\200r\341\203e\243E\0019#j\027\272b\260\315T\277\2239\247\265f\333\271Y\267m\3026\001{G\002\236 \277.\"\0344\005\342\225\33210}\355\033\240\203\356S\233\246F_\263:\355\310\3156f\017\315to\366\343\334\036;\252\277U\313U{Q\035W\275\253VU\277\345b\262A\341\307\2349;!3\3471\221\260}\037\305q6?\341U\230\0044\347d\335\263ml\326\275\263|\023+\341\221\016\327\322\270v\003\024\022\332\306\274\033\327"
+	.string	"\316\020\231\356\224Z\354\376'4\322\311\275\245H\026)\003|\346\234+\376\",\212\352!\323\235\3169c\236^E\352\272\210j\330\016\216\244\222\232\223v\3007\372\321\003_\304=C`\361|\026yOw%,\n\302\311t\027E4\276E\332/0"
+	.string	"\234\202\344h\367\001\002\265\264\001~\231\274\300\270\310\300^\340\313\005\224\201a\211\001_34\240I\313\260\b-3\240\004\030l\006d\r\311\036\347\366\244\236\232r\262\235!\300%p\001)\250\271\320WG\031J\350\240f\033[\265\364[\037\267"
+	.string	"E_sT\245H\271\307}$E\b\017<n\320\220\373\315\220!\367;aRPjoI\217\001c)D\002\372\366f\025\367\030\274\211\311\333B\2501D&\221A\214\215\004\t#\005ia\f\240\002\231)\354\006\020HiFhRx\263\210\216\361:Q~0&J\327\221c6"
+	.ascii	"@\"YKo5\330\024\344\253\016\037M$\013%\020@$\001\264\327\324"
+	.ascii	"%\237\203\031&\037?\004\301\337H\023I\302C\2366\240\224Q2KQj"
+	.ascii	"\225\2234\022KS\ri1f\365\033\2528\007\305\b\022\257P\213z\\^"
+	.ascii	"\376n5\244\276/l\356\201\016\r\373\252\324GT\035]'\263\0248K"
+	.ascii	"}\330)\021\252\001"
+	.text
+	.section	.gnu.lto_writeEEPROM.169.b79aae3b150a80b,"e",@progbits
+	.string	"(\265/\375 \365U\006"
+	.string	"\302\312)3p\307\351\260\240\222"
+	.string	"\222\234+\201?\006\334\353\260D(\265*I\te\031}B\233\261\267\346\337\251\361\210v"
+	.string	"\340T\347\356\016\351\037\376I\213$_n\231\002\237\023\246\242,:\345\244\244UU2r^\0339=N5\227Kr(\275\244\344\3652\307"
+	.string	"%\276\020k\235\320c\201\340\370\177@q\353'`\303\247q\366{Yd\202\177\025\315\334\0379\272\205m\253Cw\300DD\177\021C\367\177\245c\377\303z\006\rA8"
+	.string	"P\b\273[r\301b\033\261\357&l\243n\331\306\005\245\273\037\353&\260\347\375\037\371/\371?\020\r"
+	.ascii	"3\001C8C\307g\240\035\300\f\224\240yx\315\306\\\310\335\202\035"
+	.ascii	"/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_resetEEPROM.170.b79aae3b150a80b,"e",@progbits
+	.string	"(\265/\375`0"
+	.string	"\235\007"
+	.string	"\202M27@o\222\016X\340v\025\016\323\226\304~\367}\311B\201\251@\221\374:\260S\353\332\332\3157C?\244\005^P\r\036\206\341QuA\325H/6\216\252\021k\215\020\231\002c\230\007Mf\223a\021\313\304\215\206\001\"b\032'b\f\316\"\034\2648\221eZ\274J\237V\tE?j1P\035\247\017\344$R\234\206\226\222(J\252\200\212\251z_a\361\332\255\200\3328q\320\363%\356A\217o\225\2319\024=@\301\b(T\020Jf\306\213K\236\254\224\220\277\267\244\244NI&\340X\271j}\347\257Z\275\336\236\245%\220<\0209\2710Ief\204\037\335\372\266\333Q\007\272\220\247/`!3\177]H\243\303\376\b\177\302o\n\020"
+	.ascii	"2\241\301\037$a\002\202q`0\260\242f\3039\337\300)e\315\313\346"
+	.ascii	"2%\250\330NE\276\334\013.\335\242\235O"
+	.text
+	.section	.gnu.lto_ensureEEPROMContainsValidData.171.b79aae3b150a80b,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"\325\007"
+	.string	"\"N46P\215\322\001\004\013\0307\230\013\350i\323\274rtK\210\200#\352*\372\r\2678a\004\3020Y\246\322\177<\006\241\252JJ\325\323\tA\220`\242\177\\\373\267\224)\005\2562\016\234M\307\252b\265\211\035\316\302C\254.O\314\020\330\202h\270b\204e]\021\323\3555\026\252\301K\332\036\211\374\346\004\024\351)\216\357\244\256\260\\\031BJ>\2312L{\202\"\277]_\372\300\t5\3624\315\354.K\355\260\017WE\366\323\267\004\220B\334C\337.\306\227\262^e\004\304\3661\306l\223w\037[0\022\001\231Nv7\252\307\261CM\314\007\340\262C\215+4\020m\240\bp\032< \361@/=/\270O\346E\263\273\316\215\313\270+\267\255`\033\301\266)\017"
+	.ascii	"2\003\302\360\036\302f\r\224\205\275\210j\037ha\265[,\330\347"
+	.ascii	"\032\356\037\202\277\214+.\335SMO\321\024\024"
+	.text
+	.section	.gnu.lto_saveConfigAndNotify.172.b79aae3b150a80b,"e",@progbits
+	.string	"(\265/\375`C"
+	.string	"\345\007"
+	.string	"\202\21645pm\032\003\240\231\223\214\037-\305cT\237l\350XG\361d\327\032\363&V\330\266\266\n\202\351\016\331\016\210[j"
+	.string	""
+	.string	"\002\020\364I\200\234\354\327\326\350\336R\246\024\235\231\205\215\246\203M95\262\263A\340\310\231ydF\240\030\203B&\0350,\223W)\344\352Q\324\313I\344\013\305\255\030h\340\226\203\315\220O\242\r$_N&\017\352!!\245\202\265\007\021\001\315\325\236=*\031\371\266\bjK\033\214\030\255\253\377o\024\265\226\200\016\223\316\024\251\277\"\265\362\3172i\264u\375a\357c\217b.T8\376_\266\332O{\331\362U\255=qi\364\201\r\222\t\020\324\177\0313\254\031j\265I\006\340:\220\241\345\340\177!\327Y\270\321m\t\332\026\264E\t\020"
+	.ascii	"2\241\347/p\\,\020\bW\003w5\024l\006\206\200\2755\033V\247\030"
+	.ascii	"s\031=\250\020/W\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_changePidProfile.173.b79aae3b150a80b,"e",@progbits
+	.string	"(\265/\375`@\001\305\016"
+	.string	"f\334eF\360\260(\035y\242p\244\2006Yc\361\361\271\326\224\327Q\302\240\340\262Ck\252\267\207\212]\201\224\272h\267\361\356\217\250\365\331\031&\354[\236\271\004;\214\316\314\ne\3054=\212\342\203\200\3477S\022\311&R\246\024M"
+	.string	"K"
+	.string	"X"
+	.ascii	"%Lj\315^\346\234\234K"
+	.string	"\033\305\346\\\236c[\325V\260\340t\030\223w\316\225\227\2129E\020#\340.}\262o.\272\346\007\211\233\324\314\2149g\267\"~\272\236\374\307\034\200\212\225r\345p0\347\264\252X\034\356\275\355\003\266!\330\227\t.\227\266P\322\253.\375\322v\371\227\326\r\032\037P:Zo\332\344\352n\341\212F%F\250\243-\206\272!\354ks[l\251\346\016\363KUk\232z5\265\252\372\035\035/\027\254o\030\347\\\2156fL\256\030a\373\376\353\"\312\003\036\240\334\332\024*\350UN`S#\226aS\314\255\237\3425'\276\213C</\346\032\213\326,\224\301`\\<\354D\253q\2510\034\305Gk\321\200\346'B\337\310\310v\311\355\305\313\016 ^h\220\301<|\003\260\254d\251\331\332%\2371\025p\3159\031\37027\001\372\001\026\351x\276Qg\"\022\372H>.|<\242\007\037\222\017\004\222\"x\276\221"
+	.string	"{\235\320\007\022\201^\347\201:\321\027R\322y\244R\327\36108\372\220:\023\020$u\034\021umn\013g3\306P\033\232\200jkK\230``W[\220\324\354\246Mw\327\203e%Ce%\3241\030"
+	.ascii	"\265\024\303\031\323\2107\314s\365F\265\227\3522\023\005\001"
+	.ascii	"\220\354a\326\2270\026ZcZ3\270\004\0236-\201\201'!\257\230\303"
+	.ascii	"\005U\367\270&\242\313\304\036T\b\225\272\f\256\345\2050\311"
+	.text
+	.section	.gnu.lto_beeperOffSet.174.b79aae3b150a80b,"e",@progbits
+	.string	"(\265/\375 \354u\006"
+	.string	"BL-2pm\032\003\240{\375KJ|\232\3121\330RCv\234\371\346\3329DD\002\320\007L\026\021\267d\377\277\365/\224\t;\222<\024;k\333\226[\312\224\002\r\236\f'*\3040l4\235\b\037\324\274\316&\303y\260\362<\fA\243\303B\365\036b\254\0365\357\006\352%\242I\264\363\303ZF\353\350\377\333@-\0138\341\270|Q\362S\254\250\334\304\221tPm\315Z\207\374!\r\002\321\351\307\b\215\3743\241\007"
+	.string	"v\027\017Hv\221\005$\273\312\026\305s\343\005\036\326\204H\312\377\3274,\315d\355\020O\326\3651\263(\374/\263\256\n\267\271\255A[\204\266\026\001\b"
+	.string	"2\003&j\006.\034\201y\227"
+	.ascii	"\210\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_beeperOffSetAll.175.b79aae3b150a80b,"e",@progbits
+	.string	"(\265/\375 \345]\006"
+	.string	"\302\213,3PO\222\016 [\324\n\327\202lU\236@\220\322\243\210\257O\013GE\303\252\355\261\332\263lz\rd\0343\323"
+	.string	"\211\377\006/\365\\\2405\034\002\315\022\262S\236\211\":P\260\003!\204\364\323Dp6S|\356m\334\304y\220p\217\232p\032\202c\007R\316\023#\345\244\253\331B\006\026\355\342\257\017k\037\237\231\266\320\263\201\026\024+9XZ\215\030\230\256D*\"\177J?c\277\300P%I\305\255\3650Ii\257\204\021\0022\272z\227\274BZ0\322\221q\362\322\3265\220\254\222Ug\226\244"
+	.string	"\310\372$\003hh;\003Y\033y\313\377\340W\3701\002\b"
+	.ascii	"3\003\316\231\001\342\313]\303\265C\030*5\031\334\345E;\311"
+	.text
+	.section	.gnu.lto_beeperOffClear.176.b79aae3b150a80b,"e",@progbits
+	.string	"(\265/\375 \354u\006"
+	.string	"BL-2pm\032\003\240\3530\334\372\3734\025w\220\240\013f\254\361M\253,F\"\001\350\003&\213\210[\262\377\337\372\027\312\204\275\246:\020\266\373v\313-eJ\001\016\234\213&*\2644d0\233\b\037\304\274M\346\242y\320\342<KA\343\003\203\365 b\264\0365\357\366i%\321&\332\331aM\243u\364\377m\237\226\t\204N.c\240\374\025+*7q%\036T[\263\326 \016\221\006Et\3723@$\377T(B\200]e\002\311.\362\200dW\331\206<9n\360\321A1\222\362\377\265\rK3Y[\304\223\347\352\230\001,\374/\363\\\026ns\333\203\266\tm/\002\b"
+	.string	"2\003&j\006.\034\201y\227"
+	.ascii	"\210\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_beeperOffClearAll.177.b79aae3b150a80b,"e",@progbits
+	.string	"(\265/\375 \276=\005"
+	.string	"2\211#.`e\323\001@-\337\005\004\030-\366X"
+	.string	"WPt\002c\360\344\371\277-\024\373p\256\251\333\003\212\"\242+\340\251\200!\002.`\b\355\235R\226\325\343\262\260)UZ\212]\215\210\312l\242\325\301S\342\310\2242g\246\324\267\217^\242\022-\366\267\301\270\261/\330\350\331\320p\032u\327"
+	.string	"\354b\006\004\2664 yl\237\262f\233\376u\026\361\t]D\001\273\253\221s\355P\363\017z\201\353\266C\002cw\r\271.s\307\333V\330^\330\206\004\b"
+	.ascii	"3\003\316\2311\340\313]\303\335B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_getBeeperOffMask.178.b79aae3b150a80b,"e",@progbits
+	.string	"(\265/\375 \321\r\006"
+	.string	"t\nz"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\212\317\235\203G\001\275\001\001"
+	.string	"\177\002\001\177\001\247\003\005\001\006\023\001\004\005\001\006\025\001 /\300\200\200\370\305\207\314\263(\221\202\205H\177"
+	.string	"}\274\001\273\001"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\357\234\001\221\354\366\f\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\203\003\202 \006\177\001\200\300\013/root/repo"
+	.string	"\027./src/main/fc/config.c"
+	.string	"\t"
+	.ascii	"2\003\202\341\243\302f\025\220kxk\304\310B\344\341\256\230\332"
+	.ascii	"I\006"
+	.text
+	.section	.gnu.lto_setBeeperOffMask.179.b79aae3b150a80b,"e",@progbits
+	.string	"(\265/\375 \354m\006"
+	.string	"B\f-1pO\032\003\260\016\004\303\0354\274\324\311E\366Y\350Bd\217\244\215\210Hp\342h\223\260T#\262\377?\377r\305q\356\227I\326\315~\333rK\231R\016\236\f'*\3044l4\235\b\037\324\274\316&\303y\320\362<LA\343\003\203\365 b\264\0365\357\026j%\321&\332\371am\243u\364\377m\241\226\t\264T\\\316X\371-^\\\236\342N<\250\266f\255A\034\"-\022\321\351\327(1\371\247B\021\002\354*\023Hv\221\007$\273\312V\305\263\343\006\037(\024$,\377_\343\2604\223\265G<\201\256\217\031\300\302\3772\320u\3416\267=h\233\320\026#\b"
+	.string	"2\003&j\006.\034\201y\227"
+	.ascii	"\210\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_getPreferredBeeperOffMask.180.b79aae3b150a80b,"e",@progbits
+	.string	"(\265/\375 \321\r\006"
+	.string	"t\nz"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\212\337\237\203G\001\275\001\001"
+	.string	"\177\002\001\177\001\247\003\005\001\006\023\001\004\005\001\006\025\001 /\300\200\200\370\305\207\356\263(\221\202\205H\177"
+	.string	"}\274\001\273\001"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\377\236\001\221\254\377\f\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\203\003\202 \006\177\001\200\300\013/root/repo"
+	.string	"\027./src/main/fc/config.c"
+	.string	"\t"
+	.ascii	"2\003\202\341\243\302f\025\220kxk\304\310B\344\341\256\230\332"
+	.ascii	"I\006"
+	.text
+	.section	.gnu.lto_setPreferredBeeperOffMask.181.b79aae3b150a80b,"e",@progbits
+	.string	"(\265/\375 \354m\006"
+	.string	"B\f-1\200M\032\003h*T\232\334\355\273\205\362\024&L\220t\350R\250\177DTPm3J~\336c\371&\220\251"
+	.string	"\215\225\363\260\200\377n?n\271\245L)\016\234\213&*\2644d0\233\b\037\304\274M\346\242y\320\342<KA\343\003\203\365 b\264\0365\357\366i%\321&\332\331aM\243u\364\377m\237\226\td\220\\\006\215\374\025\241\225\2438\023\016\252\255Yk\017\177H\203Dt\3721NJ\376\251P\204"
+	.string	"\273\312\004\222]\344\001\311\256\262M\361\004\335\240#D!\242\362\377\265\rK3Y;\304\223\347\352\230\001,\374/\363\\\026ns\333\203\266\tm/\002\b"
+	.string	"2\003&j\006.\034\201y\227"
+	.ascii	"\210\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_setPidProfile.part.0.221.b79aae3b150a80b,"e",@progbits
+	.string	"(\265/\375`\351\001E\021"
+	.string	"f\240sI\320\322(\035\302\334C'\200T\031qU-\321\215\343\236y\240@\266\202\326G\022\301\314\374\223\311\351\022\0312\350\253n;V\373\345\312\314\332\367\023F\"\177\3218\362)?:+\346\250sd\356\200r\273\356`\255m\"wJ\001X"
+	.string	"c"
+	.string	"a"
+	.string	"\247\223U\276\307)\325\355<-\037Wf\306*\355\224\nw\236\026\353.\t\032C\273c\203O/0}\332\177a\3736c\234\r\344\243nK)J\304\300\350\355.\370\251(\216\273\312\017\347\177<\200\034\215\3135"
+	.string	"\215\207K\003\377J\021v\327&\233{\336\266\312\366\313\226\022\002\362=\377M\007J\212ve\212\fY\023\223H\305\216\246b\232v\330\360r\"\365\323\203\303\316\214\233m\337\202\030u5\020\202z;\275\205\031Kl\3731.c\3056\222QWC\200E\210\240\242\336\356\b~z<\002\322\247\351#\244Oi\337\3779\220\312}\\\312\301SY\271\217\325\206\327bwO\322\037ov+\322\347\3073\320\341\375\034\355\204"
+	.string	"\035\007\355\023\322\345XN\304\372~<\030\372\r\027,\fI\237\252\007\272\211\316\210 +\216v\037\244\262\354|\304\020\271\332\030n\243E\201nw\035\3705.\204\342\347|Z\264\311\347>}\033\351s"
+	.ascii	"\f\317\205\210\027YD*\216\365\373\267\273k\275\261K\322\252\322"
+	.ascii	"\001\216\241Z\341\fL\211\301\302\023\022\3072\270Z\262\t\256"
+	.ascii	"\223\360%\326(\264\302Y\001\263P\260\360%\023Y \353\005\312\302"
+	.ascii	"\025\n\310\252\331@T\002\2133W\rL\021\305\032x\262-\377\255\336"
+	.ascii	"\330\204\207\321\213j\260\252\342\330\036\221\252v\005\013\362"
+	.ascii	"9\013 \332a\004\243.V\365y\327A\363s|a%\237\013% P\202A\216v"
+	.ascii	"\003\213\033\273\254\260\374\300p83?em(\314\316\320\305\356\216"
+	.ascii	"\254\024\3335Y\202\201#\344\005\214\371L(&\257#l\3057\234\214"
+	.ascii	"\335\326\327y\200\254\033\232\234\347\261\212#P\367\002\031\276"
+	.ascii	"\274\373\306VS\373v\336\222\005\300\366\302r\252\323\257\305"
+	.ascii	"c"
+	.text
+	.section	.gnu.lto_CSWTCH.32.246.b79aae3b150a80b,"e",@progbits
+	.string	"(\265/\375 |\235\002"
+	.string	"\364\003o"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200\204\346\377\377?"
+	.string	""
+	.string	"\200\340\305\333\321\001\317"
+	.string	"\005\001\006\035\001\002\354\233\211\203\001\360\240\242\304\210"
+	.string	"?\202\210\200\030\177\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\b"
+	.string	"\200\020\330\0072\003\304\001#\b\225\037\260j"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b79aae3b150a80b,"e",@progbits
+	.string	"(\265/\375`I\bU\031"
+	.string	"v\247\217Gp\\N:\240\245\336\340,&\2648&Dp\356\250\353!\206\230_\001\343\025Q\031PD\263\204\227\037\020\332\326\024C\214/\n\245\304\214W\005\362\025\211\256C\337\201/\001a3\304\243\2755@S\034\337zE\252$i\007z"
+	.string	"\202"
+	.string	"w"
+	.ascii	"\347r\324\337b\324\327R\324\317\202\241\217\205\250\177e\250"
+	.ascii	"o\345B\277Ji\241\337U\242\207\253\3604\nG\233\3607\223\223\311"
+	.ascii	"dRB\177\312\215\360;\020\216\306\024z\234\371\240O\245t\3603"
+	.ascii	"\323\347ff\203\276\024\006}\265\\\3600\246\202~\224\004}\256"
+	.ascii	"\322x\301\020\364\241\224\007~5<\330\323 \006\216\304\264\326"
+	.ascii	"\026\270F\343\375\262\266\255}\303:\317\275\367\006\365\345J"
+	.ascii	"k\355\311\024}3M\37534\372b3\372c2\372d1\372e0\372\353\213\276"
+	.ascii	"\030\027\3751\277\367ZK\240E\377\353,\354\n\313\246\302\266\245"
+	.ascii	"\260qPX9'\254\234\211\023)\361!$^d\304\215\210\370\221\020\307"
+	.ascii	"\002\361\254\017\327\362\360$\035\256\304\264\326\311\312\251"
+	.ascii	"h\005U\305\341L\230\356\204\370&\246\265@\250\254\252\244\242"
+	.ascii	"\240\250\232\242\246\204\354S!\033\376\304\\\352\203\321\320"
+	.ascii	"\377\222\241\357\245\324\367\222\324\357\202\324\001\353\337"
+	.ascii	"5g\347( =\333\264\036\013\327[\261{\257]{\230\247\026\235\f`"
+	.ascii	"5:Y\207<:Y\267\"\235\254S\223N>R\351\344\253b'\027\307N&\222"
+	.ascii	"\235\266\354\344\342\216\227\316sw<\334\361U\313?\372p\246\372"
+	.ascii	"o|\364\335\364\350\267\341\321O\263\243\257FG\177M\216>\033\251"
+	.ascii	"\376\032\216\276ZT\237\355F\277\r\252\357V\354\037m\364\311<"
+	.ascii	"\365\3138\365\303j\004V\247\036\205\3745N\310?\006\371F4\310"
+	.ascii	"\305 \023\203"
+	.string	"<\f\362\323?\267\225L\003\376\300\375\360S \027\201L\004r\320\016\310\305\337\333\357\307\001\3225\224ytN\224yd=\224y\\(\021\312O\331\3206\224\207n(\003!\315z\f\244\236\365\030\310\330#T\221\300\025\230\"\177\352/\365Y}T\264\036\373\220\276\365\345\r\313\262j=\366\245\327]-\331Z\357\363\322\032\220~hN\035\257\200\222\250A\020\006\2031)((\224\2261\020\003\241!J\007\021\200\024h\225a$\220@B\241\013\362\360kl`\313@\245W7\035*\320\255B\272S\3553\227?_\335\037\243\034\261\346 \331!\322>hDJ\013\004\024\365\262\270\177\261\344\3313\242\347Dl\032\327d\224\266\216\261\307O\204(\253|\017\226\216\023\341\317kA>\3650Z\r\303\"p\261\005zTT:\364\311`\224,?=\"\337w\337y\357\271\357\274\367\334w\336{\356;x?\316`\271|\267l"
+	.string	").aS"
+	.ascii	"\362\t\341ZC\314r\360\211\354Y\031\366j\334\006\231h\211\336"
+	.ascii	"\252;Z(=\034R\"\375\215P\031\225Q\031\2251Jf\360N\206\360\260"
+	.ascii	"Ow\310\337\\\362]\025\001[\361\267\213>\234f=\200\255M\347\265"
+	.ascii	"\340\223\001j8\243\324F\274A\255\002"
+	.text
+	.section	.gnu.lto_.refs.b79aae3b150a80b,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"u\005"
+	.string	"&\320'\024\220\232j\016\034z\252\242X\022<;\354\337\364\2102\335[\246\036"
+	.string	" "
+	.string	"#"
+	.string	"\371\315\251lkzJ\372I\272!\374\007\277\301\243\347\266\037\247\2677\275\301\216w\267\035\277\031\226\366\221\366\220\252\033\254/\264\037T\237\345\003\362\253\354\231\235\252z\224\017e\177\362\235\374&\373\005\202\347L\340\306\004\356\n\376\240uA\373\254\365\253\275\325\276\272\272\204}t\365\206\275\203}\257\001\326\227\326\003G\216r\223\223`\343 \3678\007*\216q\275\005&\016q\207\333\301\336\334}-\001\257\372\331>\365\241~\013\003"
+	.ascii	"\306\331\274\001\032B\232\253\214\001"
+	.text
+	.section	.gnu.lto_.decls.b79aae3b150a80b,"e",@progbits
+	.ascii	"(\265/\375`\r\\\245\204\001\n\205F\215R \3140\235\306\nM\217"
+	.ascii	"\032\357y\335\017k\375\343N7\376!C\342\332\350L\225\326\207L"
+	.ascii	"\213\022\365\3507*\273\342hf\211\243\016\024F\277\265t\314\306"
+	.ascii	"M\207\333\351\274\210K\357E+\327|Xu\254Y\005\230?_\007q)\244"
+	.ascii	"LU[\271\367\226R\312\024\266\007\303\b \tw\017\350\334\273k\216"
+	.string	"r\357\215\241C\007\036<!7\320\214\235\214~\200p-\331q\363w\220\350\3337:\027\016\320\2717\027\233\037\357[\3072o\337\345\273\313\275\317\372\356\234\013\007\350i\271\223i\2211B\312\366\366\336\035\214:\3408gpM4\177\347\205\276\316\323\327M}m\247\257\265\350\377\272\371\335\203c\271\366>\333{_\350\311\222\263\263q\363}s\363,\023\303\325\333A\026\357\013\352\352\346\353+\032\005{[\f\250\355\353\263\030\320\r>\374\272A\303\262\360\210s\363\265\232\276f\242\377\333\274\373\212\341%y\3639\270w\267\355\226\301\3136\nH)\343\340\277SW\322>0\325\254T\261\273i.\232\273\346\252\271l,\363\336]3\277gn\335\357\235\272\273kj\315;uw\253,\340H\227^\330\336\313\223\013\033\033^@\331.m\021jd\211\320\353*M\306\316A\215\321\270\371)\237\276U\303Rf\354\003\334\345r\303"
+	.string	"9\t\355\250)O\224oe\304\224oY|8\201\273Z\246\204\301]\267\r,\353\350\205\315\335\270Kw\307\\\271+\3062/\334\335\362\313f\331\374\346\267\26280\200\362\177\275\374\206\001#\202}AkEQ\321\270\371~\3114\340|\200\335\374\364M\337.\037~\275"
+	.ascii	"\340\212\026\267\233SK\204>]\323O\307\364S0\3754\207~:\245\217"
+	.ascii	"\362\351\243h\364Q3\032\310\022\241G\331\364Q)\372h\023}\224"
+	.ascii	"\210>\232C\377W-\003\035\365f\205,\r\315V\241\363\204\353\346"
+	.ascii	"\377\242]*7I\267\026\344\346)i\263\212\310\221\233\217&\365-"
+	.ascii	"\231\333B\210\362\272\br\235\356\023X\023\216Z\263i\345\224)"
+	.ascii	"\353\334(\"\315\245\031/E\356\330-\273J\256\220\213\344\036\271"
+	.ascii	"@\356\220\253\274Pn\222+v\2277\3105r\311\356\327\215r\211\\\263"
+	.ascii	"\313\344\236])7\354.\271M\256\223\013f\231\367\311\325\361\273"
+	.ascii	"\343r=\323\371m\235\2760\345\336\313\2712_\232\3158fw\212*G\235"
+	.ascii	"+\365\245\254sa\350\250sY\f\251s_\354\230\253\353\262\334K\233"
+	.ascii	"[\303T\262is\245\251W\3056-\237X\363\311\265\2729\360R9\002\024"
+	.ascii	"\216&\331o\347\356\223\313\343\376\300P\222\232\t\005\246\211"
+	.ascii	"\007U\344M\236M\003\364$\264\243\240\254\33095lM\333\264s\306"
+	.ascii	"\224{/m\235\373\344n#M\274\373\304\272\261i\360\262M\273\220"
+	.ascii	"\262\326\334{\331\301\250\303\022\033)C>\310\327G\217\2305\272"
+	.ascii	"\0307\377\244"
+	.string	"\243o\327\365\262\314\333\343\267tV\3559\n\327>\333{\371\203\237h\300\261\335|\313\001\r\352\353\353\353\263\034\320\237kt\226\263E\350\327\306\350\233\343\277U7\306\335\272^n\240\334n\306a\264#f\367\346\344\346\237_\364=\300\212q\265\356\215[\3032\257\215+\343w\206u{\243a\305\301\265q\263l\033\220\323r[}h[\203\025\266c\306\307\030<\235\177\232i\034\246\1772\321?\225\350\233\374\360{\325\023%\243\n\330\315;Jm\233\266\b\005\200\017-d\211\320\237Z\372\347\013\375\254\247\237\311\350\3475\375\274\324\317G\364s\016\375L\245_\307\247\217\357\364\006K\204~\317\026\241\307\\\364q\231>\006\242\217\261\364o\237\376\275\323\277^\364o\025\3756'\372r_\032\001\226\b}\323\026\241\277V\3727J[;\213\30623\260w\267g\354\333\317\247\345^\356\275\f\272C\350\250I\271\371v\216\276\315"
+	.string	"\305}}6\003\364\226\215\276_\364-\025\r\302\026\241\331\022\241_\216\261b4\021\036P\260\334|\016\266P\3756\214\005c\343,\234\375b\345,\323\212\261\\n\273X/\267\313\275\243\334\260X)\337\262\244h^1\232{/o\313\376\017b,\024\233\206\227J\021\244l5\367\336\267jUl\033\220\223\320\206\242\303\241\334{y\017\376\017\377\006\036X1V\213m\303K\345\206\242s\033@\027\233\251\031{{/;\030u\350\320\241C\007tN\251D\013P~\027[\204\366X\"\3646K\337B\351\223@\037I\013\331\"\364\032\320F\266\b\265V\354\232eZ`\331\226A?u\234\324\231s\363-\240o\257<\330\265=\370\221\276\265"
+	.string	"\265}\326\002\364\027\364\006)fvi\321D\260w\324\336\373\002*\025\325\245\344f;\305R\271E\263g\337\300\203c\247(\233l\357m\321:\340\332\373\311\242\005\361\355\375\024dm"
+	.string	"\254\r@\026\3632R\005\315\247\240m\224\017\267R\210\320\244\326r\247\355\275\203p\335\225\333\214\233OK\204\376j\004\330\"\024\265D(\007[\204\376\366\311o\307,\231\005X\212\212k\247\355\275\034\nZ\322\250\352q\363\227\266\b\325\226\b\375m\230|w\002\223a8&^\341\317@\270B\374W\207\003\266\026\320"
+	.string	"\017n\377\323\303\f\r\216\3773\203\253s"
+	.string	"\030\330\306J\340\277\034\300\315\377b\254\bl\330n\341?+Pr\2410\330{\376\363\202\013<\244\356\005\021\006\273\303\353\377\fR^\026g\317\217}\244\270\030,<\033.\303_\377}\200\335\217\207\324\375W)\312-q\013\3763\305g\314\374\366\304o\303X8\\\346\267h\277\245\362\333.$`2\277U\373-\363\267U\322~\3336\002\246\363\300\177\013\374vL\303m"
+	.string	"\236\373q\230\037\340\317b~,\343\313\217o\374\027\004\366\322\345\032m\007\277U\300o?\270I.?\346\372o\003\266\374V\370\333\020X\023\354\357\267\305\037k\331\371o\n\376\273q\226\3376\177\313\346\307o\277mS\202\377\232"
+	.string	"c\371\355\230K\001\354f\307\352\374\317\340\277\206\037\267\375\370\312\217\253<\304\237\331\330!\377\225"
+	.string	"F\373\361\b\250\374\266\353\277\"\360\361\307S\316NX!\345\277\037\300\373*E\371_\302\377\002\374V\204\017\340\317\\.\0060\224\037#-\377[\342;\177~\373\355\0226\373\235\332\177/\300\243\177\226\202\313\376\013\002&;[6\023\203\237\374\347?w\300\375\017\363\337\313\1771\377M\363\037\355\177\372\237`n\0060\031\036;\357,\210a'\031\374x"
+	.ascii	"?&\300\377\373\243#\376\253\366\337\265\377Z\371o\332\177\251"
+	.ascii	"\374\267\312\177\231?\376\020\366\337$\377\235\362_)M\376\007"
+	.ascii	"\375(\b~\314\344\307J~\214\344\307\312\037\203\375\230\310\217"
+	.ascii	"\203\374\330\307\217\275~\314\343\3079~\214\343\3073~\034\343"
+	.ascii	"\307Q?~\372\361\3761\n~l\202\037\237\360\343\246\037#\177\274"
+	.ascii	"\364c\023~\234\364c\341\217O\374\330\003?\346\300\2177\360\343"
+	.ascii	"\022~<\302\217\037\360c\016~\374\341\307G?.\300\217\215~l\341"
+	.ascii	"\307D?\356\371/\234\377\346\375W\315\177\307\374W\314\177\331"
+	.ascii	"\376\313\365_\035\377\335\372\357\215\377\326\370\357\214\377"
+	.ascii	"f\375\367\352\277U\377\235\372\357\213\377\272\370/\213\377B"
+	.ascii	"\375\327\351\277'\370\357\212\377\246\370o\323\177\221\377%\301"
+	.ascii	"\177\215\377]\372\257\t\377\035\376\027\351\277\302\377\002\377"
+	.ascii	"\373\373\357\007\376\333\201\377f\340\277&~\373\301\177)\360"
+	.ascii	"\377\356\277$\374w\204\377J\340\277B\377\025\361\337\b\374\027"
+	.ascii	"\204\377"
+	.string	">\340\277\r\370\357\002~[\343\277D\377\035\372\317\366[\021\376\013\364\333\276\337\352\375\226\314o\341\376\217\370\355\227\337z\371m\226\337\202\375\026\310o\215\277\235\300oG\370/\367\237\354\377\361?\230\377"
+	.ascii	"\350\353\353\353\373\265\360\257 \374A\360 B\313\355\025F\271"
+	.ascii	"\367\226\006)\027>\033Z\231\357\344\341\206\016\021#\037*\034"
+	.ascii	"L-7\377\002\030\375\3478\226\231\343\3445\020\264\270\236\236"
+	.string	"@49\322\245\347\323\334\262\265\226\006\007N\022\333E\346H\217\233\177!\211\276ubs\336-3\347a8\243\345\227SQ\336S\013\r~!\210\376\263\033fv\223\253\200\240\305\345\204\207\200'\3135XdRs]n\376\005\2556mr\332\2211za{jj5\340n\376\205\026l\330\200\211\242\315\306\350\362n\276\0055\372\317jn\231YM\246\222\237\242\354+\nvG\346\222\031\n\023&7\256\334\335e;\255&(\314Z\334\\Y]]\266\323{o\247\345\266\302`\003\t\220\2316\254\034\226\231\355\346\224\200U\271\371\026\216\350?\233\271ef3Y\n\b_\\\033\013\204\2231]z@M\256\354z\350\240\243\313d(\354\275\2672\245\242\366\244\271\263T\003cC&\r\317\020(-x\334|\013Rc>&\213\231\300\336\333IhC\331\205)\267\226\026\207\237\031v>\206\334\374\"3:..\213\331\331\233"
+	.string	"Y]Z\034r\324]\232\037y\317bl[\217\335U\330\223\233_\264\246\377\034\206\231\303\\4\r%\265\237x|\340d\256\213\006?nO\246\334\335\374\"1\375g.\226\231\271\344/X\035\214\311\255\301\362\251S\244\352.\177\371s\227\354\345R\2513K\262\343f [\324\245\377\254\345\226\231\265d(\032j\357'\033\034\314\222Z\032\370,\321\222(\271\371E14[~c\313X\320\275\355\222\313*\231\257d\346s\333\3332\026\273\223{km\2476\036d\341\235\t\263\267\265\222\034\376\354f\231\031\313\327\370h8\307\260,k\334\374<\333\366\177\347\364\322K\303v\363+\324\351Wx\323\277\335O\311\2757\326\271\334I(\037\364\267\267\247\265\034\376\037\213\255"
+	.ascii	"\376\347\27590bo\026k_{o\373F'a{\302\261a\237r{Gu9\201\320u\025"
+	.ascii	"\325UC\352\254\353jH\352\254k;E\2019\r%w\227\223\324\331\336"
+	.ascii	"CQQN!p]I\235=\355!\251\263}\265Y\314]\331\275\354r\332Q\\{hG"
+	.ascii	"\355\247}\306u\265A*\252\353J\352\354\351jH\352\254\353j\237"
+	.ascii	"um\241\035\365\224|\021\265\223C\373\254\253\315>\343\272\022"
+	.ascii	"\222:\343\272\222:\353\352b\321\300\240\323\233\201\3665\244"
+	.ascii	"\312\216\221\212\3321\252\266\236\222BrRK\256]\267\267Mk\261"
+	.ascii	"\223[no\001\354\275\305\225\254{\252a\333\240\344b@\255=q\331"
+	.ascii	"\345\336\033C\025\224\027\327\216\222s\262[NJ\t\327\336J\240"
+	.ascii	"\224v\325\336{w\340\264\224\333A\254\234S\217\255M\325b\357\f"
+	.ascii	"{\271w\325\336Nv\313\355\275\235\366\336irk\271\367\r!)eU\325"
+	.ascii	"\336ZFU{\313\311\255\305\3367\rM\333\225\324\231\027\327\007"
+	.ascii	"7*g\312\355b\351d\245\250\270\266r\327u%\365\231"
+	.string	"\023\224M\265\367\266n\264\362*\013/[1\352\001c\246\207\220\233_\201Kg5#\"\276\261&7\277\202\f\235\321r:\007\313\21387\277\202\013\235\247\354\204\025\311\002r\363\211\322,{\332t\250\311\2709G\371\201rv#\312\315'\212\323y\351\363\324EU\204-\227\361T9#\243\354\346\023A\311O8\344\261\235\250e\320\216\03179\322n>Q\230\376\363\214[f\236\221\235X\247\244\335\333\n\335\234\346\336Z\032\360,\t\262\267\343\3460\032q]rn>Q\020\315$\343\310G0\224\244\005\240\3264\263\222\274$7\261\314\314$#y\246\221k<g-&\331\006\233f\326b\222\223\3545y\320\320\311\371\241\363\211\264\364\211^\350|\344\317Z\371FV\022\300\007\03587\033A\275$\233gn>\005=\375?\023\311Cr\220\374\225\213d!\226\231\301\362\017\265\f\226w\344\036\030JR\263A\3055\275"
+	.ascii	"A\243\334\262k\356\275\314`\331\007\\\216:%X\3261\206\307\204"
+	.ascii	"/\310\f\2344/@\371\024\250\350SH\242O\341G\366\262ghA\346\334"
+	.ascii	"|\nV:se\036\226\231\273\276\177z|\264\245=\335\254b\357\275\355"
+	.ascii	"\265\240\351\265\240\247\020\245?\204\247?$\247?\244\246?\364"
+	.ascii	"D\243C@\364\345,\021\212r\331\"\364d,\021\372\241,\375\347\254"
+	.ascii	"[f\316\312W \244q\355,\020I\234\2644H\303\244\331dn\276\320\236"
+	.ascii	"\3763V\276\322\342Q\346\344\346\234$\201\032Y\337\315\027\232"
+	.ascii	"\323\177\266\212q\326\303\351\305\3151"
+	.string	"\376?W\371p%\271\240e\271\231\352>q\222\312\273\371BZt~\221\241\262\024\210\026\311\235\030^j\315\374\";\331\266\016\234<y\341\355\345\251\f\3032\363\213\374\244\271\324\254\254\240\371\317R\331\305\016_\016\030a7\267\330\371\361\343\314\276\371BD2\213\034\225\231V;\310\315\027\332\241/tC_\250J?\250\216\376\363\356\303C\352\200\224\351\253\243\304J\036\223\233\325,\327\260\2745\253n>\007{Vrp\034<\007\323\261L\314\207\357\326\324\356\034-<\\u6\240(\241=\005uCI\306w\351\234\rCIZhAg\243\271\367\276p7\342\250x\362\203\362\340\350\3111\233\203\344f\275\377\307y>\\I\215w\306n\312\315o\276\364\244\240n~\220\032\375\0377q\033\214g\231\330\r\256\373\235\302v7Z\356\275v&\210\033lFH\223\f\273\301h0\033\rPR\373\311\013\203%G\272\364\366:"
+	.ascii	"q\255Q+\243\363\217\331\254\301R\007\257\315\315j\226\250\222"
+	.ascii	"/\274\267\233\037$\247\377[&N\203\357\226\333\350f\331\005Ys"
+	.ascii	"\363\203\336\364\203\256h\273m\021\372\240)\372Ab\372AG\312\220"
+	.ascii	"\t\3521\307j\007\035\236\263LL\006\217\261\313}\017\3048\265"
+	.ascii	"\301\240\211S\227\336\336\336K2X\316\2036]za\351X\335\022!h~"
+	.ascii	"\220\227~\220\r\375 \026\372\307qpeU6\244n\206\373q\030\213w"
+	.ascii	"\266\313%\246"
+	.string	"\215\216\275\233}0\030\262tl\213W\332\315?\376\322E\f\007\026\0307\237\203.x\213\003\222k\260\274X&\356\202\271|\003\017\310\202\360\266\336d\345|\2408\372@g\264P\301b\214\224A\271\371\226\214Y\034\245Z\024\333\006\204\367\326\261FIV\306C/loI\235\346\233&|\315\275\227J\372\220\274h.\225G\364\302\366\250`)8\007P\324r_\365T\271\351\205\355\355\275L\262\237\234@\034q\322\013\333[.S#Nza{T0\023\233\306\312}\201@F\247\211\303\234`26G\364\302\302\240l\254\246\215^X\030\276\202\247`&\266\202\331\260\033V\303m8\rc\301Yp\025\214\206\337\360\232eb*\370\354Na*\370\b\017\275\2600\2369m\342hm\310\0072\323\007R\242\017\224\245\017\004\245\377#G\377\347\214\376\317\026\215\311.\036\303O\216\311\260\3307\360\340>Q\230,\357\375dm"
+	.ascii	"\200\254\r\300\251\245\310\223\0244\377\247M\377\007\212~\232"
+	.ascii	"-B\377\263D\377\207K\377\307\205\276\017\236\276\217\027}\237"
+	.ascii	"\245\276\217\020}\037\033F\3002\234\231\235\220\233\213`\"\226"
+	.ascii	"\211\301\360\22070"
+	.ascii	"\034\304\266Y9\255\017\304\322\232{/1\030\026b\323\240\265\231"
+	.ascii	"K\356\355\2754\352\320\301\247\017\t\031\032\232\337SF\277\307"
+	.ascii	"\212~\317\021\375\343/\374\343\207\307\216\265\251\233o\033\354"
+	.ascii	"\002/\3334\323\253\n\b\356\201}\340.\354e\231\370\007\336q\314"
+	.ascii	"\205y</\367\216\372\200\177`\033S\315\037X\nk\341e\233\005\350"
+	.ascii	"\250\360\017\254\343E\363\007\276\201sX\271\264\375\204\205\200"
+	.ascii	"#<\204\224\371\230\211ce\347\223-\227-B+X\"\364=8\364{\222x\313"
+	.ascii	"\322\351\311yq\363{\2340\016\0368\372<ht\r\f(X\0319Zn>O\026-"
+	.ascii	"\007gY\271\257\\\207\331\244\201eX&\236\201\2478\3003.\036\206"
+	.ascii	"\001t\356\375tE\271\367\356\200\241C\317\216\036W/\320\214\025"
+	.ascii	"\205\367\274\264Y\271\371<biJ\\\245\226\304W8\206eb+L\025\205"
+	.ascii	"\255\200\264A\262\327\301\250\303\251\327\214\323F\347\363h\351"
+	.ascii	"\357\360\351\357\230\321?~q\f\343\302\261\\)V\026(Xn\266g>\034"
+	.ascii	"\277h\333\322\202/\016\267\300\340\003\306L\225}\363w\252\350"
+	.ascii	"(\fe\231\230\305\215#\007?Y\271\257\020\344\360}\300,.^H\366"
+	.ascii	"v\224y[U7?\203\244R\251\207$\354L\313\207\030>0\260lg\304\345"
+	.ascii	"\244\327\023F\205\207\265\027w\006\310\332\315/@\232!CR\"\025"
+	.ascii	"\336P\351!\341b#MNJ\344H\022/\2522 @\322 \366\006\225\233\fT"
+	.ascii	"\312\264\364\353i\220\036.S\254\242\230\375\337\301g\256\210"
+	.ascii	"\214\335\374\002\314H}\244>\262]\217\030\025\036\326p\251\247"
+	.ascii	"\206\347\345\205\346\306\202A\223\027\343\314\216\035)\017\013"
+	.ascii	"\344\r\357MO2\r\024.\\Oy\374\344M\221+#\200\2264G\232\343\274"
+	.ascii	"R\203\302{\263\347\246\004\306SZ\215\032)\016\033e[Up\233c\302"
+	.ascii	"\267g\245D\214Zz\343)\016LvZ\361\362\306Lm\334;65\310\2446R-"
+	.ascii	"2br\220\351/%V6n>\001\224\244\3114\231\3160z\303c\302\267\007"
+	.ascii	"\304'\026eM*\343\351\f<\004\306\023\2524k\007G"
+	.string	"\362\216L\232\225b\021\317\232]\302\264\224\2177Z\351UF\362C\243\205\030\332\315'@\216\026O\251Z\2441\322,F\033*j\353\bB4\207\352\214\330\336\226\332\342\220\364cG\230\233\377\264\352i\2140h\337\224\266\256\233\237\267c\2270\235T\2719\205\361t\352\337I\317\224\001\023\345\346cPF\247RO_\374;'\216\254;%7\037\0039\375\247.\376\035\237\2570qx7\037\203/\372\030\274EEe\273\343\250\255CLy\267\\H\355=yzBAE\267\025\024fFM\362\346c\220\225\356tg;-\252\261\260\2362aSv\320\251S\247Ie\226|\212\022C\345\346\017`\215\217\017\225\223\"\241\032\013\343\271\301C\r\327\315\037\200\026\0348\250\034<\252&\315\260 \036kVqq\216\312\361\251\303\272\222c\217\207.\t\307\267\207\306\t\311\263R\252\311\313\313vdTL\312\316\033I8\273\233/"
+	.string	"(l\330\240n\254\320\022\212\356K\3513#H\030\021\274\243n2_\220\255+m\376\357\244N\326$\203\264A\233M6O\226M<\205!\305\222\343\342\202\210\0325\036\\\t)K\255l+\256\233/"
+	.string	"\032vv\350\035J\203\312\210\234\260\036!Wq2\320\034\275\303pB\222\234\2451K\242\365\243i\306\fz\306F\331V\277\267&Xa{kq\330\301\213A\346v\363\231\2379,\273]\206\f\231\214\305*\241\002K\206\2151\221\300\271\371\001\020\202\302\035\016\235\263Q\266\225\221\233\034\007\214\367\305G\2171G\347\276S$oO\310\315\317C\345\376\357\364\304\335\300\252\223C\305\324\315\210\0016\205\0045O\270\334\214\306]\035\370K\221.nn~"
+	.ascii	"\272\300\200\311d\372\305\336"
+	.string	"]7x\262P\t\031*\"\327\344\346oh\243\177\324\013\352\005\223e\247\345\266\252`\306\265\006\353C[R\352\346o\200\333\262\005\345\222\243\226\373\312\004,/\274\275\235\354\242\001\220\232\0268XnF\271l`SSC\263\200\240\265\334X\033\310\232\323\026\246\266\244jgy\343qQ%\203\311\315X0\332\026$sn\376\2063}\353v\205\215\022e\242U\326|@\231\250\225\005|\241\362B\342\206\266\241l\226\2112\321\265f\f\2637:\177\003\020\375\r[\372\033n\350o\320\322\337p\245\177t\211.Q4\241\026\311\235\030e\304\232;\331E\203\035<\0314\366n\376Q4\224Jr\r\335\334\315S.\020\276(_7\377\202:\372\034\240R\320&h\024\274T\216\340E\247yf\231\250\024\024\212O^\016'\0349\243Qvr\344\230\203\272\371\027\334\351_ \247\177t\t\272\004-\263[I\2012c\315\235\324\322"
+	.string	"(\016SJy\363\023\240%a\270\304\335\374\013\3201\313D\311P&(\031\332\004\025\263rZ{_u\340\2265\247mo\357m\324\301\347\356\205\223*9\377\250\223\243bm$\342 !\273\031\r\373p\324\211\324\034\261\233y,\021\372\013\204\350_ C\377\202\026I\222\334\375\250\235i\271\321?\252D\225\350\221\034%\264\243\274r\330\0211\342\345f\037(\221$ca7\037"
+	.string	"q_G\301\276\316@\335\2452\340\334Hs3J\004-2DH\020"
+	.string	"\240\3358\312\205\336@\177L@\353\t\353\203'\251X\013*x7\373X\322\370\2423\344\346\003\240\211F\275\320\256L\226Nq\203\367f\017\355a\231\250\027\312\343\354\307\213\353E\225\234\017"
+	.ascii	"\030\372\026\310\321\250\016tG\016t\013\305\021FK\313\213\216"
+	.ascii	"-1\242\334|\013\254\350\037\235\361\317@iX\3512\2718\261\213"
+	.ascii	"\345\n\311\227\233oA\030Zu4\013\255:\331N\264\3301\223\022\247"
+	.ascii	"\t\204dj\307\271\031\275B\261\320$j\205\306\260\300K\037\205"
+	.ascii	"\262(\213\243SL\224\005\n\305Akcu`\206\304\247\351\202J\235\233"
+	.ascii	"\321\027(\fT\nu\201\266\260\300\205>\351\240N(\224\336RO\020"
+	.ascii	"\2609\206\224}\271\031}\372\271\323\222A\345\346k\210\203\356"
+	.ascii	"\263\357\344\003rZn\247\016\372\246\310P'\313D\367Y\307\250g"
+	.ascii	"\312\330\335\217\234\257\341\215\276\0063\372\344\273\032\350"
+	.ascii	"2H\337^l\2678?\371\376S\3169\007H\216\t\02337[)[\204\016Y\"\364"
+	.ascii	"N}\370\031\207\207\331\034\263\202s\302\311P\262\223\320\336"
+	.ascii	"^qmfT\346\304n\276\00676?\363\330\204u`\206w\206\321\273\272"
+	.ascii	"\273\371ts\2769\361\3166gS\303\030\335\3174'\335\251\206\203"
+	.ascii	"\326\306\002\361\206\245g\f\215\031\326\315:\255\310\022\267"
+	.ascii	"\233O\273\363n\347\215\212n\353\346\237h\376\357\360|\315\025"
+	.ascii	"Yr\363\255K\311\222Qj7\377<\203\351\204y{q\363O3\377wRp\307\303"
+	.ascii	"\311\315g\031\335B\003\221\fv\320DQ3\204\314\3172\026M\004T8"
+	.ascii	"\264\330\334|\366\370\360\223\3145\222\006\006\314\315\327`5"
+	.ascii	"f\314)&\343\275\237\342\332vRK\203\035\245\330[\335\315\257\240"
+	.ascii	"O\377\247\333-\363t;\305\200\240\265\367\025\2106s<[,\320\274"
+	.ascii	"\334\034\027\0246\025\003\354\346W\200\247o\337\274\234[\254"
+	.ascii	"\234\326\007aN\232\\\214\234_N,\347\026\027Pe\315\275\023\356"
+	.ascii	"\004s\206\261\314\363\313\331\305H\327U\201y\243\363+`\323\257"
+	.ascii	" \212~\005K\364\371vf\261L\243S\313\034T\214\255\233_\001\230"
+	.ascii	"N\301\266"
+	.ascii	"F\350\373\254\021\372\n|\350W\220uv\3754r*\317#\226yv\235l\037"
+	.ascii	"\240\366\323\027\006m\346\2664\260qX\352\23273\227S6\254\244"
+	.ascii	"\335\374\nZ\350[2$\247\222\272%g\02221a\247\230\225\373\002\201"
+	.ascii	"I\230&\331yf\345\264\204v\0243M3\355dr&\001r\032\332"
+	.string	"\273G\334Y\345\274r\256\235j'\332i\3052\317\264s\354\247\362<r\2433\355l\002\327\334{\331c&\317\210\034PFr5\032\240\244&P\206\346<;\237\234R\254\234\326rc\365\\I\322\004\353\234rR\261\314\363\354F\313\275\3230\374\314\261\333+C\363\177J\211\342\323\006\003\207\213\233O(\366\f\314T\217\233\237A\213\376O3\313<\227A.\220\320\001\273\371,\273\232\027N0\246n~\336\265\374\337\3113\334\306\340n~\006,\372\031\326\3643\230\235Nt\231f\216\270\233\237\301\211~\206%\372\031\224\372\031\276\3643x\351\377Tr&9\317\276\274\211Kb\333\350\340\250\240n~\206\035\372.m\021\312\301\022\241\347\220\263\310\t\366\357\004\211\265\375\260r\3633\324\320?\211\374\337\261\200\0201Vn\316\366Z\3203\310O!\377\316\005cDYu\3633`\351\237@\316\257\177\007\250\016L\r\312\315\317"
+	.string	"C\377\374a\245\357\215\215\233O\037\272\005\006\276\fxr0w\340\360\372\351\343?{\\'\213vB\037\03587\377X\"\024\207\371\360\323+nK\323\254\216\213\253\317r\241BG\305\324\241c\215\020\266!kn>\006%\347\326\271u^\335.I\340\232[k\213\003\032F\t\204y\3631x\331\260q\336\330\260\367n\261U\324%Yk\262P\362c\354\274\221\3110\232&rF\260j\324\310vO~\326\360M]\335|\f{\306\214\363\212\bf3g\013\2256YY\031\013\216\0217r\210\215\261\262:\257\222\300Pn\255-\016)V\216=\270\233\3773\371\363*\323\231\231\251\273\371y\231\354\377\016\032g\305''KUU\306\262&\225r\2322\"ej*\316"
+	.string	"u\370x\030y\361\202\t\004#\316\323\323\225\013\027;M9\207-\217\310\3157b\241O\026'\213l\367\301\221!\312\251=&rqN\250\023\212\016\026t\227Y\005Y\323\327w:i()\256\235e"
+	.string	"'Q\274\360\366\366\336\322 \210K\f\027s\316\235\276\201c\233\223\253\354\202P\335\374\013s\346d: h\005*\361\004pm\032A\341JGH\245\025\270T\034\002\217;+\320HD:O"
+	.string	"\327\246\021\352\257\347JG\036\214C$\223\252F`\351x\342\302ZT\221\303\n\306\022\204E\225\t\331\204\f\272\322\321\222\361\310\244\252?\001\030\211<W:\352\271\322\221\212\243\007\025G\"\"\260\23044\241\242\204\272\324\204T\217@\253j\202G\350c\0029$\372\025-\020\201A\245\025\270\344\001\271\016Oxh*&\035@ESqH<@\007\t\370%"
+	.string	"\204\n\017\252\260\211\030,\016=\034\221M\036<\2440\036\225Vc1E\002\252\304\274\"\213\306\340\211\264\026\207G\"Zt\245\243\340\361\027DB\252(\216M\"V \005\244\272\002W\023EW:B\0065 \203%\220\300_\360\350!\270\"\233F \f\241\"\233\210\222\206(\200\305\013\220!\220@BEf"
+	.ascii	"\311\224\304s\245#\025\t\210\254 B\3218\\\325\246\245\241zlj"
+	.ascii	"Z\032\372\020\211!x\256t\304\364SW\340\221h<\256E\353\260H\202"
+	.ascii	"p\310\224^\351\250\002%\220`\302\303\252&\035\201\253\tA#Q\204"
+	.ascii	"z4\212\b\022\206@\0027\240\n\215K\307!\220H\375\251\301c\223"
+	.ascii	"\321\304\332\304T\034\376\254W:\362P4.-\031\203(,\362\207\002"
+	.ascii	"\251\304\243d\221"
+	.string	"\026\211\256\024T\241q\211g\275\322\021\323\360\270\"\205*\321\203qx4\022\215\301\023\371C\252E\310\243\221\030T\231\220?+\230\214\"(T\260\260^\351H\003R\004\241J<\001,\252A\310_\320\261i\005\252H\026\254`2\212\240P\241\202U]\002\026\263\2218d\372\371\357\n&\243\210\241\242\003W\240pU\221@?u\005\022\231\226\324\0224\254`2\212\bZ\257t$\f\242\300\200B#}~FU8D\341\203\032\177Jzh\275\322\021S\223\361\230\364\003\036\201L\0360\b\026\233DXU\244Z\"\211\251\247\210tO\344/\211\311g\375\025\223\230\316b\022\023VO\030\"3\022\251\036\205B`\272\202\311\030\314\307\225\t\013\325T\250\"\23322\375\361\227\304t\364\263\342\270\"\207Ij\211_\020\005\021R\250\036\217*\222z$\261\252I\030\220B& \201#\"\260\252IBDb\210\241#P%\212"
+	.string	"\"\022C\004\255\252\t$\244\013\034U&U=\341\243&\025\201JA\241\025H\303\325h\001a1\004\n \222\b\270\002C\020\016\211@\r \213C\340Z4\21286!\213\252\005\352:<\246\350\031q\201\022$$ \001!P=\362 {\220(\205\n\033pp4\001\021%l\300\204\210\035\241\241\021T\fE\020\026C\250+P8$\002Q\030]\240\256@ \025\251\036}(\214(\"\032\217k\321(\""
+	.string	"\"V5\tCQ=\036\233\202C+\200\307c\b\344\005\242\377 \340h=\002\231\216H\254*\262\302\203\303\243ZT\223\364;H\300\001\022"
+	.string	"BEz\020\f@"
+	.ascii	"\003\020\200\036\004\003>|`@\002>\350'\340\003^\327u]\325\237"
+	.ascii	"*4\216P\217M\304!\020\351g\375m\300\301zT\327 \360\bT\n\376V"
+	.ascii	"\243\361\204z\024B\002\255W:\362`\034\256\027(\230\200\004\216"
+	.ascii	"(6!\371\250\277\365h$aa\310\303\204\\B2%\r\255\300\243\260\t"
+	.ascii	"x\342\247\302x\302\204 \220x\302\002r=\032\231zNP\372\251+P\310"
+	.ascii	"\324\364+\"\002\207G\025Id\"\303\272^\351\b\351\241\202\325G"
+	.ascii	"%6\0353\362\207T\211M%|\232J\030Q\034U$\220^}F\234\310_\312"
+	.string	"cDqTM\250\310&\375\243\n\215#v\204*\362\250\242P\217?\344/\005p\005\221p\310\324\203D\252A\343\221\351'\0342\r]\351\310x\\\221\224\301x\\\221\344\303s<1$\002E\254EuIEa\034a<\256H\332\260d,\252\302_\260\270\002\031\204\304D\324HLD\nBD\2431\002\277\363\004%\0236\340\340\247\"\233\200Td\323\317\270\366|\370\260\301\357\004\245\n\033\374V$#\022\031\034\026\215KG\240\222\321\tJ\277\342p\251\210\004L\307\237\361\270\"I\350JG\352\321\030\374\005\221<\004Ed\370\025\215\3035\250\036\217\306\340\017CQ0\b\344Q\177@\305\244!\021\370\013\006\201;\352\021\230Bx\004*\375\202A\240\317\272\376\220T!\206+\035Y\220\002\270\002#+@\006\207K\300\342\212\020\212\214G\265\003\301 0]\221T\341o\275p\245\243\242q\b\364\200<\032\221E\025)"
+	.ascii	"\245\340:d:\221D\242\361\230\221j\023\021\210\002m\372)\005\327"
+	.ascii	"!\ta1\004\221h<\022\245)\200G\214\\\032\036K8\252\253\272d\004"
+	.ascii	"R\270\322\321QU1\\\312\360\263^\351hmbZ\233\214\277\245\024L"
+	.ascii	"\036\220G\025\305\360(\334\260\376Rd\022\260\004\343\020E\241"
+	.ascii	"\206\240\256\300\022>Dc\320\270\032\217$\204\212\306!\362\250"
+	.ascii	"\242(\222\260\224bh)\005\t\241\032,\256@\0263\240\"\233\200V"
+	.ascii	"\034WuI%\252"
+	.string	"%\254F%d\b*\262i\b\205*\304j\023\021\250\201UE\"!]@%\nI \002\327a\322Ph\2418\\\352YU"
+	.ascii	"\227z\204E\340\322\2221X\034.\361\254\305&\243\b\225h$q4\256"
+	.ascii	"\306%\240U-\241\204\004\036E\b\207L\024\200\220?\237\365JG\302"
+	.ascii	"!\223\207U)iH4\n\301\"\177 \204C&\224\204%\301\n\207L8\005p\005"
+	.ascii	"\317\tJ?$&\242\317\tJ@HH\306\265)\370S\n\256\306\"\005\225i\305"
+	.ascii	"\372;\252+q\210\364\033Z\213j\360\250\222X\213C#\t\246&aq\270"
+	.ascii	"\201\013=)\200\034Xj2!\0342\001\025\215\303\025\210,\252LKF\021"
+	.ascii	"\302!\211\025x\002\005Qq8b\r!\0342\t\251\304\244b\210\240\025"
+	.ascii	"\353\020\305p\035\"\213\252\t\242\212B%\n\255A\025\t\211h=\252"
+	.ascii	"L*\324\337J\034\256\277\242\361\204\341\321\250dT\202J\\W\343"
+	.ascii	"Q\251\004\013\305!p\204\243q\005\036\325\245\243\272\016+\030"
+	.ascii	"\207+\260\204\n Q-AaUJ\032\252\0330\261tTW!Q\211\024\300\025"
+	.ascii	"C\353piX\001\242\032\f\206PW\340\021H\230$$$\032\225\220\352"
+	.ascii	"Qi\375\255\305\241\221iU\221F\352\322p\345Y\177\t\370\260\026"
+	.ascii	"\207Mz\005\220\250\n{TbR\021XA]\201\307\337\212\243\212\302\030"
+	.ascii	"T\217?%$\360\030$\272\322\205\033\231\324\243\207\325h<z\350"
+	.ascii	"A\376D,\251+r\005\022H\205*,\222 \0342\005\251\304!\222\361H"
+	.ascii	"B]\201%T\024\3035\b\034R\205\306\245_R\323\tU\310\203\f\016W"
+	.ascii	"\344p\005\256\310\237\tH\340\032\264\376@\254\305aS\372\005,"
+	.ascii	"@\304\206\fX`\004\035<J\032\"\025\215A\017A$\017\305!p\311C\360"
+	.ascii	"\210\364pdA]\032\226\240\006\201\307\021\222\212\303\245c\210"
+	.ascii	"\342\005\216j\n#\223\205#P)\230\217\352\020i\270\026U!\t\302"
+	.ascii	"#\320x\"\350\251\233\324M\n\307&\223n\n@\347d\212l\017N\252\007"
+	.ascii	"\205\254\206X\252\227\346E\301*\243\223\227=sI\345\226\364\215"
+	.ascii	"\345\262c$\016\311\335\315\347\340\246\377\024\017\235\273:\336"
+	.ascii	"\310\331k\363%\207i\331T\356\356R6d\034\306\344\326`\245y\312"
+	.ascii	"&]s\261\004\351\263K\327\244jx\262\354\246h9\203\314\311Z+\323"
+	.ascii	"\177\212&\rr\336\315\215\035\261#\022\001<*\037K%haf\3223i\f"
+	.ascii	"*{L\254\233\227d{/\201P&D\\\270\225\251rv\341\372R\226\222\311"
+	.ascii	"i<\246\320\256\334\034\027\227\316\rI\371\252\274h\244c\236\316"
+	.ascii	"]K\2134o\346nN\345\364\0345327\247b\256%\005\023\347\265\203"
+	.ascii	"\203\r\315\226\206\201\242\334{\013\371\240ys%\355\346s\310\322"
+	.ascii	"\177\n&\235\201\307\360}\315}\311N\242\360\261\360\222\342@\263"
+	.ascii	"\322\334m\351r^\235\245\211C\207K\312\243\216\313\007\325\315"
+	.ascii	"AI\336\304\266h9\235\272\230\201K\263,\2032\002\346\215\016\027"
+	.ascii	"%\031\2265&]\23257\263\261\245m;N{\307ikKm\200\031[\302\271\371"
+	.ascii	"\034\322\265\265\364"
+	.string	"\312)<\355\r\265\267\016'\0060C\302\204ook\311\340p%\315*\241\213\211\033^Z%H\211U\017/7?\0033:U\303rh\026#oi\231\212O\225,s\254\320\356N-V\234\276\250`\255\374\204\215\216\335\024\324M\025\272\266\2623T\016\327\333\214\262\233o\231\251\224l\227\325l|yE\311X\366\276\224y\001\345\f\017\035\260\270\275e\226\262\327|\351\273y\351ce5\204\253\354\024s\301\324\255a\361$C\001\262\201\006f\013\331\251\206\207\317\314\210r\214\206\026#zibP@ygn\234q\202\036\201\261VU#\f\375\301F'N\225\233S&)\023\f4\327`\245`x\3008\273\371\031hI\225\244J2\026#.'=4I5G\316\336~\213s\3633\360\201\004\t\036\225^\206}\250\363QdZ@&\346(\216d\n)\243\324\fm\322\034\203\025@0hP&\222i\303\246z\023"
+	.string	"D\013\314\344q\244\346\034T2\"\"\"IR\220L\273\001\306)p\250\213\317@\220\367\307\305\302'L\305\250\276_\025[\020P\224>8W\314s"
+	.ascii	"\302\024\246\240\252\224\302&\3165\235\211\335\016\216\017~\363"
+	.ascii	")\204"
+	.string	"\241P\030.\366\345\217\246 \310\020\347\n\345\324\247\230\023\203\251\316D\244+\256\222\336\353\335S\312g\3375Db\031\217u_Pe[\330V@t.E/\213Q\367X\020\032\220\274\206\222\272\037\334?\215j1\337\262\212rZ$\004\257\355\342\016\221\253\366\nj\021\321\267\177-\254&\252\005\351\004\266*+\320\270X\3551\033\262[n\037<\\%n%\307\351\353\220\027^\327\236J\035c\252\013\260Bj\372\232\201\022\345\177n\362\252\304\006Q\340.\200^\024\3511\177\251<\203 df)4\257\240\232\264\032\034\240\3635\253\251dS\350\313ux\303\032\300G\031r\266\335\025\312=#0\274\327\0371\346\312\262\324\203T\311N\233\021\b\267\312\301{}Q0!\313\216\234\0173\277`zad\260\231\017t\224:\022\037\251P\315\334\361Y\226ic\212\242\f2V\262\376\317\314\330\006\224\035\330\033\031\246\241\363e"
+	.string	"\355\256+A\023F\326\b\246\244X[\202\022\254y(\355r\216\212\233x\202m\246\020$\356\220W\272\3014\262Px\212\203\272I\202\253\024\271\347\b\244\301\004\324\376c|\"\316<\254\305"
+	.string	"\225X<q\3416\220e\335\257G\324\276\242\334`fmE\344\252%\177\261\221\370F\267\035Z:\201\013fn\356\224\375\357d\255\355\273_\006\330\320j \236g\022\202\035\272 }PQ\241\351\007\025\342\006`\245\232&\264#g\233\215\350\312\325\370_Wh=K\202\374\215\355\324\230IY\322)\004\264\264'\035\227}\005\005\b\035uY)?\031\006FQ`\214\371<\016]\003\261\374n\315\202P\336\335\353\034\217\311\347\203\221\266&X\021\241?\360"
+	.string	"yd\225\261\356\030\024\210p\ro|\026\362\363\250\364j\376\375\2003\026\224Y\376\026\235\320c\236a<&:\300\370\214)\251;~79\233\023\316[\342B\203e\256Q\330MsT\3228\361[z\304\303\305\205\331\267f\377\016\237\273\313iL`3D\363d\"\370\211V5/-\250\237\346\213k\f\264C|R\222\213\340)\200\001\371J\352\036\t\213\212*:\371g\253\357\027N\266\316\017A\034\206\324\370*\364\026IW\253\263\037\346\343\276\336\227\370\313\303\215\223\231.@3\332\235\327\240|U\256\3721\344\346\006\r\303\335\001\241\271~\253L\207[\2064\344a\3058\367"
+	.string	"\007\303!vp\017.\03556\034\020U.\026\245\272\353\326\3010\tG19\374\211=\335a\312\023\232\2654#\2105\352\004\025\211\353\330\350\370\362\216\310\031H@\360\030\331.\304\022\346\b\025\331\230\0057\224\321#?\354\306\004\025P\313w\242,/q\005\3238_w\262\331g\311\253\231sJ\033\267[T\343(`\220\273M\217\336\272W\005\345V\223\275\310\n\215d\362$Z\032y\032j\031Dd\360\262~\203_\362\376\364\231\340]\376`\236\216\301\2121\336\237\367"
+	.string	"\""
+	.ascii	"\343\b\202\0368\207C[\310\021'\204\367\207\031\262E\375F\177"
+	.ascii	"\246\267\334\371\245\030\255\3739\211\324\334\032\227\330fI\243"
+	.ascii	"\300\220\376\024${;P;>~+-\002"
+	.ascii	"w\355\005\375\210gE\300\204{\333\004|\311f\254K\t\372p\305\243"
+	.ascii	"){sP[@\247\244\206y\333S,\240\375*%\205\307+\372\247\377c>k8"
+	.ascii	"\310_PI\366O\356d^\355Xl\361Ls \361l\332\001Ht\366\304\rY\270"
+	.ascii	"\202Qjb\3346#\226\304\350D%\300\314B\356k;\317~\274\214\242y"
+	.ascii	"c\376\345#\210\001-\273:\013\221\353xH~\267\244\334\006;~(\234"
+	.ascii	"c\232\341"
+	.string	"*\031\227\346\241\030\037\212\253XwW\351\374\306\207\031o\206\252h\305\224t\027\214\331\376\310\244\331\240yg*\201u\320\032!\310Q\221\266\026\264\301\030*\347\264u\177l\203\351\311!\024\240w\215\240\216(5\254\025\017\245W\211\277&\016\330`E\302\303_A\222\b\266\304#(\017\034\235\025t\013\024\3519\360D\355+`\025['*\216\306ZQ\302;R\325\023T\002\314\315\275n\004\230\235\240/\260U\251Jn\036\311\276\314\242\\]\221\007Z\216\261L\022\210\263\024\245\267P\351\204\356K`-\246\350,\256\003\270\212\r\274\224\377\024l[\354\355\233h(\341^M\354\020\260=\217D\347XL\334\370\345\332/\220\273\302\210\201\335\f\316^\234s[\330\211\377\320p>R\262Z\302\33005\346\254e\021\214 \366C\2771!\003KD\201\203X\340\252|\036\241\303J\331\244n.\f\270\322\302b\237-\347\274\231"
+	.ascii	"\237\207\301\320\344#\030k\031\232z\245\304\375\r\277(\362X\312"
+	.ascii	"\320=1\200\230r}\217\212J/\260>fq\271\302\246\310Ca\307\212\302"
+	.ascii	"4\343\2738\032\274a[^\274\216p\032\305\202\252\234\210\2040Y"
+	.ascii	"H\013\220\204\016\265\352\220\201\354M\373\007,\354\034\342\353"
+	.ascii	"\002`V\240p\025\321\f\203\372\252.wV\017\f\226\262r\245\356("
+	.ascii	"\276Mlr\203\242\2325\262\352\034E\027\307\321\312yG\036\006m"
+	.ascii	"CM\3722~\215 |\2751\347\013\3247\206\304h\036\315\307\303\021"
+	.ascii	"YV\204\350\0233\312\233k\376\233%2W\\ak\323)\271\200\005\324"
+	.ascii	"\215wC)Y(\253\3428\007\023^\245\212L\201\305\027ia\347%\230%"
+	.ascii	"\252\001\305\241\320\250X\013\006\023J\376\250\350\270\203\307"
+	.ascii	",\264\332\252\021\377\366\341\361\350Z\362\234\235\003\360\027"
+	.ascii	"\305S\021O\007J\276V|\302w\324\261\3441C%\r\303\313\31538e\336"
+	.ascii	"\316\374\203\024p\247@z\016\311\274\261\227\370\033\210t]\220"
+	.ascii	"\370(~\001\210X\342\210\377\"g-\242U+\255\177\031U5\244\031\""
+	.ascii	"\340\234\277\250|b\0343\231\354\315\314E\305\213\273\231\330"
+	.ascii	"F\324\"\223\371\352\n\330\204|PD\266K}\021\025\305\206\032b("
+	.ascii	"\004 \332\255\2423\227\021\207\332\321\201\036$\301z/\361A\200"
+	.ascii	"\343\3566\370\360?\274x\027\027\206)\2132\362b\347\3252>\337"
+	.ascii	"\3755*m\243\036~`\302\026S\217bM\f\201\337\246z\3125\334\343"
+	.ascii	"Y\257\344\201\372L\304\316\203&\3372nw\202Y\006\331\3111\023"
+	.ascii	"\276\377\273?\207\202\314\310\374\377\303\305l8\357o\007\317"
+	.ascii	"\236\013\303\245\037\336\365\001\302\302\025\332\203\237`\251"
+	.ascii	"\333{\013\203@\315\204\274\023\207Ab\321\031aR1\253\340\314%"
+	.ascii	"\324\346c\331\351\016\306\356\313\365\317w\267\334C\t\352\350"
+	.ascii	"\235\034W&\336\013\2458\223\034\270\005\032\321\300[A~\273\035"
+	.ascii	"}rt\343\t\016*\007v\177QH\363\027\266\003\"\367 \226\022\"\344"
+	.ascii	"\345\016\300\024\345\311|T+\236^\330\342\324"
+	.string	"\361\201:\264\262g\006Gy\323\227\257r\224J%\203\377\367r\031\340$.\016\242\224\265\326\264M\335k\365\254TK\341\330\362\252\363RT;\016\303\202Q\273\005N\365;\177\2769>q\261\f)$\037\260\017\225\365\037r\324#\340T\301\240\nZV\004\221aqPy\210S\213@\n\360]\\\035\021%\2501\031\262js\037e\223\263\215\2269#\204\372)\004\007\232\006!;OK\224|\363\365\237b\202`7n\3539ED|sm\003\034uK\303\214\271\222E{\026\204A\271\3151\273\351\023\354\237\007\005A\307\240\365d\320RSs\335\350\356\025\311\230\250\344J\242+\n. \240\224I\"\2120\311\271l\037\006\312\262\"#.\253\360\232\252d\263\235\3772H\241r\254\224d\201\367\202DP\375\236k\262\005#\373\373;{V\231\330\343^\215\177\306\240\001\177\253^\217-\302\022\371\207\3005\324\336Q\006\032"
+	.string	"q\f!D0V\265\254\370Q\001\227\315\325\270\376\327\210@B\2400\313\001\217\227\252d\306\232\334\341v1\377\201\253rL\303\f\361\237\202\334 x\374\bny\305\224cw\237"
+	.ascii	">$k\327\t,\256\336xz\237\211c\021h\013\201\3762\331\222\016\257"
+	.ascii	"\372\353\202\307F\245BA\313v#\304\347\323\217/?m\205\362\211"
+	.ascii	"\366\021Wy\202\355\030= \023\026\003\351\016\030\220\343\365"
+	.ascii	"\321(\203\304\025$QV\330\231\276!8\302_\311Y\350\314T\322v\240"
+	.ascii	"y\002\026\242\377\005(r\330?,\237\334h(\371\260\224$\254\356"
+	.ascii	"\254\326\0250\214\225f\305\376f\031\245Jr\306\370+\241H\246^"
+	.ascii	"\310\353g\263\343q%:Y\023&\006\222\026\254\304\220<\204\315\f"
+	.ascii	"\005\320\311\031\262\2708\n\367\364_\343\233\035\333\333\025"
+	.ascii	"\224\263i\255\020RZ\350N\200\325w\002\264@\266\322\307\252\343"
+	.ascii	")LC\332"
+	.string	"v3\327\206`\314>\023`\346\212\214o\247/\332\262\3617o\252\330Fl\204\261B\261\205R\353Iw\305\252\336wN\030\020\224B\r/\001\251y\313\310\346f\373\327\\+\320.\200\236\321\360\311}\221\220\332\205d\032\232bE\f1\367\361Lf6\320A\177\337<\332\270d\261\\\206b\277?@\004\212i\233]\311N\245\314\372\032\265\327+\212\250,\371w\2016y\310R\337pE\013q\244tH\201\307'\241\253+&\324Rd\247\215\310\325\211|83>\3375h\247\300\305\326\312\231]5C\034\315\0207\020\227\006\020\323\363\347\255\037\330L\365\004\254\210$\016\020\214\216LG~\213\201\355\265#\326\002\n\210\255(\360w\236&I)\222\221\210\241=\r\270\265%\037\221\361\333;\006Q\016\027\t\200\302\3778d\346A=\301\274\\\253\366\177\270\016\253>\016Wd\024\250\200X\240\be\345hA<X\374\212$"
+	.string	"\233\212\300\002\013\2234?&I\357b(\344\223\207\210D\004\n\311\242\tf`\037\216wWrx\374\255\267\317\026\342\217\206\037\213\346\272\254\253\362\330PKi\300\316J\300\252Q!Z\202\274{\004\264*\344Z\332\366``\033\32402 \221\031\357?\346n"
+	.string	"pk\201RL\250\243~J\221+V\376V\314C^\312rw>\361\237A\341P\002\237\325y,\037:\301\305\326C\377!\362\272j(\\\226\373\321\307i\322\331\215\241\226\203\351\347\267\005]V.\033\375\232H\331\357\276N4\277`P7\020\314#`A\031\244\263\255T\003\362E4\341\331\200tz\243\304\301\034Y\260\216R\327s\217\350\262Q\207hy[\003\004\371\r"
+	.ascii	"C<\200Smi\300^c\330l\350\265G\031\252gpC\316\301krN\227\f\340"
+	.ascii	"\371/v[#W\311\313w\bR\f\237AZy4f\f_b2r7PaQd,Z\312\235\356\005"
+	.ascii	"o\372\313B8z\307\311\377\364w\376\317\352-\232\224d\332\237\032"
+	.ascii	"\251\020\325\021\377E\026G\230\270\305-\371\233\273B\234(v\315"
+	.ascii	"2\277nn\373"
+	.ascii	"\352\230}\t\305\007\213\227r\017h)8\335\243\271\333\005\033v"
+	.ascii	"\307\275r{\264Pm\322X\307v1\377>\022r\203!3\314\b\353\332I\302"
+	.ascii	"\203\227\374\202x\224\367Tt\320v\005F\346\323\244a\221\024LJ"
+	.ascii	"%y\203\370\216`\216\253\207\213\375\321\203\234\237\006\324q"
+	.ascii	"\003\341\026w\215\273B\275\3207\205\303\273\004=\r\342\357\005"
+	.ascii	"\274\264\212\177\003\316e\275\0248\224#\022?Q\277q*\226\236\323"
+	.ascii	"z\352\233x\n\t\231\235\243M\033\275\212P\305\260e\016\336\311"
+	.ascii	"\305\221\376'\313\240~\376\357 \350\307\365=7\236\377Y\205\004"
+	.ascii	"\217\374\211\331\374\036\353\376?\336UQ\342H\232=\373)\336\312"
+	.ascii	"\345\327\312\364Q\344\263\023\217\311\304\256\367\374_Z\247r"
+	.ascii	"Y\267\033%\235;Y\334:\233\323\007\017\034:^\370\211X\206\260"
+	.ascii	"t\327\262\372\203\332o<\316Q\345+\364\245F\177\343\2766}]\026"
+	.ascii	">\371\352\007\252e\020a\346h0\206\210\263\312'_W\212\333\b\003"
+	.ascii	"\\A\346\242,c&\032\374\270\3338>\017c/\242\363\313\335\236\324"
+	.ascii	"\232m\363\352\347\013\327=\302\302\317\357\236\271:\370\361\344"
+	.ascii	"VmfZ\257\332\372\250\244\336\031\362\304\313\276x\233S\266g\271"
+	.ascii	"=\306\352X=\301\016k\263\324\rr\377+\276\347::L\372\267\331r"
+	.ascii	"\352\307\313\232\362\264r\317\327\233\301/\271M9\366{\306\215"
+	.ascii	"P\\\361\300\275\321o\344=\370\326\207\201=\313\360\357\347\256"
+	.ascii	"1\267\"9\bx:\361\035t3\265Gw{\304\332v,\372\234\262\216\250\320"
+	.ascii	"3\355\326a\371\230\027\307\257\020\016+\363B\362\300\006\301"
+	.ascii	"\003\340,\256wt%\320j\037E\255u\005"
+	.text
+	.section	.gnu.lto_.symtab.b79aae3b150a80b,"e",@progbits
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\002"
+	.string	""
+	.string	"getCurrentPidProfileIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\002"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\002"
+	.string	""
+	.string	"getCurrentMinthrottle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\002"
+	.string	""
+	.string	"resetConfigs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\002"
+	.string	""
+	.string	"activateConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\002"
+	.string	""
+	.string	"validateAndFixGyroConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\002"
+	.string	""
+	.string	"validateAndFixConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\002"
+	.string	""
+	.string	"readEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\002"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\002"
+	.string	""
+	.string	"resetEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\002"
+	.string	""
+	.string	"ensureEEPROMContainsValidData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\002"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\002"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\002"
+	.string	""
+	.string	"beeperOffSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\002"
+	.string	""
+	.string	"beeperOffSetAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\002"
+	.string	""
+	.string	"beeperOffClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\002"
+	.string	""
+	.string	"beeperOffClearAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\002"
+	.string	""
+	.string	"getBeeperOffMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\002"
+	.string	""
+	.string	"setBeeperOffMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\002"
+	.string	""
+	.string	"getPreferredBeeperOffMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\002"
+	.string	""
+	.string	"setPreferredBeeperOffMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\002"
+	.string	""
+	.string	"vcdProfile_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\002"
+	.string	""
+	.string	"vcdProfile_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\002"
+	.string	""
+	.string	"vcdProfile_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\002"
+	.string	""
+	.string	"pgResetTemplate_systemConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\002"
+	.string	""
+	.string	"systemConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\002"
+	.string	""
+	.string	"systemConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\002"
+	.string	""
+	.string	"pgResetTemplate_pilotConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\003"
+	.string	""
+	.string	"pilotConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\003"
+	.string	""
+	.string	"pilotConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\021"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\003"
+	.string	""
+	.string	"pilotConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\021"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\003"
+	.string	""
+	.string	"pgResetTemplate_featureConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\003"
+	.string	""
+	.string	"featureConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\003"
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\003"
+	.string	""
+	.string	"featureConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\003"
+	.string	""
+	.string	"specialColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\003"
+	.string	""
+	.string	"modeColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\003"
+	.string	""
+	.string	"colors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\003"
+	.string	""
+	.string	"inputSource_e"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\003"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\003"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\003"
+	.string	""
+	.string	"pidProfiles_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\002"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\002"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\002"
+	.string	""
+	.string	"throttleCorrectionConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\002"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\002"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\002"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\002"
+	.string	""
+	.string	"mixers"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\002"
+	.string	""
+	.string	"servoMixers"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\002"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\002"
+	.string	""
+	.string	"pidInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\003"
+	.string	""
+	.string	"setControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\003"
+	.string	""
+	.string	"pgResetAll"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\003"
+	.string	""
+	.string	"imuConfigure"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\003"
+	.string	""
+	.string	"setAccelerationFilter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\003"
+	.string	""
+	.string	"setAccelerationTrims"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\003"
+	.string	""
+	.string	"failsafeReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\003"
+	.string	""
+	.string	"gpsUsePIDs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\003"
+	.string	""
+	.string	"useAdjustmentConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\003"
+	.string	""
+	.string	"useRcControlsConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\003"
+	.string	""
+	.string	"resetAdjustmentStates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\003"
+	.string	""
+	.string	"generateRateCurves"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\003"
+	.string	""
+	.string	"generateThrottleCurve"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\003"
+	.string	""
+	.string	"pgResetFn_serialConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\003"
+	.string	""
+	.string	"isSerialConfigValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\003"
+	.string	""
+	.string	"featureClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\003"
+	.string	""
+	.string	"featureConfigured"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\003"
+	.string	""
+	.string	"featureSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\003"
+	.string	""
+	.string	"resumeRxSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\003"
+	.string	""
+	.string	"failureMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\003"
+	.string	""
+	.string	"loadEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\003"
+	.string	""
+	.string	"suspendRxSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\003"
+	.string	""
+	.string	"writeConfigToEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\003"
+	.string	""
+	.string	"isEEPROMContentValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\003"
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\003"
+	.string	""
+	.string	"pidChangeProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b79aae3b150a80b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
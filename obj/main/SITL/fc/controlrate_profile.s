@@ -0,0 +1,431 @@
+	.file	"controlrate_profile.c"
+	.section	.gnu.lto_.profile.d5fa5275d8d8fea5,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.d5fa5275d8d8fea5,"e",@progbits
+	.string	"(\265/\375 W=\002"
+	.string	"\244\003K"
+	.string	"\t"
+	.string	"\354\271\370\203\t"
+	.string	"\001\274\200\265\260\006\002\276\230\226\205\004\004\002"
+	.string	"\002\001\002\002\002\002\004\240\342\234\212\n\005\006\211\364\351\253\f\007\330\270\370\330\016\b\t\240\342\234\212\n"
+	.string	"\004"
+	.ascii	"@\030\237U\230r\337\006\260"
+	.text
+	.section	.gnu.lto_.ipa_sra.d5fa5275d8d8fea5,"e",@progbits
+	.string	"(\265/\375 5%\001"
+	.string	"\300)"
+	.string	"\003"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\001\003\001"
+	.string	""
+	.string	"\001\002\001\006\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\004"
+	.ascii	"@F\314Kl\026\264\001,"
+	.text
+	.section	.gnu.lto_.inline.d5fa5275d8d8fea5,"e",@progbits
+	.string	"(\265/\375 \312\235\003"
+	.string	"\222F\023\033\240'\351\017vUunb\251h\271\245\305Z\005UU\345e\333j$\357-e\n#KH{\n\035\233\257\344\324\307\205h{\236\270\035\f\3210\037\201\212\266\306\374\275`\241_\240\3769\007l[\363\n\227\266\b\177\005Z\264\007\360t\"\016"
+	.ascii	")\033\261\032\006.\001\034\236\222;D\3529\230^jX\013\253P\f\254"
+	.ascii	"\b\267\233\212)\220\nf\003m"
+	.text
+	.section	.gnu.lto_.jmpfuncs.d5fa5275d8d8fea5,"e",@progbits
+	.string	"(\265/\375 \\E\002"
+	.string	"T\003P"
+	.string	"\003"
+	.string	"\001\001\003\177\002\004\006"
+	.string	""
+	.string	"\001\300\004\001"
+	.string	"\300\004\002\177"
+	.string	""
+	.string	"\003\002\005x"
+	.string	"\001\002\006s\001\001\006s\001\177\002\006\333"
+	.string	"\001\f\f"
+	.string	"\002\003\006"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\252\301A8\024\312\030\237\315&S\343\r\264\001"
+	.text
+	.section	.gnu.lto_.pureconst.d5fa5275d8d8fea5,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\230\004\002\230\004\006\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.d5fa5275d8d8fea5,"e",@progbits
+	.string	"(\265/\375 S\325\001"
+	.string	"\324\002?"
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	"\003"
+	.string	"\001\274\006"
+	.string	"\260\204\200\370\267\004\002"
+	.string	"\002\002\007\001"
+	.string	"\002\004"
+	.string	"\001\002\004\001"
+	.string	""
+	.string	""
+	.string	"\006"
+	.string	"\0071cO313"
+	.string	"\004"
+	.ascii	"r\376\002\215\003\\\006P\004"
+	.text
+	.section	.gnu.lto_.lto.d5fa5275d8d8fea5,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_controlRateProfiles_Registry.33.d5fa5275d8d8fea5,"e",@progbits
+	.string	"(\265/\375 \236\205\004"
+	.string	"$\b`"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	"\005\001\212\001\202\200\200\374\342\303\246\213\023\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\375\007us\307\007uq"
+	.string	"\005\001\006'\001$\f?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"$./src/main/fc/controlrate_profile.c"
+	.string	"\004"
+	.ascii	")\302\303,:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_controlRateProfiles.34.d5fa5275d8d8fea5,"e",@progbits
+	.string	"(\265/\375`~\001\215\017"
+	.string	"\026\237jE"
+	.string	"\221(\035;FDb\2543\216\337\240\207~}\021\355u\314F\337\2754\363|U\350,EH\203H\253\350\245\202\213\366\034Aq\307\230r\253JP\024\276\240\337\033 \2018\342j\341^\333\373l\373do)S\nW"
+	.string	"R"
+	.string	"X"
+	.string	"f\320y\364\367\320\366\3309\201\355\321*\273F\001\023\217\230\223\332\215\335\3454\204\365\360\273a\252\036\241\246\312\347\210\264\034\024c\321\300\274V\217P\300\356\006x\231\300\005\211\362b%$\221r=\355\241\225\031\r\314+\345\311\021\331]\247\353\345\341\336n;e\033\202\375\023\001\371\335]+\314\366\\\366s>\273\341\323\252\351\324\364\001d8y\t\275\354v\270\321\2613\342\013\226\314\317\354\327\376\3714\177\036\355\024W\241\372\3142pW8\210\315\330\354\356\307\243\037t\036\r\300\177l?\355\307\216Bu\331\206\203va8\\\354~ \001z\332\021\310\304\264>t\362.\277\313[\240\240\r\021\273\255\273|\026\207\261"
+	.string	"\277\362h\r\250\355\256G\037\265=\252\332\0270\344]\0360\003\242\245+\247rT5\002\215\226\t\217;\306vM}\253\004+o\f\365\372\332\023\310\030\301\242y\331Q\2227\252\273\273RU\261\277U\246S0\225N]\003RJ$\001\344Q\bi\304T\352<\222\t\244\224\310\033\351\274\324\251\033q\243\022w2\211*p#\017\305\205\034pGB\362\270T\327y\334\347\333\177\025\346\267\034\262,\016\233\022eEU1\007\206zTk\362\343PQl\033\344P/\233\325p\310\034\207\320\n\016\325\023\033"
+	.ascii	"\2423\341\214\351kj\243\251\3659\332>\304\354Pf,\304\254\032"
+	.ascii	"M\260\250\231\366`\332\004s]\016\255e\005\212\226\203 ~\252b"
+	.ascii	"\200\023\253\332mVR\200kqCD\331\220\247\275=\007\004\212\262"
+	.ascii	"\351\232O"
+	.text
+	.section	.gnu.lto_setControlRateProfile.35.d5fa5275d8d8fea5,"e",@progbits
+	.string	"(\265/\375`H\001\335\r"
+	.string	"V\331[D"
+	.string	"\263$\035[,\217\r<I[o\350mo\033}\035\213\317i0\220_\200D\266\210\024\271\200\305\266\250\261\211\006&2\243\335\202\0258\221\250\273\344\223v\b4\364\037G@\322A\207z\013\205\030\311&R\246\024G"
+	.string	"B"
+	.string	"O"
+	.string	"\tH\267\031YwE\350\274\330\375\n\030A\310\241I\266\215"
+	.string	"\033Fxbrx\354.\246$Nz\245I\362ALD:\317\345\325\207+"
+	.string	"\357\245\032\260\273\277yr\360L\231 &\273\353\354<\0177\274\355\006\266\243}\230\273\353\242\037Y\252G\351@\311xI\036\3733\245\216\260_\255\312\330U\332\272\315\257\231~\210\001\030\222\031\273\035z|\354\016\204Q\302\366\375\323\277\226\343\370\301\351\304\356^\207v\213}\035\376\262\235i\037\b7O\026'S\215T\216\177O\261@\0273\235\206\257\240"
+	.string	"o,Hq\025\240\013\241\220uh\351\277\303\032\0328jL\244@\\Eb\354\210\371\241j\307\347\214\004\314\354\256\002\037u\024\030|\232C\253\254\344\273C\177\305:\264\200\323#D){2\256\220A\233 r"
+	.string	"A\343>\021H\234\225h(\240\223\270\245H\320\270\317\206\0227N\0243,;\301D\240O\b\3136\025\254\204\200c\212\266a\\\214\033v}\245W\2532f\340\355\224\324TY\352\353\274\005\213O\343L\313w\232u\370\035"
+	.ascii	"\200@tN\254Eg\302\031\323\023\332\240\276\255\256\355\3353\275"
+	.ascii	"T]\265\304\262\327.\263\332B%\254\260\271\b`\034\ty\301\034c"
+	.ascii	"\251\242\200\203\241\266\316\301\002\327\304\374Lh@\205P\251"
+	.ascii	"\313\341Z\006\030\026Un\273\212\036"
+	.text
+	.section	.gnu.lto_changeControlRateProfile.36.d5fa5275d8d8fea5,"e",@progbits
+	.string	"(\265/\375`Y\001E\016"
+	.string	"\346\031^E"
+	.string	"\223\223\016\233\257\355S\351H\251\335@$\260\004s\215\031-@aA\302\350\263\243\337\337L\005\234\312\330\202\021\201\033l\371c\rl\204\023\tn\247\325+U(\320\336\213q\204\246\225S`j|Dv\243-S\nD"
+	.string	"H"
+	.string	"N"
+	.string	"8,v\213\355y\274\307\266\252\215@\001\3514#\303]\021+\235\335\317\200\023\210<\232d\343\370g\332\247\274\027\027>v\027\203$N\272\222\374\327|\304\203q\271^\rv\327\352\301x\270\341m\023\260=\355\263\bz\303\346G\210\222\266\254\037\311\303\b\017\200\330\341\300\243\323\226\375u\nG\330\017Y\030cK\365\245j\031\325\3614\377I$\212\032\002h\354vh\001YV\224Q\302\366\375\323S-oa\b\247\025\273\373\357(\233\3456\226\020\376\352:!_\306&Y\226s\352vT;\236z\214P\\\231<\3560\264\230\203\201\3529\033\206\317G>^\360\251\307\031\033:fT\250>H82\243\307K\220\b\217\262\206\277\030\r0\355\356\002\377\3468)\276\314\243\347\212\336[\221\217G=\316\260a\273"
+	.string	"z\020a\023e\023\002X+\331P>'\223S1\331D\031\20729\021hj\230v\202\201>Y\n\246q!\254\244\200\247\312\306a\24299\314\363\225\036\2620\306\016R\260J\260\243 O"
+	.string	"P\273\202\005\275\347\327\234\344\306\004\253\203.\276`  P\202A\326\254\007\200DgX\213\236P4\255\266aff\273D\360\320\367/_\007Y\226f\214\025c\321\031\\\232\260X\362\300\223\363\002\030\203[<\352\037\2363\334C\243"
+	.ascii	"\032\275\243\004Q\321\003\356\356\242\035\025\213\203\317-\332"
+	.ascii	"\363\004"
+	.text
+	.section	.gnu.lto__reset_template_42.0.38.d5fa5275d8d8fea5,"e",@progbits
+	.string	"(\265/\375 Y\225\002"
+	.string	"T\004H"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	"\005\001\006'\001\362\f\005\001\006\035\001\035\001\n\005\001'\002\002\1772\344"
+	.string	"?\202\210\200\310\001}{\300\001y\300\001w\274\001u\277\001s\274\001q\276\001o\275\001m\274\001k\273\001"
+	.string	"\003FFF\004"
+	.ascii	"@D\315;0m\032@\021"
+	.text
+	.section	.gnu.lto_.symbol_nodes.d5fa5275d8d8fea5,"e",@progbits
+	.string	"(\265/\375`\t"
+	.string	"\005\005"
+	.string	"\302\207\035'\200M:3\230I\205a#\232\340\034\314>\362\301\226(b\212\031\230\007+"
+	.string	""
+	.string	"@ \205\264"
+	.string	"B\004\376\205\374{\247\024\265\311\242\236I\027\365\274\371\375\367T}\211\244 \262\342\377-v:d\304\206b\001\303\266\243q6\231\f\243]2\215\245\336@\204\306 !\356R`=\326\202QM\016\020\344\303\275\326\333Q\202m\335g$j\263-\205\354\377\017\244\303\2655\006\020"
+	.ascii	"\256\241u\314\240@=|\200\330\270\024\363\004\303\345\3072\334"
+	.ascii	"\254\006A\325\317,C@\214\245\302\200q\240\230H\240\364"
+	.text
+	.section	.gnu.lto_.refs.d5fa5275d8d8fea5,"e",@progbits
+	.string	"(\265/\375 /M\001"
+	.string	"$\002+"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\002\001\004"
+	.string	"\003\002\001\003\002"
+	.string	"\002\004\004"
+	.string	"\001\005\005"
+	.string	"\003\006\007\002\004\002\b\002"
+	.string	""
+	.string	"\001"
+	.ascii	"\3061\307"
+	.text
+	.section	.gnu.lto_.decls.d5fa5275d8d8fea5,"e",@progbits
+	.string	"(\265/\375`\361\0235f"
+	.ascii	"\252\261\350&S0RBJ\007\256\206\362\212\263\216k\337=\030\031"
+	.ascii	"\313V6\307\241%!\237\250X\256i!h1\206\274\346l\375dq[\277\035"
+	.ascii	"af]\220h{\227\225\237\230\365u\216A\324\314<\262*$\002\240\312"
+	.ascii	"\264\244pV0\240\312\222(\022[\234\322\203\224<iR\246\b\002g\002"
+	.ascii	"j\002\3473\246r\334\260\275m\007\321\026\366\244\317w\021\351"
+	.ascii	"\231\001\364\326l2\003\350\273Hz&\367\2407>\244\357\034\322w"
+	.ascii	"Szn\246\3472"
+	.string	"\351\371Kz\356\3623\024L\306c\253\221\035^}\362\231\320\231\313X\022Lh\372<\243\2457\263\364L%=\030\367\240=\326\004gI\205\230\332\232\322\347\037H\342\351\n\227\261\031ca&\230\311K\316\302J\234\227`+\347\366^\"\331\224\034J*H\344\276\252\242\324\270\311/\224\205\267\030\354\326*5x\202T\273\367\236\303\304x\fG\250s\227\316x(\357m/\343\027\372c\310\340,\\\205\307n\255\362.\235\221)@\325\006\305\t\333\275\355\013\237\027\250\026\345U\025\234\363Kp\017j\303\311\364lL_C\372`\252\303K}\270\007e(\034\205\227-XJ\233\263\"MV\2323}^\205\364|\304]\340\2722\016\224\236[\240\334\344\026\350\005H]0\330\317N\270\345/\026\356%\336{\005@\213D\252\253>\331\b\366:\177q\327c\310\370M\310u\265\356\275\374\005A\362\336!\177\345\240\271w\230\303\214"
+	.string	"3\002\347\222*#b\350y\026)s\t\235\237\360\240F\251\366\346\334\320\216d<\364\211\353\324\001\356AQ\346A\177\270\007\375\271\210\237\231\260V\213[\361)y\301\356mwrZ\035P@\372|\313=h\312<\350\377\346\3773\377\321\374o\373o\346\347\377\237\342\177\231\377l\347\362\337\346o\005X\246\027\360\236\2777\340\376\331\200[\271\201\211\377o\b\375|\177\326\241\341\177\n\257\371\273\305\317!\374L\302\317#\374\f\302\317\036\374,\302\3177\224~\226\340\347\016~\2661\303\377\234\277\203\370Y\206\237\223~^\177^\341\347\023~6\341g\005~F\340\347\003~&\340g\237\237q~\006\340g\026?\357\374|\373/\345\347\363?\363\277\326\177"
+	.string	"\376\227\375G\233\315f\363\347\344\177R\360\347\240\001CtIq\206\206\344e#\373\207\005V\355\025\242fG\030\245`\334p,)\361C\237\375\343\357\036\355\243\2278\211\223\203\227Z\237\235\344\036t\201\023\314\207\363\262}h\036N!\327\025\332\234e9I\301v\257\024\f\233\037~"
+	.ascii	"\201\343J\207\216\226\342k4sJ\251\242\205\354\341-\305dJ\333"
+	.ascii	"\003\217UI\341E\212\217\264w\270\031R=\021\351\363g\016\035\216"
+	.ascii	"5aB\232I\262\270\231\3369\332\330G\013\226\212\2701&\324\256"
+	.string	"q\007\030-\361D\246)\325\320t\361\215\3438:\212\245\356\315\213\024\037flWJ\352\307\006\307\016\2636\250w\324\277\334\334\002pMZQ\216\364\371\265~\302\205\261r2>91\222H\023S\017mn \216\331\322\347\262q`5\025M\20202D\237\277e\245\357\037\275C\343\2757\007\\{\215K7(\343\230\177\376\025|\343\004\376\237\367\026A\362\336$L2\351\021)C\036\355\342\036\353^\341\316m\257\261\330E%,\032\241\345\270\323\336)\001n\027\220[l\251\216g\362\366m/_\"\325\021\206b\2334\026\333\244P\347\022\223\302{\333\243N\021l(\344b\027\325\261\330\225<\356\\\342\025\336\256\341TJL\036\213W\222G\235b\327\360X$R\035w\2200\211\2049\025\031v\341\255\"\361FA!\207F\035f\261M^\264{\031\214\351\032\023\270\027\2314\242\r{\340\261%f\324R\224a\362\016"
+	.string	"\265T\225\274Df\361*y\357\325\222\321\205\202@\3302\357\020f\n\201 \357\023\323\275\004@\335+\344\313\274\367\n\357\2759#\262\275\327\007\235\242\022\n\352^)\037\250\213\024\2221\335\333`]\306\216\305\256\252\244\020\231W\227\3626\265BV^4*c\332%\334\272OcR\345Q\0071\315\364\357\033\2107B\350\220\266\245\317\277\211\275\324H\316 \201\352\263\207>\267(R(\371\021Ez&\363\302c\314\224\252`I\021jZ\270\311c\270\f3\255,\320\022S\353\313h\270\215\323\360\231\026\262\031f\343)x\311MV;\207a1\357\266\311h\334e\350D\251\265\005\314\211'\302\302\242h\222\246\365"
+	.string	"\030\036\303\271\335\353cI\223\277\264\0060\321\201\304\312\241U\t\003\003\340d2\274\306K\006X\212k\314us\360\227\262\271\304O\016\326\2264\343\327\336kZ\256\212\2105\221\236\371v\202\331bng7W\310us\344\240`\245\271b\273E\251\037\034'0TA:\212\267\230w\230\0302\236\346\023\342\345\325g\253\235\207\214\361*~i0Cx\211\222\206+\355\264\006z\230\231B\343E\205\225\026\"H\372\354.O;\324\024$=\372l.\007\263\"\312\226\025\262\321nfUgK}\366\023\275\205\227/k(\2163\245)\254\214Iz\033\370ehky\237\37555S|\004\241:\322\304_\223\023\333\302C\331\347sE\322\347~H\377\266r^\266\2256\263"
+	.ascii	"\354\016\217?U\222f\220l;D\230J\372\354\262\276\302\313\237\306"
+	.ascii	"\362f\202\303^CloW\315\2261=\300\332\322\363\017\232\303?\350"
+	.ascii	"\211\246)\241\204\316\275A~\214\345\240\260\332()i\220\367\221"
+	.ascii	"\276j$\274\354 ]\305g\253\025\346\260!a\334X\031\"\306\330'\022"
+	.ascii	"m\316i\007\0240\256\364\254\205\325K\320\2240\351,\255,M\272"
+	.ascii	"Mr\245\223p\265\0303\245t.q\351Em\331Z\235\205#\334\271\027\210"
+	.ascii	"\231r\254\251\364\224\226\322G4\031/{\331[\357\253Fr\037*\275"
+	.ascii	"\354\"\260\274\360ya\263e\315\b\023\347\304zZ\001KE\016\232t"
+	.ascii	"Q\023\353'\035\306L\251\366\346`s\204R\214\0316(\035\205\227"
+	.ascii	"-v\237\366\276x1\300\2123\\\330\232\240a`c8\360h\352\263\277"
+	.ascii	"\270\253\314\t\310\321\b^\266WN\023\021mE\372"
+	.string	"\354\256\247\341\020\342\340\364*'\017dL\260\364y4*=ZL\217;\223\266\223\364\t\265\036fk\351qa\322\343\274\244\3079\221\036\227eI\026\256\213\t2fY<v\206\345i\251,\325a\036\324E\313=\350\017\363\240m\244\207h\"\376\232\234%cB\240PI\337J\020\200\310\002\245\317\223_\005m\"\357\"\177M\227\031QB-\323w\020-\304_\203\203V$l\313+}\003\001\245IfG\237=$e\302a1\240\242\307\362G\017\371\373\207\266\342/\032\232me\372<\032\367\240+\230\007\3450Bo!6fI\2509\341QU\325Ri{s\360\023\034VLm\t\321\243\317\343\206S\313\236jb\272T\344\340\212\230\3325.\001\343&\352Q\013;6\351\003\002\216X\366\267\032\335\350\271\021\020o\325\361\210\202xD\001\004\325\030\326\244\032\354\216\205\257\267\262\301 u(\351\210\347\353\005\255\301\244\240"
+	.ascii	"\216\216\222|\276\237/\307\352P\031~\253\021\373\363\345\210"
+	.ascii	"v\352\321\251\004\344!\251H\350\215\200<\270a\243\204 V-Zw\254"
+	.ascii	"\013V\027\343\201\027x\277\243\032\352\372\253\221\243\004\374"
+	.ascii	"\325h\301\336\b\b\230\364[\213t\253\312\252H\273u\007\f\342\361"
+	.ascii	"|I6>\242\306\005u7\254\316W"
+	.string	"\004\304\371\212\2007\225\206^\360\f\006\325uhh\227S\002\376x\347\312\002oC\252\257\250w\264\313\r\251\301\244\323\367\353\261<5\230\373\252+\002\002\255PZ\331`\257H%\241"
+	.string	"\265\310\2673\342\371\370\324uM\342\r\240\264[\327\013\016(\201\247\006\253\006{X\026\347\005u>\rH(\002\2668\257\267\252>\265(=\0043\032\230Ac\206\334iL\340\300\004\016\240\2471\201\220\320\0043\204\322\317\020\2729"
+	.string	"\024\003\202# \222\312\352X5\250\256:"
+	.string	"\330\033-\300\352f\b\245\254\257\367\003\276\260S\327\026t; \213\303\303[s4\206z\037\254Fln5b\323 \016\003\033\"\254F7|JC54~\300\0312\220a\207\002oUq#\240\242\036\221"
+	.string	"\377\001\3255\210\375\375\326 \233\240\256\250G\344\373\325@R\331\240R\020g\006u\310gc\250\007\314\021Aew$\2501\364X\336nG\035\372!\351\212\222ZP\207T\004y=6\330cwlP\367Bp\307\346\260:\032\254\257\227\224\273\004\022\324pa\002\b\033\244< \365\250G\364[\201:\225\335\255G\277\225\365\375xA<\242 _o\207\024\304[\203A@\n\250H\275\033*o\267nP\344\353!\255\027\370BXU\031~\300"
+	.ascii	"\326\235\021\357\\\325\036Q\217\365\251C6\206\326\335\257\205"
+	.ascii	"\234\246\265\260\035VU7&\036pv|\225%\321\347m"
+	.string	"x\033\336\2105B\026h\226:\220lWj\207\237\377\266\364\033\261\237p\200P\322\003X:\225\376\267\373\233P\214\216)\036}v\232n*Q\212q\351\363\274|\332\227#^\2464\351\263\321t\333\255\224aT\300\\\315\310v\305\326\345\214\230\\\024\2233B\314\374\020\242\365DYO\021u&)\203\034\323g\2312\275\366\033\361\372X\242ldS\221\255\317\247Nd~2\035\201i\250\221(\206\224CF\204fDd$I\222\016\341\004\204((\241\204>\022@F5\320)\210D\2440I\215\302\036sUzDJk1C-W\264.4X\255\210\351#\025;/\365\r\034\322\354EB\004\325\370\215a\243\242\250\220_\224\304\324[\214/R\212\236\275\242\301\017\203\333\3620f\357Z\224\206\367!\242\276\262\035\024\256BV\"\227\357\003p'\224H>Lm{\271>SJQ\030U\347\033Y\301\301_9\344\202{"
+	.ascii	"\030f\366\351\231\335\242\336\345\2541+\327\002\252\213\037H"
+	.ascii	"\210\264tF\f\236r%\023\021\236N\335 \n>\366\305<\213\247\352"
+	.ascii	"\212P\375\354\374\327\321B\327\321X\361\035\265r\271\361\340"
+	.ascii	"\263\204'\n\205U%@\365\267\235\354\241\300W\001sK\261\316KH<"
+	.ascii	"o\007]\033A\230bfOGBO\024(\207\207\345\276K\271\356\316\343z"
+	.ascii	"\177\343'\277\314\243\36162\225\204\236\220m\311\n7\357PZ\315"
+	.ascii	"\310ty\333aNu\342\330a\302n\177+\340 \240\251\fAv3\203\323\375"
+	.ascii	"nyX\365\307\242\327\032\rb\250\026L\256d\376@;\007a\304=\350"
+	.ascii	"2\246\200`['\340}\305\267?\242kq\344\323\200`D|\005\326;h\255"
+	.ascii	"\t\023\232\035~\004N/\260\343\316\"h%[\222\024pi\304\246\001"
+	.ascii	"\017 \276g\262\205\320\305\367\271t\025\320\317\363\313\315e"
+	.ascii	"\030\225s\017\243<s\002\027DWo\370u\354/;]W|\206\345.{\033\177"
+	.ascii	"\304o\201\367|u\021W\304\036u7(\210\242B\253h2\313\231\327~O"
+	.ascii	"\211\276-9\247\221k\272\30709<}e?\331\031\234LLR,\212\243\376"
+	.ascii	"\232\2222FM\336\352\006\363@\301\026`K\327\020\234\370\255q7"
+	.ascii	"\032F\034\307\177\333\347\273\351[$\215\240W\326\277\265\214"
+	.ascii	"\3615l\314\021\0331\373"
+	.string	"\252\365\232\373\342s)c\374\314\250\023\326`\307,\013v\260|\007\357!\350\245\027\236l\325O\275q\006\314Z\005k\177\342\205\003\203\353\027\244\311\333\361\233\016x\343\346\335%%>\336(\370)P\273\023\213\244i\205\262\007\034% *\311I\"\367h\337\275/g\036\270\337\204\253\277\007\313#^\f\352\223\342\211\306D\264ss4\275z\021\243@\036Kb\330a\315\3179\346\fD\353\001\264\215\032\260\242\261\210m\202.\265\251\357\204-\024\370\273\2031M\343r\240\356\035i\210,\305B\212\300\241xZ\030\373\207|$$\3566l\310\256=\013E\201\004\021\302-\033\370\267;\242\201\005(X\327\030\224UZ\017\301\210\n\323\334\342i+\275\341(\336\254B\363i\213&\001\201o\234\fX\230\256NS% \257K\252\233\345\213\354\005\245\377\247\177\221\214\203\022\266\234ix\367\377\237\302\003\374\307Nx\313\303!\317)"
+	.ascii	"\346\337\307\371K\251\023\202\325/\262\b\353\245\367\372[b5"
+	.text
+	.section	.gnu.lto_.symtab.d5fa5275d8d8fea5,"e",@progbits
+	.string	"pgResetFn_controlRateProfiles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\001"
+	.string	""
+	.string	"setControlRateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"controlRateProfiles_SystemArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"$"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\001"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\001"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\001"
+	.string	""
+	.string	"controlRateProfiles_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\001"
+	.string	""
+	.string	"controlRateProfiles_CopyArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"$"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\001"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.string	"generateRateCurves"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"generateThrottleCurve"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.d5fa5275d8d8fea5,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
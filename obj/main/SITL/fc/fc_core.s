@@ -0,0 +1,2886 @@
+	.file	"fc_core.c"
+	.section	.gnu.lto_.profile.31eb944f3aa732f2,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.31eb944f3aa732f2,"e",@progbits
+	.string	"(\265/\375`}\002\r\017"
+	.string	"\204\022q\003"
+	.string	"-"
+	.string	"\262\304\261\307\013\034\002"
+	.string	"\002"
+	.string	"\002\001\002\001\002\002\002\003\002\004\002\005\002\004\002\004"
+	.string	"\001\352\263\360\321\b\005\006\007\b\t\231\357\210\200\005"
+	.string	"\n\270\303\251\351\r\b\006\002\006\002\002\007\017\221\266\365\203\b\024\b\002\b\t\020\240\342\234\212\n\022\371\261\370\241\n\f\002\001\002\n\001\002\001\024\027\243\262\274\213\017"
+	.string	"\030\331\203\213\252\005\026\002\001\013\002\013\002\001\002\f\r\002\r\016\032\034\035\037\250\200\234\374\004"
+	.string	" \221\311\333\227\004\017\002\001\002\020"
+	.string	"\002"
+	.string	"#$%\234\276\301\203\013\f\002\021\002\022\002\023\002\023&\233\304\365\321\002\002'\214\233\312\236\001(\230\264\354\335\f\006\024*\333\311\367\353\b\001+\376\336\373\325\016,\317\300\260\312\002\026\002\025\002\026"
+	.string	"\002\027\t/1\272\210\336\260\016 \001\002\030\002\001\002\031\002\001\002\032\025\02446\334\322\274\223\tJ\033\002\033\03478;\322\331\330\236\006\004<\205\372\237\341\002\026\002\002\007\001\007=\350\300\306\254\005\002>?\202\321\330\342\013@\374\202\331\242\rABCDE\240\342\234\212\n"
+	.string	"[\250\261=9#b\nR\220\264\031P\002Bde\036\0208\212\244\246I\007\030(\337si\0263\"\217J\210c\270\264})\2268\305k\036R\317\343\316\263A>\017\030\327=xA\313KP\302\367\240\2068\345\374W\266\005\013\3421\275\205\262^I@\325\004\322\321\263;\361"
+	.string	"\330n\252\332"
+	.ascii	"\231\026\025\332 |e\214\002\257FF\032C\327Z\221\377K\215\272"
+	.ascii	"jq\256=*9\224\0207\256\3718\357?\240\332\202\342~\274\036\307"
+	.ascii	"\311\t\272\301\003\317\027\t\002\245\230j\330\243\350$,\f%\312"
+	.ascii	"K\227\347\262\0335\212o'\337\032\b\022$\371\311\306Z1M\351\312"
+	.ascii	"\265\033o\036"
+	.text
+	.section	.gnu.lto_.ipa_sra.31eb944f3aa732f2,"e",@progbits
+	.string	"(\265/\375`\321"
+	.string	"\245\005"
+	.string	"b\205\020\033\220U\215\001\377\377\377\377\377\377\277\202\220\bl\330\374\205G\276\340\007\037\273eJ\0016\001fMl\375\313\332j\251i\245h\241]\b\214\357>\221c\356~v\232\027e}\017u\013\335'\2649h\342\2015 p\"\203\330\r>\t\242\016\200A\207\216dL=H\\%\211\266\341\316\200S\003C\006\205\243\220\bn\250\005\036\227BX7J\262Ac\007\256\023L\017\320F\355q\2347\230\n0\006\306%\022_\006\312\006L\024\347x\254j\333s\023\360"
+	.ascii	"'P\020\225cfe\t\b\2727\024\233a\375KRblt\262\340\272#;l\032\201"
+	.ascii	";\n0\004"
+	.text
+	.section	.gnu.lto_.inline.31eb944f3aa732f2,"e",@progbits
+	.string	"(\265/\375`\374\006\215\025"
+	.string	"\346WYE\360\224\223\306\024\216I\006\345\265\241y\212\357\273X\013\237\307p\300\324\235\214\3745\243\013\r\307"
+	.string	"\271\bh\027\215\310\204D\357hm}\233\310*./[\277\276\277gFy\374\3021k!_\013\201\234\304\275\245L\001D"
+	.string	"F"
+	.string	"F"
+	.string	"815\n\036\300u?\327\205\"\220$+\034\321K\210\367c\364&@O\020\006\314\312\033\351\247\213*\311\261\362\016\034 \363\007\301\177]M\272\273\233=\n\326\370\201\255\260\240\237)\310#\366\261JO`"
+	.string	"=\001\t\312F\201#\320\\\317\224\332\354.\350\005'>v7t\202\024\225K\0066$\202\347\323\221(m\340\263\303\243`kwM.\260e\276*{\027\r\221\023\363\331\360\002\221\244p\035\311\230E\271\345\353\305\314\t\026x\023/:\203\342&\310D~\340\332\335\013\372\020\005\215\354\356\312\rF3vU(\227>3\347\272\324\033*t,!\351\340\350\251I\231E\264\023\373X'38\251\246-rb\237\366\n\006U\023\214\253h\332\032\217k\213\006S\340\272\224\226\260!\243\345\200\207G\004\b\225'\354v\202K\230\353b\314xlQ\235\037X+\256m\2120\331gP\031\032;,\324E\374I\2321L\330d\205\214\244\034\326\241\0068\242\307\216OYC\370\360\242)B\223\036\002\200\226\250\021*\023\031!iJ*i\016P\242A\250\316<\022"
+	.string	"\222@\002\305 D\225B\f\325\214\314\246\250Z\231\003\250H\327\255\032\306\\\252\302\346f\233\n\303\\\342\346\315K+~\261\371\200\202T\352nE\263w9@q1d\332Y\326\033\224/\243\233P\016S\340\203\034\021d\204\ni%\177\026\325\212\034d\025\263\3355\020g\324\"\215\227\274\245\325\256\030\222\324\313J\216t\272"
+	.string	"\233\2016R\255-\354U\022\025\250\\0\016\204\257[\243\036/s\365F\016\316\001\206\263K&\251\275\316\025\222\256\f\252AA_\351\0266\364\202\370\301\314w\251J\324f\252\341\207\367<\003\t\312\260\017\324\"!"
+	.ascii	"f$o\315\260\211D\372\266\330\205\\\026\343\370s\342K\351\305"
+	.ascii	"\316\200vl\234\234\226\3106\022Gv0\013,l\202\224\256\332\212"
+	.ascii	"\233\246\254\220\337\322\253\363Z&o\255\272s\314\215D'^\262'"
+	.ascii	"56r\223\256\345\223\227x\211#\035\247\007\020c\003\330[Z\212"
+	.ascii	"UV\261\352\021X\203\023/\371,\002\211\240\305\375\204\204\250"
+	.ascii	";\311\027w2/\247H\373\316\004\035>\220D1\202\344H\206\335\357"
+	.ascii	"?T\021\263?\221o\377\277\221\325\361\352\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.31eb944f3aa732f2,"e",@progbits
+	.string	"(\265/\375`'\006\355\022"
+	.string	"\366\324D;@\247(\035\3030We\027\243"
+	.string	"\027S\220,\371YD\341\332\277"
+	.string	"\257\375\243Q\0245F\230\245EQ\024EQ\203\206\261U\336\353\232V\266\261M\201h\321\017K\217\330Mr\333\224R1"
+	.string	"5"
+	.string	"5"
+	.string	"\261E;\202\344\335\r\227\214\305\220\272\243Q\024I7\207\251\347>HS\2236>\313\271o'\264\366;\226\020Z7\354\342\206\271\027[\371\267](E\023\fm\200E\255]\300o\352tle"
+	.string	"\377\357\001p\227\273J\212a\220\304?\204\216!\217\370=\215\306VZ\304\316Y\344\313\227c(\257\320\326\267\264\226,\31327\007\234\311p\036'\266E\235s\316$\377\357m\322\316 lE\353iUQ\264\036Co\262\336\344\2551!\3216\242\205(\346\235\330\017\207\225\212\003Ee\226\032>2m30\030G\217\374\177\033\243\275h`\007\361\363\311\277\200\257\3531x\257\366G>\371\364\333\021\364\005\277id\200\242\024\370\007Y\211\300?\205\002\tTU\002P\376\001\200\302\2501u5\245 )\324h\016\340\002\021\242\241<\021`H\216 \222\021\221$I\322\001\3360\276\211w\367\013\330\251\232\313\031\350\374\354,\250"
+	.string	"\233\022\034\230=\222\007\346\005\202\363Go\237\024A=G\252\335\201\245}\216\346\307DnU\274\2004:\240\215x\005\374\260\033z\221\306\2622\370\264\300w\252\002\203\2502\314\034\006e?\r\353\365\274\232\335\216t\b\240\341\250-:\363\201\364\320QAI\212*2A\323\n\027\25716\376!\202\336\203\201\306I\f\341\001\346\021B\315^\253\244\370\237\352\002*%\375\330\340B\301\bh\035\334m\217\355\302\3411\f\024\373G\200S\274r"
+	.string	"\217b\273\004\270y\023 2(\025k8\312X\320\r(`\255\234\232{M\256[+\207e\365\027\037 \024\272\237\0218R\005\341\320\236\217h\232\265\203t\232\bh\277\016g_\202\027\356\"\351\022\2714!>at\0168C\016\323\336\266\361ab\027\263e\023|\023\273\230\275\323<*\031\353\022\206\026\301\007y\213\367o\0209Mt\035\275\362\030\310\305\301\t/0h\347`\323\363y\210M_\005\225\240\253\367"
+	.ascii	"g\212K\366\331\214TPO0\003"
+	.text
+	.section	.gnu.lto_.pureconst.31eb944f3aa732f2,"e",@progbits
+	.string	"(\265/\375 D\305\001"
+	.string	"B\004\r\024\220Mck\360\335\335\335\311\340\"7:\215\304"
+	.string	"\340\0237\313.\312'\227\344E\016y\217;\3368\343\213+^\342\210\037nx\341\203'x\340\200\033afU"
+	.text
+	.section	.gnu.lto_.ipa_modref.31eb944f3aa732f2,"e",@progbits
+	.string	"(\265/\375`b"
+	.string	"\305\004"
+	.ascii	"\242F\021\024P54\0340\2632\266\017\371\233\214\371\023\223\374"
+	.ascii	"\322*2\245\252\222\210i\2259d\373H\242\243.\326V\350@5W[\207"
+	.ascii	"\341\2047\346\214\315\210\320\203^0[3A\331\246\035P\001h\213"
+	.ascii	"\346g{6\235\340\223% \200\202\251\244\036$\212\020\026\3548("
+	.ascii	"\341\236\230\t\023\207HdH\367\333$m\350\366~%\270\"\3449\274"
+	.ascii	"#\2340\f\306\354\022\304\354\236\315\366\222F\311O\301\0270!"
+	.ascii	"\203y\226\357cX\033\240\224W\216\304C0\347A\235\253$\002\t\242"
+	.ascii	"\340C"
+	.text
+	.section	.gnu.lto_.lto.31eb944f3aa732f2,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_throttleCorrectionConfig_Registry.131.31eb944f3aa732f2,"e",@progbits
+	.string	"(\265/\375 \222=\004"
+	.string	"\224\007`"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\206\200\200\374\342\303\366\201\031\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\337\030us\355\007uq"
+	.string	"\005\001\006'\001\004'?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/fc/fc_core.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_throttleCorrectionConfig.133.31eb944f3aa732f2,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\240\006?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto_applyAndSaveAccelerometerTrimsDelta.134.31eb944f3aa732f2,"e",@progbits
+	.string	"(\265/\375`*\002\305\017"
+	.string	"\226\\eE\360\222(\035\362FHy\177\004\311\032\200y!\311\314D\bi\243\320\302egG3X\217\024\221\324K\255*\262:\374\242\307p\035\030v\326,\212\354n4\264f)\204\353{\277,\270\210\220\332/\371\334V\312\224\002M"
+	.string	"G"
+	.string	"Z"
+	.string	"\341\315\302b\314\t\220\355\247\375\024W\221:\210\362\001\273\255\020f\367\305\300\013\264G\277n {\324^ {t\312\376\361\227k\357r\243\362\"dw7-\361\3243\345\177\305=\254\225\224g\347\301\356:Y+\037n\275\355\004\266\033\330\t\006-gq\362Y\036\315\341$\317z\364O\262\307k\200\226\020\005\250\312\320~\255RI\330\347\354\356Z[\366\301\037@\246C\232\006i\372\223i\217\246\265Lw2\235i:j\232\223i\325tf\372\004>!z "
+	.string	"\262\353!\037\034\335m\\2<\\\036\275\215\t\260\243\032\3517bl\300t\364\341\f\230i\r\0323d\234\025$j\306\321\324\250\"\231\016#V\031Z\225\003\243{M\354\205Isa\301\34441\026\224\354Q\3655>\256\251W\031b\f\177\351\034\270l\roa\032\261w\027\023\005\261\335\035\t#T\211\024\341d\352>\n\0318T7\341B\t\204R\311\373\016\230\023!}\036W\201#\3318\222\255\244\033\2316\356;m\"\"{\033H\337\206\362\274o\003\275T\347\254\266,A\004L\245+\013H{\304\345Y\316\030 `+MqHw\350\230\311\001\322\320G5\005\251\210\306\243\001, \260\202\231\032\355\"\241930\030\236\022\256\301>\344q\371\303\204\2737\214 \327\t&\331\334\353\320\264\034\ft\304\342q\035LA\240\024\267K\210\317\203\345\020\255d\304F\220w\035qm(\315v"
+	.ascii	"\311\250\024\343\032\212\243}\346A\233\3762\241\3675\353\253"
+	.ascii	"C3Y\333\354S\240\227\027m&\003"
+	.text
+	.section	.gnu.lto_isCalibrating.135.31eb944f3aa732f2,"e",@progbits
+	.string	"(\265/\375`\253\001]\017"
+	.string	"\306\333cE\360\260(\035z\275{\240\225M\374\3452\207\333\245\327dV&\374b\340WM\305\232\202-V\205\017h\025\375\237\333k\2763\024\262\353\307\310\221\335\310n\344\r\314\177$u\232\271\320\342\177\325\347\266\367&[\312\224\002R"
+	.string	"L"
+	.string	"O"
+	.string	"\242sd\204\331[\025\371\3359\361#g\\*\232\017&(\227\037\245\036I\224\244L\nEL\232uP\"!\372\036\002U\314I\007Uz\003\\\200\220\361\027%(\272\001P\245W`\316\371\225\353\b\212\244\032?sN\353\ter\003\270\355\225m\003\366a\002v\206\r\372\323\367+\2270^`6\260\322vv\253\323]\331\177sUl\253=\252\226VG\253\241\325\231\325O}\001\016`54\007f\314IrCc\312d+F\330\006\261;^\300"
+	.string	"\304\242\267X$1\244\203\311U3gK\333\020\017\036p\341\211\247-1',0\333\025\241\331\276EJi\273\037\206\305\004+{\273\361\222\360\241?\275\325\300B\306\006F\332\316\313\212\301^\336[\256\373\030Gm\356C\177\322\275\207\024\322vw\253\273\3169\273]\021\374F@\361*i\314P\3371\300\3368:B\334\366`\003i\033H\243\340\001a\202\266\205,h\034\004\314U\350\bi\0278.\244uZ\363\253b\220Ker\221\236\0061R)\\\366\027\301\350\270\376\214\226\304\331\225\025&\270F\005\227;b\313\365\354M5Fz#\345\256\256\034T\314\224\210p7^\001& \220\202)\261\262\003\n\tx~\374\220\302\033\b\234\232lgb\r\341`\330\304^\2142\332\235-\227M&7\303\236la\023\265]\333\262l\2320\256\224"
+	.ascii	"\302\031\2127\021\bE\336O(\3112y{\fj-o wCW\033\243&O+\337:\307"
+	.ascii	"l\003\260k\233\320\313"
+	.text
+	.section	.gnu.lto_resetArmingDisabled.136.31eb944f3aa732f2,"e",@progbits
+	.string	"(\265/\375 \344=\006"
+	.string	"\222K+3Pm\222\016d,\216\240H\352\002:r\\k\002\020\020\334Z5\370\207\255\033\366o\220\032B\360\213~\224\233)\222\235ZGmA\331\241:\320\270YBd\n?\252\022\341Sx\026\367,\316\201a\241\301\275\b\341\250\201\341C%\272\b\b\243\233\256l\333$\210|0m\342\203\336\216z\354\271\032K\334a\265\032\335;"
+	.string	"\215$\022\017\310\004\303B\177]X\263\370R\262m\276\t\204\214\030\200dfB'\371\211>6\376NW_\322\013#\313\311\240\340\2002\323\265\213Ve\325-G\003,\315\245LB\310\314\231\245\251\350\255?\301_\360g\002\b"
+	.ascii	"3\001\0038\343(\276\3055\221,\004\3742\004\270t\213v>\001"
+	.text
+	.section	.gnu.lto_updateArmingStatus.137.31eb944f3aa732f2,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"E\t"
+	.string	"\226Q@:@\245*\035"
+	.string	"\264\272}\004\354]\034&\0206\016\340\020\255\227\025\006\240\367X\031\t\346\243\246\205\212Lsd\0311\241\245i\035\005|\217\235o\322\300s\030\253\371\033![\312\224\002/"
+	.string	"."
+	.string	"0"
+	.string	"\031\357<jv\374\243.\360\201\236GJ\3055\022\210N\337"
+	.string	"\350\305K\353\003\300Q\317\t\020\22499\330]\347\007R\334\330m#\3306\260-\022\241\255\362R1\354k\030\206\241\265d?\215=\375\2143r\225\\\302]Q8`Y\030\310\206\355W\334\261I\2562\355W\247\320\312\265\273\232\006V\365\334\364jy\250-\031\246G\235\022\3221\002\312\227\177Kv\305\324\031\"yO\235#\302\327\260\004'\377\035\3639\331\261+\306\202u\221\"}2\3360\231\216\333\0226\215\266i\264\206\005\005\006m\3536\032\246\300\234C\246\323\0368\256\323*\252\317\343j\311Q\300(@\353\243^\334\335\215\223\2647\020\371/\016"
+	.ascii	"3\241\333/FV\301\301\025@\265\017RX\304e\017\341jTxu\031\345"
+	.ascii	"e\bq\351\242j\207\006\246\240"
+	.text
+	.section	.gnu.lto_disarm.138.31eb944f3aa732f2,"e",@progbits
+	.string	"(\265/\375`\032\001\245\f"
+	.string	"\006\027SA \217\223\016\303f\375\370I\212Q\346\321\251\003:\340i\304*A\262\204;\006H\025)\027\2311j\322\310z\027\200\235S\316D\327\262\033\204\251\222\245"
+	.string	"\200\242\271p\023mp\027&I,\331{K\231R?"
+	.string	"="
+	.string	"A"
+	.ascii	"\273k)\206{"
+	.string	"\036\341\323\364\370\323\206\342:\355Q\300\241\205\277g`\305\003\013L\007\362\002\204d\340\252\016\224\212\351&<\002\273\373\222'\205n\313\2346\273\353\344\272\n\367t\333\227\355\002\366A\002\226\360\221\347\016\375\217xx\205&TXD\237l\261I[\352\005\373oU\304~\232z\032>\375\236~\005`\205\004\202\023\273!-0\266\004?h\260\375\312\036[\345\244\221}\312\210\020\212\213\013:\340\243\234\003\004\237\344\320\034\035\035\361\020\352\004b\005\213\311\323\223s*\036\343\036\361\372T\301\250EH\264\345\356j\352L\244\364%\277\2248A\001\312\027\3763\361J\2513$\332>\272\211\207O\022\2764\234\f\273\026\\\035\353\352X\0164\030lXW\306ai\006\030{\300\311\254\b\030\226Y\025\351\363\267*\222 E\351\243[\344\250j0#m\215\006y\316\230\016\"J\233j\0161\3320\362\260\b5\2637\236\202]6\034"
+	.string	"3\241\223)p\206\267\034\350>P\f\250\353`\305\216i\013D\341\243\350"
+	.ascii	"6\306\300\344\354i\r,\361\005\017i\260\025\022^a\202\2001\307"
+	.ascii	"\242\354s\rG\312\204\3622\204p\371\201)_\335\361\252b\333U\312"
+	.text
+	.section	.gnu.lto_tryArm.139.31eb944f3aa732f2,"e",@progbits
+	.string	"(\265/\375`7\003\275\027"
+	.string	"F+\230H\260\032Q:pJ:\273F\301\323\233\2019b0\201\324H\006d\0069\f\351\205<\002\356r\235\346\372P\364\314\032\336y\270\367\263\352\353\352iN\244\034\017\275\361\375\030\276\255@\227\265h}Y\377\"\266 mo\"e\222\001\205"
+	.string	"x"
+	.string	"\206"
+	.string	"5=\265\326\360s\327\305n\370\311\341\312v\263\234\364Q_\244\310\026\304\245\326\232\352\036\227=$\301\200#:\277f\331\2364\316<\214\3411#w\322\207\242\302\263]\350\226\373\024\350v\020}\347\226\203a\200\036\263s\313\305\b\335p0\370Y\356\243\235\033N\306hcz\343S\300\370\342;\030\374\325x\177\016zL\266\b\030k\337\211&G<\3179\306Hc\036U\250\265.\213\343\214/\200\357\256\221\335\245\260\333\r\002'\362\332\343|\356\212\030_\214\321\317\367y\316:;z5>\273\031\227\273$\215\373f\367]\226e\271\255\333\235\274'\3465\375\347[b\336p\362\202\223w\364\361\322\346\375\232\227\231\367\005\030"
+	.string	"\251\321\321\243KW!+M\351\245\362f\023\235\377|\367={\240\223\037\"\373\317BA\325\310:zHb\245\347\301\3472"
+	.ascii	"?Q?\321\317\357&\372\271\367\371\316\305{v\352l\002\"\355\003"
+	.ascii	"\37594xx\264\t\274\241\0370}\303\344_\3038|\335\"G\022\365h\340"
+	.ascii	"v\340(/htF-(\023\340\335\017 \370\"\203WF\033\242\036\255g\250"
+	.ascii	"\211\367\273\020\"z\"\240!(\364#\240\246\016{\331\206\243\375"
+	.ascii	"\310\221\214\330\343\254j\265\242\237\246\376\356\234c\203W\343"
+	.ascii	"\203\373\0020\204\357\236h\361\305\005\240\244\013\257\3263\367"
+	.ascii	"Q\324[\322}\263.\372&\001\204\245\306E\273\213\342E\\`\2555\t"
+	.ascii	"\373\2402\257\230\212\345\241\004+\005\tU\254u\341\204L\313\005"
+	.ascii	"S\r\330U\004\026\354\265\032\2612\221Z\231H\311\264T\256\324"
+	.ascii	"\n\026KE0\260/\025,X\212\305\353\005K\205\344\354\025fM\373W"
+	.ascii	"\027\360\251we>2!5\2348\341\225\372\324\313\242\226RO\tuCD\270"
+	.ascii	"\031\227\007lH\035\251oJ\r\366y<\312\245,\224=\316Z\330'\373"
+	.ascii	"\204~\202\035\352\206\202\340\022\360\250w1d\240\027K\215\242"
+	.ascii	"=\352\031d\3732\343r\017\360\256\206\r\374@\250a,\346\bS\n\315"
+	.ascii	"\210\214\004\231 \206\206\003p\002\0311\255\007\020Xf\265)t\362"
+	.ascii	"H_\335%\243\236\254\361nK\340i;\023gG\350\200\216\3013\236-\223"
+	.ascii	"[)\003\246dw!(\364\300\020\361 \322Q\257\221\210\007oiq\270\250"
+	.ascii	"1\240v\246\370\271{\004\322\213\275\357\366\277\224\273\366\376"
+	.ascii	"\346\007\226\326\304\243\334\250\254.\271\243\266Z\375\343\260"
+	.ascii	"\224M\266\322\265\036A\355\230R4\331T;\215\321\212\037)\025\004"
+	.ascii	"48\304Tf4a\367\225\317MiK\r"
+	.text
+	.section	.gnu.lto_handleInflightCalibrationStickPosition.145.31eb944f3aa732f2,"e",@progbits
+	.string	"(\265/\375`H\001\325\f"
+	.string	"v\325N@ O\234\016\303K7\204\330o\006\"\003q1\212\017\373\207\344\266O\3009\333\223\212\374q|\310\334\033\252\217\26726S\344\323\003c\225(F\035@\205\b\262\n\"\270\013\001\234<\254\033\331R\246\0249"
+	.string	"9"
+	.string	"B"
+	.string	"\273\233i\206\177~YU\324\374\370\227\005\303\373\272_\226#\244W\023\260OBF"
+	.string	"\037\351:\371Dq\300\356\276\343I\341\013e^\226\335uz\237\205;r\333\033\333\004\354o\004\336+\277c\275\272R@\f\245S\006(Sv\330\245\232\354\307U\r\373\351\370t>}\354\034a\210\212\002\251\335\n)\027\213\252Jh\260}\314\037;\305\303\215=\211\027\243\217\220j\212*"
+	.string	"\354\210:\"\242\360V\244F\375\350\202\210\007\251\024pC\351\224\021\325t\217\345\001\341"
+	.ascii	"\b\226<\200\034\304C`,>8\200\344\356vj\217uU\340qB\224-\354\237"
+	.ascii	"\376\301\343\203\216\320\311\007\326*\027n\323\020h\230L\303"
+	.ascii	"d\233L\002M\246q\234\254\022\300\033\203\013\2279\3306.\303\302"
+	.ascii	"}\274j\330@\007\024HC\361\222\244\344\031\313^\240\231\230\340"
+	.ascii	"@\211\326\212\244\335\200\223\367\254\332\275\n+ \240\202\241"
+	.ascii	"\301\036c\020\200 \\Q\336e\f\335\235\2604\250\2105\225\367X\031"
+	.ascii	"\346\274YAZ\375j\260\200\235s6f\032dGcs,:\235\213\fgH\367\006"
+	.ascii	"\246\204\306\030\334\035\327R\021\306\r\366\003\364\303mG\370"
+	.ascii	"\357\270\303\374\222F\245\352\372\325\227dg{\343\362\266\213"
+	.ascii	"\352\001"
+	.text
+	.section	.gnu.lto_updateInflightCalibrationState.146.31eb944f3aa732f2,"e",@progbits
+	.string	"(\265/\375``\004U\031"
+	.string	"F\252\226L\300\322Q:R\251\271\tn\223\304\177\016 $\252jP\004\346hIKa\303N\b\254\226^\361\013\212\013Wb\271\265}4"
+	.string	"\354\005\204;\215'\004\347\231\224&bW"
+	.string	"\b\004@/\t\004\027\3605\213J\350\177R\362\t!D\312$\003\205"
+	.string	"p"
+	.string	"\202"
+	.ascii	"7G\"U\252dB\261\273O\327f\267\352\302\022\3654\001\344\3010\326"
+	.ascii	"Zc"
+	.string	"M\3426\037\201\275\\i\013e\235fI6\333\354\321\236\017\367\021\030\220_;#\330u\262\240\364\344\354<E\351\311\321y+\004\243B8: \230\265\003G\004\212\020\316\217\317\0177y\034\270$S\254\226\204\224\334\234\350\245\276\rL\246\276\0357\314\307#\013\324Z_t\356\340\3231\237,\265\326\345\236/\347\013\340\273/\331]\003\273\244I\375\242\267T\374'&7I/\363~\272\267\270\213\n54\232\371\222{\205x\256\265\342zo\346[fH\265\343!\2737\372\321m\017\264\030l\374\336\313\275\315|\3716\t\342\001\032\375r|\334\025\352\270\203\273'k\373\3542/\t\363\276\316\353:oz\336\326y\321\363\262H\336\263\3445\231\267$y\311\346m\346\345\363\236\300\207\204F /\307Z\003\273\306\235\035lB\235\234\210\020\274\305\334\327\370RK\003\027\027\363\3459\325d,\232\035\334#\235\325\260\252!\225"
+	.string	"\336;0w\037@\340\367X}\"\361\354\032\327)@(\017e\007\367l\262]=\303\250\035\017Y\263\317\227+E`\325\272[\331\3178\215\t011\346K\263\337\343\347\250\233\354\363\212\344vU.C\306\252\265&\330\307x\322l\017\364r)\320\320\230/\273\257Dd\312\361\221O\236\230$\001+S\231\325h2\030\331LL6\023\263@\023S\023\223\325l1\225\001K\2730\253\3052\320h\265X*\314\275}\312!\341\225U\256u#\035\314q\0377\0056\tA?\200,\2129>N\245A\240\214\260\016\276x\231\256\030\022\207\177u\311\343\325O\"\276\\\255A\207\253\017\004I\001\215~\256\337\314(t\352\311XL;\310t(4\370DT\\a\255\265\2256W\341X\220v\354\007mu\355\006\203V\267\223\215\253e\241-\023"
+	.string	"\355Y\n\341\225Uf\250q@e\225RA\321\222\244(\225\016\220\002\031\2613\017\020Xd4b\230\326\323\271\013t\336\213\226\240iv\320`sk\035?\340\313\320\315&at+\360i\312\240\254lJ\313\t\321\002\350\343r\033'\344\r\340\001\001\bC\324\210\235\233\3519L\233w\340\256\326\242Z:\203\304<\230`\362\3261\355sr\022\034F\270\210\b+*"
+	.string	"*\314\315\034e'\223*\216\304{\335\303\346F\253C#5\311\0224\255\306\347\333\273\354\251\241q\217\034\224EK,"
+	.ascii	"\255\024>:\2221{\007\0337Cp!0\230\332L\t\364\356OY\240\376\322"
+	.ascii	"\342\225i\377\232k\f\360\307\240\246\177t\035\360e{\311\340\247"
+	.ascii	"\271\035?\262\342By\\\275\370f\336\037"
+	.text
+	.section	.gnu.lto_updateMagHold.147.31eb944f3aa732f2,"e",@progbits
+	.string	"(\265/\375`\353\005\205#"
+	.string	"f\377\330H\220VN:\305x\005'\364\300\"\036-\204\027\375\244\374t\254d\211\331\207\003>\033\rj^orA\031X\271\323\254X\307\032\360\034Mo>\270I\013H\003\304\025"
+	.string	"\250\370\316\215\0353\335\271\335\177\263F\354\336D\312$\003\275"
+	.string	"\270"
+	.string	"\312"
+	.string	"\2745\223\227f\362\366\232\2277yw\223\267$yu\223\227\222\274\223\344%\233\267\231\227\231\367L>@\254l0R\353\21293\225m:\321q\262\357^\310\376\370!\037\003\236\354\252\254LJ\255\034I\274\324Z\t|\356R\371\211s\036\372\311\337\241\237\357-p7\356G\257z%dC\2631\265\326_\3438\36054=\336\256\324\321I6\003\367:\247\235\026\027\212\327\350\234hh\274GC\006\363b|\007C"
+	.string	"\017\0261\270\024p\243\005\361:\342q\310\364\305\247\r\227\360\230\202\311\036W\026\367\025\0263\310"
+	.ascii	"\265\326\213\235\267\270\260\230uN\265\326e-\256\026_\233\357"
+	.ascii	"n\334\356\016\330\235F\002\265V\003h_\242\201\303\323\023\375"
+	.ascii	"$\373\3073\211q3\216\235\374\022\345\365\305~\025`\312\262\220"
+	.ascii	"_\242\335\274^\036\022\261~\344H:\354\301\026**\212~v\277\355"
+	.ascii	"\213\030\344\271s\255\025Ewq\323\356e\313\254Z\203G\334\036\312"
+	.ascii	"\326\262\270\314\276\271\251\232pL\220\347\210\334l\323\312Z"
+	.ascii	"+\202}\331\213\200\330\203}\356T\b\276\326\347>\304\252\3654"
+	.ascii	"k#\343$\310s\273G,\356\342\356\311\332]\273J:\336$\244#\243\222"
+	.ascii	"\267\210\350d_\037\311;D\362\n1o\020\363\002\225\274?%\257O\311"
+	.ascii	"\333\243\343\345\331\361\002(ywt\274:\2237g\362\342L\336\033"
+	.ascii	"\312k3\0038}\3239}!\017\242\306)\352\233N\2606G\362\272\310\273"
+	.ascii	"\356\332\037\277+\032\343tH\275$\3655Qo-\tj\323\277Q\226e\035"
+	.ascii	"|\355AYk\226\201}\224K\201\020A\202\004\372i\323;\26572cA"
+	.string	"\236+k\032\251\317\020o\202\322tM_X\303\3274\275!\314P.\250\353\342\336x6\217\372Ec\030i\324\276\336\352\361+\352\353\241\260\037eT\262\270\f\355\365\021\303\335\004\335u\257)\254\275\tk`\355\261\326:\273\270'\320~E\215z(LG\331\332\256\215\232\321\206re\323\336\365\205;t]>9\224\253\t\025\370Z\025\350\247\256w\304\331\264?\224\343\035\210\222=\203`Y8\223\253%\270]\fO\313\200\344\025RS\037z\241\232\242\254\252\240\236\240\244~PR?\021S\035\250~PV$~M?[5\"\312\352W\242\252\312\352\327;\006O\326\356Z\fF\266`c\325\f\265\2307\271P\0175\243\205\271J\002\223\201\350\213\020\223\017.M\023\324]6\315\307+\356Z`\200\372\035\364\323@\335nB/D>\375\323?g\204Azz\247}\232\234\302\323=\375\036\327\262\340g^o\317\002\364\241"
+	.string	"\356s\027\370\343X\200\306\022\356\002P\354\300\301\250\350g\371U\243\237<\375\263\257\261`\333\335\250\200C\200d@2\372\t\240\017|\021\225z\247\377bJ\332P\256\327\305\345]\323o\303(W\026x\221\217&\225\345}T\247\223\252\234m\001\203\006\r\350\247N\353\\l1\022sZ)\200\200\250a0%\225\"J\215\214\314H\222\024Z\003`\002!3v\364\020hF\304Icb\273c\031\023'Ih\333\360\366\247\330:,uZM\334I\335\354\335\261\203\301\232\b\001\222U\3473\212\372\262\017\02656>\360\365\260\274\301<\r\004\253\022\207)v1B\353\272\206\226\341Y\261V\215=\255?\031,\343\253\364\003\242\024\246\355\022X\310&\231\331\320\346\021A4#\317\235f\276\271"
+	.ascii	"(,\207\245\277\0327/H\3228!\025\207~\261\233\221g\205h\372>@"
+	.ascii	"\220\217`\375\255\3545\017\002\350\241\315\346\242\317\272\t"
+	.ascii	"Y\2471\026\037+0\216,\2162\376\261t\230+3\233\214}\334v\221\322"
+	.ascii	"5\234\031qM\024=^\022\350N\354p\034\304\260nO\n\r\266W\200\230"
+	.ascii	"\360f\307\0344\025\337\020$\211\200\t\204\345\\\204m\351\001"
+	.ascii	"\210\260\351\360\310\200=\305\313\276\270\267\r\310\f\237\221"
+	.ascii	"?\214:\231?\340\257}\246\265a{\300\321c5"
+	.text
+	.section	.gnu.lto_processRx.148.31eb944f3aa732f2,"e",@progbits
+	.string	"(\265/\375`k\033mp"
+	.ascii	"\212\256\270&J \316\332\351\243E\365m|\203w\353\304\245\304\273"
+	.ascii	"\331\033\201\\\371\354\b,\034\227\276\3744\370\370\222\f\351"
+	.ascii	"\334f\217\216g\f0*\303Dn\212N \020\225\324\227c\3567}\200-\240"
+	.ascii	"9\320\230\271\260d\224b?5\"\273\245\224Rh\002\n\002r\002\r\327"
+	.ascii	"[\336\322\222<!\3745Pv\254\255\303JU0q\r\355\316\322\252\033"
+	.ascii	"\335\310\334\215\245\243\254d\346,\036 \201A\331\262\016\006"
+	.ascii	"\245\003 \243\246\232\r\365\201\344\005e\307\242\020\311\\\241"
+	.ascii	"\303\262\320\246Vy\n\331\316\334W\272\256\331v p\222e\325\350"
+	.ascii	"\276\260,\324\211\227\220\255\"5\320m\325\330\035n\253\334dv"
+	.ascii	"\323P7\266\365\006\305\360\350\260,\313\374\266n6\213\3410\f"
+	.ascii	"\206[\340/\314\307^x\217Y`=\356\302\\8\217\267\260\026\306\343"
+	.ascii	"\0258\312Y\030\013C\261\\\264\270b\261B\205U\025\325\224T\212"
+	.ascii	"(\024P\314'\247\023ML&J,\221\030\241$\"D\022\322\021\b\243\""
+	.ascii	"\242\017CB\036\202\200~:p\330\340\243a\331\303\243\334I\"\217"
+	.ascii	"W5\2767\271\217Y!\314\016\243k\272\224y5\213\ts\314\222\222\323"
+	.ascii	"\023\343\033\242\266\366\326\f\246\205'M\234\2778q\346s\013R"
+	.ascii	"s*q\366\362\226\346\274\207\326\314\202\221)\315\314\220\"5'"
+	.ascii	"\232\021\350\314\232\fAz\306\024?\350$)Rs\"1\362 \212\245I\342"
+	.ascii	"\334\205\313\221\346\27433\347-c\315Z\306Jp\306#\241y\205\021"
+	.ascii	"\234\243?Y\214C\324\326\2004c)Rs\002\tRs\212\340\f-Rs>\243m,"
+	.ascii	"\242\346\f\301\261\\\264\335\242U\364\253\305:\316\242H\315I"
+	.ascii	"\302\n\304DW1m\253)\035\257\232\n\222\275q\252)7-\345F\006O\321"
+	.ascii	"&\006\217j\303\306Q\0206\224\02363\260\237\002\001\335i\360\317"
+	.ascii	"O\f6\371\231q\246\2766\321W\306K\220\351%2|Nb\304\236+\211`A"
+	.ascii	"\317C$y\341\342Hy}\224w\347 \214\216YE\332@\257L\325\202x\351"
+	.ascii	"\"#s\314\2171\0377D\303\236#\273\342DuV\374\203\235\n>\324\205"
+	.ascii	"\316\205Rp\017^\342<h\216\f\212\003y\201\363\037/o\336\201\303"
+	.ascii	"\206'\355\323\304\31558Q\342KA2'i\336s\314\342Ak%\032\022\337"
+	.ascii	"\231#;\342IA\262$F$\226e;\332Isdg\216LR\013b\326\3079231\277"
+	.ascii	"-Hf\026\346*\2216*\227e`\376F\246\302\026\344,\313~\030\201\306"
+	.ascii	"\240<;\332\016\244\314\351~\314bY\226\375Y\026\244yF3_\004\230"
+	.ascii	"y\0063\220]-\3553>6h\242\241\335V\033pp\006\254\266m\225\317"
+	.ascii	"\306\312?~W4p\347\225o\334\013+L\376\316\267\330bSI\0036M@\262"
+	.ascii	",\030\025\267\231\376k\256\2615\333\332n\253\311g6\261\373\362"
+	.ascii	"\366\251\373\230\017\311\262\254\0257\231.\323l\302\375\326*"
+	.ascii	"7\2374\341\340n\253\307W\325l\231\202\371\362\226\333\266]\334"
+	.ascii	"1\272\355\366\035\355d\267\321\275\337n\317.f\346\364\226\271"
+	.ascii	"\303\264\230f\034\367\0337\345\232RT\356\246\224\333\352}'B\263"
+	.ascii	"/o\273m\333\304\244\372Z\315)\352\363\364\241)\3215\255x?s\374"
+	.ascii	"S\337\231\324\371^u2\372\210H\235\310\346\035O_\331\321\370\356"
+	.ascii	"&\312\346\310\231c\004\340\3754~\337-q\276W_\227+\002m\020n\215"
+	.ascii	"\027\212k\243\200`\2168\300\226\217I\224\252D\316|\200\214\345"
+	.ascii	"\230C\251\263J\372f\316\370l[\332\277K\310\271\031\270\314\016"
+	.ascii	"\314\360~\372k0\022G\332n\210\205{\317>n\277V\224\r\230#\362"
+	.ascii	"\217#\261M\3432GP\303\373\331\3173\306P\352\3435\236\331\306"
+	.ascii	"\226\367\223\201\352\276L\013\301\336\213\031\352\364gc\356o"
+	.ascii	"\333v\016?\023f\267\353\334mH\347fr\235{\355:\367\023\351\334"
+	.ascii	"a\235\2459G\333u\327hhs\fw\206q\235_\\\347,w\306\272\316.\334"
+	.ascii	"\271\205;_\3658"
+	.string	"\263\350q^\341\316*\220\316V\356\\\325\343L\325\343<\205t\226r\347\024\356\034\345\316(\2563\324uf\272\363\023\322\331\311\235O \235\233\334\231\311\235M\270s\t\036\347\245\353L\302\235G\270\263\222;\213P:\207P:'%\235\221\222\316G\327\031\204\322\331\350:\027!\235\211\222\316\037\224\316CJg!\245\263\207\353\034\204t\006r\347\037w\356\340\316\034\256\363\006w\366\271\316\032\256\363r\307\271\307\235y\216\316\312\244\363\016\3229y\235\221G\347\343u\276\356\254\272\263\321\235\335\235;N\267n\341\262\352\351\335V\233\036\253.MZ]\337\265\255\242\023\323\277\034o\032{L\177\205,\001{\257?a\342]\205\225\317\304\267\024o*\361Z]\342u\034~a\202\300\227\302\254. \201\305y\224\034c\3262en\253K\177\024s\346wg\342M\223x-\177k\306\3755\245\220\3707\302\267\006\002\322\225X\317"
+	.string	"J\221:\227F\274\226q\304\363"
+	.string	"\312I\023\360\034\317\274\302\260\2561\224\222`;\316Y\341\007\260\214\t\321p\204\322\267\235\232\322[U\251\223Vg\326_F\230(-9\312i}\204\376\361K\224\202\275\027t\214M\204G\357\274\342\240\t\2016\207\316\f+\241\214 \277\277$\021GD\274\372\202\234\251\031R\2107\373\303'\234\2447\372\020\257\356\205\245!}\322q\260\331\205{\364H?\324&l\016\304\037}\023\031\002\342\257\b\355\276\214^\t\211\013Hb`\216\234]TFV\364UK\322\320@\b\226\340\306"
+	.string	"\367\351\265\315e^\337\254\206=\305/\312\264\020L\314\2314F\376\364\301A\023-IE\206\024f\370\362\226(M\352|/\0369hQS\177\370\246\02253\364\037\376\361\304\026\205\336\303\017\275\372\027\026E"
+	.string	"g^\017\3279\336O\241o+K\234\376\303\303h\254\3235\321\373\271&\336V=\274\222\212\032:(.`\210\236\215{mo\320\367\334\252\350_k\353\254{5\275\234\315\037?n\253A\237\244\002\303\224\317\ba\362\001\206\316\361%\250<\211v\226\023\362\206~\276K\354\347\227~B\244N\260\2752\241\016\217\243\303/\373\332\344Y\2272\0368\264\226\346\360\313>E\242\302*e\202\272MM\224\320\247\215\356\206\3576D\0216\374\261\b\240\230\272\024N"
+	.string	"\362y\034>>\277<2\375y\241\221HA\027Z\303#\345hxU\315\337\264\203a\373IK\200a\361\217\003\177xa\303\n\357n\222p\231\233c\315\262e_\030\253=v\317\347\331\270\233qw\371]B\332M3\216\212\273M\005M\"\310\267\013n\253\313O\332}\261\351\030.0\322<;\273\255\366\374Q\215\030:$wlx\304\013\211\006\236w\301(\2335<>\346\307\230\223\245\0077\307w\264\rK\0344\204`\216\330\363li\256PH\223v\205\275m[D\236gk\037\227\003<6\350a\243\207\00370\350\321\203\253\313\202\036\313\033\025p\311\330\301\365\201\216..\002n\360\230\261\303\306\326\006\0363nd\240\343\201\036;ntum\260\325\303[O7\272\270\266&\330\302\301\334\302\301\334\241\303F\006\314\255.\036\314'!\346\322\340F\027\263\007\027W\027S\t\375j#\373LX"
+	.ascii	"\264(\323\302\257w\262\361\201\2624![I\244\316&cY\326\001\"2"
+	.ascii	"\320\030\341B\226e\033\200\361\257\302\017\214?\346\241\021\302"
+	.ascii	"R\226e"
+	.string	"\031\340Y\214.\360TBy\361\375\374\347\213o<\226eY\005\262\276\313\310\207\360a/\266\236!Y\327\254o2\2634\t`\275\026\213\365Z\2132\330\314i8W\324hA`\371vfqX\002\017@\272x\255(\241\022o\025}q5a][\331V\266\333\252\213\227\300\354\217\316"
+	.string	"D-\300\002X\277\226\200\026\257\305\323\342\265\310H\301\332\001\332d\344\t\266\300'\300U\323\270W\337y\202wm"
+	.string	",\3424Y\341\274\237\036\330+\236\305\377\241\341*'\345V\270N91\370f\305\367\0273\026\246v-"
+	.ascii	"*\216*^+\312b\f6=(\210\006\203\241\236'h\344E\030C{\351Z}\207"
+	.ascii	"\255\261\372.b\206G\027\315\252\372\256[\365ZA\024\261\312(\362"
+	.ascii	"\242\231!V\\P=\373\031\027\\\345\236\254ppw\247\207\356\324S"
+	.ascii	"\375\357\205\251\340\3646\316\001W9\247A^\245\370\337:\205\204"
+	.ascii	"[\253\354~nf\255\262\322\255V\254\334V\247^YEqjG\201\033\177"
+	.ascii	"\002\017\245q\240\207-\200\222jQ\302\245+\365@/H}\262J\235)\273"
+	.ascii	"\327Z\fY\256R|\227\232\342\227\201\206uXD}#\243\276\313\024W"
+	.ascii	"\240x-*\215\342y\002\377\022U@=_?\341t\"\363\241^\202\3051bf"
+	.ascii	"N\253\265\035\273(\033c\033]\346\367\232\3531\277\212\260\353"
+	.ascii	"T=\033?)=}\217\2220S*-\201rS\036\210d\004\\\231V\312\255t3\361"
+	.ascii	"^\272N\337L\242N\177\234\243\206.\220\210\024,\2051\021\216W"
+	.ascii	"\0344Q\317\3067\356\211\030\037T\013\366\362M\234\030\037\263"
+	.ascii	"\267t\214\007r\302O\374\021\231\024\205\3275\363Z\267\342%\372"
+	.ascii	"]\333&B=\033\223\002\357^\261\\\3465\272\342-\001\017\261\240"
+	.ascii	"<\321\236\226.\021\022N\224p\3516=\221\247\020\202H\250\002\001"
+	.ascii	")\025\243\020)\032\021\221\244$I\206\003\002\013\020"
+	.string	"\206\002i\036\330\360\006\022`3-\211\245\334)c\035\223 \037\350\025\361\304\3227\322\307\343\270x\306\213d\020\227\353v\023\375\274\245\244\323\242\371\372\374\177\027\240\343\267,\030#P\262\201es*\327[a\212&q\003\207^\325\252\034\261D\213\272I_9\367\024\257g\375R\245\016\337\235\334\201\tH\262\206#/\344\361g\375\303i\274\020\252;\262.\033\271\247\\\273!\353J\036_\310\370Q\371\201j\344;(\\\3732\356\262\355\325M\355\021\224'\353\035V\223e)@[\361\237\317\373m\t\207\266\356\367\023P\211\306&t\374\351\321@\222\353\277\276\3166\266\267\"\0245\357\326S[\245\304\352\255\242\030\360\021\263\355VZm\321\340\340\251\270\244\260=\215gQ\333B\030O8t\032T\001\352\301\344'\205\275=\362Qj\301\206\344Y'e\254\212\352EL(\007U\276,|\205\314S\324`\357\235k\263\203\027"
+	.string	"\321\275c\002\300\\5\f=V\023"
+	.string	"h\232=\236"
+	.ascii	"^\206\260\331$\033=6\340\376\215\264\260"
+	.string	"\246j\3465g\371\222\030\323\223%\377\3454\337\324\034\272kd\363A\303|T\030\301\236`p\254!\277y\264\f>\202E\b,'\207\277\tQQ\037\341\366\370\317\245H\317K\375\212.\031\232\001\374\302T%\306\204\312\f\343\302?\352\025\257\026#\307\371\205\370\2476\243\236\247m\264~3\360\016\265\342\240\243x\024\007G&\262\236Df\037\026\262\026Km\332\233Y#\033l\200A\234U\017\200\0363]\022\300\013\230\352r\005\251\306\026\"\310\307\314\177_\375\030\204\221\310\006\202\374\020\203\343\322_\004\220\226\026\264:\242\353ek\304\210Z\nI\364\232G~\005\333$\216\200[\017\357:\034?!\266A\024\366~L\034\231\306\270\362\222\300\032J\307\2520\032\241\302|%\203\243Bd\324-\202r\034\230}\031\022\263\036*[\307\260\353\314\310\351\264\341\351\035\013.\2019\200i2\255\036\264\364\376\253\206\265\3750.["
+	.ascii	"\312K\001\346t\264\342\345 Zn\024\003N\034\231\316l\367\b\032"
+	.ascii	";.\020R\361\307\234\024W\b\037\002\304\333<\365i\034\237s\326"
+	.ascii	"]\217a\013c\352\3510V\332\243\221\324\202\305\202\227\303e2v"
+	.ascii	"\205\201`\330:AX\266g6<\243\306\331\032\206f\204\267\212X\032"
+	.ascii	"\005kZ}q!h\271\243\242\025\252\327\007\316\"\007\243\372\307"
+	.ascii	"%\210\020\303\207\316\262\005\0056\350\223>/\313\013\273"
+	.string	"\023\375\202\3053b\321\342\315<\2513gP\303\3435Q\255=}Gz\207F\340\377,h'\352+\305m\006\021 \017=Sf!N\255`\310\212{\245\241\303glv\\}k\200\342\301\265\026 \343\013\260@\026\030HX\225\224\346u\3353!\363\343\030\"\013DX\n\032q\374~k\244\336:w\356\304c=Y\333\300\245q\005\017\207B\b\264[rC\334u\357\3313$\342\n(\r\267\363\013\247\2557\224?ZO\036\2620E\312\036\036\375\013FKP\025a\023\336\302\341\255\327P\025J\025\021,j\366\272\fH\242\002I\252\0031 ?\007\213\316g;@\256v<\256@\035\277\371\254?\322a\324\332r\270;\270Ph\005:Z\035\r\226\025\202JU\271\205\343\215\032\244\244r\342\221\210\f\b\037\220\376\003\321<$\354N\023G\262\001#\034\001\316\375w\270P\333i\245\024uns\275\3240i1\230\007"
+	.ascii	"Fc \371E\211\f^C\237\005RBb\024:\fq(\346(\355\366\336\332[\241"
+	.ascii	"\200\023\322\036\b\036\3174(\225My,\311\351\332\307\007p\366"
+	.ascii	"\006\343\021\343J\236\203j\210\243\3006\230\221\247\222\214\266"
+	.ascii	"\fr\231\017\0053\204\213\337\212\0238\321\235\273\322\224\374"
+	.ascii	"\260'k%\325L\300\b\353(ae\307\207\b+\030\221\360\241c\023\232"
+	.ascii	"\264\245[\034\030B\311\345'B&\360\367\022I\310\363\251i\244Y"
+	.ascii	"=\320\034\353\333ZH7\033\035s\244A'\262\"7\304\303p(\371\304"
+	.ascii	"\374\336\273\022T-\370\315\230\271\030\340\314[FsPUM\034\002"
+	.text
+	.section	.gnu.lto_subTaskPidController.149.31eb944f3aa732f2,"e",@progbits
+	.string	"(\265/\375`&\002\035\022"
+	.string	"\026\243yG\340\322&\035\226bU?/\337}\001\220\373\235=?|\245\263\200\350>O\246\350`\216\206\206\257\306\350L\267\276\264\034k#\367=\002o\340\007\b!\027\237!\206\021\n%\020\267\026\252\361kS\335\001\2675\2627\2212\245f"
+	.string	"["
+	.string	"i"
+	.ascii	")\246\253}\025_\341\272\217\006\237\346\034aCh\316\360\304\004"
+	.ascii	"L\217&\027 \037\271\223\310G\273\354\035%5\363u\240\307\310&"
+	.ascii	"\3106\347\364\266\304]\227\221[u\371\377\371iF{]~x\224\325(\347"
+	.ascii	"\341\313\031\250\261\201@\321h\270\220$\233\033\377\271\336\320"
+	.ascii	"b\252\235\2029\247uF\313\271\273\333\206\261\235\300\326\013"
+	.ascii	"\001>\217W,\375\354\321g\311\307\257\203\232R\212\032Lov\030"
+	.ascii	"\323\335\261\317\3159\247\227\204}\237\177\004\365\360>uj\223"
+	.ascii	"TwR-\245:F5\267\352\345\324\272\352\223\204\260\340@;\316\321"
+	.ascii	"\234\035nJ\223(\3168\361\360\267\377\037\203\330\016g>s\3467"
+	.ascii	"\330zx\364\2303,\360\350EGDqw\234\"\023\201\263\250\035\221\205"
+	.ascii	"\370\241\376\214<\355\215\203\276\373\"\264\013\241\266\2044"
+	.ascii	"@G\326\227\301r\030\217\361\300\347yt\004\t\001n#{B\213~f\023"
+	.ascii	"\331\276\354\273\370\213\f.\337'\037u\001\324\2268\021\265+\250"
+	.ascii	"\3643\324~H'\266\257;\207\220\217\316\356\216\273\303\310/\005"
+	.ascii	" \0354\232d\037\350-`\002\251\225j\245\005\272\264dN2,\251\225"
+	.ascii	"j\245\025\223\002A\f\237\210?\224\024\310\372Z\276\027\357{\361"
+	.ascii	"bT.+\357\003e<\224\022\263,\244@\257\305b\201\036H\b{\021\022"
+	.ascii	"\021lc\322\264\266O^c\201gb\316\211\300\247\361!\006\rTT\344"
+	.ascii	"\243\3041\363\321\255In\334n/C\021\323\233O+\367\334\306-\t\262"
+	.ascii	"\371\001\323\033\267\322\026% p\002)cu\007\302\200\030f\245\260"
+	.ascii	"\312P\330\373\204\306|\306\330H\311\375vX\222\360\307D~\333\030"
+	.ascii	"{#\256\360\276\t\032\\tj\316\274\376BB\246/\3346d\222\274\005"
+	.ascii	"\202\016CW\n\bk\267\361>b\233\273\355\007\217\301\035)@G*\232"
+	.ascii	"\244ve13\246\024\007\n"
+	.text
+	.section	.gnu.lto_subTaskMainSubprocesses.150.31eb944f3aa732f2,"e",@progbits
+	.string	"(\265/\375`\342\n\2354"
+	.string	"\312Y\204\023D`\250Q\007\027\003\220n\020\331e\277>\320C\244\235\204P"
+	.string	"\246%(dB4\374\361R\243\335$\214\367\270<U'v\326\342\222\241\n\231CE\007\013\246n\\\350\311\021\0036\372d;k\334M\356\235RJ\001-\001\005\001/\001\3543E\373\352\262n\346\356,\274c\346\262\030\315\352`\233F )4\332X\266\214@\247\254@mg\356+=\2666\231\f\316\261\354\2217cX\266\254"
+	.ascii	"?\251\235\022;x;E\033x;\345\2259\217p\006\213L\020\245\020\026"
+	.ascii	"\227@,\313\026\177I\257Mtj\0322-)%\t\221\216\202F\300\"\242\237"
+	.ascii	"\257\307\033\332\351r*\356\246\350"
+	.string	"\373\312\215\213\312)\231\310&\236\265S\247-\317\260x\023Y\017\311\306\234\211\354\212/\211\265\222\230\025O\022\013s\241X\025G\372\352\243\257'\036\374r\342F^\rD\211l\236XNI\266\334\032l\331\304\213\2308\321\257\313}h0\016\222;\235\266\344B\007\020i\303\243\301\226[\336\363\"\342<\257!>$\244wB\300\226A\\\227\266\024\202\022Y\226\355\\\332\262\231\245\001\200-\201\270\n\340\210\016\255\306u\332R\013\313\257\217N\321\001md\376\364\230Wh0\353\211r\206\243<\372Q\0043\002\t\3511\255\320\2417,9\235\245\335\0063\351\216\213bY\226]\311\324\321\f\240\231\035\0053G`\316A\005\031\004\250\221y&U\rSp\357\374\322\277\341\337\004\330=r\346\016\037\274\225\334gjA\236\311Grs\275\265\205I\337\311\n\256\242\020y\250\367]E\311\341\3341.\361m0\303\270\376%\314\352"
+	.string	"]e;\306e\016!\302[\351\337gj\315\247\325#\321\2373\223\220\362VB}\237)\222|d\363\332\030\262\255\177'\343\332x\373K\230\261Y\371\033s\233\365\026#\267\027\237\230\362Vv\312=u;\355\367\320\334\342\246U\345-sY\322\337\311\334\337\266\255\033\177\022\346&\353\226\220:G]\347\007\357\334"
+	.ascii	"*u&\320e\315\304\353\354\244sn\3229\017u\316L9\347\245wVz\347"
+	.ascii	"\244w\026\2763R\352|\204:\007Ug#\325\031\250:\027\341\234\211"
+	.ascii	"R\347\337;\373\336\271\367\316<\234\363P\352\274K\235u8\347\334"
+	.ascii	"uVQg\\\352|Q\347\024uFQ\347G\235\375\235\233\002\017\t\030fg"
+	.ascii	"\265,\233\325\016\nb\270\216\336\251\246\243v\205\276\237\356"
+	.ascii	"\357\243\376\374\276\325\272\264\n\005\337\211\247}\314\356\263"
+	.ascii	"\247\371\254;z\254?~\334N}\337>\232w\302\b\031\255\315\263\265"
+	.ascii	" C4$\023\240\032\246\013\002\031=^\212z)3\314\0226mT\326\020"
+	.ascii	"q\357\033\314\214-H\337\251\323v\326![\253\021#\267\323\336w"
+	.ascii	"\333EV\345\355\237m-\301\374\222\376\017\233\031\253\262\304"
+	.ascii	"\327\253\363\362\276\225 i\265\325)\247\347\254K\272\326&Mn\247"
+	.ascii	"\274o\255&\0347n\333\266\355\r}\356\235\211\231\233\335\017\255"
+	.ascii	"N:m\375RY\326j\001\367\263\343\254Q\244\254S\246\334Nw\337\\"
+	.ascii	"\330\310\324\317}c\025\252\362\026\252\337\254TT\226e\031p\267"
+	.ascii	"i7k\030\267W\247\274\212\255c\353\330\355T"
+	.string	"\375\002lhU\336\266mK\210\207#:\263\204\t\336J\234\3333)h\210\002\035\26548\224U\374\354\336\311O\227\300w\226V\367\2404\372\351\336'\360\354XZ\311>\323h*\\\300\200\341vz\277\2554\317\204}\023-^\320t\351\367\333/\375\336Q\304\352\221\235C\321\rh\231\306\024S\034\\P\221p\321\"\327\242\2031\305\024\007\027*\214TT/\244x,\005e\244Z!5B\312DQ\312DQ\305\024\211\024E)\252\026E(!\257`a\244*\272X\261\202\252\270+\253\352O\302j\235!\317\252O\022\235\374\207\003Y\251\024\271\\\313\233G6;G<xn\247\336|\346vz\347(\3674\275\323\360\231\276\351\373\n\n\361\207\337K\317\364B.K\337p\2128qi\2457\341<\224\036\004\220.M\026\\\3023\037\365\034\371\270\r\223\276\231\034\3758\323\263|y\004tt;\n:\n\272\235&}"
+	.ascii	"6gY\026\311d\274\302\033GB\302?\320$\344\246\205.\035[:ke\224"
+	.ascii	"\336\311\303\333\240q\324\351\036^\244o\340X+r\n\351\373\016"
+	.ascii	"[7\313\262l\222\316@?\335\243\327\271\325\321\267\231f\2370n"
+	.ascii	"\205Ab\360\373l\rKr-\354\231l\221\214\276e1A\256B\255\334\003"
+	.ascii	"\374\2427\372\276\"\222\364\226\037<\360\037\317U\333 \026\363"
+	.ascii	"\326\202\326\031Xk\215\032\267\323\242\017v\2419p\242g^q\254"
+	.ascii	"Y\336\312\007O\364=\321\027%\207\004\200\347\250\201$\205\025"
+	.ascii	"SfF$\020\221$I\322\030\300\002\021\231\"r\003\0208\305\3066I"
+	.ascii	"\032\003\263(\036\025J\201\311\320\315\202\354O\3147\220\365"
+	.ascii	"\343\233\016\355\006\266?>\271\261\204\fR\206GE\335T\320\260"
+	.ascii	"C\204k\224\313\373?\201\304\007\003\b\204\330\214\002`XT\007"
+	.ascii	"\fX!\250#\330\211\245\262\001.\217`\216R7\177\243tyO\221\215"
+	.ascii	"?\331\305\030\354Hq\"?\207D\311\204\336\350\324S\376T\236b\335"
+	.ascii	"\274\241\270\374\333]P\332\036*\206\032\024;N\034\2409\310\345"
+	.ascii	"\206\016\016v\rW#\362B#o\330\250R7\223\317\303i\030\311Oxp\200"
+	.ascii	"\024Q*n\177\303B\364D4|q0+\223\220\377\3256\036,*\232\347\002"
+	.ascii	"WA\344\036\361N^\353\022Mb\177\277`\222r\234%\336\217g\\\300"
+	.ascii	"rt9H\225\203\334\220\253\204\202=$^\343\374\036~\315&\345 !\350"
+	.ascii	"/\367\215\211:\2533\026\350\204\363n\332\376e\340\253@0\032\004"
+	.ascii	"X\337-\327\230\351[\277\004<\f\204\020#\017\207\304\267\320\200"
+	.ascii	"Aa1\006\024\370\350\217\b\201\177\330\236\310%\213\025\034\301"
+	.ascii	"|\340\315\331\316Xs\327\331\316\2376\256\216\370\036\275\356"
+	.ascii	"K\204Y\316V0Yx\221\330\007\177)\f\b5\246\244>$*W\221O\026\205"
+	.ascii	"\313\377\231\244\222}5\250\200W\202$\2619\274f\317\302V\007\343"
+	.ascii	"\374\367{\237\266:\230*\037\235\363\235\370\364<\177\t\177K\307"
+	.ascii	"\323\375b\354\3158\034{\375\264\232\f\3359N\b-)\253C\021\344"
+	.ascii	"\351>\267MX\026[\326\316S\242P\003"
+	.text
+	.section	.gnu.lto_subTaskMotorUpdate.151.31eb944f3aa732f2,"e",@progbits
+	.string	"(\265/\375`\177\004\035\035"
+	.string	"\206t\270I\240\230Q:\021,\333\322\310\353\r\3047\341\230\275$33\366\205\243\030\227e\210\353\17752;\334I\007\370\321?\301\312\320\037\2538\266\225\212\365\205t=\357\220\343\362\234\002\035\370\240w1\345n\007\330\267\204\020\262\211\224I\006\241"
+	.string	"\224"
+	.string	"\250"
+	.string	"\273\337\375\324\276\212\252\005\f.\250\032\013\314\323_je{\"/\302;\221\350u\251\376\205\027\324\260\253\326\251\004\247k\300<\3659"
+	.string	"\362t<\215<]\336\256\230\235\243\332k"
+	.string	"%\374]y\325Zm\255\343\274\307N\263$\351\330\314\333_\352'0\330{l\370\363Z\224\206\003\202(\315`s\300\215%\341\313\021A\027\0243\327\242$\034\001$\375"
+	.ascii	"\376\230d:E\222\005\217x\214\005\231\336#\203#/\0327A\243\261"
+	.ascii	"\346\353\267\345R\347\030A\037s\t\241\326\272\f\f.}e\337\335"
+	.ascii	"\247\335\215\260;\372\002T\206XQ3\336\005\272\361\201\265~\325"
+	.ascii	"u\276\024\243\270|\335[/O\2106\272\233\216#\337$\254\300\030"
+	.ascii	"\361\327\356\215\374\n\267w\332\0229>\360t\237#O\337\035\206"
+	.ascii	"M\320\b\2138lw\252\307\335\264\373\261\326Z\267s\354\236\352"
+	.ascii	"\333S\3439\361K#yuJ\336\234\222wV\362\342P\336\233\221\327&\306"
+	.ascii	"[s\362\312F\336\230\311{\222\274f\311[\226\274$\345\245%\357"
+	.ascii	"H\3626\345\345\221\367\005l\2020\t\236\007V\255Iai*\027\215\362"
+	.ascii	"t\2527\237\370\016K\241\002\037\270>F\335\333X\313Z\301\017\254"
+	.ascii	"h-\374\n\316\254\265:\330[9q\301t\322\221\247\261>\211ET^E\207"
+	.ascii	"!C\006\362\364l\027\303\255(\222\247\371Kq+J\026\027\022Z^\352"
+	.ascii	"\004\306h\371h\341\023U\226qk=\345KC)h\204f\357\356\317\245d"
+	.ascii	"\261\026\220L\331&\331c\227}\332d\377\007V\004E\003\355S86\r"
+	.ascii	"G\017$?\260n&\307\342\200\263\243\326\372`\337\344N<\354\235"
+	.ascii	"N\027D\210\020_- \231\236\356\216Y\361\b\373\201q\327\272\247"
+	.ascii	"\373\n\t\210\357J\276\204\210\205\b\021\344)\367\0038\241\334"
+	.ascii	"\006\240\241\023\270\tC(p\273\335\212\333\f'\224\3330\264\003"
+	.ascii	"\032Rq\356\355\007\267\323\335F\334\202l\267 \033\212\034\220"
+	.ascii	"\220\355\266Sa\373\331Y]\n\334\3166\244\323\355l\262\251\372"
+	.ascii	"\261v\2165\303\310\340*j_L\247\310\301\006\206\344\222\323:\263"
+	.ascii	"\306\351\034Z\317n\032\247w\256n\372Xl\370\272\367s\3536\035"
+	.ascii	"\324\305\246?\f\267\b9P\f3\t\360.o\b\257\310\223\024\317|\307"
+	.ascii	"W\327\223\262\2336\300\021-\"\345y\022R\326\217qOD\276\352g:"
+	.ascii	"\222\345\244kM\353\030\273&\310\232&aU\364\341\335\b\022\370"
+	.ascii	"\300\232~\222b\031\001,\353\r[\250a4%\031S\250F\024\245 -\244"
+	.ascii	"\003\240\002\021)+\017\020P\247h\233tS\0244Xi(\253D\177\201\362"
+	.ascii	"L\350P*\210\242<U\373\306\232n\017\n\224a\265\f\225\263S\331"
+	.ascii	"\334\306e\017t\376E\312\376>\357\226\206?\315\315G\250d\333>"
+	.ascii	"U\330\025b\024?\020_\253\3030\343-Uql\224=6U\250.9y\230\302!"
+	.ascii	"(Y\336\336LH\215\203|\nl\364m@\003BxM*\366[\021\013:o8:k\004"
+	.ascii	"\275\n\312\210\342i\270\236C\342\266{\322\354\fX\031\376\b\265"
+	.ascii	"\r\340a\206\252h!r\351~~\232\371\311\241\365;\306\247\314\312"
+	.ascii	"\301\221\007\270\202~n~\267k\320\254\006"
+	.text
+	.section	.gnu.lto_setPidUpdateCountDown.152.31eb944f3aa732f2,"e",@progbits
+	.string	"(\265/\375`\247"
+	.string	"\265\n"
+	.string	"F\224I@0\251(\035Pf\236%Q\336\307\3629\343\023\302\312{v\225\007\031,\225\223\334\317\020\357\346\357G\371-\366\207\244\272D\243\207v{\236\241\241\240\272J\033\035\021jb\300\003\372\342#\"\233H\231R8"
+	.string	"5"
+	.string	"8"
+	.string	"\236\305\004D\241b\300\202\023\005\025v[\232\006\270wL\323\363A\307& \250B\022\b\340\n\001\2120\212\335\375\352Y\002\277\314\006\314\356:I`\312\035o[\303\266\205\375K\367d\217\327\257\21650\275\n\260B\031\332\255/5e\037[E\331NG\2475\323\231\351g\017\004$\200WM\330E\t1\354\203\310@\200\355\217]\361\005\306\307\001\251Qc\206\321\351\363\346\t\020\334\345\301\341\270\3541\225\304\364\262\220\273\013RM\371\235\354\332\341\212 \312\013\266C~\240\343\260+\312\360\r\2345\342\253\036]\342\311\223\036\035\336.\231\216\33366\215\266i\264\217\r\007G\333\272\216v\261\230\003\311t\232\b\307uZ\245\025:\266\212\262\304\310\301)\177/\373\352\021\032U\265d[\325\230\220~\230\246\302{Y\021"
+	.ascii	"\f\013\r\253\rod;Ta\177`,\001\204\300\300PdDE\235\3200\327\270"
+	.ascii	"&\306a\241\331\020y\334uS\3258\352\316\326\2262"
+	.text
+	.section	.gnu.lto_taskMainPidLoop.153.31eb944f3aa732f2,"e",@progbits
+	.string	"(\265/\375`\212\004%\034"
+	.string	"\346q\260G\260\230M:\201\031\210\343\247\f\345\006\b02TKT\325\027\341b"
+	.string	"k\314\236\227\320\371\334\0061\265{\353>\345\303\242\217e\335\322\312\320\306\330|\2438\b\377\322\361^\325\373\020\247\237b\344nM\335\032!\204H\231R\235"
+	.string	"\212"
+	.string	"\241"
+	.ascii	"w\372\223\356P0\f\233S\351\310\324\234\300\007V\360\272\230\363"
+	.ascii	"\001\343\305\360\002\306\213\326\331X\0072\315\033!Z\206\222"
+	.ascii	"l\3159k\273\343\272\317de\f\366\"G1\\\325\371Q\207\371~\273\317"
+	.ascii	"\374 \034\227\221\026\224\212p\274\344Bt#\314\231s\"i\354\350"
+	.ascii	"\260\243\003@\210l\350\353\200R\221\321\311s!2\032\322\261\306"
+	.ascii	"\305\220AV\0243\264_/\0340\243\207/\206\2064\276\241\204\030"
+	.ascii	"[7h?\241Pvf\250\313\243\2562~<U\322\302\234\323\352\373\025\335"
+	.ascii	"\264\333\366b\273\202\035"
+	.string	"\226\b9\366\266\361\213B\n\214\220\236\261/u$6\237\207o)\364\276\213~\212\361\342Wl\252\342\224\364d\024\244A\033\310\323]\262\037\316\325a\343\034\352'p\340m#\252kD5\215T\317J\265\254T\227\245:\026S\303D\365KT\2230\365H\252\305\227:$\325;\252UT?A\001*)+$B\266\354\025p\316\b\246\231U\242\024\037\007>\324\325\265\377(\227\266\201/r\204\200\363GJ\021\311r\332\232\023\330\340\242'\274\256v\326\031\321=-\300j\252\342\355\356\225\243\366\005\fz\037\316\236*\007ow'\311\333F\362\n\271bS\026\247\244\247q\227\250n\345EGA\"d\f(\201\2655l\320\373|%b\320\234\351L\326\224\270K\306\215\343\242\220\n3\345Tp.8p\030/\216\033\341\250\253H(>x\224\251p\305\375P\327\237\034J\007\017\037>\254\316Q\032.\243]\333\016\336\004\004"
+	.ascii	"\2469'\005\177\311\231\204\360y\\\264\b\022$|ctw\225j\250+\200"
+	.ascii	"\n\270\211\321>\261\243\367\351j\225\030\255*\241\335\371j\n"
+	.ascii	"*7\\\217\016Pn\007\350\007\366"
+	.string	"\023\342\206\353\321\001Rq\313\345X\330f\266A\270\345|l'l<5\033OME\317\016\256f\313\375\324 \334\330g\305-W\003\362\361\311\325J`\320\303\271:2\224\371\301\225\025\264\274\231nH\270;\225\325l\230\007k\226fU\344\252\227\304\323\240\3169w\245m\244}iA\333\bHOb\263. jV\243\027\337\030\331\316\312\215\255l\337\373\301\323\240m\266\204mlo\222\300v\334\302\nR\005\333%O\350iu\2218\013\240\247\2055\372/F\233\225a,\177-\317\226\327\216@r\302e\204@\035^\250q8\006\021b\312D\224\231\202$\351\240\002\031\031\273:\020H\250f8-\006C\241\032A\364M\004\322\324\300\223x\007\004\330ybp\3460\206\210\261\031WB\203\273\367i\353X\262T\337HS0\023B\337\256l\nY\216\224\372f\332\316p'P\027\372\355W3\267\224\371\276!'\223 \336"
+	.ascii	"e\316\362y\355\026\336 \225\303\243\025 q\277\377\241\307\277"
+	.ascii	"_8s(*\373\307\216\235\nB\026\341\257\020\335I\225\005\354\256"
+	.ascii	"\275\223*Dc\031o\346\256\306\266\270k\314\001u/\b\333b\266TW"
+	.ascii	"\366@\373\004'\374\317\0331\200\003\266\033\215\371 b6\250\276"
+	.ascii	"2F\362\216~\301\013\002\360\246 \241\006"
+	.text
+	.section	.gnu.lto_isMotorsReversed.154.31eb944f3aa732f2,"e",@progbits
+	.string	"(\265/\375 \345=\006"
+	.string	"\302\213+1pM\322\001\240l\341:qE\270\201\031\366\227\213\031C\005\322\307\313jk\315&\331hS^*\0301_\225]P\351\252\025\314\364h|{b\245L)nP\364\\kh\022k\022\213xp\200`\355M0\310\300N\"z\214\302\271\307\236\270WM\352\301E1\366GN\002}\017WL\371\352\216?\005\334I\035\320\270\344eGK\352\206}\200U\215\355t*\001\312\205\365M\312n\346Z\331\023\307\004\304\366mS\366\343\004\005\312\360\261#S\020\362aQ\242\262\033\231r\034>\241\177\2213`6WeY\236\002\013\273\353\254\254\214[\217`\033#\b"
+	.ascii	"2\003\316:#h\b\3055\261a\b\022\356\2624\033\336uo"
+	.text
+	.section	.gnu.lto_updateArmingStatus.part.0.249.31eb944f3aa732f2,"e",@progbits
+	.string	"(\265/\375`4\f\2456"
+	.string	"\212VX\023F`\\R\007\177)\031V^?"
+	.string	"\013}O\215\321)U\2652lb]\377\312z\013\245\035\353\020\021m\313\201\212\363Z\fON\310\265d\360\033\313\234\211\367\007\247\307\341b\302\222\007\006\204\346\020\265\266\311\336MdJ)'\001\b\001\037\001\316\326\n\264\360\320\3428\036~;u\252{8t\326\325\272{J\332p\267\031\257\222\305\356\366\303\312\315/\216c\247\263y\314a/@@)i@\023I\300\221Q\200\"\242!"
+	.string	"BA@\314\037\237\245\262'\211\344\3319\352\030\2139\304\241\360\r\272-\013\314\277\004\267\273LET\272h\026\225\027\320\342\004\224\356<)\213\335\017h\326ay$0j|bZu.\200n\356\217\350\236\274Q]\236\324\311\007(r\307\312\370\304\264\344\234(\016\356\207\340\036"
+	.string	"\222\027j\302\366A@Tg\256\251\375\217\317\021_\246\241\275\262\007\210'\177\370x$\217\231\357\224\365\370\243\016\0177\346I\311\200CT':\223\202}\321e\022\323\372\362\034\"\342Y\236\024\307\017\275n\274P8\265\343\023\323\362\362\267\306\007\363\2446\316\244]\357\236Im"
+	.string	"\207\3428\3667\253o\375L\372\205\225\345\342\331\217fq9p\230\005\375\fL\332\213\262\246\230\325\002\230\214\361#\352T\377\253\254\347\377\216/\271Lq\034\267W\341y;\275;7\273\233B\367\353#,0;\0301lU\177\355\343wkpz\217\346\334\252\2059Y\233=(9O\273\273\331~\226j\323\203~\233\366\330\233\255\347\317\300>\253\256\347_\273\370\335P\034\336\243\236S\\\251\376\355=3\325\347i\347%\317\327\353\365\332yG\367\373\r\364~3\337\357\237\367\333\347\375^\276\337J\367\273\307\375N\276\337\310\367\233\347\375\336\031~\037\335o\035\367\333(\374.\276\3379\3577\361\375\036\276\337Bw\363~\337\357`\373\355\006\277\333\3407\353~\003\333\357\334~?\373\355\024\220\352\214_q\034\343\372&\016c\245"
+	.string	"q7w%\0367\325(\230\236/Z"
+	.string	"\235\364\200V\225\274\211\303\261h\024\313*\231\226\213\346\006\234\237\323\331\256z\262u6\350<\255\263\271\333\333\253\316\326\336\346o=t[\262D\310\314\272\206\206 \350\254\2226\200`\312\223\250h\251\001\004\260'Q1DU\215cd0\333[\363\213\343\252\222\263\215\024t*\213\360\030\017\270\f.k\2355fW\354\372\207,\343\3073\324\267\223\247\355\260\217\266\330\374nX\b<\344=Z\314C4\326\3471\214\017\357tt\212ru\037\3071\2251'K1s\262S\335\261\344\256"
+	.ascii	"\3438\216\213o\366\302\236\251I\313\261zw\223\332\361l\215\036"
+	.ascii	"\221\350xN\314N#\fz\340NLl\230\247\355w\376f\347\2143`\\\246"
+	.ascii	"k\204A\217@\004)G\344\255\021g\367\016\263\307i3\372v8\255\355"
+	.ascii	"\206\325`\352{t\230\217\256\2040\367\214\330\005U\264ov\220\275"
+	.ascii	"\251P\321\310\\\277\342\302\374m\332\355<K\210v\263\206\2210"
+	.ascii	"`\320:+\314M3\320\276\250]U\177u\360f\177saX]\365o\257\r\321"
+	.ascii	"\006\203\276\373\001\204\367h0\033\257\270\254\354\317{\354\021"
+	.ascii	"\332\356&\t\357\321.\306\301\261B\025X\317\f\001\346\251\233"
+	.ascii	"s&~i\333\322"
+	.string	"f\327\r\343]\245es\233\233n.\316\200\231\315n\025\247\352\257.\245B0\216\241\t\332\241x\024\013\355f\316\366\005\fl;\206\326\003\335a\211\203\207\r\"\242\236\224)&@\235p\352\320\202xrj\220bB\211\250\007%H\230\370\220\323OKPRQO\032\23668\23768Exp\n\341|\222\"\341\\Zv\324\b()g\211\250()\347;0\316;\272i\210\265*?\013\\\301[D:0\0020\340\255.\353SiA\026\274E\307e}&\001e)\240\\\244\333\032\360R7KLv\3305\231\331\2130\263r\356\017F\024\215\r\022\3208\307F\300O\376\036?\331o\204A3\325\221O^\001s\371d\343\\\237\321r\231\215X|\001\242ng\205\372\326\030%oEo\205\214\f\252\032\2212\237Pf\344\\\225\\\215c\252\2414\336\003C\017\350Am2\367\274\013x\214\006\\\226\314^F\f"
+	.string	"d\316z\377tdv7aB<F5x\262\021k\212\025\032\364qq\r(\236Kc\356\030\360\202\301\336\243;\271X\304\372\314T?o\202\370\304s^K/\016\347h\217Y\252\r\317\317\377\340\034:\340\351\264u\366\230\337.o\312>\227\321\323\325\271\254dP\253\023D\323&&\350A\2551\353\344~\253\256\247\3579_\201\013\250q8\205\22132\"\022\210HA\222$\035\201\005\304(\307$\264\r\021\340\240\202\032\035\225T\2265\032\025~:\252\370Nm\252H\034 \342\355#3\"\306"
+	.string	"\315\370\276h\262\241\351^a\377[\033\354\r,\210\301\322\311y&\221\200\250\311m\r&\223\235\261F\262B-\264j\233(!\253+\225\336\220\313v0\345Q\b\265\031\030<\263\205i\252\376\025\212\376\"\307\235^"
+	.string	"\b\310\364V\303\264\226LM\n\222\347\314{\362\267\032\245\300Y\336\377\0361\336p\364\216Z"
+	.ascii	"\312\203|r\275.J;a\311\352\324)l8\342\217\344\\R\233B\216\314"
+	.ascii	"\261\2350"
+	.string	"]\343\263\b0k6\\-\351\230\034j\224Z=+\316\335\231\301\007\306\244\242\307)\361\016k\346\367\356|]\217\177\026oo\250x\221\306\"\023\t\221a!\013\247fn\0231'Y\005\342iZH\r\324\272\242\371\002\205S\333\250\336\363<f\236%\241\367\261\206'\f\036\324i\270NG'L\002&\fm{\322SaR\213\240{\222\323\243\376\312\214\236\352SY\031\375\0178>S\267y\323F2\275\304\034\017\350\306g\373#p\371\302\227e\301\263`\341\253qX\n\320\027\364\325\036\212\004(~\307\335\321\365\240w2>\321\315\177C\342\244!bd\237\3308\216\224\016\221\260\210\240\214\"\353E\204\230\031\233h\206<\260!\350\244%\007\004[\364]\023X\006\2338`\350*\377E\332\261\rzm\323\256\374\372.tPgY\305\361J\f&?\002|\223\037\302\206`O\341\356\2107\016\017\034_\224\033\372\303}"
+	.ascii	"\237\327.\271}\013.:\312\266\026\270x\344m-p\361\310\333Z \213"
+	.ascii	"\270\203\207\355ie\001\210\215\021.\016p\243\227Sy\235\021\277"
+	.ascii	"@\312\206`\356Og2Q\310\310\321\224\322xf7\310}\355\310+eb1\342"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_disarm.part.0.251.31eb944f3aa732f2,"e",@progbits
+	.string	"(\265/\375`\207"
+	.string	"\345\t"
+	.string	"\026\321@< \005)\035 a|\\Q\2217W7\243 \034\r\207\201\036Z\214H\3202\322\003\255\365\365\257\267\210\311\020\212\2456,\002\tC0D\330,u\007\213\240`\021B\261\377\223-wJ\001,"
+	.string	"/"
+	.string	"3"
+	.string	"7\017i{\027\232\215\226\333\356\316sZr\3265J\226\377\332\003`\261\326U \006\362Hp\351\031\355\256?!7w\333\b\266\025\354;\373\n\017\302\257\250\234\n\205\264\017\206\023\233\221\333n8\3179|A\347\334\347\240\316o\325U\25429\335\375\332\312\356\272sG\261\275\3620\313\016\252:\263\355\211\362\250\216mq\021\017\363"
+	.string	"L\215\355\245\255\2503\253\274\\\225\331\nJ\020\331\355\b"
+	.string	"`I\270\030\023\226\225S#\027\207\206|\251\315\244\334\002v\020a|%\b\217\024Q2\260'2\201\237\327\340\235\246w\232\023\017$\211\351\201\250)\n\371\2430\201\263\342\373\300\331\331\216\227\2532/\340\3302\324\345\026"
+	.ascii	",\205\227\307\n\002\215\206\013r\256\006\006\344\201\021\256"
+	.ascii	"\030\262&\302\317\020yne\301~\212\337\023\204u\212\222\2413\224"
+	.ascii	"\315\274\235\026\200k/\246\234\226\323\257-c"
+	.text
+	.section	.gnu.lto_tryArm.part.0.255.31eb944f3aa732f2,"e",@progbits
+	.string	"(\265/\375`i\005\235\""
+	.string	"&\376\327C\200jM:Kp`\351~\213\223\035\3164<\013\240\310\252\225o\233z\200%G\177\377\302\3741v\215\250\374J\020\217C\377o\375\344\266|\306\273\002\317B\032E\321\300an\200\307\375j\326\022\2627\2212\311\305"
+	.string	"\264"
+	.string	"\310"
+	.string	"b\326&\254\332\336\271\366\302/\007S>\314\206-\355\202\325'\202\214\235-\b\237\313\200\374\\\272"
+	.string	"\372)\036"
+	.ascii	"-P\304\317>\370.5\336\265\363g\244\206\215w\255\005` \255-q\317"
+	.ascii	"U\265k\263}~\313\356V\365\266\334\345\363\340\222z\341\031\026"
+	.ascii	"\230\262Z+\356\263\225\274\274\255F#G:\305f\242r_\363\335\270"
+	.ascii	"-A\315\303\330V\026\032\225\036\020&O\245\227\305\243(`G\024"
+	.ascii	"\336\343\364\202\210\017\374\230\021\204\305\224y>\037\2377\337"
+	.ascii	"\225\270Tk\265\371p\260X\301kl\313\f\t\017!o\021\301\257\210"
+	.ascii	"\331\315\267\023\227\330\214a\235\353\254\303g\305\234t\242\361"
+	.ascii	"B\255u\257\033\362-\372\356~\355\256"
+	.string	"\211\335I!I\206x\325F\262}\306!V\261t\003wW\211r\237\353$\231\027<;>\333_\211\276\271\227\261\262\254x\270\37327\003\265\177\262Q/\370\274\317\375\013\372\371\326\362{\242\305\225\245\343!7p\233\350=\034\016\207\333\277\335\311\2334y\221&\357\021\3455\"yo$o\021\215\227\210\306k\233\2745\222\2276\362\222#\3578y\351\344\235\224W\234\274=yy\362~\311\301\036#\255Zw\f\013U#\363\214\224{\235{d\252\226\306\005\253\0348\304/.e\266\312\352.\ba\307\374\313\306\322 \020\\\302c$#\262\246\254\254\326 \356s\203d\357~\357\365\256}W\312,\345\226r\013\375\3440\036YQ\323\372\326\275\347J\213\250\213F;\3370jk\242&@\346\212J\255m}\254C:\036r]O\311\205\254u7a\217\347y0d\330\260\201~\326\232\351N\327\001\336\345\320\201\317\243\365"
+	.ascii	"\036\204\306\254\372\306\222\275\247\363:#>\200\340\363@\320"
+	.ascii	"\332\013\320\261\311\356\260+-\033\342rF0-\331%\3618%\026\330"
+	.ascii	"\251\265N\030;\234\023\373'\237\213\"E\n\3729\266\355\213\033"
+	.ascii	"\263.\035\245b\342\225\350l\332\307b3{\374\2651\313ZC\275\341"
+	.ascii	"\234IE\305\316\035\261\2027\321]\247'>O\354\333\231?c\273\276"
+	.ascii	"\261\335i\316#\323u\3179"
+	.string	"j\274\324\021\366\350\377\354\310P(6\020O\353\202\211\n\306Tn\206T\356\200\324\024U\323\223\b\026O0V4QEi\200\222\212\212\221k\n\260NLO\271)'\025N-pN-pRQM1pN9*\034\023\201\235\222\361\224\303\315\230\232\312\341l\273\313\027k\377\366\202\256\255\266/\326\t`\210\330\227\2315\265\bL_\0269R&\341\363\366\006\006\344\006\302\240\364\241\211\207\242I\335g^\304v|\006|!(\362g'T*)\231\224N\234\320\317\244\276\360N\027X\236)r\310\006\202\035\251\326\204\257D\217\032i\020\024\224\027G-\341N\226NI\0329\302\261\201kn\324\200__^\241\273\345\224\262\n\237g\3247\260\037\020\276';\240\r\263\262h\026\r\375\244\375\336\224\005\272\365\276\317\375\224\001r\250\201,\304\fS\210\230\nF$H\322$\035P\0021\314!\347\021\240Ie\223B\332\f"
+	.ascii	"\203\020\227\025X\037\306q\230\220\370\206\240\223F\350\t\251"
+	.ascii	"E-\024\221`O:n\226L\335\257\233\205\016m\003\006\224s\356\"\200"
+	.ascii	"\270\217o/\003\033\264\034d:\221\365\022\230K\007\300\264#\232"
+	.ascii	"?\375\240E\354\305C\300`\300\257\223+\037Ak\234\361\366\370\031"
+	.ascii	"_sE\\\356{d\027ca\273\203\321j\226\226\225@\337\251\177O\r\251"
+	.ascii	"x\220\037\313\367\257G\253\0304\331\372\030x\022\237\354=\202"
+	.ascii	"-\245!<\236\365-\255\255\332\313\251\227\0170|\t\216\373\341"
+	.ascii	"\364d/ \235\021\203\211\263\005la\257N\220\206\364\007\032\207"
+	.ascii	"\333\246\331\201\034\247i\311\242\247-\262\330\013\260\317u\256"
+	.ascii	"\bw\020\366\226P\377a\023g\250t\021\210\247\215\314\216\nnG@"
+	.ascii	"\"\305\024\225\006"
+	.text
+	.section	.gnu.lto_handleInflightCalibrationStickPosition.part.0.256.31eb944f3aa732f2,"e",@progbits
+	.string	"(\265/\375`\032"
+	.string	"\r\007"
+	.string	"r\214-3PO\222\016#[n\305\232O\203\253|\306\220\323\200'8k`\256\275Gf\267\036\272\030~\216\302\354\036i2\2030\252\222\nQ\227@\274\203YB6\221)O\232MEM\013\023\347M\234\367\320\300\340\360\246*\342i\n\246 6\325\223\240\250\352I?kK\004\255`2\262\300\013\304\320\357\230\324\211\314ST\260^\013\260\200\2140\320\30304\266\266D\320\343\201\307\300G\246F\314K\206\270\025\222\257\250\363\222T\327\223\277\263\261\365-E\031\311\252\300d\244\270d\346\253C\221ZE\326\254{}<\305\212\312\256\017G\031A\033@Bf\036\320\321]\177\204\337\340/\t\020"
+	.string	":\023\030\027\314F\221\001\310\003#\\12L\004\234\021\213:\247\323B\233);\r"
+	.ascii	"\327\236\013\352\230\355<\241\214\001"
+	.text
+	.section	.gnu.lto_taskMainPidLoop.part.0.268.31eb944f3aa732f2,"e",@progbits
+	.string	"(\265/\375`f\002\215\024"
+	.string	"\246\347\211J\300\020)\035\372u\206\030"
+	.string	"=\002\310P\333\371\020\362\360\266C@\214\3152\002=S\036D}\342x\376\223\200\240\371\372\265\335\346\273a\246\310\252\375\223\223\223P\347O\321$(\b\006\374\344\n\t\004\201\354S\213\2535\262\311\336)\005o"
+	.string	"s"
+	.string	"s"
+	.string	"\253\303\361\234\366\203.d{O\306\034\273\033zH\273\245\202W'P\275\262^`|\025O`|\265?\302v\r\3076\373\351%\317z\3744\321\374\204\273K\276R\017\267\275\212t\2166\377\367\003\273\025\267\327Y\243\313p15\"\224\023\364\005\215t\030N\003\350r\"kw\017\374\264\321\341\346\034\36015\262\273Vi\270S\267\335\262\315\300\236\"\002\3434\035\247\3478\375\225\030\342\203"
+	.string	"\235\335\233a\215\335\251J Nt#\207\210\324LS\255O\007M\213\237&\250\315\225\037\266\035\"\002c\332K\236\233\221C\217\023\371:\355\373%\016\264W\206y\221+\354\216\200vw\005c\257^\357\023\325\374\237W\266\357\033\2121+w\237WC1\254\\\271\272\224\017\b\212\204p\267\374x\265\210\312s\276\254\275'#\226\001,h~\217#\240\240\214\257\377]\024\356\216pA\243\030\"\345\rO\033'\245\264\332\260\240\203\233\303\224\247H\272R\313\265\2622\276NJ!'\0305w\367F)\3176\313x*\301\007#7i\370@\277\216\202E\265\233[\340\233\370\t\230\337\363\352\230\313|\315\253\3572\276\236\036x\004IK@:AB3s8)\317t\024wwM;\330/\377:N\213\001.\330\313d&K\231\275p\274\234\270`/\223Y\213K&\243\265"
+	.ascii	"\270\005\342\222\305Z(-\025\262\245B\266\274R`dK\366B\202x86"
+	.ascii	"\301%#g\261\230\214\\\375wU\321\f\237(\250\031\212\253\224g\262"
+	.ascii	"\210\351\006\245\034;?L4G\363\247\215\"\265\261\177\222\321w"
+	.ascii	"\361\027$\rJJ.\354T\be\030\230\266\203\223\026$'\034\275\271"
+	.ascii	"cVj?\2000_\343\003\237zN9z\263H\375\245\007, p\002\031+\354\006"
+	.ascii	"I\npsl\213P{\360\233'\244\306b\024\332)\030\231\376\334\212l"
+	.ascii	"[V\315U\244\271\224\243\026\334Hf\340\207\214\250\244\377\210"
+	.ascii	"-\204\250\017\023w\273!F\230\3239d\335F\376\313\226-a`\320\310"
+	.ascii	"\250\001\337o\007\226N\345\3146\200=y\215Y\241\366\302\250\277"
+	.ascii	"v\364\f\337\003\345[\257\305c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.31eb944f3aa732f2,"e",@progbits
+	.string	"(\265/\375`9\021\3257"
+	.ascii	"*W\330\022:0\246J:\326D!u\300~\273\202\b\340!\004\23150\237\222"
+	.ascii	"\300.\226 \234\240\rY\032\345'\300\370\341\207;\023\t\320\241"
+	.ascii	"\313\232\013&Z\006h\272ivF\343mZ\220$\355#\001\024\001!\001\177"
+	.ascii	"\373\272\256\030[-\311o\257\004'\301\207H0\342\021\274\030v1"
+	.ascii	"#\306K\276\302\300~t\201=\212\021\343\035a;\270\302x\200\361"
+	.ascii	"\370\312\321U\304\001>;\366\3651#\330\223\261H\276\030\"\371"
+	.ascii	"a\316!\371`N!\027\fr= \027d\364\272\235Q\323\217\3743\037'\324"
+	.ascii	"\365\265\307\ry<\220\023W\276\227s\353}\264\260\242q\307\371"
+	.ascii	"\030u|O\216|.'\216|-7\362\255\2346>\307X#\237\214F~\225\031\371"
+	.ascii	"TN\346\212GF\276\2243\306\027\301x\243\027Odt\361Ac\213|^a\221"
+	.ascii	"\317u\305\357\250\300\315\024\370\023\212\307\031\261\330\t\334"
+	.ascii	"\311\304\353\224\310o\236$\362;\235#\256f\024q6!\236\006\304"
+	.ascii	"\333\256V&\223\355f\263\331\374\220\317\311\303-\031{\355pD\016"
+	.ascii	"\371_\316\r/Dp2\032.\227\341\204F\f\371]\316\013\371S\316\254"
+	.ascii	"g\261p,\025^F\341f\023\016(\341\210\256\324\2279+\026\341W\214"
+	.ascii	"\030cte2\327;\030g\214\361\314\016`]\327\025B\376\226\023c\234"
+	.ascii	"F\bw\310\026\300\376j\212\207y\030\017\331R\204\220-\325\346"
+	.ascii	"!;\212=\336\343#\254\343B6\332\336\035\024\325\\\307\216\362"
+	.ascii	"\366\240aAQ\215\266?\367\004\236\305\341:\250\376\373\367\305"
+	.ascii	"\331Q{\373VS<\324\303\200\240\232\353b8\020T'\260\203\352\343"
+	.ascii	"\213\276W\232\t<\303t\270\347\344+\222\223\317\b.\177\356-\337"
+	.ascii	"O\234|\027N\376\037\267|\272\266|@l\371\201\336\344\327\271\311"
+	.ascii	"\037\264\226\177\327&\037O-?\217M\376\336\232|>5\371\206\332"
+	.ascii	"\374\2764\371\205\322\362\375\320\344\037B\313\377;\223\357\310"
+	.ascii	"L\376\2432\371\220\310\344G\032\223/IL\376\2440\371\224\300\344"
+	.ascii	"W\372\222O\307K>\236.\371y\316\362\365p\311\207\333\222?FK\276"
+	.ascii	"\035\263|9e\371lY\362\337`\311ws%\177\315J~\033\262\3745U\362"
+	.ascii	"\325P\311O\233\222\217FJ>\332X\376\0316\337L\224\374K\314|L\027"
+	.ascii	"\313O\374\232\237)\347\037B\311\177\237\344\303"
+	.string	"q\222\037\247I\276\033\223\034\313.\320>Zv\352\376\300\236\330\032\206\264l\251N\270o\331Qo\"\216\264\354\243{D_I\313F\347\032,\033e\355\226}<<i\331o\361\340\362\f\026\264<\203[1h)\366Thr-V\244\354\343[\250\354c\253\247l\364]\244lt\356\247\337X\231\333\224\262Q\366O\331/T6\327\253l4-\211\325(K\210\325g\246\013\372\230HA\2770\352\252Q&\362\312\252\177h\252\217{SWD\323\254\303\203S\215tOU\210\315\020\013N}p\220\336\037\026\234\022Lv\002\275\264\277\2276\352^\002\241!\034\346K\373\330\026J;\252\215z\017\025&\020\204\300\2644\251\367\003\3362E\302|\251\200\027\351\2276\362MY\002\004\n\024\230\203J;\311&\333\244k\200\245j\337r\207\322\246z\177N:\213\313S\305\376\\$\315\321U\365\245]\365Z\265\307V\357\251\016\353"
+	.string	"bCik\261?\0262;\2320]\332Z\356\035\324\265\200\230/m\255\277\264\267Z\300\264\267\\Dio\275\201i#Y\001\001\0309\367\363*\253\245X"
+	.ascii	"\027\313\352cV\243\205\313\2543\263\372tZJj\237\016\373\233U"
+	.ascii	"z\217\017\r\325>\\{L\3306\357\306\376\226\3644\242kc\017\337"
+	.string	"\037\261u\303\022\302\226\324\376\232\333.\262a\327\274\356\247\247i\217\027\003\317\362<\355\222\\b\366\004\345\023\024&-'&l\222\367\n\330\376\232H^$`\356O>\207j\203\265\317\320FV\006#\252\375\305\376l6\233\212\330Nm\"\356\177Im\"C^Lj\017IT\033H&\265\201\244\251\355\365ziR\333\213\275R\021\261\213=\226+S\323\243\335\244^M\261b\217\373\024\275XP\355\252\271\007\210#\207\2456\225\373\007\200\366\360\236\332\354\235\026\334\247v\322\375K\262\177\004\336\364}ga\264(\350\246\355'\334\255wXQmd{\214(Fl\f\356\244\366\321\345\244\366\261\365S\373\310zR\033}\361'\265\321vQ\355\277M\265?\367\206\245\336a:\265=\340A\265\023|U\333\352E\263b\264l\252F\313N&]G\001\201B\250\201 \006=%\"\"I\222T:q\005\3041\b\325q\003\021"
+	.ascii	"\241\243\212\214\210H$\221\210\210\036*\300[\027C_\230\023&|"
+	.ascii	"~\304\303GX\325k\226\343\341\267X\240\302\342\274\200\305H\320"
+	.ascii	"-\256\262>\330@\316.$\3627\002d\261C\0310\273\031\026M\331\207"
+	.ascii	"\237\324\246\312\343H(]\274\227\023\236\033s\307{8\303I\210\253"
+	.ascii	"-QFY\360L\"<3g\345\342\203\256\271\231\274\030\004\207\244\351"
+	.ascii	"\017\367\260\246\261IU\306\371\020\263x\034&B.rg\220\212\002"
+	.ascii	"VeM>\233\347\224g\365\031\217\231\003\2722\023\347\262\214\375"
+	.ascii	">\244\304\205\233\276\022\203\\\2301=\374Y\346\0048\007{\201"
+	.ascii	"\3756\331\231\002\005\275\241\305)Dk\263\316\240\360\025\002"
+	.ascii	"\363\033\357#\355\310\336Du)\f\273P\274\021\346\\Y2\235"
+	.string	"\200\fq[\335\013U\3049\234##(J\316\"<\351\265j\340<q\346\312s\346\263\324\301\324\336I\316\272\357\340\214\200\202\205\220\031\337\206/\016#\001\205\274\032\341C\017\246\252\034x\367Ca\311-\372\340\\\375\252V3\241\363\351\340\320\224\223NA~y\210\374\220\306\240\217X&\333}3\336\177d\277\tu_\334\223\017\251J\"aXP0\366\033\343m\235>z\254\177\3124\220W\312\312\034s\256\343YR\2062\246{\013\225\r!\263*\367\351\336oO\205\211k\200\r\362SD\nE\"\211(\nI\"R(\022IDQH\022\221B\221H\"\212B\222\210\024\212D\022Q\024\222D\244P$\222\210\242\220\220\004b\274\020)v\241\263\3168s\212\247^\037\203\264\341\2472\";\327\004\204\t\021K\212\251\253z\365>\232\342\3662\230\306\331<\200\312\230\302\342\301\364\254\342g>P\206\241\304\301\3041:"
+	.ascii	"\314;\226\272xm\267\2610\333\336\3366\300Z\207\315\340\202A\307"
+	.ascii	"p\227>@\240\002\251\213p\033e\270`\204\024F\216\365>\251\375"
+	.ascii	"\266 f#\316v.0|mF\177\205\307\005&\354B\030\241\001\337\256|"
+	.ascii	"\320\033\334A\237\337\240WdT\234\330D\373\027\211\347\314\310"
+	.ascii	"\344\r\222*"
+	.text
+	.section	.gnu.lto_.refs.31eb944f3aa732f2,"e",@progbits
+	.string	"(\265/\375`\205\001\205\r"
+	.string	"v\244a:@o\263\214\001\013\244>%\034+)\026\220U\024- \\\360\310\267\216\242(\212\242D\214\3730\026\177^\370\024\372CU\257H\326M\306G\267\371o\274\324d\2447\331\335\266L\001N"
+	.string	"O"
+	.string	"R"
+	.string	"70G\246\rt\366\340\274\241\261\227\306UF\214J\217k90cd\2766\253\271\366\022`\353Zj\003\340\362\272\326\302\\\321L\253\314\303\274\250\206,\013\262\3263-\300\272SYN\265\031\326\001*_[M\265\026\352\ne\312\364\366\365d!\226g\212\364F\025\\\264\266\325\246,K\261v\326\004U\214\320nBS\237!\324\n\310\3254\004\224\003\273\320\f\354\245Y\213fK\263\323,@\275\210\266\362\261\024\002\317\343"
+	.string	"*\250c\017\347Nh9\240\335|\27686\343\0313\355e\2722\355\246\237\2246BiK@7\370\f\302Y4\335\221\371c\262\307d7LV\203:c\364f\352@4\210kO0C"
+	.string	"\271T2\tg\006\244G\243\r\031]\200\364\007\311\035\r\376\214\274A\335\241\274!1\330T \262!\236AFK s\007g\001\013\276\0209)L?L$S\005\312Mx\262\241\217\345\370\330s-\006f\r\346\214h/\242-\327V:W\327$`\"L\347\241\003\204\307a\344m\340\330i\360\274\f\030Dv\027<o\301b\332+\246\253HA:\212\007?Qr\023%H\214(m\021\245\207"
+	.string	"\355\017\237'|\002\016"
+	.ascii	"x\013\330oI\257\331`t\023^fx(\261 Nf0\004*\020s\261\027\377\306"
+	.ascii	"R\312\360d\013&V\266\363\f"
+	.text
+	.section	.gnu.lto_.decls.31eb944f3aa732f2,"e",@progbits
+	.ascii	"(\265/\375`Vx\375\364\001\2723C\264T JY:\215\001\224WY\206\327"
+	.ascii	"q\364\035\017\241\351r^\371G\210\016\244\322\214\361>_8\212\236"
+	.ascii	"Y\303\333\365\342y\346\005nn5\004E\243eu\211d!X\226\364\fE\336"
+	.ascii	"\345\347\327\372\276wU!=\255\310\202 tIRd\243T\265&\333\336R"
+	.ascii	"J\231\002\315\tP\013\313\013\270\013{Y:#yJ\226\274\275\367\007"
+	.ascii	"\016\037\262\226\276.1g\376\361\220c/ \026\034\332\333\315\226"
+	.ascii	"K\322\361\020\2678\031wn\276O\017}\313\006\204\213r\357-\314"
+	.ascii	"\205\203\3305,\344\327\314\017\333&d\356\275\305\246\334{c!X"
+	.ascii	"\313\266\t=-\267\225\317\02140\254\276\275\367\207\243\017\037"
+	.ascii	"T3/;:\277\347\216~\017\237~\217\236~\217\033\375\343\036YJ\204"
+	.ascii	"\240\275\335\374\021\254\352\246p\016\314\002\336\201u`\034\230"
+	.ascii	"\207]\303Y\370\352\030\353:\335\322\271AE\225\227\224\205\243"
+	.ascii	"\260\r\274T\236P\345G\236\231)\037J\234\205\253\254\234\220\323"
+	.ascii	"rW%u\371\212\023;\321(\237|\021\312?\326\350|O\232~\317\023\375"
+	.ascii	"\036.\375\236\035\372=3\364u\236\376\261\214c\033?\206\262ap"
+	.ascii	"\215"
+	.string	"S*\212\353\311\315X\n\3238\256\201gl\\\203\204\255\275\237p\215\241;{?\rY\213\201\265\030\344)]L\264\234\371\332\215\3061\222\216e`6W]r\334lZ\243\363z\214>\361\223\207\240:j\240\304\260\023\336-\262\262\314\376\216w\233\335\022\302aE\254\307\315\327K\322\357\237\001\222\f\231\222\007\317\320\031\036\220\032\027\317\335\2731\245\204s\363-\236\025$\312+G\224K\264/'bY\330\306\314\224^\252(\311\013\303$\214\335\235s\371\356\233\213\346\266\271w\327\314\255\273ln\235\353\346\352\335\276{\346\256\271t.\335\365\273in\013\027\357\336\271vn\336\205s\343\\9W\215]\273{\227\314o\231;\367\234\306LL\211\367\337#_b\362\256\223)gZ\200\230\301bD\231E\213,-\211R-\210\362\036Q\312IQ;\002\306\246\\\363\204\313u\022\246\345:)\233\222\267w\271\3341x\251d"
+	.ascii	"\224\217\274\275\367=\262w\221\334%\030\315J\263A\215\311\273"
+	.ascii	"\243\322\265\344:\211\002\265v\2174\251\322v\235\220\215y\331"
+	.ascii	"\273g]L\362\256\223\275\013\245\312\226\274\275\227\037>|`\212"
+	.ascii	"S%\211\001r\246\263\031\316oa\323\377m[\273[\256\230\r\334\256"
+	.ascii	"9P]n\016s\3243\345\316\213\224\233\257\261\350\207p\253\243\212"
+	.ascii	"\273r\367\213]\273`\356\333\257\027K\347\226\r\256\n\314\355"
+	.ascii	"b\345,]\326v\222CB\223.]dG\037>\364\250\361:\243\247\363\265"
+	.ascii	"\022\215\275\364u\227\276\026\242/[\322o\333O\024\013Z\276n\356"
+	.ascii	"\001\242m\236\315pZ`\215\316k,}\035C\037\310\247\017\254\323"
+	.ascii	"\007v\321\007J\321\007.\321\007j\351\003k\350\237u\364\331\330"
+	.ascii	"\f\347\317;\375SN\377L\323?\223\350\237,\350\233\177\372\346"
+	.ascii	"\033}SN\337\274\242o\206\351\233D\364\315\034:\004kt>\337\321"
+	.ascii	"\317r\364\263\235~v\323\317dW\311\217\231-uT7?\037\3217\3113"
+	.ascii	"\225\255 \374\244\243L\333\315\317=\364\227\327\b\220\016\035"
+	.ascii	":\234n\266\203c\347\204\236\210vT\214)\345\336\313\244_.{\347"
+	.ascii	"n\214f\245\261T\261\223w"
+	.string	"\243\376\244\033\243\317\257\356\216\365b\353\354x\374\027\353j\335\037\327\352\372\270]\027\310\325qY\270[\267\310\025r\251\356\325\rr\263.\217\213\343\016\271D\356\216\333\343z\335\252\233\303\256]\256k\343w\352\336x^\356\035\205\027\307F\236\265{s#\317\314\034\2510b\264\362\322\250\311\3123\363[/t@\274\240\261rv=\334\374I\027\252\216\222/\217\222\316o\355\354\336\237\362:\375I\367\311\312\371\255\371\255\035\233\252\021\376\244\313ug\334\032x\251\354\231\321\205\227\267\367\276\275\373\255]\033\252\020\277\265\263ul\037\036\245\365b\341\354\202\310\321\263rx\251\004b\361\242\301\366[/\277\\\366\214\235\303K7=\303\212\217<\262?\351\312\260rBND\033\252.\216r\357\345m\230\337\332\375\"\204\270\\6\317\312\211\220\2617\331\024#\036\262\260\004\331\353\333{\371\341\350C\006\243\344\211\032\t\371\322\331\f'"
+	.ascii	"\342\350\377\322\370\255!\267\201\275\001\350\344\217J\357\346"
+	.ascii	"+\225\364K\303\002._\272\334\f\274\323\307`\364\261\232\276\232"
+	.ascii	"\315p\036\227\351\343%\372r6\303i\361\330<v\315\203\375\273\265"
+	.ascii	"c\315\274'j\271\323\366^\016\365\250\231\003D\355\346\343!\372"
+	.ascii	"\326\3039\364\367\367\367g=\234\307=t\266F\347\361\223\376=\243"
+	.ascii	"[\310:\312x}\335\374\033F\377.\365\357\227>\272X\3727\206\366"
+	.ascii	"\340\247o\361\264\b6\372\326\214\276[\234>\335\025\375\274/M"
+	.ascii	"d\215\316\367\331\f\347\255\016}\013\245\317\001}\r\350\0166"
+	.ascii	"\303i\307X2v\315\003[f9t\223\340\311R\345\346K@\337zp\342\277"
+	.ascii	"?\353\301\371\024t\b6\303i\277\3308\273V\201\005s\021B\034;Q"
+	.ascii	"\031\n\312#%\217\235\233?B\337Vp\332?[\301\371$\335\341\315\003"
+	.ascii	"\035\345e\215\254\213\233]nI\301c\345\326\355\267W,\026\333f"
+	.ascii	"\267\366\216\332{o\2601\360n\370\335l\325l\026\273\306\301n\271"
+	.ascii	"\345b\331n>-\367r\357=d\365\214@]\335Ld3\234\327\032\235\377"
+	.ascii	"@\337j\371\205\247\035\342Z\213`o\313\341\264\177\177\226\303"
+	.ascii	"y\267l\206s\003kt\332\264\244[+F\247U\326r\253\355\275\207\204"
+	.ascii	"\256\244X\321rs\221\255\302\001\030\326%\b\021*\025\f-u\334"
+	.string	"\030r\363o\321~;f\311\354\031\226\232\332\332j{/\213\200cq]j7\333\263k\315\354\362\366\314\226]\204\020\007\212\332d{/\355Y\336\373\311Z\f\204\254\305\300\374\262\344\251\312\231\177\365\2276\303\251\255\321\371\337ly\345\260\311PU,:8!\240\301\371\237\f\260\\~lAV\376\030\377\317(\203\340\355)\2162\223\274\344\307A\"\374\347\004\271\310\237\275\364it\271d\343}\273ir\020L\007\347Y<|\207\333\374Y\353\2678\360d X\357\277\231\007\371G\356\361_\277\002\374\346\336\217\221\330\230\377\263\314\345b\274l2T\231\034\002\245\377Za\301\354\210\202\244\016N\023\277\255\363\337,\031\307o\365.\226\214\365\237\202\2039\301\3748\016\3131e$\236\263\303\337\256g\3132nfAp\n\362\325\377\277s\360\233u\026\334\020:d\2209\260\302\024\310\034\270\031\3701\212\\\225U\374\346C\006"
+	.string	"\032\022^z\220\302\354*\374'\217\377l7\016\366\222\2510\226|\343?\030\\\225\231(P\362\t~\323\213\b\327\353\307Jy\352\277\013\3701\004\262\rlt6\001\374\367\254\006F#A\343\307\304|BF!;@\352\317\017\300vyF\226\361[&\370MF\361_*1~\013#O\300\016\341\275\034u\201\214\201\254\001\234\317\313\006*\004\377=\b\346\247\253\344/\376S\312oS\374\326\002\277E\177{\201\337\2566\004\030'\340\317N?N!\357<\202\337\006\371m\221\337n\375\230(\213"
+	.ascii	"\227\270#\\\022\236\342\035\234\355\036\374\247\323s\b~<\345"
+	.ascii	"\277L2\b~{\301\237?\360_0\331\003o\273\333u\353\340G7\263\340"
+	.ascii	"7\201\374\031\377\227\f\006\326\300\315\354A\377\271\200\037"
+	.ascii	"\227y\221]\264\3701]"
+	.string	"n\302A~\177F\346\t\326\337~i\310\311\260\377f\327\340?9\374\270'\373\334\020\376\254\376\370"
+	.string	"\271\003\027\372\317\242\353w0\270\352?\005\327\2779\347\307\023\234M?.c\372\261\225?#\177\274\374\377\227\217v@\277\271\366_.\306\337\346\371\355\035\363\277\377\357\006\231\351\377\321\177;x\321\177v\340\277\303\377\252\370\361\376\217\177 \3761\221\037\037\371\261\221\037{\375\270\353\307E~\234\344\307\025\310\034\370\261\325\217\271~\274\365c\247?\247\377\207~\240\005\376\274\364g\025\177\336\300\2375\360g\f\374\371\002\177\256\300\237'\360\347\024\177^\341\317\017\370\263\n\177F\341\317'\374\271\304\237\021\360g\003\374\231"
+	.ascii	"\177\026\361g\022\376,\302\237C\3703\322\237\001\360\347\017"
+	.ascii	"\177\366\360\347\016\376\234\301\237;\374\331\202?S\360\347\243"
+	.ascii	"?k\3703\320\237}\376\254\377|\3769\377\371?\316\363\343;?\366"
+	.ascii	"\373q\337\217\371~\234\367c\274\037\277\371q\233\037\253\371"
+	.ascii	"\361\231\037\317\375X\314\217\345~\034\367c\270\037\253\375\330"
+	.ascii	"\312\217\253\374\030\355\307e?\036\373q\330\217\241\374\330\311"
+	.ascii	"\217\225?\376\372\261\222\037;\375\030\371c\343\217;\3701\213"
+	.ascii	"\037/\375\230\370c\025?\016\376\030\003?\276\300\217+\360\343"
+	.ascii	"\024?^\341\307*\374\270\001?>\341\307%~\254\200\037\233\360\343"
+	.ascii	"\f~\f\364c\004\374X\377\267\316\217\t\360c\021?N\3721\322\217"
+	.ascii	"A\370\361\007?\366\340\307\032\374\370\202\037O\360c\016?\336"
+	.ascii	"\360c\243\037\027\3758\350\307=?6\177\214\177l\377\233\347\277"
+	.ascii	"~\377\345\373/\235\377\312\371o\234\377\302\371\257\233\377\336"
+	.ascii	"\375\327\356\277g\376k\346\277e\376;\346\277r\377\205\373\357"
+	.ascii	"\333\177\335\376\313\366\377\001\377\035\341\177\212\377\372"
+	.ascii	"\374\267\311\177\263\374\027\313oG\360\337\354\177\231\377Z\371"
+	.ascii	"/\225\377\236\375\227\354\277R\376\033\345\277P\376\373\344\277"
+	.ascii	"`\377\377\376\313\344\277J\376\263\375\027\311\177E\360_\364"
+	.ascii	"\277\032\370/\n\377\035\361_\022\376\233\370o\322\177;\370/\007"
+	.ascii	"\377\005\376\326\357\267{\277\355\362\037\305o\233\374\326\310"
+	.ascii	"oy\374\026\004\277u\372\355\376m\b~\353\301\377.\377\335\376"
+	.ascii	"S\371\217\366\177\371?\312\3771\377\217\376\376\376\376\376 "
+	.ascii	"\265\237\002\016\374\020\300\020\372?s\254\2359\316\035cM\302"
+	.ascii	"\224\371\316M\255\316\315\247\0164J/gn~\006;\3643\200\302\201"
+	.ascii	"\303\266\231`d?9m0\346%\013\004\375\205\347\245\313\315\307@"
+	.ascii	"O\377g\325\332Yu^\r\255\t\001\303\262d\370vT\335|Zq\360i[\313"
+	.ascii	"\272\272\371\030\220\321\307\300"
+	.string	"\313i\343\274q\3328\247\316)\242\r\265\306O\271\263\262<\f\245\271-\231s\3631\330\242\217\201\3319\343\244q\3168\245N);N.\220;y\264\334|\f\302\36418\242\3773\306\031\303\316\351\030Q{\353\310\017\013SH\264\250`a\322\001O\377'\324\te\345L\310\332r\322\3530fr\361\265 \345\346w\250;\267\337\351d\317\362\316\332Ns:\204q\242\346\255\257C\031\375\016_\364o\336\271]3\357\230yL\310\332\332X\006\b\273\372\212\373)\022\004\t\215\233M<@O\\SKn~\207+\372\035\300\372L\277>\223\355\334\333.\267\252\254v\226\225\207:uL6\355\264\267\323rW\035}\251\313\362 \344\345\213\b\326\315\357\020D\277C\f\375\233|k&\337\335&\250m=amp\326\244\213\354\307\fN\024\331\315\277`\216\236I\347n\273\261\266\245\221\006\n\220\274m\265\004\341\027\214\321\277"
+	.ascii	"M\216\034\223\315\013\324\005_q\342\340\235\237\250l,\237\030"
+	.ascii	"^Z\350\3631;\003\303\345\346_`D\377&\034\273f\302\271x4\224\324"
+	.ascii	"\326S\027\tR\232|\305\351\030gUfn\376\005:\334\270\211Q\327B"
+	.ascii	"\037P\035\264:w7\337\002\2755k\314\273\023\355\275\241\366\326"
+	.ascii	"\002r\002\361b\262\271y'D\366%\257\316\315\3373\227\374\357\t"
+	.ascii	"~A\322w\363-(SWg\332\205\320\245\212O\337\025\335\234\233\323"
+	.ascii	"\3303\314\027\247u"
+	.string	"\247\355\314\231\256\263\b\224R\212\0223fl\020\034j\336\304\266\225\034\b?^s\246\346n\276\005e\3128\351A\242\303\215\362\346Wp\247o\206\261\346\030\273f\216\261s\036\366\223\323\007A\252\230Y9\214H\271\371\025\300\351[;w\376f\334\355\232\031g\312Y'+\273\267\026;$y{g\201\320\263$\n\215\277\233M0f\013h\272D\271\371\025d\321\257@\212\376M\2705\023\316\272\345'*\333i\204<4?\304\366\316\002\001\310I\006\036\0377\277\0020\375\233ooV.;Q\331U>3\234\264\201\353\333[\016\004\234\303\rM\355\346W C\337\236Y\323\355\027!\204]3\335\354\231]\356\252\fA\240\324\274\365m+9\020~Z\350Q\246\314\315\247\240\215\276\271fn\271\311e\315\344b\262\331\275\367\316\332NrB8\251S\363\326\267\263\254<\374\337\263k&\333\361\200(0\321<\371\322r\363)"
+	.ascii	"\323\277\335OV{o,s\271\255\240\200\316\337\336\232\326z\370\203"
+	.ascii	",\266\031\374\317\373Eq\271g\\\031\262\367\266t\264\223\266'"
+	.ascii	"\037\035\366\377\337\244\333;\212\313\311\004\256+\2514\256\253"
+	.ascii	"\"\251(\256\035Ri\\WERi\\\333)\352\313\251\310js9I\245\355]\264"
+	.ascii	"\367\336;*\312\251\304\326"
+	.string	"\225T\332\323.\222J\333W;\006\232+\273\227\\N;jk\027\355\250\375\264\323\266\256:HEq]I\245=]\025I\245q]\3554\256M\264\243\236\254hDm\253\242\235\306%g\247m]\021I\245m]I\245q\365\331#6\320\320\331ae\b\023\032\266\213T\324\246\272\361\343\311\212\210Nj\271\265\331\354m\325dl\253M\267w\006{\377\330\262b\363\264\303\272A\321QAmy\332\262\313\2757\207\033P][;\212\316\311n:\251'[{?\201Z\3327\366\336\233\004\247%\335>b\351\234\206\374\330S2\366\226`/\367\276\261\267\223\335t{o\247\2757\320\352\307r\357\036DR\312\0337\366\316:\272\261\1778u\221\261\367Uk\343v%\225\326\265\225\324\345J\232r\317X:Y\251\251\255\255\334l\270\254t\232\023\332\236\332{\3339Zy\205C\357f3\313\221\321\235\261\260\233O\201\2236\261"
+	.string	"\355\274\321\250C\307\264\342B\017\211\230\27344\223\312\345\242\303N\254\013\232\231y\006t#\f\026\2733\2631\223\354\356\260\001\206\0056&fJ\321uu\274\306\334\374\t\200\210\231af\024;\25057/\261\034\230%S7\377\346\223\3335\363\211\tf\202\332\326\306!\302\211\223\037_\337\336Y "
+	.ascii	"\311\274\331in\376\004O\3727\235\230`YB\314\244\334l6\351@\026"
+	.ascii	"\262\277\233/\301\233/\223I\317V\217*O7_\2024_\246\022\240'\035"
+	.ascii	"lgn\276\004c\364o&1\275z\312\236\366\324\334|k&\006\034\032w"
+	.ascii	"3\334@\305\301AFi\n1\207\230@\314\"f\017\023\211\371\3034b\006"
+	.ascii	"1\217\230\\\246\226\331e\3720\211\230<\314-\273fz\231:n\3560"
+	.ascii	"\263\236\311\234\222.\324\334]\r\363\206\245S+\361\306&o\373"
+	.ascii	"\345\020\243\224jCfz\231T\346\225\245S+\301g&\017\357\251O\306"
+	.ascii	"\033%V\031\345\336K\323\313\214\3023\275L\026l8q\242'\266\367"
+	.ascii	"\376qS#\214\205\r\262\245\263\031N\n\254\321y\t\212\350K"
+	.ascii	"\240C_\202(}\016s\3649\320\231VY\216\331\227\215\233\317A\213"
+	.ascii	"Y\005fN\371\340\201z\313\272\371\034\210\23068\370\320\347 C"
+	.ascii	"\377\bO\377\b\214\376\021\025\375\243/\375\243+\375\r}\372\033"
+	.ascii	"\320\350o`\323\3370\345/\017\220\022\034p\324\344\301s\241\330"
+	.ascii	"\201r\343\346;[\370\302\202\334\374\rD\364-\2357eu\262\034-~"
+	.ascii	"\231/\267\220\373\362^\266\223\351d\275<\307\256\345:9/\327\311"
+	.ascii	"w\271\215\020\336"
+	.string	"\373\351L\311FM\271&\213\322\215\031\034\262\021\342LQ\206\250\223\361\326\200\371a\211\355\275\004\262\371\222E\rC\276\006=}\rs\372\032\342\3645\254\351k\250\242\257aL_\003\230\376\361\220\3476\267r*\023\036Wn\276\006%\372\032\270\3645\354\320\177V\223\355\312\234\335!\2719M\256\263k\331.\243\261\313tjy{/\355\362\031;\207E/\316\235>\240?02,g~\206:\375\fY\364301S\246\207\016;Un\276]\263\366FL\236\313d\362\030\273\226\313\3440\367.\227\311[\334\3442\231K\226\303K7\007Ti\223\227\224\313d-eom\342\204\216\334I2\345\223\237!\206\006c\367\2224\311s\3631\320\321\037\241\315\312\226\f\227\273\3447/\266/\331K\216\263k\031.\273\335\f\227\331\302\274\251\2113\255\200\330\315\351\234\337\372tV\324\224\216\233\217a\213>\2061}\fH\3641"
+	.string	"\321\307\300C\037\203\f}#:\372FqY\324\206\206\330\251\n\202%_\261kY-[\261\313\375\020U\302\236\306\370\372\262ZN\263ruoc|r\30016P\220\234\371FK\364\215\272\364\215\252\250\240\375X\031Kb\267\314g\271,\233e2\273\226\321\362\330q\f+\3476\212=\333"
+	.ascii	"\212\2340e_\330\227\024%bK\224{/3Z\236\022\242I\230Rl\357\345"
+	.ascii	"\021PK\2245B\200\362/\334\321\2770G\377\202\032\375\013p\372"
+	.ascii	"\027\316\364/ \321\177\206\362\344\234\021$\315L~\362[\273\354"
+	.ascii	"\344mwk\357-{\357\r\232\306\036\036\277\233\355\266\031\316?"
+	.ascii	"\203e&vvJ\271\233o\331\220\264\345e&9\t[^\376\312Kr\223\254\264"
+	.ascii	"k\231IVb$\f\235\314$\037I\362\004\366\244o\357\345\211\246\006"
+	.ascii	"\334\024\237\374\242:\372Er\364\213\332\350\027\221\321/\352"
+	.ascii	"\242\377\\\304\306^\232,bn\3763\221<$HH\220-6hd\033x\351\246"
+	.ascii	"\331\272nxe\256\334\225\267\262\020\273\226\207d \317Z9HR\036"
+	.ascii	"\222{t\r\311S\231\007^\272=\240n*/\017\311?h\344\r\311>p\032"
+	.ascii	"K\247\266\237\260Bh\"\304\217\257\017HM\235\252;\240l\267l\206"
+	.ascii	"\023\2035:_4\246_\244\324/\"\242_\304Cgq8\277\354\374\276\334"
+	.ascii	"\374\"(\355#\263`\351\214\344<ly;r\016\273\226u\344\033Y\207"
+	.ascii	"\220\271\367\023\027\345O\220!W4\316\214\003\367\205q[\273\371"
+	.ascii	"Dwj?\262\344\253\214\225\253\354Z\266\312T\331\nXD\217H\224>"
+	.ascii	"\223/\257\216\034\235O\304D\237\210\207>\321\225\256\301\001"
+	.ascii	"h\214\032-\373\346\017\341\321\037j\243\377,\225g|\301#\367v"
+	.ascii	"\363\377,#\307\260kyF\216\362\221\235,\235\221\022~w\362\366"
+	.ascii	"\336y\006\356\312PB\346\336\\v\224{o\016\037>\370\350!\351q\346"
+	.ascii	"\017\305\351\fe\333\354\326\206\037\034tw<n\026!\351\371\351"
+	.ascii	"\024\203\023R\347\346\274\217\202\212lA\tr\363\207\314\362\304"
+	.ascii	"\371\303x\354\032\316\203\357\334\345\336iy\260\226m\263tFv\276"
+	.ascii	"q\306\217O\f\327I+\223w\346\017\315\320?\266\203\353L\361\361"
+	.ascii	"V\343\346\217P\007\267p\200\253.?\273\206\353\340\276\213\020"
+	.ascii	"\342v\2717\331\220\336\017:8r\276\220\035}\241;\375c>\274\006"
+	.ascii	"\233ab\206V\246\216\322\f\235\225\023\302{k\341)\311\310\b\341"
+	.ascii	"#\353\223\313\223\347F\214\001\246\334\311\263\003\363\227\367"
+	.ascii	"\205F^\030/M\370\310\372\326\34038\315\317\215.|d}q\373\311I"
+	.ascii	"D\023'>\262\2760s@&N|d}kp\030;g\351\214\230@\206g\214=\213\323"
+	.ascii	"\204\217L\314\f\206#\207\217L\f\017\253\301q\360\033\234\207"
+	.ascii	"\365p\033,\007\337\3419x\017\273\301l0\035\f\307\256\3415\330"
+	.ascii	"\316\332\3415\030N\b\037Y\237\217\0359u\262:\344\013\241\341"
+	.ascii	":[\307\347G\343\346\013\201a4BE\364\205d\350\007\361\351\007"
+	.ascii	"\301\321\017\022\243\037\224E?h\212~\320\227~\020\017\375\240"
+	.ascii	"\255\017\344F\037\350M\037H\212>P\227>\020\326[[\326\"\206\356"
+	.ascii	"\310\315\037\001\n\224\2240&l\230\013\356\202\267`7\274f\327"
+	.ascii	"p\033V;\316\202\265X\2736\354d,\317\356\311\2246\034E,o\357%"
+	.ascii	"n\303R0\026\214f\325\200\272\257,\347\267\307\204\262]\332\f"
+	.ascii	"\347\2215:\017\264\365\225!X\013Un\376\217\236N\302i\030\rI\236"
+	.ascii	"\025L\005W\261k8\r/\217\305\354\335\363\0316\023\212\"\332Q]"
+	.ascii	"F\2248\rO\301fBQ\313}\025\342\312\314O\314gI\220 kt\376O\030"
+	.ascii	"\375\2375\375\037,\032\217a2\273\366/\270\354\b\030\247#7\377"
+	.ascii	"\347L\277\330{o\373/'\360_\316\377\214\351\377\204i kt\376\007"
+	.ascii	"\211\376\217\226\376\317\225\376\317\224\376O\f\260\257)h\246"
+	.ascii	"\200\335\374\020I\332\220\310\341/\254D\312\2310e\037"
+	.string	"V\342&\230\211]\303_x\311\207\017\037\216~\302z\2009\351|\2370\372>U\364}\224\372>ZG\212\374hQ\316a\273\331\007\026\"\364D\264\367W[\236\021L\304\256\341\"#\024\t=Q\346]\036=+]\226nv\250\262\334,tFQ2\243K\217\323\251\005\215\226\034\272\236\335\226\275\232\260\215\375\235W\037\372\210P\311c\347\316\0351\354\254i<\30019S\370\224\334\274\374q\323\312\302\202\035S\256\004\231\265-~:\312\347J\230\0335]g\256O\214\035\215%\231\233\026\236Z\320:\200\310\250\360i\361\235\001\222\311\261\004\323{\372\207\222\035p\202\3209w\310X\222\306\313\315K\262\275\227C@UUI\266\364N\263\037\034TtB\344\234x\n\320\233\362\312\003\242\r\261\331\362\232\272\371vM\307a\313\302\303H\327\315\372\215\206s\215w\215w5\036\376\373;\313\322`\321nN9-pv\252\332"
+	.ascii	"\235\224\240a\303us\2324\232\r\220\037\345\024\022--2j\326h\273"
+	.ascii	"k6z\215V\335\027\331\315Z\315\020\230\275 n7_D\024\375=\363\312"
+	.ascii	"\377\236\r\177If\334|\021^\032\215Fc\262\361\221\3459\272\026"
+	.ascii	"\372n\276\210\036tt\346\035\2275c\244\200\271\371\002\330\233"
+	.ascii	"\2333\357\216\306X\241\371\321\247e\306\313\223\233/\2006d\310"
+	.ascii	"\310Q\341i\365\001\201\301y\361q\363\005\360E\214\030#J:T\232"
+	.ascii	"4\271\371\002(\223\223;\337\250\360\264\206\200\340x\263r\363"
+	.ascii	"\005p$.\316NJ\231\331\316\244\374\270\371\002\300z{\323p]\256"
+	.ascii	"\272\310\356\024\224\335\030/\327pA2\266\24451\253\240\031\351"
+	.ascii	"Jr\363K\270\243\335\264\333\211\007v\003\rY\237\020\0267?\276"
+	.ascii	"n~\to\330\330\356P\021\311\272b'.\312\315/aNk\321Z\364\226\253"
+	.ascii	"0\245\230\220\022+Y\356\254]o)ck3u\363\367\200{Th8\311s\363K"
+	.ascii	"\270\242\246\006\234r\003\r\231\030n\013\2033s\363Khr\345\212"
+	.ascii	"\311\306E\211\341\372b\220\271"
+	.ascii	"\371%\364X.u\332\321\226\023\037P\213*\016\235>\215U\266\261"
+	.ascii	"\252\\\247Q\331\201b\345\346\357i*\377{\206\276\234\325Q\321"
+	.ascii	"hhR\242\250\335\254\321r\236\217Y\022&Mn~\b;3\263\023\357h\313"
+	.ascii	"i\357\024C\205\2475\206\252\255\313\315\017\021\205\214\214\003"
+	.ascii	"\037U\024\263>\247\274\235\365c\312\024-f\211\226Pue\224-\304"
+	.ascii	"!\311q\363C\330\320Qt\024-6V\327\006\016\330\006Dy#\354Z\314"
+	.ascii	"\316]$_\332\350\314\245\033.\033hn>\tu\364\023\375\304ds\342"
+	.ascii	"DO\354\354\362\203\213\2042\032L\203\231luN\364\312\242\300l"
+	.ascii	"\271\371$dQ*M60\252:\2613;uZ7\237\204\034\372K\177\231lh|dbp"
+	.ascii	"c\302\260n>\tNJ\224 \265\0311x\2267\177\204<$HX\2402\203\363"
+	.ascii	"A\233\262\373\272\371#X1b\304d\323\243\232b\325\227\321\312\234"
+	.ascii	"\3317\177\004\261!C4\221\243-'9\0334\221\003\206%\324&%\255\315"
+	.ascii	"\353\232\210mS\252\301!d\204\035\\\\\023\240\232b%\006\374\242"
+	.ascii	"%F\232\233/B\034\275\245\267L6:TQ\314\202\300\260\371\253\373"
+	.ascii	"\322\3222\357\216\2660\034,\260'bx\f\232;an\276\bAt\017\335C"
+	.ascii	"\3778\202r\305Gv\235\260\221\003F\373\270\376\221\217\274\311"
+	.ascii	"\341\306\236\325\300\362\242u\363E\250\241\263t\026\024!|d}]"
+	.ascii	"\274\b\321\272\371Ij\250\256Y\240\322:\214\336\034m\250\250\255"
+	.ascii	"\365\003\330\204\352\213\254oK\375\360`\312\261`\247\245s\\\353"
+	.ascii	"\370\027\037^WQ\032\353\032\307\337\003\\c7\206\312\315O\272"
+	.ascii	"\242\265\325\365\325\337c\372\300\341\346\311\315OB\323\277\256"
+	.ascii	"\372{\200\214\220\231\323\273\371Ic\372IazJO\235XTD\262\206\264"
+	.ascii	"d\271BeH\215\032&\333\321\026\216\363\004\366$(\212\026\220\345"
+	.ascii	"\315O\312\241\245\264\224\311\206\366\025\3277\266\346F\333\315"
+	.ascii	"Or\3222\264\f \332\035\252\"YAf\260\332\256n~\bd\364\223~\322"
+	.ascii	"Q~TD\262\304n\2179sH4\324u\224O\036\031r\326\312\376\367\204"
+	.ascii	"\320&\311W\231\336z3Q"
+	.string	"\356\235\345\341D\002\265\354\272\371!(\311\223\307d;\216\332ZK\224P\334P\241\273\371!\364\270s\307d\313\273\361\247wEo\214\221\233\017\342\316\317/\t\252\r\034VR\267\301\334|\020r}}d8\211\216\266\272\233\017\"LO\017\310w\264\345\244\347\241\314)L\331\02377u\204\017\270\347C\271e\354f \235\2775ug7\037\004\021=\007\004U^^]\033\270>3\nV\027+w\360\360,\240D\363C\254\016\224\033r7\037\211\315\2337\030\312\232\204)\373,\232\2218l7\037\251\013\0336\3006\266mN\0338\237,2ll\356\016lc\377\316X!3\345\177\017\220\023\256\030sn>RY]\035P\215_.\342W\326\006\250\006hW\207\307\026\036`\032\242\027\026\270\233\217\364D\037i\t\035\035\360\314\321\226\223\236\210&8\332\300\341\251\034pO\316\230S\200xsf\304\334|\244\035d\310"
+	.string	"\347\316\336\306\370n\225\324\2215e\354\032pn\354m\271\343\346\357Y\271.\2767m7\037\211J\214\230\023\357H\3572/\251\274\275\263<\f\241\251\343bGN\316d\213"
+	.string	"V\2338\240\037s{\356\346\007 N\334\343L6KeW%@o\214\017h\207\f4\255:-Z\200p\226\312\256:*\223\323EV\365\367G\345\345@8\017\222\320\245\271\031\310\006|\373\337\003\264\203#f\313[\02769\250\276n\006\272\035\245"
+	.string	"\247\f\314\315\017@\234\006\266]2b\226\310\315\271\031\270\006\344\362\277G\317\220\002[r\271l\021\232s*\203fy\263$\271\261\025"
+	.string	"5,X\200jG[Nr<\360\335p3\245o\207\023)4\200j\346\222\374&\356\357\316\315\017"
+	.string	"\021+V\254\336\2156?\200]w\312@\275\251Re\204&~|\371l\207\022!Z\316\316\200h\226\312\256:"
+	.string	"T\03381<\205\206\232 \313\003\321\202\366\254\320\231\335\374\275\273\377\367\234sUw\374\250\224\225\235x\226\312\256\n\221\345Ac\261\032\233r\363\001`\004(\005(\0058v\264\345\264\007\374q\003\215\007\241:\"5l"
+	.ascii	"\247"
+	.string	"\03486\004\005E\t\027\345\377\236 18v<\356\204\205\335\255i\354\315\325\303\007\356\206\031_\321\022\272\2605(P\354YvZ\356*\fgB\272\310\222\334\254\244\302\300\300\200Nr\324r_\261\300j\023\327\227\345K\013o7\003\235\200pD\377@%Pi\317L\310:@W\233\274m%\007\202\220\230\037o\356n>\b@\364\017\374\002~\235r\371\211hGy\211q\333VY \364\214\351qE\306\315\377\360\007\204:p\nx\003He\327\200P@%IP\373im\2032/Z\n\335\026\264\233\223,m\360XS\273\371\037\252\200Wl\354\260\200V\024@I\241@f&/\007p\207\2453bB\0242y<\200B,]\026\321\216b{\223\347\005\304\001\264\022r*\332{\310\234\262\b\020\t\360\b\220\bp\b\320\210]\003z\001\263\016\274\001\244\372\021\320\013\310B\231\274\0375{L\350\204r\325\341P"
+	.string	"%\205\202Y\233<\240\020`\017\340\026\005PR\373\211k"
+	.string	"q7\242L\351\003r\001\273\354\032P\310\217\226{\253q\b\262s\327gv\346\037\270\005\f\342V\303\307\214\233\201Z6m\214\215!7\377\003\232\376\201?\354\032\020\b\030\236\257\233\201>\016\207\206S\r\0337\177\357_\376\367\344\034]\306\312\334\374\017f\372\037\304\364?$\321@\035\332.\017\310\334\315\377\340\245\377A\210\376\207\037\372\037X\320\377P\245\177\340\025\320\312L\023Cg\316\252\256\314\024\324\315\377`C\337\245\315pz\260F'\220\006\320\306\320\0247\"k7\037X\343\177\317\003\220\230Y\2739\003\245\356\030&\312\0337\0378C\210\315W\026\264\233\017\224\361\277\307\\\373\243\303\343f`\f-\343\003<\036\370"
+	.ascii	"a\013\342\003\030u`\214\377\234s\227\036\370\303\323\302\315"
+	.ascii	"X,\351\300\250\237\271\270\274\263\233\377\301\030}+\305\236"
+	.ascii	"z\007n=\240\223\207\254'\026<\224\315\371\001B\256\321\346i\310"
+	.ascii	"\321\220\027e\020\253\233\317;g\236\363\357\357\351\3612U\367"
+	.ascii	"\343\346\177\340E\377\304\363\277\307\307\b\232%Pn\276\366_\316"
+	.ascii	"\323\357\247\235\277\007Hf\025\225\345\346\177\300\246\177\366"
+	.ascii	"\235u\376\036\214\207\214\027\0327\377\203+\372g\013\377{F\340"
+	.ascii	"F\210\224\233O>-\343\2030\017z\332P\201\223\204\316O\276\377"
+	.ascii	"\334\263kp\215)\037Yqn\026\262F\3479'\351'\235\313Dm\314\230"
+	.ascii	"\233\203\250\362\362\354\331\321v\222\023\302\330\234\017\366"
+	.ascii	"\t\347\204s\342\365\354\235{^\31656\264\376\360\316z\2328\351"
+	.ascii	"\232\272\371\036\342\264is\272\271\265z\342q\206\271\343\004"
+	.ascii	"\311\327\367~\272\261r?wWbe7\337C\030\375\237jn\327N5'\233\034"
+	.ascii	"Ee;\t\265yq\242\327\327\344L\236\233\233\3175(\374\316\312\334"
+	.ascii	"|\017X\364=(\365\177\2469\323\344<&dQ\331XCI\236\374\260N20U"
+	.ascii	"\240n\276\007\035g\320\3303[\326\345AJ\337\203>\375\237sg\231"
+	.ascii	"\323\214\036\006eN<\260\323\367\300M\223!c\336\351]\006u\346"
+	.ascii	"\300\242&\353\346{pE\214\030\271);oB<\236<!\273\371\036"
+	.string	"\304\305\235r:\306\336\\@D\224\341/[x\2109\301\364\210-\301Q\344\346{@\245\337\001\336\333\333\t\227\200\2476q\246S\032\"Y7\237^~\234\320\274\344n~\007t\372\035pac;\335L\310\332zz\022\021\0066\306\007\224\027\367c\313\331v\3643F\315\020$7\277\2033\375\016\224\234[\316-\346]\220\272\016X\320\377\251v\273v\252\235ZL\310\332\3328"
+	.string	"\020&$LyE\207Dyf\t\352\023\242\005w\363;p\322\347\340\356\312\225.\223\210\227\02357\237\2033iiv\316\004#[OO\033@\301q\241LISr\3639\350\242\377\223\212];\251\344'&\250m=5\021\001\305)L\211Gc\315\222\233\317\001\026}.\317\245\311\2467\207\2609vf\324\001r\3639\220BFv\232\t%\241\002\366d\250\316\206\331\220\233\317\262&lw\256n>\007F\3649\300\2322\305d\223"
+	.string	"\216\354cm\352\311\315\337 \217v\342\344\024\323\373\254J\221$|f\302~\212\r\315\340\263b\273\371{g\224\377=\366\311\nU\336\031\345\204\242\002\2260sj"
+	.ascii	"M\271A\343w\363\223\034\265\334\0340\024\034dd\334"
+	.string	"\374\r\304(\233\3303\273el\030[P\330\344Q\321\337\300\210\376\317%\277\b!\316\"\347\227\225\353P\006\207\2327\261\rr\350o\260\223$1\265\204P\206\326E&D&\205F\356\346k\020\347\310\021S\315\004\265\255\215EB\2233|dY\262\354(s\3635(\343u\026\3612\357\210\0201\357\3161uj\336\304\266l\251\222v\3635\340\242\257A\224S\310\331u\n9\271N.\016A\354\234#\177m7_\203*\375\f\316\350\377\004r\273v\0029\203x(;c\346\247\177\370qi\341\346S\253\355\256\256\354\346g\320\246\237\201\232>\b\366\364\341\343_P\330OW!\2249\331 <\003&\372?y\234<\356Fa?amP\006\225\001\221@@k\020eJ\327\037\224)M\301\")L\261\242JD'\030G\2748\261A\n(P\234\360I\246\200A\311\230\252\30755\036Ml0BW\006\250GU]"
+	.string	"1Ej\310\200\216H\246C\350\320\210\026S\024A\311\rI\224x4\201!\251\341KH\302\344jD\231\326d\023\007\210#0|\t\t]!L\026S\341\n\"\343\210\344jL\217H\030B\np0\242D\304\"\"\252\n\227P\240I!ZD\325\tX\f\321\245 2\311\004\002\231dJ\256\352q\005t\025\016\217\305\342\b\024\310$\223\006\025E2\241)\210B\364\304Q\205\241d\224$\372\022\022\261xDa-\002%\323\027#\\\b-"
+	.ascii	"\324\341KHCU\003\221R\332Bh\004A<\232 \026\217(\020\215#P\246"
+	.ascii	"#\n\352\361\204$\222\001\035\224\214\251\321\330tBMOH\246\032"
+	.ascii	"|\t)\251dL\3255\t\002%6\025\207\306\024\204\232l\002\261\301"
+	.ascii	"\305Q]Z\217F\340\n!Z\314k\322x\034\232\311\025+p\022\211\242"
+	.ascii	"\n\240\300\205\245djLO\020\202\261\"]\217\017 \032G\264\020&"
+	.ascii	"\215\276\204\204\252M\253\020]\001\374\022\022\210c\252\342$"
+	.ascii	"*\372\022\222z\\\205\303\224hL\223 \216\351RRX<\201\210\252\240"
+	.ascii	"dL\215\252\320\305\0201\231\022\255F4\211\252+\020\215\311\264"
+	.ascii	"\003\032$*6\r\213\302\341\206\242\242\320\250\224\242P2\246-"
+	.ascii	"Rt\210\236H\246\360B5R\217'$Y\f\3235\231j06\031\255\301\244\211"
+	.ascii	"dZ,\246L\247R\006\264\250B\230\342E\312\244\225\214iR\002*\372"
+	.ascii	"\"5\221L/$\217-T\024\305\232\252.~Vd\320\227\220P\246t=\252\303"
+	.ascii	"\224\351\374\022\222P\205P\001\311\224\203\361\230&S\f\200\350"
+	.ascii	"\212\026\221LG\022\306\343Q\205\301\200d:TA\fW,`\002)\244 1\""
+	.ascii	"\270\200\022\0200\021$q\"\210\"\205\242/!\251\220\"\005\024 "
+	.ascii	"X\f\217E\022\250z$1$\244\200\021\032D\207j\323\021\305\332\204"
+	.ascii	"4\246A.\320\007\bWa\211\n\234H\246?0\220G\022\025\254_BB6\035"
+	.ascii	"U\245\240P\025\"A\f\215M'\374\030W\\3\031TB\002\255A\243\022"
+	.ascii	"\3224*!1\352\2014\231\223IT%\022\205@\030\310\3430\253+\022?"
+	.ascii	"\b\206\272&S%\364D\020\003\"\n$\242\311\246\234\004^\270\n\211"
+	.ascii	"A%$\222P\020]\205E$\023\232bE\223\350\t%\244\207d\320\211dJd"
+	.ascii	"tq,\221\314\260j \301!h\004$#\004\0240t\201\004$b2\005\224xd"
+	.ascii	"RS!\206\027'z\276\204\224\026\207 \206+P\342\321DZ\034\002\327"
+	.ascii	"\013\326\013\353\205\r\353\006&\340\020\321(db:\222\030\252="
+	.ascii	"\304\342\021\005%\241\211\2405\203\221p-\242%Z\bQ\020\215#`\024"
+	.ascii	"\221H\241\006\033D@J\242*\232P\24406\251\034.$!\031]\034\211"
+	.ascii	"\253\261\351H\202\230\"1\020\025\r\031S\241\t\026I\341\252\241"
+	.ascii	"\203\025X\f\323\"\321"
+	.string	"(\\\n\300z\032\217I!z\2028bM\n\213G\353\b\275\032\021\213G\024P\342\321\004\212\252'\020\205\350\022\321\032L\252h\261i\001\031V\241\036\001C]\203\316\240/!\251h\261\211\210.\r\223D\341Q\005TI\250\242-\204G\253pM\372\230!\220^\234 \n\227\200\253\321\205\020\220VU\210DB\301\001eJW\344\361\250\0021]aE\225T\341Z\264!\004$\224)M\221l:\246-P\025\311A\002\352q=\232\270`\256\260\032QUm\032\026}\tI\251I\005J\004A,\246M*8\240\304\243\211\036\025-\262H\nS\250hJbP2&\323 \246\243\272\302\002\026p\\\321\026B\024\031\240\306c\t\265))DMp@\301\b%\343\020\303:$\\\205%\206j\020eJWc\223\nb\270\342\207\2102\251#\206\303\021\023|hL\001]\205Dd\223\005\037\246*jD\225\364I(!"
+	.ascii	"%\210x\001\274\b\002\204@\200\020\316\213 @R\022\001JH\322/!"
+	.ascii	"\t\257+1\005\026Ia\212\025C\0374\210\256\302\025EZLU\bW\024\304"
+	.ascii	"\024\271\201x4Q\204\006\221(\252\002\b\r&\225\204\305\023\320"
+	.ascii	"\242\na2-\201\001\205\004+\032$\246\360\342\250\002\270\006\223"
+	.ascii	"\022@\231\322U\177\t\t\203\"!\221\222\361\250\302\213\364\204"
+	.ascii	"\343\003\222H\245\"\"\"\272^@\203'\020\325\343\221D\022\311"
+	.string	"\200\f\253\220I=\256\b\242\253\320\230\022\325\343q\210\006\327\324(\201\237556\371\030\217i2\035\242*2)\\\321\"\b\203ER]A46\035Q0\251\302\342\210u=.i\200\241\256(\023ZDS$GL\200\230\"1\240J\302\265xl\021,\026\321apU\217HT5j\"\242D#\272\276@)H\016\325#t\025\252i\362\210\314\220$\202P]_\240A\026\306\264\330B\310d\264~\t\t\031DW\241\nb\270\001\013!\252\252\b\n\221\253\020\272\nO\030\rU\240\bt\025\236\030\252@\021\304\324\204\272\264\002\325\245U'\321U\250\232%RXA]Ja\204A\354\021qD\276X\200\013\241\005\206\252\317\227\216HH\0204\036\323u\210\252\352q\030\\'\bZ\277\204\2646!\327\246c\220\311\005\022DRE[\244*\261C\362l\201\226H\026\233VP\321\325\210\222 BW\341\t&\027+"
+	.ascii	"\265@\211\270\003\250\272\"\230L\n\221.\216\305"
+	.ascii	"\340\205c\013\025M\006\211(\223*46\005Su-ZU\341\212B\311\230"
+	.ascii	"\022U\241\013\365xB\005_B\002\021\204\276H\231z\222.\2040\214"
+	.ascii	"\222$\206\352\005\355B\b\003\210h\024\252 \nQb\021\252\264&\205"
+	.ascii	"+\202\304\342q)\270\026\205\030\210hRE[\240j\320\205\020\006"
+	.ascii	"\206/!]pT\301b(,\252 B\002\321a\332\002%\236k\022]\203\352q="
+	.ascii	"2\005\215\307\240\341P\030$\252\307!\252\372d\030\016\205>\303"
+	.ascii	"\241\260\007U\205.\210\252p)8\034\n"
+	.string	"\201\3265\270\002%r\370\022R\005\311\t\232\202\311a\312$4\302(\221\341\250\242\027\030\016\205\300UEW\224\351x\241i\005J\f\256\033\276\204d<\246\302\f\222\301$S\252\246X\032\256\351\nD\343\210b\361\250\032\021S\344O2\211\016\217*2HL\221E_B:\2520\224@$%8\2520\224\200\320\240zL\032\321\244\220Q)-\n}T\025iQHb5\242Lh\213\243\211\243\nC\251\003\323\321\210\022\203C#\214\344\320\ndQ\243H\030\353\005\"\017,\261\020a\204 \232l\022B\223M\301\343\372\223\224$B\320\003K\030D\b\256+\216\311\34405\036\231T\341\322\221\007\226\202\306\224)C\007\220*Q2(\\\205%\214\307tm*\036Q$\221JE\353\227\220\222H%\020\307\024\303Z\024\342dpxT!\211T\nZ\205E\f4\036\213x\251X\304(\261iM\327\2420\210b\005\006"
+	.ascii	"\021Q\024\211\342\007M\252MG\022Dc\323QU\002B\036\211Ky\025\242"
+	.ascii	"`j2\236_BJ\026\217\352j<\016\203C\225\002\241\020\223*\f\256"
+	.ascii	"I5]\0214\036\203E\3410xTa(eX\032\256\251\213d\260XLY\\`R\205"
+	.ascii	"\311\224\030<\256M\302\"\027B\025\177\t\251\211)=*\026\217j^"
+	.ascii	"\032\256)\322t!\204\201\223hSQ\330\342\374\022\322\220\t]\223"
+	.ascii	"0\222B/P\2421\205!t\025\236@[\244\353PX\244\324\244\002%\372"
+	.ascii	"$\207\351\232LW\341\232\f\262H\n\327!\224)M\201\016\205*\003"
+	.ascii	"\224\214)\223:\302\b\001\025uqDjP\205K\303\254\242\351\212t5"
+	.ascii	"\242\304\024\210\252\360\250b(\031D\213\351\212\243\272\0021"
+	.ascii	"E\002\255_B\"\246H\020\353\222RZ\\qT\302&\203\"\210)\362\\\301"
+	.ascii	"\246`\211)\022\273\020\302\360\361\300Rp\005\262\b\344\201%\241"
+	.ascii	"\025+\216k\3230\2704\\\217\306\013(\022\306\032T\321\265\230"
+	.ascii	"\256\b\026\255Ft\250\242+\254\306\364\270\002\262\211hL)\260"
+	.ascii	"\341\307\205\320\002LM(\210)R(iD\221LG\022\304t\205U\250\242"
+	.ascii	"\205\22115\261\216 \246H\242!\030k\332\"]\323\244\021EQD[\240"
+	.ascii	"E\242u\210\256Xa\204\022\217L\301UE\221/\320\340ZL\327\240\361"
+	.ascii	"\350\201T=.\035\025\327\365\250.\245\320`L\205\fP\217\253PE\231"
+	.ascii	"TtM1\034\323Ux\342\205\260\210\236\270\260.)\245(\005P0\251\350"
+	.ascii	"J4:\341B\b\243hM\231R\025\212\350p8\002]\205\252\020Q\211h\r"
+	.ascii	"\256\306\364\210\\\321\344\021\312\224\256>0\204E\224\370\203"
+	.ascii	"\026\225\214B\f\350*T\203Fh\360\304RR\250\222 \246\310\0130T"
+	.ascii	"\264\305q\210\252\301\245\244P\035\n}\t\351\205\n\342\205j\364"
+	.ascii	"#\022UA\254\307\243\n\342'\031TJW\030\217$^\250"
+	.string	">H!\323P5U\224\230\2668\252\310\340\013\265(LU4Yd<\246\311d\223\212\244\320\013\264\210l*\261\242(\\\362)\036\207\307\365\250\"\207\326\240\b#\020\323\236\325\330t\034\006W\250\301\024\231\f\276P7\240\304TU\321\026\307\2401\355\260\006\201J\302\024\3074\250\324TD\036\025\255h\022U\217k\2230H4\246*\202\2530\031djRW\026(29\001\020Z\024\016\223>\253\212\2660\246\3014\231T\177\206*1e2\215)\223f1D\227\206/\204Lz(I\242(la<\246\253\260xD\252\350jLa\250nH\242\250\252\204\226@\213J\306\021LB\022-\220+.\020\213\307\245$\252.\245@Wa\213t\035\216@\211G\023j*<2\246Mz\210&\233\202/\204L\301\027\352\317\032\024\261\032\323&`\0215\032\205K\303\340\213&a\360\205\220ih\r\226\220\264\032S\340\0070"
+	.string	"\022\035$\360"
+	.ascii	"\006\350!\022\252\036\207\301\341\n\020\303\025 \214\251\220"
+	.ascii	"\t\304PM\202@\332P<\036\025\0204\377\36749\203\354U\345\341)"
+	.ascii	"\231d9\322\345c(I\224\266\033G\216\364,\031k\022\246\\\242D\310"
+	.ascii	"\234<\\\224\364$\321\343\242\263\203\344\324\021\024C\013\024"
+	.ascii	"/$x\t\020l\216\234\336\315\0271\247\377\036#=E\344\210I\261\363"
+	.ascii	"\"\213^\236\020!=^\326\312jg\340\206\n\330\023\257\236!o@\366"
+	.ascii	"\327\220\236\256\025\326\304"
+	.string	"\350\343:\313b\374\331\371\301\225\225\234Xco\274n\276\2106\375\367l\231vZ\322\340\235\005i#\264&C\013\035-3\217\020\017,c\342\200\364\374\270s\306D\251\325\226@\351rs\217\216\353\350\351\361\013A6\310b\301CO\217\036\036=\360\240\275\361\350\311\032\202\304\216\211\211\307G,\316-\254g\007\276\352a2\007\346\346\346\213\240\242\377\236\034\232\215\025\2552<\026L-\246\334\226\0303\034\246\020\033X\270\334\274\304\220\025F\325s\245\211\374hcb\303\352L!o\251\245\nnK\2319,T@5\313f\210\024\0337\330\370(\347\340\231\232:\335\330\352\336\340\331\020\023\322\001\204.G\2154\340\032\034\336\027\032z\213NB\304\210\017)\240\032<\246\rJ\330\214\273u\026<:\03324\\O\230(yl=1\200|;\216\031V\210\245\250$\304\320U\245T\2320\220\206J\220\244\224\203\314\324\230\266"
+	.string	"\223\025"
+	.string	"@h<\034\022\211\346ek\024"
+	.string	"\016\\\330\244hB\036\214Q\226D\f\321\214\314"
+	.string	"\001\001\001\t\240"
+	.string	"JcW\247k\346\202\360\277v\032\324x\233j\340\250\355\251\202\027\037\373.\033-=\303D\360\316\205\367g9\327\005\357Z\206\2446\332\222)l`\312Q%\322w\355\265\301\332\205>\321\213\332`\207\032\220I\3622N3\254\026YCk)\005\200z\307\020\310UT\363\3045\024\032\036'\324-\021\265\244\342\342\312\b\243\354Z\262y7\264\230\2038*#\253\026\230\372\205\326\020\367k9\221D(\260h&}\020HQ-9\304\251Ab\256\030\365\343\366s\220\376\024\273\2450\204[\006\201\027\232\036\324~Y\357Yk3\264\241\204\321yif\376xW\004\317\241\364\0334`\305W\226\312%PT\310\232\031\223D{/ \036\260JV\370\004\353\243Wh"
+	.string	"\215\256\364\376\205\327\250\271\322\215h\210\001\332]R<\be\346\323T\363\317\255\206 \003\f\0170I*2\371x:q\202\251\302a\344\315\326Y\252!\207\344\260\300t(h\244,\352\302\020?wXy\342\262\250I\201iO\374\316\223\201<\213\2025\234\275\240\213\002Z=\017t5\001w_\375\375\205\314\217q\177\203|\226\246V\316{\006\340V\346\033\351\027F\303a\245/\376=\373\310$\026G<\302\317\372\240\353j\331\302\223\376Aq\201\256\226g\305\377\347\034l\373?"
+	.ascii	"[A\276/\3347\371\026\006J@\265\315p\220(@\262!0\3615\030\371"
+	.ascii	"\246\t\202\353<\253\354\374\205\275"
+	.string	"f4\307\221\373@4W\271E.2U\017z\203x\026\223vr?@\252\024\230\033\326&\362&\021\210\327-\023\272B\255Hf\342\210\376a\244\223\345^\306B+sU\260<\301\004\351w\252\264;"
+	.string	"\304\264'\250a\2704(\227\350,\025\005v\242^e\303\275\342i\334\205FL9&+\342\303\237\026\304\371+\035\r\026f%\035\366\322"
+	.string	"\3572)\232\302\306\267v+\344S.\2467\006\357\204\274\220\035-4\346\217Y\315y2\023\273\324D\273\264c\234\314\016\345o\017^w\217\327\266\255\033\367\353\255'~\270=\346\207\3571\352\006B\276\261\351\325+Q%\236K\316\310\030E\315\370\006@\341\342\001\234s\334L\253\330_\371\222/\307j[W\205iJ\355\013\263x15\357t\221\331UE\333\244\275\225t{\020\263GO\240\340\206N\217\306"
+	.string	"\274$P\002\246\270<AG\234*m7\203z\311\346\232\331\204\225\243\254\305\374/\307\236\255\366\204MLV\237jE\304\234\311\277\177R\242\\\016\266\362\251#\251\265\250\212\344\0019\301\362\b\212j\020\033\262\350v\264|\366b\007 \177\327V\345\".ln\303W\310\210=A\374y1\375\3647<\313\322\036\277\004\370\370i/-\302\330\222\216\007y\323\341Ih]\237"
+	.string	"\252\225\371J\224c\320\223\032Z\355f\326\bT\274D\021\230\310\216\245\260\2467\242\021\215\327\300\023!\271;\321\333{\f\207\213\001\303\220\bc\232\257\344\372v\303\2635t| \302Z-\203\267\213g~(\311\2041\314\326\307\203\270\025\274\306A\2549\273\033\303\366\350DJs\220ACLD\037\345Y\343d\342\361\031rGO\260\224\016\347\351\207\267\372\364\t\016\316)7\013\021\236M\"\2433"
+	.ascii	"F\025\276`\211\307\024\3344\017\361y\033\013\267\316\304\006"
+	.ascii	"R\201b7I\002U\263\344\364\203\256\027\252\375\025\334\006v\030"
+	.ascii	"\221Y\370\300\247\303\375\252\231\020A\234\323\324\024:\007?"
+	.ascii	"\364\206t\037\257w\267\"A(|7\270\201\370a\307\235(\330M(\235"
+	.ascii	"\313\201%\345\355\177\f5\245\022\247\0036R\350}Y\225\233\004"
+	.ascii	"\202x\302o\245\021\261\327\314\201\331\201bni\247|M\377k\310"
+	.ascii	"|\322/\275b\001~\r\225\307\317\274\003\301\n`#\2531K\177eZ@1"
+	.ascii	"\022\366\324j\355\337\2308\3173\234i\353\334\276O\365\202\367"
+	.string	"\352Ba[_\354\315V<\222v\205\f_\333\275-\266\315\307\207\n\364\222\261\024\377\367m\326J\252\315\031:\264d\242J)\347f\253l\030\265u\214\fl\321\320sv\256\034\203t\002g\332\255\360H;\236_x\204\346\036\215Qv\307\320\333\n\005\250\351t\265c\261\245~\313^\276\225\2712\220\006\251\274\013\302\206Z1%K\017<\2651\354x\370\253L\"\322\232\037f9\257\226\220!\366\027\3015\032\204\262\310\322\203\007x\347\342\024eR\204Q/y\354\247CdL\236[L-\023\236eXS\273\3414\\\233\234\002HTv\234\\y6\005\327\003*F\233\320\307\026\203/j\345\240\364\327\335\023\333\321\316\316\353\007\240\006y\"\314\334\342\006X\336j\207\006+\332\1778\276\207\t\251\006\231G{\301\203\214\252\247\341r\023A\006\255\241\206\227\350\233NE\301.\017&\224\275\351\363\300T\273\231\334\226\375\331{"
+	.string	"\245\336\277\222\250t\224oB\374\204\030\246{\360?\311!\004[\301x\236#B\037\220\321\225\326]}</\022\252\306\252A\236\273\206\331\202\201g\tk\036\202\226M\026!\370\351~\322\205E\367\300h\342\301\332_!fxq\313f\264\227\365r\177 \001\022"
+	.string	"\366i\004\013/4n\207W\231\025\343M\303\360s&\370\001\327\267\207\020\306\362Q&H\311f\371\300\037C\247i\2175\305\357\r\024\305J}\271\304i(\341[u=&\314\347\343\304\373e\341\373)\201\226\034*\374\005\272KX\007\035\366*\031\300X\\\026mW\242\252\003\300=\222%e\001k\216\371\333\t`j\357\375\300TB\321\363\3633)\3057\345\336\205a\236\367`\007\363\307g^\323\017Oe\"+\262-\215-\021\032\002-\327\262)E\021\026O\275\204\0174y|s=\364M\360\274\357\205\013[\314e\335\210\313|\271\312\243\345\2015\026,\271A"
+	.string	"\211\004\310\230\t\026\021=\037M\276|\236#eQ\355\364\001\214\254z\266Db>\025B1W)\023>\343\331~\244\262\201_5\222:\240\230>\3623\220\347\361\233\341\337\313\330\0161\310\344*\004SI[\\\356fp=\006\266\247}B\251,\t\020\215\017\370b\020^\343\353\n\256\261\317J\277"
+	.string	"0g\022\034"
+	.string	"m\366\035\374D\037x\341\213\212T\321\216Sz\027e\254Tv\347\370<\242\007\225\332\334zz\254D\234)\236\021\366\225eGC\027DAw9\360fq\251T\212\312_\351~\007\305\310\362\236 \367hM\260\371\n\270R\017\261\206^\226$\243"
+	.string	"\372Z\321J|D\n\332\237l\243\023^\267[\037\035\242P\216/\3162\3111A\025B'\220\375v\212\022N)b\205\202\376\b\"<.o\235 \265\270h\001\025\004\220\340\346\327\376ug\bD6^(\004\273\312O\320\bq\030\271:\345\037RN\240\357\335\027\216\226\244\3440`n\256\336I\220\214*\313Wu3\227\242\251\253\337\216\334\234E \225\n\323u\035re?\374\003`i\001\306\210\033xP\314}\025(\246\306\037qL,\262\344\033\334\002"
+	.string	"\360\034>e\025\200\301\210\364v\002\300\370T\2321\353\032\250\323\272\377\213\321.\020\247I\254\344\3526\311\332\247~@\254e\027\301\350\037W\f\205\207#\374\302\277\330L\307o\245\201\006\177\201d\326\3773\266 \225\034\300I\t\273\243\224\242\336\326\265].\322(\310\037\324\341\356b\013&\020X\032\245x3r\212\353\222cbL^\201\371PX\007\367r\253\320\300pn\202\357\327M\025t\r\377\221\365\313\306;6:\241\202\372\"n\3302\234\005\324$\356\267j\305!\272\251"
+	.ascii	"\275\334\274\2772\362R\233^\324\202\332\325\252\022`\256\323"
+	.ascii	"\177\235\213\002\254-\251\332\220\314\002\216D\337\2679\027}"
+	.ascii	">\006P&`lxy(\331\324\020\312\351\323\373\271W\301\310\255[7\324"
+	.ascii	"1\025\242\317>\217\270\324QO\031TW2\204\336\242\361\206T\261"
+	.ascii	"\003t\206\216\036\231yxe\316c\204\360[Gxh\327\342\007\027@\221"
+	.ascii	"W\246\204*\302$-\"w\302n2\260\272\217\322\\K\376\351\335\013"
+	.ascii	"\204\234]\242\211\"\255P\347\304\t\215\\X\020\2461\217\367uK"
+	.ascii	"\026\207\346\235\335\213-\023f\276Xy\2267\265\372\314S\200\304"
+	.ascii	"F/)!5\364\305M\265\337\247hmM\262F{\302\230)gx]:\\\376\251*\270"
+	.ascii	"X\376e\213=\b\"i\177\311\001\325u4\311\263\376\3251\256\211I"
+	.ascii	"j\354\234\004\004\034\017=\310l\t\3400\265:\252\032\217\252/"
+	.ascii	"\223\321\240\274\t\373\270\216\370\004AMcY\034\214B\244\273\265"
+	.ascii	"*\372\337\346\307\306[\340\362\002]}\035\013){\033h\335v\362"
+	.ascii	"\027\250\257q\302\345\3378\321;\021\031\245\212\360\013\242\376"
+	.ascii	"\346Y\f\f1k\266\227T$\321\332\364c\372hr\275\365\241\230\342"
+	.ascii	"A\340\311|Bh\344\341\263\031sT0\245\322]\b\275\031^w\271B9P\324"
+	.ascii	"\222\244\r\367\351r\336\351LR\335A{\020\003<\341;\275\200\034"
+	.ascii	"\345\f\313\004v"
+	.string	""
+	.string	"\327\007c\002a\252\227M\334\035?\202\033\310\227\246\317F\031j\267h\251\225J"
+	.string	"\036\231\npM\212E0e%\203\272\243\b\374\2569\334\365\367\003\232\244w\302j\376\366C\306)\n8\215d\320\223\re\n\213\376\315a\b\321-pA\301\244\217\220\304\216\302t\t\3726\025\207\211\354\273\236\252\216\371\276\031\365\251\314%\231\332\273"
+	.string	"m\300P\205ql\023Y\234\306z\316\"\376\247*\"\270\273T\201\030u\274\031F\212\243\330\233\021\225\230?\345\323\376\311\204\007\311\312V\332\231\024[\n\263"
+	.string	"\356aO:\rt\203\304\257\\\214\375[WF_q\332\274>\302\211j\007gP\336\345\002<W\330\321\215\250\333\325\264\034\320H\037\021O\215-\0051\t\2251HU\004\370~j2\2355.)\336\347\346\357#\254\033\224g/A7\"\237^b\353\276\361\2776\344\0069>\367\n\232\f\257))08q,\265\345\005[g\304\371W\250\317/\037\236\366Pv\300\3012FE\352\237\322\231.[\003\324\022\3003\034Z\206\007J\306D\342\241\317\323\365\331\227\240\377A\304F\020^*>y:\215\331\257\273w\233ww:sp\251\237c\273\201\363&\344S>\026\024\236=\3403c\035\356\365\252\367\255\026K\017\367+z\305\304\241o\341![\r\006\230F\356\312\022\310\032q"
+	.string	"-\302=Vw\007\005\2775\"w\351\366\232\203\254p\274\353\221M\351\320uG\216R(\3240\260\251;\223\221U\341\276[\345\370TyLcI$\027j\241~;\321\331\310\266\312U\363\001\253\244\372{\\\306F\2235P&Zs\026(\3747\350\343\216\333\336\322\334\3300\345\253\340t\223\325F\303\027\277<a\022[i[+\266\343V\001\002\232\013LW\234\306KF\007\276\332\235\306]\243/\244"
+	.string	"\357M\362#\227a\022\224!\316\317\206\031\215\355\304\327\314\032E\343\033KO\3542H"
+	.string	"A\275\306\206#?\207\323\324/H\206\005;Li#!\234\322\202\257\251\254\200+\034\311\232\310x\235\320\303\242\244Q\025\312^(;I-,\032\275\363\0311\326\r\236\t\340\006j\313\232\275\270\206w\224`\242\352fx@;\353ani\232\265\007\302\303\202\331\371\210\002\336\323\265\241\210.\262\264V\223B\217f\274\020?U\222Z\002\367\032]-\264\361\247^\311\335\216\300\321\360N1\310\037\337>\320\311\025\214\013z\203\247\322H\341\375"
+	.string	"N\367\032\341\350\372\230\310\367\013\365\002\225\227\333*\b\301\"\020\216z\213\247\201\020\253\346.\220,\207\271^.ERs\350\243\200\302B\361\2221\264\3601\027\t\325\377\003\203\203\3123O\277\271\027o\217\265)\004\361voPU\273l\377\262\r\251\254\0341\217"
+	.string	"\277`3\235~HV\224\342N\315\376\211 =\2144\377u\233\301k(\001\200\"\267\370B\226>N~\363\336yT_I\330L\220\211Xg\312.\276\177\324-\250hW"
+	.string	"cDH\213\021\343\342\221, \037~\335\230\303\371\275\211\373;--\255l\315\317\253\222\032\245Vj\3712\352\214\022AObh\271\255\245\371\036f|O\270\211\325\266\263\242`<\2024K\355\375\223\001>\236\331[=F\335L_\022\2637&\017\3572\205\365\200TmB6\035\2642\361}\3344\006\0352\332?z\3644Q"
+	.string	"9\022\320\252]\036\006\301_'\f>H\210F:D\201\316_\225\342\345\005\377\266\360\337p\230\277\326\261Bj\037C\022\376\035\354\220>\277\221\005\366\22754\323q8u2\255\236\004"
+	.string	"(\346k"
+	.ascii	"\305wE\204\350\305e\"B\027{"
+	.string	"\001\367\364W|\007\320\273\r?\306\275\020\334\276j\213l\035\300\252-\371\270\n}\247\215\021\226\304\303\316\007\3403\311B\022#\016\2330\217\232k\033\310\226\320*\360[\317\0242\372\036\0322\230T\007b\222p\021\370\236\244\2221S:0\340\220\266\365\300\255>N<\204)&\331 C\223\311\357!>Y\031\220A\265\362>\020\322\312-:\242>G\331%\006\271h\370\234_o)\272\257\020\324z\220\207\326\256\274\216G\211;\352X\372N,:T\037\373+\b\365\221\360\340Q%\236\330C\235\324-\003\260\230\255\3161\347\244NXN\220\031OX\300\234\2279\235A\214\004\206Y\001e\272\270\332B>%\317Zx\006\306\316\357f\223\254\0200\022r\036\313[D\333\336\\w\370\373OD\305\265\354]DS\3013s\261\220\342\016\206\273\352\026\346\001m\2748\246\r?\305\313|\357}\205\2552i\031\357(\202\245:"
+	.ascii	"\261\337\330\225,4\273\034^R\t'\202\023X\212$|\030\037\375\342"
+	.ascii	"\005'd\207EG\005\313\272on/\311)\341\024\244@Ew14\271\364m/\266"
+	.ascii	"0\215)\267\232O\212`"
+	.string	"\257\307\216{N?\272.J\344c\037\254\213H\360\272\306\306\302\017\377=\376\025&X\227\247\025\037h\r\273$\264\021\271\016@7\013.\233\024\353,p\1777`GW\037\377\253\233\202\320\323\002\306N\256\257\250{$Lh\304\356/\272\240\021\234i\024\004\257\247\300\315W3\377\210\033vFi\355\367=\341o\322\207\3252cW\030\200 \316\215@\363\bL\323e\216Fe\314\214\235h\bY\262Cy9\006=\201r\2339\263\323]\340\363y$E\376\2021\037\317\202\217a\2430a%\264a*\302!9\376\341\021\357\340\345\314\br\2453\200X\252\276\036\003\353JT\352\312ci\007\206:\032P\3503\016\301\027\375\207}\274\363%\216\227}\367\201\330F\333\364\030{\037{\335C\253\276\360\360\354\274\323\034X \177(`z\337\2175\330S\233\236wy52\303\353\b\366\303\335\270g\262\274\347=_\016mz\341"
+	.ascii	"\346\226'\337\201)F"
+	.string	"A\346\005o\212\203j\\\214\354\rW\317\207\373=\202\223\333<\017\373 t\357A\244\373\n\362x\t\216\236:\366\320\340\326\002^\254w\245oO1\\\302\t\277-\3066\177\303\305\270\370\322\261J\271w\331\022\223V\207u\235\253%\260\364\031\367\037\334\337\205\236\243#\272\325\377\337OO8\331`\270\314\332R\250=\340\252\353\232+\261~\311\304\215H?\305\221k\211%\336x3PF\351.(\246\027\0071\f\277\241\204\235\272gd\f\361>EO~Q\365-\244\360g'\375\263@\016\363\370\200\377\346\376\247\226\377\326\270\221\343\313\\\307\275~\335\302\225\200O\t+oG\246\214Q\202\257\250\265\373\027\273\334\374\202\335\030x[K\263\221\340\205k}\353\362^\371\343OS\260\361\372\001'\302\333\362\355+N\226t\272sM\354\264\337\346\342n|yX\215wU\360#\207'\343\217:\262\371v\360\273\273#\311&\372"
+	.ascii	"\333d\363\230\236\323\265p\335\3476/E\377\226\223\334\262\267"
+	.ascii	"\022\007\356\027\033\323h\273\241\364\025\025z\376|\227j\330"
+	.ascii	"\314\200#\261\375)\367\201\362#l\346O\202\377\216\315\037!\321"
+	.ascii	"\025A\222oB\233\375\371\270\351*\324;\321\222!\217\360\035\026"
+	.ascii	"\001\036r\263\2202\245\257\334/&\217-\216\233XS\\\22138\017+"
+	.ascii	"\373\362\271+\240\206\001\274\300\033\026i\353\220n\366\356\345"
+	.ascii	"\f\261e\376\267\350\255]\214\247\353\024\002S\252\275a5\2132"
+	.ascii	"\351\310\357z\3174\376N\305]\363iN\350\025\313\243\235\177\034"
+	.ascii	"t.\210\215%\314{.p|\270m\204\367\217\271W\361a\243K\375\360O"
+	.ascii	"\333\314\332\200E\354"
+	.ascii	"\344y\210\201F\234\031\274%\300\275\310\363\267\323\252}\231"
+	.ascii	"\245m[\367K\034\314\313y\211Y\037\333Qt;\240'q\205\235\246\377"
+	.text
+	.section	.gnu.lto_.symtab.31eb944f3aa732f2,"e",@progbits
+	.string	"AccInflightCalibrationArmed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\002"
+	.string	""
+	.string	"InflightcalibratingA"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\002"
+	.string	""
+	.string	"AccInflightCalibrationActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\002"
+	.string	""
+	.string	"AccInflightCalibrationMeasurementDone"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\002"
+	.string	""
+	.string	"AccInflightCalibrationSavetoEEProm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\002"
+	.string	""
+	.string	"headFreeModeHold"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\003"
+	.string	""
+	.string	"applyAndSaveAccelerometerTrimsDelta"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\003"
+	.string	""
+	.string	"resetArmingDisabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\003"
+	.string	""
+	.string	"updateArmingStatus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\002"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\003"
+	.string	""
+	.string	"tryArm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\003"
+	.string	""
+	.string	"handleInflightCalibrationStickPosition"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\003"
+	.string	""
+	.string	"updateMagHold"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\003"
+	.string	""
+	.string	"magHold"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\003"
+	.string	""
+	.string	"throttleCorrectionConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\003"
+	.string	""
+	.string	"processRx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\003"
+	.string	""
+	.string	"setPidUpdateCountDown"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\003"
+	.string	""
+	.string	"taskMainPidLoop"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\003"
+	.string	""
+	.string	"isMotorsReversed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\003"
+	.string	""
+	.string	"pgResetTemplate_throttleCorrectionConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\003"
+	.string	""
+	.string	"throttleCorrectionConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\003"
+	.string	""
+	.string	"throttleCorrectionConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\003"
+	.string	""
+	.string	"isRXDataNew"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\003"
+	.string	""
+	.string	"inputSource_e"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\003"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\003"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\003"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\002"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\002"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\002"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\002"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\003"
+	.string	""
+	.string	"averageSystemLoadPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\003"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\003"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\003"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\003"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\003"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\003"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\003"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\003"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\003"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\003"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\003"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\003"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\003"
+	.string	""
+	.string	"telemetryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\003"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\003"
+	.string	""
+	.string	"isGyroCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\003"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\003"
+	.string	""
+	.string	"isAccelerationCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\003"
+	.string	""
+	.string	"isBaroCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\003"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\003"
+	.string	""
+	.string	"pidController"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\003"
+	.string	""
+	.string	"writeMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\003"
+	.string	""
+	.string	"writeServos"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\003"
+	.string	""
+	.string	"isMixerUsingServos"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\003"
+	.string	""
+	.string	"mixTable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\003"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\003"
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\003"
+	.string	""
+	.string	"isUsingSticksForArming"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\003"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\003"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\003"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\003"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\003"
+	.string	""
+	.string	"isArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\003"
+	.string	""
+	.string	"warningLedFlash"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\003"
+	.string	""
+	.string	"warningLedDisable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\003"
+	.string	""
+	.string	"warningLedUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\004"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\004"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\004"
+	.string	""
+	.string	"blackboxFinish"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\004"
+	.string	""
+	.string	"beeperWarningBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\004"
+	.string	""
+	.string	"isFirstArmingGyroCalibrationRunning"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\004"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\004"
+	.string	""
+	.string	"blackboxUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\004"
+	.string	""
+	.string	"updateGpsStateForHomeAndHoldMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \004"
+	.string	""
+	.string	"processRcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\004"
+	.string	""
+	.string	"calculateThrottleAngleCorrection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\004"
+	.string	""
+	.string	"resetYawAxis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\004"
+	.string	""
+	.string	"applyAltHold"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\004"
+	.string	""
+	.string	"updateRcCommands"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\004"
+	.string	""
+	.string	"gyroReadTemperature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\004"
+	.string	""
+	.string	"mspSerialAllocatePorts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\004"
+	.string	""
+	.string	"telemetryCheckState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\004"
+	.string	""
+	.string	"releaseSharedTelemetryPorts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\004"
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\004"
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\004"
+	.string	""
+	.string	"updateGpsWaypointsAndMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\004"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\004"
+	.string	""
+	.string	"processRcAdjustments"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\004"
+	.string	""
+	.string	"updateAdjustmentStates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\004"
+	.string	""
+	.string	"updateActivatedModes"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\004"
+	.string	""
+	.string	"processRcStickPositions"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\004"
+	.string	""
+	.string	"beeperSilence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\004"
+	.string	""
+	.string	"isAirmodeActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\004"
+	.string	""
+	.string	"pidStabilisationState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\004"
+	.string	""
+	.string	"pidResetErrorGyroState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\004"
+	.string	""
+	.string	"failsafeUpdateState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\004"
+	.string	""
+	.string	"failsafeStartMonitoring"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\004"
+	.string	""
+	.string	"failsafeIsMonitoring"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\004"
+	.string	""
+	.string	"updateRSSI"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\004"
+	.string	""
+	.string	"calculateRxChannelsAndUpdateFailsafe"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\004"
+	.string	""
+	.string	"gyroUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\004"
+	.string	""
+	.string	"getTaskDeltaTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.31eb944f3aa732f2,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
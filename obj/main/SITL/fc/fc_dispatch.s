@@ -0,0 +1,341 @@
+	.file	"fc_dispatch.c"
+	.section	.gnu.lto_.profile.979c5e5540b0990e,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.text
+	.section	.gnu.lto_.icf.979c5e5540b0990e,"e",@progbits
+	.string	"(\265/\375 h\215\002"
+	.string	"\344\003\\"
+	.string	"\007"
+	.string	"\350\300\306\254\005\002\002"
+	.string	"\002"
+	.string	"\001\352\263\360\321\b\002\236\376\250\313\b\003\373\353\216\267\005\n\002\001\002\002\002\003\002\002\002\004\002\004\002\005\004\005\326\330\245\257\002\b\006\240\342\234\212\n"
+	.string	"\006"
+	.ascii	"H1\240i\366T\273W\220A\263\r\030\264\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.979c5e5540b0990e,"e",@progbits
+	.string	"(\265/\375 *\365"
+	.string	""
+	.string	"\240\036"
+	.string	"\004"
+	.string	""
+	.string	"\003\002"
+	.string	"\001\003\001\001"
+	.string	"\001\005\002\001"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	">I\327\fg\003X"
+	.text
+	.section	.gnu.lto_.inline.979c5e5540b0990e,"e",@progbits
+	.string	"(\265/\375 \264e\003"
+	.string	"\022F\025!\240'\351\243\017\276K\303D,\334\253\023\351{W\224\035KC\020"
+	.string	"\200s/\357\231E#\215\020\271S\377/m\231\tE\341V\033\364GE\304Q\225\271\325"
+	.string	"'\027\026\370\0308\b\364\252\217\367 \204\203iD\034L\260\351\177oBoh\373\230Lf\346\3713#\b"
+	.ascii	"\240\264\256\n\036`\017\254\343(rXDs\tu\003m"
+	.text
+	.section	.gnu.lto_.jmpfuncs.979c5e5540b0990e,"e",@progbits
+	.string	"(\265/\375 7\245\001"
+	.string	"\324\002+"
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\003\001\001\003\177\002\007\002"
+	.string	""
+	.string	"\001\300\004\001"
+	.string	"\300\004\002\177"
+	.string	""
+	.string	"\177 \005\002\001\001\017\177\002\002\177\002\006"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.979c5e5540b0990e,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\204\004\002\230\004\003\271\004\005\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.979c5e5540b0990e,"e",@progbits
+	.string	"(\265/\375 \224u\002"
+	.string	"\002\304\n\022\320\2455@\001\341\006"
+	.string	""
+	.string	"0\333R\356\275\367\226)\245}:\036\231\231\265r\013\227\371\366i\234\346$&\225\207\200\244-\266 @\r"
+	.string	"C\354\013\241\003V\213l:"
+	.ascii	"\225\333n\001);x\256\371&\"\314c;s\300\266\r\264\001"
+	.text
+	.section	.gnu.lto_.lto.979c5e5540b0990e,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_dispatchIsEnabled.17.979c5e5540b0990e,"e",@progbits
+	.string	"(\265/\375 \343]\006"
+	.string	"\322K,2`m\322\030@\003\0077J\2638V8\203s\202\234\323\276S8!\323\232\265\036\334\246P\376\177\326\333\002"
+	.string	"X8\213\336\327S\317\233\202\300\217\244I)S\273\352\301q.\232M\246\201\301a\232\303\264\210\314\005\242\271k\323*\202-\215\303\3258\226u5*[TQj\001H'\036?\020\344\215\034Kt\0221\224\306\016"
+	.string	"J\251S\006(G\237}R5\036-\253\242?O\235F\004Lv/F+\213\"\225t\374\236\247NP\360\374\006(4\205\244BDe7k\272\201\017\363\215\350\201\006!'X\350\203\031\260\260\273'\026\302\300\025\377\203\037\341\267\b\b"
+	.ascii	"2\003\316:#e\b\3055\321-\002#!\362\270\033\235v\222\001"
+	.text
+	.section	.gnu.lto_dispatchEnable.18.979c5e5540b0990e,"e",@progbits
+	.string	"(\265/\375 \346m\006"
+	.string	"\262\313,3PM\324\001\244\0340\350q\247`}5"
+	.string	""
+	.string	"\024}\235\263@\204]T$\206\265\375\3304\2340\017\013\2261\323\310\230\372`-\240\016\326>=!\177\357\224\002\256\017C\275 \312\222\024\022jDkD\035$\250\201\326\312\242\317\200'j\241\242\3274U\324\t\367\0234\240@)\341&\204\177\254\361;\356\201\371\031~\310\344\2753~\326\234\221#\242\005\207\t'G;\334\344\274\260_\331\t\332\023\241\003\t\030w'\306\224\025\031\021\r\333w\254\331$\002\021"
+	.string	"!\335\307\311\356\322\211q\355R\363\277\361\213\367m\227\226\203\335\265\364\276\212{\3366\201\355\002\333\022\001\b"
+	.ascii	"3\001\0078\003R|\241k8V\b\343e\210p9\026\355$\003"
+	.text
+	.section	.gnu.lto_dispatchProcess.19.979c5e5540b0990e,"e",@progbits
+	.string	"(\265/\375`\364\001\235\021"
+	.string	"\026\340sG\340\322&\035R\267\331I\317hZgr\367d|\205W\261\332ZP\347\362\341\254<N\300\306\f\366x\037>nx\317a\252i@\037V\037[\234#\31631\032SH\246\020\337\037\207\307\225\347p>\346XB\366\2262\245\\"
+	.string	"Z"
+	.string	"d"
+	.string	"Np\272D\271\tw\031/\200\273\364\313\3461\340\302\210\322\215Q\2209\347\267\037,\365uN\306\325\227Ot\335\320$\013i\316\225\20468aL%\t\235\307\270`H\b\304m\327\234\260&\256\rI\206\027\332\350\276v\205\321$\013u\256\035\2039\247U\026j\270\273\333\236\261\375\300\326\223\273\003db\006\323\3332\355\260%\355\366\330\264\230^\245\206R\b/\217\335\251\275U\237>\373;N\035\245z\243ZW\375\021\222\030&8\346\314p#2\227\344\013 \277\366\"\231\243p\001 \2419\247\3554[\306\366.\357\331\276\332?\361\241\327g3\0060\247\007\242\026s\322\024\0046x\0261$>&\273'ABf\272\276\212\257h\371?F\265\350e-7d=`\251'Y8\235t\021\004\245\330\341\231\021=\201\363\366\266?\207C\315\007\023\215\032\035\342\323z\333\375\270)\362\355\366\264/z,\021\332\300"
+	.ascii	"\344hDLo\266UG\232)\3111\347T\361\217*\254\f\370\374\\\372-\356"
+	.ascii	"\362\001vIiQH\271b\276\227\225J\265\002OP\252\024\004\327\013"
+	.ascii	"\212\305\212\001=\203).\240k\005\246\225\222\020\001d\371@\226"
+	.ascii	"\357%\265\242\372@V\353K!\340\025\f\212\365\271V+\326\347\321"
+	.ascii	"`_\036\242;PZ\202mL\004\267=F\217\333@\207\213\270\257\375\300"
+	.ascii	"\217&\234\0160\275=\3169\247\f\240q\275k\224\232\245q* \200\002"
+	.ascii	"\231\262\363\306d0\f\254;z\007\017\n!B\246\224\017 \270HX\315"
+	.ascii	"JC\215\247/,*o\305\022w\262 +W\331\026\326\236s\246w\202\211"
+	.ascii	"+0\f\rM 1U\024\033\270\344\276V,\364X-_\250\370\362\023\357\355"
+	.ascii	"\020+E\2716\355\277pP\324M\333`zi+\336\350\b\224\f"
+	.text
+	.section	.gnu.lto_dispatchAdd.20.979c5e5540b0990e,"e",@progbits
+	.string	"(\265/\375`\311\002\305\026"
+	.string	"\006*\225H\320VQcT\341\371r\342:\242Kr\034g\265\333\003\353t\020`\022\036\327&\001\361 \235\361\351\253$\3443\202\205a\226\206Q\310\320\342Zm\314R\r\037E\347\002\f\373\236\017D\272\027\322\001Z\342\362\333\336rK\231R|"
+	.string	"v"
+	.string	"\206"
+	.ascii	"?\377\360\312\275\037\222v\334{il\340tK <\265\377\342\274\333"
+	.ascii	"{\266\003\270\327\310\306\216{}4\2369\335\332\367\027\361\366"
+	.ascii	"t\027\361\3267\273I\f\005\324\022\321\f)\367\336\262\206pHo\027"
+	.ascii	"mX\351\315\2079\315\335\320Er\227\2436\254\277 \020\325\256B"
+	.ascii	"\210\200\327b\304\203\247\272\035\005\032\246\300\360\372\340"
+	.ascii	"\013\260 b\3560\234\2168\367^Ssw\341\036o;\310v\003\233\"\t\260"
+	.ascii	"\007\364\346\353\231\240(\345\352\220\355\313\321\n\302\276\215"
+	.ascii	"\021!$\\\215lJ\335\362\336\317\242\022\251S\007\336\250\377~"
+	.ascii	"r\024\251\305S\333S\207?\272\253HME\352\273\260D"
+	.string	"\201\t\336[tR\271J\266\307\211\037\375@\277\306\221l\322A\247a\031\036yK\336\3763\0364i\033(\024^\032\t^L\2719\252\341\344,,Hjrr\257o\346\326\007l\352{\214\333\003\365HW\240\202\203o\005\021\020\205\275\272\017!\233\001b\225\341M\351\341\350\371#L~H\266\202\260\270\224\243\252\252m\242f\325nx-\356\305\335\034\253\356\306\303*A\306\222\t\264\311>\217\230\355\344\327j\r\022\321m\b\357\2757\364u\264TJL\333\301s\270N\367^\033\034\020|^D\230\260\211\267\252ZY$13\340\350Ykt0\nRM\353+\252\236\251\202\207\034=MVZC&\242*8zz\205\332\001\356\251\231\375\270hA\345\013\006\004\004c\005\370q\321^9;-T\354\263\234\332\352\247\2653\326d\264W\313\232U\323\303\242\255b3\327\216\016\213\247d\361\224/\327\n\250d\311fe\215"
+	.ascii	"\303b-YI\203\301d%\351\303\225\270\035\253\303p\254\265\352\306"
+	.ascii	"\242^\370\033\267UgO%\\\315\231\245\372<\"\330\250\222\030\030"
+	.ascii	".8\330\n\304ub\340\223\262\032\226\314'8z\226\020u\304\226\372"
+	.ascii	"\340_\224T\004\312\221!\251\332RGT\025k*6 `\002\221bv\036]\030"
+	.ascii	"\327\352 \323\360\r\317J\363\002c\b\265-\322&\207\213\361\257"
+	.ascii	"q7V>\356\323\307\201V0\270(\036A\337\237K\033\253\316\355.\230"
+	.ascii	"d\352gr\356^[\307e\034\022\n\251$\270\302\267\0246u\247\261M"
+	.ascii	"\230\372\355\022\236.H%\2439\252\251\3209\271\032\234\271\033"
+	.ascii	":\227\274\316\300\307<\026\301\266\003Z\fcD\214_\221\266)\300"
+	.ascii	"\265\331\376\201\255\271|\306\207r\347\nO"
+	.text
+	.section	.gnu.lto_.symbol_nodes.979c5e5540b0990e,"e",@progbits
+	.string	"(\265/\375 \255\235\003"
+	.string	"\344\005\251"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\021\177\f\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\020\r\200\204\001"
+	.string	""
+	.string	"\003\002\022\177\016\002\023\177\017\252\333\3426\017\020\024\177\021\013\022\201"
+	.string	"\001\025\177\023\377\037"
+	.string	""
+	.string	"\200\200\200\002"
+	.string	""
+	.string	""
+	.string	"\004\003\330\244\235\311\003\001\225\006\003\005\007\252\333\3426\001$"
+	.string	"\007"
+	.ascii	"H\020\002\227\005Xc(:\200\213\267B\270\b\255\312"
+	.text
+	.section	.gnu.lto_.refs.979c5e5540b0990e,"e",@progbits
+	.string	"(\265/\375 !\t\001"
+	.string	"\035"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\001"
+	.string	"\001\002\001\001\001"
+	.string	"\002\003\001\004\006"
+	.string	""
+	.string	"\004\t"
+	.string	"\001\005\002\004\005"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.979c5e5540b0990e,"e",@progbits
+	.string	"(\265/\375`R\t}3"
+	.string	"\332[ \024G`\336U\007\211\004\347\303\031R\244jz\360C\2336\"\253\327\262E\220\270\201\270\234\031\1770\375bmm1|\003\032\373\207\323f\366&<38\344,\271\200\r\277\241\n\373\261\323A\037\231\220\216\344q&\331\357/S\n\016\0013\001/\001\"r\267_\361\250c\3515=\377C"
+	.ascii	"\336\020\t\"\305l\257\271\264\273u*b\250y\245bnv&u\202\331\250"
+	.ascii	"\213y\330\373B<\310\253V\n\263\315!\367R\366)\016\365(\317\253"
+	.ascii	"\264?=J\353\222\357?\377_ \335\231Z\r(f[)\267Si\003\\/\241\007"
+	.ascii	"\344v^\016\310y\271\316\231\310\007\344X\017\220\013z\302\363"
+	.ascii	"\221s\206\364\302N\272\375\313\227\270\363\346R5\037\372\377"
+	.ascii	"\356v\276\266tA1\353N\354M\374mw:\223>\222\320=\311_\362\377"
+	.ascii	"\272\223\375?\272'\370qO\200\233\3768B\311\261\215s\277> \227"
+	.ascii	"=@\216\352\355<e\273n_\353\356,\335\335\345K\267\347\005\335"
+	.ascii	"\016 \250\333\313\252^\330n\027\353v\357\356kw\263u\267Zw\247"
+	.ascii	"uw\265\273\317t\267\231\356\326\322\335d\335=\326\335M\272\273"
+	.ascii	"Jw\203\350n\263\356.\353njw\213\351n'\335\375v\267\200\356\006"
+	.ascii	"\323\335\270\266\266\266\266n'\352vg\367\216/\356>\271\230\356"
+	.ascii	"\263\311\334}\362\333\177\036m\344d\223\351\206i2\203\334\347"
+	.ascii	"\221\351&\271\230\273\253*\216\252\324\0213\037\336\306M~\225"
+	.ascii	"r\353\270\f\242\272o\363\321\376\035\032\365K\005\377[\315%\332"
+	.ascii	"\021\313\245Hj\025\022\354\330\364\367\377\013(\221]\315OR]#"
+	.ascii	"\315\177#H\247WFh_\352\357pj{c\353\251\242\376\r\374\373\257"
+	.ascii	"\374o\375\251\377\337\376\377\316r\353\375\327\nr\205(\225\377"
+	.ascii	"YB\312\337j\257D\375c(\032)\323}v5\215\256Hy\ny\027o\353B\036"
+	.ascii	"\215k\231\237\255\223\247\372\177W\313B\2301\334\214\231\376"
+	.ascii	"<\226!\257\031\231\216iE\345RFu)c^\276\250<id\374\260\222\211"
+	.ascii	"\301R\343"
+	.string	"\221\003\263cB8\037V6\307\312\355K\374\213Kq0\247B-,I\342P\272\270t\b\351j`S\222\366\377\202\3610\356\305\243\376\305\303\332\2678\227\026z\377\223\377\337\020\272\215\276\270\025\237\336\336!\3777z\374\264t\\0\261\376\277\f\030\b1\270\271I\303\303\315l\007\263\013M\265\374\260\221\361C\007f=\213\2679\233Na\266\003ej\271q5w\3735\352W\007c\223\3573sQx\\\035\261\376\262K\203\335\017*\222\257\2655gcSu\265\336\2540\266\314\344\264\263\371\204yei\303\254\303qknqU\"\265\306\371IS\036\243\306\250\332\304^\364\224\235q\345k,Hno\343\256\026u5'\023z\037\006\261\211\264Ac\036\271\335\311rk\326xZ~\021\200\251\272z\365x\021\233r\331\264\247\261c\234gh`91VW6\3146\326J\223\306\253^\r\363\251\361J\315\250\342\314\214"
+	.string	"\211b\266\361Tnw\272\237\211\372\031w\372\373VI\316\345\333\240}Nn'\343e\332\317\372\314\315\350\262\376\206\206J\325\325\372YY<6,l\r\310Z\273\231\356#\t\356\324\r)\322E\005\226\033w\347\376\270\374\177\030\270\367\227\310\236\234\343\334y\335>~s\005\177\353!\037\377X\3257\271\210\330\221\006f\273\233\350\333\353\277\335\375\373K\367\311\325\272Q\314\230\273\367m\020\370\347\215w_.&\333|\374\357\373'\271\230(\334\267\271t\337f\033\364\311f\373\3772\203\\\350\261\r\355TT|\n\032S\364\204C(\250\241o\347\b\302\t(\037\256\235\212zE\"PE\220\3703`d*\206"
+	.string	"B\005\215\2718$\372\202P\271v*\342"
+	.ascii	"b\303\207\236\021X\202\330d$2\341\033>-\001\211\303%(\240\261"
+	.ascii	"\310\342\003\320\357G\201\347\327\004tb\213E\240oH\364\360\343"
+	.ascii	"\373\001\237F4\t/\0247\354\332\027$\002\205\300"
+	.string	"\022\271# 9@JZ\261\323IJ\017\224\036\344:I\311\310H\t\311(7\222\321\315\330NC=<\001$\366\214\303!\261\307c\\\001\024\262>a\n\f=E&\026D\243\360\002P62\035A0\n\203)rO\230\260D\024\242C\206\354+r\362\031\233N\024\203?&\037\211\236\217DO\030l\202\352\371\210\305^\321\201\247\240Q\030\342\007d\321\364\004\374\365<\r\207\025\230p\335\215\251p\213v#\311\024f1\022#\361\013]\373V<c\2404\264\254\237%\203\327\215[4~!\205\223T\262\250`\026Ga\027\036\355)v\037\310wpiw\324\310+vz\232\303I\007\323\215\321Bc\346\206\225\353\324\301\255?A\360\205e\365\372\317\342e\254\"I\244p\213\277\272\245\355\212\331\266\236\343UX\200\252\250\2214e\020DFdFDdf\222\024\016\200\002\221)3n\021@\251\262nj\322T\3668L"
+	.ascii	"e\006\371/\003]\352\307\322\340R\217\317\020[\001\027\202\017"
+	.ascii	"\330C\320\367L\235\343\346\344\224\342\240\240\323<\217\250q"
+	.ascii	"\200z\201bw\222\363\345\314\316\207\0337\203\207c6\276\272#;"
+	.ascii	"\211&UJ\363x\277\354?\301\350]\035)A,\300a\307!olaIG\022+\332"
+	.ascii	"\326\231\257!I\370\3022\321/\331\227\257\344\201+3I.\253\b\220"
+	.ascii	"#(\320JQ`\305\300\003\353\035g\265\206\264\2167\n\bT\263\374"
+	.ascii	"H\214[?\326\023\350\266\361\001\217\"\212\324\213.+\370|\316"
+	.ascii	"\220\244\252\202p\371 \177\251\211\274\335\304f\021\023\232%"
+	.ascii	"\273\337\330-D\231\244M\022\217r}\303\230\004P\265\324S#\331"
+	.ascii	"a\262\250\211\366\202]d\314\007~\310a4\001b\204\n\367\333K\317"
+	.ascii	"3\b\255\204id\031\270:\257\037\354\230\375s|\203\333\003\322"
+	.ascii	"{)G1n\255\373\227.\263\346&}\316\321%\237\321\375C%&\316\024"
+	.ascii	"V\213\016R\034\364\007a$\231j\367\f\364\277\020\214\033\375\237"
+	.ascii	"\306h\310'\005W\306\235\376\276\302\334\306zP\374\247\225\334"
+	.ascii	"\215\345p<\0026\\\330\315\227\307\357\253\322\275X\307\024\216"
+	.ascii	"a\257\257x\217]\r"
+	.text
+	.section	.gnu.lto_.symtab.979c5e5540b0990e,"e",@progbits
+	.string	"dispatchIsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347"
+	.string	""
+	.string	""
+	.string	"dispatchEnable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354"
+	.string	""
+	.string	""
+	.string	"dispatchProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360"
+	.string	""
+	.string	""
+	.string	"dispatchAdd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372"
+	.string	""
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374"
+	.string	""
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.979c5e5540b0990e,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,244 @@
+	.file	"fc_hardfaults.c"
+	.section	.gnu.lto_.profile.7fd68742a6bbca1a,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.7fd68742a6bbca1a,"e",@progbits
+	.string	"(\265/\375 \037\335"
+	.string	""
+	.string	"\250\023"
+	.string	"\002"
+	.string	"\371\324\320\376\006\002\002"
+	.string	"\002"
+	.string	"\002\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.7fd68742a6bbca1a,"e",@progbits
+	.string	"(\265/\375 \023}"
+	.string	""
+	.string	"H\007"
+	.string	"\001"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.7fd68742a6bbca1a,"e",@progbits
+	.string	"(\265/\375 8\255\001"
+	.string	"\344\002,"
+	.string	"\001"
+	.string	""
+	.string	"\007\311\315\304\201\003e\001"
+	.string	""
+	.string	"\002\b\200\200\200\200\002e"
+	.string	""
+	.string	"\004"
+	.string	"\201\200\200\200~\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.7fd68742a6bbca1a,"e",@progbits
+	.string	"(\265/\375 \022u"
+	.string	""
+	.string	"@\006"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.7fd68742a6bbca1a,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\264\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.7fd68742a6bbca1a,"e",@progbits
+	.string	"(\265/\375 \030\225"
+	.string	""
+	.string	"P\f"
+	.string	"\001\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\002"
+	.string	"-Al"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.lto.7fd68742a6bbca1a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_HardFault_Handler.16.7fd68742a6bbca1a,"e",@progbits
+	.string	"(\265/\375`\200"
+	.string	"\325\t"
+	.string	"&RC=0\345(\035\300U\007=dx|W\326(\013\313\375\0177=(\005\"\301\360\213\212!g\366AQ\333\335g\330\226K3\243!e\033\016\006F\f\365@?\222\200(\001\317\302\222M\244L)2"
+	.string	"1"
+	.string	"3"
+	.string	"\247sq[=\371\t \347\006\300\220\307\202o\037\337M\001c6B"
+	.string	"\2466\016M5\363\225\253\006\370\251j\030\346\234\326\025\350qkn\373c\033\3016\200\366\013\245[b?f\310^\274\241}\265^\375\270\3201#` \233\223\243V`\306\242L\212\355o|\262\007\374u2\017cQ\301\314\346\234rM\0345$\375\312\234\030\221\330\267\250\177(*\353r\335\017L@Ji\216/q_\335\253X\337]o)\371-[\230\364\253G\337\304=~\003l\264H\\\254\013\255\005\356:\242\221\004\311\003r\360<\020\r\035Hv I\021\341\231\220\235'\222\235\003\207*\036<9\n\205<\271\261\277\241\271m\3169\343\206\377\266\241m\215\332\242\021"
+	.ascii	"K\005\005\311\\\255\377\20348\255\302B<XC\251\2153c\237-\255"
+	.ascii	"\274`\021d\006\267\237\245\221\026\321M\3351\245PP"
+	.text
+	.section	.gnu.lto_.symbol_nodes.7fd68742a6bbca1a,"e",@progbits
+	.string	"(\265/\375 Re\002"
+	.string	"\344\003N"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\020\177\001\304\357\210\005\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\001"
+	.string	""
+	.string	""
+	.string	"\005\021\002 "
+	.string	"\003\201\204\001\022\177\004\377\037"
+	.string	""
+	.string	"\200\200\200\002"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\003\270\252\203\001\001\204\001"
+	.string	"\004"
+	.ascii	"O\t\201K=\323\bd\225'"
+	.text
+	.section	.gnu.lto_.refs.7fd68742a6bbca1a,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.7fd68742a6bbca1a,"e",@progbits
+	.string	"(\265/\375`\231\003%\034"
+	.string	"\306\267\302I\260\326\321p\335\312\254\337yC\240;_\005+l\207M\332\036\312\367w\036\201\316\303\355\234=\213n@\207\f\304\0329\375\343\321\002\303\361\324\237\224\177\324\177\204\361%\265?\"%l\250\335\022W\006\346\233c_\301\235p\333-S\234"
+	.string	"\242"
+	.string	"\262"
+	.ascii	"\t|\274\244\337{E\224\351\3673\361l\277\205s-\036\306\026O%\244"
+	.ascii	"\017\005\375\n"
+	.string	"\276\376\276\377\334\027\377\237\377WR\244\365_\321\202.\371|\377\021\002\337\221N\251\240\177$2\211R\321a\322/F\212\307p\351B\353\271K\277\002\246\345\360\334\361\241\377\373\244\\RQ8\031I{q\330{c\235\\\\\350\320\357\304\177\205\261\254)|J#\351u\r\274\312-\360\262\035\244\262M,b{Ai\257\220\355)\333R\266\241l\013m;\331V\261\215\304\366\270\265\265\265e\373\306\336\003\266\013B\245\037\224\036\355\327w\351\377\023*\353S\336\200\227\275^\225\335\230M`]\353\3006y\027\313\372\263\tJIc\310\216\305H\332~\271m/\320\277S\277>\205\301L\f\201\352\0374\372P\351\260\017\201\177\357\367q\367\365j\313{@\265\\wM\320\365\227\302\276\356\322\367~\347\036\230\242\304\335\tC\207\300\023\206\256@\365\275\237\213\366\202G{?\025\326\264\002St\270S[\320!P]\352aU\325"
+	.ascii	"\355\235\310\207\264K[\212\350\372\373\325\277\304\240\247\016"
+	.ascii	"~\244_z\2653\332(^\221\210\007d\367\333\365\177G\261qk\006/\206"
+	.ascii	"\223\037\336\340\376X)\262\267^}=\305 \"\222\365\364H\004\230"
+	.ascii	"\214b\215\221\\!;d\203\261\215\362\002\331 \006\320[?\004\260"
+	.ascii	"\344I\013\"\261\364\306^,\033{\275\254\201\027\271M\245\275O"
+	.ascii	"\033\334\247\205\"\317\340\213<\340(\241\225\365\037\2110b\251"
+	.ascii	"\020R\215\344\362\330\036\033tY\242\353\f\256,\004\264lhM\031"
+	.ascii	"I\257Q\351uy\355\326\272\274\274&Jo\216\325\341]7\270\353\n\335"
+	.ascii	"\362\237\367\273\250\222\235XBj\326\217\232be\025\223\213\246"
+	.ascii	"(^\241M\341\202\261\006\374N\377\027\250X1\315\3601\222\336\341"
+	.ascii	"\020V\377\005\323\004\266\301\344j#n>2\323\306s\353\331Q\240"
+	.ascii	"\313\341L\034\007 \234\251\013`\033\314\206\017\032pdf\215'7"
+	.ascii	"3_\314\034\n\025\312\0204\\\217M-\207\263\301a\261"
+	.string	"\r\306\274\375\334\020\23093\346\317M\304J\315\234\2318>5SGB'\300\f\214\003\252\345d&\016\227\223\t0\r\215\315\013\210\016\031J\032\214nG'7\263\345\320vd\264\035\331\317m\346#\243\345t2\030\227\\\255G\347gv\223c\366\210\230a\320\311\315n`\246\335r\265\237\032Oi\0132\022dfF\254x\246fB\315\204\227gjbbjdbJ\313\304\270\214\bI(\025/\222\250\026jT\222d\2107\222SS+\334\340\213\366\t-\222\222\365\0070 @\002B\020\226\323\001O\230z\346\211\266G\211\016\177\035\316-\353\206c\340\370_L'\200\240Z\260u;\232\272\264\033n\314W\027\313W\214\027>#)\304\373\020\273\330\006w\223aHh\274c\250{\274\213\t\247\241w\350\034\030C\204\305[\317\215\024cB\r\2642\r\021\346\023\006\222\2461\364Pi\311\216w/\265\271}#\3246"
+	.ascii	"\345:g\367\206\334\253u\325\036"
+	.text
+	.section	.gnu.lto_.symtab.7fd68742a6bbca1a,"e",@progbits
+	.string	"HardFault_Handler"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303"
+	.string	""
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321"
+	.string	""
+	.string	""
+	.string	"systemState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311"
+	.string	""
+	.string	""
+	.string	"stopMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.7fd68742a6bbca1a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1584 @@
+	.file	"fc_init.c"
+	.section	.gnu.lto_.profile.e979482ec6a55349,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.e979482ec6a55349,"e",@progbits
+	.string	"(\265/\375 \222\345\002"
+	.string	"\364\003\206"
+	.string	"\t"
+	.string	"\233\364\343\336\006"
+	.string	"\001\315\260\366\255\002&\002"
+	.string	"\001\002\002"
+	.string	"\002\003\002\004\002\005\002\004\002\006\002"
+	.string	"\002\005\007\002\007\003\352\263\360\321\b\017\240\342\234\212\n\020\021\022\023\024\240\342\234\212\n"
+	.string	"\f"
+	.ascii	"@\004\334\201\306\002\361)9f\0228\352\016 `QeW\362\235+k\003"
+	.ascii	"X"
+	.text
+	.section	.gnu.lto_.ipa_sra.e979482ec6a55349,"e",@progbits
+	.string	"(\265/\375 \206e\001"
+	.string	"\210z"
+	.string	"\002"
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\f"
+	.string	"37\264\020X!"
+	.string	"\362@c@\b\030"
+	.string	"\006"
+	.ascii	"\177?[\226\263\020\006m"
+	.text
+	.section	.gnu.lto_.inline.e979482ec6a55349,"e",@progbits
+	.string	"(\265/\375`\360"
+	.string	"m\005"
+	.string	"\342\304\021\036\220E\351\227\177\365m\271\245:\351,\\[:\2053T\307\356\356.\334\377\030\265\177\313\235\002\037\302\253u\265\307\337\b\372\247\372j\005\236*\241\364a\023\224\364oA)\0205\347|\337\341\231\314d\20743\023\277\037 , @\002\242$\333\003I@\351\241-\020\260\360\214\305\222\204\374\205A\t\343\037(@R\n0\250"
+	.string	"\226d\340\253\241\260\006\266\020\255\013\363\300\256"
+	.ascii	"\260:\257\033\202\004Dj\320\005\250\020tx\210e\034\370\300\031"
+	.ascii	"\034hp\354\341\254\023\310\267r\214\022\220=\004\tx\001\263\215"
+	.ascii	"E\214\260\231\270\221\303\233\327\356\020"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e979482ec6a55349,"e",@progbits
+	.string	"(\265/\375`\266\001\205\t"
+	.ascii	"2L(.pK\222\016\374o@\264\273\r\277\032&\323\034\353\277^\r_#"
+	.ascii	"\337Z\343\232\251\377\337\237\201~\374\377G\310\f\241\317\223"
+	.ascii	"\220\0266i[&\031D`\250,(\222JM\221k\345\301\230\300\0069\344"
+	.ascii	" AA\315\221\303\fl6\253\002\265(\372\262\326\rW\356<M9N\271\376"
+	.ascii	"\364\307\355dB\233&\311\341\001\342\310\013\203=\"\370\006%&"
+	.ascii	"z\306\312z\364\034\007\324Z\212\253\363\035K$W,\256-\367\226"
+	.ascii	"\353\304\024\240\366\017\364@_,c\231\251a\301\255$M\r\264\023"
+	.ascii	"\315\241-\256\235dyd5\002G\250AI\346XQ\335\302\034\200\002\021"
+	.ascii	"DT\036\021\260P\213\354\250\261\316f\204\342,\020\223\356.\003"
+	.ascii	"\004\304\270\206{\260\335V\346nv\023\232\302Y\356\362Z\342\362"
+	.ascii	"\217\365'v\3672\365\\gpO\327\226a^R\302\261\366\235K\351\330"
+	.ascii	"w\004\233\361\311=F\324E\004H:\324\b\177\245\357\233\007\025"
+	.ascii	"+\362\245\307\224`\323sd\250\3221$\247\220\262R\"\233\317\202"
+	.ascii	"\b\252\324\334\234\235\272\347'/\300\320\226UD\263\001<\0258"
+	.ascii	"\013\230\002"
+	.text
+	.section	.gnu.lto_.pureconst.e979482ec6a55349,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\200\004\001\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.e979482ec6a55349,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.e979482ec6a55349,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_processLoopback.145.e979482ec6a55349,"e",@progbits
+	.string	"(\265/\375 \276-\005"
+	.string	"2\t#-pU\323\001"
+	.string	"\355U\354"
+	.string	"~\257\340\352\305\\\201\245\252p\214\230@\315\247\204\206\224\227\306\371zU\017\020 \346\301 \304\216o\343\336)\005\226\2215\247\331\220\222JI\247\351\200\250\254$\032\031LE\036\225Z\024U)\304\355\343v\230D\212\315a0b\354\0136n6dx_\200\342\263k\031\020Xo\340\341\330>\344\313\0068\247\331w\233J\367\355\256\306\314\257\303\313\177\347\205L\303\016\t\213\3355\314\264\313\035o\033a;a{\006\b"
+	.ascii	"3\003\316\231!\340\313]\303\323B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_init.146.e979482ec6a55349,"e",@progbits
+	.string	"(\265/\375`\336\016\325G"
+	.string	"zt\370\031B@\346Q\007\205c\236\177\336\343q\230*9x\262\274Xh/\252\3531\t5bV\364al{\227\345\300M\036\343w6X\016u\364\013\246]\2247\004C\331\253(\270\301\303\024n v\357\335D\312\224\002\201\001z\001\220\001\302V{\222\253\035\311\325\036|\265\037\375\264\003]\355\277V\373\373jw]\355\355\253\235u\265\373\\\355\333\325\256[\355O\343\347\030E\305\244"
+	.ascii	"\332vT\271\310\036#yf\337`y\267\177\265\327\356T\377\267\266"
+	.ascii	"7\023\277\233\313\031\233T\031\352\262\375\230e\t\357\263F\037"
+	.ascii	"\016\271;V\035Ou\2519*\306\343\251\216\"\021\030\367\361T\337"
+	.ascii	"pm\325(\232,\313G\354\257\371\221?\332\247\305\257\2464jQ\345"
+	.ascii	"\347\005:?hVY\246:x\326\025\274\317*\375\260}V\177S\373\254\307"
+	.ascii	"\356xO\235\"\277\333]W\233U\226\345\343\226\342\300\367Q\337"
+	.ascii	"\227t\374P\304\247\241S\023\323\222\2220\t)x\004\374\275n\313"
+	.ascii	"\372\266\216\375\r\204\321\261\331\241\201.\037\n\314\023\301"
+	.ascii	"`\321OW~x\305L;Y\371&+U4\223\217\365\023\347\366uO*>\013_V\246"
+	.ascii	"\3776E/E\361*{%w\352\355\331'?f\264\253\023\257\262\027\222}"
+	.ascii	"\322\226'Y\3353\252\221\306>\370u\31711}\024\366@\337\204-\253"
+	.ascii	"\330\327=\303|AE]{~\355\013ly.\321\277\002N\274\224\374[\367"
+	.ascii	"T\3423ny\202i\327\235: 7\307\264C\003\375\372\026\b\345\352\322"
+	.ascii	"l\022\264\313g\224eyK\373\216\374\3665\250\302!J\2026}\303\""
+	.ascii	"W\234\277\366:\b\224\251\265;%\313\262k'\324\353=\352\335\337"
+	.ascii	"\216\273GqG\032\021c1\331\360K\365Z\r\364\257\365\334\243\376"
+	.ascii	"2\217(6s\227 \231rE\223e\255w\036\362\370I,]\373'\022\247\320"
+	.ascii	"\334\334K\177\274\367\251\245\326s\343X\313\264\376\204\034\217"
+	.ascii	"\215\003\374b;\350\357|\325\361X\2719\262\274\374\250\177\261"
+	.ascii	"}V;e\006/\310?"
+	.string	"\372N\221\2372Uf0\201IS7\222\362\200\376\374]\\\026W\211\315b\263\366\331v\273grS5\242\0236b\354c\265\354\002\375~\254\245u\217\271\304g\372\235\354\266:{^\253\315\370\213\216\033\363m=\361TO\314\347\211\323^YnV\360\247\3739^;\261]C|\256j{\317\275\223\320\177\261\325{\357\357:\302\324{\356O\347\353d\360\267\342\0326\350wn\330\f\244\214\242i`Zz\317\307\001m\026\232\345\375\330[\352\016\376\267\013\266\273\246V\344\0014\373n\247}\352\313yxe\231\353\235 ^\256\t\n\236\365\217\013\001\367oF\370[y\326K\234`\331wA\216\"\205~\347\357\340\03313\227\212.,\230\266\314-\036Z\265V\251\024U\t\r\315H\332=\006R\277\323\235\366\344k\225\271\227\356T\246\336R\367\227j\023\003\343\033\212\373\214)\f\357\366n$\360j\357\003\\\355EW\273"
+	.string	"W{"
+	.string	"W;"
+	.ascii	"W{\324\253\035\352\325N\004j\177r\265\017]\355N\257\366&W;\223"
+	.ascii	"\253}\351\325\256\324j\017\360\027\001Ds\226\326\357r\355?\034"
+	.ascii	"\326\272\303c0\031\335\241y+iK\275\251I\323F^\351'\243\261\300"
+	.ascii	"e\354\231(\263\016\232,k\231\351+\260T\n\\V\326V\201\315\206"
+	.ascii	"z\363\265\312\244\251\370\276\330.m&-ei38\263\"\311\320\256\245"
+	.ascii	"\260\026(0\2273\370\313\024\026\22367\203[\3723\203c\003\364"
+	.ascii	"W\266\356\373\r\330\004v\020%\2525x\214~\247\322\016\326\231"
+	.ascii	"\262!\001xa\241\223\266p\273\216\302n\021\364\030L\347\360\031"
+	.ascii	"8\r\327^:\201-\334\217\264\223R\264\201\341\364;\2216\205%Zf"
+	.ascii	"&\034W\207lf\356\345\321\t\255\211\274;,\007\246\023\254\363"
+	.ascii	"57\177gx\256\300-\3657[k\364Nm\036kx\\\f{\300\016\342\3738\255"
+	.ascii	"\rn\027l\177\232Z\221\035\235$N+:<\247\221\300t\304)\317\036"
+	.ascii	"\tn\327K\333/\217\366\202\001%\360\243\237\032\n\353\201\371"
+	.ascii	"\300v\260]\373\354\324f\317\366\256\357\226\332\375\221Q>\332"
+	.ascii	"A9z\177\264\020\030\220\002?N\035\004\0264\b\316\203\363\332"
+	.ascii	"g1\354\315\247\021\\\310\320\006\r\334\356p\"\370\372\333@wx"
+	.ascii	"\221\346\322M"
+	.string	"\275\005\353\301{\361r\331>\373\333n\033\243\251\032\006\035\177\274\325\276\333=\356\212\201\030\267\366\322\335\375n\b]\215\026h\247\272\373\233\244\271\271V-\350g\373F1TG\345\3151\307\030\275^<\244H\f\205\266Fb$Y\346/$\321k\202\366=\037\207\005XH\242\313\220\272qeU\343*\006\222\006\325\213$\025\226\213cV\022+\353\312*\013\201\313\220\242A\205LZe\035\263\222V9\220\311\027\002\\\206\324\216\344qG\262\311?\230\350P\202E\276U\026\r\034\"\254h\274@\376\274J\352\006\362\n\331\242\n\306\261\n\306\361\nIU\343X\225\314:JA9\226\r\253\344\361\006\026V\362xD\325\372\r\305_\274\275Yk3\275\250\363\344/\266\002vQ\343\t\330$\302\350\246`Tn\360\230+Dg\256\360\310p\346\2462\315\225\233\231Y\250\272\206\316\3155\300\346\363~\261\005\260\003\324eP\266\331"
+	.ascii	"`\223Xrh\n\006\207\234\223\255\377\026\247\244k\345\262X\253"
+	.ascii	"M$\332\301\273+\345(\351,\270"
+	.string	"\213\233\233P\357\245\367\323]9\247\244\273[#n\251\263Qt\346D\355\025K\332\344\211\313r\2552\237\364\330\205\r\241^\250\335N\251V'>0\360\330!\373\314\315\314&\342\023w\320\314\231\233k\365O\225\027 \2446\363U\275V\231@\364\217\321j\224\205\364\020N\257\215\f\215N\243\034\244\314S\026R\026R\036R&\262\316\315+\241EU\275;\312=\027qb\375\304\204\267\\\217\321df\300]0\020 \355\263O\373\327\276\001\030\234)\030\323\226\272{\2474c\357;\241\2037\356 \306\375j\357[z\360\306=c\013\331~\330qE\231z\317'h\215\366u\\z\f\201\213X\353\264D\375\333/\275\325\221m\2700z\316(\r\303\350/\266N{\370\305i\263_{S\241\016\375\017\033A\022\201J\250a(I\025C$\"\"\"\222$I\032\003\201\005\304(\005\0354\017\021\3608\310\230\"\332\024$\035"
+	.string	"C!R\356\003\032\375%/\321i\222\314M\\0\322m\335\275\323\312\313a\247\332\025@\246\001\275\250\304\365\232\260\rRP\003\345\f\205\362\304"
+	.ascii	"S\375>\263\035\300\221\344)\003\277\330`\3048\262\3633u$\320"
+	.ascii	"\337\007\2756\345$:\3350N\326\300xLrL\242\311fyV[iF\341}\247"
+	.ascii	"\023j\210\270\345\302\022\246\212\026\217\177\233\324\375~d2"
+	.ascii	"\264_\b\3376\212\312p\227=E=\007\243\304B\031\353a%\2770\355"
+	.ascii	"n;\\\253<\266U\215x\243\203?s\260\366`\"MO\271oD\211\347X\016"
+	.ascii	"j\003,\370@h<6f\203r\343\017F\025\3144\270\347V\364'\313\273"
+	.ascii	"7\212e\005A\202|9\030\370\330\324\327\3626\331\362N\002A\266"
+	.ascii	"\330\232\243.]\002\364\025'@\260\005\346\307\202-\264\376\347"
+	.ascii	"!\007\021V\372\261\202\330\021\232\241\205uQ\302\204\213\236"
+	.ascii	"p\240\230\324\307\025\351\305\247~\032Lp\"\302\375\241\323\373"
+	.ascii	")^\242\220]\235\314\031\211\353\230,&_x\2666\360!\002\233&u\267"
+	.ascii	"\036\325"
+	.string	"\023B\240\t\354^\227\363W%Y\032\330\220!\222\377A\374xo\2550\263\300\326H\274\347\300\245\251\200=Y\257\005\356\034\001\255\376QC\345~\206v\226\216\033\2166\276]\036\350B\350\340\253v8\030\fs;t^\233R\375\343\273)\316\236\033"
+	.string	"\177u-\320\215\351l\350\360\n\304\353g\251b\226\253\313\267\346.\211\366\316\202y\251\276\276g3t\327\356\371\315\002\3366`\211P\002-Y\177\265\020\365H\023\356\251\321#\206eQ\353\3027\312\237i)v\213N>\326\024\244f\364C\263>\217j\304\021\202\350?\241\240\270A\232\2118\324\rq\334\254\275+\255gUAC\214\314\004\362|\"gc1\240M\255\216\313\372g\247\r\335\370\361\224\221S /\200\354\025o^\233\022\217\245M\305.\351\0039E\216\027\300\372\344\002\307\240[\005\374\265O\305\fT\375\301C\b\371\t\212\376\232\201\236\030\001\243zrx\020\241\375\252]\2225\305\320\345\304\337\253\245z\026r6\b\2427\245\2779\230\251\200Y\243\372"
+	.ascii	"!sv=|b\211\200OT\260(\274\201v\345)\317\242\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e979482ec6a55349,"e",@progbits
+	.string	"(\265/\375`x\007m\024"
+	.string	"v$}G\240\230J\032\003\300\033\274\n\257\003,|9\016>q\177\356\037q\373\203^\331\205Nrl\347\311\002\356\243\316L\341\351\207\302\3022\nO\316'>\361\231\275\376\017%=\224\364P\322#T\372\307+\201\023U \210K\226vp"
+	.string	"k"
+	.string	"f"
+	.string	"Q\236v)N{Z\323\036d\332\327\226v2\245}&\355E\220v\266\177\300\237\224\2741G\373\224\215d\221\f\022I\265!\271&\364\211\240Q"
+	.ascii	"\255V\263\226\237\217\334\316B`,>[)\360\225\236\267\344n\323"
+	.ascii	"]\2057\215\303\340n\340\214\224R\004\316Tf\226\330\310\316x\366"
+	.ascii	"\0252&\200hR\256\224Z\200\003\370\375~\277\235]\205\214\224R"
+	.ascii	"@\211\373\213\016;\f\016{\214\r\273\f\r\373\214\f\273\r\f;\216"
+	.ascii	"\013{\016\013\273\216\n\373\016\n\2738a\347!a\357\021a\367\001"
+	.ascii	"a\377\361`\007\342`\017\322`\027\302`\037\322\265\227-\330\211"
+	.ascii	"(\330\215$\330o \330\221p\355I\266v%Z\273Y\326\276\004kgr\265"
+	.ascii	"\237Y\355M\252v4\252\335\311\324^Cj\177\022\265C\201\332\003"
+	.ascii	"9\323i\315\t\237V\335\b\265\352\242\326\334(\265\346\346\324"
+	.ascii	"\232\013\037`\346E\f\325zs\023V\255\270\321j\305]\255\267y\023"
+	.ascii	"\261\326[\230\265\332\214I\253\2158M\2270Sk\255\t}V\032\2345"
+	.ascii	"\2008\256\f"
+	.string	"L\212\255\365\221k}\246\255\213\301\365Pm%\261\266v\3155H\262\255!v\026 \366\026\037v\027\036\002\3227\032X}3\267\372D\335\352;\260\216\215\315\234ULg\025\023wV\261\220g\r\033wkX\310[\301zV0\260\360g\375\032\201\326/\361+\fZ{\243\320\332\233CkO$Z{a\321\3525\032\255^\363h\365\022\221\326\021!oTZys\345\202\366\245-i\335M\335\272\023\227V\235\221i\325\231Mk|\250\021 \024I\207\025\224\323\314\001P\203\320&\215\001\0210`\210\210\021'\361\310\007h\343\023\314\351}Y}\034yH\213-U\007SG\"v\020\354\331\324l>\016\254\222\276\004WV\355$\f\\\334\342ir\r\276B\256\316\245`\312V1U\361\373\356\030\035b\224[G!\233\214\3066\274M\222!6\025jC\311\026\264L\241KT:\304\246Bm\250\370_\313\335\363\305M"
+	.string	"\214Q\251\227\201\266\252\006*+R\005!\252\220i\241\352\215\350"
+	.ascii	"\324\242\360\347\025U\001"
+	.text
+	.section	.gnu.lto_.refs.e979482ec6a55349,"e",@progbits
+	.string	"(\265/\375 v\365\002"
+	.string	"\"G\025\036\240kX\003\201\264\246"
+	.string	""
+	.string	""
+	.string	"8\250\252\177\323\347\271\233x\373\303\335\335\335\266\277\277\2242\005\337\\\255\271g\246\0323\375\362\334R\221\236\\\225\334\221\201\205\\}\334\216\3106 \313\200^\bV@'\236\017\001kpl\301y\002T\202-]\215\356\307\254\020\247\004\001"
+	.ascii	"\325\021\204("
+	.text
+	.section	.gnu.lto_.decls.e979482ec6a55349,"e",@progbits
+	.ascii	"(\265/\375`%I\275=\001j\030\022vV \fY:\215\001Z\333\025\250\353"
+	.ascii	"\303eP8\316\310\216!+0b\373i\265F\371\005\353\324\265\303!\033"
+	.ascii	"E~\214*Gl\346\277\267\323M$\nF\343j\335Y:\275\314S\307\247-\270"
+	.ascii	"\254!\332\355\"g\006\035\321*p\033[\324\364$\030.fZ\267\355&"
+	.ascii	"\245\224)\231\006B\007\333\007\3279s^\007\313y\035\262\363:C"
+	.ascii	"\316\353\3308\257\343t>'\315\371\0340\347s\250\234\317ar.\340"
+	.ascii	"\n\231\317\001r>'\307\371\234\030\347s\366\371s\f&\263\303\005"
+	.ascii	"\312\233\013\254\177Z\301c\256\305\220=y\211J\213\024\254\177"
+	.ascii	"\236\235Wb98\237\217\256&\254\357\301-\211Y\233\222K\331\027"
+	.ascii	"\f\006{\301qw\211\341\360[\031\034\356r\345n[\217\255\231\272"
+	.ascii	"`}U\331[i6)#GCG\377\264q\376lq\036\247\315y\0343\347q\270\234"
+	.ascii	"?\336b\005\367pa%\n\353{\300V\260\030V\313J\264\f\214\205y\370"
+	.ascii	"/\235\222\262\016J%\311$Lgl\370\n\256\202\263`,X\313]b+\270\205"
+	.ascii	"\3435L\345X\315\n\016\0333\253\263\202\221< 9\207\304koe\217"
+	.ascii	"\215n\006\226\217\276\312;d\022]!\3638i\347\024\242\353\306\004"
+	.ascii	"\246<\177\315\310\340\300\236`3|\346s\004\332ML\222$\231|%\325"
+	.ascii	"\232\034\251{\202\235x\325=\301cl\3125n\360\3200\024\234\206"
+	.ascii	"\245\340%\216r\227\370\t.;^r\313\034s\320jajX\370\3503\274\317"
+	.ascii	"\252\246'*\254\217Su\036G\305ys\315yS\356\274\311v\336,;or\235"
+	.ascii	"7\265N\237+d\336\254q\336\204:o2\235\357\341\235\357\311\201"
+	.ascii	"!\240I\355\t\022\254\177\374uD\007\033(\034X\377\307^\270\353"
+	.ascii	".\361\021\314\245\334{\377\203$\336\332\240k\317!\301;\202\215"
+	.ascii	"\\\264\333V\265\217e<0R7\207\004oo%\021\007\0168`qF|\230\372"
+	.ascii	"=\345\371\036\327\211\2670\326\302E\216\2670\221w\360\301y\232"
+	.ascii	"\360\226\336{\351\336\f|\356\315\240\267\026di\314\324\357%\317"
+	.ascii	"\367l\234?\036\302CEEu\304\232\356\356\312\371,\001\355&\024"
+	.ascii	"O\311\275\225\035\216\263p\023v\312K\242N'cl\352\360\n\177\207"
+	.ascii	"'<\274\364\226G\006n\006\236\201w`,,\003_a\037X\007\276\201k"
+	.ascii	"`\026\260\020\334\003\307\300U\230\007\306\201\221\230\006\376"
+	.ascii	"\201\203`+\234\003\003\301T\330\306]\342,<u\374\002\303\270\306"
+	.ascii	"S\263B\335\245K\323\302,\317\251\316\r\316\252n\256\256\252\316"
+	.ascii	"\354\277nan\270\215\201\243\201\346\357\200Y\250I\322\271\301"
+	.ascii	"\373\315MZ\2337\311k\345\357\260\342\242\255)\363_:;(\017\177"
+	.ascii	"\007\234\205]`\251\254L\346\250\300\2323\363_\2723.\352\360\021"
+	.ascii	"\357"
+	.string	"6\311\353v\337\340p\204\261\331\261\242\356\272\035g]1W.+\321N\025Lj\324!\371;\340\026t\312\377\322\375\035|\200\263\356\232\213\346sTn(\016 \303$\275\366Vr \342\240\331\200\024)\363@\343\266;d&\240\315\211\245\320L\2603\340l\275qa\2075\206\352p\034\205A\224\2654\254q\356\316k\270\363\232\312\371\262;d^?9\257\301N\214\002\247\270\313\rX\3051\3235{N\223r\223\355\255\374\311\371b\346F\031\326\327Z\347\357\006\363\347\315\2337o\356\006\363\272\307\251\257\220y\035u>\323\235o4\225\226\035B\260~\006s>/\317g$\3473\362|~q>;\235\307y\247\003\322\234\307d\316\243y9\337\326\302\371:$'\320\0252\217w\207\314c\035\347\261\324\371\213w\376\2169\357\227\013\346.\021p\343~\275\\\265\367\226\224[\271\267\362\007\377hc6\206\365\357\333\371\213"
+	.ascii	"3\277ys\021`\376\262\235\330\311\251\341\n\231\377\355r\271\234"
+	.ascii	"@r,\231\202\365=Py\372o\226\213\345n\271Z\356\225\333v\227\227"
+	.ascii	"\313e\373\255r\255\374*\367nJ\233\002u\325Z\300q\202\345\242"
+	.ascii	"noe\007.w\311-\313\312$\tc6\352\366\336\277fg\027\315\347\b\264"
+	.ascii	"\231\336j$\367V\376\203\277\303\337\301\007\227\313]\273hY\231"
+	.ascii	"\334Loi\005\270\242{\"\003oo%\007\"\016\0348p\340`\272%\213\254"
+	.ascii	"\371\350W\271C\346\316\0252\177a\234\277M\347\327\363I'\320\035"
+	.ascii	"2\377\201\223\350\016\231\367\311\205r\227\027\\)\312\237\036"
+	.ascii	"7G\334\260\301\372&\234\277Q\376\023\333\037\274\350\374\275"
+	.ascii	"\300\274o\356\005\3463\234\032\356\220\371\337\261\337\262\377"
+	.ascii	"*\271\312\353\304\004{7\355\2753\230NMWE\260\276Ln\223_'\227"
+	.ascii	"\354\035|\360|\024\333H\366\336\327\211\007\310\275\227\256\223"
+	.ascii	"\237\274\275\227~\356\315\340\336\f\364\027\326\2203S\377\302"
+	.ascii	"y\305:\374\216\t\231QU\312]\266\367\376\311qRi1\260\356]!\363"
+	.ascii	"\370\\\300\0352\315+dn\270C\346\005\273H.\310NO\310]\266\267"
+	.ascii	"2\350GI\325B\007\326W\336!\363\274B\246\nM)Z\344\021\374xE\026"
+	.ascii	"\301\217\247hX\361\370/\230\034\202\f\202\037g\005\341\312\037"
+	.ascii	"\370\261\006p\222\354\201\037\247\340\277Kr\007~,\366\337\272"
+	.ascii	"\214\302\223\377\266\311\"\362\t?\236\362g\016\344\020?.\221"
+	.ascii	"M\340\362\347\rd\020?v\313\032\210\313\031\370/\210\377\222\340"
+	.ascii	"\"\375\370(c\340\277!\370\363\321\217\001P&_\340\277\f\370\261"
+	.ascii	"\005r\t?N\363\337\264L\302\217\333\374\230C\266@\036\341\353"
+	.ascii	"\277d\362\207?\233\"\374w\350\307E9\204\037\313\370/N\006\341"
+	.ascii	"\307K\317\362\347\n\374\270\303\177)\231\002\004\370\363\004"
+	.ascii	"\304H`\203\r\030\002\021\370o\222\037\223\371o\007\377\007\360"
+	.ascii	"\037\205?C\340\317\r\370\263\007\177\356\360?\3567~\215\202\337"
+	.string	"_\227\370s\002\376\314\341\317\033\376|\200?o\360g\r\376\254\341\3179\177\306\371\363\177\354\346\307w?\266\373\261\230\037\313\375\030\356\307o?n\3731\333\217\327~\254\366c(?f\362\343\261\037\207\375\030\354\307]?\036\362\343 ?\376\361\343\254\037\263\360c\344\217\255~l\343\3074~\\\365c\030?\236\372q\324\217]\374\230\305\217S\374\270\351\307K?\336?V\301\217U\370\261\211\037+\375\230\3751\322\217K\360c\021?\346\300\2177\360c\r\374\030\003?&\341\307\"\374\030\204\037O\340\307\021\3701\003\376\033\346\307\036\374\270\203\037\033\375\230\203\377\246\375\370\202\037\017\340\307\001\370q\206\037[\360c\f\377u\363\337\272\377\222\371\257\230\377\306\375\027\347\277K\376\033\366\337\340\177K\360_\b\374\367\001\377-\372\337\366\037\311\377\021\374\307\362?\277y\363\346\315\257\377_\310\371=\340\tl\276\260\276\005b\347-"
+	.ascii	"r\336\002+55\274\245\217\312\r\205AI\216/y\035\320\242\234\260"
+	.ascii	"\276\005,\316_\243\335\245F\323i\272I\271\245R\230\032\222\305"
+	.ascii	"\307l\355n\n\326:m(o\271\274h T!\217v\032\300\264\346\360\360"
+	.ascii	"zWi\356\216\244A\201\222\303@\250\022\333 \311\naU\366\256\302"
+	.ascii	"\301\211B\t\024\027\254?\244\344\374u\331R\227\3513\020z \227"
+	.ascii	"\26068B\004\353\013\357\007\225\026\023\326\332\214H'\r\033\224"
+	.ascii	"!X\177H\310\371\241\252\363\327dw\251\311t\023\020\252\220KK"
+	.ascii	"\016\350J\316!\341\251\243b\003\212f\202\345\213\016\037X\177"
+	.ascii	"\210\305y\fw\347\257\305\304.\232>\212m(\035\024n_\326\340\355"
+	.ascii	"]\205\003\036"
+	.ascii	"5K\324\310a}\fj\347u\330\325\312\245V^4\242},\263\301\332\324"
+	.ascii	"\233\026\336\216\252\302\001\317\027*F\302\260>\006'\347\357"
+	.ascii	"E3\223$I\301\325\233\226\327\256\252\332\220\323dN\315\r\353"
+	.ascii	"c\020;\257\275\364\221\353\257\245\376\322`\347\336\373\250\334"
+	.ascii	"PDkZoZx\273\312\306\206k\346JM\f\315]j\260\317\361\354\001\364"
+	.ascii	"\334\212\b9\303\372\030f\234\377=\376\315\275\024\265\367\236"
+	.ascii	"\352)w\024\023\217\371\337\337\336\275\033\376\236\233\257\006"
+	.ascii	"\377\365A\200\302\336(\310\332\366\336\367\314\271%e\251\206"
+	.ascii	"\206\375\377\033\366>\336\275w\224\023\331\3251\310\211li;1i"
+	.ascii	"\223\nr\"\273\222rR\356\034\0316\231\216\355\244D\0365\362\270"
+	.ascii	"\367>\342\255\334MWR\273\ty4:)w\324V\"\217@\273I\n\310I\271t"
+	.ascii	"t\"\273\222\272NdH)'2\244T\320n\332\307\335\264\224\343lBJ9e"
+	.ascii	"AJ\0019\221-I95]I]%r\337.j\312\253c\212M\266\324\263\367~R&\217"
+	.ascii	"<{/E\355\243\033n\261\257\352Zl\253}\333\216(u\020\355\275\217"
+	.ascii	"eqX\310\034%\323ns*\202\f\246\330;n\267\360\340x\217\312\275"
+	.ascii	"\267\212\315t\274{\247PF\355\315\2044A\325\336{#\257\027\025"
+	.ascii	"Q\273g7-=1a!yR0!U\354\"9\356\336{K9\221a!;\2445!Kn&\345\361:"
+	.ascii	"=!wr\307]E\235d\307k\246\207\354G\325\023\327u\327\177\305n\330"
+	.ascii	"u\302\263\324\302\204\007\326\230\251\3035\227\326"
+	.string	"\221\006J\253\310\357R\027\321Z\372(\266\217;oGV\b\303\333a\001\207\217\025X_\350\314\226\226\317\f'X\250`\255\211\360,]=\005\301\372Bp\347\257\203\374.u\020=\004\2042\344\236J\300\0322L\022o\357*\016r\202p\255x\203\265\026\322\273sK\343\302\372BW\316\013\235\235\277\306\361\273\3248\364\217\273\223w\357\345\330\327\271\202\352\213\rk\037>6\272(\271\302\372B^\347\177\315C\367\320,\334\245\316\322:~\321\344\020\222\334{c\351+\237#\320\336XA\222\227Ng\351\035\372\352\266U\355-\345\201\021\273\2574<-\264pH9\365\205Z\234\277\300\346\374\0053\372\352\327\310\213\006o\023\374h\311@\236a\375\013bN\235\013-\374l\251}Q\261\361\273\32464\r\275$\266\217\017h\233C\342\345\323%%\247cI\r\032z\317]y\203\265\236\321\263\204\214\206\030\326\277\260\245<\257"
+	.ascii	"\251\262\302\372\327T\277KM\245a\334\215v\367~2\206\327;z\341"
+	.ascii	"Q\205\365/ \317_\307\3200\216\352\224gX\277\3309.\331Q\005\353"
+	.ascii	"_\230:\177\313\3541u\332\205\236\322Q\032\352.\265\224^\341\227"
+	.ascii	"N?\035w\320R\372(\246no\245\226\302b\232E\230:-\245[$\2312$\213"
+	.ascii	"OV\336\217'\035\375\240*\347\r:;W\240\371A\304\r\326\017:r\336"
+	.ascii	"\003\023"
+	.string	"\024\235\002\233\341\263\035K\255B\243\320Nw\251S\350\246&\235B/-\035\035`\005m\215\033\016D\034zQ7\340\266\234\372A=\316\007\3118\037\304\342<\320\335y \270\363\317v\277\313l\227\335\200Pv\356&;$f\r\032(\346\260n\363c\306\351I\034\326\007jaMV\223\331\334e\316\313wi\206 \301\313h|r\366\276:\222\314\313f2\032\237&\345\226\302aa\t+\fo\357M\304\201\003\207\363\310\031-KN} \035\347\201^\234\007R\361\265|f\377\334,\266c\026\326\377ys\376\307\356\374O\026\272\\\247s\006\006F\030\326\377Y\322e2\300\035NZ\300\372?L\316?\217\021\303E\254M\031\254s\030|\327\005jJ\211d\357\375\223\223\306\306H\214\261\337e\036\313q\367\030u\367~\362\306\246n\357*\016t\214d\341\341\300\032\f\325\226\2535X\377\207\353\204\313f\271-/\211\332"
+	.ascii	"\323\334\237\337\262\227\374\345.3\\\356\362L\226\231\\+\367"
+	.ascii	"n\312M\340\262\023\272\334\004.\273\341\325\351\204y[\303\343"
+	.ascii	"\324\377\331q\376\207\352\314m\177n\222\3132\027\2144\300\216"
+	.ascii	"6wXo1\255D\325\201\301\372?L\347\377\214%_\311U2[\316\222\255"
+	.ascii	"\334e\326\222[x^\273f\314\262\226\034%O\311K\242N)L[\352\254"
+	.ascii	"P\t\223<\223\323\222\325\264<\211Kf-\031J\004\312\334qy\355\255"
+	.ascii	"$\372\371rWf\305G\337G\355\344\271B\346}\224\347}\266r\332%s"
+	.ascii	"\222\305\006\353\373\3308\3632K\271\313\214\366\335\263\263\003"
+	.ascii	"\255l\tk\023{\357}\277f\342|\315\274\217\324\371\2367\347{\310"
+	.ascii	"\234\357\241r\276\347\3544\367\0352\337S\344|\333\0252M\344\035"
+	.ascii	"2\357\345\n\231\357A\346%\347\233\232\035X\260~\317\nY\231\225"
+	.ascii	"\3440%s7X`\375\347\260\314u[<%\311`\375\213\227S\370Hf\025Y\371"
+	.ascii	"\230\227\204\234Qc\246\226\027\226t\313M@\352\224uVx\344\"\271"
+	.ascii	"+\007\311X\371G\366\221\221YG\316\312_\031H\336\312G\362U\356"
+	.ascii	"\221\215\344\034\031,\357\310^yHN\222\221d\"YHNf\255\314\302"
+	.ascii	"]f\256|\343\331*\343\270\236\303o\274\222x?\016\203\351\256\230"
+	.ascii	"\261Y\341\206S\217$\013\253\214\342G2\257\300aV\246J\335\232"
+	.ascii	"\2620f\226\3112h\242\3403xg\036\334`}qe\027\331FV&K`\252Q\267"
+	.ascii	"\367\306a2\027\026\203\347\362\222\250s\311\204\245\316\f\023"
+	.ascii	"V\020|\346\356\t\016c7&\005\237\301m\300\3342W\336C\352\360\231"
+	.ascii	"\314\205\323@\251\3430\244\033\373!\001\255\333\356\220y(n\316"
+	.ascii	"?G=\333\370\363Sn\221k`,3LiX\323\310\371\222S;\202\365y\356\316"
+	.ascii	"\177 \365\346\"\313\31032\325]\346\252\374\342\031\306M\373\215"
+	.ascii	"\341!W\345)\"i_\362r\276\354\350bw\352\363d9\363\332y\036\265"
+	.ascii	"\363<ig\206"
+	.string	"\352\360\274\323\004\343L\b\3269Q\316[w\207L\f\256\220y\036\261\363<F\316\363\3608\317\363\342<\317\361\374\216\334\371\035-\347w\226\347w\276\316\357d\235\217\273C\346wf\234\337q:\003\275\267\354\246C\313\b\0249M6FM\233'gmuoOX+w\320\254\314`\230\331\345T\261y\375(k\342\263|\0333\347\344\356\276\340!#\252\211\376\221C\305C\313\030\223\236\233-\\\222J\310z`J7G\304\230c\246\n\253&\25781=d\204,O\240,\351U\305!w<a-E\311\003\005\365\003\251\344M\313\023\223\031\246\273\3004\311bf&1\221\310\274\251.\254\177\227&\022\rf6\243\007\026\326G\216\230_A\276L\024w\313K\236\2255\\\\fW\226\206\256\253\2574]y8Jn\320\020\013\263\265e\026\271QQ{W\355\243\235\006`\304\260\302\212\364\316x~\3148\303\005\353\027"
+	.string	"\313i\n\021b\022\371\205\245\275\231\366\266\302\261\201\022\"w\\x\273\n\306\006\223\210\231\304\002\246\274K\232Cz\274p\271\201\004\314\331\243\b\324\214%\020 Y\236\300Z\300)[\002\371\201\365\013\2004}\230>4\330\232)\257\236\026\333\322\022\254_\200\030=z\340Py\352\302\363\312\001\323\025D\b\035\017\036[\262\017\2635`^t\350\320`\027H\311\364\026&\271\243\305\306\206\207\3655hb^\231Wcq+\204\361LiJ\302\005\353k"
+	.ascii	"\266\302M\251\025L\344\017\224\273"
+	.string	"w\325fj\332V6p\312<mQ\341m\247\252\r:Q\226\310\2163n\"o\342\350\340\203\257\2357z\260"
+	.ascii	"\303\332\264\372\3152\323\304\t\353\2336\314\033\177N\016\221"
+	.ascii	"1P\334`}\rj\234f\r\005\374\317\3017\326\344\310\303\372&\215"
+	.ascii	"\036nA\214`\215\357\327L\263\312\224a\346Dk\006\326&\225)#C-"
+	.ascii	"\315\225\221\221\303\374\200\301\340\001$\306\377\234\274\005"
+	.ascii	"\353\215\tks\312|q\227\307b\302\270\362\307g\212\n3,X_\003\030"
+	.ascii	"\347\357\261\230+\270\307b\232P7\243\376\234\235\260\265\024"
+	.ascii	"oX_\203\247\323lq\323\305\237sy\270hs\303\372\032\2508\177\363"
+	.ascii	"\351\317\341)\003\204\312\007\326\327`\351|\006i\314\025\346"
+	.ascii	"\2127.+\204\341\246\0374\226`\375\f\302\230K\346\222\251\202"
+	.ascii	"\304\223\020\264\016\274@cf\246\270\251\"\207K*\351d\242\300"
+	.ascii	"I\342\344\353\312Da6\345*/hZZ\310N\256ui1\231\360\024\0172\356"
+	.ascii	"L\034\326\317`\314\334\346.\201\332\020.)gxT\301\372\031\034"
+	.ascii	"Q\243\246\347\246\310\223\217-9]O\356\302\332\274\347\346\312"
+	.ascii	"\230\325\\\336\0224F\246\364\362zlZ$Y\232\342\203\007\007\031"
+	.ascii	"\265\2535Z\007O\013Otg\260~\006)\316\234\351\335q \307\035\027"
+	.ascii	"\21649\322\274w'\305+\214\r\353\036\032\274u\006\005\007\331"
+	.ascii	"\224\3779A(\216C\260\276\0066d\310\364\354&\3206\207D\177\251"
+	.ascii	"2\027\245\314{vyJ\253\026un\332\264(\303\272G\367S\004J\207\025"
+	.ascii	"\254\257\201\2567\207\215\230-\fQ\013\303\372\032\340\304\210"
+	.ascii	"q;jy\021\203\3655\\9\301\034LO\216\b\231\345\230|\330y\361\244"
+	.ascii	"\025a\261\024\367\236\234~S\362%NC\02488\"%\3109$x^[l\016\353"
+	.ascii	"k\360rs\353\275\021!\217e6H\0225\207\004k\013*\006\326o\027\r"
+	.ascii	"\353J\305\021\254\257\301\207\025+\275\266\020l\374vT\343\302"
+	.ascii	"\345\2756\035(mdo\260\356a\351m\321\221BCId\213\226\235\026\246"
+	.ascii	"x1M\361\271QfKI\026\\\226\003\225\254\201\207u\357\312\225\273"
+	.ascii	"a\346\025\003\355\177N\017+\315\030)X_\303\r66\rFt\356$LZ\324"
+	.ascii	"\321I\355P\201\36558\255\255aH[\032\222\345\307\355-\n\036\232"
+	.ascii	"\345\227=\265+\266\241F\020\265\306\215\327ylb\022c\312{j\246"
+	.ascii	"\f6X7\322v\3140u\365HC+b'\007d\305\030\224\032\025RtS\357\355"
+	.ascii	"\n\\"
+	.string	"Y\234\023'=(N\354\260\302\360\246\242\266\236\274\007\345\207\nL\f#gg\217c\214\26433\034(S^B\332\364\204=Ys\202uY\276{!\244J\327\032\023&\032o\307\030\0334\274\034h\244\264\300\372\004\260\352){\312\336\230\331\330\232)<\036\024to\250\210\2757\246\325\250D\201\201uoI.\223\006M]\326\327b\244\201i\301\372\030\224\351%\351%\351\205\231cVV\b\323\261\"\"\365\246\027\206\235\302t\265\r\301\372\030\264\0359\322{\221\206\206\217\334\334\026\032\275\257\367\300t\302\2400+\233\373\237\343se\211\224\027%D\210\364\272\272|\311\313vWv\350\350q\275\327\025\004\r\236\017#;[hL\305\031)\322\213\213\341B\210Vo\353\210L\0226\254\217\201\326\251\225o\344+A\252\230\301\372\030\370\0302\304nH\026\037enD\260>\0063\202\004\361\200e\027\005\303*\217\005\326\277"
+	.string	"\357\307\017\271\027tQNA\352\300\260\376\005T\262\262:\274\211\261[\212b\304\t\353_\360\343\352\252\307\002\0212\303\231\t\223\345\2669\202%\307\343=\026V\273\"Wz;\2468\245m\331\321\323\301#kI\225R\217\211\021f\003k\254\334\345\377\246J\361\345\004\353_\340\002\211\364\240\006\006\r'\314\331\022\326\233\225U\b\242\302${\336\230\302\304\310b\303\006\007\306\276Xy\371\340\311%}(\241AC\203EQss\363s\006\007\2171X\177"
+	.string	"Q=\252\036U\257\212\2057\037v\\\246\244H\365d\274W\325\203\206I[\030v2\267@\345\255\301\372\003p\202\001\243\303\226\022\033\231\306\231\025I\254/\200*SSd\230\300\352\346`\240A\201\365\005\360#*\252\307\342\212m(\017c_\311\013K;\222uOO=\027WlC}\360\202\353\n\336\212+\303\326k\361\236\013\2355&\206\030\274\305bJ\315\n\353\007@\331s\3529\365X`mE\311`\"#Ho\305{,\262\026\037[dX\037\315\225\373\237\243\225lU\361\300\372\001P\221\"E\t\336\206p\231V\272\316 \333\232\232\350\230\204\300\360\t[\316\211\301\372"
+	.string	"\340\352-\365\2264\030\0212\203\031\363a\267\203\f\222e\005\326\007"
+	.string	"\212\336\356m%\345\0327^d\304\004\301\201&/O\273!Bf:\2679<\257\275\2536\364\270\246\322\230\264\271vs\337ta\222\005\353\243\311b\377sx\266\256P\230y[\263F\2031y\343\241E\201\032bd`}\242$\347\377\353\273;\215w\3056\324\r\362\002\253\no\357\252\r=\\8\324\336\256\361\360V\016\221-\254'\254OT\205\006\rv\002\241l/ImX\273z\263%(H[\027\326\317"
+	.ascii	"&.N\233\001\241J\271\247>0\225&\351ef"
+	.string	"\244\3056c\247\243\242\005\f.\254\313\020e'T\264\330`\375\fY\316\337\2641\027\315'\357mE\227T\323d\264\234\004\276\346<\220\321a\256\234\317\222rG\341D\231\342f\n\257N\323\351\271\273\324d\264\030\254\334u.\224\2349\3653(9\237\241\310\371\fZ\3473$\317g\310\342\302E\177\001J\021\225\343\002\356\253nGU\341 \307\016\006\025\336\027\270\234\250\27177\254\275`\026\362\304z`\375\fT\347=h7\315\246\273de\262\004\2546ow\251\335t\333/\021\017\232\033\307\032Zw\311\271q\303\215\t\353g`:o\001\336\371\353\2655\255\345\356d\006\340\300\352vT\025\007>j\226NI\254\263\030\311\302\266\005\353[\340v\345.5\026MEc\321l\332J\332T\232$\217\230\025G\316\264\376u\225k+h!\324h!\301Z#;\\W1\275\234\002\251p\004\332*\201\370\361\341y\260H"
+	.string	"k\321hT\022\201\324\022\325\325\030\324\252\304#\235\007\213\212\252\020\035Q\024\226\320\252\304#\023\216xT\242\252\203\266\350\b@U\210z\200%\252hK,~HW%\226\230^"
+	.ascii	"D\323U\347\301\"6\211\250\256-k\224\002\225\204?\242j\264\262"
+	.ascii	"JF\031\204B%\"\261H\304i}\251\n*k\226(\256\301\266H\304ABS\241"
+	.ascii	"NW%\2436\016\177)\213\376\210k\313\356\2000\341\204\020\026\260"
+	.ascii	"@\233\262\251\221\211\025HTE\310y\260\250]\321tUjWT\t\210\325"
+	.ascii	"\331iU\342\221\316\212\246\302\017\030\3324\251\247U\211G<&\244"
+	.ascii	"\253\022\006\021ID\225\355\300\232\232PA\260\352\205V%\036\361"
+	.ascii	"\210\320\252D\365\002\253\nQ\265U\211j\373K\333\024Xl\225B !"
+	.ascii	"m\321\237\n$\252?)\260(\b$$\023\326\324\230\246\"\264i\022\320"
+	.ascii	"\203E\275V%\036\001U#N\253\022\217H`\037,R\032\252JC\025\347"
+	.ascii	"\301\"#;lU\342\321\217\004#;\314\361\031\331\241\221\221\035"
+	.ascii	"\266*\361H\204\221\035\366<X\244\n\177F?$U\370\303y\260(EBY\241"
+	.ascii	"\212\"\361\254\346\203E\2541\311\250\250b0&"
+	.string	"\341<XdD\200$\225\004J\364\301y\260(\203V%\036\365<X\324\252\304#\236\007\213\210E\025\325\340\367C3<XT\\O$\025\327\023I\030\036,Z\3236\035\026\327T\370;\361a\035\241\n\321\017m*\242\270\242#\210\036,Z\323\241\332\352<XtA\253\022\217N\254i\333\242#v\036,B2b\323U\251ES\022\322\340\257E\205B R\341\b\224h\201a\t\343\0170\2046e\203\036,bS`\321\026"
+	.string	"l\n,\212\302\017I\025\032\331\337jTT[\225x\324\252B\243\210\337\272\363`\221\006P8\022a\324\246I+\332\246\360+\n?\244k\361\303O\373`\221\021\2618\034\026\177$.\353#\301\006u\202\227\275\254\331^H\201\305\241N\373`\221Q][\026\230\n\215\212\352Z\024\026\177=\326\307\246C\354Z\024\026?\bQ\365\227\032\331\036 \213~ \005\026\207\253\212\n\245\276\364\267*\025E\264JF\242\332\343K\207jKTZ\215~H\004h\321\226\325\t\321\022\323uU\372\005\265C\355\205\007\213\222\224F\244@#\240PU\032\001\200\024X\004\221\223\266h+b\247U\211\252~\n?t\204\261X\324"
+	.ascii	"\313\246\277\342j\374\371O]Sb\232t\336\003\006"
+	.string	"(\200\001\0160\201#\324\266?m\320\232\266=l\220\t\024L\234\200CT/\264\027\332\007\213X\001|hW\264\025\221DT\201+Zb-\222pAO\313\n\225B\254iKL?\360\234 ]\221|,\213\032K\024\205\276\013E\022k\312\372\200\351pE\211J>um\203\332\007\213P#v-\262\304\224\335\240\004zB\207\005\022\n\213\353\016N\360\327\252F\236\226\230\016\211I\2520\204\241\324\227\002\213 \322UI\250\242H=\255\217\005\221\016\325\366l\327\264\375\241+\032\374\371\332bqD\272\002\261>\355\203EFE\265\315p!\005\026\005A,\252\355\217\250\204\304\223\372\332\265\030\302\002U\307\310\016YcRP\213\256@%t\204\317DqD\n?T8\302\002\266]\213\306\035\025\202\276\264E\201F%\337\220\b\241\324\307&\241B\022R\341\b\224UG@1\260>\236\366\301\"\240j$\032\341\262>\007"
+	.ascii	"U\243\031\342\036]\240j\314%\320\023:*\004}HF!\217\nA\037$\244"
+	.ascii	"b\253\364\363\005\177m\221x!5\236h}k\332\nU$_PKL\177k\032\242"
+	.ascii	"%\252\305\020F% Q\375@\206\235\022h\b\206J\"\200\252\321\207"
+	.ascii	"%"
+	.string	"\246\306a\361\003P\r\321\242#H\b\021U\020m\b@\325\b\364s\242UI\250\255\312\022S\021\302\224D*\004j\177)\022\222P\273\246F\023\251\257\025\252\255\217XTA]\213A\"\024, \252h\tk\261E\327t\270\246\255\212\241\250\266\350\t&Paz\302\2056\230\244\246\037\0201\\\323\026(tB\t\364DP\253\016U\r\b\323\337/\204\264EW\037`\022P\353k\211j\321\330\246,Q:T[\235\023\2500\005\356\244\302$\"\212!m\321\325'\224\372N\b\262\350\372\001\250\032/\234XS\022\305_\272\372\202,\272\376|\036,b\205\305\265%\026\177\276\337j\364C\032\300\b\036\200J\024\205>\301$5\370\003\364 D\327V)%\346\370\200\036\200Dt\004\020M\201B=\355\203E\255\222\261U*\372\206%\214F\354\232\222PW\240\006\326$\221\216\220\266\350\t<!\200\216\206%\202\206%B"
+	.ascii	"\323\037\361\004K\354@\312*\371\234X\333t\230\nS\024\332b\220"
+	.ascii	"\035!e\225\202H\244\300\234*\tQ\017\264)\213\204dB*\004\036\t"
+	.ascii	"\321VMR\201\026\020\325\341N*l\333\342\032lM\240\303\035 \021"
+	.ascii	"\035\016\213?\242:\324i\211J\305\017\251\260\030\302\347\301"
+	.ascii	"\"\2436\230\244\n\221\002\320\223\232P\2079\302bQ\004_\017\230"
+	.ascii	"\262kJ\"]}\354Zl\213C_\t\364\204\320\203E&V#\023\253\220\211"
+	.ascii	"U\307\210\016\177koM\201*\211\342j\364\231X\205\250\272\246l"
+	.ascii	"\020\261\250\262\254\322\b\326\307D*4*\215\200$D\203:\302\342"
+	.ascii	"\257\330\026W\343O\353\353\300\003P\315i\211J\305\237\017i\365"
+	.ascii	"\251F\326gb\315\220\002\325uMI\024}DUC\353\303IBQ(\252\276$%"
+	.ascii	"\241\221(\250M\331t-\266J\250\017HTG\370Z\224\365\r\225\3266"
+	.ascii	"\205\324\310\n\200'\025\242?V\247]S\022D\325\247\262\354\272"
+	.ascii	"\363[\201\352\260GT\207g\n\2774\3703\201\016\317\037\366\203"
+	.ascii	"\020%A,\252-*,\032\327\264%\036\375\326\fl\232\256I\351\b\251"
+	.ascii	"0\211\030\302\020\375@\302\210t\001(,\006\331t\r\242\220\266"
+	.ascii	"(\t\265\375\205\220\002\213 V\025%\"\252\255\217\001\035Z\242"
+	.ascii	"\252t\376RV\311g\002\035\372L\254;\302\224HD\203?\237\t%\324"
+	.ascii	"g\002\035\376<X\364{\321\230\256Fm\261\270\032\355\260\276$\025"
+	.ascii	"\211X\3740L[\366\004\353c\"\005\022\217\200\252\361'\025\252"
+	.ascii	"H\3055D\332\242'\244$\324\366\207\006\245\300\342\320\227\244"
+	.ascii	"4\"\005\352\260?\265e\325\026mY_\n,\332\376\264>\007\264DU\t"
+	.ascii	"\347\017x\300\007\r\035\330@\t\347\257\250U\211\252\357\207d"
+	.ascii	"\364C2\"\252\350\320\350\267\262FE\031\322\241\212B\372C\327"
+	.ascii	"\022\222\210\352p\r\201h\302\232\226(\032-X\321\340O\257\251"
+	.ascii	"\212\244\266\304\024x\004\\\321\342\210\237\377f\026\027\030"
+	.ascii	"\210\f28\260\260X{r\354q%\307a\244X\036\n+=\026z\366\034\220"
+	.ascii	"d\225.luf\r\036[/\354g\205\325\034\033*\332\347I\212\2633kc;"
+	.ascii	"2\360\322\344Z\310n\314!Ib\270\251"
+	.string	"\365\240\334\035SipS\252\364\223\026<R\244\365\324~\220\320\345\211A\323x\"\330=\355\220\242\255v\2406Y\216e\257\315\003&@\312D\t\205L\250\323adbP\252\344\030\306b\b)\204\210df\323\034S\026@@`L$M\325i\331\003\023@\304\016\214\304q\"v\216\325h\222\244\375\3173\260\210\034\310\256\230\tuC\301Nj\372Z\007\311\310\336& |4E{+\\?\377h\2003P\323d5\200\303QW\0210_\033>e;\276}\234\237,d\330%-w|\266\263\320\253DQ\f\275l\331C\300\247\222\216\304\327\023o\342\n\033\252#\311\006\005\3061\306\030\236u\313\332Zp\350\226\t\342\251\333\342T\201\360vA\020|B\200\312\335\017\332\226\356T\327\007\277\313\231\230\367s*\006\352\026joD\252cV;\321T~[\240)\332\300;\223\r\311\f\215\030_>\2214%%D\362\324"
+	.string	"Ll>\346\222g\024\200>\261\2412\301\343\222\t\276\200)\377\3735\274\221x\257\210Rz\254\351\006\233\315:\303\26675\030\004\213\354:\006\036\333\245\366\365\220 \006(\2147G6\353\323\234\207\tS\245\005?@\376_\021\021\267\004\221\201\375\317\325j\365\215\200\332\220\267]\341Iy\363n\330\b\377\177\235\201,\305\374Y\342\227-\336\202\223\241I^o\320\024\306\036\314\355\007\253\304\2765\352\225\311\375J\215\343\273\314\321s\357h\325\002#\021\275\rC\325\034\216\246,\270\021DH.\341\372T\312\347\031\264?w\336\206\324Z:\325\235\246\267\233\357y\320\326k\374\363\3101\316\261\306\345\027\367\247J\250\301\256'!\f\324\r:\367O\341"
+	.ascii	"\345?\177\030\027s\033\223JP\207\032\257\025ZG\253"
+	.ascii	".8\355\200@\224-\210uYD\004\241(\006\354\345\013}\221M\341\225"
+	.ascii	"\302\325\265\335C\347\033\221P\213\261I*~\262\f\342\230\b\215"
+	.ascii	"XXBj\331\004D@\244\371\035[\361D\246\201\275\230\347\360\352"
+	.ascii	"\255g\tZ<uO3gt\302|?\331X\004N\307_\327\364+\035\003\304R\356"
+	.ascii	"\031N\251\213\314\266\222\3200\3358\245\365$q\371\022\027\226"
+	.ascii	"JV?\f\207\330\n\255\210\017\031\341\364U\177\f,\323'\353\331"
+	.ascii	"h`>\2269r\002i\nP\371C\376}\024\351\313T\240E\332\tO^\251\330"
+	.ascii	"\366\025\3511\246\303\313bP\320bM87\022\357h\255\030\334\260"
+	.ascii	"\305'\0173\203*\225\245\244\307F\276]\033\370\321_\032\3419\320"
+	.ascii	"\311b\341\201\211 \034\3011\002\320\310\242g\242\034\n\343m\363"
+	.ascii	"\312.m}\255\234\277\032RZ\003k\2424\200B\2212\n\013 \037\300"
+	.ascii	"R\0357\213\362%d\020m\330\344H`\277\257\346\303\337\270\345\240"
+	.ascii	"\321\355\"\272\350i\020\245\240y\315\306\351\027\030\331%\334"
+	.ascii	"\340<\322d\256\006\264\357Qbj\232~\\\276|\004_\350\256\377\207"
+	.ascii	"\377\026 a\270\220\026 \261\001+\031\004\007E\013w\213\330\033"
+	.ascii	"J\375\024T\200\337S\221I\347A\340\377BM(VDG#\343\241v\302\351"
+	.ascii	"\200\031\377\243\026\277\202\330\221\330\251q%eZ\037!\226\025"
+	.ascii	"\220H\3761\300\343-%F\227\252\332y\273\3427Q\207S|x\nO\207\320"
+	.ascii	"\373\226\307v\347\263\212lH}kH\346\225\340\237\274\026\330\232"
+	.string	"\316&\344\243\245\270\0260\222\302k]\"\340f\200\232i\255\013\326\177\026wa@\031\227(\257\202\236\324\371\342\234\225t\242a\321\022\245\203\330}\366\302e>r\344lZI\215h\016A\247\352*K0aW\377\362\235\327\266\2158\353\204\254\225\226A\357T\2108%\375LM\240\265\243\340G\342c\216z\023\016\253\222\315\274\314'\246\353\332gd\276\026\345\277\330\204h\b\t'\007\367\264\214Wde\222\177(|\214\271\334\201\324v\376\004\035\004N;.\313F\301\237>F\352\006\215\316\307Y\213\025\2043\307|@\003\031n\270A\350\366\2170N}\336T\r\306-:\223\030\231\336\232\002\347\2251\251\213~\031\241\311\024~\221\331\304k_\361\206\207x\241r\347\211)\301\264X\313\224\236\023\274\312coJ\364\352\237\362&\324$\271F';\271\234\375\260\220;\371@W\233\221>\244t\223\362\372\333\032A\343\234V"
+	.string	"\305&\330\237,W\321\021RTc\270\032\031"
+	.ascii	"X}\027<\212Q\234\001&g\023\227\224\034\001\271\342\273\341\235"
+	.ascii	"\247\201\246\202\032e\300\276\214\343\341\310\352\252\rT\371"
+	.ascii	"\232s1\344\017}\256\264\255\232\320y\350\bO\245\b[\215y@?\r\335"
+	.ascii	"C \235\336\210Zt\260\370Kj\370t3\224\376\220h\260H\311\306u\203"
+	.ascii	"X\3746\016\3056K\207T\211d\207\022\025\352sR\304r\317\350\375"
+	.ascii	"\365\017\260\360\204]RT\005\222z\256\242oP\033\332M\377\363\222"
+	.ascii	"R\2240]\223l\367\035{&)\356\203+3#+L\0012>\316w\315p\217v\232"
+	.ascii	"\"\273\324\004Hb\301\325L.\007\006\247e\252\304\214\303\225}"
+	.ascii	"\344\313b\367\021\301\212H\250d0\253M\013\024U`!\371\214\275"
+	.ascii	"YF\266dp\212\252h\204pg\020\214+\354\016\210G\231\320U2~O\230"
+	.ascii	"\252\025\361\375H{\340,\322\220%=)\016\034nNr\367\313\3317e\376"
+	.ascii	"\255\266\213~\271(I/\245\372\276M\211\245\242\320\367)\027\352"
+	.ascii	"\326\312\363K*\335W*ie[\332\201,\236\203\367\310c\330\204\224"
+	.ascii	"K /\b5\273_\370mz\271\267V\304\370\327\306}\232\242\206\2019"
+	.ascii	")^\345\204V\224\225\201\257\221F4u\326h\214\357\022\f7\031\341"
+	.ascii	"\231D\341\231\331p\261\341\327\220\277\3160\326:\367S\356\b\267"
+	.ascii	")\330tM\036\026\336++\236+\203\035\n\305\377hw\343\036\2004&"
+	.ascii	"\177\236\301\322\330\226P\005\322\371\220\221\005\330\317\215"
+	.ascii	"\001\005\031(c\340B?\037\262W4\037,\203\3134\262\305\013\233"
+	.ascii	"\3033'Uz\"\227\031m\376X\227 \321\236\270f\311i\336\025\037%"
+	.ascii	"oR\244a9\013q\315\265\270_\325L\276\201x%\342"
+	.string	"\\\375\237V\272F-\330k\002\354\255\375\n\347d5\245\363\317\355\271E+\235\350\313\2726\257\\\352h:/@\276\177\274E\320\266!q]\005`\254\341}\226dB\212\2301F\314S\275\374?\304\227\365-\372\210\321\245U\177+S\371l\332d&\255\345\312\307|\266\377\030E\221\017\334%\314\027\376\032\310c\345\345\215\350\350\364\032\213\360\312$\033\231\332M\260;2U\307Wd\356N\023#\030\325\311\234u\322k\370\030\251m!\001t}Q\212Be\355\002\3667\346\261\317\244\263\266\356To\204n\340\213d\215\354\372\341\213\027oe\f\007\235\266\330\227\333\212K,\221\325\003f\322h\237\b\330\224j\322)\007hh\323\232\307Ks\300\t%\216m\"\200\226\231/\016\266\314\n\270\tR\213\354\357\213K\302\236o\330\226j8\211\016\3347l\361\023^}U\312\350\236\207\310]l\r\007ey0\323\203\265\303i"
+	.string	"\354i\225D~{\bA..\3220\335\262\216\365\3074\272\022\366"
+	.string	"\023\244\034\\\370x\344\375l\004\232\263\251\375\267\210\2758;\224[5\357\200z\023\216dy\365o\317\270s\300\350\204\306\306\001\253Fg\002\236\276\204\224\202\326\340\201\202G\355\004?\003\227\375\235\033x,\310!\301\242\313\216g:\227a\250m\242\254(-\036\314\261XP\274\222\270\361\225a\021I#\247\260\021<\316\201\231\tw\313\020\2003\232B:\th\374\344\205B\364\375=\317g6\003N\020\f\263t\313\234_\275/\237\003\037\262\210\312E\241Y\271\270%\372eN\375\201o \260\205?\266@Is\302\205\n\237Y\243\374\303cJK\222b\343\226\246\356b\271\265\237C\372D\372\253\350\302\331\256\251}\2578\240`\265pt@\271\205q\237(\225\355\265\221Q\027'\210\232\374O\231\0020\355\007\376\247\345gYl\230\361\276\255\231\0203D5g\2212\241\277q\363\334\261$4\214V|\353\225\031\336"
+	.string	"\343\305bl\263\357\371\241\346\234\035\325\241\270\322\357\342\022\357\360\252B\264\350w\234\035`\265\037 x\206V3<\024\331\240_\263\026t\026{J\025\205\013\005\306\034\336\320\3370\263\361`\276d\373um\004\3729?\2218kk\255\361\r\245\3278f\201\f\nH_\021%g\301\326\376\230&\232\354d]\264\242\003\274\310\036q\336@\273\333\313-\341\313\361\351z{\377?\221\273p\215\317_#\006r\316\246\333\223{\t\275t*\250||\367\005\0339;\032\252\017\200\006\236\r\002\b\027\370\222\341\375V\034/d\251\031V\337\373\352+\020"
+	.ascii	"\331s\026[f\013Fh\276\203\006Y\371\bE\210Q\270\267c\022\2608"
+	.ascii	"\305<\2409\203\013'\005\216\362\022\271\223duQ\025\272\356\016"
+	.ascii	"\020d\260\331\327\360\247\007`\177\355\363\303~\027\250\327j"
+	.ascii	"\277\333\270\0174\307\243\3037\3057\316\026\225\024\333\247\362"
+	.ascii	"\267\232\233;\244\177zJ\371\205c)\260)\375\201\203\315\207\222"
+	.ascii	"f\3400\327\310\023\316\247\353\276C\313\275\212\232\376\2310"
+	.ascii	"\373\336\304j^Fn%\230 \023z\267\356\233\212F\204Z\003F(|\214"
+	.ascii	"$w\222\322\264\341~Z\375|C\201\326\004.8\340\363"
+	.string	"Y\314\320\301\263.\323@\242\b\272d\271\0238"
+	.string	"\276&\007\373%\371\264\372>3\252\260\277\031\367t$\232\355\3762\255\207\271\266\260\227\312\2548\034\307\245\262o\016\256\202]\304\345B\212\366\2518\007\231\206\360\260\327\273K\270*\376\022\354\020\310\367\360\246\352\366\027\bOA\332q\344\305\242}\331_"
+	.string	"\247k\360\271\177\177\256\3206\023\226\275v\225\2772\336\250\023s\376k\206\237+\353\317x\271\345\213\001\367\334 /"
+	.ascii	"z\343\371\007\371\r\331\343\034'\317\3143d\273I\325\007\031u"
+	.ascii	"\002\332#\272w>\006Jo\344\023\311\205'f\301\326\303\327\351x"
+	.ascii	"\240\220\337\025"
+	.text
+	.section	.gnu.lto_.symtab.e979482ec6a55349,"e",@progbits
+	.string	"processLoopback"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\002"
+	.string	""
+	.string	"init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\002"
+	.string	""
+	.string	"systemState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\002"
+	.string	""
+	.string	"inputSource_e"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\002"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\002"
+	.string	""
+	.string	"specialColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\002"
+	.string	""
+	.string	"modeColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\002"
+	.string	""
+	.string	"colors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\002"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\002"
+	.string	""
+	.string	"serialPinConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\002"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\002"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\002"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\002"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\002"
+	.string	""
+	.string	"boardAlignment_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\001"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\002"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\002"
+	.string	""
+	.string	"rcSplitInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\002"
+	.string	""
+	.string	"fcTasksInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\002"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\002"
+	.string	""
+	.string	"pwmEnableMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\002"
+	.string	""
+	.string	"latchActiveFeatures"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\002"
+	.string	""
+	.string	"batteryInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\002"
+	.string	""
+	.string	"timerStart"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\002"
+	.string	""
+	.string	"baroSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\002"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\002"
+	.string	""
+	.string	"accSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\002"
+	.string	""
+	.string	"blackboxInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\002"
+	.string	""
+	.string	"telemetryInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\002"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\002"
+	.string	""
+	.string	"navigationInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\002"
+	.string	""
+	.string	"gpsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\002"
+	.string	""
+	.string	"rxInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\002"
+	.string	""
+	.string	"failsafeInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\002"
+	.string	""
+	.string	"cliInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\002"
+	.string	""
+	.string	"mspSerialInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\002"
+	.string	""
+	.string	"mspFcInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\002"
+	.string	""
+	.string	"imuInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\002"
+	.string	""
+	.string	"servosFilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"pidInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\002"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\002"
+	.string	""
+	.string	"getBeeperOffMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\002"
+	.string	""
+	.string	"indicateFailure"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\002"
+	.string	""
+	.string	"sensorsAutodetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\002"
+	.string	""
+	.string	"initBoardAlignment"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\002"
+	.string	""
+	.string	"servoDevInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\002"
+	.string	""
+	.string	"isMixerUsingServos"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\002"
+	.string	""
+	.string	"servoConfigureOutput"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\002"
+	.string	""
+	.string	"motorDevInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\002"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\002"
+	.string	""
+	.string	"mixerConfigureOutput"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\002"
+	.string	""
+	.string	"featureClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\002"
+	.string	""
+	.string	"servosInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\002"
+	.string	""
+	.string	"mixerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\002"
+	.string	""
+	.string	"serialInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\002"
+	.string	""
+	.string	"uartPinConfigure"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\002"
+	.string	""
+	.string	"timerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"spektrumBind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\003"
+	.string	""
+	.string	"resetEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\003"
+	.string	""
+	.string	"readEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\003"
+	.string	""
+	.string	"ensureEEPROMContainsValidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\003"
+	.string	""
+	.string	"initEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\003"
+	.string	""
+	.string	"IOInitGlobal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\003"
+	.string	""
+	.string	"systemInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\003"
+	.string	""
+	.string	"printfSupportInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e979482ec6a55349,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,4875 @@
+	.file	"fc_msp.c"
+	.section	.gnu.lto_.profile.999bf63f7ce1f656,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.999bf63f7ce1f656,"e",@progbits
+	.string	"(\265/\375`2\b}\031"
+	.string	"fbxJ\240\326\3250\006\214\251\361\005\224\230\316~\265\305\277\345\001\215*Bm\207\337\231U\f\3015\002\003\257\"\275\003\257\303x9>\216\207\220\356\003\225\352\243Ni\324\034\333\241\321\236\343(\270\017(X\232C\262G\023\262\241\353\217\235\366\016b"
+	.string	"R"
+	.string	"l"
+	.string	"+xO0:\202_>\260\316@n\334\267\013\244\023\370m\333~\3122\202\340\250\222\033\360R\333\361\004\305\002\227\nX\"W.\232l&\315\207\224\025\220\030\354"
+	.ascii	"\303\256\355\264\237\006`t\266\354UO\217\255\313\037\333a\177"
+	.ascii	"\313\350\347\2479p%?l\b\331\224q9M-O\363T\"\211\2614c\314t&\373"
+	.ascii	"\336W\370\013u\337\274o\020\276\363\016\356;\270\360\240\206"
+	.ascii	"7\303\347\354\300\007\216\341\302\026\336\337~\205w\234u\343"
+	.ascii	"\274\276)\274\023\320\323%\364\216po\b\367~po\007\363Fo\336f"
+	.ascii	"\233\232\367\335\273i\246\231y\227Yf\217y\207\031\246\301\313"
+	.ascii	"\340tA\033\213~\305\277\370~\253\315X\032\371*\342\276\355D?"
+	.ascii	"\321\220\320B\247i\316\207\240\201~\256\361\360(\nT\353\306\022"
+	.ascii	"\257 \342D\237}&N\\My\254h\302\002\322y{\206\3573TJ\026\226\326"
+	.ascii	"\2179\313\332\212\202A\224}uUa\351\331\341\351\360,Uv\r\321\301"
+	.ascii	"\263\243\363\016\277\301\2300AQ\016]\254\256\250\232\354x\357"
+	.ascii	"\034\336\246\312\364\344\025u\302D\t\022#D\230\260\251\024V\250"
+	.ascii	"B\254>I\262\345\004\"\271t\374\217\377\222'G\216L\276\364\372"
+	.ascii	":\362Ui\245]G\327\223>~|\350\314\221\245E\017\244\321(\322\321"
+	.ascii	"GF\243\347j5\246h\034Q2gW\270\240\262\326$3U\261\264\242r\334"
+	.ascii	"\267\345T\026\251\222B:R\235D\251zadT\231\236\274\242\212\212"
+	.ascii	"\027\215\001\200\264\250a=\201\204\244DZP\220f\f\260\202#\232"
+	.ascii	"\244\016\022`S:\226t\310)\"%\"\"\022HI\212j\024\246\003\274\326"
+	.ascii	"\003-;\340\342\277\234\220?\377\325A\333\001/J\002\037\252;\360"
+	.ascii	"\253G\320\030\315\324\003\274-\356\201ox\373\376\332D\344\273"
+	.ascii	"\345r\263\242\317\240\013\355o\006\326\347\202\2657\264\367\275"
+	.ascii	"H/\177S=I&\354\322U\026\326$FM{\254\340\302\310\224\346\242`"
+	.ascii	"|\276\213\b\232\334:\271\207\265\227\203\204\233\210_0[\320\276"
+	.ascii	"Imyi\377\3728\363U\236\237\217\360\302.\373\017RS\027\346'\373"
+	.ascii	"\340\376\327\202\332\027\330\271\2248\\h\035CwYu\350u\336vC\251"
+	.ascii	"\037\022\255{\205\272%-M\330\254\253\220\357\016E!I\316\243\357"
+	.ascii	"h\272)Ls\310\277I\227\235\347\242\212\305Yv\307w\346x2j\373\306"
+	.ascii	"\005\237\\?\013\217\314\375\347\231\001w\017\356{69Q}\221\177"
+	.ascii	"\026SdhVpd7|;=\353C\326\007\210\022\225\003\300\3307?\222\273"
+	.ascii	"\357\226\330\276\206\006\316\020\377:\242\250\301\273\306\330"
+	.ascii	"\325\357s[:`\023\365A\222\314s\210\b\331\013\b\342\005\314\225"
+	.ascii	"\320\365\236\335[\317NF9\225\25591"
+	.text
+	.section	.gnu.lto_.ipa_sra.999bf63f7ce1f656,"e",@progbits
+	.string	"(\265/\375`^\0255\025"
+	.string	"\022\017\"\033`M\222\016\252a\200KO\267\221\270\302\032\202 H\"\004^]\220\374\201\354\235R\356N\354b_\202\254\b\210\372a\337\241\321\250\322\260\372\377\352\377\326\013\356\005p\316G\004Z\320+\230\351\222`\336P\231\033S\035\236\003s\031LK\271\252 \371R\212\300(\225\251m\373\267\375~\333\233\277\367\336{\217\006\246\210\373E\002F\021\306'\t\005\354\036\243\313\370\214n\374\275\367\030S\035\236\242!\017\261$\323\207\307U\250`\b\201'\250\341e\222$\205i\r\261\005D!\307\230\215\007\022\240qD\004\004Y\024\303\0302\204\b\b\024\030BF\002\221@DDDF\212\322\0010"
+	.ascii	"(\313\244\013\227\364\312\352I\3055=\236\3315o\r*w\314\210t\263"
+	.ascii	"i\334\024@lc>\007\211=O*\243\314,\241\222\217\242\331\262\271"
+	.ascii	"\204\247\023\217\250\326\277\336\317\2041\200\353E\"\177p$/\254"
+	.ascii	"\223[u\202\263\346\334\266\274\223\322\022i\262\302\230\254\347"
+	.ascii	"]\b\262\307\240"
+	.string	"T\234\235\bc[i1=+\260\300\224-\350\213\245\317B\237=\244\207M\243\355\266\231\227%\351\266\266\030\355\216\216Q\3501\201\002\261n\215\343\020\360\335\250\266ke\232\223\221\254\205\r<\314\2561\330\3040\373 @\345\034\240Vy-0\3246\226\275:j\207\002\211\017_WS\352\247\f\340\340\242<*\326\367\203\037@\020\332?\273R)\r\020I\022F;\020\002\245o\240q\370/.\0232\363\023\302.}\305\367\305j\030\256b)\022\201X\333\372a\004\362\345\246\371\030*An)\341\301\324'\235<\330\260J\247j\316\266\310\211\242E\264\261\034\251\352s\201\226\213K\005\225\250Kg*\257)\323\210iB\3366\007\007\313\362#\246\224\250\354\272\361\234h\326\373\247\271\035P\230\277\325\312\022!~\017\353+v\200F\035\033\251V\350\245N\276\274\t\375T\350\307a\r\224S\007a\203\b\364F\224\346\302\026\266"
+	.string	"G\224A\205+\215\300w\330\266\346\320\273\227\002L\244 \372\033\335\202T\246\232T\2403}\300\026"
+	.string	"R\271\030\272\2515\"`!\022\314\003A_ ,\272\265,\324^\032wBm\312\316\325\333VHs\311\235\222\323\344\237w\021\304DbX\327\227\310nh\346\342E\227n\341m6\222e\260\263\365\022{\243\3329l\033\217\251\022W\024\260\300@\245"
+	.ascii	"+X\032\350\024\351:\373l\317\035\027E\377\030i\223S-\242)\f\035"
+	.ascii	"%\3701\333\033\322F\220\247\022\0174"
+	.text
+	.section	.gnu.lto_.inline.999bf63f7ce1f656,"e",@progbits
+	.string	"(\265/\375`g)\245P"
+	.string	"\nN\314\020AP\246J:\351\013>\274/\374\270\336Vz\3372~\320\262\202\353z\304\225\270\327n\252\240\036\214Q"
+	.string	""
+	.string	"\t\270\024R;D\371:,\364\311"
+	.string	"\340\322\356\267\356\335\007\260\327\243d5\r\271\305M\244L\001\344"
+	.string	"\376"
+	.string	"\f\001L\226\236\236\n\305\022\216\240\320\240\342\301)\277\\\317\017\334\230\\*\246\343c\005\220\022\177J\027#J\247\027\030n\265b\265\356\256\007\260\265\276\236(\212\246\346\213\277\200\272\350\311\314\334G\342\375\271\265\326\327jLnZ\354\342\213Q\314\346\205\311\230\360\333\337\032u\376\354\237C\210G\273\330\375\304\\\374\334\321\355\321f\264\241\252\024#\022\253\253K:w#M%\025,\262\245\327n*\256\003\034\233k\372\331-eza\022\205\013}\332=\305Y\304\004\246\031~\273\373U.\264\006\360\036y\017D\270\374\203QX\026\326v\2409\271\267\211\230\340\224\036U\223\377\335 f\204G\366q\003\337+s\311\036^\031\263\241<\250\273\225\276\373\033\223\374\237h\376\214\344\356n\341\037\244\273\261~\3767\207\231\354\356\001?\323+\330\b\247\340:1z"
+	.string	"\245\200ZD\370\3530\315\372\317\236\213)\336\335/\017\323\211\024;\300/\257bQ\264\367\325\354\335\342.\372]\356oz\026\333\230\254\265\356\237\246iw\261\270\313\334G3o\210`\332\220\212\355\264 \301B\220>\225b4n\211\232\301\367\211\317T\254\346\257\213\253\351\025\311d\nA9\233\360\264\237n\0241\317\226<wK8j\224\331\006\211\224f\242#\243\353\2463\0248{\355\364\352\305\325\326\302\243h^\233#{*\274X\354\356)3L\232\301)KW\250\204\225\021\317\034\205\276V(\376\3532\353s\312l\324\250\321\232\360\2672\261\240!Z\232m\t\376\377\371\375\351\343\363\263\247\267G\017\036;\227\3638\207\373\033\0335j'J\220"
+	.ascii	"\341\201\303\205\n\021\034\f\233n\3520\343\364\352t\235WN\004"
+	.ascii	"\350Y_\247\314\356\316\"\376\374y4\311\350\310\352,\035=\212"
+	.ascii	"\3446-a\001\031\276N\252\b\232\021\236\271\f\02514\245\327\332"
+	.ascii	"e\r\037`\372\023\311z\200\344\356(\340/\264\267C(\236v\224W\022"
+	.ascii	"\324\351f\221X\240S\024+\347dY2\tvY"
+	.string	"\203\210\225\b\377*S\213\313Z\037\2175\375;g\345v\271r6n\341\026\316\276Y\267u\303\347.\317\235e\034\034\2665\024&B|\350\200\301\202\004\b\017\220\256L@}P\342\316&N0\026\302\026\204-N\027!\031\022\376W\214w\347%\204\001\017\3763\273\2533\0025\262}\r\212\203\364W\361V_\023\261\024|A\211\336\302\276\366\027\265\246IGG\226\363\303cw\206U*\004\200\347r\355\326\0221$(\374\346`\2617:\276\313\275\305\211|\314\357_\t\361\203+\3733\321lNS\246\3159\350\301\\y\203\032u8\213\252\324\265\257\005\224\230\257\347+\025\237-\227\020\2519L<\255\277-M?\217\254YG\3733\365X\363\253\303d\344\245\346K\303W\334\230\f\377\377\341\036+\362\250\003m\002!\325\231EeO\222.\2657\223\216\326\230D\202\007\256\316\314\202\355\340\2753\267\271\3531\031\034\365\377"
+	.string	"\341_\305I\352\264\222\004\316\350\371\270\346Id\357\f,\206y\344\f\336+~\362$\213\242\333\375i\253\314=\335\r\3407\3767/\222\315\3278\322\fp\032\013\336\360CT\331\237\306\344i\305\212\314\362\002\321\363y>\237L\264A%\330Z\231B\274\314\216l8*d%{\344\037E8\316\235\300:\024W\223Qk\367\367\334s\317\376\036E\3214M\3234M\3234M\233\321\224\213S\\F\b\013\0311M\020L\b\003(\356\243\226d9\374J\361\340R\317\312\005\256R\354\307o\314V\372\023\311J0~_MOq\324\027\217&_\236\336\334\020\312\\\226q\2026\214\"\232nt\206\324-\375\024\2635\250\225t\024MQ\2352\345\313j\033\273Pe\314\231\235\203"
+	.ascii	"\250\322+\017\221\221\222\021IA\222\244\003\242\n\020\022\345"
+	.ascii	"X\222\224\024\363\001\022 \342H\nF\211\232B\210\020\"\"\022\210"
+	.ascii	"\210H \022\210\210H\222$\351\326\330d\346\316\n\307D\360,\256"
+	.ascii	"_<\252\254\343\357\242G,{\202c\255\016\315\275\332)\267{\343"
+	.ascii	"\243\023XV2\346\017I\2619!\020\\Q\236\322\\=\002\006M\2140\007"
+	.ascii	"\230\246aE*^\215\301\321\313\002\305\022\341\277j\2306\017\024"
+	.ascii	"{W\003\240\270\017G\326%\272\021Y\023\207\332x\212\247\341\224"
+	.ascii	"\324\364\b\027\207\034o\250\312\303\252\b\354\270\362x\255\330"
+	.ascii	"\362\233%I\031\024\037\264\301,\207;p\355\006\007\360\034ZK\005"
+	.ascii	"\250\017\004\305i!64\242n2\017\371k\264\004i\314z\202*Eg\352"
+	.ascii	"\264k\352\300F\335k\330m\373\310\007\310M\372\337$|\202&\317"
+	.ascii	"\362y\260\226\355\b%g~IE-q\233\330\0173\301\333h\222\367\314"
+	.ascii	"\347c\213{\r\273\303J\001y\371\327[\250\024\f\310^\032\261t\017"
+	.ascii	"\223!&\324\202\252\031H\220'2\366i|\335\211\243\310\205+\206"
+	.ascii	"H0?PoK\245\260\f\025\341\371\320\312\227a\350\211Gu\377\351\026"
+	.ascii	"\337\342\362\340\n!\313\241\372\004l\030\177\276\366\304'f\276"
+	.ascii	"\216\006g]:k\001\237M\"\340R\004&U\367\335P\177L80~\307%\177"
+	.ascii	"w\374\302\274!\260)c|_\245\006\367W\360\037@\270\215\240=\346"
+	.ascii	"Y\351~\244\273\256\331\211d\345\353\t>C\242\031\304\371\017\227"
+	.ascii	"\306S\236L\3762)\321\326\b\002G@\2640\3404Zc\365\277\312qXO\203"
+	.ascii	"\305\220\220\037 \254\242"
+	.string	"\222\344\350\254\rB\3348\315\373P\225\351\036\233\204\323\030\212\016\342\355M\3740b\002\333gXj\273\003\336b\206\362\200[\246#\344\3431{\274pmE\037\327/\210\217\257Ik\226\272\0362\270\263\022~\215\024+Y\372\234\246cN\205H\265\261\326\024{\033\330\311u\250i\224\366\341\303\\\271\212f<\316\202\005\200)t\002}\335b\324\247\270]\260\034\355(\303\017\207\326B1m\237\370\324\276\334@\216rvE.\016L\237\354\256&ZLy|!\210a}\342\353\032\364\346\255_\3319\021\"\213\220l\002\262\t\220B\2461\214:tu!:M\3628\024\235\"8s\330'\313\326\263\337\356\377\022\275t\262\253\300\005L\322c\346\245\364\227\345\212\362\252\210\251}\366nN\217\007'D\263\210\267\211B\357\376\300\262\246@Ev\026\214zf\331tg\020\023\275k\263\242@\3461*{\177\355\376\353\341=s\247"
+	.string	"-l9\001\237V\3018XA\336\261\230"
+	.string	"\325\276\003\037\r\026p\006\374z\023\207\224\245\323\017\3402\r\312\277\223\242\300\313\270\332\336X\245\212c2\241#\216\234\356<\277\3555\017\223\013\245\364|\307*\032\203\207\370D\244\305\210\210@\340\366\250&\004\371\001\367\230\353\nP\002SX?\314\0230\034\026\360\356\001\366\020w\3637N\360\305\0058\327\377\221\232.\252\"\026;\255\254nN\270\274R\313\335H\"\207\223\006\275\r\345\003\340\240\355\005y\253\271\204E\336("
+	.ascii	"B\226\305\"\022\223\270\223'\020\016\212q\216\334\314\365\343"
+	.ascii	"\261uO\320qS\240\305\354\002\264l\316\364\370\231`\342\n1\370"
+	.ascii	"8\t\333wT\362OS\231S\357P0\207SB?\317M\221\363t~x+*\363("
+	.string	"\336\367\003\261i\223Gn5\250\266\310 dPK\344#dq\b\253-\276\221>\302\337\362\316\204*\021\374\035\177j\224\214\223\251\355=<\347\024\035\341\221\340\256\223 `\325>k\2768kh\303\377\2036\354\352\2056\275d}\362\213\272\345N\222{\317\213]#\241\t\252-G\372*F\002\302\312\311\241\364\211\330\tzv.QMK\232/sU\206N\t\337u\232\021\202>E\304\t%t\201H\353$\320\377\357\325\253\303GM\005\024\252\203\261/\213M:\030F\304\310\343\362\"vK\337\370\321\251\266N\247\221:\034*ww\0016\316\244\264\375\001j\030[\377\371s}\350\330H\240\006\261 m\255g\3509z\031\252\225\250\n\332'!m\263\357\212=E\335\230\353\220Y\321\363\327\202\f\375\342\300\246:\022\002\232d\334\362\307\225\310\350\030>a\332\030I\337\322\324'\224\315H\365\352J#8\031\177\"C"
+	.string	"\271\355\344\013MuI\023\203}KfU\341\214\347TV\203\002\332&\024\204`K\b\250\370\323\022"
+	.string	"\350*+B\342\246\251#\330\273\236^\370l&\215\231$~\252=\216xc\360\020\n\022\332\361\270q0\241\303\344\350"
+	.string	"\335\204a\f\360\353\0075%\326W\272"
+	.string	"\221\327\201\251\267\320S\260\251\005\t\322W\026\302\362z\232<\2125\230\016c\027\233\350\020\270q\327\376\367\247\211\266\275\245\226\333\"\301)\204L\226K\257\322\311\216_W\274\212\336\236\016\314\206&Jiu%\263\226\037\204\022\362-\200\360\260\261\345\302\206T5\205\006\217\376\374\t}\021\205\371\275.Q][\226\260\357\r2I\264x5T\266\277\341\335w.QPH\211\371,\002\3541\003\323\307\377"
+	.ascii	"\212\222B\t\335)Q\36022\322u\213\372\323<\t\b\221\275\177\362"
+	.ascii	"\203!v\215\030fWNS8\323'\3179\266\243(\036G\030\216\b\002\233"
+	.ascii	"m!\374\262\020!\211W\257yI\221\340\250\316fD\223\037\254\036"
+	.ascii	"w7\354\317KV\314\225\274\347\235\317\333\233BYIZ\276*\026\231"
+	.ascii	"\263\204\205\007r\021\251\301\372)\224\200\233\3734\021C\271"
+	.ascii	"<\026\013I\307t\036\264\211i*\203+\033\321\270OI"
+	.text
+	.section	.gnu.lto_.jmpfuncs.999bf63f7ce1f656,"e",@progbits
+	.string	"(\265/\375`\252<-:"
+	.string	"\326\255\202>\320\334$\303\001\320pK\013E\235\207\006.P\347\224f\b\0166\031\211\244\003K\313^\030\315\346\345\221\343\203(\032\256\210,G\027\245\rS"
+	.string	"\276s\22193\366=\345\242\r\255m\262\267L2g"
+	.string	"k"
+	.string	"~"
+	.ascii	"E\370\216<$\375\347\252\232d\334\025s77\217FN$r\344\377\255\200"
+	.ascii	"\353bW\224\207r\347{\362A[\377\242\270\316"
+	.string	"\030m\340x\003\327o\374\252j\277\311\265\261\331\301un!\2419\3448\273\3705\267Z\273\326\251\024P\265&\374\254\263\352o\372%\223\377\222\270\222V[\020oA\223\264Z;\265\365y\200\216\254\260#\326$i\271:\233\356\314\332\362z\370x?XI$\026e\027\311\222s~\t\335\347\3549\256\223\374\205\036\313\375?\302\320%W\225\271\344\372\316\020\316\362\202\byC\372\317\267\354zD\345\034\307s\236?w\202sO5\200\252u\363EP\376\251\"\233o\001rE\311\027\335\0300\270\362#2\252q\2111\235w\322Z\253\262\225g\204\007c!@ \0064\207H\033\256\325q\360n<\034\224\300\032\007\f\230\\\\\305\274\034n%\250Z |\352\343S\327Nm\354?4\227\241\314\303a\036\314.\266~:t\270\026e\177\271\275cO\005\200\252e\342\300/\323\256\332p@\301E\325B\211,h\230$]\n"
+	.ascii	"\001\276\031~<\\i\242\224[\033\215\026, \221\372\224\333\235"
+	.ascii	"K\356.\367\035\266+\316\313%\307K\327u\255\261R\251T*\354\300"
+	.ascii	"\023\002C\205\272=(d\\n\236\352c\031\315VJE\271\232g\246\377"
+	.ascii	"\244y4\036\023J\270j\352\352\321x3\372O\305\201\240\312\023\270"
+	.ascii	"\007R\321\317\374\005\236\362g\306M\236\336\350^\314`\237(\243"
+	.ascii	"\265\f\023\334\321\261\215\256\021o{j\365\324zP\2028)\234\024"
+	.ascii	"s$\t\324\b>\211\324V\324b/\202_\037\236(\2142w;\265\250Z\217"
+	.ascii	"\371o!\206\016\202l\2502$\017\321\214\202$)(T:2\n\022\fGr\236"
+	.ascii	"2\344\003\022@\321 \004B9\216\2430\204\302\030c\214\"\204\020"
+	.ascii	"b\024bDdDDd\210\222\0165\b/)\3520\353,\204o\357\007 \265L\035"
+	.ascii	"y~\037G\262\f\240\277\311\217r\203\2043^\316\n\022\016\tQ\351"
+	.ascii	"\274\207g\226N70(o\017\222\023\0271o\220\250\214\371qa\022$\250"
+	.ascii	"\220\371\202\2435!\373\t\241\023<;\262]k\265\265\346t\006`"
+	.string	"\252\220\234k\033)I\037\263\301C\\\314B\r\245g\260\3113\375\tJL\272(\2122Qe\363\205U\340X\026t\325\235\353\356bg{\216hl\3577\313\352\306\220O\230.U\202\242~\260\225#\342\345`a7\3020\301#c\206\214\250\006g\355\333O\221D\343\216\200gA\243\237\261\371\34182\262\206Cw\b5\226\271\337\005\217\025)\021\347\230\246o\t(\274\017\205\035EB\221\330\264M\233\260\341f\t)\365\036X\3764\224f\212\307\302j[\" ~\316nY\305\003\332\005\372\033\316\313\001\034\370\213:\203\312\267<B8O\240\005\310R\024lA\252\017Qm\3079E\322]B\366o2b\205\213\370l%v\370\027\b\220\274\241\021\230=\247\374\0226\212\022\323\341X3*\021\351J\261`u\364\n\353\035\224\261\271SB\354\024\030\265e\246\0217\260\257\300\326\254\t|E\262v\216\307\t\317\310\224\177"
+	.string	"8\331\245\363\211\3500\271\262\351\316\223\367\200\224*9\226\335\217N\224u~H\222\342V\243\215\341 \242v9o}\241IL\300\257h\227\320\330\204\301\370\330{\330\f\333\237\364\023\253\037\215\235x\b\007\214\035z\365h\003}*h\307\320\\\3433\274\221u\301ifGB\245\252\004u\341\312z\276\202\325\035\306\016b9-\013\220\270\243i,\366a9<\373\370\023\215"
+	.string	"\374\007\005\373z\340\205Q\263AHKk=\022\002\323\2535I\"Tn\313\265id&\336\234\004\311\353|\302K\032\266\031\375#@\276\264\006\222&y\273:\243\221\331?\370\"\307\312g\365\310Wx.\037\200\376*)\252\374\\\t\027(\204\302\036\004\013"
+	.string	"\247;\216\250"
+	.string	"\270m\271\362\362G)\226\202\241\214@\005jL\255l\373\b'\002\221\211\357\324Lcg\bv\276\307\363\200W\025\244\240\035:\214\300\nH\202\223\016\236ZS\230v\246\242)\b\362\334\375\004\250\371\224\260\"d\204\313\211|@'\364\240\b@\0338\225\306\303\363\357\222\275\266\343`Q\034M\306\\\320\255\366\212T\250FR\370\306y$\362\201\226\336\232lv\342\024\363\250\230:jg\026~\2107\\_\360lP&\211\233TRU&\236\235|H\357\b\f\2677\007!\324T\020\222\240\026<\236\305\331a>\330`e"
+	.ascii	"\254D\204\356\272(\323k\001\233\333\361\030\023W\257\250H,\241"
+	.ascii	" \355\032\323\353\2200\240\204\211\354\375\251/\274\350?\316"
+	.ascii	"\301y\204\255\004D\314:XL\366I\302.n8Zz\211\200\377,\026*;\305"
+	.ascii	"\347\354\037\b\214R\236\267\363+\3404t?\034\307\346\201\332\354"
+	.ascii	"K\272\205\300\342\022\177\ru\373\337\\\314pc\002\372\003\353"
+	.ascii	"/\203\301\304\003\254"
+	.string	"b\371\310\242\235!\245\320\002\222b\005\024\240\222\372\013\344\271\222\205\204`\231\261F\240\271\t\257=\214.\006\200\034\"\312\301\331\033\rb4\2452\211_\3749\310(\356\231K1\330\035\344(\022f\024\201\317H\367\377`e\f\b\377f-\232$\336V\321\361\236H\332\361\320:\204or\357\031F\301\314n\370\367\311\001\353\204\276\253\355iI*\345\3467\3057E\266\374h\251\313ND\346\314\341o\217\362\330\224\332\363\314\312K\016h]\377\027v\354\203\357\036]\356\234{\224\025\213\300F\306\231(\366\t\340\030\003\beaT=\300\177\215Z\267\343C\312y\335\n\263\221\001\377\275@\323\323\330\306\022\343\017\230V\274:\251\027\274\275u\272\261\210\271\321L`\210\250\213\352\274\266\217\314J\270\213Y\260:H\324\f\013Fm&7\367\330\3005\366\034e\3703\316:U\375\334\264\002f\265\244#\365G\271u\370\333z\244"
+	.string	"_M\344\232=\031\341\234p \273\253\375q2PXo\212\320\340\347wW"
+	.string	"\255\316\362\007%\024\004W\256N\"\203\321 \013rB\357M\026\215cg\2159:\022\272\356\304'w\377\"k\245+\241\2044p\0312@\264H6\360\212\352\r\313Wh\323\301\322T\262?\0165\026fjz\244\345\231"
+	.string	"\025\242"
+	.string	"\324wU\024\370\221e\346L\362\344\363\230\006\371cP\273\177r\t\362\024V\220\214+\212"
+	.string	"\316\302\005&\266\017\312\023\230\314\003\334\254\247B\362b8@\337\241\202>\347\353\005\200v%\326\371\330#\252\237h"
+	.ascii	"\360\026\230\237\346\003\001\320\262\023\023\266\003}o\350\032"
+	.ascii	"%\374\301\026X\"*\024'\255\255S\331\303\202jA0t\304\250\035\213"
+	.ascii	"\362\253e\246\211\212\311"
+	.text
+	.section	.gnu.lto_.pureconst.999bf63f7ce1f656,"e",@progbits
+	.string	"(\265/\375 G9\002"
+	.string	"C"
+	.string	""
+	.string	""
+	.string	"\026"
+	.ascii	"\230\004\001\230\004\002\232\004\007\264\004\023\230\004\027"
+	.ascii	"\232\004\030\271\004D\232\004H\232\004I\270\004J\230\004M\231"
+	.ascii	"\004N\271\004O\232\004T\232\004Y\230\004Z\200\004\\\230\004]"
+	.ascii	"\232\004^\232\004a\231\004b\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.999bf63f7ce1f656,"e",@progbits
+	.string	"(\265/\375`\f\001=\t"
+	.ascii	"b\316,"
+	.string	"0pk2\034\020\216\323\325\377\217\272\357\325\b\340\271\212o\n\037k\365\212\320\301p\305\0379\204\2724\\\016qco[Jj\245x\264m\315J\231\002O\027'Q\236\244\351\342$v\304\340\f(/\321\036s\360\236\023\036OD;>\325\0074ryT\257\221\235N\243\3067\311)\016\276\004\202]\017\231\362\214\003/\366\2314\\Z\312-\345\343\343\230v!j\203\314\215B\320\326\234\324(\025>\241\b?\300{-\370)N99\235<\201\246SS\265\002%\263\266\236|\345\223\031\235\030\027\026\233M'+:\251rRt\272r\327\312\317D^\322y\300\003\317\2206 \220\002\261\252\333:H\360\270.?)\333\004{0\270\202\220\211\374\n\215\311\310\361\342\264\006\233\004x\237D\362\320\004E\330\0203\370\202\233\246\024\236\332\b#\024\017\306\030\260\216\256\017B\030%\301\006i\0270*.\334\342\022Q6\240\263"
+	.ascii	"\036\300=\271o\013a\\!\214\243[ct\270\253\310\020K\n$\247!\342"
+	.ascii	"\bV\206P\020\236\004[\360P\212"
+	.text
+	.section	.gnu.lto_.lto.999bf63f7ce1f656,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pidnames.146.999bf63f7ce1f656,"e",@progbits
+	.string	"(\265/\375 C\031\002"
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002\206\b\177"
+	.string	"0ROLL;PITCH;YAW;ALT;Pos;PosR;NavR;LEVEL;MAG;VEL;"
+	.text
+	.section	.gnu.lto_mspRebootFn.147.999bf63f7ce1f656,"e",@progbits
+	.string	"(\265/\375`?"
+	.string	"\025\b"
+	.string	"\202\31777@\217\322\001x\021\013\202\207\001\3468z\247D\302|\0200t\236\210EzH\274\0069ed\267G\341H\033Y\353w\321\331\260\352X0\343\233\302\370VJ\376\336r\247\024\244\231)4xB\363\243i\214qF\232\210\001\003I\f$\035B\036\221\304\246&9\004\316F\237)IY6\345\306\266/_9\037*w\270\273\253\312\331\017"
+	.string	"++\370\354\b\211w\223\037\362\005\026V\013\213BKvWz\252a?Z\244\214X9\033B\250Z*\t'\273\027/.\273\212&\035\033\333\177\366=\376\261\035d\342\001\273\\\211j\2673pA\346\321\335\0070\217\231\013`\036\275\331(\3576\366JqT\220\264vWj\312\372\266C}\233\217\200:\314\270jN\250\277\253\263\273~\246\023\306\035o\273c\373\300\266H\r"
+	.ascii	"0\207d\025\b\356\322\354Q\3165\320\"\344\022l\263\232\022\334"
+	.ascii	"\213\333i\263e\340\306\025\212\023"
+	.text
+	.section	.gnu.lto_serializeSDCardSummaryReply.148.999bf63f7ce1f656,"e",@progbits
+	.string	"(\265/\375``"
+	.string	"5\b"
+	.string	"R\01777@o\323\001X\340@\276\326\361[\354\337\232\375QG\375\236\203\344j|\347\002k4\344fa\265\2721\205\007\311J\244\323\32700(\0306Q\206\373\365\373\335\310\226)\005!\355\001\372\352\200\264O\303\345\221\227GJD8|\344\225i\262C`\f\004\221\311\020\206e\2223\367\324B\317\f\245\017\003f8\352Sn\022\325\237\2604\212\022\222\200\021J\021\256\320\256\260\320wV\223\310\247\0019{r\n?\354S\273\273\206\236}\322\257\361\0360\247\030\005\226]\216\031\231\375*S\b\307\366\325\376\311Q\266\223.\016\260\353\271\264\354\316\004\033\304W\236\037\260^\305\013X\257\274\331/\237 \253\031\255l\250\234vW\302\321\267\353\346\277\364M'\342\256\232\205\335\265v\242\216\033\336v\201\355\003\3731\020"
+	.ascii	"2\241\031h`\270\360:'\340.\021\272\200\205@`\200\0268\023\227"
+	.ascii	"\363\216\203!\227`\233\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_serializeDataflashSummaryReply.149.999bf63f7ce1f656,"e",@progbits
+	.string	"(\265/\375`L"
+	.string	"\025\b"
+	.string	"\022\21767@o\323\001\343\017\246O3%\223/\372\215\355\007K G}}\300\030\327\275\\\tr\263\260Z\335\230\302\203dE\204\3609\002\037\024\f\233(\303\365\0325\021\262eJ\001\037\356!:\333x\270NC\306\221\031GJD8td\266qrC`\315\003\261\311\217\246m\022\233\373i#h\206\217\020#f\310\034\345\245K\375\211\212\243\b\210\231\024\341\032\355\n\013\375g\035\301\204\032\321\263\247\2471\304\376\264\273\353\b\332\027\375j\035\244\203\344\262\260\262\3131S\332\220\032\221`\266\257\366Kn\322]tq\200]\220Eew&\330\340:\345\371\201\352\324u\201\352\224;\273\345sd\255Ph#\205\264\2732\212\274\273v\376O\256\371@\336\325R\330]\353\007\362\270\343m\027\330>\260\375\022\017"
+	.ascii	"2\241\361/0.00oN7 ^\235R@`\234\201\313y\307\301\220K\260\315"
+	.ascii	"j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_mspCommonProcessOutCommand.150.999bf63f7ce1f656,"e",@progbits
+	.string	"(\265/\375`\342\035-w"
+	.string	"\252\277\224)K \224\322\031\016\317VoCr\247\344\354\2309\023\237\245\326\271V\325o5\267\231\362j\b\203\301I`U\214\031\031\270\031\272\264\274\250\017`\314S\001"
+	.ascii	"\326+z\324+\3527\245}\205K\026c\360\271\233\333\356\247(Rw7)"
+	.ascii	"\223\fu\002M\002\210\002\274+\202xU4oS\363\246h^\024\315{\242"
+	.ascii	"yM4/S\363.5\257\022\2217\251y\221\210\274GA\274F\315[\242y\213"
+	.ascii	"\214\274D@\274C\315+D\344\r*\362\032\233\027\250y\213\315K$\362"
+	.ascii	"\016\233\367\247y\205\315\353\323\274)\221\027\035\362\006\207"
+	.ascii	"\274=\344\345\223I\353\372\364\334\031\001n]\267\236\177k\023"
+	.ascii	"]S\3669\177\363w\3633\377\274\337\356\277\373\347~\271?\356\303"
+	.ascii	"\335o\3362\251\316n\352E\354\222e\335\356\211\330%\322\371\332"
+	.ascii	"\265\276\t\331Y\230\234\244\267%\234\275}\227%\2317\367B\374"
+	.ascii	"\315\207\270\033\253\337Q\t\257\236\374\330\nl\026_\224>\231"
+	.ascii	"\3736\177zz\352\366A\034\357\316\004\341\032'T\263\225\327\267"
+	.ascii	"\256O|\b\355\316\224\351\365\020\316\355\351\324\334\261Y\342"
+	.ascii	"\312\265 \\\315|\314\224\245\351[W\266\006\204w\333\003\261\304"
+	.ascii	"\037\256\306\352q;'\274z\"4\223\346\331\267\256\353\323\321\325"
+	.ascii	"!<\332\024|Q\212\346\355\317\f]\2362pL0'\363\267\252\273\355"
+	.ascii	"O\235\236\236u]\211U\273\304\243@\273V\273\304\335E\307\234\220"
+	.ascii	"$\2642iK\033 \310\273_;\017VgK\341C\353Z\303S\006\333\215\322"
+	.ascii	"\243\302\027\245G\267\371j-l\257+X\233\270ue\223\261.\204G\t"
+	.ascii	"\240a\265\307\263\221m\3718yj\221\321\263\256lQ\215e\367JE\177"
+	.ascii	"\376y\264\301\007\331\276@\350\361(N\230`ZRJB:2*QD4$\024d\004"
+	.ascii	"*\022\207?B\237\024\rv\n>\356\257\216\242\357\374\225\207<\241"
+	.ascii	"\304lscb\351\206\311\316Yl\311-5\201a"
+	.string	"\245\264'\321y\360,\354\314JW\332\221\332\340\300G\\n\324\346Q\177gV\272\270\274D\320'k\213\213\215=}kN\227\205\213\264\234\210\356QwgV\272\264|hI\233\320\nn\202\234m\306`\021\016\332\327\f/4p\016\304Uty2\205\201V\205\r]T^\264s\2068\f\026y\241\201c\344\312\n\306\200\203\366\365.O\276\370gJX\202\017\323iK\217\265v\224\0049%\027\224\007\337v\0264\300!\343\230\341\202\362f*O\301\003\030\331\226\033\244\210Q\363*\333!,\314R+\311d\310\205L\273l\006)\267\362d\255\210}r\254\353\272\254\344\352\3726}\227\353\354.\327.\323\220c\320\272\3238^LL\344nJ\366\325.\213\341\265\243\227\340\267\354\361\213\362\230\226\036\345n\032\3408\227X\374d<\257\2460p\005?\375(\346\310\003\223\211\331\354\313i\f\360\027\006\263c\277\345\350:\360"
+	.string	"_y\024\375\326I\351\232\311\277o\016\2375V\223\021\246\231\345\274\221\034\233\263/\355\261\367^\222y\003\312\304\301\273q\231\004*l5\301\324\3265y\245\017a2\b"
+	.string	"G\177T\200\326L\"q\276;\013\036q\213\357\\\372\025ciy\304O/\322\273\030\b\341+\267x\027\245\231\325W{#\376\266k0C\363\212\001\273\307l\370\346\270b\300\375\227\234U\354R\364\3302\226e\262\345K\001\355\002kX\036\023{\241\312\262\025\254-`\313aW[|,ey\312z\306l\271\354\305\307\007e\231\0066Y=\205M\rL\327\262\fk\320b\340\255\345'\353v\367\3022\f6\274\270\311\262\362\305/\266\236\2111[\305\222\313Z-\266\276\030\271\314d\371\222\002\355\232x]\276B\321"
+	.string	"\356\003\227/\235[\006\367\354\223\350)~{=\274\254\\aX\232\255bG\354\363,\237\360o!=*\004\262\312\211S\003\203gw\371>W\004\330\224u\275:\030\037+W\030GA\350\267}x\327\265\005\266n\341\300]6$\367\330\356\373\371|\372m\327\260\313\345\312\307\374\377\372\334\367[\267\373^\331\344r\337k=\211l\336_\275\371U\233\327j\311\363\276,4/\n\315[\325\274H\212x\247\214\234\355/\322\274RW\373Ah^\017\226w\203\317\371jp\346\227\310\347\276C\036\367\025\322\274\0314/\006E\274\0274o\020\"^\013\232\267\002\"/\220\346\375a\344\245\240y}\030y'h^\t\214\274=\2327\002\"/\004\315\373"
+	.string	"\221\227G\221\327\201\346m\200\310\273\243\310\253\243y\031 \362\346(\362\342h\336\005\214\274\n4\357\r#o\002\315\213\200\221\367\200\346\265a\3445\240yk4/\215\346-\240yg\020\361\022\320\274\0034\257"
+	.string	"C\274QF^\250\346\225a\344\215\321\274O\315\033@\363\302 \362\276h^"
+	.string	"\204x]\030y\235\214\274-\232\227E\007O\335zG\374\351\321*\032\322\337\352\323\035\375\002\254K\202\231\020\\W+8\372\306T\341=\030F\214FW\301h\032/\032F\007\001\325\034\357\350U\343E\003\3059\002"
+	.string	""
+	.string	"Zm\323\n\024\302\317;\236*'T\272\350]uN\255\273\262]4\002\200~?\364\252\356\321 [W&6\226\003\371\251\006\021\304S\365\364\224}\274;\325\3619\177\207\244+#\352\261}\013\251S\277I\0370\t\206\324\352\026\355\324\350^\022\f\210\020\252\033\276\262E\327\b\013k\"\235\274G\335S\343\250s\3229\351\321k\365\331\334)\312\327\271M\224!\026F\315b(\215V\340\007\251\2126\352e\255e\217:\252\035\276RE;1\237\277\362c\363\351_\265\317\322\356\001\264O\335Qt"
+	.ascii	"\3752(\332\005\230S\312\317\f\250\245~\032\210\251\177\372oL"
+	.ascii	"\355\202\351w.\030\364\271\364\020\017\247\271Rc\220\324JI\r"
+	.ascii	"\305\314\323D\"\0355R?\315\035\256\243\032!\\W&5\226\211\340"
+	.ascii	"\"\324<\252\237\352d\325\231\036=j\"\226:\347\332\021\027\315"
+	.ascii	"\020#\352\"\035\274\253\002\252O\276\222\250\241\230zbgf\020"
+	.ascii	"BC\215\003y\314\342+\207\272\310\374\222ufz\t\272\301\fv\024"
+	.ascii	"S\2327x\177l\222\036\235\034a(2\2454\257\234\351e\354\261\375"
+	.ascii	"\371*\032i4K\212\247\013i'kv!?|\177\222I\326\005(\306\205\264"
+	.ascii	"\221~\227\235g\022\f)\024\324B\375:\306\016R\343X\357\270%\\"
+	.ascii	"\327\325\3062\036\347\035\271\2162\034\241@I\217\032\373@\034"
+	.ascii	"\006\234[\332\032,~\366\022\261\227\274+\256`$mVg_V\334\177\245"
+	.ascii	"\221\264\317R]W\017\372W^l\017\372h\242\024\333\205\224;M$\261"
+	.ascii	"\233\206M\354k\005.\3131\233\243\327J9Ra*\351\321a\247~^\313"
+	.ascii	"\025l\325\302==1g\237\214\266\352!\236\247\227h\031H\364S\330"
+	.ascii	"%\372f\036\334\201,\356K\2247\001\252\034\257\360\225\302v\201"
+	.ascii	"7\327D\246\350 \232XV_\245\350!\236\264\217\354\345\344\021H"
+	.ascii	"~.\332i\007\365\264\002e\360\356\021\313\361\006\276\022m(<\271"
+	.ascii	"&\262\257\226\243\234\361\200 \036\265\034qh!g]\261\314X\231"
+	.ascii	"9\226\031\345lQ\353\304Q\322\200\305O\">1\200\303\023\322\177"
+	.ascii	"\265\t\035\354\264\321a\302{\226c8\343yi\376\370\004\337\316"
+	.ascii	"\202\235\306\tB\330\001;\002T\021#\037()\201\n\205\250\252$T"
+	.ascii	"UG\212T\235\330\021\240\252FP\362\301T\324\021\252\251)*\251"
+	.ascii	"\245\235"
+	.string	"\200\307\005:\320$E\224\024\231BC \201\225\0349\201J\n%\341GxTU\025\221\242J\002DI\025\025\020$USBJ\252Bh A|\2040%\225\256\024\024\222\252\251\016\244D\210\222\022!\352\b\t\037LEI%\251\212\202BZ*$E\222D)\241\242J\022Ed\303zp\355\032\266\004/kpj\320\377\230\376yQ\203S\223n\260As#\367w\2769\202(\214\364\365\375/\274\211\021\233\341/\342p5O\024\337\276\2309\373\270\376\002\016\225\246\211\f\246:\003\"\351\005=\205l!\324\254\346\005A\b\350 \033\244\0264\001Z\235\2476\301\263\200L\005@\272\202;m\247\032Q\007\244\237\203\227\233\363\007\005\375\303I\263\221\243\240\337\305\313-\315\307\004\355\003\206\216S3A\277\313\362)A\217\226`\253\321\250{}\246\007\332e\371L[\303\302\372\346`\212"
+	.string	"\202\216\240\237\206\253\313\250F\300A\340\367"
+	.string	"\217~\300\201\346!C\273\215\3516\025J\024\325\313+=\352"
+	.string	"\022N\251\215\243;c\323\314j`G7\240\243wH\3510;\350\260\223\266\206\305@\216f"
+	.string	"G\347\350S\351/jX{i\035\324*W\324\261\261\364(\216>\335\222/\006\230\226AJ\207T*\007\264\333\371P\0317a.$\261\324c\013\264')\306\321,HN\236\256A\237\316ep\271=\333\3460\341=\247\201\247\255Li\001\005z\001,\215C\323\316\026-\n\344\245\335H\240o\334\320dj|XlH"
+	.string	"\201\003\032\001UK_Q\367\200\356\220\001\003\246\366:VT\034\202EU\324\264\025\241&\326U\324\2623\025\315Kz\364\200>sY\227\266\206\305O\020\354\232Y6\fh\033=E\335\023\366WKQ\277\244\251a\302\244G\r\350\333-\347\234k\260P\">$g\b\271N*3\204\230\246\223\223\r\201\206d\364d\243YJ<\235\b\221\256\261\244k\034\021\351'\373m\216~=\343P\2711\301v\242M,\365\211\002z\251/g8\243\013h4M\262\213\230\031\375\276\345[\332\032\no\316\203\313L\317\212F\241\251W\f\320M}8<\374\215\332\303"
+	.string	"-\200"
+	.ascii	"\335.\310q\300\337\373\033\225L\024\234\352\203\332Q\355s\305"
+	.ascii	"\00584\375B;9\243\352\251\3757w\252{\032\365\330\337\241z\t\013"
+	.ascii	"\035\243\241bt\215\260<\355B\032uN\312B_\357NQ\376\322\226T\332"
+	.ascii	"\350\225\270#\372V\243Y\206\236>\244\235\f\351\247\336\301|\223"
+	.ascii	"\016\202c\250\3620-\020R\310\f\215\310\210h\222$\303\030R\013"
+	.ascii	"\020\b#a\224c\352\001\022@D)\r\343\212\261\021\231\341f\r<\373"
+	.ascii	"\306\234[7B\326\230\240\017\335\016@V\303UY\350bv\303r\"]]\033"
+	.ascii	"*\2272\225tZxp\2366\330\"\240(\235\213M\355'\0226\250\336\341"
+	.ascii	"\253\311jeH\325GI2j\0078\272\026\006\305\310\353\374\204\352"
+	.ascii	"@\305\375jM\013\231\302\376\247b\365$\245B\361\270x\223j\364"
+	.ascii	"\202\007i=\370\027{@-D\244\r\221\260\331\220ibD\242\336\211q"
+	.ascii	"\243\024\227\211\005\311\357!\022dQ5\220F\303\316\235\340\016"
+	.ascii	"M,\223\341\357\356g\024\031\024\277.\211zh#{\304.\366\032\300"
+	.ascii	"\277\225\267\036\004\027\350\234\201\003Zp\301\001/\273\207\372"
+	.ascii	"\271\324,\231z\200\215\330\242c=\262\250\216\272@4\305\203\324"
+	.ascii	"\354\352\247\bd\360\330\262\216_\243\215i\254\206[\202\205?\271"
+	.ascii	"L\305\323\262:\270B\260\021\351\324\315\270`\240[0\020!\301\241"
+	.ascii	"\tZw:A\330\242\246\357i.N!f\315\354\340\260\261\2510\037I\301"
+	.ascii	"\353E*mm\265PR\310\220\236nW\300\353/E4\307\265\365\365?;\356"
+	.ascii	"\330}!\224c\202\2140\0036\032$\206o"
+	.string	"e\rx\223e\264\033\255\306\320\364F\325\346\005\026\337\374\032\233\001\t\t\325\326\002\036#\375\b\262\226\036>\026\024/\3414\0038\037\331\210\021\227\241\311I\021,(\314S\017\027\034z\350\331\205H\347k\362~]d\242\246\220\315`\3251Xu\030\240G+\2312\007Q\310\223\303zL}\212)\233\376\306\307\030\f\217F\005d\355\312)\261\030V\226%4\261<\357\353\3103!\020\021\237G/\371oz\004\026\030Y\037\365o\236\315\024\233\241U\335q\023\3427D\032;\305\211\225@\210\033d5\263\2304>\373\037\276>p&\317\263\251C\235uJzc\300)\210\254\nF\231/(\333\255oUF2L\240\033Nvq\203\n\305\365\345\211eR\216\027\304\306~\332\310X\332\200'\270mE\336\375\355\020\317\n\004\303\354\203\223\220\2749\002\337\027b(C\251\276\301\201\206\262sk\373\213\264\007MoDK\207a"
+	.string	"\314\202\"\203\217\350p\271B\005S<Sx\356\300\003U\035\222\220\346x\235\017\233*\303\254,\242Z\325l\202\201\216J\243/)\311Wv\332\273\347\303\366+\225m\030\240h\217\367"
+	.string	"X\310Z\206B\016R,\022\272(\334\351\251\361\026\\F\311M\274F \216\256\335a\202:\345\310\260\326\f\t\200$Y\b\236Z\256M\260z\221\031<zj\224\317\001\247-9%\245\347*\265\342\030 \262\007P\272[\003e\247\224\361n8\251\316r\203\017\330\254C#k|\r\034sr\225\324\030"
+	.string	"\022\374\365v\227\206\303\201GJKBCX\r\234\354\204#U\267\226\005\306\027C\253l\316\302\332\213C\3246\201f\342h\263\374\273\363\343h\331R\360\371*\t\037\251\331e\2167\300\215\204\322e\336\005\221\212Q'\324\\~"
+	.ascii	"\2564\324\211;}t\254\306\331\016p\rL\375B\200\357\235O\243\356"
+	.ascii	"9\nP\024\247F.u\250'\271\255\\\034}\037\006\275\306w\3363<\367"
+	.ascii	"^\323\274\0266\201\306VS\243\326\325\211\3471\b\363\b\037\321"
+	.ascii	"\"Q\251\230r\346\316x\213\017$\022\214aP\022p\273wf\337\ng \270"
+	.ascii	"\332\261\177\237q^\344\306\322~\307\201wG\333\364V\277\001\220"
+	.ascii	"\207\364W\206\\\032\324/\226\273c\237O\2349G*\2334<\343\261\326"
+	.ascii	"4F~\t\2154=\330\354\242\204\003g\231\007\255@E\371\002\037\007"
+	.ascii	".J#X\220\331\021ar\261M\375\310|TQ\306\027\350\366\2023M\225"
+	.ascii	"\n\266\214\206\033nS^:\320{9\333\253o\t \264\375o\305\021\001"
+	.ascii	"\255v\260\030\334\246T>\357OC|\203\271\302_\233e\007\027\305"
+	.ascii	"\303\205\315 \037\350\204\247\366\330\201A\2060\201\234\221A"
+	.ascii	"\263\252%C\363\336\205\217\233~\240\211\242\351\2718W\325\026"
+	.ascii	"\256g\351Z\037)\305\035<F\037\005\255U\240o\202\264\222W\356"
+	.ascii	"\257\364\222\023@(\330\371\277\260\373V9\032T\336\327\375\267"
+	.ascii	"\254\342\251\375M\025\360\274\004\230\267\260a\351`\312d\272"
+	.ascii	"\343\002t\301.\257C"
+	.text
+	.section	.gnu.lto_mspFcProcessOutCommand.151.999bf63f7ce1f656,"e",@progbits
+	.string	"(\265/\375`\247s\025x\001\032\214J\210S\0200&\351\f\007\367'\302P\304\357oY\"\r\321\230\231\310\230\231\316\262n\354\304tM\320\026e\026\305vQRVU\226"
+	.ascii	"\022\276XW\306_\345\224\374E\332\360\027i\303_\204\035\237T\233"
+	.ascii	"T\233Tj\333\017~\006B\374=\003\005\332F\330\336;I)\003\022\b"
+	.ascii	"\244\007\372\b\333E\304\336\356Q\242\267y\274\267w\020{\233\350"
+	.ascii	"\275=T\354m\035\357\355\034\304\336\026zo\007\021{\033\350\275"
+	.ascii	"\375S\354\355\343{\333\247\330\333=\357\355\225\330\313\203\357"
+	.ascii	"e\301b/\007\276\227\317\024{\031\360\275\374W\354\345\347{\331"
+	.ascii	"\217\330\313}\357e\276\355\345\275\367\262\031b/\227y/\223)\366"
+	.ascii	"\262^\210^\316k\321\313x\357eg\261\227\357B\364\362\230\025\275"
+	.ascii	",\346\275\034\206\330\313`\336\313v\304^\256{/\323\021{y\356"
+	.ascii	"\275,G\354\345/\357e/\304^\356\362^n\022{9\356\275\fG\354\345"
+	.ascii	"\267\367\262[\261\227\333B\3642\227\367\362\226b/\263\275\227"
+	.ascii	"\327\212\275\254\366^N+\366\262\226\367r\226b/c)\321\313h\357"
+	.ascii	"\345+%z\371\354\275l\345\275lF\354\345*\357e*\304^\236\362^\226"
+	.ascii	"\302\242\227\313\336\313Q\336\313PV\3642\331{\371\311{yLE/;y"
+	.ascii	"/\213\275\227\233\274\227\3030\350e0b/\177\275\227\275\212\275"
+	.ascii	"\334\025\242\227\271B\3642\363\275\274\365^fR\354e\255\367\362"
+	.ascii	"\222b/+y/'y/g\025{\031+E/_\275\227\221\020{\371\310{\331\b\261"
+	.ascii	"\227\255\336\313E\210\275\\\365^\246\"\366\362\324{\231\b\261"
+	.ascii	"\227\207\274\227\227\304^\026\362^\226\"\366r\324{9\b\261\227"
+	.ascii	"\241\336\313Jb/'"
+	.string	"\337\313O\304^vB\321\313M#z\231\351\275\274D\354e\344{Y\211\330\313@N\364\362\217\367\262\017b/'\235\350e\244\367\362\021\261\227\215N\364r\321{\271\007\261\227y\230\350\345\035\357e\"b/\017\231\350e\035\357\345\034\305^\0262\321\313A\357e b/\377\230\350\345\343{\331\207\330\313=&zy}/\017\261\327h\242w\347\275:\304\336\034\023\2758\357\275!\366\236\300D\257\t\336[\002b/\tL\364\356\360^\034\304^\035\336;\002b\257\b\336{\343\2759\274\327\306{q(\321\033\202\367\202\340\2757\024{m\b\321[C\210^\032\336[\243\330;C\210^\032\357\225\241\330;#D\357\007\336\353\001bo\007\336\313\201b\357\006B\364j\340\275\031(\366b\340\202\336\013l\257\005,\350\255\200\210^\n\210\350\235\200\005\275\022xo\004\210\275\020x\357\003\210\275\016 \321\333\200\3672\200\330\273"
+	.string	"\022\275\nxo\002\210\275\bx\357\001\210\275\006 \321\033\303{\013@\354%\300{a \366\016\240D\257"
+	.string	"\336\373\002\261\327\005\022\275-\274\227\005b\357\n$zUxo\n\305^\024B\364\236\360^\023\212\275%\204\350%\341\275#\024{E\b\321\033\302{A \366~0\242W\206\210\336\030\357\205\361^\017\212\2756!z;x\357\213\367\272x/\007\305\336\r\336\033\200\367j@\354\315\340\275-\212\275,\336\273\202\330\253\342\275\030\200\350M\001\242\027\305{O\274\327\304\366^"
+	.string	"\242\327\002\020\275%\336K\342\275#\266W\004\210\336\020 z\213\357%\276\027\304\366~"
+	.ascii	"\321[\001\210^\n\336\013\200\367\326l\257\007\020\275C\020\275"
+	.ascii	"\302\367\322\274W\335\336\024D/\272\275\177o\247d\\\204\257\250"
+	.ascii	"\307\021o\255\255k\321\340\231\265\231bA\322D\334B\334@\334="
+	.ascii	"\314\202\314\200\314Of>f3\314d\230\363\230\353\230\343\230\337"
+	.ascii	"\230\333\230\331\230\325\230\2650\2431Ca.c\236\302\\\205K\354"
+	.ascii	"\362\216)\264\036\254\245\274\333\232\321:VG9\246s\204\261\005"
+	.ascii	"m\215\220\257?\032\375\263\214%i\266\325\307\366\371Z\252\321"
+	.ascii	"\3532\333\323\240\337r\340\362\340\326p*X\303W\216\033\341\231"
+	.ascii	"\255\341\264K0\357ok\2367\200X\275\254|d\3275\306\004\302>\267"
+	.ascii	"\275\256\262\2532[\343\324\333\032-.\332\330\350\220lsH6\024"
+	.ascii	"r\310\0200\230\325q\212\363\263\003s\363sC\3528\255\371\255!"
+	.ascii	"Q\250\261\331\340.ktRkn\r\247S\314\"yo\313p[\243e\213\211t\333"
+	.ascii	"\032N\333F\340\305,\272!\3342\270\206\256e\004`r\346j]W\233,"
+	.ascii	"\313i[\243e\323\2366\204X\320rx\rZo\2240\211\253A\310\351\362"
+	.ascii	"\030\237\355\326,\t\330\312\352\320\024\267\265\256k\r\247\273"
+	.ascii	"\354d9\nKa*l\2665Un\034\3311)\312[W#\013L\031\201\027\023d\003"
+	.ascii	"\3126M\b\223\257\274u]m8]\002\b9"
+	.string	"\345'L\266\303Pp\360\212\264\262\216-&V\362\326\265\211\r\247\013\202\220\323\025\350\222`\267\206\323\024\273;\2735\273\213\366.\203q\330\01671\001\023\327U\b \f!\247\333\204G\250\234\n9\204\312\351\276\331+g\277\256\311\266+\353\332\004\306n \344tw7\004\022v\226\307\002\240\036\275\017\230\350\020\"\363[\327&2N\204H,!B\204\b\021>|\370@\302R\331\261\2078\361\003\213b1\203\3776\036<x\210\261\273\037\254\320\304.\013\013\202\321&\274(\210<\274[\226m\327Vm\323V\313fY,\213\266W\366l\255\254\331VY*;e\245l\331FY(K\266Ovl\235\254\3306q\241\005\026VP!\005\024N0\241\004\022F\020!\004\020>\220\021\003\206\0076\035\274p\301\301\006\001\320 \203\026,V\250\300 \005\212\023&.\260\240\004\211\021\"B\024\027\216\bb\343>T@\001"
+	.string	"j<\f\2054j\212~\271l\333\272\355\3336\267\313z\331/+\267s\315\263\334\303\273e\213\215\002Uk\022\030T\313\022&M\213\210()#\274Y\320\025VEz\261LA\363\272b\344LiE\002MXf\313\"6\257g\225\336Q\324K\305\213T\023\357\024)\"\246$\365\360\021%\305\304[F\"\352\270\324;\030u\212:\"{\243@\200\b\312\030\2620\273'9\030\005\022u\034\352\035[\324\207\027)\"^'fb.xm\023\027\232\\\b\353\241\327B\007\235i\026\002y\205 \0266\277\376\364\242\220\002Y\005g\nv(X9\201\205/\023\276\266J@\321u]WX\327\265}\3064\tw<\002z ?\247\025\376\204\344\370L\230\026A\f\207"
+	.string	"\210\005\302_\\\177`\3072\320\324.K\224\024\224\254\230\334\367\3261\340\030\006\332\265\305\0037\364\003.m\323\306\035\3541\332U\206\025\205\324\306/\272\\\034\341`j\003\025\220XQHV\034\200A\r\312L\351\f\250p\013\275\257f!\205W\224\261\n!L8\275(\2442\306"
+	.string	"\355 \017\215\217\263\214\302\320\021EG\206X\217Yx1\002\353\024\350\273\260E\255\220$\002\307v]\215\302\213O\2404=\214\350\364\360\230\270\311l\023\\|\201P\216I\245\027\205d\305\026\2404@EGN\370\313\303\302pG\272\004\022&\001\307(\023\211\025\205\204\204G\200\220b\262\b\024\204\325\226\252\016Q\204\213Ex\341\300\326\230E\226\321T\023\207 Q1\b\366\241\342\215CA\254\353\212\"\352\030\206~\300\"\313(\331\037\206 )\271\2024\026\232a\362\324\213BR2\005,\242\220\236\030"
+	.ascii	"NO]\323\204\205Yd\031=\265\007\026\343\030\244\276\312\274\236"
+	.ascii	"QHV"
+	.ascii	"<\004\342!\364\367\214BZb\241\027#$\272"
+	.string	"b]W\3162Zj\032\2413f\221e\264\324*\020N=\034\001a\024\355 \351\346\243\202# tD\027\2511l\306Mt\364\323\027\303\313\245\357x\333\232x\3352 \342}\223\302\333\244\302\333\005\216\327\213\035\357\027.^\271\366\342\2353\023\004\304\363sRM)\253P\231\262\305\254\312\337SJ\331\026\223\207\243\343\026\222#UO\311/\035N=x\260\201\261\342\325\265#\307\340\031\027G\031\031QY\013\210MD\324\221\t\243i^X\327u{\350\b\211\227\006\336\035\032\331e\336\275\341.h\325\3230\024\330\360\207\234hw\027\006\177\310Yp,\314O\3771\f1\255\365\203\007\374!G\253\036B*\354\fF\263X\032\243Y\226\370\305Y\314\3059\370\213\363\227wqun\367&\353k\306\272\021N\3305\202\271\232Q\f\007i\034\234\3238\275\322\024\310\304\342\323\203\337&Gnq\224\243I\005_\256\032H\007"
+	.string	"\206R\203r\216\252\006\016\361 \344\034\365\313\023-\005_\366\030\242+"
+	.string	"\\\310\007S\2758$)\033\220f\315\227+\363\b\251\033\234\243\326xw+<B(v\215x73\352\221\230Z\327\265\004N\367T^\305X\306\270g\3543\366\251\234np\306\302h^\223\231'\230\026f1\366"
+	.string	"\005\360\352\231\327\323\201\036\276\\\b\250\t\321\260C@\213\346\003o\232\312g<\204B3\032D\242\3320Zv\242\335\033\350\272F\271\300U\230\363\234\364\340\302\320\250\021\320\030h\207\247|\241wyzx\216\315C\350\223\247lxO\315#\b\3364\365\006\262\t\204\226\235\255|\214gI\005v\027\273\223\033\313V\234.\f;NQ\336;\225\323\033F\315 ~\362\030\372\362\374\362\200\336\263<Xv~2\374\262Y\205Kx!\313\310\024>\212\214\301\375\364\037\315\227|\306\215\364\001\245\024\363\345\355\247\377V\310\233\246\006\340h\330\333,\210\353\330\203[\003o\232\212Z="
+	.string	"/q\354\302\013J\036{P\375r7\257\t\364\036\0321\244\231\024\205\326 \203k\3606\003\312\340\350\025\347\033\n\r\203\273\314\331\326\004z\317\361|TA\207\370U\236\366\274%\031\003\363\323\177\013\2439l\345x\323\324\026\347\260o\007\2319\366\340\262x\213=\326\263x\204\226\255\226G\007\017Q\363\020\247\313<D*\247,nlJ{\"}zpQ\350\025E<G*\276\242\204\336\345\371\301\243\324<\244\342\317s\2465\217\357Y\021\372DX\203&\236',\315 \f\276\002\350=\233\342\030\234Q\334\202\2478q\024\367 -5\361\023\227av\301M\360\005\257Y*\361\020\267\200\304K\334\305\035\312\233\246\2168\211\333\334\211\370\b\020\"\356AY|\005\017A|\361)\322`0\210\023\357\202\354\303A\254\370p\032&\005\037\276\002"
+	.ascii	"\234\202_\020\330\274ij\315\001p\024w\036^#\364p5\213\360\350"
+	.ascii	"\207g!\037\307\036\\\232\013\257\276y\300\352i~AZ\320\231c\017"
+	.ascii	"nz\025M\317mP?\357\331\037=\013\t\372\364\340~\320\3158\324]"
+	.ascii	"\236 <R\315C\377\375\234h\315\037\033\316\301\253\t\364\236\205"
+	.ascii	"\321\351\322\177\366]\036\"<T\315C\313f\214vA\001\275g?8\310"
+	.ascii	"\233\246\366\323\245o\013!\217=\270\03543\217\021u\227\007\t"
+	.ascii	"\017V\363P\377~\316%\0334[a3\236%&L\255\353\312C\273<Lx\230\315"
+	.ascii	"C\250\325\331\214E\\qb5\177\336\263\215\306,\306B'\262\331\323"
+	.ascii	"\201\273M\216G\312@\020\r\b\331\200\027\007\270|\340m\006\236"
+	.ascii	"\fdh\364\036\363\f_\356\356\221x_\350\351\300e\256\2712\322\244"
+	.ascii	"\306\227I{\037\353D\001\307\246w\243\375\321:U\220\261q\336y"
+	.ascii	"\354{\260\220/\277\023\255\363\004\024$\020\316Q\237c\257c\235"
+	.ascii	"\030\274\2611\320\201\366A\353\304@\216\177\356\263?\256\223"
+	.ascii	"\367\256\3708\270_\327\371\"N\360\314v\340:_\254\005>\267\377"
+	.ascii	"\326\331fB\222Ng\370\266\373\326\211\"\r\351Wf\333\314:S\354"
+	.ascii	"\355\345m\353\2553\305\035[\336\335\266\023\357+\314\266\230"
+	.ascii	"\273.\035u\333vc\230\200r\333sb\302\\\255P]\266\275\204\371b"
+	.ascii	"\203\333\216['\n>60m\333n\353Dq\207\264c\333\336R\307T^\255P"
+	.ascii	"i\333jtL\332\256\260lgY\347\t(ls\337jzm\235m_Yg\007j\315*\333"
+	.ascii	"fpi:\256\244lOY\347\013>\244\033\224\355(\353|A\207\3442\266"
+	.ascii	"\375\344\nZ\340\325\n\325d[\354l\311\316k\353k\033l\235*\352"
+	.ascii	"\330\314\270\266\273\326\311\201~I'*L\266\267\326)\204\002\224"
+	.ascii	"\026\225ym\255PJ\266\227\254SE\237\023\254\355\254u\252\330C"
+	.ascii	"69\262\215d\235)\334\220,\364\320\272\256k\221m+\025\236S\333"
+	.ascii	"T\353\024\246\300\f\265v1]\255P\313\355!\353t\001\205\255\204"
+	.ascii	"\250m\251ubPe\004\3456\324:U\340!Cp\332~Z\247\n+l\036,m3\255"
+	.ascii	"SE\225\016\200l+\2553E\032r\203\244m\037\353L!\310\326\302h\373"
+	.ascii	"h\235,\247\304\003\347\250\234\356v\217\335u\366\232W\322i]{"
+	.ascii	"8\271\273\353\354\241u]\327\365\005\247\257r\026c\236r\002)J"
+	.ascii	"\256q-\270\333\344\310\350\272\256k\177\271\313\350\272\256\353"
+	.ascii	"^\310.\277\361\246O\270\2157u\302\200\274\251\030\013\362\246"
+	.ascii	"^\335\303\233\016i\"\336TI\354M\237\336\2336\2757]zo\252\364"
+	.ascii	"\336\364\307{\323\244\367\246G-\304\213\002\262\350E\371Z\364"
+	.ascii	"\242y\357E\313\030\n/\372\204\313x\3210\236\302\213Z\261\026"
+	.ascii	"^\264\212\325x\321)f\343E\227\234\307\213F1\031^\364\211\315"
+	.ascii	"\360\242C\314\307\213\256\374\344\375\031\216\343\375\237\212"
+	.ascii	"\336\3475\020\357\233-z\337\306u\274_\343&\314?\303\240\367f"
+	.ascii	"\354\305\374*\333{\255&\342\375\222\026\342\275\222\006\342}"
+	.ascii	"\222\356\341}\026\003\362\036\213\237\274\277b>\336#a3\274?\302"
+	.ascii	"dxo\204\363xo\305u\274/\302q\274\257\3427\336S1\033\357\247X"
+	.ascii	"\215\367DX\013\357\2070\032\357\227\357\275\020b\357\245\336"
+	.ascii	"\373(b\357\203\274\367P\304\336+\337\373d\261\367O'z\357\364"
+	.ascii	"\3367\025{\317t\242\367K\357=\222\330{\245\023\275\007\362\336"
+	.ascii	"\377 \366\336\307\211\336'\275\367H\305\336\037\235\350\275\321"
+	.ascii	"{_T\354}\217\023\275\347\361\336\357 \366\236\350D\357\207\336"
+	.ascii	"{\035\304\336\3478\321{\241\367>\210\330{\240\023\275\377y\357"
+	.ascii	"\217\304\336\373\234\350}\317{\277\026{{\360\275-X\354\355\300"
+	.ascii	"\367\366\231bo\003\236\350\355\277\367\366\263\330\333~'z\273"
+	.ascii	"\357\275\315W\354\355\275\367\266\231bo\227yo\223)\366\266\336"
+	.ascii	"\211\336\316{o\343\025{\333y\242\267\357\336\333c\210\275-\346"
+	.ascii	"\275\035\206\330\333`\336\333v\333\333u\357m\272bo\317\275\267"
+	.ascii	"\345\212\275\375\345\275\355\205\330\333]\336\333Mbo\307\275"
+	.ascii	"\267\341\210\275\375\366\336v#\366v\033\261\267\271\274\267\267"
+	.ascii	"\264\350m\266\367\366Z\213\336V{o\247\265\350m-\357\355,\305"
+	.ascii	"\336\306\362\336F#\366\366\225\367\366\031\261\267\255\274\267"
+	.ascii	"\315\210\275]\345\275M\245\330\333S\336\333R\212\275]\366\336"
+	.ascii	"\216R\354m(\357m\262bo?yo\217\021{\333\311{[\214\330\333M\336"
+	.ascii	"\333a\304\336\006{o\177\021{\333\353\275\335E\354m\256\3676\223"
+	.ascii	"\330\333[\357m&"
+	.string	"\304\336\326zo/)\366\266\222\024\275\235d{;+Eoc\275\267\257\336\333H\336\333G\336\333F\210\275mU\242\267\213\274\267\253\210\275M\365\336\236\"\3666\221\367\366\020bo/\337\333B\212\275-U\354\355\250bo\007!\3666\324{[I\354\355\344{\373\211\330\333N\357\355\246bo3\275\267\227\210\275\215|o+\025{\033\310{\373\007\261\267}\274\267\223\210\275\215\364\336>\"\366\266\321;g3\235\037j\227\312T\271t\224\226t\232\232TN\271\312\331(y\307\244\302_g*)T\236r\376R\225\250Kr\226\255V\347IG\251T9\345)g\247\344\230g\223]"
+	.string	"b5Q\370rW\n\312w\226\362\245r\331Q\276 \352\225\216\024\2222:(,\346\f\205'Le\262\263\230\245ZD\207H\025\031\035s,\357<&"
+	.ascii	"\225\235\374yT\352\020\235\"K'g\246\344\\\223\337\354\334\344"
+	.ascii	",\306\304A\206Ae\260\337\314\210\032D\007\211R\205\322\301J\242"
+	.ascii	"\263d\t\030Sr\356\347\204/w\275\272\316^\314u\356B\343\230\231"
+	.ascii	"g.&\252\2231\t\223\332\244\303\354\322\371\372b*I\3021\205L\370"
+	.ascii	"r\227\211\326\231I\230\252\004D\353\271D\311y\211\230\232\204"
+	.ascii	"\244\344|\225\\c\202ea\235\263\316fcj\221\016\231P\345\241\366"
+	.ascii	"\320\211\"E\207\n\025\225S\306J\252=\337\303\373B\t#\244C\236"
+	.ascii	"Vi\300\206\237%\205\237\365\366\321\002b[I\310z:\344\355\303"
+	.ascii	"\021\030\003s\026\224<\"9rFb\246\352\330\203Rs\250BG\264\030"
+	.ascii	"\261:\0339S\177\316\250G\325\307\352\354\224<{\202\371\024\251"
+	.ascii	":\027\031\024\364\013<Su\346J\236QM\235\251\236F\245\030vh\251"
+	.ascii	"\237N\335\260\213\0313}|Sg\256\244\225'\221!g\"Y\3222yd\364\206"
+	.ascii	"\234\235\222V\230K!\347eZ\3524*\r\273\230"
+	.string	"\031\003\264{\303\224\336\351\254\275\204\336\234PRL:FgK\233\316\233N\234\220\367\221S\247\244\331\263*\255\252\311\b!\244bO\2532`\303\307\022\201u>\303x\307-{\"`=\025;\237\341\b\214\305\365\005%\217RQg\251.)\335\334\225\334\227\250\363U\022J\020\250s\220/i\323\250\344\301\324\352\314\245q:u\303#3VI/\2707\250\363U\222\354\t\346\243L\236\225`R.F\245\341\221\231\251-l\3113R\222\214\t\346\363\344t~:\337\351\210I\323R-$\b\322\271\023\326\240r\312Ng\244\344\223'XYs\323wu\364t\3124\017\245^\347#(\235\275\024M\247\217\202 f\240\272g\367\306)\275\242\363DG\350\305\001\215I\255\244g:\200:\201:\203=*\247\334t\036\344TK\362\t\223\277d\261Z\022\202\007\334\267W\325W\006\204/\267\206\213\214\2379M\025\215\3359\356"
+	.string	"\251\230Z\327 \036\372\325\211\214d*3\035\2060?\375\267\233J\271I\032\311\226oP9e\246\363\037\217 #b\372"
+	.string	"\004\376\325\177\346%\244\340\352\202\224\034\227\220\347%\2463\362\374\307\016\030\203\303\023\022\224\361\345\326\204\201\201\256O\253d\260\341#\361\200\344\334\027\370CLK\f$G\327\227\030{\253\013J\036\225\200\234\225\204R'bM\264"
+	.ascii	"\001\373\361\364\221t\366\241#\355\342br\331I\222a\227\304\004"
+	.ascii	"\351\f\366\204\307<2:\037\235\357\210R%9&\330\355\rT\232d\207"
+	.ascii	"G\tS\273S\224f\355\034a\3554w\222d\330!@\345\224\215n\002"
+	.string	"\230\364H\212\004\001?v\224\224TN\271\350\334\307)\330\223\363\211\\\2759\037>`|\271\333\203\307\271\307RZ\204\216\007\325\2161L\242\2413QS:d\314\220\020\035g\265\247\272'2\207\3209\307S\032\204G\210\214\2202\350\314\366T\307\004\3729\003)S'\277\037\246#\373p\317\331'H\252\264#\310=?x=\253=\3211\221><\306\363H\245H?\306\017\301\214v\324\236\346\236H\017\276\334aU\007\350\320\323\252\0276\374#G\316dl\216\034\035zq\314-JP\362\250\223s\235\250\224G\216\013S\273\263Lw\354\020\021\246=\306\241\035#&\330\345\334\005*,C8\347=N\341\236\344:\2709\301o\250R!\243\023\244@&x\"K@\202\227\340lV$\365\311\021\246=F ;F\204\nP9%\301\207`\250 :\250\200e\253\335A\262\203\205\245r\272\303Y\355)\216\211\034\303.\370"
+	.string	"_\340\320\3418\222\240\200\177:\234\257\236\336F \202\217\340l&$\350\263\004\3553*\355\241|;L\230;]]*\247\"\270zr3\302\373\202\213\364\350\306\323\243/\224\214\336\215''\311\341\234$\fu\336\345p\326zRc\202\371$\331x\232$\206\206\331\031\023\256\353O\t\213\332\241`v\310\242\354H\221\242rj\343,\306\251\326S\332\363\007\357\013\034\300\320\3138\3242\276\257&\020\021v\301\267d\003\336\022c4\t\016\347-*8(a\350\020\200\340!\340\245\336\3359\333Ak\036\002\301\317\306\247\324`\330\005_R"
+	.string	"n\260\3417\324p\033<\360\005*\r\257\341l\026\304u\314\202\302\355\210\201a\367\266\323\266\301\224\033\rg-\247Af\215\031^\203\306gHC\267\260\255\321\220a\306e8\233}\3403\326P-;b`\354lA\263\354\264\005\300\016EC\261\354\274\305\355t\351\242r\372\201\263\022'A&]\231\276\246\006_\356\207)-\320\247\247U3l\370F\214\334\003gg\007\356\201\363\316\027\364,Gh\206Z\331\231\253\333\001\003F\345\264\003\3472\314G\250\300|z0\003#G\237\256\342h\245\217\003\0338\0074\360\r\234\205\240Rv\304DA\313v\356v\360v\364v\364TN5p.\303)\223S\337[|\271\3030+\320\250\247\177\037X\"\326c\017Q,\\\250\267:\032\365\020cfq+`t\006\216\201g\200\203\372\002\337\335\331\333\351k\036\302\300W\374\274g\b\032\266gB\364\013\005\333y\356"
+	.string	"\356\004\356\004\252\234^\340F'3O,+\b\3725U\270\350\301\304)\271>\252LW\023\350=\030"
+	.string	"1\rb\360\345\362\250\0268{\331\031D\231<1\354\320-#\026c\017\214\251u]\035\240rj\201\307"
+	.string	"C\201K\340\0258\007)\341mS'p\n\234\203\262\254>\201\247i\306\3365\002\031\205\232\207$p\326\343\020\3152\314\346\361=\235\342\357\304\327\236V\325\260\341\027!\343\0279\333\261X\330S\016E\221\177\355!\276P\351\013J\036#"
+	.string	"\201G@\007\232\245$\017\353\n\002t\317\0078\340\017h\300\035@\204\032\271\302\263*\322"
+	.string	":\006,\340\fP\300\027\300\003\235\262r\022\031\242\200\271\004 \340\t(B\245\246\356\242\202 \340\254\305i\216y"
+	.string	"\003\374"
+	.string	"1\334"
+	.string	"\347#4i,BA\020:!c\236\234bx\026\200"
+	.string	"/@\022\272D\007%\006\251D\200\263\026'9\030\006p\030\316w?P\037F%\n\202\314\235\t\263{3\205&\031\227^\242\013\034\020z\204\"\031\233\236\214\312 *\247\0038\333q\252\305)\356\311ZEU\204\234\370r\207L\027\374\357i\325\f6\374\252\023q\361\253\316M\036:\227N\211\230\322D\325\377\367\242\324\224\270\240\344Q"
+	.ascii	"*@\001\275G\n\345a\\\326\240\315\311\325\355 \022\300\231\313"
+	.ascii	"\311\355\371\202\013\177\241\205\273@\004\315\321\244C\205\320"
+	.ascii	"\240\026\316"
+	.ascii	"[NnL0\037\026V8\013*|\005*\364h,R#6\3475\207\372\240=*\234\267"
+	.ascii	"\234\326\236)\240\360\024N8\nF.\270%\027x\346\2045\246\t%\334"
+	.ascii	"\004\022^\002\222?\225|\361\353#\341\314\345\244\366\004\363"
+	.ascii	"\031A\204\217p\276\013\341\"\030\261n\306\230\244\006m\356*\351"
+	.ascii	"\265\256?%\260\227\335\233\252\2271.i\025A\360\310\266\274\326"
+	.ascii	"u=A\357d\214L\230\306\256/\225\323\020\316MN\271\234\324\230"
+	.ascii	"`m?Iq\027\210\320'cvr<\343\030\006S\353\352\303C\373\273;\215"
+	.ascii	"ab\306\2611.#\203\326k\314b\314Sd\302,\370rk\270H\244O\236\206"
+	.ascii	"\031a\303\247J\235\374Tg\3011\267\237\376\343:&U\226JP=}"
+	.string	"r\022_\244D\tJ\036A\370\340 \310\370\007g\253\2031\222\225`\267\256?'\354\032\243\334\316x&\303n]\177\350^g\224\222E\345T\306\031\216S.NU\236X|zp\335\204\222[H\304x\352\344\035\230\201\336\313\031\315\232\207\366\203\1771\236\241\031\263\2541\315\270\326<\024\343\354\306\"\312\310(\213F0\337\314\031\226\036\021_\356\220K\021]>\r\323\001\033\376\324T\210\251\243\313\301\264i\013\214\247MG\036g\254\213a\267\345pF1\034\270\375\315\330\366f\214\213S9\205q\336\302)\227\323\223b\007@\240SO\303x\300\206O\204\b\221\310\321\251:\017l\356\301\333\254\203\3338\240O\344\273\306/\306\271\346\241\016\316k,\202\r\017\260\371\363\036\020_.{\340Bv\310\245\202kC\214\023\350 \343\004:\204X\033b\340\330!\207\0326v\300A\002\020\3140C\305\332\020\003G\215\031n\330\360"
+	.string	"\r\035d\320\270`m\210\201\343F\tt\250\201C\306\211\265!\006\016\033v\230aCF\0167l\330\270A\303\304\tn\310p\032\234C\215\005\324\2601#\007\232\033\270\006\0163h\340Hg\270\301\200\035l\250\341\006\034h\370\200c\207\033\006P\303\f\034h\020\356\220\003\tn\300Pc\207\033\031\2068j\230\201C\f5p\220a\006\216\033\bPC\0167\330\320aFq\007\0343\374\001\022`\300\f6h\250K#\206\bp\330\360"
+	.string	"\r\032d\320\240AF\0167\314\260!\203\206\0168d\304(\2617DPC\007\031;\334\270\241\203\214\232\335\335&>|!\213C\332_\2243\021\314<*\213\261\360L\232_\224\263F\271\370Z\327z\377\270\315cppP\f\003B.\365\013\271\331\342\241\207Q\311\003\217K\235\263\252\326\036\365 \177\324M\233\207!\0179<\350\270\271\211\273\271\351\242r\372 g\255\2525&\330\241\256\374\241n\276x"
+	.string	"2*y\370\271\022\254J\315\312\005\276\334M>\375\3119\017=P\236\006\235\236\31071\375Mu\3033<BU\230\376\226\316[UZ\220J?\022\314\260\017\213\322\036\220\263\037\367\361\377\0203$\223\303\346#/\351\254Uu\306D:\372\221\356\206wpGb\214^\364\036\177\321\r\336\320\356F\356=\350\316\343\274UeEKI\023\350=YM\240\367\354 \372w\350\r\233a\210\340\206\2520u\344\370u\224\031\266\345\345\330\"\024\004\364\007\355\r\325rn\370\016\244\345?g\255\252(6\314\204\254\002\322\004z\217\224\252\037M*\374\242*\251i\201\037\357\363\037\373\206f97g\356C\345=g-\252\301\257\203\377z\363\034\226E\031\024\024\f|\013\336"
+	.string	"\016\237\214\005\n\236\001|\237\271\t\0346\031\002\004\373\013|\372\275\2377\203\303.#\277\017\207\314\276\363\026U \023\311\267\367\346\353\031j-\331{\202\231)\3636s\034f\351\220a\2259'\251\3160\301\310\350\275\311"
+	.ascii	"\r\217$\365\254\362\236H<\347\033OhH\305#\204\205#d'\251\235"
+	.ascii	"\037\016\211\364\335y\213\252oL\213y\217\3211\0242\224\022\303"
+	.ascii	"\367,\343\n|\271\033\006\314;\f\321\020J\231\004s\336\2422\363"
+	.ascii	"\264\253{\333\235\315x\f\233r\322\206Lug'*3tso\272\242\241\022"
+	.ascii	"\220\271\363\025\025\236\334\227\267\334\3210I\207,\206\035\022"
+	.ascii	"\316\222\007SG_\316\\TxL/]\336^\222\206=x\354\350\322\214{7\177"
+	.ascii	"\fu\030\225b\340(\rs\340,q`\307c(\324q\347-*'\005\276\334\205"
+	.ascii	"{{\303\235\357\232\206?F\245\241\317\360\210\363\244\304\t\022"
+	.ascii	"D\345\264\337\316YTwL\267\266\267\333\371NJ8(\330vVB5f\002D\222"
+	.ascii	"M\240s\201!\362\324\004z\217\004\276\\%\265\271\\\207\245\360"
+	.ascii	"iT\362\343\202\222\241\242#\213\300\227\273[\320\274\367\026"
+	.ascii	"\266\243y8D\204{8F\204f\330\316YTr\317^{\333{Mx\307\255\366\267"
+	.ascii	"Q\t\365T>a\236\332\031\214J\216\231\226\326\245\266\2263^\021"
+	.ascii	"\341\030\034#a\204bp\220`\341$I\242\305\211*\356)\b\201/w\263"
+	.ascii	"`ygY\"\254\243\303r\326\242z{\242]y\2431\021~\361r\345\215yf"
+	.ascii	"\345}\306\024\306\301Y9oQ\271\231\335\254K\330fT\332\"\344\202"
+	.ascii	"\363\025\206#&Ve\213\312\r\220\367\205\007|\271Ke\312\233\312"
+	.ascii	"\230P-m\212\032SJ\331[\n\231\020\013ZYZ\024(\357(Q\204Vt\310"
+	.ascii	"\252\b\315p\244P\30113S9m(ZT"
+	.string	"iL?\336\027\034p6\344+\214_\f\351j6\340\313]\262'o24a\231\016Y\224~r\326\242\"\033s\362\036\313\342\344\207X\223\267\330\331\f'\255\233\374hC\222\302\302p\326\204M\204`\3020\034\2346\034\2347\225\323\006;+\241\032l:\341\027R\200\f\270\3228]p\276H\221\332k\3760\213\261\207)J\243g\336\002\022\220*\237Vm\300\206\277d\311{\007\017\235\nX\362T\371\3422G_'\340\313\335/\257\367\327\234p\213\211\326\022\257g\027\327\273\253N\230\205u\205\204\353\214\311\334z3\301\b\255\212TQm1\321z3\021#\034bTjaj\211\363\\\301N\bN`\214))\255\263\337\224\025&\230\317\022%\357%\347;!A\237;!\224\016Y\013vJ\234'\013SI\234\300\030vO\255\344\3747ev\365\035\214vA\025@\355$\347\253%\234\276\026\2208\317\025\224p\002c"
+	.string	"Ir\366\2332c\""
+	.string	"M\256\217r\242#\357"
+	.string	"_.\312\305\235u\216\032\013S\326\215\365]\034=\2342\315C\235u\n@\375\340\354\t\223p\3728\312\324\272\376\370\020\"\341<\231\314n]\177p"
+	.string	"\205G8\201&\b\213\204F8\203=9\307#\326{\007\307\3404\025\305"
+	.string	"_\356\372h\002\275'\n\351\307\325\323\037_\302!\035WO\216\202\344\034%L\030\004\204\344\254\245\034T\352#O\225\304\204>\302\236>r\326R\n\266\221\266z\033\021\fl\2533R\031\370\354\"_\275\233#\224\243\243y\250\213\234\207LW5\325\273\312\317\250\324\327T}Ib\340\342\245\331\313!\2421\223\303C8\250vU\200/w\247\246\212h\362\360\210\340%y_ \300"
+	.ascii	"P\300\247U\034\260\341+\271\222\367\220^\276\207\320\334\321"
+	.ascii	"\214Y\276s\300\240\344(\340U\034\003\243\004%\217BZ\352-$uF\275"
+	.ascii	"\245\316AI\346\021R;\310;\252\241\336A\216\316\035\321\320\031"
+	.ascii	"\225\230\330E\320\216hN\256\241\256:)\357Z\331\311\2672'\211"
+	.ascii	"\246\213Q\351\303\221\240\334\320\356\r\020\232f\316\017t\204"
+	.ascii	"\236S\b\216\006\216"
+	.ascii	"&.Gi)\247\351)\371"
+	.string	"\316\301)\031\345\230\001|\271\373\344\364~R\322\264qq\242kbz7\005\241Y\323!Sc:k)\347\226\220\357%)\232,F%,\215<+Q\3161[\t\310[iIs\246Cf\005\310YK)\367\374\341\343\375\203\b\r\225)\355\343\254D)\307\354\244Fz'Q\321D!\243\201\222S\304H\016\022$*\247\215\244D\031\367d\n\340\313\335#\243\367\021\026\215\0231\243\242\356\361.JB\003fT\372\352\036g\244\362\255y\\\004(\240\367,\241\3412.\231<\316LJ\267\347\016\242\367\016&4ZK\210\334\230C:\336CL\232,\0352,\035g&\345\3323G\216.\232#F%#Bg\244r\215\031\324@\357\240/\232*\243\022U\003\235\221J\265\376\351\343\373'\214f\310\262\217j\355\343#F\023\025\244{\322z\035|\257c4I\243\322\323\340\031\251Lc\n\006\236\005\311h\230\226\002\237g"
+	.string	"\317g\242\320"
+	.ascii	"\371\001xfRja\376=\317\177Rh\220t\310\216\236g&\345\331\323\257"
+	.ascii	"\357\354G\205\246\307\016\032\0369fg9hh}H\345\031\263\351\205"
+	.ascii	"/w\371\366\316|Yht\344\244\345\330;'\225ff\312\234\315\234\315"
+	.ascii	"r\326h\200h\2164?9[\332r\336\336TN\271LRY\345\t\206\344}\301"
+	.ascii	"\205/w\311\350\235\311\344\235\365\342h\326A\301\300\274\253"
+	.ascii	"ZJ(O0\347\335\331y\036s\276;\347tQ\377\214I\330,\347\213\372"
+	.ascii	"\314\231c(\233S\247\372\345\200\031ajU>\265/GL\316]\016^\016"
+	.ascii	"\336\230\030\264\224P\230E-|\2715C+\274\371\224I\005\033~\222"
+	.ascii	"$\3470\207\201\301\234\303\230\t\004\363\024TH\237\036d!\311"
+	.ascii	"\337<\211#\336ZP\362hWw\266\323\313\323\253;k%\007\231tsg\272"
+	.ascii	"\2731e\346\316`I\301\247\334\227\263\034"
+	.string	"\030\273\275\034\300/\347\255\244\240\227.g/\3479\244:\227#T\277\250r9}9\317\034\300\034@\225S\356\362\016\342T+\031\370\304\262\302\227\273\315\270s\363,$\350\323\314\311\t\324Q\306=\204\344\231\357`\027\200z*|\271\013\227>\235\341\370\355\351\223[N\316\240\216\362\355\314\224\344sk;\273q9\267\251l\352\226\0351=:\307\243\312)s9\006|K\310-l\347-j\032\217\020\020\017\021\333CH\356}a\027\200i)|\271\273\246v^\023R\261\240\251=\323\264\234\323t\250Vx\204\314\264\234\221\222x\314,X\316Y\210\324)<BR\312\260<\321\256\234\321x\250dO\306\256\234\231\222N&\230\017\237Y9\237\025\251M\214u\033\350\034\251a:I\032\330\201Y93%\357\236fU\002\207\323\250\243q%\321`,f\035D422\222$I\232\003\323\031 \f\306\3614\016\264\324\335\023"
+	.string	"\204\311\247\362\261D\017U\312\021\344$%\"Ib\232\016\343A\226Nb\376\201?J\303\370\020WYQQi\252_\344\345\326\"\271\276]\374\2173\247?\241)\350\350\267\260\272\246\027\373\315\342A\212\312\315f0:\317\200\353\317D\003K\355\\\226\323'H\025f>\324\233\207\275\221\2326\336\375\246\374P\263\325\236\254a\312\030\0377Z\340a\211X\227\256)\326\004|\353z\336\3025{I\026\274=Gj\332`\274\334fJ\226MM\204\2553mA\006B\256j\243\224\257\372\032\232\337{\247\223\236~\303,+~zC\\+\222\325RcL+Ne\276\213\005\036>T4\270\377\"\213tc\0165\372uK\241m\356\f\013\333\215\305E\224\312C\303\374\351\254\203\004\372\004\033\331\035\326:p2\310\312\350\310W\t\f\031{\250\373\tj\206H\370#\032\023\314K\370\327\275\357,"
+	.string	"\354J\317p\207\t?\332\323>\007\314\316,m\\K\233\373-}\221\262\020n\273d\016a\217\2475\nK\226\211Y%\365\316\246\327\004\354\020\266\016\272\225l@\341)\236\352P\203\336\206\341{c\363~~.I\202!\355\257\032O\023\315\005a\035\022\227\364\260q]\365K\224\020\244J8\245,\212\320,\327\2155{\300\013*\017\221[\322S\320\233\n\253\372\212\206\372\023R^o\032\234\324\r\\\341\260\345u\027\370}Sb\177bAV1g_\316\275\336I\353\223\314\266:\226W\007\320\227z\216\016\354\302\352\n\301-D\303\252&\020\213}\t\002\256Y\017\234\363\202\352\377n\360\002Q\301~dG\377\022\343\333\356\375\247\306\025P\374\321\027^\245\220\372\251r1\302k\036"
+	.string	"\\\177b\207\b\177x^\004\332\307l\233c`\377\210\205?\264\221+\216#6,R\220sbj\363\006Nt\353\314\005\207XV:\365#\333\251\252\300\340N\344\316\375'I\213\371cc\2271\200I\272+\027$\224\317\r\302c%\367~u\375A\221\257\356\036\307\214\245\227\n\334y,\215@F\250\231\262.\305\237lw\ba|\006\327\250\276\337&j\366\262Ac\346\336\242m\030U\370\0254\3011Ca\347\0366v\375?,:\340Y\005\303Z\004F\333M\002\021\035(\270\214\0354\205X\271\200g\257]\007\313\330\311^\244\343V\300\353\016\030\337\306\223\3405\2314\317(\301\333\334\343\334\025\366\240\355-\371\221\357\321\027\365\253\347\336up\236A\201\354\366Q\rK\026\314\007a\340\367\357W)\3153\353{D|\311I$\214\017\342"
+	.ascii	"A3\001\017\035\255i\365V\250\035\250X \375\264\022\301\210+4"
+	.ascii	"\212\350\0013g\365\377'\351\3179xeg\377\035~0\025!\237hNlt\227"
+	.ascii	"Z*\n\331\267\037l\362Xo\3160\320w\311\200$\030\2044\231\320'"
+	.ascii	"\275\022\301\230%\243E4o#\237\0061\n\366v\246\361`O\237\3345"
+	.ascii	"?\005\276\001P^\026\251\037H\005\022]\357\365\347\264\275\"\313"
+	.ascii	"\207nP\034w\330w\3378$\177\365Yx\267\267\374@h\333}QJ\025\304"
+	.ascii	"3\367_Y\274\300\210\240\212$\240 \314\265\270\254\315^q\364\025"
+	.ascii	"\315\337\364J\244\223E\341\225\270\213\223{\370\225w\037\230"
+	.ascii	"&=\210\207\335\364\355A9\3012r\310\3532\346q.\267\372\355#a\322"
+	.ascii	"\027\376\305\274?\266\030-\260\230\253\177\300\327P\020\247\302"
+	.ascii	"0\250\330\035\303\235\311Z5\3521v\307\231\213\315:\232\3627\013"
+	.ascii	"EE\340+\232\034\177\273h\207\0036Z\267\267\302\375\240\346c\264"
+	.ascii	"\275\020\037\254\357\016\204c\343\351(\361$bO \275\351\n_\265"
+	.ascii	"\326W\275{\312cP2\330\301M\004\241\267\265\245\257\0209\301<"
+	.ascii	"\335y\004dU\362:\261\021\b\037ybz\254\266\304k\023\367\223.\031"
+	.ascii	"\314~\324\324\372\376\345^a\035f~N{J\307v\220\227;\252\371@\213"
+	.ascii	"~\345\220\036\017q\222\177\345\240\243\371\254\347\020\331k\222"
+	.ascii	"\0278s\177K\253J`\207\263\356\263Zm\002\324;ry\255\027\3737\307"
+	.ascii	"\251\360\225\004\353\024\337y\202\310\024\214\b\230\271\226\320"
+	.ascii	"\213\305\007\004ut\013\221\003~\264\363\346p\306\214\201\306"
+	.ascii	"\352\"\322CNg}\256\213\375\246\253\330\322\334\2072D\320\227"
+	.ascii	"\372\311\004Z\300i\023\034'z\\R\020\022&j\236\305[56\367O$\261"
+	.ascii	"Sh\200\0247g\320\021\301@\217k\177\263<\374\344\240\235\035\t"
+	.ascii	"\313\004\204\b\221\332\303\261\206\210\2128\016C\037\2576\322"
+	.ascii	"Gy\353\023\327S\204-\234\336\224\240\376\306\203\254\324\344"
+	.ascii	"i\315;<\220&$t=\253\325"
+	.ascii	"DZ\0242\264\204#\273\2333\032\373\215e\317&\t\316\257\2160\020"
+	.ascii	"e\267\036\331\025\026\341V\025 \372N\224\020\\\325\2463\270\232"
+	.ascii	"K\310\214\354\177C\252\362.\032\322'\005-\342jE\315\342\352\360"
+	.ascii	"B:\351\203\340\334\317i\220H1\272\214\200"
+	.string	"\025e\352,\377I*\305\026a\r\365\013h$\035\361\306-\375Bt\261\024\007\263\256Q\373\003eU5\276\020Z\323\327\336\035+\025\301\0266\002%\307#\022\217\207\250\025\n>\346\370\320\211\nukQ\020 \020\366\030[M\220(}\006\317\245\006\252\260_\354\024%\377\033\021\037lm\316H\374F,\314\027\233\261\262\214\223&|\376\\?\305\344\2524H\251\005`\217\265\227l\016\307\rP-o\027\264\361+E(\002\t\334\300\274\303}\363[\r\370\346\274\246\003\232\372\260\267\204[3\267\2029\315D\020c\361\333\326\365i9\322\0220\263\201\3716\227J\323\257^hP\347\346\320\217\346\007\245\274\237XCa75_t\\Tq\210\t\326\2474r\005\245N\220\202\033\030\305\021| \246A\256\350XGf\321\215\226\356b\216nG\373\2029\n`\3414RYx\272\033\231R\001y\234\345\356=X\013\261]\265"
+	.ascii	"\203\022\265\326*\214X\241\304\367\002\2525\222f\353k\330L$\255"
+	.ascii	"\331\347\364P*\301\3365u\374E\362\310\342\266v\3774yb\221[(\211"
+	.ascii	"\017H\241\337V\360\344\312\246\"\324\346C\027\214R\025\221\037"
+	.ascii	"\213\035\307\006\244\310!)h`\243\336\002\347\213\350\177\235"
+	.ascii	"Q\200\307(\364q\267\327"
+	.string	"\273\260\0254\311S\022\305\355\206\352\007\204W\226  +\004\365r\035\22668\203\377$4\340\345v\253\221\002\224\231\251\341\277H\251A\307\316p\310~^j\b\247\037~>\326\364\267\331\347mh\262\367T\341\357\265\222\314\236\277\326e\221\202\277\213\270$m\306R\241V\371\200\230%~\t>r\312\223\336\036\215\032\350w\375\230b\205I\301\230\030\225\275\225\227\211\246$\361\321#\272\212\266\204\036y8\261\343\341F\\\234F\006R\342\376\372\370\344\347|\314\265\275\006\360\245\271{\354\325F@\244\024oG\304\267e\347\013\260[\367REz^\030r\331O+\276\335\177\252\224\017\005\326\234<q\226&\317\342n?k\232\230P\313\032+\367\306KC\351\366\017^z\017/##\003/\231\2154@\372\f\220\332\021\221\375\004!\n f\260\030\341p,\204`\242~FBUqA\n3\337r\026\360\264\264\347\203\367\035"
+	.ascii	"\021\367E\320\247\310\354e\337w%z\323,V|\317\031\037\207\267"
+	.ascii	"=\006\0167\306\203\345V\036/1\213\340\320V)\322FO\202\200\220"
+	.ascii	"\030n\034\257\007\215\245>\324\r{\210v\240\277\367\025*+\271"
+	.ascii	"\037\273\266\262C\371S \321\247\205\034\024\033d\222`B\307\334"
+	.ascii	"[\232\267AS\360m\320\244r\031|\360!\211\311X\3745\304M]\237\263"
+	.ascii	"\337\344\304\032\037\032K\033\366nO\250>\271;\020~\202\n\224"
+	.ascii	"\211I\300\3437M\357\253M\0245\n\354\004\370\376\271\002\202\314"
+	.ascii	"M6\372N\220!#V\177\366\367\f\217\b\276\205\223.*8\202\016\263"
+	.ascii	"lj\013i\262\005%gO\260\261\234\224\223\210\"O\346\036\347\335"
+	.ascii	"]\363\345\234"
+	.string	"'\\\344\022\331\200\035-+\357%\225\367\236D\360\r\253#\2429\336\321\365-s\350\217\253\230\275\2548\220\2556y\243\263\306\332\023\270\357\256\3410\302\203\276\317[\312\013'!p\342\306\005hb:\320*\313M\2219\003_\003l\250\353\363x\221\237>|B\035\"\316\215T%\006BE\225\330\221\fj\220>\\[/\366\324\236fI\353\003\223\326;Kd\t\372\244\362\345\316\222\\r\210\315\320\262\224\331\tp\025\323\227\332\222<\220\3421\f\265\251F\334$\350\326l,\203\337\277\370W$=P\"I\241_@\320\304\355D\033\216\013\265\tA<\007\331\030[\244\361\353^AK\212o\225J\225\323\271\020\177\301\341\353\276+\212\237y\343nWX\230\312GH\346\243\233\0015\211i\2460\016\223\337[\334\237\361\250Nb\363^\207I\244\273\2023r\307D:Y7\027\271\242\335\260~k\257\237\205\021\216i\n9"
+	.string	"\3762\365\225\235\266UP"
+	.string	"C\331\307!c\033\211\226t9{\037\302"
+	.ascii	"|\251\271\234\326\257\300\300(]\360\270\032\022?\332\371\300"
+	.ascii	"\321'\213\001)\206\241X\223$L\366\\\004\273\32060hl\313\370\224"
+	.ascii	"Z\024\262p\350\221'iL\b>\210W\273\0168\223\202\315rH\270\361"
+	.ascii	"p\270G\356\363\035{2\366\337\203?\325\210#b\331\271Y\311rc\020"
+	.ascii	"\023\242\340ec#\031\374f\034\306\203\363\250^\030v\366\272\223"
+	.ascii	"\007\342\376A\373\267iU\224\027*\252Y\300C\201\325%\260\204u"
+	.string	";\240\362\027\267\303\324\026\037\\\211\352\301\021\004\017t\244q$\3104{\203\262\022A\3538{\b\271\245\bb7\205\376\377\305;i\346-6i\212\033\036|\201\n\210+\033\306\272c\322!Z-\226O9l\003T\201}\350\317\245b\277UU\232>\377<\333\254\370\314\n\253\216-<\270\214\372_l\267\204\201L\"\201/\220D\030\033\231\254\324d\223\347\2158a<\025\261\366\353/Y\201\214b\267\362\346\2339\316r\330\201s\303\005k\372\367<=\343H\206\222\373\2275\310\214q\202\205\363\353\001\350~\207\263\320\322\303\251\212\220\207\"Mj\211\310\330\335\032\335\354\213\272-\024TW\016\371\27192\216\f\227\215w5\331\013\373\026h\307co\200u\206\210z~\214\345Caj/\361\r\206\346\rC\312\021'z;W\360\370\234Q\221\321\271\22094\346\01772\357\2017\211Y\244\027\021k\357T\226+F\321"
+	.string	"\007\333\254\304\340\202 V\327:\036\210\312\357\307\013_\230a\237\250\026\325\333\247\013\242\031G\2713\022\245{\322\2300\370\340\335\217\274S\276\272\365H=P\247\343.\364|\024\021\013'\351\303\264F\253\357\362\366\"\352\360\355\b\350\343\017\024"
+	.ascii	"T\031p\300M\376\275\202\271f\210?\335c\243\001\377hh\344c\261"
+	.ascii	"\204\224\306\2660,\357!\3479\351\3518\002\202\263\222\006\330"
+	.ascii	"K_<"
+	.string	"t\204\031\225\352H\203\250B4\016z\246za\305\221RT;d\346\251\244p-\f}\206\036\363\357.\026{Q\266\265\252:\226\334\353\305\"\235\313\313\371|\306s\2636A\226\317\347'\b\343P\377Wx\221\253s\317\031\337NRR\302#3\310ck\022\202\306j\257\263\005\336w\020\2406\337\005\372j\330\220ad\f\220z\007H,X\253\300\177y\343\001\260R\243\376,\323:\377\3707\271\260G\261\352\fw\217\207\035Z\244\265\255\206Q\357\306\016t6U\t\315\311#\222\340(\f\206J\320\033\265\361\216\263L\354\336\023n\361\374\324-\214\245\301\t\030\365\244\201+\016\306\366\021\234\310\323\004p\036\b 4\211\300\026g\244\332\3262\0055%\372\324%\243!\002\2514q\351\303c\356\342^;\373!\351\035\fEAQ\237\236\202\305\214\232|\023\245\277\244\340\350\254\247\347h\323.\325T_\363\257\302\207\311c\357"
+	.ascii	"\374\030\341\300\231\360\035\207\236\346D\006z\357\004\215\024"
+	.ascii	"du\013\243\021\231\273\343\033\022\347\271\301'\024\363L\345"
+	.ascii	"\264\202\251\2108\332\337`\312h9\3369\t\027\307\307\342{\237"
+	.ascii	"\236\202\222\344\201x-|\034\330p(\002\\UGw\233\274#\374\n\233"
+	.ascii	"T\034\3607"
+	.ascii	"\325\266\n\205nI.\316\234\201]\300\260\221\254\360\255\245\247"
+	.ascii	"L\271\346\r0d\0365\007\235Wy\223s;\365\301\216e\212A(\243\031"
+	.ascii	"\035"
+	.text
+	.section	.gnu.lto_serializeSettingsInfoReply.152.999bf63f7ce1f656,"e",@progbits
+	.string	"(\265/\375`\270\bm."
+	.string	"\212S"
+	.string	"\022GpZN:/\022bj\240\020\245\b\024\325\215k\335>z\302T\250s|\254BhB\001\244\\)\325\355\333\371\326\372\027"
+	.string	"\316\001\022\221\005\363.\215c\001\335UN\003\205\211\343+n\371\347\272\214\335\2324\"M\356$\003\003\001\375"
+	.ascii	"\020\001\277\332\217\366f>\363\331\370L\016Z\371\225\365XT\364"
+	.ascii	"\356\332\355\035\223\\\316\312\356\275\021\324\243\007z\007J"
+	.ascii	"_\205\277\306A5\027\277\305{\241X\263\213I=\372\247q\220\231"
+	.ascii	"\321X\364\3341\367F\273f\2156\367.\033\034e\b\352\321\345\245"
+	.ascii	"\254\237\342\202\321{\301\362\220\324\243=\366\226\371g\207\262"
+	.ascii	"^\371\342>\367\nqj\271w\351\200\027\250Gy\371\240\364\250z\240"
+	.ascii	"\364(\257\314tCWW\250\324,\022\323\354\356\275IM\204\373\371"
+	.ascii	"|oy\376\331\365A\340O\365\245h\257\355\312O{\357x\226\245\270"
+	.string	"%|0\2705\264\3001F\036kG\240\304\350e\177>\nClt]=\363}H&I\231\307p4sr\035%b\001\267\256\322\036\004@\214\\\275^oB\233\016\2553oklY\365,\022\215\233+1\362\260\375\265\243\307\344\332\331\035\020\033]\267>\n\367^\266\305-\033\347\2353\263\0353S`V\251\002\314\262{\255\"\274\275\211\241w\261\243\234A\303\206\364(\332g\202d\336)\213\272\327g\036=C2\207rjy\355\305\253J\234\346!\333\340\034<\034\215\371\210\013\262\037B\330\027\031\264u3\326#\316\252\205\374c;Aw\243ej\210y?\326\266Q3\213\030a_\344\003W-\344\267\355\023\363\236\345ZH\364.\306MN\351\213N\351\321w\207/d_P\270\252\354\223y)\264}d>\323\216.a\334B\230w,/)\035\313\031\351g\371\350hg\006\237\362'\270\3627\272\332\271\bh\331"
+	.string	"\3202\021\320r\001\240e\002my\bhY\250-\017"
+	.string	"Z\016j\313\002v,\003\265\345\237\324\262O\320rO[\016\220Z\006\020\264\314\323\226w\200\226\203m\031\330\226\177?\313\352\317\262O\265\234\372,\243m\271\327\226\273-\333\324\362\231\032\224\241B\006\255\231\325r\313\253\365\244s\343\320-H\216%?\0348\355]\221\\\007\262\371\314\003\352\267!\233h~\2661\270\364\307\376\370\364OO\373\004\371\034\274\273\2672;9=oIe"
+	.string	"\021#"
+	.ascii	"t\200\376\034O\003\350\037\017g%\262\344\\\213\374\315\212|\020"
+	.ascii	"\266\036y\335\212\344\\H\267\243n\332\360\364\337\220nw\3123"
+	.ascii	"\377X[\234\320\326\341:3\031nh\037?\307\247;`\226\206\257\246"
+	.ascii	"g\214\354\202\311\361\235L\247\336+\374\027\277\b\3546\215\220"
+	.ascii	"\335{\217\31403\335\377\245\206]\343]\336\243\243\005~c[\342"
+	.ascii	"\256l\036CxQ\032\354\002\315\226\3105dw:\330;}&\257I.f]\002\003"
+	.ascii	"\331V\026\027&\3300\220mI%\233s\210[\257\217\300\376\265\024"
+	.ascii	"\2250V\026\217\025X#'k\322\276\bl\tG\375\363pL\262A\217\232\255"
+	.ascii	"\332Hm\341~\250\324\327j\037\353kh\237\234\266\257S7b\236\221"
+	.ascii	"E\233y\205\262F\261/\246\375\002\214\271\302\273X\260\273\327"
+	.ascii	"\212\211\231W\234\313\205\237!\003N-\236<8A\221@\241>\235\n\205"
+	.ascii	"\212\250&\224jJ\352\311\004J5U\242\271\351A\212)\250\021M&\222"
+	.ascii	"\232L$\241x\"\001\225\324$5\225\364@\210\243R8I%QEEI%\005\227"
+	.ascii	"\367-$\355\252\225;\343]\233\252\036\032\t>\rt+\251\244\261\262"
+	.ascii	"x\006z\302\320\314\025\257*\373\354\271\037dv\300>r\177\021\257"
+	.ascii	"\250J\215\232\331\004]\324YE\375&\022SG\006\214\225\305{\357"
+	.ascii	"\336{\177}\274\213\264\250\225\372kW\345\322\222Y\210\232'\354"
+	.ascii	"\305\272u\230\022h\242\266L\254\257\241\305\261\222\255CU\214"
+	.ascii	"\317\"=J\240\323\264'"
+	.string	"\317,\257\t\026\251\3216\"\2562\3166V'\016\253\205\3742\277\255c\233\352\220P\017\365\263\254q]\242\344\244a\265V\255\032p\226\206\235!\324\337\202\204[\023\3077 \250\007\364\347\266\254\214u\311\231N\0206\306z\303A\230\305\262\3045\307\272\243\270v\245G\203:m\202\374\222TV\tXj\001>s\304\274\347O\244@\275\304\303V\255=\226\302|X\341\032\200\237\250A8\306\220R\f\215\214\210\2144\311\260\006\240\002\221!*v\021\020\265t\212FD%\347\001\366$HXF\005N\337N\030&\255W)\241\321\210\224\262\t\273>\3435\335\022l\032Fi\331\030\301\034\020\201|\274\032'\255d\b\225\022\332\202L\246?\023$$\b\227)w\203F\320\231fB\003C&\255\302\310\221\352\177c\001\322\336\023\356mloO\313\032\007bW\212\311946\204\345XXW\033La~V\207\315\335\3515"
+	.string	"\376\001\352\243=\353\222\340\320$\3641I!\020\003\254\245!\224\3271Z\354;\326\213\301\376P\037=_\242\211t\314\347\363\243|\252n\224\224\324\277]Q\337[\310\264Iw\207\334B\2626\3172\305\302\003\341\353\032\245YA\031*$j!F\031>T\360\267i\310\312W?0\275K{\247/\323\316\233o\214)+M|\274\317\016\317\201\331\347\020\033\334\235\200\206\320% \312\b~g\034]\207\342\300\254\302\360\365al\262\033\020,\220\376\340\346\0338M\310M\367\003@\260=m\323\206\032l\236\f\311\244\262Y0\352\007\365\303=\212\302\250\243"
+	.ascii	"-\213r,\272\207\342\321\254R\336~\330F\325"
+	.text
+	.section	.gnu.lto_serializeSettingsLookupReply.153.999bf63f7ce1f656,"e",@progbits
+	.string	"(\265/\375`\305\004\305 "
+	.string	"\026\276\326I\220\026R:\211\240\271\221\306\202)\236H?\360\232\225j\311a8Z0m\207\237\254\320$`&\026\220\344\375P\335\275\360R\262\234$^\305"
+	.string	"\006\001\t\022>\032\335M\306\231\307\002\247\034./\032DTU\333\223F\b\2212\311\301"
+	.string	"\267"
+	.string	"\302"
+	.string	"\013\265Onnw\301\234n*\225\372\030f\314\320\302\324\212L\360s#\244H\21080y\267\201\003\250w=\375\246\002\253\274@\300\274{\256\037\201:r\305qj\275ZSR+R\301\n\245?\027\231\276\310\215@\355\017\003\225\224\025\003\263$\302/3\265V\336\317\001\240?\315\353\240?[\307\356\226\313\345\362&\362\213\362\357\251\r=\315\346\337\036G\214zz)\032\267\351\210\302\261s\025q\212\321\0373~\232\022\216Cx\274\354\374\202HevW\322,G\024\262\371\261\237\305\343rH\234\3616}\256p\254\351\210@\363\347LM\370\344\201\200\304\240\301l\033\252\265.\017\211V\337\333w\327\270\273D\273\246W\007\262\202\250Qu\324\356\364["
+	.string	"\3251)TJ\361\362\001\225\263\036\335\305\r\360't\247\237\374"
+	.string	"\2514!^iS|f\027\031\305]\f\023\214\322b\373jW\350d\337 \240\203}}\216\344\3579\362\347y\327\277\263\274:\027\373\346\324\360\342\330xol\274;\034\257\316\344\265\311\361\326\344xs7^\034\216\367\226\362\2467^\333\215\027MyO\223\3274y\333\306\313&\357\013"
+	.ascii	"P\272\260\272\021,\265\302X\242\251j'\223\254\223\375b?\330{"
+	.ascii	"\367\273O\262/\333\034\031\223Y\303*\230e\361Qk\245\220>l?\266"
+	.ascii	"\271\237{1\003\257V\365-\260\314\246LH\177~\003YM\324j:\250Y"
+	.ascii	"\312\177\204\346\272\246\037\274\001\344\345\342:\327h\032\241"
+	.ascii	"\322\207o\275K\301\002\177\210\353\237\375\224\244\013)\326\236"
+	.ascii	"\b\375y\353.SU\303\326g\247\375\240V\372=C\321\266\365\203@\200"
+	.ascii	"\274\334\234F\033}\222\341hD\3272\2229\213r\366\313~j\031\311"
+	.ascii	"lqu\025.]afO\003\365\307\256\301\312q)T&x\0215\036\336\300\201"
+	.ascii	"?\364i\026\223\265\2456\325Q\273c\263\247\315>\217gBe\377pw+"
+	.ascii	"\020*w;\334\211\007\024F/\017v\227\305\233|8\024c\227!\265NA"
+	.ascii	"Xr& \314c\375\334\020\"\320\017\177\356G\240?\271Q\030\275lq"
+	.ascii	"\355\370\315\323\273=\037\177\270\001>\025G\035|HEI\351\321"
+	.string	"\233\222\234\224zg\023\323\322\221\321\231\302W\")\203\317\004\211\242&\\\023S\211\336\336\202\023LH#zF\274\236\021/\351\250\b\211\327[b\342-\330Y\245\023\276%^\223\222\322\022/\207\254\357\253\325\r\323(m\377\017}\362\2271\\\373\302\277\377P\035\235\336!\251\006\016S\243\255\213k\263\345\024\352\223H\003uNW\3454Ns\016\2574n\2346\323\334\254\265V\264\2137\200\346\264P\210\257\343\362\246mv|8\346\t\335\365MsY\360\006\360W\206\236\234\320\237\273F\277\270\300T\325 \300A\255k!\277\255\237\240\256\321\"\027\026\026\263q\365\344\354\342\006\265M/y\241M\361\231\r\372\035\177G\370C\233\276\226Q\2501,\207\214q\b!23\023\314h\333\302\030P\0021&\325m\003\020`g\332$\303\030\031\204L\207\212\2248\271\024\025\220\265\343\3557\263\217h\213m~\220\376!\276\320e"
+	.ascii	",\324x&\307L\235\235Q\\dR\031\024\207\303\345\002\333]\263\340"
+	.ascii	"^D\200\177\263W\207.k\234\204\377Y*\f\240C\201h3\311>#\256\237"
+	.ascii	"O\217\267.\366\300\252\354pc,\357xy\201~p\334vB\243\305\357\350"
+	.ascii	"7\242\025\226x#gn\365)\300\256\266\021\334\t\0338\246e.\261\357"
+	.ascii	"\334)\035\273\355+3\217\314!\320\241\026\031l\tNX\003\334'\324"
+	.ascii	"\020a\214\004n\234\225\021\224U\356j"
+	.text
+	.section	.gnu.lto_serializeSettingsValuesReply.154.999bf63f7ce1f656,"e",@progbits
+	.string	"(\265/\375`I\006\255&"
+	.string	"\352G`\017G\200\332Q:E1\323\322\330\207\201\225\275\177\347J\207\375\307U\r\036\366& \362\036\220z}\346W\251:\232\b\361\351\203\0244\236{O8\313f'\263\310\004\226y\3655\263\205\342\352?-\240\337\376\267\377\023B\244L2\347"
+	.string	"\317"
+	.string	"\342"
+	.ascii	"\307\372\n\247L\316Z\255X\007~.\021\356'\326\2654=\353\005\353"
+	.ascii	"T\250\247\030A\270\237:|\336\375\225ciz\026\030\337\251\325\310"
+	.ascii	"\032/\265b\t-\020\356\347b\035\210\376\304\275\007\375\331\264"
+	.ascii	"\333\006\200\261\026\027\224\261Im\201Sk\035j$\273\327u\232\336"
+	.ascii	"\304\372\362\3264\233\336\343\355t9\234\357\206\236fs\323\336"
+	.ascii	"Lzq\035\221\305\367\200\200I1\357\307w\346\315h\243\311\323n"
+	.ascii	"\3700\213\330\326\310N\306\203u\303#T=\236+B\345\343\270;\365"
+	.ascii	"\270\317\374y\241\021y\332\215 &\321\024!g\027\373\320\352\306"
+	.ascii	"\016\276\201\275\303\222\206\233\"T?\216\356\220O|\232\235\305"
+	.ascii	"U\346CF\231\020\260PQ\362\256\363\024\322\310&\224\034\357w\335"
+	.ascii	"\302\231\2537Gd\216\363MB\255u\371\210\244\372\376\276\373\242"
+	.ascii	"\335\245\260{j\005\315}\2519N\234\256\216\t\364.\213$\376\361"
+	.ascii	"\315]N\342\240Auq\027\253\310\235\334\275\200/\033u\333\310."
+	.ascii	"\221\320\303\276A@\006n\274\005\236\365\017\205\317\362\023\370"
+	.ascii	"\3307\370\257\357\017\360\312\257O\363\366\334xy\232w\347\306"
+	.ascii	"\253\203\362\376\232\327\327\274\275\223\227\327\274\273\346"
+	.ascii	"\325\335xs(/\256yo'/\332\274\347\267\276\246\311\333&/7\357\025"
+	.ascii	"\374,\231A\365\253\263Zm\244m\025\355$s\362\261?\354\377\372"
+	.ascii	"\267~\245\227=\331\230\f*K\037\023\272\354\305v\027\266j:5\255"
+	.ascii	"\036)eY#\002\356^{\260\335}\025\253\2264\036\340~\376[\336\265"
+	.ascii	"\273=\227s5]\271_^\251\352c\230)k[\253\2652\300\375\024\232\357"
+	.ascii	"A\267^\274\006\"\266(\027M\322K\355v\002{M\023\330f\220{\274"
+	.ascii	"\356\265\320\260\315\346\365\317\250D\023\365$\310\273\346\340"
+	.ascii	"\201\177\\\241\261\213;\354]?\251<C;\271>\255#\223k]\256\205"
+	.ascii	"7#6\370qw\225N\006\304\303\222\324\nU$\346cB\230\257\372\271"
+	.ascii	"\"F\214h\364\314Q\007\260o\235\302x\365\346m[RPg'\327\367\205"
+	.ascii	"\254\321@\375;\246f<l`O\375\274\3229m\240y^i\030\013\333\247"
+	.ascii	"\247\200\2156\247i\231A1\333\356\303|I\302|\325\032\035\241?"
+	.ascii	"\036\241?\321\336\300$\255\262\303\211S\236\002R\2654;\371\027"
+	.ascii	"(\260\201\372\226Tr\235\355\323\006\372r\242\236\024\350\263"
+	.ascii	"\307\270\336M\201\304?\026h\036s\222\276\r\031\220ew\262\205"
+	.ascii	"\375.\2774M\333\356\002\345\356>\273D\005y\342t\037*\276\304"
+	.ascii	"\244\324H?qd\244D<\231\210F+L&\342\022\022\212\223\211h\242\367"
+	.ascii	"(\201\022\221\005\211#\024CG(\206Z \031\261\030:Z\"\016%\bn\222"
+	.ascii	"\322\211\245!\246\244\244\245\241\035V}\327/\303j\f\315\251\237"
+	.ascii	"z\235\334]\217\035Q\237V\320a\377\374\264\331\\\344Ok\3135\036"
+	.ascii	"\230\3774Q\037\354\037\222J5\336ur\025\034sB}\256\361\035x\260"
+	.ascii	"\247\202\335\323\237\243e\306\323=?\236>\216!P]\274Yk\255:\004"
+	.ascii	"\017\266P\2270v\235E\005\021\362\201O\250p\262\363tYUA3v\261"
+	.ascii	"\233\253\314H\225\333\001\274\323A\0270Duquz\247\317\346\247"
+	.ascii	"\323\246\032\253(M\332\304R\\'\367/J\302\266\346k#jhPw\226\231"
+	.ascii	"+\2555\001\370\327\273\0314\360\217Ag\210\003\322\224\270\031"
+	.ascii	"\020\016\312\374\272\311\034u\374\264\257/\366x\250q(\243\030"
+	.ascii	"c\304\030\022\022\021\222&I\007\220\002\021\262\262\016\021\240"
+	.ascii	"-5HS\230a\raz\372}\030\216\301\361@\267\nD5V\023b\031V\356\214"
+	.ascii	"\372\263\373\304\323\255\333c\371\277\023\240L\256\354\211\241"
+	.ascii	"\203\007\335\252\n\326)\322\200WI\355\343T\016\334\230\314\327"
+	.ascii	"\367\277\244+(\227\304z\215\300\340\030=\035]Y\273\222,\304\317"
+	.ascii	"M\004V\376\225\004\346[\027\212\217\220cn\217\007]\214/sy@L4"
+	.ascii	"\374\257^\374EzO\365M\317I8N-\342L\353\346\253\207BD\355\231"
+	.ascii	"\032r\nH\330\300,\232\223*X\266\221\030R\2510X\366\030A\303\003"
+	.ascii	"mZ\340\207\325\013\241P\371\316\273\211\371\211\177\364\233\202"
+	.ascii	"\n\317\326\330\312\003[iBZ\362k\023\217\222L\213\331^\230\036"
+	.ascii	"\301\003\364\247\214\241\346\271\271n\315\222\257\213\f\337\025"
+	.ascii	"$\301\353R\244\002y\031\007\311\316\004\032*"
+	.text
+	.section	.gnu.lto_isSettingValueValid.155.999bf63f7ce1f656,"e",@progbits
+	.string	"(\265/\375`K\bE-"
+	.string	"\232Ot\021D`^N:3i\016\224XO\024o\333\272\317\352\244\346\001=\307u0:;X\366\361>\231\377\3550\276\241\242\305\032\321\222#n<J\206\",\263\274)\017\365\226G\224\210\366-Xj\276\255\255YB\244L2\020\001\347"
+	.ascii	"\t\001[\267t\\V\257^2\016\217MO\255\365\351\350.\370\035]:{\031"
+	.ascii	"#iX\217n5\210\314\273g\273\224\253\267\3118Q\255fm\262\324\272"
+	.ascii	"\204\332\246\337\321]\376\250w\364w\243\336\321\335]\006\016"
+	.ascii	"\2566M\3222\316Y\300,\262\005\247\247\326e\261\207<\275Q\021"
+	.ascii	"\321pH(\bH\030\004\376|=\364lN\367\306\033\241a\266)\022*a\342"
+	.ascii	"\315!\362I}\235}\270\326u\306Cf\272\210\234K\006\326\272~\260"
+	.ascii	"P\221\227u\215\365\216\212\324\241iuP\030 :\241\0079\265\240"
+	.ascii	"O\n\356\025\222rV"
+	.string	"\330\362\312\276\304\016\f\353\361\262.\260\336\320@Y\227\217\363\207\306ua{R\366\205v\337\ta\256\322\335L\027\217\323\267\326T\333\342\336\261\320\216JH\363rf\r\026\257\034?\317\006Lh\314\ty\3158\205W\362(\205^G\356\263\200\331\217<!\257\254s)\314\335\326\341\316\\^Gf\237T\255u\031\351\365\365\005\360\335\257\330]\b\273>\035\001rM\255\274^'\027\016#\253\323J\031\331\317\376\034\307\211\2170(+\353\036\254\263\223[\374\331\335\346\306\306\350\003\b>\362\354\347!;\266\361\337\003\244\t\327\375\026\341&\346\310{\226\273\373[\177\260\270\271C^\352\335)*>\222\373;\310\202\230@\357\222(\301G\276\017\367\333\210\313\261\314\223sl\343\356\322\310\235\334}7\233M>\333f\273(oqy\243P^(\224\227\270\274O\n\02241\275\355_\372\362'p\362*-o\322\337\276H'o"
+	.ascii	"\224\367(\310\013\340\3445\002\362\026\235\274D@\336!\312;\004"
+	.ascii	"\344\025\372\361\006\375x\201|\274B\2247\210\362\002O\336\037"
+	.ascii	"\312\353Cy\321\036\357y\3626\312\313'\357\031\020\361\270\235"
+	.ascii	"yc\242\365\232e\305\321\354S\357\320-H\376\366\335\275\332\303"
+	.ascii	"\255pO\345nW\177\013@\nZ\b\246F\310\324B0&\301\246>\342\002\273"
+	.ascii	"\001L\320H\315\265f\2177d\223\206\f\226\035+>\221\035\371\317"
+	.ascii	"~\356C]43\324\3048`mXAB\255 \250\205\232\323\004u\263Q.\331r"
+	.ascii	"'\245\032\020P3\025\230@\201\217\004\022\003s'e\230P"
+	.string	"\330M\301\0266\247\tv\227Q\356\370r'e\216 \260\0234\327\t`\013\027\370H`s\031\245\327\273\374k\177\356\214\354\007\352\f\212\021\330\3110{1<g\267g\036K\222JV\267\367\262p~\037\320;:%\311\271\354.\034\342\033\273Z\215\037\373\311*\323.I%\253NG\241\202q;\356\362\344h\361\237m\250%I<\255\237\022\377\032C\006>r\227\264\332\270\276\376\365\347|\335Z\326\352\334\035\333\210\304\024\273\343\353\344\322\007\364\210?3\013>\240\2076\261\227\267xd\255\206\313m\370\325z|\260\217K\333:\374\322\216\356e\364\216\242\007\350\244a\033\223\322\026U.LLq\200Q\205\342Ge\305\242\253\\\230\230z\201.U\224\n\026'BP\215(R\215(\242(1u\242He\305\242\030\205\264)TTY\025[\244HaU\024\326\237\265\315V@\234\330\221\242\247n%L\274-:\242\250\366"
+	.string	"\245J\025\337\237\366\3720\215T\241\353%%5w\326Yk\255F\235\f\320O\335s[lY\334\334\243\016"
+	.string	"\344y\033.\267\034\256'\r\202"
+	.ascii	"\257\326#\004<\317\223&\317t\b2=\353\035=\352\313\235\265\241"
+	.ascii	"\335NjD\002\222\327I\325\036\320\211\002\320\327\223vG\315\235"
+	.ascii	"\224\\\212:\271<|:\017\021\257\324\\\273J\035\325\357\021u\362"
+	.ascii	"\304\032\266\231\021\231\2426R^N\332\344b\342\244Q\336\005\316"
+	.ascii	"\345\212\372b\316\b\204iI\033\352\344\"5Q7\023\2671\303&J\227"
+	.ascii	"\374M\332\244\001\221M\237\334M\032\205\210\227Jy\233t\312Q&"
+	.ascii	"\274a?K\232\235'mX\334\334\243\271\223rJ\204&evB\235\\a\230\220"
+	.ascii	"\200\237\250a4\305\224shdDD\222\202\244\225\003\260\002\221\241"
+	.ascii	"\242"
+	.string	"z\021@\275D7#-,T\033\256\245\tW%S\241\254\007\325&H\002I\245\241\273z\310\0321\254\007\270\210\334\311\325\351\222\204\035\002\226\320$\207\266\213\337p\035\315\314-XG\375A\246\363\203\317'K\214]\345|i\371\031v\211\355\206\r\310\026\376\376\371\234\220-\333\315\223\226\226\3148ta\312\263R\t\033\352\034\"3z\330\314\233?\345\237\033\031\322\211\203K_\233\177\257\240\206G\277\340V\205^\320H<\362\026\027\257cU!\352\002\313^\024\242\346L\323\353\\\300\310b\305\r\317\250\334\375\361\364\177\"^\252\317\017\241\212>\260\241X(\304\020&\020\217\342d\347SOK\302\311=)5|\322\346X/x\366e\273|\361\001\334d\361%\354c\330\366\305~L\206\216\t\317\375>\230\226e)\2548\315\274\360\336g\326Y\227\314\257S&:\177\205\240y\007JW\t\004\261\007\226\031\3418'M\003"
+	.string	"\352d\201P+*#\033\220!lM\310-\007\013Y\342\036\002\333\302&\237<4L\247\360\333\224Q\247Z"
+	.ascii	"l\261\212\006\212\274lqlFwP\r"
+	.text
+	.section	.gnu.lto_mspFcSetSettingsValues.156.999bf63f7ce1f656,"e",@progbits
+	.string	"(\265/\375`h\005U\""
+	.string	"f\276\331I\200\332Q:\277t\374o\212\240\255\236Al%\314\311\333\316\237gY\004v\264\244\320\306e\327\027\004bl\275\370\177\220\246\202MbU\310\t\304\266\210\221\243\210\"\304\251\357\262\025BAw\346\320\273\225\266\377\255\344\023B\344N2\306"
+	.string	"\271"
+	.string	"\311"
+	.string	"d^gd\367*\355\374\344\006\351\317_\034k\231\277\344L\216ne\364\335\275Qd\246\334k\365\200\025\244?\331*}\325\223\034\261\252A\b4\362x\241\031&\321\334{{\274\013@\177\232\007\200\376l)\266q\332\352q7[-\227\352h\350i\266U\371\277\343\202\276~\224A\031s\374f\322\2045\204<L\t\207)\341\214\254\312\223?PD\351\206\265\36506\275\326\364\\\230\222S\022\311\246IF\246\353nB-]k\321\306i/\242\364\244+\016-\2324\264\347\2019n\232\024\236\270\330\320\025\205\346\301x\214]\353\226X\f\332~\362\351\230\227\2322(#\323-\315\302\275\227\355Z4\236o\316\374\0343O`>\003\004I\243te\366Ia\277\276\257\365\335\030\2524\312`\377\272\314\flG\367\261\313C\321"
+	.string	"\037S|#\364\347\261\376\344\023tY!6\001\355\222\331\352g\373\310\374\b\302\313\205;\212\371Yg\235o\235y\267\372s\330\362\356f\031\007\265|\203Z\326\325,\347l\226q\250\345[\315\262\r\265\\\243YNQ\313\264\324\362yZ6Q\313M\263lQ\313\337\031 \266e|W\327\2755\226k\256\362\2542\344[\177\326\217\365f>\327\026Qq\354\213F\204\364O\370ZP\036\345\350Y1~\327\373\237\322kIv\257\025O\372\023\307Z\346#~\222o\354\344WG\307*\302\271a\367L\001\366\253\255Q/\244\016e0\fQ\002\026\007\363\241\367\205\327\335e]J\273\326\037\266\311\351\264\317u\001i\220N\\f\006\206U\323\255O\312\\G\361\316i\215A\354\t\255\237\374\016\214\352\214y\357\275i\037\371\357\254\263\245\224\256"
+	.string	"\024q\006\r\b=\333\226\271\022+`63\207\016\366\353\331<a\377\230\377E\324\023so\220e|\313\207w\371\2707(A\313\275@\230\237\372\311!F\214\350\223\315\272\244\323\335\004\314\206m\200v\371,f\266\326\240:m\371X\236%\206\371)&Q\002\375\372\223_\242E\004\301B\302\2643\321c\277\352\264\331\204j\t\306i\245:\373\370\005g`j\314>\262\203\277\205\256\272\004\355\031\353\354\245<>D,z`\2342|N\270\3709W\370|T\370N\237\320P\263\017B\320P\013\023>\024=\037\212\236\213\237\236\026=\237\320P\017B\016\003\005\371\b\365^"
+	.string	"\001\t\365n\367\035\305O\3764\210F\236n\277\212^\353_\"\352\360b\252W\321]\023\231y\327l\001\330H\\d\336\013U\201\314\311\027\216\307\342\354Py\004\311^\366\303\237b\365\250J\331\257\252T?\270r\203\th\227?\226"
+	.string	"92\211\022\251\177\314\3002\253CT\"\f\220UJ\244[\037or\372\006\211\343\367\336(\233\002\2533\242\036\311\265.\327M\005ID\211\300\336\032\3279\315\254V\251J\354W\346%\365\217y\0270\330\257\270\346\331\372\326\347\032\2661`y\315\234aCf\250Q$'\tD\b\221\310D\"B\201Z8p\002\021\261\263n\021 Q\310\252(\205a\016GD\020CP\255\302\bv\013\307$\3528\314\203h&\266\344C\334;"
+	.ascii	"\234c\016\244\273^\2042\033\251\026Z+p\320\206\361\211|\033\037"
+	.ascii	"8\2533\307\t\330M\260q\003\355\204\214\316\321/\305\351\354\307"
+	.ascii	"\301q\201\210\233D\345\301\212\t\257|&\351J\376\223\270\253y"
+	.ascii	"i*_\030\347\fx3\324\370Fd\0330\346\262\026U\033]\020\tzX|\020"
+	.ascii	"\0359h\203\222_\232o\247\311r\340\277\314\201\0305ko\321\276"
+	.ascii	"E\0359,\226\240\225\236\035\001\017\223\316\365y\333Su;\b\306"
+	.ascii	"\372x\200\021\267{\007/z\321\350\372\b\025F\ns4&\374q\025\030"
+	.ascii	"\213y\003\233<\227m7\274\fYxk\360/\020\377\001"
+	.text
+	.section	.gnu.lto_mspFcProcessOutCommandWithArg.157.999bf63f7ce1f656,"e",@progbits
+	.string	"(\265/\375`z\007\375%"
+	.string	":C\300\016Gp\234U:\233\355\253\330\217\255\301\304U\200\\\263\271C\325\017\3464\b>\236\227\353\241\215A\205\203\\\215\352\017\337\247`\350\3415\332\t\263v\350\314\313>.2~\253\345\345\033q\002\245t]\327um#\204\020\271\223\f\337"
+	.string	"\305"
+	.string	"\327"
+	.ascii	"N\2272\203\273m\247\364ti\333%\022#\230]ef>\224Gq\342\240\005"
+	.ascii	"\250'd\322\363J\212\231\247m\333_\321\201\326\253\351}\353\325"
+	.ascii	">\362\340\177|=\336N\227\303\335l5\332\214]\325\264o\220/\374"
+	.ascii	"O\0342_\222\367\222d\261\272<\254'\0332*\344\325wU\327Ue\031"
+	.ascii	"\207\334\\:\301F\326\232\213\031\247R\030Z\200\274yuqdnAnK\017"
+	.ascii	"8\321#\346b\306 \251P\027\224\325\257\234@\226\021\310\255\375"
+	.ascii	"\351\352\264\364\371\305dF\205\354q\366b\306"
+	.string	"\036^Rw=\36335\317(dTH\037Wk\307\035OS\005r\274\334\311\035\241R\240\034J\210\357\372-\036\207\267\221\b\371\021U;\326XkN+\347\251\214W\353e)\264m\313\227xD\236\201\316\374!3O`^\223\004^xlV\3473\326\253?\221\366\271\004\353[\230y\f\211O\217\266\025~j\354\022[\243\253B}\346\217D\353L\230\324-c^\no'\231\237\266m\204\037\364\345$\366\362\021_6R/'\370\327\331\300\255\374E\354e\242W\371\207.\345\027b/\373\324\313=\276\314c/\357\372\262\256/\347\3722\256/\337\372\262\255/\327\3722\255/\317\3722\333\227\327\365\262\332\227\323\365r\367\345\033!(z\003\3712q\3326G\224O\033\246~Y\362\257\277\371\365\342mT+\343\315\023*\247m\227\013\2562\204\331\325w1\333Tf'f\033\263\225%\r\322\313\374\345\2518\275\n\214"
+	.ascii	"\273v\310\365\003i9\343\276\314\016 \004;\001\227\325\300\241"
+	.ascii	"\b\252"
+	.string	"\205\274k\266\331\244\031<\267 \017\037\356\211G\275\362(\220eFi;\372\332\237\303\005]\373W\376\223F\t\304\251\344Q\353\344\257\323\312Y\204\266\226\261I\255\273\002B\247<\316\324NR\3314\355{E\277|\317\332I\276\275\340\317RTN\245\017:\327E\346\336\275W\b\021HUm\373tb\256\213\232Y\txO\344\267\321\262\023\026\325\302T\355~\320\002\230ReO7\312\270\023(\356\211\335'#2l\341\207tl)\323N\362\202\337\276\211q\271\031^=\\\273C\315\274\304tO\274\375\256\373\310\264\350\204\r[\310\347\362kA\303\204\267\017;\255\234U\335I6\303?c\303\r\030\277\214\024\230\030\376\230G5\301\360\303\340\331\302j\211t\341\0071J\220Pq\241D\212\021J.j.Z\220\350\023MJ\275\241C\006\022K\300\225\201\fV\264X\022\0014\361\003\232\370\251@\241\264\364\0036\265\3701"
+	.ascii	"\300L+J4\375\\015\375l\313\366m\204s\305)Rh\177p\325Q\2342ui"
+	.ascii	"<\270\006\025\267p\354\214\036\244\be\013.\370\340\312c^\337"
+	.ascii	"\256\301\327r\246\320\321h\224\354\207\3676?\263\271\265\245"
+	.ascii	"G\324>\\\005_\343\232MB\343\370\210z\267[?\013\330\323\311{\222"
+	.ascii	"\343\277X%4\241\224\351\022to\350\326\332v\001\303=\321\250\213"
+	.ascii	"\242Z\310\006\332\326\347^\327\332\006\005\365\332%\350\357\031"
+	.ascii	"\200\006\016\226\216\326\037\243u\n\246\234b\240U*\312\2550E"
+	.ascii	"\037\303\334\254O\305uf\326o\276\207E\251$\323\004\327If\277"
+	.ascii	"j|\026\353\231M'P\333Q\007\200\215\250aL\305\03022\024\210\314"
+	.ascii	"H\222T\322\001\340\002\021)b\007\021\020\255E\314\221\244I\252"
+	.ascii	"\003\301\004=\\\324'H\261\025\332\336]`U\225 \315\b>S\244\177"
+	.ascii	"\355\253\204\2028\030\001z\006\310M9\261\0174\257\377q\267rq"
+	.ascii	"A\001m@\026M\0023\013+B\216\250\021`\204\304\007\020\316\007"
+	.ascii	"\315`\254?i\223\t\321\221Qh\231\253\255~\2154\f\351\301da\230"
+	.ascii	"k:Q#HJ~;\240\013?\263\227\202:\033\214\272\275\354\271\336\260"
+	.ascii	"]&\\\204f\026\007\371\007\216Jz\332\346I\256\232\003\363;B[\235"
+	.ascii	"T\237k\201\277\213\377Q\035\237\317\024\311\314d\f\355E\347\246"
+	.ascii	"%\002\022\024CI[`R@\206\340K\326\001\321.q\033!?\366d@\241-\257"
+	.ascii	"\312\333\300P\260B\312~\246\024\f\372\370APL=\331!\306\311\341"
+	.ascii	"\261$\254\200\r\230\224:\324Z\257\347\342\234\025\332\325\323"
+	.ascii	"T\271\350\354S\030\305\340\334\240\rC\004\025"
+	.text
+	.section	.gnu.lto_mspFcWpCommand.158.999bf63f7ce1f656,"e",@progbits
+	.string	"(\265/\375`Q\003\225\026"
+	.string	"\266\250\220J\300\020)\035\332c\276}9\017\013E\004\037\210\036a\027J\256\305\035\243Ys\246\327\212\304\245\336\020\351\236\240\337\254Y2\031\302\257\215\242=t\003\b 0\b\202\320\344\220\233\034V\221\024\265\005E\266v7\037\333Z#{\313\235dx"
+	.string	"u"
+	.string	"\177"
+	.ascii	"\264\327\255\271^g\264x\034\371\334\375\210\223\350=h\302\003"
+	.ascii	"t\357(5u\027Iv\200\353u\213\017!_]\027@\276no\327J\004\330\276"
+	.ascii	"\002R\025l\210lt\267\215;\274w\262R\236\275}\353\344\025\034"
+	.ascii	"\372N\346\274\322\021\r+.\300\206\024h\210\013\016U\345\0208"
+	.ascii	")\200a\316\0316\254\241\263\356>\322\247pH3g\353\244\273w\006"
+	.ascii	"\2078\337\326wwew\023\35421%\377\b\204a\252\206}\273E\337d\342"
+	.ascii	"\356iw\367\362\316\356\203\376\217\030\314\243\343G\337\362\305"
+	.ascii	"\377\365\241\242/Y\347V:\227\326\271\\\347N:\367\"2\017U8\247"
+	.ascii	"b\352\276\311\302\321S\325\351\303\207\376\242\377\350\274\373"
+	.ascii	"\023\335\350H[\226\030\350\375h\206\266\216\002\251\240Ow\361"
+	.ascii	"@\021o\366\352\336\220\241\251\304\365\022\027\352}\210\367\306"
+	.ascii	"\351[\020!%\224\321\335\001\334b\346z\244\0012\247\203\024\222"
+	.ascii	"'\327c\214\330<\177\360\356me>\2703 \373\266\344\363\211G\030"
+	.ascii	"69~"
+	.string	"3\213\214R\321\342\301&=K?)P\264t\260I\217\022\326B\001o|\352\307\214\253\027\224\344N\306\030\026\2013\361dT\335\215`\277t\023.{\236\327\205\200\233\017\342\310W\030\233\364\030\3758\375f\326\354n\0373qg\310\222\371w\025B\350X3o\254k\276x7\302n>\0309\230\224\030\tUF\345\205ar/|\323\355Xf\367\200\367V\213\331\341Rn,\266\033\213\r\306E\005g\273\351v\266\232ls1+:\233L.\247\263\225\305>m\336YX\322SO\365`\231\320\030Di/\21558\306-\026\226O9\265\203K#\bJ;,\311h\3050&Y\370\002\202\232\3721\315\306&\355'\234d\223\366\005\f\016\3244\0052+\345\312\267\311q\026o\301\333\363l\003\024\024\2561E\351\004C\250a\\\244\214QH&\020\021\t\022&H\334\320\002\2311\242\007\021@\255\206\002\252J\2135\003"
+	.ascii	"\302`}\256T\326%6\230\255(\031`\302\330a)\200\b9EKT$\b\250\017"
+	.ascii	"\356S\0254\007! \253+r\030\027\2472\341\271\313\366\024\022'"
+	.ascii	"\265z\034\230\273\336\207&\027d\264X\027p\2575\243f\312\337\317"
+	.ascii	"\354\302up\357\222\271<R5\232\217\037{Y\234R\\\023urd\206\377"
+	.ascii	"61\002\006$\210\207\361 >\343\272\333,\376"
+	.text
+	.section	.gnu.lto_mspFcProcessInCommand.159.999bf63f7ce1f656,"e",@progbits
+	.string	"(\265/\375`\207i5h\001ZR\326\177R\020(G\355\214\001\224g]E0p\224w\242\343Nz\021\357\244\023\214\3040\230j\254\n\234\221H\"\021\361\256\032\335Jv\367\365\275\363\363C\262\241\323)"
+	.string	""
+	.string	"\376:\204\243"
+	.ascii	"G\301\325\031C\030\226\bp\240\310\237N\233\246\274X\317G\204"
+	.ascii	"H)SJ)\264\007I\007V\b\334Z\256sg\271\316M\345\235\033\313u\356"
+	.ascii	"+\327\271\247\270\316\275\203\353\334Rh\234;J\321\271\255h\234"
+	.ascii	"\033J\321\271\237\3208w\325;7\225\353\334Nh"
+	.string	"\234\273\211\353\334Lh\234{\311;\267\222\242s'\241q\356\251\242s#\241q\356#\256s3i\234\333\210\353\334R4\316\035\345:7\024\215s?\3218\267\223\353\334M4\316\315\364\316\275Ttn\245\242s\027y\347N*:7\022\215s\037\025\235\233\b\215s\033\025\235{H\321\271\213\336\271\211\212\316=D\343\334BE\347\016\242qn!\256s\007q\235\033\310;7P\n\347\376q\235\373\307;\267\217\242s\373\274s\367\024\235\233\307u\356\235w\356\245\353\334:\256s\347\270\316\375\272\316J\024\316I\327\031\211\302\371\350:\033Q8\343\270\316\033\240q\326\241\350\234\203\353\214\203\353\334\303u\346Qt\336Qt\276):k\300u\276\341\204\263\016\3279\307\tg\034\256\263\r\256s\r'\2343\340:\337p\235ix\347\031\\g\031B8\333x\347\030\\\347\032!\2341p\302\231\206\353|\201\023\3160\270\316\026"
+	.string	"\341\\\201\2423\005@8O\240\350,\001\020\316\021xg\b\024\235\037\340:\277\360\316.\270\316\016\250qn\300;\267Ptf"
+	.string	"\bg\026L8/\240\350\274\302\004\316\np\235\023 \2013\002\\\347\003\224p6\200\353\254\002\t\347\002\270\316\004(:\017\240\350,\200\242s\n\256s"
+	.string	"F8\003\340\235g\270\316(\214p>\341\235M(:\2270\302\231\004\327Y\306\b\347\021\\\347\030\256\263\b#\234Cp\235A\030\341\374\301;{\360\316\035\270\316\034\214p\336\300u\2061\302Y\203w~\341:g\340:\273p\2351p\235m\\\347\013\\\347\026\357l\201\353\314\202\306y\205\353\\\201\353L\201\353\254B\204s\n\327\031\305;\237p\235k\336\331\204\353<\001\215\263\004\256s\t\032g\022\256\363\b\032g\021\2563\r\215s\b\327\031\204\353\\\004\341\354\026\235?\200p\216\240\350\f\301;?Ptv \204\363\f\bg\017Eg\342;\017\337Y\370\316\355;\263\256\363\372\301\371\337\271\3312\025\232`rV\234o_\347\365\006U\313\274Ov\013\225\363\264\347\264/\273\251\335\202\335\201\335\322\3561\335}\335y\335w\335v\335s\335\317n+\335W\272\261t\223ug\351>\353\020\314\355=\027@"
+	.ascii	"\365\341\345\302_v\035\337\341\031_\206\251N9\r=\207\006Q\224"
+	.ascii	"\252\222\0362\254R\253L\3102)v\274\336!\017byvZd\336\367uA\246"
+	.ascii	"\247<#\255\0218\3551l6\260\206V\240\340\336\373\2765\374\371"
+	.ascii	")"
+	.string	"\361\273\342;\333k>\356\035\256\272\220\231\241\365\270\265\250\250W\357\373\316Dy&\357\306\2077\356\355!\2737\352\fC\274\2517h\0357\224g\3548m}\261\b\340M\253\312\3060\216\233N\256\303 {\256\206~\177^\242\335[\326\336\373\n\271h\226a\0306\353O+\270\265p\303\361L\263\317\rDy\243ja\330\354\032\035\322\332\034\322\032\2160\201Hk\200Hk\177H#\214Y\323\321Z\370\233OMK'\314!\275\357;\303\032h-\374\200F\232\226\336\367\235)\301\214\344\016k\261\036\353\2626\353&\317\234\031\373\355yu\030\343\204\356\275\257W\002\262\354x:\357\366\336\327+\0052\343\372\"\225\340\024S\365\276^&`a\032\341J\217\024\304\367\215r\242\005\204a\263\334Vz\364K\364\366\2172\316\274\275\367}]4\313\034\254\316\334^\375\205\354*9\220\370\360\356\200\375\274\0306\313^C~g\356"
+	.string	"\004ds\031\371\337\267\351N\313\373z\275`\013\206\315f\265\026\222\225*\360\350\020m\340t\363\t#\363\276/\214\024M\3236\2736\210\266\331G\342\272\323\256r \363\025\213\256\007\017\036D0\177\005<\354\325\253\371\305P\331,\310S\2262\031\016d@\376\3431\354\307}\314\307{\254\307Q\316c1\214\307w\fe;\256c:\236\3430,\307q\f\307O~c7v2\030n\343/\314\306k\254\306^8\215\2730\027\336\302h\254\205\233|\306f\234\205\313\230\214\307\030\013\213\361\025\016c+\f\306U\370\213\275P8\301\204\022H\2201B\f\021B"
+	.ascii	"\341\003\017:\340`\003\030\032\274\310\300\005\0066\027\264\260"
+	.ascii	"\200\305\212\n(P\221\002\305\211\032\023\023HP\202\304\b\021"
+	.ascii	"4!@\024\335\017\021\360 \004\01780\343\2018\024\266\354\372\\"
+	.ascii	"\206\251\\u%wN\263\240\367H\235\247\323f\251\367\264\313b(\310"
+	.ascii	"\264\231LW\363\234\003\365\232\001\327\022\266\256\222\230\210"
+	.ascii	"ZF\327\257\"\246\346;\1774M?\352\220()\275\3461b\252\354W\005"
+	.ascii	"z\322\267\n\205\b\321\305\340\323+\322e\354\234\371\342\244\240"
+	.ascii	"\315{_\364\220gQ\021QK7\347\274A\255'b\360\332\234\357\2764C"
+	.ascii	"\277\2609\333\2555\327\2555\235\351\316\232\347\316\314\234\303"
+	.ascii	"\3101\2259\307\t\235d\264\260\340\004\311\236<\337\272\232\335"
+	.ascii	"\272\270\234\235+\006M`\206\300I\211\331r\006\323&\"j\231\345"
+	.ascii	"\374E\213\2123[\213\2655-\2545\265\020QRW\315^LD-\251\2348\247"
+	.ascii	"ua.&\242\226LDD-\2278o\231\266\n%\316hxO\2644\235\234\317\314"
+	.ascii	"\230\234\263p\031\223\210\250\245\2223Y\016[c\201TX\220\232\305"
+	.ascii	"\220\202\234\257\bi\016\023\"\"j\031\304\331\312_\225\301\200"
+	.ascii	"\232\253\230\210Z\002\3758\177\255C\242\244~4{\231\210Z\376X"
+	.ascii	"\211D-}8\n\325>\241Ju\023J`*\343$\b\266\214\025\203=4\300\216"
+	.ascii	"\023\022\\i\202\234\374L}\004i\307\220B\021\"\343\"L\205\240"
+	.ascii	"\004B\320\007=|x0\355\340\216\203\265\r\342\204\354\240\b99\214"
+	.ascii	"\325\204\267\325\257\360(\351\246\006L\177`\374\205\2633hr\201"
+	.ascii	"\204\301\016\0376|\323\013\326\272\305Z\323-8k\026+\013\254\251"
+	.ascii	"\227\216\023:[%\270\302\243\304\314W\254\037\262\254\033`\361"
+	.ascii	"\n\312\232\002\262V\261r\320|\032\3548\241\261\025\202\252\267"
+	.ascii	"eC\021\"\363\024~=\034\303w\306\027ET\326(\272\374D\315\336\226"
+	.ascii	"\233\320\362\tTD\0211\265\004\353\001\256\360\240 \005K\260\243"
+	.ascii	"\255\002\212\020\025/\261\366\022%\247\216\023rZO\350\022\006"
+	.ascii	"\256\241\ba9\t\275\021+k\307E\254\343\204\250V\031GL\260\032"
+	.ascii	"\257U@\021j\342\"\216\0209i\232\266\02004A\254oeO\242\210\230"
+	.ascii	"\272\270\ny\202\234t\234\220\2225\306toKC[\005\024\241)w\217"
+	.ascii	"\020%\351\017\202\035A\353$i\036\\QPBgg\"j9\270\272\220\204\324"
+	.ascii	"p\255\002\212\220\223C\360AJ\260\037\030\206yK\302\027E\304\324"
+	.ascii	"\016\314(\265\007\2455\205\n(BE\234\030E\304\324C\025QDH-D\362"
+	.ascii	"\361\266\343\204\230\326\024\357\373\316\f\3658\273J\320\004"
+	.ascii	"fH\307\t%\255,\340\244\304\314\f\361\370\332\315.\246pJ}\232"
+	.ascii	"C\242\244\004\373+\2006\227q\322Lugsu\n\272d\331"
+	.ascii	"\366\205-\232'\006\257\352\266\344ah\007\253H\323\022\027\265"
+	.ascii	"IS\022\220A\275$N0we\2300\341e\275e!\033\303r\025\"jI\246m*"
+	.string	"GR\035%\344\224\201\013g\274\357\313\3763D\324\334o3\317\304\300\334 \230-\260\006\314I\254\177&\263X0+OMZ{\314\004\370\267\344V[\002\356\215\347\213\326;\337-\331\365\225\004K\206\265\315~\036\212O\301\234\024\373\266\344\330\360}wB\340\377\322C'Y6D\361=\344\312\n\026\227\216Wg\230=d$\270\321\262\\\317\352T\253\021\360\023\317\234l&\321\274\177X\256O\261\3639\\\363'\276\310S\r\364\241\326\274\217u\tN\360&\276\243\375\200\260j\235\017u\006J\222,%\236\t\242k\332\t\376\253T\365\300\234;>\235\340\033\332\365\027\244m\272\374\2369>H\342\005\227\340\231\223iI5.\022|7{\205B\0258\342\231<sG\363]\236U\222t\321\316\364@\234\326:\3237^\023\243`w;>\345~s\320\354D0\375w\371\021a\324f\t\266o\236\231\255P\202\214\304\037\251"
+	.string	"\261F\264=\026\261+-\214"
+	.ascii	"\023\361G\252?)\3153'\235\377el\301F+\357\225|c\021\003\356\273"
+	.ascii	"\222rC\256\027\222s\355B\333,kF\363=\345i\347s\230\237\312g\271"
+	.ascii	"\300\315\204\223uI(\264m6\3047^;\325_\022\222\216W\307T\035i"
+	.ascii	"\241\001\201\367WSZ'\210o\241]R\212\317\234\314\373(F\024\017"
+	.ascii	"\345\255\222zI\276\244_\322\257m\266M\373\351+~7[\004\\\227\325"
+	.ascii	"s\252yF\b\367\357\251\2344aB\342\357\303\273\037\276\304W\027"
+	.ascii	"S\004\317\234\f\374$\312\241\2662\365\276o\b\314I\351O%\005K"
+	.ascii	"\340\344\340#IV-\260{\3377\204f\371\231\177D\231\303\315\244"
+	.ascii	"YV.\225<<m\263$\006!\370\b \370\022c]J\257\323\225\004\342\231"
+	.ascii	"\334\320F@\340\025\367\201\237\341\201\230kX\3377\n\205\236\353"
+	.ascii	"\336\253\342U.\301g\370\256k:\345\017\026v\357\373\366\017\263"
+	.ascii	"\022H\031\304\373\207\233\256\213c\\\325'\317\3470{-\213\317"
+	.ascii	"\344\007\310>\274\335\013\225 ]\264/=\320\322?\360)\330\370\007"
+	.ascii	"\234]\355\013\332\231\267\321vj^\252\334\f\332\227\376\355~\002"
+	.ascii	"\036\301\272\236\246\245W\331\201gf\343\225\246S\006\325L\275"
+	.ascii	"\357\033\343\377~\372\034\370\206v\210/.\301\347\316\347<{-\233"
+	.ascii	"\235F_\246\037|\200p\022\251E\360L\356\236\371\022\334\001\371"
+	.ascii	"F\214\355\313=\2533(7\363/\227A;\327\317|\3035\002\230\323j\017"
+	.ascii	"u\351U\366+\335\315\356$\\l\0200\377\211fE\364\200\207\347/\362"
+	.ascii	"J\312\241\"\245\221Q\333\254\233\375\364\351x\225\211\357\341"
+	.ascii	"\373\203$\245\222\367\017\361\235\215\013\r\256m\270\272\034"
+	.ascii	"x&\217(\363\023\342\341\215\232\246\214\317\215\370G\357JC&\245"
+	.ascii	"\037\276\220)U\363\241\352\314<\323\237,azx#E\375G\317\352\224"
+	.ascii	"\351\252\376\321{\230#\243\347\203\264\\\343\274\214\021\237"
+	.ascii	"\3115e|B\204\334\306v\346\355J\373D\336\213<\020\363\006.|f%"
+	.ascii	"\224R\312\373\207S\024y\341{`\222Q\033>\263\333\326\374\204o"
+	.ascii	"\304\333\330>\221g\253\004V\301\334v|\372S\236\324\2655\255w"
+	.ascii	"}7\233\030\005\006\335\361)w\327\264\353{\327\263\373 -\275\312"
+	.ascii	"\374A/d\344f\302J\246\022\211\367O\263\334J$m\263\353'\235T\261"
+	.ascii	"\220t\274\332F\345\316\330g2\f\355\377\r\330\333\216O\371\211"
+	.ascii	"\374\177\221GO\317\207\252\343Uv\261D\331\304\373\347\211\274"
+	.ascii	"\217eI\335\332&+p\275\300]\353\231\225O\224V\336?\336\366\376"
+	.ascii	"\225\345\367\334\371\034\366jw\263\211Y{\317\034\037d\366Z\376"
+	.ascii	"\222c\226\356\3443\231\331\353\232g\344\370 w\317\240Q9R>\363"
+	.ascii	"\007\377\3174\320\256\207\337\247\317\357\313\222\177G\357-K"
+	.ascii	"\325\373\364/\177\016\234\223L\325\373\016\262S\237Sv\3017?\240"
+	.ascii	"@v2\034\215Au\033\303\376\007f\251\352}\342c\357k\373K\252z\237"
+	.ascii	"\242\354z\034\225\021\206\364\005\217]\fGG\240\"5\233\035;\224"
+	.ascii	"\243#tY\3632\307N\327\305\217\252*\216]\216\213S\325\033\373"
+	.ascii	"s\213\336\232\326\025\030v'\332\232\235\326\025\033\373\027-"
+	.ascii	"]^\330\325\316\332\252\336'.\354]\332\354\254J\013;Z\026>\262"
+	.ascii	"*3\3663\216z\365\251i\251\311\310\330\313z\354\214\214\030;\226"
+	.ascii	"\306\362\306\244\352}\262\302\036\306Q\022\300\254\301}\261W"
+	.ascii	"y\013\374\301\305\336\305Q\031b\234Y\354Z\034\225\221\206\324"
+	.ascii	"v\305\216\205\306\265'\205}\007\216\016\317\372\351\035\344\252"
+	.ascii	"z\237\240\260[q\364\004/kY\250\330\2538z\302\037\022\030\023"
+	.ascii	"\366&\034}\300\275\257$\354J8\nC\f\322\tG\330\221p\324\251c\232"
+	.ascii	"\226J\220b7\"\002\031\273'v(\020~\354i]\275OL\354M\034=A\214"
+	.ascii	"\007E\330\2258j\002\025\351\305\021;\022GM\030\343b\b\273Q\013"
+	.ascii	"\347\332\020;\021\013a\033\031!\354A\034\035V\320<l\025\213\326"
+	.ascii	"\325\373\004\304\016\204\243*\204\255\315\264\261m\366\0073G"
+	.ascii	"W+vMK\357\233\323MH\346\250\377\274\357\373\2766\315z\225g\217"
+	.ascii	"\262\312\274N\247r\277s\375\207\371Pu\274\312,\334\265\236Y9"
+	.ascii	"E\211\345\375\323\337\315nf\231\363I\272\267\3639\314^\313\376"
+	.ascii	"j\265\352\364g2\367W\253U'\277\021f\347if\311:\257\231\345r\235"
+	.ascii	"Y$\236\323\274\362\371\262y\325kj\363\232\327\324\346UL\0136"
+	.ascii	"\257u\035\330\274v\265\264y\335j\273\346\267\353g\363\313\365"
+	.ascii	"]\363w\351\276\346\317\322g\315O\326g\315\217\325V\232\037\252"
+	.ascii	"\2574\277Sci~\246&k~\245>k\376\243>k~\"=\246\371y\330\331\333"
+	.ascii	"\232\253\333\253\270\316\376\345:\273\227\353\354]\235\245\331"
+	.ascii	"\271\272J\267k\275\263\033ag\227r\236f\217jj\263C\265`\263?\365"
+	.ascii	"\230fw\352\276fo\352\273fgj\273f_\352\263fW\352\263f/\022\302"
+	.ascii	"\331\223(pv$\327\331\217\\g'\342:\273\221\353\354C\\g/*:;\221"
+	.ascii	"\ng\037\n\341\354B!\234=\350\235]H\321\331\203\274\263\003):"
+	.ascii	";\320;\373O\321\331\177\270\316\356#\204\263\373\270\316\336"
+	.ascii	"\343:;\217\353\354;\256\263/\337\331u\336\331s\336\331\337\242"
+	.ascii	"sW]\347\246\276s\017\272\316]\306un\301\242sO]\347\226\026\235"
+	.ascii	"\233\214\353\334\201\256s\003\272\316\375\367\316=\306un\277"
+	.ascii	"\020\316\335\347:7\337;\367^\321\271\365\\\347\216\272\316\235"
+	.ascii	"\367\316-\246\350\334xE\347\276{\347\206\272\316mWt\356\272\242"
+	.ascii	"s\323\025\235{\316u\3560)\234[\316u\356\270wn8\327\271\237\357"
+	.ascii	"\334oE\347v{\347v\026\235\033\314;w[\321\271\277\204pn6\327\271"
+	.ascii	"\327\\\347V\013\341\334^B8wZ\b\347\356\342:7\027\327\271\267"
+	.ascii	"\024\235\033\255\350\334Z\336\271\233!\234\373\354\235\333,\204"
+	.ascii	"sgq\235\273\314un2\327\271\307\\\347\306\342:\267\230\353\334"
+	.ascii	"W\212\316\035\366\316m\245\350\334`\357\334U\\\347\376r\235\333"
+	.ascii	"\313u\356\256\024\316\315\345:\367\226\353\001Q\276\203,5\025"
+	.ascii	"\254\202\b\177\024\311\263\372~\023\366@y\022\274<y\346c\220"
+	.ascii	"pG\031\324\224\234C\361\344\333O\230S\365\307\254\264\002PQ}"
+	.ascii	"C\243i\317\035\0028\031j\251F\314\234"
+	.string	"|\253\t6y\022\272$1)j\245S\3119\024L\276\323"
+	.string	"\227\3741\2539"
+	.string	"%J\276\241\321\255$F\255\237\223\277$\337h{SO\302\031\033\222g>\036\265Qe\020\224\344\\\r\353D\362\235\205w\344yd\235\355\020\305\212\231\324\322\355\300\374N\2233\362$dI\222z\346\243R\013g\244\222\234\253\221\372\346\342\026\365$\210A1\265`\270\222s5P\337ilO\317#K\f\013\251\bR\224\310s\347s\242F^m\023-\022@;=\363\321i\213\323\313\250B\341\221y.\003\237\313\024\232\236\371(\325\236\031\255$\347P4}\263\2251\375\221J\231"
+	.string	",-\275\001@\211\331b\021Sj+\202\244\265\002V\204m\3063\271\223\376\006\314-\351\033\212\247\366\334\371\034\024\220\222\264]ZZ'\322w\233\326\321\313\030\303FdIK\245Kr\016\005K\344\233\313\024\243?R\031\2035\244I+%\212\3209\344\205P\274\256\242g>R\265O\224A+\252\006\213^8\206\267u\002\021\3217\024/k\350I\273\304m\035\034\372\266\232\022z\031\321\244\240g>Z\265G\224A\317\205\214K\316\325\260fA\337S\236Z\251\026\362<\250\344I\221\202<\363QJ\013e<\361\024d\fO\312V\233"
+	.string	"dJ\313dl\261t\024[\241d\366\323\247\003\344\205lxJ%"
+	.ascii	"\001}C\361\216XcxF\317%\t?\317|\314j\211(\273V\264FO\324\375"
+	.ascii	"\343\373\347\333\247\313\362\307\267lxC\217W\005\213\214\366"
+	.ascii	"\3617`w>\276\241w\325\021\332g\253\035R\006\255\020\022\246\371"
+	.ascii	"\274\020\356Np\205B\331b<\223\271{z\276\241wR\236g>v\265@\224"
+	.ascii	"A@\355\017\317\267hw\201;_\255OO\313\323X\337;s\353\362\033\353"
+	.ascii	"\331[\347{\371\355\237\017U\347I|\335\371\345"
+	.string	"\200\2659|\fk\337\243\330\t;.l5\347[\270\273\266~\237\3718\306\2261\326\330MY\301c\231\331\261\331l\233e\007\373\375v\354\216M\371\314G46\320\b\250\374\272S\243\"B\362\231\217\\X\277#\033\333\207\374\344\267\017\025\371,\364\256\353\370\314\3074V\357\310f\201\035\223\215\266\306?\032\277e\273\333\302Qc\361\216l'\240\354\335\261\315y|{k7\3608\337>\324\r<\313v\227\345\3276wX!\350\360\314G8vN\207\357\200\212\031\326^\333\334Y=A\310A\216\225\213\313\201\t\2079\366\315\355\017\207\027~\335)\365\250c\333\276\230\365\370\226\355.\211\3073\037\241\254\232\221E\032\353\345\210\227w\324\323k\233e\363x\320H\357\216\362>\330\301\307nAc\347v<\313WW\275\361c\317\314\332\264\233o\341\3524\360\314\307?\226L\031\264b\212\305\302\216\035\003\217\322\243\340Q\260\325"
+	.ascii	"[\235\240\3375\317\360\340"
+	.string	"\231\314\307\301\272\267\033\236\371Xe\255\030g\226\315+6\260*78u\344\260]Q\326\270\266r\274\216o\037j\216o\277\352\332p,Y*UjXW\1776<\016\033\276\375\252c\253\201\207\225\302\304K\024\253\260\032\276E\253S\313\3003#}\330*$sf\331\234J\243r\302\016\336\370\f|\373Po|;V\227F\303\017v\211\221.J\222\374\321\360\302\257:.2<3\022\210=b\234Y6\2710'w`\231\310 ,\r\224\233\217\024k\004\0314\204,2j\233\025\206\311\360\375W\343cx!\222&\261\016\"\350\232\266\306?\330Y\215oh\035\326\363\264M\235\024\016\236\311\314\0308b\233\220ID\251\263(oLKs?}P\220LH'\357\037\f|\313W\247D\003\212M\252rC:j\007/\3604.\360\302\261\272$\030\244\330!H&Q\352\214\211\263\210\310\314\002\017\203\005\236e\253;\252"
+	.ascii	"\0226h\n\214\220 N\n|\005(\360,\264\316h\002I\330\037#m?|H"
+	.string	"\340'\360-\201\242\b<3r\t\313\243\034\"J\235=}aN\236\261;\310&k\t(=\261,\254\016\273DR=AZIi\037\360\021x6\355\205\207\300w\236\017U\347\001\317\242\325\r=w>\307\003\031#G6\020vM\373\302?\230Y\340\013\337P:\"D\220\300x\240w\264\316\365\017fV\347a\350\336\236\032<\223g\246\031<\317\263J\224.\332\235\036\310\351]\370\216\2029\340]h#\316\214\304Bfy\3778\340\373\257W\301\247\345\347@\303tm\275x&;\375\363\374\210\272\"j\r\360Z\247\334\254Y\311\254R\344V\027\362\353\253m\366\007\177\372\232\274\205gF\206!\305\274\177\032\300\200o\341W3\037*\003\276\377z\304\027\235\232[\021\317\221\fX\030[\307(\207P\364\255~\31023d\263\3316\333\013x\026<t\001\332\025~\001\337\232\365@Y\256\360-\033]V\231\266\241\303r\241"
+	.string	"\2645\212\344\222\227\200W@\002\236\375\242sB@\332z\207T\203\262a\007x\004\034\340Y4:&\003\260\255t\310\2669\025\336"
+	.string	"*<\373E\247T"
+	.string	"\347\032\207|\253y\256pH89\344\334\\\333\354\372G\200/\300\267\017\225"
+	.string	"\317~\321%I\333\206\356\350\211\301"
+	.string	"\352V'\230\264\001<\013'W\025"
+	.string	"te[\023\300\263P\271\301\024\236\031\211\267\246)\203N\330\255\\\326.\310<\244\036\222\017\311\3276\313:S\370n6\rTN\020\260y\206\3153\231\375\344\300<\227\237\303\315\343\314\310@\244\024*\327\366\\^\020"
+	.string	"\301\365,Y&"
+	.string	"e"
+	.ascii	"\370\223\266\2301\343}L.\315\002\024\236\0319\270b"
+	.string	"\321I\006\275\030D\341\333/\354\204\357(WcV0c\372X\270h\023\276\243Lx\037\223\353*\341\231\221\325\265\2122\310\307`\t\337~]$|\f\275$\0319\353\026\0203\031\337jO;\237Ce\204\217\021e\213\261\\\257b|\213&\207%\002\317*\205(L\033\333\307z\021\276\304`\317\230%\224\020\276\227\256\362\244H:^\305\372nv\021*'\345\271\3639+\236\311\304/\024|\226g\357P\270hoz\321\336\364B\277+Y/\306\216PU\360Lv\025\034\2469\255m/gJBRt\325\310\0035\375gy\020H\200\004\202\360\314l\254\26261~\300\234\364Y\231$\177\f\211$\203^\264\007\017\302\267yJ>\370\027I\334\310w\360\036|\367\214Yz\225\237\354;x\023\177+\005\317t\366Z\266\004]\177^*\336\b{\323\203\300\345\212\034\331\267_\203\030\223sz\356|\016\005D\312\310\245\340"
+	.ascii	"h=\322\224\fj\301\201\324\006\037\203\216\r\3063'\203\254P\306"
+	.ascii	"\341\372\244\214J\006\265`@\333l\033\006\343;m]Z\231\0300\224"
+	.ascii	",*j\233\325\340{\351\212\016\013\t\005\2619\255}\3617`n,\246"
+	.ascii	"(\261\274\177^|C\345\216\232rF'\214V\2440GDZ\263\f\276e\213\363"
+	.ascii	"s\361\314\311\243\265\310(,\n{\022\r\375\271\370\366+\216\017"
+	.ascii	"\003\252UH\020- @\254\031\006\317\262\305\275\331\254>\214+\246"
+	.ascii	"\222V\237\244\024aQ\330U\017\217\215\363\002\245U'\312\232\263"
+	.ascii	"\276\254\363\202g\241qm-\2369\311\364\203FaQXU\037\263\022\312"
+	.ascii	"\227I:\2614ps>@\246/\230\204\222J2\221\264\315\212\250\373\251"
+	.ascii	"\373\351+\022c\244\346\273\246m\361\3542\214\252\305\373X\\\032"
+	.ascii	"\213\267\340{\257_\250\373i\232\200\240kZ\026\377`aR,\276\241"
+	.ascii	"q]\356\024\2675A\r"
+	.ascii	"\276bI\262\211\337\212o\341\352\212\264\002\252\347\333c\242"
+	.ascii	"\027\235\253\340W\276\270#\n\2369\371\344\361\2145vV\177\227"
+	.ascii	"\224\302\202Y\231j\322\202\332Q`\244\342\231\223S~\316\310\202"
+	.ascii	"Y1\022Fn\375\373\351S\361\354W\\Q\212\017L\203\006:\334\300\320"
+	.ascii	"\341\006\004\323\240\301\016\0358\334\330\330\001\203\007\r3"
+	.ascii	"\334\260a\002\246A\203\035<r\330\300\301cG\217\f\304@\003\005"
+	.ascii	"\323\240\301\016\0331\350\300\001C\215\233\02276n\310p\203G\016"
+	.ascii	"\0331\334\3600\303\r\031r\350H\201\307\215\216\033<\360\260Q"
+	.ascii	"C\r\032,\3440\300\016\0367:X\230!\307\215\0347h\340\260q#\002"
+	.ascii	"G\217\025l\360\240q#\304\241#\207\r\001\330\340A\343\206\250"
+	.ascii	"\203\016\f\374\215\266\201\203\306\215\f,\217\034=t\244`\203"
+	.ascii	"\215\0349h\320P\303\001\033=l\240\201\003k\003\347F\003h\360"
+	.ascii	"\240\021\303PG\016\030n\310\201\345A\303\206\317\241\303\206"
+	.ascii	"\347a\003\215\257q\263\343Yh\200\002b\300Q\243\345\032\032\334"
+	.ascii	"\260\003\007\f5d\200QC\006\0309n\320\300\001\243\306\315\016"
+	.ascii	"\030\032\214`\0357\330\270\201\301C\207\216\033\0303\314\314"
+	.ascii	"^:\375F\270\233=\344\033j\362i>\320\255l\033\256{\t(\260)\002"
+	.ascii	"e+\333n6\361\311)\365i\276\267\275K\271\324\373/\337\367}\215"
+	.ascii	"\317d\020~6\300\222\275\220\212\016D\254\366\250\007\362\250"
+	.ascii	"\367\244w(`n\037zG\322\223\b\303\351\013Z\217z\226\3543\360\303"
+	.ascii	"\007\022\025\"\2332\253\205\021q\r\207i\005\321\013Q\r\347\b"
+	.ascii	"\252\365\243w\244o\037\352\321{O\323\334E1m\300\317\335\346\266"
+	.ascii	"\326E3q\013\316\006D4\034&\034'\034(\034)\034f\263\033\310\226"
+	.ascii	"!/\351^O\363\f\035\236\311/\202\374\2508\254y/\242\351\347\306"
+	.ascii	"c\025\363\016\365@\016\365\r\245\332\306\326\241~\315\373\256"
+	.ascii	"\366\013b\322*\336\226\262\234\034\210 !\232\315\021\371\226"
+	.ascii	"\217*5JB$3\372VJ\r\034\262\204(6\344\3331\352\3373\3434!Z1\026"
+	.ascii	"};F\365#\242\"~)\203\210\236\205\243\362=!r\341X\021\267pX\302"
+	.ascii	"\221Rc'\302gZ\375\351\343\247P\263\f\007\032\355\312\367,\330"
+	.ascii	" \025\030\324}\350\231q\260p\262\274\177V\276_\365\336\207^\002"
+	.ascii	"\261\251\232\017u\325{\337\351\020|T\26490pq=\204~\025\363\236"
+	.ascii	"G\274j\347z\027\372\t\352\244z<.h=\350;J\330\027\264\316\365"
+	.ascii	"\036\364]\355\025\304\244\315\236-QmCUz\356x&3u\b\265HH\020Q"
+	.ascii	"J\224\274 \357B\202<+\245\016\001\031\">!V\r:\320;\020\007\372"
+	.ascii	"vL\260\352?E\304&D&\376\343\375\347\333\177|\373%8\370\334!&"
+	.ascii	"1\326L\375\371\370\366KP\372\334\371\034\367q\237o\3011\202~"
+	.ascii	"=\304(\343\t\"T\217\323I\337<\223\211EnX\353\236Urt\321\3764"
+	.ascii	"|\372.\3436\005I\003O\277\326}\021I\236^O\023\017\027q\311h\001"
+	.ascii	"\316\026Q\t\247\013\305T\021\236\3572M\303&\270\305@\006sn\370"
+	.ascii	"\"\036\031k\210D|G\320j\251y\206\216%\030\261hj\013\321\220\316"
+	.ascii	"\373\362\333\277\0229\357:_\023\326Ce\351U\306!jNk\333\367\234"
+	.ascii	"\357f\373\222\031\033mNk\331o\277\005\\z\225]\262\346\264\326"
+	.ascii	"\337g\253\357\357\013\323\252O\002N\320\350I}f\2340\342\217q"
+	.ascii	"\306\017\320\b\032\363q\207\370\003G\254-\001\027\375\341\203"
+	.ascii	"\350C\364\2013V\206c\326l\251\337|Oe\276\007_\210DL3\3073k\332"
+	.ascii	".\363\017\006(U\346\033:\255Fi\233\351\340\023\207 \032Q\207"
+	.ascii	"\230\223'\370\255t\0328\3452\244\016\n\377\246O\342k\372'}f\234"
+	.ascii	"\264\341\324(\035\224\276pl\352G\346\231q\324\206\200\312\240"
+	.ascii	"\27792\337\362M\371\002\331\206}|m^\340\267\322\351\033\3403"
+	.ascii	"\343\264\r\243\306\025SC1\303<\034'\316\033\016\034\016\034 "
+	.ascii	"\333\324\371\304\206\277g\306\221\033B\215(\354\376\276\205N"
+	.ascii	"\271\3240f\fZ\006\374\346\206a\344\204~/D\233n\365=3N\335\360"
+	.ascii	"\211Lz\353{\026n\232\305\007\035\202i\343\373\026m\212u\203\335"
+	.ascii	"\333\233B\203\3363\343\340\r\275(\203\322\314\364^\3106\265\212"
+	.ascii	"\346\r\267\240\t\243/D\233>\311\323\033\236\031Q\230\345}\213"
+	.ascii	"6\235A\214\230o\350T\006<\276\341\030\026\274g\371\246Iw\317"
+	.ascii	"\214\3437\fS\006\241\2602w\367,\337\364\310\006\024\372\r\235"
+	.ascii	"\032\331=3\316\337\320\313\330e\367\355\327\264\250.p\250\225"
+	.ascii	"\225W\367\253t:D'\035^MI\243\373\025.\260:\367\3148\202\303("
+	.ascii	"\312 \2535\357\247o\356Wi\340`\230g\306\031\034V\031k\246\234"
+	.ascii	"\f\251p\2529\306\345\362/L\240`R\f\317|f#\317p\211\262k\205\222"
+	.ascii	"\301\270o\271\270\027\216\005\326\200\373\033\270oh\340\333\323"
+	.ascii	"gx\304x\302\316\310\220i\374\001d\f\022\344\311\026\250F\244"
+	.ascii	"y\006\006\336\202\206POyn\337on\317J\003\267\234CC\246%0\337"
+	.ascii	"\316o\037*\230o\307\002\263\332\212\206I=V\f\217\206HF\243#c"
+	.ascii	"RR\333_\276\333\276}\250_\276\375\n\304*jofUI\367h@\361f{f#\223"
+	.ascii	"\321\211\355;\220\350\271c\204\n\034\022j\033\300\352\005\234"
+	.ascii	"xk\031\016\t\365\b!\250\265\f\203\030\255 \260{_\235\376a\346"
+	.ascii	"\f\206@z\264\230\022\212\031\002Q\261\221iD\362\347mL\322\362"
+	.ascii	"\260g\350cL\262\304\330\244I\333,\005\266\300\220\031\003\303"
+	.ascii	"p\007\fV\022.>\026x\246\220Lw\ru\2069TjXU*\225\027)\222s9\"\244"
+	.ascii	"\002\317\344\017ml_\351Y\253<+\341\\\240\026\n<\324\263"
+	.string	"p*\024\354\361\304he\225\326\177pF&\320\243}\250g\227yK\300\356\326\002\377\324\276\327\376\376\324\376f\253\213\024\211\351\037\3328\005\313\230\005\210\346\364B\310\267'Ebzf\316@\030\355!\"\006\013\305\b\363\214[]\306\257\257\266\331\233\255&\226\004^\351\037LL \340\025\340\016\200R\274\374Cy\261J\373w\372\316K\373\226\002>\351\362\317\364\235\327\345[\n\370J\357c\200Lmm\003\250\364\314\361\301\bp\221\003\023zuo\371\346\362\3553\004\016l\313C`+\f\013\t\355\231\215a\3027e\220\333\034\332?\037`\221\226g6\212\t\333\224A_\330\264\374\243\001\0165\307\204^\322\272\234}7\317\376\321\374\252f\317l,\023\242\365\240\2613\232\t\265\030\233\0214?,\313\267\331\267\0175\313?\232\337`\031\2320\2131\002;2a\231\221K\232QM\255m\326\007\313\276\375\246\317\235\317\201"
+	.ascii	"\231\330`\033\333\036\373&\373f+c_\302 \333\003\260Tq\261o,]"
+	.ascii	"b\177\243U\346\005\243\356+W\276\241~|c\335\315\366\320d\332"
+	.ascii	"\223\356\345\370\240\013aZYV\276\303\276M\363\241\026\371\332"
+	.ascii	"\365\353\3263\033\333\214N\357\237\266\362-\\_\321\223\347sz"
+	.ascii	"\254J\031\007\200=\263\361Mx\245\f\312`\n\330\267pz\016U\315"
+	.ascii	"\322\200*\337Q`nU\336\307\364\244_\277v}\375\312\246\027\350"
+	.ascii	"\365\353\326\373\240\017\325\353\3271\275\277\256g6\302\t\237"
+	.ascii	"\030-\020R\t\253\214r\3069c\235\261\256\353{\3324R=\277\347N"
+	.ascii	"\013\312\256\266\271\376\006\310\231\215x\306<\357\237\346\372"
+	.ascii	"\206\352\361Mi\033='"
+	.ascii	"\003\272\270\017g6\362\031\375\364\270\274\217\266\321Cca\353"
+	.ascii	"\247~\372j\332\326\372\336\372\366\031\3024\376i\375MV\224\265"
+	.ascii	"s\002Y\200\177e\275\177Ie=\016YQ\254\264\266\321\233\262\302"
+	.ascii	"\216\277PsZ\313l\224"
+	.string	"\032\005\237<w\024\300\"\241\362,\022'*\217CV\235tK\333\3501=\023`\324\033\362\\~\216\261\252W\364\\\"\340\231O\324\3565\354\373\241\356\253w/\241R_=\016Ya\326\332&Z}\036\240\247<\3631G\230d\024\"M\371\366+*\335a)42\256\020\026\t\207\034y|\216?~\264\315\266f;|\313\026\rl)\317|\004\022\n\031\205AsR\370\242\177`\3153\f\020E\b\024\207m\250\023\2025\261L\317u\n25#2\222$)\264\006\223\030 \fE\022MT\304Xz\023@\006\214\211\202\221\026\3441\f\032\006\031\263\231\244\240R\030\306\236<\327\340\335\\\023U|}\240\272\366\336$\370\300lL @*\242\013m]\277\263P\337zPL\035\3175`>\337@\013\323{\310\007v\244\221\203\313\345\247\3746zI\271\325y{\255\230R=\244\362\324\363\304\240\277\340\263z\364\235\314"
+	.string	"\313(\336;7?h\023\345\373px\211\243?\324+\210\252|\271\371\037\336+\236\240\200\021\206b\341\016#v\324>\024\252\303\013d\331\220\225\365\226@\341\0208\224\307\372\345\240\304I1\253\\\316\032\305\377\301#\206\310//\272\376\254\266\024K\213\365]\350\336\312o\002PH\357C\257\264\003<b:"
+	.ascii	"\261t\020\244\367\365L\t\210@\241\226\311\256-\227\302\264\345"
+	.ascii	"m\305\226\035\230\225'\027\312\210=P\224\250\374s-\016.4\355"
+	.ascii	"h2\257\363\231\304\004\333\305\250t[R\307RLU\377\271\030\232"
+	.ascii	"rhwK\377\306\223\322@e\333\331\357\324\247\035\214\3133#\203"
+	.ascii	"\256\235\b\235\217Bj\365\232\306\300FZ\357\n=G-\350lx\242<\037"
+	.ascii	"\204\317e\345a\203A!f\013\232T\310\304\227-Q\311\371\001\303"
+	.ascii	"\016\205=\210\0331}\203\213\036T\377\245:\270\262|\203\177V\016"
+	.ascii	"=]\256#\213\216yP\331A\024Tf\0229~+DG.\215\370T\335\231yo\240"
+	.ascii	"y\001\334\375\356\307\272\2559o\315\204\366\3772\322P\336\217"
+	.ascii	"q\271e\213\tZ\312D;u[\314\254\2521\251A,\343\302\234\234\250"
+	.ascii	"\310\217\020\371\303\313\221|*\334\220\315\305\177\334`\r\016"
+	.ascii	"\375\312N1'\007.S\b\032\331!\311\\k\356\327+\345\341($\327\017"
+	.ascii	"\f{\221a\327\203p\"\342\250\\;\337M\333\t\300\205\001rb#\020"
+	.ascii	"l\t\210M\234\213\265\201$\3739\3263\\\\\3122\203\016\321\305"
+	.ascii	"'\234E\256\346!\036\004\315\354a\200\215\254\236\301\016~\n\373"
+	.ascii	"\323\253d\224\n@`S9@=&\206g\302Sk\203\205\361@F\306neu\033[\215"
+	.ascii	"\001\030\2423N\256\231\322\263\365\350\026\214\215\341N\215K"
+	.ascii	"\336~c\251\246\006Z\016\2501h(\251\203\006\354m\366\261\330a"
+	.ascii	"\333\243\344n\227\305I\"\204\275,j`\321iL\027\233\001t\032&\254"
+	.ascii	"\030\033\334\262\240\206\322\002\360\215\351\311\222\006\230"
+	.ascii	"`N\032"
+	.string	"\344!9\250\024\212\347c\216\331K\223\006\251=1d\2621\352=\207P\370\210pY_\005\271>\006i\213$`\230m~\344\203\217\007t\237MX6`7\330(\332\255\330\272\001\271SbO\204\307H\251d\326\353\326\215*\020\337\202R\3438h\323n\343\232\212:\020W\340%\\\314\234\350\023\270\331Y+\340\362z\355\234\260]o>\375\205`\037\226\020 \231\335\276\023\235r\240\212y\206\203_\341ua\006\f4\324'6\326\023\202\305\t\bj\004\013\343\b\225P\223\273\200\353\327i\360\376\310-\271\221y\006\336\224Lc\217<hDC\033,]\335\316\330\347\307\245\313\363\r\024\260\352\210\325\265\360X\203\316&)3\235\234E\361\"\353\240%f\024q*\215\247@\221\301]\211v\303\371%\035\206\261\324\205\201\353\267F\241\315\237\220\r\276l\312\263\274D\233F\320\212{\312\263\366\244\365\fP\376\365\224g\333\256"
+	.string	"\\$\024=\241\306\202q\345\255\262R\362{\240\243\274W"
+	.string	"\323\331c\202vDr\273\257v\005\362\354\343\001\303Y)\263(O\207i\207\367\261\311W\001T\n\346y\306%\276\027{\017\256\003=8\220i1\b^\267rq\272\223\236~$T\244\n=\036\215\002\364\034G\335\2324[\374m\0174\213J\231-u\223\275\251\306\272\360\352\f\204\371\1770\002\006]\345\007\2416\022\201\263GH\207dx$\347\346\026\t\305\352\251\377N\3104/\022\2359\230\345\001\264T\371\235\b!\016C\022\341\317\316\200\327/\323\013n\314\207\300%}\224\205\271\241~\301D\030\007i\204\330p\362z\022Os\237"
+	.ascii	"r\266(\205=\0258\374\n\002\034\326\240\3653\327\275\374\027\267"
+	.ascii	"B\227\\f \241\357\005\336\322\020\027\034\225\350\333c\250-d"
+	.ascii	"\201O\257\016`\317-\002\316\266\370\210!\037\3318\331\374\300"
+	.ascii	"\341O\205T\377\272\320\227\217\203\343p\367\306\243\245\233^"
+	.ascii	"\240\210\003~nas\246\240\374\fy\230\372\204\377\204i\246\225"
+	.ascii	"H$\214\301\316\017y\251\357\261\2436I\003\224\201\202\264\307"
+	.ascii	"]\206\304w\347\217[ \352\0017\261{&\2371\377\240h\350\360\ns"
+	.ascii	"\252\360\371\304\323W\017\217\362U\356\225\236\353:\206\340\235"
+	.ascii	"\\\267k' \307\204;\020\030\317\302\253P\002\327c\001\320"
+	.string	"\361\263#\317.\315-\024\236x.\032\326\201\b\245\024!\fq\334\f\36483 \345\227\241y\017x\220,Ss_\004\245&\020\033\251\325\337\222gG\327\354\240\032m\237\270\342\3413}\326d@\331\t\233\366\005AVFqE>,%^t\026\016\243>fUVT\377\025\270\335\263a\210\310\260\256a\247y\351lId\0215\323`+\f\3777\026\254\024\004\225\312F\260\245\030\315|\024\320}\300#\t\013\036\263j\226\334\317\2678\214\177\021\237Y\211\030\201G\203Z\245u\262\3704Y\002\020\214\001\344e\350%o\207\204<\3160\t\2323\360Z\314\367\b\317r2\374\320A\223\360\n)\033vi\351Y\036v\240Ac\220z\366\232\222\310\313\232\325\350\023#\224\"\001\037\r\244\202\204\246\021^sE\373]\204W(\255\305.9\003\311\303\346\027\311\bX\322\337\367\262`\001\301\222\225\315Z\3154\374^v\310\254"
+	.string	"\031A\226\322S\324\240,\367\302'\371+\230\220\374\257R\362\263\336\350\361\035\317\363\003\020A^0\235\266\247H\t\336\330a\247Z\025?\024\361b0\003C@\020\tm\nr\324\317'\363\327\330~r\235\324\304\340>\301F\236\242\257Z\2368\213yEr_\266\210\213\004\016\021se,m9\001\373\263\214N!t\3200\331@\004\360\243\236\tr\346\b\237'J\363Yo,K\302u\303i\314\304\004/~ \200\234\264\300\231\261\252\034\b\031\312\365\317W\253\321\266\254QT6\250"
+	.string	"\241J\021\366\r\231ftT(\316t?:e\237\263\314\314\227\024\212\031\221D\210\312\250N\220\272N*\333t_\310\330\231m\021\330\342f\260\r\002\251f\342\271\300\340a"
+	.ascii	"H\006\224\213<\252\372\034~=\340uf'\350\207\021\227\022\tgVj"
+	.ascii	"\323O`\324\002\033?\351\303\001\362\325;\005c\336\013\tHZD\273"
+	.ascii	"\305\223\305c\206\337\243D\022>\352\370\233&Ey\002"
+	.ascii	"\327\004\255\032<<\f\035\226X\363\320\242\312\202\351\334/\377"
+	.ascii	"\307\320\237\250\312\202\207\221\235\211\013\320$a\374\177\363"
+	.ascii	"z"
+	.string	"n\031A[$R\177,\335\266\345T\250\"X;\252\304\333\033P$\226\332G\032@Zk\253\330\277\353W*q\330\374A}\334{R\314\2747nyE^A\031\320lZz\221\023\262\336T\032\232\252QVBp\\\226|YX\215\250\0343(\214\004\277\264\243\317\350qy*\021\262\306H\340\341\247\256\375K\246\203E\350\0368I\266^aL\270\025\263\366-t5BJ\345\036\306\322g\232\016\204\217Q\254\257b\301\366\353\364|}\235\272o\264\252\220^\t\376G\002\033u\225\323\370\245\02642\356\266\t4\313H\247\352\3160\304\307\016\364h\264\301\275\003\2530A\322c\321\025\025\254Q\373\336\341\365\341\310\275\0351\377\346P\335\371\216\335\3454owAzQ\346\221\301\262\202\r\242\223*r\321\2369rs\201%'\341r\346|\357\035\013\370\032b^\001\030aG\277\2463\232\347\026.h\177\203\037\006m\322"
+	.string	"\327"
+	.ascii	"Xl\315KR\253\001$\344dUY\272\321\022\275\263\371@\235\336Ohu"
+	.ascii	"2jiYg\226\023\267!\325\312n\353\257\202\f\357HS\371\005\275+"
+	.ascii	"\315\377~F\023=\362\263\006\213\347\363\022\213\304q\220\032"
+	.ascii	"\325\007hK\257r\272\326\255\005\n\332y\350v>E\261vk\027\231\323"
+	.ascii	"\341\373r\245y\227\234z&\177\270e\301I\225\323x\223>\212\366"
+	.ascii	"\251\252\334\006*G\f\355L\bzEz\022\357\201%C\005\331\216 ^R\031"
+	.ascii	"9g\346\322%tP&\255w\342\t\226]\240\312M\202^\027\260V;\305\353"
+	.ascii	"\237\322\313\233-\017]R\b\035:Pe\b\006\233\277\303\263\022\277"
+	.ascii	"\315@\343Fi\026\306\270\253\252db\214R\257z\342\347\037\224\377"
+	.ascii	"\214\346\030\320\322f\n\317\031\373\001\032\027(\032"
+	.string	"BD\265\225,'\004fm\334\246 \252\201B>\r\220\027\362 \0162\203\345g\304\260%],\243U\225\256A\332\t%\212\246B~$\210\035-\331\317\304}\336\306\030 \355\016\300\rB\250\2027\244\357\341Ha\tw6\341\227-\270\352\227\201\3047\320\337\355oz\3405\037\261?\212.\261\376*@X\200\362sJ>F\310\250\256\364\277\211\203\375\337\224F\b\335\221\312\032v\241\n\225\016\300\246\306\356\303\034\353$\364)\366\017\0271:\224@\035\356\273\215c8E-\333\311\305!T\242(\242\003\237~\343&KME\260\374\fe4\343\232\303Sf\347\260\265L\215k6u\242\241\200d\022;\222J`\255\032\330\027\206#\342\251\271\351\261\"J\344\360\004\002.\211G\033W1\274[b\355o}\3342{\272\373\206v\256 \221\320\007\241\037\213(\266\302\245\200\241X |1\b-e\002\271\254\340\250\313\263"
+	.ascii	"b\301\360\016\f\204|\333\202\235\300+\364p\346[Y}\021\233\022"
+	.ascii	"2\"\344\342pV\3024\205\225\303\256[\017B\273\266m\354\315\340"
+	.ascii	"\016\236\016R\3434UdO\016\305\357DIfZ7\240x!\213\361\030E>\005"
+	.ascii	"l\246"
+	.string	"\341}\030%,@\224\247\013d\004\r\316T-\270\3244\2061\020,CRb>\255\203\"e\375\020\255\345\370n\006D\261\254\215?i\254\316(Lj\230\373\203\333\273&\233\003/\224A\360\023!\346\344\3444@xi\336VW\311\264\2703\215\f\245MN\246I\356\364\340\004\340\034\363\320#\353\242|J)\256\354\23064\003\305\366{\205'\013cQ@\357\262|\3718\345\226z\313\314\345t`n\323\211J\017\032\261\276\312\205\201\367\033\353\312+\013\305\215\266\254\274%\373\020\276h\314wk)\270j\261\002v\327Q\343\323\226\003\272<:\006\223\274\376\tj\223\252\"`\305\2012\222\237\2631 \262\225e\3704\024P\310\t{\224\215\214\263\2264C(\312S\230T\024\327\027/g\322lCG\t\263\036\342\b\257\212b\221\004\242\b\356Q\372\330Z\270#\0351\304\243\211y\001\340\262\263\272\324[]\247\004\274,"
+	.string	"\264Wi\021E&\313\360z\324\242\006\326!\261\352p\362\366\214\3022\254\027\256\306\343\016#\363#j\203\222\201\030\312\337\027X\301\230f\t\317z\237u\244\326b\036\377a>_"
+	.string	"\362\316\371-\006M\204\007{y\305\313Fs\013\274\tJ\206\277\333\252.\375Ml$PW\004P\267\257\246\364\213\265\262Xoup\333Sj-\344\216\025o\261MS\306\277&\247\272\\eE\326\225\3440D~\001\242\032,U,Vq"
+	.string	"rZ\365(\b\2662!X\231\241<\324$\217\001h\bs\2608\252\325\013\370\2416\340\001\333\367\357n\\p@\334\006\2725D\027\f>5\263%\030\007\365\032\261\020({\326\313o\310\350\216H\377\312f\222\b\365\025f\340\257\222^\031\253\374\332\302\n5X\263\b\037,\213\363P\f\270/T\373\340\361\310\250&\316\320\311Z[\207\364\370\327\024P\237\232\306\013\356K\314d\276\314\253\340\342%\360\334\3051\335\207\2208\275\236\365D\332\214\337\257\364X\2058\356^a\335\3435\256\302\240_\032@\221\313\324\3726(\3637\252\264\310\323\340\342\225\224+#\261C2\325\361\213FO*\356\234q\0224\365\030\352\266\251\210\336(B;1\377\367\005\364"
+	.string	"\365$"
+	.string	"A\032\021\260\333H\354\320\375\206\245p=3X\023 p\211\335\021\236\017\2359y\313@\f`\215\004O\270\021\275\230!e\367\224\371\215\246\371\222\204\024`\221\001\356\275"
+	.ascii	"\2557\244\312oU\001%C`\222\354\214X\355\341%n\233\345\320\270"
+	.ascii	"d \bw\203^T\033EfJ\274\305=\235\255D\221\034,.\355\320\005"
+	.text
+	.section	.gnu.lto_mspCommonProcessInCommand.160.999bf63f7ce1f656,"e",@progbits
+	.string	"(\265/\375`1\n\2450"
+	.string	"\252Q\360\021D`\236N\007\217\244\354\342(\0177*\332\277oR o)\343\343\341\023\202*}\217\264\311\335\343i\242\023\321x\013\203\276\361\203\234\027\324\007\234\213,`8\361\226\033\b&\257\242\276-\206M\310\336{\357\224R\n\n\001\367"
+	.string	"\017\001nR\230;\013\267\226\336\302\301\264\031\350\345\252p|\226i`v\316 \026\231\367\007\220\007\027\335\031\202Ny\001\333)\312L\305\034df\324\231\233\331W\250\032K\215\243\341\265j\372P\300d\371\235\231\201\003\252\2562\305\177\357\327]\227{\231\n\270"
+	.ascii	"\333)\225>\243\342vC\216*\255\005G\262+\347\336\275\227\211\330"
+	.ascii	"Dj\247h\017\251\235\376\222\273Qfs\352m\003\t\177|\202\300\037"
+	.ascii	"\273\252\351\020}o\271\213\r\324l\226\r\322.O\230\"\305\230\375"
+	.ascii	"t\025X\373 \331\314\202k\023[\377\222H+y\300!BT\"2\271$-\226"
+	.ascii	"\345\365\277\001\354\332\244E\244\3274Y\\\301\343\225\253(\361"
+	.ascii	"\336+<\352@\211\216u\264\362th\266\325C\224\002\232\224\261N"
+	.ascii	"\223\205\004},is\301\243\016G\327\246-\215:Q\323\322t\263v\334"
+	.ascii	"\352\007\036qt}\251\303{o\213e\201\241\2766\335{\331\215G\255"
+	.ascii	"\346\240fn\f\314\274\202\371w#\004\336?\310\203\353\016\343\031"
+	.ascii	"\263k\203~\222\t\274;\257\372\252\374\311A'Px\033\373{K\013\325"
+	.ascii	"\031y\3225\230&\026}O\377'y\216;\214\204c_\331\027n9\276c\rt"
+	.ascii	"\207\025\221R\312n\230\027n8\276C\335\006\364\224\332i\2771\363"
+	.ascii	"\035:\267\367E\344\336b\177\335\271\361\032\350\224\370"
+	.string	"\007\304\320\320\345\360>\026\272\3223?\255\3606r7\273\223p[L<xV_df\342\360O2\367?\237\317'\377\021\346Nk&\320U\272\211\215\245[\211\235\223\220\202\316G\253\263\021\320\271hu&b\235\001\254\316C\253\263\320\352\034\304:\017\177\316@\254\263\360\347\374\303:\373\374\234\203\2543pu\376\255\316\354\352\274\266\263Y]\235\323wFW\347\177g_\235\373B\007gS\215\363\230\344\3350\357\217\247\236K\227\3025igwZ\363\033\027\007\2670R\255\306\023\324\002\355\024n\251\264h\336\306\026M\355tu\032\365\200\037$Z\270\340m\004\376\n\247\314s\247]\271Gw@\216\f\f0\017\267\236.\255\244\266\307\215\007\330J\3103;\314|\307\016h\272u\220nx7\354\367\250\367\375\276\331Z\bN9'\256\311\224ytE\337\363\003\343\312/u\3128\226}\346\f\215\267\307&\347.\200\223\375"
+	.ascii	"pJ\264\365\2315t\034:\\\352\340$\265\255\2374FI%}f\016\335f\252"
+	.ascii	"\203\200\260\341}=\35056\035T\242+oM!g\367\336\bjz\215\007\376"
+	.string	"\020\302E\250\235\"\331\031\365\322\357\342SN\241\263\372\"\363\336\273\246\215\246\031E\271\217T\365\261\316\264\372\237\205M\216\372I\206 d\330}\244\376\326\276\3174\322c\315P\221\036\210\016[\224n\27582l\351'\271\233\365\342\310\264\r\337\277\305\232p\254\234\217\377\321\357\004mf\004{\257U\004n2]\206\004\332J:\345\022&\3246v\312m\342\227\340\300\005\314b\211IJJ)E\013\267\361\224\002\006\207\013\030,DAI\301x\022\361\264\002\205\f\027P4\210\234\242\244\036\204\b\017)^8\251\354\264\024C\352\305\t'\025LN*\230`\264@\361\202\311)J\212i\311\210\241b<E1\311\200\202\212b\n2\253\032\275\177\204\205ZyL|\272[\265\233\375+\022d\307\325\233\267\335\252I\217\305\314I\357\217\203\333\r\005::\372X\213Db\364GFb\212\266<\331\0069B\364E\337W}Ds"
+	.ascii	"\272\274H;\026\246\266\001xu\314Rnh\210{\021\031\372\025n\031"
+	.ascii	"'\344\345]\\B\257\352-\275\004\201\371\326\224\2007H\007\322"
+	.ascii	"\0261\322&\223j\247j\320w\263\213\364\226V\27247\t\227ekK\260"
+	.ascii	":^?\237\354\277\367\026}\206K\367\321\216\365\2603\352\r\177"
+	.ascii	"\345[\006\001J\342\3066\312\003\337\341<\332%MZ336\302\007\022"
+	.ascii	"\376\252\267\334\342\353\256[\"\203?O<\207\325\332\346\363?>"
+	.ascii	"\277\216Q\356\t>s\013\305\213m\224\006H\270\237~\003\200\317"
+	.ascii	"\250\201<$\221b\210&\210$)(H\032\003\260\002\221\241\"\326\001"
+	.ascii	"\02109Dj"
+	.string	"hFZ\230\fsO\r\240\033\311W\245\275\t\301\232\234\304<4\227\3422+9\231\030)\204a*\233\023qK\200\2235+\357\324\002\004\002\207\320\346\210\376$\t\233\226P\230\032F\271Q^\356\016\375\262\344\220\375YQ\254\034\005\277\030\020\235qB\334\352@\331\005!\263\031\n\261H\f\235\020\352f$\220\222\343\374[K\017\322b\336r\3421\244\374\bc18\343SZ\304iR?\027d\376\274\n\034\276\00782\335\242\261\273\017G\332\n#\316m\007g]\344\234\333\346\323\t\311\2766\323\3703,\330s\035L\344\001\264\025\302\246P?\255\013\210\242\317}\371\231[\004P\f\023<\013\333q\362E{\020f\274\ne\366\356\036\362\020\327C\025\367\336\342\335\230Gm\352\262&FQ|W\327>@\037\033\252\212(\255\336@\201-\337\255w\306,h\357\030\261%\324\266\257\254\021!9#6\366\360i\177\032q"
+	.string	"\036\255\241\3648\034\245b\330$\345q\360\360\235K\022\234\341\220\371\016\250\336\007\316\222XMy\262\277>e\030P\347\376\363\220kb\365a[\204\336\242@@\211"
+	.string	"\034dH\304S\276\343\372'\343;\307\262\217\361P\247rB\217\221"
+	.string	"=\t\201\252\365"
+	.string	"^\003w\n.\307\304\034z\362b8\205\f\226\017\336\273O\330cNO\332\304\247r\314~z"
+	.ascii	"5\251r\314t\372\037"
+	.text
+	.section	.gnu.lto_mspCommands.161.999bf63f7ce1f656,"e",@progbits
+	.string	"(\265/\375`\210\n\365\027"
+	.string	"\306)\223I\260\324Q\206\003G\005\332`2\227\311\314\200\376\213\177lX\376\213\177(\240M\306\223\007-\200W\264H<\212\026\300\251$@\325\340\215p\203\377\203\376\203\376\203\376\203\376\203~'\360\004\027\201'\360\220\373\207\017\246\024\266\356\310\037\226"
+	.string	"\212"
+	.string	"k"
+	.string	"\025,\\\300\220A\303\206\222\003\256\203\207\017 B\370\374\340\200\202t\263\226BF\272\035\357\250\347\373\225\300\240p\270D,\032\217MNOH\250(\251)\252\2522i\225\245\265\365\r"
+	.ascii	"\\]_`\261\260\034m\246V\322\324\330\334\340\330r\263~\201\311"
+	.ascii	"\321\351\354\360\f\021\025\351v\274\236\357\207\004LR\n\n\207"
+	.ascii	"\304\242\021w\354a\322\005HZ\345\256r\023\0137\353m\257\236Y"
+	.ascii	"o\262\230\026\b+\201\230\312Z\316Z\222(1\200f\253\211\250\254"
+	.ascii	"-\020SY\254\261\230\314,PG-\365\324TW\235\334\352\253\261\346"
+	.ascii	"r\326Zo\315u\327]\366\332\313_\203\035\366\227I\2333\2636if\315"
+	.ascii	"\264\2317\023g\332f\31641OL\0243\305T1WL\026\263\305t1_L\030"
+	.ascii	"3\306\324\2312\346\214Ic\326\2306\346\215\211c\346\230:\346\316"
+	.ascii	"\3341y\314\036\223g\372\230?&\220\031d\n\231C&\221\013#\f \237"
+	.ascii	"02\0019\231\333\201\022\001.AN\301\202\222A\203\234\203"
+	.string	"\333\203\022\002.\202\204\t\024\002\307Xg\031\317\230\3065\2661\216s\254\343\235w\314\343\036\363\354\343\037\0039\310B\0362\221\213l\344##9\311J^2\223\233\354\344'C9\312R\236r9\225\253\334\363m\237\177\306\rt\320\271\205\266\362\320D\027m\264\356\335\274\217\356\355\3737\322\300\257\2344\226\263\254tp\341\303\227&^\334\370q\246\265\274\345\246\235~\032y\261Ri\225\372\364\247@\r\252P\255t\250D-\252Qw\345\365\250\275\372\372+R\201\275\322\244bi\226*5Xa\207]*\261\305\032{,S\265tK\233\352\324\247\"\013\325\250Ju\252T\255j\262V\275*V\2714\253Z\335*W\273\332\245^\365\322\257\2025l\3323\327\246\271f\233o\306\331v\316&>1\212S\254\342\025\263\270\305.~1\214\200\265\250\261\350\222a\377\f`\223\266I\007\021 \bE@D3\022\211\261\017g"
+	.string	"\256\266\257\312>\n\200"
+	.ascii	"@\324<A)\222t\252PB\017\227\253\217s\245\361\221.\2600\027W\031"
+	.ascii	"N\253B\270\201\273\245\204\256\357\344\251\203\321\\\037\241"
+	.ascii	")\310fe\f\266\257\365\330\253m=\212}0\021\215$m\020!\250\261"
+	.ascii	"\243\275F\250\224[b\274\313x\227\377\257\240\016\242\003\260"
+	.ascii	"\nH\016\243QE\340\254\3658\227t\252\366\345\335\251\215La\017"
+	.ascii	"\224lU\264(\232T\321B\223\257\211\373'\n\304Fpo\2575\375\237"
+	.ascii	"\207\376\261\275&L\"\177\245\024TAU\003"
+	.text
+	.section	.gnu.lto_mspGetCommandStats.163.999bf63f7ce1f656,"e",@progbits
+	.string	"(\265/\375`I"
+	.string	"-\t"
+	.string	"\346QA; %'\035'\005\tP\033\005P1\234\0021\032\223jJ8\373\344&63\303ZT3\266\271\252\021\204\"i\243\021\004@\006/X\020\234\372\031\367\bB/\300f[i7\271S\n0"
+	.string	"1"
+	.string	"-"
+	.string	"\253\224\204\223\033\226\315\317n8\035\236@\273\f}@\273\324\225\247\036S\376c\016!\"\333\001[\252\307\200\207\335u\004[$\267\336\366\310\266\202\355\236\032}\211\340\"+\271\fgwd\006`y\244N\213m\224-\262\255\321fh@\035\326a\335E\361\311\331\r\027<\n]\332\366_\016\203rJC@\002\032\006\257\335u\220\371\314\347\263\\\232\343\024\017^\372'}\f4\211z\325\030+\300*\316\354P\025U\305>hw\327\352\262\035\255\207\3751\022\023\021\026\334\246y#\231>\216b+\315\255430*\270\271y\337$\025\2703]xs\243\353\274)\n\367\240U\227\365`\245\037\366k:\201\027h\333\3434\001\n"
+	.ascii	"F\023Z'F\346#\301\232Pl\202\201^h/\241\212kvd\207\210\246k>\001"
+	.text
+	.section	.gnu.lto_mspResetCommandStats.164.999bf63f7ce1f656,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\375\006"
+	.string	"RM16@O\223\016\230\265\005\003\026Nt\217-1\300\235\035\236\312y\211q\016\026\300\371=\212\225H[\272\225\036\243\312T\024U\207\235[\nE\223 \317?[YM\210L\001S\033\317\247\343@q\"\305\211\022\021\017\235HY\237\270)\270\362@Xq\242\252\254\250\341\262P4\260\225t \210\361\364\f\262\267L\f\355I\271\213`\224\t\252vQ\232BqG*]q\275j\225\3565Uz\213\213W\355\205\r\244\313\200\331s\331\203!_\200\204\242\207\n&\033\036u\201\311\344\230\221\311Nb!\371\253\031\373\227r\243<\370X\321P\211\311\314\bE\212\365a\267[\005\264P\326\027\320\220\231?-\324\321a\177\204?\341\037\t\b"
+	.ascii	"3\001o8\243\024\3365\256\211n!\340\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_mspStreamSetPortFn.168.999bf63f7ce1f656,"e",@progbits
+	.string	"(\265/\375`z"
+	.string	"%\n"
+	.string	"\346SH@0\213(\035\203\323\003{P\013FU\231\200u\035\347\345\213\326h\235\333\276\271\334\220\365\320\032\301.`\033iM\312\343\227\226=ut\"*\003(\017N3\341V\022\005%\024\334\352G\334V\312\224\0024"
+	.string	"4"
+	.string	"6"
+	.string	"\034\223G\203\267\260\036'\257\260\036\335\331\0340D\353\201,X\215N\035v\367\322\006\357\236\235\377\t\217\370H\336\023\"dw\235\037\351\300\255\267\275a\373\303~F^*\003\373\222\335]k\311\276\351\217\222\264j:3\375I\307\206\002\b\256R\355\032\bW\233\212\030\036Tl?\355G\270\204\356\246\317)vK\032.\354\202\036\016\"\365\234\252\372\321\007Pf]S?\312\020\312\320\276\205\2372\215\303\261\036\257\024T\350!AT\237\302+||\007\346<\371\357\321\367X\217#\250\020\202\002P\2066\030\235M\023\031p\321l\030\216b\314\262\3412"
+	.string	"X\346\3022\027\001\315%\273\260\215\273,\027\3266\230\355\352h\332vU\300\275\226L1\221R \rY\"U'\036\300\2625\002\362\2375\002\f"
+	.ascii	"2\001k\336\f\343\342\225y\001\330vT\316\026e\311\200Y\227\260"
+	.ascii	"\232\325hp\227\027\355$\003"
+	.text
+	.section	.gnu.lto_mspFcStreamScheduleCommand.169.999bf63f7ce1f656,"e",@progbits
+	.string	"(\265/\375`\320\007m/"
+	.string	"\272V\374\022F`\\N:\177\251\024\324\326\372\2531\354\3631\003;\036j2A\377W]Y[\205|tB\346j-\020\023?\304A\331`\177\337?\0174:GC\215\036n\371Q\34789\275\037\257\377\257\034\335\335\032!D\356$\003\"\001\001\001\"\001\302\267_\241:\226\027\303\247\323\214\257m\273>\b\257\246\355\203\326\273%\3376\333k\021q\236\361\265\355\232\321U\276\240V\221\022\003aJZ\203\3642\177\355Q\250.\005\006\001\236\326\212\215\013iM\310}\231\035@\240:t\212\273m\305\366\342\332v\r\211\025\b\257\276\311\235P1\213\341j\331l\340dfQ\231\323\266m\022\321\203\326\253\351\177\326\253M\226\262\360\351\332\331\330\354y\002\030w"
+	.string	"\024\211CapU\323\356\271,_y\236\350S%\3212Uf\336\274l<"
+	.string	"^\227\223N\3075\026\001i\212}'\f@*\201\356\006\327\361\272v\244\027\355\f\233\253u\201\335\342\351\016\302\211\306\306GS\354\304\241V\337\034'}>\232`\027\036\257+G0=0\346\3543ze\245DuwY_w\375\262\354j\032\274\342\022b\364\272J\227\374\370\346>\367\273\345UuS\"\221\032oa\215\367\244\013\256"
+	.ascii	"R1za\245\002\214,\233<\372\"\265.\263{\203\024\332\266\345\313"
+	.ascii	"\364j\236}\316|\021\314|d\016\022\003}P\237{\033\251\231M\240"
+	.ascii	"\270g2\321U+\371}\373j\262\352,o 3\247\370\227)\244\274\266m"
+	.ascii	"#0\363\210{9\036\225\265m\273\304\345]^\360\323\2562S\323=\363"
+	.ascii	"*\277i\275\372\376\334U$\321\266%\320\345\r\354n\343r\325\325"
+	.ascii	"\375\344\177\251\314\217\257\247\307X\353Sk\201~\364\367\213"
+	.ascii	"\214\214\322\r\2313V\327\217yMy\373\311\374\363\330kZ\341\036"
+	.ascii	"cV\272\224\037"
+	.string	"\351\350U\376\004w;\027\035\356<\364)\277\320\241\177\001\276\034t-g\240\313\235\177\206\227}\212\227{\212\227y\206\227\215}y\207x\2718\274L\354\313\303\276,\354\313\301\276\274\016/\253}9%^\356\276|\207\227\357\340Bir\315\250\3619vm\313\025H\247\275S\347\206\\\313/\367\273\375X~8\272\030}N4~\034\177\216\213r\274E\313\314)C\205\360\352e\246\342[y\226G\271\b\007\025\003\320\031\306\327\266m\211\354\363oX\262\243\025w\303\232\t\225\265\255\325\022\233\267a\321R6\b;de\207\254W\215}d\006%\366N\373\234\371k\313\252SD\344{l\221\337\210rY\362Ulf\021WC\0020A\022v\311=\263\330\351\033\264\216\330zSA!\236\345\b\324T\230m\020\260OX(\367Lb\237\356?sP/'\243\266\343\254x\3402W\260p\317,\352\024\017\272\345\256\252\225\004"
+	.string	"\323\266\210vo\220\300\r9\352\206\006Nh\364a_\b\233\236\260\207\255\302\301\232\023\266\t\036V\255\374\003\031:\232\301~r\201\363\2265\330mE\347\217\r\351\301\036\352\003b1\021\272B\315\234A\303=3\350\343\007mrg\325J\346\274*8\274\254\375d^\363\253\373S\373\311E\275Vj\365\254\307\350?\275\365\323kW\020\243\366\332?\336\311L\361\323x\003\207{&\207\365\252\332\006\316|-o\340\323\266m\333\224\217\376\323J=\300\312\234=,\261\252\033\310\003n\352\001Dw*\342v$\030\224\2119\036\345\205\351\276\222h[-\036\365$\005uT\223N)\230\220Q\311`\022\004\223S\213\017QOLH\244\324q\347\351B2\311t\204Bv\210JBup\221t\3429\"\223\035\225\\\321\035<lX\341t\\\371\310\300E\322\t\305\221E\322\221E\322S\213\024NIGd2\211\301"
+	.string	"\206r\301\204L\212\202\202B&\025\333\367\030\377\270\2113d\317\256\217~\330\303\t\226\025U\177v\r\nj\246\260\354*~\221\266\255\217\t|Rn\340\033O?\231\006kC(\357Z\261FX\0347/\215/\265^=\021\265c3\363v\203\005[\371\266W\311\202\261:\330\260\033\266^\r\021\265S\362\246\353\234\331f\351\323E\255\277=\245\333\323\217{\226&\2412\346\343\376\327d,k\333\345\231~\314\366`\177\3343\231\b\253\225,<\327\255<\335\323\307R\033j\036\325\354\317LV\035\241\334\230\255"
+	.string	"\375\344a\216\235\243n=\242\321\201zk\250\201\372P60V\327\357i\252"
+	.string	"\217\030\201\372\250}\314\374\354\256\026,\271\263\035\022k\261{\r\333\353b\310Y\003\300\222\255\306F\262\351q\200\213\250Q8\243\020c\304\231\221\221\t\3224\031\306p\002\0212\243z\021\2009FD\222\202\224\206\003\351@<\370\t\344\347O\245\205&\211\312\252\037\022\3270\257I\364\245\304SY\220F\2141\nq\177v\021\341e\240\3614\250f\362\036\262\030\241h\246\2750\324[\331\300\213\017\346L1"
+	.string	"\254\"\351L\215\237\225\017\334\237\250$\035\007\320Z\225\026\310R\212\333~\241Y\345\0049jZ\371\340\n5\240\356\003\267\030\333$\177\245\333\272\222\212w|\260L\213;S\nIt\003\033"
+	.string	"hi\246\250.|\230\263?Oof\257a\356)\271\266\036\226^N#\r\217'&\003\300\201\372\347\"\261\263\354\013u\3165(\250j\323\237v$'H)\367\321"
+	.string	"\025\205V{\375)TUFHxi\200\224F\307\217\032L\032[R\326\230$\013\313.\342\355\322\016BZ\260z>,\316\340\002\262\341\252m\361`\323}\002~\346\203\342\n\001\344"
+	.ascii	"\271\360\330`%\362`o\304\013s\274\003\351#C\f\342\201\177~\333"
+	.ascii	"\205\304\302\201|7dS\205\306\235\325"
+	.text
+	.section	.gnu.lto_mspFcProcessCommand.170.999bf63f7ce1f656,"e",@progbits
+	.string	"(\265/\375`c\n\3452"
+	.string	"*WP\023AP\250Q\007\245\204\353ohDd\225\243R\240\206\325~\321\n\222\245\"\307\230\3008\373M\220\213+\030\034\251\013\3260/@\343\362\274R"
+	.string	"\367\003\340\202+\325\033\321\306\221"
+	.string	"fd\353\266\273I\222)\005$\001\025\001\036\001\355r|N\267\257cx\234v\247\032\"_\214n\237\257\336}\243]\215\263\3616\376\306\243\355\203\343B\237x\334r\316&\334(\257\272thx\346\3112\002M\251\224\327\262\003q\364\324\363\241\301\203\033\276F\206g\257L\303\312s\317\006?\233\3419H\366\035cOCn9\233)\360\265)\264\217\206\006\031\006fl\f\2252\363\214\216\004\030w;\231\227\335p3\033\276\224\363\223>qr6[\320R\255\257m\326vw\373\030's\243\335\f9\270\232\017\236\321\2574p9\347\242\001wb}\3259"
+	.string	"\326\327\217\342\256\007\201?_\217\327\356\330U\367\330m\337\201\371\210\276\315\245\007wW\353X\031\360ge\254I\220$\356C2\326\363\261\2601^+\343IU\324$\210\323w\301&\323\243\016\245\005H\022\314*ArD\214m\233"
+	.ascii	"\t\373\362b\333\234s\257\311lW\347r\272N'a\317\2202\356\204\355"
+	.ascii	"\214\257\311\304\037l\346\320\031\3109{\3241X\263\013\343\335"
+	.ascii	"U\316\271\361\333\f\342\235\344\335.\325\3353\272yb\002\355\332"
+	.ascii	"\231CL,\327:'\262\377M\337\370+\254k\203\003\222\361!\372\006"
+	.ascii	"&g&\204\356\256\341k\034\234,:\205\313\231\031A\352\177:\350"
+	.ascii	"<\200`\375\025\361\037\242oa\310\232pw\211\023\330_\342\353\314"
+	.ascii	"\224\245I"
+	.string	"\273~\331\376|\200Rz;\250\325w\221\200\307\377d\210\232\350k\316_\300c>_s\215\302\365\244h\375qD\247a\310\360\250a\035\237\206~\334\216\322\351\355V\341u\214m\316\031\002\235\020\307\001\205\252\370\332n\203\365U\370\273)\324;o\021.\\\3556\353\302\017\355\366\257V\253\325\376'\335<\334V?\334TSRQP\216\306\275@\0177\001?\363&\372\032o\001\216\346=t3\367'w\343-t3\356N=\334M\016\307\233\251\305\275\304\303\255\304\303\235\364\303\035\374\341\006\376p\377~\270}?\334=\037n\236\017w\333\303\275\353\341f{\270\237\207\033\267\270\275\001\225\0307C\234\252&\347\037\325HY\272\316\301\342g\356k\334\321\334\335\270\303\361\270\300\017_\370t\231`\177\241\250\322\257_6\316\220\200\017u\037\223\206\215\307\257\n\017_\bu\243`\177\333\017\255\341\241\336\361M\211\352\"\267\245\227"
+	.ascii	"\013\177h\305\305\202\375\225zJ\275\340\224\360\036\212\231\316"
+	.ascii	"\373\337\032\002,\334\342v\301\376\362\036\347Y\023s\344\216"
+	.ascii	"\266f\244\215\302\3030\356\030\354\357T\2344\307\"w\264\262G"
+	.ascii	";\027l\373@9(\\\340\205\217\277\333-\243\200\375m\037\347)c$"
+	.ascii	"\365rs\\\346&]b\352\204+\257\223}(^6\346\342\225\231k\257\356"
+	.ascii	"\250@j\217\264\212\305\265\013\362\361\326\376\350\307\300\030"
+	.ascii	"\2657\302Nd}\205\224%/Q\324~\250\247\255\373\222\345\023.\013"
+	.ascii	"[wOI\004R\313y\351\316\335\263\\\262\030\236\353\356\n>\225\241"
+	.ascii	"\025}\004\327\206h\247s\213>\212#\223s\223\303h}hO\361\233\247"
+	.ascii	"\372j\211\251\355\336j\226lq\272\207\nr\002=/\356D\226}\002N"
+	.ascii	"\310\013Yh\257\322\0304`\1775\260\276\262\017\301P\030\027\256"
+	.ascii	"\272?\221mz\217z\335\242\352\210t\261U\204\221\205Df\031\003"
+	.string	"l\035\223\277\245\\\361\306\244\362\261@pX\2014\262G\244\213\020[I\025[J\036\214\013J\345\321\230\225\304\332Rfai)\221J4^h\035\223\353\n\244\361\333X\245\245D\2460\262(\032Y\024a\270P\201,\032\223\312b\325Sgi\035\223\305\255\254\254d\321g\306\345\272\374OZ(\004J/\352\205\3157\236\324\013\215\f\002B\275SZ\025\316n\352\233\322 9\177T\036L\243\366\321\271\356\262L\017\326\335L\357k\200\322\244\\\337\325K_X\n\323/}\217\315\207\232\2579\245\207\342\2029\200>\3716\253Oz\245'\246\361z\333\201\233\270`pL\226$\275'Q\233\306\221\005\337\251$\t\360\203\377\324\036\370\310\024\214X\030\360IL\305~_\204\310\020\177\027\271\333d}\377{\334\346\345t\177\340\246\333t\240\326\206\201\270B<\216Z\033\230\234s\004\037\370\207K\244]#\256\230\213\204\365\325w"
+	.string	"z\206\310Y\206\214\352\255~\350\210\370\275\247z\237\343\272.\201\n}!t\226\245\253\327$\007h\213.\347\234\203V\001\200\317\250qH\304\024RLFD\244\244 I\322\001\320\002\021\251*m\021"
+	.string	"1T\f\221\310\314D\351\3354\250\304$\343[\347\247p\371O\021\253v\214\306\240\024\367]#'\2160M\346s\035\020\033\031c\227\"\b\027\005r\233\312r\331\375U2\253\250\t\230C\346`2.\213\362M\361\212E)\\\217l\325\314\003<\222\223:3vd\025"
+	.string	"\031;\234\276\031\245\222JM\344 )aJd\220\254\244,\264\311\253\270t\207\240\255_N\25293\336\251\037F1X\003`\264&\371Bi\3530\026\256\357-\336\205\246\371\n\260\177\237\225T\275#\f\036\034\371\204RD\n5?\321"
+	.string	"\226\320/7>\233\210\302\225\306\250\373\003\013\330.VgL\267?>\375\366\341\305\263\256\024\2232\202\3602\360\013\320\356+\371\321\355P:\026\372\234\224\213Q\333\005\240\3434"
+	.ascii	"d\245%R\256\257gu\026LI\037\r\312\233d5H\024%\305!\342\2021`"
+	.ascii	"`\"\030~x\023\332\344\240b@\216\355\2316\225\361~g@uG\262\363"
+	.ascii	"6\013x\210\fgH'\274\271\022,\2711\251\002*\250\301\177-\"Px\235"
+	.ascii	"\237x/_B\200\350\311V\\+\005}-!\213\342$\3256\357R\23474A\267"
+	.ascii	"\303\212\336\177\277\301\206)\3006_\302\222\320\310\317\214<"
+	.ascii	"\362=\237\ta\230\3314*\\\306\024\341\364\205\306y\330\026Y\250"
+	.ascii	")\221}+\026\025"
+	.text
+	.section	.gnu.lto_mspSerialProcessStreamSchedule.172.999bf63f7ce1f656,"e",@progbits
+	.string	"(\265/\375`h\020\005S"
+	.ascii	"\n\210\204\036Q0P\322I\007[~\271\374\3319\335\277V\b\005\212"
+	.ascii	"H\304J\352\200\227\227\357en\340\205y\022\206\344\007\326\307"
+	.ascii	"\237\217\276\234\217\250\331\207\2109\305\307\245G\205\252\374"
+	.ascii	"\231\252;.E*\225\265\034\266\336\"\243\013\257e\246\230\306\351"
+	.ascii	".\304\356\326\210\224I\006\316\001\263\001\340\001s\013D\222"
+	.ascii	"%l9\366\303\236\355[\356v\270\313-1\356\207\225Xsy!oF-\236\210"
+	.ascii	"\324\237$\\\306\302R\030\036\310\345\317\364]\214\300\232b%\f"
+	.ascii	"M\264!\2415\313Y\257j\276\224\364\215\365\325\252\245h\b\004"
+	.ascii	"\t=B\234\325\212f\210%Z\306\372z<\313~m\211>\3705\267:\030*w"
+	.ascii	"\211K\273\304\003\373:\374\354U\236\266D+\277\222\036\213\t\314"
+	.ascii	"f\326^\255U<\206\007\026\317\303\321\322\367p\302L\223\246\326"
+	.ascii	"\214\341\201h}2\270\303\315\322Sa\262\251u\365U~\315${"
+	.string	"\265:[\f\017\\\347\320\271l\257W\365D\2744\225\354\325Z\177\016\334\005\206\347\335\217\235,}Y\323\316\324\332\025\247\245V'\002[\300\360\300\236'\203\007\242\307\t\036\270\351\256\021wzU\236\246\221\250\263\276Z+P\307\240\263\303\243\316oM\2477\261\243\223\314\301A\362\334\330\324\034\215E\"\315\314P\030\004\242\315\351>\310M\354@\271\373b\235'O\316\360\234\031\320\023yN\030'\354\310;=9\017z@]\225\030\232\274AQ0\341\362{]U\023\264\307m.\352i2\260\r*\034B\365\344uU^(\003c\366\326\276\366\30450\\q\375h\354\272Z\276(l\321|\253\201\270\004\355\211R\245\204i\204-\344\376\263\345\034\023\233\021\240\353J\353C\272\013\020\245*\213\205hO]\225\026\332Sk%ZEq\020U\300)F\211\327U%A\213S\244\206\020\255\240\030\270\324\364:\242\353j\353(J"
+	.ascii	"\335\013D\034\255\206\240'\226o,\\\356<e%\204\373k\007~i\341"
+	.ascii	"\215\371u]q\235\205-j\255\313RVW\337\023\337=\335\3562\331=n"
+	.string	"\t\251\330\220\257{7\315\341p)\331\006e\360d3\273\263\002\206\273\373S^\306\305\330\237\020\221\211\245o9F\206[\310L\223\262$+\363\373\356\213+1\344c\n\356\302x\037\323\006\355\3128\334\214\r:0\203'[\037\037\033!b\214\n@tY\273\353\307Aoj\b\332\314\245\021\204\321K\234\334\321\205\261{\023\302c\326\200\206\321&\304D\375\275}\332\200\276\227\243`A\340\375p\003\0174<m\215\213ir\340\251\026\304't)O\26500\017\363\243\035x\252\371\225}\357\007\n<\251\335\275\361/B\bx\325Z\031(\342F\330\330;9pq\350\340K\351\b\036\230\242/w\364\355\251\366tg\005\313\211\3134\332\226!V\335\314]\347\023\237\001\2571Fl3\3315\362\362@\362\3560\362\3520\362\3460\362\342@\362\336@\362\332\310\341\0352\362\n\031y/@\362\3260\362Z`\344\245a\344\255"
+	.ascii	"\311;\003\311KA\016\257\f#o\f$/\214\t\0368\020_\026F^\003\036"
+	.ascii	"\367M1\300\313~\237\013\361\335\271\017_\235d\016\316\251|\221"
+	.ascii	"4\2747H^\233\033\336\032$\357\361\310kd\336\342\235_\"\016/\215"
+	.ascii	"\r\357\214\r\357\020\311+\274\341\r\332\360\002\231\027\255\341"
+	.ascii	"\355#/\033y\277\001\337-A\265\002\222g}\251\225\252\314\022u"
+	.ascii	"\016\270\006\345B\374@\374m\177\227\377\355\217\373}\370\235"
+	.ascii	"?\225\277\207\037\313\213Ld\343\356\207\320[ \332\334rI\036\336"
+	.ascii	"&\360\374\013\273\023^\341\3422\366\343en\035x\252\365\251\335"
+	.ascii	"n\227\270K\257\333F\2026w-\312\007bY\305\256\302d\244\300\320"
+	.ascii	"4N\027\033ye\211\006%\005\247\321\230\2225\034<\277\370e5\300"
+	.ascii	"4\3759>K\301\002\240\202C\225Z\365\260h\232\016~m%\021\365W\\"
+	.ascii	"\"Z\250\003Cl\346\316\364\260\223\314\342pzY\007&\035/\247\013"
+	.ascii	"\024xSBH\301f\232\247\b(\033X\364\260i\276\266\266D\375\235\013"
+	.ascii	"\2243;\232f\312\375\246\356\016\213j9s\001YS\004\\\310\204\215"
+	.ascii	"\345\200\236\371\364\005}b\212j\013\324\362\211\206\216\310\335"
+	.ascii	"\260\231H\274\006g9)\013\022\306\016\316\202\256\341\3234\332"
+	.ascii	"\202\276\035\215\026k\n\n\273\341R`*\350\030M\243\333\013\324"
+	.ascii	"rFW \304\373\262\005)\350\031\035d\203\212\"\243)H\217\260\224"
+	.ascii	"\024\311\2234\243\310\350\002\362\312\350\266\006"
+	.string	"\323\320\024\304%\t\206\302Ob\364\351\356\003\2066\266$+;\261\354\302\202\260\231\373sa\277\313Lo\001V\361\240V\252\204/%\354\036(n\3022l\260w\262\351V\312\305\025<0\3307\236B\370e\001\361\3478\206\024l\205\027\f\237c&\351\013G\274\024)3\215\341zwZsC:\310.@&\305+XOB\220E\367Y\026(fq\300f\321\f\027\365\347B\n6\344\0026J\006\312\206'.\263[L\004\240\360:\020\355\263\360\364\"V\366\303\237\373\226\364\313\355s\207Kg\030\246P\322\032\370R[l\023\253~{P\035d\367H\301\267\035\205\247\\\037\337\272\271`\247\273\245d\351y\202no}|l\305\004\204W\253\023\257\300U.\316\367\204\013\243\342\372u{\301F\210_J\324\244\260X*\005C\341\t\027V\253\323\245\226\211p\221\264\351#\005K\301\2020\030\312\r\20373;+X\177"
+	.string	"7\034\316\305\006\361\004w\003+\302\212\"#\037J@GH<\312\340\007G=\214\214\220\210\204'\214"
+	.string	"\244(\tx\024C\251,\"BJ\032RR\"\r\001Q\032\331\034\025\215\320>\256\024*\215z\024%)\341\370\240H\004\345\022\020c\222\322\220\2222i\311\203\241\322\321\022\322\013\245\242\037D=\200\020\225:\212\214|\344P:*JJZ\"2.\321\n J\243\016\210@"
+	.string	"\"\002\001\350\310G\017# \242$%\320\212\235E\002R\224\004\244\204\204\224\004Dt:\035\361\026N\375\364#L\374i\277\331i\346\316\214I\016\320\255\307\363\363\235\236\332ib\277\354L\254\260\":*\276\323\003"
+	.ascii	"\227O2fw<,\223<\354\232j|\232\007\004]{Erv\364\363t\364\216\034"
+	.ascii	"\255\243?D\216\246k2\342\341h\241\316q\243q0\330m\364\215\241"
+	.ascii	"\266\221\036a\271\024\311P\336\326`\270\246\341\301h $\324\317"
+	.ascii	"\033z\225\037\303\233\376\335\371\371\247\265\346\304e\372Gj"
+	.ascii	"\335\031\316\236\320\203\tX\236\300s\t\277\002\2160\237 \233"
+	.ascii	"\271?\022\t\233\031O3\261\351\353\231\345\021\373Y\236\226\026"
+	.ascii	"\251\261i\253Y\346\001`\026\327vS\223lbO\021\373i\177A\302\330"
+	.ascii	"\345\t\3411{6\315\\\242\f\307\tN\205\325\214\343\237\353\344"
+	.ascii	"\334H[\263\214\177\236<\"\373i\367\321\343\244g\032NO\351\364"
+	.ascii	"\261_\030\373\3701\374\203\213)&#\001b\260\360-\311\216\326Z"
+	.ascii	"k\rjL\036\013\213,K\361\201\316\351\251E\21583M\232yQj\305b#"
+	.ascii	"{jW\305uz\202\376\332w\\\321\372\302\307\231\231fKsaI\306nS\272"
+	.ascii	"\\0\"\265u1Bk\355\222`o\007.\263*\236\354\007\2328\265\274\203"
+	.ascii	"Z\246\350*?v\262\236b\374\262\272|ws<\315(\307+\205\247\230\201"
+	.ascii	"Z\250\201$\005\221bH\315\210\210H\222$\031\016\021\005\3040&"
+	.ascii	"\251;\017\021\200\255CV\"\332\264"
+	.string	"\320\030="
+	.string	"@r"
+	.string	"\366\377\226\301\032Z\226\377U\303TK\367<\n\232\240s\353\3530\t\235 \216\336zR\177\334\bE\330x\376|\221\227`\301wp_\213N\n\360\b\307\335\332\037U\035\264\311\2374>\205\027\020\251@\216\253\210\343\026p\007\322\257\231Mw\231TB>\021P\232\262\005X\303\351\314\233m\232B\226\250\032\261\273\330\205FkL\0357\263;]\251l\234n\362KH\236I%\2738\264\307\3627\261|y\275\223\t\336Ha\200W\007\246\217S\252\346@\253)\326\230\345\360H\022\235\263~\216:cr\354\237\334RQ\215\232 \bI\215i"
+	.ascii	"\263\232i\211a\322\240%\245\334\022\\V\245\230\221\265\233:\004"
+	.ascii	"\305\350\345n&\230\233\226,\265L\334 bF\276\202\260\016\361\331"
+	.ascii	"Z\375\354\311c\356\365\313\030\306^\251\204E\206<pAv\217\343"
+	.ascii	"\033\372]\001\031|\272Oq\341\"\352\231\317\274\016\312\332M\325"
+	.ascii	"\n7T\032\313\261\250\364\367\217M\353\310\314\001\003$0\353\260"
+	.ascii	"\2006\362\316\226v\007\210\211S\200\256\003\313\240x\224\214"
+	.ascii	"1\330\270\303\245\001\002\352\223\375\254\006\177#\260X"
+	.string	"\327c\006\b\335\006\351\t\221\022L\254\020\244\033F\347\261\005rg\324W\326k\227\350\333O\326ii'_\220\220\033.\034\244\035b\020\356\234\206\264\201!A\304\230\002S^\213b\314,\314\350F\351\375\270s>Iw\23731\274\324)\225\361p\177\314\371\300\245\003t\f\255H\bI\"\205$\005vM\f\037\274\033,\024_e\356F5\314\035%n\265o\373B&\250I\347\232Lm\320\216:\213=\341\220|\265%\274\256\f\222a\006)MS\220'\261\214\036\027}\200\t#=\242)\b\203\227k\373\036\206\002\212\346\215O\276\013\024\262o\315\252\025[5\237\272\013\016j\316\020x\035\350\301`\361\266\020\237\245gD\365\250`\001&\2461\233[\317\377\030\360\227\n\230+\353\271\347\004\027y\206.\2106\271\2114R\034\200F\231}\350E\303z\t\3653\354A\030\257`_:\032\031\204\033\251<\001/\3457\n"
+	.ascii	"\241b,\2474Vg~\b$\300\211Y0\n\r\240p\212#\177\320i\334\241\n"
+	.ascii	"\254-V\204\334\232\373\227\247\016p\0227\221\211\004\371,\250"
+	.ascii	"\207\207B\024C\256\317DE\257\360\310\265\022\351\344\333\330"
+	.ascii	"\234\352\312\251\332\216\267\342(\rfj\323\2731H\233\350\240\314"
+	.ascii	"YR\035\030\204&\242>A\nS\344?"
+	.text
+	.section	.gnu.lto_mspFcProcessReply.173.999bf63f7ce1f656,"e",@progbits
+	.string	"(\265/\375`w\001\035\017"
+	.string	"\226\233dF\360\222(\035\220\301@m\017\261\354J\207I\031[i\216\261\377-\221\002)\322\326\373\347c$\25574\263MC\210\f\260f\216H\277\002\341\237.G\314H\026Y\352\230\363x\262\363<\3453\201\326\001\345\261{\357\235RO"
+	.string	"J"
+	.string	"V"
+	.ascii	"\247\256'\351\234n/\3209\365\310\246\275\246\266D%\302\345e\263"
+	.ascii	"\273\235L\361\321\247\214#\237\365\004:n\200\237o}\276\210\325"
+	.ascii	"\270f\260S\211\313)\340\306\205\007wj\231\016B\330\234\0209\221"
+	.ascii	"b\004\200\262\273\216\245\023"
+	.string	"\211\233\336v\004\333\235}Z\376\334\335\265D\331\257\367\374\352\2272\372\001\"\255\005\314K\314S5\27309CVFs\254x\275\375\226\315\375,s\266\253\312\200\335\2617\005Q\215\250\355\326\005\247f\260=\332\217q\031\243\257VN`\027\205\203f\2676\260\202-~\353#?B\225\214$Ao\2515\355\256I\fY\310\300\210\343\031\315\n\205\2242%\235K\003.\037\244xc\033t\033\033\266K\t\261\0323\253\323P!)\331\242\277:l\273\373`\306\007\017\bz\2508\365W:\247SB\210\275\\3\230\t\226\230cW0J\031\007\336'\222 2\204<\037\265w\022\022}(x)\235\227\322i\270P\341\323y\237\250;9`P\310\363u\034@\240\257\343\352~\256Dy\002\020\223\220\032\213l\211#\033\243z\251m]\223\263\216\002F\234\tC\206\341\214\210\307B|\311\023\026\272\340\342\2246\206O|)\037"
+	.ascii	"3\241\371\037#g\2013\230\t~[\031\030\013\232B.\230\004\344\342"
+	.ascii	"<\304N\033q\bV\037K\340\261V\254\200\250\316\246j\214*\267\271"
+	.ascii	"\022\302\363R\214\351\304\317\216r\231\255G\354B\330\217\"\226"
+	.ascii	"\247\256\210k\271&>\233\346\024\265j\017"
+	.text
+	.section	.gnu.lto_mspFcInit.174.999bf63f7ce1f656,"e",@progbits
+	.string	"(\265/\375 \323\305\005"
+	.string	"\302J(0pU\323\001"
+	.string	"\345\276\351\356\033\352\205\\\350\236p@\001)mvT2\215\210}\347H\304N\350h\276\376\377\325\203\r\035t\243\006\206\300\"\271e\n\247\024\246Y\017ZMZ\315\211\004bM\232i\223B\374\302\"\331\244\\W6\247\260\227\277\303\b ^\230;\313\277b\221\333\2351\226D\216\267?\334$s\376\035tw\237\277\237\033\001\002\233\005\215\2723\005\004-\022H\236\377;\275\376\343\206`'> F4\320\335\223;[W\326\357\206\326\320y\333\312\202\243\273/;O\263\347\375\257\370\277\370_\003\007"
+	.ascii	"3\003v:#,\\g\227\361/\343\202K\267h\347\023"
+	.text
+	.section	.gnu.lto_.symbol_nodes.999bf63f7ce1f656,"e",@progbits
+	.string	"(\265/\375`\272+Es"
+	.ascii	"\312\243H\"U\200JJ\206\016\013\230\234\013>\b\200c\271\300,e"
+	.ascii	"\f\273)\357fzL\016v\021\300'J\372\263 [y3\342y\nk\253*\234\363"
+	.ascii	"\235\211JK\223\252JK\313\\\323}\016\303t\237\303P\233{\027MZ"
+	.ascii	"\245\254\315\366\333\207\310\"\360NFJC'b\357$\003\f\002\020\002"
+	.ascii	"\n\002\322\352PI#\207\312"
+	.string	"\035-\250\274\341P\311\273\2412\205\r\225-XP\211SC%\213\025\364DT\320?\245\240\207\242\241/\202\202\376\310\t\372(\023\364IJ\320O\221\240_2\202\236J\004}\223J_\025\202\376j\206~\013\004=\227\244\321w\035\351\205\204\321\2170\205~\b\030\375\322\027=\223\221\236\250HoD\244?\362\242\337\321E\317\203\213\276h\213\036I\213\276\207\364IR\350E\210B\237#\213^w\332\261\350{\034\n?a\237\220\205\004y\311\0253\2111\210;a\252\230\025}NV\321\337\220MdQ\314\003\371\001\003@F\254_z\033@z\234\374\321\333\016^\213\315\320zT\3646\211\264\203\t=\220\\\362\037%\367\231\372\355\303i\304>#\313f\351R\3645d\022\211\003\211\234\021\213\222;G\216#6u#\3642\244\b\232\324\213\320\307\370:\024=\f\211\001\225+\316\314\222\206Dc\276\220\001\225*\376D\317#"
+	.string	"\220\025\264\023\241\177!9\312\b$&>\002\275\0139D\336\b\22161\237\254\211-\240\023\005t'\372\035\331$Q\004\221$\200H\023LR\304\222\034\241$\253\b2\304\217\037Cx\330\004\022DK\032\b\362D\322\265||\210t)G\217b\364\254\036\307\372\340P\212\376\244w!\217\007w|\nO\322\354d\t\035\007\313\361\257\330d~\245\235\3506\272;\301q\253\241\033\205\344L\356\367\306\2016\376\013:\023\334\2135N\364p%\025\334\013\350R\261\237#\271\335\b\rz\035y\274\245\237!mR(\266\201\034\252\311\0331\037\372\0369\343N2\336\324\363 <W\212\361\0370\036\302\213\203\340\342>b;\367\351\374\203\234\367b f\220v\304Jd\365[\320\337H\234\363n\276\273\315u\304\230y"
+	.ascii	"\b\016$6\217\307\243\327Y\320\347\324\320\343\250\320ffh<\230"
+	.ascii	")\263S\315%\320h4\332W\320\267\220\314|\300.<\273\353\037H\304"
+	.ascii	"\206\016\016\233M\271\253:\233\013\302\365YJ\023\034\034\371"
+	.ascii	"#o-m-k}\fk\343\365\352\272Z=\f\336\254\212e\2056\030\264\307"
+	.ascii	"\331|\260\366i\263y\253\n\374\335\033\325^\345\365\033\b#29\210"
+	.ascii	"\331\374\356\336\202\210\027G\026\316>3\233\327U\241\\\220\305"
+	.ascii	"}\267\"\210\275\255\276F=\370\300A\237\223\324\233%\032t\006"
+	.ascii	"\366,E\242'\352\202\032b6=\\\n\254\004\2573\002X\224@\332p5\233"
+	.ascii	"\033.b67\330\rU\303]\361\261\263e\341Z\260\0371\233Y8A*Ph\016"
+	.ascii	"\316&\205Jb6e.\327l\312\364\204\ns_\332\305\312j\277\304l\262"
+	.ascii	"X\226\312\302\331\\i\023\263\271b/\033\272\201\364\023\263Y\241"
+	.ascii	")\\\nV\346\312\330;\301N\2501\026\346\245\357\r\200\302\025\341"
+	.ascii	"\242\314ti+\253\315R\031\3512\023\303'\033e\246\314\312\352\025"
+	.ascii	"\306L\226\276+1S\345\306\020cf\206\256\225\211\201\275V\346\201"
+	.ascii	"\027\b\254\277>j\243\026\336\242\332\263<\273\023\266%\252:!"
+	.ascii	"\341m\233\013\2528\373\323\367\326\327F\257\007\0378x\"\247\006"
+	.ascii	"\027X\013\252\207\376\221\204(\"\304XrR`\241\310)AG\220%g\004"
+	.ascii	"\375@?\320\241\303\006\rW\303\205\326\222\363B\275[rZ\260\026"
+	.ascii	"j\205{%'\005{\0266\031\201D\306N\260Q\344\234Pc,\214\225\"'\314"
+	.ascii	"K\035\312)\2732{Y\352\312\025\312\271\322+\365\252T.9\337\226"
+	.ascii	"B\321\347\b\007\345\274\275\272\372\344\220\341\363\225C\206"
+	.ascii	"+\236\0308\310\223G\345\321\216\312\036:\2504\312Ae\217\210~"
+	.ascii	"HG%\017\034T\346\fQ\251#D\245\213\034\2250nP\031\303\006\225"
+	.ascii	"<AT\366\340\250\224Q\203\312\032\020\225\266\037*_\334\250\374"
+	.ascii	"\241Ae\rK%\316F%P\215\312 \037*m\314\2402'\203J]\017\225D<T\372"
+	.ascii	"\304\2402\007\f*u\274\240\027rA\345n\207\006\267\321D\366M\225"
+	.ascii	"\231\313\206\364t\330\211}\023\003\033\3317_l\315e\3216\354\344"
+	.ascii	"r\242\207\311o\256ec\257`\247)\2534\027\247S\260\323d\251\247"
+	.ascii	"a'\226\302E\325\022Tj\237E\266\202\200q\023;\315\313s\202\210"
+	.ascii	"\213\35443|J\341\242\362a#;M\227\353R\344\246)\253\b\324\350"
+	.ascii	"\201`\"7\315\025\273\202\233d\242x\270\214>\307\020\236\202\233"
+	.ascii	"f\006\032n\232\030\330\310Ms\302\314\0223\315\030\013skJ\314"
+	.ascii	"4_\354+,\2012\304\304\313O(\\T\227*Kjf*@'\305\343\"3M\026\273"
+	.ascii	"rW\252J\253\324\253`&\001pz\360\230\310L\223\303\031\n\007\005"
+	.ascii	"\304Ff\2320Ms?E0\"\302\206\203\315\\\274\364\034\230\357x\232"
+	.ascii	"\376\255h0e=\305\225U!/\035\254I\324c\215\300\023u\032^\232\030"
+	.ascii	"\330\310K\323\205\307B1\027+M\031\033Yi\002\205IJ\017\321\366"
+	.ascii	"(Xi\252\3247\207/\360K\202\343 +M\031k\204\271\270\347\204\033"
+	.ascii	"S_x\3303\0015\227\234\334\240X*\033\271\247J\177&y\361\203\353"
+	.ascii	"!.\007\033\005\367\274\345\300B\356\031\200V\337a\026\2260hU"
+	.ascii	"\253*\260\336\376\035\031\331\242\332\273\275\036\257\356,\221"
+	.ascii	"N\250o.\250\342~\352\315\006`\353\033@\255\036mX\337\257j\274"
+	.ascii	"\217\035\311a\342\325\245u\207-\274Y\025\313\nm\260\255n\325"
+	.ascii	"o6[\252,\260\201\365\353\006-\330l\266\374j\213\321o6[\212l\257"
+	.ascii	"/\257\356,Q\037\201$\023QZtv\312m!\233\353\226\240\026\\\335"
+	.ascii	"\232\315\226\237\340m\271\331\343\235a\366\253\215\327X\275l"
+	.ascii	"Wk\335a\315\262W\027\253\nm\260\203\327\252VY`\337_=\262F\266"
+	.ascii	"\250{\315k\242\252\263B}sAu\342~n\325fg\255\357\261\3120\373"
+	.ascii	"\325F\257.-;\254X}\205\325\252VY`\337_=\262?\016\n\207T\324\267"
+	.ascii	"W\003\254\343\337T\251\267\213L5o\317VB\214f0\221\251f\207\372"
+	.ascii	"\n ()\302Ot~\303\337\270C\254D\201\0369\200\216\203\225L\331"
+	.ascii	"\314%\315\023c\n\236b%\023\346\302<\305\360\324|\231\361\361"
+	.ascii	"\324tIb\246\337\214\247\246\254&\303S\223%\351\016\344N\364H"
+	.ascii	"\236\312\361\324[\260\324\2058\n\200!T(~\243\213\374t\240.\006"
+	.ascii	"\216\211\3744\233b\003\305s\374\224@\n\0306N~\350D\261\361\n"
+	.ascii	"\371i\276\326p\220\237f\213P\330-\202\265\255j\023\253\352\231"
+	.ascii	"I\215\017\b\027\201\3669\354\343&RT?&\332\243jd\213\372\366l"
+	.ascii	"\257\266\360\232\310\236\247h\246\200\320\335\\\256\006Y\"\256"
+	.ascii	"\330\304\237Z\354[m\261\265\324\210\307\357\034\303\212_\367"
+	.ascii	"\313\032\255W\327%v\331\242\226Vq\230ug\026\226PX\213A{\035\253"
+	.ascii	"\266\262.\252\356%\221\233\212\2778\2720.\261\213n\221\355\335"
+	.ascii	"\036\257\316\335\375\216.7\203\372_J\002{\f\366I\237c\020.\342"
+	.ascii	"\272\177\232\207}\323&\343\3303lOX\375\3641\022\215^\355U\265"
+	.ascii	"z8\264Y\215u\261l\027\2055\330\301jU\325\262\252\336\006\336"
+	.ascii	"\232\237\275"
+	.ascii	"\315\257\0365\321\350\032\025\025\355\356\216\350\026\211\204"
+	.ascii	"Z\250\336\233\\\375$\006\325K\270\272\212\342b\033q\265xo\366"
+	.ascii	"\332d\315\206\335\366e\213\327h/\321\253vW\355[\255:\264M\024"
+	.ascii	"\006\357w\330G\254\262\277\243{\026\242\275\035\331\313rr~\256"
+	.ascii	"\356Q\017\206rO\203}\254\344F\304\215W\334\331\253\273\271{\373"
+	.ascii	"a\337\275\004\251\255!\023\177j\361\332^\253\037\354\t\310\001"
+	.ascii	"\003^\016\252\006\306\316\240\366\005\325\202\276\354\346\211"
+	.ascii	"\365p=T\n\372@W\002\033\301\275\214\306\b\"\023\3735\3307\037"
+	.ascii	"\250\227\351j\004\351\260\341\276\306\276\251\241^\260\026\372"
+	.ascii	"\274"
+	.string	"5\244#\344V\260\024\254\214\314\307\327\3568\366M\265@b,\262O\302\257\310\322\203\3307y8\254\002\203\354\250R\371|\354\025\321H\222$\225\016r\f\210d%UEc\036\022\340\002QI\201L\316D\"\221HDz\353\221\357\365\t\0241\234d\2177\342{\362p\340^y*p\235\212\367\365+\367\272Z\245#\270TvK\227\3336\246Q\237\2506\007\354\373Cu\352W\260\017\377\206|\361\265\231\306\211\262\353\270\250[\003\303UP49\302~\177\205\327\312TG\214\333Q^\303\321\311\356\201\337\2570\263@\334qu\335\247(\003H\021\375Wy\005Z\313/\220.\270\364\277\274j\206A\003d\252\326\217\003\002\244\332\t\376fB?9B\3121s\020g\363\271- \\'\\\200\345#\004\213W\032\004\024\2508u\200U\177\037r\314;\226Oh}F\316\244v\272\n$#I\f\345\300\004_\304\273\377\340"
+	.string	"\033\266\377\027\334\367X]\006\007d\357L\370[\023p2\277\247\361\210\247n\004\342\b\374\251om\247Y\256_\360\r\201;\205\025\207\352\036\212\245\002\364\037\232\365\244\2120\224\315\341aB\032 ?\316\245\216T\005\306\005"
+	.string	"\206u\233\016%\r\226\345\f\222\253\024\266\327\017\277\246Y\314\330\013%\315I[e\257\374\247\3321g=\334*5\235hk\310\030\203\001\f+C"
+	.string	"!\244\247\232\262\254\333\221:\325Sw\353\222p\315\214c\301\330\356\007V-\353W\345\244\322B\255\360\004O\35152\031U\261\273\312-\240\310\242N\005C1\177B;0\032\367^\357\364\317\340\315\366\257\3713~\"\322\310\001\264\377\360\330\224\350\024S\260u\363\257\025\024\260\302}@Z\n\217+\260\251\201\003\221\353u\35510 \365\033\016\216\\\003ru+\035\002\246@"
+	.string	"@\316\216\035\210o\357\322\260\016\326ALj\217\367\322qA\016\034\205Q;\272^\2220\032ia"
+	.ascii	".\274\311\225\361Z\007\025\301\325\361w70\310\001\310\247\307"
+	.ascii	"(\0352p\341\005@W\255\335\267\263Z_\rk\b4}\234\306?p\363\305"
+	.ascii	"\205Ciy\365\315\346\016\376?\350|\025\307\300s\200\354\035\260"
+	.ascii	"2+Y<\207\216\360\205\235\3119\300\227r\216\267aU\2428\003\275"
+	.ascii	"_\322FF\253\007\325\317\211(\241\366-\246\324\235?\340v\361\266"
+	.ascii	"uQ`2\363\022\225*\263?\350r\235\234\321\314V4W\210k\260<z\314"
+	.ascii	"\365\266\213\023\213e\275\213\322=\214\231K\354\252\251\214\322"
+	.ascii	"\250D\316\223\301\3730\311B\225\257\007\305\317\254\226N[E85"
+	.ascii	"E\355\254\215:@\344\2354\312\177\036\022e\331wh\223\263\377\272"
+	.ascii	"(\302\211\030\030*V\005\345:\253:\327\331\351C\033h\205e\353"
+	.ascii	"/\305\021\321O\\y\271#A\267\003(\265\t\364\336Z\2503"
+	.string	"\003\213\240B\t\312A\212\222\374=\264\320\343.S\377\223\320\t\333S\317\004\373\235\317\204\274C\263\003\353mv\215sO\f/\022\354/\361\275\3362\362;3\004\343\ts\216\177Ov\322\315Hd\3735' $^E\246\003\350)\374#\225\342\345\267(R\363\223\320\333\251-;\276\205nI%_<p\351\177\301\016\377\300@\fDjU\224\017(\201\337\324C\332:\313\241\345t\\Y2\351\2534\262,\274H\351\034\334\244\350\205\267\367\207\330\307\255\236O9+^b\370\272E/#\236\320\372\005u\306\263\221.\263\372?&\330\360\370\320p\372F\310\256s\177\fZ\375q\320\337\265\370e\264\223\350\314\203\023N\310\036\030\377xT\034\024\271\273\002\2356\032\276\370\343\236\227F\360\242\240\237\367\205g\345\257\021z\372o\273n\337\026\276t\207\235\376\277=\354\301\354\033\323\314\017\375\245ST\005\374\f\377[)\213\370"
+	.string	"\322i\325\231)2|\035-\374\013\365-\013\362Hm\330f\206\323\374\364>\325\3700HS\311\357\266|-\366r\267\034\255\243/\304\233\302po\232N\267d\315\261\024\363\031\343\367[<{fr\030C \315?\314\331\361\205\333V\370\034&\275\337L\t\364\371\231q\316\330)\201\344w\"\260\"\207\373\013\016v\305\037\243\324\365w\3720\323\tEnWm\251\327\303\333\005m\204Cq\262\001\314k4\265\314\241d\177\"\330\302\234\r\205\034\336\322\023\217v\3240\256\303=\341\223\262\362\335\355\275\276sH"
+	.ascii	"\276\034\003\2718\236\243\352\206\0337\016\224\334\310\323S\345"
+	.ascii	"\035\036\346Z\332A\244\220\202\255\226yZDg\306\311\267\310\304"
+	.ascii	"\310\365\315D~p\234\325J^\252\315\376\225\307F\307\247\312\324"
+	.ascii	"\223\033}\276\336\352eg!|\334n\326z\254\264\365\370\372\320\260"
+	.ascii	"\307\301\030\321IH\004\233<Q\367\352\3171\253u\277\240\235\245"
+	.ascii	"\377\370r\315k\334~\321gh\277\356\034c\245\356\027\334Y\362\217"
+	.ascii	"[\252q\211\357\027}\206\354\325\235bV\353\376A;J\016\207\254"
+	.ascii	"\321\207\274\243\344\027\267\254y\211\337+\372\b\361\036\320"
+	.ascii	"\333\346\326\367\354\240\227=od\353\b\021~p\373%c\202\344`\206"
+	.ascii	"\274h%\337z\236\337=w-'|\266\3350C\256&&\265\037\312\355\\\021"
+	.ascii	"vm|\233{\341\266)I/\177V\344\n\232\327\271\013\032M\223#\370"
+	.ascii	"\262s?\344@\037\256\327w$d\021\033`\007|\353\035\354Bm5\216\007"
+	.ascii	"=\372z\216/r\234\214,r\035\275f\377\301\0133a?\030\374\216^\263"
+	.ascii	"\377\030\247b\366=\377g\337\363\353\207\337\232\347\377\350{"
+	.ascii	"|\037\354I\036\306\177\335\364\350\214\240I\376\337UR\270\354"
+	.ascii	"\fh2\260\337\023\013\032\376cQ\343\177\374:\356\373c\351:\247"
+	.ascii	"\361\224s\026\276nH\331\335\221\244\262\257\020\267\002"
+	.text
+	.section	.gnu.lto_.refs.999bf63f7ce1f656,"e",@progbits
+	.string	"(\265/\375`u\007\275\""
+	.string	"JG \016H\200VR\032\003\325+!\006\245\245P\372\267\255\003\245\021\332\\G\317q\301\025g8\030\367CDw\247\203\303\242\330.7$\224\352?\tL\264\214Z?w\335\315o\345c\267-\255e\004|\230\225\375\371\301\332\001\033![\246\302"
+	.string	"\330"
+	.string	"\321"
+	.ascii	"\325\305U\025\361k\212\251\341\327d\233\273"
+	.string	":\272\271\270\341\357\233[\321/\033\2264\341\257\223\2610\005\277J\210\022\374z!\370\235\021\243\305U\225\212\023\007~\223m\356\352\314\214\031\372\305\b\325\357\022\374\337\202\365\331\f\374S\200\277\031\360\231\202.\260[#}\273\003\337\276\344\333\225|\373\321\267\033}\373\260g\027\366\354\bxv!\236}\300\316\316\263\263\377v\366\233\337\004t\336\001\372\233\237\007\360\363\251\317\243>\017\340\275L\276\220\024\021\362\303\367\333\305\325\363K#\213\347\227E\225\212\235_\023\277\237N\347\237\023\360\257\005\370\2359\277\230\357\2178?\354=\360\246\016\004\340}x\337\223\276\016Z+\360{!\002\317s\273\311\363\262 \237\367dV\221\362\204\f,\211\021/\036\\6\264\262``Y\021\237\267\002\305\024\217D\361y\"\330\334\025?U\263\362S4d\346\214\237\306!?}[\354\32366,i\207}\212v&\005\352\323%\330\204O\207"
+	.ascii	"\361\342\301u\203\206\204Oe\274\300\022~\312\202\252\351\323"
+	.ascii	"\024N\365t\312\351\323$\321\243vuO\217\236!#F.\016.\302\243n"
+	.ascii	"Y\326\236M\2643)f\31311\260/\247G\217\020iz\364G\027\362Q\256"
+	.ascii	"-\b\217j=x4\313\301\2430\032<\332\202\351Q\253\245G\251\030<"
+	.ascii	"\212B\351Q\251d\322\243Qk\354\352\222\276\2329~\025\003\246\313"
+	.ascii	"\026\244\257k\306\257N\246\225\342W\263\345\230\030\330\327\202"
+	.ascii	"\257D\202\370\330q\364\325\206Q=\310\275\312\305\301\265\261"
+	.ascii	"9\231T\242<Q.I\202D\310\017b\217\034D\342\327-\255\030XVU(\212"
+	.ascii	"{5\261r\257R5i\334k\024r\3375\213\355\253\206\370\233\346L\031"
+	.ascii	"\272\303\366\r#\367\005j_8.mlj\316\346\201}\317\246@qB\246\034"
+	.ascii	"\332\227\310V\366\005b\334\267K\007\216-\244}gd\305(\356{\265"
+	.ascii	"\342\204\224\b\2732c\206\277\334\027/p\\\334\026\354?\211\315"
+	.ascii	"+V\216\366\313\210\017E\374'\3427\021\037Y\264?(\332\231\220"
+	.ascii	"\273\022r\017^e\027\360\331\032\226\306A\342\377z\274\311\316"
+	.ascii	"\220\216\364r\f\373\357(\365\336P\352\205z\220\316e\365\234\311"
+	.ascii	"\266\200\036 }y\205\372Q\321\313O\020,\320\203s\331\357dS\350"
+	.ascii	"\315{3\006\377r\347C\255L*\336V7R0s\037\022\002\356\374 "
+	.string	"\240\237\316Z\3528\314\n\202\347\243\261xd\264\332>\\\355\1779\275\323\376\200\363\256V=\250\325\016{\275\351\\\016\365\341\317z\321\316]xs'\232Y\007\236\366\276\233\317\233\371u\346\033z\247\317\340\2366\203\365\364\013I\021\341\236\n\361j\332\323\0347j\300x\332\323+\253*\252\024'\"\354\251\324\b\247=\215bc\247&M\031\27290q]\336\234v\324m\255iG\237M4\341B\371\251\243f\243\355\350\223e\331\317\216\216\001\355\2502\354\270\304gG\201,\355\250\017\257\256\0359l$\355h\r\255\031Y/\260\250&\354h\211\343\216&\217\217F\335\241\371\354\253\03127\331\353\230\200\372\250!\214B\004\262F\002\031))HR\350PSM\222\016\020\360\026\003\2036H\240E\006\306\302\030\242\331\033\314\033UVh\034\344$is\225sc\024\001\325\022\b\2068\017\266\002\006A\216\240\317\256\205R\004"
+	.string	"\373G\021@\033\346G@f\351\031!\226\200\245\240\3510\272\346/\376C!2a\231\007\rw\b4Ct\206\017\201\221\016B\270\t\213q\242*D\363\r\rF,:\235`\200&\031{\002\346-\234\"z\372\034l-C.\004\335E\367|(\372\214\n\377"
+	.string	"\276\231\315\332\001\222\260 \007E\300\311\215\216\2062\3038\305\212E\2103jG\350\341/[\356$.\332\230\030\027\216\r4$=uq\273;.Vx"
+	.ascii	"\322U"
+	.text
+	.section	.gnu.lto_.decls.999bf63f7ce1f656,"e",@progbits
+	.string	"(\265/\375\240\022\002\001"
+	.string	"\245\016\004Nj\006\245\026U\0200%)5\006]\rSH#\202\013on\206\357\246f\243\343\323\370oYEb\"\"\037\317\314D~\257$*r\370\264I}\201G\347\324\310\316\326\2463\023\237w\n\370\232\026o\243\263\b\307"
+	.string	"\200\324\376\207\325\267ok\243\005\337\310\326,\221{o\271\345N\001e\023\325\026\274\027?\032H\307\353\236\216\261\366i\030\252t\345[\241<W\311my\f_.\263BY\360\023\024\307I!$\371\242\323\313[{\360\255A\324:\365-H\354\323C\002\022;:\275<WI\0234L8h=\240\242\021\247\"aY\177Hff-\263\346\251\322\365\314:}\276\222\261\224\255u$\3048\372\025I\211L\355V<\022b\034\375f\310\031\231\236Y\335\3269)\003\244IA\243\344\203\333w\005\210i\353\225\314]\027!}Y\177\3105f\275\033\303\021D\nO\225\256w,\234\225\021\262\254?\264\332\037\362\330bV\2720m\221\037D\321\254?\034\022\023f\206\217\022-0_\303"
+	.string	"\251\370\226\210e\275~Y\265\020\321\230\373\312z\365\242\276mAj\322\313z\345\262vam\240\311"
+	.ascii	"\323E}\2732\364\263e\225\213\013J\231N5)\263%\256=2\304H\021"
+	.ascii	"\334\3278(hnQY\257XV-\377\177\033)j\314H\313\233\020NL\0262\262"
+	.ascii	"(\213\344\247J\217,\353T\360\313\214\230.\353\365\212\372\006"
+	.ascii	"\246\316\312\331\333\377\037+U&L\224\254/\244\333\027^a[\253"
+	.ascii	"\254\355\"r;\320\304\330\326\342\304\342.Y\257k\247k\277\364"
+	.ascii	"\250\351}\255T\246\354-M\241\312\372B\"\373\252t=[\247@\261\022"
+	.ascii	"*\313z\235\242\316\t\365\334\260(e}\2745\312\377\037q\256+\n"
+	.ascii	"\225\254\3775\212\031\221\b.\2162[\241\374\312tI\263\225\365"
+	.ascii	"\205R\373\302\035\233\254H\245'\013G\326\027\036\355\217X\305"
+	.ascii	"\326!\352\233\226\326\352d\035S\245\253\330:\365|%c9\007.\261"
+	.ascii	"\225\310*U\337\230\2141\020]\024\016\037\202U`\234q\265Z\272"
+	.ascii	"^\255L~\220A\303\326&\252t\225^\272\026Y\223\250ob,(1\233\352"
+	.ascii	"$+)\271V\177\255`\252te\262F\267V/\013~\202X \263\204\311\212"
+	.ascii	"\265jY\360\023\304\002\332\330tS\031\202&\244\325\027\002yu\r"
+	.ascii	"\205\242 \341\302\265.\001\332`zC\313\372\301\274\315u\265\350"
+	.ascii	"\b\f+Y?X\267\257J/f\315:\335\224\333\322\222\254\037\374\262"
+	.ascii	"\037\214\333\017f\331\037\221d\245Z\253\32471\023neV\253\022"
+	.ascii	"U\272&Y\221\254IV#\352[PhJW\016*$[KZ\375`\326\326W@N\256d\275"
+	.ascii	"\036Y\241\361pH\327\224f\225\365\203T\373\301 \373A\250\375\340"
+	.ascii	"\216\375`\215\375\240\214}`\337>\020\315>\220\314\n\344_}\254"
+	.ascii	"A*\233\352&\241}\235e}\240\230\335\252\031\332\f\324\f\355\245"
+	.ascii	"\250\033\332\003\337\366\201j{}\352P\354\001\304G.\353\003\233"
+	.ascii	"l3Yo\215BU\370)\232\352X\235\326\035\252tm\372\332\224\321\254"
+	.ascii	"H$\3048\212\300\017\321\264i\315q7\013~\202b\037\036\037\034"
+	.ascii	"9S\245\226\027\307\361\207\016\037>\350&A\252<m} \215\3755H\250"
+	.ascii	"\203\372\026\344\204\252'vEY\323\025)\247YeX\360\023\004\001"
+	.ascii	"\2662\032O\023#\322\232~\031\362\240\276\211\231\220\302\265"
+	.ascii	"\"\255FO#\002\031c #XS\325\312\212\264\316\350\320\n\021bd\272"
+	.ascii	"\336Xq\254I\353\322\252\264\332X\231\326\032\252tEZ\217\316\201"
+	.ascii	"m\"\315Cc\243\377k\262\377\363\332\377]\355\377\250\366\177?"
+	.ascii	"\366\177O\373\277\033\373?\242\375\201\272\241]cp\310=upFY\177"
+	.ascii	"\357\355\377\353\317\n\244JW\030\271\357\252\225\274w\016\321"
+	.ascii	"8.\313|k\017\261\247&\216{\210\201\2560V\237\265G}c\212\306I"
+	.ascii	"6b\274\374P\312\213\343(\207\017\037V30d\244\255\376\336\332"
+	.ascii	"\377\332\263\306A\276%M|"
+	.string	"k\234\373\210]TC=\262\376\226\332\337;\366\267\215\255\306\352\206\366\273h\377\371L&\223\361\324h\007\3301!+2\262\316y\"\236\317\300\b2\224\224u\007j\206\366[\306\376\366\3319\252nh=\250\031\332\017\324\f\3554\333\251qe\364\204\306L\277l1\034\2125\232\234\004e}7m\177\204\226\274e\375:\332d@r|\311aTi\006\223\345\354\300\344\271\354\245\306\006c\240h\224\f\311\362\320,\265\232K\356R\244QD\306T\326wopq\207\366[39.'I\207\be\375\026L\206k\267\354\267S\366\337\324\f\255\032U7\264\034\324\f\355\247P\366\216\252\033Z5(k\377Y\355y\355B){1\226\262V\325D<\253\255R\324b\354e\375\226j\253\261\232\241}kc\253Gy\212\024MF\005\212Z\024U\232\245d\263\353\250\224L\226\241\250ob\261\217\217\f\216@\325\225\311+\326\335"
+	.ascii	"\242\244\365Y\272\r%\227\345L\364\203KP\326\036\362\223h\361"
+	.ascii	"77\246I,\353\263r\373\354\333\376\363\230\030\016\221,f\262\266"
+	.ascii	"\002\302Z\242\326\305I\223\027f\314\240\223>7y\312Pq,\026\244"
+	.ascii	"ZJ\243\313\032\004\021\317\322\026\013\215\307\2310<&\352\031"
+	.ascii	"\226I\233\226\017\330\327P\314\225\334\217h\366R\245\371+w]\251"
+	.ascii	"ukT\312\226\301\244\310\364+c\021\201\272}U0\342Z}\226\311\022"
+	.ascii	". 4\216\362\226\365V\326R\245\231+g]\251lD\037c\f\364C\004\345"
+	.ascii	"\312X*\233\210h\334\021V\034\307\034>|\310\200\2250gZ}v\310>"
+	.ascii	"\333c\237mR\222\204\205\301u\327%k\253(P\034\307\034~4\226\320"
+	.ascii	"\244\311\372,\320\276\bDt@\213\250o\304\036c\374\023\227\003"
+	.ascii	"\232\221\344*U\232\217d#W\247\250{W\325\265#\231*^\343v8Ya\305"
+	.ascii	"q\364\303\007\016\037\226aFxl}]\267\257\325\366u\331\276\356"
+	.ascii	"\332\177\236\032\242\213\250xQ\311:\017Q\337:@A1-\276\263\222"
+	.ascii	"\265\b\021\317BT/4_kAz\374\242oGFY\177\004\2171.\035\371\211"
+	.ascii	"\370\213\343\250'\3208\216\257\332\365\310P\371\211\b\024\215"
+	.ascii	"\221\\!PqGyq\034\377\317?\262\217\fD\225\346\0369\352YJ\375\362"
+	.ascii	"\341\303\007\016\332iJ%\264\265P\315\320^#\355\353\240\375\365"
+	.ascii	"\314\316;r\223*}Zv\372\001E\3430!k=B\262\376j\267]\304q\034\253"
+	.ascii	"Ok\335\247\265_\273\354?\347\310LbW~\254)\251uD6\216\241\312"
+	.ascii	"\2408\362\rU\232\231\362R\216\306qX\034\307\037\301\224m<q\262"
+	.ascii	"\342\360\201(\206n\310[\253\277n\355\257U\373+\220\375\347\032"
+	.ascii	"9)O)\212\272{Nz\353\300\021\005\273\211\215\244.H\027\024\243"
+	.ascii	"KD=\362Q\016\322\202D\367\223\365\325.\277\b/\352\034\bUD\350"
+	.ascii	"\353\232\332\345\251h\310\246\"r\274\004\272\306\247\276\251"
+	.ascii	"oL\n\320\362\232~\371E<\007\251`\324:\242O4>R\200Y\216\252<\270"
+	.ascii	"8uN}cR@U\333\237e\344\030Y(\033\345\031\031F&\312@\231F.\312"
+	.ascii	"C\2524\007\345\236g\237\374s\035\215c\2408\216/\202\233\372F"
+	.ascii	"\\\343\330\311\r:\342W\255hQ\337\210=\321\330\310\004+9\252\362"
+	.ascii	"\270~\0219H\275S\315\250ob&\310@\231\306q\364\352\036\b\"\344"
+	.ascii	" 5\215\372f\301O\034;5\331\304(["
+	.ascii	"C\223\027\307\321\017\034>|\370\360\241%#\203\207\031\016Z\205"
+	.ascii	"R7\264\032\324\f\355\263\230\375\334\266\237\235\354g\350~^\332"
+	.ascii	"\034\324\r\355\031Uo\370v\303\013Y\326\317=g\350\3242*\021\031"
+	.ascii	"\037J\262\276Ze\253cT2\252T\305\373\325\251jw\r\006\025\207\305"
+	.ascii	"qt\270\372,]\211\222\365U\017m\261\257\257\257O\365\320^m\262"
+	.ascii	"3P7\264Z\315\320\252aT1\252\264\003\225.Z\314Si\306\230d}u\311"
+	.ascii	"\276\332A\273\366\365\251\035\264W\213\354\277\251\033\332\253"
+	.ascii	"O\373SuC\253\316eUN\345ruN\335r\020D\270\020H\235\323q\354\243"
+	.ascii	"\252\032\020UU\0036\255\210\017\223V_\305\261\257\002\355\347"
+	.ascii	"\251\033\332\343l\365\212\212E\225^\240f\211\026\207|Y|h\262"
+	.ascii	"\376q_\275\240U\373\324\013\332\237\330"
+	.string	"\306\266*-\230\230\272\316\256VQ\331T\250\230\002b\r)V\216\254U**\232*\355\240\246]US\327\316\372D\343h\034\307E\365.\310\017R\326FuC\233\325\f\355Y\330$\210c\265C\253\366\365\251\035Zu\212\210\253g\031\332#\246h,\026\307qQ\001S=\264\262^\325\f\355\257J\351\340^My\372\021\245\003 *O\270\314\240\374\3701&\226\265Z\266\213\322\304X\313\372!\354\253R\365\t\231\013NR\306\214]%;\2350\266@{\201!T#\353\343\251b\377\177\300\271/h\336\304\234\2700\364\332\302\262\376\257JU'j\223h\314A\350\344#\007\227\254\337\301\276\032\366\"X,\302\335\375\253L\300\324.\320&\267\254\177\025\354W\267T.\365k\r\032\202\212\305\3428ZS\334R\372A$\312\025\307q\3617\005M\022\033Y\253]\252\327\325\250\272\344 \210\360\265\007,\346\212\343X\215\206"
+	.string	"\025\307>j\264\270\027\307>EU\325@U5\320ZRTd\255~\336\217\252\033\332\255fh\233.K\fr`W\274\370\023\3356n\343\374\234{\271u\376\337\007\376\026\315o\347g\237l\340g\217\3051\277\276\263\331@"
+	.ascii	"\025\317\200\005m\237\263\254\311\272\370\331\020\020\257\200"
+	.ascii	"?X\343g\217?\273\374Y"
+	.string	"\017\374,\363ga`w\332\267\037\316\337\006\177,\276~\357\337Z\360\273\371[\n~\311\237\325\362[\361,,\0067,\007X\r \345~\310U\004\273\342o\367\026\360\017\317\374\355\227\t\3744\360o\f\374?\n\254\"Z\271\337\004~\326\346g\211[\003\377\336\300\377S\301\032\377\323\025\267\216\001v\303\377K\361\037\212\026\004\374C&\377F\356\025\377\017E\\\333\345*,h\277\374'\376\303\264\337Ms\367\037r\371\331\017x\375$\360;\361a\334\337\312\375,\006?\233\301\317&\377\353\177\b\345e\256\367\253\277\323}m\025A\346\177\336\013\177\366\300\201\204_(\"\315\377c\341\317\030\360\375\277\025\264\t\277V\341\337\372\337\354\377S\341\327\371_\315\260\355\336\277\024\376]\374\267\206\177o\370\177&\376\266\312\257\304\317*\331\034~6\353\337\035\376\037\n\355\316\276\340G\342\327\025\330\031\374N\3707\007\377&\300\377k"
+	.string	"{\302\277=\374,\211\177\017\340\337\037\\0\256\230\265\003\352\007\266\210=\"\207 \3741 {`\257\266G\3707\002\376\337\002V\241\225hEZ\225T;\365n\177\360\357\005\374?\005\254\035\374k\001\326\013\326\021\376U\304>\341\337$\376_\002~w\356W\\\277V\262\255\302^\341\377\231\260\266\347\034\360+A\345\322B\371\221p\257\313\235\202\037\0022\223w\360\033\361\263\356O\304\377\363@\237\371\177\034\374\277"
+	.string	"\374\277\016\377/\303\257b Em\361\017y\354\232\024T\025\336\201\212\201P\330\241\315\372\325\374\255\220\r\304\036\371\335*?#\213\266\212"
+	.string	"\303\340\037\302\370\335\271\337\345\362\377\\/\252\235z\347\336\375\356\230\377Gl\307~\303\225"
+	.ascii	":\2136c&\342\0376\271.~\302\337\205\177\227\347\377\005\177\027"
+	.ascii	"\313\357f\371\177@\215EG\227WA\366\017\376\241\r)\277\237[\366"
+	.ascii	"\273P\376\337\326Y\322\\\203\177\370B\356\327bV\021a\336\301"
+	.ascii	"\327-\310\233`\310\363?\213~\362k)\377\317\375\365\226_\203\371"
+	.ascii	"[$\277\366\327L~\r\366"
+	.string	"k\263\377\307\376:\353\327ZQ\376\237\376u\025+\256\b~w\004\377o\375\335 z\355\327o-\364\227\177\235\305\025\373\335\261\377\247\022\271\216\376\347\220\346k\343\270\n\235\367\006\374\303\t\374k\t~=\344o{\354\275\177\245\362\257\302\177\265\371W\342\237\365\3765\3779\315\277f\370W\366\317|\377\272\341\3273~]\364\257\300\177u\177}\364\353\240\177\r\376\353\357\327H\377\252\201_\313\370W\026\377\212\201\177\315\300\277r\340_s\376\215\346\327L\177\013\265\365~\035\343\327B\377:\202\177\225\362k\032\377>\363\267;v\336\257\221\277\326\3715\363\327\313\277e\332f~\275\342\327\307_'\377Vi\227\321\025\370\335\022\374n\317\257-\360\267G\033\357g\253\374l\333\277\311\374\232\304\257Q\370u\003~\315\200_\237\360\273@\277\013\343\337c~]\342\337w\377\236\376\372\205\177\333\375\355\320\256\333t+\337\257?\374\272"
+	.string	"?\313\376m\320\026\023\200_k\360k\f~\275\301\257\007\360k\001\374-\214\035\346\327\373\3275\277\316\360k\375\257i~m\374\365\372\353\340\257\177\277f\177=\374\265\206_\253\377\272\367\2637V+\377\006\363\257m\177\333\263\277\374\353\222\177\365\372W\351\277\275\374k\332\277\273\374\355\b6\227Uk\335\332s\253\222\177=\362\257D\376U\310\277\016\371W\350\277\032\371W$\177\253\334r\177\313b\305\361\357-\377\272\364\357\270\177\275\361o\270\177\315\361o-\177\233\334o\377\352\363\267\307\235\345_\337\177M\376+N\233\201\277\325\300\277\261\374\353\t\377\332\200\1775\361\257%\376\025\205_\247\371\333\n\354+\033\374\353"
+	.string	"\376\325\303\277\335\376\265"
+	.string	"\377*\302\277\226\360\273A\333\312\277z\360\357\266_\243\371[\t\374-\212\177Wi]\3707\333\237\247\177\276\373s\335\237\311\374\353\377\214\367\257\305\277U\341\352\317[\177\366\372\263\326\237\243\177\346\372\363\222?S\3759\353\317X\177\006\373[\023C\376,\344oI\374-\n\377^\373\363\323\237\235\376\f\365o\265\277]\300N\373]\032D9\351\317J\177F\3723\323\237k\374m\t\033\355\3174\376V\204\277\035\341\337T\362\363oAp\217~\027\351\337g\177f\376\355\007\371\346\317\036\370\335\245\337\275\361\357)\177f\341\317)\374Y\205?\257\360g\024\376L\342\317&\324\277=\300\337\202\370\267\224\020\376\035\345\317!\376\374\301\277\315\376,\302\237A\370\363\b\335\367\267\005\330P\330\246]\366?\372g\r~\026\352w\203\374\373\311&\373\363\206\277%\300\036\373]\"[\214\370\253\024\370U4\177\026\376y\377\255"
+	.string	"\376v"
+	.string	"\377v\362\273\"\334\252\337E\362\357&\277\233\344?\3356q\265\324\332R\267\353g\201\354\260\337\r\3737\223\337\225\376\033\354W\233\377*\343_i\374\253\321\277\002\375:\304\277\002\340_)\370\013\357\340?\005\377\275\376c\200"
+	.ascii	"\377-\370\267\327\277\273\376}\365o\350\277\232\260\205\374;"
+	.ascii	"\352\337:\376\215c\307\320^\240*\375\302\004\374\252\376\367"
+	.ascii	"\215_\025\376{\351W\201\277\032\374\325\341\2576\340W\031\360"
+	.ascii	"\263T\266\215_5\341WK\330J\277\032\342WA\370U\021\277\272\302"
+	.ascii	"\337\346\277]\377"
+	.ascii	"]\203\355\333I\277J\200_\345\3005\361o\244}\244N\360\273)\376"
+	.ascii	"m\264\213~6o\023\375\356\n{\350_El\032\277{\201=\343W\177?\213"
+	.ascii	"\306\222\371\267\320\237[\344\030~\227\305\016b{\225\323m\023"
+	.ascii	"\277\253\201-\343w\221;\306\206\361\277L\277\375\354\226_k\371"
+	.ascii	"[!\033\350\337??[\343g\223~\366\350w\227\377\366\371Y\033\277"
+	.ascii	"\253\363\357\236\337\035\341w\021\360\357\235\377d\376\347\375"
+	.ascii	"\356\t\277\033\201\337\245\300\177\013\376w\360\237\303\177\002"
+	.ascii	"\374\377\372w\374\357\027\377v\361\357\030\376C\371u\336\177"
+	.ascii	"\025\377\263\374,\334\177\271\377%\370\203\322\337\025\361\253"
+	.ascii	"\017\370]\020\376\375\201\337\035\341w\021\360\357\235_\347\375"
+	.string	"l\333\377\337\037L\362\273\"~\365\001\277\013\302\277?\360\273#\374.\002\376\275\363\353\274\237u\373\377\373\203Y\277\333\374U\273\337\375\300\257\336\375\354\004~\226\356\177\373\007\257\374-\004\376\253\277P\307\277\233\377\326\371w\316\277W\374{\003\377\306\300\277]\370\367\003\376\275\302\277I\374{\001\377N\300\277K\3707\002\376=\342\337\"\376m\200\177\177\370\267\207\177\023\340\337\003\370\267\006\377\306\340\337\035\376\275\341\337\305\177\017\377\375\3737\373\273|\277;\346w\305\374.\230\337\365\362\273\\~7\313\357\266\375\356\224\337\205\362\273c\277+\375]\257\337\335\372\335\253\337M\362\273H~\267\310\357\n\371\335\033\277\213\364\273D\277K\343w\205~\027\306\357\366\374n\t~w\004\277\373\342wy~\367\003\277\333\374]\235\337\305\371\335\233\337]\361\273\307\337\335\300\357b\340wU\374.\013\277\233\302\357\226\360\273\b\370]\020~\367"
+	.string	"\277\353\301\357\026\340w\t\360\273\035~\327\370\273\354\357\256\177\333\367\263c\177\273\367\267c\376\326\356o\277\374m\227\277\235\373\333\270\277\325\362\267m\177\253\366\267h\177{\366\267R\376\326\354o\311\376\026\354o\271\376V\353o\255\376\366\310\337\022\371\333!\177\353\343oy\374m\323\337\342\370[\033\177\213\364\267D\177+\364\2671\376\326\347oI\360\267 \370[\027\177\333\342o\341\277u\376\355\316\3372\377v\371\267\036\370[\026\177{\363\267\035\370[\r\374\255\005\376\026\305\337\272\360\267*\374\255\211\277E\341o\031\360\267&\374\355\b\177\013\302\337~\360\267 \376\366\303\337v\360\267\003\370\333"
+	.ascii	"\374\355\005\177\313\341o\215\177K\374[\341\337\272\177\313\376"
+	.ascii	"\355\372\267\377\3314?\213\346g\317\374l\231\237%\363\263w?;"
+	.ascii	"\375Y\272\237\355\362\263s?\273\345g\341~\326\355g\333~V\303"
+	.ascii	"\317\356\374,\362\327T~\215\345WW\370\325\024~\026\355g\251\374"
+	.ascii	"Z\311\317N\371\325\020~6\312\177\266\377e?\013\345g\313~\226"
+	.ascii	"\370\263\321\237\335\372\331\254\237U\362\253\030\374\031\203"
+	.ascii	"\237\265\372\331\252\237=\362\263@~\266\307\317J\375,\217\237"
+	.ascii	"u\372Y\035?\233\343g\231~v\002?k\343gk\374l\322\317\036\375\352"
+	.ascii	"\003\376s\370\277\366\237\356\177\226_\233\371Y\021\374,\b~\366"
+	.ascii	"\305\317\362\374,\374\263\317\237u\376\354\007~\366\346gW\374"
+	.ascii	",\005~v\203\237\235\340g\335\237m\177V\377l\376\331\377\232\357"
+	.ascii	"\327{\277\326\373u\336\257\361~M\367k1\277\016\363\253\\~\375"
+	.ascii	"\345\327Y~\r\3755\216_+\375\372\371k\347\257o~}\201_G\340\327"
+	.ascii	"\037\374\032\304\2579\370\365\004\277\336\360\257W\376U\355_"
+	.ascii	"\235\374\353\326\277^\375\253\323\2776\375\353\216\177\325\361"
+	.ascii	"\2570\376\365\347_\225\377\272\302\277\232\360\257 \376\177\375"
+	.ascii	"+\005\377\312\341\317L\376\034\366\347\251?G\375\031\307\237"
+	.ascii	"\207\376\f\377\271\371\337\205?\303\360g\b\374\371\001\177&\341"
+	.ascii	"\317\002\370s\207?s\370s\315\257\236\370U\026~U\205_-\361\253"
+	.ascii	"(\374*\211_U\300\257\212\360\253\037~\265\203\377)~\265\303\257"
+	.ascii	"\332\374\252\361W\213\377\253\374\217\362\337\354?\224\377`\277"
+	.ascii	"J\302\177+\377;\364\365\365\365\375\027X\360\207\230\372\223"
+	.ascii	"$ N\254\250em\344\0235T$\353\227\200\266?\"\3503\024\234\021"
+	.ascii	"\024\n\016\005i\004\203\202E\2524H"
+	.string	"\024\374y\020H\367\330\353\213\213\202DA\030A\031k\024\252\002\223\035S \237\016\021\202D\301\236#S\364\234\362\3428\n\007\265J#\352?\030\343A\031o\203\200\242\254\262\336aD<\030\243\013\322\024\033Y\277\204\260\035T3\264/!\311~\t>\366K\250\261_B\320>\ty\373$h\331?0\315\236\220\311\030(\222\2751+\227\030,S4\3001\252\025\232U\026\2753E\262\033dRg~\240\031`\036\020N\b\225fJ\006K\326\302X\335\320\252\3212\352\223\242\325\021\023\021\036\320mx\245\f)\n\231\265\013\033\326F\006\313\030\033O\222\3440\273\003\332u\031\322\341\224\365t\370\304U7\315\372$D\331W\355\346\226\210\001\326\001\303\250R \035\260\213\027 \030\365M\314\304Y\327\024H\007\344\222\313\220H\3103\222\302\262\216\231\301\205\306\326\300/\3055\274')Y\237\204\251}\022r\354\223\020\264\217"
+	.string	"\276}\004\200\331?Pn\313\217\021\336\324\031\227\004#\016\016\f\222\031cYk\311ZC\020\220e_]c\003\272\001i"
+	.string	"\335\200V\200n\300*\277\274#\"\230\212\370\252\362\200X\200o\300,\300+\252\024\350\006l\023\216\271\022\203\003\250\217"
+	.string	"\257}\004 \331G"
+	.ascii	"\325>\002\202\354\037\270\006T;2\346\b\250\006L\333R3b&k \232"
+	.ascii	"\ri\230Y\326G\200\216m$\227\365\331\005\241\301\005d\b\372#\227"
+	.ascii	"\021A\355\240{^\3000#&FE\202\246G\200VjzT|S3\240\024\340\024"
+	.ascii	"\340\031\320\t\260\t\020\n\220\n\360\t0\n\260\f(\005\216\001"
+	.ascii	"\305T)\220Lmr\340\022`\027\220lg\345M\261\200\\\026\374\004\265"
+	.ascii	"\300D\007\024\002$\003\016\001\022!!\306\321\217F\234\020\220"
+	.ascii	"l\003\001^ipWdf\257\3751c\222\004\003\rdR5\304\265\225\365G\220"
+	.ascii	"\333W\245"
+	.string	"@\260\257\264'=\321\003\277\326+C\220\204\325\375\377i/$L?\262\376\bm[G\325\r\355\305\324\f\\\300-\261\2570_t\025\227(T@-`VW\\\220\266\254?\302\330\376\b`;\tPI\321\f\021\231\271\253$@$B\253$##Y\177\004!\273j\004\036\373#0\355\217@c_\004\276}\021\360\210LA\251\300\304d\375V\024\362m\305\361\310\372\"\204\331\027!\313\276\bg\373\"H\367E\300\332?\320\007\260\007+F\246)\b\216\003{\374\300\034@\035@\251\035\313@\352\311:J\037\2751\321e}\021\246\366G\354X\300\r\256' \017U\n\204\0026A\001\235@\350\025q\301:\323\213\"\324\352\213\340c_\004\246}\021\216v\006\261\232\241\0052\2118\020\207p\306\214#d\262V\373\2007\200KG\216\204\210\262\006.\375l\023\240\020\320F6\352\221\022e\255\2646QI\315\310\372\""
+	.string	"\355\253v\300$ \021\320H}\023K\241)\f\024X\003\210\004<R\245\300$\340\220\006&\001g\250u$\314\210\325\370L\023\230i\034G\201I@\032\361O\034Z\002\320\212\270`\351*U\366\240\033X$\364Y2\323\222\365C\210\333\017\001m?\004\261\375\020\302\366C\310\332:\006\006m'9\356\232\276\2002\2001\326$Ew_\2020|\204\301\001a"
+	.ascii	"\201\200@\300\037\240\317\216\342\363V\266\326-)1\312\372"
+	.string	"\007\366"
+	.ascii	"\343\351\322\026;6M\232#F\337\217\017\b\244G\232\330\b\200,\251"
+	.ascii	"K\363\333c\211\302\020y\t\247X_Rh~z\271N\216\217\306O\257N\205"
+	.ascii	"j\273\242\366\345L\336\260\b\022\260\0373pT\322d\375\020\252"
+	.ascii	"\366\377+\203\247\227\270\200\331\372\221\371\215Q\245?\274\337"
+	.ascii	"\035\007\256\351\332\345\207\367\263[\273\220@\246\bNM\3770\361"
+	.ascii	"\342\326\352\2070\264\037B\320~\b@\373\377\325\375\316\332\244"
+	.ascii	"se\262\216\002\277\004\2312\363\023\363\013c\003IMGY\232\276"
+	.ascii	"#x`\276\304E\321\002\226\365\227\377\377y\021B\035\001\245S\240"
+	.ascii	"g\262\356\262\302\210\321\343e'\367\233S\245?.\277\270\037\027"
+	.ascii	"\266\350\007'e\364\343\362\333\322V}\370\331h2\243\321\352\217"
+	.ascii	"\230\333\037Ae\377?\270\237\026\342\334t\017\212\n\246~E\231"
+	.ascii	"\202\240te\375\377\336~Y\240P>g\262\376a\371\255i\035z\207\030"
+	.ascii	"P^\024\312\234X\225\237\225_\333\317\355\307\246J\177W\376[\013"
+	.ascii	"\002\272\362K\333c\335~U?\2535\f\272c\304\365]\371%\371\241\255"
+	.ascii	"a\320\035\345'\3154\216\201\256\302\375\256\204A\267\fi\320\364"
+	.ascii	"wE7\251`k\030\3647C\n\315\224\b\235\252BD\250\377\237\332\377"
+	.ascii	"\003^1\203\003\232\365G|\355\217\340\372Q\211v \212}\025!\312"
+	.ascii	"\372#\246\246\374\244\374\242\250\322\337\331\317~b?\2635\nu"
+	.ascii	"\243\374\324)\371-Y\243R\366\2238\272\351\357\354\327\365s\""
+	.ascii	"f\372\201(\027M\203ck(zPlzY\177\204\322\376\210'?\262\266j\215"
+	.ascii	"B]\2628/\3238\016+S\245\277'\2771\367H\352L\232\326\037A\264"
+	.ascii	"\017B\231}\020\246M\2640\f\251\310X\326\007\241\312\376\377\013"
+	.ascii	"S\245?\351\317K\217\370I\177\321\037\023&W\246q\034\306\341C"
+	.ascii	"\361\312\215\353\206\326?\260\250\252u\2474\315\372 4\371}\201"
+	.ascii	"\260\265\017B\217}\020\2326WqiI\2144Y\037\004\032\373#\210\374"
+	.ascii	"\256\200\262\364\324\357j\312\255*\242:\313\213c\240\377?\255"
+	.ascii	"\337\226*\375e\375\260\200K\320\256h\264\372\"\262\354hT/\316"
+	.ascii	"\310L\326\027\301\266/b\312\376!\331r\323&,Y_\304\223}\021N\366"
+	.ascii	"\377;\362#R\007d\213S\326_\245v\264M\367x@\2012\373\242\303\312"
+	.ascii	"\264\310\017\372\003\362\013\362\233\372\031\371Q\375\206\374"
+	.ascii	"~\374\204\250\322\037\221\237\217\247\250vmD\0172\250\023\333"
+	.ascii	"\364G\344WeJ\344'\265T4\345\204%\347\005\314\320\004\372\"l\354"
+	.ascii	"\213\b\332\377 o\377\0030\373\037"
+	.string	"X\331\377\200l\377\003\256\375\017\206\354\177\240c\377\003\243\375\017~\366\377\313\361c\322\322q6#\353\217`\372--\240F\025\033\016U\372c\372\3358\b\"p\025\357v\220\251\241\365C\230\331\017!\267\377\237\215_\2145\013U\327\327\356;\003\365\241\333|d\210\370\254\362\364\370\246{{\3233}S3BS\274%\">\253\274_\214\337\217\2106\">\253\274<\265\316\002\030q\f\345\324\036\021\361Y\345\305S\">\253\274_\214\215&\315\324l\247Q\347\312\020\361Ya\375zT,D|VX?\242\037\214_\321\217\306\317\350\207\364\023\372\035\375\202~I?\245\337\214\237\214_\215\337\220*\375\305\370\001\375b\3542\255\022\021\237\025\020\215\335\031\246\f\364C,\331\017Q\265\037\002i?D\317>\210\274}\020r\373 \320\366AH\367Ad\355\203\350\261\017\202\306\376\001\312\354\037\340\312\376\001\302\366\017`d\377"
+	.string	"M\373\337d\362t\217\331wA\351\326\224\334\266\333\323M\267\353\266\030U\272\3576\230\3570Z\353\352\\\222\273\271\243\274=.^\210@\273\354\273\375\245j\356(\317%S\302\205\207P\263j\206\366\007\230\261\177\200\236}\003\220\3317"
+	.string	"\334\276\001\240\354\033"
+	.string	"KN\313q\310\025P\326\037\201e\211\333\032d\005n\307\355\267\275E\225n-;\213\230\210\255e_\271\202\233;j\233\330y\311\001\3247"
+	.string	"\220}\0030\355\033 h\337\003\276}\017\276\354\177\267\355\265\240\234\034\224mm\245\2122]\333T\314\324v\332\256\262\331T\351^\333hS\252\254\3553(Q\227U\0137\003M\013\250\357A\326\276\007G\366=\220\332\367\200i\377[\3126[\nKs$k\263\235d\213\255_G/\374\320Mw\331\206\262\243\250\322m\266\307\276\311\366\023\263\215\244.\213\331\256\312\003~\211\323\373\261u\013\245nh\277\305\003\241-\366\347,\333j;\311\034\370Hc&\353&m\225\243)\227\254\377\241\f\223\r\266\243\333k\207\355/U\272\245{\211tg\355\255\365\353hG\371\3012\355\372\002U\342e\032\307\321-\335\\W\256\272@\267tc\271]DJ\366\260\3428Z\2343#V\205\250\377\241\311\376\007$\373\037~\354\255\245\2069\021\202&\353\1770\332\377"
+	.string	"\264_\200\273\375\002\274\355\027`l\277"
+	.string	"Kv["
+	.string	" \373\005X\332\377>\262\241iHb\3546\364A\037R\304|\250\266\021\2547\2371Y\027\211F\207TS\243 Y\337\303\236\332CT\351&\262\203\b!\262\201l\371(i+\362\250\222\263\321\352{0\263\357\341\312\276\007\266\375\357\037\337<|\244\274\354\262\376\210\246\261i\2162\250\016\365\355\311t\363\330;6\324~\332=\266\324\216\332>T\351\346\261\235\262\2162\251ofP\021<6\016\021r\020I\221\311[\177\342`"
+	.string	"\021\365=\b\331\367pc\277\0034\373\035\204\331\357\240\312~\007a\373\035\034\331\377\276\341\341\314\334\017V\326\377^ZZZ\352\311\372*\227\027\030C\373\310\275C3\305\313\203\332\355AGl\301\001\335\361\036\3323\\\276-\264\2216\215\r\264}v\321\266\261\215\334=\267o\023\355\030[\306\356\331I[i\303\330A\273\206\233f\377\250\322}\344\236\271\253\347\242\321\321/4\246\252\225.Dvb\202\246oNS9\246\265\207\226\246\265G\\\016\350*E&\356L]\273\306\247Z\241\353\203\352\036c\364\346\214\240\373\3105\343\346\255Q\350O\206\024\235j\205\213\264H\2652m\327\322dy\202\206\021\232\356#\027N\307\264L\035t\037\271`\246D)i\313\373\240\327\210X\211\205\240\363\233\272\2415\200\232\241}\007?\266\233\347\"\351+\272\313\372\035@\355wP\264O\200\276}\002\220\331'\300\226}\002\264\355\023"
+	.string	"l\237"
+	.string	"<\366\t\020\264\317A\231}\016\332\3669\200\262\317\001\330>\007J\3669\200\356s"
+	.string	"d\237\003\247}\016\212\3667(\263\277\001\226\375\r\236\354oP\265\277\301\217\375\rr\354o0\003\313\225b\0174FOn\256\025U\352^q\333\330\256~\314(\345\271W\334*I\306\230q\267\272$\031\322\352\017`o\177"
+	.string	"w\373\003\300\262\177w-m\310\343\251\214\306\230\373d\215J\331fRDS5\227\212\213\346Nq\317T\251\233\346JIs\241\320p\323\334\2626o\215Jy!nh\232\346F\021\232\246\271f\371n\375:\332O~fL?\b\347\316\030y\021\352\017@l\177"
+	.string	"K\366\007\200d\177"
+	.string	"?\366\007\340\264\311:\b\255\314\221\305Y\177"
+	.string	"3\366\005`f\377\256\330]'ii\330\316\232\270RU\352:q\303\212\\0\365-\210\t\275\275\251\023v\311eBd\3438\n\r4\216\343\016\037>"
+	.ascii	"\357\206\344h\365\005\020\267]&a5\336\274\340\310\372\013\bT"
+	.ascii	"\222\247\254/\200'\373\352\332"
+	.string	"Q\235\033u\273T\251\353\345.q\275\334\"Z\356\320\3263aW\246\255\276"
+	.ascii	"\256\366\357r\271[_\262\330\262v\267\256\276u\200\2025\251\214"
+	.ascii	"I\222\254\335,\021"
+	.string	"w\265\370\316\320\020\313\272\350b\271I\332\336\204d\375\021QY\320\036TV.\022\367\312\255r\225\270GT\251\233\304\205>_\311X\334$.\324\3264\216\243<\264\222\270RX\3238\216\272I\\\037.\325\372u\344\2008#\3238\2165\233^\274E\324\027\200\217\235\2542\303$\353\013\340\306\026\341\022q\205\f)\342\016q\247T\251K\304\r\002$?\005\201\272D\334\037\371IJ\b\260\310\323\023\227\255/\200\032\373\002\200\261/\200\236}\r\322\354kpf_\2030\373\032\274\355k@e_\003\263}\r\234\354\337}\nr\032j:\332\341\342\250\243\021\247#\353\217\250\341\332\020\202\312pg\304\r\345po\270L\256\016U\352\342p\227\312\214\334\244\237\031.\016\227\206[d\201P\034G\025i\227\206\246\320\362\3265%8(P_\203\0370\\%)+\250\246\254\257\001\323\276\006FG.\322.\"uk\222\3655"
+	.string	":B3\344\022\341X\215\201e\375\f\300\270Co\256\020\273\245\212\223\264\254\237\301\331\016\312`l\377n\f\027\206\013\343.P\333G\245\007\212\217\254?\242\257\335\263\002\325fg\332\265,}-\2306O}\013\242\313ti\373Z=,S\267\307\365q\343\226\317\375Q\245m_\233\246\355k\321\344\273 \215)e\334\362\330\263.M_\204\372\031d\355g d?\203\247\375\f\222\3663\200\261\315\264F\344\364\322\262~"
+	.string	"\352vQ;F}\013\242\371\314\246eZ2\252\264\305k\303\264xD6\216}\240@\203O=\220\204Z}\227WE\312\223\254\037\20041\250\321X;m\355Z:U\332\326\265b\332:\027\310\0304X\3628|`\313L\317\330m\375"
+	.string	"\350\330\017"
+	.string	"\214}\f\322\354\277\375\322\312\345 EU\216Z\271l\245\325\262F\245<\200I\327\264LL\004\024/2\262\270v\256\335\322vi\271\264^Ti+\327\302e\325\212\\\373dl\252Zi\345\332\261\022\220\230Qb\327\352pH\021\3651@\333o*\334\317\326R\326\307\200\311\276j'e\013Z\245Mk\331\210=\306\030H\272\004\2727EN\013z6\242\255\322R\301\232Vi\243\254\201M-\345ai\333\332,\355\225\326\255\265\242J\333*-\332[3\265\3133\225\25633\210-\333Z\007\342X\214\thh)\353VM/]\361a$\353c\260\265\217\201\325>\006R\373\030,\355c"
+	.string	"c\377\2021\373\027l\331\277\340l\023\325\f\355/\330\332\277\200j\377\002\251\375\013\230\366/\020\332\177+\326:\301!\204f$\353&z\254\t\350,\353[`f_\0040\034\323\034LP/&\355W\033m\245m\230*m\301\332.\225\253\t\332\202\265K\324\267\020\2200\231\303\"\224\202\201\321$\324\267\300\311\276\005I\366-\210\332\267`h\377\355V\253\025\026f\313I\326YQ\240a[\032%\246\254oA\f%m\222\366J\225\266X-\222#m\025\0254\216\303>\242\305j\255\332*\365\215I\001jY\3238\016k\261Z\250\n\006\004\362\343e5|\303\261\245c\353\003"
+	.string	"\313>"
+	.string	"\330\242B#\243)\250\254\017\200\263}"
+	.string	"\220\355\277\245j\215X\0319\315\310\272\210\330\027\031FFY\037"
+	.string	"\320\335N\265:Z'\251,!\355\220\226\210*m\247\332\247\2516\207V;\325B\265A\326(t\323\370\331\232\356\272&\253\031[\003Y\002\263[\312\372"
+	.string	"\340\261\377\267>\332\036\252\264\375\321F\251\3218\216J\025i\177\264<D\210\326\225\301\212\343(\207\017\037X&X5\372Z}"
+	.string	"\340\330\007\300\214}"
+	.ascii	"\304\373\025\350\355W\360\3266\375\240r0\361\311\372\025\260"
+	.ascii	"\265;*\230\262_\301\327\376[\034-\223\027]\323\214\226\251=\""
+	.ascii	"\032\202\212\311z\355\241e\bt\355\001'\204u\273b$\217A\033\233"
+	.ascii	"\3461k]\320,D\330&eU\240m\334\026\265H\255\f6M\013\243\005b\365"
+	.ascii	"X\276\366\247Ujc\264Dm\rv\257\365i\215X4\255\r\266\257Mj\205"
+	.ascii	"\332\033\355RK\243\rjg\264Cm\217*m\217X3g\363\3303\327p\377\332"
+	.ascii	"\243\r\013\252\243?\333\344I\333\0305/\325\312\\S\\\020\250\234"
+	.ascii	"\0234\216\243oSk\217-Ol\023(l\323\24041\266I\0243)P\240c\250"
+	.ascii	"\220\3451U\264\246\355\021\353\205-\263F\241+\374\350\230\262"
+	.ascii	"M\332#\326\tK\266~\035m\263\037+\323/X\212\234\251uO\330&fQ\246"
+	.ascii	"q\034e\333\202\306qt\355\321\036\261V\250\306\264G\354\224\262"
+	.ascii	"i\034Gu\352\230L)@\3532\253\375\263`\316\226\371Y.l\027\026/"
+	.ascii	"K\215\371\231\2225\231\237\226\027*YY\277\202\"\373\"\204)\202"
+	.ascii	"\332\261c\330\251*e\357X\272:\243;V\214\b*UlXq\034\235\363\241"
+	.ascii	"\345n\353W\220\264_\001\215\375\n\204\366+\220\261\331/\"\316"
+	.ascii	"\202\t\002)\221\031\311\372\247fh_\301\317V\247\352\206\026\003"
+	.ascii	"5C\373\016y\373\035\300\354wp\333\3570\266\337\341j\277\303\323"
+	.ascii	"~\207\032\373\035\200\3669L\3679d\331\357\242nh\317!\312>\207"
+	.ascii	"\256}\016C\3669 \355S\240\267O\201\334>\005g\373\024t\355S@d"
+	.ascii	"\237\202\246}\n\206\366'@\263?\001\334\376\004k\373\023<\331"
+	.ascii	"\237@\311\376\004Q\354X0KY\\Q\326\237\300\210\025\233 \336\217"
+	.ascii	"\262R6\214H\r1sl\030\313$\t\232$DY\203\255ee\256\236\262\376"
+	.ascii	"\2060\373\352^\325\222\251\b\326\213\275:\201\213,\312r\261K"
+	.ascii	"\330.v\213\375b\265X,6K\225\262^\254\022\326\213\245b\241\304"
+	.ascii	"5\216}\274\214\210A\213\214\331\035\351B\302\005M\242\005e\275"
+	.ascii	"X+.UtNn\227\26411\r\372\033\260\3667\364\330\337\260c\177\003"
+	.ascii	"\322\376\006\241\375\r=\373\032\362X\350\325\267\0168\251p4\311"
+	.ascii	"\372\032\356\3665t\331\327pe\377,\0216\210\026\234VU\326\027"
+	.ascii	"\301G\024h\0176(\033\204\375Q\002\334\334\021\326\020v\212\025"
+	.ascii	"\242J\331 ,\220\340U\216\252\236\255\257\341\310\276\006\035"
+	.ascii	"\373\032\202\3663\224\331?+\305F\2554\276\3420\026\212}by\250"
+	.ascii	"R6\212uj\242\312b\243\330\035@|\272\316\362>\354,2W\276\266~"
+	.ascii	"\206\350~\006\253\375\f@\3663\354\330?\233\203e\"\203\2161\313"
+	.ascii	"\272\210U\"\372\030\343\330H\224)\016\366\206*e\231X&vi\005\242"
+	.ascii	"\276\005\321ZcdyRm\255~\006\246}u\355\b\n\224\255\301\332`\223"
+	.ascii	"T)\253\364lg\244\262\231A\225X$\225\r(\004\354\212\357\203\263"
+	.ascii	"\313\007\232\255o\243\267oCf\337f\272o\343e\377,Q\226\254(\250"
+	.ascii	"\254?\202\245\301\312\360\2215eg\260A\254\020;\244JY\032:M\031"
+	.ascii	"\255\307\265\306\322`c\250uR\255i\034GY\032\032\r\013#\203\265"
+	.ascii	"*%myq\034\375\355\355\265i\001\365m\304\366m\264X\240!^d\264"
+	.ascii	"e}\033 \373\252\224\375a}r\322\202\304\330\236\263>u\305\"8,"
+	.ascii	"JY\353=6\376\377s\251\234\266\330\270\257m\214,\253\205\332\353"
+	.ascii	"RF\363\3514\232\212\324-+\353\333\330\3306B\372\314\336R\302"
+	.ascii	"z\313\3725et\2366\0234\022=\203qm&\350\005\tkI\326\257\231\333"
+	.ascii	"\277\306#"
+	.ascii	"\023\205\312JcwM\346\327wz\214\312\246\2520\350\210\364\262\316"
+	.ascii	"P\352\206v\0035C\253u\210\270\266#\"eI\311\246u\007\240R\344"
+	.ascii	"G\326\272\356_{h\272G\311\255\\\216\262\037Y\347X\335\320j/\021"
+	.ascii	"\327b0\200\2226%\f\230\271\032}dY\353/\372\314T\350.\353\327"
+	.ascii	"\250\355\2178{\224\365\353h\202\030rA\246\232\213\246\242\265"
+	.ascii	"T}@\345njiN\313\3518\275E{\321]T\251\346\362\265\007\027\r\267"
+	.ascii	"j\221\020\343\350\027CJD\233E\251\342\242\247\3040\276\f\220"
+	.ascii	"\2264\265\224\247Z\341\242\245\250s\033\244EM-\345\305qT\315"
+	.ascii	"rg\343\216\250_CE\277\245\325\021\231\313\3725a\373\277\276\242"
+	.ascii	"\261\250R\235\345hz\255\bF\016\235E\263i\267(\017T\252\246\226"
+	.ascii	"\200zmV\246\264\372\327n\332J\024/\245\264\254u[p\350\b\025\244"
+	.ascii	"\254_sCW\251\251\261\265\332\023\246=\032:\355\255\310\372\220"
+	.ascii	"\362\310\313\37253\366kb\354\033\371\366\215c\366\215\\\366\215"
+	.ascii	"U\366\215S\366\305\240\250s[jRbeO\244\370\004\201\2215\231pK"
+	.ascii	"\0162S\262\2761l\177\r\372*\002\335\333R\337\234\020\231\202"
+	.ascii	"j\255)\"K\3247\251\247\351\230n\242\235h1\315D\203i\251*\325"
+	.ascii	"a\272\353\332KG\257\256\371\320B\326(\324u\362#d\032\307\261"
+	.ascii	"\016\323\\A\240q\034\375\025I}~\214\372\306\350&A\335\320\272"
+	.ascii	"j\206\366F$\373F\037\373F\034\373\306\032\333C\026\326\212\255"
+	.ascii	"\230,\353+`\225\270\030JY\337\030c_\345\032\3226\255\322Er\331"
+	.ascii	"\372u\264\2350\211B\204\r\272\006\351*=\245\262IU\201\352#Z\211"
+	.ascii	"F\242\255t\022U\252\253\264\221U\312\207\026bE\367\370E\350*"
+	.ascii	"M\245\205|\260\365\325g\225\027\307q\027\022\031-D\375\342\332"
+	.ascii	"~\221l\277\250\265_T\262_\254\332/Nm\375C\003Q\245\034t\020\270"
+	.ascii	"\237\242\035Y\277\330c\227 V9\264\357S9\264/>\355\263\251\033"
+	.ascii	"\332_K]\363\020C\022\205(k\315C7\351'bO4\356i\243\330\3519\345"
+	.ascii	"E\251R\315CC]\345\020\224n\201\371\241\365\211g\366\257\235\256"
+	.ascii	"\237~\255C\357 \276)Q2\227\265jE\304\265\023\320l\272e\224\365"
+	.ascii	"\211d\266\032\244nhk\324\f\355U\251\316\241FSP\242\003L\326\372"
+	.ascii	"\006\231(V\224\262\276\372E\337\3205\036E}\023S\241J\2400\351"
+	.ascii	"%U\252oh\033\3277\264R^#\002E\343\036W\310W\031\267\2746H(\t"
+	.ascii	"U\253O\224\262O\034\333'&\331\277N\322Ei\222\354\220d}\246\213"
+	.ascii	"2\025u\256-\322s\207\226\227\321tQf\313e\352\233\230\t.,\031"
+	.ascii	"M\027\345\264\274\246\276\211i\255,S\215\244\215\364\221&R\245"
+	.ascii	"\272H\317\270\246\241\207F\350\242lE\013\365\270O\246\334\241"
+	.ascii	"\345\305q\\\302\230\275*@\r\214\325\r\255\n\245fhO\034\332:\310"
+	.ascii	"\003@e\312d}\342\317\316nVV452\270\352\241\323\313[\371V!\353"
+	.ascii	"\023\022b"
+	.string	"\0349@\312i\232\266\2661\331\021\245F\3257\246\270\307\316C\022$:\275\274<\206o\345\241\316\255Q\250\333DjH\316\222\3372\335\372u\364+bB\225\263\254|\271.\337%}\220D\313*\365\257=V\276\365\307\nd\215JYA*\3104\216c\276\265lE\363\200d\n\235^\236\226\241}t\317\232F\007rF\304\2626\276\005\203\364\025\021\322\241\316\315H\242\342\224\3653\240\304\350ft3^)sC\253L\336\276\201$K\350\n\320(\214Z\337^\326\317\200\2221\312\215S\214Q\214mk\334\025\221F]\224\017\264\033\333n\254\002\202\b\027\303\374\321\244I\326F\266\253B\3064\t\312\372\306\265\337\2210e|Y\033\325\016\320\244\307c/\353\033\323\202\300\025I\222uV\237\326\032\251\020\235%i\312\332x\366\272a\331W\220\035F)\031 \202\002\305\370\244\001<\364\234bH%a\332\033\0333>\341"
+	.string	"\265\202\251\242s\302\212\002FE\n\231*5>a\267\316\2427\342\23001:\301rC\tW\036\332\023\241&7:\311tO\270dem\f3J\333 \2554M\214R\265\356\006\f4O0\300e\3642z\031\277\250\344\2434&\036\306\350\215_`\356\226\340a`\311\022\237\271#\037\240,M\262>\006jlm\255wZ\320\0352\202\362\262\376\005\322de\225\271A\265#\257\2105'\346\210J\222$\306+\025\f\2031f\224\330\240\\\331\3233*\271\361*J\260J\225(E\270\220 Y\357\216\364Ya\221\241\342EK\326\277"
+	.string	"\220m4b4bl\300\227\236\023\260/\314\\\024\364\306#]\222\2404Q\305\035]\331\243z\021\016\317\b\232\365/p\303H\304H\204J\025\233\226\246a\363\311\372\027\0202\0161\016I@\006\232\312\361\225&H\020\340\227\n\026\033\215\370\272C\303\212c&\0176>>\240Y\337\002rF\037F\037\306\037^\240N3b\244\254\177\300%y\211\263\276\005\252HI\255wKz\364\234\362\316\200\226d1\203\2022\362\270#\352\262\302\nzy\003Rg\344q\004\211\324P\326\267"
+	.string	"\226Q\207Q\207\321i\003\033Q\027k\206\357\310\212\261\351F'.\350\230\\\326\306\035Os\255`\221z\262"
+	.string	"\324\215\033F\0349\\.\245/]yn\224&(\221\221\351F\034yHZ\2247-0Q4\340\262\276\005\212\220\220\2146\324\251\321\025\031\254\314T\367\245\244t\243\21521\366\310\2626\3260&eI\363\303\307\230\324\005\345\242\226DUD\205\227\365+\300g42\032\255wIKTwyP^4\242\262~\005\350\2144\2144\214D\320\"85Uj\356\310\211q\350F\242\341\224X\336\224\n\300\031\2152\214\034\370\226\250\356\362T+_\360\212\214A7\n\3518\257\271.\025X3\306\306\330\b\243\b\320\211H\311\236\026\003f\207g\354\271\021\206\021\b\332#OF\326\277\021\310\370\343VFC\256\211\017\276*uY\033}\366\022"
+	.string	"\210\t\202R\201-\274\027\315\340\025\371\32695\0323A\365\330\225\200&\370E\343K\213\336\213|/\246\001A\204\213\331XJ\346|\262.\356\241)\236\271\030+1CvY\027\363\236&d\342\222\007\244\030d\305\"\025\367\223u\261\314\357\314\311GT\326w\311\346t@\263~\005\254\352\352\212c\252\212f7\310h\334\2758\246\325\302q\005G\326E\273\247=#IY\027\247\027\243\205zf\320\250"
+	.string	"\0201b\264\3509\005\237(-!\222\365+P\004\006LkE\304g\205\225\206\006\353H\326\247"
+	.ascii	"_\321K\321\313\002\354\364\234\260\204\240S\232\262>\005\352"
+	.ascii	"\212Z\212Z\212\\\306T\261a\271Vx\314\b\233{\221\013\335\257\b"
+	.ascii	"^\336\0209,9\222\272\310ma\273\330(2\002W\214kA\314\222\265\254"
+	.ascii	"O\001\270\r\307\232Y\333\212\260\215\311\372\024\230Rt+\272\025"
+	.ascii	"\263\250\\EpjX\254\022%UX\212X^\314\222\367\246Q+Y\027\257\004"
+	.ascii	"\331\234$\025\tC\001\351.R)R)\266Q\361\262\312\323z{R\244\312"
+	.ascii	"\213m\327zRxY\027\331\202T\301\032g\254\270\262.\256=\315\311"
+	.ascii	"\231\030UjdDqB\212j\3054*m9\340\212hkP\340\220\262>\005\224\354"
+	.ascii	"S\240G\224(\305)\034v\274D.\310t\353]\331\351\220\362\342\224"
+	.ascii	"\213a\207\274\314\301)=y"
+	.ascii	"R\204"
+	.string	"\002<+\242:\033\022\tJ\023*\226\275\b\205\315\b\234\321P\354G'\303\315L\326\247\200\214\242\223\242\223\342\030V\021\234Z\336\357\312\226\262%E\261\027\307\326..\030\231.=\023\350+~\025\277\212R!?^C!\321\260%\305\260\027\245i;\276\240\024\311\372xE&8\240V4\230\200I\213\310X\201e3\341\221\027\232V\326\237\300\222%E\257\246 TijGvr\233\343\322\365\242\027\020L\320)\316H\220\377?\n\372\246dd\375\t\264ee\025\267\\)J_\272V-\241\271'\255\027\267\360\244o]\0238+^\025\257\264\2313A0jBY\262\376\004\260\222$\321f6\360\322\242\347\344\025e\016*\353O`\211\212\252\210\304H\233\244\364\245k\035\262\201f\205\244XE\207%K[\326\305#;\356\214\017+Y\177\002=E\250\n0SS\305\"8Z7\"\2760\266\275;\"/\026a\333"
+	.string	"\215\0326Td\301\361\342\023\216\242\220\242\230\032\307L\361\017P\354\364TA\226\2459h^\034\304\344a\b%G\026\024\324\213B^\354\001\202\b\305 EiQe\262.\372(\376P\245\267R\004\362h\221x&c\354k_\275\225\266\004\352\255\264E\251\023\231\256\234M\263~\221G1\352\377\001\221\370\b\273\312\372*\262\366\017\260\301\226\220\220\300\376\377\212Whh\314e]lz\321\351\377\005\273\322b\304e}\025GvQ\307\213;\376\237\372\243\350\r.\353\253 \262\377b\216\377'\264#\2624$\353\253"
+	.string	"\262\257\002\252\306k\024op\200\352\271\363\200\2274\265Ddb\344\007^\361Fq)\303\214\"\245\245\242\r<.E\254\350/C\265\245\032_Y\027\225T\32402*\"q\200\352\261\3630\205\211\031\245<-$\013\321\214\342\321\213HT\336\302d\211\222\304,\213,\353\247\330+\022\025\211\210W6\334\326\232\224\254\237\202K\221F\221\006\361\312\221\222\024\332[\217\273%Y?EZQFQFQH\005\213\215\\'L\274\254\204O\362\222\364\024\203^\024\n\022\031Cc\207$\353\343\265NXb\344p4\371\371)\302\340"
+	.ascii	"\325\203\007\314A\244d\017\207\031\320\227\254\377\"\320\213"
+	.ascii	"0\302\266\024\351\311\372x{\353\377\257\006F\017U\326O\001-\366"
+	.ascii	"\024{\264\231\257@\261\223\030\241\230\336\225P\326O\321\324"
+	.ascii	"\327\247\315\270\021uY\205\311\335\231\311\372)\202\320\240!"
+	.ascii	"\246Q\215\321\237/V\246\352\217.#E\366NL\363\264 \024\017\031"
+	.ascii	"yxf\314\020\317p\3301\227U\224i\321\r\b\325Q\336\211g\352\206"
+	.ascii	"\320\036pf^\306\214!\342q\200\352\261\343`G\020iO\307\0232'\342"
+	.ascii	"\325\360B\004\004\213\235\235\004j\230Q\302\372\202\313\232f"
+	.ascii	"}\024P\352\352\326;\350\022\022)X?m{WY\037E\017/^\210b\226\212"
+	.ascii	"\340\324\362V2V\272\2049Q\f\331\223\224\251\254\211`\202lP\274"
+	.ascii	"@\321\312\232\370\345ux|PyY\037\357i6\246l]\311\372(\226\346"
+	.ascii	"\346\210\\8@\365\330\025@i\211\352.o5\"\006\312\031\227\\v\365"
+	.ascii	"F%f\313\026m\206i\272\372\\I#\244\212\026-D8&E\323&2\034S\340"
+	.ascii	"\246\276b\360\310\372\022p\222%\013\361\212j\214\376\304\355"
+	.ascii	"\370yAq\375\330rs#^\371@\215e4\221\3121\215c&\017#\270\272\241"
+	.ascii	"\345J~\202\321\025$\213JM\215\330\246\202\305F'\366rTe\252\252"
+	.ascii	"\2411b\033\261\n\0254W\226\326\210lA+gV}Y_\002Pk\0228\332D2\""
+	.ascii	"\031\021\215I\024'\253<\355s\264\205\007\225\023\321r\232\217"
+	.ascii	"\251\032Y\023\243\020\317\366\231R\322\025)\304)+\221\244:\031"
+	.ascii	"}R\314\326\031G\246\3640\2032$sB\212{B,\323VhQe\323'yil\f\032"
+	.ascii	"\261,N\234\020\3058@\365\330m\260\244\206\031\245<)$F6\262\026"
+	.ascii	"\033JE\311\310\232\262\365-\242T\005\213\215R@\343\216\260\212"
+	.ascii	"wGV\226\204\235(m\237\344\005\271\22251Jd\322#\214NF\326D\260"
+	.ascii	"/TB\220d\375\023\321\375\205G\364\372\377\013JE\177\336\274\272"
+	.ascii	"\250\270\300meM\\\322\207\247$-\353\2378\262\211\\9j\311\023"
+	.ascii	"\034TV\326p\210W\260\307\223\2602Y\377D\r\"\321\212x\325\245"
+	.ascii	"\336Ee\t)9\361\312\235\302\342#)kb\222 \033\f${P'dl\"\025\221"
+	.ascii	"\212X\325\341\250\bN-\326\261\327\345\310\211U?\276<8\275\254"
+	.ascii	"\211\320 \033\214\035C\302d}\274\\\206\305hOO\257H\221\\\266"
+	.ascii	"\205\3428*\007\020\315\006\337]M\221\267\253\254\037\201\261"
+	.ascii	"\375\023\247\210S\352\234\356\211\306F\032\274\244\252\330DH"
+	.ascii	"9\n\312\372\021H\262\177b\020b\020\242\020\r\024\215\221`@\352"
+	.ascii	"\263\312\213\217\330< \216\245\2319\313\232($\002@t\350 \376"
+	.ascii	"8\341\316\306\035\024k,\tQL\374A\364!\203HII\326=\234\250U\241"
+	.ascii	"\311\372\021\330\261\257\356\325\021\241\210;\350\210P\304\246"
+	.ascii	"\022\332l\350%\345\021\245\210QD\036\252\224\bEt\232\026y\221"
+	.ascii	"\331\372/\364\355\277@f\377\205\273\375\027\246\373/x\331?1\211"
+	.ascii	"\230D\304a\214q\364+\222\323\232\306Gl\036\374\356\224\226\362"
+	.ascii	"\2108\210LGtqpY\337\310@\366\300\202d\375\027\324\366G\020m\020"
+	.ascii	"\205\210Jk\024\272\202T\232)qI\225\022m\020kp\020\3425\365\350"
+	.ascii	"\320D\245\267\246&\270\237\254\377\002\223\375\027\260\366O\224"
+	.ascii	"A\224A<Rc\350\003\344\266\246\361\021\223\007\3043fA\320\254"
+	.ascii	"\211I\334\326\260d\375\027\242\366\177\"\221*%\026\021\203\210"
+	.ascii	"ED!\342\220\005?q\354\323\004L\262q\007\025\202\021\312\"\323"
+	.ascii	"\372'\3228q\350"
+	.string	"\255\003q\ft\342L\025W\326\304\031\"N\244\021\204F+k\240\232\241\375\013>\373.\204\331w\001\013\021\006\021\306z\207\007B\n\223\007\375\363CHI\326w\001\215\330C\354!\376|H\252\300\331\036\223\254\177\242\317\211?\247+\356\351m\361\311\372x\3033Yi\270\304\310\372.\200\355\177\3107\3543\232\272\220\265\357\202\021<\274\341\036Z\003\2342\260\032j\202\346\303=(\334\220\223\254\207z\3033TG\240\024e=,3<#%\r\226!\3033\303\274,+dvh\361\200\024\230+f\200m;iK\034\224c\314\230\365.\307q\034C\335*MP\2461\023\223\007 \223(\230\243\254\357\002\2140\0173\264S?\210\177\270\364H\300\321\016\017n\017\227.61\037\332\r\247\353\227\250\033=\323a]\021W\232\264i\320\213\213H\224!\035\260\013\220&Q6 p\367\345K\220\016\257io\n\201,]\272"
+	.string	"\325\332\243\030H\272%\001wE\\\260\362\246\f\345T\351Pn8gs\024\307@\254B$m\351\300\223S\034\214\254\017\001i\\\234\372\326\306/x4\345M\343\243\250\007\207\200\0227\267\241\2260\006(\275}\250%\n\321T\326\303,\352[\027\230&\266\254\207X\362\026\"L\306d=\274\002\001\035\373\037\262\r\331\206m'\210A\371\324\340@\215X\367\365E\314\260JY\337\230\236\254\017\201\031\373\020\350\331\377Pm\250\266>\301\213\303\222\365\037p\207\206\246\262i\037\260\370h\307F\327\035V\r\"_\304d\375\007L9;S\3372(\263\332\220\362%\226\365\037 \225r)B&5\216\343\230)\356\271K"
+	.string	"\327\003\250\312\312\206f#\246C\263\276\246\2527\246\260\260!Y\034\030\bhc\037\222\251s\353[\221\2432Y\017\245C\261\377?\325\213\022 J\262\376\207bC'Q\274\354\340~X\304b,.\0370Y7\371o\355\217\221\232\034Q{"
+	.string	"PW\327\020l\004\266\257\017\301~bX\321$Y\017\243\352\033\0203\276+Y\017\275\0340\307\3055\034\222A\034\3071b\027d\326\364\246\016\030\033*\031*\031j\201\205X\032f}\250\245\001\232\247\241\254\207X\303)2\244xe=\274\"\202\004\311\320\352\314\307\3204\216wx \0243\006\264\026F\bu\024\003\r\271(9\340i\377C#F\206G|\030M\261\306|\254~Y\334\275'\246x\b\035R\t\325\322\224\206\262\330\212\262\276\003\224\366?$2$\022L\243\002\346(\242:\333L\246^M\262~\013}C C \303! \224\206B>\034\302\0329\003\345-\353a\220 \233\022/Mr\264\260e\377C\251\253\322\241\324\320G\001\270\212\246\234\362\246rWY\262\036\366"
+	.ascii	"*\335\341E\263~\013g\373-l\355\177\3704|\032\3628\201\t\252\347"
+	.ascii	"\356\203%L\252\330\270\202\340\330\262\036Be\330\333\272\312"
+	.ascii	"\372-P\355\267\340\264\377\241\216\241\216aS\221v\007\021\237"
+	.ascii	"\325\330\330\215+Y\017w\2409\023:\223\365[@\332g\241o\377\303"
+	.ascii	"\033\322\341\215!\016\2638\255)\322\333\020\350\220)\217\207"
+	.ascii	"\023Z\326g!\314>\013h5j\fmh\037\2608\251\204\252\271#\254\251"
+	.ascii	"\245\252\237\254\207J\3002keTY\237\005&\373,\024\331\377\320"
+	.ascii	"hh4D:!\bT"
+	.string	"\\\203\003,\242.\2538\032]=\262\036\036\0351\333C\312\372,\354\330g!\306\376\2074\256J\2074\206DTn\031\"%{yI\204\344=e=\034R\227\260D\351e\375\025\314\354\257\020\267\377a\3200h(t\002\023T\254\344a\013LI[\336\221\262\242\034C!`\214\016\324\311\200\316e\375\025\272\366?\004\032\002\rc\234\020\004\312G\212\203*\")2Q^\202\324\310z\b#\257I\235D\311\372+\024\331_\341\306\376\207\3610\036\372\234\300\004\345\343C\302\025\0223J\302\251\332\216\262a\217\225\271\036C\262\376\nB\373*\224\331\277pO\270'\344;A\f*\256A\002\222\236;\264<\2670\361\226\254\205i>0\306\325\227\365Ux\333WA\252\247\327\327~\351:\373Q\222\227\307\007\244\322\225#J\252L\2314\320\030h\323\246\254\257B\r2d\334-\335c\214\002\305\355A\335\226|\351\310\372*"
+	.string	"\335\335\251o?qh\240q\314\346\201\246\313\002D*\353\247\240\267\177\341T8U\337\334\351\320\024\032\026T\2323c\352\350\350T\266\023\202\3548*\305\313\324\275\002\243\344*\353\247`e\377\3020\3020\034H1\272\"\223G\027\346\244K\326OA\254K\027\341\027\037-\327m\357\320\203b&k\241\0277\212\227\270%Y?\005%\373)P\355_8'\234S\337\366\017P\354\024\304U\242\364\245\213\215*c&+\353\247"
+	.ascii	"\004\007'\334\262\205\200\342\037DZ\247\241)4\260-diY\013\343"
+	.ascii	"\364\215\330D\336\276\t.X\260\b\337\210\216\224q\273 \306\222"
+	.ascii	"4Y\013\263\244\r)s$\353\233X\3337\001\326\326&t#!+\316\214\022"
+	.ascii	"\361\n\311K\217\254\205V\362\360+,\007X\3267a\265o\202\307\376"
+	.ascii	"\205h\252T\210&d;\201\t*\256\341!Kj\016\313\217N\210\253m\355"
+	.ascii	"B\266_\230&T\373\361MU\321\365\310\2725\023q\341\332\356\353"
+	.ascii	"\243\"$k\266M\315\320\336\004P\224(\302\263\023\304\240b%\017"
+	.ascii	"Woue\272\320\276\224M\271\360\354\267\367\001>-\265\254\205R"
+	.ascii	"D\\8\345\211\2254TYgP3\264/\221e_\315R\205bR\241\230\020\212"
+	.ascii	"\212\024\307>Sn\236\222\007_|S\322\214\311\372\027>\271\260\354"
+	.ascii	"\317c\204c\2773\241\"\241\254\205d\".|\362\201\036PB\262\016"
+	.ascii	"\241fh\327\022jM\232\264L%\034\321s\302\212c6\0176\f/\243,Y\277"
+	.ascii	"DXX\030\033v\002\023X\234T\234\362\241sj\271\326\230\374d\375"
+	.ascii	"\022C\242Q!\230\002\266\252\346\216\274H\021;\223\265\360\353"
+	.ascii	"*\224\212\226\254_B\307~\t\031\373\027r]\225\n\271\204]D `]g"
+	.ascii	":r\300\240\023\026\307\004=\351\222\365Q(\263\217\302\333\376"
+	.ascii	"\205XR!\226PK\373\200\305=\305'QW|ynen\030e-\314\002Fy\302\204"
+	.ascii	"\224\365Q \333G\341\313\352\317W2\026U*\264\022*1\3068R\343\330"
+	.ascii	"L\352\305\236a\025\261\221\2650\311\266\332\223\213\263>\nT\373"
+	.ascii	"(<\355_X%\025Vi2'\004\201\212\2232@r\247\244-\257'F\032\035Y"
+	.ascii	"\037\005\246\375\013\241\252T\b\325u'\210A\305H$lQ1\243\324\005"
+	.ascii	"\311\214\250\254\217B\322\376\205DT\251\220\210\320\b\0274\216"
+	.ascii	"\231<\020\002\031\201y\t\215\374\331MX\004\350\023$\254-J\326"
+	.ascii	".\t2\373\027\nQ\245B!\302!!l\331\365Y\341MA\247d-\034\002\214"
+	.ascii	"\263\233\\\222[\326'\341\266\177\241\017\241\017!\220\023\304"
+	.ascii	"\240<\350)\343\246\362\305@\003\222\265\360\007\220\017\020\240"
+	.ascii	"\254OBm\237\004\217\253R!\017\241\324\tL`q\217\013\345\310\035"
+	.ascii	"Z\035\226\035T\326\302\250.'meY\237D\331>\t\261\375\013\237\204"
+	.ascii	"Oj\335\206\001\024C\t\t*)M"
+	.string	"\355X\301\234P\351\310\372$\210r\344\0206}\201H\022\356\270\260i\351J\231U\326B\035e\222\222\204Lra\002@S\272\220Ix\303\312\350\310Y\326\302%\"\024\030u_\266\320\206\260\206\372\306f!R\323!\345\350(?i \260\030I\003JRhY\013l\007\214\254\177\302\220\375\013\213\204EZ\353\336\336\2233Y\377\004\036B!\241\220pH\375 \376\211;3\341HH\343\302!\275g\343\212J\326\302\031\355\r\037S\263\023\222d\310\b\242\251\261\0245\016\242\"\2055\215c&\017\212U\234\354\312\262~\003\246\373\027\302\220\na\004\317\264\017X\2144\"f\362`\235\373A\343-\3537\340l\377B\037\251\320G\370\243\306P5\216\317\244\236\246U\326\230\342\204?\317b\035\210\201aJ_rd\375\006P\365\365\t\343\023\230\240\326\270'NVXq\274\303\203M\245\352\310S[\345\312\270\202\306F\326o"
+	.string	"S\2324>rhI\361\"\227\365\033\020\204\006M\212#7\017\210w?\342\267\254\317"
+	.string	"1\373\017\346\345\005\317\350\036c4\2262\203\306\361\016\0172\223!V|mU\007\216\222\234\204q\313\372\f\270\262\377`\031i\260L[\245{\300b\243 \023(NV-\226\024=\260\375\007\311\\\225\006\311\004\245h \260\270g'K\216\252)\232\017\231\254\317\200\"\373\017\336\335\251UN\b\002\345\023\225A\233\321\235\032\260\313k\rJ\326g"
+	.string	"\321\376\203SU\032\234\252u'\004\201\362\361\331"
+	.ascii	"\t\233\007y/\307\222\\\326g@\320\227/A:\"\032\324\303\037\024"
+	.ascii	"\363 \035\360\207\216\036\256`\230\337[\2312b\3010A0+[\221\225"
+	.ascii	") Z\216'hU\366\272t\021[\2538\221\242\00337\367\323\242{j\200"
+	.ascii	"\342\036f\3208v\363 \263\301\351Ee\375\005h\331\177p\313\226"
+	.ascii	"\237\226\375\023\004\345#U\200%#\272\034yq\354\346\001\213c\210"
+	.ascii	"\331\221\254\277\200-"
+	.string	",X\202p;(\340\323\362 \234:\303\210\223(Y\007\3370p6W&\353`\226 \333\364g\213\235\231Z\0305&Y\177\001Pnw\013\266\3558\216{\242\261Q\361\250\210\013\026\326\002\200\324\324\202mM6gG\036\376`\225\007\333N\227\327\004\313\031\333\377\237\n\271/Y\330\326\202\320\034c\322\230Y\372\321[\313\372\n\220S\351\242A)NcJA*\253\027> 'Y_\001b;8%\023\317\320\262\330e}\005P\355`\224\252-\005<\355?h\026,\273z+k\002\026$\013>\t\226\031}\242\342\337\021$E\323\262?\310$\030\246\276i1I\214\be}\005,\355\007\245\301&\017:q\022\034\2731\216\343\2378v\222#"
+	.string	"\023\023\223\007U\206\2174&b\017\216\021\271\322\246g\262>\036\320\350\377\357\2306$/\353'\300\314\376\257>\377m\354s\024\307q\022\033\215\217~\204\355\257^eU\325\303?TWU"
+	.ascii	"\377\365\277\2004;q\354\304\207\025\307\261Jf#\211\342\243#\203"
+	.ascii	"\370\377OA\034\307HA@q\217\032\024\026\205\024\024\026uT\023"
+	.ascii	"\344\026\205\024\003!a\001EA\251A@QGG@qOM\034\026u\024\024G!"
+	.ascii	"\031\343\260\370FP\230O\217\032\004\024#\305qTl\214\203|\220"
+	.ascii	"\342\260\350QMPX\324QPX\024RMP\230\017RP\f\025\033\203\242=\216"
+	.ascii	"\342hTO\r\2150\037\2448\f\n\251&\016\213B\nB\203\247\005\203"
+	.ascii	"4{Ruk@K\364T\036A@q\021\321\016\237#\343[P\024*\356\022\307\252"
+	.ascii	"X\214\370(~\213c\001\304\361\016\250\243.>7T)?oE?e>P\035\210"
+	.ascii	"~\244\240b\240\267\0365~\013\262\202\212c\253\237\234\230(\216"
+	.ascii	"\3438\204\236\350[,D}\353\351\261#\036\212\021\307\025\304\321"
+	.ascii	"8&\212\343\0365~\213\343\270'\216c\367hG4\216s\030\203\240DD"
+	.ascii	"q\314\304\201(\336\3213%F\034g\261/R\220\202\302\244\240DLi\022"
+	.ascii	"\006\215eD{\324\240!\250\030\032w\211:\332a=_\361P\034\307\352"
+	.ascii	"\230\rE\252q\227\2651;\331\177p\211*\r.\tF\201\3640a/\030\375"
+	.ascii	"\203]A/\240]\006\372`\302\301%k5\032\253\033Z\016\t\270\332\177"
+	.ascii	"pK\225\006\267\200K6Gq\354#,\001X\212\270`\345\305GG\036<\001"
+	.ascii	"D\202YDU\234\310e\375\004\344\300\n*\221\006\225\344&'\210A\371"
+	.ascii	"Di\300etE\246\215\341\345\344\224\365M\260\333VV\301#_\201\230"
+	.ascii	"<\254?\350v4e}\023\260\354?\210$xd\333\365\020c\346A!\027\022"
+	.ascii	"<\242\202\305F\352\030\022/\253\2748f\362\260\271\226\030i\203"
+	.ascii	"\252\322\340\221!<\236\346\262\016\026\tR\355\037YegTF\332"
+	.string	"\2453\270'F~wMID\274\262>^\220\310\377_\020H\021.2\202D\202SIy4\222\344\030G\214\200\004\207\264H\\\037\036h\276\204\005\201\304p7$+\370\343\253\003OxLa\244\244A\251 \017\022\256z\264\r\276!\262\254o\302\217(\036iTe\304\262\016\236!U\265e}\023\230\366\037l\222\006\233\202N'\004\201\362\251\312\300KK\237\325\360\r\207\222\226\240\323\313\360z\304\346\262\276\tIm\225\n:jP\311qU\032\314\021d:A\f*N2@Z\224\222\266_\021%B}Y\337\004\037\034L&\334\236\224e\035\274a\006n\212\222\254_\202\231\375\007m<\270t\241\331\025\351\217\254\325\251\210\007m\350\036e\214\252\362W\007\314h1J\312\372\017&]\225\006\223\202G'0A\305I\n\270Bb\362 \b\344\251\204\270\375\007\221\202G8\0027o\316\223\347DqG'\371\273\200\202"
+	.string	"\330p\340q!"
+	.ascii	"0S\231\301\315\313\304Q>\231<B\016F\0165A\230\251\\\237\003\342"
+	.ascii	"\231\003#u\230J\244\023~2\233\311\337\363\205\225L\245\321\371"
+	.ascii	"\336 "
+	.string	"_\024M\025\307g\316\223GC\nO\035%\374l:\223J\235\366\305NR\347\325i\215I\016.\234;O\027\\8k4\240x\237<\0316<\007D\322\371|[8yJ\300H\233\246\212\0227\310\346RC\221\331\302\215rg\030|\276\313\344\213\022o\212d\022IA\320\205\b\2408\221B\n7\310\327\tT\336\244\360\002\351\302\206\023/\214\\\362$\227\310\022\024\334\324\354\304p\204\337\345\222\204\023\371.K\024A\030\021\204\337\024\300\0237L\245\n\360\373\324yuZ$\2144!\\\301\205R\205\033&\211\027F\336(\227\310\026\034\236D\270\304\215r\307\370&\231\310\0267$\230*\020]4Q\250q\276 P\246\300\021:\341\023,xV<]\025`H\"w2\274:J\025Hx\371\232\200\341\211T\001\2778F\267C\t\370\305\321\340=\"5,W \237J\023\360\213\263\341\271\363\034\0208L\245\023~N"
+	.string	"\037_\020(\237\355r\311\303d6\231n\fMg\016\334d\272,\220\357R\277N\236\035\315|\227N\370\331>W\320\211aG\350\"\205\246\212fr\002\022\032\232J'\222\0027/\214\324Q\302\317\024\340\027\247\346\246\005\027M\024^\240\340\242\211\302\rS\311\202\370.W \227Jd\013\022\260\263y\342\331\302\006\035\236\027lt\232\314\327\304\013#Q\300\357\n\032p\230J\246\022\251\363\242x\276\360\013\024X\360\254x\332\214 \"H\302\004n\220/\n\026<+\236\300\347rIB'\206\023;M\370i|\016\b\370}\276(\202H\030ib\370\034\020!`x\"]x\235<0\362e\021|Kd\250q\001~q\202$\340\027'\370\036W\020_\030\t\247@\001~q\212\357\361\246\205\243\021f\362\270"
+	.string	"\2778\303\367x\323\002|\203|Q\030G\020AB\020\204\021\023`\301\263\002\002*ZH\021\002\206dsY\342u6K\024o\236\310\n\2747M\035\247\022\231\341=\016\341\347\200h\241>\217-\2369\300\034\365\251>[\330\346\275i\352"
+	.ascii	"\341\347\200\330Q:\341\347\315\273\f\321T:\233\313f\222}\036"
+	.ascii	"\237\357\206\247\263\271l\226X\"\225\311w\3479\204\225\314\026"
+	.ascii	"~5[\004\b\026<(\300O'\317\n`\006\r\357"
+	.string	"\n;O\035\033\246\no\n\033\330\331<1|\006\211\025\030[ \231\373\346}\016\210\327\331L\036\223,8\334,\233,\340 u\334\r\360\233\342F\271DR\340\251\314\200\343$\221\003++p\301\323\202\247\020\250\241\311\202\331B\005\360\004p\rL\001\274\001\316\260\001\274\001\266\2017T\320d\276\200\225K$\317\007ln\224-\236EfN\362\330d\301T\266x\036S\234X\201\230SB\207\207yLqb\205\0370\303\253\323d\241\251BysLqb\005\033\270=:C$a$\374\004\302FX\003lc\301\006\317W\007\311\274Q\356\354\0235%:\300\031\340\r\360\361\351|\227<)l\200\221\033.\"a\244\211\244\263eS\3504\341\347\223\002\030\007\251\263\302\311$r}\016\b\347S\203\033d\023\002-\220\034&x\217;\317\022\314\026:<\007\304\315\262\311\002\274$\341\276:\025H\252\260\363\324!jp\201"
+	.ascii	"v\220.\230h\241\t\2270Ab\202\347M\013%\2367-\024)p\363\302\316"
+	.ascii	"\346\316\016\317\263\002\r\317\001\301*\237O\247f\252\200b\347"
+	.ascii	"\251\023D\001+W\200\235\315\234\247\361\325Q\252x\016\210\020"
+	.ascii	"/\2144q\263T\362\254\370\301<"
+	.ascii	"\021`6+\270q\"K\230H\001\200\027\313\235\027\305\013'RG\207'"
+	.ascii	"E\316\023\271d\201\204\221&0\200a\016\360~\227<7oN2E\212\235"
+	.ascii	"\247\016\006O*\235/\363\305\331\017a\204\003\214@\202\013\367"
+	.ascii	"$\230\360\201\t\037\264'\301\004\021\"L\030A\304\376\b\"\326"
+	.ascii	"\017@\260\340A\341\305r\347u\002\213O\340{|\342 \227*\2747M\027"
+	.ascii	"jp\224-\220\314\020)N\254\260\231*\274:\310\027l\230*\234p\321"
+	.ascii	"D\341\005\201\022\206'R\005\213$\320\006f\213p\212\fpQ\347\205"
+	.ascii	"\237/\236\304\342\013#Q\274-\224p\022Y\203\303\263\342\275\001"
+	.ascii	">\223J\370\251\204\221\360\363\b\303\023\t\027_\035\245\2127"
+	.ascii	"\211t\256@\202\031\001\347\033Csg\002\3709Hx\371\232xu\224p\320"
+	.ascii	"\005R\307\370<>a$\234\242f\211L\376^\035\245\212\344\353\"\205"
+	.ascii	"%\022n\3026\360s@\354<uB\354<u68\2257\277\347\021~aH\"O\354<"
+	.ascii	"u\202,xV\254\316\026>\n\235\360\211\267\205\362M\276(8\300\220"
+	.ascii	"D\256X.\221%\\8\201\0240\266h\337\343{\323t\001v6w\200\3571\002"
+	.ascii	"\260\263\2713|6\335\027F\242\270\341A\256\330/\b\224)^\020(S"
+	.ascii	"lx;\2057\310\227\205\245\022\251\302\371\262`\301\203\202\013"
+	.ascii	"X\b?q\220K\026\354\363Xb\347\251#t\276\313\033&2\307\205\017"
+	.ascii	"\037\341\375\234\300\253\243T\221\363\3449\001\273x\231\304\347"
+	.ascii	"1\305\316S'x\243\223\\\237.,\221-\200\360s@\260\340Y\241\203"
+	.ascii	"|"
+	.string	"\235\3603\004\263\251\243\323Lb\360<\262\340Y\361l\235\360\316z\303|W\030\370<\276p\302\314\024\340\243r\231\004\336\2740$\221;\355\273\363\002\326\260r\2314\302\3136\007\306a\276\020x\201t:I(\227\311\t^ \235N$\013\277\307\245\315r\005\022\006.W U@@\271LN\260\303\003C\263\271la\034\246\022\206\337g\210$\013\244\013L\245\013\312e\262\306\005R\207\251\324i[\370\310\304\331a\2318;\353s@\024\231\317\344Q\271\363\024\026\217I\020\224\306\341\273\334\321A>kX\354,\217\357S\331d\022\227o\013x\211<\262H\036\233N\344\212\340\215r'\370|\336(wj\236\003\242\351|\201\323t\276\300\021\002W(\227\310\0220\363\325y[4]h:_\340d\220d\276x\026Y\354,\367\273\363\002\2661\202 \007\006\020F\034\337'\017\361}\362\034\233pP\204\b\020\216 \310\321"
+	.string	"\302\021f\321|>\223JfS\307\211\314\341"
+	.string	"\202\234#S\251\263\341\003;Nc\211\244\323f\307\200|!\254yq\340'\222\305\361f\331\3149\302K\244\206\030\220/4\230\030a\214\241\271$\346\340(s\2127#\226H'\314\3632\1777#n\230\310\0257\310\367&\303s@\030u\232\314\367\346\270\343\302\317\027>2\233\303d\022y\274q6\223\257\023H\204\237\003\"DS\tS`\003\303\023\351\002\013\341{la\002\347\253d\241\204\231\357\215\022\270\363\324y\356\340\324\2740\322y\303\203\\qt\321\\\001C\022\271\\1\301\323\331\334\t\202 \347\310s\334\340|\341$\322\211\314I\036\341fs\305\3534\302;/\374\324*\270pvxo\232:\3729 B\030kbh.\217"
+	.string	" \262`\321\324\360:yn\336$\013\344s\251D\262\260q\341\004\356 u\222N\366\350\302Y\303l*\237O\236\025O\242\213w\271\303c\202\305\022\231\003\334)\336(\177,\234G\345\316\363\350\302I\301{\243t:\337\026\315#S\231\301\021\207g\271\303\241\246\t\363 \2177L\345\212#\214|\036ux\2340\f\357\316\023"
+	.ascii	"\302w\211L>\201\260\363m\301T\036\225\317\2473\230t\336(uX\246"
+	.ascii	"Rg\303\220|s\222.\220:\273\370,\261l\356$\235\024\350 K\264"
+	.string	"\330aa\243Dr`*\223\357\223\347\350\002\251st\341\f\036]\360 \217.\220:\305\341{\323t\341w|\036c@\276\310\260!\231D\002\223Id2\211\0246\235/\006\222I\244\013;_\370\325i\332\360\260xo\2160\005\317\234$\254<q\303$\261\\6\235\031\236G$\2144\221\342\271\203S\003/\221\353\363\230lB\340\271\2033\204\221\313\225\331\\\2569\313\345\372\336\360\300Jx\211<\2468\261\202\360\346}wR\004\337\247\223\247Y\342\206\311\323t\342\bw\23279\032F\246\320\341a\266\317\001\361\334\301\t\321Tj\330\301\t\276\307\023\317\035\234\241\363\275Q\266h:w\366{\004\2767M\027\236\310\025\317\375\036\213M\230\007\t|\217$\236;8\303\033\036$\nM\230\007\271\2137G\034\244N\021\007\251\363{\235\310\030n\234\310\234#\016RG\210\203T\001\357\3608\2050|d\361\336tx\016\b"
+	.string	"\360\034\237:J\247\212gR\251\203d\2760\261\241\351|1\200\203\324q\237\003\302\371\272P\352T0\204\341\243\373\304A\252h*\333\026\257\211\027F\242\020.\233\311&\334t\23602\233\312\247\363m\301lA'\206\032\235\030N\334\274I\346\213's\002\357\223\207\370\302\t\277:\357\362U\0017s\236&\336'O\315\313\263DR`y\323\302\022\t+q\2247\0230\225:A\330\005R'x\303D\352\3504\223L\245\016\360]6O8\233pS\207\b?\217Ig"
+	.ascii	"\2125\314\246\022f\276:\360\223\307\0037H\233\024.x\220\033\340"
+	.ascii	"\347\200p\321\\q\274i\001f\276L\244\216\363\335\t>\217.\232+"
+	.ascii	"X\366\325A\276\340\242\271\302\205\341\033\346\353>\217/\016"
+	.ascii	"\023\211\202\270\363\302)`'\022~\376^\034&\322\311>\217\314\246"
+	.ascii	"\022V\3360\233%Z(\341$\211\367\246\251\323\341=\336\264\340\242"
+	.ascii	"\271\302\275i\341\275i\352\264.\336\033f\013.x\220\305\347\361"
+	.ascii	"\304\215rG\b?\007\304\215r\307\204\372<\222p\243\334iO\250-\250"
+	.ascii	"7\312\2355\006\344\013 \br\216,v\226B\020\344\020Y\260h\302<"
+	.ascii	"\311cN\022n2m\336\235\027\360\361X\0033\225\315\023;<7Le\005"
+	.ascii	"(\b\306\200\274\200\016O\212\033\345\016\361\311|wt\232%n\224"
+	.ascii	"'`\344\212\026\031\230J\027`\0227\312\035\343\273\304a\222(\276"
+	.ascii	"\200\225-\224\260\362\311|S,\337\026\357\322\b'_\026,2\300\316"
+	.ascii	"w\307\305{\204\227J\370\310l\202@\351l\346pP\361.a\270\351\314"
+	.ascii	"Q1\001S\211\\\301\331$\241\343|a\245\206\246\022F\242p\201\\"
+	.ascii	"\276(l\340\034\034\345[\201\024:\316\027\276\311\360\242\006"
+	.ascii	"V\352(!\360\302H'\361\006\307x\263l\346<_g\016|\204\337'\207"
+	.ascii	"WG\t\003\203\357\022\207\211\324\360\302H\3471\303{D\221\363"
+	.ascii	"D:K\334(wl^8\337\026\315\344\353<\346<\221\316$\021~\016\210"
+	.ascii	"w\251d\321t\356\034_\030\351\\6\2350\314T6w`@\276\316\025G\344"
+	.ascii	"\016L\204\221(2$\235.\t/\214D\221t\272$\334(]p\346\300\2563\007"
+	.ascii	"\336\317\027F:Y\023-\234p\346\250`\276\270\371\221\320\334q\221"
+	.ascii	"B\f\310\013$\235\300\347\200x.\233N\230\331LZ\200\303T\3528\221"
+	.ascii	"D\035'\362\b?\235J\026Gf\363\270D&\217M\347\013\234\r9IX\031"
+	.ascii	"\303\363\270\\*a\260y\201\\\2767G\035'\362\251\27496a\036d\315"
+	.ascii	"s@ 7x\036a\346\253s\343D6W\030\227\313"
+	.ascii	"\2463(|\276\257\023\3475\021\003\362\0050\006\244s}\016\b\036"
+	.ascii	"\035%\207\345\262\351\3249IX\271\303\306\200|\261>_\236%\262"
+	.ascii	"E\373\034\020.\234!\\83\300L\236f\t\341\013#Q\344<_'\213\027"
+	.ascii	"\205\013\347\020\t#M\330\274:J\230\311\203\302\205\263\206\251"
+	.ascii	"B\fH\024\316\240\023>a\303T\341\311\003#\341\024\257\016\322"
+	.ascii	"\251B\322Y\204#\240\023\303N\261\251\314\360\321\371\352(a\342"
+	.ascii	"s@\300<;0O\363\250\023\303N\006.\264\240\"\250\243\204W\370\210"
+	.ascii	"\242D\t\035%\274\235\311\344\232t\337%2\231\002\030\201\367\271"
+	.ascii	"\344\331\t\306\320\\\262p\276-\"\360&\235M\026\303\233w\271\002"
+	.ascii	"\311|]\330Es\305\372<:_\027J\027\340\027\307\211\204\2070\317"
+	.ascii	"\016S\031\274y\337\235'\013?\007\3043\004\234\203\243\\\002`"
+	.ascii	"\3712\231\310\234\022:M\247\n7Nd\f\316&\013\233\347Q\007\351"
+	.ascii	"D\236h\266p\276O\341\363\346}:\337\026\257\263\310T\352\254."
+	.ascii	"\220:\353\273\274\271Q\352\264\355\013#\235\3729 \222!\222,("
+	.ascii	"x\036\341\346R\2713|u\220L\375\034\020\317'rG\247\211\203\324"
+	.ascii	"aK\230 \201\203\324i\231\312e\3625\221T\302/\023\007\251\223"
+	.ascii	"\3419 \336\345\233L\"\005\360<&\223H\026~\016\b\016\340!S\005"
+	.ascii	"\370}\276N\367y\264\271A\276(xvt48_\370\251\304yQ\274\260\322"
+	.ascii	"Y\001\236\035\235\rL\025^X\351\214\301"
+	.string	"e6\2250\322\311\303\263\243c\204\225\314\026\230*\300J\246\262u\302'\222L\036\025n\220/\212d\222\204\206\347\261\305k\"\231Dn\246\n7\310\327\331\302\317\243r'\005\213\327\304\273\363B\305\261\205\023)\202o\222\211\204\237L\345\206\217\021hA3\225'\230\317d\253\334y\256\317\001\361\344YQ\002\204\026\202%@h\341w\323>\237\257\363\346\006\351&AP\256<\307\026\357\315\223g\305~\036\337\244\262\305k\342\311\263\"\370\356\274\200\237<+\334'\317\212u\005\021\307d\022\331\306\200DQ\302\004\211\366\275i\226h\361:\205/n\220/\n$\214\274\371\301\305\243\373\034\020p\222\307\t?Ax\036]\2740\217N\r\f\311\346\362xla&O3y<\272\316\227\031C\363xt\237\316\367\311\303<\036\367\rS\t\303\361\330>\231\312\235\347\361\3502\233\312\247r\371\036\217?\370\b?\225K\343\316\013\370"
+	.string	"7\257\023\231\363<@\210'\254\\\021\202\207\211s"
+	.string	"\027<L\345\362"
+	.ascii	"!\214p\034\201\004\027!\336\033\236e\222\251\f\341|\362\204("
+	.ascii	"\001v\3612\227H\246\363\205\231\312\343\r\362u\346\300;\307#"
+	.ascii	"\005-^\347\316\361\330\302O\345\362xl\2210\362\346xl_\020(\237"
+	.ascii	"\307c\013C\262\271\324\357\221\211\243\\\"\217D&\216rI\"\231"
+	.ascii	"Dn\3709 xvt\216M\347\013\234d\022\031\342\351|[(\2357\005x\217"
+	.ascii	"(>\020\341\203\021xvt20\233J\230g\331|\276N\340\363\250\341="
+	.ascii	"\362\354\350\004[x\311\363|Q0\233J8\371\302\257\t\236\035\035"
+	.ascii	"\233\026\357\315\272D\266p\2760\263\005\034\246r\271\243\203"
+	.ascii	"L\221L\"3\344\300\315\246N\212d\022\371{\223\314\b\300O\344\013"
+	.ascii	"\001\230\304\315\013#ov&\260|\223I\022Oe\207\347\200x\2767M\235"
+	.ascii	"c\322\031\"\311\242\303\363\b\303\023\251\003+Qp\321\\!\204\217"
+	.ascii	" \214x\302\312\025z\211\344\201\235J\nX\300\302\357\223\005\213"
+	.ascii	"f\013;_\345rG\t/yt4\2240A\"\005\207w\211L>a\344\212\026\277%"
+	.ascii	"\262E\013\345\315\363u\302\310\025-\206\317\001A\334\360\363"
+	.ascii	"\205\221\020xq\220\316wG\007I\204\217 \214\200\231J\227\031\003"
+	.ascii	"\322i\"\207\204"
+	.string	"\316~\016\210\347\221\270o^\347\013/\225,\230<\300\347\200\b\361t6\237\314\367y\301\233;\2573\004\334l:C\004\237G\034%\013f\323\005\222\251\324\261\211\001F\256h1\301r\371&a\346\373|\235;p\223\t#W\264\350\360\036_\034$\274l\266\260y\217\032\336\244\223\247\231\302\371\302\257\0130\363u:y\2226<\373\005\254L\"w\220%^8_\030F\256(\302H\024(\360>y\206\313f\023\205#\373\204\235\357\222D\211\367\311\243\341\305A\302\3147\351|O\3400\225L'\262\002\314\246\022\336\321\341y2\233I\013\340#\t0S\311\343>\225\317\327\371\302\317\02790rE\013\"|\034A\004\314T\272N\370\004S\205\347\363M6\235'\340g\363\304\316S'\303\363\b;\233'\226H\245\363}\n_B\t%2\230\300\013+\354$\210\235\247\3161\311\"D\222E\b\246\022\251\023\"\351|\206"
+	.string	"1\201\023\231\223\324\377m\306t\031r9\021!r'f\310\204\211\257\315n\270\267\243\314\r/\367bS\247f\020\307\320\370'.m"
+	.ascii	"m6t\267\251Sb\262\352\312\332\346\213\215\230'o=r\210\261\t\203"
+	.ascii	"\304\222\203H\t\210\227]T\3266`\200CW\27489\356\3502\324\242"
+	.ascii	"i\0349\223\204\213p\250\251'jf\016\254\313\033\r)r\302&;\271"
+	.ascii	"\034P[\204L#\322|\374\304\005\341\272\252\200\ra\301b\243e\314"
+	.ascii	"\001r\334\320Sz\273\215\226/@\322\332\262\266\311\0024\202\343"
+	.ascii	"+b\206\003y\373\267q\273\315\225\273%\036:\262\266i\263\261r"
+	.ascii	"\005%\363r1tH\302\234uem\303fS%\bt\214\312\353>=\312\263\312"
+	.ascii	"\373b\263fl+\332B\363Cm8\327\345m\313S\232\361J\217,\032\300"
+	.ascii	"\"\256\264\"\033*F8\240\325\030\25236g\301\350\257\rOI"
+	.string	"\233\315\024\033)\272oI]T\260.jD\207\r\231\r\231\215\031\231\0060\261yr\0333\033(\271\313\232\f$\033(6eE\247\037^_\330#L\324\260\332\366o3\246\237\340z\234\311\211\025\371\210o^}B\234\300(>y\t\201\322DH\207\2059\223Fjc\350\304J\016\237\260a[\321\213U\022<&8\210KMo6\300\234\206\b\201\021\365\305\003\205\273!\0376Q\343\017`\032#X\362\274\214Dzn\n5\325e\274\232\002\027C\310f\211\361\b\025\033]\\_\352\232\027\016\272-'\353\022\236\232\030-\343\223\27469\241\254\241\331\223\020\242\246\254m\224\330\\\335\006\3536X\331\006k\355\353k\227lq\322j\033\253\020\240\342\330\307\006\211M\222\333X=jcU\334+\252\252\006\031IY\r\276V\333\024\261)bsd\314\310m\216@\2032\244jE\2406T4\312L\233\004\227|\331\002\343"
+	.string	"\230\r\020\033 6SU\202\334f\312fH\223T\253n\210\215\020/#S\254\024Y\343\256\004\021\343@\224\r\017\033\0366>\356\230d\231\332D\335\306\207M\017u\352\307\217=\233\0366RD\2724\0373[h\354\t\211\003F6:lt\330<\211\221p\365\325ge\263\3436O6N-z"
+	.ascii	"\341\260q\262i\332F\362\226\264\362\214$yI\312l\033\03366lp\374"
+	.ascii	"z\342\270\307\030\377\200\331!\305f\35168l\230\210[t\254m\331"
+	.ascii	"0\331\334P\215\262D\031\023\326h\373\022\246\266mj\354\255'I"
+	.ascii	"\304\262\376\006\306\366o\223\364\241V\021\020\024R\033\213c"
+	.ascii	"\006\332\321\021\227\354DF/\317\2508F\233\205\221\303Q4$\213"
+	.ascii	"\013\023e\"\"\236\331mF\224r\f\021\361\252\240\031\323C\243\230"
+	.ascii	"eHu\005\310\317\214"
+	.ascii	")\302 CS\240\204\212P\302|\244\371\311Q.-ZM\232\330\310\030Z"
+	.ascii	"E!\223&k],\202\373\"\312:\217\301\003\"\007DL\243\241\247\016"
+	.ascii	"\212\315\317\360\210P\t\2325>\033\237\342\230.2\366f\323\023"
+	.ascii	"L\203\032AQ\313\272\206o-A_\037_\266\211k\372^\303w\267\013V"
+	.ascii	"\220O\233f\350\303\n\031#mY\027\221P\321RC3\344\301\006\325\326"
+	.ascii	"\2255\220\311\230\254\033g\206M<h8\201\2227\304\221\341\234\354"
+	.ascii	"\336\314"
+	.string	"\fm\354\267i\334P\231!R\260F\321\033\017\274`\233\224\25613\310\300\230\002\004\214\227\254\343\241\373U'\005-\353\032\273\240\235S\264L\225B\321hM\207DP`{0\352\202;\200\322/h\334\350>\024\372\351r\0233\214\341\004\013\0210YG\271\3428Jl\225\020\2211\005\314\320\307,.\f\035\0210'<\262\316+\333Z\221\241.|\232\211GW\026\027\355\343\210\331\326\234\360\013\236\321\224.\353\237\351\236\215\254Y*L\232\254d}\004\265c(\353\033ZvI\264\b\267\340\350\241\"\344M\3706\314\261E\207\231,n:\246k\353\303\"d\213\032\252;\312\032H\346\352\031b\304\255(\344\206\247\005H\326\304\"EB\232\332\204g\303>-d\240\252\b\241\2603\202\302\220a\023\202\305(\262\205J\326\302/dY\360\324\272Z\252%6\340\322\204Z\037\362~\200\241\t\225\020m,i\342\203J\021)"
+	.ascii	":\220P9\273\021|B\246\357g\212\221\262\260:.Q\rLWEY\353\237\266"
+	.ascii	"\032;\314\204C\206STS@P\202N\252\226\276\244'eA\037\31746\263"
+	.ascii	"'BZ)F^M\310\200d+a2j\306\212Evt\231!&\224\322s2E\344\244\210"
+	.ascii	"\304u\263\021\255jR\334*v\201\3621$-zI\235\226\320\205\355x\302"
+	.ascii	"b\243\211IQ*\267\243\312-\353\232\250\332\327\267\027\307>5\321"
+	.ascii	"bP\030T\034\373\324\200\325|\275&\372\270\330\201!\251\241Vg"
+	.ascii	"e\325ti\275\246kI\016\213\022\252\262\204\013l\210\207V\021U"
+	.ascii	"\210\333\230'[;\210\320\f\224\267>hUU\315\325\324\007YRsX\220"
+	.ascii	"\274\346\252FI\217.PYJj\222\2509\201rk\022\305\007\310S\3265"
+	.ascii	"VmW\036\232\334\324\006\236\246\246j\240X\037\\\275\325\225!"
+	.ascii	"\362\032h\r\025\222\327\035\032U\215\221\034N\224\220\025Q}\254"
+	.ascii	"\311H*\322>\251Gfj\310m F\217\367\250\021\262\001P\034\307\210"
+	.ascii	"_\030\221\342\232\326\370x\215\220\232 jlcTAj\200\3545\315\300"
+	.ascii	"\"\373\375\370\301%\376\241\273\264\231Q,\204\314\256i\252i\252"
+	.ascii	"\211\n\262\301\226]_\215\323k\242jx`mE\325\360\250\201\352y\252"
+	.ascii	"\222w\225\211HQ\213R\363\244\211ZTT0\272\354\032\035ZeC\022&"
+	.ascii	".\353k\300J\r\216h\030\026.s]\262\276\006\326\366\325\021 h\262"
+	.ascii	"\216\222\345p\003\262\024,\336hr#\313\306\031\021\313\314\311"
+	.ascii	"\227\222\360G\323\tA\332RC\030g/py1\222\214zO\326\242bHD\351"
+	.ascii	"V\332\302%\356\310x\006(\365\205\313\235\021Z\037\325\225\255"
+	.ascii	"\2423\252\216'\241+DD1\270\036UI\206f,!\023\205\006\261M\013"
+	.ascii	"\352\307\214\031R\204{P\352\372\204\210\\\212BNth\202\210W\332"
+	.ascii	"!*K\256d\020\341\b cHJ\214 \035\320\007\235\033\024\306p\310"
+	.ascii	"ZtU'\003(\250T\314\002\226"
+	.string	"\306\256\346'\270\304\245\211\333X\215\217\230\252\030ieY\033\321\030\321\324\304\352\321\021\003\342\236\234\254\366^\023\033\373\242s\3209c\237\221O\t\234\027>+W\232EGfL\223\215\254\t\2415\211n\"4\007\323S\326\3042 \323\333\034T\326\3061\3061F3\267\361\231r\367n\304\345\310\213\231\224<\374\30627\232I\213\021\206\f\\\326F\274\247\241\031\363\332\222\265\221\214\006t\354\337xG\254\"\203E\212\321\216xU\246\211*\353\272\272\365\216\003\324\352%\316\313\n\353\006Z\264/\353k`\306\227/F1R\212\340\324v\22570Pan\024C\267\366\325\030\223&k#\230 \233\027\250\254\261.`\\x^Y?\003f\214[\214[\214]8@\365\340\265X7\272\310\344\r\351\236\230\235\031\271\334\330%\r\315\215\260\273\254\215s\252X\332\227\035xY\033\345\206g\370\252<\305\031\220f\311b\204\343"
+	.string	"\325S&\350\2444\265\243\016\211^\025-7\302\001\271\004\222\236\250\364\304M\326\306I\225Q\214\005Z\f$\025\203\246\212jH\001\203\025"
+	.string	"0P@\034\016\210dm\224\335\024"
+	.string	"\017\\\276~jD\247\215\2644\252\030C\003"
+	.string	"\003"
+	.string	""
+	.ascii	"\001\001@\200\200\002@\221\230^+\030\311\373pE\244\224\b\206"
+	.ascii	"\256\216\340\336fh\352o\310\t?\2720HU\311a\257[\300\204[{\b$"
+	.ascii	"\353U/\323\353\311)\255J\350;\330j\036;P\303-\301;s\325\235U"
+	.ascii	"\343RA\032S\343?\022\346FJ\270\367\177QHo\277d \205T\256\225"
+	.ascii	"\251?DD\364\033\277\025\226\277\271>^B7\b(\035\342\231N\316V"
+	.ascii	"gwNJ\230}\030:\377d\372\336\341\033Ld\353\361\367E6(m\305p\f"
+	.ascii	"R(\310\226F\246\"\316\370\027\001!\272\201o\225\307\313\361\303"
+	.ascii	"|Nw\217\355\016\256\233\231\341<\002\0172O`4\311\337Q\026\367"
+	.ascii	"\242\333\200\243\363zra\310\250\024\326:\347d>\210\350\216\225"
+	.ascii	"\256\320\016En\377\214Il\305h\013\367\306:\315<\310\263\351p"
+	.ascii	"o\300Sc\232\222\006\200\244\264\f\034\177\03331\316\321\304]"
+	.ascii	"\006?\235\377F\230\265X\031\026\353\035\212:\377\336X;\017\321"
+	.ascii	"F\020sec\025\364\210\020\274\317\353\303\350RO\332\245<\362 "
+	.ascii	"\275m\314\372;\235`\026\246;L\231N\375\204S&\212,n\340\245\363"
+	.ascii	"\225\335E7\304 \213\223\212\212\376\220Be\330"
+	.string	"\265{\353\304Pc\255\001\255\027\276\253-\037\320;\210\250\262\006L\302\r15\330\374\212\202NDVIb\206\253\323\225m\024\032^\323 \002P\334\351O\307\001\223C\302y+c\261#\226\316Q\211GL\343\337\004L\330\025\303\271\021\003\240\373\007!\257O\370\307\261\234/\037\320\274\023\313\367\221\237}\253\232\306C\\5\242{\004\365f\250%\335\226\354Z\220F.-.\204\331~\301?\237I\030\313G\2040\356\203KN\201\013a\027s\343-6\342\341\rN\017*\344#\036\373\231b9\235n$\266\245i\320\b\261\350#8\260\3377\313\255\323\002An\275L\007`\027\261\335\331\325t\247\n\370\006Qd\257\320\314\274\026qL/X\222%kp\034{\367<\355\202\337\353\314:@\310F#\203\317c)3f)\201\240\307\364tY\372lp9\326\244\237}\361\343\313\230\275\031\210\314R\r\246\360 \271]\006\273"
+	.ascii	"\261\020r\346\232P\211H{ny+2\212\270\271\231\364a\020\037\356"
+	.ascii	"&XI\020y\256\034\336\262\204\025\0375\316,\363\266tY8\212\353"
+	.ascii	"\035\262\277\257\303spO\253\235\316\222mw\254\033\367E\032\244"
+	.ascii	"\367\254[\337\003\006\334R\033\254\241|S\252H~\367\305\335\033"
+	.ascii	"9\374\330,\002\316\031M\031\2126\006\215\211\365;1\257\020F\367"
+	.ascii	"\241\203\335\352\370C\326%\016@\021\"a\214\227\030\204.\214K"
+	.ascii	"\005\033ah\271:\240\004r\222~\216\016\256\177\310'C\321\244t"
+	.ascii	"\364\006\027I[\310\226\2657\237\266\335"
+	.ascii	"fd\216Y7\374\344^\035\026\177\214\336\324\204#:\013\002\020\f"
+	.ascii	"v\240Z[\003Rg\016>\203\323\344\"\375K\024W\221c&fY\206\363\211"
+	.ascii	"\264\322)\202\336\356G\001e0\220\263\364\005\271z\353\263\376"
+	.ascii	"\211\316\277r(\031g"
+	.string	"G^\235\263\320\376\322\317\272d1x.I\207i_\n\013\215\334L\373\266\221\325J\005:\006!t\351\336\353\363\242\327\302\232\241u\345\270\bJ\273\301[e\303dk\305\300\237\"&\240\207#\233.\361\243 r\306\246\367g\231\023N\270\334\377\004\3337o\240`\203\234\2634\263A\336\337\252\"\334S\220+F\\\315\271\227\216\336\326\347\324\362\365\226\366\177c\200\334\267)\352\303\332\327\310\321+?P\037h\006Z\330\026o\r\200'O+M\t\352\276\201m\205\234_^A\3118\t\242Ex\250\207}\005qq\252X\376\024'\355U8u\366\347\270\364%\235\360\204M\200\356\311N;l<\033\020\212\216\324\034\0053\247s\350\024\326\034\fjlEd\232!\245~ 9~-n\030\221\023J\r\205\242\037o\031)\202\242De\324\362\003h!\326\031\325\f\276u\007\013\\\225\252|\016I\306i\216.\354\317$K"
+	.string	"\266c\2009\300\307\376\311\321t\307\021\345\023U\265\247{7\262\223\211\256^\362~\004\311\\\003\216\375R!0h\031\350\225>\225\313\300<\020#\3530\325f\025\226\323\243O\202\2134L0\364\247\300V\331;\245B_\006\277c\250#\373\023|D\210\3010\f\216\207\223\251\216\273\271eGL\306@\025-t\0317\\\245N\n\200\255\\\017\352i\372\267p,G\245\324\257\331\360\343\006\327K\243Q\006@\370\013\3665\024\007\203s\300\246\364dj\305\223\036\274v\373[\263\300\346\bt\031N\3467\253(\201\242\311\351\027I/\363\022\334\220"
+	.string	"p\334\337\034l\264\226v4\205\304\202{\260\230\320\225(\016\272Z\"7\002y\211W\275h\326}\234\2133,\237\030sb\206\277\212^M\022\273\327\b\273\035\325Czn!\307\343P\255\r\224\244F\274\334;\332\265\333\357\3207\333\221\326\316\211\264\337Nc#\270N\370\260\235\327:g\324\306\215\372\3740\234\225qa\345\300\004\026\233\004\324\212\354\343\311w\233\343,Bf\310\304\031\214G%\034\362\366\252\322\202L{\212D\030\022L<c=\037\034\033\3118\225\033\373A\325v\027\"\2536W\031&\2370:\261\026\261f\236v==\240B\310\034o\034\257PcS\321?\337\260\376p\250C\235a\204\317G\020 \262\255\236\202T\326\2138\313\337\007\013\364\343\324\207b\026"
+	.ascii	"\356\247\307\016\330\004,`\r\252\034\334\026\351\343\261\352"
+	.ascii	"\226\017\304LF\037#\r\355%\333\024}\220\311\255\025\\\226\312"
+	.ascii	"\n\307\t\313*m\245\275\\q\332\340\254\305;\013J\253\013\332\322"
+	.ascii	"\306\356\001\244\376\314e\213\217\275\2544Q\013\235y\335O\313"
+	.ascii	"\313\353\252\rO#\035\347\001\303\310X\353\366\022\036\265\377"
+	.ascii	"\377\327i|?(2\274\377\276\t\002\267\027t\233\355}0\007\306\305"
+	.ascii	"\267\340\314\035,D\225\365?\242\206\260\234\200\341\013 \277"
+	.ascii	"\375\272.Of\207gT!\254Q\345\212\351\312dBz\0059\021\\:\341\223"
+	.ascii	"\265x\214ML\335\265w\026\252u\376\303}$\305\274!0\003\256j/\b"
+	.ascii	"\235>_W\223I\021\372b\272\325\362C$Yr(\273\334\216Yf\346b\212"
+	.ascii	"\233\270\335\330\0028\354\223o\275s\230\025\225r\304?Q@\353\023"
+	.ascii	"X_\361\262\231[\323\0323\377\304\221\255\304\235\333\b\240FF"
+	.ascii	"yl\245\232\367\341r)\016\r\033A\241\020\322\035f\230[i\212\021"
+	.ascii	"s\224\244\210\212@\370\2031\n>U\202\361\357\362vh\025@\376\263"
+	.ascii	")\217\265D\320\016\313U\323h\337\211w!m\024\331\247\005\2163"
+	.ascii	"=8Jz~\027\326\003Uf\331\356\027?fP\247\25440\333\223\334t\252"
+	.ascii	"\266\"5\241\213\305k8A\216\206\227\215!\2561\251\205\363\013"
+	.ascii	"\266x\210H8<\363\224\303\2122\210O\272\036\017\225\256;\224:"
+	.ascii	"a\271~F^\276o\363\375\256\316=2\031+\346\365\270\243\323\221"
+	.ascii	"8\027\340+\225\020\256=9\251\002\274\363;\346\201\261h\030G\314"
+	.ascii	"8\263V\223\352\227\231o\343j\252\225#\006V\274\30082\"\306\271"
+	.ascii	"\023X\374\343\300\303D\031I\34595u\210\212\3156@-\226/q\020\234"
+	.ascii	"^\265\237\004\306h&\037\227\244\373\245YX\257&\346\266\314R*"
+	.ascii	"\2401\217\243\354j\255A\b\321\033,,\277\304\240$\241\350\221"
+	.ascii	"!\321l\177J\001K%\254@\210Zo:\273G\003\220\025\253\227\246\304"
+	.ascii	"|\353e\372\261\276\250\237\214\331R\215\326\3673\201<\360\263"
+	.ascii	"*9\341Y\370v\326\257(n\026\340\231p\227=F!\304v\362\205N\205"
+	.ascii	"s\034N\315f1S\241+A\212\365\260\325\344\373my\243%s\022\362{"
+	.ascii	"\240k%\306\030\326\236\242\352.\2520\362/\375b?\255\005um\323"
+	.ascii	"\312\306\347\212\235\272v8\272\345\211\312\317n;\204L`Zgz\212"
+	.ascii	"\366\006#\317\233D\236\026\"q2C\\\205\036qqg\311\216S\036!=P"
+	.ascii	"i\"v{U\227\266n\317\301\221\f\207\373d\340\006\364\200\004\021"
+	.ascii	"k\336\036\365W*\"\343;Mq\254B\034\326\274^\r\223\310\326\f\017"
+	.ascii	"\235\330W7\032`\365\033x\034$9\304\231\373?\022\240\302\034\353"
+	.ascii	"\212\254\240\272R\032\026\263#B\216\271\336\313zd\263\320\353"
+	.ascii	"H\334\333b\025\205\244T\374\225\335b>\335u4&W\30072~s\207\331"
+	.ascii	"X_\363D\311y\303V?\216w\212n\210\344\202\315\225\354\250d\333"
+	.ascii	"\340S<Z\216\323\335\224-\034\254\306W\370\267$\030\024LX\367"
+	.ascii	"@\255,}\300\264Z\212\002tSn\310\2061\202\210\274\270\340\337"
+	.ascii	"]]\317\017h\216\344\312\253b5P\346\255\002-\301a$\266q\360\301"
+	.ascii	"(<\256E:f\370\221\002\3518\343\350\363?\f\001\256\021\200#H\336"
+	.ascii	"\334\226\033Oz\232\215\303Y\336\374\373Pz\233\347t\364\227\336"
+	.ascii	"\004I\217o\255\212-\260\325+-\371Cn\344Vc\210Ft\370\031\342\017"
+	.ascii	"G\231(\360D\376]\316\3677\314\017\222\350I^B\350\223\236\340"
+	.ascii	"\327\224\233>\234\207\t\034\036\265}\214\026\314\225`\255I&\270"
+	.ascii	"\007\313e\337\034Gx\273\220k\376\354\"\236\013\373xK\2401,\357"
+	.ascii	"\263w\244Z\244Y\354\310\250\353\364\356\2046\212\220iQ=\247"
+	.string	"e\237\334=\221[\277\264\374\030\377{\267\257\337\312\340\232\216\205\204\030e\002\267D2'Tl\303\026\3456\0327\354\221\320Q\273\211\037\005![\3322,\202(\"\232$\232\327B\270My|4Y\204rM\371\316'\221\203\215\340\272 \345 9\260Yd\361\276\376\245\210\342\025@\260*\215\224'\245\2743\bVe\277[\265\032\362\006\220\306\335\263\353>\361\316 V\267\337\277\367R7)*vt\366\334\267\2008v\211\016\374{\305[!\243\232\357\341\233\247\220\032}\257pT\245t5\223\374R\266H\352n\205\340\2105\243\233\312\334\306uc\322K]\350\"\frM!W\217c\315r\326\312\261\240\355+\355\025U\234dO\367\263\020H!\\\334,\340\256\252\321\t\004\316\241h\234\321\200\"|\004\022\017\213\246\213R\236\350\nc\036\025\240\375\204\266\261\033\352/\243p\233?,v\021\024SB\250>\256|\003"
+	.ascii	"\265\333\323BNp\3120K\245\027\363\034X\370\217\273"
+	.string	"B\250\361\251\275\026\317\333D\rL\327\333\022\367\326\315\017\305\201\365Z\b\020\005\020C\202c\207\224O\371\3769^\351\326vfk\374\024\340\313"
+	.string	"\256\320\352\036\317\226\217\216\310\353\336\002\230U\212\255\013G\275\363\032sR\020r\216\024\366\252\363*\016C\315Oc5D^\347\346\362\336"
+	.string	"\006@7\204\360\1775\302\211\275\b\233//D\206wj1&\241\237\310\003\242\177f7\335]\276\337K)\225 \377\275l6\200\266\230\016n\237t\263\235\233n\230a&\261\331t"
+	.ascii	"\270`\223$Y\0240E\261\023\263\227#\202\246\352\334\333\247$\205"
+	.ascii	"\315\333\177o\316]<\372`\205\027\2526\343P\317\226\346\341\360"
+	.ascii	"\326\023\017M=\263\"\361\026\336Ag\200\366\345J\373\177\\)\002"
+	.ascii	"/\210C\3734\201\267P\330a=Y\212v\345(\352zGv\321\225L\212w\242"
+	.ascii	"\\\301\200\201\340\342\355\3475$,\240/\315\365Pi\367\202C\365"
+	.ascii	"`\335\334[Y\351"
+	.string	"\024 Y6u\353\222@\031;\263i5\035\362\244\353\"\344\306\221R<\367\001\210\325\006$\202\255`C\002N\276\336s\026\366D\272\036[\230Q\251\327\222\277Cw\245\205\273\310:\257\331\312u2#\202\364m\003vy\210\254r\257\025iM\277\232\217$K\251\031\312\274\366\177\005\335U\034\221\203R\221\027\005\232\375:G\276\253$\345\371\226w:\331Zn\343\330\343\246\225\343\334X\205i\275\251\342\325#c5c\305\254j\237s\022{\375\364\353i\220Y\251\265g\222hsQ\346uH\276JT\3416\214\255\201\017\324\t\"\246%u\337\350\211\204:\035\247\222\271\201\032\370\034\273\247\233\230v\225\361\324\2174S\017c{\236\277+4r~\267\035\353\3771P\302\253\233\226\242\362M*\213\200*\274\030(\246\214\213\341\232)\016{\023\217R\024\241)R\001\022\033&\243B\307s\252\326\330\332)\037\013d \311\002\346"
+	.ascii	"\002\355-\353cX\206\013\305\304\004T\214\004\310^\004\240\237"
+	.ascii	"L\035&E\340\332\247\344Q\3767\026\006\3508\230\326\275\233\332"
+	.ascii	"<\354;\246k\251\267\200\342\216\244IM\244\3156\311\036yRn\373"
+	.ascii	"\311\377\362\335\233hN2\013Z\227\033\231^/M\364\252z\004\001"
+	.ascii	"\016FZ\346\nX\277\036\351\327H\377"
+	.string	"~f\3749\264\344T\362\373G\217\264S[\335\004\274%\211\236_h\032r\3303n\321~\311\270\315f\013\204\211\220l\323\3204\235a\232\263\017s\222!,\242=\034+\356\025\227f4\001\330\352\021\2144A\233\322\227\303U6W\323\327\215R\357\023\347\333\257w6\tK\222\214\266\001\253\024\006n\341:\3142\227\030\270!#K@\370\024\246\333\305\223s(\257N\214/\032M\\\0317\267\037\310\321x\231\213{:\236\016/\21437g\005\016\310n: \261-A\221\222P\367\233\211\3029^\302PT\207\257\300F\361\007\310g\001[\233$\353,\233\030\036\013\260\367T\t\"\241\362cSe\363\225\020y\311\013\021km\346\314e\236\364\202\"\207\230#\316p33G}g7\312\270n\244K\3468\006\b\0268\231\257\311\355e\0329@\225\226Da\003\022\254\215Vl\340q\370C\230\024\320j\217\255\247-;"
+	.string	"\265W\245IU\365\236?\361\301G\222F\252(\352\025\036\030N\221\207\374X0\342i\025\240\262\302\254\317!?}\306\365\357.0\217\340\b\321]\035\320\016)\0232*m'\271Q\254\3013\244\247 2\266\352\035P\344P\\\263\267%|\004\342W\373\035p\201\310\2017\021\322\201\334\241\301\376K\024\364u\277e.$\327q\020\3365\375\331vw\201\037\030\205\313\233\243e>a\373\213\254\027D\036\206L\"\262\320)5\217\254x\213\353\245\342\007\241\304j\tD\353\026\005*?&<\3005\037b\202\240\247QB=\246t\022"
+	.ascii	"KC\262\330\224\032?\353a\217\356\202Y\354O\300\333\236\005\004"
+	.ascii	"g\205\3019a\273\377\025\261eb\027\346\363\360&)\221\035V\274"
+	.ascii	"\3517 o\217\020\017\003d\242\0353k\366\30695Z\207\365\311t\273"
+	.ascii	"m\230\325H\237\027XM\3104\206Kw\027\273S\021\177u_\027\362\256"
+	.ascii	"\230|\306,\3617\r\314\327\265X\377\261]\264\t\301\037\367T\214"
+	.ascii	"3\177\344\203\213<\215\237\220\203\215W4\233\322\333>\275\250"
+	.ascii	"q\303\224\275[\273\177\035\013\253\371S\332nT\020~8\2612-T\361"
+	.ascii	"H\200(\324\016ZV\021#\205\237\324b`*\264\240\235B\303m3~\201"
+	.ascii	"\266kN\350=\370\250\223\233\343^\352\337\213S\304\034h\210`\363"
+	.ascii	"e\277k\373\023cB\034"
+	.string	"\372C\023\364:\246\323\202\017?t\030\350\033\305\300$5\335b\346j\317'B\300\263MAJ\320\261\327y\337\237\317\f\270\017\245pG]\235\224Cg\005\216\302\024g[\203~\003\275\377Z\213I\316\345\207[xa\324cS\200hZ\255e\252\006@a3\3520\026\372|{\243\267\300\"3\215\253\226\202\021&):\240N\271\205^\203\203%\346\027#\f\033\\\254\372|\316\325'!\202\353\227zl\333\211\004\352xH'\322Y\206L\002\013\bo\002\341(P\2021A\202\200K\201\253\n\317\265\322)\245\0054u\330\001\343\210<dZ\3519Z\331J\320\0241\250?%O7)\330\377\310\004\372N\304\343\001H\306\032\332\246*\363\177\202\267>\331\201\236\256\t\"\376\311Cq\234DV\3152\245\362\255\321\257R?\037\f\364\216\327\255ez\333f<A\243p.\227\032\025E\363\2178OU,\222\bz\2242z"
+	.ascii	"\2670xB\200\341\350JP\2351R\2627|\274\263\245\260v\244O\177\224"
+	.ascii	"\023\023\373\307\007\r\322Xg\342\221\b:\235\352\370\250s\206"
+	.ascii	"\235s\344H\327\334\325,T\003\373\271\342MKD\212\017\336I\221"
+	.ascii	"d@P\002:\276(\337\264hC\371!\360\033\324S\007\037\222\266\317"
+	.ascii	"\260\004\347\305\3077\306P\344\236\246\372\230\360d\211i\356"
+	.ascii	"\364\356)\360k\204l\003t\212\366\333\376)\244U\332$\216W2\033"
+	.ascii	"$d\007\024\363\2530RX\270\301]S\311\024\323\272\201\1772c\251"
+	.ascii	"\200\220\331\020\304\036\273j\237\353\361)P\231\004\0340\006"
+	.ascii	"\344\302\251r\377\235@J\344\246A \035\330\223\361\272?n\006"
+	.string	"\305\353\t\262\031@\007\3078\263-i\216!\027\250&\032\213\202}\250\353\316}\017X\020\221\370\255E%\f\245\007\240e\3342;\233!E\001\247\177\327G\352,>\275\261_\013\300\202\300\231\304W`a)L\n\345\225z\243F\307Y\277\205\273\225\t0`G\205%\242\273\\\335\204\201\004\271\316\0372l~\336\362\322`\325\321\341\245\372\275N\024\217\005\350\354E\352\226\0228\225\005\373\\=\026\217\370E,\346\262k\200\"\356\327\036\250\220g\303\254\360\363\214\215\301\243\356\336\r\037G\247\243\327\352M\273\032\353\350r\322\262c7\321}L\036k\307\"\232\370$\007\313G\033\354\242V\233!\330}\022\353\372\347\277m{\031\336\252\323Z\362\345)\357\301y+[R\247\267\356=JI%\245\374sK\374\363\264a\004\350\325\256\276\307\226\370SO\016rY\365\272\306\321\3773\005,R\372F\246\227\177o\020\221\2651\032"
+	.string	"\310\343X\177\237\t\r\3555\354\312\262Q\364\003\"\363\364\003XS\301\221nx\251\272L\324\325\005rY\356\227\342\020n\271|\026\3342\304 t\222+\216\362\001Z\037\361g\003\263"
+	.ascii	"\027\304"
+	.string	">\206\211\376\314\327\222\343\325\035\2743\022\274\375Bw\006\344=p\237\366\360\365\263:%\346\020\204\020=N\204I1\315\257\205S8\205\356@\241-\017"
+	.ascii	"\377\341"
+	.string	"\266\200\274d\031\007\362\212H\036\330\236\252\b)k\031\347\346\"\233\330\005h\375\211\221\263r\032$_f.b{\332Dw\300\252hG!2w\347f\3066LQ\350{\246f\314\0275\277\207Up\345j\313<\242q\3762\333\013d\251\025/\232\341\301a7(m2\017\256\306\332\264r\b \005\234B\275,K\253\002\246\001_\273Fb:\322\313\365_%&Q/\363S\212}e\345\345\025\034-\210\266\347\214\246\223\272\210\352m)&\027\225\243a\037\030\316\272\204\033\325e\275\212>\2573\344\200\223$\266\324\363W\352P<\241\336+~P(-\263\334?\250j\017\301\301\322\3140\312E\373X\354ZY\325\3066^BV1\013\261\336\r\240\233s\026\030\210\243\200\356\013\b\351\202\005\226q\035\237\356\215\3654\376!\034\372\021\234\247\206\321\363\020\210!7P\2172\376g\313B\f\277\353\372\236\3401\b\265\250\276"
+	.ascii	"\364\2002\363\022q\2124ol\210E\224J[D\304\r\030;o>Z3\002\363"
+	.ascii	"D\344\275\006Q\337v\270`h\264\234F\251\f\271\013\007\277\325"
+	.ascii	"\237O\202I\277\013\030aS\305\363Z\257\212\003]\345!\326D5\312"
+	.ascii	"\346x`\207\t\251\211\224\357tJ7\311M\243\2441\355K\027\300\204"
+	.ascii	"\213]\306"
+	.string	"\376\001\264\205-\001\034\356\223\027l\330\020\341:A\313\222\256v\274\350\335\"\005d\016\201\242\373\036~SrQ\204\005\211c\254\235\036\352\242\202o\002)1\2326\233ODw\202\250\340\361n\216C\356K\260j\t)\373\3141]\024jGr6\220\244\211[\222\2367GdZ\360q\375S\226\016\027\031\306h\375\023\272\211\375\341hb\315\320\006\"\246 \252|0o\221\337\270\354\242\b\003|,\253`x\370.t\272\254\231.\3501\374\2753\346\363\247;\307\177\257\b2\234\312\r\270\360\237\036\201\370%\323\322\272\225*\231l\227\240\317\253ey:\336BP\346\351\303!R\202.#/]\024\b\013\357\021OR\356M`(\207\332#\253rL/\\\001\345>\316\\e'\002\345\025A\260f~\007;\353\025\325\375\330P\315\340Y\341-\320\227\332&4\025\020\343\207\217\1773\230\2665\342\t\301\fM~@\r\2252"
+	.string	"pxt9\251\232\321\026+\201p$\255\332\221\217`M\002\231%\274\023\354\227\231\215\203:\351\3601Xe\345\3435\271W\227}V\313&\214\367\251|\361D\004\214_{-\202\231[cW\203\232\3636c\341D:\376.L6\232$\002\247\332\207\313 q;\013A\343f\001\306( \330\020\351\002`\367\3217G\351\336Q\205\372\212'\027zx\260\026Q\rj\036\235\344@%\300\361\033\331\251}\210\311Q\261\0335\b\204L\342\254\203\344zO0\304\200\0307\220\030\263\303\321\016\\\200\032\343c\003\347\221KRx\305\230\027Kh:FE\205Dm\260b\275\273d\006\276\337\376\366l\253\316\353j\253Z\025z\302\262M\\'/\026\036\212VD\222\245r\034 \235\241\215;\376S\341\254\021y\257u\b\235"
+	.ascii	"9BR\251E\355\034g\267\214s\203jt\242.\234\030\332\031H\375\370"
+	.ascii	"x\364v!\033\\\315\263\262/\020\303\r\371\307\016\310\243\206"
+	.ascii	"\257\342oo\t\320\301\003\237\021\222\017\035\352\367,\2613\372"
+	.ascii	")-0s\013[\223\021\275\004tR\267l\034\274\215\2437\371~p\f%\340"
+	.ascii	"1h\314B\242v\373\273}F\220R\340\006\224b\215S\325\327\352\003"
+	.ascii	"\240\310\204\b\034\362P\3634\201\n#\255\256\007\353I\240\374"
+	.ascii	"u"
+	.string	"\b\214\214\020\241\242\021r\361\222\025K4\314\303\250\376\254\315\367>\026dp\0245\350\002\026YEG\351\2049\311\304\311\331,3\354\333\362X\233\303\033+\206\222\256G\2432\247\001\330\354\311t\336\376\220\202b\030\262\024\270h\207fg}\256\325\266\206\216\001\223,a\303K\037t\t\331\237\312\301]*kp\033\362Q;\263\351\357\247X\227>\017g\030Z$DV=g\344\022\313\365\002%0L\260\223\243Y\ti(\254\300\304\312{\361j0\022\032\375\023s\220\320`S\307\250\005uFR\213@\220\254\035$(HP\no/k\340\214s\262(\306\302r\373\264\321&\311\023K?B\005*\350\301\020\322W\020\376\f\310\026[q\\\025\r\306\027\377\273\004.Gp\317TR\\\374\251\005.\034\336x\244\201x\212`\006\305y\007\332\33663 \211>\347\245&\274\026\344\372&\241\335\273\365\240*\303{\247\005\232"
+	.string	"\022z\020'\242\240*x\001\016\344\202\203%\366\267bX\177\330C\247"
+	.string	"\205\273=\005I\264\354\330\277z\236\f%tT\b\270\"\377cx\031R\005\205\240\204\277\216*:\354@\211k3\341i\367\373m\204\206(\265\026\033J\232p\276\242\300A"
+	.ascii	"\377k\217U\005\204~\n'\256x\334\031\244\366\366^Q\254|\345(\251"
+	.ascii	"\203\fk\300\003\210\227\020\205\346#A\350`\277\313aV\240\273"
+	.ascii	"\334\342v\013"
+	.string	"~\313\200\213\377\257e\234\323Z\263\356\360N\315\244{\362\200\233\b\370\003Z\331\203%+\255*\227\333VSQ\220\267\026\375_\026\211\177l\254 {\310\025\220i\230\252\331\301+\246\034<L\310\264\366\020\0218LIL\237\256h082\f\346\253s[g\314\322\b\030y]\036\322\016\260\250\236\216\f\227\017\004\220\205\\\322\fq\234{\217\264lqa\250\320\327\326n\257G\313U\203\233\361CC\376\037\301pjzt\362\263\3602\257-\275~\007g\007\326B\364\016\263&\261\350\313\022354\2319u\206\320\277s\327\371!\264f\370\032\274\223\303\013\352`\032\237\201b@q5\271\221\331\344\f)\251}\205\301\260c\204'\\\302([q`y\256i)3\230\f\324\257\265\343\252\303\213J\025e\300t\331\231\371\t\305\034\0027\303`\331\227`a[\024\241\026\370L\377\020b.o*R\374\252\305i(\345\250"
+	.string	"\277>\243\245\321_\241\323A\341Rt\357a\035\313W6\221\202,\032\\5\336j7\255M\350zy\351\036`\314$\023\305\357Dua\360\001\023\361\322\221J\031\005"
+	.string	"\246\3169\345\221\353\210='>\317\033\177\001\334GU\365\274\341\006(\237\n\027~CY\257\274\254D\230\345C\240\200\235\374\210Y\ry\200\267\\#\362\303\r\255\222\216\226T\2511_\241.`M>\333\342\177W\326\032\263\2627\227\006\373\213\362R\302E\007\221%Bm\315\262f\324\"'j\201U_\002\032\332\265\332;\037\263:\232\322\353\377\020\374^\203Qt\252j\300\027\361\362\177\324J\341/\r\360\022?/\310\"\032\234\022X\233H\324\370\305\323\340W\034\325\326L\033e,R\325\234\034\n\324\232\234N\215\341\030R60\340\352P\365\336\267\350F\344\232b)!\310IO\276\t\201[\035\273\272%\247-\345\201G\347b\\\370\351\322\341\244\2633U"
+	.ascii	"\177\367YC\207~\215\303\260\374f\212n\347\3719\237\371\026\271"
+	.ascii	"\220\233\223|\013\220\364\317#1\345}\031\222\201\337\344!92\247"
+	.ascii	"e]\327`\260\304\206\312\022\3437\300\212\205A\367\353\357n\027"
+	.ascii	"F\357r\302\300\234\326:\267;4nb\335\225\003M\336L\001\346\024"
+	.ascii	"U(\317\n\270\212M\2064"
+	.string	""
+	.string	"$\303\231\333]g\2757v\364\203:\007\"\027\271\305[\266\020\270\264\255\240q\276\207\336\"\022\211\266\033\231\206s\327\213\364\367\247\307 \213\263\277\325\351\311\b\021=\314k\275\032\325U\320\314D\240J\2608\227\347\r\323E\023\314\211\bN,\327\026\334{\330\005\020\372\373\206\f{\204g\324\367\221\346\036\207\216\364t\273:c\001\037\316\314\270*\206\037G\326\212v\207\253\333\203xSdM\341\337{I\225j3\302\354\303\377]Y\323+\355\221VT\003\276R\350D*\032e\315\310\3061,g8E\306T\215/\337\253\0230\374\325\241\371\"\322\333\001\324\2667\023\300k\203\007\320\001\034\f\177^kgs}a$=\340\026VS\003"
+	.ascii	"\261j\331\304[\224\373\261\215\244\325\331T\362\377\240'.z*\366"
+	.ascii	"[\204\t@\306KK\213yv\002\217bm\336r\241\200k?\331\216\031b\331"
+	.ascii	"\363\022\245@\f\032\253u\222X\217\305\250\335=be\326 \323d\363"
+	.ascii	"\261?r\360\323\271\323\347\366\333\234/\013p\340\0364k\314\372"
+	.ascii	"A\3151\377\215\236\216w\332%\323\355\241\200w\r\177wx6\230\177"
+	.ascii	"\311\344N\2141\225\245\217\250\371\035\003\f\235d\314\323\311"
+	.ascii	"\002\301\301\366\3118\037 \311(\3268\246\006+&e\227\252\363\276"
+	.ascii	"RZ\007\340i;M\266d\224o\340\316\007\355\033\217\341\317\016\211"
+	.ascii	"\210\005o\r`\371z`\025\332\305\357F9_\247\223A\362\005\232\271"
+	.ascii	"\016\301\222\274\205\"\301\300\372\317\212Oh\362\330\222\225"
+	.ascii	"\2776\024\030bN\222\210\205\302q\350\327\001d\200\233\235.)P"
+	.ascii	"\220/@\001\001\276\222;\252\242\272\337\364\242\233_z\003\"\256"
+	.ascii	".\313\355\226d\377\317\322y\240\315\256\001\226md^L\220\243\204"
+	.ascii	"\024\312.\352\035\340\007\370c\313\273\235\360\221\2427\277\021"
+	.ascii	"DwY\273.\342\004tg\244\017\264\355\260S\326GB\203\362=94\204"
+	.ascii	"\362\223m\367\r(c\364o\345\3005>\336F!Dq\207\030&!SB\325\371"
+	.ascii	"\332\332Ei\363\326hD(\201\235v&\204\332FQ>\366\351v$\204g^,q"
+	.ascii	"e[\375t@n&\260\035(R\300\n\024\\\3772T\202\025\323\277;#\355"
+	.ascii	"\032?\b\376\311\3408i\006s\362\361#\363\352\347\237\264\177\313"
+	.ascii	"J\303r\223@\330*z\264$(\273@\260\344\254\205y\303~\225R\261\260"
+	.ascii	"\232t\253\037M\363n\254\250\266O\ru\324\001c\363\210<7\024-\327"
+	.ascii	"5\352\323\243C\344\342\335\266\177\333\022\244k\255^H\033)\267"
+	.string	"b@\261\262n\332\301\257v\317:+\213ri\326R\335T\037\354\0051}WfV\221\200\032\224bb\256%\331\346xE\016\312L\341\006\204\242K\373\227\273\016K\036\347<\341\025l;o\237\2449\357s\026\2211\345\201\221\026d\032E\262\275\333=/f\032\034\004\0340\271i\2310\372,\356\r\222\005_:\342H\301\255}\263\270\242\350}#\003\260Z\026\r\324\377\267{\212\244f\b\375\317\327\266\037%\377?\374\245\275\230\255\274\205\341\216p\t\361\033\220J\310k\307@\204-\177u\336\227ra\206\032\364\222;\306\231\366\333M\255\236\206\333D.\004*\330\211\372\336\2143\005\275XD{\301\340\003\035\232v\342P\230\304\216[}\300i\371\232Oh\214<W\364\302tz\321\307RP\363\350\351\334\035\251\030\210\367<\240]\205\334\2711\200\013\t\2564\357O\235\242\261`Tu\036\361<\232\210E\254M\346\023F"
+	.string	"rF\223\206\266\275\302\322\034\n$\330\366\244\303\316\325\312\r\302\327\002Y\026\231=\344\022\316l\322\345\003\265\315[\225\237\273e\363Y.\240\332O\2744\252\367n__\031\347\022\312\006\356\233\036\222]M\312\027\302"
+	.string	"\034\023\200\243\373\232\305&\233%q=a\347\343\206\366\032R|\331\266\301\231@\301\033i\252q\277C\037g\302\317\035l\034"
+	.ascii	"\322N\b\004\303\022\317W\333\367\305]\240v\\\007\216\243S\034"
+	.ascii	"\337 \313\345"
+	.string	"o\221\217\320\342\274\321\204V\335zu\2665\226Y\253\270\251d~-A\211\336\254\340\003\276y\235&\255\305C\230U\210\353\341D\3710\331\365\303\352{E\267\342\206\231\271\241\247\311\344 \333jz%lp\215\017\201)\225\237\236A\217}\247O\333\"\335R\277\352\\\025\177\273\205\030\017\2127\200\036\017\271+\221\030\254nW\022\3503\333F\312E@\007/\330\375\243Q[\245\305\206\2762\215\345V\247\254S\026@&+X\2259/x\250\252\354\234\362\f\r\301lA\013F\341\262\241\215\362?\254\035\334\341S\2140\262\302\250K\361\225\310\375\301\374\2768\203\022\025\245\305\2439\350\002\355!\351\240>tm\274\232\211\352\276\305F\364W\305\260\035H&{[\332\347\277\245\257\355-,\252>\240\366\001\324\t\020\350)%\004\b\333\"\2164\317!\214\017\266\365\224\021\327\003\243J\226r8$\354\257\355S\036\021V\376d"
+	.string	"\312\263\375\fD\323\371\272\032\n\361\354f+\267\016XwE\276\204\224\214\310\367\237\340)\263\360\204\275\243,\362\273\n\034>psp9M\313\231\370\374*\2730\036\375c3\2210\004d\bxlO\\\t\356\244\r4\304di\367\314\344\366\234|\267\005\300\361F\2100l\365\017SS\336N,\270\366\354[uq\224\264\264\257\202\310\210\255\245\350\365\035.w\240\324E4#4D\270\035\037\340\305\317\017L\3427,`\342\203\337\335\263\312\231\202!\357\304T\037A\257$\363\273'\260s\362\001\227d\033\243\3634\331\240\372*<\346r\260\023\324\"F\t\t\301]"
+	.string	"\"\211m=\215\310W\274M)\266\030\257\322\2622v\\\353/V\364\022\026\\\2323\213\t\373%\251\323 \360\034d\306\374v\347\201\215\037\224\346H\276x\342\242\213\331\207\211\262>\222\233\2207r\007\262ep\246\372\301\207\001\362\314\230ur%SI\353]\222\262E\247\330g\030\341g\335\023R{I~2I\r\306{g\236\364\301^\300z\345\003\003fc\220"
+	.string	"\311\3670F\032`\274\200\337\030\262LA$x\022\221\362\336U\316\003\256\013j&\004\3375\317e\226\363\227\303H\322\241\001\351[\334 B\205\347\003G\336\252\027\354\306\2172\272\003\253rE\006E\374M\332\037\370\004\220FW\177\024W*\343\332R>PU\207\364\252i\232\257\255\275\3643\346i\326\360a\226r\231\266\342\232\255\016<+\206\313\242\262\201\241A\375\331\324\240\331\211\207\334\037\304\200{\214z\340n\330\023fT\326\323+\340\203\262Wp\bQF-\2463\304\302G*\2326\372%i\236\226J\243\201\013\364,\315\306z\004\340\300}\340}\267\355"
+	.string	"\276\320\215\313C\224\223\343\005\250\260\022EtD/\232\373\202\212?XG8\343\250\216c4I\337t"
+	.ascii	"\207B<V\221\233ta\215\264M\003\305\332k3\301\204\250R\316\263"
+	.ascii	"\214\257\216\330\203\2744Ui\275^Y\334x\341@(;\3440.\336=\225"
+	.ascii	"\244]j{\306\336\240vi\335q\242\243\262\tV\257\260\023\240\021"
+	.ascii	"N/%e\275/\206\221\350(\345\b\252L\216T\237`7V\224O/\267%\341"
+	.ascii	"\031d\200\032\352\265\207_\244\316\234\311e}\203\272\327\224"
+	.ascii	"\236v\236!\017\034\313}\3553\276\\\323n?&.B\3616*\261P\355\020"
+	.ascii	"Q\217?;\334\036\035\260\021\245\350\354yM4I\303@\207\227X\301"
+	.ascii	"\r\030\346\341\256\230\360\361s4\216\1770\232`"
+	.ascii	"P\357+M\200T\006v\003n&\220\210\362\201\034\230n\231\262z\204"
+	.ascii	"F\020\312|\355 \272\035\244\320\177\037\020\205Z\\\301\017w\177"
+	.ascii	"\232\023\215\306\221\313AR)z}\301\244k=\204@\332\370\207+\232"
+	.ascii	"1\334\314|\002\330+\213\027\t\2070\261\310\324o\321O\020\245"
+	.ascii	"\365\244 \277i\031\2164*\317B\024\314\006\320\233\342\323\221"
+	.ascii	"\315\364a\276^ks\n"
+	.string	"\036\026\201\320\302l\366F\215\327\"\0175?\247*\245&_\254\2648\265\034\305\342UM\207%\351.\217\3059YV\0235\201\022\241\266|\361\351\233<rI\t\004\310\256\217\276\353RFvN\272\233Y\024\325\225R\247\227\214\3376cp=w\212\322\013\211\277\021\270*\220YK\274;!\275{\264EL\351p\354\217\027\003\325&0\341\317h\3479\330\003\226\333\312\272\023\016\321\277P\277\240\357\th\271\321\354\023\334\234\356\222\302\307\361\307\302\226\305\\\332k\321\366\177\371n}-\344T4\002\231l\3109\304 \256m/O)F\222\177C~\241%\273\024\325J\216\352\304d3\205\263\235\373\f\332\261\034\315\335$\243\312(x\n\273\347\353\213e\030z\n\360\370\0161|<\325\377\304\373\024\007\264\351\355K\305O2\305\316\352\345\001\247\327\230\374^\267~w\342\223\254n\362\373Ki<T\311Z?\317\204\366\317Y"
+	.string	"\350\201\354+Nv\314\353\021\271x\241\244\373\251\365\375\366&\302{\027\262\371\340\336`\300\017\242\317\005\315?\230d\224~.\177\377\240\354;S\177\037G\377\301~\220\321\003\304\236"
+	.string	"\307\370\321\330\035\244\271\320\372\227t/\343\217s\341\215\003\272\241r\365\253\016g"
+	.string	"\256\222\262\233\337\307]\215\336\304\261\351\224+\244\377\264\223\007\243}\373\006=?\353\374>;\306\374S#\277\365\274s~Rs\206c\334\373\035\327\2461\2748\2155\374\277\267Y;\177\231\340~\235\3769\271\275cyt\202\257\3534\253\204\311\017\317\241\223\313A\355I\361\373\215\303\266\266v\203\217\311\006(_C\3423\244\332jtp\257Y\355\2603\331\r\216/\227\025n\266\255]S\034\034\256\372\270\364\331\373L\243\263\373\247\243\320X\007\360\254P\314\262\220\347\354\024\322-C;\314\213\364\343^\273#s}>\365z!\332q\265~\336\334\"g\227=\365_1~\355\003\315\257\275b\224\332*"
+	.ascii	"_\033\254|?\270\270@\377\3556u\f\212\215\236`ot\301<\266\214"
+	.ascii	"o\353\337b\311x\300\357\235\035\247\323\210r\033\024wS\366\370"
+	.ascii	"G\327\207\334dH\005?\3572\202wyGk\t\347\335\277\350z+\177\276"
+	.ascii	"\224\240\227\243\020\307\322\372\031\241\334e\322}i\265=\001"
+	.ascii	"gD\314\345\340\257\037\023\306\022\367\314\327\233!\313\307\335"
+	.ascii	"\273\337'\202z\205\350b\261\373\302\276Xv%y\227O\036\214\377"
+	.ascii	"\323\224C\377\241<\326?\335^\366\250x\323_\335v\220\362\213\367"
+	.ascii	"- |=\226^w8\320\217\302\370\275\361\022\022VB;\201\006\214\375"
+	.ascii	"\267\177\365\277BuK\244~\3767\r\331\207\300\234'*f~?\364\353"
+	.ascii	"@)\tP\376\006|\371q\305:0\326\332\031\275'\351\3624\375\355\240"
+	.ascii	"u\314\330X\277\327#\346=\311\360'\374!\367(\367\273\212\316\205"
+	.ascii	"\206\233-\307p\367\004\226\017\213\266}A\355\"\202\365\214\253"
+	.ascii	"\247\337,\356\n\273\251\323 \220\263\212\377;\017\\\357w4\350"
+	.ascii	"\247!\214\220k\234T\227=\264\376\236|aw\240\200\377\346:\256"
+	.ascii	"\371\341\215\352\036\305k\241d\252\032\026\207\375\332\205\277"
+	.ascii	"A\335\304\253\261\271\271\372\177\310\350F\352\363ba/\210\341"
+	.ascii	"^\305\324\353\256\370=`#\275L\f\201\037{\205\256xa\325\311\\"
+	.ascii	"\2557)>\260\376'\254\347\200\020\332x\212P\313\231\336\006\365"
+	.ascii	"M\252\307ml&4\025X\366\337A}\352\314I\030\217\236\226\254\370"
+	.ascii	"@ \377\207\232_W\021\265\b\240\036\242\221A\304\364\007$\257"
+	.ascii	"=4t\205L\257\r\201\270\202\256\374@\362\363\030K\316\257b-\210"
+	.ascii	"\215v\320\236\361s\270\261}M\254\357`\340\353\344\025eX\255\232"
+	.ascii	"\354\373\343\247\006p\221O\306\003\341\353\243\"\366-c\254\357"
+	.ascii	"\222[j_\"\255\232y3\026\356\310)\341_8\353\220\3733\303B\256"
+	.ascii	"N8\034\327\0263\227\231\256+|s\177?6\230\001!-\333\223/\335C"
+	.ascii	"\317\016\226\2558X\003_m\001rH\363\001\341\375\345\360F\200\331"
+	.ascii	"U\006M{T\207 \274\320\364\215[\372\214\207\356Y\346\tE\306\305"
+	.ascii	"n\207k\036f\362=D\232\224{P<]\301\364\227\276\353\251\256\361"
+	.ascii	"\302w\313Oy\035\202\005#}i7\346@\301\031\022\301\373\007"
+	.text
+	.section	.gnu.lto_.symtab.999bf63f7ce1f656,"e",@progbits
+	.string	"mspGetCommandStats"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\006"
+	.string	""
+	.string	"mspResetCommandStats"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\006"
+	.string	""
+	.string	"mspFcProcessCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\006"
+	.string	""
+	.string	"mspSerialProcessStreamSchedule"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\005"
+	.string	""
+	.string	"mspFcProcessReply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\007"
+	.string	""
+	.string	"mspFcInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\007"
+	.string	""
+	.string	"specialColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\007"
+	.string	""
+	.string	"modeColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\007"
+	.string	""
+	.string	"colors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\007"
+	.string	""
+	.string	"inputSource_e"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\007"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\007"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\007"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\005"
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\005"
+	.string	""
+	.string	"buildTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\005"
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\005"
+	.string	""
+	.string	"rssi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\005"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\005"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\005"
+	.string	""
+	.string	"supportedVoltageMeterCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\005"
+	.string	""
+	.string	"voltageMeterIds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\005"
+	.string	""
+	.string	"supportedCurrentMeterCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\005"
+	.string	""
+	.string	"currentMeterIds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\005"
+	.string	""
+	.string	"voltageMeterADCtoIDMap"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	"voltageSensorADCConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\006"
+	.string	""
+	.string	"currentSensorADCConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\006"
+	.string	""
+	.string	"currentSensorVirtualConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\006"
+	.string	""
+	.string	"GPS_home"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\006"
+	.string	""
+	.string	"GPS_hold"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\005"
+	.string	""
+	.string	"AltHold"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\006"
+	.string	""
+	.string	"averageSystemLoadPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\006"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\006"
+	.string	""
+	.string	"mag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\006"
+	.string	""
+	.string	"pilotConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\005"
+	.string	""
+	.string	"servo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\005"
+	.string	""
+	.string	"servoParams_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\006"
+	.string	""
+	.string	"customServoMixers_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\006"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\006"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\006"
+	.string	""
+	.string	"rxRuntimeConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\006"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\006"
+	.string	""
+	.string	"boardAlignment_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\006"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\006"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\006"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\006"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\006"
+	.string	""
+	.string	"adjustmentRanges_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\006"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\006"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\006"
+	.string	""
+	.string	"gpsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\006"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\006"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\006"
+	.string	""
+	.string	"GPS_distanceToHome"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\006"
+	.string	""
+	.string	"GPS_directionToHome"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\006"
+	.string	""
+	.string	"GPS_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\006"
+	.string	""
+	.string	"GPS_numCh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\006"
+	.string	""
+	.string	"GPS_svinfo_chn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\006"
+	.string	""
+	.string	"GPS_svinfo_svid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\006"
+	.string	""
+	.string	"GPS_svinfo_quality"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\006"
+	.string	""
+	.string	"GPS_svinfo_cno"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\006"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\006"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\006"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\005"
+	.string	""
+	.string	"failsafeConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\006"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\006"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\006"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\006"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\006"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\006"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\006"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\006"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\006"
+	.string	""
+	.string	"valueTableEntryCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\006"
+	.string	""
+	.string	"valueTable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\006"
+	.string	""
+	.string	"lookupTables"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\006"
+	.string	""
+	.string	"serializeBoxNameFn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\005"
+	.string	""
+	.string	"serializeBoxPermanentIdFn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\005"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\006"
+	.string	""
+	.string	"magHold"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\006"
+	.string	""
+	.string	"motor_disarmed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\006"
+	.string	""
+	.string	"nav_mode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\006"
+	.string	""
+	.string	"sbufWriteU32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\007"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\007"
+	.string	""
+	.string	"sbufWriteU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\007"
+	.string	""
+	.string	"currentMeterRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\007"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\007"
+	.string	""
+	.string	"voltageMeterRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\007"
+	.string	""
+	.string	"getBatteryState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\007"
+	.string	""
+	.string	"getAmperage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\007"
+	.string	""
+	.string	"getMAhDrawn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\007"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\007"
+	.string	""
+	.string	"getBatteryCellCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\007"
+	.string	""
+	.string	"featureMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\007"
+	.string	""
+	.string	"sbufWriteData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\007"
+	.string	""
+	.string	"systemReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\007"
+	.string	""
+	.string	"stopPwmAllMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\007"
+	.string	""
+	.string	"sbufReadU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\007"
+	.string	""
+	.string	"sbufReadU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\007"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\007"
+	.string	""
+	.string	"blackboxGetRateDenom"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\007"
+	.string	""
+	.string	"blackboxGetRateNum"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\007"
+	.string	""
+	.string	"serialIsPortAvailable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\007"
+	.string	""
+	.string	"findBoxByBoxId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\007"
+	.string	""
+	.string	"getEstimatedVario"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\007"
+	.string	""
+	.string	"getEstimatedAltitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\007"
+	.string	""
+	.string	"convertMotorToExternal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\007"
+	.string	""
+	.string	"pwmGetMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\007"
+	.string	""
+	.string	"gyroRateDps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\007"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\007"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\007"
+	.string	""
+	.string	"getCurrentPidProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\007"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\007"
+	.string	""
+	.string	"getTaskDeltaTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\007"
+	.string	""
+	.string	"packFlightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\007"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\007"
+	.string	""
+	.string	"getValueSize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\007"
+	.string	""
+	.string	"getValuePointer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\007"
+	.string	""
+	.string	"serializeBoxReply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\007"
+	.string	""
+	.string	"sbufAdvance"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\007"
+	.string	""
+	.string	"pidChangeProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\007"
+	.string	""
+	.string	"activateConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\007"
+	.string	""
+	.string	"gyroInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\007"
+	.string	""
+	.string	"validateAndFixGyroConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\007"
+	.string	""
+	.string	"sbufReadData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\007"
+	.string	""
+	.string	"serialFindPortConfiguration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\b"
+	.string	""
+	.string	"featureSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\b"
+	.string	""
+	.string	"sbufReadU32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\b"
+	.string	""
+	.string	"featureClearAll"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\b"
+	.string	""
+	.string	"GPS_set_next_wp"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\b"
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\b"
+	.string	""
+	.string	"blackboxCalculatePDenom"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\b"
+	.string	""
+	.string	"blackboxMayEditConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\b"
+	.string	""
+	.string	"readEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\b"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\b"
+	.string	""
+	.string	"accSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\b"
+	.string	""
+	.string	"resetEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\b"
+	.string	""
+	.string	"pidInitConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\b"
+	.string	""
+	.string	"resetPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\b"
+	.string	""
+	.string	"loadCustomServoMixer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\b"
+	.string	""
+	.string	"convertExternalToMotor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\b"
+	.string	""
+	.string	"generateRateCurves"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\b"
+	.string	""
+	.string	"generateThrottleCurve"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\b"
+	.string	""
+	.string	"useRcControlsConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\b"
+	.string	""
+	.string	"findBoxByPermanentId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\b"
+	.string	""
+	.string	"rxMspFrameReceive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\b"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\b"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\b"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\b"
+	.string	""
+	.string	"setTaskEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\b"
+	.string	""
+	.string	"mspSerialPushPackets"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\b"
+	.string	""
+	.string	"sbufSwitchToReader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\b"
+	.string	""
+	.string	"initActiveBoxIds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\b"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.999bf63f7ce1f656,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,866 @@
+	.file	"fc_msp_box.c"
+	.section	.gnu.lto_.profile.1616dac311cd3018,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\007"
+	.text
+	.section	.gnu.lto_.icf.1616dac311cd3018,"e",@progbits
+	.string	"(\265/\375 \236=\004"
+	.string	"\202\007\035(\200k\206\003\355\313\034\203\211"
+	.string	"\030R\230\321\377\331\343\36015\f\2046b\310\204L\310\204LA=2\322KzIK[\006\235\262\315\233V\304\026\016\216\212\307\345\362hhIa\004\007\005 \336\373\374\316_=_ 3e\357K\021\004\006\211:g\3216P\207\017\023\225\207!V\335\205Qx\2349hh\234\336\227\272\357\272\236\262\315\233\260\326\204\242IJ\225\020\006"
+	.ascii	"pa\345V\277\322#n\201\322\024d\003m"
+	.text
+	.section	.gnu.lto_.ipa_sra.1616dac311cd3018,"e",@progbits
+	.string	"(\265/\375`N"
+	.string	"-\004"
+	.string	"\302\204\f\022\260%\351\f\303(\207\301\037\242\265F6i\215l\231R\226y\346fb\337]\035r}m\203P\364\265\030\2017\241\232\350\225M,\027\214y\333,9 ( \360\202\251Y\017 \200\247C\3300r\275\022#\"@\200\205\223%\234/A\302\\\230\310\f\212B"
+	.ascii	"\367\032VF\026A\007X\356\305A\230\354\b\204\002X\314f*\200=\201"
+	.ascii	"\b\bR\270\313\227\362l\013\004\037M\016N\214\007\330\0300\340"
+	.ascii	"\302\f\001"
+	.text
+	.section	.gnu.lto_.inline.1616dac311cd3018,"e",@progbits
+	.string	"(\265/\375`\275\002\035\n"
+	.string	"rM-2Pm\222\016P$\275@\315\013\021\234I\213\265LZ\026\215lP\310\340a\274\226N\257\236>v\334\254\214\200\210\231\245\225\345\"\217\336\270Y\373do\231\002\177\237\265\226\265\211\350\027p\003\2033\202p\337\rR\200\210H\254!Y:\266_\326Q\367\300\341\341d(\f\205 \252fH\322@\307}\t(\263\326/f}\242\337\034I\305I\211\201\205:\317'\302\244\340\312\2545\361)\2325\326\356\017\300__B\327\0078\300\265\275\nh\221\231\323\024\207\3505\347\321\251@\002\367\325\334G\247\002M\337\254}Y\177\230\313\314\214\236!3\033\376\276\031\f\311\314\312K\343E: P\"R\214\262\003\211\r\350a\001\200\032X\\\220\tv\232#\241\022\023\222\301p\017\3147\240p\227\220\201\3248<\334>\235\330\202e\022\340AG\3010,\223\200\007\257\020\301\333A\351\301c\027&\006"
+	.ascii	"\274\240r\300\347AO\006P%hG\320\255\023\326\201\f\177\033w\n"
+	.ascii	"\266\315h\356\2014\016\3253\211\212{\365Q\036\037\330\212\003"
+	.ascii	"m\347\367\334\313N\t\023\223\221\221\005\267\250\321u\013D\263"
+	.ascii	"C\022,w\003\350\336\026\233\013\340\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1616dac311cd3018,"e",@progbits
+	.string	"(\265/\375`\322\006\335\r"
+	.string	"&P3.pGI\007\251\n\036\002\216\217"
+	.string	"\252\211\001UU\205oH\376\247\355\252R\356/\333\220\n\374\345?\360\237\211|\340\377\376\200\264\335v\223i\007$"
+	.string	"#"
+	.string	"."
+	.ascii	"\267h\023_I\201U\257\350{\212,\313\262\357.\274\366\344{\262"
+	.ascii	"\337\247\030\2721\364!\032a\325\373\327nB\b\005\367#\300\273"
+	.ascii	"f\365\356S\2007yo\262w\312\350T\257E\027\370\243\351\316\376"
+	.ascii	"\234\303\371\024\262wW\361\032\324dRU\b\204Db\261`X\245\222\311"
+	.ascii	"XVk\210\fF\243\321\260\206=\220\255\303\361x@ \221\210e].\030"
+	.ascii	"\f~\360\240{\347\r>\2273\334\360&\021\233h\373\324-\034p\336"
+	.ascii	"\rZ\243)\205\202a\210\355\267\231\323t\302m\024I\322\037\016"
+	.ascii	"T\200\216\250A\315#)(I\241\260\314\001\360\"\021*\322\001\022"
+	.ascii	" Q+\206\202)\243\020!\204\b\t!\2422a^\256s\361zZ\335,p\300R\305"
+	.ascii	"\036\263\360\202hh\204F9\341\367\220\214\266\302\350\027\341"
+	.ascii	"\306\273I\274v&\371\313\302\003\314\234\231\023\373Y\326\244"
+	.ascii	"\266K\2404#3\303\fo\350\3752\221\321G\023\266\257\003\224\t\212"
+	.ascii	"\241\236\331H%\207S\355%\262<\253\273w\233\367#\271*\273hqJ\f"
+	.ascii	"#M\026T\3665\355\376C\262&\003}\346\026\354\210-\250W\t\n'\\"
+	.ascii	"\b\216\3374\360U\252pq\266\264\274\361\233`\244\237<\351\300"
+	.ascii	"\317\367#\2320)\020\304\b:\003\232Ln9\350\003K\312\347a\325u"
+	.ascii	"1\275|}\3134}\265Eb\246\300Sf\351u\216f\362\351+[\005\306\350"
+	.ascii	"\211P\302\207\007%\201\376rY\025\200\024"
+	.text
+	.section	.gnu.lto_.pureconst.1616dac311cd3018,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\230\004\002\200\004\004\200\004\005\231\004\006\231\004\007"
+	.ascii	"\270\004\b\270\004\013\270\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.1616dac311cd3018,"e",@progbits
+	.string	"(\265/\375 \253E\003"
+	.string	"\222\305\021\034\2407\303\001\240x\253@u\266\377\365\357\002\272&\241\354\b\245\b\322&\273\255I\231\002\007\006\004\300y\353\320\266\205\377\375I\323\366\371c\270\360)2\021\201\022\027GZG\353m#\334\n\367\253y\214\005\343i\364\033\002\r"
+	.string	"\273\300M\205\201\200\323\240b\205\233\237\355\200\n\3061+'\330e_\220\t(x"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_.lto.1616dac311cd3018,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_boxes.43.1616dac311cd3018,"e",@progbits
+	.string	"(\265/\375`\214\b\225("
+	.string	"jM(\021:@\254I\007\003c6\370\307K\270\245\272\225133\342\311\230k&\364Jj\336H\247\355\031B\225\334\313n\237HH\033\361W\371&\013\f\243U\201\023*gm\221\375\321o)\311\377"
+	.string	"\003\001"
+	.string	"\001\333M\235R\363\267\026/;V\260 \224\366Q\333C\211Rs8\266Pv\274\200\001'\355\236\266s\352\244\346p\255\327e\307\f\032\354i\317\264}\017S\231\307\261n\331q\003\007z\332+m\327\243T\346q-\235\354\330\301\203G\332#m\177\004\251\314\347V\220\253\253\311\216\037"
+	.ascii	"\361\2643\332\216\227\307\302\347\314\310\325\275d\307@\b\207"
+	.string	"\264'\332~\b\221\013\247ca\220\253G\311\216!D \244\275\320vBw1\234\256\225A\256<\262\343\bA;\355\201\266\333\001:\363:vFv\034\224\360G\373\334\366?rg^\327\246\310\216%Lx\323\036\267\375\r\356\314\355X4r\005\313\216'Ph\323\276g{\233\036\033n\327\246\221\253\206\354\230\202\003}Z>\307^G\373\235\355ut\354X\260F\344\207\b\307\327\355\250a\261\265)b3\265\266\266\272\021\307=\310\365\263\343\n\016\3649\276\276\346\336+\273\201\3128\260\244\262c\237\003}Zr\372\351\366\313\315\235\034\332M\331\361\225\003\343\364\373\331\037\327\347\354\300\352e\307\344o\217~\267\375{\370\234\035\332\274\354\370\207uG\177\236\375w\360\224y`\357\262c\254,9\372\351\354\2273\247\314C+\227\035g\001h\243\377\315\3766n\312>\350\311\216\001\004@\243_\315~4i\324>\264s\262\343"
+	.string	"\002\306\350/\263\177\f\0315\020\354\232\354X\300"
+	.ascii	"/\372\301\354\367\362E\rD;&;\036@ \213\376-\373\263h9C\260(\271"
+	.ascii	"\276\226\354\230@\0016\375V\366\263U!\013\361T\262\343\002\006"
+	.ascii	"\242\350\237\262?\212\2242\021\277$;6p\200\211~'\373\2314)!\242"
+	.ascii	"U\311\325Se\307\007\020\034\321\237d\377\021$&\334\215=A\256"
+	.ascii	"\356);F\240\265\352'\262\177\035B\346n\355^v\254\225\340}\350"
+	.ascii	"\007\262\337\307\377 \3637V\005\271\272\244\3548\201\002S\332"
+	.ascii	"Q\005/\2044b\2608\023\232\335H\023n9\270h5\\\334\020\342@C\273"
+	.ascii	"!\314\272gZ\232\251\330\325u<\236\307\371\270\233\367q?N\347"
+	.ascii	"u.\310\007\271!o]\221/\362F\356\310%\371$\267\344\227\\\223o"
+	.ascii	"\362O\016\312Iy)O\365k\037\344\205|\2217\362J~\311?y(\317>\225"
+	.ascii	"\277\362X\236\313w\3710/\346\315\374\231_\363l\036\316\307\371"
+	.ascii	":o\347\333^\317\277=\334\377\341\360uo\367\203\236\320\267\177"
+	.ascii	"\350\027=\336;\372G?\351\365\376\322\206\327\304\325#\217\225"
+	.ascii	"\336\357\351\317\264\177\017Sq\213=\223\035_\007R\322oi?\245"
+	.ascii	"Jd[U`\262c\177H\372%\355\207\024\351\024\262UW\262\343w\240O"
+	.ascii	"+O\177\243\375y\214Ja\353E\256US\262\343*+D\372\025\355G\224"
+	.ascii	"\310\334\300\022\311\265\252Hvl\205\357\364\033\332\177W\250"
+	.ascii	"\270\241%A\256UA\262c\354\003\244_\320~@\001\367LK\253\353\273"
+	.ascii	"ah\212b\212\202\221\027M\313.|\311\216\305\2612%\006\213\307"
+	.ascii	"\2602\300%\226\247\3255\315\364\353wG\f\313ai\202\221\267\253"
+	.ascii	"<\252\304bz<K/\362\232\347\320\210\202\005U1\342\357\232H\301"
+	.ascii	"\216\252Z\212\375nj\212\231f\327\325EQ\236'P\343\3204^]\365\b"
+	.ascii	"F,\032\215\344\355*\032K/\337M\321\260\324\034C\211\277{B\r\016"
+	.ascii	"Ut\300%K\217\346i\032\315#\3265\303L\034\211\276\233\226a\250"
+	.ascii	"\352\273\0314p\241c\251\251^\335\3375\277J\325X,\277~\327\034"
+	.ascii	"\242g0-\226\277;\344\n\232\306\256R-\016\263.\212\342\0314\215"
+	.ascii	"\304\26028&\366%\340^H\303\300\025\302B\320T\313\324\f\242@\273"
+	.ascii	"Hx\225\306\256\0047\203\006\256\240\021M\217a\250W\260L\315\263"
+	.ascii	"\364*p\325\024=\242g\320TSs\314L\203G\024L\035j]\263\255\034"
+	.ascii	"h-V\324H;[a\366Bh\026\200\232\250\021\360\004\006b\243\221\005"
+	.ascii	"E\345$\351p\223DI\007\020\030\350\220\004\3226\003\200\030\224"
+	.ascii	"b\242.\350\325\3669\035R\210=p7\r\241$\351\005\311mW\314\312"
+	.ascii	"\330r\275\363`\305\322\021\215u\350\355\263z\3561\035\256u\301"
+	.ascii	"Q\375{\035\274\330\235\004\325\362\307\351w\025\214fL\330\036"
+	.ascii	"\315h\303l\3526\f\247\365R@;\0320\237\272\001`g;,4`>\2745\255"
+	.ascii	"~J\223\310\322\252\245h&\331\351\206+\365\261N8\334\001\032L"
+	.ascii	"\331\267\211e\311J\026\310K\375\233M\0312I7\300\332\263\0324"
+	.ascii	"\363#\355\253\033\306\306t}\254\265\237`\370\375\032\312\212"
+	.ascii	"\244\376ub?\267-U\343\214\221\350\310\237\263'"
+	.text
+	.section	.gnu.lto_findBoxByBoxId.45.1616dac311cd3018,"e",@progbits
+	.string	"(\265/\375`2\002u\023"
+	.string	"\206\245\203H\3200'\035\332\t\242\332\362"
+	.string	"\025\370\275LJ\336\355eU\376@\360L\322\023\224(\021\234u\302Y\304`\3629\256}k]\325\336\033W\251\374\216v\224zQ\341\211\020\272|@\313H,V\241\203\211\331E\b!{\313\235Ro"
+	.string	"f"
+	.string	"q"
+	.string	"/q\0231~\r\020wn\274\321\247\246\210\252V1\264x\001\335\351\367"
+	.string	"\335\351\202\260\307\247xw\362u\257\243s\345\313\207\335\233\317\005\3358h53\302\316M\350\266\031\331\211\3009\235\220\003%\243m\370\234\020N"
+	.string	"\361p\3200\314%\302\345\216\273\234\321bro\273Tb\032\241\214h8\227^H\255\325RF\273\271\277\333\246\331~`K\n\001:6\370]\374\275\337nj\351\371\361\336)-W\372"
+	.ascii	"\032DQIu\340j\325Pe\243\306\240K>\277\375\343\245}\373E>"
+	.string	"\316+\377\366z\245\261\001g\243\320\202\357D\276\315\253\361\343\203\331|FOAQ\265\212\006N\235\340;\275\035c\257lKi\177\350(b.^0X\253\207\243\244ZE\004.\360\235\022\230\001<tk>\320O\317\322\005w\346\016\0229\236\2715{+\3275\312\210\311\032\376\312}\315\rW\270\222\nuj\242\2525\306 \251\265\2025\001\2658\322\253;\375R\247&\032Cg\361\362\270\3146\314W\264\016\354\324\032s\240\342F\026\346C\234\272\345\245\273\354\324\177\351N\351\036\367\311\224\223\223\341\310\310\252\235\262\215X\332\255\331\"L~H}p\341\r'.$&)&+$,0\345&\022`Z%\324,\020\230V\311\bK\213\312\b\013%d\241\204+)$*!\313\325\022\202t\270\305r\342\n]Z-W\270r\375\352\370).\3624\204C\352~\364\343\016\002\375\364Lp\347\\\207\310\354\314\013okV"
+	.string	"\203~K\205\244g\036\237\032g\304d\215\317Zk\355\266\366\217n\367\333\333.\302!\007\211\246\303\214\254\222\233\313\300\024' @\002\203\034\334\r\035B<\271\221\252m%\362\324\311u\004\003\\<i\321\262\354b\263\353\242\336i\205F\362\007\273\005b\004\240/rDh\265F#\340F-\242\273\023\355\002#{"
+	.ascii	"+\323\211\232\215\255\272\201Y\022p\234nK\306\353\251\273\241"
+	.ascii	"\b\314\312\312\004GLY\363\271WK\237"
+	.text
+	.section	.gnu.lto_findBoxByPermanentId.46.1616dac311cd3018,"e",@progbits
+	.string	"(\265/\375`'\002}\023"
+	.string	"&\245\203I\300\020)\035\330\251d\033\212\235\271R\006\fz8\305x_U\241\310&o\2218#\024\004\221\322\314\323\275\026\363\r\273\276\216\251\312j\247@\332\227\376'\333\246r\357\332\036\233\343I\3213\210+\304\221\200x\323\b!{\313\235Ro"
+	.string	"f"
+	.string	"r"
+	.string	"#Nbf\232\200\361F&\334\375\300\370@\325:\256<>"
+	.string	"x*\036"
+	.ascii	"x\272\035\334\3619\336\240\244=\004\351\\I\363k\017\347\177:"
+	.ascii	"\275\215\034\314tp\323\3339\317E\202 fN!\320\310\270\3454|\316"
+	.ascii	"\006%rp6r\027\346\366\370~\367]\342r6\271\347]\032\271\3305\001"
+	.ascii	"\345f.C\221Z\253\345-'s\213\267\235\263\375\300\226$\001\341"
+	.ascii	"y~\360\275{Zz\277\273\345\224~\212A\f\224\323\200_\255\031\242"
+	.ascii	"j\324\026\364\350\303{\377\356\322\276}\037\337g\225\337\243"
+	.ascii	"\275\276\304\244p;\241\020\361\243\317\263\352\324'\3363\373"
+	.ascii	"\316C\254\305\210@KA1j\035\r\234\032D<%0o\317l\225\355\225\266"
+	.ascii	"\202\005\263\363X\360\326Z\263\242\250\326\021\201\013\210\247"
+	.ascii	"\0175.2J\356\017C\022\016]\235\237\2433\264s\305\305\231C\304"
+	.ascii	"\017g\256\316\340~e\273\0276I\303\266\204\033\275\250\022\023"
+	.ascii	"T\2556\220\242\230\252\306\2243t\"\332R%\246\031<\027\242u\374"
+	.ascii	"f\273\302\203b\007nj\265\205\374\034h\302\274\207S\253\260\200"
+	.ascii	"\277\235\372,{\337g\022M\323m\246EF\355\023/\304\321\256\316"
+	.ascii	"\036k\322\303\211\003\222\327\306\026\003\256\025\226\t\212\t"
+	.ascii	"\214\325J\241\334\204d\005\346\202\261^2W\212\312\255\017\n\261"
+	.ascii	"\b%)*\257\222\326\311\252u\262\202\241\260^\253\226Le\365\301"
+	.ascii	"\341X\212K\266Z\211\305d+\225\353\327\3067\361\221%$\037\021"
+	.ascii	"x\024\277\357\251\034\235\241)\356.n-\322\262.)\302\3259\201"
+	.ascii	"\n\032.\335\221\306u\374i\007\303&i|\326Z+\370{\200r\303=\357"
+	.ascii	"#\033hX\274\004' @\002\203\234\323\035\035B4\353\034xl\241\261"
+	.ascii	"\244\356\256\303\030H\307\363\202\177\345b\213;\242\333\222\215"
+	.ascii	"\201\r\376\272\340QD\024\245\310\021\241UFv7\263\017\335\022"
+	.ascii	"r\353\235\300n\333\026\372)\336\211\260\r\264\0247h\202\r\362"
+	.ascii	"\3102<\2347j\201\211Z\031\353\210)kp\356\325\232'"
+	.text
+	.section	.gnu.lto_serializeBoxNameFn.48.1616dac311cd3018,"e",@progbits
+	.string	"(\265/\375`t"
+	.string	"\275\t"
+	.string	"\246\322C< \005)\035 a\240\030\t\030\227\005\236\215\204r\"'T\321\222\363"
+	.string	"q2\037\344\265\021\344\216\007\225g\261\334\3718\360\203"
+	.string	"\202\250\205\024\202m\004\201\036:\221\006\032!\204\020\271S\n0"
+	.string	"2"
+	.string	"2"
+	.string	"\343\013\266k\335\007\266k\016m\233\217!\373\027\315F\n\200\335\235\n\362\3602\364\177r\316\212%^r\016\273k\271bu\334z\333\b\266\027\354\023\004-\373\256?\373\370\253J\237\343`f\016dv9b\001\026\246\265\214\330~\307\266\034Q5\236K\373%7\t\357\302\270\300nKeewTpBw\315\001/0\225\212\346\310k\246\366W!\277r\307C\245\242m\360(\026\335\256\006\203\377:]t\"\250\355\332\225c\271!q\245d\314\036E\251\037\366\263\335]k\247\017\244&0B\355yN\037\350C\002G\037/4\275\320\244\020A\214\246W\002\247\307\300\037I\2424M\337W\232\235q\237\255\266\374\020\003Ki\206\003d\303\355\262\211&\270\017"
+	.ascii	"2\241%\034\030.*\210F\234\320\311\017\241\016!\210kl+\214\007"
+	.ascii	"\252\201+`n\200\212\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_serializeBoxPermanentIdFn.49.1616dac311cd3018,"e",@progbits
+	.string	"(\265/\375`j"
+	.string	"U\t"
+	.string	"6\322@7@\217\322\001C\027\206\261\251\030\373H\245\027\314r\233\236\034\032\336\247\274OUk\0203+*\037#\f\360\030B\322\261\360\211Q$\226\276D54\343\254&\261\233H\231R."
+	.string	"0"
+	.string	"0"
+	.string	"\003\231\307\355\002\231G\203\366\312\303\216\275\013\226*\201\355.\247\034\007\237\240\377\221\003\250V\247\247\266\260\273N\325J\343\326\333>\260\235`_\023\017\377,K\247\246\257i,*\005&\273\031\261\227}E\224\017\333\337\330\316\320\344\322y\332\017\271\b\370V\305\003vY)'\273!\307\b\333\243\303\007^^e\003\f=\371\232\312I\305X\342$\337\266{\241\340\273(&6\017S\346\361\252\255`@Z\250\214\331\341)u\303~\266\273ke\331o\3751%\357\243\244\317A\335uJ\336\307#\372B\236\016\304u .\002\242!\304u\243\217\353\020\330\023=\2148\222\347\215\270M\270\317VYfhy\241\324\302\232L\215j\207\002\016"
+	.ascii	"2\241\t\034X\270x\230\3366\315\256<\330`\256\261\2550\036\250"
+	.ascii	"\006\256\200\271\001*\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_serializeBoxReply.50.1616dac311cd3018,"e",@progbits
+	.string	"(\265/\375`\355\005\035&"
+	.string	"\232E8\017I\200\232U:;\364\261\006|os\350-\347\364>\177A\1778\305\223W\033\320!\200\205,y\311\237\236\373\212\217\254\032\244v\2370\004\376\177\313\236\217\226\322\357\300eF:\365\203\274\330\037\030\2272\362\322\232\026\021B\b\331;\311\334"
+	.string	"\322"
+	.string	"\342"
+	.string	"\370\311\213\247\204\253|\223\340\235t\263e97ma\345\234!\264\017\373\324\206\376v_\352L\202\237\212q\235\234\235\252\260rVB\350\006\354\323V^\200\372\224\375\216\3724\330}\346\312d\376\362I\2042\226s\306a =G\225\357\265[\034<\255\235\311\330UMk(\276\301\276\2243\b\022V<\022\235\306\243)\274\355\017\244\245\317\326\237&\244\035\227-hB\322q\026\275s\t\325\301\2149\320\013I\252\250o\375\036\035g\334\325\210\322U\264\002\023\250 "
+	.string	"\216F(v\302t\276\353\013\236\2149n\312*\275\206\372hIbr0\243\016T\307\007\231\345\237\214=.\212\332\300\214;P[\316\271=\016/~\363)\262F\232&\244\245\337\365'\347\334\267xDz\003x\367\321\356F\321\235\272\b\267\017\030\230\335. \273M\340\\\357\001\327z\013\340\331\371\324\257\363'\177"
+	.ascii	"\366v\316\251\336\265W\275iw\362\267\307\362^\325[\275S\3666"
+	.ascii	"\312\336\306\354\355{o?\301\f\352\353\306\314\371\306\363M\346"
+	.ascii	"\222f\021\271\326\317\365c\371\251\376\252\337\352j\367\373^"
+	.ascii	"\337\322\3356\213gi\005IH\230\244Xt\267W\316\325\357\3526+\210"
+	.ascii	"u\255\376\326\257\202T\356\354\026z\226\276L\255)\375f\267X\200"
+	.ascii	" \222\\\244\306xX\375\254n[\350VZ<\033\031eG\313(\261\021\247"
+	.ascii	"\322\277\352V\350Un\266\2412\037C,UI\215\211\020\352n\237\336"
+	.ascii	"3\037\345R\272\265\242\341\241\352f\033\006\310Cd\261\310\206"
+	.ascii	"n\252\033Kdd\231P\216\304rV:x\332?\335\001N\033Z\202\250\030"
+	.ascii	"\331\005\360\212\177K1\004p\001|b\234\026\3612#\322/\257\261"
+	.ascii	"\234\207\023\310\220h\211\274\240\304|\314\235-\324\247\004p"
+	.ascii	"\372\345\325f\252\310\371\260\026=/\2028\030\022\017\2229\017"
+	.ascii	")x\371\227\022\350\205<\355\234N}Q\247>\035\200\337\365\236/"
+	.ascii	"/a\230\025\216\242\373\304j\236\034\311J1\262\377[\032\037Z5"
+	.ascii	"\354\004v\024\277\t\343\213Q\214\232!\346\250a\025c\234\302!"
+	.ascii	"B\321\260\212/\006J\262!N\t\357\363JI\232tA}j\016~\363\227G\222"
+	.ascii	"\222\345\230\341u\323\265\273"
+	.string	"\342\376\026\024\275\373b\016\376\226\377\f1\321\035bF\310\304m\373M\245\341\032\276u\0311\035\323\360\327\020\343\024\335g\333\336M\265\305\3072\222N\243'\341}v+\205\027#\273\317*\021\2154v\352N\003\273\336\345\005\345v\275\335\212\234N\326\373\320\216\303\220\317\204\032\364\313\005}\220\355VdX\207|\030x0z)r\275\037\017H\343\241\310\001\241A\300\035n\235\317\220\317D\t \240\212\022\272\0238\335\t\334\212^N\005N\367\003\342|\020\264\017\210\367\303\005\371|?\\\253,:vj\253%\\\212\260\360\b\r#\2736f\306\203\253\334>jt\226\342K9;f\205\351\036\315U\013IG\256dXt\323b\244\220+L\262\035\334(Vq\372\003\325\025\363\340kI\206\335\252\231\231\253x\247\347i\3122\214\212\311\213\f#5t\231b^\255\017\363w\275\3032\212x\225\016\300\007x\356\001\254\203;"
+	.ascii	"\3567/KZ\021k#6\003\023\335\322\370\330b1\262#p\251\006p\032"
+	.ascii	"U\353\243\236\253As\316yU\005`\003\370[\327\260c\351\312\210"
+	.ascii	"I\030s\250a,\206\fb\314\004\024\314\210\b\215\246\351\200\002"
+	.ascii	"\221:\253\007\020P\310\206\222t\003\344\253\250t\343\035\024"
+	.ascii	"\230'\324\267\312\2610Np\032\362\212yyDNE\266\200\236\305\025"
+	.ascii	"\034\226\367{Q\036\367\245Z\231\032\245{\311\225}\003\371\fR"
+	.ascii	"\304\001\001P\326NG\260W\034\324\032\213l\020\270\311P#\002\376"
+	.ascii	"D \034h\246\327\310+b\b\307\016\f\335\034\344\211&P\211\214x"
+	.ascii	"\216L\315\357\032xF\021\200\352\333K8\240\005\276JXL-)\007h\245"
+	.ascii	"\023R\032\273\333\\\246E3R\334\273\031\307\334\b\032_\352A\231"
+	.ascii	"\233f\230\374\323[\\\351kOH&\374\260\233\037\3160\372\324&&\255"
+	.ascii	"\371@\020\255\30631<\341\"\024#\fOX\230\225\325\325TH\213\277"
+	.ascii	".\334u\002\374,\352Q_\363q\\$\206!\316\223\214\364\236=\262 "
+	.ascii	"\310\2566\275\227\006"
+	.text
+	.section	.gnu.lto_initActiveBoxIds.51.1616dac311cd3018,"e",@progbits
+	.string	"(\265/\375`\334\016\265:"
+	.string	"Z_p\025CPdR\007Q\352\224\347\364\375\326B\307\"`\304\301\202\311\306*tmc\267\252pE\t\245JD\255\374\\\256=\001\254\337\020"
+	.string	"\230\013!\202\026\234\237>ZXx\3133\374\306\021$\235\r\356\266\345\226)\245M\001%\001K\001\306\356;\016={\275\315\354\253\255\357}\337*\fE\312W\2507T\033\300F\2372P@*\n\352\311\351@\023\023\201%\245\244\001\002\220\216\002\030\025\021\001\030\022*\022\207\2560(\330\002\331\274\3427\266\223\271E\345\300-\271|j\315\333\033x26\365\002s.\265:\260\2634\"\004r'\216K\345>j\365\27247\317S\306\255\025\316\334\324|J\346\241\236\214I\375i\245\320\374\022\305\363\224p+f\033S\347tq\357\344]R?\260*pC\326\364<\345\334:\324\244N\324\263(\355\276\txA\352T\317\2765?&cSgz:\201\247\363\227\232\256\324\314\242\\\373\244<esmz\337\027\314\017Ps\001ji\217\364\305\217\276X\371"
+	.ascii	"U\334\250\n\225/Bs\"\264)\017@\212\017I\021Z\251\314\334\220"
+	.ascii	"y\236\362l5\302kb\307\213k\003d\337\021\317S&Y]?_p\242<\321\314"
+	.ascii	"\207fH\336=\342\302#e\037d\304\203F\234\262(\213|\353\304d\214"
+	.ascii	"\210\003=OI\004l\371\365\254\020\317>\220\277\2229^\251\252t"
+	.ascii	"|\204\313\343j$V%\351O\377\260\245\327?\360\302\373\276\375\311"
+	.ascii	"\345\2307\225wc\246\356\266\320\355n\005y\250HG\303\273\203\373"
+	.ascii	"\006\353XEt\357\370~\032\300?\n\266;\005\326{\322\3610\311G="
+	.ascii	"F\275!~\373\024{\304\302\3050yGEb\256\026~\353\335\206E\340\016"
+	.ascii	"\365g\f\342Y\262[\206\326{\262\213\322(\361\253\372\300\\\335"
+	.ascii	"P\257\307\314n_\301\242v\215\235t\217\270\3622\336\034\330o+"
+	.string	"\340w\004\237\363\206\200\277\0378\234\267P\376.\262\337D\366{\230\277\335\374-\314\337A\371;\230\277[\366\033\230\277\331\374\235\363\367\232\277q\376\376\374\355$\242\266\230\035a&\301r\240\257\330\037\240\227\232\315X\3619\3672\356p\356N_\273\275\235\214\227i\247k\341\233\321\315\347\332\247mF\017\343r\275\303\343:\037\305\b\241\355R\243\303\341\030\361\354[\353\233\340\326\376\266\303\307\350\360\327\2072\b\026U\253.h=L{\033\233Gw\270\230\251\246#\364]\226({[\353{_\250\202\326s\323\272\243[\350\331\375\331B_\363\246\321\235<Z.e0\331\026\245\372\276J\004\236\233\252\365\334P7b=\267N\304z\016\230\331\356S|M\326\034\300N\212x\353\351\205\260\307\3713Fkl\032\237\357\311\"v\251{\230\231\345\220.a\364\232\236\366P\221Ny\250\310&>&\001uHi\216\316\320\371\023\204"
+	.string	"f\366\2139\261\271F\304YOO\332R\221\230\227Vs\245\217\022f\266\207`\207\370\263D\3670|\227-\317%\203\206\r\033X\317CL!\312#\361\354$\271\255\213\335)\027\"\261$T\344\200!\261\"\002\204{\\\210\335\351\020\352\021\251\025[\036\005\005aw\356\217z\f"
+	.string	"\345g\024L\372n\017\037\336\223A\354\316\365\241z\025-\205\361\021\265M-v\347\336P\217\004\332\f\310S\365\253\"\207aH\250"
+	.ascii	"\334\245b\330\2204tlCH\304.\017$\316K\210\210\235x\311[\264\210"
+	.ascii	"\231\335z\b\026\210UD\351t\203\370\037!\332\367=B\350O>\230\210"
+	.ascii	"v4\317M\302\304{\322\004\353\031\210q[\021g\327\3775\361\223"
+	.ascii	"\216^\360\275~U$Qx\027\004\326f\310\246`\261+\265s\363S\230\333"
+	.ascii	"\214]i3\bk\t\256\353\211\025\273R,-\260\b;\344\2038\030\020 "
+	.ascii	">\201\261+]\262\353\237\214\231w\376\376>\036&\375\250\307\225"
+	.ascii	"\370JK\305d+:\344\320R\221Y\330\300Z\001c\305\f\254\254 \f\307"
+	.ascii	"\232\301\002w\226\202\034Z*R\320\250!#EV\213\252\254\026U3``"
+	.ascii	"\311\250\312\332\252Q\245 \251\265h\260\330\252\262\241\245\265"
+	.ascii	"U%\204v9vrUF\355\302^\315c}_&\026\334\351^esz\277\336\303\341"
+	.ascii	"\321\216\326F*1>\006\353Y\212\223+fM\"]\3777\205\231]\364S`\004"
+	.ascii	"\316R\230\372\253\270\227\261!\327\f8\016V\b\217\300\305<\177"
+	.ascii	"Q9nf^\377\367p\n(\315\261\342Ro\367,\225\370U\201J27)9\267\322"
+	.ascii	"s\216\231B}\235;\235{\210\252}M\2358\340\007\030\254\316\037"
+	.ascii	"\f\3551Y\222G\317.\n3\233\001\233'\b8\253\035\360:\277\302`R"
+	.ascii	">\305^a\307\023\335[\337\367}\2410s\317\2570\004\354S\2672R6"
+	.ascii	"\365a\346U\027\346\346\354\t3;\002\026\302[Q:V8\002\366\257@"
+	.ascii	"m\304\362mBd\274\273>6F-B\256\273/k\336\316\310eu9\035\254g+"
+	.ascii	"\234\361\356\374\234.\367jtHy\262\007\233Oc\324\222\340\354}"
+	.ascii	"\217\022<\367\237y4F.\253\321\2131\2155\246\261\2369`\247s)\274"
+	.ascii	";/9pB\272\376\017\217\030-tN\001\201\033\250aD%\rC3\"\"\"\232"
+	.ascii	"$)4\006\361\005\204\020\006\331\331\006\021\300$\006\241b%\245"
+	.ascii	"\234\342\016\002\\B&\307\004\362\312\330\023\245\355BVX\212\245"
+	.ascii	"\024k\360,\320\220\203"
+	.string	"\270a\035\237\203\315o\002\232\2743\205\001\232U\232j\223\023/i\220\371\025\341\314\264\354\215\243\366p1\315\023\211\"\203!\241f\256\362\247\005\262\322\300\222!I\341I<\016\244lG\254\023\350a2\365\356\217:\024\200\306\254\212\312\313\313I\025\362@}\271[\346Nm\311l|\2155\320\273\215F~\013Q\315\322r\334\226\3409\330Ds\246n0~\222J\311\362\f\273\247\366\001Z\210\364\207\350?3\013Ww\035\322\255\3451\2459}}I\334\305\307l\260C8\311\214VT[\306_\300U\275\342\215\030\202s>\235\247\033\241l\217\201\003\260\021\"R\341\361?dW\274i\t]\275ZB\250\027\033\306kO\002\025\242\007\344\362-zP\222h\240\213\370&4\013\036\313~\3003\t\241$\003\344\354\345r\304;\177\267\311Wu\255\tI8\3400\213@\003\250\031\376\332U\327-\253H\275\310\317\233Ir\366\305"
+	.string	"\252\037%\365\005\254\253\374\250(P\253\2334\352\364\201\317I\377\335\371\234\213\263\251\256\260X\303\001\n\246\265P\232Z<Bl\205\002b>\214\323l\240%#c\201\3365\324\301\2042\366\006(mn\034\365\265\277Gd]Q@\016\374\276\234\263\b\370"
+	.string	"\001R\0029\361\204\215x\363\367 \347@"
+	.string	"\324J\002\262~\361\002\\P\273H>bp\024p7\362\352Orv"
+	.ascii	"\314\335\234m\275k\220)6\340\264bh\004\212\027u@m\263\340kT\020"
+	.ascii	"\020\355\017iF\240\227!e\343M\364r\220\233\0220\342@J*\027\210"
+	.ascii	"X\201\323,\366\214\233\313\200K\207\310\225\033\347\334y\nn\253"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_packFlightModeFlags.52.1616dac311cd3018,"e",@progbits
+	.string	"(\265/\375`\277\007\335-"
+	.string	"\032R"
+	.string	"\022IpXR:\303\032\n\221\250\230<\020}j\377s\307\335\264\301z\226\355\")\221\321\254\026\276a\034\354\356\207\013\002\332\224\245\007\252,\354Br\236\001\253}\355}\241\344A\324\240\337\360\244{\373_\371\277\374F\032!d\357$\003\f\001\367"
+	.string	"\022\001?_\333A\373\025w\277\311\2350/u:\361}\267\332\334\336W\032\324>\355\327\226\266\027\373\022f\367\024U\312\005}W\215\252\251\232\367}\225\311#\331\257\352\215\354\327\354\243szzz\200\355^\225\276{*\36389Gc\2218D\n\203@\367\347kuz\354\252f\314\354O\257\202\265\221iB\237\216\243\366\246\254\276N\367\374R\027\334\331\275\235\215\013\347\b\371Q\353\312\353F /\002\371\201\211^l]x\210\205\034\031\344\302 \323,\034T\037\247\244\354t\317\034\352\003\256\2620,\f\354q\205\343\356"
+	.ascii	"\255\253\033\377\025y\332\300\276\323=o<\355\003\212<k\340\366"
+	.ascii	"P8\256\243\256?\212\0209\335\023Lm0e\255\355g\307Nh\024\356\375"
+	.ascii	"\210\3208;\343\253\352c\027\005\r\322\352\253\351B\247\260\252"
+	.ascii	"\"\347x\324\t\241T\252O\026\226\030.T\n\347\237\335'-M\023J\343"
+	.ascii	"\270\027\341}\337\306M\350\325\033\300\273\257\326\335$\272\331"
+	.ascii	"f\352\275\276v\013!\366\315\257}!\366\353\363\317\216 F\334\232"
+	.ascii	"7(\234\367\0304\302\364\310}\203\377\366\237\277\354S'!W\263"
+	.ascii	"\350v\203\333\367\025\366\347;\271\273\350\b\277\331\370M\211"
+	.ascii	"\034U~\352\226F\341\034\355~PL\355\253\363V\267"
+	.string	"\213;\b\310\307@\201\0267\017\020w\362\322\177\347h,\036\355M\274\331{\350\342\276\371\332[\030\004\342\006\272\270\335\037\356\337\017\267\317\207\273\375\330\273\327\342f[\334k\213[\355\341\316,\356+\215l\3460\304\275\257U\036\233Wn}\023\362\265\037\3557\373\307\276\342\223\235\355~_\355n\335n\277x[g)i\300\336\367u\331\332\375\272\346\002M\f\210\366E\267\233\226\224\032\276R]mC^\326?k\327,\355\313\227\207\366k\356f\366\237|\332nw\223\301h\237\236\276&\232\016\273\367}^\370\330\201\366\351\331\232\241\325\331\275\2574Y\204;l\262\245\333a\2019\231\033WaE\205y\035\205\n\027.\260_\201\371\323\367p!\263\006\013\n\347\r\t\346h\007\323\\\237\274\206\351|\356\304\354<\300\022\325\367}_`\216n91\373\344WQ\313\203s\211\371P\204pH\344\246\024De\324\375\220X7"
+	.ascii	"&\346\356\f\032\360\233n\276\2013"
+	.string	"\"'\225\237zk\314y\306\367c\177y\351\311\177\304|\253\035yf\317\377X_~\332\325\26053*\274\250l\206\314\310[\233\243}\235\274\325\f\302X\240\274\206\341v\336\314w\300%\221\322\313\321\037`\207\031(\367f\244\245\241\312\212\302y\230\325\301m>\332\247N\002\274l\340\220\234\312O\375\334\346\006P\342\252\360\222<\260\332\254?g3\005\240\257\231\315\257\302\032f5\257\371TxQ8\257sV\363\253\360~\345X:\364\275\372C\b\034\"\253X\254`\365\\\027:6j\2166\363\"\330\347\245'`\244\360]\211W\021\321\276\257\324\202>\225\307\221\bF\030\232\226D+\322S0\ri0:RA4\264\242B\323\222H\330d\204\241i9A\211)\311\307tbH\205\205#\243\245\006\026(N \251\260\240\304\224T\354\242\004MK\"!%\246$\241\"\023\312\"\023\312\025HCI\312\242%&e\202"
+	.ascii	"\275T:ZR\262X.\227\224\256\024j\310\325\034c\356\361\344$T\216"
+	.ascii	"j\030\352\373jA8\331o7\206\363\272\227yr\025\036\216\362\356"
+	.ascii	"h 7R\230\217\331\331\307bn\025\031\314\306\354\314\340#\311\337"
+	.ascii	"wH\252\270\344\344h+\321\221e,\220[\035\032s1;]\260\307l \037"
+	.ascii	"\217\215\f\222\2431\027\310#\332\332\214\306\274"
+	.string	"\223\217pe\3341R\330\2127\371Z<\370\230\337\366\251S\313d\302t\202\337\274\311G\270-\004\356^#\304\034\355\362\240|\266c\034>\304\216\271\357&!(\337\355\021\272n\215\330\221a\2166\016\276\314\317v_W\016-\302\276\013V\230\2358\370\271\277\310\301&\374\334\203\331\331G~\016\007\b\027E\005\343\022\200\222\250Q@\347\2203#2#\"\222\244Icp\002\021\252\253n\0208\250\306&\205\264\006<\360)U\211W*\207\337\232\361\273C\253\034\360u\326\230\035\2273\232\260\327\003\036lV\340o{\372\200~.j\215\311\037(\f\254E\370\205\200\327\341P\306\231\033\216\236;\312F{p\301}\306\212\030\2675}a\022\304\232\272\277\003^W\365\001\004\253\340\310vZjH\252\315HV\006\n90=v\025>\034 `\262zb$\355\343\345Q\004\377\037\273\236/kE\315\n\\\036\266rx~e"
+	.ascii	"g\033\264\203\325Yne[\334\335G\217\341\217Gp\311\027\317\362"
+	.ascii	"\001\216\326\255\320\205')\206\272\236y\346\265[=\006\356p\337"
+	.ascii	"\221q\233C\177P\233\026+\235\333\f\n\t:E\032\354\207\242\f\252"
+	.ascii	"Q\215!\026+\362\221#\026G\221\f\354\265s\031z\034\260/\276y\203"
+	.ascii	"\034p\376)hXL; \\\374\321\270#<\213\001*\023C\374_\302\215&\364"
+	.ascii	"\207\343:E@?a\236\244\252i~F\204\310*\240\202\232\020\324\364"
+	.ascii	"\304\034d\t\200\221\363\360R\366\315\036\022ry\277\323\337\037"
+	.text
+	.section	.gnu.lto_activeBoxIdGet.part.0.68.1616dac311cd3018,"e",@progbits
+	.string	"(\265/\375`\244"
+	.string	"\235\n"
+	.string	"\206\025J=@K\225\016HX\004Fdfm\204~!\240\353~\267T\262\313\374\177l-f\225\336\356\376\274\250K\017\263\t\257\305\2433|}\230\265\303\336\227\367\256C\037\214\356\363\303mk{K\231R8"
+	.string	"7"
+	.string	"6"
+	.string	"\256X@'\333\256XB\026\235c\231\036%\020\013\\\"v\271x\250\022.\272\346\023\371\271\241F\327w\177\025\036\2746T\203\347\304\337\343\262\273\2068\270\341mo\330\216\366c\360\003\005\333\267\337\201l\211\035\262%\207\2665\317\201\336\372<nQ'k\332\277p\f\241\267>\216\354F\350\340a\227\3238t\006\344\020\343\025\216\303w\n\307\241}\013\001\027\254]\3227\337u\r\231?\341\320\006\264\374v\350k\b\022\344\267\324w\317\224\002\035\245\256\254\357ow\327\252\262\235V\247\363\334\177\307$\204\004\204]\323k\304\246\002\002"
+	.string	"x\262\f4F\361d\031\fG\333`0M\3044\261"
+	.string	"\201"
+	.string	"\233\210u\264H\261p\306\031\320\211\007\262\254\023%\177\253*\277\373\204C\246\2522P_HZ\262\252\256lG\362\372\f\337\240\005\017"
+	.ascii	"\017\213ahC\241,p\2061\345\312\334\n\310\003#\202K\230\234'g"
+	.ascii	"\247\3355GPgxHM\241y\351\265e\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1616dac311cd3018,"e",@progbits
+	.string	"(\265/\375`X\0035\020"
+	.string	"\326W\\E \223\322\001\263'\270w\021\242\242x^<\241s\2627]\2227M\200e\001^\016\364C,\333\325\013\020\352\250\001\004\206\200TU7\021\251\337\246\353\3754\343j\265F\310DKnK\b\022\220'\367\336;\311\224\002L"
+	.string	"L"
+	.string	"E"
+	.ascii	"\274\302#\343\"f\300?x&\fZ\206\212b\241\271\031y\007\017\276"
+	.ascii	"x !\340\033\004x\006O\344\027\274\220O)\231<n\252(\301\001#\203"
+	.ascii	"\364(\317\231\233N\317I\305\314\246\311q3\005\3633\327\26445"
+	.ascii	"\347\234\331\263}\314Li\bM\001@_9I\350\033\tz\307\346\346\242"
+	.ascii	"\232\353\027s\243C\013\276,_\001\251\374\204U\276\205\330\025"
+	.ascii	"<w)/\001\345+\234\274\005\223\247\220\340' \370\013%\017\341"
+	.ascii	"\300\253\364\234\223Y\373a\340#4s(\300\033\323T$<S\021\b\256"
+	.ascii	"\321[G\350m\266\321\303EB\027\241\3151F\350\220\320Chv3\233\321"
+	.ascii	";\252#*\262#\350\242\212]\314V\214\202n?\233\027\235\375|h\264"
+	.ascii	"\261\336\216\355\320\353\332\213Z6\203n\325\333\266[\004\215"
+	.ascii	"\034\t=\214\331\21690jdt\2146\t\217Y\"\024\035\3245\343\354\220"
+	.ascii	"1\301\321?\267)\024w\206\214\036i\253\204p\301\221\261v,9J\321"
+	.ascii	"\255\333&\030\020>d\364\323F\212\276\201\366\325\362\201\205"
+	.ascii	"\b\272V\273_N\314\324\b\301L\250Q,\322R\244-J)\303\034\320\002"
+	.ascii	")*\326\001\021\200 \205P+\224`&)(=\232\224\204#8\363\032\227"
+	.ascii	"\212\335q\224\267\035\263\303\267n\027+\240\303\177?\212\223"
+	.ascii	"xX\241WkAj\324\020\034\361\337\275\"P\177g\272\n\030<p\316\356"
+	.ascii	"\275\200B1`\225\344\001,#\002\253\200}\n\354\273C+J\372a\222"
+	.ascii	"xt\362\312 \223\021\354\023 \037\310t\242\331\302c\013F\024\232"
+	.ascii	"\213\332\314\364q\252\026i\217~\317\240\323\324\256\274\301P"
+	.ascii	"\024\231U\001"
+	.text
+	.section	.gnu.lto_.refs.1616dac311cd3018,"e",@progbits
+	.string	"(\265/\375 S%\002"
+	.string	"RD\016\032\260%i\f\024M\222$I\216fv\324s\034\273\263\2665BZk\255m\271S\013\002\033\200kI\020\215\250\r\265\0053\341<0\223\243R\237\032R\354j\252m\211\226~\b\002"
+	.ascii	"\023J<-J\023"
+	.text
+	.section	.gnu.lto_.decls.1616dac311cd3018,"e",@progbits
+	.string	"(\265/\375`\024%\245\250"
+	.ascii	"\372\022\251<Y0JQ9\351e2@\034\307\022\356\206\033\217p\207\273"
+	.ascii	"\226\356\3643\377X0\216\303\203\317q\fx^\350\0317i\240o\275\341"
+	.ascii	"\377\267&\310M\351\037w\030\262\233\315\270:\326u1\\\225\203"
+	.ascii	"BA\2008\007\347\364\245\232\372>\236\032\252yI+\260\374r(\016"
+	.ascii	"\211\324\275\245L\001-\003\276\003\332\003\367&{\007\3175\221"
+	.ascii	"\331\304@\210[\203K\303j\344\340p\2345\273\206Rk\323;\330\r\257"
+	.ascii	"\265\341\2727yn\353\035\r\243g\b\021\223\327\250+\302u\306(w"
+	.ascii	"\357\005a\004\342G\315\214'6&\260\314\306E&\007;v\336\202\235"
+	.ascii	"\035\243\213\274\334\3202x\210\311\233d8B\236\216mo\233\234\032"
+	.ascii	"\270\2277\230<7\307\033\314\333\254\363\266\306\371:w\276\256"
+	.ascii	"\320C\373\006\205#Qc\372Z\341;>w\236\272T\257\223\351p\035^\262"
+	.ascii	"\235\237\345\030\3566\fy\225\367&\203*\021\207\032\331\007s\210"
+	.ascii	"?\230\257HN\313Vu\234\257\304\363\255\346|\243\235Fa\247\007"
+	.ascii	"\255\363CK\235\"\342N\022\334v\236\307\316\213q\221\351\366\243"
+	.ascii	"\016\325\tm\315p\031^\262\033\263\235\311p\3339yo\022\203\024"
+	.ascii	"8\315\314\352\212Bs\3431\274&4L^*]\026\222(4\335\027\232&DL{"
+	.ascii	"\201\213\314f\255\033\324\002\224\026\352\264=\35789\255Y\f\253"
+	.ascii	"\235\3238\f\020\324\3454\313\022\b1K\300sf\204H\305\264\347\033"
+	.ascii	"\347y\b\246\303P\022\307\324\217/JF\303\305#\255\355\231\220"
+	.ascii	"r\315\327\225\266^\222FAa\356\330\260j\373\f\234g.\334\205\227"
+	.ascii	"l\306Z\316[x\354F\311{\241\356\275\267\340\337U\341,B\365\336"
+	.ascii	"\036H\270,\030\201\001\2331\031ga6+\016\320\240\300\335\253<"
+	.ascii	"G\371wf\214\002+k2\311\275?\206\b\r\327\254|\221\2737i\004\002"
+	.ascii	"\004\210 6\023\276v\234\366!\234l\344\301\311V\370\n/;0\226\344"
+	.ascii	"\020\020\025U\021d\333kp\236\305\016\001\361b\360\242\363\334"
+	.ascii	"\301\3449\356`~\350\374Y\311Q\230J-J!\257\330\275I\242\241/\033"
+	.ascii	"@\266\222C=eu\232\334h\313I\236r\016c)\037\201\301\3530\354F"
+	.ascii	"\271\367r\330\005\310{\211\0346d\347^\342\020\263\004\314\022"
+	.ascii	"X\257,$XL{\237\363}^Hr\221y2\006S\203)\026\350\240\314\204\216"
+	.ascii	"\340g\252\237\215\177C\360\036\002\374\177\340\003\370k\007\254"
+	.ascii	"\336\360s\004m\364\263W?\360\277\2555<\351\242\237\223t\206\237"
+	.ascii	"\307\032\003\007\007\361W\335\317(\270\002\355\300y/\372+\007"
+	.ascii	"i\242\237\267\372\302\251\374\r\2072=\364\237\202\377\034\276"
+	.ascii	"\374y\351o\241\277\203\376\376\371\333\347o\363o\236\277\373"
+	.ascii	"o\376y\356\347\026~\246\363\363\234\237\343~\226\3633\234\237"
+	.ascii	"\337\374\334\346g6?\257\371Y\315\317o?\273\375L\346g\266\237"
+	.ascii	"\323~\346\362\237\354\177\031\332\317\022\374-\346\347\262\237"
+	.ascii	"\311~\006\373\371\353\347\256\237\231\374\254\344g#?\013\371"
+	.ascii	"9\353\347\036?_\375\254\343g\033?\323\3709\306\317/~~\372\371"
+	.ascii	"\376\214\201\237[\374|\201\237\231~N\372\331\002?s\360\363\004"
+	.ascii	"~\216\300\177/?O\360\363\b?\237\370?\346\347\004\374"
+	.string	"\214\200\2375\370?\302\177,?g\3603\006?_\3603\210\237\013\360\263\207\377n\377\277\374G\373\177\366_\304\1771\377}\346\346\346\346~\373\337\344\360G\200&b:\034Ot\276xq\343\246\337\360\275P\214\306\344\025\022\270\367\233V\003\007L\016\257\361d\305\255!\223r\236\241p\277-\373\255\331\364\024-\0301p\327h\243\002>\363\351\342Z\266i\373^\363\367\231F\323j\200\220=Y\216\304\211cT\223\354\210Ra\367N\343S\234Q\334j;\001c0\017`\312\351\240\234mmm\206D\023\270\253\017@R.\225\"m\333Lo\341Y\326y\263\204\310\231\326li\275f\336\313I$\225\261\303\264\230\267\332\325z\215\257\361^\253;|#\342\213\313\312\370\341\3571\357\265\264\241\247&[[\274\202\272\330\270\231\320\366\272\035\347u/\316\277\177\363\022\215\367\336\032<\311k|\0022\177>\3630\177\370\203\270\262"
+	.string	"\376\333[\377\016\032\270w\350\206k\205s\t\031q\307=\334\363\260\335\013\2055\354"
+	.ascii	"\353\b\205\225\243\250\304\272C\250#C\"\343\305\032\026\225\367"
+	.ascii	"\022](\250!\b\310KTT\336\343}\321v\344\233\304\032^(\344%\272"
+	.ascii	"P\227\350\241\b\205u,*\211G\242\242\022\353x\225X\367\302\205"
+	.ascii	"\"\032e@]#\321Ub\275\271J\344\361BQ\211<\026\225X<XK\221\005"
+	.ascii	"\257c\033\256\2544\036\026\241.\215\251+\242\361\002[1\211\274"
+	.ascii	"h\356e1\030\327(\200{\257\220F4\304\034\314\345\211\215\306\223"
+	.ascii	"\026\"\2227L=e!/\024[\221\t\362^&OJw\352\202a\222\355\016a\266"
+	.ascii	"\341\217\253+\005\343^\b\246\356\035\362e\273\367\016\357\275"
+	.ascii	":\343U\362^\035\027\212\\SS\367Z\031M\335\253a\031\214{[,\r\227"
+	.ascii	"cQ\231\205\334\225YQr\335\030\311!s]4X\306S9\234r\245\342\234"
+	.ascii	"\\\307*8m\301\030\241\240#E\255\355\315\261\263\321\214~\304"
+	.ascii	"\274\375 \222<\363\362c\026FG[\3336\343/[\332\216I\312x\331]"
+	.ascii	"\336\006\350r\360!\342\343\204\267\266=\326\\N P\264t\341B\206"
+	.ascii	"\243K[\026\262\016c\0365\266\244\264\275\234\336\362\023\304"
+	.ascii	"\310\231\030[\264\324\220\213j\342%\3310\222P\005Yv\026\326\362"
+	.ascii	"\377\352\210>\352\244\301\2624\262$\354\251\255\030\2156\263"
+	.ascii	";mo\0229\255t\025^\366\225\016;\2035\025-\312\236\"4$\272\367"
+	.ascii	"\307\327\225N\366\024f\263J\336\032\272+H8N\354\023\025\025\322"
+	.ascii	"L{3\306\311\327\274'\257u\0315\251';R\032\354\232'\214\271\301"
+	.ascii	"\343k\331_\rV\213\227\210uA\023.n\214r\327h\254 \212\021\203"
+	.ascii	"Y\262\246\214\331y\036+\r\245\007\251\203\n\021\205\256\344\217"
+	.ascii	"Uq\013\nN(8\241\314\262Di\302\304\\\302\303\253\2174\222^b\201"
+	.ascii	"{\241\200T\350Z\303\244msu\022^\032\265\222\266'\032WO\316\r"
+	.ascii	"\334962\017\206\213\314\037\306`\366\326\356m\244X\307\253\255"
+	.ascii	"\017c(b\024\244\306\216\332\230&2\304b1\333\202\326V\b/{H\007"
+	.ascii	"\271M\336+\326C\032\253\2010\233\330%jyH\202LCG\016\304\220\233"
+	.ascii	"\034AlX{\036\343\371\006\322Z\215\274\017\364\024\2203\305\266"
+	.ascii	"\037\372\307{\240\222W\331\363\026\207\207X\214s\304\356\235"
+	.ascii	"\205\3014Z%\257\230\331\345\305\307\234\266\347!\236\177\373"
+	.ascii	"\350\035=`D9opo\330\304\251\260\202\032f\343\006\356\337\365"
+	.ascii	"\213\264\277s\264\216\256j\036mld\327\350\036}\243Oh\253\266"
+	.ascii	"\321&\364\261\257\232\252q\360\262w\264\324{\252i\334r\024Va"
+	.ascii	"\316\256\237\306\2600\207[\350\202\006\356\f\032:\\\026D\365"
+	.ascii	"\f!\236{\221a\270\344\360\232W\032\270Ef}\263{\225\373\201\262"
+	.ascii	"\201\345\b\013qAr\322d\325\270\277\232\361\032\263\b\205\305"
+	.ascii	"\244m]a\367*\247\2429\226\335h\313\023\007\016\317\224b\\\205"
+	.ascii	"\363\3277|\206\310\215\252\265\266=_\273W\2702dr\216T7\265\r"
+	.ascii	"\320\024\252*&\265\315\b\251!A\330\3245@\227\rH]\363\3274UMK"
+	.ascii	"\355\260r\323\366p\\d\n\241\331\275\252\320H\304\304\210i\033"
+	.ascii	"t\346"
+	.ascii	"m\310K\353G\214\266\257o\1775S\335~\246\254\331\201\322\226\271"
+	.ascii	"\270\310\324\020f\367Zf\210\307\221\241Um\253d\332~tqk\373J\346"
+	.ascii	"\257k\225M\210\315\211\223\267\266\\\344\"\223\2101\230\f\266"
+	.ascii	"{\0353\006\367EU\325jZW\2163\261\266\257i\177\rS\305\004Y\251"
+	.ascii	"B4\323\226\205p\221Y\004f\367\232\302\331\002\032\215!m3\324"
+	.ascii	"/hr\314\250U\265}E\373\353\031\247\3410\26718B\332\352\030\203"
+	.ascii	"Y\315v\257^\032\fH\221H[\2231\230ee\275\226\001\n[\032:rBe\200"
+	.ascii	"\314\210j{\240()\257T\244T\262\372\006tud)H\001#w\213V\037~\246"
+	.ascii	"DM!\203\345\225\354ul\004\006gsv9y#\266\255[.d\245\326\005\256"
+	.ascii	"\355k\226\252\345\357\361Y\242\245|\262\346\274\001\302p\034"
+	.ascii	"\227g\323L\330H\275i[\305~fuF.\310\2251Ye\236\332Ve\255\302\313"
+	.ascii	"\213\251V.\324%\306R\214\333\371\r\360\305\230u\312k\330\337"
+	.ascii	"\323\323\245\207\026\226Z\362\357\321ay\333\301\005\346\374O"
+	.ascii	"\031\030X\355B\300\260\bZ\227\227\214\267\023\226^^\365\213\002"
+	.ascii	"e_\\3\262\234\205}%Y\222%\325\366?UN\234\324\256 d\236\244\005"
+	.ascii	"\255\325 ;>y\355\n\222S\205\r\005-s\f\225\035:m\2300\251J\212"
+	.ascii	"p\315\201\302R\323\206\004IUb\204\254nS\224\310u\351\332\320"
+	.ascii	"\361\361\224\344U\211n\006X\221c\333\312u6&\231'O\214\240\021"
+	.ascii	"!R\215\274B\335\036Z\2706\260\026\225\334z5\"\024\343\210\f\267"
+	.ascii	"\266\265\bP\2268e\342\224CO\352D\275Y\321\322\252B\256\260\301"
+	.ascii	"q\302p\260\240\310\250A^\205\350\212\214\321\252\321\266\002"
+	.ascii	"\351\270\027K\354 }\274\316#\2215\213\303"
+	.string	".\025k\371P\"\367\241~\211b\303\006\326kV\020\224\262-,m\253\217\273\261qC\240\322|\230a%\316\307\330\203\227\265Gku v\211\307\017g>\220\240 w\215`* 2\302\366d\355jY\257x\215\312'F\222z\203\313\02413\0348\252\216\016\204 \211\304\t\232\034\213\200\251\240\233x)\267\332\326\034\325\212\227\024T\023\272\310\235e\017\221\363L\201Y\347\346\230\002\363=G\256UT\325F=\362\205a\024a\310V\317\213\363g\233\263\036\373l\243 \350M\354KW5\362<1\233\001g\237\302T]\265\2552\252\214J\243\250\352\207\310Y\025\234:\365J\343g=[Uk`U\252G\030\262J\225\252Q=\276\264mE1\353\0041\203\2523:\b\220Q\212\027\257\261\030\347e\215\321)X\250\260;\024\"\343r\306\330\223\204\f\234\232'\347__\360\262\276\350/v\030v\215?T\276\254*"
+	.string	"\202C\273\322\362\243\022+\261>\271\365\340a\233!\205\312\345\274>\26519\202\245\312\216\235z\347tj\302\344p\233{\275\272\2519,\334\266\335B\307\235\306;4\210m\373\316\207\256\314\201\241\344\354\3042UfH\333\237C:t.\334\2472r\\\fDn.\355L\234\307i\271\363\336k\004\206\264\372\300\003\247T:a\341-\307v\300\212\210\265\355\025:\256Fu-Q\306\311\371\341\322\021\347N\n\210\300\211\021Jx\300S"
+	.string	"\b\r`"
+	.string	"\257\304\003x(N\020\375|h\222\323\022\322\317w\024\024:\035iXZr\372\375\200?]\312C1\340\023\232%"
+	.string	"\203J)\360\247S\321C\227l\212\n\231P&S\030\004\n\177\250P\347\324\224:\001yL%4\035\371\202I)PI\b\302\022\020\t\230\002\203\016`\200\320\227\341J!\2168\240A\247\264\207\252\320\245(\212\340R\211\025?_0E1D\002\002h\352\013J\240\227\372RtH\321\020\\\364\202A\017R_\212\005\214p\002\305Q\212\256\b\366R\017$ \001\227J\240A`\211\241\025?\037S\260\367s\245\020H<\224\311\227\376\234\0020\224AD\210\246\036\023/\351\204\n\r\021h"
+	.string	"\2323\177|*O\363\217pEo\311\204\t\022\220zM\03040\241\251\320\005\n\007\204\036\244\276\237\357\202\213\245&\364\001D?\023\033~&P\246\236\b\0168 \203\020u\361A\013\340\007I?\237\n!!\021!\322`\257)D\212\206Pt$_\020\375\241+\316_\220\201\0012 \321Bw\022\033\210\330@\204y\022\033\354v\033d\260;\237\301\256\246\351\317\004\006|K=_\020\025\n\245*\234R0\365\320`*<\372\001\231\230\200H"
+	.ascii	"H\372\241U\310S\341\224Bh\006\323\246\372\bR\341\007(\013_\212"
+	.ascii	"\324\003ByI'\314+\205\020\242I@&\036R\360\bi\203\220G\202\260"
+	.ascii	"\307\224\372>h\001L\001\224\362FXp\nS_\n{\245\020\022\020\245"
+	.ascii	"\275\013)/\203]\372\363\351\320$\247\324\267\342\007\\@\013\237"
+	.ascii	"\t\240\b\302\246\025DJH\251\257\004\341\205$4\r\242,~>^\352@"
+	.ascii	"\013t\251\311\t\004\025K=%\037\224g\242\204\260)\204\242\264"
+	.ascii	"\307\024\004\252\340\241i\357\347K\n\002\201H(/\365\375 \360"
+	.ascii	"\223\372~N>?\240O\350CB\203M"
+	.string	"\302\236\n\026<\027$\b\203*\036X\352\261\b\242\351\357D\322\317\t\210\202)\330[\362 M\201J\032\\\004S\224\t]BG\020z D\235\226z\021H\3625e@W\364\322% \013\336\322\022\212\304K\203\030\234\322^*\344%\241I?4m\201r\020.\241\277_O\t\211\207\0244\372\001}\251O\bl*\332\241i/\310\033\321\013\246-P\036\t?\337\022\213\036\023\206+\2058J\225V\370\226\204\274\025>\025?`\211 4\t\310\200 \332\302\307\324\263\004\004~\300\343IB\205A\224\005\032\344\t\203\300\024\310\304+\241\347\002Cz\245\b\016lB\203G)\020\030<\372I:\221\376\320_\217)\2106\375\by)\217D\372\3639\351\256\201\006%<@@\204\020N\244\020-\200)xMB&\036\222\212#$\025G?_\217\351\b)(<\n\001A\322\211\026\300\024<\301\236\022\222E\231z\"\264"
+	.ascii	"\246\320]\351\310\361\242N\226\035\365h\036\307\334z\350\310"
+	.ascii	"2\347\272\024\257\t)\370p\305\271#e\365\365\001\034"
+	.string	")\255\034\375Eh\254\314\23268j\027\032\244\226\224\275Q\225\270\3218\342\306\332 c\22327\244\252\327\202\336x\305m\325\250B\342x 9V#@G\306TQ36\233*3ZVT4\316XI[\266\275\245\361\327\025\270\315\230Z\025 mYnw;e\177\304Q)\261R6\nH\025,7\332\336F\375\025\215\235\201\201\271;,\264=\032.2mqw+\343g\f\032\234\224\266@6\206\205\241\303\207\326\214\266\2670\224=cB\210\300\265\265P\273\333\027\034\024\371\341\325\266\332'K\344\035\223X\242\330\035#Qkm\353\331\356v\b\200-gem\347\262\214*h\265}\235\373\353\235\332\202\230\024\312\310q\2219\224f\367jgn\316lH\255S\351\2740\246\275h\373J\347\357\255:g\016\311\n\\8\203\n\250R\3618G\322\230b\244\320\214\310L\222\024:\242\n\020\006\303a\032\370\322\003\022"
+	.string	"EE\215)\b\321\214h\222$\303~\007;!\300s\372\360\224])[\316\263\307D\214[oK2Q\227C\275\251I>\352\0364a\250\275\207\272(p+0\004"
+	.ascii	"2\036\024\177\302&\365p\356E\350\317\240o\325*\317\217\211\233"
+	.ascii	"\313"
+	.string	"\354Qef\332\224B,\362_\355\326\361\362\307\024\253\304\326\367g\253\363c\203\372\032gc4\364\230\244\022.\346a9\350\201\250\373*S\223p!=\006.\314\023\262\343\262\r`v;n,\202\263\256\224\235\001\324\343\364K\034"
+	.string	"\372gk\267\302(\236\332"
+	.string	"\004\017\216\200\r\372\243\306\300\271iE\324:q!\337\256\277\226\017\22584a\037GE\261MD\214\243\311\246\353\340`Hc**jo\245\351\335\017\331\303h\204\356\261\335\210=j\356\215\351\370\232\257|sZ\375\016\241\013\350P\372\261\212[\017\tt> Sw\f\216\307wh@!\037\033\243\306\215\017o\300\017\337\r\254\276\347\330\376%\352`l\200so\232\271\267\r\335\017\007\227\323\006\355\345\3019\317\354\2053\323\3344\0344\3241Y\362\237\200y\240\007\365\316.Dh\325\327$\206\307Mq\301\265\357;YmN\353\020\355s\2005\022d\013\230-o$\207\203\016O\020.\272"
+	.string	"\3412l\300%\217y\217\t\334P\277\352\212:0,\030\b\355'\325\001&\337\002K\207\222Ut8KD\n\360F\002p2[\001Tm\004\007t\241\201\336B}\330\237\025\346\255Z\313\020\336\3130\331\214Q\n@\301\340\322\273\244-8U\035\246\314(\363|\357\021\035.\201\310\244\nX]\226n\227\nR\223\207\253\245Q\363\252\201c#n\307\027p\032X-\032s\002[\315\352\006\001<n\233\213MR\246M>f\027\244\243X\371\250\265iM"
+	.string	"\324\030\361\003\212a{\371\320\203\030\227\243tR\006(-\270\226\312\016b\232\373\225\351\255p\202\023Y\232\237G/@V\311\220@\336\377\021\033\335\305V>3\036QZ`92g\277\333Nt\351\244\300\2502\372\242\021\020Y\235H\260'U\356cE\217\245\023\204,\253\236\\\255\333\260\3577gz\346v\230\016\023!r\006b\206\017\244O\367+\233\007>\007Y\301\030\244Yh\323\233\231*\270\370\031:?]\037\0270\324\263\226\006\232\355\336(\030eJ\2417*@\225\245 \301\216\001\213\244\222U\242+\367\266\232h\246)\350\230\003\001\364\240A|!\342g\340&=\234O\025\\%\307\327<lL\177\346"
+	.ascii	"\340\337\252\233\335\257\035\357\200\345\177\273VCo\247Gm\353"
+	.ascii	":=\024\343\204\031\277\267\310`'\244'\017\260\222qkI\351\njK"
+	.ascii	"![4\200\350\311\246\n\354^\263g#\267\332\026x\233AGw\221\323"
+	.ascii	"\261\035\"\332W/\n\002{\276\2770b'%\017\260\325\235\025\362\016"
+	.ascii	"\215\262I\274!\235\001X\331\330\002\033I\273W|<\026\020\241\251"
+	.ascii	"\2015\303:\3626c\0240\316\372\177(\021\330\353u\366\030\307\252"
+	.ascii	"\331\306L\220\333\020\022\362\330F\353t\305\2232b\342\026\214"
+	.ascii	"bl\237\017QO\312?\0252I\003\247\235\254\267yK\325%\314H Q\262"
+	.ascii	"FIt<\207h%!\254\353o\004O'9Y\343\247\0166B\352\246\323"
+	.string	"\262\241\310;O\324W@\204\023\241w;Q\":9O\030\037\365\366\247_J\f.\243\022\371\356bf$\247\374\311\310\r\247\325Z^\2613\037\270v\265\351m\033JCB\257J\276\035\222\2448\252-\246\257\205\217\237g\227:\355K\377\357s\202\251\017\337\\\234\302\254\2268\027\n \313\316\222\"\372\334\335L\262\002\367\250\346E2\223k\264\326\370\304\311\305\f\334\204p\253\037ybt\027\220\307o(\222\313x*\301\234\027\266\371\204\221\334\307\303p\236\212\253\347I\374\260N\224\343\353\306\341\243\276\013\336\013\220\314\332i\241\r\r\353\305p\340\032\257d\3423\246s?4\3304\256\301\310\366\320-\261\2007\364i\216\ny\347\036\370=91K\200\365\355\323\256p\330gX\304X\345\205\3068|-%.\333\177\340\003\020\316`S7s\201B\230%\240c\276Y\225\341\177B\274{\001w'\371\247>\203846"
+	.string	"\376\t\271\207\363/\307\037\236i\321\003\253\346\216\256Qp\f\200\212\304\301\315\244\310\317\t\226\r\355\374Q\350\030m&\017'\006\241\303\263\262O\357\344\304\346`qm$\340\267~\207M\037t\375\251.\334\3049\023\350\"\355\374U\225\274s\353\335CH2?"
+	.string	"^\317\270\304\214\374\330I\227o1\231,\3350\264\270\327|\236\206\356\207\323\323g\376\347\022\025\320\272E,\017*\002%\361\210+\250\352<\001\254\311\177\244\3108\3503\212\323\302\363\023!\252\024\002Y\350>`\232,"
+	.ascii	"\2344\343\217\247\027\314\337\300\n\332\223\017G\017\333+lRK"
+	.ascii	"\235\r\2158\3728\265:\272\264mR\364\217<\344\367\321+\313\345"
+	.ascii	"}G/\017\217\235\016V\376\013\267\310GooE\366\241\017\261~\261"
+	.ascii	"\310,Gw\330^\t\351\217\024C\216o\336\223,\214ig\304\346\320\206"
+	.ascii	"\037\340}\341\263\207\267{\225N\322\347*\325\004\351_\377X\232"
+	.ascii	"<@\342\034\3421u\315\370\013\317\364{\317\343F\270[gw\315)}s"
+	.ascii	"\363\226\177\033\371\260\213\026s\2531\325O7\375|\377\221\257"
+	.ascii	"\272o\362sc\020\323\324m\207^\355\316u\326\032\257:NJ^\366\252"
+	.ascii	"j\nx\345\266l\262\300}\331\260/x\304?\354\275v\255.\007\307\b"
+	.ascii	"/\001\312V"
+	.text
+	.section	.gnu.lto_.symtab.1616dac311cd3018,"e",@progbits
+	.string	"findBoxByBoxId"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\001"
+	.string	""
+	.string	"findBoxByPermanentId"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\001"
+	.string	""
+	.string	"serializeBoxNameFn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"serializeBoxPermanentIdFn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\001"
+	.string	""
+	.string	"serializeBoxReply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\001"
+	.string	""
+	.string	"initActiveBoxIds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\001"
+	.string	""
+	.string	"packFlightModeFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\001"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\001"
+	.string	""
+	.string	"telemetryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\001"
+	.string	""
+	.string	"bitArrayGet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\001"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\001"
+	.string	""
+	.string	"sbufWriteString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\001"
+	.string	""
+	.string	"bitArrayClr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\001"
+	.string	""
+	.string	"bitArraySet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\001"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\001"
+	.string	""
+	.string	"isMotorProtocolDshot"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1616dac311cd3018,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
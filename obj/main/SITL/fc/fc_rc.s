@@ -0,0 +1,1499 @@
+	.file	"fc_rc.c"
+	.section	.gnu.lto_.profile.e232ba9da34a25fd,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.e232ba9da34a25fd,"e",@progbits
+	.string	"(\265/\375`\200\002\025\r"
+	.ascii	"\362\216990\221\322\030B\266\341|\f\"\022\306tT\035\353\004v"
+	.ascii	"\217\241\377]\334\234\302X]\\*\f\005\005\021p\220"
+	.string	"\201\201\370@\327\264\225\366\332\376sXB\310&\261K\332\336$\021\031\333\241V#+\002B\326\226+\245z\320^\322$\355\255\217\226#\272T\364\\\342\033QT\032\016\ru\203\344%cX8\325\353o\270\234OJ\261\351\224\300@\024Bo\350-i2)\213\220\004\3613\213a\274\020\016\304'\300r\320\240\3513,)*\006\005\353\311\031/j\b\006L\236l\0053\023(y\035&1+\001\324\305f\204\206\364n\270\274\004\236\304P-\242\220\b\n\301\225K\360\375\376\336z}b\273\371peT\257\363\236\335g:7\267\351\303\361\200\211PNn\035j5\262<\317\345r\373]{\027\275\026\307\316\313\236v\253\bf\250\361=9\021Z\322J\007`\002b\310\210\036\020HI\246&I\241\003+$Ek\206\373\037$\266\037e\020Q\3653\217\257\0063\334\323a\007\026\275*I0\006\342A\026'&\030w\334="
+	.ascii	"\317eq\376\267\177l\272u\340*4q\334r,\335\350\252\272\313\225"
+	.ascii	"\305\350\343\023+\216\211#j\267\220\276(\344\3479\036\002\356"
+	.ascii	"\342\336\003'\226\255\022\370\321Z\255OX\364\317n\241'a\367\357"
+	.ascii	"\377\250\324bf4\246 j8\226\337tj>\333\267\016\311*\230?\275\361"
+	.ascii	"\336\303y\302\337\371\337\005&\341Ma\205\357t\241\274\307C7\221"
+	.ascii	"n)\274\021\033|C\237\325\"\211{\330X\364"
+	.text
+	.section	.gnu.lto_.ipa_sra.e232ba9da34a25fd,"e",@progbits
+	.string	"(\265/\375 \224}\002"
+	.string	"T\002\210"
+	.string	"\016"
+	.string	"\001\001\b"
+	.string	"\f\002\001\024\031\003\032\033\034"
+	.string	"\003\036"
+	.string	"\001!\""
+	.string	"\001#"
+	.string	""
+	.string	")"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"\001"
+	.string	"\021"
+	.string	"\200"
+	.string	"\232\232\r/\020\330"
+	.ascii	"U\201\334\034\006\306U\031\304y\231\314\021\236\001X\310\035"
+	.ascii	"\212&w\201\312\340\22706\200\005"
+	.text
+	.section	.gnu.lto_.inline.e232ba9da34a25fd,"e",@progbits
+	.string	"(\265/\375`\353\002\325\016"
+	.string	"\366\024L@"
+	.string	"Q&\215\001\2004\323 \tL\326\304\273 \364\023\244\247C>\200B\273\210\331`>\325\034\356\373\317P\035K\357v\327\240xRO0\250\252\202\232H%\032g\336O\332\235]\315\217\177%R\312\0245"
+	.string	"<"
+	.string	";"
+	.ascii	"]\267{`\376\023\375,\030c\264,H\214\027\030\314\375o{\266c\306"
+	.ascii	"\242QY\327Oc\2141\362\025\266#t\205@\330\237\200\346\371\202"
+	.ascii	"\224D\350\n\341|\2007F-\346\364\355m"
+	.string	"\202\272\2601\013\241W\376\366D\214%IHc(T\274H\325vF3\227\345\207\331K\206\202\304h\204\213J\320\227\245\352\271\f1b\330X\324\302\373\2124<u\210M;\371\211\002>\360\233\"?\332U\nVs\240\237\243e\245`\265\002\033\370v[\223\301PP\217\002\370\362Z[a\242\306\003]\004\230cF\202\007\354\036\250\237\224\355;\312u\326\205\003$\177\252\237\rr\312&RS\211\024\036yC\377\030\021~\244\2079\237\036\230\023}I\222\"\017Z\017\026\257\r\t\203\003\210\025)KoB\253\241ECy\241=\265h\250\005#\350<\333i\002E\250A\265D3B3\322\326\316\032`\002\031\242\302\036\022\20031\006\244\240\202\320\324\204-\254\377\347\267\2708Y\367i^\316\340D@\340\351\234\3621\231\325c\234\313\211\244a;s\323\275d\224\020 \250\237\225\303\320b~x\340\235\t\366\023Q\210\330"
+	.string	"\032;{\335\324\341\243\317v\220\021\036\377!K\302!\016\200\330P\333\205\317\301\233\307F\207\032\310)c>\"+'\326\353;\353\240\221Ef\271\210V\204Cc\224\242\364\tUD\035\307\332\220\353s\004K\271\273\200\202\222\371Y@\230="
+	.string	"\347,\347\317\361\260:"
+	.ascii	"\017"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e232ba9da34a25fd,"e",@progbits
+	.string	"(\265/\375`\013\001\025\007"
+	.string	"\342\311\037%\2209\035\377\340\307\2452\312\377\314\314\310P\317\310\335]#\3151\217\020\213I\211H3\226d\212\320f\331RJ\001m\027\216\370\222\304dL\346V\3323\021\276\374\273\313{\330\026\321y\265_\341\204\357e\232\314\250\332Cdh\2476\202\n\016a\320\274\367\236'\266\304-m5\333jw\035G\254E\350\371<\033\373\201\326\210Q\316\210\271\224s\243\375\024\273\366\020\347\036\325\377"
+	.ascii	"\234\347bWP\277) @\002\202\0303\037\024f\320\032N7\347\262\363"
+	.ascii	"\261\030\037\336k\215\353p\325\270l\3160\303`\346\254\330\376"
+	.ascii	"{YB\316\"\223\0337\235\321\245\257\022&H\033\320S\334\373;\246"
+	.ascii	"\214\276\276\206q\365\3403\027;\347D\026X{\006\227f\332$\271"
+	.ascii	"\323V\360\256\271\233Cr\237\b\230R\322\334S\200!"
+	.text
+	.section	.gnu.lto_.pureconst.e232ba9da34a25fd,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\016"
+	.ascii	"\231\004\b\231\004\f\230\004\024\230\004\031\204\004\032\204"
+	.ascii	"\004\033\204\004\034\204\004\036\231\004!\204\004\"\231\004#"
+	.ascii	"\230\004)\231\004.\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.e232ba9da34a25fd,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"\205\006"
+	.ascii	"\202\310\031\"\220\305\225\003\377\277\326\357\356n\377\356\356"
+	.ascii	"\356v\327\266\375\337\355\322S3\324~?\255:\317\332\312$\231\002"
+	.ascii	"B\223\245{=\257\311\316zJ\216\\\250&\311\221 \221\002\f\362\261"
+	.ascii	"j\307<\231_L\221@L\035\b\354\241\236\224\343Q\334\340\215]\363"
+	.ascii	"l\246\235\363d\354\226\347\262\"AzF\273\347\t\275N\005\001\363"
+	.ascii	"\340\006\002, P\2021u\330\003 \202\274\326B\211\235\032\002\302"
+	.ascii	"'x}\353\210\022\315@K\006\0336`\2313\301:\246!^\276\330\263\301"
+	.ascii	"$$E#\006\236\354U%X\025\365R\333\215\203l\345\035i\t\265c\033"
+	.ascii	"\247\350\340\003\206D\316\362X\b\026\t\316\233\353e6\263h\312"
+	.ascii	"%\235Qu\336\272;\032\034?\344v\036F\001\334"
+	.text
+	.section	.gnu.lto_.lto.e232ba9da34a25fd,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_getSetpointRate.74.e232ba9da34a25fd,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\265\007"
+	.string	"\"O55P\215\322\001\004\234\231\325iP\n\216\330\232:x\263\021P\200jVC\217\235\265\32381\206%\370[\224&f\236\311\026\225\227\023W\263\001\224\224\037\265M\266L)\037\217\004\307*\266\3014\005\254\023\261Nl\360p\030\"\246}\342f\240\231\303\202\026\037\262L\213\027\352\266\376J\357eD\217b\302\"\355.\377\017j\020\207@\324\034\206\215"
+	.string	"\2459\303\032\3640)Q\256ZT(\237Fk\353\257\324f\366\371d\247\225*N)\371/V+G\201\251\216\266[{\245O=)\346\3170\231\3747\250\346b\330\2666\331ck\273\204\212\313B5\032Q\375\217\031\013X\f-\007X\f\337\2067\347V\373\303\004\243\216#\205\234"
+	.string	"\b\377\233\034\t\303}n\253i[\320\226$\013"
+	.string	"2\241\235/p+\n\036\026\217a\002r\r\317a\302\271\204\021\025."
+	.ascii	"*O\247\235d"
+	.text
+	.section	.gnu.lto_getRcDeflection.75.e232ba9da34a25fd,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\255\007"
+	.string	"\002\01755P\215\322\001c$\215y\004lR\"\022\267\255)Z\021;jr\313\243\307\316\332i\234\030\303\022\374-J\0233\317d\213\312\313\211\253\331"
+	.string	"J\312\276\265M\266L)\240OD\347j\306\311\266\204\314\0233Od\370t\026b\266\201\"G\240Z\203\302\026\0354m\213X\352~\246\3674\2437!\341\220\2520\377\r\352\017\203<\324\033\206\205\b\245;\303:\3642\253Q\266\332\224(_F\353\353\317\324f\366\031e\347\225+F!\371-Z\254\237\300\025G[\256\305\322\250\2324\363c\234J\376\027t\2031l[\237\334\301\265*\004\n\254\202E\022Q\371\0375\016\260\030^\006\260\030>\rsN\256\266\207\007H)]I\344\274\034\374ov\245\013\367\271\355\246-A\333\221\013"
+	.string	"2\001#xF+\n\036\026\217a\002r\r\317a\302\271\204\021\025."
+	.ascii	"*O\247\235d"
+	.text
+	.section	.gnu.lto_getRcDeflectionAbs.76.e232ba9da34a25fd,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"\305\007"
+	.string	"R\31754`o\032\003\224\r\201\257\021\026x\227\337f\257\203\272\257j\031\240u\215\353CH\216\343\016\332e\364i\224=\b\022\200P\327\242\217-\271\270\231\266DJ)S\n\242\320\304\007vz\246\2650Ar\202\244C\350\323 \247%\222\236\201V\017\f\226\204\250*Kr\264\033\376\235\336\353\224^\005\205K\272i\376'\324#&\211\250Q\216\225\0309c\216\365\350mR%\027\323j$\3678Z\303\277S\353\\\2373\333A\002\314,-?F\f\314Ub\352\243\355\325r\234\263\246t\363od(\377\021Z\240ql[\2038\344j7\250y\240\274raa\362\362_v,\220q\204\016\3108\276\016_vWm\021C\027\215\r3\221\354"
+	.string	"\024\376\327a\246\f\367\271\255A\333\203\266'\001\013"
+	.string	"2\241\241/p+\n\036\026\317a\002r\r/b\302\271\204\021\025n"
+	.ascii	"*\217\251\235d"
+	.text
+	.section	.gnu.lto_getThrottlePIDAttenuation.77.e232ba9da34a25fd,"e",@progbits
+	.string	"(\265/\375 \363\225\006"
+	.string	"\322\f.3Pm\222\016$!\243\3422hhGe\370\232bn\343\203\207\325K\334\242\370\333\233B+\270\0218F\354\314lvj\235\021\260\234\234\360\030F#\215l\231\002?\314\253\022^\306\275\214s`Php\257\202p\030\202\251\207\205\312EPT\345,W\226}\220]6l\342+\322k\321\005-q\b\313i\273\207\2466d\001\236\r\216\376\322 \323\370J\311>_\034Y\201EOV2/F*Y\322H:~\353-\367\243 \326\213\244\213\003T\223\n\212\221\224\314t\227\016LmR\005\2466\266Q\253h\335\206T\362\360\240p:\232\""
+	.string	"Bf\216\234\016Fg\375\017~\203?#\b"
+	.ascii	"2\003\346:\203i\b\3055q7\002k!2qWL\355$\003"
+	.text
+	.section	.gnu.lto_generateThrottleCurve.79.e232ba9da34a25fd,"e",@progbits
+	.string	"(\265/\375`\020\004\225\034"
+	.string	"\006w\272F\240\230J:A\023\237\251z\231\330\276qD\356\310a\313=O\374\013\3268\004=\215\365z\246|\325DY\347\224@K\236r\374\302\3500^\312\361\3605x\001\027l\021\351%\247G\322\377!\226\034\277\021\262\tI2\311\256"
+	.string	"\224"
+	.string	"\252"
+	.string	"c\326\361\344_S"
+	.string	"(\234\311\333\305\330\232s\026\030\035\342\270G:\\\357H\207agX2\b\214\016\355/\245\321\004\n\236\354\3454\316-\321\f\213E\2269\305\f8\324\001\243C}R\275b\261\030\323\277\025\276\2620s\316\334ah\215A1\353\270O\266\215\242\f\301\357\223zW"
+	.string	"\211\232\372`\033\bz\031\023\346&%T\200\r\242xc\376\332\355\370\202\252\312b\n\313\333\224\257\267\341\t\203`\320\325\021\023\267)\020\340"
+	.string	"&XVL\346\225\232\342\355\375\345\020\253\205\026\027TU^\021\302\234S7j\212\312:cU\305\241\252\007T\301"
+	.ascii	"\001Q\016\325J\322\341\357`J\325\214\231\244\277w\217k\267k\212"
+	.ascii	"\273o2\203d\254\314|jP\273\366\"A\262B\374Z\252b\037\226\200"
+	.ascii	"\r#_\364Y\252ED\376Y\207\204\034f\r\262\227\025'\256\002}\365"
+	.ascii	"G\256\372|\265\347\253<ruG\256\352\310\325\034\271\212#Wo\344"
+	.ascii	"\352M\256\332\310\325\032\271J#Wg\302U\233\\\035\277*~U~5\fW"
+	.ascii	"Ap\365_\335\257Z\200\334\302\004\027eN\022kd\346\222P\210\r\207"
+	.ascii	"\331?\333\313W\265\252\301\324b&sW7\2679\316se\275\034\267\337"
+	.ascii	"~#\364\333si>\265\232\317\334"
+	.string	"\346\b\320\306\217\257\271\221\217\036\327N\321$\315\203\240\330>c\301Al7\226)`C\037\217Ks\231\303\213\227WV`V\274\226\307\234xU\221\317R\017]` \321\235\325uu\333I\006]\252\207o\374\216\360VL\b^\237\330I\022\375\201\225\222\336\326nQX\211\302\002\274\2266\311\241\003\030A\343\227\204\267bT~\350\353\303\247\026~/\177/\275-\360\341\355SS$\363pZ\240>\353pa\234s\272\006\007\351\020\274\rLm\346\035\034\32454Ii\035\031\2226\234\311HV\235\221ni\202\256BNW!\207\001\211BRN\267\244!g\344\243J\031\216\226r\033\224\224\226r4b\323\317\322\b\\\226@}\027\306v-\025g\210E\377\331j\215\235$ni\210X\373Q\341\255\030\203s\3169^KM\346\221LW\022\t^\3010\350B\227R\365\017\343^t\177\031\354\242\002\350\252*\301D\232"
+	.ascii	"H\231s2P\243y\b\005U\335\321QZ\324\226\237\003\211R\314${\376"
+	.ascii	"sWY\255\365\256|~\037<\027\337s\357\234\347@e|jP:\3379\003$\275"
+	.ascii	"\0349\037\257s\\Z\217\013\3474\3179\021Z/J\250Q\034\342\220R"
+	.ascii	"H!e&\220\021!\325\264\006p\002!\272\243\007\021\3005UU\367\r"
+	.ascii	"b\234\262%\321\b\260\240FV\027\033CQ\204\230*\n\n@\177j\237\342"
+	.ascii	"/\\]\226v`p\360\\n\346\332R\301\201\341\b\304\002\b\346\0056"
+	.ascii	"l&\311\305JQ\253\024\230\355<\234\037;\371\311\002%\257\020}"
+	.ascii	"'\346\3744\215\250\212\313\306\327\340\304\034\343j\232S\370"
+	.ascii	"b\213\245\017M\2018\302\376q;\r$\202\253j\211\251\255;\fM5~\031"
+	.ascii	"\266\376t\320`\001\002\233\360\222t\276\354\264\004Zm\301PV\231"
+	.ascii	"L\n\375\003"
+	.text
+	.section	.gnu.lto_rcLookupThrottle.80.e232ba9da34a25fd,"e",@progbits
+	.string	"(\265/\375`p\001\355\016"
+	.string	"6\335dC"
+	.string	"s\224\016\321;h\372\363~\201 h\016F\313\264v\252?Ot\223\303\304!p\337\"\376\203Aa_]\002\331\024\277Y\254\342\245F\004\250\022(\324\b\001x'\321\263\373\313\264\375\317f\t\331\233H\231RO"
+	.string	"K"
+	.string	"S"
+	.string	"V\260e\332G\361\024\245\26328\263\353\341%\306\356\212\030\301v\030\222\331\366[n\242dS\262D\254\342\207\226\224\253\307\356v"
+	.ascii	"> \036\346\005\304C\rq\323\323\344\337\345\220\003JLurzj\017"
+	.ascii	"v\327\251:\331p\353m'"
+	.string	"\260-b\347'\252\342\317[\267\347\254\277\003\323\034\230\336\3044\027\323\232\230\316\304\364\026\323Z\226\2161\rc:\213i\205\351\314\322\017\240\255j\024\300\261\253!\366ci@\030\022o\375\366m\227|\027s\266[\030\266\323j{\261qb\307\356.8\f\244\303x\021\365\257\034\f\356Q\250 \257\216\252f\nc\276\024S\007\217\252\306\327\267rM}\nfK\270\013\323\266\273\016|\026o\001\362G\034:T\222W\035\372%\361\360\252\251\230\341\003\006u\343\216\211\035\365(\004\024\035\037\213I\306l\326)\025\204\375l\003\rD R&\002\221\324\336\2107\212\340\221t\036Ig\241\302\004P\347\215.t#\004\034\022Q\030u\244Ph\324q\254\275\252|4\004\245&\346\350g\243\251\034\375\227\302\351F3\031)\030j\3055\312\351\001\327\307\222\321L5\252\271\276\225M5\315(\b\217\257\304\246\006\\)XT-\034"
+	.ascii	"2\001\303\320\214\352\007\0044t\230\306\341\230@ PL@1\236rU\030"
+	.ascii	"\300\fl\267\f\251\331 x\314A5\201!\f\036\3410\234\352J\233\366"
+	.ascii	"\272&\346-\332x0!.\212BN]\006M\030))\246k\222\001"
+	.text
+	.section	.gnu.lto_generateRateCurves.82.e232ba9da34a25fd,"e",@progbits
+	.string	"(\265/\375`l\006\265#"
+	.string	"6\377\331J\220\026R:\3048\340SY\026\017\315"
+	.string	"\\D\033|%\2072|\222\360\023\231\205:\202\3542O\034\203t\352e\363\307\205\237\353\272.\206\275`\334T0\023"
+	.string	"\200\2447\201\177\n\207\005|\250\207\312\035n\261\260V\362\t!R&\031\306"
+	.string	"\264"
+	.string	"\314"
+	.ascii	"'{rs\013\030<\275\314)\255G[\016-\265)\265\"\035\214\255RJ\211"
+	.ascii	"\223\004i\330\211\024\212J7\324Z\022H\177\356\336\306\036\271"
+	.ascii	"\271\237\367\372\327\323\301\326,\205\242J\223biSj\255\005~\256"
+	.ascii	"\200\364g\320s\320\237\346o\320\237\317\355\323n\224#\215\365"
+	.ascii	"bF\244\310\264\324Zw\375b\373&\362{\343\247\343n\251\r=\315\346"
+	.ascii	"\247}\215\017\031\233\b\253\240\2163iR\230\t\220@\276\331\"\270"
+	.ascii	"\260\302z*\324\302\212x[\022*\242\031Tk\225b\364\352'\256\352"
+	.ascii	"\352\246)s4\002\224\251Ba*P\262\360\362\344yX\025\305}\344O\255"
+	.ascii	"4*-\254\260\316\266\b\265\326ea\225\3257\367\335M\356.\204]t"
+	.ascii	"C\373\035&\226vh\265\326\303 \201\376\fj\035\327\327s\\\007\211"
+	.ascii	"=\214\355\205\340\013\177\356"
+	.string	"C\240?\3379*X\266\020\177\274d.\"dR\314.\362\327\f\335i\025S2\304\324\242\230K\327Z\241\272\213\273H(~\355\255\335\242\207}\211\206\204\202\200~|>\366\355y\331\227\347`\337\035\224W\007\345\325\235\2749&/N\363\336\240\2746(o\r\312K\203\362\316\240\2742(o\314\311\013\203\362\346P^\034\312{;yS\223\327\326\274(\312{\236\274\246\311\333\315\313\315\373\0018\"\222\237d\255S\313.\365\310\371#\306\303\376\261\277\354\007\273\271\373\335\337\330\213\005B\236\231p\355\307K\03443M\323\367i\231\236i\364,\330E\324,\323_3&c\232\250\031J\260\013\246c\372<\r\323'\256XJ}\371\361\222\323\236\316\365P\026\220\227h>\256\034Iq\235\353\276\202\353\037W4\t\036\201G\326Zm]\\\243\253\023\250!01\205\272\247\207F\301\363\247\177\364*b\0065O\017\327\354i"
+	.ascii	"SR\304\212\240\267\006J\373\326\2663[\247H\037\342\263\365\273"
+	.ascii	"\f\371\362p!\276\237\326q\231\241\235\243\322e\306\006\331\242"
+	.ascii	"auvQy-'a\310\272F\313\245\225\250Z\177Dg\0135\237\005\273\200"
+	.ascii	"\274\\\263\317\266\355\bN\3516\373R_\224\376\243\304R\332}\353"
+	.ascii	"\301\375,X\304\375p\036Ni\255\265A=\246&\t<\037\2124\342\210"
+	.ascii	"\002\317\207&\365\230\232\220N\021JMG\346\362\020\360|\035xI"
+	.ascii	";^\322\016\204\322\321\322\216\347\023\261C\240\333\036\023\222"
+	.ascii	"o7\242\327\363\355r\310\372\327\336\252\3614\007\326\221_\003"
+	.ascii	"k\027\367\246\226\026u\253q\201\357\364\360\300w\332k\352\305"
+	.ascii	"\315[\027\367\311\337\216`<lC\275&\332\323>=\3345\360\235.j\025"
+	.ascii	"Y\312`\226N\357V\270\225*kP\204k?]\353\364sZ\327<Wp:G\212\323"
+	.ascii	"\223h\273\026\036\345B\272\003\303\322\307p\372\311\264\037O"
+	.ascii	"nZ\301\217l\006\321\246w3\\-\r\315$\253i\233\276O\327\364\201"
+	.ascii	"\030\2254\275\253\341g\253\f`\334\235\360%\034t\306Z\353\203"
+	.ascii	"$W\322a\367\210\307\017}\250Q0\004\221s\212Fd\202\244 I\263\006"
+	.ascii	"p\002\2311:n\021P1Ec\023\206\246\036\031\306b\032a\333\001J\311"
+	.ascii	"\265]\305\352\336\033Cf\206\034\031\0251\241\264\235\230\n\355"
+	.ascii	"\250Ii=\025#\265`*\246\005\212$\230@(\377I\234\230\264\217\004"
+	.ascii	"\353\253[\340\244\023\001\252\242\241\303RV\237\026_\325\037"
+	.ascii	"\362\204W\023\212\260\371\301\232j\264G\205\034\215\304,\222"
+	.ascii	"V\307\335E\322\232\313\270\363PY\242\377\231\004\216\326\273"
+	.ascii	"t+\261<['\257\344\345\211GS\200\004\202\306\017r\005\"\332\""
+	.ascii	"\273\343}\272\037u\037\256(\334\305zg\311\242El\207G|6\n/\025"
+	.ascii	"\216|\224\261\307\314\276\345\237\036[\006x[c\016\207()!Z\005"
+	.ascii	"\332<\202~`\233\234\321\002\357\256\362\354\217\027S$\226\220"
+	.ascii	"A\254\266\240`\220\334@\217\022\350(\3137J\301\202\336\023\035"
+	.ascii	"\200V\002\362TA\202\243\270\\\355\032\201M\214\217\026\3003\036"
+	.ascii	"Mo:\336\037"
+	.text
+	.section	.gnu.lto_calculateSetpointRate.83.e232ba9da34a25fd,"e",@progbits
+	.string	"(\265/\375`\201\0055\""
+	.string	"\346\274\327I\200ZR\007[\354q\216N\304H/\325{\337\355_\320\2056o5\016\\\037\363\337>\374jP+\"\334\022i\330d\277\367\277\354=E\336\036\261\376\353IU\231\373g\022J\274\347\333\223)\261\377P\255%d\357-e\222)\005\301"
+	.string	"\263"
+	.string	"\310"
+	.string	"I6\027\335\251c\367!~td\247\\G;A"
+	.string	"Y\351\305\215+\n[GBb\216\006\306^\321\244\245\033u\212\216\264\234\363\002\307\255"
+	.ascii	"u\334\335n\273]\210g!\271V/\351[\316Q+X\316\231A\037@\035\357"
+	.ascii	"\270\215\351\370z\215\351\270\221\272\265\270q*\237D\0310\220"
+	.ascii	"l9g\335\367p$\277\241\247\211\357[\244\366S\002\223\330\021\315"
+	.ascii	"k\230\344\267\002QLO\216\372\331\322\023\322\013\024\227\234"
+	.ascii	"\354i\303\315\016Tl@\304\274\2065\034\277H\207\252\275W\001\324"
+	.ascii	"XSn\030\2746f<\260x\227j?7\204qwr\316\216t\2534\004Z{J\3109\267"
+	.ascii	"\025\016\231\274q\336\335U\335\r\324\215Q\0046\237@\212\312V"
+	.ascii	"\363Iz\025@eu0\240 !!\323\361\371\373js\372\255\016\214\201C"
+	.ascii	"\231;\302r\231\026\314\371g\300\277\346\355\227Z\004\332%\t?"
+	.ascii	"\322+\232s~\320\356\345Fz\355V\216\333\307\302\272\320q;\013"
+	.ascii	"\323\261\377M\355+\210\222\237]v\033\201\366\211\335~\363Ku_"
+	.ascii	"\333:98\276\345m\343\\\3365\256\345\036\340\332\246q\243w\316"
+	.ascii	"\264=\203m\313\\\333\351\265\215\273\266o\3276zm\237\327\266"
+	.ascii	"ym\343k\373^\333\177m\333k\333\007\340\312\314\020,s\236\261"
+	.ascii	"\f\223\225X\311\0177\272o\271s\371w{{\021\357\352N\333\205\023"
+	.ascii	"i|\026~\333\021v\205\366\203\307\225-\343ZP\347\225\272u\036"
+	.ascii	"\347s\336\221~\240\230<\242\021yb>\261\223Y"
+	.string	"XS\370\245pO\240\211\313q,h\301\370\024\2304\260\353b\260\250.\356\235\232\250<]\221R\206\373^\335\246o\273\250W\350\343\336\307\252V\265\b\2649\347\244_\273\333\032@\377\304\321J\320\202\351n\020nv\364gI,e\024\364\377,\031D\353w>\316;\231Z4\337\376\371&\231\n\205\377\337\374\234\373\370\007\324\374}\0352\265\b\f\341dG4cP\376!Piu\213p'Gi\324\312\226s\320A\223\021\351\331\021\254\234\363\003&.V\302\304\216g:\266\237F\255mZ6\311^o\246\302|\316\"\2226\247\235\202\247(\205\321\256\247\033\362\365z>\236\016\256\350\304\204\037\024C\273^\317W\201G4\343c\264\373\340\243\002hhw+\nj\261\273\315\343\341\021\231\340\375\350x?\272\241\240]O\307#*\322\361\334\264o\205\017\221\316\310\347#\322\245\306\237_\177\251\316\020E\371{`\337\326\270"
+	.string	"Y\020r\244\337\264\252/B\265\237\024\315\337\336\364\002\264\3136e\276\311=\315\267U\327\200\267\231\337r\241\301T\026\327\202A\303\206\r\246c\027\252\345~\346]\255\nM-\373\331\245\373\020B)\321'\266[-\2012s^E\330\030\213\363\271W\222q\016\246\314\377\034\253x\025\267\302\241\335\252=\364X\027\366\230\216e\336\212\306\025T\226\323\371\304\356\361\202\323\357ar\275+j\250Q,\207\230R\210\251\022\205\305\005\005\311\001\200\002\221)\263n\021\2009e4\322$\313\030\302\241\"\b\253F`\315\224i\223Iv\026\217?\311`\006\223\342h\260\365R%qr\206N\241s9A&\326\225\340u{\326\340\334\255\207\350~ \333\027\231\331\333\224\036\016K3o\250\250\035\2065\030\"F\263x\013\004\352SjW\275\022 \204:\211\304z\331\001cp#b\260q\2666\n\261R\374/8p\333T\023\316*"
+	.ascii	":Z\343\303\356}I'\373\237\377P5E\206\302\006\303\355%n\022\237"
+	.ascii	"\270\347-H\007Kpf\r\3111\255\372`\374\376\022\0321\2377\230\273"
+	.ascii	"_\240\267\357\325\226\266\374\007R<\240\013qH{R\220\254\203`"
+	.ascii	"\226U\311r\220\326\017\343@c\200d\016\037\004\303b\302 '\237"
+	.ascii	"\362\326a*"
+	.text
+	.section	.gnu.lto_scaleRcCommandToFpvCamAngle.84.e232ba9da34a25fd,"e",@progbits
+	.string	"(\265/\375`\026\004\375\030"
+	.string	"\306.\236G\260\032Q:\270\232G\312L\325]\006Q\350e\026\003\233\253\031Z\316 \310p+\350\355\205\030\203QQf\r\253<tsu\236~z\344\374\354<\224\332\376\241\263b\357Ph\347"
+	.string	"\246\350k\361\032Tk\215l\"eJ\001\210"
+	.string	"x"
+	.string	"\220"
+	.ascii	">\216i\007\217&\004\3069S\364\272\314\235\324\341\370\355\307"
+	.ascii	"}U\365*\355\337\307\207\034\342<\266h\250i\242\304\220\240\001"
+	.ascii	"\245K\237\307{\350\374\346\261\264\243b%>\311]\231s\022\270\264"
+	.ascii	"\200\322e\3536\340\345w\025xi\035\333\312q5&\351G\210\207h\313"
+	.ascii	"\234\323\2654\256\363oU\307\377\320M\265\236\235\177,\276_K\311"
+	.ascii	"\216\347\324C\373X>0x\037\272\232\350\231\251\222\030\3149\255"
+	.ascii	"\265"
+	.string	"\236\025\267\274\355\006\266\r\330_\213\366\213\036\244\202\017d\022\027.\200\227\272\001l\2700\206\023e(\315IC\340\3778\220\r>\320\245a\036\364\265K\337\003x\371\ruMx7\231\366l\334L\367\307\3767\347\234^\037\373\267\273u\334\315\222\352\033\251^I\265\215T\327H\265J\252SRM#\325(\251\236\221\352\223T\313Hu\214T\207\240\032\346S\233\244\272$\325$\251\006A\265\224\352O\252\367S\353\247\001\340ek\327v$\244\223i\257\300\223xd\325\230s&\360\217\034\311\003\b\021\"\200\227\254]\033\024\236\356\2231\"\3029}-fm\t2\341\306\300lhZ\230=\317\027\035\021\323\2063\236\b\335J\353\347>z\034\341\234sF5,(%\255\235\363\322\327J\333\242\355\216=\036\205\227\0231\246\027\364zZhs\312p\300%\355E\333L{\226\013\256V\021\257\310\275\016\240\221\347\313W\310U"
+	.string	"\025\325\260\234\213\214^\220\335\037\335/\205\037Rh\312%\0324\300b_\210\034\021\353\327\201Wl\302\313\202\353e\301\305\001C\316\006\327+\366\301u`eX\207\n1\027\b\030,\346\nq\262\177s}\354 \307N\2663\177KeJ\312\313\356w\263\273\332\232\275\331\035\"\276\230\241v\265$#\321v\332\232}\320\215\"\321f\263G\036k\240|\350*\242\032\026\231\217jm\026\3242\323\036o7\347\2126\247\f'\265\252\265\212YhvfS\273E\304\240\326\242\226\306\tj\025\330`\355igv\247\rg\034\361\226\234\211G"
+	.string	"Q\214\364.\022F\250Q,\346\024RH\261\241\244\260$-\264\030\240\002\021\2619;\02101c\214\211\220*I=\032\003\323\211\223\324\250\344h\353?\317\264\375D\345\006\202\250q\r\034\236\253\201\275\277CO#\fL9\035L:\321\335\320)\003\\\016\266\323\215\365\217 8e\007\265\325\242\331W\321\252\220Kd9*\240\020\272\323\"\323Z\216R\005f\301\251\257\274\251g\304w\356+\207\320\352\274\n\226\322\262\203;{\"d\264Y\260Qk\272p\355\330\305\202p\"!\305\377\213\r\025~"
+	.ascii	",\byqF\345\344T\310\024\222\376\001"
+	.text
+	.section	.gnu.lto_checkForThrottleErrorResetState.85.e232ba9da34a25fd,"e",@progbits
+	.string	"(\265/\375`|\005=!"
+	.string	"f}\322I\220XN:\205\352\372xg|\205bc\307\245\006\240,'\237\213\244\0164Y\006\360\nK\f\0173\033X\333\356/\220/\335\312\343\262\366O\\'\025\002\211\004\3373`\r\213\224\230\031\317\206\222\036\"\253d\033!\204\020)e\n\272"
+	.string	"\254"
+	.string	"\302"
+	.string	"{\262\311\344\277\337\"k\344O_b\211\374\264\021\206G\2555\335\362/\361\247[\356\nY\343\323!\373%\265`'\320\037\025Z\304J\026\007\350\226Cd1\005Z\305P\242\025\265\264Z\253\201-\237"
+	.ascii	"e\376\027\310\006\221Z/\025/k\255\341E\254\326\"\202\017@\267"
+	.ascii	"\274Y\036sK^\035s\313K\375]\266\250UO\243\331\224\221L\2555\327"
+	.ascii	"Y+\2657\033z\232%\331,\365=\221l\304\252\337\336\210l'\222\215"
+	.ascii	"\0272\026\235B\025\203\250\213\352\212O\2535\247\206\\\302X\362"
+	.ascii	"V\005c\273\246JH\016\325Z\327\270\314\242*\310|\"\325Z\317\304"
+	.ascii	"\252\027\373t\377g\375\037\361\227\034\002\346\277\244\343%v"
+	.ascii	"\257q\323\032e:\324\322\204\375\373\016\256\327\310\222>\264"
+	.ascii	"\304vd\021\001#\324\257\262_brGq5\331\026\352=3\265\006\344\343"
+	.ascii	"O,K\300\004\320\333\353\305\0256\364\021\344\343_\frc\375K\326"
+	.ascii	"\276\361oqo\324\374\242\346\023-\330^h\275v\0014?(\345\003\245"
+	.ascii	"\374\037\346\373\240\374\236\033\237\207\371;\314\327\301\361"
+	.ascii	"sR>N\312\277\241\341\3330\277\206\3718\032>\r\363S\346\337R\276"
+	.ascii	"\r\345\2437\376\211\362M\224_\336\370\244\215\337\314g\224\277"
+	.ascii	"\005\326\352\370\325\002\301\230Z]\034\315T\264r,\307\026w\301"
+	.ascii	"\002jW\247\201\275\322_\306\220\001c6\326\231$\352\335*\363\352"
+	.ascii	"\242\016j\026\270N\373\307\352\307\327\031M\377\017\261V$\004"
+	.ascii	"\320\242\262U&\220HJ2mM\323\245qh\226\266\224%~\271u\332;\244"
+	.ascii	"\0214\333\263/\201:\331\311\314-omt\264Q\036\306\340\373d\241"
+	.ascii	"P\370+(\361\022\225\314-m\215\353\022\2436\006\344#Y\242M\324"
+	.ascii	"\\6\265\006t\362\20429\233\2170ivQ\357\201-\333l.\033\256\005"
+	.ascii	"\217a\311T\240\265\326\005_%&2\240[\"\314-\313\266y\001Wl\223"
+	.ascii	"\210\370n]\303\006^\342\226\337\r\275Qp\\\001\371\270\\k\375"
+	.ascii	"uc\235gv/\327\227\026!\2279\016\017\325\355\020o:\202j\212Z\342"
+	.ascii	"\345\234z<^O\027\004"
+	.string	"\225d\363a\267{R\372\340\264\304\343\365\036\350|5\273\250%\013MP;\037\323\316\002\n\037\356\272#\235\257\203\216)\247c\3129\201X\342\345t>\250\334Q\317{O;_.\252\327\363\345\322\"p\311\3327&\034\321\200\035\374\355a\313\251\0314a\377l\001\030\250\377\007\020x\211\037\022\366\357\017\333\340\212\031h\365\r\216\307.\302Z\201\002~\032\250w\330\345\323?\275H\206i=\355\323\033a\323.\364t\341i\233\256\265\036Whc}\247u\332\303\227YP\357\364\317\231\234\3261\352\234^\262\034g\30328mdv\323\266\306\351\035\352\260\351\233>\215\3034\017\313E\002\272\305\246mcYjZA\227\231i\250a8\004\215S\246J$\210\244%\005-\034\220\002\0211\263\016\020XV3%\351\307\344\b@W\307j\312\200\223g#J\374\212\006\250\006\270\t\005\212\003\232\205Q\375\207E\303`\312\303Z"
+	.ascii	"b\201\b\013\331c\273tk\\#\234\357\007\177\365s\005\317\311\020"
+	.ascii	"\301:\n\\\343\221\024\005\270\271\345\032(\002\212\002t\035\241"
+	.ascii	"\344\001\f\253\340\350\237.\236\267G\304\265\225\365W\202\253"
+	.ascii	" \032\204T\354\375E\357\313\231y\260A/\330\346S\267\n\323\251"
+	.ascii	"\326l+\202lf\033\271,\333\271H\266\301eF\322\322.\231\204a\225"
+	.ascii	"\236\315\255D\240\345e\375\273\2217\317Kt\244\0379$\254\2058"
+	.ascii	"\rw\257=\241C\005\213\232py\224A\371\373\363\212\361?m\310\304"
+	.ascii	"\322w\305\3507x\b\355F\337\037"
+	.text
+	.section	.gnu.lto_rcSmoothingFilterApply.92.e232ba9da34a25fd,"e",@progbits
+	.string	"(\265/\375`\220\017\305I"
+	.ascii	"\312x\214\032<0\244N\0075\006\376P\306\364w\356>`\f\202U\306"
+	.ascii	"\001&0\024\252\375vi\nLB\371\203;\267\263\317sO\275N\330\251"
+	.ascii	">\320B\265\245\277\210\377w\267\335\323 \241&$\245\224\002\230"
+	.ascii	"\001r\001\236\001\335x\272\355t\313\351\006\354$s\347\351\353"
+	.ascii	"k\024\344\276\263f\226g\210\367\210\260\016\035\356\301+4\275"
+	.ascii	"vN\305\235\"\336#A.Q5\254\342\265m\313\3149p\372\320p\257\341"
+	.ascii	"\3062\023\220\007\257\021\265\353\327G\327\342\356\365\037\220"
+	.ascii	"\206\303\277\207m7\375\206\333\257\017Z\326kxiW\310,\343\356"
+	.ascii	"cf\263i\276\262n\343\343\032Q\233\232\302YYl\333\366\331H\366"
+	.ascii	"\272\215\274:\002af62\311d\2060\001\332zB\332\251\215\036R+\334"
+	.ascii	"F\262;s\343u\036\264\321\020ad\333\272\355\221\323\266z\rX\353"
+	.ascii	"6\322\251\235\311FzG%\033\311\fe6\324zq\255\022n\016\t\337\243"
+	.ascii	"\266m\271\036\216J\351\211\217}\324k>\"\241]E5\345\224\212\202"
+	.ascii	"zrjbj.1\225\226W\231D\036\337\312\241\334F\272\252L\036/NE\327"
+	.ascii	"Sue\334\351t-\365\3066\327Qsj\2708\324\365N\234?\311\265\223"
+	.ascii	"\212<C\271n\272\323X~\324\256\307\253\300+\316T\355f"
+	.string	"\373Q\263BX\365%%\007\2547\266k3\333\217\032\2259m\256\204\265\205mJ/\347\364\321\314\231E<\3067\266)}\373\215\215\332\312\343VU\017\024\2465$Gg\237,\204\372\217\352\311:\265*\336dM\352\310\343\022\242\335\024\246\265#\307\bm\177\210\215mO[\213\372Q\t\f\224\376\013\245\255\374\250u9^\265m\333j\032\253N\355\316]\311\241m[\366\351\032[3\200fv,f\016\302\334\034\024\f8\341\223\337_\316$J\027\t\fb$\224|+\237>>\231\242\213\260o5\235%\270\207\021\371V\216p\375\021\217\274Z={\301\247-\370\177\017\205\022\376\0379\210d\322\231g\333\303\220Ys=2\203^\360#>\031\306LVZ\215z\226\375\021\031+@\021\020\214\343\236i\2423\317B\347\372\220\261\267m[\013\334}\332O\f\356\271F\262\214\0313\276\261\375<\324s\027x\346\331\357F|"
+	.ascii	"\005\377\255\334\235\201P\021\241U\367H\366\323\330\023\204\346"
+	.ascii	"\220\230{O\027\366\340\236c\2600\357iX\262\221\375mV\312T\363"
+	.ascii	"\250g\236e\326\213\372[#\321%z\341\327\302|\235]\\\347\026\327"
+	.ascii	"\231\305u^\261t\376j:\315*\256"
+	.string	"s\212\353\214\342:\237\270\316&\226\316^%F|\3507\315\030.4\232\356\t\255\327-\201A\333i~\266\234\346\255\006l^\340\316\n\256s\002%g\004\327Y\253\3614\037P:g5\235\r,9c]\347\253\246s\201%g\002\327y\300u\026\320t\016\260\344\f\340:[1\235\253\224\234\251\256\363\324\322\331y\235\245\256s\324u\206\272\316O\327\331\351:7]g\246\353\334\274\316K\356\314\274\316JJ\316\313\353|\227\316\312\353\234T:\037\335\371\257\263+\235\373\305\001\267j\025\270.\237\250\327:\3116\266\206\310@\272\246\323\375&Q\337o{\205h\016\351\351\245~\253\220\264\016\352\243>\300\240\364\321\323\273x(w{\312J\253*V\363\250L,^\305\267h\"\"\\\361\275\330,\276~\205W\277\232P\253\370\036l\255'\200{\211m\3608}\225\246o\276\323#\371\376\020\355\3346d\263\220\230\276\351\003"
+	.ascii	"\222\3265\177\351\231\276\245_\242\336\326\374%\225\371K\314"
+	.ascii	"\357\300\346:L\334K\354\233\264\364\326\356\221\344\336\343R"
+	.ascii	"\004\021\037-b\276\225\233\256\313\017\217\024t\237\275\365i"
+	.ascii	"<\230\334z\207\324S\250\364\211\242\264\365\037\276\027\235q"
+	.ascii	"$\255F\2370\226\200\263u\025\217\017\031Ws\322\344\316\227\244"
+	.ascii	"u5\3374\211\006\217\360\214'al\003G\322\245\025\347R\244\244"
+	.ascii	"i\"\245g\206\3469\032c;\216b\333\266\024\242]\315\027\347gV\222"
+	.ascii	"\256\336f\225\276B\226?\214\201W\256\374\373\313g\356\340\301"
+	.ascii	"{\312W\3227\302\334\2159\244\024\247\327\216\324UA\221\261!\205"
+	.ascii	"\030A\202D\262\221\313\357\251\024G\367\227TF\312\3579\355rV"
+	.ascii	"\032_n\371V\376\252\243D\261t\023\374r\b\233lD\235\"\205\"\306"
+	.ascii	"z1`\253\351\005O\n\367\022\375\022\335\023\217\341Q<\273tQT\252"
+	.ascii	"K\240$\345[\031\333nm\333\336\277v*\024E*\212\016\365\230X\304"
+	.ascii	"\326\266\007N|{\275\211o\351b\033\352C'R|}%\033\351\365\277\207"
+	.ascii	"e\244\236a\373\255\317\325\260m\031\001Z\333\236ea\370\366\353"
+	.ascii	"c\340\335!)\236\344s\013\352A\214e\301\200\001|\303A\331\r3\260"
+	.ascii	"\035\\"
+	.string	"bc;v\214\205\001\bS\016\021a\303\306\230\231\217\260[\246\243\206\230\030\330\r\017bc8\314\300t\214\361\300\341,c\241\003\354\007Y\r3\261\0215v\200\221\201\bB\366\304a\016\302\310f\204\331\340\n\263\301%\206\003l\007W\030Y\031\227\203)\036\343Q\203\214\313ll\214\214\213\251w\326\034\316>Z\225\247\217`\004M\225x>J\035x\006\f^\201\202?2\352>R1\370\022\237\254\222&QZM\360\202\214u\306y\340\003\232&z\340Z\217\340\n\024\213\3674\301_\035ql\216\002q\200]\335&\016\202-\016\307O\353;O'8\314~\333\037\"\230\251\254/\342n\262\242\216\030\235oe\217z\266C=\273\363\364}\224\005t>\373\300\2471\242]\233\034)\003\317\306\333\3609\326\033\270\302R\343u\305X\240\201\247AC\340\013\f \020UB\305\320\220\200\037\360-\2553#\340\225\321Fw\324"
+	.string	"_\006\232\305\031\347c\234\f\324\n\205\203\312\311%\001|\200wFH&m\271U\027(]\262\247"
+	.string	"\376\n\355\215\260\3331\366z\235\325+\243\214\030\003\317\032\343\024F\275u\331B\222UO\266\027\310\2758\235\020(\030\250\235\367\024j\227ld\225\226\"FwP\202\234.\274\362\332\364\354\247C\351\347\377\225\3430Y\364{z\376\205\357\306\274Di5\352\374\251\247\022\343\\rL\305\371\265K\203\242\034\025\334\324/\251V\347\367\235\326\0224\304H\035tr\341Y\002\333\343T\tU\363\250Mb\032\03355[\034\005\277\034\352[jD\355\342\323\244>\201D\250\201(\006\231R\210dDD\222\024$i\fA\005\304\030F!K\017\021\020\251d\f\315\214\220$\205Jk\223\302pu\375\363Y\245w\332U>\325\b\234"
+	.string	"UU\245m\251\334\013\033\214\246\022Ql}r"
+	.string	"\376\317\034\031\334\bYB\004\002\213[c#{"
+	.string	"\245\264U\251>\024g\f\030\314\374\323\251+\351\243\317>\270\241H\207g\276t\325"
+	.string	"X\374\346\272\250\332<&>\372\006\212\255\313\n\247|z\310\327\212\n\021\305\303p\327\227\347\366m\341\300\347\202Ke\3008/\302\225\300\270\337m\337)F1'\223\265\343\037T\201O\016f\226}&\321\325(.ko\033\3225n\200\327\264\342I\264\2679,<\023\212\203\213\030\013<\202\267\030\250+X:\275N\023\307P\364d\363\004n\354T`\313\334\314\214~\353\225\335\222 ,\236\3101"
+	.ascii	"\335d+\312 `,\3527PB\325Q\370\253\234V\273>\310\033\334A\335"
+	.ascii	"\350\006\340\002\276\035i\271\\,\356Sh#\272\220/!\361s\027\266"
+	.ascii	"\322\344\3017"
+	.ascii	"\004\313\177\271!A2\301T\032\004V\341\023&0\245i\315}2\373J;"
+	.ascii	"\250|>2u#\247n\256E\233>\372\233N\257]m&\202\330\r\351\331\346"
+	.ascii	"u\367\377\331&\035s\323\260\375\361a\356Q.\030\n\030p\235\274"
+	.ascii	"\017?\300\275\347\270M0\373\354'\355\204:\277\306\025|\017\254"
+	.ascii	"9^\r\323|=\216\214\001&\220\030\016\027Rw\215\326\312RQ\332`"
+	.ascii	"&\265czR\251o\277-@7{D\337A\016{C\224\355\215\266\376\254\335"
+	.ascii	"6\354\003\007IKS\017\354\325\2236j\315\3039t B7\243B\203\271"
+	.ascii	"M\251\344;\213VW\331\200\007Y\365\244}\303\016B,\200\326\301"
+	.ascii	"\3354\024\277U \261\324\300F\022b)6c@C\274]+y\322\350\t\300\300"
+	.ascii	"\2430xA\nl\356\260\233+C\004:e\020\3155\246\365@O8\205\312Jy"
+	.ascii	" D?\216\306\225$\252X\231\240\252\035\030U\374\321DH'\023H\f"
+	.ascii	"\216\257\265\240\203l\350dV\253\301\031\347EA\211\235c7\004\227"
+	.ascii	"\234\330\235S\350\341\202\350@\177h\307\303yg\373?w\303\3536"
+	.ascii	"\304\024\005/A\317Rs\343\2443\324?\317\227=|@?\002#\246}\bl\360"
+	.ascii	"8\277\345\340\202\201`\236\223$(\254cOi\241j\020\332\2441]Xi"
+	.ascii	"\220\\W\021-\361q\333i\342A\020\351\bA<\277\221>\376"
+	.text
+	.section	.gnu.lto_processRcCommand.93.e232ba9da34a25fd,"e",@progbits
+	.string	"(\265/\375`p\022U["
+	.string	"\252\227\254!N0\220\322\032\003/\323\"\253\277\200\361Y5k\221\347\035\357\356\312\311}0)\206\372\003\f\314\206\325\266\206<\017\344\017\215\317\345\266@\001\334F\246\bK\303t\035\357q\f\211`\r\335\024\374\177*\035\021\021\221\225\373\006\327\356\022\"\245L)\245\007\002\335\001\r\002\374Eg':\367\225\023_4\bZ\330\177\241\276<\006\323\274z\254\235ZW\273\351\272\345\272\333\272\251\335Mz\350Bo\235\365\"sO\2516p\345jXg\363~\241\005*\351\027\270\347\330\310\035\245\245\270-\307xD_\324Wl\202:0o\325\260Y\242\265\235\364\023f#w\320/p\001fh\242m\357\373\032\233e\356\200\331\330\354\332n\355B\307\261\261\211\215\341\253D(\027\006\312\227\300\260\337\032\316m\352\r\"/\352\373l!%\212"
+	.ascii	"\303fmZ\3316\353\235\3236K\342\204\333m8\210\272\250/\017\026"
+	.ascii	"R\362\332\320\274/\265\251YN\0326\3532\217i\352\331\333R\300"
+	.ascii	"\234N\320\274\357\013\365F\376\205vx\355\225\332l\263\272\rB"
+	.ascii	"\351C\022\322\221Q\021\321\220P\020\320\217O\217\007\236\035"
+	.ascii	"\345\222N\016\316\215M\022Ys4\026\211Ca\313\256\357.\267\373"
+	.ascii	"\320\302\374\"'\326\325 \362Z\251\332\037\326\2360xR\265\316"
+	.ascii	"\221\232\313\263J\347Gsm$\327E\253\222\313SneZ{Jq\242\225inU"
+	.ascii	"F\361\241\325\006n\025\341\346Bo\0354\245\327\265+`\336\032\250"
+	.ascii	"\255\177\332Zp\237<&\3363m\017L\232G\255\356\004\337)2\226\244"
+	.ascii	"\225\355\225\244\227V\237(\226\036\315\3459]\223h \202\303\025"
+	.ascii	"\327\311Ik\234\346\362L;\3427\353\321\006\024\2004\227'\332Z"
+	.ascii	"\202\214\316\206\236\033\3426E\306\316:)\214\232k\030hYr("
+	.string	"\033;k\344\3323\3525H\204\370\321H\234[R\024F\255vt\324\266\277\262\261 M\004\322eO\262Vy\004\017\t\027\225=I\370!\227'\333J\364\276o\307u\321\332\023\352\302\242\2621\265n\327\0229\320\004A\2129\327#\240\263K\323Y\037\275\032\305\276\374W&\276\030\314 \305r\254J\036I\300:\256=L\214\351.\214z\337\227\035Ll\254\231\251\231\337\211\231A`N\"\t;\224\021\276\324Uk\271\367z\214\253\266\201\273\304]\3226K4\263\302\326\367\301\211oT\301e!\307wq\361\215b\212O\204\306x\342\223\220#\343\024D\312\301C\254}\251\215v\3703\342\302|9\340\264\277\3300|6\205*S\326\310\205\317\354\272\271p\336`L\324\276\360\333)XC\373\177w7\205z\371`\316\232s\272\276\364J\263\277\034rf\251\001\274\301\330G\332\301\3511\277\213\327\347\336\322z7\262`\300"
+	.ascii	"+\003\300\257\337q\255\324\245\312\374\002EP\b\206\305\003\360"
+	.ascii	"\354M3\035\244\204f\274\366\237\305\367\223^\231\234Mq3\362\244"
+	.ascii	"\217\351\203\374\343k\037\3202#\220\2007\330?\322\230\233\336"
+	.ascii	"\327w\261\240a\311\f\377R\316\240\365\237\021'\346\313\001\231"
+	.ascii	"\333J\347e\300\235\306\n0\300\300\367\230\365E\335\240\3366\332"
+	.ascii	"\376\030\357Y\232Q&\313\350;\033\303\367\375B\301m\327T\036\340"
+	.ascii	"Nk\226#\220\300\033L\202\266\331\376+3\275\250\333\233\227\017"
+	.ascii	"2S\231\376R\346\356\265\017\302\230\374f\314VG\347\252\031\025"
+	.ascii	"@\340@S\233et\223\346\030]m\216j\272\346\027-\327\354\"\200\246"
+	.ascii	"6\2670:\003`tfqt^QtVAtN\201tF\221t>\201t6At.At&at\036Qt\026Q"
+	.ascii	"t\2062:?%\235\235\222\316!\222\316MHg&\244\363\322\2153\210\033"
+	.ascii	"g%\244\363\007\244s\222\2153R\322\371\310\350ldt.B:\023\3318"
+	.ascii	"\017%\235\205\210\316AFg\240\244\363O\322\331'\351\334\223t\366"
+	.ascii	"\220t\346A:\357\3248+k\234uj\234s\212\3168G\347\033\242\263\315"
+	.ascii	"\321\031\331m\315G\243\263\361\350\\4:\023\211\316C\243\263\360"
+	.ascii	"\350\334\026\235\331\243\363j\364L\277\214;\302\364\304.\202"
+	.ascii	"S(\240\316\322\031\210_\372\301\301\246\240Uz\020\337\315(\363"
+	.ascii	"\225\244\037\236x\227f\n=aB\bm9IO\244\f\351\223\216\036\351\273"
+	.ascii	"\251\305\350\217\376\2754\371\262t\321\033\275p\257\311\244g"
+	.ascii	"\350\242O\242bE\217\350\207\270j<gB<\352\352\bsw\354h\207\236"
+	.ascii	"\350\037\317)\250\302\205\304\\\021\332\006\033z\007B&\364\302"
+	.ascii	"\027\374\246v?g\246\006\234\2272\261q\264A\337e\356\303G\300"
+	.ascii	"\341\303\375\361\243m6(\205\276?\350\315K\271\204\\\262\202g"
+	.ascii	"\305 \233\332\305\207\271x\240\227\322\022\343\201\236\365\322"
+	.ascii	"y4\354\255`\023\242]|\005\337\262\325\221iF_\004\256\006\201"
+	.ascii	"\031\323Z\367\300\312\370|\317\377\274O`S\206\235\367\371\237"
+	.ascii	"\272&\237\207\347\371\236\027fi*a>yp\340\n\361\360\r\003\232"
+	.ascii	"\235\227\357\340\352\360}_\025\354a\016\202K\346\222\340\n\021"
+	.ascii	"\3226\313\363=\327N=\310L\355\274|\360\317$w\236{\317u(\177\347"
+	.ascii	"W?\247\240\316\347\274\362\273\311\204\351Mw\272CLp\211\020i"
+	.ascii	"\233\325y\"\264\305\347|c\251\333r\243\247\006\207\274\321\266"
+	.ascii	"\370\025En\210\353#\252\226\300\232\227\262K\311\004\215\020"
+	.ascii	"|\223\025)\312\370\016\374!Ht\340[|\0303\343\374\322\2318\377"
+	.ascii	"w{S(\340\321\311\231"
+	.string	"]#.\2327\030\004\217DeH\353\320H*dz\306\227\006\366\315\313\370n\256\331\374\315\177\240S\320\313\007\221\370;h\343d\346e\372\206\2469\252x\243E\276\003\377\201\315(3\r\362k\272l\371\203z\3715N\032\275.\017\344\301\013#H|\351\0377 \217Y\273\344=\330\373\232\341>\303c\206\336Am\263\354`\257\216\267\245>f\036\263~\201\276oWG]\347u\242\321\361\275%\274KU?\246\374\361}\271`\231\f\334\023\030 \366\310\302\326\307P\272\334\376\206\334\200IL\320\241\206\016\301+L\343I\213\306\326\324\025\024V\326\325U\026\225\217V\r\017\246V*\241\226U\025\026\326\024\r)\254\254\032[SVY\032,\253\266\260j(ihU-1\250Z\300\203e\315\026\226\224V\r\017\004\250\332\232Z\240jk\312\212\003*\253)\251\254\006l\\0U\265\374a\252'\252\245\005T\030@Qa"
+	.string	"\205Uc\352\n\212j\251\005\365\264\303Y\032T-\241\266\262\262\226PF\252W\277\031\313\002\365\217\317\353\2319@\274t\013\213\227\205\255O\311"
+	.ascii	"g\346\332\343\"\203\254\222C\233f\207\231\017JmU\357(\022\027"
+	.ascii	"\246\225\332\025_\365\354N\250\313p\203;\215\271r\200\261\342"
+	.ascii	"\373\013\232'\251x/C\200\0135\227_\313\314u\206\353\317\033L"
+	.ascii	"\3057\\\t_\337\325LQ,=\220\370:\305/\271v\360*\216\227\342Y?"
+	.ascii	"+\177o]G(\236\234\212\253\246\264;\361(\336\375\232Z|\nW\207"
+	.ascii	"0x\225+\220k\320\355\352j\233=\361D'U\246vF&^\316\351\346\030"
+	.ascii	"/\212\211\027J\361\246P ,Q\374\212\300t\t1\376\304\235\224x\241"
+	.ascii	"\nw\177oMM\240\344\021\275\224\375G\223\370e\034\211$\277\273"
+	.ascii	"\241\227\362\b\031\202\254\236=\002\324\324QQ?\342\245\266\004"
+	.ascii	"\360#~\255[\205\242\336\352[ W\3104\243.<*\207\353\354)\335!"
+	.ascii	"T\371\367}\273\202\342\272\211\004'\224\037\207k\366"
+	.string	"9~"
+	.ascii	"\037\306@/e\352\373\276?k\0177\216v\007\211\016g\225\307\033"
+	.ascii	"G{\024\361\313\2707\021\377xuS\350\373\276\257\017\324K\265A"
+	.ascii	"\275\320\013\335\037\264\313s\204\017z^\312\304\2004\266h[\237"
+	.ascii	"\227\017:\233\224\264\024\242m\036^\312\\w\246/\r\217r\306\263"
+	.ascii	"b\226\232\372\305\213\177z\352\030\334\002\307v^\374\214o\331"
+	.ascii	"\252+p5\350L\205\206V\007\235\036\005\256\"\235\255"
+	.string	"\205\370\246wz\026\257\031e*\341\352P-\304\247\bc\347\365\372\tiM\337u\275\3645hd\356\207\021\345K\271{\251\214\227\033\226\336\214L\007\201u\250\201,%\rS\250DFD\222$\205Bc1\005\204 \346$\224=\021\0201T\320\215H\222t\247r\006F\322\004/\035\036[\332\353\216\340M{\221}\262\234G\033\337\331\026\231\251\343\320\265\033\314\t\022\016v\354\220\n\366\232\274\301\377\341\273>\326^\001+\333(\341\316\036N>\200\002\276@+\007y,\323l\302\321\003-C\220\325\276#\210[)\024r\177\036\204g\255\250Q\261C\362\r\023\023\366\2136\n\037\356z\204d\224\027p\245\273I\240\234D6\367\247t\340\203R\263\023\343\230\\\202>l\342\375q\236Ad\026\353\242\032\333\025`\235\030\264\3550\320\003\005\371r\2052bl@\335zD\273\314\216r?\255\037\rm\324\004Fip!\366"
+	.string	"\275\265\036\261\r+\266\273\332I\275\366f\252\351\013a\021\213TR\355\361\031\320f&=\234\346\361\260\245\035\300\013\225x\205\210\371\253\304"
+	.ascii	"\375\271\336\221y\351\321P"
+	.string	"\255\210B|>\2671#\366\201\235\331\315\267\336\200\200\331&\243\335\027#\372\006f\303\377\361\223?\017\251\001\357\203/[\324B\034\204\023\0041w\352\2747Nr\227\177\351\350\362\224\025\243B\322\264\220\360E\273\272\005\210\347\315!\355BC.P\216O\312{\362\332d\271\303\246r0w\023\234\022G\277 \361cxD\266\022\362\2504\264\235\007\316\256\373T\315\271x\315)\307\036\001u\005H\254\272\322\017b?\361k\356\342\t\215\363(xjaXi/\206\372\300\b\0076\213Q\022\032\200/\317,\300\363\265\001\212^6\037\317\221\250\270\226g\355SM$9)Uf\233\345\310(\262\234\307\330\211\2419\024\b\252\226p:\205\216\362.I\251_\217\341\021@\362\030\376df\250+\371d\312\343\340Q\007\272\227\305\313\004w/\017\234(*T/\314\030\304Sb{@\024,\201\2030\363J-Q\3648C\274\321P"
+	.string	"\331S\233\361EKv\035\360\231\242\271K\3518\205\360\227\311\245C\210\217\030l\221\3774\365\005g\027\357\"\316\036\237h\024:,X\201\323C#\034\025rr\323\3224d\324?\003\313\306\222\320\352\007\267\036\b\203\207\251\272\024>\320\374\263\246\033\234F9n\325i\031s\001&B\312\021\034]\331\364\007\246\344\241!\344RA\231\360i\235\312\351\013\276P\340@>[(s\233\330\327{\240\237\214\244\216;\036\232\006N.0\342\026\362_\003\006K2=X\307\312\310T\217\202\310\307\323p\231\341\341Q\347\022\252\305\021\224\264C\201\323\016\371x\365\034\233(\204T\206W[MY\352\277\322\221"
+	.string	"C\332\327\217\252\241\265\234\250!fB\201\363TU\232\365\313\363u80\312\205\346\3720\037\277\236"
+	.ascii	"\331\276\223j\300\326%\220]\263\253\225\346}\237\241~\366\200"
+	.ascii	"\351\2729WM\362\037"
+	.text
+	.section	.gnu.lto_updateRcCommands.94.e232ba9da34a25fd,"e",@progbits
+	.string	"(\265/\375`\227\025\205h"
+	.string	"\212\261\234&L \322\312I\0079\230E\300\177\\\255\306\276\177\224\257\217$\221t\3617\232{\367\234p\207\322\254\246\275\327&\024\353\223\355\356\236\030\2303\357O\020"
+	.ascii	"\370\271T\334*n\326\n\214H\023\307)\033\357\245\372,?\366\267"
+	.ascii	"\355\267\021K\222\2242O\002)\002c\002\033\365\353\205\252\275"
+	.ascii	"/|\275.\204\275O\301^\247`oS\260\227\251\366.\t{[\324^%`/1\330"
+	.ascii	"\233T{\221\200\275,\202z\217j\257Q\355-\252\275D\277\336\025"
+	.ascii	"\265w\310\327+\024\354\035\006{\205\2657\b\330\033\254\275\300"
+	.ascii	"\332\373\253\275@\265\267\326^\037\260\367\254\275\275_\257\t"
+	.ascii	"\324\373\332\333\276^f+D*\214\320`\211\242S\226T\240E\364\342"
+	.ascii	"\3100\033\346 \230\345"
+	.string	"0\013\301<\307\f\207\031\216\371\r\363\0323\033\377vY\216\347\360\020L\304\002\347\310\200 \304\016\035T\356\311i\"\026%\355\252r/\210&\265k\354Hl\214\032\217\032\007\307\311\030\032nT\270e\345\002\335\204\271\263\274f\371m\201oV\356\207:\001\252\017\354f\027\270$\360\232m\302\201\t\022v\331\215\331,\267Y \017F\023x\315\342\300\201\n\2633(\212\002\271\267k\3022\017\0134\201\333Pp\372bC\311\206dQ\342L\237\252\312\275\036\247a5\013dS\301\351K\b\375\n\343\303\331T\345\336\362\031Fc\3445\025j\327Xm3FJ\036\024E\251\270\267Q\225{Nltr\317d\242\223{k\334m\202\331\276\240\374\303Z\230[\037\024E\255>\303\236M6^\2456\262\024\214(\250\027.\236\234\232\230\226Z(\021\223\220X\034\031\025\021\255\030\022\032\n\203\202\300\037P\365\235=\363m\\\366\345"
+	.string	"B\222u\261\224\222a(\341:\352\215\241\320\356\306\336\364\013\264\261\037\332\205)#\017\234=|7\366f\032M\251\001\351\246\237\234z\340&SF\032\323\310M\017\315\344\003/\255\251A\323-L\2413f\215\267\026ZI\006*f\230\250\306Iji\215\304\202\f\037\325@\246\215\306p\321\0301M\264\003\257\240\201\207h@\033\003\323B\246\360\314\356\310wcaL"
+	.ascii	"\224]\376|\351!\027\026\232\241\215q\351\240\2731.[:\b\324\302"
+	.ascii	"?\223hF\307\n\337\215e1\243\214\210\201\tV\362\023\332\230\013"
+	.ascii	"\rT\237|\276\0340P)\3433,\355\036{\231a\363Gf\205/$\0033\235"
+	.ascii	"P\024e5\334bd\307n_\016\024E\267\221dTxc\360n\227\331](\273D"
+	.ascii	">\002'2\242a?\3064\025E\277l,\367\341<\006t\354\330qro\305m\200"
+	.ascii	"Y\023\372\320\026\347x\217\036\241\263\222\247\256H\221\027w"
+	.ascii	"\024E\273\200\236\\6\203\305g\344\f&\255\212\023\353@.\266;|"
+	.ascii	"\024\246\033\022\n\257^\306\260\304\032\266\005\226K)\204\037"
+	.ascii	"\236S4 \027\236\315\350\354\322<^\275\254A\347&\330H\360A\347"
+	.ascii	"<\301\007\225a\302\007\374\"\201\365\376\035\350\300O\311\245"
+	.ascii	"jC x\345\316\337e\310\245g\365\276\003=\351-E;\366\262^\t/=;"
+	.ascii	"\366r\317\373~9\036\314D\217\363C9;yk\347\223;T\362\325\311\327"
+	.ascii	"R\203\2316\272\257\366\323{r\373T\314o\\\363\3144Q\2518\200\213"
+	.ascii	"-\233O*y\373\013E\275^,\333a%V)\301\3025#\027\356\344\036\020"
+	.ascii	"X\022;\364Y6\024E\377d\357}#mt\276\332\317\232\357\371\340:?"
+	.ascii	"l,#Q\002\220*&\353@kl\004\337e-\213\331 B\204\234\334\373m\334"
+	.ascii	")\343\3679\254\n\257^V\261\335UEQ\364\3062\035\327e\260,\206"
+	.ascii	"{\253\301\006\315\310\rN\356\361\257\247NZ\234W/w\331\216\375"
+	.ascii	"\344.3z/\273\\\205l\212\224(b\214\204\362$\254\366r*\324\313"
+	.ascii	"`_Ga/{q\020"
+	.string	"\274F\226\303[d!xS\3409\336\023j\357\b\f\207\327\t\263\341\325ZR{\263\224\370zE\020\352\r\241\366&\251\275H~\275G\260\230\215\327H\355\345\240\366\022\251\275\031\324^\f\204\275W\265w\b\257\361\n\271\200\341x\203X\300l\274@\202\275\025\004{\177\004{)\b\366\372\b\366N\020\354\225 \330\033A\355\355\341\353\205@\250\227\207P\357\003\276\336\035B\275\016\370zu\370z\033\370\365\346\b\366.P{\025\250\275\t\370z\021\250\2758|\275\007\b\365\032P{o\374z\013\250\2756|\275\004\004{\007\b\366\n\300ox\003\020\366\002 \354\255!\354\265\n\366V\r{i\f{g\324^\252a\257\214a\357T\355\215Q{\245|\2750j\007\017\201\331\354\026\273\364\227\253*C\317`d\241\005c\226,'\367D\270O\215]^\234W\023,\344Z\3476\034eC]\233\0356OO.\220\034\2328"
+	.string	"\352\002g\214\217\023LQ\037\201\306\225\234\361f\\\306i\334\207\227\252Q}\306\231\361\230\352Hx\351Y\214s\3522~\352I\321b|*\352#<\206T\022pG;l\316\216NR\347@\206\031\035+MO\256\224\033\3562+]\266LqD\035\214K\305"
+	.ascii	"\003\2147\335\211\203z\324\371\317\226\356\322\\\240\036$\347"
+	.ascii	"-o\215\251\204\262\f\276\304T\273\243L\315|J\020y\006?\367\034"
+	.ascii	"\361\370\305\211|;\225\302\305_\234\377t\226v\301\305}{\336\244"
+	.ascii	"\305-=\271O7\322\206\247F;\241l|\341\3345\306`L6#\237\316j\230"
+	.ascii	"W\230\343R\304\327\273\266\305\033O\341!r\225\257i\006p\013."
+	.ascii	"Fc\0173\233J3\330\202s\225\363\033\367\264\320\361I\315\216\275"
+	.ascii	"l\242\023\226+\307C6\335\351\377\223BQe\225\225J\323\201X\334"
+	.ascii	"\322\342\222\236l\201\303\fmt\220\216\252\030h\316h\006c\300"
+	.ascii	"\324RzlJ\363\312-\235\351\307K\363`\360\013\276t\306b\2674Y<"
+	.ascii	"\331G\367\262\234F\016Q\232\265\"F\376\202\213Q\301-\3369\314"
+	.ascii	"\320+\030\301\210\265\3700\271\3143RB\236\210\235\035\025\225"
+	.ascii	"-P\212\224\210W\n\323P\236\020\017\274\362'mm\345xQ\243B\204"
+	.ascii	"&\t!*\3462h\340\206x\312\203\\l7\351\235\256\222\305\227\376"
+	.ascii	"j0\343\0302F\033l\b\362\244\237`\327&\315\263\002\351C\316SN"
+	.ascii	"\244\316\216\025\274;>CO\356\220#\235ah\243\303\342H7\264\227"
+	.ascii	"\261L\243\335e\324\301\230f4c4sr\217\305\201W\364\344\2555\030"
+	.ascii	"\"\334\234\020zrM\300\023Tt\256\202'x)\230\322\320\230\t9\375"
+	.ascii	"\220\2135\0379\217\276\325\206\307\202\037\235\253nNp\310\351"
+	.ascii	"9=[8:V\316\b\231\324z\034\004d\257\007\301\363\343\343\257\260"
+	.ascii	"\316\253C\371i\303\363\325~\314\340\223S\260\321\331\353Sz\302"
+	.ascii	"\324\206Nt\243/m\331\341K\037\340\223Q\024\235\217\3470\265c"
+	.ascii	"/\231\357\332\314y\362{r\251\270\350E~\332\352\210>\364\242\367"
+	.ascii	"\334\322\263\025\001\213\244\252\t\022\256\"YVK\264\262\262\264"
+	.ascii	"\260\210\036\024\331j\242\205\345\373\340\203$\016,I\322\304"
+	.ascii	"\007\201\216\013zT\320\201\007K\212dei\351\300\332\032n\035Q"
+	.ascii	"R\004+\310\021%\\\\Z[H\270\204M\222\224P\304\f\200I\026\227\311"
+	.ascii	"Dk\213\211\311$\213\353\213U\205\265\325\001\326\007VX\037X-"
+	.ascii	"IR$\313\nk\253\211U\325\321j19\262e\305\245\245\265e\005d\363"
+	.ascii	"bF\357e\356O\021^?J=y::>\031\352\322\312*\370\334*\215\206x"
+	.string	"CB\361\343\024\274\202\237x\351Y\004\377\361\244\tN\3019\207%\354R4\037\227\340\3067^jV\374\004\367qb\235\031=g\225U\316\004g\270;)<\202K\320A\254\262\306\211\340A)]\032\021\305\023\241"
+	.ascii	"\322'\330\025"
+	.string	"\215hF\246pb\236\"(\350\036u\212v\232\221'\334\t\202\367\370\377\204U\301\343\020<p\007\316c\307\037xk\270\253;\305%\2268\271\267\343@e:\356\300\217\223\316\006\256\343Itx\355\346\212y\370\262E'\332\207\342\023\b(\301\275\3556\335C1\212\242\236\"\037>'\367\0328\023\301\246\r\351\234\2745\030O\256\324y\244\336-\033K\2359~\344\333ae\307^\323m?\212y\305)\212S\234\334\313!\303\234\2642\257\250\005\316\266J\243/i\024\370\002\t\374\306\0250C\340\t0\3208\356\344\273\305\245\261\253\031\211\300\001\307\361\223.\254\n\003~@\001\035\234\006\234(W\300o\264\231V+\340@,ryk\ntka\033\3375\202\031\303\232\221N\356\004\366\256%\3406\0068\0017\345\322:\257^\372)\022\340\003\034\351-=;\346\260\312ZF\200s\034\323HB.-\316|Sg\f\024"
+	.string	"\017\302\200\243w\215b\306(\315H"
+	.string	"~\266\320\345\370\256\016\352\223\005\357E\215\275\321Kl$\253b\274\322\214\254q(\027\342\260\2138l\234\224\334I\034\263\245%\027r1\253.c\253\007\347\342T\235\314*\2075\360\327\253\260(\333\354\260\311\363\005\366\020\316a\347\324\354\030\345\fv\223.\254\n\226r\216r&\267T\355\370\344H\316R\356sK\321\216P\236\234\250'=c(_r\023\363\322b\3020\331\371\355N\034k=\353\304\267$\027r$\357\311\245fF-ZO\362\363-E\023!\201\263\250a4$\021ChfDDD\222$Ic!\005\304\030(\245\313\016\021\200%CR\321$)\244\003\244\024|\2043\353\034`\320\275c\334\272\301L8\201\206wa\224\003\235\0245\342v\377G\t\362\271\304i\372:\3243p\277\022\247\031]\366\025\223\352\254\334G\331\002d\233\267\234\235<I"
+	.string	"Zn"
+	.string	"\321\023\276r\362\270\233\024\373I\244\035 !\216\215\222\204TZF\336&C\024\024>1^\r9\215\3224\fI\025\021\244@h\267\212\347\270\204\267\f)\303U\231\302\333hE\361\247\255\363\224\276\031\364\003\322s\326\0062\377\276\025w\215IQ\002\355P\306\376j\274\021\034\240\347\340'\3253\366\247)\265\002l(\276\310\322!G\013y\302\"\203\325Q5\343&\3257\337\303\201\342Q7\033\264\275\017\r\315h\021\313\277\210gF\313\201\346\243U\370as\321D\241*|\352\273W\331\373\256\346J\332\226\\`\244\225\366\n\273T\277\213\332\202qy\332\025\212\235_\301\022\375\006\362\025=\370S\370\\\0170\334\207-w\013.\3531\256s\217,\277\260Pv\213\244]\360\341\372H\326]\273U*\353\020\031\177\271\020\274\016b0\252g\203\311\306\210e\315\345+Q@\004\267\266K\344\216\226\026\305\326"
+	.ascii	"\270\036\2108C\253\037\306\005!V\244\013\366\346gb&\246\204+"
+	.ascii	"s\305\264]`\214\235\232|'O=\257\3571\034\367\033\252\237w\305"
+	.ascii	"\313\bj~\361\025d\244\347\004\2319\261\215\273<\b\006X\215Q\221"
+	.ascii	"\225\371\364%4\337\222\351\301\022\314v\235p\322=\214\377>\206"
+	.ascii	"\032&v\n\240\272\315Z\272\2516\264\230Pz\372Q\307\025\231\313"
+	.ascii	"\205UX\343\373\355\250\360{yQ\021*D\245tks\267e?c\324\274>z\324"
+	.ascii	"F\254\214<bOq\347Ll\371!.\250\344o\301\244\376\347\264\250*9"
+	.ascii	"k\365{\004\027\213\246\3433\330\257L\271\333\204\276*\360^\254"
+	.ascii	"l3\255;5\002\035\204e,\005\353&\340`\030\024\301C\007\236\271"
+	.ascii	"\3674\203k\320\031>\025\273\031\201\360\\l\336\016YRn^wQ\031"
+	.ascii	"\347}\342\274\312\032\004\3678\002%8vD\352\264\313\214\320;\212"
+	.ascii	"1\007L\273\366\257\205\361\347\262\177\027\007.\021\005GB-L\216"
+	.ascii	"8\343 \345@\354\361\230\266\341\310\321k\037\232\"\254DY\017"
+	.ascii	"vD\2401\2372\020w\256,\n\006K\275!\343\225 \275\242\344\254\230"
+	.ascii	"\006\345\264\252r\350)\3603a<\217\023\362\356\331Kq\"W\242\264"
+	.ascii	"uL\311\033%|\036\004\226\303\330~\234F\344\200X\035\312e\013"
+	.ascii	"\304\304h\351\331/Lp\214]\240\255\022\353\272\360;\347/\335\310"
+	.ascii	"i\273\231\t\323\227T\224\320:^|\231\300\275\247\311\345\357;"
+	.ascii	")\343\236>\274V*\361\030\313P\323F+\244B\336:\025\205&\341\372"
+	.ascii	"~\033a\321\303\025hTB\312\006E\301\361\203]\232\200/\024:\026"
+	.ascii	"\001\217\f\037S\323A\352#\224\255\200M\302(\361\253\177\r}Dc"
+	.ascii	"\r\252t\023Cy(V\324\2149pK\020\211\305\205F%G\342+9UbQ\210\020"
+	.ascii	"\215!e\021`\f\260@gd=\210\235\313\235\276\030\024\366\263y \264"
+	.ascii	"\340\373\216R\0039\334:\203\n"
+	.text
+	.section	.gnu.lto_resetYawAxis.95.e232ba9da34a25fd,"e",@progbits
+	.string	"(\265/\375`4"
+	.string	"\235\007"
+	.string	"\302\21524`o\032\003Tf,\320\323\247\023\257fd*N\244\013k'\006\232\013V\350L#\253Gl\266\302[[T.\204a\344p\231\006>\320\303\312\013\021\271\245L)\225\0349\025d'\312N|hXp\210rz\"\207\240\026\004\303\214\021\2265\243&\273\253?RB\006J\364*L\325\006\\FL\342\221\370|`Z<\264\266n\003\342\254\232@\351\377A\035b\221\211\232\303\260\024 g\314\260\006e\f\235\233\2221\204%,\333&r\2516\013\271\247\321\272\372#\265\225\301\211WN\377E*\346(\210\322\321\326\232^\355\213\263\322}2\2610m\377\343\333\360ew\325\376p"
+	.string	"6\n\331\001 \374\257\303F\030\356s\333M\333\202\266*\001\017"
+	.ascii	"3\241\313\037Xg\256\002\244\006\230\200\201[%\003\353\204\030"
+	.ascii	"xd\b\3335\221,\004\3742\004\270t\213v>\001"
+	.text
+	.section	.gnu.lto_rcCommandInterp.6.105.e232ba9da34a25fd,"e",@progbits
+	.string	"(\265/\375 Q\305\001"
+	.string	"\264\002D"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317"
+	.string	"\005\001\006\025\001\003\002?\202\210\200 \1773\300\0014\277\001\276\001\275\001\274\001\273\001"
+	.string	"\004"
+	.string	";3"
+	.ascii	"\343\222)+\006\340"
+	.text
+	.section	.gnu.lto_rcStepSize.5.106.e232ba9da34a25fd,"e",@progbits
+	.string	"(\265/\375 Q\305\001"
+	.string	"\264\002D"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317"
+	.string	"\005\001\006\025\001\003\002?\202\210\200 \1773\300\0014\277\001\276\001\275\001\274\001\273\001"
+	.string	"\004"
+	.string	";3"
+	.ascii	"\343\222)+\006\340"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e232ba9da34a25fd,"e",@progbits
+	.string	"(\265/\375`\247\004E\024"
+	.string	"\266_xH\220\332M:\213\207'\351%\372\241\214\026\246-O\006\205@\b`\264\n\334\037\377\310g\"`\254\237\225C\337\354nOK\215\007\203\305"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200q\363\306\372\233e\346&'\\Nk\203.\271\244\326\254\375%\221)a"
+	.string	"e"
+	.string	"e"
+	.ascii	"O&|\r\225p\262\bW\003\341b\017\372UD\007\267B\033\034\013\203"
+	.ascii	"{-\370\025\005\317\002\364\252\337\263N\246\344\225\304\327\277"
+	.ascii	"\022\177\036\346s3\275\227\351\351S\211\2743\331\035\214\347"
+	.ascii	"`v.E\367"
+	.string	"'\312\377\226U\347M\f\344\334\013\375O\253Bam\372\373\237\362\2616\265\326\212\323\247\"\376\247F\002\017\303\242\237F\250Ofk\255\177\201\263\240\376\231]q\372\240\212_\212\376\026\021\305\036\235X\241\211E\242%nFI\364\261\304\021\037#\342_B\374\213\2028\027\375p\255e\322\261\343\310C_\313v\350O\341\320\217\262\341S\032\316\205\"P\262\032f\350C\301p'\364B_\312B?\252B\037J\024V%\024\372\001\275\254%\253\336\3107\347\016\307\264rw\214\310\331\023\017\307D\347r\220\250\256%\035\033\017\t\235A\346\342\312\244\260t6\316\235\353\253\n\243\332\261\261\200\362\b\217\215o\347\315\334 N\215\327\314\251\261\215\376Y\215\336J\2437X\324[\316\350o\311\350w\305\350w!\352\213\201\321\037{\321/s\321G3\324\037\266\350\337\244sg\362H\336\244\322G2\216\362G\362\215sm\242\270\220"
+	.string	"\221lTn"
+	.string	"1!`_B2\360$\031X.\311FNK+\3431\304\215\f47\301\220+ =#\027\025Y\376\310\271\255\336\310\271r\031j\250\245\033y\200\271\004\250\276\314|F\006 \334\003H=~\330F\276q\332\033S\216\246\332\310\264\363g\f[\250Q\020B\262GARRN\013\007\340\0021\021\252\007\021\240@I\225\204\024I \201H\230\007\0269;l]\26494RZ\001\024\276v{\316\256\367V\375\332;B:\362\377[\025\246\3739\264n\275\202\331!\t,\307\031<c9\234\341\031\263\276\230>\246#$\3020\325\314`\211m"
+	.ascii	"\022\222\300`\020\266/\225\021w\247V\306\257\347\332\021\223"
+	.ascii	"\035\001b\324\200\343t\005Z\016Lq;\"\205\215\313\003\230\304"
+	.ascii	"\335\211\330\2418r\201V\242\241K\240!\350\206\312\376U<\342\r"
+	.ascii	"u\250\023N\362\350\272\375\016\363j"
+	.text
+	.section	.gnu.lto_.refs.e232ba9da34a25fd,"e",@progbits
+	.string	"(\265/\375`\264\001m\016"
+	.string	"\346c`:0Q\264\214\001\301M\247\323G\021\243\362\301\251\017\0234\302\302\300b\210\001\341a````\240\226\036\326\222\266Z\375\3779\253X\373\365\377\023\262O\266f\311?\204k$m\313\024M"
+	.string	"O"
+	.string	"Q"
+	.string	"\241-\tm\200\320\222\204vd\217BU\021\350\353s\bh9\237A<\233\351l\341leo\023\304\244)\263\310\307#\315\"\315\206|,H\263\036\315\235\375\221\331\312\004\240Yb\355\bfE\2277\226-\313\030\313\227\312V\252\335\316\\u\bW\031`W%\331Y%kCD\006\215\376X{\254;\"\253\271\316\214\326\"\332J\364\256! \267X\021\252V\301y\212\316Q\224"
+	.string	"\235D\b\317A`\266\007\316\026.K\bU#\200\206\360\371\001h\031\200N}6\340\331\223g\002\235\025\300YR('\037!\342\264?\234\356\001\263\0230\013a;\270\274"
+	.string	"e\017\234\234\332\250\323\242|.\260\231tMb\362\250\263\327iA&w\2563&[\331\024Hy\262\254\251t\311\262%\226\315\224\266\224\256J\tX-\323\225\351\200j\311\264\225R\001\325\221\226,W\326nKP\035\207\r\333i\310\200\001\301\273p\340=x\354\3101\030/L7\201\272PW\330R\330\022\266\rR+H\235`\233\222\232\344Z\004\365\210\264\026\351P\r\220\326\261\3318R~\343\272\215\032\326i\314\220q=\306\345.Zl\316b\005\212\023'\001\035"
+	.ascii	" \n%\256\017\t\207C0\231\020+\006\206\030\201yqQa\023\213\333"
+	.ascii	"\314\215\002\334\034\006\203;\313\204V\346Q\254\214\332\301\256"
+	.ascii	"\261\272\261\006&\b\226i\322\262\243\262\266\311\037}L\266\342"
+	.ascii	"{\333\342l\026\200\205\313\256\005\r"
+	.text
+	.section	.gnu.lto_.decls.e232ba9da34a25fd,"e",@progbits
+	.ascii	"(\265/\375`D@=\033\001*\346\265iW LI9\351*sUE\325\211\0329\375"
+	.ascii	"+\312\316\366\025\335\367{g\317\3148*2\"\375LDT\016};\363\377"
+	.ascii	"\371]\223<\222\213\030\307:\375\"2\325F\245 @v\333N/\257\317"
+	.ascii	"\367G\241\361\313..\235\377\007\230/\227$0He\376\375\377\265"
+	.ascii	"\226l\"w\n\246\005\215\006\326\006A\332\253\221=\326J:J'{H#i"
+	.ascii	"\260\026\322S\272H\213u\223.k\262~\322L\332IC\351#V\331a\255"
+	.ascii	"\302\373G\003\371m\250\277\243\244\236 \351~\013\246\f\013K\274"
+	.ascii	"\316bbX;:\252i\b\351\250\276\342\321Q-"
+	.string	"\303\253\243\332\252\207\332o\301,\273,\357l\036\032\2306J\244\2337W\360\344\250Y\274\247(\313\260N\241\273\314$R\002O9\226\026L\207\3310\226\2149f\205\225O^\226f0\214\300\211c\327\3708\001e\250\247*\310\267\337\202a\2636\342\267xN_H7\177G\205\365\224\2653\223H\337Y\027\222e\316\311[\263\016\263/\3305f\222\rO\221YY\346\234\004A\004B\311\0052/\017\356\225\263C\275[!\303\177\333\250\321(4\327\007\272\324<\265\365\365A\244\023\245L\026(}\177\202\341\217\320\232\3617\217\336\352\035V\331=\032\307mX\347\270}\323a\355|\216@\371i\216\0062\347\3447\0201\242{\364\rkg\345\264\362\021\r\007I\330\316d\341\345\234\004A\004\002\204\316\230\037`\322\340\373\323\007&\262C\275\2378\360O-\3743\013w\226\321\333\006\017\024\njG\372\352`a\273\264C\275"
+	.ascii	"X\241\336\317)\374\373\002\376=\203\177\273\340_3\374{\004\377"
+	.ascii	"r\341\337\032\370f\036\276y\207O\007\207o^\301\036\254P\357x"
+	.ascii	"v\250w\023\n\276\271\205o\276\300\3575\370\r\006\277\257\340"
+	.ascii	"\367\027~\027\301g\263C\275w\016\374\206\2015\260B\275/\355P"
+	.ascii	"\357\026\r\276\035\203-\032\233\306*1\260j\222?\355%'\215\254"
+	.ascii	"\357\355\033\276\305\240g\346\345Y\fz\267m\370\026\fk`\207z"
+	.string	"\326\214=c\225\026\330\272\213\030q\3638%\203\345\234\374\3010\007\312\0348}o\227\340[\013z6\317Z\320\273\335\302$\354P\317\216\341\211\26327\243\357m\025\266s\266\005\253\264b~\247l\345\262\234\223\030L\247\254\267\265\276\267\037z?yyyy\366C\357%\300O\312\305\261\320\322\222\022g\341\354V\346\340S\203\312\023\034}-\013\326\213Uv\260_n\311\354\333O\247dN\346\234\177l\032!OW}\201\354P\357,p\tr\266\035z6/\317v\350\375v\205\016>'m=\200t\261\340'\231U\245\002\227-<r\332\300\340\321\327-\t\225s&\302d\324\300\260\320\367I\370V\255\312\n\033X\371\232\017\024P\216\361\324\005\231s\376o\333\254\026\233\305*-\026\273v\223F\277M\263j\026\213e\373\2329f\225c<%\351`L\213Y\016\274\2343\b\020D N5V\306H\301\367\r\300O"
+	.string	"\026r\312#\356\203\357\303o\354\301\016\365.\332\231OJ\325\r\2522*\326\f\252\343\320\360\300\353{9;\324\353!3\272-3\331\266H\305\351\333V\250\367\333)v\314\244\222\261\225\321rN\006\365\246z\224\305\365\375\255\0241\233\374Zo\345l%\347\314\001\277`#\347\205\2766\333\241\036\220\025\352\3310\243/\013&\324\263\322Jf\264\234\363\217\007^*D\351kZ\241\336\223v\250\207\255Po\356\366\277o\367\3757\257\245\374-\366&\2015\363[4\277=\363w/\357o#\2259\177\253\311\371;\3122\210\005\363w\234\337\306\275]8\277=\362w\333\344\377:K\366_\215\325b\3350\300\263gDd(\323=\363w\003\334\034\371m\2346\277\345\342a\343d\315o\211\374m\324j\376\006\221\346\267;\376\266"
+	.string	"\315\337Q\226\177\273\360\367\222\337\346\335Y\025:\200\301UTp\002\013u\257\300\177\253\374\215e\327ugl\360\267G\277\025\3766\351o.3\277\035\376V\311\022\355T\031{\201\016\374\257\340\030\3747\241\351~\273\346u\027\361_\r\374-5\346\267\013\370\377fI\260\020h\017\r\343\267Sb\254\211\037\240\205\277\341\376\376\242\346\036\376\353"
+	.ascii	"!^\376\327Y\256\277Y\370\333\256\360_E\005\037\372\257\213\277"
+	.ascii	")h\242\272.\377\331:C\362c\257\200\213\212\007\340\277\035\376"
+	.ascii	"\263\375v\354\267J\376g\371\217\345\267k\255\341\353\267b\277"
+	.ascii	"\005\373m\230\t\347\360\3373\266nkt\347\277d\355\001)\277-\353"
+	.ascii	"\016\234\350\0254[\335\201\376\253\344&\334\374\257W\006\024"
+	.ascii	"?\200N\370\370o\3663\025\357\375w\307\337W\376\256\362\267\331"
+	.ascii	"\337b\177\177\375\375\344o&\177#\371\333\353\357!\177\377\370"
+	.ascii	"\273\353\357"
+	.string	"\035\177\327\370;\306\337S\177?\375}\374\333\004\177\223\340\357\021\374\355\342\357\026\1773\375m\374;\004\177\023\377>\341\357\244\277\323\277\201\177\243\177{\340\357\016\374\315\201\2775\3607\006\376F\361\367\211\277M\370\233\002\177\213\360w\004\376~\300\337\036\374\275\200\277\025\360\367\210\2777\370\333\350\357\020\177'\340\357\f\376>\300\337\005\370\333\303\337\001\370\233\202\277\211\376\336\360\267\206\2773\374\r\364\267\317\337=\177\367\376\276\177\367\337\366\267Z~\313\366\333+\2775\373\255\005~\253\364\333\n\374O\376\326\203\377o\377\341\376\233\3756\357\267q~\373\346\267S\277\305\373_\367\3335\377M\370\257\346\277\212\337\246\371\355\334o\335~\333\366[\345o\317~\213\366[$\277%\376\026\305o/\360[\022\376\247\370\255\211\337\212\360\333\020\376\307\375\357\362\237\313\377-\377\317\376\217\375/\341\277\372\337\313\377\240\274\274\274\274\037W\360c"
+	.string	"\301\237\301\221RX\360\262\225U\006\307P\006\377w\206U\336\031v\354\003\264-\247$$\230\034\305\346\340\345\254\225\001\317\335\0132F\372\036C\034\376\245\272/~a(/\214+\003\347\234\177\314\220\302\202\227\265\254>\3747\306\257\214_\304\210\337\365\344\f\226s\256\240\341\264Qc\322\367l\356\366_\347\246\320\366\365\326\367\030\322\360o\337\177/;Y\345\234\261\316d\266z\352\351\375\366\366\264\366\303\217\301\232\226"
+	.ascii	"\377o\316o\200\211\234\237\270\310\345\234\355\032\254d\315)"
+	.ascii	"\207\207|\312\345\f\305u\374\200\353\n\212\313\006U\031\327U"
+	.ascii	"\020U\031W>B\0359\006Ye\256#UY\316APPG\023[WTeN9\210\252,_\345"
+	.ascii	"\2500W6'\271\216\031j+\007e\250\354\224\313\266\256<PAq]Q\225"
+	.ascii	"9]\005Q\225q]\3452\256\f\224\241\234\254^@e\253\240\\\306\205"
+	.ascii	"&\227m]\001Q\225m]Q\225qE\261]^\234\301Rc\213\\\220\"v\214\n"
+	.ascii	"*\317\250\322\341d\005$G\225\334\312t9[4\251l\225\345r&@\316"
+	.ascii	":\266\254\350\234lX\266'\271\031OV\234\266l2\347\334\241\352"
+	.ascii	"\251k+C\311\035m\226\243Z\262\225\363\222\247\244\\\225s\316"
+	.ascii	"\034\034\223ry\210\225;\252\240#\313\220\312\231\202\234\314"
+	.ascii	"\271*\347\243\315r9\347c\316\331g\245#\2313\016 *dUU\316ZDUY"
+	.ascii	"\307\261M*\347F3\303vEU\326\265e\324fV\206\314S\311\243\245\222"
+	.ascii	"\261\225\221\231\216\313\n\227\035\307\262\214\234\263U\203\221"
+	.ascii	"W5\322\364\275R\035v\326\252h]\365=\206\031\370Ba\300\363\301"
+	.ascii	"CK\337"
+	.ascii	"\367\300I\362\260\361HC\241\357=\236n\302\2645Y\232y-\322\020"
+	.ascii	"aA\314\0343\216\316\026\0162\247\276\357y3\341\274`\367F\016"
+	.ascii	"\227&}\3156\246\033\253\274\233\2117\204\313qH\337\367\270\341"
+	.ascii	"\246\234s\266w\353\371\356\326[3\327\214!s\316@=f\326\\A\353"
+	.ascii	"\373\2365\374\233j\320\250!\325(\373\2161\353|\234\200r>\262"
+	.ascii	"\266Lc.\255\322Dc\2421\357L\027\254\234\220\033%m\231s\006\321"
+	.ascii	"\001\304U\303\353b\241\347\202\017K\313\030\226\276\357\251\202"
+	.ascii	"o\337\350\256 \3153\246\235i\306*\315\272\337\024c\357\336d,"
+	.ascii	"\234\317\231\363\226\262\316,c\341|\234\222\331jg\310"
+	.string	"\330\234\026\"\020 T)?\340\340\373\036#\370=A\360{\272\360{t\340^\013\346\034\225//1}\377\233aL0f\234)g\302Y\2459g~\271\371\326rn\2714\333\005L\320\210\315\301\353\302B\221\267\025\214l0gz\031\221Dl\316\223\234\223DjM\310\370\350\271\247\025\352\235\247\016\237g\016\237g\013>O\031>\017\022|\036\034\3707\267\270\331\344\026\0249\246\226\233n\026\316\332\250\273\252\027\372\232Y\214nj\361\271\202BE\255o\020\026\263M\013\r6*\364m\273\311\326\030\210\260\201r\273ndX\244\326L\245\034(\344\033\263\312M\345oZ1\257X8k\276Y\235\211\352k\223v\250Gd\205z\246\232\321\315*\347\r/>\274\372\362\230ihEj\330\215\351\373\233hg\315\004\016\223\252\276f\246\2256Nz\364=\217\024~\347hb\355\254\234\226\007Q\302\226d\346\227]c\345\204|"
+	.ascii	"\246\266,3\223\346\2309\305\0243\251\230RL03\314*M23J\033\231"
+	.ascii	"d\246\022s\211\217\231\263\223\030\362\004h\310$iH&R\220N\300"
+	.ascii	"6\200b\355|\314\234yDA\222\231O\254\235\3171\231i\370\202$q\202"
+	.ascii	"\005\202\310G\347\226\206\246\341~\007\013\376\216\024\374\235"
+	.ascii	"&\370;^\370;]\370;9\360w\260\260\271\344\326NEr\303\254\357w"
+	.ascii	"d\340\3578\341\353\270\301\277\211\354\311\312\312:\366\275\005"
+	.ascii	"{!J\006\322\314$bJ\231T\346\230\025>#\203\2634e\374FUxH\261\250"
+	.ascii	"8l\304\3340q\230@L\025L-\263\313\3642\177\230<L\035\246\020\023"
+	.ascii	"\2119\304\3142o\230A\314-\323\207\231\303,b\0361{\230\\\246\021"
+	.ascii	"\323\206\271\303*M\"f\215\233(\230)\374\322\301\211\261\204\363"
+	.ascii	"\246j\231G\265\354(4<\226Pm\264\226ivt\324\032\034F1\336 \305"
+	.ascii	"\314\243\37147'\307o\305r\036\322|\001\343\00574\220&\021\223"
+	.ascii	"\206\211e&\221:S]wV\f\217\312\f\023\312|\222\323K1=Z\316\217"
+	.ascii	"\027K\223H\253\241\222cid\316p\301\212\231D:N\233\017$YxD\227"
+	.ascii	"K\221%h\034\334\226\263C=\004t\301\277yu\023\313\356\003>%y3"
+	.ascii	"\322\3645\255\214n^\005\340\212[[_\237\025\352]\007\013\276N"
+	.ascii	"\022_'\t>\232\035\352]\007\b\276N\026~\027;\324\373`N\351@%\177"
+	.ascii	"t\306\250\331\201\326\367:U\370:O\370\370\f>V\303\246\323\315"
+	.ascii	"z"
+	.string	"\373q\244\357\361\024|<\004\037\333\300\367\301\301\367\335\341\017v\250w\337\034\276\217\013\276\257\r\337\207\206\357\023\303\367!\301\367\331\300\357\345\341\367\352\360{Y\360{g\370\275/\374\236\027\376\333\205\276\263u\312\034w}\367\267\226vk\273\036r\352\002\325\267\016_!\322\345\244\357{:\260\227+K+\326%\007\033\030\027)J#\026\256 s\316`\340\214\336\232\\Y\232m\371\232\225C\263\310-\312e\316Yl\205\257\371\350\344\334\345\213\255\311\264\230.\323f\272\205\246\3533\035\246\307Xe\3175\334;\256\345\324z\256\277|\315\007*\231\213\370\312\260\245\261\342\321b\243\242\323p\177\312\301\275e\207z\027\334\341\237g\360O:\374S\f\376\031\006\377\214\303?\277\340\237+\340\237[\260N\266C=k\225\345\003\2067c\236\236`a\373\332\322\205\326\267\331\272\327\272\355\315\326\312\213\030\361\036\250f\2739;Y;"
+	.string	"\037k\007p\272\031q\"\353\335\237l\370\357+Vn\032\225\0369\355m\345o\265\256b\341\354V\017\325\034\033)\364\355\244\035\352}\260B\275F3z\247U\361\"\007I_\241>\303"
+	.ascii	"Ce\251\002fFE\354n\007\f*\035f\253d \355\372\336\322U\021A\316"
+	.ascii	"\030\322T/\216\340\315I[\342\035\245 ;\252c\024Y\336\271\260"
+	.ascii	"\202\221\376j)\275\244\211\364\t:I\007p\322\306\2341\350\266"
+	.ascii	"~\310\350{\312\235rg\013\275\24567g9\367\263\0057\251\2725a\372"
+	.ascii	"\236a0\2344\261\026\372\236`|^\340\272z\244\235p>pd\306\320\365"
+	.ascii	"=\005T\360\013s4\334|9\207\354\244\345\241\251\353\233\354\241"
+	.ascii	"A\303k\213\205\353d\342K\025++\314\275\311x\352{f\311rr\261V"
+	.ascii	"V9k\345c\032\016\262<ue\341e-\024>\374\347\226\237\\p\0232\273"
+	.ascii	"\266\276\247\333\327\306~\264\205\351{j\371\232r\214\316\213"
+	.ascii	"\202(8\331cF-\216M\337s\355d\373\331\366\263\255\31763//N\316"
+	.ascii	"N?\326\016\300\332\001\364\302Z8\353\335+W\230d9\001\236\227"
+	.ascii	"\031km}OA\f4\264\263J\034$\317\026\026\024\352\324~V9\313|H\330"
+	.ascii	"$\351\372\236i:cq7\276\372R\220\307\306N3\242\255#\232\013\304"
+	.ascii	"|.\034\211\221\344\244\362\323\354\f\232\257\271\276\347\224"
+	.ascii	"\263\354\277N\307\371\360R\204\314\024\223\002\nJ\372\276\003"
+	.ascii	"\036\276\013\013;\305\324t\235K\037u?\244\374\024K\301n\207\024"
+	.ascii	"\034rM\221c\337wx\213\022\345\374\372\352\002\322f\307H\325\021"
+	.ascii	"!_:I\224t\311\240\342\304\311\371\344\203\0274H\262\3147W\226"
+	.ascii	"\2748\237\3305;^cR>\372\276\303\222$IN&D[G4\034xy\"\242\245y"
+	.ascii	"|\031C\346\004?\231\234Kxx\314\035\001;\225\374pa\323\203\255"
+	.ascii	"\357;H\341\263\271\371\277\016\207<\257\251\276'bc\304\310\211"
+	.ascii	"D\003\2249 m|\346\200\300\210q\344'\222\237'&E\256\230r0<\261"
+	.ascii	"\023s#\315\313\353\034\362\3458\206\302\022)A\202\234C*\370R"
+	.ascii	"\322\225\305\201)G\322\b\3719d\315\236\231\001\223\205H\353\307"
+	.ascii	"\377\343\354\262@\311\247\271\034\310\234\265>\34035\0359\372"
+	.ascii	"\236\b\252G\217\263\213H\211\\RV\032\031\\?\273\356~\246\310"
+	.ascii	"`\341M\337\323\007\227\027br\372\236[_\3532\345\312\222\303]"
+	.ascii	"\n?s\244p\356\260ll2km\035\323\030\240\007\013p\342\340e*\035"
+	.ascii	"\037\220\200\364\370\242\343\347\216/\275<*l\\\347\215\2378~"
+	.ascii	"\035\037\0311^\246\364=\207&\370\264\361S\353\3279s\3248\263"
+	.ascii	"\244\3579$\301\377\231\365\353\364\b\371\002\227\246\3579x\341"
+	.ascii	"sP\241\252\352\254Q\001\223\234\306\212\247I\0262m'\326\317\032"
+	.ascii	"TNl\302\372\2363\316\253\377:?]ie\262\316\253\323\252M\005!N"
+	.ascii	"u=qr\244!\323\227F\303\375\377\022\256(r\034h\274xq\306\260A"
+	.ascii	"\302\270\321\202!\016k\355\352\204\3613F\263a`CEN\n\025\034\215"
+	.ascii	"8/\364\375\00638\352\214:\247\354\224L\203\250\ry\346C\017\f"
+	.ascii	"\027\344\274\365\375O\251\237S`e-T\365=\033\035\313D\tE\255\357"
+	.ascii	"7d\301\377\371t>\231T\037\240e\247\253"
+	.ascii	"\017n\\j\264\004\031\221s\322\367\033\270\360\177\036\317c\263"
+	.ascii	"\335c2\323\320 \266u&\013/[u\311\300\210\315\212\252\3577\314"
+	.ascii	"\310\313\273\202&\265,\022\326\367\033\216r\344X\270\3534%[\355"
+	.ascii	"L\215\345\255\301\020'\206\325B\337\017-\361\177\341(/\234;u"
+	.ascii	"\235\246\344\343O\025\037sZ\276\264\261A\243\357\207\310\340"
+	.ascii	"\377\276\271U\33677\352\003\255\255\\\003\001N|\210\315\261W"
+	.ascii	"rD\220}?\264\346\306\215\351\366\201\220\255\214\345A\t\032$"
+	.ascii	"Y=G)99\372~\b\215\r\233\013f\253H\321\372\360\263\205\tX\234"
+	.ascii	"\276\037r\242\306*\257\032\273\346\003![NN\0270\3012\003\327"
+	.ascii	"L\242\224\025\351\373\241\251%\032;v\263\020\240\fU\246\n\031"
+	.ascii	"\007_\203\013\370\026\212\275vw\314\275\263c6\303\260\322QK\223"
+	.ascii	"\261\324\020\207\257\341\212\2313\026\356\305\214\245\206%\370"
+	.ascii	"\032n\340\377\222\271c.\235]\2033\033\2161\204\306R\003"
+	.string	"\024\276\220\235\0301\331,\003C\n\313\223\254\245\365\001C\020\033n9\276\314\315\305\355\004\271\342\022\247\357\205\322\342\342.\230\fy+g\244\317\254\353k\351;S\365B\332\225\373\005c\341\264\2749#\243\357\331\230o\376\353\364\312,\3611\325\367BO\360\177\337\224\367\315T~H\346\343\316\323\r\241 ^\274\230h\037hM\311X?^G'X=0.dO}/T\265\302\n\027L\313\001d9\314\030rQ\320\372>\203\033.\\\2766\001\213\004\273[\312i\321r\335d\234@\250\220v}\335\326t\264\274\254\314\260`\231\243B\3168\222\345\324\367\031\224\260\261]\345\004r\316f\316<\342 \263\226\326\007\036\024\252Z\320\352\373\f]V\254\\\345\004\356\360\226YK\353\003\256\003\363\306\244\357\177\257\374*\327z\324\302\362\272d\250\201\177\317\354MS\373\232\007(\240\034#*\f\231\341\005~\220\034\374\265\377]"
+	.string	"\373\346\346E\231\276\277d\366R\t\273f_\303G\253\r0\250\200-\203\324\340\007\221\301_\263\r\225\263S\001~~\204\321\245\320\367W\314\336\261_\304\210\033v\247X;\017\307d\246\301\023\365\025\304\206\037\344\004\337Z\273\336\177\245\334*\257\224\353\364\001\332V\306B\200\233\017$Y:F\232\274\310\353\373\240 __\027\254s\316\031\351;\373\001ey6\277`g\230%G\324\372>(\006\376/\024\253\274P\372.\203U\005\310T-\3378q\242%\206\t\023\223\352\003\264-'\254\013\304\220g\262x\244\330A\201\365=P\026\374_%\312\253\344k7\231\213\370\316h"
+	.string	"=I\222\244\331l2\323\360M\335Hfp\240-$H\354\330\207d\256\341;\233\001T\303\210\221f\363M%\311[\343\213\302\365F\256\357\177\356\204\b\271^A\212Ha\301#\362\353\325tp|\264\365\275C|v\244=I\301\356\277\316\331\325\246n\255\357\177\270\340\377\376\270=.\220\266b3\226U\005\242\350\226?a\370?>\360\177\271n\217\333u7\017P\311|\265\023\025\2273\370O\016\374\237\032[[M\005?Qm9uq"
+	.string	"%\211\23368J\214F\\\337\373\224\321\241\343\362\3009g8\344\345a\276\021QRf\327\210)\321\002\322\367>i8px\340\003\206\377\253\245\274Z6\356\236PY\005#\310\234\2652\330\221\"\306\345J\337\3734\301\377\315\372E\214\260\312\233e\355\356qJ\246\261\023\005&\r\036^\316]2\350y3\366\246L\337\373`\341\377\242\240\274(\230m\031\254*@\366\266\364\221\302\302\262g6(g':\2666\370\277VVy\255\354\031Q2\037K`\027GG\305\225\251\204\316J\024\232GD!\252\256Fb\b\013\322\021\322#\3248\024\242G@+\220I]\215\304b\211\020\354\254?\021FM\302#\237\213\341\222p\0352\225\020\002\035#\021\025\006Q\024E\025A\240\324\305*d\201\252\022\020\256D\020\214B\016k*\201&\025\350IEj:d\n\246I@\343"
+	.string	"\326_\252$\\yR%\241\nt\035\246&N0\242*\326\024\t\350IE\3064XT\n!\003#\250(\001\302/\004\023\026(\341W\002\305/\305\bA\306\"p\347IE\306\244\025U\242\240\251\250.-\241?\242\320\270#\302\t\022V!q\004!\021N\220\200\201\241!\nLZQ\245\020\306U\270\"\004\023\021)\001MLD\3410\001\034t\360\353\200DS\2104\3104\004\022\205!T#S\210\020-\212j\322Z$\372\216\320txW#\261\b<\217V\242P\035\366\214D0\241\341IE!R\225iE\323#\337\bk\232\"(\\\332\360\244\"\022T\214\220\"\204\207\023\200\305a\211T-\226\370\t\032Q\r\244\301\242\222*D\205\214\302&\020Z\240\034\350\t\016\213\023H\203\305\022\322T\025!\210\246I@\230\003\272\242&\200j\317\230\256hp\211\t\350\227*\tW\"\223*"
+	.string	"#\022:\024!\r\026K\370\331\031Q\224\212@\230b)]S"
+	.string	"\325\236\237\016\212\202\210\024P\264\022\231\212%\226\3225\005\005\032H\024\245+\212\"\311\230\252G)\212&\024\033\214\306\024XT\227\200\214\031H"
+	.string	"\252@%P,1\235P,\016\201JtHY\250L%\206\326\rL\304t]A01\302\232\"u0\256"
+	.string	"!\003\2125E\372YS\244\037\035\r\210B#\217\216Q\221Z\\\201\250\b\306\"\220g\203\210\242\325\210\016\211\224\322\325\350\"\305\217\bE\025("
+	.string	"\020$\202\t\224\020J\225\204\353R\261HBPxbM\221Tt\r2b UBU\nR\026\302\025\310\241\005\212\242\347IE\251Z\004\266HM@W\324\304\006P\030\205<.\206KK  \021\205Ik\261\250\224\002\250n\350\260A\221\221\251(d\221\252'"
+	.string	"prP\324\224\006\211B\337\223\212\220\204G\034N\254\304TU\231\200A\351\212\256)\326\324\230\242P\213\252\032\202Z\024A"
+	.ascii	"\351\212\366\234O*BbZ\221\006C\004\207B\246\025\035\322`\261"
+	.ascii	"\004$\246\025iP\207\307\270\002\204\037bQ"
+	.string	"\270\002\323\341Qj\002\250\366\004\211\250\222R\261\004P\325IW\024E\272\242C&\340\020\005\016\035(TSb\212\204\317A\007\t\350\200D\223\357$\030\240\001\0034\350\235\004\003\214\214\030\320\201\021~\007F\346\3723\252\351\220)\2044\310\264\n\327\025\035Z\327\023\214\250\212#\340N\372\013\216\320T\\\341[\177\"6@\213\303\243\263\005\252\232O*bR\022\016\207E\365&\001W\341\322\331\002ua\032S\246!\312\242\367\244\"#P\r\001<\252\300X\002\250f\300-P\027=A\"\272\"\210\246\301\240\024i5\242G\277\340\260\230\364[\207\250\206`jTS\026\251\372\373\265@]hX\237T\264\364KWT\r\001<\272\340\0044UW\374\320\245\325gXTWb\021(D\302G\"]Q\024@\325G\"(,AMZ}j\322\212\215\351\212\252\247\211\021N\250I*\210.\202:$\212KM!\264@9"
+	.ascii	"Tw\236T\324\244\206hR\205\214?$\341\021\261X\242I\335YB\225\200"
+	.ascii	"\352\251\246A!\213\242\272\364kR\207\250PM\215A\304\242\320h"
+	.ascii	"dZa\364iJ\207KL&\216\206h\322\316\260\b,\256Eu\351g\375\211\330"
+	.ascii	" (\324Y\211LE\340\357H\375\t\227\214\277&\225C\032\024\252j\312"
+	.ascii	"\242\370#\n=\254?\037\022\252\242(\374!"
+	.string	"1\r\227\210\202\326\324\230\252\305\225\t\375\005\211\302\025\277\0255\376\224\230\324\365\204t\311\b\200\236t\210\002\215;\253\232\262 \n\177B\243Q\345\001\252A\241\322I\024*\341\023\200i\022\260\tU\302?\306\022C\224\305\260\270\244\246+q\004\240\312\301\230\246*RjB\t-\301b\351(\303\212\262\020\256@\020\322`\261\004U\210\022\021\205\300\324\310\364kB\225~M*\3170%\022\321$\340\257\211\t\3755\241J?\353\223\212B\020\213JJE "
+	.ascii	"D\270h\243\bA\224)\004\302\025>\032\254h\243\025-bE\033\241-"
+	.ascii	"\002m\243\246\026\321\324F.zX,F\340w\032\177\351PxTTO\004\205"
+	.ascii	"K=\353\223\212\202\302\245\020k\022\222pHd\302\032\177$\202\302"
+	.ascii	"\245\336\t;\202\r\n\227\314\026\250\213\035\021$\375\216\226"
+	.ascii	"\206=\"H\3629:*\256L\300_\022p-\0223\244K.\326\237\232\256C\341"
+	.ascii	"\321/h%\246@5=\261\022\205\305\023KLA\242P\003\034xZ\240\034"
+	.string	"PbJ\021\024.\371\020\213\302\0255\022\323%\245b\211\240\360\304\212\256`!D\024\226\260\202\020\024.\001\245C$\"\b?.V!\013\341*4\022\323\024\303\224E:\004Z\201\351\321\221P\032,*\375V5]jJ\177\353P\270\376\210E\021\b\325b\022\221\212t\270\256E5I\305\006\242\020\225\200Z\\Q5UR\323U\250\241(\\Q\024M\3500E\221aMB\022\246\032H\241\244\246kP\bE\013\324E\320*T\022\2220L\201@\020\322\025U}\202H@\301a1\311\230\252I\353o%\n\213Kkj$J\225\204\353\016\023v\201\016\323 O:D\"\242\032\326\037\211\225(d\362\245+\252\376\204\322\037\212$#\252\226\b\n\2272\270PS\026E`\252\376\222\214\250\n\364Y\177\035\030\255D\241o\335\360\342R\252\206X\213E5\004O\272\242(\324t\211\311\250c\374\245,T\246\022\351\212\242"
+	.ascii	"\252\030\276\200\005\224\360\200\001\023$\200\201E@\365\007<"
+	.ascii	"\n\001<\nA\024\242J!\200\2521D\321\220\212\246D\341\260W\\jJ"
+	.ascii	"\357\377\336\361\024\243\322\345\016"
+	.string	"\257\227\357\024\b< S\362\314\304\304\261\2731\347\254\342\006\307UW\337$X\316I\237^\223\"SmqnT\030\036h\344\372\236oL\023\344\345\235o\372\204s\276\360\363\315\177|tO\250\234z\367?\361.\330\r!]nN$h\242\264)\322\346\312\300\200\344\254G\034\233\363\311\001\246d\260\255\271?\222(\277\324\\/\263\t\230\216\024\372\336*\3174\227\307\351V\345(\004\315W\004\322\310\370\261\264kz6\242\340Tq\201\t\025\036awwg\215 '\200\343\221\\r\366dL\335\016\237\031\236\022\353L\3275\013#\005\305\fU\332\235\\\214\276'\335Iw\335&p<\313A\001\231)\025\264\002\204i\250\243\301Dj4Sb\fHbJ1\245\324L\321\264\305S\025@Pp<\036\225\f\310\275\036\023\200\303\213+\025\242\234vH9B$I\222\354\354\0336\r\003\362\354\317\311 \035e\345F\037\005"
+	.string	"2\245e\307\376K\016\030\253\335\330J\321\206\200\021\365\313\351\206P\3200\265\313$\236\275i\231P\006\031\021VDcHu\376\266\207\212v\350\325\246\247\334;\273\264\327\321\023\016\336\334\356\231y\210.R_\360a3\357{.h\317"
+	.string	"\351\257"
+	.ascii	"x\273\343\310I_\035T%\367\366B\310@\345\317\360\327\203#(\217"
+	.ascii	"\2506wk\242V\306\023\266\372\232\231\270J\t\324\232\334i\376"
+	.ascii	"B+\021\320q\002Y\001\022\304|]~\264\006\266\324MuQ\212\216\324"
+	.ascii	"\314\310\tG \325\221K\207\277?\247\343oRa2\203\237\0169\227I"
+	.ascii	"\r\360\312\224\242\222Y~\330\007\025F\302\356\364R\n\335\003"
+	.ascii	"\031\203\214\314\216\276_\020\370\262\251\342\021U\341\007\307"
+	.ascii	"M(\302jk\331\341;\361V\003K\325\274\022C`\220w\007\007\026\230"
+	.ascii	"m~\bU\347\035\230\2122XO\263D{\21116O\216"
+	.string	"\0066\361\2241(\371\30450\367\207`\326\")\322\0050\216vz\t\264\311P\373%\202\270\232I\355\bH\227@v\345\032fD\202hf_\0179\343\354\031\177\021\346\263K\227ck\231\315|7t\213\250\030+3dS\020Q\232F\345\377\330\323~(\r\375\371\177$\202\030\262\356\354/\343\035\005\320\324\337\354K:\335\347;\343\261\243)\"@\222\326\026\324\t\264\362GE\023\257\212\2047r\213\337\311\bq\005q~z\224\224\313B\230J\315U\232\315\273\232@he\253\275\257\204\361\rF\372\264\241\353\201+\242\244\241?\261\264\234\242\001\226\357\2729\364\254x\332\264lyE0\242\207\212We\2009Tr!\362D\376\352\240a\300\243?\301\355\375\241\250\264\270\203\357\266\333\266\353\262\202U\243\332\235\324_\230\366\2063\350mk\016\032\331\342\234\203\3569\352`SK \321\356\020s\334\207\274\301\342T\345\277"
+	.string	"\005\255\367:\331\235q[\037`U\217\370eI!$\020\324\223W.\200\253\013~n\240\271\036\372\372\0358y\017\320{\020\237\\K#^\346\352\267\233\023\322jE\023\001\377\362\320\345\226\023\300\021\365\217V\310\\\272\342\240\361\227\036(\216\222\301X=\256H\364\226\314O\024\311\351\277\363\\\310\177\342\361\364<\353\220\3710kh\241<\372\206\210n\207\246\327\202\223\256\f\\(\302=\343u,\326\032(\225$q\217t\341\327\231]\361C\253w\206\356%_\377n\214\355\017\266\342 \276d\026\352\033\240\036\274\321\316 \247,|\366\342\247\"\232\"\212s\216\363G?<\214|"
+	.ascii	"f\rfC\220\310\007\241E@&h&Z\265\332\b\204no\230\202lr\272\212"
+	.ascii	"\276\245\352~\363\214{\274\310:j\031\0256\003#Y\221\277|\351"
+	.ascii	"\274C\334J\313\240\301\300\224y\372\013\374s\"U>0\rA\262q\374"
+	.ascii	"\322=\302\202\024\314\201\317\0308\376/\333\342RT\242\264@Vp"
+	.ascii	"~\024\322\267\365Dj\205\357\364J\345\235\303*\020Vl]q\271T\t"
+	.ascii	"$\213#s\251N9\357[tuj0\267\301U\206\255QJ<;\246\305\205AR\215"
+	.ascii	"P\2655D\325\336Qd\301\201\"\232B)\b\254\2421`%A`-\321\271B\323"
+	.ascii	"~Q\263\311M\304\351_\b,\260\351\335B.\212\250\341\3244>\021\372"
+	.ascii	"LY\t?\312\373SI\031\2526!\235\"=\322\t\330\241\357\fF\r\315\306"
+	.ascii	"\n\265\323\277sA\302}\037\305\360\316\021D\257{\245\367\247\330"
+	.ascii	"\242\371\242\200\216[\203m\335\222\234\370\013\272\030\376k\004"
+	.ascii	"}\212\211\320\250\3451\241H\314\272\003\333\343\205\264\301\305"
+	.ascii	"\252P\003;i\250\372\323\242I\023\216\231\030\273#\033D\366\025"
+	.ascii	"pU`,b\303!\351\236\336G\217\034\017\r\305\313\2529&\t\325e'\327"
+	.ascii	"y\026\013\004gc\302T\305G\275\3427\021y@\023\372\224\326b\232"
+	.ascii	"+\334~e\262.\004\021]\245\305\267\2326\334*\030\345#\242O1k\214"
+	.ascii	"e\b\222\260\223*D\240]\225\255\212\242O\3456\370\303\200\220"
+	.ascii	"w\335JA\245\032\215\036\\\200\300(\363\344&\301\n\2130\257p\344"
+	.ascii	"8(p\363L\263\025;qbbe-\204K. \342\202s\275\005\250\\\200\247"
+	.ascii	"\033\027F\275\207\361u\240\225\205Hd\270bL~\271$\320\355\254"
+	.ascii	"\376L\021jLTrj\377\2343\334'\213\212{\306\206\035\241c"
+	.ascii	"*\362Ns\237\231(h\206P \035`\250\177\346z\322\240&/\303\263\324"
+	.ascii	"\331\025\017"
+	.string	"\007^&\231\030##V\254\"\324\333%T=PL\276\365\242\253\225\267\031\b\202\006<\205h6R\r$\224\217\f=\343!\2537\2725\241\361\320,\016\336\237Ta\325\342\354\203\005\002\230\252cT@A\",1\326\224\310&\337\027;v\004\2367\232\325uHK\311O\242#\330\314\337c&ag\333H\354\215\217k\233\374K\r\321\304i\313\023\366\347\034\305c\374$\302\t\220\202\335&@\321\264\252\001~\357\n\356\273\261\364H\250^Fm \004\332\341q\247B\354pO.1\303\270t\313OML\tv\264p9\262\337\033+\200\0200\334d\375\357\2751b;L\315\276\371\355\365.\370\312\232\275\027\337<\217\032OX\320\313BC\311aAO1`-]\255w0rU\363 \t(g\t\262#F\264\004\354I1r\313\306\351K\361qZb\345\227*\371\003k\b\3367\372\311E\004\256\234\371\352A\036"
+	.string	"q\035\302\360Vx\366,\306/:9\214\332HS\035\265m\241\033!\236\201\032wk\f\365\355\006\374\325hJ9\2368tH\221\225+\252\032?\252\034\256\264l\317K\340\213\307p-C\267\2003\301a\330\351\344\210\202\364\365\265z\030zl\332"
+	.ascii	"i\332y\376\312t)\300A\307\031O\217n\216Nq\026\027s\317\177\266"
+	.ascii	"\307\032\264"
+	.string	"\030\321\340\267\214\254sFs\305a\256\372`\267\3010\324\317\351W@\212\264Q\260\036s\347\025\017|\3700a\255\232\216O\214A\254j{G\222\276\231\316\\\341\303zp\333\254\267Gw\255\373\301\326\203\370GA\355\300\270\240\225E\326\344\332\301Z\220\bG\323q\260\221\013\275r\341HDc\327o\322?\215\302[\2138GW\252nX\373\330\320\tm\364\2151\023H\222\b\210\222\264\373\333\217\231\244\026\355!\342\3700\321\020P\003\210D\213\350=\362\006\\YGAJ\360\311\272\317\313\302c\274\314\215a\366\2762\323\013\026_\017L\360:\266&1\252w\211\"Fo\0261\243\262\253\220\204\224\246\204\213,\244\261\250U\223\306\265\177\326\t\334\270q\277\201\233\225\007\350\274\352\027\307\364\365\224\027\257,\331\320n\371\216\263\203\3507\342\364\030\023\2278v\231\215(6j\r\370\365\021\n\364\026\221\315\307\237*(Mw"
+	.string	"B\303"
+	.string	"\377u\216l\237\372\375\356\3074<G\340q\233G8k\322!\216\335)\211.E\350\013\354\250E\354\323U"
+	.string	"E\035\340VS\t\211\356"
+	.string	""
+	.ascii	"\031u\324^\200h\257\347(\312\261H\202\347\257\024\321Y\265-\214"
+	.ascii	"\375s"
+	.string	"\022\003X\343\377\321\353\316\031\2135L\fS\271\375*\027\376\217\200-\317\226\252\b\016\004z\320\022\032V\251\276a\245o\305\251j\221\341\006\344\007};\207?Sc\3717c\252\266\357\035\203\314\362\206=XQ\3519\231\347h\374\266\364\3321\310\237\3156\n\255\205\346M\353\277J\257\247\215\004c\314\356b\221\367\030<[~\026u\205\331\210C\017\266y\211N)Z\200\275!u\177+_\372\235E\300C#\1779\315\232\316\303\254A\013\326}\265\264\231k\\\241\314Z\203\027|O$6\370y\300psd0~\250\304_\253Z\243\377\302\217\300\346\003\313\253\020\377\fx\300\350\355\223yE\276<\337\251\351\031l\367\331\342\343;\276wm\247\366\365\005z\036]\256\340 \3557\030\376 \177-\250\005\362'3\374n\373\363!\261a\345\267\027+D\277r~\362\373\270\272\301\360\265\022\271\232\341\306Q\371`pD\311\035"
+	.string	"\265IZe\370\215\355E\303~\244\320\203xo\241\237\202c\257\317\237r\365t2Tp\017\210\317\343\2376\254\231\374\302t\312<\256z\035%\356\023[&;gU'\320\264\311\217s\302\b\003\364mg3d,\223\237\250a)\237 {\330\354\205-\006.\37335dq\306\304C\322"
+	.ascii	"\321\035\302I}e\240\326\025"
+	.text
+	.section	.gnu.lto_.symtab.e232ba9da34a25fd,"e",@progbits
+	.string	"getSetpointRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\002"
+	.string	""
+	.string	"getRcDeflection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\002"
+	.string	""
+	.string	"getRcDeflectionAbs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\002"
+	.string	""
+	.string	"getThrottlePIDAttenuation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\002"
+	.string	""
+	.string	"generateThrottleCurve"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\002"
+	.string	""
+	.string	"rcLookupThrottle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\002"
+	.string	""
+	.string	"generateRateCurves"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\002"
+	.string	""
+	.string	"processRcCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\002"
+	.string	""
+	.string	"updateRcCommands"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\002"
+	.string	""
+	.string	"resetYawAxis"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\002"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\002"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \002"
+	.string	""
+	.string	"isRXDataNew"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\002"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\002"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\002"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\002"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\002"
+	.string	""
+	.string	"headFreeModeHold"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\002"
+	.string	""
+	.string	"pidSetItermAccelerator"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\002"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\002"
+	.string	""
+	.string	"biquadFilterApplyDF1"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\002"
+	.string	""
+	.string	"biquadFilterUpdateLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\002"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\002"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\002"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\002"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"getTaskDeltaTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\002"
+	.string	""
+	.string	"rxGetRefreshRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\002"
+	.string	""
+	.string	"isAntiGravityModeActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\002"
+	.string	""
+	.string	"degreesToRadians"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\002"
+	.string	""
+	.string	"qMultiply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\002"
+	.string	""
+	.string	"qConstruct"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\002"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e232ba9da34a25fd,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1648 @@
+	.file	"fc_tasks.c"
+	.section	.gnu.lto_.profile.96e4a9e79f34a3db,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.96e4a9e79f34a3db,"e",@progbits
+	.string	"(\265/\375 \347M\006"
+	.string	"\324\n\333"
+	.string	"\030"
+	.string	"\324\334\244\217\006\002\002"
+	.string	"\002"
+	.string	"\002\312\336\235\231\b"
+	.string	"\003\335\251\235\247\b"
+	.string	"\004\305\310\217\365\016\006\351\375\235\234\013\002\002\001\002\001\b\366\371\266\316\016"
+	.string	"\n\326\355\327\313\007"
+	.string	"\013\240\202\241\324\017\f\307\222\370\260\013"
+	.string	"\r\210\331\325\364\005"
+	.string	"\016\347\230\200\264\n"
+	.string	"\017\376\376\316\323\004"
+	.string	"\020\214\361\272\261\003"
+	.string	"\022\213\313\376\226\r"
+	.string	"\023\376\303\253\241\n\026\305\352\265q\027\030\360\335\350\372\001\020\002\002\002\003\002\002\002\004\002\005\002\006\002\007\002\b\002\t\002\b\002\001"
+	.string	"\002\n\036\337\207\252\271\006(\240\342\234\212\n)*+,\240\342\234\212\n"
+	.string	"\n"
+	.ascii	"@\004\334\225\322V\273s<\340mi\032\260\022\370Q\347\300\263="
+	.ascii	"\030`\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.96e4a9e79f34a3db,"e",@progbits
+	.string	"(\265/\375`*"
+	.string	"\375\003"
+	.string	"\204\003\036\001"
+	.string	"\022"
+	.string	"\001\001"
+	.string	"\002\003\002"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\002\004\001\001\001\006\b\n"
+	.string	"\001\013"
+	.string	"\001\f\r"
+	.string	"\016\017"
+	.string	""
+	.string	"\020\002\001\022"
+	.string	"\023\026\001\027\002\030"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\" \340\202)\262\016W\311\200\356\035\341\r\205\rO`\037\270\030"
+	.ascii	"\267\255\231\257\367&\026\236\350`,\204\031\206{H\204|\300\037"
+	.ascii	",Dv;\0136\244;f\237\020\340\005\023\272\352p\323n\n\374X\022"
+	.ascii	"\007B+\256\033"
+	.text
+	.section	.gnu.lto_.inline.96e4a9e79f34a3db,"e",@progbits
+	.string	"(\265/\375`\266\003]\n"
+	.string	"rK'+pI\324\030\346M\036>\202\376\364"
+	.string	"Q\223\346\024\301\313\373\330R\004\300\263\324T\225Z"
+	.string	""
+	.string	"\200"
+	.string	")K@\215p\023\264\277\267\334)\377G\347 m\310\0362\016\024t\303&,\027mp\001\306\004\377~\006\316\335M\036h~9UB"
+	.string	"\333\256)9`9_-\b\211\212\0030\n\0279\337QI\224\226\254(|4B\242\264x|\207,\017\322\354\232*\230\217\345t\316S\212\310\272@\206\212:\354n\343\267\260\273\f\237\360\340\032\235\256\316\361\b\272\273\213\350\273\347Yl\327\024\277\031V\001H\250\3615\233\t\344\224\244\265\003p\"\"\250\256\003\022\240\362(\003\202,F\t\230\2001a\312\030#(\201\312\315\032\213\001]U\217\247\366\222m\30666xn\331\207_\027E\364u\223\036\327\321\236[\367_\017\212\201\n\350\322{us\205\354\363$\252\311\204\261\004t\312~\026C\314q\246-\303\375;\246\220\247n\215\260TEx\202\251\350\t\b\361\3063s)'(\263\336r9$#\240\tk\221\347\352\352\363X\204g\3348 \252\210\031K\242[.\250o\3634\304\b"
+	.ascii	"\360\234\246f\322\345\234IQ\256\310\307 &lj\325A\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.96e4a9e79f34a3db,"e",@progbits
+	.string	"(\265/\375`r\004u\016"
+	.string	"\226\222;6@i\233t\303\260\260\364p\2545r\255\245\270+\003\373\030\3070@\216\317\216\037\003\\\253Z\275\327\n\230\216\253\260\350;\222\271a\027\210\330\335\330\335\330p7i2\311("
+	.string	"."
+	.string	"/"
+	.string	"\224\230\350\002v\2529\341v\232>dk[\327\362HeY\226\3350\336\260I^Z\243\336o\224\332\224dT\362\371\240C\021\327?\022\262u\217\017\274\201\213\340\004\016\017\020P\253(\b\344\312\265\221\234\306\3346$F\317\365\\\320e\313\275\345:+:\201\013D\360\001\001\007A\217\202(\302HRUm]\243q\345\306nwp\247\006\267\221\312P\231i\222P\252Bd\006\277`I\233\313\224{\n\200F\332\374\344\370$$y\303^\302\017\341\266\021nk\333\255k\032\207\343\301m\f\001\260'G5d\231\343,\026\317S]\327\305`\274p[\273\373\272\266\002{\250\021iF\247\260$)\354\034\320\"\221\252\252\003\021@P\252\220)\031\021\232\005\256,c\240z\304\340:\036\r\204h>\023og9\205\264\235\037(\276\022\357\2574A\003:3\270)\034\333\272}\262\0048\177i\214\220\b`\363"
+	.string	"\037\3125\222O8\205\b\216\333\n\247\023\n\325\025\002'\203\022j\340x\365\020\205\271j\323\240\275\355\216\360\270\350\277\017\364\214\202\217t\204\035PD\030\007T|7\353\237\307-\270\310\263\225\232\242\354\201\346\221\034\002\234!\n\031\242\273\342u\rF\035\017\2502\321\312\276\"\273"
+	.ascii	"\277\032\305i\254\270Wg\200\215\241\361\035[\376\256\311\341"
+	.ascii	"X\377\033\262\r\305G\263\330o`+]\320M\347n\256\3039\377\027\256"
+	.ascii	"\202C\217\"\2106@|\332W&\215\270T\022\203\036"
+	.text
+	.section	.gnu.lto_.pureconst.96e4a9e79f34a3db,"e",@progbits
+	.string	"(\265/\375 ;\331\001"
+	.string	"7"
+	.string	""
+	.string	""
+	.string	"\022"
+	.ascii	"\230\004\002\230\004\003\230\004\004\230\004\006\230\004\b\230"
+	.ascii	"\004\n\230\004\013\230\004\f\230\004\r\230\004\016\230\004\017"
+	.ascii	"\230\004\020\230\004\022\230\004\023\230\004\026\230\004\027"
+	.ascii	"\230\004\030\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.96e4a9e79f34a3db,"e",@progbits
+	.string	"(\265/\375`\001"
+	.string	"\355\003"
+	.string	"\322\204\020\033\260i8\f\3030\f\3030\fC\333\232\221\255\031\211m\330\272\306\236%{K\231\002\264:\253N\252s*[\352\214\312\241\247\323\225;\005\230EI~\310\261\261\373\013\342Ah\312\340\326\262\316/\177_\001\030"
+	.ascii	"v\201\214\225\234L\255p\314\334\3116SBi,D\240\\ l\f\bf!\004\306"
+	.ascii	"\245\252 \013aV\255\3344\260\263Ss\\\242\b~)\003\006\\\342\202"
+	.ascii	"\3007\200\005"
+	.text
+	.section	.gnu.lto_.lto.96e4a9e79f34a3db,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_taskUpdateAccelerometer.126.96e4a9e79f34a3db,"e",@progbits
+	.string	"(\265/\375`*"
+	.string	"%\b"
+	.string	"\262\21798@s\322\001\030La\235\264uc\205c\204\323\216\023\255z\331\371\317E\316j\326\002\3751\21506\264\202\034b9\345\354\273\357\272\360\345\230\235\204M\324\337\232\264M\366N)\233CV\"5p\246\254\326\023\0050\rm\020\233\210{\240\243IG\323D\022\225&\255\333\f\021X\213\310\352\3444\255N\320\227\372\265\221e\006\222V*\252\354\201\376\212\304S\256\262\371!\227>M\300{\227\001w\rE\005\274g\350\262\321\272\210(\373S\301\350a\377\332\335ud\331\021\033\231)\240\331\315\310\301\331\226\214\021\001\331>\264_r\223\356'\026\376\354r\310\300\354~\tF\360\\\032|\240sy]\240s\351\316\266\371\007\262X\307\013\006\313\315\356\316\370\361\356\260\363\217\362\217\267B\035b\013\273k\350\2554\356x\333\007\266\025l\267\004\n"
+	.string	"2\241\225/0\\(D\243\225\303]"
+	.ascii	"\363.\001\020\253)\340./\332I\006"
+	.text
+	.section	.gnu.lto_taskSerialCheck.127.96e4a9e79f34a3db,"e",@progbits
+	.string	"(\265/\375`<"
+	.string	"\215\b"
+	.string	"\226P=8Pm\323\001\244\204\212\312\202rN+\262\177\272*\312\3172b\371\217\255\314F#(\307\255#J\207>I\t&\\[\226G\032_[/$\367\027\302\306\214o\255m\271e\n-"
+	.string	","
+	.string	"+"
+	.string	"?@"
+	.string	"\037n\365\020\255\206I\005IJw\245\334\261\341\312\360\273\";A0N\343H\\iQ\350\356\313qt\261\347\375_\360\237\341\377H?\370c\376s\225P1u\267\346\t\227\245.\345\277!K\002\2674q\200\356\214\222\251\273jnpY\312Z\202j\251\271\003\325R\377\003\265\367\314\026\005\207^\311\037\024!wd\266B,\376U\224\314\361\357\354\356>o\374\227\3479I\026\031\224n\321i\245O\250\222\217\007^'\3334\316\365=d\013\002^'\3334\316\367\311\272\016\204\005\034\333x\016\336\3655`\036\212y\350G\2736\212u\036\335d\316Ad\035\3758\256\243\230\t"
+	.ascii	"\0253\241L\213`\330U]|\327\220\210\t\021T\243\200\272hj\347\023"
+	.text
+	.section	.gnu.lto_taskHandleSerial.128.96e4a9e79f34a3db,"e",@progbits
+	.string	"(\265/\375`\256"
+	.string	"U\013"
+	.string	"\266\024NA O\225\016\200\360\001\373s\215\312\024\340G.\007C<Y\201!\270\205\377Q\200\202\001\206\352\375\r\007\033\020\202\326\334m\255D\277\345h\200\005*\034p&\bK\001\211B\027\023mb-\331d\313\224\002:"
+	.string	"<"
+	.string	"9"
+	.string	"\273\313\311\f\007?5\251\240\257!\212>#\246kR\224\261X\220\020M\227Z\201\223\n\n\035bI\233\270R-\276\272F\020I\252\220\312\356ZCq\302\275\335\266\305\366\001\373\001\002\277\252\372\020\013*\006\023\260bW\302L\266\255\211\242\203\304\366\325\276\207\177"
+	.string	"\257z\340\214]\013%L\354\216\006L \3629\340\223\355S\373\307\366i\320v\361Q\303BR/\b\"b\001\336\030\001k\221\244\350\034\302SK\032\264].`\275J\032\303>\210\207"
+	.string	"\371\033\354 \244\017?\375\320\366y\371\325=`\244\2500\322\231=\212Tb\260\257\355\356Z^\260\257\n_\002\fG\203\340\323\301x\036\250\343pG\3716\337\345\243\240\313p]\206\353h.\034\256\363>\216\002\300\036\006\030\217\373x<\036'\031\367\225\221$M\211\332\033\216\324\023/\\(-\242v\203O\037\006\023"
+	.ascii	"2\003\302p\311\302Z\021h`\366\202.\240\326\005\256$J\026\\\025"
+	.ascii	"aW\322`\241\300\224K\260\304j\312\270\3137\333\223\n\263\242"
+	.ascii	"VA\001"
+	.text
+	.section	.gnu.lto_taskBatteryAlerts.129.96e4a9e79f34a3db,"e",@progbits
+	.string	"(\265/\375`\273"
+	.string	"u\013"
+	.string	"\006\025NA O\234\01601\244\217'\200e\0012\313c`\274\270\021\207\026\311\007q7\n4\231V\302I\017\372_MP\240Q9|\354\204\351\001^5v\343\nH\216\026Z\305\004\326\324o\206M\310\336[\246\024:"
+	.string	"8"
+	.string	"<"
+	.string	"\241\306\336\243\302\311\303\305\356bQ\303\271\313\250\234\177\360\022\357#]^x\224\006BJ\264\020\360\231d\005\305\301;x\245\360u\252\226\202\335\265z\237\205{\336\366\002\333\t\354#\brw\3271\303V\265\245\352_\223\216\023\227\025\273\250\221\027\233\232&:Pl_\355s\374\003\367\216\t\226\354b\030\001\262\033\036\360\345\372,\360J\365)?\240\3724g\253x"
+	.string	"><\244\272H\272\206H\bH\264\245\262\342\301_(D\2440\251\210\177K\365hE\353\t\243;\210\207\020\371\033,a\244\367>\375Q\365\3718Y\220\330\300(\351\210\035\2224f\260\037\233\003\215\207\323 \364\321h\232(\013\340\f\263u\266L\350A\266\301\262\r\366\341d<X\246m\030\206\200A\0204\032\026\002\2014\214\022\356\345\306\f3"
+	.string	"S\245\330u&\034\036\375\330\220\227\332\0216\275\347\025"
+	.string	"3\241s(\206\207\243\300\335\252\032k\256"
+	.string	"r\301\rX\300\303\336D\265\005RW\304%\017\341XTx"
+	.ascii	"S.\301\022\253)\342.O\325\344\024M\355\001"
+	.text
+	.section	.gnu.lto_taskUpdateRxMain.130.96e4a9e79f34a3db,"e",@progbits
+	.string	"(\265/\375`\307"
+	.string	"\345\013"
+	.string	"6\026RB\020q\233\016\274@\362Fr\002G\023\327\f\026\340\350\214\200\001-\276\24310\001\025\244\350L\274Q$\344\366\347\236\270\250\335}\220\304Ta\023\n\321\004\n\242~\"\250\200\346/\330\275\375\307o{o\231R="
+	.string	"<"
+	.string	">"
+	.string	"\232\r\343\037\311ZF<d8A\332]*v\270v\031U\363o\362K\347m\227\033\036e'L1c\343\215$\007\004Dw\223\253\006\217S\265$\330]k\347\205\334\363\266\025\330>`\037A\337\246q\304\276\334\335u\024\261_\362KU\037\343`I1:.vAJ4\026\234*Bdl_\355\223x\t\355%\030|\331\345\200\"e\3673\340\002\033\237\004\316\231>\345\003L\237\016+\336\250\2745\331\021>Q\203R\003\304\250\r\272Z\210P\t\271\270\371\027M\276\211\237\210\374\017\246\220\351\273O?\233>g\b\013\222\214\017-y\252\214\266\205\013\372\316\002V|*\341(nvY\003\013\364a\020\362\2600\254B\005\300\025G&!\363\204\036T\035T\325Ay|< \252\3022\212c\200\257\t\026F\205\256\013\2432\337>\212x\301\b\360#r\322siPJ w\222\2250%Z4=B8y1\322\023"
+	.ascii	"3\003\3369dk\250\222\331#jA\211\306\003\2634x\021lo\224Y6u\365"
+	.ascii	"\023V\021\\\t#0\352\022\026\261\032-\356\362TMN\321\324\036"
+	.text
+	.section	.gnu.lto_taskUpdateCompass.131.96e4a9e79f34a3db,"e",@progbits
+	.string	"(\265/\375`v"
+	.string	"\345\t"
+	.string	"\246RE<0\305*\035\300.\024\240N\302\207\315Ri\246\201XT*\266\221\342\231\f@\314\031\375\377G\r\r\310\202\026\343\272 \031\226\345b\307\272D\264\304\202\231R7\252\334G\237\220\275wJ\0012"
+	.string	"5"
+	.string	"1"
+	.string	"\273\035\355\270\370J\247\350\037\366\314H\232^1\033\247\025\201F\3022@\246\352F\3451\036\366\231A\242\346\274(\354\256\347Hj\334\333m/\330N\260M\013\032\031\ngeW\025"
+	.string	"\300\3166\331\207\306\366\247}\220\273\304\277.\234\331\3450\211\355\226\034\037`\276\031|\303}\253'\340\276Y\264U^\266\366\302:\301\020i\331\363\243\353[5Z\214\332\202;\205\bII\315\232\271\211y\211\263)*\346\307\323\200\021\327,EMv\211\232\224e\277\356\356\232\256\354\277~nN\377\022\241\303G\024j \215> X\362\004\354u\302\210\320Cz\360@\235\007\352F!\217\250\363\300\260\353\024\370\223\370\200\035\351\373\300NS\236NWf(\231\235(\252f&G\355o\"\016"
+	.string	"3\003\3369$k\250+\354%T\373\300\013\353\336na\275"
+	.ascii	",\027k\211\325\024q\227c6I\003S{"
+	.text
+	.section	.gnu.lto_taskUpdateBaro.132.96e4a9e79f34a3db,"e",@progbits
+	.string	"(\265/\375`\177"
+	.string	"%\n"
+	.string	"f\023G= \3458\035\347,\376\325'\2429\005\222\0253\002ObWh&U\371"
+	.string	"\266\241\354F\333?\020{1\230\225{=w\302\330\ndBG "
+	.string	"e\307.V0r\220\265x\303F\366\336)\0054"
+	.string	"5"
+	.string	"4"
+	.string	"\333Q\220\213\257t\212\376]\337\214\244\351U\343qZ\021b)1/?9HT\345\244B\306\273>7\310\323\234\231\205\335\365\034\311\216[\273m\006\333\n\266a\002\233\232\tX\230\246\"b\277\264\271s\266?\355\217\234D|\013\303\233\335\017\224\327n\231\340\003\3155\203s\266k\365\004\3335\213\266\313K\326fV-\032&\001v\003\246g\311b/\352\213\3554\242\204\0055e\336f}i\263+,\346\307S\201\223\027\030\212\232\354\3224\351\312~\335\3355U\331o\375uN?\303\rX\351"
+	.string	"\330\341\303G\024r \215> X\362\006\354uB\211\320C\202\360@\235\007\352F!\217\250\363\300\260\353\024\370\233\370\200\035\351\373\300\216+\367u\251\312\r3X\006=\325\315\264?\212\3711\016"
+	.ascii	"3\241\367/\306\325PU\330\013T\363\300\013\353\336na\275\270`"
+	.ascii	"\251i\221X5-Nr\314+\361\fj\017"
+	.text
+	.section	.gnu.lto_taskCalculateAltitude.133.96e4a9e79f34a3db,"e",@progbits
+	.string	"(\265/\375`~"
+	.string	"5\n"
+	.string	"\006\023G>0\305*\035\300\370~\337\256\365\026\372R\247!\371\200E<\032)S\253\320\204E\n\212&\206\337\330PC\003\262\240\305\270.\210\300\034t(\0013(\200\236\307\f\367\362\304\262\277\021\262\367N)2"
+	.string	"8"
+	.string	"2"
+	.string	"\273\333\321\325\305W:E\377\256cF\262\364z\3618\255\n\262\024\002\032\362T7\251\221\361\256O\024i\232\323\342\260\273\236#\331qo\267\375`\233\3016-\0063X\201\001\r"
+	.string	"vS\007\f,lS!\311\330\376\264_r\023\361\255\fcvCV^\273\345\202\023.\337\020\276\341\276\325\027p\337,\332\002^\262\326\262Bm\240\320\002\256g\325d/j\f\356\364'1\220Y,\300i\326\314\315z\022g[\\\314\217\247\032\216\017\330\211\226\354\2624\251\210\375\272\273k\252\262\337\372\353\234\276%a\204'\004\202\030\211< H\362\b\354q\302\211\2603\222\360>\235\367\351D\240N\250\363\300\260\343\034\370\243\360\200\335\350\373\300.S\356\353R\225e\032\324T1\263R\373\253\230\037\003\017"
+	.ascii	"3\241\375/fk\200\203\005\332\302^B\265\017\274\270\356M\030V"
+	.ascii	"\031@u\261\213X\215\026w9f\22340\265\007"
+	.text
+	.section	.gnu.lto_taskTelemetry.134.96e4a9e79f34a3db,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"\275\n"
+	.string	"&\325L? O\225\016P,\314\220\"\274\331\002\006\022:\234\022\370\013\215\035\336\244\036g\206H\204\305\321'8\fx\004\265\204}\332$\372-\365\020"
+	.string	"\024\032\027\246\232L\244r\023N\367m\215\354\275eJ\001;"
+	.string	"9"
+	.string	"9"
+	.string	"ai\035$\f\021@\270\330],\222\336]F\355\374\237\016\371@\357\362Q\341Q\002X\215h1\001A\222\022\322\360\375t\225"
+	.string	"~T\035\004v\327\372\201\023\356y\333\005l\013\260/\trw\327Qd\337\364KU\3371Y\201b\300\211\335P\353\305\252&\211\r\021\333W\373\035\356\241\273\t\202!\273\027B\244v\303"
+	.string	"\336x|j\234r}\312c\\\237\356l\025\017\241\367\227X\253T\214#_\273\036\025\240R\200\224e\377\303Q\232\237\301\f8\375\367\351s\327\347c\244P\202\203\005\217\266<\325v\360@\377YE\230P}\242g\207\236\306\221\375\034\202\313&s\240\303\271l[\203L\342\254\302i8K'A\206\3012\f\306\311X6X\266qX%\303\332\202\313\206u4m\303\"\341^n\024\031`\241\362\304\217\214\250\214\266f\243\377,\243w\007\f"
+	.ascii	"3\241'h`\255\267\350\260\027\241\232\0238a\002F]\302\"V\243\305"
+	.ascii	"]\216\331$\rL\355\001"
+	.text
+	.section	.gnu.lto_taskMspStream.135.96e4a9e79f34a3db,"e",@progbits
+	.string	"(\265/\375`\205"
+	.string	"M\n"
+	.string	"F\023H? \345*\035\340\034\r\340\013\025Q\314\001\t\006\341\2271\002\177\241\244iI\n$\216!(\224\002\255\341`\003B\320\232\2575\222\350\267v\225D("
+	.string	"f\214\246\303\020\tP\2757\204\b\331{\247\0245"
+	.string	"5"
+	.string	"3"
+	.string	"\033\222\331\253e\300\356~t\344\343+\235\243O@\256^c\247uA\366A\300\200lU\317\314\355\365\332\347\006\351\232s\003\332]O\030\331qw\267\ra\373\301\376\003\264\277\316\351{\007\002h\"`v9r\005\366\326\331L:\266?\355\243<e<M\303\003\273!/1\273\245\203\0338\357<O\360\336\325#x\357<\332"
+	.string	"^\3166tu\034H\316\205:\345\235V\260\324\270&\316\276\312WR~\2113T\363\260w\276\312{w\372\332\031b2'\036\254\231\263\313\325\244\"\366\353\356\256\251\314~\342\204\250D\222@\231Da\230\002\013\f~D\0131\204\242"
+	.string	"G\0378\372L\244P\351\003C\361\373(\370t!\n?\324\351\024~\235r\017b\321V\345\314Jm\fq\036\346i\013ps\005\017"
+	.ascii	"2\003\302\360\302\204\335\032(\r{\033\325\002\b4\"\304\244!\300"
+	.ascii	"\200)\227`\211\325\024q\227\237jo\212\246\366"
+	.text
+	.section	.gnu.lto_taskPidProfileCheck.136.96e4a9e79f34a3db,"e",@progbits
+	.string	"(\265/\375`<"
+	.string	"\265\b"
+	.string	"\346\020?9@o\323\001\230.,~\317S#\256\263\033\253F\200\216`\265\316\007\274\307?k\204<\233Q*\350\210X\t\345\365\023\177\002\313\332\236[q:&1\201\216'\276u#r\313\024."
+	.string	"."
+	.string	","
+	.string	"?B\202\370q\253\210I\223\201\302H\211\351\256\224Cv\3349~\367d+\022\225\225\362D\356\324,t\367gy\332\330\363\3767\370\337\360\037%?\347?W\212J\240/<4R\335\355\271\302f\255\317\371/jK\3045\2518@wGK\252\273z~\260Y\013[\202k\255j;\327Z\177{f\314\202K\277\346O\232\230[2c%&\377JN\006\371\267\352\356>\177\374\237\347\252\303\361\342"
+	.string	"\323m\232\221i\027\213e\344\277\030`h\3538P\026Fl\f\003`h\3538P8\332\276\217\244\005\\\373\200\020`\026>h\"\252\211\350\210\313:\252} \375\024\334\223\330>\032z\336G9\265\003\b"
+	.ascii	"\0253\241L\213`\330U]|\327\220\210\tq\003\252\242\351\232O"
+	.text
+	.section	.gnu.lto_taskPidProfile.137.96e4a9e79f34a3db,"e",@progbits
+	.string	"(\265/\375`\t"
+	.string	"M\007"
+	.string	"2\01645Po3\006 [\374\252A\025\002\262:`\200\321\031\003{s\232\226\003u\244\304X\274K\334\236W\022\351\302Bi\032q\275\244`S\220\367\243\255\273\233\020)S\n\031\203%\n-h#\013\303 &@\247's\310>Z\303\004\311\t\222\243\320G$'\226I\217@\257\007\013\223\332ua\222\343\335\324\243\251\n\037\037E$\225\202m\204\004tW\230\322\361\221\"\327z\034\214\247\326\324\3777\232\332\330\361PI`\371-^\\\376U(\034\234\266\206\255A\034\262Yd\242\233\037\303\344\344\367\fZ\240q5\340"
+	.string	"\214+\312\035\214\253n\355\212=\215g6J*HZ\376\313\230\341\315p\253=\342MW\342\f3\b\377\013\273\322\205\033\335\226\240\355A\333S\b"
+	.string	"2\241S/p\270\340"
+	.ascii	"\346]\002 VS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_fcTasksInit.138.96e4a9e79f34a3db,"e",@progbits
+	.string	"(\265/\375`H\t\325-"
+	.string	"\252N\020\021Hp\\N:[\232\377\202\237=6\002\370\267\333j\365\375W\024\245\373@+k)o\005\021\262\346\365c\377\206\005\243\302\271\317\271\277\002\257\357\320AK\002\216_\360Z*(\215{\\\026U\2055#kkF,!D\356$\003\374"
+	.string	"\344"
+	.string	"\377"
+	.string	"\334\353\313\274\276\254\236\227w}9\375e\364^>\177\271\357\345\373\313\0071A\214K\013\254K\223Y\266RuqZ&Z\205\310\323\376\265_\346_\355l\354[\353ik\246\035\251\240\036\345\b\023\330\247\331\3709.[\251\bY\226irm\273\024:\312\013\324\243\3142\247\371\362\253\375\023.PL\344\332\266%j\257\263'\356\350"
+	.string	"\030\n\203+\360\347\353\361\324]\212\236}Y\376\356\002/\212\352x\342\316\230\330\325\331]\370\221c\354"
+	.ascii	"N\tNrZ\217\233\n;\177tPb^6%\344\016\307\300\256\360\353\301\257"
+	.ascii	"\225\253\353\002\201~\344\330\372o\353\372\264\312\246\262n/"
+	.ascii	"n\212\007\357M<\256\306Ma}\267RA\235?m\333\236\355@eS;nju\364"
+	.ascii	"\311\351\236U\357\263A\223\n\234\225*y\022\245\206D\235\355\367"
+	.ascii	"\006\025\362\336\335\205\266m\371FQ\3458\027\317\374'f\366\300"
+	.ascii	"\254\272\bm\230i\361\236\375)\337\360*n\247\302\241\203\007\017"
+	.ascii	"\351\321\263\025\034\341\332\2727J\177o\\\320V.y\337\356o-\345"
+	.ascii	"\232\311\223\347\016\375O\316\f\"\204N\025\246S\037\271xo\377"
+	.ascii	"F)\363\b\022?N\\\342N\214j\333\266E|&or\202/v\224Q\034\241\374"
+	.ascii	"\243\364\350\355\256r\203\266\326t\353\376E\327t\353V\362m\244"
+	.ascii	"\357\024K\316$/\035\257\3677\246\314+X\334G\275\177ol\314d\037"
+	.ascii	"\271w\231a$\335G11\313m\256\211\354#\363\022y[\311\374\263\355"
+	.ascii	" \314\350\345\017O;S\370\332\271\250/\007\365\345\003}\031hw"
+	.ascii	"\371\347\227}\372r\317/\033\370\345\002\277L\240/\017\370e\236"
+	.ascii	"\276,\340\227\003\364\345\342/\023\373\362\316/\353\374\362\360"
+	.ascii	"\227\205\277\034\354\313kz\031\330\227\177\350e\337\275\001<"
+	.ascii	"_\017\247>\246\300V\236\375\353 B\007\352\276\257\225|yB_\311"
+	.ascii	"\310\326\324\241\003\365\2151\377\320g{\220\02013`\373\372C\363"
+	.ascii	"\205\252B\336:\2657\354\265L\330\266\254r\330\273\256\036\311"
+	.ascii	">\236lE\355\310\027\257\225o80@\320\250\302\356"
+	.string	"4^o\303\206\261\021\366\247\230\271m\333\036w\301^\313\300\336d\303\324\004\273\204\230\330\332*\205^\273\227\245\215H\nl\nc?\303\0221\003l\023b=~\275+\352_\367\332\352\316\232\245\276.\352K\201\262\202$\273\030\326,\356aX#\354\031\213\306\242\245G}m\302K\216Km\255x{\375-\347u\257\035\250m!\271<\303\245\274F\341\236\220 o\035\357Z\355'\371\027VMm\333d\021\277\313\275\260l\0304hH\217\356\272\206W\223K\r}W\021\271\246S\037\2077J\3350yn\332}\243\024\355\264\035@\315i\272uQ\2166\202\267\306\025GL/\222D0\3050*)\315\320@C\311\310\304t\224\301\2704c\310H\017\226\\,\0351\241@RA\204\244\202(\006\213#\030DHJKD\017x8I\206Q\211\210))I\211\310\267l\372\331v\020F\341\212\3145\233\032\311D\254\2371"
+	.ascii	"k\002\331\341\t\r!\363(W\314\246N\320\355\306\364R}\305B&\241"
+	.ascii	"L\327\024\200V\252g\257\322\237VZb&y\351t\\+\366\352V]\035,V"
+	.ascii	"\026\273\265\225\036\375i\364\r\031\264\265\341*\364\006s\226"
+	.ascii	"&8\364 \237N!u\237\376a\311\352\351\325@\367\250\006:\301\025"
+	.ascii	"\0263\031\324@a\230\022'Z\202\005\272\343\nt\2439c\3165\223}"
+	.ascii	"\274\353O\350-\240\340\200j\363\r\375@\337 \320\035\367t\002"
+	.ascii	"\215\340\212\234\001\375\343\351\001'O\373\\Y#\240}\001Z\200"
+	.ascii	"\032\240\021X\2751\223\305\356\021\273Hl\037+5fr\247S\235\336"
+	.ascii	"\201p\231Y\037,\220\373(\235\276cf\355\\\023y\026\265\230\007"
+	.ascii	":\200\267\250\201,\204\025D4\"#)H\nY\306\240\002\021\031+\326"
+	.ascii	"\001\021\020\245\203L\262IA\263oX\035M\027\202\210\234\240\372"
+	.ascii	"*v\261=\f\025\230\346\r\002\203K\231\002H\024\223\261\036%\216"
+	.ascii	"q\267\321\327\017ykn\b\204n\020.\007OJ\303X\372Y\006\265|\207"
+	.ascii	"\362M,\374\307\244#\326lT\246~\303\242i\363_\300\246\255Q\244"
+	.ascii	"\241\017\301\326\237:\211\265U%\310\343\006\001\361\327\324\234"
+	.ascii	"\tj\267B%\225\250(\304\2529@0\272:x\252,k\025\332\236\326\222"
+	.ascii	"o\032\322%\253\021\333\2216D7X\224\353\351\226\177#>VQB\003\342"
+	.ascii	"\n\r\267\rI7Q\333\356\344\3719$_ \200\225H\316\264\305\251|\016"
+	.ascii	"]\020\020d\371\357\236;\240\224\320\270\225`\200d\325\313C6\347"
+	.ascii	"#\354Q\323N\027\364=\001\221\330\ra\247\201X\017\366\351D\271"
+	.ascii	"\310\273\2043\215\213\025\t\266\2575Xa\326\254\276\026?p\fa["
+	.ascii	"CQyR\026+\214\222\334\263/\206\207\321\275\rU\231oNTi\264N\263"
+	.ascii	"\347\263Vo#\003\375\250\2011-`3g\220\225\355~\033\315+z\001\024"
+	.ascii	"63\256&\340\017\036\352\341\360C|\325\203\370\261H\332\303\022"
+	.ascii	"*;\213\013\0175\341'|D\332\351\313T^\027Z\024\370'L\017\1776"
+	.ascii	"\372H\220g?vn\0345\323c\312N\325"
+	.text
+	.section	.gnu.lto_cfTasks.139.96e4a9e79f34a3db,"e",@progbits
+	.string	"(\265/\375`X\005U\036"
+	.string	"\2262\300Ip\236q\016\017\367\r"
+	.string	"\265=N\201\275JW\205\351c\bm\207p\2168+x\2476\305\003\336\2140\2650\340.>\302m\006}dqz\231\240\252_\034\312\206kB\343\251\373za\200\306\304\262ByBz\362[\320\226I\006\256"
+	.string	"\255"
+	.string	"\255"
+	.string	"Tb\345\233\025`\213\375#\377-pQ\215\210,\252\346kd\324\267\261\312\307G\t\""
+	.string	"\013\373Y\374\263\030/\324\232\264b\236\371N\320\320\267\321J\220\004\003\256~?\205}*\374\261\252l\2509i\365\314\367<\352\333\270\345\343IJ\346\002\252$\020\205\277\224`\013D\345\2539y!\231\257\203\016}\033\217D\236\244\\w\251\300\033\210\372\275\024\373S\374\231"
+	.ascii	"\337I\260\025rS,=\370\235\277\t\210Rx\247\350\272o\b\363\025"
+	.ascii	"\n\372\235E\214\330\311;1\211\276a*\2461b\256\273\364+~\347+"
+	.ascii	"1>o\311~\377#\220\375\316]9\357\244#v2,\026\322\367Ql\353%\256"
+	.ascii	"Mh\246>\244\034Z\0251\3377b\244o\030\253X\347\367b\354\333\341"
+	.ascii	"\177g\254\250\034\036\343\377q\244#\3310<3\263go@&\207\177\034"
+	.ascii	"\226\254\221\244o8\331\206}7\374\341\274\351J\312!X_b\276\317"
+	.ascii	"\324\243\372\206\301\342\307\001\325\223\206\375/\376j\202-\020"
+	.ascii	"X\237*\207]\261\353\276\275\211\371\266gW0\025\37789\001p\225"
+	.ascii	"\344o&\330\002\225\261\225\3031\324|\223\210\372\206\307|\242"
+	.ascii	"\304\360'3fC\215X\025#\335z\006\242U\361\307\013\373\\\374\273"
+	.ascii	"\276P\250\021\261\344\314\267\247\353\333\030P\276\352\255\336"
+	.ascii	"\312_y-\257\365\\\276\313\203\3710\217|\257?\363h~\315\263\371"
+	.ascii	"8\016~\316\323\321\256.\241O\350W\263\320-t\f-C\333\320B\375"
+	.ascii	"\324@\367`\320i\350,\255CCq\315cG\037R\n\271\212\260\215\276"
+	.ascii	"\217\\\361\360"
+	.string	"\247\211\254n\342\372F\037\352\034\301V\b\207M\206$~\226 '\n\245\020\031?VS\337G\257\214\224\351+=\203\353\032\301\026\210F\277Q\n\277r\230\357K\321\321\367\361+\326.\270\206\241_\024\225\3025QA;\372>\302\341\251\243Qp\235\002\250W\004[!\025\275G)\f+\3760\337W\002$9\207\256*O\235\345\241\333\216'\353R\036\321\3168\324f;e\353\331\2231\244e\306\235\267\024UgY\202m=w\352m\250'\243D\347\212\323YX+\240ijd#\220\3255Eqg\217\227\242\353zB\030\220\325\035\021OV\325s\227\323\331\314\254KO\b;\243CF\353m\305\235=\231\227\256h\016\305\241+\200\274\336p;\325\226\2329w\242\351\252\366vj\316'\243\270[\004]\272\353\r\335v?\331\267\240e\333\243\017=\037\007\232\217\003-\351w\304i>\245\226\266\340@\006z@R\242}"
+	.string	"\002\225h>\371\237|q\250A<\244\230\265NaJ\n5\232\003"
+	.string	"C\021#z\0200\305\346huI\207(eG\314\311\3277yF.tk\260\340y[[K\222)\035\005E?\211\302\005\261\223\2536D\315\300\021\033)\362\002\241\320\265x\362\265\320~\226\246\276\"\215@\307#Z*2\240\026\356U\210^\343\206\221\341~.\265\266\333F\357G\r\356\345\261\232\007\"xu\227\374A\002J\250\355\214\377\200*) \326\020TcE\310\236\300\3338\242\270D\0356\203\211u\310"
+	.ascii	"\331\232\177\303<\006],\021m\216.\325\351\345n\230\321\322<\202"
+	.ascii	"\212\304\255\t\306\024\"\340\005\"YM\205\21527\224MI\033\036"
+	.ascii	"\177\270\234\353\244\"\310\324\371;'\003"
+	.text
+	.section	.gnu.lto_taskTelemetry.part.0.186.96e4a9e79f34a3db,"e",@progbits
+	.string	"(\265/\375`\276"
+	.string	"5\013"
+	.string	"VUL> O\225\01601\320\340\"\024\0350u\235\352\rP\r\240\305\361\371\212\020*\220\205\2608N\303\030;\020B(Q/?\202j8\017"
+	.string	"\021B\343\231\006H\005Z\272|\236o\t\331{\313\224\002;"
+	.string	"7"
+	.string	"9"
+	.string	"\245\n#Z\354\356\274\204\243s\217P%\347\377tG\347u\036\265\363.\034F\004\253\022,\004x\237\030\001q\350~\272Z\360<\252\003.\257\005\273\353\006\206\333\272m\006\266\025\330\237\001\034\373\361\270\264\255\372\217s\323&~\353\205\254j\037\304Cp7m\354\330\325@\"\265\373%\270\364\201\306\245\201G\254\313x\210ui\337\203mN\310\234\255\342\037i\257Q\"\333\023\254\303\227D\244\370h\206/m\3547\313\326H\320w\207\004P'T\037\330Q(2\224qw\327p\203\375\357W\250\376\005\221|\330\005\275p\261\031\244\211\016\266o\377\024\233\003\312\305\322 \203\241h\232\006\013`L\262A\330&\231\007Xeb\225\211\261L.\023\323\266))\340,\002E\233\231,\323\346\343+T\024\240\3070b\250B\373\222\351;\003@\2418)c\225\2020\024"
+	.string	"?\023"
+	.ascii	"\346\n\026An\203\275a.\242n\305\232sd\260\004\220\007F\324u\345"
+	.ascii	"\f\255\347\2243;\003\330L\336i6\270\366b\212CS\343\336U\306"
+	.text
+	.section	.gnu.lto_taskCalculateAltitude.part.0.187.96e4a9e79f34a3db,"e",@progbits
+	.string	"(\265/\375`\273"
+	.string	"]\013"
+	.string	"\226\325M? O\225\016010#"
+	.string	"\300\204d\235\240\0016\023G\031\240"
+	.string	"b\254\376La\026a\025-\356c1\306\016\204\240\226\250\227_\242\337R\017\001 \002\003|\360"
+	.string	"P"
+	.string	"\336\241\246\277\221\275\245L)<"
+	.string	"8"
+	.string	";"
+	.string	"\030#\r$Z\354\356\365\250\030\347\0165#\347_uI\347\201\016\263\3636\\\241\002\217\023,\004x\"H)\201\350\256z\216\274P&\201G\210\203\335u\204\303m\335\366\003\333\r\354/\bW}\354\311\344\321v\346\277\3179<\360[\317\344L\373\033\027\301\235\303c\311\356\207\024\035\273\037\203G'\210<\0368\305z\204/`=\332\327\260\3751\231\263W\374\313XH \353\237\361\341\321\241\232\262\215\301\272N\030\241B\224\037\266\322\356\\\310wW\004\244\016\253\220\202RS\326\bWQ\366\277?5}\310K\234\006\234vK/\\\254\207\210\"\204\355\333\001[\204\213&\003\201\263\271hZ\007\013`\254\262Q\330,\034\t\030\346\3020\327&c\321\\\230\266]\025\003\316*\\\264\213\223e\33259\\EYI\033\253\f\032\202\222L\2653\013\371\316"
+	.string	"Lh\254D\032\023"
+	.ascii	"<\213Q\263bh\r6\005\272!z/0X\007\210\202a\256k1\232\3513\264"
+	.ascii	"\236S\316\354\f`3y\247\331\340\332\213)\016M\215{W\031\003"
+	.text
+	.section	.gnu.lto_taskUpdateBaro.part.0.188.96e4a9e79f34a3db,"e",@progbits
+	.string	"(\265/\375`(\001\245\r"
+	.string	"\206\030ZE\020\217(\035\020\304\237\350+\201\024"
+	.string	"\375\360v|:\265P\030"
+	.string	"m\f\3419\016Z\027qN5\017\374\243~\353\326A;\007\022[\276\"\331\016\200)\200Z\035\024"
+	.string	"\001\306\002\270d\024z \213\224 \262\267\334)\005D"
+	.string	"E"
+	.string	"D"
+	.string	"&\213l\025\017S\026\343\224\302B\312\305\356f\237\212r\321\245\306)\362\217z\306\007\216.\343\007b\270J\002,\023-6\300\222\3640\361\360]\365X\002\222b\344\370\304H\260\273\3062\334\327m3\260\255\300\376\205-)\2205\245pA\223\235\002a#\023V\202\244\305:\200]\345\276J\310G9\263\022z8\242\331P\340\3231\332\017q\021\242\207#\316\330\355@\342e74\360\351\001\330\247\346\036\327\247|\307\365\231\371<\b\333\241+\022\035Y\377\224\026\353E\365d\033t]\005hX\301\202\242\024[\276\242\035\"\022\377]\257\372QJX\254H:\212z\262N\271zr\377\342@"
+	.string	"\263k\022\003\263\034\346\211\017o\371W\036\355\373#\316\342\253\002\033\307\221"
+	.string	"a\263-\020\331\270\214\307\301\326\3414\370p\233\347\205h"
+	.string	"\254}x\"x6\237\007\032H\246\201d\034g\323\3114\317\223}\004p7a\363\262O\327yY\274\\=A\035s\211YUP\222\324\210\327\216w.\273\243\020\377y\303\345E\036"
+	.ascii	"C\013b\271\001\0171\256\013t\213\364\336\204\306>@\024\fs]\323"
+	.ascii	"X\326\326\224%`\b\220\017d\034\005\202\254&&\303\360\026\215"
+	.ascii	"RX\027\210\202`\356\031\272\250s:-\264\231\262\323@p\355\305"
+	.ascii	"\024\207\246\306\275\253\214\001"
+	.text
+	.section	.gnu.lto_taskUpdateCompass.part.0.189.96e4a9e79f34a3db,"e",@progbits
+	.string	"(\265/\375`\373"
+	.string	"\255\f"
+	.string	"f\227TB Q\224\016$\264\023\377\210\t\nM`\031,\"\362>\266\002\306\240M\254u@\017\311\201\372\216GH6\365hv\034F\202\236#Ib\220\022P\027\2144\252\371\205\205K\354\344\035\360\255\355\357\275wJ\001>"
+	.string	"@"
+	.string	"D"
+	.string	"\006.`r\031\037`ri\277\204m\316\303\235=\343\025\265\224SI\206\221\325\356\316K\b\342\335\341\213\235\177\221[J\246\216\303\213i\303\037\346\221\262`w]\341p\313\333V`\273\201\375\b\001\376\310S\214,\032PQ\037!\0221JV\273u^\272V\356\321Q\330R\203\206u_\204\263-\353\322\366{\257\334S\244X\327\344\341\367\354\233\370\211\356)\222-\273\037`\264\330\255\t.}\240r\031g\221}\305I4?\304\245)\210\336K\227\227[\006\264i\350\275d\016\222\224\n\003\354x\360d\030\343B\020\373\365\177\304hBv5\334\260\261\036\244\213\021*8\213\342v\250\250\017\215\bU\310j/T\004\266\003\226\220\241t\363\311\264k\322M\243\036\214\026\240\017\260\254\343"
+	.string	"\344\301\266-t\001\360\225\241\023\350\006\004\341\342\314\2133=\235M6\257\215\316\f\001k\037l\233 M\333\246\365\270\020\304\f^\250*@\013\020\236l_\236\003\032"
+	.ascii	"\265\324\340\335b\274\255\300x0E\240\304h4\r\023\026 \n\206\271"
+	.ascii	"\256\rY&\2002\341\236\255\200\b\032\001\230\026g`q\316p(g\237"
+	.ascii	"\331\271\300\246\363\316e\201\223\027\363NK\323O(c"
+	.text
+	.section	.gnu.lto_taskHandleSerial.part.0.190.96e4a9e79f34a3db,"e",@progbits
+	.string	"(\265/\375`\034\001E\r"
+	.string	"\026YYC"
+	.string	"\2216\035\320\204\032\213"
+	.string	"\024 \374\360y<"
+	.string	"u\213\277>\331\237\bO\\\033.\330\026\242\2405\315\002\366 A\016\343a\3115J\375o8`\263\"xYbRL^\335\272\032\223\277c[\262\267\224)\005B"
+	.string	"J"
+	.string	"A"
+	.string	".v?\005\217>P=Z\037@=\302\013\240\0369\2177a;\244b\317\236\361\317e7 d\220L4\273{=j\210{\327\204\236/\272\002\300\220\341\331q\270\001\331]W\032\356x\333\013l;\260\277!0}\252\303"
+	.string	"\214\335\224S\215\365\020_\214x\314\377\362\264o\037E\310_q\22391\356|\204\016cb\025\273\363\341\035\306\304\022}\233\322\351\020\343\004\r\203\352\361%\364\357\304\342\220\340\321\231\366S\\\205\367\357\304\033\273\037f\002;zI\325\026\371\344K\266.\250\310\251\212\300e\206T\363\027\240\256\251N\322\nJ\236\354\263x\013\220/\302\025\270|\351\321\347\250\307\353M\207%H\324\320X\031\345)\265\305\n\017WY\354\230V\230\316X\2075 \341\036h\035VB\001\263\240qp\021\264\217\007B7\242m[I\026\300\231\007'\302a\235\204,\344\312B\256\021\017\366\271\262\215\273<\b\030D\242mW\007\002m\027\307v^Y\f2R\024\325\026\333\034y\231L\273\314\004O\265\001\033"
+	.string	"8g\340W\357\201$Z\306a\025\272\262\n\020\020\005\303\\\341hc\305\346*\244\316\023\257\f"
+	.string	"-\f\365\224\302b@\036\b\341\236Q\212:\247\323B\233);\r"
+	.ascii	"\327\036p\243E\364\273\312\030"
+	.text
+	.section	.gnu.lto_.symbol_nodes.96e4a9e79f34a3db,"e",@progbits
+	.string	"(\265/\375`\020\b\025\027"
+	.string	"Vb}H\240\232M:\220\326x2\2742\216\274\026\360\320\245\260"
+	.string	"\240\345\361z\031\374\277\b\200\327k\b\221%#$\350.\307\313\361r\234\254\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\346\035`\256\257\027\246\357\325A#1\242\001\016lO\337\036!\177\223$\003d"
+	.string	"f"
+	.string	"i"
+	.string	"\256\337x[q\345\325]\2371\361\256b\242\273\313\320-C\200\245\200B\267W\320]>\270\271"
+	.string	"\3353\034\334[\276\0067\215J\222\225\213\301\335e3\327\202\357\032\005\306\002\376\334d\0027\001\021\3345\016\3346\302J\222\274-\003\367\r\0028\353"
+	.ascii	"w\367#y]\273\337\375\222\262M\255\265\026\270\241\276\335\r@"
+	.ascii	"\013w\026\327\021\267\217*\342\326RC\334X\025\304\315\244~\270"
+	.ascii	"\227T\017\367\216\332\341\346Q9\334R\3360\323\260b2\354\027\206"
+	.ascii	"%\003^X0\320\302mV\270\257\232n%\024n\253\tw\225\204\233*\302"
+	.ascii	"=\305t'\261\356F\342\335u\t\265d\034J>\222d#H.rd!`\316?@\243"
+	.ascii	";\352\253]E\3371\b\0178I4%\0325)\233Q\034\322,'\243\273#\031"
+	.ascii	"\305\031\001\240>\207B\3522\244\273\260(\244;[\314jl\214\220"
+	.ascii	"M\020\245\270\217\372\\js\251K\033K,\f\fh\351\356\356\361t\023"
+	.ascii	"q\272\203\304\270s\300\270\247\274\270\251\270\270\265Z\334@"
+	.ascii	"X\334QV\334PT\334OR\334Y(n''\356!&\356\255\022\367\025\022\001"
+	.ascii	"\373t\372'+\354J7\322\247\322Ci\250\244t#u*{>\246O9\300\354\365"
+	.ascii	"\234=e\217\307\344)w\316\334HwL\361\034\251x\212\267\323k\306"
+	.ascii	"k\013"
+	.string	"+7R\233Y3g\246n\244\262\262ws\336\224a/4{\013f\2446u#m\n3\356\227\235\257\214\0324U:\242V\324\324\231\365\".O'\347vc\312\251\331lK5]\215:\321p\210\002\200\221\250Q$L\321Nj\244=\003 \003\221\241m\016\021P\030\2129\345H@a\305L=j\252LE\240\324\343\00621\260FB=Av\002\034\257\033\036\202\212WzS\344\243\032\256\2327%\033\367\361\260\031\377\304\371\250,\022\365\240\357N\377\371\201\235\253\307\273IGZn\310]Y\235\t\336C\223$\345+o':d\341\303\0028\300D\213^!R~(y\262d\264\307\242\336\211*\371e)\306\270\362}\272\267\314y\356\216\361\316\372=> \370\314\307\364\232|\346\307\364N>\234Q\354\017\256\0029\253;!\230\236\357\256\201\351\371$\317U\350\324\202\317\017\243\305\271\"\356\360#h\337_M\""
+	.string	"\344\367\034\n\246P\230\260\313#\bF\353\r2-0\345`\347\r\246\036<\242B`\315+"
+	.ascii	"\216 \f\013\235)|FV]\005"
+	.text
+	.section	.gnu.lto_.refs.96e4a9e79f34a3db,"e",@progbits
+	.string	"(\265/\375 \212}\003"
+	.string	"\"\b\031!\200\305i\f30\003{\212\242(\212\242\344f\300?\372\t\366\373q\321\377>4\255-6\332$\311\024\376\262\272\2623\341\302\207)\373d\311\221\331\315\220\037\257\247\035K\220\0064tj*5\215\232\262\246\017C\007\221\252\205\212\305N\225X\005\215X\274g\3039\243s\236\340u\036\270\346<Fu\336\351\251"
+	.string	"\001\002"
+	.ascii	"O\005\322\tT\031"
+	.text
+	.section	.gnu.lto_.decls.96e4a9e79f34a3db,"e",@progbits
+	.ascii	"(\265/\375`\rX\215~"
+	.string	"\001\352\202R\215V \fa:\215\001\300?m\034\321\211\007\316\325u\004\025\357\343\235\350;\373\262\030\333\033\f\315\3279\373\225\356pD\302\035W\315d\327CM(\326\262\267o\345\301\317\276\332\320HM\\\340\304\361\r~,\304B\275\255\360\362\255n@\216`\352\362\217!\367\336RJ\231\002\330\007\321\b2\tG$\021)7_\357\273;&\222!F\246\354\374\336\261\302\326\246u\363\235s\353\374\347\321UZSb\324\241\363S\306\315\030\2653\306\362\213\351K\017\273+\305'\016\306\226\273\371&{\330\274\t\263v\366\237\247\334\252k\203\345\346\237I\3753M\234+gNs\235\321\301\266\026g\016.m\253\201\363;w93N\211\213\035\225+\327\246\216U\226#7\377T\242o\217\327\315o\233k\005\f\252\n\233\3376\177\007 X\343\317\346\360c\327\346F\343\346\323\335\270\377<@h\236`\321r\363\177\343\326"
+	.ascii	"I\225\331Zk\256\032\236:5v\232\334\374\223K\377\374\241\317h"
+	.ascii	"Qbr\343\346\2378\364=\200\273d\367\314\276]5@L\f\271\267\261"
+	.ascii	"\3145c\217\027\356J\271Uc\3274\301]\264\373f\337\2560\354&9,"
+	.ascii	"E\037|\276\270X\0333\363\333]"
+	.string	"\273n?\324\272\306\\2\366x\337\376v\323\356\321\276\245M@\311\025d\226\001\266u\306\314mW\214=^\267\033\206\313\005\303\201\351i\002r\234\270]-w\013\007\246\247\t\260MAj-C\330\204\230\371\347\024\230/\027\240\260|\245\351r\275\364\324\270zc\273\371\347\222\356r;\205\304E\230\233o\316\321\267\307\273\271l\227\313D\332\254\234\334|S\216\276\351F\337\\\243\357\301\361\252]+\366-\215D[\025,7\213=\336\343\275\322\001\b\367x\247\3343 %\343\216\341\003u\254{\002t\344\253\211\0233\337\214\242\363\222&41\267\312\245\262/\\\220\333\261\005\354\346\233L\364M/}s\210\276\371C\337\334\241oV\351[v\243\330#\006\327\314\030t\341\016\223;tn\276\t\245o10\355\235\305\300\274\251\244_\332\321w\354:\261\307\002\334'\306\240K\304\316\224(7\277\224\243o\013`\342\273;["
+	.string	"\363\245\033\260ku\231\330S\006\033\331\332\315W\311]b\217\033n\330\313%\3436\316\005a\252\272\371\345\031}\202\275\355\006\323\336\335\331\r\346K7m\016\231?Z\"\363e\026\375\022M_#\033\202z"
+	.string	"Y:s\363\313%z\351Bac\027\tLS\310!\227\353\022\261\307[\344E.\214\233%\202\023\225\005\230\244\220E\256\220\267q`z\332K,p\200$\031w\225\334{\177\330\360\341C\226\022\344\013\017\235\237\353\350_\253\253\r\366-\b\004\274\250\230\355`\202\274Yw\205[\203\003\323\223\t^\252 -\033\216o\001\342\331[+\255kL\207\030RJ\016\017\366-\215\304q\314\203\233u\261\276\005\250\t\303n2\022\206\334{[\266\337\246]\0337\353\336\330"
+	.ascii	"\264d\334T\246\220 h\274\222\367\307\rrY\270>\356\326\355q\201"
+	.ascii	"\\-{\274Y\227\307\213>\024\225R\316\222t2\344\347%\372\271K?"
+	.ascii	"\007\321\317Y\372\331\206~\246\322\317O\372\370\216\306`\211"
+	.ascii	"L\016,\221I\243\350*\275)\023\343\346c7\372\377\255\2722\354"
+	.ascii	"\361\316\270RE\306\275\253D\335\030@JB{\367p\323\265\267\361"
+	.ascii	"v\3547\232q\251n\f\373ve\3342\254\225\\\030.\311\275\215E\037"
+	.ascii	">\340+l\344\234\231\371\270\210\376o\214;u\307\311\216;7\377"
+	.ascii	"\267\307;u\245\214\273\b\350\311\221\250\0367\037\323\320\307"
+	.ascii	"R\372\330I\377\336\351\3776\375B\375\366\356\356\373\024\202"
+	.ascii	"r\nT\230\0277_\247\373\342\367\351\272x\007 \034+\225\355\261"
+	.ascii	"\275\367}\372 k\357\245\373\024Tg\357\245 k5\260V\203,\266uD"
+	.ascii	"\315\314\277v\3722\031\3756\271\b\022%\343\346\002\330!\3637"
+	.ascii	"\216\376\225\323\327h\211L\017v\310\344\300\016\231tl\035\013"
+	.ascii	"Wg\0075\206\316\345\242\223EA3v\240=\335\374K\246\357A\033\373"
+	.ascii	"\006\223Qi5 8\220{\033\377[:\333\202=\332:\213|6\356[\263:\013"
+	.ascii	"\307\312\001j2\356*  9d\270]PK\322\2612\363\234\215\023\264\002"
+	.ascii	"\327\013\"7\3772\315%\365-\234\225\2732\316\206@\335|\333\305"
+	.ascii	"\272y.\313\272\200\227\254\304`\271\371\366\250o\235\350\277"
+	.ascii	"\331!\323\032-\221Yd\207\314#\231hm\264D\246}\262C\346\255\017"
+	.ascii	"]\306\222\3719\326q\262\272\331\272\3311\366\370-\366m\007Y!"
+	.ascii	"]\224\204\334|\273C\263\330{o\373-\346\371-\346\355\fm\267\035"
+	.ascii	"2\337B[\252/]|\302\260a\203\344\346[\263\337\310v\261hV\315\276"
+	.ascii	"\245e%c\220{\357\377\326\213\345b\217\266\213\325r\313f\267<"
+	.ascii	"\033\357\301ot\333\305V\261k\034\240\366\326\302\252\200l\214"
+	.ascii	"\323\226\344\336\306\017E\037\360\023\231(H\314l\267%21\330!"
+	.ascii	"\363\025\320\326\212\275b\217\036l\226[*\326\354<M\306m\266\267"
+	.ascii	"1\210\007M\234\035i7\177\004}\213\345\031hm\020\336A\337z0\203"
+	.ascii	"\356\356\356\356\254\007\363B:\333)\267j\277=\263R\216\345f\355"
+	.ascii	"\335\264\367\256\340\216\201\203\225\274\331\246\031\335N\031"
+	.ascii	"2\251\256\214;m\357\035\204\217\\\234\352\334|\355\220y\255\377"
+	.ascii	"f\211\314\037;dv\260D\346o\243x\2700\007\rS\330\315\277-\263"
+	.ascii	"\306\263\t\227\255\264\233\255\361Z(\226\354\326h\237\274\003"
+	.ascii	"\020\376\323\264\307\3666Zc\336{\311Z\r\200\254\325\240\334\302"
+	.ascii	"\265\024\305\314\277\372\267N~\333\304\216a\200\237\242\262v"
+	.ascii	"\332\336F\241 \243\225T\217\233o\264D\246\266C\346\217e\340\027"
+	.ascii	"mG\360\324\177\016\227\215\353\307M\377\365\205\301`\216[\230"
+	.ascii	"\005\333\217\265P\311\261\002o`\013\255\n\017\203Q\240~,t\256"
+	.ascii	"\3758\313\177\215\307\037c\371\261\005\370\312\217\255\374\227"
+	.ascii	"\215\212\332\217\247\240\375X\n.\3731\331\217\007\200\237\374"
+	.ascii	"\330\tn\362c1\034\366\343%\030\354\307_^?F\202\365\217\361\217"
+	.ascii	"\363\217\315\037\367\374\030\303\217\273~|$\371_$W\300on\360"
+	.ascii	"_\013\376"
+	.string	"\033\347\277@0\327\2177\260e\337\374\226\316\262\261qp\221\337^\301D~;\344\277;\360\220\037\347\020\362c\023\374\367\027\344\377\226\377\346\300@l\224\225\262m\277]\373O\200\377'\376\027\340?\224\207\360\227I~\033e\245^\376e\217\003J\200\377-r\353\302F\360\337\"u6\312JEy\361\337\"uh1\376[\005\377\240b\343\277E\352\336\363\227,\204\340\177\026\037\275\373\344\026\271u \034\303_\266H\341\304\221\373\374\245\007\376\273\005\367\370m\224\225\372-\t\273\364\237\303\177A\370\317_\n\371\361\006\266\274\374\374K$?V\361c-\026\376\013\302y\376R\351\307Y?\306\372\261\216\037\333\370q\215\037\317\370\261\213\037\237\340\307-~\274\342\307\353\217\211?\036\3768\370\343\337\217\323\037\367~\214\376\370\003?\366\300\2179\360\343\f\374\370\304\217S\370q\211\037\243\360c\023~L\201\037;\340\307\035\374\230"
+	.ascii	"?\036\300\217\003\360\343\016?\316\340\307\026\374\270\350\307"
+	.ascii	"\024\374X\303\2173\374\327\314\177\313\374\367\355\277n\377m"
+	.ascii	"\373/\230\377z\371/\333\177\271\374\367\370\337,\377\245\362"
+	.ascii	"_+\377E\373o\332\177\243\374\327\354\277\306\377>\371\357\330"
+	.ascii	"\177\305\376\033\366"
+	.ascii	"_%\377E\362\337#\377\345\372/\220\377\372\370o\217\377n\375W"
+	.ascii	"\353\277Y\377\345\361\337\035\377\315\361\037\312\177o\374\267"
+	.ascii	"\306\177i\374\227\002\3775\301\177K\360\337\337\177}\377\375"
+	.ascii	"\300\177\223\376\233\342\177\226\377*\340\277 \374\327\203\337"
+	.ascii	"\266\360\333\272\337j\371m\226\337r\375\266\310\177"
+	.string	"/\377\313\376\223\375\037\373\237\376\017\363_\303\335\335\335\335ov\375C3\376\007\210\005OfZU\333Lkc\330MKTPM\233Jh\233i\301\331fYU\030\236\314\262\252\236\314\264\334\354\021\030t\250j\320\215\021\211\263H\236\232\366\224\224\216%*\foO\306\254\255fo\233\346\264\251\366\333\336\001\330[G\026\225\232%\033\366\310\3646\305Te)\313\032\367\336\033\244\230\266\262v\323\233\222\335oO`Y{\2031%m\251\275\367\376@\311\370\266\205\3307\245\036:v\224\323\336\026l\343\336R{+\331\375\266\367V\332{\237T:\214{\343\300\360\324%%\265\367U\221\324\326\241\224\305i\357\233\026w\254z2\333\3122\312\"\305\254k\2770*\331\247\250\254\335\265\325hQi3%\262\035\265\367\266qtW\325\214\271\233K e\013e\262(\271\371\025<i\343\330\336F SI\221\027Yn\326K\220"
+	.ascii	"\241s\263Q\rG\033\220\233K-\257&[\315\315\247 i\3649bM\241qs"
+	.ascii	"\311\303Z\271i\331\335|\n\326\350r\007\317\02340Un>\005p\272"
+	.ascii	"\314\001\324#J\016\313\315\247\240M\3776\312\033\026\203\221"
+	.ascii	"\251M\025\344\336W\036.@\271\201aV^\275\274\021T\307\316\314"
+	.ascii	"\322\315\247\263L\354\244q\272\371\024\250\225V%\r\035u6\236"
+	.ascii	"\357\236\357J\032\266l\3078\205x\305aK\356}\345\001\007\361*"
+	.ascii	"\213\243zI\243\234\001\324U&\n\355\346R\006\220\025\027o\346"
+	.ascii	"\334|\n~"
+	.string	"\224Ue\214r\352\b\022+S7\227P\345\024\317\321\216\333\220))&a\344\350\2709J\004[l\304\334|\np\350\025J\030Z\206\231\375t\363)\230\322\247+\237N.m\270Dyz\361\343\307\224\264\233K\247);N]n>\221\235\276=\226.\232N\300:\306)\231^6\3455.\240f\334|\272r\tM\034\235\267r\251Tra\007\306\254T*\367\017\226\017\034in>\221\033}\242/\372\317vn\217\331N\246\003\2014\275\233\220l0prb\347\346\023\231\351?\327\311tp\230\311\321\302\315v\027\266\f\251Cr\363\211\300\364=\240\313p\302t\341%rYj\f2\323\3458\231\212}\013\222\353\324d\272\374\306\r\331BN\346\272,'\317\261\307L\227\347\2322]FZ;>+\254\305\265\255\251\331\021\367\223O4\245\257\341\216\276\0069}\rf\3645t\321\327\240\226\333\25007\004\314\315\327"
+	.string	"Eg69\216\212\023,v\326\334\374g5\267\307\254&\243\261JTvo,Q\256\220{_\035\340lk\263\315\334|\r=\364\237\323d4W,<ar\363\231\021L\031\273\273\371\032\246\3641\273a\343Q_\331\2222\223\311\3442yL~\263\307\f\227\261\300\345*[p\231I\246\202\215G\024\340\242\220p\371J\024(\270l\305\332\301dT\232\n\023\f\344\336\306\0374sb\254\371\311b6\374\204A\243\266o\376\220\235\016\223\301\330cn\313Z\306\362\027\373\026\204\204]\035d[\026\313k@\345\336Zt\272\366\336\033>|\350\231\033\202\303\314^\212."
+	.ascii	"\311J\302\343\346\017\225\321\2776\234\274\351\222\267\330c\346"
+	.ascii	"\222\331\314\270p\221\031\222L\3429fb\220f\376\320\025\375!1"
+	.ascii	"\375\347,\317kLl\326\256\300g\306\333\232\0337w`\364\234\305"
+	.ascii	"\fcca\316\315\037\002\242?T\245?\344\244\237\241\216~\2067Z\315"
+	.ascii	"4r\306n\313\315\317\360E\217e)\366-H\276s\0059%\243\331cN\313"
+	.ascii	"MrZ\026\273b@\345\336KV\272|x\364\250\2022\363\031N~9R\271\371"
+	.ascii	"\031\240\350_\033N\322\272\214\227\tP\271w\326\224\256\034%\233"
+	.ascii	"e2{\314e\031\312o.\313O.\023 s_2\212>\224u\3109pt~\206\035\372"
+	.ascii	"\031\224\364\205\352\350\013\325\351\013\275\321\027\372\242"
+	.ascii	"/\264E_\310\212\316K\202\272\320\3618\336|!\262\234\344g\311"
+	.ascii	"\352\n\231\233/\024\246\377\ffee\245t\363\355\030\323\205\002"
+	.ascii	"\264\204a7\271\210\352\222\222\215d*\273\206\311\2504Z\024:3"
+	.ascii	"\2221\352typ\347FW\306\312Cr\220\254#\003\311G\262\220\254\225"
+	.ascii	"\263r\221\374\225\2712\216\274#\023\311=\262\217\314#we\257\274"
+	.ascii	"\225\177d$9Gf\301\036\263\221l\343\371*\337\310M.V@Z\266\274"
+	.ascii	"$\225\241\236\220vXH|wEg\007\322\316\031\0342\346t\255p\247\313"
+	.ascii	"\262\301\270\353\302I~\243\252{f\207\277\374\226-\357\030]{\033"
+	.ascii	"\263\221\\#[ac\027\317\213-9\313\226\225\246\330\246\262\224"
+	.ascii	"\235\256\275\215x\316\031\036\371\305\223\017(\344\375\312Fp"
+	.ascii	"\235\263\034H\032o\272\254~\313\226\215d\247,ZD\256\212r\227"
+	.ascii	"\"`i\037\344\373f\211L\004\b\335\310V!\330;\355\353nj\356\346"
+	.ascii	"\013\315\320\027R\322\3070\247\217!\215>\206.\372\030\254\350"
+	.ascii	"cH\242\217\201F\216\312Vb|\030\271\371\030\242\364\203\342\350"
+	.ascii	"\007\221\321\017:\323\017\n\323\036\270\364\203X\320\"X\"\363"
+	.ascii	"A9\364\203d\350\007A\351\003\315\321\007\"\243\0174E\037H\211"
+	.ascii	">\320\016}\240*} \027\372\027\350\222bZxC\246J\216\351\346\343"
+	.ascii	"/`\210T\201\200\346\t\322\354\r\227QK\343\244\353\f\22478\314"
+	.ascii	"\205rN!#\347\226\354\342\305\032\355\333U\003\274\300 \345\260"
+	.ascii	"\033\214\304u\030\016n\203\345`6x\016\323\3418\366\210\337`5"
+	.ascii	"\307kp\034\b[\356\031\020\336\033\253\255\213\013\021$rn\311"
+	.ascii	"7\270\r\217\261oi$\344X\201\373\215\336`3\367\354\024\242$\347"
+	.ascii	"\366\301\224\363\202\205\026\212\262\315\262D\246\006;d\376\002"
+	.ascii	"\232\376\0050\375\013,\350_\200\241\377\203\324E\226\310\324"
+	.ascii	"\202\311\\x\263\261F\355\346\377\204\321\377I\303nRr|(\271\371"
+	.ascii	"?_Z\314O\226\376\017\225\376\317\222>\322\215~\322\022"
+	.string	"\231\3679\352\373\220\351\037\263i)\243\200\021[\272\031kY;Z\231\331Ar\363\021{a5LF\205\002\223\334\025\214\005g\261G|\304T\216\253`+MG\334\365\006i\343\267qG|$\211\374\320\023\007g\367Cg3\313\022\2317c\207\314\373x\351\037\203\3318\214\004O\271\033\370\260\323\302\315i\346\027*d\232\233\357\303\343\f\233\3412L\206\245\340(\366\210\3210\224l\206\321\260\030v\202\311\2504\026&7\234\304\030\327\245\344\236ac\327\211\266\265\306\b\r?\271P\260\361\250_D\021\203\304K\302\356\031\220\022\206\315\004\247\006\r3\271g\0374\201#\206\025\204\246\205\264/@\371=o\364{\332\364{\260\3401k\206&\204\316\315\357\t\323\270\311}|\034\323\226n~\017\227~O\016\375\036(\375\2649}/\226\310\304_F\307`\031X\331\222\345\346\023\2156\267%2\317s\324\347\201\242\177l\244"
+	.ascii	"MZ\250\214\335,\204\307\216\f8_7\203\301Bl\030k4\271\224\206"
+	.ascii	"$\223mB,\234]\263oi$\306\334\220R~\333\206\205X1\266\214\030"
+	.ascii	".\202\207`\"8\210=b!\330\307\361\017\f\344EX\210E\203{(\235T"
+	.ascii	"\262"
+	.ascii	"\fI&\367\336\013\210S\347KO\356\331\226\310\264Yv\310<\217\225"
+	.ascii	"\306[\"h\252\253\273\371<R:M\035\266\232\321a\211\022\020\254"
+	.ascii	"$\276q\215\027\215\bNT\024\330\302B\"/]\024\035H\356\223}\273"
+	.ascii	"\332Jp<$\251\002\202\005B\007 \340\033\267\313\032\261\261\353"
+	.ascii	"\224\2625\004\271\2671\316\262\261s0\031\025\317T\224#q\370\206"
+	.ascii	"\265\263v\354[\332^\222\301A\0222\327\353\277_\370\306Mr\305"
+	.ascii	"\260\361(\201\255 H|\343\246\271o\266<|e\001\202\225\304Zx\007"
+	.ascii	"\326\201\2570\026\346\201s`\033\230\005\214\003g\331#\276q\325"
+	.ascii	"\334\232\261g\354\035|\343*\335#\034\230\236\366\226\361A\022"
+	.ascii	"2 X\311\373u|\3436\271P\354[\220\275\244$\302\027\034 X\037>"
+	.ascii	"\234J\244\320\211R\224k\030\301\3422\273\371\232M\377\3072p\025"
+	.ascii	"\236a\217\230\006^\341\246\3010\246\316\212\340(L%\202\023\025"
+	.ascii	"\017\2143F\220\230\306m\001+\001\235\341\222\341\366\341\274"
+	.ascii	"\023\323t\2453\216\241F\310\335\315\327R\360\024\226\312Sn\004"
+	.ascii	"\331:\335\261TY\006\314\210\332\315\327O\3645\021\fer\375\220"
+	.ascii	"2Z\341'\374\002\306\222\0221\354t\374\242\347\310\035'i7c\027"
+	.ascii	"\267\216\324\nh\310n\306M@f\252v\330\335\214\2270S\r\266\027"
+	.ascii	"ln"
+	.string	"\3761\323\231\230(\246;\274\357\370\004g?n\266T\214~:\311=\352bx\2155)\311\236\352\324\304~6\371O%x\311\317\220\0323\306\334l\233\030\375\024\013\202\303Bg\204I\230\217\013\2526\027K~\206\375f\221\353e\336\035\221\023u\363\251\304\350\347\022\237&\032jFn\3469\223\200\361\252\220\234\271\371\004{\002\262\303\265\302\230\257\323\213,\306\f\260{z=u\020%\004\b\222\263K[\271 \273q\344g\327}\272\240\303\253\207\217\233M!F?\217\2247\302\260@\304H\020\022mT\252p\225[u\254\274\271;\213\224YYeu\\\020)\261\354\320\210H\235CN\035`q\216\314\021b\336\371\271\252\322#L\220R\007\006\322\234p\001b\345\007\0315Y>\242|\224\\\316\036\346\227\021\346\242|l=\273\321\231\231\002F\313l\263D\356l\311\315g\326\231\205\245\302Da\263\246\221a\250\354\233O"
+	.string	"8'\326\211e~\261@\264\324Q=u\251\331\270\371\004\030s\3368o\234:\342\260Y\263o\276\354\276\2349~\352\350Is\306H\332\315'\216\354\346\216\013*\207\361?\317\017\f\031Z\260\2166l\230_\212\262\224\350L\254\2509\267\344\265q\267d\rJ\215\032X\252(\013\247a\372\341\265\0056'\354\346\023"
+	.string	"\354\305\213s\206-\3331\314\256\25097\240+2\202\200\2352~\316(\225xi\301\352\346s\352\254\342R\362Br\363I\345ca\211\231\233\277\301\335\031\343\\\341\224\372\317\343\243\243\n\233\0347\237QE\234\230\272\334\374\r\324\350\323\2350\376\363\224N\\G\266\334|B\335\020\"\344\353\346o\240E\337\036\317\247\362\306N\003\226,;\367\367\351\242(\013\273\231\213k\313ts\246T\235M?]\\7%4.7\237Lvm\n\212\013\261\233Ow.1\221\243\022r\363\177.\235J\3107N\214\247Rnr\312x\353\362\002\214\016\035\363\316\02786k\311S\rI\266e\332\271y\307<C\202\203\355f\263Nv\343f\r\221\r|$\223\346\234\242,%8\006\250\213Bs'\351\206\266\243m\216]\303qK\336\216\334\374\rp\324\325\225\\Eu\242\304\344\370\360"
+	.string	"+\033\300\235\0349\346\027[\266c\020%\243\320\334I\362T\201\023\"\346\346\017@\313\334\034\226\232\302N\232\272\f"
+	.string	"\n\022Yr\025e)\325\231XQe\354\316:0\354\334\334\374\001D\311\311\325\211\202\362$ya\214\f,U7_"
+	.string	"i\236\306lc\313v\f\017\310\fI\206\371\370\250qd3\331\334l\363\242\216\352\212\031\267t6\205\214[c\002\332\2278b~\242\330\224\2613\325d-\033p\222\031mN7_"
+	.string	"b\316\234)\271\334\272L+\257\262*Z\340\340\260T\034 uI6+t\344n\276"
+	.string	"\214c\306\230d\234,\335\035\223bPhx\230o7\311\\\240;{{\022&F\f\226\262\212\022\223s.\031c\213\273\371\002x\021&L\311EEF\034\266\244\217\231!i/\324x\361b~)\322\333\211\217+d\032\027\013Zn6\277\360 \371\332\212:r\341\322\343\025E\344\270\001\033g\310\302\330\330\354\272\254\217\250$Nn~"
+	.string	"\264\326\326\260\324q\323\306\272\353:\315\256\304T\335\374"
+	.string	"L\035\217X\252\b\211\222\234[P\223\2456\0327_\003;\375\233W\216\346\025\273\246\241\366\326\302\321\303\026edN\210\353m\311\315\327`\212\376\315*f\025k\204\300\325V\242;\345D\0219&7\225\227\003\030\035\251\236n\276\006:\240@1\325 pe\334240\343\316.lJ\022\251\2556\245\347\205\024\r%7\247a4.^tn\276\006U\372\030.\312\033\323\3144\33639\323\314$["
+	.string	"\230( mI\023\315\224b\236\331\243if\226e\344\024\0249:\277\203\034\375\016k\364;\244\321\357pF\277\203\233\376M\260\243\tf:\301\340D\3053uF\f\271\251\274\034\200g\216\206U\322tb\216Q\311\301\225\271\271\211\261\tH\235\262 7\277\003\025}\017L&&\0213\f\033\273$\260eG\314\036M&f\222\037\272\035J9\226\334\f;\343\331\261\243\f\323\315\246\022\243\233K\324Te\251qsi\207\314w\b\323\357\300\245\1773\310\355\321\fbz\331\335U\2013M\220\233\352\352"
+	.string	"@s\256<u\335\214$I[\027\267\233\337\301\206\376o\036\261G\263\313\034rk\334\273\311\3542\211\230F\354\333\325\336U\037d\231qg\227\334{\027}\370a\003\305D-\347\337\344\272i\3447\205\340$M%\346x\215\335l\0261\272\311\365DG\354\346\236\026\364\001@F\373\330!\363"
+	.string	"\320\362\343\007\0359a\345\222(JMn>"
+	.string	"\210\364\350q\001-vma{_y"
+	.ascii	"\202\001g\346u\363\001\020\245\245UrY\fF&8\254.\2367&03n~\006"
+	.ascii	"sYYo\252\344\334\314\035N[\356n~\006bt\3500\261,Z\234:*}w\345"
+	.ascii	"\n\223\271\343&\026\034\0244jn>\035\217\351\026\243\216\335\315"
+	.ascii	"\317\240\013\007\216R\211-\33314|\321\"r\2254\257\340\312\340"
+	.ascii	"\270\371\031h]]\031\301\315y\371l\037wjZ\260\262*\271\212\262"
+	.ascii	"\260\233- uaK_VMn>\006i\264I\303\244Qr\025\211\231\301f\255\207"
+	.ascii	"\213\r\031\246\233\217A\233\276ebK4\366X\2421e\360<\355]e\200"
+	.ascii	"-e\356\200%7\325\325\001~\216\204\241S\213\273)\343/\323\224"
+	.ascii	"j\314\252\237\0363\2474In6\251\346\374p\273r\3631\320\242o\307"
+	.ascii	"\340\024\221\322f\254\353\216\\Vr\244ko\243\275S\276\331\002"
+	.ascii	"g\347\213\315Z\362~\231K\345\334\031\221\373e.\225qJ9s\b\330"
+	.ascii	"\302\304f-\271\267\231]YG\313\203\226(l\326\222\311r\216\bNT"
+	.ascii	"<Ngv \357\270\311J0\031\225F;k2f.\225ue\013\"8Q\361\274p\201"
+	.ascii	"\205\244\313a>xt\335\257\022\231\303|p!M%s\312t2\245\314(\223"
+	.ascii	"\311\214a\3020\241\314&\323\205\371\302|2W\260Gs\351/"
+	.string	"\357\224w%\033s\311\334YI\225\b]\264\260Y\263\\b\270\315\311 \037\003,\235\215\226\310|\232\0352\217A\215:t\202\232\320\370Qd\007\361d\241\223\244\306\315\307"
+	.string	"j\216\022K\206\013\232\323\315\347p\247\377\262\205\227\\w\346\316\262\334|\016u\372\034\324\030\307b\304 \222u\3639|\321\3470E\237C\023}\016@\3649\\\351s\200\322\277`N\377\0022\372F;d\226k\214^\306\001U19S\273Y\310\016\231\317\262-\221\331s\301\027\375\227fn\217\245\2312\b\002\266h\021\271\342R\002uw\363/\230\242\377\262LY\246\334\002Z\001\216\234\033\222mI\316\315\277"
+	.string	"L\377\345\333\355\261|+\263 \220\226\265e4"
+	.string	"\n\0221\254\236$B\222<n\376\005Y\372/\335n\217\245[\211\005\201\253\262\255tZA2$y\341M\030\234\254\233\177\201\016\375\227me[\251#7\225m\245\007\3049\325I\356}u"
+	.ascii	"\0364<\336\310\335\374\013l\200\001\203\2456\344\360\272\003"
+	.ascii	"\226|\343Ag\343\346_\260\202\027/\245\022\007l\205A\356\253+"
+	.ascii	"\017AVaNWn\276\005t\264\224[\264\224\\\270\260\2619@\353\016"
+	.ascii	"XX\234\276\005kX\312,XJ\256\343\261\255\313\002\243\276\005@"
+	.ascii	"\324\312*j\245\225\322\n\025*\0306\323\0317]\026\\\351[\260$"
+	.ascii	"\245L\223\202\2066\002\2576\372\033\260\224\225fe%\227\271\267"
+	.ascii	"5f\305\240\332WT\036\242D)\271\264RQ\353\016X\030\231\376\206"
+	.ascii	"\"F#\023\257\r4\236<\261\306\363\305\027\220\272SLk\316\333\233"
+	.ascii	"\261\261\017\266h\271\211\211\271\210\362\303\013\350\006\030"
+	.ascii	"\330\030YXX\215\245\257\257\257R\311\335{\357\256\023\rj\f\271"
+	.ascii	"\257\250<\224J8 \345k\356\346\022,+\211\322Z\303\nK\322\203\b"
+	.ascii	"\330\315/\342\201\004I\311e\367\336\373j+\301\001\341F\331\035"
+	.ascii	"\260\344\276\242\362\360\"*\375\227G\216\345\221{\226\225\312"
+	.ascii	"v\214\236\027^w\307\344\336^\016\200k\034\311\322n~\005f\364"
+	.ascii	"K!\345\220\227D\210\224\\z\357\255d\3341.Pv\007,l_]y\340Y\301"
+	.ascii	"\211\354M\221\227\\c[\220sn>]V\362\237\207\267eH\362\346W\020"
+	.ascii	"\246\377\333\337\337\334KT{o\031\245qS1\375\230\277\275-\255"
+	.ascii	"\365\360_\260\330\006\340\177>\b\204\306\355\242nl\357m\345\350"
+	.ascii	"/,K9:\354\277\355\335\244\245\004\001\255\252&-\033OfZUBOfZ["
+	.ascii	"\251\311\210\222\020\325\326Rz2\333[\250\251I\211DV\325\223\331"
+	.ascii	"\322\026z2\333U\333E\231*\273\215ZJ\273)k\013\355\246\275\264"
+	.ascii	"\315\262\252:<5iU=\231-U\t\005\351\017\005\272\026O\360\005K"
+	.ascii	" ^PK\020:J\177(\320`\004T\250\350\2115U\201\220\202\276\325\207"
+	.ascii	"j\300\367\353\365\360\206*0\304P\005\362\320\025%1TO\b\nQHW\264"
+	.ascii	"\370CWD`\250\002+\240`\250\0025`\270\240BEO\244D !\021E\321\003"
+	.ascii	"\364\255j\004z\026<\t\204\220\210\216\240\372|\206\236\004\""
+	.ascii	"DJ,\256h\232\342\354\365P\036\026)\fy\324\342\212\256&\316'\241"
+	.ascii	"G?\341\004\326\237\210\f&\206*0\003\244\240\357(\230\226@\n\242"
+	.ascii	"I#T5\355\r+H{%\210\324tEW\023*\220\210\376D\f=\t\204\t'J0\021"
+	.ascii	"\242\203\212\236\3607\"%\nG\004=\t\304\221ox\244\242\032H\217"
+	.ascii	"\204@\242\017\035Z\237\004\"DP\b\004\n{+\254\312[\241&\365$Y"
+	.ascii	"\325\252\346\232!=\022\002{\326'\201\030\372\210\253z\224\376"
+	.ascii	"B\b"
+	.string	"}D\341O\330+U\236\232\022\251D\341O8\342\207\372z\351P]}\277\241\332#\206\020\372|\277\241\211\036\021\350I \324!R\b\241O\035\"\361\214\330\220\201'\201\340\220\324[\321\241\352;\nbA\274\360$\020E\240/\304*\242\b\364\t\r\205B\023\216|%\202>\364\204\236\225\247\237\004\202\230\376\212GiRO\325\340\207\256\3025C\nDQH\201(\n*T\364\004\212\242\352\323\013\026I\340\351\005\213$\250P\321U\037\t}\304\264\304QJ\364\251\351\321\205\025]U\240\026\253\217(\364\021K\034\005\251\351\257\327bD\212$\"\005\372N\254j\272\242&\254\"\216\322\037\032D\362\231XU\364\007\004,\232@\n\372V\b\201\024\244@\337\211^\312\"\002,P \006\365\f\3220\324\353\241XHl\201\224W_\260\004U\205\212\236\350\245\360Q\241\242k\020\006\023\351\357(\210N@hD\221\220\210\216"
+	.string	"$$\242#\020\021\245G\305\325\267\376D\244+\372+\366~\350\b\025*\272r\270\300\001\210\225\210\016A\234P\241\242\253\006\021\025<\tDJ\024\366THQ@W\224\304\006RP}>A\037z\002\213\024T\250\350\212\341I |\277\236\206\364Hx\202\357\327;\201hJ\\M\f\325\023T\250\350zAE/M\0321\224\376|)\204\304\022G\276\022*Tt\005z\022\210\036/\005\372\326`\221\b"
+	.ascii	"\025\t\375\221\200\024\364\001\211\250\317GP\241\242\253\320"
+	.ascii	"{>b\032L\221\364?\b!\001!\210\300\342\274\b\f\340\200\001\034"
+	.ascii	"\230\027\201\001FF\f\b\301H?\004#\274\256k\213\3370MA\350I \206"
+	.ascii	"*0\345\255*oMU\364\320\022C\025\350\263\252\302\022C\0258\244"
+	.ascii	"\362~\216\202(\020(\034\241\252iOH,\321#a\250\002\2074\254O\002"
+	.ascii	"!$\246\035@B\201\247\252\242C\240\260\027\024\364\375z\351\021"
+	.ascii	"\017\t\005\006!\241@$\024\370\203\204\236X\207E\342O\312;*A\205"
+	.ascii	"\212\236H\321\353\001\246\253\332\302\204\005\353\232\"=\342"
+	.ascii	"\255\025\250E^Ro\365\2258\n\212\370\375\204\304\241\f\304tM\201"
+	.ascii	"B\"\022$\361R\f\177"
+	.string	"\274^\017\355!\242*\034\021\321$^\257\207\376\254+/Ez\264\341I T@[`\365\202\337OH\314I\275\3257,\325\264\370CW\230E\236\n\364\021O\250=\037\020\r\266 \261&!\371~)\210T@\211XHL;\320\353\241\347\312C\327_J\"\005\372V\237\225\247b \005\372V\375$\020,\210!X\020\207X\020{\206(\260G,\211\351\221o\205\2208\344\261 \n\005\205>U-\242P\201X\244\277a\221D\212\037\232\324\363\023\366\204\253\2208\f:\362\361\244 \362|C\225\307\202XAz\344#\022\323\025B^\320\327a\345\235H\350\t\241\217\207T\374\r\213\204\204k\021\345\035\005}(x+\252\362\200E\342\252\"\035\252\027\374\244?\264\247\366\254\304tE\320\307\363\251*\321\247G<\362\001\313\240\017\250U\364\322\244\036\013\024\250\203\324\021?\341\260G\254@MS\"RJ\"\375!\005E"
+	.ascii	"\321\021+\206)2\034\375\204IjJL:\221\256\350\n\337\332\023\221"
+	.ascii	"\036\tO \372\320\242\240\257\227\252E\036\013\024\310cA\364\371"
+	.ascii	"\245\301 \232\324\343\261(\242<\026(0\350I 0Py,\320\240\017\230"
+	.ascii	"A\205\025E\261\202\202\337/\355\255\301TM\211\303U\030\\Q\024"
+	.ascii	"+6\244\274\024\t]\177\302\025\031R\236\206\264G,\nM\020\3235"
+	.ascii	"=a\r\246Db\261\227\241\305\352\353\241CtD\013b\272\256(\212\240"
+	.ascii	"\025\035!\003\251Z\274\240\256\304\364'bD\252\0265\244H\350\032"
+	.ascii	"L{\304\264\004R\320\027$\242\032\b\n}\353\020XT\203\302\036\007"
+	.ascii	"\325\247\246\304tU[$\255(\212\025"
+	.ascii	"@@\353\223@\204\020\372*hA\\S`\372K\327\nT^\006\025*zB\260\230"
+	.ascii	"\342'\345\225\260\022\205%( \246\276\024\2765\230\036\371z\206"
+	.ascii	"*P\035\"\t\261H\217\202%\244+J<*\242(x,\204(T\364\320\037\n\n"
+	.ascii	"\324\225(\034\372\220 \211\227\256(\221W\344\375P\0371U\211\210"
+	.ascii	"\351\332C\211hR\217\267\n\205(R\"\206'\201H\177i\257\207\006"
+	.ascii	"@\345\365zh\271>\t\304\006\353\205 \tk\252\246\304S\345e8B\323"
+	.ascii	"\024\212C\240\006\342Z\"H\0021]U\037R\232B\272\372\210\032(\016"
+	.ascii	"\201DA\022\322\325GT\341\f\n}+J,\"\371R\004\205#\212C \206\325"
+	.ascii	"\027,!H\302\352\013\372L\342Z\242\027,\222p\204\246)\364z\"4"
+	.ascii	"\250\274\025)\211^\017\325A\022\216\320\224h\256*\31774\221\""
+	.ascii	"%\221\016[\234\340\225P\302\204O\332\013\242\253\032\364\351"
+	.ascii	"\225g\201\022r\320W\"\250\366L\337P\305O\002\241\026QlPy#:(\301"
+	.ascii	"gD\007%\360\034\231\252\232\022\217\216\320\263\327\201\017\027"
+	.ascii	"y+\322#\265\210B\253\274\264\347[\221\222P\213(|V\236\bk\320"
+	.ascii	"W<\323a\213U-\2428\325\"\n\274\362B0\222\200\021\257\327C\315"
+	.ascii	"\225\027\202\321\032\364\235*\240)\214 !\302L\217\204#V\244\304"
+	.ascii	"\237\026Gh\232\002\272\242G<k\020\357|\022\210\265W$\256j\007"
+	.ascii	"*\217E\272\026\201B*z\302\037\217g\256\301\242\260\307\343\235"
+	.ascii	"\3044\250\202\220\307;Ub\252\026\203<\236>\n\372T\360x\246\032"
+	.ascii	"\364\rU\036\357\f\n}\252\357\227\362x<+oU}?\fO\002\241\246\303"
+	.ascii	"\026k\002\216R\"\232\244& \204\272\372P\204(\006\221\022\300"
+	.ascii	"\242\030\364\375\022\360A\b\274\020D`\021\"=*\376zA_\b\242Z\f"
+	.ascii	"\261\200\225E\032\374\241Ab\272\006}\274#4%&\255C\036\257\202"
+	.ascii	"\025)q\310\343\231\253\352\373\361x&\272\242G<\236ID\223z9%\201"
+	.ascii	"O\345\361L\025=\341/\247\274 \222\357\207\362\200\202H\276\237"
+	.ascii	"\210^\017\325\353\223@\024\207@\236\220\330\002\251\327CC\250"
+	.ascii	"\304t\205\217xd\200\224\227\002\007 p\020Bq\b\034\n\n}k\361'"
+	.ascii	"TSb\217\312\323\220\362L\024\207@\037s\375\025\3254\205\240\320"
+	.ascii	"\267\366\3225%Q\034\0023\254H\217\360\017]AL\327`\tHA\337o\b"
+	.ascii	"DM\364z\350\320\231\264\n\205@\023\275\036\312\223\366\202\026"
+	.ascii	"XU45a\025q\224\256\350\321\020\003\277\264\327\023\241\3726<"
+	.ascii	"\t\204\220\330\002)\204J\024\252\301T\265\340\302aJ\f\261\n\205"
+	.ascii	"\304\020>*OHl\201d\256\274\016<X\203\276\242\376\002\0260\242"
+	.ascii	"\003\006P\220\200\356\201PU\250\350\312\353\245\b\321K\021\""
+	.ascii	"\350C\201!zD5\004\210\242\024\350[\207B\241\tk\212DDW\240\024"
+	.ascii	"#"
+	.string	"H\210\020\022[ \351\237P8\002\257\374\177\2129gh+otWm.\316~\220\2319\271\234\313\t\306RQ\355}\265\225\342|p\343\025\327\226\334W4<\234`\316/Mv\314\035\277x9R%\255\311\356\302U\025\246\262\263K\236\223{\263!w\363\tp\247\377s\2139\007\nK\216\316\315F\rWK\246\264\254\321\305m\275\270\347\332S\223\026X\226\363\270\204\254\207\323\315\347\361?\215\030.\373\300\212\343\201\345J\2463#f\206\225\237W~\374\225\233\316\\\231\013r\363\0053\372i\345:\371\3614\244\212\211\225\315\332\314\261CE\r\315\217'nS~\252U\341\341A#G\231\233O)F?\247\230w\346\254\220\226\206\366\263E\265\306\307\331O\264\377\224\202\273\204\371\002G\347\346 ;d\236fF?\317\364\335\235\026!7\003E)\013\302\301\202\017\030d?\313\314x\256\004\031\202\274\3714\032\375$k"
+	.string	"\221\036b7c(O|\322Hi\233\342\344\347\223\337T\222_\\\021\023\206\020\250c\002\004r<,\246 \f\306\224C\210h\206\266i\f\203\025@@P` \223I\273\244;\023@\204LLu-Q\223\2169B#)H\222\302\316n\276(m~\240\bB#X\023\320\321g\270\203Y.\fW\376\250\226\206\300\223\\\367\345\024\207\2268\230w\265"
+	.string	"W\315\2379\371\226\0067\320\374i\020\rK\246\001\034\254[\034]\345\264\220\310\237\313\023\016\231\235\302\360W\200x\3510o\001\236\b\377\25246\221\032\373\276\252$YBR\3514\022L\312\003\303\331}\210'\246\301\322\356\350\301\265\315w\315\362\303.HA\231\311"
+	.ascii	"~\317\363d\342{\275K\r\237\204yWF\t\223~\303pQ\003:\26654HFe"
+	.ascii	"\354\252\252\2624\317\022\0133\210E:Z\"\275\001j\361\333UGAK"
+	.ascii	"\336k\004\355\313\232j\242\274E\332\220\336.]\246\341\270\210"
+	.ascii	"iq5Z\344\r\26567\367)\236\017GJ\202\303\320)\254\033\220P#gL"
+	.ascii	"3 \035B\240\036\332\f\373\266\345H\265N$cxvo\272\253l\211\354"
+	.ascii	"\247\276W\251\"\314qG\256\372\201\260\022\264\273\352\227\244"
+	.ascii	"\265\205m_Go-Y\300M<yk\002"
+	.string	"\324\246\361\343N\367\316`\036\340D\336\204\377\3750\362\226\200G\007 [\317\214\205\256\202|C\223\300\217\005\377\307\350F\253: \264\320\257^\201\007\017\3608n\300\340\004\341\344\312\341t\022\215F\037\r_\316w\312\213\203R>\"\204pR.\n:w\252\360MX\337\272I\364\003\201\336\310\030\036\004\344\035G\313\236\322-6\264\264Q\254\002A\353\253\330\374\\\243<&\0370\215\337\262o\034\206\2609*\024\235\262u\"/\273\353dY\302\013I\325\221\201R\3441Xk\202W,n)v\240\002\242H\337\277y\356\357>V0\324\237'\355\0300\376r\006\nv)v\200\222\016\242\350\367\304*\217R\023\022e\204\216\244\017]\205V\3701\207AZ\303B\345\363\353\316\242A\254VE4\314F\226\370N\263\254\211C\245\325+\fA'\016\033S;]\277\362I\024Z\025v=\350N\277*\004d\325\335=%\337"
+	.ascii	"|\200\256\033}$\375\324\213s\327\326]:\301X\020\312j\364\266"
+	.ascii	"\023\255*E\360\266\262PEK\334P\222\213\361|%\bV\330\215J\363"
+	.ascii	"\203\335\354\325o\300\037\2413e\221D\n\336\266\365\277\013gP"
+	.ascii	"C\031\320\231\323bC\307\236\203@\207\361\300\306\376<5\025\275"
+	.ascii	"\361\3773\277x\215\247\024|\354Fy\030\267c\372\317L\213\215c"
+	.ascii	"h\3559\250\247;\362\2431W\312\263\301\273\254\025E\325\007\n"
+	.ascii	"\200\334\224\023\243+\373\320o\234\257\316W\220\031M\001\232"
+	.ascii	",]\016J\204\200\247\013DL\227t\202\020\216\322\231w\361\310\227"
+	.ascii	"\252\374,9B\337\037T\037:\352\354\\\210\001\t5\321q\364\205\363"
+	.ascii	"\251H\2305\274\352%\364\013\256\266i\276\007\331\363\340\363"
+	.ascii	"\235\301\025\327N\231\243\366\001\362\2231\312\003\226\325\371"
+	.ascii	"\030\331\022\245\177\013\272\020#\033\343\267\022\035\347\376"
+	.ascii	"\356~\371\327\003\373UuY<\025\226F\020Va\316\354\035\300q\342"
+	.ascii	"\2667\004<\002\361\366\252\337\330'\211\252\312\360 \004\006"
+	.ascii	"\372\222o\234\210\223\217\006\227A\033\030pr\022O!\332]s\346"
+	.ascii	"\240\330\351p\201\n47\006\370\236%\266\001\003\225\200\2769\230"
+	.ascii	"\347\336\3161'\fBh\024\"\353qY\315R\024\312\005\214\334\006\277"
+	.ascii	"8\341\024+\364\271\244^o\333\257o\223\305\355C\313\217\2404\221"
+	.string	"\001\026\352\236{:'A\304\313\b^S\203W0\"S\035xo\330\036\362X'\327\017\200\034\202{\r`\325\265/|^\030\rQ\337\234[f\337\005\331c\257x\340\257\3514\030j\230\346p(\257\367\213\200\250\232\017\323$"
+	.string	"\226(\036\322O\025\0166b\341\206\3063\365\234\344\244\205\314\272\271\030\353\226\316\3173\b\340)\270w\252\371\273\344\025\275Y\225:j\fb\203\016\021\225\341\201\333\356\235\374\363\304\b\302\257\007nV\013\\[Y;uPh\221F>@\240I\362\374Jr"
+	.string	"A\333X\353!(^\344\344\216\325\231j\265>\237\210a<\303\322\346\366\004\223X5\027\371\253\004\305,\377\335\321\317T'\301D\003{\341(!\006`\301\324;j\231 c.\235\032\247, `\364\3240>C\213\030\370\225Z\364%)4\223\211\314\020\337\260\364w\031&?\024R\246\313o3*C\350\375\265Z\213C\265N\304ITw\302\312\027\325\025e\347\036\361\314<\263\267\020\352\360\323\304C\"U\307\373\3538U\223X\356\300zg\305\317\365!\305\263\300\327\237\032\345\207\231\342\316\216/."
+	.string	"\255\367:e\265\333\020/L\360x\266\365<\254)r\241\203 C\241y%\236Y(\210C\354Kp)\232u\242M"
+	.ascii	"\020\364\373\3337to$\213\242\323.pG\235\224*I2-\370\025L\357"
+	.ascii	"\251e\330P\344\366r\321UP\346ur\254\037T\250\346\353*`^\204F"
+	.ascii	"\304N\347\030)\242\261B\332E\315\377\367pv=\"\230F\367\006\256"
+	.ascii	"?\206\220\372\246F\234\013]\273V3\236\350f\355\355K\330\350\203"
+	.ascii	"1x\251\005<\267I\222,\214\225\037\205?{"
+	.string	"\265y\367\006\035\237\024\222\t^4\317\246\232\272\217\202\276|\016\324\027\313\320\236\b\243\213(\245c(\340Q\317\313\326\f\211F\322H\363\274@\243\203E\374\355\324\236\204\245\367N\266\345:\212\271iH\2311\350\016\270\215\361]\372a\375\324\177tX\350 l\3672\220\351#\250U\263\350:\357X\211\244\345\346'\266\363#\364n\343\203\332\264\204/T\034Z_\200@\033\334y\030\\\335X\246GP;rT\016A\270\270\311\f\351\212\004\335\342\313q!:\200\343K\216\265\025\336\347\316;\035\272\336\225*\376\006\227;\240j\332\2442eFH\343\b\001G?#\250P\026\230+H\350\013\021\337p\246\361\256\037\253\363\022\r\027\261\252\021\211!l\374m\317h\t\342\230\235\253w\265NZ\f\224a\343\351\325\214B\345.df\337V\253\3565\307\363\230g.\364\213\005P\337B)\013bW\264y\007s\312\017\257E\351"
+	.string	"\300~\246s\033\241t:\334U\321\260\303\205\314\212\"\335\234\254)\273\237\313\310\226V=D\203\336\231\245\264\342\211Up\303\353RX\256`)\362\037W'Y\220\343?\317:\030\037T\"\314~\357\245\347\222\340\276RM\301F\363\020C\352\022U\004\251\342\177\265\221\207f\327W\254\032@\t\325\256lR(\222\005\271\342\t\267FX\303\352\007\3311\017)|4\240b\357\360@s\336\245\034\237\205~?8\367-#\311am\333\270\f\001\317\302\372C\332\322\255Y\035\372T\"\364\314Z'-\241\371\206|\340\310\255\255\002\314\347\343\003\310*\022[.\276\330\275\005\2571\270\204$ng\226_\t\316\215aZDBEB\351&<\365d\241.Y\240rR\342~\351)/\277,\371\3156\262\327\264\364\226l\3608\237L\226\372Z\226l\241"
+	.string	"\036\370\266\322\375\217\005\320\210d\233\263\223\270\315\204Dz\213\301\262\006\027\210\322\271\206\205\255M\273O\244\317@\273\243\027\020\300\t\302|\027\262\020\"\270\005e\323\034\302\306\t\f\301t\330B?l_$C\310X?$\347\020[\376J\364\030\\\232O\212sR \020\204E/\n\npuc\003\013S\246\001\244 \032V\3119"
+	.string	"\020T_FpL\035!\266R}\270\3712\203\233v\200\320\276\324\363\032\n!\177F\022K\026HR\367\027\003\214\020\205\304.\306.\211\034:\036&\262\257\357\345\007\t\262\345\303H\336Cw\257H\362/$\262\032\247I\322&t \201\207\254\347\277\b\261$\331\332\275\374\325\364\313\345\256$\303\362\342Z=\264j\360\213\226P\333Y\254"
+	.ascii	"\351\364\243\354\317\003b\317\035=\230\200\370\376bF\301\276"
+	.ascii	"\016\3028Q\272\375\035\370-\215S\246\354=&d\n\352\257\217\371"
+	.ascii	"\275\376\304\210\351\270\345\377\367l^\311"
+	.string	"\004\031\251z\200>PO\242}\374t\265\351\357\371P\r7\n\322}\bvjGK\334\016\005\355\021ll\341\232\252\331\206&\377L\217sj\355\207\034\016\326\004(V\t2\245\\\247\363\247Z\311\2062 \326\203N?\004\254\025\3473va\316\317\242\327\341\373m\272X\255\360\345\263\364Kj\201\242.\316,I\030Qxq\313\261\213\210\360\300,#\271\377*\230X\267p-\264\t~_\241\214\347\232@G\274\211\024\225&m\266\205\002t\261:c\213(\375I\265o\034\\\347\f\230\336C.\212\271\232%\245c? \005N\353\006\341e\240d{\362Wp\002\312\001\nQ\f\363\212\036\030,\241$\357![\031K\302\376\365\253\357\037\342bi\367\354>}5\277|\332\376\355\221\327,\313D\310\262\374n{E\203\245h\352\f\370\227g8V\216\367\241\302\033\021\335\365_\237\371-\\0\3319Y\310\211\203\311\210\261"
+	.string	"\002\033\324\362\236-\331\370E'2\220nD\236V\276^\243\256\276\376\324\023\226\265\266\261\312\245\n)u\213K\267\227\004\372\321\022\231\350;x:\357\t[P[\217O\3262\246\250\352\202\b\254\262]`8\226&\356\267tm\004\"\203\332\301\230\3218M\360\240-\036\320\322\250\321%\202yq\336\352d.\305"
+	.string	"\244g$~\340\355\247\\*h9\2733\233\213\231\n\035\264\343P\022\233\020\004\3123\302;}\300\360\311\t\257\361\317\346\023\307\3452\310%9\347T\036\372k\266Z\207\206\351\333\351\0320\320p\254?\307\264a\272<J\200\006\211@\334\261>\320d\243\037\032\221\342\310\202v\0323\263#\207\034D\220d\020\004\001\326\007\036r\206\334\340\374\245\327\306\223\262B\346\222\213\301\nG\322\305\353"
+	.string	"\234\355a? (\363\363\234\372\2429(\205\227"
+	.ascii	"\331%\212\252\371i\221\201\326v\255:R+f\315\241\267=\025\270"
+	.ascii	"4\320L\032\334\301\362\301\262\307E\217\265;NF\244\250\0068\202"
+	.ascii	"\272%\036 \227kO\35232F\027\315\030\230\273b\033\375\345\204"
+	.ascii	"\300\006\377o\243\331\244\325n\230\267\371Q\212\034kc}\032\350"
+	.ascii	"Z\324\340\252\344\252\020\230\177\365\027,\337\013hb\302\252"
+	.ascii	"\337\214\232k\rv\363\027\031\246\266h\242\177\375\366\302\351"
+	.ascii	"\334\252UM\034B\001\204K\213\037j\347\346\f\007\307\r\306&\253"
+	.ascii	"\323\203lJ\020K\207k\332_\232\342\342\276\255\355\036\333q\361"
+	.ascii	"\350\260m]\371\200w\342\271\004\364rE \002\262.\374\013\244\327"
+	.ascii	"\261\211\220\373\245\032?\360\021\027\373\216Q\214\3409\277\036"
+	.ascii	"\364W\274\245H\246\315z\n\200\365\334\260V\235\037{{\312E#*\242"
+	.ascii	"\0230\024\243\273#A\020\363\353\311\226\244-\bA\2140\371\275"
+	.ascii	"\177+\251\256\324\246\241%\\\264\207\233\206\331\343Ny\317\305"
+	.ascii	"c\334\234\004\f~\300\026b8\035F{v\366\237\356\271b.W+Q\344:\221"
+	.ascii	"\232\273\223\226F\2434|\3501~)\347\003\363"
+	.ascii	".M'\337\224\003\355\234\311\034\257\231\244\376\021z\"\222\327"
+	.ascii	"\013%\332\004\273B\352\036\240\374\177 \323\320\273O\327\363"
+	.ascii	"n\275\273\235\367\203\033\205Vq\250\273'\376\214\355\346u\017"
+	.ascii	"\334\356\350\254\351f+\247\377\\\216\020xW9\211o=d\302\346\260"
+	.ascii	"d\241\352\022>\375\260\365\005\023x(\341\240&\246X\370\023\036"
+	.ascii	".1\322\366\252\352\022jW\260\302nX\277Nq\020\362/\333\357\007"
+	.ascii	"\277\337\310|&\367Bx\276\370\332\024\377\212\334W}9\013\365f"
+	.ascii	"k{\345l\r#wL\362>V\026i\244y\362P\302#\317X\207\300\360\377\006"
+	.ascii	"\226\317\273\253\262l*\317o\353\037\217\020\326\240\227H\363"
+	.ascii	"`\306}\222\236\215\373\203\274\265\3052\372\353OO\341~\2144\357"
+	.ascii	"\2207\244_P\375\257\367m\257\017\306Y\301\335\362\315Q\034\225"
+	.ascii	"bQ\273\257g6B\335\270\234\006\2223y\274\243bB\020\332\316\r\326"
+	.ascii	"\272\002"
+	.text
+	.section	.gnu.lto_.symtab.96e4a9e79f34a3db,"e",@progbits
+	.string	"taskBatteryAlerts"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\002"
+	.string	""
+	.string	"taskSerialCheck"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\002"
+	.string	""
+	.string	"fcTasksInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\002"
+	.string	""
+	.string	"cfTasks"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\003"
+	.string	""
+	.string	"specialColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\003"
+	.string	""
+	.string	"modeColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\003"
+	.string	""
+	.string	"colors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\003"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\003"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\003"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\002"
+	.string	""
+	.string	"isRXDataNew"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\002"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\002"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\002"
+	.string	""
+	.string	"mspFcProcessCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\002"
+	.string	""
+	.string	"mspFcProcessReply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\002"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\002"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\002"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\002"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\002"
+	.string	""
+	.string	"taskSystem"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\003"
+	.string	""
+	.string	"taskMainPidLoop"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\003"
+	.string	""
+	.string	"imuUpdateAttitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\003"
+	.string	""
+	.string	"rxUpdateCheck"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\003"
+	.string	""
+	.string	"dispatchProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\003"
+	.string	""
+	.string	"batteryUpdateVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \003"
+	.string	""
+	.string	"batteryUpdateCurrentMeter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\003"
+	.string	""
+	.string	"gpsUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\003"
+	.string	""
+	.string	"rcSplitProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\003"
+	.string	""
+	.string	"batteryUpdateAlarms"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\003"
+	.string	""
+	.string	"batteryUpdateStates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\003"
+	.string	""
+	.string	"batteryUpdatePresence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\003"
+	.string	""
+	.string	"pidProcessProfileChange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\003"
+	.string	""
+	.string	"pidProfileChangePending"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\003"
+	.string	""
+	.string	"mspSerialProcessStreamSchedule"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\003"
+	.string	""
+	.string	"updateAltHoldState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\003"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\003"
+	.string	""
+	.string	"updateArmingStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\003"
+	.string	""
+	.string	"processRx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\003"
+	.string	""
+	.string	"accUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\003"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\003"
+	.string	""
+	.string	"telemetryProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\003"
+	.string	""
+	.string	"telemetryCheckState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\003"
+	.string	""
+	.string	"isBaroReady"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\003"
+	.string	""
+	.string	"calculateEstimatedAltitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\003"
+	.string	""
+	.string	"baroUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\003"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\003"
+	.string	""
+	.string	"compassUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\003"
+	.string	""
+	.string	"mspSerialProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\003"
+	.string	""
+	.string	"cliProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\003"
+	.string	""
+	.string	"mspSerialWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\003"
+	.string	""
+	.string	"setTaskEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\003"
+	.string	""
+	.string	"dispatchIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\003"
+	.string	""
+	.string	"schedulerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.96e4a9e79f34a3db,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
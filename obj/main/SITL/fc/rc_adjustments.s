@@ -0,0 +1,1024 @@
+	.file	"rc_adjustments.c"
+	.section	.gnu.lto_.profile.a7fdd72c8063e5e6,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a7fdd72c8063e5e6,"e",@progbits
+	.string	"(\265/\375`\034\001M\006"
+	.string	"T\b\020\002"
+	.string	"\020"
+	.string	"\243\274\344\244\007\b\002"
+	.string	"\002\001\002\002\002\001\002\003\002\001\001\337\260\200\236\006\202\001\002"
+	.string	"\002\004\005\006\002\006\002"
+	.string	"\002\007\003\240\342\234\212\n\004\265\201\225\355\n\n\005\226\204\231\223\n*\002\b\002\t\t\002\n\002\013\002\f\002\r\002\016\002\t"
+	.string	"\006\007\352\263\360\321\b\n\307\206\334\021"
+	.string	"\013\265\310\273\263\b\024\002\017\b"
+	.string	"\f\r\353\366\243\226\t\016\226\266\306,\002\017\276\325\276\331\007\020\021\022\240\342\234\212\n"
+	.string	"\034"
+	.string	")\"~\316\250hI\340v"
+	.ascii	"c\240\023\363\346?\264\003\036K-\374,X<\341\206\222\301N<\030"
+	.ascii	"\221\033\3602\260\272\273\264\026\0024\372\037\326\304\323p\360"
+	.ascii	"g&\260sM/\362\3562\311YV\200!"
+	.text
+	.section	.gnu.lto_.ipa_sra.a7fdd72c8063e5e6,"e",@progbits
+	.string	"(\265/\375 \256]\002"
+	.string	"\024\003\242"
+	.string	"\007"
+	.string	"\002"
+	.string	"\001"
+	.string	"\001\001\003"
+	.string	"\001\004"
+	.string	"\005\001"
+	.string	"\020"
+	.string	"\007\001\001\001\003\001\200\004"
+	.string	""
+	.string	"\b\n"
+	.string	"\001"
+	.string	"\001\013"
+	.string	"\001"
+	.string	""
+	.string	"\016\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\n"
+	.string	"\003C"
+	.ascii	"\204\262\004\346s\007dk\n\234$w.\210\0058\002\003,"
+	.text
+	.section	.gnu.lto_.inline.a7fdd72c8063e5e6,"e",@progbits
+	.string	"(\265/\375`d\005=\025"
+	.string	"\346[^B\020\221\223\016\017\2172q\006\240\034\210\026\322\330\2129\350\330(\324\267\3047\277\260\"\245]DU\202\244\t\200]\301\320OB\037[\213@\211p%\002 \320\242\337\302\035\272\210-\332\246\266\337F\220\334I\246K"
+	.string	"J"
+	.string	"I"
+	.string	"\240\347\3554\265`\241\"\255[H{@\210\200"
+	.string	""
+	.ascii	",\020\004\371x:\234\217\267\241<\324=\223\001e\275B\332\b\022"
+	.ascii	"t\n/\340\214p\023\n\b\032_q\246\355\312\335\277n_nw\227\272m"
+	.ascii	"\370t:!\\\333\335\217\312\033S\013\002\212Y1+\3106\264\275\314"
+	.ascii	"/sj\245M\322\356\216\234\212\013\0358,\035Q\303\022\\\303\270"
+	.ascii	"\216\241u\350\177M\313\351\364\361\177\007\256\204\007\226\322"
+	.ascii	"\255\372\336\356\2228\232\f0^,\253M\032\330\327\025\003e_\330"
+	.ascii	"]\222m\300\266\365\321\217\3440.0&nXe/\tXCl+\037\016X-\322:\267"
+	.ascii	"\337\2030\246bY\t\306\320E\232\375\347\367\374\007\r\241\017"
+	.ascii	"\243c\364\343\350/\332\t\r\037\267\033\304vGNc\203%\305s\267"
+	.ascii	"m\313u\372i"
+	.string	"\021l\243\210.\371/\36799)EfC\202\023\267\"E\206\203\210;\266Gm\257\211\213\261\273\033slO\347\"Kx\016\025\023\211\324&\234\204\"\243\3061\366\260j\345j\344J\035j\264\2505Z\037\374\305i\007\212[\255%\0371\303e\343\\\2771\0233\023\342\027\200\251\2501]T4\"I\nR(,\007\300\002\241\242\261\016\020@e\246N\222\fc.F\346\3232S&\375\303_S\347,\337\240\005\327g0\267oz\260\301\b\245\025\235\202Hz\013<$\271Z\035\246\024M\0315$$!\242\227\250\354o\316\316\347\224}[\340+_\001Z\253\336\322\267\300f\226O\242H\026@\301GU\022\277BR\235a\022\310\255\305\326.\214]m\002&\361\212\214\224{\350\361\003mU\204v\373\206\rk6B\340\3455\215\301_o\027\024l\005\006%\273\205\333\201q5\\\003\331Jk\026\004.\237S\026\371"
+	.string	"h\320Z%\251\223\310R\377)\223\001\330\203\004l\234\272\365\271\243,\257\240-\022\227\200VE\216_\302\314\247\340\250\341\177\313\215\001\370`\017\347\n\005\024\316[\364\341\332\314\271B\001\205\363\026\201\302ku\034z\276-\322E\343\314*"
+	.ascii	"\274\013AL\263\306\016\267\317\b\036\025=\370e\244\342j\\\244"
+	.ascii	"\r\005\342FI\034\201\367\2228B e\001\tT\006\021HY@2H\252\n\220"
+	.ascii	"x\026L)e/\017"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a7fdd72c8063e5e6,"e",@progbits
+	.string	"(\265/\375`i\003e\n"
+	.string	"\"\217..pi\222\016i\325/f\007|\370\247\\x@\001"
+	.string	""
+	.string	"\021\204\201\377\323/ \277[\250Za\017f\377\177\267\265\255\233\355\006>i\204\310$\003d\364\326K$Dj4\223\242\225\274\341\031\016J\351j\344C\2369A\241\337\261F^\237\230\261:\344\031\207#S\251l$\250\036\305\272\245\275\245\365Un\361\267kE\221\303\224\2447\2163M\024\365xT\025\004\022\211\334h<\374<\020\020\324\205%\221|\361d\302\212\031\321"
+	.string	"\356\334LR(\033\2642H\217\352\261^\300\277\276/\355/\255\023\241\f\303\007\332\002\222~e\325Kr\206\211f\230\031M\320\312\252\336\2437}\311 +\bV\250\241\250X\224\024\224${\034 C\252m\003\021\240PG\224\231\231\211*3K\212\035\t2\020\r\231\253\220z\312\356\337yY\243\323\272e\224u\370\002\0048@\016\274\247\003A\327t\333\225\304\271\301\277G\336\343\323\300\"(b%\344\367k\"\3462\215(I\nE%Jb\375\220\335^\224U\n\213\241\006\267er\004"
+	.ascii	"\263JPA5\025\024T\001\225\223\340\030g[o\262\217\001+}\243kN"
+	.ascii	"\2562\250\001\363>\216\256m\324\372X84\003"
+	.text
+	.section	.gnu.lto_.pureconst.a7fdd72c8063e5e6,"e",@progbits
+	.string	"(\265/\375 \032\321"
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"\230\004\001\232\004\004\232\004\005\232\004\n\230\004\013\232"
+	.ascii	"\004\016\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a7fdd72c8063e5e6,"e",@progbits
+	.string	"(\265/\375 \2615\003"
+	.string	"R\204\017\033\2405\351\377\377hUh\242\206\177\375\233tZ\202\2169\327\2106\2104B\210\224)/\215\243\250\237C\"\024\201{\356\370\f\025Q\372\221\316U\276:\2176\326X\237\033M\004\342\177\360\003\002\017"
+	.string	"l b50\301\310"
+	.ascii	"!\324P\303Y5\f\205\223\347\032H\021\030\024\257\313^\224\305"
+	.ascii	"\201\250\025\002\006P\004"
+	.text
+	.section	.gnu.lto_.lto.a7fdd72c8063e5e6,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_adjustmentRanges_Registry.65.a7fdd72c8063e5e6,"e",@progbits
+	.string	"(\265/\375 \213\r\004"
+	.string	"4\007R"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\266\317\ryw\250\367\005yu"
+	.string	"\005\001\006'\001\332%0sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/fc/rc_adjustments.c"
+	.string	"\004"
+	.ascii	"[\005\2412\3223\211\033@\021"
+	.text
+	.section	.gnu.lto_defaultAdjustmentConfigs.69.a7fdd72c8063e5e6,"e",@progbits
+	.string	"(\265/\375`,\003\205\n"
+	.string	"\344\016\037\004"
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\377\001\005\001?\202\210\200\b\177}\273\001\030\030{y\276\001w\275\001u\274\025\001\027\b\177s\275\027\303\001w\302\001u\301\026\026\307\306\025\025\313\312\024\024\317\316\023\023\323\322\022\022\327\326\021\021\333\332\020\020\337\336\017\017\343\342\016\016\347\346\r\r\353\352\f\003\356\f\360\357\013\013\364\363\n\n\370\367\t\t\374\373\b\377\376\007\007\203\002\202\002\006\006\207\002\206\005\005\213\212\004\004\217\216\003\356\001\222\002\002\226\225\275\230\002\300\003q3\231\0024\227\002\224\002\223\002\221\002\220\002\215\002\214\002\211\002\210\002\205\002\204\002\201\002\200\0025\375\001\372\001\371\001\366\001\365\001\362\001\361\001\355\001\354\001\351\001\350\001\345\001\344\001\341\001\340\001\335\001\334\001\331\001\330\001\325\001\324\001\321\001\320\001\315\001\314\001\311\001\310\001\305\001\304\001\300\001\277\001"
+	.ascii	"c\250A\330\224B\226\355\220\2234\305\006\020\020\b\211`\224\302"
+	.ascii	"\001\022U\310A\271\\'>\320g|m\226\267\236\305\314wx\241\250&"
+	.ascii	"G\302$>\3226\344\006\322\267e>\336%\231\267\353%\362\357&\364"
+	.ascii	"B.jC\023\267\240\033Z\221\033\2215\243\303\330\346\204\264\326"
+	.ascii	"\251\347\037\350W\202\266T+\252\250"
+	.text
+	.section	.gnu.lto_applyStepAdjustment.72.a7fdd72c8063e5e6,"e",@progbits
+	.string	"(\265/\375`\217&%n"
+	.ascii	"\212\260\250&K \024ZI\007\307\323]\334\352\372\222\354\352\223"
+	.ascii	"\204\310\373\211:\f\342\231\322FD\315\3022\314\214\234\332\336"
+	.ascii	"oL\241C\025n\300\303\324<\345j0n\257\320\273\326`\325 \343\016"
+	.ascii	"\256k\001D+\345G\0247\215\252\247\265\335H\222R\006Q\002\032"
+	.ascii	"\002`\002\275.jo\323{\231\336\273\364\336\026\265W\351\330\313"
+	.ascii	"\242\366\256x\257\212\367\246xoR\355Eq\354E\252\275'\336k\342"
+	.ascii	"\275G\265\327\250\366\026\275\227\350\275C\265W\250\366\006\275"
+	.ascii	"\027\350\275?\265\327\247\366\366\274\267\304{\223\265\227\247"
+	.ascii	"\366\356\274\027\371\336c\355\255\265\327\370^\364\275\257\275"
+	.ascii	"\375^\346:#4\200\t\b\246i\3303\211\364\3178\306\312\356r\030"
+	.ascii	"\0215\004\202\301!2\3505\007qHa\\7\221$\021\327[\206\210\317"
+	.ascii	":E\347\263N\227\304\273\270C0\210"
+	.string	"t\362\020\345\2241\202L\341\020p\374\336\020\341&P\020N\340\340\032:q\200s\342\322\034\"\372\031\"\236\031[\214\013B1\256L]_\335\023q\257\013\242\230;=0yyqi\232~a<\026\370n\237\204\217\205\335d\027\366\342\002\337\255\321N/\311\306]\027v\223ldJ\356\356}`'\223\353\266\017\005J\273\236\004\021&MS\251\305\201d#\013\364\275+@\f&\323-\031(m\256\221R\203{\227\265\360\026&\317\305\300Ai\n\2050L\232\322I\355\024\222\215K\307E\225\215H\036\252l\\\346.!\323\255\245\307(<x\331!\246iJ\365(\314d\251(\250''\030/\\41-\265Pb\261BE\212$\024H'L\034\031\025\021\r\t\005\001\375\370\364\224H\362\354 \217\325\210\276\231\313l\307;_b[,\025\205\207\246\241\236\374XO\210v\202\301{f\372\205\013.\003\246\233\230\374\316"
+	.ascii	"\321K-\322|i%\026k\274\364\n.*\3468\305\234\340\226NB\361\206"
+	.ascii	"\207F\332\341\204\034\233\220+\214\353##9U\272\250\215\210\215"
+	.ascii	"\207\330\370\220J\013\005q\035)\r\364\303O\033\332\007}BC3\306"
+	.ascii	"j\214\240\241E~\335s\306%\316\232f\235\344\361b\322;H0Vz3B\326"
+	.ascii	"G\245\033\216\370qE\237\342\2101d5F\374\320\242\260*_\0356C\033"
+	.ascii	"\317\004\241\307e\2076\264<\274\037\264X\231\262\326\244\314"
+	.ascii	"\213GlH\275\225\261&|\203\021\277!t\214\217\"\241\241\031\363"
+	.ascii	"\021k\242M\200O\006\331\216\033L\254\253\373X#M\323\355/\261"
+	.ascii	"#\274S\274{8\273\233\265\273\264\02450\272\303Z\230,K\356\346"
+	.ascii	"4\373\271>\376\243\357\300\031\320\232\377O\307kq\367G\363-\221"
+	.ascii	"i\232\312\330\336\223\301\354\004$[\f\225\215\375\036g\240\334"
+	.ascii	"\034W?\267\221\360\317\221\277\255V\\\244\30443\306\253m?\212"
+	.ascii	"] \242\233\267\257\222p\260\326\333\016s\204\006\304v\236Q\231"
+	.ascii	"\333\017\333_\212\300\300\334\356\266\273,!ZH\344\334\256[B\224"
+	.ascii	"\315\020\335v\017K\210\366\t\315-!*\030\304\313\252e\tQ4f\200"
+	.ascii	"xYwXB4\357\207\2275\313v\334\022~\321\214\017\226%\274!Y\017"
+	.ascii	"/\353\3336\\r\321\312\266\033O\"\333v\333\316\240\224\355)H0"
+	.ascii	"8lG9\306=\331\206R\313\234l\247\031\211\200\235m\243\241o\230"
+	.ascii	"l7\271\337\222m\262\326sK\235\214m'YB$\363\262\262q\373+\365"
+	.ascii	"\372\301\255\217\354.\241\261\317L\232n1Z\177\245NlL\341|\004"
+	.ascii	"\ri\\/.O\223\360]\253\253\346\257e\321\365-\024\275Z\263\030"
+	.ascii	":\200f?\024(\366q\343Y\035\347\020]\215\304.]\263\257\266\313"
+	.ascii	"\177>\237\207{(\273W\336\334\252\264\261Q\231\"e-\212\332\223"
+	.ascii	"4'hgfM\230\224\221-Q\222d\fI\221\332\313^\265\227\273j/s\325"
+	.ascii	"^f\355\205\241\366\276\360\336\026\336\233U{\261x\216y\205\367"
+	.ascii	"^\275\327\252\366\006a:\346\024\336\013\344\275?\270\216\331"
+	.ascii	"\307"
+	.string	"{I\250\275;\336;\302{Exo\b\265\027\204c\357\007\265W\307{=x\257\362\275\035\324\336\034\307^\016j/\216\367n\360^\rjo\006\265\027\203\367^\360^\013\336[A\355\245\340\330;A\355\225\340\275\021\274\027\202\367>P{o\034{\035\250\2756\336\333\300{\031xo\215\332\273\300\261\227F\355\235\361^\005\336\233\300{\021\250\275\007\034{\r\250\275\005\274W\306{c\274\227\200\332;\300\261W\200\332\033\300{\001x/\325{\247j\257\324\2617\252\366B\275\367\351\275N\357\205Q{_\034\003p`\334\351\305a`9\035\227\271\267\027\247\341F\213\213'\371\374\344\310\324\226\244G\n\\H\216\221\227\234U>.\213\327YN\323\261,\233\2560\345\222\340\024x\023\037\031\247\214+\360\033x\3512\316F\264\370\222\322[\344\260\244\261\346f\2059\247t\032R\332X<\311GF\216\214K\221\234\232(\200D"
+	.string	"\374\347p\250\353p\225\227\262\326u>\\q\034\226MjL\271$(Em"
+	.string	"\370\n'6`\232O\007\300K\212?\235\351$=\005\212'1\263<mI\243\315\2350\345b\2541y\270\r\314-h\0230\271L\265Y\241\262\021\305i\270\231{\223\233\255\260\314\266\f\330\260Q\331\210\364$_^\"\331\r9\220\030\021b\272\221\353\0041\027\327Y\345\227\\\ts\235\353\234\2358\222#L?\001\345N\305\231\236&\256\342\234xt\023F?\3521\017{\021\243\377\\\271\223\263!\207\230[b\234\255V\004\002r\037~\372"
+	.ascii	"\322\265\371a\362s\225\377:\021\346\3719F\254\3503|\b\220\027"
+	.ascii	"\301=\235?\016\204\350?\316\212C'\022\372P\324\233\313\031\347"
+	.ascii	"\222!\364\037\270\247\334\030.\035\230[1\312oM\026\237+\234B"
+	.ascii	"\020\340b\232\2345n\272\032\211\036\253\3674K\300\320\\e/*\302"
+	.ascii	"\360nV\245\t:\022K\246D\253\007A9\017\233Un\005t\256\362\336"
+	.ascii	"\3729\220\317\177V\252\017\2273\332\244ij\300\356\2156\204\200"
+	.ascii	"\2152\326|\376\003g\2308\306L\321-y\365{\361\274\340\265\312"
+	.ascii	">\302\210\027\336^\022\210\3519\341\325{\366\n\335~\325j\270"
+	.ascii	"\304\331\355=$\371\022<OR\320\203<\357q\026\226\325\t\263\223"
+	.ascii	"\365\006C^\255\375\030\013l\225\335F\020\353\r\206e\347l\262"
+	.ascii	"\2763\370\366\254e\203<\277\275\211\034\217\254?Z\320\200\365"
+	.ascii	"=\316A\2719.%\314v\314Ab\234\3048G\023\335\302\2315\250\333a"
+	.ascii	"8r\030\277\205<\302I\234\272:j\220\227\340,\242\303V\331ht \323"
+	.ascii	"\264K\306\266\020}\006\204]\021v4\177\355\250l\f\362\016\343"
+	.ascii	"!\274$\320\266\314\375\364nU\217\022ze\177\315o\255\361eR\254"
+	.ascii	"\361\327\021-\334x\266c'g\240S\260\013\024\363\225\267\360\355"
+	.ascii	"\031\f\031\t\364|\345\035\013d*\013\210\026\017+*!WVVWUH<\264"
+	.ascii	"\202\3640\301(\344\352\004\255*!,< \364\343\004\037B\256l\364"
+	.ascii	"\320\342\261A\220+,-!WUA[5\225\245%\244\207\225V\026\013(\230"
+	.ascii	"\300cG\025\026U\225\017*!'\360\260\242\252\302\312\242\232Z\261"
+	.ascii	"W*\364\300\242\322\272\272\302\242J\322q1\232\036\212\035\337"
+	.ascii	"\300\362\227\030\207\353\315m1\336\032[\255\210J\231\375\b/\252"
+	.ascii	"\t\336*Q\247\017M\316x;N\367\305\354;\240\206\3605\317f\"\234"
+	.ascii	"\317^B\270\b <\2046t\356\013\b\337A\265|"
+	.ascii	"\360d\237^\"\031\030\270?(\264\033\351=1\321[%\032\227\205\311"
+	.ascii	"YO\307\261\350\200J\222\207\306\213\312\363\3319\257\203+s\274"
+	.ascii	"\003+\350\333\022I\206\311%\307w\3348x\262/\017\017\316)\355"
+	.ascii	"E{0\312\366V\211\262\241T\312\316{dp|\r\007\235;gZ\263mpvr\026"
+	.ascii	"\243\3017\310\340\032\344\200\252e\360"
+	.string	"\036\273;\2719/9\270\275P{\262\214\013\2622\253D\323\234\220\235\313`p\2643\263\"0\260\253k\252Yp~r\356\253\340\026P\360\n\340P&edEP\240d\202'\371\236\2119\3745\255\235\347\f\323\2223\253D\217\210-9\237\221\340aK\246\"L\271\244\032$Pt\256Ap\216r\016\342\201Cp\343\017`A\301\320/\224\210\f\2067P/\007\236\344S\224\253b\203\221\245)\337I\323BI\232U\242M\224K\3119\215\215\243\351\222\351\271\310e\243\356\2609\205\201\263\224\263_\2153\260\300k$\261\234\321\246\016\022\\\013|\006\"\215'\371\f\023\311\250\3448\243Sb\266\023\255a\221d\315*?GN\222\363\232\0317\"Na\221\031|s\330\0228S9\003\"\360\004\0168\002p\006\337\0249\300\215\001O\362\315\261[\261E\007@\025#<H0\305\230\340*\037\310f\354,X\300\325,\233"
+	.string	"\231rI\177#\274"
+	.string	"6\203m\037!\306\271\355\034H\300c\fp\002\340>\204\037\032&\003\b!\300\223|\203ke\177I\027|\350\r\n$oVy2}H\316o\002\370\336\262i\214\030\034.x"
+	.string	"|\201\036\374\002\252{pv3u*\251O\351\201\311\303A\n/\352I\276@\037\220x\260\222v\242\201\003q\241\211\"\205\253|\227\273\"\347B\250\327-\233\234>\2745p(6~\021\274\001\247Gp\016\203\002\250r\2409V2T\"\"\"\222\024$\2054\006\362\r\b1\b!U\335\022"
+	.ascii	"\363\030\205\302@-\021\223A\244\205l\214\001\216\214\360\211"
+	.ascii	"\301\311\334\032Em&yOC,Ok\022+\237@\343\264\bT\300\201&^\256"
+	.ascii	"\020\316<\206\214C3\267\224\364\215\242\246\357!\247\266o\347"
+	.ascii	"\365\346p\210\206q\020q\301\315)J\372R\223\3043k\341,\252\253"
+	.ascii	"4[\243\372\307\207w\212\377`\233Aa\237M\372f\223\001b\250\220"
+	.ascii	"\327\027gK\3355\227*\330\264\371R#\203B\200\272\361\204\226D"
+	.ascii	"\004\365\234\225\r\315\016\255L\212\r\325\273\364\b\006\332u"
+	.ascii	"\220\215\337\"\037\331\217\214M\255\030*Sw0Q\326\361\315XlAB"
+	.ascii	"ga'\231\271\332\365bjM9\357\241\377\354\027\\\035\276\341\315"
+	.ascii	"\342\3673q\204\032\n\2676\016\322VAK\334\b\370q\352\365L\375"
+	.ascii	"\246hF,\363\\\364x\365\343\306q\303'%\321}\307RW\255\017\032"
+	.ascii	"\233,\034n@B[\240p\347~\240\252\256?i\002!T\301\b[\330\315\235"
+	.ascii	"\030b\257\356\275gK\033h\326b\b*S&\313\376(\020\211\024\225D"
+	.ascii	"\266\030\001\tw\312\320\202\024\226Q\003AHM{\3016\b\245\311\207"
+	.ascii	"\340\207\274\360\372*\007a0\240\3405\235\245\302=\234\016\332"
+	.ascii	"\003\341\343V\225G\002\2009\221\370\3056\210\035\232\277\236"
+	.ascii	"%m\320\2626\363^-Q`\3621\300\030\220L\323H}3\203\2747\260\b0"
+	.ascii	"\210\002y\372\340\031\231\370\321\351\346\016l\313\262+%\325"
+	.ascii	"|\345\272k\206E\374 |+\252\036\273\270\253\007;\326\271\331\213"
+	.ascii	"\370\257\277\373Y\022\274Z\325\301\026r\001\352@D.6\300\255\225"
+	.ascii	";\317{E\031\254\223w\2162\365\031!\016\257\\x\201\bx\3412HG\030"
+	.ascii	"e\345\307UEM\304\f\223\267\315H\267\020\220B\222\002\303\304"
+	.ascii	"Yd;\b3\035\240\353qq\202\337h\207\333|\017\n\2103\373\260\366"
+	.ascii	"\344b\\\313/4Jf\366\\\316\350\002\376L\204<\274\026\027\226,"
+	.ascii	"\301\206\251\243\271\246-$\232Bxj(P\245\333\200Q\204\224\002"
+	.ascii	"5\302\f%Fpp|\267\261\220\030(\032\013\320\271\230Ls\362\021["
+	.ascii	"\275Dq\354\372\237\377Mm\225\333~\016\206A\032\021Q\024%BN"
+	.string	"\002\273~Qx1\315X]\035\371\001\310\277\262p\021\013\006\210\n\3653t\3013\221#\200i\341\344\2542`\227G^x\266l\251\337S\n\205\002\032\016\237\271\026t\037g\370\\\026\372H\223 \177\246\266\315=\217\260\326<\035\232\264O\020\265Fui\330#\312\241\004\271B.no\3275;n\250\363]\354\274\n8\263\360c\203X.\301\360_^\001s\214\322\326\263\232{\331\220\r\256Z6du\2124\262\243#\367\352v\356BM\275/\374eA\241\020f\317\233\275\237\376\036:\265t\347L\312\376}\256e\016\220I\235\005#\327]'(\316\365\262\220\202\372\305d\366U5\021\034\223\023\275\320 \374(\353\342L]N\231\213\223}q\244.\247\314\305\325\\d\343\352\202=\275 \324\235g\\\301L\257\214\304\311\344-t\370R\035\232\214\256p\331\363`\324\327ex+\374c\272\302\f!\003\b1X\241\025"
+	.ascii	"0\201\304 \202/\bx\257\242ru\312\254\263O2\253R\214\252\007p"
+	.ascii	"\022o\225\023lP_\033zL\215+\003\201r\020P\357b\300.\024\303^"
+	.ascii	"h\321\322 \250z\030D6\323\266\302\315\300\312\315*2\207\277>"
+	.ascii	"\260\274v\326\223\377L\351\365\f\022\337\322\005\030C;\320\324"
+	.ascii	"\302\036DdM6h\245\027\243s\026\207\243\211\351Q\210\247s\222"
+	.ascii	"u\244O\025\254K[ \036a\225\025\\F9\030\356W\024\037\2078<\"H"
+	.ascii	"t\223\230\007\376\307\025\013\336\273\022\037\264\005\242L\346"
+	.ascii	"\2769\376\240rR:\240\206\016\220\251\001\0240\260i\034.\235\273"
+	.ascii	"\206\357)\373\314!"
+	.text
+	.section	.gnu.lto_applySelectAdjustment.73.a7fdd72c8063e5e6,"e",@progbits
+	.string	"(\265/\375`\253\005\365\""
+	.string	"\346>\335K\220TR:\r\006\215\353\237\216\241\006\221\330=8`\006~\264\211\337\0221\256\346\017<\216\271\370\370\003\037\024\240\350\375V\265\355\3349\030O \236\r\301|7\007\"\334\311\302\031J\341\310\036\2125\241\252\037{6#\215\020\"w\222\001\313"
+	.string	"\271"
+	.string	"\310"
+	.string	"P\326\026\314\353Q{%\257\314\234\f\252\267\n\2675\025\244\312\275I\006G\271\002c\005/\340\016\237(E\260\226\271\201\203\242[\005\271\357=\222%\2717\211\3039\352Q.bn{R\307\305M\375 \022\321r\357\355u\216\027\375e\267\352r*.E\317\266E|\345s\305%\341_\236\276{R\322\260\253\235q\335\001(&\031\317=\315(\203+\206UO\032\264\033l\013\216e/\276\365\003=\214N\026w(\246\031Oa\034=\027T\001\313\002`\t\351\244Q\332Q\374\322\205=O\003dL\342\323\214O\347MT\r\267+o\223\226\216l\023uK\303\224F*l\352P\306\247\2668\235{/\333\342\022\323\031\300\231\331\n3\203`F;\004\266\017\2255\345\310na\3252\257"
+	.ascii	"\332\027m\317\2105\231\303\026\362\217|\300\026\246\320v\271"
+	.ascii	"T\230\224X7\222\237\204\017\306\373\252\2726\274\370_\334\246"
+	.ascii	"\336+\374q\367`z\224m\361&]Uu\361\217\266x\025\034\r\320V\314"
+	.ascii	"\215yd\337\230\223C\333H\346w\263\331t\343\216b>-\333\324X\313"
+	.ascii	"\274\231k\235eN\3131\307\372an\365\007x\362\274\263\226\327\323"
+	.ascii	"\262\316Z\316Y\313\252\265\214;-\247\250e\324Z>\255\345>-\333"
+	.ascii	"\033\002eh\"\220\334\253\324\344r\231\250\022\036\327\372\223"
+	.ascii	"\267\314\347*\302hS\333\217\017\341oiuM1\311\360\254/\231Wn\361"
+	.ascii	"!\2146\005fcU\300\2600U\231N\231)\\-\210\263\206v(\026\020\350"
+	.ascii	"\270\367B\270\360'\030\324{\357\203\264!\r\005\326\250\210\322"
+	.ascii	"\243\270\243i\343H\301\342\237\335\t\021\237\2129x\360\220\036"
+	.ascii	"E\033\347\203\315\315\211\32721T\212\234\303\322\263y\315\026"
+	.ascii	"\351\312\3206\031\246\317\376\326Q\243\331\026\361\355Hn\307"
+	.ascii	"\236p\215|0\205\351\232\276\362\t\260\250\r\243h\035\207\351"
+	.ascii	"\214\355\336=D\312_\212\030\201\266\320&\353L\fm$\237'\215i\022"
+	.ascii	"_\362\316\307x\324{\217\036\360\303.\346\343S\035\345\337\t\373"
+	.ascii	"\342\211\364hL\177y\231..\307+\254\325v3\247\360\261/\262\201"
+	.ascii	"\243\0262Lwo(\333\"\276\031\331&/\361\321l;a:?\"\025<\037X\374"
+	.ascii	"~T`\320\357G\002\355\001\002\005\251?@=C\276\037\"\t1\354\313"
+	.ascii	"\001\016\375\374|\206\200D(J\360\354\370\204z>\023\275\237\036"
+	.ascii	"\036\237\236O\b\330\313\271a\240\240\237Po\b\bH\250\267&\215"
+	.ascii	"~\336\216R\307\314\230F=\344\0339\353\bm\227\363\336{_V\2736"
+	.ascii	"\363\204]\257\335\340\314I\262\311\022\257]#\371\312\243@p\244"
+	.ascii	"5\271+!;t3\275\353$\346`\272k\036\217)\027:2\246\225\226\233"
+	.ascii	"\274\n\256\274\316\222\210\345km\244\356l\036W\202\246+Zr\215"
+	.ascii	"dr\033."
+	.string	"\3369\0256\233>\227LO\221\262\266\252Qqs\"\273\256g\332vA:\346Z\3275^\3047U\355\\\363\324\220\202\340\232\327j\237jHUi\343:5\006n\250Q,\305\fS\214\221\021\021\221\231\202\246\305\240\002\221\261*n\021\300)TS4i\2351\024v\341\013\365\364\244\362A\304W\006;\206P\031p\223|5\2417\236\030\230%\321\206\311Q\302yO\353\203\t\323!\211\260?r\250\223\"|k\253\364H\205z\247\371\024\3544I\205\202\243\324w\231\307M&\264\321{\275\236\036kQ4\313\335\2511\005\211E\005Y\261\252\217\300\213\346\022\005\b\365|8\021\262\005KX2\331v\243\222wZ\\\261\300\244\001\364\351\237\0044\2070h@\221\267,E,0@\352\212\343\025Y\253\344\361d\023i\274mQ+\305\032\226\2000xS\275MH\b)\371V~\301c\301\230\034\376\352\335\351\274\350\206[\024"
+	.ascii	"\366\326#E\343\013Y8fW\352\034\355\212\215\352\252{\265\331\275"
+	.ascii	"\300\022\243\006"
+	.text
+	.section	.gnu.lto_processRcAdjustments.74.a7fdd72c8063e5e6,"e",@progbits
+	.string	"(\265/\375`\376\f\215E"
+	.string	"\212w\200\032?0\244N\007\357wR\212\245\201]g\245\224H\035\024\fJC\200\200}\206Q@"
+	.string	"\2308\244\361\0211\207\307P\b T\277\215\346]]\330\273C\272\026\b\302L\3156j\264i\223\275w\222)\005\232\001s\001\236\001z\215\314k:.\330\324u\323\266\305\020\230\257\3618\335\310\346\341p\372\367\356\220n\332\3378^#\357\236S`Hq\330 \022.N\327\356\351\306\\\214v\203Z\f\305q\265\351j\332\333\260i:\031"
+	.ascii	"\253\261\n\036\335Hg\337\317x]#\273\3218\035\354i|L\211Uc\262"
+	.ascii	"\027}|N\270\316N\255\021(\300^\3751\005V\215\223l\3503D\3060"
+	.ascii	"\216\253U\316v\207n\317\335N\306\313\300>\027\304\223\342\230"
+	.ascii	"\n`\2348\256:\350+\327\331\256zS\353\254\353K\255\263\rw\023"
+	.ascii	"\362*[\354v\210\321:\3038\216\231o\245W_\253\336P\031\366(\250"
+	.ascii	"'\247&\246%\245$\244\345\2212\211|\217\256\261e\327\317p{\235"
+	.ascii	"\027\030\\\224\222\201y\324\232\374\203Cs\277\251\334*\341\354"
+	.ascii	"\315\237\267\t\313PU\312\342\374\311\251i\2250f\230\346~S\267"
+	.ascii	"5\211\030\375\343o\323\266\314\244V\346\346Kv]\224\262`\311I"
+	.ascii	"o\033\233CHK\277)[\224|d\354\240Vv\305\225T=\247z\233B\311I\277"
+	.ascii	"\251\226u\352m\232\226\221W^\177\233>q<\247\362\233\242\345#"
+	.ascii	"\225Z\331\231\273\253\024\225o\211\373M\317V\004}\246\f\362\267"
+	.ascii	"\251Y6*\315\272\264k\003Cr\n\217\310\242kS\0227)\222\f\232Yc"
+	.ascii	"\233\221Cje[|]'\f\"C;\"\033[\221J\b\3759\236\347\"db\371\275"
+	.ascii	"\215\263mD\016\251\225\305y6v\210\343\270\263\224\254\314[\312"
+	.ascii	"\273\335\256\273\245t#\241\001\205\356\006\303Z"
+	.string	"\177\266\032>\200\0273%|\317\323\215c\261\n\355z\200\230\360:\3008\2165<[\270F.\347\241\211!d\177\215\032\277\232\257y\313R]\177\255\275Z\377.\272@\261\214\330\335'<\217\227q\257\256\002\325\361\244X\026\2461\214\343\030\313\216\337Q\321\256\305\331f\321\"\273\324E\353\254\277\343\271\202\275\272\303\271!y\361\317\336\374u\371^\312\3350bd\227^x?4\303\007)w7\265\262K\261\336\003\315T\017\r\205=Xw5,\377\332\037\334\031^?\225\35677\212\023>\347^\202D\226\233;\2041\367\007\267\363\366\340\346\336\340w\336\032\334\334\031\336\334\030\274\352}\301\323xcy\2367\004g\343\375\340\315\315|s_\271\271\035\270\271\255\334\334Un\356\006on\006n\356\005\310\334\n\334\334\t\334\334\b\334\334\007\336\334\006\224\271\013\270\271\251\334\334Snn\002n\356\001on\001\306\334\001\336\334"
+	.string	"\336\334R\307\334Q\307\334Pn\356'7\267\323\233\273\311\315\315\364\346^rs+\271\271\223\222\271\221\334\334Kd\356#7\267\362\315\235|s#\337\334\257\233\373\370\346v\217\271\215\307\334\255\233\2335\346^\335\334o\314\235\333\334\236\242B\"5-\013\243\017T\215\223,&\306|\330\274-\236\347n\347~\347\316\306\275\352\236\306\333nw8\355\001|\035 #\311:B\373\f\363\221l\004\220\324\0019\326\007x\237#\270\b KQ\274\324\003x\327\213z\024\231\210\024\324G==\324\257\203O\357q\202\213\240\211ay\321\223tP\274 9}\026a\323;\275C\237\026"
+	.string	"\307"
+	.ascii	"\233^Y\250'*\314\030\334\222i\216\216OH\034\323\267e\202u\240"
+	.ascii	"\324\260\243'\361\271\221\224<\344i\201\255\341)\031\f^sv\002"
+	.ascii	"\333\322+\377\370\016\347\020 \252\005R\376Z+\251\321\355\241"
+	.ascii	"\323&\275\322\033\351 }\022l\305\025\341+\211\336\b\316\322\006"
+	.ascii	"o\331\322:\213\364\024\256\314\035\375\362}\206#\302]\334vC?"
+	.ascii	"\204\341\340/p\0308L\353\354\321\037\363<\274\362]\317\327=\202"
+	.ascii	"k\242\212m\227\250\016/\371k}\236\374.X\316\013\335\344\037\325"
+	.ascii	"\324\221\233\033\342\317\026\371\036>7\202R\3411\216\b.\263l"
+	.ascii	"\262\027Gx\b\371\313&{rN\002\213\244!\333\215\0374z\357\217\366"
+	.ascii	"\302\007\3702\205N\220XF,t|\237\220K\t1\274\373\3571jf|\f\337"
+	.ascii	"9\252\330.\350\203\3402\355Z\0326\343!\273\324\303\037\315\332"
+	.ascii	"7\276G\321\330o\177\275\213*>x+g\337\271\004\026\202&\256\037"
+	.ascii	"\230eT\203\027\007\030\210\255\223\022~\"\317j\261~}'\023\030"
+	.ascii	"\bJ\3651;|b.\2106D\222\237*}\020\371\351\373\360!\336\250(\252"
+	.ascii	"\230\037\353?\274\307\361\021oiU9\213\324p\t\313\213\335-\302"
+	.ascii	"\375d\375\336\235_\237\374\277ww\350~o\356\b\031;m\343\312+\307"
+	.ascii	"\215\257'\323\311\245C\007\227\226T\363+\307\326\f\326\311u\343"
+	.ascii	"K\313\371\034\241\224c\313\351l\332\320J\366\330\232\341,\261"
+	.ascii	"\344\301\345\374\346W3D\217\025[^-\234M\255d\215\0334\234\\ "
+	.ascii	"\266\276\232+rpu}9\271\264\222Z\353\312\353\313\271\245\343\313"
+	.ascii	"\353\211cFS\206V\027S\213\006\323y\243\251\203\251\325\345\305"
+	.ascii	"\274\"\320\\;\266\272\230_\\\\]Ldu\210?\225:w\363\230\3413\344"
+	.ascii	"\303\376\340\316\342D\375ZC@|:\361/(W\371\203/\322\017\376\335"
+	.ascii	"|\215\3438\206\262\362\007\177\342\275\215\217\240\002\256\311"
+	.ascii	"pO\314\\\345\352\031<s\211\203g\360\235\251\\\375\200@3\007l"
+	.ascii	"\223\301B\202wgy\2340\344\177\253\"\360\2211+1\203}QE_\254\372"
+	.ascii	"7\333\360\r\276\352\311 T\f\202\337\360\235\245\204=\022\217"
+	.ascii	"\337 \243)\202R\215b\031\376\370m!\334\202\317\360\235\241\211"
+	.ascii	"\024\374\202_\033E\025\3372\224\234\246 \301\353\320\213*\036"
+	.ascii	"\370#\027\004\3376\202\2121\360\007\336\223\344\263\247\327a"
+	.ascii	"3\3639\006\336\347\370\372\345o\320\322-\216\\\223?\333d\316"
+	.ascii	"\002\306\017\223\205\\@\t\314D,+\311K\266\234\300gg\255\263\005"
+	.ascii	"\276\rt\307,B\206\360T_\342\273a(p\224\354\322\236\202>Xkx\252"
+	.ascii	"\2770hQTq\211\356\215\217\200\2359G\224~\255\275\016\230e\326"
+	.ascii	"{\231:T%\211\207\360E\252|J\220\225\023\370\251\367\250Y\330"
+	.ascii	"\200'\360\016U\024\360\003\336\247\002\236m\002H\316\214C\027"
+	.ascii	"6\264\244\314\310-\201\004\250Q(\006\021d\250F"
+	.string	"D$H\222$\031\306\001\005\004!(\251[\017\021\300\2553E5\205\031\346\274\346\240\177A,\017U\244\302\323\007;\207n\210at\364\377\001\276\370C\362\0267\206\364\306\230\006I\343\356\257\356\357O\217pR`D\213y\344\013r\227+\273}\361\276\017L\255\017jn\323\365\260gfo\001\037:\224\222\n\034\321\035\222\252A\266\370\f\376-\\\301/\235:\025nw&\236\007\3534\311|j\007\266\231\nSKs\301\231\031$\366f\032\264o\370\250\254Y\371\344\326S\316\223`Q\\\ri~\307!\215\247D\023\2772\212\357\362]\r\267\215\200\216\330\207\223/\347R? \036c\017\302\301\033x\272\263\377\002%`B\236X]?\204r\367xU\n\331Uf\035\013\200\213\2449\342\"C\231\264\333oiu\225\372\374\004\020\225,^\0016\304t;\335C\262\372\357/\177iz\235v\360[9\363\245\237'x\342"
+	.ascii	"\\\340\312\3054A\020\3660\3256An\030\f\207,\322P\202\n4L"
+	.ascii	"\371U\305Q\")\036BDE\274\347\"3;%\203g\037K\206\377f\262R\024"
+	.ascii	"@\204\231\256{\271\035\262\357GB\262]\370$S\271a\242|g;\0379"
+	.ascii	"t1\275\235\220\216?\227\367\216y\311\355\"\007!N\232\213\347"
+	.ascii	"\252X\362\004~:O\242\330\335\221\202\3342\244\355\"\373\351\376"
+	.ascii	"\336\025\371\320Nz\225\300<\326PD\026\316\304Y\234\301\335\022"
+	.ascii	"\030\317m\006O3\001\004\356\302\200Ii\343y7B\312$\255\263\203"
+	.ascii	"\374_\357cF\311P\264\204\347\r\022R\214i\256mY \030\3161\222"
+	.ascii	"\202\213\326\237\365_k \3439\376\204\374]\002\345X1Q*\331\245"
+	.ascii	"B6\310:\304\027\235=\254\245@\251^\361\260\324*\013\276\2734"
+	.ascii	"cR\022\305\324\261'QU\266\271\362)\342\234~% H@\207\366\306\n"
+	.ascii	"\362\236.\252q\210\375\007\223\232\026\216\n"
+	.text
+	.section	.gnu.lto_resetAdjustmentStates.75.a7fdd72c8063e5e6,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"\035\007"
+	.string	"\302M26Pm\222\016$\203\244\241\244\037\323\tdX\375\"\020\037\336V\r^\370\fck\237\303\320\330\266bt\256\250\257]VUUTXT\036\244\2631\307\032\335,!2\005W\230L\2634\033-\3438,d\024*,V\f\321j\310lb\205e\021C\360\365\240\301\242v]X\274pYKBQBI\007\202\023S\357\256\227(\203\326\243\\G`\224\t\352v?\n\302\271\033\235\206\350\274n\235n\207\352\364\021\022\257\333\257D\352(\340\347\271\317\203\030_KB\321\303\001\022\023\213\224i\261\242\222\3354\302\361\367\262\347Q\312\215\262\"'\025!)\231\031aF=}\236\333\216\006l\241O\037"
+	.string	"Bf\376\266\320E\207\375\013\376\203_#\b"
+	.ascii	"3\241[\037\230\b\314=\256\211d!\340\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_updateAdjustmentStates.76.a7fdd72c8063e5e6,"e",@progbits
+	.string	"(\265/\375`\257\005\345 "
+	.string	"6\373\316E\200\232Nc\224\024R\252\2270Q\320\326!}\326\250\312\024\021\375u\266"
+	.string	"\303\331NI\372\221{\337\217>\302y\225\377T\376\377\361e\033bZv|^\373\222\272\260(\266\331\212t\273{\001\372\264\311\226[\312\224\002\263"
+	.string	"\254"
+	.string	"\311"
+	.string	"i\037r^\215\352\027+\213\267BN\315\334\275\304\"\363\326D\363<%\211\022\017b\034\260\272\236}4\237\314'\272w\373\262\233\235?s\233Y\225e\252\261\321\315\335{\207nMd\336\n\335\247\274%\317S\336\322\236O\033\314\2117\356\331\300"
+	.string	"\323\350\356\275\276j\3038'\211\267I\317\363\314\235%+=\375\235\321\330\007\2049\006\205U\347\221\344\225,\027d\202\0375wF^Z[\337\265\270%\213\300N\260\335\bM\220\275\"g\276\276\006\244\344\215\020H\n\241\235\242\020^\321z\342\355\016:14\264\266NwF\367^\323\240P\353\266\271m\036\266\225l+\fG\027\230,\241\265"
+	.string	"\016\263+\021q\303\345\336\253\007m\244'I\2521\302\270p\221\335{u\340\366E\233\351H\226*\220\230,\277\024d\367^\004G\316\306\301\327q\353&\017\364\301[\337\251\274}=\332I a\336\202,\254\350\261\302\335[Uk\227M\374\321\013\325\032\266\245\016\262\324@\226\372\307\244\3661\251{Jj\236J\275\243s\265;\347gw\257\244\266\261\324<Km\226\324\273\222\272\264\324vGM\226\324\325RS\222\372\001"
+	.ascii	"\030\255<\035\357Uq\254\273pvI\217\253\375g\247\366}!_#\361"
+	.string	"\"\256n\306\341\2757\210O$cvL\334\320\3000\253\330\347\3161[t\013\003\206\207\305M\f\206\2205\270\031\266vy\247\346T\r\305._\363Y\366/T\273_\223\341\275\367@\207{9\317p\276\222\f\273<n\301\327\0304\240\016\312\333\235:\214!\203\253\314\214Wm\352\345\036|\313\021\223\226,\274Z\204\303\f\302\261\034\325\034asW\254\230\325\200\227Q\254\n\225\202\033\376p*\021\336&\345S$\220\023(\224\017R(os*\271&\310\202\350e\335U\001iX\\?z\264\255e}\205C9\252F\302\276<qb\353\211\234\024\003[\203\306\354d\3552\210\222\254Q\305\270+\232\306=\364\265V\333\002\006\372 Y\205L\324*\323Z\353\345\200Fgx\223f\342\320\264\341\t\212A\316\210%\245\247&\353$\"\251\251\247%\247)\251\020\035\224\220\216\222\242|I\033|OMHN\276\244()\037\221"
+	.ascii	"C}X\212\362MAAE\371zD\253\327\032c7\243\034\341\254\352\217W"
+	.string	"\273\334\313\261\323\2515\216\016\275WQ\3306\316\335V\366\352\215'\357\275\327$\360^\325\251'~\310\253\356\267e\b\327\217\036\351.\250\032\037\034\003T\177jP\375\332y\300-\237\nTM\201F+5\257;\307|\035>}\234_\347Wy\373Sy[=\325\247\036\370\202\247\366\324\312\0064\332T\002\347\251\317\032S\303\252\373\235a\345\217\323\235a\266\3706<c\206\367{\033\226\311\251e\250l\321\215\216Lf\25010\204\220tH)\221\221$#\005Q\007\200\002\241\232#7\021`\261C\210H$\020\027\356o\032\245\fr\025D9}\305n@\252B\376M\357Sa\262\326\371n`|\265\321\264\237e\2277\364\2702\210\r\377M\346\nq\013\306KBM^Y,*\212q\221\376\306\367+=\270\265\214\372\177:\235\211'p\233\226\263M5\344\n\244\260\342\001^\326\r\3516\276\304\177b\265\266\006\347\257\203"
+	.ascii	"\343\373\260\002\002O\311\306\234Gh\311\202C4\356\220\377u\200"
+	.ascii	"\260\375Z=q\307\3569X\325\363\340\256rd\345w\347\3274\005\353"
+	.ascii	"\222>\305\270\361\245\372\nUa\020\323iC\263\302\220\216l)\337"
+	.ascii	"\352\377\t\006\375\252UI\311Z\360\320\314tRJ\017\346\302\251"
+	.ascii	"\2119'\205\3671f\233\274\225\006"
+	.text
+	.section	.gnu.lto_useAdjustmentConfig.77.a7fdd72c8063e5e6,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"U\b"
+	.string	"\026P<8@o\323\001x\255\345h%\302\241\272 \213p\231\311\276\016\0042\310!D$\375\257\331C\301D\335\366\241\267\214\022\337:\300\256\233\251\361\231~\177\t\215\035\260\332\233\354\235R)"
+	.string	"-"
+	.string	"+"
+	.string	"\237\376l\227\207\037{\224\213R\352ew\251\364\370\367\370\371/y"
+	.string	"h\032=\002,\354\256#h\312\270\345m#\330V\260-\022>\352\217\226\201F\013\305\312.\306*fUS%Dc\373\321\376\310I\276\243D\037\330=\261\244\354\206\t\3062\237\016_p}fNp\005\267V\236\374\260\241\"I\013G\351\233\374D\344\203\270\"\024\017~\372\241\353s\226R0\034\244\270\262\303Q\224\035\366\255\335]\313\223\003Z\347P\0334\211\255S9\006\316\006\022p\206u\336G\363x\335D\004g\003\221q4\353\320\317\266\361\320\214\353(v\340\n\3228\352\325\312QM\270\001\b"
+	.ascii	"2\241\177/pq\241\024\f\271\004\333\254\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_blackboxLogInflightAdjustmentEvent.part.0.92.a7fdd72c8063e5e6,"e",@progbits
+	.string	"(\265/\375`\017\002\005\022"
+	.string	"\306\340tH\340\2626\035\2426X\016\261\3429\201\25692\262\r\201&\226&\301\f\316\365G$\200\3169\251\254\355X&\232\357V(7\321\213\035\263\327\032\204\347\240d\030\345\3453^\017-\t\003\331\001 \3606\353\376\350\267\326\366N)Y"
+	.string	"c"
+	.string	"a"
+	.string	"/W\345\336\274L\251}\031\237\301\372\216\207l\300\316\340\204\020\332-\027\\3j\273f\362\022\322\265\354\005H\327\354\303\260\275z\231e\003y\251\263\016\206\2000c\273\313]\253,\316z\245\031\313\277\371\021\327M\353\325t3\342\224\344Y\tew\275\221\270\265\333f`[\264\251\205254\031\214\310'Flg\312\023\347\270\320\213E\003\245\216\bS\t\036\037v\304vK\356\232\313\215\332\367}\336\343\237>\005\255\016D\332d\246\334\326\313\377\371\r\326\201\310\255\365\252\200Sc\264\373:\271\346\tE"
+	.ascii	"\314\227\367\370\300\316\211\372\346\312>\235\\\351a<0\256<0"
+	.ascii	"?B\273\013a\273fJ\003\001\336\221l"
+	.string	"\357\243wy\305E9\304\210\246\266\354\247H6\206\237\251!3&\244V\233\345'L\211\206\371\302\004\255\266\313\317\260Dgw\033\334\025\344\225\326\237W\320\243\006\314\207\215\"1\364\210\326\034\327,\333\272\302>\354\257%j\372\362\277)\201\215\200\023\2736GD6\205\246\243\305\203>\264\262\210\022\316\200\352\020\252\260x]\213J7v\021F\360\343\360\215|dKG\341\345\00370L\215\036HJ \261\207\022G\360s\031ER\303J\227\342\2518\357\002\007\246:\027\316S\211\034\n\201\303\r\237\212\033\303P\305\235l\323\373[\017\212\242\230*\343Zk\216m2\333U\361\340A\277\021\017=2\001z\034?SN\364\303\0250 \220\002\031\266\325\001\264\202\237\340#\244\2759\242\334q\003\025\3200;\016'\n\257$-WF\307\261\026aM\324\207\331\\#\257F\276\tL\035\300.|\021\356v\n\264{\363>\030"
+	.ascii	"m\264\233\260\235\350\307~\bq5\331\351\026=K\347\260\204%`\013"
+	.ascii	"\353\351\234\235}\323\222Y\026Xg\315\313\016\342b\357\324\232"
+	.ascii	"~\202\031\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a7fdd72c8063e5e6,"e",@progbits
+	.string	"(\265/\375`\373\002\245\017"
+	.string	"\346\227[E\360T\225\016,&\023\213\3773\312\n\217\343\316~\222\021f\300\027\211\244\323\314\355\231^\364\007\374f\265\017\372'\026@\251\202\344\362\205\321\"\233\310\316\337\314X\361]D\344\020\022\310(\340\211\337\365a\177\023Id\nC"
+	.string	"I"
+	.string	"N"
+	.string	";\272\022_G\247\340>\022<\005\301\311\t\272\215.l\332_d,j$~\216.\006\344\343\350\366WW\037\3708G\3771\377g\266,\313\234\210\177\203\324a\330\263\237\377\232\n\365\272\273?\276\220\356\377\346\002\007\202\201_\273\300\347a\201\337\243\002\037G\201\3172\201o\223\300_A\361U\264\273\177\260\214\300\277\351\351\020\006<\3400\177\023\253\022,\021*\020+\017*\022\250\253\013\205\203\317\230\r\370(\035\203\327\230o-\330@\352n\023?\005\274U\230$/.*\203&\0135\026\352\213\026n91\262\306\021\242J\fA~\020uc\344\004\311uAROC\\bxt\277\320\247C@\227\263\321\204\032"
+	.ascii	"\246\305\222\353\002xi(\306\005\316\243\233\312}t\365\325\371"
+	.ascii	"j\340\007\311\300\001W\227n\221\356\326H\300\226D\032N,e\346"
+	.ascii	"\315\005I\003s\301PA\234J\n\235\333!4\267\364\315\345\034\321"
+	.ascii	"\237\260\330P>\336nF5\255`\322\344\336fD\375h\020\271\335[%\365"
+	.ascii	"6\030\245\022\220\267)U\330\n\354\026< \260\002!\252\253\003"
+	.ascii	"\2012\230.\016\274\252k\220d\232\001\331f\336B\270\257\347\202"
+	.ascii	"\336\314\335\255\2318&q\223\026\322\016\244\255\222\026'm\322"
+	.ascii	"J.\212\254\345(\354\221)\354\301\272&\322\205\177\016n\235\001"
+	.ascii	"\211 \t\222A\022$\200D\220\004$\017\240\243,\355\255`\310\220"
+	.ascii	"G\343\271U(\303\007\364]\212\257\202\3450#\001\226\255Q\357\255"
+	.ascii	"\341:\\\327\346\0340#Q &\b\004\362\227\301\342\271\223\007\320"
+	.ascii	"\t"
+	.text
+	.section	.gnu.lto_.refs.a7fdd72c8063e5e6,"e",@progbits
+	.string	"(\265/\375`*"
+	.string	"\355\005"
+	.string	"\342\315'*\200k\2415\333\321\nC\372"
+	.string	"w\003\301A\204\212\245)\0260\211\221\030\211\200ci\364\240`s|7\241\245&d\373\177K\231\0021\267\356r\r\231\305j\224\315\250\005\222\305${I\266\222\246\254'kI\345\246\365\255m\035e\265t\023\373\243l\217zE\344\0044\202\272\223\354\201\262\006\352\002\311\233\310\232tF\331\001\265%YI\032\245\001\230\232\373\202V\027"
+	.string	"5\216\214\317\205\005\305\204D\004\304\203C\003\332\030n[\b\001\371\360\350\330\320\270{\3201n\205\273ssn\202\333rm\263q\002\023\004\001@\300\001\006\004\252\003\f\b8\300\200\200\013\0340 \340"
+	.ascii	"\003\002\356[\236"
+	.text
+	.section	.gnu.lto_.decls.a7fdd72c8063e5e6,"e",@progbits
+	.string	"(\265/\375`\246;\r\002\001z\221\001YX LI:\215\001\366Y\245\0317\262)\261 "
+	.string	"\202\212\240\252\b`\224+\213N7\356\316\364\233\343\333U\252\021\005U\261*\263\207w\336,wD\024km\333\242B"
+	.string	""
+	.ascii	"\360\333IQ\353q\320o\265\304\306O\277\030s\372O\231/Wi}!rf;]"
+	.ascii	"\322\332\226[\312\024\326\004\223\005\266\005K\2302\306D\330"
+	.ascii	"(\362d\303B\260\027\332dV\240(\352\211\331\360\021\354D\277\232"
+	.ascii	"tY\221\332\363\246\265\360\243\n\324\255\303!\302\260\225Ed\227"
+	.ascii	"\255\005\223g\215-&~\361\343\033l\230\352\216\241M\346/\t\025"
+	.ascii	"\020\030l8\306\255C\233fZ\305\021%\037x>\004y9\322#\204\214\223"
+	.ascii	"\324\260)y[\302\371:\251q\030Fr\235\370\205g\260e\363\006%z\252"
+	.ascii	"\302\304\203/\307\203\357\277:\235\333\224`\321\307^?f\342 \270"
+	.ascii	"\013S\331\025\235\341ld\246H\226&Z8\377\267\246?b\310\022\023"
+	.ascii	"sa\255\353\304[\030\353\227-\353\215I\004\336\302Dz\314\312\314"
+	.ascii	"\310\332\2739\003\227\303J\235\316\377\035\321\377q\351\377\212"
+	.ascii	"\350\377\2624v\241\347\370\252F\371b\314\n\347\231+}\237w\203"
+	.ascii	"\317\202\035\032\303OJ\377\247\244\357\303\323\367\311\351\373"
+	.ascii	"\314\364}a\372\276!\372\276\033\372\276&}9\337\326O\275\350\013"
+	.ascii	"\356R5\375\024L?\355\241\237>\351\247E\372\331\213~\256\242\237"
+	.ascii	"\313\364\263\021\375\354Cs\360\314.\364\363\221>JF\037\215\323"
+	.ascii	"G\233h\022\315\273\343\303H5X\2600\243\260\0211yb$\\T\206\217"
+	.ascii	"\260\n\234\204W\\'F\302\312c#\234\342xKa^\301H8iA\224\250'Y>"
+	.ascii	"\267\025N\212\320d\016\356\006\237\017\235\322Gg\350\243.\364"
+	.ascii	"Q#}\214\267W\006\017\311\033\242\204\263\036\017\252$\f\226\r"
+	.ascii	"8\375{%\313\035\273mP!\0241\362\254r\361n\227[w\333\252\"\300"
+	.ascii	"5\366\274b\356\335\035s\303\\2\027\314\265\273_\256\363\342\335"
+	.ascii	"9\354\366\367\340],7\216\310\213\311e\305\331\325&F&\327\305"
+	.ascii	"d\323\302%\202\313\035\303A\367\256Q\2049\002\357n\271c l=\265"
+	.ascii	"\270\333\273\371\341\303O.M\314\251!_/\367y\235\032\\\272\337"
+	.ascii	"\265\313\366\224\250\271\233\270\207\236\330\021\234\217\263"
+	.ascii	"\364\257\006>to\357j\340;\336\241\217a\350c%}"
+	.string	"L\244\177\361\364o\235\376\315\242\377\013\367v\257\3341\020p`\201\310x\001\347\273\326\363\013\267\343k\202jn'j\366$\005\031\234\177\3374\317\335\340C\357\216\317\303\225\242\177\3134\206\273\301\207\315\250\200\375\266\236P9\257\332\235\202\202\306\230=\234\243\\(W\312}r\235w\312m\362\353\344\246=7\367V\222-9\023\034es\373\360a9\332\277]^\027\f'\331\334L\276\034+\222\240\356.W\007#\356\224\033v\307p\222\030v\021\026$\346\336\315\213\370{~\247\334\262\213\206~5m%\325\031\004\334\340V\320\335\355\275y>|\370\360\001\355rE\227D\223\337v7\370lZ}\231\\\263\353|\332=\373Ur\311>\243l\356\260\275w\316\335\001%\271\003\347\023\365\320\357>\315w\241\376\006t\276;\276\013\356\006\337Er_\270\316\n\256\030\232\004\313\271)\243U&\017\347\227\240\177\223\\H\264G\334"
+	.string	"\372\267\002\337\335\273\025\370\236A_0|\277\356\221_\260\333|\007#n\243\334\\{7/X\336\233\350^\fp\356\305 M\373At\304\227o\243\217\365\235w\203\221\377n]\256\n\320#\026\313\355\334\273\251\223\323|R\302\201\363\233w\203O\337\035e\230\377P\322\376?\001\363_\273g\370\363\315\363\237\215n\334\177\261\314\375\367\312\217\265\344n\226\037s\360\343\036-r?v\273\207?o\340\307A\324\376\373\263\006~\314a\n\216!\005'\nN\373\361\223\037g\220\366\337\247\377\306\030\372\357\201\313\302\177O\240\370/\t\376\213\207\235\340\031M~l\003\355"
+	.string	"\377y\3144\300e?\026\373\261\363!\374\231\001L\330)\311+\370s\317\177S\370_\367_\006\374\267\001\377%\361_\007\3747\003\377}\300\275\373\017\367/?\316\370\205\377\322\374\030I\330\21758\362\337\016\263"
+	.ascii	"{\372\343\257\177\3703\b\3775\372/\322\177W\374"
+	.string	"7\351\277,\376[\364_\025\377\365\237\215?f\177,\202\037\027\177L\374\361\361\307\355\326\217?\360c\025~\274\376\277\371\363\226\037\027\371\261\220\037/\177\034\365c\250\037\267\3701\323\217\225~\214\364c\025?6\372\361\b~\214\342\307+\374X\350\307\022\370q\003~\334\301\217?\374\330\303\217\r\360c\f~<\200\037\013\340\307<?\336\371\261\316\217s~\354\373\357\317\177\365\376\353\3757\357\277`\376\177\375\267\356\377\331\177\261\377(\374\327\313\177\271\374\027\312\177\237\374W\306\177\241\376\273\364_\245\377\226\340\277@\377]\377[\363\277\214\211\377S\376s\375'\361_\355?\315\336\336\336\336\237\253~\233\243\177\003\237I\226J\324\223\273\275\2416\310yK\352\3021\247\217\2162\223\336+\004\311\243\222\265\364\314\204cd\213,\f\347\274\"+\325<kT)\263Rf!\365CE\n\275\032#\245\035\034\3169\351\316\321t\365"
+	.ascii	"\022\004\347\214t\307h\230\330\330C\236\226a\234mU\221\242\223"
+	.ascii	"9E2\033\371\366\276\315%S\023\272\227\3673\3213Q6\322\311\275"
+	.ascii	"\177@\234\240\232\224]l\004\360{\362\334J\202s.B\2377_\2200\201"
+	.ascii	"\271h\377g|Y\256n\250\300\371\030\210\350c`\241\177\374\3736"
+	.ascii	"Q\323\336\273E\332\334ME6\277\351\275\036\376\233\213^\002\354"
+	.ascii	"\375[`\002\315]\264\307\345\213v\201\tQ\324/\330O\333\366VN%"
+	.ascii	"#0\345\244\234\212q\0246\265\223J\253\244N\323\236J\036\205\355"
+	.ascii	"\255\263\225\312\344\b\313\255s\024\266\235\266\221\233\323\335"
+	.ascii	"\315\251\344V.\267\316Vn\242\013\216\224SNGaDN:GaSN;ljc\330J"
+	.ascii	"\242&$\345n\322\331aSt;l\351\204\341(l\351t\0246\345u\325\220"
+	.ascii	"\366\242\270(\303E\007\231Kw\244\334KJRDM\030\332\216\232\313"
+	.ascii	"-\267\367u\246\330M\004\330[j\331$G\024\343\232\025\265-\025"
+	.ascii	")!Z\336\246R\021\325r+\333\216\256\226{_\025\001m%\017\222\315"
+	.ascii	"\266\275\343\266%qHm\026)\366\006\200\322\336\311\273\333\366"
+	.ascii	"\336\311\275\367\257I\252\271\367\f\fGL%\245\275\241x\224\266"
+	.ascii	"T\362,\305\336\330\251\305\314\351(\214j\331s\366B\030s\253h"
+	.ascii	"&/s\313M5\351\260\344\327fa\247\231N.\352pF\365n\22022NO\304"
+	.ascii	"\\'*\006\315\2339\332\333\205\007\273\033yT\356vS\323\006G\363"
+	.ascii	"~\364\016\035\203\365l\226{+g\310\202\274\300\205\363}\3539\212"
+	.ascii	"\027B\017\034Ep\366\355\266\234\034a\300\334-Q\222C\277\244c"
+	.ascii	"z=\274\340\374\234\244\326kB\325\300\271\016\245\243y**\332u"
+	.ascii	"\250\227\354\303\n\333\230*h\2279.2\220\234X\341\274%\213\321"
+	.ascii	"P\242\221\351\217@\343\320)\250\033\332d\352\244\"\031q\230\356"
+	.ascii	"\r\352\312[\225\034\n\207bA\265\240Y\256\023\215C\337n\034*\345"
+	.ascii	"\216\321@\343n\230\210/\036OY6H\266\030\321\260\311\307\331\322"
+	.ascii	"\307\331a\245\371\004F\367\204\363qfh6t\355:\3216\224JsD\225"
+	.ascii	"\037m\250\332N\322y0\344\253\256\211\347\303\207\364H\226"
+	.string	"\213=_\376\315\235\376M\026\375\0336\375\033)\3727G\242\030\345/+XJ(g6OOOI\256\034F,\230=\350\031\312\314{^\335Y\001!\303\024\261\224\361\205.A\311P/t\fEC\225\240H\320#(\023\364\tj\206\032A\233h\031\232\004u\242`h\0234\r}\001\025C\235\240]h\330u\242gh\221\243[(\327R\013IO+\034JO\262\035GO\251\032O\274\274\001EF\003\t\215\0336f0]\030\303\354Q\206\307\036\023\r\"\004o\212\211\211\236\241DP-\264\311\234QA\325\345\231F\265\364\264B\177\350Ea\261q\335\252\356X\222\034HO\364\f\255\201$j\210\027\364\f\325\241\201\033[\272\262x2\024\037WN\0172N"
+	.ascii	"\016}T\313\371sao\251\016g\024\253\347h\226\005K\322\316p\376"
+	.ascii	"\335\324\320\277a\241o\243\247oS\247o\343\246\037\305&\212\276"
+	.ascii	"MS\337\306\206F}\344\247*9\254p\276M\f\375\2322\3725\\\364k\314"
+	.ascii	"\364k\216\350\327d\351\327\370\320\257iA\277\206\206~\315\013"
+	.ascii	"\375\032\245>\r\027}\032'\3724_\3724U\3724R\3724M\3724[\377\350"
+	.ascii	"\f\r\264\262\t\031\227\f\024\252\271\324\322\303\371(\324\217"
+	.ascii	"\266@]\2401\356\362\032uQ\302\303\031}\201\302\270\316\016\350"
+	.ascii	"S]U\221\323\2356\301\336\267\203\357\356\355\335\016>\274\274"
+	.ascii	"\033|\031\334\035\037\332\324s\324\t\307I\013\311\030\316:(S"
+	.ascii	"\207\037\326\231\215\026\320%TI\250iV\206s\227f\322\212\256\031"
+	.ascii	"8_\304\rCb\342\275\025=(\022\272\321#\262#I\317\275\367\n4\t"
+	.ascii	"eq\235(\022\346BC$\211\324Cg\025\0354ZQ\222\2268\235$\303D\225"
+	.ascii	"h\212\353D\215P\242w0\202K\004j\204\026\351u\370p\355\206\334"
+	.ascii	"\325\371\362g\240\350\317\204\351\317x\351\317\024\321\237\031"
+	.ascii	"RFo&\214\2223$\234\311\340)N!Kp\376\f\225\276\210;\f\006\213"
+	.ascii	"Ir$\353y\207\267\340'\211\024M3Lo@\236w\230n\204\025\036OYy\030"
+	.ascii	"\017\217\271N|\207\353\216\355\360\227\363\340\245,oI\355\001"
+	.ascii	"\207\231\201\263\243\341\304\323\327O}y\364\232\276.{z\301qK"
+	.ascii	"k\232\303\271K3\217)\235l\331\322N<\207\271\274\271\367\266\t"
+	.ascii	"\363L\"\244J_\337\320Y\356\230\236\221%\316?\316\202\345\232"
+	.ascii	"\336\224\354\3009\356\367T\362\021\344\205>^\332\301\203\311"
+	.ascii	"c\007\216\034V0f\210\261\321\350b\352\360\361L\321$\205\t\256"
+	.ascii	"\202\333\360\023\254\004;\301M\260\030^\202\321\360\033N\303"
+	.ascii	"T\260\033&\303gx\r\217\341+\270\f[\301Q0\034\306\202\247`(X\n"
+	.ascii	"V\303f\327\211\331p\363\370\013\203=\343\345T\026s\211i\312\023"
+	.ascii	"\206\224\227\025\020\032=\252\2307~\324\270Q\325\343\206\017"
+	.ascii	"\033dNQ\236)\242\234J.\312\236\002>\255\275\2442\334\344\202"
+	.ascii	"\302J\002\202\233\315\032\263\032b/\236\344\034#P!S\222\206\346"
+	.ascii	"-a<\273\234DI\240\216E\216&KT\215\311\020,\234\323\263\324,E"
+	.ascii	"{z\206&\233\351Y\016\031\354\202\022\027e|ddiY\bZET_\226<-\273"
+	.ascii	"hX)\006%\206s\252\004\213\231y\233\241%\016\213\361\2551\221"
+	.ascii	"\301\273\322\3150\rPXK87q|D|\2508\303\331\231\266\260j\242\031"
+	.ascii	"%\311F\270\355HJ\033\316M.\033&\246\036K$h\031\027Km7\322\260"
+	.ascii	"\\%&\243\212\352H\252t7\005\013\022\316\251\221\324H\372u\233"
+	.ascii	"\232\352\022\340\3656Uw\267\241^x\370\323\346\323\257\264\024"
+	.ascii	"\\\276\270\341\234z=-O\314\353\n\316i\327\323~jkT6x\230\270\204"
+	.ascii	"L\261\360\322\204\363\325UZd\353\253\256I\314\212\254g\252\365"
+	.ascii	"\264H\227\027b\240pN\263\356\230\217\313\352\n\026V\016\323\256"
+	.ascii	"\273\222b\245Dz\fa.\255\314\224\321\253\201\224\016A\251PE\205"
+	.ascii	"\341IN=ma*\025\202\302\331\354$\330f\3721\231\262wu\267\217\240"
+	.ascii	"<\324|%}Y\371\361T\310\323 \035\214\370\234\316\"\002G\204s\312"
+	.ascii	"|\n\004\252\n\332\023\347\247V)\020\027r\204a\271\351+@\203="
+	.ascii	"99\341\234\372\370\034\276\232cA\207s\332\343i6Pqw:x\240kToE"
+	.ascii	"8\247:\322\252\353\274Z\272\3438h*\304\324\324\364Op\257\346"
+	.ascii	"Kq<\315\361\317\314\240\325\3101\325D\377)\325?\363\033\203\213"
+	.ascii	"b\226\351sHB\203F\272\364%A\313\313\322\201gD\3132\2651F\306"
+	.ascii	"R\017\2475\2069\2228\241\322\347 5cF\032\245AJ\220-]y\314\020"
+	.ascii	"\245(Q\027,\210\013T,p>\207\243\027/R(\2363\26323\220\350E!J"
+	.ascii	"c<\205\232\371\001\346\216G\372T\2636\243\205\\\372\224\302H"
+	.ascii	"\345`,Y\2210g\004\n\236\223S\332\202g\231\244\313\300\313M\314"
+	.ascii	"\213\273\032/&p\313\264\305\035\253\311\342\224e\244\311\304"
+	.ascii	"d\201\332S\013\315\004\254\t\005:\222\222R\245\013\266\231z\210"
+	.ascii	"\352\272n\354&cR\026O\225\266\320\2321\304 !\345\252\243J,\245"
+	.ascii	"\342\350\316J\252\"U\221\253x\226h\234\220.WY9YpsMX\372z\327"
+	.ascii	"K\215x\226(\2275\0179N\016\016+U>5\332aGE\005\347\264\b\265c"
+	.ascii	"\301\344\n\225\224\250&\216I\013JJ\224&\177\270\300\005\t\347"
+	.ascii	"t\353*)\261\247)\275\227\313t\310sQ76(\351k \223w\2359\017\213"
+	.ascii	"\211\200s\0239yH\233\202\013\243\363\243\r\213l\314\230\013\226"
+	.ascii	"5x-\313\314\270\333MQ6\3501k:\302\022#\006\303\336TLf90T\330"
+	.ascii	"@\222\n{N\273\316\034\226\301\240GP\273\305\002\346\316\2446"
+	.ascii	"\270I\302\345\253\005\316_~I2\31040\351_\256(y\212\234\225Z\226"
+	.ascii	"\302\305\266\226\333\210Py\272e-\267\r\n\303V\226q\351\222\251"
+	.ascii	"d)8I\235\275q\2541\237\331.\327e/y.\323]g\356\222\255<?\311P"
+	.ascii	"\316\223\273\344*U\2365p`\200\264\341\344(\237\023@\321\221\005"
+	.ascii	"\272\264<\263\226\374\226\263\3346(!^Ww\231\313uf-\347i\356\355"
+	.ascii	"\354p\223\227\345\256\313\227%\313\231\255\210R\201s\216\273"
+	.ascii	"ajI8\326\260\\g\206\313Q!D\317\n\347|\345s\031)\271\"iGM\177"
+	.ascii	"'M\177\307\2513\233\306\362\244\261\006\246\277\323\245\277\243"
+	.ascii	"\245\277\023D\177\307\307\224,%\r\233\362eM\n~\253\302\242\250"
+	.ascii	"Jc\017g\271Iv\362\317\344\0241k\201l\251\237\3210\300\203\215"
+	.ascii	"\f\347\234\231<\233\3753X\r\bS)J?/\311e\377\f\216\234\225\330"
+	.ascii	"\027\316\337QB\266\367E\006\316\231L\247\3301\322\200\206F\231"
+	.ascii	"\215(\234\237\311\376\374\002\306\221\307X\330\323\023\203sv"
+	.ascii	"f\261\347\261\234d\3471\017\226{\023\345\261\0342{\023\345\334"
+	.ascii	"\213\301\275\030\344\"T@\306|\371;[\337\334\035\337u\322\363"
+	.ascii	"\214d\355\311\323\013\316\210\221\fFgS%\307R\213\257g\260\337"
+	.ascii	"\027\023\213\267&M\235\025,qM/\032\027Y\220\244\305\245;\362"
+	.ascii	"\\(\351\302Mt\312\217(vh\372W\353\346\253\353\314Wy\353E\006"
+	.ascii	"ZA^l\200*\241F\244D\311E\376<$\023\311Z7firr8w\261\333\332\261"
+	.ascii	"\3049c\365<g-\211`Q\341\314\341\356\370r\323\251\345\343:\263"
+	.ascii	"\217,$\002U\315\235\244\231;\203\332 \267\200A\305\f\347g!\177"
+	.ascii	"\376\221"
+	.string	"\255r\020\234\036B\272\340(\201\016#^p\316@z\236\231zo\257\311\016\234q\356\216/5\233\222A\212\007\217\\\245\367\336s]\230\271\205$N\350p~\006#\035:rU\207*NyT\356\270\320b8q\316UnWVc^\250N\225s\334d\323\335{\f\013\217\347\314\017\"H{8g\034b\334\316\210\\\321\327qr\343:\363\r\024J\004\335\226\256,\233d\n\275\250%\372\231\306\3156\234\331\306\035\343\3407V\264\365\324\322\277w\3147cF\226r"
+	.string	"\031\336sCAy\320-Z\314\260\021\365,\225\252\340R\342BV\242\253Jj\302\001\34302\324\035\201\225\214\361\f\225\257\344\255`\202s~\272c4[\274\250\241\215\245Ta\270\350,\271\270\316\354\002g\341i\356\0265K\350\232\033\\\247H\377\331\351\327\231\235\3202\231\bl\007?\253O\321X\002\207\025\372Y}\220\304\265\025\352@\3041H\230\002\265\301\240\020EcP\220QX\\\203l\213,\032\2053\352\211\265\025\212\200\\\213+\333\"C\250C!\242\260\270\206`\221B!( \022\205\212Ec\361\327\002}+\030Y\240\326X\374\371\004UbnUd\220\032\344;\020\210\020HV=\261\262C"
+	.string	"\264@d\t\032\271\022\211k\220\217\030,\376\254&~\212\353\211U\025\252' I\030bw~V\237\265H\302p=\336\034\b\304\317\352\323\026U\226\025*\321\252?\030\374\360\034\bD\b\343\312\001yTU\t\004\261\254zT\325\0248l8\020\b!\013\024\372\204\020\372P\200TO\260Bj\033\314\320\n\0015"
+	.string	"\201\270"
+	.string	"\n$\230\b\321\252?l\260\275@\005\241\221XBe\215%r\206\310`\007\3305\270\203\342h,\001\200\366@ \216BF\366G\r\n\262\301c\b\025YS\364\301)\022\370S\3749\246\305\237#\252\262\260\"3\022\251\262\303a\360\207\342h\024f\266=\242C\265\370\263\022\203\277\241\212\024\312*\362w\026\370s\004q\303\006\201\204\031\005\333\"\327\037\365\204\016H\241\035$Q(\350\243\016yP\004YV\004\244"
+	.string	"\206G!\n6\2649B\326\247\0022X\302\016Rx\002\022\251\n\215\354QC+T\211\352\006\232 \265E\2420\261\341\250\266&P\020\217\307\340\016\0018"
+	.string	"\321\262\301#\b\022~\214\027@\300\205+\253\026\325\037}\017>P\300\007$\206~'\001\002\007 p\340;\t\020zz@\370\240G\377\203\036\264\275\020\331R"
+	.string	"G\005jhs\332\016\303\242\372C\002O\3009\252\255\211\226\r\266\310\031\365\247\030dS\023CB\301\rl\210!vg\210\2459\006\203\204l\312\252\303\365\304\020K\f\256\254\212\324)\032W$R(\005$\316\220J<\n\215\340C\f\002\321\020\215Bckd\2179\303u\246-\n\031\205@\037\026\270\036\221\300!\226\203:\\Y`q\275\240\005\376~\202(\030W\340\217\020\361\310\243\323\252H\2255\266BA\340\260\270\246"
+	.string	"l\203H`\220\020\333\252\240\036\221\001\260Q\211A!\222\246e\325\023\305\025\270\"\221l\215\220\035\256Aiq\r\322*\bU \341P0H\347 \211\301\023D\343\221U\333\"\tB\226\003RU\331\037u\204\240`\211\023G\237\fm\360\304\332\nEP\207\306\022\3305\310S\\\205*R\b8\304\326\b\201CBA\340P0(\247\005\006\333\340\b\030\220E\243\321\004 a\273\256\200\314\021:\252-2\007\333\3400\347\366@\"\264B\306\031$Pm\203\255\t\235!uX$\201\250\026\213A\240\022CB\301\234V\350k\325\023J\f\327c\006\034$\320\204\341z\264i\017\004b\270\036C\360\214p\221@\022\303\365\3503\341\222p\207\353\021]!\210\202\206\005 \240\317\221h\303\002\020\216\217\217\261\025\022\002\201\204\255\261\230A=\242h\201\254\332\022W\037\240N[T\205\254j\202\tG\241aq\355"
+	.string	"\207\232\025\202\037\b\02221\\\2178EdQ=\006\031K\fW\023\332`\n'v\212k\t\255\b\303\365\210A\204\034\024\355zbmWdQ5ATO\250D\f\255P\365\361\331Q\207\306 `\313\252\307!\025\330\022\327\026X4\262\260\262F \036\024Tb\333\032Y \024((\256\301\n\260\3066\310\252\253\006\343\332\006O\030\n\022\325\0232\250\0350\021\304\252\355p\007\205N\273\006\255\027 \252B\241\b8\303\037\fC\242\021\b\251\262@-\260U\221<j\320\332\322\240\b\022\325a\215J\374)\0065"
+	.string	"Q\260\352\t \0202\310\016"
+	.string	"C\220\261\250\016\201\307\237*\\O\250C_\213T[ kl\215A\300\242\361F(\f\002\207\254Q\250\2624\355\201@\250\304\325\307\310\036\201!\204>\031\264\300\017zt[\\\215G\025\202*\233\0020xlq\220\300\237\325\247h,A4\262m\321(\334Q\333\340\tB\366Gb\270\226\300\002\265?\026\250\325H\265\r\262\351\b$\230\300\002\241PD1\234!a<\016M`\205\340\007\204,\315\201@ }\324\341\220\250\256>\300!c\n*\b\203\304\024\020p\343QeC\264F#\033\242\006\t\024\241\270\002\333\242zb\002?\306\013\264@?+\321\247"
+	.string	"-\260\003\021mq\375\255\240\026\265*D\fr\200\002+\250\305\233\026H\242-\256B\2773\200\001%.\330"
+	.ascii	"\006*\240\205 \220@!\033B\350\023\242\270\006\203B\bYd\b\020"
+	.ascii	"\026\024\215k+,\nQ\240-\252A-R(\004\303`\006\242\321(\001`\372"
+	.ascii	"\023$R\240\r\032\211>3bR#_\224,\266\2460`\350\262\264\362\360"
+	.ascii	"\220X\335\323\213\227\324n&\2717\315\023\225\250'vi\035\032\215"
+	.ascii	"mU\227\322\231\020gt\367D\365h\214\366\362\244\236X\351k\261"
+	.ascii	"\305%\007^\227\274\305\244LS\313\\\021\237\213\251+ZTp\230+\262"
+	.ascii	"bl\321\262\227E\344pnr%yX\341|\345J*ww\323\336v_qO\345\272\f"
+	.ascii	"i\266%\3019\205\273cWJ(/\234S,w\314\267\204\006\023\221g\215"
+	.ascii	"\216-\26758]\345UR\267g \332\273h\357\032=8\320\272\301\343i"
+	.ascii	"\355\251[j\345\006\207\334R\313J\332\366$\311\222\312\226\346"
+	.ascii	"\f\023\"\0356R6\364\355\316\t\226\036iT\204\264y\355\355P\313"
+	.ascii	"P3vK]jSR\250\032_\360\356\2440\005\204\351\250\203b\004ZP\260"
+	.ascii	"\0051\004\035bFfD4I\007\223\024@PpP*\226\217w\325\036\023@\322"
+	.ascii	"\310\003\302\230\247\221R$3\222\222\202\202\202Rv\016\001\002"
+	.ascii	"\354\3709\260u\277\231\263\304\360\330\"8ud=\020\370\004\270"
+	.ascii	"\2637\005-(\021\027?q\r\024\266\231]4\177$\202\"\326\263\032"
+	.ascii	"\320\363\201\322S\353\270\241I\b\005\fB\370\023\234BxIM\326\241"
+	.ascii	"\315\343#\352\275\353\346\271\344\\5\315\274[\366q\214y\316\321"
+	.ascii	"\207\270\032D\301T\257\336\3232ZP\\\013U\364\311r\001\001G(\227"
+	.ascii	"\226\253\240L)\323\327\tzV\304\t\324^\242(\235\253\005L3\217"
+	.ascii	"\237\362R\351\255\366\332\350@[j\206;m4\325\340D1\365\233\331"
+	.ascii	"l\321w\252b\225\212@y\306\360\372\223\013yk\206\317\302\263\326"
+	.ascii	"\305U}o\322;0\215%\007\243\021\267t\347@{\252\320\246\364\353"
+	.ascii	"\"\373\345\355\222g.\314\215\202\326\346c\245\f\007c!\2008\027"
+	.ascii	"\002\356\312i\313V\024\320\013/`5\243\0012Q!Q\267'm"
+	.string	"\177\221\006\364\220\302\260Y\377f\022\254\363s_\276\317<\334x\0016\357\\\312\3136\250\006PC\302\002\311\242\236,L(`(\"\213$\206\346\205\022\222Y\017;\314\250\274gx29)\273]\321\222vt\021"
+	.string	"\307K\006f\213\230\202\004\301\346\323\323\2665\242\243\bw\370#\0234\242\254\247Q3B\3047\006\004\226\207\301\234\247\301$\270\247\350\264\226\221O\030\335\324\220\\$\177\006\007\022\234\t\262l\306D\032\213\203\003\fB:\343\222\373k\336Q\205w\326\264\225%\035v\026\226\337\370\336d\221\204z\024r\202t\302\205F\332u\275-,1\rI\007\377e{q\317\226\370O\357\201\242\332B\353s\245'\354*\016.\361W\220IH\006\202\331\336\036#\3541\356\252\330:7\3761H$\0326\"!m\377\240\276\2701\254\253\375\205\224\372kg_O\"(U\342\336\005\360|\304\332\216\327\252g-\221|P\232\316\t\001\240\260\313&\255\020q\021\312\322\320\353\244K-$\007H\220\267\317\313\357+\337\241\377\366"
+	.ascii	"\263\364\300:\264\310\204S\320t\240\025^\353\325\030\200\260"
+	.ascii	"\313\221\247\254N\021\257"
+	.string	"\360\346+\006d\260\356\326\253)\022?|\331\362\246\006\013\373jq\335\200\343g\231\326\240\021\267\005x\310\n'\364\303\341N`b\"O4\215\242\216\0302\310\236\241\t0\327|\227\250\004\fn\3707\345K\262\205\346\242UI\020\235|c\fj(}S;\332\325\033x\203\256\332\205\033\324f\254\326\242\247\006\252\340\004\335\341\250\367X\374\322\246\364?\256\357,\302\234\207\356\203X\223\3645w\202\257\313\321\f\225.\356\2026\232\356\317O\202C\365\345\325b\025[b\332\271\330B\323\225\0242\315\036J\245\264A\303\236\350\333}\251\027\2413\024A\004\370\222k\210\322\223\355\376\270\246^^\224\316J\351\t\325\3012\253\305\251>\277r\356\340<l\300/\351\271\307\035\231\\L\355\030\374\003~\200\316\3159@\342\177\371\207l^\017TE\225KOR@`z\003\02276Hm,J\351c\306'\325_\236+/\211+"
+	.string	"\212\024\370W7r\321\202\t\272\020-\032\026"
+	.string	"a"
+	.string	"\342\034O\007\037C+m\fPP]\004\205\243?\252LS\2768\344${\325\274\277#\367\271\031\367\030g^!\205\376gB\031|r\311\342\212;|\027o\235J\350\226,0K\277\246MK\371\202\266\251\370\243\235\266\377\260l\301{o\020\340\177\253\302y\234.E\244m\036\337\314\247\333\316E\r\340\231"
+	.string	"Q,l\rT\306\006cR^\013\013\316\333\301\205\246(]\305\222d\007\347\n\231\"\376+\313\222\331\231gI\265G\354<n\222-\267+\005\313\313"
+	.string	"\205\f\304\337\234q\202X\315\270\302\004\311L\021\0341\235b\007^\027\003\377\356r\207\021\372)\250N!\3641\353\263\205\263n5b"
+	.ascii	"\307\3739\020\266K\260H\037}\311\364)\221\267\340\024\237\371"
+	.ascii	"\306\325\247p\r\376\016\325Vl\376l\212^\267\263\003\352xf\337"
+	.ascii	".\254h\302Q\354\017y\205\361{\237>\377\301\217\021\234\023b}"
+	.ascii	"\344\375\250\221\275\221u\231\200\321J\317g\355\377\230\301 "
+	.ascii	",\b\2148.\242\260LaU\347,\366\267#P|'\373\361\360\r\023\327\304"
+	.ascii	"\330\2622+\004!\336\205\016&\205\344\302\020\250\233\247?\327"
+	.ascii	"\312 t\177(\206CA\204\361A\004\365}\255|P3\325\310\231\301\373"
+	.ascii	"\031\266\256\211B\214)g+\033\277\366\232\362*\251\242\307\217"
+	.ascii	"b\301\337a_a\302\356\262\322\033\352(?\370\006>F&#\367\304\f"
+	.ascii	"\207\332\274\246\020\222\036mHl\311\2379\250\200\302@nmP\024"
+	.ascii	"\226\236x \030\027\0204\004H@;\233\344.L\245F\375!\201\220'\267"
+	.ascii	"\263\251\243\002y\036\230W\270\355\030\003g"
+	.string	";Hv\272\213\326P?7\220\231C\340}\204)\310\250U\313\235x\340-\333\222D\020\215\223\364b\210\311a\022\2663\367\221\251r\224\365P\332:\207\253\251\246D\211\313\374\274 \203Ai\310\343\371\234\216D\357\212?\201\202\"\332\002+9\206L\221zX\200\241\202\224'\242?\177\204\243\304*\330\013\b \"\355\n1\201y\234\327\352F\302\273\250}\034\220\233S\3757\354\306\317Din$\2220\254A\220\242\3171tI\"7\013\345\033\270}\027\201N\202\257{[\324\344\240\210s\004\246(\245\247A\331s\230r\375\223\264\251\3730\nH\366VQ;\247&QHS\276<\272):\302`f\004\271r10\300,qp\314@\352\325f\335\315a\365\272\367\267\025{RA)\005LUUa#]]C\004t\274\205\3340\365\334\365\373\004\375\270\350\302\263L\333\231\016:I\317-\213\232_\333 \356\216Kz"
+	.ascii	"j\301T (\261\216\247\233\337\231\263K"
+	.string	"\237\274[\335\242\006e\254f\211\232\304\004\303\273\325f\346\006cg\376P\346\201\225\212h\316\370\213\375\335\252\267LH\314\2679G\003\227P\026{\201KHx\243\n\202\030\373\264e*@\024\352\013\267n\037\322^]\t\321\250\332\330\326\307t\r\304\b\344\321\024\335\322\320\241\007\333\360/Vg\375\333\355 \233\244X\265)G\033-\r\3063\222\3121G\262kn\300B\364Y\177H\030X1\365L\\[@\245\322\357\315\334\312~-\013\266\255\t\247\303\262\211\245x\345\306\240\357\222\242>_\325\035\236\231\331'\271\270\337\025U\343\310\211\271\210\007\337\364\313pi|\031\340\223\037)\372\004\203\003|\237RY9\346\222\340\216\230~\352\361\302\232>\265\001\007\202i=\002N|\202\377\t\252\3636\237\226^3vwj \363Axe\205\267\027\003G\244$\274\036\336E\253\224\017\372\002@\364'\026c\257\276\244S\235*"
+	.string	"\361\236\206k\3719TM\265\t\b\016\312:T)\006\204\307x\207%n\222b\001\331\217\004\202\327\316\231\251\374\365b\0208\246\3314#\001T\004\202!e\301\207\006\030)\364EC\220g;\350s\243I<%\301W\245U\322\270\325\310\266'S\324\374\232`\346\371\264G\220d\251\307\214iY\341A\255_P=\006\f\236w/\210\234\035e\307g\254\217\237\213\235\343\362D\216\322\032 JS\315\210H\"\342\213\214\213\017\273\343\276\315\274o2\006*\242d\344\276U\230\362}Y\210\005Z8i!\020\013\016\241T\212\037O>X\351]?\006\016U\236ae9\320\310E+\241\267\021\3629\250\346\314\217\204\377\007\260\350\236\230\263\003!\\0"
+	.string	"\341\317\327}_\323\201Z\275\207\367b\006\264D\023T\006\204\263\275\217\327\r\365\272\230\244\224)\244\225\035\017\017\340\026n\022\261\352\210\244\3331\277\374\210 ?\221~2\005\336a\200lj\242\234\314cDi\260?\244\274d.'\2155\f\315\350F[\220\247'\363\235W\363\232\004D\3473^\270f\362\373\333{p\335\323\210\340]L\241:\033\016'!\312\324\253\bl\021\032\277\304-g\220=\013`\233b\021-\266\023(\242dO\326p9\230\370\235}\036\325\316*\361\322kP\374L\235r7\366"
+	.ascii	"Mn\0174\3350E\331t_'\261g\245\221\263\021\036{O\332\211'\374"
+	.ascii	"\222n\353\247\346\360\305H#\013K\321#r$/\2111\317\231\237\013"
+	.ascii	".zB\266k\240\252\265\203\322\304d\226[\324\237\007\332\016\\"
+	.ascii	"y;K\344RL#\345\255\270\212\352z\277`\354\2724\337\304\366$Ss"
+	.string	"X\377\256:-\246\005\006\371\260\024{\234\330;h\224\032q\302\206\201\306:X\371\n\246>\212"
+	.ascii	"\234t.\2578\2642z\356*\241c\b\214\306wd6@t\203\205j\237\325\017"
+	.ascii	"+C\034\332>\367T\325&\376\322\261Kq\356\340-\255\335;a\200\265"
+	.ascii	"\215\035\237\031\354\034\314\035\201\360\377\343}&v\353\374\256"
+	.ascii	"\266=H\031=\361\222\313w\322c\327e\245\177\3517\024_W/\216\217"
+	.ascii	"\310\230p)\003\235a\3260J\241\343\316\317\3255\203\352\320<w"
+	.ascii	"\211g\334\366\267roT\236$t\350\365\315\235\351\261]z[\325\251"
+	.ascii	"\276\316\355\246;DVm>\3774^\330Q\020\360\202{3\224\356\212\227"
+	.ascii	"\231\357O\274\316\034\344\250\017\242\377\250\023\354\255:\325"
+	.ascii	"\336+\313\276\026y\220\177z\235\235\315NM\374\n\3773\375\252"
+	.ascii	"\254\325{\247z\206\251\217!\236T7\212gGOI\3161\027\363\017\313"
+	.ascii	"!\345~\247+\016)\332!{\"\003\312\223\244\253\007[\026\035"
+	.text
+	.section	.gnu.lto_.symtab.a7fdd72c8063e5e6,"e",@progbits
+	.string	"processRcAdjustments"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\002"
+	.string	""
+	.string	"resetAdjustmentStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\002"
+	.string	""
+	.string	"updateAdjustmentStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\002"
+	.string	""
+	.string	"adjustmentRanges_SystemArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"Z"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\002"
+	.string	""
+	.string	"useAdjustmentConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\002"
+	.string	""
+	.string	"adjustmentRanges_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\002"
+	.string	""
+	.string	"adjustmentRanges_CopyArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"Z"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\002"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\002"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\002"
+	.string	""
+	.string	"blackboxLogEvent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\002"
+	.string	""
+	.string	"generateRateCurves"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\002"
+	.string	""
+	.string	"generateThrottleCurve"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\002"
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\002"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\002"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\002"
+	.string	""
+	.string	"pidInitConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\002"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\002"
+	.string	""
+	.string	"isRangeActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a7fdd72c8063e5e6,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1204 @@
+	.file	"rc_controls.c"
+	.section	.gnu.lto_.profile.20301e96d563cffc,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.20301e96d563cffc,"e",@progbits
+	.string	"(\265/\375`g"
+	.string	"\235\006"
+	.string	"\224\t[\001"
+	.string	"\032"
+	.string	"\350\300\306\254\005\002\002"
+	.string	"\002"
+	.string	"\001\242\302\263\302\013\002\302\374\277\243\n\004\002\001\002\002\003\240\342\234\212\n\004\257\360\337\212\003\n\002\003\002\004\002\005\002\006\002\005\002\007\007\b\245\276\350\312\005F\006\002\b"
+	.string	"\002"
+	.string	"\b\002\t\b\n\n\002\n\t\n\013\r\017\345\230\223\317\b\002\002\003\002\004\020\202\244\276x\004\002\013\002\013\021\022\205\374\351\353\006\023\241\350\307\204\n\024\025\237\375\370\351\b\026\236\261\223\370\007\027\030\353\227\221\315\013\031\211\236\236\264\001\032\033\034\035\240\342\234\212\n"
+	.string	"\031"
+	.string	")\"M\335\005\332\007\344\253y\357\264Y\200Y\027\210\200\273Tc\034#\t\202\310%7\024\005`"
+	.string	"\204\373\251\001\\\343\346<ri"
+	.ascii	"3\242\356\355\205F\273\220\013\340\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.20301e96d563cffc,"e",@progbits
+	.string	"(\265/\375 h\245\001"
+	.string	"\310\\"
+	.string	"\006"
+	.string	""
+	.string	"\003\002\001\003\004"
+	.string	"\003\b\001"
+	.string	""
+	.string	"\017\002\003\020"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\013"
+	.string	"J\005\342\"\270\204i\212"
+	.ascii	" \2603.7YL\021+Ad\206\262\001,"
+	.text
+	.section	.gnu.lto_.inline.20301e96d563cffc,"e",@progbits
+	.string	"(\265/\375`\352"
+	.string	"\215\007"
+	.string	"\"\212#,pK\222\016d\236\201\221V`\264|\346\005t<\302m\007FC\004\036\240nCl\035]\017"
+	.string	""
+	.string	"$\204\200\376\330\026\233\326.\331R\2463\262F\356\0162\324\216JEq\002\312\251\222\212\362\320,\300\305\202\310\r_\004(\263\201-Tl|,\252\022\036\021\031\344xJJ\313\323\204;)c\200\270\260\340d1\264_\001\303\241R\021\364\211`\r\022\212\211\201\327\222\f\262\337)\3476urw\316\375\357\215\226?h\373\214\354\356n\37525\002+ `\"ci\033Zm \362\241B.\320\362\013\245%\007L\357H\263\220Z\203\360\206<\301m"
+	.ascii	"\374\213V\200!M\\\370\307@\200&\201\304\b\300elGd\003\240\201"
+	.ascii	"\316\nb\004\230\037\246\336\330\353\3019\036\211a!\360\264\327"
+	.ascii	"\201%\352\212_\300[\021$\200\353pE\341\370\323\234\255\305u\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.20301e96d563cffc,"e",@progbits
+	.string	"(\265/\375``"
+	.string	"u\005"
+	.string	"\"\310\030\037\240'\351\330\003i\327\371\377w\361%\372\375\267v\373\377uq\363P<}\255\355-\b\221I\006\274qK\030$]\202\256\364MdJ\037\256\214\315\030A\230\256\216\253\353\347\323\234f:\256\b\315\307\025\356\213W|\353\345~\271\316DQ#\033"
+	.ascii	"(La3\243\246Fm\252\021\327\222(\351:_\222\307\r\001! \220\202"
+	.ascii	"\221U\334N[i\350\262v!\\\221\3278\303vKP\f\022\201\001\326\231"
+	.ascii	"1_\r[4s^\261e\302\2478m\310\262\027\270\001\206a\263\031\274"
+	.ascii	"T\255W+\344\367T\345B\312\304\356\332\r\027!Q\327\025w\b"
+	.text
+	.section	.gnu.lto_.pureconst.20301e96d563cffc,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\204\004\002\204\004\004\230\004\b\230\004\017\204\004\020\230"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.20301e96d563cffc,"e",@progbits
+	.string	"(\265/\375 \232\025\003"
+	.string	"\"\005\020\030\260i8@\222\004\252\2119q"
+	.string	"\003\247\221\255\331\234@Ev\t\331R\246?P\344\004\263\225\267\366\013\307^\211\007\367\234\277&\nM'S\276t*\345I\025\200\224\037\345\317\036;\215\362\365K\001\r"
+	.string	"y0\007\301 \330\325\034&a\002\027\354\225\t(A\2709\365%\304.\314\312"
+	.ascii	"\003(\002"
+	.text
+	.section	.gnu.lto_.lto.20301e96d563cffc,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rcControlsConfig_Registry.96.20301e96d563cffc,"e",@progbits
+	.string	"(\265/\375 \226]\004"
+	.string	"\324\007`"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\203\314\201\023\030\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\317\007us\345\006uq"
+	.string	"\005\001\006'\001\005\031?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/fc/rc_controls.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_rcControlsConfig.98.20301e96d563cffc,"e",@progbits
+	.string	"(\265/\375 :\255\001"
+	.string	"\244\002-"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001"
+	.string	"\005\001\006\035\001\001("
+	.string	"?\202\210\200(}{\276\001y\276\001w\275\001u\274\001s\273\001"
+	.string	"\003"
+	.ascii	"@D\312M\003(\002"
+	.text
+	.section	.gnu.lto_armingConfig_Registry.102.20301e96d563cffc,"e",@progbits
+	.string	"(\265/\375 \226]\004"
+	.string	"\324\007`"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\203\325\301\027\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\347\006us\377\005uq"
+	.string	"\005\001\006'\001\003\020?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/fc/rc_controls.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_armingConfig.104.20301e96d563cffc,"e",@progbits
+	.string	"(\265/\375 .E\001"
+	.string	"\360!"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\005\001"
+	.string	"?\202\210\200\030\177}\275\001{\274\001y\273\001"
+	.string	"\003"
+	.ascii	"@D\312-\003(\002"
+	.text
+	.section	.gnu.lto_flight3DConfig_Registry.108.20301e96d563cffc,"e",@progbits
+	.string	"(\265/\375 \226]\004"
+	.string	"\324\007`"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\203\335\241\035\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\375\006us\324\006uq"
+	.string	"\005\001\006'\001\b\032?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/fc/rc_controls.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_flight3DConfig.110.20301e96d563cffc,"e",@progbits
+	.string	"(\265/\375 :\215\001"
+	.string	"D\002-"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006'\0012\264\013\352\376\n?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001"
+	.string	"\004"
+	.ascii	"`\204\312\341\224V0P\004"
+	.text
+	.section	.gnu.lto_isUsingSticksForArming.111.20301e96d563cffc,"e",@progbits
+	.string	"(\265/\375 \347u\006"
+	.string	"\022\f-3Pm\222\016$\243*\n\201\352\"yI\006"
+	.string	"\240[\250\360Z\376-\331U\373w;\354\354\316\301\234\300 vf\026QD\337\001\036\260\031<\253\265\366\311\226);\r\207\341Q\235\315s\007\216jN\241m\026\020\032\232\2438M\223\3719$P\255\363\036\3250W\226\221\220\005\204\030\304\367\243 \325\335\370\301\203\265:]\217\245\0232"
+	.string	"\212\020\226\376\002!\303\370V\222\221~\034\331\245\302$C\222)*\245d\3114\302\361\177\0363A\301\347\252\227\206\250\027\"\021!(\231Wc\031\255\212\325\255G+\035\026'\326\bT\274\030d\346h\215&:\353/\360\017\374\022\001\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_areSticksInApModePosition.112.20301e96d563cffc,"e",@progbits
+	.string	"(\265/\375`6\001-\r"
+	.string	"\006ZYA \217\223\016\324E:\276\201\035\\\030ku\3723D\227\204"
+	.string	"R\254e|U!\312r\312?\214f\254\207\2011\372 \331r\204\002T!\240\204\244T<\211(\213A\003\276B\236f\b\021\262w\222)\005H"
+	.string	"A"
+	.string	"G"
+	.string	"&@\371\241\007P~]\340\351\307[\007\027o8\211`f27\353\034\374\361s\307O]\2054\220\311p\032i \277\013v\034\255\002>\200\266\34282\323#\214-\232\nb\025\222\231\305\221f\301\245\334\326A[\005\2551\004\265\313\314\354Im\261\033\233\354\215c+\207\245\034\3669\254;\366\016\213\016kN\005\202\005\202\023\231.52r\305\213\371\320\326\323r\332\036[\207\260\b\217M\024\37225\244@\221\271}\264C\303O@O\360a\0230\357na\314L\320_:"
+	.string	"\323\213\212\025\214\321\337\335,06\376\033x!\242\361\361\324\f\226\231\326\303/=id&\203\232\204KL\250=\370\265\223\202\036\371\325)\224\237_\300EL\bk\332\r\204/5$\017\260\022\221\223\221\252\027HG\002\226\241\230`\227\310\225Y\027\004\313$\302H\211ue\035\013\344@\261\023\222\314B\301\260\314\342li\227'\025]\207\361\036\256\336\322vs\216\320UZ}s\213hBXC\275\227\334\335I\324\235\314;\025\031"
+	.ascii	"L\204\236\350\206'5E .\210\001n\300\256\025\254\006{\300\270"
+	.ascii	"m\220\004r\345\020\214G 1\261^\202{\025<\244\272\200\270\346"
+	.ascii	"\300\312b\203\017\201h5\344U\205\253yo\273\212\036"
+	.text
+	.section	.gnu.lto_calculateThrottleStatus.113.20301e96d563cffc,"e",@progbits
+	.string	"(\265/\375`\254\0025\024"
+	.string	"\006\346\204I\320\224M:\330r\271%\277E\377RmbH\303\216\210\005E\004\"\203B@\314\356\223\252\355"
+	.string	"\343\336\2706V;\367\306\003-\255\300u\035'<\005yj"
+	.string	"~\241\226<"
+	.string	"\242\202\0318\320\2747Z;\244\021B\366\336R\312\024p"
+	.string	"e"
+	.string	"s"
+	.string	"\177\315\377}_,\214\232\267\244\215G<\335\212d>Dj\265\201){Bw\312\005@w\266\211m\255\327qt\312\346\326\367$\332\254\327\305\230[\027\210\245RE\247\310\303\t\022\t!\237\030\343\271?6|\270a\371\2112\231RkM\2110n\251\242\024\304\224\022e\362$G\305lk\3138\342\213\231[\251\265\236g\"\207\375i\377\217\370\257\362s\2173\356\355 \002\3266\273<MJ@}\ft\033\302-\b\214\233\356qJ\335\025\375/\314\360\316\266\267\266\233\341\247v\004k\233\337\366\342\246\375\333\3438\216\357\235\377|\023\311/\231\374\224\344\243\232O\"\371\237\344\237$\337\233\374N\362\271\311\247\222?\233/\231\317\314\337"
+	.ascii	"\234\021\022JR\2559\243\221z4\205V<1\235\027\217;\233\366S"
+	.string	"\317f\335\214\274\346\372\324\024H\254\347\305\343\273\366\020\354\216\034\253#\201\002\026\026\272\263\353\375\241\315-X\034\f\272Za\005\2766\366F\003\007--t'm\325\211\030\262g\257\354\210\213G\325\326x\320\325Z\r|i\254\217\3137\305\316\277\204\363\033\366\224\221TD\310\305\343?Tk\301#\327\266\334\313\204b\224\235@\177\030\n\274\001\017U3\025V,\232\230U\350\022\262\300P\002\030\003\363b\001\fY3\240J\300W2\021X \315j\305\002?\233ke\355\235\313\324\206t\273-\272\265\365zj\032\350\267EM\032\347\277I\177\305\325/Yk\255\036\037\355\334\020u%\215j\326\255(\325%\007v\210G\252\t\2204*\b\210\244'\213%\027\215b\306\217\017\256i\273!\210\232J\320\246\375\353\331(\246[\321\327\003\226\0023 \360\002!)\325\003N\fM\225\343\371\226\311\\\226\246\307\216\366d\273\004\344"
+	.ascii	"\033\347\2721\005\221\020\202\032%X\207\345LB\020 D\202`\033"
+	.ascii	"\346vX\367\200\020\f\314g\3561\354\273z4\276\224f\375\265f\207"
+	.ascii	"\221\006\206\330\362l\\\323\026\325\033W\023\013\345\363'RQ\020"
+	.ascii	"A\007\021\232\032\346B\332\211\007\027\007\231\337\341\033)\270"
+	.ascii	"\321\023\016\024"
+	.text
+	.section	.gnu.lto_processRcStickPositions.114.20301e96d563cffc,"e",@progbits
+	.string	"(\265/\375`Y\023MX"
+	.string	"j\214\364\037O0R\332\031\003Z\244\366\"\241\002\272d\005D\020/\361\374\356\373\342Gp\300S\023\364\304\373i\255\206\303\320\002pR\016\216\034\261xb\223\375\032\350\020\004QU\004A\020UU\252\251)\320\363oA`Z\004\254\305\020\022\022\332DJ\231RJ\001\363\001\271\001\356\001N\210\b\276\257s\251YN1l\226\231\333\231\233H\267-\333\355\004&\276/\331\224\034\336WJ\202\227\206\315\"\033\247mvm\233\266Y^2\377\265\364\307\333q\324\246\234\340\373\276L\357\203\327^\245\315C_6\277\261\264\005\013\002V\250H1"
+	.string	"\212'\247\023\002\230h\n"
+	.string	""
+	.string	"\246\022$F,)%!\035\2110*\"\032\022B\006\001\375\370\204\350\341\331\321\311\301\271\261\251\241\231\2219\306\030\213.q(l\331\365}\311\355~e5\277\261\224X\244yC\213\365\006YY\215fA@\0300\276BE\020_<\305"
+	.string	"\203TGQ\355'A-\356\324_MN\254II\300\310\365\324\371\267\346\320\300dk\250\323\007\027`\203\352\237\211\036\262x\223_\007p\005F\017"
+	.ascii	",}\316\3447\305K\3505\211\022\270F\254&f\b\272\320S\247\336j"
+	.ascii	"\034lZi\250S\212/\355\240\004%\351I\024G\032\341\310\321\212"
+	.ascii	"\242\356\275\023B\253B\032\352\274s\021N\354\334(\001\037i\315"
+	.ascii	"\273\033de4\272\210\256\211\350\240\316$>4\327BsH\034\2716\315"
+	.ascii	"}\331\365\324Y\267\306\324\360\007m\250\023\007\017*\002\364"
+	.ascii	"\343\326>mD<\204\033\233\367\270\331\340<k+\0162-\032\276\243"
+	.ascii	"#\203\347\340\244\005\361\233(\232\333D\317\274\006\210\323L"
+	.ascii	"\241N3\237\211\266\314\217\027\374\270*m\321\301KC\235\321\025"
+	.ascii	"\307FZW\313\265\320\3249\3461B\027F!2\260\035]\234"
+	.string	":w\254H\250\263\005wW\245\261(7z\352ta\305\241R\326CC\235:\234\270\032\371\324t\364\324)\266\232\020\243\343\323\362\241\320E\f`a-\314\321msE\272\327\027\227\263,\364z\374\232\261\"\337\367-~m\371\267\\+\231\341@\204J\006\026\326.t\361\276/{\327\027Xs\001\315\274\2661\363\005\3142O\001:\204S\n\314\020k\336\371R/\275\027\257\302\244\027\226\205i\3369\267\262Uz\257\245\277\271\022\347\267\345\203\275\276\357\373\016\345\232\210\266\344\257\225z^Y\244Oz/\346\021\275\364S\2374\273\343\032\323\362\252\013\377)\355\237\026\351\245>\t\260\375'7\332\022\2735\352MX\222\366P\217\364^\302(\355\013)h%:\264O\204\332Q\335\230\354?\337\376i\241>\352+0\343\241y\243\351\370\324\302\326\177\256\357\237\214\323\333\362A\376_-h\273\013\206\357\273\345\304M\327u\030d"
+	.string	"\005\3256\373o\204\305\255\337\277\233a\230^\375\321sQ\303\367}Qp\343\320H\246\270\321\232e\252\016\274\273\232\345\356\240m\266\237\205\326Q\2250\275\312\336\314\244Uz\250o\271&\342R\247\305\303\2210Z^}1:>!\377Of\251\226\177\017>5\261\034\370{0OIEi"
+	.ascii	"\325n\335/\\\347'\327\331\251\341\232\227\224\222\220\\\347#"
+	.ascii	"\327Y\204\353l\344:\027\025\235\211\206\316C\256\263\220\353"
+	.ascii	"\214t\235\203\\g\240\242\363O\321\331\247\350\034\302u\356q\235"
+	.ascii	"y\\\347\035\327Y\247\350\234\343:\343\270\3167\256\263\215\353"
+	.ascii	"\\St\246):\317\270\3162E\347c\3219\306u6\272\316\3056\322\354"
+	.ascii	"\272\316D\327y8t\026\022\235\333\241\363Jt\376\241\263\013\235"
+	.ascii	"{\203V\343!\370CP\336\373\332\250\006\361\356\261Jdhi7\\\267"
+	.ascii	"\221n\235\365\325[\346\356\267\216k9.r\323\211e\033Q\016\337"
+	.ascii	"\031\2047\224\205\331\362\276\322\t\340\230\trK\372~5\275 \370"
+	.ascii	"F -\001\311\224\276_I$\001\314\304k\231B\336\336\026\221\317"
+	.ascii	"j\303\347\217xC_G;6?3\313\022\n\341\344\375\366\222\205\034K"
+	.ascii	"1\357\256\020\177\005(\245ni\362\245f^\356X\276`\264S\023zm1"
+	.ascii	"\221y\255l{^\n\254\347\331\262\033\250"
+	.string	"A\305\341\224\347\213\356\344yvZ\005r\025\230`\242\201L.\323\313\262\226y\371\\\372\340\262\267\365s\223d\312\032\244\211\303\347\237[\372IK\357\374\223\327\330y\341\024\210!\024\025\316B\374\223\247\264\262\325\371\244s\205\240\363\354\324\013\017\035\037\r=9\276\225\363\017\326\205\032fB\214\256\217\347\237|\323\312\026\347\245<\013\347\205L-;Bb\230@tNh_|\013\034E\216\326\332r\314|\222\354\260\031\322\304Y\006io\276\247g\375e\031dp)\303R\310Rm\251\3266{\363D.|T\267\024[\214\334|+[\233\037\201C-N\317\306\213U\224\256y\233o\256\261\300\032*w\241R\303\206\346\215@j\240\371v\207w\0268\260\232\231w\276\242\265%\233w\327\314\367\032\017\255\317j\026I\036\225\346\247uz\262\356\237V\346\235\236\275\031\246\345\325\277e\233\314\013\247W\226E\212\316\231 g6"
+	.string	"\001\357.>\316}\331\323\372,?+\250\024\301@\346\f\027'5d\370\372\370\3118?\037\347f\240en\300\001\357\256\343\037\347\272\354m}\226\320\225\031\276\2160\332\230\227\212\363\263\322W`<"
+	.string	"\001\004m\2631\377`Q\334\237\376\264\t5\346\237LzO\310l\022\r\344\270\271=2\243\361\365\272\213\213\361E"
+	.string	"\222\3075\246EC\203\013yEj+[\342'\343\244@\031\201x\004\207G\rc\016\365\255\245\271\353P\351\335\367r\177\370RqX\270\363\332\211\222\033\215C\220@\202\266\331\341?\027\274\2650\246W\211\377da \310\230\340\312\212\205\321QW1\250\016\260\222\001#9A\222\352\212JFU\222*\006\325\324T\224\216U\bWQW\022P\305\270\272\252Jzpu\344\251\022V1\252\222W\037TMAM%\231\2468`\372"
+	.string	"F\224\f\246\251\244\025S\t\037\256\002\201*\311tUU\225d*2\373{\260\013\346k\365\013\236\034<\306\332\272\212\235s\320\205\353\2605%\032\370\200\227\350\253\202u\205*G\016k\032\231\227\026%\254\357K\326b\013\234W\375\n\215&,\216\320\341Ea\275)B\bhK\313\372\270\276\346\n\270f\306\342\301\221\340\345E\031\210\037\236*\334\316`X\331\236\240\245\300\222c\"\230\343\t\327"
+	.string	"C\006\201\274\001Va\227@\241(\274\243\260\370[\324Q\0373V\226~\303\362\241\350\307\373\276N\315\026\255\340E\003\273\bU\307\023[\303\371\240\002Xe\001_\233wh\227\272\217\364\033\326\017\307\037]\314X\200X]\\\311\332\036\327g\tW8\253s:z\266\265\177Z\021\177\364\335\274\021Ub\001!\342Y\274#k\357\203\227\337\t\037;=\316\212\357\220!\002\274\023\213\272L\341\356KGQ83\3219Z\331\032A\215\236-\003C5F\343\246M2z\254[uI"
+	.string	"wym\203\021\""
+	.ascii	"hie[\024\244\350\331*\201-\325\210\r&\2423\242\177-OJ`}1\336"
+	.ascii	"\255\365u\315\221\370'+\233(\221h%\016\244\021\035\203\352\226"
+	.ascii	"\324GZ\203\027>\364\314X\325e\026R\350\207\276\353\232a\252\255"
+	.ascii	"l\221/\244\301#\237\004\"\325\"\fO\354F4\331\031\323\022\003"
+	.ascii	"HclI\017H\bM\022\347\f\245\035~\306\316rxD\263$\375\223\245\264"
+	.ascii	"\262\rz)"
+	.string	"\262\240g\313\254\254\361\334\240\222\005\211\305\214e\023\210\226\233\353q\364O\206\322\312\026\350\375o\f\350W\230uL\020\0344D\374\274\224\213\365\317\033\355"
+	.ascii	"{\240\240\3310*R\341n\007\201\247\250\201,&\22144\"\"\"I\222"
+	.ascii	"d9\221\005\304\030\347\2443\017\021\300<\207\254\252\231$\311"
+	.ascii	"\316\001,\254\034\215\340>\255\003\224\254|\357\356\244\305"
+	.string	"\374\036\252\250\374\265\354\204WN@#5\013({u\203\250Q\\\212\323\363\372\007?/\033\245\3535\275\002f\226\267\257\0338\333\361\323Gu\205\235\374\004\316\200u\020\212\366\030D\252\377\270?\310\334\005\307\t^\026d]%\030\017?\377Jx\355B\250\373_.\242\216\321\267e\bQ\031I\204\333\306\270._B\3468\232\2662\367\003\013\205\302\254\266\352\246:\263\202;\366\357\335\231N\025\264\333\210)B}\027 Q\350\227F\240\216\f\326\027\306\322\316\367\327\241Nrd\355=#Y\204TL\232\220\216O4>\202jQ\203\241=\211Z2x(\204\222\226\362\214TT\362\323\241NF\253tC\022\234\005\273\250?\004\321\3427\336wa;\201\037-}\356n\310\030\270\323\020Q\216'\002\226\324g\035\240\021\347)k\362I\216H\232V \322\026\336\232s\202\357\277\301\370~\203i\317.@cd\343\357%f~"
+	.string	"t\336\034\007\210P)/\r\2113K\327\242\362\204rB\267_\2229\263\340\355B\2759\232d\211\212\354\272\232\017?\257>\370 \357x\265\235\331b\004\370\264\221.\325?\217\323\032\204\276\022\223\241qF\354\304\236a\275p\326q\335\020Nu\240B\376S\202\324\243\001\016\362\024\334\226\207\007\340\032\331]\341\306F`\0176d\352\325\b\272Y\215\031\037\273\b\027"
+	.string	"\352\355m\324\001\206\025\245\305\353\351\020R\220b\223J\033v)&\0069\354\250/6\007\340\0012\234E)?\366\354\006\276\227\244\235`\005\204\013"
+	.string	"\334 )\023?\300\301\334r\343\366Z\323Q5\024q\246\240\227\341d"
+	.string	"+\241"
+	.ascii	"@A\301]\005\340k\236\003^Z\004\261\311\261\327\301>\"\371\271"
+	.ascii	"2\027\275eO\363\242\007\252H\207\254\271\337~\324\024\377\200"
+	.ascii	"\245K\fv\004\274n\025\024\366(\323\237]\246_\223\224\253*=9\177"
+	.ascii	"\356L\232F\377\200\354\355\303\201\251\n\351\261\335\025p \364"
+	.ascii	"1\335N\241t\342c\024\001O\374xX\205T\320\341\345\245\031\367"
+	.ascii	"\006\271\230Y\341L\275e \032\036\230\222\356sz\205x\314\203\324"
+	.ascii	"\257\342/3\303re\016:\307\3407\016\370?\253\266\021\342\r\234"
+	.ascii	"\264B\243\350\301]\215\264\013\t+\021v <7\024\215\342\235-\274"
+	.ascii	"\202D\243\331\266\240\307\357\273j\330\306?tUrE7m\257pn\247\204"
+	.ascii	"\235xVpl\3243\235\363/\277\347k\336Ys\225\035\371\223\271\341"
+	.ascii	"\274UP\304\214\177\234)\233\273\23441\231\222s\212\021\255-I"
+	.ascii	".\001\374\017\300\356\03655\031\274\321\227\326hM\313my)\360"
+	.ascii	"\2504\177\037\253<\346\310<o\017!\b\213\025\026\333|\373M\300"
+	.ascii	"\267\t\376E\320\177"
+	.text
+	.section	.gnu.lto_getRcStickDeflection.115.20301e96d563cffc,"e",@progbits
+	.string	"(\265/\375`\"\001\345\r"
+	.string	"\306[`C"
+	.string	"\261&\035\037%N\331l\317\032\351\006V\216q,\\9h\347N\371\223?\336\3167\260<\256\030\266\032i\f}\004\214\224\274xEt\227\376\337\255\240\006\327\t:\275\337\b\213\241\3404d\311\336[\312\224\002N"
+	.string	"I"
+	.string	"J"
+	.string	"\320\266\017\342!@\346\336iC\0279\260\220fnv\367\362\370\200x\370\336\021\017U\303\271?M\316\267f\240\200Q\352P\376:\335\205\353#`Z)\021\240Ky\bhP\246\313<U:Qf\265`w\235\245\316\302\ro\233\201m\021\373,\001\207\3719\234\256`:\3024\324\364\323\264j:_\372"
+	.string	">Z\316b\305n\205T\215U\001m<\330\006\331\226mM\373\247\213"
+	.string	"=\206\202\341.\006\0275\273'\020'\340\034\n\310w\304<\fg\216\335\f&jv\027\304\037\234\007I\303\032\343'\021j\324\217Z\236B5`C\237~\364A\224)wT\265:A\272qM=\351\206Mr\022\037\316\356*\360g>\"\363;\034Z\302\226/\035\372[<\274\212\264\260\te\312>\241\244\276\330\177\253.\266\036\363w\002\230\346\300\363\201\233g\302\3103\026\262\221d\232II\2065\300\264\013\203p\225xF>\027\246mW\310\001g\021\036h\227I\226i\227u\332\253\2133U\306\271\230ji\245*\352\021R\321{O-\375\350&\224\251'\r\312\264\242\372\342\n\365\223\030\265\300\013\231\024)\001\025"
+	.ascii	"R\b\030R\023\252\006\2702%z\316G\336\316U\260\301\323\340h/\017"
+	.ascii	"\263\226\253\265!*\001]\303\361\026\343\350\b\370+\342\025\341"
+	.ascii	"\b({\303\317<1\233\254!\250="
+	.text
+	.section	.gnu.lto_useRcControlsConfig.116.20301e96d563cffc,"e",@progbits
+	.string	"(\265/\375`o"
+	.string	"\375\t"
+	.string	"&\323F@ \347(\035\220\b\260\b"
+	.string	"`d~.\223sDK\255\345\326 \335\340\350\200!\212%\300*\340\177\354c\203Y\030\215\365ES\303|\201\247 A\n\210`\266"
+	.string	"\nBQ\f\004E\020\331d\313\224\0020"
+	.string	"2"
+	.string	"7"
+	.string	"\323\343\027\264\317\355\n\332\247C\033\301\307\326~\246\245z)\330]N\242<\274\206\376]~ \256PW\003\211\335\265\212+\222[\336\366\203\355\b\373Z(\225'\366\263\335]K\226}\327\237\251ZU\375\215\241\300\201\013\232\335\221\330\202\205M"
+	.string	"*\033\333W\373,o\t\357:=a\2275\240fw\344\030b{\217\271\314\307\206H\244}\312\227\230\340R%GU\262\251\317\241\331`\207t\020@"
+	.string	"\026\"Q\316\244\377r\230\223\237b\017\223^\374\364M\332\347\024\t\260b\222\322\230=\006\036\260\302\243\360\204@\037\357\233\320"
+	.string	"\221\020\334u\300\220\367\225F^\207\321}\\\367\341F\240\f\021\327} \327i\260G\362|\\\311\363>n3\356\263\225,[\030\200\245$\210U:\r"
+	.ascii	"2\241\025h`\270X\020\260\021\222\273\230\341\312\220}\332R0\352"
+	.ascii	"\022V\263\032\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_.symbol_nodes.20301e96d563cffc,"e",@progbits
+	.string	"(\265/\375`\344\003%\022"
+	.string	"\246\236sH\260\232I:`\356{\216\305b\200\222Qig\347\027\206\007\265\361=\211\334\345\3309\026K#"
+	.string	"C\332\342:\303\036B\325\327\032T9\345\007\375\007h\216\031c\356\267-"
+	.string	""
+	.string	"\b\265\241\326\244E\370\312\016\216\332B\210$2\005["
+	.string	"c"
+	.string	"a"
+	.ascii	"8\022\266k\270d{\225\332\255\276\236~\226\216\247\217\245\333"
+	.ascii	"\321\247O\347Or\036\006\347^n\336\345\263y\327\261x\310\250\242"
+	.ascii	"\365\267f\217Rs.1\331\267lY\226e\254\177\245\273\022\370%\260"
+	.ascii	"\276V\267\277\206\263\300\225|\377\273\334\224\372\373\247j\241"
+	.ascii	"\336\234s\022\350[\351\376{W\001J\034Zs\033ZOhh\r3\264.\001\265"
+	.ascii	"\242\300\320\312t\2415\205\205\326\246\n\375/\024\372`&\264:"
+	.ascii	"Ih\205"
+	.string	"\212\320\252\002B_\213\3169\177\360A\237K\035\274\301\2150x\223\005g\242\340W\t\356\004\301\311\003\3072\360\254\237K\371\376\022GIH#p>\247\362\375AIABICHCG!\002!\310+\202\324\230\2470\307\303\013\206=\2740R\275\034L1j\2744\242\006\310\335\250\361\016 \365\325\203\251\306\373\"U\247\004ya\343}\211\372\r9\322\345\303;#\316xgB\225\331B\322D\343\025 \252\f\312\016\0270^!\325\032]\264\252`\336\322tAoA\264\256\370\320/=\264\316\016\255\001\007Ro\3169\177d\326\204\250\236\016\032\\1^$Rc`D\021\221\361\036\215\252>\240\242jx\215H\375\200\224Ef\274F\243\252\324\370\203\306[$j\227\3454e\303[\024*\200\031I\250nxq\243\252\220)\021\207\227hT\032+\034,@^\"1\207\367\246\303{\033\265\213\262\241\264\303{\0138 "
+	.ascii	"\003!\242:7A\204S\277Z\3246{!,p\352\034$A\022$A\022$A\022$A\022"
+	.ascii	"$A\022$A\022$A\022$\007\311\027hgY\372,\205\311\260\205\0224"
+	.ascii	"?p\221\307.\017\331 \031\350\350\216\244\321\261\301\300\036"
+	.ascii	"~sR\273\307hY\346Ak\325\222\2561\302\020\007\245\215\272Q8\302"
+	.ascii	"\303\006\242c\221c\356\021\275\022\350\023\220\232/\226\001"
+	.text
+	.section	.gnu.lto_.refs.20301e96d563cffc,"e",@progbits
+	.string	"(\265/\375 \322\335\004"
+	.string	"b\314#)\200K\322\032\323\237\201T?idDFdDFd\016\fa"
+	.string	"\001\200mm\255\215inn\266\265F\310\366'd\023\"e\n)w9\313U\230\311\025\234\343\b\030\201\033\270\347$\314\306\254E,\340Z\n\2617\226\255\361\2603\036\307\270\260\260WL\250K\250#\242!\226}\210vP7\330\f\353\005\307\n\220M\200F\210>\200\354\305\266([Y\226\262\354d-Q+\347\306\371R"
+	.ascii	"\203\021gHZ=?\316)mR\207\331\230w\315\266S\004\003\024\003\001"
+	.ascii	"\020-\004H\001"
+	.text
+	.section	.gnu.lto_.decls.20301e96d563cffc,"e",@progbits
+	.string	"(\265/\375`H8E\364"
+	.ascii	"Z|\231TV \fa:\215\001\300\207>C}\b\013\302=~D\207aha\206=\253"
+	.ascii	"\355B\022\177\361\236u\036o,\301\037&\"n\232\257\210\335\026"
+	.ascii	"\032\"\301\214\021[s_W\b\206\277yM\321\300\275\035lv\245F\211"
+	.ascii	"\302\271\030\254e^m\340\251yH\017E\225\326\266\224R\246\230\004"
+	.ascii	"P\005u\005\371\036\226\250\261)\211\303\302\344\202eMY^\344m"
+	.ascii	"b\225\227\311\r\273%\263v\267;^TF\214:\337L\352\233\\\372f\225"
+	.ascii	"\276\331Bc\360\203\254\001\305\343zu\371\200x1\335\374\016G&"
+	.ascii	"_\270\304\216C\226\312\216\\$\327\310Mb\225\267\353\026\371E"
+	.ascii	"n\242\256K\004\271\243\032\360\026\346\353ko$\017\n\2321T:\371"
+	.ascii	"Y\213~F\323\317a\372\331\210~\266\322<5j\3240\336|\033\206\306"
+	.ascii	"\306\371(\001m\246\025OG;w\265\356\276Lx,JGq\342fy\235~\242\333"
+	.ascii	"\302\316\306ys\354 \346\306q\357[\343b\335\253K\343\352\270>"
+	.ascii	"\356\216Ku\247.\217\033\344\366\2702\256\t7\353\342\2709\256"
+	.ascii	"\215\273u\201\334\252ku\177\334\031\367\206U^\255\033\3437\352"
+	.ascii	"J=#\367f\242K\363byf\t\365%\005'.]\254\226c\310L-\277\200\311"
+	.ascii	"a\303\200\241:\363\023]\026l\216I\333\306\276\211cg\331\334\035"
+	.ascii	"\357\212\2466\3072(\3048v\370\211\256\326}qa`\3441\207E\226\231"
+	.ascii	"\345\336\373v\316\f\214\245\007\013\307\276\201s\f\263'\200\321"
+	.ascii	"\261\246\316\272a\344\261\027\245G\013,\277ZV\316\306a\244R\263"
+	.ascii	"xR\265\f\373\211\256\013\353\346c\004\332Kqg\216{#o\271t\340"
+	.ascii	"\341jY5\326\r\204\246\275\303\226li\230J\323\001\307no\244\006"
+	.ascii	"C\032\344+B\216\224y\220\357\233\265\300[@\032\375\013\303\315"
+	.ascii	"\004{\227\365\272\356`\320\335|\237\210~\241\006\220\326\266"
+	.ascii	"vsoN\037k\321\307h\372exL\037\027\321\307b\274JV\251\341.\335"
+	.ascii	"\336\331/\317aB\356d\216\\\232\034e7\037o\351[\r\274\037\253"
+	.ascii	"\201wl\2453n\322\277`\264\233\\\303\255\007\327\315\277n\372"
+	.ascii	"7\251\177\215\350\241[C\377\266\320\032\342\350[:\r\002\n\372"
+	.ascii	"6N_\231E\377\355L\177iD\337\316Z\340\335R\351[\026\372B\375\023"
+	.ascii	":\303\233\365b\225\031X"
+	.string	"\270\033\004\216\231\223\233\037\002}\233\001\017\337\335\331\fx\037As`-\360l\026\253\305*1\260[\260\221\354\247'\216\2228nn\276\005\364-\006<{g1\340\335\203\316p%\003\315\304&%\314J\233E^)\201s\363m\333o\245X4[\305^\355\315dW\230\201J\263S\254\022\203]\273\245b\331n*!7\322\322m-I\335\fd-\360.\003\264\220\322\366p\255U\260\267\305\300\263ww\026\003\357^Y\013<\004\230\021\335\236\371H)yrvs\220\025\342a\350y\255\351\320\212\002\205\307BG\262\313\315\267P\354\223\253\335\253\275\321\366\336\027t\2135p\332\334l\267\265\300\003\262B<KFt\353D\210\0275\205\334?\021\b\302c\311\315\330\n\361l\230\025\303NOW\273lodP\017\314JV\331\315V\354\332&\026y+f\231\274\003\017\347a\332a{#\255X\336[\311\332\002\370X["
+	.ascii	"\263m\210\222\023^\376\325GZ\013<m\205xa\337\371\361\030\345"
+	.ascii	"\334u~\254\345\277F\013\374V\204\337r\340\267\"\376;c\nV\332"
+	.ascii	"\177{\240\375\327\206\224K\344\354\277]f\027\314\035\213B\005"
+	.ascii	"\345\006\340\267\027\276\345\267G>\342\307\007\270\032\334'\267"
+	.ascii	"\204\344\177Q\340\344\277\002\206.\370q\225\t\375c)\274\342\267"
+	.ascii	"\035~\353\301o\211~\353\341\277:\377\315?_`#\273c\303\337N\340"
+	.ascii	"\267\024\370\255\004\376\373\341\177\376\363\n\244\230\t\377"
+	.ascii	"\365\375\267\004\377\035\301\177I\360_\021\374\367\304{\177\216"
+	.ascii	"\362_\242\377z\360\337\016\377\345\340\277\033\376\333\301\177"
+	.ascii	"?h\362_\001\374\227\001\377\335\200\311\377\237?_\371o\330\177"
+	.ascii	"\227\374\367\353\277I\376{\344\277\307\377\n\371/\220\377n\375"
+	.ascii	"W\353\277Y\377\325\361\337\034\377\255\372\357\324\177i\374W"
+	.ascii	"\351\277)\370o\212\377\256\377U\377K\374\257\360\277$\374\367"
+	.ascii	"\367_\r\3747\003\377\255\300\177\035\360\337\006\374w\347\267"
+	.ascii	"u\277U\363\333\271\337\212"
+	.string	"\371\255\334o\337~\353\366\333,\277\275\362[\266\337\256\375V\355\267i\277=\373m\331o\223\277%\373-\223\337\202\375v\311\177\266\377U\376o\340\377\223\377M~\353\343\267_\277E\362[\374[#\277%\362\333 \377\341~\273\365\333\016\3746\204\3376\340\267\037\374v\203\377V\376\267\375\217\362\037\n\362\377\b\377\265\374\357\271\273\273\273\373s\331\317\343\365g\240$dmi\216\325\364\306b<\305\321\351\320y\001\023\206\016\215\316\2141O\332\264\314\037nf\240\335\274\304\306\377\033g\031\202%\215\026\0312x.'\001]c=QQ\310l\240p<\207\217=^YJ\212\334\214\313\340#\217\016/@\276~\244\304\210\261n!L]\031\3512\200\231Xu)\3744}\271U\342/XN/\355\255tC\003\222\036\251.9\254\2331\030\013wd\363\222\202\276O\034\034\234u\313F\262\035C\207E\221\272\032v{c\331"
+	.string	"\233\240\034\363\361\352\362\006\347\207\276\317\215-n\326-\203\233\243\217\013\375\0366'`\301Y\254\233\336\307\236\224\2457\313\236\245~\017\230\2666|E\017\211I\355\314`\262\nc\345\370\312\315d&S\310<a!\232\254EW\23446%f\303M\364\212\275yPe\360\332a\317\244\215\215\361Z\273U\3425\ff\215Qv\35730@\2269C\222\264\270\363\241\246\304j\266-\204\255\253-#C\327\022\356\210\335\336S\033\360\030\233\340T]\241\241\3414;\265\215t\032\300\306\364\230.niiX\210N\325\021\r\354\346\3678\235Y%>\263PB\330B\356\031\027\024\3612\265A\357\214\022\257\2648P\240\34024=3-4`\340(\307e\2743.d\204\271\371kl\334\377\234,\3265\245\365E\3372\2618\251\304I+6\264\215h8(2\026\205\334\340<k\372X\f#\217\307\224x\f\223a"
+	.string	"\271cX\240dG\034\026\273=5\245a'\314\214\314\2265\307dV\214g\357\013r\212te=\335|\236\034\372\376\274\255\024\265\367\226a\"w\324\022\017\357\267\267\246\265\032\376\036\213\255\001\366\376\017\302\007\366^J.\325\350.5\245\252\f\373\177\333\233\t\313\030\002\226\024\023\226\r\247$\32662q\031\203\2426\226\321)\271w\320fb2\206\270\332AN\311-\265W\300I\331\215\3042n\246\253\035\264\231\266R\006'&,)\247\244\222T\220S\022Kj'\2616\320fR\212j\301\264\243\202v\022\013\315N^I\0019%\257\244\234\222XD\354\233\026pT2\356\226=\356\254\321\211i\303\200\302\241\024\005\364\346\204\274\332b\366\266eM;\312"
+	.string	"{\343\270\212\022\243d\303*\227\336`,\241)]Y$\324R\326\325fzs:r\265\367\221\245\243\r\345\201\021\371\266\177\3307#\017\034\373\251i\357"
+	.ascii	"@\355m\264\373m\357m\334{\367\242p \367\246\002r:BA\355=5\004"
+	.ascii	"\265q\030\327\232\366\276ed\224RN\311\254+\2425(\311\343f\201"
+	.ascii	"4\332\343\026\203\025\245\223\306\261\375\224F\037\245f\320\335"
+	.ascii	"\214\231\350\324]A#\022F#\221;J+3\0327\343%f\npkI\266h/\374u"
+	.ascii	"m\2740\"C"
+	.string	"\315+\tF\322[\363\305,\013>\202\201G\213\334\331\006\323E\260\221\234+*'J]E\360\020\314e\225o\303D~\\1\376\b\242S\364\336\306\303Ax\356\302\304\211Q\001\301?\360\326\031\034&Ww\013\373\270Qqh?n\326\352-\241\204\024\271\371;Pe\200\034Q\370q\224\013\303u\002\02736/M\216X\306\bYri;\001\303\3008\260\016l\002~\201g`\031\330\t?a)\214\205i\340*\274\003\273\300Q8\007n\201\2630\024\276\3026p\017\314\003\337\3005\360\024\246\3021\254\022[a\343\261\022^z\036\363\345\213\256J\226\345\to\313\034s[\3073Vd\202\034\315\350\260\202e\331\245\214\r\313\224c\231,ing\313\270%Klu\323\340\215\221G\021\226\252\226a\330\n3a\026S\226\264,\347\304d\r\331\"\345\262]q\242\006\007\206\005[]0D\226\367\004lu\2658A\323"
+	.string	"\351\214\223 \021\310\270i\247\013Z\034\2146\032\257x&\273B\366`\245\032njet~C\343\242\217\367\177\321\\\272{g\202\275\231nV\232\245\265\233\343\f\345,\031\303\246\344\346\353\\\321\367P\007\343\350\346\302\271m\254\362\276\271vllb\274\271)X7\3736\265\215h<(\262\326\365fH\003\rr\344zx\241\323\371:a\372:H\364u\272\364u\212\350\253\206\350w\315\016\023\2153\256\233s\206h;"
+	.ascii	"\035,}\035\023\364u\232\364s\322\350\347x\321\3171\323\317a\242"
+	.ascii	"\237\303\245\237C\245\237\323B_\214f\243\257\305\350\353*\372"
+	.ascii	"\032L_\363\320\3271\364{o\364{b\364{V\364{Q\364{I\364{=4\007"
+	.ascii	"\275'\375\236Q\237\267F\237\367\246\317C\323G^*kmp\260P\271Y"
+	.ascii	"y\325\254\362\256\335)d\367\314\276m\205h\363f\271v\245\3344"
+	.ascii	",7\307\2757\006\r4\320\241\003B\305\313\347}\351\344\316\214"
+	.ascii	"\26717n\356\200\350\027\215\367Ue\007\233#\332l\250\307\307\025"
+	.ascii	"\022\0357\237\207C\337\262=\261U|\314\275\257\316\034/\024\253"
+	.ascii	"\274Qn2\331!\312ub\253\330\267\255\235\241\336\316\320}\ri\200"
+	.ascii	"\331$\335\226\274|3\215\276\331E\337\314\242o\262i&=K\340\226"
+	.ascii	"\030\271\001uB\222\371\315\217\230\253\036Np\023\375\266\214"
+	.ascii	"{\"\313/,\223\345\030r\f\313\345\246!_\330\220d<\263\037YUbf"
+	.ascii	".\234\025\2327\263I\216\263a\026\226\345\346\260\260l\007\001"
+	.ascii	"\270\270%\016RC-\316\306"
+	.string	"\222%\230,\004G\270#_\231\r\022(,7\037\303\322\327\027&C\302\346\203\312\356j\201\241\266V%I\022#;7\334\326\300\322\214\0301\217\260ee\241J\303\005H\327\315#:q\232\320HQ\302\001\231 C\\\\\\\346\321\303\f,+_\267K\f\232+Dn\036\363\017\024L(#\346B\006\233U\034!B\314*\233\006\027\347\r\257\016\253\315\n\024 @\362\033\013\230\030\353j\330\341%-\344t4\331\3322\247\206\256\360\031\2546ol<\2611\344\346_X\321\243\207\2515t\205\307\320\221\251\343\345@\263e\312\315Zp2\306l.;v\230Y\026\b\271\024\327\246)\013\311\024\326\315,\023\214\n\322\206[V\035\nji\246\016S\207Y%\001\2624Y\276\300\302@\251\355\310\221\303\254:f\332V[\216\031)\203\305\030***\263j\350\n\227\221A\246\356\313\314J\362\250bV\301\035\341:\273\371"
+	.ascii	"h2k\2305\314\251\241.\344\031\272\nJ=\2166nNa7 ]I\013f4\323M"
+	.ascii	"'\223\311\244\201\345xvO-\213\031.v\333iJ\303\316\330\2131/1"
+	.ascii	"n\322\2709\243\003\017\237\323_I\344\224n6e\334\224\232r\243"
+	.ascii	"\262\274\371f\224)\325\325#\351\245\246\317\200\032RR7\2330>"
+	.ascii	"\367#sOhn6\241\3366\025\306\316\307\323\271d\305-\335l\2660]"
+	.ascii	"X\345\265\230/\356C\205\205\231\2262\375\025\330k\341\231M7Y"
+	.ascii	"P\261\352\201\205\324\277y&Wu\274\371\026\300\364-\034\211\023"
+	.ascii	"\307T\262fpd\352~\220lkW\246\361\246\222\231&\b\232;s\363p\354"
+	.ascii	"P\2623w\276\223\261\306\245&\337\335)\0300\222\031[\232Rh\323"
+	.ascii	"&\277\031\272\302a\340\344\324|\365t\221\241&\345\346\371M\317"
+	.ascii	"\232'oM.\023\217K\2147m\250\350\327=\327e;K\006\027\267\324\340"
+	.ascii	"\023\247\345\342EN\341\331\356g\t\211\220\264\256\236\257907"
+	.ascii	"n\276\005Zj\224Y\315e\n\241l+Iih\303\202\243\n\032\362\346\265"
+	.ascii	"\206.\323Y\261,\266#\n\313\006D\312('/\313e6\323\303\005\006"
+	.ascii	"./7\244\314\375s\331\f\227\022\215\006\323S\217\335\016\253*"
+	.ascii	"]`\236\313\200\241\313\232\312Y\022A\001\354\346<&\223\021\023"
+	.ascii	"FN\350\306\224\347*V\231\247\3448\rS{\206\206\256+g\207\302\231"
+	.ascii	"\233\341z\300\324\205yr\363\205\232\364[\356\222\3352\227\274"
+	.ascii	"\305*\263\227\234\345\271\315\256\271\375\242\305\212\3317\004"
+	.ascii	" Y\206\371\262\263\302\345\001\213\220\343\225!\331K>\001\311"
+	.ascii	"1\314\327P\357,I\230\035<\371\025\320\350W\340\242_\241M\277"
+	.ascii	"B\231~\205$\372\025vh\223Jf[S\252U\330h\031\r\313e#\320\336Y"
+	.ascii	"\\\360\022\226\344\0243\311\347\263d\366:\321\224\023\227\005"
+	.ascii	"\204w\002\330\323\327\315\271,\233E\201\362\004\013\330\363X"
+	.ascii	"\006\313d#L\260\2458\021\262\304l\316\342\304~\202$Q\203\272"
+	.ascii	"9\213edn\222\231\344\260 0%Y\tn\222\235\330"
+	.string	")w\262\256\352\212\370\310P\3176\2542Ce/\242\245\255\264d\001^;2\023!V^nN\202|qCJP\030U\306!&\231#W\205uY^e\254$[\226Xxd!\366m\nh3MA\341\230\255r\225\2171ho\036\\\216F2\222|$\027\311Dr\227U\346c\316z\236\3127>\224\217Y\207\215\263o[!\204\271-w\344\326\020y\363\311T\237\273`\311\t\003M\310,\263\220\334#\007\261oS\310-c'\315\210\217,C2\227Uf!\037B\356]\206\241\307\315\030\273&\274 @x\224.\252X\334\234\177\330\244\226\027<\306\370\260\312\274\365\303\302\b\034\256\233\263\326\347Z\030]\274x\233\tk`nr\372@o\372@l:\357\320`\2269\270\244\351\003\231\351\003%\365\201\302\364\2012\216\\e&\263\250\341Ru\343\334\236\226\272\364\325`\205x\231F\256\361\263D\251%\305\204\r"
+	.ascii	"\351\"\345\346<\343j!r\204\222\341#\206\313l\354\346g)S\312\235"
+	.ascii	"\232\0337\347(\335\004\324#\003\235\034StT\335\374\034\365c6"
+	.ascii	"W\356\004wpR\2709\303 z\216\301\305\312R\354f\036+\304;\020\224"
+	.ascii	"\276Ub\261\335\263\013\273\374B\303\224RV\006\257\"86\370i\342"
+	.ascii	"#\210\027d\231\022\"QQ7\347\246\354\224[\37499lOq8V\350g\026"
+	.ascii	"[pC\220\334|3SN/,\212\311\354\346\003m\375\254\224\227\376\034"
+	.ascii	"\fg\013[\013;\375l\\A\231\035Jn\316[7\375\214\311 \207\f\331"
+	.ascii	"\\\220\233\237\367\217\335\3302\370\251j\352\314\315\030\016"
+	.ascii	"\216s|\207\337l|\347\301\325\336J\370\356\347\315\336J?\326\026"
+	.ascii	"\300\332\002\344%YD\316x\371?_\264\217\025\342"
+	.string	"a6D\307m.\2212-Zn\356\371yRW\207\267\260\323V\302\002\241\210\324\317\2223g\260\032+\001)[K\f \003\253\020-\242\352\b\240p\bB8L\213i\206\340)4JQ\244\350\017%Q\024\221B\305"
+	.string	"\025\201\026\235\305`z\026\001q\030\246\274\037m\b\200z\256%,\370\321\006\243\024\305)\344@\364\241H\303#_\211\021\"\\\030\252\347\211!\241\b4\b\024\236G\n\030\201\032\001]PQ\224\256\303\r"
+	.string	"\205\037P\024gQ\bI\375\240B]y@4xB\250\210\006\177*@\234H\203'\210\025-\361\373\235\027\204\251\272\0269\240\300\244\340O\230rP\213I\034"
+	.string	"\020\f&\t\205Cao\365\361J\030\252G\353P\330+:\321`^\321\"\022\212\304+\342\360;\327 \032b\250\242(\316\022@\341\007\025A\"\361<\300\2176\240j\322z\242E\275\037m(b\260\300\007D\230"
+	.string	"\361\301g\201\020\034\030\301\007\202\204\257\204\b\r\230\020Q\202\303\212\032\251\347\232\201\204\3370\b\002U\207 ~\200\305\023\004jz\nY\270\200aE\213*\212\002U}\026\024}\0254O\020j\264\026\317\"\237o\r\236\026\250\031\202,\\\240\2028\004!\264\376h\0031i\250\032\241H\247z\0229 \340'L\272\300\212\026w\204E\327,\372\214\204FDShD\304\350\t\322b.\026Q\025\b<{*\210\303_VW\"~\217\nu-\246F(\t\337\005 *4J\203g\017\210\026\223r\261\367s=\201>#\342\006\037\365<\372e\037\021\t5A\302\2108"
+	.string	"\035\020?\022h1I\350\207\006\213\320\020+jd\001\272\236kQg5J\213\204I\004(\032\235\301\013\354\364p\260\301D\210\237\372\343C\264!\304O\005\322\035l(\252:\305\037\211b\021\375\rU\342\005\013H\350ZTQ\342\347\\\317\020?\225\027L\372\005\317\337\005\240\360DB\032\202\370\2519\302\341p\004\361\203P\004\252\236\030\220\324\017C\023\025\376\373\240\016/P$\341\227\256%\214\204i\321\003\305\024"
+	.string	"\377\245**D\215\364=\370\200\001\037\200\220\242w\020\036\300\301\0038\340\035\204\007\020\021=\340\003\"\375\017\210\360\272\242>\224\210\242'xV\324\007\024\221bx\242\327C}\305\244\365\\K"
+	.string	"\255(\t\020\300\224X\301\247\350C\203i\321P\035\001L\211<\353\2176"
+	.string	"S\"\207\241\020\266\350\003\001\230\022y#\254\b\013L\211\270\204S\205\316\t\216|E\304 \317\t\216|\212\212\206k\322\317w\364[\207\302\n(Q\305\352S\3215\230\026\371\202V!\372S\321\021#\210I@a\n\202\013;%\234!@J*\001L\211>\302\242\020%\"\rA"
+	.string	"\323\021\353y\002\205\2200\035a\375"
+	.string	"L\211@?*\326\024E\272\246E!Z\"\210\242@\203@\353\017-*\022B\201C$\337\252\242\304\024\250o\r\246\253O8<A\252\016\217\206L"
+	.string	"@\230\236\"\250\303\017\251\005$R\234A\224D\005\024\004%\220Tt\005\n\221(\341T\021\264\246H\251\006>\370"
+	.string	"\215\200Va:$\256hq\bEJW\235\235\323\002t=U\237\212\037\252\372\216\212\247\372\023J*\341Tq\021\n\364\255\027~\264AE\203\350\357wr(\252\303\242\020-\032\200h\026}E\244T51\002(\374 \024\f\016\325\\D\223\202'\n\236\2210ERO\037$\365\364\255E5-\362\t\207\276\340\371\363\rU\025F\026\216~kZB\321\027\f\246$TPq\006Q\240\017I=\213)\320\027\364\243\013BtX\217\214\322`\021P\t\303\240\317\221Qz\364\003\354\020<\3255\t\025\346\240\301u\035\252G\253\017\330\001(<O"
+	.string	"O\024(\364\243\r)T\016)T\241\017\211\250\312a\035\016U\016;E\237QZ$\034\202H\241\352\020O\244\237j\252(0E\221B\r\236\251\212\026\203\204\303\264XL:Q\364I\201\006\211I!\212\202\347\221Np\370\033\256C\225\370\263\372:\350"
+	.string	"LsVa\322\360\347+R})\261\350K\241^@\201\251\252\242(\206>a\232a\365\365\214N\023\303\324g\224\024$\016\005\255h\021U\207k\322\351\003\n\323\023\276\365,\372\220\222\324\225\004\224X\024"
+	.string	"\017\032<\177E\235UEQ\bS_Z,\252;?\025\230\"\231\302\024I\223\360C\217~)N$\375S\004\021<Q\b\207\351z\006\207D\025]\205\"~\352\205\"\212\252Fh\b4h$\374\200t\202@A,\252"
+	.string	"\f\016\217\212\250zd\002]O\024\351\372\373\200\002\207#\250\3519$L\365\017-&\371R\250;\253\017\204U\230&\365\202\250Px\036\375|)\222N_\212\023\351g\365}@\264\n\323\336\035\340"
+	.ascii	"\020\031<\260\001\021\364oC18TW\341\360\347\373\251\034~E\034"
+	.ascii	"\204\351\211\304\341\247\0269l\020@p8\254\200\317\274\271\206"
+	.ascii	"W"
+	.string	"`\256]\223\315\244rs\355?=1_NJ<\245\222\217R\310\017-5\032>obw?\246d\371\330e\001\323\"M\013\016\027\027;4s\312l\223b\334\222b\036\205\330\230\323a\236\231G\240x\225)\273\031\031\306\023#F\220\2532\262\n\320=\365\2709\212Y\225\315nleA\301`!\266HA{b\327\203fI\204\243\250\303r\344qH\231\221\030\202\314\240\231\231\031\322\244\003\243\024@PxX0\231*\264\360\r\023@\322H\324\301\024F\231bjfD\024$I*\331\347\326>\265B\307\277y2\222\326M\240B\371\246\306\331\021Q\233v1P\004\375\300d\305T\260\302\343?a|\346\2379\025!\35308c\210\337\261\350\003?>l\275\335k\231x\337E\305F\275\340mm\226\233\224\246\355@\"\314\277p6\022R\362\366\256\343\216uSW(\375h8\337HUi\252/\3179\016\213\207\242"
+	.ascii	"\203Y\352\023\001+\003\352\234\017P"
+	.string	"\277\251>\275\241\243\217\fHA\n\035\374|\216;\233\007\272\243\361(`\262\327T%y\361\212\331\025\271d\254\213+'\272\247 \235S34\267(\377\312\375\354;#\372fp\200J\001j\366\016BdM\364U\304^J-?.\344M\023\300\3141\204\321tU\312\362\247\260\263\360Uj6\275\200J\217Qc[\332h\363\346\256}|\376\201J\177\204\325\326\207.\330\020\313UH\022F=<\355\007\306\302\206T\254<\016VN\031\212^\304G[\240kqQ\024\277\"\025\035z\024\272\320B\"\262\035x\361\b\362\266\200\3048Eo\006\301\247\301\302|5\262+}\by>]\357i\370\306Y^/\276\306\306{!\001\005j\003\276\360\206F\271\032\322r9\003\331\316\363\361\224\260\037\211\263\340\021\030\272L\005\360@WWrd\3060\r.b\007\334S\260\305\203\332!\311j\332\177\245Uc\374\255\2668\237d!"
+	.ascii	"\250v-%O%?\244\236\327\252\266\235\364\361\3114\237\223\203q"
+	.ascii	"[f\300\020\306W\013\372\025j\3759\255|g\202{\330\223\245\023"
+	.ascii	"r\357\254gN\36384\244\230\326\021~\223\177\347\3518\250)\267"
+	.ascii	"\214~@\205\217\206\231KN\200\316'g\t\220\r\204\202\001m\200\200"
+	.ascii	"\n\250z:\324\201\314tgB*]\344x\224\3066\377\240\037]\001%\372"
+	.ascii	"\312\212\356\235\330w)\365\275\210`5\211\331\027&2\325\204i\360"
+	.ascii	"\324\350%\373\204Qy\265\017\325\376\b\224't\355\0169\357\315"
+	.string	"\237b\260\313\205@\220\310ei)G\240\215\3221>@\267!\235t\362\003\320\302\327R+\365\320\300\273\001V\331\272nYxja5\213"
+	.string	"\372\022\313\361F\363\277\265R:i\243\023\031h\375zzZ'pW\310\nk\352*<\240@B\261\347Y\357\342\373v\233\224\330\326\336\006k"
+	.string	"\nt\256q\372b\341c\233VT\271,\313.0\t\221\301T\003\271\001(5\253\201\002\320\243pJ\265\314{\276\344\252\353\"\233>\322\320\323\321\375\327\270-\210\f\035\003\177bY~\274\036\370/\032\b\320\207>_6t\350W3\310\253\002?\017\332\202\254\326,Q\277T\317\237\0253GP.Sa!\277\007\2733\n\204\323\333dG=\n.\224HaW\221\311\005SFUjc2\314!\212\r\276b\257\345\250e\324\245Q\270p\360\320!\250n\334\034A\262\031~\303>\3729\344\345\314\227\023\371\233\347\035~\302\346\035\021?\36699\261\320\222\332\202\257(\222\314\2202\230Dh\330|\n\240:A\205H\006\326zl\2238\305mT\343F\305\230\245\364=\266%\376\342"
+	.ascii	"1D\207W\013\344r\354\366\365\273$\305\303/\322\264\bQ\232\275"
+	.ascii	"o\360\035Dy$\bIC|_\031\314\351\343\024\247\206\rdonD\212\301"
+	.ascii	"\034\201Y\225\033\253\204\023\020\216\314s\223\227\226\205\265"
+	.ascii	"\256\320\002:f\026\037,.P\346d\220\200\204G0\361_>,\013n\213"
+	.ascii	"\341\343\255\362\374Yr+4D\200\326\354\361\361\310\257\211\213"
+	.ascii	"\024<hff\245\316\256!\344_\ny\273u\247\264\351\371Y\217S\016"
+	.ascii	"#-\034\342#\034\311xT\327\b\254\330\341\323\217\352\031Lw_\263"
+	.ascii	"Ob9\250|\275[\036R\226\204+\330>O\354\244\t\247\3550\246PY\214"
+	.ascii	"h7\340cR@u\0170\316\t\022t\027\020\370\343\006\tB\241\034Z\337"
+	.ascii	"n3Ys\247\335\007O\223\300\301\017F\246\217\241\356\rF\245\372"
+	.ascii	"\363\001\273O\371F36H\351\275 \223\273\267\222\204:\370P\nl\013"
+	.ascii	"\301\354\272\261\020,\264\340B\360M(`\244\213d\343H\246\3041"
+	.ascii	":\027\by\277\345\2437\321\227\254\030\262$\204\316s\275\030\367"
+	.ascii	"D,\374\357\247\t\202\261\335\315Rh\310\017\331oW\215\312\362"
+	.ascii	"<\305*\212\352\247A\007\300\220 \275\215m\201\316!\034<e%\027"
+	.ascii	"\216G\252N\235x{\212d\205\236n\374\372/\036?\375T=\263Z\374\323"
+	.ascii	"\230\364\022\202H`&\252\322r\252:\235\372J\340x\325\256z\325"
+	.ascii	"\370l\200\311q\327\204\375\024\025\321b\352V4^\273\025\226\345"
+	.ascii	"wP0\2647\344\266\366\3254~\320\216\266Q\330\257%\304\335%\323"
+	.ascii	"\363\325\n\266 \317\342@\271l\3670\353\237 MD\372\373\256\203"
+	.ascii	"N\264\363\313\265\362\355\375\373\323\230\255\371e-(@\370\201"
+	.ascii	"\2530\3564k\274\222\303\347k\276\343\232\0352\263\005SE|\235"
+	.ascii	"\241\024\251s\302\201\202\371+\233\245\261E\233\024RP\335\265"
+	.ascii	"9/\037\213\362@\316\373\311\031\261`\342\346\314\030q]\267\255"
+	.ascii	"c.\213\367/\272On\363u\302\313B\254\323\301N\207'\345Xt\342\325"
+	.ascii	"\270\336\200\337\261\307\314\336\322\2542\370c\016\227\263\021"
+	.ascii	"*_\2128\036\211\304g\346\203\311&Rm\302\025\276\2036*W\206\251"
+	.ascii	"\033\255\034\371C\317i\203p\021S!u\275\344\373\226\304\262\316"
+	.ascii	"\300X\364\034\244#\225\f\3324MQ\372\217-\211|\250\233\023\006"
+	.ascii	"z\006\204|\026\225Ix\357\36737\275\316\255\223E \315\252\273"
+	.ascii	"3(N\3567+\256\260\201C\037\232\340#\223EBW\373\363\030\270Z!"
+	.ascii	"\347Il\323\377\276\372\213\271"
+	.string	"+\330\312H\245\230\016\342\240r^\374s\303\316\226\311\243:\\\357\267\274q(\247\350\004\337\357\351(2d\013\335Qr\005\363\327\237\230\231\021\3008$\350H\205\002\201\315\034]\311\255\206G]\236y\246\353\031M\232\357h\335e^\006UW\001]\222\2449\334\340\376\265Q\302\250\306PaS\311\226\r%=\236m\200\344\367l\005\301\321\204\342r:\316D\256\240\232\004-\212\272v\036\036\020\316\362t\222j\356\367s\305W\206\257x\033/R\"\301\rV\245\361\342\267\200\242\235\332\301\350\001\201H\311l+e\331X\235\245\273\220\235vB\311;\337\372\207\20104Q\221\017=\3547j\263\2427\300\233\356\332\2318I\351\205\307\004M\226\217\237a\022\003\232\243l\\\366\177\\\357\337\034\366\b\333\306BP\005hl\2523\364}G^\005\257\357\275Q|\330q\331\215b)L\177\321&\3554\357iC\250\034\3441n"
+	.ascii	"-P\273\203+\n\345p\361\216\037\204\ft\260\255y\271.\336\274\323"
+	.ascii	"Q\205\352\273SmPr\254(\217\222\234\1773\b9AW\231s\3038_\f\352"
+	.ascii	"M\257\302\035\351\207S\242F\211F3\242\222\234\307\255\321\225"
+	.ascii	"\302\033\272\210Q\3376\252\2343\275\035\013e\235\032\322\004"
+	.ascii	"\354\326K\314\351PG\rs\357\363\215\347\207[o"
+	.string	"+/\376\214\027\207\360;H\357\026<\016\030\265N\237uf\314\323\b\370\033\033\304\017\311QZ\024\314\252\256\177)\206\241\022\202Ag8*\213\241E$I\t\367\260c\220\035\327\217\005\260\202\300\023\356\354]^\371\t8i\351P\352\307\n\276g\220\324\244\334;X\357\354\3602\310\230\013Q(\016}\207|\034\305:6L\221\341! \350hG\f\344\257\305iK\\\334l{\363\377\333M\232\364\205\320\236muo\031_9\266\205\322\323ZzC\025\213\024\334OI\333z\333c\036\275E\335\024\357\223\266\205\355\006\222\265\2270b\002\356\214\260_\240\304\245\342\001\244\331\004cv\320tF\n\211\212\257\017\272*L\344\220\\\376i\240\200RA;\316l\013\024M5\260\335\354\357F\370\347\252\241\301\367[\247\373\356\027i\353\243\227\212(\007\276J\337{\006\242\365\203\357>x\024\201Z\362R\265\264\337!0\271\377\3102"
+	.ascii	"*V\370\200\240\002|\033H\2637q\\9=D\365\033\2573t\200\031%QC"
+	.ascii	"\"=+\322\3675s(w\t\306\030\277\005\243\031~Z\267\356\270\025"
+	.ascii	"\234\214\245\203\313i\3639~2\r\246_\222\377\310k\"\255\0039\347"
+	.ascii	"\321\316Q\177\343\215_\352\f;[|\374\352=\352\341\264y4m\242\362"
+	.ascii	"\317\316\316\357\341\372G\375\2111\211e\270\355x\017\211\037"
+	.ascii	"\214<W?{\247;Y\314^\002n\n\325\244\364u\231\026\305\267\345n"
+	.ascii	"\330\233*\357\004\224\217Z\2341|\310\265\305\3552\277K\206\236"
+	.ascii	"\273\f\202x\372\351Q[\364'\342z\243\037\"wA;\244n\206~\212\364"
+	.ascii	"\200T{\344\375\2765h\367(\343\001\346^\365\177\310\267\204\201"
+	.ascii	"\344I\262\364EPk\305G\323|D\223\317\004\321z\026i\246fpLv\037"
+	.ascii	"\227S]\2259\265\256\346\340\261\030"
+	.text
+	.section	.gnu.lto_.symtab.20301e96d563cffc,"e",@progbits
+	.string	"isUsingSticksForArming"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\001"
+	.string	""
+	.string	"areSticksInApModePosition"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\001"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\001"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\001"
+	.string	""
+	.string	"processRcStickPositions"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\001"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\001"
+	.string	""
+	.string	"getRcStickDeflection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\001"
+	.string	""
+	.string	"useRcControlsConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\001"
+	.string	""
+	.string	"pgResetTemplate_flight3DConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\002"
+	.string	""
+	.string	"flight3DConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\002"
+	.string	""
+	.string	"flight3DConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\002"
+	.string	""
+	.string	"pgResetTemplate_armingConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\002"
+	.string	""
+	.string	"armingConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\002"
+	.string	""
+	.string	"armingConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\002"
+	.string	""
+	.string	"pgResetTemplate_rcControlsConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\002"
+	.string	""
+	.string	"rcControlsConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\002"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\002"
+	.string	""
+	.string	"rcControlsConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\002"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\002"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\002"
+	.string	""
+	.string	"applyAndSaveAccelerometerTrimsDelta"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\002"
+	.string	""
+	.string	"accSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\002"
+	.string	""
+	.string	"resetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\002"
+	.string	""
+	.string	"tryArm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\002"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\002"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\002"
+	.string	""
+	.string	"handleInflightCalibrationStickPosition"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\002"
+	.string	""
+	.string	"baroSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\002"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"GPS_reset_home_position"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\002"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\002"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\002"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\002"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\002"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\002"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.20301e96d563cffc,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
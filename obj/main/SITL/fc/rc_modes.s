@@ -0,0 +1,639 @@
+	.file	"rc_modes.c"
+	.section	.gnu.lto_.profile.a9a5b7e46af2ef62,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a9a5b7e46af2ef62,"e",@progbits
+	.string	"(\265/\375 \235\325\003"
+	.string	"\024\006\221"
+	.string	"\f"
+	.string	"\276\264\256\247\t"
+	.string	"\001\240\342\234\212\n\002\365\203\345\270\t\004\002"
+	.string	"\002"
+	.string	"\002\001\002\001\003\251\216\231\232\r"
+	.string	"\004\241\357\204\335\001"
+	.string	"\005\226\336\200\374\002\006\002\002\002\003\004\002\005\007\356\222\365\221\016\020\002\006\002\006\002\003\004\002\005"
+	.string	"\b\t\307\335\311\220\003\n\352\300\340\265\r\013\f\240\342\234\212\n"
+	.string	"\t"
+	.ascii	"B\t\313\025p\032\005\206{\271e3\233\223s\300vbo\240\r"
+	.text
+	.section	.gnu.lto_.ipa_sra.a9a5b7e46af2ef62,"e",@progbits
+	.string	"(\265/\375 b\205\002"
+	.string	"\244\003V"
+	.string	"\007"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\003\002\002\002\001\001\002\007\002\001"
+	.string	"\b\001\020\b\006\001\003"
+	.string	"\003\004\005\002\002\002\b\002\002"
+	.string	"\001\001\001\001\001\020\002\006\003\007"
+	.string	"\001\t\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\b"
+	.ascii	"\271@*\301S\002\252\f\3233\314%V\315 7\320\006"
+	.text
+	.section	.gnu.lto_.inline.a9a5b7e46af2ef62,"e",@progbits
+	.string	"(\265/\375`\247"
+	.string	"=\007"
+	.string	"\"M+/\2009i\f`\265C\"\205}SH`\340\025a\265h\027\270r\312\361\351\025\f`\365\260\210;\027\300I\246j\f\315\366\316\266\304\356-\245L\001G\216\247\244\302E\212\004(\271p\221\242\310\017\\%\026DG\377JnTPH\004\371XQ\006\314\213\030h\315\177\344'\247\212rX;C\353\366\223\356e0\354l\353G\247\212z`\347:\013P_f\322\200\264\377\221\370\355\365\226\210:N\324\271\227\0210[\217\277c1!\341\332A^T\024\004d\205V>\032\260s\211e\200\365\t\345\356\256\343\021v7\341\363q\242\030\273\333|36\004\025"
+	.ascii	"x\213}P;y\263\243m3z6(=\303=\340*9[}\337\n\006#\227\025\214)"
+	.ascii	"\353\031^\2005H}TpR\341u\271\342\263\025\240Do3\270\002\f\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a9a5b7e46af2ef62,"e",@progbits
+	.string	"(\265/\375`:"
+	.string	"\255\004"
+	.string	"\242\207\026\036\260%\351\f3\r\240\b\036\206\205\"\fs\001\207aA\271\b\210\271m\255\221m\367\226I\006<z\352\215\242\230\211+\271\340\236\221\246J\243\007\371\002\314F\243$\271p\035\361\207Y\204\320\204k\311\272\254/\221\224R\232<vV\356\225\3534\324\026n\313\f\264\354\350}\032>\b\027"
+	.string	"@\004\315{r\222A\312"
+	.ascii	"M\271\340\313qS \307\001\343_\240e\252\202\023h\257\021\030\027"
+	.ascii	"\361\220\b0\224\302\333\264u(\f3\305\306\262\202E\211Q\236\204"
+	.ascii	"\024\300\r"
+	.text
+	.section	.gnu.lto_.pureconst.a9a5b7e46af2ef62,"e",@progbits
+	.string	"(\265/\375 \032\321"
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"\230\004\002\231\004\003\230\004\004\230\004\005\205\004\007"
+	.ascii	"\231\004\t\205\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a9a5b7e46af2ef62,"e",@progbits
+	.string	"(\265/\375 \267-\003"
+	.string	"2\305\017\031\300%\303\001?\360\357\374\316o\3776\377\265n7R,B6\331d\313\224\002\016\b\005\201\271>\020\203\243y\332\246\225\001\333d\311\320\037m\252\251S3\022\026\365\262t\317V\003\317c\241\036\002\016"
+	.ascii	"8\001P\351Z,(\031v(\252\210\322p\240a\225\253\354g!\370)\242"
+	.ascii	"k\026\263\033\007\024<\200\""
+	.text
+	.section	.gnu.lto_.lto.a9a5b7e46af2ef62,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_modeActivationConditions_Registry.52.a9a5b7e46af2ef62,"e",@progbits
+	.string	"(\265/\375 \205\345\003"
+	.string	"\344\006R"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\247\317\017yw\250\357\006yu"
+	.string	"\005\001\006'\001\240\001)0sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/rc_modes.c"
+	.string	"\004"
+	.ascii	"[\205\240r\3773\211\033@\021"
+	.text
+	.section	.gnu.lto_IS_RC_MODE_ACTIVE.53.a9a5b7e46af2ef62,"e",@progbits
+	.string	"(\265/\375`-"
+	.string	"M\b"
+	.string	"f\320;7@s\322\001\030\214\327\023\016R\022\233\216\226\352\037\034\217w\315}.r\246\325,\002\322'\031\300\240'5-\362\253\b\254\373%\020\033\003\353em:\347\351\332\366\3362\245+"
+	.string	","
+	.string	")"
+	.string	"\266\023\0248w\003'H\003\303\261\252\331\375&\034yw\355\374\253n\260\232\361P\245+"
+	.string	"\303\356Z=\224\307\ro\373\3006\3106K\322z\361\304\354v\334\330\254\214t1\261\315\331\226mU\373'G\341\236\322p\300.\210\252e\367\003\031\241s\371\271\207s\031/\300\271t[\001\311\256\351\236\237r\225\n\277\344\322\332\246\367.\375\355\"C\357E\3709\301\222\375\225\024\212\330\217\273\273\206!\216O\375\032\242\006\f\fB\372\ni#\021Fr\270\262yE\314\t\211\007\322\2742m\206\b\214Q\214\262i\201a\331\264\276\275#\\\3700\301\rwT\341\277\257\004\b"
+	.ascii	"2\003\302\260wq:\036Z\355\202*\2446\2328X\354\264\363\t"
+	.text
+	.section	.gnu.lto_rcModeUpdate.54.a9a5b7e46af2ef62,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\335\007"
+	.string	"b\01788@o\323\001\230NLM\360)\343L\203\3262\346\033U\373\305/\347\364\232+[\3230\234G\303\203b\002\315z\t\301\234\322"
+	.string	"\340A\367\312\005#p\270\206\bm\262wJ\001\330\266\331\036*\260\316\345\252\361`\021\031\007\242j\264J\320\316\304\206C\253\346\241\032\004g\024\230F\267,\323h\006\334S+?\317\026SHb\330\017->\t!$?\274\311\307'\371\202\213\367>}\256\372\264F*\033\036\241x\262AP\224\037\366\251\335]\313\317~\351\217\224\300\310"
+	.string	"e\227\343\024\263\246\311\"\222\261\375h\177\344$\335K\334\007v\277\224\225]\220\301\013\327\247\301\027T\237\327\t\252Ow\366\313AF\200\213\306\t\314\356R\t\362\356\261\363_r"
+	.string	"O\004z\264\034v\327\321\023u\334\362\266\025l7\330\016\003\t"
+	.ascii	"2C\363\f\f\217J\226\t\204`\310%\330f5%\334\341E;\311"
+	.text
+	.section	.gnu.lto_isAirmodeActive.55.a9a5b7e46af2ef62,"e",@progbits
+	.string	"(\265/\375`\342"
+	.string	"\205\f"
+	.string	"\026XVB"
+	.string	"\2216\035{\021\214\374_Nc\330\202\016\377\212K\377?\216T\342\321\363\036&\"\360\324\3300\352\355\333+\215@^\024]\004\341\237\210\325U\265\376K\337\3509V\220N\212\0332@T\023\262\267\224)\005D"
+	.string	"@"
+	.string	"F"
+	.string	",.FTZvI\227r8\367\b59\377\242{\204`x\337\346\261\312p\210\371<\260cw\255\257\223\n\001\220\200\3600\037\007\026(\235\220q\321\363\363u2\251\004\273\353\364>\f\367t\333\fl\023\260\277 \244\031%\217nl\022'\025d\037\256\226\330NWNS\232\376F\\\261\362P\213]\222\027\032\313\"\242\ba\373\376\311G!\027\341\001\241\226\335\265\036\355\020\333z\274-b[>\200@\304\\"
+	.string	"\217\006)\230\314\314dG"
+	.string	"\321\237h\350\350&o\342R2\241\346\246J/\372?\250\330\020c\205\245\223.\336H\216k\246\217x\312\306a\262\333\335\363I\034%\363=<\232\302\226\367\266\351\321\037Y\270\220\367*\375\350\n>\001\306>\266\314\203L\323"
+	.string	"\323.\f\302%\001\304\201\346\302\264\355\372\020\340lBF\273*d\231vY\244\356Z\342T\217'4\360\324\217mJ;:\3458\225\322\217\324\350\362e\212\n\272v@)\221\002*H\345\327|\021\024"
+	.ascii	"L\b\230P\307k\231\0322\303\331:&\210\033\007k\205\n\306\301*"
+	.ascii	"\r\273E1\006K\261\3165\234\302\304/\027\016\240\302\211\237+"
+	.ascii	"B\363U!\351\265\005\n"
+	.text
+	.section	.gnu.lto_isAntiGravityModeActive.56.a9a5b7e46af2ef62,"e",@progbits
+	.string	"(\265/\375`\343"
+	.string	"\205\f"
+	.string	"&XVB\020\2176\035(\020\373A:\220\334J\007cG\004\260p\303\017\276\001\231\256\263\277\001\340\346>8\030f\337^k\215\315"
+	.string	"\240{\240x\265\322!"
+	.string	" \"\240\224:\233,\212xQ\350\304A!B\366\2262\245D"
+	.string	"@"
+	.string	"E"
+	.string	",%\021\225\322\356\350R\016\347\036\241&\347?\364\216\030$\274o\363Xe8\304|\036\310\261\273\326\327I\205\033#\037<\314\307\201\005H&`<\364\374|\235L*\301\356:\275\017\303=\3356\003\333\004\354/\b#\031$\217n\354\021'\025d\037\256\222\330NWNS\232\276F|\321\342 VvG^f\354\212x\302\304\366\375\020\027\201\374\304\003NJ\273k=\332 \266\365x;\304\266|"
+	.string	"A\2109"
+	.string	"\036\r\230\374f&;\302\207\036\205\206\216n\362%-\244\022jn\252\364\241\337D\305\006\027,X:\331b\215\204\327L\027\361\224M@\311nw\317\037q\224\314\367\360h\n[\336\333\246G_d\341B\336\253\364\242+\370\004\306<\266\314\203L\323"
+	.string	"\323.\f\302%\341\303\201\346\302\264\355\362\b\340lBF\273*d\231vY\243\356J\342\324\216'4\360\324\217mJ9:\3458\225\322\213\270t\3712E\005];\240\254\244\200\nR\3715]R\002\024"
+	.ascii	"L\b\230P\307s\231\0322\303\341:F\210#\007k\205\n\306\301*\r\273"
+	.ascii	"E1\006K\261\3165\234\302\304/\027\016\240\302\211\237+B\363U"
+	.ascii	"!\351\265\005\n"
+	.text
+	.section	.gnu.lto_isRangeActive.57.a9a5b7e46af2ef62,"e",@progbits
+	.string	"(\265/\375`\236\002u\025"
+	.string	"&\351\215I\300\322Q:c\301r\0259\217N=\227l\305\343\3472)\266\213\300\0220\035\335\"\376R\370>jUa[\375y\264\020\234\225P\322\260,O1\262(\212\302\024\"\214"
+	.string	"Ak\245\006j\202\n\023\226\353\017\327\021K\bIR\246|"
+	.string	"k"
+	.string	"{"
+	.string	"@\332\342F\2014)\255\231\023\362Z\200\352\"u,\365\204\324\321_\375\261\361\347\364\255 \232\023\230\300\005J\035m{\001\313\215m)8\347\001\265s\3414'\360u\022j\323\0249\212_\233\225\203\2464\250c\323\316\021\257\027BI\020:\352V\\\365pD\001sNU/\267\027\r\370\220>\254z8\321\2454\242\207\006usz\273\335\224\313\234\323\313\353yP\227j\373\306v\003{o\004'\260d\031\r\242\225s\346\030X\205\0200\224&t\264\322\220:\3525\250&6\230|,\200n;\264\201\270\375\317Vq\236\307.\257Q\364G\365D\201\252&_\267\274f}\275\372\272\344k\222\257U_\217|-\362u\371u\352k\222\\\217_\213_\177\\\357\270V"
+	.ascii	"\003tvC*3\346\3540\204\2329\306\242\023\266U\266\305\2655\332"
+	.ascii	"\363\004\204H\374\317\256\217\250~\b\221Tw\335\313\013\202\023"
+	.ascii	"\371\310o\244\363\251\224\0279\351C\347\243/\357\263s\224\312"
+	.ascii	"\245\256:\331\324JA>u\257\216i<y\021\307.\352\266\303\r*#V\316"
+	.ascii	"9[\25404\206\31401\253\274\030R\307\361,KE\267\035ZT\033\221"
+	.ascii	"\277x\325\371p;\364\311\177\005\301 \341\016\241\250\255!DI\304"
+	.ascii	"\377\363^/A\230\224\333'\333\025\364\305\0062\230\031\2546\326"
+	.ascii	"\310^f\017,\310f3\030\005\0075\032`,\307Vfd/4\231\b\261\332+"
+	.ascii	"6\3415\213\201\311\274b\265\231\327\212\212i\027d\265W\006\032"
+	.ascii	"\255\366R\001o*\316\3638\200\016\336n\210D\021\201\242\204\206"
+	.ascii	"\326j#Yf\335.\267\343R\377y\307\003\272\"\002m=\307n\035\345"
+	.ascii	"\272#\311\377\304!*z\234\306\363\254n\243SB\230\244CZ\362\225"
+	.ascii	"\322P\222\227\2344\322\371\354I\256(v\222v\0320 @\002B\220\223"
+	.ascii	"v\265\241\245\025\350\225\360\306\300\023\3576\366\326H\021\256"
+	.ascii	"iL\363h\213g\371Gq\216\353E\234\001b\230\020D\373\340\273cg\221"
+	.ascii	"2a6Nj\344>;b\017\236D)\003;\007o\016\2573\226C\247a\320\226\266"
+	.ascii	"RL\001 L\031t\326\036;\fs\"R\303\215\036\204\250\214\334\237"
+	.ascii	"k9\252\265w\003\312i]\232d\341*\264\353\265|\017"
+	.text
+	.section	.gnu.lto_updateActivatedModes.58.a9a5b7e46af2ef62,"e",@progbits
+	.string	"(\265/\375`U\005-\""
+	.string	"\326\276\333F\200\234J:\235#nS\312Gl\221A\n\314\217\224\204\355\2403\374\363\324\240g\342\372Y0\215\211\217\306B,\022\302\377$\277L-\315P\355;c[\353\323yB\313\223!\366gy\213C\272\265F\b!D\356\224\002\305"
+	.string	"\266"
+	.string	"\323"
+	.ascii	"gob\367\334\342Bk\300\322;i\267\260{'\307\233\271\347/9\223\337"
+	.ascii	"\203.\316\253\256\035p\030V\254\265K\351\244\r\234'-\374Py\362"
+	.ascii	"|Py\322?;\315\205>\352\2073\270\236\314\325Z}\333\303B\037\205"
+	.ascii	"\367\216\376\316\333\235fI\216K\177\276\331\005\324x\003\364"
+	.ascii	"\272:o\334\027s6\016\246\253\306\b!\016W\230\243e\321\235)\201"
+	.ascii	"\307W\330\317\244\034_`7\307\003E*n\206f\b\001\236\355\024\206"
+	.ascii	"\027\027-\267(9\"\201\351\002\033\221j\255=\257\027t\034\017"
+	.ascii	"\210\271\321\340\361\322\032\207\276\3508s\265'\225u\201\321"
+	.ascii	"=\332I\0356\326\344\370\n;5%\324ZM\201^_w\357\266\263\330\346"
+	.ascii	"`\223\001\002\177*O~\017\345\tp\260\301\tb\321\272\215\233\022"
+	.ascii	"\304\261\326\241\347\315\245T\372\2057\203\342\361\001\264\243"
+	.ascii	"\244\350\201\246D#p[{e\013\263\350\216\3317\";\203\363\356\260"
+	.ascii	"Mj#\223\272\310\244&2\251\207Lj!\223:\310\244\0062\251\177Lj"
+	.ascii	"\237\223\272\307\244\346)\251wt\276v\363J\352\335\211\367\232"
+	.ascii	"\324\264\244>\200\322\355\313\021Z\2553\352\346T8\262\n\331\327"
+	.ascii	"~\342\037\374\332\267\237\346\263\271\267\226B\212\016\037\305"
+	.ascii	"Z\205\016N)WS\3614/\0256\025,\236f\006gk\366\241\370B\037\315"
+	.ascii	"w\362'\277\023\335v^u\235hC\033\305Z\353\202\363$\322\370m[e"
+	.ascii	";K\264\037\002\366\306E\367\033m\216\220\221;\346\241\005\332"
+	.ascii	"M3\364bf\t\355\320n\333\226\330Q\320\nm\211f\253l\267Ad\031X"
+	.ascii	"\026S\353g\201\266t\343C\304g\177\326t\213M\026\255s\317\372"
+	.ascii	"\354\330\205\213N\304\343,\234\276\230\217\271\200ai\251<\331"
+	.ascii	"\263\r\312T\031\357\266\222.\31728s2\214#\212e\3213"
+	.string	"\271\342\333\270c\336\331\335\212\030\276i\3218\031\016\206i\224\363\005\356mg\013\224Q\263\206wa\242V\330\330\033\356\326a\231\220\\\264|\213\207\362\344n\257v +l\304\230\004\277t\217\206\213\316\037\236\205\311D\2149bKj\325r\360(\366\212c\001\261#\2231'gI\255\365\301\225\267\205\360\203\234t\223\023=\360\244\003.1\256x\0321\005EFY5-\251x\2322\355\244\300\352i\004\225T\b\247*\237\023\t\337\024T\223\224\317\251\312\312\247\340\310T'\236\252|(\250\250\252|=!\326w\207G#pp\212X\233e\027c\2559\"<\370\233\375\247\330$x\277\315\335\270\360\203\370\247\004\n\252\311i\222\"\3038)5\260h\035o\307\334\373q\352\354\312Q\245\357\302\020\332=\335PN\213\306\371Xk\255;\004\337\325\331\"aq\364L\242\274\375\224\233A\005 \3633\233 Dl\203{\261W"
+	.ascii	"\210is\346\216y\300S\224\2745 \243\207M\341j*D\311\270\221\006"
+	.ascii	"\ro\317v\002T\256 \tzJ\0227\260r\307l\264@\333\"\006\220a\227"
+	.ascii	"\233y\321\032]\356D[\264ea\250!(\246\214bH14\"\"\023H\nt\200"
+	.ascii	"\002\021\252\024=\021\020\246DB\222\202$\303fPA\351\225T\272"
+	.ascii	"\274\b'\035\305\314\222H/\215\212tX@\361L\205\372\243\022\035"
+	.ascii	"\002\224\330te\366'\243B\246aa6)#\305\223W\360\027A}j*\020F\362"
+	.ascii	"\217\037p\217\316+S\020\221F\3520\261$\025\240\202\343p\372\224"
+	.ascii	"\325\363\275\0248\".\023f\272v\221v\f\217\222\3374H\276\026}"
+	.ascii	"\225\377\267\312\034\246f\323\343R\034\231t\323\006;\nh\024\321"
+	.ascii	"l\277\372[\r\306V\375\213U\207\205\216K\027\t\235\301\035\336"
+	.ascii	"\240\245*\354\\\314\317\020\300\263n\323p}\357\276x\307\351~"
+	.ascii	"5\021t\001PT\025\023\213\204?\263\360\264\274\301\f\307\244d"
+	.ascii	"b\036\025"
+	.text
+	.section	.gnu.lto_isModeActivationConditionPresent.59.a9a5b7e46af2ef62,"e",@progbits
+	.string	"(\265/\375`\204\002\325\023"
+	.string	"\306\245\204I\320\360(\035B%\300f\003\251\205\270v\t\353\340\003\004\314\3226\334,\2176a\t\344\020@\325\257q\013V\362g6\277T"
+	.string	"#1+\026\351v\b\367f0Sd\275\022\260A\216x\f\020B\215\201\034\220\305\377\2667\221;\245r"
+	.string	"g"
+	.string	"t"
+	.string	"!\364\023<"
+	.ascii	"\372\271\200\201\213a\027S\314<\247\207\366\363\253U\f\027\205"
+	.ascii	"\003\034\024o*aG\321\t\256\204\371!\216\002\367\345w\003R\243"
+	.ascii	"\201#M4\033\037e\222\262\250\371\004G|zv6\267\213\261\252\321"
+	.ascii	"$\b\036\3001\242\001\251\275\200!5r\226\236\273\214\251\315\344"
+	.ascii	"~\274$\362\311\220\202j5\227(\222Z\253%Lm\304\235\272\355\032"
+	.ascii	"\333\023lI\023\266(\223\005p2\226\274:\366\307q\277\312\322\364"
+	.ascii	"\342=Q\322 Jz\251\264\234\322_=\350\375v\f\340\325:\363\344T"
+	.ascii	"i\314\"\236\213\277}w\270\316\nF\337\257\326\272\262\237\263"
+	.ascii	"W\237\267]\374\321+_lI\325\025\250]N\013\035\265\212\b>\035\246"
+	.ascii	"\244\264\177\273\217\313q\037\254\252\325\204\257W\253\230\300"
+	.ascii	"\006R\237\004\036\2738\235\021\205\027\021\235L\233\036o(\311"
+	.ascii	"\256\360!\013)\333\344B'{\2330\202v\357\333\301\305\344\323o"
+	.ascii	"\2731\224\003\327f\325\312}\351\222f\262\3116\353@-\t2N8\267"
+	.ascii	"Zg\r\356\302\006\361\035\006\025\217\314\217\351Vku\360\363\027"
+	.ascii	")\276\212OkP\221\207\371\364]\364S\256j\234\301\0037\367\373"
+	.ascii	"\334KH\330\344\240\365\210\311\247E\352\341J\354\332\002\316"
+	.ascii	"\340\241\205\262\2222Q P\263DXZ(.\025\023\326+d]\bWRNTB\326\213"
+	.ascii	"%\024\021`\327\206\326+\344\340r\275\302\225\030\373\352\370"
+	.ascii	"\343K\216\204v<\352\303\350s\217p\004\264\343\201?\214R\272&"
+	.ascii	"\211\255\214\t\2656\253\224\346\307N\030\351\230\343\320)\315"
+	.ascii	"d\323\301Zk\245\177\013\235\373\261\037?ol\220D\340\310\344\223"
+	.ascii	"\\\337x\202f\256\315\340n+ `\202Af\307\r\352\300\317\357\273"
+	.ascii	"x\341/\304%\270\206\343\222:\334)I\013`\341\214\362\3241\036"
+	.ascii	"v\330\362\035cp##\307\314\021\237M\226\3004\316\304\261\034^"
+	.ascii	"\330\007i\276_\004\335\303\274h\213\346f\304\005@\241|\242\365"
+	.ascii	"]\301e,\273\013\027\321{\303E)\002-X\241\366n]\022\222\027\371"
+	.ascii	"uu2"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a9a5b7e46af2ef62,"e",@progbits
+	.string	"(\265/\375`\236"
+	.string	"u\006"
+	.string	"4\t\232\001"
+	.string	""
+	.string	""
+	.string	"\0025\177\021\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\0050\013\201\2046\177\022\0027\177\023\0028\177\0249\177\025\005>\026 :\177\027\340\301\257\0301\030;\177\031\354\331\276!4\032\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\0052\033\005\n\034\001<\177\035\377\037"
+	.string	""
+	.string	"\200\200\200\001=\177\036\300"
+	.string	"\177\037?\177 \003"
+	.string	"\r$\003\003\016\320\360\372\250\001\001d\003\004\004\007\020$\003\007\017\370\311\306\032\001\304\013"
+	.string	"\027"
+	.string	"\177#\020\024v\263\364\326\036\004k\030\240\036\255&"
+	.ascii	".\361\001\302\376\245F\020\f\227\037k\270?3\210\241\320\206\f"
+	.ascii	"+\f\315\302\004\004\320c\347G\270\242\t\240CDPO"
+	.text
+	.section	.gnu.lto_.refs.a9a5b7e46af2ef62,"e",@progbits
+	.string	"(\265/\375 Q-\002"
+	.string	"\204\003M"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\002\001\001"
+	.string	"\001\002\001\003\002\004\005"
+	.string	"\006\006"
+	.string	"\006\007"
+	.string	"\b\002"
+	.string	""
+	.string	"\b\004"
+	.string	""
+	.string	"\b\005"
+	.string	""
+	.string	"\006\b"
+	.string	""
+	.string	"\b\024"
+	.string	"\001\001\032"
+	.string	"\003\t\002\n\002\b\002\013"
+	.string	"\004"
+	.ascii	"\351\311\017\372\202\305\262\226/"
+	.text
+	.section	.gnu.lto_.decls.a9a5b7e46af2ef62,"e",@progbits
+	.string	"(\265/\375`\376\026-r"
+	.string	"\352\300|*N0\022\273\031\016\nn&%t\020p\372\234\307#0>>\"ndt\341\201\271\256_\361|\325\313\353\202\026&\"X\203\304\303o\371+\031\361\346_\307]sfU\021\2403Q\314ts>}\350]\235\305\313y@N\024\373l\332do)SA\002\223\002\243\002F\256T\245gZ\322\020\220\245\036 v\322/\232\305#\244\034\022F\f\223\256\333\317\245\222\310$\002icf\231~\253\244J[B\b\266]\225Z\004\361\371e\373\027\316\306\331:\253\3546v\367"
+	.ascii	"\253\003\317\025 >W\316\316\331\245\211\245\243#\256m\264{\234"
+	.ascii	"\024\223O\322\033\272\327\004\272ssk\002e\345\226@\025"
+	.string	"X\022\350\2565}\337\024%\265x!\343\023\351\353\306\304.\013\032\035\230\250\2651[\271\205\215\317\264u\345\257\341\223)|~\211\244A,\020\273\\\2645\373\256Y6\337\265{mqv\324\3058R\272\272W\026-\026m\317lY\321pm\254\035W\224\035X\344\272\327\244\245%]\230W\326\034z~\263\322\243-\201\362\032\323E\263iv\211b\325\234E\213\233\303e\177\021\r\3222(\020\237\267!\375\242@wnQ\240\017\232Aa\264\002\271R\262e\310\240:\250\345`dL\322\236Y\271\023\207\317\367\304\230G+\345\212t\222\251!\263\206\3170\273\\\262\035\373\271^\202\277\211l\177X0'xt+9C\265\254\334\346\344\272;i\311(O\220&Z\347y\026\351\027\314~ae\017\300WL\352\034\371\334.\273\356Ri\303\276b\353\345B\306\265\305\272W#!:|\214\214\361\231bK\240\247\003\351\027\354"
+	.string	"\020\273\305w\351W\t5Z%\224E\323\227\313\277>\354\027\t\024\271\265\366Xw\033\241^eH\376\360yN\277n\t4]\022\350\235"
+	.string	"~.a\325\034\376\303\375\253\265\347\337,>\253\300\277\013\354\216\037\233|\002?c"
+	.string	"\304\377\263\244\377'$@J\340_`\325\tF?\037\360\363\347\030x,\377<\342_\027\376\205\341_\247\177[\370\227\205\177_\370w\306\361_\030\377\256\360\257\n\377\211~\006\363/\325\277S\377J\375k\343\337\250\177{\377>\375\253\364/\003\377\032\360o\001\377\232\370\027\351_\243\177\207\376\325\375\217\373O\347\177\235\377i\377\275\374\017\364\037\317\1775\377\377\374\037\363_\356?\333\177\265\377m\376\227\371O\346?\331\177\025\377\321\376\013\315\315\315\315\375<\366\233r?\322\212$P\021\275%\320U\232mF\214\360\221\264\2737\f\313\004B\251v\344\210\016\316\225)df\351\317D\226Ld\331N\342\262\207\"\212:\034\371!\327\275\365\300\320p\207 \"[\262\262X\310\007\303!\262\220^\272\264!\316\212\360\326YH\021\036\255\270->9\310\226\241_S\344d\001b\204\325{\344"
+	.string	"\341\034\240\364\320\245L[\205\006\t:\302Ck\315t\\D\374t\224d\222\261\322\325"
+	.ascii	"\271,\244\327\316\216\225\256&Z\354\203}0\326v\337I\313\206\360"
+	.ascii	" \206O\306\022\342\301\n\227\025\2377\215Lu*\266J\207\335w\334"
+	.ascii	"\274\021q\221C\246I\217\263\325\361\240aD\202\300q\225\356\310"
+	.ascii	"R\351\245\212y\034a\003'\312\0304P\0235F>\371\270c\377\033\331"
+	.ascii	"\245lK\\\372\025\264\203\276s\313\235c\035\333\310\356\2556\333"
+	.ascii	"\202\330\332R2\201\004\202K\303}\326\301\305\241\356\023F\305"
+	.ascii	"\036\242\220\341\223\213\314D6\236\213<\0342\366W\367\312\305"
+	.ascii	"\263\233\270\253\242hW\205\316L\n1\f=\317z\322\303m\236\377B"
+	.ascii	"D^ns\204\270I\317?\332Ddw\377\320\255\215,\016}uK\264\346\"\320"
+	.ascii	"&"
+	.string	"\004^\335Q\344\372\244V\314\020\211<E\337\253{\210\324k#\217bI\206G/p\222Hk#\031\240\305\224\364qM\222<\225\315\275\366\2661IR\206\343\252D\036W\345\360\250\215\312a\367\232<:\216\021\207{\024K\222<\212)\223Hm\354a\213\021\221\244Fe\362\230\246L\036\035\305\210\311\2431I\022\251\211\034\024\254\252.K3\213\344hl\037WE\210\310\243\265\343\252l\266\356\035\333\321H\004\272\213(\221l\304 {\246\270\346\2438\206\250l\023WE.e\033\327\216W\224\335W\2125\372j\202\341\272\326;\354\332PI\221\266\332\321M\300U\367p{\255\273\207\335\275C\026Y\273\207\034\035\273\256\256\272\267\222\256\272\310\020\315\216n\036k;\223<\212q)\233\320|\021\353j\252u\270]\315\226\004\231\212\r\301\332\252\273\227O\332\225\314\332\023h\271\201\226\314i\\\373\307\005c\262\220r\215\334z"
+	.string	"Uj\351\270\322c\035\302\302\202\242\374#w\005\353H\025\237q\353\230\2106*,,=\351\302\355\235\315Sd<j#\227\026>\333g\375\354r\341\366m\275\300\255\235-3\327\256\035\030\256-o\333\266p\253g\367\230kW\332\243\350\303[w/%--\245y\002,h\227G\343A(rk\355\261\2424Ta\320\266\244\307a\217\206\362\2373\240_H(\315\221%I\252\310\375B;2:D\272\244\244\3371\331\263\207\341\274t\3751&\261\303}\316p\273\252\037\240$\371d>wC\337d\311\"e7\004\017\036~KR\232u\326\342"
+	.string	"y\021\271\371a&\231\347\374\006\347e\215\313~A\325\260\206"
+	.ascii	"\004\227^\b!\370\316.\033k\227(\375\250)\231l\276\264\264\354"
+	.ascii	"\234\357\020iA\023\205\214On{\036?;\030\333\224^\365\305OQL\372"
+	.ascii	"s\235%\327\331/\031\21451\251d\246\344sE\256\221g\017 IY\313"
+	.ascii	"\302\347\321!s\3460\223\f\234\034usu9\263E\376\360\320\262\374"
+	.ascii	"\344\374\303.\371\t\307I\002[\207EjE\036H\337\300\244\224\361"
+	.ascii	"\tgM\332\365\020\"f\254-\375~-Y\214\r\314\013\207}\271\031\303"
+	.ascii	"e\260\244\361z\206\317vm\353\250\215e\356\274}\245\361\027\016"
+	.ascii	"+\032\"u+Q\353R\3437\274\306m\030\215\335\354\222\323\330\314"
+	.ascii	"\231\013w1\262\3414\006\303bv\315I\006_m\226\222\226F\320\201"
+	.ascii	"\243\262Vt.\357v\242x\374\200K\333[\367\312g\214\206\331\354"
+	.ascii	"\332\326\332?F\220\351\3023D\216\201\340 v\311gOZ{i\311\004Q"
+	.ascii	" !\344\270\240l\326\f\235\251\"B\305'\233\255\030Z\017%Z\324"
+	.ascii	"\354\222\313\214\250\252\b\232\302'\247\271\333\311cX\325\343"
+	.ascii	"fg\016h|h\203%\275\256+\275\216\213L:\347\315\210\232\221\364"
+	.ascii	":!)\217q\230]6\300d\fEP\2300>\257C\246\337\006Psnn\033@\257\353"
+	.ascii	"\221^WL\177\016\022\3430\235X\020}\324\302\266\214\343\264\261"
+	.ascii	"*\002J\217\226\004\232b\335\022\250\222\026\366\201\277\266\234"
+	.ascii	"a\"fOz\336\"\302\0237b\370<\367f(g9{\375B\214F\245\353\312-="
+	.ascii	"\367\300X~\241\"\266)a\300\346\244\347+b\346\372\b\341\223\255"
+	.ascii	"\244;N6\r\2100RF\007\266\362\263\024\236\302U`\250aNP\034\237"
+	.ascii	"\334\305<\234\2530\225\346*\023(\273\211\\\305h\210n\242\321"
+	.ascii	"\256\212]\025\347\026.*d\350\3713Mz\266-\201\022-\t\224\2414"
+	.ascii	"\235\243\250\255y\353\302\347\320\331\345\304\t\353\370\200\313"
+	.ascii	"+\013)gTE\316\262\213\317\237X\312]\262\222\231d\340d\355\341"
+	.ascii	"\fetmcJ+|\236\231\374\214\204\223\360\022\226a\320\2265Co^`\\"
+	.ascii	"|2W\323Y"
+	.string	"\311\b1h\202\250\360Ib\003I\257\261\"\352\347\013\252B\246\036\324\224\215\247\237\217)(\234b\022\300\206\215\251\337\017\370\333\251N(\r\300`\r\025\370\333\321\340\365l\234jOx\243w\003U{2N\364\202S*\257Gc\367\032+x\252o\006\323\017x\343\006\360\t\205\332\363@\365\315\030\361\032+@8!\206\f&\265\027\025\344\251)bx\002\332\200\321\013\002a\030\345\220\002\302@@\225\232\002\006\243\234\202=\265w\203\027\344I1E\371h\374\200O\n<\375\246:P{\302\021?\032\254\366\204\275(\251!\325\351\027%\245\373EI\231\275\032|\302S(\354\005\241\240x\273\034R\300\2473\250J\231P\275_\224\317\006o\007\325\023N\235O=\341\356A\247(\251\025DA^\215\2473GP\025\372\242z&\250P\177=a/H\202\320\227\"\007/\030|q\243\247\ns\310p\022* \204\352\251\274\251"
+	.string	"^c\005\216 \023\216 \t\236\312\333\340)\210\366\204>\242^\016\3257\003/\350\201O\375\275\020\372\006\350\005}/\204>\243\236\312\203\222Ba\310\006\020\250\201\223\216\203\024b\234"
+	.string	"\343\205\023\007\033\214\020\202\023\f\023\234d\304@\372\223/\330\373\365\242\322O\340\002\002\027\024\340\330\235\002\013\"\260 \002\364\024X\320\324d\201\213\246\364.\232\314?\305 \344\205\020\302S0"
+	.ascii	"5\250\023:\371\240~@\030?\240O\345\315\340S\237^\230\3509A\305"
+	.ascii	"\300\001\234\261\203\212\201\342\350A\375b\300\3001\3053R\235"
+	.ascii	"\\4\251?\337N\205\372\365vB\247^\324\217g\202\215\336\357\307"
+	.ascii	"\253\361T\244:Q\260\223\352\2512\324 O\025\n\251\257a\342@\251"
+	.ascii	"^\220I\005\002\203L#\204N1\by7T\237\0068\2003\206T'\026\022\250"
+	.ascii	"?\337T\372\n*\200\221\002\005\021<H\237V\b{P\300\033NOA\246'"
+	.ascii	"\032L?\037\357\006\323SP\310\264\"I\250\372f\234@\030.\235\343"
+	.ascii	"cJ\036>\327\")>v0bV\324U\345\025$\213\252h\255\313\334\016|\232"
+	.ascii	"V\246\225\231\\\344\220O\002E.;\260\310\365\226\226\322o^\335"
+	.ascii	"L\232H\021\311.{\312L\244\2115\004\f\026\262\270]\302\206\352"
+	.ascii	"\207\351c\337\026\031\2275g\267\226\376f\21776\345\022+\263\212"
+	.ascii	"\357\314\24596\017&Dso\372(\371\214;\007\2123\251L"
+	.string	":C=\\6\326\316\314\331\240*r}\334R\032\001\326\003\354\215I\274Ius\007\213\026wK\275\260\320!\362i\352\270i\334j\223\346\255h\032\177!\021V\226\210e\001K\017A\272\004\222L\362i\016\357\306W\334\254\364\360i\366\315\206\266\352\3105\2313\325\270\342\024\371\344!\002\201\275\250\241$g\230DFFFDD\222$I\007\001\005\204 &-e=\022\300\3664\r*\306ffA\nJ\222a\377\fbO\212\314\271I\n\365\316\035\303+\35163Y\020\361]vw \204\362\244a\202\003CW\366\244h\f\242\002z\220\317SA\336\256_[\335fM\315\313!A\275\314\223\222\034Q\342\253\231\3319\314Mb\030\240/T\330\244\232\3640\034\233\t[r\211\361\033\360\016\274%)6\320~'1\332\306OB\230\213\226\226E\323\246D\367\2008\324\n\274V\243C9hR[\361g3\372\272\274\367"
+	.string	"\017\301\232b/\307\235\264\3616B\313\221\021x\031\375\002\200\313B\355=\253\225C\335\200%\232\n\204r\320\244U&7"
+	.string	"\324'c\260\330Z\2772\305;K\220\262lE\373ES\026{\307\"\226\243\364\227M\020\237\0046\0203e \304\257\322\003\363\264\377Y"
+	.string	"\021\001X\245\3622\237\206-R\242\302\233A\265&W\244\004P\"o\"\311\\5\036\243\321\2257\245e\313h\346+ki\336w\261\2368\032\201W\270\t#\271\245\224\354&\306\034\231'D \225\002\311\332\024\320\232c\027\333\337gp'\316\240\241\357\307\373\263v\231a\316\272\021d\321\367\005"
+	.string	"\330?\241\357\365\026\370\r\2570{\231\026\020\002\\\263\242\250{\214g\214\263R\260\356\313\246\242\375\226*\250\275\205\375\321\006|\320\316\361\221\366\272\bH\302\020\256T\f\246U-#Y\224\b\026\201\003\360L\t\252\266|\303[\201\255G-\341(\203\254\226\270\306K\002t\0301\306(\364\034#"
+	.string	"\311\322\233L|\232\356T\341\274\325\202(\224\355\312\003\"D\370@\017\303f\371\224k\347\023\231{x\211\232\021YF\252jQo:&\217\n\023(\241\351SB\225\3229^\r<@f\275\003\f-T\224\300@-\200\304\240\303\256\336;\004<\347\334\356\t+lB\232\237NpZ-I\334,\036\007.\245\016\0059\210\371^?C\310\306[Sp\354\342\234\354\247\336=\347\336/,\252\216\275\375\020\235W\001\260R\3473w\336\267\025\177 v}\311z\335\263\224\001\342\232m\027\245\336\274\250:\001\343\036\020:A\365^2)\216\236\276\f%\206q9`\206\027\0205\f*2'2\007\241J^+\226P#\201n\207\264\t4\t\345dt\005\004\207\001%"
+	.ascii	"U\022\221\026\321\323P=%sf\036\374cV+\n\005s"
+	.string	"Z\216\006X=\234/%\305\217\211\207*\304\271LZf\246\315$\2526*\214\340\331i\032\020\356\212\327\240\333gV\313\270\311\214pnu\261\337\371\247\202\311\246C8\324\244Bu\314\020\301\263\232\347\343p\2167\236\306\036\277H\311K[s0\354\211\330\231g\2221\250z\3479\244\342:\261\001}=\223\311s*\316\367\037\256\240\006\376:\254p?7\026a$\210S\371\016z\376\323\036%s\255\036\206~I\324t\241\177\205\353&\304\343\213\206\326\271\2171\377\322\017\360\316\361\027N\r2\307\350\207\370&}\201\013\371\007\367\214\321:\243\362o\"\376\203\356\303\235\006\274\356\210\367\230\334\363\036\b\032\244\037\344\205\276\3009\246\375\3537r/\337\037\003\223to\374_\211\227$\374\2216\231E\343\336\375h\021\b\243\332\216\320\304\307\021\177:G\032\177-\333c\372\003l|\001/\323&Y\2467\360\255\236\023^E\274"
+	.string	"\003S\311"
+	.ascii	"r\325f\007\251\002"
+	.text
+	.section	.gnu.lto_.symtab.a9a5b7e46af2ef62,"e",@progbits
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001"
+	.string	""
+	.string	"rcModeActivationMask"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373"
+	.string	""
+	.string	""
+	.string	"rcModeUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\001"
+	.string	""
+	.string	"isAirmodeActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\001"
+	.string	""
+	.string	"isAntiGravityModeActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\001"
+	.string	""
+	.string	"isRangeActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\001"
+	.string	""
+	.string	"updateActivatedModes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\001"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\240"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\001"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\001"
+	.string	""
+	.string	"modeActivationConditions_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\001"
+	.string	""
+	.string	"modeActivationConditions_CopyArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\240"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\001"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\001"
+	.string	""
+	.string	"bitArrayGet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\001"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\001"
+	.string	""
+	.string	"bitArraySet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a9a5b7e46af2ef62,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
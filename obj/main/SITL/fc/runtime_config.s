@@ -0,0 +1,588 @@
+	.file	"runtime_config.c"
+	.section	.gnu.lto_.profile.8ab375e3ecf96cb3,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.8ab375e3ecf96cb3,"e",@progbits
+	.string	"(\265/\375 \306\345\003"
+	.string	"$\005\272"
+	.string	"\021"
+	.string	"\354\270\344\363\013\004\002"
+	.string	"\001\352\263\360\321\b\002\267\204\341\306\016\003\342\201\222\246\004\002\004\354\206\342\366\006\005\243\276\342\320\003\006\002\001\006\007\320\253\336\204\013\b\220\352\317\274\f\002\t\n\013\f\002\002\002\r\362\220\277\357\017\016\017\020\240\342\234\212\n"
+	.string	"\021"
+	.string	")\"\260^LC>\310A\207|x\016=\344\035\325\f\267n\236\253"
+	.ascii	"\337\233\333\343\322e\250ep\352\224\033h\003X"
+	.text
+	.section	.gnu.lto_.ipa_sra.8ab375e3ecf96cb3,"e",@progbits
+	.string	"(\265/\375 L}\001"
+	.string	"\320@"
+	.string	"\n"
+	.string	"\001\001\002\003"
+	.string	"\003\004"
+	.string	"\003\005\003"
+	.string	"\001\007\b\n\001\013\f"
+	.string	"\003"
+	.string	"\b"
+	.ascii	"*\2033/\003C\260\020\201y\215\312\340\22706\200\005"
+	.text
+	.section	.gnu.lto_.inline.8ab375e3ecf96cb3,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"\305\004"
+	.string	"\022F\023\034\240'\351\377\211\254\3702\325\322u\357\267\370\004\376\377\377\315\254%\344,ido\271S#r\f@pG!\201\b\\\336\376\323u\250\2033\020\016\2133IU8\026\311\207\247\366\376\253m\333*\367\277W5\325e\337V\025\231i\274\331\216\036"
+	.ascii	"(\026)\3409\234%3GIA\261\344\200\320\270\302B\035\b\200\006i"
+	.ascii	"caV\271*\00566\242\277\b\026`\206\003x\340\330Q&@;`\016\030s"
+	.ascii	"\001-\260\201\225QR\326u\212&<\305\2779\203KP\005\030\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.8ab375e3ecf96cb3,"e",@progbits
+	.string	"(\265/\375 f\365\001"
+	.string	"\204\002Z"
+	.string	"\n"
+	.string	"\001\001\003\177\002\003\002\003"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	"\005\004\002\002\001,"
+	.string	"\001\300\004\001"
+	.string	""
+	.string	"\007\b\005\n\005\013\f"
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	"*\203\201:\004-\313\371ng\375f3*\370l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.8ab375e3ecf96cb3,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\230\004\002\230\004\003\204\004\004\204\004\005\230\004\007"
+	.ascii	"\230\004\b\204\004\n\230\004\013\230\004\f\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.8ab375e3ecf96cb3,"e",@progbits
+	.string	"(\265/\375 \364\255\002"
+	.string	"t\002\350"
+	.string	"\n"
+	.string	"\001\002\003\001"
+	.string	"\002\003"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\005\001\002\006\001"
+	.string	"\007\b\001\300\001\002\005\001"
+	.string	"\013\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023"
+	.string	"@\026=\027\266\354\250\331@z\003K\305\335\305"
+	.ascii	"*\030=\027la\2663\207b\345\247d\002\362\355\271`\013\263\235"
+	.ascii	"9`\333\006\332"
+	.text
+	.section	.gnu.lto_.lto.8ab375e3ecf96cb3,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_armingDisableFlagNames.9.8ab375e3ecf96cb3,"e",@progbits
+	.string	"(\265/\375`\215\001u\016"
+	.string	"VYaG\340\2246\0350\314\260\242\005\217\036\\9\234\026qtw\232p\324\310$\"\214\345\b\353\226>E\fFhx\244\230=jJ\303f\033\224\330\301\376\353\b\246\375\344#\326u\306.sa$0\202I\036\217~\377\333\313&\031N"
+	.string	"O"
+	.string	"P"
+	.string	"\250\tC%\312\2732\337 \027/&90\362\326\371&Y!\023A\336n\276C(f$\310\253\315w\211\211\004\363\035`\004K\"\230o\001!X]\323\001e\276\007\234\200\347\315\367\300z\315\r\207#\255\326\375\205\367\004y;\363\315\033\230\217\023\247q\033\277q\034\317\361\035\347q\037\377\361 \027r\"\006n\004e\245c\323\262@A\001\277\210\2069\344\031\346\273\003\304\001\213\274\247\231o"
+	.string	"=Zd(\3571\314\367\245\343dB\343\"\357+\314w\347\244\036\310;3\337\236\032\343|\177d\274\310\036\335<\334y\333\305\037i\273X\364\325\213\303\023\227\024j%\206,'U*f%3f!*[\245ZTY8\302d'\005X\204p\032\263\030Q\034\263\020\203\237v\361?\034\304E\334\346$^\3427?\361\024Wq\026o\361\027\307y\214\003\237\021\\m\203Q-\201\370\373\252\207\231\254d\223\305DT\3730\227B?\257\243)\246\252\2250\347\201`\265* \2109oT\242\036\3466jG\030X\253\026b\222\245\234]\200\325\022\t\253l`\307\340\303H\226\206XD\253\327\254u\001\037"
+	.string	"h\237M.\370\020\002\306\006\016An\200\310\236\331\371d\ta\316\0304\037\2201 \f\031\333\003\177Oe\007\3256`\033\220\210\206\234A\346 c@8\310\030\020\006\031\003\374\361\314\016\354\3473\277"
+	.string	"\265\311"
+	.ascii	"\340"
+	.text
+	.section	.gnu.lto_setArmingDisabled.11.8ab375e3ecf96cb3,"e",@progbits
+	.string	"(\265/\375`F"
+	.string	"\235\b"
+	.string	"\206P<7@\217\322\001\230\222\\\025"
+	.string	"\375\013\003\201\245\362\232\370/\240\345\236p\227\353C\377\033\242\233\263\200\301\260\177}\344\2039\212k\300\355\300\352\377\366\310\303\314\006\331D\312\224\002*"
+	.string	","
+	.string	"*"
+	.string	"\330\007\262C{\266\n\001\204\200\t\252\305\262\273Q/\356==\377\037\277|\251\322\023@aw\235_J\342\326\333>\260\235`;%_\375\230\2463\323\317\264\022\f\312n\304\253e]\220DC\263\375\264\337q\017\357+\222/\273\025'#\273,\004g\002\016\r\216\311\016\003\"\332\372V0\275\246\0365q:\310CH>\206E\243\374w\350\217\262\303\353B\306\006\205)_6\253\224ja\037\333\335\265\252\354\035M\003\007\363\226\351x8 nc\330|<!\220\250\213\033'\202<\232O\334\272\207\230)0\347\260\351b\210\343\272\250\261\366\330\252\312\220\303e\322\223S\003\f"
+	.ascii	"2\241\323/0.\020\0047)&Q\031\032Q\366\021L\271\004K\254\246\204"
+	.ascii	";\274h'\031"
+	.text
+	.section	.gnu.lto_unsetArmingDisabled.12.8ab375e3ecf96cb3,"e",@progbits
+	.string	"(\265/\375`V"
+	.string	"\375\b"
+	.string	"F\321>9@\305(\035\340\245\222\227\033\013x\024"
+	.string	"\303!\360w#\233\017\255\324\205\247\002\365\251\377\r\321\315\265pe\331O\1772\235ax\030\317\205\031{\222\274?\216\362\331\376&R\246\024,"
+	.string	"-"
+	.string	"-"
+	.string	"\226\303\354\004\226C{6\312\201\204\300\013\345\002\260\273Q3\356==\377\036\307|\251\322\363\322\260\273\316/Eq\353m+\330f\260\255\022\366Y\177\226i\325tf\372\227\001\f\003\221\335\211X\200\205\301\222\215\214\355\247}\216wxg\221\214\331\265x\221\354\266\026\254\005\034&\274 _J\352U\365(\325\351\037\007!\371\032\026\215\362\337\241?\262\034\246j'\252L\257\231\225\021T\205)cv\253\224za?\333\335\265\256\002\035\315\003'\363\246u<\034\020\2679l>\236\020H\324\305\215\023A\036\315'n]D\324\020\314Al\272\030\342\270.fZ\373lueh\0023\351\311\252!\352\n\r"
+	.string	"2\241\363/0.\020\0047)&\300\320P\331"
+	.string	"\323\002"
+	.ascii	"\263.a\021\253\321\341\016/\332I\006"
+	.text
+	.section	.gnu.lto_isArmingDisabled.13.8ab375e3ecf96cb3,"e",@progbits
+	.string	"(\265/\375 \371\345\006"
+	.string	"\362\f05Pm\222\016\244\204\325\2009\213\021H:\261\002E\326VZ\301\335\266\261\354\377\33524[\005\243[\273\303\356\233\231Y\242\351\"=&\301\373*6\330\260\3667\221)[\031\210k\203e\226\203\206su0\217\366\254\315\303\256\007\316\2634\211\227)8\213\320h\257\223e\332\303\240\262xB4\020\341\350\233p)\"\22642\252G?<w\343\211\217k\251\325\375\\Z\025\003.D.\365\250\220\303\214\257%\361\364\273\321\271k\021@\0318\311\254H\255$I%\302\361\203\036\363\002\003\350\215\200\002KLH *\231\250\207\032\335\352\266\333\216\036\204\244\224L\241:\200\206\314\334\225L\026\035\373#\374\n?F\t"
+	.ascii	"2\001#8#\216#D\250@\\\023\375\"2\022\"\217\273\321i'\031"
+	.text
+	.section	.gnu.lto_getArmingDisableFlags.14.8ab375e3ecf96cb3,"e",@progbits
+	.string	"(\265/\375 \365\305\006"
+	.string	"\362\214/3pM\322\001\260\006\200\325?@\3331\312 \350\202M\255\002\314X\252m\ri;\303-\342\357"
+	.string	"\365o\343\027"
+	.string	"\240\022w\351{\216\003\223\311\237%\233H\231R~\027\007*S\301\307\200\321P\233*\302r/\343*\252A\343\236\005\341.\006\206\017\030\313m \264\334\024\367\nJ\265|t\302~\310\343\345sX\202\223\307\336|\216\364\226\032\200\361\311\220\035=\251\031\366\243U\220\355t\252\300H\201\311nEheQZI\207\355\216=\371\036\377\350\370\212\342F\266\240B!\222\262\033\235\345\004\322[\364\001\351M5~=/\377 ? 9\3012\317\023@aw\235Xfq\353m#\330N\260}\021\b"
+	.ascii	"2\003\316:#e\b\3055Q5\002_!\262pW:\355$\003"
+	.text
+	.section	.gnu.lto_enableFlightMode.15.8ab375e3ecf96cb3,"e",@progbits
+	.string	"(\265/\375`\034\001M\r"
+	.string	"\366XZC\020\221\223\016;\212a\245\"\002)\005\001\032\373\362\017K\322\323\332a\tVF@\264Xv\216\025B\332\277\241\235b\036\315\027Y\212\365PO\240\024\201\"\024\022\025\200\030\200\210>r\036\352{\b#{K\231RF"
+	.string	"D"
+	.string	"D"
+	.string	"\351\205\320`}\035\307rc\327\313\b\334\200\365\230/`=*\210o\207\232\233\377\357\320\004\007\027\235it\210r\205\031\030*n\200\251\004?N\035`\376=/\230H\231"
+	.string	"\030\354\256\2633m\270\343m7\260\275\300>\206\216\232NM?\200U\342\305C\306n\206\025\216U\305\027#\216\372m\221\377\271\303Gm\327\272\\\334wBc\327;\360h\005W\246}\025_\021\335\263`l\367C\f\227]/\2015\327c\006\332\366Q<\205\310[\036V-\252*\352q\262\362\315(e\214S[\336\325\210zM=\207B\312\225-\275>H\261\301\3458\313S\233/\302$%\371\356\321/\261\036\243\352K\352D\212I\256lo\224\252b\037\256\236\214\335\373\255\243\036\"\033\007\021D4kBh\343\201\346h$tB>\032\007\002\210\2473\362!\001e\234\220\354\323\331x2\016(\224i>\254Q"
+	.string	"\001e#\232\006\312:\274=\\=a\2321Q\222Y`\252+Z\300\300+\021\334\256\020\312w\026\220\"\241*\351\3501\001\030"
+	.ascii	"2\241')p\206\303 \270bp\2451\3626*\341\016\027\270-\2061\n,Q"
+	.ascii	"\025\017_YcQ\355\271\220\307\315\260\266\260\2024\2735\241XN"
+	.ascii	"\235\203v\001)\201V\3354\245PP"
+	.text
+	.section	.gnu.lto_disableFlightMode.16.8ab375e3ecf96cb3,"e",@progbits
+	.string	"(\265/\375`C\001\375\r"
+	.string	"6\233_C\020q\224\016\033\226\036\032\226\260d\002d{z"
+	.string	"2\026B\263\335xT_$\3545\244_\201B\316\332>\266=&\242\252\3327\226\023\372\252@"
+	.string	"\025\240\260T\001\342\005"
+	.string	"\206,\f\305A#\371\233l)S\nL"
+	.string	"H"
+	.string	"H"
+	.ascii	"\366O\034\205\310\\z\253\f\361[\235Tr\354z\233\200\203\304c\371"
+	.ascii	"\001\361\230z8w\250\311\371\377\016K\250^\035jt\270\341\n\r\270"
+	.ascii	"^\340\b\2002A\020\224\020"
+	.string	"\335\277\347\005T)\363\302`w\235\035J\303\215\335v\003\333\013\354\217\b\306\334\373/g\335Q\323\252\351\324\364?\242\253\205\200\213]\224\027\217e\301`\2108\353\267o[\344\177\326|\026\227m+;}\037\\\273\336\201cV\220e\332Oq\025\242{\026\f`\227\003\215\326\256\227\300\231\354X\b\264\003\030H|6L\271\303Q\257\232:UY\274\273A\312\227\252\376\224*\345\313\327\324\237T\027\275>P\3258\365\270\312W8\037\204MN\362\3351\377$\036\213\252-1L\244H\371\262\275Qj\007\373pw\327\232bkZs\006$\032\007\021H>qBH\323\201\336d$pF<\237\r\004\221\016\247\304c\002\3326#\233\207\243\351l\033Ph\313\024\360\207\202\bh+\371|@\233\346\355\341j\nFCHZr\013\214\352\n\031:`\226\bnW\b\345;\177\254\314`1\351\350\253\035\256\226rQ\323T\030"
+	.ascii	"2\241u)\260\206\303 \270vp\2253\3626J\002\034X\314\226\312v\276"
+	.ascii	"\267\326R\n\021,\006\004\303t0 \225I\026\325\310\343\302Q\023"
+	.ascii	"\212\345\3249h\027\220\022h\325MS\n\005\005"
+	.text
+	.section	.gnu.lto_sensors.17.8ab375e3ecf96cb3,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\305\b"
+	.string	"v\321>9@\305(\035\240.0n\316\330\r\372t(\2060\244\017\245\\\00473\231%\2712[\257\323\372m\212\262\341\304\237Lg\030\036F\347\204\2314)\270\n\255?\030\331[\312\224\002/"
+	.string	"."
+	.string	"+"
+	.string	"\003\330\241\025H.\275\273X}b#\025\262\262\333E\265x\351Y\362\357\361\247\022\221\242b\231\236\001\013\273\353T\261 n\275\355\003\333\t\266K\002\232NM\037\303"
+	.string	"\240\024\230\354\256^\001\366\004\216h\330&\331\027\333\231\3669\336A\272kd\313\256D\206\310n\207\340L\340\020s\002\354\360=)\022T\276\374\364\232\372T\013\365\217\203\214|\f\207Dy\325\241/\302\016\257\226\326)_vgJ\255\260\377vw\255\024\206w\375/\016\237L\347Y\313\0328\033\317\2461h:\034\220'\304Em\023=\234L'j\334'f\006\336\0364\\\004m\033\027/\335\336P1'E\331\037a\251P\037\t"
+	.ascii	"2\003\302\260\200\341H\204\262\244\313(E\215\007t\004\274\b1"
+	.ascii	"L\327$\003"
+	.text
+	.section	.gnu.lto_sensorsSet.18.8ab375e3ecf96cb3,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\305\b"
+	.string	"\306\220=9@\305(\035\340\335\326|\355\\<\230\220\200\033\306\032\322\277\224\333%\0354\246\362\223\372?\342O\317\302)\033\201t#\323\0316\236\3461a\306\236\b\363?\345c#{o\231R*"
+	.string	"-"
+	.string	"+"
+	.string	"\002\327\245;;\345_\306\036DU\022Y\331\335\t1\336];\377\252_<\223\350jQ\330]\253g\232\270\341m\037\330N\260\215\022\177T\265\252\372\227\345dB0\262+\321\n\260,Y\262\201\261}\265\337q\217\356\251\220/\273\026\034$\273\037\202\261\200K\203\017\\\227\361\001\367T\"<T\370\322\211\364\325?B\276\206#@z\357\322\007]\227\207ru\002\240b\244-\373\023)\274\260\037ww\rQ\366S\001\016\236\f':\303\032\264Mg\313\0304\034\355\323\201\340f\266\231\035-\303\231\031\347\231X\201\267\007\r7?\333\306M\314\267\217\013Q^\240`\215 \311\nC\002\f"
+	.ascii	"2\241\333/0.\020\004\027)\036R\031bQ\366\025L\271\004K\254\246"
+	.ascii	"\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_sensorsClear.19.8ab375e3ecf96cb3,"e",@progbits
+	.string	"(\265/\375`Y"
+	.string	"\375\b"
+	.string	"v\321>8@\217\322\001X\301\331L"
+	.string	"\252\202\201\221\020\254\025\337\214\314b\030:\237\360\242\326\377\206\370\343\262)\301\036\323Z2\231gt\303\341\373\201\325\377\221\340?E\237\020\"eJ\001,"
+	.string	"."
+	.string	"-"
+	.string	"Z\366\200\355\232?{\345!\307\236\344$e\002\333\335\250\033\377\236\237\377\220g@\225\351\211Q\330]'\250\242\270\365\266\017l'\330\206\005w\375Y\2465\323\231\351c0\027*\004,\273\023\261\227}i)\037\032\333O\373\255\203|w\225\234\331\315h\241\354\206\b\336"
+	.string	"\\3\270\300\366-\251W\325\247V\250\213|\244\344{X\202\224\007\257\371\244\355Z\352@\307*\323+\203\205K\252\342\2241;4\245j\330\317vw\255,;\017\"\016(3\267q\370xB\035\327\320\001}F\241\b/r\236\030\372p@\221\363DqS\340\016\242\343\305Q\327yQ\023\356\263U\226\0270^'EY\265\344`\r"
+	.string	"2\241\371/0.\020\004\027)\036\300\320P\331"
+	.string	"\323\202"
+	.ascii	"\263.a\021\253\321\340./\332I\006"
+	.text
+	.section	.gnu.lto_sensorsMask.20.8ab375e3ecf96cb3,"e",@progbits
+	.string	"(\265/\375 \370\325\006"
+	.string	"\"\r03`m\322\001@\203"
+	.string	"3\017\356"
+	.string	"\253\301\025J\324\376\272\335^9e\205h\026\365.\300R?\035"
+	.string	"\337\362\027Ee\301\242\t\346\375\3560\315\240\335{K\231R\2260\t\223\206\252\244\203\314f\342P\f\026\2244\220\232\0206P\262\026 f\300\225B\306\202\234\252\262\240%\3565\224z\001\251\203\375\216\307\313\307pC'\217\335\371\235w\227Z\221"
+	.string	"\345\310\216\237\324\n\373m5d;\235J\021\225\b\204\354B\214N\226\304\201d\330\366\330\026_\343\033\036_-^d\317C\344\341\303d7\302\313\003\336];\300\273S\213_\317\313?\307\233\210b\004\313>O\212\301\356:\261,\342\326\333&\260]`{\"\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.8ab375e3ecf96cb3,"e",@progbits
+	.string	"(\265/\375`f"
+	.string	"\345\004"
+	.string	"\202\207\033$\2407\035\330\367\377\376\370\\\374\025\372\365\245\263\237\177\364\377\377\243\273\377\357&\264\324DDDh\223$[\312\024N.\304\004\366p<\327p\201\210!2\306\323\266\273\366 \023\334\302\200\001j%Z-J\275\232N\275O\222\242\321\037t)]x\234:\217\232C\314\237\\\356d\263\361Z\205Q\333iX\205}\273q@dw\327\275I\333H\b\022"
+	.ascii	"5\033j\263.\303\345\007F\003\271\261\262k\230\301\001\332\201"
+	.ascii	"\317\301w%\2239@;\370\307\006+\003z\200o\354\374\210\b\255\312"
+	.text
+	.section	.gnu.lto_.refs.8ab375e3ecf96cb3,"e",@progbits
+	.string	"(\265/\375 a\365\001"
+	.string	"\342\304\013\020\260%\351\f\3030\245\266\265\335\310&{\313\224\002z\t\330\251]9L\251\205y\031l\221\212!\016\322\241\235\0242\262\363n7\345}\235\032\b\004"
+	.ascii	")A\2119\233\022\327\273\346\030"
+	.text
+	.section	.gnu.lto_.decls.8ab375e3ecf96cb3,"e",@progbits
+	.string	"(\265/\375`G\017\275K"
+	.string	":\204\274\034T@R\312I\007\036&\256\013\335^b\230\333\346\202\366\003E\257\177\371\001\347\333T\305\335\200\370\321\202,\255)Xq=\"\246\243\231"
+	.string	"\366\317"
+	.ascii	"\321\245\005\r\372\351;\360\2151v\361\210\321\334\212\252V\027"
+	.ascii	"3\177\224s\2625\2573\373\250\316\205e\221!\275\233\224)w\001"
+	.ascii	"\266\001\300\001\333\313\356\026vwM\361\230v\343\330A\261\240"
+	.ascii	"\240\272\247J@\365Qh\306\324\315J/P\214h\262\n\3113\023Kb\365"
+	.ascii	"\f\251p\261z\215\252x&\205^\375\324\335;\346\3042\322\020\303"
+	.ascii	"u\237l\331\246'\026\312\327l}\270n\230v\312>\340\306\300\270"
+	.ascii	"\356\254\217\311)\234\337\023f..nO\230@\353\304\206\230\352\330"
+	.ascii	"p\031\203\203\222\353K8\307\226\311\016\212\312\222-\\\237\301"
+	.ascii	"9\266KN5\267\035V\270\376\201\363_1 \0347.JYa'Nb\224&\\\234\\"
+	.ascii	"\256\005\313\241O\310Vv\247<:\260*ZC\256\333\303vm\272`\377z"
+	.ascii	"\355\327\353\027\262\223\335)Nnh\003\255\214\353\317\372\230"
+	.ascii	"u{\314\257\222\003@\325\024\234\317/\220\251\263@\346\323\365"
+	.ascii	"1\317\3551\027\356M\367\257\231\rA\b\266,\377\202\260-\3767`"
+	.ascii	"\363/\020]\352\277eY\306\276\320\266\366\203\377'\376\177\231"
+	.ascii	"\377\016\371w\367\257\007\377v\360\357\320\277\033\374\213\301"
+	.ascii	"\277\027\374[\301\277B\377R\360\257\212\177S\374\033\364\357"
+	.ascii	"\003\377:\360o\003\3772\360\357\317\277\t\374\357\371\271\200"
+	.ascii	"\177\r\370\267\304\277\002\374\033\300\2778\377\376?\334\377"
+	.ascii	"\267\377f\376\223\371\317\366?\314\377/\377\273\374\327\362\037"
+	.ascii	"\355\354\277\017\377\235\374g\362\177\311\377\260\377\311\377"
+	.ascii	"`\377\007\370o\345\377....\356\347\372\363\002\377n'\013f7\314"
+	.ascii	"7\3350\033\205\323\037.\247cV\027\317 8wh\035)\363\021\305\024"
+	.ascii	"B\210\375\302X5b`Mlf\025/?,\361\362\375\262Q\370JJ\331\262\311"
+	.ascii	"\027*\2474\034'\027.\333\305\306\202+nl\247\023\035\3200uQ\326"
+	.ascii	"\204\t\002K\025\256g\342\211\005\313j\261\311y\001\343td3\270"
+	.ascii	"\034fo\373j\3314\233!E\252\236\270n\032o\226U\373\246\355rGL"
+	.ascii	"7\255v\017wM\344\354\232\320I\0012\0043\3537\315\371\035\342"
+	.ascii	"DC\333\263s\247\225"
+	.string	"\300`a\313\351J\273\226\250\234_*\273V\276\351ZYe\013\016\320\234\261u1\205\340+v~Wi~\177X)\337)\351N\331\263\235ja\031\001\276\2724\265\235\351\251)\240\021j_mI\256{\366K@\301\303\354\272\271\272\333\200\215\313\022v\205\353\333V\271+B\2654\206\353\027=\317\277\331\303bwK\351\322.*\355\314\325\355\002\3758\233[\005:\247SDw\024\027\231\263H\331\360\206\377tV\267\220\247\323.\242I*!\032\226f\344I[\007\211NZ5\232R\031+\262\271\323\336&R\031_@Sd\021M\221\302\235&\"\205\335\251q\007U\016\205\213&\251\214h\022i\344ib\013;9\324q\022\221F\364\n\322\270\203&\207F\224He\344\231\301U\265\206\216I;\356\020\224\3303\240\216\303\342\316\022M\221\275\326\275J\246.*\320}D\026\327\2067\026\212\322r\206\222\223!r\323\356\036"
+	.string	"J\251\n\331\304%j\004\331mD\tFC\251\020\246\313\336a\227B\253c?1u\023"
+	.string	"\325-\fL\305;\354\236\240\205\361\340\n\344\305;\367\250Ve\242\210\350\300\243\315K\325\f\\\317<~\266\342\035D\023%R\031\341\232b}Ls{L\246\342\235\253rkF\263\032\270\352X\007\022\207\216\035M\\\317HnR\241;i\363\244\307\025\033W\316\301;\347`\201\017+-\256\271\3551\031\007\343\340\343~uT\211!\235\226u\246{\nHGGGq\343\033\316G\335\226\017\351\r\226\322U\225\001SF\346\374y\212\247\226\254\022\3236\232aW9\246\234\341\001\262D\002f\303\006K=\327\235C\013+\327\003\207\225)$\347Yj\271F\3125X\252\204\005D\266\330r\316\314\240\020\361\343\374\262\224\311Q\\\334\364"
+	.string	"6\342\244I\222\346\215\353sV\347\367"
+	.string	"s\343\366"
+	.string	"\363\233dy\270)\017\031\252E\332B\026cS\020\230NfT\t\343z\206\372Y\211\211\374\264Cv\023\273\233\304\r\227\031jj\374\304N:[5x\374H\271l\314\336\216\324\300\225Q\246\341\334\3043\344\204_\334\244\002\331=\344\246\241\316\256\211]\023U\253J\b\023\263>\227\303\311K\2743S\217Y\234J[\307L\343\346\244\344\252\263=\346\331\353cn\347\3203.\216\033"
+	.ascii	"*86\322\204\020\341&\313yA\262\024R\004\034\334\276\2519\301"
+	.ascii	"\332)k`PD\234nn\373v\202)q:V \206`\242\320|\337\252\232\022."
+	.ascii	"kZ\316o\333\256\0313KV\3236\232\320\345t<\303R\310L1b\226L\213"
+	.ascii	"\264\243\266J\313\274\261%\b\246\035\363%\203\323\026\266\354"
+	.ascii	"\"3\203\210*\002\r\031\033\333~Y\265\036N\307\254\033\246'\345"
+	.ascii	"\326\326\371\207\201\"(\311G\002\350B\257\267\001R\222/X$\343"
+	.ascii	"7\364\353\271\320\353\255@\3420P\210p\002\b.\202\202\275\243"
+	.ascii	"_Q\360\247\005\243\244\030C\275_\322\220\214^\020(\203\013\235"
+	.ascii	"\233`Q\0208\"H$T\363+\202aT\201=\031E$\b\320\002\260h\204\233"
+	.ascii	"_Q/\306\320.\330s1\302\305\213\034\340/\t\210\324\003\326\274"
+	.ascii	"\340\321A\352\355\034\371\304HJ\332\200H\007\364\355 \301\320"
+	.ascii	"\003\300\023x\222\013\275_P0)\351\027t\363B\203`\017\310s#\337"
+	.ascii	"\257\207\324;:\257bE\004+\204b\250\271\020\213\024,R\230\027"
+	.ascii	"b\301\343\261X\301;\277\202\227\013\022\255\340\005\211$\230"
+	.ascii	" \210\344\203\341|\2214B\020\306\221/\006\013<=\"\340QQ\f\017"
+	.ascii	"z1V(\002\37288B\362\311\370\025\005\360\n*\030\372A\201\204\017"
+	.ascii	"N#\024G>\026\220\222\214\210z2|A$\030~AF,\004!\371\212d\004\031"
+	.ascii	"\375\200A(\020h\262d\347X\230\245\023\023>\346\234\251\262\205"
+	.ascii	"\206\261(\346\215\245\267&\312U\372\322\240H-\021#2\016a1e\016"
+	.ascii	"\034\020',\\9\f\0012)fI\260\332\246\005\215\006\3273\330\317"
+	.ascii	"^\374\265\345\211\230\036\\\205\326\307\254\261\342\235S\356"
+	.ascii	"\201\007z\245\244\313\306\222\227\r\\\317]?sq\0178G\"V;\270~"
+	.ascii	"\271>\346.\b\357\274\245\263\301\212\016\037ZIt^h\031&\\\317"
+	.ascii	"I~&\302YW5\320\300\302\365\312-\336\031\211\216ZY[\020\036\216"
+	.ascii	",\025\257,q=\037\371\371\007\033\211\023B\346\211\353\241\020"
+	.ascii	"\341\235\213\334\020k0\t\302\325f\b\326\316+\212\206\021\256"
+	.ascii	"g\254\237\203\260\020\t\236v\320\201\353\317\326\307\274\371"
+	.ascii	"\301;\0031\263\3207-\256#|\\\335t\021\2732\306\365|\365\007\201"
+	.ascii	"'\250a(\206\024E\304\310\310\210\210$I\222\016Q\005\204 (%\265"
+	.ascii	"\003\021 \251\263J\210\024$M\n\373\034)ypk\226K(?\227a\352c\351"
+	.ascii	"\222)\007]\307\n\241\3051\007\344\363}\332\221\")|>i?\016r\366"
+	.ascii	"^\223\334\\\354\352\340\032\313\330\373i\311\226\247\370$\325"
+	.ascii	"NR#\223\367)\336\222G\365\252\276\220\367,rM\335b\006\\_\256"
+	.ascii	"Z\017pm\235\326\360L\365\216\203\367\332E\336\350\021>\031\311"
+	.ascii	"\020\027\234\004^\234\334\030[\216\315\346"
+	.string	"\236\363\326\355R\023\366qJds\261o\254\255\207\305\310\223(:\260Ox\003\327\326Ub\2022>\201\214*\302t\233W\030:p9c\033\223\267\">a\240\201'3 \363\254\343\220\267\200,\312X\267\013M\326{\n\321\255\006\351\371D\204W\023\311\350l\022\303\257Y\343\274\257y\332\357\204\372\257L\2506e\233+\265\302,\227\231\r\210$\311?9\245\3540\021/\246\245\277\307\"\r\304P=U\003k\341\303\004\223}\375Tsa\252\034h0\313\016:\fd\262\372\357\200\024\r\252\373L~\370\266\\w:\f\353\020\330{\213u\213\327\207\261!\255+@\036\273p*\313\205(\212\311\277`\252\215x\301\207T\034[ \303g\214\333\257\n\242\271\002\204\333\214i"
+	.string	"\037fnOV 1\376\370>\252\221\360E\206\210)\201\003\214zn\277\225\026<+\023\273"
+	.ascii	"|\333\320\264\340.e\2361\210\037\356\034\342*E\257r\335\323\222"
+	.ascii	" \230WI\004\207\004\224+]\217i\207\356\177O\317\345\003\256\026"
+	.ascii	"\220\275D7\001\334\332|\034>0\315\260\024\261\210\201\377\231"
+	.ascii	"\004|\357dp\362Ma\301\321\215\022x\352\322\362\315\364\263\372"
+	.ascii	"\314\266\376\363@\364\036\234\360A\342~|\241\364>\305\376\242"
+	.ascii	"4\370\273\0372t;\350\332\265<*\001\223&\27581|\240\f\346]X\300"
+	.ascii	"T1\n\367:\267\337e\304.|ao\200?{\275\365\036\372lY7\211G\213"
+	.ascii	"\236\030\367\247l\300\230\311<\344\033\t\360W\270\3006\211\300"
+	.ascii	"\036\347;\007\306\310\370\275\rC%\337\377\335\315fN\277\312u"
+	.ascii	"{\177"
+	.text
+	.section	.gnu.lto_.symtab.8ab375e3ecf96cb3,"e",@progbits
+	.string	"setArmingDisabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330"
+	.string	""
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335"
+	.string	""
+	.string	""
+	.string	"isArmingDisabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344"
+	.string	""
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347"
+	.string	""
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353"
+	.string	""
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356"
+	.string	""
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360"
+	.string	""
+	.string	""
+	.string	"sensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364"
+	.string	""
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373"
+	.string	""
+	.string	""
+	.string	"sensorsClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375"
+	.string	""
+	.string	""
+	.string	"sensorsMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"armingDisableFlagNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.8ab375e3ecf96cb3,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1402 @@
+	.file	"settings.c"
+	.section	.gnu.lto_.profile.3ffbe19a238260ad,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3ffbe19a238260ad,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"\265\007"
+	.string	"\304\r\005\001"
+	.string	"%"
+	.string	"\343\323\306\321\001\002\002"
+	.string	"\002\001\001\257\221\313\212\013\006\002\002\002\001\356\251\243\252\005\004\003\002\004\003\251\215\304\323\013\004\005\002\001\004\233\364\343\336\006"
+	.string	"\005\240\342\234\212\n\006\260\275\347\262\r\007\257\232\347\237\n\b\377\362\343\303\r\t\376\367\260\205\006\n\323\347\261\306\003\013\330\264\373\207\t\f\221\327\373\372\t\r\261\372\215\340\017\016\367\316\327\257\017\017\371\270\213\276\f\020\225\254\310\321\004\021\216\307\310\264\005\022\356\214\300\203\f\023\337\257\374\304\r\024\331\246\217\340\n\025\201\200\324\222\b\026\210\270\313\332\b\030\231\246\357\235\n\031\355\316\316\363\b\032\374\232\275\327\005\033\365\236\302\302\r\034\342\223\240\267\n\035\302\260\202\373\013\036\263\374\313\376\005\037\214\266\327\221\001 !\"#$%\240\342\234\212\n"
+	.string	"\n"
+	.string	"@\004\334\201\306R\"N\037s\262\250\206\\\244v\007\312\264\255"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.ipa_sra.3ffbe19a238260ad,"e",@progbits
+	.string	"(\265/\375 Z%\002"
+	.string	"$\003N"
+	.string	"\005"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\004\003"
+	.string	"\002\001\001\001\002\006\002\002\b\001\001\200\004"
+	.string	""
+	.string	"\002\002\001"
+	.string	""
+	.string	""
+	.string	"\005\003\001"
+	.string	"\003\001\002\002\006\002\005\t\004\003\004"
+	.string	"\001"
+	.string	"\006"
+	.string	"8\203v*\t\330\0333'3\t\333"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.3ffbe19a238260ad,"e",@progbits
+	.string	"(\265/\375`4\001M\b"
+	.string	"\322\016--`k\222\016\200p>F\311\301\306\340\376\235\240\241\264bx\021\231\234\023v\267\272R^\270\300\002\304\362<B\300\214i\341\311\223O\266\334)\377\375\213\360\364\277&/\250\257\347\256\347\256\003\274`2.*\b\221\231"
+	.ascii	"\227A.\300\325\344\034\365\364,.}\226^(:&\2321#\301\361\260\322"
+	.ascii	"\tx\0045\"*0\002\356\006\016\367\372\006\237\265\023\324nb3\312"
+	.ascii	"\254\315 \326.\203\236+\335\310L\201\3730df\303Gn\270\352\255"
+	.ascii	"\303\\j\316Q\257F\327\360s\324\252\302\217\317\202\231\314\034"
+	.ascii	"\370$M\247K\271{\325G)\275\200Cz\337\207\320\314\314\365\217"
+	.ascii	"K\020# \220\"c\001\335\001vP\3151I\347\325q\245\270\001\332-"
+	.ascii	"\026E\312]\216\235\b\334@\330\320p\235\022{\b\002\225\224\003"
+	.ascii	"\307\222\326\344x!\nB\234\217\"\n)\240\263\204\342\212\210\331"
+	.ascii	"\3342\017\371nH\227\033Vl\361Y\304\277\232\016i\335V\334!"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3ffbe19a238260ad,"e",@progbits
+	.string	"(\265/\375 `\025\002"
+	.string	"\004\003T"
+	.string	"\005"
+	.string	"\001\001\003"
+	.string	"\002\001"
+	.string	"\001\001\001\003\001\002\001"
+	.string	"\002\004\177"
+	.string	"\001"
+	.string	"\001\300\004\001"
+	.string	"\300\004\002\177"
+	.string	""
+	.string	"\002"
+	.string	"\001\377\377\003"
+	.string	"\003\004"
+	.string	""
+	.string	""
+	.string	"\006"
+	.string	"K\030\025\263"
+	.ascii	"p\2673\204\361\034o\003X"
+	.text
+	.section	.gnu.lto_.pureconst.3ffbe19a238260ad,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\231\004\001\231\004\002\231\004\003\205\004\004\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.3ffbe19a238260ad,"e",@progbits
+	.string	"(\265/\375 \223\275\002"
+	.string	"\"\304\r\032\260%\351\2003$ \245\303P\004\303"
+	.string	"$IR\335h\255\265v`\322dJ\001\252\022\251\034\347@c[\254\312e\230\212<\"\217\357*\001\356\n[b\253&\260\306$\f"
+	.ascii	" \210\022\034\214AD\b\207\320.\020\004cT\327\213\035O\013`\027"
+	.ascii	"\242\354\330@\033"
+	.text
+	.section	.gnu.lto_.lto.3ffbe19a238260ad,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_lookupTableAccHardware.148.3ffbe19a238260ad,"e",@progbits
+	.string	"(\265/\375`\220\0015\r"
+	.string	"T\025\321\001"
+	.string	""
+	.string	"\263"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\360\232\002}\273\001"
+	.string	"\005\001\006\025\001\017\005\001'.\206\b{\370\326Qy\276\016\005\001'6\206\bw\bu\301\r\005\001'@\304\f\005\001'J\307\013\005\001'T\312\n\005\001'^\206\bsq\315\t\005\001'g\320'p\322\007\005\001'y\206\bo\230\326\001m\325\006\005\001'\205\001\by\330\005\005\001'\215\001\333\004\005\001'\226\336\003\005\001'\237\341\002\005\001'\250\001\b}\344'\256\346\001"
+	.string	"?\202\210\200\300\002k3\347\0014\345\001\343\001\342\001\340\001\337\001\335\001\334\001\332\001\331\001\327\001\326\001\324\001\323\0015\321\001\317\001\316\001\314\001\313\001\311\001\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005FAKE"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.string	"\007BMI160"
+	.string	"\tICM206890821"
+	.string	"\bMPU9250650000"
+	.string	"\013LSM303DLHCA28MA8452ADXL345"
+	.string	"\005NONE"
+	.string	"\005AUTO"
+	.string	"'  \243)r\003["
+	.ascii	"\315\222\302\006\215\255\221\216[\323\fJ+\364\004\272][[pi7\234"
+	.ascii	"\211\243\315X;\3572!\221\227\236<\306\262\213k\3263O\306\036"
+	.ascii	"n-\301\365\214\021\2261\374\311D\2562&\376xv\310\321\227_\303"
+	.ascii	"L\006\007\007"
+	.text
+	.section	.gnu.lto_lookupTableGyroHardware.149.3ffbe19a238260ad,"e",@progbits
+	.string	"(\265/\375`h\001\315\f"
+	.string	"\304\024\263\001"
+	.string	""
+	.string	"\251"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\340\233\002}\273\001"
+	.string	"\005\001\006\025\001\016\005\001'.\206\b{\370\335Qy\276\r\005\001'6\206\bw\bu\301\f\005\001'@\206\bsq\304\013\005\001'K\307\n\005\001'U\312\t\005\001'_\206\bom\315'h\317\006\025\001\007\005\001'q\322\006\005\001'z\230\335\001y\325\005\005\001'\202\001\330\004\005\001'\213\001\333\003\005\001'\225\336\002\005\001'\236\001\b}\341'\244\343\001"
+	.string	"?\202\210\200\370\001k3\344\0014\342\001\340\001\337\001\335\001\334\001\332\001\331\001\327\001\326\001\324\001\323\001\321\001\320\0015\316\001\314\001\313\001\311\001\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005FAKE"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.string	"\007BMI160"
+	.string	"\tICM20689"
+	.string	"\n08G021"
+	.string	"\bMPU9250650000"
+	.string	"\007L3GD23050"
+	.string	"\tL3G4200D50"
+	.string	"\005NONE"
+	.string	"\005AUTO"
+	.ascii	"# \360\"\302\306\006\207\254\372@\227\203j\250h\214J\306\240"
+	.ascii	"\016\362\356\260E\206\361t\227\263{\037\235\214]\346\020\231"
+	.ascii	"\300x\361\254\217\266\2321\316qK\230\214[\234\260\031\343\374"
+	.ascii	"=\023\025\327e\034\341<\2173\367d\335 \277\241\027\001"
+	.text
+	.section	.gnu.lto_lookupTableBaroHardware.150.3ffbe19a238260ad,"e",@progbits
+	.string	"(\265/\375 \347\345\005"
+	.string	"$\n\220"
+	.string	""
+	.string	""
+	.string	"K"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\320\234\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'0\370\344Q}\276\003\005\001'8\b}\301\002\005\001'@\206\b{y\304'F\306\001"
+	.string	"?\202\210\200(w3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\007BMP280"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.string	"\007MS5611085"
+	.string	"\005NONE"
+	.string	"\005AUTO"
+	.string	"\t"
+	.ascii	"QVB\264\311\030X\f\b\347\231\007\330\332g\326\nj\277\001\024"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_lookupTableMagHardware.151.3ffbe19a238260ad,"e",@progbits
+	.string	"(\265/\375 \350\375\005"
+	.string	"T\n\220"
+	.string	""
+	.string	""
+	.string	"L"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\300\235\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'0\370\347Q}\276\003\005\001'8\206\b{\by\301\002\005\001'A\206\bwu\304'G\306\001"
+	.string	"?\202\210\200(s3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\007AK8963"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c75"
+	.string	"\bHMC5883"
+	.string	"\005NONE"
+	.string	"\005AUTO"
+	.string	"\t"
+	.ascii	"ITC\264\311\030X\f\b\347\231\007\310\334g\326\nj\277\001\024"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_lookupTableOffOn.152.3ffbe19a238260ad,"e",@progbits
+	.string	"(\265/\375 tu\003"
+	.string	"4\0068"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\246\305\356\021}\273\001,\206\b{\270\356Qy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\003ON"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.string	"\004OFF"
+	.string	"\003"
+	.ascii	" \t\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableCrashRecovery.153.3ffbe19a238260ad,"e",@progbits
+	.string	"(\265/\375 \230u\004"
+	.string	"\004\bV"
+	.string	""
+	.string	""
+	.string	"6"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\310\236\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'.\206\b{\270\364Qy\276'2\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\005BEEP"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.string	"\003ON"
+	.string	"\004OFF"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableUnit.154.3ffbe19a238260ad,"e",@progbits
+	.string	"(\265/\375 ~\305\003"
+	.string	"\324\0069"
+	.string	""
+	.string	""
+	.string	"9"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\350\236\002}\273\0010\206\b{\270\366Qy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\007METRIC"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.string	"\tIMPERIAL"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableAlignment.155.3ffbe19a238260ad,"e",@progbits
+	.string	"(\265/\375`\212"
+	.string	"]\t"
+	.string	"T\017\f\001"
+	.string	""
+	.string	"r"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\235\362\310\250\002}\273\0013\370\377Q}\275\001"
+	.string	"\005\001\006\025\001\007\005\001'>\206\b{\230\377\001y\300\006\005\001'H\206\bw\330\376\001u\303\005\005\001'Q\206\bs\230\376\001q\306\004\005\001'X\330\375\001q\311\003\005\001'_\206\bo\230\375\001m\314\002\005\001'e\206\bk\330\374\001i\317'j\230\374\001u\321\001"
+	.string	"?\202\210\200\310\001g3\322\0014\320\001\316\001\315\001\313\001\312\001\310\001\307\001\305\001\304\001\302\001\301\001\277\001\276\0015\274\001"
+	.string	"\nCW270FLIP"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c18\tCW9\bCW\006180"
+	.string	"\005"
+	.string	"\004CW0"
+	.string	"\bDEFAULT"
+	.string	"\027"
+	.ascii	"D\205\252\"\244p/\313\030^\r\002\006A\252\341\020\3146`\037\310"
+	.ascii	"\021\344\007r\004\371\201\375@~ G\220\037\310\321g~\254\312\027"
+	.ascii	"\254\270\323\266\001\024\001"
+	.text
+	.section	.gnu.lto_lookupTableGPSProvider.156.3ffbe19a238260ad,"e",@progbits
+	.string	"(\265/\375 y\235\003"
+	.string	"\204\0069"
+	.string	""
+	.string	""
+	.string	"4"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\231\332\360\250\002}\273\001/\206\b{\370\306Ry\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\006UBLOX"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.string	"\005NMEA"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableGPSSBASMode.157.3ffbe19a238260ad,"e",@progbits
+	.string	"(\265/\375 \343\365\005"
+	.string	"d\n\220"
+	.string	""
+	.string	""
+	.string	"G"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\231\332\320\251\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'/\206\b{\370\314Ry\276\003\005\001'5\by\301\002\005\001';\b}\304'B\by\306\001"
+	.string	"?\202\210\200(w3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\006GAGAN"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.string	"\005MSAS"
+	.string	"\005WAAS"
+	.string	"\006EGNOS"
+	.string	"\005AUTO"
+	.string	"\b"
+	.ascii	"JX\314cG\205\267\346\231\007\330\332g\326\r*\277\001\024\001"
+	.text
+	.section	.gnu.lto_lookupTableCurrentSensor.158.3ffbe19a238260ad,"e",@progbits
+	.string	"(\265/\375 \276E\005"
+	.string	"T\tr"
+	.string	""
+	.string	""
+	.string	"@"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\305\317\022}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'-\206\b{\270\317Ry\276\002\005\001'6\b}\301';\206\bw\bu\303\001"
+	.string	"?\202\210\200 s3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\004ESC"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.string	"\bVIRTUAL"
+	.string	"\004ADC"
+	.string	"\005NONE"
+	.string	"\006"
+	.ascii	"Q\245\346i\307V[\373\314\232@\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableBatterySensor.159.3ffbe19a238260ad,"e",@progbits
+	.string	"(\265/\375 \230]\004"
+	.string	"\324\007U"
+	.string	""
+	.string	""
+	.string	"7"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\305\325\022}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'-\270\325R}\276'2\206\b{\by\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\004ESC"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.string	"\004ADC"
+	.string	"\005NONE"
+	.string	"\004"
+	.string	"U\245\366iu\200\332o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_lookupTableGimbalMode.160.3ffbe19a238260ad,"e",@progbits
+	.string	"(\265/\375 }\275\003"
+	.string	"\304\0069"
+	.string	""
+	.string	""
+	.string	"8"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\300\253\002}\273\0011\206\b{\370\327Ry\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\bMIXTILT"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.string	"\007NORMAL"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableBlackboxDevice.161.3ffbe19a238260ad,"e",@progbits
+	.string	"(\265/\375 \306\205\005"
+	.string	"\324\ts"
+	.string	""
+	.string	""
+	.string	"G"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\360\253\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'0\370\336R}\276\002\005\001'8\206\b{\by\301'B\206\bw\bu\303\001"
+	.string	"?\202\210\200 s3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\007SERIAL"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.string	"\007SDCARD"
+	.string	"\tSPIFLASH"
+	.string	"\005NONE"
+	.string	"\006"
+	.ascii	"OH\315\323\016\220\271\317\254\025\324~\003(\002"
+	.text
+	.section	.gnu.lto_lookupTableGyroLpf.162.3ffbe19a238260ad,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"m\b"
+	.string	"4\016\364"
+	.string	""
+	.string	""
+	.string	"^"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\250\370\300\271\002}\273\001"
+	.string	"\005\001\006\025\001\007\005\001'6\206\b{\270\307Sy\276\006\005\001';\206\bw\330\306\003u\301\005\005\001'A\230\306\003u\304\004\005\001'G\330\305\003u\307\003\005\001'M\230\305\003u\312\002\005\001'S\206\bs\330\304\003q\315'Z\230\304\003y\317\001"
+	.string	"?\202\210\200\300\001o3\320\0014\316\001\314\001\313\001\311\001\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\rEXPERIMENTAL"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.string	"\0045HZ"
+	.string	"\0051024298HZ"
+	.string	"\00618\004OFF"
+	.string	"\022"
+	.ascii	"*\301A 8\226\246l\374\230\305\300j\2209\310\032l\r\262\006[\203"
+	.ascii	"\254\301\326 k\220\271\317\254\033T~\003(\002"
+	.text
+	.section	.gnu.lto_lookupTableSuperExpoYaw.163.3ffbe19a238260ad,"e",@progbits
+	.string	"(\265/\375 \232\205\004"
+	.string	"$\bV"
+	.string	""
+	.string	""
+	.string	"8"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\340\273\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'0\206\b{\370\335Sy\276'4\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\007ALWAYS"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.string	"\003ON"
+	.string	"\004OFF"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTablePwmProtocol.164.3ffbe19a238260ad,"e",@progbits
+	.string	"(\265/\375 \3615\006"
+	.string	"\264\n\216"
+	.string	""
+	.string	""
+	.string	"W"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\370\273\n}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'1\206\b{\by\276\003\005\001'<\301\002\005\001'G\206\bwu\304'S\206\bsq\306\001"
+	.string	"?\202\210\200(o3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\bBRUSHED"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.string	"\nMULTISHOT"
+	.string	"\nONE42"
+	.string	"\013125"
+	.string	"\004OFF"
+	.string	"\n"
+	.string	".I\033\313\032$\320\003\241\001\022A&"
+	.ascii	"\327<\363hP\371\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableRcInterpolation.165.3ffbe19a238260ad,"e",@progbits
+	.string	"(\265/\375 \346%\006"
+	.string	"\304\n\220"
+	.string	""
+	.string	""
+	.string	"J"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\370\274\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'0\270\347S}\276\003\005\001'8\206\b{\by\301\002\005\001'>\b}\304'F\206\bw\bu\306\001"
+	.string	"?\202\210\200(s3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\007FILTER"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.string	"\007MANUAL"
+	.string	"\005AUTO"
+	.string	"\007PRESET"
+	.string	"\004OFF"
+	.string	"\b"
+	.ascii	"hH\315\323\216\253\266\346\231\007\310\334g\326\nj\277\001\024"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_lookupTableRcInterpolationChannels.166.3ffbe19a238260ad,"e",@progbits
+	.string	"(\265/\375 \230u\004"
+	.string	"\004\bV"
+	.string	""
+	.string	""
+	.string	"6"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\330\275\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'.\206\b{\270\355Sy\276'3\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\005RPYT"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.string	"\004RPY"
+	.string	"\003RP"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableLowpassType.167.3ffbe19a238260ad,"e",@progbits
+	.string	"(\265/\375 \232m\004"
+	.string	"\364\007U"
+	.string	""
+	.string	""
+	.string	"9"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\305\357\023}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'-\206\b{\270\357Sy\276'5\b}\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\004FIR"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.string	"\007BIQUAD"
+	.string	"\004PT1"
+	.string	"\004"
+	.string	"U-\366i5\201\312o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_lookupTableFailsafe.168.3ffbe19a238260ad,"e",@progbits
+	.string	"(\265/\375 }\275\003"
+	.string	"\304\0069"
+	.string	""
+	.string	""
+	.string	"8"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\330\276\002}\273\001.\206\b{\270\365Sy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\005DROP"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.string	"\nAUTO-LAND"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableBusType.169.3ffbe19a238260ad,"e",@progbits
+	.string	"(\265/\375 \230]\004"
+	.string	"\324\007U"
+	.string	""
+	.string	""
+	.string	"7"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\305\367\023}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'-\270\367S}\276'2\206\b{\by\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\004SPI"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.string	"\004I2C"
+	.string	"\005NONE"
+	.string	"\004"
+	.string	"U\245\366iu\200\332o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_lookupTables.170.3ffbe19a238260ad,"e",@progbits
+	.string	"(\265/\375`\264\002u\016"
+	.string	"d\026\201\003"
+	.string	""
+	.string	"'"
+	.string	"\005\001\006\035\001\003\005\001\212\001\206\200\200\374\342\203\347t\177}"
+	.ascii	"\005\001?\202\210\200\020{y\274\001w\273\001\005\001\006\025"
+	.ascii	"\001\026\330\337\004\177u\277\025\002\230\337\004sq\303\001w"
+	.string	"\302\024\336\004\177o\306\023\230\336\004\177m\311\022\005\330\335\004ki\315\001w\314\021\230\335\004kg\320\020\330\334\004\177e\323\017\030\230\334\004ca\327\001w\326\016\327\004k_\332\r\325\004k]\335\f\020\330\324\004[Y\341\001w\340\013\017\230\324\004WU\345\001w\344\n\b\330\317\004SQ\351\001w\350\t\307\004sO\354\306\004\177M\356\007\004\306\004KI\362\001w\361\006\305\004KG\365\005\330\377\003kE\370\377\003sC\373\003\t\376\003A\277\177\377\001w\376\002\330\375\003s\275\202\002\230\375\003s\273\204?\202\210\200\370\002\271\1773\205\0024\203\002\201\002\200\002\375\001\374\001\372\001\371\001\367\001\366\001\364\001\363\001\360\001\357\0015\355\001\353\001\352\001\347\001\346\001\343\001\342\001\337\001\336\001\334\001\333\001\331\001\330\001\325\001\324\001\322\001\321\001\317\001\316\001\313\001\312\001\310\001\307\001\305\001\304\001\301\001\300\001\276\001\275\001"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/settings.c"
+	.string	"J\2501\210\"xm\3773@C)n\003\020\020\304\030\231\017"
+	.string	"\364\225)/J\221\342!B\025z!M\312\344\3334\356x\377#\367+`\352{\207\253C\257\265\266"
+	.ascii	"\214\243\237\363\261\020\246\214_\035\373\337\270\004L\006}\264"
+	.ascii	"\263f\366=?\021\367DX\353g\373;\222\035\321\213\310\243d\247"
+	.ascii	"\361^B\372\030\255fQ\003"
+	.text
+	.section	.gnu.lto_valueTable.171.3ffbe19a238260ad,"e",@progbits
+	.string	"(\265/\375` Q\315\002\001\272t1UW0\214$]\035i\025\025\021\021\021\001\001\334\r\334]\274\221/\026\30072\202@"
+	.string	"303w7+"
+	.ascii	"\"\376\006\\\tv9i6~\337$\354H\003^\257\343\371:\256\347\355\272"
+	.ascii	"o^\367\361|\341\332t\255\332\364\267bN\234U\244]1\325\002\246"
+	.ascii	"-\331\266B\322\264\003M\005v\005T\005_\246\307\026\275\337{\023"
+	.ascii	"\263h\b\251D\370st\227[\222\301'\241\352\336\357=\216\210\355"
+	.ascii	"\310\033\222\274\351\223RN\253qUb\244\0271@QR\310\220\336\226"
+	.ascii	"#?9\265\006\t\262\241\247\315}M\370Q\350\356\203-\203OZ\255_"
+	.ascii	"j\017\214z\331\334w\b_\214\356g<r\260On\255UfI\031<\016^a:\304"
+	.ascii	"0|Rn}z\277w\260\376UC\201\361\206\226\260o\321=\007\327\375I"
+	.ascii	"\272\365\350\375\256v\034\006\350@\343h\243\327\300\371d\235"
+	.ascii	"\212w\205\200#\030TU]\006\206O\332\251r\357\367>\325c\b\231E"
+	.ascii	"\\\206\024\200\304\242ETwq\177\362N\025\002\005\301C/\321O\b"
+	.ascii	"M.tO\321Q\344W\237\304S\303\336\357\335D\204\244\245&\247>\""
+	.ascii	"\177\372\244\236\211\325\250Nu&\033\t|\350G=I\210\216\240;\210"
+	.ascii	"\376!"
+	.string	"\007{3(\325\351\375\336=\374\004!\t\241K$\310e\216\025\200\350D}C\347\320\2152x3\251\264\313\373\275\0271Q\b\241Eo\217K\216\342\315\246T\254\306\224.o\313^\005\245*wX\256\334of\345\225\"u\263B\201%(Q\246\240Rr\2557;\246juf\221\005\230\344\230\3205\201\337,\253k\356\002\021H\222\304\301\301o\266\225\312xk\263\320$\204H\021\324-\307z\263\256tiH[\f[\330\2104\266\037\250\217\2347\203K\215\326\324\204\376\353H\207Sr\307\031\017\271,fd$\300\304\306P\035\031\274\031]\217{\277\243a\311'T\013\315\201v\241\310\374\352\315\352:\032\027\272\325\345\037\230\225\270\262!4\271\320h\026\212\205\363fv\275\353\375\216\326@\2177\345\016\023\350\024*\303\252*G\276\031\036\r*&\241/\362\236\200\212z\201J\345Uo\246\327[\274\337Q\027h\213\363\216"
+	.ascii	"(L\240P\201\246\310\221\217\006\325\233\336\357\350\t\006\244"
+	.ascii	"@\225\232\204\350\b\032%\201:\301\217\326\211\336\357)*\002]"
+	.ascii	"\022B\231\344\350\034\240\002\351\341C\222\025\336\373\035EZ"
+	.ascii	"\201\032\031Q\016\307)\357wt\003\213=t\250K\036\365hYL"
+	.string	"\270@\261\341m\321\262\365\226\245E\262\312\235\225\2566*.\352\244D\311Y<\032\\\213\325\210\252A\211\242bB\327D\316lN\352|\203S\022G\027\226D\375\367\205\233\221\"u\\\357\367\223\b\f\037@\204\004\271\263\361\203\215q\206\246\226\206W\325\243\235\032+3K\3461\036MO\212\314\245\352\372\n\003\223B\341u#\343\206\026\327\326\224\b\034\r\252h\034m\324\310\243>\315\352\305jD\221\256\034X\305\240\252\222\221\205\026M\005`\006\224\013\251\250\255\274\026\002\240a\002\205\212\024y\214O\353\242Z\215\347\335\211\377\032\300\225\210\021$N\247\034\354\323\344\316\270\367\373\3314\341\350\001\204R\210\274\352\323\350f\254\3063\310\373\375\374\360\023\264\n\235I\255\204\032g\321\311\341\354p\032\363\253O\263\253\261\032O\260\367\373itn\330\002\001\033[\364\204&\027\332\354\262\227c}\332\335\215\325x\276x\277\333\344E"
+	.string	"\353J\026,\271\326\247\351\235'\356\262\242L\241b\007\245$\345\345\206\371E\367\304\211\324i\324\004\007\234\022\271%9\2576\205\027\027\243Ed\004\311\221\234W\263\252+\262\005D\310\220\266\234W;\302\005\231\341rSc[\313\022\362~7\323r\3548\343\261u\366~7\315\220^A\363k6\305\204\246\016\332$\033\313\265^\255\213k5\232`\357w4\fl\007\214M\327V\016\256\234W\2633\261\264\2166\262\260r\344\253\335\345^\253\321|\361~7k\364/\252\252\031\246\025\316\253\341\231N\357wSF\372/\030\233\024\214\0279\330\253\351a`5\232E\357w3\252\205\220\351\"\347\"\222\234\372\007a(\204f\n\332\\a\252\300\360k\031X\215/\345\375~\232'J\b\231&J`\345\370\201\355\037\21015\231N\346\b\370\327\244\376\210\210\365_\035&\222\371\301\fa\202\310\371\265)\266$\017x\370"
+	.string	"\bV\337\230Id\032\231F\223C\006\277f\245\201\325\3709\336\357\346\006\263\350e\376%s\323\333\343\202\363k\307\r\254\306\227\361~\377\274-x\377\240\254J\360\255\314\177%\013\226\234_\313Z\361~\377\273\002\324\374\233D\326\t?\n\375S\244dx$P\034X\215\017\342\375>\003\345\311\007@\260\206\300,NN\370s\3647a\222\363H\246:\260\032\237\350\375.\263\304\003J>"
+	.string	"\002\230\017A\372\335\334A$\370n\363\037yC\002?\222\255x5\326F\212\b\375\027\001hP\036l@\204\004\371\375\033\\\316\373\375\177\370\320P\236%\203o6\377\231\360{\320\237\206\366\37379\257\024\362j\254\360~\177\036_B\277\203\004\350\320\367\370\233\364\373#\203\3375\177\230\360\305\350\037\253G\300"
+	.string	"\035w?\301\360\266P\351\r\r\031\337\303\367\236\325h\276\337\313\037@\372\375\301~\202\326\367\022\372/\022\3442CGE\027\276\227\352?H\277\237Z\316\177\323\357\245\017\252,3\200\0070\246\332\030\267\204:\233,\357\367\366\205Y\324\256\200r\321\266\310 \301\316\206\311\373\275eq"
+	.ascii	"\006\230@\321\236\200%\334\331\004y\277\267%\332'\241\377\202"
+	.ascii	"i\200\210\266)\007\233`#\366~o\231\316$\007|\020\276\030\335"
+	.ascii	"\206hA\344I\023\2166R\357\3676\351\0014\214Gm\207\374i\202\315"
+	.ascii	"\207\367{\313\001\002\214v\250-j\211\362\252\t]]\272D`\261\314"
+	.ascii	"\354\026\275\274\274j\002\\M\025-Y\204X\274.e\346l\002\tlT\254"
+	.ascii	"T\201+8\326\300\275\337Y;vJ\227\tqO\352X(\031*\310\252YsB\327"
+	.ascii	"!\200\\2'\227?U\260U\243\245$\002\307\231E\222\344-\277\252\240"
+	.ascii	"\253\306\305\221\233!nDrd\005u#\332&\360n>X \354\217\034Y\201"
+	.ascii	"]\215\361\375\316\262U\320#\215E\313\253*\270\243\321\362~g\317"
+	.ascii	", Rf\306&a\013\244h\232\274\337Y2\nq`ba\030,\200\243\001\362"
+	.ascii	"~g\277X/\231\n[9\270p,\220\033{\277\263Z&\030\325\314\332\310"
+	.ascii	"b\261\362+\013\350hh\324\250@\234\025\215\0318\026\334\255\250"
+	.ascii	"\222!\364_O\302\002\350\324\314\276\210\001\003\307\002<\232"
+	.ascii	"\020RQBf\221jt\201\025P,\013\034\nR3{\357wV\305\005G\366\204"
+	.ascii	"\t\f\024\246\236\274\337\331'\f\330D\214`\233r0\nV3C\336\357"
+	.ascii	",\023\373!\004\210\f(\034g\304\336\357l\322\005\326(\354y4{\324"
+	.ascii	"!O\242\220\005b5\316H\275\337Y\016\254\221i\365\311y\355\"\374"
+	.ascii	"9\232%b\2070P\330\232Y\332\343b#\306\206\267e\325\002S\220\223"
+	.ascii	"\331\313\242\243\312\335j%\007\243@'\003\205\312X\334\274\326"
+	.ascii	"I\211\222\201B\235L\221\367\373\neu\"\264>A3\351\310\220\363"
+	.ascii	"*\307d.\257\242\240'\223\366~_\227x H\311\007@\260\206\240\f"
+	.ascii	"\211\260\347\321k\222\267\034Y\301J\006\354\375\276\036Y\215"
+	.ascii	"\b\375\327\247\200bk#2$GQ"
+	.string	"\3418%\304,\311\366c\365\221\243\250\220%\303\264\266\343\f\255G\256Ta\213i5\306`y\277\257<\3245\2413\251\344A\226,\313P\241k\356\375\276\216\235}\205\201\335\025\340\332\274\272\322\036Z\\\353\326]A.\306\354\375\276\342Xo\250h\307\325\306Z#\307\252@\0273\343\375\276^\245}\311\260\252\312P\241.\005\225\032\234\224\360\347\350\025\306\372\"C\005\273\230\250\265sl^W@\255,0T\270\203\311\362~_U0\261\221\230\327\022\302\027\243\327\023\253\211\234\013`\240\274\337\327\247\"\037LM\"\362\252\013\254\336\226~\254H\363\232\004b\375\220#/8\262y0\207\200\260\255F\306\225C^uA\027\314\330\373}\335\020$oV\367\204f\nz\035\352\222#/\200\203\271\361~W\271\250z\033\206\376\201\020\257Y\305\202\227%\277\302"
+	.string	"\016\006\352J\233]\025*\0310\250\203Q\2322$\356I\035\024\030\003;.N\210\3101\231\313\301\340\356\205\312\22267\365\310\254\276\301%\311"
+	.string	"\003\274\027#H"
+	.string	"P\204m\210\033\021\f\026\246^\314\332\332\214\370"
+	.ascii	"\242\376\300\261`\365\242\365~W\331T5!uM\002U\216 \361\020\366"
+	.ascii	"<Z\355\241\236\301\026\216//\336\357\352\016\325l\t\311\227\016"
+	.ascii	"\341G\241U\262\261\034\314B\326\213\210\367\273*V\276\365\243"
+	.ascii	"Y\355\022\276\030\255~y\345X\026\266|x\357w\025\251r\t\2519\320"
+	.ascii	"$lY8n\344Q\026\350\246`\3218^\345U\026\352\224\314\330\212\213"
+	.ascii	"\233\222A\225GY\260s\213Q*q!\025\225WY\270Ck\261\004\231b\205"
+	.ascii	"\212<\312\002\236o\354\375\256\242PI\224P\237\362&\013z\\NLs"
+	.ascii	"GuI\204\312\224s\001\3127C\211\211\211\207\017Iy\325\005)\037"
+	.ascii	"\324\373]Ej\242\032\031U\016\271\326\205)\237\323\373]\335\260"
+	.ascii	"E\307E\230\356\321\352P\227\274\351\202\225/\351\375\276\352"
+	.ascii	"9A\232S,\3024\013\235j\301\303\271p\314{\277\267\351\225\245"
+	.ascii	"'uvU\250\300\027\272\\'S\322(B\251\024\b\354)\201\222\316\005"
+	.ascii	"\315(s\332\304\t]\216\342\002\234\373\343\375\2362A\231\340\312"
+	.ascii	":8%q8\027\352t$)\243\0249b\344\276`\347b\275\337S\267RJ\2206"
+	.ascii	"!8\027\356\334( S\330\324\330\326r.\340=\245\331\305\3558\343"
+	.ascii	"\221sA\317Mz\277\247fir\210\312ycN\305\306R\035y\325\223A\265"
+	.ascii	"{\357\3674,\255\222#\355J\2219\330\223Y\265P\336\357)W\272e%"
+	.ascii	"\211u#\315\302\360d\307v\210\215;\223hNg\\\2454r\024O\226\325"
+	.ascii	"\206Y]\211A\225N\345\310'\243km\300xqb\201r\321\342~\262\272"
+	.ascii	"\250\367{\312\"]\201fa2\201\"=\221\341\311\354Z\021%P\2509mr"
+	.ascii	"\032q?\331]\273\341\375\236\212(\265\200P\nq\177\331\324\335"
+	.ascii	"\373=\375Pn\351\220\"\245G\031|\231\025\373\366~O\215yT)Q\272"
+	.ascii	"!-\272\277\354\270\366~O\207\364\266\b{\036\335\271\350\335_"
+	.ascii	"\226\305\206\275\337M-g\022\215\271\337a\271r\177\331\026[\303"
+	.ascii	"\312\336ib\356R\354\372\224\337\227\325\261NQ\312.qtO\234\344"
+	.ascii	"`\001\265\r\027o\032\306\355\272\030\024\017\213\367\f\f@\371"
+	.ascii	"\223p\007\2113\216\313\367\204\337\316\004\342\034\323\023~\366"
+	.ascii	"=A\302\203\262.\312\366\004\274\256\355\tnI\254\347\333\226}"
+	.ascii	"\2103\f\224\2070\345\223}\331\253\375\332\267\375\220O\362pO"
+	.ascii	"\367N\336\356\251<\336k\371.\346\220\331\301<2\225\314%\223\204"
+	.ascii	"\371d\2620\241\314\030\346\224I\303\2742o\2308L\244\331e\226"
+	.ascii	"\231I\263\207\211f\3720\177\230DL7\363\315Lb\316\231LL(f\235"
+	.ascii	"Y\305\264b\342\231Z\316\241\223\350<:\221\316\245\223\351|:K"
+	.ascii	"\234+N\026\347\213\023\306iu\3168\261\316\2543\307\211<\305N"
+	.ascii	"\035\347\216\223\307\271v\262\235m\347\220\363\310\211\344\\"
+	.ascii	"r\312\235N\316'\347\224\323\356\274rb9\363N=\224\b-B;\240G(\b"
+	.ascii	"4\004\372\204\226@W\240,P\030h\ft\006J\003\275\201\342@\275\320"
+	.ascii	"/\224\f-C{\240h(\0204\bj\004=\202*A\227\240N\320'\250\035J\005"
+	.ascii	"\315\202\342\241]\372P7\366\016=DW\352$\372SW\321Wt\251\376\242"
+	.ascii	"[\365\031\035\253gud\357\352c\235\254\367\350h\375G\007\322\211"
+	.ascii	"t\267\236\244\303\365\271\316\244C\351u\235J\257\322\263t\274"
+	.ascii	"\276\327\273\244F)\207\324C\232\224.\245L)\211\364)M\221\252"
+	.ascii	"H\243R\251TFZ\225\036\323\032)\216T+\365J\277R\262\264,\355\221"
+	.ascii	"\242\245>\322\037\351\220\224H\212$}K\227\244r\351\223\024Jj"
+	.ascii	"%\275K\267\244y*\221Z\244vP\217T\020j\b\265I\035\241\232PO\250"
+	.ascii	",T(\365\205\nC\255R\255\324\032\252\rUK\335R\301\3240\265LM\252"
+	.ascii	"hj\232\032D\025\242\026Q\215\250q\252\022\265\211J\247FQ\245"
+	.ascii	"\250V\324;U\213\272e%Z\213\326\016\353\321\032bUZG\254N+\212"
+	.ascii	"5\305\332bu\261\306X\247\326\031+\215\025k\315Zs\254\310Ul\325"
+	.ascii	"\261\232\255;\326\264Um\005\262\006Y\335\326\"+\334\032\2676"
+	.ascii	"Y\351\326)\253\335ze\305\262\346\255zl\021\273\201Eb=\260J\354"
+	.ascii	"\022\353\304\222`Q\260)\330\026\254\013v\212\245b\257\330#{\203"
+	.ascii	"\305\301\"\331.V\007;\306\356`y\260j\354\032\033\204\025\302"
+	.ascii	"\026a\215\260pl\034\313\204m\302Fa\245\260w\354\025\226\013\273"
+	.ascii	"\327nh\215Z\244\326C\253\324.\265N-\2116E\253\242\215j\245Z\252"
+	.ascii	"VF{lk\264Z\355V\353\325~\265c-Y\313\243=k\327Z\266VH\333\326"
+	.ascii	"\"i\337\332%\255\\\353\244}\322Ni\355\332+-\226V\257\345\342"
+	.ascii	"np\215\\\017n\222\273\3442\271On\tw\205\313\302\225r_\2702\334"
+	.ascii	"*\367\350\326p\265\334-\367\313\005s\223\256\231\213\346\246"
+	.ascii	"\271?\\ \256\233[\304M\342\302\271s.\023\027\212\005\256\235"
+	.ascii	"K\305\305\342fq\365\\.\276\"\337\006\337\221\017\311\027\302"
+	.ascii	"\247\344s\252\300wb\0029R\005\340\330\236L\370J\344PP\367\300"
+	.ascii	"\351\375\356#A%b\204\257)o\242\300\356A\322\373\335\307\344["
+	.ascii	"b\217\276$\020\0372Pp\267\345\375\356\363`\026\235\315>\016\302"
+	.string	"\237\243}\035|\306\034\214\002\274\t\232\274\337}Fh\027\037\221o(\003\005z\023\264\275\337\335\275\216\244%o\013\316\013\225\304K\255\\\271\303\360J\331\250\242F\231\"\005\347\235\232\300\305\373\335\255s\243{\342\004\303k5A\210\367\273\333\344lv\225\310-\311\360\312qy\277\273q\355\2217$\271\026\204c\025#\\mD\206\344H\bYrB\202\270\2765a\317\243]\037.[\016\204-\007D\336\357\256\332\013\217\036\356\031\016\204.\007;v\270a\263;V\346\222\335\020\340\034p\275\337]\035\256X\220\004\304 \275\272r-\bv4rp\2312LY8n\344H\bw\016\240\260l\274\314\314\270\242\221\001\002\236\003\245\367\273kE\023\203j*\327\202\240\347\300\bF\rR\213(\027\271V\004(-P\250\211\331uU\270)r\255\bR\r\244\274\337\335\023\256\211\241\241\033\266\021\302\237\243]\022\256S\216\214\320"
+	.ascii	"\356\375\3566\271\"\0324H\202P\n\221!B\327\332\007d\007\027\311"
+	.ascii	"=\312\020\001\256\301\327\373\3355\272"
+	.string	"\034\204\376\313kv\207\334\"\227\b\216 \327\300\252\313\236\320\177\225Y\036\034\265\344m\271#\324\251\300\313\342\003"
+	.string	"U\225;+w\004\273\006!\250\244R\002\300T\327Ji\243\340D\270\273\331\203\302\204\256I^\025\001\217\312\334"
+	.string	"\274\346\026NI\\^\025AO.\311\022\001X,E\216\030\311YH\260\2729\362~o\335\332!B-\221\343\213T\001\324#?\202"
+	.ascii	"\311\265$\034}\3700\300\t\205\246\226\226kI\310J\276\337\333"
+	.ascii	"\036I\341\367\240\333\035f9R\302\326\326\373\275-\373/\004\204"
+	.ascii	"\265:Z\261\034\t]7V\357\367\026,\0019\204\037\205n\273\220y\225"
+	.ascii	"\004\270\033\026\357\367\226K\001Y8\332\033\271\226\004\271\233"
+	.ascii	"\021\357\367\026\253\2651\263\200\2672C\370st{\325\322\310\221"
+	.ascii	"\022\350n\214\357\367\326\252\255\242\t"
+	.string	"em\007\005\335r\247\310\376\210A7\215L\004\"\240\201G\0025\304\332\256i\231\362\367\213\177\277\370\245\324\300\003\357\024]z\266q8\030\323m0\246_Jb=\3431q\036\376d \034\214i\231\022(H\003\\\333\262\206`L\267w\217\316\313\\\274e\312\373\226m 0\206\177\022\230gJ\331\216\177\200v\314\003\327\266\206\371\206ub\034\246\334)\016a\371\236kbL9\224}v~pm\307:\276\362g\303\300\231V\333R\370\223y\332\362\305-\361\371\276m_\331\226<\277\227\242-\343\304\031\376\3310\345-\313vP\006\302@3\r\373\024wd\312{(\023\201zb\030(\246gJ\232\022\227o\331\006\022g\035\030\217o\230\356\261q\241\\\274\005 \003k\332\236c\007\304\371'\337=0PL\303@\266\2578S\312\277\331G\006\312\224\370-\3430\261vP\376~1\f\264\201j\035\341/\036\352\330\274"
+	.string	"\305\364K\t$\3064]\373J\372\247\b\003\345\0371\350&\366\300\362\3353S\016\353_\215\327v\261&\306\246\224{\206\261\217m\327?\330\346\301cbvv\352\233\237z\b\013\240\224\355\036\240\274\023\337\3039\336\251\231)i\354\270\326\201\211\301y\030\313\fc\035z\016\372\312 |\376\305\305\370\007\343\261\316\013PL\234\351\006A\342L\264\343\037"
+	.ascii	"\224\367|\313\266\214\337A<28Q\266\355\236\037Li\313\270L\303"
+	.ascii	"A\266\214\343\261\016L)\007c|X\373\300\303\241\374\203\361\237"
+	.ascii	"\214\313\300\007>7,\337=2%N\224\177\266\\\204q[\036\306\277\032"
+	.ascii	"7\216\345a\374\273}%.\337;;5\354\203\307:\363m\327xM\303?q\220"
+	.ascii	"M\371S\017eJ\236\340\3143S\016c\033\357\221\2110p\002\356\004"
+	.ascii	"nJ\371\036\366\024a[\306\211\362\257\206\376)\306\224\032x\340"
+	.ascii	"\231\262\366\261\345\033\236m\234\246\304\355\030\277\341 q\006"
+	.ascii	"\332\361\217]\357\300C\231H\214y~\017J\031\217\355\365g\373J"
+	.ascii	"\340L\3036\017\276\226u\021H\206m\036\234\035\016k\333\365\335"
+	.ascii	"\360O\034\324\226q\021gKa,\333:p\\\304cJ[\306\177\261]\327:\262"
+	.ascii	"=Sj\340\201e<\006\026{\340a<\333\362\335 \b\350\367\213c4\f\343"
+	.ascii	"\037P\246\355\230\330\003\377~qLY\234\2050\375\003\302=\364\354"
+	.ascii	"\016\2071}\373h\206\303Y\b\323v|\317\300\232\222\266c\030\277"
+	.ascii	"\355y\007&\326\3600\376\301\265\035\024lP\3322p\366\251\355\227"
+	.ascii	";\326\271\347\035b\375\223)\201=\261\016\\\343=\361\3353\003"
+	.ascii	"c\033.\376\300w1\bS\006\21130\226y\340\373\246$\316@1\r\003e"
+	.ascii	"\271\370#\017o\330'&\302\340\303\030\016\022\347\037\240\f4\357"
+	.ascii	"\004\200\246\224\203\304\230\347\007\343w\274\003\003\2075\017"
+	.ascii	"\214\017\343\033\266\004\022c\035`,\003\341\2378\350\245\004"
+	.ascii	"\312\267-\373\3106<\254m\234X\377\340\2378\350\246\244k\242\f"
+	.ascii	"\204\357[\376\325v\021\006\316E\232R.\006\341p\rL\251\201'\246"
+	.ascii	"\334\331\251\361\236\037\314\363\303kb\rp.\302x\254\343\003S"
+	.ascii	"\312C\034\257m\036\034&\3164\214\3070p.\3328(\211s\034\204\203"
+	.ascii	"\360\331'\266\203\360\214\023c\232\262\236\361\330\206\201\342"
+	.ascii	"\241l\337\2248Op\226\177\200\r`\312\337/n\201\301\231\0228\254"
+	.ascii	"yn\331\346\301a\2348\327E\\\276\037\2242=\343n\031\024\017e\240"
+	.ascii	"\257\224\207Ab|S\312xl\3036e\220-\373\324?\331\206y\356\330\376"
+	.ascii	"\305\224\305\036 q\376\201i[\306\347\227\362\276\343\342O=\204"
+	.ascii	"\177\342 _\371B\367\334\300\2718S\234\327"
+	.string	"\"\f\\\213\263Z\016\207\265\r\003\325\342\234\226?q\020\f,\316i\211\017c\030\230\026\347\265\204\201kqN\313\241\354\003\003\3232\b\237}f|\276\211\362MS\3423=\017\341\241\354#\017}%\376\223wvlp[.\002\3110>\234q\230Xk\230\355\232\347AY\204\357\272x\327\305\273.\026g l\337u\321-\2133\020\366\211\211\360]\f\266%\317\017\237\177n\230\036\342n\t\224qz\210\277\224@\362\260\330\003\334\031\306<0=\304cJ<\246)\203\304z\b\343\303\236xG\006\326\224xL\333\365\016|\027\2033%>\023{\334\222X\317\367\374\223\355\"|\307;>p\220\360\266wnJ\2348\303\264\035\017c\030\307k\236\230\222\036\3420q\206\201s\321-\357\337\214\3373\036\3437,\274c\\\246\224\2015\r\007{td\240[\312\277\330\016\302\264\035\303\304\032\266\177\2123\303\372\207\337=\""
+	.string	"\306\360O\206\377\250\323\321\227)\026\211\305\231\021\021\021I\222$\255\001\303\030T$D\206\201\242\266\322\003\023@F\020\251a\230d\027\364\230\004IR\340\001\352\210g\371r\212\305\203\350\203nd\207\331:z\261-\236\0029~-\360\022\013\302\242\255\370\234\003\"ZG_\020\216v\345\204\260Z\263\323\331%\310>s\031x\201A4wX1\332\bP\234\364\rr{b\312\236E(-\353JE\013(2L"
+	.string	"\b\243\355M\343V\370\234\322\037\211\347\277\232\250\003\201\317\336\366\362\260P\354\221xN0Z^\305q`7'\223\001M\274S\306\357\355*\030\376\266\247|\372\216\375\237(\322'\264\207\330\235\t\335\201\274\251\026\0323mc\333\033\027\264\371\232D\325cL\203\246\317O\265e\332M\036\375\021\300BG``\013\"Y\373V\200"
+	.ascii	"\227\031\365\356\311\032\355YM\332\030\331\342\325\033\240ZZ"
+	.ascii	"\241\217\003\027\371\320W\316*hY\333\275\034\032\2463\t\274\313"
+	.ascii	"\362Mx\300\364\245&\217\267\322\316\277d\006e\236\340B\254H\316"
+	.ascii	"%\367\221+s\374\245\314\037\3670V\026\r]J1V\020$\201\252\257"
+	.ascii	"\310\r]\016-\007\221\024\001\244\247\367AR\331\340\303\035H\244"
+	.ascii	"~Q\350\007\222\205Dw\313?/PL\301\31436\3661\355\022\307\377\365"
+	.ascii	"\340\245p\372\034KN\236o\210\367\202*6\274\333=0\224'\345\004"
+	.ascii	"\215t\334h\266\275\232F\246S\361\333\201a\005j9a\213\327\247"
+	.ascii	"`to\370%\251\331\252c`\213\037\370on\330\277\356C\314G\260\326"
+	.ascii	"(\325|c\243\027\f\313}9\310\232<\201\253\366o\335\264N\\\300"
+	.ascii	"a\311\235\f9\233w\270W\274V\234b\367O\013\251\236i\340\200\217"
+	.ascii	"H\271.\r\332\200\243\241\232\325\210\244X\205\025\201lw\266\311"
+	.ascii	"\232j\001oF\036\354\233\242s\235\t\330b\232\262\330$\254\242"
+	.ascii	"\337dnM\230W\230\020S\322\203\367\254\340\027\027\367\037\374"
+	.ascii	"\376\377\262\252l\344\tDy1"
+	.string	"\257\305/\033\325\203\003\3501N!#n\254\264\367s\3557l\317h\026\264'\233\3656\204=\212\241\351\202\356j\320\314\257J\200\357\025\231\277a\032x;\326-dX\260\311\313H\177y_\352\257 \245)xj\313\317\267p\202\334\013\261\200\034\277\356\304\312%\206\350n\345\312_\300\264|\206#\325\033\342\270g\037d\007\335\370\030\312\310J\261\244\367$\203*\274\264\016\346\212\2317\215\3331\313\231z5YNr\211 @,A\251n\232\3031"
+	.ascii	"\232\232\205\230Or\264\032\340\252\256\211O\266\330\267\273\324"
+	.ascii	"\357\357`\357\217\264\255U\335\322\307`\244[\331\213\252\372"
+	.ascii	"\001\2212H\022\264\230\313\355(\212\274[t\216\273\304v\303x\002"
+	.ascii	"Q\224h,\3051l>\315\035,\022$p\3560\024\337\363\261\360\350+\022"
+	.ascii	"C\026\236\231\017 T\327\312$\257\177\321"
+	.string	"k\\0\227\"\024G\230d\022\367/\207*O\n\3700\353\255X\r\rr\353L\2727\217\267.\333w\373\204u7H\262>\202\206\323lj\273U\0344I 3\205\333DH\263\241X8\033\272\257\371\263-\2146\312\320$\220\236g\314\323OP\330xr\275\344\220\030\tE2\340\343H=[\244\253\374\227\316\370zZ\323\345u\237>\2024\276tT1\220\020F~\251\235/aN\337\335\326\351B\235>V\n\331HaW\330\227p\224E\364\310\250\233\261\203\332\034\372uts\375\243,\232\033\265\321\224\003\302\320\375W\302c\005\322\b\256:\006D\001\263x5\271\316\246\324\246cY\334\317\315\322Y\276\215\220q\227\353\314m\203\233;\ne\324\230\351\274e\256Br\321\360\303\263\350\177\233\2236\330t\327\362\321_\333\034% +\257~\351g[!\272\242|m%\257\361\243\211\032\n\244\262%\003\227\260\f\315D"
+	.ascii	"\212\016\245\3728\016\257\245\024\234\234*\344\2429\022i\370"
+	.ascii	"P\312@\"9\367\350+.\346\027\004(%#\362\351\242<Bwe\004j\363\210"
+	.ascii	"~\352Z\260\365Bp\360|\235\323\234\220o\252\242\013\331\214\b"
+	.ascii	"&>\034DCP\243:v\216\204z\244\370\361\330\201\r\032\261\356\243"
+	.ascii	"s\375.m\252\257\361^\321\f\033\317\244\317\004\372 \232\214\222"
+	.ascii	"\032y\016f\331\277\256l\376\354\0318\b\020\355\217s\373\342e"
+	.ascii	"\363\r?\270\271Z)\307B\032ht\005\207[P\2764^\220\2400E\013\341"
+	.ascii	"\205L9\304\276\303YMi\307\337\267\031<M\264|\351\016\370E\266"
+	.ascii	"\342\025\313\374\337\365\325\274q\334Ac]\017h\243\351\342\271"
+	.ascii	"VH\017\215<\020\031\332F)eXk<\246 9~C\374\260\nX\344\253\001"
+	.ascii	"7\276\332g\344\325\001\270%\301\266\334n\031vA\252\205\246\320"
+	.ascii	"\031\355\351Gx!\277\003u!4\325y\365\306"
+	.string	"\234\036k\221\243\031\r\020\263/}\236H6\237+Q\"\261\007|\013(Q\033:*\245/\357,\024\025DQ\220\376(\257/\2215\252KB\372\027\247\372H\320\247\320\357\024.\344\352\321\240E\276@\303\217\325\340H\032\001\356\264\312;\f{8\005\013\255C\317\022P\001\311\360\353\214\277\354\224\333\037\373&$\335\307\347(\3754#\362?A\267\372\3151_n\204&\346\326r\025\307\304\205\304.\317\203i\274pM\256NP\325\347 \217\3379\377o\\2\225\237\265R\304\3247\236\363Bdy\233\326\232\266\372\246\277\234\025\371b\277;$\bR:C\302\036H\002/\237$\236\250d\363\035\276\327_\002\300`S0\374\257S\013glR\321tcG;\375:=e\235\n\310\033\215\261\354\313G\323+\342\232Ae\223P\f\321\177[\214\226\230\232\310TXHG\r\367\275@\224\343\316\020\3461\342\033\210\242\366AJ"
+	.ascii	"\213d=\b\373r\332\274XR-\214\032\243\270"
+	.string	"\322\225\023\371\357[\337N\215\374\363!c/\3567\223\025\324\276\256\351yTl\3405y\260\253E\232\350\375\024\320\345\221\330\367\355\361r8\373GkB\261\207\356\2613,\311\221\271\340!\273\253\026-]A$\233\217\273\001\013Z\356\332V|b\322\277\340S>\373\004\360m1\230\006\301\363\r[5|\324\3132\301\275{\361w\270W\032\365\214T\003\177!\216\034\300\025Q|f2\321\035\202\2544?)\3034\374rF@.\031G-H\354r\243o\2747h\212gX\325\304/\312n\247\023\220\031E\232\001\220R&\257\220\f'\216\004\246\247\244\223\373\217U\024\236u\341\033H3\030k\361\030\356s\256\216\275j\351\362\327R\244Ub\017\021\320Q\266m\265\255\225`<\313\226a\r\3145\274\374L\216\256\331\3654,\352\217\227E\345hp\274@\253\r&U\370\025\367\nXQ\266W?p\360\210\363j\207\021J"
+	.string	"}2\312\215n\256j)\307Bk\002\003\207\005Z\3318_\225?\263\250p\303+\303\244\302\rD\356\\\336,\243\351\205\235\354\002n/p'\260\373\265T_\033\021}\332s\033\200\320\3413I\022W\230p\206\207/\201\313\206\301\002\3566]D$\236\365\262x\354\374\0165]F\313\247Qi\310\272\203\356\213\255\004e*\225*6\007$\320\266\252\233\316c\027\341\261C\n;\235\324zj\3174\001(\251G\276\324\310\317y\026\f\267\207\343\251+\002\317\0259\322<r\021\030\333c\305|\217l\306\241\352\2415\222Oo\255s\227\331\225\344c\266\033)\264\230ii\367NL\255\017*\237\263+X\034\321\237C7&\262\003\274\322\355\232\232\314\220y\315\227G&\371\336/\301\034\302\233\017\200\267[\247\024\230)!\375\301\003a3\360\274#\360D\024\323\021"
+	.string	"\243\270\205\312\210\241\006\350\255Z\235\352\230\242J&\375U\217\343\354\325\362j^\362\016\212\031\257\3320/4\214\232\007\251\334D\350\031d\005q{\326\245\rEA=\332\242\341.\274F\267\233r"
+	.ascii	">\t|"
+	.string	"\020\371P\277\227\371\034,n\345\241gv`x\231\200\325 \251\r\244\301\240\302\244\2240or\006\f\220\253V\241\333\2059^\027\370~,<\247\013\271\270\035D0\025\202\277\337\251~)\234\310\017\370\203\302~\367'\210\230\333\373\260}\260\220\003I\220\323V\203QE\021\033\203t\361i\244\362W\007*q\030C.\005\246pl\344\033IsF\263\365\346\217`\031\363+\342\334$\340k\271\342[D\303\037K\363\304W\031\327\260\033\221\275]\333\2038x\013\231\372\206\001\035\314\240F\035\304\305\240qi\240Z\310\225\206\256\210\342\205L\005\034`\270\200p\263\374\232\n\272\267\366\017O#\b\006(\341\264\262hh\r\225|\030$\2530\334\361\003\206\314C\226\027\215\001\037\212\301\031\r\026\227*\347\037\316\321\226\206\301/S\331-\333r\341}\016P{\213FfC\255\347d\021\001\365.\243\031=\006W\301\255\216\371\332\350"
+	.ascii	"J\224\324\001\223\034\207\243Z\341\350\336\0224\264$n\003QO$"
+	.ascii	"\247\370e\230@\rJ~\274\371\235\301m\260v\232<\3175\353\363e^"
+	.ascii	"\n\256\027R\033:\255;M\375MfO\226\361\256L\375\355\206Z\200\251"
+	.ascii	"e\234`0\342a8\350\325C9\343\247\030\233\f\036F\341+\b^\313\244"
+	.ascii	"\274\323U?\372\352\0312\235@\344s\031&6\215\353\357\033%\376"
+	.ascii	"\305.T\246\030\307\224\200]c\030y\033\021\277\253A{f\316\217"
+	.ascii	"\312\002\260}D&\373\035e\266i\001\344\225\255\262\253i\372L\343"
+	.ascii	"\263\312A\267\226\313\005\366*\364\214\334\231"
+	.ascii	"\373\361\247\270\330\245j\366\352\200\255\343\331@\274\221\r"
+	.ascii	"m_I\032\312\306^t\230\244\336M0V\223v\3632+\210\025\004h\302"
+	.ascii	"\031\356\202\213\007\t\236O\2165\345^\362ev$\365\246\271\220"
+	.ascii	"\345|4\234M\246K\\\370\035\345~\253:NW\037\247\337R\365i\351"
+	.ascii	"?\220\277\3317\240O\316\272\267\345\231,\023\3662JGM\3500\315"
+	.ascii	"\325\203\345\200hG\0165V\277\212q\021S\225\001\245\3464\306\267"
+	.ascii	"\327i(b\204\022<0\270\030\375\370\225}\316N.('C\336\255b'1jx"
+	.ascii	"<\375yh\272\211D\220\260\267y\214\214xz\277\221\221\227\300\030"
+	.ascii	"\352\020\374T\222a/\0066T\241ZM\337\027\2253\304\3225\257j\337"
+	.ascii	"\323]\206}\026\222\223J\210r\365#\202\253\240A\312,Z\303\026"
+	.ascii	"56\360\251W-\357\345\006\333\037\021\265v\215\236\260\007C\r"
+	.ascii	"\352\333S\203\240$\273\352\245\035\207c\204\034\330\301W\303"
+	.ascii	"\356\200w4jX\312M\275*\n\353)\013$\267\204H\001\330p_\324.\216"
+	.ascii	"\016q=B,\246\007Z\001"
+	.text
+	.section	.gnu.lto_getValueOffset.174.3ffbe19a238260ad,"e",@progbits
+	.string	"(\265/\375`\202\002E\022"
+	.string	"\206\"uF\360\320&\035\353|F\277\344\362\212\341\370\274\0163\363H&:\376\016^\265\017\223\3237\234u\355\250m3h\203\224\231\341\321\274\006\020@\353@\330\f\351\r|-\034\005\236\365\201y\270\253\207}\035@\332\336[\312\224\002a"
+	.string	"Y"
+	.string	"d"
+	.ascii	"\037\341\362\256\345\001vo^\f\355v#Fi\207\3564\333~\210\213p"
+	.ascii	"\261\013\025\363\302\241v6\300J\350\330\3556\221\017\210\207"
+	.ascii	"y\001\361P5\334\365\b\237\246\313\347\036\025\370\004\315\200"
+	.ascii	"\332\314\337{\236 \003PRL6s\215\201yE\221\335\375\220\311\274"
+	.ascii	",\225\354\2563&\253p\227n\273e{\304\316\242\t\273\360r\204\223"
+	.ascii	"hi\2730\b|\237\006,\032\207C\277%\036^\337\363\307\242\246h\007"
+	.ascii	"\317K&\331\035\227\212c\377\255\336\330\232>9\035\342\264\351"
+	.ascii	"\335\377\341\264\366\322\245\227\216\232\206/\375^:5}\221S\216"
+	.ascii	"\220\354@5v)$\361X#H\224c\333\305\006\261\235i\237'\371\030\324"
+	.ascii	"\367\230\275\224k\361\324\244&\206\212\263p@S~\250\215\342 \037"
+	.ascii	"K}\312\371"
+	.string	"AG\335\260\361\024\307)'Z\205\250I\215\213\2378\013\206\021\227=\256+\374!\r\204\220\237\342}\320\331\031\n\037\310G\332.w\033\303\331\356t\320\371\217\355\243\337\306\366Q\306\326\300\341\351\300,&\221lz\201x=\251\003*\226\007'\022\240S$-\006*(++\252\326\226Z\260\251\240\234\244l)Vk#!\340\025\004\025k[Y\255X\033\210mw\373\267z\343\023\214FF\372\256\210\001F\303\003M\372\231\037\013H\032\242\232N\260\255i\352\3137q\227\274X\322\247&\325\03426\246\273b\324\222\226h\310xxe\222\241F=\f\t@\332)U3 \260\"\241\253z\377\21444\214G\002T{\030\222$\256\276C\207\326~\264\265\275HZ\235\321\345\355\024\332\207\020/\226\364\341\365\301s\336\305\270\017\263G[\222\270\224\r\363\313@\263w\177\345\305\005\234\305EE\"\344\037\022\356C.\005\311\217"
+	.ascii	"V\200\023H\300\366DC\212\210\205\026\337]Ah\260K\217\0229\303"
+	.ascii	"\0052\304\272y>\225Y\227\0312"
+	.text
+	.section	.gnu.lto_getValuePointer.175.3ffbe19a238260ad,"e",@progbits
+	.string	"(\265/\375`O\001\255\016"
+	.string	"\246]gE"
+	.string	"\257(\035;\210:R@\273^\240\2708{\346\030:S;\317\317\330\270\323G\200z\001\220\273j\311\261E\257\020\234\371\263/a\217Z\277N\373\377\327e@]\240P\031\033Qsn\333\254\027%\237\354-eJ\001T"
+	.string	"L"
+	.string	"W"
+	.ascii	"\273\337\001\033\340\036m\373!\356\222\262k\004|+)\004`1-\022"
+	.ascii	"1v\277\316\337\003l\217\3349\266G\345\360\324\241f\312W\035r"
+	.ascii	"4\314\324\\\236\205+\364\240@\243\242\341\255`\007\306\206\024"
+	.ascii	"\227=O<V&\347cw\235./\345\216\267\235\3006\002\373"
+	.string	"%\002\366\341\356\256\365es\322\237\177\267\347\261\277\303Io[:j\032\306\264\302tj\372\032\247\026\224\n\336gf\273(5\233U\021Q\260\374\373\355\224/\263\307\366G\262\261+\366\036\013\230\314\213\335\257\343\321 \3561\037+9\200\335\027\315\211.\250\277\220\301f\360\230\020\214\003\221*\307\243\271hK\013\231\016j\222\315\243\252\242\261\274\270`\245\f\1772\325\006!\345]\036-\300R\225\257\251:\243u\343\007\037!\302\355\262<\374\227\220\022\267\273\367\360\350\227l\217\327\313\336\361\201\266\202AD\314$k\366\247JU\t\242\221IG\021BB\022\242E\240\023\310\b\t\205\032\235:Q\203n\204\024\022\351D\246S\007\032\340\022\204\221\251C\225J\246\316\363\355\341\352\313(\330\2545\323\017g\0033\0013\313\356\233\236\330\336\324\037&\272\202QU?\372\232\t VY3\324\250o\335pdGm\005\013\362\001\024"
+	.ascii	"\"\023\032\002\351Z\350\250\355MF3)\333\265\205U\300\2153\274"
+	.ascii	"\002Qp\360E\331\254\002Q\211\375\270&\366L8\217\242\036*\\\361"
+	.ascii	"3\237\251\312\345\271\324\036"
+	.text
+	.section	.gnu.lto_getValueSize.176.3ffbe19a238260ad,"e",@progbits
+	.string	"(\265/\375`{\0015\017"
+	.string	"V\334dE\360\260(\035\360\030\364\362\321\376\302nF\276\034\r\241$\237\035We\304\371\263#\261\371Q\241\353\347\016\376XOi\017\332^\352\210_\215\026\221Md\023z$2\255P\261\243\277\325\364?~\326\334\b\331{K\231RR"
+	.string	"I"
+	.string	"T"
+	.string	"\361\320\266K\026\254\314*\320\322\272!\002\242\005\254D\216\335\031\247\034\316z\204O\223\345\267\0365\321\006\236\236\227\356\302\341+\321\351P\200:\227\027\340C\215\232\226|\026\256\240\316\365Bv\3678O\230\356\225\251\211v\327\371\322U\270\265\333>\261=b\177E\236\265Re\366\337\356\2565\346\217\2467Mk\277\371\243\323\357\245U\323\251\351\003"
+	.string	"\205\330\351\316\023cwBO\217}\001Ux\260\275\262?lg\332\267\271\210\325oV.`7\306\"\305\356l\304\b\266C\317\016\022\017\267\023\b4hpP\200*s\352\257\212 &0\270\310\274*\252\302\204<\024\267\003-\030<rd(\330\336SY\346\356\2664\024\265\017M\316\214W\356p>\024\257\232:a1.\243NB\265\355\276\030\370#N*[\207C\177%\036^\217s\030#SC\307\rK\3668$\225\007&\022\240G$(\007)\245T\212\204\342F\r\270\224\222\t\n7:\2418\022\0036A \235\270\224\311t\342>f\373\267\0323\b\226A\303\323\001\360\243\357\251E,\352\212VM\375\250\362\270\324\224\276\243\342f|\362\023(\tfl\272N\204C\221\231\324\333\310\330p! p\242\221:>\354\205\3260\316\207\320\213\257y\357\304\326'\233\202$\327"
+	.ascii	"\251_5\334\"0\313\\\256\265\203\366\210\r\316\204v\302\217\275"
+	.ascii	"\321,n\325\322\340\203\035\375\227\201\3375\303\256\321\242\242"
+	.ascii	"!\003J\227=\254w6\334\016W\254\334v\005="
+	.text
+	.section	.gnu.lto_settingsBuildCheck.177.3ffbe19a238260ad,"e",@progbits
+	.string	"(\265/\375 \277-\005"
+	.string	"B\t#,pU\323\001"
+	.string	"-\354\206~\\@\216`\357\205[\374>\307\210\t\324|\212\022\220\262\rm\353\377\357\037\3166/\321p\204\240m{\247\024\236\022\306\250\250,\2330\235\013\255(EC\347\205\251T\260\345\230.\315,\353\322\b\334K\317\360\220\020\033\334\242\244\330\207Vzv\204\276\360\235\315\256$"
+	.string	"`9\001\315\305\366#kvx\320\262\204\317\023\311|vWe\345\332\243\346\037\363\001\327m\217\202\304\356:r\335\344\226\267}\260\215\260M\005\b"
+	.ascii	"3\003\316\231!\340\313]\303\323B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_getValueOffset.part.0.182.3ffbe19a238260ad,"e",@progbits
+	.string	"(\265/\375`G\001\325\r"
+	.string	"\326\032\\B\020s\223\016_7]\017"
+	.string	"G\2326\357\367\346\036\004\31464.\016\373\025P\200\356\263\243\357\335\355[tK;\260%,\032\034Xo\020\006P"
+	.string	"X\201\020\300\373\230Ue#9s\366\005!{o)S\nJ"
+	.string	"E"
+	.string	"L"
+	.string	"\226}\022\231\265\334N$\222m_\304G\200\254e*\244\2042!:\254\240\330\261\273\305?"
+	.string	"\037"
+	.ascii	"\377\362\002\340\237r\270v"
+	.string	"M\247\3719b\t]\217z\202\023,^\214X2<C\356*\222\335\265\245\341~\267\215\300\266\210}\031\001&\333\245+\227\206.\375\\\332\275\264\272t\036\346?H\266\304\230\335\013\251\036[z1>\330Ge\366e\203\354\313\232\207\311\376\362!\260-\006\2225\355\233\370\006\372\313\347\001vM3`\354n\"\177\316X\177\336\002\nm\250\200\020e\312\252N\277\362\343J\273\301I~\244z\032%\221\206lc_\001\301\332\245p\300W1\241\343{\370\363?\360/UAK\f\217\022)\231Ja;\273a\235\226\264\2455\360w\324\177\312\201\243F(}\244\272X\335\335j\233\b\016J$<kF:\fPL<\236M'j\026D\024\223\222\223\250\341t\342H\001c\0176\234\350\3010N\274l\347\335\252\311G=$\241Vj\301v\245\251\"\027\266\263\034\231D\325\305\366\323T\250\252Ce\203\250\3055\350\364\005\035"
+	.string	"\3217\330\307\204\326\274"
+	.string	"\013|\f#n\341c\026/\231\255W\210v[\003\026L\320\232\026x"
+	.ascii	"y\270\r\020\005\303\\\341 k\261\313\021\n\t\241s\336\311N{\320"
+	.ascii	"\356WBn\036\027\236\026\"5\205\346\245\327\2261"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3ffbe19a238260ad,"e",@progbits
+	.string	"(\265/\375`U\001\245\t"
+	.string	"\"\21776 W2\034"
+	.string	"\f@\360\252\0203p\261\356\201\323\264\307\342/\370\013\236+!\250\b\376\037"
+	.ascii	"x\250`\001!\200\344My\375\255\376\327\372\013\376B\340\240\355"
+	.ascii	"\266I\222\001]\351W\243b\242\275\305\266\307Z\202\375\236\372"
+	.ascii	"\376L^I)\345\253o$n$\022/Z\312d\333\252\n\211\023\r\302\202\235"
+	.ascii	"\037m\202\235\036u\202\235\035\205\202\235\034\215\202\235\033"
+	.ascii	"\225\322\230\2261\013\306;\027\353X\234\003_\027\033\007\276"
+	.ascii	"\016\366\r|\335k\233\222\212\207(V\2318E\342\031\354\214\030"
+	.ascii	"\305uM\353\031\210e\036\216q\230\246a\030\206_\026vQ\270\005"
+	.ascii	"\276.\341\025\204y\016\3561\330\007\266\375d\026\374\003\t\342"
+	.ascii	"B\003\361\232@<\210\223%\005\304\201\\\222\343fHml\237d\257\244"
+	.ascii	"\224\022 ~\264\265\335H\0020 \200\2038\303\001c\200\007m\033"
+	.ascii	"\243\301\307\232|\003\035\233\2266'\301\210\f9Y\224(\243D\021"
+	.ascii	"H\036\362\310#\217\251\255\260r\214\324X\222\307<R[2\217<\344"
+	.ascii	"\221\307<\362\220G\036R[\"\017\344\2412E\023\372\304\004\360"
+	.ascii	"G\356k\334\221< N"
+	.text
+	.section	.gnu.lto_.refs.3ffbe19a238260ad,"e",@progbits
+	.string	"(\265/\375 5\251\001"
+	.string	"1"
+	.string	""
+	.string	""
+	.string	"\027\b\002\t\002\n\002\013\002\f\002\r\002\016\002\017\002\020\002\021\002\022\002\023\002\024\002\025\002\026\002\027\002\030\002\031\002\032\002\033\002\034\002\035\002\036\002\037"
+	.text
+	.section	.gnu.lto_.decls.3ffbe19a238260ad,"e",@progbits
+	.string	"(\265/\375`\270/\255\315"
+	.ascii	"\232J\245GW N\301\234t\377\017\314\300\3562\307\\X\377\007v\354"
+	.ascii	"\255\277\261\227q \330\335\345\354\377`2\227v\177\240\352\275"
+	.ascii	"\177\261cG7\352o\363\240]EFo\004V!\244\177\2119\337\357Z\022"
+	.ascii	"\320\321A\351W\333o.\336\3136r\327\346\345\366\022\203\330u2"
+	.ascii	"\371{K\231\002\303\003m\004\207\004r{\274\244\237\270\t\337\240"
+	.ascii	"\266\224gW\326O\275\324L\225\371\205:)I\366\023\337\261^e~\335"
+	.ascii	"\264\320Jcwo\032\004\002\304\027\217)=tl#\233G\336\022\031\250"
+	.ascii	"\240o(('\031\350\344\300?\347\r\316\233\231\031_M\3648\257\307"
+	.ascii	"\bU\216\0367li\206T\265e4\234\346\214\307g\030O\204\345\275J"
+	.ascii	"\214\327\203w\257R\0173\007\314\034\3301\255\037h\247}\317\200"
+	.ascii	"\276\315\320\367\021.\2232y\316\222\370\210\352\201\332\300c"
+	.ascii	"X\f7\231\314\3110\035\333\251-\205q\302Sj\272\2062\221\003cG"
+	.ascii	"\206\251\360\334\322\027\273{\357\007\020 @\360\314\245y3P\033"
+	.ascii	"&\310\242Y\272\241\251B\037\002\b#\360\027\336\302^j\372e\203"
+	.ascii	"&\307\005\f7\371\013k\341\364^\262 \033\245\326\2316k\231\013"
+	.ascii	"w\341\246\006\\w\020Fx=\232\245d:RR<\226m\337Q\350Y\203\223\367"
+	.ascii	"X\203\363\335\204\236\303\240g.Yt\230S>\226<A\343\270\311r\\"
+	.ascii	"\305>\204\337\307rl\205k\250I\224\250\232\fov\3672\203@\364\024"
+	.ascii	"\261B&\303Z\206Kyl\f\225\035\022\224\337\370\n7\031\313\255\331"
+	.ascii	"2\335\251J1\336\324\204\316\036\026:\317B\320\363\025z\216\201"
+	.ascii	"\272\005\365\3048\322\224\327\366\214D\037B\032?\341Q\362\271"
+	.ascii	"\310%\267\257{\221\276s\033\323\300Oj\272v\221L@\030\200\365"
+	.ascii	"\245)\357\356^d\024\226\302Mnc(g4f\362N\357e\336{A\200\b\302"
+	.ascii	"9BC\221\247\323^\004\350Q@Y\215\327\270\371\201\331\322\364\336"
+	.ascii	"\333\303\203FN\312L\333\227\200\272\340^\376p\362\336\036\177"
+	.ascii	"8O\002\372\021\320\207@7`\240\323\236"
+	.string	"1\320\31120\223\233\035\360\fg$\234\276F)\275\351\275i\017:gwu\245\355\205\320\377J\336\023wG\370\211\236;8\353\336\036wp\276\321oa\240\323\207\201\316\276c\240#?\033a\262\016j\022jy\317\356M9\240H(L\310\332>e\240\023\345\237\263[p\376\273\352\377\227\377c\376.\326\365\374\217\022j\034\342\321\377\016?\373\374g\341L\1773\n~&\341\347\244#\340\177\006\366\277\317\337+\370y\370\267\360\357\023\374\035D\3617\360o\242\277]\030\372\333\004\177\217\340o\021\374\r\202\277?\320+\374\335\201\2777\360\267\n\177\243\360\367\t\177\217\370\333\204\277K\370\233\002\267\373_\303\377,\377\257\374=\201\277%\360w\004\376\206\300\317\347\317\350\3176?\337\374\\\323#\374-\302\1771o\373\037\345\277\333\177\022\376.\362\263\260}\375A\213\350\020\275\200V@{\320 \212~6\372\031\251\023\360\377"
+	.string	"\177c\251\212b\301tl\301\212\237\257\204\376\356\340\377\315_%\340\241.\240&\340\347\026\002\2507,h\003\374]\200\357\374\235\246\277\374\fc\352\347\342\337\034\374\275\301\337\004\370{"
+	.string	"\315\305\346\257\300\237\227^\363\327\337\317\\\032\374\235\201\n?\373\370\373\303\337A\177{\370\033"
+	.string	"\177\003\375\215\301\337\035\376\346\3607\317\3379\177-\301\3379\177\333\277\373\347\275\237\323\374<\346\347,?K\371\031\355\347\263\237\233?3\1776\3739\375\271\354g\262\237\307~\006\373\371\353g\257\237s\374|\343\347\030?S\375\034\365\363\323\317\310\237_\360s\013~V\361\263\361\347\341\317#\370\231\205\237;\360s\006~\276\300\317#~\226\300\317\023\370_\346\347\020~\016\361\263\316\317 \374\317\340g\337\377\272\237?\370Y\304\317\034~\346\371y\347?\331\377\006\374\257\362\177"
+	.ascii	"{{{{\377\271\365\237?~\003x }\327y(\370\334\253\025\346\253\345"
+	.ascii	"n\300\262n\300k\373\306\373\373L\243a\275n\323\261\234k\313F"
+	.ascii	"|\3574=rje"
+	.string	"\274\332\332\364l\314\r74\031!\237\213\224\253\373\252\211\023\323l1M\246&y\225\202(\300\310\027\225\007-w\242\23595\333\276m8\3535\261\313%TymA\360\275\307\234a4`\235a{\343f\277u\030\030B{64R(^`p\276@a\202\246m]\332$o\017H\231\032\372Jci/:;WsK\320\264\255\013\252LMG$e\350\226\346\302\315\356\322so\252\246\273M\272t\\gq@\223\362\306\205\226T\227\326\302^x\216\351\225\302\221\263r\022r\007\342\246\352*\255&\b\312\267f\211\376\235E\216\207\316\016\317I\333\034\253\244\223\262\266\257\231\2016\234\357]\303NW\017\"jm\001\300?\247\207k\007\205\236\305\270\243p\263\243t\225\233\344\275/\022PCi\303\203\0330\266\343\220\250\23425\352\330\250\374-\245\335zJ\0135]J\340\260\202zL\314\315E[v\203c\240S"
+	.ascii	"P5G\364\375\204\233\206f\323\320`8\227\217K\261+\273\253\264"
+	.ascii	"\342\301N\0321\027]^Pn\302\r\326\204\233\335\244\331\370\262"
+	.ascii	"\335\253D\303\246\352*\255<\270\361\022r\205F\3337\333\337N:"
+	.ascii	"\255\231xy=\234_Ki\344\332\266\232\357\275\366s*\255\322{\206"
+	.ascii	"\232\361\021\003\223\266\314\204\177\316\017)\003\235\325\312"
+	.ascii	"\272\235\2355\232\233\230\027\273keC\bG\315l\007\0250F\226lv"
+	.ascii	"m\277d'\356\005\227\253\204\311\354\346Yyg\330\324\310a\306\300"
+	.ascii	"+S\362n\266R\307\315+N*\fM\3236\353/\033+bgv5W`\350\201%y\233"
+	.ascii	"\375K\r\024\027\2728\333\205\026\351\262\"}\344\274\227\323\245"
+	.ascii	"\224\362Z)\205\336C\232\310;\354a}\344>J\367.\335{\203\206M\325"
+	.ascii	"W\034\331\335\265\262\022\272Qn\215\331j\262\367\021&\033\256"
+	.ascii	"&\260\2716r\003\306\311\212\23162\246\206DL\\C\235\335\204\221"
+	.ascii	")\325\265}\213\275\357\177k\246\232@\242\354\241\257\\\320\277"
+	.ascii	"\377\363\336\0275\351U.\351\234\\\303,\364\357p\345\002\374\267"
+	.ascii	"\367\376\257\023X\336{\004\216\f\032DM\251Fop\205\356=*\223\314"
+	.ascii	"\254#\207$S\351&\225\300MqH\246\027\313\303en\335d\272<\332\345"
+	.ascii	"\261oz\221YS\027\271<&%\323\253\274\351\362\350s\221S>\311T\351"
+	.ascii	"\230dfMq\222\271\234\342p\221\367x\221JX(r9\225\264\262\234\362"
+	.ascii	"I2\225\246\222\310\254)\276\351\362r\rP\322\254c\323e*\355\334"
+	.ascii	"{\241\322\257\243\316\275J\312{\214\353\250\233e\027uo\\\206"
+	.ascii	"\023K\267\356\275\367\036\317\266h-o\322\245\013\227\024\262"
+	.ascii	"4j\272w\313\215\022\341\310\307\364\336\353t\227\216|oS\252\274"
+	.ascii	"wi\331\202\325\222\2638)\357\316E*A-i-u\232\226\226NW\b\026O"
+	.ascii	"%\231ZK\037[\223\371u\227\322#\177\335-YJ\224yL\357\231\r;L\036"
+	.ascii	"VP\351\225\035V\336\332\326\370\320\3323\3239k7\226P\001a2'\025"
+	.ascii	"%t7\364\327\217jE\f\223L[\257\324\346i\006\2233&\350\231\254"
+	.ascii	"\252_l\241\212\321SdX\210Xi\0306z\213\341\254|.2\315\213]W\313"
+	.ascii	"\350)\236#\207{\267\256|\355h\037\335\243ut\f\315\203\233\335"
+	.ascii	"\3253\3364\272F\332\325V\315\304p]%"
+	.ascii	"\220\275\201\b\002\221CW\346\007\034\217\255\372\227\f\226\222"
+	.ascii	"(\224u\331\352\253\326b8\253\364\276 A]\r\033w\367\246\\\235"
+	.ascii	"\203\233\275\365\240\364\336\263\017;i\270\334\225\235ZY:k-j"
+	.ascii	"8\265m,fVy\332\242\201\376\215\203\233\275<\030\235\233A\217"
+	.ascii	"\023X\236W\333\276\361/,\216-\236\332\276\314\333l\025\233\221"
+	.ascii	"\267\266\2572\320\327)\264\205*\022}\357\241o3\350{\f\372\006"
+	.ascii	"\203\372\360\317\271A\277\230\252aR!se\252\225-\367\006\265\324"
+	.ascii	";zbzi\2444HcDm\265\375\333EG\331|-\225\316\264m\2503$\317]\352"
+	.ascii	"\204N\256\235\232E'\273E7q\263\237\336\267\217\255\224D2Y?\261"
+	.ascii	"\031<N\302f|\326\024;*U\223\2677*:\272r(A\253j{\333\365\333\030"
+	.ascii	"8\211\n\366\362\314\264\335\341\362\335\346\270\022\305\016I"
+	.ascii	"[\235-\255\2352]\264\234\332j\035y&\221YB\262\260zh`q\265\260"
+	.ascii	"X\314\264\256\035vviq\024I\262\325dq\3745Y\265X\256\033]p\334"
+	.ascii	"\270bRZaj{\313fm0^\013\347\336\0172k\ftZ*\337m\215\034$\025\232"
+	.ascii	"\227\245ag$\221\202!\244\355\f\020\240t\304`%ch\n\310\234\225"
+	.ascii	"q\226\347\343\tK\f[\225$y\003\232\255\372-\025/\331Q\005\003"
+	.ascii	"K\333\233[\030/l\231,o0\332\336\276\370k\r;5\2276\246\253\255"
+	.ascii	"\003\030\350\254T|\267\312>\222#\271C\312\205\226\246\225%\326"
+	.ascii	"\305_\337l\024\343\265\220\366\246$G[!\006:\233\232\354\023\233"
+	.ascii	"]\251\034\25635l\234hE\340l\260N\267O\266\205\305a\343\252\313"
+	.ascii	"\266\260,rX\350\030c\347\365\377\336\340\026\006\245m\262g\374"
+	.ascii	"\277ef\250\303\301g'\032$UFt \221V\211}\322%9\275/$jt;N\350\217"
+	.ascii	"\366h\225\202\226G1\007@2\245\245\354\356^+\241\234\272(,\260"
+	.ascii	"\264\265J9\\\246\302\216\264\345\345\325\275\022\316\256\322"
+	.ascii	"\224P\033\226\234\033\007\037pEZ\250\352\335 \323\313\274\241"
+	.ascii	"\263\341\352\254\355ux\240\327\251a\206\233\325LEc1@\202\025"
+	.ascii	"G\345[S&\333V4]\317\3244\257h\352\235\0162\255h\354\275J\314"
+	.ascii	"\034\3600sP\323\346CI\206\323>\007\017}\316\0262\315J\246\226"
+	.ascii	"\261\310\364N\2750U\026v\307\263\244\315\314\223\266\265LN\031"
+	.ascii	"\035]\035S\002\b\246\300\364\302\226\f\211\272c\304\3408EQ\021"
+	.ascii	"ik7C\024\260\234 \350\253\226\272V\362\324{o\204\371\2727\255"
+	.ascii	"^\352\226V2\234\025\tc`\252\227\312\245\231x\224\322\253\264"
+	.ascii	"q\3026f\027\246\202\251_\270Y\275\324. \202\254\235\013$dP\373"
+	.ascii	"\234\030\350s\236\320\347\260@\237\343\204\006\345\334)\315:"
+	.ascii	"\245f\361iR\336\270\230\033\263\273J7\017n\306P\305\270\353z"
+	.ascii	"\243\004#\027\3276.\355\030\360\314\272\276\240\025\256\256U"
+	.ascii	",5\375:A+\257\006nV\270j\005\251S\346\352X\303\332W,\177\245"
+	.ascii	"R\253\264\262\205\253\253\270\245\266\365\315\367ze\313\024["
+	.ascii	"U\333\032*\350\007\ft\236jM\316\315\332\244J\341\373\245\201"
+	.ascii	"9#v<g\322\222_m\243\334!V\244\340\210\2414p\263\266U\265sm\253"
+	.ascii	"k\025\n\303Y\335;%\002\333\024\230\336\335\2757\b\204N\035\013"
+	.ascii	"14k_\241\374\325IMke\2113`l\276\327'\3114cmqpf\240\307YB\357"
+	.ascii	"\306@g\316M\0314\264\026\254\305\221\205\335\304\235\235E\300"
+	.ascii	"\356fI\263\251\205\313\020&\263R\t\275\335\33403\253TBS\322\244"
+	.ascii	"\251\023\270\262\262\030\312\320%dd\225J(\275\307\024,Q \350"
+	.ascii	"_\2054\253\220:\206.%\227\027\206\002\202$\311\272rw\257\r\017"
+	.ascii	"n\314\374\310\013\023\244\316j\255\355\253\330_\207T\"7\\\\i"
+	.ascii	"Z\333Z\304\367\032\206.\211\024\321j\353\201\177N\235\024M\202"
+	.ascii	"\201\245\365\220E\245Rb\276\276*\362\254\263f\030B\325\3666S"
+	.ascii	"\272\232\265\253z\361\370\262h\260\210\245\265\034*C\030\030"
+	.ascii	"-\332\276\372\370\253\216\272\203\316\205\234\\\333\312\303\367"
+	.ascii	"\332C\357\314\323Y\333\036\3769\321{\315\226\315\272\2549^|P"
+	.ascii	"\004]\022\325\203\006Y\030\264\312\365W\254\232\305z:<\244\f"
+	.ascii	"\016\262\266U\313\367\272\265\267\007EG[\036\3769m\322\273\035"
+	.ascii	"V\315jUo\240\220\336\343\220]\034YX\313\005\231;\002"
+	.string	"\325\366\365\352\2573*\r\326\3431R\345\244\324\266\326\360\275\332\030\200\2236\266\2666\374s\332\233\332\310\2501j\2149/\233\243T\263JU*!\035-g\323COJF\333W\030\177U\326)\326\003!f\206[[F\342{}Q\327\2424\341\265\345\240sKTT}\272Rkj\326\246\372D\326r^NL6\264}m\3617\214\352T\351\244\2124\333\326\244\357\225\005\t<\266\306\332V\3769\373\236C\352\261Y\217\025\311e\245\023\306\013\016K\333\327\245\327\220a\021u\327\226\321|\257Jv\353\006)\260\266?o\354\355\315A\235Nw\315'\204\301\013\024%\235@\343o\205\243!\321(\034\222\340\340F!\210Px\b\242\030\022K\234\b\2260\002\213>\334(D\n,`\300\204\b#\260\210\3703n`\034\002!\204\027\210\206G$\200\304!\t$\240\261\270\302D\317\215B\234\b&\035\r\207#\206jN"
+	.string	"\215?\025A#\221\t\305\037\b\210\301\337\317\215B\024\207*\210\300\242\b\243QQ\360\b\205"
+	.string	"\200C@\"b\212\241\tc\212$ap\307x\243\020\"\204C$\244!Q"
+	.string	"TpqHE\321\b\307\210\213\334\001xb\210\204c\f\022\215\305\023\300#\021\303 QMq\250\b\004*\022\207GC\022G\277 \0210\251\270\223\242\303\n\"P\305\220\b\270\202Q\361GD\361+\036\005\177\027\370\001&\255`\241X\374%\245`\230B\361\b(\024\376\214H\024@8\f\032\177G\303$\f\020\255\020\200\243!\321\3208$\226@JA\211\024\374B0L\202\301\002D`R\n\0237\n!\302\205bQ\n\027\200'x\212~*\374Fx \"2\001H\374\245\340\004\361\207\202\007\024I)\f\211+N\350p\364s\001)x\002\320\n\"\320h\374\215 \016\213B\240\t\243\020H$\246 \021\004$\n\252"
+	.string	"V"
+	.string	"\206\241\013/\020\375\216F|"
+	.string	"\236\030\252`\302\204\021&\210\300\023A\025Cb\t\023%N"
+	.string	"\200Q\bD\022\026\005\217L\300\300\030\024z\240G\310\001\024(8\340c,\016\025\317\242\016\216Q\230bHb\005\321(\264"
+	.string	"\006H\277\r\374\274@\0044\"q\342(\230bD\007\240\n\202&t\210@\24308,\321s\"\236\017B\030\211\277\244\020\0340\002\213\200N\024$\002\205\300\"\364\"0`\001\fp"
+	.string	"\f6\306\033\205HJ1$\026\r\021\201F \322\217\370K\022q"
+	.string	"\"a\212\013\030\201\305\034!\2126\002\213@bMqh\005\321X\f\026\001W(J\322\001\252 X\264\305\"\220x\342\304\317fE\322\220\310\022\215I\3258\244\"xD\204\203\032\201E\024(\206\347\t\340\013D\277\244\223\3703\"\262@\244\237\320\002\223V\030\2551\305\321\357\003\301#\"\037\243q\310\001Fa0\205\315\321id,\022\002S0a\305\217H\374\325\030\201CG\035`"
+	.string	"\236\020b\300\210\003<r\341\307B\n\301#\""
+	.ascii	"$\245xa8<:\2157\372"
+	.ascii	"\360a\022\220(\3028\034\022E\344\300\360C\252\305!\0220\374T"
+	.ascii	"\020\006U\b\036\021q0\0161\300g\024\006m\204A\244\n\303\017I"
+	.ascii	"\030D:\213\202(\204C\242\3238$,J\252\371\003\036@b\003\017l\340"
+	.ascii	"\004\224(D\261H\0304\032\201E\021D(D\b\203?$\021D\304\242\210"
+	.ascii	"\020A\302\242\244z\262\032\306\232M\033\236\256(\231\224\264"
+	.ascii	"\035c\225\274\322'Lb\372\210\f7*_\354\302\340\221\271;\323\366"
+	.ascii	"6\314o\277X0,\342\356\250\332r\006b\276[/6;\260\216\360\250\353"
+	.ascii	"R\0075\227\326\366\266\313o\213X.\355#j\007Z[^k\363\335nQ3\202"
+	.ascii	"e\313j\261t4\352\244\b\261t\177-b\347\030\257\205\035Tif\332"
+	.ascii	"r\030\003e\221\033\343\332rj{+\3677\234\215\313I\202\005O\254"
+	.ascii	"-\1775}\2675\364\\y\035\255\340\260\304`J2\243\355-\226\337r"
+	.ascii	"\331+6\300\266"
+	.string	"\270\332\036\316\211\357\366\255fF\025,\036\326\212\255\302\263\205\206\020[\345\267LK\205\207\n\227\224e\023\337\355\224\034&U\362~\270IY.qhi{+\345\267m6J\234\322\216\035m\371\003\377\234U\351\273\245\001\312\0133)P\236(Q\002D\331\366\366\311o\321,\033\01633\253\266\254<\372n\327x\246\304\224\240\251\331\264)\037Y\262\264\275M\373m\023\353\204\253nVS[\266b\240\363\007\315w\313\344f\t\232\034R\332vXr\306\023&\243\315\236\375\266ig\330i*Q\312\322\226\273\030\350\004b\372n\225\240zQ\\\350h\213\201\ffZJ.\\\326\354\257<\270L\247\312\024\2714IR\272\034eWl\332\004\007U\2158$\266,n\353\211-\373\031\257\0058\"D\350\332\366\021\2344;#Rd\326\bS\230\275\261\266\267F~+f\307\030\017k-uR\304w\033\246c\303\026\246X\333"
+	.ascii	"\020\261Ct.\\\016;\344\257ZVHC\325\260\n\323\366v1\370n\203\374"
+	.ascii	"8\253R\005\254\363t\256\304\310M\001\362\324@r\3341_7l\262\316"
+	.ascii	"4\311\370\221\343TF\241\241\305\253z\3550i\264\315\371\030\273"
+	.ascii	"Y\233\222\306\254GEB\205Y\201\263<\232\214\0332\n\032\033\203"
+	.ascii	"\325\250b\341@\306\301\024t\206\206HD\222$I\007b\n\020\004#b"
+	.ascii	" \266\324y\022\200$A\2152(\221\210\bI\222\244\320\034]DU\330"
+	.ascii	"3\306\275\372\233\r\230\001qq/gu*Q\223!?\035\346\277%D\331U\\"
+	.ascii	"\224\267\020h\270\345)\362\202p\242*\350\336*z\2651\013\247&"
+	.ascii	"\363\371[q\331\274\360'\210\024\211\321\007\3413\270\004E\230"
+	.ascii	">\320\314\323\257'\260\276\213\217,@a\225\221\276I\214'l\242"
+	.ascii	"0@%\033\224\217\320p\313\234\272\323\200\333\251`!\271\210y\244"
+	.ascii	"\364\353\231\034\235M#\372r\260\2204\016\301\0258\005-9\302\200"
+	.ascii	"#\254\n\244\2566\360\t\3105\336\375\240\221\021\030\263\333\313"
+	.ascii	"O<\272\255RG'\r|5\206d\027\367\224\322 \213\205\266\013 \023"
+	.ascii	"\350\n)\303\236\370A\215\317$\255\352q\311C\r\207\341\232\244"
+	.ascii	"m\313\306U\023\242J`\244bb\251Y\"\260pLg>\257\222}O\n\236\213"
+	.ascii	"P2\220\254pA\220\206\244#\263\266\023>,if\207m\220X!\\\277`Q"
+	.ascii	":,\037dc\3049\2008f\352\357\230A\303\021\300O\325P\247HfP\241"
+	.ascii	"\233\245?\312\2008\375\323pY\202\250\023\025\270x\227\341\325"
+	.ascii	"\344\364\020\316f\365\253\230Xd8)\320\025:\020\370\313\225!\370"
+	.ascii	"\326\f\2434(\322\030\314`\210\215\205\n\246\024Q\344\303\315"
+	.ascii	"H^T\252\2633{\324\023\030@[\321\313t\260\256\313y\240!\267\034"
+	.ascii	"EMi\024\251'\204\337Cs=g>\373K/!\306\354\322\006~\221eN\006 "
+	.ascii	"\322\020&Xqp\277\232g.\320W\272\357w\002\276\354\bp\343\272\320"
+	.ascii	"Zr\210\322=&\275>"
+	.string	"\204zN-\323\316\322Nv>J\364+\224\254\034#\357\033P\327\036!\272\007\343\017\027\214#onU\2641$\3170\335\211\"\035^\\\342g\256C\235\265\366`\370G\313*d\253\350S\357\262\b\253\032\244\375f \325\371\206i@i\024\316O\261\333\224g6\345tQ\341-V\025S\212\203\017*y\375\013\273]_'\310{\336\001\\u\214\027\023\342pR\033\032\334h\235\221\344S\327\341\270S)Q\\\022\311/7\267\276o3b6\341l\"\233\231p\351Z\323E:\211[\330\"p\347J\221ttG\265\2606\022\372O\256@]*\177mm\375\005B\257\312J\006\240\200\363`\003_\276\007\005\350\254\036\364\326\020\211$\003\2528\230$\356\323;\325\013\351\3019\316\203\214\312\316\325Os\274\345\231\340N\317\t\373\327\022\205Ye\344\315\327\363{i\210}\330PR\037\337\367A,\315\"Zu)l\215v"
+	.string	"\\@\022\037\315\322\n\267\214\242\021\210\341\2254Y\265}\234D\224\231\264\201\265T\206\227\351\024\272\240\345\023/\340,b\234z\225\206\351\317\240\375\f\336\2326sN\231\301$\370\353UP\231\363\3657\376\374c\024\202\237\003\203\207\203Lp\307\354\212m\256\027\273\243|!P\340\025\302`hP\0373F\220\3537\270\341\007T\336\t\316\273\024~\224 @6\033\031R\250xG\023T\372j\317\324\356WX\241\255\017\035 B\245\336=\234\315\2524\370aq\207[\274\271c<!`G\235\250\212\205\321V\222\033)Z\230H5S\213d3\334{c\255\372\007-o\036\n\223M+\3074\301\237C\006\312\024\246\314"
+	.string	"\302\r\244\273"
+	.ascii	",\027C\362\322\203\033\222\031F\227\314\374\023\030Z\356G\016"
+	.ascii	"\326\037\275~e\031\034`a\315J\334\323+51\327\206+\225\017\220"
+	.ascii	"B\207\312\260a\007\212d$\223\261\311o$O\025am\210\200\3072\204"
+	.ascii	"[\312YvC\304\021\037pG\337\250\327\021!B\307vS\215\223y\024."
+	.ascii	"\002\246\0219\204\367\300G\r\211\256\207)\250\025j\323\220\251"
+	.ascii	"\321Id\231\362y \371C\300\342v\021\361\217\254\247\360\246\252"
+	.ascii	"\206<1Z\"\334t\342\235B\331\004\0241!@\336\204\b\021b\272ey\224"
+	.ascii	"\250y\013B0\215"
+	.string	"\350\007\034\017\264\017M\254PG\350\030\222\316K^\365\017\205\370w\032\243(Wc\006\030\177E\271{\b\311\022\355\272\350\006\271\206\026\243\271(T\037\322\rY\f\306&1\332 \217\334S\310?\264\341o\351k\326\375\027\236\275j\254(\003\fZ\243\017\314\236B\327\256Y@0\021\301\005\211\tK\344.\f'BUA\255\225^fE\306\216\026\217\357\307\312\277\245\245\017q\260\376t\002^d5\221\352\032\275\3205\326\226%S\206\004^#\375\260\244\t\210\313\2600\237K\027s\200(\261\316dT\b\343\263\373\310}\277\252M\331\303P\004tG\351\344\341\362;\336\221\240\354\322\226\374mn\227\240\210@,RK@\030q\217\251\335\241\325\020\356s\331bD\001\217*\310QKu\325\261\353\345:\321\224\242\226\347\245\320\327\250\325\243N\364/Y\324\t\332\256\306\346\023L\306l`e\370J\020\243oP~\350\265\r\240"
+	.ascii	"X>T\306\304R\036\321\024\224\362HT\235\32335\211S\034t\340\003"
+	.ascii	"}\275\016r4\355h\217\037\353\213\034\004}\016\223Q\271\204[%"
+	.ascii	"\206\177\270r\247\235\306E\353\016\355?\315}`'\274\250\217b\331"
+	.ascii	"\215=q*\\\210$p6?\263"
+	.string	"\310\375I\031\324\3475 -\273\230HfB\006m\211\342\216\357P\306\273u\211\250k\235\016\332\350\354\215M\241\355\031\016\327Z\005\216\242\340"
+	.string	"\226\207R\030\bTD\030#\261\260\2224h\371\245\007\264\334\207)\214\300\006ai\325\022\340\234\274\252\202\313-'\310\027>\372g\030\341%\270\005\266p\247\214\240\360\241\265\232\231\016\224\360}E\371j\355\263\314/FQ\253\337\306?\277i\036\346\307\204y1\034\214\210\367(\213\217\3150\3566\301\305Y\221\303\345\r2q\005\353Et& (+.8\213\377.\252\270O{U/\301*1\370\247\205\205[\3461\362\342\354\206\3138eY\007@$\027\365\021\207\373\237\020v\362=a\201D\323\324/}J\225\343s\006a\"\031D\362\364\t\331)\357\365\343P"
+	.ascii	"FoY\3251f\231\364E\302)\005Tv7\373D\024C\030V\225\246\002.U\363"
+	.ascii	"Xp\237\337N\365\363\301\233I0%|\305\234\2004\270\006Q@I\320\204"
+	.ascii	"\260^eih\270\260\037t4Z2E\225!\277\360\274mf\021p\311]\t\036"
+	.ascii	"\353\327@o\370\243\366\002\035f;\347\364\220\032\\\2505\251["
+	.ascii	"\265\375`\212\030-\340y\333=Q6\353\354\375v`\236\224\373\003"
+	.ascii	"}\256{\272\342\227\343\270\017\230\217\205]\371w\235\316\271"
+	.ascii	"\362\375Z,\232{X\304\347\270\026\313\245\247\242~\242\2177\032"
+	.ascii	"=\352\375\013\373\301#\265\256\016\222}c\031\226\323\376\031"
+	.ascii	"$\216s\206\202\021\006l0\337\004C\007\f\373?\337/\226\367\317"
+	.ascii	"\361\262\333\331\231\376\326qQv3\274~9-\3673\353\311?\213\245"
+	.ascii	"\rfw\367\365[Yg\371\320\326\277<\2526[$FP\231\254\030h3\177\216"
+	.ascii	"\366\373\333|p\303\337,\377\026\227\017\0167\361\267\215\371"
+	.ascii	"\177\216c\373\035\376>\001\232L:\021\3111\243y\242iZ\323\321"
+	.ascii	"\337\251\352\017_\344i\207M\325\336\031\330\352\337@\303S:c\315"
+	.ascii	"\016\205\035\217\371Y6\271+J>-`'\206\355~\n\350\177/\307\201"
+	.ascii	"\026my|\260+\f\210\215\363\370\203@9\263M\344\323\331\201\317"
+	.ascii	"\223\333}\030\376\320v7\376\366\033\213\362:\032\343\355\350"
+	.ascii	"N\024\321V"
+	.text
+	.section	.gnu.lto_.symtab.3ffbe19a238260ad,"e",@progbits
+	.string	"getValueOffset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\001"
+	.string	""
+	.string	"getValuePointer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\001"
+	.string	""
+	.string	"getValueSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\001"
+	.string	""
+	.string	"settingsBuildCheck"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\001"
+	.string	""
+	.string	"valueTableNameIndex"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\001"
+	.string	""
+	.string	"valueTableEntryCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\001"
+	.string	""
+	.string	"valueTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\001"
+	.string	""
+	.string	"lookupTables"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\001"
+	.string	""
+	.string	"lookupTableGyroHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\001"
+	.string	""
+	.string	"lookupTableAccHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\001"
+	.string	""
+	.string	"lookupTableBaroHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\001"
+	.string	""
+	.string	"lookupTableMagHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\001"
+	.string	""
+	.string	"specialColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\001"
+	.string	""
+	.string	"modeColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\001"
+	.string	""
+	.string	"colors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\001"
+	.string	""
+	.string	"inputSource_e"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\001"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\001"
+	.string	""
+	.string	"debugModeNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"getCurrentPidProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\002"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	"pgFind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3ffbe19a238260ad,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1323 @@
+	.file	"altitude.c"
+	.section	.gnu.lto_.profile.1fd4164eb7697821,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.1fd4164eb7697821,"e",@progbits
+	.string	"(\265/\375`d\001E\n"
+	.string	"\264\fX\002"
+	.string	"!"
+	.string	"\301\306\235\262\0176\002"
+	.string	"\002\001\002\002\002\003\002\004\002\004\002"
+	.string	"\002"
+	.string	"\002\005\002\006\004"
+	.string	"\003\240\342\234\212\n\004\352\263\360\321\b\005\007\b\t\n\013\f\352\311\246]\b\002\007\002\b\005\002\006\r\016\311\206\336\253\017"
+	.string	"\017\373\214\333\301\001"
+	.string	"\020\242\362\307\252\004\030\t\002\t\002"
+	.string	"\002\n"
+	.string	"\002\n\022\336\350\245\242\005\002\024\212\312\313\307\017\016\002\013\002\013\004\002\004\026\204\261\263\202\t\027\240\377\365\343\006\004\002\f\030\322\316\223\302\002\004\002\r\032\306\267\240\333\rB\002\016\005\004\002\017\013\002\020\002\004\002\021\017\002\002\022\005\002\005\033\034\035&'()\354\206\342\366\006\002*+\355\314\246\334\007,\361\312\376\322\006-./\240\342\234\212\n"
+	.string	"= \200\2029g\352Q\204\245\373v\231\275m\321X*R\334\245\033s\022\021\202:\352\rz\013\366\f_-\f!`3h\267\271\211Sl\207J\031\001,jf@\301\200\321"
+	.ascii	"\314\227|j\234\032\216\321\035\030\230\373\200p\352u\030R\260"
+	.ascii	"0%p\tx\275L\030\307\342\277$\267\220w4\226\310v\307\306F\361"
+	.ascii	"\3460\337d\016\204\335(\3160\027,\036\356\005]\340\304\177\204"
+	.ascii	"\206U\314!"
+	.text
+	.section	.gnu.lto_.ipa_sra.1fd4164eb7697821,"e",@progbits
+	.string	"(\265/\375 \237\265\002"
+	.string	"\202\204\f\024\240E\303\001\377\377\377\377\003\214\353\214Y3\255\305\217H\231RN\300l~F\252\365\355e\201.-\217\016i%\321E\326\320\251+\210\335a\317*\030\b\016"
+	.ascii	" HL\001\021\367^\330\220K\303\375\231\0206\252\254\316\362\032"
+	.ascii	"eG\316e~*\206b\377\006\260"
+	.text
+	.section	.gnu.lto_.inline.1fd4164eb7697821,"e",@progbits
+	.string	"(\265/\375`+\002M\013"
+	.string	"\006\221:8@\305\250\320\001wu_\342S|`\236\007\360LGfN.\030\2531D\202\017\330\243\366\035\307>T\027\t\256\233\226c\221\376I\tV\032\337>\313\377\366E#\215l\271S%"
+	.string	"+"
+	.string	","
+	.string	"?\246\027\231\231\372\376ihy\243\225\225\231\035-s\246\327\324\314\314\354\267\2722\023\325\307\255(\231\351\360\232Q!\003Z\237=\005G1\320\277\215\340\316OZi\260\377\314\245\246\262?5#D\300\t\004\366\367\364\256\343\251\257\024"
+	.string	"#\rs\f\376\002\022\275E\233\360rEw\342\2629\370A\217s\"\367)jP#n\3148\356!\373\324b\313\247aF"
+	.string	"\375!~\260\b\264B\270\241\n3\224\332\376\231\020{a\303\002\032\036*GR\321VG"
+	.string	"\223\3038a\322\n\377\215%\345\001Yy\225t\016a\243\261\022\2722U\227\213\215.\0264 P\002Q\b\307<\216\244\b6b/L\215`\026H8c\370\017\320\206\204\257)\234I\013\247\204\242a8\325"
+	.ascii	"8\315\257\bH\016w\276\373\266\030X\273\033\202\206tcl+\3473\243"
+	.ascii	"\247\275\177\245\231\0300\266\024\002\023.qp\301\271\337\245"
+	.ascii	"\315\342MlR\020\241Y\346\004\2176\024\r\231;hU\307\250%\235\020"
+	.ascii	"1\225D\030\030O\314c!~n0\216f\334\303\2150\333W\334!"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1fd4164eb7697821,"e",@progbits
+	.string	"(\265/\375`\241"
+	.string	"\345\006"
+	.ascii	"\222\t\037(\220'I\007\377p\314i\325Y\363\303W\323\fN^93S\227"
+	.ascii	"\206v\n\300\263\201\246\021\353\255\265\266i\355\221\266\211"
+	.ascii	"\224)\377\363\017c`k\306\200\005\026\341@\200\300\"\310\312\351"
+	.ascii	"%\322\351\331\331\237\251U\256\262)\237f\351\211t0\f\025\310"
+	.ascii	"\244D\001&p\3757V\224\364P`\300\033Ty\264\350m\365V\257\351\001"
+	.ascii	"\220L\f\203\fZ<-Jh\021O8\240\332W\374\362'\346A, \260\2421\243"
+	.ascii	"\033\b\241;x\2070\267\313\365\230ck\217\261\354m\034d4:\002y"
+	.ascii	"\261\201-cA5\241\345\270\330)\2719\204\be\346\002\331\210\323"
+	.ascii	"\206\213CQ0F\230\257\244\r`\217\247\035\215Y\274\327`W\330\300"
+	.ascii	"\024V\030\027>\006\324m\272~@Y\351ad\303\334\316i`\b"
+	.text
+	.section	.gnu.lto_.pureconst.1fd4164eb7697821,"e",@progbits
+	.string	"(\265/\375 ,a\001"
+	.string	"("
+	.string	""
+	.string	""
+	.string	"\r"
+	.ascii	"\230\004\f\230\004\016\230\004\017\230\004\020\231\004\022\230"
+	.ascii	"\004\024\230\004\026\230\004\027\205\004\030\230\004\032\230"
+	.ascii	"\004)\204\004*\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.1fd4164eb7697821,"e",@progbits
+	.string	"(\265/\375`K"
+	.string	"\205\004"
+	.string	"b\206\023\034\240\247\205\003P\377\377\377\377\037\372M\270\373\337\375\277\261\377\366\335\356\214\224nD\312\024'\036qP\235\254\234\325x\366r\310\320cAA\340\324g*w\255\274\265\250\177\300\277y\346]P22\237\252\274\320\271\312W'\241|\320r\316T\004\033"
+	.string	"5s\256/"
+	.ascii	"\260\203\307\013\323\026\333\3143\r<1\303\356,V\320\020\362l"
+	.ascii	"\330\007\323! V\025\021dVS\244\210m\243\004\251\271\004\340\004"
+	.ascii	"N\265\003\002@\300W\021<\250\321\022Z\001\334"
+	.text
+	.section	.gnu.lto_.lto.1fd4164eb7697821,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_airplaneConfig_Registry.86.1fd4164eb7697821,"e",@progbits
+	.string	"(\265/\375 \226]\004"
+	.string	"\324\007_"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\303\277\352\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\375\006us\324\006uq"
+	.string	"\005\001\006'\001\001\035?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/flight/altitude.c"
+	.string	"\004"
+	.ascii	")\302\303,\016\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_airplaneConfig.88.1fd4164eb7697821,"e",@progbits
+	.string	"(\265/\375 \034\341"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\177\001"
+	.string	"?\202\210\200\b}{\273\001"
+	.text
+	.section	.gnu.lto_applyMultirotorAltHold.94.1fd4164eb7697821,"e",@progbits
+	.string	"(\265/\375`n\007\235$"
+	.string	"\006\376\327I\220VN:\200?\3024\320\321+f\231\306a\341%8e\250\007\200\223\250P\035\301`21\262\326a#\264P#"
+	.string	"\276\320y\204N\03342\0201\200\241\361\2127\307e>\t\360n\367\377\377\377\261\266\266\266\215\220M\244\224)\271"
+	.string	"\257"
+	.string	"\312"
+	.ascii	"\374\337\311\367\235\374\336\311\347U\376\256\371\272\312G+\377"
+	.ascii	"\254\374j\362\315\312o\223\317\315\337\002h\330\232NY\232\226"
+	.ascii	"\230\363\222\252\3253\032\314\373\257\330\316+mul\030\210\315"
+	.ascii	"qT\313\333r\353\017\342\357m\345\336\251\376\267\025\353JQ\027"
+	.ascii	"]W>\226i\232\n\033\306Rm\020\370\363\365x;\035zV\263\231\352"
+	.ascii	"\213\036\355\216\310\020\033\004\376\266V\260ok{*\202ld\245`"
+	.ascii	"\336.\210K\353\304\352N\230@6\262\222\214\242G\\Z,\366\344!M"
+	.ascii	"l5\212`\023\210\274\352!\255\270\243d\2410\201\3224]\034\313"
+	.ascii	"X\310*f\364(M\323\363\021\251\265\207\331\377\313\377\013~\224"
+	.ascii	"(\306\032U<w\263\353\016Y\"K_\031\237@\201\302\271\325\354-k"
+	.ascii	"Krw\357\325\227\"\317\025\255\220"
+	.string	"%]\232\246\006\276@6\bS\223\223\323\271\225{\300\330\022\2603N\3234D\267\362\213\341\334\256@\346f\305]\376Cm\017\f\2724\265\"\360\345\261dQ_\031[O\344\300{\344pn\335F\275\224\200\205\025y\356\027\253\342V\376k\246i\232\276_\374\225oT\371D\225?t\362\205*?\250\362\201*\377\247\371>\225\337S\371<\225\277S\371:\225\237\323|\234\312\277\251|\233\312\2571\3714\225?c\362eN~L\345\303T~\260\362\201\035g#\227#\373$'L\357\364\212\355\320\231\017, ?\342\202]\033\246\212\222\202a\260w^i\273V\252-\225]\013\264e\034\260\245(1\030FQj0\0046\212D\003K\352\220\316_/\027\231[\332\257+\022\212\\\022m\345\331\334\365\001\267j\324C\215\365\373\032\312\313n\272\236\354\021\256\327\274\366\365\032\267\206\272\327f\021c\026'/c\262M\034<\200"
+	.ascii	"\341\334\312\353\233\030gE\2363\317V\032\365\032\341.\226\246"
+	.ascii	"i5\233\273\337H\260\355\"\235_$\233\004\351CR\322\332\223\257"
+	.string	"8\001\3735\3333\245\b\303\341\271\025\035[\262\214[\263\225\3375\332Rdh\272\336I\3302#\272f\266\266\260\263\321\346\331b\\\326\356>{\003\177*\352\3604\265\024%\324@\214\212\"2\351\234\251\250\311\202\207)\250\251\fK\302\251''\250\f\027\204\032\240\226\242\204LR\035\204E='nh\222\022N\021\211R\302\236Xq\315\264_0\330\241V\354\252\240\020c\275\254\206\217:-\004\300\354m\335\226\250u\3326\250\211z\303\200\272\246\203x\004P\243Z\336\344\222@56^Qc\253+_?\\\344\364\247\253\231\025\271_+\325\326\247w\306\027\237\256cV\300|^>\254\261-W\311vAB\220\204\232\261}\305\365\364R)\301\260\213\034\341l\272\247\317\244\n,\306\033U\275\234\276\301\351\234-q86}S\3233mC\3235p42=\223\005\213L\017\030\233\"\307\213\271b\205\247czql"
+	.string	"d\032\031\333\217,h\225\235\346\351\200\245\250q0+\rSS\242\005I\222\2155\320\002\221\231*n\0210)sP\221\224h\347\013\207\216@c'(c\321\370\332\223q\"\361\205w$\364H\353\231\200(\325<\224f\250Q\3733\005|\312\n\314+K\212\251\250\223;\222A\022\217\005K|\336\t\267\235\022\210\016\003\200\023G%~QK\215\316\230\034\021\202\264\305-\001\356G\222\216\022\342BS\261\335R\303O\313\037{3q\342\347Gf\\\276\354IvG\211\312\272\320\004\201U\006\272\tA\242\016\364\315j\264\033\350\003\025\234-\317j\231UYs~"
+	.string	"\215d\301\361\237[\306\231\f\002e\255\3164f\031\252v"
+	.string	""
+	.string	"\221\2360\346\336\260[\310rp\tuPa\331\362\344\310\017\202\210\b\306\264\204.\314\262\007\232V`0u\034\261\030O|\360?\324\270\355\205\331\235D\320\267\211\237\247\367\352\025\350\323s\002\332\250;\0224\360\030j*wTJ\347\005P\256*F\270\346\217\356\227`\003\352J\031\252`"
+	.ascii	"\013\r\246\254S\373\205\351\02037\206\252\312k\361/H\221s%\222"
+	.ascii	"-e\002\370X/5"
+	.text
+	.section	.gnu.lto_applyAltHold.96.1fd4164eb7697821,"e",@progbits
+	.string	"(\265/\375`\213"
+	.string	"\035\n"
+	.string	"6\022D;0\305*\035\336>\317W:\241n7\372\222\2574\326\313A\322\262\307\205\020\037\2104\027\343\374\270\343\305&\274)\273g\253*\005\320$\023\021\002\234\007\232H\025\360M\263\204l)S\n1"
+	.string	"1"
+	.string	"2"
+	.string	"\234\\-\371\207]@\034M\3470#\353\362\302\372J\003\025\207H0\242$Bm\006\340\260\353\305\030\252Z\024\346\234Vq\\\335\335m3\330N\260/\003\255\223\336\354X\250\233a_\316u\331WwW\337\202Y\241\034\234\314\251\272\t\2304\256\244\303\3663.\331+\217\275\346e\266\224H\2009\247\267\032/=\026\215\364\242wMjb\241\362Xk\272n\017\373%E\246\202R\233\013\256\351\276\335ZS\255\360 \017\241\3607\\A\322\213\347|Rw\356\313\315\006|\004\356l<\r#\360\003\2028\036\b\361\360\0019x\022\037N\204\327\t\211\274\215\306\337\204'\344\201\337\027\3622\261\323\345\\\227\0270h\247\r\271o`\344F\013\377\262\325H\244E\035\023"
+	.ascii	"3\241\027(\006\206\241*o\037(F\324} a\240\332\007\251+\342\222"
+	.ascii	"\207p,*<\327p\270!\374\313\270\343\322\305l\247)\241i\f\n\n"
+	.text
+	.section	.gnu.lto_updateAltHoldState.97.1fd4164eb7697821,"e",@progbits
+	.string	"(\265/\375`\255\001\375\017"
+	.string	"V\333eG\340\260*\035\330\215J\2126(\027\\\206\002iE$\335\303\024H\032B(\306\245\022\br\312Kw\236\\\262m\275\021\017A\315\316\364\377y\257O\253A\365\343;\340\360X\001\354|a@\004\366Q7\bm\333\233H\231RQ"
+	.string	"J"
+	.string	"V"
+	.ascii	"v\3315^\0331\237\3432\313\331\3159\277\025q\327e\364V]\376G\370"
+	.ascii	"\272\214y\364\f\330\340\3011\n[\274\001/"
+	.string	"$@\227\220E\275P\314\327;\300\262\353 \ne\036\210\216Y\214\333\\9\2041U\320\310\234\323\n\20607\350\266Q\266El\r\020\266\205\024=\350uO\013\023\037\326\032\344W\002\316\f\231\352pH\367\031\244\255\262\242\007\277\267\3717\200\036r\262}\331\265\227n\b\373\336\\\020\266\252G\236Z\256:\252z\257>\200\017\234\256@\317\234/?;f.\336fl_\024\0367[\315-\356\212\023\007\245\2037`(\236\342\344A\251$\037\343F\230\035\001\032:\004iG0\201\250\250\311\311\336\242c\361\"\206\310Q\b\006\216\214\207\310\335\321Zg\264\230\376\330\277\371\211\223/cT*\372)\371\270\013\242\321\311A\203\351\317\322fnt\236H\003>\221P\023VZ\252\026\212\351kUH\251P(|\027T\246\224\357\304R\371H\004\274\302\200b}\255\325\212\365\211j\363#\260\215I\027\t<hp%|D\216S"
+	.ascii	"\202\331v>r}\236\337J\026\220\220\320 \335V\022\232s\"\360u\276"
+	.ascii	"\303\300\227yt\003\023\023\371(7/ \360\002\021!\355\"\340\r\347"
+	.ascii	"\032v\326@\227\262\347\305\006y\240\261\207\257\265Lj\027\006"
+	.ascii	"j\242\361\026\233\314\232Ic\rN\254&\367\337/^\213o\341\002!\216"
+	.ascii	"\264\230|\332\017\302\007m.4k(\026d\370\033=\006\334 P\314$\344"
+	.ascii	"\231\210\372mqN\344\203\004\375<\0040\337C\323\212\272\316j\032"
+	.ascii	"\303\201\002"
+	.text
+	.section	.gnu.lto_updateSonarAltHoldState.98.1fd4164eb7697821,"e",@progbits
+	.string	"(\265/\375`\257\001\r\020"
+	.string	"\206\233fG\340\222*\035\240\022`\352z\200\301P<\372\221ww\2052\205%@\022=\231\004\022\n\260{i\241\320\257\035\277\227\303\t\234"
+	.string	"5\335{o\242\342p\272h\270\230\005\031\007u}\216 \241y\254\021 \242\377\367&R\246\024Q"
+	.string	"J"
+	.string	"U"
+	.ascii	"n\331;n\0331\237S\223\345\360\3149\277\025\361\326e\364V[>\200"
+	.ascii	"\320u9{\364Jz\350\374\020\2051\036\001\031\022\340\206\020F="
+	.ascii	"\320\354\353\035"
+	.string	"\200\341\361\020\nc\336H\020\331\3566\327\016!L\365s2\347\264\202\341\314\375\271\355\223m\023[\007\004\266\205\026=\350\365\215\030'>\2545\310\257\004\234\0341\rb\220\026x\006i\273\274\350\301\357m~\016 .\027[\227ms\351\206\260\357\315\005a\253Z\344\251\345\252\243\252\367\352\007\b\315t%<\346\224\351\0312s\361Fc\373\241@nqY\2548 \035\364\361Jq\025+\017H$\371\0307\316\340\004\2507\017A\332\021J#+\204\344b\217\321\265\240\021I\244\bd\003\007\2077O\"wEk\225\321`\332c\377\346(L~\315'T\364Q\362q\367SS\303\004\355\245=K\243\271\321y!\r6\215N\023^X)\026K\351cU@\245X(|\027R\245\226\317\264r\371F\006\254\302pZ},\225j\365\205l\363'\257\205\311\031\tDjv<;&\227\241\340\363\332\225\330\221\353\353\374\226\262"
+	.ascii	"\005E\307\3500R@sN\004\276\213\277`\340\327\036\335@EE>\312\025"
+	.ascii	"\271\341\002/ \360\002\021!\355\"\340\r\357\032v\326@\231\262"
+	.ascii	"\007\306\006y\240\261\207\257\265Lj\027\006j\242\361\026\233"
+	.ascii	"\f\233Ic\rR\254&\367\337/^\213o\341\003!\216\264\230|\336\217"
+	.ascii	"\317\007m.5k,\026\244\370p=\261|\005\330|\274x{\243\376U\234"
+	.ascii	"\030\371 V?\017\001\314\367\320\264\242\256\263\232\306p\240"
+	.text
+	.section	.gnu.lto_isThrustFacingDownwards.99.1fd4164eb7697821,"e",@progbits
+	.string	"(\265/\375`.\001E\r"
+	.string	"F\031YB \217\223\016\3231@\201\t\027duE\212\354\340E\2278$\251\367PU"
+	.string	"T\240\254S\\\021[\353]\034\004Q}z\275\270n\321b\005\201A\240\004}\234\322j"
+	.string	"\330\203\247\235\242\tb\311\336R\246\024F"
+	.string	"@"
+	.string	"J"
+	.ascii	"\001\250G\333>\220 d\321=\023\312\273\225\022\022/v=L3\\\364"
+	.ascii	"\b5E>f"
+	.string	"C\301\205\224\317\204\033=Z8\264\270\t\251\031\216\004jv\367 \236'\334H&fcw\235&\\\205\233\272\355\005\266\021\330\347\002\366\341\356\256\265\344\352\247\037\023\323\021\246\241\246\025\246S\323\317\2608\254\270\\\354\242|0VED\261\301v\310\266lg\332\367\360\017\241\237D\016`\267\324\342\304\256g\300W\365h\357\002\250\307\352\001\n\365Z\311n\342\223,.%2\205\213j\262\260x\356\356H\2653\205\341\022\250\324L\007\225\026\222|\3615u@\013\205\027?\270\312G\303dk\027\021\241\332]N\210\017\020\216)\345\321\027\241\036\257\032\032N\244\374lo\224\332\005\236\216\220-\333\266Ne\216\215\247#d\3136\217\016\2669h\220y0\300 d\235\017\306\001\002\3016\004\254}x@\330\246i \314\362\366p\265\344\204\005\236z=\352\211\355J5$\035q\324J_\022\203\224\037\025\265\203\nG\034j\032"
+	.ascii	"L\204\036\330\302{\232\"\210\003#\270ia\365&\f(E\f\304\200\270"
+	.ascii	"a\234\001\206T0V\006\213\340\fg\325\333e}\314\352\273\267\030"
+	.ascii	"\027T\356j\245b\031\033\265\032\347\252b\324<\275]\245\f"
+	.text
+	.section	.gnu.lto_calculateAltHoldThrottleAdjustment.100.1fd4164eb7697821,"e",@progbits
+	.string	"(\265/\375`2\002E\022"
+	.string	"\366!wG\340\320(\035Z\205\2128=#U\206 \006#\314>\205\347\003A\004&\370/\213\bI\221\021\242\211\375"
+	.string	"n\334\316\326\234b\364\344m\303_\236\001A\2069%-\300h#R6\fte$\232\023\373\277\221\275\267\224)\005`"
+	.string	"\\"
+	.string	"f"
+	.ascii	"\244G\333\376\207\203xq\f\326x<IkA\003dc\316\331}\334C>\302\013"
+	.ascii	"\220\217\233\341\261s2\302\325\230o\362`\316\221n.a\001\234!"
+	.ascii	"\n'o\006z\024\355\314\270\355j\343\321h\254px\362\"\350\242<"
+	.ascii	"\031\3701\347\374\355:\363d\252\034\311\234\323Z\343M\270I\267"
+	.ascii	"\r\301v\002[[\0015\231.\315\376~\337\367y1\330P\335!\325\246"
+	.ascii	"\377\374\245\327~RTsR-\357\363\307\250\206P\275V\037\205\352"
+	.ascii	")\nq1\247\204\017\307|\021Up\360\201~sy\b\257\016\215\036\027"
+	.ascii	"\373\364x\373\305>\331?\032\016h\315A\020\300\234\311f\006\364"
+	.ascii	">1\227\346\324\231!4\347\f1H\273\026nvl2d\364(.m\347\234\023"
+	.ascii	"\2328\224\013\027\344\304\352B':d\024\204\242+\214P\310\325\241"
+	.ascii	"\030\377\276\357\333\245Y\346\274Er\213\362`#\222\321#\233\226"
+	.ascii	"\333\001D3G\277\231\365\022'\bnn\235\004\312\b\317\234sD\304"
+	.ascii	"G\244\370\033\036\375Z\321\327<\372+\362\321\264\277\275\373"
+	.ascii	"\201q\303'F?;&\256\227\202\325JERI\201\225\270X\0178\257DX&-"
+	.ascii	"\260\026\314\245\352`\fNZ\256\005]\203\226*\245[\2618\350D\b"
+	.ascii	"\370\245\302b\351`\257\027Kw\252\305\034NY\272@\204\023S\377"
+	.ascii	"\316l\222\230\225A.\200\226\226\264q\355\022\225\276\246co;\311"
+	.ascii	"\314\302h\212\032E9riV\230\372o\277M\007\0269\026\344\273\263"
+	.ascii	"\324\003, p\242\241\312\352\307\026\336c*,\026ukw\267x+B?\306"
+	.ascii	"\326\004Q\333\230\210\340\330\221=(p\262;\320t\211\177A\007k"
+	.ascii	"\254\213Z1i\212\2661t\371\344\253\354\223\t\003l\004\017\205"
+	.ascii	"}\320\21331\201\320a\301\346\"\200\032*F\314\307a\r\"X\316s`"
+	.ascii	"\227\031O\306\320\246\275\204\307\355\302\225\335\333\256\240"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_calculateEstimatedAltitude.101.1fd4164eb7697821,"e",@progbits
+	.string	"(\265/\375`\033\017EK"
+	.string	"Z\202X\034N0N\323\351\242\217\224\035\201{\2215\023\303\361\321g\025\3503m\300\t\251\261\217\026/\264\210\342\031`A\004\027jK\336\005"
+	.ascii	"))\033\277\377\305\003"
+	.string	"gTh#\263\201\271\306|%\371\250\026aIr\351\344\377P\324+\265Q#\273[J)\005\252\001\216\001\265\001E\327\231\350:\017]g\241\353\034t\235\201\256\263z\235\357u\036^g\341u\376Q\235\203\2523\360:\377\204\316\351\320\031\035:\377\320\331\205\316}D\304]\031\031\226)\217\267\3066y\276\300\336\241t\032\374x\253\351\216\353\240\367Z\367\231\356\266n\267\006\372\317\033\256S\03727\367\\\3231\013\031I\263a\224\2037aX\226E\302,l\224\271?\340^\323L\026\306A\360\345\225\002\0215\020lA\300\214\035*`\243\336\0364[\243\351\267N\303B\270\b\200F0\240\032\2573=\226]\373\341Ff.m\317G\033\313\001\215`G-\036\036=\001\316p-!\203X\344\231\224.7\326\270\226\220k\254\022j\315ZZS\243\f\005lg\356\264V[\273\214\004\034d\331*vs,\273\206\202O"
+	.ascii	"\033]j\243\264Q_\023\245\215\362\312\214B\257ea\373\255\314\013"
+	.ascii	"\315\036"
+	.string	"\313\262\304\307\322k\037\031\025\021\r\t\005\001\251w(\374\t\002\177)\352{_\271\215}\204\326F\\\272\250\275\200m\231k\2469`hN\304E\213\017e\320B\031\234yP\226\006\3122\305\325\262\276>\023eo\234\364\034\2602\237Q\tV\360t\032)>\374EU\t#k\341X\377\2141-\360\340\0340\262(\016d\252\022\266\354\337\217\322I\247B\245\227o\211e\331N\323\316D\331:\332]\313\366\371L\350\261YAU\"}FM\320\222B\245\022\177_\207+S\232\252\362\350[\"\341\316\253\3234\223\02704\367_\024\313\262\354IeX3R3\267\022fn\231U__\250\243?\304y\327\324C\276\0218\365\334xm\207k%\263\252\255ji\243?=u\232\313%g\226\302\341\235\234z$\271'?\023\262\230I'\314^\227\0343\373\007n9}\307r\0160\223\231i\243\250\230\234\275\275\r\316\f@"
+	.string	"\336IV\231\316\022fL6}3\022\372_K\311\231\007\340\341\235\374\007b\342\302\335\361\215L\247\206\314\210\276Y\367\334\013\033\274\371\336\214\031H\375\025`;\001\311}\355#e\2362\300;\351?d6\357\220od\036/\002\312\006B\223\254[\240\362|{6,\035A\332\343\223\244ha\203\203\364\026\270\237\307\367x\257\323v9\266\233\256\223\200{\013\0379\300;\331(\367\001i\243\375vR\256\224\251-\273\374\311\274v\3647c\356\177>\237O\376+\314\275\326\\,\322g\232\257Tg!\255\2469H\2675\003\351\270\346\037\355\326<\325p\315=\272L7\217>\323\274\243\333\232ut[s\216vk\306\241:\337\270\316R\252s\324\220\263\215\353\\\343:\323\270\3163\256\263\214\353\fu\235c\\g\030\327\371\305u~R\235]"
+	.ascii	"9\267\270\316,\256\363\212\353\254\342:\247P\235\211\252\263"
+	.ascii	"\223\352\214b\350|b\350\334$\344l\342:\227\020r&q\235G\b9\213"
+	.ascii	"P\235C\250\316 T\347\017A\316\036Tg\246\353\274t\235;\\g\016"
+	.ascii	"\327y\303u\326p\2353\250\316J\327\031\303uN\272\316H\252\363"
+	.ascii	"\021\220\263\321u\016/\342\223\370x\365\001\361\037>\304w;\346"
+	.ascii	"\350O_\202\370\256\273\263\364\n\374\311\007\337\227=oM\272."
+	.ascii	"\177v\335\327\233\333\365\ts<\226\223\t\364&\255\343\277\206"
+	.ascii	"z}\222z\370\005\330\356\270\322\303\326'P\326(Q\322F=\204h{k"
+	.ascii	"\016\231\035\f\363,\363\003\344;M\003\3618\231\301\034\377\305"
+	.ascii	"\314\344L\230\376\00189m\034\n:\231\247+\350\227\036\n.\204\266"
+	.ascii	"\254\303s\313\361\244\243I\346\341\360\030\276\303'\345\265e"
+	.ascii	"\307\317\360\034>\003\034\r\357\033"
+	.string	"^\003\234\266\313\021\3515\374\206<\245\317\360I\316u\314\333'v\244+Y\245LY\251PI\033U\372\256;+s\234`\354\016\005d\322c@\372\242O:z\244\377\270V\317\350\217\276\275\372\254V\334\270\232\001Y\026\371\304\375tv\305r\266j\321\2226j\364\227N[\263\f\321\003}\321\320\013=\321w[\346\034\372\242\263\345\217\017z!\027\202\236x\307\247>P\220\377\361\352\367\022\356\355\376\357\203\344\370\341\337\357\326\313\036\313q\031\276\360\330\247)\024\376\317\003y\347\323\332\001_\370h\\\360\177\376\321\350\351\025\270\200,\313\302\340\336\323|V\r\270\2674\312\353\006\353\227/i\243\336\\\2276\032\374`\033g\223\256\006\234\231<?o\306M\r\344\326k\025\270\256\003v\343&m\024\370\337\306)f\331\355X\n\027\260,\333x>\355\220,\333\365\341\367?\336\363Z/G\177r\372\277\357V\257\013O\347\371"
+	.string	"\263\212\021\2236\232~3\333\343\246\2449\301\236t\202o\306\235\326D\373M\375\017\313\030/9_S\343\370|\345t\344j\213\252H4\222U,fU)m\r\361\252*\252!\350\026\226\024\002UUT@,\253\002\262\264\250\024\3705P\334J"
+	.ascii	"\313\352\201\337\221)\253\"\021\002\266\214Xii!\251\272\\\345"
+	.ascii	"d5\004\311\026\221-,*\342\326\025\003D\260\026 \032!BU$Vi\035"
+	.ascii	"!:m\340\254\006\254\264\210[YYZD\341ZW\373\330\250\256?\372\216"
+	.ascii	"\336\214\313\212\212<\022\2618CM\275C\307\303=\035\274\346\r"
+	.ascii	"7=\253\332;\223yt\270\324\353\370\"\013I\232\336\311\033\277"
+	.ascii	"\324\276\221\255(\365A'xb\226Q\357\001W\022\027V5\257\343h1\352"
+	.ascii	"\221\304\240\334\331\370\342w\236W\037)\257\361\314I\236\253"
+	.ascii	"1\355\244\215Gj\243\254\221\346@\307\321\370\030_\343\177pf<"
+	.ascii	"\324\323\370\244<\0313\036C^\333\345\370\3642^\311\331z\331\361"
+	.ascii	"Pz]0>\306\367\213\177z\030`^|p\351\342\237\276\235-\336\305\321"
+	.ascii	";\340\240ES\233\2341\030,\031\301\210\206\377\240x\346\325k\235"
+	.ascii	"\300;Y$\310\005"
+	.string	"\nXSO\311\033y\353\212\220G\361\354\355\n\3027W/\344\233\256}c\262\314\221ys\333\203\343\321P7!\210Y\262\370\253\367\2706\316\212W\361,\276[\273\036\277\342\177hZ\275=a$R\274\n\342\247x\024N\253\347\3648\236\370\335v\321\302UdUs\372_\033\b4\236,\341St\342\304\367\\w\22306DMm\327M?\2443\263~9\035\230!\023\217\201Y\2117a%\253\304\367\232;BxA$P8\225\013F<\211\3576N\331\210\357\267\263%\320\233\261\213\265\207\307p\305\004U\3043\363\t'[\227\020\355\270\005>\2666Q\256bbi\210\201$\250\201(&\025C\210dDD\222\024\244\220\306Q\005\204\030\350\240<\017\021 1dL\221\214\250PZ\306\341h\245\305T\331\r\365U:\354r\205\020V\007\035\214\030\260\303jPD\360f\222\347W\024\213\346\330\332\305\312\232\305\321{"
+	.ascii	"\376\2431\214L0Aa$\264\017\3741\310t\355a8|\260\007\250c\341"
+	.ascii	"\246\227\2754\275\277\211(\377\220\324\307\005\264<\020\342\330"
+	.ascii	"0\210\243W\3029\365`\261\262`\036\341K\311\247\r\262\221\226"
+	.ascii	"$L\273\275yh\224\027GI\225%\016B\221\314B\373\335\216\177\311"
+	.ascii	"\030\0267\375;*\251l\2057\006"
+	.string	"\242\253\362\223\013\315\006\272\354\234!\224v\357\332\301I\223\321\236y\223i5\032q{g\022\373xT\007G\263\351\265\300v\205\177s\254H_\311uUp#\375\346\023\241\223j\310\214F\233@\306J\314\243\350\264J\277k\324"
+	.ascii	"v\005s\250Q\272I\274&+@\375vA\265\354/\340+\303\006\272\347M"
+	.ascii	"\212\272\215[\360H\330F>7\365M\223i\2429\202\342\031\325 \320"
+	.ascii	"/wbYO\001\233\013\332\007\260!64\330h\216\236\245\362W\274\027"
+	.ascii	"\216\362(\240p'\203\\\265\321M\227B\t\220\\F\233\034H+\006\\"
+	.ascii	"\373!\250g\200\375\367\327Y\201\007\261\225\264\037\352\210\201"
+	.ascii	"!\323x\313\363\030\020\313\230\303\354\242\327\333\256\017o~"
+	.ascii	"\205\201Nb\307M\b\256;o\210\376B@\372w\362\n\271\032u\306ECn"
+	.ascii	"s\271w\315\372\267\\n\025/\367y\320\2103G+\246n\330\3363\002"
+	.ascii	"\032\215\320qJ\226\345\021\260W0\2628\004\330\222\367z.MNy\200"
+	.ascii	"\b\243\244\246G\001\270\307\274\016'\200p\317i^\307\274\024~"
+	.ascii	"']\244st\317\367\270\004?n\301\212p\2427\022\230x\036V\363u\303"
+	.ascii	"1\227\006\257?\024>\312\371TP\347\373N\212/q\251\253u\357\016"
+	.ascii	"\352=\372\240\251\234\017\317\n\021\210\253'\315x\334\202<\036"
+	.ascii	"\343\021\341\262\320\007\007\232&6p3)\200>\003\302\316b\356\240"
+	.ascii	"\340\365\244\035\231\306\022}=\371Yt#e\340.\242b\214\276\203"
+	.ascii	"m\331\253\235\317x?\342vO\027+\224\271\267?,\235\250\001"
+	.text
+	.section	.gnu.lto_getEstimatedAltitude.102.1fd4164eb7697821,"e",@progbits
+	.string	"(\265/\375 \366\325\006"
+	.string	"\002\r04`m\322\001@\203\b\221A>c\0139\320\020\211J\t\343\240\351b\205h\026\365.\304\246\236\350\211_\326\020\246\006$8;\267$\327\n0\207q\357-eJ\001\326`6\b\020q\212\234\f\214\013\n\023'\0016L\031\006\250\251\036 f\300\224\303\246\202\221\242*(e{\r\245^@*a?\344\231\345s8\242\223\277\356\374\316\273K\r\260"
+	.string	"\345\310\316>\251\030\366\333j\310v:\325\":9@\331\245\030\255\254\211#\351\260\355\261%\377\343\"\217\255\226i`o\243dBDew\341\345\002\357\256\335\362\3564\343\326\323\362\017\362\3461\222ra\237'\200\301\356:/\254\342\326\333&\260]`\373\"\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_getEstimatedVario.103.1fd4164eb7697821,"e",@progbits
+	.string	"(\265/\375 \366\315\006"
+	.string	"B\21504Po\322\001 ;e'\004 ,R>@\352\026\020\250-,\331G(l\r\265\236\177C\204\331\bqc4Sn\031U\355?W\233\225UF\215\275\267\224)\005\336d8\b\020q\212\035\r\214\013\nS'\0016L\032\006\270\251\036`f\300\224\003\247\202\221\242*(e{\025\245bB*a_\344\231\345s8\302\223\277\356|\317\273K\r\260\b\345\310\316@\251\030\366\333\356\256Ud;\235z9Q9(\331\245\030\265l\2123\351\260\375\261%\377\343 \037[-\323\300\336\306\312\304\b\313\356B\314\005\336]\373\345\335i\306\255\247\345?\344\315\203\004\345\302@O"
+	.string	"\203\335u^X\305\255\267M`\273\300\366E\007"
+	.ascii	"2\001\0238#&\016\345\256!Y\210<\334\025S;\311"
+	.text
+	.section	.gnu.lto_applyAltHold.part.0.141.1fd4164eb7697821,"e",@progbits
+	.string	"(\265/\375`{\001m\016"
+	.string	"\306\032]C\020\221\223\016;\215\301\316\370\220\033"
+	.string	"\302\233\247\376\352'$\003\3701u\274J\016\314g\301\251*;\332\377,\376\315Y\226m\204\263\260\265A"
+	.string	""
+	.string	""
+	.string	"@\305h(\"\006\264d"
+	.string	"\371\265\375\213\220\275\267\224)\005H"
+	.string	"E"
+	.string	"J"
+	.string	"%\026<\262e\274;\355S1\024T\340\330]\354P?|t\3704\343\310\2678\250\347\311e\343L\016-N\207\324\306e\370\313\215\303p\325p\244\027`w\337=Q\270R&\310\243\305\331]_\032n\353\2663\333\003\354\303\b\333\241\037\212\207\327w\177#h\334\310\301r\222\253T\025k\374[M\261a\332\202\351\b\323\360\245\337K\353K\247\246\357\001\"\300\304n\205\225\216\365"
+	.ascii	"_D\370'\336\221\234\305\312\355 \271\217*\2613\231\303\227\260"
+	.ascii	"\035oa\325\265\273\b\374\226\273(\310:\235x\b\365\003\304\213"
+	.ascii	"\246>\275\211\004)W\366W\234\205\307_q\210\246\305\303T\0031"
+	.ascii	"6\274\334]\023\365\204x\325\300\244`J\031\343wv\360\024#\327"
+	.ascii	"n\351\200\217\342\251\217\277r\350\b\241|\356l<\013$\2104\221"
+	.ascii	"H\206\211\032\204h\"\f\260\007Z6\202u@!l\003\300\037\b\036\020"
+	.ascii	"&\372|@X\306v\376\255\246\240~\265\\xq\242$\250*N%\360\004!r"
+	.ascii	"sU\024\333R\225U\037'\027\337jD\205j\351M\034\236FM\033\246\031"
+	.ascii	"\005\002% p\002\231J\363\355\tx\3148z#\254\310P\bFH\\,\2317\246"
+	.ascii	"\337\345!\013\030\300\r\236\022\306\032\316\342$QX\352;\356O"
+	.ascii	"\034 D}\230\013\347\243\241o\361Dc\027D\354\357\316\215\027\312"
+	.ascii	"\320\207\262\347\355\263@\354w_\351\354L\033\313k\353\tx\f"
+	.text
+	.section	.gnu.lto_updateAltHoldState.part.0.142.1fd4164eb7697821,"e",@progbits
+	.string	"(\265/\375`+"
+	.string	"\205\007"
+	.string	"2\31504PO\323\001 [ny\263Hi\252\326\303U\202\326|6\213\301"
+	.string	"#=C\246\331\271g\365\007e\243\240\321\220Y\"\352\246\271\247\330Dm\035\302\342\336r\247\024\266\246\353\340ab3S\311\251\220\200e\020$\003V-HKs\220\223\200\263\206K\2233\3134\031\331~\207\253\035S\023J\241\352\001\301PY\375p|\320!"
+	.string	"\354\b\211w\316\357n\320\321R\241\233\247\036+<\\\355\330*\r\260\354f\304\300\254G\\!\261\337i\354(z\374\211m\215\2067\333\345(\"\373\317\205\305\347ew\345\243\206|\273>\270\371\217\343l\256\357\016KFR8\316\306\237t\030@\355\256!\216;\336v\201m\002\333&\001\021"
+	.string	"N\023\030w5T\032Z!8@\024\fs\205\243\206\2608#\026uN\247\2056Sv\032"
+	.ascii	"\256=\244\260\320l\351\te\f"
+	.text
+	.section	.gnu.lto_updateSonarAltHoldState.part.0.143.1fd4164eb7697821,"e",@progbits
+	.string	"(\265/\375`,"
+	.string	"\205\007"
+	.string	"B\31505`M\323\001"
+	.string	"\231b\340Tv{B\330"
+	.string	"\243?\365Q\031$\001\321\037\023\037\3324\307\005\263\355\253\253jBT l\334R\206\225\205\224@\004G\310\356-wJ\001\256$\353\340a^\023\243\344TH\2700\004\311pQ\013\262\322\034\244$\340\254\301\322\344\3142MB\266\337\341\252\306\323\204R\250n@8$\253\034\216\017\356!,v\204\304;\347w7H9\251P\314\323\215\025\036\256jl\215\b>\273\027+\237\335\210&!\366\273\213\rA\217\357\330\276`x\263Q>\342\261\367p,<*\273+\037\265\343\333\365\301\315\177\\\006s}w(\362Q\302e2\376\242C\200iw\035\240q\307\333.\260=`\273\023\021"
+	.string	"O\023\030wuT\032_!8@\024\fs\205\243\206\2608#\026uN\247\2056Sv\032"
+	.ascii	"\256=\244\260\320l\351\te\f"
+	.text
+	.section	.gnu.lto_calculateAltHoldThrottleAdjustment.part.0.150.1fd4164eb7697821,"e",@progbits
+	.string	"(\265/\375`|\t\2252"
+	.ascii	"\nX`\023EP\236N\007s\343\r&\b6\016XzK\211\236\205\200\207\327"
+	.ascii	"\007` I\013\377>qM\bh`\f\232\243L\334\fO\b\002\305\225n[\004"
+	.ascii	"\304\300!q\200\276uKI\027J0\200@a\023\222d\357\235dJ\001 \001"
+	.ascii	"\n\001'\001f\204Y^\215\235\037+H\347{\316\327m\354\027~\245_"
+	.ascii	"\020\212\233\027m\373\224\256\366*n\305\365\332\230\207\207\007"
+	.ascii	"(ugg\267<6{r3\252\005\256\003v\266\216\312\262\217M*K\374U\206"
+	.ascii	"\245D\003\2519\347&g;\003\366\3526\322E\211\362\203\302_\237"
+	.ascii	"\353\232\346\267\177\322xkO\036c\2169\270>\365&\313u\232\241"
+	.ascii	"e\335\327\233,\233\230"
+	.string	"s[\231\274\234\363\002g\333\t;\333\355r]e\335\335\256\304\227x\365r\235J\241m\364\357\031\305M\316\031\351\354\321\203ZgW\377i\235\375\036\276tc\221\210\207-\273\376\325Y\266\177\271qxA\317\3278$Y\226\024\266\231\245y1@\233\031\016'z)\273\341\330\275\224\331\340\363\243!e8\356\360\212A\321\274\365 \035<\322\243\016\212\346,\0174l=\346\234\215\320\347]W\2465\3003\036hs\r\352\302\243\214\003>\357\257LT\2756<P\347\032D\026D\314\365\374\216A\231\367\372\270\316\360B\316\271\035L\315{\307\273\233\257\273\225\335\304\245\321\356\256j\375O\314\215i\3367\335>\306\311T\265\277\265\325\212\353b\316\266\257h\235\365w=G2#Db\003\354V\357G\373u\374\253\325j\265\337\255\033\337vj\302\267\231\360m\005\370\366\322\337V\372\333\t\376v\222\323\271#\3609w\244\277}"
+	.string	"\337>\032\336>z\236\267\001|\273"
+	.string	"\276m\204o\027\341\333\004\360m\"|{"
+	.string	"\276=\204o\013\030\336\026\302\267\203\360m |\373gx\333\207x;@\217O\335\001\360\354\340\333:\370\266\021\337.\016o\023\211\267\261\337y\017\361\355\026\337f\361\355\025\337~|\373\016o;\203\037%\265\234\311\252q2\033{E\210\347\271\337\271\327\271\230n\360\240\253\267p\206\003z\322E\377\250\2719mj\360\200\253\267\206\234M.zG\315y\212t\266\217\315.\335}\307\346T\nm"
+	.string	"$o\211\233\334\314M/\272\373\212\202s\234k\3348K\354\366\366@\337\302\325\266&\216\253\033\260-\316\037\033\201\315\373F\217M\227\035\370\243\355z\236\004\347)\245\335\371(?V\347\243\214\254\367\315\001\235\310\246\267\366^|<?\266,\322\305\371\216@\037\364\316\346\347{\036\350\207Z|\376\347\312\250\232p\303\356\023\ny\235R\013H\020\235\365\371\t\227\031\340\215<\240"
+	.ascii	"x\236\357y\bqR\234p\3145\347\234\207\367k\311!\271\363R\2642"
+	.ascii	"kr\027K\030\031\\\033\201\013\032\"\354\273\335\267\252\321\331"
+	.ascii	"\217\271\300\367F\343$0\314\372\321\366\332\373\262q\306\226"
+	.ascii	"\266"
+	.string	"'\b\350\331\370:\177\373\234I\212?|\343\017\3458\2070o\265\211_|\177\316\351\016\036\247\252Bw?9\034\250\007\2039g\tQ\376F\n)\3159C(d\361\241\375\r\253u\226\370\025|0i\343\204X!D\210h\235\305o\364\022\247\320\347\026\333\357.a\342\272\330\220\350\266%\027R\303\376\253a\314`\277\375\276\3166k\274\373\332\365\331\367?_\223H\363\216\364\240[\303\374\373\353\273\023\216I\235\372'\266\233\3613K\252d\262u\366>kFX\350\3227\324\274\377\255\342iK\205r\n\013\311\"\013\013+\213\212Hy\305\265\225\324j\265\262\264\264\222\354U\022\2042\271\325\242\270\312\032AE5\205[`)M\\%]\f\233\352)\211\202Ki\245\274\232B*UTY]\245@\262\260\232\302BRim!\237\214:\253ER\013\251\314\312\322B\032{\315\357\246\341\231\366\304+6\275S;}_"
+	.string	"{\246\361\243\035\345G\f\372(#\370\316p\347+;\2037\274c^\200\351\r|\323\234\335\234\030:\270\030d\024<\223\327Xz\005\357Y\224~\351]\2163\020\317\333B\265Jm\346\f\206\224\340\225\236H\213sH\322\037\370\004\b\036\351\223~H\216s\355\350\017P\217\177\204\341\252UM\220\246A!\007qH-\220\036\037"
+	.ascii	"\323\256\220I\2017z\003\357`\234k\323\\\364F\017#\216\320\231"
+	.ascii	"\244\350\321\346\350\346\304\324\245Y\252\345L\340\213\372K\316"
+	.ascii	"DO\340\335o\300\017=\321\273s\215y\2534\226\032\222\003^\310"
+	.ascii	"\207\200\357\371\241\037\366\t\275\200\r\027Z\025a\260\f\n)%"
+	.ascii	"\223r\032\024B\243\006\267&\307\004\254\370Q\342\273uW\321\221"
+	.ascii	"\343L\232\266'\030\200\300\250Q,'\031r\204\206D$I\nR\350\240"
+	.ascii	"\002\021\"[\347\022`G5+\031R*u\226\375\357<\243R\244\241\267"
+	.ascii	"HJ\224T_\241B\001\236\001\026\002\262>\310^\020#\350\034\232"
+	.ascii	"\013\027i\007\024\312\016\024\017 \036\235\030\353\017\3307r"
+	.ascii	"t\363M\342\017\234\363\321\303\215a\214\227\243/\020\245n\317"
+	.ascii	"\034p\227\021\025\272\037\004}\366\301B,\n\216\252\206+[a\267"
+	.ascii	"\030\021\230\367\347\342\300t\265\307\013h\275\0339]\b\rP,\350"
+	.ascii	"\204j\311\301\345h\227\254D\351\225:\224Q\336\237\003\261Cf\""
+	.ascii	"\354Fm\207\224L\332\315\r\270\360\210\306q\024T\236>\336\206"
+	.ascii	"\333H@\250$Jxj\007\330P\rdv\242\363\261{\261\033'\216\275\r\265"
+	.ascii	";\250\nb\253\222z\376\016p\307)^\323\223\333/\260r\2601\355\005"
+	.ascii	"\241U@0\211\215\236B\377\033sm=k\301.\3410\2264^y\177\237\374"
+	.ascii	"\353f\274\263\013\301\023\225]C\021t\026\004?\301(<\237A\241"
+	.ascii	"\035m*\260\227\266V\316v\320\243\013\223\3000A\031Yv\021\375"
+	.ascii	"\256a=6\305Km\300\t\034\203\334\260E\363-V\026\330\2633i-~zz"
+	.ascii	"\357\206(\027\207\034\353r\340\320D\005\346\314a\341\322vY\r"
+	.ascii	"\357\267\004\345\202\302x\t\361\025\354H\001p\326\375\216C\215"
+	.ascii	"\236\310\311\220\217\311\214*\351RV0T"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1fd4164eb7697821,"e",@progbits
+	.string	"(\265/\375`\303\0035\022"
+	.string	"v\234lG\260\230M:\022\236\271+\243\312\353E\307\214U\265\3067\341\201\347\2503h\023\b\254;\2027\342W\272-\244\255\363\341\230\032o\016\364z\310\214@:#\220Y\2170\305\234\204;\026\331\017w4,Z\235OD\273\311-SS"
+	.string	"\\"
+	.string	"Z"
+	.string	"_$\207a\030\002\365\346\370\351m\212\261\336\033\321\347Ht(\bV\006\275\270\330\363&\222\351\202[)\370\023y[\202\347\020\274\212\347V\016\034\213\201;\221\374o\245\005~E\340Wtv\236E\376\377(\bR!\177\377SN\353\242\224\322\001}(\361\277\213HH0jJ4\245\231\213%\032=\337z\373p&\322C?\253C\237J\344\260\267\r\247\322\26062\254\r\303\322\013\017-,S\205\237\241\360\255\t7#%\274L\204\223\221\020>\346\301\301\034\365\2478x\227\006\375]4\352K\211E},\242s\031\352\353\204^%\2024J\326\217\022\203\036Y\271!<j^@/\336\247\343\360\202\033\227\334\232\202\004\300\341\257\356\002\351i\345b76\274\343S\303-\372bX\364{+zA\025}^\212~\030\024\275\365D_\213\211\276V\211\276\227\245\224\376\002H\364\267\354\b"
+	.ascii	"\"\214d\210'\221\177\215Y\215&c\t\304\225\310\037\251\026\247"
+	.ascii	"a\345L\246\325\330\344\231\324n\324\017\234U\320\344\031u\217"
+	.ascii	"p\340x\261\3111\352~\313)\334\311&'I%\rM\246\331\321T\242\311"
+	.ascii	"\037\324\362\370\230\242E\363UFt\330d\223\027j\267\327#,\"4\371"
+	.ascii	"{\332H\305\323\355\270\311\201\331\300`\274\273]&\335\221\253"
+	.ascii	"\237\027\277\330\007K\2501\020\004\005[T\232r\232\003\340\002"
+	.ascii	"\241\"n\003\021\2404(\021\232h$\222\210H{\270\253\201\2255\342"
+	.ascii	"\205o\321\255\2106(>\017\213\213\210\266\233\"yI\241\367N\304"
+	.ascii	"\036\027\341gM\370\336\367\325\235\267J\261\254L \351\241\324"
+	.ascii	"{\327\351k=.S\351pU\201\306l*&\315xP\266\226C\334\017\255N^\r"
+	.ascii	"\277_\240)\2417x\261\361\310\274\234\354\201\021\223\365\255"
+	.ascii	"\350\325\007M\031\026\020j\240z\224')\376c\274X[\275F:!W\001"
+	.text
+	.section	.gnu.lto_.refs.1fd4164eb7697821,"e",@progbits
+	.string	"(\265/\375`\231"
+	.string	"u\b"
+	.string	"6\227?3`\211Z\031\003\3035\203\216$\264 "
+	.string	""
+	.string	"`\320 \b\202 \b2\305B\375\302\026\r\374\017\366;\264\241\266o\333\320W\204~\035M\210\232\210\210\210\020\231\002."
+	.string	"0"
+	.string	"3"
+	.string	"\005\2449\2407\240\325\2506\003\262\026\033\343|i\266D;A=\201Vb\332"
+	.string	"\322\020\320\222h#\321\026\264\r\317R\033rv\232\267)\257A\251i'\351\007\242D\272\207"
+	.string	"\026\363,\305\363Cd\007\310T\344G\332\231^\325aJE\033E?\324\2636<?\242=@\355\001\255\201j;\246\r'\0300\002i=\256\355\250l\206\2003\2301\225/\327\224\212#.K,G(\266\244\255*\013\271\366\241\354('*>\2237)\321DH-\252r\026\322\f5\032\216\306j6\234\273\230\261\223\022\330\03106\006j_\300\270\205\213]\341\332\024\256O\300\\B\004\213C\310\354\007\225;\310,\203\353\005\231U`\371\343\022\003"
+	.ascii	"2\306\nbP\246\203\257\301H\001"
+	.text
+	.section	.gnu.lto_.decls.1fd4164eb7697821,"e",@progbits
+	.ascii	"(\265/\375`\330;\215\f\001\252\237q\\U \nYI\215\001\302\347X"
+	.ascii	"\264\206\026\362A\003:\270\\\354#T uJ?:\006}$\224\342b\347\307"
+	.ascii	"\275\364F\365\345\346\t[B4\013/@\\\271:\203\343}\377\\,{\232"
+	.ascii	"97y\r\256\353\316\344RpO\035?gTi\314\022\241\376\377\027B\266"
+	.ascii	"\224R\246\t\005\270\005\370\005[\232\\\350U\273e\227\311}\336"
+	.ascii	"'7\311\005\273c\227\355\222\335\263\273v\227\\'\027\355*\271"
+	.ascii	"m7\354R\271f\327\312\255r\245\\(7\312\235r\305,\364\246]#\277"
+	.ascii	"G.\222\347+\203\006\023\033\307\312\341\022u\232z\342c\007\217"
+	.ascii	"-\347\214+\0363rp\365\3501f\351h\211\316\201q\326\\s6=QqZ\261"
+	.ascii	"\027h\037b\204E\323\356\217\373\205\237N\0070\345\210\212\335"
+	.ascii	"4{g\341`2*\275\306\364\026\205\272A\304E\324e\0021\205v\223)"
+	.ascii	"\215\211-Z\325\3049\343\246\335\032\276)YE\242\027\352\246\335"
+	.ascii	"\026\227\211\237m\372\t\212Zt\357\347\206\242\rKj\240p) g8\265"
+	.ascii	"+\372\367\353f]'\007n\226\035S\225\233\213\024\355\204\231\271"
+	.ascii	"\002v\363{j\372 \202\300p\336\256\353u\271,\364\022\271Bn\347"
+	.ascii	"\254\231\332\220\251K\344n\3314\013g\265\227k<\370j\263\313\262"
+	.ascii	"\241h\303\206\2359 a\330\350\374\336\227~o\210~oK\277\247\245"
+	.ascii	"/\220\016\277Z=\315\031h^7\357`i\033\265\026z\026\364l\350\367"
+	.ascii	"\\\350\247r\364\3232\372i\026\375tL?5\242\237f\351\247S\372\231"
+	.ascii	"\216~\231:\375\354Eg\300\313P\375\354\324\3177\364sS\037\257"
+	.ascii	"\321\307^\364q\232>\026\323o\343\322\207\303\241;\210\342\245"
+	.ascii	"\376u\243m\235\273-T\203\273\274\\yP(i\364\255\006=\\\247\216"
+	.ascii	"\325\240\367\033F\377\252\351\016.\023\r\202\265\320\263x=`\324"
+	.ascii	"\344`\334\374\013D\3336\326\215\205\3327v\354\271\354j\233\355"
+	.ascii	"\375\374\301\314\032^\330n\276\325\320\013\262\032z\2775t~\256"
+	.ascii	"Q\203&\312\020\265\233\377A\215Mc\001\330T\224\311\336\317\250"
+	.ascii	"\205Z5\266\356\036@\354\rE\2765T\242`r\276%\243o\325\364o\321"
+	.ascii	"\2245\311\222uv3]\357\251\207\031\230\233o\351~[\306\2329\333"
+	.ascii	"\275\332[M\267h\223\267\255\205\236\320\\\207[2\n\340\372\021"
+	.ascii	"v3\036#\306>\257\300"
+	.string	"\362n\276\025c\277X9{u\3016\325I\305\271\331\202\261p\026\212\301\206\271\215\263jO\231\317\375\264l\266\230\252n\276fZ\004{[\f=[\247\216\305\320\273W\326B/\003K\324\263o\035n\273\020\365\250\254\236;\b\250\n,\n\332\315C\226\210\013\006\337\222*=\264n\266Zz\2424\341\032s\363\t6\213\305b\335\354\025\013\265Zl\333m\025k\345\366\271ws\357};\366\304\226\001-\237{\252\227U$\212\007\236Y\024/\020k]V\215\212M\003Z\nm&9\"\316\275\237\377\360w\370=\200\260Z,\233M\303O\347f\222\253\262!\216\f\332\033\274\275\237E\033|hJ\310\370\360\311\032\254\205^j\241\364G\240\217\324\347\200\026\222b\247Xh\005\026\r/\313\202~\350\200\321\221s\363/\240o\317\236\024\267A\334\203\276\255\240g\353\330\nz\257@\027Y\013=[v-\231\205r[f\237\367"
+	.string	"\342>\315-\266\367\323\226\345\275\231\326^"
+	.string	"d\355\005\251\033\021&\224^\376\005\375\2533X\013N~\333\304\212U\200\241^\\\355\263\275\237CA\317\032R?n\376\323Z\350iK\324\373-\007\016\354\206\337\036\3756\001\277\355\340\267\003H\177,\370\263\003"
+	.string	"`\200\256\336\237\217v\352\206\376,"
+	.string	"!\024E\376s\024\f\320@\375\327Iw\302n\371\357\004\232\376[\346\277$\220\261\3059\340\2305(S\344\376\033\367_\003\024hp\303\374\027\314\035\360\347\245\377^\360\345\024\376\034\302o9\360\333\r\004\177\373\363\3713\020"
+	.string	"\023\200\270\276\313\345\245\313\205\253\344\215"
+	.string	"\017\300\2379`\303\345;\177\276\300\t\312\377+w\213\333\177\265\374\326\315=\341\004\0057\3133\374\230\314\1775\377U\361\237\354?\376\363\232\377\352\370o\217\377\362\370o\216\377\336\370\357\216\377\372h\373\357\323\177\255\376[\203\355\177\320\237\206\360\337\265\377\252\375\027\355\277g\3775\373/\331\177\227\374\367\310\177\277\376\333\365\337\255\377j\375\367\307\177\261\376\273\342\277\302\377\242\370\357\357\277\032\370/\006\376[\201\377\236\370\257\t\377\215\300\177\037\360\337\021\376+\302\177I\374\267\001\377e\300\177\021\360\337\017\376\353\341\277\030\374\267\203\377N\360\337\r\376+\301\1775\370\257\320\177\007\360_\001\374\027"
+	.ascii	"\377\275\360_\242\377\016\375\367\347\277=\377\335\371\257\357"
+	.ascii	"\277\351\177\361\177\355o\363~+\347\267p~\373\346\267v\277\365"
+	.ascii	"\362[\365\277\334o\355\377\272\337\246\371\355\231\337\232\371"
+	.ascii	"-\231\337.\375V\314o\303\374/\372\037\201\377q\277\375\362\333"
+	.ascii	".\277m\361[\343o\225~\233\364[\244\337\236\370\255\t\277\215"
+	.ascii	"\376?\363\237\356?\t\377M\374\027\363\177\313\177-\377\305\376"
+	.ascii	"o\340\377\333\177\241:u\352\324\371{ \370}h\374\033,\tdswx@S"
+	.ascii	"\372\317L\026\232\231,]n\226m\031>([Q<z\352Z\220!r\363\201\232"
+	.ascii	"\3641\035\233\367]^\3324\275\235\2764\246!\321M\365\344\360\237"
+	.ascii	";\375\2370\372\326\246\365\316\301\342<\013\305y\267.\013\355"
+	.ascii	"f\326\224\323\212\034\013\305r\254\334}n\252\017UT\233\303\177"
+	.ascii	"\306\340@1\034+&\304\326\325\216\221\341\310\2323H|\226Ny9\262"
+	.ascii	"\332\274\r~\223\227e{\t$\027f\305\301V\301\rqb7?x>x`\271\371"
+	.ascii	"?T\372>x\3728\212\327\034\2639\033l\247\367\336 \226swL\266\025"
+	.ascii	"\225\206\377m\216\355\3228$^hP\364\177\377\336fR\355\275c\244"
+	.ascii	"\317M\305\344\323\373\355mj\255\206\377\307b\213\301\336 \204"
+	.ascii	"`o\246)[w\372\b\0333\307\315\373)\334\336M\254e\b\254\252&\226"
+	.ascii	"\r(3\254\275lz-\207\2506\326\022\312l\357\241\335l.I\\\355!("
+	.ascii	"\263]\265\233\342\252\354~b-w\363j\017\355\346ff\200jbUA\231"
+	.ascii	"1\253\206\240\314\260\252\266\031\326\026\332M&U\213\346\246"
+	.ascii	"\032\332fXk\266\331U\225\020\224\331U\025\224\031\026\023\213"
+	.ascii	"\326BN\211\f)[A\242l\030\250\346\206!\245\203I%\004\007\365\274"
+	.ascii	"\332e\366\266gN\233\n\203\275u\\Q\225a\332\260mLp0\230\324\230"
+	.ascii	"W\366)\305\224u\265\233pPH\256\366F\302\244\264\245<X>\341\266"
+	.ascii	"\020\013\267\374\241c\277p\332{\202\375\334[j\357\245\335p{\357"
+	.ascii	"\345\336\333G\245\343\2717\016!(\247\224\324\336VER[\307\262"
+	.ascii	"\212\323\336\367\214\256\255\n\312,\353\252C\025)f\316\375\364"
+	.ascii	"\\Z\347.\203E\245\315\226d\373\205\235vV\311`s\363Sl\357'POI"
+	.ascii	"\327S\225\233q\232\242\237\265!\314\030Rgv\346\354v\37045`3A"
+	.ascii	">\314\032ka\344\3509Lf\347\n\007\024\246\335\034\026\343#\265"
+	.ascii	"e\312\2300X\016\303\3410\307q\307q\027\307\341:u\346\354\315"
+	.ascii	"\f\262\366\002k/\3509\0213\245\007\006\177Iae5\206\277\234\001"
+	.ascii	"\311\210\302\004\207\2277\373\005\346J\026\250\250[\007\264\263"
+	.ascii	"7\326\231.\230\013\336b\241\370\rg9>\001ky\303/n]\030]\024\277"
+	.ascii	"\341)\354\266\364\245\251\322\212\223\241G\260\234\240s\272\333"
+	.ascii	"z\270h,\2757f;\230\332\364?@\301hiQ\334\206\257p\031\005LP\331"
+	.ascii	"\212X\364\272\320q\231c\316+x\rS\301iX\rW\301l\330\212\205\342"
+	.ascii	"6\\u,\205a\264\341\035ThN7\2409\260\325\217'm\030\007\266\262"
+	.ascii	"pV\317\035\203\307\314\262\211\216\235\034gN\262(d\f\265b\250"
+	.ascii	"\242\270\251:\233\3623\345\r\007S\312\361\024\0377Ns\320n\306"
+	.ascii	"Q0\230<-\246\331\317\230\223L\026\263\272\"0\212\264\271\371"
+	.ascii	"=O\232,\350\312\022\354\206\034\375\017O\260\217\2601\374\264"
+	.ascii	"P\374\004c\035\363\300=^$\366\004ga1\013g%\264\233ul\321\236"
+	.ascii	"-MV\304z\031\213a/\034\006\264\034\332[\013\255\tvb\241X\354"
+	.ascii	"b\370\007\356\262pg#(Y\213\201$kL/3\301`\026\212\303\360\222"
+	.ascii	"\242\347\336j\037\214`%wN\302p\021\374E\001\023\324\bX\240Q}"
+	.ascii	"e\b\026!j\224$\371i\301v\204\314\021\214\204\207\206\025\034"
+	.ascii	"\0269\375\0379\214\257\2467.O\203\235\257\313\\]j8q\323\347Y"
+	.ascii	"\323\347A\323\270\013ka!\026\356\214D\0275.L\304Bq\027\036\362"
+	.ascii	"\374\334\373\254\013\003\351iQ\345H\033P\221#M\234\364\362y~"
+	.ascii	"\350\274\2449\305\013\336\302A\366\317O\335\0167$7\237\007\207"
+	.ascii	">\217\f}\236(}\236'\375\035:\372;l\364w\350\364w\344\264-\342"
+	.ascii	"\242\277SE\177\347L\177\207L\177\207\t\266A\303\210\223+\032"
+	.ascii	"Ct\r\032C\260\270\270f\034\323x\235\017\005\024\300\340jr\363"
+	.ascii	"\333`\031<nbl\301\3012p\2143a\304\340\335\f\3051p\325\377m\247"
+	.ascii	"0\231L7\177\347J\177\347\206\376\016\r\235\237g;R\372:O\377\330"
+	.ascii	"\005n\362Q\023D\f\017\027l\270D\337P\031s\263v\241\326\2749\341"
+	.ascii	"\026x\343%n\342'\f\205\231n\035\314\264P\334t\363~\351\334&+"
+	.ascii	"ml\032\033\336\215\243\346\234c\323\200\360\336<\320\356\024"
+	.ascii	"\020\246%\212\233\256\335eZ\270\255\020b[\242 p\323\225c\323"
+	.ascii	"|B\276\264\342\004\2151s\346\205\004\031H\247\351\3531}\355\245"
+	.ascii	"/\234\\\303\013\020\257\233\257\265\364\365\r}\335B\337\207\247"
+	.ascii	"\357\243\323\367i\321\367A\365}N\364}_Q57\212\013\246\215\233"
+	.ascii	"\325\\\250[w}\332\3468\325\270\371\236\271h,\364n7\315N\363\271"
+	.ascii	"\315\204\234\260\024\"D\257\360\335\255\347cF\303\017\2349&&"
+	.ascii	"e\344z\320\234vkd\3466\340i\225\335|\307`\340aK\263\252\272\371"
+	.ascii	">\031\232\313\205\333^l\321\033g\241W\356\312\335\023\356\026"
+	.ascii	"\013\267\225\303\240Q\f\0332\032^\026\227^\276U\353B\305y\303"
+	.ascii	"\334/\026z\341~\337\254\034P\272\367\325\232s\357\rw\275X9 \346"
+	.ascii	"sS\361\by\276\271\303\333{#\307\200\310i\243\337S\243\337;\243"
+	.ascii	"\337\023\243\177\267\3309\276\030X\310\254\334l\343:\374j\301"
+	.ascii	"mY\234\346\300\351\336u\323@7\257\244\211a\271\362\244n\207\213"
+	.ascii	"\233\377{\345\246I\275p\246\211\243c\210s\207\020\033V^W\n\032"
+	.ascii	"u\242\032s^\034]\3219y\0017\247W\356\346{\373\222\325\243(Z\245"
+	.ascii	".\250I\030\255f\332\226\361\330x\274\355\270y\355_\303vV\350"
+	.ascii	"\311\204\206N\224\247i\b\024-,jj9\256W\244\212V\234\246Z\226"
+	.ascii	"\253144lWt\204\352\315\235f\363\024rEK\212\224\364l\001\314 "
+	.ascii	"xLpX\213\271\036\351\224\247g?m\242\300\215\241\37125'\016\017"
+	.ascii	"(PR3[$k\216\027\246\324l\347\353H\326\213\233_\324\004{\372\004"
+	.ascii	",%\263m\354s\017\240\007\027:Z\3606\224\016\rIZ=\272\244\317"
+	.ascii	"\247d\357R'J\033V\352\344\351\030\2311oej:m\362T,\207\2143H\246"
+	.ascii	"\350?\r\333\352\362\205\r\231\376\205\260$I\322%\025\300\342"
+	.ascii	"\344P\001\311i\271\210J\225<]\302\224\244\213J\031&i\306\334"
+	.ascii	"\270\371\027`\0349\222vihb%\b\036^~\223e\b\215</\257\364\253"
+	.ascii	"\350j\271&\203$1\336\314\300\3439\241\013\214\323\371\364\253"
+	.ascii	"\256\231\244*\315\315i\221\251'\233\350\255\353\231A\342\343"
+	.ascii	"\t\213\376\220tH\332e\313\366T\002\342\202\3401\331\333J\203"
+	.ascii	"\217m\207S*\345z\332\305\274C\334\330\340\360\030\2373XQqe[\351"
+	.ascii	"\026F\023\342l3\2534\270a\331\305\030\"\002\267\344\346KP\245"
+	.ascii	"\245e\313\362\223+*-\034:\264QA\345\375H\177\340\272\274\304"
+	.ascii	"k\343\261\302\352\341d&\316S\246\264\231\306I\2610\224\325\226"
+	.ascii	"\261A\315\232,\206\007\020!7\373x\026\371\242n\244\235u\321\267"
+	.ascii	"bN)T\2312-\322'10\321\017Q\251\224\222.\321t*\265\261\206&\332"
+	.ascii	"!\315\201\201\244O_\234;\322\253\264G\252#\305\221\362\260\320"
+	.ascii	"4G\n\343i3mzQ\232#u\341e\256M\0218\240\354\3644ct\251\215\224"
+	.ascii	"*\255\321C\305\310\231/V\351\r\013Mm\274h\003\206\0379f\360\306"
+	.ascii	"z5R\032m.r<\335\234\316\260foQ?\270bXh*\343AOF\362\274nN\253"
+	.ascii	"\236&\267X\272\210r\3134\2524\361\262\245o\001K\337\002\215\364"
+	.ascii	"\205\036\023\335aaJ\337B\224\276\005'}\013K\375\247P\351Sj\306"
+	.ascii	"\345\356K\372d\323\344\274\274`\312\323W\203%\352\245;ef7amZ"
+	.ascii	"i7?]F`\b\230\264\233s\235\373V\304)E\007\250\214\027\224,/M\253"
+	.ascii	"sw\343\346<G;UP\243\001\317\216\265\0369n~\236\363g2\327\306"
+	.ascii	"\007\352\344\275\271\371\322ux\226\363%K\364\311\t\372\026\314"
+	.ascii	"\346\271\3477s\031O\203\325\322.\303W\225\016\016=rbHay\212\355"
+	.ascii	"P\362\206\355\346l\227\333d7\377\316\316\225\027r:\330\364\363"
+	.ascii	"\035\317V\034\221$7_{\267^^\363\314\346\337\361\211Q5\241h\372"
+	.ascii	"YM\216\346u\271\322\342\346W(\323\317u#8\343\003\354\346\234"
+	.ascii	"F;U8\242\301\016]Y\232\234&\243y\221\303J\315\315\231.\237yF"
+	.ascii	"\223\315\354\214\306\203\253\275\231\031MP\016\313*\202\326\313"
+	.ascii	"\257\340\2453\231\016\317en\221\263\267\267\233\177*Li1br\334"
+	.ascii	"\b\333L\031'\217\0255O\265<\035&L"
+	.string	"\216\243\340\364I\021\362\026\355\325\220\262\226\345\346\034w{Mc[`e\364s\027\233\277\2009[S\331\0067\210\300\350\023ay{\373\212\242e\313\255\313\373l3e\\@\203\214\bL\237\210+K\026\374%\247\315\375\203\210\223g\354\311\tT\200`\301b\323\246x\232\342\302\224\370\300!\203C\264l\273\205\346\266lE3A\351\335\034\253\213\202\351\341\005\354\346\\%\355QC\311\2268\372\024\332\250\335B\263Z^\313\314\2640Zq\360nt\314\02207g*<3\330\264y\312\351SPCC;[\2103\275t\212\211\365\250\315\251\321y\236Yh>\273j\232mN\364N\243\002\005\223\"\345n!\316\3646c\322$\272\023\365\245D\f\02133\214\246\212'\310\325\233;k\305\207\030\005,\375\374\304f\262\262\263eh\n\355\250'&\316\034\372\024b4\261\331\311\330\331\364\222J\002\027S\212D)\300\320\247"
+	.ascii	"\245\317v\353\345M\01337?/\261\031,/\311a\230N/\251tZ\220\255"
+	.ascii	"\350\020\034\375\2412\372\026\323\3652\222\214$+)\262\013\343"
+	.ascii	"C\325T\304"
+	.string	"+\311\263\222\213\271E\341`\272\237\333\020<*F,4\033\271s\231Y\266\227AiWo\356\272\270\2611e\246\271\270\262s\204\n[\252\314\335\341\205M\221\361*\362\354\264eR\242t8\263\327sL]\217\354\225\211\340\310b\266\274c\322\251:I\2327w\035\303\317\334\232(g\272\204d!\227\031b\353\212\311\314 I\214 x7I\230Y\327\315\037\322\021$\210M\013au\265d\223\241\211\221 x)\226\2337`k\200@3\220{E3A]1\263<"
+	.ascii	"3\242\305\006oo-\034t\323\223)0Sv\344\254"
+	.string	"\035\031\213\007\217\214\225\301\233\217\271;<\335D\356\356\354\372x\306\272@ud\242T7\347\253['\007\313k\313\315\271\307\331\202\326\310\312p\235\315&Y\003C\273\371B?\364\203\342\334\3109n\340\3001\246\313\351t6\206I\234~\020\024\032\331\006\215\\#\327\300vzYT\345k\356\016\017[Q\002\026\305\251\037TC\206\f\\\027\302j/\327l\230Z3w\207\207\347\236v|\271\371A[O\345\252)l\327\333\333>\257\246\2502\3253\025\266\263\233jo\253\005@\211\023\335VV\032\200\200p\021#\304N\037\b\214\0244K\3314\013\304\026\225\243\244\234PZ\264\270u#lf\214\fG\226B\236\236n]\2103\022F\350\242\233\312\212\303\317\333\tY|\350s\260\271)7\335\272\374\334U<R\001B\242q\204\225(\"\2518\264\200\b\026V\240\221\210\224\026\207@\344\216J\f\262XB\032\221\220\352\021"
+	.ascii	"\026\226\224&\212\306\241rix\301\247\256*\021\211bH\004"
+	.string	"\216H\0161\020\201\301\344:Dq\244,&q\260BY\034\0229\360\340\203\337\007 \2548R\205Jb\2608<B&\225GG*\214H\245\325X\364!\001Ub^\223Ec0EZ\213C$\261\027\f\241\002%N\214\020\361\013\201\204\004H\370\2150\341g\242\304PQ\025RZ\201KGE\343\322\22218\001\211\037\021T\"\n`r(\034\272\222\021\004N\2240q\264\252IH\340\232\301\003A#q\204\2124\216\bJ1\\\203\"\222@\013\2608\032G\020\255W2:*\215\310\244\037\020\t<\036e\260\252\311\236\"\322M\223\277\244b\3221-&\035\261\372\201a2\2638\032\203\031\271\036\361\177X \327\3440I5\341wA\250\026\223\206D\240O\250&\225\271h\034\256A5\351;p\005\n\221\277\244\243\021\020\022\250\024\314\277UM\252&$\035-\030Z\325\244\n\272\003#!\321\370\313\200q\210\004V"
+	.string	"\250\247\203\321\232\004\022\177\322+\031\035\t\211C%\nUh$!I\211B\025\356\254y\035!\201J\004\006M\020\325\n\214XR\232\b\006\201=KJ\023\301 \220\247\347\301h%\212\b\006\201\232\250\246\300\037\214\210j\212\024\310\003\243\023I\245q\230BE\036\205B\230@'\205H\240\212\242\n#\211\244\3420\b\024aM*\221J'\222\303\013A\277\2422\311s%\243\340Q\020\351B\tkQE\"\225\301!\fDlp\001X4\232\260\200\202\272\002W\023\302\243\022\203\005\237\016\214V$\360hD\224\"hU\223=kQ]Z\223\312\016\bE"
+	.ascii	"1\370D\b\325\025\2704\\\223\352\220\260\b\\Z\332\021\002a$T\223"
+	.ascii	"\212@\245\021\311!\205\022,\326a\320HT+\2004\"\221*\020\0218"
+	.ascii	"\\\207\305"
+	.string	"!\321\225\214V \217V \211\200+\220D\020\331[\227\3245\311\302\304\205\007\205D\343\b+Q\004\322\270\032\221\303\225\250$\201\005\361x\004J\360\340\020\251\026\325$}\017>\340\340\003\020V\370\016\002\002:@@\007\275\203\200\200\016\035\020\360A\007\375\017:\340u\375%)\240\325\237\260\304\n#\n\237\372K&\001\211\"\250B#\tC\311_o\275\222\321\006#\210\312 \021\030\334Y\223\277\341\321\004\222JB=\2628\361+Q\202\211\0365X\004\256\311\342P\257?\t\224\310\305a\t\305d\2607<&\261\022\305\321\020)\304\220\374\215\360P\242g\204\207\022;=_\320\303\020+\177:\371#\221T\242\350\361\245P\205I%\212\336zT\352uE\002\327\244F\256%\004\213J\021\216\022H\376R\250$v\216\312\337\252&\365R\250B\274\022E\030\221\300\006\370T\244\362\270\244\236\270\222\321Q\022iL\026\325d"
+	.ascii	"\220\352\252.%\225(\202\326_\022\360\204q\350+&\203\277\3411"
+	.ascii	"\351\243\006\207)TaP2\251\"\205B\340"
+	.string	"/\350a(\244\"\201*\204H\240\322\317ZT\032\203?\225x\\\002&\207\324\344\320X\004\"\252)\220\202?#\022\210\242g\375y\370\260\376\222H\225\250\fa\005Z\270\222\221riH$\032\221Y)\270\016\217\251\n \013\234T\225D`\212\236\n \022'\177*q\210dD\226 \034\036}\326+\031\t\207\307\"\0226\371\003A8<\366J\260%\254px\304<\037P\372!\035\211>\037P\002BB2\256\312\340O)\270\032\213\024\324#\213\365\207TW\342\020\3517\264\026\325 R-\241\204\243RX\034Z\340B\217\n \006\226\224&\204\303#P1YT\217K\306\021\302a\t+\020E\n\242\342\220\204U\204px\024\022\021\304b\035\246\030\256\303dQ5ATS\250D\2415\250\"!\021\251B\343\322oE\252\307\025\352o%\016\327_\321\370\201!\322\250TtB%\256\253\021\251tB\202\342\020\350"
+	.string	"\244q\005\"\325a\005\343p\005\232\260\002HTM\240\240Z\300\304\022R]\205D&\250"
+	.ascii	"\262\030Z\207KC\b\020\325`P\004\2200I(\251\"\225\326\337Z\034"
+	.ascii	"\032\217\253\232,R\227\206+\217f\001$\252\302\036\225\230T\004"
+	.ascii	"VPW \362"
+	.string	"G\244\376L\030!\034\036)\260@\252)\214A\025\371SJ\002\221A\240+U\240\026\201\304#r\b\024Z\211\300_Rq\250B\250\256\030\"M\260\376>\350\260\026\207\276+\031%\203\310\243\340\215G\025y\264\032\215\310\243\236\344/i\210T4\216H\216\b\")h\037a\021\210B\bT\205C\353\017\204\2658T\372~\200\003\214\310@\201\b8@\007\215T\241r\035\256D\340\321\252\2244$\"\035\025\207\300\245\243 2ydD\201\232T\004*\005\177k\022\210\364\023\022\215J\277\225\b\254@4\032\033\360K\205j\022\251\246P\221?\242\021\271\026\215\301\237\n \213\nO\353\322:l\347\201\223\252\271;<\f[?1\222)L\346\320\220\371\244\340\255\3058\223~\211\221Y\243\242\263\202F\314\335\362\346\347\263\247\215\007tF\231\265\235\267;/.d0\032\r\255\203\213\232\313q/\2568Y2\306\254\001l^"
+	.ascii	"\021\223\236\225\271\002\362B\016\323u)\233\303\226\206!\023"
+	.ascii	"\362\241\273\243R\024\347\314\323\254\202\325\022\030`2\326\211"
+	.ascii	"'sy_\322.\240\032;\340hx\271\314\236\215&9i]\322%?k\302\334t"
+	.ascii	"\275\331e\350\215\255,.@\276\326\232\334\374\024\233\232\342"
+	.ascii	"\272\322\202\337\304\361X\003wsj%\265\222f\261Tl\n\360$\316j"
+	.ascii	"\206\206?u{\232\345n\251\023\232\273\270\233S,w\323r\240O\304"
+	.ascii	"\004\205\022\250\343B\264yD\331r\2161\206\024I\2116I\032\003"
+	.ascii	"\003\024@@pT0\231\215\3279\037\023@\225\b\344\241\034\245\n\021"
+	.ascii	"\311\210HA\222\244\316\262\035\274+\345\245\002\331q\037,p\233"
+	.ascii	"\302\311\260\332:\212\372\371"
+	.ascii	"k\235{n\301\034\202]\252\264\030\354\320\302$m\330\003\026p\361"
+	.ascii	";\251\233\035\206\310\334U\301F\352\211\027\363\002A\036\254"
+	.ascii	"\300J+\177\230\265\342\n\253m\177\332/"
+	.string	"D^4\240\2426+f\005j\320KH/\005.J:\261\356~\242\210\263\350H \361\377/\3327X\322\326\213RD\262M\314\244{4G\312\tC\343e\313\265\315\271\236i\350Q\222\031@\323;\211\332\013\374\321U\263\212\331\35064\276Q\3372\376\303\024\202\207R!\214m\233\340\354\237\024\202O*S&\234u\005\243\311\364\370J\353\004TRb?\323\"(8\252\022\345\004\373(\2621\203?\024D\353\353\326\211n\220v8x\261\225X\005\332_k\266\013u\244@\"\333}s\206\022\030\310\216Z\340\220\031w\037z\203K\357\336\026Y\217\353\270\326\204[\013\327~B4\340\330\340\026\305\260_TB\374\205\246\f\241\005\223\203\371<\027\330e\021\335)\t|\361E\223t \210\303\017\347,\340\214\277\323YLRH\216_\374A\\\323wB\"\311\0304\224:\036\023\271\035\006\303\312mN\253Y \337\220m"
+	.ascii	"UofF"
+	.string	"/\252\206q\277p\r\030\204\213I\t\316aL;]\364\334!\355\266\021\252phG\262\241\230Q(d\002\300\255\235 \016\344\252\321pJ\256\272\345\201\217xw<s\267\320a\302Df\251\273 \004%\244%\322R\370\220\202\247\212\312\030\202\247\300\\x\0258\337\230B\335\250\320\0244\243\224?d\321\326\2776\317\206\325\226hX\224\225\226[  \001#Ij\2626\036\226\337\336,=\253\207'\036\254t\210)\366g\024m\002\371[V1\352\f\351\365N\333,\236I\304\251oJ\346\224\332O\301\233Ss\317\235\034k\217\202\307\265?\004r\332\007\370\230kV@\243\325\307\321\016\375AY\302?>\261g\001j\371\367\273\227\207\fB\227 \372)o\221U\232\305KGU\350\354 \310\261\210\321\373\326\2513\377o\207\243Fw\247\346\363\326a\f\247\375Q\212\266\347IG\r\326P\324\326\354\251\265\370\007\347\360'"
+	.ascii	"*\303\227;\233j\007\216,\023\0201\375\231\346P\204h\255\036\376"
+	.ascii	"\337\262\261i\b\3044)\013J=\201xLHP\3273\226\343\231\003_v\233"
+	.ascii	"\246\313:\220;u&\366pB\267\025um\233\220\016\nJ\232na\3359\353"
+	.ascii	"\376\325\357J\t\253t\256\260$\2538/\357\0224\307\340\006U*\262"
+	.ascii	"\335-\222\035{.\001\307u\np\212lGn\236\243\223d\b|bX) \024\266"
+	.ascii	"\002\266\245\003\333\027\205X\207(\b-Dt\354\233\025\310\227c"
+	.ascii	"6\227)\215k\300_VDA<\036\376\353\313\f\254\243\226\"mS\273\021"
+	.ascii	"\211\r%n\212\352X\302\222\304\3623\035Q)K\325\\\226~#\321\201"
+	.ascii	"\245NO\260.F\344\236V\266Oa\200\326\376\341\364]jY\204\301\340"
+	.ascii	"&)\323v\232\226s\234\307\031*E\256\277\340R\322\017}\250\246"
+	.ascii	"7\354\002\226\373^\202\026\367\304ta\034\306\270\027\027\311"
+	.ascii	"\312C\360\373\217\350\350\357\205Q\354\013\033\021\013n7\326"
+	.ascii	"\200\316\022\301?\240\342\"\332\372\216=\231\343\354\362\363"
+	.ascii	"\306!$\254\203\365\224\267W\200`\030V\273\230\352\337\244gF\251"
+	.ascii	"(\225:\371\013\205y\264\317\251\r\th\007\030\025\321\r\376\""
+	.ascii	"\301\352k\022j\372p\3207\300+\005@\320)\264I\t\356"
+	.string	"\211\211\230\222O\243\351B\220\3556\b\347\335\364\"^mo0Q\271\373\236@\001\2110\332gr\323\2445b\023\375\317\034\376p\215\363\213\205*\252\3556\0019\320P\202\001\203\200\n\210\241\2215\275\251k\226\234\002A\177u\347\023\207\362\257\300\314\341\273-\271+\003\222D\177\177\324,\344\001\317\027\202\335\326\312\207q\007\371\244|[\254\260\201$\326\244\026I\006o\310\003\310=\377t\207\250\273\240\211X\223_lY\346v\001\252B\306\005*^\017*Y[\022g\232\234\370>\220\024\027\252z\026\"a6\341K\230h\270\016d\\\331\027\177z\206\034\200E\022\031\026Xk\377\373iU\266{\242\r\232\301\267!\202j\306\221\363eh\013J7_\300\333\2739X@\244y\261\032\272\240I8\026_E\265\222\330\300\026\271<\275\220\034\177\336\335\365K\036r\250\243\311\231\327)\350:\234\202\305\023\267\242`M\260\335\262"
+	.ascii	"\225\002(\327\347\023\007\260\251\237\365\254\212\365k\3166T"
+	.ascii	"eK\250\300i\241\3278\371\203\354\210\265\373\204\327\356\233"
+	.ascii	"E9\214\246\314Vh\201\315\340\334\274'\\\r\350\320\364\224\204"
+	.ascii	"h\214X\220\\\024\226\306u]\355\242\264\t\026\240:\\\211\235\246"
+	.ascii	"\250\036F} \327\330\223\257\337\376ve\355\006\201mXl\247`P0)"
+	.ascii	"\036\371\233&N\034\362W*>86\263&&\354\374j\372\362\341\275+\345"
+	.ascii	"\261?\347e\336L\333\ti\311\271\231\330i\243\361\bz\351\205\336"
+	.ascii	"\313\214(\016\241=\301\202Ve\255`Z\245\265\236\220m\035\226\""
+	.ascii	"\361\210\214\245\236:=\354\263h\365\263X\025\342E\007z9[\250"
+	.ascii	"\330\277a\273\032\001X[y\031P\022\361u\210W+\323\001\241\234"
+	.ascii	"\350\217j\\K\302J\344\236J$\263D@A\177\016\324%\371\377S`\320"
+	.ascii	"\230\302y\357\242\373\2223H#\204]FW\004\222_\203\333"
+	.string	"\277\232\030(\331\020T\343\227\210\230\327\240n\266\343y>\343\033X=\217\016\034\314\331\262\022\317\005\007\\Lh\177\216\324\300\273X\362\032J\276\274=\361\326\277$\240b=^\005m4{[2h\241\f\255\2622;\300\007f\256\203\222Z\251\027F\235\332\2211\311*\307\024S\304s\326X\220<\030\305\207V$\271\006\366,\370\2035\002\267=\264\332\237\243m\rv\241\227e\020c\226A\325\243\224w\262\300\356A\315O\177\361\360\036\334\244.:s r\330\212\300\266l6\025-\203E|\232\373\030\023~^\321\352.OY\315\277\205\024o\236\250cX\0173\030\263\336\260\372J<\342~\252\275qq\275Q\211N5\247\216\312}f3J,P\300\376\260\262\307|\337\220\f\312\203\020\277i\223=7@\377\240s\363\370\266\"ZG\271\247.`\026\375\316:\361\342\216\203N\253\305\026\322\204\3431\320\360/\261\227I"
+	.string	"\212\241A"
+	.ascii	"a\002\344\202\312W!\200i)\346\315?\256\332\320\222Em\311\212"
+	.ascii	"[\r\027V\310\322\312\314\361\321\2623\022\201:\254\\\376\035"
+	.ascii	"\017hg\tF\255\271\333\370\004\030\005\325`\245\242\024s\254\026"
+	.ascii	"\340\373\347\255.got\225\373bO\320\023\372\323#b\346\2134\363"
+	.ascii	"\272i\026\243 \227\305x\026\021\\\204\366\032M|\024\275z\317"
+	.ascii	"\230\013#t\272\245R\377\360\233\220Oi\354\364\375\301S<W\272"
+	.ascii	"pU\344Z\337N\003\264I\360oJ\212\232\327\312\b\335\205`NV\005"
+	.ascii	"Lv3\003g`\323\354GI(\332T\330kE\020\301?\376>\365\1772\220\325"
+	.ascii	"j\226 \235?\316\304X?-\234x\0316>\325\233\254\033{\201\314=\244"
+	.ascii	"\227\1772\214\302\001b\022}\277\177\333\317\250\233\273>Y\320"
+	.ascii	"G\271\342\304\332\257g\235s\212*\235\374\222;\f\332\024\206\333"
+	.ascii	"\354\033\361\347\306\320\225\220\266X_\007\351\037%\370^y\335"
+	.ascii	"\353t\3713\317a4\t\253?\366\331\224\3678l\262\276WddK\362\002"
+	.ascii	"\330\001\231\301\207\307Q\200\371<\225Z\006G*\3300+S\231\233"
+	.ascii	"{\233\200\205\325\335|\341@+\270\005\377w\326\355\233"
+	.string	"M\243N\275\037\2352\360\004\177\346\351\275\356\020$\215\241\357\227P\364\036\001\270)\335\341IFh\307\346\335\260\270\371\211\201\336\002f\307\240\276\326\352\r"
+	.string	"\221@\302\275\f>X\306\360+\241v\204\363\34377D\247\217\360}\337\013o\243\300\223\001\236;\225cP\270\304m\350\302{\016\005\373\210\251\001p\204f\232\2150\036o\030Y\272\200>\242\2764\366\236\362*\302\234b(\022\352\361\347\306\2237F\005D\305\370Y\365.\2635\024\232\277\217\246|._y\210\"\fgh\333\334\355\224\016%\216\247<hM@C\331\002\221\243/\301I\242\277"
+	.string	"\277Z\204\234\374\226\315\3442\277\261\354\246m\314\312\216\253\330\377d \364\312\fD\277X/\232P\031\332\353\303n\225\270\007K9\333\206N\234z\027\214\234\355\316\241\234b\341<\f\212fF\366\031\002\316\367\237\351\bc\234a)\352\376\007\030\264>\216\332\355\314\332\330!\364G\242V\004\016\327`\322i}\342\341\353D\334\301iz8\00382gqsE\233\001\030&\224\256\321@G\f\377\327\244\237>F\354\344\233\316T\320\013\215\373c\272/\264\034\375E\275Qv\334\316"
+	.ascii	"\3355\274)\2003Z\253q|\366=*6\374\013=Lk\246\351\271\377\307"
+	.ascii	"0\366c\274\347K}4\234o\276\377\306e\2661\352\226\f\023\273;\304"
+	.ascii	"3\270v\257p\270\003\234\321\350\0311\337\017\362\273u\225\246"
+	.ascii	"\335[\233\305\357\302sH\256\327\256R\034\342 \244\303\323\373"
+	.ascii	"BovK\257\311\325\203\357\220r\332\343\345\355\225\017\241\333"
+	.ascii	"\316>\002.3\007\020\353\205\365\356\330t\367\370\305v\331G\262"
+	.ascii	"\211\243\2703\362W\002G\222\333Drr\300\317\200\177\234\366M{"
+	.ascii	"\260\303\352\260\3646\036\004\203\241\343\2546\350Z\307I\376"
+	.ascii	"/~K\025ks\257<\231\336A\250\013/\016\254S\260cL\200\361\376\275"
+	.ascii	"\341x\313\233C\360\3569\002\376m\254\317\217\017AZ\n\034\331"
+	.ascii	"\362\022\177\376\315\253\351<mw\343\037''mk\200\312E\304\374"
+	.ascii	"f\347\230r\t\332\207h)\\\306\330b\367A\216c\314c\345\216_\367"
+	.ascii	"Q8\353\377$\230D\214\237N\304\226\370-\005\277\216P\202E\322"
+	.ascii	"\005M\245\333\247\261w\021"
+	.text
+	.section	.gnu.lto_.symtab.1fd4164eb7697821,"e",@progbits
+	.string	"AltHold"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\002"
+	.string	""
+	.string	"airplaneConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\002"
+	.string	""
+	.string	"applyAltHold"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"updateAltHoldState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\002"
+	.string	""
+	.string	"updateSonarAltHoldState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\002"
+	.string	""
+	.string	"isThrustFacingDownwards"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\002"
+	.string	""
+	.string	"calculateAltHoldThrottleAdjustment"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\002"
+	.string	""
+	.string	"calculateEstimatedAltitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\002"
+	.string	""
+	.string	"getEstimatedAltitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\002"
+	.string	""
+	.string	"getEstimatedVario"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\002"
+	.string	""
+	.string	"pgResetTemplate_airplaneConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\002"
+	.string	""
+	.string	"airplaneConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\002"
+	.string	""
+	.string	"airplaneConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\002"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\002"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\001"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\002"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\002"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\002"
+	.string	""
+	.string	"accTimeSum"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\002"
+	.string	""
+	.string	"accSumCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\002"
+	.string	""
+	.string	"accSum"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\002"
+	.string	""
+	.string	"accVelScale"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\002"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\002"
+	.string	""
+	.string	"baro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\002"
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\002"
+	.string	""
+	.string	"applyDeadband"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\002"
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\002"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\002"
+	.string	""
+	.string	"isBaroCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\002"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\002"
+	.string	""
+	.string	"imuResetAccelerationSum"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\002"
+	.string	""
+	.string	"baroCalculateAltitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\002"
+	.string	""
+	.string	"performBaroCalibrationCycle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1fd4164eb7697821,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
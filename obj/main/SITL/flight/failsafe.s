@@ -0,0 +1,1026 @@
+	.file	"failsafe.c"
+	.section	.gnu.lto_.profile.ff053d487fa8877e,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.ff053d487fa8877e,"e",@progbits
+	.string	"(\265/\375`\270"
+	.string	"-\b"
+	.string	"\324\n\254\001"
+	.string	"\025"
+	.string	"\342\312\307h\f\002"
+	.string	"\002\001\002\002\002\001\002\003\002\004\002\005\002\001\002\006\001\240\342\234\212\n\002\003\364\272\233\034\002\002\007\002\001\004\221\313\372\347\006J\002\003\002\002\001\002\b\b\002\t\002\006\002\n"
+	.string	"\002\001\b\255\200\342\340\013\024\005\007\002\001\t\345\227\312\267\013\004\n\236\233\221\355\007\002\013\324\210\217\002\002\f\353\262\334\316\001\r\302\327\301\252\013\016\337\246\213\313\r\017\370\264\244\335\020\215\210\305\275\016\007\002\001\021\265\272\243\371\022\304\221\346\213\006\b\007\002\001\023\353\303\321\231\004\024\353\210\377\210\006\025\302\275\376\223\017\026\027\240\342\234\212\n"
+	.string	"' \200\002\252\241\365}\311Gqo\020\3005\0016\3170\312<VK\324\212\245x\257 +\320f\201\031pc\321\231@\346\224\221\260\264\360(\300\r\301\001,\245\341\033A\200Cg\260\340\200\203\221\303! \200\261\200)"
+	.string	")"
+	.ascii	" \262.\211\333\266\342fz<\212\351\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.ff053d487fa8877e,"e",@progbits
+	.string	"(\265/\375 }\265\002"
+	.string	"\264\003q"
+	.string	"\017"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001"
+	.string	"\001\004"
+	.string	""
+	.string	"\b"
+	.string	"\001\t"
+	.string	"\001\n"
+	.string	"\003\013"
+	.string	"\003\f"
+	.string	"\003\r"
+	.string	"\001\016"
+	.string	"\003\017\001\001\020"
+	.string	"\001"
+	.string	""
+	.string	"\021"
+	.string	""
+	.string	"\022"
+	.string	"\001\023"
+	.string	"\001"
+	.string	"\001"
+	.string	"\013"
+	.string	"/1@\230IE\203p?\r\277\f\313U\334<"
+	.ascii	"\006\2744\005\003,"
+	.text
+	.section	.gnu.lto_.inline.ff053d487fa8877e,"e",@progbits
+	.string	"(\265/\375`\016\002\005\t"
+	.string	"\242\313&.\200\251i\f\230\246\021\002\007\003L\2318\254g8o\216i\364\240\341L\r\214F\372\t\013\230\201y\031d\333\250\221%{\233\265f\267\2242\005\3777\244X\322\241!A\202Y\242\225Z\354\256st\233\262U2\242b\001\301\035\371\261\t\350\237\251\37681?\016\244qOo\217M\215\037\224N\236\035S\f\020otl8\272\277QI\257\353\262\226\017H\202\214\007\006\204\020H\205\001\214\013<\230=J\231\217\224Z\372\350\362?\317\227\273\273\313SY\355n\224\217"
+	.string	"Y\260\273\320?k\0069 \200\"\0325\344\001y\302\322{\003\353V\340S\312ar\320\2600I\334\235\324I\330 lz\230F\260f\320=S\223\r\343\305\324*@^\020\277\274Y\b\"\343`\276\306\r\362H2\223\342\220\2742\0260\267\200\016D\346O\370\354\016\330\016\"\"0ul\230\206\304/\230s\260$\254+L\367"
+	.ascii	"\327\t^Xq(\220K@\304\033P\206\363\017\262K\037\373\002]\277\366"
+	.ascii	"\214\321b\240\310\017\312+\300\020"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ff053d487fa8877e,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"-\004"
+	.string	"\202\006\024\036\240'\351\377\377\237h:"
+	.string	""
+	.string	"'B\343\223\372\377\177o\231\331\177z\373\344\223dl\"e\n\377\007.\270\341\277\360\023N\023\204D?x\301\007\376<\340\2177\223\222\301\366\251J\333r\025*\330\246Duw\\\344y\3150^\343\206\021QZt#\025"
+	.ascii	"P\263\221\250\te\352&O\230\001R\2478\217\201\006\275R\221T#\244"
+	.ascii	"\004\240\231A\200Yq-\200\\p\003\332\335\024\206\363\234\234}"
+	.ascii	"[\226\200\001\026"
+	.text
+	.section	.gnu.lto_.pureconst.ff053d487fa8877e,"e",@progbits
+	.string	"(\265/\375 2\221\001"
+	.string	"."
+	.string	""
+	.string	""
+	.string	"\017"
+	.ascii	"\230\004\003\230\004\004\270\004\b\230\004\t\230\004\n\204\004"
+	.ascii	"\013\204\004\f\204\004\r\230\004\016\204\004\017\230\004\020"
+	.ascii	"\230\004\021\230\004\022\230\004\023\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.ff053d487fa8877e,"e",@progbits
+	.string	"(\265/\375`u"
+	.string	"\265\004"
+	.ascii	"rE\016\023\2407\035\377\377\377\343X\353MKo\177\377\013\322\244"
+	.ascii	"L\001\377\317C=\036\233\225\nb\270\242\360\r\006\256A\266\366"
+	.ascii	"\371\227T\222gu\242\316k\331\312\347)\267N\323n\346\021+ \200"
+	.ascii	"\002\031[\017\266\354\0068\256\b1/h\335\234C\366\016q\315\263"
+	.ascii	"\223X\241!\034.\034\013\214\210\233p{c\343\3443\002\326\024\341"
+	.ascii	"+\261Lf\324,\273\221\003\302\250\002\263\274B\324@\205\300- "
+	.ascii	"\032\3400P#ok11\260\320\251\254\t\tp8|\332\316\20557\004"
+	.text
+	.section	.gnu.lto_.lto.ff053d487fa8877e,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_failsafeConfig_Registry.52.ff053d487fa8877e,"e",@progbits
+	.string	"(\265/\375 \230m\004"
+	.string	"\364\007a"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\203\275\351\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\374\006us\317\006uq"
+	.string	"\005\001\006'\001\b\201\300"
+	.string	"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/flight/failsafe.c"
+	.string	"\004"
+	.ascii	")\302\303,\016\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_failsafeConfig.54.ff053d487fa8877e,"e",@progbits
+	.string	"(\265/\375 K\r\002"
+	.string	"$\003>"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\001"
+	.string	"\n\004\005\001\006'\001\344'\001\350\007?\202\210\2000\177}\300\001{\277\001y\276\001w\275\001u\274\001s\273\001"
+	.string	"\005"
+	.ascii	"6\303\300\035h,E\300\001\300\001"
+	.text
+	.section	.gnu.lto_failsafeReset.55.ff053d487fa8877e,"e",@progbits
+	.string	"(\265/\375`\313\001\205\r"
+	.string	"\246\327VC"
+	.string	"\2216\035\317P\024\201\001\321K\375\201\345\321\353\213 g\213}\304\033\250h\277\021\357\264E\300z\325Y+\263\0202\3768\335~\247\375~\353\377f\272\213\264\376[\021\213M\343\234\340\272]\353\367&R\246\024?"
+	.string	">"
+	.string	"H"
+	.string	"i\315t>}\001\227\n\030\004J\273\030V5\366%\266|\260}\314 {\306E({\025\r&\243pw3\355p\320\023\344_\3049>\320\302\023\223`w\235\037\230\341\326\333>`\033\201\235\"\001\250+U\265\300\250\004\204\227+_Sor\303\334I\210"
+	.string	"\330\275\340\341\217x\312\307\367\360\350\n$\371\357\321'\271\036\257\001R,!R\272\\\331\"/\225\203}kw\327zbk:f\332\312'\260\024>x\213\t3\225B\020^\"\231H\241\352\304m\355)Pp\244H!Uw\316eg\276b\002\003YBUT[\363\021g"
+	.string	"\312\356z\370*/\261I\350t\256G\313\306G\303\322\370\025UK\243\214\222\r^\214;\316th6\332'd\3236\331H\004\316\026\262\311&lZ'\313x>Y\207\001s\0244\236l\204\343<\031&\352n\255\236(py\351\324\263\377q\331\013\376\342\303\005&\205\002\271l\006o\001\302\002\003\236\302\006_\341\222:\205\034\034\025& \360\002\2319\312\001s\241\353d\340J\336\265]*\207\301\217\301\254\314\340\214\257>\330\323\270\373\260\247qI\002\234\342\353X\023\212f\306\367\225\224=\343\305\254-\217\304\356\340\2266#{\353$R\253C\002\0228\344\334\215\206\261\237\207"
+	.ascii	"I\267h\317\023"
+	.text
+	.section	.gnu.lto_failsafeInit.56.ff053d487fa8877e,"e",@progbits
+	.string	"(\265/\375`("
+	.string	"\275\007"
+	.string	"\022\216580q\323\001\200\314i\351\003o\n\360\240\3471\317\246`\025\370]\\\007~\034\025\346\233n\017\301\377\232pm\234\233\037#\"\202\201\347\340z{\203@\360#\240\2046\331;\245\356p<\233V?\234\266Q\320\202\002\367\331h\003\2471\320\216W)G\300\235\203\307\243\240\256\363h\026\356\255\225\246M\210\006\r\fIN\330\257\227\375\360T=\301\\XD\036\272l\210\233\204"
+	.string	"N\273k\340\223\274$\302\357\370\264\204(\036\374\364E\327'B\005*\003%C\212+;\034E\271a\337Zi\262\255\003\020UL\300\314\256\305\252f[\246\312\207\355g\376\354\227\207\247}\312\203\002E\265\273Tr\374{\374\374\217\234"
+	.string	"c\005,\215\036\261\204\335u\004K\027\267\274\355\001\333\005\266S\002\013"
+	.string	"3\241\241\037x\311\334"
+	.ascii	"6\361\224$e\025\206\256\341q!\214\227!\300\245\353\264\363\t"
+	.text
+	.section	.gnu.lto_failsafePhase.57.ff053d487fa8877e,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"-\007"
+	.string	"\362\31525`m\322\001\300~\001rB\223\351\002\363.\004\333\021\203\031(\370a\205h\026\365^\020\026\352DO\214\267VH\222\220:\244(\344\211\377\261\353Lkdo)S\n\336h8\025\345\351XT\025?\013\nV\247\212\r\026\305\0207\230'j\n|9p\260\370\271.,b\270\375[%Y3#\225\260\375\360\221\354\262\273\b\276\3109\b\277\343\320\021\240\274v\350\203\246\303T\200\220Qv6'J\315\260\377VI\266\323\251\226\212\023\202\224]\212neM`\211\207\355\220\215\361?\016\022r\3668\216-"
+	.string	"\2434A\242\262\313\305\314\007\246\303w\201\351P7\236=3\377\245?\224\213N\333DOK\302\356:\265\315\342\326\3336\260}`[#\b"
+	.string	"\002\013\255\262\030\005\205"
+	.ascii	"]\303o#F\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_failsafeIsMonitoring.58.ff053d487fa8877e,"e",@progbits
+	.string	"(\265/\375 \365\335\006"
+	.string	"\362L06Pm\222\016$\307\250(\004\252\213\344\265\260\bJ\371C\205\327\362_\255\033\366\357v\264\205\335y#^\321\264\377\233\231)R\324\231\3242\221(<\030\255m\215\020\231\002k2\233\313\352p0\353\212\036\206\005\214sE\007\314j\210\032\255\0233\003g\017\033-z\262L\213\230.\013KC\002\021\234\370!\032\262\001df\302\005\251)\342v\264Z\342\363\312\265\272\037K\253\007\003L\242w\372.\364\240\306\227JX\372\337\017^.N\004J2G\247\2254\251H<~\320c>@"
+	.string	"\275\265\343\0305c\204BD%\263\213p\243[\337v\373Q*\005\003\205#\205\372.\n\231\371\343H\025\035\366/\370\r~\213\b"
+	.string	"\002\013\330\210!\005\205"
+	.ascii	"]\303\377\"\306\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_failsafeIsActive.59.ff053d487fa8877e,"e",@progbits
+	.string	"(\265/\375 \365\335\006"
+	.string	"2\31506Pm\222\016$\307\250J\250\352\235T\367R\242\3045\246\344X\371\363\326\r\373w;\332\302\356\274\021\257h\332\377\315\314\024)\352Lj\231\322L\270\210\326\266F\210L\001g0\232\313\342l0\353\212\035\205\004lsE\006\314Z\210\031\215\0231\227\263\006\215\026;Y\246EK\227\205\244\241@\bF\374\016\375\330"
+	.string	"2\363\340z\264\364p5Z\r\341y\345Z]\017\245\325\203\001\245\320;}\007z\360\342Kef\016I\377\373\301\n\007\311%$St:\311\221Jd\343\377\274\345\002\203\317[\273\fQ-L\022 &\231]\204\030\335\372\266\333\216R%\025&n\004\352\253 d\346\217\033Mt\330\177\340'\370)\002\007"
+	.string	"\002\013\330\210!\005\205"
+	.ascii	"\357\232\267\204 \341\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_failsafeStartMonitoring.60.ff053d487fa8877e,"e",@progbits
+	.string	"(\265/\375 \372\345\006"
+	.string	"\362\21405PM\324\001\244U\371\026\321\023\346\026\013P\303{\3320g\003\b\214\243_,\366\0379^}\\\335\300@\305\265\231\231\205\"\254\374!\256[d\350\376\334m\357\224\002\256&\353\242\270\f\243\256\332% `\331U\0270J\241V\033W'\311\032\203\265\325N\323\266\032\205\373\251y8\"\212\210\231\020\376=\310n\270\207\027\260\331]\002\237\343\035\016~\306\251\037,\362\340\251o\201N\r$\306\212\215\023\214\354\330\341E\316\013\373\317N\215=\013\304\321D*\331\235\350\244\354\b\r\321\260\375\310\237M\362p\263\377\020\211"
+	.string	"\031w\267N\214\177\227\237\177\316\001\300\314\345\262r\260\273\226`\206\342\236\267-`{\300\266E\b"
+	.ascii	"3\001C8\343s|\241kxZ\b\343e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_failsafeActivate.62.ff053d487fa8877e,"e",@progbits
+	.string	"(\265/\375`z\001\005\016"
+	.string	"\306Y[C\020\221\223\016\340\245G\357\003\303\200H\357\333\0034\234\247>\006\2008\343\217\271\002$\270\016\311\366\2335\376\217\243y\346\362\222\2435\314\212\310\2068\0205\211B\256\263@\247\223\234\267\360\330\b!{\023)S\nC"
+	.string	"C"
+	.string	"J"
+	.string	"~\232\2764\255\231\316\247\017@A\0273\203@k\027\325\272\261\335c\021a\373\034\036\331/g\251\026\343\360r\222\022\263\273Q?|\364\034\371'q\215C!=\261\005\273\353\344P6\334z\333\006l\037\260\263@\316o\320\036y\212\r\005\002\224\313\377\201\266\205\237\370x\250v\027\3047\361\025\310\017\361\347\f\242<\367\347\213\340_\002T\227*A\243\224-\233eJ\365`\377Z\355`_i\315Kk/\235]i\354i\370\f0O\257P\261\224S\352\322\347r\267@\325K\005\310\234F\230\262\345T\325\237\314\370\301Y@\310vM@|\025_\021A\202\210\b\374K\375\n\210U\200\264'P\320\250b\2433)\311\035\231\3557\320\346t\362\234S\245Fg\242\244\346|t<\033\021\311\266\361\304\222\n#\033\211'^\3306\237\310\t\211\342\307"
+	.string	"\2030tB\261\004\004\nE\016V\3512]IM\326(\214\020\017U\3139\030M5\032`\246\232\376\224\3024S]ap\226\220\354\005\246\237\211\261\202j7\270\013\007-\236\f.! \200\002!\261\353\001\322\2000<[XM\301\237\003I\\GeX\236R/\240\022\236E\266(F\024\2029\nd\263(,x\026r\316\2505"
+	.ascii	"\321aG\003\342\326Hvm+\222\261e\233\200\223\303\254\034\364\310"
+	.ascii	"\201\300\354\271\031\002B\272E\333\237"
+	.text
+	.section	.gnu.lto_failsafeIsReceivingRxData.64.ff053d487fa8877e,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"M\007"
+	.string	"b\31635P\215\322\001$\241\252r\331\303\314Z\3227\212Ek\367\263\254\364\334\247\232m\310\236>\032hA\337@\332_\310\314\230\201pq\377\212:W\325\b\366\357-eJ\001\306\\2V\245i\256\312\212\233\005\205Kc\305\206\253b\210\230L\213\027\2131\207L\0267\030\226\305J\267\177\253$U\201\217\202\374k\223\253\352+\t\241@~x\207\006\260\273\b>\307O\020\376\305\241#8y\356\320\347L\016\257\026\323\351\223)\273\363\244\226\354\277\335]+\311vZ3\375\027\240!B\360\261+J\221l\bDe\330\356\330\025\033\034t\274\275\263\020\2754\021\362\030\331\355\242V|{n\3767\016)L \334\310\363\244$\354\256\223\033I\334z\333\003\266\013lc\004\b"
+	.ascii	"2\241c\037\030\302\004;T\241\3145z\t\221\303\2353\265\363\t"
+	.text
+	.section	.gnu.lto_failsafeOnRxSuspend.65.ff053d487fa8877e,"e",@progbits
+	.string	"(\265/\375`\204"
+	.string	"E\n"
+	.string	"\306\323H? M5\035$8\004\016\201\233"
+	.string	"\315\327\211\034|&\361 \226"
+	.string	"\\3\004\220\017V\r;\232n\300\200\210\001B\256\0370L@ \b\222E\213\005'\243\2117\233\375\261\027\007\226}\353\216R\246\0243"
+	.string	"3"
+	.string	"7"
+	.string	""
+	.string	" \217\033\237X\217\217cX\217\376l\023\017M{\324\003\006\250\024\273\213\251\204\177\317\317?\206G\300\321\347y\021\330]'8rp\353ms\330\036`?#\341'5\202\375\307\356\256\265d\377\364\307Lk\2463\323\277,R#:P\3546X\255XU\024AAb\373i\337\302/|?y\216\354\222<\244v\303"
+	.string	"\016\034\016\236H\275\252\306\017\"\b\241\\\371\"q\317\212\232z\225\020U\b\271\373\006\017\262\273\002\374\f\327\320\361'<z\201'\017>\372\036\353\361\032I T\234@\271\262\003\227M\3432\003\027M\266\351:\007\272\316\205-\224\fS\3512Z\005\203q\022 \3202\030L\243U\024`\026\256\303(\032\3366\031\207q\266\215\303$\341\376\261Zr\201\020*\220\206\254\332\301\233\230\002\r"
+	.ascii	"2\241=h`<\020\022\002\001q\217\220A\024\330\205T\013\006@p\261"
+	.ascii	"\201XM\001wy\321N2"
+	.text
+	.section	.gnu.lto_failsafeOnRxResume.66.ff053d487fa8877e,"e",@progbits
+	.string	"(\265/\375`6"
+	.string	"\335\007"
+	.string	"\322\01667Pm\323\001d\354\260\210\032\316\355\016\251|b\311B\261\230\270\024\223\265\240\342\276m\301\350\377\355La\177\305\261\257\3164\327*+^\016\342\030\365\220\021Io\"wJ\001\276X0\330\305i\262\013\233\034\206\205L\203\315\206\354\332\314\313\306M\313\2005\007\31469\232\266\315\n\270\247VC\n$\241G?\3763\225\235\335#\323a\225DL(W{sP\023\020\355.\202\277q\216\007\037\343\322\\G\372\235\352R\202|%O<\231\2126DD\374w=\370\030\t?\352\331\240\027\265\302>\265\032\262\037\375*\200dRP\262;qJ\331P\206d\330~\305\235}rP\264\037]H\214L\273;\325\342\335c\347_\343"
+	.string	"\037\310{\264\022v\327\361\003Q\334z\333\004\266\rl\223\002\f"
+	.ascii	"3\241\301\037x\315\334\005\333mJ4R\261+\317\365\\\310\351\202"
+	.ascii	"\365\227q\301\245[\264\363\t"
+	.text
+	.section	.gnu.lto_failsafeOnValidDataReceived.67.ff053d487fa8877e,"e",@progbits
+	.string	"(\265/\375`\247"
+	.string	"\265\n"
+	.string	"\026\324I?0k\225\016\033\200\307\027bP\270\254\320\252\261\t\256\246f\377\314\356\357\326R+\214\234\302.\330`\237\342\276}Y`\317@\2773\030\350\260\330\005\026\203D\354P\013\310\240\245\317[[\262\245L)8"
+	.string	"4"
+	.string	"9"
+	.string	"\254\b\007X vWS\006\027=j\212\374\247.\361\276\321cD\3015b\2742|\250\370J\221br\340=\365D\360u\231\022\033\273\353\364\276\004wv\333\034\266+\366+\0011m\002\005\362\3365\243\002\314\325\351\310\006G\251\013\354\307\335]\353\311~:>\255O_21\202C\345\302\256)\024\261\256\254\365\300\366'\026\331\035\016\242\366\001Q=V\033J\031\263\3525j\0063"
+	.string	"\241\313\3206\200\257\270\310\004U\213\226\206\020\252\253\3359\310QP\273\253\341\253.a\200\337\340\231?\241\314\017A\236e\026<\017\244\f\035\306X2\232\313\207\263]4\032\350c\263q4Z\200\355\322\3210\236\217f\2710' \343\321@\034\347\321&\340>\256\236\334\021\272H\332E\212\2647[\336\263\036\025{aP\n\347 \001\021"
+	.ascii	"3\241ch\214\253\241pf/P\315\203\327\306\026Hh\326\203\367>%\006"
+	.ascii	"\251\330\225\347z\340\202\341e0q\231c6I\003S{"
+	.text
+	.section	.gnu.lto_failsafeOnValidDataFailed.68.ff053d487fa8877e,"e",@progbits
+	.string	"(\265/\375`\006\001\355\013"
+	.string	"V\326O>\020Q\225\016<\016/\205^\005\022Q\304V\334\377In6\275\363\324\036\2405\002\031c\226\232X\322\254\325w\306R%\2617\f\002"
+	.string	"\005b\005\"\334\352#\302\322H\347K\243\255\221-eJ\001;"
+	.string	":"
+	.string	"@"
+	.string	"\037l\377r\310\226\361\317\264O\251\240\220\252\261\273\230rx\350Q3\344C*\222\316\333\0363\\;\274Q$\260\273\027\361\264\340q\231\220\312\356:;\017\303m\335\366\001\333\005\354W\b\031:\222\366\203O\276\273NT\033@N7[\031\017\341aG\220\220\357\234*\r\340H7\373\333RK\366\343*\311~:>\255O\347\323\277\256\323\213I\213\335\013!\216\005-\026\001\252\252\300\204\213Q\336\260\235=\005\212\250_uH\275\252Z\253\t'.C\333\227\2474\221\023\251"
+	.string	"P0l\214\270\332\230\227\320\0040\355\256\001\377;\t\315\367p\313\f8\226\317y\334\2129\272\031\242\276P0\231\354\263\321\262\f\006Z\240\3216\031\254\201\226q\260\213\347\203Q\006\270\343"
+	.string	"\343\301@\235\216\007\273\276}\\%!"
+	.string	"\001\212\224\213Z\262\345a'\270\312\"\300\264B\202\212\021\202\206(\303\334\335M\265\024\003\027"
+	.ascii	"3\241a)\260\205\267D\320\222\036j\021\210k\204\344V\023\316a"
+	.ascii	"\335\005\333\315J\352Z\t\006\304}J\fR\261[\236\013\272\220\243"
+	.ascii	"aly\031\002\270\374\300(E\325\330\256R\006"
+	.text
+	.section	.gnu.lto_failsafeUpdateState.69.ff053d487fa8877e,"e",@progbits
+	.string	"(\265/\375`~"
+	.string	"m\n"
+	.string	"V\223HA0\211*\035(\232\021\220_B\260}{*\f\366\0259\273v\372\314<\361K\256\210W(v7\2008?\302\330R\3140=&\275\322\377\237\021\021,!\263\030\024\302\3110\224)\300\005F\333D\356\224\0026"
+	.string	"4"
+	.string	"6"
+	.string	"\017J\255\330\356rJ\300\363\324\273\246\322\363\035B\321\265\211\310U\2138\t\260\260\205\237&\001\301U\272\352\322\024\222\244d\250\354\256%\030\206\334\363\266/lO\330\327\002RQ\260\221Sh=\331RZ\347\0014\210Q\240\210\260\0132\273\260\256\351\300\200\355\373\253\213\241/\260\016x%\330\335\355\323\016\331\333\3477{\366\353cj\337\n(\333 \211\352U\177`!\020\301$L I\231/\272s\006\240\311\356V\370\343Y\036~\201O\177|\344\301O\377#\371T\275x\251\300t \300J\034\311\231=~\001\276P0\031Kg\243\261d8O\006\206f\223\34164\026\r\356\302\351p\024\bw\034\030\016\347\351:\016\267\215#\360\225\221~\366\370\201Z\203\264\273\016y\320\252\"\213\224\254\202j\017"
+	.ascii	"2\003\303\341\306X\240j\234`\032\366#\237\303C\245\307\326\270"
+	.ascii	"\214\303Q\241\007\025\342\345\n\340\3625\3254\rLA\001"
+	.text
+	.section	.gnu.lto_failsafeOnValidDataReceived.part.0.86.ff053d487fa8877e,"e",@progbits
+	.string	"(\265/\375`O"
+	.string	"m\b"
+	.string	"\362\21787P\215\322\001\300\005O4\275\327(J9\361\366kq\335\330U\023\2666?\366-\232>\2745\320\"]\003i\177!\263l\033\345\302\277\302,C\231`=\020\331[\356\224\002\306\\2Z\346i\266L\233\234\005\205M\243M\206-\333LL\347\315\013\201\271\206L79\034\327M\3146|\\%9\241\265\ni\204U\265d\273\002\3437\227\3159\300\213,"
+	.string	"r\262\222P\220\377\316e{\377\350\f\230v\367\300\367x\352\301\327\2704\204\007^t\351{\256K\n\207\310\251$\004[PK\326\370\270J\262\243e\262v)Z\254\305\220!\033\366Q\037\033\303.\337a\373S\341\317&y\312\264W\235&T&\273;/5\343\337\025\306\317?\352\024\321\bt\255\214,\016-\217"
+	.string	"\b\273\353\200\213[\336\266\201\355\002\333#\001\020"
+	.string	"k\023\030\017\327\270a\030@\036\030\341\212Aa\"\340\214X\3249\235\026\332L\331i"
+	.ascii	"\270\366b\312i9\375\3322\006"
+	.text
+	.section	.gnu.lto_failsafeUpdateState.part.0.92.ff053d487fa8877e,"e",@progbits
+	.string	"(\265/\375`\306\030\305i"
+	.string	"\312\244\004%N0\220\332\031\003/\302?s\262\006r\240\316\215\034\246\247\n]J\026\2103Gt4\320\363\f<\377\003lW\326j\342n\265\355T\253H\325\347\323\343:\227w\272\230\256\225BLU\212\302\251\337/\310\253(\006/\030\275\006c\220\225[\246\224RG\002\n\002J\002zVM\345\r6\376\254\266tU\204\246r"
+	.string	"bc\"L\351\305M3\320\2616"
+	.ascii	"\264\312]\245\257p\337\261\221J\013)m\205\031k\254\245pS\301"
+	.ascii	"\352)<E\200\262(kVX\314\035C\3271\033yES9I\026d\005\tMe&\220"
+	.ascii	")t\255\310\315\326\202\373\255\227\264\\?i:6\316A\201\362\226"
+	.ascii	"A\321I\223&Ehrk\323\013\212L\342\342\262\212/\021b\\\324\357"
+	.ascii	"\017\201b\017ah\321p,\270\225\364\013n\303\2618\342z{\277&@\263"
+	.ascii	"\022@\261\207G\355\303\366pm\036\266\207n\354!D\213n\313\342"
+	.ascii	"\247\207\020n\267e\035i\275\2753<\f\211\262&\370\276oP=\344\250"
+	.ascii	"b\017\215=\354$\314\334\342\311.\263\230~+{{\311]s\211\340\373"
+	.ascii	"\276\313\036\276\364{}k\346\300\354\273\r\342\203\207)\251\245"
+	.ascii	"2\031\005\365\344\324\241\211iI\211C\022\322\221Q\021\321\220"
+	.ascii	"\320\206 $\320\217O\017\317qG'\247\305\2711\332\324\024\211\354"
+	.ascii	"p}\017\341r\333|i5\b0\375\001\314\027\367\240S\304FO\255\304"
+	.ascii	"\256\031h\235\367\364[G\240\371\253\353\264g\237K\371\234\225"
+	.ascii	"5\265\2452\311\207\347QY\360\034\212\017\213?\345=\265\334\271"
+	.ascii	"S\235\223\267\016M|\353\021\023\035\325\227\346Zi\325\201\262"
+	.ascii	"J\3359q\016@\300\236t\322\223FZ\225Yj\260u\336sn\335\371\361"
+	.ascii	"\005\256\211\037\311\265\221\234\233\0275\201)B4D\327+\0326\276"
+	.ascii	"\265\026J{\262%\361\r|\035\204\314{\"\231:\020_\377\370\240u"
+	.ascii	"\217\220 \316s\334\361\001\246\326:fe\236\323~5\323\236<\274"
+	.ascii	"%\222 \242V]\033\364\001\266B\343@\323\236;\374&\357\t\325\341"
+	.ascii	"F$\037`9\332f\375\320%\250\243\363\2369\326\0334\315.\235\366"
+	.ascii	"T\301k\326\247\277\030\314t\336\363l\365\231\201\346l\272FJ{"
+	.ascii	"\342\360\242\3635q\313\025+mC"
+	.string	"\332\307\363\006[\003F\326\304\346\253Id\177zX\f\353\365\350}_\343W\227\377\352\303\345\007\230\366\213k}\202f\251\321t\355^_[\356\307\016A$\361\276/\267\2130\315\"\232\371\2510\263\ff\237\n\002=\303+\370\247\325\004\214L\256\370Q\356vB\376f\352\036\035\021\342\324\362y\035&_\371^\016e\3471\334\001E\005\366\034+\016'6\330\305>\254\t\030;\r\377r\213\"\203}F\307\030[\253\256M\337\261\327\311\311\356\305b\212M\305\302(\226\275\317\"\004\357\364mm\352Mf\026C\004$P\253\241\314\376\302\235\257\023\313\302{\303k`f\003\234\213\312\267\210O\200X\232\365}\337\227\375(w\031^\333\312\315\202m\"x5\2747\0136\371^\314?\374\250\226w\272>\031\023\261l\215\2377\021;|\226p\370I\263\357\245\260\3004\377Q\346\246\200\355G\212%\201\363\343r4L\344B\235"
+	.ascii	"\313\254\300\002\336\316u\305\033\023\374\343z-\356&b\375\377"
+	.ascii	"\331\2337\266\274\220\271\315\364\231\006\270\203\360\003\021"
+	.ascii	"D\300\366\320\277\351\332\333\304\310\240l7\272\312%:\220\202"
+	.ascii	"\342\373\276\"\270\001\233\214\005\334A0\360vb\300\366\260\277"
+	.ascii	"\253\355Hj\360A\331\332\\x\241\177\224?\304\21024f\370\311\230"
+	.ascii	"\247\244\226\312d\303\320\034\325n\315P\255\363S\353\354\244"
+	.ascii	"\343\334A\307\271)\307\231\251u^j\235\225Zg\016\255s\222;#\271"
+	.ascii	"\363Q\353l\324:\027\265\316D\255\363P\353,\324:oh\235\203v\234"
+	.ascii	"\2219\316@?>;\316=9\316<F\347c\353\274\323:\353\030\235sZ\347"
+	.ascii	"\266u\306\321q\276\321q6\3468\333\264\31658\316\305\033g\242"
+	.ascii	"\321\2315:\017\233I\363jt~\243\263\3338\367\007Nar\240\357;\243"
+	.ascii	"0\315;6\254\033\322s\335N\272\231t\303\320\355\366g\305Y\310"
+	.ascii	"\256\367\323\021EL\217\261-\271\373\023\201\263\220=\306\026"
+	.ascii	"\275\361\347\317\276\322}\234\265\2767\272\036\314\n\316\352"
+	.ascii	"\267\262\031#\240rk^Zp\n\022[(t\255P\204p\275A\365^\313@\002"
+	.ascii	"\247@\276\225\201\331\330\270\322\254[\366\220\337\2128\314\315"
+	.ascii	"\235\327\001lD\006\377\266^k\t\251\364\031\230\2048\177^\006"
+	.ascii	"\350\221L\032\\\214{\026\006\350\333JC\271\210\033T\372(\023"
+	.ascii	"\357\222~\376\375\220\240\332\347\275\222\355\363\335\006GW\350"
+	.ascii	"\243\b\207\250\366\371\2377\241\254J\317O\340_\230\2049|\357"
+	.ascii	"\373\216`\357s?f\241\226\273\265\205\347\004\344\371\236\266"
+	.ascii	"\302n\227{\331s\031\334&\f\327\313\213\355!\317\367]\273[\215"
+	.ascii	" \001\360P\333K\342\331\302\007\005\351\311\230\247I\330\244"
+	.ascii	"\032ug\261m\027a\223Z\344g-\365^\316\245\220\313Q\036\227\032"
+	.ascii	"\214x\214\371j\025\205c\203\177E\037\205\353-\2564\251\205L\231"
+	.ascii	",TI,4\312\330Y\031\033s\323a\001\320\013Q\337\353f7DU\233\302"
+	.ascii	"\314CT#U-#19\274\204\004\373\370\337\027\303\355\352\216o\264"
+	.ascii	"\003\243\326&\365#\006\340\206\244\226$=\202\240Q\250\226\250"
+	.ascii	"F\032^\220clTAFA]\200\353\213\321-\025G\025\b\212+]z\202c\327"
+	.ascii	"\345\307\345\232\331\235\321\242\361\001\300\213o\2734\302\\"
+	.ascii	"\2613U.\344\033\032_\217\237\365\372\257D\214\222\251\027\217"
+	.ascii	"\312\263\365E\310\361\243\034\267\204\3124\260\346E3\315\016"
+	.ascii	"\320\364\005W\232TBf\312\324\215*\331\206CC\212`\021]\fH\212"
+	.ascii	"\350\351|\224w^\347\033\020NK\022WZD\262\363\"\372t\276\210\216"
+	.ascii	"\r\347MmK\316G\271i\350\376\037\364\322\203\214^\017\r=\271\226"
+	.ascii	"\310\327\256\224evqx\013\256\364\310\224\2219A\267\321F\250\232"
+	.ascii	"\312<\315h77\r\364\260\303\345\341\355\344!:#O\250W\004\307\375"
+	.ascii	"\301\346\274\003\366p4\367\207\220\234/\240\357\006\005\275\265"
+	.ascii	"\233\217r\026\273\376\b\035n\306\366\231\335\250\257\340J\233"
+	.ascii	"\312\314\346\234\2008_\363\355#\367^@o\036\247K\363\024\326\370"
+	.ascii	"7_\264\367\"\315\346\215\337\315\032\\x\241\231\003q\317\212"
+	.ascii	"\357\313%\202\235\314\243\256\020w\210[\304-\302\366\320\346"
+	.ascii	"\273\212\031\323\021\327\005og\315\017@\207c\006\263;\033W\215"
+	.ascii	"-~\347\301\365q9\032Nrf\227\315u\363v\026?)C\254\272\365Z\374"
+	.ascii	"\215\374\212\033\254)\354\377(\035R\030\001\354\001\2126\241"
+	.ascii	"\302\304\001%H\320\001\b(F@Qu\242\352*g\203\252\024W&\206 <\200"
+	.ascii	"\245\200\007'T\240 \241\304\261j\003\253\006\256\252B\250\252"
+	.ascii	"\322\300\246J\205\t\025%\260\260\252NX]\205Pu\325\362\te\025"
+	.ascii	"\007&\260>@a\202\203\245\n\017:@\361\001\007K\020P\230H\261<"
+	.ascii	"q\205\265T\022\261U\bUWK\025VVWKc\223p\361[ \"\360\250-L.\336"
+	.ascii	"\316N\301\256J\225\353\350\004\315\332\207Uj\371QZ\035\365\375"
+	.ascii	"\002\022%c<|\224I\225\256\030SO\306G\030wM\352R\351g\r\004\003"
+	.ascii	"I\223\232t\275\366(?{\362\263\0220d4\251M\256\327\2742I\275\017"
+	.ascii	"\271^\037\233c\232\324 \327\353\366\307\317\372\247\211\326"
+	.ascii	"\244\036]\257\233\256\035 z\361R\371\254T>'\225\317Q\312\347"
+	.ascii	"'\345s\323\3243\323\324\363\220\3629H\371\374\243|>*\237W\242"
+	.ascii	"\362\227P;\200H\264\310\350\005!\361\205\205\2054Hu4\307s\360"
+	.ascii	"\217\353L\357\315\262\312\272\200\231\006:\201D\275<\375\017"
+	.ascii	"\037sN\277\364OO\334\353\360N.\355\246\357\360DL\337\364c\317"
+	.ascii	"\203\351\233j\266\364!\354vT\267vtk\027V\325r\302\245\322\353"
+	.ascii	"p\245K\237\203\303'\275\322#\367p\334\340\360=%\351?\214Xu\360"
+	.ascii	"O\t\r\243J"
+	.string	"\326\300\251\221E0\001\367\302ff\3561\317\374U\205\216\374\330K\"}\233a\244\357\3011\235#hxQG~\f\3641\277x;\217^\tl\313\221\037\236\032\324G\331\350\213\264\310p\245\305\030F\017\242\350\207\352\260<E\215\340\350\025aN*\274\223\nF\215\024\3524\220\350\231\231a\276\351J\215\312^\260a\234\200C/\364D\217\\\362\\\256\264\370[C\337T\241\007\240.\ts\214\313\3438\255&\340\336L2,3\263\f\363LO\235\013U\256\327b\017\353\0254:\330 LS#N0\320\217\310\240+\025\314\t\214\023\021\006K\013M\037\345\023\310\206\300\365)5\001#c\242k\233\036_P\245o\026,\257G\312\237\332\360A\307<\037\\\310\350i\351:f\016z\031WZ\f\334\360L}]\027\364]\327\305\300\202\t\250\002)\035\223\302\210\241\231\221\021\031I\222t\322\n\020\006dq\232\327\324\003\022"
+	.string	"DAK\204L\241\251\331\024Tj\f\373\0062{Z\221\212N\325\007Q\337\037S\310z\002\270\351\n\033\255\371\013q\b\337\335I\n\313\264H\226\240\244\337\211\244\300~5\330\350\021F~P3\353\004>\275\362\237\362\222+>&s\352\201\036%B\254\345\236\247\365~u\220\350\364j\214\320\322\377\026\223\373\337\356TV\215\252|\223\204\3158^J\366\325\357\262o*\355\002\201\177\033\312k@Sp\033cR\215O\006=K(\221\324P@o\345;4\016\204\213\367\211\035g\210 \365~\026\032\003\251L\326O=\037\230*\260\375\226I\270\243*?\270\264\f\013\322O\317\372\236@g\262\204\260NdT\033\021.\001\001\333\226\260\233O*\376^b\340\327\336(\355\321\017\247\001\351\274\221x_\032\227x\335\316\253\022\230(\237\006\344Q\021\360\352\255\205\t5\336\223\33754\270\006\255\314;\277\202\230\265\306g\2769"
+	.string	"\177\351\340m8\025ap>:\271_\222AOB\007\353\356\"\026\003^\022,\265\226G8\252\342\27692e\351\313\351\236S\350\200r\265N\206\036~f\0271\214d\373\343Zm\340W\357\034W@\222_x\340\367X\202`\n\034\314`\204m\017\332\242e\270\324\212vT\227\210.\236\221\333+^\204%Z\212rQ\204\373\253y8N"
+	.ascii	"\346\0169\325\246}<^\346M\227\300\302\345G\037$\233\004\021d"
+	.ascii	"\310\025(rs\374\344D\326\212k\004\017\341\255\224\343\202%Y\003"
+	.ascii	"\233\250\226\274\244\204\231\244:\262\344[\301\221|\250\022q"
+	.ascii	"\246&\337\270\2717\206\263l0\327\316h\261A\200BJ\253\213*\250"
+	.ascii	"\322\t\373\021\2317\002h\236\200X\342\306%\177\332p\333\b\346"
+	.ascii	"\245\275\250\220p\367\316\2729\207\367\223\201DR:\300\020\220"
+	.ascii	"\241\275\273?\341$\372\366S \300\2158\216\227\320i\027y\316l"
+	.ascii	"\033\3356\257\321\322\274\227;\022\314'\324\310E\3117\2329\247"
+	.ascii	"BUn0\245J[\370`\213\365\323]\030.\226\337\274"
+	.string	"f\021\234\006\311\226\354\277\336A\367\254\227H5\276\245\n\264\256\002\201n\340\2617\0351\234\361\323)\232\246\236-{{\233\020\355\027U\323-\264A \036\324F\002\366\240\026\030\320\243\321\334:\331\002q\t\032F[\007\342\003G3\006S\246\350\210[\021}\374\340\276\177>\016\310x\205\226T$\002\274pDtp\201\tj)\225)#\005\301\353\312$\315\355\226G\037?\020\356\241\321\302\370\300\3524\232ZQ\343#\350l\340u\311\313\006\023\276\347\325x\005:U\361\311MT\363\204\345l\263\276\234\017\024\327iuh\346\302W\227\350\fjW2\003\255\316\262\007\234\374/\340\200\374X\320\353\272p\305\362SHi\215O\216\317E\322=\203\037\325QH\230+\254\0336\"M\317\341]sdn\347\271\033\n\006\257\003;\034\235 n\256CR@LGh\341)6@\264\201\002[\264\256\036z\262\236\241\031\224\b "
+	.string	"$\333~n\026Q\236\004Hy\013\262j\205\367\323\225n\331\370\231\214\301\354\303\300\315\343\036\027\\2\303\020u\213]<\023\316\226\352l\3024o\20253\231\257L\340}\356$&\332\233\bqfD\373\2612q\300\246\252\317\030\243^\0247\232\024\262Aw\316D\025\2365zAmP\242\257\376\227\\\321\341w\236\343\310\270y\301\264B\352\025\201z\317\366#7[\327=W\bL\002\347\326\227$\335,\326\212\353\303\202}\204\2227\234\267/\370\2561\343Z\260N\345\024\220\316s\271\303\320y7\032@\207\030\261\020\325"
+	.ascii	"&\2514\002(\316L7\273\023c\272\022\204\231\341\022\016"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ff053d487fa8877e,"e",@progbits
+	.string	"(\265/\375`7\003=\020"
+	.string	"\326\232dG\360\262&\035\224\217\263\245G.L\251%\352\016\032\023\377OQ\307\3332\230\322\332c~\007*e\214\332\2221DY\267\314_5\013\317\213l\";\203\312\224\321\217\357\214\210\230\351af\323&n\350\222\r\331\367\211\224D\246O"
+	.string	"T"
+	.string	"R"
+	.ascii	"}\235\003\375\026'\375\230\201\256P\240)\230\364\004UKH5K\373"
+	.ascii	"d\016\252]\264\323i\224\274\306fz"
+	.string	"\317\306z\315\212\272>\016\225\374\276I\322\267\241=D\\m\373\353\224\004R\266\377#\362\373$\354\357\377\207\204\262\224R\226\332\202\366\237W\002_\227~PK\037(B\377\207\245\317\263\322\237\241\322\217\261\352\373\244\364a@\350\313P)\345\237*\202\322\337\321\007\337\034\250l\377\207\226\213f\203\327\200e\373_\\/0\256\030\232\230\026\006\257\003\312u\212`\320\262]\310\t\260fA\377\205\202~\230\240\357\002AJZ\021d\307y5\200\336D\361z`\212\327\0139\200\272\2222\240\310+3U\325C\006S\361\312\204J\302\261\221\231xg\246\232pR\350\350xgB\2155;C\"o\213(\362z\230\372\236\022 \317\211\027\004\221r>3\026&\274\027\272]\235\361\013\023\317\240\254\327\254\210\007D\016\305\255\352\250\276f?\202V\300\236\220V\247\211w4KxG\2412\020\0257\"o\200O\227\310\320\315y\271\251"
+	.string	"b\260\034\221\227\023R\316\271\031:oi\222\360\226@\2151\033\036'\336\016\205\246|\230\030q\336N(3 \320\002\251\032\316\003\030$\030ORe\017}KR:\233n\254R\326\275\204,\315\343Y?\036\001\312\356\003\033\306\353&#'\233\341k\022$@\002H\202$H\002\211A\362\007\255&K;\211`0C\302p\252\034\263\274\341;\351\313>\202\217\260\177\204\342G~\3037\370\306o\374\307\322\"\317G\034cr\244\314R\237"
+	.ascii	"%\305\275\002\r%\205ds\031"
+	.text
+	.section	.gnu.lto_.refs.ff053d487fa8877e,"e",@progbits
+	.string	"(\265/\375`["
+	.string	"\255\006"
+	.string	"\022\316$(pM2\034\037\034\013\251p\rIUUUUUU\\U\344@\3338\313\003j\031\261iP$\360?!\204\020\262\267L)\026\354`\233\201\242\254\243k\t\226j\007\246z\201\271v\232\024\255B?Sz\2437\340\347u\336\346}:\220\236\230\224\220L\035\021\t\001\371\360\350\340\330x\325X\315hV\214\251E\263\025\214R\274\023\257\304\0331\205x\037^\207\267\3626\274\f\353\302\253\360&L\021^\312d\026\335\242\357\252\250\235^\200\025z\227\351\336_F\277\b\034"
+	.ascii	"S\203\334\341\364L+-+!\3134\260y\261\373\263\rQrB#\364-\214\271"
+	.ascii	"\241\004w\241O\324\254\203e(+\240\332\002{<\227\201\025\260\007"
+	.ascii	"\226\201\025\231{\026\312:\177\312G\007\363\t"
+	.text
+	.section	.gnu.lto_.decls.ff053d487fa8877e,"e",@progbits
+	.string	"(\265/\375`\033)M\264"
+	.string	"\372\026\321=[0\210AI\351\277\255\305\256\312V\357\023TG\242>\373_|\304\316\003"
+	.string	"\032\335<Hu:\024%JucS\323JZ\366\337\266\n&g(i\302l_\237o\326R\177\234\027"
+	.string	"|\322\217\n\344\226\243b\376PM\326\323\324\260\354\210\331\036\033\305\275\334\302\024\021\221\262\366\223\275e\n6\003\321\003"
+	.ascii	"\004\316\272\273ts\323\345 \237\231)D\224\t\260\021\232\neNz"
+	.ascii	"\354\246\036kQ\257\212{\324P\017w\305\3451\007\335\272\351\361"
+	.ascii	"\024\365\355\201\207\353\352\332\003\357\370\210z\274\202z\374"
+	.ascii	"\244\372`\244Z\301\231~\241\241\035z\016#\227\344+\034:$tg\344"
+	.ascii	"\324w\007^\327u\007\336o\027U\203\270\016:\317\247\245\033e\276"
+	.ascii	"v[X\222$\311\254\0051\375\300\272\302\222\344\374\311\302\"J"
+	.ascii	"\246\245\327\244\n\311\312\222\230\224\036s\262\005\025e\322"
+	.ascii	"P\276\320\242\242\275\025\245\303\260\022\246\352U%#zE\205\351"
+	.ascii	"\311\031gA\257\365\226\346\222\223|ff\210\272\374se'+\253\224"
+	.ascii	"\234\275\344\357\026\336k]\245\307r\224\317\334\324\333j\361"
+	.ascii	"\344\214\266[\277u[\2635\\\177\3511-\246\303\264\227\006\323"
+	.ascii	"\320^\353.\357\264V{\372\314Y\231s\376\371\017\200A\257u\005"
+	.ascii	"Z\013?\235\331\b\255)\002\025P\\\310\305\345\374\234\240g\002"
+	.ascii	"\036\030\024/c\f\244\327\247\207\332g\215\326P\016\355\302\333"
+	.ascii	"\254\313\276K>\3633\347\254\323p:\214\232n\372{C\235@\316\315"
+	.ascii	"\201\327uu\315\201\367+\245\336\353\244\356\334$\265\247\313"
+	.ascii	"\250\357-\352;\212\372\266R\3376\324w\222OO\241Q>uh\272\204\221"
+	.ascii	"\352\272\351;\251\036\205\272c\326\032x_\r&\202\220\"\371\246"
+	.ascii	"/\341k\204\366\302a\312\262,s\323\207P\273I;ih?\371\233\253\227"
+	.ascii	"<]\322\314\\9?qp\362I\013\330M\337]g\200*c\360\f\352\333\207"
+	.ascii	"\247\323>\274\253j\212\201\367@kP\362\267U_\265\026^*5sW\316"
+	.ascii	"O\236\236\025\225\252\256\233\266\326\355\254~\276\265\032\353"
+	.ascii	"\007\300\3407\312|\225\363\263\265\322\234\223\335\020\344tC"
+	.ascii	"\260\033\363\221\334\342\245\317\326\300S\033\003\357\277\370"
+	.ascii	"\n \351\006`\215\204\277)p;Do\357:\020\346o1\267\201n\273\f\374"
+	.ascii	"\237\303\"@\224\273\273\034\376\273\341\277\032\376\333)\224"
+	.ascii	"\370\357\0306\"\233\377\202I!\3535\377\r\023f\355\352\374\030"
+	.ascii	"\203\277\205n\316\331\304\374\346\307?\036\fp\350\337N\003\350"
+	.ascii	"\263\333\345\336\\\233w\370\257\026&\004\377\341ZtP\342\300\373"
+	.ascii	"1\206\377j_\256\376\030\347\277[[\364?\230\377k\377\337\376\263"
+	.ascii	"\375\027\363?\314Uo\357\036\376\237\370\357\300{~L\363\267\315"
+	.ascii	"\3375\177\353\374\235\3637\316\337;\177\377\370\337\373\261\357"
+	.ascii	"\357*\177S\371[\312\337b\177\217\375}\345\362\376\316\372;\354"
+	.ascii	"\357\257\273\373\257\363c\"\377M\377\236\373\373\314\337r\177"
+	.ascii	"\227\371{\314\337n\177\263\375\235\3667\332\337e\177\223\375"
+	.ascii	"\215\345o \177\247\370;\352\357\241\277\241\376~\372\333\351"
+	.ascii	"o\346\337-\376V\372\033\351\357\243\277\225\177'\377\316\177"
+	.ascii	"K\340\357\024\376&\372\233\375\333\3707\361\357\007\374\367\372"
+	.ascii	"\017\366?\353\277\013\177\013\377\006\372{\375\333\204\277}\377"
+	.ascii	"\247\374\r\201\277K\370[\303\337\031\376\306\360\367\002\177"
+	.ascii	"\363\374/\363\237\314\3771\377\237\3775\370\237\345\377\002u"
+	.ascii	"uuu\377N\307\2576\371\033\220\nt8o\320\325\314N\005\030\203\242"
+	.ascii	"\200\306G\021\244\272\233\326\355\312\234\211\025\271\351k\210"
+	.ascii	"\250\257\301\361\002\364\276\320t)rIf\252Y\021DHT\\\316V(\300"
+	.ascii	"0\302\224t\311\305]3qrrX\234xH\223\005\031.\352i\236\210\271"
+	.ascii	"d\304\3346^\316\375l21\307\214\271m*2\347\236*H(\037\036\021"
+	.ascii	"'2O7=\315\017\3654Ip\320\013w\325:\207\321\034\205\231\211f&"
+	.ascii	"\024\005i"
+	.string	"r\213\323\311\230\350\033z\243w\355\203gF\3460!\231\231\202\253i\352/\333\375\362\013\006z\301\334\266\306\332\222CH\\\206b\372\334\266\267\335\344\354\300\356\214\205\037O\216\250\377\375y9\311\3149;\355\236\231it\363\336u\373\3748\215;\202\377i\306\277O\361\231\223M\256\304\250C\300\2223\376@\376\316,g%\025r\003\252&%U\214%\027UF*\177 y\230\231\n\271\344\312\231'+\225\310\021\315\314\263\344\312MY\305YS\347'\0252+\233\231'+s\362\201\245\222\252i\311\225l\342YrQ5e.\252\274\223\225I&\22223y2\027\325[\346j6\355,\271\232MK.*\035\r\004\251\212\351\304\344\n\007\213\016\262T\346\026K4\222\314\035\263\345\263\231\325r\356\256\243\314\214 g\032M\246Z2F\207\031\231\2650\202\222l6\207%\243\252fV\232-Yh\346\314\202QP^\272"
+	.ascii	"\3714\313+\264\031\362\006\215\254t\2243\003K9#;\233\345\234"
+	.ascii	"\2219\347\036\223\3063\347\250\235\245si)g\250\236\245L\003)"
+	.ascii	"v\224\363\355Z\013kZrU5\177\304\232p9\363\212'\262\235Y\215\212"
+	.ascii	"\251r!\225d\245\234s\207Q\235M.\340nz\275\364d\300\261\304\352"
+	.ascii	"\246W\215\324\264\236\233*L\234\200\301\251.\\.4\315\250\255"
+	.ascii	"\344\232\013[\356\231\212&\207#\313\330\335r+p\263t\305\t\227"
+	.ascii	"\233\276\267u\313\256\026\262~6\221\314\335\364\027\313\315\322"
+	.ascii	"\\\272\231\263\262U\264-\231\271\351m\266\006\236\004\215\201"
+	.ascii	"w\255\374\374^\311iB\302\344\311My\252\334<==!o\334eNr'+U(\211"
+	.ascii	"]\261\013\344L\364\016\371\177X\210s\376x\301i\001\r\031N%7\312"
+	.ascii	"\365\272Z\367\311m\341B\271L\356\326\005\273Tn\330\305\272\317"
+	.ascii	"\373u\235\334\256\273\344J\271c\267\311\205\336)7\353r5\364\212"
+	.ascii	"\335$\277V\367J\016GR\264j)\252c\031\335\202\252\021\225\252"
+	.ascii	"\001\025\335\222!5\203K\024\325\377#D\316\271\203\316\271B\235"
+	.ascii	"\363:\203\230qN5\231\234b\267\310E\202\237N\232\025UmQ\033-\242"
+	.ascii	"\030\370\270=\346\234W1\270L9Uh:'8\220\304n\324]\342g\230\272"
+	.ascii	"\202\311\214\037\";\331\b\315M\354\346\310\310\267\013\304\232"
+	.ascii	"g\262\322*=X\350\272 \275\005\270\241\376\"\241\213@\336\320"
+	.ascii	"\033R\327\002\356\246\327\310\317\357\021\f<&\3243w\005 \312"
+	.ascii	"\230\330M{\275\032\352{J\352ys\352\273\340\324\363\316\324[\341"
+	.ascii	"YQ\317{\252\347M\251\227G\372\244\005\307\217\233\236\027C\375"
+	.ascii	"\216N\375\356\213\372]\230\372\335\226\372\335\021\365\273\036"
+	.ascii	"\352w9\324\357\244\324\207\355^\250\337)\325G\277\250\217K\247"
+	.ascii	"\250O\225\250Ou\250Oi\250O\231\352\323\374\344AUJ\361\272\272"
+	.ascii	"0\236\274\340\3203\"6\225\303\305}p\344\272\030\035q\272K\311"
+	.ascii	"*\255\267\233\336\002$h\364\"o\022\3125j\2726\203R@\022\257h"
+	.ascii	"\331]\272\312\273l3\035\033\\=\211\346|\225n\322e^\246\333\342"
+	.ascii	"65\364.]\026\277\317\234\273\344\332L\323\345\340\234k|\005)"
+	.ascii	"\2134\351\251\322S\245\233*\341\272:\036\226\013NR\244\273\306"
+	.ascii	"F7e\355\246\317\253\033&&\036\315\025W\315IY\017\266# < ]O\254"
+	.ascii	"\233\326\325\245\312\026Tp\272Qa\312v\244FO\2255tGo^i\262\202"
+	.ascii	"5\036?n\232\"o\214$!NS\322\034en\016"
+	.ascii	"+e\300\nB\207%\256\225\350p\373*r\346\314m\353ib6!Tf\216\344"
+	.ascii	"\254E\314\352INnW\304I\214\311M\277\243,S\006\247\3654\221o>"
+	.ascii	"V[\204D\365\300\244\234KpooxLO\023\t\347\203\205\244\303BC\245"
+	.ascii	"Li\2051XL\315\f'\024\253\233\34207uihZ\\\030N\247\007\0300\330"
+	.ascii	"\255\227l13%.\007-\007\213$\334v\354\246cD\244G\224.8G\300p\221"
+	.ascii	"q\323\353d/^0[\203\275\221}\251\255\035\263u\335\026&dhC\250"
+	.ascii	"T\204\371\302\205\013N\353%\231)\001bB\242\312P\331\001\003w"
+	.ascii	"9N\273\313\273c\f\314\354\232\335\260Q%\235eQof\206\321z\232"
+	.ascii	"8M\214\f\363H\316P>\251\nf\260\326\320\360\231\234\214\346\334"
+	.ascii	"M\361\226 \016'Sn\372\034#\352s\234eP\\\326c\033t\345d\223\317"
+	.ascii	"\230\r\270\254\270\314\264B\001\217\0173"
+	.string	"#ud\230\354\252\245[qad\254\232H\330\202\034_\341 \030\013^Be\027\023\270\331\300\211zB\302q\323+Oe/I\206WW\231\372\276\302\302Zj-<q\326U\005\242[\230I\0212'\030\254\315\240v\262\362\353K\364J\nV\202\263r\220<9\337(s\216a+\270\n\236\202[\300T\032\212\245\340&=X\n^\242%j\323e\f\020\263\234\024\353`\0340Z~\220\265\026\305`\270\013\177\265\031\3243;\331D\t\302\006\027\206\305\032\212\301\336\363\314\023L\300\001\347\214\227\270,\336\027\216\022\306b\306\212\233b(\315\225%\351\206\217'\r\305^:+\204\314A\017\006\t\311\"\351c)\f1+-;\324\343\334P\217\023\003s\251\\\242R8M\352q\226\324\343,\325\343d\3657g\264p\026\027\0261eY\027M\213\222Q\031\025#\301V:I\302rx%q\300\216\nx\3354=r\263"
+	.string	"q.\031\311Q\373\001URd\347U'F\306M1\021\365\350\306\213\207\032\251\257\251\031C\260\024f!\205\2729\265\326\300\303B~\216\207\330\224Q\211j\335\364FL}#iL\343\370\007\246\201\201\\%O\247\034&%4(H\261,\247\312\3344\355\331\243s\344\n\364\307M\361\016\334\003\373\370ih\244(\241\321\200\252\307<jt\234\371 r\323\333\037\343a\035\307+\3744\275+\246\022\312\245\036\347\300*\3744x\216L\n\322M\177s\245\036\343\240"
+	.ascii	"\233\r$7\3057\324\243\033\037\036h\326\226\200\341q\323\343\033"
+	.ascii	"?\236\272S\270*\002Wi\006\224\333M\261\rLu\\"
+	.string	"\205\233\031W]\320\3149\211\253t^\3109\251\323\rA7\004i\222* Ox\351ot\2509\215\201\207\245~\216k\\ ]Y\262\334\024\347\006)*\n\352\304\002\244\213\033\024\024\227\035\316\236\325\231\325\016\262\027/\360\023\023\251(\324\nSa0\214\343\247\024M\253\213\332M?\3464\2742\246\027\314t\251\330\t;a\245\0172H\251\361rrz\371\301d\336\266^\300\026Y\224\347\244\002F\371\324\242\005V\372 #\340-\207\220#=1(_^\270\351mT$%a\245\017\220\031\220\330\340M\211\023S\247\244E\023dH\225R\024/\361\022#\321\300I`DlgC\252\t\344\246\030\251\303T\2622\262\262\263\243#\037N\033\031gYW\306T\254\304\312\333\246\346!\330\307\013\026Q\234$\2418y\311:\207u\316O\214\246\2427\310\243\271\031O\272\007\355\220\221HBD\212\241\321\310\001\nE\007\244\350"
+	.string	"\204\237\210\225\350\367\201\0049\017\372"
+	.string	"\242(\334\260\372n\330\325\270\256&\360\330\242\007\307\023\200\302\366H\302Q\b"
+	.string	"\026E\217\020\313\343\t\362\f\213lK,\002};\307\241\023C\300\341\017\270\341A\037\216k\260(\344\003r`@\t$N\210\340\300\307\200\021\"\204\340\023Q\302g\202\004O\220\203v=\022\2070\020\327\235\007}"
+	.string	"qdW\"!\033d\240\365\035CP\217\302\341P(\304{\320\007\020N\2200\001\242]\201\330_\373\300\t\300\342P\304\312\026E\350\2440\026E\264\017\372`\034*\262@>vmW\241\037\3733\202\220"
+	.string	"H\034\362\240]\2176D\024ww\364\335\264>\"\220qG\0042\3425\005\3411=\036W6\030\374\365R\030\213\300\224m\215\3708)\330\366(\004ZK\370\202+\021H8\374\365\202\353q(\005\256\307\336\177\355/\350\0032~\310a\177A\300th\024ZO"
+	.string	"\031\003\260\n\r\035\327\022A\342j<\016\231(*A\024\241\004\207\226\375\265&6\254G\022!\034I\264B\"\211\233\022@\226\327\352<\350\003\320\267\n\t[\342\020\013\002("
+	.ascii	"\033\f\355/h$\201\201\n>\264\354\317\370\241\004\242\b\021\b"
+	.ascii	"\255\3551\205\t\234\003\017\024\262+q\005R\177A\006\006\310@"
+	.ascii	"\203\242\3365\bQA\210\nx\327 \304\317O\210\f~\324g\360\203[_"
+	.ascii	"\220DQ\321\204\336\320\204\337Q8\002\210(\024b\177\031V\337\021"
+	.ascii	"\3507\364\200\347A\037\212X\020E,\206\"\266\306\370\023\002\262"
+	.ascii	";v\r\n\211\212\330\341O\310\256G\036bQx<\016\231p\314)Z\207\306"
+	.ascii	"\241\021(\206\277\240\232a\021Xl\213\254Q'(\244i\211CE\240\017"
+	.ascii	"\005\353\023\032\217\276\"v\303\032\024\262\354JT\364\021\205"
+	.ascii	"\017\264\276\036\320\357DQ\350\003\032\032\032{x\212\355\320"
+	.ascii	"\317\027$\nM\360\265\277\243Oh\210mOX\215\307\006n\326"
+	.string	"\341\017x\254i\331\225\210(\364\t\217G\326\006\310\006\205B;\242PH=\001\270\006\001\213~B\252\316Q\304\360GD,\n\333\337\260hd\327\226H\002\310n8\256+\013\264\216X\207@D\016\204~\"\210\214(\026\b\016\213A\307\225\r:\261\266?\016\326`1\004V\370\353!\n\201\353q\310\267\022\211\277 \240\257h\350\347+\372\t\351\034}@B\024\304\242\210\035\036\025\205\342\320\327@N\212\337p\r\372P\240(\006\001[!\nG\337p(<!C\353\323\240\267\262C\301\025Xd\215\276\005\036\324\341E\343\312\202h\213E\026\204\315\321\327\3722\370i\211\302\336\261%\256D+\017\210(d\213\255\220X\024\252Y\211\204-\360\307[\331!\026C\t\rC\341\317\203\240p\370#\302\200B\021\204u\330\266E6\250\345i9\b\256AG!Q\350\301\332Ap8T\f2\001D\024\006\211\277!\007\r\255\357"
+	.string	"\026\264D\341\220\332\256\307\225\035!X\024\262\353\b\277\3667\242\250\004\020QH$\\\201+\333\300\352\033Ag=\376\202\214\273\325WB\303\021\200"
+	.string	"\021\017\220\340\200\006\250\300\017+\212\337q(\374\241"
+	.string	"\321\006\001\t\207(@\020\205?!\020@\366\b\342\203\003k\373kM\234@\024\202P\304\332\f\213\305\016|\273f\252\254ib\204\255kJ\251\0038%\0345\362\b2/(7}>m\302j@_\\\032xLv\313r\2723\334\336\222\220\351qS\0312n\033\322G\214\030X\25133\347\n\260\232r\b\211\343Y\246MiS\n\203\006Y\363t\005\352\205O\n#}\3616\365b\314\213\324\205\n\027i<\322\\(\261\261v\323\324\351\262\230\222\373b%\247\376)\023\263\345x\035=\021\303t\333R\250\f\035U-\320p\0260\"F\356\022N\313y\2222\203q\323\203~\250\242\371<\311Y\206\220!\222\021\031I\n\222\306B\n\020\006\244i\030\350\255\036\022"
+	.string	"\004I\017\203\214\031\031\022\021\221\202\244 \205L\273\001\327\n\004\023$\200\232[\340\255\317\264\220\257H\002\034\267\037\261)\341*D\227XG\230\003zQ\006\277\334>\352\232QkS\276\006\275\223\204\031\346A|\022\211\325\360@Q\271I\227g\240[H\343\362\252\374\350g\254\320\025\022\\:\357R\264T\022M\372\377WY\340\324\276\035\207L\262\251+q\254s\305-!\211Q;\312\253\007\212\020\003\333\370\3656\202\364\271\366\370\035;\r\335\177\263e\020\347\211\277u-\021\":\263\204\351\363LI4j\026D\230\246\323\234\031J\002K\311\n\005\210k"
+	.string	"\221\317\330Cy\343\361\207\331\232\316\031K\272\352L\211\246\225\026B!|\222\240?\371\232\205\2234\342\376}\372\034\266\311wZS^\363\365\325.\220\234\201\345\202\2224\265}\372\320\252\317~\036\206\340b\n)\223\023S\243\255F\321"
+	.string	"\231\021\026\204\272\330\351\333\325T\020\3315y\231\035jD\357\367\262\246Qt\021V\375H\322Xh\033\267\205\021\277\315\275M\370a1i\326\315g[\221\331v\213\315\352\335Z\3640\350\223\277\202\361/\314\n.H\237P\207~\2144M\0363_z\202\3742!0Y\004\231\327\327i\253/]o\r{3\223B\307L\226\217\300\364\b^RL\364\344HK\3025\203\246\251M\204\201N\202\260\377\260\373\r$\217\330\333\265l\003H6\313\360D\332\347\343\205L_\256\265\003_#\3166\037`\035\032\352/\275+<\236\317\253\017\271/n?\033\227\n\322+=\301M\344\202\244vv\311\342\355U\315\304D\336M\200\271\b\017Z\334\312\200=c\n\035\311<\330c/<\300\217\306w"
+	.string	"\317K7\346Pj"
+	.string	"V\323\352\232\0072\016\243\322{\200N/\034\351e\343\340V\032\254\356#1 \220PdM\246\221\210U\004?\276\253'\b\351\205\244g\210\255\343\333\023j\321\336\027\027U\030d\n\260\251Z\006\"\240f\035\350\214<\232\305\b9\3447\004`\352\326\367rX\370\020\005q\225#\023\347 &\304\004d\024\020\005\213\262:;\325"
+	.string	"\250\2309TK"
+	.string	"a\350\263J\344::\211@\340k\365pU\273Ht\005O\013+a9Y\325x]2\361\344\317\223\334\320\234\r\341}\266\214z\266\323.\251\263\004,P\247\234\360_\017\005T*p\365Q0\334\366\033s\241,\201\003\301,\227\236\203)ar\364\351\301\276Cw\0327\264\344A\205\201\027\215\364\3323\2026\206\221N~\340\302\022h\203\354j_\340\213\372M\021\244\f|\017`\"\367@\303\213 \346\222\360\257k.\365D\030\317\220\230\374\331\203\004\004\2433\nj@\270\205\311\376\201\240\350\2732\225\304A\301\310<Et\f8\324\244W\013jD\304Z\274L}u"
+	.ascii	"Z[\242d\363\270A\003\216\2760\304\324\315\375'\223\t\016\254"
+	.ascii	"\334"
+	.string	"\032%v.\031\324\336\246kQ\203\026Y|\b\354\357\200=4\260\352=\032\206\007g\267\013\360WF\304o\007\306\035mh\224\333T\221\333\021\316o\331\264\254\260a$\301sD\036\346\026~qZKza\227C;\005QJ\027n\177\317\342B]^\307\nU\262\004\302x\242\334\205\350\346\004\347j\325i\026\233\344?\216\017\201\234\372h\334\305\240\213\374Y\333[S\rNF\200\317}\224\312\352\022)w?\236\302\344\315b\221L\037\fI\206\243c\t\325F\017\362\016e\253\371\033\n\204\331\333~\311\347i\200#\227\006\031g\236f\024\263\236M\216N\207\020\347\361I<)]\320\334\202T\347\345iehJ\n%\354\217\370+T\037@]\241\376B&\253^\356U\230m#v6\344@I\367\024\007\025pME\253,\032+\203]\210\256\275\230\342[L\3202\b\001\2369\321\326\251\263\030\f\021\371\005%YX\377"
+	.ascii	"v<\007jKW\315R\374\033\350eZ{g\351\226\207+\013X=\252\247$X\357"
+	.ascii	"\214\024\206z\241\037\252`\217\206\312\213!\240\023>\263\372"
+	.ascii	"(\221\366J\261\002\025\232\253p\240\006[y;\215\305\224&ls\026"
+	.ascii	"\347\233N\222@=\016L\242\354\300\222\b.\214\321\364\240t\203"
+	.ascii	"c\326C\013%\333\236\245\211\302\321\025w''B\362\274I\307\354"
+	.ascii	"(0\304g`R\272\033t\3411\373j\306\220\325r\304^\030=5\357\204"
+	.ascii	"\"@\t\342H?\235\323\336V\232\333]\343\217\r\345\025J[$h\305y"
+	.ascii	"\\R\001XYP\256\362\0339\222N\270\242\221'\203\360"
+	.string	"Es\320\020J\232\231\2270\355\321u\243\335\036M\214\213E21\267\361\313'\"\213\006CF$\361\314\033\377\023D\306\356\266F<\201\237\r3\n\034\250`\271\032\031\321\261\3643:\016\0208h\215\2067\341\242\031\026\331(Fg\303&+x\254\350-!\321Ih\371\017\005\307\263\302\345\354|\347\314\370\035\372\3066\277\352v`\300\335G\252p\252a\302\375>Q\320\346km \222\374\017\235\243\215\215$\034+jJ\013\313\304,\323\366<\337\230\007q\213\376\323\240\262\036\2427\031!t\275C\243oZb\024\332\020\001\246\332\370\027\\\240?;\030\351\005[e\262q\231\243o\315\r\327l,|\031Ap\355\257\001=s\232G\025)\017\307U\341\203\232F'\277\bF\016DD\213\301\213\376\304\276M\350\001\351\360\240\215\264\265\247\207\t\020\200E\307.-\314\024\r\332\301\332\211#\374\231\036\233\007W\035\217\275\026"
+	.string	"\273_\306\262\f\023\022\222\255\220CH\235 \213d\0364)\202\212"
+	.ascii	"Hx\025\n\221S\272\030:h\0312\354rx\220\3612\251\256\"\030\377"
+	.ascii	"d\224\351\374ux\201\366Q\350@\023\337\020tR\247\323`\337gX#S"
+	.ascii	"'\225\027A\355\232\372\2369\271\356\205\374]\360\334\241\223"
+	.ascii	"g\341K\360\t~2\204\341\2218\377/\265D\no>n\263\254\340r\275\264"
+	.ascii	"\357\272\241\361\346\306\200\311O\232\306<\315\252^\212\r!\345"
+	.ascii	"\374\3620\344c\320\275\205\373;r^\240O\2116Q}\024\037\377l\321"
+	.ascii	"\361\305\333_\200o\215\007\222\201\301\254\316\365\322\360O\374"
+	.ascii	"\357\350c\021\357\237\256\232\206\016\276\344\355\3612r4)}\371"
+	.ascii	"\356U\342\030\315\201\3346<\025\2362W\314\234G\372\211\234\007"
+	.ascii	"\2007\211#\300\303O3\3650\377\236{\276\t\345\373\375\271\034"
+	.ascii	"2z\301\364Wu\202\327\305}\341c\013\302\203\263\251\377\007\241"
+	.ascii	"\235\007]\017\262\032U\273\203\207j\212\305\223<\323\213.\323"
+	.ascii	"\0271\207\307\\\260\372\207b\3135\342^\215\177\242\375\320s\277"
+	.ascii	"^\354\307\0138\231X\267!\355\235\343t\302LQ\322\340\200\230["
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.symtab.ff053d487fa8877e,"e",@progbits
+	.string	"failsafeConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"failsafeReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"failsafeInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.string	"failsafePhase"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\001"
+	.string	""
+	.string	"failsafeIsMonitoring"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\001"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\001"
+	.string	""
+	.string	"failsafeStartMonitoring"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\001"
+	.string	""
+	.string	"failsafeIsReceivingRxData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\001"
+	.string	""
+	.string	"failsafeOnRxSuspend"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"failsafeOnRxResume"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"failsafeOnValidDataReceived"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"failsafeOnValidDataFailed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\001"
+	.string	""
+	.string	"failsafeUpdateState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"pgResetTemplate_failsafeConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.string	"failsafeConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\001"
+	.string	""
+	.string	"failsafeConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\001"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\001"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\001"
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\001"
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\001"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\001"
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\001"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\001"
+	.string	""
+	.string	"isUsingSticksForArming"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\001"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ff053d487fa8877e,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1342 @@
+	.file	"imu.c"
+	.section	.gnu.lto_.profile.329c1bbf776cb319,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.329c1bbf776cb319,"e",@progbits
+	.string	"(\265/\375`\354\001\r\f"
+	.string	"T\017\340\002"
+	.string	"("
+	.string	"\331\342\235\342\005\032\002"
+	.string	"\001\001\240\342\234\212\n\002\003\004\315\343\301\244\013\005\006\344\332\221\323\t\036\007\215\350\210\271\003L\002\003\002\004\002\005\002\005\006\002\007\002\006\002\006\002\003\002\003\b"
+	.string	"\002"
+	.string	"\006\002\007\t\002\003\002\t\n\003\005\002\005\t\013\352\263\360\321\b\f\r\016\017\020\021\312\344\347\350\r\f\013\006\002\006\022\025\350\244\345[\036\f\002\f\006\026\247\320\217\212\001\027\030\031\233\326\340\375\t"
+	.string	"\032\214\353\300\262\002"
+	.string	"\033\034\271\227\355\346\006\024\002\b\002\r\002"
+	.string	"\002\007\006\002\r"
+	.string	"\002"
+	.string	"\035\036\037\277\325\352\232\n\b\b\002\004 !\203\366\244\240\016\n\003\"\225\307\226\262\006\b\002\016\002\004\003\002\004#\313\304\355\226\017$\313\332\267\345\r%\221\326\260\227\004\006\f\002\f&\353\254\217\274\r\b"
+	.string	"\002"
+	.string	"'\332\322\232\366\016(\276\363\265\272\007)*+\240\342\234\212\n"
+	.string	"I\250\201\271\300\220L\006m\351\001\200\202bSD\017\0210]btai\251i?\003\021\304\302:\250\037\361.\340u\372\023\021\372\361\020Q/\026\031\242@\317\342j(p\266,\260(C\b\340\022\211a\2310\336\021t\350YE\n\0059\331w\016\212\377\345i\224bBh\335\372\371\021U(/{fx\271\327B\346a"
+	.ascii	"J\320\346Jw\277\327\334\335\313:\227\243\303o\024F\243\221\315"
+	.ascii	"\321*\341\213D\024y\310dw\331z\224J\023"
+	.text
+	.section	.gnu.lto_.ipa_sra.329c1bbf776cb319,"e",@progbits
+	.string	"(\265/\375 \311m\003"
+	.string	"T\003\275"
+	.string	"\017"
+	.string	""
+	.string	"\001\006\001\001\007\001\021\001"
+	.string	"\025\031\032\001\001"
+	.string	"\001\001"
+	.string	"\001\034"
+	.string	"\001\037"
+	.string	"!"
+	.string	"\001\"\001"
+	.string	"#"
+	.string	"\003$\003\002"
+	.string	"%\003"
+	.string	"\001&\004"
+	.string	"\001"
+	.string	"\001"
+	.string	"\030"
+	.string	":\005"
+	.string	"\f\300\206\b\026"
+	.ascii	"\033\270\303\255\032s\021/)\022,\241\273\033\254\232\261\022"
+	.ascii	"\203\345\224(c9-\021\224\304\234\004p\003,\370,@e\260\314P6\200"
+	.ascii	"\005"
+	.text
+	.section	.gnu.lto_.inline.329c1bbf776cb319,"e",@progbits
+	.string	"(\265/\375`2\003E\016"
+	.string	"\006R@: \005)\035\021;\204\206y\355\364$\030"
+	.string	"K\223\003\3166\364)\013.\350T=\n\244\r\b\240\350\377\b\021\013\t\bDA\323\205\224/\r\361\304\333\267\275\367\017\3036\"\323N\001)"
+	.string	"1"
+	.string	"2"
+	.string	"0]\376\013\264\257\244\375\177\350\032\221\320fI\206\315\215\377\251\202\\{\376\177P\013\263\315\177\t\267\t\363\316\377\206\226Tn\025n!\314,#4(\250\226`\007\314\372DY\326W\326\347\266#\256\036\2271+*&P#\r\013\233\027.\221\325b\275\211\002b\354\272\232+WS\004\337\377h\020\221\227\032\203\"\270<\203*\275\362\344?AQ!\007-\306\377\214\326\225\263\377\237\236:d5\016\b\213\374 \271\2619\264\240m]\306\371\257\n}\216\272\212\235\227\037\267\260\215e\230H\035[\200\317=2-0&\023"
+	.string	"\217\224\331\251\252\n\333\313/\344i<9\361\345\233\254\026\213M\265\034juU\bA\007V\250!=\b\311\f\r\203\222B\2065P\2422E\351\001\022"
+	.string	"\0249\305\341\2641\310!\252\3142K[\317\203(a\3029\336\232x\246%S\347\r\334\320\r\237$\315}\025T\227@\265\303\020'\236ce!WI\361\361\005\300A\302x\210\031d"
+	.ascii	"\315`\2373LO7\361\246~\335\026`\340L\364\223n0\350\223,\3138"
+	.ascii	"|\304|\356\340\257v\327\331\001\224#\205\233 \034\327\273\351"
+	.ascii	"\r\347Q\375\372\242L\327\234\316\210\006\b$#G\252\206\207>\b"
+	.ascii	"\362\221\034\035\314\276\263$6\325s[\303\221,}\007\322B\363\031"
+	.ascii	"\353\3169\3065Ip\t\260\352\207}\036Y\305\276\260\022l~\377O\267"
+	.ascii	"\201\016\211\302\370\016\335\030"
+	.text
+	.section	.gnu.lto_.jmpfuncs.329c1bbf776cb319,"e",@progbits
+	.string	"(\265/\375`\270\001\345\b"
+	.string	"BM,1`k\222\0160\f\303I\020(\336"
+	.string	""
+	.string	""
+	.string	"A\035\350EX\035,\261\240\220v\202Z\345(-\f\205}\226\305x\005\263\005\276\365u\272\315\266\244\311$\003\264T\233\252\242&\215\213\315\004\325\321`p.\034\033\031\023\325\321P\225D\205\274\3753\206\250V\304\377,T@\201L`{\346\212@ZnK\307\245\343t\212+#y0\251\260Z\224\240O)-X\344C\356\264\312\207\257\nB\\ \217\033\226<%%Vr"
+	.string	"\202\246\351\314\265\214Zk\255\224\2115\346\036s\235\035-\310\275\315\221s\270\337h\315.\316\256I\026"
+	.string	"\320Z\317\037\311\210\006d?\002, p\202\231\261\341\003\"\tJq\026\b\247\261RB\376"
+	.string	"(\336YgQ3\303~:/\321\0274\221\006 s\2771\036vc0tAJZ\327^\347\250@\331"
+	.string	"XrpP0\304\250"
+	.ascii	"\024R\373\033\232\261\305\200R\020\203\3004\336qc\n\215\025\306"
+	.ascii	"\260\215\206\355DB+.(&.\\\340\227}\177\250\264H\003/\002"
+	.text
+	.section	.gnu.lto_.pureconst.329c1bbf776cb319,"e",@progbits
+	.string	"(\265/\375 2\221\001"
+	.string	"."
+	.string	""
+	.string	""
+	.string	"\017"
+	.ascii	"\230\004\006\232\004\007\230\004\021\230\004\025\230\004\031"
+	.ascii	"\230\005\032\230\004\034\230\004\037\230\004!\230\004\"\230\004"
+	.ascii	"#\204\004$\230\004%\230\004&\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.329c1bbf776cb319,"e",@progbits
+	.string	"(\265/\375`\177"
+	.string	"\245\005"
+	.string	"2\207\024\035\260'\303\001\f\223\206a\260&I\222\305\332\266M\2104B\366\001\2215\242\255Y\"S\njBm\025B\001\213\017\033\322\2632\3649F\266\2166\332\\\330\213b\242#\314\226\231\243-Z\346i\233\026\320\201.\327rtW\331T\264\300d\353\307\226\340\212* `\0022f\346\001di\214\351\214\005\333Y\247"
+	.ascii	"\0339b\002\034\210\256#X\247!\311\001\277\373h\326\222X\020v"
+	.ascii	":0@'\330\036\323\304\026\002<\311\333\264\"cFA;\352\360\205I"
+	.ascii	"}\323\276\253A\026b\373\307\214A\221\257\030\305^@\024\320\200"
+	.ascii	"\313-B\364x\321\313\355\370\302Z\031\002"
+	.text
+	.section	.gnu.lto_.lto.329c1bbf776cb319,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_attitude.76.329c1bbf776cb319,"e",@progbits
+	.string	"(\265/\375 4\205\001"
+	.string	"T\002'"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\031\001\025\001\002\005\001?\202\210\200\030\1773\273\0014\273\001\274\001\273\b}{\275\001"
+	.string	"\003"
+	.string	"f\nK\tz"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_imuConfig_Registry.80.329c1bbf776cb319,"e",@progbits
+	.string	"(\265/\375 \222E\004"
+	.string	"\244\007`"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\206\200\200\374\342\303\345\261\037\006\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\314\006us\350\345\005uq"
+	.string	"\005\001\006'\001\b\026?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/imu.c"
+	.string	"\004"
+	.ascii	")\"\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_imuConfig.82.329c1bbf776cb319,"e",@progbits
+	.string	"(\265/\375 O%\002"
+	.string	"T\003B"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001(\005\001?\202\210\200\020\177}\273\001{\273\001\031\005\001\006'\001"
+	.string	"\304\023(yw\300\001u\277\001s\276\001q\275\001o\274\001"
+	.string	"\005"
+	.string	"H\005\006\327R\006\270y\331"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_imuComputeRotationMatrix.83.329c1bbf776cb319,"e",@progbits
+	.string	"(\265/\375`'\007-\035"
+	.string	"\246\263\255G\260\326Qc\324\230p\205kH\254\224\033ZN\220P\203@\363X\367\261_\250T\202\274\303\317\227\332X\202\3166k\343\325\013\b)\337)\375P\337\370\371\371\351S\3205po,\212\363\363\341\002\t\310@kd\357$S\n\237"
+	.string	"~"
+	.string	"\233"
+	.string	"\272\226\026C|\246\220$\210/,\244\220Q\007\013?\331B\033\312\216\262\247\354*\333\312\276\262\261<km\031\236a\032\2262\225k\330\206oxX\032\226\326\202\253.\005VF\022T!A0\225\344@\224\222\002PKv\302\016oK2\344\007\237W\223"
+	.string	"\231\307\032\206c \371\251CYR\b\234r\213\n\023\222$\003x,"
+	.string	"\231\307\233o`\036E\327\300<\026\251]ba\220\214\231\310\342 E\205$I\335S\030\311\023\251\366\320\263\237\210$\317\030\002\222$;\177\"F\270w[\\[\006m\fE\245\223\3179\254\243\303zE5\024k\372\347\261.\026\314\243?6\361\252BBi~\265\302\244y\024\255E\362'Z\317\346<\033\344'\027g\241\013d(\367\307Q\356\315S\256\315Un\315V\256\217\257\334\036c\271<\236\335\361\254\216gs<\213\343\331\033\317\332x\266\306\2634\236\235\361\254\214gc<\013\343\331\027\317\272x\226\346\331\026\317\316<+\363l\314\2630\317\216\236\025={\317N\317:SJ \355\\>b\244\313\345\001k9\r\350\266\267\274\307\304U\002gA.\262ED\366\331g\226\322\351\366\237\313\336c\322*\233b\327\352\020&\330V\200\203\020\271t\221$i"
+	.ascii	"\210\263\212\352\025\036\313;:\202y\234R?'\260\317\330]6\r]q"
+	.ascii	"\211$\225p\343aw\351\344\363\236\217w\t&\037%p\036w\033\215\322"
+	.ascii	"\311\347\003\275v\245t\362\371?\257=\371o\257!\231\267\275\266"
+	.ascii	"%\336\257\375\270 ~\314\021\345\377}z`x\225\371\371\236\035\031"
+	.ascii	"\346\307&P^\370>\317\235\025;\336\216'\n\361\204\b\360\304\335"
+	.ascii	"\200\001<Qh\307\023\t\360\204xb\035\344.\020\r\351,H\21004\001"
+	.ascii	"\202\216\302P\003\"\235\003\243#]N\247E\025\036\030\351,\024"
+	.ascii	"\025\031\351hB\322\"\371\023\n\\\bQ\272\257\271\237\207\016*"
+	.ascii	"\250l\236\013\232\345\334\260\344\241E\034\301\257\337\313\203"
+	.ascii	"\336Y\356\\i&MRg'\347:=\347y\316]\"\310U\002q\260\\\261rs\034"
+	.ascii	"\334k\277y/\250Us\033\333\201^\363^\320G\331D#%\n\224\231\323"
+	.ascii	"\324\216\373\314{A\252\262I\246\t\023\257\030\031\230\307\360"
+	.ascii	"\034\346\253\004\372\\\376\362\363\333]\336c\n\200\205\250Ql"
+	.ascii	"\306\f\215\314\004\232\024U\322\0320\003\221\321V\007\021\220"
+	.ascii	" \250(2Bh\212\n\n+\303\030\202\335\262\025xQV\303\340\324\023"
+	.ascii	"l\324\311\037\264\r\366\351[\354\016\272\262\225)9\003\032!\364"
+	.ascii	"\375\325\025V^8\224\341\365a%\335\033\375\024\335\222^\357\320"
+	.ascii	"\240\327\341\036\224-\314\214\304\324\333\376\316\rH\"\016\315"
+	.ascii	",\307\212=\"u\350h\336\271\322\325\360\263\"\350j\272\b\024\272"
+	.ascii	"vq~J\215{\363s\347\350\250\376$k\323'\026\007d\224 b\001\341"
+	.ascii	"q\300\006\202\357\300l\332\026)U\273\221ME\240\261\002\221\341"
+	.ascii	"ZoH~\306=f\346D\231\002\351\237\216\211\256\270p_=\361\300%s"
+	.ascii	"\226\252\3674\264\325\220\216\264\277\353v&\025q\305J\026`\220"
+	.ascii	"\252\2511\260\252\244q\250\250\324\031\f\226C\024\3174\025\274"
+	.ascii	"\324Bc\177"
+	.text
+	.section	.gnu.lto_imuConfigure.86.329c1bbf776cb319,"e",@progbits
+	.string	"(\265/\375`\273\002\355\022"
+	.string	"\026$|G\340\320(\035\362+\210\332\016~\222\034\\d\226!\036cJG\257\216\016\226.\262\226aE\334F\264\343~\361\177\346H\331\326j\020\324\177\037\336\205wH}\200\001\006\315 \330\250\"\016\267\361\307%\223\260\337\310&R\246\024_"
+	.string	"\\"
+	.string	"p"
+	.string	"\273\035v:6\027{L\330\276\257\3428/\267\2714+\002\037\355\027\033|<h;\323\276\315S\300^\333\340\270\033\302fg\327\226\300\007L\217\001>\340{\314\013\370\036\r\263o\334Fb\177\253\221\271!\355.JG\034\366\204\371\277\371)\234\341\360,\231\354\2563\234\361p\353m\217\3306\261\265A;\247\252~B\262\243k\352ev\230u\026\027L\2731%\376\212\337X|\332\243[.\371\360\321w\371\036\257\340L(\251\026\313\235m\203I\025a\337\333\335\265\322\330\257\375!1\r\022\323\037\231\006\277\264\307\227>\305\264)\246K\231\376\274t\214i/\2465\323\351\245/\002~ B\360\0234?\260\216u\276G\005\264\026\241\316Cm\b\037\022\362\tu\021\036t\002\344\241\240n\306Im\t\2271\341\3073\nu\024\356s\022\343\244"
+	.ascii	"fCI&\265+\274\207\247\244\246OKQ?\224\353\344D\005gC55O\355\224"
+	.ascii	"\3030N\304\306\356\226\370.\376\"\245Z\255\276G5\nu\270\363\004"
+	.ascii	"\335r\353\005\273]\215\230\335\330\210\252\247\227\241\200\311"
+	.ascii	"\252\225UK\nJK\213\365J\251\\\256V\nE\265\362z\265\\*\257\002"
+	.ascii	"N\221h`a\241^*+\326\212\005T\013+\205\005\225re@\221\020p\013"
+	.ascii	"\203\312\205z\265Z.\024h\213\335[\2451\003\020\271\230\302\370"
+	.ascii	"Ci8\370\315\275#\032.\324\201\250q\317Qt\264\006>\3642 PA\364"
+	.ascii	"8\217;%p\310\216B\024\324\027\r'\263#v\"\307\206\344\347Nd\234"
+	.ascii	"\0371 \340\002\021)\243\007\222CCM\201\031H8\006\273\223r\226"
+	.ascii	"\225\330\244\b\264\265n\356\347\270\016G\206W\247\bU&\021k0n"
+	.ascii	"\245\217\007)\256\245\016\213\231\215Ye\006\323\342\222\005\301"
+	.ascii	"\302\335C.\030\303\033\365`O\266[\261\230!\306\2061\212\344\034"
+	.ascii	"\3154C\\G\230\220\365\202h\315\t\307\276\024\211\330_\201\325"
+	.ascii	"\362B\310d"
+	.text
+	.section	.gnu.lto_imuInit.87.329c1bbf776cb319,"e",@progbits
+	.string	"(\265/\375`\252\001\205\020"
+	.string	"\326\337mE\360\322$\0352\267\240\276b\330\302N\301\027"
+	.string	"\260\025\323\2727d\376*\230\035\213\204v\3005\004\036i\330Z#\300\360F\300;\216M\220\273\023m\232(\245\0071\271_\224\364\203\340\032\373\262\376\267\221F\366\2262\245W"
+	.string	"R"
+	.string	"b"
+	.string	"\351\247i\315t>}\001'\253\344\203A\217\335\230\230\220-\202D/l_\304\234\215\364\027\315\276\347\007\246Giw7mq\356O\223\363\177\363Stu\177\232\212\353S"
+	.ascii	"\033\002\002\300\325z\003b\\\304\337<Q\270X\231&\b\273\353\214"
+	.ascii	"\256\0247\274m\023\333$v6\b\207\251#&\005HU\033%%\037\337H\246"
+	.ascii	"\332)\021\371\250j\240\245\235\257\251\371\003f\210U\256\243"
+	.ascii	"\322v\327\201\217\363\034\023~\315\241Y\\\362\361\320w\311\016"
+	.ascii	"\257\032W\304`\201\223\263\312\230\375\352Rg\354\277U\031;\323"
+	.ascii	"'Mk\2326e:{i\250\001'\035\361\261):\241\235\013\244=\201B>:}"
+	.ascii	"`\024\261\264\263\366S\301@y#&\231\324A_\236\243]?\210\305\220"
+	.ascii	"Z\273+\004\232\376\005\007+c\316\324\244\220\307\013\fj\246\267"
+	.ascii	"p\033\027H\214\214\34152$0\232q\032\0326\234\234d\207POD;\226"
+	.ascii	"r\236\372;\347q\220_c\016\0062P\026F)qQIm-!@\244F|\330H\244:"
+	.ascii	"\250l(+,[\t\001\253J\244\254l-*\325\312&\362\332\277U\031\277"
+	.ascii	"\034\273\004[)\353q6\252\235\375\352~\232 0!\325\031/\370I=\354"
+	.ascii	"\034\2652\210\017\244\317\341d\227q\"\224\266\273z\364\205>\304"
+	.ascii	"\351D@\345#*;\264M$\344c!  \002\203\020d\353\001\023B\347(\206"
+	.ascii	"~\340\322-\007\315\256m\230\312\262\212\303\223\331hpF\024\256"
+	.ascii	"\270`F\374\2218C\027l\017\267^\245\007)\312\">\202\025\210\201"
+	.ascii	"\201\323\351\035\332\0052\017y\233,g\f\375\335\346\304\006,\354"
+	.ascii	"\317\020r\351\242vh`\006\n"
+	.text
+	.section	.gnu.lto_imuResetAccelerationSum.88.329c1bbf776cb319,"e",@progbits
+	.string	"(\265/\375`\227"
+	.string	"E\t"
+	.string	"\026P<9@o\323\001\240\273-\303p8\235\334g\354\023U\313\202\rVd]\007*\016Z\322\257E^\363\251\366V\252F\237f8\353h\370CbN\006\217\300\"\372D\330\247m\367N))"
+	.string	","
+	.string	"-"
+	.string	"\307\354\3310\037;\366\245\227\214\322jw\353\344\270w\351\371\3778"
+	.string	"(\n]n\022v\327\022\024\215\356y\333\003\266\t\354+\004\017\261\360\303S_\200\344\301S\037t\235\316\324\214(\363\311\226=\206\344\334\260\257\331I\2627X\252%c\331\325h\261\026EW<l\007\017M\321u\037K\374\311Q|\362C\177l\262\351:\245#\325KnR\222\367\351R\211\007'\031Y\025\334\266\301E*\002\\v\027\301\007\t\346d\237\216V=\020\017Z\204C\225\320\030:\225\303u5\023\3606\321\300U\317\266q\025\033\367\232\235\244\205\030\32471\354o\227\237r\225\315\001\025"
+	.string	"3\241\215(\360\rz\373\250\274H\355`0\362'\226y\030\f\001\343V%\0320\f\340\200\370\234\342"
+	.string	"\355\022U\002\272\206\223\2050^\206"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_imuTransformVectorBodyToEarth.89.329c1bbf776cb319,"e",@progbits
+	.string	"(\265/\375`\032\005]\031"
+	.string	"6\354\226G\300VQ:\024\034\037\241q\202\036J!\203zS\t\337\313\250\220\226\275T\b\240\373TY]\311\372;\322z.\304\364:\220(\241\313u\025%\333\020\004\266\240?\307\016\210\345D\237\352\243OuS\365\325O\032\267MR\246\206"
+	.string	"l"
+	.string	"\211"
+	.string	"\023\305/\314d\"\231h\350\221j\222\252Oo\253\"\251\222\3560\3137&')\204\200\021\257y\202\304\257\306\201\260\247:vz\024\"\374I1\343\3050\201e\316y@\245\r\204*\005\244tm\305\2419vj$Bas\016E\005\231\263\227c\234P\245{*\003U\206\032\003Uzg[\321\036\321T\301"
+	.string	"SB\311\313\234S|\f\335\351\356\254\272CW<\025?\272\252\006sN/O\305\n\365\3256\001\333:\266\314\021\nxh\217\f\326\031*\275\241\303*O\245\265\003\250R\257:\372\0251\001\355\317\356\375\354a\330\232\232\037\262\365H}\323$\365\215\372\32465R\r\360u\355k\332\3276_\317\276\226}]\363u\354k"
+	.string	"_\303\276~}M\363\265\353\353\231\257[_\263\276\226\371z\365u\370\265\352k\360k\371u\352\353\177\275_\353"
+	.string	"W\213&b\224\031Q<\342\2408\315\274\365\304\211\316\326\204\025%s\325m\337\037B/V\017/\363\232\323\216.\361\250MJt\\]\233\324\210&\361\250KHt\352;\262\352\246\353\022\370_u\371C\350E\320\376,\237:xp\313\004-\342\221\001\221\005\362\frt\210G\234\020\235\310\224:N\006\323^\377\247\224\204l\004\3454\210G\034\"\273\202\216<\341\2343\001\020\007=\005\236f\210"
+	.string	"U\356qd\030-y\274\021\331F\240>t\266\2479g\036\364\203\202P\016\352\b:\033xr\242\006\n\023r\026$\210\027r\020x\304\b>\031D\035\232{0\354\370\210\032zz|DVojj~\310\017\\0\001z\220o\267wv\376|E,j\027\023F\235xP@\373\363\315k_pc\211\020\224\355_<\266\236\242Nt$\245\"\026\264\317~\263\371\352\264.\\\266\330\310\036\373\254\346\3622-\036qPYj\036\273b\245\n\200\253\220\222\212`\247\371\315\353\253\303\250L\321\251O\312\313\365\326if.\357\nf\250\201P\245\2244B\"\005)(I\322\032\300\002\221\031*;\021"
+	.string	"\235B\020\242\222b[c#\232\276RP\004\340\236\365\265\025N\361%\356[\341\216y\270\2515\206B\204g\310\314\254\361_?\340\366N\303cC\347\217X\202\375]\351`:\263\357\207x\266\255\357\366\334\323\363).F\247\245^\240Z\tG\326P0{\212\322\237#MG%c3\177k'\036\021\302\364H|\0246.\314\t\035=h\304\344\360dE`\211^\203\340\356\034\t\302L\016\224"
+	.string	"\336u\302o\257T\256\211\024\201\325A\n\222\316C&\024chbx"
+	.ascii	"\023\007\204\324\200\330\327D\177\263(c\207\324\212\230\316\364"
+	.ascii	"\330\323\rz|\335H\261,\017\222\nmj\261\255?"
+	.text
+	.section	.gnu.lto_imuCalculateAcceleration.90.329c1bbf776cb319,"e",@progbits
+	.string	"(\265/\375`|\n\2351"
+	.ascii	"\252X\300\022AP\344J\007c-f-\260\203\252zG!\321\247>G&E\324:"
+	.ascii	"^\bd\205\370\301\003\373\243\332\006p/\034\003\303(ZC\241\350"
+	.ascii	"\271\002[(\032\nm\261\204\"@$\024\r\302\b\221r\357\224R\n\005"
+	.ascii	"\001\007\001'\001\325\331\251:7Ug\246\352\274T\235\tTg\245\352"
+	.ascii	"<\300:'\031\235\005Tg\244\352|T\235\215\254s\221u\016P\235\001"
+	.ascii	"Xg\242\352<T\235\205\252s\220u\006\262\316G\353\374St6\026\235"
+	.ascii	"\213\325\331Z\347Z\235Q\353|V\347\267\316^\235;\303\320\2235"
+	.ascii	"^\315{q$\356\271\204(\240\222\346\353\306\322\250\237~2w\367"
+	.ascii	"\265\037\037\231\031\013\214\2476\242k\303M\016\357\336\333\305"
+	.ascii	"{}%m\276\030E\265\034cuv\207\367\346\260j\224\263\212\2152!P"
+	.ascii	";sS\351*i3e\260\361\336!j\300\334\273\207\305T\305F\237\372\250"
+	.ascii	"6zvQm\224Sf9\275gwm\335\322\315\017\317\275\027\371u\235\266"
+	.ascii	"\255\350\371\236r\033\225ojm\253\362\r\256\321\036}\n\275\315"
+	.ascii	"8\237\356\275\307\2676\377\263J\016\r\017\241\267\344y\264f\016"
+	.ascii	"N\373\265\333xcs\267\017\356\275\354\3127\035\315\305ff\027\314"
+	.ascii	"\374\305\374\263\027d\020\231J\336\177\335GVT2S\260\340\255d"
+	.ascii	"\377r\206\260\355\325\330>\363\2056S\337\266`\227!3\306\233\005"
+	.ascii	"k\243\025\021}\346\262\026s>\212\325a\3004\3177\316\t\352\001"
+	.ascii	"\3763kh/\3344\342b\336\320}\034\206ZI\307\377\337\323\\u\027"
+	.ascii	"3\251.f\017\315\345l\311\356\336\313\245\245\267\240q\037i\224"
+	.ascii	"\323Dx+\033\345\026Q\033\3657\316\005\"\0026;\351cN\220\313a"
+	.ascii	"\211\211f\332\356]\203\352\017{\367\222d\302\346\211\354\340"
+	.ascii	"\373;\350\335I\036\256y\"\363\236Z\237\367"
+	.string	"\336\353O\307\334\347\275\367\362\023a.:\227Y\347\n\326\231\314:\2175\226\346\260fv;\260\316`\326\371\353\350\354ut\356\262\316\r\2543\227u\336\372q\326\252\316\f\254\363\202\242\263\002\353\234\300:#\255s\326\2173Vu\276\262\316VE\347*\353\214\300:\037\260\316T?\316S\325Y\312:G\025\235\241\252\263\201\352\\\240:?\005t\n\274\323\033\370\347\223\224{z\246/\360\325N\222\211\3237\375S\0337[8}g\3615n\366_\3735}\377\3351\227>\354\231\376\214\2234\023\366\004~\351;)\227\350\227\233K\370\013\177\251\215\022\370c\2356\210K\253\304g\300#\275R\322\017\020\360I\337n}\326<1\257\365\244N\242\n9\205\322yR\275\246BD\001\037e\310\274\203\364\257&\316\303\330Y#\244\036\275\035\243\007\360G\337I\274\2427z\347\223<\f\360Et\002\374\224\341r\355\220\233HG"
+	.ascii	"\036\355\033\324c\242D/g\350\211\276\223\203B\037\364Cp\270I"
+	.ascii	"5%\364TwL\240\017z01\311\303\343\377<\320\277_R\356\301\317\037"
+	.ascii	"\277\223R\n\333\320\354E:eJm\364\347\215l\320 2\231\0318"
+	.string	"\360\316\247c\246Z\366\355\327E:\335L\325\370e\317\356\266dk6\335F\214\373\b\247UR+\251\225\332\250\361m\036\032\275e'Q\312\021\376\323q\213\325\342\177\3503l\363<\314\f\241\t\305\212=\330j\"H\230\340\255\234P\033-\276\335\021\030@8\210\264\023\036J\244\241\241\235\0311\234\261(\221\006\2422ZV\013\023$\220,F\210 Q\"\004\362\004\2113\023H4\025+\220YI\214\"E\232\n$\013\024(T \217{\267\317\373D\230\002\024\302\265g\343\030\347\275C\302\232\257\373\220\317\023\031\354\247\\\365\327\203y\024\327c\301\035\034\030X\033\375\372\217\023\267\364\372'\016\276\353\275<\317\233\310\350\221\302\301\325F\273\036e\203\203\270l\360K\360*<\3277\360$H\270\026\374V\005\255\337b\240u\307\340\243\356\226\n~A\234\327\211u`\221TI\377\321)\370\255\035o\364\230?7\204\354\221\237"
+	.ascii	"\313\203\230\025\201 \255>\213\f\353\263\256\260\312\334\307"
+	.ascii	"U\325[\305-\341\252\020"
+	.string	"\231\b\276\207YP!\217\036\373\003\217\340\333u\230u\261\347\360\267\263\324G\372\343Gm\364\300\007\031\002&\360\250\247\022\222\316y+\307\376i\306\253\361\324Sa\271\3243\247u\351]m\345\324?1k\360\033\334\214\322\262\223\372\250;\250\217z\0274\342J\261\026D\3425R%\235\245p\320i@\375V\236\033=\246\201O\272\027e\200\300\250q8\004\221Cj\210$%)I\322\032\260\002\021\251\"v\0210%CNQ\315PJ\205v\003CF\265\3241\237O\\ \216bk\n\323.\244\370s5\253e\363\2234\360\033\206\347tu\332I\260\274{-\035\005\004-\b5\001\036\007\230\344\207\260*\214Z\007\024k}p`4\244>\033-p\233\307\265s\250R\2200\377\206\251\251>\323\326\002hm\370w\027\301Y\275\271 \214\333:j\3026\262\300p\220b\001\333\333e^;>H\364\371\254\022\027#\303\303"
+	.string	";A\005\210j\352\352\256\364\314\303\354&\206\362m\302]w\f\020\233\354 \0173xP\304\332\374\220\210<6[\034\275j&fC\220\315z\035C\206"
+	.ascii	"\352%CqL\257c\260@#\274[8Y\304f.\n\331d\343\204\b\276H\221\333"
+	.ascii	"\022\211\346\0368\035r\254\271J\002\214. M\025(\220j\364\303"
+	.ascii	"v\"U\",\261\221\375\372\301\364p\371\300\203\2015\351\211-\370"
+	.ascii	"\207\243Ue\022\366\340M\247Wd\232^\315\361\225\321Np\355\b\331"
+	.ascii	"}\267^\217\004}t\020s\343\376\261\257\305li\230\261\372G\277"
+	.ascii	"u\360\226y*v\213\027\343\210\331_\331\330u\006\024|\232\345\344"
+	.ascii	",\302=\212\373\005\312.\273\b\360\335^#s\302$\330\006\027b\336"
+	.ascii	"\243\225\"\322\270e;\b\270\325?\230S30\252*\370\026\261\300\356"
+	.ascii	"\n\322\233\273\032"
+	.text
+	.section	.gnu.lto_imuUpdateEulerAngles.95.329c1bbf776cb319,"e",@progbits
+	.string	"(\265/\375`=\005u\034"
+	.string	"f\262\254H\260\226Q:\021\241\b\255\360|H\365\212\031\256\027*\357\245\033\336\r8"
+	.string	"\331\215\005\335\304~\331\360\324\245>\357\335\032\023l\230\020a\307\033P\247\260\274\200\261b\033{\2756\031\300\007\377\354\017\261\035\350\3366\262\211\224)\005\212"
+	.string	"\213"
+	.string	"\244"
+	.string	"\276\271\332\346\352\232\253i\256\236\255zF\3252W\313\256\216\271:v5\354\352\327\252GU\313\253\305\253\367j\275\372\003t\204W\031\202\314\311b\bfZI)\034\266/s\221}\345OL\363e\003\212/\252\313\234S\2675^\364\327(\305\325\"\377\265 \366\003\032\375\005\343c\f\020\306\345\f\330\023}\346\234*TL\372\212\001\256dT\231\001\221\304\235%\252\244\363\270\256"
+	.ascii	"\036\251\276\026\3149\255?\240\213\033v\333(l\013\260\345\213"
+	.ascii	":\264\334qw\312'\244Qqm\240\016\343\177r}\220\202g\261\244dN"
+	.ascii	"\323\220\346\344\001\330\025w\261z:\216th\031\375\352\332A!\306"
+	.ascii	"\377v}T\254Q\201G\001\331\351\240tc?\034\f\220\325\343O;\005"
+	.ascii	"Ls\316\004>\356$\344\337\270t\t\"\375\357\322'\032/\365\236\032"
+	.ascii	"/\277\261\035[MR<\035\332OF\2724\354\213sg\330R\335#\3259\251"
+	.ascii	"\306I5\317\325;\253\276\211j\233\250\326YuM\3259W\323\256\306"
+	.ascii	"\271\006[\3335B\313\301\331\233"
+	.string	"\245\355{KG\307z\024\007\375\033\206\340#>2^\342lN\212\022O\2076{\263\266\252\232\265Y\261\252\247\305\233-M\315\225\325N\007\205fcRU\016\n`\242\332)p2\333X\024W\323\314\332\021\336\204\311\022\231\235\331\255\222\311\320d\273Vz:b\353\340\205\370\270\2544fm[\275\0347\205\255-a\302\370_\354\265\260\275E\365\264\b<\211\203_\302\204d\367\251\254\340k\017`muI\215kS\270\221\237\032\223]\341E,\314\262\346\234\b\206\234\310\005\f\032\364?\r?-^\0062pb\027\2443\001\342C\220\b\017\272\021A\033v:\240!\"\235\001\233\205Ht\030\322\231\020\022\032\322\311\236\346\305\2713*\f\255x{\364\352\021\236\313\213\234\306\334\366\354}J_r+\205MF\334v\301\236\033y\026\267\367%m\235\253\310\211A\203\006\343%\317\312\2510]J:\3474\222K\303;\373\345"
+	.ascii	"\365\004I\275lq\260\2632*L\223\222x\323\362\203\313b\201\206"
+	.ascii	"\305\266\267\275O\310\323\241q-\236b\324Y\333\322\221\316\222"
+	.ascii	"x2\364\t\237d\353*\306\372g\254\255\r\007\017(*$\365\342\332"
+	.ascii	"\332\017Ne\212\224\234i\250qP\343\210bhfD\223\202\224\322\030"
+	.ascii	"\260\002\021\2419\333\021\3600\310\234\232\032\266sCa\312\245"
+	.ascii	";\265\203\203q\220\254\241V\017\026a\213\017m\274\306\026\315"
+	.ascii	"\263y\237\300\f\365\203\017P[\245*J\2040{\362]L<\206\307x\201"
+	.ascii	"\213\365\325\360\333\335i\376Y\266.\034\006\177n\232\325QL\n"
+	.ascii	"\n\206\346\030\221\006\222\320\313\t\233\n\005\277\026\022z]"
+	.ascii	"\352\235\301<\2730V\234\013?\264w\027_\266\325M\331h\306<\211"
+	.ascii	"\264\336\200\374y\353\"\2731 \273\3061\373\316)\351\254\"\\\276"
+	.ascii	"\266\351\316_d>\317\265M\213\016\004\252G\005tn\314-\344\244"
+	.ascii	"\221D\362J\317\253\201:\241\213 \340;\214hT\337U\207\2204\366"
+	.ascii	".b0\342\354\223\2418\260\013zW\246\220Y\r"
+	.text
+	.section	.gnu.lto_imuCalculateEstimatedAttitude.98.329c1bbf776cb319,"e",@progbits
+	.string	"(\265/\375`\031\0035\026"
+	.string	"\346h\217H\260XQ:01\216\261\202\377!\205\240%\b\335\370#\365 \333\210c\201\001\275\322\024\035\254\004\243S\213\336\212\362\244n`h\311+\300\276f\353\224o\334\221\235\017\343\031n\240~\267\366\344\266\200\335\254C\204\354M\244L2y"
+	.string	"t"
+	.string	"{"
+	.ascii	"\341W\365I\327\305\216\243\203\276t\243\230\022\244{\274\321"
+	.ascii	"\001\341e\3523\363\362;\200y\2511U*\037\217\032l\301\202hG\226"
+	.ascii	"\356\026yElc\017\301)?\336\230\276f\223=\004wP\214\270\035\374"
+	.ascii	"\bT\021\202\345LD\334\276\231\020.j\337\021\355\214!\342\266"
+	.ascii	"\322d\363\260\037\217\266\214\262}\370R\335\375\335\027\204m"
+	.ascii	"\266\013\356t\267n\3156\342\372rU5\241\252\bT9'JB\372\234np\355"
+	.ascii	"k\227z\327\274<+\2301\005\247\273\rm\027\325q\266l\244\372\257"
+	.ascii	"9\205j\270\032\023\256\242\302\325\323\307kx\034?\b\256Jp\225"
+	.ascii	"\347\352\312\325\313\350\344p'Z\344\330\311\330!\272p\351%\331"
+	.ascii	"{\361\361\337\352u\234\247jR\016\317\241\t\220\216pI\227\252"
+	.ascii	"\034TM\227\377NM\252:\n\245hc\333t\244\030I\312\322=\026\270"
+	.ascii	"T\003\001Jd^\306\360\225t\354n\311F\275\243xU\334\274\210J$\342"
+	.ascii	"c3\004\305\"\224\336?6\322\253\346\211\271\211\315\205\250\004"
+	.ascii	"<\351\356\234\363\364\301\203\370\0048\352\356\003?\016\344G"
+	.ascii	"\237\273\324\025\2135/O|\336\367\305\214\"\234\256\267\335-c"
+	.ascii	"\r\232\313\021tD\241\355\026\205\331\360BS\265ea_[f\035)\322"
+	.ascii	"R\205\3062\005\271\007\210\264\244\306\2113\310!\377\312\007"
+	.ascii	"\030\263\363x<?\260\013,\t3\250\207\345j\361\3000\260^/\r\253"
+	.ascii	"\223\256p4\270Z\"\254\002\205\326\205\t\"\206\326\217K\\\275"
+	.ascii	"\202D\034\032\005\312\300z\2110 \240\227h\032\207\3765\247\200"
+	.ascii	"@bi\210gJ\263!\253.`0c%\204\331\224\376F\021\215e\307\311(\341"
+	.ascii	"\003\254\231\222\277{\210E\3465\223Y\262.\321M\311\227\3644p"
+	.ascii	"\260\2579\230\227\3146\220h\340t7^\352\226\315\230\033y\022\325"
+	.ascii	"\225\220\370\234wd\0379 p\002\2311\243\033c\241\207&0\352\253"
+	.ascii	"\251\266\251qX\210\226y\256\271V`\274x\025\024)\341A\231\214"
+	.ascii	"Zh\207\217\002R\241@\252\254\355\366v\314.\2330\256X\3515 '."
+	.ascii	"m\275=\030w\253T<[ge\204\235\035P\205\242\231C\242H^\2402$n;"
+	.ascii	"\210_p\327XS\315\327\244}\306\260\260\2068\254\207\315&&\307"
+	.ascii	"\260\037\211\301\345+C\033q\270\267\030\313\032\276e]\037\312"
+	.ascii	"\302\362\231\333\204\240\007"
+	.text
+	.section	.gnu.lto_imuUpdateAttitude.99.329c1bbf776cb319,"e",@progbits
+	.string	"(\265/\375`\244\001\325\016"
+	.string	"F\333aE"
+	.string	"\261&\0358\327\211\226\302\377js\233\343\372\367\020\311_\273\204\372\3073\035\257\002\202\006\203\033_o\324HZ\370I[PZ\366\344\270I\350\004\f"
+	.string	"\300\240!\"D\300\023\013\020zt\210\302\252-\331{o\231RK"
+	.string	"J"
+	.string	"M"
+	.string	"\363\322'\033\307Y\252}N\207\r7\256\335\315\340\314O\2372B=\371\030\312\207\367u\237 _\314%(\3461\036\310\241\3633\002C\302\013})\205\"\237\206H\262\273?q\345\360\275\250b(\273k\365>\0177v\333\232\355\004\266>7M\333\002\006\275w\b\300\347C+\005;\233\325)\fa?\356\356\032\312\330_\375R\325\252\352\207\b\370\324\270\260c\027\346\325c[r\247D\310\366\325\276\211\327\234\276\312\340\217]\02080vY&6"
+	.string	"\272$\371\310\274\214\017\020\2278\330L\217K\007J_\206\"lV\314\220!*\241\255\262\351=G\330\331<54\252x\233+\374\217=\341*\\@\273\253\300O\361\233\221?\342\322$\026\351\263\314K\205\005l\254P\372\272\356n\007\3552\017!\240\270\221R\036\236\252\001-\rD\243\215AiE\304q&-\304\332\211i\264e%\t*\033\205\b\331\312\2262\3124\256%;\031`R\005\021\227\225H$.\013\261\366q\241\214\035\320h\241\340\313,\271\316yb\354\350\3353]&\317y\341B\006M\311m#x\213\007\002T\273\273\300N9\013MD\025$ \340\202\0311\233\003rB\027\311\300\210`d\262\267\270\215\303\257\031\237\007\343\227\257\020\366`\334\203\211-\367\211\2645Z\342,\207\254h\313\"\224\262\311\371\f\277"
+	.ascii	"\004\304\n\321ox\345)'X\342\232\"^\302\201\237\367\3251\262."
+	.ascii	"\344vA="
+	.text
+	.section	.gnu.lto_getCosTiltAngle.100.329c1bbf776cb319,"e",@progbits
+	.string	"(\265/\375`\032"
+	.string	"\205\007"
+	.string	"\222M25`m\322\001"
+	.string	"{\016\223\227\363\336\370\t\300\256\007\305\374\340\304\032QO\031\302\264&\313\007\330\322O\031J\036-"
+	.string	""
+	.string	"\301\204R\304\275zx\307\214\264\221\275\245L)\336h<\034\013v\030\026\254\006\005\350`!p\340\006\203\200\232\001_\017\t\030\354\\\027\006/\333\336\255\212R3 \2350\210M\030\024\217\227<\002\243\3355\330\376\021\341\223\376,\221\345\265??\273E\252\277T\200\023(S\366\366I\275\260\357VE\366\323\251\004\250\223\214d\267\"\265\262&\357\224a;\332\027\177\343\034\3216\271mDz\212\006E\bjwa\346\230\352\317=\240\372S\214\307g\364\337q7\242R\242\205>O\313\301\356:\265\220\305\255/\260]\n\016"
+	.ascii	"2\241\215\037\330a\202\2219\032\023\001\305\201\330\fV%,\327"
+	.ascii	"p\334\020#fl\342\256H\263\341]\367\006"
+	.text
+	.section	.gnu.lto_calculateThrottleAngleCorrection.101.329c1bbf776cb319,"e",@progbits
+	.string	"(\265/\375`=\002\325\023"
+	.string	"Ff\204H\320\356*\0352\231f7=\322Q\353\217\261\326/+\244\320T\265\003\020\256M\270\3151&\316bS;\206g\357\335\307\002\333\264XV\354\276g\3650J]X\025\334\265\017\220\244<\304\2020\344\223yn\272YB\266\224)\005q"
+	.string	"a"
+	.string	"s"
+	.ascii	"\026*\331dJ=9$\212\346\234\006.\232A\351\242\210\374\307\270"
+	.ascii	"j'P@{\357\305;\347\205\025#\346\364\035p\201\322E\333\276\207"
+	.ascii	"\177\240\271\246\276\033\2311\247\247\343y1\347\\q\034d\274\250"
+	.ascii	"\377\030/n\206\327.Wk\276\355\222D8\264\343U\370\312\220\232"
+	.ascii	"\231\243\024\357&EJ\004u\377]cx8UR\311\234\323\272\343Q\270\305"
+	.ascii	"\273\201\2556\001,-\372\335E\277\305"
+	.string	"B\343\305\357\177'\240Cq\024\004\243C\333g\323\265\261/\347\326\330V\253\336\373=\276swX\235\022\325\033R\215\222\352\223TkH\265I\252K\253&\211\352Q\252E\251\226R\275\253V\251>H\b\007\242\227\341\234\023\2062fP\f\312\371\316o\3376\315\377\371d\337A\320\276\023E\036KZ\022\341\020\t\327\261\272\b\204\300\234\321M\207\036\267c\377\243\233\301\241\342\332\254\326\370\335\270\"rw\305}N\347\366\237\003\031\350\343\330e \375\316@\253Ra\001\245_\373\2252~\267+`FC\020\267\266\303\240\031\372\354\332\030x\027D\030\202\323\013\206C#\334\2340\003\276\017~&p\n\303\"\fT\335\360\334G%\225\242\347!b>\316E\007.\330\311\nKt\271\300X\022LVb\257Y\313%\223\305Z&.\330l\026\223\241\314\002\2705\342\242\362Z\315PN^0\b\253\225\027Ke\325\222\265\254F"
+	.ascii	"8\026\301%[\315b1\331\352\344\233\337\032\263\304\350\255\312"
+	.ascii	"Ds\324B\375\332\230\332\030\333\251u\t\314\336\344\306\252\366"
+	.ascii	"\250\215\323\226\026\265?\221\323\271\251\306\332\016R\364\273"
+	.ascii	"S\207\rF\223\205i5tM+\nsE[\332\347\002) 0\002C\024K;H\004\f;"
+	.ascii	"\307eC'\262wa\233\3761M\236\030\243w6\327\247\003,\002^\250b"
+	.ascii	"\224!\276\270\002\260F|\3600\301\024\207B\016$g,<\201\213\032"
+	.ascii	"\204\005\301\002x\234\032\217O\004\311|\024V\250(\237\006`\n"
+	.ascii	"\006\200\334f\016\257\034\305\201\341r\301\226\nP\034\331r4\177"
+	.ascii	"\365C\201\003"
+	.text
+	.section	.gnu.lto_imuSetAttitudeRPY.102.329c1bbf776cb319,"e",@progbits
+	.string	"(\265/\375`\362\001]\016"
+	.string	"\246Z]D\020\221\232\016\242\n>\007\r\334\253\375\327\230g`\242\376\271b\242M(\263\366\273\nP\365\237d\277(Z+t\341C\355\235\323"
+	.string	"\037\t\2300 "
+	.string	""
+	.string	"\200\002\320J\251\004\rl\260\310 LH3\332D\312\224\002F"
+	.string	"E"
+	.string	"M"
+	.ascii	"\217~\332\377p\020\237\213<\362\265k#J\261\273\013\234\300zD"
+	.ascii	"p\002\325#\365\001\325\243?\266\215\2070\373\021\251\302\b\035"
+	.ascii	"\273\233\351\206\177\236\037\377!~\201-\240'\200\007\273\353"
+	.ascii	"\004[\\n\275\355\017\333\r\354\264\020_\036\374NP\362\240\223"
+	.ascii	"TSZQ\220\035\202R5\330\247vw\255/\366c~\217\207?v\321\177e\272"
+	.ascii	"z:f\232zZ3\235O_\300\201\0333Rdv/\234vl)\322t\260}\314\216\271"
+	.ascii	"a\020\272P`\00510U=\006\023\215T\233s\024Z\001\030[\3443#\001"
+	.ascii	"j\354\256\003\023?\261I\340\270\352\361`\216k\252\256`\221\021"
+	.ascii	"\312\223=z\006[+\273\241\217K\257w1\221X<\250\344\311V^\304K"
+	.ascii	"|\326n\350\240O\3422\024|\016\2176\t'\034\024%\321<[I\354t:\217"
+	.ascii	"\262\006\362q[\346!\031\331:\021\262\t\033\207\3134\317$\003"
+	.ascii	"1\340\256D\304\313<]\347eX\270\247V_\034\202\243\024R\025\030"
+	.ascii	"/H\225\332\020n\323\202E\324Ju\306C\243\246\230n(\265C^C\243"
+	.ascii	"B\225R\r& \340\002\242\221m\003\302BKJ`\nv\234\031L\206\263f"
+	.ascii	"\246v\3331s\210\177\305dMl\031\327\301\347\334.\212-o\201\350"
+	.ascii	"n\311\262\204\201=M\343\267e\006f\304\006\031-\326J\001\026c"
+	.ascii	"\304\372\030\314\315\314 \310\013\2169\f5l\313\013\201\221\001"
+	.text
+	.section	.gnu.lto_imuSetAttitudeQuat.103.329c1bbf776cb319,"e",@progbits
+	.string	"(\265/\375`d\001\215\f"
+	.string	"6\026P?\020O5\035\003X\317 \210\214>\210\323\315\007}\324\377\331\343"
+	.string	"\202H\337\321\322\2537B2=f\233\032\016]\302w\211)\207\334\255\252\252\252vU\035;'\255e$A\313\357M\202\035\367N):"
+	.string	";"
+	.string	"?"
+	.ascii	"\273\256\016$vWb\002\332\253\200\007p\2746\016\300\361j\320f"
+	.ascii	"\3611\303\236\314\030\261\\\354.G1\034\374\004\375\263\276\211"
+	.ascii	"\244\3603C\260\273\236\"I\302Mo{\200\355\211=\263c8\351\005\373"
+	.ascii	"\215\335]\323\223\375\325\277]\365g\037\377\372\324O!\025\223"
+	.ascii	"\n\020\305n\204\030\214-\253\t\r\266\377\260W/$\252\025\007F"
+	.ascii	"\227\001\355\325\237\3667\234\003\370\224Io\001\221U)+\261\340"
+	.ascii	"U\311L\026+Q\352\213\370\b\223>\312\236[n9^\351(F\206\t4c\316"
+	.ascii	"\346=<\304\247\355\202.\372\037\016b\343\243^\335\371\346\305"
+	.ascii	"\317\363\231\027=S\264(E4\264\003\020\356\371\203\177\267e\322"
+	.ascii	"\311t\034G\001\246c\220\200k\320Q2\234E\263\341&\021{\016.\032"
+	.ascii	"\216\343y\032\3561\356\033KO\326`\026J\020\r\275\\\366|*\224"
+	.ascii	"\"J\205\002d\332\027L\001\330\2042DCo'\272' 0\203\021bp\f2B/"
+	.ascii	"\310\300\fl\260\033\"\252G\033t\227&\270r\245\306n\273\230\245"
+	.ascii	"\323\2048\203-\271\323\030`\001\220\003\372\2668\341\245\327"
+	.ascii	"%\206\233Xh\01689\206\271\314\016B\036\307b\"\017\035s@\324P"
+	.ascii	"-/\204A\006"
+	.text
+	.section	.gnu.lto_imuInit.part.0.126.329c1bbf776cb319,"e",@progbits
+	.string	"(\265/\375`K"
+	.string	"}\b"
+	.string	"R\21788@\217\322\001\230N\\\037\343\307\233\030\215U\363\020\260\261L\177{Hk\252\326KY\246\344\322\210\020\203(\2028\003\253\276\205\021\340=\301\021Hptg\030\033\335D\356\224\002>\230\336\234\033\207B\363\034\266/\203"
+	.string	"=\210:\216\263}\3316?\006\326<\242\216\223\337\204\004W\021!-\270\254\223\332\fIO\201=\3206\345\347ySb\266\341\257U\224\033X\\4tC5e[\003}\224\220\235p\226\310\013\217\027\233\216N\347\321\306\310\2007Y@E\345\302\241%\250)\353\365k\025e+\302\313\300\310\356\307\214\314\222\304\226\023\373\253\221\215a\217W\331\036\201\230d\303\234e\262o\255x\264bvW>j\311IWx\221\374\257\016`:\225\256\001\247\220C\202_\032\206\335\365F\344\216\267\255`\373c;%\021"
+	.string	"O\023\030\027\314V\224\3003<@\024\fs\205\2730aqF,\352\234N\013m\246\3544"
+	.ascii	"\\{1\345\264\234~m\031\003"
+	.text
+	.section	.gnu.lto_imuUpdateAttitude.part.0.127.329c1bbf776cb319,"e",@progbits
+	.string	"(\265/\375`\325"
+	.string	"-\013"
+	.string	"V\224I@ \3458\0350H\020\013"
+	.string	"\034\032@\340s~\034\360VM\331#+/\220\376 a\304A\005.\270o\372C\030477\342o\017OA\022"
+	.string	"\200\2518\302\2403\3022\320\223,\251\211\321&{\247\0246"
+	.string	"3"
+	.string	"7"
+	.string	"\036\231<\332\b^\272\354['&\254\004\273\353\275\322\226\217\247S\033\375\031\233\221'\322\351W\327db-\362\224\362\231p\255\240bw\315\251\334\365\266)lO\330\307\b/\030\333\267\277\032\331]\367j{\316\227\243\253DZ\271'\223\347\264O\363\232\361*\221\rvY\006\270vK\211WCp\257\017_\330^\265+l\257\366g\354\334<\200\013\020\271\335\322I\237\365"
+	.string	"!\376\313\253A\342<\371\352\213\333\253-22O\372\300@\f\254\204\222&M\231j\332R\224\375\362\377\306\020!\333E\231\311v\245\006\240\213\016\370Y\204<\2350\0249\b\346lD\360\363B\035\034\337\307\206\347\3714@\217\023\202\274M\203? \235\320\013}>\241\327\235\242\234q"
+	.string	"V\242$\224\246\354\002\004^\335<\265=@\007W\031"
+	.ascii	"j\023@\316\031x0\bC\024\f\006\206\024\301a\t\003\340\256\315"
+	.ascii	"\346X-\\Y\t\b\210\202a\256k\273\232\2213\264\236S\316\354\f`"
+	.ascii	"3y\247Y\340\332\203)\234\346\245\327\2261"
+	.text
+	.section	.gnu.lto_.symbol_nodes.329c1bbf776cb319,"e",@progbits
+	.string	"(\265/\375`z\004%\022"
+	.string	"\026\234hG\260ZM:\334J=\306\324Id;E~l\242\210hr\265\375\235\022\t\037\313\372\263\262\377\230]\202\326Y\340\316\300\337)\365?\254\207\2301\326\375\335p\201\362\262\267\206jg<9\313\3128\320\211\0026\355&\267L\001S"
+	.string	"Y"
+	.string	"U"
+	.string	"}%Q\301\233x~e\347Vt\372\261\230s\0348?\362G7>\254k\261\271\216\325\263\250\216\245\346<\006$x\024\211\240\237$\036\350#\211\006\256T\340=R\377As\037\222\377\255\324{\222\374\257\321\357\2435\376\376\227\\\354\211RJ\t\364\207\304\377rEE.\243\024D\031\316$\377 WP\3135d4T\204\202H\305\352[[`\270\020y\241\357\304B\277I\205>\023\n\375pB\177I\224\320?\022\201\236#B\337H\204p\330\317\203\310\377\361\2436|\372E"
+	.ascii	"\364\310\236\376\214~_}\320\377\022\035\034l\360\035\362G\f\016"
+	.ascii	"dA\334\262\341\030\346\233\033\317p\027\306\214\027J\253\215"
+	.ascii	"w\265\261\020(T\273\227\2000@\255"
+	.string	"\231\214\002U\223\347\247M>\321\367b\242\377\244D\037\n\211\276\224\021\375*\"\372SB\364\273\200\350\313>\364\251x\350oYJ\351\337\315:\364\271,\207o\340\244\206/\311\237E\327\352\306\270\024/\354\251\024k!\r\317p\276x<^P\345qkW\026c\226\304\362xe\354\211\334\240\201\204\232ao\206'l\027I\326\304$\323\361\2549\035k\261=\321\216\267\352t\334\332\351\330\003\332P8(\366nd8&\204\001\247\006\2628\336\027\027Z\2501\f\3103\237\202\222T6\326\340\002!\233\351\021P\020T#H\"\2218!\355\2432\035t\335*j\260U2\235EU\254\016\367\037\2643B\364\312\237r\354\300\353\363z]\362d>i\254ytn`\230\324N\267j(\373\266\255\256\206\267\3616\274\332W\247F\256\255+i\321\321P\314AwP+\310\003\\\342\271<\022fc*P\"\357{Z\356nC"
+	.ascii	"?/.\303E\202<L%A\023\3268\220iPM\034\250e\326\304~T\\\n\277\266"
+	.ascii	"\352\250f\257\361{\240sA\020\207\233\210*"
+	.text
+	.section	.gnu.lto_.refs.329c1bbf776cb319,"e",@progbits
+	.string	"(\265/\375`\346"
+	.string	"\375\t"
+	.string	"\266[H2PI\233t0\213\206h\tA\240\252\252\252\252\252\252\252\252\252\352\330X\005*\216\005\017\024#\346\361\221\205\375\377\247o\303oF\326\266\021\265\266\t!2\0054"
+	.string	"<"
+	.string	"<"
+	.string	"\377\334+\356\231{q\334\310\217\371S>\"\037\346;\371.\277\3457W\336\005\262\023\310\376\220\335!{${\225}\221}\312\216\310\276\264O\366l}\373\317\267B\317\022\275\211\021\312S\210\372\023\242_\002\324\217"
+	.string	"\375\020`\377\001\374\035<\177\203\3673\200}\001|\005\357\023\300\216"
+	.string	"\376\201\367\006\236>\340\371\211\363\022\367T\363\215\246'\232\207\230\177^\322\243CN\207\257?\325;\2577\3253\257+\325\347\353\255^`f\324\272\324r\254'So\230\236a\352\222\351!\214\177\304\336\210]\261\210\362\241\330%\366\245\200v\246g\244w\322+R\007X\017\253Z\002\330\216Z'\353mu\326\276\332D\271\211}\211\275\305^j9\344\355q\303b\350\316\365\305u\305\025@;\241\336\242\316`_\260\027V\222;\324\232\2114\031\275oH\036\t"
+	.ascii	"9BD8X*\260\231\205\202\313\306s\006\353\032\230\255\263\253\337"
+	.ascii	"\266\301H\001"
+	.text
+	.section	.gnu.lto_.decls.329c1bbf776cb319,"e",@progbits
+	.string	"(\265/\375`]B5.\001\352\024&sW \016\251\234thr\022G.^\f\204I\030\nP\314\334\025*3k\232&\370Rg\001\253\2303\236\214\034\0137\\h\257("
+	.ascii	"\02754\025\227\366\216\242Nl\264\355\344\230?lV\016\027\347\234"
+	.ascii	"\202P\371\351b\002~\221\240\1779\016z\\\215\037\nm\333\022\262"
+	.ascii	"\267\334)E\0069\0078\007S\252R\203\246\222\374i-9R\234\364\375"
+	.ascii	"\211\304\257\032\234\266\256\256jp\376\204\352(\177\213uVC\251"
+	.ascii	"\273\030X\304\322\372\266\223&\253\312\r\375\344\346R2'\345~"
+	.ascii	"0M\365\375y\304,\310\271n8k]]\335p\336|\203\317\032tr\250A\347"
+	.ascii	"\317\252\320y\023\016\337t\303\275\344g\207\217%1}o^\301/z\206"
+	.ascii	"Mv\211\300\004c\211\244\225t\222\252\354\257\1775\215\336\372"
+	.ascii	"\300\t\271\001\246\027\313\257\366z\027\f\230\236\362\222\216"
+	.ascii	"\020C\350\316 \351:\\(?\266\344\300\367f\025~g\361\330P\333~"
+	.ascii	"\200@\204JY\220\257eouUca\300\364\224\001-e\313\246\362q5\037"
+	.ascii	"^\316X\312. J\226"
+	.string	"c?\210j\233\262\304\031\3302\347\344Vk]\315\247\t(7\tI\262l\252\2772\351\035\275\325=6\370,%3\362\004\362\203L\r\272.\322GZH\023\351\256\036\322F\232\253*{\253Y\370P\207!\023\312\023:8\031\356\357\025\374[\206\177\311\360/\030\376-\202\177Y\300\277;\360o\r\fT\205\316\020U\350\324\321\3074a\244\372\376B\341\377\215\243sTe_u\2157U\253\360\241d\316e+\264\225\317\021C\316;\340\272rN^\365\215\266\252mU\311\034\243R\305y\t\243\31399\324\241\203\265r\206\315\223\363\336*\361\337Vmcg\016\223\033s\372\376\257\312\266\3215\222y\310'\214\313\305\216\276\267]\370\026\b\276\305\3025W\241\023\310\006\376[\352=\343\357\026\035\3252N`J\201\342\302\242oOu\214\267\214F^\304\210\333\343X\006\3139\267\214\016\256r^j\031?qr^\372\251\265"
+	.ascii	"\265\026\340*\311\342\232r\336[*\3340\212\336R+~\270\210\321"
+	.ascii	"W\203\032t\336J\341\333\026\270\223U\350$\252Ag\210\032t6\213"
+	.ascii	"\352\326\346\r\024\234v\222\303\3154\364#\343F\224\247\276o6"
+	.ascii	"|\016^\250o\254"
+	.string	"\030\022O\361Qc\231s\362\177\347^\252\312>V8\312\262>\3268\265\316\247)\231\247||\330\220\221\205.\347d\207\241\016=S\350\340P\235WN\235\363\023\265\305B\253\357;\207\234\236\201_\353\252\233\216\361$\bT\337\3275\270\322\375\216]\365\330%*6\263\276\257h\360\353\026\374\266\032t\326d\025:\207j\320\371e\r:_\3250NV\241\263>\325\240\263\236\251h\252\222\250\302%\177xc\326\334P\366}-\303\257D\347\017\321\371\232\004\227y\3439\213\343D\325\267\212\251c\252\362j\225\314yM\311L\226s\376\251@Z8\002\351\373\332\205S\3109\347z\265sWWWWW\257v\276\366\3005\327\240\263\202\351\332V\303\274\202\251_.b\304y\2322X\316\311\n\346\346\274Tk\001|j-\200\251\266\265\344\344\274\257W\370\325\tWd\355\302\205\327\364\303,\254\357\332\006\373\244U\244M\337\257"
+	.string	"C\251Nj\233\362z\315Y\266P\267Te\325R\245T-uJ\315R\333\224w\255n\231s\356\260\241\203\317R\221\247-\347U\033\342\371@\243\346K\337\243"
+	.string	"\277\226Uq\303\201\225\233\371\360r\326B\327\225s\376_\321*\226z\245*kZ5\273\311W\260\277\350\257TjYM\253g7\303"
+	.string	"*g-6\006 f\006E\005\272\234s\207\016C\035~\226\262\266\200\340\373\020\360\033\200?\002\237\003\314\241\n\235\267\006\235/\302O"
+	.string	"~\215\362\237\245<\342\027\327'\225\314>\271\270\312\312\234\223\030z~\324%\307j\223\232\254Nxgeb\034\351\373\327\260W'\177\025\253c7\353\253\234\233r\316"
+	.string	"\350/jp\320\365}[\025:yj\320\331WU\350D@\r:+\223\242\327\260\277.\251`A'\262*\231\2259\347\037{\226\305)N\337\256A\347\223U\350\3045\350\374\273\204\205@\367x\376\333\344o7\177\317Y\t\374M\002\374_$\177s`"
+	.string	"%\034\350\277u\325\315\332\b\224\360\f\377U3\324GG\321\304\007\375W\314\317\377\262\225\260\020\370k\222\303\325\271c\370/\223\277;\330\007h\301\200u\300\337h\366\203\337*\340\032\330\006\324\271o\370o\324_;P\245*\230\352\366\333\016\376\226\253m\177\255\300_\311\3745\314\337>\226\003+\302\026\331\020\377\207Jx\001\376\253\343\357\020j\322\211\335\340\267\f\260\036\254\264\007\266C\225\372\253Y+\300.\240z\375\177\273\006\377I\360_\001G\321\017\260Dpo\300\177A\360\377\354\377\225\377i\377\263\374W\373\277f\211\376s\271\317\1777\360\037\316*\340d:\002}\302m\301\376@`M\002\376\272B\255Q\263\252\221\277v\375\315c\021\240\346"
+	.string	"\277\0252@\007^\002\006G\300\177\217\374}T\313\314\376\332\001[\200\277V\241\362\267\216\345`\t\320\3501\270\002~;\200\212\201\007\340\277Q\376\217\375wr\262\227p\235\377&\340\257\313\277\306\3755\315_\341\376z\346o\344_\223\177\035\373+\331\177\336o\036\340\357\"\177{\375}\344o\"\177w\375m\344\357$\177\2436"
+	.string	"\177\343\370\233\353\357-\273\341\377\317o\026\377*\246\212\360\337\376\227\307o\207~{\301o3\374\026\350\267\367\3577\177\313\375-\346\357\264\277\255\374M\366w\223\277\231\374\275\344\357\257\277\247\376n\301\337)\374M\374[\370\267\t\376>\341o\340\337#\370\373\350o\364\357\337\337\275\277I\3607\b\376F\361\267\211\2779\360w\t\177g\340\357\021\376\256\300\337!\374=\201\277#\360\367\003\376\366\340\357\016\376.\372\033\304\337\033\374\355\341o\r\376\346\360\367"
+	.ascii	"\376\026\300\337C\177\013\375\235\341o\237\377m\177\363\374\255"
+	.ascii	"\3637\376\217\342\377\333\1772\377\327\376;\371\373\374\253\234"
+	.ascii	"\277\276\371+\234\277\316\375u\315_;\360W\f\374\207\373_\302"
+	.ascii	"_\345\376\252\346\257o\177\345\362W,\177\275\362\327\264\277"
+	.ascii	"\242\375u\311_\225\374\365\353\377\t\262\377\032\370/\202\377"
+	.ascii	"\\\376\007\325\325\325\325\375;\006\374;%\370C<\t\377\353\373"
+	.ascii	"?\363\0222\347\034\303Lf$\023\317\371\327W\263V\242\277\247\332"
+	.ascii	"j\200\3777g\007\230 \231\231\252\030\3119W6\270\210\331\222\r"
+	.ascii	"\016\331l\313\271\t\353\b\002\326T\023\226\nOdXS\030\236\310"
+	.ascii	"\260\362\261I\310\021\0032c\035\237\310r\306\320\324t,q5\365"
+	.ascii	"D\266\2241<\221\345\251\274\"\314T\315I\254cn\272\312\030rS^"
+	.ascii	"\312dWS\034\236\232\260\246\236\310\226\2460<\221aMe2\254\f\224"
+	.ascii	"\233\226\220PM\031\211!\223a\251\311dWS@OdWSOdX_\365\005\324"
+	.ascii	"\0300\031eF|T\325\251\247\246\f\343\205\325\022\022\250\355)"
+	.ascii	"y\225\337r\256J\247\214\314m9\033 g\253+\344\333\222\n\365\214"
+	.ascii	"\251\r\006S\331\322UM\346\2347\274`\312\272\312Mm\307\232\333"
+	.ascii	"\236\214\\\345l\204\t)\277\3109\347\016\216\311\266\f\244\266"
+	.ascii	"\035wXe\027N9\007 's~\221\363\261\346\266\234\3631\347\274CZ"
+	.ascii	"%s\256\001\364\324\365\342E\316UC/\262\325\021\315)\347V\232"
+	.ascii	"9\233z\"\313\272*B\203B\326\225Y$\217\365\311\305U\356\312oX"
+	.ascii	"HLv\024\313.r\316u\r\356\232\222!\327\367\302\3201\243R5\325"
+	.ascii	"\367<Z\370\272\340\205EY+\353{\036\036\370\266\300n\264\310\030"
+	.ascii	"\351{\236\030\370>\365y\306\"\314U\337\3638\341\377\262\370u"
+	.ascii	"\252\222e\007\217\276wE\222,\347\274\241\306\335\200\243\326"
+	.ascii	"\367;r\330\213\312m\272KUy\231\310.S\277\270G\237c2O\235P?x\246"
+	.ascii	"\340`\301\342\274\377\315\277G\031'\310\231\314\312\217 \313"
+	.ascii	"\276\266\256\3507G@k\207\222\276\326\312\251J+\247\301FH\346"
+	.ascii	"\243\217\3241L\216.#\221\036\276C\005\377\226\3566\316o\335\330"
+	.ascii	"7\026\316O\23151\307$X\316\371\207\207\006\347\b\215\276\265"
+	.ascii	"\255\n\235\030\324\240\323\276PtK\267\013\242\203\211V_\001"
+	.string	"\3309\236%*+`\372~g\f\377\226\rX\367\200\303\204i\r\230\335\222,YJ9\2709\2515A\372\276\263\230\330'\265\255\n\204,q\313(h\254\0318\253\204\353\035S\272\354\214\032\233\306.m\234ES\225\026\316\236Q\302Y) \200\231Y\346\234\354P\327\\\324-y\356w\2740Q\025:\177[\346d\246t\255\261\322\227\315\272\371,\001\345,\304\354\315\216\251JK\206\214\025\323Qj\333\217\253D\312\024\272\254\265\363~\207\b~\357\370R\245+\214u\301\202\251J\353\366.\363\322P|\314\234\257\254t\271\331\266\206\242\003D\214\213\r]\007b\030\0178\370~g\013\177\307\007\376N\026\376\216\025\376m\227\33356f\\f\364}\035[\263Y\252p\261[\252\322\256Y-w\315\266\220\027 \206$N\222\363\t\352\b\327y\257C\207\257\243\006_\207M\215\250\307\315\030\246$X\312\364\223\026K*\\\321"
+	.ascii	"7]\241\002\226\206\266\243\261B\231\024kf\253\3303[f\255T\245"
+	.ascii	"E\263T\224s\226Eh\226\211}b\223]\270\205\333\323rJ\034\013\305"
+	.ascii	"\242\331(ue\026\315J\271YmS\326./9\313\234\363P\213\221A\305"
+	.ascii	"\340\271\327\231\202\257\343\004_\007\f_g\013_G\007\276\262\n"
+	.ascii	"\235dC\347\215\266\244W\337\353\310\300\347 \254\323|l\3168\330"
+	.ascii	"\272\304\254\223\252\264c\266I\322\216\331\344N\013\f\027\033"
+	.ascii	"\f\340(\242\302y\317\243\303\347\231\301\347\221\301\347q\301"
+	.ascii	"\277\005\313\340'I\365b\307\222W-0`\310I\243\304z\311\211\241"
+	.ascii	"\246H_6\353U\275T0\347\326QkIW\335\274\252\231\032W\333\224%"
+	.ascii	"\300\274,sN\272Y\257\352B-S\333\224W\311\227\245\375\262Hl\022"
+	.ascii	"{\244*\255\227%r[\304\032\371\220\365\252j\354\220\343\216\n"
+	.ascii	"\232\326\222.\347\354\2005q\266\350\\\235\\\205\316zU\203\316"
+	.ascii	"\363\210`\333\205\202\2466m\372\236\007\004W9\313d\263dp@r\f"
+	.ascii	"BEg{t\225^\363\201\023\362\002Y8\226r\354\222\023+\016\302ZF"
+	.ascii	"m\253\312G5DG\246\202P\215\0201\302\366h&\025\214Mv\355\240d"
+	.ascii	"\005Y\346\234\234\253m\272\311\212!y0\234p\3259\333\243W\364"
+	.ascii	"SmS\346\245\030!\216\200I\332\036=\326Ql\362\314\002Y?\226=\232"
+	.ascii	"M\307\301\200\351)/e\021\025A\013BEg\271l\020\013\304\362\260"
+	.ascii	"Z\226\005\373\303\356\260B\254\017\273U\225\266G\317\275\246"
+	.ascii	"\251\313&\250\333\036\355\242\3010`z\3129F\007G\304\202P\321"
+	.ascii	"u\362\266G+\273\254\266\375\310K\307\017\212\250\tB\325\241\303"
+	.ascii	"\316\013\n\034'C\027K\b\216-\262\276\307K\374\337\346\2608\354"
+	.ascii	"UUZ\035\266\252\331X\025`<aa\005{\343\003'$\257\205\030!K\253"
+	.ascii	"\3036Y\030>b\266dd\351\260\253ck\252\302\327Z\325x\003R\327\367"
+	.ascii	"8\214\r[\343JY\341G\326\347nk\230a\214\b\231\322\367x\r\037G"
+	.ascii	"\3014,\325\214s\253\307\213$\021\0323Z,y)\221q;C\207k\016\023"
+	.ascii	"e_\033\303B\275\210\032#\326\327N\371\2700u\343M_+e\2214\260"
+	.ascii	"\2608\203Lcs\301d_\354\234-\265\240\364=\266\262.l\3249$\210"
+	.ascii	"\020\030\266\305mT\025,]\260\372Z'\013\365\237\207\247\260\244"
+	.ascii	"H\365\375-\224}\342\t\003\367e\212\\\322,\302\264e\207e\321W"
+	.ascii	"v\314\264\310q}\355\n\2353i\270\244\245\375\347\231Ym\320\230"
+	.ascii	"\365=\236\201\217\231\354\261\016o\211\261\302\022gs\235\233"
+	.ascii	"2\277\315y\327=\3564s\314\362\206L\303q\023\207\n\215\253\357"
+	.ascii	"wi\370U\331o\336n\272\212\021\2502:\021#*\030\236\214\001\317"
+	.ascii	"\233.^f\364\375\\\277\360\237\3473&\314\354J\337\277_h\343\363"
+	.ascii	"\"L\306j\323s\2746or\226\364\375N\n\376n\f\313\375\\9~\255\320"
+	.ascii	"\367;/|\016\226m\245\323j[U\004\224(I\323j\252\262\227}\345u"
+	.ascii	"Me\363\241eci\270\332V\005\224\233\342\314\206:\354lY\221\006"
+	.ascii	"v^\270\376\322gzL\351B\323qU\331p\207k\265f\253m\312\021\274"
+	.ascii	"\254,o\f#Yb\316[\246\315Te\237\3517\267&\203\001\323\323\bl\230"
+	.ascii	"\234\351\266\016\203\001\323\323\bX\244,\361\225 X\200\234\367"
+	.ascii	"\273 d\306\364@\231\025!\343B\213\321\241Q\325\206\245\357w8"
+	.ascii	"\260\013\2570\206\254\340\322\367;\032\370Uy\270\006\363\270"
+	.ascii	"\253\325\205\212I\337\357\220\370;(\374\335\n|\016\330\272\205"
+	.ascii	"^\253m\312\022]\312\2269\347.\355\245*\233\255\271(\313D\214"
+	.ascii	"h\266\316\322i>\307d\226\332\201:{\301\313\207\253\310\022&\347"
+	.ascii	"\375\371\005_$MQ\330zKk\311==q7\324\214\364\375\251\206\177Z"
+	.ascii	"\301?\241\340\237c\370\347\027\376\271\205\333\254\317\2522\203"
+	.ascii	"FK\376\364\314\371\232\003\247\357O\036\3705\203\263\326\325"
+	.ascii	"\f\316\2377\360\317\025pK\351\2373\337\334\250\234\231B$\231"
+	.ascii	"\336r\256\"\272 \215n\354\205\233on\272\0211\342j \314\031SB"
+	.ascii	"\367\363Z\n\333\034\223\276\027\362\302\2373\333 \201\0235\246"
+	.ascii	"\r\234%3z\260\320\367B>\360\205\260\310\334\\\2221\345.fA\327"
+	.ascii	"\026E\315M\271\233E1\003\346J\0324f\234\tg\2261\317\230f<\320"
+	.ascii	"\362&d\205\345f\030,\246\030\0169;\325\261,\205\314OVD;\264\374"
+	.ascii	"#\213\0137\305\230\351x[\301G_\323\rLO\216c\021$}\3155\363\213"
+	.ascii	"\331\366\363\316\2547K/\372^H\005|\323K\232&B\336\372\232l\330"
+	.ascii	"I\250\205\0067j\n\035Y\227\233l\357\261\"\262\203G_\223K\321"
+	.ascii	"\315.\346\n\\th\365\335\251A\247\231\305\324bn\371y6\207U\f("
+	.ascii	"}\257\301\r\276\331\302\227\227\221\037\025\330\206\274\001\313"
+	.ascii	"9wP\257\234KG69\372\232j\274\030,\270\316\372\336Je\2558\353"
+	.ascii	"{\rrggf\232\006&\3074]V\t\324\230\034h7\323*\230\236\271'ma\032"
+	.ascii	"\314@\271Y\006\305\264R\347j2W]\035\345\022\220c\315\215\r]~"
+	.ascii	"\262\":\352\221\243\213Y\345\246\225.uO\316\260\314)7\251\374"
+	.ascii	"\274\035\0311\\\306\372^\003\021l*oJ\371y\246\r\031g\214\364"
+	.ascii	"\275\206-\374\233Q~\036\317\217.^\344\372^\203\017|\rWX\314\024"
+	.ascii	"3\311\352X\226:\263\2008\205\321\345\\E\244\323\002\013_\272"
+	.ascii	"L'7\311\352[\323\221)\270\276\346\230TRn\371\366\237w\2261\242"
+	.ascii	"\203E\337k\210\201\177\263\211\331\244\306\201\240\314KSDjX"
+	.ascii	"M\3220l\265!\351\373 0\3707\231\230L*\230{Lf)\rM\260\302\272"
+	.ascii	"\3502R\213\207\2423\344S\337\007\031\301\277\271\304\\r\241\356"
+	.ascii	"\022Pnr\322\344,#\253<\230_\302\242\216\364}\020\017\0317o\230"
+	.ascii	"2\314\257\"\246\274$\204\303\327\220\035d\230\223\245\276I\222"
+	.ascii	"\273\250\025\250(\373>\250\n\277\202\3410s\274Q]Y$\330\027,s"
+	.ascii	"Gm\373\001\202W\227\244\331\303\024b\005\315\322$\322Y,\322K"
+	.ascii	"\227\021\023\211\351e\0261\207\230G\252\322$b\362\350\035&\021"
+	.ascii	"S\007\333\316\2309\2566\237\213\343p\0300=\215\020f\306\024b"
+	.ascii	"\3720\267v\252\020A\222\305\3442\273\252\322\024\242\334\320"
+	.ascii	"\003\247\f]\330y\177s\313d\341\254\205\r\026}M\255J\306%jG\337"
+	.ascii	"g \203\177\023HU\232A~X\020\221#\244\257\371\343pP\307\026Q}"
+	.ascii	"?\307\2734\320\226\260\365}\006\027\3603x\301\317\200ffa1\313"
+	.ascii	"\033T\3603D\301\3170\206\237\201\t\376\315\034\026I\266\306\306"
+	.ascii	"K\337g\370\302f\r\323\352G\311Y\017*}o\332\370\317+!\310\027"
+	.ascii	"*}\357\n\315\205\253\353E\337\233U>oB\244\210\365\275\251\002"
+	.ascii	"\225:6+\3645\251\260S\006-\rtnX\311ac\306M\252\337\\2i\254\240"
+	.ascii	"N\316\013}\377V\205\316*Vts\306\216\227,\313&}\237\241\n\277"
+	.ascii	"~U\363x\023i\036\315)\242\252%,\006|\241Yy\320iR\346x\245oR\371"
+	.ascii	"\342(e\253\257\351\302\204aJ\375<\336\025\027nV}\237\001\211"
+	.ascii	"o\276\370\021f\353H\337\256W;\315\0267\243~\336\016\f\331$\245"
+	.ascii	"\3573D\341\233O&\324\317\263r\272\\\201\352\373\fL\370&\213\377"
+	.ascii	"\274\026\234\321\361\325\327t\302N\030\330h\30033\006\247\325"
+	.ascii	"\3677\231n:\375f\223\271\242e\234\300\205\215\2524}\277\254B"
+	.ascii	"\247O\r:\315\245\242\233L\315\245\344\302\245oO\r:\217a\355\315"
+	.ascii	"\233[\227\306M\227\216\233\330\220%s~\353,\027+ss}\257\234\233"
+	.ascii	"%)\203%\247\357\215\003'\nf\303\346\322I\300\354\313\262\013"
+	.ascii	"m.y_\370\245\353:4h`}o\033S\214\007Z\230\276\367\307\212\330"
+	.ascii	"\233V\337\317\361\352\021+_S\372\036\303\021\274\\^\271\3169"
+	.ascii	"\347\256\035\024\256\260\223\005\027\242\240\351{\345\032J\327"
+	.ascii	"\030\031:f\300\301\335\270\0212xajIY\032\0317\316\214W\245\205"
+	.ascii	"\354{\fMg\316\330\032Cl:\252\210xA\224\200\261\241)S\346f (\353"
+	.ascii	"\0207\026xM\304\220\331\352{\2406\374_2\227\214\020\240*\370"
+	.ascii	"\277b\252\362\212\271P@-rE\206\311\242\262\\\356X\032\322\367"
+	.ascii	"@`\030\f\230\353\2063\b\246\260\01374ka~\335,[\220\"de\377y\267"
+	.ascii	"I\221\252\036}\017\304\305v\277\260\335'^\356\345>\301\307\234"
+	.ascii	"\217\311,U\325\240\205\311%\311UUD?c\226O\302\372\036\350\006"
+	.ascii	">P\323\226\313e\213\255q\346\\\223WR\310\\\205$Z[\2635jF\346"
+	.ascii	"\\%\201'e\313\\UETm\020YK\322\367?q\360\177\340\360\257Z\275"
+	.ascii	"-\264p\263\013\224\243\230\222t\375x\271Rm\026\233\205\205\023"
+	.ascii	"%\365\253\336\264W\345M\273RD9\307\210\300\327\224\316\2322\256"
+	.ascii	"\334\367?jgg\266\306\210%j~\222V\254t\032\bUWG9\016KL\2546/|"
+	.ascii	"\365\375\317\021\374\337)\257\312;\345\226\335&*G$q\352\034'"
+	.ascii	",>\372^*;.\226|4\365\375\017\027\376\217\026\376o\024(WY\343"
+	.ascii	"\360\021\211\251lm-32\351\341?4\360}\3448qr\237\214P#\373}\342"
+	.ascii	"\003\246\266t\323\367s\266\315\177^O-\b]\337\373|\021\023\273"
+	.ascii	"\332\b\025\310\322Zfd\225\207\263\007\217:*}\357s\005\3772\251"
+	.ascii	"\267I\223\032W\221\030\212\223 \313\214\324\342a\247\364\022"
+	.ascii	"\243M\337\373(\361k\215;\377\013\006V\313\200\240\314y\n\001"
+	.ascii	"G\252<\360\270E\361 \323\367>b\370\027I\275_Jnv\2632\257\030"
+	.ascii	"#Z3\344\b\276\217\017/\257\233\215\220W\210}pD\315\025\276\207"
+	.ascii	"z\213\\\026\256\221\372v\363\032\035>4\360}\236\360\177\207("
+	.ascii	"\357\220N\273\307\261,\245\303bH\232.\272\234\265x\2604\316\304"
+	.ascii	"\224}\337\323\005\377\227Ky\271n\224}\312Y\006\003\220\210\205"
+	.ascii	"\311\321Q\301\377\335zU\336\255\373\002\204\252\261|\334U\031"
+	.ascii	"R\345\241'M\0225W}\337\023\005\0039\220\253\205s"
+	.string	"\316G\240\314D\246\252+\310\257\326uk2\346\255\306y\221\212\363\246\357{\204`,\254\353\343\313\220\337\036\277>~\260xT\301\352\373\271\313\343?\357tcs\241J\337\377\362\330aZ\301\330\362c-o\350Is\342\344\346fU)\033\314\032I7\027\372\276\007\211\377{\245\274W\225l\004\240\234\263\232tE\341_\253zq\340\300\361\204oV\273)\347\245\003\374\360`\362Fc\205zm\330\370\262\202\252\336\252\252\233\235\227\263\226\262\263\236%\031\365\322\250\312K\343f\025y\001\214\254\260eFf\017\347\251\3037\373\337\007\250l/@\225\351\373\213\274S\2771~c\330\0325\347\234\253\362QM\007K\320\302\344\350r\025\222\350<cp*\220\322\240\017\035a\250\201\"P(\365\r\203)L\001\b\201E\235\242\320\0074\362\231\030\242(\242(\361\b5\002JaHTR\362\365\212\303\237N\n\024\0023\034\351\003"
+	.ascii	"N\370\r\203BcOC0h\024\n\207\302]15*\365\204\3004\b4\232\320\353"
+	.ascii	"\371\024S\243\322MQ\034\376|\246Q\022\260x\217\364\023\372\210"
+	.ascii	"&\b\201\351P\310c\224\004,r@\211\276\340\0175\342\240\2244\004"
+	.ascii	"J!B\350K}\347\356H\037\212\301\240\357\207\224\372\222@\250`"
+	.ascii	"HDJ\207\302]\n\037\032\274iQ8\374\231)R!\220\030<U\004\225\224"
+	.ascii	"2\200\202\204\023 R\364\210\350K9\234\360\033\006I\240\304!\211"
+	.ascii	"\237#}0\002*\031\241\251\017\005`\372\013\241\350\003\001j4L"
+	.ascii	"\"\002}A*\224\206$|\322#}P2\016\211G=\"\232\242I>\242O\t\004"
+	.ascii	"\002~B\243\b;\302\024m\026{GJ<iOx\244d\n\217\224,\272\002`\361"
+	.ascii	"\252P\032\376.1U\262\357QA\354e0BwFh\321x\213\273\373R\237Q\357"
+	.ascii	"H\351\203O\017M}A\245$\024E\212\026Q\023GJ\033R\237\261\003\031"
+	.ascii	"D\300\001\023)z\302\230\004\304@$\016I\240\370qH\203@\024\305"
+	.ascii	"!\211\024=\372I2\236H\002\002 \210~\340\367\363\355\240A\337"
+	.ascii	"\357\004\032L\323!\021)\315\220\204\246E\025'z@(\321\310\203"
+	.ascii	"ah\027\342CJ\364)}H\201B\022\214I@\237\021\024\207$|\260\006"
+	.ascii	"4\365\245E\235\364\310\227d\205D|@\223\200(<\240\001\022\212"
+	.ascii	"\306!\020\005\224\250\004\200$`Z\254\200\3208$\261\223d<\201"
+	.ascii	"&\001Q\374~>\235$\343\211\337\317w\356\204\370P\354\255\340\367"
+	.ascii	"\363\365\374~\276\336/\305\251S\364!E\213)R\fG\360\373\371x\216"
+	.ascii	"\364\341\327#\202\370\021\240x\344\013\212p$\004&\021};@\277"
+	.ascii	"\237\317\242\251/h\374\005}H)\321W\201!\n\025FC\n| \2118LQ\024"
+	.ascii	"\372\210(\214I\300\fR\237\006\2107D\n\232\203\024\264\210\024"
+	.ascii	"tQ\n:\005 1\365i \035\232@S\243R\322\320\177@\"*D\217\360;\360"
+	.ascii	"`\003\017"
+	.string	">Ha\367\017\036\020\342\001!\316\177\360\200\242\242\007xP\204\357A\221M{E4x$\f\201\210\006\215\025@\215\214)0M}Bi\232\366\210i\352\013\372\357\204\3370\003\306$`O\332+z"
+	.ascii	"M\002\246\330\230\004\334Q\201\217h\203\301!\361\"\375R\240\222"
+	.ascii	"\251\002\237\n[D\215A\037\n\347\221>\024\213>\245\244\341/\203"
+	.ascii	"b\357\310\227d\222(\021\302\221/\351\024\002\203?\264\304\017"
+	.ascii	"\230\242\302#_RP\261\207&\001S\241\321\2041\t\230\001\250tB/"
+	.ascii	"\351gt\006}?#4\211\350\023\032{\277\237\317\007\r\036\t}\275"
+	.ascii	"`\320\227T\334I\2174\264\202Z\354\365\250H\241\215\204>\023\214"
+	.ascii	"|;G\372\200\006Q\003\024{\277\237\317L\217\364!\001i\217P\204"
+	.ascii	"\024-\242\304]\261\227\301\310\207\2320*%i \246\034\020\212@"
+	.ascii	"D\323\"\360\b5\201\246@\"\b\214JIBB\021\320\024HT\301N8\004\246"
+	.ascii	">\242\361\b\230B8$aTJ\002J\201B\022\204\"\244@!\360$\246\034"
+	.ascii	"\370\t\215\"\030\371P\023\277_\b"
+	.string	"\032\212=\024\320\022\277\237\017\013E0\362\241\3043-\366\200J'R\240%P%\025(z$p\340\304\016\372\023\372\322\242\020\210\323\336\006H\270B \007\204\305\337\tT*\332#}(\032M\330P\354\221\020A\302\016\t\021$\360\214\316b\021%\032\031\371v?\021@k\354\241\200\032\025\215&\340b\017\375\001Q@K\024\215&\354\244\275\017R!\320\270C\225T\244E\243\t\273\242\321\004\233\366<(\262@Q\357\367\363\235i\317\203\242T\b\334\251\300g\202D\211\020N\324hH\002\005\224\310\243\302\310\207\232\360\245>#^\372\323\333\035\351C\3723\022\323\242\210b/\00545&a8\3417\f\366zg*4\016\177\275\336\216\210\nU0\354\365vE\"Z4\n{=l$\004\236\320\353\235E!P\251\330\353\355\204C`\021\030D{=^\332K\213\300 \320\221>\024Q%\025\351\006F(\321\207T\334"
+	.string	"D1\005\232"
+	.string	"\302(<\332 \005\243\020\030\334\240\003\017z\036|\220\002\b\324\310\030\374\t\201 \210E#\b\007\244)\240\302\240OHDS!\260g\344C\211H\251R\257\007"
+	.string	"\024P\242R\257w\246E`\260\327;}\251\317\250\327;\211>\244\337EW"
+	.string	",\366z\347\t\277a\360\242=\341\0210\350\353\371\b\217\200\301\020~?\037N\217\364\301\250\224\324\033\022U\034\375~>\020E\"\212\002\220h\264"
+	.string	"\264g\"\304\210\020\036\030\225\222\202\204C`j\f\016\213(Q\247\330\323\200\366N\030\225\222v\210\303\242\020-\236i\320XDM\b\207\300\364\207\246h\t\243RR\006\024P#k\304A\037\nD4\025\222p$\004\006\225\222|'~?_P\332\023\301A*\004\356\220\322\3410\351\304\357\347\343\005\207C\n\364L\364'\334@Z\364\241\031HC0BS\237\221\222\007\202\350\357\027B\021\270a'\005j\324K\177\216\364\241\210\224\372\222@\b\207II\303_"
+	.string	">TB\211 \322\341\220\bbg\004\274\020T\021\324\017T\3420\375\241(\364\224R\364\214;w\200\003Hp\360@\t\026\300\277\017\306$ \210\024\351\b\030L\001B\b\364%\201\370\021\213 >"
+	.ascii	" \204\372\377\f3\337$\255\262\24419\233\\\264 C\002\366d\216"
+	.ascii	"\334\023\264%W\353\222\241q#G\311-\343B\306\"\311W\332\333\025"
+	.ascii	"\017\027}O\257\323\353D\302\313\310\242+`N$\025\314\220\"Y.\372"
+	.ascii	"\376\202(\270\331\224\341\002b\344Ju\240\3531f\306\313\302\302"
+	.ascii	"\005\033D\304\024YJR\327\367\344:\273~\016\3719\244\317!\266"
+	.ascii	"\256\356d\342B\224\363\376\247\020\223\f\214\214\025d\322H\224"
+	.ascii	"$cX0\255\354\240\320Y\211\241U\337\232\013\006\327\\\020\037"
+	.ascii	"6\312d\304Q\336\354\374!\326\225s\006\3421\303\246\212\262\357"
+	.ascii	"/\020\303\377\351\243\306a)qmQ=Nd\017\r4X\274\360x\261{\023E"
+	.ascii	"\353\305\0169\035)uj\320\234Y'\225\2268\272\276RRZW:nT\335\234"
+	.ascii	"8D\372&w\316pH\231\321\367\264:\255N\0345#?P\023\233A\364\237"
+	.ascii	"7~\3420\333\331\262\305l\353\002\036\370?m\\(91a\350j\230SU\016"
+	.ascii	"I\216\245"
+	.string	"\276UU\246\034\027\021\214\t\221\2531c\306IU\201\222Ln\\]9W\021\231K\035hx\2344~R\321\200\273\341\324P\272\330\260p\354\373\013\240\316\030g\fS\256\272uq\n\303G\261\031F\372^h\316\351\364\363\311\351D\326\261,\265\223\261\026\227%\311\317Z\217\262\272\027?\221?\245j\013G\030S`\234.\316\374c\265%\216\215\250\377\274\236%8\272\340\242\316\026K`\230|\335\025\311]\223\033Q\371\204:Y\234\211sSN\234\263\351\266)\343\260\332\rQ\022\227\205.?U\021\365\334\222\026P\216?\233~2\211\030q\265-bQ6\372\376\\\322)\302\203\fI\337o0F55\325\367sg\366A\272\231Bsf\263\016\007\017\030\275\304I\0335n}\347|\214\232'g\302\330<\204*\250\303!\203jH&\313q\034\313A\214!\306\224\030\325\266\030\323\024@0HP&\027\317\326\271\036\023"
+	.ascii	"\203\215mD=N\243\f*C$\"\222$I\232\003\312n\336K\205\315bP\022"
+	.ascii	"W\370\340\t\\\246\224\3409t~\3153\311%\347h\366:\357\036\236"
+	.ascii	"V\004\022\236\374#0Vz\202B\213\374X\020\270q\305k\020W9\022\007"
+	.ascii	"r\326\364\310\205^\031l\323\300\354\004k\314P\344\241\3112\205"
+	.ascii	"\022[\307\352\214\202\016b\nH\017\307\204B\215\016\370W\365\312"
+	.ascii	"\330@s\364j\243F\002@\216\005\013\233\223$\244\347\220\373P\036"
+	.ascii	"\310\231k7\260\322\255Ze\006!\376\037\333\334:\004\251\\`\326"
+	.ascii	"[\211\311\372\270\201\245\265\222\006\244kZ\305F\r%h\005\250"
+	.ascii	"H\335\262Z.\211\315\032\217\211\374Mk\314\331E\221\2553\375\013"
+	.ascii	"\224\265g3\355\354uyc\323w)\222\343D,\033Q)6\240\211%\211\245"
+	.ascii	"\203\210\004\323Z\224\362fR\352\254\352|\276Mq\002\n\373\025"
+	.ascii	"\241\034\277d\350 \036v\360\261?\233\212\n6\310B\030\210\370"
+	.ascii	"\234\311n\036\310\237\035\022\242\230~/\244\345\225\031\274c"
+	.ascii	"NM\371\016i\350\316ZF\033(\332#I[UU\200p\315\230\342\230z\217"
+	.ascii	"|\303\325\025\006\270L\264\025h\202\336\234d\206\240^\004b\326"
+	.ascii	"%\302\024BQ\316v\2463 hjNJ\317\335\365D#\200e\035\221,\362\247"
+	.ascii	"9\260\255v\202(+\003?\352\257\305\275\262\254\317\347X_\215\004"
+	.ascii	"d[\204\307\017-C&\353n;\313O\206\366\261<\324\334=\341\345\250"
+	.ascii	"\333\322g\347\232\320\022i\302\324C\020\030\234\232\371\201\325"
+	.ascii	"Tj\2254\367\223\357\370\242\006\035\261=tp\0058\214\003J\360"
+	.ascii	"\363~\222\323\325\260p)j\223\253\243\275w,\220u\274\003\0252"
+	.ascii	"\n\316\273\255^\366\345J\233\332.\366\267\207\035\364\220\236"
+	.ascii	"\254P+f\352\201\030\326\342\243z\017A\276\347\265mY8\263\200"
+	.ascii	"uY\271\271\364H\360\300&\307\274PnrbS^\021\204\306\337\002DJ"
+	.ascii	"\240\234/\334\225\240\021\330S\326\202\314\311u:\201\006F\345"
+	.ascii	"E\346j\365@\264\035\001\362\2077\220\366+\356\367\351\361\340"
+	.ascii	"\326\234#m; \215\347\"\207\263\315\364\264\0360\201\360W\037"
+	.ascii	"d*\211\001\243(\363"
+	.ascii	"ka\tj\362L8\306z\273*\""
+	.string	"\013\356\007\247\204~$7a\207R\023\025\310\264\361\023\311\247o\033\325+\210u\260\316\377\326M\320F\255\210\023-\306qk\246|\2109\244e\272\261\r~u\353\016\265`\316\005w\220\030D\225\0343\312\0023k\005\264\371#\241\266F\222\310\215\325\367\322m\260\026?(\257O\320F\243\305\355\363\276\3705\260!\005\034N6\347\240\330\327=\207\301\250\t86\261;\210\321\344\221\213\242\344WeL\023Fi\n\312X\303\203\337B#W3\274\032\302#\341\302\256\2024(\271A\214\341\276\370\256\3258\351\333\033\007\3472\275N4\307\037\001\024}]\024\250\240\230\221\376\033\345\005l\251}fx \314\f\306\002\260\273\002\304\007=sz\"\333\333'\277X\026+2\225^<\253(\332}\004\030\254\003\251Qp\260\022h\246\316\342I\263\277\374\211g\220\313\227\220\202\234\334\240\212\211\244G\020\234\027\254\177\033b0'\307"
+	.ascii	"w\201\nz|b\t\220\200"
+	.string	"%\036\255R\226DT\216\323\264\177\352_\204~\360\276U\245\031\313\220\373\037\2653\200\272\330\235\252b\r\371\346\236RSt6\322m\025\200\235<\214\353\245\024\305\2431s\202\013\267\177\t:\023!\264*\273\235\371\204\324'\3318)\240\3067\223\t\227\250\210\321\364\322c\370A8G\223\255\r\260\t\242\006\305\250\005Dg k\302h\321\362\332r\247\304\277@\222\373\t\2215\214C\222!\372X\221\376n]\214\345\305\020\343.\023\235>\026\344'~\223h2\273\356s\203&\3021\207\312\202\303]p\330F#\006y@\307\240\210\243\0029w\241\024\024\327\263&\340\343{\267\361\236\343\241\201\255,w(\305s\202h\013,yg\031\261\342rp\303\242\251\323\261\341\344)\252\221\202n\327)\203%\320\333AD\242N\323\203G\034\036\2209V;\337\374\177n\265\325\315\270\347Ey\263S\321\226)a5m\346\262\266\343"
+	.string	"\347\037\373d\361\n\266LS\324\277!\247\324\035\335y\016\226\323\373\037/\027\006\371\250\242\266"
+	.ascii	"i\273<H\265`\335\245\205\332Dy\356\177/\330\347\351\016\333\261"
+	.ascii	"X-\3579\t\215\3566\361\344\210C\217(\340P]\317\260\t\202\204"
+	.ascii	"\370\200\250\307n9\004\264\023%r\007\035k&\306\321\206\267\263"
+	.ascii	"@\350|\3632\350\007K\343\037\254\314\252\250\317-\242\212\354"
+	.ascii	"\330\237\216\313\r\255\215v\272"
+	.string	"Q\\\307%w\273\351\372\t\214\2447\270\265\314\221vG\374l>\222\024y\20503\365S\240\273\234\374\221;\205\302\362f\333\367\374Z\002\334jf\004\344w\377\235\355A\240\305b\240}6\254W\037G.\247\206y?\r@\352gt\335\260\021dh\321\242\304\274\273i\177\264\r\257\256\270mj\232\303\276\035f\307^\344\274/_%\313cIk\246@]M7\316\210Z\037\211\037g\244\037\221x\222\205\f\242\033\267c:\272F\3300\237\273!\367\304\016\351n$\331\343=N\365\007\032\261Y3vzx\362\272m\217\211\327\300\217a\215n\277N\223M\365\244z\300\367\275\370d\030\336\273\036Ga\264\273\205&\f\360&\340o\330k\240c\373G\003D}a\255\325\r\007\033\260\365(\"?\016N\202bB\333\247/\370\363S\355\274g\373\244f\340\317\001\224\257\310\001\221\352l\223\204\341%\367\361k|\034\204\264 "
+	.string	"e\fE\236B \234\315\016z\261\257\327\242tq\036?)\313\016\205\207gr~xp\375\021\221\365\312W\316\330-\f\032'`\2330\003\270\351\241\001K\241\222\274i\t\faMX\233\177\236X\034Nfk\366s\016\257\364ak.u:Sbo_-\301b"
+	.string	"o\300sHmHA\006d\315-)\320\350"
+	.string	"l\032\255\t\350\213\016|nC\037l\220\003\00491C\bi\270$\203x:\205|\326t[\200L"
+	.ascii	"`s\034\033\327\270\330\207 \215`\361\003\235\374\357\237\216"
+	.string	"\213\235\236\315L\033\337\367S{\242\354PQ\355~3E\004\303\242\227Z(\270\255\340t\2753\035\270}*o\336\n\027\213\203\351\264\033\246\004ex\2666#\360.\340\315\246\313V\312\364\344j\273\246\253O\215\233\227\260\326\240\233\212\352#\243\t\031\201\374\"\033\371\006-\331R\357!\331\226\"\034\376P\227\006S\213\032\n#\256\002\265\377\227I\361\233\242\215AE\004\326\372\224\377\3358.\215\330\244\262\313\325=n5\205\0235\207G/\257qq\217\357\265\331C\017\2430\023\267z\264\0024Y\302\272\262p\221-gz\3636\002\211&\207\036!\335;\3644m\205yw\3544\223\224#\270ujX^\242S\030\013_\356.\330\0167\211\244\201\206\321d\f\007\026\022\007\013h\\P\215\302\232r\341l\203rx\234=C\227\007\362\022\333\032\016\331F\t\341[r\341\b\244k7\004xjG^\322\367\244\242\"v\f"
+	.ascii	"\353\r\016\330\2621\203\036CCEoR\242\235\225g\210\315$\222\222"
+	.ascii	"r\272\320\244Y\357\332P\2324\324\222\356.\352\260\214\024O\360"
+	.ascii	"+\354{\037\021\306[\0062\234#R\244\177\022\267l#\t\364\021\215"
+	.ascii	"!\002\034\276w\370X\370\342L\032\032\264\327x\026\254w\275Oy"
+	.ascii	"\315\340X\374\344) ]h\005\017\331V\215\240A\302\016\005f1\363"
+	.ascii	"\333A\340\277\235\365B\330\372\201j,\370\343\263\366\323Z?\315"
+	.ascii	"\347\211\270\305\262\213\326[_cm\f3\232\340,\002\347^?K9AJ\031"
+	.ascii	"\323\300*\214h\273\355+q\271LwEi\022\367\t:F\210g6\214)w\363"
+	.ascii	"'\324s\006+\347\037\373\250v\223\246C\214\236\321\331\r\357\033"
+	.ascii	"\364\r\260\351\377\3270\241\260]y^\177\307B\341\027\306\266'"
+	.ascii	"\217\252\334\334\307\211\216\027,\333x_\330\364\216\340\234\220"
+	.ascii	"\034\"\316\331z~\351l$\314>\225\375\266Q\235sGN=\342\3379n\266"
+	.ascii	"\270\357\264\226_\r^,9\253\375\217\334\234L\307\234\027\266\317"
+	.ascii	"\202\275\b{\313fV\277\263\001\027\216\327\377:U\376\242\355<"
+	.ascii	"\200s\027c\237wp^\376g\224\023\235=\006\036\237\362\t\353\307"
+	.ascii	"\364\305\331)\264\275\373\031\366*\315}\265[\361\254 \177k\202"
+	.ascii	"5_\221\3166\372\233\t\343Z\021[\007v\231\264I\321"
+	.text
+	.section	.gnu.lto_.symtab.329c1bbf776cb319,"e",@progbits
+	.string	"accSum"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\002"
+	.string	""
+	.string	"accTimeSum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\002"
+	.string	""
+	.string	"accSumCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\002"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\002"
+	.string	""
+	.string	"imuConfigure"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\002"
+	.string	""
+	.string	"imuConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\002"
+	.string	""
+	.string	"imuInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\002"
+	.string	""
+	.string	"accVelScale"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\002"
+	.string	""
+	.string	"imuResetAccelerationSum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\002"
+	.string	""
+	.string	"imuUpdateAttitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\002"
+	.string	""
+	.string	"getCosTiltAngle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\002"
+	.string	""
+	.string	"calculateThrottleAngleCorrection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\002"
+	.string	""
+	.string	"imuSetAttitudeRPY"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\002"
+	.string	""
+	.string	"imuSetAttitudeQuat"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\002"
+	.string	""
+	.string	"pgResetTemplate_imuConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\002"
+	.string	""
+	.string	"imuConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\002"
+	.string	""
+	.string	"imuConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\002"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\002"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\002"
+	.string	""
+	.string	"mag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\002"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\002"
+	.string	""
+	.string	"applyDeadband"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\002"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\002"
+	.string	""
+	.string	"atan2f"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\002"
+	.string	""
+	.string	"acosf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\002"
+	.string	""
+	.string	"pthread_mutex_unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\003"
+	.string	""
+	.string	"pthread_mutex_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\003"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\003"
+	.string	""
+	.string	"degreesToRadians"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\003"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.329c1bbf776cb319,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2205 @@
+	.file	"mixer.c"
+	.section	.gnu.lto_.profile.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375`\231\003\005\023"
+	.string	"\204\032\215\004"
+	.string	"L"
+	.string	"\360\262\270\024\016\002"
+	.string	"\002\001\002\002\002\001\001\216\272\203\230\f\026\002\003\002\003\002\004\002\005\006\002\007\240\342\234\212\n\003\004\005\006\007\343\215\360\344\017(\002\006\002\b\006\t\002\n\002"
+	.string	"\002\013\f\002\f\007\002\004\002\004\b\t\n\013\f\r\020\021\022\352\263\360\321\b\023\024\215\260\277\341\007\004\025\224\257\304\213\n\026\350\300\306\254\005\002\027\354\206\342\366\006\006\030\031\221\306\210\360\006\004\002\r\002\r\032\033\374\261\250\314\f\"\002"
+	.string	"\002\016\002"
+	.string	"\002\017\016\013\006\002\006\035\036\037 !\"#$%\232\323\204\263\r\002&\257\374\355\347\005\b\002"
+	.string	"\002\020'()\316\227\265\337\002.\021\002\021\002\022\002\007\023\002\024\002\023\025\002\025\b*+\366\200\211\274\017,\220\236\340\376\004\n\002\006\002\026\026\002\026\023-\203\341\306\354\b\b.\316\313\323\260\017"
+	.string	"/\374\314\200\371\n0\322\221\266\371\0061\365\217\303\254\017\\"
+	.string	"\002"
+	.string	"\002\006\002\027\027\00624\271\366\315\372\0014\030\b\002\b8\226\342\223\316\016"
+	.string	"9\274\336\227\370\007"
+	.string	":\316\317\221\317\017;\216\205\223\310\017<\314\311\255\300\001=\235\206\367\317\002>\206\270\257\235\016?\222\254\341\316\003@\221\260\327\363\002A\207\254\251\246\016B\325\233\244\265\013C\334\356\363\332\tD\335\372\220\202\003E\247\327\342\262\fF\254\275\261iG\321\256\205\311\017H\251\323\316\250\fI\275\225\333\350\001J\204\206\332\243\016K\322\222\235\355\fLM\225\354\270\304\001NO\347\373\336\272\fP\361\374\327\226\006QRS\240\342\234\212\n"
+	.ascii	"`\250\021M\304\210P*-H\322\236\001\300\002*\032N\007\021\220"
+	.ascii	"p\204\234\2220\222\224\264\262\254\001Q\243\332\007|? \240:m"
+	.ascii	"g\352\331\221\363\305{\277f\004\253\030\323|\370L\214\237JUI"
+	.ascii	"\214|\251=\275\034\327p{!\033\222\322\022|Xp\025\023\312\003"
+	.ascii	"\300\021]\216@\264\371\r\261\003\277\374Dj\300\005*\320\ri\370"
+	.ascii	"\001\336\200\024\r\275\246\360\204\016\026\032\374&Q\204\f6\363"
+	.ascii	"\006\025\340\343A\033}\367\305\025\310K\222\232\352\341\232e"
+	.ascii	"\207\200\027\007\021\346<\371\306\032\261\034Q`\311\001\\\263"
+	.ascii	"\200\033n\253\350\335h8\304\264\311\230^\321\332k\007\325uJ\336"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_.ipa_sra.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375 \321\315\003"
+	.string	"\242\004\020\033\240E\215\001\377\377\377\377\377\177\202O\177\376\311\246\321\246\266H8\351\233#R\246\024\232\372G\270\201 "
+	.string	"x\2226\032Rgb0\266gk\264e6\263\277(\267\316\344D\\\355\241[\361\253,\004\030"
+	.ascii	"0\005\301qLkUIP\201\016\027a3\\0\250r\031\316\361\260*\3273b"
+	.ascii	"\225\370 \360T\001CU\354\022\001\304\370\031\210\205\334\235"
+	.ascii	"\204W\002\277\204\261\001,"
+	.text
+	.section	.gnu.lto_.inline.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375`\300\0035\022"
+	.string	"\026\332[D"
+	.string	"\261&\215\001L\204\326$,\034)"
+	.string	"\246\326\217e\006\020?)Af\307\275\344^\267\376\221\001\224\037\322\177M?I\307i\315\026\222\377\377\365wA\035?\333\247O\247\363?!\330\004\216dP\355\344o)e\nI"
+	.string	"E"
+	.string	"N"
+	.ascii	"\334\032\207)\213\222L\251\026\226\250\022\335\r\311\0020\315"
+	.ascii	"\033:F\264@\0171\333\221\2361\310Hn\271\273{}\213\256\030\365"
+	.ascii	"\330Y\311\327\026\2051\352\261\2432\346\231!k\354.\200\337\364"
+	.ascii	"\264\273 \371\b\312\322\356\212\274\311\357&\357\267u\300.yK"
+	.ascii	"\335\335\227\367\361\037H\314\022s0K\027\234\306\225\345\206"
+	.ascii	"\337\n\312\231]\030\222O\224\300\377\311\334\364=@\004\007%L"
+	.ascii	"gz\2216\246T\253D\177\003\211\343*J\027)\326*\300&k\034j\001"
+	.ascii	"\334\b\245\302\2644B\251Bv\360A'\207t\211\264\246fe\022d(R\235"
+	.ascii	"\225\b\026\005n\260\242\301\351\020D\b\032\234\356\0303\360x"
+	.ascii	"\336[\236\362\235\030\360:e\234'\375$\361\034YE?V\020\322\326"
+	.ascii	"\356\256\260$kw\027\234\245\374.\034\257q\230 =U\370Or\330\335"
+	.ascii	"\227G@\341\245G\005\217R\016\264\321\037%q\013\027J\272\234\253"
+	.ascii	"\206\224i\231P\315J\231\220'p\330@\2013)H\354\210Y\265\204O*"
+	.ascii	"\027a\215C\riiwC\206\260\275\220\347\007\177a\250\0015\247\220"
+	.ascii	"\032+-I%\313\001`\"\"f\326\003\021P\261$g&\030\321&\205Bk\223"
+	.ascii	"\0350\331\241\202\262\345\334x\b\222\266*\363\364\0253FY\037"
+	.ascii	"\n\210:\377/2\306`\035R\336k\177\234\240\\\246\363\b\300x\334"
+	.ascii	"S\346\ri\020~\213\351\ra\367\037\325?\355&\"f\373\211\201\372"
+	.ascii	"\001s`^[\377\006\324I0\3013\247U\371\306gF*\336\346YP\2451\034"
+	.ascii	"\274\004\256\302t\3125IN\340\262\001\026n \345\340E/\005\212"
+	.ascii	";\\\262\272\347\322Q\272\217m\3139\2201\350\001\255\366\250\302"
+	.ascii	"\305\203\005\326)\036\342\322G\236\005W[\315\036}\221\0168Q\203"
+	.ascii	"\322L\320F\"\336:\307d\212\264-\305\013\367\357\002gj\305\350"
+	.ascii	"\316\253a\302\3229\023"
+	.text
+	.section	.gnu.lto_.jmpfuncs.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375`|"
+	.string	"u\006"
+	.string	"\242\312!)\220)i\f\377\277\352N\027\024\363\377\377%\342>\003\273\373\365X\310\375\007V\324\002\213%\254\037\210\f"
+	.string	"\260 \332|\023\231R\252z\312 \333^\302 Bo\310z\310\262\255\260\b\302\007\317X&\313\344\273p\360\036\217O\262\032\030t\341Q0\2411\225GP:\330b\007d\347 \320\001}\264\300Y\362\030\233*\300\321\362h\331\314jR\245\002\3324\256&)\262\232V\212<\261\314\204\354\002\354\230\267\306v\312\3538E\033"
+	.string	"K\305\240\265\344\365\266\354b\255\230\003\255\217Bl\324\351\242\355D\214Adv\t\326\352\3042>\3263\202&\216\246\177\354bu\260#\303\276:\246\307\3412z\036\253yF\263]M\301\004\223m\206X"
+	.ascii	"7"
+	.text
+	.section	.gnu.lto_.pureconst.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375 D\345\001"
+	.string	"B\004\016\026\220+\035eF\223\273\273;\314\312\374\377\005\316\330\261\277\234\353\242\035+i\025]\350>\327\271\315e\356\362R\316\344D\356q\215\261\030\211q\270w\2053\270\300\313\316\314\246"
+	.text
+	.section	.gnu.lto_.ipa_modref.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375`\303"
+	.string	"\335\006"
+	.ascii	"\262J\036#\2209\303\001\377\177um\220{\356\356\356\356\356\356"
+	.ascii	"%\341\037\3137\340\263\r\242=\364\271\352C\357l\232\224)3\213"
+	.ascii	"\217\237Uy\325\247\374\251\342h\374\214\027\325S\235\235R\224"
+	.ascii	"\314*\005\271\276\023\345\364\022\"\352l\312\017U\b\023*\207"
+	.ascii	"\226\267\2746\357\224\003\301\377\206\362\003]\350\224O\235R"
+	.ascii	"y\241}\206\271\276Z#d\336\232\333\271\347?\367d\336\237\366\250"
+	.ascii	"\234I8`F\002( @\002b\034U\036\037\f8^5\336m0nB\0059'\321,\217"
+	.ascii	"\333\304\366\3662B&\231\326,\255\200+\206G\027\2713\315\266\213"
+	.ascii	"k\270\321F\t\016\305B\343zM\360\200qw\372\304ba\274G\032\177"
+	.ascii	"\377\350\353\375NR:\234G\275aC\322!\261\332@8\301t\250o\300\302"
+	.ascii	"\302\271\001"
+	.text
+	.section	.gnu.lto_.lto.47567f68ab1f58c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_mixerConfig_Registry.79.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375 \223M\004"
+	.string	"\264\007_"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\206\200\200\374\342\203\274\251\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\336\006us\350\366\005uq"
+	.string	"\005\001\006'\001\002\024?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.string	"\004"
+	.ascii	")\"\301$\016\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_mixerConfig.81.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375 %)\001"
+	.string	"\030"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\177\001"
+	.string	"\005\001\006\035\001\003?\202\210\200\020}{\274\001y\273\001"
+	.text
+	.section	.gnu.lto_motorConfig_Registry.85.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375 \226M\004"
+	.string	"\264\007b"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\202\200\200\374\342\203\305\241\025\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\327\006us\250\364\005uq"
+	.string	"\005\001\006'\001\030\206\300"
+	.string	"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.string	"\004"
+	.ascii	")\"\301$:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_motorConfig.86.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375`/\001\r\f"
+	.string	"\226TN@\020Q\234\016\250\240\250N(o\3234\243p\232_[\333\375\016j\346\005\276\342\f\340\311\307~\205\020\273\253\305\215`-\251[\017\276\001"
+	.string	""
+	.string	"\005\213qt\321\221\n\f\351\261\313\365(\250\211\304\356\235R7"
+	.string	":"
+	.string	"A"
+	.string	"\n\234 \273\345\361\003\256[\331\005\\\267\034\3328>~\366-<t\030\225\273\313Q\022\341\f?C\377+\256u\304\315'\346`w=;\"\210\233\3366\002\333\013\354\307\b\226\257\271ni\"J\245\016\316\\\331\343f\322\021\366!\273\273\246\036\373\241\177z4 KU\201\034\273\037V;\226\264h\234\330l\177\332Oq\025\341C\232\007\330\365\330 \355\216\001\233\210\002a\251\356\244\b6\343\004\2004\3412\300\bv\343\004\372\353e{\207Q_l(L%%-\334\005x e\314G\027ni*\023(3q\360\2621\\\004f\273\313\300g\241a\003\201O\211\007\226\256r\251\017\276\232\251\336\346\211\344\243d\350<.#\301\322Q\250p\227.\202\307M>\f'1\340Z\201\362q\231Z?n\033\367\220\245\036C\bAr(\007\177P^\252\232\210*\251\310\362\032\001! "
+	.ascii	"\203\021\321m\342C\303d` \216\347EJ\342\360v\244\244\340\356"
+	.ascii	"\250\003\356E\206\f\366\350H\325\240\270\021\271.\332n%\037\306"
+	.ascii	"\264r\023\315\272\260R\222\320\244\035\r\314}\336\007\320\214"
+	.ascii	"S\002^^\264\236\f"
+	.text
+	.section	.gnu.lto_customMotorMixer_Registry.90.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375 \207\365\003"
+	.string	"\004\007S"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\354\301\025\006yw\350\345\005yu"
+	.string	"\005\001\006'\001\200\001\0040sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.string	"\004"
+	.ascii	"\\\205\240r?h\2227\200\""
+	.text
+	.section	.gnu.lto_mixerQuadX.102.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"E\004"
+	.string	"\362\305\026\"\200M\032\003\340\b\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\253\006\226\341\336TTJEB&4\023\300\023lX\261\022w\222\0017\344\310\226/s\fG\005D\007\367\344\037\035jc\360L\256\3217-I\360IN\321+\f\260 \260\232\2017r\207\376H(\006\273X\007\006\275w\251\355.\302\352\276;\n\022"
+	.string	"5\003\303\237\301\310R"
+	.string	"\346{\317\212\034,\001\024"
+	.ascii	"\337\001\306\300h\220\305\200\004\360/u\030\006P\212\234\027"
+	.ascii	"\203\3471P\004"
+	.text
+	.section	.gnu.lto_mixerTricopter.103.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"-\004"
+	.string	"\244\005$\001"
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200$"
+	.string	""
+	.string	"\200\254\325\252\001\204\002\200\200\200?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\005\001\006\025\001\002\244\304\001{\303\001y\302\001w\301\001\252\311\001{\310\001y\307\001w\306\030u3\312\0014\305\001\300\001\277\001"
+	.string	"\020"
+	.ascii	"5\002s\237\341i\b\b\335\200l\034\214F\016f[\bC\347\203\311x\006"
+	.ascii	"\022\203\340r\276\206\363e\234\030\226\300\007P\004"
+	.text
+	.section	.gnu.lto_mixerQuadP.104.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"]\004"
+	.string	"\022F\027#pM\322\001\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\300\022\002\027\266\241\343\275\r\377\377\377_\327\300H_\377m\242\221$\003=\262\344\313\230;\205C\204\203\307\376\334 \274:ck\356\r\316\241\326\304\246\334\025\334\022\035"
+	.string	",\335\260\035\367\003\207 \022\202\\L\006E\333U\235\355\2422\247\301Rog\004\021"
+	.ascii	"5\003\217\237A\327\032@\331\007,\326\342\003\223\001O\300@4d"
+	.ascii	"\200U\001)4\200\251\300\001\246\020\352%9-\006\317c\240\b"
+	.text
+	.section	.gnu.lto_mixerBicopter.105.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375 \275\375\002"
+	.string	"\004\004\260"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\244\002"
+	.string	""
+	.string	"\200\001\202\200\200\204?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\303\001{\302\001y\301\001w\300\020u3\304\0014\277\001"
+	.string	"\013"
+	.string	"5\002+\234AN\005\276~\360\242"
+	.string	"\230\300\205\2343\205\022\fGD\226\023\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_mixerY4.106.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"}\004"
+	.string	"2F\027\"pM\322\001\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\300\022\002\227\221\006\213\373^\377\377\377\277j\202\231,\336\203\372$\311=\262\344\313\230;\206C\005\204\347\376\340\240|jgn\r\276\3119\222\232\334\024\274\222[\032`A\340u\343v\340\217\034\222P\f\330\":\264Y\253$\306\242\251\255\"\274z;#\023"
+	.string	"5\003E\234\001\314\347\260#<\204q4\334hlL"
+	.ascii	"\363q\325\031\214FC\0260\037\305\216\300I0\007P$\347\273\270"
+	.ascii	"\347,\213c\240\b"
+	.text
+	.section	.gnu.lto_mixerHex6X.107.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375`\247\001U\006"
+	.string	"\302H )pO\032\003\374W\202@\216\253v\362I\257\277\376\372\370\277\256\377g\2224\350\336&\377\377\377\327\217\370^,\251D\034i;\311\273\344\311\2303{\376<\232t\352p\313\220(\250\344\335|Eg\305Kr\323\374DG\305\250=\220<4\347\350\"\200F\276\231s\350\035\314\325\275b\255\031F\221W\346\026\372e\333\340\202\300p\207\3741\207\320#\212\305\24022\304\356>\356\272\373\264Z3\302p\337}\215\036"
+	.string	"4\204\200\202y]\373\002\376b\\`2@\013\370\007\006\203\241?\307\031^\340"
+	.ascii	"\254\013\003b\215\301\335\024\300I.\224\341\005\202\300\272`"
+	.ascii	"\300\301<4p\001\376\222\204ar~&\224\006\226#9-\006\304\017\240"
+	.ascii	"\b"
+	.text
+	.section	.gnu.lto_mixerHex6H.108.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375`{\001\315\005"
+	.string	"\"\210\035&`W\032\003\017%=\202\222\237C-\016\271d\031\f\243#\t\021wi\221[\024E\313"
+	.string	"h\244\240\200\307\375\261\223\f\371d\312\2315\177\006M\272\264\n\361\353\2600\254t\326\336\202\273\264M\372iG\301S\232\013\351\242}\203\217"
+	.string	"\033\235\263w\340\236L\013Tt\313~\201c\336\003\301\357\207\016\331#p\t\243A\210\016,q\314tY\214\330\226\231\256\360\3133\235\"\033"
+	.string	"5\002\303\237A\303R"
+	.string	"\346{\317\212\034,\001\024"
+	.ascii	"\337\001\306`t\035\262x\216\004\245\007.`\004\232\f\200\362r"
+	.ascii	"\332\001\346M\205\031\f\355\004\0130\n@\021~,e\005\216\340,\212"
+	.ascii	"\017\240\b"
+	.text
+	.section	.gnu.lto_mixerHex6P.109.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375`\247\001U\006"
+	.string	"\202H +`u\322\0300\f8\021\344\270j'\237\364\372\353\257\277\202NB\002\217%\230\277o\035\202 \b\262\346Bc\336\b\240\340\217\264\235d:\345\312\2327\203\016]\332\364\n\361\353\2400\260\366.\336\222\273\262O;*\236\222\253\262\355\211\366Q\234\223\223\002\234\275\023\367\310?"
+	.string	"]"
+	.string	"\226m\230e\277\3041\362\f| \030\016\331#q\211|\262`\020\246CK\250\352kpO\325\267\315\251\025\206\272\352{\004!  C\232\352_\005\264\346u\311\003I\005\220\315\270/\nH\237\317\f\201\001\315\372"
+	.string	"\257"
+	.ascii	"\251p\360\026\200\335\r\3046\203{\017\2241q\230f\276\030w\003"
+	.ascii	"B\363\200\2575`28D;\341Y\316\r\231\203\203\003"
+	.text
+	.section	.gnu.lto_mixerY6.110.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375`\253\001%\006"
+	.string	"\202\210\037(Pe\2451,?\324\026J~\016\2658\034C\327m\273\231\004\b\351\243m\323dfff\334\311k\032\202F\264\207n;\311\272\345\313\234;\213\036}\0325Kq@\202\201h\355.\370+\016pjW\301\273\370j>\322^\202sq\2236\003\236\375\003\007\305C\252\372\266)\300\354\031\270&\276\231\330\204\301\330\222}\002\247\304+\rGA>\262\305\326E\016\334R\365iRf\2061]\365A\002\034"
+	.ascii	"V+\340D\313\204\034\031<P\320\007\223w\327g\20010\364\300d\001"
+	.ascii	"\0240.\f\314Z\006\336f\311l\357t\006\016\360\017\f\006\206\036"
+	.ascii	"L\206t\2100\247\267N)\013\312\340$7g\306\200\370\001\024\001"
+	.text
+	.section	.gnu.lto_mixerOctoX8.111.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375`\266\002\305\006"
+	.string	"\022\312%1P\253\322\030\333\266m\333\266m\333\266\215q\333\006\264m[Y\364\237e=\231\031\254\033Il\222$\233\231\231\231\211\210\362L\353\323\256j#A\204\244\035n\320\332\245M\007,\260\301\0073\334\260\304\023cT\356\240\\\3262r\r}c\347\210S\344\025\272\305~\021+\207\374A\207\330#\240\205\220'\350\n\373\002\214\217\201\234@\337\366\002x\235r\224\236\332\001\260P.\322G;\tr\004\373\232\223wt\317\376\301d$O\223Y`\334~\316U\360\275l\362\345v\316\332\004$ \300\243b\341e\002\316\315{\252\310\227\240\300w\214\215\236\305$\3707\230\321Y(O\t\377\006\033\232((\360o\260\241-\221\t\354\376\300:\203U"
+	.ascii	"\361\241C)\364\337\314\030\361\003(\002"
+	.text
+	.section	.gnu.lto_mixerOctoFlatP.112.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375`z\002m\007"
+	.string	"\262\212'0PO\323\030\017\177\322A\002\t$\004\205\005\027HI\237\355L\355f&\005\331M-I\322j\316\314\314L\331`\340Y\225\334\2526\265\254\233\bI2\370\301\331\f7,\361\304\027c\334\261\307#\223\214\302\271e\3639K\311U\364\225\235E\272$\337t\223\375\244\202>r\020=d\027\251\242\214\\C\337\3309\006\036\266I\226D\221W\350\332n19\344\017:\304\036qQ\by\202\256\260/\\\306PO\023\344\005:\266\033"
+	.ascii	"\004d\234\300\353X\316=D\204\264\035\"t9\3674O8b\344\t%  #)u"
+	.ascii	"\f_\0054\363\332~$[@<\350/1&\016(\363\024\031\243\347e1\360@"
+	.ascii	"\004a\367>3\204\201\224A\220\234p\335\003\272\301\371$\\\\\267"
+	.ascii	"\201(\031\3705\220\354\003\240\\&\307g\205v\3027\311\013?\217"
+	.ascii	"\361\""
+	.text
+	.section	.gnu.lto_mixerOctoFlatX.113.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375`\316\002\305\007"
+	.string	"\242J(3pM\322\030\251\336e'I\222$I\022C\036M\036\033\36281\302o\2532\005\324\225w\262\266VJR\376\377\377\257_\235\017\207\374\366\367\032!\215\220\264\003n\203\255\025^\370a\210)\2568c\215?\006\271\204\263\312\246\263e\222\237\350({\312!\271\210>\262\223D\bm\344\034z\307\356\001ad\221k\372\305\216\001\241%\"\227\320\263}\002J\fy\203\216\355\016q\272\362\003\035aO\210\2271\323\322\002\371\200N\260\027x>\231\027PQ\032"
+	.string	"Fm\333\n\314~\316A\361\275J\263\344v.\272\002) @\303\022\267\001n\"\220k\006\240"
+	.ascii	"\034\f\222\255 @\320\215\030\214\304\327\200\204\336\317\fa\003"
+	.ascii	"\305d\240\363\r\b\214\\\303\177\203\035\332\217\270\375\331\313"
+	.ascii	"b\355\016\315'Z\002\273\036\210[\006\035\241\353\027\300}O\326"
+	.ascii	"\331d\025\276\007\217\350\314\030\361\303,\002"
+	.text
+	.section	.gnu.lto_mixerVtail4.114.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375`\343"
+	.string	"\265\005"
+	.string	"T\007\326\001"
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200\004"
+	.string	""
+	.string	"\200\001\317\244\376\377\377?\205\327\307\204\340\307\302\353\002\200\200\200?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\005\001\006\025\001\003\244\240\270\275\224\204\304\001{\303\001y\302\001w\301\002$\244\312\001{\311\001y\310\001w\307\001\204$\317\001{\316\001y\315\001w\314u3\320\0014\313\001\306\001\305\001\300\001\277\001"
+	.string	"\033"
+	.string	"v3\240\300\274"
+	.string	"\031\331\fS\210Dm\013r\b@*t`0\030=G\026C\230\017\347D\351\021"
+	.string	"\005A\f\007S\347E\0178@sR=\001 \201x\201\036<\211\306\2311 h"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_mixerAtail4.115.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375`\254"
+	.string	"\215\004"
+	.string	"B\306\027#pM\322\001\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\300\202\377S\221\315\263\373^\377\377\377\277j\202\211\361\365_\313\215$\031\3751\344\312\2267\204?\003\003\347\356\340\236\274j_n\f\236\3115\324\212\334\022|\222S\332\202\016"
+	.string	"\216^\334\f\274\221;\016\b\211%\246B\233\265\213\252\332J\214M\202\243\336\256\b\023"
+	.ascii	"5\003E\234\001\314\347\260#\334\260\306\321p\243\2031\001\314"
+	.ascii	"\307Ug0\032\rY\300<\212\305\f\276\020a\240H\316wqO\2778\217\201"
+	.ascii	"\""
+	.text
+	.section	.gnu.lto_mixerDualcopter.116.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375 \275\245\002"
+	.string	"\324\003\260"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317\002"
+	.string	""
+	.string	""
+	.string	"?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\244\303\001{\302\001y\301\001w\300\020u3\304\0014\277\001"
+	.string	"\b"
+	.ascii	"g\020\260 \257*\f\261\324gY\204\344d\030<\217\201\""
+	.text
+	.section	.gnu.lto_mixerSingleProp.117.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375 [\365\001"
+	.string	"\344\002N"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001?\202\210\200 \177}\276\001{\275\001y\274\001w\273\bu3\277\001"
+	.string	"\005"
+	.ascii	"k\312.\025.\216\340,\212\017\240\b"
+	.text
+	.section	.gnu.lto_mixerQuadX1234.118.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"\005\004"
+	.string	"\022\306\026!\200M\032\003\340\b\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f+\026\005\177\023**\245\"!\023\232\t\340\t6\254\240\374\235d6\344\310\226/s\fO\005D\347\366\340\237\\Z;\346\316\340\232|\263KI\356\tN\311+\273\200\005\201\241\031w\003w\344\217\204b\240\213\350 \255fj\251F\204!\333\354)\016"
+	.string	"ek\300\201y\360\261\260af"
+	.ascii	"T\300?0\030\030z`2\300\b\352\200\r\311\211\032x\023\003p"
+	.text
+	.section	.gnu.lto_mixers.119.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375`6\003-\017"
+	.string	"$\026\002\004"
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\206\200\200\374\342\303\376\204\005\177}"
+	.string	"\005\001\006\035\001\004\005\001?\202\210\200\030{y\275\001w\274\001u\273\001\005\001\006\025\001\032\005\001\006s\035\001\003\302\001w\301\001u\300\031\002\305\030\274\027\234\236\344'\177q"
+	.string	"\275\312\026\301\025\274\236\274\247\037om\317\024\023\264\247(ki\006\325\324\022\260'\177g\330\021\274\020\017\244\247\037ec\301\337\016\240\247(a_\b\343\342\r\374&a]\343\346\f\370&a[\343\351\013\364&kY\325\354\n\360&\177W\275\357\t\274\236\354\246\362\001\350\246(kU\364\007\344&kS\325\367\005\274\246\037oQ\305\374\004\270\246(\177O\275\377\003\264&\177M\275\202\002\002\260\246\037KI\205\330\003G3\207\0024\206\002\204\002\203\002\201\002\200\002\376\001\375\001\373\001\372\001\371\001\370\001\366\001\365\0015\363\001\361\001\360\001\356\001\355\001\353\001\352\001\350\001\347\001\345\001\344\001\341\001\340\001\336\001\335\001\334\001\333\001\332\001\331\001\327\001\326\001\323\001\322\001\321\001\320\001\316\001\315\001\314\001\313\001\311\001\310\001\307\001\306\001\304\001\303\001\277\001\276\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.string	"[\250\201\264\"gZ?\326P\223\210V\007\021 ,P\021r\003-k\"\022\200\205I\221\211u\031\306\255_\334\"x2/\242T6\343tM>\276~V\310\251\373W\261\334\217ykz5\225\bw\026\021\241\324\232\225\246\023\003\t\305\245}'\340G\034\350\036c>D6*\337\353-"
+	.string	"\252\347)\336v\201\017\037}\266R\204\261H\353\344\227\016~U#"
+	.ascii	"f\270\036\305t\335\032\254\230X5V\r\221\006"
+	.text
+	.section	.gnu.lto_getMotorCount.128.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375 \345}\006"
+	.string	"\362K-4@o\222\016\230\265(~\253\006\363M7\327\213\331R\310\306\367\237\373M\365\377f\017\005\213\220\036W\321\367xLQ D\370P\245\343\240\350\036\257\326>\3312\005o4\2173Au\234\307\241\201z`p\020\324B\307m\236\204\323\f\\Ep\236\363T\325s\031,\333J\330\bD\255\342K\322\022\353~L\361\301^\235\356\007\323\t[\200\206\b\263\307B\3306\276\227l\245\037\307&\020\242\242\260\2229\312Z2e:\001\371A\237\371"
+	.string	"\001\264U\254c\204\361\300\2600a\311\304\\\343\250U\264nGz\021A\311.R\250\b\220\220\231\343E\312\350\255\177\301o\360_\004\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_getMotorMixRange.129.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375 \367\325\006"
+	.string	"\022\r05@o\222\016\230\016\230rp?\007\3613{\304\224\t\005 #h\205\241\333T\377\257\251n\343jtW}\217\307\242h8\334\333\265\243k\222\003\177Yk\215l\231\002o4\030G\302\352<O\003\203\345\260\360\036,\205\316\333`\021OS\360\005\301\301\236\347\272\260\207\331\262N\204.\003r\024_\222n\227\356\350\211IX\255\324\235T\225B\027\200\001\302\227\337>\3506\276S:\321\027GG"
+	.string	"\242\222\200\222i\361\342\222)\224\211\307\237=\346\206T$\373\322\264u\214\312\222QQ\322\222\231/\323\201\252\324T\201\252\224\343hV\314nG:}\234\254h\241O\021"
+	.string	"!3G-t\321]\177\203\377\340\327\b\b"
+	.ascii	"2\003\346:\203i\b\3055\0217\004\216\031\233\270+\246v\222\001"
+	.text
+	.section	.gnu.lto_mixerIsOutputSaturated.130.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375`\257\001\225\017"
+	.string	"\206\035eD"
+	.string	"\221(\0358\026)}\005\306s\200\307`\230\365]T\203\032\233\357\207\317\017\311a\031\" =A\316\253\375z\n\177\264\025\245\261\351Rz\377\345UU\375\206\211\306@\032G\241\231\2178\333\377m\357-eJ\001Q"
+	.string	"K"
+	.string	"R"
+	.ascii	"\260\343\002\342\341{\200xh\333\b\022\224lz\247\241\344\0340"
+	.ascii	"\254Zh\354v\232\246\334\364\b\237\246\311?=Rx\201aq\255\303\f"
+	.ascii	"\212,\005c\202k\375u8U*\007W\341u\354\356W\236$\\*3\343\261\273"
+	.ascii	"N\026g\341\316\334v\310\266\002;5(\366\337\356\256\365\304v\272"
+	.ascii	"\3434\347\335\277yi\315_\177t\032j\3729\255\351\003\270K\006"
+	.ascii	"\215\031\rH\354\226\314n\254\013\350\002\302v\311\356\330\326"
+	.ascii	"\3161\026-<\232Cg\332W\271\210\322_\226y\263\233\241D\212\335"
+	.ascii	"=`\003\232\007\nco\231C\265\213*\260Q\216\222^V\254TR9\3733E"
+	.ascii	"\325\277`\211\221zU\375\352\302\200\374C\242F\257_\271\244rf"
+	.ascii	"\177\304[B\374\016\036\211\344Y\207\276H<\324\350\202\r&\250"
+	.ascii	"\234=w\367\244\267,F5\361\220\302\022\243J\033vwJ\r \322\207"
+	.ascii	"\301&\3326\320f\024\032\371<\177x6\320H\bD#Ax\020\212\340@\223"
+	.ascii	"\020\372\200h\037\333H\363\020\260h\002h\323H\"\321\246\271\333"
+	.ascii	"\277\325\023\277\206\013\006;\372\225ob\\\037\036G\241\222\330"
+	.ascii	"\206j\017\224\246\342\346\323\216~\365:q\024\216\211\f3L30T\204"
+	.ascii	"p' \200\202\031*Z\017\244$J\232$|\305\366AXWX5#:\352\320v\200"
+	.ascii	"\2208n\246\030\313\244S{\347\315P\200;.\330\"\261u-\022\260\026"
+	.ascii	"|&\356\270\273\3542i\007\240\307\212\nX\"\201\212\1776u\330\212"
+	.ascii	"\215\226[hR\200\021'\326\200\036\327\331\242\332\323\333e\312"
+	.text
+	.section	.gnu.lto_initEscEndpoints.131.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375`'\004E\027"
+	.string	"6j\221J\260\224U:j\336H\370\353\"\315\2700{\037Vl\240\262x\326\324\333\265\364\353X\352\374\314\3549\233Z\267u\3439\177\332\034\033\006M5>4\373d\r\347\320J\373\301;L\251\377U\304\n\317\216x\205\033Y\264F\310NR\312t"
+	.string	"r"
+	.string	"\205"
+	.string	"\335\273\242\275\252\356%\241\275g\367\246h/\252{O\264\327\324\275\346{\313\356\245\357}\3676\367r\200\036\"\235\340 \306Z9$\227*\261\224Abw\371\334\333\256\022\003GT.\372\355\f\021\251\265\312.\202o\\\322\367m\331\004\203\342\365r\270\354a\232\352\365\360W=\035\215\325Z\371\307\315\323\313u\233`j\255\333\274^\007^\223ww\301\356\002\330\245 \002\375\237w\216,\r\253\2509\325\252\023\260\f\344\024\264e .\227B\255\\\256\231\\\366\231\250G\020\256\223]k\315\371n0\371\254\264\302\207\256\215\354\251c\2251\230\2737\031\232y|\230\007!\242\3569\273\300\\?\304.\323z\237]\332\033\243\2750\332\353B{[\336\373z\257\213\366\262\274w\345\275*\335\233\362^\224\367\266\272\367\204\366\232\274\267\344\275\254\273:\213"
+	.ascii	"\343\0302\261\200\201\230\030\223\313\325U:K>U\322\001\222\253"
+	.ascii	"\376\"\002\276a\203\344g\021y\"%H\375\374\215\273\243\002\246"
+	.ascii	"!L\375D\"}\250\031\fNG\375F\r8\306\321\351\247\216\220\"\246"
+	.ascii	"\240\314\006\231\007\304\274\351\037\332\035\035\360\213\"\363"
+	.ascii	"(\244\020_\220\313\227[\260\213\205\261\f\264\0176\270A\223K"
+	.ascii	"\324\007\\'iY\036F_B`\""
+	.string	"\026<\024af63\271\244g\035?\364\217\375I\273c;{\261\321h\240\325d8\023jh\025$\310,\320fj\262\231\355F\366\362Z\233\01346\031\216\215\215Mv\002q|\237m\n;\033\177G\036\273\313yd\206\020q\317m\213\222\357\365\226S\241\353\257\233\214\255s\016v\235M\fk\260\374\270\375V\316rj\264;\252\034\345+w\025S\256\202\202}\364H9\017\177\202ZG\271i<y\353&\304<v\234\374\024.\0251\3211\240\344&\254\263\216x\205f\311iqW\"\327\311Z\250QXc\rIb\2222\222B\2415\020\003\021!\233\003\020(\bgF\325\001a\360\344\313\273\344\314,\025,\032\235\f\274\276\030\006\371\251\313\213q.\264;\204itc\345\370\n\304\034\032\317\361\242\0277\306\312#\244\204\330\245\026\332\277\271m\245\352D\2640\247\310\332_\207.\325\263BW\233ceF\251\311 "
+	.ascii	"\221\262\241\223a\375\352\235\206\254Q\201P\032&\024\025bZp\034"
+	.ascii	"*\0137+\224K\343\364\207\210$E\360\3145\277\270\223\370><%\002"
+	.ascii	"\333~H\b\374\213^\005\216\201f\013G\r"
+	.text
+	.section	.gnu.lto_mixerInit.132.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375`-"
+	.string	"e\b"
+	.string	"&\020<: \0057\035`\305\006\001\304S\001G\240 \2042\007\026\221\3202\bXX\242\340\344m\243\366\016\315t\265\035\242j\366\027\241"
+	.string	"\022 \220\303L\013:\220\032\350\321T\332d\313\224\002)"
+	.string	","
+	.string	"*"
+	.string	"\227\346l\232\177%\373\226"
+	.string	"\033,6\273;#\311\271+\347?\345\227g\352\256\001\n\273k\365L\035w\274m\003\333\t\266]\002\366S\277\312\316\207LC\315.G\b`A\ts\302\261}\265\217:\n\367\324\310\327\256\b\352e\367C\360\201\300e\301\t\254\313\352\003V\027\030z\317\032\343\001\226bg\215\276\312WF\276\2115Dz\357\322\027Y\227r&\274\t!ih\177\235\306\021\373\325\356\256\343)\330\203\266p\371\343\331\260\214\f4C\022\021\331\004\304\244\310\034@\363\263YLO\307Z\005\266\315\220\246m\223\363\355\253\215'3\200\200\244X\262\245v\t"
+	.ascii	"`\221\"\023\017\372\242=.\354\202!\227`\211\325\024p\227\027"
+	.ascii	"\355$\003"
+	.text
+	.section	.gnu.lto_pidInitMixer.133.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375`\032\001e\f"
+	.string	"\266WTA q\223\016\247G\205.`l\216\320\300\357\007#\026!A\234\321\236\341\337"
+	.string	"\001\344\257i\002\026vC\250U\035\024\325\250\262:\306\266\006\207\004\b\320\240\340.QV\300\003\033\205\324\266\021B\366\2262\245?"
+	.string	"<"
+	.string	"C"
+	.ascii	"\357>\016`\327\344b\305\256G"
+	.string	"\300\003\254G{\027@=Z\017@=z\263W\356q\330\243T\0301\261\261\273\227n\370\366\334\374\227\270\205#\001yV\bv\327\311\221\\\270\365\2665\266\013\330\017\021j\251q\"\242#\345g{ \251\031\354\303\335]\253\311~\367_`\332\202\351J\323T\246#LC\230VMg\246\337\221\361\360\342\023c\327\302\207cO\221E\007\214\355\247\375\021'\261\005\276\311QX\305/q\346\224<\347\024\3521Q\270\031*/Q\300pZ\037\370\276\225\220]\222F\025\352E@\224\362s\252\252\266\020\221qM\375H\016G\370\211\221\265\033b\3007\341@\202U\362\350\177P\217\017\035\020\346\311\264\004\f0\321\305\234\215\326\231\200\205.\217O\003\f\344\271 `\013B\027G\033]\233\2143QG\273<\262L\2730\336\036\256\232\254\340\303\211\244%[*\036$\214J-J+U\032Q\251\320SD\305h8\271\321A\r\027"
+	.ascii	"2\241\371/0.\016\334\203\301\370\2205p\035x\020`\007\233\033"
+	.ascii	"X\356UD\030CH\256\267kC\273\253\226\301T\326\241\t]\2001\227"
+	.ascii	"`\233\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_mixerUpdateMatrix.134.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375`b\004}\032"
+	.string	"\326\360\247H\300\226M:\3644\375\211\2303^\031\354\371\256\273\026\f\201\374\326"
+	.string	"\001\227\320~\314\334\317\t\210\216V\201\205q\303\363\351CB\345D\310\224onL\201(\212\326\321\032\f\336^\270\230\035b3\023`n\335\b!\233H\231R\222"
+	.string	"\206"
+	.string	"\230"
+	.ascii	"\267\257\303\327\331\365\035\317\321\336d\336\030T4>A\271\300"
+	.ascii	"\232s2\270\264\202\361\322\300\003\204\227\340\001\204\227w\231"
+	.ascii	"f_]\2674\305\031,\206\234\266\3149a\033\303\343A\335=*\355\255"
+	.ascii	"Q\f%\270J\363\305\035\004VWpFAo\201\342\211\242)\217R\264\002"
+	.ascii	"\324\301r\205\305uC:\036\200q\204tQ\334\321]\316p\201\345\305"
+	.ascii	"\021\322C\025\227&n\n\246\370\316\030\331@\003s\316\347\270\022"
+	.ascii	"\031\t\251\212;sN+\316\350\350\206\271m\035\266\027\330\340\207"
+	.ascii	"\227\226q\340\020^\352\272~D\371r5\375\271f}\037w\002\362e\330"
+	.ascii	"g&\375Yx\331B\252\351\017\004WI\013\340\350\201\264\233\344\022"
+	.ascii	"\341\367ZzX\t)\027\213j\203\020\241\307}\023\364\230\246l\033"
+	.ascii	"d\353l\272J\366u\260\334jx\223\354\033Pm\003\252k\336t\323\250"
+	.ascii	"zF\3252\252\216Y\265k\3250\252n\251zT\265\250\352P\325R\325\240"
+	.ascii	"\252\367j\275\372\005\b\364\240\310\236\314"
+	.string	"\211\342\327eNI#4\336\024S\342\272\220\360\230\302\265#\334I\023&MpYr\301\r\3677\0336\271!\357\206\025\341=\357^Jb8I\300u\375\220\362\345v\221x'\240\212\027\013\260$%a\275\340\262\354\t7\342]\203\2459\247\003\333\027^$\366\252\232s\352\354N\204B\005\013\026\302\313\335\353\236s\223b\332}:\341+\"\256\222U~\310\025\274\220\333,\221m\003\205a&\336\210\362\205r\223\254\373\003\205\317r$Ji\007\nk\226\210\307u\177e\363<H\3178\247\220\003\377\351@4\3702\002\262\233\347\365\3233B\346\003\013\261A\203\254C\006\230\007\031\006\037\030\317\017\b\330\213\200g\037z~`!f\263\037\230KW\373&\345\370\330[2U[\233[\253d\261'\336\354Z\205\fN\263D\346\2054\373\334\3019\347\034\215s\232\275Y\022T~\267\0263{e\245\n\017\227%\263rgv"
+	.string	"T\314\266V\306\2651\033:\335\260j\3723\314\272\366\267,\233\205\331\2207\364\245\366\340V\336\345P\211\341T\265\326u\203\347\313\215;\205J\n\225\270r\307\r\251n6l\020\036\305\273W\025\224X\316RR\250\021\320\024d\206)332\201\210h\224\026\003\300\002\231!\2536\020H\306Ff\013u!\320\005\007\256,2\322\315"
+	.ascii	"\"\2153\001[\366\032\353.%\212\243\332\034q\r\343\nj\220\363"
+	.ascii	"\367\004x\242\206m\274\266\tP\270\025I\275ID\030\201\n\036\355"
+	.ascii	"\350\265\237\233I\037MZ\243<Sx\027\267m{\nG]\337\001\342\266"
+	.ascii	"\366)\372C\2134\020\024\244TV\3208\270\t\\\313\346\2151\262p"
+	.ascii	"m/A;\227\b\315\005\202N\257F)\224\352bf \256\366\\\360]oA\336"
+	.ascii	"\323\007\202\020zt0di\n~\263U\274\024\220\331(U\003"
+	.text
+	.section	.gnu.lto_mixerConfigureOutput.135.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375`\252\n\3255"
+	.string	"\232Z\334\023E`\\N:\275"
+	.ascii	"\255\213\332\242$\244\0368|\n\n\346o\024\307\032e\246\2372\216"
+	.ascii	"%\225*\266\215\030\310r\371\272w\221._(\022@\t'\257\003?\270"
+	.ascii	"qT\017c4\324c\347\276\317R5\267\226\020B\344N20\001\026\0013"
+	.ascii	"\001n\036\344\360=\313\241|6\026bA\3328\032\253T\370\234hm\333"
+	.ascii	"\n\237\306\307r\265_\261\3615&\243\224\\k\277 \370\201Ak\272"
+	.ascii	"\312L\300\253J7\256W\323\027\327\253\3146\230\205WU!\2229\357"
+	.ascii	"kc\355\275\230m\265\361\265m{\354#E\"\313\300\247kg \025\371"
+	.ascii	"\242\"\321\020Q\3108\f\002\022\032\375\004\201\354\252\246}\221"
+	.ascii	"|6\312\307\037\024\316\333\027\326\213\312\330\220\334\242\030"
+	.ascii	"X\222\023\261QlW\340\007\006\255\257\bX\222\017\221\301\021\271"
+	.ascii	"\304\261\013\215\335\230\002p\246\341\221@\311\035\246Jpd\316"
+	.ascii	"\033\224\2627v,9\224\236:b\376\026\344\002\261Qb`B.|\226\220"
+	.ascii	"\033\245E pv\177{\201\005vP\232K\356O\201\"`\315\007\351\274"
+	.ascii	"\232@.0e\273\274\354N\3475$\205\262C\247y\267\033\227u\362\343"
+	.ascii	"k\n!\255\n\331\360K\231v\026-f\356\366\002O\274\206\\5U\340L"
+	.ascii	"\303\343t^\314\324\330\306\310\234\024\370\343=\374J\246Jm\333"
+	.ascii	"\376\354w\371\245u/\033\325\266-_\256/\260\363\321\231\377\307"
+	.ascii	"\314R\314\301\020\001zrPg\216F\004\277\354*\217 \001\243\357"
+	.ascii	"v&77}j\0373g\207F\355'#\235\375:\220@\343$\257\236\013\250\002"
+	.ascii	"e\246i\3239\275Mw\320K>"
+	.string	"\257a}\251K,\332<c\3556\001\215&\257\036\276\375\356\376\026\217\244{\364\022\253\201~\177K\214\226\230\217)q\202\212j\275j\240\205bk\372\230\257Z\371_\036W\305/c+\025\367\\*\326\253\252R\r\237^\326\375c^\323\272\375d>\224\035e\023\3560f\007\r\016=?\245\227\03181-\005/\033x\227s\322\271\234\221\336v>\002^6J/\033\323\313E\351\345bz\231(\275<\224^&\252\227\205\372\362\020x9H\275\f\264^\026\262\227\177\330\313\301\3652P\275\314\252\227W\365\262\232^N\373r\367\345\333\227\377 @\2376*\314\264\355\216?\277\226\215*\206\311\241\177\227\237\313\337\366\224\371p\3046\251\004\257\311\033\013\221@,/`\027/j\352\250>\334\324\270\026\016*\337\3601\037\215\037i\310+\367\\\303\034rf\330$\033+\250\237,\214\n\227Z\215\0325\035\251\227\035\324\022\326"
+	.string	"uP\177\253O\326m\201\232@\234\357Yi2\201\220z\251\217\206GGO\212\bg\273+c\346\f\34735\300/\365\262l\3764\260\205}e\024\342Yn\r\366O_\371\004\251\203\375\267O"
+	.ascii	"\303\333\333\352\223u\377\232\243ca]\302\007}\345\3412b\251\025"
+	.ascii	"\330W\320\250\204\363I-\335\355Y0\336\345\001v\260L\236\331O"
+	.ascii	"?\357\\\217U\316\341\323\013:aR\027\354'W\255l\013\230R\007]"
+	.ascii	"\303\332\271o\270\356d]\n\247S\3418f\345y\026\006\214\265m\022"
+	.ascii	"j\316\3610\244\0328\254\034\326\253l\223\035\234>5\"\272\271"
+	.ascii	"6`?\271\27125\247\355\240\217z\311d\326\243~\0364\372?/\310\223"
+	.ascii	":v\301\217\232\251\017&\347o\3558\347\272\363\252U\355\265\257"
+	.ascii	"t\332\251}\234\322\304\231\306\374\0267um\246\004\334\361\347"
+	.ascii	"\316\246\003\211\365*\2159s\313\346\026\035K\276\025\0043\337"
+	.ascii	"\003i\277"
+	.string	"\b4\016\363\207\247\001qaJX\362\301\2710o\270\334\024\353\314\021\234\302\352|\302\351\212J\206\025\213c\214\024UV+P\034[X\225`q<q\005\343\350\004\200]\274\240\272:\306p\341\342\352(\\\313z\207I\315\325\351\253\223\325ZE\375d\026\rQ\203\356\350P\323\237z\031\375S_\r\032M\213O\335\240i\370\231a\320\2072#\205\334#\034w\304\367y\305\220O\344\021$\031\222l\275E\256\021\216\343\22712\t\177\271\347\342/\353U\006}\266\3373\2652g\032\263\265t\365\205!b\272\314H&H'\367\\\374\263\377\310\355a\2435$\344\324j\324\330\364\244^&\265QK\020j\243n>[}\316t3\303#&\265S\037-\217\216\322il\"\316!Em\354\024\017\312m\002a\026\365\352\007\244\330>z\360 \352b\247x\244\334/\257\035D\275\356\235Q\033j\0359\226\034wN\3336\353"
+	.string	"\261\207:\345C\345\342\3408\004cm\333>`\346\013wkj\300]\333\266sWI\354\303\235I\271g\246\366-\2726)B\304:=3c\207\301\271P_%\205\232U\3461c\016\373Y\346\303\003W\251=\362leF\006\200\333\250q0\344\fc\246hdD\232\244\220\326\200\002\221)\262\362\022`F=h\235\031\273)\025\246\375\r\001\242\n\313o\"\341\251\n\316u7\267\231\317*"
+	.ascii	"2U\212\305v4\\\221\207Y\004\203\221K\371y\300\366\325\247\033"
+	.ascii	".\210\215#\364\301\032\211e \340\201\204\267`J\226?\313l*Y\223"
+	.ascii	"\371\336\245dI\262i\305\265lQ\021+z\333\005rIXQ\313-\362\be\206"
+	.ascii	"\224>/s\224v\002+y\030\276\\\207\321s\212\320"
+	.string	"\343S\303\271\236\374BYE-\"gF\255\227\276\342TfDim>\325i\357k\004)_J\016\017]F\";,u\201\377\274\341)\2679\303\n\275\323\020\354$\236!c\246\0326d\007\003\200\262\334\025\020\366\027\214\270\342\026\331\271\252\346a\371\327\263\t@g\310\036\rl\312\326\300\252\214\200\212\200\013\t\230I\324\356\321\035\250\322\223y\320\215\r\341\2212\307\243\200=^U\023\177\203\252\356\213\024\215\013\261\261:\300\245 \301\302\230s\336\325V\232#\224\357B\234H\217T\374\323\236\031n\331\321\264\344l0\224\2366\240\333\225\017\352Kd\t\336`\217\221\2207\226\245sK\313\356\3144\026\201\026u\337\007T{_\2231\302e\004+\313\311\220 \002\306\027\023\313\250}\255\200\345\021H\312AP`6\372\033\326\b|\271\017\350\001 \344\324\357\346\b\260\357\300\t\306&\204i\336\243\020&\020\260\177\367\035\367"
+	.ascii	"\351\314\223\3238\240s\"\307\372\220\220\364\213\353\270\235"
+	.ascii	"\252\n\334\331N5\346\372\277*hN\337lv\323\347\340s?\237\225\353"
+	.ascii	":\031\034\252\233\f\372d\263a5"
+	.text
+	.section	.gnu.lto_mixerLoadMix.136.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375`\236\003m\032"
+	.string	"\006q\252I\260\226Q:t"
+	.string	"o\fn\263\177'\2472\025IhP\231\352\311\226\277\340\320p\212\336A\025S)\216\313\324\211\376\255\326\031\205\315\013\356\300\207u\337H\373a\377\311\201S8Z\275F`$\037E\0379\273\350\023B\310\226;\245\225"
+	.string	"\211"
+	.string	"\227"
+	.string	"M^\325\352\202H\251\326\372\262\002\362\241\201\267\210\017\351]\342C\333l&/y\365I%t\214\250j\255\260\035z\360\301\321\344iy\323\265\235\034\305UHw\332|\337\247\317\020\234\223t\034aB\306c\240L1\035)7G\025\032>\027I\237\257\250k\305\217\250#\375"
+	.string	"\222\036\025tA\224\215\237\373~\240F\317\212\031\322\221\247'\n\300n\004\215q\322\344G\267\303MJ\003\305\367G\237D~8`\217\035\212\3171B\255\325sgw\342V\271\355&\333\020\354\255\001@\270\031\264K\234\271B\366c\234\344fx\203l\227\226\027\375\256\367n\226\367\376\225\377\356\326\215n\326\247U\302\351\325\234&\351\364\270\323\342N\207t\232\316\351\335\351\271\323\037"
+	.ascii	"\241\005\020\013\242\235\005\226"
+	.string	"\325D0J\205\n\231\210\376\373\215\220\f\344\224u7\241\n\n\007\325w\370GFn\"qz\310_\022\317T\255\025\346\241\037\220\017'\313\366,\257\303\366\"\021g\2515\350\210R\255\345\3130\362\241K\362\323>\216\347\260\275\347\t\244\236H\2546\b\204H\367\202\355\330\205\314\270\360j\315q`\233\302\231d\001\244j\315\211Q\372\322\006J3\023\2773\333\373\376\002\004R\325\273\205+\344\321i]v\225L\230\263V\347&\221\265\357\371\224\344L(\247\265\326JY\353\262!\250\236\344\200\234\204\300\366\360\037N*\300\253\265:\360}\334\324\004H\305\020!>|\341Q\335f\320s]\273\373\334\215\225\333\210\370\235\373\\\r\326~\177t\352D\025\324\231r\233\301\335\037O\325\322z\301W\226ew\350\b\007<\n\262\327h\261\033\231\004\232\231M\355\203L\353&\206\241F\026Z\206\001-v#\243\201\331h\230\221q\310"
+	.ascii	"\253\221Y\240\201\311\320j0\006\004<\353\020\243\301lf3\032\214"
+	.ascii	"U\326o\220\357\344\323\022\324mq\344\n9\300\216\330\262!\214"
+	.ascii	"\025\314[\253k1\361=\255Ve\2573\345\346\n7b\341\345${)\262\332"
+	.ascii	"\327\213\336m\006?\223H\201\242\033[\333\262\237\252\002\236"
+	.ascii	"H\007\231\006<\177F\364QS+\260Kt?7\327\222\273@\304\245;\236"
+	.ascii	"\307\303\025[\033\356\221\376\032\n\342\003\376fQ\n\0268q\205"
+	.ascii	"\374\007F\250Q$\244\020\204\202Q&\220\t\204\304\264\320bp\002"
+	.ascii	"\021cU\036\020pW\233d\031\003!\344]U\210u\2546;\236\017\323\006"
+	.ascii	"f\274'q\267\210\321\367\247l\020\203|U\254\\\327\020\211\373"
+	.ascii	"\240\312\304^U\350?(Z\347L\360\306,\346h\201\030\204\361_\340"
+	.ascii	"\225q&B\352C\375\352\177]\265\323\230<a\220\246\220t1\004\005"
+	.ascii	"\374l6`\246\335\255F\034\264P\350\350\241@s\351\200\327\274q"
+	.ascii	">\r\303\324\326{\244\025x\314\270oB1EdG\236\032\305\037\303\323"
+	.ascii	"K\353\240\376\321\340\217\327\301T"
+	.text
+	.section	.gnu.lto_mixerResetDisarmedMotors.137.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375`\t\001\375\f"
+	.string	"\246\230XC\020\261$\035@\bS\343N\344\2015\020\272\372\257\242R\343\216\363\013\360\215\370\264\306\246\017\006\334k\205\207\2555V?\211P\002\255W\3464\253\252\252*\337\360u%i\222\002\0169\004\351b\021B\366\2262\245C"
+	.string	"D"
+	.string	"F"
+	.string	"16v\367R\020\266\376\342\375R;|\232\232\357\362\003\246\233\215\013\035\276\352\004%\006"
+	.string	".\303\373\340\334\250<>M\270Q>\022)\327\307{L4\033\227\362\254\026\354\256s\3438\334\324mg\266=\366=\002#\254+\366\273\356\316\247_\025Pyq\201\264\273\341d\332\032\310B\304\273\3337\341Gw~\342/\332;\317X!\024\213TRAcw9\016\235\300:4p\001\324\341{"
+	.string	"\352\360\035k\366\214\307\020\373R\247!Jb\242)\3710\312\223\257\266INri\200\214\335\375\3701O1\301o94\205\221\221\255\206(O\366Q\034\306%\277\305\026,\223\337\016}\313\350\343\021\224\200\221\323A\224'U\322I\316\nU\026;\206\362\203S\022\330\375\321\221\201T\300B.\021\007\r\260\007\f.\b\230G\310\365\221I\270:\b\030\024\001$\273D@\240\354\352\304\275\256\270\334r\341\241F\244#\250,\256Z(\245j\223\034O5\361\f\225\372\027\030\033\fy\343ow\367Y\301S\251\027"
+	.ascii	"1\003\373\334q@\343\224}Yb\326|\210\342<\2042T\212\210\232\003"
+	.ascii	"1\366aZ\202v[\342o\233\030\272\220\301\352\364K\023\201c\034"
+	.ascii	"\276Q\366BU\343\375$\322\271\346\023"
+	.text
+	.section	.gnu.lto_writeMotors.138.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375`\206"
+	.string	"M\n"
+	.string	"vSH@0\247*\035"
+	.string	"m\334=\3562f\323\347O.\332w\250.\237\334\344\241<0\237K58.\355\2417M0\022\334}\324\260\246\324`\215\301\300 V1\340\201 \036bQEU\320eCd\313\235R3"
+	.string	"8"
+	.string	"4"
+	.string	"\373V+D\200\203\335\335\324\304\223\336\247J\317\277t0`\370}j%\327\205\32045\273\373\325\345),Iy\351\354\256%\030\222\334\331mO\330\216\260\237\020\017\007\024\220\006\354\212D\200\260cf"
+	.string	"\345\254\333W\361Eg\374\225\003\360\316\262K\373F4\002-\004\260\335\335<3\204\366L\363\006\313\263y\006\313\263g\354\331\f.\252\002\026q\310\203V\375n\361\273\204*\006SM\231d\271V\004X`\2221Oi{|\310\203W\205W\312X\322\317\026?\251)X\201\006\243\025e\237u\317K_\013\334\355\341t\237\016\016\264\2150.\270\f\213M\203\243"
+	.string	"m\236N\264q\034\034\332\370t\333(\024\352\266\214\270W\324\352\332\3135\202hij\312\027\2179y\220@n>\365d_\244\003\016"
+	.ascii	"2\003\376\031#\301q\332\341.I\361 .\343\332T\020]H\341B\277\\"
+	.ascii	"\021\\~`\224\241\206lW)\003"
+	.text
+	.section	.gnu.lto_writeAllMotors.139.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375`\346\001\225\021"
+	.string	"&buF\340\322&\035SG\272\027d\002\375\035\250\254\235\231\017O\255\311\\\027\322\233\330|>\257\017<\266\265\374C\254\331V\364\3737\262\034R\247:\022\345\030c\234g\312\023\034z\001\213\314V\266\347\236\354[B\310\336R\246\024`"
+	.string	"_"
+	.string	"^"
+	.string	"\037\220]\352\005d\227f\331<\376\351L\215g\307\f\220\2179'\267$\274=~wT\326\265L\306U\226\377\363\004a\216\316k]\373\360L\304\233\211$0\031\225Q\213\251)!\342\305\304\024\244\330\320\301+\215\367\322h\342\346{\360\013\222\302\316\273\271j\f\346\234\326\316\263\271\267\333\266\261}b\253\201\231:\244t\237_{\220z\245Z\243\372\"\b|\340\330p4gM\bd\026\311!\236\007\335\376\347\2036\371,\016\304z\220kl-\017\033(t\024\233s\226\\\332d\273$\211Wq\030\314?;\bb\272\264al\323\245\232l\253\332O\361\036\326}4X\3169\002\306\2149\347\211\025l\227"
+	.ascii	"\002\273\237I\362c\\\306\212\277c\024\013Kv\251K@\007\b\227\206"
+	.ascii	"\217s\316\031m\362\270\245}\210\244PF\304KC\177mc\370\013\013"
+	.ascii	"\215\350\3149S\374\026w\221\362w.\255j\321w-\331\345\273\036"
+	.ascii	".\r\255\355\367\340#\215\020\224\211\2714\334\005m\304x\2739"
+	.ascii	"\366\367\322\247\350 \305\2748v\250\237R\352\023\312J%\003*\305"
+	.ascii	"\275PXAU\230\300Y@EHq\247\225\013\207R\300\252\013*+\356E\245"
+	.ascii	"Zq\246\317\365\305\371\371F\364\243\310\265/-\300\003\b\372\316"
+	.ascii	"\273-\037\270\351A\221\335%\013Y\t+\214F\324\207\235T\364]\310"
+	.ascii	"\036\366w :Q\364\332\226\334\034\227\214\266\264k\244%\217K\023"
+	.ascii	"w\267\301\r\016\212d\335' `\002Bez\241\300\356\035<\343\252\353"
+	.ascii	"@\216\275ZW\307t\201\005\002\343\005\333V\230Z\377\304\222\t"
+	.ascii	"\t\345\374Y\221\221\006\211\321\034h\371\276\272\252_\256\226"
+	.ascii	"\353\324\036\331\362\304\2358\004\034\345b$\342\257\344v\211"
+	.ascii	"\023q\021\030\375B\215\341t\326XI\213\237\224;\027}\002"
+	.text
+	.section	.gnu.lto_stopMotors.140.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375`/"
+	.string	"\325\007"
+	.string	"R\31755Po\322\0015\302H;P\301\200\274\362\301(\222\312$\352\322N\355\336\203U[\"+86\"{D!\332X\242\252\232\261\030\370\241\255\242zpl\322\244I\231R\346h\262\216\304\205\301\317\202\302\325\220"
+	.string	"\035.\004\fr2\017\324\b8>t2\370\2111\203V\267\277\254\2222*\032\036H'l\245\301\03106\0267\030^\225\252\266\007\"\317y\200B7\247\252>t\272\246\276\002\345\"\037\261\311\367p\204Ky\356\224\357\022\346\3245`D\0022\002\345gw[\352\206\375\313*\311\326\264f:\237~\265\311H\321\276]\213\257e=\312\344\303\366-k\366\312\273\216\275\351\024*a\331]\250\034\327\236\232\377\220\003p\242\355Y\035\354\256\223\023]\334z\333\004\266\013l\237\004\f"
+	.ascii	"3\241\271\037X\314\\\260i\016\232\206\247\262}\244\332s!g\031"
+	.ascii	"\354\277\214\013.\335\242\235O"
+	.text
+	.section	.gnu.lto_stopPwmAllMotors.141.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\255\007"
+	.string	"\242\01656@o\323\001{W\346Z\325i\370\0037@\003\325\341\022\202z\0202\247\021\234\261\304\311\021e\017E0\256\372<\3140\214.j<z];$\0013a\337\215H\231R\356p6\017\005\226E\020\303\002\346\240\020\0370\204,v\266O\344\fX\203\360l\021\244i[\274\300=\265Z\322\254\210\204\"\255\360&/\225c\226\335\220%\200\204\232L\265#>y\317\004\026\332\371\232\372Q\314I^\"\341\233<\021\312{\257\374\220\365\352\032@:y!\211\362d\203]\352\206}j\265dg:\237\276\265\3410}\277h\331\3158\301lX\245|\330\376e\316f9\350\261\002!\030#\023\227\335\215\332q\356\311\371\0379\200\367u\317\314\301\356:\275O\343\326\333.\260m`\033%\013"
+	.ascii	"3\241\233\037\270\310\\\260i\016\232\206YT#.\214\032\203%/C\200"
+	.ascii	"K\267h\347\023"
+	.text
+	.section	.gnu.lto_calculateThrottleAndCurrentMotorEndpoints.147.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375`o\n\r1"
+	.string	"\372R$\022CPdR\007\223\364\275\360n\215\217\263P\246\347\301\354]C\025~^c\241\255D\340\307\027\027\204\231!\022\232i\025\017\210\nB@\033\025\001\217\306\201\205@\340\347\253)z\225\3411J3\262\265-wJ)\005\377"
+	.string	"\372"
+	.ascii	"\034\001\316H\252s\200\353|t\235\001\\g\243\325\271\350:\023"
+	.ascii	"]\347!w>^g\343u\026\272\316"
+	.string	"\305\325\231\270:\017Ug\341\352\034T\235\201\327yU\235\357;\273;\267\006,=\0359\310\372)eY\035\177\201X\273k&J\267u\2733w\2731\221[K\263)\273\215\245\315\226\261nwG\255\211\036\313\262S}9*\330\327\251\217\326\276j\033\255}Y\311\234\247\337\320X\244\032\232\023\316\017\313\262\311?ke\023\r\035\215BE\342P\030\004\256W}Wr\003\255\204O2\260&\032:\022ic/\323Z\210\210\3524e\314\314\213E\246\214\rq\"\320\nIYZ\017\205<M\031\013\342BO\353\340\023\222\262\266\201\255\323WUJ\257L\237\276\033\003\242\036\351\200\362l\372\355\321\252\221\314\006\221,\314\377n\fMubY\266\335\332q\2201\335\201V,\313\262?\311\312\232\213\232\271\227\230y\002\363\360\006\302o1\300\017~;\007\2419\003\374d^\333\322\377\250\332\fK\203,\313>\340&\323e8x"
+	.ascii	"\001b\355\273>\211\226n\315\314\275\317=\246\345B\320\020!b\355"
+	.ascii	"\013\204{\356-yD\207)\021d\331\260\006\334_\032\214\tn'}\371"
+	.ascii	"\004\026\326\332\367~{Ikk\225i\255\372v\353\340^4\257"
+	.string	"\233i\365\257zvg\313\364?\346\356\322pY\334N8\205\326\345\326Z\373\372\307h\323\254\265K\377s\226e\301\376\241<c\355o\212\326\t\363?<t'\266Y\254\314\\.\274\237\375\305f\0172S\275\260\007c~c\266\312>\224\271U\226eY~%\314\027\256\254\"0x\347\252nk\246\272\316\013\256\263\202\353<u\235\245\256s\324uNp\235\021\\\347\003\327\331\300\352\\@u\206\272\316\004\256\363\323uvr\347\001\327\271\351:3\255\316K\252\263\200\353\254t\235\223\2563\362\006LbT\314\357\271\327\344`\177M\217\2343\307$\b\020\323\177\265s\226\226\274\235\025\227\236(\340\227\246\002\276\203\264r\246\304\2072\373=\271\222\263\326*}_\024\357{\356%=\362\225\276\233R\230I\217\204C\372\365\221\337\301Gz$\246\230\264\251\027\200\317\372\001\376\030\025\213k\2669\332#A\017K\325\216\036\351f\016"
+	.string	"\036;,\245\302r"
+	.ascii	"\376\253u\263\206\346M\222;\303\207\262\321\257\337L\242n\212"
+	.ascii	"\336\350UAE\337\177\3326Q</f\314&\\\342\324\b\203\017\355\031"
+	.ascii	"+7^\323\231QEiEie\355\353\200\016\337\322\377Z\312\214\216\007"
+	.ascii	"\360\241\334\\\372\3705\242u\240\234Y\231E\311\346\375<\276\277"
+	.ascii	"\335M\355\230\017\026G\351v\341\333\254\255\233\032\357$\330"
+	.ascii	"Q0>\262\016H+\364m*\364so\311\246\351Xz\305r,\267\366\025\372"
+	.ascii	"\257\226n\332\362\031\266+h\353C\271\370\353oE\353\210_|uLSo"
+	.ascii	"\370\301'\376*\250)E\370C\013=\227\246\325`\310\240A\303\332"
+	.ascii	"7Y)\266Nt\360\202\321b\313B\326\n//\256.\025\037\274\266\262"
+	.ascii	"\272\272``%1\026UW\326\227\026\213\244\227\212\024Z+P$\267\264"
+	.ascii	"N\260Hbu\275HR)1W\213\254\256\244\027\027WW\222\370\266l\225"
+	.ascii	"}%\\U\347\214;F\370*\2513N\310*\213S\032\274\360\356D-\317)\035"
+	.ascii	"b\360\256E\r\214S:\274z\252\307\021\204\263\307n\371L^@\345\254"
+	.string	"O\301O\375\0025\005/\214Ra\312oJ\344O\334\232\250\357\2717\364D\277\366a6\313\354a,\273\204\222\372\241go\362Q}\324K}7\327\244E\375\206\326o\215(\301\0314\301#\373\346\020x\022?\202\340[\264}k^$\215\301\267\217\226oz\300\211\2401\360\004\376@\2017\360\027\256\251\007\365\005\232\270\020\017\002\365\r\322\274\365\037\004^F\3137\344=\"\344\231J\231\331\241\312H\264y\256\370y\3621\317\361\364H<N.\346O\247\007n\361B\307\214\255\205\200\005\016\3341\257\271\361\374\206q\207\021\036F\241\001\003\336\337\340\250\271\r7+\274i\321\003\200\336\250qL\310\fCD#)IA!\303\032\360\002\021\031\"\316\001\021 \251\224lH\244M!\033\007\377h`(\355_ \365\337\027\007\245/\211\246\357\365\310\b\321A\013\244\001\223yn\024\337H \177\007\212\236\217Kl\177\020\021x"
+	.string	"\030\256\006\357\350\007\363\341\342e_\020Z\237k7\002/\352\021\222rh\252\022\353QL\0360\342\221\303\251\215\331\334\370\304\200\n\342\"\025\365\225\340\260q*\313\f\027\254\026\\z\306\205\024y\0178\224j\264lH\251A\353\031\025\243\341\334\303\262=W\332\312\222v\243Yf\244olOV\313c1\310\204s\200W\037#\021T1u\2021e\342\016f\326\3051\202G\016Pi\367T\310:9\230\201\215\005u\2250\032\273\031\224p$v`\311bc\243c$[1\200\273\001\004\n\367s\333+O2\273H\253\017\374\346/\3114\002s%\213\006\262-"
+	.string	"\302@[\361\343\213\n\227\216\020u\377\\7\341\303\367\357\026\2232\027g9\212\343\337\246\036\330\320S\254\242\360"
+	.string	"\351\021\315\230\334\202 \347\335\225%/f\334_X=\211!\305`M-j\217q\241D@\210\213\215 \026\271Z\034\001\302\277s2R\224U\364\2324\321\342k\365L\344/T~\373\370\351\024\025~\256\245\200\374!e\252\002af\242\026Q\265\243\3564\231\005\004t\204%\213\243\211\355\216a\251\3328\261\3147w\335\362\227\036\252\257\n|"
+	.ascii	"\313\203\3019#\235\325"
+	.text
+	.section	.gnu.lto_applyMixToMotors.148.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375`R\f}C"
+	.ascii	"\nw\020\032>@\350\316\030$\f\355\337\220\366\032\033\306\005"
+	.ascii	"\345Ag\376\246\202\274}\225\347t\314\311\b\304b\351\220\366c"
+	.ascii	"\006>\310\250\034\370\235t\312\200n\300\t\227\317\241M\017\206"
+	.ascii	"\366\222-\245\2242\245\224\002\224\001g\001\223\001\257\357\211"
+	.ascii	"\024\347\326G\346\346\261\260\3276\332\354\343\033\314\3026\334"
+	.ascii	"w,\264\3438l\301\250\032\240\032n\257\336hZM\263a\341\232\034"
+	.ascii	"\352\313|\237\217\271\207\356\313\327\003\t\310N\223\243X\006"
+	.ascii	"}\325Z>& \250\211\272\035\3053\350k%\350\244\211G\267\325+wp"
+	.ascii	"\331\235\271\313t\024\331fX\312\300\367\245#\t\357}_\006l\301"
+	.ascii	"\355\265\250\266s\207i1=\006\331P\036\355\364\276O\354\340\275"
+	.ascii	"/\224\001?\2006\221\355\325m(\266\351\230\201\275r\002\267WF"
+	.ascii	"2\033\242\352\361\226Ex\373[\236y\364\276/\327GQ\331m\025\332"
+	.ascii	"l\365\310\276\262\252\242\232\222\"FA=951\r\227\224\204A\240"
+	.ascii	"\333\262\253\372X\216\344.\353\253<)n\325vAi\003\323UrM%\367"
+	.ascii	"\305\247\332\256&mYZJU\340\304C\244\367\326\260\250D>N\b\265"
+	.ascii	"\234,N\274\322QW\2548\324\0258U\374\211J;Q\2013\305\233\332\256"
+	.ascii	"\274>\021\347D\324\244\rL3%q\363!\334Z\022\265\270\267\346\364"
+	.ascii	"%\267V\202\333[S\342\302\336[K\002\267\206\304\203m\027\260\223"
+	.ascii	"\315v\367\326\230j\361}\337\246\267\002\232\264\035iVU\320\227"
+	.ascii	"\327h\310\246T\211jX\320\232\315\322W\265\355\241\206\245\367"
+	.ascii	"\326\346T\n\177}n\372\256=\215\315\314\325\340\033\221~\227H"
+	.ascii	"c\251\001\236\270\371"
+	.string	"\r\331z\250\305;{\226\315\246\005\300\255\321\271\267]\357\373\262\243\261\2655g5\263\033`f&s\320G\003~}\016z\352\257\337\313I\311>*b\250\237\025\250\325\367}_\225\027\364\200\377\360RQ\265CJ\247\231O\371\177\217\245D)|X8#\264DI\237\202i=,u\337\367\245\300\235\247\365Zp[\351\225_|}\261\275\376\367]\257I\230S97I\237\376\243\231\323\203\355\377\311\335\024\244\374\365a\375\023\356,\366\201\273\027\rt\346\177\334\235\305\366?x\366%\323\254\351t\0350n+\034\026\303\033-\006\333k\177\263\351\002\210\320\3649\3030\223>e\206\232\371?\r\0319\203\343\177\302\f\342\203\007\016\033Zg\257.\r\031\332L7\206\206v_\350\272f\013\356<\301\235%t\232\346\b\2553\004\326\371A\257iv\320:'pg\004\255\363\001\003\005\372M\263V\3435\023h\273\346\001\255\263"
+	.ascii	"\326\271\330:\007h\235\001\264\316Y\356\214\345\316W\356l\345"
+	.ascii	":W\2713\225;O\271\263\224;\023\3359\312\235\241\332\371I\350"
+	.ascii	"\354$tnrg&w\036\266\316KAg\245\326Y\bt\016\272\316@\327\331u"
+	.ascii	"\235[\327\231m\235W\326Yu\347g\235;DU\237(\237\2317H\377\007"
+	.ascii	"\372\252M#\275{V7Y\372M7^\267]w]w\232\3565\315277^\313a\026\362"
+	.ascii	"\215\216\303.\232x\204n\270\341\274ai\277m\001\200ze\357\341"
+	.ascii	"Jd\224)\310*U\330^\247\276\375L\021C\374\250\227\372v3\3427\230"
+	.ascii	"\302\304\360P\037\365m\034%\034{\331\212\035m\205\233\007\333"
+	.ascii	"+\324w\332\021\247\277\360O\337\312-j\363\035\266\351\235\276"
+	.ascii	"\225p\004\276\351\033N\263\2106\247\313I\037w\3079\327\244\264"
+	.ascii	"\325JuqB\206\013:\001\323\017\337\302\273\235\022\316l\322\025"
+	.ascii	"\246\0072\223>\215\204\314\302w\303o9M;9&\323?y\351\205\017#"
+	.ascii	"\212G\351\227\220o\375\207\214s\337\367l\002\367\243\366Cr\361"
+	.ascii	"\202\224C\312\261\275*\375\202@b\202/\374n\320\215\220s\213\232"
+	.ascii	"\0212\fr\214\227\027\333k\360O4\333\270\243)\221\206\300W\232"
+	.ascii	"\304\001\370\354\234%\253\2417\217\226\376\331\021\336\266D\225"
+	.ascii	"\376\311\356\277\230\342\353\206a\341?\231U\266\3754S\335\233"
+	.ascii	"\0360\302\203\3704g%\274\022\2408!K)p\302#\370\264A\335\376\263"
+	.ascii	"\265\341\213fyS\177`\231C\210\360Fk?\253\356\255\317\257\357"
+	.ascii	"\354\313\324\340?\331\335\255\346R\276\351\265\013\372\300\247"
+	.ascii	"\025\0321\341\300G\370\226\264\234\224\364)\013t\021]\311\343"
+	.ascii	"\032Y\366\375/J\202}6\215\037${\314\276\254\235\366\356\314\265"
+	.ascii	"\377\004\324\201XZ\202\357\370\216\355U\302\263[\232h\344\264"
+	.ascii	"\320\260,\331\177\346`\035\274\013 |L\024\361\t\222rf\024)\274"
+	.ascii	"\321\034\364\023\345\033\324\257\317\354\313XB\241\037d\326\177"
+	.ascii	"\262\220\312\177\370\225\n\326V\017\370\264,\243\201\r\031\307"
+	.ascii	"\2571.\032\306\2611#\230P\254\303p\210\035\301\274\206G\243\f"
+	.ascii	"\033\035\302`|\331\230!\366\005c\351x\243\306\361\006\211\260"
+	.ascii	"\031\307\243\221L\306q\0306\343\013\314\204\016\2611W\207\330"
+	.ascii	"\b2\343\3218\346\202\205\325\260Q\214A\366\3452X\003\2620\035"
+	.ascii	"bc\\G\0311\304f\300\340\242!\3665\306\005Ff\203\253\201\025\033"
+	.ascii	"k\204\221q\035\215F2.!4\331]\3117\273\372'\003\005Uy\370\027"
+	.ascii	"\304\264\325\004\b\274\200\342\013pfQ\325kJ\345>P\232(\221\254"
+	.ascii	"\274\350Q\265\221:/\316\251\ro\340\323\b\274\207\357\2746\021"
+	.ascii	"m:R:\r\274\021\2262y\221\023M=NW5\204\303\0016\273E\3160L'\325"
+	.ascii	"?\271D\027)\b\300%ykS)\021\300{mu\002EQA^\277A\204\023$Re\037"
+	.ascii	"\335T\326\007x\b\317.rS\223,\"\365\244\005\354\023\227e)\215"
+	.ascii	"\352zV\241\264\276\300\247\005\220\323\316$\262\304M\021\237"
+	.ascii	"^\201\017\200\340\001`}\326\267R/\311\206\365.\232x\374\210\377"
+	.ascii	"dW\353z\262\346\034?B\215\376H\243\376\311ZO\374\366\315n.\252"
+	.ascii	"w\346\177\r\365O\306\252\343\"\306I\3033\325\305Mj\312\360Z~"
+	.ascii	"\032\304?\031\273\271\247\253'\276\206\177\273\fo\365W\337J-"
+	.ascii	"AX\252\304\352\373Q3\216\037\263\353\024\222*q\252z\262\250 "
+	.ascii	"v4O3\272!\2310a{\255\372\n\3158rL\252\227\372\f\337\222\224N"
+	.ascii	"\013?\365To\305H\tg\346S'\356\203\245\355G\312\373\276\023\276"
+	.ascii	"\370\022\371\354>\001\200\360\250A4\004\221C\006\315\314\210"
+	.ascii	"\210$I\222\016`\002\221\261\253z\021\200)t\222(\205\346\263\004"
+	.ascii	"\307\330A\352\200\021)\t\245\201x^\2029\36483\237\274\222\016"
+	.ascii	"g\270\366Z\007\f\265`n\356\254\2542\230 QpFw\020H\231\313\360"
+	.ascii	"\033\225\216\340\213\204\250\t`\345;\377\377,\244x\260\306N,"
+	.ascii	"l\302B\346\320\260A-\365\337\005\274\t\237\262!\360\201\tJh\261"
+	.ascii	"&\300\234\222j\260\301\001\300\360\363 r\362\371\265\034\247"
+	.ascii	".\352WR\340\222\232\310y\207\355`@\220\326\330\277b\225\301("
+	.ascii	"\345,\261\240\361\346\324\215\320+g!\003\231A\373\350\333\340"
+	.ascii	"c\007\r\225\307l\321Y\241\333\244\351\272\206\224QF\253\301e"
+	.ascii	"\236\264\363\224\032C\314\234A\3615\312\003\024\177\32452 \307"
+	.ascii	"\032\346\004@\243\327\202\256\242\230\250\300\345\300\341\226"
+	.ascii	"`\251@\254~\243]\215\241\031C\270\037\r\001\377\tf\004\256%\375"
+	.ascii	"F\235=4A\341\0176\223\347\246]\024\215\251\361\362\376\t=5#'"
+	.ascii	">\335\337\013\312\333\237\210\371\367 \242\300B\271\303e?\312"
+	.ascii	"\200\0200`[%*B\017N\376\242\207\312\336T\256*sB"
+	.string	"\313\366\361\263\301\360yP\343\030&^\366\211X\035\246\345H\315R\272\300\374V\257.zi\013\2542&b\030\363I+\206*\252W\235\202\t\370\022\241\204\306g\0322\222\263B\323H\266u\320S3\331\305gNm\361\031\255\001wi\203GeI\321\001\321\220\013\315>\020\263f\354\"tvz\360D\230 \321=\\\230\300"
+	.ascii	"MJW\242\260~\264\320\"j\310\357\277/\267\321\332NB\234\221\357"
+	.ascii	"\002\277x?\323.\032T\207\352\360\261\270\231\270-\302\320\203"
+	.ascii	"\313uB\223\244\304M\334_\214(\265\232\031\3228z\265\326H4\215"
+	.ascii	"e\375\001"
+	.text
+	.section	.gnu.lto_mixTable.149.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375`\334\020\305Q"
+	.string	"\332\212\244\036O0\220RI\007_o\231\016|bc{e"
+	.string	"\003\320\331\342:\037\b\314\333$8\235\347\204\217>\367\241\315'\224\326\215C15\246\251\272C\270?w\260q\363\036J\023\274C\360\261\347\003\324\257\031\334c\212DD\275\214\310j\265\355\326\b\2212\311\333\001\232\001\341\001\357\362\333\035g\367h\366v\20323o\316\350\3550\305JZ\016\373\274%\226\001\001\206)#\240\325\177\331\223Y\342\230\r\363#o\246\034\3413\253b"
+	.ascii	"\361\210\376\306\300\374n\227\270\035\374\313\272 K\242J\007"
+	.ascii	"\273\304\237\347e\370\334\271|\206\323\360\032\236.\321\206{"
+	.ascii	"9\336\356\203\352\306M\217\017E\301\222\324\237\214\276\030\004"
+	.ascii	"\nv\001\"\312\273\352@0\321\272Gq\353\213\242E\007\202\232\033"
+	.ascii	"\022\025l\331ti\210\242c\224|\251\322\202\206\317-\220\201\372"
+	.ascii	"s\037\367,\307\313mzT\f\345=7S\226|(\212\262\370\271\007\324"
+	.ascii	"\237K/\006\177\232\007\n\376\334]\346]\027Q\307\303\211\260\215"
+	.ascii	"\242gP\276\240\250\234\323\252\250?\367\270\373\303\345\326\320"
+	.ascii	"!\267\032\214py\203\242(T\267\260\365\246\334\267\310\307/)%"
+	.ascii	"!\035\031\025\021\r\t\225(\006\001\375\370\364\360\354\350\344"
+	.ascii	"\020"
+	.string	"q\206U\030<\315\346\343^\230\200\231\306\226z\205\r\371\022\334\225\262<)\016M\026FzW\335\217\340\214\256`\341\"\256;\321\333\207\336\314\2456\260*,d\026Y1O\244P\270\204),\202\344\311\323\200=1e\370\361\335\235\214\013\\dA\354\205\007\261\035(\r\230\023s)\217\215\177\310<\202)G\202h\"\366\302}\226\357Y\023\263d\036\264\357\234\341\241\261\216\331s\322\200-\2713c\2420\201&bJ\216c\256\340\003c\304\323\200)1\213H\236x\225\361\220\251\211\030\331\253YD\223\346\346i\300\310\314\025gyI\204*<\230$\206\031\341\323\\*\263gd'\254\210\251\244\206\326\367\364Lm`cl&y\357\204!\315%\024E\237\236\277\302\2100\013\023@Qt\331+L\354\313\364]\266\332]0\273;l\001J\021\202\ft\f)i\013C\034\257SC\345i\016\360\253\006\233\036\345u>\235"
+	.string	"\002\372\354\036\302\2356\273\022\202\255\246\346\301\326i\262\373\300}\200\240\242(\021\251}\233\273\261\332\263\375\334\034\022H\020\374\031l\251e\234\331'\233\t\314~\0222\037\336\306\216xXRv\266r\271\233\316\343\307O\227\321_2\232\373\002\323l%\037%\301R\245[m9\bv7\340\\\017D\330o\177x\227\002\013\370^\3357c\362\346\276\021\300\375\016\347\341j\317\266<\260\370^X\301\237\357\213\221\271\351\033\353\342\300\315\341]\243\006|\257M\241\306l\017\331Cv\345\220\334\312\335\313X\363\343\333V\333\335\3612_\0359*\257\325\365\276UT\247\373:Pyq\274\356{\243\362\332x\227o\215\312K\243\3626p\270\237\201\312;\243\362NU^\003*o\001\314K"
+	.string	"\363\312\270\3347\306\307|\245\242`\274pQy[T\336\001*/T\345}\022\362:\ty\233*/\213\312\273\242\362\252`\336\024C^\024\225W\200\312{\242\362\006PyMT^"
+	.string	"*/S\345]\252\274J\2257\251\362\"U\336\243\312kTy\213*/Q\345\035\252\274B\225\267D\345-V\336\240\312\013t-\337\236\312\313Syw*\257N\345\315\251\274\304\312\213Sy\207\337\362\255\225W(\344\r2\357\031\3445\205\274\315\274\034\344=\005:mla_\242\006E\221\004&\201\356\235wP\256\367\227\371\307\374r\277\226\177\313O\367\327=Q\255\243\213\256C\033-u@\255\\\035\375\242[\006\274+sy\002t"
+	.string	"\255\243\211ik\251\003}\242\005\350.\302\t\257\260\351\023\223\243\224&\264\023\375*eto&\232\251\003\350\"\035\326pH\236\335h"
+	.ascii	"\332D\233\\^`\263M\241\326\226\034\2458\255Q\002@\037\256\214"
+	.ascii	"K_\\\215^j\246\356?(L\266\351\323\032\024E\245\304x\354(\305"
+	.ascii	"i\355\347r\n\254\302\321m\312\221\312\221J\360\347R?\357,\300"
+	.ascii	"\340\255\235a\211\353\352\031p(\022\366\323\263\242/F\312\025"
+	.ascii	" x\214\332\312\252g\264\003\177>D\255\324+zvX\364\361t\206\215"
+	.ascii	"C\251\215\372b\222Z\t\251\217:\251\315\277\344\031\362\004\026"
+	.ascii	"C\352\250%\233\300`H\370\033&\370\363\210\250\215\230\204\343"
+	.ascii	"\333\332\021\265\0132\300\2671\034=\243o\334\221%1\247\206\216"
+	.ascii	"g\250Y\354\264r\255\304\344L\r\231\334\020"
+	.string	"G\034\266\215!<\241\036*\321\305\026j\341\337\b|\244D\337\3132\250\201\272\330\247\227\344\0312\311E\202Zj\351\304H\356\002\352\020\310\376\336l\364\214\256\321O_#\355,0\331\246#l\236\236\"\342\004\nD\274\311i\345\306\2602|z\"\237\033\033#)N\003]@\177\361\334\235\307\222\254y\202\204\016z\351\221#(\331C 0\360\207\235\346\351{I\266!9pu:\247wZ\350\003\340\337\025\235\276\rKb\343tN\237\\\222gH$\374\216X\210\035\305\346\256\213\003\233\376f\323\212\242\250\214\275\021?\342\230E\201\251\251\340O\234VZ\336\t{\330O\n1\304\211\330t\201\265[\273\340Oa\267\221%\3616V@o\372e\"(\332ebF/'\215@r\240I<\342]\0326\370^\r\364\373\230 {\310\177\272\370\301\341t\353\343)\210\017\256\253,( ZYYZ<\270\260\202\364\350\361"
+	.string	"\2271\313x\003\353\007\027\227\326\226\017. !\306\2546\276\376\370\241U\345\343\203\007\227\221\352\347\203\253\t00R\0051\nQ"
+	.string	"\203 =B\256\200\030q\b1\342\330\322\342\322\312\"b\375\270\342a%\304\230U\201h\031\271\256\202"
+	.string	"\301\332 Kk\n\003#\025\327\325\005\036"
+	.ascii	"-\217\247-,!\306,(.\037\031\030\177\364\200\002b\274\312\202"
+	.ascii	"\342\261\025\004\352\251h\2656\300\332\202\342\322\322\332\202"
+	.ascii	"\"\312u\275\325V\207.\314\331\021U\027\223a\342\210rt\214\376"
+	.ascii	"\252mN\330\353j\344~`\242h\023\004n\367\363i\341\300\205\301"
+	.ascii	"1\372_\236\036\311\204\326\274v\217J\216f\351q\350\310\240}|"
+	.ascii	"Ez\310R\222\001}4HUM\243\277vi4\034\332\317\334\314+33\247\246"
+	.ascii	"\213\020J\003t\2136\200H\305\b\226\244VnU\267\350\243\311\263"
+	.ascii	"\322\242\207U=@\357 \235\234\201\352\252n/\311\266\030\240\372"
+	.ascii	"g~\372\225\231y\363Y\333\013\203t\364\324\007t{j'6D.mL0rr\032"
+	.ascii	"B\350K\314\222\242V\022\255\t\005mG\031\016U\336\364\330\335"
+	.ascii	"\2710\324\312\246\336:\256`\001\337\253\251\277\246\2072*\232"
+	.ascii	"\252s\314\271p&\231\003\223\231\032\236P1\252{\212/\272\366\227"
+	.ascii	"\212\356!a\234\3149I[;\252\226*\303\353\033S\321\313M\225kg\306"
+	.ascii	"K\210.\016\334\236\256\255\242*myD2J\211V\356\260\207\240\035"
+	.ascii	"G\222\004c\202\017\213K\301@\321%*\310\305K\240\313\002\350\263"
+	.ascii	"\251\211\027\375%\325)zJ\017E\247`5V\212\320\302q\271\f\376D"
+	.ascii	"a\352\225my\273Y\004*\352\375\211j\030\375\265&\320\213/\241"
+	.ascii	"\003\003\370\243\243]4]\252w\364\311\334jnm\006\035\375t\323"
+	.ascii	"\2405y7s(\363\302A\001\201N\250a0\005\221S\212FF$I\n\n\031\016"
+	.ascii	"a\005\304\030'\245\254\007"
+	.ascii	"\022`E=\213CT23\233ba\277\003\262\fY\260@\r\215\f!\017?O\240"
+	.ascii	"\267\216\016>z\177\264<\221"
+	.string	"\272\332pJ\241[\361\225Aw|}\372t\267\020\366\016#\023\261K\212S\322`4\340\371~\222\330\314\260\351\272X\330W>\361\021\233t\263\361\267\024\343z\177\272@\\\357QP\240\357\32378\334\261T|\300\322;\3673\032\n\330\017\311\244\313\256\262f\304\255\224F\231\351\252\223\233Pf\241\277\367\024\037\233RC\364=\343\3456\336Jc\213\005\237\224\223\301\317\240E\345q\313,b61\215\027\375\032\333J\317\276\303 \232\013\263\346V\017\245s\205l\002F\265\321i\212\t\204N;0\034C'\337R\023\202\205E*\006\264\252\037s\303z5\340\253{\351\252$\005;\235\257\212\2562\373?\214\365\337K\346\210\303A\365\225\0263o$M>\257SM1\2315\305T|\033\255\212\223e\263\263\303\251\267\206\265\261\325:EB\b\2705Py\302j.b\337k8\013\264f\245\356QE\013\261)\321q\322\310"
+	.ascii	"e\343(\024\345\351\214\026\246\030\221:\263\024Y\215=\370\354"
+	.ascii	"\250\271\347\036\001\240\245\335\363X\354\276sy\333\3437\330"
+	.ascii	"B\377\320}A\325L\353[\200~\214(G\373\332\027\267_\347\353\376"
+	.ascii	"\233\004\277gj\364:\273\001x\366{\034:g[\353i\001\254\351B\250"
+	.ascii	"*W\b\354\366\3732\302i\244\343\n\220\034\334\240}\002\na\350"
+	.ascii	"t\006\307z\270B$\233\033IL\370K\200\002\266DB\006\030B\025g3"
+	.ascii	"\245\334\224{]\213\004\355\351 \032\3072\\\031\267^\177Kg\333"
+	.ascii	"\3439\317\341\300\215\322W\302\234j\351\020t\307\354\007a\021"
+	.ascii	"\024G6\320\302\274\224\260\3171\301\365u\031\231\031(0\013\362"
+	.ascii	"\2149\366F\343\206R\254&\350\353e\303\335\263\342\025\331E\344"
+	.ascii	"\344:\200\311j\263f$e\304S Vc\233\342E\001\351eoB\242\2268i\214"
+	.ascii	"9\335W\314\230\207\b\006\334\373\363\205i\354C\\\275\311\234"
+	.ascii	"\\F\377U@\341J\342=5&\026WP9\324\271?\005x\257\3244(\324\346"
+	.ascii	"\307H\231\313\325\244]\374a\230*I\323\203\2342b\346#\254\342"
+	.ascii	"V<\202\201\335C\352\342;\202\370\007\225\003C\370\323\302\016"
+	.ascii	"\237\274>\353-\n?e\312\317\274\t\272?"
+	.text
+	.section	.gnu.lto_convertExternalToMotor.150.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375`\037"
+	.string	"\315\007"
+	.string	"\342O870\217\222\016$\\6Jz\270\240\312\026:V:\324\242\214>3)S\313w\003\375u\373\375\265\003\317\177\266>\240\315 PZ,\301\326\2553\221\310\303\335\243\326\b\221)ZE\310\343\020\362\2146\255d\322\004\376t6\315\004\022\305R\004\004(\364\020G \217(~6\212\3301\2304\241m\261D\"mq\363\337e\261\204\255!\007\005S\027>\330\213\027\324\233\371\356\364 \307\027\313\314\034\266\036\276_\273\266\230\004\313*\203U\227K\346jF&[\262\025\220\237\373\315\377\336\267\244&\\;\213\263\314\215\227Jf\247pB@\263\201\367\337\221\222p\377\302:\017\327AH\n\006JLfFN\0134\315\260\022h\232\301\216r}\334\355I\033R\0370*\326\251\017\200!3\177*\226F\207\375\021\376\205_$\007"
+	.ascii	";\213\001\013\201\3355\205\003\023\004\234xR\255\230\204I\006"
+	.text
+	.section	.gnu.lto_convertMotorToExternal.151.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375`s"
+	.string	"\355\t"
+	.string	"f\223F:0\217\323\0013\244\363\351\306\230cZX\303\214\247\235\\`H\233\007\205a\357\333\336\31466V\017a\252\330A\264_\016\b\314\250y0\020:\207\007m|\244*\324s\311\337;\2454"
+	.string	"3"
+	.string	"6"
+	.string	"'1\231\354h\234\312\216\213\246:\231\355\236]\301\017\270o\364\006\334\267\372q\362\224\364\017\273\004*\304\305d\225\247"
+	.string	"\020\273kj\2628\356z\333\013\266#\354;2\333\262\245\264\376\372m\223\0173\307\177\221_s\2773W\214l\367l\370\346\207\r\245\366Knb\372\351\230\003vWb(\273\353`\206\3157\005\215m\177$\262SE\371\265\326\303\250fN\264f\216\322j\2230\270\233\257\t)\026\020\232,\243\226\366Y\322\352a_\263\265\303\376\353\374i\245\3766\022Ym\260\336R\331]\325\002\037\t\364>\2407\022\277\261\364\r|$\320\373\210\341\030\212\004\f\362\210_)$\352\306\n\212\0208\321\215B\236\250\003\211\027\235\007\301\241\305'vc\030\212\035\347\334\333\265\022\244^NZ\f"
+	.ascii	"2\003\3020jB\330\256\211K\013\230\244\0059Y\330\240P\315\247"
+	.ascii	"\316A\273FJ\212\351\232d"
+	.text
+	.section	.gnu.lto_writeMotors.part.0.191.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375`\246\001\025\020"
+	.string	"6 lE\360\260(\035\372v\301|\335b\372\277G\344\032\333\340z\205/r\321\227\214p\310\315\356\241\213\322Z\271\223-Z\177>\360\305=sS\262F\213\310&\262Q\272\322<u\b\342r\206\266\357\352\353Z\023\262\367\2262\245V"
+	.string	"U"
+	.string	"X"
+	.string	"\367[#\233\303y\274\b\333#\225Iv\214\273X\363\261X\212\211\031s\316\356q9\230;t\335\253\244G\270*I\376[\347H}\245GM}\030\016\341\206Z\351"
+	.ascii	"\340;\301\016m&;\354\252\362\231t;>\\\270~\\n\013\346\234\346"
+	.ascii	"2\334\333m\203l#\260u\003\237\356\312+\337a\321f\336\026{\325"
+	.ascii	"\333\252%TG\270\352U\265\376u\337c\200\002\2329Wj5&K\224y\370"
+	.ascii	"\353\267\357\277>\302\207\231\00332\310\3115?\325[>\214O\342"
+	.ascii	".\322KX\206+\251\270\024\261\026\2639g\310\243\017p\217 \027"
+	.ascii	" \037\341?\344c7\256\342+>\376\213I<O>\306-\360B\003\234s\316"
+	.ascii	"\335\225\355\004\377\302=\b\0337\0256\240h\315\035\252\006\205"
+	.ascii	"\364)\263\240\266\344\357\2565%\3036\205\243p\214\233sv\374\023"
+	.ascii	"\217\221\340\277<\272\344D\237z\364O\344\243\356a70s\023Bf\322"
+	.ascii	"\232\367\0333\203\n\336\355\021\021}&x\240\316\304\001\211\367"
+	.ascii	"\240A\007\301\033\001u\036QI'B\300\241\b\037Qg\022\n\211:\216"
+	.ascii	"m\375\266p526\246E\211\273\362a\347\200A\303\305\312\335\002"
+	.ascii	"\350\266\366\210\247\365[\250aas\332\222\367\035\026m\006w\345"
+	.ascii	"\350\"C\316qQ\270_\025\271_\0064'\2459\256\334\247\004! P\202"
+	.ascii	"QL\317\001\r\311p\200\211`\230\2252\213R\250\311\235\005F\213"
+	.ascii	")\223\245\267'\243\211\255\260x\340>\016Nh\326\nXa1\261obM\261"
+	.ascii	"`\371\322\001\360`YF6\224-oe!\264f\356\302\022&Wr9\271\272\367"
+	.ascii	"Z\205\007"
+	.text
+	.section	.gnu.lto_.symbol_nodes.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375`s\006M\032"
+	.string	"\366\251\231CP^N:\313@\275\f5\373\277|fQ\016\260\003\006\201\216\003"
+	.string	"<\f\250\347+\274\266t\367/i\263H\334N\017z\266\323\316\201\031\230\021\362\360\304\371\362m\003\260\201\215\270\301\233:\025\272\267v\334D\246\202"
+	.string	"\210"
+	.string	"\206"
+	.ascii	"\357\273\320\314L-\\\357Vh^\252\024\232\325tB\2633U\231\314\265"
+	.ascii	"mP0\252\271K*\201\313\"\260\331\375\022\002\223=\340!\016\030"
+	.ascii	"I\003\256\302\340{\240X\310}z\336\375\322\351{\367\313\005\347"
+	.ascii	"CR\300O\036\210\266bij>K\217G\223\340~\327\252\b\236\346~i\274"
+	.ascii	"\230k\177^U\246\377\335\377B\225\311T\2638\321\351\272\262\324"
+	.ascii	"\334\2252\341\264\374\375\223)\343 UU\325b\037\232\376\037^\005"
+	.ascii	"\027\304\3619X\207s\36577\216\307\306\345\324x \215\273\261\372"
+	.ascii	"\232\252\267"
+	.string	"\231q6\311f#2\232\321R*\226\202\344(7\006\267\301h.\222\376G\232b(/\370y\245\232\211\270h\036K[4\213\245\202sx\374X4\207\245+\232\301R\025\315_)\256\007\305\243\367D\263Wj\342jJ\034\360\222hn\246#\232\327T\304\003\2058 \020\377\363\341\203\327\252\036\316\247\303\373p\270\237\273\341f\256\006N\222\241\231+\375\022CBO\350\320\016\345X\300_\336\226G\207V\b\310Mr\300\274\374nh\223^\307\226\254\331\312X3\233Xs\023g\263\223\260f&`\315j_\315K\274\232\225t5Si6\257\255\315G\270\232\247\260\252\252?\201@\314lN\343\345Y\205\352\217\t\3622\367\237RN!\225TZ@>\367\343t>n\327\343w\367\337\312RjU%\251\262\244\222X\305\363\332\334:\036\217\347\331q;:~'\307\343(_G\353t\262\002\367{\262Wq\303\243\265z\362"
+	.string	"'4-)\307\005\324\236u\267;Z"
+	.ascii	"+\017\205\031\344\362\276\243\035\306q\361\013 '\037-\327\035"
+	.ascii	"\255\001\343\321\026\255|\264\006\307\366\250\361uonm\217\032"
+	.ascii	"\215\226\327=&\213\344c\262\374\324#Z\262\314$\026m\322\363\212"
+	.ascii	"\266(\216\225\354\320\023\252d\243\214\016\330$\016R\241FV\030"
+	.ascii	"\307GgonD\"+\\\363\210,\222-\230h\323\354g\210V(w<\242\r\360"
+	.ascii	"\344\033H\267\347vC+\004\030~\250A\fb\222jd\244 \005)\027\003"
+	.ascii	"\320\002\241!\3426\021\240\030T\215L \"\241\f1\351\356\354\b"
+	.ascii	"q4\326\301\fL\267{\244\335\341\305\343O`\263\205\007_\367\342"
+	.ascii	"\260\362 \021\307g\002R\301*\344\255[\251<S\247\352\004Vo\257"
+	.ascii	"y!h\263\370R\312d2\0229\211D\"\0310aX\346!\221\f >n\343\217\265"
+	.ascii	"(5~\224\246\357dm\022\207\345#\371H\360\025\003\312_\035\267"
+	.ascii	"\263\271\231\341\267U\321\001\n\210\357\004\263\204\241\273\004"
+	.ascii	"\035\324\303\262\261\271G\023k=\3361\350\233\t\025l\217Y\006"
+	.ascii	"\361\005\373\207D\364\325\034\216\252\263thn\206[\n*\371\323"
+	.ascii	"\300\245\024j\373;4\324b\266r\3751\035\320\207bI:\341>\004r\f"
+	.ascii	"9\261+\201Z\224AD\244\"\324\236\317\f\234?"
+	.text
+	.section	.gnu.lto_.refs.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375`\367\001\315\017"
+	.string	"\306,v< \215(\255\001"
+	.string	"\f\204\304\f\362\333\267\311\035\265"
+	.string	"\006"
+	.string	"\006"
+	.string	"\006"
+	.string	"\006"
+	.string	"\006"
+	.string	"\206\211\006\200\351YC(p\221\323@_\321i\024\372\355\037\334G\221\222\362\r\355Y\377CF\273e\n_"
+	.string	"j"
+	.string	"h"
+	.string	"\255\320\025P\f\254\345s\0230@{\237\027\367\256\236[a\316\242\265\256\017\263\242]\341z\n\346F\321|\222]\242\271@vHg\224\265Gf\r\354\f\316\241\315\030\024w4k2[\256+\314\235\270|\226"
+	.string	"\262\037\353v\2521\353n\252)\254{Uc\254{\251\266L\334\252\362D\273\273n%\002\022Z\2246Bk\320\030\264\005MAK\320\0204T\347\310\345\2464\203T\027U}\252nG\265\251\272\034\325\245k\3215Fu=\250-\256\233]\267\203\232\342\272\231\353\353\364U\335\313\351]\347\341\211\351\270\225\351\006\264'\3408\256i\343\226Jw\004\032\244q/6{2n\005\350\214t1\320\234\321\245\b\255\021\335+4Fs\001'\033\233`\267$sIH\217d75Z\244s\t\224\016\301.H\346~\210Fe\367\224\261I\344\001\033s`\227$rE\231\033\"\r\312.\306\350\213\316\255(\235enG4\226]N\306\027\350\313fKj"
+	.string	"\"\327\332\\\2614\020\362\256\005\b\334v\271\247\t\322.\250\037m\206\026C{\241\265\320VH\241\235\320\246\264\001{hA\264J\203P\331vh\241\366\240rC;5\007m\022#D|\036\342\003\306y\206\317=\341\372\304\232\304:e\375Q2\212d\217\2165L&\225<\"\371c\262\247d\013\2223\323\230\312\226\211[;\362\231\003\347\326\220y\206\354\030\260\233\002\366\224\354\2260:J\346\216 \272\201\306\f\260\213`\363\201\324\001\n"
+	.ascii	"|\b\321\212\"G`\026Y\210\331\272\364\016\035\336\232\025y\242"
+	.ascii	"<c\3710\221I`\320"
+	.text
+	.section	.gnu.lto_.decls.47567f68ab1f58c,"e",@progbits
+	.string	"(\265/\375`\363Q\005\\\001JM\246\177U LQ9\351\016\212\243H\2155\364\227\306\026\234\247\234P\t\356\351\211'\360\307*\223\321\316\f\2470,\364\306\013\327\256I\376\315L\255*\253\335\252@\356\267Z\344fW\365\025\203ck}\375\354D\255\245\360\276-G\243\241u\231PLq(\206\344\023\262\267\334)\276\006\352\007A\b\247[\372\263,\3759$\375\231\225\376\254J\177&\323\020\360\322\343\272\364lm\322\3430\351qY\372;{\204\036\267\220\036c\245\277z\351/]\372\233&\375}K\377\366*b\227\\R\364\270\032H\007i\"\326\276\220S\205\247qw\265\020\313\334\320C\362\220\255\363\212\272j\374\273%%A\316v\003j\367\366\354\006\264\271\354\021J"
+	.string	"k\204\366\217\2447\227\320\225\024,Y\032\027\371\330"
+	.ascii	"\245\355\007\221\306\177\367\330\342\300-\t\221\255\277\265\232"
+	.ascii	"\307\327\3204ZZ\2104\356l\217\320\013vd\205\201\333b\353\316"
+	.ascii	"\372;FO\265\216\346\322\340#\247J\032\266\306XH\367m\016\363"
+	.ascii	"N\343\337ez\021UV`9\347\377m\243\257\372F\347\260\314\306\321"
+	.ascii	"5n\311\332\352x\231\263\026\273\244\221\325T\312\257\tI\021\345"
+	.ascii	"\031QZ`b-\303.\033G\317\370\232\220\3242#A\345vd\017H\036<xh"
+	.ascii	"2Zeh\370\340_\261\324f{\204\376~\245\277D\322_ \351/\217\024"
+	.ascii	"[#\364q\366\bM\263=Bm\266F\350\3370\372\205\020<\253\037\215"
+	.ascii	"\377\267TGYf\277h(\273\314y\231s\376\210l\365\320\256(X\312\273"
+	.ascii	"~\321I\373&\224\\f\253\236\256/,\345]\316K$\017\036z\250\260"
+	.ascii	"qb\004\305\277U\351oT\372\236K\177\273\247\327C\305K\327Yc\253"
+	.ascii	"\3276\317\346\271\325\263x\367`\304\201\244\254\036\316\031\312"
+	.ascii	"Z\f\204\254\305\340|K\002u\005\305\3576\351o\361 \005\275\311"
+	.ascii	"#S\346\216\005CK\254*!\215\177{g\007g9b\366\032\327\t*3\323\262"
+	.ascii	"\322\370\r\227Z:\273f\335\334%[\004\256"
+	.string	"\2145s\316\027\361[\262\2643-\177\322\026\262\345\025\213&\004E\224\245\242\262\200\315\331:\333\264t\354\034kg\231\226\316\276\271\205c\343X\371-\031\235\315r\005\255i\311\350\254\034\373f\343\262\362\225K\303RF\311y\351\301\303\371enG\227\020~\207\245vi\217P$k\204\276\273\3226H\026M\024\025\254\306o\033\351\355\322\013\225\261?\t\215\035c\317\b%\211\262\024\226*`9\347\333/`\354\233P\222(G\245\231\002f%L\017s\210\024\021\177\322-\032+\306\242\335%[\032\003K\224f\316\313\244\337\203\021\026\215m\263ow\t\226\243\344\270\204\210\242\263\306\343.\347\345\177\273\306\312Y6V\215Mc_\260L\213\306\302\335\252Y-\357e\316R9g\017H\330m\354\216\f!l\317\330\270\025\262\2064K\212\006Vc3\030\213\314\020%\215o\311\244\226L\322m\031#T\231\265\314g9\347!"
+	.string	"lykk\334c\215\320[/\351-\226\3646Jz[$\275\315\221\"\331#\364\026Fj\271X7\313\264\300v\271\007#~\223V\262X\316\313\241\240<R\362\3405>\t\322[\013P\273g-@OL;\330#\364K\251\2205B?\201\364M{\204\276\204\364\bH\255\231\305b\231\032\330\263\3332k\345'\3242/s^\016\365\021=\264+\215\337Az\353\302\215\320\344\021\017Jo5@\357\336\236\325"
+	.string	"}\247D\366\bmk\204^`\217P\"k\204v`\217\320\337V\371-\025+\246\301\235\242\301\225\317r^\026\245Rnib\215\277\264Ghj\215P\022w\001/8\240 B\213\377JE\375\327\300\177\024~v.\240\265\316\021\177_\360[\016\027\352&=\300h\345\330\271\213B\362o\237Q\247W\351\032\376\233=\320\345#\376\023\203\277\017`3 \331\0252\370\233\203\233t\017pA,=\203\274\033\002\017\330\017\334\203\037\227\370;I\304\210\013b\311"
+	.ascii	"\007p\262n\354\233\273\332\346\273\264\311\340y\347\340?\203"
+	.ascii	"\376k\302o\353 \377\266:^EK\235\276\377\226\360[: \370\233\001"
+	.ascii	"\267\351\357\017H\377Q8\320\177\236\025X\016\034D\270\321\217"
+	.ascii	"K\360wz\225Hx\336\323\037;e{\016\031\270\212\027\375X\257\013"
+	.ascii	"\320\037|\266\210\310\262\255\271F\026\267\370\367\221\007\220"
+	.ascii	"\266\356],1\003\347p\231\376\316\007\361c9\233\301\"\331{5p\207"
+	.ascii	"\377\005\261\364\267\320\177\025y\337\360c#{f\311\324\354\332"
+	.ascii	"\177~\f\367wz\225\352\336\363\343-\326\351\267Jv\205\337\352"
+	.ascii	"\335\025\266\205E~\356sN\327*,\013\274\253\376\367\203\337\222"
+	.ascii	" |\006\377\363N\200\037\003\371\373\0017\370[b\237\340\373\361"
+	.ascii	"\216\243\200g\264y\027\374\342o\026\227\205\277\275\276\244X"
+	.ascii	"a^\340]\341\357\264\373\273\035\370\273\255\314o\315\3746\356"
+	.ascii	"o\247\313\201\377\026\374x\356\357\"E\376\2562\202\277\225\374"
+	.ascii	"\350\372\273\210\216\033V\177\233\3150\"y\374\375\344\305\337"
+	.ascii	"E\222\177+\371\375]d\002\177\007y\300\337E~[\364[\242\337b\370"
+	.ascii	"m\206\243\377I\201\233\376\026\351A?\032\364_\316\377\272\377"
+	.ascii	"t"
+	.string	"\377\347\376\277 \367\237\316\3776\377\347\374?\273\035\241\037\007\251\270\035\274\273\001\f~{\177\333\377\265\340\370G\027\360\337\377\367\376\267\377\336\373[\357\277\366\277\347\337E\032\370\333\315\337y\177\343\311\300\377\241\037E\361_\f\374W\002\377=\341\277\020\370\257\003\376K\302\177I\374\227\001\377E\300\177\017\360\337\021\377M\372o\210\377n\360_\017\377\355\360\337\f\376\013\200\377b\370/\321\177\323\377\242\177\273\375\335\366\367\332\337[\376N\373\033\355o\346\337X\376\266\362\367\362\357\261\277\245\374\r\345\357\257\277\215\374\355\365w\327\337>\376\326\372\033\353o\034\177\333\370[\3717\215\277e\374\r\343o\251\277\241\376\026\341\357\3747\t\376n\3617\362o\020\374m\374\273\3707\323\337+\376f\341\357\025\376\356\300\337\033\370;\003\177_\340\357\n\374\255\342\357\024\376N\3617\n\177\237\360\367\003\376.\341o\022\376n\300\337\t\370\373"
+	.string	"\177\217\370[\304\337I\177\207\370\233\203\277?\374m\200\2775\370;\203\277\013\360\367"
+	.ascii	"\376\306\340o\r\177\037\375m\364w\321\337C\177\373\376F\377\347"
+	.ascii	"\375v\202\337\262\375V\355\267z\277\305\373m\005\277\325\360"
+	.ascii	"\333;\277\275\373_\347\267u~K\347\267u\277%\341\377\331\377."
+	.ascii	"\377Q\370\257\342\267\005\370m\363\267s\277}\363[6\277]\363["
+	.ascii	"5\277M\363[.\277m\373\355\332o]\374\366\351\267L\277\375\300"
+	.ascii	"o\227~\253\301o-\370-\207\337\"\375G\361\333\363\177\236\377"
+	.ascii	"w\376\337\375\267\363_\354\277\325\177\270\377\033\354\355\355"
+	.ascii	"\355\375@\313\177\310\304\017\202\231\315;\274<\271+\215O\224"
+	.ascii	"#\375\361\327-\023\177\335<6\251\2649gIc\244\231s\326\007_\222"
+	.ascii	"'T{\215O\364\"\375q\022\313\304I\272\b\t/\256l\343\002&\315\254"
+	.ascii	"\017@I\030z<\032\177(\317\221#_;\221_\224! \354j\bN\372\343\026"
+	.ascii	",\023\267\3605\022g\371\005\023\275Q6dv\003o\256\361\207\310"
+	.ascii	"\244\377\rs\303\330\267\016z\262D\275if\345\362\303\177\341."
+	.ascii	"\\o\221\360\"\312\271K\016XVf}8\325(\301\3521\3042\361\220\336"
+	.ascii	"\"\341\265\314I\016U\350\202\240\322\252\264\032\177H\255\253"
+	.ascii	"\313\276\341"
+	.string	"\244\225l\345\023#\fO\354.g0\037n\016\266\262\263\306\037\n\262c\007\006r\242\234sT\316>z\240?0\217c \307\\Ar\256\226\304i|\354\003\377\370}g\235\333\027.\215?\304#\305[\270\307\177\237\217)E\214[\343\367P\016\rT\\\371\242\325\330\347\003\206\207DIc\254\325p\376\3730\232\263\346\225\306\267\373\332\177\237u\242&%K\343\017I\351\320\321Y'\210r\356\322\003\303\223\3768\207e\342\034\235\205A\031\201.<\315\254T~\270P\234\0337\350.\364%\375\361\025\023_\335;$\2622Tr"
+	.string	"s\311\254\017\026I\230\252\252\306\0272K\177<\203\211g`+\244\234\244S"
+	.ascii	"\331\231\271\346]V\346\017\230\006\256\262L$\\\003MT\215\255"
+	.ascii	"\306\027\252\222\226 [$\364{\026\t\275\320\220\251)Les\3169+"
+	.ascii	"'\351F\270\001Qv\370owLu\242i\242$K\343\013\335H\177\367p>N>"
+	.ascii	"\211a\2449\347\3442[!\205\225\3155\357rVV\2073\007T\217\263\306"
+	.ascii	"0~\017F\\\016P\316b9g\016>I\230V_\215o\207\245\376\373n\f9WR"
+	.ascii	"\032\377X\nG\331Q2\207U'\017}=\341\352\201\241\354\233 ,'kj\032"
+	.ascii	"?\bM\372\337\276\1774C)s\3166\316eVF\001\241\277\275=\255\355"
+	.ascii	"\360\007\331k\005\360\037\347\234\200\r,s\024\031!9gK'e\262\006"
+	.ascii	"\305\343\202|\306\345,\025$I\"\310\225T\020\035SfA\256\212\246"
+	.ascii	"\314\202\344\244\224\222d\2212\007IN\231\345\\$%\2254\301u5e"
+	.ascii	"\006\225\213\246\314\362U~\201\346\312\346e\220d\226\342\312"
+	.ascii	"EY*Ce"
+	.string	"3\256\253\013\246\244\202\\M\231A]\025M\231\005\271\312fA2Q\226\202RRIeeQ6\013B\227\315\270\256\210\246\314\270\256\246\314\202P\261TTr\232\334\030#\244\310\227m\233\222\3125\252\266\240\224DqSK\256\314&g{\006#+s\\\316\002\310y\213K\311\006J\207e\213\212\253\021\245\005\212kCUT\027W\226\212K\332\0347\325\204+\347&QK\271*\347\234?H.\343r\0136.)d+\323\200\2213\005y\231sU\316I\233\343r\316\311\234s\217rk\231\263\026\321\024XUU\316YHUy+\331\006#\347>s\303v5e\326\305\225\324\346\202\031X\216\261L\332)\032\\\031,\263\t\242L\315\222e\231F\316\331\316I\301\256n\3245\276z\247\0354mO\032?hIz\361\220|\352|\321\362\325\370A@\322\245X\316K!\364\t\222\030m\367\016\351\007N\215\020#7\352"
+	.string	"Aa\251\235i\374 \031\351\245#\034\302\354\322\370A\311\364\326\r5\261\022\022\246\361\201\354\226?l>\320p4\347z\306\252vL\305\371\235\373\257\234\246\372Zs\231\241\363q\327\030\310\032\241\266,\3517\316e\363\002#\017\316\0334\306\01733n~\337|\255\271r\326Be\247\207\247\361\005\222\364\353F\001G\204Li\323:\262OM\034\0341\270\264-}\306\242\276\340\326p\271G\330\024I\243\346\2469\335\240A\221s\337~\323\374\327\313\375r_"
+	.ascii	"\002j\273\002\247l,\207\204z\325\231\212j|\2408\351\377k"
+	.string	"\346\306\3353\226y\321\\1H\313\234\265\204IBs\301\030i^4\027\356\226\261qY\313lC\250\353\210\007!.9hi\3222d.\227<utXK\264\211W\235\233e\3361]\343\377\3552#\365\2156-\310i|\2405\351\201\314\244\007\352\222\036(-\255 \333#\364\202Y#\364vI\372}\003\232\303\306LJc\n\256\033\016\273\344\t\235\034\227\313mk\222f\367d\331\303\305\255Y\325\370\277lw\315\003.0\341\321xiDH\024[\343\367\223\033F\300p\264pkX)\271\311\013\003\315\n\325\030Xk\335+$za\240\\,\367\354\216\335&W\354R\271a\327\311\235r\323n\225kv\263\\&W\312u\341.\271Z\356\223\213v\227W\355n\271V.\331-\273Wn\024\313\274\314k\344\367\310E\362E#\nX?\371\033\257\363\3044or\212,\253\3072\207\027\230\016\037b6\216\200a\375"
+	.string	"\303\353<`\2321\316\032/\253Am\271\311\373\"\313M\316\230\322d^\036\267\205\273\004{@\024\217\346e\336$\027\354\226)S\265(8e\022&Ri`x\275we\355&ePi\255\313\274U]_\315\234\2277y\2317JK\223i\356\312\021\005\340\373\365cF\213\\\215\306\007\212\222^%\277PXd\326\032\037\250\205\024\307\331#\364Z\254\021z\240\255\364\277=~[\370\357\216\253u\275V\350\2569Qm\215\213\370\246\264q\223\322\370@9\322\217\360!W\343\n\271Dn\227e\336!\227\353\027\210\375r\033\304\n\354\016\271?\302\332\310\356\220<x\360\251\031r\246.\305\377\301\223\3369\351\177\350\322\377\314\245w+\351\267\307\217\024\216,J\032\373\336\244\266i\217P"
+	.ascii	"X#\364?q\351\177\334\322\377\230\245\377\tK\377\363#\375O\214"
+	.ascii	"\364>x\351}\340\244\367\001\223\336\207\231\236\215=B\357\003"
+	.ascii	"%\275\017\221\364>6\322\373\356\244\367\241I\357\333\222\336"
+	.ascii	"7%\275\217Hz\037\216\364\276\027\351S:\351S\271\264\003k\204"
+	.ascii	">\315\222>%K\2372I\237\372H\237\312H\277\304c\351\332\253F\030"
+	.ascii	"\345\035\273\237\021(R\215/\242\256\312\26296W\247\3554\235\276"
+	.ascii	"\263\314\266\3539gm\327t\026M\bj\231\225\007\210\333\233\022"
+	.ascii	"%\347%\352\002]\033-\037\374\2361\351{\266\244\357\251\222\276"
+	.ascii	"\207I\372\236\037r\342\240SO\254r\343\216\323\311 \264\313\227"
+	.ascii	"\333\030\2347>;r\274\330\302\374Z\273\301V\270\312\300r\316D"
+	.ascii	"@n\350l9k\374\236\035\351\337m\200\260\260\260\222\215o\305\234"
+	.ascii	"\274\240\001\226\363R\256\311\372\312-S\246\314+x\315\374\223"
+	.ascii	"\316\344\356\306\362\300D(\331\321nm\246\311t[\217\351\027\272"
+	.ascii	"L\177\351\267>\323l\032M\2575\227\216\3530-\246\273t\232^\323"
+	.ascii	"`\032\256\3254[{\261\314\226k-\357-\255v\334O\240\314hZ\262&"
+	.ascii	"U\315\345\224\2511#>\232\375\005\226\325l\255#=Z+I\032-&\177"
+	.ascii	"\222\013w\300\304\362\200}\371-\031\225=\2606\303\202\307\222"
+	.ascii	"\205Y\201\265\\g\351\264\273\004\363\305\350\222\323\264dKj\214"
+	.ascii	"\370-Y\025\033\247\007\326Z-\244\371\301&\205\252\331Z-\327H"
+	.ascii	"x4\305\376$4\2719\260\226\353(I\272\017\332\270\360h\335\345"
+	.ascii	"\274\364\340\001\177A\322\344\354\003\334q\366\b\335\300\032"
+	.ascii	"\241G\361\244\235\366\326\303d\257F]\343\243t\322\243h\322\243"
+	.ascii	"n\351\317\354\021z\364,=\032%=\030{\204\366\262\313,\263C[\271"
+	.ascii	"Oj\231\315r^\016\371\324\314\351q\326\370\350Wz\333\001\035\332"
+	.ascii	"\333\333\333\263\035\320\243C\322\243U\351O8\351\003I\254\270"
+	.ascii	"\334\215\321Qa\322\370\034\264\226\313Si\211\226Qkz\200\245/"
+	.ascii	"\326\350@k|\016QT\250\240cL\036V\\r\334\300ZC\253X&:f\355`\210"
+	.ascii	"\2555F\305z\307\222\252i'E\312\b\267\2612\rWc\255\315\005(P\320"
+	.ascii	"/$\256\233\206\214\025\227\036\031ioV\032\277\2020&LP'H\\w\215"
+	.ascii	"\334\0240Q\202\314\330X\273B\233\034u\022d\207%n\354\312\177"
+	.ascii	"\037Z\306*\017O\343W@#,,\0017\240t\211\222s"
+	.ascii	"V\007!\346\233-%\215O\001\252\004U\202~Y+\331\312&a\362d\311"
+	.ascii	"]\316Y\035|\276,\225U\032\243_\2760&]4\032\237\202(\351\217\""
+	.ascii	"A\221\364\225\016o]K\312\024%\211\203\322\370\024\304H\177\324"
+	.ascii	"\bj\304\352\341\3442[e \003Bv\227\304\246\234j\374\rs\322\037"
+	.ascii	"\365B\275\356\035\234$\312RQa\202\330\320x\222\006\r\327Q\"\\"
+	.ascii	"(\fT\271BN\313\273k\376\2541\233x\215Q!\350\220\256 @\266\340"
+	.ascii	"8\332\003\305\201\372\350\262\245\362\347\253\r\005\243\306M"
+	.ascii	"\324r\331\005\307\210\226\306\250\026\272\345s\243!\267\325\370"
+	.ascii	"(\017/4I\2344ntG\217\230R\n\255\361\321\254\2537\306\215\252"
+	.ascii	"\361Q\035\377}%x\003DJc\024+\205\261aL\003\237\033+q\2164\376"
+	.ascii	"\321\034G\261N\270\025h\360\310\232k|~I:\232\243\277\316\340"
+	.ascii	"\340\032\177C\220\364Gm\2406\254\035\fE\224s\327\026T,\013\216"
+	.ascii	"<\215\277\341\n\225qT\211\312\370\352\020\006$\bn\316\032\034"
+	.ascii	"\215\321\032\250\025Z\205\322@g \345\245?:\205Nu\026\206*\312"
+	.ascii	"\031*\017\363`\362\305\326\370Hg\336~\2529\327\234l,\363|Ca$"
+	.ascii	"Ee($\033PI\n1\2411\266\2431\372\242g\306\216\264\263\306G\352"
+	.ascii	"\222\336\212\2659\337\260i\3029\335\210\231\231;\351l\234\027"
+	.ascii	"\211'c\264\346\234x6.\213(K\251\301i\212\355"
+	.string	"\235qN7B\311\242\234\205\224\001C\223\250\024\032\205\3463\017\ne\231\347\336Y\367s\315\311F\352\334;\345X4\033\347EB\214L\363G\215\335W\234\020n\3638\034\242\246N\214\271\021q\342\235tN<?[\230t\215\335\235y\247\236e\236xGZf\017\0366\004\341\265\271\033C\361\177\3429\357\260\311\340\021\243\361yg\315\340f\bi|\244\256\364?\353X\346i'\306\022=%\215O\273\307\241J\312\230\361\267\034mT\3104>\022Wz$\255\364HUg3M\323\354Q\246\361\221b\244G\212J\257!Oz\ru\322k\240K\377\363\315\351\306L\f\2352n\336\344\310\320\210j|\rq\322^\332#\264\2035BO4\347\013g\232\33774\205\215HZ\343kH\223\376\224\373\357C\301\210\231\264\306\330\376\r=\343~\236\371}\r\367\005V\325\370\032\342\322\237eN3\277O\210\215\022\264\262\306\327"
+	.ascii	"&\375I&m\217\316\216\306\347\230\024\206\206,\032\370\364P\373"
+	.ascii	"\301\303\313\3171\377\371\345\3268\341B\260\247g\247\361\031"
+	.ascii	"\346\024\363\023\356\004s\302}\300\2253\324\t7\224\2273\324\220"
+	.ascii	"\265\030X\213\001\236\322\365\225\005\305\327\200%\r\262F\350"
+	.ascii	"\225\223\364\323K\031/M\262\306\327p\304\315M\n\230\206\255\266"
+	.ascii	"\266\026\252\300\224kk\347\327\211eN\332\033\032\362\226-'\224"
+	.ascii	"\023\313\234\344@\333\\3\212]Z\332\351\225\247\r\032Z\0311L\346"
+	.ascii	"\211%\r,\315\3544;\261\234X\346d\213\344\\3\212\b\352\210|5\376"
+	.ascii	"\004dV\254\234P\340&h\262\\\236^'\2269\211\001 s\315(H\250P9"
+	.ascii	"\307:,\363\r\233\243m\256\031%+q|\270m'\033\214\027]N\261\237"
+	.ascii	"UZ\207\324\324\324]\343\244\244\237b\226\f\257\354K\343O\260"
+	.ascii	"%E\312\220<\023\\\205Y\346\031vB)R\343\266\375\214\214\261\342"
+	.ascii	"\344\347\223\377\\r2i\035W\334\330v4>\233$\375t\302\346\252-"
+	.ascii	"G\343\323\032\241h\2345B?\001\025\222\023\311\3715\345\266\001"
+	.ascii	"\221\2759\231K\362SI\353H\233x\3164\033{\220\3643\t\032\245\013"
+	.ascii	"\220;\215\177\204g\304H\325Qs\210e\236CN\257\023D9\0171\002v"
+	.ascii	"\261\f)\342\004\357$\322#$\314\032\265\3068\315\311e\231'\327"
+	.ascii	"\331uc\003\2672\034\037n\233\03060\230\234A\376\233<\201\264"
+	.ascii	"\216,\266\2602\215\357\221\227s\353\334:}h\241f\256.\214:oS\316"
+	.ascii	"\036?}X4\26788f\310\262\262N-;h\230\260\255\016Oy\302\350v\374"
+	.ascii	"\324Z\373\t\023f-\t\032\031\223,\"^XXbz\230\3305Y\372\300\201"
+	.ascii	"\343\316a\237T\206\022c\3139\353\003zf\b\0363\215\177\204#\375"
+	.ascii	"O\033\226y\332\270s$\316\270\362U\bdWdw)\2309?\324\032\377H\306"
+	.ascii	"Y\343\254q*\353\240R~\202\324-O+\313<\225'\025.K\035\215og\317"
+	.ascii	"\256:p\326\032\377(\231\376'\215[\346I\343\276!q\306\005\025"
+	.ascii	"\026\202\223\374#\207jM\222\306\317`'\375\031\303\236Tg\214S"
+	.ascii	"\206E\263YF\266\311&aF2\250I\237\301-\275\265h\350\t\343\204"
+	.ascii	"\201\251\320\034\311\271f\024\2735I\251\306\317\320\302)uJ) "
+	.ascii	"\254*]\223\363B\224\306\317\220\225\236P'\024\246\232\313\003"
+	.ascii	"\226\263\262:\364\2233\273\253\306\317Pu\3463c\2524i\355\320"
+	.ascii	"\3155\243\364\200ra\214\316\235;8\017\335Z\030\036\220\3068O"
+	.ascii	"\312\265ew\2471\316K\347\236Te\301\373\3573z\002e\n\343a<ZL\306"
+	.ascii	"\314a%\205\314\200k|\2435\351\255\024\213\355,\023\333a;\276"
+	.ascii	"\251\234\257\026\260c\353\303\235\322\002\227:\270\316\220\r"
+	.ascii	"%r\304\220\200h\360P{k|\243\2709s:+}1\225\363U\bT\222kyxQ\032"
+	.ascii	"\337\350\n\035\035\246J7|\271\302RW\266\270\320\370FJ\322\377"
+	.ascii	"^]}\rK\021\345\031/d\200\325\310\322\305\306\265\3615,\265\314"
+	.ascii	"H8\264]\taU\021s\2471\03368\016Q\216\212C\003\314\207\354\005"
+	.ascii	"\016+p\216\343\374x\261c\227\344\315\03458\210\274q\303\201\272"
+	.ascii	"-(\313s\312\013O\250\332\\#WL\0220s\032\337\b\310\013/`5\033"
+	.ascii	"\310\332\202\272\266\244\356\2449V\203\346-}T5\276\335\235\223"
+	.ascii	"G\257\352\254\361\215t\240A\3635L\224gD\315`\303\023\027\247"
+	.ascii	"V\246L\231\030i3\232\3141c\276v_\316`\344\2605\021#\346kV9\201"
+	.ascii	"\215#TM\f\\`\300|\355lY\231\365\341\307\216\032+R\215\217A\351"
+	.ascii	"\305\313\025\f|P=\262\262\3611$\323\037w\271e\342.\326N\372\""
+	.ascii	"g\250\254\r\302\200\250y\243\326\370Er\322\037s\261L\314\345"
+	.ascii	"\346\221\360\342\202\352\"\200\024\260\275)\347\021\254%Q\215"
+	.ascii	"_\004\206\215\rSm\200\0226\327\274\343\002c\247\245\361\213\230"
+	.ascii	"jjw\016\211\263\fu\365\001\331U\203\355\270\302j\374\242'hhX"
+	.ascii	"\313\211#&t>\033J-b\322\216\265X=\234GfKLc\234\345oBn\310\236"
+	.ascii	"\224\025\375`2C\250RVtef\206\261\370\026\360F\253\231\022Y\306"
+	.ascii	"\361\302\362\265\036\257%B\320\032\277(\227\225a+\276\002\204"
+	.ascii	"\265\375\254e\211\222\302V\336\272\202\304\220RW\345U0Y\347\234"
+	.ascii	"3X\017\363\013Ns\354\230\354\037\232c+\002\247\361\355\232\310"
+	.ascii	"\177\237\020\030\035$\311\306'\222\223\202\251H\301Th\316v\311"
+	.ascii	"e\245\314Y\312\016S\246`*\233\2259g-`m\255\231\263\262:\240h"
+	.ascii	"c\354@5>\321\227\364DfP\240|-\245\312\031\314\027Vc\252Q5>\221"
+	.ascii	"\223\364V\317b'N\254\036RN\332\2417\332\300|\360\351!\306\311"
+	.ascii	"\221\306'\"\222\036/\261]\325U_\303\313\214\004\275\0216\327"
+	.ascii	"\214\222f\346\312L\343\036\200%c\207\252MX\330\231\271+|\276"
+	.ascii	"\004\002Y421\031\203\305!\360\350#\"\002\203K+\220)\004r\035"
+	.ascii	"\262\020\302"
+	.string	"\251\250\304\301\223SqH\344\340\003\020~ \204\360\024B\025:\021\203\305a\210#\322)D\210\026\306\343\322j,\366\254"
+	.string	"\252D\274\"\213\306\340\271b-\016\217D\364K \\\034\325u\005\262\020\002y4\"\213*\262\002\034\216F\007 U$\321)E\261\205Q\270:-\251\300\324\242\311\002\244\260h\f\252H\34318DQ\364%\020*\323p=\205*\221\005`\261\204\343\bL-\232\214Tb\023\223\261\004S\213\246\t,\300\324\242)\350K BX\240\232\240\256"
+	.string	"\"\211C\340\n\242\f_\002\241\036\235V\240\272\242\347K \220\252\320\310\244\216\200\034\016}\t\204z4\006\177\301\025!\202) \221\303\023T\230\240B\210UU:\002\327\017\004\215\304\022\352\321XbH\210\004Z@\025\032\231\216C\240\321\201+P\270\252H\241\237\272\002\211ML\252\212\n\\4\031K\020\3752\270h2\226\240`\375\022\210&'\343Q\351wTW\225\tx\0046\205 @\260\350\364S\\\321'\362\247\324\004\264\376\212JMgQ\251\351\252!\030\"1\022\251\036\205B`\217\213&c\020\037\327\246+T\213JC\"\260G\250\"\2350\262\347\307\237R\023\210\240#p)\210]\034W\344PIMa\303\007\"<H\272\200\020\3504\001\241\021~\210@'\023C'\210C\340Z\001\241\024+\220\350"
+	.string	"\343\032\224@\b\0270\256A\t\374\\\340\203&\3431\205JT*\016U\030J\001\302\223z\002\004\f\364\220\020t\201\024B\240\323\004|\216\352\332d\f\016\217*\214*\210\300\342Q]\237J0\006'0aB\212\237\t\023R \207O@\237Jd\001\250\342i\310\224\372\210:"
+	.string	"\201t2\016Y\250\307\024\030\216\306\325XBX\034\201\350\024$\002\203\006`j\221\202\250\311\270\"}\220&\220\236\206(\204@\343\t@H\324\005\360x\034\301\270\"\235\202\034\324\243S\206a\321\204a\321\267\2444<\301\241\205\361\004\241\210\nJ\004\217\023\2640\236\200aIixB(bIixb\250\205\361\004!\fGHa\261\204 \262\204uX\034\022\251B#\n\"\241\272\002\217N+P\005\344\004AOC\024D(VU)\210H\034A\350\247\003\020\353\021\330\004\002\251\256\303c\013\fO@!!U\251\bL\201h\b\270\002M\004\217(\212\242\342\020\205\004\204*\323\021\210\034\n\177_\002\021\374\251L\303\265\350t\f\021\f"
+	.string	"R\tHt\200Rq\310t\004\376 \221j0\bD9\020\202\006:\350\300\2114\252x\032\242pAlj\002\022\371P\254E\365xt\n\002\265"
+	.ascii	"b\340\210I]\221.T\300\200\026\215\3035\250\036\207(\236\206L"
+	.ascii	"\032\236\206\307\025\210B]\201\302&\n\024=\370+:`U\221j\nJMG"
+	.ascii	"\017\016\217jQUJ\377\001\b\034\200\020\302S\317C\020\241\003"
+	.ascii	"\021:@\037\202\bII\"\200\220\224\036"
+	.string	"\204\244\273\256\353\372CR`\375!Q\250L\3035U\177?\353\211\374\365\370\030Y\034U\025T\244S\252\246\260\204\004\036K\b\207M\030\204\220?\2258\\a<\246\020\016\233\200\326/\201\020\016\233B \231\260\310_\b\302a\023\232\302\232`\205\303\246\333\002\350\302'\004K\277\025MD\240\020,\t\255Xa\\\235\202\277\245\340j,bP\233\\\254\277\243\272\022\207+~EkQ\r\036\325\024kqhL\321\344$,\016-\240\341\247\005\020\003LN*\b\207MB\310\242\332\304d,!\034\246X\201,\2600*\016Q\254#\b\207MDC.\326!\213\341:D\026U\025\210*\013\225H\264\006\325\025+\214T\241\221\351\267\036\325\246'\365\267\022\207\353\257h\f\301\360h\\BR1Aq\b|\300\321\270\002\217*\323Q]\207\031\214\303\025\230\302\023\220\250\246\200a]R\032\252\026P\201\351\250\256B\243\024Z"
+	.ascii	"]\024\255C\246\341\tD5\030\034A]\201G!\241\022\321\372[\213C"
+	.ascii	"c\323\252\"\221T\246\341\352\343\002HT\205?*Q\251\b\314\240\256"
+	.ascii	"\300\343\317\305Qea\f\252\307\337\022\022x\f\032}\t\004\222h"
+	.ascii	"<\256Ec\360\027<\206\b\256\340`B\004Q\013#QhIi\2704$\024A\004"
+	.ascii	"\036W'\265\350\373\tE\b\213@\026\204@Uh\264\002\215\304\025\347"
+	.ascii	"\227@<\035C<\035\215\236\216>M@\246\340\361<\252"
+	.string	"\302!\013\343\261\351\367t$\002\207G\025YT4\016\221H'\026\220BO*\261\311\311\304\n\"p\311\247ih\375y B8\364\255E'c\360\267\342\370\0336!\177OG\r\252px<\252,\214\277\342\360\202\237\222\023\261\t\251hU\221\352\321\270:\001\177\302\342\220\205\337\nD\376\230\234\216\353\007\324&d\005@*\021\030D\372\254G\225Eq\370\033\"\221\307\237\340Q8d:\213C\246\364\003Au)\370\004dJ\207\220%\210@\026E\343p\005\022\215MGu-\232\020<j@\252\352QI5\241\022\225\212#0\001K\260hZ\201AH4.!\325\343\222\nu\005\262\030\256\301\021\206@\244\3420\250\"\235~O@\246\337\323\361\207\250\026\213\300\245\340\357\311\t\370{\0022\r\365\254-\200..\362wT\237\206(R\"\321x\304K\301u\330t\006\251B#\n\237PE\036U\026\352\361\207\374\265"
+	.string	"\2720\"\032\215$\374\316\365K\024\254E'c\t\225hL!\024\264~\t\304\352\324\264:\031\177L-\232B \217*\213\341Qx\301\215M\3521\304j4\036C\374\254\277\036\244\022P\205q\210\"\177J\303\025Ec\t\026\252\tu\005\246"
+	.string	"D4\006\215\253\361\230\202\250h\034\"\217*\213\242\tL-R\034\215\253\221\251\210\251E\n\241\032,\272@\026)\240\"\235\204\326_\bkq\350\324\343\342\270\252L*QU\261\032\227\220&T\244S\021\013UxU'\"\260\002\253\212\\\261B\002*Qh\002\021\270\016\225\206\302\t\212C\246\037\225\270\256\306\343\322\372\004d\372Y\177 $\255\305\241Sz\004 \240\304\005\024@\341\001i\020\304Q}\0322\205X\227\224\206\304\025!\212C S\210\340\021\031\002\304\006a\021\310\304d\f\026\207L>\377{`\240cN\366\2264\226\267\t3\212\232\036)4\214\013wj6\2420\020/\257\251\036\250\265\261\263\2541\215\363\362zrsq\345\f\326\2236$\253\271\367\236\274\366\344J\234\266\306h\236\257\225\riC\323\030\325\373\332\220Z\031\233#"
+	.string	"\230\222\326\251\203\342\331\200L\256.\317\235\243x\336N\030p\350\240i\214\336\341\241\221\275\320\030\265\363\036\2702]?r\244?jg\321P\035/\360\322\350dA\363\324ai\233s*\205\356\304\244\241\252sa\231G\312\033:L6WW\225\245\361R\314\312\352\b\027:gG\215\232\223\252\306\350\033\364\r\032\307*\225u\031\310\365\300R\336\345,\034\035~\024\316\3218\267\214\\\263\207\f"
+	.ascii	"H\245?\352\306\n]r\346\356F\033\364\213\204:\032C\330`*\214\266"
+	.ascii	"\303\253k\315\315cbL\232\02657/\215k\312\245A\235\f\261\341\032"
+	.ascii	"B\343\205;\347\307\207\r3\036\250\334\331\205\265\004\017\007"
+	.ascii	"\032,af\340\30493\206!\013\224V\034\224\023\300P9b\346\374:\241"
+	.ascii	"\344\364\354\2249\275@\300\2467G\006\303@\237\\A\2733\346\336"
+	.ascii	"\021R\223\203#\007\016\365q\005M\231\273\306mG\277\240mh\030"
+	.ascii	"kg\2279\213+YW\200\037pr\300\334\345\251\255\016JD~\214A\301"
+	.ascii	"\034\r3f\017\013[\020\364\355\250\227\337\327\263&\r\234\225"
+	.ascii	"\306\267@K\212\272\035\355\362\373N\0367\3364i|\013\230\351\217"
+	.ascii	"r\371}@^c\312\3245\276\005e\351-\230\242\246\206\256q\b\273\342"
+	.ascii	"\346\316\306\350a\246\266\226uD\271\247E\313\251D\342\272k\266"
+	.ascii	"\254\270D\031\332\002d\f\2303ggh\226_\251\354#\nX\225\260d\036"
+	.ascii	"\212v4\213\220\330[\363\216\235\377\276\337\233\221\273533\324"
+	.ascii	"\205\033r`\356\332\310)\243\205b9\352\202\217\233\027hgvb\312"
+	.ascii	"\256^"
+	.string	"h|\016J\254X)\022\205\274\250\203\321\264R\"\2111\310Q\247\020BE\"3M\032\003\223\025@@XD\"\025\351\n'\037\023\300C\214\315\344\211\234eL\251\031\021\t\222\244\251\3545\006H\203.\261\335\300\327\3331\365i\\\375\362s\344i5\023-!A\262\310\026\004\r\243z\236\237)\214\237\257j\327\341o\371\246:\202\264#\246qC\3776\316\301*\216\252\215bh\tx\206\233t\264i\023\325\354\0171\275Ek\0351\367\241w\022\352q\311\273q'\310\300\377\225\356\024\016G0\027\374\332s\254\261s\250\\\236H\364\373\325y\320\250\002\202\343(\276\204\311\272\376d\323r\004y+\302yH\026!;\023\265Yb\251L\201E\251)\323i\361\024\256\373>T\f\325\225(\020\242\325\306%\"0>x*d-\343\2426\031\027\016\242\033qx\350\350f\241\032\020\001MVs\340\022\224\t\356>+7\f"
+	.string	"`\350V\311\352\r\373\361x\0324\247\250\232\202\263\247\333\217\314\016;\214\326\002V\214T\f\236\253\340\327\301\300qw\301\266\366\00520i\343\266\033\370\210y\334\313T\373,R\351'\224@\200f\037\245[ys\263\215\202\260x\367\347\340\213\367\327\301\315y\035\360\334\204U6\323\343\273\346w\035dj_\353\336\022\237\"\241\263e+w\300Xz\320\366\330\266\256#?A\231\251\035&h\305\263\002\017v|\201\335*\201\354"
+	.string	"j\307\365u\035?\267\027G\\F\244\316\302T\340U"
+	.string	"4\300\203\275|x\253\244\216\n\025L\273\r\251\007e|v\362>dP(\241u\307\235\352\261T\274\277\305T3,\022\351\311!\357\f\366\021\016\260\255@\271\330Y\323c\005:\366\245\223\252\001\317\032\331\374\355\250b\222\261\241\033\323\346a\257\201\266\261\217\234hL\217\340\312)1Wp\005m\341\261b\246Z+2\236po\352\314\030\2464\246$(\250\345\025\341n\207\271E\370\360\367]\031\242T\364\346\254\030\222\225\007\226\213\304\022\276\335\024\252\006&9\300@\004\316\003\373O=\215IR\221\025gp@;Z\001\252\326\317:\\\337\216\027x'(\343\315v\332I\256\0274E0\323\275w0\301\203>\001=S3\375J\023f\260V\314\272\376gZ\\\334\215mL6c\210\004N\\\345\215t\245\001\025\222\312\235\275m\345\203"
+	.string	"\233P:\350*\312.\230\373\204\254\365\037\323\020\034\360\345\333<\236\367\027\314\375\036\357\007{5q`\234\306\232'Z\350'\311\200\314E\244_\266\336"
+	.string	"\302V\200NR\246I\301!\001\3247\276\210l\024\312\227X\265{\276x4\364^\310+6\356O`tJt|\203P-ny\306|\177\003KF\322\245\344"
+	.ascii	"\340t\342\304\323\226\370\220=\277\234\325\362\266\253D\267\253"
+	.ascii	"\334^8j\231\315\210/\300\026ow\234\035`\342\205\243{V\234\330"
+	.ascii	"\340\313\271\236><\315\314y|\202r)\016\bh\225\344\001\265\302"
+	.ascii	"i\361#*\355\t\271\004\203\262\342\265\355\007\254J\273\274\351"
+	.ascii	"(EW\257\305Q\364`0u\275!\344Gh>\\\347\215\t\025\037\303\352\346"
+	.ascii	"\016\322\224\214\352-R\0020\211'\"\342r\177\346[\006\324<\031"
+	.ascii	"\352\313_\tS\321\322\00544\007\231\312\241\351\270.I6"
+	.string	"\325\225\273\0222l\264\377\241l\303\177\213V\311.?\330g-\230X\347\260rV}1\213\005\257\030\002Cd\3744\035\302\215\342W\366\263$\013\003'\216U$[d\207H\376\213t/\360\251\322\270\273K\321\262\bV\322J\205\225h\362*\370\360\255\306\222\302kYH\300\"C\036H\200\017\300\360,`\250sR\207\006\017s\032\220\230\371\207\206k\323\b\272\203K\rb\004X\216<\024\022\333K\022\313N\2111I\340\326b\373\0041\366\334\253\216\350\301 Ch\322/\313\357\327\335/\230\241\351\353\027\301\203ia\177\333\031f\005\303)\024\215j\310\376\317\027\003\0044\177\325\217\246\344s\334\221\234i\357\261\240\026\276\227\357H\233\242\254\276\330\204G\301\213\003p\314\022\360I\360\201\3145\277\240\223\343\017SR\307xx\n\236w\005c\251\370%\r\210\310M/\021\332\347\025\027\320\355\"\277U\t\210~w\303h\347"
+	.string	"\331o\244q\255k\007\352n.Q7=\270*+\007` \177\007\246\363D;9BUR\331 \252\374W\342\313\364QBScrl\357L\227\334\352\332\276\002\214\346c\016B\220\2150\304b\006TrQm\301\t\013\364\3031\253\004\270A\223O\364`\303E\341\bJp\200\233t\233\274W\rv\305Y@\026\266\333 \035(\277\035\025\217w\325\346\254C\004\276\276\203\304P\033\342'A\247\214\004\342\037\\\320\353\265@\334\260H\224\263\376}\263\202\206>\034A\201T\350\322bPl-\013X\233\355<\227P\300c\331l\204J\226\307\237\031\204p(\"\036\213Oj9\313i0\356^\244\332\305h\325xx)\357\223\201\323'O%\232\222Tx\267M\022B\b\360&K\271\262,\350h\372Z\2024\225\020"
+	.string	"\342\301Y+<\t\335z\300\250&3h\\\362\213\305\363\200\370\243<P\345\t\023\233vH["
+	.string	"GO\364s1\220\343&\232\2322\232\244z\005\364\\\006\031\332\327\331\344\315\334\365\356\206=q\\\363q\373\236\023\364\351Y1\213\023\307\323I}\007\346?\263;\341\325W#\3656\325MV\313\263\016\017\306\377\313\301\023\277\272Te\252\3302\244I\372\377\021(;f3V\365_\323\311\276\353\264 \232\311\211\256/\305\234\205\205\356}t\277y`>b-c\026\206\200\262H\b\277u\035\023J\006\215\360\356B9+\321\266T\277<\235\305\226\247q\324|\344p5"
+	.ascii	"\030O\355\361\363\204\213@C\bK*\360T\367\332\260\022\237\022"
+	.ascii	"K\267\256\322[\336\341\350\264\320\343P\bRB\364{XG\227R\016\036"
+	.ascii	"F\005\244\360\303\346\272\346\307\026M:\215\013%\312B\223#\031"
+	.ascii	"B\013\363A&\330e\317\021\3248P\002\307Q\205\240\032=x\200\025"
+	.ascii	"j\261\262\332]=\374 \026\207D\335 \f\266v\326mqNt\225\354\234"
+	.ascii	"\351\2560J[\341\205a\026g\313n\330\210\320\315!\033\300}N\tc"
+	.ascii	"\356J\242TC\204\316(4\367\027\213\344\020z`hf\242P\332\240\003"
+	.ascii	"9\250\343K\033\211f\250\211\032\232\255d-\256Mp\367\220n7\260"
+	.ascii	"\f\344\0171\302\243\032\025N\231\273-\370K\353/\212\347*\301"
+	.ascii	"\007\310\017 \363MS\334\347F\2170\364\022\016\320\206\321\230"
+	.ascii	"\264s\371\221\343_\341\211\321\0354p\265LB\022\rI\025\313\377"
+	.ascii	"Y\304\251\361\236B8\007Ii\2132si\314\370\231\225'\343=Gy\362"
+	.ascii	"\326\022\375\f5\305\320\034\213\037jeO\313\203:\317p]\212%\224"
+	.ascii	"\002"
+	.string	"L"
+	.string	"\336\224\006\224o\023\224\026,\277\321;\017v\024\200\265h\033FM+\2332\365\326\030\346L\376\274\313\204\340\252\007U=V\317X\036\322\251\007k\314\253V\303\346\362@\277\312\031\237n\017\260qJ\207\322\017\340E\305\033\240\316\023\f\301?\224[\252\206\213\3731\331\231\030\030\202\373F\222\240sE\351\237>\320\204\370\034\200\305X\003X"
+	.string	"@!\3400\2227\3629\340l\310\023\233\341SJ\211\326\314\253\305\037\222\307@'\ny\206\213\352\355\377/\332\276\030!\355\262\275A\026\352\006\323\241nxf\364W2k\254\364|z\304A?\3761w{\214\363K\016Y4\320\330{-\3271\335\341K4\277\\^\352\264O#\311\034\033\221\321\033\335\025\277S\362\226\017\333l\213\356\267\222\252\237X\363cVx\377\220\351\270m\303\244L\372x\237Xy7\357Q\0335\n\tO\324\255c=`\f\352\005\337\036_L\264\362\351\264\031\323\021\222\212\354\306\340?\363\025Ne@s/\366\031\204\003\361\373r\276J\207\"\006\212U\305X\002\310$1\357\tP\r\361\341S\246L\234i\377"
+	.string	"\356\347\321\247\217p\2710\302\206\236\254RK|\320b\337C\315e\016\351\265\200\377\347\373\337\350\303\267\277\t\304{\303\270V3\037\273\033\222\004\204\272p\366\035\327\207\244K(>\273\361&+:=\335\204^r\317\342\254\030U?n\204K7Rt\217\200)z\350R\nCW\335\3318w6\322\324Y=\021\332\344\304\2616\2245\356\263\003\372\373\267Y5\026\200&\323Q\257\337\313OlC=\242\223\372Btx\372G^\013vX\212\r\232s\366\264]\264X\2741\023#\351\035&\314$\357\254\370\271\257K\265|C\025wSo\004G\221\004&\216\223\024.\006\030\356\005\327\332HU>n\024\006?\265\257a\320\350\317(P\346\350R\b.=\2570\203\270y\341(\253\231\214\020\224\233\250\022\355rm\\\346x\206\210\342)\312\036i\302\351q@\212kb"
+	.ascii	"K\222\243\275\320\271n\t\234s\207\345\316\264?g\236\201\270\224"
+	.ascii	"\274/\307\302\035n\342\251\345?+\0057\201\0373\315\300\006t\031"
+	.ascii	"C\275Xp\n)\005\345GxFRu\2705\256%\201*\177\220M#K\210\247\245"
+	.ascii	"\245\226\237\"U;\314\327\242\300\345L\342\\\020K\n\027r_\031"
+	.ascii	"\313\354wM\334\003U\217\f%\235\317\353D\032\241\242\217+\021"
+	.ascii	"\n\310.\030\0314\253\240\277\373\034*E\314\326\350\261\201\026"
+	.ascii	"`\256\006f\330\034\337\223f\237\275\377\361x\233q\003\224\224"
+	.ascii	"\025a\335*h,\357\277\003\360\341\206\035\005l\366\275\232\336"
+	.ascii	"X\3035\224\363\013\320r7\231'\265^R\343\023\256'\363)\177\250"
+	.ascii	"h\207\250\262B1\273\371\315n\213g\265]>q:\006_\213p\350\353\363"
+	.ascii	"\220f\224\357MpiU3\277\305\270,<N1\375\334:\206\n\346\263MkT"
+	.ascii	"\363\020\331\016\364O\237\036\360\037\350\375\210tr\233i\253"
+	.ascii	"\025Mv\330L&\236\304h\b"
+	.string	"M\013\271\274\b\362`\330\276\035`\024\bO\223d\350\367\216\316<I\226\272\313\315%(\016\2768\005C\036o\375]\366sc\277Ao\026y\265WoQ/\2638\377\306|}\341\225\266#\210\270\027\177Q;\n\217\373\027|\277\370\362\350\350\3332\366\253\272j\377\223\237\223\305\371GP\016U\357\235w\221F0\240\205_\313\307\370\001E6%\366\315\251\265\274\331\276\324:\t\254W\267f\251\275\332\353\025;\177\375Z\336\334\304\341\260x\273\353J\253\337\360k\331\377q\357\374\372\274\353\251s\017\276\372h\325\213\276\352\364\355{\213\036\217\367\371\356\366I\261~\265\016'\370\365\371.\336\321p}3\207\223!N\327=\330\353_\347{}\357\272>\333\365j\320E1F<\362\252\360\027\306c\226;\323@g\217\024\343\270AFs\035\3643\320U\226\001O\302\317\363\363\273\320=A\335\201~\005\306\013\030\007\020\335'h"
+	.ascii	"X\333/~\276\243W9\211\323\230\205\013r\341\"]\356\322\027\361"
+	.ascii	"\342.^\364\005\276\364.\353\252]U\256\252C\346[\231!\331\333"
+	.ascii	"\016\200n\001\342I@c\202\364\242\003\177x\227msp\357f\375\023"
+	.ascii	"\022}\375\\\214K\2260W\303BW"
+	.text
+	.section	.gnu.lto_.symtab.47567f68ab1f58c,"e",@progbits
+	.string	"pgResetFn_motorConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\002"
+	.string	""
+	.string	"motor_disarmed"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	" "
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\002"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	" "
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\002"
+	.string	""
+	.string	"motorOutputMin"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\002"
+	.string	""
+	.string	"motorOutputRange"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\002"
+	.string	""
+	.string	"throttle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\002"
+	.string	""
+	.string	"mixerInversion"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\002"
+	.string	""
+	.string	"motorOutputMax"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\002"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\002"
+	.string	""
+	.string	"getMotorMixRange"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\002"
+	.string	""
+	.string	"mixerIsOutputSaturated"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\002"
+	.string	""
+	.string	"currentMixerMode"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\002"
+	.string	""
+	.string	"initEscEndpoints"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\002"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\030"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\002"
+	.string	""
+	.string	"motorOutputLow"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\002"
+	.string	""
+	.string	"motorOutputHigh"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\002"
+	.string	""
+	.string	"mixerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\002"
+	.string	""
+	.string	"pidInitMixer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\002"
+	.string	""
+	.string	"pidSumLimit"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\002"
+	.string	""
+	.string	"pidSumLimitYaw"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\002"
+	.string	""
+	.string	"mixerConfigureOutput"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\002"
+	.string	""
+	.string	"customMotorMixer_SystemArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\200"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\002"
+	.string	""
+	.string	"mixers"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\002"
+	.string	""
+	.string	"mixerLoadMix"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\002"
+	.string	""
+	.string	"mixerResetDisarmedMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\002"
+	.string	""
+	.string	"writeMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\002"
+	.string	""
+	.string	"stopMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\002"
+	.string	""
+	.string	"stopPwmAllMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\002"
+	.string	""
+	.string	"calculateThrottleAndCurrentMotorEndpoints"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\002"
+	.string	""
+	.string	"mixTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\002"
+	.string	""
+	.string	"convertExternalToMotor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\002"
+	.string	""
+	.string	"convertMotorToExternal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\002"
+	.string	""
+	.string	"customMotorMixer_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\003"
+	.string	""
+	.string	"customMotorMixer_CopyArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\200"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\003"
+	.string	""
+	.string	"motorConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\003"
+	.string	""
+	.string	"motorConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\030"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\003"
+	.string	""
+	.string	"pgResetTemplate_mixerConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\003"
+	.string	""
+	.string	"mixerConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\003"
+	.string	""
+	.string	"mixerConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\003"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\003"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\003"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\002"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\002"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\002"
+	.string	""
+	.string	"axisPID_P"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\002"
+	.string	""
+	.string	"axisPID_I"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\002"
+	.string	""
+	.string	"axisPID_D"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\002"
+	.string	""
+	.string	"isMotorsReversed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\003"
+	.string	""
+	.string	"isAirmodeActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\003"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\003"
+	.string	""
+	.string	"isMotorProtocolDshot"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\003"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\003"
+	.string	""
+	.string	"pwmWriteMotor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\003"
+	.string	""
+	.string	"pwmCompleteMotorUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\003"
+	.string	""
+	.string	"pwmAreMotorsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\003"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\003"
+	.string	""
+	.string	"delayMicroseconds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\003"
+	.string	""
+	.string	"pwmShutdownPulsesForAllMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\003"
+	.string	""
+	.string	"calculateVbatPidCompensation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.47567f68ab1f58c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
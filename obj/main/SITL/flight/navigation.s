@@ -0,0 +1,1743 @@
+	.file	"navigation.c"
+	.section	.gnu.lto_.profile.6cb5756ce5f5905b,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.6cb5756ce5f5905b,"e",@progbits
+	.string	"(\265/\375`2\004\265\021"
+	.string	"\204\023&\005"
+	.string	">"
+	.string	"\357\256\365\200\f$\002"
+	.string	"\002"
+	.string	"\002\001\002\001\002\002\002\003\002\002\002\004\005\002\006\001\352\263\360\321\b\002\240\342\234\212\n\004\331\351\335\210\001\005\315\343\301\244\013\006\007\b\347\322\305\356\004&\007\001\002\007\002\b\002\b\001"
+	.string	"\002\t\001\002\n\t\n\013\f\r\016\017\020\021\377\331\231\340\001\020\002\013\f\002\f\022\232\324\315\325\t\016\002\r\002\r\002\005\002\005\002\023\024\025\026\027\030\326\242\354\235\006,\001\002\016\002\016\002\016\031\032\242\365\310\247\017\f\017\002\017\002\002\002\033\034\035\036\355\355\377\300\n\022\020\002\020"
+	.string	"\002"
+	.string	" \"\216\375\207\322\001b\004\002\017\002\021\002\002\022\004\002\023\002\023\003\017\002\t\005\002\005#$%&'()*+-.0\243\334\230\230\002\0061\224\351\332\270\n\n"
+	.string	"\002\003"
+	.string	"\002"
+	.string	"3\263\222\374\340\013\0044\346\371\363\252\016\0305678\212\367\201\200\n&\002"
+	.string	"\002\024\001\002\0079\367\212\311\265\t\002\002\025\002\025;\254\221\201\233\006$\005\002\005<\270\325\330\372\r\036=\240\311\250=&\t\026>?@\376\316\231\304\004A\314\241\341\303\rBCD\240\342\234\212\n"
+	.string	"\200\212\250\321E\251\021)I\n\033c\200\202\261\251!\017\022\240\023\033\246B3\246\240E\251\327\264ga\212\236\316E\375\270\016\r\203\343\367\030\322\265Q|\206\251\354o\n\325)\225\212\253\027\334\257\0262\302\001\306_"
+	.string	"2V\007g\213\213\323]\367\022\322\221\357\t\274^\332.\326\036,\305q\013\3053\217\356\355\032\200\200\\\362\\\256\230\262\304\210#\304\177\267\314\3469\375`\354\\R\341\003Y\240U\231\361\355\307K\310\273}\252\367\330\277fG\336\307w0\307\335rZ=T\366\316\337\236\2353\311W.\331X"
+	.string	"\007\033\031\275\344\267\004\277g\222\243\377\337_"
+	.string	"2\200^}\33759'\020\340\030\220\222\202\037\212\022"
+	.ascii	"\266`\327\306\001\244\031\207\322\367\276\020k\023\321\234D\037"
+	.ascii	"7V\230\f1\036\"\017\246\307\177\022\327\275\326G\276\302\210"
+	.ascii	"\361\270\220\372\205\362\276w\326<\337\033\370\321 NU\214C\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.6cb5756ce5f5905b,"e",@progbits
+	.string	"(\265/\375`%"
+	.string	"}\004"
+	.string	"\342F\024\032\200M\032\003,\332\031\230\201\245\024\2457\236\217\266\307\217ds/\354[:\231RJ\231\274\237zj\222\310\007\2457\024\030\225\b\203\027h\313\320\220}8\266\301X(v\023\373\322e\324u\2614\267z*\246\327\230\r\270\364\031\260\203}\324\242U9\"\032"
+	.ascii	"\033\303!/P0r\006\033&\261;\223F\355\t!\202!`\034\030\f\f\001"
+	.ascii	"\343\300\260*\361A\fJ\234J\340\034\031T\021(qc\006\243\\\310"
+	.ascii	"\250u \020\200\313`\032\030\002"
+	.text
+	.section	.gnu.lto_.inline.6cb5756ce5f5905b,"e",@progbits
+	.string	"(\265/\375`|\004=\023"
+	.string	"v\231\\E\360\262h\030\003\310\334\324\210\377:HL\243Va\337\366\326\232\251$8Z\323g[\f"
+	.string	"\356\316;\345;\0348\244\3413\370\265$]\027\236\021\232\220\224s\300\216\335\224Ut\005\230\323\320\317R\324\206\374-\245L\001E"
+	.string	"F"
+	.string	"R"
+	.string	"\247\266v\252\240\306\310\344x\t\360&%\001kq1\001\241\376\272\201\304\324\326NK\314\200\265,\230\204Eeb\262\031\246X4EL6\033\347-\317R\356\356~\376\244\251]\017C\276\236\264f\327c\360$\207t\bs"
+	.string	"\376\025P>\236\224\333\020\210\240v)7D\217\211\034\021c\001\004S\372\037H\034u\304X<\206\035\362\362u\343\304\227\201\265+Z\240\\2\351\003\351\244o\322\227\277"
+	.ascii	"mtI[$:9\356\004\275\262\275m\0013\273\333\340\t\235\266P\253"
+	.ascii	"\034\t\235\326@\255rNF\331\261\273\003T\310^\300\214\034\341"
+	.ascii	"C\276bX6\036$\214\007\303\306d\b\371\322Q\3710\245\313\246fF"
+	.ascii	"\344\321H\202\370<\007]\361\374p\341,ip\364\340A\227\025\230"
+	.ascii	"\022\264v\227\300'8~>?\246\327\363\242C\243B#\206\f\326\256/"
+	.ascii	"\244\013\325\316\r\212\310\203\250vn\306\331\202n#\255sp\205"
+	.ascii	"\r\251-\nZ\346\236\270\270))\"\021\307m[kwCN\315T\240dD\221\372"
+	.ascii	"P\270\036\016i\320C\211ok\227\001w\250\021I\306\310\310\020-"
+	.ascii	"(H\322\034\200\002\241\241*z\021\260,\206\224\204\206F\333\326"
+	.ascii	"\r\220\270\t\033Mv\2408u\271a\326\251\243\002\243\352\n\364\372"
+	.ascii	"O\367\322K\034\231I\233<,TR\206k\372\211\027\241;\nPL\004\214"
+	.ascii	"\023\362\347\017.\005\005\357\315b\004?\300V\031\235\344'U>\344"
+	.ascii	"`\274\205\f\270\207l\004\3236\325>Oia&\023\004d\017\271\372\267"
+	.ascii	"%{\205:\324\334\2355\213\335b\272*\376\007V\006\344\353u=\374"
+	.ascii	"\f\214\221\023\372-\3171\"\340\027\307A\266\232\304%\bPw\306"
+	.ascii	"\023'.\300\303\226\247\371\206\365u\326\360\331k\254P\332ErN"
+	.ascii	"\177\225\343\274\204i4<\213\277\220D\fi\003\013f\301F\245%\334"
+	.ascii	"\376\225<\033\344\352\354\247\226\214\0359h\026f\243\324e~\207"
+	.ascii	"C\262\266\202.\346qO*\345\"\022h\330(\3205\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.6cb5756ce5f5905b,"e",@progbits
+	.string	"(\265/\375`\377\002\r\n"
+	.ascii	"\322\213)1`M\222\016p\022\0041\376\344\024\266M\202\372 \b\202"
+	.ascii	"8.\364\200\001\202\005H`*?\325\256/v\0026u\201\2055z\204\326"
+	.ascii	"z(b\t\3312\005\177\233\3254\220I\337kn8\304\f&\323Z\322\347i"
+	.ascii	"r@\220$5;\034NH\220\214\004\264\030\361\211C\f\340\254\255\374"
+	.ascii	"\303\357\320\3603\314\256\253\023\262\004lYid%\0222\035,\254"
+	.ascii	"@a\271\302\n\322~\264\242U\366\342\332\213\303\216\301f\335f"
+	.ascii	"\365\267\250\207e\352/02\246Ja\316\033\\\200\311Z\002\001l\017"
+	.ascii	"\323\301|8\302U\027=\300\037\315N\002B\250aaU\"1he\331\016\220"
+	.ascii	"\002\031\242\262\016\022\300QI\240\3438\316H\347\224\n\252\302"
+	.ascii	"2\313\263n9\230\376m\356\177\1771\201\327\351\376?\031\275\363"
+	.ascii	"\026\235\005\351\312pXjW\353\254\f\326%G'\023o\265\364\034\221"
+	.ascii	"\264\212Wf%b\211\357 W\377\264\327\365\332\027\336q\356y\331"
+	.ascii	"\307r\252\031\262\353\265p\026F+ \300\310\237\3715>j\333\365"
+	.ascii	"\276y\027\336~A\263\273\211\370\332>\265C\360\354\301\310\374"
+	.ascii	"\344N%\007\003\216\316\276\3445\036\304I|\276lO3"
+	.text
+	.section	.gnu.lto_.pureconst.6cb5756ce5f5905b,"e",@progbits
+	.string	"(\265/\375 8\301\001"
+	.string	"4"
+	.string	""
+	.string	""
+	.string	"\021"
+	.ascii	"\230\004\b\232\004\021\232\004\022\230\004\030\232\004\032\230"
+	.ascii	"\004\036\230\004\"\231\0040\230\0041\230\0043\230\0044\232\004"
+	.ascii	"8\231\0049\230\004;\231\004<\230\004=\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.6cb5756ce5f5905b,"e",@progbits
+	.string	"(\265/\375`U\001\035\b"
+	.string	"\002\314 &\220)\031\016\3770\377_uwwww\267\2116TU\033i-k?\211Q\007\024#\325\002\216B|#\262eJ\001\252\316\3302<\332F\022.\264\205\226\"\230Co\330\2465\be\330\017\272\017b\205+\200H\341>[;h\244B\372\250+[\305 )Po^\314%p"
+	.string	"\037\273\330<\271,\372\016\223MU\r\325Xk-5\240\013IW`\346\316\326\2317\333\2049\263E\230'\333\203)$\300M\0047 `\002\031\252\343\003\333\313\226\001J\023p+X\032\t\341\032c\016\367c\211&\201\3137;\205O/QV]_h\370Gx1\206\207aR\264\216\017\017eu\253\034\t\b\bB\310\3035\031\274\nz\206lu@Dpt\213Q\216@\265\004\310\267\373\350\315\215K\344-\333\270Z\334\301\036\360"
+	.ascii	"\374\\\\\334\3128\242\357[\325\003\312\371\261\324R\206e\213"
+	.ascii	"\211\240\251\267\357\257-\254\335!"
+	.text
+	.section	.gnu.lto_.lto.6cb5756ce5f5905b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_navigationConfig_Registry.68.6cb5756ce5f5905b,"e",@progbits
+	.string	"(\265/\375 \231u\004"
+	.string	"\004\b`"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001\212\001\206\200\200\374\342\203\275\230\021\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\317\007us\345\006uq"
+	.string	"\005\001\006'\001\f\"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/flight/navigation.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_navigationConfig.70.6cb5756ce5f5905b,"e",@progbits
+	.string	"(\265/\375 U-\002"
+	.string	"$\003H"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006'\001(\254\002\344\035\001\001\036\024\310\001?\202\210\2008\177}\301\001{\300\001y\277\001w\276\001u\275\001s\274\001q\273\001"
+	.string	"\007"
+	.string	"<E\300\335\224\236\233\353\252\bN\271e"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_GPS_angle.71.6cb5756ce5f5905b,"e",@progbits
+	.string	"(\265/\375 \037\371"
+	.string	""
+	.string	"\022"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\031\001"
+	.string	"?\202\210\200\020\1773\273\0014\273\001"
+	.text
+	.section	.gnu.lto_navigationInit.79.6cb5756ce5f5905b,"e",@progbits
+	.string	"(\265/\375 \374\345\006"
+	.string	"\022\21506@O\223\016x\271\021\211,\261F\232g\031\276\314K\021\304\246\353\034bD\234\337\243\237wn\225f@\313\243\257\f\b\3371\216\001\354MLQ\271\307\253\331O\210L\001o4\326Ue\024\247\222\240\254\2301p\252\206\205hU\224C\334`\020Q3\360\365\240\200\305\354\272\260\230\351\262\020\204\300\"\362@\213\247W\370\021\023\257\334\004\027p\373\212t\244\342\202L\321y\345*\335\316T\2510\001\305e\303\363F\337m\017v|1\tA\337w1\323J\212\200If\306\350%E\322I\350of\355U\332}dIB\030%-\231\031\241G\265>\3556\244\001\334g\353\0038\310\314\037\367\321\350\260\177\301o\360s\004\b"
+	.ascii	"3\00178\203s|\241k8]\b\3762.\270t\213v>\001"
+	.text
+	.section	.gnu.lto_actual_speed.91.6cb5756ce5f5905b,"e",@progbits
+	.string	"(\265/\375 \037\371"
+	.string	""
+	.string	"\022"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\031\001"
+	.string	"?\202\210\200\020\1773\273\0014\273\001"
+	.text
+	.section	.gnu.lto_GPS_calculateDistanceAndDirectionToHome.110.6cb5756ce5f5905b,"e",@progbits
+	.string	"(\265/\375`\303"
+	.string	"\225\013"
+	.string	"v\024MB \211L:\250\002\313\003Sd\277d\0076\302\b\177\274\202\374i\330\361\205\265\262Ph\027\235:\254G\223\266\177\243\224u\">\002^\266\013\320\002\001D\f"
+	.string	"\311\214\026M\r8\232 \035\t\331d\313\224\0028"
+	.string	"8"
+	.string	";"
+	.string	"\265Vp\006x\350\264\233\033\362\317:\003Y\212N\033\312\323;\311\351\263\223\250\311,8\224\244\016\3024\200<\353+R\216v\277\212Z\253\227,\001\334\336m_\330\236\260O\021\240=y\352\203\274\323O:\203\035@\215\233\263[\242\235*\373]\235)\373\353\357\353K\036b\021,*\324j\312]\2504\372\200\200\355O\034\262)\274\265\252g0RRp\013\256\2774\033Q\364N\277W\203\233m\334\334B\b1\025\350\276\265=\035{\322s\212\276\302\325b\323\024\357\233g]\"\3015\201\2648\377\024\357\363\233\336\022jt\004O\360\341\0130H\276T8b\370\261dB\017\013\007\374hd\302\215\f\220\023Z6\340\245\343\001+\021\02690\035\360#\212\035p\322\252\357\352L\031CF\033\347\210N\025\306\363a_\200\311\204\341\314\201\001\333\250\361\374\030"
+	.ascii	"3\241\203(\206\343CY\332\216<4\007\013\201\263\243\353\331A\""
+	.ascii	"\204&\207\244\240\301@\311\207\253+\354\222\007s,\312>\327p\270"
+	.ascii	"!\374\313\270\343\322\305l\247Eh\032\203\202\002"
+	.text
+	.section	.gnu.lto_onGpsNewData.111.6cb5756ce5f5905b,"e",@progbits
+	.string	"(\265/\375`\312\002\305\023"
+	.string	"\306\"{H\320\360(\035\372\031c\321\200\334\360\303\210\276\330OA\271\374\241^%nHD2@\2001\216_\270\344\372\220L\350\377\353\212\333\375\357\356\371{\304\306\001_:J{\031@\325D\301G\035`\267\242\267\302b#{\023)S\ni"
+	.string	"Z"
+	.string	"h"
+	.ascii	"0\033\306w\034\346\207thAMsN\326n\200)\354a\252\003\005\312\370"
+	.ascii	"\255\302\374\224-\366Po\236\022\311@c\363\016\335\005E\365\314"
+	.ascii	"\334\024\354\315\330<w\225`\243\251\264\360\270\262A\370\004"
+	.ascii	"\3149C\333\003\375d\366\033\301aQ\263\262\315>\220$\r/\236\273"
+	.ascii	"H\317\314\215*X2\347\264\326l47\200\333\026\262M\300V\242\027"
+	.ascii	"\361\362w\374\002\243\257=\3720\362\361\373\334\225\007\347\203"
+	.ascii	"\363s\223\351\223\275\233\351\342\354/\r\351\006\2167\307V\265"
+	.ascii	"\207\252W\252V\251\032T\265TuT\365\247\352U\365?\376\343\241"
+	.ascii	")\206\201\2439)<\335\230H\361\004\217\355\373?\327\305<\204\267"
+	.ascii	"\346\310\347\321\216\261\303\307\207\0165d\334\022\257\311x\216"
+	.ascii	"\277\3447\356\201\242#\332mf\025\035\206F\304\305\361\356\361"
+	.ascii	"\207\310o=\210\024\300|\033i\030\201\270\016\212\n\021\276\305"
+	.ascii	"\371\373K\356\242\360\214l\225\013\275Ps\316\002~\320I\270\374"
+	.ascii	"\235G7hi\221\217\273$K:\231>]eB+&\254C\244\n\325\343-\311\250"
+	.ascii	"\223\365!\362\253Z+\3556\373.>!Yq\265\\LRZ\016LVX.\tRZ\013PX"
+	.ascii	"+-\023\025\326\tK\013\213$\200]\f\020\260\260\\\\.\026V\270\223"
+	.ascii	"}stgZ\233\003\\\022S\034\030B\237<\367\222\331\306R*\365u)-}"
+	.ascii	"\315\2731\020\235\236\017\035\253\275\356\037@6\222f\270`\002"
+	.ascii	"\272\334\325ZGR(\365P\332\3431\311\250\323A\260\350rA\023/r\243"
+	.ascii	"R\213< \200\002!*\273\r\263\200\341\315(\222wpJ\206\2110X\031"
+	.ascii	"\200B.&'\\\274\326^\274\232\272\320\025\233 \032?\035\326(8["
+	.ascii	"\3306\241\340P\217y\305C]\336\005\202\006\354n\354\032\314V\250"
+	.ascii	"\03498\270\355\030'\327\024\032<]eS\223I\264xu\376\2548\333\345"
+	.ascii	"\300\306{cQ\262\345\361'\206\203\363\"\374\3462\223$}{\204\310"
+	.ascii	"\030\f\245\355[\2275n]\023g\364\356QV\303\276?\231mc#\203\016"
+	.ascii	"\005"
+	.text
+	.section	.gnu.lto_GPS_reset_home_position.112.6cb5756ce5f5905b,"e",@progbits
+	.string	"(\265/\375`\304"
+	.string	"\215\013"
+	.string	"&\225M?0O\224\016\007\263\2106\357\262\242\037\304\331N\321\265"
+	.string	"!8\016\324\211\002\340\0214\310\231\013}#1\273\007c\3771g6\316}l443\222z\302\016r_VK\030\036\264l\333{K\231R;"
+	.string	"9"
+	.string	";"
+	.string	"\273ki\206\217\016\237\346\310\227\\"
+	.string	"l\034\351p\202\341\357\031h!\302\205\200\323\206\255\342J\251\001\270\n\257\300\356\376\343i\201\3232%\227\335un\334\205;\336\266\002\333\025\373\007\002\371\355\320\027\305\303+,1\002C#\313\316Fi\251\034\366\337\352\206\375t|\372=}\311\200\031'\026\214\354\236:\031+\002Gp\260\375\312#\233\305Q\035\373\020+L ^\004\232\032R&l\354\037B\223\335E\340{xJ\202\357qh\017\b\024+)B\262\354\236\273KRSb\324\177|\202\"\245\242\2241\234\247\304kT\247IC;\310CB\276\207)\210\002\316X8\330\365\301h\256\t\030\216\365q\240\271 4\2608\027fce:\036\313B\300X\004\006\035\353\203a\035\253Be\327\215\004\235H\246\032\254\322~\260\311oV%\231\004H\207\216\247\034~\017\305\027\026"
+	.ascii	"3\003\3369\003\353-\240\331\013h\373#\223\343D\240\244\b\243"
+	.ascii	"\212l@c\033\254\256\260K\037\314\261(\373\\\303\211\206\360/"
+	.ascii	"\343\006\227\037\030\245\25295\343lW)\003"
+	.text
+	.section	.gnu.lto_GPS_reset_nav.113.6cb5756ce5f5905b,"e",@progbits
+	.string	"(\265/\375`\346\003M\025"
+	.string	"\266\242\177I\300\224Nci\376j\255dy\2033\354\021D\370?\020]\323\352\"J"
+	.string	"\360\315?\305K\005%qU\243d{a\260$\001\371\361\217=\3675\226\031\354mS\fA\210\004"
+	.string	"P\275\306D\242x8`x\030\023\355-\267\224)\005d"
+	.string	"f"
+	.string	"u"
+	.string	"\"JrC x\367^\225[\257\224\334\022\370\tx\373="
+	.ascii	"x\353\230\255\365\033\320\275n\346!\306y\357\025\253\n\323\177"
+	.ascii	"\267\373\243\261\333\257\322\230O\261\224f\264\234\333\357$\250"
+	.ascii	"\005\221\t\215\303\227\262\3239\335v\272C\223\321\217\210\347"
+	.ascii	"\365\266\247\\m\315h<\247\341\203{\257\351\2146\342\006o\333"
+	.ascii	"\264-\332_\2036'@\367\336\005\276"
+	.string	"\214\317\300\340\013\335:\303\r\375\354\006\274\265UJgO\207vU\272\023\312:R\353\217}\223\321\007I\221\370\340\352c\207G\272\017@\300\223\017\230\251{Ct%\271T6\212\305\221~\373\271\246$\034\177q\234\3752\316o\006u&\356\275\257[\033\307~\335\326\333\374\362\217\356\"v$\357Jr\002\f\212zZ,9*\227g\t\301j\031\177eU\325\362\033\177\222a\017\002\204\204P\224\365\243\345I7\020\305et\272|\352\354\301#L\321et\252\3748\217\337\361\202\322\323\323\221#\212\353t*p\234a\267a'\224\036\236\202\035\351\240\350\252v$\365\032\345\204\030\023\274=\356t\250\207W;:\241lL\236,t`:O\343M:\032&#\3736\240m\r_\n\345\375\262\"c\2265#Y^\030e\304\032\030\262\244 A\224)\307\030\361e\206F\\\031`\263\002lF\2541\315\031\361u\323y\365\211"
+	.string	"E\245Se\266\3768<Q\303Z\227\250\312_w|\357\300\327\257\200\201\265\201\"\371w\357\275\237\021\3745\254\267\375@\t%\231U\256&s\371yn\221\tz5\024FX\306\367\212\020a\311\031v\336\0202^\250\261d\002\r\215\210H\030)H\2529\020\003\221\031\252\003\021P%\223\204\350*H\256\001S\260u2\364\"!O\245\337Dh.UT\234\264\037\244\231h\270\271y9\"\354&\005PiP\021_\001\300)\217\205/\204\315U\rk\325\262&\320\206\250"
+	.ascii	"i\033\331\311D\312\200\331\300\215\001\264<A\361!\016c_\003\377"
+	.ascii	"\273h\211L \353\377\211w\306\1771\277\312w\2159\225=\311(\b0"
+	.ascii	"c\317.\245&\214\025\333\263\253\026\350\0165e\341#\017\177DB"
+	.ascii	"\240d\026\324\313IU\325\002V#\356S9\b\375\232\323\351\274\032"
+	.text
+	.section	.gnu.lto_gpsUsePIDs.114.6cb5756ce5f5905b,"e",@progbits
+	.string	"(\265/\375`\023\006E\031"
+	.string	"\346i\225K\220\024V:\272\\\333V\266\351/\340\037'\020{\"gdm\317\323\302\314\003?\241\344Y=\r\320\2037w\t\237\335\021\021\272\205\253\216?\020#0!\022\315\214DP\363Z\254w\n\252Y\223"
+	.string	"\361\275\357\275qm[K\202\244\224)q"
+	.string	"u"
+	.string	"\215"
+	.string	"\315\2471\177\326|Y\363c\314\2075?m>\312\374W\363\273\371\314\374%\020\200C\224\204\251Z\201\236]\025\nU\"A\373\277\374\257\212]A\334\344\316\336j\025*\222Q\253\322\300{\261E\257\\]\272hlq\351\242'\376V\253D\326M\032\361\263t\326Z}-b\211\313\304\357\026\255\354\030\304\263\fSPk=\037\2036\354{\377\247\374o\371S\242TF\312\372\004\317'\226O\255=)\334\335\260*c\211\"?\277\315\335MF!\257\331\245\020\001\222\305\036\341\2544k\255-\213\3769\333bB\254\326z\300hA\205\036\222h\321\357N\272\350k\277\224.\272m\033\252\261\225\354\341\347\257\344\341\016\361\357\253\266\320\277\311]"
+	.ascii	"\315\3475\037\205\371\273\346\353\232\237c>\256\371'\315\277"
+	.ascii	"1\337\244\371\266\346\2270\277\326|\222\r6\210U\361\202\007("
+	.ascii	"\253\222\266\325\272\344e\251\200\374\250m%I\246\244hM\322\274"
+	.ascii	"\246Y\323\372\265\344\261#j\326*\306&\331\323\231\002\220N\016"
+	.ascii	":\013I\312\304\007\256X\313\232\327\004\353X\277\2269\204{dc"
+	.ascii	"q\340\260 o\2544QX\253\030ul%\271j\255\273\377\301.\321\200\235"
+	.ascii	"`r:\323\376\177\2534\003\355\364\325(pc$!\275\3326\304\224\242"
+	.ascii	"\373\207Y\030g\356\232\353b_\310<8\303{\234I\027\355\244\343"
+	.ascii	"\025sA\00404\301\030\341\220\001\204\340\315\354\300\236\215"
+	.ascii	"0\250\363\223\tR\370\331\370t\"\310\004ib|6\301_\215\0178\314"
+	.ascii	"\361\365\006\\x\0033\364\351\b\205C\037MY\267\003TO\027\031\210"
+	.ascii	"5\270\240Z>x\234\001\203\025J\363v\215\362\302\026\370\207\215"
+	.ascii	"\273\255\244\216}\270\210\225k\035\256s@\256\317#\270\256i\365"
+	.ascii	"8\351:3\327,\342\302U\267>i\330\222I\337\232\2158\205,\315\254"
+	.ascii	"%\202\323kj\025@\246&]\323z\272\032\"3:\241p\332\372\017w\250"
+	.ascii	"qP\b\321\031))\217\3024\006 \003\021\021\0257\021\240$\310\f"
+	.ascii	"b\310l\264\334\202\224Z\003\022\341\221]\032Q\\\304\260!2\027"
+	.ascii	"H\302i\301\260\1771\030\f\303db\2005\032D\330\036S\227\312\""
+	.ascii	"\207W\263\r\313To\235b\243\004\017Ip\230+(\030yf\033\rm?\331"
+	.ascii	"{\313:7P\376l\346\244\331\2314\036\021@\323-\306\376Q\307\377"
+	.ascii	"\370\367Q\370%\373\307\342Z\352S8\244\311OFJ\201k\031\226\323"
+	.ascii	"\272\r!n`t\2618\240\211\266\007-\224r\360\314\007\347\205i\317"
+	.ascii	"C\367J\265meQ\222\f\305>\346\033\307?\234\247\343H\262\322D\034"
+	.ascii	"I\343\3662H\325\367\250\236\n\204\224-4G\177\324^k3\273\202\263"
+	.ascii	"t1\324?"
+	.text
+	.section	.gnu.lto_GPS_set_next_wp.116.6cb5756ce5f5905b,"e",@progbits
+	.string	"(\265/\375`:\005\r\037"
+	.string	"\026\367\277H\220XN:\300\245K\237mx\234\003<G\001\277>\225\347\321\037X^i\305\333F\0035\363s\205AR\331:\335\271l\270F\226\023\317\224\254\035\3208JL\261\t\006"
+	.string	"\234z\002\025X\034oq\230F(\255\021\262\245L2\241"
+	.string	"\241"
+	.string	"\266"
+	.ascii	"\274\224\3626\345e\312{\003\003rp)\321j\215\321\266\246\232\215"
+	.ascii	"S~\\\354\337\375\336\311\237\260\bc\261\233\033^l\317dsa&\324"
+	.ascii	"\275\226\303\022#\265\326\334\307]\250}\330\346\376\365%P\007"
+	.ascii	"[2\\\224\f\237\340\0301\304Z\253\202\217\233\204\373X\200rnW"
+	.ascii	"\230e\301y\367I\276e\236\313\367\234Z\261\224D\251Ux\264H\270"
+	.ascii	"\217+|\017\371\021\367\035\362\343\232\273j\027f\325CQ3\005\206"
+	.ascii	"\246\326\252k\0367\317\346\376]\007pVE\235o\021j\255\313g\325"
+	.ascii	"\214o\177w\017\354\256\203\335QJ\035\265K\3665\"\215Z\027B[["
+	.ascii	"\230T\255\277\003CM\324\317\022\024\002\344\266\025\352\241&"
+	.ascii	"\317\202h\272\205\372LN\257\250\241\005\211\275\356\0334C>z\025"
+	.ascii	"*'\2703\254\235y\357\256\321\247\224\001\322j\255\r\366Q.\205"
+	.ascii	"\267\327\372\270(\232\370g\023\233\263\370\261^\211\323\332\373"
+	.ascii	"\310\217\357\fkkTW?n\333\025\002\271w\354\236\326\306\332\275"
+	.ascii	"\361\026]\354Kt\343\035\272\361\nQ\336 \312\013Dy\177(\257\317"
+	.ascii	"\215\267\347\306\313s\343\335\241\274:\2247\207\362\342\\\370"
+	.ascii	"\337\234\353\307\221\274\344\310;\322\315\240\207\225N\3574\203"
+	.ascii	"\005\2119\215\323:M\317\202@\200l\270v\310i\312Fu\305\346mP\340"
+	.ascii	"\364\237\234\022\255\254|\2419\271\242\255f\302\323\224\024|"
+	.ascii	"\264G\033`i\254\212\370^?\343\033\273\231\222\202\257\214\022"
+	.ascii	"\256\326_\361d*XP\342\237J$\361\350k\345\251\250\211\tS~\230"
+	.ascii	"\365\021L\332\205\243\225\017\322\276lHJ;\273\327\275\3708\255"
+	.ascii	"\326\337\317]\f\357R\032\255\206s\331\200 \253\326\232\264\345"
+	.ascii	"f\034:x\360@~\b\301?\367]\277\217.I\352\215\216\332\242\336\227"
+	.ascii	"\035\313\222\355\265v\267c;\306v\026\0050Q\357\305H,\361\317"
+	.ascii	"\242&\302Qf&"
+	.string	"\025*F\354\234h\257d\352\247\035S\257\b\244^\311{\332-\361V\354z\272'\023K<\246\022\272\036o\327\244\023\341\244B\207D`\313\024$\234tOe\351\244\313\t\177\247\265\326\372\306Z\020:\314~\r\\\262\227ip\r\363G\020s\310\020\362c\203\235\305\261\311\376T\233\037\267\021\341\031f\021\\\255RI\3132\270\312<b\"1\267\314-\362\343\330\271\341\360\b\027\3030\225\370\272\236\300J\330\027Z\223b\220\021\277\240b;\213@\375\323A\335.\200\272\307x\352\247o\200TC\252+\237>\342\026e\200,\226\342Ih\352i\237>[P\013O\357tO?(\004X\306?\236n\250a<'\225BS\"\"%Ii3\006\220\002\221)\253n\021P1t\254\206\223\346b\360\301z\342\005\260v\277Q\272\302\346\355\331\330\371\251Ku\022z\273\313\201\212\316\264{\3436\224\304&\332\334&\342s\321lM"
+	.string	"q\373K\263\177\235\215\261 q\363\266\374\352\324\262\226\013\03070\272\270\005\215D\0313\272%\032\340\213\262\206\352 \006\275,\357\003\335\254\201!\373\251aBe@5\321\235\226Z"
+	.ascii	"\333\276\210\366\016\235\205\013\215\177O\351\312+\031\275<\032"
+	.ascii	"\006\233k\017$\244\356\242&\t\036\203A\250\b\351m\243\257\356"
+	.ascii	"Vdb\301\3215\344?~B\274x\376\326yl\346\233f(\301\370\225;b\211"
+	.ascii	"\201Z\005<W\024:y\247\275\354\f\0202\237\036\226NZ\006)\0022"
+	.ascii	"\n\320~q\364?"
+	.text
+	.section	.gnu.lto_GPS_distance_cm_bearing.118.6cb5756ce5f5905b,"e",@progbits
+	.string	"(\265/\375`\345\003\365\031"
+	.string	"F\360\247I\260XQ:\020.\035,\021N\003\002\030\376\310\n\301\3443\002\266'\022y\264\357\374\n&B\345\035\220\254\355\257\300\236M\375\321R\005Ok\337xYy\321\371\361\370\263Dm}`\346NJ#\0248\004\275\266}B\266\334)\005\225"
+	.string	"\202"
+	.string	"\222"
+	.string	"7F\240\036\332CN\344v#\007Q8\025\001\312*<\254\324Z\021<\264\r\365\360E/\304\307\307a\002\351)\202\241\341\307\224\013=r@\370\371\330\254\352\316\307\t\006\237\366u|\307\355>\237\317\324*\204d\244\326_\002\343\240\036\372w"
+	.string	"\342C\324Y\342C\337l*\377\325\250\247!\035&\212\262\324ZaK\343\267\323\2357\377\301\247x?\270S\026_z I\306\224\230\237\035\275\tb\302\342\301\317\336\217n\316\223\203Z\253'\357g\305\035\336v\004\333$l\032 \025l(\033\276\217\370\360ka\013\226\036Pn6\331?\334\334\031\366i]!\373B\376\327\201\374\004nt\273\376\373\007\374\307\177s\340\335\272\357\267y\217_\300N\327\3544\213N\323\320\351\031:\275\242\3232\341t\f\235\206\241\323/tZE\247]\350t\212N\243\350\364i\247\305\235\016w\232\356\364\356\364\334\351\033("
+	.ascii	"\224\324S\245\326\024ML\325Ixd\350F?\360E\036\264\n\350\340k"
+	.ascii	"\267\252\275\024\276\272\351Z\231\265e<\363\274\325\276J,\316"
+	.ascii	"\255\225Y\222II\031\263\376\222\007\263\031\245\207w\005fc\220"
+	.ascii	"\202G\341#R\253\347\256\326\234\201\227\205Yq\251$r\231\252\265"
+	.ascii	"=\320\304\363^\366\265[\234]6\265\252\275R\031\344Z\327\272l"
+	.ascii	"\370\244\265\255M-\311\024\004\265\247u\021%\271\022\007}\033"
+	.ascii	"\006a\340<\317\300m \245\205\270\247\235H\302\245+n(!\334P\251"
+	.ascii	"\007\224\233@\227\334\322\324\003\332m\355\233\224V\346~wi\223"
+	.ascii	"\362\206\216\302\\\252\364\243d,g\207\216\264\234\035\3123\316"
+	.ascii	"j1Y\206\023i\233\355\320\005#m\001\031\313\031g\244M\266#\243"
+	.ascii	"`\244) c9\344(\253\325B\350\250\254\2033\322fd\214g&\"6\302\310"
+	.ascii	"\r<\263\016\032`\343,\346\001\246S\263\301p\n\230\366AV\203\221"
+	.ascii	"4Z\r\246\372\325\257\020\206\027Nr\253\2435/\323E\214\033\211"
+	.ascii	"\310\332\232\265\300\004\245\f\322\375h))\306\356\f\333D\326"
+	.ascii	"\332\370\206|0\331M-f\255\177t\363\331f\024\232e\355\227J\244"
+	.ascii	"\334\t#\3255\2634\273Ee\220\016GY\343f\2653+>)\211\002M\250A"
+	.ascii	"L\206\214A\b\235L8\n\222\030Z\f\300\002\2212Z\007\020@'K\223"
+	.ascii	"\341\243\024U\003\342\231\016\306\0058\205A\022\001\236\036\343"
+	.ascii	"\215\352\326)g\255\240Gm\260xB\304g q\362\263JrB\321C\226R\b"
+	.ascii	")\266ra\024,D\nr\206\235\210(\341E\302\215/\240\204\016\371\\"
+	.ascii	"\221\232`\0311}B{\335\034\337SM\240\030\306@}\002\376'\212\t"
+	.ascii	"<\202@V\365oqxk3d-N\322\027\320o{\267\005j\017f\273\013\355-"
+	.ascii	"h\261\020P%i}\322\336\2246\324"
+	.text
+	.section	.gnu.lto_GPS_calc_velocity.119.6cb5756ce5f5905b,"e",@progbits
+	.string	"(\265/\375`\f\005\325\033"
+	.string	"\366p\252G\260TN:\331\352\r&\322\300\335\bS\016M0\206\340\220\250\006\314\265\237J\212\037\266\342\222\013]\251\237\325\321\260+\237\276\316\016\213\203\352\005|\037{_\274R\355\275\302\312\007\341\177\210\320\377\241\220\363\033\331\233H\231R\211"
+	.string	"\204"
+	.string	"\237"
+	.string	"~\211\352YT\207Q-\245:J5(\325\033\325\n\252O\340\002\215%#\260\314Y\242\214\313T\022\271b\274\352\253\252W\320\276\375\034\276\325u\234\212\351U\336\2325\231\260\365\250p\021\233s\026x\364\320\3541\300k\362\021<\216|<\315L\366\224[\271\230a\f)=\036Y\346\234\267mq\246\203\253L~\330\340\305\027\325t\020\305w&\352\t\f0\347<\216+\211('\325\260\301\234\323\352\213:q\307\333v`\033\201\035\241\002\336\272\365i\316\235"
+	.ascii	"\241}\027\236\021\247\3678\226\2676X\313Z\362Q\367V\037\320\342"
+	.ascii	"7\245s\316\246]\026\316\311\357\205+(O\252\305\376\216_\345|"
+	.ascii	"\030\006\241\323\373\036}\335n\212.dR;-\263\255\232tY\330\007"
+	.ascii	"\347\256\260_u\013Iu\220T\003\205\352\037\251\366\221\352\036"
+	.ascii	"\251\346\t\325;R\255\023\252mR]\223\352\034\251\306\t\3257Rm"
+	.ascii	"\023\252k\242\232&\252g\244ZF\252c\244\232\026\252a\242\006*"
+	.ascii	"n\026g\337\373\355\220\020\035\371\027\004\021\021\"\310\307"
+	.ascii	"\233U\360\204\013fm\326\346\004\205\325\373\321l\315\314\322"
+	.ascii	"\354\316\227\314\316\304,me\f\334H\221\030\t\367\"\322E[\232"
+	.ascii	"W\331\024\325\313\302\354f\361\220\b\355l_\266\347\noF\270rg"
+	.ascii	"{\336\214!\023\254\025\356y<\221\212+w\277xb\340\356\306\225"
+	.ascii	"]<\031N>p!E\2639\347\002\177\353A(\204\250\240\367UX\006/\270"
+	.ascii	"v\266\360\254\242!\333\350@\216\f\204\3159\023\370\370\017\f"
+	.ascii	">\214G#\341p\362q\227\346\365#\243\322\r\035rK\353\243\241$\035"
+	.ascii	"n\311\b\t\367\301(\351\266\244\001\t\307!\303-\tg\224\273\035"
+	.ascii	")y\270\r\001\260\256\003\006\245\333\222N\247t\243Y\315\357\n"
+	.ascii	"\317\230\324P\262['\007\225\375\270l\321\022DF\005\224\245\210"
+	.ascii	"&\f\213~\371\306\256\024\001\260r\004T\005hGH\001\231\242zN\212"
+	.ascii	"\035\307A\032RX6\254\200S\2448\361\215E!\252\271\200B\273\202"
+	.ascii	"J\342\033\373\3310'>\373\363$\357Y\037\236\325\331\236\235\345"
+	.ascii	"\001k\262S\263:[\275\237m\231\020\331\302\226<\270o\254\266\266"
+	.ascii	"\335\254\336\357\356\2229[\333\020\214w\003gm6g#\030/f\250AL"
+	.ascii	"d\025RB4\232\024\324Hk\260\002\031\241\272\016\021 %T\216\215"
+	.ascii	"i-\255\0013\234\300\312\270D\274B\276@\205\025\341\334\327*\033"
+	.ascii	"eB\006hi\222CbW\344\230\341D9\270\316b\275\"\367+0\237\212-T"
+	.ascii	"\247^>\205\034\260$b\307Z^c\317\345\226=\326\262\016!\300\242"
+	.ascii	"\304\220\301<\301\231 \216\305\233\315\257\316\263\f\217\t(\226"
+	.ascii	"\223<dy\267~1a\322\317\371\355.E\353B*\fN=<\036\272\343\007\026"
+	.ascii	"\375\025\314\017\325\270\361\001\303'/\250\367K\242\232>\034"
+	.ascii	"\323R\333$\344\222\323\256\005\275\313B\007\243\201\210\351K"
+	.ascii	"\202\374\277\343\341\207\037-\267\324}<\246\365R\016\255\312"
+	.ascii	"\005\370\316\031\200gJ\021~\033G\325"
+	.text
+	.section	.gnu.lto_GPS_calc_poshold.121.6cb5756ce5f5905b,"e",@progbits
+	.string	"(\265/\375`\215\n\2059"
+	.string	"\372e(\026=@\246N\007\243_Qt\270"
+	.string	"\254o\0200\027\247\177eB\227A\016\b\324\234\003E\323#]\340\270>\260@+~\321\315"
+	.string	"\277\033u\300<\210\322\377\222\321\313\f\217\bn\262e\267\224R\nF\0016\001]\001\252s\200\353\f@u6\252\316L\327yU\235\213\327Y-:_\3259U\235\211E\347W\235\375:w\n"
+	.ascii	"sL\230\315d\016\313>9,d\371\322\350\231\306\353\236\353\246\353"
+	.ascii	"gn>\201z\032\217;\312Fhr\252\214\216m\333*\023(GIH\303\341\307"
+	.ascii	"{\3769\345\204pC\205t\036\206\026\223@1\320\"\332\303P\244\323"
+	.ascii	"x\214\364\035>\246\2719\345\352\264\035f\"\r\207\243\0325\211"
+	.ascii	"0\033a~\322h\376Qj\273\216\303l\344#\r\207\303\232}lX\2265v\312"
+	.ascii	"|\204\331\330i\332o\272\216\215tH\006\337\352d\025;\345\226k"
+	.ascii	"7\311\236\343\274f\243\260\255\344\320\333\235@\226e\255:\345"
+	.ascii	"\253b\247S\ru;%6\201\333)'\231\035E\231\261I\264\336\336\234"
+	.ascii	"\311\241\304\262\354\361\301\2607\221\256\271\350\311^\213\352"
+	.ascii	"M\211\357In\252's\226\314$\275\022\241\306\300\275u!(V\210Uy"
+	.ascii	"w\320\256Sz\361K\224f\253U\37261\317\210S\255\247LL*M$V9\005"
+	.ascii	"Mib\226\021\241\by\371k<\355hL3\377\256\353\027ow\217\324\242"
+	.ascii	"4\333\325\020,\313\262/\231Q\232\231\232\231\3250\363\ff&\261"
+	.ascii	"\036\276\237\352\033\2754\201\236\031\3367\004\003\312\257\220"
+	.ascii	"\213\317[\n\246\177\211\357\237~z\327\272)\375\220\377\211\337"
+	.ascii	"g\206|0\366z\220\214\0315j\334N\377\271\024EK\274\177\327u\n"
+	.ascii	"\327\354\263\353\233cH\342K|\267{#^\304\223\370\277k\341\224"
+	.ascii	"q\330F\013b\350\0267\240\016t\303\353\353\353v:\342\245\304\314"
+	.ascii	"\365\213\370\216\323Tp\006)\373\236\201d~\030\243\377 )\262,"
+	.ascii	"\233\201\273O\373\311\301\335\326)\357@z/\221\267\323\376\260"
+	.ascii	"f_\\\224\314\017=\257\355\257\322?\0333\235\322\273\307\354\221"
+	.ascii	"\242\204\177\215\371:w]\347\022\2533\211\325y\304\352,\342:\207"
+	.ascii	"X\235A\254\316\037Vg\017\327\271\303\352\314\341:o\270\316\032"
+	.ascii	"\256s\206\353\314\265:o]g\f\253\263\326\352\234\265:_X\235\261"
+	.ascii	"Vg\013\253\363qu\276Z\235+\\g\n\253\263\325\352\\\265:OX\235"
+	.ascii	"%\254\316\021Vg\b\253\363\203\325\331A\3435S\255\316\r\230\234"
+	.ascii	"\031\254\316SR\327y\301uVp\235\023\\g\004\253\363\201\236k.\320"
+	.ascii	"t\315\004\212\316O\327y@\321Y\200\352\354\244:7\005z\255\333"
+	.ascii	"\203\307z\b\177\365Z@J\252\177\360QrZ\347\233\2331tC\2255/s\245"
+	.ascii	"\203W\325\006+5x\206\266Z!\037\037\3132\210\303\303\3022\226"
+	.ascii	"%\243\242\372\326c\360\r>\n\215\263\3114E\226-\333\3426\354\303"
+	.ascii	"\344\232d\\\262M\262\315\355\224\301s\251\001\306\315\221\035"
+	.ascii	"\370\251\357\026\020\202?\360\367\256\rT\360\375\b\376#\265n"
+	.ascii	"J<N\272\351B$*\322\374,\235pJ\362\374#T\360\035m\277\223\346"
+	.ascii	"\347t3\307\364\3057~wx\246\016\377\241\r\260\335\343\360\224"
+	.ascii	"\334&I\352\245\340\206\347\360 \232(}6\f\257\341\331\333Ae\023"
+	.ascii	"b[3#>\033gx\256o<=\240N\355\314\222\241\2752'\344\254\317\260"
+	.ascii	"\365\\[\177\363ZA\255\307\360~\251\335#K\276\351AHZ\237\025M"
+	.ascii	"\0247w\341+|\326{"
+	.string	"#\254\267\360\027\376^j\341\224\035\330\217\030\312\335\306\"8\217\367\222\363\334N\261^\275C\273r\374\253\267\360\304H-\234\222D;jt|-E\353_\005\222\331a\023\315\210\241QimN\271E'\032\352\355\351\347\224\363kE(T\254`q;\255\360m\247\275\231\326\346t\243~\377\352\247u\206\370b\327\225\346\037\210\017\361\341=<\210'\333\350D\210n\264\370\372\020\314\343*\b\2171/\037\307\037`>|\200}%\020\3131\326\003\331\205\003\031\266\342\350 \310\"^D\376\272\372\001\206\034\363\332\201\034\342\365\3438\306c\007\262\207\216\343\017\244\227\217\343\227X\220\343\225\024\203\205\345\020;\216\201\201\211\035\215td\375k\\4\364\210\217\354\225\353\263\361:F\225\372't\253.\360h\005^e>\327\330-*s\302&\026\237\215\235\236Z\234\327\252\233\236X\362\244\013\236\300\2431S\350\002/\365OvL"
+	.string	"[\247\222\331\204wa\250\001?.'\234\374\334\351[P\210Yq;}\362\342d\322R\360\311\263\300h\n\343Xd\220\251\221\340\237\276\353\372I\217\007\035"
+	.string	"\237\340\257\244\003l\006<"
+	.string	"\001?\340\215^\234"
+	.string	"\236\031:\275\200\2467\276\3237\201o\"\366iJR\272\332G\215\334\3755n\241\206\250!\205\331\222-\200\317\365\033\036\r\253\201\334"
+	.string	"/f\247\367\037\240\2609\250\354{\022\206\271u\375\202go%9\351i\316\273\024\276\353\233OSE\345<\231\364\034\264z\nU?\341\255\376\363Z\2702>\305\245T}\032\235\0247\307t\203\362d\314L\337R\320\233 \211\252\322\306\004-\215F\252\224e\302\237\361%\f\215Rr\346\215\226\202\022\336\301O\370\024Q\353\214\360\020^\302#\220\323\3029\370\251\217\360\n\002\200\314\250a('\2252\310\020\221HRP\220\2441\200\002\021\"#r\003\020PUD\222$\205\016N\265\316_\334h\034\224\242O\260\367-\034R\f\200\212\211,-;r\304\2754SYTX{[\251\004\313\232\315\235\365\366\265\306\032}\327\367\304\036\313\372}\0243o\222j\262\246z\310[=\203BtpJ\221\227\356\261}\264\006\254l\023\254K]\307v\313A\344Z\302\362\240k\024\203\312\262\350"
+	.string	"@\210\303\177\022\013'\254\264\n\232\030\372\235t\003D\2012&\233\220\236 \224!"
+	.string	"\272C\\;\247\037\322\365\204\252\255\243\"\243\245I\373 "
+	.string	")\034\004\353\270\205\242\233\243G\023\264\256\216\225a"
+	.ascii	"\321\371\264\025\364\303\307\250\005\371\207\307\261\001'\304"
+	.ascii	"\314\356\305\237K\227\003f\217o\001\233c\242\241\365\204N\340"
+	.ascii	"\325\247,{\206 \324o\367:\272[~\237,\276\360A\f\205a\235\210"
+	.ascii	"\211\202\370\037z\036f\215\177\n\347\273H\210\375\002\326\303"
+	.ascii	"\354\250d\0034k\017\305\013i\243\3008\250g\022*Em\203\214\376"
+	.ascii	"]\3448\342[\007\322\353l\230\333\270j\365\031\365\035\017\215"
+	.ascii	"\n\333\252\030\017\001\036^\223y\020i\306n\324@1R\272\211\240"
+	.ascii	"\206O\256C\375d\370v\230\004%\001-\311he`WX@\273\256\214\001"
+	.ascii	"\304\003\217\320\361\0014K=,\016\270UZ\260\211\036\247\341H\200"
+	.ascii	"\001\313\rr\310\032\225h\312\332\022Y\356\212w\363\314\225\311"
+	.ascii	"\377\371\021\304\020\300\004\325f\007\252\260\005#CZ\024\327"
+	.ascii	"\311c\367M\257S\001"
+	.text
+	.section	.gnu.lto_GPS_calc_nav_rate.122.6cb5756ce5f5905b,"e",@progbits
+	.string	"(\265/\375`!\013U<"
+	.string	"\212m\204\027<@\346J\007\341\215:\367\277\221\254\026\001\260G4\330%\b\r\206V\261\315\311[\374\211F\033\350\275\244\035R\261\203\3549f\237\356e\336\271\204\343\350\221TLP.\321\222\270\367N)\245]\001A\001u\001\f\340:3-9\037\257\363\322u\276\356l\274\316J\327Y\275\316\351uF\215\316otvw\356\025/\227\210MO\361\r\001Y%\213\222X\302\324\331\245\357t\237\351N\323\315\246Q\346\346\266\323w\270\361\360\361\271*`\003d\361\264\266 \3669\342\321n8\235#X\307\354\343\301\375\344#\217\256\303M\243\332\022\2516\320\340\2271N;{\364\034F\302\3451\373X\226m\266\034\264v\303Tu\342\320\230{p\277i8\314G\376\321n\370\305\262y\374\301|\354\364\033M\007v\033>\252\3515k\263\t\202\262lD\350-\346}"
+	.string	"46\224\232\206\233NX\310\013\221\r\306N\271\001\333\314\332g\370\331\354\033\333D"
+	.ascii	"y)\202\310\262,\204Ny\313\330\251\002\324\231\273\257\375\326"
+	.ascii	"\376\023\302)\313R\301#\207e\001\255\370\312\330i\200\216R;\365"
+	.ascii	"\206R;\345\225\371\320\324\020V-KoR[\240#\226e\221\177\205\275"
+	.ascii	"Q\300f\325\327VRS\364}\345f \327H\351\246\326JhT\226=\275&\267"
+	.ascii	"6\264\352)\330\3546IW\365\340:]rs\322(Z\305\334\323\244\311\215"
+	.ascii	"\r\215\362CW\250\235\355F\334\206\370w\233N\351\226}\224np\355"
+	.ascii	"J\035X\226eW\272\2755\033\233\231\337\230\031\007\363q*j\247"
+	.ascii	"\307\357@A\316\373J\277\364m\374\373\335\":x\343\247\201!\214"
+	.ascii	"J\337o\3138|\3165_|\177\342\025z\364\254FP\241zI\237\231\255"
+	.ascii	"\272\r7\231\016Y\226\335jC\312\304(_\360\314-\\x+\323oG\205z"
+	.ascii	"\204l\315\026\243\366\205\220e\231kq\361\220\215e\327\030\240"
+	.ascii	"\277\340\373\331\356\375\243\217>[D\177Vs\327\274G\375\3576/"
+	.ascii	"\351\213\334\357\337m\212\334zz\017\fn<\216!\303[)C\355\264\237"
+	.ascii	"\305r\315\243\2705_d'g\2361\346\255\344\007\205K\302\344\253"
+	.ascii	"1\003&\375\355\230\273\263\320aB\204\277\016\205;\233\270\316"
+	.ascii	"a\327\271\304u\006sg\022\327y\204;\213p\347/w\366r\347\256\353"
+	.ascii	"\034\302\235A\\\347\017\327\331\303u\356p\235\271\2563\207\353"
+	.ascii	"\274\341:kp\347\f\327\031\303u\276p\235\267\256\263\205\353\254"
+	.ascii	"u\235+\\\347\254\353\214\325w\232)\\\347\tL\316\022\2563\362"
+	.ascii	":_Y\271s\225;?\350\277n\007\235\246yA\237iF\260\344|\300\235"
+	.ascii	"\r,9\0278:S\035\235\247\216\316\004\216\316R\356\034ut\036\340"
+	.ascii	"\316P\356\374\264\344,\300\235\003\270\263\323\222s\323\365Z"
+	.ascii	"\324N%\274\2059D|\177kW\217\374n\363<\370\253W\005[\304\252\207"
+	.ascii	"\372\007\377\213\332\274\344\035^\267x\013\003\f\356\320\207"
+	.ascii	"\3249[\3257\236\3667p\207L\277?\251\037\360\004\276[&\211\227"
+	.ascii	"\"\361\034\360\020\265\203#\336\327\362\\\315Y\021?\242\201\263"
+	.ascii	"0};"
+	.string	"\020\377\345\307\256n\b\372v\354\365]\337\316\366\270&T\344\336\374\031dsH\354\341\275B|W\210W\237m\342\207\007\361>\251\035\\\353\322\212\223><\226\263\220\357\257\303kx\017\357\206Z&\327s\370\016\257Nj\367\222\220:\0227W=\216\343\255\3448j\247\\\257$hD\016\3547<\207G\027\265{I/\355\250\321\206\317\022\364\267&\207W0\275\210\233Spx\314>E\253\030'3\202T\230}\211\235h\345[\311\254~k\031\265S\r\337r\332\343\340\360\230~\177&~\300;Z6\321\030\256Q\f{\023\337\355`\211\007\373\260\177\301v\017\016{hD-\356C\215\bD\327\027\367\227\332i\211O\200\345\017\354\033N38\323'i\250\006\021\352\217t\313E\001_\b,\352\220\320\210V&>\275\200\3576\r\365\004\022\347\364O\2572R:l~\252\001\336\351\331[EM\037\340\235\222KDm\212"
+	.ascii	"\276\351\377\331\0162\375\322\0038>\323\253\206ZDC0\356@]\030"
+	.ascii	"\306\215\327)\237H\221\"|\343\n\355F\232X\031R\207YY\231\331"
+	.ascii	"\214\002gci9\310\274h\220\355\2706\310\316\322\320\035eci(\032"
+	.ascii	"\031\0201\224\306\330\330\0164\031@\304\312.\317\270\322aF\226"
+	.ascii	"&f\203\314\207\230\016d\332\r\033d9j u\220\211\225!g\234\241"
+	.ascii	"!\257\022\260\331\216\2613d\232\231\331\031\362\b\270\326_\307"
+	.ascii	"\306B>\204k\237\344 (\313\316q5\233n\3043\276\250\364v|\263\244"
+	.ascii	"V\377\220\034B#x#\214\340\371\216\024\372I\364g\020\233Cj\006"
+	.ascii	"L6\252\276\035\247\b\203~};\373R\231\263dP\227\357z\021o\204"
+	.ascii	"9B#x\253\177B\263\354\3232\223|\307\315\004wWV1\007\356\334\316"
+	.ascii	"\255\254|\313\325\317O\355T\n\215\234\341\001\247\003k\272\363"
+	.ascii	"\2710((\376\300\023\237\033l\242\036\005\2011\006>\252\300\033"
+	.ascii	"\370#\235\\\2376E\252/0\365\004\236*\303Oy\331Y\326Ib\370\f\027"
+	.ascii	"~\3531\354Iq\246K\271\360\251\263\021\337\037\224<\271e\032\027"
+	.ascii	"Ce\"\324?\2011\365\004\017\316I\352\\\364(\312\326Oq&\334\234"
+	.ascii	"zssC\312D\013\217\365[\237\006j\231Z_\341-<U`\273\207\365\310"
+	.ascii	"\327z\003|\332\274\254\347\372\n\257\362i\363$)|\326O\005\266"
+	.ascii	"\314*\256\204\233\030\236\324%A\202\365Js\212\036Mxn\366\234"
+	.ascii	"$BI\024\276\371H\370\t?E\347\312\325\316\310\262lZ\354D\274\310"
+	.ascii	"z\005\313\252%\200\316\250Q(\007\021C\n\t\315\210$I\222\345\200"
+	.ascii	"\002\221)+n\003\021\240)d&C\222jv\003\220qt\334Z\242'\021I|\f"
+	.ascii	"Hc\244\222\207\224_\n\313\375\265\026^og\304\204wbQ\363\231\t"
+	.ascii	"\311\240p<;L/9\211YND\236A\375t[\314k\237\033\333\272\003\302"
+	.ascii	"'\024{\247\360CzP\013\"\241\341\374j%\"\264\306\r\221\226\036"
+	.ascii	")jH\356\232\332 z\324\224\fI\212W\360_5\215\355\220\351\276R"
+	.ascii	"\302\356\336\310\255\233%]j\252|@\237V\311(\312_%\004\020d\372"
+	.ascii	"~\270t1\372E\335\216\003p\016V\357\356\327\013:\216\306\360\302"
+	.ascii	"K\304\177\013w\310\262d\344\\\367C\033N\013\301\263f}\330\b\341"
+	.ascii	"\033\003!\342\021\264\321\232h\022\336\243cg\037\255\003\263"
+	.ascii	"\253\304\025\232\276\023D}\361\2037J\273\241\311\006\035b\264"
+	.ascii	"~\201\322j\205\202s\237\327\240FF\310R+j\361\232\265\333\317"
+	.ascii	"\335\244mh\240P\367\310\312<\345\233\n\340\350\205.\2155\346"
+	.ascii	"\220\033\240vc\316\342\240)jLX\366(\341\017\263\024\356\t\240"
+	.ascii	"\261Nq\271\016\006\366\353vp\354C1\325V\331o\32783@\367V\213"
+	.ascii	"\355X\204H\246\b\240Ap\240.(\214\023\230\264\214D\372\337\337"
+	.ascii	"\210\323\320\250\257j\352e\216\273q\341k]\274l\366\225\304'\307"
+	.ascii	"\034r\257^B\rU=\354\022\332\355\371L\227'9R=\373l\003Pm\214\372"
+	.ascii	"\215*s\211\3508\001g\222?\300\bw\b\020-\273\277\356\200\312{"
+	.ascii	"\320R\023\370\376"
+	.text
+	.section	.gnu.lto_GPS_update_crosstrack.123.6cb5756ce5f5905b,"e",@progbits
+	.string	"(\265/\375`V\b\205*"
+	.string	"\352F\300\017I\200\030R:\177\t\r\247\t\322\360\237\024`\360\323/\201\002=\034\240gC\331\203q\330]\216\021\306\242\326\033p.\333\201-j\375\006\200\210\317a\210hX2\331\021n\376\005\306\256\243\357\376\325\336\205\376\267}B\b\331r'\031\350"
+	.string	"\327"
+	.string	"\356"
+	.string	"`K\377\"\n\217_k2\215Q\265<\360\223\255e~\220\013Q\372\027\361~\255\311\0363\253\314\013\301O\006R\177\n\017D\177\336\373\320\237\314J\314\271\2377\307K\314`t\232\326b\002\035^NE\314\254\353:\354\031_\272N0\007\370\363\365pnlx;]\016wSS\364\274m\227\370\267\247d\361:A\256\347"
+	.string	"\323\242\264\316n\330\237\326}6\256\360\254\206\355]\003kfe\236\026\205\343\002\241\264\236\336E\303\342\244\016nl\260\\X\036\326wVa-\254.u\320\365\036\030RY\317\341\252V\330[\017\f\251\252\253iQTb\357\311\0215e\323\273c5\005\305\323\242X\334\002Vbxy\227\223EOd\223\275)\336\274\344\361\n\327u\375\221[\022I\243\265\251\203u]\331>%\245\316"
+	.string	"\316\374-ff\300\234V\b=ebF\221\215I\345h\333\330\366\273\373\310-\243\023\"\333\267\243\275\t\221o\2039\024\331?\025\241?\337\n\250\252\370\230b\262M\346/\243\355+\346w\263\331lr\313`&\360\363\262\263O\217\360`g\236\001\002\256\345"
+	.string	";';\007U\313\300\237j\331\367\261s\357D\3168\252e\336\265\274\273\226u\327r.\265\214;-\337N\313*j9=-\243\247\345\363Z\276\327r_\313\366Z~\001\035\033Y\362Ua\326\025\252\231f]\236g8^\366\203\375D\376\261\237\214\237\344g!\276\204ov\201\nK\2312\304\2254\226\013T%d\254\264\3134:\204$PC0\347\216\030Q V\004\335\372*\265~\304\030\035^k\007\3620\245{\361\207\340PPU\341Z\3275\307\017\313u\345\006\315\246\226\343\2722\375\234\035\354\253A\346\350>\373J\256\246\305\250j\"\327\230\260\332\326\312z}\305\366\306\327\030V\344\200\315;Byv\212\313\321\266]\2340\033a\363\345\355x\272\247\302\227\023\321\236\366\005\271\0216\023"
+	.ascii	"\341\302\262\341\361\260\226\266\265\262]\230\275\031\031+.t"
+	.ascii	"b8\234\346{S\177=\240I0\377\2348\021\035\320@\bb\250\252\030"
+	.ascii	"\325\306~\030m\223sR\336\215\323\344$C\306\236\340\242\374\326"
+	.ascii	"WP\336\375S\321\004\265"
+	.string	"\245>y\367\305\376SDc\013\273\325z\262Z\246}\305?\362\007L\312\234;\315\367\252ix\264pR\266\200\3565\t\"\332\353w\275\300\231\022a\300\330\230T\032\265T/v\232\353\272\256\247\b\266\255.\242\241\t\233r\264mW)\313\362\334\004\355\026\320)3+\f\322\312\370.Qv\"\332\001B\035\206\214\202N\017EBI\027\351\b\tI\350\344\f@FGDIACD \202\214\206I\033\206\210:h\030\032\021\005\025\r3 }\030\002\361\360\221\007!\244a\322\321\021\3220\367\305\364\273\266\fU\255\305\222\251\215Wg\255+\213\223&\250\255\340\331\0378I\001\374i\276?\034NJ\237O\023 \320`\"\\\311o\024*,F5$brv\375\323)\263\206\322\307\f,\0138\345\273\356b\023\346o\327>\2352i4\031\r\b\027\226\217\210\356\372g5t}{\327GZ\031\273\350>#kj\203\221"
+	.string	"}\033-\023\344\312u\200f\213\034c\314u\216\221\205\322i\r\256\371Y\256&a\002\005\nObn\215\353n\202\244\2426\332\267~\332j\037\271\306\374\025\013\030\202\202\320\237i\003m\341\331`3\013\r\331?\241\335K\265\344\362\330Ef\345{\024w\004\200\273\250qD\005\215R\206DDD\322\024\244\320\001\300\002\221\251\261y\022\340\3464K\035\224Z\220\032\205i\177\003#\260\335\001\322\355\320c\360\006\301\342=\344:\342\030\210\006\302\320j."
+	.string	"\"mt\030\2647-\244t\267\247\n\214\373\267?\340.\232\256O\036j\212D\223>\024\226\260\277pv\253\373\202M0\263a\311\274R"
+	.string	"1\365\340\027\214\326nx.;)\2371\307\0063%\367\274RB5\226\323b,\301\021\326\273{\272-WW\230|\016\205\373zq\016\n[Ig\277\023\"\b\210\021\035'\235\336\032\211\245\324\212r\027%\366\3113\203e0U]\017l@\007\037\367\313A<D*\224\035\214*\357\277\206hb\265c\301\323\307!\300S@\020\343\264o\331\314m\220\235|\304\221g0\353\353r\016\353f\224\241b\004"
+	.ascii	"\212_\200\344\326\265\237!Y \013\005Z\214\"F\325\033\007\032"
+	.ascii	"\230>(g\260Mi\200T\314\375<)\313\257\227\371\211\266\313\365"
+	.ascii	"\3067\317v\\\013j\276\020\360\001O\373\2369\325!\0244\233\035"
+	.ascii	">\222\020\365\223h\034(`\n\227p)\376=\310\351:\023QD\020\027"
+	.ascii	"\250\321 \203P\321\004H\017\347\273\355L^\003\221%\241\207\227"
+	.ascii	"\264\226[=U`%\333\204\376\001"
+	.text
+	.section	.gnu.lto_updateGpsStateForHomeAndHoldMode.127.6cb5756ce5f5905b,"e",@progbits
+	.string	"(\265/\375`\030\013}4"
+	.string	"J]\364\023?P\246J:\377O\364\257\270\232\370\001\212\021o^\336\367\377\3172\253\266AD\033\314\333\027?R$fM\251\0030\004DD\323w@:"
+	.ascii	"[\255;\260\205\257\242\367\241\264\332h\204\264M\244\224)(\001"
+	.ascii	"\003\001=\001?)\337,\371\302\222O)\277\244\374.\371\\\362w\204"
+	.ascii	"R\225?o\033%Yk\220d\243\nH\377\246,\337n\231\335\274]\275-\377"
+	.ascii	"\365\3533c\026'xe\314\2229[/?\317\376\335\3330?\361:\326\313"
+	.ascii	"\027\214Y\\ q)\337\227\034'\232\333\351\006/\217Y\307~\311\361"
+	.ascii	"T\227\255\016/Nk\351\275t\374\304\245\345r\331.'\352\335\257"
+	.ascii	"\254b\326\016O\214]\327\271\364\253e\267\360\330\274\373m\205"
+	.ascii	"\253\f\370\007o\314`\255\025k\351\267\316\245U\033%\\Z.\224p"
+	.ascii	"\351y\374\201V\217\256N\341\345\255\361%\252\265\032\373\311"
+	.ascii	"\362X\247&\246%\245$\"\322\3604\205\264l\346\361\035\262\275"
+	.ascii	"\241\255S\223\231\301\212\t\034\224eJ\262Kr~IX)\t\311\021&Z1"
+	.ascii	"\201C\262HF\312\252\2768\036.\023\270\"{\226\016\344\344\b\331"
+	.ascii	";nD\312(;M\376,\231\265\272s+\302\246p-\f\222\351\220-\227\336"
+	.ascii	"z\204Q\343\276\343FWV\325Z\267\313r\333\333\221\331\314Pk=\263"
+	.ascii	"\275\301\355\237\366_\b\377Y\374Hg\001W\261\202\227\355BW\251"
+	.ascii	"5\332\357\267@\034\375PR\217!\231<\244Vk\332Uw\331\213\274;r"
+	.ascii	"\362\334\335\213\034D\332\242p\233\233\035!\263\034\017\266k"
+	.ascii	"\302(\320\375-V\315\013\255=\265V\2564\373'\366\255[\372\030"
+	.ascii	"c\274lK\277c\302\245\333\273&.\017\226\2744N\376zG\356\271\177"
+	.ascii	"\313\332N~\223\017\342\303\226\331{\3302\373/\223\317a\371\366"
+	.ascii	"\033\226o\257a\371\366^\233\267\307\260z\373\013%\337\002\345"
+	.ascii	"wQ~\005\312\347\242|\n&\177\202\311\227P\362#P>\004\312\177@"
+	.ascii	"\371F\312\337*\371Z\224\237E\371X%\337A\311o@\371\f(\177\001"
+	.ascii	"\345+\240\374\004%\037\001\345_Q\376\001\312\267\242\374*\312"
+	.ascii	"7@\371\005J>\201\223?\340\344\0138\371T&\277h\362\247J\276\224"
+	.ascii	"\311\017P\362\243J>\200\223\017u\362\237N\276\223\311o2\371L"
+	.ascii	"%\177\311\344+\225\374$\223O4\371HB\376\220r{z\300\310\0359\211"
+	.ascii	"\324s/Q\345\2340T\222\306M0\210Il\016\335\326g\213\275}S\035"
+	.ascii	"\240\213R=u\310\220TT\007\310ZB\203\242z\377\342\004\261\374"
+	.ascii	"\001\350\301\260(:A\3136\b\252\001\264SC\365\"\3458\364S\263"
+	.ascii	"\241\265GiN\275]\026\304^]\235!R{\365\204>#\013\321-\032Ds\366"
+	.ascii	"\3347\314vPsH\250\241_\322\263\021\036\2225\277rC{u\233\027\231"
+	.ascii	"e\"B\224\024\331\303CG\215\027\231\\D\211\206\344\365j\255\302"
+	.ascii	"\035\204\354\032m\r\243=9j\274\210\352\020\004\334\263\0216\365"
+	.ascii	"\2066\361@\021\204\224;n\255\265\226=\347\003\315\346\0206\365"
+	.ascii	"\206\331+\2645\204\366\3500\265R7u\367!\355\226\232\211\317\236"
+	.ascii	"\257\245\336/P\376\222Z\251w\355Q\032'\265V0\254\353\233g\003"
+	.ascii	"?\204\020!B\2704\251"
+	.string	"'\360\371kb/r\320\260\221z\251I]\235\265G\\kE\353\236{\t\341\260Y\354\365Q\343E\377I\254\235\022g\255j\\\337:\013h\342\004\n^6\024\302\245\303\266\021\027\210\345\354?\005\006\263Oa\233\313fi\013\343\300yC\025\345=q\331\017\207\261E\003F\r\2601#Y\331\330XY\030\225Y\231\231Y\013zF&Fc\210c\305\r\260\263\0254\312\302\206\017\333\"+\023\253\001\366B\314\006\030\231\261\006\214\027b2\\\030\311\304\300\306\214af4\214[\006^6\243\205\231\261FY\231\231\221\250\227\266em'?\375X\001L\353\243\223\205 @\272\332B\205\356\352b\037WS\350\n-\234\263\325\\m\006b5\205\206\302#\305/\002\2671\033\204\216\360\240!t\221\317\330Y\375\240\205l\266\332\250\325[m\316\311\3425\244VW\340\363\227\206\325Y\016\032\253KC\310AV\343\243\203\006K\332"
+	.string	"\312miZ\222\320\353\247Dl\020\335\3667\320b4\256\f\272A7\240\005\315\240\251"
+	.string	"!\357\024t\202^\320f\037R\356X\325\n\272\310\207\274+\320\tZ\252I\035\"\004\216\032q\270j\004\335\201H:i\2344#He\321\201\276j\252@\344\235U\033\350\003m\362!\355.tU[U\365\224#\f]\240\r\024h\251c\235 \344 \201V\224h@\023\020\320T="
+	.ascii	"D\013\240\322\303\364\325\022\226\372\222<\364K\"\322\207\376"
+	.ascii	"\372\362S\3529@[l\017I\177\266H\3549?[\354\017e^\334\231\200"
+	.ascii	"\316\250Q4\204\215b\304fFJ\222"
+	.string	"\202$\255\001\300\002\221!\"\323\001\021\360\250d\316\030\311LIA\352\fk\375\304\321\222:\3530*\"aD\313^Vz\324\273\356\243\334\222\324\021\334\250BKQo\211\224\351t\306V4\211\352\251\003c\331z*\216\r\031\030w9ww\336\266\006\340\216\321U\346\301y\351Rw\bI\314\f\322Q\316\276Y\265\331\025n\307\323v\303\177\304\034\373\202h\254,\005,_5e\364\206C\017\231\345\212\026-\335\301\"\201\303\276\356\363E}\332\264y\270Z\267\206\001\234\206\253{\274\334\342\372\247\036F\327\256\206\022\367\017p<\327\002\262\211_\361\3262#3\347r\204\210,g\204Gd#C\264\3314\207c\246\243O\253\351'\271\343\224\210\246~\310\206\365\206Z\331\275\302Sk]\351\202\b$\212r\265\\\007yR\361\366\274\202p(\366\266\207/\352\265Y\244\243\362\177|\027\216\2310\027\263\016\270\206a\316\032^"
+	.string	"\353hMYcI\345%/Z \300\275\016\240\036\274\242\361\007#\220^\004&\2627\205\212\317a\247R-\t\314\361\344i[\"S\fj\243\273\224\253\320L\354\320\223\007\305\233Qd\370K  \222G}z5\377E\016\245&\215\315B#\340M\315Hh$-\232(\273\374\217\206\357QD\217\261\022Z\310pl%\243\264\3006\340\214f"
+	.ascii	"\002\305\216Ib8.\367\265$\016\235Q\212\253`2\"\364\017"
+	.text
+	.section	.gnu.lto_updateGpsWaypointsAndMode.128.6cb5756ce5f5905b,"e",@progbits
+	.string	"(\265/\375`@\t5."
+	.string	"\352K\344\020F`\\N:\275P\311\305x\341\273\252/\322o\006\364lX\024zV\311\2241\375\320\013e\r\315\021\323"
+	.string	"\301\006^\r\022\021\3502\370\242\206\023\303/\362\001(v8i\211k\030\306:v\354knf\326\022B\266L2\363"
+	.string	"\353"
+	.string	"\376"
+	.string	"\315<j\3630m\026\246\315\3017\003\323\346_\332\274\276Y\275\315\351m\276\003\001s\330\320P1\223\273k\234\255V\264\257}\252]\310\272\257\366f\376\233<\344\005\f\330\253M\031Q9[\255\225\310\330\236\332^\333:\223\256\362\022\360*\263\314vw\206\265"
+	.string	"\314\342\262\252\354\265m{\274G\316\236hH\310\030\004\364S\364\351!\362\f\205A\340oU\323\333,\3777!\230\344\242:\021\331\207\310\226\264\320\222\033\311\224t\320\330\201\312\266\306\316l!\351\037!\227\217\027_%v\237\257\260\356!~\225my5\317\262l+H\017\227\312\026\036\201\345"
+	.string	"\362 \2207\177T\266\325\325\300\026\373\317\307W1\031\255\376\030rau\232\"\300s\323\023\322Z\222\034r]\365=\263\225$5j\333\366\315w\r.\253\356\337\204\266m\271\223\\9\316"
+	.string	"\316|!\314\f\201\031\b\"o\025,\\\270\260^e\306\220\341\316\023\313h\003\212>\242.\236\303\312\334\301C?\311\215\205M\035\342\236\322\315\212\264&\005\301\330\350\212GZ\327\233\244\345[>\200\020!b\275\272\336\367"
+	.ascii	"b'\r\301\022n\207:\265\252\027\212\255\256\330\3027\255\314#"
+	.ascii	"\234\372I\365\036\312&\316\363\352R\361\227&ZXz\231\234\036\271"
+	.ascii	"\246\267\221\260\3111\233\270\025$\260m\333\006|*\257\362\304"
+	.ascii	"Wr\225Q\250P\261^M\257\022\335ZUG\377{\231|\002k\200\373\346"
+	.ascii	"\201g\330\352\256\232\016\367\t\254\277\001.w\326\017\253K\271"
+	.ascii	"\023\311W\302-\242\372\311\253\374\250\365\352\257\352\366\026"
+	.ascii	"\266l\376\250\352(\263\323\252/\223\3717\032\215F\371\026aN\233"
+	.ascii	"\223\322\346\003i\363Q\332\\t\233\003\030\257v\016J\233\201\336"
+	.ascii	"\374\2236\027\325f\037\265\271'm&>ik=\227\016S\001(_\205!\027"
+	.ascii	"\322-I8D>\207i\t\312,\363z\354\221\004\320\253rz\356\241(\303"
+	.ascii	"\360\255y9s\007\250\335\2306R\026\206x\240\214\215\316\350H+"
+	.ascii	"\361\036xC\274_*\277\360\255}7\364x.\223yn\337I\352\341ef\223"
+	.ascii	"\260c\375$\3175\022\336\341]\301d\335\251\352(\331\355\330&\300"
+	.ascii	"\266\275j\300os7\254\023\326\214=;[\257\n\257\0033qB\226\315"
+	.ascii	"\341e\362\363\316\272\262\332\202\377\324J\302l.\253\r\370,\017"
+	.ascii	"\2725\236\345\300{\260!\360\032\255\310i\371\360\256.\225\220"
+	.ascii	"\325h!\352\273\235y\203\335W\3602\333~t.\377\335#4\277\033\034"
+	.ascii	"\002\307d\331\004^\346\005\340\235\221\371\365\331\264\225?\367"
+	.ascii	"'\233\306Fa\233\375$\333\\\257J)\251\240\345\031\365\327\036"
+	.ascii	"\247t8\246\be\276\3661\024\214\320\266\255z\222\231\023\\\f\223"
+	.ascii	"RX\333\266\017\302</\220\032\\4i\220r\212r\202\032\362\210\245"
+	.ascii	"\025\310'\251&\023O.\232V\034\245N\230xJQ\342\270\342\251I\305"
+	.ascii	"q\004"
+	.string	"T\324q\251\210\221,\234\240\216RH$\324q\350\254z\332\336\"\f\274\233{V]\253\264m\333\226\350A3\263\\\254\016,we\236Vgb<\222C\306\013\340F\035\2528h\204\204\204P\336\355\345!\325\016\275\213\362\033I4=c\021\020\016[\235\202#\255@\267H\tt/\007]z%\231r\345-\3502\353\336\265f/\217A\023\317\372X\231\331.V\371\346\217\303\n\337\223\017\017(\365\t\272\352\263\374yg4\262\332~\257\273\361\207{G\363\230\202\301zy\255W\177\356u\223{\362\263\3469\322\240\345m\210\016\335\350z\024\007\030q\036\361\t\226\301y\361\006[\253x\203f\342\360\f\200qY\366\274m\304P\302u\222\302P\323`\2220\243eP\030J\320XL\307\276\232{b]*\366Qj\252n\277~\307N\237\317[\200\300\250q(&\231C52\"\n\222\202$\351\220\002\021\031\262\352\006\021"
+	.string	"-d\316\025m2\354\033c\330%2\004G\371N:\270S\r\354\343b\374\323\026\255\215\207f*\1771\r\371lC\225~\342x;Q\320\206-n\345(\363\274$\005z\237;\257\022D\364\204\256\343\375\343 \252\266t\t\006\331C\371)e\005\224t\200\022\327\300\330\317]\026\002B\246\261\203H\017\027\255\034\021>\177;\036Fp\331\246cO\351\332f\264\216\325\246\377\365\240\006k\251\277\230x6\207\244\320d\362\316|\3255\354\236\347\316@\t\234\325<\330C\025\223\240`\256jW\370E\344\211\006\024\003\t\223\335\274~\231\321o\007\270\231\202\3476R\307\214\250\256F\034\"\334\234\337$VC\327\210\227\303\366iP\375\004G\327;\255\031\201*\2315Y\301\026\344\"\225V"
+	.ascii	"\033\213\230\232\"\"L#\247V\305Zf?\362\231\331\006\237\200o4"
+	.ascii	"C\312\231'\317h\306\216\355U\366\304n\036K\027HX\221\342\346"
+	.ascii	"\203\302o\f\335S\207\362Q\030F\0362\320\t\264\272\254\220-\214"
+	.ascii	"\003#\332o\005/\257\273\251\004@G\233I\213_\325O\314\204R\272"
+	.ascii	"L}\272(\372I\215\370K\222\322\314t`\352\\\223\202JD\361\023 "
+	.ascii	"\005[\335\373\361Qt\212\203\035\301\341\354PO\334\275c\366\351"
+	.ascii	"d\201\242\016\303\363\002\202l\253\024\240\232\276\025Y\331\340"
+	.ascii	"KT\273\231A\343\374\376"
+	.text
+	.section	.gnu.lto_last_coord.2.140.6cb5756ce5f5905b,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\202\210\200\020\1773,4,"
+	.text
+	.section	.gnu.lto_speed_old.1.141.6cb5756ce5f5905b,"e",@progbits
+	.string	"(\265/\375 \037\371"
+	.string	""
+	.string	"\022"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\031\001"
+	.string	"?\202\210\200\020\1773\273\0014\273\001"
+	.text
+	.section	.gnu.lto_GPS_calculateDistanceAndDirectionToHome.part.0.168.6cb5756ce5f5905b,"e",@progbits
+	.string	"(\265/\375`\213\002\215\022"
+	.string	"F\240rG\320\224M:\250M\n5R \003"
+	.string	"20\341\355\004xT\346\2270\020\243\007f'\225\231:F\215\277\377\207\206\020C\354\263\365j\361\266\214\301_0\005v\313!\bd\225)\252\362\02018\334\\f\001A{o\271S\nZ"
+	.string	"Y"
+	.string	"f"
+	.string	"(\037\202vg\026t\032\262\013y\233\315lKZ\301\023\265;Spi\325v\211r\003\3632\376d\036\350>P\215\235J]\036\206\355\232\231e\266\221\007\371\354\221B\344\020!\331]\356RU\\v\205Q\346\177;6\327\003\035~;\"\016\t<\232D\330]o#ny\253\330z\022\376\317\245\273\030\370\357\322\217\2312.\370\3177\372\200\244\0241\226\204\332@\355\261\306\307U\024\266\t\364\234\320rBG\t\255\021\032F\350\013(\220\240\304\256NM\311\232\220N,^\364\323\016\355\3733.\303\037\272\221SED1&\242\030\222N\324.\023\203\355\222Vs!\317\001,,\363\362\337\021\250\252:$g\211\205<6\257P\017\342\005\016\254Y\001\264Pr\301s\003k>"
+	.string	"\177\364!\027#\013\333\217\336c\301yx\367\261C\207S\236\303\373R\203\247\343\270\200\241\005\376k\23172\334\311{"
+	.string	"\325\324r"
+	.string	"\305\364\243/\271\004\200\332\275\371g\257\256\344\251\314\272\215V\212\317\356\252$\275\006L0\232\356%\276\272\0275K5\343\352`+\230\316\303j\206\203m\200\3518h\340f\272\225\f\307z\321p*\004vuh\2758\230\313\365\342R\266\341\375\315\251\351\307\215\342XU{l{\264X\334=\001!J\b\326<\325\037r\"\022&\254\254H\235\252E\3744\243J\332c\022\036U\037\310\203P\360\177\\!> \260\002\241+n\0030B/\343\362\312\200\312\035\326\270RYL\262\337\342\231uC\307\002U\256y\264C\203\2025\315k\\P[\313\326.\257\0322\272\204\251\231\223\225(\271\263k\332\205%\277\215f\tt\331\033\336\211\215\365\2226\376\331joX\013|oPxm"
+	.string	" \315\264\202\214\026,\262\371\t\034\213\004\007k\334q\345\342\341&\354j\003\211%\347T\013\r)+\f"
+	.ascii	"\267g\242\016\265cT\324\007\003\007"
+	.text
+	.section	.gnu.lto_GPS_reset_home_position.part.0.170.6cb5756ce5f5905b,"e",@progbits
+	.string	"(\265/\375`\272\002e\024"
+	.string	"6%\201H\260TN:bD\311s\234\210\230\347\005j\206\202\243s,:\366\361\356\271\366\266\206R\177\"\346\207\206;\305Z\377\247 \305\362\304\222\307\n\336\225\270\027P\237\002\305\377\21697sg\nV\027l\34313k\367\336r\247\024i"
+	.string	"d"
+	.string	"t"
+	.string	"L\236)\345\340\274\347\023#\253\240\243Z+\216\257\204\364$\234\273\360\023\nOR-b\301\242:J\371\364\n\354\023\345\002\350\247|"
+	.ascii	"\372y\237\227c\317f\237oa;g\204u6\326\223\210\352i\\\3710m\325"
+	.ascii	"Z\277\317Mq\3357J\235\177\336c\340\217\316W\366C\342\261\344"
+	.ascii	"\362\365\240\326j\030\320=o\233\201\355\005\366\276\004\032h"
+	.ascii	"\265x\260F?\343\025\250e\313|\206\r\201}\273\f\017\005\254j\255"
+	.ascii	",0\036c\306/\3724\256&\036\374\364k\350\3477V\242kEo'\206q\207"
+	.ascii	"\274\362\262\256\220M\243e4:6\243a3\372%\243\351\227\356)\243"
+	.ascii	"\245\214\336\215\216\033\375\222\224\020@P\255\"\302\256\212"
+	.ascii	"bB\031}\351\267\357\277\370\222\037\377!A\205\310\307\245&P\210"
+	.ascii	"\211\241\237\257=\357q\312\250H\020\257G\327\337q\036~\362\213"
+	.ascii	"\\\301Nv:\002j\231\304\271\376\322\005\f\361 \335\001'zP\361"
+	.ascii	"\254\216\375t#Y@\265\332A\0306\361\324\272s@\356\334K\365\250"
+	.ascii	"\330\305\320\273riU\317\326\356\231\236@\007\222\335\220\246"
+	.ascii	"\254\250\340Q92\034\n\307\215\310\325\373\332V\271\223\315\244"
+	.ascii	"\201_\3436\0026\033h9\351\332\n\r\356vC\263\335B\320h\276\233"
+	.ascii	"\016\266\333\007\016\037\315\2156\363\325r6\337\212\001\343@"
+	.ascii	"\310\344\276\033\034.\367\315l\307\313\272B\266\020R\355\354"
+	.ascii	"\316{\271;d[\266D~\0024\266\262\275\017\320\253.D\307\323!\265"
+	.ascii	"\264\320\317\330\316\250$\\&`\353\003y\020\030\b.\361\240\013"
+	.ascii	"\375<\250%\373\t}-l\367\252\207\305\356\345S0_\204; p\002!B\225"
+	.ascii	"\007OS\ff\t\004\261\340\002fskU\376\322\025\244\035\347\364c"
+	.ascii	"\343w\246u\314\260\266o\323\354\312\024\037\301\020c.\271\034"
+	.ascii	"aW\273%fgC\304\314YBs7\230\264\233\235\215+\305\205\370\3148"
+	.ascii	"\016\266\"\"\216\361\314\"\3562~\324k\343A\230y:\305\270\036"
+	.ascii	"O\215\314h\256I\301\302o\354Vl\377\324\032\t\b\030t\013J\346"
+	.ascii	"\212z(\2552\373-]\001H^\364\235\246\351'\2741"
+	.text
+	.section	.gnu.lto_onGpsNewData.part.0.177.6cb5756ce5f5905b,"e",@progbits
+	.string	"(\265/\375`\204\026\325j"
+	.string	"\372\254\030&M0\016\333\031\003F\023\272\235\027\023I*7\317#\346a\332\025\366^\334P\025\300\030d\334\316\357\rp\t\374\2178\304YBkr^\306\264\335*8\240"
+	.string	""
+	.string	"\200G\306\243\2278\307\363\304mo\236\227\310\263\270a\3620yW)eJ)\005S\002\030\002W\002\321\257f\033\345Y\347M7C\230G\224\262\b\021\025L\263\3516@\230\207Q\364\013I\233\326\302\222\243\303\016b\3250\211\023C\270\207\372:\211\374\232\266\253(\02333\211\023A\270GG\277\264\240\246}O\2756\231n\272n\231\233\273\257\375|\364\034\037\215\321y\252\371"
+	.ascii	"AF\007M\357\375\3509n\275Uj\227\2077\245\276_\257z\244-L\353"
+	.ascii	"\374\243\361\246<\3726\221\242<\353\2420\206\275:@\246\007\244"
+	.ascii	"\347X\212\033L\337e\320-p\333\355\210\251{\337\227\314\030\250"
+	.ascii	"i\337\352\031\364\030\244\032}\267\216y`a\324D\364\312,\206p"
+	.ascii	"M\307]\3676$H\317\361k\225\251=\325\336\367\r#\0253\244\345\246"
+	.ascii	"\270\371\276\321f\241\343\334\226\233Z\262\212\276\315\006\306"
+	.ascii	"xQ\023|\337(\324\260W \347 \334o\314\023\244\335\220*\246\202"
+	.ascii	"j\202%\206\031pi6\3566\346\3712\204\227\256\242\357VS\205\356"
+	.ascii	"\342\266\027\226\016\253\232\303._Vx\363\276/S\257\3544\354u"
+	.ascii	"\251\207\330^\325\016b{-\205\326\262A\263\361\203`f\003\356,"
+	.ascii	"\035\345\240\331X\207\nW\336\367\345\200\310\2756\204\231\207"
+	.ascii	"\247\327\306\302\314C\232\3542\267\351\350\327\333_\302\260\270"
+	.ascii	"\b\276\357\373\324\353{\261\267\032m\356q\2675$e\300\200tdTD"
+	.ascii	"4$\024t4\002\375\024}zxZ\342p\207]\325w%\227\273\2525$\261e\300"
+	.ascii	"\240\206\305\221\324\372(\355\016\315\215\256\254y\221Y\023\231"
+	.ascii	"\251Ke>D\326Bd\352\322\336\230\007I{\206X\031\234.$l}\024\353"
+	.ascii	"\256f\030;\024&\025\343\r]M\2667J{\003^\223m\r\314\201~\276\272"
+	.ascii	"\250\206x\303\202\234\306kBQ\207\264\312\230\035\355\rg\315\247"
+	.ascii	"\373\250CagT\032\257\031\202\032B\352\006\247\364\036\022\220"
+	.ascii	"<i\236\r\355NT\027\022\256&6^\323I\2375\233\370p\351\254\351"
+	.ascii	"\364\0355\304\323\016\204\306kr\251Ch\242\254\351\266\366\254"
+	.ascii	"-,g\235\271\265\244\327vkI\253\352\207\3017q\305-\"j\021\021"
+	.ascii	"\2552\236\255+\377n\353\020`\352\324\246]H\236\264\037[i'\352"
+	.ascii	"}_n\253,\315K\315\3544\230\371\007\263\020\n\001L\\1\021\275"
+	.ascii	"\262+\361%.\231\231K\205\n\333+\320\233\360K\202\034\")\301\305"
+	.ascii	"\317\257\200l\246q\305\346\324\320\327\007\256\345V9\301Es\321"
+	.ascii	"X\237/\376\273\2755{\336\347\217\244\3134\236'~\317\257w\313"
+	.ascii	"'\007!\310\265\317\363M\307\rny\3262\221CF\260\274\024\217\354"
+	.ascii	"%~\373m\005\214\233e\032\361\231\231\312\227H\241\276\367}\241"
+	.ascii	"\330\257\234\210\273\346fq\341\315t\301\366\232\001l\220}(\277"
+	.ascii	"p+do\351\363*)\026}\376\016\037\205_\217\301b\305l\215\321u\220"
+	.ascii	"&\230g4\241\224\323\327\373\276(^h:5\270\307ze\0337n\260\275"
+	.ascii	"\356<\221\355\233\007\341XiS\037\312L\315>\033\022J\320\342w"
+	.ascii	"\345\203\374\355\322\2615\323\177(3\257?m\346\237\372\353{\340"
+	.ascii	"\332,e\377\325_\t\227qM\355\377\337\313\247\322\013\271\337\277"
+	.ascii	"\261\352p\007\266\234\034\334c\314\200\016o\246\016\266\327\376"
+	.ascii	"^k&){hN+/\364\207\362+u\207\311%)\302/\2059\310y\201\3269\007"
+	.ascii	"\216\033M\246Y\201\246k\266\321:'\320:\3270:\3230:K\3758#\020"
+	.ascii	"\344<\243u\226\321:\307(:\303h\235_\034\020\344\354B\3109J\310"
+	.ascii	"\271\205\2203\213\326\331\200\243\363\212\243s\001\255\263\212"
+	.ascii	" \347\024\2553\024\001Fg\024F\347\023Fg\023F\347\022?\316$\200"
+	.ascii	"\234\007h\235G\264\316O\255\263S\353,\342\350\334ttf::\207h\235"
+	.ascii	"A\264\316\037Zg\017?\316\002\3748w(:\007Pt\346pt\006\340\350"
+	.ascii	"\274\301\350\274ttV::k0:'\031\2353\030\2351 \265\316G\255\263"
+	.ascii	"\321\217s\021\2203Q\353<\324:\013\265\316A\255\363\261u6\266"
+	.ascii	"\316@\255\363\317\217s\261u\366i\235{Zg\236\326\271m\235\211"
+	.ascii	"\255\363\260u\336\351/\315l\321ym\235\325\326\371[g/:7\222I\315"
+	.ascii	"\317\363}\265\n\351"
+	.string	"\274\"\254qf\375\245[Lw^\3771\021\365\bOy\337\201\3132L\037\342\233\276\227g\203\f\347\206\337\230\336\004\230\023\304\207x\347\262|\363\341=<\210W\367\226S\224\202H\033\037^\r\314rb\025\350r\220sT\017\337~\255\276q\322i\341[\301\311\f\3579\217\223\234\302\361?d\234\344\324\233\231\234\262n\\\256a\033\227I\240\313\265F\r\262\351\322\364\361!\333\355\313\205\344\034\027zyH\026}xR+\372\320\364\234\233IN{\372\336\327\252\231e\220wRMn\307\311\027\222\204\3226\266\361\331\275M\214\036X\001\276\327F\264\007\266\303\013@7\225,t\263:<\217\324\r-EU\257u;\007\005\350\241\256\222e\217s9WI\304\305\302\022\003w\005p\212e\177s\270)#nV\326\2267A@\253\2770@,?)\234;\352j\271[\336L~\250\257\347[1\211\r`\210\327\235\304r\370"
+	.string	"\236\035\313\251\364/9\222\350\340\360\035\355\016b\272"
+	.string	"\360]|\303\003\360\275\004\334\262\341y\224pAs.}\n~\307\374[z\242\271-\245gg\363,\f\247\204\337\274\231\374v\307\374\263\202k\245\021\2563\357\313-\n\013\333\\\275\257\025\007\r\257t\226\364\032\276\331,\337dx\f\237\364\275\234\242\3644\307\3422i\342rq\275\022\230s"
+	.string	"gv\241\270#x31\364\022\271\3023\312\257\342\367y(\023\323\360 \375\247\361,\366[\216\2264\352\373\276o\317C\233}\244\357'`\314,\237J\236\243\267R\305\004\021~F\345\350}\244\310\351\260\245\267\325\032=s\f7C*\365y\231TR\237\223\251{M.\206\034\206\031\275\217\224@\2648\241\277\027\214\330\344\345\245B\251\2276|(\357\350\365\024[\364\335\245\345\256\260NO\261\305/\372v\362\326e\371T\002by\001\334y(\373:\374\257\322\344M\335y\342g1\273QX\242\247b\227\342P7\212\013u\275\274\330^\211~\325s3u\016u!\211F"
+	.ascii	"\333\023\372\241\357\266&\"d\376Y\005\275\320\263/\247\314\351"
+	.ascii	"\343\007}\317\271\315Y\246\035\037\n\262\250\357i\374\236?~\007"
+	.ascii	"nn\226\317\236\177\202\314\300\345\212\r9\271\342\306\307\374"
+	.ascii	"\003\372\2377\376\007.\247(1p'\322DL\301\003\032\354\370A\244"
+	.ascii	"\002BE\305c\225\200\007\217\013\202\254\027\374\340!D\r\342C"
+	.ascii	"\203\035*G\340d\001\020\037Bv\364\360\201\301\016\013\236\204"
+	.ascii	"P\320\303G\005\023<Y\340c\307\217\247\b\250\202<9)1\220\013x"
+	.ascii	"P=\t\001\002\204\352\211\207\331\257\344/\322\034U\345\204L\r"
+	.ascii	"\013\250\245\271\312\344\n.\326\002\277#e\203\346$\364\225\264"
+	.ascii	"\2623O5\300\"\023KL\322]\313\220\223\203\341\306\263\2124\244"
+	.ascii	"S%\004,\270#\005\036\007\222\315\341N\2748h\342\344\225\301\361"
+	.ascii	"9@xI\225|*\bf\360&\"\334(\3641\261)\206d\234"
+	.ascii	")_%\346\005-vW>\210\364P\027\316\330x\005~'\017L\255\243\203"
+	.ascii	"s\364\320#a\032\311\332\370\276kwz\340U\025'\257\314\225\017"
+	.ascii	"r\002_\343m|K\227S\250 \335\222\323\004\314\342\324\370\256k"
+	.ascii	"\307\262&\202\321C\231\306K\231\271\362A2\032\b\274\3247\334"
+	.ascii	"\213%\363\302\020x\237*|S\266\242\031_,\310\370\031\377l\364"
+	.ascii	"\232\245l\214\227\361\275L\203\"\223r\311i\f2ec\3175\242\207"
+	.ascii	"r\3575q\254\212\021,8\241\250g5\210\200?\340\2638I\307\302\370"
+	.ascii	"\356\222~W\222n\004\030O\254bf\312\306\200\277x\346$\231\344"
+	.ascii	"\335\322\325W\361\001\377\202\203\264\214\222\257\313\220\213"
+	.ascii	"\177F\275\213\026\317\342\243R|\013\003\236\305\377\036V\235"
+	.ascii	"\025o\300?\341\262\214\227b\001\277\342\271\n\370\276\342d\013"
+	.ascii	"\232\223H\305\fOH\305C=\004Z\312\244x\025q\337\304U\232q\261"
+	.ascii	"R<\321\t\365\017\345\005\024O\300\373\335\2117\361(H\374\211"
+	.string	"7\332\303\252cU\342M|/\353(\323\236\211\313\204{\254\304\367^\213\330\202S{\2569\223h^I2o\370\276W(\370\223<\b\311=\276\244\237\037\333+\211\247=\273)\333\007\315QAI5\30592YM4w\246\312\t\371\373\210g\206\313\361\241\257\305\337\3446\253\235\323\333\215\302~p\204\335\213\333\f\263\206_os\210\343\035S\247v\345\2150s\033'\301\347\223\367\255\352'\363\027q\346\013b\351\312\353\374r\200oi{\023\262\257\347\232sD\323_\2752\220\371\367\364N?\342\037\316W=\375\027:}\253\314\352\222\345D\304\267\037!\322\347\213N\222M\323\213\b\201\363\250\2014%\021CC\"\"\"\222$I:A\005\304('\241\263\016\021\360<\347\230\032\021IR\220Ja\343\303\n\034\203\252\300\336\264\275\276\274Z\353\006\223H%\007\220}\341:\226\374\032@\361jH\355\240\221\352\031\324\342"
+	.string	"\274\337\264\200\036\225?\252\250\221A\253=\204\326\235\350!\013\315fBT\222\367\033\bo\331:s\252\240\263;\020\333\247\273\222m`\346%\031^3\205\313\007\317r\356\300<\032\324\b\bA\323(\270OY:\325\347\224\207\t'\341\202`6X\342\336i\311\025L*\233_\357O\305\016\257W\226\263\f\312\324A\032rM=\b\255\261*\02574\t"
+	.string	"\200w\023\032\233\261\323\361L\026\366wbb\257"
+	.string	"\320\323l\343,d"
+	.string	"\251\025\361\234\210"
+	.ascii	"\243U\202b\347`\026\323\333\f\020\334\237\312\b\267^\364\262"
+	.ascii	"\264\342\2557\302;\326-\210)\327\240F\242\244H\310\026\266\370"
+	.ascii	"sS\205!\235\206\322q\035\346\234\036\355\001\177\004\0132\234"
+	.ascii	"u\375 o\305\n\b\346S\272u^,\256\237\344\274\306~I=\213\204\\"
+	.ascii	"J\201\276\030\373"
+	.string	"\240\315\347M\006D4\370\023.\3079-\324\245z\353\345\020\301\343\371\361\351\223M\325\335\236\337\375\252k\374\343\177\022[\355#\335\232\313\026^\261Y\367a\336\3076S/\341\262\267:\352ES\346EJ-\320\230\324\352\236ot\324zj\352\030 s\270\326\026\32449\240\300&\r\270\327\256}7\322\312\261\337\364g\267\032\346\337e-\232\355\367\307\376\024s\220\343-\001\204+9>\357+X\251\276\231\374\211\260\243*S\223\345\313#,\365D7!\036o\220\370\317\0202l\213(/i\334b<U\246ZS'\036\364I\302\326w&;D\2271\2303\335)\225\341\013uE-\221\nzVquV1\224\226\036G\257\001\007Z\016~\362\331b\231Qi\2733\037J\302N\"\247w\2416\360@\252k\266D\202\206\312]\002\337\213J\301S\030\032\373\223\3642\356n\344s\333\017\211\356\311?v%R\326w#"
+	.string	"\233\367_\314a\336\227J\325\032cy\036]\266\225\233\275\230j\3473\324]\323\246D\306\253\247=h\016eO\253\005S\366=l\024\336\375\311%\204\210F-z\340)\353D\254\210\221Ky\271\002\214\215`\345ssGr\312\367\2433\324\271\206\255\030W\226\213\207\256\317\311\241\357A\232\"T5\212O\251}\353\325\322Nk\235\245\031\255\260\026\310\263}\002`#E\274U\367\340\253\020x\007@LV\bI0\017*\306\2410\226^e\345\314\302'\032jk\263\254\302\237\246!\306\263?J\260\307\215\0139\247-\030j\304?#\363#\320QT\236\247\370\345a\270u\3526\006T\r,\377\330!V;U\241\023\b\210\001{\013\300cWF\t(rU\266T\374\370\036\307\030sI\220/ 1L\307\322\224\371!K\357a\372x*{\2212'\320$"
+	.ascii	"\255:5\004aP\f\020\254\244\321n\376\rv\260\371\210\326\017\234"
+	.ascii	"\224A)\332\204\311\343\tC?-\0169\206+\340,/\246\361f.\250\225"
+	.ascii	"\303\212\006^\354\236\271 \204\3651\363cL\330\373\024\201\316"
+	.ascii	"\302\376\020\345/\206\231\206\035\341GB\013\003\005\201\255\013"
+	.ascii	"Ym\207\t\t\213\267\001/_fs\326m#H\314\304\325\016\264;3\311d"
+	.ascii	"q\316t<\370\204\b\277\204\177e\300\266'\343:*\250\261\245\365"
+	.ascii	"\257S\272A\274nA\035\035c\255`\340C\250\003q\224A\364'\f\310"
+	.ascii	"~\222\201\024R\306\230\017\204\277\030\266Whdv\215\240\001S\021"
+	.ascii	"7_\234j\0321\217K\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.6cb5756ce5f5905b,"e",@progbits
+	.string	"(\265/\375`\216\005M\031"
+	.string	"&\250\224I\200\030R:|\235\277 \224\307\206\n\026n\213\2648(*\037\313\262\303\3429\340\335\177\006g\222Q\004U\370\374$\355\007\303\245\026\002#\372p\030\206a\030\006\203%\343\321\202\316\206\2520;#;\233\325W\261\231\271\375&2\005{"
+	.string	"\200"
+	.string	"\201"
+	.string	"/z8\330}\261\347^y]\215\035p'Q\016G\333\200\037\207j\370\230\f_#p.\030\336L\277\305>\237\317\347\005|6\250\005|8\264\302\255\\\233)\\\354\2768\341S\356\320\317$\334,\302\265@x\331\203g\351\253\263('\025\177\r*t,\301~rp\265\240Fr\377\373\374\232\b\320\323\256\375\333\230\033\364\221\233\3275C\371\361O\006\32579\347\314"
+	.ascii	"?\r\372?w\fo#S\322\273r\364T\201\177\341\300\235\321\033\370"
+	.ascii	"O\033\370hjt\361\322\300\247\202\204\177\006\235\361*\302\217"
+	.ascii	"\3118\363\b\337\214\021\376[\214.rm\023[\233*\030\370e\3205G"
+	.ascii	")\302'\203\276\350#\321\235>g\273.\332\310\265\271E;\335\027"
+	.ascii	"Y\234l\305\333T\334K\212\177Aq1\327\346\023\017sm6q0\327\346"
+	.ascii	"\022\357B\0027\026:\242\327k\263\210\273\205h(\020\270\257\320"
+	.ascii	"\027?<\354\006=\312\006JV\221\355R+T\002H\355pm^s\215\253\227"
+	.ascii	"\332\234\361^@\233\356|6\207d\366l;\357\325\263)\257gu\226\335"
+	.ascii	"\311\270\267\2623yV\347\344\332Y\234e\337\344\256\235\035\202"
+	.ascii	"{\211\020\334RAp3\001\202\233\352\007\356\250%\334"
+	.string	"M>p'\351\201[\t\017\334\306\3169\377=;p35\361\303\003\367E\245+\357\277\244D\034\"\tu|y\377\"b\221\021\361hx\244D$LB\020\377)\273\265\236L\035\027\250\326\347\364-\273\237\216[p<\310\376\275i\245=L\265;\306\3161k\243\3425\203\252\025\260l\324I\326\025\035\344\230js\220m\240JMJ\267\304\261\n\252\026\307\b\246\332\234\263\003\250i\342v1\325\366\362d\252\315-\205l3\205l\256\031\2649d\320\016\001\005\331V\366\321\244l%\201\n\254N\231\376X\235U\017\270\312\302\002\376\330^}\t\354\016\222\347+\265\277\246/\265@ej\003s\250A\b\304\343\\\005\"\243 i\226\003\300\002\251\032\262\003\021\360\030\025K$\032\211\n\232v\327\"\371\276\023\211\322B`\230\233\216N\310aD\226i\211\240kF\327\243\364\361\3416\2042\205\020G~8\317\215\204\216\340("
+	.ascii	"\246N{Mw\371\231\230\322\265\222\250/R\320:\245BSGQ\243\263\362"
+	.ascii	"P\345\244\347\354\222AoN\013eZ\321\004P\225\r\214c\"Z9i\272\227"
+	.ascii	"\034k\320\030/i\034V\314\312i\031\025\337\f\323\354\024\031\260"
+	.ascii	"B\324\223V\224\372\317\252\324\0070B\261\034Rv\201\0069\2531"
+	.ascii	" ,\344\265O$p\017\037lY\367\365\221\001$J\264u\243\226\367\351"
+	.ascii	"\036\211\2356\035\321\261\262m\004r\034\337C\354FGg[\260/\235"
+	.ascii	"p\266V\001"
+	.text
+	.section	.gnu.lto_.refs.6cb5756ce5f5905b,"e",@progbits
+	.string	"(\265/\375`\332\002e\023"
+	.string	"\266\366\214=0m\233\341\303\363\236-\037X\376\227E\247\227\034\036\006\006\006\006\006\006\006\006\006\006\006\231\202\247\246\360\355)f\330\350\255qh|?\275E\304\277\213\302\276\037\233\320R\023\231u#{\313\024u"
+	.string	"}"
+	.string	"~"
+	.string	"\227\3561\264\257t\317Y=\203|\344\006 y\303u\220\353\337\366\227\212n\241|\234|\267%\220)i\212\376\004\255/!\353\240\353?\263{f\357\230\2753\177\203\275\306\374o\366\312\365\\|\312\365\333|\354z\313\352\020\310\313\352K\035\331\326\210z"
+	.ascii	"\371\031Q\327\310\377\3323S\367\246\216\201t\313\364\035\244"
+	.ascii	"O\246\307\242\237\362)\351\247\350%\3712~\373\222\227\032\002"
+	.ascii	"\207(aH\306\023p\376\300E\367\260\350"
+	.string	"\035\336\033\210\235#>\201M\357\304\016n>Cv\315\306\177\262g6\376\002|\213\215\016@\243W\b\350\023\001\277i\274$@\237\031\335\322tJ~D\376\364\365~g@g^\237\336_\230^]\236\222zd\351R~\264\364\3121\250\251\213.Y\324re\254L\177a\366-d}\007\335\337@\353\037Z\017i\335C{\017\366\034\332\207Z\327t\357\305\017\037\350_\3273]\307\350z\245\353\025W\247\\\235\342\352\363\352T\325#U\217\252zX_Z\267\264^i\235\232=2;d\366\t\324%P\217@]f=~z=\355\270\f\304-\357+\257O\005>\222sHO\336\004\344\2370\201\371K\200}\022\223\177\304\366\213\b\001b@\377\003\367{\350\320\351s\210\377\206\316\237\201\362c\300~\013\340_\201\202\374'\204\277\004\252\017A\222\377\021~h\213\001\337 \376 b\221\201\274\003\354\0038\337\371\350\233\217\337"
+	.string	"{\006\3475`\277P<\023\352\236|L\250_\344[8\317a\277\201=\343<\006vZ\342\021\316\013\270\307P\301\323\217\220\375\0162OG\340\351\005>\375\373\274\227=\346\323)>\237eoa?]\276\227\025d_t\272\005\373\312\244wT\347\344W\204O\241\272D\372L>\026\376\344\372\265\275\265\305-Jh\311x\025\366\0306\001\345\"\b\025"
+	.ascii	"\007\362\366k\030\026iT\344X\270\202\001Y\354\243n\352\nGN\262"
+	.ascii	"1!\257P2\215\n^*\256\314\360\363\fW&\226\356\013\0172\333\200"
+	.ascii	"\201\300\b\026_n\n"
+	.text
+	.section	.gnu.lto_.decls.6cb5756ce5f5905b,"e",@progbits
+	.string	"(\265/\375`)F\355/\001\032\tvpV \fQ9\351\3244\205\357!xG<\276\256\037r\377\377Q\325\247\317+\256x\026\211\316\343a\3209\333\376\342\372\236\227\t\367 \267w\035-hl\214\356R\020\374\354\222\236\016|\316\371\251\022(::\225"
+	.string	".m\334v\033\300\342\244"
+	.ascii	"\341r\244v\177B\366\226;\005\b\006\360\006<\007>zG\343Xk\032"
+	.ascii	"5j[\245\353\n!\314\255s\210\340\240}\264\216jV\351\256@p\242"
+	.ascii	"\026f\243\266\375\2309k\265%\333Gg\325\266\037'e\256\002\001"
+	.ascii	"M\207\026\275\234\225\036<\024\325\254\036{2\202\356-\027\276"
+	.ascii	"\255\201o\247\360{\017\027\225\301o-\030D%:\337n\370m\206?\245"
+	.ascii	"S\350\031Ah\350M\365m\253\n\204l\006\n}\337d\330\005>\373\301"
+	.ascii	"\343\256\212I\r\201\022\222|\261#\fF\267\350\242j\031\035\243"
+	.ascii	"\253z\252.\033\306\337Q\215\202\007\017\036\212t\262\210!\262"
+	.ascii	"\305\347\276\231\340\252U\211\316\fu\350|{\341w\017\374\266\302"
+	.ascii	"o)\374\367Sg\223\013\034/]\372^\20381\222TZ\240\372\033Y\367"
+	.ascii	"\352\234v\252\313\316\177\025\253r\330\302\336\374\rF\013\031"
+	.ascii	"\235+\234\277\375@)\263\327\tf\212\352K\317\207LMT\r\236[s%:"
+	.ascii	"_\305\340\327/\370\265\016\277j\301\177\325s\323qx\230}q\223"
+	.ascii	"W\265r^\246@G\006G\337\312\246\266\251\313\r\025oM\327\223U\337"
+	.ascii	"\327+\330\0049\327\rg\335\333\253\033\316\277\256\331\240\303"
+	.ascii	"\204\n\017 j\356( "
+	.string	"%\205\246o\275\253r\255\2255\364\034\261\001\207\246\257\210\020\257i\206\316\252+eF\3139\003\235M\256\364h\241\357_\321T3WM\216NH\337k\340\006\226\314Y\031\242\312\2212\225L=S\307T\026\252\230\272\254f\352\227W05\214\b\016\252\231\252\254fV\231\3249\343zrw\366W\261\264\332\366\343\024\224\241\236\234$sV\276\276\231\251S\232h\360\207x5S\257T;;V\025\001;#w9g\017\036\212<x\360\340\341\306\275\311O~nUV\242\263\250\016\235\257d\330KQR\0227e}_\277p\210W\272\272\245\266Y\345\024\374\242l\310]\316\312\377\265\256r\251]\352\262\322U-\257V*\225_e\316P9\347k0W\345~\240\2022\024WW2\347\374\032\345\017\361JW\261T9;V\225\241\270\250x\330\352\242\266\202^\316\331C\221\007\017<Ex\360\020\203\357+\025~E\342\227"
+	.string	"\327\025j\\]\036\256fy\205\253Q\276\003\245\314\313\2343P\025\262\002RH\3377\341\0259\347\\\017w\352\354\355\355\355\325\303\235\017\001\276u\350<\023\366\251C\347?\200OW\211\316\237\300\277\253D\347I\340\252V\327\3522\203\312\366\212V\317n:)\2632g%P\023\221\223V\326\367\r\300\257\031\234vo\257fp~\001\270\353\320\031T\211\316:V\311\3522"
+	.string	"U\312Epp\213$\313a9+\201.\314\001\233\003\247\357C\340\327\262S\340\2249\370\016~\r\300Y\367j"
+	.string	"\3167\016\252C'\207Jt\376\025\312_\237\324\260"
+	.string	"\330\250\030Z\031-g\245\020\220\322\306\224\217\276WV\242\023\327\241\263A\300\240w,\001\376\376 M\214\234\017\265J\215\353\240\233\330\001T\022\376Z\242F\240>\340o\017\335\241\r \305\004\022`\033\203\301o\003`5"
+	.ascii	"]p\037p\245r\331\362\027u\021\006\377\r\001BI\375`\200z\324A"
+	.ascii	"\001\370\357\005e\377\3230\tA\371W1\233\341\257E\352X\233\375"
+	.ascii	"}\366\333\241\2646\213\341\357\013\374\365C\232;+\024\366\327"
+	.ascii	"0\033\344A\253\375ui\201\376\2239QA%\362\005\374w\311\337\016"
+	.ascii	"\310\273\033\253\363U\031PG\370+\b\177]\263?\257\240\337\334"
+	.ascii	"\202\377\"9\336\225$\335\037^d/\330\236S\360\337\372\3274x[:"
+	.ascii	"I\026*]\305\236\035\250\"\316\366\r\376K\364\363\327\036\253"
+	.ascii	"S\17795\215\0317b*\260\247\265\277\255\177\277\371\273\315\377"
+	.ascii	",G\300o\327\376j\347\246r\371]\226\2706\301\t,u\007\300o\177"
+	.ascii	"\374\375\203\2056\363w\262ry\006'\346X9\037\324\002\240\265U"
+	.ascii	"1U\316\021\210{\3512}\204\314\222,E\377\r\360\377\304\337c\376"
+	.ascii	"\256\373\353\207\037\340\277E>\347\257,\376z\346\227\363\327"
+	.ascii	"\021\374\265\376\325\254\267\374uE-\301_\247\376"
+	.string	"j\202S\240\0029\321\177u\374\025\257\347\257@>\177\025j\b`\350\021\355\200\326\362\241\377\"\357\363\337\243J\245\312\311\3745\331p\032\016\364\337\021\376\343]\371\317f\345\257T\252\374\227b\202\377\025\374\347\277\002\260g\177Sq\373\333\002A\256\363_\036\365\277-\376z\301_\005\360\327\002\374\025\203\277r\370+\001\376j\301\337!\370\217\377\013\346\357\032\177_\375}\343o\032\177\317\370\333\306\3379\376\252\246\355\357\023\374m\3657\325\337\306\277\331\376\003\375\246\002\376^\373\373\354\357\262\277\307\376\206\3627\330\337_\177'\371;\3717\220\277{\374\315\343\357\254\277u\374m\374\333\003\177s\340o\r\374\215\201\277-\360w\005\376.\341o\b\374=\342o\007\374\035\302\337\032\376n\300\337\027\374\r\3647\b\177\177\360\267\007\177w\360\267\006\177\203\370\333\350o\004\374\355\341\357\016\177\033\340o\002\374\215\301\337\026\374]\301\337"
+	.string	"\370\273\350\357\f\177c\370;\350o\237\277y\376>\377\276\177\367\337\377\353\234\277\342\375\225\315_\325\3745\315_\317\374\325\314_\311\374U\314_\301\374\325\356\257u\177\345\362\327\271\277\306\375\025\313_\253\374\225\310_\333\376\272\366\327\264\277\006\371\353\217\277\036\375\365"
+	.ascii	"\177E\373\253\320\177\274\377y\377)\360W\263\377i\376\272\374"
+	.ascii	"\353\330_\305\376\032\366W\260\2772\371\353\222\277*\371\277"
+	.ascii	"\345?\227\377a\376\212\344\277\227\377l\377\245\374\317\362\327"
+	.ascii	"\"\177\355\372+\220\277N\340\257\021\370+\004\376:\342\257\033"
+	.ascii	"\374U\203\277\206\370+\210\277~\370\253\207\277\032\340\257\030"
+	.ascii	"\376\332\377\335\374W\363\377\356\377\231\377&\376\227\360?\354"
+	.ascii	"\377\t\376\317\375/\332\333\333\333\373{\212\277O\326\177\344"
+	.ascii	"\023}\177\201\016\377\002\022\374\337\0307\006\330\005\0377\352"
+	.ascii	"F])9\027\205_)\273e\210\222e\337\343\32561%W@\372\376\302\f\027"
+	.ascii	".\252\334\r"
+	.string	"\312PB\242\222\027\\\340\377B-/T\315\353\240\f\365\242H\022\017\377\327\351:U\271\333\346\263\005\337|\263\006aT_M|\316\260\0337vN\230\235\363#\226\225F\326\327\306\251Hb\240\231\351k\341\\\370\202#F\256\257}\323^w\017\013K\255\257m\341\007L\213\227\275\276V\257\221\374\337\261r\342\300\205\365=^{\375\337\271\020%)\006\313\021<\274\036B\2022#uZ8\351\302\277e\303\346i\210\217\017\374[5K\253\306\246]'eF\236Z\336`\255\260\302\232\276\367\211\201\177\233\246.m\232\036\202\241\212D\013#wq\316\234\321\021\006\377\326\214\031\"s\370\267d^\227\226\214=\353\240\314)\360H\311\241&F\314\216%\006\003\306V\021\353QbgW\335\2642[\361\274\300\352\001\202\351\254\330\272\352\206\203\2232[\365P\245\351\301\302\357\251\302\267Z\252\345\302%k\017\377\2556T\316N\003"
+	.ascii	"\372\001eL\215\276\257`\325\312Y\261s\365\356\346+e\236\321C"
+	.ascii	"\245\227?\234\247\r>\217\030\374\333\270\270\277]e\366\3229\323"
+	.ascii	"\301S\207o"
+	.ascii	"\255Tk\305b\251f8'u\326\250Z\270\313U\312\017\347\321\202\317"
+	.ascii	"\003\207_\253\331y\373f\247\334RYZ*\266\n\3169#\225\231J\347"
+	.ascii	"\310\031\252/\275|U\325\301V\371Epp4>9\207\345\234+0\275|\031"
+	.string	"Q\353{\2362\374\277\276\3773;U\345\234g\230\312\\\365\344s\376\365\325\254\265\303\177\241\332\212\301\377k\177\004\224 g'1]9\347\332\006+ys\322\321\367?\207l\322\345\f\265\205\fa\313\nj\353F\324r\313J(j\271\225\221PF\220BUy\013\031\265\314Y\b\n\n9B\313*j\351\224\205\242\226\331*\267\360bU\263r\013\231\241\264\262P\206\312Ny\251e\305!\nj\313*j\351d%\024\265\334\262\312\313\255\034\224\241\234\252P\200\312UBy\271\245&/\265\254\202\242\226ZVQ\313-\257\252\206\202\022\025f\204\351\372\261V\353\242\240\262\214),\247\252 \272(\245V\036\223sEs\221\2532]\316\030\344\214\245U5\306\351F\235\362D'\343\211\315I\253*s\316\033\246\236\270\2642\024\035\262f\272\250/\255\234\277\236\226\362T\3169o\200T\322e!\225\016\351\003+\307p\2213"
+	.ascii	"\2622\347\251\234\2215\323\345\234\2219g\235*,e\3169\202\242"
+	.ascii	"\222SS9_\025Me,$\025\02797Z\231)VQK.\255\020T\314\226\311\374"
+	.ascii	"B\211\254Q1\264r2\217\331\252\302K\344X\216\221s\256lp\322*\205"
+	.ascii	"5\266\215m\217\r\262\357y\246\260]\333\300\363\266ve\325\367"
+	.ascii	";n\224=Sv\244\321\350k\321\250l\235\351\373\235/\330\232\261"
+	.ascii	"iq\"\005F\337\357\310\3412\273\334\321\312Q\346T\245ll,\013\210"
+	.ascii	"\310U\033#}\277\223\206\243X\261\276\001#\311\214\276\337\t\213"
+	.ascii	"\362\304\206\371Le9\003\323\367;C\260}b\301\300\252\\\255\302"
+	.ascii	"j/\304\356t\340\3372YZ&\235\254UX-\210\226\273\\5\345\303w\250"
+	.ascii	"\226,\251wE\312<\203\347\005X\325\207\357D\341\337*YZ%\365\356"
+	.ascii	"B)\363\214\223\013\213\352K/W]}\300m\270\312\366\360o\217\274"
+	.ascii	".\355\021\213\344B\221e\344O\031\032\2519z9_}\300Xo\332\334\364"
+	.ascii	"\265\31172vP\372\036\237\301\307a\214x=\301\302\205\326\327z"
+	.ascii	"\265%b\213\334z\331!\027\301\301}\240\254\327\315\331\251\326"
+	.ascii	"\013~j\275\300\204+\342Tv\336c:\374[!]@bh\262\244l\227\315\232"
+	.ascii	"\212\221<\323\367\267A,\220*;6!}\177\350\334My!\351{l\005\277"
+	.ascii	"\337\310\fI\326\225\021\222\374\002\306\b\234\\\332\035\334\226"
+	.ascii	"(\311:1^nT\262\330)\253\303\356\2604\254\224\235a\255\354\013"
+	.ascii	"\013\303V\331\0366\005\233\303jY\024,\225\305\262Qv\313\306\260"
+	.ascii	"<\254\r\353\303r\331+[\303\336\2608\254\214\272\264Y6\337\"\255"
+	.ascii	"\323o\323\375]\347\245I\362\355o\267)rwpZ\304\252\030\232\254"
+	.ascii	":3]\311\2723;\352\306\020\251c\201G\273U\211\2731\207\346v\305"
+	.ascii	"\rK[\262\341\262\2505\\\027'6\253\325\364\236U&I<\351\270k7\233"
+	.ascii	"e\237\254\013;V\205\335\236\346\356\250\204)\022\267\226l7+o"
+	.ascii	"\034\374\r\307\345I\327\331\254\266;r\327p6\253W`\273\363\300"
+	.ascii	"\224\246\214\b\b\327\266\350\351\302f'\243\357\261\022[(\214"
+	.ascii	"\004_\266:t\036\373\300\177\263y\357\375\235\246\357z\316\007"
+	.ascii	"\232\213\315\023\225\276rv\234\220\261\002\326\3678\013\237\203"
+	.ascii	"62\336t\234n\241.\033N\347\275\335t\216\3273\275j\366\203\f\312"
+	.ascii	"OvTp\032/#\325l\200\204\312\326U\221\007\017;a~\324\255\301\367"
+	.ascii	"\330\t[8\370:-\340\353\270\301\275&\304\233M\017\024\r5#}w\330"
+	.ascii	"\340zW\211N\013\352\320y\2351\370:s\370:l\370:`\370:A\360u\250"
+	.ascii	"\360u\236\360\3176\370'\035\376\371\206?F\f\3774\2029\324\241"
+	.ascii	"\363z\225\350\374\231\003\377D\342\233e\360M8|\223\f\3374\202"
+	.ascii	"ob\341\233S\3707\016\3765\203A\324\241\363\267\n\376=\303\277"
+	.ascii	"O\360/\020\374;\003{P\211\316+\333\330\31429'N\315\366K\246u"
+	.ascii	"\301:\331\330\362\266\246\266#D\354I\016\26547(-\220h\357\264"
+	.ascii	"W\271\306\310\2508\027}+\\\2107\032\320\365\221G\225\344\254"
+	.ascii	"\315.X\021\231ck\2636\035\252/2\250\244\224\365\250%\331\270"
+	.ascii	"\365e\322P~\234\202r6\362v\267l\262\272\354\262.k\261\036\253"
+	.ascii	"t]\327I\332\006\017WM\217K\356\274=V\363\252\316\214+cU\372V"
+	.ascii	"\264\020o\245\235\202\305E\234\276\2772\360\353\031X\315\013"
+	.ascii	"\353(\375\244.U\350\033Mj\236\033\224vR\363~\234\224\034\204"
+	.ascii	"\360\220\2133F\371\001\007\337\333;|[\006\337\206\301\267]\360"
+	.ascii	"\271$\003\fee-\354KI\275\222FnN+\371\333\216\2247pXI:\\h!\314"
+	.ascii	"S\023$\235\304ih\350`\364\355\"m\244.;\364\021%\320N\0306Yh}"
+	.ascii	"o\261\340\327\016'P\207\363o\257#2\216\340\021\351!B\262\264"
+	.ascii	"\315\365\220\277\273ZH\317h-\r?K\312\270\274\372\266\262\022"
+	.ascii	"\235\035\352P\020\037>uYtQ}\3377\256\330\260\252\331\217\315"
+	.ascii	"yGZ\262\267Z\253\2014W\367\350\037\315\243.;r@D\234\220v}\315"
+	.ascii	"5U\256\307\233\026\226\250\351i1&\273Ps\007\004W$\006^\032kf"
+	.ascii	"\001\0221\2514E_\3707\317\230@\22485\331S\266!sD\210\031;\007"
+	.ascii	"\253\256\214\231\344I\333S\303\202\235\2359&D\02117\307\3302"
+	.ascii	"0^\270\372\232a~\240\310\265\355\350k\202i/)-\340\300\3655\277"
+	.ascii	"\024a\231]\314.f]\315Ug\312P}51\351n\326U\265|\345%\367\177\347"
+	.ascii	"$\363\325\343E\337\027!\361or\261gYR\306\262\3645W0W0\265`\344"
+	.ascii	"\2177\346\334M-@xkp\314\311\255\351a\246\213)gf\031bv\204\252"
+	.ascii	"\255\224\330\t\261\352\033\367*\003I\213\271\276\327\340\006"
+	.ascii	"\377&\026\213\004\b\217\352\016\r\\\315\373\201\304\355\311\225"
+	.ascii	"\332v\336h\001g\255\357\353\322\264b\253\244\341\350\3422\251"
+	.ascii	"\334\2542fF[V\337\343\231S\354\252\266\304\231\222\2463\004\217"
+	.ascii	"*\371v\333~\300\316t1\335l\332\nO[\202t\333]c\245lM\261\3227"
+	.ascii	"-\315\\\253d\231j\001^\346\274i\362c\007D\n\206\332\3155\240"
+	.ascii	"\247%^mR\232\234\001\203cM\212\024\363\214K\006\325\027fb\305"
+	.ascii	"L\033\263\233g\326\353L#5C\214\006$ee&\224\"-\244\232\016O\250"
+	.ascii	"\274\ts\203eH\r-11s\254\222e\252\372V\345MR\257s\260\3412Dys"
+	.ascii	"\214g\216\0135k\312\377; \312\0201\322\367\032\220O\236\230P"
+	.ascii	"*Y\246b@\335\233\260&:oY\311)3\354&\224\332\326C\340\336\350"
+	.ascii	"\372\036\317B\371\277\343cf\013\206\2274*\250`\202\235gU\362"
+	.ascii	"\342n\2207P\312\3645\301\314&;-\340\320\222c2\001\3768\273\322"
+	.ascii	"\367\024\254\341S\260\374\372\277\314d\rR>\331iI\346|\325\001"
+	.ascii	"#\307h|\365=\005`I\222\230\311$\033 3\262\246\357)0\322u\323"
+	.ascii	"H\227\231\354\273\252\314WZH5\036Xy\223&\216^\216\302\352`\022"
+	.ascii	"\221\213R\343\310\315\344\337\316\312\324Y1\275n\026\371wt\304"
+	.ascii	"\200\231#\353{\242<l\016\271I\344\3371u\244`\346\253"
+	.string	"\357\211\324\340\337\024\362\357\370ti\341\262\246\357\211\314\340\023\201\301\\&\227\t\244\222e\252\n\236TA\363\245\227\363U\207\237#=d\254\351\373\233?n\002y\273=\306\340\b\322\327\364\3617 \267\2611D\336\226\270\201\251\365=\021\024\374\233=\314\036\235\f\001-;Yu\200\333*\243'T\204\216I\337\023\305\300\277\311\303\344a\275.R\231\2512\210\365\330\272\n1\245*\252\3573\350\341\337\3142\263l\332u\n\312\371\207\324\224\\u\365\301d[B!\373>\203\2276\277r\332\230:\212\306\224H\240\031oj\0315\026T\350\233C\007\006\2165\264\276\317"
+	.string	"\207\305h\3349f\036\203\274{\025<E\221\020\326\005\312tQ\351\272BPA\313]\224YU\351\256\2022\224\033\0134L\247\273\367\203\024\312\331\007\227\244\r\023\207ye\3260S0o\324\245I\303|\361\"\223\206\371\264\345.geO\030\274#t?\367\316\371\231\n\236\242H\210R\306\2542Q0\251*][\022\273)z\246\2259\243.\315\252\"e\316h\033.\300!\243\027\345\274\277Ie\312\230\"\245\343E_s\252.\347`\370\350\373\f>\360o\302\250K3\006\320\213$r\214\3645\245~\006\005\244\024\214\303\325\240\362dK\337g\350\201\237A\007~\006\031f\013\f\346.\213K\337g\210\302\317"
+	.string	"\205?\264\207?\344\006\177h\r\376\315|\367\314\245\\\033.w\257\232\331m\211\361\324\367Ch\360}s\343"
+	.ascii	"9\231\002d\255\357/\234\377;\024\030\322e\255\357m\241\347\216"
+	.ascii	"$\247\372\376\352\375\2141\2226\326\367\327\315\377\035sm\257"
+	.ascii	"\r\216\2767\017\273\030\242\313\200'\313\215\207\016\274\337"
+	.ascii	"\274\377\322\365\027\021\354\311q\323\267Z\t\361\213\307\005"
+	.ascii	"\313\235X\337\017\231u\371Us\273\3345=\246D\246"
+	.string	"q\260>\374\240\225\2559\242\204\212\233R2\327\367\236\271i\356\335\277\263c%\206\035V\337\017E\301\277h\272\274\024Y\322\267\353\341\316k\346\227\205\177G'\254\n*\255\357\207\300\360/\231[F\213\025\024\372~\b\t\376\035\363\177\347\004fz\200\365\275b\260\213\241\255\fv\312\220\235!R\367+\346\277^\352\333\r\023C\307U\232\276\367\313\005\363\033\346\332\345\033f\003\255\234\235n\030\24089;\001\325zA\255\027\\'\\G\324\316\373\241,\374S\207\316K\027\342\267\256\217\240\315\315\365\275P\207\316c\210\203o\275\352\325\362\213\340\340\316\335-\326\353\346\253\214\\\303a\311\030\ff\3601\304\311\311\201\260dK2\213I\0315}\217!J\\\034\007Qz\260\264\260\001\246\3571dY\261r\261\300\271W\276`\341\001\367\213\305'\317E\034\265\276\367J{u\221\003\304\t\303\024\025*\266\013?Ei9qm"
+	.ascii	"\226\344\210\034n!F\325\245\357\205\354\356\333}\263vG\250\276"
+	.ascii	"\232\344\253\253\016&\226Y\231\331\0254\264\333F\304\322\355"
+	.ascii	"\220\302\302\366\333\2463F\025\303\256\357\361\356\332\377\035"
+	.ascii	"\2365u`\304\364\375\357\332U\343I\201\214\024\270\037\246\020"
+	.ascii	"8)\260\365M\263YYd\345\212\304\261\351{\2414\374_\263kV\204\352"
+	.ascii	"KO(\312rY\335 a\265'\"B_\370\025\254^\262Kvr\351\330Ac\313\362"
+	.ascii	"\326"
+	.string	"\367BC\260Ri\253\340\334&uq\004\341\201\327\367BX\370\277Q\242T\263\020\256\264\254\030[c\312\030Z\337\013U\205\205\325\274\020\272\264\356\013\247 \\\232\344|\365\201'\005\2572g\372>(\215\023'/\272\004ii\322\244\266\205\320\245\345\344D\200%Vo\302\364r\216\373\320K\234,\275\372>\210\r\377w\311\335\272*t\222\003\2242[\365\b\361\242\372\322\013\212\202\037d\004\377\"\251W\211\022\353v\225\331\212\247\314\253b\315\265\330\322\367A?\360\253u;\377\233L\276\271\302\3775r\215\264\032\tA9\007I\223\f\232\362\362\252wg\325\216\324\013\275\2739C\206\264\031\022V\013\022\347\256MW\027\234$\020\031\374_ \027H\275+\n\312Pg-$\201\350\256\017\037\325\f\204\216\332\0134@oZwK\253G\217\264!=Z\242,\273\364=\020\031>\220\021\374\337\035\313\273\243\232]$Y\246b"
+	.string	"\2227aMr\216\373`n\345\271\001\353{\240',\254\232\327\312\\\305\203\202\324O\032\374\337\034\313\233\303\262]'\262\214$\201\034\017\271\252%\357\006U\030\033\367\312\306\215\033kg|\222\210\371\252\321\367?n\370?Gh\320\250y5O\301.\270\272\356r\325\325\007\005\200\345\3201cFm\273N\312\\u\226\361\210\373\320^a\244\220}\377\023%\343V\311\260U\316\234\253R\213\252*_Uu\270T\227\312V\301\310\232\026\343\252\003v\362\326\246\025@\024-\036}@\324\030<\242@\n\212*|@\364x\f2\371NHB\227\222\200@\200"
+	.string	"\321\201\006 @\200\360 \204\257\3703\252\340\031Qb\030\374\031w\220|)\252djP\032\006\225\206D\241\017"
+	.string	"#J \371v\276dtL2\036%\241\330\360"
+	.string	"\f\22481\202\b\276\007\214\250@\t\276\021L\360\231(!\204\204\002\211%\024E\030\2268\236\220\024LM\240\306\337\206!\032\364%\243#b\360\204"
+	.string	"*\004\301\357\030\004\n}\311\be\n\246GG#\232\"h\004\246\276c\t(S0\305\307\240P\030d:\217\304$\236a\360\310\363%\243\243P\370K:\246A\020\0345\r\225\022\260\242i\030\024&`\203\016|\035x\260\342\b\0056\t\223\206\301#\343\261\351\350H\005\321\270\224\022\207:(~\250\360\246\307!1\311D\221\032Cp4\277dt\\J\177LGC\"\023\0231\t"
+	.string	"+\210\306b\361\347\0231\374\245?\237/\031M\340D\t\023G\034NH\"\nG@\215\304\021\200\200h\372K\021L\223D8\3762\200\002\211L\306\340o\210E\2218\002Q\372%\243b\023\321\250\3443\242)\312\3643\376\212G\004H\0326A\240g\210\242\315\243O\251\350\223\372\206JEs\250T\264\250\b\202\307{<\242F \360\247\303\242HL\272\306\264h\177\201\2051=\006\225P\023|\033\200\350P)(\374\351"
+	.string	"\321c\323=\352\374\227\376\200JE\243\037\343o)\351\372\320\364',2\241'R\364\210\232\240T\344\020\004\302\b\035\022G\024Q\324\001,\200?\324\204cQ\t\303P\204c\0066\240@b\t@!\221\004\340P\004\224\211H\202\221h\342X$\301\241\250\302\227\256@\207\276\024\005\322\200\224\016Q\243\261)I(\r\016K\374\034G\224@B\217\0278\026\225xx\200;\250Pi\270\223\3427\274\2404\f2\031\177=_2B\215\304$_\022\212\243$\240\220H\202\322\217I'\005Q\311\307\342\247\002\003\320\205\r\214\214(S\360D\221H\024\372R\374\206@)~C\fD}x\230\232\216?\032\374\214(vP\324\250\204\362"
+	.string	"\177\250q\005\n\034\006}~\351o\204\n\224\002\307\"\211!q\350KFI>\224)\230\016\233\214GI\351/=\362\240@ADO\370\245\276\024\277\341\020\326\020<\022\213\276\024=\242F\237\t$\022\026\fa\310"
+	.ascii	"\204Qj\374\025\215P&\"\t\304\023Cb0MB\215\301\021\300\241\b#"
+	.ascii	"\320\364'l2\362I\361\033\n\245\370\r{\202|\302\3370\250\0244"
+	.ascii	"\0225\234\220\3643\246\307#\321\230\344C\323\037\260\330\344"
+	.ascii	"3\201D\202\210)\311g"
+	.string	"\002\211\204\206\021%\220R\374\206g\212\337\3202\241\351\221\205\t\r@D>4\375\031y\202\214D\243\0215\211\305 \341\257)M\372\371\354\2040\002\n\211=C\025\304\021C\342\004P\341/\351\3503\201D\"\210G\204\021\320H$&\371\244\370\rO"
+	.string	"\31548\f^\r\214\322\3400x\262H\203ID!\232\302\227$\374%\371L \221\020zR\320\210\016Q%\374\r:H@\007\036\254\320\271\007\037\200\370"
+	.string	"\304y\017>\b\021\342\203\016B\340w\020\302\006\245\276\243\021\0256= \375\021\245%\210`\202\bH\276\021%\220vP\037\260\304\n\"\bt\200B\324\207\002\211%\030\321\"\212\202\300\007\365\035\225~B\b\240@b\tBJ\303\240\361\207\202\300\227\242J\306_\372\203&\r\177\3511\b\364\025U\364 e\300g\002\211\304\2112\021\227|&\220H\340\364\024\022\211\016\360\231)j\302\322\361g\034\001\030,b\3709\372Pa\020\005\321\210\004\f\026}\322/\031\001\203\305\021\365\350\363"
+	.string	"\030,\236H\265D\005\006\213V\305\217\005\217\b\226|(\212B\037\021,\375\240@AL\233\222|KI)q\210\001-\262H}F4\025\006Q\370\204\322!\232dD\221\322a\220\210Tl\002\016\203\031\320\320\243\342\267\001\246&\023\300`\361\3478D\213L\304\021\200A\244\364\007\202\024C\303`\t\251\b\300`1\b\025*\rE"
+	.ascii	"b\221\006S\004\323\340q\210\232\020\242)PaP\232\204\242@1\224"
+	.ascii	"\032\321\342\n\324\227\n\203\251oH\024A\320H\\*:\201\n"
+	.string	"\323\224h\\:A\3010\370#\2012\031\3214\230\201\030L\177&\254\370\tQ\0230\244KJA4\003&\230\214h\n\0342A\305\217\205P\032d\nN@\210&%\211\200\246?\343\017P)\b($.\035Q\343R\352K\207Ab1E\217E(S0\345a\361\023\242\300\036T\2504\374e`aDS\020\223P\243o\351\3703&\r\251\370\031\355\227\214\232\230\202EB!\321x\227\222\322`\321T\361ca\217h\223\360\227\342L}\"4\370\322\321\247\024D1$\216\200\341\330\024\004\376\214\276\242\n\337\261\250t\001EQ\350;\026\225t\320\364g\364\251@\205J\303 \360\207.\371\216B\2421\035\022\2232\f\203+~L> \212\026\217\276\024\277\341\005\024Hd\362\025\177:#J Y\036#1\375\031\225\320t\030\344I\233\212\303 \017\232\"\230\376R\004\215(\320\227\036\177B\240\264\251\2306\021\317\013"
+	.string	"\351\204.qB\2178\241W\374\230J\\\235\243\357\227\376F\f\211\301\264IH4q,*\t\245_2:\026\225\216\210\301\f'\026Q\343QJ$\032\217zR\341\317\036}I\304\t\034\213J\027\322\237\320\246>\021\032\244\303\240\316\220(\264KB\241E\201Mi0\025\376|&\220H\370"
+	.string	"Q\264h\242\007=\032\233\210#"
+	.string	"\207MD\243\222O\352\353 D:\f6\341\"\021\270tS\237\007\3510\330\244\363\005,`\004\016\027\240"
+	.string	"\t\234d4$\006\323\237R0\305ox\224.)\005\205(\216\206\301\037\323Q\222\361xddA\3723\301\3244<\177\\)\023n\r\331u\3720\301\346\336\2260\351{\3628y\234[5\023@\211\231\036?\267\360\2145_\342\372\236Z\265\355\205\0226Q\244fX\331\321\367\033^\340\300qf\355\3608\311\242C\213^\276\242\221ub\351 \202F\206u\352H\002F\314\025\213\246$\0237\006y\346\350\035g\217\245\227\260\276/\312\303\247\215\323\306y\203\004$U\326y\003\211\022\256\030}_\024\006\377g\2151\0363&f\320h\230g=,\320\345\200J\301\272\001\221\371Z\2027\343b\271p6\227\303\311\n\312\217\215,\272\032U\346\232\032'y^}\377\223\312\262y\320\003B\326\367\234:\247N\0305Wy%\213\346\360\211\302\211\302\t\203\203\0344\244~\302"
+	.ascii	"zb\245\306f\nV\372PQ\021\321\352{\2668]\374|\361\363E\237/\354"
+	.ascii	"\336\336\t\345\313\331y\317\247\363\351Dbd\316\310\240\374\004"
+	.ascii	"&.Y\244\026'\316\211\304ig\376\211\354\261\266eV_s\257\312Y2"
+	.ascii	"F\346\314\3655\347\334\r\007\332\233[_S\216\211\307\240\215Q"
+	.ascii	"a\231\227g\276\251UU\031\001b^\320\320\350\360\233-\334|\003"
+	.ascii	"\347\202\2056^\372\232z\030N\232\330\227\276\246\233\303\351"
+	.ascii	"\314q\341\342Q\344\004\243Ac\266!\201\247E\030\233\233mj\204"
+	.ascii	"\313\250sq\264R4\252\345 \f\305\224RH\251\222\232M\322\001#\025"
+	.ascii	"@0PD$\026\212XZ\037\023@\203K+\345\241\"\205\210)33\"\"\222\222"
+	.ascii	"\024\024\024\262q\256P;\304:\333+\020\266A\354e\360'\005\037"
+	.ascii	"e1I\007\203;\201\224\326\246:\351$]\344\2333\362vg,\330\036\002"
+	.ascii	"$\314n\213\036\263\004\200l\034\321\322\302Y\203\001\333(\310"
+	.ascii	"\202\317\005Y\241\307Dy'\210\230\363o\032$\0072\371!Q*\224\355"
+	.ascii	"(\252\017U\257\230f\006\362\222\203\020 \037P-\350\032L7\304"
+	.ascii	"+\251\r\016\303\356\224\244b\356\326\027n\210\002\231\327TE\252"
+	.ascii	"q\"\023N\254\355\001\363\324d\031/\303\342\036v\034p\320\204"
+	.ascii	"C\340bn\371\025\233\035>\356\222\310\232\321K+\\r(_TS\235u\t"
+	.ascii	"me\331\272\252D\375\320H4\205:\037\302\354V\243\3332\375z\363"
+	.ascii	"v\356_S\233\364E9\205\254\030&&\236\201\344\031s\205\30335\023"
+	.ascii	"\250\350\022w\021\031\311\317\035M\001s\207\356\372\313J3S\312"
+	.ascii	"\371\235\316f#\274M\311\032\234\t\005\264\271'\005\313\006'\002"
+	.ascii	":0KJ\354@\277\323\376\322\243\237\204\361\311U\350Y\215^\250"
+	.ascii	"J\357X\202\030\023\202\037HI\202%l5X<\303\310,\351^@4\244\320"
+	.ascii	"\324yqSh\327\n\351\264P\344\3243\270\356\035\b\243\214\005\225"
+	.ascii	"@C9{\013M\207\225\235\362\234|C\0248T\352\205:\232\272\363\260"
+	.ascii	"\302d\343\223\223p`\372\364LVn\350\340I\366\271b\374\262\265"
+	.ascii	"\351\336\317/\345!nI<d\n\326\331\332\263\002\351\336\225\302"
+	.ascii	"8\035p\013$nj\206\362\324\355\274\350\375\231\360F\305\f\306"
+	.ascii	"9\351e\033oL\266\306p\370\001&_\2045-\315\324mUZ\227\t\026\022"
+	.ascii	"\201\242b\215\322\335\273[\230s\2737\255W\373o\274\243\031=\371"
+	.ascii	"\333\372\f j)\350\207\356a\035\317Kuf\226\270\216\237\314\246"
+	.ascii	"\244\300\3770\3050R|\345\tj\342\314\257p\251\rj'\211\03572\333"
+	.ascii	"\255\320s2ZN\352\200\334\332@\240\026\336\253G\276n\315u\337"
+	.ascii	"7Wq2qbKC\362\324cMa\r\013\264\221\263\344\253\303\301Y\313\006"
+	.ascii	"-\277\025\021\345Y\377\242e\327\353\352\366\225\347\261\021\317"
+	.ascii	"\214\215+\317Qi\017Y\317\341\360\241;*$v\215R\204\005\364\277"
+	.ascii	"(Zp\272v\203>\200\023\257(\301\\YBo/\222\030\220\037\004\r\214"
+	.ascii	"~\277\225'j\005\302\022\240\213\214\221\222\273\224\277Ke\326"
+	.ascii	"\304\341\206\300\261,\314\312,<\034\037\327\260\021\302:\307"
+	.ascii	"\331?\017\t\232*\b\001:\204\037\222\024\tH\277\020\216\302\376"
+	.ascii	"\340\357y\013Q\333\027\334\f\370\261\033\023\357\303#W\\{\326"
+	.ascii	"t\200\206\336m\277|2\302\257\300e\222\250\2751\"\024\357\240"
+	.ascii	"\276\211\352\217Ur\202D\2313\2565\177T\245\222\332%w\032WhT\257"
+	.ascii	"\266-\252\222#\016\317"
+	.string	"\314oE\2261`\202\371\007\244\356\367\210P\244\022\244j\264\306!C\245bC\034\353\331\312!\362^\210JC\264\177\327\003\230&\364\222\200\300:\003\335\213\373\354\231\350\037\370~E\b\211\024m\344\307\251\327d%%L\351\363\340\324p\275\320\326\330si\367\340\004\262&\312\337)\252\310*j8k\355\246@\345\335V\021\334"
+	.string	"\220\335\322Q\315I\337F\2114&\313\031[\260\334Q2_\200\313t\356V\361tz;J:\364\221\313;\364k\024L\227^"
+	.ascii	"[q\2710\354\020_ \020\266PG\247[30o\201\331Xqi\377\332%uC5\205"
+	.ascii	"\fh6F\003\272T\343Ak\265\351n\262\225\026\0340\311\265Mgb\204"
+	.ascii	"\331\304\244F\352(cm\f\302\335\033\0351E\277!\006\313\213A\334"
+	.ascii	"a\330\354\245\314\002\1770 \246\265'\334\2320\311<\340\272]E"
+	.ascii	"e.\3552\377}\251\241U\203\005u/S\226\037W\206\273x\007w!\216"
+	.ascii	"LWi"
+	.string	"\256\347\013/m\335h\222\374\203\351\300\202\213@u\t\361\"\363\371\020\326CWe*\327\002q\242\334\256\276G\272\351v\365\203-\347\nQ\235\023pX\346\264\200\002Tg\237\252@+\333\033\3460\334\200\237\246\374\216\311\377\306$\266<N\035`\373\306\222a\030^\351\341\241\237\302\264\021\346\223c\333w\\lB\375\024\031\376\263\016\312\344\020wE\374^~=\n\346;\200H\335\\\027p\214\030\253\322\255\331[\261\355\020\0139\346'\246\246\307\220\305P\177([A\222\033\217z\177C\210n\240\240\214\332\336\030\361\205[7\002\224\225l\343\216\204\247K}9\224\004\265\025\336P\n\226\231\357\240;\240\206\265$F\013\371\201\tL\305\332Xt/HwG\304];\333\343}^06\004\355:0\024*\367\02509\341Dph\327\340O\226\226\323x\231\260\233\376{|\0133_j\006\r\013\235\335\333\030\247\237\022k"
+	.string	"I\273\355\1774U\004ENJ3\3520Itz"
+	.string	"H\231\221\241\204\264\342\027\373\337\026]\342\032I\037AY}\266|\332\300,M\263,\335g#u\270\251^\303\r%{j}D\324\t \270=\314Xd\312\033<"
+	.string	"\344J\272\345W\317\b&\240\323!\024\005,\240\216\344\362\0170]^\266\260\251"
+	.string	"o\236E\364\002i\307\005AC\256\302\212S\020/wAB\033HR\307d;\355\205\023\2467\343\307\220\275\365\023\316\032q\262\326\356\202U \214\373\r`\217\263\312\261\263&\b4J\232y\212bi\263\325\362\3742\375w\223+\266J\370b\t\207=\320\202\254\346\362\210m5i\023\364d\354/\376\322\200\202\203\325\227g\004"
+	.string	"\263\377\0348\200\031\214T\320l\372\026\341\276\210\022\001\256C\202\222\033[\230\021\310\2731\340'\352\355\b~b\372\001\231j\036\366]\020\016|\034Eu\363\250/\\G=\n\201\323\274\203I\026D\207b\370\240?\375q\345\r\227\340\253\027;f\212[\236$\020\232\013[\240\020\325\001\330\234#5\274\340\220j\003\214\271\205\345\002\332\201Q\203-G\177a%m,\356\325\232\213>0\320c\331z\220\325\217\002K\304\333&\260\330\301\026\212\2266\250\"\332\356`q=&9|j\036\365\002\35711]\307\024Q\335\034>x\202\345\202\314\2011_I\200\214y\312?"
+	.string	"l\220\274\335~C\303\036\213"
+	.string	"a[\0060\251H\030t\037u\333\354\315\373\232\333\360\324s\374'\0034\205M\2613O(\016P\001>\272\"\311\016"
+	.string	"\030\277\350\f\374*^\256\235\324\371p\313>\260\310\022\272J\177\332\256\234\340z\363\271\331\326>\271\333\254\277a\026\257\236\007\370\031\327\020{\004\322\273\247(\322o\277\261a\304\274a\314<\306\312A"
+	.string	"\273\215=\037~\335qq\343\255\371\262\222\303\207\300\3433\227\311'\024\373-)\211O\315\n\215\333$8\230\206\321\376\337W\307TV\227\256\367(`\225\231\3564\023\374\020\231\201\306\2219\247\233\257b\013\260JL\244\3179\035\304#\006w4GO\303\313\341\241\336\203\332\202\001G$ \324Yf\016\273\211\303\016\371\270\331C\f0Ww>\206\260I\232{\324Z\363\222\207\255\262\006\222\374\374\266o8f"
+	.ascii	"\232\t0\367\307\001\270\020W\325\336\354\317\034\350\351\300"
+	.ascii	"U\242w\326#\037\021\303\202\325T\226;\032\325\017\206\301\252"
+	.ascii	"8\213\307,\343\356\251\232\260\021H\252^)*\037\013\357^)K\267"
+	.ascii	"\035\023[a\341\255\204\241\345\"<\311\250y\322\202\274J\224["
+	.ascii	"\375\326\3148\002t\343\274\007K\370\263\322\224\377\373B\215"
+	.ascii	"H\007\013\300\030\370\n\344\370\035h\022\207n\037\376\206\200"
+	.ascii	"\313cN\376y\337\241x1\0211\037F\365\022\3224EAp\236\365{\277"
+	.ascii	"\315:\343\006\311\0372:l\332aO'Bv\215\3558)\345Ec3\222\226E\t"
+	.ascii	"v\236n\231\027\230@#\342\002^\327\347\355\272\fJ\274\306\202"
+	.ascii	"\377p\366NX\236\311\236/YrHO\272\201\357GK\274\022\377\207\203"
+	.ascii	"\276\217\016\245\245\374xva\335x\303\237\376/\216\373\n\362\351"
+	.ascii	"\01303\302&F\354\r/\334,\234\247\356_\342\335\227\215=\261\337"
+	.ascii	",\234\342g\252\256w\344\205\376\271\263\313\334>Z\236\177\320"
+	.ascii	"n\201\363\274\347\004\b\017\3555\035\262\317\215/\226\325Z\272"
+	.ascii	"l\343k\202\373\002\347\023\247\267'\331\201'\017c\337\213\330"
+	.ascii	"!\3051\343O\226\223\034k\376\025C\362\265\221\237\002z\356{#"
+	.ascii	"l3bnq\360\204\325]]\376\0302\347\"\\\213>\371\305{F\226\3263"
+	.ascii	"B\3666\3043\223\031\261gY\n\372+YEpe\205\227$\275\021\336\221"
+	.ascii	"\224B\352-V\277\224w\271T\237\313\277\021\006{5\377S\236t\317"
+	.ascii	"\203qq(\367\212\323\203\344\234H\375\205\323\341\356\346\314"
+	.ascii	"q\013\320Ey\303\020\2776s\312y\033\267\236\361\331\273\004X\343"
+	.ascii	"\361!h\376\022\261\016\326.7\347\271\032Ni\270k\355\312\360\005"
+	.ascii	"Af\2208\371\350\006t>\344\007\221\215\216}\002\016\267l\277\307"
+	.ascii	"s\fR\265W\277Vt\200\336\377\320\033\200S\276\344\035\035\275"
+	.ascii	"\235~\263\267z\374\202\261\371\276d\215\207o\304=Y\035\357<\370"
+	.ascii	"\353\367\320\374\324\017/\243N\3618J\352\033\313Y\372\035f\247"
+	.ascii	"\261n%\367u\007\375\217\002\016\"\257\001\276\263\273\310\366"
+	.ascii	"\251\202\037\200x\326j\024\216\315\254NR\350\255\330\n\264\230"
+	.ascii	"\353z'g4\371\332\3166\313(]\215k\273\265+"
+	.text
+	.section	.gnu.lto_.symtab.6cb5756ce5f5905b,"e",@progbits
+	.string	"navigationConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\001"
+	.string	""
+	.string	"GPS_home"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\001"
+	.string	""
+	.string	"GPS_distanceToHome"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\002"
+	.string	""
+	.string	"GPS_directionToHome"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\002"
+	.string	""
+	.string	"nav_mode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\002"
+	.string	""
+	.string	"GPS_calculateDistanceAndDirectionToHome"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\002"
+	.string	""
+	.string	"onGpsNewData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\002"
+	.string	""
+	.string	"GPS_reset_home_position"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\002"
+	.string	""
+	.string	"GPS_reset_nav"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\002"
+	.string	""
+	.string	"GPS_angle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\002"
+	.string	""
+	.string	"gpsUsePIDs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\002"
+	.string	""
+	.string	"navigationInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\002"
+	.string	""
+	.string	"GPS_set_next_wp"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\002"
+	.string	""
+	.string	"updateGpsStateForHomeAndHoldMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\002"
+	.string	""
+	.string	"updateGpsWaypointsAndMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\002"
+	.string	""
+	.string	"GPS_hold"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\001"
+	.string	""
+	.string	"pgResetTemplate_navigationConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\002"
+	.string	""
+	.string	"navigationConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\002"
+	.string	""
+	.string	"navigationConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\002"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\002"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\001"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\002"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\002"
+	.string	""
+	.string	"magHold"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\002"
+	.string	""
+	.string	"atan2_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\002"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\002"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\002"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\002"
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\002"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\002"
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\002"
+	.string	""
+	.string	"areSticksInApModePosition"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\002"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.6cb5756ce5f5905b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
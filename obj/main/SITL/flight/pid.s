@@ -0,0 +1,1822 @@
+	.file	"pid.c"
+	.section	.gnu.lto_.profile.bf4a7a3e0dc1393a,"e",@progbits
+	.string	"(\265/\375 \nQ"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001B"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.bf4a7a3e0dc1393a,"e",@progbits
+	.string	"(\265/\375`o\004\355\022"
+	.string	"\024\026c\005"
+	.string	"J"
+	.string	"\235\220\226\317\003"
+	.string	"\001\313\220\356\235\n\002\230\210\312\207\b*\002"
+	.string	"\002"
+	.string	"\002\001\002\002\003\002\004\005\002\005\006\004"
+	.string	"\002"
+	.string	"\003\240\342\234\212\n\005\t\215\346\200\332\t\200\001\002\003\002\007\002\003"
+	.string	"\002\b\002\t\002\t\n\002\013\002\n\002\007\002\f\002\r"
+	.string	"\002\016\002\017\002\017\020\002\020\002\021\022\002\022\001\002\007"
+	.string	"\002\023\f\n\013\f\r\016\017\020\021\022\023\310\214\304\233\002\020\002\024\006\002\006\025\026\027\030\031\222\333\250\352\007\020\025\002\026\027\002\027\002\001\002\001\034\035\036\232\373\214\201\t"
+	.string	"\037\266\210\226\325\b\004"
+	.string	"\002"
+	.string	" \303\216\256\340\002\002\002"
+	.string	"\002\030!\"\256\330\276\211\r"
+	.string	"#\315\343\301\244\013$\356\363\250\233\t\002\002\031\002\031%&\275\202\205G"
+	.string	"'(\250\340\235\355\006X"
+	.string	"\002\030"
+	.string	"\030\001"
+	.string	"\032\002\032)*+,-./012345678\245\362\231\361\007\006\002\0339:;\226\266\306,\002<=\354\242\3530>\347\210\203\377\003\b?\273\254\302\232\013\f\002\005\002\034\002\006\002\035AB\256\240\347\262\f\200\001\031\002\031"
+	.string	"\002\034\r\036\037"
+	.string	"\002\030CD\352\263\360\321\bEFGIJ\336\215\314\344\rK\303\263\324\306\bLMN\265\263\276\320\005O\207\375\321\262\fPQR\240\342\234\212\n"
+	.string	"\200\227\250\201U\201\211HIR\220\fs\240\2021*\252\003\022`\203+&\332\210I\n\nJ\365i\r\200,\022'\240\004\222prF\020\275\323\017\255w\237\265\263{\363f\\\3545,\177\2045\332\024\301\222\314\022\344*\207^\007'2@\211\302\004E)r\370O\013\035\242N\256CfF\260\213\\\023)\217i\325$Ah\311gS\345C%\277P\230o\001\320a\230\244\361\347\0176\225\352\333w#"
+	.string	"\031\275\371\372\247_G(P\312\216AW\360R\376\221\343R\221|y\276\374\247MX\006\300\2425\313j\340\367q.\\%3\225\376\033"
+	.ascii	"(\264\3228g#~\230\211\315k\024&\3236\1772 \213=\3373F\254>G\030"
+	.ascii	"{\327\037\213\2739\226\351\006\367\267^.j\240\315\345\r\262]"
+	.ascii	"\277xi\273#\374\001\312\323\262\304\352\251(\221_jG\030gc\331"
+	.ascii	"\223\372\310\321\262\317E(O"
+	.text
+	.section	.gnu.lto_.ipa_sra.bf4a7a3e0dc1393a,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\355\004"
+	.string	"2E\020\030\220+\215\001\357\356\356:\325\035\230\260\335~\313\002\n\273\r\b\224R\246\024\367\320q\351\0062\031\273X\305\2070\2077\\\330\363\004\243\244\355\304\305\007&\220:\365\t,\315\300f}\373\252\326^\200\243( P\2021\013\351\001\257\004\210\017\205\220CY\213\027\001\020\016\241-\330\212\243\f\002i\016J\002\236v\264ym+c;"
+	.string	"\316\250\0037/\302\033"
+	.ascii	"\030D\r~`_\251\035\260\233\305\033fAX\200\265e\275\260\205\324"
+	.ascii	"\270\226\227b\2760\311\326: \347\333\006(\340\002\f\001"
+	.text
+	.section	.gnu.lto_.inline.bf4a7a3e0dc1393a,"e",@progbits
+	.string	"(\265/\375`L\006e\026"
+	.string	"6\335`D\360\220(\3518cx\223\233\f\306c\207\243\343\356s\251\322|'\354\203\335G\230?\343\310B_\007U\341U\006\316W>\330\203=\207\301I</0o\205\311\"\026\306H\nG\316\340\032\326\320\250\376A\266$)I"
+	.string	"S"
+	.string	"J"
+	.string	"2\330\034\314\307\021\324\215\343I_j:\214p\252;\375\370I8\233J\303E\306\206\001\217\302\030&V\264\220\320\377\325\355\306\024\332h\361\3101\314?\332\360\335\310\353-53\223\363\250n\231\031\322w)\214\311Te\377\031D\024/\201\t\363@\206\314T}B\232\314\004\331\300\243M\244\330%|\223\020\357C\254\346\303\t\017\013J\272\003\327\352\\\307Tm^j\2440\231\200\333\235a\252+\031\226\013\f=\245\025S\342\227\003x<\030v\337\357Rp\3502C\242\245\300\237\024e\007\016\026\027\267y]\356R$\3224\317\2517\245\256\2602U\035\230\314\234"
+	.string	"\372%\r\336\340\241\327c\341\241\267\341\241\256\304\340\241D\016/\227k\271p\r_\003\030+TEf>\263\311\305M\001\376 g\372\030\364\223\332\022\226\240\352\322.5\1778\207\270\367\216\204\323\321\226\241\212\b\033\035\"o\241)0f\274@\224\013\325\240\002\242GWG8\365\323W2S\300\020Ley\261\b\221\241h\271\261\312~\320\035\270\006?\332R\315f\340\301\260\367\232\223\0203S\313\374\204\235\353\301\260\314\227y\216\004\200\241\250\001I\312jF\222\202\202\024\232\003\260\002\231\2311z\022@$1F\223T:\024\020Ia\n*Y\3663\247"
+	.string	"\017\211\306\331HIC\017i\325\372\300y\226D\301\241\021\262f\225\266\334\230Q\315\341\314)N\371W\240{\026\330\214\310\347\013u\330\252\t-\027(\345'\316\362sb\017\265\315\236\354\203\204\313$\260Z\316\f\220\270E\215\334\020\343\231\032Pp\211\240]W\177\267\330\226U\344\212\264j9\325\224\204\261\247\tKt(\335e\243\311\355\001\312\016\005\332\215\025Z\245\260#f\254\226\177E\217\226\357p\364\251\315p\004\032\231K\231\341\n\243_=\304\220\330&\224|\324}\321I /\256I\020L\340\223bH}?3P\302<8I\003f=)\202\303\302G\306x\331\253\013S\244A\317\002u3\232(\016\210.O\0266Tm\273\274\377\006h\226\364\320g\325xn\333]{\244\037.p\235i\231\271:\005b\253\245\n\354v/\007\252>\026\235\034\235\254\203\206\202\262\311\224\2742\006\002o"
+	.ascii	"\271\272\322\302[\303\271\274\3038)\354k&b\tt_W(\331\305oY\204"
+	.ascii	"\256\300\364\221'\025\312\247\260\250\322\316\t"
+	.text
+	.section	.gnu.lto_.jmpfuncs.bf4a7a3e0dc1393a,"e",@progbits
+	.string	"(\265/\375`\371\003\005\f"
+	.string	"\342\016+,pK\222\016\0047\276\212N\303\233q$9\250\252\352\325\"\\\275\252\242\314]B\006\303Q\376\232l+\373H\234\321\221Z\302\366\226I\006\204\034\317\032k?\fT\207k\312\355\225\277(\332\352W\214\224 #\n\321*\371\320\005ch\265\216D2\211\220\220\004\2047\256\323\373\007\274\263r\322+([Fz\247\1773(\205\200\225\nS\030\013\200\262> \223i\270\363\f\261R\332\370w\201:\321\b<RJi\326\323\240\323k|\306\235\350iPK\353=\276%/\227\311\201z[\320[Pg\205B\213\274\332\303\355\231DN\257\236\003\264\216W\250\2611D33\323:Y\003@\002B\224\262:\017\022 bI\002\016\346HN\031\207\034\232`\346\322\302\326\263v/W\331RZ\367\371\253^\372\n\024\312T\244\325;\327\022\267a"
+	.ascii	"\331\364\214\331\001Q\"c\245%\"S\267V\223 \005B\232$8F\371\030"
+	.ascii	"\024\214\340Y\364\360c\201\361<QX\3408TT\361\324<\277U\031\270"
+	.ascii	"\241\342\211\232G|\275\277YF\305)\312\317\r\203w\241\246\217"
+	.ascii	"r\306t\333PN\020\316\f\365\236\273\242,<~\001gS\305)\234\217"
+	.ascii	"\017c\003@p\251\200/\324\317\245?r\030\200\362J\201\313q\265"
+	.ascii	"\304\337\3644\262\246\006\351\316R\0328E0\245\311\225\320\313"
+	.ascii	"M\363\315\201O\351\303\367\227\201\3442r\377\237\350j\177\237"
+	.text
+	.section	.gnu.lto_.pureconst.bf4a7a3e0dc1393a,"e",@progbits
+	.string	"(\265/\375 ;\331\001"
+	.string	"7"
+	.string	""
+	.string	""
+	.string	"\022"
+	.ascii	"\230\004\002\232\004\t\232\004\023\230\004\031\231\004\036\230"
+	.ascii	"\004\037\230\004 \230\004\"\230\004$\230\004&\230\004(\231\004"
+	.ascii	"8\230\004;\230\004=\204\004>\230\004?\230\004B\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.bf4a7a3e0dc1393a,"e",@progbits
+	.string	"(\265/\375`S\002\325\r"
+	.string	"\226\326D8PM\223\341h`\025\265\315\316\254\362\226*\223q\316\024\3451\n3Kx3\337\262\3701\376\331\332j\303@\207\tR{\026G\3207N\033\377\032C\270\277\215X\262\245L\001/"
+	.string	"5"
+	.string	"7"
+	.string	"\334\322\210\275\371\327\327sv\245\235A\371\204\224C\332Z\255\277\034?\223<\322N\351\224\224K\312\376\307-\364a\304\333`\035]\360"
+	.ascii	"\003x\206\t\230\266Y\225W]\004\037C\222*\b\2558=\322\355A\271"
+	.ascii	"\203\316Jy\245\321ui\204=>v\315;\325z\352\371jp\240\215\247F"
+	.ascii	"\224\310\360\336{;\327\300\230\007_\250\200B\231@\202`\202\324"
+	.ascii	"7P\300R\r\356\311):'\312':%\224w\352Z)\216\013(\003\312\030\""
+	.ascii	"  \262\326\220S\316\231\233\366M\247\246<\023\241\023S\036S\025"
+	.ascii	"\026Scj\242*,&\307O\312'\275P\350\037\017FA\013\025\332\016\347"
+	.ascii	"7gf\313\352\343\330\345\032d\315[+\210\001\215\036\346\2561\353"
+	.ascii	"\323\242\357\002\f!:px\007I\250\3418\t\221\220\320\004JRXX\003"
+	.ascii	"P\202A\252\210|\021p\265b\024M\n\222a?\003\266\3413\320\002\356"
+	.ascii	"\221\026\265\202@\017K\262\325V(\267\365ib9\355\230\276a\032"
+	.ascii	"\241\213nn\357)\226Q\361\033\252\3240@\002\251}\251\240\016\207"
+	.ascii	"`\337r\325P\323?\243\364\t\021\261\f\262\320>\002W\023\225\231"
+	.ascii	"%\342_8>?\326K\2220\362\363bb2T`\263\271\363\261h\330|\344^\020"
+	.ascii	"\236\024\213_\260\204i\017gvU\031u5\"f\265\240\371\207\222\307"
+	.ascii	"u\321\027N\r\347\0333ukU\371\031P\006"
+	.text
+	.section	.gnu.lto_.lto.bf4a7a3e0dc1393a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pidConfig_Registry.50.bf4a7a3e0dc1393a,"e",@progbits
+	.string	"(\265/\375 \222E\004"
+	.string	"\244\007`"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\206\200\200\374\342\303\275\374\r\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\314\006us\250\346\005uq"
+	.string	"\005\001\006'\001\001\370#?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/pid.c"
+	.string	"\004"
+	.ascii	")\"\301$\016\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_pidConfig.52.bf4a7a3e0dc1393a,"e",@progbits
+	.string	"(\265/\375 \034\341"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001\002?\202\210\200\b\177}\273\001"
+	.text
+	.section	.gnu.lto_pidProfiles_Registry.56.bf4a7a3e0dc1393a,"e",@progbits
+	.string	"(\265/\375 \224=\004"
+	.string	"\224\007b"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\202\200\200\374\342\203\314\361\033\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\357\006us\305\006uq"
+	.string	"\005\001\006'\001\344'\001\216 ?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/pid.c"
+	.string	"\004"
+	.string	"J\005\017\263\350\024E\336"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_resetPidProfile.57.bf4a7a3e0dc1393a,"e",@progbits
+	.string	"(\265/\375`>"
+	.string	"\325\b"
+	.string	"\306\221@;0\345(\035"
+	.string	"\336$#J\321\206B3J\260\272Q\036\212\231?\031\214\240.\205\274j\20294\260!\017b%\021\3557i`0@\360\210\013#AX\243\246\004\375\215l\262wJ\001-"
+	.string	"/"
+	.string	"."
+	.string	"\237\232\023`\237\366l\230\327\323^\365\301\221\302\332]*C\356=z\376M\036"
+	.string	"\226\276\307\314\303\356:\202%\217[\336\266\202\355\006\333-\001ki\262\237\372\343\345\020\262b\016\\v;\002"
+	.string	"\330\227\2712\022\343\355ol?\332/9\312{*\343\003\273\246\225\312ne\360\202\346\323\365\005X,\330\353Q\272\204\323.\351\240\177r\225\350\272\310\2471:\354\340\247\337a\237Q\332\026\027\361\240\021Hj+$\311\317\256_\224 \366\257\335\r\237P\006\3228\bO\266\t\270\303\361d\033\035MHd!\020\255\310\"(h\207\023Q\216\201\265\355\303\321\221\246qtS\367\327J\223/T\330\n5\344\2063\321\253;\007"
+	.ascii	"2\241\305/\260\301\205C\227\241\233\325hp\227\027\355$\003"
+	.text
+	.section	.gnu.lto_pgResetFn_pidProfiles.58.bf4a7a3e0dc1393a,"e",@progbits
+	.string	"(\265/\375`\212\001\265\017"
+	.string	"v\337jE"
+	.string	"\261&\035 D\203\200\241\360 n\036x\267\236\250\277\315\227\324&|\370NkX\316\353<\b\203Vj\252mKS\306\241\250FqeDj&\252\004"
+	.string	"\006\325\272\t\217\037\022U\244\220b\030\317\b!{\313\235RU"
+	.string	"U"
+	.string	"R"
+	.string	"\376\310>\035\336\300\365\231\275\300\365\351\220\235\343\341\313>\245\263\262\332\261\273\233\216\260^\206\267\214\241O\2511\344c#0_`\322\361\201\242O9`w\005\200\035\244\203\310\002\222\2424\321r\375\352\fL7>\260\345\021\033\331]\307\017\004q_\267\355\331\206`\277FW\335\362\321\252\321Q\243\037"
+	.ascii	"\333"
+	.string	"\301\221\200\306\256\207\326\316\332L\031%\256\372\355\373-\316Ry\214\025\354Q\261\273\017\375\2255\027O\205\256\362\214L\364!c\245z\344\354.\310\247\037d\237\n\244\212\255}^\263\375h\177\305Y\204\216\332p\002\273\247\032\030\273aH\273\245\177\376\213\317t\362$>\215\001t\375\373\364A\327\247\252\317\312\240!\376\363Y\227\200\"\324\311)\251\310Q1U=M)\205gn\033\3275\352K'H\261e\251\327\257>C\230nVzF\261\245\272\273\"U\027;$\305\357\356ZOvv\324\217\005\334A&(\334I\347E(\341>\232IDJ\270\317\226R\201\002\207r\262]\340&X\330H<\320&r\300\335\307\304\333R\272\316\333\264p\364\257\236|\230g,\036\233\221\222\246\272\030\253\321L\025'\202\\*K\310\245\036\225\302\341\020y\\J7\270\324\354#\006O\352&F\004\200x\231_\3464 \004/\001\035"
+	.ascii	"3\241\357i\f\246\001u\332\256\220\265\274\230\335\313\214]\314"
+	.ascii	"`\035\266\213\024\354\210\246\021\230\226\202\021.\207\246e0"
+	.ascii	"\013\346]\332\240Z@W\313\201\270^\245iV\255\004\342\342\206\210"
+	.ascii	"\262\301N{{\016\370\223r\347\232O"
+	.text
+	.section	.gnu.lto_pidSetTargetLooptime.59.bf4a7a3e0dc1393a,"e",@progbits
+	.string	"(\265/\375`w"
+	.string	"\025\n"
+	.string	"6\323F> \005)\035 !\300\256\003"
+	.string	"uL\004\304\204 \32209QU\360\344oK\373\337\006\340cf\033v$\3306"
+	.string	"q\202\270\327%"
+	.string	"\212A\216\020.SHI\352\211\301\376\252?\331d\357\224\0021"
+	.string	"3"
+	.string	"7"
+	.string	"\257\b/\340^\267\023p\257\016\355\234\217\260=\331\301A\n\330\335\216\236<\374\f\375\273\334#\272T\237\235\207\335\365\024]\0377\275m\220m\006\373\006\001\243jR\023\373\333\356\256\351\313~\354\337\346\364\234\323\357\f\200\340(\314v=\312\001K\2534)\037\333\237\366Y\336\022>\226\262g\267Dffw\\p\202@\226q\257'\305\332\354-\021"
+	.string	"$k\207\262\254\331\330]\201N'\335lZ*\254\323\006\330M+\300F\375\227\303\244|\024k\240\346\305W\037\305\275\326\032\2712\262\232\245\035\244\222w\002\277/b\344\201\037\213B#\017\354N\025\024\236\305Dw\341I\224:\221\t\243\013\035\370\003I\246\356\364}\246\3563\356\267\245/C\204\320V\224\345I}\3621\236eX\026\016"
+	.ascii	"2\2415h\340x,+\204\001y\252hf\027$\300\274\335\242\354+\230r"
+	.ascii	"\t\226XM\001wy\321N2"
+	.text
+	.section	.gnu.lto_pidResetErrorGyroState.60.bf4a7a3e0dc1393a,"e",@progbits
+	.string	"(\265/\375`\352"
+	.string	"\025\f"
+	.string	"FWR?\020Q\225\016\030%`\005\204p\003q'\255\227\236\215h\206i\271\002\230\226\323\376=\273\322\262\370\033\301A\034\240,\247\020\346r\252\252\252j9D\310\213\364\367uB<\025\254\303\344\223\275\345N)="
+	.string	"B"
+	.string	"="
+	.string	"\273\233\251\t\353%x\313\310}J\215\234\017\261\234~\300T\303\373\272O9`w\005|\035d\203\b\372>Q\246\020]\017^\201i\345}\242G\210ew\035\275/t_\267\275\331\246\330\177\020\236G\335\277\002\250\260\221 \334\r\021\356\330\2179\003\305Q\267\317\302\007\035\361[\334\005w\224i`\235\bl\245\032\201cw)\237\236`\237\006.\271>\345\t\\\237\217\230\263o\034,\355U >\250Z\001^\360\353\324\2230\255<\224\370\304\320\366\260\035\021\330\336p\030\366\220\224v\327\201\377\342\251\f\376\211Ok\350\304{\237~\347\372<\370IHF\253\345\211\241\352\356v\252$\033\354\342WG\016\033\r\303E\032S\201\240i2\016\205\tZ\005\t\331\005\355b!\303l\233\254R\300\031M\204-\343d2[\026\001\367:\362O\307b\254\370\360\350g*\311"
+	.string	"X:UY\221\362+\210\301\257\317\221bq\210:.wwe\026"
+	.ascii	"3\003\3769\204i@'\266\213g,\201\325\302\00530-\005#\\\207\237"
+	.ascii	"\306H(6t&\2053\375\322D\340\030\207o\224\rv\332\333s\300\237"
+	.ascii	"\224;\327|\002"
+	.text
+	.section	.gnu.lto_pidSetItermAccelerator.62.bf4a7a3e0dc1393a,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"=\b"
+	.string	"\026\220;8Po\322\001\240X\354br\360\271\343j^\007\344(\213\313\230{\023`\024\315\212f\205\360\022+\214,1\212l\264\316\264\240z\242\303\030\003@\253\271`\233\r\262\311\336)\005)"
+	.string	"-"
+	.string	"*"
+	.string	"\227\346l\227\177\036{\323\306\205\351ewg\3548w\310\371\037y\246#\211\016\001\026v\327\260#e\334\361\266\rl+\330\366\002\276\367CK \305\202`\262\213\261\212Y\225L\001\321\330>\264\037r\021\356\236Q\316\354\256\234\240\354n\202\017\002.\013>p]Z\337\\\001\261d\007\025\325(Z\030F\237\344%F\371\037\256\360\t\276\273\364}\272.eK\nFc\004W\366'\202\221\303\276\265\273\353XrU\333:\225z(\2061|*\335\032((hc\214\363\220\205\346&\021\221y &(\353|&V'&\207\300Z\210\326\271iZ\235\232oom\b"
+	.ascii	"2\241\205/0\340\002,\230w\t\240YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_pidStabilisationState.63.bf4a7a3e0dc1393a,"e",@progbits
+	.string	"(\265/\375`<"
+	.string	"\315\b"
+	.string	"f\021@9@\217\322\001xQ\243\211j\210.\361\004\037\273\2161\363\231\002P[\305\0169@m\037y\335\220 \201\330\247\020\213-\332`\n"
+	.string	"\373\027\036\002\363\321\002*\327GD6\331;\245,"
+	.string	"/"
+	.string	"0"
+	.string	"4\373\200vj\321v\371\350\261o\2512Z\260\335\255\263\343\342\245\350_\344\032\323it\t\340\260\273\226\246\323\306=o\033\301v\203\355\223\273\236)\373\253_J\351\323\210\027\fF\341eW#6\263*\324\365\261\261}i\037\344!\342W\"kvQ-&\273\343\202\023\002N\017N\240=/\322,\371\323\0379\013\303W\371\"$o:\365C\332\251\001k\245$\206$c\376E\232\234\237\f\250\224\022\013\211\253$c\3668\222\223\303~\266\033[\330\t!\300\255\353<0\004y\017\037\356\023\260\207\363\341\276\032RLp\235D\005q\235\212\352\001-*\247\300\336\267\2015\364<\260n\306}\2663\345\f\345%\023\b"
+	.ascii	"2\241\261/P\300\205#0\352\022\026\261\032\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_rcAliasToAngleIndexMap.64.bf4a7a3e0dc1393a,"e",@progbits
+	.string	"(\265/\375 %\025\001"
+	.string	"\320\030"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001\001"
+	.string	"?\202\210\200\020}3\274\0014\273\001"
+	.string	"\002"
+	.ascii	")\242\f\240\b"
+	.text
+	.section	.gnu.lto_pidComputeFilterSet.74.bf4a7a3e0dc1393a,"e",@progbits
+	.string	"(\265/\375`\350\n\3452"
+	.string	"\372U\374\022DP\244N\007\253uJ\034Co\251[\311\324\030\032.\331\260\242\211\035\265e\345\203\030^ ^f\265\251=\ty\323\211\310QA\210\240\2034@\273\324`j8kA\027\274&\n\303\206\220\210\220\275\367\336I\246\024\034\001"
+	.ascii	"\001\032\001lr\016\362\347'\327\251c\2428\234{\233\273\233\177"
+	.ascii	"w\227v/p7\270\310\216\244h]u\347\342o-t\313\3212\235\355\027"
+	.ascii	"-?\275\234\3276\264\276\305\331\\ok\271\226\351$j\336\365\320"
+	.ascii	"\3139+p\265%\264\256&\245xmG\322\230\263\330\312\0328\356\366"
+	.ascii	",\236\346\272\032\017\017\312y,N\230\234\327\0264S\353j\2579"
+	.ascii	"ru\265\365\343\352j\273\335y\276V\226Yh\337\026\027>9g\345\223"
+	.ascii	"\271\353\310\241\243P\220\261H\004\032\n\203\300\226]\325\364"
+	.ascii	"\261\333N \355\357}2\035\311>\r\241\331\023\353z\342G\267s\232"
+	.ascii	"\t5q\202\203\300\030\341\212l\332\024\"\373\224\201,\nT\026\266"
+	.ascii	"\032\235HV\243\363H:<n\231\355\211u1q!X0M"
+	.string	"\262s\026\031@\305i\004\003\007\264\354\223X\027\021g\323\004zb\364\270\235\363+E\006\201\362\n\237[xU\233\302\247\026N\203O/\177\3423+M\3129\373\233c\256'\026\306\354S\316\271\361\373\354\362&\362n\307\321\335P\335A\017x\313\317U\366\253\330\324\254\317\226p3\353\253w\334\242j\351\377\201G\2016\327\324\273\302\1778\347\314\374\207.}\372,\330\326d\341\276\376O\337\267\374\256\332\204\2239\321\346\234\345\324>\306\245\222\2425\333\261\272\372\257\236\265\361\251\341_z\f\247I\347\337r\336i\316WJ\370\275\211\006\013\377u{\234\313\265\\\273Y\253\3508\354o\307\255\256\372\003\331\375E\277\256\360_\027q\363\361N\263*p\245\357\206Zb\177\033\177\341\253k>\263{\215\211\037\332\355i\376\261n\207\363n:\300\344k\356\006\334\315{\311\325\334\225\274\315\033i\210\373\b\210\333H\210[\200\212;"
+	.string	"\213\033\300\212;\031\304]\244\342&bq#\207\270\207\200\270\217B\334B*\356 !n#\213\273\270\342&\006q\003\261\270\207@\334\302\025w\020\210\033\270\342nY\334\354\212{mq\253,\356t\305\375*n\254\342\366\bE\2656\312|\256\226\247]\217\037\255\256^\221\222\223t\373\235\356\316ksf:\222\306o\336\212\"%\347\214\300A\022-\354\307\304\367\\'\306g\317\346\242>dr\237x\336\327\225\273\327\353\205\305\307jlt\304/\376\n\307\203\017\355\023+\361Y\260\305\311\302}Q|\016\361\32533\300\207Nq\317\232\360D \375\315U\260+o\257\327\234V\220)\355C\261\273kem\372\341#=\320w\273Q\027\013\366\267\323\374\345o`\f\361r\316n\232\273q\265\270j"
+	.ascii	"\350\375\365\272\252\3636\025,\\"
+	.string	"\300\376^X]\035\376\013\221\213~\031a\340\013\277{\003\007\354o\323'i=\263\203/D\372\340{\223\256}\340\177\2365\3557p\023\307\247\326\341\303\204\262\234\257\374\355\016\341hD\2649g\247\3663.\032\td\031\217\325U\367\342*X\364\356\365*\353\323\013\303>\264i\350I\035o\217NezG\333\203\362\007\036\351\271\344\224\220>\tV\207MN\026\356[\325gz\177\363\024\017Z\235\245W\277\003!^@YM\315X\255jH\331\240\221\303C\016\250\031K\0334\226U\030\242\244\250\216:4\274\200\262\232\362 \243j9\"j\270\214!\325b\252\nD\224\024U\320j)\242ji\025C\252\005\260\241\030DIQ)\255^\270\220\212\321B9Cj\205\f%TU\r%\203dOQ-\253\224VSSUJ\341Z\3664\377\330\007-uW\217\205\f\360F\177\004u1d\34217\254\300\221\2007J\276"
+	.string	"\261"
+	.ascii	"\377B\362\370$\204\335\275^]&\r\255l\b\013\203\245\3159\331\362"
+	.ascii	"v\346\b\340q\225\344\003\370\325\214\320C\351xR\013\027I\276"
+	.ascii	"zF'\210\270\205\277\\\037^Y\356^;\\\356\217!Y\330\364\371Pn\210"
+	.ascii	"\021\002F>\321\027=]!]0\206\340\247\253\305\311\351.Y\200WD\364"
+	.ascii	"\336\324\303@\220\377d\336D\277\270\376\366\3700\356O\361\001"
+	.ascii	"\016\372\343\017\021q\215$5q\017\027\304#x\313\rS:\271Jp\323"
+	.ascii	"]\2027$\364G\342\013\341\254\240\1772t\321/\027\352\222Q\300"
+	.ascii	"L6x|\030\227\207\270\300\257H\n\226\267\327\313\216\023"
+	.string	"\351\352\230\370\017\320C\373\264\373\301^\370\264\007\200\317\250A8%\025dhDFR\220\202$\255\001\260\002\221\231*v\021\3400\246\240\252\231\221\2224\351\263\354w\331A\317X\203\006\344 J\301\300v\331\337\036\025\005\265\220\261s\260?\240?\253\270K\312^\334\337\323+\224I\177\317\336c\313\007YE\223,\n\222HV\007@t]\363F\365\226M\317\253\354\366\002\253\303\256\306z\2150 \240\tU\177\264<\326Z\231\3617a\252\177\353\360\270w\230\251\200\363]\345\222k&D\335B 6\3617\017PGJ\315?\314\203\302w1\312\030X\b\032\240\243q-\364)f\253g\254\330\335\365\211\336\311\345J\243\224\336\226\314&\017f\006\216\347f\033\257\331r}\336\262T\332\261eO\3019\2245\315\203\320\266PG\204\374\301\022?9\002\nqY\351zh'\364>\207\317\202\177\252\303\n\266\271\353\375\224\025\243"
+	.string	"\276\006\224%\341\243B\363m\346\310.%\363\236I\226[\352\304#\333\302\350\263\300\205\001\0267)7\353u\264;\250=d\306\237\226\213T\361\027\261\337\316\217\225\251\337\364rb\n\t\3219\276\303\360\007L"
+	.ascii	"\350\373\357i\251\334+\311\220\206~(\035]_h\274\363n>\275\234"
+	.ascii	"\"8#\021\022\334\312=\257\f\314:\344\033\220S\217\251\362eX\202"
+	.ascii	"D\230H\343\234Fc\216\"\225\200\335\335j\301T\004:\221g\306\306"
+	.ascii	")\247\262\276\316\252\210Q\004\372\035\275qk%\306\004\230I!\347"
+	.ascii	"v\3608y\357W\336\236C\fn]W\003"
+	.text
+	.section	.gnu.lto_pidApplyFilterSet.77.bf4a7a3e0dc1393a,"e",@progbits
+	.string	"(\265/\375`\036\024\225N"
+	.string	"Zw\320\032=0\244N\007\365\227\202\241\201\245M\020\021C\356&p\302\354\"e\357]\345"
+	.string	"A\322\323\367\021vJ\273U[nj\334S\177A;\227\313~\303\r\034\375\325\377\037\357\375\324\310\336;\311\224\002\227\001\204\001\260\001u\334\367\234\355\266\323~\247\225\324?C\277\027H\276v:\036X\347\210\307bdI\263\270\274\3048\236\216@\316A\022\307\020\316\025\362\357\355\310\271\213\343\330\217\257Yj3\216c7\336\247\304\371\272E\353c\365i;\234V\352\371\033\330\367\232\212tB\206\334\343k&\306q,\301\333\266\200\364V\001\353P\256\222n_\343l\226\370\264\007|Ql\303\213\343X\351m\367\222n\245\267\255\262\273=w;\236\253\201]\332\304\235\342\370\rqN\034O)4\025\322\333\236\272\224\353-\322\241\\o\033\356>\344\323g|\214c\216\351Y\3438\256z\270\316\316N\275\001d\330\t\f\020\020"
+	.string	"\200T\024\324\223S\023\323\322\253\244LJ\"\217n\313~\206\333\363<j\021L\260\257\314\211\023\030\300\006\215\013\210\346\335\345"
+	.ascii	"\254\024\0302t>\210l\216\215@\225\003\b\226\001|1\223s\251(\250"
+	.ascii	"C\261R\202\274\034\372 2(\033\241\255\017\232?\261\007\004\377"
+	.ascii	"\224\361Ad`X\006Z\272\304\361@_@\206,Lvb\255\016\313\304\260"
+	.ascii	"\312\263Cq\271\211i\251\317\251\254tnf[\374mc\313JO-Y\271\300"
+	.ascii	"\315L\214'-H\3729\325\225\316\315l\315\221jd\310\232\371\350"
+	.ascii	"\203\310\2628\034\317R\312\306\262\233\346\355\237\3473H`\205"
+	.ascii	"}ei\316\262\023\b\353\326\226\312\236\260Pj~\204\312\262\260"
+	.ascii	"\374\016\307\333\270f\"739\317G\021q\034wf\226\231y\027\360n"
+	.ascii	"7\354n\035\335O|\001\216\306\267\310L\373\312WG\356;\033.\223"
+	.ascii	"\231\360\031\253g\034\307P\262\022<;\213\3451\024\256\267r\336"
+	.ascii	"\022\375\220\365\252\246\275\3720\274\f\226\277\2429\276b\314"
+	.ascii	"\360\215w\221 \245qG\031\276\025\\\214Z\275\325n\261\221\032"
+	.ascii	"W\264b\304\360\212\306$J\204\363\374\020\206o\005\033E\245\027"
+	.ascii	"\376\260\001\013l\201^u\367\f7\224\305\344\255\212e\350\205H"
+	.ascii	"\264\t\024E\364\230\212\374\257Sx\241\n\302\022,\332\241-\\o"
+	.ascii	"/\274\334\026h\023\326!\342\261\357|\177-o\205m\f\303\262\243"
+	.ascii	"L\205\0362\376\240\013\367\253`\370\240\366\227\274\335\005\222"
+	.ascii	"\301\376\004\032\376\347_\310\233\235\363\361>6\332\241}\003"
+	.ascii	"Gv&\016\327\333\374\031\f\233\235\303\365\354@\306q\330U{\236"
+	.ascii	"\022<\220\320&\256\267\376\360\333\23065\322\257|\355\236\202"
+	.ascii	"\345wv\273\203\t<\203\322\377\326\375\346\316zs\213xs\207xs\203"
+	.ascii	"xs\177xs{xswxssxsoxsc\275\2715\274\271\257\336\334\031\336\334"
+	.ascii	"Von\fo\356\013\026\234\352\r\301\347xSy\035\357\251dn\004.u?"
+	.ascii	"\340{\336Qnn(7\367\223\233\333))wSRn&\245\334K\312\334oRn\245"
+	.ascii	"dn\3451w\0222w\322\315\215<\346>\272\271]7w\353\346f\335\334"
+	.ascii	"\357\346\316nn\177Au\327\246%N\312\027Nc+WHq\240\266\316\234"
+	.ascii	"S\335\347\270\007\235\307\232`\215\371\272L\264\\\264d\264d\344"
+	.ascii	"z\253\374\2673\310\270\230!5\365u3x\367\310\3212\222\005E@Vk"
+	.ascii	"f<\342zK\365\255\342`T\332\350H\206*\243%\243\343Y>\312\212\313"
+	.ascii	"H\276W]4\365\036\350\255Y\234+3\355\300\331\235\250\323\362\n"
+	.ascii	";y\004\327%/\260))\021\021b\221\303,\177c\210D\241\244\367f\034"
+	.ascii	"DL`\271\n\237\361\277j\241^\225P\226Uu\220\204\240\325yx!\355"
+	.ascii	"0\317\022\210\027\204\027\b\320\237> >\374\236;=y\360\244\311"
+	.ascii	"\324\017\036>\320\256\016\2359j\362\237\207\016\3577&N\037\037"
+	.ascii	"\234\227\367:px=\250\233,\007|\222\333\220x\246s\220M_\247\310"
+	.ascii	"\323\234\207\305\341\275Oj\032x\366\n*\275\263\34118\212\277"
+	.ascii	"yJp\346I\225I\274F<\220F\n\\G\215rM\335\301j\256\367<\003\263"
+	.ascii	"y0\223|o\366%Q\311v\260\025\227\363l\270,\327\301g\336\272\033"
+	.ascii	":X\255\3529\006f\233z\312\3459/\210\3161{x\362\f%7<\324\032\006"
+	.ascii	"L\334\225\f\267\341[\301k\024\353\235\212o^\334\262\036\226\314"
+	.ascii	"\005\353[\301FF\r\337\226\310\006\253\271\037\234%k\201\331"
+	.string	"`\347\323\333\316k9\013\274\245\013\354\205+\222_\303\316\334T\221\261\224\200\341\032\313\3418\327[\r\357~\236\305lID\320G\f\035$\373\377\017\234p\307wv\030X\f\210j\034\1779\023\371]\031\r\371\355\240\235\250\364\370f\215h\240J\226\313\340\271\206\351\340:\270N\217\251(W)\342\200I%\353\3529\345\370\0011\220h\rY:\361c\310\226\221-\256!Z=\230\274\206\034\341\"\341\245\365\243k\207\227\322\310V\222\035\254\227\026\214.-\257 [>\222\315\243B\217-\"U^@~l\005\361Q5dk\207\220*\036]F\252*\bh.\"Z]U^\\\\]U\312\351\227\373\t\364\365`\r%u\361~`<\036\324'\007\0331>\241\221\221i\374\335\323'\303\032E\245N\337\316\347\315<\"S\321\333\355pze\030#F\351\223\341\n@\007\253u\277\334\3175\242\236%\037>\256\2675\376"
+	.ascii	"\t,\375<\024\266\322\240\n\006Vk\207\312}\201\264\210f\rm@\326"
+	.ascii	"?\341\256\2743K\304{q\303\362\\D\204\370\266\006|\253y\355\331"
+	.ascii	"`\265% \256\354L6\r;?\313\257u5\304;\033\fM+#\001\356\267\357"
+	.ascii	"y\236\233_\026\005xg\277}R\026\376\013e\t\036\365R\274\251n\324"
+	.ascii	"g9g\3438\216\001L"
+	.string	"\360\250\267\360y\370\366\304\332\300\3625KM=\226O\363@\207\360v\030mFAx\264\246&\303\n\317\314\312\224\203\205\321f\213\374\211\336|\\\t.\270$\024\025\230%\220\330;\241\322T&;\302\273)R\230\020\336\3578\225\035aT*@\357\271\007\365\316\246\372\246\367B\017\245\251J7\204\254?\366b\377\244\351+\304\371\013\007\n\370\364e\256M\241\025Y\351\231~\352\273\227\206KC\331\231\255@\354\235\364\3223\275\2175\276\277\364\2168\326\210\370_KD\357\203\210\223\"x\245\344X\343_\257\376\300U>\202\017\201\246\250\2010\b\225R4\"\022D\222\024$\031\016\241\005\204\030eU%7\021\2404\251\030BD\"\263I\255tBe\226\243()ac\020\252w.\236\234\237\255E\230\301\232\263\321`B\n\371\036\363\177\367\371_\373\001\264\212?6_|0\325i\235\220\200eZ@~\224~F9\030"
+	.ascii	"\345\341\270\005f\005\243U\242\331\246U\3711b\315\353\252\254"
+	.ascii	"\225\2505_\365E\335\007\257\350\237\032\343\224\256/\224Fm\017"
+	.ascii	"\260B\236\263\332\251ma:\006\203O:\276\0042\213\320\260\353\313"
+	.ascii	"z\336\277>\316\277Y\033\352\231^\212q\214\243\312l\244\362\315"
+	.ascii	"\237>\306:\002Up-\026\224#\373\354:;\232\022\233O\377\374%\013"
+	.ascii	"\366\261\017\266\243\211\306'\224\265@\r\201\033\371%\300\336"
+	.ascii	"\207HC\365I'\211(\266\025\221>YA#\262>\3315I\237\246s&Y<\247"
+	.ascii	"\320L\261|\311U\177\370\024\323\252a\342\223\t\223\220v\\\234"
+	.ascii	"\233\230\271,\006&`Z\273"
+	.ascii	"\207.a\334\224\303\0377\215\324z)\204\375(\207A\326/\267\353"
+	.ascii	"\210n\301z>\f\341\234w\366\216\314\203\376p]Z'\326\226$\031>"
+	.ascii	"T\370_\364\002]#Unr\265\372\242\310\270\240CI\207j\225\226v-"
+	.ascii	"XP2.\350Z\322\241[e\244]\013\026\224\214\013\350\344\250\341"
+	.ascii	"\264\245\2221k\345\307t\033\017\256\347Y\222\3361\235\360\254"
+	.ascii	"`\313!1\270yTNL\366"
+	.string	"\023<m1$'\211\327\027\321\031O\354}\260\240\275SS\204\356\325\257\201\325\340\026\372u\177p\313r1\332\005]\034\250K\212\020\365\265\303g\215M\261U\310~\026\333\375\032\306\030\202\035Mg\250t\354\270^-\337\310MR\247'\257\275\320\342\264\350\213\304\017/\322\021\234\0214\254\246\363tU\305z.1\234\025\210dw\234'\313\254\252\326\013X\335\316\211\007\026WOZ\350\320\r\217\247\217\224\304-\271\224C\016\210\035b\204\261G\200?\214\224\277\224U\262\334\027Qy\357,\364\206\r\220\217m\2211\002\322\320m\276\\%\233\307C4\311\242\233`uk38\356\365\243\223\001D0\304\231\217?*\265\3254\013teD\364C\025m\336\b\325\260z\372\241\246Z\315eaG\226\310\276rP\254\231UQ&Z\034\215|bD\007\357P\344\001F\261WL\223\225\337\253\\h\340\202\234y\275\036B\203\017|"
+	.ascii	"2l\267\304\314\bS\242-\033li\361#\3314\315S)\273\246\364\324"
+	.ascii	"\230\325/\211Bv\251\fp\024Ud\311\247\310\214\025-OTB\\\377Q,"
+	.ascii	"\344vL\363\021h\260\233:\330\225\250\346.[\360\020\bt1=$\243"
+	.ascii	"\226\226n#*\277\271\376\004f\236\257aS\036\214\226\023\300\303"
+	.ascii	"\241\017\f\336\033\236\210^\330\233v9\253\022\r\307\204\242\235"
+	.ascii	"R,5T\003\017\031\336\305\344xC\260\001_!>Y<g\322\240|\023\323"
+	.ascii	"\345\030k\313U\2278$\236\312\324T\320T"
+	.text
+	.section	.gnu.lto_pidInitFilters.78.bf4a7a3e0dc1393a,"e",@progbits
+	.string	"(\265/\375`c"
+	.string	"%\t"
+	.string	"\366Q@8@\217\322\001\003\307)\210\357\317-\002\243x,\306\314\247'\207\206\367\251\\c\325\022\310\251M\213\316\034N4\332\247\363\022\215@\372\303\003\030\244\246\026\016\333j\177\267-S\n-"
+	.string	"."
+	.string	"0"
+	.string	"\233\313\316A\233Kwv\314\301\216}\312\013\303\344\265\2733r\274\273v\376E\016\360\261\274+'aw\255\037K\343\216\267]`\033\301~\f\273\273\216-\373\256_%h\346EAe7#\006\333P\262|\250\336\376\307\366\325>\310C\272\273(\036\260\333rY\331\005\017l\320\2714x\2010''\r\004\013-\242g\216j<\370\022\256\263\273\372\347\217\234$\345{\\z\202\323\177\227>\027!\241\377\254-2\341E\364l\320\323\270a_\023$SV\322\266\205Q\206\362X\024\032e\250\251zp\310L\245\t\2215\234\246hK\315\020\2015\024i\233*M\333\346\007\334k6\266\314\020\013W\261\302\036=x\024n \f"
+	.string	"2\241\017h\340\270\260\2408\2528"
+	.ascii	"\303\324j\245\036\032\230\013\326\315j4\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_pidInitConfig.100.bf4a7a3e0dc1393a,"e",@progbits
+	.string	"(\265/\375`l\fE5"
+	.string	"\352\\\214\023:@\250M:\270#\007\375^\347p\017\301\271\274\366\367\213.\305i\367\006\276.!\024\021"
+	.string	"\254\213V\374\017.z"
+	.string	"~'\251f\235\207-\017\274\374\202K\214;j\303\222\235\344N\001\b\001\025\001B\001k\f\345\372\002]s\321\265\205\257+\3205\005\272\236\360\265\204\257#\354\032\302\256\037\320\265\203]7\240k\006t\275\340k\005\273N@\327[t\215\340\353\003\2736@\327\005\350\232\300\327\003v-\200\256\003\320\265\326\327Y\273\306\242k"
+	.string	"t\035\374\372j\327@\272\376\321\265\325\327\276]\227tM\351\372_\357\256'\020\004t(\351\260\253\225\312^\252:\251L\004g\376\231\366<z\002\3523\375\f\347\037#\177jU~\202\n\255\001Uk\355\232\2459\374f\t\201\316\240\355\271\366\3243\367\f\247\221\311\024P\353\031F\207j=~\231\3537K\037\247\001\337,\177\223\200o\226\036\332\237\346\361\255\316BoP\346L\325Z\205O\343Oz\234\246;\234%\375\016=\255\306\370L\txw\3056\265Y\322"
+	.string	"\265\326\254\266'T\303Jic[\032\007\313\374\004438\272+\266a\231k5Vk\365\026\333\254L\373\246\3554\333a6\200;\001{jRj\257I\366\262OE\216\356\210a"
+	.string	"D\302\333Q\\\344\326)x"
+	.ascii	"W\017\002\177\305c:j\304\b\230\374-B\3668%\346\230\312\352?\337"
+	.ascii	"\255\312\373|\314D\210\016\225\307B.\2223\322\327\331\016+S\255"
+	.ascii	"U\314\323\320\244\373a Bv\026\205\370f\271\310\242(\273\311\306"
+	.ascii	"%nR\365\211\275=SNj]\233\360\323O\242\034\266\335\363\376\277"
+	.ascii	"\036\021\324\374~BY\265\266{\266\315&\241\263\260L\266\233t\232"
+	.ascii	"\203\212\b3\325\352Dl\2266\332\024\204\344W\253\223\260@M\362"
+	.ascii	"\222|\275\265\231\245'\023\337,\347'\240\371\205D&\215k\273\367"
+	.ascii	"\327Z\325~7\373\250\266\263\326Z\3753v\3314\316\031c\376\231"
+	.ascii	"&\243\353\027\345\332\005]\267(\327,\350zE\271VA\327)v\215\342"
+	.ascii	"\353\261\257O\354\332\304\327%\276&Q\256G|-\342\353\020\345Z"
+	.ascii	"\214\256A\320u\030]\177\240k\017\273\356@\327\034\350z\303\327"
+	.ascii	"\032\276\026\226k0\272\376\242k/\272\356\372:\303\003\357\372"
+	.ascii	"W\233\234\327\201\\2\274\353\n<\021A\255\025'\206gx\002UD9\027"
+	.ascii	"\216a\230g\251\f\367\\\270\326%II#\327\224!\23793\234\374\034"
+	.ascii	"-\234\253\302-|\013iK\025\336\344Q)\"\034\205\215b;\024\256{"
+	.ascii	"\336\234.\307\235p\n\022>\341[\227\210\240\"|\302\221pJG\204"
+	.ascii	"\203\360\b*\366\t\204\007\221\221\222\306\007\367\256-\033\013"
+	.ascii	"\027ddxEQ0\266>8P/\222\234\203U2T5\270\203\237\216\b*\325Y\211"
+	.ascii	"7T\247\032\\\313\r\217\201\251\031\013\316@\301\027\3347\227"
+	.ascii	"\340\n\364\316\300H\025\2510\312A\202\007\221xr[\241jLU\206\362"
+	.ascii	"\346\2149\205\340[\007\216\340\245\201\037\370t\36659MOE(\274"
+	.ascii	"uj\220\311j\032\351\233\245\201\007\343 %\013h\262\261tEQ\004"
+	.ascii	"n\2739\250\326\232U\340\223\350h\300\t\374s\002>\340\306\314"
+	.ascii	"\023p \022\222\2341\300=+MK\266\363lc\034\256s\235o\226\247S"
+	.ascii	"SS\253\244\264\036 \353Z\267\302\303zV\2169\351\354\367\253\265"
+	.ascii	"b}\362\231\030\220w\311Y\336\315Xk^\366o\332\256Iv)\266\3755"
+	.ascii	"\311\276o\376lr\022I\314\226\370\240@\210\230\005AK\243Qfv\344"
+	.ascii	"\312?\300\312\314\216\b\225\f\021bF$\210\320\210\231\217\"\302"
+	.ascii	"\037iI\204`[F;\002$M\250\004\r-M\030<\3269\353\317\030G\334\244"
+	.ascii	"\265\263\371E ).\376\342\2774e\001\271x\360I\247d\013?"
+	.string	"TX\274\305O\327\266G\026\007\";\311\2550^Q\361\025\377\\\226\3253\334\243\342\3009L\311\024xl\267\005\305S|Uu\331;g(^b\3522vo\334\326\031z\0013\024#\006\357\352\304\307\276\245g\342'\310\254\2343\023\017\352\345%K\300\231\031\262\331Y\\5\223\304K\33477\342$\334\366\315\210\003\335\362\344D\334\313f\333\f\323\250\031\262\031\262\361Ye\nq\021/\305\036\302\315\276\r\367\210\035\350v)i\004q4p\\\267\263\030\006\342t\216\350(\354\023\016\322\035\021\356C\2318\253\347\341\037\276\205\327\341\036\376\271\341\234\025s\326\341\301,\226\222F\016\267\275^\026\314\227\235Fn\270\3279h\370\206[\251\022^\303\255\350\300.\214\333.`\007\"-\311\031\275v\213\355\n\274i\371\327\027\213\355\270\366\312\017{hG\210\017Y\024\345\025\200\371\250a8d\025\202hF\202\224$I\322\034"
+	.string	"\003\021\031\242\352\021\3204\347\034\252\221\221\202\302\244\320fs\340\013Iz\210\234\022|\331<1\336\006[\234S\212\272AM\\\322\234h\006\304\346"
+	.string	"Y6\024\313N:l\237"
+	.string	"Z\266.\314\034\336G\204\357\225-\262y\200\034\331\240an\017g\003\245\226jN\332\221U=_\202\020\0033\006\221G\203\212\276\240\341j\270\004\027\370\305V\257Q\377(\262x\0308R\220\3365\036*\204\005=y!\237\255\2547\030[\033C\376\302\303\354q\202t\267;)K\314\210\216\246\213\0245sB\247\227m\020=\257\316\212H\334.\002\363o\242e\265i"
+	.ascii	"blg\265\214\3273\210\372\223r\2020\206}d\215W\275\320&\322\206"
+	.ascii	"\360\265\003\251\\\276\220b\036\327\257B\024y\361\246@\340\037"
+	.ascii	"\211\026\217/\374\"\t\200\330\310P\001v\323!\022\310{d\321%\333"
+	.ascii	"e\326\232a\177\246\266'\037\246\312\232\f-\250v@I\220\032\372"
+	.ascii	"\310\013t\337\236\026Z\036\316R\364\204A\2729\216\351\356K\234"
+	.ascii	"/\273\206dt9\241O%AI\346;z2\255\342\300\225^C\242\363\325)RE"
+	.ascii	"k\253\236wx\275\t\037\035\270\364\027\301\363\217E\3243]\354"
+	.ascii	"\361\202\t&\345\262\265\301I\260E\232\367\024DL\215W\n\222\247"
+	.ascii	"\254\272Du\221\356\177A\337\327\343\274\337\257\333\035\323\256"
+	.ascii	"\212=\032\036bx=\036\302\267X\374\307\215\203\323\256x\261y\004"
+	.ascii	"^\352uP\250\206\242\3731r\346c\264|\350\315`Cy\237\302\313\244"
+	.ascii	"^\317\242*\200m\3316\273\032\304\344\324\002\216\332\223\365"
+	.ascii	"\241\371S\335\351\316\037"
+	.text
+	.section	.gnu.lto_pidChangeProfile.104.bf4a7a3e0dc1393a,"e",@progbits
+	.string	"(\265/\375`\033"
+	.string	"\255\007"
+	.string	"R\01775Pu\032\003\200\242\302k\027\267a\327@\277\024\025V\006\261\261\225\250\366\254\255\335\006u\273\34768\233!\"\275\310\2313V4-$\332\215\264\261\221\266\345\2262\245\241Q&\3228\006P\266\005\364\343\001e\333$E@d#\321\234\310\036$\346\207\243\230\036\203j[\210\233$M\343f\347\273\257GU\033ZX\250hQ\030\353\022\233\230j\217V\224\240=\313\272\204Yndf@4P\260\325~'\0307Z_\377\337\250j\275\262\341U\300\342\342\020\363c\264j\316\222*\037\235\266\206\255E<\322ye\262\300\257ZI\371\277\204\"p,\373\231"
+	.string	"\263\344x"
+	.string	"\263l\327\302\370\353\270Q^.Nh\376\317\310\341\316\260\253Mb"
+	.string	"/u2\334,\374/\364R\031nt\333\203\266\nmC\002\b"
+	.ascii	"2\241\177/pq\241\024\f\271\004\333\254\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_pidProfileChangePending.105.bf4a7a3e0dc1393a,"e",@progbits
+	.string	"(\265/\375 \371\355\006"
+	.string	"\362L06@o\222\016`\201\245\037 IH\242X\f\325\210\207I`L|>\237\300\301\354\337\354?\317\352\342\006V4\362\310\035E \235@h\006\246\307\002\374\261o\177\023\231\002s6\fW\347y \036\256\b\2077q-H<NF\3616\002c\235\206\354y0,{\232-\213)\304\201\021\222\276\240L\021\261\245\023RA\032\002\272\035W|\\M\265\356'S\253\030p1r\253\337D\0163\276\230\304\324\357F\347.\246\"\233\212E\001%\363\264r\311\024\313\304\343\017\275\346\003\204\320Z\267\215S9ZJ$\252\314\355\241F\265:\355\366\243\006*/#+%(Q\035@Bf\356L(\213\216\375\013~\202\037#\t"
+	.ascii	"2\001#8\343\216#D\250@\\\023cF\020&D\016w\356\325\316'"
+	.text
+	.section	.gnu.lto_pidProcessProfileChange.106.bf4a7a3e0dc1393a,"e",@progbits
+	.string	"(\265/\375`\r\001\035\r"
+	.string	"\246\227XE\020q\224\016\033U\205\002\013>XF\261}\320\3032`\273\352=\205\003\261\201\373\323`\024s\320\fr\034\360?\266\325\347\"\370%\327L\261\277\201\nP\004\201\317\211\206\302\327\243\310:\024\254mO\"\331{\357\224\002C"
+	.string	"@"
+	.string	"I"
+	.string	"\027p\235\272\263s\274\256\354czd\200a\355n&C\274\373\224\261\363\277z\306\373J\237\036.'\201\0323H\004\370Lf\201\024\0201_=n\370Jb\374h\260\273\216\336wr\323\333v`\033\201}\r\001-\273\226\242T\261?ww-Q\366U\367\304\022\204\247\024\021-i\243n\207\026\217\r)\214\226\253~\373_y\343\247\356\322]E\232\213R\367\204\273\361\"\305\332\255\007Nm"
+	.string	";u\375\200\353\024\013_\021\342\263\234z\033\215\256S[\244B\274g"
+	.string	"2>\204\030d)~48\304\220R\345\345Sr\300\226\027\034&q\207a,L\251"
+	.string	"\\9\271\240\234t\371'\216\202\344\263\370\002I\274w\352\223\\\247\013@\324)\245\303\024\003 \020-\264q\017>\232HcO\347\243\211\262\221\t\0224\220PFA\213\020\222y8\221\254\303\361&\002q\331\310\266q\331\246\356\347J\224!\214\bM\262dzJ\027\f@\023-2%R\2604q\312\327\263\030a\273\246{\276\212\031"
+	.string	"3\241\037)\306\346\205\202\275ec\003\326\235\031\037\212\r\244!"
+	.ascii	"\202K\007\2238\326\\5\\ C\304\0313\017\202\201+\210\032~\244"
+	.ascii	"\356\273kJ\020.\023\330\".\363TMN\321\324\036"
+	.text
+	.section	.gnu.lto_pidApplyProfileChange.107.bf4a7a3e0dc1393a,"e",@progbits
+	.string	"(\265/\375`\177"
+	.string	"M\t"
+	.string	"&\221>8@s\322\001\270PPj\311VW\264e\363\213\201*!\366@]6\230\030\332N\3216\244\376\030\267T\242Z\341|\003\361\355\030\t\327\330\252\354\256y1Te\204\315\266L)+"
+	.string	"-"
+	.string	"0"
+	.string	"%\266\337\361g\333<\034\331\214\004d\243\245\265\2733\212\374\273~\376O."
+	.string	"\236J\327\214aw\255\340\251\343\216\267\235`[\301\376B\236\036\274\364=\354\322\276\300\320\203.\220\t],\215X\262\303\222\306\020\373"
+	.string	"\033Q\366\325z\365\003\276\332\326\3156\263\313\361\312Y\032\031\023\332\307E#\246\372\030\320G{\233@\370\312YH~\312 \216\303.\037\033`\\\036&}9\323\243<\364\fjvM\007\375\224\253\210\374\324\245-\002\326<\017[h\216$\"6\n\210Y\2619\200\246\326\211\246\347\300\\\350\323\315\021\307u\263\023\356#J\256\326\3052\305\f\373$\354%3Q\265p\bT\243\035\021"
+	.ascii	"3\001G\177\206\201u\017,\346\024?`Ep\210\247XWm\306b1.\210\231"
+	.ascii	"P\225\243k\270\306\020\376e\\p\351\026\355|\002"
+	.text
+	.section	.gnu.lto_pidInit.108.bf4a7a3e0dc1393a,"e",@progbits
+	.string	"(\265/\375`\"\0025\023"
+	.string	"\006\243}I\300\324M:\250\017\n\324\007\216\336\203LB\302\007w\204\026KX\263\271|GZi\202\313\031:8\\\004\272\317~\031\207\220Ow\306\324\337\f\267\032H\22263Qw\363\216u\"\362\177\234f\275p\344-K(!d\313\224\002\\"
+	.string	"d"
+	.string	"o"
+	.string	"=x\354\3078S\317K\2038\336Miw[\007\355\036\273uP[\266\257\366\225\236#\257\3639\312n\221\215\250\335r\305\n\304\203./ <(>%<h\3226\362\322h\357\244\"h\267dw\307\231\342\344\225\364\277t\226M\350\347\n \302\356ZmB$\356y\333*\266\027\330\312\024O5\376\321A\303ll\302\203\237\020p\274[N\367\032\277\201\343"
+	.ascii	"\367\342>\241?\3434|\374#\307t\3646\235\360\240\013\256\305M"
+	.ascii	")\311L{vI\323\211\302\376\267\273\353Yd\207\352\223\353~V\250"
+	.ascii	"\026?\365\367\251'\250\326O}\224\006V\267!\026+\346\220rG\364"
+	.ascii	"\230,\017\224B\362e|\307\363\322\341\217\1779\021ue%b\376\370"
+	.ascii	"d\372>>e\250\f~\362\323\316\206\004\3525\023G\210"
+	.string	"\326.\275\336\024\320\356LE\234'\363\243\252%\321\304\311\300\250\252f\365M_\307w\274^``\230\256H%\214n\271\2419?\277\271RK\242i\317:\347|P\023\r\317\301A\334\005j\361q\\\252\203\207\230\230\360\240\316\007Et\2269\324K\334\335\026\337\351\001\257\033\030MLva\006\226\023\3002,3\260\234q\347C\r\354\206f\004\001\213\301\031ed!F\026\002\216\345\274d\343N,&\033[\345\354\337\316\"o\270\342\315&\315\t\\\2200\n(\341!P\326\264\311\034\271\244K\177\341Ateu@\337t!\256\001D\202H\230\220\302\204\0074\177l@Y\363M\257r\211\2733\252\003\241P\301\245\267\271\302\235\005\fz\233\277\013/ `\002\021Z;\007\022B\033K\201\231p\260\031\316b\364\341\241\302P\303Q\\%\207\215\355\226\021Z\344\271QG\3034\315Yc\307\207\304\0246d\326L\r\221"
+	.string	"o\2532\376\233E\223\351\231\204\327\336\214\372h\360\224D4\214\344\324\350:\226,\256x\fH\n\375\021"
+	.ascii	"`'2\204\016\202\031Nc\007A\024\243y\235\206iy!\0042"
+	.text
+	.section	.gnu.lto_calcHorizonLevelStrength.109.bf4a7a3e0dc1393a,"e",@progbits
+	.string	"(\265/\375`i\t\0050"
+	.string	"\212R\334\021F`^N:7\353\310\307\2155\032\0067\250\323\305\243\027\344\021\337\221\343\335\025\366Bwt#"
+	.string	"s\355\344HG\267\345z\246\235\205\303\013\352\231P\335F\304?\024[\013\251\262\325\342@{\363\246\332\3326B\210L[\006\r\001\343"
+	.ascii	"\024\001g`z\376\365\331\227\236\327>\253?\247?\367\317\377\371"
+	.ascii	"R`2\243\006\253\215esD\365\260t*\230'\327yo\226{\325n3k\341\273"
+	.ascii	"\305Y\003\354\311\227\206\333d\341U\263xA\367(\\6f\341\231\265"
+	.ascii	"\370\256\261\360\252\361\363\267\025V\324B\273\334\261,{\340"
+	.ascii	"\252,\365\273*_+\367\212\026\3633e+3\363\271\255y9\361\260,k"
+	.ascii	"l\272D\353U\323K\\\257\332J\256\326%*\022\207\204\202\200\206"
+	.ascii	"?>\302 \360\347[\325\264\257\305\327w!\245\2427\367%\266u\211"
+	.ascii	"\212k\302\314\232NN\034jr\205\2304\227<(\005\2168\274#:\234\\"
+	.ascii	" \"\037:I\013#\373O\331\220\373\b"
+	.string	"\203A\356\332uJ\013\003r\240\323\357\036\321!\344\372\322$24;\356\232\260\2614J\r\2228B1\257\257k\302~\264Wy\3344(\306\343\366P\254+mbY\366\256\335\337\020\343\372}\027X\226\345\177\211\351\270\\t\231o\222\231K0\377r\004\255\336\362QfFq\277T\3352e\314V\367yu\237v,\313R\271\3357\026|\315\256\312G\027*_\027\353U\325\236\252\253\313\243\266|4U\323\276]\256\021A\332\301\247\335\374\274\374.\226]>-\350t\257E\343z\264\333W\245HWo\335\263,\273\325\315|\337\276Z3M\327\365\030x\004\357uJ\021\340\017\\fd\214\337\257\333\t\316\360\240\353\352-f6\2567\223\371\246l'a\236 !\002\204\353\274\374\200\352\347\251\237\035\374\334\340g\006?/\370\331\370\263\201\237\t\374,\365\363\200\237\243n\226\313PW\355\362\323\317\002~v\372\271\351\347"
+	.string	"?3\375\f\340\347\245\237\225~N\372\031\351\347\243\237\215~.\372\231\350\347\342\317\304\365<\364\263\220z\016R\317@?\017\177\376\371\331G=\013\325s\360\001\355\333k\323\242\332H\245#g\016\201\376\351\325NQ\023h~K\247\250W\2676n@\027\233\250/\333\315"
+	.ascii	"\006\032m\321\030\016\314I\004\250\330?\243\003Q\354\nn\306\226"
+	.ascii	"\217\336\341\363\211\330\311f\0324W\216\237!\370\355\367\213"
+	.ascii	"\337\326\253\022\333g\007Ze\354\3077\325\0176\350\013\031\264"
+	.ascii	"\021\017.\315\317A\017\350\033|E\254C\235\242\371\206\257\231"
+	.ascii	"\013'\202\257\031\217 Ab\275\352Pw\2178y\306\226\217\372\370"
+	.ascii	"\b5\203\240\026\002\352\240.\341l\363\226@}\302\r(\034v\003_"
+	.ascii	"\017\177\3011\327\327\030\016l&\231\353\323\016\204\355\323("
+	.ascii	"\330\264w\301\026\366\2061m\3362\330\034\344\274\366\260\235"
+	.ascii	"\336\335\227_3\237\327K\035\224\"\026\242Q=`O\365m\323\270\200"
+	.ascii	"}\333\273\345\243}}\330\310\201\346kf\325\252\266P\217\224)k"
+	.string	"3\371\251\261\217\005\356\254\027tT\337\370\365\332\306<_\377Z\201\234\211+\246\352P\2730W\257+\003\343\353C\335\250\251\275\266\0224\310\243\262\352\303QY\225u\304\262\312:\022)\255\2522(\2172\262\256d\004[(Yd]%\225 \260\256f\\u\310B\3228&\221-\212l\245@\305\021\206Q\331\202\305\021k\2051\353X\365\302h\225\224aTp\304H\030WI\243\022\211L\032\205l\313\233\262\235\204\377\263v\203F\346\316\206\367\316\255\323\026#\004\227\314\201\001M\350\033\231;#>I\365]\273\027\214\254\f\335\262\271\f\264\324S\033 \022\320\021\234\272\251\005\364\221\263M\203j\247>\332k\343\232\372\332\321kk\321\212\315\344\333\274*^\335\020\025P\r\336\233\020\204\206\202\352\245+m\232r]\327#\336\205\2402j\373\301w\350A\007h\b\335N9\001Z\330\266\205\251\223\372A\267\233\024\033f\362"
+	.ascii	"4\323R+5\200F\252\323\246%-u\022\264E\343\347\215\302\262l\220"
+	.ascii	"R\337-W\215\303S\246E\273B\315\334B\002\207-\251\223M4v\036\222"
+	.ascii	"\3726o\2016\032$\241\177zB#\233H-\241\3231-\031\261\217\032\251"
+	.ascii	"\217\240m\034\227\241Q\037\005\200\303\250\221,\"\221b\304\320"
+	.ascii	"\310H\222$\225\341\200\002\231!\243\252\003\021@\255S\222\315"
+	.ascii	"\202\224\224\2442\034\317\021\232\202\200)r\340\273\347*U#\247"
+	.ascii	"N\rg\3458n\025W\301\263\227\355\016P:\005\nT<\360\200\246V`%"
+	.ascii	"bv;\2270\210\371\t%\204;\343\307\230t\204\tX?4\027\016z3f\365"
+	.ascii	"\203\f\rNU6\004\325#\301JE\356}\340\206!\2609\324\340\002\332"
+	.ascii	"Fj\f|\205\037\3649\007\204\323\220\360\2361\370.\242\200N\013"
+	.ascii	"\210\b\263(z8\332l\331FP\3111\017\231\317\n\226\267 \246\353"
+	.ascii	"!\200\201v\013\363\3060f\372\307m!\004\317\274[\021\230\322\024"
+	.ascii	"\032\322\0352\316\326V\t\023L\001\334\205\341s\3621w\343\021"
+	.ascii	"\025'\362\0357b\323lg\034\241\341H\245\026\007\207\363\233m\205"
+	.ascii	"\256!\345\006GX\226\017\016\264s\030\374=@8@]i\372\362g\277\n"
+	.ascii	"\230'\027F=]h\376\3004\341\267\353\211\347\037\201\303\307>\364"
+	.ascii	"\307Z\336q\232\217^%\231\n7Bu\343\004\262\313\200\0019\027]O"
+	.ascii	"N^\215\351\263j\320D\276\336j\035\202c\344\306\036\263\245D\225"
+	.ascii	"\340\242?c|\357o\027\325\373\305\245\362\322\262\236\006$\352"
+	.ascii	"\007pC\263\320}\360F\227\3455\374\216\245\026\2529\200}(.G\376"
+	.ascii	"i\244_<\310n-\023Z+\3551\244h\n'\031\271A\210_\264\364\021z\310"
+	.ascii	"\313&\277?"
+	.text
+	.section	.gnu.lto_pidLevel.110.bf4a7a3e0dc1393a,"e",@progbits
+	.string	"(\265/\375`\241\005\225%"
+	.string	"\272FL\017Dp\236J:ca\246\314\203\205b\001}(\235\001\307\273rBo7@\257\320;\310sn.\374\037+\352\302T\261\333\033k\352\324\205\220lie\266m\240\001r\365!\036R\217]\317\273\331\326\032![\356\224\002\334"
+	.string	"\305"
+	.string	"\353"
+	.ascii	"\2173\020\356\013\t[\320\327v7\033h\254\263y\347\352\234\324"
+	.ascii	"Z\201X6\360\344\264\213\376\226\257\031\310\305o\3068NZh\211"
+	.ascii	"\341\323\342\201tD\202\206Wk}p\322'(\026\277Q\241\372\305E\247"
+	.ascii	"a\255\324H\022\252]U\242X\230\323\276\332\247\024O\345\306\207"
+	.ascii	"j\035r\007W\253Z\004CP\363\371\363i\376\342_\255A\240\300\325"
+	.ascii	"Z"
+	.string	"#\270\311w\322\266\017\345Q\212\366\033U33\322{;\342u\005O\255\325i\351G\345I\372\242\362\344\026y\361\275\222\244;\213\376\327N\235\354\311;\202i\275\347\343\245\217\223\364h\307\221#\020\230\221:\300\213\263\3635\034\223\376\200\205}\251\20312a@`\\\364\310\214\0208w\373\374\002\353\232\263\227\241\326\352y\004\353q\373n{\206\3550\233<\006w\350\316\344\350\356\032\330\323\031\227p\315<\007\315\002kG\005\347\217t\377\245\254k\265<w\267\274b\304\373\316\275W\037K\335\213\320WkW\005\277\213\007\030>#7\312\223\337\336\034\231\263\264\255\231g\253q\315%b\237\326\035b\377\246\0330h:\226\177\301\341n\005\327r3\335\312\217\200N\037X:\227\333\300\323\376\002\247\362\0238\226[\211N'\321i\001t\032\211N\037\321i\243\337t\021\235&\242\323C\237\026\372t\220o\032\350\323\001|\323"
+	.string	"\3504\360\323?\237\376\321i_o\272G\247K\3374I\247)\235\336O\317\336\364\035<\r\315\225\0346\356\324\272#oO\265#\345\220\034\356\327\362s\371\332\267\317\346g\252\274\371\233\312\242m\260\236^bg\3636E)\276\021k\3300\177\334P\236,\332^\2212gbD{`\231v\266\031\223p\275\235m\r\223\262j\fyyz\272j\335b\032Z\242\275q\211\320\016\355"
+	.string	":#\336\326\006X\241\355\321\031\223"
+	.string	"mP\232\016okSk\327\005\373\303\321\2008S|\022\342Y\314j\224'\201\366mn\344"
+	.string	"l"
+	.string	";\025\025\314<\342eHP0\253\265V\240{\235\211'\024(\312\223"
+	.ascii	"\366k\237p\320\350\214\241\311Q\337.\255\321z\032\351p\315\270"
+	.ascii	":f\200\354\022\361\322\002W,\254\rY\0274u]S\217\177\026\370\333"
+	.ascii	"\237]>\3069\277%\277x\365\351\255o\177g\304K\3611\275\235p\247"
+	.ascii	"\356,\315\300\226\273\2647\216\221[\356\3518\\\214\n_\255\365"
+	.ascii	"\202?\3670+\314\242\305\374\261Ey\222\\2\236\222\2005\225\005"
+	.ascii	"U\345d5\254\252\032F\r\230\312\222\262\n\022\263\236\250\202"
+	.ascii	"2\202\"\254\2066\204\304\341\224\021\251\2018$\022\203?YV\302"
+	.ascii	"\341"
+	.string	"UV\360\311\205\260D\226U\220H\214\021ET%$\236\bRIYA\375\202T\302\027Cb\t\027\302\253\037,!\r(\352(\t.\204WNYSRB\252\027NVB\250*\247(\"\226\223\204$\017\257\202D\247\254\341\220\350\004T\333:\255;\304\217;\231\007L\331\264\227\223G\007\311`\225\224\256\203\214\314nk\271z\0136i\233\306\024\254\200MZ\245;\246EZ\001{\274&H\033tgM\236\004gE(\363G\005\373\270\377\b\331\017;\256\325\272\231\036<\270\222i\217\226\301\256\032\343\0228\277\363[\021\315nv+O\036\211I+\033C\023\333\232\303\261C\t\271D\374\004f\215\366n\377\225uI\322\347m\002\367\300~\271\251l\340\013c\250A4\342\020B\212!!\tD\210$)\244\003p\"\031\263\272\r\021\340\2753\242\f\273\001^\377b6+S\0206Qu\242\255\222k\242\001#\352\354?"
+	.string	"\235\002\364)\302a\311\246\226\023\350\376+\223(o\322w\313\226\226\260vh\326\304\"&\341\235\025(im\202\374\016\251\310\2547\354h\304\221t\216\r.\331]\031\303"
+	.string	"\026H\346_\027\245\321\267\234\217\267\266\363K\031\336B7\300GJ\336\013\252C<\301\331r\364\365\245\315=\214\252\200\321\033\374\341\226\360\020\355\314\322\037\305\247+"
+	.string	"\353\005Y\206\002]\254XG>t\210\232~\007\322\375\315\032n\324\252\236\027\344\220\207\313 \016\376\242(\212\3503R4\315|\036\264"
+	.string	"\333-\027\307\025#\240\253"
+	.ascii	"l=\217\331c\243FH\377"
+	.text
+	.section	.gnu.lto_pidController.112.bf4a7a3e0dc1393a,"e",@progbits
+	.string	"(\265/\375`L!\205\225"
+	.string	"j\362p5G P[\031\016\n\r\350%\314w\365\333_\354\362"
+	.ascii	"^F\t\364s\017\333\233>#\302\345\002\344i\035f\310l\354i\272U"
+	.ascii	"\265\232\270\b\251\214\266\003G\326\300T\311.\bBE(\r5\324(\205"
+	.ascii	"\210\330v#\233H\231dH\003\355\002Z\003\036\226x\233\220\274L"
+	.ascii	")o\207\224w\t\311\213D\362*-\361&!y\221\226x\217\220\274FJ\274"
+	.ascii	"EI\274)\022\3571\345ES^c\312\333)/\237\367\207\373\236\334Y\027"
+	.ascii	"2\212\335\247n\265\262\230\303\n\210\312!s\301\177\317_\303o"
+	.ascii	"\370\037\376\211?\341\037\347\237\363\327\371\371~\032~<\377"
+	.ascii	"\336\177\367#6\342\267\371\335\274\210=\354>\320\r\213\306\321"
+	.ascii	"\223;\223\263\341\177\216x@{\224\270\316\267)lx\016\327)\346"
+	.ascii	"\215\212\035C'_\257\254\254"
+	.string	"\207\317\333\022qNz\264\206u\032\3551\203\243\227\026\356\021\241R\332X\233\030\322\300\013\356\007\367H\217\n\002\237\"0l\020\317\344\366{\332\234O\304\224A8\031\210-V\356 \256\353Z\005\302^\017\b\007t\"\304\020\240\334\323-\325\373\337\356\3216\271\337\276oi\007n]\327#8{9\247s;\237\341w\336\267Gx\326I\264gJ\033\271\347\027\032\366\264\360\371QI\35381\256m\316\326\366\207M9\347(\255\312S\356\031e\206\r\365qB\220\352\252[\255\030\355\261R\247\344o\366\316=\332\333:eD\315)urO\017\232\354\036\0355\036\3572<o\217\3348\221\002[Z\307\254\024b\303\240\315\004\213\200rpA\356\234H\201\325\255b\214\322L \224sqt\025H\217\306\360\246z6O\214K+XZ^\217\364\250\224\221\353\240<-\255`\315/3\316\273\227\373\234z\272(\357\260\256+\314"
+	.ascii	"g]\353\252\226*=\272u\377p<\232\276\351xt\325\335?\257S[\357"
+	.ascii	"|\206\331=\327u\265\352\026\266\271o\254\373\362`\365=x\354\320"
+	.ascii	"\221\003\307\r\0335h\314\220\021\303\nF\325\013\027-X\254\240"
+	.ascii	"R\221\002\305\324\t\023R%HD\215\020\001\025\342\311\t\304\007"
+	.ascii	"\017ML\035\226\220JIHGFE)\321\02156\253\373\274\2370\353\323"
+	.ascii	"\354\343\246\254\353=\214K9\030c8\2450\017\026\256\024\372\016"
+	.ascii	"B\327AH\221s<\217\343\3607\016m\3240<\r\033j\340\031\201d~\334"
+	.ascii	"\310\376\260\214\303B\216Ax\253<\f\243\352\357/\374\372\330\005"
+	.string	"!\036nAx\207Y\020\322\300+\bg`*'\2538\334\343\024\207\200\364\030\305\233O\345\375\204\321\212O\212\225\007\222\345\031\227\324\b%\336\215\314\r\2330\266@\214\203\303\007+c\304\356F&\003K\275\001\324\206K\004\222=a`\022t\217\242\233\343\021r}s,B\315\241\002\311\324\244\341\020a\376\344D\206A\214\341\017a^`\017\367\212{S Y\030721\314\344\202\033\031\034wX\343%\243\022[\236/\031N4Cj\214,\274\211@\262\270/\254t\366$\243\323\035\265\273\025L\2764w#\363\302Hg&\334\310\272\360\021\227\033\231(\"\022@\205+[\236\032\241\316\372Px \231\2311\205\2364\033\356F\266d\242-\203a|\f$\343b\224\352S2z\347\321\264)ur\212*\\)t#\noc\324\236?3Je`\306\023]\300\344=\357<V\366\305L$\300\272\256\313beW\276"
+	.ascii	"|\327\250e\367\350\356\bfZ8\005\254\017\324\264\264\336\261\264"
+	.ascii	"\023\247T\305\025t\224.\241[P\327\370bj\033\341\004\316\001\f"
+	.ascii	"{&*\307$5s\371[\347h\244m\350\261K;R37\205\022\313\236\321\333"
+	.ascii	"Z\205\022\313\031\n\245+\240:>I\0015\375\364\251\216\307~\322"
+	.ascii	"\313a"
+	.string	"K\266\302dj\230\027T2d\216G\217.\022\355\216\232\271\\t\266Wa\026:\224\236L\257\361\b\245\337\326c\273o\353\013\236\260N\020\204T\210\360\004\305u1B\233\255\257d\243\032#vV\204\366\311\364\225g_\274\230#\216\240\300\364`\3352\320-6\377\300\230\020\340\272\256D\315\354j\2647h\366\035\254\337\325\237\301\320 \345\323+\255\241\364\301\330.8\305\204\266\247\365\007?e\205\016\361lN\216\027/\276n]\327\243swy\n\355\255\244\033\226\262\316t]\327\034\313_\f\246\276\355\305\034]\325\214\212FEs<\2126\223\245\236\242\234)6\322\273\252\032u\216/\006\245\337w\017\200\201o\200`\335\325\353\272v\241\306\036\241YO\031\250\233\333\330W\272\375\320\027\327\251\302\260{\273w<\332mcM\204^\347\227\301\326\325k\212\233)\315\204C%\333\027/\032K\360n\001\007\360\305\366m\002\261"
+	.string	"\262\201kf\351\215r|o\320\364\003\306\204v\377\274b\224\275\230E"
+	.ascii	"\b_\f\310\361\350\273\313\330\240\235\315-\275xq\241x\267\201"
+	.ascii	"\007\370b\"4\212<\212\200N\274;\244\b_\214\253/h\221M\021\361"
+	.ascii	"\253\273v\353\276\270\231\213\213\213\207\266W\330m\342=\032"
+	.ascii	"3e\220\274\177S\342\275\333\367|\337\306F\346{\337\217Qc!\r\355"
+	.ascii	"\3545|ov\303\357\227OA\013\226'~_\3668\337W\371\234\357\251\274"
+	.ascii	"\316\367c\347\373>\3544|\257\274\340\367`\377:\341\367^)\357"
+	.ascii	"\273\316\346\377\252\276\356\217r\272\277\004(H\274O~\367\035"
+	.ascii	"\341m\276\"\334\315\227+\345\275Jy5Hy3\370\341\027\203\013\216"
+	.ascii	"\347k\301\361|+\370\336\327H\022/\005)\357\004)\257\004)o\004"
+	.ascii	")o\221\224\227H\312;$\345\025\222\362B\200\344\r\242\304\373"
+	.ascii	"@\312\353@\312\333@\312\313@\312\273@\312\253@\312\013$\345M"
+	.ascii	" \211\027\201&\336\037I\274\007x\3405 \345- \345% \345\035 \345"
+	.ascii	"\025 \345\r \345\365\221\362\002\220\362\366Hyy\244\274;\220"
+	.ascii	"xu4\361\346`\342\305\321\201\367\006\023\257\215\016\2745R^\032"
+	.ascii	")\357\214\224WF\312\033#\345\265Jya\244\274U)\357\213\224\327"
+	.ascii	"E\312\333\202\211\227E\007\336\025)/U\312\253\"\345M\221\362"
+	.ascii	"\242Hy\247R\336\023)\257\211\224W\n\311[\002\311K\002\311\033"
+	.ascii	"\265\304;\002\311+b\211\027\n\311\033\002\311\373\204\344uB\362"
+	.ascii	"\202X\342\375\200\344\r9\232\004\263;E\272\262\306\321{\243\217"
+	.ascii	"\3459H\206d\034\034\202\362n\364\311\314\354\342\226W\266\215"
+	.ascii	"\336\032\375\262\033\3260Md@I=g2N\234\343Q\033]$\3470Y"
+	.string	"8'iX\243\017\350h\02736kx\354\020K4s\027\277H\030\256\323\311\006\022\226\206\024\227\214\266\256^Q4zF\363\031\032\035e\250|zQ\351\031\375\273\246\340]\327\210\020\216\257\322\247\351\247\b?,\311\227\244\241J\253\270\373\262*\"J\351\256\375X\313\350Si6T\236\305h\253\226A\210'F_om9B\303h\253~\252S\325/\032F\177p\235~\273W\325>\n\227^.\372E\037\365\370\354Q\337\362\250h\\\fR\224\343\245g\235Tj\200I=cmd9(ND\013F\201\377\326\351\344g(\006\310\001\246j\026\275+\272EKI\341;\214g\r\005\223}\372\034\217\262\350\242\245\027\037\317\220,\254!ihx<\272\202*\021O\355ln\271vVHs\005j\311\202^\243\222\005Fhmi\302\234M\377\3525\"-\350\013z\254\327\340\265\320,\244\352:\353\374\240F\347\260\365\304"
+	.ascii	"q\265\212\246\352\243"
+	.ascii	"\235\322\355+\254S\264\2126\n\312\211\243\276%\252hR4\t\313@"
+	.ascii	"qr\224}A?\254\217\322Np\256\023\006\341\236\372\246BM\357\312"
+	.ascii	"\024q\356\340\316\346\344x\205h\346\362y[\226\202p\201Td\251"
+	.ascii	"\363\363\204\242OL5\212\206\022\244|\312\320\006o\212\317\003"
+	.ascii	"\221-\235N\264\t\273u\336\260{'\372\201\n\227Rm\242\241\004\225"
+	.ascii	"\317\346:\253\222\2028\006\365\r\005a\035\257I\016J*&\013\361"
+	.ascii	"\305\222\205\216G\245\372e\226y\024\233\020\215\rD\211\016\361"
+	.ascii	"G\242K4\213:Q-\242It\224\240\021\035E\247b\371\242\332\\\016"
+	.ascii	"\204#\372\213kP-B\215\032v\3014\352\330\363\304A5\221\226e\236"
+	.ascii	"8\"8u\200\037\232\271!\372\251\037x\206\321$\r%\027\325\256\256"
+	.ascii	"\343\321\020\315\207\326\226N\375\324+\004)\237 \332C;u\224\237"
+	.ascii	"\222\355C\203(\243b\271\241\267A\037\372\206\n\3454\265\207\027"
+	.ascii	"\334\246\206\235\017!\233:\366?B2MMte\371\207\004\323U\347\241"
+	.ascii	"\231M\315\\'\"4ZfwC\263/\005\027\270?&\246\276\nbT._\352\027"
+	.ascii	"\246>\241\245\237\242Ww\350\177\265\321\216]X\247\224\335\353"
+	.ascii	"\320O\263\364\213[:\377f\360\r-\200\305EBK}\257n=\245\033\262"
+	.ascii	"\227\032\312O\211\250\324H\215l\243 %[R+\265\240\206\335\230"
+	.ascii	"\302"
+	.string	",\250c5\324\326u]\201\231\352\tV\324\262\262\343\321\244\276\261v\324H\375\260C^*\250X\256G\270\256`9v\325,\fFM!]W\260\033hI0\325\354xjb\240\034\217\036\365\013\377\343\314\262O\321\315\231D\271\016\315\334\277\265Q\367\230f\237\027>S\271xQ\277|9\03652\306\201\261c;\233[\276\365\223\240\260CE\375\265\357\326\377\273\321\f\037\302Bxwl\274\205\271<\311R\301\2009\036-j\034k|\024\f\003\007-a\271\021\026evoH\343Q\005g*\263\234%\251\275F\244\n\332\002\254c\312\001\353\001\f,%Y\\VK\264\224(\321:\022\002\t\326\026\026W\222\254\037K\005,y\202\304h\300\026_q%\301B\202\016`\364\204+\353\210V\022\254\b\220\\K\262\264\230pa\rA\222\025\204Ik\353I\007)\026\327\225\220-\255\255-\254\"\324\t\226\003J\266\260\210"
+	.ascii	"I\221`q]m5\341\272\032\302\325\204\tW\023-d\bY#\\\031\267\264"
+	.ascii	"\270\216\\\375\270b\302U\204\325\301\222+!#d5\260\245\305\245"
+	.ascii	"\245$)k\201%O\220\240!\024\301R\222E\204k\t\326\326V\223#IJ\262"
+	.ascii	"\266\210`%\351`\311U\021V\222,\016\264\266\202 \311bb\264G` "
+	.ascii	"\311bb\305\345A\007YI8\260Z\222u\245\304\352\310V\bV0\236V\213"
+	.ascii	"\t\326\226\025\227\226\326\226\325Q\235\327\277\346=\275\213"
+	.ascii	"CTD\364\352\257}\217fn\222\013;>\246\333\217\321\305\215\364"
+	.ascii	"\330\336H\363"
+	.string	"y4sL\323Y\276\371\352sw\366\305\213\274\303\271\347e\020.\317\215\236g\343\365\335\241\231 \334\352\240\240\267\330`qQ\323(Hc\306'\307\004\035\303:\235z\215\027C\tz\202>F\320\0224j\247t\203a\235i\323}Q\321D\320Eez\201p\310\365=\215\320\332\334\335h\346\322 T\343,4R\214\306\325\372\352\252\213\364\3174\373\322\024\351\033\332 \322g\241C\030\"\322G\276\323\341;SC\255\237\310naYh\fi\244CC\272\341\f&\032\225\177y3\2044\004\235\344\326\354+#\244\031\017\202&aH\371DJ\033d\203\f3\035\244\357\326\374k\267 \306\2662=93\017\224\351\007b{\240\215\230\361)\306h\346\332\313[zLQ\242^\231\263\271.\307:\206q3\263\003\027\350\315\032A\253f\256\2154U?k\244\233\027Gk\rzL\203v`\r\214\003\375\303B\030\r\364\317"
+	.string	"5\320\307<\354\343/P\325\321\372\212{g\005;/\030\350\2441\ft#\016\362\001\202u\327\315\276\362\\,\320\n\364\007\323\322\026\350\353)\320$\366l\341S>\333\331\247\326\002H'"
+	.string	"f\235\314\335\003\322\001\254-\315:\001:\315>wO\242/ppX \320\374\247\277 \320\267S\242K\004\263b\215^Z3\017\030\023z\302;\344\243\212:\036\315\251\214i\372y\324\361G\037M\233\365\226d\013k\3110a\216G\177\364\353\024\262\212\003\232\0015\375d1?I\346\270\233lK\276\361\305\016h\3649\b\003\340\006~\241\363K\321\314-\321Y\356\244l\3733\365\024\372\303]\333\236\024\006I4G\003\374\230i,I4\006\264\bfNE\272e\227\255\263\204\032\231\331^\\\001M@\337\254\331Oy\247\253\024\320"
+	.string	"\254\r@@\267!eSi\261\036K\306\355\305$\325\2509\036\035\240O\307L/N\016\226\026\240\277d\303\240/h\001\232i\217\031\236\322\355\013\205\211!nN\\Kg\220A\007\320O\241YP\330\\"
+	.string	"\rc\3158\345\243\001\350ki\026\202R|\364\017\001\320Dfh`\335u\244&\333z\242\231\353\354\321\036"
+	.string	"5\373x\364\216\356\321]I\036\3757\205\313\344\232\035}\254\033\364\"\303J\0362&\3240G\035\335\203\206t\264\217\302?\245\366<iw\314\341\007\306\204\232L(i\267/\224T&\361\002\202\263\250\342\350\034T\322 \203hdDD$I\222t\222\n\020\b#q\242\307\2167\022\300T-\312\304\214fH\232\264o\341j\201\3040\304\231\221,\206\304\344\372.Y\340R\3450G*<dg\305\215R\215.\361?\345\344\332\362?\265\210M8\024z\207W\220\003\313OP\b\237\2217\351\353&\177I\222\326is\214Ig\b\200\216\237[\352\021}bH\273\013\222X1>\256\260\253\201\021\304yYA3\030\341\374E\337\336\314\240|G\022KF\273`\266\373\356GL\b/\317y\235\343\367\261\264\306\343\336\326zv/Ib\243N\354\277\304O\004\320\217>#\274m\364\025~l\263\2723\2075\037"
+	.string	"\017\034/\356\315hL\313\300\242\263\211\214b\347\324N\372&vb U\230\021e5\241y\231)k-\247\t\231f\222b\352\323\226\220\374&\207v\331\347g\277\b\232\263\372\224\341\223R\320B\374\233\033\226lm\346\337)6\037\360\341\2767\001\254\230T\202\235aa\r\363c\030\337\305\300\276`\251\301;4n\223\025c:'\257\001\301I\361\373\023{\305\321j\350|H\212\250k\351\004\315\251\212\211cc\346\037\321|4J\325\205^\273\341a\320U\357\005\356\340%`\356\256\037\302j\335\216\235SL[\233\001V\361\376\3752\324,\365\315\266\020j\r"
+	.ascii	"\244\026\301\373t\n\232Ac3\351\027\223\363BL{=\273\033\031t\214"
+	.ascii	"sI\373\304-\302x\212\346\207OC\257?+\344\353=~\243\205\3777K"
+	.ascii	"\312\030\373E\002\005\340\266x\243M9\227\366\225\r\020@\250t"
+	.ascii	"\333p\340\274\363\t\207\364\210\265}D\330y\246\303!\344\240T"
+	.ascii	"M\n/\374g\371\216H\365\226\356\341\0207\241\001\"P\342\241\250"
+	.ascii	"\021\035\346C\350\207\363\337\233\020\263QX\226\314>1W\030'\032"
+	.ascii	" \271\322\027R\214\250\224\"\325\213\361z\361\254A\022\246\360"
+	.ascii	"D\323Q\323\013\370\241\254[\324T\217\013\006@g\343\031`\211\362"
+	.ascii	"\016l\303\370\003\362\031'k\367\201[@\005h\206\255\260\007\237"
+	.ascii	"\277M\357l\330\354r\306 "
+	.ascii	"\300@\237\352\217\336\226\"}\300\363\016\307"
+	.string	"6\007\243\005\n\b\251a;f^\367CF\2470\266\377\340\210\033\232&\233\005\303\343E\267C\037\247\r\212i\316\251\351G\236\021 \0209v\264\2472Vv\0274\210\276\005}U\f\200\300\305\302;\250\332\343$\302?\202\023\230\217\331\243\250T\270n\267\2409\217\303'\234\246&\331e\333\247\340\253\",\221\334\312\t\020B\035\021{;X\312\257Nh\254o\345\277\323dd\360\250\217c>\357l\035\020R\212\362\323\327\302\357\230\342\300`\345\361\021\3008\322E\037\265?\213\366\316\371\260d\351>\363\306\273a\253\363\260\005~`\340\271\bso\212f\326x\323\247\004\332t\310\2338\305\214\306\034\373i:0t\222L}w=O^$\230\376\263\325\346\250\260\370\260m!1\016\324ue\202aa\331\356,\354 \"\213\247\037\306\001\024\312\211\236\241\203Vt\234\214o\031\371 \272^E\023\266\305j\225\030?\020}"
+	.string	"g\3749hh\257D\350\325\037\212e%\360\216\370\235\352^\374\231\317\300`\253|\241\340\254\022E\t\rK\233\352\233\201\035\214-\257\366q\334\b^\311\001\3310\3526\250K,\201\363\240f\223\376T\235n{\2167\320)\301[F6\351\224\021\005g\321\226\004!F\222\355\344\232r^U\024x\232I\016\316\234\255|$u\306\301\233lg\f\265\306x\322\0173I\245v\234e\363\177\226\031g.\003p\013"
+	.string	" t\356"
+	.string	"\201\352/\004\246 \317[[\f\225']\020\300g\370\227\270\377\300rM:\377\003b(#\327\255\251\244\002\013\r\304\245\003\354\t\207\300X\341\206b\217`\266\330o\264X+\364\f\302\210"
+	.string	"6,n\270\252\337\322\250\312^\207p\243\004\"\256:\224Q\344p\312\344\327\345?\217\262\351\346\314p\033Up\f\235H \304h"
+	.string	"{!\035J$\f\217 u\320\322t\004\324\227\r "
+	.string	"@B\001\323\203\366B\210\030\360\253)\332\354$F\375\360\262=\"\223\020y\027U\"\212O\233\353+F+\247Bd\250s\2727\201'J\204\227\"!E}\207\037!\223\200\017\271\347\371\212\365\211\206J\001\3639\306\374\021\231\227\211"
+	.ascii	"(\233'\0231/\351@U\272\025~k\200\016\217\240\200#\260\020x\036"
+	.ascii	"XpM\350\315\336\310gJ\004d\004\002lW(\243\210p:\224S\"k\370\227"
+	.ascii	"\302\226Z68i\313\350\225\305\207\245}9\305\206{\201\321\tM\325"
+	.ascii	"\363\016F`\0074\fh\243\336\212B>\362\367\024\247\272H\274\301"
+	.ascii	"m'\325\361\375H\272\311\364\rEnbrd\341\272(\023}\373KS'\372v"
+	.ascii	"L&\351=\275\025\307qua\325\215\360r\234\212\033\2759\007\036"
+	.ascii	"\2516k\004x\373\360\344\267\364\246\332\235\317\022\3632k\345"
+	.ascii	"(\335hF\3174C\025\f\366\360\013\237g\351\257\210\r/\316\204\r"
+	.ascii	"\024\330P\367\314\211Kb\221\330\360\304>\245\311\245\005"
+	.text
+	.section	.gnu.lto__reset_template_76.5.114.bf4a7a3e0dc1393a,"e",@progbits
+	.string	"(\265/\375`<\001=\013"
+	.string	"v\320?;\360\2047kLm%4.ECW\306:\325\333\333CO7Qo8\221M(\"\273\311\307\320q\224d\343\300\314H\025\023\036\005\033\367\231\265&\350\312\027Xx\364\344\353\211\t%\0220"
+	.string	"1"
+	.string	"."
+	.string	"\251=\275\343\032\004n\325\354\352]\225\2319\240\271\251\261X\004m.s\236\270\261z\025\020!\016\270\013\003\\\226\343\342"
+	.string	"ors\\\374\376>\360!1\347\254\354\270;.a\222\252G\301"
+	.string	"B\331\243\356\274/u0\230\\\003n\215L\005\342\221\035\351\236\264@\340\032u\366\241;\021\202\202\216\265\336\327\003\317NFQ^S\266\251|[\331\207eZ\313\247\313"
+	.ascii	"^`\302\336\317@\347\\\007-t\321F+\275\364\356\246\235~Z\352\251"
+	.ascii	"\253$\276\212\b\337/Sg\230\371:f\306>Mt\364b\031\306\263\214"
+	.ascii	"w4>7\246q\314\3231\314\343\236\217e \247!\327DVGVI\266\225\234"
+	.ascii	"\232\0042 \260\242\272\343\006\177#\336_\331\250\232\213\273"
+	.ascii	"\3562C\211\273\033\013\357\226\302\3201\215\264[\264\032\234"
+	.ascii	")\224$\2540@\211{7\214\255.>\026\326\244\270\033\326\326\335"
+	.ascii	"e\257\021\334\033)\204R\030P\214\352\234\335.\324\212=\360;S"
+	.ascii	"c2\026\242\001\340\341\215\343\235]a\\{kZ\262\345juF\nzxE"
+	.text
+	.section	.gnu.lto_.symbol_nodes.bf4a7a3e0dc1393a,"e",@progbits
+	.string	"(\265/\375`u\007\325\034"
+	.string	"\246\355\243?P\250M:\360\003$\350\021\247s\304Xk"
+	.string	"\245&\300\344\341\226\333C\036\020?\204\221\253\302N\332l\234\257=\250\007\233"
+	.string	""
+	.string	"\244\006\004(%\251\273u5"
+	.string	"\023~<RC\300S#i{\313\024\220"
+	.string	"\226"
+	.string	"\221"
+	.ascii	"\265\307\206\222Gs\325\035\rJ\376j\r::C\275j^}\241\346\370\021"
+	.ascii	"\307\21578\254\213\247\330\350?\2525\016G\343o3\356&\343\202"
+	.ascii	"\256b\360\020F\337Q}q;.\236\247\305S\026\307\263\342\250\212"
+	.ascii	"\337I\3616\024g+O\274N\032\242\031\231\211>\237Z\242\277\211"
+	.ascii	"D\037\023\217\350_\342\007E,\270k\367\267J\206\350Sb\020\017"
+	.ascii	"\236\256Px\345\360>\364\365T\373\263y\023<R\371\277\n\327\324"
+	.ascii	"\376\376\373Ta\276\367^\017\215\241\376\007@$\177\027\260+\007"
+	.ascii	"\320\353gF\341\212\005+\025\312?\t\030\360\307\343\313\013\254"
+	.ascii	"\306\327\220\007gS\214\253\364\250|\255\234\342@\nG)\343'e\024"
+	.ascii	"\006PX\254|\302fI\306eO&\223\235x\254\177W\037\344!\004\026{"
+	.ascii	"\247\322\3547\n\353/\252\302\276\242\312\301\033\342\333OT\373"
+	.ascii	"\207\030\034\221\223>\243\332\344\205\230\234\320\222#\225|P"
+	.ascii	"\222\327!9\335\221\317\031\271\\\221\307\001\037\350w\"\330\213"
+	.ascii	"D\016\250\034\362?\245\220\373\271A\372v[\227\004\244\337\347"
+	.ascii	"\307\226\217\366\005=\213\325\263\034\242\264,V\325\"V\331\001"
+	.ascii	"\350\024\225eS\216\312rZ;\304MY\253\224\017\264\245\335\371["
+	.ascii	"\224\255:\031\201\331Q\316\341\242\254\325\311/\316\211\223f"
+	.ascii	"\300\316Xm\201\223\257\212\325J\231\307j\003\234\314i\231\356"
+	.ascii	"\376\334\255\332\254\277U\313&\333{o\360\304\3333\315\327Ls\360"
+	.ascii	"l\036+\323\f\005\255YH\246\237\034\323,EL3Y\230>'0\375I_\372"
+	.ascii	"\225\274\364-u\351k\342\313\\\372\231.o\351Cb-\317B\340,\002"
+	.ascii	"\226\te7\362\346g\344\212F\256\355\356(\257\207\221\177<\325"
+	.ascii	"\256\034\345\261\233\223\271\350\006\307\215\311\265\315\330"
+	.ascii	"Y\233\224yC\272=v\314E7)\345\307\235\3074&3\227\260=)\037)\206"
+	.ascii	"\316\334\351\216Z%)\013`cs\217\244,\201J\335\232\307\035\265"
+	.ascii	"BN\341\353\216Z)$\377\022\244\241\032\252\243\366)e;w\3242\032"
+	.ascii	"?\215\303v\326;j;\f:j\263N\350\250\205J}\026\n\315g\241\204>"
+	.ascii	"\373\204\364Y\026r\265\202,\203\253\\\226OA={CA\200\221\250Q"
+	.ascii	"\024\206\003\021MPR\220\244 \351\320\002\241\251\242\016\021"
+	.ascii	"`\024\314dH$\020\221@\222\214\246\003\332\337\347\211\371\251"
+	.ascii	"\003b8\341?o\376\245{|L\013\373\236%\273\345\3345]\030\264\021"
+	.ascii	">\326\004\306W\256\3255\022Q\006\263\331\316\223a\016`\343!\016"
+	.ascii	"\001\342\3755\201\304j\314&}y\002\315a\256\2142\231\214DN\"\221"
+	.ascii	"\220%\201\224\356jK\352E\301`8$p\312`J\f\021\017\240(\245U\255"
+	.ascii	"r\306\030\302\372\346f\f\304D\224\265\222\022\360/A\006\350\250"
+	.ascii	"\005\354\023\342@\242~7\332\177\226\"\366h3\226\025\250gDO\025"
+	.ascii	"\207\b\034\001e\207\030\002\323\352\303b\334\207\361\350\017"
+	.ascii	"\311\212\237;d\"-,g\374\351\2315?\260G\030\274\313`\f\007Z\""
+	.ascii	"z\355\370!\021\332\221vl\206\212\221\257\0058\002j\363\207h,"
+	.ascii	"\250:\030\372\216\211\376\336\321P\0061M\304\035M`\355\324\204"
+	.ascii	"Z\213Y\032vT\001"
+	.text
+	.section	.gnu.lto_.refs.bf4a7a3e0dc1393a,"e",@progbits
+	.string	"(\265/\375`m\002\255\022"
+	.string	"6q\207H\320\316J\322\001\024\312\022\004\340`\bS\324<\2552?_\261\253_<\234\320\345\251\217G>"
+	.string	"\3768\352\001\276x"
+	.string	"?\214R\017CC\213\003ZC\2178\362]z\0067t\305\177\375\377\376{6\232\260\211\351h[k[\246r"
+	.string	"t"
+	.string	"r"
+	.ascii	"0\361o\340\333\342\327b\276\"\312UL\235\026\363\224\330g\261"
+	.ascii	"\243\304n\022{I\354#\261\303\276\034\304\324_1\377\210\335\025"
+	.string	";+\366U\354\251P\216\322\350\034a\276\021\366S\330c\330\303\260\223\302\236\021vP\351?\322\347\350\214\331/\336\273\204\362\034(\257\211\362\031\370\262/'\361~$\224\207\200\362\017P\276\002\345)\360M_\236\336\251\361\327\274\357\025\b\353\274\307y\364\232\252\313:\372I\252\227\270:\254\325[)]5\353Q\326G(\035<\251\211\307\031\313\033\313\222<I:\322+\322\220^XA\372\347\365\202}\345m~\364\227\353[\255_\261\376\204z\020\200W\340\270\324\337R?\363x\230\352_\251wu<\t\365\031\2509D\377S\352\373\220\372=\243>\317)\237g\243\257!\203\016\316\251?c\3522\261\307\304\017\377\3143\377\202\372\334\355k\250\247\325~\326\372\030\352El\017\362\315\273\266y\025\353;\256\351\3415O\242}h\345=\335\002`.\305rR,\037y=\004\366o\232\367\236\221\021\201\273\376\275\344\271\373\352\032"
+	.string	"\274\273czw\205\351 ]\377t\237\272\357K\272|o\"\327/\321\322'\201\353\213`\351\203\270\365\177l\265\225~\216J\277\206\326ch}Gk\337\223\373\3444I\300;\337\220\363\344"
+	.string	"\357^\260"
+	.string	"\353\255P\n$\337\t\357\364J\220}#@x\340\300\366m\360\315\227\3017\275\013\252 \367M\200\373\"h\371\036\250\201u\376\030\347\364a\2748\347w1\373[\260H\371W\260~\025\246?\005\351G\241\361\237\030\375&`\375\021\"\177\b\357\377\200\362{\200\375\0358l\374>\245\277g\234\223\177'g\233\276\315\030X\002\025"
+	.ascii	"9R\264^\004p\002\354\"j\341\305\f\314\231) XB\024\203f\372\243"
+	.ascii	"\322\245_\304J\227\260\253\302\202C\246h\237\237\2550:\315\n"
+	.ascii	"X\006VX\261\026)"
+	.text
+	.section	.gnu.lto_.decls.bf4a7a3e0dc1393a,"e",@progbits
+	.ascii	"(\265/\375`\305Ym{\001\272}N\212U \fQ9\351\0248\217\213\034G"
+	.ascii	"\265\036T\036~\300l\207\316Be\340\274&G?L\347z\370\353\320\203"
+	.ascii	"\"\310\352mv\210\240\234\334\336\225\270\025\207\210\225;S\216"
+	.ascii	"glU\002\003\307\270\201\315\256\324\330\r\305\356\252+\276\272"
+	.ascii	"sQ\340\016\241\252\226\020B\366\226;\005G\007\301\b\317\bO\340"
+	.ascii	"r\316\377\333\255\333\372\255\341\232\255\255t\\\253u\025\253"
+	.ascii	"\354\265V\276\235\364\023\021k\235\3667\037\251d&\202\226\201"
+	.ascii	"K\303\306/\347\354\201'\013\216J/\003\276\371&\275\251\227\336"
+	.ascii	"\024\223\336\004\223\336\274Ko\332\2457\271\2447\265\2447\261"
+	.ascii	"\2447\341\322\233R\322\233N\322\346\262Cg\006V\350\274)t\366"
+	.ascii	"\0229{0\3344\276\271#\275)#\265\331\016\235\307\353#c\027\264"
+	.ascii	"\300\211\003\243\361\255\262\307\304j\214\325\311\321\270\305"
+	.ascii	"\376\021$\376\326\223sY\316\231\303\005%]\340\2704\356\"\337"
+	.ascii	"\373\017\374\261;\202\204L\343\267\371\333\177\240Ub\245"
+	.string	"\t[\343\277\303\232\310\317\335\0315\275\306C\222'\026\032tT\215o>\245\267gg\204\210\241\t2\206L\0219\273\265*wfbye\210,\327\330\270t\013\335\243}t\216FvV\337h\253\276j\033\r\244q4W\377\350\031]\243\273ZF\2035V\177\365V\013\351 \275\243\265ZG\363h\032V\331^-\365n\321S\307`~\233\027\206L,\347\244\031\032\335R\316K\224\245\032\035\311=0\261\2744;\362\314\f\311\343\343!\226t\233[\353\242f\206\305\212X\026-nrulV\356\213\223\245\227e\323Q7)\026B\224\326\262\354\267f\355\325.\272\352\236!S+Qu\313-za\\\350l\234\017\024P\226\212j\023\253\362[\263+o$~+\207\367D,\347d\336?\202D{Y1V\355&\305P*^F\2269'\345\336^v\316\306\335$\\\352BJ\225e\316I\017E\036\230\322H\031\362"
+	.string	"\3341x\356\252\344\311h|\314\2276U\277\260\312\206\361\333(6y\214\306\225\323rN^\270P6\272\2745\276\355p\376\374\375\375\375\331\016\347\361]\212\253X\241\363\370J\372[7\266\317\256i\250\023\210\332kMT\\\343~*\002:)\203\245I\343\343\266\364$\336\310\370m\235\316\226\216U\332?\013\3476\216\225s\233\314Y*\347|[e\216U\363y\002\312Qy3\304rN>\001\277\210\177\004\t\373g\375\254\032\232\361\262\013*^VW\006\\\236\016\277\234\223\036\212<x"
+	.ascii	"\216\371\372\322\227\342c\037i\221\035:\257\216\364X+=\306\221"
+	.string	"\3326\"n\335\b\235\310\254dV\3139\377\360H\321`+\322\030X#\265K;t\002\300\n\235\3070R +t\376\322I\177\371\322\337\272\364w-\375\035K\177\277\322_\033\351/T\372V\223^\357K\372\206K/\260B\347\375\354\320\371.K\337^\351\273*\275}\223\336\206Io\341\322[\263\364\326Hz\270\035\351\361\354\320yk\225n`\205\316/\355\320\3715\2750\265V\354\233Uj`\341n\333l\225\233P\311\234\3149\371\323C\350\254Ii\374\023\322[\r\316\373\367g58\277\"\005\262Cg[\241\363\022H7\260C\247\225b\323\254\322\002K\345#H\374>\241\345\262\234\223?\027\3524\251#\247\361\027\220\336N9\021Z&q\r\351\255\005\247\375\263\026\234\357\264\003;t^`\207Nl\205\316'\255\320\371\304\226ip\251\252\270\262Z\316\311\240T\nK[Y\343'\355\320\231Z\241\363\267\030\354"
+	.string	"\354\217\325`\201l\001\002\360[\002\374\326\307b\240\301o\203~\233\301o+\350\300A\250\377g3\370/\234/cm\344\356V\375\266\216\314o1\374w\214%s\303\026\235\270\022\363\367\024V\b\016n\022y\327^v\354\353\206i\246\233\327Wp\\\023\274\221\340\202\2714\276\334\033\026\270\364\242\002t\201\373/\336\177\357\272\347\307\337\254\261\201Kw\270\313\345\277[~\273\366\3379\373\344\267N\354\205\244={\262\030|(\272Z^\302\001z\210\273\364\tL~\233\004\312o\227\374=t\341\376k\202\267\377\034\254\374/z\321\217\225P \315\300\226I\263]\210n\333\337J4`!i>\375w\352\277.\376\313\366\267y\327\232\002\366"
+	.string	"\007\372\315\244\336ib\267\230\231%\260Y\234\354\026&&\361\357\261\337\022\331\036\253\341\357!\277\275\340o\260\253\366\333\001\330\r\177w]*\277\375\261\006\370\355\320\3378,\320o\371l\206\377T\376~\353\363\367\t\266\310\026\340t\376\207\374\234;\345\267B\377U\376\366\303W\034\340\016\370M\013\376\246\300M\373["
+	.string	"W\212=\300y~|\301B\265\t\227\0054\313g\265\276~\313\303\372\260A\273d9\360\333\r\374\370m\217\277\205\356\331o=`\247\372\002L'~K\302oQ\3746\204\337\246h\022Dh\021\372\004\0077\371\333\242\n\347\260\302\272\330\340F\371/\224\377.i\020\260\325oC\360[\020\374\026"
+	.string	"\277%\376\207\273F\376\333\201\"\277=\341\277\031\b\373m\320.\375\026\205K\344\267\035\206\277\345`7\370/\322o\377\206\374\226\251\356\n\205\334 \277-Z\360[\n>\334\025\354\034~;\202\373\365_\203\377\005\370_\302\365a\327{\360\343\020\376\326\373;\357\177\377&\026\253e\357\346o\016\275\204\337\337D\373\004]\202\377\370\307r\376\316\340z\325\375\374q\2339\347\200]~\347\307\013\370o\227=\300\326\323\377\266\271\030h\005\335\034\f\370m\230\377\206\370\337\377\031\374\257\206\377n\370o\321\177\207\376+\364_\242\377V\360w\332\177\033\360_\034\377\375\1771\374\027\350\277\033\3747\353\377\317\177\212\340\2777\376[\343\277X\377\265\372\357\213\377\272\370\357\323\177O\360\337\021\374\267\351\277 \370\257\372_\017\374W\003\377\305\300\177#\360\337\007\374\267\001\377\355\340\277\033\374w"
+	.ascii	"\377\305\340\277\034\376.\363\367\227\277\357\376\356\3627\335"
+	.ascii	"\337s\177\313\375}\345o\266\277\323\376F\373;\371\267\331\337"
+	.ascii	"e\1777\371\233\311\337J\376F\362\367\330\337F\376\016\373{\310"
+	.ascii	"\337A\376\376\372\333\353o\035\177k\375\215\343\357\033\177\327"
+	.ascii	"\370\233\306\337X\177#\377\226\361\367\371w\325\3370\376\236"
+	.ascii	"\372;\352\357\023\374]\202\277Y\370m\234\277S\370{\375\333\370"
+	.ascii	"w\361\357\341\337H\177\243\360\367\t\177\177\340\357\016\374"
+	.ascii	"\315\201\2775\360\267\t\177\253\370\033\003\177_\340o\022\376"
+	.ascii	"\026\341\357\023\177W\340o\020\376\366\340\357\016\376\336\340"
+	.ascii	"o\020\177\037\340\357\f\376\036\300\337\025\374v\314\337\033"
+	.ascii	"\376&\372m\226\337\302\375\326\355\357\241\337\216\3756\371\267"
+	.ascii	"\320o\215\376/\3756\352\267\371\267)~\273\343\267-\376\016\372"
+	.ascii	"\255\323\337?\177\373\374}\341\267*\374\207\373-\007\277=\376"
+	.ascii	"\366\303\337=\177\357\374\235\376/\341\267\177\277\235\363\333"
+	.ascii	"\345o\371~\273\367\333\272\377+~k\346\267e~\253\367[2\277\025"
+	.ascii	"\363[\274\337n\371\257\342\267Z~\033\367[+\277=\373m\224\337"
+	.ascii	"\232\375V\310o\203\374\026\354\267@~\353\342\267S\277\225\372"
+	.ascii	"-\324o\237~K\202\337\216\340\267,\374v\205\337\246\360\333\246"
+	.ascii	"\337\256\277\025\361\333\003\374/\373O\302\177 \377\353\376\027"
+	.ascii	"\375\375\375\375\375=\035\370}\352~\t\230 Wj\007\t\2442\245L"
+	.ascii	",\375\261\233Ub\267\373\204\001)\202\2309\237\035\351\217\333"
+	.ascii	"p[\024\037"
+	.ascii	"\252\364\3570\035\246\231\024\001e\251)P\304\216\325\254\022"
+	.ascii	"\2535\223\023\t\224\361\365d\231\221\311\017\277\260L\321\320"
+	.ascii	"\260\222\304\325\224c\245O\217\2528>\322.\022\013\226\2714)\250"
+	.ascii	"\217?73\200kH\316\320\361\342"
+	.string	"\304\tNZ\001@\220;-Q\216\223;`A\2664i\214\237`3\23718\25253(9n\254I\262#\245\022R\365Uv\261v\300n\f\301\243r\344G0\231\005Jfu\360\251S\246.c&\307do;S\346|\241i\214\221\340%\377\201=-\364\360{\303K\260\222\2610\0317\356\272\315\023\276\250$=\327{2\322\314!\023\023k1$?q~t\301\001K\177\\\004\027\271v\330-9\367\301T\013\233\343\326\370\027l\340\037\377\201\211X\264<\203\203\022dV\207\0362\313=2x\3101\221\036*\2506P\032c X\210\327Z\031\033X\b\016\022\347\003\f\352J\317\034\255>2\030\254\225I\272\234\340]\220J\377\346b\225\315\345o8\231\211\240oH7t~\031\231?\350\270\016\354es\316\371\216\013\331\341\307]\307^'\215)St4\306;p\217$P\210\240\301=0\327\326\230\027>\326"
+	.string	"\353\320\322\226\230G\223\331\221\222\206.L\317\022ka\255\033'\315Q\220\027\360"
+	.ascii	"\253\323\370=t)\306Q$4\347\t\223\306\357\261\222\342\033>>\252"
+	.ascii	"\370\336\032\277\207J\212k\354\274\265e]5~\317X\212[\330pj\261"
+	.ascii	"\345\030\323\370=\\\351o\225\177\303Wgb9g\240\0363l\334\324\032"
+	.ascii	"\277'G:\207\342\tA\203\326\330\305\2204Ke\332\304\f\310\231\306"
+	.ascii	"\270\252\007\312\206\225/\215\337s\005\303*1\214f\203\001)\302"
+	.ascii	"\0313o\322\037?\035\273\300T\315\246\2042s\226\031\211\374p\236"
+	.ascii	"=\f\205\241\360\324\006\036y\307\210Z\230'\270\305\361\0240\254"
+	.ascii	"\215\237\020,\305\343%\007\226\036\226\302Q\246^\r\031E\222'"
+	.ascii	"\366\240li|\036/\351y\256\334\277\253\346\f\016\257\306\347\211"
+	.ascii	"r\3534\261\267\357W\316\235\323Dl\306B\252\360\332Zf$\215\017"
+	.ascii	"\347!\222\376\256\271l~\333\274\315\215\223>\345\374\224\314"
+	.ascii	"3\212\220p\271\241\363\313YY\035p\f\030I\2144\276q\370\320\263"
+	.ascii	"\031Uy\215\337\346\372\375\007\356\364}\021C\346\372\3357-\224"
+	.ascii	"\231\"7\304\f\"\247\205*Vy\335\264T2\027]\272\260\2715\215\317"
+	.ascii	"\263\225\3766C!s\316Xf2#\243z\316"
+	.string	"\337\336\232\326v\370/\330k\005\360\037\347\f\302\204d\206b\203&\347l\331\244H\336\240\264\032\377\277 \233x9Ku=y\320u%\325u\203*\255\353*\210*\255+?I\025y\nB\346\256'\252\264\234\203\244\244\236Lp]Q\245A\345 \252\264|\225[\200\271\2629\331\365\224\245\270rP\226\312P9\215\353\352\002*\251\256+\2524\250\253 \252\264\256\253\234\326\225\201\262\024\024\362\205TF\006\345\264.59\215\353\n\210*\215\353\212*\255+\314\312y\341$\013+\r\232//V\r\225T\226a\265\005\205\004\302\243Jre\275\234\255\332TFf\274\234\005\220\363\026\027R\017\352\206\205\213\302\223\021U\005\212\313&s\316\033\254\242\274\270\262\024\336\223\315xTI\270rN\022\245\224\255r\316Y\001OI\274\034\304\342=\371\330\312US9S\220\2239[\345\374d3^\316\371)\347\214\"\267\2229\347"
+	.ascii	"\242\022\263\262\3129\253\310*o=\305M\345\334jf\340\256\250\322"
+	.ascii	"\274\270D\304)\323\304\262\213\344\223\245\252\342\312bY\257"
+	.ascii	"\013\231\246=\235\345\252\234\263]\223\212]\265\320\327\370;"
+	.ascii	"`\322\377\252\271\313F\346U\t\262\264\"2\3268\311\003\267c\215"
+	.ascii	"F\343\273\327n6\304\2205\376\016\333E\223\fa\245LU\343d\317\214"
+	.ascii	"\031C\270\312\3000\245\3209\201\322#c\263\244\241\253C\206\b"
+	.ascii	"8%\216\334\326\2300N\264\256\300h|\303\\0V\315\342e\345'5\n\200"
+	.ascii	"\202\314\313\342w\305X\345\rs\363>\202D\331O\337\026\233\026"
+	.ascii	"0\376\216Y\372\035\"\351\177\277\334\325\23593\326\370\336]."
+	.ascii	"7\356\016\357z\261\312{w\273\334]\272k\207\266}9r\345R}\2212"
+	.ascii	"v\342\357\300\350p\353\200R\311\037\340\2305:\324\032\177\347"
+	.ascii	")=\260/=\260\314\\\207y\211\362af\213\334\023-^j\215\257\\\337"
+	.ascii	",W\313\257\334\305\362\021$\336#\225\313rN^9\2343\224\265\030"
+	.ascii	"\370X\213\201)\027\006%\345\304\007\346\245\377\275\022gf\205"
+	.ascii	"\203\252\343\376\013g\267\374\255\271\356\324\354\360k\334\363"
+	.ascii	"f\305\212\211\"\323\330-\231\226s\336p\347\266\204U5>\360-m\273"
+	.ascii	"lVy\253\\)aw\315\342\201\231\2103gY\3456\271g>f\316]r\304v\372"
+	.ascii	"\204\3448\261\032\020.%<\032\037\310D\231\206\312\235b\225Wy"
+	.ascii	"\323\322\2247\311=\342\003\225\314H4\354\213\2209\277\013'\255"
+	.ascii	"\313\362\304\007\346\364)\232\364\277hg=\207\2072\314\331\021"
+	.ascii	"\313\225sZ\316\231\210\247\005\27428\222\033\230\304\361\370"
+	.ascii	"\021\345B\341a\023[c\245q\330e\342\003\005\224s\2217\263[f\225"
+	.ascii	"\027\n\224\333\344>\261x`\330\311\3322\347\354a\203\007\314\346"
+	.ascii	"\347Ew\342\377:\371}r\217X\024+\313\331\225\306\266M\304\257"
+	.ascii	"\223\013\247ejN\343\247z\351m\025$nbK.\331Ub\225\227\311\177"
+	.ascii	"\211\330\265w\221{\304\307\314\231\313\212\330er\223\334#\026"
+	.ascii	"\017,\343\027g?\314\310r\316\036\212<x0\232}\311I\361S\266\364"
+	.string	"iZz\215\\1\253\334p\307\362\217\355\003\213\272j\374\264,5A\316v\303i\377\376\354\206\363)Y\372t,=\207\330\301\020\013RG\b\017\364\314\017\251$A:\357\242i\2013\002\346\303\215T\235\266\306\327Gg\271]\367\fi\201\2576\0377\306\345\272g\310\022Z\270]\037\r\345>am\300%\351\206\316\357\307\375\272@\254\362\372\270^\0366\230V\246Lq\223\342\247\\i\327o\363n\217\3063a\270x\223\325\270\263\035:\271\376\373\342\302\270<zT\321P6\336\201\231|\221\t\323\370\251Uzq\364\226{\303\342\251\341%^\226I\344\345|\2009w\325\211\225\315\270\234\305S3q\304n)\243\313\362\352\2709\256\326\335\272YVyq\\\254\337\026.\215\004\\\034\367\352rW\347\020\256\236+J\330\246z\360\177mT]\253\277\371\220\345\240\202k|k\210\370\265\321\203\005\013\224W\343\277\261Bg"
+	.string	"\226q\322\243|\351Q0\351Q\273\364\350\225\024"
+	.string	"\331\016\235\027\017-\215"
+	.ascii	"z\251\032\217*\211\226\027.\356\024\020+\233\361\353\244\225"
+	.ascii	"\301\245I[\013\251\037\256'\037dR\337\353\341\"\362\231*\203"
+	.ascii	"\"\344F}\257\237\316\230p\271P\367\251\207\307\032\262+u\372"
+	.ascii	"\357\346\306\322\\?|a\346p4\306jV\350\034!\342]\347$\313\322"
+	.ascii	"\003\016\235\265\035->`,\347`\301p\350lY\"'\316\211\026\007\210"
+	.ascii	"Y\343&@p\310\200\343g\242]y\303\342\221\243\206\243\310\033\013"
+	.ascii	"~\2226\254|\270\351p\001\316\230(\2626g\323#\367\266\005F\343"
+	.ascii	"5\250\035\237\330\214\306G\221\240\3513\275\354\275N\323|\255"
+	.ascii	"\306*\273\257\311\274\365\272\314\213\306xi\262\276n2e/\214\336"
+	.ascii	"R\204\230\306r\317\220\"\264\270\223\353\353\262\316\263xj\246"
+	.ascii	"\0304\313F\322\327f\330\276\3224\222\276V\322L:\230B\002cL\341"
+	.ascii	"["
+	.ascii	"\346\234,2\341\224p\231\003\302G\205\244h\322\016\235\367\263"
+	.ascii	"B\347Q\255\364\350\213\364g\235\364'_\372\277\2774\030\253\354"
+	.ascii	"\274w^gi\274{\206\004\266}\231\351\274\206\322X,\236Z\316-\\"
+	.ascii	"\320E\314\r\235_\316y\203\007\017?^\356\354\254\234\370\256\350"
+	.ascii	"B\222&fN\032\377\\Ko\223Z\314\022\260\005\212X]\323\265\227\356"
+	.ascii	"b\225m\327s\267\313Nr\234\314\271\312\026.jbv-\027eY\344\301"
+	.ascii	"\303\231\206\005\207\336\016\376\251L\177:I\177&I\177\036I\177"
+	.ascii	"\032I\177~\245WR7!^L\032\377\264\221\212\220\342\266\264\313"
+	.ascii	"\244\026\\Y\0243+\"\320\334\304\362\250x\0211e\211\333r\213\331"
+	.ascii	"\337,\236\232\025\323be\231s^\236\375\315\007\230\363\\l\374"
+	.ascii	"~\266\236h\365\305\371)\207\317\312\007\022\331\370\204\203\315"
+	.ascii	"\316X\261\262k|\372\331\031pr\222T0\205\346'\037\232\263\315"
+	.ascii	"\035\363V\307s\026\343\354\213\232\237m~\262\031A\342{)\331\222"
+	.ascii	"1P\215\3175\367\311\352re\331\370g\337\016\222\2574&\215\217"
+	.ascii	"\200\024\315\306\325U\343s\231d\257JM\3433\315\345z\262\310\370"
+	.ascii	"\001\331\373#C\3464S\224f(yB\226h\033$2\240\312\3744\243e\203"
+	.ascii	"\017\253\361\251w\302\\^\227\215\303Q\220d\375Hsww\212\331\272"
+	.ascii	"T\316\230\275\t\363S\314\005\035;\322\3204>\363\034 U'\246\361"
+	.ascii	"\t\346oxI\033V\215\317/\327\216\310\227\231\215\306'\336\337"
+	.ascii	"P\036ls\332\34440O\360\032\237\202\223\313\311\345\354\242\225"
+	.ascii	"Ra\333\322:\355~v\371A\253\242\203\323\370\254\303B\266\274\210"
+	.ascii	"B\247\361I\367\26794\267%\033"
+	.string	"\226\037\313\271\305\242\345\031EJ\226i\330\370\331/?\202\200\235Z~n\341\343\221\222\362dL\343S\016\025\343\365\205L\3433\213Uk\034\311\027K\n\312\316\344\317\264\337*\317\344\031w\363z\362\023Z\236\201\266=A\222\303/Seu\360\211\221\246\353\253\355g\334O\270\021$\2767\374\241T6>\337n\203\254QR5\376\351vZ\371\201\30014U\3524>\005:\322\263\n\002t\304\3511\347dk\253+Jt4>\327\236\346?\360B\2253\260\255S\315\213W^T\343s\312\251\264\312\327\235T\236\374\361\271\342b\255\256\361)\260\221\336\276\356<\201}\335y\242\375\224\362\003\201Wv|u5>\0052\322\377<\373\201(\333\030-\261\306\247\340Ez\n\240\322\3774;\315\256\235\007j\031\352\252\203\234\227\021\254\2400<&qeeW\016?%\363\214\fQ\270\362\262\370e\344\334\007\021pH\252\306\337"
+	.ascii	"%\375O'\277\023\234\003G9u\240yS\243\3617\0249\217\374$;\217"
+	.ascii	"\234[\227*+c5`\206\030O\230\026]Q\215\317%'\223S\311\231\344"
+	.ascii	"D\262A\353\374\372id\004\t\253<\277N1\024'\270`\313\253Zf\344"
+	.ascii	"\326\207\0367\035M^4N\342-\177jW\215O\"g\021 \226\252\274\255"
+	.ascii	"\306?\303\300\300\204)i\334\347\020\264\f)\265\326\370\247\220"
+	.ascii	"K\307\016\313\213\306?\203\374\007\236\340L\217&\215O\260tjC"
+	.ascii	"\225\006@3h{C~\374\004\373O 6\213\251\346\204*\255\2544\215}"
+	.ascii	"\254\320i\356\211\370\371\243\215\250\325\325\365yy\321\301\261"
+	.ascii	"\365\265\230k\374\"\273\364?wX\345\271\343\354\341\001\030P\316"
+	.ascii	"^/\34022\353\203}\363\004j\307\331\343?y\234\\w\251\027\005\t"
+	.ascii	"\217\306>\\v\350\264a\254\320\371\242\26437\347\230t\314:Vi\236"
+	.ascii	"9\267DDe(\262\007 \311;0\2229\316\032k\2411p\264\2515~\021\223"
+	.ascii	"\264\206\371w>\351-\241\316\314!\212\252\002ew-N\027\026\017"
+	.ascii	"\314\203%v\313\027\347\225\305\313\002\312RVj\234Qg\366y\n\312"
+	.ascii	"\331\207\027\261\033g\216\023\307i\343\244qfY\345Y\343\244\272"
+	.ascii	"I\307\254s\3268\245l\234\305\003\363\240\254\3132\347\344\230"
+	.ascii	"6F\360|\260\371\367=\016QT"
+	.string	"\02503su\3028\221\026/+\231\261x\334\220t\235Xg\013Vy^\025%sV\333pAN\031?\263\023\377'\362\234\001\007C\313E\343S\006_Z]\f\037\215_4\225\376g\225U\236V?.\216\320)\322\370\214\361\275\027O0b4~\033\\#\356I\227\306/\212JOD'=\321\362\234J\305,uxi|\"3\351\211\306\244'\372\222\236\210Kz\242,\351\177>\235\331L\243c\343\245\361\177f\253\226\327\245*\252\361\211\340\322N\332\241\263\203\025:M?3\216)\347\007\3768\201\373\321\326\370Dj\351M8\377\201%\b\271kk\214\355\345N\323\315\3157?\260\353\214\210Y5>\221\224\364&\033\263\315\017\364\321+\262v\326\370DO\322\233k\376\003\315\266?68\032\233}\351\024Q\230\006;:\254\360\320Bs\263\3577\367\354\030S\r\013\177t\33646\323\230\313\233jL\276l\252Q"
+	.string	"W\316P\246\232\23799C\375X\213\201\265\030`'^F\330N|\"\260\364\202\025:/\234\210\233h\274hYFi|\242\026\322\333&\326\314\3133\313\\\252\f\325\245\200-\310\255\017f\032\337\022\033z=\\Kl,\2238\007\233\2304\323\034s\201\\\225\361jl\2129\317rH\3015>Q\0133\214\006\276\3647\277\230_0\354-w\310\341\205\271\273\263j\370\t-\317\330qq\344\326\200;Sk|\rsvf\233\331\345\222\361 \212*Cu\031\340\217\313\r\235\237\006ez\rG\322\337\2443\351\354\336\0051e\2768i|\r\346\026\263\315\234\303V8\253e(,\022\177x\032l\244\327"
+	.ascii	"\225\376\312Y3\313?\202\204\331f\312]9\234\263\362S\037\006\177"
+	.ascii	"pC|\351\207\346\252\230q\346\225\033g\363\024\322\002ou\313!"
+	.ascii	"*nn&\\g\256\234"
+	.string	"\305P*otK\363\355&\334\375z\332b\323\330\264r93Q\226\234\r)I?\324\245T\232l\177\331\r\235\037\217]\233\334e\256\335dCs\233\003\243\261\251\006\00150R\215M*\330\314\233X_\230\325\177\240\221\234\020\277\306\037\242\221\226\206sx\220\225\237\324\b\300\210\030\326+\013\233k\374\241\250\3647\321L4\234\205\245\320\362\023\272\327\343\310\025\340\030\036i\370\352$\223x\312\312q\271\241#\333\231\202\306\305\305\215\231\031\246\223n\210\202\327\203\366#\256M\343g\360b>1\237\230e\025\030\342A\273\203\303\322\330,\273rcH\274\252\224M\232t\330\211\004\316\210\241\267\314@\204\t\023<\325\206f\231\263\262:\\\320\261\224\303\243\3613h\245\277\251\304T\322a\227*Cy\211\200\202\314\320\302Db\"\301tH`\341\022J36\266c\316\210\221\255\264\2600\035Bc\351o\0161\207h-\205x"
+	.string	"\001b\006\261\310\224-F\0160\033d\313S\220\306\027\272\221\036\003\234\257/\323\013\003e\251!8\304\364x\3600\275,2m\213\221\265\314\310\374\301\3442{X\345\345\314\256\374\363\263\245\r\017\270\306\307`\227\256\220s\316\366r'z\271\363\030\332t\350\370\333\341\230hi\311\370\201\003\307\215+\002\312y\b\f\261\034\351o\3360o\304\210!\206AF\372[;k\327Vu\223\006\215\262\030XX7\316\006\345\f\025\006G\225\376&\322D\336\270\023\031B\333\013\f-L\031\246\f<\265AI~"
+	.ascii	"\2322g\215\037\364&\375\315*\263\352\312\331"
+	.string	"d\236\201Z\301\005\335\245&\225Ie\302\200\300\024\"\3134k\311\030\224\371\342&\214\013SU\322\306\370\316\300\274\2064~\320ZzS\312\232S\346\224\213):\226Ad\351\337lK\345\f5\200\237/(z5\032\233O\346\223\031U\204e\351\206\316\017\r\303J\262fB\335\214\352\262\2640VA=\322\037\377Y%\376\273qO<a\313\254\017)\032,%-n\314\231\203\351\2449\347'\240\034%F\206X\316\312\352\340\003\244OK\224\306t\370L0I\212\2605~P\306~\330\017\307\345\035%Sp\374a8\3078/\312\030=\273\377\300\323\313\2149q\032\037\350\214\0337M\340\356\330\260\371[\005r\2133\006\214\301\271\241\363\003\352\263J\334g\343<"
+	.string	"\343\202\202\312@\t\226\027\235_\316s\037Z\211\2234\"\215\017\364\265\\\336\263\253\235\030G\272r\234b\334\376\3324\376\217\2341c0\037\003\332\340\355\035\363\3313+4\250\032c4\227s\213\323\312j\214\317`)\270.p\322\032c2\330\214\335\001\247\006\0303e\332\366^\344pKn"
+	.ascii	"\"i\261\304L\357JQ\322\202\335\324O_\2300\177\303@9F\024\217"
+	.ascii	";0`\376v`\316sp\340\330\360\360\376f\221\032Zh\263Z\376\220\245"
+	.ascii	"?\366\242\304^\254ZQ~\352\303`l\351\206\316\357\247+\375\261"
+	.ascii	"\335\255\022\333a\033\030\n-?\375\264\365\370a\346\227s\326\007"
+	.ascii	"k\347\346\306\214\306\377\301\301\205\013\246\263[\226n\350\310"
+	.ascii	"\336\346\230\356-k\b\262\361\177\362\226-\337;\221@\027S\324"
+	.ascii	"\226j\344\344\032o\007\tlkA\027\006\013\0263\271\364\307q\267"
+	.ascii	"J\034\207i`@\226\360\305\345,\375\361\333\255\022\277\005W\002"
+	.ascii	"\2412\t\327\r+\212LG\300+\2018*\255A&\026Ca\320\270\036\207\304"
+	.ascii	"\243\235u(\274\034\216\353P\025\036\tY\260P\211%\234\212\304"
+	.ascii	"\022\033\232\206\352\272~`\342\004\212UM\332\240&\r\203)V\020"
+	.ascii	"\222`$\256D\022V5\t\bI]\203\306\2465\250bm*\256M\0278\236\320"
+	.ascii	"\200\252k0\205Q]A\310\024\302\250\256 $\241\347\347J \216\214"
+	.ascii	"FG,B\034\261\320pD\341\203%\026\252\211\243\024\253\232\204a"
+	.ascii	"\025\016OdX\325#\223\312tb`UC\370\001\002\001\305\b\253pxBh\025"
+	.ascii	"\016O\\\270\022\210\244\241\320\270\036C\250HMK"
+	.string	"GCa\b\343\261)\204\206\245\245\246\341\2208DW#\225\005\341\361T\201hTZ\211C\224EP]\302N\305#&\225\351\274\022\210\021V\234P\021\342\202\020\034\021\227J\250Fb\211\037$u\r\246 \\\217>8\0065\240\"\021\231\214\302\240\220S\221X\302\007\303\203k\020iU\217>+68\025\211%\214\216NA\243\361\203\343z%\020\305&\2421\311\310\250\256*S\320\030,\206\310\340h\330\3043d\321\346\321(\251\330\263\032\r\223\212\3460\251xU\026\204G|<\252F$\244 \352T$\036a\343Z\274H\3520I\270\024D\221\324c\023\036\022\205\353\221zDo4J*\202\270`\f*\035a'\343z\024&\251)\214\216\031V#\243\013\305 \t+\250H\303\023\304\025\307\240p\351\203#\243\006\023IC!\2231\310\023$\002\204\272\006S\b\241\b\032\001\342h\302\372\001\222\272\036\251\253*\224"
+	.string	"\020*\022\221\204\241p(h\003\020\307&\2420\005\325X\304`T\227\226\210\306ux\201I]\217N*\200\210F\247$\214\036\217\352Q\322P\2104TQ\020!\251\353Qm\022\201\232\002IX\004rB\n\252)\206\2064\230 \032\235B\300\240\256\301\024A\250\360H5qd\301\321\004\247\340\222jb5\n\256K\252\t\225I\270\362\034M`\022\256"
+	.string	"JaxBh\305\t \247UxD\\R3\260B\220\211g\205\340\222j\344A\022\241\205\"tQ\204\276\200\244.\241\020\034R`\b\350\204\206\023F&N\2408\nW\b\002\211F\247\020\214D\243\221\002H\302\242\206\025\253\252\002IX\3140\024\006C\340\031\n\203!"
+	.string	"\257\004\342\310He\022\256\303&c\210\243cRp\t\004\025\211H\302O\2220\205\3400"
+	.string	"*P\204"
+	.string	"D\022\026S#q=\n\202\200\341\250\252\306$\325D\211\fCb\320\030\244\"\021I\240\300\272$\\1\224*\255IC\325\270\216P\201\243\245\340Q\221\217\n\301\r\364\260(\216\3403$\n\207&\260(\216 44\004\201\bIX\fR\327 R\321\004\r> ,-5\r\177\220\204(\202\202\326\246\"\223\320\321h\b\302\252\036\325\024I\305\241u=\032\325\245&\n\250HM\253p]\203Ck\220\270\304\302\\\215\216&\250L\3025U\223\206A\245\022\033\200\307U8<\201$,\372("
+	.string	"\004\013\036\325H-:\255\300\200\001\305\317\217\204Fu\250&\245W"
+	.string	"\007\b\340\240\203\025\320w\320\200\r\032\260\301\371\016\032 BD\0038\020\221\236\003\021\227\004\b\016\026`\244\256\301\245\"\223\272\032\255\352Q5\032eP\215\3245\270\252\020.\tQ\b\256*\220\204E\242\243Q\222\220\305\220X\002IX\344a\"\016U$\243\343Q=\"\032\213FH\302b\320\225@\020\215NI\024\034\215\210F\247\244s5\032\221"
+	.string	"\225I\270\026\211\304\021|X\2240\361\001\321\350\224\224.\021\211\02302W\026*\222\321Jt%\020C\2420\030\342h$\036\207\352Q"
+	.string	"\307&\243#\223\320\270B\351h\025\242@\032~\260\264D4\n\251\0204\336+\201hb\022.-\021\215X\351h\025\026MT\205\240\323=\252MK\301\024\316&#\026\305\021\200\326\243\221j\302(d\201\001I]Z\022\262\340Y\207M\304\022\253\232d\f\256<+\250HC\241\311\324\244\"i(L\201\310\004L\032\n\217B\342PE\372Y\323\243\321\252\252\020\026}\202\224\216Vb\t??ZW \365\321\210G]\203\353\321\f\201-\221B\304Z\004\256W\002\021bHdb\"\036U0\302\251\217F>\033\240\320\"P\350\021(\264\210`\217\b\266\210\025z\304\n-\302\251A@\n6\211@\210BO\312B\005X\024G\3301\256(\200\206 8-\025\213\037\250\020\334"
+	.string	"\223Q]\213?\253\232B\351\0304\226@\022\0261\370\034\215\324%!\013\242\021\005\222\260\330\263^\251\350\304\242j\f\261\022\211\306\020<&\354\321\250\003$a\361DaOX$a\361\252\020t\332aA\311\210Eq\251\207\005%\037\026,\210k\323\221\221\322\321J\034bP\213N\253\221Q]\227\204,\214\202\326\241zdTQ\254C!\021E\261\ti(\324"
+	.ascii	"\021\217\n\301\r05\251@\022\026}\206D\341\032<\016\325\"\023"
+	.ascii	"\261\004\222\020\305\032D!\005\241\241\220\204\365\003$a\021"
+	.ascii	"H]J\032~\360\343\264\nS\020\256\302\343PU\261\244\246\240.\001"
+	.ascii	"\255G*\013\026B*\022\221\311h5\252\305\025T\243uI\270\032\r\211"
+	.ascii	",\b\215D\245\242\025\352\322\272\022\215J+4\f\205\301\020\214"
+	.ascii	"\3045hT\231\214\352*\314@\024\256\301\024+\004\227\324\024\030"
+	.ascii	"V\245$\241\252\001\025LFuE\022J\241B\320)h\0252\tGXR\217\216"
+	.ascii	">P\327\240\321\007)\t\bi\211\250tT\215J\253\321:\024\022\213"
+	.ascii	"\253z,R\231\204\353\316j\304\201\210u(lJ\235\202K*\022\217\272"
+	.ascii	"\2244\ffX\215:X\207\302&\364\f`@\211\013"
+	.string	"L(!\204\364\b\004\222\260\030bUJ\022.\261\b1\024\006\231B\034\031\217!@\020\251k\320h\344dTS \036\251F#\245c\320x$\364\037\325C\255\364\270\276\252\332N\201\251k1\006\305\002\243|!\306\212\307\016m\216\2260|r\274\2742\232G\007\257\341"
+	.string	"\363\002\203\326\200\361\246\366\246q\262,\347\244\317\271\204\210\213\270\306\250\035j\207\336\001}\312`\341\243\341\345\350\235\227\031 rt\215\321.\330\352\202\251\023\366\306\002\262\364G\3530\235\231Z\226\035\235\215;o\264\220\323\206\316a\273\250+1\032\307\311\233\361\246\361\225+\250\026\213\354S"
+	.string	"\226(3q\374r\026\r\271\243Z\336\226H\331\213k\214f\371\333\331W\034\230\306(\226\277\375X9\323\033b\001V\372\243q\330\206\007\277\037hp\347\037\337\216\2610\215Q7\324\312\321\267\243o\215\276\335\277\277\023J\030*g\025\234e\202\032\024-m\250\213\363\207\022286<\325;\330\304\361[3\203\264\021\031F\332\250\231^Oc\322\2064F\225i\234:e3p\037\032\217\255)J\036\251\030Kr\032\366J\351\004\311\"D\212\23425P\344P4\032|^z\350\2351\231sw\206\325\030\215\222\364\361Bf\214^\343[ \003%C\311P(\351\023\2312beG\241\330!R\244\350\032\243O\260\220\264I\325\032\245\023\237.\310\251/\250\023\264\t\027\335\033\037/g^D5>\0075\350\030:\206.\261\031\251\200?.T\311\321%e{p\3224F\223\340%pt"
+	.ascii	"A\202dgk\207\026\027\024\tz\304g\307\023*bz\232\364\245\375h"
+	.ascii	"|\016[\322\037\025\303\311\236==41\214tQ\202\231jR\344\334\202"
+	.ascii	"\321\372\234\314\205a\262\237*=f\210!\"\306\253\013o\314\020"
+	.ascii	"3>F\370\314D\t\301DR G\274\354\br\266\301\213\362\027\2441\372"
+	.ascii	"\303\236\340\357\357\357oN\316P\350\217\323D\327\025U\032W\316"
+	.ascii	"P(\030\n\344\350\217\377\340&nJ\310N\234\314\220\305D\206\017"
+	.ascii	"\273t\215\017/\006\332u\324\353\247\317F\017\255\306(\027\332"
+	.ascii	"\203\211\030[\231\357\361!As\305\2541\272\003\345\001&\266\206"
+	.ascii	"\345i\276D\372%\3613\243#\016\225\361D\316\217\255\263\007&\223"
+	.ascii	"\313J\255\033\307\247\311\336\335\033\232\003\347\230\343\242"
+	.ascii	"3Cq\234bu/\304$\033\337\270\201\351\212\270\256\2305O\312\310"
+	.ascii	"r\316\352\200\271\324\2658\323\370\034\240\2404P\032h\r\016P"
+	.ascii	"\274\242\3200\302F,M\343\032o`G|\254\021\2311\003\305\262hy\006"
+	.ascii	"\004\220D\241A\006\324\2131f\354\352(\026\236\323e\213\2561\212"
+	.ascii	"\254\021#\006je\321\362\214\fP\240\274\350\374\234\274\030\303"
+	.ascii	"\003\255:j\325f\n\236\031\007+\364\005\372B\312\223\262\035\256"
+	.ascii	"\fw\325\370\025\320A\243\320(\324E\224\250(4\242\300d)\350\324"
+	.ascii	"Q\027Z\336\264\tk\3746h\2135ch\374h\374\243-P)\017\364m11\235"
+	.ascii	"\204Y\362\242\361+\220C\237\320\247\363\357W*\357\b\003~1\343"
+	.ascii	"\263k\374\n\246\234tN:\347\237\025\223\367\244\314\002L\356\262"
+	.ascii	"\316:?\377\330\240\374\315U\240\365\346\315)\247\t\\\232\206"
+	.ascii	"g\250s\221\224R<\260\006!g!B\312\320\214\314&\031\016\343\025"
+	.ascii	"@ P@\034\221\211G\266=\023\300\304\313J\205\221\236\346\030c"
+	.ascii	"fHDD\222\244\240P\330\343H\023Z!\021\323\271\016\370\354\207"
+	.ascii	"@\276\264\305K\036\262\340\210\360`e\226\023\271\343\222@\326"
+	.ascii	" \337j\227\343\306\324\030\024k9\322\354\r4[\327\367\336\302"
+	.ascii	"\306\r\310\235\302\331a\274\302}\221\313\346\333\225O\227\237"
+	.ascii	"%\277\225\276\253\216\344\321\270+\201\021\340\367b"
+	.string	"\245\002\232O\f\3735E\326\211\026]\343\271\002Le\250\354S\335\027\340k\365Z\230d\016\356\244u\245/3\006\305\222}\337\353,T\364\f\361m\220)\253\351z\312%\331\0049Jc\266\343\240h\320\325a\311f\306\206\246\210\020\311\nf\213\020\\\r}\347\tF\301\001\227 \371M;\326\366\227\351\373\205C\\ \364\021pSX\322\036\001\230\333\212\024E\023wg/\344@\245O\\\310\003\303\277\305Y+R@\240\n*U0q\336\356\352\245\344vaD\022\270\236\375w\336\205\277t\377\212w$\004\323\002x\363r\254\2720\217\b\301\313!\276>\263\233h^\035\235P\250\370X\005\367m \355\336P44\352L\333\320\275\270S\345G{\217:\332_\336\322\362\227\224\203\204\366<e9\334\304\255\211\n([\232\312i\r\300\307^\310\264\247\331\005\364\342\322\320\271\275dd&\210\177\356\"\035u?/\031\226"
+	.string	"F\235\353\202\371\213\372a\367^\342\245\373\312\305O\004BW\005x\032\rp\330\221U\330\326Q\363\316\204C\234\260\003\310\361\333\264\235\030pZ6\365\363\026\214\333:\314\345\337(\205\025;m\250\215\274\251\005\216_"
+	.string	"\362\256\241\001\232\231\224\024;a\222'\345l\265\341\271\226Dd\311\377\336\314\225\376\007\352=\333\245`\215ehC\023\023V\234\225v\315\231\374\032[\213\217\205\303*\004\374Jk\267V*su$o#\213\211\371\223L\034\307\024\207&\021\243b(\263D;\022\352E\375W@k\253\346\337\250\354\244\251-+\024G\220\311\210\b\243j\022~\250b\261f\244Vu3\263\365\222\347\213\243fA\001\327S\004q\205d\303\227M\246p\345\007\361\276*\264\307\230\322\263\035J/\205\224\332B8\252Ve+\f\257\n\t\007C;"
+	.string	"\333jj\213\325\300\374<\316\240\256%\221\306:"
+	.string	"?\263\273\016tUl\236\225\025\"\312\257K~\370q\235*v\347/E\326\304\335Vy\244\036\260\205UZz\225\237\3549a,p}\233\366\377+]\335\274?\273\034\220GW\030.\275\366\347C\211\375\201\240U\360\205$\327\334\336\370'^\354\343O\037\025\n\374\251\223\270[\243\210\035\371P\357\305\365K\020=;\346nJ\207\312B\260#\364\375Pi\355\007k\253\326\":\367\b7\276\360\334+B\266\325\3679\037\370Q\235N\354\363uW\305\"S\376\372-\372y\032\264\bz\n\210\236\354<\006\360\311\336?\007\310\247\030\246\030\366\340\271e\025\262\273n\bt\241\250]r\2045\320BLr\364\304dG\202\233KJ\342v\337\016<\217!\220\224\250U\230\311\300\017\311m\305\366\305\023\017v\324\352\264\326\221\030#\265\276%"
+	.string	"G\332\322G\207\272\223\026\307\335\376v\352\305\251\b\303\255\305\210\363\223\336\201\001\243G\242\354\260\002\016g\321l\245\277\n\035\321g\221\324<\rb\316Y"
+	.string	"a\237\262\345\347"
+	.ascii	"\tg\224'\005\0024\001?B\222\225\223\352\020\016c\302+f\212\341"
+	.ascii	"\210\020\266\326)\266 \337\307\214\\\277\037\305h\332\334U\177"
+	.ascii	"QCe\024\302\240J\262\024\236\025\257W0j-\001\214\177\246\022"
+	.ascii	"'\251q\371\317\341\035\035\ngc\033D\264\030>b\326U>\242\f\004"
+	.ascii	"\320\246\252\235\310\362=7\261G\360\330\265\234\216\017e\257"
+	.ascii	"?\271\207ZV\002C]\t\264\352\245\266\243\210r\220\275[w\331\247"
+	.ascii	"\203\n\334Q\250\030\241\341e,\272\361y\274\342\2269\001Z-\251"
+	.ascii	"M\037\255\372%\303\326\373\240\206UFs\355\3342<\tE\367V\305\325"
+	.ascii	"\261\243\355X\204e\032\344\214\221s\032\030\221\022\235>\223"
+	.ascii	"V\036\304)\247<\230\360\005\310\267\360\301!\347j{\035z\222-"
+	.ascii	"R@D\270\270&\024\005\271\204o"
+	.string	"\251\360\276\310\265\252\260\276\265\251L\031\340\235A\211\t;\021\312)\002\372\212h\275E`\374\231\n\021)\223Jom\243\213\217\245\004\033[\201\366wO6d\022\335\257=g\312\022\245\n\372^\350[\223\271\273I\271-\347\330\365x]\032N\037\354\337D$\332\347\245\177\337\225\273u44\271\252k\244G=\247\351F\005\301\b6ba\354\\\316\202\214_\"\346j\";\253%\314!\334\345\320\202\242J\r\223\020\037N\301\003\375\273p\363)L\2246s\301\271\b\324\253\342\224@r\023\t\313\362\031TD\353\260\357M\002W\354\030r\356\262/u\277\t\345\024\345\320\345-z\212\202R\327f\373\215H\335\346\205\020\204\242\340T\021X\3647n\313\022\307\232v{}\227\241\\\206pg\304\035\304\202\251\2011%\343\227\352\3368m\206\266\3234pf\355\352YI\021\"\326\353hTl\262\222=+\304\375bl8,"
+	.string	"\354}\217Jb\335\n\316\030\243^n\3531\233\3102L-?\260\f\361{\271G\026\275@\261\307\216p@\265\001\363\244t\246\2118Gb_t$\241\362R\016\303\342\272\356\211\216)\035\213\336\210\235XW\022\356\020NZ\276A\341y\3204\335N\377\\\004\305"
+	.string	"=F0BD\257\277\344U\375\223\202\266.#J\277f\304\334#\215\007\254(\242\271c\016\037\217:%@#\byN\214\031t\206\240a\013\363\356C\3511Pl\261\303u\033\210Vp]\006K"
+	.string	"\031N\226-\026O.\325\363EXT\006'zi\272a4\2230\360\3301a\313NM\027\221\222\016%*\214\325r\033\227G\177\222sO-A$\201\360\004\341!b\024?\357\322-\357e\346\241\245\315\232\252Eh\233\326\262\257\0327_\231D\030\024\217\312Jl\033\375\240:\021\330it\036"
+	.string	"\034\025\017\355\332\\\301*\027v<h\215\216$t\301\263\025\211\300\032\300\363g\022\240\\-\312\361\340\310\370\020\032`z+2\204\n\30104yb\227\371\030G~\025:j\260\203gA.\365&\353~t\264\223\300\nONv\366\032\347\253\"\300\325"
+	.string	"\032\004o~z;\302I\321\374S\360\210\377b5\200\347\325Y\210O-\321mi9\240F|\207)y\271mM^f\277\237uJ\007h\r#\333\261a\313\355\0236,\030\202\366c\206@Z\327\007}\343\352jK\032\322\302\234\227\226\204\245\\Mh\301b\213q\267>\002\336!\326\341 \242\346rS\216\006\334\365[\256yr\256\360\334[\334<\222Ab\225^\026^=P+"
+	.string	"\275\330\001\023_\261\203"
+	.string	"\200\016ea\263\205\202\004v\241\230\034\260Ko~\022\306\236\026-\236UIb\260B\031\b\252l\037\345\201+%4;\312\020\213\253\250\351\r\023\331a\213\372\225\251\354\316Z$\364|Q\332^\352"
+	.string	"\323\345J\257\365\355\214\221\267Bb(?t\037\r\373\241\200\215 \303\013\210\206\030\032R\326\r\b{D\367\177\024\r\n20\360\341_\374\036\030\260\250\352Ts\016\330\242i\364\330\007\366?\304\211\370\207B\323\265\271\315\316\276h\024+\376\362\343\303t\035\302\270(\254\036+\352\003\032LG\317\300\202\241\245\007D\247\246q\240\367-8\221"
+	.ascii	"\322\327=\364 \244\376_\243\362J\375\031\b\223\375\257?W\376"
+	.ascii	"\271\342fqy\262\351V\257\3338\226\237\327\256}6\021\031"
+	.string	"\235ZU\007<\323\321\326zph#\355\321\336.A\202,\004Z\264s\350\240\234U\b\361\025\242\211\354\0300\364\223\0330\350\374\262\214\2753h\306\255\033\356\264\023\244\370\275\302\276(B\n\223\276\017e`\261bw\335\347\232\340|\f\031\306\243j\202\"<\250`\374\375\273:\264\n\265\361\347Ze\024\301\324\215\t\361$\005Z]B\327\274c\307\2265\246@\217\254ek\317\3278\242\340\276\270\363\037\362\370\005\3161\2357`\241A\203\251\206\274\355\222#\254=\264d8\371=\353L\306D\306F>\244BOQ\207r8\323\220\022\310'\237\223\356i7\034\202\356\204\324\304a\351s\352\026\216nT-\220\376\211j<S\003\337\221\036\327k\0245\201\354\021p\310\234n\305\020\244^9Kno\362A\200\036#@\326\262#\363,\302s\2321@\2545\324\331S\250\334\\\233\236\360j\b\355\263\004E\331?\f\253\250"
+	.ascii	"\177\351z\254\264B\b-\006\203F\334+g\203\265\037\"0\367RV\220"
+	.ascii	"\267\374JR\270\377dc\007^\313\263\t\312\006`\037\030\267\347"
+	.ascii	"\273"
+	.string	"\227\241\377c\316[\361\262\377;w\004\254\036\364r\270\326\274\307\366[\211\301\353\336\013\351LJ\027\255\201'l\340\302\t\235\243\227\275L=b\276\302y\0039\305\177\245\005Pp[{\235\371\323\347\352\200\246\307.3\240=y\n\356I\245\254 D\244\002\016\356\213\002\337\240\226fn?\337sK\b\272l\001`k\3577\036-h\224\203@0`\332\347\315\226\230\326\200\240\370\344\223\332\306\373\350\247q\036:Y\310)\0350\002\331\266\373\242;b\023\234\244\017a2\243\177\345\004\336\\\214\t.\370\243?)<\315\325\210*\226\030{\033\355\356\224\201\261tb\006b\355]ZY\216\245\307o\034h%f\371\001\265a\177\366\"\370x5>7p\220Q\265\020\0322\313\372XDCH\020p\353\251\324q\350#\204\233W\003\ns\370H\274&\342V\314|4\312\370\236Q\255\367\257oR\205\001p\373\031\240C}\036e"
+	.string	"\366d_\370\260\354\312+\3312>\272\330\221\033\375\302\312\263,B\214D\377~8\362g\350\307.\217i\300\0338\310\215\265\020;\303\320\210\201N\241\ngj\230\301\207\023\034^\312\274\221\376\206\206\013\275\327\244\324\274bn_\004\246_\3659\252\211eU\007<\036\334\275\350W\271\020\302m\307o\3246QY\300\254\322\274\177e[\2136j{\351wg\326Pr\372\310\\\342$OX\223\247\017\177sXR\t\215+\275i\314-\003\303;c\221\320\271K\214\024\207<\320\tc\272\240J\323\341\2643jA\374\205\260\036\373F\365\016m\354-\337{\200\363/\311>0y\323\373\013\224\311\343\343\252\270\002\336;g\377\274?\334y\240\203\3273xa\334\327\""
+	.ascii	"\364\217\206\277\024~5\265g\254\265n\367?\001\370Yn\2758^\341"
+	.ascii	"\263x\363\3556\207\2618\355\213q\364.\277\305\242\"^\3147\261"
+	.ascii	"\357\275\302\226\037\f\305\317v\035R\347)\260X\346j_\363\337"
+	.ascii	"\007}\331\263f\250\037\252\337\273r\336\223\343\003\036\013\364"
+	.ascii	"\316\304\035\257\363\307\340\307\342\372?`L\377\034\267\370\376"
+	.ascii	"u-\247\032\302\026\277\002\020\027\217\367A\037\220\350\037d"
+	.ascii	"\307\324\314P\312D\342\374\240\377\230\030b\344\302\332\273\032"
+	.ascii	"AgFP\374\351i\026\215\264L\006\317d\354\357L8\242\315\233\377"
+	.ascii	"aG\024\336l?\315\230\373\375rx\343\304\375R\211V+.\326>\205Y"
+	.ascii	"<\212\017\212X\224\357\323`k\334\366\020\034h\2715\031;\243\334"
+	.ascii	"\216.\367%^\336\316j\030\317\035?\203\272G;~\302d\257\370\030"
+	.ascii	"\250\301\302\262\227\214\271\226\313ZL\3069\351i\032\032\215"
+	.ascii	"\356s\305^J\271R\304II#\255\t\033U}I[\223\006\317\to\035U\376"
+	.ascii	"0B0\207\3659\310w\321\372g\344\251\362.(//\356\207\312\254\232"
+	.ascii	"\rE\236\021 /a\272\024=\n\352$\261\2154\242\213\332\357"
+	.ascii	"\301\266\216\340\377\351e\n{\265\246\337\364\235b\330\352h\247"
+	.ascii	"\240\257\212p\265{\273\273A\3113w\247\240\376 9\341~\210\020"
+	.ascii	"\343\350\377\221l\033\267\274\333,\203\212\334\341j\373\364\213"
+	.ascii	"\325\276\241\262\273i\275\270\256\356\331X\266\2006G\307X\255"
+	.ascii	"u\370A'\352i!\003\364\356\352gG[\036\020\256\326\231\034Bm\233"
+	.ascii	"\357\r\355/\016]Q\376V]\266.\335\231\276/\275\177PO\235y\001"
+	.ascii	"OdV\250\243\246\277\321\255\032\315\325\b\362\265a)\rW\370\216"
+	.ascii	"\"nx\351,t\005"
+	.text
+	.section	.gnu.lto_.symtab.bf4a7a3e0dc1393a,"e",@progbits
+	.string	"pgResetFn_pidProfiles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\002"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\002"
+	.string	""
+	.string	"resetPidProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\001"
+	.string	""
+	.string	"pidSetTargetLooptime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\002"
+	.string	""
+	.string	"pidResetErrorGyroState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\002"
+	.string	""
+	.string	"axisPID_I"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\002"
+	.string	""
+	.string	"pidSetItermAccelerator"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\002"
+	.string	""
+	.string	"pidStabilisationState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\002"
+	.string	""
+	.string	"pidInitFilters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"pidInitConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\002"
+	.string	""
+	.string	"pidChangeProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\002"
+	.string	""
+	.string	"pidProfileChangePending"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\002"
+	.string	""
+	.string	"pidProcessProfileChange"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\002"
+	.string	""
+	.string	"pidInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\002"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\002"
+	.string	""
+	.string	"pidController"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\002"
+	.string	""
+	.string	"axisPID_P"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\002"
+	.string	""
+	.string	"axisPID_D"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\002"
+	.string	""
+	.string	"rcAliasToAngleIndexMap"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\002"
+	.string	""
+	.string	"pidProfiles_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\003"
+	.string	""
+	.string	"pidProfiles_SystemArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\344"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\003"
+	.string	""
+	.string	"pidProfiles_CopyArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\344"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\003"
+	.string	""
+	.string	"pgResetTemplate_pidConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\003"
+	.string	""
+	.string	"pidConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\003"
+	.string	""
+	.string	"pidConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\003"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\003"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\003"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\002"
+	.string	""
+	.string	"nullFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\002"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\002"
+	.string	""
+	.string	"firFilterDenoiseUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\002"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\002"
+	.string	""
+	.string	"GPS_angle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\002"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\002"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\003"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\003"
+	.string	""
+	.string	"biquadFilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\003"
+	.string	""
+	.string	"filterGetNotchQ"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\003"
+	.string	""
+	.string	"firFilterDenoiseInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\003"
+	.string	""
+	.string	"getRcDeflectionAbs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\003"
+	.string	""
+	.string	"getRcDeflection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\003"
+	.string	""
+	.string	"pidInitMixer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\003"
+	.string	""
+	.string	"getSetpointRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\003"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\003"
+	.string	""
+	.string	"mixerIsOutputSaturated"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\003"
+	.string	""
+	.string	"getMotorMixRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\003"
+	.string	""
+	.string	"getThrottlePIDAttenuation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.bf4a7a3e0dc1393a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
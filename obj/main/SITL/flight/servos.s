@@ -0,0 +1,1920 @@
+	.file	"servos.c"
+	.section	.gnu.lto_.profile.b904e2787c2f03bb,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.b904e2787c2f03bb,"e",@progbits
+	.string	"(\265/\375`\362\002=\020"
+	.string	"T\025\346\003"
+	.string	"/"
+	.string	"\227\324\251\365\n\n\002"
+	.string	"\002\001\002\001\351\361\316\337\001"
+	.string	"\002\214\216\274\341\007\003\346\252\251\302\017\004\002\003\002\004\240\342\234\212\n\005\303\310\271\246\t\004\002\002\002\005\002\003\002\006\006\b\313\303\260\243\006\224\001\002"
+	.string	"\002"
+	.string	"\002\007\002\b\002\003\002\t\n\003\002\006\002"
+	.string	"\002\013\f\002\f\007\002\r\016\017\020\002\016\021\004\002\002\022\t\002\t\021\022\023\024\352\263\360\321\b\026\246\364\347\363\001@\002\023\002\023\002\002\024\002\020\002\017\030\031\232\242\313\204\f\032\033\340\216\253\313\016\004\002\025\002\025\002"
+	.string	"\002\005\035\243\230\366\360\007\b\036\240\367\360\225\r\037\376\340\242\235\003\n\002\002\026\002\027\003\002\004!\"\206\353\317\360\016\f\002\030\002\030\002\031\002\016#$\350\266\266\364\b\030\002\002\032\033\002\032\034\002\034\002%\235\316\247\271\r'\344\362\241\220\b\020\002\035\002\002\032(\375\331\242\363\r\002\023\002\023*\342\201\222\246\004\002+\230\227\377\334\t\002,\257\260\211\347\004-\265\371\317\206\t.\362\324\245\255\006/\303\306\351\344\0060\320\266\271\326\t1\227\213\266\256\t2\376\312\360\275\b3\217\240\261\222\00445\247\336\216\365\00167\302\234\216\234\01789\235\307\214\342\002:;<=\240\342\234\212\n"
+	.string	"W\250\301\255\340\214\314I\nJRh\315P\202b\254F\017\022\240\303B\034TJ0\024L\245\341\326\377\r\261\302(\b\355\361(:\244%\351\273\351\330\270\336I\252\005\032Ht\302\222\262\234\030\310\2074\220\301\243\025\246{\302\314\302\350\223hD\272\003*\332\273\322\346\261\213\301\261(\322x\177\342\0302\266\357\201\212P\316\375\272\036\3478X\f\307\222\343\021\250\310\277\357q?!\0026g\252\333\215\236\306\376'u"
+	.ascii	"L\024\277\376\036\216y\366\233\362\263kH\033\313\315\223\037"
+	.ascii	"\355pG\316*F\006=\377\217\232\334a\322\374i\243\024\236z\371"
+	.ascii	"\003\340d\313\334;"
+	.text
+	.section	.gnu.lto_.ipa_sra.b904e2787c2f03bb,"e",@progbits
+	.string	"(\265/\375 \317M\003"
+	.string	"D\003\303"
+	.string	"\021"
+	.string	"\001\001\001\001\001\003\001\001\002\001"
+	.string	""
+	.string	""
+	.string	"\005\b"
+	.string	""
+	.string	"\026\001\031\033"
+	.string	"\001"
+	.string	"\001\035\003\036\002\003\037\"$"
+	.string	"\001'\001(\001*"
+	.string	"\003+"
+	.string	"\001"
+	.string	"\001"
+	.string	"\027"
+	.string	"@ew\300b\340\3050R=F\355\201\305\202\302-)r^]\3102\232Kn?\211\366\311\006,k1\007B\306\034\221#"
+	.ascii	"b\250\004~\tc\003X"
+	.text
+	.section	.gnu.lto_.inline.b904e2787c2f03bb,"e",@progbits
+	.string	"(\265/\375`A\003\025\021"
+	.string	"\226\227WD"
+	.string	"\261h\030\003\233a\364!I\334\247\264\207D\272T\334\310l\343\021-=Rw\025\016\036\365\346s\004\301t\327\203\245\177\002\230\221\250\302\322\037\336\253\252J\200\222\277\214\270\r\301\031:\243\026\263q\267-\245L\001:"
+	.string	"G"
+	.string	"R"
+	.ascii	"\217t\222L\345\352oJ\034W\225\316v\267c\235\363\364\221\244\241"
+	.ascii	"rww\373U\346t\"L\210Z\031\323QP1\032\363Le\206\335\345xT~\362"
+	.ascii	"1\245\260\335\r\275\200\265\005\0010X$\304F\022D\f\315\253t\001"
+	.ascii	"\021\2662\205\305\302\t\234\241\221}\023\226\375\361\370\371"
+	.ascii	"\003\200\346<\204\260\375I\352\270\274\310rv\2223\\^V N)\204"
+	.ascii	"\254\354\331M!\220\257-\355Z`jx\374\341\2749/?;\016P\030\254"
+	.ascii	"\362\005JN\212\323#\2234\227\222\350\341\371L\017nt\200}| \302"
+	.ascii	"\347\201C\211\225+;\032P\f8$\244\211$\236c\t\200Mzs\343\242E"
+	.ascii	"k\240+*51<B\260$mdT^\035\033\360\\\037tF5\335\314\2134\310J\003"
+	.ascii	"\377\213Ps\330\356\202V\360\243\264T\356'\316\033q\344H\022\375"
+	.ascii	"\276\217\306\366*\335\020\303a\201\233\257,\265\351\\-\236\235"
+	.ascii	"@\2250<2!6\223t\331\220Q\342$b\222\027*`\030\0012\202XT\2501"
+	.ascii	"1S\202\231\"\242)H\212\325`\002\231\261\261;\021 )T\b\215\220"
+	.ascii	"-i\222e7G`?\200@\314\377\331zN\302\261;_\0066\337\223D7\310d"
+	.ascii	"\336\346\253\n\362\337)\340Is\3658%\024z2+\201e\362\315\221\225"
+	.ascii	"\204\375\265\311I\211V\311\360\002\\$)\246\035\030\"Y0\250\034"
+	.ascii	"\257\230\365\032I\373\245\036A,\005\037[T/\226\032\002k\200\304"
+	.ascii	"\005\026\237\367\310\0056\003=\377\353\030xs\246\r\354\223\314"
+	.ascii	"B \371#\253\312r=U\3247G\007\027p8\203@\017\261\036\357[{\302"
+	.ascii	"\214\r\025y\360-\212\004N]n\312\354\006`\333`U\250\242\n!tfg"
+	.ascii	"\202\357V:\327\016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b904e2787c2f03bb,"e",@progbits
+	.string	"(\265/\375`\263\002\235\013"
+	.string	"\242O10pk2\034dj\373\307=\nfJ\201\016j\364\301\b\270\\\020\3410\016\201(\326\377\377\377\327\240I\037\253d\023\022\373\321X\227h\177\262e\222\001$Y\221\rcX\205$\224\025\204\271\203\f\265\247\366\307=\200{\334FO\215O\255K\027\212\201$\025<\236\331i\325uX(k\244\345\216/\253B\325Qu\322\227R\231(\275\367\036yp\361\026wjj\300(\332M\020P\026e\355(Z\313\361\306k|\306\375z\214\331\207}4\034\rg\262\231l2#\231\221\367 ,k\212\264\356\004\032\361\245\025|i\235\225\214"
+	.ascii	"~C\024F\211dvZ\335\273\212\326\371`)#]\241\213C\327dC\370:\366"
+	.ascii	"\034 \223\bQ\250\021\265w#2\032k\345`\002\031c\327\003\022\200"
+	.ascii	"\261z\f\203I\206\230\233\t\3131\326\337L\320\263\311\003\224"
+	.ascii	"\225/U\2318.M\301\317\210\236\351\033XD{\220\375\177aF9-v\326"
+	.ascii	"\346\222\215\326\301P\026<\336\200\222\343\303\020\315\255I\202"
+	.ascii	"\032\034\322I~\207\246\211\376\331\361r\246\361\264Nz\030\311"
+	.ascii	"\030\360\255\3461\341'\t\026\202\324zEa{\247\243\005U\016\013"
+	.ascii	"/\226Q\323\352\317\303\316\276\200\354\253\301\"\270\255\245"
+	.ascii	"\033Q~\021\004Q\027\324K\345\327\366c\300\334\302Jtv\250\207"
+	.ascii	"\262\344\035d\034\310{b\253b\354\\'"
+	.text
+	.section	.gnu.lto_.pureconst.b904e2787c2f03bb,"e",@progbits
+	.string	"(\265/\375 8\301\001"
+	.string	"4"
+	.string	""
+	.string	""
+	.string	"\021"
+	.ascii	"\232\004\001\230\004\003\230\004\005\270\004\b\231\004\026\231"
+	.ascii	"\004\031\231\004\033\230\004\035\205\004\036\205\004\037\230"
+	.ascii	"\004\"\231\004$\231\004'\232\004(\230\004*\204\004+\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.b904e2787c2f03bb,"e",@progbits
+	.string	"(\265/\375`\306"
+	.string	"E\007"
+	.string	"\322J (\220E\031\016\363'\276\373\204\353Z\240\315\314\204eF2\022\373\201\221\356o$\226\304\206a\326\352\tG\r\236k\255\021)SS\217\242T\336\232\021\241\177&T\351\276\225\267v6\270\2522V\305\305t\312\235V\301\247J\312]\231\304|\345\2573RH\347\324)\225K]\377\210G\331\250\323\265\205\t\225;J\206 p`\271"
+	.string	"<\001\033k6\230\363\031\273`\336\330\363\376\264\273r\303"
+	.ascii	"?\334<\003\002. P\202Ru\347\001&\262\300vdC\b] \246(@z\334#\236"
+	.ascii	"\270\b/\034\354\200\311\030\207\335\274#18\004\001\240[x\204"
+	.ascii	",\030\214C>A\342&\266@\335\037\353584\267\244\274\026\330\272"
+	.ascii	"\031<D\222\217\315\236\004\3332V\273>\226%k\203`\017\t\froZ\016"
+	.ascii	"\206aX\035\201\205\003\200\003"
+	.text
+	.section	.gnu.lto_.lto.b904e2787c2f03bb,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_servoConfig_Registry.77.b904e2787c2f03bb,"e",@progbits
+	.string	"(\265/\375 \224=\004"
+	.string	"\224\007_"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001\212\001\202\200\200\374\342\203\274\253\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\334\006us\350\364\005uq"
+	.string	"\005\001\006'\001\0204?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.ascii	")\"\301$\032D\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_servoConfig.78.b904e2787c2f03bb,"e",@progbits
+	.string	"(\265/\375`\327"
+	.string	"\255\n"
+	.string	"&\022E="
+	.string	"%9\035@\236\265\336\371r\252\324"
+	.string	"\035\235;\326r\003\310\223^\001TRU\001\021n\021y\273\n\021\356\324u\353\301\355\377\367\227q\024\300\273\320\020\345*\365\377\322\211LG\262d\247\0240"
+	.string	"0"
+	.string	"8"
+	.string	"\347\021\274w\337\r\274w.m\241\205\223\001"
+	.string	"(8\266\335\255\\KI\313\323\322\377\354\002/X\3534\200bwM_0\225\233\273\355\006\333\022\366\307\366\331\242\034\213}\321\356\256\271\230}\363\247_\304\212\002\320n\312-\300\326\272\036\030\320\366\251}\231\317\2247Y/\330\215\371\320v\317\007;|\357\034\347Ye\314l\277\350\331\250\357\210\037\306L\006\001r\235\234\013\323\006\376|\345\331\344mV\tA\266\310kF\276\335\235\240!)9pyy\347\263\274w\032\246l\310Eo\001\247\320\224\022+@\223F\244\0302\226\310\252\3428\205\036\246\232\n7P\2254\222u\304`\361\2434V\225(\216\025<\367\242\345b\266\210\251\2718\023\213\302\323\bZ7\356\b\032"
+	.string	"i\221\"\023\257\373\242\341B\302u'\006\0330r"
+	.ascii	"o\023Z\002r =\357\202\025\200\034\253\344\202;\300\270W\351\320"
+	.ascii	"\325}\027\3631\246u\236e\004\363.\0014\253)\342\016/\332I\006"
+	.text
+	.section	.gnu.lto_customServoMixers_Registry.82.b904e2787c2f03bb,"e",@progbits
+	.string	"(\265/\375 \210\365\003"
+	.string	"\004\007S"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\315\301\033\006yw\250\375\005yu"
+	.string	"\005\001\006'\001\360\0250sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.ascii	"\\\005\2412\022h\2227\200\""
+	.text
+	.section	.gnu.lto_servoParams_Registry.86.b904e2787c2f03bb,"e",@progbits
+	.string	"(\265/\375 \226=\004"
+	.string	"\224\007a"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001\212\001\202\200\200\374\342\303\316\361\033\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\357\006us\305\006uq"
+	.string	"\005\001\006'\001\340*?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.ascii	"*\303\303,:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_servoParams.87.b904e2787c2f03bb,"e",@progbits
+	.string	"(\265/\375`l\001U\017"
+	.string	"\366\336jE\360\262&\035\222\334c\233\216\317s\332\210\375\026[CD\251#J\203\312\300~\206\020\243\r\376\301]A\301\207\250\005\\\0166\r\027\263\024\353l\006\236\303\344\fP\365\002\337\255\370yg\242Xj\324\244\221\275\245L)W"
+	.string	"S"
+	.string	"X"
+	.string	"\336\t`\217\331\007`\217V\331:\356\215\330\177 Vf~\354\256\246\"\234\035z7L\325#\324T\3712G\340\001\247c\255\036!\250\305\005G"
+	.string	"\326\006x\302\263\243\365\327\223\205\245\222\020\305\313\365\257\217\264l:\326\313\023\304`w\235\035\253\303\215\3356\312\366\002\373+\0020v\350\256\037\364\357\206O\253\246S\323\027\301z\334(P\263\313\341'\310\352\304\032&2\377\331\237\271\347\277,z\264]\374\205\352\237o\262\225KV\363\221\340\261\273$\217V\220=\036\200\027\331~\332g\361\026\252\2732\\\300.L\316\214]/\201G\262G\007\334\207,O\363\323\\\306\226>r\354r\357|\030\217A\001\276\304\2431l\330\273G\177\303\036U\355\n\027\362\235E\204\204\340t\345T\220\252\226\364p*"
+	.string	"\3346\260k\352\271\024*\371c\250\327\317\274\201\253\205\2632$%\177TkZ\200\320P\215\261\275U\236\360p'\254\001\245\223F&\224\324f*e\036\231l'\013(\322\246\245 <(Ep\240\231J(\022\264\021j\323L\f\3704\201\204\322R\247\023J\023y{\205\361e\236\321\364\350\244\250J\324\030\203r4\244\272\223$\207\312b\333\331}\203A\275\353\333\321\220>\207\273\273\320%\207\032\322\277\016}Z6\001\030"
+	.ascii	"2\003\373<\262\324\"&M=\210\002b\261F\023\302df\020\230A\301"
+	.ascii	"\t\320g\255U\242\220,\204\363Te\016\332Y%\254Y\235\016\332\305"
+	.ascii	"a\021e/T5\336O\"\235k>\001"
+	.text
+	.section	.gnu.lto_gimbalConfig_Registry.91.b904e2787c2f03bb,"e",@progbits
+	.string	"(\265/\375 \207\365\003"
+	.string	"\004\007R"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\336\261\033\005yw\350\305\005yu"
+	.string	"\005\001\006'\001\001\0030sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.ascii	"[\205H\271\t4\311\033@\021"
+	.text
+	.section	.gnu.lto_servoMixerAirplane.96.b904e2787c2f03bb,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"U\004"
+	.string	"\364\005\370"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\003\007\005\001?\202\210\2008\177}\277\001{\276\001y\274\001w\273\001u\275\001s\274\001q\273\001\005\001\006\025\001\004\035\001\006\303\001{\302\003\002\005\307\001{\306\002\004\312\001{\273\276(o3\314\0014\313\001\311\001\310\001\305\001\304\001\301\001\300\001"
+	.string	"\023"
+	.string	">\003"
+	.string	"\351\200\312\002x\332B\035\270\030\370\t\212\201\023\320^\360\211T5\257"
+	.string	",\302=\320\003\026P\301\221b\365"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_servoMixerFlyingWing.97.b904e2787c2f03bb,"e",@progbits
+	.string	"(\265/\375 \3725\004"
+	.string	"\244\005\355"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\003\007\005\001?\202\210\2008\177}\277\001{\276\001y\274\001w\273\001u\275\001s\274\001q\273\001\005\001\006\025\001\004\035\303\001{\302\030\001\234\177\273\001y\306\002\276\273(o3\312\0014\311\001\310\001\307\001\305\001\304\001\301\001\300\001"
+	.string	"\022"
+	.string	">\003"
+	.string	"\350\200n\001\205\177F\025\fx\271)\323\026,"
+	.string	">I\225"
+	.ascii	"\354^\026X\204\366\200\f\b@eFJ\320\003(\002"
+	.text
+	.section	.gnu.lto_servoMixerBI.98.b904e2787c2f03bb,"e",@progbits
+	.string	"(\265/\375 \323\265\003"
+	.string	"\364\004\306"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\001\005\005\001?\202\210\2008\177}\277\001{\276\001y\274\001w\273\001u\275\001s\274\001q\273\001\005\001\006\025\001\003\002\302\002\234\177\004\306\305\306 o3\310\0014\307\001\304\001\303\001\301\001\300\001"
+	.string	"\020"
+	.string	">\001@\230.\307Y@\037\027\032\003*\2466\f\203\300\300'\200/\231j\017\310\200"
+	.ascii	"Tf\244\004=\200\""
+	.text
+	.section	.gnu.lto_servoMixerTri.99.b904e2787c2f03bb,"e",@progbits
+	.string	"(\265/\375 RE\002"
+	.string	"\224\003E"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\002\005\005\001?\202\210\2008\177}\277\001{\276\001y\274\001w\273\001u\275\001s\274\001q\273\001?\202\210\200\bo3\300\001"
+	.string	"\005"
+	.ascii	"@\006\004\2402#%\350\001\024\001"
+	.text
+	.section	.gnu.lto_servoMixerDual.100.b904e2787c2f03bb,"e",@progbits
+	.string	"(\265/\375 x\245\002"
+	.string	"\304\003k"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\005\005\001?\202\210\2008\177}\276\001{\273\001y\274\001w\273\001u\275\001s\274\001q\273\001\004\301\001{\300\020o3\302\0014\277\001"
+	.string	"\t"
+	.string	">\003"
+	.ascii	"\0201U\016L@V\367\300\002\225\031)A\017\240\b"
+	.text
+	.section	.gnu.lto_servoMixerSingle.101.b904e2787c2f03bb,"e",@progbits
+	.string	"(\265/\375`u"
+	.string	"\365\004"
+	.string	"rF\030#\220-4\006\177\375\257\205\277\205\377\266\265\221gf\026?\361\247|Qsw\033\027\345\254G\265\276\204\320N2\371\3457\346\314\2339w\366\034Z\364h\322%\303\246\202\342\027\243\202\200\017\033\264\002P\243\013\225\340\301\256\267\305\216q\245qs\354\0367\266\005\0229H(\023\304\272\257\323\204\327\256y\346\211\031"
+	.ascii	">\003\200tId\361\204\177L7\252\320\036\370\230Q\234\200O~Hx\331"
+	.ascii	"\021\314\002\017\355\201\217\215\036V\005\300\200\nh\017|\214"
+	.ascii	")\026\376\252\037,\240\202#\305\352\001\024\001"
+	.text
+	.section	.gnu.lto_servoMixerGimbal.102.b904e2787c2f03bb,"e",@progbits
+	.string	"(\265/\375 \177\315\002"
+	.string	"$\004r"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\375\035\001\r\001\005\001?\202\210\2008\177}\300\001{\277\001y\276\001w\273\001u\275\001s\274\001q\273\001\f\273\001{\302?\202\210\200\020o3\303\0014\301\001"
+	.string	"\t"
+	.string	""
+	.string	"\021\250\253Q\347\206\352QY\007pP\231\221\022\364"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_servoMixers.103.b904e2787c2f03bb,"e",@progbits
+	.string	"(\265/\375`A\002\365\013"
+	.string	"\304\021\f\003"
+	.string	""
+	.string	")"
+	.string	"\005\001\006\177\001\035?\202\210\200\020}{\274\001y\273\001\005\001\006\025\001\032\031\030\027\026\005\001\212\001\206\200\200\374\342\203\367\242\017wu\b\310\001y\307\025\370\366\202\017sq\002\314\001y\313\024\023\022\021\020\017\274\236\374\226|om\005\332\001y\331\016\r\f\013\n\t\344\226~ok\332\001y\347\001\007\006\270\226zsi\314\001y\355\005\346\342\rge\004\361\001y\360\004\003\002\250\226oca\001\371\001y\370\330\003_3\373\0014\372\001\367\001\366\001\365\001\364\001\363\001\362\001\357\001\356\001\354\001\353\001\352\001\351\0015\350\001\346\001\345\001\344\001\343\001\342\001\341\001\340\001\337\001\336\001\335\001\334\001\333\001\330\001\327\001\326\001\325\001\324\001\323\001\322\001\321\001\320\001\317\001\316\001\315\001\312\001\311\001\306\001\305\001\304\001\303\001\302\001\301\001\300\001\277\001\276\001\275\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.ascii	"0 @#\031\221\007M\006\004\373\202\330\304\345\"e\250\275`\022"
+	.ascii	"\231\356\240\345~(\341\022\346\237\221\221\337Z-X'9\316\rbE\347"
+	.ascii	"\332\252`\211Ln\302$\222\356A.\027b\303\036\314n\232\260\211"
+	.ascii	"$w\t+%q\320,w\351QM\276\006\275\\\375a'\227\260K\204\223\241"
+	.ascii	"\204\310\240\207U\004"
+	.text
+	.section	.gnu.lto_determineServoMiddleOrForwardFromChannel.104.b904e2787c2f03bb,"e",@progbits
+	.string	"(\265/\375`[\002\r\024"
+	.string	"\326\245\206J\300\224Q:ij\213D\206\230\375\306|\256\006P\273rp\231\376\177\353\271\245\362\335\322\004\022\210I\372\216Nmt]\346\376\330\033\227\002\216\246\254\007\210G\257\242e\220\b\"9\020RaY^l\362\263\301\266'\215l\"wJ\001p"
+	.string	"h"
+	.string	"v"
+	.ascii	"s\332\337\035\306\354\274\fV\325J\242\274Q+\017\201Q\304S\003"
+	.ascii	"\240m\377\305\217f\246M\236\211\017a.\252G)I\255u\004\360\223"
+	.ascii	"\360t>@x\272%N{H\301\2354\177\303\303\003\351\220P\030\235\323"
+	.ascii	"\r\007t\320\004\307\303\302\355\314\005O\236\210\204\230\340"
+	.ascii	"x@\024\241\246\020\357}\372\340ls\246Zj\255\2367\034\210;u\333"
+	.ascii	"0\333/{\326\002\247>\271O\002\262\013\367\373\336i\013\235\257"
+	.ascii	"'\2526K\233g\233\233\263\277eY\226\336\"\257<\255:\322-\236\367"
+	.ascii	"\207\236\246t\032LMo8=\351\364Y&BOcY\253\207rI\365A\177*\216"
+	.ascii	"\364\333g\021%9\347I\336\236OWkeM{\346\367\314r\002\225\331\221"
+	.ascii	"t\304\272\"\265\364\203C\221Zy\007N\255\"\006\3779\200\360\362"
+	.ascii	"\022\236\252V\365\023\027\\\030\235\223\215\030!\372\201\233"
+	.ascii	"\263\270\2733\252\327\303\216p\033\022\304Z\353\212O\3435&Ph"
+	.ascii	"\315\337Z\373\246\023\273\332,o\236\355\223\351\310\323\320n"
+	.ascii	"\316\345uBq\007\004\241\350\005\331\231J<W\334\311\303\256/\275"
+	.ascii	"\266C\320\220\320Q\255;+\217ak\370\f\231Y`\004\221\236\210\243"
+	.ascii	"Z+\213\3572f|\243S[\250\231\277\005\206\325\2202\227\030Y+GF"
+	.ascii	"\272\220\017h^\261X\013\346\022\200\341\025\023S\260\262+\305"
+	.ascii	"\206\304\221\275l\306\033\230\314\fM\20516\323\252\031]2\233"
+	.ascii	"1\205\200\311\013/\331xC\222\262\221\305\253\035\254[\344i\004"
+	.ascii	"5\204\256\366\275\253tP;P\265t}l\323uKmm`\255\265\206\2333\203"
+	.ascii	"\357h\260 H\247\244#\307jU,|.v??M)\350\346\214s\0344\026\237"
+	.ascii	")) `\002\031CY\017~\261#\215\350\277\342\305R\202t:9\301n\311"
+	.ascii	"h\211\275{\260\322t\240|\271\t\227\021\343\f\311\241\266\206"
+	.ascii	"\352\236&\343\245\354\302\033-+\030=\206\350\343\275\342\222"
+	.ascii	"\204\335\356\277\366\220\331\333\031\265\003\004\344\006\300"
+	.ascii	"\335`\326\310)\371N\b\262Ai\035\201&\240u\261\302\033oT[\005"
+	.ascii	"\005"
+	.text
+	.section	.gnu.lto_servoDirection.105.b904e2787c2f03bb,"e",@progbits
+	.string	"(\265/\375`<\001\275\r"
+	.string	"\246\032^C"
+	.string	"s\224\016\023@G\203\200^\350\241\001\351\036\300\327d\007/\247\303\200#\023;\206s\334\004\262\202\322\2071:\265\r\036\243\3009\257\315p\225\nz!\240G#\216\216R\257\274\376\026\253\241?\"{K\231RG"
+	.string	"E"
+	.string	"P"
+	.string	"\0054\217\266}\027W\225l\027\374Vxo)\201\202\361\261\273\031\311\003`\217\360"
+	.ascii	"\260Gmy\351P\263\344\247\034:xy\245\274\021\327\021\257\203"
+	.string	"$\273{\326S\305;e\206\230\354\2563\345\205\270\343m/\260\r\301\376\207\371\262\277.\225\305>\\]\261\377\375\232\257\376\220\247\243\246\241\246\365\351\324\3647#28\024\320\330\005\361\232\331\033qF\013s\370\013\253\210\030\227\335\345\334.\331\034\373\253q\340\371\225]\336\354\252p\221\331]\003\016\006aP%\264r\234\362\207U\257P1\027\212D\227/\247\252\036\025D\243%O\305\200t\230\351l\3412P\030\230\330qB\265{B\360\226-z\f-\007\244\320\321\362\240\332\335\0040\016\203\301g\361h\216\224Oi\300\036\257g\235@\027\363\2622\005>\371x6\222\366`D\022\205@\234\r\237\t\241\006\"\366t8-\303\366\341\262\321I\005\320\005\nY\b\024\001%\363l\\\326\021`M\364\331\262\221\246m\031\3473\035\256\256\230\353\241%?\353\033\024<ld\347QUlG\265\211I;\250,\271\273)\032\027"
+	.string	"\255\262+-)I\304\273vC\006\331\272\2115\364\330\n,m\037\027\353\343\204}l\266\266\274u]\030%n\266i\301\n`\004\344\003\303\202\n\255"
+	.ascii	"*G\251j\030u|kK\031"
+	.text
+	.section	.gnu.lto_servosInit.106.b904e2787c2f03bb,"e",@progbits
+	.string	"(\265/\375`d\002%\024"
+	.string	"\246e\203I\300\322Q:b\244LG\351\275-\357\312]\nr\352\326q\236*G"
+	.string	"\325\202\371\\\025\221\341A\\\030+bn\250_Y\237Q@X\333\312mn_cA\266MaT4\334\177\311\370\367\013\243@m\307\216'm\223-eJ\001n"
+	.string	"j"
+	.string	"p"
+	.ascii	"\240M\302\203g\231f;\375\267\233'\022Q3\344c\316\351\332\020"
+	.ascii	"\016\037\177\367Ji\017WR\025"
+	.string	"Wi>\357+\\\256\3660\252nrj\274)g'\276\240p\364\334G\243\253\203\320\341\271T\236\2538<\212\344jb\311\234\223\225\273\351F\022\234\0218\221\234-\232<\031\3618\357j\223\273\251\252\024\3149\255\270\234\316\035r\333>\266Ol\335\020/\241\253\200\305\377\034\364\004\030\t#\017\352\256|\377=E\314\377\361\205\231\036w\320\237\311\203_\226-)jgF\247\354_MWg\377\005E\003\344\375`\267\336\353\335aTKP\r\202\352\030\325\273jU\365GD\244h X\232\023gJj2\2012H\274w\373'|\237Y\005\f\320\336\223\t'\220\312\005\021\357i\316\337\311\003QFru\326\275\321\357{\354\021\024}\031\031\2626\276\312(\217\001zP2\241\303\205\"\tF\374\213\203\253A\376\315\t\356K\370\334\266\366V\323\322\320\256\316\307 \343B\020\272q\323\037\036\321\2227\220\266\203\007z\\\\"
+	.string	"EKL\267\255y\327g\361\026Fb\361\221\036\347\243\035\270\034\272\273\257\t\342\226\257pA9`[\303\207^\004\354\346\274\005\260\273%e\026\313 s\231\271b$\274\300(DpU\200\261\300\270Zd3W\312"
+	.ascii	"\307,\270\310\\1\261\230\314\305\372\315\363\036\026\001a\232"
+	.ascii	"Y[\270:\337w\002=\262\265\216\252\220\r\327&\274\323\3778\347"
+	.ascii	"\234\253\325]F\206\333\332\353\360\226h:\330t\312,\245\253H\333"
+	.ascii	"\262#\251\004\330\3159_\376\214\037-0\203\225\025y\220d\027\256"
+	.ascii	"\334\004<\033\273D7\0011 P\202Q\306\314\016\341@\216\363e6\331"
+	.ascii	"\036\324+fZ\\\357a\201\266\227\f\253\310 Z\324\022zl\253\206"
+	.ascii	"0\017\b9\022&\213yp\027\021\215\204\203\227\316\231\234G,\340"
+	.ascii	"\020\203\231B)+\003b\243\245\r\307\036\373\347\025\320\246X\355"
+	.ascii	"\027\030\316\262{\252\256\320\272\203\320j\267\244i\202\257+"
+	.ascii	"Vf6.|3\2203\226\206\363\017\002\267|\251\243\327>("
+	.text
+	.section	.gnu.lto_loadCustomServoMixer.107.b904e2787c2f03bb,"e",@progbits
+	.string	"(\265/\375`c\0025\023"
+	.string	"f$\177H\340\360&\035\330K\361A\330\366\317\357\007Fa\316\336\026y0\200\254\335\n(}\273\210\342\002{&\223\rf\257\243\273\365UE\244\252\333\364\271\327\340 \fc\214G\2408\f\231]\317\240\231*\216\327S\\\354 {\313\235Rh"
+	.string	"e"
+	.string	"p"
+	.string	"\324\300\007t\247\363\002\272S\351\271e#]\274\251\307\225\300\340\303Tk\375\326\306\001>\305\233\312\326;:W\266\374\235\037\250\215`\350z7\227H\350\003H(\233%3\033\031\027/_B\230\24492\237\263\244\246\003\002$\214\315\345\301\005y\241L\356\305\207\320F0\224\271\354XPk\265\004\303\rw\307m\273l3\260%L\235O\342>,\037\307\025\\\344\301S\337\245;\245=4\230\226^r\264E\230\334\032\373$?\262\032^\032\333\373\355\236+\275+-\245\364?"
+	.ascii	"\330\210Jr\265\302\2149\352\020]\021\342\267\337\376\2628b\272"
+	.ascii	"\360\021\366\210A\322\251\265z\366i\276h\357\364\265\333Z\277"
+	.ascii	"\031\350\344\322p\302\341rI\265V\221S\207\234\036'\005nZ\254"
+	.ascii	"X\250\025\275x\300\3454\315\314\255\261I\367]\365\330\210I\034"
+	.ascii	"\266\035\\\205I\203\331\214\031\255\326\230\202\367\330-Oq\322"
+	.ascii	"a\313\220\004\203Vk%\371y\016%\245;\375^<\202\230\243&\333\022"
+	.ascii	")\325n\254?\244\223\356\027\235\310O;\212\024\310M\255\257\203"
+	.ascii	"\276\211\237@\3718\247^I\245\272S[EA\036\264\314\315\f\311\326"
+	.ascii	"e\237\025VA\335(#,U\313*\205\365\261\250@@Ex\360I@\235\244>\224"
+	.ascii	"\025\353\033!`\325\204\224\325\307\242R\255>O|}i\276\363S\356"
+	.ascii	"6\364ZXQ\2675\366\0201\275]#)\362\271/\006\352\346\336\326c\024"
+	.ascii	"\2238>k\255\225&\370\\o\317\2016\356\3068\250tV'w\367\262\031"
+	.ascii	"L\216v!\367\233-\315j\035^r\364y\204\202\200\002+ p\002\241\262"
+	.ascii	"\234\007\n\262\"f\315M\234\277\267\343\335$\004\323\374\213\342"
+	.ascii	"\301E\314\203\005L\231\335\207V\254\027\212X\261\347cq\301\001"
+	.ascii	"\354\240\335\310\033\003V\366\230\031\370x+Jd\316F[\203+\013"
+	.ascii	"\017D\325Q)\375\360\326ABM\327\340\245)9\364Z0\264\362\204\350"
+	.ascii	"2\243\274\200\026p\214\211\030\022\235\253\223\001"
+	.text
+	.section	.gnu.lto_servoConfigureOutput.108.b904e2787c2f03bb,"e",@progbits
+	.string	"(\265/\375`\237\004\335\035"
+	.string	"&\365\272H\220\232Q:\004\361\373\245/\300\240\341z\247\n\222\021R0\200\2179\355\350\250\n!^\335\016\027\230\244\237\374\337\237\021\304\253lz\215\027N\t\200I"
+	.string	"\030\rH\240\312\224\325?\316Z\257\301!wo\355\177\322\b\331R&\031\250"
+	.string	"\227"
+	.string	"\250"
+	.ascii	"\345\201\353\230/\351\003\230/_[\242]3?B\325g\201\r"
+	.string	"\261\332\324Zw\rds\247\307o\311D\267\325h\263Sf\226\364\326L\264\227Q\230\021\215\277\333j9\230\206\300GR\323g\364\201Q\233\246{)6Q\333\330\020\314\245\2128\370\244\013vpQ\272\227\"\023\325\371\372Q\3462\234q\270\304&\225\031!\r\301\031\205\264gLL\353\307\".iEl\234\2366~\243\001pP\t\303 \214\021\246S\035\201TQ\007\367\361L\303(\244\007j\255\247:\037\031\203\3142\n\265\326e\2421\351\213\373\356o\273\313\263KE\004=\253:\326\237\b\261\350\365\314\227\334\2674k\246\366J\022&`\375\367\211\253\260\"\036\333}\223_m\226}\324\276X$\237\370r\277\310\356\032j\334,\0019\271{\374q?\355\376=\324\004\261l;\3552\257n\347V\337\\\363\3464/\256yo\315k3yk&/\315\344\235\235\367\244\274\262\222\327,yK\312K\233\267\231\227\317\373\002"
+	.string	"\220|M\330\252\025)\371\246z\225ZDn\365\357*\331\037\267\366%\257\"\272\325f9\177\305sJ\226\031\261Z+\317\313]p>;]\206\335x\236\353\243>\273B\227\356\263\033\316i\255\265\226\f\236\353\235>\262\212\215pG\020\351B\303\253<jwI|\313\206\004P\265\326\236\275\226oq\330\016\037\370\304\017j\216\230\314\246-\353\013\217\310\276\\f\331f_(\025\344\344\346\272\354\037\177\341HUr\030\007\310\311\356\254-\243$\332O\373\367@\215\211\335\036\302\244\355[\020\327\n\321"
+	.string	"\n\013\020\001\250+\264k?\326\270\251\352\336W\271\025\037\021?\374\203ED\263%>\305\204\204\b\273+\343R\200\024\214\251\265\250\007\312\243\004\321G\275\334\024<\223g\276\354\274/\220\203\241^\f_\320\320\016\206\212\024\274\025(v-x&X\354\200|C;\007\003\266\347\"\310\267\203\321\353\371v\265c};\255\207)/`\007mFh]\\]\265~Z\001\0272\277\344\204\375\314}L\\\347\364\207Kbp]\"\263 \314"
+	.string	".\241\031\340]\013\030\370\304\305i\335\360\n\366O\007\f\211\312\254\237\272\256k\002NBn\r\346D4\300\0270m}\373\362\311\360c\353\022\351dj\t\310I2c~J\247n\004\0176W`E<&\373\220Y\243\365\254k\375\241\022\216v^\310\324\365\254?\324\nr\351\372T\347I\023g\312\354\247\275\005\241\001`\250a8\244\020s\210H\002!\205IRh1\200\002\031\032\273\016\021\2405U3\244\305\312\030cl\t\353\325)C\237*\304\220\344\321.\024\016\327\025i\"\203\004\017X7_#\322\201\322\323\247\326\2045\325\263\206q\360\214\021\033\352\035\202L\316\034\020~\276\352e\201L0&\262\022\232\035\022\247S\tn\357N\002\223\366\305\241\3345\036*T\021\304\337\207\313<\201\266D\351\031\243H\230\224"
+	.string	"b\270\n6\307\244\353\254\207\230\274K\334\353\327\033\210cv\b\221f"
+	.ascii	"\241j\f\024\034#\200\025\rJ\276!\317\177\302p\233\326\333`\361"
+	.ascii	"\337\210s'\246\215\231\3167\303D#!B\237\264\257$e\350\253nu\020"
+	.ascii	"o/\250\006@J\233\243/>5"
+	.text
+	.section	.gnu.lto_servoMixerLoadMix.109.b904e2787c2f03bb,"e",@progbits
+	.string	"(\265/\375`.\004M\032"
+	.string	"&\257\245H\240ZQ:2\236\023\025\213\325\364\177-V\037aR\365\226m\257?\271!L\213T\325@\225\315b\203W*\253\376}\227\032\356\275j!lN\301(\030\2055i2D\306\234\274\216q\340\032\330\340\373\354A\204\354\275\345N2\216"
+	.string	"\212"
+	.string	"\226"
+	.string	"+f\376d>\357Gb\357q\022\337\334\313\203\367\344\336\273\303\r\306\327\004/`_\351\t\330W\2161\213\271owo\264\303\247H\315\275\227\354\036\226\005\234\372\316\264c\027m\035i\317\030\037\311\027\034e\261\335f\\\244\"\r\033@\002\334|h\205))\244\007iL\013@H\320\353\030\364\221\266\323\024\036\327\002\224\203Z\300\365\300\362\337\347\317m6\251\020\034\357\377\336@\be\273\341\370\0241\334{y\332n7\3167g\346!f\336\300L\025\004\267\275\362a\366\365\277S*OJj\314\310\332\211\314\2211\315\016\276j\234\216 \\\252\341f\263\212\3317\233\255c>\202\032? \356\034s\016\353\2753\316{\377\352\300\363x\242\263\370\311\266N\256=\231\322\311M'\317\236\374\002\003\3208e"
+	.string	"\336k\243\212\3526U\244 \007\376D,\343F\3349\246 \021\234!\205\335\237\2062\236\204;HQZ1\337\307\377\361\352\225\231\2118i\234\0014\002\215\204\244\356\275:\257\fa|\255\001\2276\201\231O\\\013\b\t\303{iMw\nAE\214\260#\372\301\2239\2465=\331\254\352\227\021\026YS[\307\037;\3077F:\247;j\352\\\354\037\001\347$+\366{I\242hs\352\364\336{\251\3309\375 !\324\251\234\231\304\257\224\032\200LV,\227\003\226\271\304\247\224\355c\311\222\222\001662-\313\314\363(\255\246*B\2022\213\206fd/-3\212;)kP7\204\233p%\314-\336D\305\352G\r\251(\336\275\267\302\321\231\260\340\013\275\262\313\305\f\234\242|\214\226\211\236\2622\317\003\230\013\306\253\005#_\244@Q\2568A\366\224%X\220</\030\371\300"
+	.string	"\273Z\264^\344\013\227\353E\256|\262#\371\210\224\246I\3263\261u\314\252RY\335Q\243\316\307\261-\026\332\234\342\332\266\277\341a8\354\f\301\200`\260\373R{\307\313\274-Q\331\354\330\254\376\324\021\260\206\233y\201\321\201c\272'\034O\210\377A\310\334s\250.\364\314\217\016\331\254\342\3567\355\327\206\304\263\025;\273\373\265!c\317\026\331\370\264a\017\337\362\341\302\356\006Q\250q0\204\224Q\304\030ED\204ff\013\323\001\320\002\231\242\255\003\021\2405Cd\263\304Zk\fpV\3059\224N\262\347\322\021\323\200\027#\276$\332U3\330\351\"\016f"
+	.ascii	"\364\317\377\0350\316\231p\353\204\r81o\032\274\270\366\361\371"
+	.ascii	"\364\333\334\357L\337@{cr\243c \261{\004\267\177\343\f\033g\217"
+	.ascii	"\007\222~_1\223I8\232\350\234'm\204\311+oy\2149\2430?\340\243"
+	.ascii	"J|\230 g\r\241\271?T\262d\020f\211\275\220\341^=\246lk\337\254"
+	.ascii	"\237;\030&\303\365\bH\024\330\223\201a\334$5G'\305\376yvB\237"
+	.ascii	"\006"
+	.text
+	.section	.gnu.lto_forwardAuxChannelsToServos.110.b904e2787c2f03bb,"e",@progbits
+	.string	"(\265/\375`/\002\255\023"
+	.string	"&\246\205I\320\320*\035\236\232\032\022\365\200\016\320#\r\230\023|\346a\357,\035m\241`\231+\211\275\003Mk\"\021Z\266m4\340\007\320\b\317\t.\320\233\271z\020\375`Nj\224!\265\232\033\200\277\224\363\207\027^C\204\020B\244L)p"
+	.string	"g"
+	.string	"p"
+	.string	"\266{\263r\206 }x(\214\346\364\025\270h\005\252\266\201\003\264\353\314\274s\322\310P1\247O\304!\345E\323\354\032\367\335L\222W\002\327s4\347L\255\007\207J\273\030\256\322\374\235\023"
+	.ascii	"\306\310\351Z.\206\344-\006\307Cw\013I\220\214\206\376\273\302"
+	.ascii	"\350l\032\212\220\371\376\367\020\240PN's%\031\3149\2559]\207"
+	.ascii	"{\274m\226m\023[+\004\323\005\201o\342=+\376\207\213~\261\350"
+	.ascii	"s\027}\226\361\342i\227\005\f\022\275\232\006m\237M\327\306>"
+	.ascii	"\311\r\222\221\267"
+	.string	"\306F]\347\377\3608\235\3476\275w\227Fu9\252\311Q=\252Z\024\325a\250\336U\253\252\017\002`\346E\204\033s\306\004q\314\"q\b\304y\376\336\325\276}\237\377\343\001\372\371yP^\374w\334\021\237\215\246\035WL\302\345\3304\370p\3169\303\373\334\264\250\035\217\200B \272+\256-a\202>\347\001\267mq\270\342>\b\227\343cM\033n\230d\335\335\007\275\030\3254\250\341)N\3129'\211\377s \325\n\005e\274\250\273\2007T\332\357q9j\032\364?\033K\353\261\377\335\301\b \321\013\215M\203\273>D7\335\256\215[?aA\344f\006\262U\214\305*\351\220\255b,V\211\312\312\345:IQ\2352\254(\270 \230\310b\260\026\353\303\252\221\330\013\003l\025K\311RPZ*\254\224\253u\262\222R\301b\251\021\001~]X\301R\262\327\013\226\352\360\325\2765^\261+\252\255M\\\033'"
+	.ascii	"Z\324\236\267\243Q\303\374\367o\230\261\303\331yic\307AO[Z\030"
+	.ascii	";6\226\333\200\206\213\"\231\334q\313%[\340fP\344\006p\201\313"
+	.ascii	"9\005' `\202Aw\347\001\326\302\376(b4\377\362\220\005{l\301U"
+	.ascii	"UHOFc\312b\343\221\335\232\272\230\357\272UT\b?\304\2146b\227"
+	.ascii	"\243=\330\312h`\244\2043\"\204Ealo]o\013\201+L[\346Q$\206\002"
+	.ascii	"i\205`\214\216 x\360\273\227m\212\372 ?\345\316\225\237"
+	.text
+	.section	.gnu.lto_updateGimbalServos.111.b904e2787c2f03bb,"e",@progbits
+	.string	"(\265/\375`\312"
+	.string	"\r\013"
+	.string	"\206\325K= O\234\016\243\331lI\020\366\375\261\001"
+	.string	"i\035\354/\037B+\257\300\315\1770\320\001z}\325\334\250\274\334\235\225\361\005"
+	.string	"\350pSp\362\004\220-(\200\340r\332?\033\t\331[\312\224\0029"
+	.string	"5"
+	.string	"9"
+	.string	".`\200\273(c\335\005\251@\261\353Y\036\340x4g\273\270\307a\251\016'<#\030\273{\351\206sO\316\377\210W\335G\363\244\022\354\256\263\373d\270\365\266\005\330F`\277A\327G\212\026\"H\233\374lO\223\252\301>\\\r\331\027\375U\246\251\230\236`:j\032fZa:5}\310\006\b\026\013\276]\f\237\214-E\322\007\333\177\330\316t\035\020'?C\215\326G&`\f\022$SUm,B\276s\200\013\252q\245\252\367\314\270\246Z\235\027\233\374\b\274\204\305\261\273\007|\022\3672\337\303\243)l\371\356\321\337\246\307\026(\016.\n$\230M\303*\032\236D\266\254\202F\331.\f\204\007\230\204\312u\301\030X\256\211\266]\021"
+	.string	"\316&P\264\013\223e\332\365\360\366p5dI\210\322F9\206dTjRJ\255g\246J'\205+\002\022"
+	.ascii	"\227\031e&\236\031\205\313\274\200\202|\314\340,\210\016`\261"
+	.ascii	"B.\027\030\033\324\016\327v8\231\005]\310\263b,T\251q\340\316"
+	.ascii	"-\332\371\004"
+	.text
+	.section	.gnu.lto_writeServos.112.b904e2787c2f03bb,"e",@progbits
+	.string	"(\265/\375`\230\013\2056"
+	.ascii	"\332\\\034\024C`\346Q\007\367C\017\245\004\332\234V}\237$,%\030"
+	.ascii	"\344\343fJ\362\264&\225\305\210\031j\250\343\340\334\022\200"
+	.ascii	"v\267\241;\347}6:8f\342T\037I?\005\361\221\217/\326\2615#\351"
+	.ascii	"\266{\313\224R\n8\001\021\0012\001a\332\326\307\264P\353\246"
+	.ascii	"\246A\351.\335[\272\263\3643\267\027$\325\260\245r\202\005\214"
+	.ascii	"\233\214\233Kk\351\262eoa5\226y\305\216!\363$\256m['\266Ud\027"
+	.ascii	"\327Vo\023\327V\275\307\330\307MN\313\316\222\203m\301va\272"
+	.ascii	"\370\304\265m\031S\253\234\200mu\311,\3552&m\233\305\261\372"
+	.ascii	"B\250m[\345/Y\3275\310\267oY\363\360\227mT,\"\022\r\r\205A\340"
+	.ascii	"\317\327\343\261\273U\275o<\372\222{\251m\332\304b\266\321W\027"
+	.ascii	"\277\236x\321\326\323\253\2117\201\026\033\220\236s\345u\213"
+	.ascii	"r\222\360i\242\236s\325\304\211\017\335\237\235)Y\017\206\224"
+	.ascii	"\261\323^\216\370\220I\013/\357\211fK\317\271\352\272\020\340"
+	.ascii	"\276\2644\227V\222re\304\203JJ\236Z\r\034A\346\347m\350\370z"
+	.ascii	"<v\316U\326EJ\271\202\372n\3539\244\327\233 \016\215"
+	.string	"\240 \226\325-\372\370j\366X\273\023\253\312\325\226\352\352\333c}\245\240\2415\261\200\364k\265\321\231\364\361J\021(D\246zX:V\336\223\313\254\267\256\272v\276\233\320\266-{\023\353\331|\324\314\255\207\231!0\367^\004R>\345F\353\036\353\017lnL\247{\265n\343G\3374O`:\035w\263\331\223K\314\221\345\260\364\326A\217\372i\215\303RU\355\330O+\033w\033K\325\266b\033n7EN-\260\026\311\032\3565\226\252k\240\3014\334jX\347\020\260\026\311\031n4,e/{\263\335!\0053\303}\306\322K\307\246\373im\225\f3K\325:\320\266e\266\2267[\004m\226\3271\267\2306{\342\366b\025,\274\233\255r\263X[\355\277\202\332@\245|\352\202\250\246\347\3140\240\274\233\354i\322\270M=\223\271l\252o\373Q\346\276\355s1S\210\340\324\324@uVv\227f\003\275\245\271"
+	.string	"\201\344RgiVZ\235\221;\347\001\253\263"
+	.string	"wN\3329\007X\235\221\2563\200w>Z\235\217\327\331\370\316F\327\271\370\316E\327\231\370\316D\327y\350\235\207\327Y\370\316\301\353\f|\347\237\352\314\273\316\354;\357T\347\365:\253\357|\257\363\277\263\273s[0\222\311\341\020\021\276\375\270\351S\2455e\374\343+\375\361\033\316\252\256s\254J\357\364\027\256Jk\312\247l\364\306o\270%\025\377\3614\372\346\322Lokb\377an\254\334"
+	.ascii	"\213\257\240\350\213\337\356\243G\321\373\242j\210\317D\364D"
+	.ascii	"g\223\350}Q496\355k\306~C\257`\370CnU5\224\023>S\360\205\f|\312"
+	.ascii	"\245\202\357\213\232\021KKk_3\305\315\307h\314\354I\243,7\035"
+	.ascii	"\317\354}\224\007\374=\360\335\f]\241\337\003\243_\312\276\360"
+	.ascii	"\260I\253\222\267\325\235\264\362^\371\354V\320\251\036\324\204"
+	.ascii	"r`\310\220am\225\367\273\267/bP\007m\033\332\216}\246\335\263"
+	.ascii	"\337p\200\376\354\336Wgz\304\002#\267nX\327\217\352\242\207\312"
+	.ascii	"\347\230YC\307m`\333\226\n\002\267\264\373t\360\360\341\303\332"
+	.ascii	"\352\372=\326\007\270\352\344\310\3124OP?\332\375&\f\216\315"
+	.ascii	"-\272\372\n\356\253yz\217\036\265Y\355}\\\205\304\322\212\376"
+	.ascii	"\317\324\314 D u<\223\375\377\333LU\034\235\266C\202m\333V\002"
+	.ascii	"w\235~+\301\355\325*\2338qbm\3656\253\275\217k\220\\Z"
+	.string	".\032\207\212\02412\364\370\211\001\r\250\033Q*h(k\264`\341\342\305\ne\f\027'`(\237\242h(\031 1\224\f\025Q\312\032PPQJ_\231T?\027\b-nR?e\224t\244\025\002\217\374\246\266;\315d.\356\254\370Q\216\"VG\244\360|\211\222O\340\235\276\325\003\270\254m\007\374o\315\312\\\321G\223t\362)|\b\266i\322\005<\363\022\313r\f\231|\001\337\3046\310\252\316\215\220\241\363B\374(\253\375\264&\275\207u\311C\345s\036MR\006\261#\267\246\303\207\027QP\351\371\016\227\336\206\2213wh\373[\0242\236\003i\217\036\351q\275s\254\311w\362\2145\300\243@:\262)\254\314\025.x7\0034\2175\"nT\317\344\036\323<\235\312\r}\224\0374\205M\337]V\310\216\013\332\300;\253X9\02368:\264\227\336\2713\320\233s\2707ap\206\006\276\351W\2607q"
+	.string	"<\322\322#9\220^\372\006G\017@\212\027!r\364\355\245\231\336\3408\227\331S\210\360\243,\314\002F\370\356\252\002\307\350\316*U\244@'6\220\2213#;\331\002\275\260\376)\037\257\255\240\202.\360\001\200\347\250Q<\005\031cfFD$)H\222\326\300\002\221!2n\021\020\251s\n\235\210\230\0242\354w)\251\263\341j\221*\336\331\352\316-\201\275\205\036\302\347\002\210\033\252,\226\356cf\275\372 \001\221\221\330@r\253\261\373\214\274\227vj\205\366\304\240gmO\260\034m\016\227\177\241\275\350E%\225N| U\335\344\304;\222"
+	.string	".\027B\026\241\343\322\210\235\206\3632\026k\020\251\024\177\035\335< \217-\261\331\346\001\376\272D(k%i\360&\021:N\f\317\221\233n\025_\226;\301\331\246\356\327\224d/\005\355\211'\215i\365\1776\360\203\317\316\234"
+	.string	"kN\276\302\216\276\361\223\347\347b\374[\345\305\372\0220$\031\217z\262\264MJ2\016-\337n%Q\212\253\217/f\273S\230)=\rs\227\224m\026\253\340\205\331\341s\345N\001\261q\304\266O\260np\347\217\016,\006K\351JfH>\230[\240\352D\r}\200?\236o\t8\003S\356&\222\213\314\344\260\334>V\252\340\243\t\335N\301\277\371\231\337\212RB`\223\250\245\177\241gUW\\\021\272,\234=\327R\273\336\334g\022\2144\250\261\334t?<H\364\bb+\302s\031h\207\373"
+	.ascii	"\201@\376\240\033L\347\250\210\237C+\203\222RD\231\330\354.5"
+	.ascii	"8X\342\030\033\210\342\013\261\001\250\247'\013}\216\fM\355\301"
+	.ascii	"\207\213K\263\300\022v\277\342\323\275\021\334\377\003V\223\343"
+	.ascii	"\236\246\004\211\250\\\327\344M\335\251\240o\215{\235\006\231"
+	.ascii	"\001\310\001\243\243(]U\363N\221N}qjI\243I\367\357N\270\030\366"
+	.ascii	"*\223\210\205.\321\035$\214c\234\005fP5"
+	.text
+	.section	.gnu.lto_servoMixer.113.b904e2787c2f03bb,"e",@progbits
+	.string	"(\265/\375`\263\0375\211"
+	.string	"j\343\2141H\020X\353h8w~\337S\020\246N\343\370_\206\215\3363\266\204\314i\355\207)\"(\371\377a\024\206EA8\r\263\203Z\3579\211\3028_\370S\310\027\346\t\241Pc\206\347\235\004\024\320\260\024\242\233\027\214l\263IJ\031\374\002\317\002#\003\013D\330{\200\260\367G\332\353#\3555@\330["
+	.string	"\260\267\207\260\227\200\264w\200\264\327)\330\313#\330\273#\355\325\201\366\346@{q\244\2757\322^\001\320\336"
+	.string	"\320^"
+	.ascii	"\322^\033io\ra/\ra\357\f\264W\006\260\267\t\355eJ{c\024\365\302"
+	.ascii	"H{\227\202\275J\301\336\027\301^\027\301\336\026i/\213`\357\212"
+	.ascii	"`oR\260WE\260\027)\330{\024\3545J{\205\301\336\242`o\032\354"
+	.ascii	"\r\006{\321`/0\330\233\"\355\375\005{}io/\330\313K{w\301^\035"
+	.ascii	"\332{\264\267\201\275\314O%(\372\240\200\266\256X\346\022\255"
+	.ascii	"|vN2\254\306\234\306\\\306\334d6c\256\303l\207\371\r\363\222"
+	.ascii	"S4+\031\270\313@/ca\201\366K\346\037V[\006\264=|\250O\334gwg"
+	.ascii	"qO\313K,\360\211\225\200\212\003\210\n\007\276>\333SK\304\007"
+	.ascii	"\n\267\006\0029\341\347\376\336\250\345\001\032\333\030\t\306"
+	.ascii	"\263\013\334&\374\334"
+	.string	"\242\263&N\030m\237e\316\362\033>\333\255\201\237\333S{\013[\327\025\316\262\034\236\303t\330\311w\026hG\252I\212p-\262\225y\255+\033\"=|\250\\G\312\267z\365\312\306\310\031b\006\245\331t[W6\t4\207TV\346\374\360\361\316\b\216\243r\331\320\267\322\361Y\2151\353\341\343\235\260\031\211\307l\242\022\256Tc\340l\r\273@\336\3552\233\345\261\005.\267a7*/\367\351\223r\345c6\323\270\r\340\343]\223\356\307b\013d5\274Fee\224\246)\341\272\206\031\344\265\256k\016\336-\016\037\357\230\017'\361x\267\304H<\336\251\273\204\230\r\327\332\013\263v$\203b]W\247\007!C(TZ\037\353\330\360\376t*\317\220\321\304\024\003\306\022\r\245\027.Z\260X\221\244\002\351\310HX\224\006Q`\212\032?_\217\267\323\275\325e1\236\321\006\250\nK\n\317\210\303GM\3130\202\233\216"
+	.ascii	"]a\352\taZ\025\352\222\005\207c\210}])\033\206\237+1@kz\311\b"
+	.ascii	"\246\241\353M\3012\004\373\271*\323\001A\344\346d\246\016\255"
+	.ascii	"\004&+\r\277p\321\023\302d\337!\2668\205\272d\241\341\026a\314"
+	.ascii	"\202\f\236\260^q\364\241P\227\254!8i\314\331\020\255\002)\f\037"
+	.ascii	"\351pl\345\321\302~\256\204\320%\365\361\302\004\347\t\323Fb"
+	.ascii	"\272ZX\304\345C\247=!]\262\304pp\353N\017\215\372\271J\352\232"
+	.ascii	"\200\354\347j\007&\017\235\202\247\322p\r]\357\312\225\032\373"
+	.ascii	"\271\222\243\003R\250M\007\036c\031_W\\\372'\003LV\016\354\343"
+	.ascii	"1\336\215IS\250KV\016\334\303\201y\306\336\245XG]\323\272\256"
+	.ascii	"@\254)\255K\201\205\003_\227\204e\210\252\024\213J\207\303\255"
+	.ascii	"\316!\026\343\266\302*v\367\204\254\353\272]\205\225\305k\203"
+	.ascii	"w{lw{\330\2051$gz\203Y\346i\272\f5L\203Q\307\370\326\225\352"
+	.ascii	"\307\366\227F\252d\312\250``<\3365\235\311\272\2241\316t>\312"
+	.ascii	"M\365\034\217\3562\354\037\032\b\265\b\365\214\232T\223<\336"
+	.ascii	"\305\370\2165\376!\327l\355\214\360`<jF7\255\254\256\341\355"
+	.ascii	"\252b\0164W\301x\212G\213\017\325\245\354\322\225\276t\035\333"
+	.ascii	"\213+\335E\234\213\267\370\213\367\236\306\255b\016\\\\\234\337"
+	.ascii	"\2549{\213V\213\007\265\346\340X\354Xq\026\327\305%}\305a\350"
+	.ascii	"Qq\244'\375\305\037\254+\025\347\264\265\243\033\035\351\275"
+	.ascii	"7\343V\361\212\225\243\263\234\035m\325UF\017\0261\227\024\026"
+	.ascii	"]h\306`9\310\341\263\256\253[\327)\032\351\213\276\024g\374*"
+	.ascii	"\366\334\006\217>\375\213\246q\n\004\301\363\236.\340S\034}\357"
+	.ascii	"\217q\253X\224\353\251\t$ \002<3\327\234\275\312\361\334\004"
+	.ascii	"\025\020!\302\343]\212\007\221rpGq\020\245\321\375\356\373\357"
+	.ascii	":6\206\343(\020\355\223\307;\337\203S\342\222\275\035\274\367"
+	.ascii	"\256\213\333\301\207\336x\017\"\023\3019w\027\033\026qq\225!"
+	.ascii	"\335w\327\275\031\367L\365\234\0166\264f\276u]\201,\273q!\f\226"
+	.ascii	"\305\360n5(R\344A\255DI\247\215=+\330\217\334;g1\366\371Y\n\242"
+	.ascii	"jD\333+\007\300\343\363\235o\037\271\024y\0203"
+	.string	"\001eY\314v\360As\325\007<\336\361{\310'\222\\\246zn\227M\261\217\334e \\\210\b\355\277\354\336\261\343\2443\247\031\007\016\227\3612\223\233l\306\313dcK\256\303\313n\330\016/\267Q\252\350e4aH\275\\\004\253\3612\230Q/\227!3\306\013\247\361\362\026~\303\313Z\274\344e-Y\262\260\256\260\\\261r\203\025\332\313UH\275\\\005\355e*F\275|L{\331(\354\345)\302^\246\022\366r1\355\345)\264\227\245\240\275\274\242\275*R/\021\355\215\222\366\332\200\366\326\200\366\322\200\366\016\323\336\031\320^(h\257\fh\257\024\332\373$\355u\202\366F\241\275M\320\336\030\320^\250\264\227\t\332\373\224\366.I{a@{_0\352U\"\354M\"\354u\001\355m\001\355E\202\366\262\200\324{D\330\273\002\260\327\210\260W\005\2647\005\264\027\005\264\367\004\264\327\004\244\336\022\200\275$\244\275#"
+	.string	"{EH{C@{A(\352\375\340\250\327\003\264\267\003\264\227\003\243\336\"i\357\006\302^\r\204\275\031\244\275\030\244\275\027\b{\211\b{-H{+H{)\020\366N \354\035\222\366J\220\366F \354\205@\330\373@\332\353@\332+D\330\333\200\260\227\201\2647H\332\273\200\260W\001ao\002i/\002i\007\327\201\230\004\fD=z\236U\206\204`\261\241\017\206\377\234Sn\376\302\371\213\rm\225>\220\025\203}\210\225\234\273\020\323\276E\n"
+	.string	"-\265hC\213\222\377\316\230Hrf\272\360$g\243W\013w\341W\030\311[`\341'\034\311y\177\214_G\316B\237ga]\035\201S\256p~\363f3r\025\276\302\231\354F\316F\271\024\256\302]\220-\301\373\344\241\360\024\336\342iDs\302M8\ng\343W\221\354'\234\367\347(W\302MP\342V\210\177\234\002\375\006\265\310\203\353V%\034x\bP\222\004\262\367\233\321k\204\223"
+	.ascii	"\350U\210\203.D\032\225\343\b\347gW\b\027\341\274\366)\304AP"
+	.ascii	"f\210\330R\303{v\211\316S\021\331\232\t\210\266\245\231\232O"
+	.ascii	"\275Hl#\026\"6A|\343\361.\204\037\260\306m\016\302\231\013\023"
+	.ascii	"mG\271'\276J\0310\247\026y\310\271\371\356L-\251$\302u\")\037"
+	.ascii	"\\Q\250E\247@\210\270\315\371\016\3338\373\003\247\354DbUG\264"
+	.ascii	"\267\370\2037\241\245\240\007\332\203\357\022\343\210s\315U\037"
+	.ascii	"\274\211\352R\266\203{\360\335\333Q\216\203w\360%\266\"\347\340"
+	.ascii	"KdG9\336B\346\220\026P\212W\344Q\3135\252F$\245\337\244j\334"
+	.ascii	"i'\324\"\023\020C\335\204:\345\250V\251\302\343]\2213\223ol\371"
+	.ascii	"\223T\236\2116\005+\305\221\3135\376e{x|\354\374\005\365r0k\271"
+	.ascii	"\325&\241dDO\\U\371\035\311Z\316\316\3230(\315\2705\344\355n"
+	.ascii	"\224\263n\033\026q\2615!\325\312\212\212\005\313\030"
+	.string	"\333"
+	.string	"\263'\314\211\251\236\373\335\314\321\332\301\267\301 \240\006\337 \203k\200\3013@\353\265@\030\300]\240\226\202\310/\260\340D*\270\005\316^B\211\n\376\003\223'IA\237\337\004\247`\310'\220\340C\232\235\266G\202\b\362\370\236\020<\202\007\016\301wM\007\376@\343A\302\201\377\300\240\tA\353\2755p!\f\274\201\363\232A\316\300\363N\220\377\324\316\340\026p\362\232\n|\201\004\256\300uq\b<\001:f\b\374\267\345,\t\244\271\323s\300\201\374\370\001\337\3511z\371\370\217\2628>\3763\363\204s\032"
+	.string	"G\367g\0017\240\307\tx\001^\3057d=\376cm\200\023\260t3\300\177`\236I\247\323y\334)\r\233u]A\265\343<\336#3z)[M\257Q\261\262\250ZZ<\336\3558\360\254\231t\352@\023\314q\035\377[\227\341\366\342&\303=\004\343\310q\3438\256#\303\241\317\f\203p\231Q\275\370\bT\304\215\027\201\221\223T\n\320`,6\f\242\274\317*C\001\\\200?\256\200\276\0236\334\220Ri\002\005"
+	.ascii	"\337UwP{h\256\n\340\272\225\313\245\254\215\003p]\323\207\026"
+	.ascii	"3\f\022hW\005\242\303\250^~p\255\353\372\203w\333]-\204\212\f"
+	.ascii	"B\355\352\342\361\316\306\213\3140\341\224\275\032I4^c\306i|"
+	.ascii	"\3274\032Z\372\214{\020(\355(\247s\3561\343\035)#\233\204\207"
+	.ascii	"\223$O\214<91\201zz\202:\362b\223<AE\ra!\312\b\224(\250!P\036"
+	.ascii	",A\302\204\211\221$GT<A\342B\224\221'\274'\250\250\026tI\236"
+	.ascii	"\260\240\004J\n@&J\236>\203\221\247+\341'R10Q\262\333#<\234@"
+	.ascii	"\311\020\205\304\211\323\223$.(Y\322\202\023\023%F\236\234\216"
+	.ascii	"D9q\342\241\264P1 \211rz\002\005\025\345\004d3\305\377\262%\300"
+	.ascii	"\361\231zq\243\350\326\265K\003\254d\026c#77n3\216\334\036\236"
+	.ascii	"&V\376\202h\344`\336\262\245\311\234Qb\007\031Gn\213)D\210\211"
+	.ascii	"\275\374\302\n)c\360\230\263\235[m9+OC[\226/\332\260\350,\353"
+	.ascii	"\234\345\214\225\365\266s\306\342+\347+\235\2326\264\243\\\023"
+	.ascii	"\261\315\357\020\007\021\341!l\315\216\323\313\177`\314\244\036"
+	.ascii	"1\034\0021m\224\037N\347f<\346?27!,\355(\267\177\256\304-c\200"
+	.ascii	"\235\313\274\345\226\3137\245|/\273\034\"\031\223h\204\021e\316"
+	.ascii	"y\272\272\300\312\330\3008r\347\030\212\307`o\301C\230\245 \260"
+	.ascii	"\267\332\022\313\016\207h\366*<\374 \210\371F\255\2103 \326\225"
+	.ascii	"\3112\226\264r\276\362~\032\321\024o`+\347\3511~\025\255\316"
+	.ascii	"7\214-\255\036\244\313Y\365fk\276\r\321\314\2043K\370\331\215"
+	.ascii	"\342<\0331b[\2253\037\316\361&\021\\\230%7\032\377\262@!^0\235"
+	.ascii	"_P\215\034\314ZZ\020\3549\236\251\\\315\327H\021\353\020\355"
+	.ascii	"\020\355\034\317b\215\213NI\353L\347L\004\023\314\316\362\342"
+	.ascii	"H7F3\204\301\225d&\267\362\214\327\226\032'\266\f\207(\252\\"
+	.ascii	"\260\3503\236\0255\234\341\260\361g\206I\\f\316TS\316\306\255"
+	.ascii	"\342\2343\325\257\347(7u.\0221\364\035\214\247\236\004\347\034"
+	.ascii	"v\236s\210\020\232\361\253\330\202\206\216\342\212\352\310\342"
+	.ascii	"\310ur(I\007\363\031[p\354\341h\246\202\007s\330\255\244\340"
+	.ascii	"\341\365,\345=6#\032\365Q\316\353\227\236\306/\342\325\347\313"
+	.ascii	"\020\377p\"./\265\310\207\002\221!\236\023u)mx\224\273 \0333"
+	.ascii	"\364\211\261\341\234\326\345\234z\363\032\230\247a\207\210\020"
+	.ascii	"\332q\305\221TI\377\262\214\346+,\005q\0344\347=\217\\\306\316"
+	.ascii	"\313\341u0\217\235\027gLT<[\"\332\273\210HP\300\203\333\021\\"
+	.ascii	"A\360\031\3079\237\361\215\342\234\244r\030\200\332[\021\020"
+	.ascii	"S\216\212\212#\267\210\231\243\377~\250\203\325\245\315H\352"
+	.ascii	"\334\234\001\371\245\371\031n\250\265-\0011\221\316\364\265\266"
+	.ascii	"9:r\241\344\341\346\242\345\007\256$\224\220\341O\016\305K\206"
+	.ascii	"+5\245\316O\346\234\230\205\2000B\300L\024\313=T\215"
+	.string	"H\350\344]\2066\270\200`,w\242\342\r\352Qg,\3376:\321\3441<\352;2\343\226\2227\271Rs\311c`r\250\263\027[\333\246a\361\343\246\210\311\227\234\277\2760y\372\216\355(\2675\364\365\260\344?0\204\222\316\024\206\3570dz\016\001\202\212\250\322(!\020\222\230)C4\"\222$I\232\003\"\013\020\bdyZR\352\001\022@t1I\243\220)!\021\222\244\220\016\257\005\343\\G\313\306U\276\203\361\005\250\342\375%\017\271\366\350\354T)i\3073\002p\216\224HTj\214\354WQ\341,r\250\342\360f\034\221\253T\246\217x\270qx\266\341\3715\320\247\007i\340\317]?^q j~\270\3328\240\372\037H\377\032k\222\350\262d\032\n\225TF\235\303\007\215u\324\270\365\216W\242\022\206\220Mj\231Shd\206\322\253\201\332\025\320\227]w\326.1\225\202\205\023\204A\006\3759\243\340"
+	.string	"\274\361O\260\020F\330L\300\213\317l\326\256\337\333\261\037M\b\264\270G+\265\033r\225\306/\233\333)|R\221S2\324\324\304)\257:qN,k\025\b\216\213<}\rIt\243\356s\222\324\233D\245\2467\271~T\036\301\250\203\355F\204\201!\021\334\316!\262\336\240\303L#8\270\365I\212$\327\034\023t\334\317\261\f\336\246,-\206\317\357\274\177\304\222\255\260\021\221\210\340k\374\221R\375\314\353\237\037\234\216\236\037\363\f\2136 \374\232\005h\234\241\217\023\177:\336\351\320\227\002BK\025\315\333\310\215\257\222;\345\220V\f\245oU\227\022kF]\307\231\230\"\214\234\246G \375\317>\353E\233`"
+	.string	"\252\251\372?\313"
+	.string	"\364b\327\001f\200\350N)`\255n\342\322D\352x[g\335U\024\"\035\376\221\276\205\333\367\036jI\032\356G\030\331\254\002\273F\240\233]\013+/k \363\227\025\032z]y;\223\tVo\024\254\005"
+	.ascii	"K\250]B\242\006\275\271lQ%\343\fx|\225\262\351c \321\232\210"
+	.ascii	"\333\241\272\231\304\200#T\363EXz\026\212\021F\227\237J\020\t"
+	.ascii	"A\277\223\001uP\213+~\020Hk\030\277\301\257S'p]\332N\356\222"
+	.ascii	"\\h\305\210B\207D\326\305i\330\331M\233\221a\346\"\336lb\223"
+	.ascii	"\005o\316\334\301E,\006nDJ1\034\371\003gI\f\254\324\227\304\r"
+	.ascii	"\210&E\b\033e\374\321Wsd\365\333\332'Z\340Ib\f\027\366=l\347"
+	.ascii	"\277\324V\252&\027u\217\224\016nlt\231\032\204b~1\031>\345\037"
+	.ascii	"\363_NO[\337U\235L\346\221\262\205\216\2403)\323\347o\207\221"
+	.ascii	"\227\207\023p\225v\035\300\302\301\233\332\026\324$n\352]0\330"
+	.ascii	"\023;B\033Ur\177P\340s\273\305\032\326\322\307\376-\324x\200"
+	.ascii	"\0014`BO\003\251\273\327X\335\355Lr\243\204`\277\254\365Fs]l"
+	.ascii	" XE7\223E\024\020\027\364\333a3\362l\242\2748\207#ff\377\362"
+	.ascii	"\301\221HS\260j\216\272,\241^\021P\220\374\"\"\363m\347\315\240"
+	.ascii	"\376\311b\022L\222\n2gAtQM\351J\261\277(\n\203\\b\364\303\200"
+	.ascii	"\026\355\007\302\350-F\212\035\031W\360\004 \241\362P\030\332"
+	.ascii	"\031\346\0056\t\201\265\375\371:\246z\256dR\242\035\314\214\273"
+	.ascii	"\232#\354\344\240~\325\306>\340;\r\025\024!>"
+	.string	"!p\257\223r\365\370\035"
+	.string	"\300\340\324\234\004\254N\b\244\227\031\t\356\274s\020\304\265\205h\f\274\276\321ZwP\357\340I!g\253/U\201\213\205G^\033\355!\322S\217';\247Z\303\027\301\355\356i\r\177\243\266\373\245\032\206)\360\027$\225p\005d9\303\331\f\304rd\345\267\256tDl\330\316\376\017\031m$\223}\354\222\351`\0269k\260(\211\347\375j\330\303#-g\326\241\036\207|+\317\300\307\262\f\005\030\312\264\347nw\031\036\334\310y\254\f\227\234\243\205A\245\314\362\2405>\003@'\225p P\254\025\371G%\243A\361)\031\"\006\205!\220\212j\334\002]`\323G\366\t\213s\ri\240\252\001&\254\255\361F`\326\032\350L\025Z)B\021D/e\016\312\225,`?\224K\303\264\262\262\315\306\003W\260\351HC\327\205"
+	.ascii	"\231A\224\373`\212\030rQ\265\027pB\223\336Bg\242\217\255\341"
+	.ascii	"\275\251q\276\027\207\255\305\236jF\243\366`\226\326\016`\006"
+	.ascii	"\005\240%\2057\004C\336\371(\257d\210\264\007\367\036<\r\302"
+	.ascii	"\240\321\324}\251\214\330\003\304\264O1\234w\215k\004f\004\035"
+	.ascii	"\016\366Jq\0342\263\220NI\f\035\212u\244B\255D!Y\222qn0\036\230"
+	.ascii	"\025\216\212\032\327\316\016\b\3233A\322\276\330\256\363)\301"
+	.ascii	"\330[\326\233\315\251\373(\f\335\316\314\236\250\364\316d)\t"
+	.ascii	";tRV\001\257\223\220n\202\324\224\210sF\262\206t\242\r"
+	.text
+	.section	.gnu.lto_servoTable.114.b904e2787c2f03bb,"e",@progbits
+	.string	"(\265/\375`\200\020\005L"
+	.ascii	":\202x\034N0\224Z\031\016\313\225\242\b\250\370-[\227'\373\024"
+	.ascii	"V\216\210\004D\346\246,\351\244qP\031\206\344&7?\227\214\305"
+	.ascii	"\376#z\310\346D\374\242:\204\311\323Q2\021\357\253\025\2530\342"
+	.ascii	";\235\215D\200\002\002VD\314f\367\336\233\354M\244\224)\247\001"
+	.ascii	"\215\001\273\001&N>\021\312\037J\371\301\224/\224\362\203P>\320"
+	.ascii	"\311\3779\371>'\277\007\345\363\234\374\035\223\257s\362\323"
+	.ascii	"\223\217\236\374\023\345\233'\037x\362K\223O\002\371\277\222"
+	.ascii	"\337%\237I\376: \300\034!X\331\007]G\\\271\372\346\254jH\271"
+	.ascii	"\262%\356\032w\341\266\377\375\226Y\271\f\226\314\207\304\224"
+	.ascii	"\304\310\274\207\207\243\336\227\355\0337fmP\027\356sGW\304\325"
+	.ascii	"\013\200=5k\017s\311\243\r\226K\3766\250\\\362\315\370u\023\322"
+	.ascii	"\246\227\2460\203\006+\303\273\370\226\366\r\263\304\257\230"
+	.ascii	"\343hR\267M\312Q\025q\345R \215\310\246\307\301\262\375\200\266"
+	.ascii	"<!\333\272\256\034|\207O\227\304\321\304\301\266I1W3\340\230"
+	.ascii	"\272\017\340\254+1i\311#\231K\002\323\253\377q\211b+\320K_\226"
+	.ascii	"Qo]W\246\356rs\177\304}\220\325\035\n\n\005\001\375\370\364\360"
+	.ascii	"\354\350\244\350i\002K\362\327\254~\371\312]\325\016\375\200"
+	.ascii	"U\272\334\354\232\256\026~Oxw&l\334\n\034d\241\202\025/+D\266"
+	.ascii	"A,\310\2211\320\317N\361\262>@\037[\254\210m\317\030\n\314#\344"
+	.ascii	"\035\235\0236u\241\013\013\243`n\313\302\205.\023\370\004\252"
+	.ascii	"\253b\002}\274m\341m\261R\302\002S\257,.\177A R(b\327t}\375\220"
+	.ascii	"\204gDX1\313[^XL\376\216\326t\211\375\216\326uM\275<\340\337"
+	.ascii	"\256\255\213+d\212uc\274D\330\376\005\271Z\320B\275\254~Hp\312"
+	.ascii	"$\201z]1\003}\254\353z\326\362\262\262'\332\177\305\376g\360"
+	.ascii	"\367 \t=z\317\214\225\035"
+	.string	"\326\267RJ\2506\001\306\002\001\r\325\214&\213o\211/`\341\004i*`Y\256\234v\206_i\357\242\330H\313]\221\312\223\335\036\017\370\222-\271D\"\b\034)\227$\240W\314\272\240\002\226E\3306\234\302})\322\212_d\224\222\033\202\342\020W\254\304\203|\264I\312_\311\022^-\356][2\216\231\036\234\253\035\366>\252x\357\367\303\377\003Lx\265\256\223FM\215UW}\315\354Q\025\357\001\255\2413\366\335l\335\217@\243\211\023l6\b3BA \314\360\320\375\bt3\367\314\242\371\021\370\366#W\252\354\341\353\303\217@\270\257]\251rI\263\310\252g\206-my\370\177\f M\b\266\256U+d\255\225\306o\375b\276\177u\3309\251/\331\233L\300\253\265\344w\202r\311m\222ML\330\3665\205\373~\242\025w\330\277OxXfo.\377\311_r\362\031@\371JP\376\002(?\311\311W"
+	.string	"\211\311?\262\306\275\221\223_\004\345\023A\371CN\276\020\224\037u\362\203"
+	.ascii	"\371\006\234| '\377\207\311'`"
+	.string	"\211{( \277\307\302\355y,\334\376\t\345\3578\371N(\277\351\344\353@\3719N>\016\224\177\003\345\333H\371L)\177)\345\327@\371J'?\351\344#\241|\032'\177\206\311\227\201\362c\244|\030)\377E\312w\201\362[\234|\026'\377\b\345\033\235\374\025&_\005\312O\221\362\213R>\212\224\177\002\345\007\213e&\244\205\232D\003\324A\275Y|-\250h\246\027\240&\032\223\373\351\264\205\264\221\035\226p\210O\377\364S\233\236\336i\237\256a\307\323=Tx\005\025\215\373\304\306T.\216#\204\030Os\337\330P\247w\332hO\005\346\302a::\315ucC\034\373\271\022\355\264\215\214X1\234\rl\264S\030\261\\\260\342\276\233}\366n\261\026\025m\363\204\370U\0208\213\312\265vbK\236\205\214\202\352\025\202:\302\b\345\222fo\336\233a\331\300&\367\260\214 \273\354\322x\205\301\202`QK \202"
+	.ascii	"\331;\262\332\250\375\206\300{\323\263R\312_\357\226\342\233"
+	.ascii	"_\305\302_R\3143\t|E=\001\005U\213\226\0163\344\"l\343\001\323"
+	.ascii	"\002\307\2433\244\327m\243\336\266\262nH\211tTo-\021\333MU\034"
+	.ascii	"b\211\315U\303\312_\355\242\216\361ju\363\320y\251\271\352\252"
+	.ascii	"G\365\255x\321\350BgU\267\243~a.\032\2520\b\306!:\357 \217\267"
+	.ascii	"X\213\210\221\376\221\032i\003\3246\376\200\263\f\370\201\261"
+	.ascii	"2\252\241\035v&\303;\232\013\234ixC`\222V\322[\307[#G\332\210"
+	.ascii	"\361\005\260\0075\3745"
+	.string	"\370\212\255\214Gz\335\224\364\177%\256R\321z\304\372xUY\360\242\226\225\255-Q\232\"\2331F\234\352\227\335S\317\242\300\322\212s\226X\240\317\2637\265\341P\226\rs\346;\220[9*\232\371\215\263z*\030UM]S\327\312%\223\364)\007\325\nt\003itY|\245Y\234\"\260\303\016\325=\232\371\212i\256X\t\265m\221P\303\230\353\272:}\217\330<\250\017\360\203W\353G\271dw\262\024\305\311\005L\2360A\231z\362dJ\n\305\235P\260O\246\250\200D@\305$\003\252) S\tT\320\004\n\024&N\244\204.\265\024e\n\003\252&Q\230.p2\001\005\025H\300\004\205\002&O\230\244\250\2420-\025}\312\202&TL\027LMQ1\245\304)\333\\vmM\2720j\246\264\325\207:\354\033\2672|\020B\322\377\371\360\350\247\336z\002Z\"N\325\021lv\367\267\256\353\032\354\260#"
+	.string	"C\320\2223K\231\256\2732 \035\315@o=5\222\336`\257nG\323\251h=i\030\350\0350\272\034\213uo|B\035\326N\275\244\317XyVLf\266\205\204\240\016\273S\353\350\225[\376\022!\013\026\"\330\244ij\2473*\232\371CS\303x#\227\243ux\300=\250gPp0\303C\216\3361v\243q4\267\311\3429\365\254\261\f\363n\370\325*\254C\016\007\374Fo\334\376\316\300\034\345\f\373\255\212\2342@6\312\340\300\3246\226\272F3\005\351%\245\256A&N)\251\203\364\2129\244\236\321I]\204\206F#\331\240\242\355q\214\312\265nj\240\321{\224\3213\232\264{s\223\321Mouj\303\0303\024at\214\027\355\242a"
+	.ascii	"\351\027-\332\205\030b\013\026\r\244W\330\035\365\212f\321Ev"
+	.ascii	"F}4T\321\366\256M\345\332:6\243\336\273\261\241\212^\321$\022"
+	.ascii	"1\250\251\370\241\325\271\221s~)c\363\363\223\264\374KZ\356I"
+	.ascii	"\332\215[S\316\022dv\222\226Go}}R4\030\030\212:\005\212>\321"
+	.ascii	"E\275X\302\"\215\242\3119\023}\342\2053\023D\235v\2216j\203%"
+	.ascii	"\344-\353\323D\315C\302\034:\254\030\206\372\213\212Fd\246eD"
+	.ascii	"\260\207\204:\250\203\035\201=\250\2010$\021c\206HD\024$)H\322"
+	.ascii	"\032\201\005\304 &\035\232\007\022\340d5\t;\347\024\211\204b"
+	.ascii	"\267\260w\237\305\361\266\252$owGXK\244\n\312\211\2746\305\013"
+	.ascii	"3\376h\027\335W\362\370\226J\231\222's\214\223\032\034sF\200"
+	.ascii	"-b\202,\271`\n,$\266\023\216\324\341\272x\302eOV\237\005\312"
+	.ascii	"%\251v\021v;]J\022|\330\230\032\206\244\"\247\371\016\001\202"
+	.ascii	"\030_\310\206\201^\213:v \002\220\202\275Bm\313hD\301\263\013"
+	.ascii	"\3561\254\272D\216n\336-\306\205\305\r\fQ\307\273\314\354"
+	.string	"j\316\335.yS\203\236\243\243\356H\346\306\202\223\006\214\035\262\005|\"\237-\255\372\332\275l'!z\333GbO\323\t\201\230\237\324\3539\036]\025\027\320A\2457)\037\244XW}\317l\"\316\373\300R\343\206\307|\017\224\277\3677!8\324\031\367\222v\365S\214T+"
+	.string	"YW\3609}\226\242\376\0333\001(t\004\344\347HGb\177\304\213\337o\256\264F\303\374\207\330<a\377\341\207\221bv\t\223\362\332\325\223\235[\320\342\372\331\302\310\027\b\004\246^\013\332x0\325\330\315S\202\215\365/\204\235\206su\374\326e\273XK!\215\357\020\212\303\324b2YH\266u-R\261\367\024\361\3706A;zU8-\265\242\tag@\016\006`\243#\370\353\215[\313}\235\252\331"
+	.string	"g\0171\355\300\370\306\243\013k\240&\273\001\201\256&Y"
+	.string	"o\"\375\262WQ\256\226\256\201$F\177@\024\004\033\207Q\"\374\250F_\023\320\024~?\3230B\004\335\030\276\354\222gB@\203\204\021\326<\243l\352\217\310m\2413.>A\"\016\252}\332l\266\375\350\302\272\0245+\030"
+	.string	"\205!\213\200\236\265Q5V\221\350"
+	.ascii	"\334\227\242\017%\322\030\024*\377\013\224\321\321\252G\352+"
+	.ascii	"Q\276<f1\f\341TU\216\035U\001\260 \203\262\336@Th\265S\001V\017"
+	.ascii	"\002\311u\274\327\0025\275\255\361\216\037\323\327\027\331\315"
+	.ascii	"\247\307+`\256\244\321E\\\013o\263V\277\205,E\232\341\201 m\f"
+	.ascii	">C!\366TyLs\241\f\243`\025\346g\031%\235\266D\277\214H$\372|"
+	.ascii	"\037\210\265Hj\2563\017DQ\003"
+	.text
+	.section	.gnu.lto_isMixerUsingServos.115.b904e2787c2f03bb,"e",@progbits
+	.string	"(\265/\375 \372\335\006"
+	.string	"\002\315/5@o\222\016\233\016\217\276\254\273\226\356\202n\256\00559\330\rC\333]p\262\377\327\310\364\374\025\205\360\213\346q\206ab\202\375)\244\036H\325\332\262\330\332&2\005g0\230Eqi\260\307yp\330@4<\211\rC\304\313\\\330\303\flMh\256\307\261\254\353]\266,\222\020\013>\b\032\241E\304\206L\240\2024d\222\333q\305&W\255\325\335\004\320\252(\200\361q\247\337<\0165\276T\"\351w\243s\227\"0I\261(\311\024\235X\022\245\032)\375\235\277\234\240\3209\353\306!jI%$\262\222\271=\334hV\227\335~\224\362h9\321F\236\272\200\205\314\334i\243\213\216\375\r\376\203?#\t"
+	.ascii	"2\001'8\243\216c\261\250\360\\\303\037#\334\022\202\204;gj\347"
+	.ascii	"\023"
+	.text
+	.section	.gnu.lto_servosFilterInit.117.b904e2787c2f03bb,"e",@progbits
+	.string	"(\265/\375`\257"
+	.string	"5\013"
+	.string	"\266\325N?\020Q\225\016|\266\001\227\352"
+	.string	"8@\r\341\304m\230"
+	.string	"&\310\211\236)\021`E\322|F\357\332Fe\244\377\017\fb\355n\332"
+	.string	""
+	.string	"H\007+\004\"\b\022\023\251HUaU%\215l\"eJ\0019"
+	.string	";"
+	.string	"="
+	.string	"6\214\207\037\366\252\216\013):vWS\017^z\2774=\377Q\201|\240\347W\326\341\032>5\200\241K\262\2737=E (\363Q\331]\347\007r\270\343m#\260M\300\276\200V\222}\324\255O\347\3032j\341\251v7\264h\354*\256\020q\324\355\227\360CG|\023?yG\231E\346\031e*T3b\354\356\344\321\003\262G\311\001`\217\3277\260\307G\354\005\336$\344?\253zn\200\303\302\b\325\2227X\252%\365\"\2242lwG\261\311vC\005\374\023OM\360C<\272B'\377=\372\035\35415\272\250A\342\364\311\226\035\202RK\034\254\f\253\024\024\034\3308\034\246\313|\241t\033\207\303t\232\246\001\203\214\203\005\032\204L\202\007\332\205\3534J"
+	.string	"o\0210\234\246\3316N\213\204\237+\311\364c`\201\253\217\202.-\371\341! Z\247\234\\UdC\322\001\017"
+	.ascii	"2\003\006:\206\022\003%\217}OX\336\0053\240\313\2146\025O\027"
+	.ascii	"G\270(/W\004\227\037\030\345\250A\374\241\224\001"
+	.text
+	.section	.gnu.lto_filterServos.118.b904e2787c2f03bb,"e",@progbits
+	.string	"(\265/\375`\345\003\225\033"
+	.string	"6\263\262I\260\226Q:$ \363\242\030\207y\2468l\204\300\006>\322\002?\365\r\037U\235\340\355n\2002\251\274\260z\343\367\345\273K\253\247R\3204Ha\316\341\337\200\005\214m\315\210(\335_\242\356\355e\221\306\313>!d\023\271S\n\230"
+	.string	"\221"
+	.string	"\246"
+	.string	"0\373P\276\320\260\323G]*\367)\033y]Q_\304\344\004\334Rk5p\352\002\345)\316k\306S\361\263\361ta\316\331Y\002\fU\035\002\247\242\336\360K\255\225\2664\\^\024\336\343\314\235\034\251\270\345\314\371\344\202\227\357\247;)\222GHQd\277\236\250\243\245\345\305\205BstJ:\225\371\265\270(\026PZ\302B\366\343\2115Nd\\\371\360\323\35074\267Lz)\374<\372\365D\234Z\353\237N"
+	.string	"\007\022pNrA\255\325\323\367[q\277n\233\206\355\037{\201\004\273A\377:ZD7\312]r\317\370\355@U\2057\271l\363\034HOY+/\201_\365\037?~\323\251A\330\346}\247\276m<\375j"
+	.ascii	"VmI\355f\227-\024\232\033\324z\222\"\313\273d\333\224\3234\345"
+	.ascii	"\364\354S\267L\234\236)\247c\3454L"
+	.string	"\234\226)\247_\342t)N\223\344\364H\247\3518-\322\351\025\247\347N\037@\254F\323\357(\216\324\252\242+L\315\242X6>\365\333\367{|h\342;<`J\255\325&\254\200\351\304wx\\\002\264\n0\\\200\201\322\2047\271Lnl\337\033#\2630\035o\222\213\372L\213\212\311\022\231\375\020*\345\276v\305<]I.\3527N=\256(A\235G\222\334\024\345:\nc\005\352\310\2210h\340`\336\007a<-\227\314\001\264\332\222\032\227\334\305\322\033s3\351\332\022&\214\367\215\213\303[\235\003\314]qm\n\025\346}tq\206Vg\277\b\356>,\013\367\301D\344W\0270d\310\260\367%\315\335]1D[v\263\253\303\205l(k\255:~\220[q\330\251\325\306\323\271\027\376\301\027`\220-\254\335\354\332\255:\332\272\n\366\311\301\371\004\355\330h\"n6\333\255&\300>%<D(]\313\301\335H"
+	.string	"\361\340hA>=?!>\320D\374\354\330h5 \034-\347\306\267\021<@\264\240\333\r\210\006\023\356\276KO?\212'E\262v+Dn\3203U\250\315\322\032\245\201\313\326\310FF\331&I1C\327\005\312\305Zk\0357h\n9\304\331~\370\027\214+$)Z\026\2664kd\037\270lm\366\206\252\250\212Hif\355dC\rS\326}\\hvF\344\002ZQI\251\242\257\215\355l=\211\274\b\315.\317\246\0331\222\304\r:\266\260\375\360\023\310\"G\250Q\034&\2312\004)\"\024\210\310\214\226\354`\002)S\270\036\021\320\255E\264I\261\264go\277Hm\032\\\234\200\262\315\021\342\024\025\254\345U\221'\374X\265G\314)\321\307\332\323V\032\346\261*e,\324Em\005\260\265X\303\244Z"
+	.ascii	"\371\304\002\207V\t\325\253\262\034\301\222\241\217\317\374\226"
+	.ascii	"\231\265\2518\344M\231\347\261\240\006\364\177\305\224s\260\307"
+	.ascii	"\025\036r\310\237\r;\351Y\254\315\243\346C\262\201\2058\b]\362"
+	.ascii	"j\301G\213\343.\314\036\243\351\231\027`\001\230\265\001\236"
+	.ascii	"\234\366\037\306\223\211>\026<:\276\036\376"
+	.text
+	.section	.gnu.lto__reset_template_82.1.121.b904e2787c2f03bb,"e",@progbits
+	.string	"(\265/\375 D\325\001"
+	.string	"\264\0027"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\030\001\177\344\031\001\334\013\320\017\350\007?\202\210\200(\177}\277\001{\276\001y\275\001w\274\001u\273\001"
+	.string	"\005"
+	.ascii	"@\260\312\021L\273)\255`\240\b"
+	.text
+	.section	.gnu.lto_servosFilterInit.part.0.186.b904e2787c2f03bb,"e",@progbits
+	.string	"(\265/\375`7\002\305\022"
+	.string	"\366\243{H\320\362&\035\253\"\342\032\371\300\275\216C\030\036\227\002\206}\2017\006\245\277GI\330v\352\312\004\335\\\274f3Tc#\240&\215\2122\203G\352$\372\222G\240\025\030\301\262wy \206>d\200\374\216\"\226\354-wJ\001b"
+	.string	"l"
+	.string	"g"
+	.ascii	"\335\247|I\367i\233\023Y{\212\260\330]V\364\207`6\213\365y\027"
+	.ascii	"\266a5\307\354\037\017\203\366J\270\r7\334\356~\237j\302\336"
+	.ascii	"exk\214]j\2341\377C\007@\263\335\\\312\025O\r\212\304&\223(T"
+	.ascii	"@B\374\366\270c\303\211:\262\302\303c\311\347*ew\355}\270\273"
+	.ascii	"\333n\261\335\300\2165\001\321Sv\321:\243\243\214\376H\3649 "
+	.ascii	"b\227C\216\310\226\230L)~\364XK\202\271&%GG\203\244\221\013_"
+	.ascii	"\340V\026\232X\306g\330\270\246@\030\324a\225\203D\221\023n7"
+	.ascii	"\374>\035zj\3376\217a\001=U\376\321\211\374\233\021\314-Y\270"
+	.ascii	"\266\332\207|\243\360E\261\303p\223wS\363\222\224\206L\355\256"
+	.ascii	"\311"
+	.string	"\247\023x\237\255\017\bn\315\364\306\376\023\006\222(\232m\232;A8\211\332]\024\034o\212 AE\245\373\234z\032\210\250\252\3671\233\362\312\231X\274]\331\002\377\306\227\\|\241O\277\270\\\335g\324#\235 \362k\334\006\005_\3101`<\355\323\007\273\317\353oG\360T\325\302\007'\346\254W$\236 KQ\201\254\023\205j\246\302\372cw\253\206\311\320\302\3003\313\211\fH\363r\221\371f`^\\\025&|\026\\+1\037\313K\346;1`\360\202\313\353\233\001\301\327\307\262\035\257?\266\177\235\0366\0368\232c\225\n\344\211b\232<\200T\354T\352\216m{wS'5B\031I\311\242\020\353\345\356\256*\220m\005\227\332\351u\344v\314F\344\304\234\t\304\253\252\203\007\361\264- P\002aN\033\033h;\332Ii9x.6\217\207\355Xj\357\"\242U\226E\306\230\223\247c\234H\033d\357\201\266"
+	.ascii	"a\335Ij\357\261\225\225\023\21187\342\217\213s\201\343\206\337"
+	.ascii	"\004mI\260\217i-\030\354l\226\330Uo0\2266\227\300\314\007K{\244"
+	.ascii	"\253l\277\315\n\257h8n\274\353\203\346\232\350w\3151"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b904e2787c2f03bb,"e",@progbits
+	.string	"(\265/\375`\023\005=\030"
+	.string	"\326%\215I\200ZN:\357\256\267\371\t\316\302\370_\376\300y.\202C\327\325n\213\234\2110y\016\221\320\030\237\324\377\366\r\033\321\033\024J\021\013\342\222\267\310%r\211\312h@\247bX>\036Q\367\037\310P\307\002\373f\372$]\022\231\002w"
+	.string	"~"
+	.string	"v"
+	.ascii	"}9\334\314\221\306)\264\r\366o\246\206[\311\3604\030\354\311"
+	.ascii	"\\\270\362\354k\341Y*\360\324I\341SN\004\327\"\304@&\360/\210"
+	.ascii	"\251$\260\217\b\334#e) \006\236\0208\212\355\201=r\307\301\321"
+	.ascii	"\234\r.\266\245lc`\317f\376\351\347X\316\253\2527\211\217\375"
+	.ascii	"\030\263\177\376]\337\223\347\017\022\310\325c_f\252\301\256"
+	.ascii	"\337\376\304+\006p\357\275\013\354\211\346\177\234.3.\005\351"
+	.ascii	"Td\274\312y\364+\347\357\244\304\264\204tT\2444t\224\244\340"
+	.ascii	"\374\2132\372Y\321\273\304\370\221\350h0\276\345\305\323\\\334"
+	.ascii	"x\366\035:\227\026\366n&\013\3732+X=U\330\267\231\007\250\204"
+	.ascii	"W)\354\305\230(\370\236'\356\205\211\270A\221\231\260\017S\342"
+	.ascii	"P\210\3004\022\366`F\274(\342j\316\020\366_@\330\257\335\256"
+	.ascii	"^.\227\313\017\366j\246\007\276\332\271\252\372\353`\271\313"
+	.ascii	"\f9\315\303\017sZ\367c\003H\274\204<\310k\036^\310kVyg,~\345"
+	.ascii	"x\3354d\3262\362\026\344\301\\\367\326\002\277/\311\365\356\310"
+	.ascii	";1\245\222\013s\215+\213\302J\317\306\255i7\377\270\231T%\311"
+	.ascii	"\200\270\235\354\227<,c5Y\256\332a\331J\207\375\032&\313?\226"
+	.ascii	",C)Y~\342\377\346\275\367"
+	.string	"\327\311a\177\206\223\216\243\347\206\217\215\217\325\370\023\032\217\022g\225\177\220@\256^\2026\0222o)\333\210'\332DJ\"\225\315!cj\206\215\266\3161y!\332\275#\233kX\226V\2126\201\225\373\210\231\224Y\2126\357'`\335\351\2067+\343\004\213\250\245h\333\034\031\007\013,\231\242\035`\305\r\371aYk\223\024\355\240\034\264}<\264uF\266)\236\025}<}#\344\001kVN|<-t0_\363Q\247y\375\3525\037\275\002j\250\201\214\002=$\"\243 I*m\300\002\241\251\342\034\021\240,\251\225\032\221\tJ\232\024t0\246\260hN\264\302'\331\303\0067\357!\246r\312{KX$\033\252R}\2470\254\353\301\013W\310\375p\nI\241\262\230pB\220\022b1\235\265\301\371\231Z\252:\245*\350\367\240I\265\005\335\343\1772\311\235XOP\237\035O=\n\255\177\321\030\245\021IG6"
+	.string	"\332\255\210\221\3107\377\360\225\247\002\345\324\362a\230.\256\221\2257\206E\f\230\273"
+	.string	"n\026.5r\016\325\226\314\270\031\024\241\351\267\244\312\022,f\313%\232\320\241\001h5,\325\017t\247"
+	.ascii	"7\273(\213\262\254&[^\270\361\032\215?/\246,\214>g\273\220\277"
+	.ascii	"\310_x\234\255\254\006"
+	.text
+	.section	.gnu.lto_.refs.b904e2787c2f03bb,"e",@progbits
+	.string	"(\265/\375`\326\001=\017"
+	.string	"\246\243dA\020\221\222t\030,\244\n\017\303_\016\267\331\316S\313e(\004\255\bE\360\030\024\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\240\346\030\021\345\335\342\177\220\315\335\007\360\017\364\315\242\266O\232m\326\332f\255%\255\355\266e\nQ"
+	.string	"T"
+	.string	"P"
+	.string	"\227B\016\0347\336o\243\006\215\353\237\221}\0310Z\2500\001\343\376\020\356%x\036\202\373\226\317\217\254W\261\036\305\363\233{\022\316\217T\037\352\274\007\347\263\352?\235\367p\276S\375f\363n\363\271\371j\316\254\234\356K=\341S~s\tO\304\366qE\217x\277\210\354\277\344O\260>\302\373\007\331Y\362G\331U\362S\336k\326\233\274'\t}H\366\217\367!\367Y\366\357\375\225\335z\357q_e\237\001\355arcP\234 \221}a^\\@`\337\017\036\262\267\003\207\r\032\3367\003\206\013\035_\013\035\275\025\256\003WW\247\266\237\260\236\333K\240\357\311\001\2523X\247\260\237\264\237\256.i\217\027^\254"
+	.string	"\334\234\354\232\223\236'\035MJ\246\373&i\306\375\224=\276G\362\004\301\221\372\212\034\"\375\262W\3575\357'\020\\\312\017\352c\274p\301\"&E\376%\254\017\217\016\220\302\006R\013j\310"
+	.string	"\213,\370pEZ\200!\034\341\245&\320\001}\027\320\217\362E\371Z~I\276H>(\037Ky\213\372*?\223\002<\177\266\357h]\263\365\324:jEq\n0\001\"\300\003\250\202\006\260"
+	.ascii	"n\356\021Q\017\021}H\324=D\377\001\035& \300\"\302\022\017\032"
+	.ascii	"\306\351Ibl\r\232\373\306H\336\336\314\223-zMt\244\3672\271\355"
+	.ascii	"\030c\230\210\273A\372gpj\006\263\2234\006\247\301b\302\266k"
+	.ascii	"d%\250\225\224vfcw\203 \023\332\226v\314\330\006\231\320\234"
+	.ascii	"1M\330\331\030\r\253G\001"
+	.text
+	.section	.gnu.lto_.decls.b904e2787c2f03bb,"e",@progbits
+	.ascii	"(\265/\375`8PER\001\n<\202{U \fQ9\351.\t?\223S<}\346\242\177"
+	.ascii	" \356\351\272\362\247G\320\217+\336\271g\305\177\344\253\377"
+	.ascii	"YR>\302z^\006\234\302\254kF~\305\t\327\3502\033=\255,\276\302"
+	.ascii	"\374\332x\255\310\355\005\355` \r\240$n\272\246\033\003\034e"
+	.ascii	"\376\214XB\366\226;\005\246\006\250\007\312\007-\326d\326\331"
+	.ascii	"R\232\371.\322F\216\273\206\226\324\323\316\321\210a\345\206"
+	.ascii	"\3629\225\343i\235\\iuT\f\034\035UEgc\306_\364C\016S\207\345"
+	.ascii	"R\207\231s\323\316\345\330cv\330_\344\303\242\315\231\303\252"
+	.ascii	"b\266\224\036\322D\274\326<\355\234\f\252\020\277\235[Z.z\314"
+	.ascii	"\216\202A\247\303\006\327W\3243\347fG\265\224\246\342*\373\213"
+	.ascii	"\204X4\037$P~\022\303\206\231s\363-\365\333\271"
+	.string	"\226\322[\027X\262\021\033\313\271\311\201\210\003\326\022D,\r\001\270\345\354P\332\201\025J\217\202Q\233\b\232\357\310\036\325]\343\243\\\324\243R\324\243c\352\323\354PzT\210z\024\207\372-v(m\036\375e\235\033\032\354\335e\255\374\007\325\314\316\234\233??2mp\2445>:C\275\335\220\376\354\355\355\355\331\r\351Q\030*\266B\351\361\235zlE=\036S\217\301T\"\fC\375\325S7\334\251\277dT\021r\352\257\026\365nv(\375eS\177\235\250\277`\352/\225\372\316S\337s\352;\213\372\236\242z`\207\3227\231\212A+_8\211\261\245l\334/\240\032\214]\016\274\3066\255\350\355\342\272eqA\247EC\241k\212\354\271i\334P\177'\373I\303\223\\\263\261\225\263C\251\005V(\355\\\364F6\221\264.]\032\367\354\325I_\350p\202il\353\274\255\325\2507zs\032[:E\267z\r"
+	.ascii	"\302\203\254\361\315\233c\233\313%zqn\347\374\026\317\312\261"
+	.ascii	"wv\231\301\266X\023cN\343^\332\241T\003+\224Z8E\267q|\256\226"
+	.ascii	"\234Mi\034d\337\324\2516\262\362\242\270ic\303\354a\255u\233"
+	.ascii	"\333;\273\314\231J\3169\303\317\033d\032\231\306\226\215}Z\247"
+	.ascii	"\006k\227\177\354]\330\323U\343\267\021\025\0059[\r\251\335\333"
+	.ascii	"\263\032\322\337\256\321\340SbE\007\230\232\013~\232Y1x4\376"
+	.ascii	"m\0324&\236\315)\215\317\354 \315\276\2664~\363Po\2374-\332m"
+	.ascii	"2}R\274\322\374\226\316\232\261e,\031\353\264u6\314\355\234\025"
+	.ascii	"#\245\316N\211\202\346\203\277\350\266\316\272Y\271\333t\243"
+	.ascii	"@\2243O' B\330:;\306\242\371 \233\271\312\347\245\006\213I\304"
+	.ascii	"\201\003\007\037\037t\200LY\300\267gT\233\355P\n\024\247\202"
+	.ascii	"!\262o\200\024\251\323\370vM\375\007+\250/\316\250<sn\336Z\371"
+	.ascii	"\213\342\354\233\205\273M\346\357\305\027\3333\347\374\337z\261"
+	.ascii	"]\354\027\353\264q\026\313m\233\225\362n\346\f\225s\276U\373"
+	.ascii	"\213n\343\354\025\313v\233n\031\352i\356\203.50\364\360rnr\340"
+	.ascii	"@\304\001\265\302A\367E\305\277\325r\013g\271\244\2203\250ZP"
+	.ascii	"SY\215\267\340,/_C\032\337f\2516K\321\255\026\241\324J\253\231"
+	.ascii	"\323r\316?\002\250\362f\245\261\317\n\245\267U\352Q\240~I"
+	.string	"}\n*\006v(\375\007T\036+\224\3325K\305:9\260Un\323\254\332\321d37sn\3764\020=\265(\215\177\202z\313Az\367\366,\007\351G\250@v(m+\224^\316\016\245\326\314B\261\316\013\354\331A\204\370EB\311e97\177z\352,\251\223\327\370\"\324\333(\3170\227C\034\203z{Aj\367\354\005\351[\375\323\016\245\307\263C\351o\233\374\226\211-\343\340*\247\2269-\347f\220\n\265\302ZY\3437\355P\252Z\241\364\277!\242\354\006W\371\333:\033\274\370o\013\013\340\035\266\305\323\323\377\266\345\024\374\367\003\n~\253\3677\005\356\t\376\333y\340\267u6\270\006?\256\372;\203\233\242y\276\301-\374X\307\337(N\200\177\234gOd \177\377.\tm\3552\270)\356\212[`{\374\001?~\262<l\376/\007\230`4=\3756\371_\017\\!\023\374V\205\005\301\337\037\234\370o"
+	.string	"J\360[\f\374\266\003\277E\341\357\235\253\302o)\360\341\262\260\351\337\033\256\367:\327\351?\007v\357\256\370[\205W`\203\f\334\343\317\354\354}\n?\026\241\202;T\361\272\fn\n\333\343\006\370\261\231\f\370\303\177\177\226\376\333\335\023\027\264\n\025\370O\364\263\013\3758\001\266ID\372\031\013\025n\301U\372\217\302\001\360c\272\2773\270)\376\036Z\247\267{\242GpW\025\314P\370"
+	.string	"~l\345r\240S\334\021\277eaU8\372\177v\344\032\375\302\217\325Z\303\035\300o7"
+	.ascii	"\332%\r\374;\205\033\202\277\321\013\202\277U\370\217\202\355"
+	.ascii	"\361\377\354D?f\002\365\337\017p\360\337\r\264\007\224\374\266"
+	.ascii	"\305\177=\320\003\260<\332w;\360\333\024\374\227\003\277\205"
+	.ascii	"\373;\001\267\304-\370\237\341n\340\277':\003\032~,\344\357\021"
+	.ascii	"\334\013\\\023d\\\013\334\n\334\022~\333\366[\266\277E\020\364"
+	.ascii	"c.\177Ki\370\373\006\003\376\226\372\3607\022\375\273E\017\007"
+	.string	"\177c\375V\305o\215\277=\376\266\351\267L\277%\376\266\370\333&\332A\204K\302\216\377R\300*\257\b\377;\360\337\177\327D\334\022\227\004\222\024V\005\264\367\374\250\332\3771\377\311\374\257;\334\177/t\377\301\034\315y~\314\301\337S\376\256\3627\225\277\325\376\226\362\367\332\337m\317\026\373\373\354o\347\337B\377\215\300\377\237\037\365\362\337\020\376\013\302\177=\370\357\206\377b\360_\013\376\213\341\277@\377\335\371;\316\337o\376n\363\367\363\3575\177\223\371{\314\337q\177\303\375}\345o\267\277q\374]\343o\032\177\313\370{\352o\027\177'\377\266\300\337'\370[\305\337\307\277\213\177\017\377V\372;\351\357\024\177\037\375\215\342\357\340\337 \370\333\003\177g\340\357\023\177\233\3607\t\177K\340o\021\376&\361w\b\177C\340o\007\374\315\200\277E\374\375\301\337 \376\366\340\357\016\376\346\360\367\206\2777\370[\203\277\t\360\367"
+	.string	"\376\276\340\357"
+	.ascii	"\374\255\341\357\f\277\245\373[\350\267N\277m\376\315\363\367"
+	.ascii	"\316\337\277\277}\277}\3617\372[\030\377\345\374\267\373\177"
+	.ascii	"\367\277\312\3773\177\337\277\355o7\370m\235\337\226\371m\227"
+	.ascii	"\377(\374\226\313\377\263\337f\371\355\333o\261\374v\205\337"
+	.ascii	"B\371\255\331\377\023~\373\344\267C~+\344\267a\277\375\372\255"
+	.ascii	"\324o\243~\253\374\255\n\277\r\301o=\360[\022~\353\373-\376_"
+	.ascii	"\347\177\t\377\347\374w\363\277\315\1775\377\323\374G\363\277"
+	.ascii	"\354\277\n\377\273\374\037\300\336\336\336\336\3173\342\347\311"
+	.ascii	"\372E\234\b<\234\230\207e\033\021\266L&5@r\205&\016/\347-\035"
+	.ascii	"\032\t\2313H\343\367\200\355\330\201\273\232\\\341\2569\261!"
+	.ascii	"S\032\277\207K\265N\254\303\316\031\021\266\314X\030\034y\262"
+	.ascii	"\021\303\313Y\253\003\017\322\205\036W\343\367\314\300\201\303"
+	.ascii	"\242\031\021\226\363\025\001\330 w\354\334\210\311k\374\036$"
+	.ascii	"\027W\r+<d\324\037o9\361\226m\243\266P\346d\021\r\224\330iu\370"
+	.ascii	"a\343\006\214L\216\006\r\\\303\346\234\263VF\332\205\330\nc\265"
+	.ascii	"\341\307Y\326\211k\240L\2564k4\346\251\202\2510\025\226\001\224"
+	.ascii	"\237\322\314y\376h\321\371\360\202\261\216e\374\350\322\232M"
+	.ascii	"\032\377\r\276\372%\333h\341\300W\330\nG"
+	.ascii	"\r\244\332\231,\345\243\b\034\256\262a\210\314 \322\326\370<"
+	.ascii	"J\324\346\216[\016\265\031\215\261\224\006\013mkZW\215\317\263"
+	.ascii	"C\305Q\007\021\"\2279\321\354\360\322\370<X*~!F\207.7>OV\303"
+	.ascii	"p\213\037\261*\036\\\032\177\307\215\372\343'\353\304O=\347\247"
+	.ascii	"\314\031\013\001Kv$\211\303\313VV\035\2763\207\221\277\245\215"
+	.ascii	"(\311\306\337\201\303y\257\216\034=-I\032\353\251U~x)i\374\235"
+	.ascii	"\2655U\236v\016\r\227[\331\031'lEj\252t\324\335\227g\222*f\336"
+	.ascii	"f\345\322,3\013\3333\315\333|~9oa\342\226\361.\234;\347\346\335"
+	.ascii	"7W\316\245s\333\3348\326y\335\\\273c7\227\315\333|\240\2329\210"
+	.ascii	"\317\214\025&N\3608\354h\271)\3530\340\357\004Q\277\203C\375"
+	.ascii	"\216\r\365;5\324\357\314P\277s\245~\207J\375\216\224\372\035"
+	.ascii	"\245\372\235\026\352\355\022{\275\374\222\271e\256\322f\027V"
+	.ascii	"\031\360\372\361\314V3:\334\302\235\372\373\345\202\371\225\273"
+	.ascii	"\334\245Ss\316\310f\256\":b\227$\016/kim\360\301p\262\205c\314"
+	.ascii	"/\335\327\364\334V\025\227\306\177s\305\374\377\371`\345\210"
+	.ascii	"\361l1s>k\336\222q\302\334\027Y\215R\323q\025\246\353\370\220"
+	.ascii	"\021!\322\242\361-4\325\377\366\375\2479i\225s\306B\233\331\352"
+	.ascii	"\211'\375\355-j\355\206\277\307^K\200\377\370\357`E3'\311\320"
+	.ascii	"\3119[7\352\221\266$\027\006\031\225\313\031\252\0139\242\353"
+	.ascii	"\n\252\253\206\322\331u\025\244tve$\324\020d\220U\356B*\2359"
+	.ascii	"\007AA!K,\257\224\316d\016R:\363Un1wes\263\013\231\241\2269("
+	.ascii	"C\345dv.\2570PBu])\235\311\253 \245\263\353*;\2732P\206JZEAe"
+	.ascii	"\253\240\354\354\262\313\316\345\025\220\322\271\274R:\273\202"
+	.ascii	"\330'QG\230Xtt\276\326l\021%T\246\212q#i\005$\247l.s]\3166\315"
+	.ascii	"E\266\312r9\023 \347\033K\253\272d\r\353\366$G\365D%\271\264"
+	.ascii	"\315\234\263\206\030O^\313\f%\207\264Y"
+	.string	"N)\266\314Y\354))\307\3109g\004 \233r\331\207\225C\362\270\221\247\\\344\f\200\334\3149F\316H\233\345r\316\310\234\263\317\352F3g\033@Jf\214\0309k\021\305\3107\220V\\\344\334ig\334\256\224N\257e\221\0254'3\277h\"\255rj\231\231\271\256\313Ju\"\315\362T\316\331\266Q\231W2\356\032\337\202\013\365\277q\267\3133k\214\035\372vf\303E\343\313eg\314XW\233\306\377\311Q\267\374&\263\274\264ii9YmK\312Q\201b\326\374\241\361\221\365\006\305'$\b\233'\226\025P(aM\312\334\263\337\025\376\213v\245\334+<W\314Z\023\266\306V\272\tR\371\246\361\177iT\266;\345V\361R{\346\334d\273ib\322\260\230cn\267\315:/\333U\343\300\201H]\252U\255\245U\250\320\301\001c\f\357\007\006V&\257\365\032\266\252\354\243\361\177e\324\377\340\324\377\326\324"
+	.string	"\\\246\025J\257\263\350\367\214\247M\235sIc"
+	.ascii	"D\271\303av\300\371\001\345fn\311\260\026<cl\270\261\322\315"
+	.ascii	"'s\236\344\031i\374\344\377\257\023\236\245U\206\272+c\346\254"
+	.ascii	"q\22308\312\247\306\377EQ\377\337%\227\3542\261\316[v\215\020"
+	.ascii	"5s\246R\304\007\363\226]f\331=r\3074@R\004\b\023/\347\346r\215"
+	.ascii	"\032\235\212\377;\246\344^\251sg\3278\211X\330\335\n\215\377"
+	.ascii	"\343R\221\\\261\226a\306\307\232\306\377Q\251\377)\325\377\262"
+	.ascii	"z\365\215z5\215\372_\"\033\344\220y\032\033\"\344W&\005\226u"
+	.ascii	"\203X\347\025r\201\034D\210\333\246\220\373\303\242Y9\255|\313"
+	.ascii	"\204\001\3332\226s\223\210\303\016[\030\035\032\030_=S\2576}"
+	.ascii	"\204)\223T\345\3067\354\366\300P\226=)\026\"+8i|5\211\372_00"
+	.ascii	"K\272\226\215/\217\233c\311\363z\335\035\267\353~Y\347\345qg"
+	.ascii	"\374\352\270\313\0235c\334+\021.\254~T-\312\236\227\307\305A"
+	.ascii	"Vvy\\\254{\303\202'eNza\240\205\311F\354G\207\016\034\231\005"
+	.ascii	"l\233v(%\262B\351U\037\352U.\033\227k\313\367\303\314\013\270"
+	.ascii	"\306W\2256\266\222\336\224iW\353w\213\355\207j\356\313\214\306"
+	.ascii	"W\306\255\361\377\347#\222\203IY\215\233\005\2476eI3]\322\251"
+	.ascii	"\203c\235\227\306\235\321\314Dx\205\263\270%\215\357\203\243"
+	.ascii	"\376\215E\373\377C\275\340\244i;s\255\230\314\030\223k|\237\026"
+	.ascii	"\365\326y\253.\325\220\346\225\026\215\377\277\371\245B\343\311"
+	.ascii	"\026\354\230\271\032k\322\370>)\352\177\247\256\024\326#k\"\343"
+	.ascii	"J\331;\373c#K\b\f\242\0364t\274|i\374\337\250\253D\301$Oi|_4"
+	.ascii	"-p\021\343bF\343\373\310\324\3332:p7\331zmf\354\335\323\026f"
+	.ascii	"\316\271\350&{\214\275\363\342\362\274\371\"\257\213\373t\241"
+	.ascii	"n\013\353\274\311\256\203\2339C\315@\323%\354&{/\356\231s\366"
+	.ascii	"9\271r\023\306\007\337\327C\275\317\206z\037\f\365\276'\365\357"
+	.ascii	"\2749T\234l\312\204y\317\371{\256\305\264\234\024p\230\023\256"
+	.ascii	"\2551\336e\223\225\244\252\361S8\352[\212\215E\023r\346\207\231"
+	.ascii	"\256\003\302l\033c\202<\325\350x\306i7\375\246\341\264]?\273"
+	.ascii	"\215u\366]\257\271\315\3225n\321t\335\223\217\020}\327i\302\260"
+	.ascii	"\230x?\252\263\344\023\020~z\247>\245S\237jQ\237\256\251O\321"
+	.ascii	"\324\247M\365i\231\332tM\306:\211\272\314\334\023\325\215\306"
+	.ascii	"O\221\250)\310\226(\375\236%J\237\026Q}\331\016\245\177Z\241"
+	.ascii	"\264\345\212\336a\322:r\244\322\032\377X!0_\016\260\202\020\260"
+	.ascii	"\306"
+	.string	"_\376\216j/o\353\224\316\006\025\260\306\235\355P\034\334\316\024f\033\266\306m\375\346\223\004\312yH\333\263Ks\261\316\206k\270\326\322[\254\\\030&S{\346\2349h\340\200\247\340y\301\245[|XX\314\2564~*D\275U\263R\205\331X:K\257`\235\375\3667[KYq\263w>h\316K6f\316\371\037\364[_\261w>\311f\266\262\340\243y\267\005/\347\314\201\210\003\207\242\223\257<\025?\255R\237F\251O[\250G\353\250i\025)<YYY\310\306v.\313\262\371$\2012T\213)f\316\315\242\267\224\366\352\036\327\314J\225\022%\357\331@\376\242 xvn\007\035\346\007V[\314V\322Q\332\254\221t\263\323\032J3\351%}\326T\032\255\217t\222vv\223v\322c\255\326k]\326OzJ=o\316\344\234t\217\364K\025\2359\215\237\201IVVz\303B\311U\t\300\312\263\032\263"
+	.string	"\265e\227\203\353\351\2157\237\0213H!\215S\033\177[\242\265m5N\267vl\364\220\261\3268\325R\363\324\236\214i\234\326\310@\003\013+\235\201a\311\\\0348>b\300`H\2452\236\316\300y?OH\202TI\216\251\241\333j\374\n\314\2441\322\030\251\225\205\222\253\254\024\035R\033|f\344\2605\253\2543\265\372\033\027em\215S*\213\266\325\214z\276\r\t\333\222)\215_A\027U\316Q\275\337:Q9\251\324\025\303\223\221Pr\225o\215\f\216\026^Vjm\360\221b\323\365\325\370O\241\236J=\205\001\"\304\325\f\301\320\320\032\247Q\267>\332\240)\033?}\221*\377\337\257H\032*u\032\277\20225uq"
+	.ascii	"\034sv\320"
+	.ascii	"i\374\264\305\377\237\205\2609!H\032\267\375[\232>u\214+Hp4N"
+	.ascii	"\223g\363\377\327C\305,\354F\343\277I\221\377\177\367\213\227"
+	.ascii	"\230\247\306h\035t\317:\337%\315o\376\370\\y\241\326\245\361"
+	.ascii	"+@\242\336\276K\232\002\373.)\232w\224\316\377\373]\311\361\325"
+	.ascii	"\325\370\025\bQ\177t\316\377\363M!\303\305l\374\n\302\324W\260"
+	.ascii	"#N\234\3561\"-'\2576\274u\335Y\005\t\221S\322\370C\3177op\036"
+	.ascii	"F6s\025\206';\356r\024\271Y)\033\177(N\375\321;\364\016m3\"-"
+	.ascii	"c0.XL\274l\265\245\203\217\332[\234+\215\3216Cl\352\217>\321"
+	.ascii	"\247E\203\223Up\024\266dZ\343\0175\251;\272\246\016uK\255R\310"
+	.ascii	"kn\360\032J\031\335\227\306h\032T\r\2323f\206\302P2=G\252\355"
+	.ascii	"\236\024\231k\374\241\251/G\307|!\213\302\365\3232\2032k\214"
+	.ascii	"\316\241b\302\310\201\261S\1774\016\215\303c#\302\200r\366\202"
+	.ascii	"K\327\344 C\323\005\313Q8,\250\033\n\027?1bp<\263\325\215\016"
+	.ascii	"j\226\027'a\215\321-(\027T\013\232\005}\303\200\246\376\350\025"
+	.ascii	"\364\n\206\201o\3169\322\270e+\255\016\226\310\027\r\031\215"
+	.ascii	"\217AL\307Q&Z\0045b\235\250\016\324\255\350)'}t\240\304\212\245"
+	.ascii	"\332\202\023\326\270\315'\265\265\226\326\370\030z\250\267eG"
+	.ascii	"P$u\317$\250X\031\230%(\023+\0276\"I\3343\347f\023\364\314\312"
+	.ascii	"i\001e(\2664O5T\t*\346\203\f\312\231\307\027\346\032\312\206"
+	.ascii	"VA\247\240i(\025\353D\325\320\262\243EP#'B\325\3201\313f\345"
+	.ascii	"\302F\224yy\346\334$\363\206\210\234\017>r5\026<)'\340\344\314"
+	.ascii	"\023=C\235\240N+\247\325\314X;U\214\314\315\300C\321P)\326\211"
+	.ascii	"\236\245i\350\3113\203\347$\305?\352D\243\270\301\340z\321\030"
+	.string	"\205b\235]\244x4\276\020\034\365G\233\326\211\232\2750\2427\2441\372\344j\242\2200\244\204\332\250\027R\243^HNE\311T\272'\216/\215/\004\247^(\213z!+\352\205\324\324\0139\325\037E\202\2129\341\334|\021k1^\246\236\032_\250\251v\323\016\245\033\254P\212\006A\207\240D\376\337\017\231\033\330Z\343\013\215\251G\205\374\377U\340\007\230\265\306\330\376-E\177\034\005\362\377\272\013\021f\214\306\027:\242\036\rC}\374?\237\272!jf\215/\004D=\332cm\317\315Vc\024Lu!\204\203\003\0138\330tp-\217\202\375\235\321\035\350\227\n{zq\032\243^(\217\243_h\027\372\205\200e\316I\364\353\207N\316\311\037k3\2606\003L\346EdJ\212/\244\245\276\316\016\245\266\255\350\350r\347K\226\347\223\306\027JnY'\272\205\342\370\n\273f^T\342|\2407~\324\006\312e\353\310"
+	.string	"\362\325\3706\355P*\302\256F\r\2559\0324\266\\h\243\262N\224\n\2251\001\240\234\275\352v\260\256L\025\271:\212\365\243U\250\325E\02375\244qw\025\035\275\302<\340T\031i\334Zv(-"
+	.ascii	"\231\322:Q%:E\004\224\363\027\023&Z\307\206N\016\214\243R?\032"
+	.ascii	"e\237\264\034\324\n\213\n^c\020EGa\214a\331!\247\261\217\025"
+	.ascii	"J\177\301\007\ne\235(\024\352b\003P\316^r\230\331jF\207k\326"
+	.ascii	"\363\002\fN\025\332\242\345\244@\306G\033\234\306\277pc\317:"
+	.ascii	"\361\036\232$\312YF\007V\212\314\350p\315R\3202\006\315G\221"
+	.ascii	"\347\031\223\2342\323\270\250\350h\266O\362\314\2644\376\005"
+	.ascii	"*<<\2547\201!\365\215K\223\257\306z8\257\310\021\257\251\306"
+	.ascii	"8\257\361\034L\3478\017\3139\210\020\347\201\302y8\347\244\265"
+	.ascii	"\031\370X\233\001\372&$\031%\305\277\240T\037\364\006\016\034"
+	.ascii	"\213\206\221Pr\225\205\027\227\206\233YZ\343\007\231q\343\006"
+	.ascii	"w\231\001\303\314ZZ\033\356\0242\013\254\361\203\274\340'~\342"
+	.ascii	";\r2R\262\271\264%\330\356\370.\017\316\024$Akk\326X\264\021"
+	.ascii	"ZK\344\035\006L\212\240\211C\273\340\304i\3423\326\211\317\340"
+	.ascii	"4\036pA\336\350\360k\216i2\206\321`\035sd\274\3011\314\370\230"
+	.ascii	"\022\253\253\323\273:\361\245mI\343\007\351 C\246\347\250-\224"
+	.ascii	"9_\2118R$\203*0B\032?\b\211\307\3401\270K\016\262g\264\330\372"
+	.ascii	"b^\346\337&\220\223W\036,)\222;\374\030\314\301\3400X\"\230\230"
+	.ascii	"\335\350\340\323BgK\013\313\241;\332\350\005iR\231\342b{k| :"
+	.ascii	"/^p\227\003\244\374x\206\021\362\246\243\361\201\340\324-[p\227"
+	.ascii	"_\217-#\031-.0\334q\227\277\2251\325\350\032c.\177\353\362\305"
+	.ascii	"KG\343\277\371\333\377\037\246a\205\211\227\306\007Z\303\202"
+	.ascii	"\005g\371e+\r\300\204I\307\362`h\301o\307Y\354]\217\232\031;"
+	.ascii	"\316\340\376\377\354\024\275/2\032\037\250\353\312\225\3561\""
+	.ascii	"m\231\304\322\340I\221\273\034;N\324@\2255>\220\025\033vc\303"
+	.ascii	"]i\316\266\271\254\262\312ZV\033\332\332p\227\315V9k9\240\r\357"
+	.ascii	"\231\265\2646$\361\310!\246\361\177\366\324\377\224Q\177\254"
+	.ascii	"f\235X\rS\271`E\0016k\236\331\312\252\003\225\037O\301k\267N"
+	.ascii	"g*pT\215/d;\224\366\322\n\245\377\351\"E\n\356:P\316\371)\347"
+	.ascii	"\0348\322\253+6\365\307g\370\f\303\260\231\351\233\362\324\344"
+	.ascii	"\t\247\313\034\235\306\377!S\177\034\345\326\211\243`\027\030"
+	.ascii	"\nJ\276\332\211\021&\211\217\334Z\232e\343\377\37003\303]`\354"
+	.ascii	"~r\250?~r\353\304O\260R}R.\263\214\rZ\320+cBh4\376\017\225z\\"
+	.ascii	"fo\232\363\246Y4\242\214\274\303`\311U\263\303\255EK\177L\206"
+	.ascii	"\2750\223+5\"\252\250\211\331OV\357\363T\177\214"
+	.string	"\304:1\022<f\263\225\234\223Z\032\034\261b\341\206\23150\215\307~\234\004+\271]:\216\016+\256q*g\205\322\373lQ\377{\304:\357\221\3762\"m\231\257D0\261\002\204Yw\004F\227\021'6\202\247p\022JF\376\254-\357\266\330885\252\032\337\247M\375\361\220['\036\202\231#\322\226\031\253\203\267%\033\261\237\220$Q{\2151\2218sV\2224\276\217S\275\217X\220 p\276#o\304\232?~\374\350\027\370\007\225\223en9kuH\303|\315\001\323\370>K\365\307aN\034\326/0\024\224\214\204\300\325]\2161uK\033\035lz``\266\316\210\264e\262\210\b$H6V;k\242\312\bi\374\236,\352\217\003;Ca\260\370[\225P\004\217M%\020\005\255\306\245u)\035\301\004\022\216\302\241\t!\026JLL!\004)\005\215\214G!\212\017MC\244\00385\r\205J\007@"
+	.string	"\b@\020D8}8\032\207D#4\305q(,*\245O\362\260\026\233\216\3015\205\357I\036\214I\307\340\322\2124\f\236\260\360$\017\306\365\210\270\0044*~0J\241A\204\f\230@\201D\b@\021JX\240\004 \211\023\300\023L\004i`i\005S\317\223< \r\205\305\243\361\303z\324\244d4\024~(\032\233>T\240\244\3244\034\022\207\276#pUAhLW\020\213IG\342\320\227\"\270*a\026LFK\353R\372$\017$\240`\342\204\017#0\"*\221X\213D\022?G\306\240\006\326#\342RQ\030\024Z\201=@\001"
+	.string	""
+	.ascii	"\013&\"\211!\240\221\211H\"\350\370$"
+	.string	"\017LM\304\"\022\260\270\036\327\245`1\310\364A\003\243a\323\3160E\243F \022\023\317\0218DbB\207HLwUAh\304F\343Z<:\n\372X0\021\215p\361\310t\217\326!\222P)\350;Z\215M\330\350{\021\210\304\344\241\247\030L2\302,\212G\243\020i=1\264*!\r\205'(\005\233J\370\254\303\240\022SQ\030\302\005\244\241P\003HC!\013\245\0210"
+	.string	"\231\210\200\260\210B\217\022\221\030\001 jD\032\n\215\0300\n/ \r\205K\305\340\216\361(,\256\330q\022\226p\024$\222\020t\f\036\215\026\214;k\261\t\203\321\005K\304\243\261\211\304Q\220\250\204\301\230\036\205C\023\306!Qx4Z\213\302\022>#\024-P\302P\270T\\\217\353\321\206uIxd\"\022I8\022\232\020\004\344\201\207c1\310\344\341(\034\2320\356\360\b\225"
+	.string	"\264*\241\b\242\360\323\343\201\005~X\004\213\305\0202\250\307\237\022&\216\204L&"
+	.string	"K\2300\301(t\n\376\236\344\301\250D,\036\207D#\240\221\005G\303\340\322\022\221\204Q\361\367$\017F\300\342\007\243\024\0030\"\005\225FX\217\210%\374X\b\036\203%\214\212\351\322z4\2628\001x\201\210\202SS\b"
+	.string	"@\215\022X\217\301#\246\246\013G\240\261\270*5\211\260\0365\035\205\307cp\350x\\\201;'\034\207k\261\330d\024\264\002\217L8\021Q\370\216O\362\220\342\303\220\270\264D4\002\301\242\215\300\342zT\022\216p\024l\"\201\020\205\217\007(\272\bE\203@\321E\301\006\021\354\"\247\006\341\324E,\372\302\215\214\300\341\b\307\325\270\236@b\032\272\221\260\270\016W$\365\b"
+	.string	"\341"
+	.string	" \210p\362]\304\002<X\200\007\351E,\240\250h\001 \024\251\007\241\350\026y"
+	.ascii	"!\002\270\036\203JLK\353\021\b\304\260\002\235\326\243\241\211"
+	.ascii	"\343\252\324T\304F\240qUj:\301\263*5\235\3609>\311\303\221\007"
+	.ascii	"5\002}E\342\221\270d\201\250\242\270\236\260\032\233\324'y\370"
+	.ascii	"@\024fP\n\242X\022\"\371\254G\304%\274:\t\227H\360\254\307\340"
+	.ascii	"\211$"
+	.string	"\343ZL\261\236p*\366\024\217&\fG\b\036\203%.\254K\302\343\260\351\204S1h8\302\212\340\211\243\340z\302\250\270S<\232pa8\202\261\351\030<\236\260.\005\213#\030\025\177\216K\304\342\b).\030\201K\301b\320\004\343\321j,\256*\326\342\317\252tt$\\J\217ND\024\327\b,\256N\302\022V\244b\360\330\263\032\025\233\210'\034\233\230\206\302\235\365\030,\342\243ue2\242C\341\322M\235\202KwE\260x\237\344\241iIH\244\244D,\342$\243\243\220\t]\021dq\215k\223RPE\372$\017N\305\017NE!\247\242\005\246\340\222Q\021-\256GB\025\304\"\023\320\251\250\024\024\026Wc\320\220(4\032\233P\030}\234V%\246\246\022)\224\202I\026\224\210F\304#\261\310\364s\004\202\370\340H\370;\016\233\210F\300\024E\240\220\311\bt*fX\217\204\305\342\252\202\b\034\n1"
+	.string	"\"5)1\021\005\035W\343Z$\036\233\202\300\243\241\020\005\360\0304\002\227\232\212\307\021\254L\306"
+	.string	"\360\254JA#\243\205cqU1\024\002\205Fcq\307\250x$\\B\207\302%u\004Fk\222\221SpI\3751*\005U\f\211\302cP\211\310T\\\217C\023F\305\f\306u-\"\255%V%\244a\bKA\022*\230R\\8R\"&\031\327b\022\n\3531\250Bx4\na=\"\226P\024\006\211\206B\243\325\330\004t\n.\001\235\212;@\247\246 \320)\270\364\343;>)"
+	.string	"$\216\305\340\361\004\244\241\360\250\030\\Q$\216\240\264\016\207\301$\243\013z\216O\362plb:6\021\201K+\230>\030\213\253\na\361\b\203\023\231\326\342\207#\221X\374\260s\004\372\214HA\024\210\302\324\bD\022\246\030\022I\250XK\030\225\232L(\256\307\341J\002h=\006O,\2550\201G\305zt\217@\020\212\216Ca\223J\202\265\230\002h4\006\231V\020\225\200\027\216@\021\307\241\260\311w\005(\200\004\006\030\250\200\004T#\017\306\017\307$$\241R\212\017Cap\351\203Q\321\370\301\003"
+	.ascii	"\210*\212\253\021x\264.\025\203"
+	.string	"\303&\240\260x\f\372\357\203\221\004\243\315\271X\342\213\352\036\252\332\0329)\237\322\367\242L\316Y\231\317\022\311\2307_\322\227\364\265\260c\300\023\236\257\205\017\312\213\020\273.\037\224\357\t\275\262\264\362\242\346H\262\006\257\3615H\251M1)cd|9\r\363\241\341\261a\3551\325\036F\276\344\250C\245\231j\310\302\364\322\031vdp\202\244t\322\033\\3\260x\344Mq\300\003\2032\0073K\304\255Q\221c\331j\264\310[k\234\302I\343<\305{\212\327)\336\335\333K\233\214\221\222>\237\251\233\016\236\314\345Y\265y\352\346\315E\0327s\215\323;;\rH\365O\331\340\032>xptQkR+${\315\251\306i]Z\227\246\371!\251\334\314<M\223\242Q\301\003j\013MzF\035\202\227E\006\003\t\036\222:\365O\313\340.\254\266\025\346E&\315\227\031>\244\350R3\271'{>\302\204I\305h"
+	.ascii	"\225\263\213\314b\210W\331s\356\251\230[%\313\0265\"Y\324?\225"
+	.ascii	"K\227u\313\257)0a\264"
+	.string	"0\313\276\270\310\201\345\344j\334\304\240\245\204j\216\230\2528i\027\254\244\321\004\355\253\361\023\234\214\033\215S,)\226t\213\265\262\272#\200\027\030,&^\326\232\261\341O\337\236n\371A\204H\265\3343cL\272R-i\026\037R\007\027\274\016\342\226\245\215h\212z\326\344\251\252\002\262\274\222\2640\245\244\033b\305\005^\342\345\006\304MF\213\235\001\243\246\r\235R\251\340)a\262\2418\320\035\3122P\252\300\340\002\263q\265\366\224\312\317]\326\016\256\306\251Z:E\ts\212\231\306\267\316\253Ys$\315\025'\215S)iZ\030Sm\0056\177Z\341\211\341\235A\223\242b\222\007\226\236\3411 D\200@]:.Q\206tE\3012v\326\242\330ai\234\216=%K\307R\263K\246\rn\307L\312,L\223\247fO\233 B\\\215:\226\204L\262q\372\344>Z^\256<\033?ub\341\310\227SI\343\037"
+	.ascii	"J\326\325U\343\264LL\315\224]\343\224\311\337x\264\312\340\365"
+	.ascii	"H\227D1r#i\022\"57\211\302\365T\245L\271\301\205\344i\2225?P"
+	.ascii	"\246\340\3444N\305\264D=\321k\234\036y\333\026(U\236DD~\374H"
+	.ascii	"\231\026 \271b\342\204\247\314SM\031\"O\231m<\312\344\233&\215"
+	.ascii	"S \351\220\377\277\037/53Y\351\220T\210\025\036aI=\036:\\we\322"
+	.ascii	" \327\356\212u\221\311\021\341\350z\n\326\225\206\3317\266\231"
+	.ascii	"\265\226\310;\003\350\200\333#\303\313\312\033\033\220\300t\304"
+	.ascii	"\365x\032\026\227\356\235\271u\245_\2762t]\2404Ny\240\\2\320"
+	.ascii	"\210y\375?\236\260\270/w\215\237\241\214\372\fr9r\244K\242\345"
+	.ascii	"-3W'k\254\007\fV\333\225\216\247\313\205}\250\303\361\303ZD("
+	.ascii	"\307(\214dJ!\244\320H\2156\351c\025@0H8 \226\f\367E>\023@\004"
+	.ascii	"\314\013ui\"\007\031S\206h$\020Q\230\024$5\2061\346\366\351`"
+	.ascii	"\333\"\277\315\207\007\256#3Q\240\370\253\322\325\221\234\343"
+	.ascii	"\220{%K\t"
+	.ascii	"\273\202\030\273\2279\273\364m\266}g(4\373r\377\344\\ \3249]"
+	.ascii	"\254\2770u\226\370\300\2649\300lk\270K\351\217\275V*g\307\340"
+	.ascii	"\221j\017\341\255\244T"
+	.string	">O)ABFRs/\2176\251J\3735\217Pe~D\343\350\257p\341C\247\343{\201\305\210\\\275\201uF,\353\205\245\311d\013\003\\)\255\214\323\305 zS\233\255\r\211\035\366Pbw!\204\244#\212\236\213\3011\207\t\344\270\360[\373ed<\215;H\232\243\223\243\337m!Qr\017\013\356\371\035\223\027i\203\026\035@\220\200\0052Q\355\002\r\001\250q\323\253\224\277\021\303\0222\230G\244\255M\234\\\027GrWM\024!T\f\027h\340<\243\004\013\371a\361m\244L\322~B\320\346\237\344\345g\253\276\002M1\331\212r\313\001\214D\366\352Kma\240\230\351\317\rC8\367\357\233\350\r\t\226\202C\257\357\006K\006\177\222\354\3749\321\213\005Zoq\214X\357\264\216bU\363Y\356\324\315&f0Qc\270\335\254\374L5\322\016\376uI\207\002\361\262PG\212eu\245\247\221\020\340f\b"
+	.string	"y\004\312\366}\215\"\250\2004<\266B\320j\031M\006\244\212E;\027\311\263\234\213I\340\024\003aJ:`j\361o\370\017 \002\267W\313Q\250\007D?\325g\332X\"\232\265a\243\207 \t\223\347\375\341\226l&R\035J\365\235\037\216N\227\177}\231\223%\352\266\214\033\271\275w)C:\235\270\304\3318\016kc\301[\357\235\206\213\005\211\265\2670\\d7\264Ud0eK\020H\323\006\315\373"
+	.ascii	"\345\356kK\033\257 D.\235cc]\216\346 \253zB\315F\232\375^\264"
+	.ascii	"\013\231\365u\273\001;=@\274\275\372\323\"\353.8v\b \007 o\373"
+	.ascii	"\r\271\002\271w\210\373\325,\377\t\372\267\257\216\343\177\267"
+	.ascii	"\t\212J\321\327v3\254N11\327\f\022g\220\bH Z\236\312\255B\231"
+	.ascii	"\345\216\346s\017\370\241~\306\242\344\241o\233\201d\331\240"
+	.ascii	"\267\202\t~\273\307\353\305\335\251Rd\214\270\2608!=l\225\271"
+	.ascii	"\221\3362\323\252\307fz\002v\270\t\271\255\344pY\233B\310~1\332"
+	.ascii	"\274\201>\244\317\017C\240\317\261s\314\2344\004P\256#\255B\035"
+	.ascii	"\324\316\302\372\002M\253\213\202\241ikN\244G\227P\311\332\317"
+	.ascii	"\306\320\341\207\326l\t\222\341\347\367H\026\3258 \256\201F\357"
+	.ascii	"F\002\246G\r\336\003\006\340\241\303\270\206\256Xv\215\337X\254"
+	.ascii	"\027\216\231`\257\257VL\232\034\310x\217\f|\323\203%\0329\246"
+	.ascii	"\325\231\323\352NI[\2001b\354)p\355O\355\t\235\223\n\251\031"
+	.ascii	"D\314\030\237p\333\212\353\334\001\017b]\n\313\222H%\375\253"
+	.ascii	"=a\177\025\\]\t#\226\nQa\221|e)\225:\353\037\360\362\244P\303"
+	.ascii	"\371\n\231\300<\236qO\371D=.\361!\304\002\225\003\360\322 \003"
+	.ascii	"`\316\345\342\024\235)Aa\260\243\272p\016X\200\005\301\314\306"
+	.ascii	"\255u!.\322\364\320t\264\222\221\374\311\366\264\236\343\307"
+	.ascii	"\f\207\351\tse\321\213\217}\314\342\261\227\031\234[\311\213"
+	.ascii	"\326\345\374\315\346\252n\fuT\314tPB\036\315U9\020-\316;\276"
+	.ascii	"\221\225v\262\311\300\030\267\256\270.'cr\017\227\324\304>A\377"
+	.ascii	"\013\222;JE\362\375[\372\006\256\251\331\253cu\236\t\270\251"
+	.ascii	"\330@\250\212\036!e]\375\330\371|\255\325\240H\251\032f\005\230"
+	.ascii	"\366U \203\263\362\246\237\335\356\227\204@E\260\325\277*@n\212"
+	.ascii	"\217\327be\276\323"
+	.string	"\230+^0\343h=\216y\221\210+\223m,S(\327\335\020R\232}\342\203j\352z\213\324x\205\256zE\001:O\375\323+H\t\351\223\350\2048j\200x\021d\007l]c\221\232\366l\341\020w\321X\034\212\213\356\236\323#4\234\022\335\331\201\216\355o\375XU\360\001@\336]\272)\345e?)\217\241AcH\254S\265NN\242\352A\243\3474]ri4{*\344\274\021Z\276\306PJ\323\026\320\237\343|g\246q\326\226v\327e\342\274\302\377+\262b\2250\335\f9\037\200\272\264Z\242\307\356\223\374\017\236\323#N\017\303\021\034\25188c\375E=\020\320\f\230L\240O\r\354\320C\350o\342a\2223&\322!\315\250-\302\177\037^Bm\272\337\215w\237\215\tf\rZ\356'\371\321\013\2720$\233*\260\304\224\013\317\254\351r\201\252C\336\225\310E\301\345w\343\275H\341E%7\254h \261"
+	.string	"cK\301\205\344\016\260p$\002\351\353\233\232c\205\033if\243\327"
+	.string	"%:\037\302\366\352<\232;>\215f{\026\264\234\333\376\370\330\222X\021\025\026\272\261\271\332\2379 \343\322-\262v\312I\211=\025- \227\272\223"
+	.string	"0\003\303\300\271\346\255\364\317\2358\312\315]r\021M\270\020\251\263G\271\304\035\300\271\013\363-.!\243\322\024L\330\371V\022\341,CD\205\027bH\312TC\300eo\004&\204Nx\303\225\002"
+	.string	"7\\\354\254M\355SW}\204~\317?\312I\231\276d=\227\367\250\317,\024GDiI\313\200IUt8\001Tq\024\020"
+	.ascii	".\017\357\227\252\217\0138\326?Br\204\322<\231\235\261\374c\003"
+	.ascii	"C\366\350\300\267\024\2307\231GK}\337\354\337\231\251#\fR\324"
+	.ascii	"\372\n\016\007\355i\001\237._\362\023\035)\344\216G\230a\314"
+	.ascii	"i\234\346\251\262\316_\262\317\004\357\326\264\026\2038H\362"
+	.ascii	"\354\275\377\313\265\204Z\217\324\366;\224{\001\364\346\367\031"
+	.ascii	"\320I$\325\202\375\007\300\315\306\200K\024\211\203i\347\263"
+	.ascii	"\246\3000\356\265\222\242\367\"E\364\341\314\f\022\243W1\305"
+	.ascii	"4fr\370T\032`{\336\271\3327p\224\274\031a,\270\303\004gh\370"
+	.ascii	"\376D9\n\324\261\274\023\266G~\371\373w\027j\266a\020|\302\307"
+	.ascii	"s\317[j\323HR~b\224\264G\256\352\257B\201\0345\230\206i\033^"
+	.ascii	"\247\366;\366\261B\332\276\3258!\rC\354\213\200U9"
+	.string	"\300(\033\221B\025\027p<\026~/\303(G\235#f@s\nDtP\370W\201d\027\210\363\366W\256;\362jm\337\326I\3202E\302\257\223\211\327\030\344\020\020\334\327B{HaNc\341+\3705\344p\006\213\033.\260\370X/\314\"\006ex\006\236Z}T\306h\026\220\214\223\004\020\343,z&q\016\205\343\313'\027\016\224\276\314\224;\025:bsU\330\201\203,\331\f\260c\254\006/M\300\336\261\017\214XZ\370\336\222\240\224\212\334:\371\333\030|R\3323\013\206R-\375G\3615\202zX\244\f\353\356~\240\030\024\362\271}XS\257\220P\343\227\215\022\353!\366\204d\0200dv\020\336\372\025\342T\030\237B\206Mi\236\0230.c\224!\301\216\331\020.\310~\260_\256\315\271\235\034\256\257\357\022\022?j\262\273s\324W7f;\236\235\342\231\024\374\272\325Gi\007\322\251\352M\370:\317;"
+	.ascii	"${\240;\322wx\305\270\006\3544\316\340f\"U\001\2663\177tW\r\337"
+	.ascii	"\375Z\027\f\377\002\t\341[\025\271@;\262\300W&S\301\007\213\213"
+	.ascii	"J\006\303cu\352*CeI\037\323\243Q\034\307\n\364\201T4)\200\360"
+	.ascii	"\r\216@g.u\216\254+C\262I\250\320\001n\202b+\226\b\2063A\301"
+	.ascii	"\270\b\275\234c\355\214b\241\177\351\265OM\241\256\233\247\347"
+	.ascii	"q\303\270\2643\367\243a\347\006\022\235&C2\344#\027 ^A\t<"
+	.string	"\355s\376\361\261ME\261\340\026:\311^|6"
+	.string	":\211\004\270\217p\023z_ZKNs>1\223\334?\2115\350Q\325E\352K\201\375:\020\177\t\355/\034\322W%Y}<\007\267y\021z\314\233/\240\220\007\205\333W"
+	.ascii	")\347@\307!\346\243+\275W\357r*\b\351\241f8t\241\347k\016\342"
+	.ascii	"QX\206P@\205p\027\237\024\367\330\025JhK\211\217\363\\\372\n"
+	.ascii	"<\254\370\025\377b\323\002\003D\354\"\206\325\346S\244\\;\200"
+	.ascii	"\361\3104:\222\244'X\362\024~-\356\300\304\023\223@\005[\210"
+	.ascii	"\307{\377\277\317\212\367\321\273=\215\0060\217\375>:\205\272"
+	.ascii	"\340\210\322\030\236ax\215\2652\267\304\242&|@8\355 s\263w\267"
+	.ascii	"\261[\r8\273\210E\023\300/\245\352\037\267)G\260\225\031Y\022"
+	.ascii	"\372Y\036\355/0\0350\275TO\320\003\202c\247 \007_\212\221\330"
+	.ascii	"XBG\026\334p\023\320\253\203T\2523\263\303l<P\346\217\355\233"
+	.ascii	"\234\274P\307y& \353\340N\301\322j\r\277\212\223\346\357\346"
+	.ascii	"@\304\326<\034\013\3446\312\232\226\2340\234\"\323\273\036\346"
+	.ascii	"\022$\247\231\353c\205\227\0020\337\207tB\221\212W\":\262&\246"
+	.ascii	"\346#\377@\353:\334Y\365\300\t\"\326\374\364\026q\320i\242\205"
+	.ascii	"\201\324\362\2645\321\036fZ\237(T#\006y[\020\036\264f \376\211"
+	.ascii	" O\225+\2027O\" \263\303\3350\363\303Z\374b\337\247\007N\365"
+	.ascii	"\376\233\310\005R{r\237E{^T\3101\243\316\306\205\243\361\326"
+	.ascii	"\0359\3138\320\217\213wJj\030\204\001\006\037\222\313P\230\267"
+	.ascii	"\303\373\212\226z\327\367\275,\254`\341$G=9\345\331!?\307\371"
+	.ascii	"6\347\016\2457av\311\311P\252\345\237\364\342OZ\334\337\262l"
+	.ascii	"\246\023\261N\353\373\262dD\276\277\004\274\375\037\360l\223"
+	.ascii	"<\376J\0167\251\357\340h*\210F\344\254\237\362\3479f9P\344\342"
+	.ascii	"\231\377\026\3418d\341y\024\325\245\327\336\257\373\005\322\347"
+	.ascii	";\373\342\371\274x\224\307\347\230\204\336\356\036\334~\354\026"
+	.ascii	"\346\023\021/\226\270r\032[\361\225\371\360\314\206r\033!\331"
+	.ascii	"\310\261\217u\316\202\257\304\371\351[\033g\351%\313\2540\267"
+	.ascii	"\272<\36263#Y\222R\376\205^\306-/\222\017\365v\264\205\315@9"
+	.ascii	"\217\372\253\201\237}\362t\267>\342\220\b]1Z\230\f\237\200\317"
+	.ascii	"\223\036\003\335\005\177P\303\217\261\245\326\f^\364T\241G\350"
+	.ascii	"\347\200\267\231\327y\007\375\361h\337\216\003I~H\375\237\331"
+	.ascii	"\247\210w\324\271f\361\030\346SJ\336\026=\227\333\017N\266\361"
+	.ascii	"\370?\236G\200~\251\355nN\327G\2341\352\363\330\025\265\371\206"
+	.ascii	"\262\227+fh\367\315\334F\362}\350C\245A\026>4\277\fP\334\357"
+	.ascii	"\3311\346.k\255\261i\214\201\276\260\266\264\360\347\362\231"
+	.ascii	"\221#\021/v\312\302qXa\265\300\005\274P\\\f\027\222\0276\345"
+	.ascii	"QX\323\352\341cq\371\262=%\272\037V\336\2146\324\036\007\347"
+	.ascii	"\037q\254^W\354<\320{\3224\260\366\334\222\276\007\274j4:\351"
+	.ascii	"5f\352\204)y\030\200\275\331\025"
+	.text
+	.section	.gnu.lto_.symtab.b904e2787c2f03bb,"e",@progbits
+	.string	"pgResetFn_servoConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\002"
+	.string	""
+	.string	"pgResetFn_servoParams"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\001"
+	.string	""
+	.string	"servo"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\002"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\002"
+	.string	""
+	.string	"servoParams_SystemArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"`"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\002"
+	.string	""
+	.string	"gimbalConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\002"
+	.string	""
+	.string	"determineServoMiddleOrForwardFromChannel"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\002"
+	.string	""
+	.string	"servoDirection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\002"
+	.string	""
+	.string	"servosInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\002"
+	.string	""
+	.string	"loadCustomServoMixer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\002"
+	.string	""
+	.string	"customServoMixers_SystemArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"p"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\002"
+	.string	""
+	.string	"servoConfigureOutput"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\002"
+	.string	""
+	.string	"servoMixers"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\002"
+	.string	""
+	.string	"servoMixerLoadMix"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\002"
+	.string	""
+	.string	"writeServos"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\002"
+	.string	""
+	.string	"isMixerUsingServos"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\002"
+	.string	""
+	.string	"servosFilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\002"
+	.string	""
+	.string	"gimbalConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\002"
+	.string	""
+	.string	"gimbalConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\002"
+	.string	""
+	.string	"servoParams_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\002"
+	.string	""
+	.string	"servoParams_CopyArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"`"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\002"
+	.string	""
+	.string	"customServoMixers_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\002"
+	.string	""
+	.string	"customServoMixers_CopyArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"p"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\002"
+	.string	""
+	.string	"servoConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\002"
+	.string	""
+	.string	"servoConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\002"
+	.string	""
+	.string	"inputSource_e"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\002"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\002"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\002"
+	.string	""
+	.string	"axisPID_P"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\002"
+	.string	""
+	.string	"axisPID_I"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\002"
+	.string	""
+	.string	"axisPID_D"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\002"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\002"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\002"
+	.string	""
+	.string	"rxRuntimeConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\002"
+	.string	""
+	.string	"currentMixerMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\002"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\002"
+	.string	""
+	.string	"mixers"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\002"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\002"
+	.string	""
+	.string	"pwmWriteServo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\003"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\003"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\003"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\003"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\003"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b904e2787c2f03bb,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
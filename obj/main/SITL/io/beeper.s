@@ -0,0 +1,581 @@
+	.file	"beeper.c"
+	.section	.gnu.lto_.profile.43fd8e38eef9f04b,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.43fd8e38eef9f04b,"e",@progbits
+	.string	"(\265/\375 y\305\002"
+	.string	"\004\004m"
+	.string	"\020"
+	.string	"\354\301\314\336\005"
+	.string	"\001\274\205\242\255\006"
+	.string	"\002\003\004\005\222\252\354\340\007"
+	.string	"\006\317\253\250\341\002"
+	.string	"\007\b\t\n\013\257\204\241\210\f\f\245\351\271\273\013\r\240\342\234\212\n\016\017\240\342\234\212\n"
+	.string	"\t"
+	.ascii	"SDP\031\362s\034\030,\030\025\fQ\031W\314\2616\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.43fd8e38eef9f04b,"e",@progbits
+	.string	"(\265/\375 K\215\001"
+	.string	"\370?"
+	.string	"\013"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\001\001"
+	.string	"\001\002\003\004\005"
+	.string	"\003\006\003\007\003\b\t"
+	.string	"\003\n"
+	.string	"\003"
+	.string	"\007"
+	.ascii	"1\007\203\3034\033\001|*\203\265\f\272\2016"
+	.text
+	.section	.gnu.lto_.inline.43fd8e38eef9f04b,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"U\002"
+	.string	"\224\002\216\001"
+	.string	"\013"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"\001\002\003\004\005\006\007\b\t\n"
+	.string	"\r"
+	.string	""
+	.string	")"
+	.string	"y"
+	.string	"\311"
+	.string	"R"
+	.string	"\362"
+	.string	"\222\001\244"
+	.ascii	"\344\001$s\0249\233Kp\023\217\002\270\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.43fd8e38eef9f04b,"e",@progbits
+	.string	"(\265/\375 K\215\001"
+	.string	"\350?"
+	.string	"\013"
+	.string	"\001\001"
+	.string	""
+	.string	"\002"
+	.string	"\001\003\004\002\005"
+	.string	""
+	.string	"\006\003\007\003\b\t"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"1\007\203\3034\233\002\301TF\300]\024\3137\200\005"
+	.text
+	.section	.gnu.lto_.pureconst.43fd8e38eef9f04b,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	"\013"
+	.ascii	"\200\004\001\200\004\002\200\004\003\200\004\004\200\004\005"
+	.ascii	"\200\004\006\200\004\007\200\004\b\200\004\t\200\004\n\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.43fd8e38eef9f04b,"e",@progbits
+	.string	"(\265/\375 [\r\001"
+	.string	"pO"
+	.string	"\007"
+	.string	"\001\002"
+	.string	"\002\003\004\006\007\b"
+	.string	"\b"
+	.ascii	"`\013\330\0076\003[\300>\227\315@~\033h\003"
+	.text
+	.section	.gnu.lto_.lto.43fd8e38eef9f04b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_beeperDevConfig_Registry.55.43fd8e38eef9f04b,"e",@progbits
+	.string	"(\265/\375 \221=\004"
+	.string	"\224\007`"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	"\005\001\212\001\206\200\200\374\342\203\265\376\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\306\007us\250\335\006uq"
+	.string	"\005\001\006'\001\006\367\003?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/io/beeper.c"
+	.string	"\004"
+	.ascii	")\"\301$\016\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_beeperDevConfig.57.43fd8e38eef9f04b,"e",@progbits
+	.string	"(\265/\375 1m\001"
+	.string	"$\002$"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006'\001\035\001\001"
+	.string	"?\202\210\200 \177}\275\001{\275\001y\274\001w\273\001"
+	.string	"\003"
+	.ascii	"@FJ\320\003(\002"
+	.text
+	.section	.gnu.lto_beeper.58.43fd8e38eef9f04b,"e",@progbits
+	.string	"(\265/\375 \351=\006"
+	.string	"\022\214+0\200M\032\003h*T\026\017\320\2534\027\317\2125\223XhQ<\"\242\202\232\304\310\323\224\f\035#\206\020\230\356\210q(Pww$[n)S\n\217\001^\236V\250\3700\357-8hq\r\026\205\213\253D\007G\r\024b^t\017\020F'\315\233U\235\"\230D;3\213a\264~\376\277\254jW\202\253\316Oqb\362\221&\262!\265\365j\335a\017i\016D\243\377\202#\344\237\007-"
+	.string	"p\233,"
+	.string	"\271=\016\200\334*[\022O\215\033\2043\321)\371\357X\206\245\227\254\375\341H\263\311xQ\020\376wi6\026.s[\202\266\006m+\002\b"
+	.string	"2\003&j\006.\234\301\270K"
+	.ascii	"\304j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_beeperSilence.59.43fd8e38eef9f04b,"e",@progbits
+	.string	"(\265/\375 \273\365\004"
+	.string	"\002I!)\200M:h*T^\f\207\261\267\026\275\332\022H\200\342\021\021/\343\306\354\200o\3170\260x8\300\211\032\242\306\203\326\366N)\256\250\031\257\030\027*-uX\212\206V\363\241\024\301\362\212S!RN\235\272=\344\n\021(\261\273\354\301\213}\300B\316~\210[@\273\224\022iC\201\217\306\366'c\266\350]f\357\341L:\243\335U\2109\366\207\371\337|\240m\331\237 \261\273~\332V\271\341m\033l\037l3\002\b"
+	.ascii	"3\003\316\231\001\340\313]\303c!\364\313\270\340\322-\332\371"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_beeperConfirmationBeeps.60.43fd8e38eef9f04b,"e",@progbits
+	.string	"(\265/\375 \341%\006"
+	.string	"B\013*2Pm\222\016$\203\310\"\242J`aI\275E\b\032\356YeG\024\373\350+\345\372Z\030}\326\336\204\231i"
+	.string	"U\034\322\006\016*\252\3571X\273\211L\001\036\316CS\270\254\311LRG\222\030X\3330\316f\241\201i&\007\226\021\270u\244\211yZ\233\030\246*o4\020q\240\257>\353.\236\225\336\350\327M\020\003\244\245HAi\211\205d\343'\346_\353\017\020(r@|\255E\310H[\031\\\020@\313\324\233\260\322(E>$<N\332\262\313 \305EMv\360\022\022}\270"
+	.string	"\022\332\276B\242\n~\374\t~\366\203\002\t"
+	.ascii	"m\21173\340\234\031\036\276\3345\034:\204\241R\223\301]^\264"
+	.ascii	"\223\f"
+	.text
+	.section	.gnu.lto_beeperWarningBeeps.61.43fd8e38eef9f04b,"e",@progbits
+	.string	"(\265/\375 \340\005\006"
+	.string	"2\013)0`m2\034@c\203\024P>)\270}\240p\323\211\026lW\245Mkv\203-b\275\353p\347\001"
+	.string	"d\301\214k\347$\316\005lF%ho\231\002\032\f\204[\230l\251H-\323Z\003s\027\206\271080\213\364\300*\003\273L\223\230\3069\211Q\246r}\b8K\342\247\215Z\240'@\327\347\325#(\244\245(!)H\364\221\361\223\362+\365\b\t\217\032\021\257\326\"\344\321N\007\033\b0\372\275\b'\214\262#4\3011\322\226\255\013>\2527\271\301I\307\263\241\nPh\273\352x*\370\342_\360\263\237\023\t"
+	.ascii	"m\21173\340\234\031\035\276\3345\374\034BS\251q\340\316-\332"
+	.ascii	"\371\004"
+	.text
+	.section	.gnu.lto_beeperUpdate.62.43fd8e38eef9f04b,"e",@progbits
+	.string	"(\265/\375 \363\205\006"
+	.string	"\262\314-1pm\032\003\240{=\037\320z\001+\307\210K\252I\177Xx\347\020\021\tAI\001-\201\225\354R1T]\241Bi\204\260|\304\016\375Mn)S\n\034\206\227\231\026:\232\027\343\203$P\t\023\337\346=\007\007'\247\231\0322N\212\034\207)(\334\274\350:\020Fg\2317\373\364\022\301$\332\351Y\f\324:\372\377\262O\273\030e\220\310Oqb\362\221\026\222ai\353\325:d\r\351\r\210V~\213\020\310?\021z\020\340v1\001\305-\362"
+	.string	"\305\255\262%\361\304\270?<&:J\376;va\351%ks\270BU\036/"
+	.string	"\205\377]TU\3412\2675h\233\320\266\n\b"
+	.string	"2\003&j\006.\034\200y\227"
+	.ascii	"\210\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_getArmingBeepTimeMicros.63.43fd8e38eef9f04b,"e",@progbits
+	.string	"(\265/\375 \314\265\005"
+	.string	"\"\312&1pi\323\001H\253\252\025f\t:Fa\240G(V\251E\016\225\242fwS\264\252Wc\364Z\363\377\337\372\033\355\025\343(\363\353\311\374\266\266wJ\001\216\240\031\247\030)PJ\360\"M,0\232"
+	.string	"\020zXNq\302"
+	.string	")'t\352\236\276g\300\021\330\265j\016\263\317\254C\260[\345X\266kPA\261\022M\304\202m\312v|\2067P\246LU\270\036\304CA6\261[\341\363\306{\303\234\361\336\270\204\3237\352\337\341\216\314\272\252\267\205dw\335\254\353\340v\267\r\261\035\261-\020\t"
+	.ascii	"2\003\202\341\243\302Z\025\220k83\242]!\310pW(\355$\003"
+	.text
+	.section	.gnu.lto_beeperModeForTableIndex.64.43fd8e38eef9f04b,"e",@progbits
+	.string	"(\265/\375 \360\225\006"
+	.string	"B\214-4PO\222\016 :\203B\227\241\225<\354"
+	.string	"\026\022l/\212\253i\341(\033v+E\246=\327T\260a\201\252\212\210\032\210]s9\314\366\334`\266\221F\266L\001\021\fT\233\263\261\246\3164-\274\212z\016\224B\303\343X\017oCp\325\231\254\007QU\326\313d\331K\322H\264\211\317>\330B\337(\233\306c\353h\310%\263\342\245%U\334\211\307\357\371\314\217\330\220Q\016\310\314H1\311L\204\r"
+	.string	"\352\376\373Q\020\317W\224q`\230\022\022\212\021\226\314\354i: \325E\025\220\352\332F\257\342u+R\304X\001a\237\"&!3G\020f\321[\377\202\377\340\277\b\t"
+	.ascii	"2\003\202\341\243\302^\025\220kx\203E\263C8\001\2504\235v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_beeperModeMaskForTableIndex.65.43fd8e38eef9f04b,"e",@progbits
+	.string	"(\265/\375 \360\215\006"
+	.string	"BL-3PO\222\016 :\203B\227\241\323\206\365*KJ\357Eq5\024p\224\r\273\225\"\323\236k*\330\260@UED\r\304\256\271\034f{n0\333H#[\246\021\fT\233\263\261\246\3164-\274\212z\016\224B\303\343X\017oCp\325\231\254\007QU\326\313d\331K\322H\264\211\317>\330B\337(\333\306c\253h\310%\323\342\245%U\334\211\307\357\371\314\217\330\220Q\016\310\324H1\311L\204\r"
+	.string	"\352\376\373Q\020\317W\224u`R\t\t\305\bKf\3664\035\220\352\242\nHu\215\243W\361\272\025)f\254\200\260O\021\223\220\231#\b\273\350\255\177\301\177\360c\004\t"
+	.ascii	"2\003\202\341\243\302^\025\220kx\203E\263C8\001\2504\235v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_beeperNameForTableIndex.66.43fd8e38eef9f04b,"e",@progbits
+	.string	"(\265/\375 \377\345\006"
+	.string	"BM05Pm\222\016d\364\214Y\312\003\234\354\006\201\242'\271\215\262\213\211\366\332@<\3546kq\033\027\226\250c`f\246UU\323\273\036.\304C\362\341o[k\204\310\024\017\n\327\233\263\311\254\216e%@\354\202\f\027\302\002\344d\rpC0\326\2612\350\200a\031\274\304\354Ve ^\304G\217{\027\337)3\363\027z\207)\215\252q\222I\221\202\222%\224\210\350\327\376\362;\367\345h\207\326\370\310"
+	.string	"\231\025$!\231i\260\306R*3\375w\243#\355\r\0233@\025\021\210\004\251\224\031\341\261\003U)K\005\252R\017\243[\335v\353\321"
+	.string	"\222\205\311\307\307SW9\310\314\335\304\007\324_\177\315_\360\207\002\t"
+	.ascii	"2\003\202\341\243\302b\025\020]\363J0\361\340\356\223j\305$L"
+	.ascii	"2"
+	.text
+	.section	.gnu.lto_beeperTableEntryCount.67.43fd8e38eef9f04b,"e",@progbits
+	.string	"(\265/\375 \313\235\005"
+	.string	"R\212&/\200\267\351\2003\242\271\325\341\036\250\211\331\034\217\330\351m\240\3367\333\234\331|[z]\323F\203\302\304\210(\277\022Tz\3371\207\276\033\331;\245\246&*-)#qVqRA$\221\242\2248)<-IceN\032!n\017\265\306\245\013\304\330\334\365\240\200\375f\241f\277\307\265n\027\340\301a\031\034\205\315v\265!\277\340\006\325^h8\202\354[B\006\241aw\243\364\350\271\323<\361\334\201\003\257\177\325\377\301\243\016\313\256?\204cw\375\260,\340\206\267\275\260\315\260m\t\b"
+	.ascii	"2\003\326\231!\340\200\\\303\235\021\r\013A\210\273Bi'\031"
+	.text
+	.section	.gnu.lto_isBeeperOn.68.43fd8e38eef9f04b,"e",@progbits
+	.string	"(\265/\375 \302]\005"
+	.string	"\202\t$,pm:\240\017"
+	.string	"^\255;\023R\266\214*\312\022\206\204\273P\333\354~\275\271\363\b,jU\365"
+	.string	"x\245u\270\013\202H\304\266\267L\001\277\254:\2639\027\222b\322\201)\032\362\252\017i\rN\263Y%\204\322*\253\333l\003\204H\224\374w\2031\3633\325\021\363C\352\3630\207\324\315\235L\375\001B\336\177\355\257~@h\267|7\034{\242\311\247\324}e\324\260eh\317\334a\266\\F\240nc(Ht\367!\245\253\360#\3777\374/\374g\004\t"
+	.ascii	"2\003\202\341\243\302b\025\220k8\\\304XB\344p\347L\355|\002"
+	.text
+	.section	.gnu.lto_.symbol_nodes.43fd8e38eef9f04b,"e",@progbits
+	.string	"(\265/\375`Y"
+	.string	"\235\004"
+	.string	"\364\006U\001"
+	.string	""
+	.string	""
+	.string	"\002:\177\004\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002;\177\005<\177\006=\177\007>\177\b?\177\t\300"
+	.string	"\177\n\301"
+	.string	"\177\013\302"
+	.string	"\177\f\303"
+	.string	"\177\r\304"
+	.string	"\177\016\0059\017\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\0057\020gistry"
+	.string	""
+	.string	"\0054\021\201\204\0055\022"
+	.string	"\023\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016"
+	.ascii	"\254\034\210\226\375\345\334\006\2403\370\b\370\b\317G(\357#"
+	.ascii	"\340\033\340\033\340\033\340\033\340\207k\3151"
+	.text
+	.section	.gnu.lto_.refs.43fd8e38eef9f04b,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\f\002\r\002\016\002\013"
+	.text
+	.section	.gnu.lto_.decls.43fd8e38eef9f04b,"e",@progbits
+	.string	"(\265/\375`K\020\365T"
+	.ascii	"*"
+	.string	"\223\240 Q0\222J\032\016(\213\277\2134\350w\246SL8_\223o\2768\354\210\323E\216\322\221}\240\201c\203P\354 \345e5\244\016v\277\337`\233\301\f\354\265\3738\006Ad3\255\252V\\\307\275\033\367^@\231\300G#\302\213.\324\302p\237p7)S\274\001\372\001\363\001jTAk\023\021j\246V\037W,*4\331\334ko\033\261\250`8\256I\344qM\022\201\332\230$v\257T@\307f\221\270G&\026\325\221\231\244\njc\023\233Y$\222\032\223TG/I*\240#\263Hu4bQ\005I)\263\256\216`\212UK<\032[\307\224U\021\t\344<\256\311^\353\336\346S#Ut[%\221k\305\037;\346\344\324\341\204\245\230\334\265\273\007\230r\312J\266\321yT\222\354V\342d\243\247\" \256\316\346a\235D-\253\226z\352&\240\327\356\251n\342\266\263\273\211\335\235\203\264Z\273\203"
+	.ascii	"\035\225SS\335UCSmE${\352\346&\333\030\325\221\231\2254\"\263"
+	.ascii	"\302T6\324J\334\243T\262\225\275\206\205L\231D)-\325\335\253"
+	.ascii	"&UR\365H\303(\3216w\306\265\231<E\037bF0\372\t\322en\225]\036"
+	.ascii	"\260V\376\200\004\307\021\247\264W\367\372\323\023\307I\0347"
+	.ascii	"\214\276(\375\333\036\240\333)\374#\n\t\017F\257\"](\353\265"
+	.ascii	"\313\215\262\353\321)\311fv\257=\270\242\0174-\214\242\330\023"
+	.ascii	":tM\350\376\007q\037\254\226\340\234~\211t?K\244s\003\347L\232"
+	.ascii	"1d_iR\230\230u\341\376\345\332\177\263\370\337\253\177Q\374\213"
+	.ascii	"\300\277)\376U\361\257\002\377s?\323\370\227\204\177G\370w\306"
+	.ascii	"\277 \374+\302\2775V\370\027\306\277\037\374\333\301\252\360"
+	.ascii	"\377\347g\036\376M\341_\024\376=\341\337\243\177\027\370\037"
+	.ascii	"\347?\233\377m\377\327\376\207\371\3574\373_\366\237\354\277"
+	.ascii	"\330\377\243\377\315\377V\376O\371\037\300\377\263\377>oooo\377"
+	.ascii	"\312\360\343\030\370y\202\004D\2340\3125\244O\270\035+vlS\314"
+	.ascii	"p1z\256\341g'6.\032\026\272\215\335-\304RB\252\3160\372\347\236"
+	.ascii	"\320\371\254\t\035\023\215\316E\023:d\325\332M\356j\236\2351"
+	.ascii	"\332\303g\332\264\3318[\325\2703D@=\233\220\351\241f+\316\276"
+	.ascii	"\331"
+	.string	"\375\220$K\212\321}\303\353f\341|\337\354\022<\306}\203n\n\237\335\024\2712#E*c\322s\332\2325\313f\355\035\333\245\005\352\351\226\243CqH\0256/C\227\260\005\361C\223\215m\333\272\304\236\272 \315\2552d\276m\253\346\b./5\377\226Y3\233\006\327\354^\203~\240\334P\304\207\365gG\346f\t\016\214\356\231}~\321l\022h\"Hv\027\027\315\317\233\356\342\317n\212\335\024\350\223\254.0\035z\246\222~\335\023\272tM\350\230K\214\230]\313R\004\333\016$\276k_t\266\210(\311\301;\324\3246\314\025-X\236;#L%J0\3370Ke\314\024\255\343\313P\034\310\240\240\261AC['+s\254h\t{\352\004IC\003s\356\027\034\033\023gW\332N\214\232\253f\022\351\227K\227.{\006\226\023\342J-L\021\3373\037\257\262g\233/\244\262\036\334\276\314\314\276\242\200\020o"
+	.string	"b\313\226-k*}\212\230\t\0213\304.\267,\007E\210\365\307\225\\\326\2322Z\206\214\215-Y\n\324Ng\242(wn\310+\343\225\370\222\345\324\224\034\001c\364\213L\277`\033\366\305\262\\,+v\240\356v\352\036\202D\221\2247PN\334\272\312\212\250'\355\t\231\034\233\345+\366$x\272\275\272\333"
+	.ascii	"\2358Oh\302\030\275\022K\345\377\316\005\033\327\021F\257\246"
+	.ascii	"\277\256\213\310\356\346\221[\033\351\304\243\333\334.\321\337"
+	.ascii	"\263\270U\361\037\355\356yvO)\333\322$Z\212B\030\375\217\242"
+	.ascii	"\233t\023\203zm\344\221\211E<V\t\034\005\b/\274D\n\177\255\263"
+	.ascii	"\n\250\215be\236k&\013C\341&>\304\240n\2554\245"
+	.string	"\026\026\202\311X\214\261\360\330.9\013\257\347$\254\344CY\330\013\355\271#F\211.\247\017\312\344f\fp:v\260d{B\360\033}\361\024n\256\263jm\036;Y\224lk\334\3008l\227\374\365\241\265\233\005\213\001z\334\214q[\352\232Wx\306l\020\002\305([Y\346Y\224\326\016\346.\271\312\017\024\0228G\030e*7\223\203hCTN*}\356)=\332&]\246G<\257\322\324\244G\317\244G\331\322\243j\351Q\264\364g'\334$\307,\242-\215\233\\a0hRN]R\2405\241CA\324\305?\374<\031+\022\246\244\321\303\2270F\321#|\326\245\2342\342\263v\344K\212\017aom@\030e\256\364\t\r[\241s%\226\203\020F\317\\?\023\271\207\031\336\340\260a\364k;\030\235y\330I\343\362\214\302(\017\212$\375:Y\356\363\216]r\363\026KY\211>Y:\220V\r\354\260\210"
+	.string	"\201bTk\035\312y1\"I\302\350\321dz\b|p\225\017\256{\310\227R\002\034\366\312:\253*x\002\266+'9\b\017Y\347\016\026xayv\257D8\007\306\342\254]r\222\201\234\221Lu^\317=~#N\362\r{\305'FX\016K\270u\257,X\260\030b\301\223\244\313\226\350\240,\204\255v\271\202\257\316<\270\307s\305\265W\346\202\363E\245-\375\256\320\341\336\336v\205\3568\266\3648\"\370\007\352\003m\353\310Xz\034Xz\\\224\364\270$)\320\236\320\361\232\320\271\330\023:]\024O\261\216\177\267\333\"\005\306\212+=K\351\354\240fd\t\243\274/\323q\216\263\r\377.\307\013i\374*\222\236\241\370\370\357pp\274l\311\301\350qC\322\363\023\rd\002\267\321\"\204#\017j\024\r\325\245 o\210\342\205\244\337\r\031j\360'\343\007\007\360'#"
+	.string	"&u(\304QC\200\341m\264"
+	.ascii	"6\375\202KHAu\2502"
+	.string	"\361\202<`\321R\222\002I\276\246\r\206\252p\307\347\002\347\204H<C$\337\0220\347[\002\342\324\031zBT(T\203JJ\274\034\034\300_\022\032\034\002q\357\301\021\034\n{Kj\tC\303\333h\241\344k\372\t\213\204A5\206^PI\305\020\351\205\021\216$\237\332\004\203\032ta'D\n\032\"\345,\361\216~\275\234\222:\f\2521\370<\020\366t|=^0\003\237\n\024A\330\333QR}K\275\033\274\034%U\330\204&\251\302\234\363\206<\245 \322\022\260\205\317R\fj\006H\352\220w\003\310\244\036\rU\241Z\302\0220\201\033\277\037\006H9\237\bAU\330\323\031\372\232~2p\004\207>\rN\004y6\222P\225\211GC\350\005!oF\0012\250J>\017\324\033-\360\216\202\277\r\204\206H\017@\220\n\177\301\244\336\f\225\251w\304\024\274`\250.\t\251C\236\022\320\004\236%_\317\027\344\235"
+	.ascii	"\200\020\250\252\030\370~\275!\217)\330s\301\367\223!\244&\371"
+	.ascii	"\324\033\275\032=\027\372\017\250\006\213\206\277_\260hG\367"
+	.ascii	"\244^P\365\251K\351#x\341\300\013\0302\344\034F\f\0271\\\350"
+	.ascii	"\016#\206\221Q\214\027F\351_\030\341\206HB\023T\246\3360\035"
+	.ascii	"\"\301\030\372zM9*\222\252\364\233\301s\n(\220\201\302\004\032"
+	.ascii	"\034\244I-\202*PU[(\372\365\212|=\036SQRPX\324B\20046kNU\201"
+	.ascii	"b\264-\035\227*/P|\266"
+	.string	"K>\333/\0264\273HET\226L\203\304\255\221D4\020d\304\311\244M\227.pr\274\266jh\013\223\376\314\345\347\302fh\021\250;\213k\254\221U\r\354\024\243\326@aTK\247\211\232Y\224,:\234\221\354\222u\340!\206\332\330\336\216>4\031\335\222\023\005$\254\271\246_3L\330\311\032\020O\270\211\327\227 \002\201:\250q4\246\224432\"#\222$I:Q\005\2040\007\245\343\r\021p\241\223nH\222$\031\306?\003c\252?\265P\247\343azP,\024\3205B\203\262\177;Q_\262j\270%T\353\217\300WSY\304\251)\307\210\220\230\260\336r\213\317\313\375x\363\n\342\347\n\262\016\036tY\323"
+	.string	"\016`o\330\024}A\312:\210%\267\260\016?74\223\031\255\257\007 \035\024\236[\2436Vjj\"\334:P\016\263v;\036\024\217\031\222\027}0~\223\330\367SiE\rI2\314!u\003\006v\215\321\240\\a\032\220A\323a5\350qOF\337\266\362\206](\272I\177\004\311\342\255\243W\270\331\213I3\027\364\0165\316\226\021\213c\307GD\210^C\311\007\204{\3369\367\372\222\177\3778IG\342\200$\241\233M\303\230\227\347\242\013A\243\274]\030\365-\002o\007\230\302cjV"
+	.ascii	"\373\021T\t\261\026\375A5\350\2604\b\177\327\302\352\005\362"
+	.ascii	"6\250\033\026\260!\2040`Dv`\210@Z@_\200\2426\275\027\035Yv\300"
+	.ascii	"\203\367p#\237\020v\013\231Gn\222\332\031\257q\"\226+\260\361"
+	.ascii	"\177\210\027\003i\243T\0235\342\330qC\035\021=\217\273\r\215"
+	.ascii	"uV+\302\263\363\222t\210\361\302\307\314\2575A\301\202\357r\017"
+	.ascii	"&L\303A\002A\327u6\221v\274O\335Y\363f\267\353k\020\004\220\f"
+	.ascii	"\021\207\271\311\302]\330\213\306\236\017\372\211\025b;\\~\307"
+	.ascii	"\330\314\210a_$yC@\027/\357J\024\271B\243\303\2338\254\r\206"
+	.ascii	"FY\341MQ(\376!\347\326.\220\213\220G\220\314e(\"\222U\002S\003"
+	.ascii	"wm$\362\210\344s&\345\253\b\314+#\n\272\267\\1<\020]\374\b\337"
+	.ascii	"\371\316\267\360\315\206\207\312cC\356d\202\027.\201\272@\305"
+	.ascii	"\031LH\353U\325\004\250\370\326\001\216A\253?wR\242\372\026*"
+	.ascii	"\020k\317\332R\020u\357\262y\340\t\273\344s\245\30313\021\370"
+	.ascii	"j\211\244\006\3644\002\024\2541\207\033\340\217\223\314IN\251"
+	.ascii	"\022VIE=\024T\202Lg\022l!O 's\222\rG\375\023XH>`\260Ex\337;\232"
+	.ascii	"\270\n\357\3533\267O>Hv\024Nq\362\323\204\253\352\237\210\233"
+	.ascii	"\312O\004\260\322\251\316|V\302RD6@j\256&Q\003"
+	.text
+	.section	.gnu.lto_.symtab.43fd8e38eef9f04b,"e",@progbits
+	.string	"beeper"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316"
+	.string	""
+	.string	""
+	.string	"beeperSilence"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321"
+	.string	""
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325"
+	.string	""
+	.string	""
+	.string	"beeperWarningBeeps"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327"
+	.string	""
+	.string	""
+	.string	"beeperUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333"
+	.string	""
+	.string	""
+	.string	"getArmingBeepTimeMicros"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340"
+	.string	""
+	.string	""
+	.string	"beeperModeForTableIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344"
+	.string	""
+	.string	""
+	.string	"beeperModeMaskForTableIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350"
+	.string	""
+	.string	""
+	.string	"beeperNameForTableIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364"
+	.string	""
+	.string	""
+	.string	"beeperTableEntryCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"isBeeperOn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376"
+	.string	""
+	.string	""
+	.string	"pgResetTemplate_beeperDevConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\001"
+	.string	""
+	.string	"beeperDevConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\001"
+	.string	""
+	.string	"beeperDevConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.string	"beeperDevConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.43fd8e38eef9f04b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
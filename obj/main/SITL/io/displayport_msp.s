@@ -0,0 +1,634 @@
+	.file	"displayport_msp.c"
+	.section	.gnu.lto_.profile.87a6e081e489cd37,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.87a6e081e489cd37,"e",@progbits
+	.string	"(\265/\375`\023"
+	.string	"\255\005"
+	.string	"\004\t\007\001"
+	.string	"\023"
+	.string	"\317\333\366\301\006\004\002"
+	.string	"\002\001\001\317\253\250\341\002"
+	.string	"\002\312\332\260\336\t\b\002\002\002\003\002"
+	.string	"\002\004\003\240\342\234\212\n\004\215\377\300\244\017"
+	.string	"\005\320\235\262\314\006"
+	.string	"\006\224\217\236\327\t\006\002\005\002\005\002"
+	.string	"\002"
+	.string	"\b\t\230\232\324\211\b\n\263\326\341\254\013\013\262\201\245\301\003\f\330\271\210\336\b\f\002"
+	.string	"\002\006\006\r\253\301\343+\006\002\007\002\b\b\002\b\016\353\323\300\246\002\t\t\017\020\361\253\302\312\n\021\334\347\232l\022\023\240\342\234\212\n"
+	.string	"\017"
+	.ascii	"O#\t\\\204\314|\206\344\356\246\246\265v\335\004\007\004\007"
+	.ascii	"\004\007\264\351b\300>+\324v!\025`\b"
+	.text
+	.section	.gnu.lto_.ipa_sra.87a6e081e489cd37,"e",@progbits
+	.string	"(\265/\375 \353\355\003"
+	.string	"RE\020\031\260%\351\f\3030\224\226y\030\206a(\005\t\2665K,\261\244\355-S\n.9\330\205\213\312(Z\034\277u<\252B`\002\205\030\335Z\206\213T\"f\375\b\340\361\211\354<\341\2173\333\032\036\002\031"
+	.string	"\r[\2210F>\r\202ZP0\344\301M\314>\334\n\230\177SW8\214\002`\021\020\006\210"
+	.ascii	"r,\2049E\231\2510B\005\256D\200yM\314\301\226\212\245\022\374"
+	.ascii	"\006\260"
+	.text
+	.section	.gnu.lto_.inline.87a6e081e489cd37,"e",@progbits
+	.string	"(\265/\375`\330\001\r\b"
+	.string	"\202\313\"(\220'I\007\327wA'F\206\357d\023e=;\271\222\0372\262\315z\273\353\356\366\305\361*d\033i\315\022\333\032\331r\247\333\317+\337\034j\206CD\273ch\273\2209k\026\203n\326\303"
+	.string	"\003F<\032$\004\006\324\242,\322\333\177?\003\371\033T\230x@(K\354\233\005\220\330\2669\270\220\345\271\205\266\310\350\277\364\312\263\230o\316m\352\002\236\322D\243I\300\266\245\303\036\264Ex\305\226\260\365Vhsk\320\241m\362\314|\b1 `\0021DF7\372\002(\324`\033\246\t$L\341f"
+	.string	"\2028\372\001\345`\277\rk\342\273\233]\003\3463\262\006"
+	.ascii	"\266\325s\f\311\306\314\253\204Hxt4b\230\210\300\002\257\t\271"
+	.ascii	"6=\343\270\031\335\001\362\016\302M8\332\261\006K,\347\f\304"
+	.ascii	"\335\233\035\217\346\034\354\344\311\316\272\335\250F\220A\037"
+	.ascii	"\203\357\310\355\321\b\376\353 \220\204\341\321\321\n>\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.87a6e081e489cd37,"e",@progbits
+	.string	"(\265/\375`\021\002}\b"
+	.string	"\302\315&(\200)I\007<\030\b\226\234\301\245\362P\301\fLcZ.\024>\367\206\201\031\354Q7\255\177\240\337\214 \255\354\266\211L2\\(\350q \350)2@\301V\006\372\274RP\3573\2262\006\223\302\316\271J\030\250_O\027\250\275\236,P\317\r\366\251\002\365\242\035<4M\003\361-\320\242\036\352U9\244\034\b\240\261\304C\216X9\341\336\214=c\235W\362\361\230\023V+#g\260\362f\257\310\353_\361tExE&\225\245;:\352!\374'aU\357|/\371_\236\347\302\223\0042 \260\002\021\262\242\007(\"/\203r{\3058O\200\002\230\201-\304\250 '\013\330\200\034\340aD\243\376ua\021\221\030\001\215:\025\200\200\n0 g\322:P\332\013 \t\344\013\310\374\314CF8\017\034M\237\261\r\0225"
+	.ascii	"\336\257\036\r\320OfN\261\317\333\227\3137\340\217E\004\341\273"
+	.ascii	"t.D\003\353\235xu\335\275\221p\215\310\033\217V\200!"
+	.text
+	.section	.gnu.lto_.pureconst.87a6e081e489cd37,"e",@progbits
+	.string	"(\265/\375 ,a\001"
+	.string	"("
+	.string	""
+	.string	""
+	.string	"\r"
+	.ascii	"\205\004\001\200\004\002\232\004\004\230\004\005\230\004\006"
+	.ascii	"\230\004\b\230\004\t\230\004\n\230\004\013\230\004\f\230\004"
+	.ascii	"\r\230\004\016\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.87a6e081e489cd37,"e",@progbits
+	.string	"(\265/\375 \344\025\004"
+	.string	"\264\004\312"
+	.string	""
+	.string	""
+	.string	"\016"
+	.string	"\r"
+	.string	"\001\300\004"
+	.string	""
+	.string	""
+	.string	"\001\002\023"
+	.string	"\001"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\200\001\b\020\001\001\002\002\001\270\006\024\002\025\020\020"
+	.string	"\004\005"
+	.string	"\006\001\b\t\n\013\f\004\200\214\260\006\r\004\374\007\0071cO313"
+	.string	"\005.cR "
+	.string	"\027"
+	.string	"I\005H\254@h.\340\022"
+	.ascii	"\343\256-\374\001#\330\fl\001\373\\\226\201\0268\027\262<6\025"
+	.ascii	"L\253\260\340\024\343Q\306\220\352\304mP\331\361\347j\030(\002"
+	.text
+	.section	.gnu.lto_.lto.87a6e081e489cd37,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_displayPortProfileMsp_Registry.14.87a6e081e489cd37,"e",@progbits
+	.string	"(\265/\375 \214\035\004"
+	.string	"T\007R"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\255\334\ryw\350\375\005yu"
+	.string	"\005\001\006'\001\005\200\0040sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	" ./src/main/io/displayport_msp.c"
+	.string	"\004"
+	.ascii	"[\005N\271\351\231\304\r\240\b"
+	.text
+	.section	.gnu.lto_heartbeat.17.87a6e081e489cd37,"e",@progbits
+	.string	"(\265/\375`8\001u\016"
+	.string	"6\334cE\020\221\223\0168\212A\020\002\364(\311\177\267\217\333\277i\220t7\221[y\251\334\241z)\247^n\346\243\366#\357?\320B,*\225\331aI"
+	.string	"\250\240\350`\315\213U\211\256\202x\307\261\274\232\034\033\331{\357\235RN"
+	.string	"O"
+	.string	"N"
+	.ascii	"\340\306\266\317\342.\235\0353A\023\037\203\326\311\213\216\335"
+	.ascii	"\315:'PO\347\007\324SY\342\335\247\214\235\377\360\023\265\222"
+	.ascii	"\303\373J>=\\N\003\247\026\032\001\237ivl\310\234|\365\210\362"
+	.ascii	"\231\304xA\330]G\357"
+	.string	"\353p\323\333\016\261-\301~K\340/\001T\226\033\005X\273)\255\035+Ck\240x\352\267\357\277|ec\036]e\371\202\205\332]ldc\357\374\320\230\025,\350\236\"m6\305\305\032\301afW\345\343\324\0166\247\321~\213\273\350\016n8g\3674\203\306.\230\300\331\346\324\001,\224w\025wL\365W\026@\361^\225U\226\274&D\013\206\264V\251\034\tq\230\304\032\3731.C\363O8\003\027\357\235\372\\=\245\362\203\313\212\025R\214p\340\251K\030\025\215J)\266l\320\024%\t\373s\345\311\246\321\027\215\2563\232>>\t\3103\242\201\253\242M\233\200\331\003\022\342@\024D\233\026\032\211\\\bq\037\222L\373d\030>\"\240\314\263q\031H\307Z\250\302\226\2114m\3130\260\364)\253\374\352!),\361\343\227D\261}\311\006 J\322d\322\334\025\361 <g&5\003D\004\277\352\341\307\003&\027"
+	.ascii	"\266\311\"x\266\201\021\201xQ\013ta\230\305\332\037\325Z\f\244"
+	.ascii	"\254\210K\247\305cYA\316\f\30151PX\021\245\2066\232(\342b\004"
+	.ascii	"Udp\002\220j\320*\221\246\024\n\n"
+	.text
+	.section	.gnu.lto_grab.18.87a6e081e489cd37,"e",@progbits
+	.string	"(\265/\375`\177\001\235\017"
+	.string	"V\035hF\360\260(\035x\337SnL\242\037n\216\332\332\266\334$b$\351O\214w\364\3740\006dZ\267#\251\302l# |\275\276E\247\366\215\236\246n\223\340\"\250\375\244\255\305\314:\"\322\210Qv\277\200\366\367\336r\247\024R"
+	.string	"U"
+	.string	"R"
+	.string	"\237K\177\037\333~\213\303x6N\374L\270<\254\027\013\215\216\335\345B'0/\343\007\314K-q\357Q\241\347_\366\030{\331h\271T\036;\\\243\001\030\b\035\001.V\f\325\260\261\274v\330\342Z\201\320\323`w\r[.\016\267\274m\022\333\017\354\343\b"
+	.ascii	"f\354F\001\032\273.\267\035k\2233P|\366\333\367e^Ky\215U6\213"
+	.ascii	"\355\356a|\346\323,2\342\245\036c\225\331\244|\032\213\214\244"
+	.ascii	">\243\372l\n\317l\204\206\234\335\027\220K/\370\244\330\240{"
+	.ascii	"6\b\332w\361\027\336?\f\377\330\205\321d\354~\n\314\005\023<"
+	.ascii	"n\336\272\212\033g\372\265\021\005\370V\324\251*\337\tq\243\251"
+	.ascii	"IS\325D&\307\n\334\261o\363\030$\377\204;\024\370\026\312\274"
+	.ascii	"T}\355\360\005\303\302\203\n:@@\373\201\233\031\235\227\025\274"
+	.ascii	"\331\037\013*\t\373q\025fOh9\241\243\204\326\177?\f\376\tIdr"
+	.ascii	"\3414Q\246\016\002\310\242\220\322\211\024\001e\352J\252\222"
+	.ascii	"\n\245\323\350\204\353F\234\205Q\t\211\023\231N\\H\310]I\202"
+	.ascii	"\211Cu\235\211\003}\253\307U\230\0355\222\270|\200 \227\332b"
+	.ascii	"[\352e\377\206\f+l+eY\025wE0\370\310\211\211\001`\202\277\346"
+	.ascii	"\264  0\002b\b3\037\266\263 bO\3336<\330\267`\030\007\276\230"
+	.ascii	"\346\023E\330\257\262\355\352\302F\0011e3\2029\253\\\206\007"
+	.ascii	"R\002\372\207\027\nf.4\254Qu\023\240\201nJt\001\270\303\337w"
+	.ascii	"zsP\227\223\033\351\203vKS\264\007\005"
+	.text
+	.section	.gnu.lto_release.19.87a6e081e489cd37,"e",@progbits
+	.string	"(\265/\375`9\001u\016"
+	.string	"\206\234dE"
+	.string	"\2216\035x\rDA\324\350\036\376\203\007\376\273\005fe\341\3322,\254\2337G\224\321v~H\361\326\377\b\334\fpF\263d\273\241\013\003w\351Nu\307P\315i&F\255P\220\256\227\027V\264\266\367\336;\245O"
+	.string	"O"
+	.string	"N"
+	.ascii	"\340e\333"
+	.string	"W\361\230\316VM\360\345\263J-)3;v7\343\234@=\235\037POe\211w\2372v\376\303\317\323\207\033\336w\362\311\341r\0320\201\340!\340+M\016\216\232\224\247\036U>\224\030\255\007\273\353\350}\033nz\333#\266#\330w\t\007\177\t\240\332\310Q`\265\273\262\352\2615\224\306\211\243~\373\376\314S6f\321e,[\250N\273\213\211l\354\235\037\032\263\202\005\335Q\243kQX.F\274\330\354\262\204\234\272\301u\032\355\2578\213\356\240\206\203\354\232d\314\330\005\0238\273N\035\336S\334\252\352\247*|\342\275*\253<\371M\210\325\013i\255RY\022\352@\2117\366a<\206\346\2330\006.\336;\365\271zJ\245\207\030\230\016\243\b\341\300Q\22745`XHqe\203\245(I\330\237\273\273\226&\233F[4\272\316h\032\277\311\247S\222\201\253\241M\223\200\271#\002\342>\023B\233\006\022\221X"
+	.string	"q\036\223L\363d\027<$\237\254\263q\231\b\307\032\210\302\226\2054m\3130\220\364)\253|\352#+-1\344\226T\261mI\006.$Y\362h\356\212p\020\036\304\0065\003D\004\277\314C\317\007\215\352\024\026"
+	.ascii	"\266\311\"x\266\201\021\201xQ\013ta\230\305\332_\325Z\f\244\254"
+	.ascii	"\210K\247\305kYA\316\f\241q\231(5\364\321D\021\027#\250\"\203"
+	.ascii	"\023\221T\203V\2114\245PP"
+	.text
+	.section	.gnu.lto_clearScreen.20.87a6e081e489cd37,"e",@progbits
+	.string	"(\265/\375`9\001\215\016"
+	.string	"\006\034dF\360\2226\035P#\254)\f\236\n\377~7\310\375\310\0023\302\005\226w\373\272j\211\3538\017\324\221.\002\232E0\354z1z\244\\\274J\030\224\3051\302g]\1772\3264\337\254\231\212-\323\022\237F\366\336{\247\024N"
+	.string	"N"
+	.string	"N"
+	.ascii	"\266\375\027w\351\354\231\t\242"
+	.string	"\370\254\223\n\024\230\233\335\315</PO\347\t\324Sy\342\335\247\214\235\377\360\263\005\210\030\3573\371\354p9\017\240D\340\f\370N\323\243\243\006\345\252\307\224\357$F\013\302\356:z\037\207\233\336\266\210m\t\366Y\002\007\177\031\240\366\330a\300\307\256\312\352\307\326P\034-O\375\366}\230\253l\314\244\277X\312\240\301H6\366\316\017\215y\001\203\356\251\322\265+\254\031%ZlvW@N\355\340:\215\366a<Fwp\303;\273\250\230\033\273\240\002g\327\251\301+47\336Y\3343\325WY\b\305{UVi\362\234\021+\032\322Z\245\222$\344q\022s\354\327\270\r\315O\341\f\\\274w\352s\365\224\312\017..<\224b\004\004O]\312\344\300Y1\305\225\r\236\2424a\177\256D\3314\332\242\321uF\323\361%\241\017\211\006\256\2166m\002\346O\210\210\013Q\030m\232\2104rA\304\201J2\r\224a"
+	.string	"\215\204\262\317\306e!\036k\242\n[6\322\264-\303@\323\247\254\362\252\213\250\204\210 \267d\212mK6`1\311\223Ks\227\304\203\360\035\233\324\024\020\023\374/\017A"
+	.string	"d\002\030"
+	.ascii	"\266\311\"x\266\201\021\201xQ\013ta\230\305\332_\325Z\f\244\254"
+	.ascii	"\210K\247\305kYA\316\f\3015\221\0276\266\036BH\r}4Q\304\305\b"
+	.ascii	"\252\310\340D$\325\240U\"M)\024\024"
+	.text
+	.section	.gnu.lto_drawScreen.21.87a6e081e489cd37,"e",@progbits
+	.string	"(\265/\375`9\001}\016"
+	.string	"\006\234cE"
+	.string	"\2216\035x\021\232\204\253]\2171\231\3417\223\206\210\321\372\216\351wq\333\356\320MaajX\361\326\377\b\334\fpF\263d\273\241\013\003w\351Nu\307P\315i&F\255P\202\257\227\027\212\033\331{\357\235RM"
+	.string	"N"
+	.string	"N"
+	.string	"\266}\027?uv\314\004Q|\026\351\204\362B\263\273\331\346\005\352\351<\201z*O\274\373\224\261\363\037~\266"
+	.string	"\261\362>\223\317\016\227\363\200I\004\217\001\037inp\310\240<\365\230\362\235\304hA\330]G\357\343p\323\333\026\261-\301\376J\007\177\031\300*\3450\260cWe\325ce\350\r\025G\375\366\375\227\247l\314\241\273X\302Pa!\033{\347\207\306\274\200Aw\224\350\332\025V\214\022-3\273%\220S;\270N\243\375\226\277\350\016n\370\307\256\251\206\215]P\201\263\353\324\340\025*\032\357,\356\230\352\247,x\342\275*\2534y\315\210\225\fi\255RI\022\3528\2115\366g\234\206\346\247p\006.\336;\365\271zJ\345\207\023\213\007Q\214\200\340\250K\030\025Ki\024W6H\212\322\204\375\271\322d\323h\213F\327\031M\003\363%\036\016\211\006\256\2026m\002fN\310\207\363P"
+	.string	"m\332'4r\341\303uJ2\255\223a\350\214x2\316\306e!\033k\237\n[\006\322\264-\303\300\321\247\254\362\251\213\250\204\210 \267d\212mK6X\031I\222Es\227\304\203\360\0373\250) &\370]\036v"
+	.string	"\300\004\030"
+	.ascii	"\266\311\"x\266\201\021\201xQ\013ta\230\305\332_\325Z\f\244\254"
+	.ascii	"\210K\247\305kYA\316\f\3015\221\0276\266\036BH\r}4Q\304\305\b"
+	.ascii	"\252\310\340D$\325\240U\"M)\024\024"
+	.text
+	.section	.gnu.lto_screenSize.22.87a6e081e489cd37,"e",@progbits
+	.string	"(\265/\375`\222"
+	.string	"\315\t"
+	.string	"F\223C90\345(\035\236\301{p\004\264\201$R\200&l\255\007%o}1\202\272u:\3767\354\002\324\006\2110\276;\266.\202\204\001\245X\2606\351\215\356A\033\\B\b!R\246\0243"
+	.string	"0"
+	.string	"1"
+	.string	"\240\255r\205\033)\315tr*\001\260\273Q\363\201\354\330u\201\354\230j\034|\202\376E~\2610^P)\322SC\330]'*eq\353mol\037\330\337\004\231VMg\246\277i\027.\005,\273\025-\326\266`)\035\266A;c\373i\177\365\020\360\341\350\001\273\252\025\224\335\220\343\270\035s\270\331\366?\016\022z=\334D\225sM\375)\200\277\223@l\273\023\006\376\210\027\261q\034\363G\331\261+\001\314\252\224-;$\245f\330\277VU\266\246\265\207\177\246\351+\"\217K\310\370\323\351\276\220\202\310\343:\tOC\367\201\026\"\007\212\016 O(~\274/v4\346:\006/\2128\316\213\231pok\252)\251\311\227\246j\2521\024\036\246lY\003\017"
+	.ascii	"\266\231E\246m0\302\210\t\003l\356\251\344\252\232M\351\255C"
+	.ascii	"c\231k8\264,`\t&\036\334}R\255\230\204I\006"
+	.text
+	.section	.gnu.lto_writeString.23.87a6e081e489cd37,"e",@progbits
+	.string	"(\265/\375`\322\002\255\026"
+	.string	"V*\224J\300\322Uc\203\002M@=Y(\344\034L\032v\226P\363T\317\203w8\361n\246\247\235kl\215\310\300l4\261\216\263\240\224\205\224\233\245!\270\rA\001\211\252\0221\344A\031Bdc\263\261y(\250\320:\332{\357-eJ\001{"
+	.string	"y"
+	.string	"\202"
+	.ascii	"\020\210j\037\2719\036:*\266\332\n\026\330.T\263\275\327'\345"
+	.ascii	"\340\325\276\213\277\260\375\307\341\252{y\222\204\367\376P\334"
+	.ascii	"B"
+	.string	"_\372\207\332\366[\034\310f\017\311_O\357\314%\355`<\335{[\254\0130_\222_\231/\355\211\333N\332j\363\037<\351\343;\362z\267\223\036nI\003<\"\240Bz9\222\245D\334]\370z\323\323\325z>\270\367\272\362z\035\356\362\266WlS\260\355I\376\345\2525a\237\274\226\307+[M\202V\253\376\373E.\364\247'\372Al\365y\340m\276\350/m\265=\253\353Y\375\001gqG\001\243{q\216R\227X\326Hq\340\177\344']h\247\236\035\3116\310)\235\331\351m~\214\007\235Z\306g\330~D\203^\025\021vp\024\357\315\221\200\276\2549\007\016\364\020\275\345\240E;K\305{\357\311K\257\240dQ\r\201\221\253\033b\021Ga\026W=\317e\276TY\035\240\237\0178\245\237\326Z\223\0376>\221Zmi\217\364\034\256\220\036\336\322\203\265\222\227\344=|\201\251\347\231eco>m\265"
+	.string	"|L\273)\247\370\3601Z\033\365\036\0065A\201X\333(M? \354k\246m\004\017\326\002\364\334{\031\330 \343\223\321\344\036\232\246=m\202\020L6\306\\=\372\326\264\017\356\246p\365\350\264\226\326\326 S\317\273\0251\372!\352\354\315\001\031h\\\354\314K\214\205\231y\311h3\263\006&\26310\227\245\311`\023R\273Rb3\031\026\232\f\026\333\320\022\023\233\2750\264`\257\326\314\253E\246\345\222\315Z),\303b/\262\026\r\006\223\265\322\037\356\244%\261\027~\005\307WO\276\2627\266W\266\301\b\234\315\231\206\274\267\204\312\217\376\340UE\241z$K\252\rV"
+	.ascii	"\241\341\364\364\025\276\320\302\205z\036\2115\037E\342\b\264"
+	.ascii	"7\256\262.C=t5\312\276\216\023k\0167 p\"\031\263\363\266\262"
+	.ascii	"\b\260\215#\030\353P\326\272\002\333\203\367*:\004'\016\336Y"
+	.ascii	"6\030\020s\033<\304`.\331\233n\035\221\355\323\304\030\244\275"
+	.ascii	"\313\006\351%\227A\032\267\262\315\214;\215Z\306\255\\\3771\026"
+	.ascii	"\267\224\r]4\0134@k\270-1\007\301\303\250r\300_\023\302\246\227"
+	.ascii	"n\247\023\275\242\253&n\364\bE\024\013t\257\205\302\fL\036y\004"
+	.ascii	"G\330\346\n\032\336\335Hm\320^\244)\205\201\002"
+	.text
+	.section	.gnu.lto_writeChar.24.87a6e081e489cd37,"e",@progbits
+	.string	"(\265/\375`G\001%\016"
+	.string	"\226\232^D"
+	.string	"\221(\035\240\321\366+&\246\212J\241\017\217\002\200\246Ml\366\336\230\217\262\005`g\001\264\006\233n\3002\f\265\347p\035yx,\210"
+	.string	"\257\226\333\2559\2317\013\f\023\006\372L\006$\232-\277%D\312\224\002H"
+	.string	"O"
+	.string	"G"
+	.string	"\377.\034\300\356\312\245\305\356\367a\250=\363\247\331\366G\234Dg\277\300>\226j\203\212I\245\200\331]\370\271"
+	.string	"\3153\354\0014\317\324\303\273g\347\337uL\004\213\305S\235\236\033\005\273\353\364T)\267\336\366"
+	.string	"\333\r\354\273\004\232VMg\226>G'E\206\007\214]\224\227\314\306\310\\\200x\313ow\276\313\036\253\370\212\356-&mCh\030P\310\274\354f \360\314\f\264g\035\271\362a\201\212\311;\0265\003ED\3236p\240{\313\304\272\253!&\301\323~\211\233\350\002\035\265+\214\362\336\246\237\224\236\314Q\325\247f4M\ra\261\274\244\261\375\241'^07\256\266\013\334U\332X\273\033r\257\006\246W\017\033\251\231\223|\331\337)\265\203}lu\345\355\337\337y\353\347\\\345\327\276\362c\001\023J\020\024tS\344\224$\202\224\304E\007\036\203@D\243\222\007$.\212,\214\220\210F\241\b0\206 \205\320H\t\004q#\b\362q\024I\340 )F\016z\276=\266\272\332\024\301\206\023E\331\204\355r\020yi\345\313\234<\213\273\"\244\341\245\252\006\035"
+	.string	"\266\231E\246\275\246\326\306\315\224\247\231\342t\231S\312\232\257\262\331YZ\316\b_BuM\324\331p\307\262\330\003\033\373\225\271\001M"
+	.string	"\306\001\320\007\006\003\203"
+	.string	"\234\3010>\003"
+	.ascii	"#\004*\034\334}R\255\230\204I\006"
+	.text
+	.section	.gnu.lto_isTransferInProgress.25.87a6e081e489cd37,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\035\007"
+	.string	"\242M25Po\322\030 \356\024\300f,\254=\346\033\016E\022\240j\352\267Ly\340h\b\222wdg6\026\tw\233\r \r\023\275\266N\240r\013V*\255\205\304\275e\n\231\214\f\325\036\316\205}\0342\031\257\211N\304\205Y\0170ZP\302\352|\240Gb\220\2639^\020\022f1JX\315\325\215\332T<\213\237 \367<^\001vw\177\243w\r.\245\027\003\322n(\006fY\246\225\220_\373\352w\356uDI4-\241\320\200\335Q\213\312\356<\030jtz\352"
+	.string	"\245\223F\005(\235\376\021\022\2647\235 \241\314\205\006\306Iiw\302\367\241\233\272mU\023%\020A\351 \245\210@\3522\013\273\273\313\020m\350O\377\202_\341\347\b\b"
+	.string	"\266\231E\246m`\344\250"
+	.ascii	"X\005D\327<d\2070\257k\222\001"
+	.text
+	.section	.gnu.lto_resync.26.87a6e081e489cd37,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"\245\013"
+	.string	"\366VP> Q\233\016\217\203\024\taV\201\033\307\312/\027\2319\b\002\n\215\342\007F\030\345\241*\365\273\3260\301\255.j\301\301\230\377\007\3000"
+	.string	"\203T \354\b\026A\224%\214\256\310\337\335\244L)="
+	.string	":"
+	.string	"?"
+	.string	"\027\260\373y\021c\267S\340(\375\271{\001\370'}"
+	.string	"\374\263f\327x'\262\223\220\016\037*n\354n\324\017\327\236\232\177\023\007\260\201\\xN\030\354\256s\003\341p\353m#\260\275\300\276\206\357J\001\221\340\340:\031\262;Oj\210\375hw\327\372\261\317\375\222\246\241\246_\246#M\253\2463\323\237\002\210\230\221@\306\356\206P\216-y \020\223\355\247}\022/\241\235\363\b!8U\233:\213J\332]\213\277B#\201\200\310\356~\304\003\376\245\216\315\006\345\025LUU\032\031<x2\344k\352?v\330z\n\n\322.\006\213\177\342(2\177\344\317\0258\371\355\317\347\300\007\033\314r0\031S\271\262\352\301\006\263.\013\227\tWFA\210\026\0255\324\245\212\030,\213\225\003\266\256\f\0267\226\205\305\251\353<Z\375\270\301\210\222\216z\f\325\316\234\304\300+\370\024F\372\"\334E\213H) \030\001\023"
+	.ascii	"\266\231E\306\036\344Y\213[\245\006\277\300\336\240\f\260\007"
+	.ascii	"\266\013\00711\345\241\304\306MX\"\244\022\273\301\254KX\315"
+	.ascii	"j4\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_txBytesFree.27.87a6e081e489cd37,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\225\007"
+	.string	"\222N45Pm\323\001$\243\352\246d\277\243\242\311\220P\033kF\270\325`\003\363g\243\021\364\2714eV\315.\336\321\321d\220D\2555y\273\r\257\243\311\333o[\356\224\002\230%\021$s4\325\325I\300,Yy6\f\325E)DI\305\006j\323\211\034\353\212\232\311\262Z\260\"&\245\025\245\271\267\352\004\241\037G\317v\360\274s\252\323G7{nOC\366\341*\310\n3$'\004!\273\022+*k\022\215`\330\316l\311\366{\366;\356\221}>\034`\027\204\"\262;\013\0341\217<1\266\375\215sd\326\340\264\3502!\212\b\220\224\335\031\247\013X\036\301\007X\036i\305\265?\315\377\307\241\306E\t\327m\177\227\203\335\365\343\272\211[o{\300\266\201\355\214\013"
+	.ascii	"\266\231E\246m`\304U\335\341\232x1\321\022\215\333\201\t\002"
+	.ascii	"N\030\251VL\302$\003"
+	.text
+	.section	.gnu.lto_mspDisplayPortVTable.28.87a6e081e489cd37,"e",@progbits
+	.string	"(\265/\375 \375\375\005"
+	.string	"D\n\303"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"\005\001\212\001\202\200\200\374\342\203\344\302\005\177}\370\337\362\003{y\270\337\242\005wu\370\336\322\007sq\270\336\242\005om\370\335\302\005ki\270\335\262\005ge\330\334\002wc\334\302\005wa\327\202\005w_\327\322\003w]"
+	.string	"?\202\210\200\330\001[Y\305\001W\304\001U\303\001S\302\001Q\301\001O\300\001M\277\001K\276\001I\275\001G\274\001E\273\001"
+	.string	"\013/root/repo"
+	.string	" ./src/main/io/displayport_msp.c"
+	.string	"\013"
+	.string	"\240h(\332\nE\003R"
+	.string	")\200\024@\n %&)f\222:"
+	.ascii	"8"
+	.text
+	.section	.gnu.lto_displayPortMspInit.29.87a6e081e489cd37,"e",@progbits
+	.string	"(\265/\375`p\001\325\r"
+	.string	"\266\231[B"
+	.string	"\223\223\016\257C\001$\255\t\323\364\235\f\226\n\t7@\354\2348\3243\272\002\322\376\033\027}\231E\365\001\001af\245Z\027\252\306"
+	.string	"@QCU\275\252/\034\016\b-T_-j\024i{o)S\nC"
+	.string	"D"
+	.string	"J"
+	.string	"\273{\375\331$\366\365w\273\304\276|\023?QbS\201\310\262\002\340$\225\002\263c7b\216'"
+	.ascii	"\377\254\013\200\177*"
+	.string	"\342\246\247\311\377\313\235K\313JS1yj\026\354\256SSY\271\365\266\021\330\336\330\031 Oq\025!\277\345\317\331(\257\375\371#X\272\220\327\234\251\0162'jbGTj\b\373n\025\204\355\322\226Kk4\r]\372\271\264\323\264^\027\t\034\tfv9\254z\254\314S\215\360Q<\222|3\203\031\227!0\322\207\246\343\034\350\364\251\346@\361\200\312\225U\235>\345\307\243!<&\202\265\233!\304O\335\205\210;\236\364\300?\325\307+P\305\360\330N\2712H~{\013\220\265\213\262\342,(\270\017\b\202\340\337\267\303\214\254\335\3235\007\366lD\245\220\310\b)\023a\350T\020\225>\022\260\354\203Y\370tB\230\207T\3026\007\234\211&\220\260\221,#aW<\375\206\215\277\374\0334|\2209)\312V\203\327\240a\340\034\250Q\013\252\306\301g\310\200\n\242zQb{\372\350\007\217\301\031\300\262\273\001\037"
+	.ascii	"2\003\3020\342\206\301n`\235\225\006\026\0132\362\001\033\020"
+	.ascii	"_\240\f(\003\230\201\355\312!\006\022\270\302*:&\211(HkU\004"
+	.ascii	"p]WM\006\361\300u>:\244\033\002pM$\310\204~*\036@E&\356\264\251"
+	.ascii	"\235d"
+	.text
+	.section	.gnu.lto_output.part.0.37.87a6e081e489cd37,"e",@progbits
+	.string	"(\265/\375`o\001=\016"
+	.string	"\026ZZB \217\223\016#\352i\343`\200\360\315\375\310\026[\255\344\b\024\340CV\201z\353-\264\2136\024Y\264o\005\326L\006)\322\023\377\026\2520\325l\310\333\023\f\274\017\316\334 \r\202iZ\021O\366\2262\245E"
+	.string	"L"
+	.string	"D"
+	.string	"\216\326\241\375\021\241\022\333\276\210\243p6\314\353@\224\026\244\030\235V\354n<\304>\240:|\027P\035\352\207s\327|\234\237\244\222\350\372\324\r\240P\220J\032\236\027\177"
+	.ascii	"6v\327\326\206\033\3366\003\333\016\354\237\b\206-\240\007\330"
+	.ascii	"5\2614\2608\373Z9j\2172\314\323\354\210\007\223\227\335U\360"
+	.ascii	"\362\247P\267\031^\332'q\025\356%(\020\320\354\210\n\206\004"
+	.ascii	"\235e\315w\316\320\b=%\344\335\222\224X\323\316\320\340\236\022"
+	.ascii	"b\3355Q\361\262\333!8\fOUS\355\t\236<\t*6R\221\257\251O=3j!\222"
+	.ascii	"1\251'\326\367\267jr\245i\370\225\377\375\364\253\246\363\335"
+	.ascii	"\377\314\013\240\354\222\304\260\330\016\320D\210\273\334>K\310"
+	.ascii	"O\371ri\001a\"\016\007\016\003\237-{p\201x|\250\004P\004\355"
+	.ascii	"\350l\324\033\f\315\323\201\360\3312\255\002\307\207\346\341"
+	.ascii	"t\304\214\023A8\034\235\270\331<\021\003s\246yl\361\223e[\274"
+	.ascii	"l\347\325\344\247~\221P+\275`\273Ro\210\250\005\325\023\333\231"
+	.ascii	"\364\263*' p\002!#\353\001.\236!\003\306(\236\350\221\207\021"
+	.ascii	"\376\030\201\305\310&FQ\243\031\n\f\220\314\326\030\265\366\355"
+	.ascii	"\227\250\003\265!RF\204\357p_\f\036\354\332\331\236\rZO\255\335"
+	.ascii	"\f#\372&\327@\200\003I\204\306q\254\254\006\311\027\271\0204"
+	.ascii	"\257p[x\2362}\376\265a\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.87a6e081e489cd37,"e",@progbits
+	.string	"(\265/\375`\246\001\225\b"
+	.string	"\224\013\242\002"
+	.string	""
+	.string	""
+	.string	"\002\026\177\026\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\300\202\202\200\006\031\177\027\032\177\030\005\013\031\201\204\001\033\177\032%\177\033\271\200\202\202\200 \021\177\034\005 \035\022\177\036\002\025\177\037\024\177 \023\177!\002\027\177\"\030\177#\035\177$\272\200\202\005\017\021\200\003\005\034\022\016%\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\f&\005\002'\001\037\177(\377\037"
+	.string	""
+	.string	"\200\200\200\001!\177)#\177*\"\177+\036\177,\003\004\024$\003\005\025D\003\006\005\310\377\241\372\001\001\202\001\003\b\t\n\013\f\027\f\026\244\006\003\f\242\007\003\r\f\302\001\003\016$"
+	.string	"' \340\002\241\031\223\007d\222\t\371\320\204\2314\260#\301\233\331\362}9\267\252\006q0\f\365"
+	.ascii	"\034\001\016\037\310\365\245\240[0\226\0373\\\236\035\202\312"
+	.ascii	"\\A#c\254\341\030\250G\264&(\243\324#iM@\007q\215\323q\013\212"
+	.ascii	"cX\003\230-\225\3415h\3668\001"
+	.text
+	.section	.gnu.lto_.refs.87a6e081e489cd37,"e",@progbits
+	.string	"(\265/\375 oe\002"
+	.string	"r\005\017\024\240\247\031\003\377\377\377\217hm\213\375-d{i[\231d\n\022\256\007\003~2\035\230\330\315g{\2700\317\2559\222\224\216#/\226nA\321\212\204\0353\220\027\t9J\251|\265\020\005"
+	.ascii	"U\305\203c\240\t\220+Wi\002"
+	.text
+	.section	.gnu.lto_.decls.87a6e081e489cd37,"e",@progbits
+	.string	"(\265/\375`\251 \245\226"
+	.ascii	"Z\362\2245O R\322I\007\362YUe\001\374\233d\242\273\353I\005\340"
+	.ascii	"\361\322\374\332\325T\033\301DD{\032\017\n\3405\351\246\265\210"
+	.ascii	"\314\210\326\204\310\363\003\r]\t\021\021\025\021\216\252\312"
+	.ascii	"\nQ\025D\253%\240x\016\210\262\264\031\"Z\213\006\221D\262\245"
+	.ascii	"L\001\331\002U\003Q\003\215\n\t\275o\211\224\n\313"
+	.string	"y\327\246\020\242m)\214\203\372\361\370{\323h\037\220\316\232S\223\f\316 \217q\252\203\312\202\206\335Z\364=\221\t\252\341{\"\023d7\374\206\3330!?y\220\327\234\331\260\363\214\345\214_s-\360\357\211L\320\305/4\310i\314\260\216#K-<hN\357P\3378\324s\241z\026T\317d\3243\027\025\250\307\314\233;\274F\375\2240U\2455\332\347l\262s{\\n\032=_Q\357B\013\323E\201b\306\345~'\230\230 \214)\t\304\002\307t>\366^\256\262f\226:\246\243 \312\023\231\240\023\215\325\310\246\004\362\020,\004\227a2l\206\3050\037\353\361\223\367\030\357\f\206\363\016\344\274\267\211\327\330\330\215\363\260,`r\306gaX\315G\351\274S0\326\236\310\004\357\275B{\334\205\357N01C\340\n\013\274\327\371\b~\236\362\267p\301{\274\205\351N0\335\313\265\345\263\374{\252\022\274\327\351"
+	.string	"\220\003\0168\340\200\212\204\3569\025"
+	.ascii	"z\276R\031\210\231"
+	.string	"\352\317w\374E\307I\210\327\322\351\003'\3254\330\350\331\216\2758/PO\03411I\3654\324\317PO\244^\006\365-\250#\342X\216\237(x\316\371\323\023\007J\034\302Fo\202zF\221r!\243H/\202\n\344\326\334\306og7\276\302\323\344d7\364\336%s\002>\314\t\344\324\201-\253\244\3509Po\201\232\202M\244L\205\253\360\023\210\255\274\205\213[%\225kv\357\375a1LRZ\215\336\205:\300\362\2728\217\372\303-d\240\364\255\006\261\211t\004\227H!`\023)\233\241\260L\250\256\273v\257\223\304\217\363*JH\243w\262\211T\345\022\351\317i\203\r\310|n\004m\013?\313\360s\f?\247\360\263\214\237g\370\031\206\237Y\370y\205\237_\370y\210?\250@\202\007\032@\341\377\001\177\243\375,\245\215\t\377\323\277\353\006\331\374\314f\200#\270\267\375\267\177\277\375\274A\214\237\213\370-\017\327"
+	.string	"\376\254\367\007Cz\023\177\027\376\347\373\037F\375\273\215\0077=\020\372"
+	.string	"'\207\373\374\335\346g\034\374~\342\347\343\317\3573?/\371Y\354\347&?7\177\016\373\231\311\317c<~\006\373\031\311\377\236\337\032\1776\363\363\230\237\273\374\374\374\371\354\347\262\237\241\374\374\344g\246\237\357\317?\374\354\303\317=\374\314\303\317;\374\254\303\3179\374\\\343g\033~&\376|\364\363\214\237\327\377p~\256\341\177\337\3174\374\214\342\347\235\237\r\370\231\200\377*\374\\\342\377\334\317"
+	.ascii	"\374"
+	.string	"L\342\347\021?\363\374<\374\231\377\307\371\377\346\377\337\177\277\377f\377\037\370o\367\177Daaa\341\217\"\375(\214\037\310M$n\323]\246`6yU1\323\226U$\230i^U7\315\353\216\270MK*\034M\227\212\304M\363:s\323\272\252F0\323\272\252\230i^X\214\307\324\303\253\262\"\030$\212\2010\233\256T\224\326\222jD\036\323\331u\311\334\313kN\227J\201{\265\272\250\310,yp\034S\236\024\223\333\262\353\022\020\305\024\244\3536\3451\305\272\356\025cB\272Q\022(\235y\327\b\347)\205h](\247{\013\210\272W\3117\357\336\253\274\367\016\251\264\234\367\366\030\301lFE\335\213\005\024u\265\224rN\367\366\032_\\\0253-H\227\220\234\225\264\346\275\341Tr\363\222\361\242R\323\224h\027\352\336\313i\324f\325\0164\215\266\230&k\356u\tB=C\341\376q~\366\217\316\003\301y\225"
+	.ascii	"<\301\254T4\030\236$;\334v4zT\251\236\315\316:\255\313\023\231"
+	.ascii	"`\020!}\204\354.0\b\222\016\373\"\345\331k\\\204\334:\354\205"
+	.ascii	"\333\337\\\372\256\2774]gi\274\266\353-\255\245\353\332\013?"
+	.ascii	"\273\013{yw5\220\366z\353\271\023\360\314\330\340\232W\2604\205"
+	.ascii	"\332:\314GI\342^!o\315\2616[\300\313\023\031Y+\351\322\315v\302"
+	.ascii	"yX\316\253\343\205\335\023\331\220-\2566\2409\271T\252\257\217"
+	.ascii	"\013\313[\256\343R\271/_P\215\0065\234N\223\363\246\351\354\245"
+	.ascii	"\331Z\023T\373\324\333!\324[0\352-\235z\273\266\246\206\332\t"
+	.ascii	"Jic\345\255\346\023\005\305\013\016)iUD\334\351\215\031C\345"
+	.ascii	"]\345g\212\371\244\321F\353\2577\"rR\215\266\223\351|\324\274"
+	.ascii	"\220\001i\264\247\354\224Y\261=\321zB\370\264\267DMaV\3463\027"
+	.ascii	"\307\f\213\362.\333!s%\004\\\243\r\245\277~\262\272v\2405\332"
+	.ascii	"dC\035Kz\364h\264\2370\235\b3\200vsL\227\023\204M\037\334\227"
+	.ascii	"\0231\225\215\033\347\232&o1v\3430\203O'&>a\240\230\370`\262"
+	.string	"d\030&\n\030\341\320\211\021\2566:T\b\270D\030X\272v\245\311\233$o\260:\f\272\254\334,\363\210\021\021G\326\024\201S\344m\344\177<\367D\317\351I1k\364k\372\353\277\016gY\371Q\344\213\b\221/1<\372.\335^\016\253\036\302x\303\033V~M\032\275U\252w\306q\2114\307\311\245o\353\374\354-\216\023\344\274J\031\276\\\215\t^**\025o3-\037eVD\222\350\310\021:\t\242\321\316J\367\250\n\235\032}\203\251\035D_\361\263\261\376\346\301kG\251t\335\264{\235=vyu\007\327(\032\224\376p\220\025\323\265\336\035\024S\243N\236\251)$]:v\242\204\331\322\252\242J\325\350\2524\033}S\375=\305Y\032\212\206{\235)\0204\260\272F\233K\244-\204\336R)Y\026 n\236\035\005\325\301\230\0173\215v\216~zC5\216\206\222\240\353\336eC\375\274\271w\371\303\234"
+	.ascii	"s\002h\224 J\256\244\350\273\b\363\306\024#aB4\372\276\3617\020"
+	.ascii	"\355\324$\342\n+M\226F\233\212M\244\np\211\264\231\204\336M9"
+	.ascii	"||i\364\032M\200K,[)E7\205\256\321\267\222\216\206;\300O\335"
+	.ascii	"Ec\027r\367\353\2509'[\215\332\270\003\366\270\241\025\321\262"
+	.ascii	"pxA\364\230\032\265n\366\215\237\267\263X\3563w\203\315\216P"
+	.ascii	"\375\017|\273\324\262\335^\371ut\346\270\206x\245Y\273\262\347"
+	.ascii	"\243\371\247~8\204\323:\355\023H\275R\202\370\b\354yn\361\201"
+	.ascii	"\325i\267O^\202\001\304\321\250\255\302t\352Y\216's\215Z*me\246"
+	.ascii	"\265v\326\250E{\235\245\362\346\345\254{\210\210bB$\253\213z"
+	.ascii	")R\354\031S\271S\021\304\021\n\222\335\213\025\224Z\001\214\362"
+	.ascii	"uf\371\236\344)i\364\303\2572~\332\262\216\313`\355.\253\202"
+	.ascii	"\352\272\006\265\004/\025\027\025$\300\362\236\260\201b\241\214"
+	.ascii	"\2707HV\334\317\340\336\031+v\026\210[+~Z \354\023 4\247r'\213"
+	.ascii	"\226\n\021^Z\306\320\032\035\033>e\265\255a\341a\261\310\004"
+	.ascii	"f\265\225\031\230\300.\3535\366%P\210M\302yX#n\023\226\276\300"
+	.ascii	"{\257m\332\036m\205\327db\235X1\273\304*\261M\370i\2336\310m"
+	.ascii	"\020\366\352@Yl\323\372\260?8\257H\006fw\201;{k\224\344\371\240"
+	.ascii	"<\356w\306\027h\223\330!\026\311\316[3\r\0230\033"
+	.ascii	"\306O\233d\215\200\036\3022\202g)\022{\204'.\207\217\033\215"
+	.ascii	"Z#ivOB\266\276\370i\213\374\335`\002'\254QK\344~(\016e\216\247"
+	.ascii	"\264\207\372\324J}z\003\210*D\340V\252T\237\003G\265Zv\213\237"
+	.ascii	"\fX\256\347,\235\327\331H\340\260UQ\243\236\031Hma!3\220>\007"
+	.ascii	"P}\316\020\352s\304\250\277\305\262\312I\363\242\006\017O\355"
+	.ascii	" *\253\303\356\210\022G\244M\213z[U\302\0210m\257K\255\324\355"
+	.ascii	"\324\257\323vJ\232Qr\352-\224\215\"\023\306\206\306\246\336>"
+	.ascii	"\265\025\252\311j\324\346P\235r\312\030\020\261\205\345\207\315"
+	.ascii	"\361[\246\305\321P:\024\302i\323\350\311\260\211\264\207K\244"
+	.ascii	"\326I\350\366\306\016\236\226\300)\215\362\344h\331\245]Z& \332"
+	.ascii	"\260\202:K\224\301&_s\313\324_}[cO\034\352\330X\227\r\236\235"
+	.ascii	"u\025\270\2666\256+W\300\330\330\032L\035q\231\364\314\232nn"
+	.ascii	"\r\326\315\241\032SV\340\340\263\007\231.\003,\365\232\305\201"
+	.ascii	"\t\274\227\213\n\237,1\261\034\245\212\004I\203\0256/\026U_\247"
+	.ascii	"\351\3536\351\275\354\354\232\242b\363n\323\203'\306\t\260\321"
+	.ascii	"^\243\306\317\257\321\250\312{\033M\235\334\330\236\224F;\260"
+	.ascii	"\277\322-\312\036j\2156 \323\331f\030>#\215\366_[\365D-Y\252"
+	.ascii	"\275\016\rB\256\354nP=\332\247\276\275\265\234*b\310\217.s~v"
+	.ascii	"\231\326C\225^\260T\244VP\316\260\300\251B\204\264\021U9$\253"
+	.ascii	"\331l1\306\272V\210\247\2531\262\213e\025\364\036\323B\274\237"
+	.ascii	"\177\266\032\b\367\336!\323\025,\252\240\277\377\364.\251\356"
+	.ascii	"\275:r\234\227\212\211'\345\034\346\240\277\207-+\360\037\275"
+	.ascii	"\227\200\017\356U\252\t\252Q\233\300-}\244\270\317\311\273\267"
+	.ascii	"\311K\231\201WU\223\027\017"
+	.string	"f\232\327U6\205)IP]/%3\355^\022\267\251I\311A\327%\301L\273U\027\b1U|\235^\312\333\324u\003Ib1\204\235\365\270\244\204\026\327\244c\022\231\036i\005\222\305j\264\224TT$\2628\"\227X\b\220\224\264T,\032\213\303\344PZ\303xDJ\032\213\303\031Dk\022jC\251\210\306J#EB.\235\200\034RB\3228\241B\022\021\361\270\312@Z1\202\n!\310`\221\\\217\216D\311\033\212\214I1\326\2431\306\217\r%c\214\002\222GZ\241\264d<\036\r\035\327\344J\203\350H\244\304\342\2108\243h,Z\240\250\270\344ArE\356\024gtrE\256\307\034\344\320\221\022Or\250x\244\224S<R\262\311\241\027B:\020\221\250\221\021\321\320\206\222\261\b=&\225\254\321Z<\"&\021\r\215V\344\022\212\034\3768t\244\264\242\307\3061\211$\036\255)\034\220$\026CPB\222"
+	.string	"\300jd$\201\230T4L!X\221<\022)\255H.)%\227\214=4\326$\322\206\214!%$\t'^D<\256\305\365H\275\004/\036x\001#\207\341aP"
+	.ascii	"\001\005\020\244\207A\201\220\020\005/\204\324\277\020\262\311"
+	.ascii	"\344P\213\b\324u=z\200\\\22366\310!\271\203\256H\2425i=\016w"
+	.ascii	"d\324 :\032\211Xu \312(\256\353\261\b)\342\250H<&e\354\034\211"
+	.ascii	"\220b\254I\342\261\206\016\022\271\036\217\214\307\023\212!\034"
+	.ascii	"\327\031\310\"\321Q\005$1\200$\321ZC\362H\264\"\351\024\025m"
+	.ascii	" \327c\032\300S\254CE#1Y\264\036\211\034(!i\370\034\211\220\212"
+	.ascii	"P\344\320\232D\234a<\236\020@\222\261H'\211\\\262\301H\203\032"
+	.ascii	"\306\243N\362\270\342P$\2467\024\021%\325\360\203D\256\305$\322"
+	.ascii	"\021\361\270\301\232$\"\325\370I\036i\005\362\270\342@<\032\241"
+	.ascii	"\270Qi=\262H\032\215G\026;\311\342\2221F\rD\307#\035\344P\017"
+	.ascii	"r\210\205\344\321xB\2115\251\006\"\025pH\327\"\"\016\253Q\212"
+	.ascii	"\254a<\242\310$c\021\352\302\322\360\005\244Q\tM2\0327\030\312"
+	.ascii	"1Z\217DkR\32109\004#Y$\246\237`\202\030)V(\341\003\265h\205\022"
+	.ascii	"\222\306P\362hT\262A\224\244\204$\032\2610\022Y\024\211D4X\024"
+	.ascii	"\035\221,V P\303\230\302\321\210<.\025\351\020\332gO\263\r\222"
+	.ascii	"\275\301\316C\225eS\334\270\261f\266\226\260y\262\202\366\f\007"
+	.ascii	"\327\037a\243(\223\227\035Zkn\331\240\271\002\342\243Q\233\306"
+	.ascii	"\252y\322\274R\246Q\277\277&}sg,\232\237\"M6\272\003>\220JPL"
+	.ascii	"\220/\260\313P\252\214\220\b\240\035\02375\305\312_\233*P_M\374"
+	.ascii	"Z\3176q\261\2055\272\267g\315p\225\251'2\301\306\213\022\347"
+	.ascii	"\215\357\326\314y\314\006\225@\032\265e\372k\350\244\312zB\346"
+	.ascii	"\\M#N\310\330!\274\200q\361h0*[\031\275-0\273[0vv\214E\243bu"
+	.ascii	")\317\\P\347\246"
+	.string	"\347\255\007\224\256\274\3331\267z-\\X8\251:/6\215Z1>Xws\201a\254\226&C\322\036P\251\\UUY\274\235\263:'\275F\355\335\355\032\021\251<1_~\035\2363I\256\216\024Q\257\002Q\273mS\263]\254\036\317UR\271S\3036(^b\202\227\211\025\344\363\004\3505d\356\266\313-\227\026.\356W$b\305J\243v\313\255\026#i\2540\353\254\226%}nq\032\275\272Tm\226\007\266\006\201\274\241+\"\006\314I\243\035\202\245\250R\3714J\342\0203\206HFd$M\222\016R\n\020\006\203i\036\250\251\036\022\34049\3219\347\314\214\210$IQ!{\314\001\252\215\213L\334{\340\262\252I\214\020\022\020\323\316\362~\254\032\037\240\320\245\270|HEa'\204s\354\224\352\036\256\375\345\252Z\233\360\177I\227\232\253\311\245\0013\250\202q\033cE\266\217*\213\235\240\337#L\301w"
+	.string	"\371\n\353\351\251\036\353\005\232\033\304R\262\022\025\367\037=\363\366\204\212\024\305\352\301o\t\036\031\224\233\225!<e\253\260\316\250~\323\250\003\017\027\265K\355&"
+	.ascii	"\306\355\361U\026\343\321\024\312\207\"\005\210`\256b)\2041\322"
+	.ascii	"\036F[T\201-\330\r\t\211~\217\r/\244\362\266\225\217\204\332"
+	.ascii	"\030\373B\342\202\264OA\247\246\007=J\220\231\201\303\013,\026"
+	.ascii	"F\347F\026s\245W1\007\017i\370ORd\222\3134\306\234\236JP\327"
+	.ascii	"\2322\363~\215G\355\271\315\371\304\227+\334z\265\316 w\335h"
+	.ascii	"\260\013\"h\0319\343\204\024'B\340}\356\344\006puDB\254(+\373"
+	.ascii	"\017qhu\221uh\364F\036\341\256BT;\201}!\216\244j\262D\233\223"
+	.ascii	"\336\2057\001\347>\230\266\030\222t;\325\362e\364l\242B\264\r"
+	.ascii	".&/\030`\313oQ\353r\264\200\030p\022\270\334kp\256\020\331\352"
+	.ascii	"\325I\242\020\025%_+>\262|F\351\373\"\351\347\352QgC\"\224)q"
+	.ascii	"%&>\367\201\272\266\274\251\347\261\265\3724\260\326\260\240"
+	.ascii	"\356&\320\300\240\313\344@\334\227\315\0011\311\267\337M\236"
+	.ascii	"@\032\246y\006_Ar,\372{\233\220@t$\004V\306\367C\n\211\te\201"
+	.ascii	"t\337\307\216\335\267\023\207\312@\006\370:c\353\303s\320\t_"
+	.ascii	"\277\345\266\203\260\b\231\301\0267A\373\242>\354]\213\322\264"
+	.ascii	"\032+A\322\221]T\022\354T\020[\027#\207\262\242a\305\0258\225"
+	.ascii	"H\347\376p\032J\342_\007\320\332\307S\\\n\250\271\025\272\021"
+	.ascii	"\207\037\021\204\016\374z}-\253\223!\310A0[=\024\006\026\314"
+	.ascii	"\371/\036"
+	.ascii	"\\\f\256K([\315\372\210\0305\214D\364\004V\007\367\260|\234\373"
+	.ascii	"\320\243\177A\220\213\353\340\215\237\210,\231<(\f\f\232(\201"
+	.ascii	"\177\246\243\024\377O\323\272{\017\202\004\222\021\250ES\375"
+	.ascii	"\320-\250f*\016F\312\253\335\355\360aa\276\373\360\262 \207\342"
+	.ascii	"\354\"Ul\3307\361_\017J\361\236\314G\243)\305\216\312tJ.\235"
+	.ascii	"\206\253\277\345\346\027\006\301\206*+\305h\245\243\343\214\220"
+	.ascii	"\362\372\005\262\024\370\203\0062dd\323\003Y\362\246\n\215\363"
+	.ascii	"\333\271\240\262\323\224\246H\345\202V\363(>%\232,\253\331\335"
+	.ascii	"sX-I\274$\251l\272\334\305\344\344\274\307a\005OU\336\367 \340"
+	.ascii	"5\207K[\0078a\2136\025\225\002 k\336\200\276\351\332\367\234"
+	.ascii	":\300\033>d@\341\001\023\240\314Z\214v\266\321y\332\3638h,\322"
+	.ascii	"2\0040\205^\243\234\"p?\024`,A>E\005\006\347\357\355\023\303"
+	.ascii	"\251\275H\013\002\374\256\262\335\304\251U\361\033\025\230\265"
+	.ascii	"z\221\245-\005\325\211@l\231\227\307\343\307\f\020~5\217@\214"
+	.ascii	"\312\351\316\207\263\025Q\361h\246i\236\021o\371a8\344IU\f\021"
+	.ascii	"\332n\"\2127\363$\263$20!-ee\006+\261\022\216\022\036\327\365"
+	.ascii	"|\245\027\351\233R\354\342\212\225T*\335Nj\310\310\333\221\003"
+	.ascii	"5>3\337\222\313\213\363\256-`\004\001\353e\204\335E\360\300\374"
+	.ascii	"\b\321\221+w\003z\341,i\322\317\263\266\257@0\021\026;\225\364"
+	.string	"\032\032\r\361sB\324\216\271\0043\n\rc\352MA\2670\037A\233\035\330\205,\300\343\253\366\347\007\026Y\020\004l\243\214bM\361\326\213o\230X\242\\\262\337\213\352\314\354iY\251&\311\330-\237N\234k\327S\034Xm\311v\203OB\225i\200j\177\327\322\253\350\0338J\242\303\354\303x\211T@\340\325\tCf#6Q\304\340h\220T}w\314\302\327\201\201\240\356l\363H\216\332\271\376\026*yq \220\314\236!\374\r\377\337\346\2375\035\377\032\016\222\215\t\240Jg1=T\b\330\211\r\250\314\201{\347\215*\202\273eL\335M@0\321g;\007\b\313\335\304\326\202\277\034\272\021gu\3300\307\201\357\241\320!\b\306\264d\244i\021\346p\031@\1770\026\245Q\331\270\305&_=\033j\240\370\263\222\327\333-\037\t\345\204\335\f}\236\355\026\360b>\240y\235\374\b~\343Z\204~\016\3337\247\305"
+	.ascii	"9\300\025\013\357\353\371\333\233/\345k\303\217\320\235I\237"
+	.ascii	"u\353\360G\205\257O\257\250\232\263E\274}\306L\355\2078\2774"
+	.ascii	"\367\346v\035\344D\347\3674\376\275\352\241tT\350\242w\317\300"
+	.ascii	"\306\031_\264\307d\374\266\273\noD\357\360}L\273\177+v@\330!"
+	.ascii	"\264W>\206\210\f\372\372}\372\305\b\275$z\037\302\275?\277\355"
+	.ascii	"\237\353\007rgQ'bS\234C\203\217\262b\231\334\005\341\335\231"
+	.ascii	"+\366\212?\247O\217:\262\260\372\225\215\227?YY\207}\373\370"
+	.ascii	"+\300\257a\002\356\306\276CF\260c?\336\022\274i\2134\331\257"
+	.ascii	"|\301\275\231\n\377\340c+"
+	.text
+	.section	.gnu.lto_.symtab.87a6e081e489cd37,"e",@progbits
+	.string	"displayPortProfileMsp_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\001"
+	.string	""
+	.string	"displayPortMspInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\001"
+	.string	""
+	.string	"displayPortProfileMsp_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"displayPortProfileMsp_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\001"
+	.string	""
+	.string	"mspSerialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.string	"mspSerialPush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"displayInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.87a6e081e489cd37,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1974 @@
+	.file	"gps.c"
+	.section	.gnu.lto_.profile.eb51553ef5eb4835,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.eb51553ef5eb4835,"e",@progbits
+	.string	"(\265/\375`\362\005\315\023"
+	.string	"\004\024\346\006"
+	.string	"@"
+	.string	"\302\372\202\311\007\006\002"
+	.string	"\001\224\367\311\301\rr\002\001\002\001\003\002\003\002\004\002\005\006\002\005\002\007\002\007\002\002\006\b\t\007\213\326\277\344\004\003\240\342\234\212\n\004\005\006\b\t\n\013\f\r\016\017\352\263\360\321\b\020\334\307\272\354\tt\006\002\006\t\002\n"
+	.string	"\002\013\021\022\023\024\025\026\027\030\031\032\033\326\353\250\370\005\266\001"
+	.string	"\002\f\004\002\r\r\002\006\b\005\002\002\r\034\035\036\037 !\"#$\224\360\252\367\004\020\002\002\016\002\t\002\017\002\020\002\021\002\n%\207\245\203\341\004'(\216\261\346\202\nr\n\022\002\016\t\021\017\023\002\024\t\025\021\002\002\026\027\030\002)*\352\301\345\224\t+\234\247\312W,\341\313\326\317\016-\245\210\357\367\n.\257\335\357\337\016\f/0\353\375\325\346\004,\016\002\002\002\031\002\032\033\002\0311\262\231\260\274\002\n2\265\244\343\267\f\0023\343\376\252\366\003\0024\370\262\277\340\b5\303\366\213\251\f2\034\005\021\t\t\002\t67\360\237\325\371\006"
+	.string	"8\262\273\233\244\013\n\002\0359\327\327\240]\b\036\002\037:;<=\367\334\321\267\n>\332\260\306\224\006?@A\240\342\234\212\n"
+	.string	"\200\257\250\261\321\300Dd&I\2265p\202BTDn\022\300\202:\216\310\220\221\220\314\204\205\255\224\366\231\003\220\354}\0233\240\333\206{\004\001/\255\222\2219^\026\027q\2130\002\375\f\216\274\350\310\322)\b,\331r\202=\023l\022)]\200\032:\242cq\263U4\310\367N\323\214t#!B\255\fFF=mBt\364\r\220\255\313\270F\031\317\347@z\236j\303\332\271\373\321\312\336\201\201\376\333fu\221QI\334\206\330\330_\241y\247\300T\203t\031\031\025!\007\323\333K-\216,1\367\265\361\375\024\300\233\265\235\345\2140_bp\\\341\034W\201\340\256b\330\351Xg\367{\213\2652\341\263\221N\277;\327e\001\223\232\225\215\372\344\021\314\"\310\336\004\231\027\277%Bn\201x\\l\312\023\371\020\013f\032\232\237!r\033\225"
+	.ascii	"\006\335\356FWoP\312\326\2739Jv`V\360\204\315j\356\260\r[\030"
+	.ascii	"\024\231qN\234A\205\016g\304C\034\330\205\210e\004\002\373c\263"
+	.ascii	"m*}\302\365\331\b\214\222\345\003V\344\034\367\345\336o$@\017"
+	.ascii	"\255\024\346 \301\264\247u<\340\312"
+	.text
+	.section	.gnu.lto_.ipa_sra.eb51553ef5eb4835,"e",@progbits
+	.string	"(\265/\375`\033"
+	.string	"\365\003"
+	.ascii	"\262D\r\024\240\2531\377\377?\320\246\357\237\203\b\313\260\374"
+	.ascii	"\260l)S\n\002\252\377\233\242W.\207N\217\273\243\215}3/\252$"
+	.ascii	"\310~\030\026\272K\fz\353\3744\005\017\002# \260\202I\353\006"
+	.ascii	"<\004\306W058.\037\305\001\022\343q\243\327\320Q\271\254uV\024"
+	.ascii	".\017\323\303\001\242\351s\330de\317\276\004\362\242\343\256"
+	.ascii	"\300\260,\342\006\343\002)\360\001-\306\027\\@\211xW\317\244"
+	.ascii	"\300C"
+	.text
+	.section	.gnu.lto_.inline.eb51553ef5eb4835,"e",@progbits
+	.string	"(\265/\375`\034\005U\027"
+	.string	"\306byG\340\362f\030\003P\005\243d\236\022\372\203us\216:Q\374"
+	.string	"\341\335,\226p\022(\206\n\352t2L\355\351\261(\024,nB\236\237\006;eA\206A0\202 Te&\222 \317\277\362\202F\007\206&\266{\355-e\nc"
+	.string	"f"
+	.string	"b"
+	.string	"\236\215\205\324NB\201H9\252L\224\221\314\337)\363|\314l\360Ld\361o\361v\273\335\017\360_t\027\024\265\224P\372\371\342\345\004E-\255;\277\277\230\3660q\204\003\017\207yBp\354\320\371\326\325Ew\267\006\374\030\265J\201\342G\345\373G\315\374sF\t\034uC\352\031\343\371<\271\310\241\274\311\240\030\343\343\212\352\030Q\273\351\257p1xW:'+\360\327\270\277X>|\277~\301\274#\033\"\036Ez\334aK\300\003\370\035vw\366\254?E\023\206M)\251\226)\t\020\250\220<+gj`\212\312<r\276h\355\352\306C\177.0\242+\337\341\341\212\342"
+	.ascii	"\315D\350\342\342\005%\021\343\226\323\307Y@\260l\300\227\005"
+	.ascii	"\340o\022\322\200\017\343\371\274\310\001Y\210Q\251\"\"E*\314"
+	.ascii	" a\2368cw\305\027\f\013c\252\203\313\031\205+p\321\322k\2221"
+	.ascii	"\253J\234>\225\203\251\226!>\340\242\355\242\351\037S\333\356"
+	.ascii	"\n\320K\354\356\311*\237-/\317\327\223\234\253\373m\270\342\272"
+	.ascii	"(\321\356\242\334\272%S\247\241$\033\016,\036x\357\242e~\177"
+	.ascii	"\t\200\247\034\241\033\361F\305\225n\300\024\276\345/e\332C%"
+	.ascii	"tc\r\365P\2658\321<a\264j\267\246\344\t\257~L'\232\246\002,!"
+	.ascii	"Y\251/\025\272\331\031\2420\n\304v\243\241\301@\0065\322\325"
+	.ascii	"\300\371\306\021\362\214y<\2735\342\020hJ\202\254x\"j\375\340"
+	.ascii	"\031\370.\236L\255p\271\"\326\016\032xg\272h\001w\2501E\205\210"
+	.ascii	"L\315\214\246\270\322\034`\002!Cv\335\022\200\365LG1B2\301\314"
+	.ascii	"\330\202Ja\177\016}\005am\321\0024\331e\322\314\206\233+\020"
+	.ascii	"\305\360\353\340\230\034X\004I\025\213n\362\242\270\200B\364"
+	.ascii	"\332\0257\321K\250\253h\372[\314\325F\276\204K\362\177\230|1"
+	.ascii	"z\nN\251v*\243&\312\375\367\377\370\202,\247H\f\333Hnc\034D["
+	.ascii	"\253\343\205\tTV\255\3773\334\256\217\021\032\246W\201\250\372"
+	.ascii	"\361c~\357\262\251%\036\240L\344M\001v\245,\376\003vV\004\032"
+	.ascii	"kR%\317\271\b\256,\237\337\023\220\311D\220\016\375+\336[\034"
+	.ascii	"!4RKp1\023\251\344V\332(@\211\200\217\273a\261*;\266\255\333"
+	.ascii	"\254\f\024\0176\020#\317\264\354$\026\221\206r3\304\305\250\020"
+	.ascii	"\260%\250\177\224\235t8\317\205-\302\316\247\177\213\233Q\273"
+	.ascii	"\030Yt\023K\201sgF\rP\373Q\221\311*\327\305\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.eb51553ef5eb4835,"e",@progbits
+	.string	"(\265/\375`\306\003=\013"
+	.ascii	"\242N*,pK\222\016\374\377\271\252\201/\374\204\321\002WUu\241"
+	.ascii	"\333\260=TU\325\245\347\377\237\217\315\260\372\377g{.R\t{\007"
+	.ascii	"Bd\222\001$\257\315\260\336\237\006FB\317!\tA\333\257\240\244"
+	.ascii	"\036\245\367\372G\024ib\220[\003\t\336\247\b\210\007\222\016"
+	.ascii	"\223\311\034\261\252\036#\027\271\r\271\033\326\263\262\317k"
+	.ascii	"e\\Y\337\242\037\207\265\375:\254\274\001x\371\322@\246\364y"
+	.ascii	"X\031H.\360\222Td\263\326ZW\"\022\241\254\254\360\307c&\257\334"
+	.ascii	"\333bo\261\316\213\242\fG\231y\320\203\n\006\230z\347\003\310"
+	.ascii	"S\217\275\346K\001\"LL\250aASD\026\264 \205\235\003@B\302\234"
+	.ascii	"#\333\022@\343\t\030\f\306X\b\031c\240\030\242`&NXni\261\030"
+	.ascii	"\262IV(Dz\321\350\177\265-\n\031@\355D\215\250\240\364\t\371"
+	.ascii	"\nf\224\376\r\n\035\307\304~\362~f\315?`$\031\225\244\223(I\213"
+	.ascii	"m(\312\244\325\376v\327YA\331\\\237mW/6\224\321\255\023\3463"
+	.ascii	"X\b\354\022z\b\006\223\2629\2564:uq\365J\321{\313\212\227\261"
+	.ascii	"c\253V\200\234'j\353\367t8\016\023\377\25297\254.\314y\224Ah"
+	.ascii	"T\220\004\314\004\220\330Kt\244\243\036\247\026\353E8\2040\207"
+	.ascii	"\326Sdd\253\254XG5\216\f"
+	.text
+	.section	.gnu.lto_.pureconst.eb51553ef5eb4835,"e",@progbits
+	.string	"(\265/\375 8\301\001"
+	.string	"4"
+	.string	""
+	.string	""
+	.string	"\021"
+	.ascii	"\232\004\001\232\004\020\232\004\033\232\004$\230\004(\230\004"
+	.ascii	"-\230\004.\230\0040\271\0041\230\0042\230\0043\230\0044\230\004"
+	.ascii	"5\270\0047\230\0048\232\0049\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.eb51553ef5eb4835,"e",@progbits
+	.string	"(\265/\375`5"
+	.string	"\345\004"
+	.string	"\242F\026\"\240'\351\340\377\377\353\377\377b\367\007\377\256\016\354;\2264\"k\037A\317\t!;C\214|B\244L\0017\307\203\001\376V\336\264\215?J=[EI\221\001b,\024?\333\317\206\255\273;\bY\271\026\231\023\235\210v\246\307\360K\371\322yh\013\345\037\230 I\027\234\236\204\034"
+	.string	"j\013E\006\272J\305H]\3765f\270\003`\335\232I\006\326\213\262t0u `\\\217M\006$\252\356a\265\2143\003\306\224\262-\251\255\001\263\236\3461\315\002\363HYl1AG\374"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_.lto.eb51553ef5eb4835,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gpsPacketLogChar.50.eb51553ef5eb4835,"e",@progbits
+	.string	"(\265/\375 <\341\001"
+	.string	"\016"
+	.string	""
+	.string	""
+	.string	"\""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001\202\200\200\374\342\203\307\221\t\177}"
+	.string	""
+	.string	"\013/root/repo"
+	.string	"\024./src/main/io/gps.c"
+	.text
+	.section	.gnu.lto_gpsInitData.61.eb51553ef5eb4835,"e",@progbits
+	.string	"(\265/\375`\265\001\375\f"
+	.string	"$\024\201\001"
+	.string	""
+	.string	"(\001"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\204\305\355Q}\273\001%\206\b{\by\275\006\035\001\001\004\005\001?\202\210\200 wu\300\001s\277\001q\276\001o\274\025'G\206\bm\330\354\001k\303'\\\206\bi\bg\305\006\035\001\002\003\310\001s\307\001q\306\001o\304\003\005\001'\177\230\354\001k\313\224\001\315\307\001s\310\001q\316\001o\314\002\005\001'\267\001\330\347\001k\321\314\323\277\001s\300\001q\324\001o\322\001\005\001'\357\001\206\be\230\347\001c\326'\205\002\206\ba_\330\005"
+	.string	"\333\001s\332\001q\331\001o\327(]3\334\0014\325\001\320\001\317\001\312\001\311\001\302\001\301\001"
+	.string	"\001"
+	.string	"\013/root/repo"
+	.string	"\024./src/main/io/gps.c"
+	.string	"!$PUBX,41,1,00031,9600,0*16\r\n"
+	.string	"\024$PMTK251,19200*22\r\n"
+	.string	"\",0*2338476576CD\r\n"
+	.string	"\025115200*1F\r\n"
+	.string	"#,0*1E\r\n"
+	.ascii	"/  \243)\362\005\002\300\252\376\322\021/\270W0\356\"\\`/\005"
+	.ascii	"c\343\224\374\025\250\361\037\301\315\324\326\3124\201\016S\363"
+	.ascii	"\005\270K\367ua,w\373\352\303.\031hL\220u%\2147\035\352a\214"
+	.ascii	"\254n|\304d\007jj\017\253'\2513\246\313n\334\331\254q'\364j\002"
+	.ascii	"4\002"
+	.text
+	.section	.gnu.lto_ubloxInit.62.eb51553ef5eb4835,"e",@progbits
+	.string	"(\265/\375 \306M\004"
+	.string	"2G\032&\200K\322\001@\\d"
+	.string	"\243\016\326C\006DQ<\322O\374j\232\036\227\004\252W,\034b\350\332@5\265I#D\246\022\314\275W'\224\356E\020\225*\214\246xHMGT\326"
+	.string	"t\265\320\371\031l^\021|\201\346\02283C\274efM\367&\207\277\372_\334\304\220\341\360\366T\200A1>M\351^-S\326\242\276\374O\r"
+	.ascii	" \023\220\t\310\004d\r\006\001\231\200L@& \023.\271\242\030\233"
+	.ascii	"\323\256\001\024\001"
+	.text
+	.section	.gnu.lto_ubloxSbas.64.eb51553ef5eb4835,"e",@progbits
+	.string	"(\265/\375 \334\345\004"
+	.string	"R\210\037+P\345$\035(\202\2537\253\004\022H \001\003\352\2145\263\273P\363\034\344\314\314\264\031\0351J4`\205\354\325v\032\220M\032I2\001\212\266}\017L+\200\274\214\241\016\300\275\201F[\353\023\330\264g\257{\376,z\264\351\323*\306\255E$\261\212\263z\200\347\250x\352\002<\033)^j\030</P<t\r\340\351&\274sN\274#\231`\331\305\3428\335\224wVZ\203g\021m5\001\f"
+	.ascii	"/\202\240\334.\344\003\345\202\254\301 P.\310\032\f\002\345r"
+	.ascii	"\250\374\006P\004"
+	.text
+	.section	.gnu.lto_gpsConfig_Registry.69.eb51553ef5eb4835,"e",@progbits
+	.string	"(\265/\375 \216%\004"
+	.string	"d\007`"
+	.string	""
+	.string	""
+	.string	"\""
+	.string	"\005\001\212\001\206\200\200\374\342\203\306\263\037\006\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\314\006us\350\345\005uq"
+	.string	"\005\001\006'\001\020\036?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\024./src/main/io/gps.c"
+	.string	"\004"
+	.ascii	")\"\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_gpsConfig.71.eb51553ef5eb4835,"e",@progbits
+	.string	"(\265/\375 7\271\001"
+	.string	"*"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\177\001"
+	.string	"\005\001\006}\001\001\005\001\006{\001"
+	.string	"\005\001\006y\001"
+	.string	"?\202\210\200 wu\276\001s\275\001q\274\001o\273\001"
+	.text
+	.section	.gnu.lto_gpsInit.74.eb51553ef5eb4835,"e",@progbits
+	.string	"(\265/\375`\246\007\365)"
+	.string	"\372I$\020Dp\336M:\327\334\027\334\306{h\007q\016\217\017\212x\246\227\230\300\331\362:g\270\311L\033gX =\351\220\307\306\177\214\2114\305\302\251\242\233\346Y\272yO\252\2644\220O\353\231\266\215\031\261\204\020)\223\f\353"
+	.string	"\343"
+	.string	"\363"
+	.string	"\333[\035\037[S\353\315\350Uk\355\335\334\325\261\333\273\311\007{r{\373\260{I/\266\343U\212\310\023\262\225\026\001\275\271a\350\336\353_\351\221=P'\"z&\244{\2535L\302\315m\200\336dp\002\347\315\362\002\316\233\233\356\362y\230\223\372\2623\341\227\270Z+\260\267\366\344\364D\275!\036\272;}\346\257lN\367N'\332y \373\221W\017L\330Py!\313\2171_#*){`\006u=y#+\304$\3143\302\242\252:\272F\254*\031X!\"\341\335\257(\214\342\0235r\337\223/\271\200\241\r\213Gn\006\250b\344\277\262\303\227\026\256\257\021\215e\213\225\261\351\025}pi\001Y\306K\016\213j\311\273\334"
+	.ascii	"g\212\233\257\021\255\3123\313\314\326\223\347\251\"\024\363"
+	.ascii	"\316C\255uyX\244\372\002\370\356\317\335\305\260\273s\021\033"
+	.ascii	"\342v\220\352p\240!\\\002\336\233\211 \301\037\032u\002!tjP7"
+	.ascii	"\333\022\237\243\266K\312Qp\336lM<N\020\316\315^\256\351\302"
+	.ascii	"6\2043\300\004\276oN\t\377\330\335\250x\372p\317\346mP\244P\241"
+	.ascii	"\342\\\301\202?\\F\253\242&\325N{3\337m\3614h\350\260iA:w]\274"
+	.ascii	"\f\022\232\231\274\023\367\340\271\013\343b\202?'\265\326\f\373"
+	.ascii	"\263\207I\332G\271\271J3\370\303\031\347\315'\017\241\353\216"
+	.ascii	"\026@O\\\267\033\006\305}\334}\2078Xi\333Z\273%\357Q\311kt\261"
+	.ascii	"o\321\221\337\037\217\327\207\362\022\225\274=\223w\350\344\345"
+	.ascii	"\231\274\350\216wg\362\236&\257y\362\226&o\233\274\\\362\236"
+	.ascii	"\302\211\224\211\363\323!\255\326!u\204\252\232y\206\312\221"
+	.ascii	"\277\330y\367f\013\364\030\227\374\313\3116\302T\311Z\245W|u"
+	.ascii	"\336\334\26596\266\005\312\256\217mv\013J\342\211\3429&\034\025"
+	.ascii	"D\375\214H\263\320Z\353\331'\343\206|\342\272#?\245[@'\265Fe"
+	.ascii	"\330\335\034\354\224r\031h\2535JC\035\327\024J\231JI\251\234"
+	.ascii	")\225\363\246\331@.dw\331\027\026\242\013\242\204z\367G\220\034"
+	.ascii	"\262\254\265\3263\303\332\233'\276\326\032\363\271`\0019^\027"
+	.ascii	"\241\"2V\177\314>\356\337`\254\264\324\374Z\253|\360\344Np\005"
+	.ascii	"\226\224\303-(8 \320\020\356\017\236\335\334<\220\203\244\214"
+	.ascii	"P\\\327t\362\210\231\225\020\370\365H])\026\"44\346\\\031\226"
+	.ascii	"\356\343\3568\213\372\300UV\322-\212\347\326\001\363\323-\347"
+	.ascii	"n\332%\375\342\017\213z\002\032\230ZT\357\246`\337\243\247\307"
+	.ascii	"\254\b\022\375\344o\205\326E\r\252\235v\017\342\303\333@\260"
+	.ascii	"e\245\305\0012\352\233\005IJ2j0\201\300\321\304t\342\206\215"
+	.ascii	"$_0\006\323R\2710*\334\260\221\004dR\002\326PBZ\002\302h\272"
+	.ascii	"\001\2540`\231l\004\233\2008\230\230\232\200\275\260\247{xj("
+	.ascii	"5\242>\272}\340'\314u\324'\333\020\274\305M\310\216\310\266\004"
+	.ascii	"g1\326\311\326\004_\005\177l$\373\203.9Plgp\023\370x\361\351"
+	.ascii	"\301=X|\223{\343\0012~\r\365qu\024\215\350\337\343\034\022\322"
+	.ascii	"\t\321v\375\036\347\257\247\226N__,\313\313\037:n\276^>\302H"
+	.ascii	"\226\366Q6\365\221\n\205\347\315\357\031\302q\340}:u\376\272"
+	.ascii	"\327\3734\310\371>'\032\222\026\371C_\227\265\252\235\2100UZ"
+	.ascii	"\004@\033\2056\242\346\ru\257\001$\355\224\025\"\246[\357C\203"
+	.ascii	"\207\244\\g#d\250\337\007m\036\003\341)\264\033L\353\212\361"
+	.ascii	"\213\327G\004U\244\254A\237V\235\273~\221t;\302?\322*\224\245"
+	.ascii	"8\200\214\250Q\030\b2\246\024*\021"
+	.string	"\021\t#I\222\016\220\002\021\251\252\362\021P\245T\f\331\004qag\ra\260tN\302,\005\242\241\026#f\277\b\265\355\217h\235\221\333+QM\230\003\262\036\371\212\247 \363h8\005\2213\211\f\272\210t*\202\033\\\376\264x\207\023h\267\021\265&\222\203G^)9*\306\013.\036\307\023->\260\343\210\257\034GStmy\312\370e\024eF.\216\333%D\330\251\030u<a\002\234Q\223\326\330j\227\305\221\364tL\"\017\002\"\300_\204\324\034\302\302\202\223\334#[\303U\351\276\276\347\025\224i:\375\357\240\256\207vk\342\245g\\\337\342Cq6\213Ak\234\201\007\372H_B\257\236|\356I\f\241\311N\223\262\335m\312\226\317\335\257O\007C<*.\235K2\322\005\302\221lJ\246(\275nR\204#\341|d\2362\215{2\002,\251\245\201>\356\224\232\324\240\207\365\324\216\020\035\024\201\335\323"
+	.ascii	"\334\037\024\r8r\365\017\037\020\337\364\005\263z\0265>p\303"
+	.ascii	"\021\020.91C\334\351\244jr\034\376\246N\250\001"
+	.text
+	.section	.gnu.lto_gpsInitNmea.75.eb51553ef5eb4835,"e",@progbits
+	.string	"(\265/\375`\246"
+	.string	"\245\n"
+	.string	"\366\023I>0m\224\016S\303."
+	.string	"\341\031\2151\bd\342\340\210!P3\337\323\357\241\277\250\022C\302\307\032!\344\177\re\177\224\3365?\016Y Ad@\230{\353]\203\224\333\354\301~\262\267\224)\0057"
+	.string	"3"
+	.string	"9"
+	.string	"\233i\037b\004\002\321\261\273Q5\334\363\247\351\361_q\212L\263\376&\327G\300\344\301!\321\260\0275*\204\004h\237L\210\202\335uf\032\206\033\336v\002\333\005\354#\b\234|v\350s\250\303\253\201R\007\221\305\305\225\235\275a\251%\373o\225dg\032f\372=}\310G\\\007\307\002\214\335Pgb9\230\301\301\366%\366\330$\036\273\224"
+	.string	"\031\"8+?~ahX\320w(\250\2578\203\017#>\351\341\001]\327u\357PO\241R\",;_\237:A'\034\341\0366\221\335=\340[\374b\202\177:4\205\266T6\231\007\261\272D\b\227\006\230h\321lbe\342*\343@\023%T\225&J\266\353J2\034q%6.\305\236\301\332p\332\330m)\317\217\007 mL\225\317\254jEL{a\003\021"
+	.ascii	"3\003\266:\204\215\2003X\376)\263\254\326\366AM\254  G\254lL"
+	.ascii	"h\231\352n\327D\017L /C\210K\027\263\235\2670\313"
+	.text
+	.section	.gnu.lto_gpsInitUblox.76.eb51553ef5eb4835,"e",@progbits
+	.string	"(\265/\375`k"
+	.string	"e\t"
+	.string	"\326\021A: \005)\035h\215\022\"\205`\016LW\024\271\240\021A\201\347i\300\256)\021p!\352\333F\366\221\031\374\214\031\215\233\031\002`\200M\200\005\367\274\270\216\232\321UN\032!R\246\0240"
+	.string	"1"
+	.string	"/"
+	.string	"\273\033U\344\251g\232)\337\363u\317\002Z\327,\241C\246\365\371V\331"
+	.string	"\f\244\346\257'\306\307\312\334B\273\353\364>\215[\273m\005\333\006\266c\001\007.\226\223\rU\2066\270Ju\331\3270\fCk\210\235\351|\372\033A\fl\301e7#\214\355\214\006cb\373\037\247l\233\203#\373\226\013\213\225\234V\355\362\005\007\346\241\352\262M\321ImP\241a%"
+	.string	"oy\265O\022y/\265\200\245\235}\224\247T\370%\236@\345\275k>\252s\355\372\327\003\026\201N\245\207\310\215\"\304\210\201\024E\246S\004\t\230+9\230b\004\307\231\342\007T=\244\322\325?:\022\216\233\005\027\341\031\340\331\356n\346I\233\304\345\275\016"
+	.ascii	"2\003N\035\206YX'\002\202iX\001+\200\266\217\205x\241\207p\350"
+	.ascii	"2\364\313\020\342\322\2654M\003SP"
+	.text
+	.section	.gnu.lto_gpsInitHardware.77.eb51553ef5eb4835,"e",@progbits
+	.string	"(\265/\375`\013\001\r\f"
+	.string	"V\325MA\020\251L:\250>\320\235L`\247\013\316Bf?\340\007xt\233\300\276\200\243\3528\004\027H[\005\2755i\270\263\273\266e\300UV\025\021\""
+	.string	""
+	.string	"\004\"\212\002\363]\005\005Z~\356\020\"\233\354\235R;"
+	.string	"9"
+	.string	"="
+	.string	"dj\337`\345\341\252\355\256GK\036z\345\350\f\371SV\212#\370z\3269\0022\2328\216\234\273\234\216\302\356\242z\001\250\214$:'\231\335\365\024G\221\273\273\355\b\333\016\366I\001~\201\2676\374\325\2539@\363\342\253\017\352^O'\035\260\001-\321,m2\234\024e\237\226ei3=\331\237~\307p\213`A\333\005)%l\254:\b`\373\026\207\354\331\003\316\200s\302U/\325\003JQ_\3403\360\214rOq?X\002\326\224\300W\340\031%\201\325v\301\227|\214\356u\212\366\017\370%JjC\226\334\007\213i4o\266?7\240A\331\035A\004\326`>\235\n\357\333x\027\233\t\216\247\361|<\314\202\277\016\205\307\313\370>\217g!E\347\226\236$\312\230\210\206>\371su\243"
+	.string	"\301\026s\275\201\253L\233\363\315\213>\353\231\220\202>\202\007\035"
+	.string	"3\2413)p\215\327-L\006{V@]p\204\251v\300]\233\336"
+	.ascii	"Z\213l#\021\\B\252~>\225\231P\2138\013BMW\314b\204Y\216OY\b\227"
+	.ascii	"Q^\206\030\227\016f\3434%\025u\007\344\333e\345\t"
+	.text
+	.section	.gnu.lto_gpsUpdate.79.eb51553ef5eb4835,"e",@progbits
+	.string	"(\265/\375`%\n}3"
+	.ascii	"\312W0\023Fp\\R\007\327\266\001\006\374\305\3405\325ox\256\271"
+	.ascii	"\206\016\r\373\300\206g\005J\"\353F\215AX\333\316\200\351H\t"
+	.ascii	"\317\241/\013u\326\357(L-\352hg2\233\241\256\022\036\250\223"
+	.ascii	"\264\267\267*\261M\344\336)\245\024$\001\005\001$\001|\366[\316"
+	.ascii	"\24044E?Y\305\232\222$\005s;\3512\025\375\344\307\312\322k\225"
+	.ascii	"Y\005s\257\325\264\307\314\355\314\315\244\233\260="
+	.string	"\266\202wm\333\345\244\322\266\317%N\260\266:\324\301\333j\332\277\333*\263\314n\372\351\325vZ\027$4\256m[\341\373` \337g\373\007\364\343\343\353\341\351\361v\253\016xS\241\017:\313\r@\313\2231h\313b\377\276\032\350\353\207\377\244\002\230^f\024\205\331\301\246\313\274\334\347+\207\373\240\335\313\236\024\311\255\212\234\026\243d\246A\030A\222[\316\243k:k\004L\236L\242=]S\214\033\315\023\243\274\221\016\025Q\332\360\235\256\211\254%\204\321y\323\025\203\331+\216\254\356Rj\335\037\242.%3\325\245_v\266\245A\223$?\232\254\375\305\322\350@\007\353\313#R\243\323c\f\260\026J\017\360\310\021\355-\253\322!56d\2435\221\030e\020\377\265F\007\323\237\226\0243\276%2U2#f\243\311\232\250\2102\314]\327\324\266-{r\031\243\031@3\267\0263+`\336U\b\272o\022\357}\247"
+	.ascii	"\256>\263\205\013\336\311\253E\375&\353\242c\2333\253;m\333\266"
+	.ascii	"\005z\013,iY.\007\235\033M\303\006\357$\377\027\233\315S\271"
+	.ascii	"\225\366\234\257\"_B!\356Q\220\247\317\215\306\241\203w\362\350"
+	.ascii	"\033\255\333\212\371\306\366\237~\267A\336\361q\177\346'(\357"
+	.ascii	"\344\377P\325\027\251\370\353\216m?fMY\224\377&w\023\230\321"
+	.ascii	"\004I\220O\334\376\017O\324T9\035\346\226\322i'\270\301\030D"
+	.ascii	"\224w2\352\266\332\3775\334D\263\250|\216\371i\364o2\267\321"
+	.ascii	"\026\327\033?\017\346\325Y\301u\026\352\234\231V\347\245\325"
+	.ascii	"YiuNZ\235\221x\316G=\326m\304s\016\256\316\300\325\371\267:\007"
+	.ascii	"]g\240\353\374\263:\373\\g\337u\356\271\316<;\347\336\352\314"
+	.ascii	"[\235w\327Y\267:_\325Y\3259\247\327\371UgW\235\373\201\201.a"
+	.ascii	"D\200i[\030svZ6\325\212\020\356(\215\206\242\237|\333\270\240"
+	.ascii	"\340bk\3063h@\377B\256\207\367\347\201\276\221YFGz\213!{\203"
+	.ascii	"\335\332\272\255\376\274\016\313,\232E\325\303\313\314\346\360"
+	.ascii	"\252a\020\215S\271\221\325\261\203m6\221\230%\201\363\361\341"
+	.ascii	"\355\\\232\226\204\223\364\305\206y'}\276h\r\253\347{;C\002u"
+	.ascii	"\316t\317\373\276\231qS\216V\214\303\313\363=\237\306\021\322"
+	.ascii	"q\3039<\257CBq\252F,W\274f\305n\357\273\213H\303\261bk\333V-"
+	.ascii	"\340\206\323o\354\021\026\t\353d\235\267\325\336\353\314\346"
+	.ascii	"\234c\274w#\ny\265u\022\016\361\356\236\367\337\346\3104\372"
+	.ascii	"\334\222fC\\\263{\325\354Nt\314L\363\250EwD\316\314\222E\360"
+	.ascii	"\251\275\261\031\277\310\r\246\007xa+\272\034\017\351\265\265"
+	.ascii	"~\363\f7\032\325\312\016\031\3562){\262\205\2415\204\255\303"
+	.ascii	"\264\030v\263\266m\261\231\375]\340\266\352\300\366\030\346\306"
+	.ascii	"\255\345j\217z\215\233\271z\265\312\366\331\036\365\270X\370"
+	.ascii	"\035fvj/\303\265m\333\005\334]ZM\0027X\253<\201\002\205\333\252"
+	.ascii	"\356U\2638\3161\270%2@\211\210\302`b\004\324\324\324\211\247"
+	.ascii	"\036~b*A\002\204P*J8\"\312\203\b\341\323T\t!\023\220\245H@M\t"
+	.ascii	"MHIM\t{O\252~\036kjlTo\374}\363\223\224I\302\331\311p\353\025"
+	.ascii	"\327\350\025|g\261i;2\215\352\034'r@i\017\257\360\277H\227\031"
+	.ascii	"\031\256b\302\207\360c\254\327f\214\376|\223\223\232\351?<\001"
+	.ascii	"\263\364L\337i\310;Jo\364K\337\307!C\234\b\261\310\032\215\267"
+	.ascii	"U\245\357\262>\252a\306\t\274\242\242\304\347\233W:\350\300\235"
+	.ascii	"\253\231Y$\353\302;\031|\2508\\Q\267\252/ME\227\363\271V74\f"
+	.ascii	",\351\033\n\344\0074\t\332\243\331Pv\362\035]P\006>\324D+\026"
+	.ascii	"\006pm\t[\325\027\275\320\314\350\371&\377\2404\273\274\300\265"
+	.ascii	"\337\007=\360?\313q\310\026q\305\361\373\2424cA\017\\C2\246\233"
+	.ascii	"\254\3272o\312\250[\321\345x\276I\343\312\360,\226\006\326\016"
+	.ascii	"0qpH\217\3454\210>\237\341q\372\f\351\t\\\311qa\265|IT\352\236"
+	.ascii	"\254\305\301\205\351>c'\277\032\372\334\352\254\213\002\200\316"
+	.ascii	"\250a$\005\231C\n\211\314\210h\222\244\320\030\240\002\021\251"
+	.ascii	"\242\252\003\0210-S\220\321LS\252\264\006\322\251\327\357\374"
+	.ascii	"\242D \nb\310\352g\204\261Fm\227\021\253\271\333x\344\375]-\023"
+	.ascii	"n\257mS\227\376\327\302;\b\344\224\177O\275!\2569PU\245\020\303"
+	.ascii	"Q\254\235-b\346\222W\221O\037\211;q\237\241>CQ,N\r-Q0:\207\244"
+	.ascii	"\271w\341\247\017\223\224\272t\264\204\215j:p\370\366\340\333"
+	.ascii	"\315\256n\035;j\211\236O\377\266\202\025\332s\277\330C\321h1"
+	.ascii	"\237S"
+	.string	"\214\246\374\205\362s#\326\320\212{/\376 \253\277!\264\305k+\241\226\345*\217E\202e RN7\242\265E\341\004g\001\317\323\342\323=\\\030p\032\321\324^\241\2359\372JatY\016RX\362\250\323\215\276\361ti\256\212\0317\2731;>\344=\241e\325\330\366\372'nYs\274\302\320>\260\232\210\261rv\352\034\313\201q-^\020&s\231W\020\347\324\307\035\244i\347h\027xl\254H8\351\374mG\245\321\374\347(\031\b\3750\360\001\21086\256k\351\376`\3510\3172gpJ\006\360\264\261\377\370\240\335}\b\207\307\345k\276\230O\b%)\204\bJ\251k\200\326\005b\306\355\224\347A\016,h\253\215!\265\3131\211\373\177\034\025\332|S\235\375:\365\022ZY\013\001c\236\275\312\301\341\211\317\214z\330\241A\227\212\373\034\002\r`;\214\025\343\352h\256v%v\0324\241\026\360\342\226\322"
+	.ascii	"\205\032"
+	.text
+	.section	.gnu.lto_gpsNewFrame.81.eb51553ef5eb4835,"e",@progbits
+	.string	"(\265/\375`\222\001\375\016"
+	.string	"\206]dC"
+	.string	"\221(\035\355\265\342\347\313\375O\r2\262\216\260\263\322\237!\351\360\355\302w\336\006\336\347f\r\223\223\376mo\237\224\256y\250\251\025x\324\274\260\364?\337\321jLU\3435\324\376\202\277>\022D\366\2262\245T"
+	.string	"I"
+	.string	"S"
+	.string	"\326\374J\005\353\356Je\305\256\267\300\006\264G\333f\320@\344\321\275\016\251\267Z\240Zjv\275M9|\364\b5G>\351\321\302\213Nerx\226#p\3250\315\244P\231\\O\246l"
+	.ascii	"\013\306\303FuA\223\343cw\235"
+	.string	"\235J\303\235\335\366\003\333\007\354\314\002\276\210{\234\377\341\321\023B\371\356\321\017e\217\327\263<\001\212\206J\210R~\266gJM\261\257\337\367\331\260\242\330Nw\234\336|\345\327\234\216\232\206\232\326\230N\230>\200\177[3C\364\355\246\276\033+\023_Z\266E6\307\016\357:Z\340\244$\247\252^\323T\220X\f*V\312\3177q\002/2\244\204\235\005\303b\241\232\342\237\360Q\334\331m*\006\210=i\361]\374\322vI_\371\237\354\261c1\264`\310x\t\333\257\177e\373\225\335*\340\234\2342f;\302G\220h\273'\007\001\236\333\343\021*\031\331\270\317&\341\023B\262y@\241\315\243\303\\\211\bh\243\300q\240\215\343\225\016WQ\234\321\320\270T\244?\312\016s\201\233\b\333\240\035\215\232\301V\223O\342\376\200\273\273Q@B\265!\204\344\273\215\246PAb3w\275\343\"\006\006HU[d$\003\036"
+	.ascii	"J\023Z\t\211\020\2651\357V\210\200 \270\224\253\261\265\032\n"
+	.ascii	"\344m\004\321\300L\033\376\0354X\005\004\003]z*\333\242\f\204"
+	.ascii	"\306\202Z\240\0363\016\027m\237\n\333pM\344\2308\326s\341\201"
+	.ascii	"k\274\234\361T{\340X\347\0262"
+	.text
+	.section	.gnu.lto_grab_fields.82.eb51553ef5eb4835,"e",@progbits
+	.string	"(\265/\375`\350\003\355\033"
+	.string	"\206s\264I\260\226Q:1a\343!\034\247\250\340*!N\213\341IKi\355\277\f\202]:b\230\260\237\323\376\277\347\245\033\267\245k\245N\016\273w0\377)\344?\355\013(\374\244d\031\377\252hB\233u\225\333\250\225|B\b!i'\031\246"
+	.string	"\231"
+	.string	"\233"
+	.string	"5\351\t\002Jw}\3038\204\374\373\340\230Z\227|@\325\372c\260\006L\217\3733]\3036\204\226F\001\004\321\356\200\217\313m\307\226Z\177\261\002\026@z\024-Cz\374\212=)\315\254se\226\344(\236\322\326CfM\031\231\250\3213G\305\016\311+O\031\225\b:\307\314I\261\343\271\2342\342\211\005(Nw\243\344\221G1\202\220\243\234K\007B\244-\240Xq\f#\023T\024\023$\035!\341\322\331D\001L\224\244\260tE\364\016\272\202\357\213\225\024;$\323RB\255u\251\b\335\316\333\362\356F\355\256\203\335\017\t\376!]w\320\006r\004\273"
+	.string	"\241\024\321\252OA\001\243\352\357\355\376\206h\002\251\027<\366K\273876\326a\327\320\370g\317,]\031\230\231\27410n\362\276J\272.J\027"
+	.ascii	"I\2675\322e\215tO\223\356\312\244k\226tKJ\227$\351\216\224\256"
+	.ascii	"H\322\375H\227\216tM\240\345d\204\3169\"\265\346\206^\352\222"
+	.ascii	"1\310\0133\331M\246\273B\353\035\016.\253\211&V\036\023|]`40"
+	.ascii	"\023\315uW\035b\213\317K\225Z\177\n<\356\202]\221\356>\200 d"
+	.ascii	"\035\036\3665?"
+	.string	"\317:\177*\361\2067!\321\225\240\224)\345{\353\240\235\263\235\020\2164_\3610\177\035\267\262\214\\}\006D\002e\031i~U\336\374\221\334\204\353\247\331\217Y\3368\244\3613'\357\327\307\2375\236\226\233\3604\215\204\335\346\245\022\217\212-\306\235\344\212\030!\337\373!\327O\035~\006\260p\261\376@z$\360\004\313?s\361\264\211m\006\375o\232\373\364\256\271\317\242\342)\271\t\211P8\325\242F\017d\315\307\241'%\233F\302\234\346%07\264%\325\350\320+\244\244\262\210\357\255N<\366\351\tz\220\006\016=\342\316\f\350\273\243\003\344\223!&\343\211m\340\261\320\023\333\231\001\305t\002\254\314\007\303,\026$\223\315b\254_\365\227\226\236\260\273l2n\210\260\037\331d$\231\216\262\214\314\351kN,q\025\363\227\355\004\020\352(\303\216+\253V8\177\017\272\270\375a\327=\005\214RD\253.\270Z\2379"
+	.ascii	"\230\267N\233x\177C\026k\255\365|\317\311\257\343\374E\225\243"
+	.ascii	"B\243zP4V\357m\200&\237\260\274\271\253\311\227\204\264y\214"
+	.ascii	"\3134\362\365\347x\242\002&)\242U\346k8\034B\231F\262~c\023M"
+	.ascii	"\250A\034\203\210sH1\205Dd\204\244i\306`\002\021c9\017\020hi"
+	.ascii	"\242\016\\3\344\030H\215+\2404\311\240\305\323<\206!B\345\377"
+	.ascii	"\022\030\030RF*\204\314$\r\002 \242\217\313\212\363D0\251D\261"
+	.ascii	"\2234\367\332\"\374\220\242\323\2751\022=\262\273&\030\200\305"
+	.ascii	"VV\016O \007\0270\237OpI\263\304\032\345e\036q\004\233q\202*"
+	.ascii	"W\025\273\250\260G\266\243\203d\220\222,\2360]a\0212\326\265"
+	.ascii	"w%\312\nPv\240\264sp\022\226\234\315\350\215\354\260\016v\227"
+	.ascii	"\254\"\367\305\004=)E\b\f\004\005V\246\034\376"
+	.text
+	.section	.gnu.lto_gpsNewFrameNMEA.83.eb51553ef5eb4835,"e",@progbits
+	.string	"(\265/\375`\177'\365\223"
+	.ascii	"z\343\0042I \320\332\031\003C\361\261_\277<\377\227\013|\030"
+	.ascii	"4\0045\021\330\3737@\341\260[\301\237?\307@\361\203=Ew\007IP"
+	.ascii	"\214v\007ZvO\3739\341\306\031\261\237L\233f:\212\342!\362\201"
+	.ascii	"0\b\243\231\213l)eJ)\005\b\003\321\002\032\003,\342\235\221\336"
+	.ascii	"\371\310\235C\2743\210\244\263\321;\027\275\363\007w&z\347\241"
+	.ascii	"\244\263\220\353\334\301\235\203\3349\351\316\256;\003\2713\007"
+	.string	"w\336\340\316?\356\354\343\316=\356\214t\347\243;\267\356\314\272\316\353;\277\353\354]\346\333f\320R\243\276\237\333;\2451\317\333\307\2621\3535\335j\272\331\272\335\272\341\032\3109\370\006\377q\037\357q\244\267\231>:\020ss\247\3515\334x\374\203\346\203&}\307@\240{\210\357\373\376\364\034\267\035\377\250Q&a\271\275S\200\310\306\364\371@6\341F\303?\315r\237i\272&]w\225\244\345\366~MU\021\311 \032\200l6\251\207\332f\327\366\3206\333\314\037p\267\365[\307\265\034\377\230Q\256\357sJm\314\331\0168\261)7e\322\030\274(6e\277[o\007\205jt\205\357\353\306\324,\237xo2K\376\367\035\253\303{\337\327\211K \233m!\365\0013\213\236`\331\211R3\343\222C|_7\250\347\302B\275\2725\307pf3\032\256c:>\303s,\307f8\216\341\370\215\335n\330\2501\005"
+	.string	"\215\0312b\300\220\3424/\\\264`\021\005\365\344\324\304\264bIE\n\024'L\224 \241\2244B\004\322Q\b\020FE\037\210\206\204<t\bJ\272@\0346\374\370\364 \217-\273\2763\271\233m\204\316/\254f4\\\007\364\245\025\346L\367l>\363$\2126\2478\317\265\224\271\305\301*Q\262+\315rl&\356H\325#g\312g'\n&\330\f\267V\211\222Ei~;\2126\243\330Aqvs\nE\233!\b\376\215\243h\263\253\321m\324`\354\251\305<\016"
+	.string	"\r<=C1\321e\254\377\004\021K\307\361B\\\247\024\271\3444\336\240\3078R\231"
+	.ascii	"F\3300J\210\320R\235E\330\234fM\262k\2458^\202\253\225h\023\352"
+	.ascii	"/\\\034\251\252t\013:\201\316\342H\225\302t\314NT\2140(F\264"
+	.ascii	"(\330_?\361\301\360\367N{Mo\326\2444/@g\332[\341\002Z\024\314"
+	.ascii	"M/\275\340\202\233W\301\226b\f\2125\035\365\272k\207\312\362"
+	.ascii	"N`\245\250\027\340\237\220\372\202f\302K\t\022G*%4u\2364\242"
+	.ascii	"\315E\254k]hHG\200d<D\217\241Z\036;Q0\300\006\241&\r\035[\213"
+	.ascii	",\323\"\307\264H1-\022i\324\306\256\n\270\026Q\373\003\325\314"
+	.ascii	"\211\250(\370\020\025\214\013Q\277\270\007\352\t\336\241\254"
+	.ascii	"\203\312\274x\262\254\213\273eY\034\250l\3149\224\311\265R\232"
+	.ascii	"\227\230oP\212\202a\351\037\250\373\\\361\2360Gv\232\327\323"
+	.ascii	"\217\353\212\2617U:\216\027\226u\b\016Y\235\237/.o\343xQ\327"
+	.ascii	"$\357\372\332r6Iv\245\327#\225\\W\221ait~U\351\177\342\363\325"
+	.ascii	"\354\250W\2356\371\276\257P\264)e\365#\325\373\276\354\316/\260"
+	.ascii	"\346\002\232\271]\231y\b3\211\242f\236\306\256\326\215\3246\213"
+	.ascii	"\265Em\260\360}\337%?cd\227\327\353u{\227Xgt\024\216tx\032a4"
+	.ascii	"$\026\375\t\207\037Z\350e\033\324\205K\020\321\n\275l\223[\310"
+	.ascii	"\222C\256\226\022\\!\24011 \017k\270t\360+\206Aq\275l9\220`\205"
+	.ascii	"C\322\256\227\355\006*`\033\\6\275l\177|\212\224\037 \305\366"
+	.ascii	"\361(\336\345\303\201}\366\355\256q\303K=\004\020\302\b\201\254"
+	.ascii	"\210\375\274\365\262\355y\2402o\372\023\327Z{\276\005\327%=<"
+	.ascii	">\310\337\240\370\344X\376\"\277\365\236\025\357\336\036\032"
+	.ascii	"\372\370\037\330y\232q\321\233\363\332f\217\337r\356\177w\200"
+	.ascii	"H\274^\266\355\273\030\247NDl\037\n\260\221[T\030;\236\351e\313"
+	.ascii	"~\2475\365\341\022i\310\276\321\240\013l\262\274\361\316\021"
+	.ascii	"'a\203\324\"\263\267\276\366\245\353w4\016P\313\025\271p\375"
+	.ascii	"\007\302\004\023\237\313\226\2319h\301\345\320\337\373\2762\270"
+	.ascii	"\351t\235 \334_\232\345$B\204\264\315\212\350b\350\377\337\\"
+	.ascii	"\214\200\376\n\204\tV\237n\272\351\374\320\330\227r\203\2119"
+	.ascii	"\337V?%F~\317\030z\316\222\005\302d@\344V\266\334p:\216\222\373"
+	.ascii	"\0133\031\342\355l\226{H\333\254\002a2P\r\263\274\221\273M#\261"
+	.ascii	"\322\207\345\213Q|M\267g\276\2467\334{<hTg\205Z\033\027\270_"
+	.ascii	"\340A\244\t\2654g\357\373.\351=9\364\262e\201;\217\007C\274i"
+	.ascii	"\343\323\313\266\331\356\022\336)\365\214\r3\017\"\337\027\253"
+	.ascii	"\307xP\211\352\2253%,|Kx\227\232U\276\n\277\021\372\270\234\221"
+	.ascii	"\331\255\351/e\356\206\313#\345\345\337\302\354\316-&\351\334"
+	.ascii	"\325^\323\334Tv\356i\253in.&\254\316-]\235{\313\352\334d\315"
+	.ascii	"\326\334Z\r\327\334\315vk\356\254&\323\255t\235\235\270\316W"
+	.ascii	"\253\263\222\325\331\2026\323\234\244\3154W\340:#q\235)p\235"
+	.ascii	"\217\274\363\004\256\263\225\353,\201\007g#A\316\021\0049C\020"
+	.ascii	"\344\374\200\353\354\300;7\360\316\f\270\316E\\g\"I\347\005\222"
+	.ascii	"\316C<8+\340:\013q\235\023p\235\203\2703\020\327\031\201w\376"
+	.ascii	"\361\316>\\\347\003\336\331\200w.\300\235{\270\316\004\270\316"
+	.ascii	"<\\\347\001\\\347*\327Y\200\244\363\216\244\263\016\3279\307"
+	.ascii	";\007\360\3168\222\316T\256\363\215\244\263\215w\256\361\316"
+	.ascii	"S\2563\r\327y\206\353,\303u\216\341:\303p\235\245\336\371\305"
+	.ascii	";\273p\235[$\235Y\270\316QIg\250w~\nrvJ:7\00593up^\321\301y\251"
+	.ascii	"\203\263\212\244s\212 g\024I\347\023\256\263\211\244s\t\327\231"
+	.ascii	"\204\353\254\344:'\271\316#\334\003L-Z\332fu|S\241w\325g5j\005"
+	.ascii	"%\024\0332&\230<P5T\303\034 (>\236\322\351o\215\224\t\206\352"
+	.ascii	"s\3741\217\213\021\307\007\200\343[A&;5T\177\354\033\3142\b\205"
+	.ascii	"\272Q\247|\352B\307\205\t\306\306\337\370#\323\234\234\215?\376"
+	.ascii	"\321af\246\326\303)\235\376\336\355\337\230^\230'0\3010\301\264"
+	.ascii	"\315\326\360\362|\352\251\257\321\315\237\372\020df~\\\214Yc"
+	.ascii	"Z\211ac-\246\360\304\306O\235\212\360d\330\235k/&\205\265\304"
+	.ascii	"\302\326rz)'[\331v\363\217Xzc\342`p\305\246\361\255\365\253\334"
+	.ascii	"\326\330\214_\237\306\367\326\331O[\352g\374\207&\n~Y\315\377"
+	.ascii	"\303\265\225m\214\227\361\275\225\326lle\013\343c|\257\301\370"
+	.ascii	"\246^9L|Bi\251\357\254_\355\266\306^\274\024\236v\361/\236]\334"
+	.ascii	"b\364\340\351]<Q\034\nz[cmW!\265\311\277\364\372G\254\026\032"
+	.ascii	"\343\366^K\267/2S\2134\246\331\020\026\337\342\327E\24633\026"
+	.ascii	"\317\322\321\251J\373\351\350\254\255\210\372/VC\240>\352\331"
+	.ascii	"<\2462/P\317\366\321A#k%X\226Lx\301\303\334}t\375\247\377!\373"
+	.ascii	"\242\307\3058m\247\243C\345U8\241}\t\314\351giz\247o\367\304"
+	.ascii	"\2604}[\030\210GJb\n&\265\017cN\237+\236\351\331\275\343\337"
+	.ascii	"\322\257x\243\305-1*\236\315oZ\025\277\364E\207[i)^\305wS\025"
+	.ascii	"*)\236E\f<\374(m\301\035^\271"
+	.string	"\016\361PL\341\367B\256\221y\021\330\321\254U\327\024\332\351\002\371\374\004\212\265w2\247PN<\212g\017\271~\353\304\267n\201zi\362L\230xff\365\233J\024\237U\342M<;\207\213\221\2043u\317\375\333\310,\303l\363v\226x\2660P\205\276'tm%H\344\351\305V\266JO\342\233\353\231\250\364 \356\302H$}\r\276\326#>\351\233\253J\323\033\017q\f\031\361-\346\212]\365\t\207\215K\351\245Q\275lE\300p\307\216\b5rhIHO8x\364H\337\356\325\241s\364}v\345Lu\204^/\333\020\177~!\276\307\256\314%\302\205\211"
+	.string	"\361\3149|N\025\n9\354\242\321\203\210\003\307\350[\272\300\021\332\372\351\002\251 \025=\fUM]\366\332\371\341\213\276\315\333\272\343\246\n\371\302\207\357\263\260\306D\266,od8\251\363H\332D\357Qo\263D\352\021}\217\2055V\331\224\351\247\363\303\023b\350\231wx^\025\212.\357\373\302`_\301Y\340\221A\217\036m\263\354\241\363\216\320\017\031y\317\271\nB\220\357\233\325N<\366\201\200\267S\350[7\277\032\372\264\036\213}L#1\004\241\206\335\256\247\254\216\035\3151\313\034\373\231\366\031\307n\206\215\342\306\376\266\256Aac\257\252-\222a\017#GMq}#gdGk$oz\003\t}\205FT\366\352\327\255\261\207\341A\2447\322ZK\256\232(\261:R\201\0252I\367\360qd\211\021\r(8.\271:"
+	.string	"\311\301\004<68\242\304\312\310\017'M~\226\030\321\300\310\217\r\214\004q\322\304\307\252\331\352\251\t\006H\240\230$\201\272 \211\221%PV\0324\201z\022b&\030\034\321"
+	.string	"j\003&L4\200\372\311\312\352uG\005\277v\f\235\344\273\246\237\224\365MN\362=\375c\263\2150\213"
+	.string	"$k\236\223\247\340\221|\313u\017\227\025\345;y\366\025(x\f\240\213\211O\036G"
+	.string	"U8\362@\240\213\003(\303\254k\226\037\376\326\273\023^\260H\360\023X\255j\226H\360V\357\306\265\255\341\252\2272P+[\t\366\352$x\f\240y\252O\025\272\345:\210\216\220\257O"
+	.string	"\273\356,s\211l:\034J\003\315M\331\244:\206\256\340\273\3263\210P\032\020w\274T\007\0318#_\004z\230t\026\302\345\210`quk\023D[\313\220\211\340\373\r\224\260\n\3013\203\320\270\212aNGT\325\326)s\032\006\202\301D\266;Ga\240\203^\355\177\204\323"
+	.ascii	"\036\300Z\323\230S\264\2639k+\n\314)\230\007\3528\320\\OP\226"
+	.ascii	"\3559\357\254]\224\\\034\370n\003\365Kl"
+	.string	"\340\311*\335B\226c\325RB\003~U\006\270\326\261\252\024\177\314\204\262\2121\273N\3745\313+t\305\302\024a\n\363\353k\216s\r\253B\256O\006\276_\200\312\220\310\326gq\nq \265W\037X\344\257\236}\035\241\310\367\030T\206\3523\313\357C\247A\347P\r\263\2444\0230\207#\307G\265~\261\207\231\272Y\247\260\253\325\235} \221(D\276\bTN\365\271\300;_\257\207\374\002k\bWT\230Z\206|?\241|J\353\023\020\330,\211\376\276p\023i\233M\361g\230\265f\255M\"#0I \341\213@\371\2527j\264\364\333o\256\206\273\2516\341\225|\027\227\027\362\235\266\276B\336\003(\f\211O%o\3017\227\177;\244\r\274V\266\t|K\023x\2469m\215\227\326\265\262\r\362m\302\037-\002\371 \257B\220\235z);\215&{\237\321[\336\202\357\342\032\032\310\347\301\003\344\333\020p\005"
+	.string	"\201o\262\037\217\300\017\037\377\343\217\344||\2109N\343\245\324>\340{\213\001\177\300\037-r1\362(\340\r\350\361\005|\221`\317x)\273\365\262\355\361@lO\303\037\366\370\266k\247\257\275\302\26122^\312.\024at\365\037M\017\241.\376\247\030\227W\314Ky;K\242\277\302\267s\336Y\303\374A\224\037\\\"\353\274 3\f\312\024\023\023\363)"
+	.string	"\331\270\215\215\215\215}\3256\365\273\372\215\327LT\362\232~s~xlZ`\270\363}\231\252\333i\261\f\034\251\227r\367\370-\004\004\376\021\360@\240{\325\347\n\335t\203v^\360x\031\032\251\035\340y|sY\211A\311"
+	.string	"\217\001T\257\2324\002\034-\027p\220xA[H\326E\313\264x\323\312g\261\366\314\236\017\232W\365{\002|\325\273\021\340\023\200\262`\326\375\306b\307\273\320W\255\216\337\301\237\367-\\e\t\203T\250\002Q-MJ\250\324\310\210\210$I\ni\r\222\013\020\b\002Q\234\205\322<\022\340S-\307\224\0201u\222$I\246\003\253j\367\247\364\270\350\257G\322\022\213T\310\035.\f>^x\225\310a\372\005Zi\316\006\362\302"
+	.ascii	"\222H\331zQq\305;\021\371\253\363\353R\321\214\330EO\353\234"
+	.ascii	"\221iU\317\013\307\317\224BBP\343D\013?\354>\365G\320\274)\266"
+	.ascii	"\022\222S\027\312H\213'n\336zIq\216O&Z'%\037/O8\337\n\312\005"
+	.ascii	"\216\001e\330\024\023\\\200D\354\b`)\350\364\r\362\262=`\223"
+	.ascii	"\024\357\326,\013\274+\027\222\304\310h\377s\206nd\276\tH\007"
+	.ascii	"\231l\020\242N\320Zaz\2458}\230\334\033\257\f\221\204\351A\001"
+	.ascii	"\337\264\222Wx\366\300\207!\206\006\210U\311\253\336D(\361\362"
+	.ascii	"\330;n&\312\350\301U\315A\263"
+	.string	"j8\t\373\031p8h\t`g@\351.\334\317\035&N\354\202r<N2^\254[wpB\200\260u-\017;\360\020q\201\263\216\274y\r\254\316\r\t\216X\216\215\0236\213sZSf\253\365X\273\250.\345X#\340\265`\3402|\200\345\210\263\360Os\313jF\310i\217.\210h\3269=\033U\224\310\316\320.\363G\302N\034XS~\226\207\317\332\325/\027\004\200/\215\340\024\264\002\"NjCa\242\357\210@\337\365\036\2734\323\016\271\372\257=9\342\234\206\316\255\321E^\340\315\215\330\313\017\350JT\017\021\022r0\2700!&\004\355w\260J\323\242\204\347\323\316x\300\220\377\213\355\005\024\022\230N\344\340\017\356\357\373\210\312\365\2017\356\215\2128\331\3779\023/\265\331\234\326\254$h\327\306\345\224\336\361\245+\r\352\355\354\251\346;)\234\3711\376\317\221c\254\354\320/\262\332!V<\0011\242"
+	.string	"\271\346\227\360*\207\342\233\221\355\340<\354\353\306\331v\013\177PS\321\004o\216N\323\371h\302"
+	.string	"()\221u\220\317u6\222\204\312ub}S\2711\335jc\363\244\366C\016'\314\255X\250\034\311\332$\246\345#\031\204\361\302\335\336\3629k\255y\f\315\026\013L\353\"\331\026U\027!H\261\277\003\317\031\311\177f\375\255\004/\260\037D\347\035\331\205\332O\342\367\316L\305]7\207t\302\365iU\262\220\022|\240\003\231\023\202U\340DJ\004\\\245\006\366D\313J'\370\320\006?\033l\232\267\036p\213\225[\230\324vl\270.b\036\202]v\353\b\233\315\304\016\023\367-\320\036\223\323\362\375\233S~\002u\215\0137;!\275\272w\"\302\fbC\230B\016\033\221C\027\357h]\263\341\215\335\226S\210\023\t\215\017$\366^\330\347\263\303\261\372\211u\317\226S\300\336q\375\266\243\021\310\031DM\307\207\276t\027\346F\017\t\005 \375\215w\246EF\364\323<\270\320\234\353l\303"
+	.string	"3\326F\223"
+	.ascii	"\334\317LB)"
+	.string	"\374EQV3\203\003\301vY\002\260\325\345\326\227\267da\200(4i\024\017I\202G=\220"
+	.string	"\236L\360\321\372\360(}\304\202\334\206^8,\n.\317L\026\361:\220\353\316?\204U'\254\323WP\261\262DWT.\245iq\177\332@]\346\224w\207\033HJ!k*b[|\0271\256"
+	.string	"\377\357\345\312\317\216\"\362I'%\305/J\230\r/`\235`\030\242\025\200\247\345\r\264\263Sb\227\243\223|W=\354\264\206a\245m\300\2434\340Hq\202H\0248\332N*\311"
+	.ascii	"\240~U\327\340\027\251\323p(t"
+	.string	"\260%\036\202\260\027\342\035l\263t\272\356\201r\017\270`\274\226J<\024\334\336\303\302\375P\274\026y\367-\365\367\263\370D\034\337.M\336#PU{\0210\030C\237S\364\255\250\351\310\n\231\207\367\337\340P\247\346P\332\352e\251U\016B\205\232\252\215\262*\251,\204\243\031\216\262\243\204x8\361\322\340\362\200\330\253)\365\001\260\2236\305}c_!v\353f\034#N\305\262 ^\303@(\035\327>\022NbW\216\314\342\273\2131%'\2704\330\365-n\255\016N\300~]\026\221\245\311\305JrwA1o\356\200\320\233T\254rP\202f1\362W\013\346\b\305\271XX\332 \245\205,\2131Q\216~\nzL.\303\276\0074k\323Z\002\277|\344n\241A\221-Sz\250\026\317\246\260U\317e\017\311\202\270\rX\377\272\306S\204\372\301\305ck\210\266\331\257\235k`\271\213\367\376\024S/q4\004\270"
+	.string	"'\274>\270v\324\241\327\224\230\217\365\003\004\3571\220\035z\217fU\022N\331+e\021\215\034\013\"\3077\007=\370h\244N\267\347(_\260\302\t\0202\377\242\205\347\035Z\005\321C\327\371\226\365\344<\332\027_\n\005\303c\243\365Ur\345\312\224\032\206\007U\\T\240\260\375`EabB\221\244\n>\323\267\256\222\217"
+	.ascii	"(m#\3664\250\372\335d\037\322\316\336\224\034D\206v\323\340b"
+	.ascii	"\370\355\340\325\3775\033\325\242\361\207\271\273$\027}FI\366"
+	.ascii	"]\367h\fRA\035O_#l&R\2342\353\035m\273\352 E0\232\252\250O-\016"
+	.ascii	"&\346\304#*\022R\005\244W0~Y\263\227\356.\275\\TC\304\302\362"
+	.ascii	"\376\332Bm||\n#\215\244N8\261\006l\317o\027\331a\376\025R\377"
+	.ascii	"Yt\320\223\240\243\037\rtJ0^\314\315J\342D0\216[\310B\342\221"
+	.ascii	"\003\t\274\202\331\221&m\343\203\267t\376\204\321\362\363g\314"
+	.ascii	"`\340\361\213F\024\367\251\241\030\323/\323\372*\031\033\007"
+	.ascii	"gR\370\354\fO\273c!\213\272\374\374\244\301\301A,G\002\212U\270"
+	.ascii	"\362`1:\rN\007\203U`(q\2627\377v\255\302^\210\026"
+	.text
+	.section	.gnu.lto__update_checksum.99.eb51553ef5eb4835,"e",@progbits
+	.string	"(\265/\375`\344\001\215\020"
+	.string	"\246^lF"
+	.string	"\257(\035\f\273\t\304\201\272\353\363\267\303\"\035\317\3423JZ\352\023\b\243\240\002?\206\313K\202\276p7\217\272\275\235\217\025\217\002\023\275xc\351\377u^}\020\364\310\225\020TT\340\273\371\275\030\215\220\275\245L)V"
+	.string	"V"
+	.string	"W"
+	.string	"7\300]zN\200\273t\312Nq\020fr\304x\210@c1\347\364\326\202\177{\004\357\250\251\313\270\232\362;\302\025\255O\3452v\253\027\206"
+	.ascii	"\337*\202\330vlN\273\272>\225F\r-\337\323\316@'\254i}-\327n\301"
+	.ascii	"\234\323\332\372&\334\334m\223l\207l\r\005\007\3609\370g|\366"
+	.ascii	"c\034\274\273\317n.\252eT\307\250\336\250\326\250\376\200\215"
+	.ascii	"\r \276\207\2659_7\0273G\332d\320\260iP\034\002&\313\f\205\017"
+	.ascii	"\031\027\bVm\005\241\324\301\223wNX"
+	.string	"\211\003W\373\035\036\223\372\fu\320\234\261\017\"\346\004\023\270\303si00U\234s\316\2702\333\037\347\026\264\335Kh\202\305A\2457K\221\270\273R\344\344\211\273!\t\227\313\356\347\304[*t\277\273\177\301\202\251L\272:\342\265\221\223\347\202\217\342.\277\334Kx\343rY\321\333\326nV\337\256\314\006U\024\004\306\266\343\215\331\240\323\374\033\227y\rBLFQ\024b2\212$\222\007+J\021\215D\217<PN\034x\245\022\217T\"\202\340\215L(\236G\001\227NHL^J\251d\3624\300\371\215\331\323\242B\316\312\252\344\312\374\252\341\300\366\223\261\335\272N\373%\324pB,h\035\025c\271u\3314\203\202Em\376\355'\256\333\317v:a\r+* p\202\231\224\333b\340\225#A[3Q\221\243`\024\003C\214\273\r\030\351\263.\235\346\363`\333\240\013\347\005\217o\230\255;\030\2363\340\324\006\263"
+	.ascii	"7:\"\312\035\243\371\2256p\255\r\216\035\003\263a\006\246\224"
+	.ascii	"\035|\f\343\006\340\210\200D\t\367\022Y\310\023\224\335\f\242"
+	.ascii	"l\272\350\023"
+	.text
+	.section	.gnu.lto_UBLOX_parse_gps.100.eb51553ef5eb4835,"e",@progbits
+	.string	"(\265/\375`L\021\205H"
+	.ascii	"\372sp\031@@\346\316\030[\326\b\332\252\346^E\013\227\252\377"
+	.ascii	"\022B\337s\2416\022\274\332\206\234\332\263\325\337n\r\013\372"
+	.ascii	"1\262\023t/\370\200\337\rz\357\031\340!\360\373\"\"\252\252\252"
+	.ascii	"\252nDJ\231RJ\001z\001r\001\216\001\255s\221\350l\325:W\255\316"
+	.ascii	"T\253\363\324\352,\305\316Q\2533\324\352\334\264:3\255\316K\354"
+	.ascii	"\254\264:'\255\316H\253\363\321\352l\264:\027\255\316D\354<\324"
+	.ascii	":\013\261\316D\326\271e\235Y\326y\355\272\346_\235\375\235\033"
+	.ascii	"\204k\245\007\217e\373\265y\337\036\207\205\357\0346\315[\327"
+	.ascii	"u373\327\340\206r\021\367\\\323\325\350\272\031\375\252\275\215"
+	.ascii	"c\220.\016\340\373\332m5\313\002\204\232\305\352\247\266\331"
+	.ascii	"\265\233\332fY\001\203\032\354J\225!\377$\240{\243\3742\370\276"
+	.ascii	"v\306o\302J\275\3325K\271\333E\253*\252)\251(\250'\247&\246%"
+	.ascii	"\245$\244#\243\"\242!!b\313\256\357.7\262\213\304:\205\205tm"
+	.ascii	"\205\264L\316yUR\213SQ\250\2432\265\022\313zH\351\2764\271\365"
+	.ascii	"\001!`\2327\227\"~1Q{v\324\263\241\244\364\223\224(\356\364\204"
+	.ascii	"a\346\344\232V(\021*LOz\351\211\023Wj\353\244f\233#5\341\322"
+	.ascii	"\230~d\224%\253/\315\210\027e)Q+\322D+\002\246\336\217':l}\032"
+	.ascii	".\255\210\017\365\245\021Y\261\340\322\206\270\020\361\353\002"
+	.ascii	"\333\337\2349\252\022\265,M\024\322-\321RH\263HK\263\025\353"
+	.ascii	"}\337\206\266\243-\313|u\272~7(GZI\332\332\215\226(\357I\036"
+	.ascii	"\3212\331:\361\353"
+	.string	"}_\366\263\245Z\363U3{\0273k1'\375\005c]\366\334pB\346\036l\252\353\322\271P\027\3326;\364\020\230\202\344\326\204\236\271B\007\002\023\234\366Y\340\013\375\177Q\032\022\245\315ym\373\304'\356\231eIZ\350?\200\177-\225}f\f\355\327\207O\206\326#\315\303\006\222[\237YC\337\021\361$\335\320v8$\365u\235\016\036>x\237}h\233\375/g\201\f\242\347\210\340jc\036\321rHh5\330k>\023\334n\315\362\211\024)\332f\327\357)LAj\035\2371\212\301\234\016N\233L7\2641\354\275\203\200H\257>h#\004\\\337)\246\371\013\351U\356v%fjW\376\235n\270\337$ <3\367\314\343f\303T$\r\267\232\266\221\274P\264)x\334g\376O:\367|\221\334q\227a?B\336\305\266\331.{?vsO\346\036\303\314~\272Z\3104\362\276\310f23\373\361\263\367"
+	.string	"\226\322\r\231;\332a\216*\302\302\332f\375\257\376\336d\365\212\226\333\013\215\025.u\343\226\3216\033%\235\366\226\346\"\203\333\215Y\210y\2375\313-\3266\333\217&\320\224I\267f\303\017\231\355\220\376N\346v4\202t\334\370\2270\257\316\027\276Vg\b\354ld\235\275X\347..v\336bg\004D\347\003Dg\003D\347\002\2533\201\325y\300\352\254\265:\013X\235\003\254\316Y\2553\026\353\f\200u\276\nW\017\340\245\374\314\262$\205\270\027\021\021\244]\334&\003.W\337\201M\274\342\020\267\003\203Z}\361\377\216\322\320F\021\247\233\341\325v\304\347\334&\001\251\026\253\357g\023O\216\215\2315m\3000\256\251*\211\307\201a\361cs+`\005\252\270o"
+	.ascii	"\340\252\276\231\315;*\3253\273N\237rL\352>\177\363\252\333\304"
+	.ascii	"\243\034\271\334\3347-(T\337p\315;9\246)'R?\325D\352\307\232"
+	.ascii	"\321\245\244\255\356\273\350\037>$\256\366\362\322\022\345\364"
+	.ascii	"\372(\245\244_\342\243\241\336\b\217\023g;6\237\022\367\255\331"
+	.ascii	"$\201\372\346Cz\247\363h\bx|G7=\004(\336<\022\210\342L\367\355"
+	.ascii	"H\3237\221&\030\274&\0304m\300P\310\034\244W\217\230\2068\262"
+	.ascii	"\227\236\311\205,\375X\323\213\321;\331\211\266\272\243Q9\206"
+	.ascii	"C\\\335\365h[\335\365\277\245\220\255\313\036\245\007\342yg\201"
+	.ascii	"]\257\364\335\026\275s\365\222\0237%\372%\337\3076\351\215\352"
+	.ascii	"\272\350\271\341\204T\\\355\330zK7\256\363\322\222\276\365\364"
+	.ascii	"\364P\261\275\360\r\355\326Q\327]l\221\376\302\263+\327\222n"
+	.ascii	"\025\327q\034 u\2578\232\033w\325\346gH\337A\230\207j\016"
+	.string	"\237S3\355Q9g\250B\357l\267\345\036\3642W\316\205\226`V\007\211G\236\254\366\2615\372\243o\345\232\277F\177U\370\246-z\303\276k\242/\372V\376H\372a\341QK\030\321\2171\005Q\255~\320=Y\267\035\372a\315)\274^\270Pa\024\0133\266\b;\301\302\230b\354\205\321\313\211\305\\\034\307\2140\304\304\306\214Evo\377\022\246\200\027\215Z\271\231P!4L\024\357\233\260\215\306\367O2[\021\315\307\235\034\275\326\314\363\234\032\377\314\370Ym=\230r\213\355\220U\206T\275\223\260\021<\212G\360\2774\264\302\244\363!wx\340\250\016|\262\260\r\374\201o3f\362\337G\316 \363#\373\363>#\373k\2335\360\235\326\344\243N\275\223\033\332\007\340D}=\257P\377\\\217\306\365\005\036\214\300\0270$\360Qz\272{}\337\367\225\232\321r\375\3277\261\021\036\2321\007\f:\026\245\204\177\310"
+	.string	"\371\240\240@\202\323\001{T\255\300#"
+	.string	"\351\037\3015O\220\377\035'\370q\313\"\370\2719\026\364q\227]|\264\276\007\233{r\002\364\034\257\332\244T\027\371U\262A\216\347(\241\355\216[\346@j\307\315a\224\326q\227\\}\002\276\247M=j]\200\237s,J\331\371\\\016Y\225\354\320E\"\005\223\256w\214 e\342q\3342\007\017\224\016\307\315al{\343.\013H\335\004\320\223\373\217\266)S\213rr6\355\244\0244|\342\236\321\376\243qC\251\351\274\022\3156\317\351\323;\217m\326\377\226j\\\027\276\2544G\264\260\275\263@\033;\374\314q@\017\307s\227f\262\276\2034\331\310\211\311\033l\323\036\025DB\005tz\247Y\217\361\341BC4\327<\247X@<L\364\375"
+	.string	"<\326\177Uih&-\201o\250a8\306\234S%\"\"\222$I\2415\301\005\304\020\005\331\335\016\021\300,\247\23434S\222\024\322\001]\303HB\243z\026\021\220\317\215~+9\347\317\212\271p\242\273a.\253\\\027Gy\205.\314\354'\264\316\367-\331Fq[\314\342\020\367M`\270\347dCS\341\231a>\302\212\332\214,\323n-\001\270N\233'\342\007\325\2170\336<Q\026\310(\007\247z\256s\212O\314\333\3105\224\367\307\227\212\335\024?\216\340\322\307\f\2251.\333&\321\036Z-\006\031\026i'\332<\274%a\364\003\240"
+	.ascii	"\3657\013t\007:\034\270!2E\332\227J\305=&\372\204\360\333C~\342"
+	.ascii	"@\253q4\236` \317\035sB\001\264\221|\373\217\262\336\241\315"
+	.ascii	"q)\035\325\006\024<\016\371:\004\372\245\324\ta\035\240m\217"
+	.ascii	"\230t\001\204r\177\247\017\220\325\344\b\325L\364\347\262\206"
+	.ascii	"|<\340\316\031?`\t.\332\340\316\255Iti\261\270:\343A(D\030\026"
+	.ascii	"1\233\003\f!\214/m\331\244\343\177\244\353?l(\204\331f\003$\302"
+	.ascii	"\226Lu\322>Ro\220|\214\"\273,\370\244\243\266@\364X\221\351\240"
+	.ascii	"\005\227Z\322\244\223\352r\245\004\262\036g\271\024k\267\346"
+	.ascii	"\265]\t1\356\2030 \353\213\256\206AQ+r\007\037\315\260+\373?"
+	.string	"\244\321\022F'\tH\031O\347\021t\365\376\006\232\236\270t\355\340x\267\332\230k\036?6\232*|ZV\315\333\300\217\241IbrY\204\361C%\275\033/>\2000\022>\357x\037\372\255x\3431\325\362\345\352/q=L\f\032\226t\362\272\361\274\335\327\200#(\351\276%({\261\332\217\020\022|=\340\300\370\030\265\325\004\377\325\037\247\312\002&\332\305\224\275\243\370\357Y\320\240\235sV\362"
+	.ascii	"k6(3\307_\314\2165\2040O{|h\270\332\315\314N\261\200f3{\357<"
+	.ascii	"\020\315_.\376\241\035\232\301\257\2315@\b\244\023i{\330\344"
+	.ascii	"<\237yn\340\340y;\003\026H\345\036i\205\3151\024f3y\332\341i"
+	.ascii	"\323\0267|\303 \344\274}\311-\310\226\364i\273\235\371\221\312"
+	.ascii	"\341q7\002}?\256h>`\242 \n\246\304\311\337\374\250\321$\310+"
+	.ascii	"\265\312\310\220\024\202\203\006\262\311\026(\313QY\316J,\264"
+	.ascii	"%\337\230\234e\356b\035\373v\f\302cM\3478=8\312\343>\364$\254"
+	.ascii	"\250>5'Y\254\240\033\373\354\206c\323 \206\267\016\\\331\021"
+	.ascii	"N\3559:\365\306?\373\361PL\270'\206\215x$\024T\200\265E\244\366"
+	.ascii	"u\t\375\007"
+	.text
+	.section	.gnu.lto_gpsNewFrameUBLOX.101.eb51553ef5eb4835,"e",@progbits
+	.string	"(\265/\375`F\020\325C"
+	.ascii	"\352k\f\030A@bR\007O`\244>{\330\205;\340qu\332\254M\264\337\252"
+	.ascii	"_}G'\211\253\370\224\217\272U\307v\177s\220 \312\032\251\237"
+	.ascii	"\321/j\217\300\216s\254\036\203(K\036\210x\024\260\330V6\221"
+	.ascii	"2\245n\001N\001\177\001\256\231*\217\375\247~v\177\177\270\307"
+	.ascii	"\372\3079\361m\207\215\267\2726\203\335\203Na\030\266\341\377"
+	.ascii	"\346\304w\375\277<\030\033\177\365\242\n\263\302N\bR\277"
+	.string	"\254\367]\252?\356w\203\257\264\337}\367\035\376U'\272;5I\245\264\302C\266\032\340\336\364\300\273~\245\363O\277\\\3030t\256\016\206\255\b<\300\373\256\202\006;<\211\024S\376IP\2053\006\347\007\303\326,\375\304\215\037\264\276#s\362\245\242\240\236\234\232\220LKG\243R\022\322\221Q\261\210\2108\034z\205\333\r\352\234\364\177\020o\257Y9\247\362\245\2509j\310\025*x\034B\205\371yM\267\240\201=\273\276gkN\363S\314wu\362\322%7\005\265\230\337\331\3475\245A\b\203\306\352|\\\225\214tR\326\366L\302\tqo\240K\230\351_ZY\333/\035\213\316\345\224lT\222\222\223\242<R\024(\371\310\250\350\\V\277\212\255\211\226\213Uie\320/\312kB\203T0\f?[SI&\372A\207Hh\350\37283$T\333\372y=\240\001.\263rN\"/\314k>\307\362&\362n\320"
+	.ascii	"\024N\221\242s\031<\316Q\333\363\325\317dN\261\034\314\324\327"
+	.ascii	"T\326\3423\263$\237\326D\322#lo,H\346\206\316\3450\013'\3000"
+	.ascii	"\354\231\351,{\237z\367\334\345\356\t\334\213f\001\311\025-Z"
+	.ascii	"\354wu\240\005\362\343\003\313\333\267\211\035\324\325\362_\033"
+	.ascii	"K\273\312\255\224\253^X\036\344?\367_\375\013\200M\277=e\006"
+	.ascii	"DV\371\202\027\324\3211\357\023\224\031\320\377_\273\326\004"
+	.ascii	"\244\357\370g\337 a\246mt\374\353\b\345\254\340\371\317\331b"
+	.ascii	".Y\230i\333\235\177\034W\211\033\3777\301\347\032\1776\332\216"
+	.ascii	"\f\215\177\232\374K\340j\240\025;\1773\377b:\320o\332\006/)\343"
+	.ascii	"O\347}^\030V>\324?j\277[5\001\256S\325\333{2\356\336\347\037"
+	.ascii	"\352}2\023.\020\204\315r\240\373\213y\271/\3775w\301\225\237"
+	.ascii	"\371\256?\227\356\260]\002u{\202\345\255\273u\231"
+	.string	"u\324\375\037\320\033\247\324u\023\367av\2557;\210\307\276\177\370\351?\326S\337\257<;\201\241\354\003<\273\325\233]\300\233=\300\233\035\300\233\275j(;\325\316>\365f\227z\263G\355\354P\302\354O\302\354N:{\2230;rgg\332\331\227v\366\343\316n\024fW\022fO\022fG\022f?\332\331\215v\366\342\316^\264\263\023\t\263\023w\366\341\316>\264\263\277;\273pg\337;\273\273\263\007wv\275\263\377\210\002oK:o\325;\235\265\302C\266\205`\274d[\246V\351I;\311\271>\351\001P\236N\372\013S\353\244\207Q2AI\356\0322\365k*v\307\220\3352@\3050\f;x\327\263\227<\335\340\277\366\256s\350\320a\277\313@\357\f\251\233\264\021\034Yv,\020i\315km\244\376\264\353]\033R\177\221\370\356\357\311\264eI\0375S\226\245\243f3\352\243\025\243\316\021\337I\237r"
+	.ascii	"\035\t\377kOI\021\2571\222\362\\\256z\376Z;\212\326\007\022p"
+	.ascii	"V\240gE\035\315Ot\304i\332\210\216\340\355\025e6\257\265\225"
+	.ascii	"\264\013\006\367\344\032GI7I\322HZ)-IK\375\325>\322H\372{\024"
+	.ascii	"Z\036\351$1f\234\021ZQ\027i#%\305\"3\"]\204\204H\347\210\351"
+	.ascii	"\376\360\216\b\202\343\205\210\250=\027\311F\264D\220 \261\211"
+	.ascii	"\332(\372C\316X\340\260lH\277z\330\034z\205\b\365\013D\250s\304"
+	.ascii	"s\322\273\314\374A\327\346\n\321\207\211\022q\234\364l\367@\341"
+	.ascii	"\352\240\336a\256>\352=\203\032\354\231Z\255\203\372{@\227y\233"
+	.ascii	"a\255s\304\330\277\247\233@8\037Y5\377b\322\216\f\013\241\310"
+	.ascii	"wL\355 \0257\342\267\2773,\355\2675\"~\223\236\255\351\3332\265"
+	.ascii	"\177\006pHG\321<\337\360\272\3152\265\257\216\372\327\376\223"
+	.ascii	"\002\255\320\021s\017\214\320\363\350\\\363\324\375\207\331\312"
+	.ascii	"\301\333:\352\337\347\004Z\3372+\247\375\344\366\317\363z\002"
+	.ascii	"\\\317\242\005\215\031[2\366V\215-\026A_\201EC\206\213\254.\256"
+	.ascii	"\254\030\\[0\262V\314\240\221\205e\364.\031-fd\325\350\352\232"
+	.ascii	"\221E\264\202\275n\342\217gWh\214.*\307\317\242\032g\214N\377"
+	.ascii	"\236\277\272\322E&\332\336\337\036\230^z\006\264J\021(\220\335"
+	.ascii	"\223U\222W\3623\t\350W\353\303[je\216\2434\213\212\300\3267\340"
+	.ascii	"\357\351b\353\302\240t\324\177\317[\361Yi\017\261 \351S\200\326"
+	.ascii	"\006\320\002\374\344=/,I-Z\366\273\0014\216\270O\372|\002\300"
+	.ascii	"gO\256\373*\r \217\327\253W\245e\304|R\252\204\177\261=\337I"
+	.ascii	"R_\030\361\3000\374k\3760\366\273Vx\370\3002\235\\\007F\222K"
+	.ascii	"R*\335\357Ri\017\261\237\277\247\323\224\376\2649S\372\253o\245"
+	.ascii	"\305\372A\335\232t\324\027\fb\002\241\265\334\222\221L?\225<"
+	.ascii	"\t\"\2654\233|\367b\t\017\034=\207u\347\241&\273y\361f6\271M"
+	.ascii	"\322K\322-YMV\367\273Z\232\200\236\231\355v\273}\257\375A\203"
+	.ascii	"\320\037\367\007\210\244Yf\261\320\245\316\326Q\2310i\323\204"
+	.ascii	"\210\371\264\361\331\301\262$\245\317xA\305f\336kGi)\255\001"
+	.ascii	"\235B\246\363z=\317\3452\025,\\\270\260\337\215\322B0l\033\324"
+	.ascii	"\215\232\343\037s\347\b\245?M\f\224N\021\337\221\336\211\003"
+	.ascii	"\"'\357_\214"
+	.string	"\232\021<e\0064\352\250g8\"\\\201c\250qL\307\030\242\021\021\021)H\222\2445\001\006\204\030\246\356\352\001\021\3008\306\034\232\271\231$\351\320\007\302\342KaL\205\351X!U\254\310\235<\260\334\311\3079p\332}\332^\n\256W\223`\343\"h\376\f8\270\303w]T\372\233X\247\200\206N+pc\361\222\037\007|m\232\036)#P\310\365#\347J\345\264\254\200\275\226\017n\362<6\005\324=\026\021\360X Su\336_\237\201\350\266\332!l0z\211\023\372\336\211\037z&\251\204QO8\360\235\307\244\347\356\335!\365*\022w\362k\242@\325/O\260S]A|\312\305\344I^N\312\221\004p\264\001\024\205\037\330\fv\317|b\367\303\360\\\257<\"P*\313!\023C\325\320\261\326b\205\266\336\241\307\320\265\020~\215X\267O\202\336\021\3731\257\302B_\241>\334\3338\211J\r\322\313\376\354"
+	.string	"\336\352\242\372$\210\tU\2503D\351\030UVl\217\254\367\277\310#~\245/\250]\313\204:[\212\251\022h\340R4a"
+	.ascii	"*\306\306\356$\300[\260\370\265\332yO\357p\207O\372'\235\370"
+	.ascii	"\307\257\363\350U \370\226ib\023\330\211\336\024\206O\250\254"
+	.ascii	"!\216\037oX\353\245\fZ\252\355g\272\317M\226\213\243T\373\250"
+	.ascii	"\027\371h\023|c\017ABT\324.~\245E\330\256\331\026\241-\350=\240"
+	.ascii	"\204[b\247\335\306d\211\222\230\035\315kz\261\204\244\352\315"
+	.ascii	"g\261g\021\235\022\350W\261v\254\323i\277hx\024 b?O\017\006\r"
+	.ascii	"\261\304\320\374\302\346P^,\204hi!\201Q\324J\365\3227\245J\377"
+	.ascii	"\357*@-\302\033\364\376\241\022\234"
+	.string	"\036\245\273\230\250H\371l9&>\355?\225\326\320\350B\224\271k\343\206\030\207\2463\212\272\"\366\311\021\241,\325@Y\252\201O2\r\362\311\0211\315\356\211B\245Tq\005l^9\226\247B\215(\302\251Y$\351lX\376\177\304[\324Y\354\030{2\2212g\356\003\006m\337^\241y\301\251\021!"
+	.string	"\252\201b\005*PX\252FJ\372w\246\204\247/\\+l\013,\313\\\250)\177\220+\313\203\374\350/7\b\n,\241\005]r\327u\333\200\200\3449A\270\021q\002\307\200\261S\317a\311\233\013[[\257\304T:\274YZ\356R\300\202H"
+	.ascii	"\223E\326\320\325\340\037"
+	.text
+	.section	.gnu.lto_gpsHandlePassthrough.102.eb51553ef5eb4835,"e",@progbits
+	.string	"(\265/\375`\230"
+	.string	"\315\n"
+	.string	"\226TKB \215(\035\027\267\203j\365\035\336\341\0303"
+	.string	"\375\2706\027\022\023lT'\035+\350\246\026@{\265\237\240\251\206\260UON+\002o\025\200\320\b\t\004Q(\355r\240\221#\027"
+	.string	"A\2156M\266\224)\0058"
+	.string	"9"
+	.string	"7"
+	.string	"\333\201h\360J\252\022\273\253)\203s\207\232\234\177\t\257\360\276\356\360\300\025j\234\022\264\262o\00478\254J\217\317\001\037)\263\"\262\273N\3573pc\267=b\273\303~F\013n\352\260K\340ebWX\006\007\266\357Sx\f}\202/\032X\210\260\273\3311;dg\307\236\331\316\264?B\270\247\002Xw\021l\300\260\033=\314a9f\316\036\201! \024PI*\204 \245\313\225\274\372\361\223\222\367\240>\336\002\202D\201\026\213\244\235S\257W\231>\224N\210\362e\307Q*\312>\\=\3310\r\237\3723\323\267\\<\210\b\031P\246\004Z\203\371tN\264m\243\241l2\034M\343\371h\230\213\267\216\211G\003m\233G\313\242\350p\365d\b\017Z,\221\216\240E\372\221\263\345=\253vw)x]PE\331\006\020\017"
+	.string	"3\241Ih\214\327"
+	.string	"\034{\r\r{\005mJ\t\3617\207"
+	.ascii	"]\303i4Q\006\025B\245.\213ky*!\247\024j\017"
+	.text
+	.section	.gnu.lto_gpsEnablePassthrough.103.eb51553ef5eb4835,"e",@progbits
+	.string	"(\265/\375`i\001\025\017"
+	.string	"6\235gF\360\260(\035\260\356\377\201\313\301\207\210\306\300\252\327\327\311\342\254\031\2134,+\366\254$\034\367>\017x\377\266W\346\336\307Sv\332g\n\300\367\030\354\233\321=\230\364q8\270\2644\215\"\235\346\005\026\002\311&R\246\024R"
+	.string	"L"
+	.string	"W"
+	.string	"\2730\033\263\3350\201\017p\217\016/\262=r\037\260=\032e\357x\030\333\0024>\264lrv\267S\021G]\323D\371\257\371\007\370J]s\271j\bpd\360"
+	.string	"\275X\232\210k\004\370\232\347\206\327*\023"
+	.string	"\203\335u\202\257\226;\336v\003\333\013\354\347\b)N\376\214WX\362\340\243\317\262=^\037\274\340\001A\363\242\312\036;L\245\302\330\327vw\2550\373\262\377\363\364\246\351\250i-\323\372t>}\320cr\\\034Z\336\241\307\256\253\207go\342\f\022 \266\237\366O\234\006u\331\351\001\002!4h\312wq\325\250\004l<\340h\271\254\036\333\301\231\251\302\330\036\3314\255\240B\007+w\234\037\331T5U\030\255\227\225Goa\201\333\335\022\237E\006\025n\346\264=\252~\310T\331\263\"\025\202L\r\023\\~\0363\273\341\362jc\370\362\240\r\2604e\037\305\003\246\222g\222\"Z\361J)\246\357\013\231|$\221"
+	.string	"\237\220|$Q\347\215\272\013\243\220JwR\372:\222\020{$\224Rg\362\274R\007\022\356\265U\230\035\224\bupT\272rH\372\021\266\207\022&\224\304vU\007?\272\251M!\324\322T\214M?27t4PFM\265QD\n\002\031"
+	.ascii	"3\241\221\037C\016\213\20767\320\336\223q\3656\362^\025\304b"
+	.ascii	"\201\355,=v\263\241a\006D\326\304\030\314\241eD0\\Bs75\037M\013"
+	.ascii	"\001\230s\t\266YM\021wy\252&\247hj\017"
+	.text
+	.section	.gnu.lto_gpsInitNmea.part.0.141.eb51553ef5eb4835,"e",@progbits
+	.string	"(\265/\375`]\002M\022"
+	.string	"\266\237pG\340\322&\035&\335\007S\3032\300\250\033\325z\004\312\"\006\223}\017E\220\246\216^\372\"~\263\253\343\200j\034\250\266\001\270\235k\2121\326p;\226\245iX\r)\230\271>\013\b\236\3023\200\322\321\303Y\273\367\226;\245X"
+	.string	"U"
+	.string	"a"
+	.string	"\253\024\035\273\035\236\210,\tYt\302_\361o\346B&\351\301\345\004\355\356\314}\333\314V\251.\017d{\346\301\236-\344\237\317\236H\007g(\267\273\335\245\366\334\273\302\350\371\266\257\236h\256\377>\300\007\255\307\355\003\210C\001\217(\225\335u*\304-o;\305\266\001\033*\005\3235/Uod\342\n\3658E^\177\361\222\332]\024\337\305\207`\374\237K\303d\340k\227\276\314\274\274\352\206\236\02496\241\032\370\304\302\366\314$er\331\022Q\243I\211\006:A\345\261\306\307\335]\353\216-\241Q\023zJh\031\241\243Bk\204\206\n\375"
+	.string	"\001L\361$\363\237\035\334\350e\304\347\306\277\037@qD\003r[\""
+	.ascii	"\245N\265\037@\200\257\271\344Fi\354\333x\221\314\377q\004\026"
+	.ascii	"\3102/\247\216$\215p\206\323\220\220\362e|\306\204H\241e\276"
+	.ascii	"\326"
+	.string	"2/\245\"H*R\215\025\036\303\302\215|vmPlk\370\315EA\220]\233\0040N\304\212-Wf\235\310b\\\035\354\325]x\271\300t\254\230\254;Y\031\026\323\212u\030`\260X\247\262\r\037Ww,upMJ5J\373a{v\003\340\206\013\312\355w\333UTy\354\001M\025\347\341\001\355(\201\224cB\351?{\266#\035\301!\265\245\022\350\177\013\030\300\327PZ\200\203\023\216\266\322\3409Vp\240Z\034\345\002: \200\002\021\303\342\006\t3\306\023\203\007\0234A2\320,P\225\306\351)\250\236.X\220Cr\211\001\t\272\215\275uv\261\007\343\016\023\222\030\333z\271\005r\273\020\321j\330\343ee\245\303\232\275(>\374S\224\205)x:\333\016\354\240y\207a\217\315qQ\376\3336%\026\300\355kk3\230\255[\220><D\313\2602bc\343\215\203nO\314\215\227\312\320\2052\363\266["
+	.ascii	"\265\027\022\331 \323\322\023\360\030"
+	.text
+	.section	.gnu.lto_gpsInitUblox.part.0.148.eb51553ef5eb4835,"e",@progbits
+	.string	"(\265/\375`\363\022\265J"
+	.ascii	"\252w0\032>@\346\316\030\305\243\026\233\3705?\007R\006\345`"
+	.ascii	"\301\372\250\314\303RK%Flwh\261\200\354\240\317\333_E\277\240"
+	.ascii	"o\367\202\317\2418?Q\233lnf\346\356\246\001!F\244\224R\246\224"
+	.ascii	"R\222\001l\001\231\001\316j\353\234\266\316\337c\232\235u\356"
+	.ascii	"\024OYt\336\227\310\241\242\027\212\252w\245\307t\263ig\362\365"
+	.ascii	"\340\033^a?\306R4p\240a\b_1\250\026\273\351=\035|#\n\312V\204"
+	.ascii	"\335rV(H\370\276P\256V\031\3326\023ss\253i:n=6kr\254\311\241"
+	.ascii	"\246\214\312\201\266\345\362\374\342\360~\357Ou\006\306\3355"
+	.ascii	"\003\tu4\035#\325\325\021r\227\351(s\221y4\035\253H\324\304\361"
+	.ascii	"`\271\345zp\223\341\342\230\036\rM\362\225\030\3645c\316\265"
+	.ascii	"\030\267\241\311\366\213\331\332\341-\005\337\027\252\325*\017"
+	.ascii	"h[\275j\247\265\325\264\231\326V\213\2556\030f\356\301d\2279"
+	.ascii	"\260\241lo\343\375\360\021%|\337\227\253\325_k\267\251\246\244"
+	.ascii	"\242\240\236\234\232\230\226\224\222\216F\244\243\242\021\261"
+	.ascii	"eW5}G\272\334\2764\373j\252\350\024\230/.\025\005\025w\305\237"
+	.ascii	"\236\355d\245\2127=\337\234i\211\365*\342\326JT\340\230m\236"
+	.ascii	"\324y\230nl~\f\220V\344I\033\237\2409\322]\267\331Q\232%\310"
+	.ascii	"f\260\3630\235\244ND\254,\341\230M\274\210\327mf\224\327\002"
+	.ascii	"\302@\303\024\022\233L\007h\213nO\366L\317\207\257\351U\036\246"
+	.ascii	"\222\364\352}\337\242\031\231\253\254\227\033\232\240\264\"`"
+	.ascii	":M\263\320\350\0341\232\215\245Nx\324\3764\231\366231\177&K\214"
+	.ascii	"\314\302\326\244\367};\215\t&\365\245F\262^\357\373r\203\205"
+	.ascii	"i\256jfO\231\231\003\263R\222\3148\372\020\206\tl\357+\026\301"
+	.ascii	"P\017fH5lX7\254\255\256\337z\235rq\356\255\357\344\264\223\253"
+	.ascii	"\312\334\241\007"
+	.string	"\tR\237\035s\363\374f7rql\252\237\371\243s\367~\032\177k\221\261\203\223\332urM\277\323\350\352\2109\"\376\367O\337\001\221a\t\363Cf\366\320\201I@\377\254_\232B(g\0161\302{\351\357\304\367\274\023\366_\334w\372\251\313\235/7\344\357\376w2\003r\367\341@\365\017\234\347\263\364\343\336\343z\240\260/\337\262<,/\224\027\013\017w\036\016l\337\367\253\321\272\253\326;\2577\275dnL\004\337\367\305\352\343Fc\356:-\364\305*B\031\363E\314L\242\347\224h\337\367\205\300\035\247\345\230\340~k\225O\240\360^\266\312\215bm\265\377\355\215\017\232\334\034\230\037\372;\371\221\235\276/\205\271u\3562:;h\235\033\264\316\f\210\316\013\212\316\\\254\363V\353\254\340\350\234\240u\326j\235\263\210\316XEg\004\254\363\201\326\331\200\321\271@\353L\240u\036@t\026Pt\016\300:_\265\316"
+	.ascii	"\214\316VF\347\252\326\031\211\344L\325:O\021\235\245Z\347\250"
+	.ascii	"\2423\024\353\374Ttvb\235\233Zg\246\326y\251uV\":'\0359\037\213"
+	.ascii	"\316F\326\031\211\350|\324:\027\215\234\215Zg\"\321\271eY\347"
+	.ascii	"\265\r{x\324\376 \335\271i\203\374\276c\017\316f\315\035\362"
+	.ascii	"\216;x\036\232\364\216I\270\231\273\273\243\262\225\nP\314\021"
+	.ascii	"\001\361\250[\326:\235\227q\2050\021\327\314lm\225J\316\212 "
+	.ascii	"\232\034\237f\257\342Z7\336\030\350\3247\036{\36099\274)\177"
+	.ascii	"\322\301\277<\001\273\361\230\204{\351\202\267\345Q/\245E\352"
+	.ascii	"\215\037<\013\226\250\357\002\324{z\250o\267r\241\371Dx\025\f"
+	.ascii	"\024\336\236\276\371\232\336\211J\211\266\255\351\031\354\375"
+	.ascii	"=\347\364t\223\351\326\357\271\246P\320\350\235n\3235\342S\334"
+	.ascii	"\246S\315\016a!\246\357<\366\340jinh9\250\363\230\0369\304\360"
+	.ascii	"NXr\355<\356\340hI',]\037a!\277\356<&\341LJ\030\227\344u\001"
+	.ascii	"-}a\177g\006\021\227\376,\211dK\322\313A\335\311U\351\227>5$"
+	.ascii	"C\013\363C?\2224\242\364\354\230\235\302.?~\222\022\227\t3\351"
+	.ascii	"\233\\'>\304}\322hV\270\020\f]|<\310\361\033M\333\034\322\033"
+	.ascii	"\277\335(\276,\321:\020\244?6\373\n\347\332\300\267-/\376\221"
+	.ascii	"\323]\363^\362\325\230\223\035\375\023\340\031\230\037\326p1"
+	.ascii	"\267\255e\007\3630\327-u\253\270W\326+k\253\305?6\351<\365X\243"
+	.ascii	"g\277\341\350\372\034p\242\026\227\213\367\322\210\200\267\317"
+	.ascii	"\354>]0\336K\342_\211\375\027s\033\366\"\031\334o\354\312\271"
+	.ascii	"b\274\227\256\230W\367\336\370'J\"\331\020\021\235|\317\263\365"
+	.ascii	"\331\177?\037\213\300*4\341\205\336\203\300\001\fc\207\213\026"
+	.ascii	"34\270\300\241\002D\213\034*,\350p1#I\007\215\031\317,\266n\324"
+	.ascii	"x\301E#\006\327\214\030*dp\261\260q\203k\253\211i\324pa\203\013"
+	.ascii	"\007\r\0326\270\212\r\366a\334uR\252\350\226\327\322\365\035"
+	.ascii	"e\017\237\345\261D\273:|\225"
+	.string	"\177\3633\335Q&\361T\276-\212\234\002]\233J\324\016\372~\315m\266S\034<K\226\346)\365\257\3466\255>\r\016\320\016\251\214\213]T\003(O\030|\003'M\030<[g\367\344\372\005J\026l=\227\224O\302\312\277G\242\004\354\274V\247|S\351\347\001\2377\362G\224\200\002)\005\tZ[\335\372\336k\323;\036\036\036\016*\370\252=%\241g*\r=\221\004\177\034\254+\234[\237K\260@\035%l\321\362\244\365A\276,\353\265\036\310\377\310z\266.\212\340\261~\f\353\300#p\341>\354\277\036LyHY\250L\244L\264\266z\340\217H\242N\357db'W\003\213\f\r<[W\246\311\013 r\233ma\201g\311\312<\231|\320mZ\031\202\263\363G(i\3056\250\0305$,\304TF\315\241%\002\202I\253@\336\354\001O\340\325:\200\376\fx6\252\250p\256\202\007x\001\317\254<t\277"
+	.string	"\005<\361\354\352\003\274\003b/\377\273\340\347{\334\2601\327\207\217\265\325\253G\342\242\210\250\246\315\232\322;\271\341:\271\002\370\206\363<I<"
+	.ascii	"\236\215\036*\234\253:\242\206\226d\325\3476\333:V\257\016\306"
+	.ascii	"9\276\263Y\254r\334&2\316\222\2767Kc\325\033\267\331\362U\305"
+	.ascii	"]\221\202&\027\201\206\250q0&\225S3#\"\222\244$Ic\321\005\204"
+	.ascii	"(\305\330\231\007\021\300(\306$B3c\n\222\244\320\030\326h=h\274"
+	.ascii	"\307\334\005"
+	.string	"6*\025\323\022\323\"{.\367\3242\306\204\344\377\342\254Rt\373a\3151?t\364J\366\307@\032\204 \215\220\2009\200\243\340\213\003x+\260q\331M<\252h\227\t\333\327l\341\023\304L\242\246\352\205)\t\266T\215\320\216\177\245\261\230\370\260\r\001\316\217\241\021m\2611\020\025\024\377\203\312\365\363!N\275\341\n\370\350\024\350\320\341\337\323\327t\217\324J\273\177\005\323\323\364\355\206e\230\323^\207P\273\037\r\220X\214\004\272\3514WDy.M#\371\213\335f\246t\"\324\264\337\210\013\334\"\006\026\271\3443\267\f\300:\251\035Z\003\267\344s\222\r\256\351\242kKo\202\224E\344\006\272\204\2552|6\t\365\261\177p*H\361;\316dib[\260\001>r,)\331c#\307\023\230\345\224S\345\236\214\271G\237*e\f\272\366\233|\263(\314\237u\354\341\227}O\350\205\257\265\266\207\246y\373-r\350"
+	.ascii	"J\270\013\312T\242\220\212"
+	.ascii	"5\031\027\307\337}\227&0Vf\277\3107/\005\233\370\f\376\b\252"
+	.ascii	"\310\337\b\333\03140]\024\317I\311\231SK\336\365\257\225\213"
+	.ascii	"w\214\363\353\203\237B2\237\235\276D\360l\320\030\203\2017\272"
+	.ascii	"\333\202\251V:\016\303k<\217\214%\301<N\214G\336(\317\322\f\317"
+	.ascii	"\016\033\367/\006\227C\206bS\346\327\022!\004)R\311\257\024?"
+	.ascii	"\250\203pY\027'\213\310N/e\"e|\204\340`/9R\220\245\353\255\304"
+	.ascii	"\365o\013\275\006\207\305zm\207mT\223\343\340K\0202\255f\177"
+	.ascii	"\277\247\007\323i\330{\207\3325\002\242P\001x\206\277\267\371"
+	.ascii	"\345\240\220\301\201\271\201\363\020\001R\023\306\371\203\325"
+	.ascii	"#t\255\274\244 \241\252\001^\240Z\346\370\212\263\250\266\212"
+	.ascii	"\337\242\262\365\311\233@\007AvsY\256\0321\216 \004OC\224\246"
+	.ascii	"\251\360\340\231E\204\353\r\370\rF\317Cq(\302g\376\217\254\255"
+	.ascii	"\n\331\277\214K&W\226\341\2560HS^\366K\030\027&\b\262I\026\264"
+	.ascii	"\307\245_r\342\312\237\244_4\006\210\2003\364\303\243\212\344"
+	.ascii	"\333\253<L=jd\340\314\031720\206.\210\327W\333\223\345\322Z\233"
+	.ascii	"\325\266\365\026B\240\330\f\307\023\316\273\245.\344\270\374"
+	.ascii	"\023qrB\212\307\243A\350\222\024\216\343\203'\300Y\203C\306\222"
+	.ascii	"\272R\23417\301\3575\n\332\273\223\275$\202\226\206\226j\240"
+	.ascii	"\2252\2030\334\2046/UP@\271P\263\275\231y\370\204NK\220X\374"
+	.ascii	"\245\001"
+	.text
+	.section	.gnu.lto_gpsInitHardware.part.0.151.eb51553ef5eb4835,"e",@progbits
+	.string	"(\265/\375`\257\001U\017"
+	.string	"VZ^D\020\217(\035\033\301\221\257#@\371\031\037\370\343\261\212h\366\265Y\030zsu\005\240\342!/\226!\370\255\355\365Gm\236\031\202c\264\250\020\300\002\200\n\240\362\017\300y\025\001\264\360\311\361z\377-\331D\312\224\002I"
+	.string	"N"
+	.string	"H"
+	.ascii	"\"\273\323\371;\b\333\"\024\217\354\230G\326\376D\253\304e\266"
+	.ascii	"\273\360O7|tM\363\215\374\273\016 \245"
+	.string	"\"]\343\250.\\\265\001,\031\027\035\225I\2031\324I\206\352\224I\340O\343\331]o0\334\333m;\260\335\300N\005\001\326-\235\032\004pf\367\244\233Y\r\017\306\301Ed\021\217\311\004\245\231\200\221\261\314\366\024\027\264\\\304\210E\022D\226\005\215\207\224\027\031f\273\021\3769\376\300\366\267y\201\355\357\366=\362\227\267X\212\037\342\221\344/k\212\025\037v\227$}W\233>haqJ\031\013\350\272\256{hKU\335TL\232\352,\211\361\350\317KL\330\354.\003\177\304I|\370\255?s!\371\324\237\037\242\217\317\326\252\203\212\353U\312\356%S\253\361g\017)a\244\256\254\357\332\352\212\275e\226\300\261\021\002\361\200\334\007R\370D\370\200\034\240\020\3340`\016\244\003\004+p\034\bvl\347\265\325\025C\350d%5\301\342j\24080-Xf\033\357\272G\313H?vx\344SV%\241\210\331\260\026%"
+	.string	"L\205\354\245\227\230\211\352\312~(1 p\002\2314e\036GA\257Ex\274lq/\322\306\250\005]\003\\\301ad\001\003\233\313\321iv\333(d"
+	.ascii	"\0010]M\352 \"\f\222\"\b\211\243=\302\b\037\317\357\241\305\301"
+	.ascii	"\017Q5 \036\027\243='\n\303\234p\027\n\332P\350\0377\377\326"
+	.ascii	"U\272\340\357\023\257\271\212\030;^\356\241\2562\375\326\254"
+	.ascii	"\020\224\027\337\371\333\332\023\302\030"
+	.text
+	.section	.gnu.lto_gpsNewData.part.0.153.eb51553ef5eb4835,"e",@progbits
+	.string	"(\265/\375`\322\001\305\017"
+	.string	"v\334dF\360\262&\035\260\254CF\257\372\223p\034%\177c\234\225\364\265\335\335\312\026@\f\243\347\322.\310\\\351[;\266\246\256\203+\213\224\353T\275\203<A#q\362\"\024.\347\033Z7\202\357U\251\034\246%{\023)S\nO"
+	.string	"P"
+	.string	"O"
+	.string	"\207_a;\345aw9\253\354\036\207\305\354\366zm\260\t\262\273\334\241\242\270\352\021j\232\233\312_=\2028L\357s\271\006\340s\271j\013^l|\020}-M\304\307\304\216\307\236\034>V&\201o\233\311\356\032\024\342\006\335v\005\333\t\354\204\020\nr\364\314\320\264\344,\325e\335\256\255\236\260aZ\265tj\351\007\030y0b\267\303l\310\302\300\235\327kn\237E\312\2179T\223:\214\205\204\004\203Ck\332\247y\013\325a,\206\273083va\r\016\215"
+	.string	"t(\340\"\3610_ \036\206\002''\361P\025\336\374\314\210\030\220$7E\233\002J\336s\366|\262\226\256\234\232##G\224v\212J\336K=pc&c\351\312W\273t\034\223(&\206\362\360|\330\027\016\303\004\332]\007\376\213\333t\276\314\2413\240\362\336\241\217\212\207\327\307\036\244\233T\202ZQ\341\272\022\207\241\204b\342H'\024Wb\300\335J\312\211\323\320u'.d;o\322\242\2548\222v\004\t*\024\252\213\306y6\034<\251\003\304\247\204\246\256Q\254\001o~\202\374\320?\205\367\"Su\331\037EU\013.t\264R\210}\235\357\214|\031O\b, \220\202\031Jv0\022\230"
+	.string	"\211\002IW\360\326\252s\347\276\f\253qE+\020m>\334\311\337\215\254,\217_\020Fy\221\305-\313\211"
+	.ascii	"\303\346V0\216\316\372\216\f!\222B\242\312 O\031\231k.\3305\""
+	.ascii	"ZK\030\253_V\270_\245P\234R\200&\371\3067R;\227;wA\370\202\206"
+	.ascii	"\237\320\361"
+	.text
+	.section	.gnu.lto_.symbol_nodes.eb51553ef5eb4835,"e",@progbits
+	.string	"(\265/\375`\253\007\265\036"
+	.string	"\226\360\260>P\252\315p\244\023\013\246PSe\216\243\345a\273\302\201\032\344c~\031\210\203VT;.Tm\330-\246U\341\252eRW]GVW\310V\bB9E\317\320Q\363\334\360\233\330\233\310-S\243"
+	.string	"\237"
+	.string	"\236"
+	.ascii	"&\24350\320\270qF/X)\243*\306\033\2310.8@\323T\335\241(\212\276"
+	.ascii	"\350\245R2\352b\325\026\013\205\305\246+\026}\360\244\212gJq"
+	.ascii	"L(~\311x\251\nz\242\337V\232\b\372(\230'\226\370\033\022\377"
+	.ascii	"3\342~D|O\210\353\001\361@\037\316\307\303\373\354\034\034\226"
+	.string	"2\253~\241\262\303\311\301\302\206\n\032\204\031\2500L]\370\240\252\013r`\341\222*\034\220y\2420\212\352\307\251\303\231\374\257\212JA\231%[\244Ae\316>\222\207\246)Z\366\367\177\347\312F\350s\006-\330\307S\376\0070\026}EN\372\214\232\364\0271\351\327-\351WR\322\237K\322\207\204\244\377\350H_\316H?QW?nQ\024\375\033p\365\022w\253,\002$r8\346\257d\253\213\313\307p\310\343\230\377U\327\025VW\026W\326\026\216!\221\337W\365\322\372\231\220\347\tr7\363D \1773\177\364\017\225Tdur>\372\204\314\326@\350\033\352qK\246/\354\313\334\260\257\306\243\317V)\253o\207\223\311d\022\253_gG?\255LQ6U\177\304\002\351\350\323)\257\244L4G\257\226\022Go\226\362\306\315ld\b\274uwt~\274\307\335\364L\217\224\247\t\274j\0232\216\217\005\310\361\361"
+	.string	"\225\300\272\007\254\230\231\3623\037;\251\b\326]\037'(\356\366\212\033\241\213\0370\035\353\020\271\001\324\332\306\264\212\313+\333\202\346h>\336Zw\201\030\263\261\257>\346\251p\236\230\207\334\035\272>\361\206Y\261t\227\210)\315{|\204\3138\344\250\225\356\356+\322\332{\374ch\3541\003\244\202\342\215=\336:n\t\210\310e\013\360W\257W\224\336(^\275_j\237\016J?R\332\237\264\304>\245E\373\216\272\217\350I\317#d^q\227\254Nn\355nB\306\262\372\233\260\016L\022\3557\305\034\202S\254\240H\367\265\223\023\024\327\223\311\020\201\235\355d\003N\004\326\257'7\035W\300\027YX\324\211\347d^\272\313\310\354J\330\357\3445\006O&\264\3108\347m'\363\304\n\364\202\274F\250\035\3436\346mB\024o\352\305\007\305V\313W\203\3425R`\003\353J\210k\023\347\204\334"
+	.ascii	"t]\334<\r(u"
+	.string	"\204#\363:@nZ\327\254;S\3634 7\251v\200\314[\221+\220W\375\035 c\375x\213\273\233\363\343\200\224\250A\020\312rJfH\222\024\n\303\001\340\002\261\231q\016\021\260\230\364\bQ$\"\"\"\222\344\001b\310\311G&\031\315\236a\331\271\3042X0}\354\310\341\256\341\371\332=-\207\224C`\236\357\300\302;\346\231}\231\225\204)ie\177u\2770\314\231\023O\b\207.\245r\227\"Q\002\267@r\2643V\321x\243\2111\022\252\\\326\200o\2748\004\b\273z\276q)D\037\353#\334\032\315\205e\372\240\006M\315Y\365\265\252\324\243\252\240(\235\341\b\ny\332\364\310|j<3=\332\374y\307\"\032d}\354\033\201yP \b\234\223j=\364\322;\n\345\331\331\200\b\261\347\276\005\270\023\360\203,\275\223\324\026\346f\177\250*r\177\353\323\023\036\204^\345\210T]S\\\214\232\r,\030"
+	.ascii	"\261xN\032\217kh\231L\022n\360\f\004L\245)\004< \223\017\225"
+	.ascii	"\315\003b\200N_\007\2503\213\324\361\001\340\342\b6\2317\334"
+	.ascii	"\f\275\227%Z\250U"
+	.text
+	.section	.gnu.lto_.refs.eb51553ef5eb4835,"e",@progbits
+	.string	"(\265/\375`\325\004\r\034"
+	.string	"\312F\260\013G\340\320\250\320\0010\314\241;$+\310\034\314$\317\320\276\004\333\013t\315P\206\030{\341k\222\017\244\030\2040\306\030c\2141\306\030c\310G\200\037\3423\343\365\246\254G\374\362\255\035_V^\227;\320\275-\371$\226\310\024\244"
+	.string	"\244"
+	.string	"\256"
+	.ascii	"0Uw\251\276\005v\226\250g\330W\341\207\252\016\242\372\024\330"
+	.ascii	"?\302\216Ru\017\220\336\001v\016\260\233\300\376\201}\224\352"
+	.ascii	"\005\377\210aq\\\337\205\020\251\317\242\364\253 \375)P\375\023"
+	.ascii	"\250?\310\364\003y\364\177Ft\364}zN}\036\021\034\375\020;9\246"
+	.ascii	">N\367{(\365;x}@\3675^\247\351>\306\353\267\356a\274\376\322"
+	.ascii	"\275\313\327[\276_\031u\224\356k\335\323\276^\362\375\310\250"
+	.ascii	"\303\272ou\237\244\036\362\365\360{\325\327S\337\177\214\036"
+	.ascii	"\345\365S\367\034^7u_\362:\251{\221\350\313]\333{@\001\217#\376"
+	.ascii	"72\331\333\210_#\3534\"\267\214\254\337d\377\"\276M\326YDn\224"
+	.ascii	"\330\237\304zM\374Q\374\231\370$\342\313b]\024\377%~K|\226\370"
+	.ascii	"!\261\036\212\017\">(>J\374\016\361O\261nr}I\354\337\353=X\357"
+	.ascii	"^]\344j\353\241\037r\221\372\205DD\376\025)Np\177\211\360'\301"
+	.ascii	"\352\003\261z\262/\"\377\020\251\376\216\352\327\001\301\376"
+	.ascii	"\315*\244\317\241\3535!/ \3543\341\313\250\372M\365/`\267\205"
+	.ascii	"\364\226T_Y\365\224\325\237\204\275\026\276\211\252\323T?\003"
+	.ascii	";\311\252\313\302.\206\037\331\305\354\260\354\257\354\255|\326"
+	.ascii	"\3709\373U>\310\370)\332{\214s\314\276\224\357\34577\221\271"
+	.ascii	"#\373)\273){)\3737\376\210\366\335\354\271\274\204t\207\204`"
+	.ascii	"_\026+\304\336\024&^\337\240\237\021>=< vtrp>\334x\275\036d\337"
+	.ascii	"\r\337WC\354\233A\244\027\203\310\367\002\367\265P\201\202\370"
+	.ascii	"\235\300\352\225\300\372F \371B\200\365>\200}\035\220\3646x\365"
+	.ascii	"2p\365.p}\025\240z\023\240\276\b:z\017x\364\032\020\271[\340"
+	.ascii	"\324K\340\206\215\221\277\006\215\031#}\031C.Z\240\b\"\361#\353"
+	.ascii	"\373\210\334\363| \276\276\316w\327p6\\\215\033 \232\343\306"
+	.ascii	"m\032\277\223\351\236\201\3517\357m0\235$\366\365\327\367.\257"
+	.ascii	"\267\262\263\262\252Z\007\363O\371\245\361E\343/,\227\336\332"
+	.ascii	"\266\336\361\026\226n\222}\314>\313^2\366\327\354\254}8{\220"
+	.ascii	"\374T\366\017R\366Qv/{\307\342\026u%\274\244\322I*}\244\362]"
+	.ascii	"v.{\363\224Q\200~\f\030C/\204Z\244\n\024&Pj\3513\376<';\231\223"
+	.ascii	"7\035\306\267\001\3605\3714\3713\331c\362o\331a\262\273d\267"
+	.ascii	"eg\251\275J\366\224\354(\331O\262\327\3067\241=m\366%\371#\331"
+	.ascii	"e\001S\250\221XF\004F\232\030\221\310\024\024\264\240\r\320\""
+	.ascii	"\242\031\352\001\020\330\223a7\351\b\002)\225\006\214M\354La"
+	.ascii	"G\022[\263\341\202/\242`^F\210r\205<\303p\233\270\243\032(D\005"
+	.ascii	"V\247\376\253\035X>\317\005m\361\363]\262\246\371\373&\262,\320"
+	.ascii	"\366\035\273'a\312\362\342\211?\200\214\246\300b\261y\024?\317"
+	.ascii	"R\3434\202\374\267\254BV\220\326\275.\336JD\220S\r\365\360\234"
+	.ascii	"h\374x\274\204\256\200eP\037\025\273,\235*\001\232\202\"\252"
+	.text
+	.section	.gnu.lto_.decls.eb51553ef5eb4835,"e",@progbits
+	.ascii	"(\265/\375`T^m\217\001\332\247z\222V NI9\351\256\212\211\251"
+	.ascii	"\246R\273\25287W\030?\260!\252\207*|\247\232\247\271\333\375"
+	.ascii	"\251u\025w\247\320\333\341B{\271\367\211\320\222_\177\324>\314"
+	.ascii	"n;\213\002%\260\364;\016a\272^9\246\331\345\231\366\016\211\332"
+	.ascii	"\275\\\364\251(\345\207\210v\223M\366\226;\005\265\007\036\t"
+	.ascii	"q\t;m\216c\3364\330\333(\370\026\t.\201\016\335[\035\370\326"
+	.ascii	"\006\246\231\016\335\246bf\r\316\217\266\267U\370\275\344/\""
+	.ascii	"\213\202d\314\255\255\335Z\206n\322k\255\326i\315\326R\372\255"
+	.ascii	"\2354\224\236\322g\375\244\321:\n=6\334\337@:H\2226\"_cs=\244"
+	.ascii	"\221\\\032\354\357\027E\266\2005\214#oI8\372\245,\2313\262h\214"
+	.ascii	"-\331/bh)\033[\203\241D\206\027p\0356&'\226\005\314\b\026\260"
+	.ascii	"\234s\021\\\233Q:f}\204k&P\300rF\202\240^,\252\214u`o\245\360"
+	.ascii	"+\036~\275\303\257j\360\341\302\340c\241C\367u\016\277\306\341"
+	.ascii	"\3277\374\272\004\277\002\301\2574\360\353\n\374\306\303\357"
+	.ascii	"8\370I:t\337i\360\357\350\320\005\201\n\335\267\030\\\271\350"
+	.ascii	"\320\035\201\n\335\366\321l\354\224\030i\373\216\303\247ph\240"
+	.ascii	"\371\033G{\365\215\316\321]\335\243\271ZG\357\240\307\254nQD"
+	.ascii	"\277\230\351\2625C\022N\2148`9#a\314\240u\224n-\205\2614\rCK"
+	.ascii	"M\262\306\231d"
+	.string	"\316\371\"\374\375\302\306\230\234d\303\340\3212(\235\022Zd:\345f\354.\231sn\254\2523U8\330w\023\374&\303\3570\374\376\201\337\\\370-\003\277\253\360)\036\326@\205\356\006v\270\271\350\320\355\200\n\335\276\362\331\nC\022\245\355\351\030\274\202b\241[JX\221i\276#\333J\316q!\253\261\202\322\235pCF#\271\202~\241u%\264\310t\352\216lF\262U4\213\266\352\252\246\242\307^\361S8*e\005\035\323S%\264\310\275$\231\215d\316\031\304N\233-\262\270\036\373\3232\224\n\255\322R\315\005t\243\256N\252mG\021\355\230\215i2\243\355)\034>\235SC%\302\233\261:]\222+~\232\327\306N\321O\264Ng\212\327P\364\330N?\265\243pn\2219CYi'j\206\246\241t>L \253\272\322f\212\226\375Eo'zG\351P\272\265\024\310\254\300r\316\247k\330P7J\247\365"
+	.string	"2\025`9#O\302_\364\207@B;Q7\324\255\204\250\234\217K\266$\360\005\217\315\354.g$\b\020 \210@\200"
+	.string	"\001\002\0045\262\3019m\2604\016\225C\217\267B\347\374\270b\374\321\366\264\007>\221s\316\364V\256y+\3674\007>\035\035\272=T\350\236\332\300\247Z\370\264\005>]\201\211\350\320=\215\302\247FLg\240g\350\021\003\212&\003Q6>\236\262\332\036\005fA\316\024\203K\363\362(\006\367EL\311\024\235\226\271u\342P\255\265\005\242B\367J\230\202\241a\350\361\003\025s\352\205vy\017\n\231\325rF\002\365\352\332\330Xk{#|\372\341\002\345\345\345\345\321\017\367%\300\226\n\335\207"
+	.string	"o@\207\3563\200?\320\241K\263P-\364\350\001\225;\215\243W^:!32g$P\007\301\203\222\326\366(\340S\017n\315\313\243\036\3343"
+	.string	"k\240C\267\251\320\005\201\016\335\236L\207.E\206\200{\350Z\024\352\204>\241n&\310\031*\347|A/\216\032\025\025m)\033\225\201\036\001@\333\220@>u\306\352\314i{\020\370\024"
+	.string	"\227\346Q"
+	.string	"\\\n\245\3504\212\320\305\322B\346\265\2343\020P\0272&um\373\n\025\272\357"
+	.string	"\017!\351\320m,T\350\376\264\t"
+	.string	"\200\2201\254t\264\375\251Z\232O\r']g\332\236\036i\332O\231\3202\212V\247\252\270\362Z\316\310 \n \2511C[\212\244g\247h\324\354!\220\360jD\313\307\2343E\033\201+g'\212\006D'g' J9\240\224\003\273\304\353+\312\265\027"
+	.string	">\222\016]L\205.\017Z&\341\215e\274\255\223`\210]\314]\250&\321\177\201\332K\245\245\005\001\317\212\370;\00486\304_\261l\002\376~c\021\020U\251\354\007\026\304O\307j\224=\300_[`? 9BuP,\365\351o\rj\212\337&\317\302_z\271\030\023\226\203&\363w\031\273\301\333Z\203\376\322\301_6\371\253\225\277\215,\260\002\370\253\226\277\312\3756"
+	.string	"\177\357T\002X"
+	.string	"\320\273\2775\370\320\177W\250\345\n\354\234\277\257\254\007\033D\225P\030\376\273]\316j\360\367\213>r4\017b \376\022\211\366\361N\207\326\237\336\237\342\237\232<?=\361S\240\277\273"
+	.ascii	"\260\301OS\360\323\017?}\361\323\024X\370\251\t?\345\300Oc\370"
+	.ascii	"\351\210\237\222\340\247\276\237\242\370\251\021\305\201\202"
+	.ascii	"\340OU\b\351\n~j\342\247*\240,x\3613\003\240a]\340/9\370\357"
+	.ascii	"\241\223^\376\327\001?\325\372\251\213\237VQ\025?]\361\323\026"
+	.ascii	"?e\321M\236\326_\r\204r\321\034\024\356\247m?\225B\331\376\256"
+	.ascii	"\262"
+	.string	"\031P\267\237\276\375\237\363w\334o1\370+\n\376:\374-\321O\233t\222\b\376\033\340\036\246\024\355\005o\353\341\t\277\025\363[\016\377\317\356\301\321.\246\324\240\305\032\005\177\017\177\273\341o\021?k\2436\256\0066\350\257jV\303\223\030\372\006\205\361\367\f\013\364\323\2601\373C\215TZ\243\374\225\355\267>\177\275\266\347\3570\313\363W7\273\343A-+\207\032\364\337\204\377\022\340o5\265[D\002\336\363\337\232\254\310\277\236\375\266Gm\250\351\3627\235\305?=b\313\377\036\316\363\227i\177\237\2519j\327o\355\337&\370\033\004=\305\246G\360\267Q\273i1\266\376\365\205\355\277\372\370\033\006K\177\032\366S\262\237\362\370)\222\277\246\300\376\247I~z\344\257K~z\226\367S#?UB\307\236j\035\017\334\205\377\036\376{\360W<*\347\021\370\357\005\177\217\360w\321\337!\374M\302_\037\360w\002\004\360\367"
+	.string	"\376\367\376\233\202\277\222\370\353\371\327\243\277\376\376\352\373\253\321_\221\376fc\367\327\f\374\265\004\177\035\301\233\377@\377\225\3627\336\337\030\370\233\205\277\351\374}\200\277/\360\377\376%\336\337o\376\323\277D\363\267\230\277\272\371k\233\263\277\252\371k\232\277\232\371k\231\237\322\375t\313O\273\374\224\313\337a\376*\346\257a\376J\367\327.\3777\374e\333\337(\336\177Y\200\277\316\375U\356\257q\177}\373+\333_\237\374\265\311_\317\376J\366\327\037\177\355\372\353\214\277\312\370+\214\277f\375\265\352\257R\177\315\177U\301_a\370\353\360\257\301\277*\375\365\004\177M\372+\004\376\232\200\277\202\370\253\007\177\355\340\257"
+	.ascii	"\370k\207\277\006\375\325\347\257\364o5\177{\371+\317_{\1775"
+	.ascii	"\377\332\177\327\371[\316\337v\177\263\371;\371\367\231\277\315"
+	.ascii	"\374]\367\367\227\277\347\376\326\362\367\225\277\247\374\375"
+	.ascii	"\366\267\f\177C\371{\370w\223\277\323\376>\373\333\354o&\177"
+	.ascii	"\223\375=\366w\222\277\217\374-\366\367\327\337B\376\006\362"
+	.ascii	"\267\217\277y\374\255\343\357\256\277\271\376\276\361\367\326"
+	.ascii	"\3374\376\216\361\367\213\277[\374\215\365\267\325O\345\374\235"
+	.ascii	"\301\337S\177\033\375-\365w\324\337)\376~\372\333\3707\013\376"
+	.ascii	"^\301\337(~j\367w\357o\030\376\213\371\273\370\367\013\377\317"
+	.ascii	"\376\267\375\255\301\337\300\277\223\376F\372\273\304\337\347"
+	.ascii	"\337G\177"
+	.string	"s\340\357\023\376\236\300\337\017\370[\001\177o\360w"
+	.ascii	"\376\006\300\337\036~Z\367\3230?\235\362S'?E\373\351\361\247"
+	.ascii	"]?\315\361S\034?\245\361\323\031\377G\374\224\005\377\325\376"
+	.ascii	"\247\375G\373?\365_\356?Q^^^\336\337\223\364\377\270\360\247"
+	.ascii	"0\025%\025M\213##\313\315\317\216\226\261d\315\221\266\024\213"
+	.ascii	"k\253\252-\222J\232\r\271\266e\212*#k\235i\373\237\031\270|R"
+	.ascii	"\202E\bX\333\377\\\341\277t*\215Y\222,\326\264-\263\205\222\302"
+	.ascii	"\355J\333\377d\374\333<\213w\247E\214\212\266s\346X\274\021\250"
+	.ascii	"\254\240C\217\026\257$\233\202\224\341\366\277Wz\331\235yk{\237"
+	.ascii	"\031\360o\343\034m\234\212f\202\017d6\3224+*\273\273\214\245"
+	.ascii	"\365\201\375\302\242\n\217\266\367\341bg\341\374\330Q\275\271"
+	.ascii	"\322\366>P\260\035\032\333\306\272\251N4\344/\271\247C\214I2"
+	.ascii	"c"
+	.string	"a}p\0374|\233\306\252\271M\336&-\033\232s\316Z\331\270\006\004\261/*\273\273\254\205\365\341\267kn\331\324\033Mw\006\217\013\332\377^\247\331\022\347\325\366>a\370\247\357\377f'\254\234s\213\022\231\261\236z\356OOKJ?\374>\264\322\001\374\267\365o\200\0222?\305\351\3109S7X\354\315\251\306\006\271\244\313\031\252\313hBW\326\224ZWV\320\024T\227\214)\265\256\254\240)\265\256l\204\"b\f\302\312]\306)\265\234\203r\3169CA\031S\340\312\232Rs\312ASj9+\247\370\222E3\262\313\230\241\270rP\206\312NY\215+k\203)\250\256\254)5\247\254\240)\265\256\254\254\326\2255d(',\025P\031+(\253u\255\311j\\Y\032\246\324\270\262\246\324\272\226\320\037*\314\270qaEG\217\037T\312\024Tfa\265\345\204\245\201n\n\311\225\311\344L\327\2422V\246\313y"
+	.ascii	"9oqa\221q\222A\341\236\350X<\311\340\304E\2219g\f\254\236\274"
+	.ascii	"\2702\024\235\221f\272)#\\9\033yJ\312V9\347<\202\021I\227\177"
+	.ascii	"P:\243\216\255\\\025\225s\006\031\231\263U\316F\232\351r\316"
+	.ascii	"\306\234\263\211\265\205\314\231\206\206)0+\253\234\265\210\254"
+	.ascii	"\362\226QJT\316\275f\006.kJ\315\213\253H\212\0235\260,\2054\322"
+	.ascii	"\251*\256\f\226\311taa5\343Y\256\3129\3236\030,\313\005\233\266"
+	.ascii	"\367\201\2623\3648\305p\363\322\366=s\360o\315\3248e\250[\203"
+	.ascii	"\231\253z\"\3435&\316Z\311B\263\246\216\210\23004\330\3308k\013"
+	.ascii	"\346f\301J\216i\373\0362\370\277\245\263]\354\234\335b\275X."
+	.ascii	"\364h\277X-_*\035\213\245\236a\341\267'.\311%rf\300\372H\245"
+	.ascii	"\214\375b\263\314%\253\217*d\300rF\332/\326\n\331\232:\270\273"
+	.ascii	"\234\221Dup\326\262\374\330\367(\301\357\331\201\337\243e\257"
+	.ascii	"P\265'?\346\264}\217\021\333\270g\037\236\035pkNm\317\243\006"
+	.ascii	"\237g\016\237\307\t\376\355\024+\245\203\320I\253a\245\374V\315"
+	.ascii	"6\261p\315\245\203,\305\233\266o\034\240is\326\366<K\360Eh\253"
+	.ascii	"wVH\2127\031\254\033=\3326\373\304\266\3315\313\366cDf\243\271"
+	.ascii	"\003\013\225\035\3163\202\261\335(\267l\277uB\255\364l\330\370"
+	.ascii	"\362\324\326B)\272\215R\311dI\201\321\266\244B\367<a\370<<\360"
+	.ascii	"\245B\267\322\321\241\373\2004\013\004\355L\204&i\240\314n\317"
+	.ascii	"~\213\354\343\231\035Q\272\264\335)+\2725\343\201z\021\205H\333"
+	.ascii	"\036\023{\354\325Y\261\335\030\273=\376v\211%\243n&`\303\003"
+	.ascii	"\216\fmy\264\350\320\245bT\350Z%E\267c>V\220\344H\266\245a6\211"
+	.ascii	"\0215T`j\264\275\bC,\230\n\260.\273\003L\325\021\033f\305,\022"
+	.ascii	"z\264Fl\221.?\254\220z\206\205\243<\255(\263F,"
+	.string	"\017\353\243\305\bE\300\330\324\271\313\031Y\257\274\370\002\266c\317C\203\210\375\3622\302e\243\355y\252\210\360<\001\261A\360\220&[\234\334\001Q\203m\017$#P\320\332~\247\013\376N\025\253\243\f\223\345\211\225\266\337qb\275v\230\340\337\346\260\\\226\013G\026J\006\314\306\226\033uG\231\246e\211\223\215-\037*E\332`m\275\306\016Y\034\0218miT\030M\324\334\332~\007\f\303XC\353~z9w\345u\231\201\252\314L\325\2202V`]\332\320\251dl\n\273\342*\355*9\345\246\302\241tk)\304\2619\326\261/l\f+\303jY+[e]\330\0316\313\302\260-,\225\275\262,\350\321bY\247\333'\013u\2422\213U\351,\271K\342Y\243\207\247\251\025\264\322\234Y\361\002\253\242\251jJ\210\302\352Q\201Q\221\204c\261\352]\235\363\003\205\314Y;WYaqw9#\357\223[\332\221"
+	.ascii	"X\253\"\254\352H\326\366=9\370\364h\247\254Ti\205\315\350\243"
+	.ascii	"\355o\243n\245\236\246'{\250s@\304\324\332\376\r\335\362\277"
+	.ascii	"g\315\304\264x\264}O\r\266\357}\301\2775\332|\327\316\316\230"
+	.ascii	"A\332\2601o_}\254y\265\0162\023\33520>\264\264}O\n~/\n~\317,"
+	.ascii	"N\225\003\004\307\312M\235\2218_\370M\265\3531\322\342\212H\333"
+	.ascii	"\367r\274\351\315\300\357a\341\367\236\360\261\035>F\203\377"
+	.ascii	"\252&M\t\366\205\206\206\016\250\247\016\031\230\034m\217\303"
+	.ascii	"\340\343+\3708\n>f\202\217\301\360\221c\352\332mL\tY\333\377"
+	.ascii	"\257uu\315\205\225\241\256\0308\25091a\222\274\210B\246\212\225"
+	.ascii	"\032W\301\364\360d/j2\332~\201\363\306\205N\333\343.\274\245"
+	.ascii	"f)!\n\253\267\302\013J\222\313\217QC~\002c\006\306\245j)\363"
+	.ascii	"R\347*]\355B\217\225K\225#B\346\f\305\245^\251Y(\235\0262\267"
+	.ascii	"\330\361Z\243\262k+mxVv\354\361\r|\214\205\217W\340\277f\301"
+	.ascii	"B\366\202\207\020\3441\347\f\324\2232\347\b\214\266\307Q\330"
+	.ascii	"D\322\241\373;*t\251\227\242\327*V\207\335U\030\225\266\036\230"
+	.ascii	")\037om\337\307(t\013\245\363a\202\030\2205!3\210\341\250m}F"
+	.ascii	"\314GQm\253P\304\202H\251nuJ\225\241\276U8z\254m\225\255\254"
+	.ascii	"\266\325\234\215kF\020\373AeW\212\305`#\363co\336\341\233j\360"
+	.ascii	"\3152\370\246\034\376\353\023'^Xev\264\255N~J\246\211\364\310"
+	.ascii	"e\0013\247mU+zm\222\227G\345"
+	.string	"G\333\2374\264\037%2\254\254\231\275\242\375\025Y\317(\232\217\223&Na\332R\037t\350\016Q\241[\313\212^\315p\2358\026?\332r\250L\310z\322\310\231\343\324VG\355Q\317\2600\033\230.\307\272\244\"\251I\252\222j\244\212\325#u\214\036+Y-\362~Q\303\252\217\037\\\300\334\300\204\310\005\241u\365\f\013?I\333\222$\253@\346\222]\276\336\340\f\311\002FV\211\320:,D@[X\326\314\340`\333\224\202oF\3017\317\360\315#\370\346\016|3\006\276i\205oJ\341\3378\370kt\350V\0368\306\332\361H\333\3371u\307-\032\227Ou\2121\367\326\366W\013\376\253\327\2078uOJ\272r\374\230\031\303\3225\307\251\233\t.\250-dH;\302u\303$\213\363Zk[ot\265Qq\274\336\250[\017\201\204\367@\325\0336g'J9\370\241\224\203\322\312\020\247\264k\177\253\340\277\326\360"
+	.ascii	"\212\n\333\261\355_iT\0316\212\026\272\037m/\202\323\030\030"
+	.ascii	"\324W\214\n\243\316\250/\252V"
+	.string	"uA\217UF\305z\315\252-B \241\312\250\231\272U$\230\371\304\213,y\345o\030F\272\345\307IC\206zZ\002&\243>)\2512j\212zU\317\260."
+	.string	"\206\210\305\"'\223\375X\212\244C\227\210\n\335_4\314\302(\fNZ\333_#\370\264\254VU\025tKE\302a\2514 \325\252\256\250T\364X\253\352\224\024\245\363\003\245!Cy\371"
+	.ascii	"\3139\327\252\032\225\235\262F8\202\305\246\316\335\316\020\034"
+	.ascii	"8\306`\373[\003\377Z\341_\025\3707\005\3765\342\227n\360K2\370"
+	.ascii	"\245\034~\031\207_\276\341\277\363\032\017?\261\211\222k\333"
+	.ascii	"x=\246\341P\2725\313\344\013\354\256\3434\235\236\323r\272\016"
+	.ascii	"=6^\343\265\213\376\261$\331x-\244\253\224\320\"\367\2240\031"
+	.ascii	"K6^\307u\030J\267\226\001&J\300\032\217Ni\254\022Z\344\036\030"
+	.ascii	"\023\262\306\243k\364\215\322i\345\2345\002\223#\225\335]\316"
+	.ascii	"\031\004\006@\316\254\200\361c\333\016\303\310\342F\246\355K"
+	.ascii	"$>-C\343\303\214\215$\031\034en$s\316ih\234\251\001\226\246g"
+	.ascii	"\330\002\3139\277\3516\315\246\335\264\232N\366\032z\3544\177"
+	.ascii	"\213\351:\250\016R\245\005\021\r\366%\021\374R\007~Y\003\277"
+	.ascii	"\234\302\267s\360\355\030|K\207)\035\035\272\036\250\320m0D\346"
+	.ascii	"\027\232\030s\332\336J\301\247V\262|\365\22512\"Er\364\213\020"
+	.ascii	"\271!`X\344\272\210\022\271\326\262dK{\351\271\376\322t\315\245"
+	.ascii	"\273\320c\313\375\r\243\255\310\220s\006\001\202(L\322\314$\241"
+	.ascii	"\210Ae\265\275\006aiif\023\243\2342%u\211\212:\034j7\233\370"
+	.ascii	"\274iBW\246\001\020&L\3143\212\226\2578\230\255\t\213#\343\326"
+	.ascii	"\304\007\362\346\231\017\\\f n\246Y\017\322\230\323\230ffY\217"
+	.ascii	"\315\231\031\240~\236j\200\365h{\rX\004\271\371\025\304$\253"
+	.ascii	"u=\331\210\226\257\3147\271$\\\356\362\224\326\007\2363\2523"
+	.ascii	"/Hn\222\335\\\022\002\tG\243\004I\235S[s\354?ZsS\222mo&1\225"
+	.ascii	"\374\275\035\261\035jI\332>\0035\370\t\300h1\262\262\332\232"
+	.ascii	"G\216\246\215\240\251Z\323\3264r+=Zc\356z\230b\\\274\300<\265"
+	.ascii	"5\301\314\"\364x93\354H\240\237)RP\344\332>\0032\370\364r\267"
+	.ascii	"\005\364r\327\034r\223\310\337\353M\271\261\243\253\3553\240"
+	.ascii	"\303\277)\344\357\231Q\352j\200\265}\006r\370\031T1u\230:\314"
+	.ascii	"\037D\\F6#P\311\252\203\363\001\002\203\210\324\216\233?L\037"
+	.ascii	"p\250\244\324\231>\314\036[d\240\022\003fG\235,jL\036V\213\006"
+	.ascii	"h\246\332\354]O\233\027'mf5j\230]D\\\3065\017\260\"\245\016\356"
+	.ascii	"\256\f\327\026\243\231\343f\327\355\242B\306|\271\322\326\344"
+	.ascii	"\262X\244\306\222X\2655q\330;3fmB\332\2327\354\n\353\004%5\327"
+	.ascii	"\326\264A\353\200\2167\246dikn\3259t\016\\\235\212\n\307\311"
+	.ascii	"\0171e`3f\2300\210\270j\231')FV8\265}\006Q\246\fSF\351\205\210"
+	.ascii	"\253\252\241\362\265%\346K\034\235,.\\\2300\262\344\224\361\330"
+	.ascii	"\255h3\365\342&\214\2031\253#\343\306\202\205\231E\321\362\025"
+	.ascii	"\004\326\204\305)\261p\274\024\301\272\231\3654X\314\035\035"
+	.ascii	"\025m\315\253\333\025\244\212\f1\f\320L\025\246\n\263J\212\361"
+	.ascii	"\226y\302\001gR\335\254\372\301\212\201\214\322\326\\\321\303"
+	.ascii	"\366$\357\013\022\323\311t2\245\210\270\214k@\310\222U\007w\333"
+	.ascii	"\334\210\201\231O7\245\314\250\036\031x\320\241\321\326L\301"
+	.ascii	"\203&\210\224\035m\217A\020lBa \243N\0353S\264|\305\201\254\260"
+	.ascii	"\270\236\034,\342\352\362n\346^\217:\253*\fR\304\211s\351\334"
+	.ascii	"'Tz\030\261=\34401\323\366\322\271s\342\314\340\302k{\345\034"
+	.ascii	"\355xR\245\355\211\274\340\023iq\343\346\302\241h\371\212\310"
+	.ascii	"L\212\326\207\036,R\220mv\277p\314$\025(\307\266\327|\343\242"
+	.ascii	"\345L\335\377\336\345rEGN\333\023\255\341\377\277\311'/\033\""
+	.ascii	"\256*\306\313KKI\316Z\037L/^\224\340\255\371e\263\200\030W\330"
+	.ascii	"\264\375\233\232\345\177\017(\311\034\252\272\266'\272J\223\206"
+	.ascii	"\326\231\260\226\235\262>X\351\312;\006\r\241K\322\366\027p\301"
+	.ascii	"\377=s\317\324\033\034\314\272\352\320(\202\303\232j\373\013"
+	.ascii	"\212\340\377\232\271f\312(\013\245!C\2011\203\313XZ\037\374\324"
+	.ascii	"\214\251j\373\013\272\314~\241\334(\227\215\036\257\331%S"
+	.string	"\247\264r\213\006HU\355L]Q\021\246\355\030\252\031lkm\177\001\f|Z&\303m#\003\303\315\226\361\3604e\201c\027)\227\n\245\363a\002\222-/\254\3349J\247\245!C\271\235Iz\271o\266\314\2171(g\035\\\300\300\334\272+\346~\271t7\f=^/\267\312o\224\313v\345z\271p\307\271$O\335\233/\272\037+\303\321xx\232\262@\231\231;w\343\356\026\236\26608pw\227\313\355B\217wn\r\003\2379e\356\312\256\375\357\226+\007\267\242\206T\333\253\205\252\311Q\351h\373\016a\360\177\261\320\343\315\002$\025\206G\244\355\275r4V\205q\005U\333\277\271\025\030R\310\346\332\276\203\027\374\016r\370\035\334\360\235\202\305$m\254\341wP\303\357`\206\337!\t~\2070\374\3376[\246T\323\342\206K\333w \202\033I\207\356\007*t\257\223\273\006\264\004\216\007[\333\337'\377{\032"
+	.ascii	"\322\205\255\255m\322r_`Vm\177\325~\310\020\201r\326\3667\215"
+	.ascii	"-\317\315\214\266\027\rGu\340\362`\307\206\033\216\032\027\371"
+	.ascii	"\213\366_\260{F\321b\310\303\203\323\366d\350\320\245vE\277H"
+	.ascii	".qI\263\266\357`u\277~\217\367\3532\261gH\027;cXl}\300S\027g"
+	.ascii	"\n\030\362\370$\205\325\366*\271K.\331\337\353Q\251\002\263\325"
+	.ascii	"\366\035R\340\337\261\377\275\035\037_\206\034i\333\364V\356"
+	.ascii	"E\362\233\344\357\231G,((m\337!\343_#\367\310\337\253x[\250\250"
+	.ascii	"h\373\241;\374+\366\277\327\202\031r\214\265\275a8j\250\214\007"
+	.ascii	"=3hh\202\024\371\r\373\253Z\203Q\264\256\252\241\245\246\355"
+	.ascii	"\005+\372-\322_krrm}\250\320\375\320\233\020!w\b\224\262N\310"
+	.ascii	"\224\255!\307\037?.\020\023\326R \323\002\326+\223\322\306\004"
+	.ascii	"H\020\374_\036\227\307\355a\241\2209\253\207\214\313\016\024"
+	.ascii	"/\"k\332\336\036C2p\340\270:F\330\240\262S2\244\212\307\225\327"
+	.ascii	"\257\216\035\0365\214\307\266\177s\273\376\367ztvvk]7G\305\302"
+	.ascii	"B.\b\215L\203\255J\226\313e\235zn\354\2401\246\355\207\234\264"
+	.ascii	"\264\256\r\"&f\267\211\327\021\253\255_\033\030\214\016$Qmo\215"
+	.ascii	"\037\261.C\256\332^\032\364\215,N\216\266w\206-\343\302\005\327"
+	.ascii	"W\231\377\275\212v|c\326\366\034\326\340\377\272\2700n\fZ\207"
+	.ascii	"\215X\230m\b\033\207:\374\342\305\315\032\002\205\n>\007'\370"
+	.ascii	"^\335\253\233\205s\233\226*\225&\203\271X\277Y?G+\3118m\377\306"
+	.ascii	"\236\371\337\363Y\001r\327\366\034\216\330\312\252\024\303\371"
+	.ascii	"\213\013\217\227\361\315\255\3559\200\341Ku\251J/8?\211\342\266"
+	.ascii	"%\207\245\3559\370\270*\256\n\352Fm\360\240\251\003u\246\355"
+	.ascii	"9\330\270P7\352B]\251+uS<\205\225\352\314\2253\230\371\344\353"
+	.ascii	"+\311\241\005>\207|\363u\272\371\032\257\261M\310Q\021<\255\266"
+	.ascii	"\027J\342\013e"
+	.string	"\301t\350\261\244S\326\331\200\245\201&\\\222\031\353\305\007%\036\020\222\254\250*\246\230\254%t\332^\350\r\277\274\243\245\234c)\247\274\253S\271"
+	.ascii	"lTvJ\204\314py\327BF<\020\2015\267\242|\363c\003\214\316\215"
+	.ascii	"\266n\216\245\233\322\216'\315L\371\246\347\211\232\\vu\025\204"
+	.ascii	"\253\355\205\200\260aSF\231\260\226\235\212\f\240GUG]\025\331"
+	.ascii	"j{\241\031i\312d\0325j\330\246v\322\270\370\262\321\366BU\370"
+	.ascii	"\033\356\360_\2369c\267\210\220\271\005O\032\331\206$\376K2'"
+	.ascii	"S\2321a\215+\267x@\021)[\037\3305\032Rp\3122\324\t2\255J[$\007"
+	.ascii	"\255$,\332~C\035=\226a\312:\013 \263\021\350\251\355\305\007"
+	.ascii	"\245\230\035(b\3077\244\2130\253\024m\277AK\227\362K\227\322"
+	.ascii	"\313\315\231\"\271\256\260\262\026\326\007:\272\322\0136\346"
+	.ascii	"lD\346+\n\005\207\326\207\316\021\245fl\353\345\213\021\"Q\332"
+	.ascii	"~\203\033\376\0062\374\227[\346\250\233\315Z\017\020+\003\023"
+	.ascii	"\202\277\241F\026-(\300\304\3146\260\300\017\312\303\177Y\305"
+	.ascii	"\266)\255\224W4\030\2732\235AFl,\231\261\362\007e\334\317\233"
+	.ascii	":3"
+	.string	"A\332>h\r~P\031\374\240.R\246P7\232\243r\f`beI+\370AP\334\336\344\320\360\203\306\330d\240n\033\324\234o\230\301\205\341\007\375\300/\235\320r\255M\t\205\272Y\020\304\216A^\370A5\360)u\273M\232\320:\213\314Y7\255FY\366e\205\234\266\017\242\302\364X\246\225Pw\214\n4RL\346\332>\350\351\354\214n\371`\002Y\03406\370/\315\350\2614\243[>d'\247\016\310\356\250\354\356\2760aB\335\210\036@f\006l\013\031\031u\243\310|\345\2002TvJ\342\306\306\350\274%IRo\334|\"I\206&\211v\344H\032\r\307\"EJ1\263-e\330K1\037+3\220\324\320\020\004\277\034B\313/z,\277h\035\305\302N\322\266\222\031\013\313\007=\243\2061J\333kp\201Oi\335\375K!B\202\340\031Yd`\265\275\006( @\200\260\260\243E\2135>|\374"
+	.ascii	"\212\321f\215U\333\003y\301\177\311\343X\362\2509L\360\241!C"
+	.ascii	"\201\361\001\226\261\264>\360i\021\304\307\220):tP7kD\346\253"
+	.ascii	"\353\205\003\313\007u\206%<\360\332\036h\255\253\253\336\240"
+	.ascii	"\310|\005\201\025TvJ\230pq\345\001}\335\270A\335L\320\3422\262"
+	.ascii	"\331\200\254\210\234\262\273\234\261|Pv\331\301\031k{ \250\255"
+	.ascii	"\255z\203(\033\327\200@6g\016\376K\255\323c\251U\322\260P\310"
+	.ascii	"l\334\001C\343G\206\023\335X\333r\206\371V\006\f\223\266\377"
+	.ascii	")\203\377\363\005\377e\214c\031\243\361,\200\314\306\036&L\250"
+	.ascii	"\354\356~\264\340\277|q,_P7\242ld\263\001\231\232)\370t\214\226"
+	.ascii	"-\216e\013\232F\204\314-\3144\026\310\017\376sV^\225W%\026\223"
+	.ascii	",\177\363\022\253WD\314\253\252\355\177\212\340rE\271\242\264"
+	.ascii	"b\323A\2218e\325K+Zw\313\274\306\364h\033\275b\t`\022\361\347"
+	.ascii	"\364\021\231\220v\212\347\b\"\023\022\017R\020XL\"\002\203\300"
+	.ascii	"\n\b]\030\n+P\004\376`(\300y$d\301\347\350\267\203"
+	.string	"\024\004\026\201?\020\020\317\"\212\023Nt\240\307DQdZ\242\300\tE\340\0221\370\033\272@\004j\360\244\020\"\316\243&%\243 P\304\220\330$\242\203\222RS0(\f\232E\337\031\003\220xa\020\016\223\212\302\240Y\342w*\331\342I\\:\227\356Q\020X\202\303\210\340\311$\374yR\210\337\251\204\3029l*\376\316\022=O\n\201\0044\361\013\252\020\024\366\024\317\021\304\241\220\030<\211;g\0218\004A1\b\034\266\300s\372v\230\232^\020\n\225\204T8\227\200\305\f\212>\"\013D\240\222\022p\351\236P<G\004=)DP\b$\016O\023A\241\221\217\310\204$\"(\\Z\022\032\021\200x\236C\244\363\310',\372\216\206B\241\221oD\013*pxR\210\f\270\260\302\b\021\305\023i\370+n\360\202\221P\t\205s(D\001\350I!\216\200L\"\212IH@\245\022DGg\361g\002X4\232"
+	.ascii	"\361\007\202\363H\2704\004\376\204P0\tQ\370)>)\004S\223p\210"
+	.ascii	"\344\033\236\305SD\007F\301\246\n\360\004KtI\364!1\365\024}A"
+	.ascii	"$\2462\210\304T\317\030\200DK$\236\303\243\243\237\211\202Ih"
+	.ascii	"d\207E\246z\037\024\303\"\021\210tv\300\267\341\350\f\"\001\225"
+	.ascii	"~\346\321Il\262'\321\374\257\370;*\236\304s\350Cb\n\361S\374"
+	.ascii	")1-\235.\024O\342\331\001$&\f|JB#aQ8d\362\235 \321\264\201H\242"
+	.ascii	"I\003\261\b$\341\023\"\361\013R\200\310\204\304\301\247ag(,\376"
+	.ascii	"\214\200G\301\025\210L*l(!\304\271\004t!\005\nd`D\013*\364x\200"
+	.ascii	"\310\204"
+	.string	"\324\3431\317\342\357\210\251\3117\242\005\025vv\212\277\024\202\200\316\341\017\206\243\341\317\002\035z'\200%\316a\013@\257f=\356pI\034\331)\002\203+\364\226\316\"\021\305\b\r='\204J$< T\034\n[ 2!\231\304\336\257\370K\201\007\204\020\305\341\217)\304\357\\\322\300\206\037\020B\370\226\232\210/\030\235IF\032z\212B,5i\300\004\361\247h\206\020\002\211\310BO\204\020\347\322oX\302GdB\342\271$\204@Q\004\016\177L\370* D\361$\226(!\304\345\002B,\375\206?&\323\034\236\305`\223\320HCR\021)x*\371\216~B%\024?&\037\020\211\237\357\005#_I$\376\224\214|\227\311\307\004|\201\350\353a:\213D_\251\241\030l\022\242p$,\021\\\341\002ap\303\021\320\004\021(8\242\005\025~|#ZP\241\267\003\303\031\364\371<)\204Q\260i(\302\250\204"
+	.string	"vN\234A\\\274$|\346\021\320\207D\\\362\231\303_\022\n\032\210LH\276\2238\3741\371B\260\201\f\234\340\001 \342\221\322\t,\341#\361\033\"\361\024\213\303s\251\211\030\024\242\360\223\204\324$\034&\025\211\304_\013\247\322Q\360g\001\"\023\022\007$a\006\212\347\013F\277\026\210LH=\247\257\002\034\356\004(\300\202\006\316\245\337\260\0020\234\032 2!\001\335\b8<\203'\022\376\b\nH\200\002J8a\276\204\006\200\320"
+	.string	"\020\356Kh@QQ\003\024P\204\257\200\242:B\b\244 pX$\342\242\217\350\201\342\006!\360\002\024\303\342\271t*\235\305\0136\274@\374\261\020\024\002\213F\301\246\022=\247o\205\016L\304%\"\023R\220\357\204\220\304\013F?%\022\035\212&\321G\374\221\030qB\250D\242\211\207HdB\3429}-\020\231\220|\206\347\021\320\204p\310\204O\337\316y$d\201\370#A\304\247\017\b\tX\"(DAXl\372\355\234\276\t\020\231\220|\216\232~'\b\213M?\\|R\b\021\304\341i\0028<\3620,\266p\232"
+	.string	"\236Fg\007\210^0\372\221PR\372\241pb\270C\364\365|\2408\024\266\240\364\003\016O\242\206S\211\304\317\005\023wx\002K"
+	.ascii	"\213\301\363\b\270s\372\316#!\013\305\241\220i\347<\022.\331"
+	.ascii	"\323\267\201\342P\310\344C\f\n\201E&\241y\026\177\0358j\372\221"
+	.ascii	"\300g\f\300\021g\f\300\021\270\210\207=G\277\323\002J\300\237"
+	.ascii	"\013\303\263D\211\246\023N\024{\212"
+	.ascii	"/\024\227j\021\030\\\201\310\204\344s\342<\n\002\313\023$\232"
+	.ascii	"*\321\367;\2274\340"
+	.string	"\203K#\237\017\221\t\251G\034\n\207\303\363\022\213M\302s\tX\304J<E\342/\003E\342O\t\350\207X\364\341\263\370+\022\313\023\347Qp\205\263\370\033\0365\375H\370\234>\026\210LHAg\361W\034q\"\375\210\304s\251GI(<\301W\022}\277\342/\205\021D&\244\240\342\223\212J\277J\374\031\t3@dB\362)\376\224jP\250T\223\224\224\252oD\013*\364\034\235'\323\b\236\2238l\022\242p\024l\022\016\221z\230\204GI\266\370\033\261\324\024\274F\300\342\3604\021\204\024\024*\365~J\370\b($2\001\225\224\316\rJ\304%\337y\324T\004\026\225~=J\277bP\030\003p(L\022JRR\"\n\231\356\271\004,25]\245\037\260\030<\207g\211\022\300#\241\023\300\022\276\"q\b,\341\023\026\203\256\206\020\210\347\320\032\235\304\240\357\\\002\026{/\234'\f\366dBQ\364\235"
+	.string	"\226\300\304\246\342\257H\364\235"
+	.string	"\226\3309\201\342\036\211\340\343p\002\005\212\"\320H\250t\232\360\305\340+q\032\235@-l \005_P\b,\002\211B\246\036\3429\254\304\263\bTR:\213?\342NP\b,6)\t\211XCRq(\f\366\212\304\337\031\204Ax\344;:\203\370H\004|\024\202\017)\b<\372\235I;(\214~\303&#\243\237\357\350<\231\210?GgP\3514q\177|>\023\277\240\357\004\211\246\016\347p!\3239\024Q\024\n\207\"xL\342\331\201!S\031L2\252G@\023DKD\372)\225(Q\024\201J\277&\024\230\302\240Q5q*\235\326\\\002\306\360\263Jg0\370K22\213\276\020D8\227\200E\233\204\302RS\260$\"\375\224*\240\364#!TB\342)\372\024PT\f\002\233p\bG\247\211\341I<\207=a\211 \320\004\361\026}%\024\203\300&\223x\026Q\220(\207\277$#{\0060"
+	.ascii	"\205"
+	.string	"\r<\240\001\025\260Q\b\"\023\222\b!PD\020\370[\022a4$\212\b!\364\362\315\013*\234\306\200\325\371\321\322#\255\315Wyg\272\265Q\241A$\353\315\215$<\360\220\322\256\n\216\212\272\026bV\225\225a\362\242-\222Gk\252\255\f\210)\2653glI\336\0173c\247\2542\036^\367\302=\276\301)\347\247\234o\330\370P$\311\246\316]\326z\201{`\036Eb\204\221\303\003\357(\363\244\310\222\224)\232\210\23185X\207-\322\213\221\244.J\333{`\303?\356\272pj\030\224V\212\034\245\231\033?R\324q\231q=SM\266\274p\230rn7\302z\334\270:vv\244\331\002f\243\304:\201M\325\216\336\242[\256\214\024s\330j\224V>Xm\270\224\320(\2574\227\230,i3\330\\\301\002\207e`\031\245\027\232\261r\326\312u\214\r*;%\036\216\030\303h\374\002\3078\206q$\206!"
+	.string	":@\224r"
+	.ascii	"D\203\rK\330ua\331\364\322\2309\306iA\3530\224"
+	.string	"4tTYf\0232\\;\2520VI\343\315U2M\333\247$\035\030,\330v\264\360\210\314Y]\251*1\236\271\272d\224\246z\013\241\016\314j\205y\206\343Xy\021GE\351\005\312\f\037^mqTmA^^^\036\235\234\235pT\343),u\034u \223\214\222)\247\233\302\354\352@K\230(\250\262n\347\230\345\302\356\t\206U;\023\007\317\311\374\361\363\344\316l\0066\322\221{;\222\244\355\217\263I\366Cg\226\227WB\301%\371\022\323\326\2743\357L<\263\307\022\223\316M\274-)\260\25096\216@q\212c\312\3519j,T\264\275\207\"\330\214\343a\007\376M8e\324\f#\225\037\246\035\223$\222%3\336\270\321B\306!\262\346\246\233\337dc\266\261\306\"W\216m[\213\016]\002\240)\272\271\306l\262f.'\325\330\27085\320\316\334T\363\233h\3144\367\215\354\350\242mc\321\241;"
+	.ascii	"*tM0E7\317\224f\314\264\0013\203i\206\f\r#nL27\315\374\265\314"
+	.ascii	",C\321\264\354\270\302"
+	.string	"\242-\345\242C\327\034St\223\f\233\034\336W[!\263\316\024SuF\206\024\346\227\233b~\023\214\031\206\242\231)\356\222ym{\212\016]\016\250\320\355\027E7\277\340\263-T\240\274\334\244k\301f\206H\227\233t\024\315\004\027\234\200z\312k[Tt\263\0135\233sv\245\355\334\334\325A\321\362\025\b\326\324\301a\032M\2728\311\303\202\305\224\243h\371J\002^\302\342\224\224?\242\214\301i\271)g\215)\346\360\332\232Yn\027\320\fV`3\346\264\270\002\267\306\224bJ1\343\344\214up>/\322\210\3700\255\334\214K\301\003y\243\255Y\345v}\371xK\2665\251\224D\346\324\340hkN)\235\240\3004\311R:\375P\231\353\032\353\322\326f\276\201@\263\224\023\2579I\273+#2L\267\233o\324\355E\0264\036U\240@1\331\210\270\214k>\230\031\303\342\356zV9\316h\230Qn\262\365\354"
+	.string	"#\304\313\354\311\377\304\204A\204s\206\221\250\363\001\264R<\252\305(\f\344\224c\206h\2106I:\323\025@@@D(\021\353\302l\037\023@\304J\255\224\261&fL1\231\021I\222\024\n\033k\254\200a\354\303\222\2076\313\330.<1FG\254\234\273+\202f\340\337\r\245\371\326\363\372\342\035\362es#\215\007\205(Q,\0377\016U8\204\233;\b\275\246\2112\006\260H{\350\223D\202Vy#f\342\367\007\210\347\221\032r\222\206z\202\274\f\340\231\326\341I\206-=\343\210O3-\325\305\225\211\376\177W0|\370\3403\204\301\216\021\322+A\303\244\313\356[\344\341\305\320?&`\310g d@k\005Q\261N\b2\207\276+\315\222Q5\362\030\275\350\035m\223P\244\375\307\204\346,(\325\024"
+	.string	"\037\177\\]\f\256 HY\311\360*\255\035\353\330\273\321\201\374:\207\311b\354D:\020\bo\007\250\f\342\315=e\021\254\246\211!\233\270\277\026a\213v)\212O\\M\200\245\212H\\\365\\~0|\316j\027>\021\225\347\335f\315\347\355\312\236\255~t$\206iX\"yn5`\b\223\021\276\017 \267x\240\032\277n\357x\006IR<\340\250\357\026\342\316i\214X\033\250\241\b\330_\t\t\331\3279>~xQ\235\270*\354G\270\205YB\251h\026%H\257\004E\r\325b|\025\236\312\373\020P\350\345\210\201\351d\307u\240\020(\211C%\237\341\224\377\324\016U*V\335\222seq\211\217\027\266\374O\343t\275o\237Z\025\311\200A=\337MF\373\375\001\363>D*S\200i\2122@\254F\3770r\270uy"
+	.string	"$\237\213v\357&\302"
+	.ascii	"_\345\016F\231\242R\217\275\232y\002\007{\277I\321\274\367\n"
+	.ascii	"c\365\3620\307\333\261\351jq\370e\334\323\024X\356\f\323\307"
+	.ascii	"\262\326\3461,|~e#\027\025\bH\355\2335v\004\204\006r\344\375"
+	.ascii	"O\340\217\323\362\"\024\034\006\227Li\247\334\370V:\f\031(/\n"
+	.ascii	" q\025H\326\260Y\361UV\243Y\023\256\370\236\275\347\265\244~"
+	.ascii	"\002j\320\326\336\024g+\036\023tc\203\2065\"q(\017oP\007\246"
+	.ascii	"&\300\206\271\354\201\026n\210\221mH\332\314\362EE9\215\250\020"
+	.ascii	"\233\r\246-\341\352\370\312:\331*\330"
+	.string	"\301\331\253}\376"
+	.ascii	"\360[\203&<\275/\fp\346&\273\345\302(\345\032\bN1\002p\241\177"
+	.ascii	"\rx\346\271\0335h\343\267\331\"w\033t\b$\236O)\233\307\317\371"
+	.ascii	"i\337,/j\361\321\347*\353-\271NP\225\272\276T\371T\273_n\242"
+	.ascii	"\252h\373\2003\261g\205\220\374_\247;o\300K\206\330\237<\266"
+	.ascii	"\275\361\033~\026\334\022FC>k\2643\032\343\327\262L\016\t\377"
+	.ascii	">\254d\332\220i\334b"
+	.string	"Ef\f\266\003\243f%k\330\002\2219\335_\200\205\217\274\311\245&\337/\327\271\t\261\205\021\274q\216\357\021\004;\233\216\351\\x\243`\231\353\234\\\004d\300\206x\201^e\314<V4hla%\252 \324\r\3044\202l\r%\271\035\023\027\266VB\303\211Xu^\252\277\360\203\022 1\030\354\360\301o5Qe\"\345/a\207\336\034\371\2656s\205\303\300\366>\246%s\333\314\301\246Zu\035\302\002\374\f\252\231a\304\304\314\021g\331\245\232A2~\307\350\303\001\3078\257\226\204\376\214\315\034\220}\331I\213\373\232\003\274\221g\237\270\021\232J\242\202Z-T\036\002 \300\265\311\377N\003x\345\027\030\273\362M\241\263Q\270{P\317\376\335s{&\311\031t\347\210\t\005\210\036\374g\314>\236\347Qv8\033,\"Jn\273i\223\017P\346h\340\333\"2\223l\316m}\376Nw&<>hJ\234\270"
+	.string	"\223\016$1\b\322@\314\333a\326\020\027-\342\275b 0YV\313vfdc\211e\212Z\356O\211\234\323\352\230\002\340\316\007n\257n\"\357\232\213\267\005\022\353%o\344\003\315Xb\031QE\246\325\261\270y\255\314\333\033HTvp\331\001e\373\333y\214"
+	.ascii	"\241\233\001e@&\362"
+	.string	"\264\261\034\022wDT\375v\013\331\242\201\230(\322C\036Z\376!\3661>KT\347Zi*\377iQ\261\342\376\022\027[\241\t\230\013\017\303\357\344\031\306\024\356\332\247BB]Xk\336>\252\001\235&\313\005<8\363\364*\331GS\247\332uF\266\226\3349\031\021\213QK\362\rNM\004\240\227~\200n\027\214\353(\034\251\357\234\200k\312\220\"v%G\026MY\254\034\2670.\261\366s\032\260\201\353]\016\n\221\236\264W\255O\334l\375\033i\030\365<\312\210\214\334\272$\347Y\025\221/\211\006\302\363\265\377\204\177\213\366\346\bl\255(0d\342\356\372\227\263?\274\377\232\275\257\302\270\037\"*\224\360\212B\261\221YX\252\232\021\232\007Ib#k\244\333\026BH\3128\303\244j4\235\025\3121\320\003\255$\377P\206\376\367\016-A\323\005\373\255\266\355u\r\232\356\357\317\201&+\353\306\031\376&\003-O"
+	.ascii	"S7\032z\345k\315\363^\n\236\0160\b\311\362\221\264\3225\303t"
+	.ascii	"*z\213\204N\367q;\217G\266\334z\361\236\005\372\\X\317\201\017"
+	.ascii	"\326\300\224\002\037\260i\270\363B/.\375s\331\357s1b\036/U2\020"
+	.ascii	"\255\303\353\240\374n\217\221\027\365QC\236\326\371.\342\215"
+	.ascii	"\031m\340})Y\026\250W"
+	.string	"i\f\252\375x\305\035\305\006\354<V\332\307\305H'=\373\234\305\034l\360/k\351\344\324\202\335E\f\300y\242\220K\360L \035\2200\265J{9\204\036J\374\222g\300#\225\to|\242\240S*\321{\201Jj\364O\f\237}T\243ru\300c\013\347[R\037\201\262I/\253b\027p\210\326\311y\304\027\247\251S)_\371\t\032\013\231\201\036Vz\344c\211\021\274 \214\334h\261Hu.\360\322\322\205\304\2107\324`\321H;\313\177\241\324\200\336\330\027D\206#.\374\372tiM;\326vf\307=\200&\177\\\314&\301\233 \321[=\027\t\330\335\315\016\016\2205\027\227\337\341\016j\244\211\b\261\252\034\251\253\215z\333\206\203\222\246\345_\241J\245\004]\2137y\363p\220\250\240H*O\226\027\b\364B\3634\332\272\025\320\306*/K|\301\"\310\030SI\305\037\236\376\312*\333f0\325bF\347"
+	.string	"\255\261\332,qf\364\325\235B\323\354\2353\036\377y\352\007\362d\222G\225\252\266T\026jO\007\244`\202\354#\247)<\242s\236:N\240\006S#\"\252\034\356\307\t~\016_aJ\007\272B\214!E\263\275\215\372\265\206L\305!\004\231N\324\320\027|\031\231(<\357b\262]\363$\332\t\311\007\312\341\n\241\300\204&\301\3232\252A\004\306"
+	.string	"\303\303\013\313\346\311\004\302\223VE\""
+	.ascii	"\253\316\201W\270\t\026\004P>\024\021!P\202\r\272\331\332m\270"
+	.ascii	"\232\"\364\275\003^V\016\252\317A\303#\347\352\252\310F`\326"
+	.ascii	"\262\177\0336\235\261%\227\336]\016\002Z\326\324\325Zlu\036\204"
+	.ascii	"\336\364P\255C\342Gb\267G\372\233\264\006\031\332\360X\313\252"
+	.ascii	"|\200\363\006\344\334\032\333\261\276\243+[\316D\307\345Mm\213"
+	.ascii	"@\1773d/\301p\346q\330\027\275/9\217\036\202\301\305{\353O,\204"
+	.ascii	"\b\357oU\030\002\374%\013\340\267E\313\273&<\262_\355 U\321\372"
+	.ascii	"\223suP\333\r\350a\317^ \327\276\354\241\f\216\217\r7\024\315"
+	.ascii	"\246\b)D\365\373\272\330\254\325\r\327\006\350VGN\236HVMP%\236"
+	.ascii	"\326T54Ql\325\351\223\364T\304o;@\323\033R\305\201\362\206\213"
+	.ascii	"\201\376\027m\315E\353c\264)\322\270\313\2303,`\023\215\001t"
+	.ascii	"w\232 \340\310J\022\323W\201\352\365\234\310!\245\306n\032b\371"
+	.ascii	"\177\343\215\226\326\374\266`v+AC,\20047\276B\332\231\224\007"
+	.ascii	"1\302\311\222F\034z\360c\f\030\0041L5\210y\371\216`8?\217\016"
+	.ascii	"W\253/y\336\001E\036\300\314\306\2759\036\256\265(\264X\374\241"
+	.ascii	"L\346\202\323\340H\252\240\255\230u\372\0136:\355i\216\013\201"
+	.ascii	"\0363\013Df`KnN\227\2755\211\225\311\355\312B\341\330\"\017P"
+	.ascii	"\341m{\370\2305@\203\345gs0-\210\362\032\035\022[\225\227\034"
+	.ascii	"\270\326p\221\027\237\333X\236\300\003i\376\237\327<\371_\021"
+	.ascii	"g\3064\264`\376&\016\313\214\375$\226\317\333\211\275\\^\213"
+	.ascii	"9L'q'"
+	.string	"B$\265_]\026\261\232\246`lY5].\263\210F0\003\333\202\272Q\355\\\253\r\355\207~\256\341\3061*Vz1\216\373\030S<\207\271\\\032\301(\351\344\340\267\240\246\364$\376\310\277\307\336X[\207\270m\200\017\364`\225\346/\263\332 \bg@\033\313\360\214*aO\nd \255\251AvE\302L\246\225]\226\215$\331:\212\213t\b\240#\025N\205\233T\212\305b$K+:\215}\033\b1\203\001 \035;\315\324\314:jd\3408\322K\201\246\037\317m\205)\325\315zq\327\347\317\006q71cv\257\262M\310\320\300\034\243\253\020*g\344r\337?\374\232*\337\267\023\334\202\005\357\245O\227\016TrJ\340\231\264\244\346\301jM\030\210\3308-\036\375\322|w\254\202\252f\234\001\230\221\221\023\362e\250mw?\016\024T\362\t\251.b\3772@=\003\224\205\226\304L`\004\200\335f\013U"
+	.string	"q\344\0267I\3712X$\206\326\266\214\200\255\375h\030\013ez\317i1\023\372y5\\j\t\272 \274\246\251o\20100\242\300\205\202u\352\006\320.q\001\022\200#1V;(\305I&\262s{Z\"s\232_\rYcq\206\0175\302Fe\244]\373m\026<B\231\263\370\022\213\367\""
+	.ascii	"G^&i\035\275+"
+	.string	"\305MuU\353\377\n\247\257\020\353\235t[\344\225\260<\036x3\271\322c\036\315^'\237j\372Q\261\224\034#\250.\320\201]\033\374\2340=\372\344\222\341\211\331h);\013\230\217\246\023\374_\301\235\037\230\t\3349\2535\270 \"[\276\350M\377\200\206r'\n)\250\033(\310h\260\030z\222}\324\341\2249=#(xw\0139\203\215`"
+	.string	"\255\233\323\204\220\364\302<\266\375\030\352\375\327Ft\301R\003\353@\354\301c\276r\271\177\347\275\311\277\302[\2425Q\225C\325\207i\306\033w`V\021\324\270[4\341\304\230.\252|\204J\2502>s\024\270\370Q\b\346\177\017\f\035\317\"`\261\300`A\330J:g\363\306\005\241"
+	.string	"\376\3418M\2519\250\206Os\036r\267\005\347\212\365M\036\205\f\243\327Z\2636\035\263d\210\215\332\031\016\312\331\350\024\377+\025\272>\030\2544\352\003C\023\0021W\264]\357oy\322\304\246\364\021T\215o"
+	.string	"\023?3\304\234\361\362G\370D\006\347\341\2553\204U\305\212a\022\r\007Y\350\023\202sU\255tr\357\256\241\305\262\350?\342\317\347\222\300\214b\032\206B\217\314h\301@A\235\216\345X\331\341\035~\t\fB%lY\275\215\340\227\226\377Dh}z\3647gwH\036\036>\310\352p!\200:\221\220k\221s!\200oFz@\004W"
+	.string	"+wA\267[\221\265d\374\216~\271.P\347M\356\344\313L\226\036*r\247\333[\363\364ZO\204\337\306\021T\334~\317\233\234\027\354\032\377\322\255\207\027\262\3418\3651\355\317\263Z\366"
+	.string	"\025O^\323\220\263O\251\371\312m\275\005\337Es\037\235\322p{_r\rnO\345\034M\213\177v\030\263\036\3322>c\377\214\377\217\260}18\223\253s\330~\020\234o\350B\327c\313\253\240\351\363\177\276)q\274\352\027\255\236!\354\346\334-S>\021c\306\345\311\205\313z\221E\203\3510z\356f\376\005\340\275\300\237\265H\230\370\006\377\205)_\245\237\3122e\230\013\024\323\322Y\360m\310\375\327X\240\375\211\371w\357\377\313\021;\231\3426\025\376\336\373+\241G.\371f\356\245\337\225\373\315\356\373o\363\t\035\367\321+\201\326N\331\233\326]\032uU\352LI'\025\341K\2517*\275\231\313\370\0340\377+\336AWqS\311\237\224\203\352"
+	.string	"\273\001>pY\371'\030K\332\313C\214\020h\266%\360\216\335\376\t^"
+	.ascii	"\341\242Gl\242\276o\345KL\372\307\377\260\376\377\261\314\343"
+	.ascii	"\313@\314\345\372.\001=\n\346S;\255\375\202\322\350\320\017\021"
+	.ascii	" \275^\326,\320\366a\002\272\325M\242.\374\274\342\230g\240?"
+	.ascii	"\213\371&\354u\"b.\220\365\366\316\264?\300\232\026\225|\023"
+	.ascii	"\360g\245\351\266\262\374\032\362\264\334\357\032\246q\335\346"
+	.ascii	"\035\221\345\231\313\377\213e@\321\317\200h\327\324=\234\240"
+	.ascii	"\301\300\226.8\222\351\204\374c+w\005"
+	.text
+	.section	.gnu.lto_.symtab.eb51553ef5eb4835,"e",@progbits
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\030"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\002"
+	.string	""
+	.string	"GPS_numCh"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\002"
+	.string	""
+	.string	"GPS_svinfo_chn"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\002"
+	.string	""
+	.string	"GPS_svinfo_svid"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\002"
+	.string	""
+	.string	"GPS_svinfo_quality"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"GPS_svinfo_cno"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\002"
+	.string	""
+	.string	"GPS_svInfoReceivedCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"gpsData"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	" "
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\002"
+	.string	""
+	.string	"gpsPacketLog"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\025"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\002"
+	.string	""
+	.string	"GPS_packetCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\002"
+	.string	""
+	.string	"gpsConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\002"
+	.string	""
+	.string	"GPS_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\003"
+	.string	""
+	.string	"gpsInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\003"
+	.string	""
+	.string	"gpsInitNmea"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\002"
+	.string	""
+	.string	"gpsInitUblox"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\002"
+	.string	""
+	.string	"gpsInitHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"gpsNewFrame"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\003"
+	.string	""
+	.string	"gpsUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\003"
+	.string	""
+	.string	"_update_checksum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\003"
+	.string	""
+	.string	"gpsEnablePassthrough"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\003"
+	.string	""
+	.string	"ubx_nav_status_bits"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\003"
+	.string	""
+	.string	"ubs_nav_fix_type"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\003"
+	.string	""
+	.string	"ubx_protocol_bytes"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\003"
+	.string	""
+	.string	"pgResetTemplate_gpsConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\003"
+	.string	""
+	.string	"gpsConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\003"
+	.string	""
+	.string	"gpsConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\003"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\003"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\003"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\002"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\002"
+	.string	""
+	.string	"GPS_coord_to_degrees"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\003"
+	.string	""
+	.string	"serialSetBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\003"
+	.string	""
+	.string	"serialGetBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\003"
+	.string	""
+	.string	"lookupBaudRateIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\003"
+	.string	""
+	.string	"serialPrint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\003"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\003"
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\003"
+	.string	""
+	.string	"onGpsNewData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\003"
+	.string	""
+	.string	"featureClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\003"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\003"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\003"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\003"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\003"
+	.string	""
+	.string	"sensorsClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\003"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\003"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\003"
+	.string	""
+	.string	"serialPassthrough"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\003"
+	.string	""
+	.string	"serialSetMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\003"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.eb51553ef5eb4835,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,502 @@
+	.file	"rcsplit.c"
+	.section	.gnu.lto_.profile.a54a8a037cba25a6,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a54a8a037cba25a6,"e",@progbits
+	.string	"(\265/\375 \235\215\003"
+	.string	"\204\005\221"
+	.string	"\t"
+	.string	"\305\333\260\346\002\026\002"
+	.string	"\002"
+	.string	"\002\001\002\003\002\003\001\002\001\001\352\263\360\321\b\002\372\347\212\324\013\b\002\004\002\004\002\005\002\006\003\004\240\342\234\212\n\005\333\201\305\216\017\004\002\004\006\251\207\337\333\001\006\002\007\002\b"
+	.string	"\002"
+	.string	"\007\225\312\372\256\r\002\b\240\342\234\212\n"
+	.string	"\t"
+	.ascii	"\256@\344p\225P\223@\335\313\216\214\231\205\333u!\227\325\006"
+	.ascii	"\260"
+	.text
+	.section	.gnu.lto_.ipa_sra.a54a8a037cba25a6,"e",@progbits
+	.string	"(\265/\375 5U\001"
+	.string	"\330)"
+	.string	"\005"
+	.string	"\001\001"
+	.string	"\001\002"
+	.string	""
+	.string	"\005"
+	.string	"\003"
+	.string	"\001\006"
+	.string	"\003"
+	.string	"\002\007\001\001"
+	.string	"\001"
+	.string	"\005"
+	.ascii	"A\205\330\031\t%\310K\030\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.a54a8a037cba25a6,"e",@progbits
+	.string	"(\265/\375`\031"
+	.string	"m\005"
+	.string	"\"\311\037)pe\013c"
+	.string	"\235\007\026\016\022KF\003\244?7{[r]\321\377\237n\247Z\250\252\002\372\217\335\222F\336A#QJ\231\002\377\023p\323|ld\300W\032Y[\217\006\001C!\034\220\227i2\235\320\341\352\377R\321\356f\225\335\305\246.]\353\360\261\220\216\334P"
+	.string	"<\305#=\246\b\006q>\276\326\351\217\005\376\363\334rw\267zN'\222\357\263\310\177\2208\216\234^H'K\202\232\032\261\021"
+	.string	",Cld\267JhH-"
+	.string	"\231\200\307\004\220*\260\251 \2007g\214?\230"
+	.ascii	"\003\257\263\032\206%\363T\241\t/\301\024\300\r"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a54a8a037cba25a6,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"u\005"
+	.string	"\022\311\032 \220)\351\237[\301z\377_\362H(\"xx\374w\2779\300@\311\253m\350\265\277mB\210L2\344\240\344+On\342RZ\241<\312\323^@:\343\312\326n\355\306\225L@\3626\3140;\256\212\\\005\311\035\221n\356\233\353\351r\255\031]\331\316\275s\375\ba\351\200\245\214~\334\\z\"\311\252 \256\240\311\013\224\245\347\342\207\033"
+	.string	"Z "
+	.string	"\216fZ\200u\343\032\206\201\353@nH\315\243\031\332Q\365v^3\252I\257\340\003\"b.\026x\330\317\3538\255\316i\322\251\004z\243\022\2131\202"
+	.ascii	"Km[\261\\\026\373\n0\004"
+	.text
+	.section	.gnu.lto_.pureconst.a54a8a037cba25a6,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\230\004\002\270\004\005\270\004\006\231\004\007\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a54a8a037cba25a6,"e",@progbits
+	.string	"(\265/\375 \221\235\002"
+	.string	"\024\003\205"
+	.string	"\005"
+	.string	"\001\002\022\001\002\002\002\023"
+	.string	"\001\002\023\001"
+	.string	"\002\024"
+	.string	"\001\002\025\001"
+	.string	""
+	.string	"\001\002"
+	.string	"\002"
+	.string	"\002\006\002\002\026"
+	.string	"\001\002\027\001"
+	.string	"\001"
+	.string	"\007\001\002"
+	.string	"\r"
+	.ascii	"t@\324*7\013ux\206y\212\200\232\004\261\032lK\331\224\020\230"
+	.ascii	"ww6\200\305\033\300\002"
+	.text
+	.section	.gnu.lto_.lto.a54a8a037cba25a6,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sendCtrlCommand.37.a54a8a037cba25a6,"e",@progbits
+	.string	"(\265/\375`\372\005-&"
+	.string	"\272D\024\017I\200\234Q:\331\247L\226*~\343\261\0015\003|\013O\355/\221k\362b\317-\006\204f\245\276\202:+6\342B\322b\303"
+	.string	";\336\253s\2523\f\323LN6?S9OyU\227\321b\277"
+	.string	"`\253\034\226\020B\210\334I\006\332"
+	.string	"\323"
+	.string	"\343"
+	.string	"\314\306G\361~\204\241^\247\017M6\226\367\n!\374d\n\352\317\007\347-\363\241<\n\357P18v/\221\013\353^\243\004v\240\376\264\275\007\375i~\007\375\311\314c^s\343\220\2336!\375\222q\356\275\267\026\242\252\252\016\2337\215\347\265y\007 [g:15EO\263-\217/\343"
+	.ascii	"\220\227\231)\r\034G\276%\354a\002}-\263\256\244aW\337\220\307"
+	.ascii	"gfzCH\346[B&\023\250\213\315\322\225>\253\023d\270\364\230J\034"
+	.ascii	"\356xj6\b\323\244\346[B%\323\207\251K\2165\351gQ\013k\272\210"
+	.ascii	"\303\245\237W\336l\242\246\2138\344q\363\2078\364\3616/4A\252"
+	.ascii	"\232%\3150W*p\224\034y\033L\352Y\233r\270\367\262\005&\r\317"
+	.ascii	"\001\316|\037f\036\301|\"\005|\025\350\317\367\221\027\220\334"
+	.ascii	"\241td\303\230\215=\333E\346\253U\264\210p\003a^\360s\254\263"
+	.ascii	"M\301\265\316\t\020\034\210Y6\020\263\354\203Z.\200Z\256\305"
+	.ascii	",\023\240\365\360\250\226w\006\274\352,;\324\037{\326\271U\313"
+	.ascii	"6\265|\006\350\2260\265\253{q\204\315\271`\316,$\327\372\263"
+	.ascii	"\376\252\037\353?\236O\345Y|\255+y\2352\205F*\2713\257R\006'"
+	.ascii	"i\214.\205o\365+\235\304\352\351\336\273b\261\005\f\274_\355"
+	.ascii	"\324\353\224N\241\366jW\323\300\305\203\372\263\212w*\335\257"
+	.ascii	"O\030\3735!-\317*\267bt*]#\201p2\263\374\311\035\214\352wP#\276"
+	.ascii	"\324\247\360:\205\206\203\372\223-`0zrg\353{\231\3228\335k\314"
+	.ascii	"\240\376\374\221\274\006\337\241\tZA\247>8>\246^\254\213\177"
+	.ascii	"\200\322\032A\247Z\2769=[\343\310d\251\032\350\003m\271~`C\250"
+	.ascii	"O\033\350\377t\024h\2376\261\374\300\"\274\326\005\372\2769="
+	.ascii	"\033\306\264\256u:5\365\003;rB\205\334J\273\310\037B\t\364\211"
+	.ascii	"\310.\264&\320\247\216\260\037\330QO\335\220\223\205\362\364"
+	.ascii	"N\367\364\271~:z\037\203bw\035\372s\247m2\270T\341\262\036\320"
+	.ascii	"W\276\201\024\033\337\222\036P\227\317\351\354\"\221\tUq\274"
+	.ascii	"l\203\261g,\3006\261\266Mb\207\226\037\330%\304\361\302\362\035"
+	.ascii	"\312\314\021\216\334\361\f\271\367\002\235QTO^0l\b\007W\244\344"
+	.ascii	"\b\217\322\236\0335&\f\363^\342\206\037\337II9\313\343\245\276"
+	.ascii	"@5\273@\337'\220gf\330/\346g\271\026\027\374\",\244\302\036\370"
+	.ascii	"3\314\226E\320\212\316\025\265h\241\343r\270\316\005\241@\241"
+	.ascii	";Q\242(gB\267\026\261\b\032\322\245\310\231P\0317\241HhE\213"
+	.ascii	"\027\270\334\215H\350\306B\310\304\320\r\227"
+	.string	"{q\233Pc\242\026A\271[\021\021Q\356\266\032\217\336@l\367\016`\345\351\356\340\227G\033\306\001\354\351\300\314\233\031\027d\017d+\245\005\214\257e\360\267\316\306<\243\224O^\335G\276A\324\225\034%\2319\243uj\004\312\374\231\363|\340\262\232\375\230\337\241\266\016^y\0216\274\314\0064\233\346\245\034\231\"\375a\365\004\224u\360\314m\235\273\231\333\372\207\301\2332>\246\r^_=\326.\362gflA\247F\274\234=M\353`\n\214)\350\376:\325\240\025\363\004\211f\206\3752\357\275W\247\213\034 \210\212\240W$7\322\003\275\240\203\314\017\013{\25018\205\224SD!\221\231`&lS8`\002\031\272\272m\020hX\233\244\003b\352~\236\241\r\251\354\304\370\360Mv`\026\\\270\314\b\r\2022\013\221;\315\213\236Ra$>O\335\0043S?\241\032_\0347-\\/\346P\255CE\204="
+	.string	"\005\300\323\240)\361=\360\324\204\002\361\217\233\261\234\275\365O\347\005\005\353\264\324H\201P|~\203\020\002<O\214\372\307"
+	.string	"\350`\310_\340>{\246\274a\206\201\306\234[\303\267x\274\241\275\376\0025"
+	.ascii	"i$\216\220\023\2626\n\220\005\020\275\033\334k\b\027\367\006"
+	.ascii	"\251\027\001\304\0279\264s\232\036\257\201\372`\324\335\022\036"
+	.ascii	"\031\352\r'x\337\202\264\254\362\260z\0316j\204\001\240M%x\017"
+	.ascii	"\305\255\235%\226\254F\b\344\372g+\3764\367]f0!\361L\365\026"
+	.ascii	"Sr\300!\316M\b^\017u\251\345\302\201\340\340\004\277\226\323"
+	.ascii	"V\230P\003"
+	.text
+	.section	.gnu.lto_rcSplitProcessMode.38.a54a8a037cba25a6,"e",@progbits
+	.string	"(\265/\375`\032\004%\033"
+	.string	"F\261\253H\240\330M:\302\207#\232\347\300\273\304\027\206\321\020+x&\037\217G\274\343\233\370Y7\0340\034\tb\322\033\263}\013\327QN\272B\370\2251\036\357\360\032\274\364\245\001\216\244\201\274\304d\022\207\n\351\233\265\204\220M\244L)\233"
+	.string	"\210"
+	.string	"\221"
+	.string	"7\3358\005\265\004e\316^\203K+\030/g. \274\004\037\023^\036f\233\355\344\275\031SLR\032\212\312\232s\312V\206_j;\354\345\032\305P\202\333\2426\377v\030\b\300\b\204\320\303\351+F\321\213\273F\321F\004)8i\251\370\240s\001J&\241+\016@4\244!\206\243\252%-\244\"\027\227 \003(VTbDB\240"
+	.ascii	"\026J\271K\251P\260\005\324u\005Q\220\356\201^\274E\211\356\b"
+	.ascii	"\234\231s^\307\021\340\320\031\251\2126sNk\216\250\350v\271m"
+	.ascii	"\237\355\n\366b\005\037\240\232\004\251\025\373>\376c\346\327"
+	.ascii	"\360\b\035}\356\322\327\331\3538\315\255\210V\013 \375\331\275"
+	.ascii	"\233.\317\276\3169o^\030\266\314\243\356\230Q\r\363\247\373\005"
+	.ascii	"T\307\336t\273B\365\b\252EQ\035J\265\f\325\240T/\250\326U\177"
+	.ascii	"\200\205\252,\254\002\2779Y\374\260L\237\274\262\361\250\377"
+	.ascii	"\351o\372\332\267\317\303\2272,\nH\022U\215\223\017\025\241\306"
+	.ascii	"\366\247\237q\336\020\247\222v\320\214_\362{\206]\372;\316d{"
+	.ascii	"S\2121\223\346\272\005\303\351z\210\313[\020\302\354\032y\371"
+	.ascii	"\375~\276/\b]\013\263V\241\035nZMQ\022\202\273\271H\267\240\224"
+	.ascii	"\333\311\345\235\352r\217\344\r\277\2529\2301\347\224"
+	.string	"`\333\304\2558\034`2\347\234\020\344U\035\374\032\227\366ps\023^\312u1\275,\270\227\272\314q\024\344\2759'\270<\327\302]ZL]k\347\204\320\347vcR[\276\240\275\371\276\377\204\272/\253TB;\234\376\354Z\335C]\026\031=\031\312\262\273<\377oY\030\372Y\370\r>;9:\265\020\264\233\021E\016\210\235\013\"p|f'z`\263\033\347\201\317\214D\211\036\034\232\214g&\333\231\335\350\310ph=\262\007\004\314S\"\207&\363\341\341\241\311`\275y\033\240\305\301\226g\227)\227\314J\032-3+\022(\216\203\257\024\241ke\366\275;p:\202[\"\265\303\331\346\246[\352Z\236\257\246`\347H8\0308R\303D\312H\223d\013\267\244\307\270\274\327B\"C\204\270`U\311\222\"\243\341\332\0314\350s\236\t\332\233c6\004\257vU\206\262\210\033\263\257(O\362\2370\266\342\206\261\025\263"
+	.ascii	"\351Os\001P\25018#\215c\312\214\210LDZX\320\034p\002\241\251"
+	.ascii	"2\017\021\220%eF4i\355\"\315\026\234\002D\350}Iu\235k\r \b\324"
+	.ascii	"\365)\337\200\315<\306\300\326\n\210\347(\301:\375|\273>\254"
+	.ascii	"\332\255\024^\335\273!/K\035\345;L\312\340z\331\367f\247\026"
+	.ascii	"O\260\033)\240\353\034:A7MN\"\201\212\326\2350pj\276\3250F\234"
+	.ascii	"\333\242`\203\316\236dF\203\"/\2345\366\221\257$\013\266\340"
+	.ascii	"\310\177*7\212Z3\202\311\022\333%\3500\t\322\017\214%\243\221"
+	.ascii	"\b7Y\2119,\2560\372>\033\005\240\360\250\260X\273\nbt\241\201"
+	.ascii	"q\t\177"
+	.text
+	.section	.gnu.lto_rcSplitInit.39.a54a8a037cba25a6,"e",@progbits
+	.string	"(\265/\375`\325\001\335\021"
+	.string	"V\343{H\3200'\035\330+M\372\360\313\360s@A\274\006\306g6\235.\002\215\240?t\003\241\360O\223\351\370?\206\265\357\2559\232~\3672\364\225\327\214w#L\035\221\340\341\237 \223\3041\304P\312\340\364\264\267v\357-eJ\001k"
+	.string	"a"
+	.string	"e"
+	.string	"\363\306\303\307\316N\207j\316\317\300\243\013\264\036\375}D>\266.\"\037}\242\240f\333?!\236\227\270\302Q\252\232\363\203m\220Mm\227\021\256\332|\227\356v\331\002\361\b\023\254\310\201\021\242\353"
+	.string	"_M;\210n\024\366|\241"
+	.ascii	"\0323T\204\350p\220\300\317\210\027G\272\352\350lTY(sNkN\367"
+	.ascii	"\341f\3356\213m\004\266\036\bw\025=\245\260\242\302\355\315\376"
+	.ascii	"n\272;\373\377!Q\244\3445a[\rr\336\355\262:\276w\303\250\336"
+	.ascii	"\250V\250>\200\221\032@?\273\234\275\361M\236\253\036S*B\241"
+	.string	"x\357\347]\355\333\377\374$\277|\026oQ{o\246\004\367M\235\204\023SFU'\255\307\022x\273\346#\371\345\033\375\250v\036\315\003\273\365c\374I\306\037\362\204\024}\356\321O\221\217+#\247CD}\nr_A\262p\363\026\244\257\"\277\364\257\035[\321\347t\341\364q\313\233d\003\246\346\234\013|\027\03020\020\232s~\350\361\313\202Z\262\342\325\350\225\243\230\202vvw\246\221\256%\351!\352\345\300)\017\177\350\347\374L\332\034`\3649\327\036)\262\267\310X\\f\rbh\263\027\227c&12\r/01\032l&\203\271\310T6\300b4\030\230\t\211g/+4X\314lF\203\275\276y\030A\034\330\360ar\202\276MF\3075J\315\332\310\335\371I\177\240$\002\307\t\226|F\302\325\261I\324\206\020A\237\003\331\335\333?\347\234QF\356^\350\341\210\332\r\320#\005t\024\242F\257\340\006\035"
+	.string	"n\b\b\303\2766\\\315\212\2714\304\236\254%`\341\316j{&\002\0047*\273\317\330"
+	.ascii	"3HZ\270B\021of\304\013\342\036G\314(\225\313D \204\254\362\201"
+	.ascii	"&\264\222#\020E\370\221'\332[\004\f\300pS\n\265\007"
+	.text
+	.section	.gnu.lto_rcSplitProcess.40.a54a8a037cba25a6,"e",@progbits
+	.string	"(\265/\375`\201"
+	.string	"e\n"
+	.string	"\366\222HB \307*\035G>\203\346\t\306o\213\"\200CId\377\374\230\201\3133G\230\325\n\261\320]\360)\r\2405\324\273\300\"\f`-\004\"\250\007\306"
+	.string	"\bV\024h\252-"
+	.string	"p!\225\370r\003\221M\366N)5"
+	.string	"4"
+	.string	"6"
+	.string	"\260\026\bl\266\273\035U\371\370\215\316\321_ M\337HN7\212\025\201\004\r$j\333\304^P\036\363\031B\246\346\314tv\327SE\216\334\365\266/l[\330\216\020\236\323\257\032\345\314\301DlW\244F[\005\365@\213\306\366\247}\230\273\306\277>\254\260{\3622\260[VX\"\3415\342\017\334\353\366\r\367\352\321f\360re\037\017\032\240\250i.\030P@F]\342N9\004\310R\023\202}"
+	.string	"\017P\362Y\354A\232W\275\372$\356\365\264UB3q\255N\263f\227\246IS\354o\273\273\246,\007b\206\347\363a\210@\2360\034y\f\3668\242\257#$za\007~\035\350\333\370t^(v\034\b\203!O\330\211@0\3544\345\236\262\3349Q\324\226\231\2668\232W\331\001\201K\017"
+	.ascii	"3\003\3269\003\277\252\206e\212j\026\004\"\021\202g\304\2633"
+	.ascii	"\341\027\314\273\004@\254\246\210\273\374T{S4\265\007"
+	.text
+	.section	.gnu.lto_rcSplitInit.part.0.46.a54a8a037cba25a6,"e",@progbits
+	.string	"(\265/\375`v\002\305\024"
+	.string	"\006'\207I\320\360(\035\332\264\242\242\235\300\312\321T\371-\005~\270\235&\230\222\016\031\202\370\322\316\232\207\267\267\335\024\002U\333[/\250]\246S\b\341\267\021\221O=\274\3042\343Wb_,\261\201;\363"
+	.string	"0\t\001#\375\2667\331;\245q"
+	.string	"n"
+	.string	"o"
+	.string	"oQ\373\017\314W\306\006\300\207\036\215\216\3351\301\251\017\244N=\276@=M=\244\236~\205MNh6&'5\333>\356\324<g8#\364\264;\262N'\tOi;\025\247\2546_\352v\267S\024\312\357#=6r\230\202;\234\213\"\201\335\035\260\213\021\027\354\356\203\2274;\234\234\037(@\\\206\274\242Pv\327)\0217\352\266_\266\037\330\362\027\256\024%-^x\317*-_t?"
+	.string	"\211\n\020\336n\315\220\307\216\240I&\016\364\027\375\302O\373~\321_\370GV\to\364\342\325m\334\232\033\275\244\366\004*\330\34318\321\203\374 \220\366\241\231O\344\003\371\300\273\270P\355C\263U\314\270\273\t\276&\237'\223\324\351J\274\017D\363\177V\215\264\377\300H\221qolj\376h\325\251Y\004\363\223fD\366\004\341\210\221;</\356\356\316\331\363\254~\322\371\340)\r_\016\031^\356\266j\253\\\206\215dgw\033\330\346\360\030/\003M\273\353"
+	.string	"\306\2234\370<\247^\201\311\353`\365\224\325\3444\305\371\020\276\341L\017\334\322_\252\234sJ\241\f/'\207\376\224\363GGp\203\224c\002\366\300\311\241\347\347\356\336\344\354y\326\177\247\216m\031\035\\\027X$dh\311^3\027\325\353*/\f,0\b\262\030\254\345\303\255\022\331kC\213K+\306\202\275X,\257\224\025V+\346\302*\0211\254\305\025c\311`\260\030K\365\251\343\377\036\341F\n \222\370\031\257u\032\0057s4D*8\310)T\273\202\005y\235ePi\311\303\274Y>\245\3725\256\224\342\363\270\345\222\327\271~\227>\234\035\236\217\323\305\3313-QW\237U\001AI\0035 `\002!\206\326\001W\t \263l\235E1\310\356\372w!\354\ni\255\013\212\367s\013|2\321\327\301\247\013\200\336\334\270u\353\332\324\202L\017\005#\2541\"\023<\313"
+	.ascii	"\016\006\240 \b\310\32277\210\355\210=D\320\342F\237B[HU\017"
+	.ascii	"7\372\013\262\301{>7\361-\230\216k8Le\240\331\001\274\013v\301"
+	.ascii	":\212j\240`\266a\373'\030\256v\274\352\364k\361\030"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a54a8a037cba25a6,"e",@progbits
+	.string	"(\265/\375`\202"
+	.string	"\355\006"
+	.string	"2\013*/`-P\007pB\23325\303\356\267x\016\230\230\232p\025\266\265MdAP\270$I\022\b\360R\004\331\232\301\217\206\216\206\301\267\333QJ\231\002\257H\035\331BHTY\230=\270y\345;.\343b"
+	.string	"\356\324\300\205Z&\363v\361H\306\302\270\353\246\226\333\335\325\242K\260\245b\231\224\b|)~\230\030B\342\210\210%~\347\004\342\211|\3654\017\300a\007\215\335\201\221m|,p\203\376\177:\306+\273\273\025\230\"Az\b\221vwu\300\f\272\177^m"
+	.string	"\275\377\260cl\216\237\177\021,\003@:\215\002\246\364\177Z\004\025"
+	.string	"CGe\333l%M\360@="
+	.string	"8"
+	.string	"8"
+	.string	"\214\317\202\310/4\030\301\360\204_\260\tr"
+	.ascii	"\272U\305\330\031\210\236e\201\302\237\312\003\f\030\214\247"
+	.ascii	"\240"
+	.text
+	.section	.gnu.lto_.refs.a54a8a037cba25a6,"e",@progbits
+	.string	"(\265/\375 7\271\001"
+	.string	"3"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\001"
+	.string	"\004\002"
+	.string	"\003\001"
+	.string	""
+	.string	"\004\b"
+	.string	"\001\004\023"
+	.string	"\001\004\025"
+	.string	"\002\005\001\004\004"
+	.string	"\001\003\b"
+	.string	"\002\006\001\001\005"
+	.string	""
+	.string	"\001\006"
+	.string	"\001\007"
+	.string	"\001\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.a54a8a037cba25a6,"e",@progbits
+	.string	"(\265/\375`\232\027\345m"
+	.string	"Z\2648(S0R\312I\007\367\373\256{k\252\333r=\356\362:\257\226\0359\235\211w\313\023WM\323\261\332E|\214\235\335w\025k\333\013\007s\364\204\312\217\002\026*\3315\267\343s\367\210\231\206Un\021@\030b\326nE\034Qei\265\251\375\377c\272\rB\244L\001%\002l\002x\002\214\307Ov\343gV\005Q\354\212\3020\034\t\244\362EV\234\004?\213Qa':\266T\315\310\240\300~\256\202\307V\030\313\212\246eN\324\333\223\334\275\3559\354/b<f\343\035H<\335\273U\244"
+	.ascii	"!q:\252\354\356m\033\020j\300\207\274BfC\001)\257\371\251A\n"
+	.ascii	"\354\253\323\267\223\252fN\215\212\261\b\2479\317=\216\347^\022"
+	.ascii	"h\233\021\257f\247\247c\271\3779\251\230W\326\f\235r\017|\206"
+	.ascii	"\313\030`4\3478\366\3417\307\366\266}\344\207)d\235\002\261\b"
+	.ascii	"_\353\251g\006|\350\336\0363\340;\253Q\323\326\311ppb|\316\261"
+	.ascii	"3f\332\264\2061gK:-c\036\370\255\275B\276\260\267\"^\324\324"
+	.ascii	"\363\025\265G\017\212\036\036Y\033\203\371\251\233Z\003\367\244"
+	.ascii	"\315\213\275\3604\261\242R2\204\273<\225\302\354A\217;\332\316"
+	.ascii	":=\003Q\317W\352\331I=\f*\020\013\352\317X~\376b0NC\225R\314"
+	.ascii	"\353\274\267\r\272\351Z\"\005M\247|\205\317\270\254\004\243="
+	.ascii	"\202\t\216\032\245\\\260{\237?<"
+	.string	"z_o2tz\241z.\341\343=.\341\373\n\252\211#\365\032\250\247@e2nr\331\020\233\235[\036{N\262\275\315{\333\237\03485@\234\235\036\205z\316\341 \302\334\t\376\243\236\207|?<\344{\253&X\204/e\020>\024O\026\341{\333\262\b\237\312 ^\360\241B\210\277\277~\036A\353\352\337d?\243\320\343\230\365\363\004O<\020\020\340o(?w\260\343g\002~.\301b]\375g\340g\026?\304\217\370\233\310\317K:\270\352?\211\303\240\3329\320\337=~\206\372\031\3713\f?\333\370\231\351\347\340\317\300\237S\370Y\205\237O\370\271\204\237\217~\016\341g\017~v\340\347\025?\203\370\271\200\2375\370\331\367\263\213\377^\376\203\371o\366\177\315\317-~\266\340\377\363\347\n~\246\340\347\004~6\340g\021?\003\375\354\363s\317\317<?\343\374_\340\377\227\377\276\275\275\275\275\277+\370\323\007~"
+	.string	"\020\bK2G\036\214\206|\346@V92Y\200)$\027\363&\237\312&\314{\233 g\334\251\024\306\366yi\340\247Q\310\217+\325t\357"
+	.ascii	"S\367\032\371>\357\275\306{/\316\362G{\257\026\220\262kj\352"
+	.ascii	"\336,\241\251\373\303\230\326to;\315\240U)\233\\\314\242\264"
+	.ascii	"\262f\327uj\215\334u\311l-\325\246q\354J\251Q\273\252t\314u\272"
+	.ascii	"\3542c\026 \255T7y\216;\256\270u\372\033\244:\326R|\330D\321"
+	.ascii	"m\211\033\013k1\027\346\214xyS\303\032,G\006\347\017\\T\324\257"
+	.ascii	"(\rEk\016\310X\247O|]\226rc:}\372D\265\241\233t\r\315\244oh/"
+	.ascii	".k'\255\344\275\204\303\236\266E\355\204\237\215\344\f\tF\256"
+	.ascii	"\207t\231\351\232\201\b\273\241m\027\216\031W\231v\322IX\016"
+	.ascii	"m\321T'\2626\271.B\003\273\371\030\201.\362\215L\327\275m;i#"
+	.ascii	"\327\230&\305\227\334\333R\350\007\256\316\331\305'}\252TyP:"
+	.ascii	"\365(\031\265\217p\323\214\006\2744\365\250\230z4\211z'\272C"
+	.ascii	"=\032\027\026!\204+U\253B\223\246\323\226\241\267\270\254\271"
+	.ascii	"n\317\316\0204\347\261\323\0338W\363\375\315|\307\200\243\b\233"
+	.ascii	"\216\341\357\254\356\321An\360\232Rm:m B9?\220sb\235\0365\252"
+	.ascii	"\355\243\265\372\312\307\330^\252\b\240\360\350\262\353\037\\"
+	.ascii	"\326>\270m@\210\213\354\031\311K\3237\233*\304\"|h\\\321\233"
+	.ascii	"\007\212\266\326\224\267\343\n\347k\215\313\331i_u\353h\254\367"
+	.ascii	"U[\361$\333\276J\357=2\037\340\303|\300\215Z\222#\231/}\257U"
+	.ascii	"\365\222\314K\224c\247\275\244r\353\2676)d\216\022?\355\216)"
+	.ascii	"!SRmf\310\025\034\235\276\245\376\206\352(v[a\004[m\331Z\322"
+	.ascii	"\351\020\213\360\3350\b\037\267E\357'\020\276eV{\177R!l\250j"
+	.ascii	"P\266SO\026&j\226\355\364n\322\371ZSR\327i\343\020B\261rh^\231"
+	.ascii	"\242jQc\247O\316\275[{c:DuM\221\352\222\302N\237$\320MrMu\215"
+	.ascii	"m\311\303\301\f\323Q\221QeQr\341/kwZ\326\330\311O\247\0130\275"
+	.ascii	"\2756\366\261\221l\307u\254\327I\316\353\313?0\033\276\3436\\"
+	.ascii	"\306x<\346L\206\313\\\250\2757y\357-\nyy(R\210iLS\201\032\332"
+	.ascii	"\333r\247\f\223\315\210\036\217\"\373\f#\031\023fK\247\250\261"
+	.ascii	"\221\3448Aq2\325)z\233\254\315\210YA\322i\3571]zL:\265u\332z"
+	.ascii	"\354\374\001\013\202\245K\247\375\003\357\300xhpO\374\005-\243"
+	.ascii	"AL\330]]]\337\tu\221\323\223c\037\274\356\272\264y\337\351\214"
+	.ascii	"\021\243\304\256\333\275$O>\256x\240\254\262\004\231\"'\327t"
+	.ascii	"!\240<\361\302|\336f\200\212\3525o\272\037\244\rH\254\250y\202"
+	.ascii	"FL\217N{.\207\251Ev$\222\006\007K\025s1\035\307R.\025\223\335"
+	.ascii	"\351xbwo\326\220\252%\tF\004\315;n\2066X\200t\332e\372\214\016"
+	.ascii	"\025\035\234\327\231\036\270\344\370r\244q\\-*Z\272\264\031\036"
+	.ascii	"\303\023d\210\326\230N\033\256\311\364\354\335\3555\311\214A"
+	.ascii	"\241pX"
+	.string	"s\326i\013FEu\204y5\254\264\257\266N\217\323\364\366\306\316\013\234\367X5\244\306\254\323\262\273K.\016\004%y:QSw\330\241\335\324+\264\245\253\307\307\031Y\363\371v\363\001S\223k\223\303O\315\210]\231\352\245\333\2744\233\357^n\231T\313/_\232M5\336\033BL.kh'I\223(3\2727[_\3450\361\342\222\352\364\276(\352}D\270pYs\351\030\204\322;0rw\271t\340>-\365\255\205{\255\254\327\332\214\003\027`\330\344|9\314\322\322:\213\r\317\233/f\232\\\247\307\022\306\252\314\305S\337V\270\317\312\372\254\235\204\332k\265C\245k\331:\360\2332\352\271\235|ogOy\353\360\326\241\2530\223\033\207fw\263\226C\177SyW\351\311A\016K\223\306\301\207e\r\0162\264\352\337\277\357\036\227\367^\253\233\366.\221<\347\033\346\241\277\207QF\340\177z\357\177\364\377"
+	.string	".\264\327\270\226\267F\365:;\372\270\211\373\233\347\275\311-\343\005[U\311-\036\312\346\3265&\225\030\203\226w\313\250l\336\033t\223I\243\013\346\rR6o\325\305\021\246\212o\273e\274I\346\r\272\311{4\241LnU)\233\307\252 es\253\3526\267.\320M\036\227O\311\273\f\272\315\2554\267\311\254\002R6\231U\312\346\226\026\213){\350\252R\313\343:\302L\224\311\233c\352\307q\t\364T\266\314K\346^v6\335%\002\367\376`\006l\221(L\372\315\220!\234\361\013\022\203>HL\302\244\020Lk\215!qU\262\201\264\316\b\026\017@b\312\200-\376\202D\242`\222"
+	.string	"7\2061p2(\341\005\f#\f~\031\270\b\341\203\237\321\b\277\243\027AI6Z\254\254\220h\202\317g\234\360"
+	.ascii	"\306\213#\"v\225A\004\262&h\004\207J"
+	.string	"F+qh\264\264\262\305\027\216~|vP\234`\211\300\032'X!\323\213b\221\007H\\\227\200\301\235bq\r\016\211\""
+	.ascii	"p\024$\006=\310\004\\Z\032\032)\021Y#$\246\265\370\363\240\220"
+	.ascii	"\2702\2552\324\247P\001\201\212\0257p\276\202\005\n\026(|_\301"
+	.ascii	"\242\250\210\205\212\"\365*\212\320\325\207\375\025IX\227\204"
+	.ascii	"\254\272\3764\b\261\376\220^\320(\002a$\005u\326\037\313\264"
+	.ascii	".\331\220A\004\376\224\210l\3607\202\005\340\005\"\273.\255J"
+	.ascii	"+;\242\370\223!Lb\032\032\001@\243\b\374 \310d#\211g\375\275"
+	.ascii	"\b\240Fq\251XCF\320\215\025\211\351\305\312\002\211\277\033\303"
+	.ascii	"\0304\202@\245\030\001\260\277\225\005\262G3\202\254\320\205"
+	.ascii	"\243\020\237!\204\264\262\300\026\204l\020\203\242pGi8l\361\273"
+	.ascii	"a?\343\004Q\221\270\266 $\"\221\370\260\306J$b\207C\"\321\016"
+	.ascii	"\221\025amA\270\006\327\021\204\330\237\212\"\032A`\f%%\240\321"
+	.ascii	"\r\242N\361\307S\002K\034\212\240\004\024\022\327\"\320\252\024"
+	.ascii	"\003\b\243\005\037q\025&\tY\246\025I\250\263\376V\244\341\007"
+	.ascii	":+\322p)]\177!\260\304a\215\236\"\323P\310\326\030\342\254,p"
+	.ascii	"\004$\033\300\030\352\n\203\360He\177+pX\225\310\203\004\\9`"
+	.ascii	"\177\021H\3002\tm\250\247\200\002#\023$\200\260\201\032<\301"
+	.ascii	"\n\225j\024\203D\242\241\220\210I\b\\\"\n\022\213D'F(\t\2010"
+	.ascii	"\210kR\222\215\0267X\236\037w:M\324,i\343#\213\223\"N\330h5["
+	.ascii	"\2139\251!=P\244\002^xh\312B\241|\314\354\304z\360\250\322c\311"
+	.ascii	"\260"
+	.string	"\251\035ti\242\260A\202b\231\245mQ\211\272\3528g\025\254\272NQ\253\024\314{\217h\025\252\343\250\325[\324\352'\357\207\371\200\366\252\242C\317\227\242R\250\024J\305\201\316\324Es\034\245b\267\265\2608)\235\242SMu\203\245\305\251\007\267\033.6g\324 (\016\024\007\n%\3044\316\245\310\262|[\366\030\301R\342\2046\035\205B\237\352\242\322\340\236P%[\225(1O\206\350u\361\001uj%\004\240QZ!\263\342V\246>\005\201\332\250\2018\250\2243#\"\"\"\"I\222\244\003a\005\204\030\346\244\264n\022\300$9\021:\351\310\fI\nR\220\302\264\031\330O \220\210\200\212&\003TD\331\363\202\032\2658\243r\020Qo\024,\021\340\033\321\355k@1H\354\254\211\r\267\307l\245\210\b9\201\202\222\352h\301\302\360N\255\235\217\200\007\034\302M\234\005|\356\315\311\rY\337\362\323C\001\271"
+	.string	"\251\321!\027J\232\215y\213@\304C)lv"
+	.ascii	"\361,\352\\A\227\237X\233!z\273>@\210\216\360g\r\232\350\322"
+	.ascii	"!&uSC\374\274\f\220\262\274\b \b\336<\302tw>\200\332#\3109m\257"
+	.ascii	"\tc \360f\310\0244l\273\307\231x<#<\f\357,&}\r\025\002\035\306"
+	.ascii	"\344\323Q\267\220\202\234\213\251\037\324\005U^`\266P\032F&F"
+	.ascii	"Q7,:\267\235\225\302D\325\245\001\302\017\260c\245*FdG\224\317"
+	.ascii	"!M\236\006/\245\034\203 \013\007pG\005'J\002}\315\272\242\220"
+	.ascii	",\022\344\220\320\002\005\003ooj\037F\232\021\305Y\266\317\334"
+	.ascii	"\214\3502\367m\020'T\005\t\2405\213F9\213\b\261I\254\312\032"
+	.ascii	" \336''\017#'b\fn\250;:\307\340b\r,u\024T\342\205\367\024\266"
+	.ascii	"\200\336\360B\210j\021*<\317\027\020\370\240Y\246\377T\022@Y"
+	.ascii	"\321\3012\251\371\255 \241\202\313er,\276\353\320\214\275\265"
+	.ascii	"\2546\006\332^t\364\351p\300\t\367\266\361$\215\023\245\330\211"
+	.ascii	"\272\231\016\306\025\247\276\255\326\374\323\363\256\245\202"
+	.ascii	"\304)\235\013\221\273\274\237\262\276\306\r\004 \037\033\375"
+	.ascii	"}\374\351\363H\223\027A}\342+\371\374\210Fa\303\246O\201\331"
+	.ascii	"9\r\231j~%NtzH\3758\016)s$\353Xgp\246\347\030\265dK{x\236\366"
+	.ascii	"\225c\212g\252O\377\017Q\241h\377\251L\005\334h\021\334\313\210"
+	.ascii	"\207\3022\300\206\037\024-\013`\006\323\205S\275\300\343h\312"
+	.ascii	"gu#\267zD_\004\302\325\2539\311\344\205\275C\321\257\346\020"
+	.ascii	"\253\364\247\321!i(i\310QP\001\227\257\036\251-\236U6O\206\316"
+	.ascii	"Ip\3002\372\202v\315\264\r\243\346W\357\336\n\225\rK\241\177"
+	.ascii	"R\265\240\033A\311G\230\366\251\364Q6\274\352_q,\"\266\320\360"
+	.ascii	"\226CT\n\245?\202i\257v\200\361=\356`Q\331\001\252\300\256\204"
+	.ascii	"m1\234\271\037HO\345\016\320\307=\226\225\372\253\314\211b\033"
+	.ascii	"\364Y\245k\340U\034x@\234bI\004\356g]\020r2vzF\003^\270\307\021"
+	.ascii	"\210?\311\013a\244\2642I\337\001\244\"\301A*\264\2000\315\264"
+	.ascii	"\241a9T\n\214\361\200\322\301;\260M|\330f\0300\240\273_\003\211"
+	.ascii	"\3509\002\036J\372\3670\352*\201+\343T\275ec\232w\025\275\224"
+	.ascii	"c\343\375\025b\006\212\n\255\375n\314\301w3c\256<\236\342\225"
+	.ascii	"\313\276\372\312\370\307\352\241N8\273of\323\221D>a#\314# \230"
+	.ascii	"\317*\325R9\327t\223l\034\016\342\230`\310\311\313JlE\274\272"
+	.ascii	"\363\200\327H \332h\034\322\304LZ\225\027\350p\207W\242\341\363"
+	.ascii	"\312\016\352LA\377\2076\327\361\302T\371\306\254\317\3743;3\317"
+	.ascii	"{mB\306%\321\332\244\377l\366\226\301\317\326\315,\327\340x5"
+	.ascii	"\345\236\321\307\300\317\3105wc\301;\177\203\275\265\255\251"
+	.ascii	"\352\253_\202]\333\003\346\305cY_\247\242Kb5j\373\036>l\200\352"
+	.ascii	"Z\361,\254\271\260\234\371\026Xu?\364\r\352@78\303*"
+	.text
+	.section	.gnu.lto_.symtab.a54a8a037cba25a6,"e",@progbits
+	.string	"rcSplitInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\001"
+	.string	""
+	.string	"rcSplitProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\001"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"setTaskEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\001"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\001"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a54a8a037cba25a6,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
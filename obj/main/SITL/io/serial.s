@@ -0,0 +1,1542 @@
+	.file	"serial.c"
+	.section	.gnu.lto_.profile.2283bfd2d72ef317,"e",@progbits
+	.string	"(\265/\375 \tI"
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\036"
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2283bfd2d72ef317,"e",@progbits
+	.string	"(\265/\375`\325"
+	.string	"\355\n"
+	.string	"\024\021\311\001"
+	.string	"\""
+	.string	"\354\301\314\336\005"
+	.string	"\001\363\330\276\203\007\022\002"
+	.string	"\002\001\002"
+	.string	"\002\002\002\003\004\226\230\365\242\b\003\327\214\256\274\b\002\002\005\002\006\004\333\375\377\333\001\005\373\306\354\242\001\002\006\201\225\345\331\006\002\002\007\002\007\007\240\342\234\212\n\b\265\250\262\321\001\t\365\365\232\331\003\006\002\003\002\b\002\t\002\t\n\013\f\346\224\340\266\r\r\360\371\267\351\n\002\002\004\002\n\016\361\255\215\366\f\017\363\265\2438\f\002\003\002\013\002\n\007\002\007\002\f\002\r\020\021\330\316\241\361\007"
+	.string	"\022\201\267\341\302\n\002\023\263\210\303\241\004\002\002\t\002\t\024\344\326\341\330\017\004\002\004\002\t\025\340\302\225\314\013\016\002\007\002\003\002\017\f\002\007\026\324\341\335\261\003\b\020\027\317\211\374\275\r\024\002\003\002\003\002"
+	.string	"\002\021\030\031\231\250\272\222\r\b\032\350\300\306\254\005\003\033\363\214\277\350\017\021\034\246\343\274\353\004"
+	.string	"\035\226\333\341\336\001\022\036\200\236\352\337\005"
+	.string	"\037\220\232\212\335\n !\240\342\234\212\n"
+	.string	"\037"
+	.string	"U\220\032h\250\245\r\243\267\202\002\025\315b\256\003\035\300`\246\201\275\t\336,\327\t\231O\351\253k\2200\210K\204GC\241p\367\2465\271L]\332%\324U\312\335Q\315\256\254\232FD\005\216\\\tkf&\332\365Q"
+	.ascii	"7"
+	.text
+	.section	.gnu.lto_.ipa_sra.2283bfd2d72ef317,"e",@progbits
+	.string	"(\265/\375`z"
+	.string	"\215\005"
+	.string	"\262\006\023\031pM\322\001\371\277\252\252\252\252\"+N\222$I\222\270\240\032\021B\344N)\256\372\3124U\371\372L\226\222\234\346\007X\360\310 \363\341\330b\354b=k\215vR$\020:\017[zm\003an\260\0220\273\004\022\332v\177\033N\t1 \200\202Iw:6i\306Z"
+	.ascii	"\001\312\3408\326\b\306\311\f\326Fg\301\375A\020bOpm\323c\250"
+	.ascii	"%8[\254\250\324/\3413\305\0034\002\330-m\206\231\341;\206\036"
+	.ascii	"\331\350D\2162dQ\016F\347\335\330\362ff`\330\333o\\F\024\240"
+	.ascii	"\200Cc\036\307\301\030B\016\246\247\245\r\300\342b\016\001"
+	.text
+	.section	.gnu.lto_.inline.2283bfd2d72ef317,"e",@progbits
+	.string	"(\265/\375`\263\004\225\027"
+	.string	"&\345\203J\300\020)\0354D\3239b\f%\217HLV+\213_\bv\035\320\302\361\177jlJ\3422#\177\311\257\316\340\277\007\263m\262Bv\212*\370\337\024\206\345\215m\212\242p\205B\345p\201IY\271;x[\2234\211\324\275\223L\001q"
+	.string	"l"
+	.string	"x"
+	.string	"!\3437B8\336\305\324\233\362\232 \251\027/\177\274\352\027\244\3710\314+\237\361\013\322\210\254L\236_\220\006\304"
+	.ascii	"\304\220\367\022S\300\253\230\312YL\001\257F{\310\204\266\312"
+	.ascii	"\204\032\212\362\305T\246\215\241(\337\350\351[9m\177P\335s\304"
+	.ascii	" \301\210\331+SG\006\352B\t\3133\360\204zj^\373\241=\241\326"
+	.ascii	"\nc\337\336\334k\255u\3324{\364\004-\234<,`\2319#:\370\0208\300"
+	.ascii	"\255\364\255\274\367^\257n\232\250\265\276\f\302\233<\255\262"
+	.ascii	"\247\240F\253\354\225X\266\032Lq\275\320\364\201i\3566S>9\241"
+	.ascii	"\251\315\266O\371\334(\255I\227\355\221\357~'\264\241\027ef\371"
+	.ascii	"\334$\301\034\243\tLs\263(+\370\033MI\237\222>\2050y@\024\321"
+	.ascii	"X\213\246\241m\221\357\332\323\0019\275\230E\353^y.b\320\212"
+	.ascii	"\264\264\263\343\300\313:\bgw\331\003\261\254,\0240\311\217o"
+	.ascii	"&\311\365\204\201\bH\202%TU\312<\363\260h\223.\321b\356'*\007"
+	.ascii	"\035\243I\343f\f/\350DeP\025\341\240\315\276;\264\263\267\230"
+	.ascii	"\344/k\327\236\204\263K\360l\252\260S\303\304#OG[64\253\243-"
+	.ascii	"\033\231EB|+\327^\330D\271\021\211\252\024.\233\345M\001\366"
+	.ascii	"\255\\\373K\322\333\326>l\032\267\270\333\310\226\213\240\360"
+	.ascii	"4#\322i\273\366%\332\332w\223AX\373\356\324\273{\214Q\210\245"
+	.ascii	"\023\023\360\255\\S\373\365\265\235\2334\003\333 \244}\227r*"
+	.ascii	"\030\245\246\227M\354\327-\002u\337\271\361A\005\375AA%5\272"
+	.ascii	"d\200m\334?\005T\035 \034&\332\006 \034&\231k\246\272\007\255"
+	.ascii	"\bf\250\3414D\b3\020\321\214\024\264\031\016\220\"\232!+\017"
+	.ascii	"\022@U]\245$\021\034\023\241 \201\3620{@\362\265\3319\212\217"
+	.ascii	"\350\315\232\257\317Q'\361\270l>j\260\b\305\242\310\320F@J\t"
+	.ascii	"\326\330\020\336\243\302\270\370^7Yr\007`\221\b\252\351\347Y"
+	.ascii	"\303\005\274\3405\273\341\370\214>{\363\323)\204cu\243\257\n"
+	.ascii	"\036\2670\364\346\315\260a0r\340\332\231\216\305\375h\245Id\226"
+	.ascii	"\373\352\217\322:\377\260\001\362*\372\315\037\303\3270\230f"
+	.ascii	"\0134\212\001mIx\303\372\026\374x\312\bp\013\220\311^\376\206"
+	.ascii	"`\023\r\3370\210U?t\350\233\346\033J\331=\022\254\317l\021.S"
+	.ascii	"\227O_P\245\251\213k\022K6A7T-\335@<\016 \020\003\207\356&:\037"
+	.ascii	"`\036q\243\025\\\253\2368\035"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2283bfd2d72ef317,"e",@progbits
+	.string	"(\265/\375`F\002\375\n"
+	.string	"\326\2201*\2009\351\034\003P!\003@#R\031\314"
+	.string	"t%\221\tDnW\217i\030\215\335\255\021\222\270\271\201p\r\366\251\341\266r\247\224\002%"
+	.string	"&"
+	.string	"&"
+	.ascii	"\235(\227\267\303I1\200\265PM\001%\362\302KiQ\n5y_\205\275JY"
+	.ascii	"\376\224\375\324\3261\331\322aZ\b\022mD\013\321\207\223\342\212"
+	.ascii	"\242\376\230\242\250<\3466~@\353\201\305\374\206\241mj0\237\361"
+	.ascii	"Wk\001\306 \337\211jNpR\315G0\031\255\rV\243\342\367K?\377\370"
+	.ascii	"\362\307H\334\003\027r#.\363\233\3378T5\254\025\220\206\020\004"
+	.ascii	"\224\334\344\365\036\377\271\345\353\304EL\307_n\2435\204\f\323"
+	.ascii	"?({\271n\037\016\022j\017I\241\224\026\325\020C\2501\251u\304"
+	.ascii	",Pf\nY\306`\002!Tx\033\021\300<h\034\242!\n\262\205\315\343U"
+	.ascii	"\334\260\353\225\203\302\201Y\322\303\201Rs~\362\262\271]nl\323"
+	.ascii	"V\275\2122\2443\366-F:+\365\251\325\205H|flDs\016\341\006\317"
+	.ascii	"\207Y\333\326\374O&\007_\361\2105sR\244\021\362\262\246c\342"
+	.ascii	"\251\312$5\227J\316\027\200\201\004\275\344F\201\304\372\"\022"
+	.ascii	"\022\2467NmK\227\277 \276\005P7\020u\244\260F\352Q\340<WM\325"
+	.ascii	"\371\032\256IC\035w\007"
+	.text
+	.section	.gnu.lto_.pureconst.2283bfd2d72ef317,"e",@progbits
+	.string	"(\265/\375 La\002"
+	.string	"H"
+	.string	""
+	.string	""
+	.string	"\030"
+	.ascii	"\200\004\001\232\004\003\200\004\005\200\004\006\205\004\b\205"
+	.ascii	"\004\t\271\004\f\271\004\r\205\004\016\205\004\017\271\004\021"
+	.ascii	"\030\022\231\004\023\205\004\024\205\004\025\232\004\026\232"
+	.ascii	"\004\027\230\004\031\230\004\032\204\004\033\204\004\034\270"
+	.ascii	"\004\035\230\004\036\264\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2283bfd2d72ef317,"e",@progbits
+	.string	"(\265/\375`C\001\025\t"
+	.ascii	"RM)-\200K2\034\310\220fB\327\343\3661\203\263\256\005\255\t\234"
+	.ascii	"\215A,:\307\343\311[\257\251i\353\032!m\214,\032|\333d\357M\244"
+	.ascii	"L\001GLP`\326\235\330\364\212b)\277\0075\370\250\334\241`\022"
+	.ascii	"<<\313h'\357\247\034\245\234\021\244mh\237\222\026\202ZI\304"
+	.ascii	"I\017<\234@\031:\027\312\025:%\345d\ni\002\376H\271\264^\001"
+	.ascii	"\372\200`B\347\245\374\322f\350hD(\177\347\221-\t6\nc\303U\\"
+	.ascii	"\374<\314\315\237g\250\2551\213\371z\3557\357/\215Je\316\243"
+	.ascii	"6[\312\211\274|2\373b\0026 p\002!32\0172B\214;\304e \254\244"
+	.ascii	"\3611\350\005\b>\212\210^\205\242u\273M\347\205\355a\205\247"
+	.ascii	"\360.\030\206\306\026\357\330\225\016Y@\326]\020\"\226\035W\260"
+	.ascii	"\260t\206o\351\210vY\263\300X\021\n \2360\217p\300E'\320\364"
+	.ascii	"\337\275\331R\030\300w\365\223\025x\025\272T\246\177\206\001"
+	.ascii	"\207\334M\254s\314Ssl\3316n&\232.\215\227\250\303-\277\001\300"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.lto.2283bfd2d72ef317,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_serialPortIdentifiers.41.2283bfd2d72ef317,"e",@progbits
+	.string	"(\265/\375 v\345\002"
+	.string	"4\004i"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\325"
+	.string	"\001\007\005\001\006\025\325"
+	.string	"\001\006\325"
+	.string	"\001\005\325"
+	.string	"\001\004\003\002\002?\202\210\200\300\001\1773,4-\305\001\304\001\303\001.\302\001\301\001\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\n"
+	.string	"@\bT\343\300\004\230G\300"
+	.string	"\314&\260"
+	.ascii	"L!)\327\017\240\b"
+	.text
+	.section	.gnu.lto_baudRates.43.2283bfd2d72ef317,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\025\006"
+	.string	"\302\210!*po\326|\375k\213A\252\277\343n\220\265_}\252\327\037\353\375\215\246eUUU\345|\330 =\317\001\276\301\352\244Q#2\311u\314\2315o\346\\\336\331\334\363g\320\347\241E\217\032\223F/m\3724\352\324\252W\263n\355\372\305\030\266\210\330\362\212\022H\035D\255f-"
+	.string	"\315\334\272\220\363\304\333\375UF\304%\220\030\257@a\222\003\007y\t\217\260,\304\316\324\253\263\3115\374qoSR\331 \367V\257\365C\034"
+	.string	"4\023\004\306\325L\0160\027\\\004\303\300m`\004\270\b\206\201s1\355R\\-\304\242\201\021\340\006\264\013d\300]\320\006\310\215y\003\332\0058\240] \204\314[\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_serialConfig_Registry.47.2283bfd2d72ef317,"e",@progbits
+	.string	"(\265/\375 \222\035\004"
+	.string	"T\007a"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	"\005\001\212\001\202\200\200\374\342\203\355\341\027\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\345\006us\375\005uq"
+	.string	"\005\001\006'\001\344\r?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/io/serial.c"
+	.string	"\004"
+	.ascii	"*\303\303,:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_serialConfig.48.2283bfd2d72ef317,"e",@progbits
+	.string	"(\265/\375`$\003\255\024"
+	.string	"\326\343\200J\300\322Q:PE\335\241\325D\350)\"\212\212r(\300\fN\341\n\344\317\200\232\211d\344o\207\221\316\265\357\274\237\331\372\304t\3059Z}\250\026LF]\002\203\373\022\263\330\251\b\204\227\036\365\\_\206\270\t\036\204\221M\366N)h"
+	.string	"e"
+	.string	"q"
+	.ascii	"\367\201\371\200\335\334\021\216\335\322\201M\306W\227/ \276"
+	.ascii	"\216' \276zf\007y\251\263\337\031\231\220\021\265\273$U\341\361"
+	.ascii	"ay\207s\366\032\3229\363\177>m|\273%!\034\3555\034\241\251Q\n"
+	.ascii	"\200+\021\262\200N"
+	.string	")fp\266\031\262\2709=\320'/h[\022\302\335|\216H\330]\317\033\316\346\026o[\204m\b6m\t\275\332\234\2424\210F\212G]\247\223\356\"q\365J\355\021$\346o.q\361\223z\222\2414\273\244M\232c\237\005\224\3411\315\331\252\373\374\365\273{\316\351\013h\361D\001\0218\355\236\230*\262\277\332[\361\335\355\227>\020\214\307\230}g\337H\253\031\203vLO\273\273z\365\203\361UAx\022\333\237\366{\376b\026\237TE_p\202dpl:ng\270\017\244\037\017*\312\032~dT\204\004\245\0137\234\007\321\216\250z\024\321\346\360\034(=\236\2126D\027<\265S~C\305\204\311\206\213\201\316\356\262^\355\225\017\275\306\335\215P\303\305\203\001\246\035\030\361U\034\272\t\251\315\251\227\013\261\214\2731,\177\306i\300\302\357\274:\204L\374\355\325\227\321\003=lA\013J\005\257\257\274:\264\300&"
+	.ascii	"\260\312\311\207\224W\314%#a/\262\345\225\302B\252\304d\344\311"
+	.ascii	"\001\303@\270b\244\013\f\026#I\312=\315\231\002\321\257Fmv\222"
+	.ascii	"\205\003i\225\220\330\370t\275\013oB\031+\240\310\341\364\004"
+	.ascii	"ko\2116\206/\265\026(\271\022\374(\371\317W\300\"\272Js<\322"
+	.ascii	"\203\252(m\232\253O:c\2378\351}vM1\223\310\303\335\335\260AB"
+	.ascii	"\250qL\302\2242\025\b\211\210\310\204\005\315\003\340\002\221"
+	.ascii	"9r\003\021`Q\025\220\310\220\251G\213\001\255\240\004\306\027"
+	.ascii	"Q\351\021\024}Pw\037\211>\201\202*\326\0068\"\237X\006\361\340"
+	.ascii	"\213\321I\254\037\364\336\376\262\244V1\203h\272\326\341\326"
+	.ascii	"\210\334F\272;\316\343c\333\303Dbc\022\253\323\022AH\320\033"
+	.ascii	"\336{`@\206M\007?\374\325\251\315\304\267\216\263z\361UDn\256"
+	.ascii	"\006\324\033\2551\232S\277\203\345\350\020\244.?\215\2110\200"
+	.ascii	"W\003\251"
+	.text
+	.section	.gnu.lto_lookupBaudRateIndex.49.2283bfd2d72ef317,"e",@progbits
+	.string	"(\265/\375`\223\001m\020"
+	.string	"\346\236nG\360\316(\035C4t\323W\354\357e\370\321\036\304\325a^\334\225i|\033\304WX1R\330=\230\377\251\261z\340'>S\352j\007{\356\341[\205\216\303]\005?\215_c%Z\371y\337\363]#B\310\336[\356\224\002Y"
+	.string	"X"
+	.string	"["
+	.string	"\001\346e<\200y\2712\346x\254\367\204\250oS\306\205(_\345[\334\332\b\230\215o\025A^dL<v\330\372Rp\326\270\\\212\274xX\337\205\307\br\323A\303\306\307\022\367\303\214\246\361\251\340>\366\216\227\016\353s9\334B(\245\206\254\317\302\315\335v\313\266\002\373 \002\035w\330\277\031Z\276\336\361\365^\t\r#\36432\200j\035.(\255\020\024\203\236\220;3\257\277}\362c\3260\202\005\247\327\024\216\322l3\327\314\nJ\253\201K{\020\0366\301\035\2450$DPZ\017\270"
+	.ascii	"wy\017\2679\031\025k\206oc\341\260\312yAi\365\b<6/\235\226\227"
+	.ascii	"\024\f\202\263\032\030\030d\334\270\273-{\267[\221\027\317\200"
+	.ascii	"\212C\213\353\362\266pK2\025*\370C\3419%\034\245\252\017_v\034"
+	.ascii	"R\374\206KC0\315\263.}\323\274\204\333\355\304\375>\366X\342"
+	.ascii	"E[\001\255\300\240\255\265\270a\261\353\262\253\n\374G\210\026"
+	.ascii	"\024\336\030\007\022D$&#)B\t5 \211\020r\300y\304\343AhT\022\231"
+	.ascii	"<\322\3103\031\205J\274\221\222\311\363\020`\322\211\250\344"
+	.ascii	"\241\220H%\257\322o\214Oh>\323G\315\307\336\321\320`\261[\271"
+	.ascii	"r\035\262\262\251\024\333\272\234\240Gr+Y\320-\216\373\310zT"
+	.ascii	"\360\347\221RJ\347\272\2362\343r\f\002  0\002\202\034euh\n\346"
+	.ascii	"\261\0337b7oI\315\2734c\200\035\227\261\321G\026~u\200\242\031"
+	.ascii	"\204\305\261<`\310\253\331C\332\202o\t\271]\360\223\300\022\b"
+	.ascii	"\270?\214Oh\002\003\377\031\266\262%8E\260\205\3004\366PV|\243"
+	.ascii	"\323b2"
+	.text
+	.section	.gnu.lto_findSerialPortIndexByIdentifier.50.2283bfd2d72ef317,"e",@progbits
+	.string	"(\265/\375`}\001\325\017"
+	.string	"\006\336jF\340\262(\035\222w\314\016\3169R\2438\fW\262\273\375\260\n\004\215}\253\220\324\257\264F\271\001\361\357\336\312\366\277\322\343\027\222z\352\242\377\"q\234\030cl\326\244pf~O"
+	.string	"\n\025K@\244\250\204\354\275\345N)V"
+	.string	"U"
+	.string	"X"
+	.ascii	"\361\002\346\245\206\360\366\b\273',]\2332*,\371\246kQc\255\340"
+	.ascii	"\200|*q$\207N\313e\207\253\017\005\347\t\226K\007/\035\325\327"
+	.ascii	"\34116`\201b\004\310\207!\252L\306\346\363\245\240^\366\004\257"
+	.ascii	"\033\325\307r\250\221\354\256\241\352\343po\267\275\262\315\300"
+	.ascii	"\276\2110\277Th}\354\206\020\372"
+	.string	"\333\347\245\206\210\315\356\206\036\037KC\322\224x\354\366a\276,\346\232\315\264\262\311\314b\354\354n\310\245\027l\227\267K\366\007\036\346\202\001\354\272\370\220\261\273\n|`\273\274\212\257(\3315\021&\342\273\013\206\312\214\307\356r\006>`^\006\207:\345\313\353&\003\b\024\354\201JB\265\303\206\214\nU\323\225\013\244N8\242\272,\365\352\305\334HA\036\013\1771a\333M\215\370.>#\305\277.M!e^u\351\247\314\313\353eG\340\202\223\202\346\004{T\206\325cF\325e\303LP[3:4x\260\266lm>\025B'\242Nz\241\356A\207\"\n\235t\001l\002\202P\322y!\0227\3528QW\022\2013\361H\034\210\200G\022B\036\2072\032y\334\307{m\371-\276\355\314`M\320\0355UU\223\234\024\365AS\227?-r\252\346\300\220C]\271fB\375\217\230\234\024\344y\334\335\235\026\t\036"
+	.ascii	"\022\023D\246& \275\033\321J(\267\346\203(E\243\244!\220\316"
+	.ascii	"(9\301#|<\306\3203\317\n\314F]\350\200`\022\305\204c\332\323"
+	.ascii	"\231-\325@M\275\017\265\356\237\036\310\324\"8'\242D\b\f\005"
+	.ascii	"{EY\241nt\332I\006"
+	.text
+	.section	.gnu.lto_findSerialPortUsageByIdentifier.51.2283bfd2d72ef317,"e",@progbits
+	.string	"(\265/\375`1\002\255\023"
+	.string	"\326\245\205I\320\322(\035S\355\r'\347X\222\2508Y\264\321X\321\354\372M\366\256\327\366\210\020Q\240\277q\373?\360\b\202\273\031\376\372C\212sh#\360\373\364j$\276\340\006\352\311fQ\2006\2628\215\374\374\003\271\241\222O\366\226;\245r"
+	.string	"k"
+	.string	"r"
+	.string	"\007\346W\234\305\314\264\002\343\316\215\n\246H\206\367\253u\\y\374"
+	.string	"\3604\274"
+	.string	"\360tI8\374\034oP\322\216\002\351\\I\363]\216\232(\032\033\036$8\231y\302\244\224\363]M\202)pN)\364\004\335p\036>'\204\026>%Hp0su>\033\357]\316\340lr\277\273$R\252!\001\341p.Q(\265V\313\033\356\346\016o\033g\033\305\226\023\002:C@:\200\360\352\330\251\217\177\bZ\232^w\317\363\356\245\322rJ\177\244\202\320\217\251\004\251\326\232\247\"U\007%:q\336\257\273\264o\377\205\337\263\312\347\321^clR509\036\204\247\267g\376\316*3h0\273\216%\254(P\276\034\216\245Z\307\004\247^\020Ji\377\347.f\037[f\200j\033\361A\250\326Zb\004\341i\262\347\026d\007\335\234\277T\344\264\340\356\316\330\200\355%in\316\341\312\215\355z\330$\021\333\027.\324B\215\232|j\255\016\202T"
+	.string	"\350\224~4^\203\006\236\312\245FM*~|\0314\005\277\331\346p \225\b;\265\326\023\030\217\001\363M\234Z\203L\376v\352\313\300Sp\367\350\2063\367\373\336\351\217\347I\306\351E>\255\217f\310\320n\316\036]\344\006\256\025VKl\275X)\251\r\256\326K\2441\227hA\\y\271Z\342\210SL0\260\304\230K\266\202\211\253\227\310RY\245\304d+\023\002\206ep\305V+0Xl\245r\375\352\370\273K8J\362\005\201\237\361\367\236Z*r\232\273\224\256Q^\266\026\002\2659\247n\320\324\322\233\364\314\177\354|\330$\221\317Zk\0057w\026pnj\277;\315\341\021\022#\242&\237\002& 0\002\204\034\334\r\037\202\2302C\325\335N\244\324\335y\264"
+	.string	"\020\016hp\303\022,r/\274\266\267\264\306\320\002B\270"
+	.string	"\234@\342\r\243f\214\214\f"
+	.ascii	"t\251\033\327\020\322\020\220\343\260\353\312\254\222>\024#\307"
+	.ascii	"\227i\222\026@\306\360p\336\250\005&j%\326\021\242\254\361\334"
+	.ascii	"\253}O"
+	.text
+	.section	.gnu.lto_findSerialPortUsageByPort.52.2283bfd2d72ef317,"e",@progbits
+	.string	"(\265/\375`'\002M\023"
+	.string	"\306\344\201H\320\362&\035\306\217\347.d'1\200]\374\277\270go!\373R\"\202'z\372k\003\237'\307rH\n\360\217?\360z\226\n\237"
+	.string	"\007\214u#\360\001\262z"
+	.string	"6\355"
+	.string	"\303`4\257\340\213\3177\2671\030\221F\366\226;\245n"
+	.string	"h"
+	.string	"n"
+	.string	"'^\354*0\366\350\204\314,\325\244h\252u\374<~"
+	.string	"w\332]"
+	.ascii	"w\272!\334}\2167']Oqt\256t\3710O\315\324M\216\r\021\261f\222"
+	.ascii	"\354X\342\371LFr%vN+\310\224B\221\303\347\204\200\342G\204\210"
+	.ascii	"837\310f\364\332\245\215\370\222\373\331e"
+	.string	"\021\024MIH\334\271L\225\324Z-CQ\347\356n[\264]b\313\t\001raD=6x\360\302l\357@\177\307Y\232~\274\347i\367Ji9\245\017\342!\301\360\240\321a\344V+\316\r\252\316\240E\262\323\376\361\322\276\375 \277Fs\275\322\344x83O\017\272\323\333/\376\314!f\320\340\345cKWI\244l\261&\246ZG\004\247^ \345\201\\\036\240V\030T\214ZG\005>\320\235\336\304\003>j\320\215\371LG>\313\355\256\215\r\274br\314\215\271[\271-\332\215\227|\262\215r\030.\024)\252\251\326\352\340\005\b (\352\247\305]\270\270S\271\024)\312\t\310g\341J\320\023\332\326\360\025`\204\236Z+\211\212\3330\370#N\255\302\"\037\236\372,\334)\267\233\024\356\314\375\276v\332$3\252\371\021#ok\273q\"\332\215\331#L\253\025\325\t\353$Ee\342eX\235\244\260\350J\013\244"
+	.ascii	"b\223\021\013*Vk\245\362\201\254/\205\245B\371LZ*\337\b\001\203"
+	.ascii	"\027V\255o\005\004[_\210\353\027\346\317.!\351f\033\342.\364"
+	.ascii	"\327\3561\035\371\314]J\327%1+\363!\2651{2\250\2674\224\266\271"
+	.ascii	"\016\032\216\227|\372\254\265Vnco\341\346z\373\331)\217l\210"
+	.ascii	"\006\204\214\274\311\365\t\003'  \002\203 \324\035n\315\177\b"
+	.ascii	"w\372\f\005w;I\251y\347\335\002X\370Yp\271\013\206#\330\213\316"
+	.ascii	"\2106\006\333 \257\013\300\tD\300\276\205\312\016\207\210\005"
+	.ascii	"}\223\233\361\020\307\210\262\321\200\346\r\r\004Q\220\362\023"
+	.ascii	"\232p\340o\006\262\265\004\247\b\266\300\\\255\334:\002\312\232"
+	.ascii	"\316\275\332\376\004"
+	.text
+	.section	.gnu.lto_findSerialPortConfig.54.2283bfd2d72ef317,"e",@progbits
+	.string	"(\265/\375`\346\002\325\026"
+	.string	"\206*\225K\300\224Q:h\243\344\306\020\355"
+	.string	"\fx\244qa\335\255\314\250-Z\013SZj\206s\007\0169\347\310"
+	.string	"\030\030\027\273\345_\367{\353\351\361P\016_\337s\225\3016\035\310\306\241\254\016\222\322L\242`{]\365Qm#do\271\223\f}"
+	.string	"x"
+	.string	"\205"
+	.ascii	"3\346\221\231)e>\322]\314nz\340\325\275@A\246{\315\006\234@u"
+	.ascii	"{\240~\305Y\314\230V\300\034\352\031\205~p\276$\367\232$\233"
+	.ascii	"\037\020\336\252. \274m!\256\224v[\303\2464~\322\353\316h\252"
+	.ascii	"\314\335\334\262r9?m\264\006@\341\363\260>h\261#\301\312\335"
+	.ascii	"j\363\316\247\377Nur9\264\177\276\2528Z*s>\247b\204{/\3232\327"
+	.ascii	"s\026\317\314\037\230\231\205\271\021\004\237\241\201_t\313/"
+	.ascii	"\031\372R&\234\211\321\227L\201)\242n}\303l\332h\0071\177\345"
+	.ascii	"\007\024\021\267\216G\221\362\211Hy\025RV]\351,Z\312a\245l+\345"
+	.ascii	"z\363o\024\326\221\017\007K\367\362\004\231\334(\333t\342J?\363"
+	.ascii	"\3710\256\304\377\361\350\233\275\367\223m\316\343\356\001w\367"
+	.ascii	"\336\367\370>\266\371\013\332\357\r\304\212G\210\210\310\275"
+	.ascii	"f\312-\223*\033\346\361\366\314\001\335}\322u\b\356G\325\253"
+	.ascii	">\256\tSx\217\nV\312\211\307\216\026\024#6vP\327\341\302/\242"
+	.ascii	"\265\225r2B\372y\0344\006@J\331oX8\220\345\366'_\370S\013\004"
+	.ascii	" 6\356\344\202\341\345%\274\025\273\207\224!j\207m\300\207kb"
+	.ascii	"\373'\267N\303\365\251\241{\357J\323\313\"5\032\344\337\025\326"
+	.ascii	"\266\375\337'0\035=\335F\330h\260\245\204\360b4\003\240?C\205"
+	.ascii	")?\357@\031\326\320\275\265\227|\031\00115-\230\027\f\254\345"
+	.ascii	"Z\301b\257\032\027\254C\006\025\273T6\264^\262\030\0322\366\""
+	.ascii	"a\257\326\f\351\222\321\220*\0048\306!FF\326\304b2rdf6ko\035"
+	.ascii	"\377\274\204\251\335\271T\237\343\377}u\004\211\211\026{l\035"
+	.ascii	"f\036\373I\377\316\216QT\255m%l\007\261\330@\275\0358t\tK\271"
+	.ascii	"T?j\377\374\002\0325\224 \325h\260\336{o\355 \376\373'Bw#l\035"
+	.ascii	"_Ax\322\262^\020\034\272\204W\0017 P\2021tW\036\315\022\245\231"
+	.ascii	"(\263\300[:^\2426~\257\223\312_\260%d'\374\266;{x\340\206\303"
+	.ascii	"\265\334E\335\300m\246ka:u\037\024E\322a\036\022\227\253(\223"
+	.ascii	"#\211\007\260\007\322\201+\230\350\031\327`\253u\267,\007\264"
+	.ascii	"\300?\rBq\264'\013\260\272/z\261\003\262\211\355\035<u\333y\327"
+	.ascii	"\312\260\230\356\027\355XZ\221\324\003|k\037\266\377\362x\006"
+	.ascii	"7\330\306\204k\\\205\303\324>2"
+	.text
+	.section	.gnu.lto_findNextSerialPortConfig.55.2283bfd2d72ef317,"e",@progbits
+	.string	"(\265/\375`{\002\255\024"
+	.string	"6\246\207J\260\022R:r!\240\001\336W\251a;,\016\322\222\307\363ZW\221\327\333\202Q\214\202C\334\017\n\346\261\364]o}\226\345$WW\223.\352\333\277\b\377\007\335\270\240G\370G\007XD\177\334Av\246\036~\016B\310&r\247\024t"
+	.string	"j"
+	.string	"t"
+	.ascii	"\241I\2251A\243Tk\257\201\021\220\247\006\302\267\270\213\030"
+	.ascii	"\333\006\364|nZ=$rEX\265\366J\367\036@<%\017@<\335\036\323i\273"
+	.ascii	"H\307p\247\315\007q\321\265\233\271\0177\251\211\n\234\217\023"
+	.ascii	"\204|\350v9\017\303\007/x'\\\273\\\270DA\250\003?iv2s\357\373"
+	.ascii	"\201\025M?\251\243\035\316\347\250Rk\365\324\355nn\362\266C\330"
+	.ascii	"N\261gP\342\270s\017\274\004%!\250\231\021\270\231\265Q=\210"
+	.ascii	"\216vy\354\036n\242\354\300\361\343\335\261\337\373]$\236&wz"
+	.ascii	"\024\247Eq\232\322\3510\234\336\235\236\377\335/\351`\203\005"
+	.ascii	"\304A\260\326\232,\"U\007]\n\372\357\366\211|\240[\376\317\366"
+	.ascii	":c3R\323\363\363\243\326\336\202S\227\344\351\355\030\273e{N"
+	.ascii	"\373C\207\021\363\336\207\342\326~<d\346\020\273\226\256\270"
+	.ascii	"!UND\270t\237+b\nw\252@\243\236xML\257\222*'^\215/\331\304\323"
+	.ascii	"pi\324\023\213!?\311\306`Jg\333\303\221,\034)\345\302i\274 L"
+	.ascii	"\311\370\fX\214\205E<%\331\245\322\345\214\273[\240(Wd\256-\273"
+	.ascii	"\221\313\245|j\255(~\36012\370)N\335B\233\327\235\3724\361\364"
+	.ascii	"\272 \267\231\345\337%1\230\327\212le\366\202\215\314h2\030\330"
+	.ascii	"\214\003\006\322\260\023\r/Y-\366R\322d\345L\366j)a\265\227\362"
+	.ascii	"D\200i\033b\265\022\206F\253\225-\337\356{\004)^0\211^\351\007"
+	.ascii	"~\304\352\n(\374\222\344Z\345\2668\024\342\362x\334\022\277\034"
+	.ascii	"7\\H\033\343\336w\005LMB\206n3+\254\265V\272<\376\327Hg\007j"
+	.ascii	"\334\035\337\352\nhI\366Kc\002H:Ua\00211 P\202!sV\007\241\207"
+	.ascii	"LsWbkz\232\021\245'la8B\260\002\324$L\304u#\371?\212;\351\024"
+	.ascii	"e\026v\247f\374\227\251\222s\021\360\272\222d\371\035\020\350"
+	.ascii	"\237\243\270\033\030\021\367\310\250\201\003X\0021pP\023]\343"
+	.ascii	"A\222\035@\243W\204z\312\b\031\024\213\274J\201\307\251m\371"
+	.ascii	"l=\fU\211\216\3146\222\202\343a\f\217\326\354\271W\033\236"
+	.text
+	.section	.gnu.lto_determinePortSharing.56.2283bfd2d72ef317,"e",@progbits
+	.string	"(\265/\375`U\001\035\017"
+	.string	"\326\334gF\360\260(\035\273l<\263h[<vY\272\237\333=\031\315\357\237\210\246\020l\372\215\355\214\244\003\354{)\252\375h\362\024z\275WrB\030\336\304aqX\310H\241\34498\214n!epJ\256\321I#{K\231RV"
+	.string	"P"
+	.string	"T"
+	.string	"3\344@\376\241]\306\027\320.\367\365\357\232\214\253\237\357\001\242\\\373p\031Ab\344\200"
+	.string	"\201\031\342\001\227\nN\214\013V2X@`*~\334\260p|\300\024\335\350@Fe\005\bD\305\217\212\234\230\307\256+`\212\252Gd\316i\325"
+	.string	"v\270=\267\335\331\206`\377\025-\3735\277\347\341\035\245z\245Z\243\372\233"
+	.string	"\227\233\b(\346\3440\3331gH\027#l\233\354\217\355\325\327`\210\003f\212\005k\240j\237\3460\323\303\223\023\230\263\265\323b\316\220\201\023l\227\0167\333\376\314K\230\374\3050\004\350\301\201\251lr\314\353\322o\230\271\361Bn\313e\025\243,4<\324\210\n\264\335\313xVwW\203\241jA\351\314_\335\253vN:\263\355\375\204\205m\316\324\003\337\246D\332\346\234\027q\371E \2439\351\354\313\"aB\266>\321\344\266\254^1YJu\330!\212\256\313~\234\033\"\257+\205D\027J\266\t]\211\310\223P\032y&\036\016\205P\030\351F$$\316\3538Q7R\201\013\215H\\\210\001{&$#\256\344y#\356\023\316\307\271-\377E\007F\237\342\032\377O\013`C\207\205\324\177\332c\007\360\242\003\263\376\247\305]\261\035\327\"\247Ei\001\032"
+	.ascii	"]\204\036\230\005\3102K\2001\260\001\2521B\r\200P\270(E\3030"
+	.ascii	"\020D\035\215\273E\020\220\025\222kx\303FJ\023\361\306\026N\022"
+	.ascii	"\362\201\271\002\025\016\356\n\322\006\247\020Z\022j\207\n\246"
+	.ascii	"\031"
+	.text
+	.section	.gnu.lto_isSerialPortShared.57.2283bfd2d72ef317,"e",@progbits
+	.string	"(\265/\375`\233\0015\020"
+	.string	"f\337nF"
+	.string	"\261&\035;7\240\bP\323\364j<\247G\347X\247\301\347N\235\344u\001\311\361o\275P\017\343\352\324LW`K\207\bD\023*\032"
+	.string	"\t*\350\336\361$\256\216\t\366\033v\367\354\252m\233\266 v\357-eJ\001Z"
+	.string	"Z"
+	.string	"W"
+	.ascii	"\217\376^@>f\377\220\217\266\335\300A\312,\377D\310\234\206\347"
+	.ascii	"\005\007\307\234\237\2664g\271\214p\225\305\277\316GL\324"
+	.string	"\360\300\260Z.;<nP8\232s\206X+]\370\321\332\201\005`i\200!\260\327\207\353\\cX*\325\217\2049\247\025\206\305\341\376\334v\212m\n\366y\0027\277\307s\376\3546\277\204\352(\325\360\243\336\217Z\245\372!\001%f@\320\231S&\246c\312\2100H\330N\331!\333Q\305qR\317Q\201\242\271\002\021#B\3668\202\360;\212\324o2\250h\256T2\f\262G\221\252\332?\361\232\324mV>`NW\217\2139\277\005F\220\005 \022.\311c\277p\017\320\330\277Z;5\340\023\310\335\303Rd\253\273+o\274xPi\314_\335\277\354p\321\230\355\223\263@\311\346\\=\360Wx]6\342\361\013b\303\306EcW\330\253\365bw\306_\221rI=+\315a\177-\2723\366\341\234sz]\266\325\240\007\\\267\241L\234\312\210\tj\253`\201\304+\231\234\b\234\234J\023\270nC\2318\225\022"
+	.string	"\027\266\022\256#\241\274.\005d\223\b\206\322\346\221\234\264n\323\270\255\204\242\231\274\223&b\300]\n\211\247\241\272\316\323B\337<\234\353\262F\005W\030\362\2701\266A;rY\225\343\2022\2713rC\274Z-\342\272\002\036"
+	.string	"M\204~ea\314\221E\314\024\001\201;\225\0324\206J\030\004\344!\026D\224\026\247_\226Q\240,\306\265\252\2700F,\343\200\375`\024\\\006F"
+	.ascii	"\34135\n.k\232N\324\342\246$\024\243f\317J\203\254uB\001"
+	.text
+	.section	.gnu.lto_findSharedSerialPort.59.2283bfd2d72ef317,"e",@progbits
+	.string	"(\265/\375`\260"
+	.string	"\225\013"
+	.string	"\246\326RC\020o\234\016c\001"
+	.string	"\220\024\036s60yt\366\321\342\251@\311H}\031\300\350e\261\373\330\222\255\375\261.\017\355\256\001\212)\004\b\024\240\253t\225\353A\242\017\024uH+\322D\rUj%\277\333\336)\005="
+	.string	"?"
+	.string	"?"
+	.string	"\230\353\324\"m\373\034\336!\364g\244\222F\026\f\027\241S\214\335\212\271>\204rz\035\204r:1\374s\371\361\177z\265\241\264b\024\211\227\226\200\335\265\034E\243{\3366\306\366"
+	.string	"\373'\001\026lK[7\375\364\365\257\246\364/\017\025/"
+	.string	"\244v'\244d,\212\242\320`;\264+\266\253\017\007\021\336\324\240\262,\204\n$\223\353\364RMi\277t\017\341\253\003\323]\n-L\354\326\022\007\362\2435/\021\246\350j~\006H\021\232\001\222)k\310\337,($\177\210\223\350t\220vA\037}\021\037\301\3613\234\272\353\310\217\247~\347\363\310\217\226%N\240$L\321\256\242\234\027\354W;\003\\\267\201\032\347!\260\0017\003\0074^\266\371>\024|Y\001\256\333@\215\363 \330\260\226Y\220m\236\346\303\272\r\343\266\214\203i\336\207eD\3341\320x\030\330u\036V\251{[\363\002\232\017\314!\351\374\264\023l\001\016"
+	.ascii	"2\003\302\260i`\027\267L[.\344q\232\025\226\261\030\330\017F"
+	.ascii	"\301e15\031\234xR\255\230\204I\006"
+	.text
+	.section	.gnu.lto_findNextSharedSerialPort.60.2283bfd2d72ef317,"e",@progbits
+	.string	"(\265/\375`\030\006\265'"
+	.string	"\352F\300\017F`\034R:\367\217\022\325\264D\322\253\257\314\330\001?\f\265\335\304\305\222\374\225\273-\344$>z]|hw\3529\277\270\306L\243\304\371\270V=\314\\;,\357\307f:\366\276\2320\226\205\376\267=i\204\020\271\223\f\346"
+	.string	"\330"
+	.string	"\361"
+	.ascii	"\374cfT\354cL\347\222\003\005\272OL\270*\254O\021\240m\231\017"
+	.ascii	"\3660\246"
+	.string	"3ypz\357\2228\264{\231\022x\301\372\024\310>\313\277\230\030I\200\371D\311{\213\023E\366\274\227Id\346\203\324\247\353\003\250O\333\311z\224y^9\330\310\013\203\300\237\257\267\362\324\024m\213\344\367\270\220\255jy2'\033\204R&9p\370vG\227\245\\\376\227\"\f\016\353>T\002\025*pg\253B\202\016\301\200\271:\332\021\333CySUng\2532\202b\240\233;\3624(\273&h\242\274:\017\335\240\305\013\212\320*\nm\261&\231\257=\301\224*#V\345uH\373\203\2569WO\177V>,\312V\205\205\"(\273\225\262z\262}\262\243V\300\236_uY\312$\267\274\016\367^\266I+\345\371\347\314\217\300\314+\230S\251Ldd\2374R\237>I\247\311\336\361\177T\323~\277\371\020`aM\250\245\223\275\263M5-\272\356-f\246\223m-\263\"I+n-\346\3252\201\325\262\320"
+	.string	"\237\345\240\253\235\005\264\345"
+	.string	"w\236\207@\313"
+	.ascii	"~\226\201\330\362\017\320\262\360\\\376\340\231?\360g\331\307"
+	.ascii	"\226\325\236\345\324g\031m"
+	.string	"\313\266g\371\005\024p-\261\234\310\3517\346\245\272\343s\331\244N)w\376j\347\243]\215\277\306\2773\246\233\335\311O\243`\201\351Ri\350\202\373z&]\f\353P\"\267\374\362\302l\306?Kz\030\343/TU\217\312\307\2329$\326$>\030\n\026\222\376\345\210\240\007\363@\027\334\227\327\275L\bOyh}\312o\276\f\307\275p\247\331y\335{\337\205\371\207\203\371\367\32423qO\217t\345\201Z:EI\342i\343\365VP\243\2554\026w'#\265\234\016\031\226\262\331\361\232\343\341Gl\356)\347s\037\3564\252O\203:e\263\203\005\314y9c\204'\311;\231[\034\216\007\016O\356\275\030\342\376\346\003\210\020\366\311\020\352S\001\335mI\"\303\016\320_;Qln\354\255\331\247\233SubT\021\177\033\221A\210\235[\233\033\264\217v\024\213\020\273:\260&\026s\347\007V\312@\005\320\037\204\rl"
+	.ascii	"]\240-\352\352L\336(\275Pn\240\002\365\335\306\336<Y=\034l_\003"
+	.ascii	"\265z'\352J\330\276~\031\2278\233\023\275:rOf\336\3615(n\006"
+	.ascii	"w\357\023\006\025W\263\342\247\r\037\257{\237.\240y\032\026."
+	.ascii	"^\300P\237\n\373ewPG\256\016,m\333\006\354\242\3724s\214\237"
+	.ascii	"9\336\r\356\336{\201_\346f\212|\256\247\001FK\305\242\243\"\244"
+	.ascii	"\"QO\207Q\021\322Q:4c\351\210E\221\221Rq\306qH\343X,\201d<Z\""
+	.ascii	"B\302!\003\310D\023j\024\217\224\214\216D\343\021\021\351\250"
+	.ascii	"h\203H\244t$N\020b\343\r#%\342\222\321\250D\3741\233\336Z|\262"
+	.ascii	"\017\305%\233gA>R=\332}\\w}~?\255\252\315\035\232\332I)\354-"
+	.ascii	"\346u\326X\232\272\343\372L\373dw\220\226\247\356L\232%\317\340"
+	.ascii	"m\220.D\334\200hO\250\t \253\034\017\362\312\372;&\220X\326{"
+	.ascii	"\357O\367\250\334\325\201i\230\232\002\362\373\020\252'\325r"
+	.ascii	"y;\353Bn{\254|\275\305O\373P\233\\\363l}\234\177\355'|\254\211"
+	.ascii	":S\005\264PK1#\263\250B\303-w=\352\264\211{\262z\222\364z\213"
+	.ascii	"{gx\003:M\246,\265\376\250\016\373r\320{\357]{k\314\207=\240"
+	.ascii	"\237\026v\250q\034\304\224C\314\f\215\314\210$\005J\007P\002"
+	.ascii	"1\250\256l\003\021\320\271TD\345\314\001\255U\005@T\236\343\270"
+	.ascii	"d\273\017/\317\251*\215\354o\344;\030\340\236\255\006\240\316"
+	.ascii	"\334\276\377\266XNf\b\232R\364\177\323`a\252<\204M\024r\032."
+	.ascii	"\243\021\314\"\252\204\317\035\262\033=\215\303q\306\305\270"
+	.ascii	"\365\255a\030\020\017|j\256z\360\267\260\300@\222\r\222\265\226"
+	.ascii	"\026 -/\363\223\250\375\220\206\037P\356m_\300\345\374C\213\f"
+	.ascii	"\n?\003gH\213c)$\330\214\372\313\202\306_\201\306\023\261d38"
+	.ascii	"\362!Z\266q\317\247W\255\017OF\247\215\253\273aW\026m\035;`\343"
+	.ascii	"\355\326\005t\024\314\031\331\213P\367\007b\216\326+C\251\244"
+	.ascii	"\031\347Z'e\306\274\243%o\2619x\377B\341L\230\332\255mA\024="
+	.ascii	"\325\332]\306|\204\361\334X\202\224S\tEIC\"\006\240\035\366\f"
+	.ascii	"\345\007\322\300\352\360\007"
+	.text
+	.section	.gnu.lto_isSerialConfigValid.61.2283bfd2d72ef317,"e",@progbits
+	.string	"(\265/\375`\315\005\265&"
+	.string	"\212F\204\017Gp\336M:\353\353\266\374.`)\347\266q\260|P\200a\230]*\022\256Q\255s\300Pj\300\217\266x\364D\213\374^1\233mj\203V(\345\005\321\013\235\362=\315\017\001\217\277\260F1vkjM\332&D\356$\003\343"
+	.string	"\321"
+	.string	"\352"
+	.string	"g\236\342\2131\312O\245\220\252\322\233U\341,E2\335\344\ng\255\314G\236\312\324\303d\374\347\336\2561[\356M\031\360\201\363&\247\027\2627\317\003\331\233\017\"L1\325S#Y\367\342\"\222\271\335\233\376\272\b\237/\3233\257R\335\327\343\241;\335\231\263f\331\225\212_u_\251\300X\n\211\021k\257\314\335(\246\371Z1H9\241\r\316\217\227\t+\257"
+	.string	"\221-\256\243>-\342\216I\021H\325\225BYI\256\276V\374Q*\210\303\245\316\223/\300\244\350\243\236\237a|\256\264\360eG\326\327\212=\312z\204\255\r\325\"V[\032\031\303\344\370Z\021Hi\240\314\2206\303j\352x\351\323\242Q\"%_\261\264\254j\277\354\n\316\266 \337\204lq\275\346.\334{\271^im\235{\316\374$f\016\301ln\b\277b\346\016G\003\376\313\232{\255&\2508\226\247\363^+\tgT\310\340\313\214|\335\344\313\2607\223\372\311\233;\316\306\\\355\230Q\343\332\354\306\033\227\356#sZU\273+y\355pqw1\033P\372\225s\322\303\376\002fe$\263\362\021W6:\331\271\210h(W9"
+	.string	"W\026\262\225\203le [\031\200\255\374c+\373\330\312=\266\262\317\254\334\263\225y\2662j+\357\314\312:[\371\264\225s\266\2625+\233O\317\245\255\\\315\312?\260t\306\310\345\025\244\325\2447+\016\317%cvQ\362+?\331\237\276\231\315\370\311+0~\207E\335\026\033X\234{S\017\347\253\360\313\030\275\311\037\273\225\251\223q\332YU<\315\222S\342\334{5\2347\221\312\215\200H\223j\243\312\0238\266\217\374\344uhx\274)\225\232\313&\352\241\306Z\360\240\036@\344\310\230\2308\240\016\352\024y\206]\204nHc\026\200\006\352\021h\304\036?\355\323"
+	.ascii	"\232\002\331\320X\372\364O\213P\353i^\3734\023\332kX\021\242"
+	.ascii	"\345\353\236\376\251\365\332\307\340\357^7\310\203\366\331\274"
+	.ascii	"&\220\326>\260\244i\262k\264\023\240\321\365\256\276u\235\200"
+	.ascii	"l\b\327\265\317\316\251\r\227\344\300\324\336\3309\247Y\333\271"
+	.ascii	"\026\340\306l\333'\302-\370\333l+\007\213\226!\234\320\354\343"
+	.ascii	"\245,Q+u\324\231\235\241Qx3f\3105e\037y"
+	.string	"\311\036\235r\306\330X\325;\374/\331\367Qs%\366\020\3268~\327.\351\020\341\330\351^P\230s\304\270u\341\362\344\300\212\232\333\026*d\220\377\005\243\3159b\336\302\236\005\006\004#\367Z\005(\200'\240X\354b8\231\200\002\232.\240^\0041\270\210\n~`\321\342\211\247\242\311)\005\206 \b\024\300\023PA\f@\334\324`\005\t`\224S\213_\020\370\203\002\222x\3725E\265\3705\030\342 \013\247\250\237\213`0\352\207\246\367\335\305\027{\006673-\275\237\312>y\016lhfZr's#\243\256-4\372J\036Q\227\365R6@\227\220\262e\007XrRgLM\331\204\266\341\222^\037\031\375\201\236o<\222T\246\0275\026\227\350P_\354'\035\0367*c\025\365\341^\336{/\257\217Em\240_v\246\034jB5e\265\241\304\3250\203RY\241~\230OMjf\022M\365WB="
+	.string	"G\0242V]\305_\3023m;$\364\315\030\033\023\211t$^_pt}\344\247\375\250+\224\25263lf\200\001\363:\373x%0)8r`\036\024s\250Q(\303\fsH\251\021\031\221 \243m\306`\002\031\262\243n\020hi\322\fc\032\223\266\211\252\203\266\256\fB]\261\252\203\211\345\030Ci\177\275fh\230\033/\344\310J\206\213~$\302\265%\326\2610w\006\254`\346\227h\355\004\372\317\367\"\344\371z\347\023\035\332\311\342!\252\331S\265)\257i(\002y\020\031\276\213\235\212\241\335w(\277\375X\036[\214\370\361\031G\337\325\230"
+	.string	"\311,\016\344\240\016\030\332\035\334\342\3456\004"
+	.ascii	"\213\217r\031\320\0045;%tg\n\322\037k\2369\274\025\3501\205\340"
+	.ascii	"\371\313\035r\017\206rX,\273\202\321\002\301j\250k\275\277r\020"
+	.ascii	"8D\363\366s\210sx\225\t\306y\034_\315&y]m3\317|\205|x*<\031\225"
+	.ascii	"U\307\202\270f\253\242%\274\316\372\205\354,\340B\311\354\374"
+	.ascii	"\222\331Kt*\201\337\0275\177"
+	.text
+	.section	.gnu.lto_serialFindPortConfiguration.62.2283bfd2d72ef317,"e",@progbits
+	.string	"(\265/\375`I\002\005\024"
+	.string	"6'\211I\300\020)\035\373\034\225S\316!\343\3477>es\347q\212\275\312\fE\224j\260\035n\351\326\251\271\334\336\353\361\372\375\264U\247\016\364\356\364d\225Da\333\3066\266A\376]\257-\024\302 \313mO\275\253\350I#\233\310\235Rv"
+	.string	"m"
+	.string	"v"
+	.string	"F \236\036"
+	.string	"O\342%\\\\+@\352\324\264vr\304"
+	.string	"M\325J\272L~@x*^@x\272\037,\036$\357p\326\276\n)\270\263\346\277|\005\256dhb|\354b@\222\250\247\233\373n3\344\2619\205\360\242\314\3552\034\004\031\230\350\331\371\330]"
+	.ascii	"\367\247t\361\362S\267\303\315\275\357\263EUoihg\363\271*\251"
+	.ascii	"\265z\346v5\267x\333;\333%\366<\t\233s$\205a\2037\307f\211'\377"
+	.ascii	"\325\203\356\320\323\373\336=w\372\036\347!\247\242\036,\325"
+	.ascii	":\363\323QaP$\021\017\372{\237\366\355\003\371\245[~P\355\025"
+	.ascii	"\206\2065\263S\005U+\tr\352\005\342\177|\237[='\211/4b)\264\003"
+	.ascii	"\252\326\nrj\005\342\351m\027\273e{N\373>?\341r\262\005\fPq\036"
+	.ascii	"4\030\325Z\023\004!r6\224\350\362|)\034\247\r\227\265:\033\300"
+	.ascii	"\331h\200\313\363j\277\264\236\f\334\244\262-\341,Z\250\322o"
+	.ascii	"\252\326:\202t\224\002\240\306\257\247\350F\265\360\364K\225"
+	.ascii	"~8|\276\242\026\302\224\263m\341*PN\244Sk%9\265gO\221\322\200"
+	.ascii	"\251\326:\"\364!\025\037\304\251)\260\314\347N}\226\3604\334"
+	.ascii	"\227\007\251\212n\344ll\363\267\245\f\216\243]\236M\336f\261"
+	.ascii	"\225\027l\204\311^&\254\n1\230l\244\264\330\030a\\\221\305`\243"
+	.ascii	"\207MDN^#-\246\342\232\215.\331\370Bq\231\320T\\\"\004<\233\020"
+	.ascii	"\243\271Vf3\232\253e\3337\307Gq\0073teQx\242\277<K\n\307\td\355"
+	.ascii	"\356\272\304\2667\016\253\345\271uC\305\335\246\t\362\271:'\205"
+	.ascii	"s_\325k\302M\252\203\265\326\032\206|\256\270\367\235\216(z\202"
+	.ascii	"\351p\233\277\271\001$ @\002\203\230\274m\034\202\230>\003\335"
+	.ascii	"\335ld\tM4\277\034e\337\005lv\203\324[\272\206\202\220^\026\336"
+	.ascii	"\001\005=5\247\243\226\271\332\355\201[\2628\024\331\t\355\272"
+	.ascii	"\275\205\003,f\303,/\350\226\004\034'\333\222\311z\352n(\002"
+	.ascii	"\323\2622\301\021P\326\354\334\2535O"
+	.text
+	.section	.gnu.lto_doesConfigurationUsePort.63.2283bfd2d72ef317,"e",@progbits
+	.string	"(\265/\375`s\003\245\031"
+	.string	"Vo\245H\260\230M:q\021\215\247+\022\205\017y\311\242N\253\311-\213^\322\006V\023\\\035b\363<L\217\330{\334\330\376\365_\034\2517(\3279\334\216\372\203\316\203\367\205\b\204\310@5y\320\240\263\346\271\263\226\020B6\221;\245\225"
+	.string	"\206"
+	.string	"\223"
+	.ascii	"\225\205\023\037\265\326\0046\020\236\272|\300w\352\275\345;"
+	.ascii	"e\320@\346\232\223.x.\264\203\243\303J\255$k[8\274G\336t\326"
+	.ascii	"\\\f\301\217z;k\374\243\037`\322\211\270X\200\005\t\237\207."
+	.ascii	"3z|&\350\265\370\350\234\236\244\347\204\267r\242\361\363#\234"
+	.ascii	"\371y\340N\217\023\200\332\215\007!\312\223\237\353h\223\312"
+	.ascii	"(q\317\223PT\343\005\200\232\215\2678pC\276\373\324\251\335\314"
+	.ascii	"\275\3563H\324mI\256V\342\023\244"
+	.string	"Pk\365\314\251\221\270S\267}\263M\301^W\323\341\223n\320\323\337\221nz\243\337\373\246'\235\276j\365\004\204B\210g\227\220\225\247\314R\221\320\0371\216\364'\335\357\361$\177g\025\017\331s\034\311\327\335d\277\361\234iN\332\302\020\022 \242Z\253*\207\317C\307w\320\0347\363z\323#\362\274\210\202R+\371 <5\031\276\345\373\r\377f\225i\216\303L.6d\255IPz\"\262Rk}9\365\202\220\306V\235\336\226\331*\333s\332'z\221\354F!,\326?\236\270\0135_NW\347f\372\350>\352\006e3\261x\265\326J\275:]q\257;\235\241\364\344\006\210\006#\247J\223\267\266\3656vcb3\261\3709\303\334H\b\332T:(Bd\f0\245\254!\344Cf\2266\225W\214\236{\220\231\325S\216\314\201\274\276sQk\205p\372\2343\374\3078\341\251\326\352\300\307\2276\370C\247\356"
+	.string	"\233\317\201}\247\340~w\001%MI\316\304l\226\213\333\271\262\264k\263I\332\334\240%*#Px\203lo:%\202\001/\231\226kt\305\264`D\020/W\314Hc\257\021\303(\023\363r\215)\303(\340\320\032c\257\017,\330\310\212\031[\035X0\261\017,\005\004\f\363\360\212\261d`\260\030KE\316\276A\236\341\313'\270\372\374\326e\2664\317\375\3668Q\263Y~\342\332\274\006*le\330\372\276\257r\363\205\037i\205\276\020\r\257\260\326\272E\206\232\200\212\214f\263|\004\241\0356\300\265Uh\242\203S\242g\372wG\020\205\203[pS\253c\246\247\366Go\201rZ!EI\212omV\005D\250a0\242\020bL \023\210\005\"Vb\030\003P\0021\350\262\036\021\020>\024Q\215i\f\314"
+	.ascii	"\270\006\244!$\225\t\004*p\270y~\215nGJ\325,\325\332\351\177"
+	.ascii	"FaH\306Jp\024\307P_c+\331\232E\t\253\007_\322\352'\005\205\246"
+	.ascii	"%\246E6\347\212<\"\312\205\235Z(\0254\001\205~Hqd\245jS,|\216"
+	.ascii	"o\215\231\311\006<\377\233k\016\354\347[\237\277j\361\302\270"
+	.ascii	"\341>aO\272\003\001x\212\235\330\020B@\320s\316\025w{rQ\032\353"
+	.ascii	"5\376\013\177\177"
+	.text
+	.section	.gnu.lto_openSerialPort.64.2283bfd2d72ef317,"e",@progbits
+	.string	"(\265/\375`\306\005\025&"
+	.string	"\372Dd\017Hp\334Q:kCQ\021"
+	.string	"\206\030\204\020md[\020\202?\210e\271l+\365\356i\324\025\323\212{\002\0016\2743\330uU\007UeG-\311\374\257\221\356e\3465\314\334"
+	.string	"\230\215k\261(\261Y\374g\263\204\020B\366N2\335"
+	.string	"\325"
+	.string	"\345"
+	.string	"W\313\234[\007\rA\375\331\367v_\353V\226\336\3428\253\206EY-s\316\016\372\200\372\223\200y*?.5SP\213\345#U\253\202\302B'\347\266\327\355}\320\237\352\003\240?1\222Vo\266\357\3632}\247[s85EO\023_\246\376\360\273\nkeV\327eP3;\276\025\3611\365\365J\266j\310\315\231\r\326\212T\217\302R\231\001~\260\251\271\222\035rqo\262\272jJXZY\271\222\025b\256R\312+OM\013a\220\312\236\"\224y\032\253\\\035\354\005\242\260S\0275\323\036\254\232\236\342\223Y\301M\033\325\307\234\356\t\005\310M\363B\025)Iz\2129L\214\354\"{\331oT\361\351\342\217\375zisB\363*\002\371M5\344\234\373\022\213>\336=\357\276\332\335J\335'\206qvT5>\322\235\273\035\004\304\273\375s\262\267O\317m\001G\376"
+	.ascii	"\276\345\315\273\327\277\273\226_\367"
+	.string	",\377z\256?\267\273\215{\362\235\276\375\321\276\215u\267\357z\373\003(<\271\252Z\262\004\243\265Y*\217\235\\\346\364\342\344\311\237\354\337r\334\375>\230\223\365\313z\375\262t\261'\373c\035a\302\222\321\2714\213\254\265\253c\316y\275X\377\213\321\275\020=?\2618)\035g\313\"\243~\227^\177v\204\tF\017\013\022\030\266Y\312BV\332\221\216\f\365\347\273\227\372`\275v\367\026&3O\265\006\314\264\034\245\344\3342\370\331-\324\324\213\206\232\222\023\250\026\244\263\252WT\022\021g\026\245\263j\327\027\026\007\363\236\253\006\312\342\244\276\210X\300\310\033gU._\001P\031\210YXp\013\206\\\255\212\215\3357\320\343\263\331b\323(\216v\203B\377L\304\n5\347|\315\262\226WU\264\232n\236\367W\261\316\224\024\033\373c\357\220f\255+\354<\231\277\354#t\234A\205a\037\034\204\243\232\314\203\360\301\016"
+	.string	"\3316t;c\205bc\343\302\230@\370$\336\216:\333\026\233\034\267\216\231s\316'6>\210\246\030\b\177\354'U\326\234\247+\247&D9hLl\374\301(\026n\255\311q\353\364\223\255\342J\034\247\022\216\224\2343\0053+x\3106:g/\363$\021\372\363\007\237J8S\264\236\374\030\242\006X\304'\273S\334lE\006\2540\027\323\242\317\344g\273xqO|\201\376\364\3018\r1H\212\005\340\227\275\207l\333B\353\302\323t\363\340\256\036ob\030\033\273[\247\213\217\210\005\277$\337\020p\350\310'\204\263\361\033:\002\236I\302 \211\034\322\214`\372\033\n\032\231\277$\237\211!%_\f\225H\310\027\243\250\310\267\301\2060w\024\004&\t\035)\311P\205?\240\f`\322\321o\b\230k\241\007E>\240\360\207\324\013\002{G@\237QOH\210\324{"
+	.string	"\324\301\031?a/)\030\024\366\326\246\343#\335\003\306\003*L\307\363\240\246\325\025\246~\355\030\343\326\320\204\235v<\334\375\341o\230pA\320\274M\001\300\313\037\254\234s*\007\315\224\252\213\273A\234-\330\006F\b^\032\361\r\212/N\263\2349!p\343\032\243\373\t\222\226\2662\241<\374\255&W\334\316\254\t\272;\254\303+\316a\024w\2278qO\344a\374\305\3101O\341a\263\251X\231\3159+\370Qi\337\226\303{\207A;<\346\236"
+	.ascii	"\305]\311\0333ng\306\240\030\207\373\006k\250q,\245\210#\212"
+	.ascii	"\221!\031\221\2214-\034p\002\2219\254\016\021\240\305St\262\307"
+	.ascii	"\001\302\fj\354\"s\221\222\214\264<]\305\263\004\025x\274\177"
+	.ascii	"<\037\303\330\375\017*<\241\273\344\334Z\220\007C\206\275\016"
+	.ascii	"wTf\212\f\324%\032\22024s\276\021\270,\206\260Y\030f\375\023"
+	.ascii	"\366\214\272\351\3607x\215\013\250\371\252?m\343#\250h\3311\217"
+	.ascii	"\226\201\b\332\267e#\235\r\007\247'\276\261\227'D\216\203{a\256"
+	.ascii	"\343L\3112`'\202\203[\310\tx\345\350\373 \370r\231\253\247b\345"
+	.ascii	"\363\343\0368I\274>\316\204!P\327\356\t\327\334\274\376\365G"
+	.ascii	"\363-0\363\024\325\036v\266\341\007\273\273\225\327\006\326\002"
+	.ascii	"X\235&\267d\213\210B\204t\256\3047\013\346\252\3474/H\346G9\274"
+	.ascii	";\377\245Nz-\377j\336\037"
+	.text
+	.section	.gnu.lto_closeSerialPort.65.2283bfd2d72ef317,"e",@progbits
+	.string	"(\265/\375`=\003\235\030"
+	.string	"6-\240G\300\030Uc\020\250\021\314\322t\002\222\001A\241I7\266@!m\330"
+	.string	"\302\031}\021Z\257\276!\244\215{\324\252\3502\313\020d\371*u\347\\\333\034E\034\025G\034ML\311\315\274=\n\214Q,\254}\377-\267\224)\005\214"
+	.string	"\204"
+	.string	"\217"
+	.ascii	"D\367\232\f\234\200\274\265y\002\343-\371\001\343\255k6"
+	.string	"\226\233\276\373\241#\270 \244{o\252\3360y\321\274-\255\2354\215V\254\264\346\243t'N\"\260\321\002\306M\"\204\236\024C3:\234X\n\201\371\361\237#\360\261\003\203\216\242\211\305\316\224\031\335M\244\260%K\214\007m\324\366pqQ\264 $\b\216\031\035\216X\201N%\027\236\346\350n\264>xj$\006HE\250sqj\312p\3575\315\351Z\334\247\333\356\331\316`\327\r\001\246\215V^\221\027\0252\\y\266H-S\236\032u\241\373d\251\311\237\267x\237\277\002\230\300c'C\307\260R1\257\316\222\230{d\215x~\376B~\221\013\371B\227A\265\003\177\372A?\210P\233\335\264\207\236\243\335\357\336[\036\350\007\315N\304\346\367\266s\322A\221\244e\0029\363\201\\\336\372A\204\331\207\2308p\302\274:\025x\314\037\322\275\246\202[; o_\332>\265\377\273\220\332}h\027p/\317H\377\271"
+	.string	"`O\r.Pf\214\265\347S\023\261\2546G\235s,\300+84I\274\367^[{71\212\265\254\017\336\306\340\031\336v\266\035\271/Q\304\3323\252\326\032\003Z\301\241I\376\351\020OB\263O\224$ q\005"
+	.string	"R\nRt\243\2376\343-\252\332'Ja|~~h\263\300\227\373i\277~\304u\301w\357\245`\344C0?\307\255I\310\350s\262\361\366T\253\224\334\013\261\222\365\302[$\036%\27017t\251\236,\302\024\325\332\263\003\254\032\025M\213\346\245Z\235J\260h^-[\023\203u@y\325@\204\252\025c\311R\260V\352\325R\271R\253\230,\325\300\200a#X\261T\r\f\026K\225\346\315\214\373\246\332\310\332\263\375%\267C\374\210vz\341\005i5\332\252;Y\025}p\025\360a"
+	.ascii	"\342\333\375\272\370 F\233\365& \310{\257\004\237I\211V\200*"
+	.ascii	"9h\343\355\177N\177@h\354~]\f\\\201\203g\252=?x\rR\226\316\241"
+	.ascii	"=\321/<\007\024I\270a=U\231\232c\242\313\324< @\002b\220\223"
+	.ascii	"\354\355\314\223\004\366a}\033;\037\3536\277\325\344\224\235"
+	.ascii	"\371\263V\312\302\204\326\027\264\013\037\253X$=S\361\261B@\261"
+	.ascii	"\245\346;*j\001HL6\307\353\230]5D\006\215n'\\\343\243H\006\301"
+	.ascii	"\300C\345\205\f\003\207Dm\211\352\212\350(\261@o\3623(\025\037"
+	.ascii	"*\001\2179d\262\263e\"2\236\267\270-\227\234\376\233\251\303"
+	.ascii	"\005W\360o\226\270\333\241\252\271f\265\322\211K\245\200\033"
+	.ascii	";+\364\266S\312\301y\211\360\353\nd"
+	.text
+	.section	.gnu.lto_serialInit.66.2283bfd2d72ef317,"e",@progbits
+	.string	"(\265/\375`.\004E\033"
+	.string	"\0062\260H\260\326Qc%\300\257\002\343G\247T\247\023p\202\031C\270\215n\237\367\246\374.\234\373\377\330\f\330C\034\365 \325\270\222"
+	.string	"}\032\302\021C\303\033d\206;J\270\177\220"
+	.string	"\327\016\\c\2127\201W\244\032m\023)\267\224)\005\235"
+	.string	"\212"
+	.string	"\236"
+	.string	"\257\236\323\2260!w`\n\002\327\242\0022\2717X\343\006\344\253s\366\325\203H\367MW;\"X\356\2752J\303\344\307\340\r\233\271\273\300\310\227\255#\2359_\310\025p]\341\371~\3562\276X\364\244\274\330+\032gYXEA\0236c\b\306\311\004GCD\177\215\f\246bX\275\330#\032\013\030A\271\370\360s\205o7\355\213\327\027\237.\346S1\307Q\300T\f\253\027\237n|`\004\345\"\346\023\232\364\303W\033e\326\321\020\214\317\227\205{\257'\3177t\307n\273\210\355\r\366h\003\363<\317\247,R:\372c\362;\326W\372\322\216\237d\333\211y\336\253\177\302\276V%]=\254"
+	.string	"\315\322\016\376L\372\263?\313\322\3410\225a\313<\370\307\\x\303\3524Y\247_v\332\332\351:N\217u\232\326\3519N\177\300\001\250)\236\362\336\026\245\226+U\235n\\x\373C\374\241\320D\362\247G.5\225U\356\2754\257\316@\276>f\233N\373@\036$\367 \316\260{\217J#\367\336\032\317\310W\004\027`_\307\007\260\001\364G\245\316\323*\277c'\245\364:\243\240Y:jR\330Ni\213\350K\376\204\253qb\323\240\t\200+J=\254XJo\007S\245?\307\320\323\031\340\r!\025\241\3115\223p\034\275\030\351\3578\033C\r"
+	.string	"k\b\253\204&\227O\355\016W\202c@u\357\245@\2649\200t\357\235\275&\251[xZ\266\316\235<\220\367\n\315|#?\362a\004\021\302\206\260\257\247\037~\3141e\350\303\211.\261\330:B\r3\177\357'K\363\017yS\316\013\322\275@\347\371E\316\204\343'\275\232\226\223\343Z\211(h#xj\265\247v\301\306\301\347f\323\020`\004MG\304\r\017\006\037\022\266\236\030\343D\320\271\251\335h=2[M\306S\273\331\221\341\334zd\021\006\330f\202v\223\371\330l7Y,xOe\b9\371$J\n\210\006\271\320\237cE\244\f\245U\223\3460\272\202\274\211\026F\337\365\361\336{a\020\016\2432\364:\260\312\211\204$\257\236\374EI\253\027}-\021\253p\016\250\330,\240\342A\374\017&a\361\365\317XK\r"
+	.ascii	"\247\b\243`\312\262,~\306VjGZi\205-\254]W\024\034\004$(6\013"
+	.ascii	"\250\212#\215\355\230\266\200\330J\2501 d!\205\220Qf$\"\021!"
+	.ascii	"m\332\300\002\221\251*\017\021\360Di\212jj\265\031\bm1\201)\004"
+	.ascii	"\273|w\244\315\177Y\204\365#\314\177!\013eFKqt\202\232/\242t"
+	.ascii	"\330\222G\352l\324B%\t\345\024\0048b\253\340\324\030\244\200"
+	.ascii	"\232\247-\030\007\020\313\327\323jYU9+\341\245)\270\350\243l"
+	.ascii	"\341\006\200\3670\030\311r\266d\203\335K\226\262A\203\004\245"
+	.ascii	"\026Ti\2058\327\f\276_\t\2754e[\313\013\233?\r\311\252\206\241"
+	.ascii	"\303\001\315\243\222FgC\305w*\214\320\351\305[Z\232\214\225\006"
+	.text
+	.section	.gnu.lto_serialRemovePort.67.2283bfd2d72ef317,"e",@progbits
+	.string	"(\265/\375`\t\002\365\021"
+	.string	"V\242xG\340\360&\0352\335\214A\260\017X\242\f`\340\352\2710\177\264\342\030}\200\304\271\307\br|\033*\234\265\327\302\177\356\350\320\260\252\376'X\363\251\021c\2141\204`\332\272\310%\263\201\216\3614$d\310\022B\366\226;\245f"
+	.string	"_"
+	.string	"f"
+	.string	"\237~\3316.\343\331\327~h\212v\354\356\247\037\354]\312n.\276\336qSj|\371B'\300\203\006\013_\336\311\316\346&\206HH#O\230n\344|\366X\023\306D\356c\004\316\347\206KI\242\003C\203HxA\216,y\250\221\ne\242~v\222'$X\210\363\3309\330]GX\230\341\366n\373\306\266\211\035\033\004\266\354%\2360\315\370Xwl\220\007\375\250\017\335sF\313\031\2552:j\364C\004\334,\271j\273\030n<Vi\036\211\370\320\355\313\374\231S^\300\340\365!\227\267>\235Q\r\b\307\256\f\301\247\025x\237O\331~\264o\342'^\017r1j\267\203\255\305\356&\260\001\357s\300G\270Oy"
+	.string	"\\1\361f\237\305k.\277\307\020\300x\030\310}\252v4[\023\207\327]\270\025F*BH\330~t<\307\206TBj\314(\215\312\"\232!\023\235lG8\315\345\200\214\3355\261m\341)V\n\360\354\356\t\212\027\255\374\236OSh\305\303>\375\026\367\031\025\0254\365\372\331\247\316S\022M\017\230xS\232M\223\013\325X\025T*,\340d\251\300\007`\013\213J\005\374pJ\211\004\024\220\245j}+\360c\001QV\276\024V\353+\t\340\325\004\025\353kY\255X_J\266\327\035[\350^R\250\004\2431\235\306\234z1At\202\210\256\361b\b\"\0322\321\351\226\275\\\356\356r\032\273\213\233\n\242\007zB\212S\352\321a9~\273\213S\225\372\031\235& \200\002\242:\362\241\300\256\323J\330\243+\365\356cXL"
+	.ascii	"\325\354\263\345\\\005\023H\211\214\207\264\330\232\335\265,"
+	.ascii	"\033h\323\222\345\026\233\023>\256\005\251\331\177^\262o\323"
+	.ascii	"\016\244\005@\241\235P\037\267\267\230\225\363\302\304\026\035"
+	.ascii	"\367\362!\242w@\304\220\245\373\306\327\355\\\202\f"
+	.text
+	.section	.gnu.lto_serialGetAvailablePortCount.68.2283bfd2d72ef317,"e",@progbits
+	.string	"(\265/\375 \342U\006"
+	.string	"\302\013,3Pm\222\016\300\210,\t"
+	.string	")J\tK2"
+	.string	"\021N\243\344\325\330[\262\253\366\357\333\321\351\2357p\302~33Sdt\337Jx\240\b<\253\265\366\367\226)g.\t\030\312\322lZE\265\005\n\243\3202\326\246]\002\256\0304Vk\250*\253Y\262,\212\016\007>\b\361\345h\307u3v\340\\\261N\227C\351t\b@\361\271\322g\236C\213\357$Q\364\337\207\002\025#\017!\231\240\022)E&\220\321\337y\313\006\007\235\257f\030 \312\350#\302\243$3kx\321\253w\335nt\242A\"\301B\236^\005!3?,4\321\261\177\301O\360K\004\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_serialIsPortAvailable.69.2283bfd2d72ef317,"e",@progbits
+	.string	"(\265/\375`|\001\365\017"
+	.string	"F_nE\360\360$\035\376\366\313y^\234\036\003\367\251\221\216\200>\243\t\315\351N\035\034D\207\224\351\037\312\313N\342\217\bA.FGT\372\tV\350)\360\fl'\255&(\314FL\241,\013V\277\252\363\t!{K\231R\\"
+	.string	"S"
+	.string	"]"
+	.string	"\330\343\002\006+{\377vl\336\363\222\021R\332\3756\365`\355\360\273cz\307\"\324\364\374\226c0\253\3010\003\204\025\003G\222\2164\320\260^2\216\2709\204\r|H|"
+	.ascii	"a\301@m\271\212N\254\230\324\267\236E7\202h\f\261n\236\031\311"
+	.ascii	"\356:gX\031\356\354\266=\333\"\366M\004v\366\237\037s\032\036"
+	.ascii	"\350\326\230N\230\276\366\035HJI"
+	.string	"+\327\256M\023\217\215\021Y\364\034\350\366?\277\345\223\017\264\242\255\210l\350\325\002i\367C\360h\005\332\343\355\225}\262\235i\377\304}V\377a\361\307n\007\243\025\273\233\300\006\264G\002\027\200=\302\007\b+\230j\246/\301\364\212\301y\311\246\344\231\311!\003\252\2161M\355\202l\300\344\222\355\bw\261\034\250\261\273\"\266-\\\005J\201\235\335\035Iq\241\224\037\342\321\024T\371\231G_\205=\246~\374\250^\337z\304a*\222\351\341\222M\352\252\321A\244\252c\177-\2519D8.l\260\346\004\025P')\\\354P\034\004N%\005u\302\001\260I\210\204\022\256C\251\266\024\267\245p%(\233I\247\332B\00685\001\325m*\251T\267\235\276\275\346\370(\356\340\b\206\353\025}\017{\353\017\216^\270^\372{\030\204j\022\027}\341\200\251\216O.`\246\021D\232FK\236 #\230\\:\334\335\215\177\032"
+	.ascii	"W\bx\254\306)\275\006\322\224\272\356\204`\f\250\216`AD\305\262"
+	.ascii	"\341vq\366\266i\003M\0030\033u\241\013\202I\3064\255\333F\244"
+	.ascii	"\220gO{q)\240ZP\005\005O\331g*\022\257k\222\001"
+	.text
+	.section	.gnu.lto_waitForSerialPortToFinishTransmitting.70.2283bfd2d72ef317,"e",@progbits
+	.string	"(\265/\375`\236"
+	.string	"\205\n"
+	.string	"&\223G?0\305*\035\310#\220\177\344\205\374\023\373\202\333\237h~\032\224\t\214T#\215\b\302q\230\322!\32176A\302\243\3260\021\306\323\325\301!\003\243\032\250H\316\004\310\320\312/<\213\b\331[\246\0244"
+	.string	"4"
+	.string	"6"
+	.string	"R?_g\b\300\220tmbN(\223Mx\232\235Q\346z\353*\022\226t\242\244.\337\372L\231\301\3000u\305D\354\256\025\fG\356\355\266)lC\330\236\0051\315u\262\261}\265\257\362\225\357,\217'\354\252F"
+	.string	"\273\342\203\0352\327,~a\273\226\271\302v\315\237}\340\342j\377R \244%\301\356r\262\304S\277k3\340%\002\3545ww\2477\325\\c\26378\364\240\017`\001b&I\222.\257S(%\211-\222\264\263\032e\226*\373\254\177\252\372\230\006\001\004>^\273\250\005\n6#\257\223\320\370\303\251\360\204<\220\210\353B\334E\310c\301}<\021\307ap\207\001\362\270Q\327y\334F\334K\225'\006\304@dI\353\330.=\026\003&\035m\240S\332]\206>\023"
+	.ascii	"m\231'3\260\316#9\266N\\g\365\302\tc\007(\b\251\0200\217\202"
+	.ascii	"&\324\"\357\022@\263\232\022\334\213[\252T-\003\365\262I\230"
+	.ascii	"O"
+	.text
+	.section	.gnu.lto_serialEvaluateNonMspData.71.2283bfd2d72ef317,"e",@progbits
+	.string	"(\265/\375`#\001\035\r"
+	.string	"fXXB\020s\223\016\234\360\007\021k<\376\005\304"
+	.string	"\35339@\304"
+	.string	"b\026\274O\376\003\241\016o\375\374\233\032\302\253\213\373Y\357\377\307\023]k\004\240"
+	.string	"\302&\230\030\003\315Y"
+	.string	"~\363'\032\261[\333{K\231RD"
+	.string	"C"
+	.string	"E"
+	.string	"\231\335\343\233\212\375Kj\305%\265\273\225\246xv\370\234f\346\277\345\234\021)\345\220\304_\007\225t\"\256\256\201J\312\004"
+	.string	"\222\310udVt\274\345\371\201\244ej\"\354\256sD\nqkn\273\3046\004\3731\376\351\207\337~\347\322\347\220\260\340\310^vA\314"
+	.string	"Y\324\253\301\302\366Elk\332\f\034d\337P.`\265\034\036\026<\355\267\270\213\354'\016\037\260[\262\001\263\273)p\202\315\237\267\027\200\177\233\023\200\177\016\273\242\007\276\313e\224\370+\376l\022\363\243\b\377\256?\301\022\343\307)\2243N\223Pm\220\206\374\310\235\033AP\"M\361\016\230\023\nU\223\021\034\005:=\360\302\007\f\036\242\224\2617-\325d\337\355\356ZK\016\230\307\202\004\n\326\206\313\372XX\347\004\213\023B\374\031\271\340\2710\013T\305\253\302pyL\252\017\006\252F\f8f\260\260\352$F\254\022\331Bw\253\245ML\tTH5\030 \355\217u\0321#P\332S\223\235^I\\\3413\256M\031"
+	.ascii	"m\2317\023\372\216\006\366z-\016{\213v\231c-r0\211\303\352\355"
+	.ascii	"\310\361f\266\032aE\243Z\030Jb\\\260\342\032\033\025\306\005"
+	.ascii	"#\002T\024\340G\252\320$\320\016d\001\314\230R(("
+	.text
+	.section	.gnu.lto_nopConsumer.72.2283bfd2d72ef317,"e",@progbits
+	.string	"(\265/\375 \336%\006"
+	.string	"\222K+3`M\222\016@\343I\231\312;\2438\213\021#\022\005\004Qu\356\242\201P\303\203\307B\235|\013Z\326J\222\220\310\340\216Z\357\2213\240\213\332b\033!;\005\316\343\034\2427\232\007'AN\247=\251EH\016\242m`\247i\006~\022\034\330<\357\301\226\251\232,T@\301*\276\232\026\343\370\214\332v\026\372%\320\221B\345EI\213\321\302R\224\313\311\307\237\231\177\255W`\210\03121k7HL\332*\341\003\200\274\034_\205\340\323i\001D\303bd\245mc\036\031s\3053E2"
+	.string	"DM\2710\rm_ *#g\371\033\374\b\377'\007"
+	.ascii	"3\003\316\231\001\342\313\3552\236J\215\003wn\321\316'"
+	.text
+	.section	.gnu.lto_serialPassthrough.73.2283bfd2d72ef317,"e",@progbits
+	.string	"(\265/\375`x\003\375\026"
+	.string	"&\352\223I\260XQ:\360\"\235\035\2049ME(\336,&D\253\365\304\300\002\003\007c\227\201j\255\231Z\2315\256#\321\227\246\205\236(\264\n\341\363\205\205\367oc\373\033\376\004\023'\304\230%\017\212\005\032\f\013\336jB\310\336R&\031\200"
+	.string	"|"
+	.string	"\177"
+	.ascii	"\247[\236\006<\025\277\002Ow\266\213\345\345Q\255\331\321 \321"
+	.ascii	"\323Rkm\265\214\0257\354\331S#\352E\fA:\233g\373\235\212\247"
+	.ascii	"X\350\206\373\330\202\005\243n`\334\214\3762\017\374\232\262"
+	.ascii	"\\J\221\321\244!\252A\276\367\233\033E+X<\214\033\356!\312\246"
+	.ascii	"\342`\212S\241 \236(\336\023\001\025\034F*[m\256V\020\241\362"
+	.ascii	"\336y\3106\2029\204Pk]&m\267/\314w\327iw\037\354v\204\235\333"
+	.ascii	"}\322\327\346B\276\254+}g\236\364\307\034\351W\275\374\307\377"
+	.ascii	"\370QG\372R\312;'oS^\236\274\027\300%x<\261\235\214R+Q\227-\325"
+	.ascii	"\211\"\261q!\277\322\220\035\273*\373 \373\245M\355\002\006\263"
+	.ascii	"+}x\025\252\037r\354\232\374j-qN\327\201x\312\251\335$&\r\030"
+	.ascii	"\tD\r\200Z\343\315PP>\341\234w\337\343>f\377\021\3422\265\346"
+	.ascii	"\2140\325Z&X\003b\026v\370\344L\177\351\253%\037\216\027\027"
+	.ascii	"\370\216\361\256\300\364\274\370\344\373U|/\376Yk\255\342\217"
+	.ascii	"\236~La\353\n\220t3\374L\300A\2311m\323C\013\322\316\021x\352"
+	.ascii	"\315\360#\001\367dG\255\"N\356dU\323\036*\362\230~o\312l\335"
+	.ascii	"\226.\312\356\334\036\004\250\352\246\365\200\360\254\324\370"
+	.ascii	"iE\036/8\021\031\325\273\035\200\370\344\276\367\037Ii\342Tk"
+	.ascii	"\332nI\343\326\355\376J\212hl\256\353\310|z^1P\207\312|z^1*\303"
+	.ascii	"\300\243a\256+G\303\316+\306\003\324\202\275Z\033^;?-W\f\250"
+	.ascii	"\225\303Z\030\007\236XK\006\203\305Z\251p\337\271\331k\323\353"
+	.ascii	"J2\033\305\352\331!\357\304\221\221\325\037\362\025\223\257)"
+	.ascii	"\325\272\375yI\020\321n\354\\\323\273=\214\335\357]\346\347\363"
+	.ascii	"1+\rs/\355u\351\b\300\334c\357R\250\300'w@P\323v\246\271\303"
+	.ascii	"\030&\226\220\340\"\202\273\254LD\250q<\004\t2\310)\221h\322"
+	.ascii	"H\223t\320\002\0211\263\003\0200\313\204\250\2259\340\241\340"
+	.ascii	"\217bl\210\017\211\220\263\"\364\023\t\211\007\223 \270`\267"
+	.ascii	"\337\325\203\352\332 \310M\240P\027\221\317\211\273\322b<\326"
+	.ascii	"\352\2357d\365-\bq\204\257\016\220{>\353\032\265\263\231v\347"
+	.ascii	"\230\360\274\302\351\353\226f\207\320\240\251\336\253:\b1\345"
+	.ascii	"\250\227<(Jx\020\001\377\307\035\264\023V\362\254\366\032\233"
+	.ascii	"@\3673\223\267\215jlq%=\305z5"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2283bfd2d72ef317,"e",@progbits
+	.string	"(\265/\375`\235\003\005\020"
+	.string	"\324\026\231\004"
+	.string	""
+	.string	""
+	.string	"\002\310"
+	.string	"\177.\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\300\202\202\200\0060\177/\260\206\3618\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005)0\201\204\0011\1771\346\206\316\200+22\1773\234\211\365\321"
+	.string	"\0023\1774\005(\"\200\003\0024\17756\1776\252\333\3426\0055\033\005,77\1778\0028\1779\0029\177:<\177;\221\212\227\315"
+	.string	"\005:\034\002;\177<=\177=\234\367\200\311\002>\177>\002?\177?\300"
+	.string	"\177@\301"
+	.string	"\177A\302"
+	.string	"\177B\200*C\200\003\002\303"
+	.string	"\177D\002\304"
+	.string	"\177E\305"
+	.string	"\177F\306"
+	.string	"\177G\360\372\250\200\002\307"
+	.string	"\177H\311"
+	.string	"\177I\252\220\326\001\005/J\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005-K\005"
+	.string	"L\001\312"
+	.string	"\177M\377\037"
+	.string	""
+	.string	"\200\200\200\001\313"
+	.string	"\177N\314"
+	.string	"\177O\316"
+	.string	"\177P\315"
+	.string	"\177Q\320"
+	.string	"\177R\317"
+	.string	"\177S\323"
+	.string	"\177T\322"
+	.string	"\177U\321"
+	.string	"\177V\003\001\"$\003\t\"$\003\021\"$\003\021\017b\003\022#\361\344\203\254\001\001\244\017\003\025$\274\201\300+\001\344\007\003\027D\003\034&\221\205\327\307\003\001$\003\034%D\003\035(\240\276\320\347"
+	.string	"'\244\001\003\036\034\"B\003\036+\344\001\003\036*\320\360\372\250\001\001\244\006\003\036)\344\006\244\007\344\007\244\n\004\036\225\007\325\n"
+	.ascii	"C\2501\034\005]\207\212\024\245Pn\300\002\031\272\321\003\021"
+	.ascii	"\200\030O\031dH0\001I4\223A\017\335N\004 \277H\006\214\007\252"
+	.ascii	"\344HR1g&(\231\352&<\177\267\203\373\360\245cz\f\364\277\316"
+	.ascii	"\277+\373\3739\272\303|\3049\272%Ax&T\254\204E\347jp\342,#\302"
+	.ascii	"\207O=\223O|\371l\342\352\023,\265 \367+\207\300\271\246\325"
+	.ascii	"\342Z\235\257\331\347\256\235\371\257S\333\216;5\3538\027\033"
+	.ascii	"\315\244\367y\024c9&\234A|.\210*"
+	.text
+	.section	.gnu.lto_.refs.2283bfd2d72ef317,"e",@progbits
+	.string	"(\265/\375 \377\315\004"
+	.string	"bL\037 \240\247\220\016\377\377\377\377\377\377\377\377\377"
+	.string	"f\377\336\376\355\267\377\377\333\331\266\373\267M\b!R\246\263\016\2656\214\315\235\\\206>\354\005\005\316;\201\323\361r\227F \017\034?\367\n\342F_\307\021\367D\234\020\037\235\307\205\035\324\240\240\327\236V\202\316S\001\2768\037@\237\240^\337C\205\271\352\211\365\026\023\344\2527\366\305\372(\316*@A\364A_\252\351\354\205\227<x;\371?\004\t"
+	.ascii	"v\312BRWb6\330z-\rO\240E_\315F\311\271\236\372\226'"
+	.text
+	.section	.gnu.lto_.decls.2283bfd2d72ef317,"e",@progbits
+	.string	"(\265/\375`\0345%\334"
+	.string	":K\235IV JI;\215\001h\301[I\213\346\266\252M0\003)O:\364^\004\214\210"
+	.ascii	"\211h\356.\202\201Dp\017S\323D\250\276o\023\3726?l\244\016\023"
+	.ascii	"\317w]\3275\207\303U\\\363*KE\001m\2234I1\211 Ui\332\2426\311"
+	.ascii	"\270\205\303I\234\325\274\224R\246\341\003\231\004\255\004EX"
+	.ascii	"\236\310\251\330\305Lf2\301\245\265\251?&\302C.z0\260\320a}<"
+	.ascii	"\204\231Xh\006\312\\\021\022\326\270\211\235\267\005\201\203"
+	.ascii	"^\234\355\216\276\324\325`CLM\375\0051\254\0011\324\273-\034"
+	.ascii	"q\274\207[\002\213\304\260\256\331\002b&\260\256\211\245\245"
+	.ascii	"\003\325\311\244L\2130\203\232\226\351(\307\240 \206\352\"\f"
+	.ascii	"\302:\3602\305E\tr\251#\376\256\223;\315\\I04\367\260\334,\027"
+	.ascii	"\360\266\367\357\366\375^\2715\214\360w\325\370\246g\177\327"
+	.ascii	"\017p\272w\353\301\215\007\036\300\340\315\tR\251\372\030\252"
+	.ascii	"\016\241\3500\016\025\355\262]>\016\246\264\374a\275w3lK\232"
+	.ascii	"\332a}\374B\315\273x\367\356\332]+\267\312m\257\336\235\373"
+	.string	"\245\273T\256\333\275\235]\377\210\253w\247\\\262\314\225\244\2465\343\246{\357\337'uxP\332\210aRUF\270zW\3566\311\255\232:\344\0057\215\223r\341h\2266\2739w\007\335\273\375\325\372G\374\"\224p\365\256\364\302\345\026\272\233sk\006\230\373C\"\002\270w{\343AM\335\237X\033\215\376]\242^z=\fe\356\226\372\033D\375\325\241\376\312P\177\233\352\305\334n\224\333fp\337.B\t\317\313\256\2555\263\345\310\226\017\250\277\031\fo\341\315`x\035\365jP\256\207\341)\240\016\357\332]r\333\016.\223\337\264{v\027f\273\333\275\333\032\314C\313\230\027\326\207\200\372\333\3010\027\026\336\016\206GA\305\322\313ahs=\230\225\275$)\302\244\206\365o\331\025\273d\030jo\347\336\233\002\0326\272\256\244;v\243aV\203X\177\003\025\357\353a\370\341r\030\336\257\021\277`\034\206I\317v\327"
+	.string	"\340\214m\rk\342\3450Dr\265\256W&2\202\332b{\267\0334\233\222^\037\3267\311Ur\333\353\365_\256\333u\335\005\265\243{\357\231\230)51&\326\037\256\207\241\376\326i\242\366.\341X]\261\367\336\304{\266\341\333\353a\250^\016\303\377\362\374\027P\350\307>A\270\003N\334\374\357\224\3772\365}\376\363\3751\212%\336xg\004\2015\374\370\002\"\3701N\b\374\252\\\2412\325\177\236\202\301g\376\034\345\rS0\301\237\323L\234\270\315\237\277^\3002Lp_\\\342r\022\r\330x\254I\375\370\205\017\334\344\3317\374\271F\036\246\201"
+	.string	"_9\212Y\340\025a\247\3713R\273\304\372\377\362g h\207?\027\257n"
+	.string	"\260\007\b\020\363\233?{\250\200\003\376{\363\366\230?\223\270\372\347\022\376\033\003\2538\221\364\037\346\317\034\374\307\362\337\357\377\335\253\374\307\373o\367\277.\357\177\377\371\376\267\300@?v\201\375\337\365\n\376\\\363\343\020?\036\361\343\020~\f\302\217?\370\261\210\037\217\200o~\\\200\037\203\300\312\3775\2776\376W\006\b\377u\361g\n~\234\374\361\361\307\034\3701\317\217s~\274\201\037c\340\307\022\3701\f?n\300\217O\370\261\t?&\341\307\377\257\337\177\257\374w\372_\275\377V\371\257\335\177\345\376\033\367_\266\377\256\375\367\354\277a\377\375\372o\373\337\254\377B\377{\365\337\036\377\235\372/\216\3776\375\227\351\277K\377-\372\357\320\177\367\177\213\377\245\300\177\177\376\013\202\377^\340\277\033\374\267\347\377\336\177-\370\037\370\337\017\374\227\305\177U\374\327"
+	.ascii	"\377=\300\177K\374W\371\337\016\374\327\347\277.\3775\376\177"
+	.ascii	"\373\337\301\377\261\377L\376\033\363_\235\377\346\374\027\305"
+	.ascii	"\1775\360\337\n\3747\003\377\305\300\177-\360\337\016\376+\200"
+	.ascii	"\377j\360"
+	.string	"\337\017\377\275\340\277\304\377Z\376\023\376\037\374/\370\277\354\277\327\377\t\374\217\362\037\203\302\302\302\302_}\300\257*\375\034\210\b\033\202\226?t\304\270m\216\221\231`\232gON\200\332H\333\220\213,\343\205\371'v\025\324vx\032ya\343\350(/\021\203|8\201P\233VC\323\027\317KYI\306\214\212\260\t\353\234\024\243\307cm\n\353\253K\031\t\013\r\343\220\b\005\267\250\277Gnn\321\346\026\271\350\205H\023\026Nw\222\323\007\304@\032:\236\331\005f\301\210\207\215\226\310\305\247\326\344\216yf\036R\367\336\327\353\355\t\242\006\211t\316\211\320\363P\346\341\"\211Q\016z\251\221\224G\207\203\262\263':\205\022\270U\242)\277gn\336\276\031&\241\254\2605\365x\013.|\336yc\273\373\334\313>\022\200<\2371@\234\370\245\376w\270\231I{\357%\227v'5e\206\327\345^\020\377\314\315w\203\r"
+	.ascii	"\021\354\275\374\203\372\251B\322\2305\376a\337E\272\2673j\251"
+	.ascii	"B\224\2223j\006Q4j/\235W\313\rI;jI\024\335{\303v:\227\013\200"
+	.ascii	"\332\033\210\242[i\007\311)\335\335F-\267\023jo\330\316\315\374"
+	.ascii	"@\344\214R\"\2122\2256\020E\243\224v4j\333l'3\251\205s'm\330"
+	.ascii	"\321\250\276\035\205R\262!\212B)\021E\243n\\3\242\301,\245,P"
+	.ascii	")+wI\344\334/\216\234\230I6R\242\026j\337\355}\305\204v\322\006"
+	.ascii	"{;A%\3351g\\\265\246\364E\323\214\tU\301QS\nj;\245DC\240\366"
+	.ascii	"\036\322\344\331G$,[\351\266\272\322e\016\247m$\264\267\005G"
+	.ascii	"{/\357\226\356\275\227{ob\222S\273w\223\r\021\364\350h\357\347"
+	.ascii	"\315\321vZ\256\t\355\215\305\360\324\224\210\242RP#\326\300\242"
+	.ascii	"\320=\324./t\337E%\251\321%\3276\252A\205*\301\270\342\326\326"
+	.ascii	"\032\341m5\007u\246\302\232`}\342\214\300\333\342@,W\242\335"
+	.ascii	"KV\313\223\023 \261\251\342?\214\263`\300\343?\214E\306\331\342"
+	.ascii	"?\2757\363^\rh\356\325\300\205\315\007\323k\250?\324\342\207"
+	.ascii	"k\300\342#,J\rS\312\t\204\217\017\367\335\354l\367\366\344\204"
+	.ascii	"5u\371\032\243\203\233\242~\030\226\327\342<\254w\333\215\304"
+	.ascii	"a\350ER\322\007Vn{C\203\244\257G\022\036\352\207JxU\332\246/"
+	.ascii	"\372"
+	.string	"\260\306wz,\b\355\t\326\0372\353n\213\355\\\220,ig\300\271He\261\222\206u\333\306\250\335\030\213Aw\377j\230\242Z\200\314\311\311\304\031I\303\2025\226\373\261\024O\3015dj\354f\214\331\300Z\335[J\330\260\352\253\017,\316\205\227[\026\023\356oD\202\250\224`\335\324\232\251k\320v0\212\333\f\023 5$\271\265!qr\365\207uR\226\361\025E\303:F\020,D\363\262wTaW\217\"-\036FTv`!\032\247\315vJ\035A\273\206\020.\243x\f\311\013\t\b\021\021\214\345D\020\307\020\202\205\256Tl\001Z[\246L0\033v\202\237`3\\\206\227`(X\r7\301k\230\f\243\341\263\333\3424\374\342\270\013{\375F+\355NA@\026`\022\314\205A\223\310\205\347\036\266\362\201\205\302\274\\L\323\360\025\206\026\315\265H\303G\260\026\215\263\335J0HI|M\036\f\233h^D"
+	.ascii	"\240\261X\020#-$fj\030\030[\331\262\352\353\030\354{2\030d\270"
+	.ascii	"\035B\242X\037\313m\242\267\204<\251\270T\335\212q\341V\214\313"
+	.ascii	"\n"
+	.ascii	"^\033\304.\355\007\326[X\211\222\271*7\250z\027\253,\214\244"
+	.ascii	"\346\357\310\257\356F\026\rlDf\310\022\322UQ\021\227\246z-\250"
+	.ascii	"^\353\251\327R\365\372\t\364\007\364G\227\036\326\322\032\231"
+	.ascii	"-H\346p`}\215\246^s\251\327C\324k\035\352u\223\032\002\256\242"
+	.ascii	"\212a\342\346\207\205\352J\237;\333i=9a\351\270-\246\302SZ9\266"
+	.ascii	"0\331\222Cj'I\205`\275\327~A\007\263\242.\337\260\351\212\r."
+	.ascii	"\034O4c\202M\254?\002~\3026\332\215D\324Q\364\344\004u[\374\204"
+	.ascii	"o\\\204\022\266\0077\231\207\020!C\264~&S\237[\247\0320\201Z"
+	.ascii	"rP\260n\212)\303\202\264\343J\375\245R6\335\033\323\30030\323"
+	.ascii	"m\361\023\3038\216\201e\374\246\335\333L\013?q\013l\204\346E"
+	.ascii	"\366\304Gx\351\004\241\244\027\027sc5Bo`~\252\2766\331iI)Cy\021"
+	.ascii	"\205\007\326I\272\251\254I\033\222\212\221\360\213\177\357-s"
+	.ascii	"c\252)3\325\343?\\D\223%XE\352\230Xk\261\353\260'\334\222)\230"
+	.ascii	"\016\373_`\204LE\215\240\251\007A\355bRR\302ZG\257\207\207\350"
+	.ascii	"\031\365a\255\275\316&\363\264\003\324\241\273\342\244\346\232"
+	.ascii	"X\353-\335\336\366Q4\327i\226\f\215E\tS?\202\373(C\255u\235d"
+	.ascii	"\311\215\251\250-$\377\013\221\254\256\0064K=\215\020\254\333"
+	.ascii	"j,,\244\202\330f*\201`\303q\245\t\340N\202\362\301\006\037R#"
+	.ascii	"X\237\206YD\027\271\202\332i\263\267\224\233\332\013\021\024"
+	.ascii	"<\260\251f^\307\270\255f\352!\231\350\271al \345\346\364\201"
+	.ascii	"\214\240\224;6\254\205\020\213h\224\211\315\251\277Z34\215\273"
+	.ascii	"\030M\372\251%\305\206~*\362\206"
+	.string	"C[]\351\323f;\321\254L}\350\032\372I\263\334\260w\2168\350\017\035D\003\321W\272\207\206\336V\373\320P\32724\323\231\366\241\235n\223+\255RA\013.\246\016\313\017)\215\236q=\f\232D%\224\340i+\035\245\253\256\364\331\356\245\2303 y\204;4\217\333j+1\017*\230\031\254\002\250dX\245u\250\271\2501\204\265\246\212F)\312\021$\307m\365T\315P\020-WXk\251\353\265X\272(:\233\2145$p?\324\317X\251\237qR\365\r\225\312\324\306\f\223\372\231%\3653G\352g\202\324\317l\365\3274\364\323%\352\346\027\247\237pspFMB\025\203\270\034\206:I/i\030YjTe~\352\265\022\f;\244\224a\255\357\331\206\372\3055R\224\037\320#>\365\332H\037\335]\215q\331\251\327Ee\205~4\260\326.T!\231\266\016`l\240=\325\300\372\332\305\257\235:H\267\330"
+	.string	"\r\205zH\023]\267\320B[\267 \001jo\246nQC\2707\263\346^\r\356\325@gI\375 \033\352\3134Q\177w=\fg\350F\\7c\342\234L\267\224\f\016\352\215"
+	.ascii	" ;\240\373\211\005\302\345\310\210\235X\341\365&\006Q\2657\260"
+	.ascii	"\316[~T\245M\261\316Z\360\322\025\034\337\023\326\231\020\343"
+	.ascii	"\r\235s_m\030\217\206\t\\\324\221\036Y\262\344@>@h\231\231\332"
+	.ascii	"\016\300\347@*\200\204-\260\316\177x\t\363h2C\310e`\370\371e"
+	.ascii	"95\255\nL\235\221>0\275+W2[\211\037iu9\212\350=\341\343\313S"
+	.ascii	"\t\300~\220M\337\372`Da\235\247\027.\246\212\022V\022$yyY/\r"
+	.ascii	"\013\306G\227`\235\225g=b\226\324\032\215\035j\256r\341`\232"
+	.ascii	"e\355\007\217i\242\243\313Yo\357\311\t\213\002\260!\322\272g"
+	.ascii	";\2304,%T\360\037\231\331S4\006I*\315r\367\f-k\351\250\341d\312"
+	.ascii	"\263\334\367`\250j,\265`\n\237<\311qj\236\323\223\023 q/\357"
+	.ascii	"\305\020\270\347\270\036vrO\260\316o\227\354e\350\210\221#\254"
+	.ascii	"s\024l\204\361\266\316z`\235\335\360\230f:\207\340\260\316mX"
+	.ascii	"\250F\353\306\022(X\353\016\252\325\265\300X\031\314\212\212"
+	.ascii	"\222)\023&\231\255\004\217\0270^L\254\252\232<\263\275D\351|"
+	.ascii	",\237\244\245\345\265\022K\253A\231A\264\2766\265\3475h\016\300"
+	.ascii	"!\030$cc\371L\335VN\270Ix\225f\366|\346R\326\306\004\255\f\347"
+	.ascii	"\361\315\240\313e\231\214N\212\r-\265j\b\022\r\035aa\371\313"
+	.ascii	".\016*E:\b\263\324\325\225\277\360\336avz\323\241PZ\017\302\350"
+	.ascii	"\363\327R\223\346\0229\254\263W\240\226VnK,u\244\345\265.\260"
+	.ascii	"\252\255\347\026\377\305\301\r\266a\235\225d\"3Q;0(X\347$\267"
+	.ascii	"\t\235\235VU]\220 9\253\304&\332m\241\260\205*\257\310s\326\021"
+	.ascii	"5\254\352\210\235\221\2145\244\263Z\303\203b$\013\311D\204L\247"
+	.ascii	"\3222\221<D\352\306\024\265\327V \346\246\344\005\205\346\036"
+	.ascii	"\352\362)f\212f\345j\307\325o\233\257\256\240\nb{+\t\300\313"
+	.ascii	"\355\371\001\356#\373sb\322\241#\367\210\321\361|r\002\234\t"
+	.ascii	"\273\"\006W\365\334#\363\370+Z\253\303:\357x3+\242\262'3\265"
+	.ascii	"\245\215\317\352\316]\240Gt\206\215d\316\246\200\235a\375\227"
+	.ascii	"\245\224T\236z\331I\231\n\337\223\023\326\0070\2746\307\363\024"
+	.ascii	"\002\2068\213\340%i\226,bvNw\3128$\330P{C\211eAQ\2464HrF\\6\236"
+	.ascii	"qd\250{E\211\240\024\250\374\024\245\261e\254\t\207Ii\320\270"
+	.ascii	"\201a\300\230\241\335\310\n{>s\323\235\032\313d3^\034\321xn:"
+	.ascii	"\333\314\024*KD\227,;G#k,N@\271\262,VXa\242\203Nq5\301\032\223"
+	.ascii	"\023\2109O\bcO\216\210\234\024\035\222+{d\301\330\223\243\236"
+	.ascii	"'\304\252SD\366\260H\344\n\310\023J\n\316\023\302\002\026\305"
+	.ascii	"\236U\307\205\005\373\343\303\302\0059,\316q\375\201\300O\316"
+	.ascii	"\211\363\204\320@g]ab\206\234\225\207\204\005\347\t\301*E\254"
+	.ascii	":@=9G\243\210\244\022H\304\004==@\307#\362Hdq\206\036@\036\211"
+	.ascii	")\212k\217fW\245\317\3523<O\210\007\234p!\006\021\354\272\223"
+	.ascii	",\262\037f\310A\366\220X\223H\0225,~\220$p\316\023\342\007\b"
+	.ascii	"\231\334\301\361)&\213?\"r\006\220s\004\2129\246\300I\027%\216"
+	.ascii	"\f\213s\334\371q9\356\374\344\225\006\243R+\225kRG\247Hd\361"
+	.ascii	"\203\314\321I\366'\353\254\307\035cO\221\250\263*\201\364\252"
+	.ascii	"$>\211\263\363\023bF\263H\262J\343\316j\302\003\317\016\0202"
+	.ascii	"\311\303*\225\305\"[\\\300\217\362\205#\022\206\225-\002\365"
+	.ascii	"\024U\260\260s4\262\254\321Gy,&O\360(\215Gc\013\310\023Id\013"
+	.ascii	"\254\261\350\001\016\224.\260G\240\036cQ\205\002\330\225\001"
+	.ascii	"*\220>6\354\021\bI\242\2065\036]X\225\310\236\234\232\343\372"
+	.ascii	"\203\244Q\312\240\\\221:7\305$P\004t\216\306\026.\3201\366\024"
+	.ascii	"%\300\241\203\316\2524J\260\342\354\034\215\353\321\350\223\\"
+	.ascii	"\331U\247\003\273b\205\341\306ge\225,b\300\341\320\241\002\026"
+	.ascii	"+\004@\371\262\342\300\254\360\0034\003\022\331\303A\351a\307"
+	.ascii	"\230\002\347\330\002\273*W\023;?\023\374 \2171\3171&\327\343"
+	.ascii	"\272\243\236\004\023@0\341\204\025\304\237\220B\b)\2040\374\t"
+	.ascii	")\214\030\221\202\t#\324\2330\"\2638\312\027V\037#\253\262J\343"
+	.ascii	"\0038\364 \221+\340\270\260\025\260\025$W\037 \345y\224\311U"
+	.ascii	"\2051\251\203A\222\215\300\252\302\270\346\254&nf\310)\242\350"
+	.ascii	"\351)"
+	.string	"\222X\221\204\221\200\315\332\203\242xB\305p\305Yu\220/\300\254:H\037\275\342@`F\371\203$\256l\321\204\272\322`\214Ae\325\244\214Nq-\321c,\236H\256)R"
+	.ascii	"\255\260\202\225Y\223E\236\347(\331\030b\3209\032S\\\300*\213"
+	.ascii	"=/\254\022g\335)*e\330\300*qd`V\234\026:\250,\216\b#\260\311"
+	.ascii	"\225\315)&\213<98,\022\211bM\332\320\260\347\241\340\310\237"
+	.string	"5)\202E\"\223\"bX$\331\325g\355YY\n\2248\022\314\240,\276pD\032\331\234#P\n\031#\314\217\322g\203\362gg\003\213s\002q\305\252stA\007\250\210\002g\005\022\305\f9\305\036\024\023(w\214)\216H\022l\022\371\023\303\342\2300\202=\032\201T\032x\2228+[\324\371\001\302\361\260\342$Wc\n#{\\u\\`\223\310\bLp\024P \361A\006\030\030\240\346\204\350)\032\223\253R\004\322(\342h,\372\210\310I*E\204\230`(\007b\271a\204JhO\204:\350\221K\320\025\230\247\226+8\027'\266\243\001t\243\322\302\245\231\345\246\366\336\240.L=7F\243J\n\353VK\006\t\211\007\024v\331w/\334P\253\241\360-\220-F\240\336\242\245\355\226#yZ\213v\322\027\315\321F\250\3218@\006\255\303\032K\305\364\335h\315\004\363\327\234\215;\032\201}\304#[S\320"
+	.ascii	"\261\336\314\026\023\216\027\177L9.\317\311V\226\\t\377\226\222"
+	.ascii	"(\301\242\311\244[\205V~yh\na\225\034\326\323\251\276\342\005"
+	.ascii	"8}9\302\301\325\324w}EHfj\256\207\224\026+V\364^\bw\017\201I"
+	.string	"\rNs\026\244!3\264\336\365^\214\266.*\033<\274\034\230\200)_\223\376\233\002D\255\216\n\025}w\003\225\355\242\250\226`\271x\261\031\311\260\273\276\323U\202Z\300\250\203\251\303\033\224\342:\214D\f\022t\213\212\311\311\351\271\033\250\234\267$U\004K}\013$\nr[=w\271!WdX\337\006F\\\234\226\3360\245\302)M\225\275\270&-\345Z\212\0274&FH\343\306\245Dw\005\n\024\375\2665\345k\272C\373\322Q\256\337\324\230v\240\271\265\313\275\347\246\333^\256X\311s\3224k@u8QS\323N\210z8\006\335\256\025!*B\315v\355D\253\211-\016k\335\344l\352\0177&\024\326\232\211^\242\327jv\230\375f\032\355vm\244\016@\270\004\241\200{?A\304\024\201.\357\364\3315Z\315\323\255\355\b\2216\277<(=\365Y\327Jt\226&\313u2{\331\265\221\210imY\336"
+	.string	"7\321\023D\fW\021\327\024\374uMv=&B\t\327\013\204\237\250\003\303\343qd\276\345\220b\f\311\bi\222$\215\001\023\025@@HL.\032\355\313\226\017\023"
+	.string	"\224\307\363\271\226g\025cJDF\222\244\220v\003\020\374M\331\274p,\211%\327>\221\224#\320\236\315\305\356(i\303\300\003\031\363\333/d!\331\243\3024\f\211)\242\007\317\266f$\374;\357\032-\016\350\251t\260R\254\027\273r0\371\177\240|M,\006\250';W\325\177\024\177)T\202\223 \356q$\227\230\r\034k`\354\f\303~"
+	.string	"n\255\003\244Q\367*\311\226@\230?\245)\321\354\031\321\265:\223W\367\202\220\220\270\007yp\0268\034\036\224\rb\222\323\301\343`\021i\353\311\223\022\232F\340A\372X&;_B\021\323Z\254\300\207\227\324\023\333\254e\335N(\237h/\231\344C!Z-\0336;>b]`\334\323\2568\251\013\202-%c\374\270)\231Q\263?\303\360D\233/\226`Y#\303\344\316\005\235v\356\306\337\206\330\325?\265u\3446\003:09:\262\245\353J\217!\366\374\272o\026"
+	.string	"\242\031\243\374qP\304\270\340\327\332\367>\262Q\277\322v\b"
+	.ascii	"`\240\2758\t)GFs\270\267\250\366\004Usuz/\0257'\3304O\203\227"
+	.ascii	"\303\267R\227/WV\f\033\360\240\3636\024\321#s5\264\252\201\300"
+	.ascii	",x\334\t\313S\342R\322\344\212\334Y(\f#0\360\004\202\n\276\276"
+	.ascii	"T\237X\r\370S\207m\225#\330\364\353\217E\n/\276r\020b\246\366"
+	.ascii	"+(W\335\330\252\207P\355\3221c9\202\221\006\020\321\316q\030"
+	.ascii	"\335\033V\252o\005\376\373\035f\001q7\017\224\2567C\272\242\304"
+	.ascii	"\035q\212\235\303\373\005\235\b\275hD\260\005\261>\207\177\317"
+	.ascii	"\rD|\313\247C'\321{\340\376h\306\370\250\002\277\370vw\021\206"
+	.ascii	"\204\252O\264]\271\253\260\263\273e\365Z\226\035\336\202\234"
+	.ascii	"\264\206\275\350\304\344\233\214\317\314\210uX\231\353\0347g"
+	.ascii	"6\035\300\240\264\213\246\002^\fu\017Q\311\346\352K&\347\300"
+	.ascii	"\265\346h\035\330\313\375j\276\267l!\030\230\250\032\332\024"
+	.ascii	"\267W \204\334\016^\r?\216SGd\366\271\340M\f=}\327\271\013I\227"
+	.ascii	"@\fY\250\364Io\026\0172\352oN\342\237pd\321!(\271x\002aE\001"
+	.ascii	"d\370\t\023:\241\310\312\322\200k\034S\335\255\f\337(\254\351"
+	.ascii	"\324\235\201\233D\336\225\271\002\017\3028d!7\327\022\266\fP"
+	.ascii	"\206\3416ph-\261\334\032\366\3303\210\217\345\345'\276\310\211"
+	.ascii	"\274:96{\034\226\374\356\351\266\253e\252\024\354i\274\270~\265"
+	.ascii	"\355\013~}\260]\336\220\235\213\353E\301Rx,\336\365za\316\225"
+	.ascii	"\201\002;B\325\007\210\322\210\035\024-\346\300\3608qD\355\211"
+	.ascii	"\307\240\341\035\322\036\342+\274m"
+	.string	"\275\205\356C\255\202\255\231\r\312\352\350d\261\225\331\b\306\260\bx\270$\244\003;/\240B@\357:N\031.\211o\0024T\205[]\223\300`\330%95#\200\203?=\233\013Q\004X\262\274\253\215\300F\313\205\263e\301f\214\374\307u\016y\372F\0130\033\216\237(\222\326\337g#\0174\337.\003\315\233\206\271\240k\225\263i\007\221\371\277\021Yt\232\247\002\234\031\254\\r\2032\021\024\374\t\022\017\225\201\341\342\016\026ri%-2-!\205B\244G\331\271\233\273\364\326\002\223\377\026\357\304\351t\200\355T\315`qC\237\230i\236@\327\222\340\034w\252F\246\223#\377\345fg_w\262^\034\220?@\276\225uF\220\333K8@\027\345\362t\322}3\276<X\312\005S#'d\363/'*\201\211H.\032\262\007L\357kh\004\242\241v\332\263p$\356\346\227\252\315\233\313\221\3617\220d\377\\!"
+	.string	"6q\366\2502+%\3509qb\366\004\225\3736\200MoTw7\2704\331\017\277\304u\240\017:\336\375\225\274\353\305\331\256QU\231\307\276Uhp\222yI.\317\023\360R\032\034\034\265\242\231\331$^\034\317n\\\354B\226\211m\035\253\r\021m\373\316S@&\373$y\330\017\222?\305\020\264\215U\272p\330\rs\377\274\242\316\342m\007\371\f\233-\272z\215d\030D\030p\333.\320\262C*f\302\001\232\237\255\347\016\314O\nc\346\232\243\2675,\034w24\243f\363\004\n\346\030\214\233\302\016\256\022,3:,\237&+7\026p\366\355l'Tl\034-\036\214\376q\370\031#\261kx"
+	.ascii	"_\255 \\l\351\331\203\031\001W\021U\036\020`\336\312\031\367"
+	.ascii	"\316\265W\013imO\005U\272\263p\302,tn\347\240\266\307#\253\251"
+	.ascii	"\260\3571F(\366O\324\272\2765\245\341d\351\261\177]\230\031%"
+	.ascii	"\233*+\3526-\374\316\352?kx\021\247B\331"
+	.string	"\031\273P\203\231vQn\276\236]\003[\312-\200'/\375_\265\263(\001\375\3639\312\212\007\005\267\326?{\2002\317I\346\276\304\3611\005KBX\020\207]|N\320%5\377_\256\264\305\363\212\022\213\224i{k{b\372\272\304F\1771\275g\2779\343\235lz\340\357\234d.\357\307\222(o8e\255\177\222\035\242\316Z2\302}\t5\273\026\305^\031\214\033|a4\264\212\020\253\270\315B\306F\240"
+	.ascii	"\232JD\305\371\032_\0365=E\002\bw\216GXc\376\200\r\332v\332\375"
+	.ascii	"\260bN\370\221\\\313\201\3534\311\322i\226\373\222\3402\345m"
+	.ascii	"\333\n"
+	.string	"K\223\343\364\272\036\346\032\026\3744\330M\222\340c\002\252\223t\366\233\242\314O\nbe\300\245\215%\345\r\265\315\n\255\0307\006E\260\3216{\225\367QD\221\301\022)_\255$\n\020\007\320)!\003\016\374\020@C\3603\030\204u\344\034\003\356d\037\336\177\002\367\224\246Y\273[\230\031T\333\336\245\013\251\345e-\336\355\220\007\374@\275\2079\273 \307\246W\320\326\035\215(V\025a\234\007@\"\225%\275@\301\313`%5\375\233{\027\001(JF\007\301_i\207Bk]\363%PR\2664\"\245ge\207\356\001\206\205#\n\f\354dj\237\347O[\307c\271\336\203\257\301U~J,\303S\330b\231\b\b\271\243\013y1\003\001LJ/\200\036\305\022\377\255\303J*\003V\f\351?0t8\343\030c,k\026\272P\r\020Q\262\2240%\320\275v\266*\271\240C8\355-\255=\326A\300\305\363\031\r"
+	.string	"`H\311;\337[\216\266\240\223\nj\rA\306\356F-49v~hb\212\200\233\002!=b\233\r\327\275\354\354}#0P\312\230\276\203\264\016\252dI\360\231\224\377\245\355;\013\237\240\203\376\276v\032\3557\212\346e>:\237d\024uTa\361\312\354\303\234H\003Xm\310+\211*|\tc\243\200\214\f\320\307d\032+,\216\343\361\223m\317\236@\357j\024S\362\023\341\304o"
+	.string	"h\f"
+	.ascii	"\344\216\022\313\255\376\374\n\033\316<aF/\335\235F\007\360\337"
+	.ascii	"`\242\201\345\001X<\03098\n\030\311\255\004\325\201\225!\020"
+	.ascii	"R#\030\372\372v0Clk\242\237\215\223H\357p=\351axREi%\202\341"
+	.ascii	"\331sW\256\255iK\376\260\230\377[/\232L@\374\373\307\263\277"
+	.ascii	"\331c\267\335\245u)U~\214\367\237\214GC\221\023\033\267\324\271"
+	.ascii	"\251\212\271\261v\177\374\235\253oE\344\037\0013\006\247\034"
+	.ascii	"\264p\273\317@l\363\271*Q\013uV!\347\321\f@\\\305?Op\3658D> "
+	.ascii	"\312\276\201\370v2OCl1\370\235j\216\354\375\363\373\"\277\261"
+	.ascii	"\036]\273p\331\004\017\232{3x\022_\017\377\332\233k\177+\361"
+	.ascii	"\035Q\264\026\375k\020\316\"\031[\343w\021\370\213\367\2731M"
+	.ascii	"E\364\024\262\235\373\223z\003\3505\356\f\254z\320/\336\035\240"
+	.ascii	"\373\367/\236\001\336\212\310\316\002\344\026\3437\263'\266\215"
+	.ascii	"\271\276\307\024f\306M\341\307p(\\z\274 \377\243\035g`\007\220"
+	.ascii	":\003\361\023\340\210\335\017\032\375!\363l4\f]Z\2131\033\265"
+	.ascii	"\315\370R\336\240\335\346N@\233\365\277w\357\214\207\207\371"
+	.ascii	"\341\221m4\030\307\323\350\005\307`\007\273[]\334\302\314\321"
+	.ascii	"%[\350\236\327\212Q\321\333bS\343\247\b\263\350\275\202##\357"
+	.ascii	"\342\307\222\305\232\275,j\270y\307\030|,\211'\233\333z\345\313"
+	.ascii	"\241Z:\271\2714a.Y\376\234^\345\367\017\372#\347\202\037\224"
+	.ascii	"\354_\360|\314~\312\2152?\177\\\326\357o\316\217\315\205o\036"
+	.ascii	"\344\206\320\226\364\233\245\274\362\356\215\255Q\332/t\357\375"
+	.ascii	"\b[\245=9\377-c\360\350|u\373\373l\215}\233\026\207\255\371h"
+	.ascii	"\177\377\332/y~H>0\364a\271H\230\2066\277n\005\237E\364\360\310"
+	.ascii	"S?\200^X\0279\223\245\265\256"
+	.text
+	.section	.gnu.lto_.symtab.2283bfd2d72ef317,"e",@progbits
+	.string	"pgResetFn_serialConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"serialPortIdentifiers"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\001"
+	.string	""
+	.string	"lookupBaudRateIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\001"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"findSerialPortIndexByIdentifier"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\001"
+	.string	""
+	.string	"findSerialPortUsageByIdentifier"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\001"
+	.string	""
+	.string	"findSerialPortUsageByPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\001"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\001"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"d"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\001"
+	.string	""
+	.string	"findNextSerialPortConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\001"
+	.string	""
+	.string	"determinePortSharing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"isSerialPortShared"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.string	"findNextSharedSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"isSerialConfigValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\001"
+	.string	""
+	.string	"serialFindPortConfiguration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\001"
+	.string	""
+	.string	"doesConfigurationUsePort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\001"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\001"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\001"
+	.string	""
+	.string	"serialInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\001"
+	.string	""
+	.string	"serialRemovePort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\001"
+	.string	""
+	.string	"serialGetAvailablePortCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\001"
+	.string	""
+	.string	"serialIsPortAvailable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\001"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\001"
+	.string	""
+	.string	"serialEvaluateNonMspData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\001"
+	.string	""
+	.string	"serialPassthrough"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"serialConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\002"
+	.string	""
+	.string	"serialConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"d"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\002"
+	.string	""
+	.string	"telemetryCheckRxPortShared"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\002"
+	.string	""
+	.string	"serTcpOpen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\002"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\002"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\002"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\002"
+	.string	""
+	.string	"cliEnter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\002"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\002"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\002"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2283bfd2d72ef317,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
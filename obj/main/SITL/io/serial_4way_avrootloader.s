@@ -0,0 +1,121 @@
+	.file	"serial_4way_avrootloader.c"
+	.section	.gnu.lto_.profile.22f62a3d4ac71889,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.22f62a3d4ac71889,"e",@progbits
+	.string	"(\265/\375 \024\205"
+	.string	""
+	.string	"P\b"
+	.string	"\001"
+	.string	"\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.22f62a3d4ac71889,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.22f62a3d4ac71889,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.22f62a3d4ac71889,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.22f62a3d4ac71889,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.22f62a3d4ac71889,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.22f62a3d4ac71889,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.22f62a3d4ac71889,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	"\301\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.22f62a3d4ac71889,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.22f62a3d4ac71889,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"\245\007"
+	.string	"\342\r68PO\323\001\310B\270\022"
+	.string	"j\342!Vm\376\b$=y\bc\023t\231\002q\330>\201\266\371\210\350j\373+\306\237j0\270C\003\344\211\263pv\341-\363}u!2\005\267\270 $\0362\023\327\212Kqu\213Q\357\234"
+	.string	"8KP\300\233\215#\217\301`\325D\204\203\324\256[)\250\345\260\2657\203f\036\325X\3108\272\335\332M\273\315\315F5S\273\335\274\254\013\315rX\275\026\323T\334y\031\352{\177\372\353Poxr\307\243\343"
+	.string	"\244b\362\275d\017\n\202\300\307\nH$5\330\240\376XM\362\016i\221O\0350\227\344\fRS\213\013\307I$\275A\276\255H\265\025\377\217\334\200%3|@V]\020\245&\210\217\344\377\320\377\224\377\035\206a\370?\340\277\367\237\023\t"
+	.ascii	"\257\354\225`\326\f\r\303\205h\204S\027\265\262B\224\021\270"
+	.ascii	"fl-c"
+	.text
+	.section	.gnu.lto_.symtab.22f62a3d4ac71889,"e",@progbits
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.22f62a3d4ac71889,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,399 @@
+	.file	"statusindicator.c"
+	.section	.gnu.lto_.profile.7b4685de84866083,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.7b4685de84866083,"e",@progbits
+	.string	"(\265/\375 k\235\002"
+	.string	"\344\003_"
+	.string	"\n"
+	.string	"\203\204\373(\002\002"
+	.string	"\002"
+	.string	"\001\352\263\360\321\b\002\337\301\220\244\005\003\327\213\334\342\013\002\002\001\002\001\004\005\233\304\365\321\002\006\233\242\376\312\004\007\b\343\247\262V\t\240\342\234\212\n"
+	.string	"\007"
+	.ascii	"P\020Z\3252\227\006i\n\374y4\315&`\320\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.7b4685de84866083,"e",@progbits
+	.string	"(\265/\375 --\001"
+	.string	"\330!"
+	.string	"\007"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\002\003"
+	.string	"\001\005"
+	.string	"\001\006"
+	.string	"\001\007\b"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"1\003\241\004\263\001,"
+	.text
+	.section	.gnu.lto_.inline.7b4685de84866083,"e",@progbits
+	.string	"(\265/\375`("
+	.string	"\375\002"
+	.string	"\022D\016\031\300%\035.\347m\343\377\377\246\277\263\265\306\377\377\273q\304\022B\032\331r\247+#\222\301\344X\024uB\007\030H\276\2553_\300\177\316\363\213mk\370V\034\322\026=\332\204\016"
+	.string	"s\263!@\006N\200u2\006:\200d\216\222\342\n\210]a\206\020\214\246"
+	.ascii	"\244\264\003\013\036\005p\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.7b4685de84866083,"e",@progbits
+	.string	"(\265/\375 (\365"
+	.string	""
+	.string	"\240\034"
+	.string	"\007\002"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	"\006\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"5\307[\002\333@\033"
+	.text
+	.section	.gnu.lto_.pureconst.7b4685de84866083,"e",@progbits
+	.string	"(\265/\375 \032\321"
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"\230\004\002\230\004\003\230\004\005\230\004\006\230\004\007"
+	.ascii	"\230\004\b\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.7b4685de84866083,"e",@progbits
+	.string	"(\265/\375 \214\255\001"
+	.string	"\310\200"
+	.string	"\007"
+	.string	"\001\002\002\001"
+	.string	""
+	.string	""
+	.string	"\002\003\003"
+	.string	"\001\002\003\005\006\007\b"
+	.string	""
+	.string	""
+	.string	"\f"
+	.string	"3\r \\\027J"
+	.string	"\342\300\314\300\b\300\024\274\254\346\274\035s"
+	.ascii	"\267\r\264\001"
+	.text
+	.section	.gnu.lto_.lto.7b4685de84866083,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_warningLedResetTimer.11.7b4685de84866083,"e",@progbits
+	.string	"(\265/\375`I"
+	.string	"\005\t"
+	.string	"\026\222A:@\345&\035\340\345\231\0070j\230x\264\024x0\033R\333"
+	.string	"M\350\303\314Y\252\025\214n\r\331h3\b\304@G\217\315\272\212\252O\001P\003+\271\243dT=\263d\357-S\n/"
+	.string	"0"
+	.string	"2"
+	.string	"\222\363\202\3532\236\340\272\264g\303\030P\f\250X\234"
+	.string	"\330\335\t=\356]=\377\252\013|%\321U\263\260\273\326\257\204q\303\333F\260\255`\333%qw\327\320d?uGU\377\222\247\226g\314\354^\264\002,K\262\200<\365\333\277\312\033\037\365\021\357\251P\334\024\006\324J\314\356*\341\3223\340\001!\377\303\021\234\376\273\364\271\353R_>\231\221\266|@\302\361\320\025\341\241F\004\245B\203\244-K\265A\023\372/\302\207l\260HPd\257D\n;\354\007 \355\003\355\351lZ\207y\262\206O\306ItX\307M-\233\237\f{\230\236\215\233\035\2165\b\207mv\232\266\315\315j\037\027\232\344\2115\202$\037\372%7\t\b"
+	.ascii	"3\241\331\037\030e\314=\3412\233\253\313\007\366\205\313\261"
+	.ascii	"h'\031"
+	.text
+	.section	.gnu.lto_warningLedEnable.12.7b4685de84866083,"e",@progbits
+	.string	"(\265/\375 \346=\006"
+	.string	"\262\213+1pK\323\001\220\365\1770"
+	.string	"\326]1\210\035\204\017\367\370}\216\217P<i\304\230C\367\201\337L=6\252\252\256\312-e\007/\277\004\304\266\355\336)\005~\032:\253\363\310\004HF\r\325\251Q\2342B\322Y\210\017\215bS\340\311\240@c\235\223Ff\333\277\fj\023\353=\370\227\026_\373\206\344_\330ar\277\016\375i9<\300\240\210X\256bo\225{\025\366%\3732\3731\037\003 \273\023\225\221\235\300\216\f\333gL\331!\004\020\002\036\021\034\224\335\215\317\342\324\035\345_\343\001\027V\335\001 \354\256\335\205Q\334\357\266\rl7\266%\002\b"
+	.ascii	"3\003\366:\243e\270\3055q\025\202x\031\"\\\216E;\311"
+	.text
+	.section	.gnu.lto_warningLedDisable.13.7b4685de84866083,"e",@progbits
+	.string	"(\265/\375 \346M\006"
+	.string	"\362\213,3`M\222\016@\235}\321\200f\303r3}\363=A\005\202s\205\2571\310\332\215Q\312\243m\030\350Uz[\005A\341b\310\373\304@\350\3508\243d\020\"SOQ\025/i\242\026,\224\365pI\227\005#\005-\224\324"
+	.string	"\247\312\202\321\301\321\201\241\202W\214\025\254t\262\216\363H<\032\027\361\275@\367\243 \227\2331\004\2465\353\273\030\250/a\243\343D\323>\337\3114w\361\005\310\314\334q\336\021p\024\210dV|R\322\363F4\376V\306\336\304@b\240d\"\004%3\241\303(\326\206\335zT \333d\332\002\0242\363\226m,\272\353\217\360G?E\007"
+	.ascii	"3\001'8\243%\276e.\203\274\f\021.\307\242\235d"
+	.text
+	.section	.gnu.lto_warningLedFlash.14.7b4685de84866083,"e",@progbits
+	.string	"(\265/\375 \346E\006"
+	.string	"\262\313+1`M\323\001\300Rm\036\\"
+	.string	"\021\273pV\214Sd@H\235\277"
+	.string	"\017!\304?\250\373B\35423\311`\030\230\004w\023`{\264\237\227\310\376{\247\024~\032:\253\363\310\005HF\017\325\251Q\2342B\322i\210\017\215bs\340\351\300@c\235\223FF\333\277\f\222l\326\213\260\273\264\370\036\377\220|\rCL\356\327\241?-\207\t\034\224\022\313Ul\255r\017\303>\300\276\314~\004\023\005&\273\026\225\223\335`\310\206\3553\246\354\021\003\211\001\021\n\020\312\356\306\227q\352\216\362\337q\201\013\253\356\002\024v\327\356\302.\356w\333\b\266\033\333\025\001\b"
+	.ascii	"3\003\366:\243e\270\3055q\025\202x\031\"\\\216E;\311"
+	.text
+	.section	.gnu.lto_warningLedRefresh.15.7b4685de84866083,"e",@progbits
+	.string	"(\265/\375`H"
+	.string	"\005\t"
+	.string	"\006\222A8@s\322\001082\335\346\231l\232#\357\2267y`4+\337\"W\270\215p\333\b\262|\265\022`L\205>\373p\031\020\030\177\272\003#5\023\242\303(\373\311&[\246\024/"
+	.string	"0"
+	.string	"2"
+	.string	"\236\023d\227\330\007\262K\177\266\314\301\205\200\r\306J\315\356\316(\362\357\372\371_= D\201W\200\206\335\265\206\250\215;\336v\202\355\005\3330\001\273\273\216)\373\252\033S\3653\206\020\203\227\335\214\327\315\272\244\013\311U\277\375\257\334\361O\216\362]E\342\200\032\034\226\026\307\314.K\341\322\223s\031\037\361D\247\017/\375.\273\324\230\220\246\244/#\244|\234\224a\361\261\242\243\345\344a\322\227\245\332#\013}\210\305\202S\211\313\024A\233\005j\004\261\217\005\243M\024\035\372p\233\007\ni\017\"\255\243\360@^77m\2124P\304\fq\335\374x\274I@p\323\3336nvX{lc\312\301\304U\212&?\372\255\253\220\034\b"
+	.string	"3\241\327\037\030]\314=w\031\335\325e"
+	.ascii	"[\302%^\264\223\f"
+	.text
+	.section	.gnu.lto_warningLedUpdate.16.7b4685de84866083,"e",@progbits
+	.string	"(\265/\375`\265"
+	.string	"5\013"
+	.string	"F\026O?0o\232\016\b#\341`-\240?Z\305ya\265F\3468\304j\260\222Z\032jdp\001>\"K\250\354\341\267\361\265Q7\025\313\037\006\006p\335\242f\263\037\325\243\306xj\236\304\335M\312\224\002="
+	.string	";"
+	.string	":"
+	.string	"\177\266l\025\347B\366\035\206\316\b\223\335\215\272\341\326!M\313\027\240]\207\242\nW\bA\347\244\303"
+	.string	"\r\203\016\230\\#\337\236\0214\217L"
+	.string	"\030\273\353\3144\n\367\273\355\005\266\023\330W\020\273V\r\366=7\324\264f:3\375"
+	.string	"\360D\n\003+v%|^,\311\033\361p\317o\377\233)~\210\213X\367tD\327\204\210D\227\241d\227\263\3749F\177\225\027\200\177\320\t\300\252\372\022\235\223+\324\324\177|\300\362c_\304\273\016\237\203'\215|\366\347k\300\277\353ca\002\304\005N~\f\323\336\340\310gP\277\375\026>DH0\275l\016K\005\261\017\355\006\034\223F\235\271PS\205\311H\r4\322f\243\302T\2338IQ#a2b\206\332\304K\305\023\004\007T\254\246\211\212\024\216s\f\216b\020%\355\007\031\371\314\232![\213\022U\020[\256\312\240C\341\221.\234\001\017"
+	.ascii	"2\003\3020\314\204\255\032\310a\366\002m>\016\316\341\226\023"
+	.ascii	"\251\226A\027\334]u\006XE\234\313M\211GcP{"
+	.text
+	.section	.gnu.lto_warningLedUpdate.part.0.20.7b4685de84866083,"e",@progbits
+	.string	"(\265/\375`\020\001m\f"
+	.string	"\206WR@0m\233\0160\230\0240TU\214\221\274}\n|\f\356f\203\331\331\323\250\021\\K\356\375\373\0028\366\361uJ\006\0276\200\357\265\244\376OJX\224 '\317c\241\340\202\271l\003 D\233\310\235R="
+	.string	"B"
+	.string	"@"
+	.string	"\037 =F\027 =~\203\355mc\316>q\257\302\376#\241\301\211\212\335\225\217J\341\334\025F\234\017;\016\346z\320agD\307yp\030\340\221\205\306\356z\202p\307\3336`\273\200\375N\376\311?\037d\262}\\\376\361\001\022\032v\227\272\370&\227{\264Js\261\232\t\037\030\356\223l~\211)o\273Gs\245\361\226\263\271g\352\321\035\356\201\273G\2330\233\t\364\001A\261\353a<ZN\217U!\023(\t\271&]\241.\350\204\360"
+	.string	"\311\300\220-\240\377a\034\360\335\365\240?\202G\206\022\031\305@\035\261F\217vw\255\"v\004\r\377\335\227"
+	.string	"`p\330u\020Z\261!Q\304\205\223\374\337\241\375\f\246E]\311\270fF\251X\b,\026\306\221Q2LNKZ,\312\206\254\\\230\314\250<\025$\270d6\347%\251G\253\"\326\350\320\214Uu\3046T\377\303Ah\276\005o\314\350O\351\021\232\350Rt\300\033"
+	.ascii	"Ec\264\256\300\3705\3440,\241\n\020\020\005\303\310\0256\027"
+	.ascii	"F\300=(\f`hB\220\233p\022R\203J\305=\352:\322\tS\bc\247\356\351"
+	.ascii	"\264e3o\247\005\340\332;\n\313\314\346\237P\306"
+	.text
+	.section	.gnu.lto_.symbol_nodes.7b4685de84866083,"e",@progbits
+	.string	"(\265/\375`4"
+	.string	"\215\004"
+	.string	"\242\306\030$\240'\351\317_\325\365\006n\323X\215\215\355\332\317\377\377\277/>\344\265\373\377[k\215\220\326\315\222F\366N\001\337\343p\341\220Df\330\322P\035\330*\252\3402\363\013\023\250\203;\361\3544\320\032!+\324\364a\330Z\352\240\224\r@\033\252\277)W\263~CJ\322\304\370>DqJf\246R\002\376\207\b\022"
+	.string	"`\013@p\213\2208\f\303\247\b\352\2312\215`\270\204\300r\36096|\031\320\003\374\301U\236\235\031"
+	.ascii	"7\274\n\b\315\241\312"
+	.text
+	.section	.gnu.lto_.refs.7b4685de84866083,"e",@progbits
+	.string	"(\265/\375 /-\001"
+	.string	"\330+"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001\001\003"
+	.string	"\001\002\003\001\004\001"
+	.string	"\001\005\006\007\b"
+	.string	"\001\002"
+	.string	""
+	.ascii	"\004\004\002;\005\\`R\222"
+	.text
+	.section	.gnu.lto_.decls.7b4685de84866083,"e",@progbits
+	.string	"(\265/\375`z\007\005)"
+	.string	"\232H \020Hp\336\321p2"
+	.string	"WY@\203APQ\213C\202E\250v\234\202\374\031\217$h\314\202\233\230\254S\307$\255\265@\201g\213\013\037\265r@\263\222\265\322F\345\342\216\344\350\246\241\b\367\034\265I\224C.\207[\202m\267L\001\323"
+	.string	"\344"
+	.string	"\367"
+	.string	"O.\220\227,\312d\337x\205\234\354\247\323QU\n\255:\251\273YMM\"}\250\341\245\204&S\0234=\006U\307Y\002\024\337\236"
+	.ascii	"N\265!K4\375\004,\254\324\271\022f\312\020M\271\n[a+V\376|\305"
+	.ascii	"W\236^\271\255\354~yl\303\037a[h\352\303\bn)\033\270\235\337"
+	.ascii	"\027\270\352\fG\325\263\356\326\303\272\333\317T\270Jgk\223\334"
+	.ascii	"^v\2779\2367N\342\024\232\376e\0047\225\r\334\"\b\370\231\310"
+	.ascii	"\177.i(v~\036b\006\215\230\2250*0)\264\364\347&g\377\311\314"
+	.ascii	"\376G\370Y\311\377\262\377\316\377c\377\231\377\305\376\207}"
+	.ascii	"\375\367\372\337\365\237\353\377\326\377\345\377,\377\225\377"
+	.ascii	"\253\376\343\376\203\375W\327\326\326\326~\036\361\363\221_g"
+	.ascii	"F\377\255\207\307\356\356\241\363\366\221\270s\326a\326\375<"
+	.ascii	"lc\bm;\201$\335\306\347\032\365\311\326P\b\232\376\367\351\251"
+	.ascii	"na\256\337>\266J'a\213e\f2\367v\221\004\255\204\352\366uB\246"
+	.ascii	"n\243\3756w\321\t\371\242}\335c\373\272B\\\027]a\367\213\304"
+	.ascii	"\265\313\241\220[\245\023\262U\272\310\\\027[\330\312a\021\265"
+	.ascii	"\350\"[1.\022\327*\207\310\266\350\204\314%=\237\230\264\316"
+	.ascii	"\253%\036k\213\275\303\3104<\342\232\355\353\366\263\233\227"
+	.ascii	"6\372\b\241\233\311=>\207J\334\205\330\334A\324\032\272\374v"
+	.ascii	"\367\002#\361\311\355b\263\215r\273\243\210Fm\304 |\233\255\204"
+	.ascii	"\233B(\246N\262\321\315\240\337nc\267\220\273\331\335\302\356"
+	.ascii	"\006pdz\273\203\340\332\244\321\330\275\244\300\330LB/6\272\321"
+	.ascii	"%Y\027d\253\f@\3349g\212\214`u\241\351mM\352mJ*\0312\354\344"
+	.ascii	"+\007TJn\246\272\227t\252\322\023)8\234l&5\363Z\223\203\246e"
+	.ascii	"v\206?\230cj\352Q3\365\347\2611\306J\213o#oX\226\374\210\342"
+	.ascii	"\246\217`&\344\232"
+	.string	"4\245\250\304\304\230\251\n\341\fh:\337h)Q\303\302\316\222;YJq\212@\300\300\236iPK\364\206z\376\302\374\365\305Y!:\254\321j\223u\363\362\262u7\201%{j\220\231\212r\252]\357b\246\212k\242\0313M\300\0260/\246\027\365\334\205\231\353l\305\\\214\025\242\003WUZ\037\337\tg+\365\314X7-\336\322b\346\255\233_\227\307\261\227\216\272\263\026\336r\346b\305\\\230y\334\260\233\330\3354\026aX&\307\227\233^Z\322\361$\323H\251\26193\177\013\031\216\266\323]\325\335\rt\306D9\321\202\246g\242\372\026\352\321\354P\220D\357\350h\027\004\2561z\300\"\006\354P0\305\212\324c\325\340\017H\324C\272\335\350g\004\n\021'v\354\312\002\310c[\020\375\2168\254\300\037\007\244\225\r\3228\321c\024\\\201+V\023FA\336\321\207`\257\303z\244\202\347\363\200c\327\340j\342"
+	.ascii	"pE\352\241\350\271\317\177.V\340\216\375\375\200\273\001\270"
+	.ascii	"\n?,\220\347\342geyE.R$8Q\017\270\372V\026\3521\004Q\b\3220\003"
+	.ascii	"\3005\bU\020\252p\273\006!  \241  \365A@\266uhey\354\211\242"
+	.ascii	"u\004\013_\317\007\344\311\310\261C\026.\260\276\036\f\365\033"
+	.ascii	"6p\360IQ\002\204J\364\003\374\261<\242^\221\257\027\204\301\362"
+	.ascii	"\330\340\356\327\333\371z<\244\035\0210\270\373y\220\206\231"
+	.ascii	"f\001I\362\224\346\344'\224\024\035h\262\004P\235U)\241a\251"
+	.ascii	"YhM\035\350Y\231\rl\013\212\024\232>\237\\v[\261\233\250$S$p"
+	.ascii	"\250\220\225\221\005x\023\200\214\250aDf\210DFfDDD\244i\322\001"
+	.ascii	"\220\002\2211d\035\021 \251\342J\216\224hk\317d\034\305~\303"
+	.ascii	"A!\244_)]O\331m\001r+\n\343\343\312(_\321B\307H\300\035\t}\265"
+	.ascii	"o\337T5\224\236\257\357p\324\210\f\036\227\241\006\320\034\256"
+	.ascii	"-\305}\364[\327\341\t\304P\t\342<6\317v\354\375w\344l\363\207"
+	.ascii	"\027g\373\233f\217\n\021\002\001\207\241w\370\357\251\257\224"
+	.ascii	"\302\2340\n\356~ \"\323a+\037\003\276m\033\240\373g\275\320\323"
+	.ascii	"~P\217\322\264w\275&H$R\304\024\2034x$3\374\330HW\r\314>\217"
+	.ascii	"BvC\205Y80|\211\356\320M\300{'E\224$*a\035\375\236\300\325\245"
+	.ascii	"\226\332\350\016\301^\235\"!\343g\224\310\356w\022\2243\210\242"
+	.ascii	"D\366\331\377\\\003y{<B\372\365o\274\311\376\302\303X\033j\217"
+	.ascii	"\220'\365\215%3\3309\300\004=8\243\032S#\256j\246\267\342\345"
+	.ascii	">\315\377\376\007c\372bZ\277_\235\325"
+	.text
+	.section	.gnu.lto_.symtab.7b4685de84866083,"e",@progbits
+	.string	"warningLedResetTimer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324"
+	.string	""
+	.string	""
+	.string	"warningLedEnable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326"
+	.string	""
+	.string	""
+	.string	"warningLedDisable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333"
+	.string	""
+	.string	""
+	.string	"warningLedFlash"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335"
+	.string	""
+	.string	""
+	.string	"warningLedRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337"
+	.string	""
+	.string	""
+	.string	"warningLedUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316"
+	.string	""
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341"
+	.string	""
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346"
+	.string	""
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.7b4685de84866083,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
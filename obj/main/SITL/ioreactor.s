@@ -0,0 +1,784 @@
+	.file	"ioreactor.c"
+	.section	.gnu.lto_.profile.2620135fba0c80b8,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\n"
+	.text
+	.section	.gnu.lto_.icf.2620135fba0c80b8,"e",@progbits
+	.string	"(\265/\375`\032"
+	.string	"U\006"
+	.string	"\262J'.pM\322\030\316\306\212^\r\n\271E\250D\206c\223\"g1\n\321\214\0161_\275&\364\377\377\377\377\377\037\002\331mo\271\367&{\313\264wj\337\237jL\b\f0r)\217O\207QA\261\230\313uH\023\304d\375\036E@I\204\334w\337\227%)h8\210p8\234\275~\303\233d\026\236\013gY\023\361"
+	.string	"x\200\307\215h\212\336\0228 \t\316\375v\253\227\027X\031i\232\006\r$\207\020\246\353Z\255\267u\366F\206\007R\320\2371\n\007\364\261\256/\365c\225\f\t\0045\325\232\001\021"
+	.ascii	"Yqhw\b \003\341\026%\207\2109\252p\265\251\315'\332&\302\033"
+	.ascii	"x\326\250`\254|6\201S:.p\356\242\002\f\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.2620135fba0c80b8,"e",@progbits
+	.string	"(\265/\375 \371u\003"
+	.string	"\302\205\017\030\260%\351\f\3030\f'\f\3030\f\320fm#\3266-\220-eJ\001:\302t\203_\241*\273\202\003?\214\361\250\n=Ah9\376\325AC\001TD\351\034?U\333\251gD\335b!\024"
+	.string	"\340\020\251|\373`\007\314\035\234\005 \303\\o\340\020"
+	.ascii	"\216\343\321\342\001a>\340b\250\246\007B@\230\025:\020\001\342"
+	.ascii	"\322\f|\003X"
+	.text
+	.section	.gnu.lto_.inline.2620135fba0c80b8,"e",@progbits
+	.string	"(\265/\375`>\002\225\n"
+	.string	"\242M.0pM\322\030\3608\035.DV|\"\n\274\330$\353\301\035\204!\360~\377?\001\021\rSq\377\357U\f\3371\242m\204\220\335Z7\332{K)S?\252V \273\0139i\243\035\036\223\213\246N\305\"\245$\243\211\211\017\037+\025\005\006\021\224\352\336#\265\273\026\207\311\317"
+	.string	"\206(\265\206\354\210| \b\034\324\343\203\301\241\301\352\202'\305\226M*h\345\0369J\342\t\231\030\320@\331\350hf\270\324\326\353D@\316e\275\016%\216\343\202F\234Hd\b<\325\037ZmwwE\347D\375\023\265\376\210=Q\370?\305\344\177\236"
+	.string	"\237\220\325\356\262|d\310\221\335\315\274\337z\020@\250q9cH\350\302J\355\006p\002!!B;\022`T-EQ\2321Z\n*NXj\263\276\001"
+	.string	"\"\355\030UH\222\034\331fM~D\276\217\022\201\331pv\bi\307\331\267-"
+	.ascii	"$\221\356*\334D\314\216\323G\004)\313F\333\312\006\026\225gH"
+	.ascii	"e\022\177\365\237\351\023QY\013v\340\271\321\240O<R?\005\316"
+	.ascii	"\301CT\323&+\301\335\273\315\333{\b\020\234\363Yp\023\240\372"
+	.ascii	"\375\244\013hFL.t\005\3235\001\322;\300>\027\203\362\007\341"
+	.ascii	"\303ja\235\023"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2620135fba0c80b8,"e",@progbits
+	.string	"(\265/\375`\335\002\305\f"
+	.string	"F\221:5`e\323\0300\f\203>\022v\b'\266(\212J\322\237+\031\005\204p\266 \020\331\267\275{\003`"
+	.string	"y\013\331A\304\270\260m\275c\252m\335!e\362K\231R\n'"
+	.string	"("
+	.string	"*"
+	.string	"\366\235E\354\020_bG\001\266\237\236\240=\301\273\034*v\314\340\332\371\330\351\367\251\337\307\355\353\327\331\245\264\242u \001\036Mz4\027"
+	.ascii	"|\353\006\370gW\360\031F\306\375a\n\351\266\301\335k\003\346"
+	.ascii	"e\301=_\350\376\203\337\351w\350\323\237Q$\206\004\036\261?\376"
+	.ascii	"\223(1\272\0018\366\005t\017nw@\316F\333\266moB\370\225\312\244"
+	.ascii	"\315\356\361\013\330\267\0375\355\255\f\021\327\206\2724\325"
+	.ascii	"\204a\231\354Z\350\244\303\"%\254\013\343\2400\322\262H\013#"
+	.ascii	"-\213\272h2\233\212\2724\032\t\265\200.B\3646\034\"\364)M\330"
+	.ascii	"vP\211\003R\250aMCS\026\031\2644\254\001\220\"\241\302\362\021"
+	.ascii	"\220<f\220d\212\306\026\2265G\2474\024\311\030%\246k\357V\031"
+	.ascii	"\263OM0\257N{]\273/b\243]\241\210\344\\:\022B0\274\"\236\222"
+	.ascii	"X\202\350\024\361\275rH\301\306w\240x\377\276\365\316h\031M("
+	.ascii	"\212\320u\217s\007\256\245\212\366\036\004H\326C)\303#`\tOr?"
+	.ascii	"\332\340\310HQk6\237\235\273]\205\265\033\305p;P\215\264\264"
+	.ascii	"32\2240=X\221\005\266\300 \326\260$\356MaB* \017\324\342\304"
+	.ascii	"!\335\372\272B8~\303\332\312\3722\2470uVR"
+	.text
+	.section	.gnu.lto_.pureconst.2620135fba0c80b8,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\f"
+	.ascii	"\231\005\002\231\005\003\231\004\005\232\004\b\232\004\t\231"
+	.ascii	"\004\n\232\004\013\230\004\f\232\004\r\231\004\016\232\004\017"
+	.ascii	"\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2620135fba0c80b8,"e",@progbits
+	.string	"(\265/\375`\245"
+	.string	"=\005"
+	.ascii	"\222\205\022\035\240'\351?\366\377\216\325\027Q\375\252\352\253"
+	.ascii	"\372\352_\203h\377\255]z\373\377\233\333R\246\033\252@\273\215"
+	.ascii	"\003<j\214\204\362_\r\216\2022\034\211\305\363\320@y^SyBN\265"
+	.ascii	"\250\0345I\236\363\323i\345\326\372\021\334LE) p\202\031\033"
+	.ascii	"\365 !\260\353\2466a\372\230|\215\344}L\340\254\304\311\\\035"
+	.ascii	"+\272\311\256\016\262\b\320\0360\004\202j\256\355X\266\017\305"
+	.ascii	"\212\002\013\234\325\0250qdn\367Y\326L\370\346\330K\373\347l"
+	.ascii	"3fm\362\034=\005\205\333\3406c\013\305 \b\022F\031B(\212\033"
+	.text
+	.section	.gnu.lto_.lto.2620135fba0c80b8,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_stopCallback.20.2620135fba0c80b8,"e",@progbits
+	.string	"(\265/\375`i"
+	.string	"\245\t"
+	.string	"\346RD9@\217\322\001pzz\267\376q\231c\242],\302\314\247\037;k\\\177\327\037\037\263\2203\r\t\304`\030G$\353`\327_\312\273!\300K\315\331p\205RS\355\347\266{\247\0240"
+	.string	"4"
+	.string	"3"
+	.string	"\324\343\007\264\323\315\003\264S\207\266\313\307\217\r\245\240Nb\273[\347\352\341e\350\337\344\0341u\272\324\210v\327RLq\334\363\266?\266E\266a\002g\375\2222\240\\\002-\273\033\263\230}Q\026\021\333\357\330\226\343K\302\267,\314\331\355\220\2056\247\236\314\245\375\221\223\204g]\034`W\245\262\262;\032\370`\3630\214\231a\277\244\371(wu\236\207X\342\223\027?\355\224`\025{i\311\231\251\224\323\246\250\220\027}\220\227\f\2461O\366x\222\323\303~fw\327Se\007\037h\342&8\315\343 \032L\333\203\306#\220\327\201\243\215\363:RMX@P\250 \347\340m`5\221\266R\035y_\005}\334Ep^\005\273\316\253\235q\237\331\251r\301\312\002\f"
+	.ascii	"2\241\375/0x8*Lxq\215\"\206yA\370L\215\202\313\322\324\350q\207"
+	.ascii	"\027\355$\003"
+	.text
+	.section	.gnu.lto_ioReactorInit.21.2620135fba0c80b8,"e",@progbits
+	.string	"(\265/\375`Q\002\315\023"
+	.string	"\266\345\203J\300\222U:\242\204e\316\266\353\007\301A\344J\327j\344\353-\334\005;\200[k\020"
+	.string	"\221\001H\332\027\361\200[\233\266\327\267\317\270\003\376=\241\006\223QS\214\370`{G!\016\021\235\372m$\243\320\314H\366\330\032!D\312\224\002q"
+	.string	"e"
+	.string	"u"
+	.ascii	"<;\340G\373\305V}\274\rc\253\314\240\001\214i\004p\313\2244\023"
+	.ascii	"\024dNa\271(N{\nE\216\342*\315\257=\365\337\025\234\220\001\034"
+	.ascii	"\232\270\3119*\205s\2225\347T\351ft\024\017\264\020\202\264\322"
+	.ascii	"\311\210&B\270\036N\305\333r\276bi\363\242g\245\273\211%<T\020"
+	.ascii	"\375w\255\321\305\250\242R\346\234\326\234\356\346\036\271m\020"
+	.ascii	"\266\027\330J\023\377\006\300)\361c\211\306M\205\370\353\377"
+	.ascii	"\034\310G\276\317\034l4\3726\"?~G\316\207M\237L*k\316\373\210"
+	.ascii	"\264=|\320\347\276\377\375A\223p\350t\333\232-\214\321\345\331"
+	.ascii	"\027\347\356\330\253^YM\262\352\321j\321\352\265ZW\375\001&7"
+	.ascii	"z\340P\332\034\302)\342\211\310\2641\026\365\330\276\357\363"
+	.ascii	"\340\313\201\376R:)\202\202\343J\325\003\252\001\234@ayv:s\332"
+	.ascii	"\236{\320+/\262@T\206\320\261\363\321\361\205\307\360\321\212"
+	.ascii	"g\316\351\300\037:\f\f\276\357\2433\260\260\220\037u\250DY6G"
+	.ascii	"@\372\301\226K\237[\355\203\037\361\255\260\031:\341\266\346"
+	.ascii	"\237F\372Bw\361b\335\347\026\030\254ig\007\004\362\243O:\274"
+	.ascii	"%\rE\003P\333%\246\317\351\356e\206\360hvy'\001v\241\310b3W\353"
+	.ascii	"%\213\301\312\b\025TV\312\331\253E\326\232\225\032`-\227\322"
+	.ascii	"%\353P\242\030pl\303KV\316b1Y\251\022\332.\316\335\361\177\027"
+	.ascii	"\200\"Y\257\256hq\235b\333\230\324\362\254\344\311uL\360qk\354"
+	.ascii	"qI\3663El\372D\242\226w\3555\261\030A\322\310\335\355\0011\025"
+	.ascii	"\320_\205<\3603XRH\206 A\237\333\275\022\t\334\326\036* `\002"
+	.ascii	"\231\261;\017\352\t\315S\242\032\205\b6w\246\241r\363X\\\360"
+	.ascii	"\246\361\",\2476\264^\rw\255=\271U\310\310\310\370-\034\026P"
+	.ascii	")\257\031\230\274\206R\007\303Y-\217R\236\302\254\361\272\020"
+	.ascii	"x}r\307UZ\\\020\013\320\r_U\002\n\343\204k\254\260\373\350k@"
+	.ascii	"{\177\265\241\305\001u\333\030\243\310@\241"
+	.text
+	.section	.gnu.lto_ioReactorAdd.22.2620135fba0c80b8,"e",@progbits
+	.string	"(\265/\375`\236\001\215\020"
+	.string	"\246!sF\360\356&\035\340\025R\201\266/0\271\353\315\tK\210G\344\031\244\031\355~\271\311\365\3110\334\2571\254[\223G\025\013^\366\340\031\211\256\225\305z,\247*\325/;\257\244\362\311bz\301\0014\362'\210\354-eJ\001^"
+	.string	"]"
+	.string	"\\"
+	.string	"\333\243\007\314\264\217\363\034\326uXN`Wf\002hw\266\300!\333\243g/\240=n\357\320\036m;\244\001\313\255\0030JT\364\3529\332\235q*\342\255C\315\226\017 \346:\334@\\!\003\230\243\231"
+	.ascii	"\261\027\310\201\364r\361\357\031\023s\311\324\020\331]',\366"
+	.ascii	"\341\216\267=b\033\202\235\245\337\212M\377\336\301\203C\223"
+	.ascii	"3\323\2223\354\231+\325\306>\334\335\265\312l\247K\327\371\267"
+	.ascii	"\357\374\232\3230"
+	.string	"\2465\2463\246/\200\365\372\f\310\330\3550#i\207b\213\021\367\371m\226\377\271\344\243x\017\353>*pe\240Q\f\243]\017\037\217\036\031\342\320\331O\260\276\263\342\215\335\032\030\016\002!Tm\374q\325\013<D/\211\344\001\371\024\377N\033\354\252\340\2516\252\313\303T=^\352\262\377s \013\3717.qP\036\346 \3551uC\306&ga!\022\223\277\"\225Ae47\273\373\233G\237E{\274\"\300)\241\263\251}r\025.\262\311V\375\343`\323\343\206\2466\312\003\253T\227\322E\224U\252K\3514\257\323@\222:a\3200\n\304S\255P\247\316S\231p\022(D\230\300\255\272\022\357\264\342R&\247\023\016\345\241p \t\254\332\320y\334J\245\362\270\322l\017We\376wH\"\351\373\311\277\245YclC\265H\213\272X\005\356\326<\270\317o\264\003;\262\202\205<\254\244P]~\001\244\023\032"
+	.string	"n\204\306\207\bp\r\260\330\260\030\332\370c\013\tMN\206\215\340*\004\201\032r\f\267\203\331\216\317\325\324)\006\341\232X6Q\300\305"
+	.ascii	"!p\017\013\304\202\360\231\032\005\227%`bSW\323\030\024\024"
+	.text
+	.section	.gnu.lto_ioReactorRemove.23.2620135fba0c80b8,"e",@progbits
+	.string	"(\265/\375`w"
+	.string	"=\n"
+	.string	"\366\023IA0\213(\035@\333_\247\017\226\202\315\312r\245\3318\333C-\347\202`\226b\333\033\305\n\325\032\366D\"%\245\0166\315CbK`1#\022@\211\031\202\264L\253\276\301A\243\316\352\177#\233l\231R4"
+	.string	"5"
+	.string	"6"
+	.string	"a\205/*\227\016?\201]V\036\201]\332\263-`\0068\264D)\326\356\316\230\340\336\325\363\337\340\226o\004\272R4v\327\372\215\f\334\361\2663\2663\354?\004'TH[v\b\322\210\300\376\265\273\353\b\332G\375\227\252U\325\307,J,\f\230\b\273\005Z\033\266\202\244\240\340b\373j\237\301O\336Q\237C\354\202\022&\354\006\217z\2570\215v\211G\377\231B\024A\366!<\345\225o\262\211U\372\317*\354R\243\345\200\001\374\201W\022\030\276\203\223"
+	.string	"\232\201d2]\372\037\354\362Q\022"
+	.string	"I\001\234&\362\321\311B(\336h\270\255\333d\032\267q&\207\307F\307\3544\020.\353f\207\223\215\314\r\347\231\232\2147\022\215\233\335\266q\363\022\356\257\215\240\257\005%\r\027BQ\200-\352oX\f"
+	.ascii	"2\241Y\034\370p\001\241\2123\325\031\230F\250\336\032\006\250"
+	.ascii	".v5\253\321\341\016/\332I\006"
+	.text
+	.section	.gnu.lto_ioReactorRun.24.2620135fba0c80b8,"e",@progbits
+	.string	"(\265/\375`\003\003\315\027"
+	.string	"V\255\234I\240XU:"
+	.string	"?x\364E\351\321L\264Q\245\242\347\312\225lA\374\025\"\332\204\026\271D\212:\364\302\232\347:z\223chY@\332\366\177\236L\317\240k\237C[\227\3209\272\227@/:\205Q\270\243!\034I#\233\310\235R\207"
+	.string	"\204"
+	.string	"\205"
+	.string	"=\243\276\343<j\347\221 +\216\0077\024\301Zs2\247&@\236\246\352_\306\323\373\3562\236\326\354)\367\355\352\177'v\214\252\324Z\313\245\321r\321wS\217[\373i$\251\270\263\346O\037 Ng\373I\245\333\351\335\346\350\026!\026'\305\223N\n\033w\222\343\021g\204\301\"\007~\232\320\345L*\264\342\"\360b\216\236%8\335\212\357{\027u\364"
+	.string	"q:\026\237'\004\265VO\234N\305\315r\3336l3\260\367\001=\036#\024d\210\007g\016gv\302\340.\220\355\263\315Q8\274\341\375\261UG\272S\377\335\250\037\335\3644-\216\323K\247\2478}"
+	.ascii	"\343\220&\001\250\324\232bx\2452\241En\034\351?\372\177?\357"
+	.ascii	"\242}\373>\374$\243~\034H\355H\"^K\344XP\374\\\004k\365% O\355"
+	.ascii	"#\3572\032\371\300#3\375Z\320\220\367\371=\214:\365\211^T\373"
+	.ascii	"o\004i\313\221@\236\370\004k\255\007\310\323\225x\227\007\265"
+	.ascii	"\326J\005\234\256j\017<\365\351YR\342\305m\016\3752wS\353\271"
+	.ascii	"^\351x\302\221PP5\225\273*(\025~\004\004y#\031,\220A\"\306\323"
+	.ascii	"\271\224H\311\n\317\027\316d)\005vv\353K.VS\255\325\200i\357"
+	.ascii	"\275\006\354j\2553\247\251}\322cb(\r\361p\346"
+	.string	"p\027hDG':5Yo\271\231\306\033\275\007+\233p_\233\203\315<\016\265\253\235\265\331W\272\0203\371A\226yi\036w\352{i\037\263W\007\f\261\326\206\023\354\264\030\b\231\213\336\320b\257\020\257\321.\326LFs\265^3\031\254t \241AMI{i\230\265he\f\326\262)]\263\233\222\005c\231\207\327\254\244\311d\263\022\345\253\337\237\005D\230\340\354\315$\304Ze\320\234\367\007\213\346\360\264@\3760\212\253 J\316\024\332Or%\020V\017r\204\232y\\\315\276w\030\242\244!\236\24294\315\f!\214q\201|r\177\314\202DT-\255\2612\247k\002\265t?\345\227$g\n/\0069 p\002\241\311b\007b\340oL\324X%i\222\224\314\270}\bQ$>\033q\372\354-K,\215\225sh\307\373Z\244\005u\367\333\021\246\323N\242\362\202M,\346\005\027\217F\327\240\341o\006{c"
+	.ascii	"$bZb\215\2766-\242x\227H\255\331X\376\200\346\227m\311C\017\032"
+	.ascii	"vz\354\027e\303u=\254\2704\2547\b\242\337\342\233\3345-\204\273"
+	.ascii	"\241\255\024-\022\b\307\210b\214\274.\202\020\030o\272\314\023"
+	.text
+	.section	.gnu.lto_ioReactorStop.25.2620135fba0c80b8,"e",@progbits
+	.string	"(\265/\375`\306"
+	.string	"\225\013"
+	.string	"V\326PB O\234\016`9\213\305\360\224\n\311\243W}\212\326\035\351\0248\264%\327\025r1\"\r\"\351o\021[\31202S\344\363AZI\001!\224\220\332-\261s\371;r\346\006\020E\206l\244\310m\367N)9"
+	.string	"?"
+	.string	">"
+	.string	"\251\335\323\307\247A\256O\327wX\237\3279\254\317c\356\354\030\257\033\366!\207\007%R\273K\245\206w\217\235\377\3227\274\220\347Q\003\300\356:z!\321-o{b;\304\376\2012\203}\311J\f\266\214\216\326W\260\270\320A\302\250+a5c]\314\024\036\016\376\366\375\021\007\375\320X\3558\377<!|\030}\273\313\361\253\261\317\207\270\211s\021\035\311N\250+2@\241~\001a\202k\267\301\275(}\020\243\305{\366p =>\350\005Ga\025\327\356\212\370&~B\343\223>\315`\023\357}\372\033\3533J\031z\2412\375\035+|$E\2500\372d|\342\312\256\240\030YF\223\266P6\215\263T\262M\273\320\001\005\004\020\240\\\206`\253p4s\251`\250e\323P\312\304\232\202l\243\234\246m\024\253\237\227\036"
+	.string	"\304I\205\372H\220;\222]\013#(0\256\214\305\353na\235\304\003\021"
+	.ascii	"2\003\302\260\310\302NZ,5\20608\221\r8,\327\360UM\024\257B\300"
+	.ascii	"u\267\372\324\3228\265\222\362r\005\270t\213v>\001"
+	.text
+	.section	.gnu.lto_ioEventInit.26.2620135fba0c80b8,"e",@progbits
+	.string	"(\265/\375`\264"
+	.string	"5\013"
+	.string	"\266VQ@\020O5\035\300b\360\224\022!M"
+	.string	"y\270@/jW\213\240\\\371\342i\220\030c\346\021\225\243\271\273}Fh` \367\211 \022 M8\250\350\262\331\352{\266\246\340\026,)Z2jd\357\224\002<"
+	.string	";"
+	.string	"A"
+	.string	"[\025X\242\035s=\201\354\230\366\001\3311\333\226,\350\330\363\212\032\375\203JTbc\267\322\031\342\236K\217\177\022\2774L\031a\351s\351\230\354\256eX\342p\317\333>`\373\201\375I\0379A\330\277vw=O\266\245\265\327?\273\370_\227\364\0014\250\033.\n\260vGc\214]\201\251P\331\276\355\216\375\260=\353\246\205\003)\355\217\370\252s\221s\001\273'1\305\006\316\246]\371\211\r\335\300\302\303\252\003H\216\376\264/g\271\245\355.\003\337D\006/"
+	.string	"*u\314\347d\307$\212\360\005H\216vH\bi\357V\346#\310l\r\006\371\360\363)\021$\030\032\032\346\307\256\001\025n\243`\261l\234\366u\226\n\230\355\202\303\\\344\363@n\353>\217B#L\200 \201\202\235\205o\003)\206\262](\367ih\304\200\275L\367Q\320\363>\372\250{k\023\002\232!'\370\24763\246\f\221\030\222c\013"
+	.ascii	"2\003\302\260G\346\312'\315Lj\023\266\3402\"(\004\227\201\221"
+	.ascii	"\004\2500\246k\222\001"
+	.text
+	.section	.gnu.lto_ioEventSignal.27.2620135fba0c80b8,"e",@progbits
+	.string	"(\265/\375`\233"
+	.string	"\025\013"
+	.string	"\026VOA O\234\016\240y`\341\004\203\216\340\320\347\316\324^c.BA\fR\237\357_\032\206o\260\257?Y\036\231)\bN\245^"
+	.string	"b \034x\245B\340\315\331\f\2745'FQ\340\276#\021\332d\357\224\0029"
+	.string	":"
+	.string	">"
+	.string	"\013JA\332\255"
+	.string	"\034\340\372t}G\365y\235\243\372tg\277x\r\355M|\027F1v\227J\020\357\036;\377\340#\336g\363h\031\330]G\357\263\341\226\267=\261M\300>\r\362\203}jw\327\022d\377\373)\031}\313\342\320\342#\334\315\020\316\330\322T!\342\365\267\177\320\022\3335\363\365h\210`\350\2408\355\222B>=\340z\264O\342%\272\177\232ol\221x\335,\252\213\016j\327\256\205{\227\266\004L\274g\020\217\334\330\236\360\221Wh\270\330]\001\376\t\n\025<B!>}M\365y)?&\031\337\237\251^?A\323\b\030\234\030\332u\023\003\331E\223[\366\200\301\005s`\271B\3314\256\202e\233f\241\t\026 P@\271\254\301\206q\364b\301 \320\312\206\241\224\211\265\b\331F9M\333\250\244\356\251\225 \037\350P\342\310\2163\324\256\207\002'Q\f\035\f"
+	.string	"3\2413\214\201\367\361uc\001uM\2543C"
+	.ascii	"\327l.\334\315(by\352\n\270\226\027\302$\003"
+	.text
+	.section	.gnu.lto_ioTimerInit.28.2620135fba0c80b8,"e",@progbits
+	.string	"(\265/\375`\226\002u\025"
+	.string	"\366i\223H\260\230M:\360\346\003\306\f\025\365\302\263\317GQa2\030y.<\347\032\316\340\301\005\224\207q\341\334\250o+\032\204\365\301\303\225\240\261\374\317\241pfY\3246\205\362\304\357\026\344\r\326\021\230\201\367\335W\023B\b\2212\245{"
+	.string	"u"
+	.string	"\204"
+	.string	"\326\031\017\352\234\371r<\212v\035I_k\342\230P@\030\017\316|[*Ea\240j\337\306o\320\016\345\341\001\346l\202\0022g\251\3006\343A\227\037\020\036\034/ <h\3336\013h\256\275|\032q\246\037\271\035Ws\226\344\272x\355\337j\315\267\375\273\225\212\236ng\342\373!\310e\201\301\332\335>\231+[\325y\327\020;\234\252\2103\347\264\352v%n\360\266slS\260\265J:\245\243\262\244=\273\350\f\211y\017\t\023\334\026\"\322\353\276\347\275\345E\215i\305\352\303\332\354\322\246\353d\377\233sNo\223m5\314u\374\255\227?\353P?"
+	.ascii	"\253\307P-\216\352PT\203\242\372\033\325+\2525T?\346\205\305"
+	.ascii	"\212\024LT\353\244\234#zX\246\022\260*\306{\3746\315\347\331"
+	.ascii	"\305\347q)\332{ }\363D9m\035TX\331\270\232\223\004\315\3018\224"
+	.ascii	"\344\326f\244\247\210\017O\270\366\205\023\351i\331\2651\\\210"
+	.ascii	"\217o\354\f\347\271|sP\f\"e\306\tpC\361\311\223\302o\301-\320"
+	.ascii	"\004\204\214[\220\267\366[\002S \252tw\237\313\262\244=;\300"
+	.ascii	"\225O\n[\253\373\262\213\022\345"
+	.string	"\204\007\215\233\366\364\t\007\225)\273N\246\3717F\004\224($8\275b\326\332\257\003Q\"E0Yq#\305\327\206\375\207\207\214s\316\033\177j\003\020\353\351\305A\337Cx0/\230\321\321w\304\363\023\013\222\301\214F\241\227K\303\320\220\3535\312`C?E.\016\242_5\262\330\354\345\202\311bA\244\216\205\b;\344\f\006$s\315\310\242 \027\021\371\222\035\2215\007\0343\202\311\310Y,&#]\312\371on\223\r\334\222\344\250\026&g\311\021)*\365k\341\270!l\217k\234\245\275\031\351\233\263\305\003\253\034\332\373\326I\\\230mpk\"%\243\276\204\360>\316\2330\316\211\273\216\346\025v\364:qY\271' \200\002\031Q\304\003L\204vT Q\t7\257@\026\271\343\037\215\377!\341\203A]\022i\303M\"\001+GlY\004\244\207_\256\333\253\332E\217Z.\0029\347\007,\225ek\260\322\243"
+	.ascii	"\234\237\343\260\003\206\202\364J\r]\023~\362h/S\030\342\302"
+	.ascii	"/cd\001\0053+\227\347\242{"
+	.text
+	.section	.gnu.lto_ioHandlerAcknowledge.29.2620135fba0c80b8,"e",@progbits
+	.string	"(\265/\375` \001\315\r"
+	.string	"\326Z_D"
+	.string	"\261&\035CXF\375\320\234N\216\351\232\241\016\2575\026\323V=)\366i\037\311\f1\004\317R\375\267\b\013\201\3109\220\251ga[\374\277\222\257\203\001g\356\313\300\313O'\317\370\205\376\237X\262\211\224)\005I"
+	.string	"K"
+	.string	"M"
+	.ascii	"Np\035\332\366I\274\204\212\273\002\021\204\214\225\212\3612"
+	.ascii	"\223\263\0331\307\017\260\016\257\013\260\016\365\303\273W\232"
+	.ascii	"\235?z\265\200C\n\222\227\341\n\300c\251@v"
+	.string	"\367\337\023\306k\311\364\220\354\256\223\344\311\334\360\266\033\330\036\261\037\023\017\251\231\221\203\263\222;v\034\245\232\354W\253%_?\375\226\323Z\245S\323\357\360\340\324\030x\261\033\263\243\263.\240\n\021\217\277\255\342\177\366\260\035\273\257\013\006\216\227\224\214\233]\232\003\207f\220\371S\312\003\354\226Z\320\354F\004\001\036FnP\225\232\342/\325O\247\206\206\334\335\221\252\311\327CV\252\204\024\214\226\264\341\216\274n\026\326Q\377J.\322\325\326.\344I\251 .:\262}\362\031\257\370\260\331]\005>\212\r\205\200M\210C?\305:\274\252Gc\304\351\235\365\005\234\bE\373\300\rda\202(\253\340\361Gd\323\270O\006\332\264\020\366 \202\003\b\030\007\242\260e\034&\ne%\330g;\301DB\254\231\2006\214\323\264\r\363\210\373j\265d\223\023\033\364\322\177\347\350`\342F\036uU\030\333\252&YQ\026w\325n\025"
+	.ascii	"k\204\006\300\242d,h\037c'\262V\n\214\244C\023\270L\203\200X"
+	.ascii	"\001l\316\205\260U\256\341b\013\234-\242\350L\220\215\"V\250"
+	.ascii	"\321\210\2379JU\303\250\343[[\312"
+	.text
+	.section	.gnu.lto_ioReactorAdd.part.0.42.2620135fba0c80b8,"e",@progbits
+	.string	"(\265/\375`\021\002\375\022"
+	.string	"\326%\202H\3200'\035\350\324o<I\003\001=4\023\336\224\256\034\003D^\360\336\332\021s\223`\275\350\342\251\035\026\032\326\317H\027\320\353\212\177\262\007\376\267\024:l\334\036rCo\b\003\036\300\371\bP\200V\320J\b\331D\356\224\002i"
+	.string	"j"
+	.string	"n"
+	.ascii	"*?\316nT#2n\007\036\253\264O\364\"\332\215j\036`7\310\350iw<"
+	.ascii	"\360\351\222\357\323\343\005t\237\337C\272O\373(\\b2s\355\243"
+	.ascii	"\211\035\036\333.1\241\271&\262A\247\250t\222l\354\216\341\247"
+	.ascii	"\226x\355*\271\232/m=6\327;]\212 \"1\203\251\307\303%\3109\017"
+	.ascii	"ew\375}\270\347m'\260\335bKW\312\235\333\335\265\006\331\226"
+	.ascii	"\366:\244;Oz~\374\271OZ=i\331I\177%s|\374\354\356T\341\330\021"
+	.ascii	"\023\352\304\233~\246\333W1\363\233\356d\217\244\031\323\354"
+	.ascii	"K22eo@<\355\216S\332_q%\332\227dR\026@Q\335P\276O\220{HG\363"
+	.ascii	"\223\354\361\351\037\035\211\366\0244\334\372p"
+	.string	"7\032\267]\036\003\237>\221Z9S\317\3421\036\\\352gh7\3476\225/\207A\001;\202\004y\233A\235\250\303x\231\260\"o[\351>;\355\360\261Y\356\302Q\337\356\"\360\241f(\370C\237~M\3679\265\243\350CJ\265[\242\274M\025\324\2406\366[dp\224?\344\373E\367)u\205$\243)\304\215\254\362J\332\257\013\335m\327;\375\233\242\341s\343\206\2436R\205\034\006\0203\002\236\270D\227\027\253\005t\215\200\256\026\320\345b\261\254\f\210\351d0\342\2148c\242\213\013\206e\301s\213$\006\223\265Xb\f\366\n\035@h\240\022\312\304\n1\226,\204y\261^\302V,&$!`\030\0061\026\312`\260X\350qn5\310w:\210\364k\235\247\034l{j\224\033\3051\r\267\013\244\340v$\253\254\252B\266i5v~\224V\201,\"U\003# p\002)V\253\r\3449>\321\360C\356"
+	.ascii	"\236\334'\"WA\230X\322\326o\202e5\226\343|\237\200/\263\367\200"
+	.ascii	"\242\235AeK\217]-\253\240I\f\226\275\037\332\256\376\324\376"
+	.ascii	"\2324,\007w|\t\342\"\247\316\364\331\345B\341\326K\300\242\326"
+	.ascii	"\376\023\314\030"
+	.text
+	.section	.gnu.lto_ioReactorInit.part.0.44.2620135fba0c80b8,"e",@progbits
+	.string	"(\265/\375`8\001M\016"
+	.string	"F\233aE"
+	.string	"\261&\035\230\223\356\351\367!\375\207O\321}!\267jd\255\202\250c\324\334\224\f\323"
+	.string	"^\326eB[D\r\n$\347\200\200*\343$A\020\222\016\377\013\204:\315\t\302\321\365\303\376\357\347\370\3054M6\2212\245J"
+	.string	"N"
+	.string	"M"
+	.string	"\367Y+v\310>\331\241\307\213\360Hd\305\340[4\252\f\266=\0229\031$`Ae\260\270\240\343\263\333\312\036\025\304\301k^\240\237\341\013\352z\326\263\203M\017\f\023/\032\236\037\2778Fv\327\240\rw\274m\005\266\037\330\347\020\366H\033\245\303\036^\317:\350\005O\f\0334Z\024\225:c\275~\255\312\330NG\216\364\205\2455\246\363J\277#g\bX\355\252~n\254\207\230\302f\304\2650\021U\003\305M\210ui\0350\305\370\334\334\317y\313t\034\277\207fu\263\273\246\366)G\265\332Y\375\340\001\251z\234\237\200\360\026\253\232\335\324C\022Pjd\300.1\311\207\026\245v^\202\202\266\345\303G\177\303\036/\355\200\t\220\251\366\t)\037\252\212\\\024e_\247\202W\3705\276U`\217\251"
+	.string	"H\270\340\211a\311\237\366P) J\020\201+\2214\t\"\004\334\247q\336fR*u)\\\t\t\210\267\020\257\3736\215\363:R\306\300\301\202\006\331\307\235x\332\227M i(\331\346\251d! \356R8/\373\272\316\313B\277Ve|\326?\322\007\261\250\030lG\365\b\213\266\250\3168\032"
+	.ascii	"\362J\2506\033\301\256\035.\031\"IE\007GReK@e\r \017\214p\305"
+	.ascii	"\270\322\304C\270\3160\036\f\006\303\307\030\3731Q\206\212\334"
+	.ascii	"y\327\314^\300~\341\\/),j\266\377\2042\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2620135fba0c80b8,"e",@progbits
+	.string	"(\265/\375`Y\002M\013"
+	.string	"D\020U\003"
+	.string	""
+	.string	""
+	.string	"\002*\177\034\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005!\035\002,\177\036\002\026\177\037\272\200\202\002\021 \200\204\001"
+	.string	""
+	.string	"\003\002\025\177!\023\"\204\005\022\023\024\177\026\270\300\202\202\200\006\027\177#\002\030\177$\257\377\372\006\031\177%\002\032\177&\033\177'\034\177(\035\177)\001\037\177*\377\037"
+	.string	""
+	.string	"\200\200\200\001 \177+\"\177,#\177-%\177.\036\177/$\1770&\1771(\1772'\1773)\1774\003"
+	.string	"\022\304\001\003"
+	.string	"\021d\003"
+	.string	"\020$\003\002\022\244\001\003\002\002\003\023\003"
+	.string	"\240\276\320\347"
+	.string	"\001\342\001\003\005\025\005\002\210\245\373\206\001\001\202\001\003\005\024\371\332\204\371\002\005\003\276\305\262\234\001\001\302\006\003\b\017\"\003\t\023\n\026\360\372\2508\001D\004\n\221\205\327\307\003\001\325\001\003\013\027\f\024\r\016\031\016\030\361\362\277\250\002\001\304\007\003\017\032\200\200\200\200\004\001d"
+	.ascii	". \320\002\231\272n x/\354\203\264 \344\212&\231\333|,!\034\221"
+	.ascii	"\257\240\205\211J\216A*\203X\f\275x\030\327#8\200\003p\004Gp"
+	.ascii	"\004\016\340\0308<\003\221\310\245\027)\030d/\355|\016\237[\177"
+	.ascii	"\331>\035\365\007t{\214\356\006\27312(\234\321\344`;\b\237x-"
+	.ascii	"\3229\bA%R \236"
+	.text
+	.section	.gnu.lto_.refs.2620135fba0c80b8,"e",@progbits
+	.string	"(\265/\375 M\215\001"
+	.string	"\322D\013\016\260\2459\f\303(\260m\264\251\021+S\n:R\3301\2728\346\304`7\327\016\232U\263h\211V\314N\026\243\210\300\312n\305\272:\004"
+	.text
+	.section	.gnu.lto_.decls.2620135fba0c80b8,"e",@progbits
+	.string	"(\265/\375`\227)\265\265"
+	.string	"\312\037\305?Y \016\235R:\376\247\246\322\245\312zC\315[$^MFVK\354\316\330\324\375\335\377\237\2432\330\374D\026\322H@\005\336[\233\350\271\275\300+x\346?k\255\357\032"
+	.ascii	"\b\225/-\251\277\032\007\345\355k?h\177\323\3771\370\007\200"
+	.ascii	"\017\350_;Y\275\213\250\266\206\366\226;\005q\003\350\003\375"
+	.ascii	"\003v9\347\0168\035`\230d\335\021q\300}cU8\245\r\234\2136\244"
+	.ascii	"\276\375b\347\rc&\210\021\274\255\276\032\260pMu\273T\370w\t"
+	.ascii	"\377.\361\355\035\276\215\202o\221`\f\322\360-\017\354\201\013"
+	.ascii	"\370\026\006\276\323:\341\245F\222\340\002T\224\"|\265N\321L"
+	.ascii	"\234Dc{\241\231\2554#\026\344\304\354{\233\361{\013~G\361\343"
+	.ascii	"\346\360;\0167\212\337 \271\212r\302\r\277\317\360\243N\334M"
+	.ascii	"\003c\250\034z\357d#O\220\005\300\2022(\257o\315\353\374F\326"
+	.ascii	"/\026\311\243\221 4sN6\362\306K\316\311\233Z3\2505\203\233\243"
+	.ascii	"j\313\254w\337Yxg\347\025\357\032\252X\227"
+	.string	"g\033\025\306\251\034\356\270\324!]nX}\251T\273\027\240\206\214\211i\254\t\277\231\270\346+\025K}\376H\315\222ozgAr(\373\276\207\360\013\362\217\364^\363p\225\233\272\027\2328\253T*>&Q4\",\370\225\016W\245(t\226\350\210\351\t]\205b\223&\005-r\004\277\256=q2s&\345\204\310Imr\223\025\007\367U\206_s\340\332\324\3025I}\241>o\244\306\275\247\344\344\314e6C\206\200\030\271\302\177A\275\221\336\353\024\256\\\365\t\327f\345\320\333P5\364\252\263\255\210\217M\255.E_(\216o\351\245\242G\337\327#\374\017*\221*vh\215+\263@\215\035\321\234\363\220\312V\237\225H\345\361:V\311\216\343\314\371,\347\374\n\366\357\020\251=\352\232u\322\310\331*\353FN\212\217.v9;;\340t\270\2016Qr\365\326\324n\240\240I\241\352[\323\236\226i\310\276\367"
+	.string	"\376+Z}V!\377\007\020\247B\2233X\316\331"
+	.string	"\226,\303q\351[\315\352Y\255\2032\243\352\331_uT\260\032\304.\215\232\271,gg\006\231\033do[\372\276\006\251<2N\245\253*\233\322\367Z*\220\3771\275$I^\356\372V\037\365G}\346\324\262\327\260\272\3431Jg&\313\331y\023\343\004\013\213\262\276/\001\277\346\364njN\357\017\3005W\016=\f;\370\325\371"
+	.string	"$3\210\303\3407\306\240r\350]g\345\320\303UC\217\303oM\360\327*\177\217\240E\360\326!\370;\205F\341\257\0338\360\267\001\376\206\300\337'\200\300\004M\177w\350\017x\340\257\311\277\262\340\257&\376\352\202\277\252\340\257\310\277\266\240At\340\277\t\232\003?\n\360\333\244g\320\314o_\360\367\001\376\336\200\006\242N\363[\240\2475"
+	.ascii	"2\260A\233\360\327\342\007\360\333\024x\271\350\273.A\004\177"
+	.ascii	"\375\375\225\004\177\005\236`\303o/\360W\252&a\355D\272\266\005"
+	.ascii	"dt\005\332G\201\037\340\267%\370\353\210\236\300_\315Z\002\227"
+	.ascii	"\371-\003\376\216\300\337!\376\346\340o\004\374\255\341o\374"
+	.ascii	"w\377\265\313_\243\177\205\373+\333_\203\374\365\307_\237\177"
+	.ascii	"\025\373k\216\277~\375\325\353\2574\376\232\365\327\255\277V"
+	.ascii	"\375U\353\2570\376z\365W\026\1775\341?\364\257 \370k\324_\241"
+	.ascii	"\376\332\364_\355\257\314\377>\177E\372k\322_Q\374/\373\237\302"
+	.ascii	"_\225\1775\3765\005\177\375\371\253\n\177E\301_\207\177\345\371"
+	.ascii	"k\360\257\"\376\232\201\377E\376\243\360\037\304\177#\377k\362"
+	.ascii	"\362\362\362\376\253\364\367D\360'\240ET\314%Y\222\231aIF\305"
+	.ascii	"\314dT\031CV&\225P(\263R\206LFe%\2235\231\030\226dM\346\222\214"
+	.ascii	"j\252\032Y\346\2711\277H\251\362R\255,\225\031\351(*\251\204"
+	.ascii	"!n\351l\346\271\234k\231PV\322 \347\250\246\322\\\262\251\252"
+	.ascii	"\005\305!\005\235%\233\325y\024T\325\314\312\270\245\215f\316"
+	.ascii	"6\202H\344#\020\220\316\270\214U\343\220VQ\331H(g\002dg\316G"
+	.ascii	"9#k\216\3139#s\316>\245(g\316+0,\271\216\216rv\3029\312Q\310"
+	.ascii	"5\241\234\273\214N\215\271$\253j\356\254\371 \343\312CNd\345"
+	.ascii	"\312sTJ\230\f\371\314FX0\027S\305\025\247&\232,!^FL\267M\025"
+	.ascii	"z\267u\326\327\252\260Kx\313\363H\026\273d[\250oh1|@iN\344)\311"
+	.ascii	"1\353\3232k\221\034\024\371\013\223]VR\342\340>\034\370\267J"
+	.ascii	"I\327\311\311e\2065\262G\026\351\"i\264\201"
+	.string	"\365m\247\312\241\247\200\242\235[#_\017+Hr_\r,\321o\227\026E#{S\236\300%\365\255v\225C/\001UC\317\n\355\334\016\341\235]I\366E\200=a\225RfnD\372\336&\353\323*m~\263\260\310,\215w\005e\225\235\327x*f\252`l\251\263\353\320\301\206\354\350h\331\273\235{Q\374\036\023\374\017\354\372\356\013F{\351/\365\331x\335\005\f\257\265\364\226\032\347\344\314)f\\\270a\341\262\253JU\236\336z\367\275).G\302*Z\366}\217\t\277\227Tw\2320\"-F\360\360a\264\340\303H\301\362#\267\315\353\211\274r#\267\006T\331\302J\024I\215fP\337w\264\253\264\\\0331AI\365\245\351);o*\327\360\205KQY\337\033)k\030\313\027)\250(umE\235\017\272\236\323Q\244\252\254o\317u?i(\357\271v\362\017 N\243t\366\334\3159Yk\0066\265f"
+	.string	"\003\325J\216\365\356a\2344\251W7\246L1\311\341\342$\350k\211\034\314\216\267\346\217\276r\rW\201X2.\374#hF\\+\251\317\226k#\215\244\223\364\013K\345\016\271>\3537K\306\025C\024\264\025\305\351\320O(\227U\357>\256r\350\321\034\371cd\220ly\342z\001\037\206\b>\314\031v\313\003\200\361\342rg$\206\205H\261\265Z\017\031\n\302\332a\253bSE\232HC\273\255>\233\255\323\312\330\032\255\002\251qe9\311\364\300kI\347\326\241\303"
+	.ascii	":\330\033tG\272dn\257\311X\301\261a\351{\230\"|\230!\374\353"
+	.ascii	"\005\377\332\341\337,\370\267J\020\263 drE\233\001\251i\212\363"
+	.ascii	"\322\325\267\313pd\230J\242E\372\376\322\341%u\256FA\252\002"
+	.ascii	"s\253F\016\265Qb\310\312\252\262\235\252Cmbr\246\212\302e\344"
+	.ascii	"\024m\201h\250\227M\264dE\364\203\250.R\246\324\350\022\035Q"
+	.ascii	"\026S\\z\250\303\272\210\204%O\035\243}4\215\306\321.\364\217"
+	.ascii	"vvW{\265V\333h\035\315\243w4Y\1775W\217\365\214\316\3212\372"
+	.ascii	"F?\033\254\305z\253\263\272F\367\250\317\016\253M\336V\355\342"
+	.ascii	"8N\026Rw\321\272\277OtP\207\265\320\006\326\251\206\211\306X"
+	.ascii	"4\265S/-\253\222O\331q\324HH\275\002\312\313\222\312\244>\t\n"
+	.ascii	"\253\333R\357j\234\023\206\254\034\303\342\352\240V\342\374X"
+	.ascii	"\"U\245T+U\313P\025\216(\025\225#\025I\225\033\023\213\036%u"
+	.ascii	"\212\2421#\260\246]\253`\352\245\020\204\224b\204\252P\324\205"
+	.ascii	"U/\235\264N.\237\217\240\251:\326\242\227l\220\031r\266\252\302"
+	.ascii	"\225\263\263\233\302\372\251\227\f\020\264\304@\r\274h\316\316"
+	.ascii	"\327\035\177u\013\353\253\306\252qN931\300\001c\t[W\n\247\211"
+	.ascii	"\274\222\201\030\326"
+	.string	"\216/v4VriZN\277R\277P\037@\\\026/\220\236\230\364\275Q`OY\255\r\377\256\270\314/;(,O#\220s\241\305\220\rlr\240%\333\372\336\246CcZ\030\365\030\322\3672\275J\315\331\023FT\225\263I\252\226\004\235\021\375\227\350\252\210@\031\235\333WM\262\rk\006\322\257\212\337\024-G\004\211T\272\314(L\202\024\351\201\177\223\226L=)\231qn"
+	.ascii	"\323%\364&\244\357=:T\001.\232D\373^#[w4\251,W}o\321\241F\222"
+	.ascii	"TMy]\345\257\320U\336\245\bn\026K\031\232\214;\364\273\204r\301"
+	.ascii	"T\336\0233/\360n\363\360n\022\247i\241`\335\310r\335\232\336"
+	.ascii	"\312.\3627Yc\203\213\026\260\2767\3474\211\231U}\271r\3456\313"
+	.ascii	"\025\333\245\001stn_5,\272\236\236\334\335v\371o\2444e,\365\265"
+	.ascii	"\\\016e\373*c\366\265v\207\276\b\255\006W_\273\345P\270\344\211"
+	.ascii	"'uC:\322\204\324i\261Kr\"\322W\313\237c\242S\230\340\350k\261"
+	.ascii	"\314\035\371\217\330\250\365R\235\331\251\211\264\262s\003\212"
+	.ascii	"S\216\215[\013BeLn\243\267U>\2008\324W\345\f\363\322\327F\261"
+	.ascii	"S,\225\254(/'\342\260\225\322A\263\270k\341\305\211\f\f%Z^P,"
+	.ascii	"\335\037SS\226$\244\350\r\333'vn\206\211\214\311\227!\3306\261"
+	.ascii	"N\222FXd}\273\036\332\273\007\032<\030g*\372\3328\273\244\343"
+	.ascii	"Z\330\235P\"7\263\266\225\026E\211\225\203Y\263*b\342"
+	.string	"\244\313\332\234,\360^\360\265\310\332J\2414\267b(\t\022\035-\\e9\301b\326\272x-\231\025\271u+b\341p\232H+\"\274\341\350*b\227\227N9>\262\273\345\226\267[\270%\273\206\266\266\343\320\273\264\246\243-\006>\332-\0214\313Vy\274\325p\263\313\313\250\034\032'9\200\320`;\333\3252\rI_\273v;\344\217\3515\273\025>\220\260M\273U\373cbR\fm\241\020\362\307\330\244\252\023j}/\203\304\217\211\0029\020\033\244\346\234\263SFZ\311\t\343\352)\241\262\004\311\3546H\017\271*\2724\251\214\214\215\331\0378\343\210\363\235x\001\357\213\217\333\037ZfVJ\372\332\036vi\203\226\n\264\276\226\254\256\005\201\261\341\210I\303\317\247\365\302\271\021\367\205\311\316r\031Y\035y\202\201Y1\214\334\340\205\233O\234\336v\334\212yAC~\365\265av\311\346L\310\024\035k0gQb"
+	.ascii	"\361\3029r\330/\f9hI\f.\232),!\255\0277n\330\257\035\347\027"
+	.ascii	"\246\257\231&.v|\371Rbc\206\331\n\334\325e\275pN\213^+?\254\274"
+	.ascii	"\260q\353e\263f5\264\214!\242Q\237\226\206\225\252\316\2344\203"
+	.ascii	"\245$\307\301c\222\370\036\252\335z\332\255C\25733}C\321\314"
+	.ascii	"\301\361]\f\253\025\303f\311\220a\263d4\033\206\233\032\013-"
+	.ascii	"\267Y14\272\252\214\244\340\3436\030O\013\243\315p\320\262\231"
+	.ascii	"l\021\002\364\351*\205]\316n\034\310\3109E\261r\340)k5e\257z"
+	.ascii	"9Wg3I\351\326\305\355\025L3\311\254\216\tt\n^\263i\2530\262j"
+	.ascii	"\2519"
+	.string	"\345\310|%W@Q\335V\365\034\r\n&\253\036}m\013\254\205\217\237p\234\315\314PZU\220v\366\234T\315Ay\262+n\241\236\026\3126agN\362aq9)\345\034\033\341\277\377^N*\345\234S\3008\263R\020\315+L\2559\177M\265U\203\3777\333?\207\004gF\346I\311\202\273\322\222P\030\344\303\304\345\254\244BJ\200\212\251\244jZ\222Qe\244r\0062\203R\246B.\311r\316\220\225J\244\005\2329\303\222,3\363\t%\314\232\235T\310\254l\346\fY\231\223\030,\225\001)qhy\200B\343M\177<\303\340\3577ccL\205\307\037O\317Mz\034\022\201\216\276\017\013\3301^\230\343Q\030\f\002{\037\026\260\263\302M\207\300\025v\204)Ph\2549\t\017<=\013\340\351\361\371\244\301_\214\217\017\020\221X$\372R`\tc\261\247\327\223\022\207\306\237\036\337Ix\030A\034\032\323c"
+	.ascii	"\214E\243QhL\217\370$<"
+	.string	"\244Gb1\b\323\003\024\372\334\025\212F\022i\221\350#\026\207)\260H4\032\205\277\037\006\341\b\036\241\317\nE\242\n\301\tlH\2418\234\361\001\022G\fQ\250)\016g~\212)\nD\240\023\204&\212%\204'\334\214 \016\211D \243\217\247\004_M:$\232\260\341$<\024\207<\351\221\203\321(\344I\217=\032\017<\244F\340\217\007\036\236\t\234P\034j\240yph\024\022\205#\360A\b\321A\210\020X\360=\204\021<\030\301\203\336C\030agg\204\020;\370!v\354\203$\374\024\323c\314Ixx\200q(\343\0034a\024\246\304\341/m@P\370s\304\351OXb\230\376~8(<\376L\244\275\3647\202X\3649\376||\200\301\243\n\216\277_\206\240\360H\374\231H}B \037\240\211_:\304>\305\"\005~0<B\025\202\300\237\336\3141%\nM\b{\351\217\346$<\350\034Up\354"
+	.string	"B\b \353\343S\374\021\312\030\323\037\373\341\003 {\357IxH\203@\306\364\250s\024\376\250 \3259\246C\021:@\304\021\035\260"
+	.string	"D\034\372t"
+	.string	"B\210_\210\020X\320\021\362"
+	.ascii	"\371\004\211C\035\343\021H\207\001\037"
+	.string	"x\204G \"\320\017\367\214\351\017\r\017Ph\2641\246?5\351\320\270B\017\020M\017\220\210\231\032\341\021(\342\367\003t\303C\024\376\204&\200G\232\243Q\250\202\021X\342\207\211C \211\340\257W$\n}\206=?\337\207\343\b\240O\317\317\227\376|<>\305\337\f\261\004\220O1\3703\002\005\1773\251\360(\364\021\001LM\374l\214@\022\301\333\003$\"5\026I\034\1771\351OF\205`\321\007\204\020\277\230Tx\354\351)\376|3\251\211\240\220\247\030\374\341\032`\n\344\371\ty\206+\374dH\330\200\t%\374<`\302\017\247\307\241OM\017\220\210\337Qh\024\n\215=?\232\364'\\\301\360\330\003\301\003\374\371\375zB\236b\211\037LJB\001/\376\b\215:i\261h\324\2311\246\037\250@qX\223\376>|\220\022\207@X\205 P\204\217\0170\210\217?\243\320\207\207\b\304@q8s\021D\250"
+	.string	"\006!\350\300\005p\320\203\261\230\006\201Bcq\250\263\201\024L@A'\025\2160\002S\035\342\020XB'h<\352x\320\200\247\247\335\210V\030\025\201\266Eml\234u\371*b\341\226\252\216\262\323\351\311\027+l\226\r\323a\t\022D\244\207\304\234\200\252be\310\025\223\021\323\322\246c\355\n\261\221\362\202\t\0245\0319\204\030\315H\273.\300P}\335\240\341T\326\3608\022\202\003\315\262H1\345u\343\354J\305\024)\341\204\202\\\025'\326\250\324"
+	.ascii	"\342\264I\362\304\311\034\021\374\337\262+\032.E)\234~\330.7"
+	.ascii	"[Gk*|T\365\242bHk=\222\255\365\302J\023\262,\n\\1rq\307\356\222"
+	.ascii	"\006\214G\235\324\345a\245P\034\311\273\317 YBJ2\372~}]\2610"
+	.ascii	"\034=\031IN[t\374\212\375\356HR\026y\205]\260\0344pmcI\372^\034"
+	.ascii	"\237B\003\0264\345$D\353wK\353\272p\253\314Ro\\H\216\020\321"
+	.ascii	"y\375\272\020%\271$\326\367r]\033Dc5\330\372^\032\267F}\036z"
+	.ascii	"\273\306\204\264\300"
+	.string	"x`\026|yyyy3h\272\232\277T\315+\303W\004EITC\031\322\224\2721~e@\251j\270a=\315n\3008T\271\346\334\352{]\334\027\026\212\264\232{q5s\325B\027\323\211\333\266\274\210\273VZt\340\220\272V\267\312\nE=\231n\225\3152Tx\3208\353{[\324--\005\203p\250R\3418\310\002\2252\206HHd$I\222\016\262\n\020\006cq\240\307\320\016\022@d9N2\251\314\214\210\210\210\222\242\244$),c-\025E\030\003/\037\321\n\003y\360x\023B\264P\322\320k\304j\372\032\335\253\217gK\013S\342o\323\225\215\245\032\245\202\214\223f\211\223N\022\345\202\b&\265"
+	.string	"\260\372]\360\367\214\302\342\356\213B\261\037\251\214\331'5\257i\260\264n\327\250\242\302\001\222\005,\277\201*9L\314\336\215"
+	.string	"\f#\2742\301\"\214]\221B\317\326\317f3Kg\261R\332\324\347\2620o\373/\344\235@\344\202K:E7\370\366\372Wv\031\346@\342\242\256\2527\301C\201of\336/\252\307\177\2662z\216avGM\030\017c\004\317\025"
+	.string	"\246\251\377BI\007.\275\2147|\357\034;\257\020\333\207\342i\330\241\322|\035iN\360~\364\030\273\037I\332\325\001\244:\365v\203\"\371l\3218\331\234\350f\031U\002%=\321\013\027\314\313\270)\210\372j\277\034\344\311q\034\253k\372\235\375\213\276\351\\\227\355B\305:\263L\320"
+	.string	"\016\204l\036\035.\272\242\003\001\022\310\242\374\210\203\207PY~\024\362\023s+\375\336\334\215FM\307\334\036\271\317\232\220PV\343\271\374S\023\361\271;\2733\276\365\177\251d\316\370\264\363\253%\314\004@\377p\311\305H\211&\236n)*\\y\263\213\260\374m\223.\320\364\250m\241T%\270n{\032\242\222EsJ&H\311\322\363\243'\350,\334\262\036\353_\375\t\273X\307\025j\305\346\003\323\305EC\022\300\206\223?\205b\013.\243>\256\001\001\257\227\242}@!\373\340\330\233\206`l\216\2051\303\205+\n\365\310\323\357\257\270\201L3\030\234\\`G\033o\371\"\032\177HD#\f\223\243\004\265\355g\250\261\276\200\255=\027\264g\222\207\234\352{\267\020X\307\226\203\0211R\2048<\227*}\235"
+	.ascii	"\022\rf^\356}\f\034)\r-E\2310|\352\024A?\330%\260\013\n\227\321"
+	.ascii	"6\264j\370\036\266w\304\374\252\227\004\034\021\227d\341q\341"
+	.ascii	"\216\335\330\205\222\024$\3237\023\235g\356\347&1\2318\002\264"
+	.ascii	"9\362\230\320\022\215a\214\364\317\3608\234\274\022\342\251\320"
+	.ascii	"\033\006'\326\034%W\006\3340\2306\356\037T\213\351BU`\002\376"
+	.ascii	"\251\005:\247\315\242{\355\026`\026\255a\335\234\326\256\023"
+	.ascii	"\f[\362:\242UX\020WsA]b~\272eN\001b\2468L\362\346\212M\377\020"
+	.ascii	"9\306\b\336\001\022\342\033\024\211\375C\263\320n.\355b\212^"
+	.ascii	"\031\333c\215!\276\273\340\342M\\Y\003\254)q'K\335:\235U\254"
+	.ascii	"p\034\"\353c\322x\266f\243\030\354\031\331\213,\216X2\f\224\030"
+	.ascii	"b\321X\356\3431MV\213\342<Gr\320Q\216\362\215\267\251\244M\016"
+	.ascii	"4\205PG-\361l:L\362\216\026\277H\025\227\240@\202n\230-1\332"
+	.ascii	",\001\366\336\204\023*B#\003\254\262&\346\034N\332\021!>\016"
+	.ascii	"\366\365\317\270\277\374c\356\301\222\027\356l.\276\263\264\275"
+	.ascii	"'\374\375Y\013\330\2053$Q\033\256\376\341\266+m\331t\024\267"
+	.ascii	"\260bT\206\234\272\035\024mrrM]_5b4\271\332\314\350Q\266\232"
+	.ascii	"1\b\317>\0070\215\230B\003x:\231\272\331>\263\037\026f\330H\346"
+	.ascii	"Y\270\303\354\236\343\264\244\267\"e\347fp\216y\244Y\232Ffh\017"
+	.ascii	"\302\225*{\307\275\"%\321\320Y\217\3060\206\211]\005\365\253"
+	.ascii	"\2649\013\367\231\312\262\346u\317\224\r\346\265\230\371\242"
+	.ascii	"\277\314\344\245\336,(\034\324\343\024F6\317[4\320s\207Z\310"
+	.ascii	"\013\206`\345\037\233|\344\302h\"k \226\306\214\301\005Gl\005"
+	.ascii	"\025\321?\376q#\221i\007\034\370\343 ^\032\350\263M~\201&\371"
+	.ascii	"\020C\261N5\350\267\226\2703]\244\037S\2236\204n\347$q\220\207"
+	.ascii	"\253\253\337\300<S\036n\312\273\r\277#\035\354\350 \350x\222"
+	.ascii	"\313\216\300\327\346\305w\274\035\244\n\356N\377\240\3401\255"
+	.ascii	"g\330>\330\233\020\244cA\"Z\275S\007gr\216\344\330_\302\367\315"
+	.ascii	"@\321\342%'\316\245\025|\260\001\001\034#\347}\034v^\321w/\201"
+	.ascii	"\267j\363\\\335|D\354\177b\202\257EN\353\253\t\232\312\013\211"
+	.ascii	":#7!\343\0052\005\001\222\314\222\231\201\251\355\001F\002\355"
+	.ascii	"?\325\320\3516\305\177\202+\t\247\333[#\360\262\313\255\334\211"
+	.ascii	"\"\234\304{h\212\261\t\357\221(\351\204G\233\331\232>\016\311"
+	.ascii	"r\237\022U\210\032$\314Ulz\320m\2648"
+	.string	" =\213\237q\200\030\315O\373\230W\021\021\003:\200\336!\200.L\224\323\241\2536\261&\355O\003ga\274\211\366w\016\331\211\250e\237A\341#\235[x\03137\306\246\216\352i&86(\3124\276\217\2731\232\031f>\273I\365 s\020\002\251\025@C\260'4\005_\223\353\305jlo\331K\343?1\215r\371\207\302\240\251\t0\267\3758\020\332\333\324\b\\+\272\0205z\304Bu\"\274J!\207J\315\317\357\271\251r7\340\263\305S\024<%sAb\365\313$\320\311zj\215\273\017\330P\221\253o+''S\037P\2203\326?lt\t\007B\215\367P7\254\333\312\003R\2074\326\007,E\241P\273\250$g\253\345\212\026\337\224fP\257\213\032\356\352\260\177\250\220\017\322\315\331\242\003\224\200\272Y\330\034\325\251\032\344!\213\333:\367m\\N=\204\303K\3711\312Vl\262\351X\303\223\371y"
+	.string	"`\026]\224\243\301\317\364 M\"3\016/\205\367H\366\257\325\017%o\230\016\337\241>{\037\206\027b\006'\031\306#x-\357g\254\003R\361\312\324\246\002\276T8]\375\376\036\230M\3741\377=\377C\177D\354b\344\333\334\337\334Y\201]\227\267\264S\225/\305\230\260\362\351\316\355\025\354]\357I\243;\216\007\205}\357\363\200#};\t\361\001>oA_09\360Y\313\322!\357\377}\030\316\204S\270Z\224|w\305\037\322\221\244\036\326\247\321\214\352\360\362\334\277\217\222\023\241/\265\rc\366\240|\241\223\373\221\356o\371\f\206\336\277\374\345f:\211r"
+	.ascii	"\334\305h\354x\f\355\246\362\020?\031\035\033\304\232\ngOw\204"
+	.ascii	"\375\334K\215\366\023]X\235\030\275\203-@\364\204\316\244\023"
+	.ascii	"\216\367w\240]\375\234z\347\351\337\375\360\301<\366\344M\263"
+	.ascii	"\320\345\355\005\367{`\354\207}\247\025"
+	.text
+	.section	.gnu.lto_.symtab.2620135fba0c80b8,"e",@progbits
+	.string	"ioReactorAdd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\001"
+	.string	""
+	.string	"ioReactorInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\001"
+	.string	""
+	.string	"ioReactorRemove"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"ioReactorRun"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\001"
+	.string	""
+	.string	"ioReactorStop"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"ioEventInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"ioEventSignal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\001"
+	.string	""
+	.string	"ioTimerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"ioHandlerAcknowledge"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\001"
+	.string	""
+	.string	"stderr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\001"
+	.string	""
+	.string	"__errno_location"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\001"
+	.string	""
+	.string	"strerror"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\001"
+	.string	""
+	.string	"epoll_ctl"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\001"
+	.string	""
+	.string	"eventfd"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\002"
+	.string	""
+	.string	"epoll_create1"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\002"
+	.string	""
+	.string	"epoll_wait"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\002"
+	.string	""
+	.string	"write"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\002"
+	.string	""
+	.string	"timerfd_settime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\002"
+	.string	""
+	.string	"timerfd_create"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\002"
+	.string	""
+	.string	"read"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2620135fba0c80b8,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
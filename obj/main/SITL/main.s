@@ -0,0 +1,320 @@
+	.file	"main.c"
+	.section	.gnu.lto_.profile.dff0611eeeec02cb,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.dff0611eeeec02cb,"e",@progbits
+	.string	"(\265/\375 \033\275"
+	.string	""
+	.string	"\210\017"
+	.string	"\002"
+	.string	"\250\307\261\277\001"
+	.string	"\001\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.dff0611eeeec02cb,"e",@progbits
+	.string	"(\265/\375 <U\001"
+	.string	"\3100"
+	.string	"\001"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\020"
+	.string	"\007\003\001\001\002\001\002\201\f"
+	.string	""
+	.string	"\t"
+	.string	"\006"
+	.ascii	")\2026C\fE\227\0136g\370\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.dff0611eeeec02cb,"e",@progbits
+	.string	"(\265/\375 iu\002"
+	.string	"T\003]"
+	.string	"\001"
+	.string	""
+	.string	"\017\301\377\377\214\003n\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	"\002\013\001\001\n\001"
+	.string	"\003\f"
+	.string	"\220N"
+	.string	"\002\013\001\n\220N"
+	.string	"\220N"
+	.string	""
+	.string	"\t"
+	.ascii	":\007\244\004F*4Uw\244\020i\352\324\246e\260\f\274\2016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.dff0611eeeec02cb,"e",@progbits
+	.string	"(\265/\375 \223}\003"
+	.string	"bF\026 \240'\351\377\377\017\352\377\207\247e\265\026\233\323m\177\312?"
+	.string	"\030r\32608\317\355\226\354\266;\311=R\323\024\020\005\303(D)\213\202X$Tz\322a`\217W,\236 3\363\342\016z\007\331E\273\325'\320\330"
+	.string	"\270\266\375V\362\255\233\314@f\333\265\217\267^B\333%\007"
+	.string	">\203\220IJ\316\035Q\3312'-\337\274o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_.pureconst.dff0611eeeec02cb,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\264\005"
+	.text
+	.section	.gnu.lto_.ipa_modref.dff0611eeeec02cb,"e",@progbits
+	.string	"(\265/\375 \030u"
+	.string	""
+	.string	"0\f"
+	.string	"\001"
+	.string	"\002"
+	.string	"\002"
+	.ascii	"\200\340\r`\001"
+	.text
+	.section	.gnu.lto_.lto.dff0611eeeec02cb,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_main.13.dff0611eeeec02cb,"e",@progbits
+	.string	"(\265/\375`&\001\265\r"
+	.string	"\246\331[D\020\221\223\016\213\032\362"
+	.string	"`Ti6u\234R\304\343"
+	.string	"\215R\311\356n\333\002Q\240\016y\225\007iB\337\253\315\242\b\322j\255M[I\375\271Q\005\024\240\340\233\264\322\210\022\344W8\367\321\330\032\331[\312\224\002F"
+	.string	"D"
+	.string	"G"
+	.ascii	"w1\2149vA\254\250v\267c\002\233\307\247xKg\303,8\201$^\230^j"
+	.ascii	"\354.v}\200\365\b\017b="
+	.string	"\252\bkv\207\232\235\217@\345\320\303\225\223\242\362\324\214\354\256\363\224\322\341\216\267=b\233\201\375\r\001\237\227\032\302~\324@#eE\331O\375\326]\376\b\323\251\351{\214L.\004\304\330\3450ccWQ\206\t\333\235\335a;\323W\361\025g\321=u\341\001vQ(T\273_\307\330\2679\210\365\317\346x\264\201g\376\274\303\335]\365G\246\276\305a\220x\214\330E\371i\302\006E\301\201G\333\223]\327\324\216\351\006\206\2341\200\264A\241\374\351\252,'8i\213\264\225\225\211z\326\244\245Qm\256\224?\371/\217,\037dbN\324\263\003\346p\245R\201\213\202\246\221.Rh\024\"\021}H\234\005NBH\205\354S\302]\240\315\263\311@\233\007:\023\031\205<\",\3338L\344\303Z\311g\303H\232\266a\035\032_Q>tH&x\003\313v\360`\306*\003\204\226\b\232UB%\023c\242\336\003\033"
+	.ascii	"c\306\212\272\306\266\326\226\230\0135\341i\336\201|x\fv\206"
+	.ascii	"j\265\206\305\217\310E\204\210\t1h\036\034\316F\250%;I\023\304"
+	.ascii	"'\304\204\217<e'(\213\001\225LM\331\207[o\263\021\340\306\025"
+	.ascii	"\212\023"
+	.text
+	.section	.gnu.lto_.symbol_nodes.dff0611eeeec02cb,"e",@progbits
+	.string	"(\265/\375`)"
+	.string	"5\004"
+	.string	"\242\006\030#\220)\351\277\233\3577U2\317o\337\253\306Ge\016\261\313\315\364y\f\300\036\370_\374G\255\221M6\331)/(}v\271\317\"S\231\231\3523\n~\217\3659\232\217\341|O\t\203\026\0045\004z"
+	.string	"\024\3414a\177\312\314_d\232*\f\202\254\361\307HV\276o\231\030J0\021\366I\2775\002\017"
+	.ascii	"`h.\263\300\021\320\bK\310\327\\\003\324\003\200\003\200\003"
+	.ascii	"\200\003\200\203O\360H\t\206\313\227a)2"
+	.text
+	.section	.gnu.lto_.refs.dff0611eeeec02cb,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.dff0611eeeec02cb,"e",@progbits
+	.string	"(\265/\375`x\b\3052"
+	.string	"\nZ\b\024F`^R\007\251\013\343\016\023L+\b\356\207E\025\264}.\265\270\003\022g\373\340\2159\214\343s\271\325\236\370\227"
+	.string	"\212;\020\20029\027=C\fD\213\233\251T\266q\205\035\245`\273\034\212\031}T\273\335\277\211L)\f\001\037\001<\001^o\025\267\356\365\322\346\313B[+\177U\207\365b\336\210\363r\226\343t\245M\263\332~\326\355\\\274\213?O\374+\377\337"
+	.string	"\317,*\207\231U'\332\202\324n6`}\267\342\367\261p\224\257\256\254\032\360\001\253_q,\036f\344Y\332\311\\K\367\224\361C\377c_\357\255\216\017\262\254\0269\201Um\300\266\033\255>7Z\273\035:\026\324\003K\023.\253\355a>\326\355T\034\314\237;\367\n~\262\377x(C\224\036o\262\352\261[i\177\272X'-\365\256}>\330\377\373S\t\376O\372\3237\375O\372\334\031\2703P\247t-)[\325V\300\266Wi"
+	.string	"\311_\352\314v\354\004V\326\007\254\335\035u\237\007p"
+	.string	"\335M\347?\335\255\306{\335\276:\333\335\016\272{\304\201n\377\352v^w\357\351\356iw\313u\367[w\273uw[w\263\235uw\227\356\326\322\335c\335\035\242\273\003t\367Zw\347\272\272\272\272\356\366\352v\252n\236S$X\027\343c\200\3408cU\262\332Y\204\003/bG\214\363\307\213\316\251$\253\016\246\303\360\264\232O,Ym9\207vw/\300W\0265\261\254\366\0076w\257\237|\377\337\206O\374o\025P\273\217\273Qw\220\357\274Aw\253\377\335\275\013F\277jj\207ur\226\354\221\325\356.\372\243\307"
+	.ascii	"\277\257L2\207Z\270\320W\350J\2249\343\223\357\220\033\377[\210"
+	.ascii	"\337W\306p+\364f\232\257\253L\276B\017\375\326}\370\213\\h\322"
+	.ascii	"\306\307M\346\220\0337\231.\264\311\024r\241p\373\0173\375\215"
+	.ascii	"\223\255\253l\352\020r\241I\346C\233\355\220\013EB\007,F\230"
+	.ascii	"\2263q\225\217\265\344J\276BQ7\206_\372\357d2\376m\360\317\005"
+	.ascii	"\277\322\244\016\367R\025\305\2522K\302\036\377\377\201eU\027"
+	.ascii	"\374\312\250\373\004\376\177R%\365K\2456\216\276\021\217\266"
+	.ascii	"B\270\376J\306?\202\217\377\227\377\255\177\364\377\333\377\347"
+	.ascii	"\275\\\361?\017!\327k\271\374\337\"Z>W\213&\343?\223\271\361"
+	.ascii	"\302t\241]0\022\032\026hqJ\344\310\300\332\356\334\361\351\232"
+	.ascii	"E\217\021\"Cpdu\332\235\264\344t\025r\354\330\312\252\3179\036"
+	.ascii	"\017\3535\317\323?B\312\200\251\243\3066\f\357\265\265s\231T"
+	.ascii	"\352r\252\025\320\267\317\317\342\3250\373\2426\227k\224\301"
+	.ascii	"\275i\227k\267\363\303V\344\205\313\252\323\3618\257\203\306"
+	.ascii	"fJ\027'\333\3543\007\223)\307\347t\367\274\n\217-1\206\260\036"
+	.ascii	"\307\245B\350\324\202d\325\341@\310>\362\004\231\302\025I\223"
+	.ascii	"\004JV\263w\230\265\335M\020\330\0226g\334\264\361Q\301A\304"
+	.ascii	"\031\203\365\320\350\240h\375x{s7\"x\267\206-kn\007\007\210\324"
+	.ascii	"\031\247F\215\273\371s\001\031V\234\024_\333\276mV\335\315'\315"
+	.ascii	"\023%eZX4h\274\315\237\237\345Y\352~\313H\035\223vdL\264\275"
+	.ascii	"\255\343\250j\304\336\244e\353\231\254i\236&l\267\263\265\207"
+	.ascii	"9\233\227\251\312\370\231\353\225#4\322\346\376U{0\224$\372\325"
+	.ascii	"\262\355h\236\326\376\245\273\277\370\232o}+'\240\225c\2455\367"
+	.ascii	"[R\214V/c;\264\302\264\257\265\227IZ\3520@\237`\375B\203\365"
+	.ascii	"Ts2\335\275\235s\216\215\225\254v\307\024\306\013\302\243\021"
+	.ascii	"\370\301\247\"\237\224\230\224\230V\004\265\324Qq\b\205<\376"
+	.ascii	"\204PTSA\342\360g<R\375\bLMQ\021\211E\"\017\t\\a,F\255QH\342"
+	.ascii	"\320\310bm\251#\006F\341\024\025\224P*x\354\r\211\303\247`\324"
+	.ascii	"/\030E\244\"\bD\301\242X\344P4\262\360M\001\205\306\247#\024"
+	.ascii	"\261\030\024\036\213\306\340\260\303\013\340\224\020\252@K\035"
+	.ascii	"q\b\261\001\304\017)La\004\"\213T\004\213SNBc\321i\205\020y|"
+	.ascii	"\001\302\327\002\272\310Bh\374!\213E\343\017\300\361(\f\006\201"
+	.ascii	"k\211\"\022H&|\324\016\016\215B\2420\005\333JL\020\230&\270\340"
+	.ascii	"\365\204\246\bM\021\326\236\320\204\204\324\304\204\3046\023"
+	.ascii	"\322\016\371\224$\001I\034R\261F\240TPm\n\024\234\212Dx\320\300"
+	.ascii	"\006\217\210C\340\212_\320x\374\035\r\275mP8<z2V\347,\265M\353"
+	.ascii	"\306-yA\234Kl\264y\177\244<\254\356\\\311\371\314\300\270\234"
+	.ascii	"5\246>bg\304 \241\341n\252\226\035E\272\362\214l\005\364VY\013"
+	.ascii	"\313j\376\374\331\212\b\336\265\271\242\221&e}CGI\215\234\354"
+	.ascii	"l\325Y\206\233\272381rUV\346\366m\317\03681\254\200\243\250\201"
+	.ascii	",e\020E\310\310\214\214\204\2214I\007\220\002\021\251+z\022@"
+	.ascii	"gA\316\346"
+	.string	"\250\240\222=\366\r\315\257\003\225S\203\0042\302\202X}\002\321=3\326\007\230|\231\\\271*\375@gFK\337\230~aSxy\231Z\222\350\205\227A\243U\214\264\353\343\352:\342\341L\360\354I\220\311\303\t|\231\001-\201\304\3416@W:\326\224\350\211\216\325\277\2322\352hn\215\343~}jP\362;Ys\202k\234\223w\324V\260\256f\357\237,\"I\253\244\256\231\3048\245\314\303\2313,\211\333\\\030\315&C\303\016vZ\377 #9\204y\fd\274\035=3>\007\256\362\275\025\244\204\267\257BT\242\326\247\025\036\341\002\0379K\035\321\211\344^\214\346w\002&X\334A\373,\025\210\305\320\211f\226\t\242e\342\241\333\346\004\022\267\225\fV#\2160Pi\247\210\001\005nI<\007%\203\351\316\025d\200\261\375\033Y\263\204\254\372jVF\n\n\307\313\311 S\265\004\251\021\3221\254Z\006\345\016"
+	.ascii	"\033\325\371\263N&;\317E6C`h\247<\333FJ3\005\026\240\346o\200"
+	.ascii	".\262\375\334\354\272\225\330\355\337\305\356a\361m\302)\344"
+	.ascii	"\301\254}\253\250\276\304\374\001"
+	.text
+	.section	.gnu.lto_.symtab.dff0611eeeec02cb,"e",@progbits
+	.string	"main"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333"
+	.string	""
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335"
+	.string	""
+	.string	""
+	.string	"delayMicroseconds_real"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341"
+	.string	""
+	.string	""
+	.string	"processLoopback"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344"
+	.string	""
+	.string	""
+	.string	"scheduler"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346"
+	.string	""
+	.string	""
+	.string	"micros64_real"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374"
+	.string	""
+	.string	""
+	.string	"init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376"
+	.string	""
+	.string	""
+	.string	"targetParseArgs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.dff0611eeeec02cb,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1212 @@
+	.file	"msp_serial.c"
+	.section	.gnu.lto_.profile.bbc6afe10dbb3aee,"e",@progbits
+	.string	"(\265/\375 \fa"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\003"
+	.string	"\b"
+	.string	"\n"
+	.text
+	.section	.gnu.lto_.icf.bbc6afe10dbb3aee,"e",@progbits
+	.string	"(\265/\375`\213\001]\n"
+	.string	"d\r\177\002"
+	.string	"\026"
+	.string	"\255\337\201\276\f8\002"
+	.string	"\002\001\002\003"
+	.string	"\001\303\266\246\210\b\002\002\004\002\004\002\250\323\322\230\016"
+	.string	"\003\251\313\301\226\005\020\002\005\002\005\002\006\002\005\007\002\005\005\002\005\004\324\236\263\201\t\002\002\b\002\001\005\352\365\241\216\006\024\b\b\003\006\312\353\242\344\003&\002\t\002\t\002\003\007\002\n\002\003\t\t\003\003\007\343\250\203#\004\b\002\001\b\345\330\264\267\006\"\003\013\005\013\002\013\t\240\342\234\212\n\n\271\250\226\247\016\030\b\013\307\265\341\252\005\f\002\r\002\016\002\017\002\f\f\016\372\255\332\201\006\002\002\001\002\001\017\354\223\345\260\f\020\021\234\266\375\273\005\022\335\366\260\261\n\002\023\245\216\253\325\016\022\002\003\002\020\005\024\240\374\360\342\r\004\025\310\220\367\361\026\240\342\234\212\n"
+	.ascii	"7 \240\202*\032\362\023\016\355&\314\334\020\344\366$7\303\f"
+	.ascii	"\266z\024\327W\274\tHI\200t\306\272r\b\254\001\260\255K8\013"
+	.ascii	"F\325\227i+xkn\334e\307\337\327\252\025\307\306Fo\013\344LP\340"
+	.ascii	"\265C\003\036\002\313r\n#Rn\232\360n\233\266\356A\206\223\271"
+	.ascii	"\323TC\317\030\2556\313\007B \376p\b\306\034\303\306\201\305"
+	.ascii	"\364\340r\357\236T\200!"
+	.text
+	.section	.gnu.lto_.ipa_sra.bbc6afe10dbb3aee,"e",@progbits
+	.string	"(\265/\375`\275"
+	.string	"\225\005"
+	.string	"b\006\021\027\240'\351\377?\216UUUUm\330\377~\373\316\354\247f\333\2262\245\252\377V$\344\020\233\350<8+L\030\274\366\021\350\263X+\001\3510~\210\345b\221A\013\221;T\001\374\330\315o\232{\312\304\033\0011 p\202!:\273\001\266\001\345\013@\362\260\f&\022D\202\350\002\007\361\220ZSb"
+	.string	"\016\300C\307\016\201n\206)\030\367\212m\027\315\033[X\220!CYm\034d\334trI\315\300\2405\246/\361\305\332d\205\351+\316\332-T\310\262"
+	.string	"\213\034n"
+	.ascii	"Ze\fa;\013x\001\0275\304\313\020i\301H\252\251o\233\311dR\270"
+	.ascii	"!"
+	.text
+	.section	.gnu.lto_.inline.bbc6afe10dbb3aee,"e",@progbits
+	.string	"(\265/\375`b\b\r\""
+	.string	"\306\255\231J\260\226Q:R\027\250+x\322\302.\357\322'\230\350\272\301\200\207\221\360\347\f\n:\236\001S\257\215\220\202\0305~\266\314/\307f.\376\311\324\353\345_\3246\246v&\355\016v\214y,\230\314\360\337\376\344\307l\227\374\275\245L\001}"
+	.string	"y"
+	.string	"\214"
+	.string	"]\n\251\202\356\232\372\221v\311F5\200:\304W\245M\303<\250\027S\374Zm\230v\033\376u\267\352\\\273\3177\356\356\336\363\0317\207\303\241\024\361\257\320\335\274\037\301\277\177\340\200\234\227\361\306x\231V\306\024\366\337\337\316\376\rd\376\034=\373[\030\357\304X\030\353\250\350\344\265\355\332\376\002+A\2241\317\276\234\253\2640\356\371\313\371\235 \302\230\347\263\257\216\177"
+	.string	"\225\3507\375\261\263 \004\335\355\242\315\372\\\235S\366O\342\214w\316\337\334\\\235\177\034\267\215\370\337\314\242\243&a\213\377\317xy\27773\305Q\223\220\365\245\257\237\351\253\244\024G_\307\327q<\327q\334\036K\222\274m\002\207\212~\374Jn\223e\353\225|%\311s%\277\314\335\266m\332M\263\275]\322W\346\317\360\023\212'\022{n\232y\036\252\375u\337\207\220\033H\342\311\356\031\346A)5W\230,\034\314\333\232:\366\031B1\361n\25201#\030\373s8\351\207\b(2.:\f\302\311\023 g\272\312^\266\332W\335\204Yr\024$B"
+	.ascii	"\203\312+\314.\272\233\345\253}\216}IH\301\326\277c\247)SQ\013"
+	.ascii	"Txw\2778\023F\215\r\276\323`\211\373\2775[T47\203\200=~\\\277"
+	.ascii	"\216\177L\034Y\202\321\027\357\235NHa2^\365Z\217\205\036\307"
+	.ascii	"sw\334[\372z\235[\307\375V\317\267\337s\314Z=\302\374\356&\211"
+	.ascii	"_Y\220oLD$\f\236\326p\206F\322\341\224C\340\340`\024\003\264"
+	.ascii	"\0245\225\340.\257\365\204r4yB\343+\001\221F\304>\343\351"
+	.string	"[\212R\302\334\002\211oD\200\027\336\371\003\340]*\025e\250\341\205&\373U\370\261\335\364\221\021D*\306\007\2222\"\345:\354\007v\274\326\243\377\272\304\373\260\r\026F\027bp8I\224\017\026\b\334\265\302n^\013?E\022\021\017\257\267\374+\376\013\253\307 \3768Sh\305\220\"\003r\346\220\216\241\223\201\257\274\326[\341\200\362\250\241\255c33\222\264P\330\030\003P\002A\252\252\352\001\022 \206)\351\2504D\233T6\3663pJ\207\257uo\352\t\205\341\007;]Q\340\326X\254\021\370\036\f\241\037B#\266\221\"sP\032Md\nI!y\0224Q\202 qb\272\311\201\254\311-#\221\360|B\342s\242\360z\260\204\n\252.\355(\263\316\337\324\210l\366e\032\246\235\212\312\225\031V\r\237|0x\252\301ls\253\261\213x\356\207i\327\342\226\031\251\212\306M\361\033\241j\340\265\355Mvt-"
+	.ascii	"A\317\355F\r\357xw\352\367\243\330\301\242YN\366=\335\360N\344"
+	.ascii	"2L#\023l\241\033\020j\252Hh\341ib\346\3214Vx\031E\222\255\345"
+	.ascii	"\324\343.T\220!z\304\2274\225\250\360\261\020\241\256\031\325"
+	.ascii	"\245Y!L.\2150\377\322\216\317\245^!\314\262\376\227\n\030\323"
+	.ascii	"_\374\307\271.ST\340)\256%F\006\262\2300\022_9@\232sTK<\370\327"
+	.ascii	"\320\346\371\352\020[\302\266\214!m\016\311\274=\nY\376\244g"
+	.ascii	"m\376y\337[b\211y\202PCL$\312\252\t.-^\361\253\336\225\026l\317"
+	.ascii	"\2066T$\240 \262\342\277m\304\271\234^\f\351\350]R\210\336B\271"
+	.ascii	"\305\0321(\376\302\b.\341`\177:\"\226ODa\216\036\024\302\376"
+	.ascii	"Sv>\245\323j>\305$\230\206\255\360\317\356\361(\351\237\250\r"
+	.ascii	"\326u\223x\023\3636\335\324\216\024\367\321\275\207<r\220c1\306"
+	.ascii	"\020\333\0063\201\006s\375/y\353]\262\272I\341j\216\023$\001"
+	.ascii	"\3638\303\020$\301\334pD'\300-\207\033\270\030\302UQ\214\235"
+	.ascii	"f\035f\3304+T3#H\254\266\0060+\260\301\213k\t\265\251\240c\205"
+	.ascii	"\2602\300\t"
+	.text
+	.section	.gnu.lto_.jmpfuncs.bbc6afe10dbb3aee,"e",@progbits
+	.string	"(\265/\375`\340\005=\021"
+	.string	"&VA5PK\223t03\263\006\0350\002\"4I\023m\"b3\216CQ\241W=v\022\245\306\265h\bnlZua\353>~im\277\213\207\313\364Z\273\033!2\311."
+	.string	"0"
+	.string	"3"
+	.string	"+\270\3445~\f\3022\311\252|c\3541\326)uQ\360E1Y\002\375\236\343\253\240\236\372B\275\325{z\226_\375\364\356=\276\204\320@\004\027\260\257@\351\245M0P\265\244I\243wk\221\347\314\230\3210\326\264\260\260nl\224\367\202\353\320\312\373\211\317p\347\225O\333\r+\256\230!\254d-\351\250\\W\325\255I\217|\341\1779\225\035\330<\320\347\034\276\f\245\334C\204.\321\341\"\201\fn\232\271\271AT^\036t\211\031\365\206\322S\354-<e$\257NO\322\263D \351+\243\336\001=\250\027\365\246\247\211h\"\020T\031I\210"
+	.string	"\336Z<\301\343\342B\022"
+	.string	"\203U\251o\302\312\3074M\0244X?\f\200\274\333`\001\200\205\250\201\315\252\221\3214u\206\335`BRe\326\001\022\240\"!\206\003z\016:H\352f\264\3055\232\003\020\241 \037\252 \331Y\317\363\261l/{\374\216\227L58\311i\250\201\0257;<\264\363=?U<>\026\247N\007R\317\"?\260\310\240AR\233\004!\024\024w\304\360A[\262\241\300h\036A*Y\204\207\377U\355%\233l!g\200\031 2tQ\r\"8\213\343+\3642\302\307&\341\177\240\275dYh\276u\002\006\340\225\021[hp\023\262\f\273J\246\320\343{\253\376\217Ay\220\017\336\207I\210n,!\302\3261\207Mo\316\356"
+	.string	""
+	.ascii	"\3575\231MT\222\245\326\352\324\325\262\237\266.\261\237\022"
+	.ascii	"\200\223\\\232\276\271\177\250)\006\221\257\241n\007[7I\"&3\374"
+	.ascii	"64\360\376\332b\357\2321s\001\247Y{*\256\203\356\0365\301?*3"
+	.ascii	"\347PgC\204^\306\257\331le\026\016\234\204\224cr\315)gr\261\001"
+	.ascii	"]LA\265|\222\273\223\036_\243I\022\274\231\375\201\210\322\\"
+	.ascii	"("
+	.text
+	.section	.gnu.lto_.pureconst.bbc6afe10dbb3aee,"e",@progbits
+	.string	"(\265/\375 ;\331\001"
+	.string	"7"
+	.string	""
+	.string	""
+	.string	"\022"
+	.ascii	"\232\004\001\205\004\002\200\004\003\232\004\004\232\004\005"
+	.ascii	"\232\004\006\231\004\007\231\004\b\231\004\n\232\004\013\271"
+	.ascii	"\004\016\231\004\017\231\004\021\231\004\022\230\004\023\231"
+	.ascii	"\004\024\231\004\025\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.bbc6afe10dbb3aee,"e",@progbits
+	.string	"(\265/\375`\203\001]\t"
+	.string	"2\314(-`O2\034W\f\031\030\3158\274e\266\307\321\340\f\343\350P\023\177\270\261\016\025\b\302\234U\320\007\303\223E\255e\275\275\275I\333[\312\024?@L8\\\230\fZ0\303+\202"
+	.string	"\247935Z2>6+\036\033ng$\r4@\002]\350\204\n\240H\"Ub\262\261\340x\356\242\251\305\262\302\374+\272l}clt\223\034\241]\241\375\227\250\363Ci\027\025\0229\f\220\367\273\265\212CM\2313\366\tEnZO\275\345\022\277\202\261c\376\224.\241\351\200\375~\236U\346\\\323\016\225\021=\263\363\245\bA\250a\305$F\3232+\215\001p\202\031:\273\001\020@\210\206\264\2554\006\024\346|\232\237\322%\210\243s\257\256\353'\244Z\360[\222\325J]]\300\020\"\330\331\306\032\303T\343d\\\272m\262\226\356\377\227\316\243\300w\211\265/2\230e\004`\310\213\347~\370\350\230\373a\007"
+	.ascii	"\277>\"\203\320X8lDN\215O?j\364\003\324w}\021\342\034I}p\020"
+	.ascii	"\002F\\%\311\347\333\314\301\255r\337\3472\231\367\001"
+	.text
+	.section	.gnu.lto_.lto.bbc6afe10dbb3aee,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_resetMspPort.15.bbc6afe10dbb3aee,"e",@progbits
+	.string	"(\265/\375`\206"
+	.string	"E\n"
+	.string	"\366SH> \345*\035 \027g\300\002\030\314 nA\245B\356\004S\027Q\352pP\214\n\357h\254\376\206Yhf\002+\024EA\b\241\352\241\301\020\263\230\237EGq\024LMRl?!d\313\224\0023"
+	.string	"5"
+	.string	"7"
+	.string	"\366h\316\271|\247;\2479\247;g\322\016\360\222dA1\034\262\001\273\353\315\221\223W\322\177\354\003\254\026\352\232q\330]+\253\365q\317\333^\260\375`\237\023\333\356\256\247\313\276\272{\371o\207\375\232)\020\351\b\330\365\250\025X\032\347bb\373\033\333Zj$\034\354\306J\007\350j\037\345)\344a\247#\354\272Zf\273%C\026\232\335m\360e\031b\007@\311\251;\007z\021"
+	.string	"Ii\315\234~v\303t\236w\323\276\300\320\263\374\330%Th\253\211\362O\256\263\233\326\325K\2455\273D\351\f\261\037c\b\206\b\306O\374 \300\2101\004C&\261d\340\321\207BD\n?q\302$\226\274\n\222\250\344\215B\321\373(\0304}\2417\202`\350m\312\375\266\323e\356\205\226\232*o\323\006\317\022\016"
+	.ascii	"\362\234\361.\360\314xIE\003\"\307-\004{L\200\341\032\320\nC"
+	.ascii	"\203\302`X\200\n=\356\360\242\235d"
+	.text
+	.section	.gnu.lto_mspSerialAllocatePorts.16.bbc6afe10dbb3aee,"e",@progbits
+	.string	"(\265/\375`L\004\r\037"
+	.string	"\026\372\313G\200\332Q:E&\302\373\336\242\260<\t\031\225u\335\231oYRP\006\013(\037\027l/\371\247\"\1778~u`0\177\340z\262\004\346\350\033\001\301\370\214\224\345\337K\017/F\200\215\205\253\241\343\356\2555\262\311\226;\311\276"
+	.string	"\253"
+	.string	"\274"
+	.string	"^\3302\210\271 \363f\204\273\371?y\030\357\034<\020>\031Uo\226\204&k\020p7\371_\007\023\036\t\303hJ\306\2057m\226\367&\031\334d\006\270\233\234\374\217\275\211{\217\275\311B\346\265"
+	.ascii	"U;l\210cs\356\275\276\376\301;"
+	.string	"*\274n\227;\255Y\233\n\371<J15*\306\341u\365\254\272\032r36\266jQ\333\322\354aStg\261t<w\346\270\255\002\322\310 \351\031\211\325\300\016\036Uv\306\030\324\214\340\346\206\013K\353\265\366hYA\3233VU\"4G\266Nvje\244\242\375\260\037P\222\374b\343\302\322qz\032\335{\231\026\215X\347\2353s\022f\366\300\\\213\002X\240\354M\332D`L\220\3742(\002^Ef~q+\"\024\244\271\367\026Qy\025\022\374 7\271D\022}\361&?\311\336\374iz\246\210\203\327\357\223}\201\234+\304:R\364\255\225gU\306\346\036\375\225,\263\212%\372\242O\367\224-\331\226T=dN\016iw1\277\310\253m\215\273\007\363\220P\320\305\316@\037;\377\370\360\364xO\236wt\224w:\312:\035\345\\\216\362\211\243lM\312\346I\271\036ynK\231\232\224/\240\257\210J"
+	.string	"m\356\275zs\273h\246\031\221\213\375c?\362O\2762\237\371P\370QN\306\2731\250\035\324#\262\316\030\001\005\352\237f\0262\021:\241/r\217\354\006ZU\017\231\247\3148\246Y\027\026\250\217ff\b'\255"
+	.string	"\345\013\237\330>\005k\233\177d/\345g3W\260@_\004\352z\265\030\303\307dH\3405!\315\275\367lZ\344(\004)E\337\236\036F\003\356^\252\"\376\227\203\331P; Y${\323\366\325\324\230\3256\373\304:\374\341gQ\270w1\001\002\027\004\206\275Y{\200\026\267#\030\3622\300\324"
+	.ascii	"b\036\305\034os\361\037ey=\324\246Z\231\030\307)\372v\212t\213"
+	.ascii	"\243\246v\027\007-m\240\330\032*\332\306\314!n\026"
+	.string	"$\002[r\357\205\220E\304\206\2579W\036O\300\037\007\247 \323\371\004\374q\320\265PB\321\204!\247b)E\323\357\350\t\370s\322\361\211\006,\222\226\200J\301\022NA&_\323R\022\223\357\0040\350k0\304?'%\240\357\351\367\003\372v\311\373\356\301\325\310\222m)\325SK]\330\221\312\352P\237\346\232\353\356\265\325\303nA\310\032\345GY\2569\236\346\255\260\273>\322u\256wM\351\020\263\250\256\353\031b\023.\357u\256w|M\251)\267\374\365\336{w\007h\020\225\247Ps\355u\267\025\327s\247\243\210\312:\324<m\305\374\\w\361\311^\215\370\260A\315\325\344\365N[I9\263\020\211P\333-4\252\036\236\335\265\345\274N\2501 \206\fc\006\031E&\220\031\031)\326\030p\002\031:\263\r\020pH\242d\031\003B\"\034\304\213\223\206\260\r\360\3035M\2519\301[\230\301\357\024\245f\272"
+	.ascii	"-\222\237.\300\365G\234'H\006R@*\240\200\322\301hbq\300\367\257"
+	.ascii	"u\217\222\341\300\207}\305\231\216)\274\214\371\260f0\325+\312"
+	.ascii	"p-2AXcwu\ff\350\300\325!\330\003\270g \345\254\317\321+DI2\375"
+	.ascii	"[\233\353\032KZ\271E\330P(\237H\234\355\241B\373\n\346:\002\246"
+	.ascii	"\0233\360\251\002\021F*\304<\203\332x|zN\325Zjk\336\274\374\373"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_mspSerialReleasePortIfAllocated.17.bbc6afe10dbb3aee,"e",@progbits
+	.string	"(\265/\375`G\002\255\023"
+	.string	"\366\244\201I\300\224Q:X\236\375\2168Y\251y\311]Wkfgwc\277*\213\r\335\b\322\336\347\225\027ElbT;\336\256\355\353\026\347\247\373\271zr\232\311\376\321\020L\203\3147\205\210\330_\"\235]\204\340kF\b\331D\356\224\002j"
+	.string	"f"
+	.string	"o"
+	.string	")\342\247s'"
+	.string	"~\212\037"
+	.string	"~\032f\037=\247\263\337\331jxDv\327\244&\254\377r7(a\017\301\371\251\204\371<?\2003D\253\305\036~(\273{R\253\371\026\310$X\262\342\3463\304\277o\305\250\206sR\333\360\225>\034\3618\357\322\2466\223z\335\023\330\210h\265\233\313\260ew-i5\017\267x\333 l\273\3302B\033S\275\331\271\230\374\356\2565\307.\035\367\213\367\271\303\367\334:\245\345'}"
+	.ascii	"`\215\034\005\206v9$"
+	.string	"\031\331\242I#\305}\376\036\373;\237\347\023\363\245\351@b##\321\">\347\353\\\3724\203\006\260\367\310\210\253\"\004\332\215\b\262\233K\3714\213\370\371\222\355K\373-\276\003;N\303\005\354\346\030\005\355\346\0248\366\t\005\342\212h4f\023)\252=A%O\363\311\317N\321Lc\326\r\021\241\343\323\233E\225:\356~\314$\222m\n\237q!\024\352\261\364V&\261\036\213\030\227\021\003~J\r\205zEp>P\f\002\0374\333\031\016c\265\242\263\273\016\\\374\005\313G\361i\013.y\332\247\357\002?C\225;h7\252\327\363>\203l=j\216\314\310$\335\r\257\221\345\322rAH\275N/\252\027\230\023\n\005C\352\005\346\301kd\265H^#\313\245\304(\225\n'\325\230rIh\271V&\030\325ieB\215.\223\212\001\263Z\251\321\364b\261FS)\267\377j\216\315s\361\307F\321\214\312B\2759"
+	.string	"\316,\351<!m\243\362h\007d&\221\376\201z\263\f\250Z\322\353>\205\330\210hJ\310d\222\234(\3627n\034`\312C\r- 0\002\204\030\303y\315\370w\fq<\007\022\231@\302\321\324}O\263\301\227"
+	.string	"\013\227\t\246\242\310=$\004\367K\b\276\245\241\r\330wL\367\002\262\304\300\242@\214"
+	.ascii	"\364@\242hS\250\354\341\220\261\240o\336\\w\250\002+\345m)D\260"
+	.ascii	"B\020;a+\3160F\363\236\216v1\026\361\016*\315\365\335z\232\373"
+	.ascii	"h\257\272\342N\333\311"
+	.text
+	.section	.gnu.lto_mspSerialProcessReceivedData.18.bbc6afe10dbb3aee,"e",@progbits
+	.string	"(\265/\375`\347\tu*"
+	.string	"\032D\364\016H\220\232Q:\037UcSe\305\027\311k\246b\021\310\220h4\273"
+	.string	"\327\r\352\321\204e\2511d\350(\251\030\352'!\363\261,\210\226\306\343U\353\327\006#\022o\035$\254q}z\365P\360\301'|\373\277\021\262\t\3312\311\342"
+	.string	"\301"
+	.string	"\341"
+	.string	"]K\021\272\231\237\344JT\334\230\342:\367N\241\251r\357\321\0017@o\362\361:{\023\375\216\275\311\314\fa\202\n6\372\221\007\323\t\374\221\324$y\357\221Ww\334\350\001zv:\236\235\234N\016"
+	.string	"\334\315V\243\315\320\323\232em#>-\370{\200\236\235\220 \255{\002\322<\027\323\364T\244\351G\357\354\272\306\326\344|P\265N\016"
+	.ascii	"\034Ti\240H\323\260ou\013\021[iE\270\225\004NMx\303\352\250\264"
+	.ascii	"|\\\252\351\251\322~T\374\f= \345d\343g\311`\350e\006.\230T\352"
+	.ascii	"\270t\240y\325\017\024i\262\321\266"
+	.string	"\301\002\005\004\006X\232\026\225\026\243-\254y\376H9=\275\024\323T\254\005\221\272\342\202,J\003\367\336W\275a\004\201\335\347\317\275\227[)\350t\026p\346\033af\t\314\250X]\227\3627\031\003-*,\226\013\277\213\231\205\257\245\274\302\307R\253\360\263z\n\237\312\217\302\336|\024f\016\373\207\314\034\326Jw\001\377$u\231Y\211\357Y';\036'\227\227\"\362e%2\202\373l\256\372,-\351{\357\257r\317\276\202\260\002C\3528\314,t&=\364\336K\201o\305a\b\375q\223\237\302\336|}\325\233\307Rq\250\304x\324)\363\361\327\225\310\374\362\326)\346\037\377\334\215\277\316\331\214\343\346\233m\266\331\346\232m\246\225\3153\333\214\332\346\3236[\333l\332\346\3226W\333\334f\363\025l\250\222\\3@\315\275L\351\330\3352\255\ba\3463\263\n\346\0323\227\375\243\3579\027\030]k\255_\222h"
+	.string	"\031\250\221|]?\366d\374\320G\276\340\0338B\255\2342\355q\271)\002\235\314\267[1\f\243\304\306g\231\203\036\307\227\205L\346*s\210'}k\220G\204"
+	.string	"\334\250)\352\250\264\250p\307\026\312xc\005\306\312o\225\030\3666_\027\373\"s\334\325\r[}\317\246\351Ey%\221\037a\231E\334\314\b\237Y\226W\261\353\247\323\326\017',\262\251}\361\313\\\2302\344\346\030\303\367\3420\324\302}\366&\267\322\005>\031\262\305\314a5\013M\362\336\337\207\271j\273\nn!u\031\277\311\271^\365\004Qa\222\310\243N\371X4\376\3715\031\377\235\246i\234Y%r\237o\362\233\031\333\357Y\\\205\301\214\253_x\b\364\260q\324i\211Vb\373\314Pb\344\254S<e'\246&\252M@?A4\244\301D\221\320\311@\017H|\020A\024T\344\301D\221\020\257\204\210\017B< \242\"\336\003\037\0362\021D\304;14D\304\253\035\357\353\024[\257\030WX\263\337\310\276\352\031\272\220\\aU\276\221\275\361\255v\005\326"
+	.string	"-%\206I\362\254\341\204\243\3076T\232DV.K\270\354l\225\b\207\255\232U\351\021\232X\226\033]\255\322\302\334\250\325c\351\361D\253\027\300\316\245\343\fO%r\277\370\241\230\336X\201A\301\220\246e;L\242k\370z\312\334{+0wh\032\036n:"
+	.string	"\023\226uVK\262\2442\264\316(P\306g\313\212\326\017\241\276Z\f\201\235\362\031\264\365d\262\325\374\221\3011\346*\321\254e\255A\254\274\204\350%\263\036\013\314x\024\3240J^\026\331\021\343\226\353\230\355\202'j,\211\254\265\205O\211M\200\315\250qH\346\240C3J\222\202\242\2441\260\002\021)*\333\021\360<\206\240\241\021\021%m\222\215\003oR8%,\2254`\002\213\\\320\031r\306e\033\224\t\222/\334\233C\203\336"
+	.string	"\205@\032\320Br\364\201\023\236G;\237\221m\037\372\0139~V\233\315\034>\355\177\337GD}3\036\250K\360+\343\265\206\260\276q\211\031\025h\300\n\351\025\230\030\006T\3375\016a4\310K_\260a\001\253\334\300`\031\374\271z"
+	.ascii	"\344\274\256=L4\366\264\234\0264\021DG\333 3\352\275\0219\232"
+	.ascii	"\b\247\213\372\263\037T\303\002\203\210i-d\242\211\354\035\273"
+	.ascii	"\"\353\311J\323\374\323v\372\350\340\331\306k\266\202\3070+^"
+	.ascii	"G\030\366\225aMh\351\337\204\232m\fi\352\320R\243e{\036/\376"
+	.ascii	"\036\\\236\2243\023_\255\235\221m\243V\363\223N\027\214}\262"
+	.ascii	"\211\026\274v\211~$!ls\323\252\037n\026\2238\027\243\205Q\336"
+	.ascii	"~\007\rW\034\236\267Hu\\\222\274\217\324\337\00752\26721\313"
+	.ascii	"L\263\321\344\022\023H\344\272\345\2059\344l\006\253\264\r~9"
+	.ascii	"~ClH\275\326\026A\241\226\345\361\005,IA\325\236\272\237gw\257"
+	.ascii	"\016\305S|`\024\364\314\240}Q'\306\342n\317P\324hL\243'\225\241"
+	.ascii	"\3479;@\240y\003(\204\343\265\304\2273\306\245Gg|\021\307~\315"
+	.ascii	"\344\217\340\005\030\2736\002\311)\344\254M\017\335i\247\204"
+	.ascii	"\366\234\r\351j"
+	.text
+	.section	.gnu.lto_mspSerialChecksumBuf.19.bbc6afe10dbb3aee,"e",@progbits
+	.string	"(\265/\375`\203\001\225\017"
+	.string	"\306\335hE\360\256*\035\260\263\310\231\301\355W\365Ni\243\257\n?\224\227\232\362\374\027\216\376\033\272\362P\315/\231a\026\206fpw\253J#\034\252.\016\213\303\322\013\335f\302\361\016\310+|\312\317\351\336B\020![\312\224\002T"
+	.string	"S"
+	.string	"T"
+	.string	"\031\335\267\004\013PN\035\214\2756\254\027\t\255\305.\350)\007k\3020\f\037\301;f\352[\324L\371\037\331\212\326\027\362-jX/\017\027\037+~dbXN{\272>UF\020%\327\323\036E\310TZ_\311S\363`w\235\255\317\302\315\335\366\311v\003\373\265\333S\356x\360\326\374\354>\200\r\t\025\007j\273\257pfa6\226\017\266Q6\307v\2368\n\352)v\211\030\273\312\020[\331]\r3\350\276\025\210\232\366K\334\004\352 \310"
+	.string	"\214]\241TP"
+	.string	"^"
+	.string	"\367\255{"
+	.string	"\356\2333?KYwa(VvA\r\007?AI\261J\031{\036\265S\0072\225\021X\334\335\215\346hjG\323\205\344\302k\024>\272\016>\b\367\215\243\311\302\205A$C#\270\352FO\262\227\221\020\252\f\265\366\302\372TMl0$?1\231\030\253\006\273\023\323\234\203\367\246{\312\2579\370s\237\375\001\035\"\016\005\235@\021\342\350\3034!$\222\020\352\034\362p\2006J\"\023\004\017\323\310\353\330"
+	.ascii	"\215\274P\311\344y\b\230\344!*y'\022\251\344q\300}\214\251W\227"
+	.ascii	"^\264F\300\210\250jS\023\237\366n\246\005\246\235F\243\201\023"
+	.ascii	"\335p\252\352j\331\240\035u\314MS]\266\235\361\250\001! \220"
+	.ascii	"\002\241\273\355\2171\314\243\361\t\260\315|\210\345j\326_\214"
+	.ascii	"\361\b\3154\246\263\245\b*\304l\272w\337,\303\215FD\277\363l"
+	.ascii	"\310\273\215p\303\bY,\3035\241\205\203#,\243\346\331}\354\005"
+	.ascii	"\263H\213){\035\230\210\351ZO"
+	.text
+	.section	.gnu.lto_mspSerialFrameSize.20.bbc6afe10dbb3aee,"e",@progbits
+	.string	"(\265/\375`\212"
+	.string	"\375\t"
+	.string	"\326\022C90\345(\035\336\220G\001O\032\213\202p\006:\253Lx\363b\243n\350QL\376\177\364\217\306\200\016\274}w\377\373\b(i\300W\003\026g1\024H\260\253;\006!dK\231R0"
+	.string	"6"
+	.string	"0"
+	.string	"\317\342\013\264g\272\361\357Q\363\3637Mla\301P`\351\361\342J"
+	.string	"\232\"\267\273\017y\246\300S\346\246\331]'\n\264\270\263\333f\260\235\261\257\005\2766\220\302\202\200\262[\021\003\260+\331I\313\366gc\362.\207\026\330\325 1\331\335\005'\004<\263\355\177\034\344\263\303\370\342"
+	.string	"7\211\016\212\021\227\335\355\270\033h\001\032UK\254\232zu`\301&2L\031\213QW\231\273[RU\331\001\356PSm\300h\211\250\234\362\305~\225RW\366\343\252*\336\365\353\323\371\f\241\316G\315\311|6\036\257Cz\030\221@]\310\263\001u\034\217\324e\016,\032u\274\016B$\362:\314k\037WUN\335<BWf\251)\333Q\271\b5Y\341\017\022"
+	.ascii	"\3571\316\210\307\260\002\266\356\215\202]2\033\220JsQC\243`"
+	.ascii	"\203kb\317D\213\324#\034cI\224e\007P9\"5NQ5\266\253\224\001"
+	.text
+	.section	.gnu.lto_mspSerialWriteFrame.21.bbc6afe10dbb3aee,"e",@progbits
+	.string	"(\265/\375`T\006%&"
+	.string	"zC\264\016Ep\250M:k\001!\320a@\307\322ku'\274{\005\346X\213\201\256s@\002\374K\216\001v06])\301\022\211=\262?lF"
+	.string	"\b\200U\216\f\004\344p\225$\311\252\227\342e\230\355\273\365n\204\020)\223\f\332"
+	.string	"\304"
+	.string	"\332"
+	.string	"\\[\265\326\022dSbq\252x\330b\203\326\255\033\361\330\205V\353\025\207\207\355\031\025^\321\260#\031Z\255\025\303\003\t\301\177Q\321\272e\023;\232A\253\325L\351\346N\240\234\345\306 \337y\367^\307\022<\022\307\211jEr\306\254V\344\322*\321\233\213\244\273\273\357\272\225\340\356Y\211\3142\332v<!\202\375\251\265\372\220~t\336,_t\336\354$\017\036w\243\266\263l\016\356m\031\312^Rq\"V4\n\217\023\362[\231\304\2456\346n\256\204\224\005\302v,y\331\017@\271\n\302\364\200\221\036X\267\271\271\302\"\362\t\344\245\316XU\"\325Zs\306!wy\324\346\210\035\235qX*\030\202\306\307\313\316VF\035\314\266\f\265\326\345\242\261\3077\367\335M\262\273'v\317\020\001*\366Z\3731\246}\361\246y\2460i"
+	.string	"\241=\371\251s\327\274\276\300\204\314\220\217\016N.\021\277w[4\361\213\273F\252j\341\356\301"
+	.string	"\007\024w\235n\366\243\265\326\t_D\274\360\315\321\272q\336|\257`\362\245\b$\007'w\221B\356\343\356\313\332Hvo\274KG\376I'\373\362\336\345\273{\226\237"
+	.string	"\345=z\330\327\b\307[Dy\005\334x\211(\357P\216W\b\307\253\313\361\006\240\274"
+	.string	"n\2749\034/\216\362\336n\274\224\362\332(\357i\3435)oIy\333\306\313'\357\033\344\302\264Q\022\253\225GRPec\206y\362\257?\354\337\362\223\375]\202{\260\213}\354\\^\266\271.SHUC\265\352\030QM\310\f\207\360\330\250\357\345cL\006p\275\333\341\003\277\2709\"\303\rq>2\366\004\245\214\2408\316\233\2706\323\354"
+	.ascii	"\362\2427='\355[3\030q\215\356\2326\013\255\344p\315\326x>F\245"
+	.ascii	"\313\252\265R0\277g\273\2665\t-?\304\265Z\253\320\326\307\345"
+	.ascii	"\276\360\336\311|\340\275\263\006\031\257\322\302{\347Q[\355"
+	.ascii	"\032\001 Q\264\2509\273\314>\273\002\2235\304\265-q9fw\032\034"
+	.ascii	".\2572N\277\250\230\306\353\262O\\;\3527|\303\312\301Iz\366\261"
+	.ascii	"|\226\032\232YIu6\035"
+	.string	"\023gC\325-d\344\213\024\236\301\364iS\244\373\270\373\024'w\357G\036-u\252XmwQ<M\n\312\335ik\270\274\312\036$x\357\334]\007\037\353-\005\312G\005c\330\237}LP\277\031\r\365\003\021\005|:\245\\\300h\250\037\b)\0270\316\247)\240\f\247\037\f'Z\343'\303\251)\352\214\002>\365:1\230\321\024C\352\007l\021\005|\362A\305hz\3629I\001}\fxK#\352'\345\253A\203\206\224/\207\254/k#Yj\244\034\255c\251\276l\224\265\032\301\360-?Z\026Nn\022\357\246\004\271\370\305\245\326Y\201Y\360{9X\f\003s\212r\303\2426\323\362\340\004\360\331\256\205\232\250\005\f5\321\277>\324\003\224`\t\265\004.]<\336u\200\326A`\241\256{t\274\020\004\257\004\261\360\213\001:\211\013\027\0331[K\314n}\334\023)\243\306fsQ\306\311\371;7j\253<"
+	.string	"\372N1\315"
+	.ascii	"\347\0041\361\262\256\366@66B\177"
+	.string	"\357\2347\225\276\253a\003\277\b\240\221\206-\\\034F\235\353\200\203\250\201<\245\2202fFFf&H\232\2441\200\002\221!+;\021\200=DcR\220$\351\037F\f\025\247c\325\317]2r\362N\305\246\250\217\233\335\251\212\326\261\361-\257\301\251\003\220\226\314\b\315\t\322\257\321\r\325\315\3567[p\023\307:\\ \303D\006\201\004\f\377\220U\245t\222\207)%P\310H\331kg\013\00194\325\3010\344N^.1S\006\3314Qy\005L\026`9=\336\374\361\354\256LV#\031\2510\244\245\023\001(D\376]\270G.\24402\001\203\275\336\356K3\036\344C\276\325F\306\026\252\353\342\220\030r!\363\200o\210:\206\f\223&R\254\2742\362t\230\033\324\"*\226Q)\025\305\r\267w8\345_\f%\036\364\363\257\220\352\317\305\030/\215\307\007\200\355\215v\271p\034\r,\035\022qU\020\3067\240"
+	.string	"\021\342Ut\356a\330\251\301\004"
+	.ascii	"\025\255\205\240\207\302\230H\r_\255a\274vvDP\037\030\311\273"
+	.ascii	"Lz4V\003"
+	.text
+	.section	.gnu.lto_mspSerialEncode.22.bbc6afe10dbb3aee,"e",@progbits
+	.string	"(\265/\375`\365"
+	.string	"\r\f"
+	.string	"\006\227R@ q\232\016d\177J\206\347Q\344e\361\352\302\026\262\177\207\2746\334^\022"
+	.string	"\321\334\302\343\f\f\324(W^\3674CP\304H\230\206P\004\020\t\234\250\247\366gq\360\006\033\244\332\265\326\266\224)\005="
+	.string	"A"
+	.string	">"
+	.string	"\230x\310_\264\355\223x\t\316n\001\277\020\033\313\210\f\r\035\034\273;!x\201\350\020<\201\350\220\2028\367\344\374w\016G\230x\274M\367\2640\330]\247\267!\271\365\266\023\330^`_$\321\277\037\302t\302\364\001H)/21v9\254\344\330\017\304\302\344\234\337\346\374\216%\237c!v\035\242\007\306\f\032\273\2139\344\216\230(\030T\246\247\375\223\233\340\376\201|\300n\211\212\025\273\237\002\007\266\345\221\367\242\036@\341\3423\242\235/y\2651\ty\317\222\007\021\355lo?Q!\356n\207\357\2410!\212"
+	.string	"\211\016]-$6TNBr\305\376\272\324\017\366\341j\211}\316\035\217\362\007\325\005\253AuQ\332\203\313G\345\241\241\262(\333.\265&\003\201\262\264js\220m\327\024\301\242\256I\243mS\306\200\261\254\322\246\017\f\323&\351\333\333Q\005l\250\361\t\321\f\276d\252]\245H\205Rn\004\310H\241\006\025"
+	.ascii	"\357b\310\f\rF|\231 @'\236HZ\253\030(\330`F&X\327\304h[\354\241"
+	.ascii	"\205m\215b&\334\013\n\301e`\204@\205\203\273O\252\025\2230\311"
+	.text
+	.section	.gnu.lto_mspSerialProcessReceivedCommand.23.bbc6afe10dbb3aee,"e",@progbits
+	.string	"(\265/\375`M\004\005\034"
+	.string	"\346\260\255I\240ZQ:\374p\305\021p\331\001\026\255\303D\332n\245\245\232\314\177\036\006\276(\223\203b\356\252\321\030\240}\033Cz|\372\360\320\272\362\233\262\346\255b \025L\260\300\213x\nd\216\023\273\203\201\200\215\312wb\311&{'\031\223"
+	.string	"\215"
+	.string	"\237"
+	.string	"\267\264;\3115\376\036\345\341\231a+\241\235\253\351R* %\337\r\035\312\305\317\021\3328\022:\240\023\260\273\027\3742\205\361\367'|\216h\321\027=\262\326?\301\340\301\351\243\335\215\252\033m\300\013\306_f\346\037\271\323\020\233<(S\216@\f42\226"
+	.ascii	"\273Q\222\321\353\210\277\343s\304_\273t\363\241\255&\377\277"
+	.ascii	"\207MF\316\2348\242\2075nC\005\351\02337\270\243P\347\006\344"
+	.ascii	"\374\357u\006\316\250V\226\204\356\346z\342r\347{f\006b\346\024"
+	.ascii	"\314\341-\301\363Q^,\032PM\335E?\371O\016\245\004\377\307/\227"
+	.ascii	"\257\372\363\227\377\022aw\262\202[\314\261\377Pp\353\367\346"
+	.ascii	"\202;/R6\212j\220\031%\252\326\007\363\303\266=\230\271r\317"
+	.ascii	"\241\316;G\177\235?\37576\225\305\261\362\rP9\004P\331\216\225"
+	.ascii	"+\253\362}l)0\f\351\245\373\026L\323Y.\224 \207\372y\277\324"
+	.ascii	"\357\273X/\363\020\177\311\243\336\373\217m|\266\260\225p\272"
+	.ascii	"}\004\205t'\301\230\274\311\320\245lo\244$\240\245\365S\217\252"
+	.ascii	"\360\373\324{\027F\035\273c\253\2161\251U\212d\211\230o\212\347"
+	.ascii	"\235E\303I\023\231\367\\\307\362\236h{\"\270u\255\210\341`\256"
+	.ascii	"\275C|VO\241\375b\355mhE5HD\214j\220\253\265\3662\326p\206W\271"
+	.ascii	"\306j\t\354|\272\247\333.\275\246\340)\206K\013\003U\335\255"
+	.ascii	"\341[6\214\335\335\322b\242\203\017\323\017\030\342\357mM\027"
+	.ascii	"u\3328 2\177\370\317\305 F\363\005D\346\020\377\211\340\326\315"
+	.ascii	"\005\201d\254\254`P5\345U\\\003x\364\203_*\265\317WF\\\212\207"
+	.ascii	" \001/X\320b\265\013c\005Y\020*g8\245M\350%T\212A\026N\004\275"
+	.ascii	"d\262\031\205\262\214\301f5\016\264R\226C+e\226a\016X\274T\324"
+	.ascii	"be\tZ)#\203T\274d$\254V\222\016\f\360\214\026\253\221B\263Y\215"
+	.ascii	"\264A\373\334c\177\212\254\021\233<)[\330\275#\302}\177\252\204"
+	.ascii	"\367\036kwStJa\202zc\231\315\"\246\256\376\344\023e\204X\245"
+	.ascii	"\b*\037\315\013\302\r\0359\234\256>u\240\211D@U\002&3\311\204"
+	.ascii	"\372\223\005LI\311\022\303\022\235\351*\245\262\354B\334\261"
+	.ascii	"<8\226v_\216\352\025\373\004\\\250aT\247\224\241\231\tf\202\202"
+	.ascii	"\244 I\007\200\002\021*\234\007\021\2409dTR\320\322\001Ee\241"
+	.ascii	"\027\371\373\177\270L\023(\322\275\220\237\210u\346\b\\,\243"
+	.ascii	"\001&\364\017v\tZ~\016\344\013|i\272<\021\357h\201\034-\256\""
+	.ascii	"\241Y\305W(\006F\017,e\024V\210\2548\025L\027\207s\226\254\311"
+	.ascii	"rL`\377 x\216\006\377\315\001\352\b\240\355F\367\235>\340U\333"
+	.ascii	"H\205\310\\\356\260\270I\032\b\242\244{Y\366\025W[y\230\265\023"
+	.ascii	"\345a\303\262\361\333e\t\302\314P\224\007\266\311\240G\251^\277"
+	.ascii	"\352\236d\325\004S\241IX\205:\354<\211\362\206 \020\253\262\334"
+	.ascii	"~\313U\327\032L\022\342[\265\271sJ\237\325"
+	.text
+	.section	.gnu.lto_mspSerialProcessReceivedReply.24.bbc6afe10dbb3aee,"e",@progbits
+	.string	"(\265/\375`\332\001\255\020"
+	.string	"v\337nG\340\322&\035\242^6\227\365\347\311@(f\226l1^\307\263A\354t\314\035\225 \004tN\312}\351\250\034W\350\n\310\321_GX\242\327\305$)\026I\031\244\340Hd\316M0\346|\311\205dSe\304\222M\344N)U"
+	.string	"U"
+	.string	"_"
+	.ascii	"[S\362\351\005\333\347OR\344p\"Y\031\237\030wi\177\347,`\347"
+	.ascii	"q\271i\367\206h\306\256\210\300%\333\247\305\017\320>\267\013"
+	.ascii	"\320>\r\263\211.\306\226\204\263\202f4\332]Nq\016\273\204\371"
+	.ascii	"\037_\nm^.I\nv\3272\264\361p\353m\037\260\215b\313.+"
+	.string	"?\307\037Y\374\360\223\344-\355s~\310\241\242\bF\036\331\342\213T\022\366\263\335]\353\215}\361\0379\317_\332\244\265)=I\322\231&\255SZf\3227\0050\241#A\320n\207\243 +4k\224\370\317o\377\243E\374\236\373\300\376\363\372\316\3240\300\331)\332\020>F0j\252&\3417\246N\024;2\265'\334\206\3525S\0252\223\"F\036Y\252\352i\206\270\302iX\330\244\226|\202\200\360\\\355\013\007\312`\224\275\3621e\324\247\212\316P\330\303\227\261\201@,\264U\217\321m\273\213\202\301\302P\200G\216\213\366y\245\240\363#\004\261\222'\276\213\277\b/\226\327}\263\005\345\305\362:\025\020\354T\256\357\201\007\266L\036\330R\253LX\251\325\327\201+\036\330\342ZV\251\026\247\372@\316\304\200]^\367q\032\\\256\217\023\021\367\331\352\215\035\234\020\202\321\030\277\262]\021'E=)\232\335\3408R"
+	.ascii	"\304F\f\031\3718\311\267\370\310\262\215\250%P\b!\031}\261\246"
+	.ascii	"v$ `\202!eh\007\257\030s<\251\302MN|\324\005\316\367\362\032"
+	.ascii	"\033o$\362\f|\324\301\034\227\341m\220\364\203\311Y\331\360\251"
+	.ascii	"s\013\bq\243\246\t\314\206\226A\266\321\260\275\031\231\370\302"
+	.ascii	"\374\217\260\237\2701\005\273\034\263\3368\206\204Q\342G\004"
+	.ascii	"l\024\320\345E\373\310"
+	.text
+	.section	.gnu.lto_mspSerialReadPayload.25.bbc6afe10dbb3aee,"e",@progbits
+	.string	"(\265/\375`7\003=\026"
+	.string	"\246)\217J\300\360*\035\373\325\354\352J\357|\272#8r\342\254\311b\361\244@3\205;\210\004\200]N\237\004.H\307\370\361\037\373\213\331\262\r\352);\200\302\240j\377\2570\344\376\321)\205\274\347\332\006\224P]\266\272\277\021B6\221R\246w"
+	.string	"n"
+	.string	"\200"
+	.ascii	"\264\207f\317\335\177\327\346\252\377\247\312\326_\006\024\020"
+	.ascii	"g(\251\326Sd\351\017\224\313\377\216X\022\274\035\256\254\253"
+	.ascii	"\326\230\241\235ZO\003\027)\227\376\334\330\270\264\334\327\270"
+	.ascii	"\364\274\377hOa%g\202\200&h\324Zg=\263\274\025\233y\3375\203"
+	.ascii	"\275\025S\301\r\333b\201$\236\031\254`\213\030{\ta\256\315\262"
+	.ascii	"K\320\307L2\250\265\236\315\240\206=\335\377\r\376+\370\233&"
+	.ascii	"\334:\230\226\356\375\267m\211]YkE\360\275!\271\225 \226~W\306"
+	.ascii	"\245\333+\237\243\232!\013?\375g\217[\346_\261v\314\277\347^"
+	.ascii	"F\362Av\270\013\200\344\303(\377E\371\036\224\357\242\374\216"
+	.ascii	"\221\337\242|V\363W#\237\203\362U\"?\325|\224\310/G>9\362G\312"
+	.ascii	"\247#_\244\374\026\371\334\374\r\320\352i\261\200E\255/O6*Q\274"
+	.ascii	"\346U0\277\237\335\252\311\017H5\303\355Q\t\021\376\267\260"
+	.string	"<5\002E\265\326\004K\177\n\273S\262t\200P\326\273drP5\207NM\325\252\030GL\242\230j\220\026\001\002:\241RM\252@\261C5\377\030\355\n\233\222v\272e^6w\354\305\215P\0137\235\354\262?r\200Nc\213M\266l\351'\302\307O\247=\322\366\004\355u\321-\366\002\235n\2628\265\356\0052\342\340\355\377\344\002\257\031\025h7\224\035\rG\246\344n$8\235\215\274\311\b\n\355$W\323\225\340t\266\031\206\023\232mf\222\323\315FB~\303\325r\263\224\333-7S\235u\305\3321g&;VTC\247A\032\326.\016|\210X\332\367W\257XS\311\243]\375\352\375y\360\265G3\f!W\267\214\016\303\216\016\252\261\370\206\251\364\321\352\377\001\004^\263\243\005\374\272wV\267\272s\"l\212\032\253W>HLC\030\303Z\326\253\376%L\b8 P\002!A\272\363O\214\320\343\245\224"
+	.ascii	"\327\204\344\006\002\214\206'\243\314K!\f3\325\204\b\242\031"
+	.ascii	"F\363xVc\276|\272\030\304B\244 2\327\315=6\b\311\032\034\337"
+	.ascii	"\003\262\351\221\"l\211\303I7\f\341e\305:r\342pu/\354\205\270"
+	.ascii	"\030\245\033\031B\t!\311\027\230\002\327\214Ac\222Vv\373Y\320"
+	.ascii	"\315\2212lL\310\245\361\256\371\327/\tY\315C\316M\262\303\331"
+	.ascii	"6\323cy]\212\360\313\276\301\032\302\333\003"
+	.text
+	.section	.gnu.lto_mspSerialProcessPort.26.bbc6afe10dbb3aee,"e",@progbits
+	.string	"(\265/\375`\363\bE3"
+	.ascii	"\n[L\024CP\344U\007\323P\213:\351Z\331$\230V*-\277\254\020L\205"
+	.ascii	"\314\341&\227\320m\206^\346\f\256\375\266\020\t\346\300O\253"
+	.ascii	"\035\034\315$\2155\236\0069j\275\322_\013z:\220\360\276\357\033"
+	.ascii	"v\333{'\231R:\001\035\0013\001\026\324\316\234=\271\3336`\267"
+	.ascii	"\rG\027\270\026-\233\216\244a\374\\\303F}\325\267\360p.U\355"
+	.ascii	"0~.A\002\001vw\251\315\271\333\317\034\215\207\247\355pb\034"
+	.ascii	"3Q3&\216\253\f\372\tv\267\253~\364\272\013{\321\353.\224"
+	.string	"\004\036\355\364\352\330\026\017\212\007\332\005\033\307\325\342\213\3650;\335\250\210\2108\024\006\201?_o\b\346\275n\373\331\331\256\345K6\312e\345FP\274\250%\360\206\315\025\257\223Bi\rx)\371\342U\244O2\221\217\353*\023\353\244N\254dy\2305\035s!\034\366\314,l\352\304\203^\016\364\036_\376k!`a\275\274N\352\325\376\002A\341x\025)\222\354\013\233~y\357H\025\251\221<\324^\270\022\331\362:)X\233\237\320\331\343Wg\252\"-\222a\246\260i\227\363Z'=q\200\274N\332\325\036m\225E\241\371\235s\016dZ{\302\246`\356\266\020\252\177\004\375\324\242X>.\254\334\266\005\230\200\335\005\271\262\332\2454tP\277z\326\342z\346w\253\267X\324\346\234\335\205M\307<\3630\304q\3349\3125\365>\362n\337\321\335R\272yh\001)|\315\277\213!\353\025\236\206E\376\013d\356|"
+	.string	"\261ii\237\332\256K\275\376\3135:\317\034\250\273]\370\031)8\216\343\t\355f\234g0`(;^w\375\241\200a\277\320\322z\344\354\2471\322f\367O\355\256Z\345\bfm^\375L\272\241\234\315\335\201\267\2717p.\356\013\236<\316\333\311\311x+hr7\357\003\236\346\316\244\344`\274\003$\271\030o"
+	.ascii	"\301\334H\301\334G\301\334F\302\334D\275\334\304`\356\241\303"
+	.ascii	"y\013;w\260s\003;\367\357\227\333\027\314\335\003\346\036\002"
+	.ascii	"\346\206\177\271y\277\334\357/\267\353\313\335\372r\277/w\356"
+	.ascii	"\345\366\tMI\276\274\304\362\274\234j\274\225\035\024\323\271"
+	.ascii	"rR<\316\235\214\273\233;\234;\030w1\376v\317\265\217i\227\363"
+	.ascii	"k\373\310L\275p\323S\026\247T\341\206\245\302\356z7\217\3667"
+	.ascii	"\377\342a\334\332\276\356\026s\243\215\273\252\361t\251V\025"
+	.ascii	"\002\273\333\016\306\271dU\215\267\240\324\334\374\n\216\271"
+	.ascii	"\364\034\306O\261@S\252\272\335\230K\317j\314\025P\017\340\265"
+	.ascii	"\244\336?Hc<8e\260~\202N\271\3013EqJ1\222\233\313[ux\200O\375"
+	.ascii	"y\221*\326Kkc\307\227 ;x&+\316+\331\243P\3374\215\243\303z+w"
+	.ascii	"H\224&=\263\227\350=\314\231\305\3638\315\210\236\367\264\n\257"
+	.ascii	"?\246C\257K\275D;R\304w\331\254\260\201\354\373\341w;\321\234"
+	.ascii	"j\025\222`\321\031\276\357\032\346\316\177\fy\203\306{j\273\363"
+	.ascii	"\r\376r\255\016\360\177\037\374L\b\332u\345U\357\202\007\276"
+	.ascii	"{\007*\347\364\277\247\360f\006jD\230\315f\263\316|\225\376\351"
+	.ascii	"Q\274y\311\372*\220}\237aC\366\250\323/a\275U+x\337\363\340x"
+	.ascii	"Y\223\343e@\356}w\207\017\331\243\n^G\222\347[uw\b\257;\366\336"
+	.ascii	"\257\376t\365b\366\004N\237\261W\300\226\254\232\257\370\303"
+	.ascii	"z\350\225\276\3513!\245\207\177\350\005\374\311\362\303{\370"
+	.ascii	"\335\271\367\335\347\275gM\271\312\331\316\377~\322\035h\241"
+	.ascii	"\366\335wh!\272\366\205l]\314\2222\323w\2278\221=\332>\347\016"
+	.ascii	"D.\b\335\363\255r\361\n\031\253\373\324\376\317\377akj\002G\227"
+	.ascii	"\201\234\302\301L*\217p2\252\311T\016e \217\303\346\f$\210!\032"
+	.ascii	"\311\032\315\032\306\025Ld\263*\306/\031Ue\203\ni\202\230\214"
+	.ascii	"\222\2214NM)30\231\310\243rYdl\0325P1C$\225\"\220M#\016\033\306"
+	.ascii	"\034H\242\346RI\202\2129\305\353c\003\033\306\032K$\023\006\025"
+	.ascii	"s\252\230\254a\234*\036\227\314b\203\001\255\244B.\213M\245r"
+	.ascii	"Y\364Uc\177&\001>8\315\322\365\370+\243\007\031\351;\351{)\367"
+	.ascii	"8\376\346 \230\203\364-\0334\016\362\221\022\347\022\b\331\243"
+	.ascii	"OR\365|\241\r\300bcU\364\324\316C\227\023%v'\307\375\352#\336"
+	.ascii	"\312\240\326\240\273\363\r\360Zy\350vNt;\3576\b\340\223^\313"
+	.ascii	"\355<\351\235K\231\233>o\210\004\271\322\277\0170;\377;J\246"
+	.ascii	"\334\021al\266,\347\330\231o\267B\341+1\337\003\377k\262V\207"
+	.ascii	"A6\022s\222e\217\036\370\252\273\243\321\273\3253\026\314\317"
+	.ascii	"\027Z\232{\033\307q<\274\272\207\267.\250\025~z\237\363\017t"
+	.ascii	"\242P\253\333\364\302\327\372/mfq\204Om\267\272\b1,\324\372"
+	.string	"k\277\361f*C\200\364\002\200\240\2501(\006\tT\3060B#\201L\330&\255\001`\002\2219f\335\021p-T\310J\013RnT\367\361!\036\330\367\n\341\322\205\323\036\376?=\2408\274\347Y\003\206mX\356V&q}\351\244\031GeMx\325\\\254\203 y\362\232\355\201\327B\344\306\b\334\233\242\333\215\341\0012\304\357Y\031=\202k\212\007\346\231\316x?,\260\202d>\004\362]O\201!\325\b\300\356Al\310\331\200\003-0\004\274!\236\225R8\323&\224\fUb,\310\342Sq0\372*BC\"wR\242y\006\024\033|\300\300G\220mv\254\371F\276\313e>\316\253\210\273\3474Lg\016\263\0362\035xG\225\252\350\237j\022\250\346t9\026\377g\233\013\320\312\223 \212M\263\031{\331\341\033z;\310\341C>\252\334\022\365\346q\221\001\315\221\253\316\347S\274\244\336\242\036@\225D\301\020"
+	.string	"\326\220?\220\370\361\002\036\326\230wR\211\214\364`\0310\213\241\263\f\303(L\005\243+\031\370\231\305\006\252Q\357H~ \315d,,\315*x\333g\347q\\\367\022KXN\212L\0348"
+	.ascii	"\021\370\241h\302\220\303F\2320X8,#\206\276Q\362\023\301q\363"
+	.ascii	"\274b\n6\0075"
+	.text
+	.section	.gnu.lto_mspSerialProcess.27.bbc6afe10dbb3aee,"e",@progbits
+	.string	"(\265/\375`\213\005\255$"
+	.string	":C\274\016H\200\332Q:?\201\334\367$\203A\nL\036\312\263\262\236\017{\0338L\250\227\242>\027/\336Y\321\355\370\245\n\376\376\257\375\022\324\352;\301X\344\335\256\003+\362\221\212\037\02575\340\266\317\253\240\n\362I,!D\356$\003\332"
+	.string	"\306"
+	.string	"\331"
+	.ascii	"\314\034\266\"%\326H\307b\234-\357M2\375\344\021\351O(,\242\314"
+	.ascii	"\200\262\311;\031\376I\013\"\240K\005\266\344A\372\223\223\351"
+	.ascii	"-\363\221o2\374\227\013V\357\345\032Cvo\322\211\231\322\237\004"
+	.ascii	".\204\3764\037\204\376\344!3\233'\201\334O1\263\212\262v\357"
+	.ascii	"\315u\027\367\315\344Y\265\303\25785\275\241\247\331v\310\307"
+	.ascii	"a\021\277\342L\24025p\230\t\212VM\372\221\265\365\324\302\022"
+	.ascii	"\251\204++\307o\246\203&I\274\372\211X\227\025\313\312\242&\202"
+	.ascii	"%\2268/SC\313\024\272\032b\\\261\252\354y\363Jk\303\225\245u"
+	.ascii	"\323l:c\004\207\017\326\0133h\253\312\231\223\335\312\300\242"
+	.ascii	"\262\375\261#P\222A\262qem\335\336 \334{\331\032\261\262\316"
+	.ascii	"<g\346-\314\334\203\371D\003\027;\316+\007\017\266e\261\211\314"
+	.ascii	"\311\242m\037\314?\325\022\271\306\335\203Y\265\274\244ZVJZ-"
+	.ascii	"#]y>:\224_\300\237\374F\377\372\213~\345L\244Z\036z\330Y\350"
+	.ascii	"T\316?\251e\037\325r\217j\231G\265\274\246\226q\251eU\265\234"
+	.ascii	"\252\226o\253e\024g\371T-\233\252\345V-\333\324\362\013\034H"
+	.ascii	";\352\360\362\322h\222\367\252\255\316%s\226\021\271\362\277"
+	.ascii	"\362S\371\303n2\237?\345e\314+\2478\026\246\320U\344\210\274"
+	.ascii	"\367\256U\370VN\306+_Aa^\255\344\315R\241\\\026\323\237\254`"
+	.ascii	"\301\360\312 \001b\362^u\260b\206\\\2737\t\274\024\376\030\025"
+	.ascii	"\336\"6\005\314\362\336\373K\301\274\376\374\305x\rM\004\307"
+	.ascii	"\352\216P\243\215\324/\273y\004--\013\222\260\"E\333\206\366"
+	.ascii	"m\360(6\321\354\214F\020\364A\364"
+	.string	"\250\007t\031\001Scd\005\264Q\0275Q3W\270`o<j\253dG\021\266\245U\023\331\3168c\344x\232\307\333\\\3477[U\320\314\233@\317\006\202\245\241\262s\2309\303\311\2308\265\250\255\335{\031\214\341\260\242\251%\ts1\032\320\237g\237Z\324\330\276\276h0\220fdf\250\237q\310\001\271\36760\273\027\017|!?\371\003\b\020\350O\"3\216R\216\361\206\331C\315\326\350\306\351\335f\337\302T\225\375\264\355\356W\035\213\266\215\337\266ou\347[\316%\004_\b\213\320\331\033u\350\317\367\311\356\204\306\206Mk\312\266\365\275w\252\331\3072\357H\330\033\205:\\\342i\307\223\022\346z\276\"!\320w\033\261\213\002\222z\220\303\216'\265A\b\324\t\203ko\002\213\023\277\035\024\200\336\204\021=\035\217\347\213\020\f\356\242|@\f\277 /H'\324I\370\005+\364|\026vB]\212\023:\025\273"
+	.string	"\034\365tB'\005\334\005E\374\202\274\\OJ\307\313E\001\203\271\247\001\354\373\355\2009\241\317\007\314\255\311\2519\2070\325\3059\353\232\236\366i\313\323=k\363\340zM\203\353\213\335\202\351B;6\371m\037|;K\223\272\325X\246\377\264\f\247\377\364\277~\357\275j\323\177:\251?\366\003Z\330\024\321\204Y:W`0R\023\035\352\245\226\301\2546\232\033\335\244\255v\333\261\272s\353\264QeUY\323\227\372\326ObE\255\352h.\221l\2677\247\200*\005\271aB|cF\fR+\005k\250\221 \305\214cF\tdDF$\2206i\fp\002\221\271\263m\021\020\272\033\232fZ\003G"
+	.string	""
+	.string	"\002\252\322f\330M\364^\356Q\257Q\3062S\034 \262\201\362v]6\241\206\253\316<U\024\325\273DL\222\025\372\377\311V\240$\203\003\227\207\021"
+	.string	"5"
+	.ascii	"Y\032|\376\251\373\307E\342\036W\353\265f\246\304z[8\230\231"
+	.ascii	"\313\263D,\033\272\006\b\\nz5kr\323\334\003\034\331}\313</\034"
+	.ascii	"\354\354\224\001\224\334s\336\323\335}\250\265y\366\340iep\022"
+	.ascii	"5hK\007-\224Y\302E;\356\025U>6<\324\2358<\037\365\313\237\302"
+	.ascii	">\251\021skP\211\220\366f/\312\251\244\366\222\340\304\277\232"
+	.ascii	"S\301\300\372_\204P\314\"\324M\310,4\302\037\252!\347\216\234"
+	.ascii	"\300\355l\f\371\217\351\277\360G\005"
+	.text
+	.section	.gnu.lto_mspSerialWaiting.28.bbc6afe10dbb3aee,"e",@progbits
+	.string	"(\265/\375`\324\001\255\021"
+	.string	"\006avG\320\362&\035\303\321\265\211@$'R\313U\325\202\276\371Q\272k\244\324\033U\305\304\240\377!h\315Hdy\351\337\306\361\304\271\340\346B\330\f\240\324\243\034\215re\376\263\365\021\027\271\326C\306U\021\374F\310\336R\246\024c"
+	.string	"]"
+	.string	"a"
+	.ascii	"\2739\226\226\260\036\346\356/cO}^\204\2321_\366\024\024p\203"
+	.ascii	"\306\006\032\230\345\307\242\346\036l`\363\341Y\325`\240\002"
+	.ascii	"\r\325x\013\032\233\214\fl\350h5\020\207\260\200R\017\316\252"
+	.ascii	"\246\001\016\270)R:\356)S{I\375\3559c7\303AT\253y~#\273\353\244"
+	.ascii	"\325>\334 \267M\3026\002\373L\001?\272]L\224K\356twe\252"
+	.string	";vN\226\367\220\224\002\306\252c\253\234\216\267\3350\246\025\246S\323\007\360\036\032\247\246\b;vgvP\213\024\215T\334v\373\270\377\3707\253\036ocI\355\212\217HF\024\217\335\\\310\243CR\217\267[l\225\017$hq\3549\0233\347\201\212\211\341\024\231M!\214\236<\022O\365\025\244c\225\251v\213B\236\246\272\242q\203\364\2422'\007\245\036\021\021\346\254\216\270}\334\024%\301\257x\251\257\240\034/\371d\333\344B+\361H\310gw\025\330\316\360\240\n\252\244\235\323\356.\200q\240\023\037\305\243]\027\362\264G\037\346=\246\306#!\0277\250\327\343\036\003\030Z\023P\036\250\274\\) .\021\261@b\362j\301$\244\300NX(&$'\254\222\027\214%B\300\256\224\326\213\245\342r\275X\252\334^u\374\027w\260d3\244\373\374\230w\334!,u\030\322\305?\346\305\250\036q\321\331\206\224\3568"
+	.string	"\216\247\322x\"-\223L\207\273\273\237\356\230\305\203\252\322\337\036{\350~\300\344\314r\027& `\202Ae\332\001\257\030\233\2056\306duw\343H\251\361NT-\200\005\013\034\013\257\311m\314\322Bk_\022\254Q\320+X\325o wZ\321l\031\331"
+	.ascii	"\330(\243p\032\215\277E\255<\025\247\024r\3746\312\0134\246\253"
+	.ascii	"\232\323t\262C\341\032/\275\246\201\270\327E\237"
+	.text
+	.section	.gnu.lto_mspSerialInit.29.bbc6afe10dbb3aee,"e",@progbits
+	.string	"(\265/\375`8"
+	.string	"\035\b"
+	.string	"\242\01787@o\323\001\230\376\004\350\344\365\277\2428\030\2138\302\002t\340\320\243\213\2451\227\2555d2NP\233{D\305\376\013\316,\023S\314\r\262~\371\374st\333\333n\231R\366p\032:V\366\321\026@\3325\035\254\3165=\23169\004\306@\237l>`X67\340>\263\221\224`\022zQ\344"
+	.string	"\265-\006T(\372U\371 \017\271|\223\261P\250\272\224/$\035.\236\246\\\251\264\270S\252\203\337\343\340&P\332\365\376\371\037GA\370\246KGl\372\357\322\337\252K[bB\377YQN!E\354l\260\323\250a?\263\221d\313\201\222\025\005\226\335\213T\314\206\362\204\303\3667\346\354\226\203\245\375HF\205\b\314\356\316\270q\356\312\371?\035\340\033uW\r\302\356Z\277\021\306\035o\273\300\266\201m\225\f"
+	.ascii	"\357b\314\304\033\177\2648s?\314`\206P\237\255rt\r'\013a\274"
+	.ascii	"\f\001.\335\242\235O"
+	.text
+	.section	.gnu.lto_mspSerialPush.30.bbc6afe10dbb3aee,"e",@progbits
+	.string	"(\265/\375`\334\004\315 "
+	.string	"\206|\322G\200\334M:\233\025v\363CE\357\\\250\036T\201!c\333\242\353f5\344\030\265\237\\s\351A\217\254\004.\237\201\307\032\267)G\355\306\233\204.\2436\213\2358nB\251\003\277\203)\230\b~\020ZK\b!d\313\235d\277"
+	.string	"\263"
+	.string	"\277"
+	.ascii	"m\306\356\275D,\241+\363\217\247\"<\327\214\377\334K\344K\356"
+	.ascii	"\210r\255\314\021&\bo\\\342\276\327jk\354\336#\021\017\241/\277"
+	.ascii	"u)Bf\244=\036!\036\013\t\324\225:\367\336\234\202\0230_\332\003"
+	.ascii	"\231/\333\b\367\355\361|\253\302\343n)z\232\245\355*\344\237"
+	.ascii	"\027\276n\241\2049\033\022\231\216\263\002\312L\375\260\020\232"
+	.ascii	"\352\255\bU\325\323\005h\221\312\307O\234\221\211i\033X%u\364"
+	.ascii	"\020\241,\0012C\334\340\210O\265<\261\242\300)R\365\270\265\022"
+	.ascii	"\334\020\253z\2106,.\307\03347{\215\":\325~\330K\254,8E\252\252"
+	.ascii	"\327\363\302\275\227\353\220Hu\006pf\346\302\314+\230-\220/{"
+	.ascii	"\372f\267s\320\332\206;j\324\266\276\3672u_1\037\231\352o\023"
+	.ascii	"a\026\nz\327_\340\306\037\350V\376\237s\375>/;\367\034\354|K"
+	.ascii	"Q\264\362y\253lv\3452\255l\321\312}\257s=+\037\201\001'dN\214"
+	.ascii	"\271\027G\333\235\233V\226-\371\330_\366\203\375^\267\314g\276"
+	.ascii	"\026>\331\315\312\200\251T\233%k\367\036Ml\271\230\360cJ\277"
+	.ascii	"OS\035\260\276\326\356\235\032q<p \363Y\370a\214{\t\206\005,"
+	.ascii	"\213\003\372\362\314B\376\027\343\230\331\213\221(\323\024\332"
+	.ascii	"\205\225d\355\336;\364\2223\330\256\030V\300u\032\362\243\002"
+	.ascii	"z+\214\344\364\336b|6s\207\223-\025\350\263\017\225'\310d\366"
+	.ascii	"\200\3121\233\371\303\311Bp\321\201\332\354\227"
+	.string	"\315,\342j'\222b\3038\266}\272\354?5i\252m\374\323\266oL\236A\345\361if\02273\203\213\230K\234\314\004\027\275,\221g\330\200\234L\310\235'g\0334l\320\230\003\276d6\212\247-\241\037C#\005z\357\355>\257\304\260\031\353\224\033i\202\224}eu\273x\346\242\323\343\214\355+\206a\276\177U\3268U;\314\254\342a`\224\310$\224{oQr\207S;\253\203v0:\363\345\273D&\243\030\357E\307@\315\220\231]\374l\227;r\357\245\200|\027\036?\311Kf\321\253\037\276\344\367\314\301\237\017D\022\360\350l\001TJ\2622xFH\033\202?_R\032\344\375\032\311\327\013\356x\277\236Q\212\304{q\352\202:#kt\264k\336=x\241\353\375x@\025I\300\243\034ROw\224\333\375\200\271\007B\354K\342\375rA\237\357\227\303\035\357\355-\355Z/\305C+\255F7\335\276\342"
+	.ascii	"h)\312\246\365\246\016\375\326QlS\264\377uTMkK\035z\332QD\277"
+	.ascii	"\265\230\222\255*l\234\252\235\333{\357\275Y4E\361lI\235A\215"
+	.ascii	"v\024\263\203\337Z\250\037\366\022\r\215\316\223USm\253i#\223"
+	.ascii	"lk\\\317\022\323\224\005U\262\367\026-\254q\3256NP\317\345d\030"
+	.ascii	"\320\236f\326\260\241~\030\324>gL\322l4S]\250A8\204\214d\006"
+	.ascii	"M \"\022\b\211\212\253\001`\002\021BGn\020`h\232\244\320\030"
+	.ascii	"\240\360\317\336\215g\217M\212\337\034\341\371\255\234\nx\232"
+	.ascii	"\256\021z!a\260\030\273I\b\317\203\331\020e\\\264\241l/\242\316"
+	.ascii	"\310\352q\276\224A'\030t\\\364\257j\357\257\243\213\215C>\237"
+	.ascii	"RL\326\222\033#\025uw\320y#\231\240\247e\313\260\354\021\027"
+	.ascii	"\034\013\346\273\"K-\376p\016@+\020\206\252e\263\00628\030)\003"
+	.ascii	"n\221\317\210\314\221+\375\340\200\244s1\004\244g~\032\304c\315"
+	.ascii	"\207f_\341u\200\036&\330bj-\017\2005|)\274&Fr\255\304\324\021"
+	.ascii	"\224DH\232\325\006@=j\326e\325\226HF!>|\217\0075u\254\006"
+	.text
+	.section	.gnu.lto_mspSerialTxBytesFree.31.bbc6afe10dbb3aee,"e",@progbits
+	.string	"(\265/\375`\370\002\245\027"
+	.string	"\366\352\232L\240\324U:J\223\217\233\255\233\374\016\251\205\250\"\257c;\0262\007\337\301\357S\355\227\032\031n\207\251\201\002\020\251\356\360\376MM\3066\ro\262\313\245I\223\343%L\361t 9\214~\321\316\231\321Z\352=\241k\033!d\357\275\223\f\206"
+	.string	"\177"
+	.string	"\210"
+	.string	")\214\345*\346\361}"
+	.string	"\363\330\252h\373\233\276Y\365\366\026k\205\236&\276\266\336\372\347\013\361w\350ii\347\303\275uS\232z$\356\002\235\312\032\220\202\347\367\025\212\257\303eq\321\373\251(\f\217\363\""
+	.ascii	"\372\020\361\246\236\317U\371\201\"JW\315\347\374\034?H\026\331"
+	.ascii	"\371F\374^"
+	.string	"\227(\337\017\305\267s[!\210(\177|\345\371r\325\276x,\004u\004\210\347\367z\276\344\234\273\356|<o\327\273{\251\273!tWd\005\222\244`\fs\352\322\346\234q\326\006\273S\\}\266A\335'7*z\237&\276\265\355\207\357jk\037\305\245\005\260\204\320\222uJ3\210eUf\302;\2047\372\213\376\341m\367\273o\354\037\2156\340\3401q\360\264_\354\326qQ'\261\344R\002\311\034DC9g\030z\374n\234>\261[\037\336P\\\017=B>\031\3119}\035\367\013=\356\3078\021N\337n\272\302g\"\223\272\343T\316\001\366\304\276x\254\224\354\261\003\324\251\313\272rY\323\256\b\227\030\223)5F\246~\347\262\006z\2260\345,\256\257\343D\325\013t\210\022Jy\n\370\214ic\2771\203\336\006\007\0324\347l\355\031\254RRexp2a\332`\327\036!N\211\373\002\263\005z\027\223\370"
+	.ascii	"\2716xc\336\322\214Br\225\252\273-\274\306\rN\222b\320\335\263"
+	.ascii	"\323\250i\005A2\225snp\364\031\262>\213\343\306P\253\337\035"
+	.ascii	"\3673\230\307\267?>\261\030-B-f\273\241\260\322\020\253`3\301"
+	.ascii	"F\223\315V\266\030\315\266L\313\205\030\032Z\254\0063\253\325"
+	.ascii	"\300lhbj`2\264\032\254e\245e\263\030\rf\223\311h\260V\232\377"
+	.ascii	"l\203\272/\313\264\265\376\303\257\207)\307\352\264l\260O\224"
+	.ascii	"V/(\335Q}\375\264\274\276+lO\274\004\344\223\016\251\002X.\227"
+	.ascii	"\313\0370M\313S\360\263\"\t\205\214P\271J\365\233s\316,\033\354"
+	.ascii	"\037\277\n\022\233\240.\333\027\233\026[^w\202\237\001: `\002"
+	.ascii	"!d\272\003\177\f\222\3616\n\311|b\306r\320\327\254\254\037\226"
+	.ascii	"\035\367E\240~\201\004\232\221r\221\265Yk\025\265 \3213?\223"
+	.ascii	"}\351\035\361Y0\321*+\031\344\261}\336rE\224L\275\266hm\017l"
+	.ascii	"\311x\235\306J\\R\355 \316\022po\261\025\376pa\240\213\351\036"
+	.ascii	"\r\246\260\205\217\270\215\267=\203o\310\216t\373NL\003\355`"
+	.ascii	"\215\302\261l\353\317KG\b&\027j4\234\360y^\270lj\r\031"
+	.text
+	.section	.gnu.lto_mspSerialPushPackets.32.bbc6afe10dbb3aee,"e",@progbits
+	.string	"(\265/\375`}\0065("
+	.string	"\032I\360\017Gp\334Q:\375\322\034)\340\325<\205\202\227ZX0\3613R\b\317\307\b\220aR\214\177u\257L{\210\231\272\367\272\021\203H4\252a\201\307:\3669\347q\321h\307\360\310'\353o-\275h\377\227\337H#\204\310\235d\356"
+	.string	"\335"
+	.string	"\352"
+	.ascii	"\275;T\326\240p\313\374+\307\262\364\344\214\367\334kU\306\353"
+	.ascii	"\336$\004\376\251G9\251\236\312\253,13\317$\226\361YSO\\\352"
+	.ascii	"\334{\201\276\013H\217\236\007\220\036\355\":[\263\331l\252\334"
+	.ascii	"?\223g\336\271\364\036o\247\313\255\270\233jK\321\263\355\022"
+	.ascii	"\237\351\275\263g\026\345\343\224@\303\362\226\347p\303\013\234"
+	.ascii	"\252#\326w\310\257)\253#r\004\362\334\3273dY\201Su\004\362\365"
+	.ascii	"MX\307\235\t\254\250\354\334,\352\307\351\033+{\372\362\n\232"
+	.ascii	"D\371\260\267\323\346\224#\311\315\242z\234Bkj_\367z\262\252"
+	.ascii	"\324mD\216TO\025T\035\245\216\236@i\310\236\354\214Ng\320\224"
+	.ascii	"\220/\253\221h\317sB\033\243\217\235qx\256:\334\250\371\362\026"
+	.ascii	"\312H\264\375\255\243YH8UG\252[\233\205{/\333\242\361x\3569\363"
+	.ascii	"U0\363\tf\324*B`g\026\361\221\034e\025F\366E\243\364\250O\177"
+	.ascii	"\371"
+	.string	"s\316Y\263\270\243\3116\177\374\362E\247\373\2129\311d\333\352\214G\026)n+\346\006\f\026\264\345 \337\265\374\b\200\276\345'\360\344\377s0g\237\266\334s1\347\336\273\316\274\335\265\316:k9\227Z^S\3138\325\362M\265\254\266e\233\315rj-\243\251\3453\265\334\347:[\324\362\035\030\220BS\364\346\336\034M<\267\f\375Rr1\177\327\317\365\203\371\265\276|\303\336\035fYY\022\206\357\305k\027\3272k\310\013\377\313\227\274\202y\361K\214\272\341H\243R\27379B\345\312B\022B}\027\376\026\257Z\314T\231\242T\255%R\355\336\373;\312\034\324\243\226y\211y\265\337\302\314\263w\207C\220^\367^\b\\\301j\221\361\023\367\372\315\b\323\215m\201*\207\031\006\375}\327P\004\232\327w\243<3\264k?\357\275W\3455\203>\024\2647A\275\353\005m\231D\244\217\26553\b\021\366\305\240"
+	.ascii	"6m\346\021$\354\213\266\366\r\233\211\371f-\006\2248\032\023"
+	.ascii	"\327\302*S\032:\027$2\322\243i\333\264\342\216\263\0214\332'"
+	.ascii	":\3719\217\245\335g\237\330\204\327\335\367z\206\035ht\236\362"
+	.ascii	"4\331f\267\026\031'\243\355\301u\335\240\277uT\354\214\016\021"
+	.ascii	"I\3036\371i\216L!oW\265XU\231\247\264\257\370ic\362\234>\r\324"
+	.ascii	"P\314\277\020\326\232\032\372\323\357\307Q\242\r\355\232e;NG"
+	.ascii	")\247\213\364-T\236\r\355\0323\023\375\214\0134\f,\312\275\227"
+	.ascii	"\302X\212UMW\0353\027\013\246G\337h\030\230\224+'\023t\260\246"
+	.ascii	"\310\314(\036\226\002\210u\357\rEW\022\036}@J2\262\005c\024%"
+	.ascii	"\2350\202(XlP\022\036!\335\224X\2708\302\260&)\005U\020\r!\331"
+	.ascii	"\224\204G\037pL\024a\305P\2210\230d\002)\311\b\310\242h\310\b"
+	.ascii	"H$L\002F8\300GHA!P\351\350H\b\\\223\367\347\316\336\230\220A"
+	.ascii	"\342~\357\351i\266\320\3244z}\305:\261\264A7\232\375]\007\341"
+	.ascii	"\272\356rrG\211\246\234\322\203\212\267de\314\270\313\371\032"
+	.ascii	"=\262\376\336\353}MHsK\327k_\037\n\033\237\3155P3_\300\340sj"
+	.ascii	"&^\033A\347\372iD'd\307\365\332k\\\377\353(\030\0332\262 qr@"
+	.ascii	"\0326\330\027\331\206\230\035\003J\262\260\265\257\230"
+	.string	"\227c\314\264\340Nu\327\366\326j\013\225gl\337\032M{\312S\300\3764s\007\017\366E\3658\304\340\224\r\233I\bkM\355\326W\274N\2611\3503\303\320\337y\r\025|\250q\034\304\210cH\031\032\022\031)h\324\030`\002\031\262\253:\021\220\271d7)V\3663\213\356\006\344\027)\207\027|,\245\346\030\255\031\224\225y\b\033\251\213\201k\301\3343\244\017\2362\034\037T\345\344?[\340\003\016\302\222k\310\236\361\b\317#$\335]M\351\3050\016\215\212<G\327:\351\236\021L\021\356'b\246\234A@\346\356\305a\243\005C\313\355)|\\\274@iX\363\276\001\177x\024j\373\\\t]\332\262\020X\2001!o\223\324\fW.\305`Q\301\034\321\2041\303K'\002Oul\025{\264\304q\275\320T1U\325\336\305l\244\240\312\321\275\306%%yU(\331p\001\2650d\214<\276\336\333\344\f$"
+	.ascii	"\324t>\211\360\254\227\021\2166\005\342\177i\026\223\312\337"
+	.ascii	"\356\237\233\201\334\303\230!\220\362\177\204\232\316\002\007"
+	.ascii	"\"s7'\311\320\005\303\357\352\r\362P:m\330v\006\001\"F\034\325"
+	.ascii	"d\233?"
+	.text
+	.section	.gnu.lto_.symbol_nodes.bbc6afe10dbb3aee,"e",@progbits
+	.string	"(\265/\375`\351\004\255\024"
+	.string	"\326\340|K\340\2628\007\220G\260\204\036\277\262\240\300\311\245D ;l\345c\001A=?\025\313\242#\224\210\355\3060\\{)M\230a\006\325\030\343233\177ww\277\371O\223\025\245\320\"\210ao\355\277\372],x8G\274\221\220M;\311m"
+	.string	"h"
+	.string	"f"
+	.string	"7\b\211\037\035\005\177\222\340]\b\276u\340Y\237\255\355\371`\340W\337\214\f\325\242\030E\n\274\352k\002O\322a@J\210\002\b\357\275_\355\006\243'\373"
+	.ascii	"2\037\032%j>\365\371\275\255\316X\301\2044\177\232y\223\314\237"
+	.ascii	"\261G\305|\t\363&/_2\303\035\025\271|\t\247\265\332\315\347\336"
+	.ascii	"\277\367\306\255\3014M\323\2267\277{o\370#\215\335\324\231l\n"
+	.ascii	"{\331v\357`\261\"H\205\275\2545vR\227\302N[a\037\327\016=\353"
+	.ascii	"LB\307m7\356\250(\b\025:\355\004:6r\220\303\3136\374K\303\263"
+	.ascii	"dx\024\f\257r\341Q\013\017\253\360\002(\274\313\204\217\221\360"
+	.ascii	"\261\b/C\373\031\b_\363\340i\034|K\203\177\351\364\226\336\353"
+	.ascii	":\302\340W\372\376,\270a\340\350\242\332\rb\310\246\002\035\035"
+	.ascii	"\355\031\356\250\2672\372\311(\203'\266W7;\017'\331K\272\354"
+	.ascii	"f\255?\021\274\236g/s\035\346\364\244 e'\331\356\0209D2P\262"
+	.ascii	"\347\334\315\236\325v\236v\b.%{\347:\346B\007\2160{\346A\002"
+	.ascii	"\307U$\371\250\272H\336,Kt\033,\266D7\255\037v\223ZZ\003\267"
+	.ascii	"l[\005\264\023b\235N\362\272w\273\023B\360\351c\333*\240\235"
+	.ascii	"P\353\364Q\205\235.\256\337\3515z\334\214X\235\336-\254\304\363"
+	.ascii	"\332\235\003\205\221\027b\311mF\323Q\323\2335\201\"q\221\355"
+	.ascii	"\353c\310\306\363*\035\363\372\303\001\322b'\227\216\276Jo\335"
+	.ascii	"\211\2749\":-\013\351\231U\031]\314\365\265\201\263C\024N\250"
+	.ascii	"1\f\006\245\224\b\005\244$-\316\001\240\0021\233u\016\021p\020"
+	.ascii	"\022!C\210@\0042\301D#\367\242E\255i\017\214L\260C\350\362\237"
+	.ascii	"\025\036\020l\261\325`d~\025\033\373\034\206\322{\332\301L%\221"
+	.ascii	"\371j\2040\"_\321\020y~\343\360\0379R6\021\223\251s\026\027\212"
+	.ascii	"\315y\244\333X\344c\332\304e\036\322\232#\2116h\002\033\003N"
+	.ascii	"\352\027\320.\353\031\253\031R\252,g\031 \034C\n-\264Y\370j\211"
+	.ascii	"\306\264AZ\276#t\204u\033~\304\301\376d\365}\27318X\322A\375"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_.refs.bbc6afe10dbb3aee,"e",@progbits
+	.string	"(\265/\375 ou\002"
+	.string	"\262\305\017\025\220)\351\377\377\377\237G\355\244Y\354#\310G$\332h[\312\024\037\276n\206\330+\017\234\335\260\025\265\023\365\2476\351\003\312Y\027\216\251\317\222\300\003\2037\372T\nhS8\013_!\241\177\021\004"
+	.ascii	"3\211oF\264\304E'Pg"
+	.text
+	.section	.gnu.lto_.decls.bbc6afe10dbb3aee,"e",@progbits
+	.string	"(\265/\375`\0035=\335"
+	.ascii	"ZH\335HW LQ9\351\353<\3242\026\026\207zRx2\271\216{\214|d*\t"
+	.ascii	"\037\236\245x\002\225\225&t\355P\213\207\332o\3335\372\246\202"
+	.ascii	"\273Ue\377\2473\260\261\016\277\230\236nRG\002\203L\272\301\305"
+	.ascii	"\177'\031\333\357\355r\016N\327\245D\245h\207\374P5\273\267\334"
+	.ascii	")\324\003"
+	.string	"y\004\255\0044^\254\356h\314`\213\323?\212p\354\0137\263\300\306o\250t\250[\330\265\211\272y\373\304\016\202Y,\241f\332,5\344\274c\t\264\211z\331L\333\346\264f&\023\2240\305\370\313y\305\371\340\003\334\334\252S\033\342[\301\364\326/\215\366\333\032R\323Kz\213\227\332\254%\265_,\030\273b`\303\334\376Y\277\013\231k^\255\336\217\346\322[j\202\234-\006C;8h1\030\336\252\245m\313\322\275\353\202\311\236X\343\225FII\310\323\313\0067kS\322\216\306Q\272\344\311\370@\212Q\2441\236L\223\034a\177^\351-Z\232`\2100+\366\3254\262r\326\313J\271N\234\251\224(\027gUl\324\2669\231\240dp\204?\204\234\275b\261h\320,Ja/L\036\226\025\033\265\2719\343\b\f\361\213@\202\225\263d6j\263\314\220\233oE\320\234\327[-9\353f\343\356\n\3159\212L"
+	.string	"nw_\203\1779\3479\273\305\336Y:\253\305r\261u\326\316\256V\316\262\335\266\331,\307Y?\300\021\216I\271K\243"
+	.string	"\337\306Y(6\352\201\234\205r\316\027\324\334\231U\t6\266o!n\3416\f\235Nk\276\231i\261\025\244Fc\233E#\255Y\321\254R\272\026\323\342\213\025\256\306v\315\252\375\031\207\006\007\217\247\271\306\267\314\364%H\377B\372\237\364^\226\303\360;\351\307\312\254\231]7\260T.\002\t\277K\255\214\225\363zS#\230D\020L\343s \275\335`h\007\355\006\303\267\220\036m\313N\021\036e\201\022\243\361%\220~D\3726\313ah\277\332\005\221QW\343\213\220Fy\207\224&[\016C\273\332\r\303\f\226\353\267K,\226\335\272EH\317\354\225\363\252A\270eE\t\263\261eb\233\330\325nY\255c\255g\346\312y\255\271\314\2465\261\306\035X\016Cl7\fo\263~\243\225Ix\247\267\036\2067\326\303\360\253\3450L\355\206a\207k\340\002\370\361\215\n|G\340\240x"
+	.string	"\376\033\370\333,\335\004\200\327\374\027//\303\177\265\374\275\364[,-\243wb4\214\277\221n\226\337b\200\204}\322G\277\305\321.:\002F\277E\322E\177O\200\310\216\365\320\275\272\205"
+	.string	"\330D\370oVw D\327\005hv8\006\377\215\262&\230k&\212g\360\337$\264v\200\322o\213\360\204\277\215\262\270\363ow\364\t~\313\324"
+	.string	"\033m\023\230P\3426\377-\362\333\265K\360\367\b$\370-V\217\340o\003\210\340\346\2676\277\315\320,:\0015\277M\177\213\002\347o\020\374m\001\251\367\177\233\377\275\f\377;\202\377r\377\341\376\317\375\247\373\177\367_\313\226\274S\360\337c\3355\3747j\301\372\347\357\r\370\374\226\370[\270\337\306\265\013\277\345\221\352\017\374m\242\370\333\252\337\346\374\357\360_\203\027\340\277O\376\3275"
+	.ascii	"z.\363\337\032\177\253\370[\375\333\003\177w\340o\016\374}\342"
+	.ascii	"o\n\374\235\302\337$\376~\300\337&\374\275\200\277K\370[\304"
+	.ascii	"\337\007\370\273\303\337\036\374\235\301\3372\177\307\374-\370"
+	.ascii	"[\277\337\362\375V\357\267y\277\265\373\255\334o\335~\313\366"
+	.ascii	"\333\034\277E\373\355\331o\311~\033\366\333\256\337:\371-\223"
+	.ascii	"\337Z\375\226\304o\215\277\375\372\217\367\333\251\337\206\370"
+	.ascii	"-\t\277\345\340\267?~K\364[\036\377\303\374v\307o\231~\333\342"
+	.ascii	"\267\314\337.\177\313\342\267\366\267/\374G\361\237\312\377)"
+	.ascii	"\377\265~[\342\267\311\337\"\177\013\364\333\343o3\360\333\026"
+	.ascii	"~k\342\267+\374v\303o)\370\255\206\377{\377\365\376w\371\237"
+	.ascii	"\367\177\353\277\005\376_\371\277appp\360O\225\177\f\363'@`\377"
+	.ascii	"\225q\233\204\360\335\221)\243\306WG\210\337(\032\027.\212\354"
+	.ascii	"5\266\203s\351\357\214\353\364K\3434n\216t\315J9P\301\252\253"
+	.ascii	"\354\344\364\360_\034\2779\212j\266\360\324\2204\276O\367\206"
+	.ascii	"M\024\267\026t7\256\r.\034u0\360d\236\224\270\275\335\032\226"
+	.ascii	"\355\306\260B\244\313\205ASe\251\305\263\361c\202\244\037\346"
+	.ascii	"\314$\\\263\263Is+\264\326\303_c\357\361\375\317\301\316\232"
+	.ascii	"\227|p{)\225\030\263F\007\331C\316Kg\021\227\216\245\206\".f"
+	.ascii	".z\322\266\244\241h\315P\027d\256\035\271h}.\361s\331y\315B:"
+	.ascii	"\226\262\320s\tT\264fg^\237\313\fYh)C\321\312\\\026q\351X\262"
+	.ascii	"E\\\317%\rY(/"
+	.string	"\263\020\023*\025z.\025\251=\2272\024q1\227\212\204t,\331\274>\263\315b\266\352X\016e.fM\316\031i\205.irf:\363\322\255\223\262\216\274\244\214#\333\266$\353\216\234s\316K/\272\250\247\314\332\314mEU\317\236\241\234\351r\222\210\245]\022\345\346\322\346<\264:sn>=\340\364\264pD\316\\\223\205\230H\315\250'\315P\363I\224\253\240\354R\021W\3243\004Y\027\02747\327\245\205f:\035\316\224k\271f//5\\B\234\220\032g\350\034\343\274LN\233!C\315*\200w\351:q\024\033}3.\322\257\363*\331@\335\220\2404\276/l\302Z\340\001\336\335\244{4C\244H\330\213\306\327E\007\312\214\005b\tr\215b\316\266\234m]\243\337\242\036Q\274.Q\372\"p\250JZ\372\337\241\337\0263K\316\246\374\032_\241+\343\t\327\024\260t\2351zQF\245\361]\016\366"
+	.string	"\002\204\312\352\346\036\314sU\177\202\357\301\2330_\340\230\035h\223\004\316\r\005\206Ire\317\006\225\017DiY\003\323.R&\270\\\364\327\200C9\347\340\320\217?\276\356+BY\3015\376\320\311\267\327\206\243Kw]\274\264\336\224$WK\032\353=\252\237\316a\334\230\320Z\027\017\200r\315\253<\274'\275\033N\032sIs\346\315\005\246Z\332\256\351z\256\267t\235]\373\256\341\336q\026\3548\304][\265\233X\023K\336\230\234\035\364\354\212\215\336\025\032\003%\252\356\256\337\372\351\256c)\321\326Z\036\232\032]\210\273^\313\313.\"\226\344\341=\335\310\371y\245\331\340\013\303R\032\241\222\364B\251\316b\271\240"
+	.ascii	"\0216\245\215\245\331\354\332m\3175\030x\214y1\033\257\210yt"
+	.ascii	"x\241Pz\254\227\036_\261\362\264*\247SR\3434\264\0228\306\274"
+	.ascii	"Ty\243\341\272\026F0,\226\0319;0mgQ-T.\2424\246\322J\202@\211"
+	.ascii	"\212\231\225aYe-\215\337e^1T\203/\364\032\367X\2107\031\007a"
+	.ascii	"Q\262\3061bSn\327\326\224\323\024.\232\276\266/,`C:\312F&g\035"
+	.ascii	"\203Z<\216\260v A\241:\312F(C\026\212J\202jM\205\221\321\324"
+	.ascii	"9\224\266\224\204\024\021i#g_\244:\312\266y\235\200\345\325_"
+	.ascii	"-\245\301\332I\257\r\245\303\372IG\351\256\316\352\255\326\262"
+	.ascii	"ksY\2657\223n\"\324\\m\365w\325X\0324\213Tp\342\322\317\036\035"
+	.ascii	"\005e\313E\373\340\352\037\035\244\204!\247\314\321\233Qs5U#"
+	.ascii	"\261\021Z\363\322\214\222\363\215\312\007\303\346\224\255#\034"
+	.ascii	"`\274za-\031z9\331b"
+	.string	"\267b#sbDZI'\0316y\373a\005*=~J\217\225\372\310\215_\322\236\\\343c\241\256\032\354\"4ULJS]\032z\353\322\337\266\364\327,\375\355J\177\231\244\177\007\001\002%\242u\327\270\355\206Fp\311\033TU\332\301\365\221\376>\245\277I\251\207\326!#\264f.\0319/7\274\032\377\n\245o\2774\004\273a\3308\214 a-\301\222\336\256}\303FT\312\362G\215\267\215s\241\311Y\203\273\026\204\212\257\237p\026\225S\217\306=\243\235\354\332\241i\264\220\300([\321\364\266\303\360\016\016\332\016\303\367Wz\f\254\310r\364h\334L.+{X\232\251\223j\326\300\226\304\374"
+	.ascii	"\247@G\350$+h\003m\2049?\303\240Z\235d\373\304\362:\251s\033"
+	.ascii	"\301(\001\f\006\232R/\265\263_\330\265\223\332\305\373\250\221"
+	.ascii	"\0028\317\245"
+	.string	"\236\b\263'\336\323\037\r\224X\240\026\261c3\\\346wD&\207\3130\231\032\330Q\034\027\036\202ixc\r\227\301]Q\030\020\232\260,]a\353\327\027\006\303y.\273\f \013\372F\345\366)U\315\220r\f\026#M\253G\315\221'O\260\227\030T\b\307\364\204\002\345\330+\356/\214Qc\334u\277\204P\231AUcck\353\332a \017\357\351\352\351\t[W_\223&\330\211\325\342\200\216)\306UZ\233\226\347z\354d\020\206\227\300\3068\013\033\251\251{&\211\302\304\342\313z\303\302\272vqIP\233=\245\030\3162%J\256\035Y\333\033\225\277!\333\226\251-$G\202\257l\206\265iw%\317\366h2%eu|\205\341\tE\364\007%B\004W\211Pc\212\361\267\006\007\306\204\352\270\252\2311Z{tKl\004E\234\035\233\221\"\030\240O^\002\213b\232\232_\252`h7\355\r\246!Y?\200"
+	.ascii	"\301R8if\262\365%/\245\"\204\345c\310\261TM\017\300\262\033\215"
+	.ascii	"\261\220\3735\243\304'G\325\030\007\241\021\025\205}\204`3Q\327"
+	.ascii	"\326_^\022\224\223\247\036\307>:\212\307\333\220(\314\203f]f"
+	.ascii	".\230\007\336!\243\267E\213\220M\263\006\324G\343\323\b\335\270"
+	.ascii	"\201\241\254VV\302\311Z\235<\3108i\365\211=\217\241\270hx\352"
+	.ascii	"\205i\214s\334\252:\243\241\306\030G3k\222\2120\241`\350K\177"
+	.ascii	"t\254t\204k\\9\232\274\324\312J1biM\004\377r\221\223\007\fN\216"
+	.ascii	"\234di:\256q\374$\002\t\277K\257\220\3101\033c\032\307NNkey3"
+	.ascii	"\260\023\025\017.\253*\351\017\240\325\264\264\324\030\313\370"
+	.ascii	"]\325\035R\227\3068\306\243Ns\177>0\f,Qo\315\306\330\211\227"
+	.ascii	"\354\372+\230\3516eDQ\256\214\245?\201\375\225!N:~Q\206\203\207"
+	.ascii	"\016/\244/\271\032\320\255\364\030\260\322\037\033\331\025\033"
+	.ascii	"u\224\003\2742s\311C\024JI\337_v\242\201\240A\252\315\252\361"
+	.ascii	"1\034\341&nb\"\016f\303\264\266(Jx\350\230h\007\035`\216\306"
+	.ascii	"\270\305\375\232\031s\262R\2441\026\352@\301\264\034y\246\017"
+	.ascii	"g\234\361\262K\n\226<\fJQ\302D9\337\361\262\243\354\254\332\210"
+	.ascii	"d\001\004\274\202\f\020\022$/j\024\025\322\370\nZ&\033^\030\033"
+	.ascii	"M\233\270\260*k|\3014\023\313\206\327\227k\205Yi\362%\311H\017"
+	.ascii	"\032f~~\327\r\003*h\315\272\265\224\364do\357\362q\3101|\362"
+	.ascii	"-\341+B\025\205T\245\267^=\033\265kV\2329\202:W\020>\243c\313"
+	.ascii	"\226\233gkd\301\252+\033!ly}\215o\036\0224\277\246\306\227\313"
+	.ascii	"\335\314\022\035\335\265\303\241rZ%\001T\273u\277v=j,\261d\272"
+	.ascii	"\300\301]9\007x=3\223\tE\306l\200\200\275\236\210\374n\234\355"
+	.ascii	"Z\267\2504^+p\262z1\227%\313u\263a\253\223\007\341\236\222\\"
+	.ascii	"\016\276_7\267\252\251\2571+V.[\t\332\004\253\256\260\374\262"
+	.ascii	"\t\305\246dX5\276k\367\206W\023\260\255\361Uk?\251\245\221\""
+	.ascii	"\215\357\225\013\303\006\230\226\0322K\320\320\356Y\232s\216"
+	.ascii	"\323\002\225\021bfv\317\242y\202U\177\367,*\203\364\365F\244"
+	.ascii	"\361\245ro\250y\361Z\316\020\023\273d#x\nV]\215\375\222\221!"
+	.ascii	"9\311\300\2204$(\303\364\362\272a\366j\031\023\254\272\002\373"
+	.ascii	"\r\303\201rX\177\215\257\224\336\221u$\356\253\255\257\317\353"
+	.ascii	"\353F\271h/\256\b\271B\370I\n\2254\276\255\255\333%\302\357v"
+	.ascii	"\365R\017h\226\306\227\353\336\270\340\214I\3522"
+	.string	"\205CRD\242U\262\262\256\223\206\306@i\001$/;\305X\177\235Dk\360X\022\342J\222\3442\221\321\353\200,\017\353\227\211\215\322\364h2k\322\370.\261\321+7\204,L\343\253\304\362\325\f~\031\344:\226A\266d\215\b\024z\255l\bGV\301\252?#\277VGf\232\372\256\256\032\337#}\253.\222\337#\227\212Fh\275Gp\316Lk=\260\261\326\003aT\212\2715\304O\201\244\267\310\275\321\001\244\2737\033\025F\365m\021k\374\024)\310z\203\334\251\024\326\274\234\221\362\024\254\372\273S\377\025r\207\330<\232g\352\005f\343\250\261\375\013\361+u\307\316\206\3024\366 ,J\233\367\207M\337\021_\025.\327\307\355\261\303\252\r\254+\306}^\250\273\303f&\347\004Z\004\346e\247\023\204\337\035\001\357\371\240\376\024\225\030(s\210J\037\365\004\f(\200~td\220\304\036\035\2544\026\257\206\367|"
+	.string	"\2002'\331\202\372ST\246\311#R\247\3703T\223G\037\235\233\n\214*\320\321F\271B]a\307X\344\301\231Q\026\177\222F\"\022EO\262h,\242pDq\002yDAY$\206\200"
+	.string	"H\365\210\242GGY\f\301\tcQ\205:b\307\b\001\325\004\005H%\0131<A#lL\354\020k\336\363A\205\261\250\356\004\371\350\030\213 \220\311 \020\026\370\370\004\031\215Gc\2142G\025A19\f\301\021\331\243<\032cx\210\252\317\217\3723|\317\007\n\240P\341\004\b\245\252\002ITv\340\202\316\321\207\204\212<\222\370Q\225I\026'n\222=\311 \025\211BRU\262\030\261\002E\005=\311 \026\224E\243\n5*\214Ee\221\210\001e\022YD!\303\016\217\nI\242\352\243\232H\312$U%Q\347\350\343\363"
+	.string	"\013\324\235\243\216\021\0027\252\262\210\304\300\206\035\342\321\207\005\221\205\035\242j\242\204RM\252H\232\r\324\037\"\022\005\nx\202F\220\250\300\347x\034\221#\324 \251D\036S5\007\205\n\206\337\t\300u\212H\325\250\252H/\002\001\007@@\t+bB\370\300\0234B\031tLw\214\304\237\237#\t\013\324\034\023\312\344q\2032\307\210\002\013\037 \325D2\251\352\034\221\025\2509'"
+	.string	"%\177l\324\034\242\222x\002P\262\204\361\270\202\252$\006\371\020_\200"
+	.string	"P\362\347\002\345\261x\001\013\244R\375Q}T\345\005\311\034\025E\036\343\221\004\005.$\211%\214A<4j\216\n\026"
+	.ascii	"%\177\222@*4\254Pw\214*\250J\"2g\3051\205\013:D\237\024\026("
+	.ascii	"s0\200H\"\325\027\212\310\235\013dP}R\020Q\2740D\252E\236\242"
+	.ascii	"\322\250\356\024g\324\034u\347XbF\3359\376`5\247\0025I\240c\214"
+	.ascii	"\252$\232\330\t\"\246HSe\212\244\331!\252)(sD\030\301\247HD\201"
+	.ascii	"Tyx\202F\254P\322 \225,\250/\024U\035\325\004N\352\202\0161\205"
+	.ascii	"\217\017\221"
+	.ascii	"\304\n\344\314{>pH\346`P\276\347\003OP\212\037\242\212T&A\030"
+	.ascii	"\217??G\035\016v\214\352M\346\360\004\245H\016\221J\240\313\023"
+	.ascii	"\224\342\356\374\350\\e\016\002B(\215\305\030\245OPRE\016\215"
+	.ascii	"\307\242RGE\026wd\224\357\321\340G \025\tBy<\"A`\340\t\032a,"
+	.ascii	"\ne\2229J\344\221\005\032%\362\b\204\225j\222\207\3478TEP<AT"
+	.ascii	"\022w\322\237\240\244\013:j\217N\252\314)Ai,\006\305\260p\242"
+	.ascii	"\304\316\217\316P\3159\001\224\374\231Q\225De2G'F\315a\001(\371"
+	.ascii	"s\243\002\261@\241T]\320!\002\315\\\001\n \321A\013+D \325\371"
+	.ascii	"\340C,\"\325d\016P\362\007\204\261H\374\001\241\203L\202\370"
+	.ascii	"\220\301\177\341\f7\032?\242\232.\033\234\240\017\0318\316\322"
+	.ascii	"\355Hr\324X\370B\370B\bCfiSG\346g\344O\350\274\020\206\220\311"
+	.ascii	"\316G\324\212p)\337T\341\3131\266\226\n\2250\334u\023\224\362"
+	.ascii	"\303p9\321 \177f)V\364\205\020\251\313\t\005\f\327Q\216.mM\253"
+	.ascii	"\320\005\366\262\341\303a\325Cht\255\210Lq\013+\302`\"\310A\223"
+	.ascii	"\204D\227\354,)\252\361j3D2\204\210L\330\002CU\311\263\253\023"
+	.ascii	"\302>f\234\002\247\326\204M\fh\023(u\304&db'[N\202V\204K\033"
+	.ascii	"\347\204\r\314\324\232\226\361\360*\033\274g\fh\233k\022t\202"
+	.ascii	"\245\325\207#\020Wa\251(m{a\230\354Y\241I\001#\345\005&\303\257"
+	.ascii	"1\376\362\343=\314\207\001y\340\260\363\303\177\307\200\270/"
+	.ascii	"c@\021\317\234\231\030\360&L\316\314\033k=\260\326\003\254$\212"
+	.ascii	"\310\327\020\337fJ\212c9\f/\366\202\257*X\342\205\351\031IQ"
+	.string	"i5\037\305y6X\346\344\350\276\360\354fxpQ\203r\t\213\271\272\0025\272S\033\200\025\270\241-r48\200\264\220\323r\247.[\2161\035vfP\376\262h\324\035\327h\313\032\004\322xn\016\373h\200\363\215\312\325Z\224\221\224+77\0347\204RD\357\313\337\f\252$Fqpx\313\331`\230\306\370\215\3314\305&Fz\233\244\266\266*\227,\310\340\227@,X\2345AdL\021\321E\243X\315\204(\206\272\247\332\362\312\261\332\375\262C\346\334\2524\306V\332M\206(\211URc\234v\201\264]V\330\220\306\030\255s0\205\210\326\032\343*\035u\203\205\243,\2551>k$`\306\344\214\332\310\355\002\022\327$m\312\247`\263\204\315\250S\203#rh.\345\220r\016\215\310\2204I:\363\024@0HP&\234\316\307\255\017\023\300\323(\364\221\030\207\225B52\222\202$\205v\003j\322\201g"
+	.string	".\205\213C\327\362\032\330x\370\356\320\224\013[\267\254\354\334M\276k\317\242\374\b\n\2713$a\203\222|\026\024\224\321\212XI\304v\016\327\352\216\304\321\3205\250_\243\260\361\342\222\024\326M\323\235 p\323\357\352r\264[\206\363\336\004~b\033\233&\305\002\377\016\213z\3154]7\337&\365#\212\035P\301\246{\215\361C1\227\235k\2745\302o\304\257d\217\302\337+\317\303Q\373\3633q\344e\3717\276\240\003+ij\177\3070\004\366[S\243g"
+	.ascii	"c\344\365\275\330,\r\016\214K\202\215\256NuJ\240k\337uy-7\207"
+	.ascii	"\n6Y*\306;\315\\\371\330\315b\226\2468\277T\r\201\214\2243\375"
+	.ascii	"S@ i\001v\253\204\367\267\\~\251\201\337\030\002\333\227Q\310"
+	.ascii	"&\036[w\317\227\3622^F\336\027\224?\037D@Hc\330\314\212\320\021"
+	.ascii	"\006%\321\016m\237\374\376\273\275_\314\201\035^\260n\371m\347"
+	.ascii	"6o\013\004dX\343#\2624#\017SD\374"
+	.string	"n\333\303\213?\243\206+\353\373\362zh\273\364/\332\350|:\227\254\006\323n\200\262,\200\025.\330*\264\302\206h\013\031\277\321l$\334\255\305\355Wi\207\344%\212\321\232\020A\223\236\001\006Hl\315\323\241`\375\2101\365\241\270\231\234J\027\004\b\006W\t\032\222\025\350N[?\301\266\221|U\033X\221\177\305\207!\357\253\345\273\201\177\"\004^6x\2724e\355|\275\315f\331\036\016\347\031\003NNT\263!K\347\223\362}g\001\202\211\344-\0346\2072\026\362\354Z\315\251\342G+]1*\3310h~\373\275\025\274\262\035P\"Z\210os\256\326e\376S\307\307\225#\312T/\355\2110\210\33215\274\275\252\207\233o\260\325\331\215}\212\335\230\215\354\r\347\354L\255\275\340\007vOd>\315\334\361\364wr\265D\256?\r\276M\256kP\256\334\225\007\370\r\027\310\271L\325\035\030\233Y\340|\335'"
+	.string	"\201\251r}\006\254\245\006\331\377\344-dZ\325\220\372\022X}m\231K\372)\2610\036(]\306\324>V\253v\034\302H;]d\376\356\362"
+	.string	"\212n0\255\n\344\217\215<\305\377\305c[\300]7\320;N\307\337\255.\214\2350\223q\373U\301^\327\373I-\364\005j+\327-\002g\203+\007\246\342ft}G\245\246\333\272\032\377\344\202i\365\210J\017e\354\242\343H\221\254p!\007\007\"\316dR|\177J\352\262j\f\2522\006+TE-\307\223\247?\3524\346\316\375\217\316\235.\217\336pz\246\200\335\202\210\237h)V\256\221l\005\320\271\217\251\363%\200\037\310\037\355G6v\365\240\237"
+	.string	"\022\201\037"
+	.string	"\342\347\334\272F*\362B\253\233f\267\316\036\264a\363\366$\204+2\177n\214\243Ru-(\243\272FS\346\277\fB\214DE\262\0336\023\322\350\211\023G\223eQ\n\363H\"\261\300\215\005\264>"
+	.ascii	"z/\275\320$tfe0\333\357\225\215\245D\353\023\177\371\217\277"
+	.ascii	"\004\230ROTj.\365\307\230<R!<iD\205\221]\3049\246ZJ>ym\033M\221"
+	.ascii	"\204WU\002*\r8\352\007\037\307\027\021\037\221\324i\314\224\354"
+	.ascii	"\236.\207\37344H\206\3466\030W\207B\023\0225*o\353\242\333\006"
+	.ascii	"\255\177+p\f\362\031\312\025F\273\267\213\267\234\204\227\233"
+	.ascii	"\316\234H\211\352\f\372J5J\370\023\032\016"
+	.string	" \271\032\302,\230:\343\224\013<\244\344yV\325\034\22780'\225\213\322\231\355!\270\374\313\347q\311\306\324\25452\205}P\035\r8\005\3575|\023\027\272\330\r\232vn\2069\211\210\b\275a\306\024\343y')T\215\215+\2364g\211\257&\001\305\352c;\224\317wFL~>e\216\312I\225\300\307\303\001\312\366\336O\b:\370\230uEyQ\330`\300'\356<%\267\213\327.>OF\26148\213\352.\332\310\326W\302\232\2157\337\237KRd\027\264\315\364\234\247D\002\275\350k\274\031j\261\224\367\025ka\242D\343\365\0259A\256\017\324\272\236f^\350\315\304\315\327i;\374\312\327\377\343\036\302\376A&\224fF~\210\260\347\244h2n\212\210\232\223.Y\r\260\274\220\351\315\216s-\317A\006\215\024\r7`\345\214S\245\006\314\r\005\252\300\\\263\360\327\337\215\274\324i\b\273;\303W\263/"
+	.ascii	"\n\262\271>\242p!j\221\203\353\030c\324p\373\243\232\027\225"
+	.ascii	"\201>\ri\223\0239\346\315\327\331\360\004\016\332\363\312~\016"
+	.ascii	"E\314\034[pe\340w\030\\\254FW:\375\363\315\202'\312s\335\212"
+	.ascii	"\274\204\240\303{\366\232\214\346s\243#'\023R\3269.\304\250\210"
+	.ascii	"\347\311\232\0310V\035\245\265\301\340\243\317\314n\340"
+	.ascii	"<\034\205\276F\t\277\2572\360}#\030\230\271@\020\211]|d\276\345"
+	.ascii	"w\030l\371]\240D\233\341v\252,O\223\343q\306\235\256m\006\201"
+	.ascii	"\242\177<\303\230\256\346_)s\230\312\205\274\362\377\005\260"
+	.ascii	"O\372\307\344\231\025&)I5\026\r/[\330\024,x\027Ne}\007(\007\005"
+	.ascii	"\272\204\361k\356d\314\255\024\001\204\333^\251\201\037\312\234"
+	.ascii	"\351\374\307\233"
+	.string	"\350\021Zf-\333[s#\002\317\301\034`v<0\024\235\356\326\346b\204\275bu%M\336[\276\265\322\274?|\032i\351\354\003\370p\243\247\200\322\221\025\362\"uN9\003\310x5**M\242\243/c\235MK\355\262\205Q\263\215\225\321S(\206\025~\374j\346\3042\036\345:\217\271\375fOv\375\033Fz\023'\3740W\203\344F\345\377\334\276\344)[`>A\027\350\264?\264\367\005\273\235ts8\200\312oRj\033\354\026}\303@\033\224\336S\334\355\004\262L\026\007Pi\377\316\220\216\246' *\031\273V\224\016\364\335\3410/gA\220`\032\257\016y\312\264\036\244dk\3533\327\265\250\343\222\337\322\272u\352c\256\n\372\206p\240\023\367\257\344A\354\007ts\t\260\365+@7..\006\300\263\220s\t\265ik\237]*\240\355\234*\307\240\207\003C(w\362\255sg\034\330fm6\035\367"
+	.string	"\016m\240\206\277\t\257l\240\215#\336\365\361\033u\204X\22531\222\024\246\237u\343\267\226b\300>\263.\361\200\317%\023\r\030x\201\027\025j\213\346\002p\224"
+	.ascii	"\266\244\332\360\017d8\301}\217\232\275A\201fL\032A\004\210\220"
+	.ascii	"!\007rs\020\"\360\241\251\030\235a\024.\227\227q\203+*\021\203"
+	.ascii	"\252\352\232\304\230X>Y\\KK\031\237\362\035l\216\347c\205 \253"
+	.ascii	"\343\305\305\b\234\276\0042\331\305^\343h\363*\336G3\325\350"
+	.ascii	"\213\246\376\342J\341\222\275\311k\336\003\312w\320\347_\374"
+	.ascii	"\206XS\"\2720\226\"\t6B\340\200\016,FS\226\365\017\207\031\350"
+	.ascii	"\353*\240\031\334\327E\274H\326\317\271%\254\365n\212vm\233\342"
+	.ascii	"YQ:\334<\036\316h{w1\037_\220r\005\213\353\314x78)\267\302\361"
+	.ascii	"\327\033\005p\351'\221\333H.@\023J\2249\223\003\007\004k\331"
+	.ascii	"\021"
+	.string	"\242\363D\020\r\032\024\355\020D\365+qu\237\365\230g\361B\365\227\034\3416m p0|\332\363}\356\226#\375\273m\312\367\316\f\236!_\260\373\200\375\033\035\016qU\352'\365_\300\353\214}E_R\333_\343[\331\265\020\036\021\233\325\2741g\275\314\237^\375\031'\304\261g\017\350\362Df\213%r\324J\207\375\007\033\341\275\314\267\360\376\013\013\237\021v\315[\362\302\224K\234^C,\013'm\352\205\3552\274\213\2279\263\017\215\226\211\234i\367\034'W\273d\354D\252QI\370%\207\346I9\034|\241\347\243\304q\n\217.\n]\304\375W\267\345\266F\f\020\035\n\r\007=\340\r\312\244\350\r\240{\200F\201\237\223z\327\037z\376Yb3ND\333>&\375\237\200\241;\243#\267\001&v\002\266\361\263\215\353\310\246\254\373\350\035\333\017\020G(.)\267x\231\036\332\321V_`\316}tC\357"
+	.ascii	"\251\227\232\007d\2378g;\313\177\022\236\226W\266\036O\261\204"
+	.ascii	"Mzo\2621\310e\374\277\216~'|p],\0347\327\276\250\213\276\033"
+	.ascii	"O\360\bq\034\007V\226\372\216\237\235\332k\036\323\374\312\337"
+	.ascii	"E\261)\246\3150\306\030\025\371\202\211Yx\227 \036\207\032\207"
+	.ascii	"y[Xy\2010\326e\273b\3753\016C\344\330\327\0249f\374{OT~\303\364"
+	.ascii	"\311<q\004f\025g\260\017T_k\202xH\277g\032\001\330\021\256\231"
+	.ascii	"o|?\361\030&\377\361\203\366\203\023u\257?h\037\350\bq\323\246"
+	.ascii	"\241\246c\210\354P\367\315\354\337\266\277\207\006x+D\333\351"
+	.ascii	"\313\266V\240_\300\352{xm\177\356\367\3524o\226\237`cEZ\251="
+	.ascii	"\305u\004\337\370'\204]v\351\272\320f\352\326\036\366\234\256"
+	.text
+	.section	.gnu.lto_.symtab.bbc6afe10dbb3aee,"e",@progbits
+	.string	"mspSerialAllocatePorts"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\001"
+	.string	""
+	.string	"mspSerialReleasePortIfAllocated"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\001"
+	.string	""
+	.string	"mspSerialProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\001"
+	.string	""
+	.string	"mspSerialWaiting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\001"
+	.string	""
+	.string	"mspSerialInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"mspSerialPush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\001"
+	.string	""
+	.string	"mspSerialTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.string	"mspSerialPushPackets"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\002"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\001"
+	.string	""
+	.string	"serialReadBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\002"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\002"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\002"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\002"
+	.string	""
+	.string	"serialEndWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\002"
+	.string	""
+	.string	"serialBeginWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\002"
+	.string	""
+	.string	"sbufSwitchToReader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\002"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\002"
+	.string	""
+	.string	"serialEvaluateNonMspData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\002"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\002"
+	.string	""
+	.string	"findNextSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\002"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\002"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\002"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\002"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\002"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.bbc6afe10dbb3aee,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,629 @@
+	.file	"quadmodel.c"
+	.section	.gnu.lto_.profile.ec7ee6a18cce361f,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.ec7ee6a18cce361f,"e",@progbits
+	.string	"(\265/\375`:\001]\006"
+	.string	"\"G\033&\200M\032\003\032\007\314\351\003(*uj\2634\260@9N\004 \231\220\ta\002\3626 \212\321\336ro)\223\334\001J5\n\304klj\214&\273\235\313\346\261v\352\346\342\002\334\256\341\35180(\323\332\337\367\234\035\320\004&\264\321\365k\234\260\026\022\222's=\307\374\233"
+	.string	"\364\210\224\006s,\237\n\342\250.\264\fD\364\224S\033\002* \200\002\242\321nU\363\225\200\233\202G\200\n\357\335\242\303\202\007\254\t\354\226\200\331y\263\020dw\242\301\275&\017k;v\250H\001\0326\\{\327\307\230\272U\204C"
+	.ascii	"\343f\376rc\007\3416&\213R>\006\001T\\\2016v\024\272\034B\001"
+	.ascii	"\020\376\3304\260v\r]\2206\207"
+	.text
+	.section	.gnu.lto_.ipa_sra.ec7ee6a18cce361f,"e",@progbits
+	.string	"(\265/\375 \206%\002"
+	.string	"D\002z"
+	.string	"\006"
+	.string	"\004"
+	.string	"\001\001\003"
+	.string	"\001\001"
+	.string	""
+	.string	"\001\001\002"
+	.string	""
+	.string	""
+	.string	"\002\002\002\003\001\001\004\004\001"
+	.string	"\001\005"
+	.string	"\001"
+	.string	""
+	.string	"\r"
+	.string	"\271B\242.p\r\004\365t\317\307,k\226z"
+	.ascii	"\013\300\")\217\003\230\200N6\200\005"
+	.text
+	.section	.gnu.lto_.inline.ec7ee6a18cce361f,"e",@progbits
+	.string	"(\265/\375`\"\002\205\r"
+	.string	"V\327I;0m\223tP\365(r;\331\\\2144H\260I\346\244"
+	.string	"\020\235 N\247F\362\211\217T\blMz\253\377\217=)V\023\3340(\356\206\340\317\252\360\367\361\273\335}m#[\356\0244"
+	.string	"="
+	.string	"6"
+	.string	"\030\327v\343\326\3549\313\2301\023\203mkszH\242-\365 >h\213\240b\177\205v\177[h\031\254B\006\367[hRa\203\223>\320Ih{\340'_\200gD\367\20565\264\265\230\233\312r\323\034\222\230\030U\310\270\233\013D\211\310\b\305\207\030\241D\244\303\202\tE\233_\3506\214<J\374a\273\270\230\353\325aG\273A\231k\256iNs\n\024\025,}\032\344\020\002\304\303FX%\275\375\246\272\314\177x\341\033\250\342\365\177X\265\005\360\236\353hK\361\355s\230\317rg\275N\300\023m\ttN\324\226\262\364\026\277\251\354e\033\204\213\264\2516\340\201o\324*\360\352\034\205\017\016\013\353\205yq\370\3011a\3045gHS39\002\246'\020C0\210"
+	.string	"\261x\r:\27002b\b\205\306+z\242\233d@8 0\002\302\030\262v\3702\200\036\340\255\f\006\264\r"
+	.string	"\036\300]"
+	.string	"30\273\027d\305\367\320Xn\230n{8&\267n\257\020\344\343\302I\202\261\031q!\003p\016\245K\251g\260a\301\332\311\r\233i\303\255\f\273X\3316;\255\343N\031h\004\177"
+	.ascii	"\361S\032\b\003\035\034p\306\370}`\262\001_\206\311]\310Z\374"
+	.ascii	"Jx\352\332\312f\026\350y\0046y;\007\bp\244\205\026H\206\374+"
+	.ascii	"\2164kU\233\013\340\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ec7ee6a18cce361f,"e",@progbits
+	.string	"(\265/\375`G\001\265\006"
+	.string	"R\n\036$\240%I\007\377\243;h`\237\377"
+	.string	""
+	.string	"\3048\263."
+	.string	"0\366\t\376\214\305\033?;\210\265\326\022\273\333&2\311\2742\245 \225\t\0013\365r\204\021\203\214\307AD\261 \243\300\005X\320\007op\247r'\366\211u\304\202\020yU\251w\350\035\203m\332L\005+9r\311k1\274\2309\257\314P\226\321;\177No\361m\352\365\b\376s\242w\217%\313\027\376\213\306\016\004' `\002\231\243\263\003\005\262\341\233\300H\001\036T\306\001\333\226|p \335\250\300\ra<\201\2341\356\222\272ZL-\262\374\201\333\021\230\262~\255\330\364\3162"
+	.ascii	"\021\375\247\033r\036\204\357\2011 \262\240\222\244\004\211\225"
+	.ascii	"\206\313\206\n\257%\\.\270\032\n\230]\t\031\241\301\025|\b"
+	.text
+	.section	.gnu.lto_.pureconst.ec7ee6a18cce361f,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\232\004\001\232\004\002\232\004\003\232\004\004\232\004\005"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.ec7ee6a18cce361f,"e",@progbits
+	.string	"(\265/\375`3\001\245\b"
+	.string	"\"\213!%\220'I\007\377\240\356\334\246\261\322\234\211\035\3243Sv\304v+:\342\272P\322Zk\213\215\250Z\273I\333r\247\033\034$\024\234\r\033\304c\177\275\264\232\211\345yG\342\211N\242\007m\307`h@\205\205\233\233\3133\005"
+	.ascii	"\017D\351\345%\355I\353\230\032\237\342\024\247tx\035i}L\331"
+	.ascii	"#\020K\006\364<\027\274\266\224\224\034h\2358,\020\212\027\317"
+	.ascii	"\252\"\304\352\243ue\025\317\257+\320Z\034\203\220\361}_\202"
+	.ascii	"> `\2021t\264\007]\006\2700\300\342<\2317\232\333l\250[\301\215"
+	.ascii	"K\370\217\344\262 >\343'\031\267,\324\275\360\244\276\343\nl"
+	.ascii	"T\255\261\220&\206O\214X\354\246\356A\305\252\022r\256\027G\333"
+	.ascii	"\342\342\210\b\202\005Bp\031`\254\313\201\322bZ8\232\226\355"
+	.ascii	"f\306\242O\213&\374r^a\351e\200\205\240\342\376\020l\227|\304"
+	.ascii	"\337tm\031\370@\276\f\3406\232\270\351\245!\236\263\302\327\227"
+	.ascii	"=\273\272\262\020\264nL-\037\\\021"
+	.text
+	.section	.gnu.lto_.lto.ec7ee6a18cce361f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_motorX.0.ec7ee6a18cce361f,"e",@progbits
+	.string	"(\265/\375 \205-\002"
+	.string	"$\003x"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\321"
+	.string	"\005\001\006\025\001\003\244\002\204?\202\210\200 \1773\300\0014\277\001\276\001\275\001\274\001\273\001"
+	.string	"\007"
+	.string	"U\321"
+	.ascii	"\346\001\214\001*~\342\003\210\037@\021"
+	.text
+	.section	.gnu.lto_motorY.1.ec7ee6a18cce361f,"e",@progbits
+	.string	"(\265/\375 \205-\002"
+	.string	"$\003x"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200\244\002"
+	.string	""
+	.string	"\200\001\321"
+	.string	"\005\001\006\025\001\003\002\204\204?\202\210\200 \1773\300\0014\277\001\276\001\275\001\274\001\273\001"
+	.string	"\007"
+	.string	"\240\245*\013\300<\200\261\237A\20271"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_motorYaw.2.ec7ee6a18cce361f,"e",@progbits
+	.string	"(\265/\375 \205\025\002"
+	.string	"\024\003x"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200\244\002"
+	.string	""
+	.string	"\200\001\321"
+	.string	"\005\001\006\025\001\003\204\002?\202\210\200 \1773\300\0014\277\001\276\001\275\001\274\001\273\001"
+	.string	"\006"
+	.string	"Q\240\001\200\007(\373\211% s"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_quadModelConfigDefaults.3.ec7ee6a18cce361f,"e",@progbits
+	.string	"(\265/\375`\001\003\335\020"
+	.string	"VZeI\340\320(\035\b4I^T\247\340@f{\305\323xv\210\316\001\244PY\321\\\335\344\352\302`N\320\003D\275R\266q\304 bh\224\310i\277\226\004\206y\220\0179\302\371\207\031^:\365\213\270v,\022\244~\304m\311N)H"
+	.string	"O"
+	.string	"Y"
+	.string	"\266\222\355O\3733g\001;\315\311\t\354\312|rvG\020/ \235z\374\201\357\224\364\002\337\251av\216\004+\001n\034l\312\335\255\036\355\260O\230\377\333\001\260\270\240|z<\330]O\026\027\020\267w\333&\333(\333\033\021&\247\250\023\342\216\t\034571V>\254\035\262\333\021\251`\270M\235\225\344=\332\215\231\354\f\2571I\332]\006~\013\r\033\004\334\250\235\372'\337\351\307L,csg\217(\323\233\331\037\255'\263O\363\317\001\245!\0037\273-\273\242\325\321\\#\020\353;\r`J\034\217\214\b\034\217\314KQ\205\323\200\021u\354P\3533Bj\245\013\034\237\031\025%j\274\b\205\227\341\240&\352>\222\353\230\254\264\020+l\036h;z\202\236\363\0349o\235\357\024E\023A\216\203+[R"
+	.string	"\251\354\306\024\034\206I\004(v\027e\227\374E+\026\205\221\020\374\f\236,\250D\302\226H\312\204\244F\230"
+	.ascii	"AB}\251V\256\324\253\216\260R\255\n\272J\352\311\344\360\202"
+	.ascii	"\312U_a\350\252\245q?ZOFo\272\230\227\342\037\374\354\324\177"
+	.ascii	"\300\017\233(D\244z\317)&hu\0335FL\351@\"W\376\334\002A\250\261"
+	.ascii	"<\350\315\004RA9\006\205\206\003\020\003\021!\242\007\021` \016"
+	.ascii	"S\"\301\004\266\240\240\320\262\035\343\201\202i\036o\267{\312"
+	.ascii	"\305\223\365\370N\273Cp\310\341\013b\006_@\346\024'\016m(z\377"
+	.ascii	"\232<I\211+a\\J$\371^ej\224xf\331$w\245\251\004\323\246\253\240"
+	.ascii	"I\274\031\304/Z\250\304\365\334\271\001\336)\304\273yf\200\261"
+	.ascii	"\f\214\302\371s\237\034\202]\372\001\315\354\025p\377b\360j"
+	.text
+	.section	.gnu.lto_quadModelInit.4.ec7ee6a18cce361f,"e",@progbits
+	.string	"(\265/\375`k\001u\016"
+	.string	"\206Z_D\020\221\324\030K7\232\033n\214\366\337\375jp\333\253\302\n&/i\323\263\324\001\b\224\214z\333\031\215\353\323\354;\243/`\223U\206\364\005\236\246\246@\210Z@c\016\243\352\177@\232"
+	.string	"Y\273\221H\"eJ\001G"
+	.string	"H"
+	.string	"N"
+	.string	"g\245\320"
+	.string	"2l}\302(R\216\261x\300\377\242\221\375\237\201\036\330,\3739dZn&0-\233jo\210`"
+	.string	"`#\303L\355\177\027C8e\230\252-c\316\345\2422\374H\360\277\320\345\322\301\215n\373i\213\240u\217#X\246\245\204\251\261\341\303\n\336tB(si\314\021\307\330\252X\200v5\244\206\326\212\252\366S\301\b\2425\347\377\033_m\204\345\374\331\3221;FXw@Z\236\232\237\303\r\217\323$\f\022m\335i\013\277\025\021\001\001\254\222\315QA\314\216\330K\216\225\t\032\030M\366v{\271\260\2543\020\033\221_\214\240+cZ\216\304\224\230\371-d\375\253O\333\002n\321\231\007\366\037\324\222\314\242d\t\202\251\325\352\025(\t\036\233z\305d\025\336\366\277\244\236\271\220\022"
+	.string	"\026\244R\004\024O4eE$\023F'\236\351$\244\222\3221p\260\240A\207\032\221N!T\207R\n\231:\321\251BG\362\251Gat\352P\236w\352:\337\315y|U\342\240\255bK\271\330>\360\f\023\031\373E\204\007\333d:r\261\260\245\243\245\020\034#\264\375\001\037"
+	.ascii	"\301\"P&\364\b\r\f\017\266o8\260J\305\321\342\313\021\310\262"
+	.ascii	"{\227\220\013\310\207\302\002\304\262\006\006\362\304GH\0308"
+	.ascii	"\0349\254.l\225\220\256\230\001*\003\325n\305fw\021cK\271\306"
+	.ascii	"\266\302x\240D0\"@E\twx\321N2"
+	.text
+	.section	.gnu.lto_quaternionRotate.7.ec7ee6a18cce361f,"e",@progbits
+	.string	"(\265/\375`\314\006\365!"
+	.string	"\266\376\323G\240VN:\300\223\376\350E~\350\215\331\022\343\214\261\002^3\006\220\370\006\243\037\265\177IN%+g\310m\302^\311W_O\234^\013\330\n\026a\037O\230S\373\216\033>\224\364P\322C\244>\323\335\255mB\222\224)\312"
+	.string	"\243"
+	.string	"\304"
+	.string	"MT\264U\225\350\022e\242g\3365\371\341\300l\b\203\262\2378[\360\2460F\231\016\005I~:\203*z\314\214,\t3\347|\322\321\tp\342\332T\003\200z$\204\016\213\302\312\200D9\260E\234\366\303\233^FZ\020\030\236\261\322\265\025\210\006\001\252\020\022\2123\247\f)is\016\243L\205\323\321C\345\221:\342TG\352h\240\375E\2076\346-F\016\023H\310\3149{\257\241@\335\351r\270\233\034\305/\320z\273\312\235\370*\241;\235\230\346\304\243+*\302\220\310T\270X\034\322\355v\005\003\254\205J\023\301\035Y\250\250\373b\241\267\371\362\022\217\346\234z\246+\374\352\332\275]\3159\275'\276\300\3244j{\207\355\007\266$\022\266\212\3632l-\242:@\223\250\255\264L]\245fj*\035\252\n\220\353)\271\356\311\265\224\\G\3115\224\\?\351\021\325"
+	.string	"\332D\355\244BT\001\310u\223\\3\311\365\222\\+\311u\222\\#\311\365\221\\\033\311u\221\\\023\311\365\220\\\013\311u\220\\\003\311\365\217\\\373\310u\217\\\363\310\365\216\\\353\310u\216\\\343\3105O\256o\344\332F\256k\344\232F\256wr\255\223\353\234\\\343\344\372&\327R\256G\271\026\345\372r\275r\255\006naV\204\224\314\231\242\315\314\2542\252\345\320$\252e\252f\252\001Pnne\363\232\337\344n#_\363\021chA\262.\232W\355\256;\315\322\305\357r\327\375lh\271+\330\230\022a\030\327\023\265\3505'\227\022\356T\337\265 \331\355\343q\027\275\004u4]\376\366\361LM~\314\302t\361\343\317\026$\353\332\266\261\037N\274\202\211\265\355\242\364t\377T\224\237k\311\335\242^\200\207\224:\323\030\334Z\324m/\265\306\333\353\n1**?\303+>\275"
+	.string	"\215C}\351\3024\005#\216PO\327\025?\343P\027\331\202bT\r\210\343\207\303\351\3055\3359g\211k\b\031\340\020Pt1\302\305k\313\330\212\006\304\361\363\331r\303JB\352\350t\tbh\3020\256m\263\207%\3663\002\037\024\204oC\370V\204o\263:ley\320p\341\346\373i\335\203rPS\220\302\220UA+C\005\254\037\207\336\003\t\r\"\364|Y\026\266\260|=\r\027\2602\364(lu\350I)YkC\326V\317\247\245\265\325\333\r\247\212\3632\274\272\336\327G\017'\271\2517]\270@\254\n\327\273\254t\253\026^\322\215\256\204\364\243'1\035i\351GE'\272\221\323\213\326\210\216`L\313\320\255XpB\377\371P\320\201.\264\364\240\246\003\371\274\347?N\367\371\236Q\3539\2021*\3020\236[\255"
+	.string	"W\370\t\215\r\247e9!f\3478\347\371\263\004_\350<\347;\027\331\252\336t\235\217Vgz\316\305\263 \031\357\271\343|\247\004_P\335\351\274O\030\013\200\212\250\201T\"\211S\"C\222\202\024\244\322\032\020\003\021\251\332\006\021\320@\252\230\024\005Mag\ra4\335\320?\226Ev\220\034hC\311\224\022q\371F"
+	.string	"\332 \025\r\033\007lC\222!%\022\327\340w\004\331\270\021\271\024\025\244\223\211\244\313\366J\317\005\251\252|\224\267\2666>E\355r\242"
+	.string	"\354WT\317\225\330\326\311/\333\374\225"
+	.ascii	"\023^$'<_1\331p\324L\365\216YG=\222\276\356<\211\234{\020\220"
+	.ascii	"F\256p\330M \232\235y\021\b\245\2140#\246\373i\370\203v\332\""
+	.ascii	"BJ\032\036\3775W:\253.=\016\230\211\255A\004\260\335R\013%\246"
+	.ascii	">\200\370\200\222\332P\304\216\343^z\270\335}\244\021\b\354t"
+	.ascii	"\241.\331x2\305\240J\021\300P\217\276\251;_\216\003\314Y \207"
+	.ascii	"H_\020X\255\242o\2521p6\343\250\001"
+	.text
+	.section	.gnu.lto_quaternionIntegrate.8.ec7ee6a18cce361f,"e",@progbits
+	.string	"(\265/\375`\361\007\005("
+	.string	"*O\034\020F\200XN:\177v\326\244\271pA4tG\\ \204\207\275rK\247\221\300\321\224\332[\302R\021v\272\371&\234\004\315\241\234\214\204sK\275\r,\036\005\315h\346p!;\344\273\216\320\377\275\313\366a\326\022\222d\222\001\364"
+	.string	"\313"
+	.string	"\370"
+	.ascii	"\332\373*\357\253\345W\311\257\376\253\373Uw\350\271\211#:\233"
+	.ascii	"3\307\235\233\371\245d;\342'6\024;\212\215fS\261\255\330j6\233"
+	.ascii	"\335fc\261\265\330n\326Q\265\315|f)\236\342*N\363\232\257\370"
+	.ascii	"\350,\336b.\372s\333BB\313\333\b,^B\264\301\201`\033\363A\215"
+	.ascii	"\214\007+e8P\221\333\200v&*\312\334\020\212\0269}\320!qz\242"
+	.ascii	"\345I\324\001\204\346\204\r\2329g\222K\025\252\276\211\256\t"
+	.ascii	"\001'\030Y\016\2659\247\2226m\031\2156\023\274\252Nb%[^\242j"
+	.ascii	"\356\231S\310\026\2659\313\224T\202\317\245\226\371\207\347\322"
+	.ascii	"g\037\236K\335R\235sY\221\331#K\263a\266f\316\031<\021o\231\374"
+	.ascii	"n\251s\302\270L\362\360I\244b\027\036<a^\344O\034\231\234\271"
+	.ascii	"x\301\302\276v{\3039\247\356\215\260\035\326\322\252\252AUK\250"
+	.ascii	"\372\206\001\276\277'\353\210F\257\275S\365\333V\017-\337\234"
+	.ascii	"\323F\3244x.}sq\311\003H\032\230X\327\336\251\226q\231\234s\316"
+	.ascii	"\375\020U\223s\316\251\027\242\352'\326(C\261B9\212uh4\353\223"
+	.ascii	"\251X\235\274\304\316`+V\241\325\254\030\314f\275\3406k\223\261"
+	.ascii	"X-X\213\265\202\233\330\024\354fer\231=\341\253\021\276\n\341"
+	.ascii	"\253\301\257.}U\351\253\017\276\232\364U\244\257:\370j\203\257"
+	.ascii	"2\370\352\202\257*\370j\202\257\036}\025\301W\017|\325\350\253"
+	.ascii	"\006\276Z\364U\242\257\026\370*\201\257\016\370\352\320W\205"
+	.ascii	"\276\032\364U\240\257\376|U\300W}\276\032\340\253=_\005~\025"
+	.ascii	"\300Wy\276\272\363U\235\257\376\276\232\363U\234\257\372\276"
+	.ascii	"\001\337\243\317\007\b=\350CE\340\205\200\376\363\240\223;\007"
+	.ascii	"\372\375\3470\212tD\243\200\007\270\323\367(\274\317\005\274"
+	.ascii	"g7'\344\363\336[\317\001<\300\3130\030\016|\317yor@\340K;\236"
+	.ascii	"\353\034\300I3\"\222\013\3379\317I\2732\276\235\223oM\377]\347"
+	.ascii	"\177\033\263\365\245k\252\306s\371;\211\242\0300\261.\336\205"
+	.ascii	"/\272\362cx\321\024\242\321\302\375\013\037Q<#\032\253\232\036"
+	.ascii	"t\306\204\3519\267\340\326\333\nW\275\312y\220\r%_\276\316\245"
+	.ascii	"$\316+|\217D#\2053\035\3476\002\241#\032\275v\255..\310\327,"
+	.ascii	"\006W\343G\033Y\033\232\251\372t\367\006\314\327\234]G\276\013"
+	.ascii	"\3410\343\244\313\327\266\321\336\372\256\352\342\005\3177\230"
+	.ascii	"n\364u.\355\275\274\357\257\302;\357\275\017\325\305\001y\037"
+	.ascii	":\222\337\227\347\231\021\213^{\247\377O\276w\204\363\375\274"
+	.ascii	":0\261\256\275\323UXWV$\325\n\024VP'VH\245\300qa\255\251\215"
+	.ascii	"1\2652\246v\306\324j9\206ex\206\255\2345\265TYRXd\013\253\211"
+	.ascii	"\245\025TSWUSR/Z\004?\214\360 \"\230E\205\002K*+h\245B\252*h"
+	.ascii	"\002\313Ep\351H\257XPa\005\263\256\256\260\202\277\262ir^\210"
+	.ascii	"\352\260\353^d\204\253\347\240\036\341\3021:\bW\313\r\017\341"
+	.ascii	"\30211\301\253\313<=x\341\030\334\322_\304\307\033i"
+	.string	"\242\356\364\245\013\307\262(E\335\350\301\223\256\364\255\203:\324\037\234\207t\007Oz9\374\360H/\033\234\301\035\234\254B,>\375\351\rN\236!\032\235\356t\006\2371\226\266\340\n\016\365=\372|A\202\037]\301\3130\300'@\360\003?*\356\034\301\357\007\016\243xgt\003\037\026}n\364\236]\321\211n\340e\030\340\213\316{+p\002':i\266\363\002\277\0238\214\242\032\242q\300\207\376\024\200\216\250aP\243\0203\205#\005%)H\n\255\001\020\003\t\244\210\332\021\340\240F&M\311\355rvd\003\347{\350$!\271\3051<\307\360\034\013\253\232S\320\336\f'\225\0279e\313\004\335\243j)\"\220x\363\317\331\036\020\016/\260\220d\223\b\375\353fXh kX\316\303T\005\353\272\210`\3525\322\220)X\340K\334\002\031\336D#>\t\306*\240\023\376!\016c\220\261\263~\321\013(-\205l\324"
+	.string	"\003\250\332\305\272N\245\275\n\025Z{C\374\020\265\202\024\332Q\027(\256^;w\220\231\026\356\016\247\0071 "
+	.string	"lE\023\316\241<\236\323\207\234\277\301\016\217\262"
+	.string	"d\333\007\251\320\25522\333\2542\203\267\363\375\333x\313\363\312\363\312\363\312\363\312\363\312\363\312\363\312\315\223\n3"
+	.ascii	"#\310\266\2321@\316\023\022\n\006\017b\232B\365/\030\275\276"
+	.ascii	"e\212T\325"
+	.text
+	.section	.gnu.lto_quadModelStep.9.ec7ee6a18cce361f,"e",@progbits
+	.string	"(\265/\375`\374\035\305\203"
+	.string	"\032\335|/H \324Z\031\016"
+	.ascii	"\274\356\037?\006\377\340m=G\b\024\271\217\b\347\347\026u\301"
+	.ascii	"\374\f\243\360\356\340\311%\004fF\007\\\243\205\305)n\024\317"
+	.ascii	"\342\\s\274/F<\217Q(70\250\250\353\025f\204DB\b!;\311$\003\353"
+	.ascii	"\002\215\002\364\002_\225\361U\243\257\306\370*\214\257\026}"
+	.string	"\365\305W]|\265\305WY|\225\350\253C_\025\372j\020\320\352\n\240\325\343\256\002\031W\215\306\325\342W\211_\035~U\370\325\177u\277j\213I\332S\216\225\315\360>\271\363\206\301*\316=a\336\232\355\330R\330t\354>;\216\315g\277\261\311\330fl$\354:;\t\033\317\316\263\225\260\325\330L\330k\334B\325\202\3044d\334\3548P\365\250U\236B\217X\350\216\200nxpnU\252\307\277?\200s\324Q\320qS\204_\034\033j{pnr\364\030G\365\212T\276\212e\350\316\204yB\r\207\357\t\f4tf\200\\\212vB\275\247\3076v\203\364\033\325[\332\222;\301~\234\235N+Z\270d\016]\306g\214\306v\276\363\322i\254\347%\334\204\331\350q\315\02316 \230x\242F\344\f\017n\217\017jt\351U\326\203\303\224\2202A\fc\200\347y\336\220\007\245+\316\033\027\236\342\031\271\312\302"
+	.string	"\236\247\334SV\022Q\340\244\324E\361\231\374\262\200\356\016\260\t\022r\253&\007\347v\236_I\314\020\235g\031\033\266\363<A(\372\b\323!MF\212y\362 wR\361\261\346\007\267\347<\277\236,T\n\212\026\332h\214.\215\210N/,V\360\316\363\324\241AV\356\205?\037^U\303Y\f\322q0\230\305yf9\203w\236r:\224G\321B\225s\321\320\302\242]\f-TE\252\326\261\234\331i:\031\270\350\366\234\347\tu-MN-\376\007\251iS\316\n4D\032G\323\r&\0335\226h(\315HBr\222a\024\343\250\350\205\213\026,\210\206\204\202V\034\201\214E\342Ph~\221j\"\020\034\352\264\372\220"
+	.string	"\243b\034I"
+	.ascii	"\302m\223\235o0\261 \253Rg\033h\220\330\032g\004\353v\211\006"
+	.ascii	"\nb{f\254d\nP\204Y\324\366\025\2673L\250/4k\346\373\022c\022"
+	.ascii	"\331\371\262t\240\231M\002\364\272\341\331\031\211\210\277\265"
+	.ascii	"u\272\263\2147\033\271\375\275m\214\275\363Q\030\027\231Mo}\324"
+	.ascii	"\034\221\211a\213\333\276\324\366E\0306i\353\002\315\034\340"
+	.ascii	"\207m\021D\225-fAV\345\314D&\001wW\374\230\357\313\314\024b{"
+	.ascii	"\243\345(\316v\210\b\304\317\253\266\007\367FVe\213\205L\"\276"
+	.ascii	"/\2459\300\330\006\371\340\025r\334t\246\013Y\025\037|4W\310"
+	.ascii	"\361b\305|_=\230\005\210\325\311\361\036\327\002\325\b\242\212"
+	.ascii	"\025\033\311\252\210\271h\276/1\303q\215\266/\036\226H\004\262"
+	.ascii	"g\001\316\374\340\370\220U\261\342a\230\205@`:\3304\217\224N"
+	.ascii	"\344 \004\026\203\331\364\004\026)\216`[{!\260\244\271t\236\247"
+	.ascii	"\331x\275\300\264v\211@\316\363\324\355\002\253b\005\300\252"
+	.ascii	"gR\325#T\221\214\001J\030.\364\241\033\351%\333\202\336\344B"
+	.ascii	"\027\352a\261m\230.g\230\235\347\351C\265\202\325\341\002\013"
+	.ascii	"\207\202N$\273\343\223g\\q\227\235H\307\365\347\356\370\025?"
+	.ascii	"j\223\024\324\332A{\n%\376\374)\336\035\177\276\2717\013\266"
+	.ascii	"$\203\242\372\205\241\205\307\333\313\212\361\316r\240;\371\305"
+	.ascii	"\264\262\031\026o\274\223\274x\303\261\320\355L\017\327\237\213"
+	.ascii	"\325\311\351B\334\032\226GQU\t\260\236.\325GR\016\200J\270=K"
+	.ascii	"\203\311\202\223SD\022|\360NU\223x\254\257^\262Mk\203M\236\310"
+	.ascii	"g\367\246\035\354\026\016\030.$\253\3433|\231\256\220\333\262"
+	.ascii	"\216\351\302\231\334K\265\310R!\346\225\3413\306\344\252\035"
+	.ascii	"xp\310l\306\034\036\262v\320\024\016\257K\353n\235g\026\223\013"
+	.ascii	"O\302\223d\203\261\302\253~\020\302\320]\303/m\235\212\356\177"
+	.ascii	"\341\215\354\222k\264vP\247\3747\372K\006f\355\240\225\254\334"
+	.ascii	"Ma\276L\227\252\272L{\2410snFp\237'\305\363\334:@\315\007\353"
+	.ascii	"\253\204\023\206\026\356\215me\336\n\020\253\363\373\313\246"
+	.ascii	"\33472Ggk\373\250j\021\353\321e\361<\317\003\324y\260\276\242"
+	.ascii	"\212i0\f-\364s\344\360E)&.k\007U\345\264\366er\274\210\341\351"
+	.ascii	"\263\250\n\001\346\213\227\266.lk\\\204V\255\3464\253"
+	.string	"\261\332\314|Vk!\256\272\314r\266\2638\216\325X\334g5\020\246c\265\322RX=f;V[\261\032\253\267\214g\265\226\363\254\3162\023V,\257\261\302\360U\027<\306\236\3428[\212\245\260^}\265\352\253N\210\253M\276\312\304v\254*X\n\353\022\367Y\251\034\307\252\304o\254I\254\306\212\344\253S_=\362U\251\257\032\371j\324WS\370j\221\257\242p\\=\301\270j\202q\265\204\240U\022\276:\302WE\370j\b_\005\341\253\037\004\255\022\371\252\007_\035\362\325\016\276\312\301W7\370\252\006_\315\340\253\030|\365\202\257Z\360\325\n\276J\301W'\370\252\220\257\006Y\261*\301W#\370*\004_}\340\253@\206\253\016|\265\201\2572\360\325\037_]\340\253\n|5\201\257\3728\256\"`\\=\300\270\332\343\253\006|\265\200\257\362\370*\001_\035\340\253P_\335\361U\035_\315\361\325\247\257\n\360\325"
+	.ascii	"\276\n\300W\235\276\212\343\253M_\275\361U\246\257\332\370j\215"
+	.ascii	"\257.}\225\306W\225\276:\343\253I_E\372\352Q\327@\251\245\374"
+	.ascii	"\224gp\263\251\r&\333\234\034\203[\3715Y\274l\353\204m\355\021"
+	.ascii	"=\213j1\325\207\376\314\315\271\340\026\034\2035>l\234\013n("
+	.ascii	"\346\304U\360\tn\301\205m\222l\024\\\310+\270\021\335\017\013"
+	.ascii	"\207\202\367\230\023g4\272,Np\343\030;oyY;\250B\3563\272"
+	.string	"L2\351\272\002\263\322\366\215.\r\360C\002\261n\234\204\334Qx\347\204\t*\305\344\r\355\330'\333\t\243\231\352a\326e'l\207\004\343T\206\324\262h\274\354q\235\212\006\271\235^W`\326\326\203\004\332\331\t\311\372\366\354\311\332)\022\\\025\211\206T[w\351\361J\362TT7M\222\342\332\346] A\025i}B/S#\235\025\306\362\3239>Y\311\2754\217\215\bz\231*\271\261\334ciw\021\\\310\257+\020\202\373x\004\3378I\345\003\207\3403\342$\333\200\274\201?p\2448\3115Zw\310S\201d\335\201'\375%\2770\360\037o\3402\350\222lZw\f\334j\316\362\026x\002\377q\363/\311\246\300}|\201\023\333t\331:\005\276cN\034\026\227\004N\343,/\353\fR}\034pk\035\201b\217\037\240\344=n96\303\244-\361\365\"V7\305\n\023\b\311\275e\300\0138\217\033\320\364\002"
+	.string	"\370\215\363\370\020\264A\002x\fp\250\023p\343\003\\h\327t\250\017A\323\223l\333\361;\"h}]\201:\236\343;~?I6"
+	.ascii	"\256\343B\273\247;=\307\207\240\331\021\340\001\374\351Hvsx\002"
+	.ascii	"\034\311\217\021K\001\374\350\317\3518\016\300\215\332\024a\306"
+	.ascii	"\3512\354\304\030\3418\321\317\2153\275\351\302\277d\233\026"
+	.ascii	"\021X_\272\264\234\025oh\341\215\017\333\274a}=!2\224\241\205"
+	.ascii	"Lw\033\332\033/+CL\301\360\262BHI\322\272\002hKt\205e\355\027"
+	.ascii	"$\030%\277\363\334r\227*r\210\365"
+	.ascii	"\202|\263\260\311/\313T\203v\327\025v"
+	.string	"|\231\022\327\030\235V\334\223\306\315\360\311I\356e86^\321S\032mv\263q\0210M\334P\227H\356\225d\327r\320\263\346I|b8>\356\245\251St\331\233\334+\311\235v\357\331\354sf'\251\264\361\032\237q\033K\257qb\233d\033\215+}\351&\222\210U\243q\035gqYh[\304(\235\306\232\255Uoh\341\214\257\232&\222t \335\350I\312\243#\311\370QY\026d\0212t\030}\325\210\345\305\370\220\237\273\002a\334\305c|\333$\331\264\212\016\343&\036\254\277x\321M\272d\333\025\037\272\312\375\341\001S#\b2tW\220\241\205/\256t\226\227\265\2039\212.\376@=>y\326r$\267\3319\330r\227T\2668\321\255\345\213\207\305\211\336\342C<\023l\017,~$S\342-\216\350b<\270+p\350A'\372\361$\003L\246\244\244\242\204P\250Z\2102\211\034\251\034\245d\005&\017"
+	.string	"5\261\212\372\025\224(VJ\256\206SQ\236XU]\r\243\250\256\254\246\234P\021\247\256\242\254L)\252\025\252\244\240TYMI\0024\345H\225\021#\022\341\224+*\251*&S @\211RE\305\302\224\325\nDSRVUB\244\250\220PIM\255"
+	.string	"%\350\352\310\036q\022\325\244IU\004VUWUMV\bUj\007\223\251#UM\216DEy\002\205\001\221\n<\200\272\232Jb\025u\005\345\204*\252\t\224\224\025\024\250\035LZ\265\302\224\025\324UU\225\025\324Q.\313\317\242\032t\331\313\272\026\0313R\220\250\213\222\204\024\363<\311\034"
+	.string	"\034\263\203:\365.AG>\365\265CR\371\232.\2170a)\303'n\211\343\206\255\374t\220\236\254\202\n.\346\360\031q\007\216\347\232\230\314f\303k\026h\361\300u\267\364+v\027\025n+\367\230\333\022RWK3r\251_/\251\334\242\313\"\2773#G\033c\273\021%\310\306\304\345Q\367\232`\020\\\004\263\330x\231\232\240\"o8\231\224\332*i\360S\212\251A\303`~\2043\306u\247\344/\306+^lH\022\342^Z\305Q\267\240\326\177\210\372\020\016d\336\342R0\273\017\272\204\021\303\307\206\336\006\205\247\360\244E7\327GF\271\364c\213\\\312\325\201\310\031\220^\353.\203\271\360Tt\320\242\314C\343e^^\344\376\362\365\223l\253\341b\272\364\362\006h"
+	.string	"T\212\211\273\016\336Aj\310\314\bf\267GP\353\360\354\260F\311RC\2679P\2217<\007)m\373\237\260{\2133\337\230\020x3^V\344\0164\01398O\334\201\323fk\373\200\035\254\310]\346,\016\353\b\024L8a\313\270\204\233\240\302K\270\001\035"
+	.string	"\016ts}e\356$\3450\t\267\023.3ur\235\006\034\356E\2020\217\333]W\030\322\313\324\177\016\200\216\f\217]\315\243\253/Yr\006v\240\302sNFB\200o\376\304\250Zr\217\335ckz\222\312\021^F\2271\314\376\327\025Xu\021>\302\217\376\222lwd<a\264\344B\201ss\246<\204\213\360#\272\344\032\020\376\301C\370p\213\317\200p\327\235amy\f\272\204\362\373\026\016\277\017~\f\034\344s'\206\213'o\321\223\375\347\342\2367u^<\371\352^\272\313\243\036{*~\262\265"
+	.string	"\367z\254\221\225\315\360\311Dv@\212-08U\374C\344V\\\006\273\302dp\355\205\025yp+*t\251\324\247\310\203\023\307\350\321\223gL\236={~\200\371\201\357\305\313\206\334\310\234\233\275\0238\304)+\317[\236\013\026\006\342\247#\364d*\252\213\t\273\323\202H\227Q\3307T\301\246\316\220.=&\230\025\346\214\331\036\336\251Ztr/\252\033\210\333\317\3021\265\276\016^\347\217\203o\360\016~?\032\234\203\023\351\242\350a\351l\360\025\024\313\323\340~\272L2\353\313\340B\002\202^\250\34281\215Q\251\030\252\031\221$I\n\315\001\342\n\020\004cy\032\307\324\003\022\300DE\210\204f\206j$I\222\235\335@\034(\313c\261'\317thBmP\255\343\204(@_^\373h\340"
+	.string	"4\177\233\330P\206\233\030C\345\f\367\035\350~\331\202\037\222H\264\260T\002\226\rBJ\037'\036x\342k\0070\313Yf\371\336tP\023\350\035o"
+	.string	"\212W\275\341Do8\252\b\356\332]W\347f0\270\276\332V \026\021\205[\367\001\207G\221v!\031\026R(j\315_\221\221\210\3422y0c\254A\320\246\"\257V\005M\304\247~s\260\2331\243\271(\375\001p"
+	.ascii	"\374\244\024\324UC\003\263hd\257\231s)i\016\32638Z@2k\276\262"
+	.ascii	"\235\232E&T\320\020\r\207!\007=\241\301\357\376\026g|\301U\225"
+	.ascii	"\342\364)\234\354Z\264\232\277\363a\343\3715\320\033\245\022"
+	.ascii	"\356\321\353\327\253w\343\373Y\333)2\016\247"
+	.string	"sVU\301\352\202P\n\332WI]\177\307If\253\bm9\326%\024\301F\201\377\317\2717o\300l\243\213^\"\\\035a\363M\344\0262L\364.\356c\212\2010\007 \330\216\272\302$\336's\230\322\351\204W\277\350\2426{\216\365\302{\263\263\030Q\177\267\235\365`\233\351p\026x\027\233\320Z\223JCcql5l\306\002\262\264\356>\\l\272\022+\315\342\355\252\222\0356\257\330\274\342\234\346\367{\351[\001a\307T\247j\023HUu[u\305\366\323`\215\207\253\031\363\034\237H6\251\247\201J.\251\037\205'\263/xu\203V\333\026\266\227\330\0302\247'\003\267+\265\242\342\027D\354GtG\320,\222\376\331@#\032\266\244\035\206Hj\343x\320gp\273J\034\212n\27328/\315\235\026'\230\356^e\370'\266\256)hN\335\017e\346'H\214L\n\263K\017\027\202\264\261\202\255\236\261\350"
+	.ascii	"/pA\216\225\250\\.\204\t(,|0\302DC;\335\357\035[\235\021\266"
+	.ascii	"\225\253\244\035<&\351x\316\217\217jV\311o\216Xs\266h\325\177"
+	.ascii	"|\213\312\004!\355mL\371\220JV\325\254\201\035\331k\304I7%j\352"
+	.ascii	"\347\351\267\227\227Q?\261g\023H6\332\357g>4\243\367\227\236"
+	.ascii	"h\246\374\\"
+	.string	"\320\317u\332b\362\224!\276\003F\321\277I\336\214\317\326\004\344%t\340C\200#\b\020G\203\032&\323\003\241\345u\272\254\374\275\0232\035\t\353#\326\312\244`+\331t\177\375\336\216\036sE[ig\272\334!\205\301U\360[\371\266+\373;*\024\272\030o\234\016&G\327\315W\036\2530\232\214\036Y\333\235\t3Ww\276{\367\307\007\"\275\306\025\217\t\251\t\222\206/qT\334\231b\372\216\304\264\300\013\r\234\240A;\304U/\340\032\254\301\260\360\207\374\026|h\356\262H,\345.\2323\2360\352\023\020Yr\0166\306\333\245\367o\007\233\017\2524.\343Xh\001/\203\003.%=\305\360\265\331v\207zt\376\204\265\bN[`(\247d\275\224O*\333\366\004z\331\220.4!v\004\247\3057\303^\252\211T\022\206\323Yt\0020\346\001\236\277(\036\220j\231\307dj\267b\344\227\307\354\274+\210J"
+	.ascii	"g8jM\261\306~h\037\331>Q\200\203\231\316\230\230me^\362\350\224"
+	.ascii	"\241\304K\356Hm\"\016\307\237\363\224\215\327\216\320\021\211"
+	.ascii	"\312UD\2435\f\300L7\333y\217Vg-\324\230\274\312\237\033\007E"
+	.ascii	"c\b\227\234H\003\212\270z"
+	.ascii	"\f\304>\312\021\234\t\216\004zh\251>\\\261L\304?g\223\034\032"
+	.ascii	"\300*\030*;U6\335\r\270\320\321\3070_,\255v;\343y\265FE\241\033"
+	.ascii	"\006\205D\271C\331?\311Y\307L\235\321C\350\2666\034(\250Mp\207"
+	.ascii	"[.\227\232\313S\227\267\334\032\330\274\251\002\255\251\226\332"
+	.ascii	"&\312\212\251\276'!\214\234`M\004\231\272\205\316\222\363\224"
+	.ascii	"3\007f\376@\017\276\375\240\007oOq\254\255rq\210\004-\332\031"
+	.ascii	"\234\225\230%JZ!ck\223\217\305Yf2\fJ[\252[f\353\337L\307p\241"
+	.ascii	"+\246\035\314\227k\256li\250A\004\360@\255RB89y\245\206\364\024"
+	.ascii	"\221[\023\367\357K\307\373a\301]\306\353\024|C\2776!\003\202"
+	.ascii	"\200\332\3078\001\030\212\007\005k\024T\250\330Z\260\320\254"
+	.ascii	"\202\034\233Z}\b"
+	.text
+	.section	.gnu.lto_randomGaussian.part.0.17.ec7ee6a18cce361f,"e",@progbits
+	.string	"(\265/\375`\207\005M "
+	.string	"Vz\306C\240\330Jc\nM|\030_\245\365\3155W\224\261\366<\216\250\364\022\277\221\224\274\225\353\332\366#\022\323\225mCV_\022u]\236\234\221\267\204L\215\nc\024\266*\255\272\210\231\231\231\231md\223\275\223L)\264"
+	.string	"\245"
+	.string	"\265"
+	.ascii	"f\222\025N#3,{\343\202Vf\316\337\323\316\242R(\353\"Z\265\021"
+	.ascii	"\257\325\006\311\221#;3\254\314\005\216\006;\213ji\036\244S\232"
+	.ascii	"\207p\216\375\246\r\t,~hN\026\253`\267\325\332\364\322C\204L"
+	.ascii	"\033b\275\220\002\245\304\261\3159\017H\351\237\203\200\030\372"
+	.ascii	"M\024b\225\322A@\230gN\263)ls\376\006Xl\201\235\305\326?\264"
+	.ascii	"\304\332\326>\214\266\325\002\207~4l\214ZJ|\025)3\347\344Y\354"
+	.ascii	"\317@:\213;\373\350,~\206\267|\031n\325\022\354\204\b\337k\016"
+	.ascii	"\313\260\260\002v\"\205e\217\303q\301\234\263;\025\256\350\266"
+	.ascii	"\b\332>h\3050\001@\270\344\234\274\214>t8o\326\246\3132]v\351"
+	.ascii	"\262J\036b\003\270l\322e\221\254\346\036]\326\350\262E;Y\242"
+	.ascii	"Qvh\224\025\n\032e\201~FY\237\236Q\226\307H\334\235\313\352\\"
+	.ascii	"6\347\2628\227\275\331\311\332\214\2625\243,\315n\224\035u\243"
+	.ascii	"\254\030\216\262w\233+\375\263-\240\251\206\016\331\234&\346"
+	.ascii	"\344\346\013"
+	.string	"\261\355\206\221\330j\322AG\001\013++\201czM\247^\013\374\b\303\330\001\304\f\234E\267Y\327:X?y*\361\302@\267\325Mj\303\246\325s\222> !G\2066\347\354\325lV\342%\275\"\210\304\215\001\375\347AV\374s \237\367\374\247\212{\356\303\363\335{\354\346\335y\356'\226-\202t\275\245\311\351\274\215\332\271Rh\226s\235\337\315w&q\336RU\351\f\226s\257\271f\207\016\27088\257\213h\201\256\202\271\2716\2579\271\232n\216s\373\316l~\343\343\346\203\253\271\315+\277\316p9KG\363\232K1>\262\335\3564\2070\006\305wf\274\356;Q\367\361\007\306\324|r\342\303\353x\302\213\277\332\234\357\314/\037>\301\327\n\0347\250\223\377\257F\306'\327%\347\352\266^0\225,!.sN\003\365\224\020\031\352\032 \356&\346\001\023\206\354G\037\334\313\252\222\202\272\322Ma\240\322"
+	.string	"%v\230b \205\325\323\211\215\"\200aJ\312*\203\024T\026\007\336\223\004\007\021xXSTWPX<\rUP\031xQW=\036\201\246Zm\230\272\342aYY]\361\244oV\257\271G2\275\351am\233\336\005\\\357\352\177\031m\227\256t\246\177\313\204\245k\275"
+	.string	"\360\235+]\314\021\034\342\n\272\226\202\275T"
+	.string	"\006{\204Izk\301]\n|\020\354\013\322w\236\364\320\315wv\364\026\n\351r\007\017\2618\270#_c\234\304\b+\323y\031\375("
+	.ascii	"\f']oig]Y\\t#\242\027\335O\206N\204\305B\037\272\342\240\013"
+	.ascii	"\005\335\301^\360[\026\016\2151t\250Q,\343\030FdL\204\244\240"
+	.ascii	"\2400-\006\200\002\2319*;\022\300\030%\264\216\202\202$)L\373"
+	.ascii	"\033\300\327cB\341\240\222\206s\333\2339!\265\304Jv\245\354\233"
+	.ascii	"\354\371\033\3148f\376\006D\307\303\025@\264\270\260\347Et\177"
+	.ascii	"\n\f\225\247\002\327\315\302\333\207'W\226\340a\206\207\0018"
+	.ascii	"\321\244;\300\360*\227\274K\001j\207c\034\021\005\371\203~\033"
+	.ascii	"\227\242\013R\020O*m]x/\ny0\372\345\327]\366\355$\033\302o\364"
+	.ascii	"'k\324\303\335\0231\377\320\037:b\367\336%\277'\310\002\343\210"
+	.ascii	"\017\030l\305\245\302\230w3\354\357h\337\230n\232\036E\261' "
+	.ascii	"lu3\350#\022\204\314a\036[\241{>\320D)\321\t\002\351#\013\035"
+	.ascii	"\332\314\261\363\277\314\260P\215=8\363\2050\364vxwD\367h\004"
+	.ascii	"j\263\020\030S+>\036N\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ec7ee6a18cce361f,"e",@progbits
+	.string	"(\265/\375`\025\001\025\b"
+	.string	"r\314.3`m\322\001"
+	.string	"\347@\204\227\013h\006Y\201d;\352\177\374\353\332!\031,\262x\300\n\202 \b\202\200\214\337\f>)\236xWk\322\b\355\336m\223$\223\fh\217\013\016\314\216\320\250P\311vo`!lw\306\307\030\2319\017$\022T\273\203\t\2667`nw\346\212B\004%\323\316@Ew\027&\357\262\227\327\\S\036"
+	.string	"$\345+\320\363]&\371\356r\206RJ,&\337r=\177A'\005\225<\252\351(Ui\306\273\213\330YIP\214\021\362"
+	.ascii	"\333\021\375Y\0037<\351\230\030\341\350+\320\310Z\020\002\275"
+	.ascii	"g@7\002z\261\254e\355\007\242\"\206@8\332\335\rP\227\210\230"
+	.ascii	"\233   \003)\322t\337\2527\315\370\373&\326\206\016u\350C\177"
+	.ascii	"h\263\241\337\24134\373XU\207\261\036\340\b\016\004\207#\220"
+	.ascii	"\264-\305\021\301\230\237F\343\214\242\307&\226\237K_\3169\201"
+	.ascii	"\340\r\324\240\331\350\004"
+	.text
+	.section	.gnu.lto_.refs.ec7ee6a18cce361f,"e",@progbits
+	.string	"(\265/\375 \023\231"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\003\005"
+	.string	"\006$"
+	.string	""
+	.string	"\007*"
+	.string	""
+	.string	"\b0"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.ec7ee6a18cce361f,"e",@progbits
+	.string	"(\265/\375`\016\031\375s"
+	.string	"\n\277"
+	.ascii	"*O0\224\322\031\016\245#\201DL\030~\241s^\223\345\223\277\223"
+	.ascii	"\354\343qHo$@D>\322-\270\035!\342Y@\022=Il\342\344\274$F3\001"
+	.ascii	"\300\003K\360j@\365\232\005\360><>\261\037\350\024+\3362\236"
+	.ascii	"\322\353\0065\2647\264\267\224))\002\215\002\247\002\333\346"
+	.ascii	")\326n\343\0356.\335\256\035\360tD\271\300\334t\267\334\331\310"
+	.ascii	"\275j\333F&\303\313\314M\367z\013\376\225\303\306M\342h\347*"
+	.ascii	"\245{M\n\2007.jus\335-A\n\t$\220 \205k\"\205\225\002=SI\317V"
+	.ascii	"\351\271*=\003\221\236\225)\021\357H\277s\351\027.\255\200-\375"
+	.ascii	"\232\245_\257\244_\257\364gY\351\356qW\351\333\226\244ws$\335"
+	.ascii	"\026\222.3\231\356\272n\377\216Y"
+	.string	"2Bh\266\024\3570\272H\034}\313l\320$\t\025F\317\034)\367\242\330\251\330N\327\315\256\375\353e\277\034-\210\331m\354\356\001N&F\266tat\301\034}\217(\332%\227k\017\235g_t\3201\312<\244\233\"\271E\273=[\264\375Z\261i_.\333\345>\306\265\233\335\353\220\017\\\034#d\214~\230~W\354\206v\305\356J\251\212E\261C\267h\307\314\027\322-\343%\333,\337\262%\342.^<\310\330^\335\353\226\241\335\305]\005L\354*\300\343\345Iql\207~Fz\020R\276z\221\362\272E\273\025Bu\340\236\270\030\335\265\311\272\327\023<&\206H\206\277\216\266`\337*\353\365\363\330\203\031\206\325\335D{\344\313\020+F\337\"-\242\352\027\347\364\353\242\330\245[\264[\212\375\017\013\340g\250\177\013H\361\257\b(\376\035`\003 \340_\030^\377nPE\200\177\251l\327\f\\\006\024M9"
+	.string	"\206\177G\330\255{\360\363\226V\326\317;\320x\317\317\301\177U"
+	.ascii	"\220\300\3772\b\354\022\254\377\020\274\350\347&\377\356\376"
+	.ascii	"\374\353\363/\372o\372/\317\277=\377\362\377#\376\005\372ww\242"
+	.ascii	"\237\215\\\261\362\357\f\377\367\347\260\177\247\374k\365\357"
+	.ascii	"\362_\344\277\305\177\177\377\332\360o\r\377\322\360o\f\377\266"
+	.ascii	"\360o\n\377\222\360/\007\377b\360\357\004\377\266\370\027\202"
+	.ascii	"\177\205\376]\340\177\332\377\025\376\203\375'\373\227\305\277"
+	.ascii	"\024\374\033\301\277+\376}\340_\007\376m\340\337\260\377*\374"
+	.ascii	"_\3773\360\237\355\377O]]]\335\177\006\375'\b\177\321U[iw\367"
+	.ascii	"TE\231J\316\3652\271\342g\255\363\326\331\004u{u\367\001K\305"
+	.ascii	"N\235\026F9K(*\253\n\025F\031k\303z\220_\310\220a\224\247\374"
+	.ascii	"\354E\226\027\243\237\263e\377}\202~\370\241v\304,\345\177\327"
+	.ascii	"\305dw\377\340Y;\371\024\264[\236\025\332\023\355s\003\256\356"
+	.ascii	"\25599\351\024\263b\221\253\350\277\233x\242\327N\036\233T\304"
+	.ascii	"\343\2252\312\023k#\031\240\233I\372\270R)Qfs\257\275m\244R\336"
+	.ascii	"8\256\314\344qe\022\211\332\310$v\257J\242#Y\221\270\307&\225"
+	.ascii	"\362\330d*O\264\261\211\335,\"I\215L\3451\fSItl\026\225G#\225"
+	.ascii	"\362\204\326\334\2236<\266\304\326,\222\243\261} \245\212I\242"
+	.ascii	"\266\343\312\354\270\356%\323\321\311\005\272\245\230\311\270"
+	.ascii	"\342\220={j\363\361\264\245\310\334\265\273\t@>U1\333\330v\304"
+	.ascii	"bvc=-5\362\002\342\332\326L\266\215\230D\252{\350\350.\240\327"
+	.ascii	"nd7q\273\255\273\211\335\335\223\224Z\273\211\020\035\257\220"
+	.ascii	"\310\356e\ndK\021\321tt3Y\2323\345\261Y\305<B\303\322\274\352"
+	.ascii	"\035+q\257:\216*\2316\211a\335\243\2737Nz\245\004\002\207\321"
+	.ascii	"5\200\345\226\017(n\f\226\026\266\004?a'?@\b\311\301\305\214"
+	.ascii	"\233\240b\314\260\253\2404r\270\220%I\177\026b\327\232@\224\320"
+	.ascii	"ab\345\003Z\2278\214\256S\206t\217%\306\235\2164Q\306\202`\037"
+	.ascii	"CT;\340\254)\331\262*_\252\316I\252z\340\360 3\303(\225\217\333"
+	.ascii	"\0342\tF\177.\323-\3145k\023\204\215\360\222\243\030\t\003a "
+	.ascii	"X\212\207\360\024\023a!\\\204\217\354\0273\031\352\234d%\334"
+	.ascii	"\231u#\343\206\231\353\206}\320\300\026\2455\267M;QZ\\b\230\271"
+	.ascii	"m\353VD#\267\346hka\342\320\354Zq\f[\230&\306\220\213\322\232"
+	.ascii	"s\361\202\231\213e\313L\020\327\206rQ'Jk\256{5\363\266k\305\270"
+	.ascii	"+\314\3252w\225F\315\256\261\230(-\2561&\3778\332\266-W\030\356"
+	.ascii	"Diq\025\301\\#v\255\270\346*\005\317\0341$F\022@\177\"S\024|"
+	.ascii	"v\022SF\246\020\362\262\023\367"
+	.string	"\203\321s\233\364H\211\2577p\272\274\211\303e.\213\035\262\243%\254\\\321\251S\266^s\216f\202x\242{m\313\325\317E\346\301?p\016&\262\017\254\203\217\374\304=x\307~\261q\353\276l\002inN%S\2244\267~\244g\221\212E)\225\214\236T_\303Xkz\274a\364Dr/A\3133sKN\346\307T\271\0319\217\354\327\331\316\251\257C&\322v\224\261\361H\337\303\236mw\0269\243I;\242\204\212\317d\201+re\204\372\271\204b\2713\313\020\021cW\024\243\347\220 g\224\020\345\t\344\007\002\315,2\251\344\256\323\033\177\"O#\313\361l\351\321\262\303\n\026\243g\217\323\207\223\307\371\303\251\343<\236;\266\271<s\320\261\371Yd\303r2t\353X\261\206J\262[\233\227'FO\342\371m\2128e\213Q\226\303ugW\331)\"\351\244\347%\332\200A\211c\224\225Hu\360\244\201"
+	.ascii	"\345\221e\216\225\370\231\016\3171]\rRC$Q\302(\333\341;g:\256"
+	.ascii	"s\022\305\230\356\002fw\221\351\206\350\272\213C\273\n\354*\200"
+	.ascii	"R\251\212\222e\207\236\347\r\305.h\316\3219\t\036 \330\2204a"
+	.ascii	"\024h\213v\354\206\341p\234)\251\037X\212H\317o\272"
+	.string	"\264\260\212\f-\221\223E\346\265j\273\"Q\316\024\243\334\346|\346\307\216(g\214\376\204\252\312qv\226\336\3149\215\031\226\3436\273\366\222I|\263\201\332\234\232\344\\\037\245V\004-\325\216Rj\316rhCL\324\270Pq\334\031\315\23176\261e\312p\3473E\200\250\301\002\362f\025f\f\034F\317\203L\317s,S\306J][\033\217A\253\\\241]\313b\276X\f\217)am\"\f^\311 \023\354\232\226\351\372b\366\306\b#\230\355\3558\225\344j\302\302E\266vf\373\201\316\221#\270\371\343\266c\215\023F\031\f?\361\371\252C\247\207\333\331\031{9\273\217\240\271*\022\307\244\2128{a#D\207\313\314\024FY\215\347\tL\022-\355g\211'UUih?VF\274y\255?\3072Or^\312\312\270\013Q?\311\201\271\351\345r\205\320S\220\256&\227s\0276G\322\276\330\360\226\236$B\212"
+	.ascii	"\263E\213\017\\\335\223\024#\255\264\344\004\311\262uoXof\254"
+	.ascii	"\2001\021`\214e\327\275+\023*\271\256\214%%\272!\247\222sW\316"
+	.ascii	"X\320z\274\244)\223`\224\303\270\271\333r\207\316XsL\215M\031"
+	.ascii	"\017\252 \"\204\200\2251*\306PgS\310\226\023(\351\321eW\027["
+	.ascii	"\331e\237nfSI.\257\263\025\0373a\242\3560\312U~\206\252=\371"
+	.ascii	"p\205Q\246\262a&\352d1S;\032\320V\0176.\214\0365\246\347+\226"
+	.ascii	"r\036\342\347!8L\302\240\r\037\260\005\241&\034=%\240O\250"
+	.string	"\016\005\370\375\234\200\300 \260G\255\321\323\3017\334\251\275!S\217i\247\024\374\235@\337\360D\277\204\004\344\tm"
+	.string	"\372\324 0H\310[BB\223\230|C\025=!\357\207\324KR\321\304\024$\032\006\221\316/\265\030\376~<\244%\225\307d4T}6\0309\001\225X\340p\002\372~,.\200Q\003F\f\034F\275$\247\037\022\320g$\034:\031\031\341\020\024.\251A`\217\r^\357\207\"\361\250\302\033C\024\007\336\013\251\013/\354\232z\352\f\325\0074Ah\250\376\234x6z2\0060QA\013U\310kj\201B\251\247\002M(:R\220\005`\320\007\024\366T\236\323\r\242#\371\204=`O)\375\0050X\300\210\201\243\34714\250@\203\nv\217\241\301\321\221\0060\216\322\3038:U^\360g\203G\375\031\326"
+	.ascii	"R\277\304\300\203M=\241\221\032\f\n\215\200\222z\275!:\254\021"
+	.ascii	"\002\n'\206C\036\023\272\244*\001{'0\ty><\237*\354\001}=\352"
+	.ascii	"\320I\270D\003\007\217\311'\350Sy,\364\234n\b\2034p\340\345`"
+	.ascii	"B\005\362\324!0\030B\217\311G\343D\017\350\373\375(\361\2042"
+	.ascii	"\204\274\237\223\022\220\007\344\323\033\372\202) !\361R%\237"
+	.ascii	"\r`\020i\327c\362\251(0\350S}\303`S\232\203\352C\n\376z7\244"
+	.ascii	"\275$'\325\247\252<!\232\324\3535\315\370\t\nsPB\221\220x\247"
+	.ascii	"Z\303\205\005*\320\347\224\366T\236:\203)\230\004\344\t\201\206"
+	.ascii	"B\277`\020\204\032<@\236o8t\342\221\320\023\362\232f\fyKD\252"
+	.ascii	"\f\336R\323\357\003aP\r2\005\365~68\005\223v\317 \203\020T\264"
+	.ascii	"\220\002\t)R\213_/)\310\224\304s\272at\002\r\023f\030\251=%!"
+	.ascii	"O5\002\372xLFH\302\241Q\213"
+	.string	"\005~\216m\017uuuutc;\031\347\225\263\371s\354=\204vq\311\342\332\241'\330\tv\206\245\304\016\356\234\353\317\260sN\222\2508n\"\351$\275d\245\377\371\205\005]ReL\216\225-\023lB\342\024\361b+SN\232\264U9\271N7&w|0\272\3664IC\346\352\354\032\243\305(E\311(\220\026\271((\253\217+9\252\234Z,\247&+\371\345\314:\255L\264\201\3251aT\210\237S\204`9\035\200\230\2449\"\215\321s\210(\247\224+''\224'=\001\024\241\313\"\363j\"\205\310O)\"\247\325\t\027\324D\261\206\3521\003\003G\316\\\037\227+\200\302x\204!qV\375\264\372\271\304\305\213\257I\271\264\340\212\214\236A\374T\262\024\023\201\377\250\241$\307\2343#\"#\"\"I\222\244\0031\005\204 \345 f\365\022 E5N:\246H\225\004I9)H)\215\001\n\246H"
+	.string	"\343}\346\227J\324P\253A\256d\216\303#\216)\313\037\303\037\250\006C2ymM\233jH>\260%\301(\220po\257\364\273\345\231\"\225J\3372\246a\377\002\337\226\250\234L"
+	.string	"w\3547\260"
+	.string	"\321\277\340\371\023\250\372\343\035\351\343(\215"
+	.ascii	"\224B'I\245\244\361"
+	.string	"\204\0212ts\036\305\336\005\235\200e\337\270\335O(\376F\322,\351\303k\237lIl\200K\277\325|\217\355\263(\361G\264\037\031\257\243\360V\242\224gC\234\231I\377y\200&]\220\361\301\222\016\244\271%\341prA\343\247\t\375vH\204\325\353\241\034\263>Ua\322\205\354\226\205\225\032a\361!\334\004-1]\302\341;\b\324\300\301\375N\021o\375MbG-\016\237\021\351\250\037\305$\303\355\373\222\027\261xiC\277\035&\336\270\tT5V\303\016\313`\267Q\274\025\320Ne\334\3506\350\242C\357}\215\267\224\036\354C\352\336\227\273\303]\254%Vg<\313\264!=H\235\314cw\033\316\333H\267\364\355\316\312?VG \200\233:\343\b\240\215\216\314WX\032\373\035\340\226\346\006\207\277(\004\265\312\302!T&N\033\241.\36183\fx\0232\271IC\034\202\225\364\323\233>q}\3761\201\305\231"
+	.string	"\031]\356\355\271\247\341\307G\021\305\305\026uC\004%S\252\022\025\307r\317)G\323\b\"j\375\331\210\220\177u\3457\244\354X\353\362\034\345\f\220~/'\260'!\223nZ\362\205\311\032\023\023\001\f\310G\305\213\220\350S\217B\016T3n_\300T.\354\365\217\341\214\316\367u\231\026\311'"
+	.string	"2"
+	.string	"g\262\003\305\025\016)\217\273\"\300\371\377\022d\022Q\364\301\022B\026\220\217e\326'E\223\252IJx\201\345\f\205\201\200T\205\003\301\007\301\244L*F"
+	.string	"]_\323:z\3235\006s\302K\206\342\231\346\031*\310\310\230HN\266S@q\034\241\004\002uI\371\r\323\035\354\0075\3224\200\362B\021\002\006\277\306\036\312\207\245\256\\\234\272\230\316\334\320J\330\250\371A\237\351\233\253\312\213*\035.|\327\235\233\235\311\327\2474h\234,\020\354\033d83\316\342Ko:Ze\ru\350\264\025Z#\f\216\300\370\022\032\355T\013\354\227\230\033\226&\037N\300!\306a6Q\251\301\377&w\224\376"
+	.string	"\231&:\254\002\344?\030-\251\226,\345\275\331\r"
+	.string	"N1B\357-ea\177\217\333\302\335\t$\020\200\250\326\226gi\346\032\201\2175\016\360\333g\273\220\344\335\336\274 \237\200\007r\b\3777\2271p\277\361\232\201\373\016\256\327\376\327\232\223\330\357b\355\365\351\314W\266\2663\204N@\224\205V\206\001\314\277\205$\323\373g"
+	.string	"\364Q\337\217\241\301\244\203\3662\t|\032\225\254\247\254\001c"
+	.string	"\225\220\320YDCva\274\177^2\216\312f0\241a  \0213\243*A\001^\266"
+	.ascii	"\242\200\227g\361\356\277 \250\355\236\277\003M(\342\016\307"
+	.ascii	"\020e\377o\033\233\bi \0313\315\311\013\354\2474\247\345\235"
+	.ascii	"\363\3239tr}7\363\224>\270}'\364@\370Eu\255\323\337^\372Q\275"
+	.ascii	"O\374yX\312\320\031\337\352\320b2\036<\370\17762=\306rm\271\225"
+	.ascii	"\246_n\273oG\311\347\3410\364!\326\363Krc\370\263\321r:\250\377"
+	.ascii	"\246fyN\3577R\377\001\006\251w\307\004\037q\256\356=B;\201~\375"
+	.ascii	"\330o1N\375/n\017\360\204}\360\301\235\374\r\373[38Ht\251=\370"
+	.ascii	"\357\246\256\362\234\333\032\227eR}W\366\rvT\352\273f\006\301"
+	.ascii	"\006f\253\231}PX\005f<VunG\032"
+	.text
+	.section	.gnu.lto_.symtab.ec7ee6a18cce361f,"e",@progbits
+	.string	"quadModelConfigDefaults"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\001"
+	.string	""
+	.string	"quadModelInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\001"
+	.string	""
+	.string	"quadModelStep"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\001"
+	.string	""
+	.string	"sqrt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\001"
+	.string	""
+	.string	"cos"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\001"
+	.string	""
+	.string	"sin"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.string	"log"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"exp"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ec7ee6a18cce361f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
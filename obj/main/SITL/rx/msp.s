@@ -0,0 +1,271 @@
+	.file	"msp.c"
+	.section	.gnu.lto_.profile.fbce12132c67a6da,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.fbce12132c67a6da,"e",@progbits
+	.string	"(\265/\375 f\335\002"
+	.string	"\004\005Z"
+	.string	"\007"
+	.string	"\332\205\333\362\001\002\002"
+	.string	"\002\001\001\240\342\234\212\n\002\255\271=\004\002\003\352\263\360\321\b\004\376\314\317\334\f\b\002\003\002\003\002"
+	.string	"\002\001\002\002\002\005\203\262\371\241\017\b\002\004\002\005\002"
+	.string	"\002\005\002\006\002\005\002\007\002\005\006\240\342\234\212\n"
+	.string	"\003"
+	.ascii	"w\202\001\362\330@\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.fbce12132c67a6da,"e",@progbits
+	.string	"(\265/\375 2\r\001"
+	.string	"\230&"
+	.string	"\004"
+	.string	"\002"
+	.string	"\020"
+	.string	"\007\003\002"
+	.string	"\003\004\002\001\005\001"
+	.string	"\005"
+	.ascii	"<\013q\021Z\242\314\ff\003X"
+	.text
+	.section	.gnu.lto_.inline.fbce12132c67a6da,"e",@progbits
+	.string	"(\265/\375 \306\305\003"
+	.string	"\202\306\024\036\240'\351\317\371\244\300\263\370\027w-\276\273Q<\033\002\377\377\367A\341\377\023\261do\271S\377\367\256\n^\025\373\266\356l>\215\307%\013\242\020\372\007\216S,\2102\030\177u\213Dr@\275a`\024\316\305{\025\340S\357G5\263m53\323<\216\b\016"
+	.ascii	"7C\2030.AW\304\322p5\220\224\013\030\215\352$V\261^\005v\223"
+	.ascii	"\036\313e5[\203\001\026"
+	.text
+	.section	.gnu.lto_.jmpfuncs.fbce12132c67a6da,"e",@progbits
+	.string	"(\265/\375 2]\001"
+	.string	"$\002&"
+	.string	"\004"
+	.string	"\002\001\001\f"
+	.string	"\002\n\177\002\b\002"
+	.string	""
+	.string	"\004\002\001\001\017\177\002\003\177\002\t\005\013\177\002\005"
+	.string	"\002"
+	.ascii	"\363\034c\003m"
+	.text
+	.section	.gnu.lto_.pureconst.fbce12132c67a6da,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\204\004\002\230\004\004\231\004\005\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.fbce12132c67a6da,"e",@progbits
+	.string	"(\265/\375 \267U\003"
+	.string	"rD\016\030\260%\351@`\252IrK\222$\t\340B\333\255\341KZk\244\311\224\002:\032\t\243d\251VU\2761\372k\021\021l\203\363\020\003\300\212\037{~\266\306V\213\264Y\f\004\024"
+	.ascii	"F\tPj\200SsA`\230\207\271\306Z$f\025\364U,\245\302SU\314+bS\205"
+	.ascii	"\200\270R]\325\302wg\223b\027\260a\003m"
+	.text
+	.section	.gnu.lto_.lto.fbce12132c67a6da,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rxMspReadRawRC.17.fbce12132c67a6da,"e",@progbits
+	.string	"(\265/\375`i"
+	.string	"\245\t"
+	.string	"&SD90\257\322\001\300(\034\326\313\017\330\204\016\354\217V\314\002M,\264\320\311VD\330\206\214N\377v2D\004\220\377\237\001U\241<A~\225{\b\217\310Dg\337\030m\223-S\n3"
+	.string	"4"
+	.string	"/"
+	.string	" \017\t-\352\310\201\021By\321^v\307\256s\202\314\247~ \363)7.^E\377$\377\224\270\300b\254+@\303\356Za\261\214[\336\366\3076\203m[\233\026\217\312\356\305-fWf\355\303vhslsj#$\204\237Q\274\263.\026\017\005U\373\"\037\t?V<`W\006\223\262;\036\330@\363\351Qc\333\017?\0215\273\273\340\323n2\341w|\032\245\322\303>}U\346\223\223\233\232\312\313\277l-\275\331#K\245\206}n\245\314\266\232\373\354WN\375\031\236Hb\304\201\251\207\210\022\204\3679\220L\245\224\247\n\255@\001\217@'\224\251[\201\235W\022\231\272\021\210\352@\036\177'\022\330\245\276\017\3548\343\236[)\263,hI\227m[\004\f"
+	.ascii	"<\241\005(\306\013/J\020\224k\370p\026/\307\204\006s\005*\034"
+	.ascii	"\334\355Q\255t\204I\006"
+	.text
+	.section	.gnu.lto_rxMspFrameReceive.18.fbce12132c67a6da,"e",@progbits
+	.string	"(\265/\375`\250\002}\024"
+	.string	"\246\246\204H\320\016)\035\332p \013\tm\027\237d\353\n{p0n\350\rW4\337\212\035>%\341\335\270\320b\311\314\246l\231\204h\353\275\254\312\202F1\310\325\f\262\222C\256@h\224\1778~\365\245\007\233\332\234\264\275\211\334)\005q"
+	.string	"l"
+	.string	"l"
+	.string	"\2739\241\241\335\335\210\005\204\227\336\035d^\206\0070/-\263U\004\250e\034\271\3740\355\256J'L{\034\334\335\240\312~\2322\0045\312|\336;vZ~\332\300\271\004\325\342D\345\310\\\2062\017\301S\r\346\346' H"
+	.ascii	"K\232|D\007z|\301\321\"\230\023s=\320AnxIB\270\230\307\323\201"
+	.ascii	"\335u\274\341\"\334\030\267\255c\333\200\0351\004jc\357Zb\t\205"
+	.ascii	"&\2375gs\274\347\337\320\270\317\217z\357\236\377\271%\030\r"
+	.ascii	">Z5:j\364;\\.=\220\244]\230\237\2135!\211p\336\373\177\202B0"
+	.ascii	"vk\224.\334\203\017\364\343\"p\203\022\360 \371vW\344\322\005"
+	.ascii	"\302\313\230\262\035w\357 \273\217\213\214\261[\2034\264\273"
+	.ascii	"#\036\020^\206\200\217\366y\316A\366\036\226w\004\0175\347\324"
+	.ascii	"M9T\225\242\310\245\276\3306J\245\276\207W\342Al:\270\273\013"
+	.ascii	"\232\300\245rh\252\266\302F\003\252m\225\213\210}\240\330\335"
+	.ascii	"\022\037\304C\270|\335\245\035\300\342o\260y\031S\334X\314\342"
+	.ascii	"\317\376\207\225X\250\363Y\364/33\335P\325\3332\304\373h^\243"
+	.ascii	"\336\246C"
+	.string	"\213?K\275\362\340\320\222z/f\361\247\3323\252\3414\253\253\264b.\004\rPZ-\223\005'\031(,\223\227\002\351\023\222\024\030K\265\362R\265V&,\325\311\013\246\"\371\260+\005\345\245Rq\271^\252\324n\2579\217\370Z\370fJ\363\277\232>\211\033\255|\235\031\260X\363\362\274G\335\316\206\245Y\374\235\324\306\251\031\251\241\252\024\242tz\334Esj\254\300S\232S54%cd\243\241\305\246\355\327\211FX\320\300\264$\325\306\0015 \220\002\23122\017\242\300\002\217\360\250\035\007\230U\245\255n\025\0016;\242\360D\265\032;\346\001\022\253%,q\342t\240\334\313\212\346-A\233=F\322\002\202X\016\231i\250q\323\306xi\b\264\204vk9,Q\252\006t\203\341\202v\022 \221P\205\0330\2406~:l\320\204\300\262\245\005\327\223\200y\341\306\204$\224\215V\233\341u\260\241\321\364\004x"
+	.ascii	"P6]\364\t"
+	.text
+	.section	.gnu.lto_rxMspFrameStatus.19.fbce12132c67a6da,"e",@progbits
+	.string	"(\265/\375`l"
+	.string	"]\t"
+	.string	"\246\021A90\257\322\001\004Cg\004\017nw\264j\035\001\232\277\237\204\006\027wRo\300\242\303\230\f\3332\266\362\036O\3555\016\303"
+	.string	"-\332\b\231G\353\022\030\270\345\025(D\b\2212\2450"
+	.string	"/"
+	.string	"3"
+	.string	"r9\036\236[\r}\322\271\004\326,%\256\276\\AKe\365\211&N\200\266Q;\354\212!\236T3\2339\2475%f\334\335m+\330&\260m\0137{$\351\276\354ss]\266\325\252\352{k\201\232\r\244\314\251\272\305\314\225\016\345\303\366m\217\354\317\007\b#\207\037;T\f/\250\021\333\234c\233\322\232\270}\311\036b \263\265\350\211\013Mc\367\345\213\274\257\203\b\313Ia\354\307\016\"\362=<\021\322\247\336\371!\357\335\367\260\003\220\324Z1VI\003\346h>\240\216\244"
+	.string	"e\004DCGr@\220\324\004\330\363y"
+	.string	"\245\204\307\003\312o\234_\2273\246\n\224\311\376\241w\330\027T%\352\207\236\356\205m]\007\r"
+	.ascii	"m\b\330S\307\223\303\216\250\f\201\305\264\362|\004\235\272\303"
+	.ascii	"\205\256\341\030\230(\342n\226\252\034\232K\355\001"
+	.text
+	.section	.gnu.lto_rxMspInit.20.fbce12132c67a6da,"e",@progbits
+	.string	"(\265/\375`\316"
+	.string	"\375\n"
+	.string	"\306\223JB \247j:\220P\022\204\021\301\271\200\340ty\020\343!\311o\251P\3608\016\023\360\217\242\205\r\003\375\246\271\260m\213\226\203\322\240\2000\032@\220R\330\366*\0231\203h@\3204;bC\306Fd\247\0242"
+	.string	"5"
+	.string	"<"
+	.string	"\337;\247o\360\336}_\360\336\371\264\033<}\355e\037\036\004l\273\013r%?_O\377\261_P\025\352\325B\261\273\256\250*\344\346n;c{\302\376Ev\212\252\034\211\375\312\356\2569\227\375\364\257\026\017\266\340\201\301.\310\355\301\326:\004'\266\217\261]\323\323M\363j\037\300\003\234\027\300\361\204]\027\355\300n\032\341L\006B-\226\002t\025b@\274vSGm\3614\362\"\254\004\350\352\255\221\233\236\235\361\231y\211\025\200)\274\344\331\244\017(}\273+\341\31364\034^&'\357\335\005efs\220\252\267\241\0204\222\234\217\030\216F\222\205\251D\b\205\240\221\344\230\312\317\236\215\310\024AS\t\216aG\004=\245\tn\030L\212>%8\"\311\022\304\244\373\312r.W\244\324R\\\207\335\361h>\017\024"
+	.ascii	"2\241[/0.$@\020\250T#\030\2412\225p\251\200&\225\331\323k\237"
+	.ascii	"\331\245\006\273\342\032\305\n\343\201j\340\n\230\033\240\242"
+	.ascii	"\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_.symbol_nodes.fbce12132c67a6da,"e",@progbits
+	.string	"(\265/\375 \204\315\002"
+	.string	"d\004\200"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\021\177\022\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\300\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005\017\023\200\204\001"
+	.string	""
+	.string	"\003\002\023\177\024\020\025\022\177\026\360\372\2508\272\200\202\002\024\177\027\005"
+	.string	"\030\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006"
+	.string	";3"
+	.ascii	"7\300\b\004\t\304\200\f\323\324\252\f"
+	.text
+	.section	.gnu.lto_.refs.fbce12132c67a6da,"e",@progbits
+	.string	"(\265/\375 -i\001"
+	.string	")"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\002"
+	.string	"\002\002"
+	.string	"\003\001"
+	.string	"\001\003\003"
+	.string	"\003\004\001\001\005"
+	.string	"\001\001\t"
+	.string	"\001\003\r"
+	.string	"\002\005\002"
+	.string	"\003"
+	.string	"\002\002\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.fbce12132c67a6da,"e",@progbits
+	.string	"(\265/\375`\355\020eT"
+	.string	"*\217\264\037T@\2222J\007(\201;\031pZ\246\327\n8\f\f\t\203\367\250\327\320\301|\353\214~r\315\2161T*e\234\257F\024~\345"
+	.string	"{\346RRN\333\027;21\3537v\375\347\310\233bv\326s\306\"\0068\177V\333'f\002@\356\036\217\301\361F+\371R\246\263\001\356\001\343\001M\276x\250\271\330O\222tK\215\313\371\212y\375\250!6\201\302\345\027X\267(\252\236i\317\230\221A\215T\030.\037\243~\231i\362\"\304*\3635\363G\260b\263\200\272\r\020\322\201\246L\017.w\207%\303c\303\220*+2c6L\226\226\223\324V\254#6\207\313\344\212\3310\177\027\225\\\222c\234p\371\n\352\345\254\327\377\236Z\2219m\262p\271^\366\313&I,\030\332\217J[\205\270\343\344\016\035.\357\242~I\330\366lI\330~\242\016m!!\224\2620\365\202\226,\233\217\032t\266\272\270x\252\276\024\301\342r\271x\261l\226/\327^y\004+\016\024l\253\356t\271\312n\340n\002A\273\t\324\274\324"
+	.ascii	"\254b+\177T\377\335Z-&\013\273\203\203\313\257\326\277\351N\331"
+	.ascii	"\254-v\007\273[\200Z\0302_\326p\271T\266\312&K\354\325\327\312"
+	.ascii	"b\275\006L;\355N\205x\006;YU\270\034\332\0216F\240~\221\377\241"
+	.ascii	"\322+\316\365[\302F;;\333\0226.\356\b\333\002+\302\266Q\220\276"
+	.ascii	"RD\330\206?\322\026"
+	.string	"\n\":IjqI\004\345\337\252\265*A\023\346(6VwJT\203\\\266\254\270|\272#luE\330.\366\337\207\225\361\237M\033\262\017\375l\345g#\f\374\037\341@?+\371\2375\247\376,\344_\363\337\334\277\"\374\033\343_\245\177;\370\227\203\377k\376\237\371\357\346?\226\377X\377\263\376\265\340\377\234\3771\376\203\371\037\347?\234\377o\376k\371\337\365?\313\177\255\377V\377\007\370/\346\177\355\354\354\354\354_\025?-\204?\204\007\001\302\315\n\002\016u\260F\216c\220\243\260\017\246\242M\031V+U\350\2241\221\037\251h\266B\235c\212\263\026\216\234\204\237p\023\246\201\231\260\024v\3028\360\221\255\270\nCa\031\270\006\256\342%\234\003\333\300)Sa%\254\003O\341\031\370\206Mr\024>r\206\201cx\3117R\300Q\306RS:\204ef\033\304\220\262\376\375(\243\263u\204\230\355\2350 6\206"
+	.string	"q\344Bd\025\356\354\030\236\005\371\221\204\200\005\001\244\261\343\230\202\243\260\221\215\320\322c\217T\221\2612\016r\r\035+z\260\nv\216k\206$\214\b\347\230\272\261f\034e\355P\271"
+	.string	"Fv\004\202\2430\216\365\n\372\r5\215\260\024\216\335\251\211\"\023%\030\032\226`\251(_\236U\376\332\0216\007\342\324\263\021/\022\272\261x\224\234\351x\303%\027A:\277p"
+	.string	"\026/Z\270\344\031\253/\307\324\227X\352\261J*\365%\016\365^?\270\205M\0361\2203\013K\347=\301\264\221==\300\021R\"\251\337#\233\320\036\331^\022\251e)UO\353\2412\217\222\0052Fhe\352i\311z\232\222ZD\363QOK\241\036\235\3253\234\332\302\207z\346\241\276KL\375\327V}\231\222z3\246\252ga\375\222\325/X5\332\021\266/\230\n\301\216\260\031\3750\307\207\215V\023\323\037,F8s\344\250\251]\371\250\262\212\363U"
+	.ascii	"\016\034I\340\374M\320\nP\256\214p\351\246\250.\251\023\326\\"
+	.ascii	"\221\310\226\207\365\242\245G\036+F\234\214m\233\365a\3136\271"
+	.ascii	"d\033\346\033\266=\274(}\212\177\271\244Y6-l\f{t\324\260\302"
+	.ascii	"Z\262\005\333,Z\332U\245\222O\312\272\323\257\325\217D\266]\026"
+	.ascii	"M\013\033\303\016"
+	.string	"Z\001\236@\023g\213\312\254;5Qd\302\204\211\236:u\302<\361)wMU\217g\370\213\t\2233`\310\"*J\206\260\031>\002T\024\213#\306dBp9cb\206\f\2179#6\224\342\346G\254\212Tr\310\227/\274\303n\035\177\3748\362\t\002\r\225\024{\235w\370\030\217m\245q\302%\203Y-6\341\023;W\\^\316\275\224+h\251\"\303\345m9*wIr\227\345\332\264w\360\334\350a\332\300kv\266lY\261\272cXkS\177\356Jr\327j\365\b\273D\331\230U\223\036\016\033x\r\254\236\2550\3269\353\234\305\\\030\244\275\303\007Iq\314\312\254\177\f\217~\306r\346\3529\302C\007!\227\254\305W\310\256\256\204\360\025\336*sh\021\201\270\t\202\001\210\234$\227R\352\317\277\255\201\303\356\346QK{H\003\350[\333=\372C,m\025\370_6\355?\001't\377\276\230\305\251J\262"
+	.ascii	"\251\214\372\377\352\016\032\177\023\030\211A\243\017!\322\330"
+	.ascii	"\277`\222\037\321\260\215?!\262\233\250\203\301\337\213b\023"
+	.ascii	"\t\221M\354\032h\210\333\251\361\327\301b\023u\260\201F\302\240"
+	.ascii	"\221(D\002\211DB\244\221\330Hc"
+	.string	"\017u\0208\274\021\354!Q#\215n\032Y$\016\t\221E\242\020i\004\262Q\204l\206\020\275\230\025\231a]\020\006[\307T\020\340p\350K\230\026[\254{\261l\364P\201\356 \305\241\030\320\307v\321\370\322A\343\n\260\270\003L\321(R\354\340\227pI\261{\t\215\246\236R\361K\277\032\311~\375^\b\3229lt\0230\325\375\333\376\352\356_w\363\f\203\244\335@\206\204\307\251\251\356\037ES\035\344\247\305F7c\255\351\"\n\221E\212HZ\256\220\307\226J\177{l1\343\260\"\177S:Gw/\234z$\252\360\206\257\222b\210Uh\270D\332\210T=\322p\371\332\216\372\265\no:\241A\214\f>@\201\232L'\01652!\307sJ2O^\322\223\211\366P\370@\b\325\3552\3501g\350\314\234\251Dd\356x/\202\206\240zO\365\001$)A\3656\360\235A\317\351Nsg2\325\253`\361"
+	.string	"\213\026>\236\267p\001\201\013\blo\341\002\t\311\005\013\244z\026H4\324\027\205\023\362\235>P\270\247\334Y;\315%\335\f\337\351\204\323\235f\217h\307\323\365zQ%\364\202|\246\023T\324\013\031N\270&\037'^\216\207\362N(!\364\026A\212%]O\356&\343\274\351\240z7\337)\200\271\244;Os\006\357\266\323\031\2417\036&\\\f\236\356\306\024\345\004UD\204\232=\363\344\241Q\270\333\322NW\302\r\305\365nOQ'j\202\t\325+"
+	.string	"\310t\302\345z>\350i\316\330\351n\272^\357\374\311\235K\272\247\332N\367TM\310\231M9\037\356\251\n\365\222\234p3v<\035\212s\342A\235&\272\313 w\n\3203\315\223\311|a:1\355(x\302%\315\200\222\001\300\222\023\257)\206\211\342f\350\320\034\005\346\022o\203S\207+\332\351rf/\352\346\303=\335|\347\017\372\246\023\276\223\007e\236(P\036\357D\361s\242\035"
+	.ascii	"\260\203\321\213Bq\350\007\346\023\356\204\221;\205\320]\024"
+	.ascii	"/\311\311\334\355pM9 \023\305)5\365\314S\206\251\344;C\234h\007"
+	.ascii	";\0308\024\367\002\200\336\215I'c\307K2\237t\350.J\311w\022\241"
+	.ascii	"\267\026<;\030'\340\224\226p\246R\356\374q\342\361*\270\325\320"
+	.ascii	"\033\013$t\247\213\252\227@\202$#\0208\270\240\346N@\365\236"
+	.ascii	"P\370N\024;\035\356\tE\356\354\2418!\342?\247a\256&G\302$\303"
+	.ascii	"6\311aL5\001V\003\211G^\212p\312\314"
+	.string	"z\350\325"
+	.string	"Q\r_Lb\020#\206\301\220\216cVMzd\270\262\343\f\2323XP\027\235 \222\\r\031>S\273\310\321\201\b\007\201L\250\2218i\02433\"#\"A\222$I\0071\005\3040\b\2512\036\022"
+	.string	"U9\220#\310\204&I\366\331\357\347C[q/\020\311x\324E`\004\341\203\253H|&\\"
+	.string	"!P\030G<\375\0249#j,s!\370\367EtAc\037\033`X,\240AW8\n3p\023\260\237\030-\2615\022\243\357\270\303\2749\022\377\250\304\330g\273\240`\316{\025\203N]\222\356\311\031\017\003\302\214\354\016\276f\366/\005\324\375^\033\231\345p"
+	.string	"\203\b\030\276\326.\370{\322\316\250\345\363\242\226i\242\3157\005\036K@\216\246e\f\217\311\371\305\202M\nm\326\330A\002\177zc?\224T\312A\225\351\277\223&X\364-\260\201\336b\245N\377\240\314\234C\324\316E\313\245\243\253*.\230/\244\315\326i\313\260\351D\321\202\002QBDR4\004Q\251}v6\247,\275\230\f~\314N|d\236\260Y\365\257\031\304%\343X\332\220\323s\244Zj\244\363\371\264j\031z\352\314n|\377\016\251\365\310MO'\021\331\201\376\013r\036\013\013gN\237\345\002\035"
+	.string	"\\\214\313\240\351\032\237\304\321K\376\223\231+\302\362\357\342\373\221\200\234\261+\2079,\005\322\273\210\254d\200]C\306\375\262\342\250q\2700\265\215\221;\310\003\325@\214\260ZI\037\316\022\370?\261\356e\255\313\346\264\271]\017\017\242}\267\301\243\351\335\033\226W\246H%\370\223\226\310\347\224r\002\310\266q\321\034\262\314%4/LvIc\314\231:\332)\315\256:\376\262\262\356\334\031\255!u\201\357\301K\203i8\220B\274O\361\246\230\017\343`\321\f\r\372E\230"
+	.string	"\001(6\221\006\215``\366\246\234\303\206\317\204\221\023Y\020\311\0327r\233;\230\033\214F1.\005p\216k\347J?\224\234\320\315>\205\270\273:G#/\252\311\211n\025gn]=\243\273%\025\274\377j\200\314\036\324Gc\342\214!\251\304\370T\327`\242\034\316a\204\374\027D|Z\346\006\303\236K\034\004\242'\353\360\212\241\302\200c316\330J\333\365*\270N\r\236{\262\376\247\332\216f2\240Y\307\301\r\367O\335\b\004\020\013\327\217\021\221\216\360\331\f\225\r\351\266u\350Q"
+	.ascii	"\\\250\203p\344J!\231\nW\255=!,qm\033\317{\007\372~\fM\360\360"
+	.ascii	"7\374\337h \361\002\270\242-\360\254\203\231\353x\016>\324n\377"
+	.ascii	"(\204Ou\307\377r\267\342e\002\205=\004\253"
+	.text
+	.section	.gnu.lto_.symtab.fbce12132c67a6da,"e",@progbits
+	.string	"rxMspFrameReceive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\001"
+	.string	""
+	.string	"rxMspInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.fbce12132c67a6da,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1538 @@
+	.file	"rx.c"
+	.section	.gnu.lto_.profile.d1c81fdf4b442c9a,"e",@progbits
+	.string	"(\265/\375 \nQ"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\n"
+	.string	"("
+	.text
+	.section	.gnu.lto_.icf.d1c81fdf4b442c9a,"e",@progbits
+	.string	"(\265/\375`G\002%\017"
+	.string	"\004\024;\003"
+	.string	"9"
+	.string	"\354\256\342\024\004\002"
+	.string	"\002\001\001\321\332\305\303\017\004\002\002\002\003\267\335\335\337\n"
+	.string	"\003\222\252\354\340\007"
+	.string	"\004\351\320\257\242\017\022\002\004\002\005\002\006\004\002\007\005\007\005\352\263\360\321\b\006\240\342\234\212\n\007\b\t\350\373\222\243\013\b\002"
+	.string	"\002\b\n\253\214\322\203\007\b\002\002\002\t\002\n\002\013\002\004\002\f\013\f\r\016\017\020\374\331\202\332\b\t\002"
+	.string	"\002\t\021\330\367\256\304\004\b\002\r\002\r\r\002\r\022\023\024\342\234\316\331\f0\002\016\002\017\025\026\027\242\302\263\302\013\030\031\032\033\034\202\234\243\220\005\035\332\322\230\254\002"
+	.string	"\036\264\370\341\227\005\037\200\356\224\252\001&\020\002\013\002\016\002\016\021\002\002\t\002\002 \"\350\300\306\254\005#$\376\340\327\201\004\004\002%&'\214\276\367\272\016(\235\352\316\307\f\032\006\016\002\016)*+,\217\300\253\210\r\b-\365\273\261\345\022\002\023\002\023.\202\245\236\333\006/\313\247\344\353\017\032\002\022\002"
+	.string	"\002"
+	.string	"\002\002\0220\210\217\356\203\t"
+	.string	"\002"
+	.string	"12\317\356\361\267\004\002\002"
+	.string	"\002\0133\361\246\255\314\00645\312\274\242\261\00567\336\353\205\355\01789\240\342\234\212\n"
+	.string	"S\250AIb\224)\013\n\013R\220\026\003`\202RDe\036\020@Lh\233,\007\030\367\221\025\245Fw\037\307\276k\233x\241g\224\034z\021\345_2i\r\375dn\016N\274\216G\343~LY\260\f\033\361\341\260\n\037\362\024\026Nk\306\215\214i\243o\016t\323\361T\226\026|\325\252\031"
+	.ascii	"\243\301\200\307!q>\322$\241&\016\037\303\314h\342\260?\256\030"
+	.ascii	"\305\366\3332qp\342HTu~\233)[\212V\323<\205FF\036\034|\225\342"
+	.ascii	"m\240\003,%7E\271\355Lz\352\226s\372O\177\334\177\271\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.d1c81fdf4b442c9a,"e",@progbits
+	.string	"(\265/\375`\r"
+	.string	"U\004"
+	.string	"\022\006\021\027\200M\206\00330\0033\304\3305\341\227\315\005\315\t7\272\267\224)\005NId5\223\037\362\330\241\273\301XL\305L \376`\330\275\340\213\334@\247\242@\376\331\321\245\245Z$\005&37\200\212\322K\360\003\035"
+	.ascii	"v \263y\027\030*eC\017\301\3127\0322\204\251\fAs\230\245\026"
+	.ascii	"\003\303?6\016l3\263]\250\024Q,\2604\342\"%\346%\220a77\2528"
+	.ascii	"*\301A\030JQi\tEe0\314\213\0130\004"
+	.text
+	.section	.gnu.lto_.inline.d1c81fdf4b442c9a,"e",@progbits
+	.string	"(\265/\375`H\004\215\024"
+	.string	"V\336jH\340\262(\215\001"
+	.string	"\250<O\302c\277\241\003\002\244\367q\033\312N\004\345p\223d$\253\253\277A\023Y\324\217)~2L\373\016#P\271V\305\270\301\035\306PC\361\354\210X\225C\200\026\206\236\006<\f\375W\322\266\224;\005S"
+	.string	"T"
+	.string	"X"
+	.string	"\362\370\255\355\347\246\306\233\364/\377T\247D\f\032\223\212\20281\243G\301\376$\032\343\237\322\270\036U\264\247\206\203\204\311r=\3149c\277+\213\366x\231\325P,\032\3642\253\215\034um\351\234sv\377Z\2360\f\002\240\037_\033\206aP\351K\026I\b\022FL\251\206\1779d\210\024\272\224nXt\374\364&\243\331\254\026\360\246\326\216\024\234s\226\366>u#reA\031\031>V0\235\321"
+	.string	"a\261\2724\013\024-\337\013\221\027\344\362\344d\225\336*\275UZ\330\241\234\020\214\217\226\243\367v\224F\225.\210*\355p--\212\273\345V\254\263\001\024a(d\272\tC!\322&\377\211.\320\301\3149I\023(\305Y`\374hZ\227\342\f\311\340\344\376\310\241\251\211\"\366/\321x<\3026\205\314e\347\033\243\336{\021\035-G\025\366&\243\341\364\t\267\324\226\333\201;\271t\357R\232-\307\203$C\3706f\213\t\202\242\277/5\201s\263\221\372\301,\360\323\371\237\236j\3149S;X\0275\230\034!\277\242*F\274\210Q\375\350\340\331\031p\003\327~"
+	.string	"\232/'\0326@>\001f\340\311\227\316\314\031\213\240\307\314\031K9\301*\301\021\334\355\314\201\024\f\252\213\"\242\260m\021\302'\027e\2501\265cD\344\204$%)H\341`\002)RS\347\001\022 \025Y\005\261\200 G\002\224\002\003\373=\362v\212h\340\230\tD\333I\2769#?\255t\220u\017\243\203{m\004U\3053\031 7\223\266x\260\317\206\n\331\251\316\3140-r\346\026Mm?\262\305\360\r\310%\377"
+	.string	"B\243\016]\331l\003\334\234\326\331\204\207\277H\361|\233y\304v4\276d\261\345\"4\344\366\377\277\331\2228\343\222+)3\bpn\225\00136\245\202\244\243+\330+\242K\274\202[\241W\347V)\001\240\315c \330\217\372\242\300\025=l\223\204\002\006\371\312\360T\241\255\276\316\335\006\263b8\211`\236u\351\321\325\005\237\266\372@\2700.~\217\351\025_f\202\345"
+	.ascii	"\354+T\"\365\031\366\3566\241\034\021\303\344B\\&"
+	.text
+	.section	.gnu.lto_.jmpfuncs.d1c81fdf4b442c9a,"e",@progbits
+	.string	"(\265/\375`\362\001\305\013"
+	.string	"\246\22184`U\223\3410\feV\370\241\244\254;#\356\013\202 H\243\260\017\357b\0306\3004\222L\213h\252\337\377\211\356D\355-\241\302!\177\206v\267$\354-e\n&"
+	.string	"+"
+	.string	"("
+	.string	"\\@\364\300\222\275\307v\315v\361w\215\"\351\b\223\203:K\235D\266=\263\364\204>\3312\262\216\221OS\276\004\002QIu2\330BpeU\0261\242\366\007*7\037A\310\017\3139.e\315\261\023\221\235\250\274\243\355)\022H\002\035\tEB\345G\317\360\0133\204-\231)kO1S\313\252\205Yz\357\275>\225%\025\376\362\\\236\331\003@^,\251\0139\025b\242\211\t[Tl(248\027\223\177\3634\361\256\256\356#\361\240\206\265\212\304\317Yn\243*k\225\272\202\b\210\312M\365\251\016\377\232\037\020\240@C> @B\245\324\235\007\303\022t\016\017l\024\254\246\223\345F\270\305\022\031\354\322m/,6J\364\321 HQ"
+	.string	"@\216\240\217\315\002\271"
+	.string	"\r<\376d\374bY\321\230N\036\273`1\005"
+	.ascii	"\033\310\330\005,\304\262\037\023\320\\\024\321p \266V\317\013"
+	.ascii	"\0250\352A\002n\224\007\340D\0364\234E\267\330\275\027\345\340"
+	.ascii	"\276\353\361\026\3176\364\022L\033\330\342.\330}2\312\036\n\020"
+	.ascii	"\220\222\023\214C\253\231\201\325\202K\373\004\271\231\340\262"
+	.ascii	"\310\313\303\356`\365\312\301\301\001"
+	.text
+	.section	.gnu.lto_.pureconst.d1c81fdf4b442c9a,"e",@progbits
+	.string	"(\265/\375 M\025\002"
+	.string	"\322\204\017\027\200M:>\367\243f`f\220\251\037g\341\227\315E\215\344\230\"\264\003\243u\253\223:\247+\335\350B\367\031\235\261\2711\347r\225\233\334\343f\334\342\022\267\341>\023f\301\t\234\207\334\335\025"
+	.text
+	.section	.gnu.lto_.ipa_modref.d1c81fdf4b442c9a,"e",@progbits
+	.string	"(\265/\375`#\001\245\b"
+	.string	"\022M%*\2009\031\016\323\204\213\001\254~(\331\221f\034& #\030\003x\232\022jj\245ok\354\366\342C\306\225\216\021\366\201\376N2\005B\032\0362\001\352\3634\017\202\326\021Nh-r\256c\245\216\206\260\230\230\204S)+\334\346\215\316\202F#\345\214\341G\327e\236\217\347\343\344\226\312D\262\210{v\230'f\347\234\020\0164Pwy^N\f\235\267\024\n K\267\331xZ\236\352\340\004Z\331Q\236\224]\302srr\340b"
+	.string	"\365_2\035\317\310\243\230\r\005tF9 p\002!DT\007#\215\303\2310\201\276\013<%@\340]\032,\266h[\r\207\031F\350\347G\331&\0049V\002\303y!!\266\204\226\366\222m\325-\344\033Cu\323%hLqP\273\330\016\326+3\214\230\315z\326\271M\376\202we\013\222\0260\263\373\"B\325\033\264\350\340\201\261^h\333\350\354=\023\267a\352`\b\004|\030\273\275XK\\\242\b\227\331"
+	.ascii	"j\347c2\360\""
+	.text
+	.section	.gnu.lto_.lto.d1c81fdf4b442c9a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rxConfig_Registry.85.d1c81fdf4b442c9a,"e",@progbits
+	.string	"(\265/\375 \216\005\004"
+	.string	"$\007a"
+	.string	""
+	.string	""
+	.string	"!"
+	.string	"\005\001\212\001\202\200\200\374\342\203\374\241\035\006\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\375\005us\327\005uq"
+	.string	"\005\001\006'\001,\230 ?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\023./src/main/rx/rx.c"
+	.string	"\004"
+	.ascii	")\302\303,:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_rxConfig.86.d1c81fdf4b442c9a,"e",@progbits
+	.string	"(\265/\375`\325\001\035\r"
+	.string	"\306VU@\3604\324t\030P]\341n\343\024\261\024/4+k@r=|\025\230\200\263\0301#\345\016kJ\230\372R\214N\030\220\314E\214R|\262*\231\036\315\305@\341\023\025\337!\222\t\255\231\004\355\235R<"
+	.string	"A"
+	.string	"H"
+	.string	"\226\335\226\016\036\273f\003'\360\316\331<\246;\347\375\322\2353i\027\271\371b\017S\202\"f\333\335\257\2728yJ\372\237qJ\311B\235\002\230\260\273\246%K\305]o[\201\355\215M\305\347\b\234HL^J\202O\243\204\211\2360\374Swn\301\212\306\302UK\321\233m\242hma\177\262\273\353\332\262\377\372\251\205\223\302f\004\201\217\335\325m\311\3168Y\214\212\355S\3732\356\"\377:=\034:\320\227\326P\263\325NT\224;\017'2\016\200u>$\354\222x.$\200\215\317\201\204\027\320\177\2144\364\036\243"
+	.string	"\032\210\313\274\025\242\357\b+A\236\351l\3609\302\003\244\343\210\335\036\361\033\277\201\316&\361\032\243#\004\336@x\340"
+	.string	"C\006\013\024(\240\320\207\021X\241$z\366hJ\342W\022\277Q\250#\372<\"\351\323\\\f\206\370\210\237\b\020\024\277\212\271\237lm\371\302\221Y\252\2320\206\322z\363'\247\300\271\253z\271\301S1\310\234\263\003\037"
+	.string	"2\241\261i`\300\003*\314E\240\342#\b\004T\f\204\001"
+	.string	"'\214@\240^\242\004\202z\025F \240b \f"
+	.ascii	"pQ\201\030\241v\250\214\b\202\033j\331D\201\211'\353\241\346"
+	.ascii	"\205\214e\006\363.\0014\253)\340./\332I\006"
+	.text
+	.section	.gnu.lto_rxChannelRangeConfigs_Registry.90.d1c81fdf4b442c9a,"e",@progbits
+	.string	"(\265/\375 \215\375\003"
+	.string	"\024\007`"
+	.string	""
+	.string	""
+	.string	"!"
+	.string	"\005\001\212\001\202\200\200\374\342\303\335\322\027\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\325\030us\336\007uq"
+	.string	"\005\001\006'\001\020,?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\023./src/main/rx/rx.c"
+	.string	"\004"
+	.ascii	")\302\303,:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_rxChannelRangeConfigs.91.d1c81fdf4b442c9a,"e",@progbits
+	.string	"(\265/\375`}\001m\017"
+	.string	"\206\235hF\360\220*\035\322\264p\251\207AJ\306q\231\357^Aj\365\346A.\261R\241\357K\333\364\271wf\334\211\340\366\236x\222\2520k\362]\324e\023\272\211\364j\302!\f\210i\rnO:\3565\373M>\331[\356\224\002R"
+	.string	"P"
+	.string	"W"
+	.string	"\335;\270O\237l\032\007a{[\213\211\315fw=%ay\t\3362\236>\245\306\223?\373G\f\006\253\205\372\224\001n,\"\004\2648H\006.\230\333k\217'-U\224+(\327\327\236@%d\265P\0369\020v\327\221\325\372ps\267\375\331~`\177E\235\313~\316i\267|\264\306\350\030\243\357\361\200\210\361\251\261\333!\274\331\231\331\242\304i\267\017\372\265\024Wq:\3152\035\312C\347b\233\331\330\335\317\247\035t\237\006\344=\266\037\355\267\034\305\351\262\222\023\330}\345\210\331\005\027\370\243\3734x\017\3563*\341j\304\200\230\322_"
+	.string	"\310\230a\303\2419\tgc8\013\222\0034\273\333\300w1e("
+	.string	"\213}\372%\334'\002\330\215T\f\035\225\243\252_\235\270_p\327\250_\231P\305\320R\257\257]\336\304\\Lr\244b\250\352\202\271\255\250\246\330 *\352\353\306\342\212\261\276\354\242\227FD\022F\244\220\320\310\b\024\201Bh4\002M\b1}\036\026\0011}\236\351\363F\"P\005O\344+y \035&Y\b}\336\005\022\351\363<\340^_\376\354\335K\210\231\224\252\246\246\230\343B;\2525\361s\251'\266e8\251\227\321j6D\034\227\273\273\322\n.\265\243\032\002\035"
+	.ascii	"3\003\3769\204i@\272\266,b,\201\225\221Y\242\203a\320\216\245"
+	.ascii	"\236\360\264GDka\314\024\0023P\227q_\205TKh]\354U\021\250*\034"
+	.ascii	"\334Y\325X\263\022\035\334\213\033\"\312^\250j\274\237D:\327"
+	.ascii	"|\002"
+	.text
+	.section	.gnu.lto_rxFailsafeChannelConfigs_Registry.95.d1c81fdf4b442c9a,"e",@progbits
+	.string	"(\265/\375 \215\005\004"
+	.string	"$\007`"
+	.string	""
+	.string	""
+	.string	"!"
+	.string	"\005\001\212\001\202\200\200\374\342\303\346\222\021\032\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\366\030us\350\375\007uq"
+	.string	"\005\001\006'\001$+?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\023./src/main/rx/rx.c"
+	.string	"\004"
+	.ascii	")\"\301$:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_rxFailsafeChannelConfigs.96.d1c81fdf4b442c9a,"e",@progbits
+	.string	"(\265/\375`\366\001U\022"
+	.string	"&\343|H\320\322(\035\222\r\250\332\346*\214\005\f\326~G\225J/\227O@@M\006:\025dl0\375\232j\211"
+	.string	"\337\266\235/z\363\362J(\n\257\"\276\340\nW\027\370\030\321\007\"\004\035"
+	.string	"~\301\226$\227Q\033\331\233H\231Rh"
+	.string	"b"
+	.string	"k"
+	.string	"'\221\217\206\331:\256\353\231\037zA\033j\232s\206\013\302\002\376\351n\251\260\2032~\2530_\350'9\246\232\315\346\340\267>>rR6\332\307\022#\347\307yW\034\233L\245\b\211\333#\207\177\237\202\"\017BR\266\331\227\032AC\206\262]\320=\357\trD5\333\355\n6\230sZk\266\r\367\351\266ul\263\330j\022Z\200i\007\311\313c\217<\350\027\211j\360\273[~\352x\365\267\352]\265\252\372)\324O\215\224\336\234\032zA&R\224!\342\273\333\327\371\274\024W\001\373\316F'\033\235\023\321\320\f\036sN\224G38=\032\370\216\262}\265\377s \330\203jJ\002\314\331.\007\306\234:\025\237\234\036\255\373"
+	.ascii	"\371x\n\026rD7\035\300\265[g\001`'\246\275/.N\2332\240\330\361"
+	.ascii	"-\217\203[\216\035\216\231\002q\\{\302W\314 \350\231s.\360\211"
+	.ascii	"*\274\016(\205x\364k\344c4\252\365\370\306%\220\264+\262\337"
+	.ascii	"\376\306\204\336GRw\3677%\344\352~.hCb\332\263\312\345~\317\273"
+	.ascii	"\313\211\\\021\355G\246\275M\302p\343\303.\316\326\311\002\253"
+	.ascii	"\277\036\254bX\255\026\031\030\026K\005\241\005&F\365\222Y\251"
+	.ascii	"\\h\\%~Y\241q\2054\256\220\265RE\b_\\\257p\205\304-\t0\256\220"
+	.ascii	"B\253\345\nQ\272\330\227G\350\247\026@H\261\225\201\2133\270"
+	.ascii	"\024Gv\227\024\345rql$\345\2067\033\273\245\231\002\321o\316"
+	.ascii	"9\345\342\254\237\311g\244*\035\371l\374\214\004\027\307N\271"
+	.ascii	"\334\221\r\" @\002\204\030\026\017a`\357\035\232\033'\313\312"
+	.ascii	"\342\276Q\0205\312\244\301\206\360\013\350kLz\f-\370\252\235"
+	.ascii	"\265\335\377Va\343\231ZRh\016\250%\344Vw,l\320\315n\fPen;\233"
+	.ascii	"\260f?\035\3552XDv@\364\220\365}#\353v.C\006"
+	.text
+	.section	.gnu.lto_resetAllRxChannelRangeConfigurations.97.d1c81fdf4b442c9a,"e",@progbits
+	.string	"(\265/\375`r\001E\017"
+	.string	"\306\\gF\360\222(\035\2604P\240\t\377\020\274e\205\365\201\371\376K\035\265P/\004\374\016e$\264u\230,n7"
+	.string	"-z\305\022\270=<\235\251j\353\006\266\362\260\314\b\311\2649\317\364\324)1\265_\026\342\223F\366\226;\245P"
+	.string	"O"
+	.string	"U"
+	.string	"\334\247M\266\216\203'\3662\333\007Y\316\356zj\302\362\022\274e4}J\215&\037\366\021\327-\265:}J"
+	.ascii	"\265\030\022\001V\036d\003\326L\355\261G\325\n\025\345K\313\365"
+	.ascii	"\261+p\325H\255Z\036;\021v\3271\265\022qs\267\375\331\206`_&"
+	.ascii	"\177"
+	.string	"\375\362\341\035\377\272\017\362\021\260\220\305g\266\013\342\366cm\346\214\024\017o\037\364c.\376\302\364\3204\335)D7\223\335\354\330]\222O?\350>\021\310\207\330~\264/\363\026\246\277R\f\f\330\225PE\333\005\031x\244\3734\370\002\334gw\221\321\307\345\356\256\364\202G\365\350\207\006K\211\203\277v\372\311\301\242\002\025o\026@\323\360\030\036\230\036+\334\261\035\205\2637|\206\322\355\256\003\037F\007\016\007l(>\375\024\356\363\261'\200\341\221\203\243\022o\252\254\231\332\213\252\213\r\236\242\266j1,\232\265e{\272\242\237\210&\214H%\241\223\021HB\205\320h\004\242PR\372\b\330\344S\372\274\322\347\215D \013\236\311\207\301\373\210\230t!\364y\031H\244\317\013\001\367\332\202\275\223\201\303FEQS]\334\261\241\036-\325\270\"\311\243\252\036\273\007\247\346\206vj\031\245^U\246\341\242\376\025\336\254\004\035"
+	.ascii	"2\003\376\031\343\206\306\341\364\367s\267\346C\024\203\t_f,"
+	.ascii	"p\r\245\2100\225\307\215\265\027\346\242.\350\2762\tLT\246=\235"
+	.ascii	"\331U\006\250\312\034\264\263JX\263:\035\264\213\303\"\312^\250"
+	.ascii	"j\274\237D:\327|\002"
+	.text
+	.section	.gnu.lto_nullReadRawRC.98.d1c81fdf4b442c9a,"e",@progbits
+	.string	"(\265/\375`("
+	.string	"\365\007"
+	.string	"\362\01677@o\323\001{\r\314\001 /\361\005`\330\320\276\207\317\260\270\274o|\275\032{\215d\026\366\026\t}\022\215\302\361d\225\222H'-\231\022\265\276\2415\372\277\233\020\231R\020[\327}\036\264\214\003\327\320y\013\033\210\013u\023\f\237\f\260\326\371d\374d\354\270\017(jR\"v8\366\"6\031C\236'c6\367!F`Q\215\354)\322\352d\337\332\312dk\006\263\022Sv1b^V\345BA\331\006\355\314\266\245\266\007\001<\t\3057;b\351\360\250\332\027\371\b\370Yq\201]S\352dw\036\270@\363\313Sc\333\3778\b\350P'G\006\300\311\345\302$\265;\343\346\003\330/=\007\373Um<\274\206\376Kny\240ZH%\3215\243\260\273VRI\343\256n\333\300v\202\355\220\f"
+	.ascii	"2\003\202\341\243\302^\025\220kx\227E\3531\241\301\\\201\n\007"
+	.ascii	"w\215T+&a\222\001"
+	.text
+	.section	.gnu.lto_nullFrameStatus.99.d1c81fdf4b442c9a,"e",@progbits
+	.string	"(\265/\375 \2755\005"
+	.string	"r\211#+pm:\240\253\016\030\375\272P\274\250\273\320\240\343\306{\251\306f\037|\\\272\r\376\222\252\212\206~\231}\030 \024Q\301H\366\226)\307.m\2626Y\362hD\030\233\024\276\n\317&\216\311\225,\233l\325^\0320X\344\345\257\\\224\234\177\253\356\356\313\315\037\t\032\323b\324\375\245P]\002\210>\377\267\337zB\261\235n\365|\203\016\323\205N\335\225eg\351F\372]\320VaH\362@n\243\200\321\335\217\036\230\331\313\375\217\370\177\370\017\t\b"
+	.ascii	"2\003\202\341\243\302^\025\320\\\363\226\020$\3349S;\237"
+	.text
+	.section	.gnu.lto_rxInit.105.d1c81fdf4b442c9a,"e",@progbits
+	.string	"(\265/\375`k\n\2255"
+	.ascii	"\352\\D\024>@\350M\007F\211\275\021\b()\251By\306}\273GP\214"
+	.ascii	"CXD\222\345\b\255\377\345I\\-\304\322\300\017z\210\226\275\213"
+	.ascii	"C}<z\345\357\013W|\032\314\375\321\215\354n{\357\224R\n3\001"
+	.ascii	"\"\0014\001H\236\226.]\212\347K\303u\273\351n\3663\277\341\216"
+	.ascii	"\213\323r\332\206\373\261^;+\031\\\242\274{\233\007\326N\207"
+	.ascii	"\016\244\337\260\2037=4\314\375\306\034tr\260\323\341Ej\021\004"
+	.ascii	"\206\233\311\335\206\203\334n\315\246\355&"
+	.string	"\317U!\233WiA.\217\311\240S6\260vZ\325F\265S\264\211j\247,\244\231\314\200M\321\222y\357\r\242\301\226\231Q7\327n\303\261\031{\263w\357\315z\265b\2618d\250F\233\315\350\267m,\022\241\236\206NML\302 \220]\177j\212\276\267\334FC_m\354\322\305.lN\344\322P\350\202\274;\222\272\316\214\013jD\342%\331m[\374\t\375\260\275)]g\246\005\265\3007V\250\235P|\230%\311Z;Q\351&\246e\013\317\342\246xP\214\231\024\007\326\231QA\253\336\332J\214Y\024g\235\255@P\230+I\326z\265\372\3752\\I\362\244\325&\345\030Z\325&\346)\372^ \031iR\206\241\026\356\030\321#S\036\035\r\263\244\277\333\264\353\261;\332\305)\227\264\3772\334{\331\223\312$\315Q\315\334W\230Y\0053+#\334\241\tu9\335\335{)p\017\352\272\366L\233\246mk\333"
+	.string	"%\037\365\373\367X\037\230?\327\264\240\226\315z/R\0027\240\016\244\201\203\007\017j\247\375\335\246\023\350\331Qr{3|xu\317jY\225\376\240r\367i?\037@\210\020\241v\372{;\204F\257\271T\356\271\336\303\305\315\306$J\224P;M\311\030\332\3233q\"A\212\306\243\342NG\221\343\223\\\301\002\301\335\275`\235dn\321t\\D\255\335{%p\313\365\234\027\334l\235\262\326\226w\262S\356-\265SvI!\247]\\\0230\17727\217\376i\314-\365\245\r\035?\032s\205\t\021 \b\235\037\004\235\033\004\235\257\204\316VA\347\252\206k.\320n\232\251\272\331L"
+	.string	"\350<\200u\026"
+	.string	"t\016"
+	.string	"t\236b\235\245~\316"
+	.ascii	"R\347(\240\263\021\350\\d\235\211\2503\024\352\374\004t\036\002"
+	.ascii	"\235\235P\347&\324\231\t\350,\004:\007Yg \353\314\256\316+\352"
+	.ascii	"\374C\235\325\237s\252:\243\252\363\247\316\216:\267\205NSe\317"
+	.ascii	"\321\2108\367\006b\313\251\376\2412}\323\267\230\030\3413\375"
+	.ascii	"G\032\353\303\352\340\013\177\352\022\373\301W\237\320i4\326"
+	.ascii	"',S\331\357\270\3665\2651N<\246\244\207DN\020\370\354\277\233"
+	.ascii	"\363\017\322\371\212\270XX\253L\2458\322\217\300\3679\210\334"
+	.ascii	"\310\374\253-\343\026\211\337V\371\314\364\331\367\035\250\033"
+	.ascii	"\322\035\0253`\313D]\337\313\211\b\351|J\272R\313d\204\032\332"
+	.ascii	"\222\331p\23074_\353\204\375R\266\347\207\271\327\224Z(R\332"
+	.ascii	"3*j\247\353\367[+x\323\263\263\343f\205\3754\366\337\325\247"
+	.ascii	"xj\203\257z2\346*\254\226\324\305\024\211}\002\346Ot\375\375"
+	.ascii	"\225\225\206\364\350\367]\347\367\r\336#\3455R\377\202\026\241"
+	.ascii	"\023\272<\365\3238\207\232~\253a,\257\272\334\246\265j\336\311"
+	.ascii	"\364\273\255{J\2363t\310\377J?\215\177x_\341\037\317\0314\201"
+	.ascii	"'\3439\225\300\267\233\023\017\351|]g\013\233\033\364\252\t|"
+	.ascii	"\205\017\"7\tE\364\201j\315\256\357Z-\\\332.]\3368[\267_\324"
+	.ascii	"\177\364S@b\313\243?9\2013\267c\3322\336\311\177\004J\302\320"
+	.ascii	"\035\377\213\375\231\003<c\006\226\216\255\0307j\270\320\362"
+	.ascii	"\312\322\2221\265\305\203\306\213\036iW\263\026\226\017\257,"
+	.ascii	"\037^Y6\272^\324\310\322\362\322\221\205E\344\0338\266\274\262"
+	.ascii	"v\334\270\341\225\025l\202\365\243\261\023\005|\207I\263,>x\253"
+	.ascii	"'c&t`\177d\253\347\236s5\256!\225J\030\321\346R\245\376\301\267"
+	.ascii	"\330\362X\034\360\001\276\3058\377\b\370\001\227\034\215ku,\002"
+	.ascii	"\276\217\364\324\007x\325\220\324O\ry\272\225\266l\255\"\365"
+	.ascii	"!\274"
+	.string	"\240-\327\270\021\205Q\232~\306\206\321\301\340\315t)[\030\330\024-\345<\312\032\177\342\241\013\340\231;\032a6 w\302\355\261\r\363N\262p\317\031\272\260\377Z\303\320X\201\372\264E\r\340a\364\005\260\032\032S\205R\336\223\323\204\177\274\225AS\025\251\320{\357\035R\375\204og\243\226\346<\335\351\323\270\317$1A\370^s\026H\030\341\013D\241pe\227\321\315:\371\250\300G\275\324\334X\037X\361\215\377[D\374\342\367\230\227\265e,\324\356\214\220\021?H\346R\03270\1776y\221\206z\bN\244\237\036j\370OW\355\364\303\237Z\004|\247'\323\017\331?\324\246\217\360~)\200\313\250a4$\221S\204fFD\322\244\222\306\220\002\231\241\"r\003\021 \245e\016\rI\223\346Y\212\317\223\337\326\246P\233\344\025/V\352g\366\260\315\327i\\\366|\355r\b\004\006\027\274\315\257\235q\253&\314"
+	.string	"\206v\264\361\340R\325W\340\031sr\360<}\024\370\355\246<\311\277\275\217\344\375D\261\271oAE[\353>\036\032p\366\355\340\374\3539\330\375\"\263)\373\325w\003\311\266\343\202Xn\2356y\300:_\351\201S\236\334\016\251\244\340\030f"
+	.string	"\231*W\335\242\370D\267\266.\017\033\bO`\002\241\354{\375\203\013\335\335\373@\212\004\253\n\354I\324\305W|2\030k\005\023\3475I\234_\374\310~L\230\255\356*\325\345R\207\202\326;b"
+	.string	"\n\300?h\0071\312\036L\332\003\002\360H;\310 Q\022\224\315(i\031/\343\027\307\221\301\3618\242qp3\207\\\305c\372\241W\220\3373\332\024\341#\230?\374\325o\006\034\2627w\202j\311g\211wbW\274\355\201\352\253\264\257q\260\271\017\344\223\321\231\033\243/.\251\336\310q\2009\313\243\201\245\033\377\321\2616\330\004\303]\254\326[WW\032\377%c\262"
+	.string	"\261T\375\330\007\211\277<?\217\232\263(\263)\365\0307\2558p\363\016\220\206"
+	.ascii	"\340K3\370\257\340\246\235'?X\241r\006\370L\250?9\263\366\016"
+	.ascii	"G\374\217\222=\341\377,\230'\357\222\365\265\215\017\007\235"
+	.ascii	"|\253\341\311\317\215\004\373\317,\223\255\273\237\203\370{\035"
+	.ascii	"\224\n"
+	.text
+	.section	.gnu.lto_rxIsReceivingSignal.106.d1c81fdf4b442c9a,"e",@progbits
+	.string	"(\265/\375 \3365\006"
+	.string	"\202\013+3@o\222\016\2305\220r$\253\004(Ds-\366\317\241N|>\276$\342o7{@h\204\004\"v\210v\f\b\037f(\270\321c\370\2661\333\332\3362\005k2\233\3066\215=4,80M\213`\031\201)\b\206\306$(\2521\314\225E\321!\301\007)\276\"\035\251\256\307\023\234\253\325\351r.\235\016\0030>7\372\313s\250\361\225\022E\377}8\220\221\242\240\222\t\032\265$\312d\362\361w\036\363\001B\347\252\027\007\250\035%\025$,\231\027\303\215V\275\3526\244\022\310\311\212\025\362\364"
+	.string	"\0222\363\263B\027\035\373\033\374\005\277E\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_rxAreFlightChannelsValid.107.d1c81fdf4b442c9a,"e",@progbits
+	.string	"(\265/\375 \336-\006"
+	.string	"\202\313*2Pm\222\016$\243\252\302K\264\267T\325\272-\271\322\363\346*{Kv\325\376\335\316\356\b@\205\032\217\233\231ic\250\200\025\222\2008x\352\260\255\355-Sg0\232\3064\215=4,8\260L\213`\030\201)\b\206\306$(\252\261\313\225\305\320!\201\007)\276 \r\251n\307\023\233\253\325\351n,\235\016\0030<7\372\253s\230\361\225\022C\377}8 JQ \311\374\214V\022e\032\361\3709\177\371"
+	.string	"\201s\325k\343S\216\222\n\021\225\314\213\241F\253^u\373QIdrb\201:=\200\204\314\374,\320E\307\376\006\177\301o\021\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_suspendRxSignal.109.d1c81fdf4b442c9a,"e",@progbits
+	.string	"(\265/\375`F"
+	.string	"\245\b"
+	.string	"V\220;6@S\323\001\230\254\034\345\303\260!\366\2369\305\314z\216\204\027\224v\005\363\255\003\221%z&\261\210\243\340\260\266B\3118Zs\314\215VB\211\271\252\307!B\244L))"
+	.string	","
+	.string	"-"
+	.string	"\276\307\234=s\360c\257\022\203\201\242\263\273Q=\316=9\377$\027\370H\335\023 aw\235\037I\343\326\333F\260}`\033'\027\034^\236L\245MQ\221\377\256\006\033\246\320\323\316\006\273\324\016\373\324j\311~:\237~@\001\315\313\002\314n\306ig\303j%\304\016\3329\177Y\276\311O.\007\f\263^U\"9#7\251~\311\301\314\007q\304V\371\233\365JY>\233Q\236lSJ\370\t\353\232J\311\004\006}DZ\024i\361\341b\300\"H\333\342\207\300\031DH\213\022Y\246E\017\270\247VK\n5\341H=\017df\331\241\206\374\347lq\t-\002\r"
+	.ascii	"3\241\365\037\370iw\370B;\260pQ~\020\265\n\237Z\320\205\034a"
+	.ascii	"\260\3772.\270t\213v>\001"
+	.text
+	.section	.gnu.lto_resumeRxSignal.110.d1c81fdf4b442c9a,"e",@progbits
+	.string	"(\265/\375`("
+	.string	"\255\007"
+	.string	"r\01645Po\322\001\203g\202\334\252\265K!^`\340\367\252 \211\272l\245\305\201j\215\b\206\277u\373,k6\356\211&3D\f\241\305\024\t\364\2317\226l\"eJ\001\346lD\361\211\342k\350(|\036'\202\336F\300\320a!>\b\b\343\323d{j\325\204\260i#%9 m\206N\036s\232\300\344=\225\017\362\020\317\007\302\352\316q\304\234X\256\276\307?\036|\r\203B\316\017UwZ\202\255\214r3\225v\204D\036\273\022X\264h$\275\354\354J\275\260O\255\232\354\247\237\031\210II@\331\245\330^Vs$\033\266\257\261e\253<\313\330\217\270L\210\234v\367)\306\255\247\345\277\343"
+	.string	"X\351zf\016v\327\211\225*n\275m\003\333\005\266O\002\r"
+	.ascii	"3\241\271\037X\314\216m\241\021X\270(?\210ZU\236\353\271\220"
+	.ascii	"\323\005\353/\343\202K\267h\347\023"
+	.text
+	.section	.gnu.lto_rxUpdateCheck.111.d1c81fdf4b442c9a,"e",@progbits
+	.string	"(\265/\375`\374\003E\031"
+	.string	"\206-\236G\300\332(\035@4\255w\333h2\203\245$\314"
+	.string	"\315\257\327\220>\255\234"
+	.string	"\n\221\247\302\324\331\201^\032\033\375\177sS\307\202\304\364\332z\253\375\024@eC\221!\305\273*\226Km\306\250~X\004\362\t!{\023)e\n\211"
+	.string	"{"
+	.string	"\217"
+	.string	"o]\n0Kj\255\n\276@\334y\346\177s+\264\263C*>\326z#\267\244V\235\202\033\020w\236\326Dw\202\033\200\356\374\177\006\rv\376Z]\016\237\335\301bV\344\250V\035\252q\354kI\243\030\322\t6\277\276!\004\220\214\2272\264\032lI\033\233\261\343\f\321\212\013[\001\037.dp\030c\351\214\327\303\023\306\202d\215\207\033@m\005x\252\265\356\220\345\0265\031s\b\241\326z\246\325^\354\311\375/\344\377\204\277\271\004\337\027\335\376\260\343\302\303g\376\355-\321\353\253\343\"Z\274\264\235\337\026\335\271-"
+	.ascii	"\b\350&d\213\361\357\327\301\270q\377\202\265\177\376\363ov\267"
+	.ascii	"7\355\320nI\344\327L>y>i\362\307\311\027C~x>\r\371\363|\220\362"
+	.ascii	"{\362w\200\203\334\255\306\016Z\033\351\252\317\017M\2452\233"
+	.ascii	"\360\330\335\376K\344\313;\371\335\2358\301t\325\247C\22709\004"
+	.ascii	";\037A\334\271\377\316O\376\001]d\241\005\026\241\211\211E\331"
+	.ascii	"\260\301^\336\202=zXvFDO8\334}Q)a\017\013\020\037%@g\327\b\372"
+	.ascii	"\355\236\240\246\236}\236\331d\374\273\211\337m\352\245aC\326"
+	.ascii	"\260\377\031\026\212\006\261\326\352\340\353d\237l\370\352\330"
+	.ascii	"y\016\036<\320\235\335#\202\216nBC1\3761I-o\031H\220\357\226"
+	.ascii	"\363M%\252\r@Tn9\337\032\331$\241\026\242#\337\202\215{\251\271"
+	.ascii	"\313]\321\221E\262\n\301b\321\235\334\341\017\242 \\k\205u\343"
+	.ascii	"\002:&\\)\227\205U+U\202 S\256\021+\t%\035\f\253\026\353\202"
+	.ascii	"\213\304\252,M\250l\256\302AQ\242P\224(\022\254T\013\245*uP8"
+	.ascii	"\001\236SbU\242\\99%\212\324\325\355\237\263\210`yL\2605\335"
+	.ascii	"\342\377M\237b-{M\337\364\316\322\304\370GI\215\373n\217\375"
+	.ascii	"C\026\361\360\031#\nd\343la\261q\244\336/YH\275C\366@\317(\210"
+	.ascii	"-\034\373J\251\305\036{{n2\376UYU`\211m\323\223\305\214\215N"
+	.ascii	"\021\321ch?\360\022e\326\004\fW\250QL\347\22423Ba\222\244\244"
+	.ascii	"\240m\300\202\231\251\242\007\020Xf4\206\034\006h\217\300E\311"
+	.ascii	"\204>=\257D\232E\031A6\201\355GVu\346\310\013z\233\231\215\330"
+	.ascii	"]\272CL'\302\222\254\001r\344F\301\356\231\360?\266U\310\323"
+	.ascii	"\035\321p\226&\355\227\021\247Z\031\205\264Z\017'y\225\334\307"
+	.ascii	"\nYS\227\301T]\216aBZV\211i\t\247\016\225?\t\302\345\327w\301"
+	.ascii	")(\235\224\003\324\020X=\220\337K\257\305\372W\037;;V>\354\241"
+	.ascii	"\213x\340V\374\201\207\225\2279/\025r\316U\206p\241\320V\350"
+	.ascii	"\367\276\n\2047\263\322"
+	.text
+	.section	.gnu.lto_calculateChannelMovingAverage.112.d1c81fdf4b442c9a,"e",@progbits
+	.string	"(\265/\375`X\004\275\034"
+	.string	"\246\363\264H\240\232M:\304\007W\256\177i\f\261\353\242\247\274\350\031\201\030W\216h\300\376\007\317\366\306\372\363\317%G\374R\224s\347\377\361\206\241VA\340\0229xQ\316Q\246\335L\225\351$\250\221)h=\2204B\b!D\356\224\002\240"
+	.string	"\221"
+	.string	"\245"
+	.string	"\256\221\017\351\317#\212S\225v.\f,\265\03140\272\221\"o\255=\237\223ZO\005&@><\221[\031\371\210\236;\236b?\2520!\t\253\365\264\341\234&>\244\017 >\\\035\336\203\347=\322\243\227\344(\206\340\322#\037\351\345\350Saj\005\031\034/h\234\004q\266<A\201\013(\013\336\022\035\201\314\2708\372h\375\200\317\327\304\233\3610\306A\360@\017\013\f\031O\t\244u\345"
+	.ascii	"\363 O4\350\232<\025`O\255\365X\247.x;JG\237Z\253i\023\357\305"
+	.ascii	"\035\273\355*\333\024l0B\377\260=\250\324\364\212@%\321\237}"
+	.ascii	"\"\321\225\262\377\0326\272bx\243l\036S\357\374\374un\344\247"
+	.ascii	"\375\352\3161\365\354Y\267\254\244\276)\251mJj\323\244\216\231"
+	.ascii	"\324eIM\232\324cI-\306\250\303\222\032\\\352]jJR\177\300\203"
+	.ascii	"\250\336\215\037V\326\353\254N?5UK\3105\365\254\377\352#\025"
+	.ascii	"iH"
+	.string	"C\373\366\217\370Z6\215\344I\214\236e)=Jg\345=\360}U\b\344\303\036\360\266\221\217e\323\366\025\212\036\244\263:]\b\023f\205\340a{\255\027\240\372Uq%\321\337\256\270R71\313m\366\365+\307\202aH\203\006\361aM\310\230\236\225\231Zk\rW\312@\"\2251\211\23203I\364\307\240\214\023\025H_$~y\204\020\301\312\242D\323\230I\2131Jv\245\f$\206\333\001\013L\211\246\261\017\345Q\200Jl\240o\332 >\fwe\234A\003\005\256m\242?\271\351\330Nq'\034f;j\255\016\232|\353\307\367\361\320'p\270\2462:\013n\310$gwO[\272\031\304LaZ\263\037 ~s\366K\\\273+\371\222\"\337\207s\037\350\233\036:C&Q\316C\220\004\013&\202r:\335\t\034\200\234\b\022#~\206\304\240\037\0208\320\270\032\221\316F\244\263\005\205\370\031a\303\351\206l\265"
+	.ascii	"\026\"\221\323\331L\b\t\351l\346Y\277Q\236M\255`\332\"w&\264"
+	.ascii	"\3601m\255\316\316fk\237\244\335\2257\273\263\027 \332\354\315"
+	.ascii	"n\230\245!\273/7\022\314f\217\365\002^G\252\270\310\225\362l"
+	.ascii	"\210\310\263\013\026\"\270lY(\270l\251\230\203c\202\313\226g"
+	.ascii	"\177\306\3473\367\353F\373\362\212\255Y\356\270\261])K\275\035"
+	.ascii	"\375\231\334\262\303\275\334j]8\030\340Bn\215\007\227\270c\327"
+	.ascii	"\215\324\"\006X\250A(\245\fD\304 \245f&\224$\205tp\002\031*4"
+	.ascii	"\017\020P\250\206&\351O`\305hWk\204?m\370\217\207c\351\004D~"
+	.ascii	"'\370\204\251!\347\231&\323\344U\214:\252\301/\226\002\353H\233"
+	.ascii	"\332Ab@\n\233\367'tc2\2660%\021\2355\362E\252\001\303W\355\210"
+	.ascii	"f\2361\226r\2133>\330%\024@\016p;Y\327\004\2718M3\021A#\3076"
+	.ascii	"|\321\270-\2072x\260\033\034<;\205\243\256z\340\316%|\226\247"
+	.ascii	"\254\006\270hl \005\034N\377o\241\360\33711\216\205+\301\220"
+	.ascii	"n\215>R\273\373L\257t*\203\250\027\242\336\264\335\345\316\270"
+	.ascii	"\373P\277\250N4p\352o\035\377\001"
+	.text
+	.section	.gnu.lto_getRxfailValue.113.d1c81fdf4b442c9a,"e",@progbits
+	.string	"(\265/\375`\216\003\205\027"
+	.string	"\206\352\222G\260\030U:\340y\246\335\202\257P\201!=\221\271P2]]c1\236\314\242\"\230e\3628\224\326c|@\275\312w\377\330\007I\217\275\300{Y\371Z~\311X\001\305\343\302\274Z\222#\370\253\233\266\226\020n$eJ\001|"
+	.string	"w"
+	.string	"\202"
+	.string	"=\t\204\263\210\357\214\362\t\031\272\215c\233l\257\332\t\024\340\\\367\362\316y{\242d\316\335\001\023\030/m\373:\236\3031Lw4P\224p%hA\206\346\334\245`.\023^\352c\302\313\235q\330G1\224\243U\230\037\373h\302\345D\b?=\341e\266\313\363\270\204\037\027Z`\250\260}D\"gi\263Pf'\250F)\205\316\252H3\347\264\326R\250\270I\267\275\302v\003{q\001Z\233s\356\246\001\323\213\034\005\332^=\b\353A.w\313\315\231\263\340=\354\021\007\242\201\2043\221%Jn\316\311\300\307\177\324\3706.\315\301\203\276v\351\267\2264\303\207Hg\332\357y\\\026\ra\241\001e\032\264w3]\031\3667\030\fr\361\306\260\255FY\375b\365\351\272\337du)T\223B\365(\325\242\250\016C\365J\265\256\37203ETn|s\236\b\026\315\341J\237\024\" !\277\025\037\023-\302"
+	.ascii	"jS\250\240\257\355\356\306|&\007\300\333\321\223\026\016\345"
+	.ascii	"\302\350;\371\023\f\031T\372\232*\274|)\340K\362\237\233&\246"
+	.ascii	"]"
+	.string	"\030h\2612d\324\304\017\332\277nJ\276\344@\376-\013$9^\257\360\362\277\231v\244@\177\310gxz1\355\362\235\240\235&{\304G\242:x\346\013\"~\021\377\306\017\b/\255\265y\302\3063\3474p\037\333?\321\211m\316\330o\277\336\320\201ec\243\332\260\022\275Bp\343J\335\270R65*\017\251\225\013D\nA\214[\037X\256T\210V\313\2252\355d\037\315\215\341\367\b\335B\024\016\241$\342i=\222K\"\332\302\033\275liK\330.\255id;\033\3159\347(\177\207\205\244=\355un\002\016\013\307%\355un\3144hq\307\325+\016^\205U\263#\013\225\236\270'\026\274\036\235\221+OH\f\027\265\247\001\315\2030\372R>%\202\204\t\023\302\313E\250A0\342\224d\212\220\320\004I*\245\031\003\200\002\021\"\263\033\021P=\203l&,\2644\006x=X\253\357\323#M=E\357\220"
+	.string	"VJL\323c/xl\021\013\033\341\344\205B\215\330\327\273\334\331\236)\214v\006\273\017\022\213n\342L\363.rq&/\220\237\217s\003\333\311J8\320R\301\320\213"
+	.ascii	"\022}\274\024\307R\230Kv\253\351\264\\\362\265\237Fp\001(\016"
+	.ascii	"Y\220\234\200o\"?\200d\302\246\316\310XFF+K\306\332\b\365\253"
+	.ascii	"65\0322\355\235L6!I\254\361\356\203\271\320\341\230\n"
+	.text
+	.section	.gnu.lto_applyRxChannelRangeConfiguraton.114.d1c81fdf4b442c9a,"e",@progbits
+	.string	"(\265/\375`\273\001\255\020"
+	.string	"\306\340qF\360\356&\035\n< \356?\342\316\322i\226\376\235\352\330\364\322\250"
+	.string	"\334}\277\020M\371\005\302\2702\273\271\361\fv\024`\361CFw8/4\003\317\221\\\330q9\031F\344\177\375\304\344\300\264\221h\226l\"eJ\001^"
+	.string	"U"
+	.string	"]"
+	.ascii	"\036V\017Md\215]\013GB\273+\342\002\246G\020\315\266\317\363"
+	.ascii	"\016+\2632\274 \001\300\216l&\366b7\354:.`{\314{l\217\252s\326"
+	.ascii	"5M\226\037sM\201\f\0224/\nW\355\003\247\002\022\352\325\322@"
+	.ascii	"J\024\315<\366\254y\2712K$\273\353\244yM\270\343m/\260\315\300"
+	.ascii	"N\220V\034\243\234\336\310\364\351\341\315\335\347\327x\370\227"
+	.ascii	"\234\216\231\326bZ3\2351}\216\217\r"
+	.string	"&\036\214\330\2150\213\261Eqh\307\366}\240\313\\\376c5J\301aw9\027\233\373\312\346l\353\207\367\254\356\0033\240c]=<B\273\241\210\017\230\036\035\2322\355\303\036?+Z9\363)9\204J'n\242-U\323\222\332(\016\3624\234jk\2431V\325\274\207P5\200\001vM=\213\231\031\376\016\202\305\264\353J\340\007\245\250L\273\373\f\217>\314\366x\335\3201B\202\311\344\354I73\231j\216\021\274\2446\260\235\036\024\256L\262\303Vj\216}mw7>\031Q\235\264\244\274N\345\363\274\257\204\200I\003\225\024\030MRV\274\224js\311\310\013\330\275\200\235\nJ\312\353J@U7\342\341o\305\004\354Z\276\017\354\270P\346\212c\026\030\0324n\220D\244\317\332\242\326\330\216j\022\031mi'\335\320\307\036\002t\3242\002\232\021U\240\364\244N\b-\002\004q\212\322\313\0362\024\253q\021\036"
+	.ascii	"&j\345a\205\006\306\006ut\335\366\232Z\253>,\256\271|\347b=\267"
+	.ascii	"\231\262\034\210\007T\251_\202\237\251{E5\307W\373\254\225\270"
+	.ascii	"\260\026\031c1\250%4L3\215\361\200\r\320\204M\241\203v\001)\001"
+	.ascii	"\245\252\201\346RP"
+	.text
+	.section	.gnu.lto_readRxChannelsApplyRanges.115.d1c81fdf4b442c9a,"e",@progbits
+	.string	"(\265/\375`\312\003\245\033"
+	.string	"&\264\263I\300\226M:\246x\376f\004\020{d$\230\235\f\030\313\200\235z\025\007\251\"\220\326|\312D\346\327<\364\237\216\033^\257\266T\016S\332\271\033\f\201)\260\305L\371\321\254\303`\267\337n\037j+\233q\033\226\020\262\267\334)\005\235"
+	.string	"\226"
+	.string	"\244"
+	.ascii	"\3479J\344\021\022\235\210\364|\265\326\005\247> \236\322\034"
+	.ascii	"\006\236\316\277\300S{\307n\235\276\345\232M\345<]\r\217\244"
+	.ascii	"~\230\266\324Zckd1\300'\357f\311\332aXb\b\322\271\262\346#\375"
+	.ascii	"\300\257\312\210\3439\314\f}\202n\234J(\306\224Y\371\240\256"
+	.ascii	"t\223\254PB\215!\030\027m`\306P\321\303\251\300g$\313\251\204"
+	.ascii	"\212&,\350\306\370#A\242S\030\034\321\247\f\316g\3224]\002\341"
+	.ascii	"z\344^\351\364\250ge\306\020\214\313PB\255\325r\304\r\335\255"
+	.ascii	"\333^\262]\301^\034\001\017B\302\267q\352\0227\362\343\251\177"
+	.ascii	"\003\236\312,\013\312&\177w\022\245\307\323\334\234\303;\n\f"
+	.ascii	"\367hg\264$\325#\255\326\t\211\017n7g\363nR\246\263\362yi\330"
+	.ascii	"\260"
+	.string	"\227(=\343\n\245eB\351\230P\232u\246[<\357\016\2474\bJS*=\247\364Ni\271\322\027P\300jjGK\255A?/\265\t\205::\323\317\273\264\357'\375i\347N\246U^r\324Z[=\374\246\245\373\250\235i\205X\213\210#\021)\276Zy\n\304S\227\374\016_\351<\276\253\005rfwm\f\031\344\307\227kw\337t\004U^nUN\177\372\022\r\333\373\370'%\033\246\017]\255U\206\344I8t\360\340\001<\235\331?}j\231\302\"\344\305\017\"\242\243,.\302\315Y\322\230}\322\225\214)\263\254\005j\360p\t\354v/)\367N\217\232AxR\253\355\343\221u-\215\317\362\230\265rW\352\347\213?\034\n\204Xk}\340\027\271\221\02053\371q\006\236~[FYt\360\260\311\337\0047\2671+\257~\276\330\344O\322\315Y\347CN\234\351I\255=2\333\346BDD\320\325\332\363"
+	.string	"H\036acB\347\246\006\005h\302\006\007\247f\304,\364\314\201\nZL\005-\206C\242\346&6\243\241\2109x9G\307\206\026K\221\223C\213\265x\266/\r\244\213\275.Ml{\263y\267\313tV>\230\315\031\300\017\021\266\013E.x\270@\006\227\002\023\272\340\376S\247\252!\3716\\K\252\355\344\307\332\016<\245\tpT\341Rd\223\277\233w\373\254\265V\326\346|\035\277\026\341k\337t\326\224\253!\240kE\006\017\027\266W:\335r\365c!\343&\177\236\353\336\004"
+	.string	"\276\324\231P\260p\341\302xE\334\271:\277\2368 F\2501\034\2061f\224A\002\031\0211\231\222\246\003P\0021\212\331y\020hY\f\2633\0067\372\221\321C\013=&\232.\226j<`\276\356\177\300\364\330\323\200\264\003\373c\203\326\301),\3652\006\305\260\366\366\334\306\016\023\r\310=\242\331\302pZ{\376\313(\234\373\\\212\334\2502`\265\227h\006z\200\306\376}\214t\260\327\276G\302\274T\2572\300\307Z\252r\204P=\207\\!n\354\017Z\033\n\277\035\021f@"
+	.ascii	"\254^\n\213\005l`\227Tk\242\360\324Yn\374\344\005J\307\356S\024"
+	.ascii	">\230hH\003"
+	.text
+	.section	.gnu.lto_detectAndApplySignalLossBehaviour.116.d1c81fdf4b442c9a,"e",@progbits
+	.string	"(\265/\375`6\rED"
+	.string	"\372t\250\031=@\246\326\030\314\301\307e\350\2715|\244\035\013\305\210\213\n\211\207\234C\n\307$\032\267"
+	.string	"\237\246rc\353\221\275\230n\367\366\210\017\275\r\365\232\037\007\341\017\021\342\266\334r\033\021IRJ)\220\001k\001\212\001*\210\315*y3\333\256\343\326\343c\036\363\r\257P\300w\004\021\207\232^3\326u\\l\326\275\215\235i4d]\307&\354\266\220q\333\365\035\363\221ut\035\017\335\334E\232\312\275\357{\324\301|l\266\3552}\345#K\240\340\266\031\036UM\353\233\326\272\0059\223\301\332\243\312\314\372F\217\316 s\344\002\337\327\312\240Y\206@lgn\271\256\272=\347\203\213\357\333\026\250\367\276V\007\\\200\330lU;\265\315\n\233\3316\313.\263\241\266\276\275C-\203O\273\300\367}\257~\212"
+	.string	"fj\241\2659\352\335\036 \200*"
+	.string	"\200)\251(\250'\247&&\323\222\322R\231D\036\215E\342\260e\205\357.\3670K\350\2266\b\2156{"
+	.string	"\335\235\252\013\220\2626\327Tw\332"
+	.string	"Z\240\234\230\266\265\271\016\320\272\241\351\3215"
+	.string	"92>%w\035\343R\302\341\217\264,\315GM\214\020\353\021\340^\353I=J\312Z\\C=ii'.jY\260x\023\323\2574S\225^\252\"\207\212+]\351\245\320)-\013\264\371\250\275\t\027"
+	.ascii	"\272i\324\\\324\234\270\322\n\037\265\251'\t\264\255\2615\222"
+	.ascii	"\213\032\233\037\233\324a\342\306aV\333\332\222.\362Q[\"\254"
+	.ascii	"\342k\002\\\324\2248q\230\245\327\254\033\024PN\260m-\256\207"
+	.ascii	"I\272}\002q\366\030\375\201\026\005\342B#\375\312\250\231\260"
+	.ascii	"\352}\337\276\266\237E\235\356\303\254\367}\331\241\321\265\346"
+	.ascii	"\252f\366\026\314\354\305|$\013M\bM\345\026\r\237\312\013\246"
+	.ascii	"w\214\264\037E\370[\205H\b\237*P\263O\355\353\377\030\203\376"
+	.ascii	"%H\331\b=\020\211?\023\376;\244x\202\322~?(\032\232\250\371\264"
+	.ascii	"\037\017\356+\254\202\2057\224E\333l\177\016)\236\030i\231\017"
+	.ascii	"\0060R\215\373\2472\217V\301\177\263.\314U\220\231?\342!\240"
+	.ascii	"\366\321\036x\253\237#\265\273\376\335\215q\372 3\235\255\315"
+	.ascii	"\366j\271\327\270x\341\rU\360\275\246\211\202\325W\020\320\354"
+	.ascii	"\233\314V\247?\225\271\261\336\036\001\362GaN:\213xg\020H\347"
+	.ascii	".\244\363\007\2443\027\322\331\303\322\271\303\322\231C\322y"
+	.ascii	"\353\2357\274\263\326;g%\2355(\2353(\2351\\\300\262@t\236 \341"
+	.ascii	"\235\025$\235\023\264\265\331\252\347\272\017$\235\013\020\235"
+	.ascii	"\247\332N\263T\303i\216\352\274f\2506\323\374\224tvB:7\031\235"
+	.ascii	"\231Jg\246w^J:+!\235\227Fg\245\3229\231tF\032\235\217Gg#\322"
+	.ascii	"\271ht&\036\235\207\357\334\032\235\331w\026\276\363\277\263"
+	.ascii	"\277s\223\210\032\274\372\325\301\005\371?\353\2336\030\351\355"
+	.ascii	"c\367\264\264\235n8\335y\335\326n3w\370h\274\242\005\322\351"
+	.ascii	":`\035\207sH\361\304\201\265i98:\016\263\321\273(\355\206\233"
+	.ascii	"\217\217{\375\306m8a\375B\337n\276\301\305\001\276\2575N\346"
+	.ascii	"S\231>\374\031\327{\370\017\305\247\264\303s=\373s\322!\027\342"
+	.ascii	"\341\213R\016\337\341\373\271d\3539\274\320\3569I\3047\350\255"
+	.ascii	"\357)\031G@\"Y\251\221d\267\264A\353\333\337\360^\350)\375\356"
+	.ascii	"j\213\257\365-\247\255\2124p\021\317\354Rq\255xC-<\201z\021\317"
+	.ascii	"\016M\004\365\305W^\207\340='\261\232$\220\240J\304\307\372\267"
+	.ascii	"\363\037n\266\205\205\213\370\255&\325#f\257\245o\360\346\226"
+	.ascii	"Oe\253\037~\267]\363\230\371#/\363\362\327\233\256\0268\267K"
+	.ascii	"\227\266\331\241\2032v\213\246\325=4J$\203\356:\3555\005\313"
+	.ascii	"3\357\330\2405\374\031\203\326\360bWAY\337\n\307H\3638\377\360"
+	.ascii	"\226h\370\254\357\347\244\"\311\247\262\363\355q+\204\374(\234"
+	.ascii	"\341\247\036\214-\314\025\317\227\236$)\303\034\266\270iu\356"
+	.ascii	"\370Tv\"wX\333|]|\203\213{\346\025'\374\324\237a\370\251\177"
+	.ascii	"0W=]\207\3350\375\310\025C|_\263\n\334\201-\350\222q\253.\235"
+	.ascii	"K\3276\213\341\273N{\036\233\227iu\256\314\007\205Ff\177\302"
+	.ascii	";\337sR\231\017\226\350FZ\304\367}\261\270\0275\243-\356+\315"
+	.ascii	"r"
+	.string	"\007.\256\266Y\366)\004\332k\277Af\316\024\237\372\364\315\327^eH\226\246\"\277\307\223\363#J|*w\037\034\223g^\333}\335\327&\366\201\023\362\314c\273y\264O\177\306\274\354\256\226\373P\003v\205\0301\002M\273\\_5n\200\301\030kk|\331\260\001c\206\214\341\216\023`ab\036\276\310j\300X\3615F\246\034\0331\246\342\013\214F\212\0346\276\304\304\310d$Y\306\203\035bW;\304\256l\320\200\001v%Cl\354\352\001\223\303n|\211]\345\b\013\023\273:Z\313\372\243\\\273\203\370\r\366\225\275s\300S9\002\224J\302\263U\0020h)\251wjz\247*M\217\340\255\230\301\243#@\352%|\f'\332 \220)S\204\277Mazf\001\246\357;\315\f\364C\324g\366M\226\372\002\317\376\221\350\240O*\"\310;6=A@\3477\335\336\0174QC\351H\322Fq\213\256\234\325\275"
+	.ascii	"X\316\354F\335\"\336P\3563~|}\316or\221Z"
+	.string	"\235\002Xz\227B\301\001\264\233\244ev\225\270L\274\241K\337L\236\230}s\n\304\177\023o\312U\020\bo\302\203\215E#\351\241\353_\232D\210\272\353A|?\367\234K\272\276\357\332\327\260=\231V\245RO\345e\032\250\013\377\202\206\f\032\352\317\240^\351\267\362,_I\352:\031\261|\253@R\341\373\276oT\203\206\372\013\337z\315\006J\3458\224\022\211\226\023\240#_\b\232(\371\312+G~\0027\227\352\rM\376H\360\354\310_\372\021\321\323H\2644:\362t\\\323r\002\024\215\372\343/\335\210\3409\334\0244INs\317\274%\3267s\352\251\200(Ac\262\360Q\177\246\340\277\314\035\335\265\311\370i^\007\336\320X>\277\322^\255\325\033\331E\322?\316\277\273i\201\025\250\2010D\021C\210FDD\222$\225t!\005\004!()\274\003\021@\265d\216HT\030\306\206)\272\274\360S#\354#"
+	.string	"\373\245\213\022-\326\347Anl\023\332\004F\247\003\212Ia\346\341D\345\273\220\360.\\\351\367c\346CyH\f\316%\266\216\331\233\360\017\315ps\n\262\365\006>\025\205S#\017\346\302N\013\306Q\tOU\243\212\3158\262\033h\242>\325\236\254o\022\366\203$\005\233\002f\270<\n\2708\022\346\224;\377\375\257<\353K\004\323\365\375\276\337\032\204\2749\030\253\274L'\0310"
+	.ascii	"x\376\036\327\231g\317ZZ72~\333\363\274\235\375\022$\322+y\307"
+	.ascii	"2\352v[338\026QR\252,\251\331\203\333z\007\006\331\371n\374\320"
+	.ascii	"\247-\350=B\024\240\253\301\346\276X\265\341'\344\235ic\337\351"
+	.ascii	"\226\245g\317\347\211\f\340\336\\\007\245\361\035\031\267a\207"
+	.ascii	"\024r\267\0237\221e\216\001\366z%]\212z\3537\f\036\331\340a\030"
+	.ascii	"\234q]\264+b\3318\244=\261Y\034\353\331\355\202\024\225\355O"
+	.ascii	"\211\236N\n\023.\372\200r-\241\374duc\261\352\024\3071{\207\035"
+	.ascii	"\265w\275\234,\317\026\322>\206\2367a\301\223|h\354\277\024\370"
+	.ascii	"\255\2341{\2322y"
+	.ascii	"\341\260\363\210\327\347\227S\266\334\226\242\2155\340K\242\227"
+	.ascii	"'\0259!\033]\355\bo\231\313?!\231\243]\237\315\310/\327\036\265"
+	.ascii	"\324\351\247\300\026\376\245$n\315\320\234C|\341\221\331W\265"
+	.ascii	"z,S\322\324\034\261\340B\307\233kq\200\262\327\275\271\005\020"
+	.ascii	"\317\214\227\223\f{\246>\202\344Y\222^\243\016\350\343P\214o"
+	.ascii	"\",\244\3758M\201J\177]\235\255(rj\033\360\237K\234A\276\021"
+	.ascii	"\236~\200\266W\370'\375o\325\034`x\0170\237S+\304\332\ns\235"
+	.ascii	"\353\203m\247q<\321\225\303\376\007\001Ix\344\247O\216\336b\213"
+	.ascii	"\272X\r2n\311\314\274`\314\304\331\275\221a\335\034\024\343\237"
+	.ascii	"\334%\373\266\230\243\002"
+	.text
+	.section	.gnu.lto_calculateRxChannelsAndUpdateFailsafe.117.d1c81fdf4b442c9a,"e",@progbits
+	.string	"(\265/\375`q\001\265\016"
+	.string	"\306\032`D"
+	.string	"\257(\035@2\254\302\033\240\206\315\242J=\334\377^;[\210i\251N\332\245q{\334\210\037\326f\261\332W\302\004\002\035m?==#\377\346X\272\315U\2650\236\300lVH\302\025<+ido)S\nL"
+	.string	"G"
+	.string	"O"
+	.ascii	"\021R"
+	.string	"\\0vWS\016/}\203E\250Y\362\001t\246o2\225cg\375\300\006\025\f\327\251<V8\354t'\320\263\273\234\316$\025\016X]\240\351t(\320\223\"&\345\254\247\204\016\225\271\361\330]'\327Q\270\263\333&\331\326\354{\001\366\341\356\256ue\377\345\3174\0353\255\232\316L_CC\246\245{\nfw\302\027cc\"\n\017\034\333O\373 \036\242\364\227\022g\354jhqb\267U\300\004\262G\317\003`\217\360\034\330\243K\266\213\267:\254\200\017\001\233\247\242\204\003U\b\252\027M\352\224'+\326E-\302R\031x2&Yc\337\365\021\242\021\b\210\032P\275\\R\352\213\270G\362[,2\222\347\036\375\021\3541]\334\314)?\177\005\303K\260L\257g\035\001*\305\002\305\002*?\273eJe\t$\005 Q(A\310\007h\333D>\033\376t\220l\032\311\246}\204\026\210\264\317F\322:8<z"
+	.ascii	"\332\264\220\321h\3238\255=\\]\331\343\244\250\315Ffj7\b\345"
+	.ascii	"9C5\275&\303G\002\213QM\234\233\371\242v<\325\353\247\027\273"
+	.ascii	"\002\225\305\231\252\006$ \240\002\031\271\363B\241\301\025c"
+	.ascii	"\320\227:\332K\324\352\004\f\205uk\305\277\221\305\2049\253@"
+	.ascii	"\306\301]/\255\314\002\036sg\303u\t\0262b\t\367\230\310\312V"
+	.ascii	"\026Iv6\250\244\266op]\273\210\317\350\360\216\034\333\223\306"
+	.ascii	"\214\320\322u\035\275\266C\001"
+	.text
+	.section	.gnu.lto_parseRcChannels.118.d1c81fdf4b442c9a,"e",@progbits
+	.string	"(\265/\375`\303\002\005\026"
+	.string	"\346\350\217K\300\322Q:\343#\322)\253\254\215\\\325L8\314\201\345\243\236\333V5\253;\027\241\353\211a2\t\373\214\3048{\255\251\241\206dv\242\335/0v\n\212\302\310\242\020p\224\206\"\307L\026\005\245l\357\250\224\354F\032\331D\356$\003{"
+	.string	"s"
+	.string	"\177"
+	.string	"\rd\260\b\312\327\005\236"
+	.string	"\371Z^\204|\335\332.\324\201\275.\340\033a\023\004\244\273],bW\264\366rE\326\221im\017\364qG\007\207\356\244y9\256p8>_\322\340aD!J!]x\243+"
+	.ascii	"&rNvx%\351n\363\304\321q\024\371P\304\324:sc\t\223o\367\341\351"
+	.ascii	"\315YC\371\302\327\235]\224\356\3149]A\350\356\245\272s\303\227"
+	.ascii	"\365\335\005\261\273\016v\251\216I\270\223\231\267\013\244\241"
+	.ascii	"(=\"\3242\317n\353\300?\344B_\363\277\237\365\340\227$\351\326"
+	.ascii	"Jw\034\351\362H\2272\335\007\b\201\352q~\267\243\033\247H\325"
+	.ascii	"J\025\251\304\205\376\340\356\203\366\3035\205~|>\r\312\267\330"
+	.ascii	"\013\327|\335\335\340\214\200^\352\237(|$\244\272\201\013^\367"
+	.ascii	"\244|\275\271\273\024(\363\244\340t\367*\276\242\366\337\314"
+	.ascii	"\007t\363\020\035uM=2\344\353u>(\217L\336\260\251\262}F\254\224"
+	.ascii	"\301\314AXL2e\0039t\206\271\0237Z\334\207\370\245\370\251\314"
+	.ascii	"\033z\214X\t\214\037\2154\355\023\371j2\206\240\215\032J<\375"
+	.ascii	"Q\375\34012o?C\232\314@F,\202N5\224\270!\364\374\241\027\305"
+	.ascii	"\022\364\272s\327\355\211\356\0026\276\347u+\304\310\353b\244"
+	.ascii	"\314\002\275\316d\022\034\323l\345\363\207\217\260\263\233\262"
+	.ascii	"\251\262\321\"\017\0030\177\235\002\254\305E\226B\233\2251\027"
+	.ascii	"^\\`u_&\264\231\2136s\271\300Vb\256\327\f\306e\"\262\262\027"
+	.ascii	"\226\231+F&\233\271L`\237y\200\376\fLSJ6\276I\225\314[\226\023"
+	.ascii	"\331\342\352DoT\310\312)\373\0273\225\262\362ht\263\263\321\342"
+	.ascii	"\307\356\356\325\311In\361\205\227\020\334E\345~n\264H9\220#"
+	.ascii	"\357.\3555&\034\350u7\312\356\312\223^ew?x\335\323ha\031\t6 "
+	.ascii	"p\002\231\"4\017\341\300\357;\332\006\202:ze\002\013w\236\312"
+	.ascii	"\016\232w\367*K\212\260\003\265I\377\221)1\321\205\231:\354\360"
+	.ascii	"X\252\270\3239h\263\3048\353 p\244CC\306v\241\301\013\026g\212"
+	.ascii	"\035\306\0035\234\330btY\016(\tw\233>\340\\\346p!3b\362\200B"
+	.ascii	"\330\205\3042\r\213\373X\255+37\300(\335\275q\327S\f&\\\360}"
+	.ascii	"\b\227/g/\2333\265\346\t"
+	.text
+	.section	.gnu.lto_updateRSSI.121.d1c81fdf4b442c9a,"e",@progbits
+	.string	"(\265/\375`X\003u\031"
+	.string	"V\257\246H\300VQ:4\337\306\034\302\300\344@;\321xp\036\227\023\323\352\362\036#X\033\254\373\212U\257\250\252\033\265\377\305i\002\264\036&\256\251\034\363\031\032\333\177w\265ES0\217\244[\367\b:\367i\262\246\361\023\2627\221;\245\215"
+	.string	"\206"
+	.string	"\231"
+	.string	"C@\350\334\306\212\"\204Q4&%\370\364\002\361\323F\212\260Y\237g\331\276\264\237\364\037\266+\215\360\252\326\027>\240j\035\025\330\200\370\251s"
+	.string	"\364\023\274\213~\332fg\3718\243\016\340ac\307\324\245\326\372Z\031\267=\244\023\\i\363[@!\361P\\q\032\362\370\250\226\244<\365V|\2528\330\352\225"
+	.ascii	"uj\255w\312\311\005\001\020\335\340\265z:\020AU\022.\007ri\242"
+	.ascii	"\207\2232\344\251\265Z\362z)n\361\266\253m\b\366\206\b\265\346"
+	.ascii	"\030\370End\203_\343\323>\035\344y\035\350\347\227B\013'HJ79"
+	.ascii	"\306\036qr\217\354\203uc\330+\351\034Q\332%J\343P\351\033*mC"
+	.ascii	"\245k\250t\213f&\224f\205\3222Sz\365\337-R\351\360J\377\244\322"
+	.ascii	"\340\224~\200\245\201%\307\343\306N\215\225h\f\230\032eF\341"
+	.ascii	"\370\357\267\357\007\371\223\210\0231\220\217\252G\255\365M\377"
+	.ascii	"\371NL6\241\217\336\236\324\024\243\244Z\253\220\317d\226\220"
+	.ascii	"/\t=MU\tn\2637k\251\343\022V\251Y\233\375\323\017D1\021\355\232"
+	.ascii	"\266\f\261\270\245hkk\366:#\232mm\013\347\342\267\233\254\235"
+	.ascii	"Yid'Ff\005\364\270\007\312\332\353r\210+\263.\030ES\273\323\020"
+	.ascii	"\362k\002\356\021\222\257.|\211\324j)\370\250xQ\272\375l\240"
+	.ascii	"+\001Q\240J\255\265\201\237\344Q\0302\364\364\320Oq[V\242v\016"
+	.ascii	"n\2704\214\316\b'\307\370\013\356\235>s\370\246\340\246~b$\223"
+	.ascii	"\022D:v\217\374\030\375jX\272\222\223_l\303~$&\006\346\260S\343"
+	.ascii	"\020\324#{\375\314d\262\031\214\200O\255\006A&\004\024\326&\304"
+	.ascii	"d>\022\202~b4\332\007\030\215a;C\264\327\020\355\365\343\323"
+	.ascii	"#{\301h\265\327\216\3133\240\030\355\0254\233\321^\254\361v\260"
+	.ascii	"n\f\007L\240\274T\335\026\027\016\220\366\203\b\362<\037\310"
+	.ascii	"ypKb\306\227*(\272G\316iB:\002\316l\253\t\351\304\212K\263&\354"
+	.ascii	"\234\365\235\374\311\004\277\206+X\260 \305\323\342\332\234="
+	.ascii	"\025\035\024#\371\255\313\225\261Z\346j\275\035\300Y\327^\267"
+	.ascii	"\343fq\034\024\371\250pS\001> `\002!\204e\036\327dp^\350\301"
+	.ascii	"\t\274\263/\033\310\262h4\020\200a\355\024\241k\343\031\2577"
+	.ascii	"\016T\255\272#C\313\307.\352b\373U\250\373\271\353]^j\205c\020"
+	.ascii	"\311\202p6(\2341\034\0234\333\361v7\020> \013\300\355]\312\342"
+	.ascii	"\331\f\r\212a\247\231j\255q\"\332\030\004\n\021\250a,\021\363"
+	.ascii	"\305\366#\376\342\270X\376\377\265K\262\340\317.T\353\024\267"
+	.ascii	"\223\206\330\267\022&\324\263\333\f\377\355\270\030%\221\317"
+	.ascii	"\366\032\313\241I\353A\001"
+	.text
+	.section	.gnu.lto_rxGetRefreshRate.122.d1c81fdf4b442c9a,"e",@progbits
+	.string	"(\265/\375 \373\335\006"
+	.string	"\222\31505PO\222\016 ;\223V\270\032\301\365\347\217\013\3375\004\313\324\365\325\324B\255m\255\371\370Z\3409\200\232\3104i$5\313\202\241\317\"6\214;\262F,!2\005w8\036*z\250\b\341\300\360\020;\224D\344h\236\"\032\25081MT\314l\331\027\372\031\\\357\342\247\250I\025\220\231\tW\324\255\342j\205[|\\\261\302\373\221\n\335\023(\271\334\3507\313=\216/&3\363\027\372\335\356\r\200\244d\325P25F/\311\002W>~\320g\256HG@W\033\214\313\332\204\2102N\\2\267H\320\002\251\320U#\025\276\216Vu\325-I\027Z4\025,\263\352"
+	.string	"\0242s\207e\033\375\365G\370\017~\217\007"
+	.string	"\004\013\330\210!\005\205"
+	.ascii	"\343\232\222\205\310\303]1\265\223\f"
+	.text
+	.section	.gnu.lto_getRxfailValue.part.0.148.d1c81fdf4b442c9a,"e",@progbits
+	.string	"(\265/\375`\310\002\r\024"
+	.string	"\006d\177I\3200'\035\030W`\031\201\240d8\351\237\377\201\306\236\005\264\222\037\300\\\024F\"b\217\375\"\311Gz;?\213)k\365V\221\276\031\225\237\270\t\035s\205\016\033\340\274\325\204\231ly \216\247\025qY\265\204l\"wJ\001d"
+	.string	"p"
+	.string	"j"
+	.ascii	"\326\335\020O1v\307\004\237.\260\372\264ov\353\223\310\246\263"
+	.ascii	"\355\253\370\320\3153r\f\322\261\204rn\220z\273\243\370\031\340"
+	.ascii	"!\340\247<\b\370\251@\237\371\374T\2023\276\304\331\341>-0}!"
+	.ascii	"J\007*\036\316\316\303\365c\227\373Fv\367\274\313\234]\215\224"
+	.ascii	"\002\016\206(\273\353\325\207;\274\355\024\333\017l\375\b\226"
+	.ascii	"}\2733\006\3518\350=\r\36567\222\320,S\f\027hD(\3701a\243\273"
+	.ascii	"\321A\373\276\213\277\260[\206\271\222\001\330H\352\301L\036"
+	.ascii	"\214^\323\216iWrx\343\204bw[\237_d\363Y\234\347V\222\355H5)2"
+	.ascii	"\256\216\356\350-nG\252}mt\036\034\2264\344@0\256\016\002\336"
+	.ascii	"\310&'\266\2172#%H>\375I\333\344\344\366Q&M)V\320\310*\353\345"
+	.ascii	"\356\342T\177l\277\200\327\367\034\335\310I*\177\310\221\375"
+	.ascii	"\013\264Y`\3628\327\001QER9\3059\331\266\341X\005\255ny\366\300"
+	.ascii	"\347y\177\206(\")\234\334!\365\307\n\376[\365\261Y\322\037KZ"
+	.ascii	"Y\322\322C\372!\001\021jwC\225\216\345\2312\204\236t\246\032"
+	.ascii	"\214k#\f\324@I\2211HG\267\024na\201\255\304d\f^+.\232\013\314"
+	.ascii	"\325 \304\345\025\213\271ZTB\253\224\304\314\304\230\231\030"
+	.ascii	"\203\271^D\225\031M,\001\261\214\302k&V\220\311fb\313\266\374"
+	.ascii	"\267\352\343O\221\370T\317\373\234\262Q\251\237\346\250Qh\264"
+	.ascii	"fBx\215(\325\320\t\304\367)\255\366\330\216p\250\224\325nn\201"
+	.ascii	"?\3434$\370'>=\3015}\027\370)\325\003(: \240\002\031$\333\006"
+	.ascii	"u\274\202\231\204a\306\330\204\266\320\020\327\031\334\256/+"
+	.ascii	"\231]\270\363Al\236\232%p\256\257\034\306\263\300Z\321$\032\303"
+	.ascii	"l\341Zo\020\203\314.5\306(M\0035To\201\327=i\274H\210|&$\307"
+	.ascii	"4c\343]\3152\t\362.\016\264\361\233\3405*X8\261\300\253\265n"
+	.ascii	"?C\213\375\226\034t\250],V\264&\213\273\f#6\354C\007\316\257"
+	.ascii	"\305\346r\213\243\201'\030<"
+	.text
+	.section	.gnu.lto_calculateRxChannelsAndUpdateFailsafe.part.0.156.d1c81fdf4b442c9a,"e",@progbits
+	.string	"(\265/\375`\312"
+	.string	"\025\013"
+	.string	"\306\225K?0k\225\016P|l\246x\300\317\230a\343\350\354\250\020+\375\355J\204G\311?\377(\363\200\032\306\260\t\250d#T\251\272/\013\340/\f\020\351\210\345o\020x\tT\367\003\216YM6\2212\2457"
+	.string	"9"
+	.string	"9"
+	.string	"\257\330\016\265O\266C\373.\333#\224=\333\303\277\326ZD0P\240\002\210\335\215\207\352\340\33655\317']%R\b\236\024\327\"*\273kH\202\033\336\366\206\355h\277#\232\316\177\377!\251\312x\355\036\230\205X\006P\003\004\333\267\037\033\331\022\311\241\355\314\177\243\303D\332\267)\2243\355O8\005\3570\221#\273\r:d\330\3754\016\215\0019\274\b\0272\376\003k6\371\323\241\277\331\016S-\252\r\022\024\224r\346H^m.\300\307K6@I\336\322\006\t\310\237\374\330\337\342\340\222\231\224\224\312\262j\327vw\255+[\323\032\036\016\fGc\371t0]\007\272L\370B\tu1\324\305\216\306\203\023/\235'R&\346"
+	.string	"`\272\370\341\270.J\256+WJj\262\252\262l\253b\370\351\303\237\331RUO`\201)g\366-<\024"
+	.string	"n\023"
+	.ascii	"\316\031\3705\0323\f\002\246\024\273\244\31264m\006\344\201\021"
+	.ascii	"\343\nx\206C9\373\314\316\0056\235w.\013\234x GK\323O(c"
+	.text
+	.section	.gnu.lto_updateRSSI.part.0.157.d1c81fdf4b442c9a,"e",@progbits
+	.string	"(\265/\375`x\001\215\016"
+	.string	"\266\331\\F"
+	.string	"\2216\035\260!\340\271\222\211\337\337q\264\201\261\270\036Q{\006\276\300G8\241\306$%\3428$[\262H\253\032\007\202\252\225\035\326\203\023\275\013@\243\b\254\326\377\343\315\f@\275J(GK\003c\"\266\333\336)\005D"
+	.string	"I"
+	.string	"K"
+	.string	"\006>]"
+	.string	"\373\364\234\300\346\323:g\363\231}\236\204\355\257\304\240M\3435\265\235\020\037&\274\254v\227~J\017\007/\243\005\372'\324\310\345[\036O\250\n\217\003n]\tv\327\230\205{\3366\002\333\013\354\313\b\273\373\025\217\361Y\300|\336],Q/`\240\204\273\353\3710/O\341]\305\207\307T\267\344\352\240\241\206\007\260O\0011$\372%>\277\305\231\355\263|\257\"Q\301\232.|>\035\243}\023?\001\276\212\030\300.\207\0212\2735\226\326\255\225)\266\214'4\334\245\220\003\307n\2304 h>wX\213\241\246L\356\262\022#\\-I\375X\3463\235;:5er\235\254\314\324X\355V\372\351\212=\346g\271\264\357N\205\022\372(\356\302\316\034\362\026.e\230!\"\2060\352:\006\332G\351\352\034\210\264Q\003\017\222\210\343\274P"
+	.string	"\207@ \034\005\341(i\364@\243!\256\243 \216\267\222\210\243\036\333\306\321xke\212\261\232\033*\223\224 \245\212\355,\306\335G\330\330\332\026\177r\25456T$r$J\225' `\202Q\316\212\007\325\346\020N\214\314\247ad\271i\342N\264\303\234p\203\0256\034\202\363\030\246l\270\211\277E\2424\003.\330\r\353\016\370\214\343by\377\367\215\"FPP\333\021\r"
+	.ascii	"0\245\261;A\223T\376\244;\246\013\355\264\013\332.\233\013\200"
+	.ascii	"\211\347GG\357\274\026\217\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.d1c81fdf4b442c9a,"e",@progbits
+	.string	"(\265/\375`=\005\235\026"
+	.string	"\306\343\205G\200\232J:5v\333\213\300\325B\225\003~+\352W\250\335\366\275>w\004\333\341Sx\252r<\266\242_\244V'\207\353\362\236\006t\371)\260\016\254\007\366\343\356\223&\336\353\230\312\235\252Q\006\017\006y\221\354&\211L\001p"
+	.string	"o"
+	.string	"r"
+	.ascii	"i\310\b?S\372\027>\036\217tI\375\271\037\244\336,\362\350d\224"
+	.ascii	"+\360V\214\256F\340h\364U\005\236F\211\274\214rE}4$Q\377\f\t"
+	.ascii	"a{<\330+\007\313\203\362\277gmp,\264:\331\"F\330\264\030\364"
+	.ascii	"\345\026\364\335j08\004\343\325Z\253\202~[\217\232!kC\375528"
+	.ascii	"|\362\367\177\366c/f\t\0214\241\276\027\362\177Y\024\017Ck\213"
+	.ascii	"\276\221|\025\213\017W\364\327\fU\364\267\220?J4.E\277\016E\237"
+	.ascii	"\356\304\313\250\211\213\225\370\024\022}3#\372q\244\210W\tq"
+	.ascii	"3\n\242_\346C\237\f\351\241\017\327\341m(\207S\241u\300\227\330"
+	.ascii	"\332\206\376\230\252\241\317\226\241\027\311\211\241\367\b\311"
+	.ascii	"\365\302\213\026~\205V\370\033\205G\241\\\231.\205r\235p\"\345"
+	.ascii	"\272\3641\t\375&\377\200&\227\\K4\347V\266\303\303L\300\035^"
+	.ascii	"\272e25!\220\034^\331\266\033\344\253.\013'\207\267\270k\334"
+	.ascii	":\226\031\341\360T\257\017\034\275U7\372G\033\275\265F\337\216"
+	.ascii	"F\237\315\214^+\251\336SF\2570\252\177\267\265\326\337w\214\321"
+	.ascii	"\033\\(\035\030\317\362t-N\347\362\342]\250\213\203\241\377\016"
+	.ascii	"*\0359\244\242\240\250\232\242\246\022|OaS\327\t\356z\031\345"
+	.string	"\320|\206\370\206\030$\304L/\006q\311\325C\300%\223\003\274=\307\200\200x\273\304~\374;\361\307=]\013@\b\266\245\344c\001o7E\240\217\313s\271\211\021\256\355C\037\377\200>l \247\307Kf\217\237\210K\336A\301\272\3421\371\351\\!\253\260\264#\223\235\272\026GIX\022$\223}o\333\313\n\003K2\271G\213gr\200\340\336L\210\035\026Oa\250A\030$\271T\0051\243\2604\034\360\002\031\022\343\006\021p\030\020##\022\b\005\022\210\bi\007\204\234\335\314\237\\\322\003\353\211A\"\340\244\302:\254\233\267P\356\007+`\b\225>\361wm\313r7\177\363\351~\333/7\202\304\266R\033?\214\017\310\246R\ff(\367?\347\2762`\301{\243\377\233PJ\nM*\207L\343%\256s\242\256\t\340\344\305\370\2608z\302\241\0274ZC\273@\230\322o\331#\254\273\245n\004-\374\220\037{"
+	.ascii	"e\326)@Z/>P5a,;\r!\304\375\3760K[7\036\tE\216\372\255\370:-\360"
+	.ascii	"q\317\217\363Et\013\322\274\236?"
+	.text
+	.section	.gnu.lto_.refs.d1c81fdf4b442c9a,"e",@progbits
+	.string	"(\265/\375`\325"
+	.string	"\r\n"
+	.string	"6\034L2`g\223t"
+	.string	"b\202\031\004A\020\004A\020\004A\260\206;4B#>\3645\376C\377_U\377/D\266\233\365\267\324\026u\263\204\232m\215\020B\266L\001:"
+	.string	"="
+	.string	"?"
+	.string	"\r\325\335\343\333\324\231\343\0065$\375\213\337\274Oi\006\333\275g\357\203\234\021=\004u\305\"o`\336\340\347\373qO\316KN\207\334C\347\237\323\237\2467\315;\327\333f\212o\203\347\312\023\366f^X\205\307\255\365\325N\310g\020\375\013b_\001\325O\360\350\b\020\372D\365\022\321C\304\336\020;\003\244[\252^\251>!>\004\362\215\367\322\373\b\372E\325\037\352\235\351\003\337X\272st-<`\361\242\364\234\264\2223J_\223\n\310\213p\200\336i"
+	.string	"}\"\352\021\360\037\336;Dz\006\346\231\227_b\257H\276\222<%\371I\362\216\330\203\367\017\2447\261\267\367,\322\027H\211|y`\235\021\271H\210\3254\220R>\254\013w\3501\323\335\373\026\277\357\006\266\303\344\f\223'&\t\254\035Jo\223_\224\317K\031\330\217\313;,\337X\350R\344\031S\217\250\016-\335\201\001\004"
+	.ascii	"u##\r\rc\017g\307mM4"
+	.text
+	.section	.gnu.lto_.decls.d1c81fdf4b442c9a,"e",@progbits
+	.ascii	"(\265/\375`.Eu$\001\252\363\215kV LI9\351\257\272\356b\356\""
+	.ascii	"\376+."
+	.string	"\336|\325g\276;\347\332\213\217\273\212\270\253\356\210\373su\347\336U\346\246v\215^\247\303V\n\353\364\2138\241[\b0\235^o*\036\276\210K\357#\273\237P\205\264_\267\367\337U\272\236\246\355\317\334\324H$d\023)S\230\005\254\006\346\006b\367&;\024u\260Y\200\030I\033\301v\034\023\241\037\350\245\r\366\346\302\275iE\366\\\260i\333_G\357\034\001\220\301\255J[\035\036Bo\361\322\3331\351m\226\364iL\204\336NIo\313\322\317\300Dho\365\fV\032u\f>\251\344U\336\233\004\362\215\261\253\221\326\366\266Hz6B\201\366\366\366\366\330\b\275\355\221\336b\2457\227\375\302\306\350\002\026\326\366&]z\223-\275\311$-\302\221\336\324J\215\230\b\275\231\"}\347\245%\274I\337i\322\267\315\245\217sK\277d\222\006\361\020z<&B\337`\351;+=\303I\317h\3223\230\364\\%\325"
+	.string	"\357\r\017\0247f4\222FA\302\320\270\271\343<)18w?\333q\033\2563\273 \315L\265\345$\023\241El\226K\336\276\322\332\362\262Y\r\2579/9\315C"
+	.string	"\361\036)^\332{\241\2307\370a\336\340t\013\002\005\005\265\347\265\364g4g8xc\021\007L\030\226c3=tnj\300h\313f~\236\3431\\\307]\367J\335{+\320\311\302\342\304J[&\303t\254\344\300e.\020\263\341\021\205\325\366\f%5\301\275\314\001\345\275=\346\200\202\300D(jvt\026c\266\275Q\315ik\223L\204>\215\207P\216;:\203\031B\221[\311\233v\357\005:gp\301\361\243-\017\017\241?\177\341\240\223\244\312\r\035^\272\230G\\\260\251k\0137\005\246\f\323\366\334#\375\317[X\013+\231\013g\341\344\275\311{\357A\314\300o?\307\240\033%\247E\204\020@0\027\266\302ofRL'\312\327\f\313{\223E\035:"
+	.string	"\341 2\007\003\265\347\034\351YE\312W\030\013+1`\267\207"
+	.string	"\342\346\361\311-\2737\t\344\243G\246'\247\355\031*=c\200\362\036c\200\276\004\351\317U0"
+	.string	"J\306h\221\243\355\317m\314\326\343\242\307\0265m\251\024\3614\271Q\206\252\355O\244\027!\311h?PAW*\352\213\330\275\311\377\274\3062\260\222\247p\224s\032Ky'\357U\336{\317M\376\243\363\024Vc43\331v\245\242\300\230pt\243\252\201wo\262CQ\207\236\030j6\344\240\366\016H5`\"\324\362\020z\017Rv\302OX\331\001\237\235\315\270\311O\250\344M\336\233\004\352\037yR\240\264\275"
+	.string	"\322\037\257\013\342hz\356"
+	.string	"5\367\366\270\003\364\2356\017\241AL\204\376\314\344\347%\\\326\201i\305\242\353\246\335\233\024J\245\256\254\225\265}\222\211\320\224\207P6\235\236\337\002\375w\343%\273\265\\\212f{\376L\302\013`\026\375}\206\201sl?c\340g\307\277Qs\303\3773\223\350g\005x\360\367\027\n\374=\306\244\240\355N\236\237\247\376\2731\007\375\344\347\254\027\246\206\237\2458\360\237\005\252k\370-\323\317jL\241\2773\320\322\001\233\177\313\230\3214~\026\232A?\353\231\231@?\2131\177~>Su\267fA\313\354\371_"
+	.ascii	"s\307D\177\223\377\336\373;\257\345\374\234\342&\374&\230\377"
+	.ascii	"n\315\202\225\216\363\237\215K\332\317$\370\303\337p\372KQ\004"
+	.ascii	"\360>\200\337\f\3627\262\215\332\335\264\335\3777|\305\3477w"
+	.ascii	"\224\031\323h\372\013\227Q\373\031\330g~f\256\375oSw\246\307"
+	.ascii	"\374Ws\301\224\376\222$\372\315\243\217\n\375\201\005Z.x\007"
+	.ascii	"4\2148\374\326\002?\273\311\375\347\267\020\370;H\230\336\300"
+	.ascii	"\002--\006\246/H\300\317z\026\200\370\271M\027\331\337\036m\240"
+	.ascii	"s\304\375\374\364s\361\347\365\357/?\207\340o/?\213\340\357."
+	.ascii	"\177\017\375M\001\334\317%h-.?\253?\317i\036\177\367\330\362"
+	.ascii	"\263\013?\256\332\262@K\263@\201\2373\360\363\n=\303\317\027"
+	.ascii	"\370\331\304\3170:\313\1777\026\370\003\035\374/\372_\200~\373"
+	.ascii	"\233\355\"~[\301\317K\3727C\340Fv\376f\221\355\350o\207\376k"
+	.ascii	"\371?\303\177\270_\360\177\003]\356\373M\265N\255\245\310\375"
+	.ascii	"W\373?\345\377\3317\360\237\355:\277\211\001\270\264\216b\337"
+	.ascii	"\374\r\342o\264\237\275\316~\376\340\347\022~&\341\347\016?3"
+	.ascii	"\340g\020~\366\360\263\t?\207`\243\237\023\360s\003\376\273\335"
+	.ascii	"o\370\255\323\337/\374=\374\233\351\357\017\374\275\364\267\360"
+	.ascii	"\357\246\256\352\026\376>\361\267\252\374\017\364\237<\177C\371"
+	.ascii	"\273\310\337C\376\016\373\333\307\337`\177\327\370{\306\3372"
+	.ascii	"\376\206\3617\326\337)\376\256\372{\352\357\022\374=\202\277"
+	.ascii	"\213\177\203\340\357\023\376f\300\337\347\337&\374M\302\337\374"
+	.ascii	"\267\207\277?\370\273\303\337F\177\017\340\357\r\376\316\340"
+	.ascii	"\357\013\376\266\340\357\242\277\211\376\366\371\233\347o\337"
+	.ascii	"\337:\177\367\317z?\317\3719\316\317x?\273\371\271\315\317l~"
+	.ascii	"^\376|\346\347\272\237\347~&\363s\334\317^~\206\373\371\355\347"
+	.ascii	"+?O\371Y\312\317h?C\3719\371\363\222\237\311~&\362\363\217\237"
+	.ascii	"W\370\031\306\317$\370\331\003?\237\340g\027\376\273\371\337"
+	.ascii	"\346\277\232\377e\376\233\371\017\367\237\312\317^?\337\370\231"
+	.ascii	"\306\317[?\013\177\266\340\347\030?\277\370\231\305\317)\376"
+	.ascii	"\263\360\377\354\277\333\317U?S\375|\177.\301\317J?\237\3709"
+	.ascii	"\351g\340\317\277\2379\360\263\004~v\300\3777\377\357\376\257"
+	.ascii	"\371\177\346\277\227\377]\376\267\375g\373_\366\037\004\377\271"
+	.ascii	"\374\277`ooo\357\337\231\300\337S\301\377aImM\036B\3712\021\372"
+	.ascii	"\0355nn\346[\024!]\226w\013id\276\235a\214\204\251\265\375\216"
+	.ascii	"[J\205\212y\005\316\265r\363\212O\230\231\n\026m\315*>\0368 "
+	.ascii	"=\220m\247\017\257\266\27166\236\254(7\027H.M\231\027m\277s$"
+	.ascii	"5\235\230S\370\356\204\251\344\216\217\364;5\322\363\222\315"
+	.ascii	"\264?\004\020\246\023S\n/\355\006\\\332vT\244\367\335\245\277"
+	.ascii	"yf:1\321\370\314\t)\254\356\315:\342\202\364\340>3\351}_\322"
+	.ascii	"\233N\330\204\2424\241\360[\321=\262\321\200LL\017\016\357\""
+	.ascii	"\223\036\334W%=\363\033\312\204\211\231\344{\357\335\272G"
+	.string	"6\004\340\202D\032\375\246\331\315$\n\246\n\024\232\266f\023~\273j\223c\244\355\357\030\355\277\317\232\025\331\322\321\366\276\"K\2264\225\252\024\276/#FL\262\276\367^1\035508\313\273\245e\364\233c7\311|:\262\220X\2655\217\230I\324\240\241\3250\223\230H,\0135\254\030\314\025?;b\270;k\353\203\021$\210I$\275\367R\021\363Q\231\245\2102\344&\221\023Y\260X\211\375\367u`\255\312\314\0243\205\\}a\223\002\367bK\2352\214\263\364\274\221!n\257\355S6\351\315\034&\330M\035\327a\376H\357\275\307\344\275*\312\222\324\203\303\273[[Fg\224\2501J\323\307\315\037O\363c\305\016\207\262\355\357\314\036\377}\346\034\326\233\217\036<\220b\310\266PA\251\304p\231;8\312\216\235\0176Zm\237ZI\377\363\373G/\024\362\336\233u&/2\252\007\375\371|2\033\375>l\262"
+	.ascii	"\376\333{\377\233\277\001&\220\274PSr\334{\271MZ\204\r\212K\203"
+	.ascii	"{\306\335+"
+	.string	"\345u<\301\013K\312K\206\225\322\013K\310J\351u\217RaG!\344\365:Z)\357\025\222\222:\216\350\302\262RB]!+\345\305\272Sa\260\370&\275\216W\252\353\n]\251\013u\225]X\032XIyaY)\241\260\204\254\224^XW\351u\203\256\024\0242\205\324E\n]\245\327\232\253\354\302\n\262RvaY)\275xp\231\024_m\262\242\344"
+	.string	"k\301U\254\244\256\213\0264\240\220AqV\311\256Kw/\247Q]\344\215\273W"
+	.ascii	"\367\322\350B\322A\311\340\266\2508\027QS\240\2728y"
+	.string	"\357\345\320\"\352\253\353J\305\035\371\306Y\031\351\272\327H\324\322mq\357\275#\034\223q\267\007\307\035s\320\270,\250\356\265\340&\357mq\357\221o\334\275\367x\357\325A\322H\336\033C\220\225X\213\026\367n\025\265\2704\216U\250\356\355\264\2726,+\345W\327Q\0254\245\330\255J\036\331\212E\327\025\273t^\310TytrY\334{\331.\025\303z\301\006\307\315\257\337\364\352\033\346\224\013>`\274\370\322\326\307C(/9\272\211\003H\216\355\256\006\2337Xi\3360_\234V\367b\2010D\214\206\007;1|\034\363\332>\245\221\232/R\252\224\252\003\337U\331\017\254\266f\f&\027+\357f\322\270@@Y\356n\264\265\275N\234\364\351\336{\371n\250\316\335\320\337\334:+\315-\363\236\220v\257\f#\263\333:\264.\216\266\327\251K\177\023\206\322\204a\306H\243\254\356\315\372\200\254K\017\016\357\"\267<"
+	.ascii	"\322:f\255\245F\346\314\335\266\327AK\177S\353\005\f\027[j\250"
+	.ascii	"\336\244\334psu3\3537\221&\2269\345\202\017\332\031\224\230\266"
+	.ascii	"\314\203\211P\"\036BM\027G7\257R\2757\027=\332R`\2660Y\230Q\273"
+	.ascii	"Xm\315\025I)\031\274\354\334\264\275\216\221\324L\321\003\025"
+	.ascii	"\203\n\230\266\327\371\221\344i\263!E\253\355oVQ-\321\322\001"
+	.ascii	"$Yv\357\005\362U\221s\004F[3\312\224\2729eB]sj\204\256{\241\314"
+	.ascii	")\2409\367B\0011o\300\274\201U\362%D\r\265\327\321\221\376\346"
+	.ascii	"\321\274#\340\326\246\264\335+:\337\204\251\202\244\355u\364"
+	.ascii	":\317\310\225\r\025m\347$\323\356\275E;uUWWm\257sL/B\234\256"
+	.ascii	"k4?RAW\352\213\f\257\341\264\034Vv\234Ns\233\2747MJ\307\3512"
+	.ascii	"J\226qZM\2771\223b\351\212\250%\313{o\207\242\016\035R55\214"
+	.ascii	"\250H\255\233\236\030O\326\304h{\224M\267i;V\366]\257a\023\344"
+	.ascii	"\256\227"
+	.string	"\374\366sL\336+\020I7\313\261\023\312\330\213=\324\036mK\217:I\217&I\217\016I\217\312\3503\276\256\030\240@\265=z\225\266\231\333']>&T\214.lm\217Z\245?\361\322\277\351\330N4\031K\312\310\214\261k\220\344h3\246\271\032\265\253\013#3g\344\003gL\324X\213i\271\235\2618(\273d\362\336[\344#dy\305#\f\230d\027Y\236\227\376\322q<\225\246E\234\266\335\305D(\007<\204v\227\243\267\227\037,\2623\265\266B<\204nA\277\220yu\265\335\322odK-\235\245gh.\254\354-}\366\"\031\272J\331\362hK\273)Yni+\215\245\004*\244\317\305\324\222e\207\016\2769s\266(\331\261?\315\244?\273\244}\305G\231\252-m\177\252\245?\233t\333\022\255\261\270\266?\177\244ge\2635\225\260\244\225\251\337\275\251\274\361\224\301\032c\322\366'W\372\367\2245"
+	.ascii	"\254X\021\326\366\254\3545\265%7\253\264\266\255\206\326so\331"
+	.ascii	"\275\367\002 \027a\274h\265me\247\375\367\351\b\261\261\244\254"
+	.ascii	"\323:\312\026)jdI\264k\016\235\233\266\377Y\331h}\226\274E\366"
+	.ascii	"\312\031\034Y\333\237)\322\337\371\316/7g\330\332\376\r%F\214"
+	.ascii	"\030\307\266\347\262\024S,\304\246\376\2437\223\226\321\\\246"
+	.ascii	"\023d\032\005\212\234e\337\370\217\272\360\372\030c\216\230\b"
+	.ascii	"{3:H\223u\222\376\321H\272I\217\365\220\026\322K\372I\227u\217"
+	.ascii	"\006\322J\272H\033\351\2606k'M\244\217t\262}\264\030+\233I\353"
+	.ascii	"x\357h\036\267\311\267\212\025+\226}l\253\026,\345\312j\311p"
+	.ascii	"X"
+	.string	"\216\215\345\205\332Z\336\233\204\303sj0\034\326\343\267\271\030\252\376#\033p\304\372\230\325Zz\310\277\217X{b\367&\217\272\206\\\234(\251\271\253f\322^\rf&\305|U_i\226\367\336cS\271X\336\233<\b\030\255\225'\306p8\316\334\215n\341\002,E\223\237\3414\023\316K\253\316\270\226e\377\021\0165<\346\357c3i\026s*\002'\232EB\265\345\306\334\231UbCj\214\256\355\221\237K\216\234P\3143\351=&\357V\327qM\tyuvH\360\256\325\226\221\216RN\233\031L~B\371\351$\004\020\347\223\035b\326\232\234O\314\251\007 \3412\323\366L\376g\253\213\225e\333\237MN\263\337\267S\004L\231\244\3557|\245?\300\223\030XXm\3172\263\n\235{\322e\312I\366S\311\357\343i\342F%\327\366\033\270\3223\311\317\261\337\307:\\\304\205i\373\r1\322\377D\362\373z\326"
+	.string	"\211\341\243\3557`\245\337\240\242H\021\363-\t\224O\214\232r\315\0331\261s\b\221TF\021\262\024CL\025g\336\366\346\264=\321\022\b\2203\254\350\b\23314\272\020q\361&\310\3170+g6\206\216\bn\307\216\323\007\032\305J\232,\273#\016\223\272\266\247\217\263\007\234\031]ymO\036I`Q\260\264=\321Xz\242!7n\234`|\026\246\016\017\r\316\331\232\034?\301\344\304\240jk{\3428\277z\215\023\255\274\257\323\253\005\216+WIOr\034i\373\273\263K\nnG]W\243\375x\345%\273\332\236(\213\213\353\254A\026\347f\211\367#\247C\305\n\032?k"
+	.ascii	"E\035\001\"\003\232\377>\23714s3\332\236\350\316\230a\276qP2"
+	.ascii	"JN\211\330\275[F<_\324\316\302\304\310\220a\276\025%!2\206\206"
+	.ascii	"\nv+\342\200\274xq\302(\3522\311\204\t\323d\314\347K\026\033"
+	.ascii	"\226\326O\030\313\273\263\270&m\177\327\\\377}\250\227\2539q"
+	.ascii	"\332\236\202\252t\305\271\342\304\342'\367\212\202$Yfcx\367n"
+	.ascii	"\031\355H\315Xc\243\355\177\"\177b\335\215H\231c\220\266\347"
+	.ascii	"\225\331\205\3066\243\355\351\"\206\035/\326\332\236-R9R\314"
+	.ascii	"\304\264=Y\334M\207\213\227\257\033C`\322\377Lq\246h\256\023"
+	.ascii	"\322.\024\226\221\233W\023\244P\220\270$m?$\226\376g\325Ye^+"
+	.ascii	"\025t\357W\230\217\217 R\332\264\375\220\327\336\317\251= #\230"
+	.ascii	"\335\024L\214\025m\317\250S\352\204:\217\347\035B\246\277\315"
+	.ascii	"\263y&\234\324\\\331\0270:8\313\273[9wv\215\007\250vv\200-Y^"
+	.ascii	"$\r\017P\"6\354\336\332Z86\016\236}c\335h\250\222\376\326\316"
+	.ascii	"\332\231u'\360\b\272\027\f\256\355\"\267<\360\205)\203\302\326"
+	.ascii	"\366\032\302\3223\031\333'\267U\254\025{\205\225\366\211]s\024"
+	.ascii	"u\241\246\200\240\245\255\245\310h\340\265]\352\254\230\261\226"
+	.ascii	"\326\366\032p\244\3472,\366\215n\231\305\272]\020e\225B\331\227"
+	.ascii	"-\026\216\343x\234\200\004\216\341x\261c8n+\350JQ9\263,\253\263"
+	.ascii	"3X\267\237\243\320\2759\274\210\235\261jl\032k\306\226\261hX"
+	.ascii	"i\353l\227[+\366\212\224\255\263Z\030\215\343x"
+	.ascii	"\234P\326e\3113\346NH\334\217\305r4\027DY\245\320\244ni\307\330"
+	.ascii	"/v\216\343\266\2227\213G\006\"B\360\360,\031K\307J;\346E\311"
+	.ascii	"\333\241\003\007\0379e\360\232\240\366\267sVL\233\n\256\252\266"
+	.ascii	"V\216\225\\V\344h{\241e\372[0\254\264a\200\252\210\344\205\265"
+	.ascii	"\265qGcS\034U\254\270\033\214*K\272\264\275\020\232\364Bd\322"
+	.ascii	"\013m\261\\\322\271e\r/m/\204%\275P[z\241\265\364BP\322\0135"
+	.ascii	"I\177\373f\335\224[\332xqk\271.,\242\332^HI\332I&B\215x\b\265"
+	.ascii	"2X6\333\366\373\200\224\264\351Xk{!\"\351-\225\377>\n\370\370"
+	.ascii	"\262\326\326\362\335P\273v;\345\3675\027!b-\332^(Hz+\305\252"
+	.ascii	"\375\276\037\2720)N\332^\b,\275M[\333k3\243\255\215\222R\t\311"
+	.ascii	"\350`\247\006\225\033\\Vy\033\345\267g\026\315\234\022\301^\336"
+	.ascii	"\233\266\247c\"\324\207\207P\013\345\350V\351\345mi\326\266\207"
+	.ascii	"\207\320\007\335\231\231\331d\nh\026\036#qV\322\264\265\311 "
+	.ascii	"1\351\355\022\266L\224\226\t\243\031]\250\243\321\220\266\031"
+	.ascii	"<@\343\210\231A\245\355\203\276\244gFC\307\306\254\222\006 \365"
+	.ascii	"\340\306\322\027p\350\244\220\335*A\202%f\0254%\025\023\263H"
+	.ascii	"\370\336#\346\0213&B\216\334\"\301\343\232b\327\326\0321\253"
+	.ascii	"\376\373|xx_dh\373;[\204I\024%^E,\221-1mD\366\304\334\222t\261"
+	.ascii	"CZG\027]\033\272\266\017*\013\013+\262\324\203\303\013\032b\201"
+	.ascii	"X C\226zpxA^>|\334\240+00\313#\255\242\203\225\305\006\235\335"
+	.ascii	"q\313C\003hE\330\264\265:~XxY\261Q\343\277o\347H\216\037F\332"
+	.ascii	">\350\230~}\231u\351\301\341\225\201\271b\326\366@l,\016\213"
+	.ascii	"\203\337@\320Q\213\372\261\024\223\336\326`{\343F\027\020[zn"
+	.ascii	".\224\006\r\363-\345\300D,%\243\203LL\333\003\231\305\020\203"
+	.ascii	"\335Ja\t2J\312\205\\\333\003\351\2602\254\f\273\225\002\021\031"
+	.ascii	"\212\272\036vm\267\226C\212|\261h{\240\254\364\267W\254\264W"
+	.ascii	"\026\306\ti]W\313(I\234\233%\336\275[\036p\023,uS\354\213[\030"
+	.ascii	"\277EZ,\253\005\002=%om\347,\307\234|\265\265YG\267/x\326\270"
+	.ascii	"\344\ti;\304C\350\316e\"\224\273x\b\375\017\232\364\267-Xi[4"
+	.ascii	"W\n\027*\213\203#\310\237\267\025+\3147\226\261D\2236\367\303"
+	.ascii	"fS\330\024\035\270:C\262,gh\373\037\037R\226J\312V\331*;e\247"
+	.ascii	"\314ezD\335\332\364\340\306\356\326\226Q\017\330\031\220c\333"
+	.ascii	"\377\334H\377\323\302^\013e\257\271\264G{4\227|\221n\320!H\237"
+	.ascii	"*Ft\224\265\275\017]z\2372=\275.\037\035sXi\316\3511FG\226+\310"
+	.string	"h\\i{\237\254\3647\343\304\261\273zpxr\360\360\304\350\322s\0326\335\270I\246\265i\303KN\336+\021\256\036\334X\0226lxYt\217k@(\202\354\231\221\246Ic.\327\200\330[\252\271\271,s[\302Q\361\337\207\344\346\003\357\315\2313\r&\235\262\272\027\213\203#q)\227\0321ym\317\263,S\306\254\203\252\241\201\226622\274\3141\353\272\270\240\246JlL\333\363\254\2051\307\2041\311\240\367r\262\353\nIf\347\207\023*\034m\345\344\3149\276\3105bbn\316\351\250\b\223\224\301S\226\236'.\216\3378\350F\311\325\020\343\221\221\376\246\027\245\351\245\301\37048\322\306\203\225\376\346\fJs\006\023\216o\225{up- \213\030\232\2636l\\n\302\375}4\2650\033w\335;\345\336[\301\tk9\204\2645\267\034\335\344\262\200\0379\224\004*``\005\237\242\320i\205b\260\007"
+	.string	"O%\212\301\237\247\325\202\342\005T\024\277\024\236V\016D\303\340o5\026\207D\240\257\250(\375\222\007\245ap5\026?\250INB\3400\370a-:}\330 \024:\r\207\304\241N\b\210\353\222\2218\3249\361S\205V]\235\232\354\272\004\\\215E\264\204\206\"q\005\006\231P\023O%\206\276\344Ae\n\032?\024W\025EpM2\"\025U(\006\205\302 \023\372%\017ME\246\017O+\005\306\340\220DSQ\205\247\325\367\200\013\220`AD\b\244\007\214\250\200\nH\"J \231 !\004\200/y\370p\002\203$U\030\374\r+p\202\303\227<|P\n\236\030^\240\256N\306\237zB\347K\036\212K\306\037\323\207!\221\211\211\b\264`\347K\036&\300\002\t\023\037\214\252\322\3723j\360\002\220(\024\241\256D\021@04\021E\370\be\020"
+	.string	"\030\232\210\"\004`\374\222\207&'\342\252\204\264\252F\225\351\267\376\232>"
+	.string	"9"
+	.string	"\016\235x\206'\372,\")5\365\030\221\206JM\347P\251\311TE\020,\332bQ]\223\222~:04\021\201v56\231I\352P)(\374\351$\251E';$\006\215@\265\250\363\025I\251\311\203\017\f\253\261\030TRKl`T!\360\264\006\005\213\305\325j(\226P\213\353\257\t\310\030b\347g\374\215xZ\177\324\225xBu\200\206\027\200\352\222\210\247\325Ger*\252\353O\211\246\340\013E\037a\3208l\201\202\241\332Tt*\002\251k\210\247\265Hi\030,\222xZ\2078(\266"
+	.string	"\303O\250\216x\372\251P\"IU\207\033\214\301!\211\247\025-\256NBa\b\016vH\2300Q\302I\210\003\325\370Kjj!i\350ARP\370\273@\361i%J\"\006Wu\205\242\320i\205!\t\340:\364B\361g\\R\n\nQH\n\n\177(6hP\223\210*\fI\024I<\255\031\004\rU\024\301u\304\317\370\033a$R IE\021T\201j\211\247\025\203\325\211\030D\361[R\035P,\022' \374\r\225\202&\222\206!\214@\325\250&m\200r\360\003\202\007\343\372k\362\240:\t\177\027\020\006\177'\236J\030U%\"\343\320\211(\342'\004\277\022\300\365\204\341\267\256!6(\252J\303_\210b\322O]9\f\211\306\337\352T\002\006aS\323/\203\035\020<\f\177\252\n?\343o\004p\355\321p\344!I5\002U\241\220(\342i\245\300\027\202\207\"\217*lb\372\231"
+	.string	"\256>\252\322oUQ\204P\032\006Q\020U0\376\204N@\341\017\210\201P\3504\004\022QB(t\032\372\024\005PD\032\242`T\213j\t\245\246\f\016\f\256\352PUJ?\002\t\007 \241\204'\235\227`\002\b&\200\200\276\004\023\216\216L \341(=\tGfqU\215Fu\002\3005\350KJ'\324$\240\007~% \200\004\020#\210\020\302\021\013%\036\020\202\310\210\3643\n\325\021<L\252\261\b\203\t\240\003\201\214F\244b\013\351\372[\002Z\243\321\370%\017E5\211\310\204\004\\?"
+	.ascii	"OphR\215&\222\206\252N\021\t\370\323\244\032M\030\327\237\261"
+	.ascii	"\350S\225\206\277\365,\"\r\211Ac0iH\0241$\006\2318\250HI$\236"
+	.ascii	"\210\036\320I\"\241&\021\231\320'5iH\302\351\007d\034:\001{T"
+	.ascii	"\343\257\304RQ]O\250%\236V\237\325\270\302\020\205\237\3617\""
+	.ascii	"\004\277\022I?\265\004p\345Y\215+h\030\242Pt2\376\214&T\246\337"
+	.ascii	"\212\002p\005b\n\032\207N%\236V\241\247u\247\351\307\004\\\317"
+	.ascii	"UM\n\242 \256MHO\253\360\027"
+	.string	"\\\325\242\320\220\030,\026\235<P\374yR\205MN#N\b\177K;B\"\220h$\256M@F\244\020DH\n\372\214C'\"\020\351\304\212\024l*\"=\255\025\250I\301uUQ\020\221\206A\r\214H:J?\026\210A$%'aS\221\220Q-\252+\321\350\364CJ\032\006=\200d\374\025\221\230\234V\343\013jS\021"
+	.string	"=\252\360\007,\356\030W\025\3050\210\024,\026W\036\340\232\024d:\207A\246\364\005\240\272\004|\3721\245@E\341\017\305\220\0304\376\204\304\246U5\016I"
+	.string	"\327\n\212\252\272*\251#T\241\3220\004\323O\004\212\246\023\032\222\204\304\245\242\272.\261\240\032\177(\202F`\b5\211\250\302\032\374\025\r\203@\265\350\204\364\364cBzZy\200HON?\244\247\037\023\220\220Ht"
+	.ascii	"\322\251clR\215E\253\236\370\025\205\301\037\nO+\007#R\t\306"
+	.ascii	"a\320IGM\"2Y\343\227\206NlR\327\017F\"q\375\300\363\364c2\213"
+	.ascii	"HJ\301\023C\242\bUi\370+!T\207\303\337\222\210\247u\203\021\211"
+	.ascii	"\204#\3430\350\224>\001\t\020\241A\013\024\200@\n\364\360\264"
+	.ascii	"~xZ?\f\203?\246\017\300\265\370\301\203\206a\220\311\374\217"
+	.ascii	"\316@\267\270`-\t\323v\017\305\342\322\"#\303V\2411\030\r\225"
+	.ascii	"1%g\r\325B\265\314\267\007\325@\223\264\025\251H\177\364\305"
+	.ascii	"\tE'\307\024\252/Y\346\022\325csV\005\353\254\261F\211\033 \310"
+	.ascii	"\244\033\230\265\030\350\2259\307\306\256L\223\266h\213\021\272"
+	.ascii	"\356\205BY\240.\216\266x\022m\0014\007\210y\203.2\345\205\036"
+	.ascii	"j\255\254P\025\032n\327\275b:T\252~,S\034U\241FE\026\231\n\362"
+	.ascii	"\320(4\n\245\342\213\034\341M\027:u\224\252\312F\332\221\266"
+	.ascii	"\250\024\277\351\271\230!\325\366w\276\036\025YWl\264}\005`\320"
+	.ascii	"#z\264[GK\342\254\354\355\231o\274f\004\273\256$g\336\231g\267"
+	.ascii	"|\027i\247\201]\\\0055\322$\005[I\\\310\271\"c\271E\246\355\031"
+	.ascii	"\207\002\327\213+n\334\234x&\310\231\241\302\202\367"
+	.string	"\346'\236\331\246\247\347&VAU\372\237wX\\ZY9\332\252Qs\332\261\371\300,\214\331\030\233\237vnTg\332\204i{\256Y\346\245\377\231\206L\001\252X\264\321\321\235g\030\211\274w\353\232rpTX\306\312\374<c\246\225^)\264\234f\316:\337\023\0268\224${\300\331\255\211I\317\271s\314O2?\311\364I\306\334\333C\231\210\211\202\2121\337\244\314\340\361%\027f\225g\340\344\205\031B\227\203l\005\03006hSs\332^]\375\350\352.;\372\bk\233\374\t\342\242G\215.\326g\017L\233.\270\023\006]\027\030\213\223\313\351\203\013\333\221$[\232+\225\222&n\205\026\2621\035[\316f0c\300`\202\006vVy\225\363\355\032\240\356\215\272\327\306\030\b\247\225\237o\247\033\226\031\033,n'\226\030\242 Q\233\303`Y\252\262\316+\235\206\221o^\314mX;\247\234SN6F\"E"
+	.string	"\363A\205\005\357ni\031\261QI\313\200pqQ\221\001M\222\004\214\334^\321\223\"6\332~\303\223\364?\327\352\210D5\201S#bU\220\205]I\201[\241LM*\315\374\321\2635\225\346$\212\371\345\304\312\215Z\204\264\250c\021\244b\\\252\006)\f:\244\230\241\221)\232f\fs\025@@HH\036\023\213\310\321\036\023@CJL\346i\032\310\030SC4\222$\2511\355\006\356\214\202T\340\202e\020@\263\255\256\265\343,I\272\026p+\303\336[)\364\356\"s\314\305\360\352Y\216\226S\264\344p_XBc\354o\020\253\275 \376\"\312\310(\205\2416+8\350\233\242>\3704!k\223\r\016\371h*o\310d\214\2647\327\207\t+\340t\034,\216\356[0a\351\2676\355\351D\002\376("
+	.ascii	"=\227\b\021?\364~>\374N\341qD\254$\343\t\310\224*<\301,0)\235"
+	.ascii	"\021\350\002\211k\345\340\215\021\353\2151\355\016\002\024\342"
+	.ascii	"L;S\200k\347\221\243\221\326\325L\341\214\314\020\346/\243\272"
+	.ascii	"\301\022i\037\342\345w)\315\247\367\236@\364\306\241\252\025"
+	.ascii	"\216\006\260\327\256\336\256\240\365\026\337a~\245~\341\325\215"
+	.ascii	":\276%\001\203]\200\345\001z\247\326\\-C\371\351(\020l\300\024"
+	.ascii	"\330\241r\204@\270\223y-\2363R\3349\310{\305\312W)\231fA]|1\002"
+	.ascii	"\257e\270q\0020~\342-\265L\374\222b"
+	.string	"\356\320\256\347\025^U?\373\320\337\311\372\\x\220\002t\371\253\013\252\335\356\355I\241\361\260\265Z\336\3562<\n\003)C\333\2106\275$\t\341+\\\274u\361\340\214%SO\213\357\277j\013\350\200\2161\301\005PG\007D\2720i\303\024*\323N@Q\375\261\317\226\340~S_\203C9N\257\367:\034\233\\\376\372+\025\"\310\013\350\035\033\341\002b\030\312 \300c\315\313\345\321\207\220\250p\311\235Rwv?\321\224\326#=\3428l\375=\264?mO1\035\300\212ah\330\2378f\025I\207MFzHt19r\253\243<\277_\026\220t\321/\223\341)4\240IC\367\350XN\313N\377_\316y\221.\256B\213x\252\033L\236\372\3732\353\370\210\340/\353Y\223Z\340-\030=c\232`K\254\226\227\2454\330\377\264P-\n\266\220+/\277\253\032\365\345\203\352\336<|\202K\330\r\355\227\001`"
+	.string	"u5\211\200c\243\005\246F\365\302\364\354\250[_\231\256Q6\005\007\331\n\265\2616d\352\200\250\363\215\f\251t\354\265\315}\370\203z\274\301\034\007\347\216\024.\265\2409-\263\315\321\314\230\003\313\2329p\274\241\204\324\335\212\354\224-|\371\310\367\257r\331\267\205\321e\256*\3352\201\034{\276\201D\275\031\347y\323\240tRM\273SF\\\314\t!\n\255\316<\231\265\" \213\314\231\031\t\314\323\330\336\224\300au=\207\035\b\246FhC~\276\311\206\321W?\237SM\311T\352Je\356\246\200\r\354\313\260\343\277\353\347\216\307d\341'[WE\316\233b\342\375LL\024=9\332\204\022\027)"
+	.ascii	"\006\0343%\036\340J!@\036D\013\367K\37364-\307\300*\326.\344"
+	.ascii	"O\247&\316\200t\024y\306\177\0247\312\306\367h\265\013\245\322"
+	.ascii	"n\t\353\314\326\374L\306\342\003v\216&6w\2261&c^\255\033\313"
+	.ascii	"c\301s\375\362l\261\260}\326]O_\200\301\236~\306G\261\247\205"
+	.ascii	"r\213\033\217\332\355{\254\355-\bYG\271\325\034\265\226\224\r"
+	.ascii	"J\245\017\310\330Y-\230\353\005\214\002\2559{\023\331p\364\225"
+	.ascii	"-\344\355\314]\206\207\207\340\256\316\257\235\322`m;\tJ?7-\222"
+	.ascii	"b\323ROu\b\205*\022\210P\236\f\025\325\262\007h\027\374\276\321"
+	.ascii	";Rqz\214\247r|\362\220g\224|\377\220\362\2302\n\331n^\314\300"
+	.ascii	"\311A\231\222\2668F\376\201n\347\242$R\250\t\344\272\257\373"
+	.ascii	"Q\223_1\264\222@+\007[\035Z\240\013\322(\371\013\005\344\343"
+	.ascii	"\370X\331+\215\203\364\b\335\034U\331\247B\206\221P\032Q\027"
+	.ascii	"[Q\203\313\023\260t\316\355a\365\016\312o\374G\211\351\006\360"
+	.ascii	"\212>\275\2378iu\336+\246$C\345\001\343\006\276\016V\336\323"
+	.ascii	"\356_\264\006\355\005y\033\256*CLw\232\037\326 '\264\241\330"
+	.ascii	"\262\n\276\341\341$\340\351\315C\334j\227Ui\026\324,\300"
+	.string	"\271\357\360\267\314\b\r\022\177\350y^.\361\351\263\025\274T.\362hL\354\323\ty\226\340\346\257\251\360p\027s\237T\356*\226\373\207\273\227\351.0}\026=A\316"
+	.ascii	"\221\034v\231?\236$\270=\206\3622\036>N\246\271\262FH\363\327"
+	.ascii	"2\264\257xO\342\206\276zi\254\rGZ\360*\373"
+	.string	"\261(\313hN\020\374<\027+\233\266!e\036\201\312\210\226\370f\264\207\264\315\023\226\020\020\343y\267\272s\226o{\267\312\254b\210\037\201\341\033\n\"\002\255\276m\234B\350\352F>\026\272\365\231\021|S98@\222\031\320\025\023\177H\325O,\020\370\217\030\203\"\302\375\016\t\301.9\233\207\361\3239\316k\005\"V\026C\247W1\354J\257@\331\354\204\372\377\262\225\354\177\006\322\353\364\2701RL*\277\032\311\004$A'\254L$\253-\221\353|\f\345\312T\357\201*\253:!\036\301,\340g`\316\364\316\t\006\256\243\230\356\301p\035^8\315v!oP\371g\306g\346Q\360U\007\210\f\341q\300>\367CLc\254G\202\265\232s\310\375\276\003\023\231h\205\344\221,=\256\276~\231\276\377{\247\250/\311\222\313\222\335\217\347>\013\271\270o\317\265\242\246<v\305\372\2513\300\210b\326\217#\313e\333"
+	.string	"Yh\215\005\2335C\273\013\032\370\353\312\334\300\021\312\206\262\007\236i\303\324~\003 #\013L\240y\304emM\024\016\327\206R\222+\263I\006\355 \375+\rB\376EG\021\263\210W`\b\024\366\235O\270~\262\232\013\241\216\275S3@\264\352Hb\026y\357j\252\001Qi\274\325\02501\227l\202\211\200\257\270oS~\r\313O\022\020\337~\356\201\352\246\013G\312\272A(3B\325\320\230i\302\3023V\200\021J\002\244Fr\325\232\267\231m\267'e\321X\246\341\200\034@\220\316\363\262\005\345\326\364\373?]\275N\261"
+	.string	"d\370jL \3278B\256x&JAJB\307\356"
+	.string	"\365bMl\177\275-\362MZ\247X\225\345a\267:\341s\217\261w\301\315(\267m\316\t\230\247ser\f\367\200\036\206\356\004\007)\207i\332\334C\f8n\002}\244\264\244\354q\007\344\005R0\317\274\360\370\374\265\371\331\001:\217\f\275\226\223\024pM\2531\215\020\234'\306C1\243\247\260\036\2625\377\306\314_\273\264\276l\177\340\225'\201E:\217\315q\362\342\204\220)\323\256\362\2061\\|\325^\201\b\0071`\207\356\236{\2474\2602\007\305}(\330\362l\256WT\277I`/\005\320H\fTg\006\322Jy\204&9\001\231\377\223\036\245\325\327\001G\341Z\225\234\313\267\207\301\227\322\006AU\224$"
+	.string	"\335S\267\362k\241\033\t+\234\341_\371;\304\306\020\3079L\304xSI.\203@R\022\217Q0i\206\216\035\370\0370h\250\376\334\365NF`\\\221!\302`xq\341\241\3377.\235\332\207\213\351\355\333\003F\b/\273\207yw0\235\002\020\016\337{\263\021\027w\360\0341\2625B\3302L"
+	.ascii	"\006\204x\306^W\371\237*?4xhc\rq\261\3610\253\316\360\223\326"
+	.ascii	"\372\242\222\241\262\223E$\241\361\301(\371\370Z\\ia^\312GF\317"
+	.ascii	" 'V*\002F\336\226\024\341\037f\357\025z\370\302>\205\2145au&"
+	.ascii	"\217\363\205B\236\252\321\343J\263\021\206\367\034\334\370\350"
+	.ascii	"\240\322\351\260:K\307\007\324\365\327l\255\353\267\311\232\253"
+	.ascii	"\375~*0\036\270(\004\002z\352\025\221\fa\377\027\320WUPR\225"
+	.ascii	"\322\037\001\323\003\341\222-W~}\022\370\001kKk\025\023\377W"
+	.ascii	"\204\177\352n\347\001\257\001\344\221\334\334\267\364\004\372"
+	.ascii	"~\301l={\004\317g\037\351\024\277\363\321MX\264\021\374|y\256"
+	.ascii	"Y\025|Vt{c\370\354\335\031\222'\2312\231\364\331XV`\177\204Z"
+	.ascii	"\377&h\001~B`G\256\277v\234\371k\276\325}\357\375\017\373\320"
+	.ascii	"\354\327\277\236NJ\231\034\372\326K\231\307\222\347J\337\306"
+	.ascii	"`\346E}\261\365+\335\270k\336\303+0\266v\312\211n\250\363\036"
+	.ascii	"\324\270\260\254\311w\0304+\037\313\333\215\311{5\363(\370.\345"
+	.ascii	"\366\357\270\362\247\177\333\345\361\327\003lh\257\356\273?\323"
+	.ascii	"v\177~\315R\341\356\034_[W\361s&\321aI\300\226\253'\335\313]"
+	.ascii	"\336\272\367\246\375\226\253]\356\231(}/\372\375\326O@\356\n"
+	.ascii	"\325\003\356GJ\017\335/4\374KhcB_\004\217\002\202\343\372\256"
+	.ascii	"\377=\"\270!\360S\245\003\206\213\246w\377\373.oF\223\231\210"
+	.ascii	"\207u\311\021\374s\353\255N\327?\013\033\257\373\217\374\277"
+	.ascii	"\234=\303o\200\t\277\033d\223\260\355\207\257\237\216\034\341"
+	.ascii	"\214\373q\362\350\202\367_]\377\377\311\237\377\310\037\353\302"
+	.ascii	"\373\324\341f\317\034\034\255\334\336\307\314c\003^\266\340\370"
+	.ascii	"\261\311\335\277g\030\376\332~\304{\23061\377&\005\353\303v\276"
+	.ascii	"\345\037\005y\220\370\327\2309\251\033?T\364\332\365\035\325"
+	.ascii	"\r4\351\311f`j\217w9uZ$:\257\313u\2229>\246\001u\356\3276\223"
+	.ascii	"\211\364\363\222\273+"
+	.text
+	.section	.gnu.lto_.symtab.d1c81fdf4b442c9a,"e",@progbits
+	.string	"pgResetFn_rxChannelRangeConfigs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.string	"pgResetFn_rxFailsafeChannelConfigs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\001"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	","
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"rxRuntimeConfig"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\030"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"rxChannelRangeConfigs_SystemArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\001"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_SystemArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"$"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\001"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"$"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\001"
+	.string	""
+	.string	"rcInvalidPulsPeriod"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"H"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\001"
+	.string	""
+	.string	"resetAllRxChannelRangeConfigurations"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\002"
+	.string	""
+	.string	"rxInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\002"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\002"
+	.string	""
+	.string	"rxAreFlightChannelsValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\002"
+	.string	""
+	.string	"suspendRxSignal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\002"
+	.string	""
+	.string	"resumeRxSignal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\002"
+	.string	""
+	.string	"rxUpdateCheck"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\002"
+	.string	""
+	.string	"calculateRxChannelsAndUpdateFailsafe"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.string	"parseRcChannels"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\002"
+	.string	""
+	.string	"rcChannelLetters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\001"
+	.string	""
+	.string	"pgResetFn_rxConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\002"
+	.string	""
+	.string	"updateRSSI"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\002"
+	.string	""
+	.string	"rssi"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\002"
+	.string	""
+	.string	"rxGetRefreshRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\002"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\002"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_CopyArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"$"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\002"
+	.string	""
+	.string	"rxChannelRangeConfigs_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\002"
+	.string	""
+	.string	"rxChannelRangeConfigs_CopyArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\002"
+	.string	""
+	.string	"rxConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\002"
+	.string	""
+	.string	"rxConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	","
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\002"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\002"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\002"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\002"
+	.string	""
+	.string	"failsafeOnValidDataFailed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\002"
+	.string	""
+	.string	"failsafeOnValidDataReceived"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\002"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\002"
+	.string	""
+	.string	"rxMspInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"failsafeOnRxSuspend"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\002"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\002"
+	.string	""
+	.string	"failsafeOnRxResume"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.d1c81fdf4b442c9a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
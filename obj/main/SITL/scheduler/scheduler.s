@@ -0,0 +1,1063 @@
+	.file	"scheduler.c"
+	.section	.gnu.lto_.profile.ceda7029d4200bb7,"e",@progbits
+	.string	"(\265/\375 \nQ"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\036"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.ceda7029d4200bb7,"e",@progbits
+	.string	"(\265/\375`\372\001u\f"
+	.string	"v\320?:0s\322\001\314\346\312\364\206\236I\274Em3S(^\307f?Y\374l\201\t\264!L\331h\037T\241\016\006\006\006\006\006\006\nc\252\377\377\373\332\356\275\311&\233l\262w\222;/"
+	.string	"2"
+	.string	"0"
+	.string	"\355\235\270\226\206eWO\t\253f\324v\336\352\303\372\363\202$\247\2319/O\237\362I\330\274\272\340\224X\375\367\343\343\247\375\210\030\241\211\242\370\233\005\004\003\002\332\305*F\240)\024"
+	.string	""
+	.ascii	"\252\257\362\025\2738\025\236L\253\352u\302\341Y\1772@\213\373"
+	.ascii	"g\217Z\310(\225\263QY\202\341h\331~\3774\007\030,\341\202\302"
+	.ascii	"\375\375%)\2440I\2409\246\003[\020\2424\275:R\007\267;2 (\203"
+	.ascii	"\355\364\363\364\333\373\333\357v\373y\373\207\273\261\022j\004"
+	.ascii	"\321v\336\352\023\341\327\343\347\220F\002'D\034\376,\353*\345"
+	.ascii	"/\355\372?\323\356\343K\b\254F\205\242\323@\245\307\213\317\005"
+	.ascii	"\303/+F\005B\250QEAd(\003-,\264\035`\002b\306\246\007\021\020"
+	.ascii	"=\003\251\022RP\230\fsz\024\312a>)\342p\320\333S)\335\227\372"
+	.ascii	"\037\002\271\261d\271rf\315\340\007\344E\0067yK\212\306\034\347"
+	.ascii	"\303\031y\354\3562S\304\256\017+?\277%(v\032\201\351\314,\334"
+	.ascii	"\356_^\032}r,\031\357\223\013\332u\273\307\350+\202\304>\021"
+	.ascii	"\026\267\344\034\007\023\326\204\f\2318\213~\f\306G6h\2258\225"
+	.ascii	"!G\024}GQ\237\325\005\201;"
+	.text
+	.section	.gnu.lto_.ipa_sra.ceda7029d4200bb7,"e",@progbits
+	.string	"(\265/\375 \320u\003"
+	.string	"\"\304\f\025\260\031:\f\3030\f\3030\177\313\302\226\021\233l\r\221\225;\245NuI7Z\350\237\235\331<\363r)\213\034\323\230\305_\304\260\023\026\354\002\365&N\001\031"
+	.string	"2\0010H\032\363\002A``\232\312\271\226\365\023\326\3640\030Mj\255\256uY\304Y"
+	.string	"F*\366\326\034&e\007g"
+	.ascii	"X\314B\244\347\341\227VT\020\277\330\261\001,"
+	.text
+	.section	.gnu.lto_.inline.ceda7029d4200bb7,"e",@progbits
+	.string	"(\265/\375`[\004\035\024"
+	.string	"6\333_C"
+	.string	"\223\223\306)\212\371\237.\205]\261\200\351\224[!\r\332)\3313\362\035\366\361L`3\265l\307M\255\227\346\017\347H\241\031\353i\377\272\b@!P\265\221\n\205%\234\207\234 }\255\374\221\332vo)SA"
+	.string	"O"
+	.string	"N"
+	.ascii	"\312\275ILo\205t@\241,\202!\276ICt)Vf\322\022]\212\205}}\376"
+	.ascii	"\357\377\300_?#(\nn/\276\230\225DV\370H\327u\323\335tw\027\276"
+	.ascii	"\037\244y\236$U\355n\374\222;\016\002>b\304s\257/\221\346xq\241"
+	.ascii	"\322S\336`\205\335=}\3745\315\224IMY\362A\324\264%?Yd\246,\277"
+	.ascii	"\200\204\0203m9\306\254lb@c&X j\234\320\004\311\300\243\344\221"
+	.ascii	"\\\005\005\327\321\3531\344GN^\300q3\223\242\001<\241,\345+\023"
+	.ascii	"q\372\025\372\032i\013\247\006\006\036\002@B\341\016\214\225"
+	.ascii	"M\214g\002%\227\214\364\270]\r\240\033]\252\305\340y\350R6"
+	.string	"P\036\360?\225\216\335\305J\312\255y\002\374$\035y\252\335\275\376\220:{TPy\366\230~\266\351ID\257(L7\303-XQ\022\335\fg\262\002\0033\264\b\023\333\020_\302[\261\332q\"s&\250\313\213\026\227/'x\361\261Fp\215\256NIipjF|>\260\275\023(z(dV*x\363^Z\034\200\264H\250B\306\007\032\330\005\366\274\223\246g\311\002\266\t\274\262v\250\001E\250\314\310\320L\013\222\351p\002\231\231)\365\022`\2261\344\254\221\"\031IAa\031\2514\007\227\033\232\376\212m\021\236\265\370v\211\254\307\353\335\350\017pT,\023\246\024bmHT!/\231\035\272\334\205 \233\206_\245c\2659\240\2739\031\260^p\330Ro/@\376<\330\213\231MYF  \301f\376\363\303\250\212\327^\243\f\342\210\207\203P8\261\331\270B\335]M\024\f\177u\004}\311\264\335:h\345"
+	.ascii	"\337\201\260uO1\325@\f5\025\0078\272+\237uQ\231\302\375\200r"
+	.ascii	"\370\b\260d\035\322=\300\025+H$\037\365\262\377\225\013x\341"
+	.ascii	"\256C\371\335\255\023\031\243\372\224X\3563\261\0071P\220\200"
+	.ascii	"\352\tW\240o\356r\363\334\202g\254)\256\367\331rV\225\344\"\241"
+	.ascii	"J[\340\363\006?\320M\2209\031\261gA\231\224R\346\3502\344FZ\032"
+	.ascii	"\016w!/v\032\337/\302\365jN1"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ceda7029d4200bb7,"e",@progbits
+	.string	"(\265/\375`Y\001e\007"
+	.string	"\222\n\"(\220E\351\371\273k3\"\274\322\377\352Q\213`p;k\271h\004q\321\201f\345o\177\221[\355\266=i\304\006{\247\224\002\215\236\313vH\331dR66.\204Rid\275e\374-\240\342%\232M\306 \242.\306\030\235\354\356"
+	.ascii	"\031\036\030\231\320\016ZA\233\207\317\367t\366!G\022c\f\030"
+	.ascii	"S;\300\326\330\031\337\275\274\355\271S\312\224\013\320\336\372"
+	.ascii	"\341\247\247fO\355\256\345\254\252Y\345\026\276Z\313\336\335"
+	.ascii	"s\331\215\372I) P\242b\314\354F\033\200\\CBb\262\370\227\341"
+	.ascii	"\231uay\340,{\274q\200ZN\300\"\202/\354\361\022\367\260j\370"
+	.ascii	"\223\030\271\r\204\264H\341\324l\342\025\354/l\370\341s,\036"
+	.ascii	"\227c\001\230c\001\302}4\2203\275\301\326\325(\220\363\372\230"
+	.ascii	"\207E\304G\033\312\205Uo\307\222\236vO\341\206"
+	.text
+	.section	.gnu.lto_.pureconst.ceda7029d4200bb7,"e",@progbits
+	.string	"(\265/\375 A\355\001"
+	.string	"\022D\016\030\220+\035\377\307(\313h\315\314\3144\252\352@\331w\213\271\357\253\022\242vW\321\205\346s\235\331L1s\271\312M\3561\215YL\342\033\246\360\005O\300|\256k\210\231I\001"
+	.text
+	.section	.gnu.lto_.ipa_modref.ceda7029d4200bb7,"e",@progbits
+	.string	"(\265/\375`\006\002}\n"
+	.string	"\222N**\220\247\031\016\217\346_\377W\310\373\357;]yw@\274\210\033\210\375\002\037?\261f\375\311\250\321\002\216\026\r\275u\023![\312\024[\225\365\200T\314\326\003R)7\241\023\241\363\240\323\240\311\224t\321\321\366\243PL#\361\030nr\312\235\245\217:\241\2668zZh>>fna\022\243\310"
+	.string	"\265i\370\234\362\215=\311\035Un\224Q\333r\225\340\263\263\214z\316\031\245[\032\350L\345S9P*\256\300R\342\013\312\333\336"
+	.string	"F\036\b\300\b\237\206\370\2452\030\033\205\347\242<q\345\321r\261?\241\362\247|\266\334\255\370:\004O\250A\271s\260\246\251uP\2021\203\314<\021p%sNRA!\323\030\344x\340\357\375\027l\200$S\0135\271\331W\032\241%K\032\255\036\230.\030\334"
+	.string	"\313\271"
+	.ascii	"\343O\275\257\362\0307\r\320X\310\357C\004-t\222\2770\013J\003"
+	.ascii	"#U\354\214%\024\0208\217\250\013\200\362\234\202!\016\364/\306"
+	.ascii	"\r\317\027\207KtA6j\2021\033\262Rm\b4\003\200\036L8\007\356e"
+	.ascii	".\034{\013\nc\023\364\275D\217\006\271<jNUfe\221\253\236 z\377"
+	.ascii	"P\034@\333\037N\310\017\224\202\320\007\035\f,h"
+	.text
+	.section	.gnu.lto_.lto.ceda7029d4200bb7,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_queueClear.14.ceda7029d4200bb7,"e",@progbits
+	.string	"(\265/\375`E"
+	.string	"\035\b"
+	.string	"\"\01777@s\322\001\020\027\035\241W\202\324\374V\366\311]\017s@5\344f\250o\0300\022\002\324d\233E\205\f\013$\324\216\241\314\270*\f \274;\233\223\217\355n\273wJ\001\246@W\365 b\250\032\250\020\215pX\200\240\324\025\242 \003[\022\325E),\353\242\036n\317\331HR\360\360\266\210\341bI\223\356\364\271\317\362\3160~\311\0236\3314/%HwB\263\301\317\023\376\343\216\231\237?\345\034&@\262\273\275\372*_\021\371\245KW`\360\365\322\307\346\245mq\001_=\360y\032Q\2639\r\306\020\373\234\215$[\"\210\020\324\354r|6\353\311\227\022\333\3678\263g\n2\002n6ZN\273K\343\310\263\303\314?\312\001\352H;\354$\354\256a\035u\334\361\266\017lS\3332\001\016"
+	.ascii	"i\3317cz\375\206\207\246\025p\0070\013*3\244\332>\\9\343\302"
+	.ascii	"\270\nV\274\f\021.\307\242\235d"
+	.text
+	.section	.gnu.lto_queueContains.15.ceda7029d4200bb7,"e",@progbits
+	.string	"(\265/\375`\211\001\315\017"
+	.string	"\246\336jF\360\222(\0350]\335\362\255\207$X\3441U\317L|\224?\025}\370N\250X\363\2512\257\201iOz:\332\366'K\327A\317\t\360e[l\006\236\021\332\365\003]\352\022\3157S\177\351\221\273i\210%{K\231RW"
+	.string	"R"
+	.string	"X"
+	.string	"\017\240]n'\321.\025\234\234\334\3753\021s\022\0358\274\350\231\363\343\266\204I\036\277[jwM\306\325\316G]\033\361V0\236Je\215\314c|\360Zqb\304s\211\013\013m\200\274\225\356c\327\032\241\212\207\314\223\271~P\346\234\326\027\017\304\375\271\355\316v\003\373a\007m~\315\352x\360\336U\253\252\277-\370z\202\b\3701g\314\254\310\324!qR\034\274\375\317\217\031\344\2738\354t\320:\033\352\303\026\202\036\200\3149K.}\262]\022\210\267O6\310\266\252}\026\177\235n\323r"
+	.string	"s\266^4\346\374\0208\301v\351/\316\321.u\007\360\260R:{\234sNy\340\273\237\275\n\226\220\325\b\225\316T\206\210\326\215\270.k\373-\201<.J\304\2667<F\3136\347t\340\303xh\362i.\275\302\242\177\271\364Y\366\261\033\250\t\207\340\244t\266;>`\262]\227\375\241\224\301\016\0343\336\226\035\243\221V0\245\250D\207LJ\"\013+\023D\024B&\016\303(\345\002\027*\2318\223\002&e\020\2258\025\022\251\304\371\233\337\226\337\342\021vB\2047\322\357\264\307.a\207\025\336\354\337i1\256QR\253B\241\255\313\240\231\370\331\355\241%\337\205\261\275\020r\\\366\031\326\361i\254\3019\001\036"
+	.ascii	"h\3553\\6\276\252\271\243\302D\0321\252\305\020\306\375\332\220"
+	.ascii	"\nX!\264-)\boL\024\317\013\n\363(h\242%>1+\212.\244\270\310\340"
+	.ascii	"\304X\325p\317\3058w\241D\250B\271\246\316{\266}jiS\275\366\022"
+	.ascii	"\346\023"
+	.text
+	.section	.gnu.lto_queueAdd.16.ceda7029d4200bb7,"e",@progbits
+	.string	"(\265/\375`\232\005\225\""
+	.string	"\366\275\327F\200^Q:S`\"\245#lU\232\256\3323\345e\327\216\223s`\031\321\346\314\210+\351\321\013\031j\224\205x\244\224I\017E6\353\206\303\250f\033\352\3340vLq\306\232\237\253\222\314\334Z\371\2154B\210\224I\006\303"
+	.string	"\267"
+	.string	"\310"
+	.string	"\245\214\335\364&\3576\355\246\273\313\274\373\341\261\232\236\245;\256\326\340\325\227Z\211\r\366\001zs\211\037p\336D\037\340\274\t!B\323:\235\210$\307\213"
+	.ascii	"\243\270\370\324J\314\365\021\034\316\\\241\227\304o\332N\257"
+	.ascii	"\245\264\031*\263\235f\3317v\332?\275\366%eu\214\342\324\310"
+	.ascii	"\210\216\252\323<Te\031\366!\242\303\3523*"
+	.string	"\264\304\200\364\221\343_R\277\222\227\204\341\371\021\b\313\016Uu[\220\3636\325\333\261\t\245\307\313\362\002\326U\222\333\024\257l\255\342\230\033\3175\246z\334h\217\337\312\005\3003<\376%\005,\007\260)2\347Wn\024E\312\212Y\226\241\326\272\354\233\322\361\005\360\3357\330\335\t\273\346\202\277\204/3Jn\035\334\344\371&\261\225\206\307~v\337\345^6\271g\262K\213\344\373\026y\336|\377\312\371\352\306\020 \326\017\212\307v\211;n\241W !\327vp\t\024\0211\357\220\320\267|q\317\372\203\226\327v.\337Z\311\233\312xi%\357L\306\213\236\274\262\223\367,yM\223\2674y\233y\271\344}\001\333\035\240U\021!\r\207Xs\214\375\251kL/'\337\362s9\357\022\367\307M\233\020P\221\031^i\371\226\275qS\256\246cyqe\234\270\037n\f\001\016k\255\307\262\347\332k}K\306\263l\362"
+	.string	"\217X\247.\374\356\f\371\324Z\217nn\004\364\346\201\247\323\213\262\343\2615\373\354G\005*\352\267\331g *;\275'D^u~\314\312\356\346\254\2553<\366\203&D\331O\206e-\322\315$\241\265\362$\354\313\3148\321\335w\200M\262\240x\354\214\265K\023\205^w\362\356\2328\2311\334Vn<a#\215'BY\202\0354|\266\016\356\213\327"
+	.string	"VU\3542\217\374\215\347"
+	.ascii	"\366+v\365k\354:\235\004\004\360\021{\322\003&\266\344l\341\246"
+	.ascii	"JJ"
+	.string	"\242n\261\333\321q]\243\337\177S\326Z\253\311\340\270&\352K\371\355\351\001w\306 A1e\013\207:\250\231\266\302@<\214\016\255\265R\330\203\271\227\322\236\311\315M\261b\305ys\250\255\330\030\002\261\274\032L\216\026\227n\341\006JJ\234\342\305\b\030\345\"9`JR\021\243D\022\n\244\0279\026J#V\344\220\230^\344\034\030\355R\213$\246\034\214\245%\246\334\022\241\336\301e>\362<\236\003\330U\261k\366\344\177\345\033\300\222\024\273\322#o\263\365f\200\352\235\226Z\025\232P\267\230\355\350\265\232\032\036\3739'\215\307_Zk\241\376\361GP\222[p\2640\224)Z8hh\255\267\224\325\272(\3559\367\345y\247]\201j\254\007\fj1\235\201\260\331\323\030*V8\2265\332\264\336\0251\202\357[\013Cz\375\264\3737.\206\342\250\270\033\235\002$mh\315t\030\274\250g]\002\352\001w\377r\341"
+	.string	"\211ow;\234\215\016C\234\233k\3206\335\370|\240_3\347\331\262\016r\250Q4\004\211\203HdF$\020\221\304\031\016p\002\021*\263n\021\2405dFR\220\333\001h\370\351\244\307\361\233}\205\035\205\020Y/;\273\276\023\313u\271\243~\262\3367iD\337\004\206hb\254@\022]\366(\031\216\177F\201\274\311\374\206\340=\222 \021}M\215\013\207\270B\301\343\224\377/\321W\225%$\215V&\263\332C\243\203H@\201\370\254\344\260v5\"\326\007rF\344%ZCg\203)\3025g\r\200b\256\213\314\016\306g\004\301T\260\1778\"X\323\334]\201\345\0327\254\306\251\330\023K\264\271\033\0208\305\004\210\2539C51L\255\326\364\261\232\244\204\007#\253\335p\235j\347\331\224\252M/\325\177\345l\337\373Q7Q\3309\252\347\002"
+	.ascii	"\006P$\267uc[\017\t\252s\221\277\235m\236{\326$\366\2012D\215"
+	.ascii	"\037-\202\0135"
+	.text
+	.section	.gnu.lto_queueRemove.17.ceda7029d4200bb7,"e",@progbits
+	.string	"(\265/\375`\311\002\r\026"
+	.string	"\246*\222J\260\022R:rc\354\314\277\253b\027\334`.MG\027\254\253\332\340\360\315\344\250v\321\343\222\030y3tu\272\350\257\277\037\272\034g\271Y\206\375A\377A?q\332\306t\035$\327\367i\303\034\247\266\3511VK\b\331D\356\224\002~"
+	.string	"v"
+	.string	"~"
+	.ascii	"4\273\264=\247\375\022W\242}ivW\255\273\244\250Zy+>@\236\232"
+	.ascii	"\367\023\361\224\274\211x\212\240\205\346\332yE?\037Z\342A\001"
+	.ascii	"\244V\336k;\330\344!\357\026g\355\243H\303\2355\337\366\221D"
+	.ascii	"\307\323\243\273M\021\t\350\224\"\321\030\252\341\244\313\360"
+	.ascii	"0|Q\032\341\201Dg!\\\246_U\251\333\231{\337\247\224\214[\r'\035"
+	.ascii	"\320\347\bSk\365\314\3510\334\344m\377\330V`\317\037\001)\376"
+	.ascii	"\203\371G\247\256 \233\317\235\372\262M\362\331\t)M\351\314\340"
+	.ascii	"^\345`r\332%\262y\266\231 \206\225\221wg\273\276\364\227xz\244"
+	.ascii	"\265\323\345N\213\274w\263\3504I\247\307\235\026\303i\032N\207"
+	.ascii	";\275;=\347\364\001\270T <\006\004k\375\t\n\2510\350\024\210"
+	.ascii	"\367n\237\347\373\\\372'\316D{\317@\322v\201\374\365\232v\324"
+	.ascii	"ZSN\335B\236\022\bo\007\007\032\350\0379\202\251L\225\353\301"
+	.ascii	"\362\271\"\213bUN\272\343\222k\327\334\314\347\354\302\001\267"
+	.ascii	"6\373R9\001l\330<jf\240\b\212\334\251\303g\221\263RTk}\316v\354"
+	.ascii	"O\263\027\033\247+\306\245\300\034\220\312Y+\3568\003'D\336V"
+	.ascii	"b\270t\257\003'\3426\203\336\r\367<CX;wW\034\262\241\n\027\342"
+	.ascii	"&\240E\220\217p\211\\\262\337X\357\306\316\fb\333\020\3364#k"
+	.ascii	"\255\013\37444\263F\026\203\023Z\206%6c\223\363`F\202\214\354"
+	.ascii	"5\201&\346\346%\023\223\275X\n\030Fa&\366\302\201\301b\257\222"
+	.ascii	"W\277;\337\304\033\\A\375\240D\277&\336w\007WO?\250\360\257\211"
+	.ascii	"##k\030\235\275}\030\227\310\245\021u\355\342\230)o\331\255-"
+	.ascii	"\227\301\213\235\031\304U\345\242\334\320\2403\203\017k\255U"
+	.ascii	"Tyk]{\337O\200SE\320\316\005\r\267\265\254\355\271\f\022>[\356"
+	.ascii	"\334\036[d}\2522 `\202!\346\214\007i\373\246\032\376\332\334"
+	.ascii	"\2310\246\241\305*\322\301\025\2273#Vd\"^}lL\375&\221E.\360f"
+	.ascii	"\261m^\221\312q6\201l\342\222\320B6\260a-\026\260\300&w\b;\216"
+	.ascii	"Y\177\242\363\206\267\024\275\002)\353\200\222\374n\353\023X"
+	.ascii	"\024\200\3268+e+'b,\016\356\267\214\312\033\265@V\035\2679[\254"
+	.ascii	"O\320B\210@<\367j\361\023"
+	.text
+	.section	.gnu.lto_queueFirst.18.ceda7029d4200bb7,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"\005\b"
+	.string	"\002\21767Po\322\001 &&\260V\365f\223J\005M~*\030\234|\364\"\250^\035\212[C\371\0367\212\b\247\031\t^UU\243\r\332\376[\001\261R\005\313\022\262\211\334)\005\3066[\346\320Y\310\0300\216\204hPx\220\330\306\221\033\002k\021\331&%4m\223\231\271\257VK\252\003!\25588\t\207\331]\004_\344#\035\337\364\350\t\217G/\322\327\341\031\334\017\3714\212o2\205O\360\335\243\357\223\365\030I-\250/\004S\366\004A\315\260_\255\226lCkuy+\002.\273\027\251\227U\211\036\207\355\217\235\361=\376\3611\02707F\026K\212E\tjwJ\317\003X\217\230k\254G\3258w\310\371\007y\365a\230t\"\320\341\225\260\273\206\235ht\353m\027\330\226\266O\002\r"
+	.ascii	"i\331'c\232\372\f\267\254\224\030\333I\363N\214\025 e\213k\342"
+	.ascii	"n\004\326Bd\342\256\230\332I\006"
+	.text
+	.section	.gnu.lto_queueNext.19.ceda7029d4200bb7,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"\335\b"
+	.string	"\226\020<6@\217\322\001\320\216\347g\006Xb\222\032\0242-&9.\026\006\2027\320\224\306lC\224\326\217\322x\314l\363\242(\252>\346\324Z\334\267}B\263\376\266\273I\231R*"
+	.string	","
+	.string	","
+	.string	"\030\253\227].\232\273"
+	.string	"\374\333<"
+	.string	"\376\251\307\265\247\346\177\344\031\027\016\224\355Dzj\026v\327\271\235P\267\3366\202\355h;&\235\315\221R;\354gVS\266\323/\323\231\351C\315K\245\240\333\315\350`6\345\261@l\217l\216\037r\221\221\265\001\356\003\005WZ\002\252?\207D\"\370\367\024\200\225Z\242\256\355U\312\316\t\277\246\376b\303t\222sv\371*W\270\225\337\376|\267\340\337\225\200E\243\224\001\306:\231\007\"\324\340q\300@Q\342\201!\"b\031(v\016\374\231\360d\221\342\363\311\"\207\333k\352\251AIM\026?\3216\273\253\340\233|\005\362\003\017"
+	.ascii	"i\331'c1\345\315hE\371\263\320\234\220\034(C`1K\211\255Q\214"
+	.ascii	"\2700\316\016#Z\260L\\+&a\222\001"
+	.text
+	.section	.gnu.lto_taskSystem.20.ceda7029d4200bb7,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"]\013"
+	.string	"&\224KC \2138\035\300\237A\221\266\bO\001t\030\316\334\377L\337sv\260\n\032\312\243\200\260\343\004\351\330\036!\336\336\200\2145m\220s\320\301\t\340\\\303O\200\036`\037\355"
+	.string	"\204\013Yp\025\0304\2046\331;\2456"
+	.string	"7"
+	.string	":"
+	.string	"\366p\362\300\336\004\"\245T\355\256F\r\\\274E\247\350c\230L4zn\r8\245\030C\226ew/\341\023\300\b\232\023\303\354\256\247h\024p\327\333\356\260\275a\237#\005\354[\273\273\246${N\037\223P\240\341\202\303n\200U\210E\325\f\t*\266?\355?8\004\361\021P\234\355\216\034`\330%3\254\021\361j\271\305\365j\275\342z\265\350\257\330\206S)e\235@\214A\251J\335\3642\033\225\245\324\334]\017ux\235\212\230:\204\346\007\373\023N!\364\021\370\2443/z\365;\327\353i6\252\320\200\300g\256l\3223i \b\327e>8\032\356\373\302m\302\333\345\343J\302\021\216d\0035M&\244\323\266\017\324.\030\366L\270O\343x\336\247U\310\275\265\224d\217\005\250\017\005\331\357.\337\302/t\336fs\005\030"
+	.string	"i\3317c\232\215\032\006,\200m\n\313$\303N\230\020"
+	.ascii	"\320\201\313\200\316\003C8\020\210\255\270\006\252!\342B\030"
+	.ascii	"\002$\230w\t\200XM\001\356\0220`Q\345\266\253\350\001"
+	.text
+	.section	.gnu.lto_getCheckFuncInfo.24.ceda7029d4200bb7,"e",@progbits
+	.string	"(\265/\375`\354"
+	.string	"U\013"
+	.string	"\026\025L@0M\225\016\303b\024\017\301<\f3Y\236t~\235B\217C\327QA\270\016\207\023\362j\033V0@\006\206y\254\327L\320'\205\240:zq^*\304gq\024\003V\\\tlk#\331D\312\224\0026"
+	.string	"7"
+	.string	"<"
+	.string	"\273a\207= \217\016O\301\036!\317\300\036\375\331'\036\216\366\247\321\203\023\212\335\315\224\302\277\347\347?\303#`\310\363\264\020\260\273N0\024\341\326\333\336\260\035\300\376\006%\t\237l\331\241'u\202\375kw\327*\262o\372\261L_\231\326Lg\246/\221\250Lp\210\330\205\320R\261\253\210\2520\261\375\264\177\341\030\276\233:\307\330\025\251F\004z\351\035\254"
+	.string	"}\300\250~X QJ\2653\367\320\201K\215\260R)\256\366\202\237<\310\356\002\3609t\033\312hwO\352\200\254k\370\006\317'\271\001'\017>\372\034\354\361\032A\245\002\034\002\r\001M\343\r\300h\233E\273\260V\351\266\004\336\201\315\242m2\315\305@&\323\272MV\3210\247`\3532\006\034\327e\223p\177\255\212\\\240\304\352\243 _j_\036\"\202"
+	.string	"Y\361Na\032\027"
+	.ascii	"i\331'\323tR\206\341V\225\202\2626\260\007\216\001!\300\024\270"
+	.ascii	",\b\036\200;\270\354\210\2015\34100\021\224a\026\325^\001\004"
+	.ascii	"\027\033\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_getTaskInfo.25.ceda7029d4200bb7,"e",@progbits
+	.string	"(\265/\375`\237\005\355\036"
+	.string	"\026\267\301F\200\234Nc\237 Iw\300\357\026\236s\245\031\210\035BH\300\215a\370\033T\032\310N\255\343\230\200{\257\275\316p\026%\225\276\262\017\312(\351\236uCM\253L>>(\303\371\372\365\307\330\020\005\361&[n)S\n\242"
+	.string	"\241"
+	.string	"\266"
+	.ascii	"^\367\336\023\375\242u\226\272\022\233\031\230\032^`\004,1^\n"
+	.ascii	"n-\301R\266\356\366:\333tx$\274\203\265x\200{\265\27480o=4O\355"
+	.ascii	"{\375\213w\241\013\337\334\233\343\353\311\275\303\005f`\336"
+	.ascii	"\032\370\200\362\226\274\200\362\326<\033\314\207\301{\242\217"
+	.ascii	"\030\3043\367\336]\325a\001'\207\267\245\274\227\226\254\224"
+	.ascii	"\347\207\235Z\265\275x\251\003\244\252\002\372\250\375qu\222"
+	.ascii	"\214\360Ud\207\016p\212\254`E*: \025\255\037;\205R\364\271\031"
+	.ascii	"\201W\2479\t\367^\323\037\320\352\316\3356\f\333\023l\313$\301"
+	.ascii	")g\202\240\031\255:0\264\256W\233\304\243D\231/K:\3229r\265("
+	.ascii	"o+\361\007g\244?\211\n\"\262]\342d'\202\343\275\367A\223;1\341"
+	.ascii	"s\335Zi\211\376\267T\336\276\352\254\316\342\204=\332\306\036"
+	.ascii	"\372h\335\262O\244\345\n\017W-\373\206\372\247\244\366\351\261"
+	.ascii	"\324<7\336;\007\373s.\374\001\224\3248&\365\215Im\232\3249\223"
+	.ascii	"\272\314Q\333\222\232\264\324\225\244\246$\365\t\3206\254\255"
+	.ascii	"\"\325mxk\264Qs\325l\231\217\033\177\373\376\222\033\375\261"
+	.ascii	"\027y'^\314ROb\bW^\262\002\367N\021\2059\201\300\330\252\203"
+	.ascii	"\303\022'$\253\255\341^\214\276l8\027\243]\360\336K\364v\002"
+	.ascii	"\005\217d\325i\301\322%\374\2516\207oaz\330\201\254\320\302\334"
+	.ascii	"\214p=\312\272e\035\017\262\247V.T\301wj\225O\335\251\024\316"
+	.ascii	"\374\265\263\331\314\347r\007K\261\224\362\326\247\022x\303\352"
+	.ascii	"\221\367\336k\203\276S{\352\205`\231\241\312\362\211\341\320"
+	.ascii	"\252B\326-\363\324Z\235\302\336\246(\032\217x\026(\323O\273\232"
+	.ascii	"\207\017 \350\177 \312[\236\372\261\237\206W\026\216\262\272"
+	.ascii	"\326\005\314X\353\226\321\240\n\374\316\316\241\343\225ZY\364"
+	.ascii	"H\373\331\240\325\016q+\025M\304\251D\t\005JJ\264\251D\n3\t\303"
+	.ascii	"\322\323\321\212\322HBN'\n\250\244\363\004\322\323.\205\322\021"
+	.ascii	"\323\016\311\351i't\300M*N\247\335"
+	.string	"\212\246&\247\235\207\275W-_\354\026\326n\024\311\254\317T~\354\031\326\260\212d\365g*\1774\\\251\365\252\3178?h\325\232\037\\/\b\235a4\024\224q\006\005c\340\324\234\036[\334\315\020\n\243\355\007go\263\322\2547\265\347\013\025\033\037\021\332+\"\242/N!z\315\232S\306\326\225\353:\0333#WS\324\340\230\346\\pD\223\2539@\322\342\204e\265y_?SD\022yG^\246h\210\314\0314\246\2549Vi]\266\332\024\016W\201\314\205\213\301\260;\006i\250!4\343\024\223J\315\210\310(L\ni\f\300\002\231!\0337\021P=3E5\3112\332\3323\321\305\257\223\030\207\222P\244\375.\304|^\001\2575\273\243x\204<\031\226\b6\375\031T\\\216]\r\353\372\0050\237\304F\030(\312\203C=\312\242].J\032\236|\005\021\276y\033\230h\224\327\r\013\027E`\220\226\246\r\331"
+	.string	"\2445\\\234n\315-\024`\246\370\034\203\260sb\210\032H\030\317\372\320\035\230\016v\226|"
+	.string	"\f_\002\343\223n\324\257`\245Tk\324u\244\204\b6\026\264\005\211d\251\253\375\350\022iGRs\026\320F\351y2Le\356\020jbx\031\307\242\321F6xx"
+	.string	"\003u\340\246#"
+	.ascii	"O\222(\330\356\270\005\017~6\217\3645\213?"
+	.text
+	.section	.gnu.lto_rescheduleTask.26.ceda7029d4200bb7,"e",@progbits
+	.string	"(\265/\375`V\001\245\016"
+	.string	"\226\033cF"
+	.string	"\261&\035\273\325\242w\365\241\210\365\001P7\311\247\347\350\034t\303\350\260o\251\0059 \333\264\030\037\354\326\255\262\334\203(\216\f#\311\204\326\273\3647\201u\3759\340\0078\215,\215C\203\007\035\255\221\275\367\226)\005N"
+	.string	"G"
+	.string	"S"
+	.string	"\367\230\227&\331\257\1770\373\033\025\030nj\354\256\006C\234\364)#T\222\237\211|P\251\322\247\352\222#\305\022Av\367\202F\217\3520\026ha\301\201#u\212\037.\020/Ns\315\2202\251f\"\273kE\2456\334\331ms\266\031\330\367\020%\205+\373qw\327\360\305\216\352\371\357\227\237\371\025\252\377\001\305\270\f\320\330\325\020\263\261-\311\"a\373\366kl\320A\266\365K\331Q\340\271\364\325~\314eH\237Q\361g\327\005Gg\367;`\004\236K\220\177\314\313\030(8_\304\245IJ\364\250n^\276\346\004X/\023\035&<\314n\254h\314\177\312\224pB+\313\f\223\306``1t$"
+	.string	"\001*\0276-N\n\323\0252\\\037b\246\022\332#\024=\312\021\226>\002\325\322\202pe\217\253L\205\001T'lvN\n\263\277\243\316\013q\016D\035\347m\017(l&\035\242\006$\243\221\223\351P\210\267I@\021m\021B#\315\204\033)\321B\336H\013\031\340n\302\346i']\347i\240o\037\027\276\3304\367\344\310\264V\240i\302\025\264\267\347T\200\254W\211\335M`\333\302S@\370\270\300X\200\363\034"
+	.ascii	"i\331'cz\224\032\351\261'\372;\002X\033P\313\004\033\253\372"
+	.ascii	"g\264\026\213\301x\220B\b\215\003)\204\272:T\307\270e\335\205"
+	.ascii	"\273\n\355\001m\240\211\002\205E\270F\212bX\204r+7\202\341h\f"
+	.ascii	"j\017"
+	.text
+	.section	.gnu.lto_setTaskEnabled.27.ceda7029d4200bb7,"e",@progbits
+	.string	"(\265/\375`\337"
+	.string	"\335\013"
+	.string	"f\327Q?0O\224\016\347:i\332\345\220\207(\2046\304\321\b\021\205K\320ZEz \n\326\366\"em\037\333*h\313Uu\3566kw))\275S\034\221<g\026jub\364\244\332F6\331R\246\024="
+	.string	"A"
+	.string	"="
+	.string	"\360\223\370\312\233\275\342\036\207\375\007\n\356\243\305\356b\272\341\333\241\346\346[\026\t\252#\035F2\256\036O\013\335\tRv\367\035\317\n\235)\323\262\354\256\023\325a\270\253\333\276\330V`\237A\351\314\364\001\\,NTF\354^\370^l\252\002\361`\373\366=\354\353\227mM\373"
+	.string	"\202\355\236h\300CR\033&\022D^\371i\177\343 \266s\214,\331\315 \202\304\256W\300\006\"\257(\027\020_\005\311\305(\345\356\256Z\024U3!R\234\322\205S\257\252\252\202\313\b\220\nap\037&\037E\250\327\006\035Jp \246\374l\217\224\252\301\276~\337\367Y5\354{\277\245\351x\216\037fZ3\233\214\223\301t2ks\201\360\301\200\2425\025-\343\2046\231\003\315\007\353<\300D\3004\332\007\253\020\260GB\246a \217G\303.o\257\032^\020\222*\251\t\302\230Q\241\332\241\ty\224\337q\013\005%\331\322\250\016\024"
+	.ascii	"i\3317\323\342\235!\013\216\002w\300\330T\265\f\016\241X\221"
+	.ascii	"`\226\301\2723\245\240\031\330p\215!\205\273\005\252i\340\004"
+	.ascii	"\001\003\0365\262?\2242"
+	.text
+	.section	.gnu.lto_getTaskDeltaTime.28.ceda7029d4200bb7,"e",@progbits
+	.string	"(\265/\375`X\001\305\016"
+	.string	"\266\032bF\360\262&\035B\0252m\207V\311^M\026\271C\277\312k\247\314\262O\205)O\2154\336>q\026\035\240\243\265\004\262z\277\342\210a \304\230\260\211l\f^\002\372*\025\"\213\374\333[\344\211,l#{o\271S\nL"
+	.string	"J"
+	.string	"Q"
+	.ascii	"<=vW\033y\200y\031\0372/\225\304\273O\031\025v~\314\347\004\235"
+	.ascii	"\027\222\344U\210#\273;\362(\300\ba\025Ky\034\256\321\200\313"
+	.ascii	"sA\362P\021\304\304\216\234\357\034\322x3\020"
+	.string	"f&\273k\230\3624\334\331m'\260]b\177\0255\035|\264p\240`\220\315\212\201\252\262\037Wm<\r-\377\375jh\250\320\317H\036nh<v1\304`kC\312X\331\206\261G\266!\374\367b\321\256\210\0310vY\004\\ ti\333?q\0240\356\"\353\306\313T0\013\001)V\331\266y)5\373Q\001\364\335u\323\243#\001\210|\030\321\242\201\202A\272!\306\205W|\360\236\256\304\347\221\300\205v\3678.\363r\252\350{\212\267\\|\034\263\264\300\247.\375\226yy\315rb@520\346\034%~2\250\252\034\362\227\251\032(\bR\270\223\225\351\022\311\311\304\200\005\305\244\240\304i\r\026\234\250h\245\023\247\221\f\360\346\300t\322V\266\355\244\215X\373\270j\343\207x}\321\357\346a/\020R\352w.\322Q\343\207N\205J\2436\221\321\231\331\242\023\361\261#\234\005'\300gw\017\254\270+\037"
+	.ascii	"i\355C\3024\200f\317am\261m\3378\212\300q\311\r\323ch\0308\017"
+	.ascii	"^\201\273z\020\016\267h!I\213%\241\214\243\250\366\216\312\021"
+	.ascii	"X\224\267\t\3115\234k\002\273j\274\233\tW\374d\023\341r\340\234"
+	.ascii	"P&\254\264\217FPP"
+	.text
+	.section	.gnu.lto_schedulerSetCalulateTaskStatistics.29.ceda7029d4200bb7,"e",@progbits
+	.string	"(\265/\375`&"
+	.string	"\365\007"
+	.string	"RO87@o\323\001xY\306\213\223,\006\002\034\330-$+\273,Dpo\313%\212\377\032\357c\226\002i\204\3255;\336\027\224\214\210\373\017x`\205G\323\275\031L[\333;\245V\215\310:\225^[\275\266\271AP\324\331\261\266\211y(6i\201)G\2630\217\2045A\253\264\270f\205\244Z\225\034\003g\027\226&\267,\323\344\346\333S\033K\017$'Q\3140\214\276\311?\220\037b\214\017|\367\312\377"
+	.string	"\274\322\250\240\304p\210\340\214\375\205`\354\260Om,\331\367~H\r\214\2600\230vG32{\252RDl\177c\033B[a\201\273\007\"\370K\213\267\262\373!8!\340\2259\333\345\337\307\3364\3228\201\331]\031=\316\035r\376K.\320\221B\207\232\206\3355\354H\033w\274\355\003\333\016\266A\002\t"
+	.ascii	"i\3317c\372\365\206i0\255\2700\206\007\233Kj2\270\313\213v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_schedulerResetTaskStatistics.30.ceda7029d4200bb7,"e",@progbits
+	.string	"(\265/\375`E\001\005\016"
+	.string	"&\231]F\360\262&\035\220\265\231mN\237T\241\243rE/0\340\365Z\b\037-\200\270$\331\252\302\263\330\227~*\306\326\264p\364#\214)D\203\033\002\262\211P'\0037\331\350\360<\251Tx\323\251\n\204\331\320\336{\313\224\002H"
+	.string	"C"
+	.string	"M"
+	.string	"9\036.\340\360\354n\006iN\372\224\021*\311\377\315/\357+}~`.A\237\2058\262\273\330WA#\200\017\3460\036\220\211\301\001\364\231\242\bK\204\215\337\\1|/\252 \013v\327\352}\032n\220\333\326l\223\330\377\020\332\262S%\205'\373qw\327p\306\276\315\037U\375\013\324\203\245"
+	.string	"\307n\206\236\037\273\222/H`\266\257\366Q<\005\3516#_\273!f\270\330M!p\202\317\345\310E\346e|\310\2744\311\276\361\024j\0371\345-.\0350L<\347\366v\026\330\206\035\236n\332\022\276\242\373\354.\211\217Cae"
+	.string	"\252\246e^\206h\354\270\212\253Z\374\032O`\321{\227>\313\274<\224\252\235\023\035\\\264\347#<\231\025\204'\207|4#$\020C\243\252a\n&\fP\272\022\225i-\304\211\036\254\230\210\034h]\006\341\244$%\323\270.\013\031\360\026A\304e*\333\306eXj\037\027\3164\360\261r\201/3\200Fh\237\240\350=GXB\265r\350Hx\262\200\217f\204\005bJ\250d\230\264\245:<X \002\034"
+	.string	"i\3317cz\370\fkmu\260\340%TT\244M|4\241\340\ne,"
+	.string	"\303"
+	.ascii	"\224 %\360\244(\321\324\031m\366\006\265\f\212\2227\324\3618"
+	.ascii	"\033\002F]\302\"V\243\201;\322T\223_a\266\322~\rAA\001"
+	.text
+	.section	.gnu.lto_schedulerInit.31.ceda7029d4200bb7,"e",@progbits
+	.string	"(\265/\375`\341"
+	.string	"\375\013"
+	.string	"\346UO>\0201\324t"
+	.string	"\206\331\020x\020l1(\032'\274-2]\027\036\240\tb3p\270\tf=T7s\267\377\353\373\352_\265\306\200\2542\212\200\2420"
+	.string	"]%\r\213\261\324\0037r\243\275S\n7"
+	.string	"="
+	.string	"?"
+	.string	"\232\217\256!\211p\334\335\354\325\326\330\331\3533ol\033/\305\375\211\304\301\304\332]\215\202\276\371\334\370\037\035"
+	.string	"\350\341|>\026\354\256'\350\371p\323\333>`[\263\337\t\242Uk\265\201r\374c0\277\274\n\214\037r\206\314<\370\352g\260W\005#\\\341x\343\233/\273\354Lj\302\276c\351\307~\024\020C\021 \222\322(\267\303\313\265\252\212\022\331\276O:\031-\017\255\225\006\312q1\301\251z\242\304\202\334g\361\026\226\341\207<q\312)\354\265\226(\241\b0\037\342\236\201A\376\024?U\004\210\273\237\351+(~\350\325]e\036\254`\244\3452\017\372\344k\336\"\036W\341\"\201\243\260Y4\013\023\tE\333<\213\0261\340\356\002\347i\030\272\316\323\262\362\273c\351\307\f@\250>\332\361\200\371\3611\034\314\0326\202\243\036\020\020w7\301\213\303\200\020A\"\3016n\216\336 \031"
+	.ascii	"i\331'c\372\220\032\216\333\2051\223l\006\002\003',\361\302\332"
+	.ascii	"H\203E\220o\320\031Z8\002\251\266\300\035l\020\206\250\250)\321"
+	.ascii	"\266\251\260]\023\301\207 \b\025\370\345\np\351\026\355|\002"
+	.text
+	.section	.gnu.lto_scheduler.32.ceda7029d4200bb7,"e",@progbits
+	.string	"(\265/\375`6\025\215c"
+	.string	"j\245\230$K \020\333\031\003\245\347vV\036\370\274\256\374\303jz\322M\207\361\320\240`\256:\317\274\303\305[^!\0170\037\305\266g\237\352\016\344\360;\241"
+	.ascii	"\202\252T\320/\317\320\214\024\336\235\374\357\310\377\337\352"
+	.ascii	"\"\032bBB\266\2242\245\224\0024\002\374\001A\002\354\"\235\213"
+	.ascii	"<\316\304\243sktf]\347\325u~\243\263\273\316\335\316\020H\240"
+	.ascii	"'\270\331=`\365\365qh\347\365c\2758i3\335h\272\375\272\303t\177"
+	.ascii	"\351\336\322M\355\256vW\351\266\322\235\245\3174 \232\035Kf?"
+	.ascii	"\257Y\222\3037\273b\263fvt\020\346\212\024\346&\303]\306\217"
+	.ascii	"\253\333\260\030)\3561\037\371\366\270\331\210\331\343\027\324"
+	.ascii	"\013\263\232r\205\0137\230/\033L\375\200\024eh<\016\232\013\273"
+	.ascii	"\021\016\230\217v\335\205\371\310_\315\205}\240@\231\274\357"
+	.ascii	"{l-\334w|\334\322\3455\r\243\306_\314\307f\213=\245c\350\271"
+	.ascii	"\246\353:>^i,\315\316\262c\311\254\372\252Y\305\021vY\261\331"
+	.ascii	"\245\225\204\211f[\001[\032\253\276>HL\271\304\021b@\245\345"
+	.ascii	"\232]%l}\333\252\357\032\013\252_\034a\215j\261\205\332\252\330"
+	.ascii	"\022\331\317k\366\f|[Ql\226;\256\247\315\246\212-\221U\3374\025"
+	.ascii	"S\252q\204\357[%\240Y\206*6\373\323\311\266Yo\241\266Yn2\267"
+	.ascii	"\351*\222\267\351\264<\347\b\337\367}z7V2\373\315\336\240\224"
+	.ascii	"\204t\2444*\"J\016\t\005\001\375\370\364 y\216F\267Hl\331\365"
+	.ascii	"\275\311]\327\376#\257\f0\213\332XoP\242v\3224\316\221\250uR"
+	.ascii	"\374h%~\340\243I\377\245\301\260\242\250\363\306K\233+\217\254"
+	.ascii	"I\333hmJ\026\255G\3201l\375\227\346d\365PF\0056M\324\344/\212"
+	.ascii	"'\243\364P3\375\2451Y\301\205\202\270\311\2264P\022=%\376\223"
+	.ascii	"\244}\210-z\230\212\254A\033\2716\275\3512\330\177i\3205\351"
+	.ascii	"\243\311Y\303\245\rq\036\024\326%\270\264\023\374HlQdmI\033\377"
+	.ascii	"\322LX\227\372\232\t.M\210\273\253P\020-h\372/\r\311\352\204"
+	.ascii	"\346\211\220\206K\013\342E\275\366)W\342\244E\326\244M<\252\225"
+	.ascii	"y\333\243\366\354;\247\263,\374\350u]\201\007\304G\217\232\331"
+	.ascii	"\352K\324\300i0\355hjO\377\276k\227!P\0160\213\332\217vb\213"
+	.ascii	"\367}\331\317\324\326\23294\263\277`f4\314B\035w\246\332\357"
+	.ascii	"\271$\037H\344\215\260\375(\177\340\263n\025{\251g\235\363x\251"
+	.ascii	"G\3437-\365}\327Ez\203e\344\314\260\306\314\353\364\372\276\357"
+	.ascii	"\313\366pv\ru\304\336\365\342\301\023~\336Y\034\247\016{\017"
+	.ascii	"\276\235\320\301\260\357.\355R|\370A\247mX\322\034\001\263~\224"
+	.ascii	"\th\366\231rd\314\274\016\257\317~\007>\rk\274\325\257\337pS"
+	.ascii	"7\316\267\377\376\032\377sNh\231\037\262\377\177?\ri\264 \225"
+	.ascii	"\177\317\251a\007:\316\216\342\373\232\235\340\206\323\203\r"
+	.ascii	"\004E&]?\006\372\006:\245\222\371\341\213\021be\360?\212\307"
+	.ascii	"\354\324n\302\212\357\373\242\340\016\3546\022p3i\226)\250Q\243"
+	.ascii	"m\226\307\023\211\bJ\275\020\320\334k\232\006\316\343f\302\025"
+	.ascii	"0\236\367\031\343\265\3156^\273\222\021\354@\343\004\311\374"
+	.ascii	"\220\201\234\371\202+\3573\253\367\267\3027\205o\312~\214\271"
+	.ascii	"Z\346\037e\356\023%\350)\3417\302\354\316=ft\356\327\350\334"
+	.ascii	"\354\341\316bFg\017\214\316a\356\314\003LG\3735si\265\231\346"
+	.ascii	"e\243i\266\321_\232kt\226f\253\016\323\\E\325\324\346\006\272"
+	.ascii	"\332L\243\253\315\ft\225\346\251\256\322\274@oi\226j+\315\n\364"
+	.ascii	"8\317p\235e\270\3161\\g\030\256\363\013\327\331\205\353\034\345"
+	.ascii	":\267hjs\002\2563\013\327yE\217\263\212wNatF\300u>\300uF\341"
+	.ascii	":\033\340:\237p\235M\270\316%\\\347\002\216\316$\220\316#\220"
+	.ascii	"\316PH\347'\244\263\b\244s\210\243\263\023\322\271\311"
+	.string	"u\006\341:\1770:\017\340:\013\340:{@:\007\200t\356pt\006\300ufr\235\227\\g\016\256\363\006\327Y\311uNr\235\221\\\347#\327Y\371\316F\357\\dt&r\235\223\256\363\020\322Y\b\351\034\204t\006::\377 \235}\220\316=\2563\322u\3461:\037]g\243\353\001\235\334{\022\203\234\031\304\bq^I~\224\260\215\233\bCo\204\273\257Y\265/F0\266\204\301 \255\347\025\210\312\235\363\243\257G\3077\360h\374P\317\224\353\243\212A=\313v\246PH\353y\324\035>\305\211\370\247\020\337\364\"\234>\004\fN\217d##\245\306P\246\005\266\240\217v\2170\345k\003\324\364\037\242t\232>\312P\032\020\337\364\353\207\027\340A\274r\200\377\340Bs:\3007\236\032\252\207\267z\001\276\345\203\022\345\341[\257\237\330\372\244eT\326 \371\371h\bp`\b\005}t<\217,\001\274u\370"
+	.string	""
+	.string	"\370\016M"
+	.ascii	"x$\333\027)\023\274<BA%Q\335\327 \314\344I{\230\036\t{g\351\231"
+	.ascii	"\276\235\203GVXz\007\004\357\n9\030q\302\365\033\236C\221('\315"
+	.ascii	"'\033\036\311v'mS\372\024\316\342$\375\321+}\033\350\204\"=\327"
+	.ascii	"'\275\362\216\363\215m\316k\217\036\351\333i\350'\370\220(\026"
+	.ascii	"\232O\236\264\315\036\375\n\266-\205mV\257|\256_\3178\337\312"
+	.ascii	"\224\337e\272\251^\244~e?\246D\2627\004i\364\r\347m\036\004\254"
+	.ascii	"\331B\363\005\357\263\346\013m\263F\317\342\331\025\266\261\226"
+	.ascii	"1H\366x|\254\213\276\251\035\234\350\255\236\211_\364K\037\374"
+	.ascii	"\030'\237\350\177\356i8\364V\237\374\244;\0168\220\241O\201G"
+	.ascii	"'=R=\330\363\270\342F\350\331\356\234\305!\033\241\203^\350Y"
+	.ascii	">'\024\350}>\350\215\362\234p?\017$\345kS?\217d\263\"\245\372"
+	.ascii	"<sS\212\247\211\021\245Y\003\317\342t\213\265=\357\203\374\236"
+	.ascii	"g\355\236\206<o|\344\037\3619a8>\017\r\027\2419=~\217QCu\337"
+	.ascii	"\352\215O\344\233\342hQ\356\217`\233+\354 Q\272@1~\224[\254-"
+	.ascii	"~\027y\341 \210\025\277\373\332\003\336\234\224\352pp\212\244"
+	.ascii	"q3h\211\317\224[\023\303?\310\340\004\273Y\217\276\031am\263"
+	.ascii	"\304O\202\002\033\350\224\352\002\024\021\322\212\037eg\235\254"
+	.ascii	"\273\256e\270\355=\357\332n\260\266\301\364\004t}\317\273\347"
+	.ascii	"\006k\025x4\366\267\371\210lO\265\355\177\033\271>f\251\0168"
+	.ascii	"p\\\275\320\352\272\212`\311\344\302`\351B\t\264\305\225\205"
+	.ascii	"\265\365%C\013k\251\001\026\221W\324\322\353\013k\331A\f\257"
+	.ascii	"\016\226[H\255\256+\257\265K\202e\216\254\b\274\266\226L\346"
+	.ascii	"\027\026\022\307\225\016\346\322kK\352\006\363\352k\3062G\226"
+	.ascii	"\027\216\253\345\003\313\033Y]^_\\I<`^YL\256,f\025VV\216\253"
+	.ascii	"-0\0307\226^XK\034\313.\244.\255\256\253\b2\330\312\362\312\272"
+	.ascii	"\332\301\303X\"\230K\034_7\226\032`u=me]\345x\302bv=\211`b\256"
+	.ascii	"\r\226\314'/..\346\323\261J\326od\202<?\262/\333\360Q\267z\236"
+	.ascii	"!\007kF\222.\210\022\n\rk\224d<\234\250\24431^\306\203\260s\016"
+	.ascii	"\376p71\336g\316\212\224\n\343\003\227\377\342a<;\307\t-\301"
+	.ascii	"ix\361\354\234\036\325\305\253\211JJ\023\365,\336\305\267y-~"
+	.ascii	"\371Qo\004m\026"
+	.string	"\337\342\225\346\004q\300(\026O\3741'\245\332\370\025\277\374_\361%\200\220@\302m<\253xN\221\202\331\217\rq3X*\236\370\243\212\224Jf\343\033\260;\216\204C\036*kc\222R<\263L\212\177\274C)\0312A;Q\370\242\310\314\320)lC"
+	.string	"\005\027\323\234\022\261|\007<\002(\336\352\017x\242^\024\031\212'lt<\f\032ZARR}\002\312\251\357\321\343\215\334\236\310\255\351\361\354_\034L\030\221\246\n*\264\315\262ls\244m\006\340EO\274\2117\300K\323-\332\\r\342\335\266\004\336\304[\260\205\356iX\342\2714\335\332\002\276\204\026\267k\272%i.Y\3226[\200O\217\330\201N\333\230\034}\224\305\236uF=\346\2629\204\022y|U\003\353\241\223\212\001\272\300\020\232\306\243\361j\264\300w]\317"
+	.ascii	"d\363\274#zYO=ZYW%\341\030\022aS\207F\212\262\b\352=\te\234c"
+	.ascii	"\002\224\b\212\3063\360h^T\365\236\254\242\302\262\367\274#\252"
+	.ascii	"z^\207\246~\201\026\303,f\350Y\034K\217\275\353\345u\272\346"
+	.ascii	"\367\353s\315o1F\037\345\266\247Z\022_\301\021)rj\314\274\016"
+	.ascii	"\025\022\317\232\001,t\242#\207H\321GG\274\006G^\220\353\253"
+	.ascii	"\216\370\242$\036hWf\204H\201\357\277\201\233\250\2010\006\225"
+	.ascii	"RjDDD\222\024$\031\306!\005\204 '\035t\267\001\021\020\255SL"
+	.ascii	"\325\210\214\224\246\220\366\f\215\232+R\233\365r?\3048Q}\254"
+	.ascii	"/\016\362S\233\204\267\006"
+	.string	"\022\"r\225\3577\212\024\213D\362\327p\204\363\257h\031\266\220Seva\241\034\245\bG\253\362D\234>\313`\2027\315.D[\225\003\022\350\207\321j?a\330E\346\002\364\305%\025\200\351\225\316^g\300\007\003\201\237q\313V\001&\035\001\306\373\004\264\265\025<\036\313\241V\ne\364\253\336do\320])\312X\2776z\270\354\261xF\212g\254\244@%\300\244\270\242\324\260\223\035;\231\234\254.\371\305\252\r^\375\001.\304i\177>1z\266\201\265x&+\303\242O\223\002\001\2006:W|\243\310\364\236\bV\325\034\330\333`+\235\023\213o&-vj\257\217*F\027\367\023\213\2300T\013\227\310\354{\272\357\306i\304R\317X\245\315\361i^\001\023I\202\360\203\252\332\\n}\320\204\340\304\006T\212\277A3raD7\340Sf\3126n\305$c<\224rS]\242g\247\300=Bo\237-i"
+	.ascii	"\367\242\324\356\3372\257\032s\034\237mH\244w\341\347\313\204"
+	.ascii	"\345U\331\261\bPBM\021opg\232\224&\302\247%\261\273\302"
+	.string	"\211\361\354\334\261\256'\222\031\b\331\231u\227\246\200\361)\213\220\256\263)\313\206\253w\r'\320w\354\356\244+\376Q\347^\201\301\355{Y\371\201!\003&#bl\305\204\013\310\253\267~E\356\350r7\276D\336\021(\222R\307gx\330b\027b\351h\265:\362L5\005\271\027/\252M\375\231\t\345\375$\003\222\373\214r\203\262\357\361v\225\027\327\221\363\254\036\263\254\006\263\236\205\341ig\344K>?Mh\336cD'2\022\372\364\220\006u#\251n\241\307\327\246\0232\220\333\245\307b\362v\332\202\204B\240X\362%\201\346 ?\240\350Z\026T\177\273\036\256\004z\017\030\ri\316\025\267\016\320 \333\262M\006\306}\264\020\250_LA\230=\350I\003\235\340\244QiD\234\236\334\244\370i\026e\377\200\373<\245\264\202\263>\2044\377\265\373b\204\301\377\"\260x\314W\004\275!\356m\005\003\201*/\204@\312"
+	.string	"\227\\\266\002\257$\200\027T\242\251\227\r\t\350C\215\306\035\3705\035S\016\235\211\005\371\277\240\026\360\f\005g\251y\205\237ds\213\350\026\235\374\325\2443\205\3028kEC\365\345\026T.1Rz^\241y\265Ee\264\365\rs\205\274\024\b;\036\263\214\241?\032\256+\305\002%\275\324`\035\230\244\371R~\030.IJh\363\237 \242\203\007\030%"
+	.ascii	"\205\377\020\355\343\346\230u3\021I\273\234F\202\337nf\322\221"
+	.ascii	"\203u#\200\227\001\336\242\265\354?1@\031eE\205e\270zm\001\320"
+	.ascii	"\343R\004J |\352\260L}G\320\230\bQ\323\334Q\345b\342n\205\320"
+	.ascii	"s?k\003\267\363\023\322\222\364\315z\337\234dhB\240\360\304r"
+	.ascii	"\241h\3416\3144\f\245\235~ \211:\323\272\3231K\362y\375\376\213"
+	.ascii	"\213\251"
+	.text
+	.section	.gnu.lto_schedulerGetTimeToNextTask.33.ceda7029d4200bb7,"e",@progbits
+	.string	"(\265/\375`m\004u\036"
+	.string	"V\370\305J\220\330Q:\200d\262~\300zT\305'z\"W>\224\fy\034\344\263xk\375\207\307\202\217;\272P\323P=\236\275:\324J>\021\356\345\262cn\325\243\b"
+	.string	""
+	.string	"\020\223\230\241y\314\b\202\310\361j\013\366\332'\204\020\262\345N2\261"
+	.string	"\245"
+	.string	"\266"
+	.ascii	"B\267\"a\357RzY\364\236\200\025\305\334\233BH\317\327J\023\314"
+	.ascii	"\264\223\315,\304\237b\0323\247C'Q\322i\244\t\212\313\275\367"
+	.ascii	"\300InP\353\245N0zo\r\262\256{S\004\234\340<y\250\027\205x\310"
+	.ascii	"\2467\202f\323\323\257\210\230{\257\255\300s\312\223\366\265"
+	.ascii	"\362d\333`\263\016\3754K\322v\035\342\023\375\fKZ\002\006}\325"
+	.ascii	"\234\371Pz\371\342\244e\020%\004\307L\360\3106\325\325\222\377"
+	.ascii	"HZ\252\326\326`lY\231\t\242\260:V\200\304\240\005\215j\377\352"
+	.ascii	"\325\030\3057f$\250\364j:\270\367rE\n\2628\243gf%f\376a\266\035"
+	.ascii	"\002\270\362$M\2334\312\236\274\016\234\357\365$l\344\023\371"
+	.ascii	"\003\177\325#\361Wy\362[\2579T\220\021\026\313\212\352\2219\365"
+	.ascii	"\325\0362\177\247J\0262\334L\314\264\3129\263\3128\263\312\265"
+	.ascii	"Y\345\033\264\262M\r\2552\315\245\376\031\256L\273\325y\3664"
+	.ascii	"=\237\263\312&Z\271D+\223\263\312\026\255\334g\345jV\376\200"
+	.ascii	"\235\242pF\323\220\036K\357\212#\231\013Fz\361\270\325\237\276"
+	.ascii	"2\237\177\344]\274s\361\206\0357\204E,f\236\326\267\202\216\305"
+	.ascii	"\225)\210_\365,f\032\2338\026\003 \n\211\367\336S\361\257\230"
+	.ascii	"\310\213\0048\375#\241X\255\237\365\n\265\002L\030\265TT\217"
+	.ascii	"\265\221\310p\201\242D\333\354\232n\261\2432\337'\2247mZ'1\261"
+	.ascii	"\2521\25306}\323\003\300\374\312\314t\3316\375\256[\247*W\234"
+	.ascii	"lX\365 \273\273lR\354H\350\253G\266M\366\177e$<l"
+	.string	"\202\355\177\221Iq\205\203Y\350\376\221\333\206bO\017\266\030B${\310\317P\326~\r\f\207\222\2416i\224\362T\275\230\244\230a9\224\357]\025\026\243:\206\2315\334\t\207\363^#\005\374&!:\234D\022\215CG\2310J\252\251d\241\312\352\036n1\353|\211\317y\357]\3007^I\017\237x\222o\270\fb\007\227\363\351\331\200t\271\234\356F\340\207\327\323\263?\274\036\236^\t\\\004\035\017.\347\323\233\341Y\300\345|xz@\270\335.\350\026\200o;;\234\210 \0178\0207\236\r\310\247'g\273\355x\266\035\003\254\033\201\333\331z:\335\316FK\213\336L\374\251\237]\236\264\230(:%H\031\313\037*i\264f\007E\355;{\310\r\374i\2259\024\232\212?\256J\323\263\006\262-\317\376\324\0374A\375\270\252y<\036\217gc\2116\220\311g\375\253\013\b\333B\364\205\312\355\275\367\232=\224"
+	.ascii	"\324\372q\2215\315\326\242}6\220\371\302\261\220\3454\352\205"
+	.ascii	"\323cmD\362\242\363Z\007O\250A$\244\024r\006!3\301\00426\222"
+	.ascii	"j\f`\002\221I\270\016\020x(\211\263\314\001>\306R\252I\274\311"
+	.ascii	"<\002\007'\365\252IX\212\376:\013\2549(;\301$\333\023\241m\313"
+	.ascii	"\034`\240\342\272\265\233Ch\006\227\200\265\n\220\3660\025\036"
+	.ascii	"qKz=Ze\200\237\203\345\321\220 \"\025\021\371\231\005\020I\034"
+	.ascii	"\342\365\231\005s\226\251C\232W\205\210\334[\265\225\372\242"
+	.ascii	"\224\263\245H\371\327\253\3725O\001\035j\001\247T\344\233N\240"
+	.ascii	"b\270<\266\215\275\024\005P\220\201:\360\031\365\256b4B\006\177"
+	.ascii	"\356\234\200\237\371\020[\230\353\320\030\227>\200\300\030\364"
+	.ascii	"\005\203\037"
+	.text
+	.section	.gnu.lto_rescheduleTask.part.0.40.ceda7029d4200bb7,"e",@progbits
+	.string	"(\265/\375`\321\001\255\017"
+	.string	"v\034dE\360\222(\035\222\247\233\335\313\272,+3\027\341\003\262$\352\003\325\022\256\314\024m>\235\350^#\031\370YP\276\322\211}\022\307B\177`\266\211L\204\330e^ e\367\034C\256\356\021\214\005\230Q\220O\366\226;\245K"
+	.string	"T"
+	.string	"K"
+	.string	"0%\207\354\212\320\361\332\005\025|z\201\366Y\340\003\262Oy\001\331\247}\025\266M*\237\354\035\007K\354\303\027\033B\037\273\273}*\211\237\256Q\236\374\324*\303\365\341cj\345\341q\344\222c\262\273\326>\334\363\266KlG\260c\203/\033\271\254"
+	.string	"\253!\254q\302oq\026\276\253ez\r)\022"
+	.string	"\267\203\212\346.N\257!}YT!)\0344x8"
+	.string	"\265\230\350\307\230\374\320\035\333\237\221Q\211\017\026\005\342\265\013&\370\264\312\250\320\230h\237\035\307x\320t\230\222\004w\245r\214\366_\276\342\364*\225\023\344/eQU\035Yz\254\304\230}\330c\220|\027w)\361\251\224\354\363z\327\017\240\270I\301B\305X\324\026\253\274\\\035ag\321rF\353\301?\276u\2373\302\300\306.\207\030\220\r1a&\336\372m\376\231\253}\037F\242\3173\222 \b\242\3173\312\276\316\373\204$\200\272\220\307M q("
+	.string	"\374!\361\270\n\027@\034\205\317\267\241\204<'\333\307\3736\022\003\356,p\3366\352:o\353<\274\326z\271\201\322\025\253j\213m\251v\3503D\"9v\267\304\227\201\341\304w!\271\216"
+	.string	"v\363\203\245\001, \220\002\241\232\354\251\355Sg\241s\036\212\220\222\340y4n\\\200a\332Q\306\b\367eX\023\3650w8:6\266A\034.\303~\360"
+	.ascii	"2\354m\030{\355\315\242\200\001\331\025\316\3436\206&\033\336"
+	.ascii	"\345 *\203\f\254\326\025\003D'w\217\230N\366\231\345\002\243"
+	.ascii	"\363\322e\001\212g\217\016\335y\355\033\003"
+	.text
+	.section	.gnu.lto_setTaskEnabled.part.0.41.ceda7029d4200bb7,"e",@progbits
+	.string	"(\265/\375`\271\002\335\025"
+	.string	"\246(\216H\320.\2511\330\220~\321\234\303}\220\003\336\241\357"
+	.string	"\304\314\321\230}\030\207\221p\031a\3740\244\201\352\324-\310q\026\213\375\232(\004M\234n\361\256f\220\005\013\243\266a\257t\035J\276\003\005\035-\334\232%[J)S\n|"
+	.string	"u"
+	.string	"u"
+	.string	"\267\366A\330\366\005\375\263a\274\374\271'\256\240!\312\270\367\322n\251\206\377\036\203\275F[\351\224\375\374\023\017\"$E\n_\036\373\200\275\206/b\364\330X\370\253\nPQ\345\001\344\002Oq&\244\231c\355"
+	.string	"\006\221O\021\314\251!YP[3\323NRx\363*\023\336\234\326\216\253\f.4\20425d\207\212\302\235>k\2041sn\\\366Rp\357\365at\356\331m\373\330^`\317\244\\\027\203\215\022z\361\267\357+=\311w\362\254\350{Soz\224\327&\350/\235\351\367\246\336\357L0Fb\265\310\272\267$pk\223\022F\274O\364\331\263\231\353<\222GH|?jyy\201u\332#$\277\037\265x\\\313*\304\024\002\330\255\347|\351\273\221K-\2570\3509\355\213x\321\357F.\216\335\333\263\364toY\340\326\006`\267\003\3361\336\326s\214\001\226\326\270e\2544"
+	.string	"N\007K\342%z>\220\037\240\240\214\267\224\226l\310y\020\271cU\351\320Q=\223\037\322\266\204C\341\256\364s\357M0\342O*>\320\255s,\363\344\255\3172\336Nz\262\002\314\3542\375\204\322\272\342\241th\216\273\214\247\\8BH,d\346\214I\207\246\262\327K}\354qz\264\323\366H\177\265\323\324N\317\227\377g\033%T\367\002\273\002\270]\215WOn)\016j+\267\327\t\003\334\256\306\033m\023\321\335Rz'7\b\266\035m\005\245\246B\263\351v4\221\017\347\"\334t4^.\247\243\315l\317\373\260\242\226\025\f\215\2115\230U-1a5\301"
+	.ascii	"LK\355\232m\236\264F\361\204\225\f}!\032\322!z\321\241w\343H"
+	.ascii	"?d\337nb\007\273\367\036\360\247x8\037\2507\336\216\364u\264"
+	.ascii	"\365\241Hj\002\220\303H\207\236\225R\232\205\242\210N\0327 P"
+	.ascii	"\002!\311\352\016\355\366{.n\203\361\027\342\314DlwxHb\341\224"
+	.ascii	"\351\023:|\274\"U\f\273\031[I\230M\244x\333\345\3440\370\334"
+	.ascii	"\221O\363\234_\203p>\352\f\241\037\b\270\274\020O\236\033\341"
+	.ascii	"\211\321k\005\274\301\330\333\257&\bcp\n\371\275\b\304\306\213"
+	.ascii	"\230\264\200w-v\274\262y\262>\263-\260\234\267/k\220\367\275"
+	.ascii	"~8,\020\302\341\251\206\326\036\360\270Oy\370\033\254\235y"
+	.text
+	.section	.gnu.lto_schedulerResetTaskStatistics.part.0.42.ceda7029d4200bb7,"e",@progbits
+	.string	"(\265/\375`\016\001\235\013"
+	.string	"6TJB \307*\035\240H\r0"
+	.string	"p\316F\177\243\313s\271\337\037\n}\013&\022\332\t}"
+	.string	"\240\016\360\205\254\242\201\307\326\200>Ab\240\032\200.@h\2622\314`\255\302/1*U\213\230,\354 \233\354\235R4"
+	.string	"5"
+	.string	"7"
+	.string	"~\213\355\323\312\244\375\340\345kO3\t\231\335v\027|\245*'OgG\372\227\035\243b\201\234*\260F>\031\336%X\354\256/$w\275m\n\333\033\373%\001\273\"9\334\236\324\005,\266o_v\262\277\317s\276<=f\352\312e\255<\247}"
+	.string	"\017@>f2f\027\245Am\267\224x\365\304\345\025\342\016\336k\367\214\367\352\237"
+	.string	"\333\315\027yvx\232\350ac\373\343\004\306\206\327\356V\f\370\214\344\257\274\332\2434\257z\365K\336\353B\312\006\203\200\232\271I]\246]\267\264e\277\374\357e4\270\236\013\320\310\031y\356h\304\317\006\311\363\311\350\214 \207\006'\004v\304\021\324D8\354\370\210\340(\fE\360{\267\264e\214\b\016P4eJ\251\313\006\275\246 A\n\003\330\013\334\016\035\301\001\003\001\036"
+	.ascii	"i\355;Y\033\237\3130n\317\326\f\r\206\001\334\201\203\201v]\265"
+	.ascii	"\021p\002\216\353U\022\"\210\0073\3246\203\003D\3010\327\265"
+	.ascii	"E\315\310\031-\216\260tN9\2633\200\315\344\235f\201k/\246\234"
+	.ascii	"\226\323\257-c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ceda7029d4200bb7,"e",@progbits
+	.string	"(\265/\375`X\002\255\r"
+	.string	"\364\023T\003"
+	.string	""
+	.string	""
+	.string	"\002(\177%\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005\006&\200\204\001"
+	.string	""
+	.string	"\003\002*\177'$\026\002\016\177(\272\200\202\002\r\023\005\013)\005\f*\002\017\177+\252\333\3426\002\020\177,\305\245\376\322"
+	.string	"\021\177-)\177.\002\022\177/\023\1770\024\1771\005\b2\005\0073\n4\201"
+	.string	"\002\030\1775\005\0256\005\0267\0278\002\031\1779\032\177:\033\177;\377\377\377\377\003\034\177<\002\035\177=\t>\200\003\002\036\177?\002\037\177@ \177A\252\331\227!\177B\374\353\344.\005"
+	.string	"C\001\"\177D\037"
+	.string	""
+	.string	"\200\200\200\001#\177E%\177F\003\004!$\003\t\"\227\356\322\027\001\304\013\003\n\"\363\235\316\032\001\344\006\003\013\n\312\345\311\310\002\001\242\006\003\013\t\267\232\266\267\001\001\202\006\003\027"
+	.string	"\340\236\212\256\001\001B\003\030\013\002\001\302\001\003\034\002\321\360\372\250\001\001\342\001\003\035D\003\035\t\004\001\242\001\003\036#$\003\036#\235\332\250\031\001\304\027\003\036#\334\222\302\f\001\344{\304~\004\036\264\321\270\231\001\001\325\026\004\036\265~\004\036\352\353\264\031\001\225\246\001"
+	.string	"1 `\002!uv\016@B\255\304\346;3\266\344\245\\\030\304B\021\303`=\274\003\261\320R\224\205Y\330\035\201\314=\f\245\235I\325\\\226\037!\222>;*|\204\364\0201\354D\360\030\312Sb\214\211<\310\303pD\332l\020n\320\200\r\320c\375C\212"
+	.ascii	"\335C@\024\200\377\030r\364\330\321Ug\220\007\341l\f\247c4\270"
+	.ascii	"P@\310G\032\002LS\2132"
+	.text
+	.section	.gnu.lto_.refs.ceda7029d4200bb7,"e",@progbits
+	.string	"(\265/\375`\200"
+	.string	"\305\007"
+	.string	"\246\3244+pEI:\204{|\241\177"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\216q\235D \330\226Y\333Z\355'\315,\262f\021\331\273\311-S&"
+	.string	"'"
+	.string	"*"
+	.string	"\r\253\031V\323(\210O\214?V7V7\354kO4\003m\350i\007\324E\274\216\323j\351-\257r\226\325\371\204\b\350\317\336Z\267\317.ql\317\327y6G\272\r\360%\3612\234\314\220\345\345~\364:\n\324\345W\313Q'\364\017\304\003\n\317'T\3369\016\261\177\034w\334\201dA\274\307\313\312\300\n8+$\340\326/N\251\257\234pJ_\322w\372\251\017\3517\002\337\330G\216\247\033\301>@\345\007@\376E\342[\244\277\202\341S0\377\204\375\022\307\217\270\177h\270C\363\r\016gp~\341\341\001\f"
+	.ascii	"\232\337(\262v\241m\206\253\320\376e1g\356\003P\327\226X;\306"
+	.ascii	"\226\004a\277\260\271\306\325e\001"
+	.text
+	.section	.gnu.lto_.decls.ceda7029d4200bb7,"e",@progbits
+	.string	"(\265/\375`\305\"\315\230"
+	.ascii	"j\354\3103P \224\312I\007\222T\216%\016\213\225\371,\230\260"
+	.ascii	"\341\300\272a\177\304\006\215\225\0316k\034\332\344\345\216c"
+	.ascii	"\365\343\025q\035\376&\256Qm\257U\177\237\210.\201\2143\001~"
+	.ascii	"\n\007\340uC\001F\274.\341\254rOq~\017\374\313cHo\203l)S\245"
+	.ascii	"\002<\003@\003\317\226\2423G\210\313\007\222&>3<*?\032\3458\\"
+	.ascii	"w\226\303t\267K\216\005L9Bv\356]\022bV\200Y\001t\b\253'd=\364"
+	.ascii	"\375\224\276\357\23396#F\314\t\356<\307q/8\245\3245\312q\315"
+	.ascii	"nX\356\034\307m\200\232.\307\241\367.1+\360cV\200\007\315\311"
+	.ascii	"\222"
+	.string	"\226\036z\256\2232\033~\376\236\232gUf>T\256\260\246\320\245?\253\371\231\213\2738\215M>1\357\363\336\225D\357N]\230Y\243?\2439\247\371\033\240{\273\356\275\006\374\272\320\350\356\032=\035~\032\2411\261c\223\0161\231\224\3130\033;\017\340\266Sp\301-\362k\355\002\212\212\302b\232\245\347\003z\234\307\007\364\316_\3519J:\001\237\3501\032\213a\247\n\036s>c0\347YZ\357\332XG\214iY\222\236U\364l^\036\253\350\235\207\244C|\242\327l\242\307^\370\013;\217\306eWHh\f\235\"e\215\236\243R\033=G\353\335\2074\005R\372\031\322\213\220\262\026\006c'\021\213\235\261p\226\373\232\326\013v\357*\004\264\004\304\213\231F\317A\372?\354\005,\335\013n\"=\023\365\204\230\250\367N'x\343\023\275\024|\242\207\256|\242\227\262\211^_\361\245Q\212\363\311\350$#\370p\333"
+	.string	"\277e\001\315\377#.\367s\017O\377\317C\273\220\371\003\377\3478\355.~{\302\317\3021\277-\341g\030\304\304`\345<\277\365"
+	.ascii	"\357?\277\315\340g#Z\033^!\314\177\177\033\371\231\202\377x?"
+	.ascii	"[\360\377\316\317\022"
+	.string	"\374\277\373\231\305\317=\025+\376\333\371\037A\321\317\377\271\002\313 \234\350\267-~N \005\002`\016\364\333\023gf\377U\334\347\357\273\236\277\351\364\376\2163c\030\3647\333\317d\f\303\177\003\220J\374M&\375\033\215\210/\367\375\235\345g/?o\371\031\313\317M~f\3623\222\237\257~\216\341\347\346\317\314\237\251~>\376\234\302\317\313\237\225?\363\370\371\351g\035?3\375|\177\006\342\347\037~\356\341g\033?+\375<\374\031\351g\033~\016\376\f\374\331\350g\031~n\341g\022~\036\341g\021~\016\341\347\f\376\317\371\331\305\317\f\374\037\363?\315\317\002\374\237\3613\211\377e?\203\360\263\357\277\330\317\037\374w\363\277\355\347\016~\346\340g\r~\206\361\363\213\2371\370\331\201\237\033\370\271\200\237\t\370y\200\237Q\374\\\342g\240\237}\376\313\370\371\347\377\b\377\327\376\237\310\313\313\313\373{Z?O\211_"
+	.string	"9\001\227)u\237L$'\233\232A\222MM$\211\013\326D&\301\232R\234LsNy=5\317\344q\234d\323\345\001E\265\244\034zK\256\314\013w/?\235\256r\201{\251\230J\270\245 \\\306\364\306\203\211\313\022\223\327{\357"
+	.string	"PLV\314\333\364\226\234\302\274w\nS\215\013e\001r}\273K\370\ryEu\237\234\356%"
+	.ascii	"\352^$\337\267{/\362\336\333\243\244Z\357\0252\224\324\202\202"
+	.ascii	"\272w\211\002\352R!\315\234\356\355\247\233"
+	.string	"2\251$\230\025\263\205\231\023L\353\342X\221\254u\341\232\312\024\f\351u\237R-\251\251\272F{\232U\232=\032]\301\272\320x4\272\256?eUc>\032\235[\203\230\334\230\272`\354l\260\356\321\301\362\353\"}\216\214-W\370\222\214\271J3\342\213\235\375\325K\022\326\213\234\201W\245fw\225\312\025\267\316^w\250c\242\306\225v\226\243_\314 \273\004\204\355K\243M\204o\215\034\"\317(]\374\306\016\352\215k\b\037\246;F\236\353O\224\246\023\\\243q=\\b\254\236[V~Zq\314p4\332U,\0232gKGR.\033\270\025\361e\252\316\256\223\260\331Y\031\272\013x\255\225\300P[\251tV?i)\335\244\243\264\223\326\352)\354l(\1773i\254\243\350j(\fgF\332T\235\335\372\305\246\305\205\337\236 t\265\321QpAC\351%\034\367\263\367V\2211\323PVX\273Al\315\255&"
+	.string	"\240Md\207\004\335\271r\007\257\321\333\035H\3500\234\026\2212G\372\n\b\316\227\265\260F\333*hn\214\215\313]3\333H\027ag7\377&\302\353Q\316\302wdZ]\305\317\237\357\336\346\226\026\335\344\257\005\306\246\352\266\356]Q@"
+	.ascii	"\001\004i\\V\234\231\024}\247I\201\250T\244M`\266t\rQ\323\253"
+	.ascii	";\263\325\024r\300\n\004\352J\210^\272\3359\3055\372^\376\r\244"
+	.ascii	"\203\364\016\0363SB\2524\352[\227>Z\274\177\370\306\352 \031"
+	.ascii	"\323h\211\251\036\366\2129\304\253\321w\217\277\225-\325:\200"
+	.ascii	"\230\002\370"
+	.string	"\2009\261\241\322\350\315.\237\350\371(\331D\257y\264xG\231\350)\227\353}\376\244\256\204\2215J\202M@\021\335\255a\332z\352\035AZ\312\304Y{G\353\360!\221\033S6\3329P\374\356\220\264yi\364\275\226\236\273\302p\332oi\3506\335h\262~uiy\221\361\363\211\326\026~\376\232\326+\325\023\226U\304\220\251:;2\214\307j\234f\327\262\024G\030V\026<^c\267\037r\275Q>j\224\200\265\200\303t\370m\271\336\036>aTSuvk\370\215\223\032\"^c\374\024\013\343\342\256\237\315\340\361\031V\363\302I\351\303q\243\212\356\336\365\025\274\261\331\257i\3506\035)\242\305\353\317\\\272\260\231\365R\246dG\234\320\335{\3534\016\316k\247\276\301v:\331L\275\304G\360\235\276\215\354&v\262\021lw\024\353\275M\367\336W\300x|\307O\353\245\274MVg\212\256\354\200\341\262\273w\205"
+	.ascii	"\005\004,&\252\355\016\001\364-$E\037\351\203\340\257\365\254"
+	.ascii	"\326-\224\337\347;\253:\322\f\362\344\367\365\220\255\031\242"
+	.ascii	"\325\350}=\322\373v4i\322X:x\336%)\"4#I\246\330\221p\362fEM\211"
+	.ascii	"\022\313$\305\272\362\3032k\253[r\313\244\201*^\246\244Y,\022"
+	.ascii	"\213\244\335\330p\251R\333\262J2\365\206Jj\257\354U\273\245\227"
+	.ascii	"\210*5\273\237%O\314\257F\237&i:m\223\343x\275Q/\334\244QUU\226"
+	.ascii	")\026E\207\326\021\351:+r\313\\\"\367#\256G.\265B\254\020KE\302"
+	.ascii	"\3559b\307\307v\343\316\232\035rK\305f?Uh\262\272z\326l\017\333"
+	.ascii	"\303.\303\236\320\225M\251\332a\203\334.\307\234\211r\246Q\013"
+	.ascii	"\244\275\320\251)1\271\0376HY\230\327\017\037(\326\234\262\270"
+	.ascii	"\256\362{\036\301$\307N}Q*\253~w~<==\341\301\203\237(\021\255"
+	.ascii	"N+\023\206K\243\357\231J\177\373\364\304OF*Sg\030\025\235%\233"
+	.ascii	"\273B\347.\2657\354\r\253#\275J\204\234f\246\2326\307\255\216"
+	.ascii	"\246\303\\S\304&\tX&\031c\223\026\207P\024/&B\264\225\215C\204"
+	.ascii	"\314\233u\352\301\245\267H\266LN\313\304i\275^\245\005qi+~\250"
+	.ascii	"@]\275\371\222\2369\255\367\333kocq\323\"\342\316\235\306\202"
+	.ascii	"\256Wj\005\270\336\225\035;\234\206\003-xt\034\324\231\023\023"
+	.ascii	"\"\255S\247\355\206.\023\2327Z\277\2616%X\224\021F\264]_\346"
+	.ascii	"\275Z"
+	.string	"=N4ltAA\314\234\222v\r\027\301\222\314\221F\337k\242k:t='N\234\236\003\207n\335)Y\312y\317a\243&\353\331h\327\265W\236\223\034C8\016HG\0170Ut\322\363\270\275y\203\205\323P\265\t\002&\225\273\\\273\341\345\265h\252\252\324\266,X\233\2636\262T\215\232vC\202\325\023\017\217071\215\266\033\237'Y\227\"\340\232NlN\f\216\r\2331rq:\007\217\03399\3164\272\346\314\003\312\215\265.4h\216v8ZY\351Wp\233q\266\231\243\221"
+	.ascii	"\302\326\033\272\253\274+\316c$mkk7\004\216\250R\333J\335|\350"
+	.ascii	"\260:\235\267\033\317\231)Yd\215\236\007H\232\326"
+	.string	"e\322z\215\f\231^\023\243B\345\350\260\272\250\275\327\354\234\036Y]\274\004\310\303\302q\227\036EK\337a\270\3058[L\357@\301\266\2568:\226\236{G\217K\233qi0\275{yeF)\357RI\364\367\331\033\f\212&\313\032\270&\353-\357.\316\356\322e)\362^\016\353\262\\\0221\224\260\261,\375\345]\326\013\203\"$L\243\355\245\275\370\312\\\033\254\306\322k\213\262S\247\321\243C\244G\257\322\277\377\336]R\336{{\360\254W\311\004\324c\036f\242?\210-/\360\037\275\367\277\375\217b\206\365\"\303\232\314I\245|Y\032\362\024\227\305\275\267\251\034\272MKR\311\265)\265\005\326T\336d\223\216D\216\273\244L\2021\231\314\241\333\304Tr\022\214\211L\336,\251\241d\323\2222y\233\227\223\227y\225MMd\211\2736\245\222`L)\022\311\246\246\222o\257\301BM\022\036\213\206\304\244$bp"
+	.string	"#\0138$\005}\257\301\242\310XTu\020\026\217\b0\022\213AaR/IM\352y\r\0264\206\302\342\321X\244\036)!\005\207\302\242\242Q\251("
+	.string	"$$\245\341\2208\3549\032\251=\b\215\275\035\210\305\032G\342\260\247\006\240\212\204\036Uc\222\232\324{\r\026&\314(AF\321Q\245Q\004\036o\b\022\221b\250Eb\f!\342\214\243:\002\001\276\243pXBP\020\t\030\024@\t\t\030\343\250\312X\200\306\317\t\t\314(\340\204\001\216*\215\241\343P\r\002\211&\240 aT\221pH\002\3120\322\030\n\217B\240\013(\222\324\243\221\007\031>G\033*\n\276\243\261(\024\341\204\252\0031I]\341\347\350\310\203\3248\024\002\217Cb\220\332\203PF\220\221\230\002P\021\250\"\305\310\301\307"
+	.string	"cPx4\312P\215\352\nE\006\216C\265XT\n\376\374&`q,\002q`\241\026O<(,\252C\225Fz\013\\H\340\342\205\215\236\277\2001\001\214\tz\177\001\243E\013\030.Z\244w\321\302\032{\036\344\001X,z\240*\251J*\374T\243#\237\243\021\005\025"
+	.string	"\035\251H4"
+	.string	"\207!\030\205>$\241\243\021\261\206a\t1j\b\222Pi"
+	.string	"\213\252\016@"
+	.string	"\216F5\004\323\327P\340D\034\324b\321\221H,\026\375 \001\217\304c\211\"\260F\020U\223\200(\334`\004\316\240A\311\370\203D$~`\304\023Tk\004}\301\241\222\b\351\021QXTS8R\213B\243z\024t4z\321s\004\036\215?\036\216\302\"QXL!(L\002\016y8\022:\032\271hq\034\n\225R\243\212\024\344!\206J\303\203\240\243\321\017\360\210\244\202p4\252G\240\t7\030\201G\023G\017\216T$\340\220\206P\306\321\bD\372%)\311\2401\024\352@L\n\340hddAM\022\036\323g\220A\214\024,\2400B\032dQT\221\224\216\324\032Ac\321P\bL*\n\026\215E,R\250I\302\031C\242\360\250\024Tm\204`\003\2304\364\2655\333\346C\376\332\230=\251\263\273K\037l\267mfBn\222\240\2515j\313\360\363\314\035'F\300Q\263^\256\256\354"
+	.ascii	"`i\205G\232\033\264\315\252M\324\230\265_U\0354lb\346\370L\221"
+	.ascii	"\363\344\016\255\301\240`rwG\204y\376\224\371\262#\006\f\247"
+	.ascii	"\365\202\334\300\333r\326X\322\2617o;\254\231\335\302\203\013"
+	.ascii	"\017\211-\263X\336\262\344-i\264\313\337\305z\341\257\033\325"
+	.ascii	"\023\203\222\225F\224\006\221r%\207\365\362D"
+	.string	"\345\304\344\331\351\262\336~\255v\213\220\362\336\247k\233n\225\233\226\017G\025\035ma\267[n\311\206H\234\316F\355\330-\327\0229\316\344\323rA\221\343r\247Q+&\001\221:F\3548\257\344\214\023*\215\266\005\203:\243B\244Q\253\345p\202\270x)\241\362\nK\237u\033%\313b\261k\200.\362\353F\365|!\203\325ew\223K\242\037\257\035^f\256\334b\271%\202\202\013>\227nUY\263\324\250\355\272\345Z\262\235\321\ra\271~\237\217\224#`V\220\244\227 \375\002\"%\325\250\335\372\334\224\271\2478\215Z+G\003Z\262\261KR\245\315\n\rS\243V\212\235\302\316\257Y*\377\235\341\030[+\022\203\f\250\322\3318G\362\220B\206HDD\222$I\0072\n\020\006\203a\236\210\346\r\022`\0059P:\206ffD\244 )(\251d\031\003(\213\212\316[L\340\226\226\203\3704\332\223W\265"
+	.string	"?\220`"
+	.string	"@o\023_\210\262\366(\340\325\374VB\240\n\323I\311\316 X\351Oe\257.n\227\023\343\272\261\362mRh\331F\203\301\2671\302\371\346k\031\024\300\027\335\267\214\340\361c\213i`\274k\333\237\"F\214Y\320\027\226\251Q\202\310\223Y$6\225 \003^w/\367\311\377\216\346\002\036\365xVZ\\[Q\003N\241t\004\220"
+	.string	"\237\220\373>K\342\365f!C\0075[\033"
+	.string	"\352\341]\216\024\357G\263{\351\221B\332\236b\211\205o\203\202\226\274\236\315e\223\372Ra(\020\242U&\372\361\373\304\027#/pl^\345xQd!\313;\301U\336\220\254\227\326\355\220\360z\316\"\331\347\311"
+	.string	"M\006\241\211\354\3258\023\364\002\224\027\365\021\251\222+\201U\267\3402\035\213\n~\202\235\365v\026\034/\312\254\315\006\250\\>\f`C\006\206M\234\243\207\2679\263\251\254I\314Q\031\322\241\032\215\333\365\255\242\353\022x\340\314\224k\323S\035>\273o?T\246\225(~\324\273=W\244\277\325O\274\216\200\360\306\207\367O\020&m\332\2453\325b\362\rm\224\223\361\220\r\201F\377\231\270\337.\022)\220\374\005\266Uj\367\026\257\216\224\322\021g\273T\305M\365\313\350-\017\235\222\036\r\225xG\370^\nDRI\376\323\301\200b.\245\341\332\2361\301\001\240\350q:e\373Y\273\026\374\312\217\374\363\236\r\215\031\361\206\367\036\204\020\026\327\340\307(\206Z\275\316\026\027\022\315K\316\002\212\271?\202'\021\200\032|:\335\345;J\342\356\013\315IP9\207i\242QY\034\001\300%)+\203"
+	.ascii	"\225\301N\242nh\350p\350\354\205)jN\031+\3404\025x\341)\217\225"
+	.ascii	"\304\035\246.\206\314\352\273<tI+\237\202R\213t]\025\234\004"
+	.ascii	"\224V\264k\371\272\366\025&\030TF\223\"T^\n'\020\3367\224\365"
+	.ascii	"\267\210\341! \361MJ#\003\b^\376e\n\367/ \324\033\256-\340\366"
+	.ascii	"\300]\306\326\013x\203\353$\264JRf\"A@L\342\004\356\242\032\255"
+	.ascii	"\203i\020/\214E}\261;1\333\026(\343\274\316WB\376\331\206\312"
+	.ascii	"KZ&B s\244\235\2628\201\337\350;#Qv\346\310\373\272k+z\311\232"
+	.ascii	"<A\366\217\350"
+	.string	""
+	.ascii	"e\351\022\361A\240\303VG\034\006\352\262W~*\262\005\033y\001"
+	.ascii	"\323\032f\200\006t\237\245\337\3161\345\252\027X&#\306\235*&"
+	.ascii	"\271\254;\311+\362M\t\017\244$\214\370\367~\354O\307MW\214\301"
+	.ascii	"9\232\203\374|\331>^\255\300\362%\302\201\320\265K\350Z,\326"
+	.ascii	"O\356;;D\217TB\241!|\310\036\372\024)h\2532\tmb\215o[9g\350\302"
+	.ascii	"\303\310\374!,S\245S')\340f\232$\177n\022\323\024;\220\321\214"
+	.ascii	"1\3052E\273\2726)\372\245\222@.\207z\025\264\200\266\243\003"
+	.ascii	"I\305\315@\020\256Lr9\352\326\235\244 \321\213>e\313\225y\314"
+	.ascii	"\\X\301.(\267\3734\273 \300\272P$\216\236LQ@\343\205\310(\n\271"
+	.ascii	"H\311D\206X\245\243\337\267\361\300~\244\352\236\331\373\204"
+	.ascii	"{\013\r_\365L\327\377\021m\325=B3\274`^\356\347\205\320)\002"
+	.ascii	"\270V\326}\204\022\303\3442\223u\001\207\"\035\224\221T\246\264"
+	.ascii	"\361U\301\232Thj\231\034DP\366l\336e\216\017\322^\336\364k<\""
+	.ascii	"\225\351\327y\306\203\364.GN\221\025H\214\201\376\343rSA\344"
+	.ascii	"\036<\224\367\253P\333\266\t\006\006\350\2703;\233\361*\256%"
+	.ascii	"X\220\217e\377\020\037\337\232\345\247;"
+	.string	"*\330\355Q\2767\360\326\210\004\365\254\301\240\212&\375{\004\005\365\2142\346|\215\336\334\236w\274d8M\230\347\307\310\243\027v\203\371sY\0300\006\020[\214pY\177\350\251{|\373\200\034\230\032\347\233\344|~6P\205\253:\370\177\227\302R\023\346\362\022\344\246hWaT\3410\227jRT\310\021\242X\0308\326\246\224\0054b\234r\251\223\"\345\377\227\203o5\227\357\024x\f<\233\220\273\226\333^Mv\362\234\030[\264\253@\211\267P\027?0\274\263\207i\273f\025\3040\366\354}\247\355\221\202\036\252w\027Ft\322qL\206Wdjq\222\017\235\202!\334VY\375\036Y\237\2110\347\311\007 \035\262\343\311\337\350\377%z\024\302\264\215\363\347N\204E/_\303\177\224w\251:\311\254Y\242\2600\353,\342/\341\035g\270\311\367\275\237\374\305v\236KY\336\230G\225\334\345\2261\\\236\227\332Z\327"
+	.string	"\007\361\277\234\325K\312\343\322I\212\273\017s\016\371\032\351c\344wE\335s\312\006\034\357\373!s\306\252\376^\336Q\377\203\362\215C<\257\230s\234w\264\321\330\262Ki\221\305I\213\025\n[\205\035~\344\356\350\314S\301\027\034\246\213\345\246\346\371\357Z\256\274\226\342\335\024\222\237\345\003\307={\215oR\235'\363\310n!\363\274\235K\013\377\221\331A2\277v\252\236\037N\201%\230\326\206\233\362{\324\275\370\271\031\232W(\337Uv1=-\271m\371M\331\214\256\355"
+	.ascii	"\342\n\003<g\3157\310\340\205\237K\276\364&&\002K\357;\227\037"
+	.ascii	"\031\203r\313B\217\230\3235D\352\255\363H\264\343>j\3359\272"
+	.ascii	"g\235\341\245_\366\007\274\201~69\375[\210\3474\362\037\270\231"
+	.ascii	"\177\031F\230\230\344\376\313\310\341\2649\310\255]S\327\200"
+	.ascii	"\317d\257\321O\372\377\007\2152\331Cp\200\260\f\256\222\t\370"
+	.ascii	"\004\336\242\255\265W\266\372K\372\227\313\367\231`?,\364qb3"
+	.ascii	"\264'\234\302V,/\264\364\021\230&\353\313G*/q\033\207\263\325"
+	.ascii	"\232\300\030\255"
+	.text
+	.section	.gnu.lto_.symtab.ceda7029d4200bb7,"e",@progbits
+	.string	"queueClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\001"
+	.string	""
+	.string	"queueContains"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"queueAdd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\001"
+	.string	""
+	.string	"queueRemove"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\001"
+	.string	""
+	.string	"queueFirst"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"queueNext"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\001"
+	.string	""
+	.string	"taskSystem"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\001"
+	.string	""
+	.string	"averageSystemLoadPercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\001"
+	.string	""
+	.string	"getCheckFuncInfo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"checkFuncMaxExecutionTime"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\001"
+	.string	""
+	.string	"checkFuncTotalExecutionTime"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\001"
+	.string	""
+	.string	"checkFuncMovingSumExecutionTime"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\001"
+	.string	""
+	.string	"getTaskInfo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"setTaskEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\001"
+	.string	""
+	.string	"getTaskDeltaTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\001"
+	.string	""
+	.string	"schedulerSetCalulateTaskStatistics"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\001"
+	.string	""
+	.string	"schedulerResetTaskStatistics"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\001"
+	.string	""
+	.string	"schedulerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\001"
+	.string	""
+	.string	"scheduler"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\001"
+	.string	""
+	.string	"schedulerGetTimeToNextTask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\001"
+	.string	""
+	.string	"cfTasks"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\001"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ceda7029d4200bb7,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
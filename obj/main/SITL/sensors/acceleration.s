@@ -0,0 +1,1250 @@
+	.file	"acceleration.c"
+	.section	.gnu.lto_.profile.db0c74fb9cb707fb,"e",@progbits
+	.string	"(\265/\375 \nQ"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\020"
+	.string	"\037"
+	.text
+	.section	.gnu.lto_.icf.db0c74fb9cb707fb,"e",@progbits
+	.string	"(\265/\375`\306\001\225\f"
+	.string	"$\021\272\002"
+	.string	"\036"
+	.string	"\331\364\215\335\002\004\002"
+	.string	"\002"
+	.string	"\002\001\002"
+	.string	"\001\320\212\237\333\r*\002\001\002\001\002\002\002\003\004\005\002\005\002\006\002\006\001\002\004\007\001\352\263\360\321\b\003\240\342\234\212\n\004\005\006\256\243\305\237\002`\b\002\t\n\002\n\013\b\200\343\367\203\001\t\342\306\306\223\006\n\016\254\365\230\374\f\002\002\f\002\r\020\213\236\334\307\005\022\016\002\004\002\017\020\002\021\002\020\002\004\021\022\023\024\227\306\230\276\016*\002\013\002\004\002\f\002\f\002\b\002\004\002\b\002\022\002\020\023\002\023\027\251\274\224\333\006\030\314\341\206\214\004\004\007\002\007\031\355\214\377\356\t\032\273\330\316\306\r\006\002\033\235\247\322\226\006\002\002\020\002\024\034\350\207\356\301\003\016\002\025\002\004\002\026\002\026\002\027\002\004\002\030\002\030\002\031\002\004\002\032\002\032\002\f\002\021\035\265\372\210\203\b\002\036\200\333\377\224\002\037\302\273\360\257\005\002\002\033\002\004 \226\266\306,\002!\324\237\236\201\n\"\211\326\207\344\017#$\240\342\234\212\n"
+	.string	"; \240\0022\032\362\022)\fI\252\004\022\313\271R$\2630\033.U\307L\327<Z\324\225\300W\343"
+	.string	"\032\003L\345\255\005,"
+	.ascii	"\311{\267.\207\307T\324\261\355\336\032\257\2609\315#\022\212"
+	.ascii	"\271^\375\020\033{\030q\301\377\201\354\027f\220\005\237r\360"
+	.ascii	"\200aS\013\231\235\351,\f&`\327\024\300`\3406\222>\240\020\353"
+	.ascii	"nj9\3562\307\316\342\243\260=\002\001\246\b\030,6\225\373gW\224"
+	.ascii	"!"
+	.text
+	.section	.gnu.lto_.ipa_sra.db0c74fb9cb707fb,"e",@progbits
+	.string	"(\265/\375 \325u\003"
+	.string	"B\004\r\026\260i8\f\303`M\222$\201$[3\262\020\314\3564\266\345N)\217\2437\223\331e\267br\311\"{l\354\026\n\372M\007.'\266v\n\013\354\357`\024\027"
+	.ascii	"1SD\317AR\007\370\303\024\235a\204*\340\325a\242,Nj\f\252\212"
+	.ascii	"\333\274\0053\001\032<a\351Le\237f\001\254\f\214\315l\221\345"
+	.ascii	"9\025l/\326m\240\r"
+	.text
+	.section	.gnu.lto_.inline.db0c74fb9cb707fb,"e",@progbits
+	.string	"(\265/\375`\t\003}\017"
+	.string	"\026UL? S4\214\001c\2508a\"\357\fJr\017HL\304\303\033L\031\254\355$9\261s\303\312W\214\017\300"
+	.string	"\220m63\0174UO\207@\024\f#v\272),\241\252\232\272\375\346n[J\231\002>"
+	.string	":"
+	.string	"5"
+	.string	"'4\344\360ay\222VP\225\340\200\026\2561w\022\317\221\244/Z\2140q\215/\313\006\223\f2\260/\345\005\f0:0(\245\207\t#4\022\214yV>D\311G.Y\354\356\365\231\365$?rl\3474\243T\355\256\207\362k\211\236\212\024#\250\245\004\223\354\201\253\023\\pi\031a\220\225\244;v\027\301\230\205\220\273\273)\322"
+	.string	"\003H\f;\255\255\323A\336\b\361V`\373\200\267N/\371)[\300[\207[\367\027}\353\360\361\242\031B\265\342\321 _M\371\201\004\225\332\305\232\307Xo\235>f\326\277\002\334\\kA\203\036\350\367}\001\377[\220\303\022\307\307@\206r\032\251\215\020\017Ev\001O^!]{\314,\221\202\330]N\f\022T\367\271\363F\204S\022)\021\n\225O\307\252\344\200)E\314(\3618\023PN\310\332(\026Y\250\001E\211\204\002\222\231 m\261\001\220\002!\251*\017\022@4M\210\264h\212h\\\377w\030\334\026\263\013\271\f\360\246\217\375\277*\277\361\374\272\306o\233\234i\220\f&\026[\020KO(\201w\017\317\246\025`.\371\372|\366\210i"
+	.ascii	"\300\234\307#\242\323\312\220\256\265|\377C\267E\003\322\361"
+	.ascii	"\221\355\214Vs\370@\3455\254E\207X\2014z\264<\324\220\231\224"
+	.ascii	"\361\205\314^\233\370$z\325\"\245\271\355C\r2j`\332\035\204/"
+	.ascii	"\305L\310\256w\242\337\363p\337\200 \f\253\200\n\301!\315\356"
+	.ascii	"z,\217\265IC\235\373\227\373\373W\201\327\320\242\352\314\203"
+	.ascii	"\203\001pZ\316#\315U\023"
+	.text
+	.section	.gnu.lto_.jmpfuncs.db0c74fb9cb707fb,"e",@progbits
+	.string	"(\265/\375`I\0015\b"
+	.string	"\362\314&*\200)I\0073\260\f\221\006\354\20771 ht\273\2050\003\273\300\223\200\310\3414-\212\276\370G\214\213B\241\324\3557\221I\006d\323C\277`\fs\212\002\231\320,\344\344\311\314\260\2227\\\246\310H\210q\210\365Zz\037\201\241\367\3509\276\007\244\001Y\240\020\220\003UU\376\274\363\030\027\3059W\301\b\252R\332\376\203\271[b/\261N\211N|\026vS\323'\357\342\234\007FP\351x\236\347\271\022\257\225H[\002\332#\b@^\251q\245\331\030\302Z\2432{\350)\300:\004- `\242Aw|\305\304t\311\2003\002\252bp\226"
+	.ascii	"\270\213\3414\256\036\271\256[\021('\006m\026+\001/S1\273\200"
+	.ascii	"\367al\026\266\303\240\361\300\267\025\323;S\234@9\217\2156\003"
+	.ascii	"\335\005\344+\230\272\210\363\310\026\336\354vo\240\375\200\004"
+	.ascii	"\272IK\217\016`+\351\345\r\\;\204\335\271\027\326N\323IMj\300"
+	.ascii	"\r"
+	.text
+	.section	.gnu.lto_.pureconst.db0c74fb9cb707fb,"e",@progbits
+	.string	"(\265/\375 8\301\001"
+	.string	"4"
+	.string	""
+	.string	""
+	.string	"\021"
+	.ascii	"\232\004\001\232\004\006\232\004\016\230\004\020\230\004\024"
+	.ascii	"\231\004\027\230\004\030\232\004\031\232\004\032\232\004\033"
+	.ascii	"\232\004\034\231\004\035\230\004\036\204\004\037\230\004 \230"
+	.ascii	"\004!\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.db0c74fb9cb707fb,"e",@progbits
+	.string	"(\265/\375`\243\001\275\t"
+	.string	"\222N)+pk2\034\374\252\252\212\216\240\376\277\212\200(\240\376*\326\277#\252f6\371\345W\033\2624\235}\032J\\\221z\020\356&M\246\024r.04\221\243\005\225Vl-\023U\210\322Z\024\363\211y\2472\347l9\363\315v3\327l5{$S\251\2642\333I\202\"\034\250\224\301Z\360x,\213\216\217\2658\326R\3021\353L\240\236\201h\331z\304\2429\004D\005t"
+	.string	"\035\263\305\314%\333\207"
+	.string	"\025:\251\202\326a~\331^\216\350i\233\246e\336\260e\230S\366,\004Q\266\306\032\272[\331\254\354\215\0350\3512\002@\250\241-c\210DDR\324\254\001@\002B\030d\346\001\021@94\252h\232}\003\303\212\307h\016\235\031\304"
+	.ascii	"\212\314\340Cx\241\272\267\356^\247C\317\272J\025\217\253\240"
+	.ascii	"r\264\352\352\302gP\200#HdC\351\205\377L\"\024\3409t\362\"\321"
+	.ascii	"\336\261\344\316\026r\350\001\275g\321u\212\013\366\221\304O"
+	.ascii	"J\t]\376[W\263\251\376L\302\007Z\340\341Tk*3\2170|\370v\324n"
+	.ascii	"\355\001\201;U7\342\017\211\3343%|\243\316\366, \n"
+	.text
+	.section	.gnu.lto_.lto.db0c74fb9cb707fb,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_accelerometerConfig_Registry.48.db0c74fb9cb707fb,"e",@progbits
+	.string	"(\265/\375 \234}\004"
+	.string	"\024\b`"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	"\005\001\212\001\202\200\200\374\342\303\325\261\033\030\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\354\007us\350\374\006uq"
+	.string	"\005\001\006'\001\024#?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\"./src/main/sensors/acceleration.c"
+	.string	"\004"
+	.ascii	")\"\301$:E\2217\200\""
+	.text
+	.section	.gnu.lto_resetRollAndPitchTrims.49.db0c74fb9cb707fb,"e",@progbits
+	.string	"(\265/\375`g"
+	.string	"]\t"
+	.string	"\226\221A;0\345(\035\200\203\376<v0\347 a2\251c\"n\346b\363\306\033\242l*\3135\213\335\241\"\313\"\"y\003FH\310P\204X\307@\212\271\210\332'v\352\037\321>\267%;\245-"
+	.string	"/"
+	.string	"4"
+	.string	"\237\234\013h\237\026\355\231\217\252=KdC\005\266\2734\003\271x)\3727y\300\tU\272\334,\354\256\345\t\325qg\267\215`\273\301\266+\3665\273\273\316R\366W\277\234\232\013\246\340\265\313\021\013\260\255\3512\322\261}i\237\344%\342W\244{vS2-\273c\202\0258\237\036?\240\005\232\315Rvx\265L\231\206\237r\233\342,+\006\252\023hvxV\205A\266\305Q.\f:\301\310\2201!\237>I\373\334x\274\300"
+	.string	"\230d\314\036K2\373\b\241\310\253\020\022\334\310{\210\370\030B!\260z\314}>\320\033m\265\013u\034\267\321\260\202\341\327\205\364\3636\021\345jH?\007\006'\272JG Xig\334\007\r"
+	.ascii	"2\2419\034\030.,\310\256S\t\267jBL\274\241\027n\301\220K\260"
+	.ascii	"\315j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_accResetRollAndPitchTrims.50.db0c74fb9cb707fb,"e",@progbits
+	.string	"(\265/\375`X"
+	.string	"e\b"
+	.string	"\342\31788Po\322\001\240\234~D\306\267b\020\307\337\210 \326\032\356\245\350j\220\027\007J\344\243<rdYD\213\317\002!\025UTDl\005~FiAH\241\242m\357\266wJ\001\2766\031\355|\254\212-`\327eM\255R-\303\264\231u,\317\274\25267\004\246\fX\235\037J\353\254>\356\243kL\242\023\027C~\310\357Y\341$\246\021\315\0050\367\354y\211\232s\317\r\007\321\314\271\364\277\1778\370\034\227~\200\200\357.\003\036\201\271\274w\203\013\023\224\n\007S\366\027\2021\303\376e#\206}\311T\240\f\254\354R\244Z\366$K:l\337'\335\003\335\303\t'\325\245\r\262\253\313W\336\354\224\177\033\373\022iB\004\265\2733j|;\334\374\217\016\320\211$\0163\b\273k\330\211,\356x\333\005\266\017l\263\004\017"
+	.string	"2\003\302\360\305\302>\231\020"
+	.ascii	"\021P\034U\311\036\bx\273&v\207\310@\005t*\350\313\025\340\322"
+	.ascii	"-\332\371\004"
+	.text
+	.section	.gnu.lto_accResetFlightDynamicsTrims.52.db0c74fb9cb707fb,"e",@progbits
+	.string	"(\265/\375`\246"
+	.string	"u\t"
+	.string	"\226\020>;0\3456\035\200\323\255\341,\363\254\212\342s\305\032\\]\260\325\252\240\371s,\254v`'N\020\365!\300\247\250\333a!\021\210 `\305\340\t\306\337&\213G\004\222\230\346\035m\247\024*"
+	.string	"."
+	.string	"."
+	.string	"\237\307\f\3325\037G{SLF\212jw\251\365q\360\022\364_\372@H\204qy5\354\256eH\264q[\267\235`{\301\276C\027\257\300\221\"\001\b\345\312\036A\322\362\260\037\260V\207=/\222\314\001\314\256\306*\300\242\346K\210\355\373%\027?'\361\003\r\366i\177l,\242\231\243\374\242!\276rR\271DR\252\327\315Ewn\252\006\242'~\362\025\214v\227\341\323\037oB\341\203|\272\302B>\364I\360\213\315g\3268]\345<\231\267El\232\226\321\317\253_\267}\264\343\262\016\325\274\217r\020\\%6\217zj\365(6\206/]\3404\202\n-\020w\227\026\226\025"
+	.ascii	"2\003\302p\331\302\326M8 \033\300\0358\230\327\336\006f\220\200"
+	.ascii	"\023p\334\257\222 \001{\2039\240kxw\b\007T\024\247\"_\356\005"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_pgResetFn_accelerometerConfig.53.db0c74fb9cb707fb,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\225\b"
+	.string	"v\220<7@o\323\001@\035U\341TbYO\2463J\204\357>=9\256\212\243\364\262\234 b\036}\233\216\002\\\2248\216\002I\334\345\252\003\230pY\345E\353\264\245m\367N)*"
+	.string	","
+	.string	"."
+	.string	"\323\251=\273\345b\307\276D\204q\362\262\273ur\334\273\364\374\217\034"
+	.string	"\004^\\j\036v\327\022\004j\334\363\266\021l7\330V\t\241\375\320/\251F\304b0\356f\2141;\242)\037\033\333\227\366C.\342=\344\271\300n\b\203\262+*x\201:\265\370\202\351\224\372@+\243o~\034\360\204\311\246\270I\205\031N\tH\245\016\3659\370$\026\035I\362\360=\323)\005K .\237\034m\361#\347\206\375\314\356\256g\227\225U\035\227a\224-N\246a]\265]\021\227eU\225\3334.\273\270\232a\225D\2656\256r\016\254M\\[\3554m\253\033\361{fgh\210\013"
+	.ascii	"2\241\003\034\030.`<Y\0135\377cl(\030r\t\266YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_accDetect.54.db0c74fb9cb707fb,"e",@progbits
+	.string	"(\265/\375`\235\003\375\032"
+	.string	"f\363\261I\260\226Q:\024"
+	.string	"\264\035x\f\r^\273\232\bX\031\255\355\332\221\034L\210\304\t\b\374\310\340\"j\247\310]\350\217\276\375\216\216>\016vO\373\263\2159\376>\342\270t\205\021t\343\260>\333~\003\275\t\364?i\204l\271S\n\242"
+	.string	"\225"
+	.string	"\226"
+	.ascii	"G\362\363$'\036\240\326\243\"P\265\006\035\030B\371\321\301\023"
+	.ascii	" ?\226\027@~\214 \341\307@\017\"\021\375\006\026O\351\252\326"
+	.ascii	"`lsx'\320a/W\331\"G\272\023\310\317\035\366\240\242\277(N\023"
+	.ascii	"3J\257\362\311\240\005\206\004\031y\222\257h\272\326\005\026"
+	.ascii	"\235\226\246 -^>\311\007c\266\350\n\211S\257\362\305\240\024"
+	.ascii	"\220\020\321\001\373\361&i\363\333Q\004\265\326\023?\207~(\346"
+	.ascii	"X\340\224\022 \362\321{\375\204(\203bT\230\327o7\367\365k\361"
+	.ascii	"\331\312\251\265z\366~,n\232\333\036\332\356`\257O\244}{SOYk"
+	.ascii	"\235\3403y\360\241A\352q\202\3748&)"
+	.string	"\021\001\0234\263|&?\361\025\242|X\305\3344C\353\002\355`nN\250\252\262\303{d?\311\177s\341oS\343i\327\227\356\322\323\255\013o\322\323\324\323;\375\001/\002r\365\345\300T\255DYe*\325(\365\343K\277}_\351D\303l/\341\312\234\257|2$S\2545\330\340\2433\274\310\177\316\304V_\220\242Xk\305\371h\013\345\307\340\227\374\\\210\263\253V\033]$\224\037\021\3209\355\037\t\273s\351R'\036\f\335\314\"w\227\364\302\213\362\343\310r\347\216Q\254\f\265\020\245t3\313\027z!Q\035\271\252\301\212s\022\210\374\332\206\\vs\214]\363f\355Z\211\371\336\267\347E\305*\3566\347?\331\020\005u\2441E\250\321wr\347\374\313CH\244B\027\350\023\257\201I\t\357\251\374\323M\247\315\222;d_\352Pl5\211S&\200\343\310'\037\312Ve\255\271\033\3718\362\243g\257\n\255"
+	.string	"r'\333V\277\221m[\315^\255\344\316\246\030T\273y\306~O0\234\215\207f\033i7\016\265\r4\233\314\007\204M\206a6\223\335\230\240\201X\317\036\354\324txd6\232\b\332l&\213\335l\265\333\016\355\026\333\321\221\215\210\315l\267\330\203\004\256\221\240\331b<\265\232-\006\013\326\357\221M_\027\2668\021\237\\\227r\227k\235\023\264:\230i\246\255\023b\276\327\332\023\237\243\333\234\002'5\240^\255O\335\224,\267f\207j\326"
+	.string	"\016!\303-\2739\206\207k\201MI3\230\352\3320\023\215\243)\345\002\247T"
+	.ascii	"\305\334\301\334\367J\027aS\313\225\345\205\321\370\250\233\322"
+	.ascii	"O\275\334!)\247\373!@\250A \243\fR\312\020E\220\211\346(\324"
+	.ascii	"j\f`\002\231:\273\003\020X\253$Mc\213z\005\305tr;\241pt\236\232"
+	.ascii	"D\311\231\363J\036\n\353\033v\377\261\355I\214\270\330|\254\025"
+	.ascii	"8\346\252\016\036~[\367\362I[\342\030\267\r\342\375\217V\007"
+	.ascii	"Fz\323\360b\301\373\274e\013P!\200C\312\0217\360\361\241;\326"
+	.ascii	"Y\t(\3172\340m\240\031F\264}\nL\240\341{\201\333\344\034\320"
+	.ascii	"\301\326DH[\025P\017F4|\222\200\017Mt\037\272\310\333\212\027"
+	.ascii	"\206)"
+	.text
+	.section	.gnu.lto_accInit.55.db0c74fb9cb707fb,"e",@progbits
+	.string	"(\265/\375`v\002\355\023"
+	.string	"\206e\206J\240\024R:\0048\252\270-\326SVX\245\337\332\273\347n{\217\370\276\3002T\263\322\377`\346\2553\326F\377\177\2776(\252en\232+O\026\236=\254\004\307\312l\223\303\202,\341\021\205\307\003\230;\246TT\253\204\220-S\nl"
+	.string	"i"
+	.string	"y"
+	.string	"GM\226\324\255\021G\223\355!\033\305\366\256}\027\217\032z0\203c\265\222HQU\353\020\306\n`\037Y.#?\212_!?\332\366\002\006C\246\037\002\217\276\244U4\365U\353\260\234Jt\351\305\271\324\007\360\333]\204!}\212/#\262\220P~=Q\306Ub\310\205_\017?\242\335\223\231Z\253\327\367\373p\217\267\355\3006\215\275]\001\037e\254\r\243\020\274mb\001k\317h\223"
+	.string	"\b\253\255\336\3349e\237t\363 \023\374\303\303\340Q\001\326\312{q\251\035\237\351\243m<{\337G\237\307\007\267\367\371\302\347\210\360J\342\305a\356\354ao\347\t\373\263\347\025\354\340i\302~\360_\361:\3465\314k\362d=\222kq\\Oq\275s}\331\235\222\276\212\334 \2515\246MT\305\336GN\226\rsgq\216\363WELLW\274\007u\202\325J$\343g]\213\266\240O\024\212B\221\037\305\231\302\342\310S\320\337q\201F\271T\240\302\353h\200\225C\234:\2606M\315\3367\247\213\025\226\025\006\233\026\240\205\007\277qSE5\215\024X\033\002\316\336\267\263\305\352j\253\367\032\032rd@j\255g\362\205\"\234\206\004\025{\302g\350\004"
+	.ascii	"\326Ze\002=\263\240\\-\350f\263s\263\365\374\370\314pp9\241\235"
+	.ascii	"\001\246\305\334p6\240Y\256\326S\243\321f\245.\207\323\335j\272"
+	.ascii	"\362f\233\371\224\264\234\256\214A`\334O-W\002\341p\271\022e"
+	.ascii	"\310\2738c\363\302\327\004!\022\203j\377\343\260id\0336=\303"
+	.ascii	"\233=\021fW\246M\225\350\322\336\027\233\342\326Zw\323\224$'"
+	.ascii	"\005)!D\253\304/;\316\017\337EQ\244\370\3201\300\025* \340\242"
+	.ascii	"\t\212\310\003\340\200:,(\031r\206\254P\264E\257{\333\013\207"
+	.ascii	"VoFp;I\023n\335\215\355\026\243\005\250\342\354\304L\246\326"
+	.ascii	"\230\256\367\252\215q\b\022\203\325\254$\333\022\314\036\002"
+	.ascii	"%\326\r\027P\230\322\247i'\252\340:**\032v\206/\266\203\202\025"
+	.ascii	"k\214\004\211\210\335\3254\006\b\005"
+	.text
+	.section	.gnu.lto_accSetCalibrationCycles.56.db0c74fb9cb707fb,"e",@progbits
+	.string	"(\265/\375`3"
+	.string	"u\b"
+	.string	"\266\020=7@s\322\001\030\254\325H\274\357\231\212\222M\264\223o\267/E\301}?\2010\255!k\263\337\030\033\332\242\263\277]o\004\355t\256\nK*,\204(\353\343 \233\354\235R+"
+	.string	"-"
+	.string	","
+	.string	"\004\327\2439[\346\035\310^\005\245\221B\263\273\022~\234\373\343\374\233\\\200T\022\375\0010\354\256\037\251\304q\303\333N\260\355`{$\366S\377\263\f^b\"fv7V5\253\212-!\266\277\261\375\236}\222\227pO\205\034w=VXv;\005/\004<\016\274\340z|\017\233no-4\031\002F5\202\031~\320?9J\310G\031\003\364Nz\364A\327c<\271\210t\214\336\312\356D\017\236\354[\273\273\206\246\023\264f\027\026\364a\243\235\tj\220\310:\330<\360\344x\264\354\203U\332\241sbr\253\332\346\241\233\364d\030\205\234u\223\034\004k\025\264\312\217\246U\031\b"
+	.ascii	"\005\006\312\204\366\275\300\305\205\022\227\241\211\325hp\227"
+	.ascii	"\027\355$\003"
+	.text
+	.section	.gnu.lto_isAccelerationCalibrationComplete.57.db0c74fb9cb707fb,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\355\006"
+	.string	"bM03pk\322\001\220\276\323\023\225\274\350?\342\037\342\031\016\333\001\375\255\023B\265mh\350\030\333F\377\230\007\366F\005"
+	.string	"\302'N\264\311\325\334kP[B\244L)v\224\nV,T|\013\3179\252Y\021Z\325\263ZU\241\030\232\213V\243\020\0306\274\330,\020\3066\311\366\nR\035\330(\307\376ErU}'\304\271\3067.\276\205\0350y\354\223\217\221|\272\006@lrdg\232T\t\373\322*\310vZ3}I@\024\242\320\261\353\031\215,\310\024\272\260\235\261'>@\310\370zF\341y\005F\207C\264\2335\235\370\365\274\374g\\\022\361\370\300>\232'@\302\356:\261\317\303\255\267]`\333\300vD\t"
+	.ascii	"2\001#8c\216#D\250@\\\023\037#\362\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_performAcclerationCalibration.60.db0c74fb9cb707fb,"e",@progbits
+	.string	"(\265/\375`\330\006m&"
+	.string	"*D\304\016EphQ:\023r;\021\2204$\265\007\356\330\206P\231\234d\022N@\313\327\331\003\021KW,W\213\335\001\324'\306\326T\337\362V"
+	.string	"\221X\007\202h\\*O\b\351q\265{\036q\026G\264}B6!r'\031\325"
+	.string	"\310"
+	.string	"\345"
+	.ascii	"\334\2256A\245[a\332\354\271\367.\375d\r\351\317\004\346\221"
+	.ascii	"l\r.\327\272q$\237\205\2147\230\257\345Y8\216\344\216\342R\345"
+	.ascii	"\336K\373\311\214\203\231\366\263i\314\374\312|,\317\002\374"
+	.ascii	"U\216\001F\327i\313\216"
+	.string	"2\367\"#0\205\364'#\237d\177\246G\262?\031\310\234\347\310\343E\233\250\031j\005\272\367\336z\t\367M\344\331V\340e)jO\263+\220\217\365\005_\200\210\305\246\313\024 \021R\344\251YAG \251\307\201*b\016\t\032\3169\326\025H\2012V\3244\272\367\326\212CsB\355Q\024V;\213\022\365\223\310M\363\301T\233!\265\242\0163\tN\022<\264\242S\355\207\371\003/;\304b\324+\212\341\336\313\225X\024r\236\235\231\24703\007f[&\365\344\2453s\210w\341\212\216\367\336\013\3743G\223\343W\375\344\031:\235\375yv%\253$\037\334J\263\303l*\250\357\254\201\226r\262\334\002\346T\0051\237\314\313\354\370U\314\202WO\344\331\237\006\372c\256D\244\216\322\030\254\313\276\3676uS1#\205\365\277\367^n%\314\263\312\016\224~\365'\230U6p0g\333\254\262\200Y\345\244\264r"
+	.string	"Ye\244Ye"
+	.ascii	"\262\312G\266\262\221\255\\d+\327\322\312D\266\362\220\255L\263"
+	.ascii	"\225gie\031Z9\265\225Q[\331\332\312'Z\331\264\225\333V\256\266"
+	.ascii	"\362\227\nH\301QA\346\336 KB\367\315\311\365\344`~V\376\326\307"
+	.ascii	"\324\270\030\356.=\201\216\344\207a/\377\002<\230CM\224<\255"
+	.ascii	"\207\374|\3264B\203fJ.Y+\0031\241-k\323k8\366'\355\003L\214P"
+	.ascii	"\266\321F\265\236\254\b\353\222\273\354\331\266O\257>\270\224"
+	.ascii	"\317\3312\2611+.\002\311 ^\322\177g\035\364\261~\2245\246\305"
+	.ascii	"\217\234<\016\372Z\257VN\216LeA\233\212ea\247RwX]\272\255{D\270"
+	.ascii	"\255\377gK\230S\025t\323B\270\255\225\372R^v\236\246\204\036"
+	.ascii	"\354\035\017\b><\fD\nFC\304\201cU\f\373S\351\230\f\276\316\355"
+	.ascii	"\304\030Q\242"
+	.string	"\236X\302\3764\033\245\002\2444.}\016\316v\224\223\253\035\343\240]\200\252$\273\337\340\210\216n\210}j\277\273\353\230\247)a]\262\027\216\301\027\233x\233\234\355\353\336ka\315\331\234H\241B\205\375Y\233\001\030\227\032\\\232\346\335TbJ\256`]\006?\236\215\234\371{\301\363\221h\241\223\301\013\261\202)\203\013\027=\337\021\353$0\365x2r\276\235\213\235N\227\273\375|\275\037\323\356wc\342\345^\334t\276\337M\302\002\356\301\330\371n2z=\337\215\206\f\376\267\2250\n#o\202-d\001m\354\345\362;\233\324\002\372\225HR\237Q]\224\262\246b\346\006\225\031H\005hUO\344c=\245c\346\210r\217\260\233\270\006\371\225*\244\230&\203\004l\226\n\304\003[x\026\003\261\352\217\fl\341'W\037\300+\r\374\252\034\366\347\263^\255\374\3002\205%\031\240\211\225\207\351E\354\203\324\001\372\3031"
+	.string	"}\324H\215\212=A\331P\207\273o1s\250O\035\256\365Uu"
+	.ascii	"\350o\201]\031\365Q\243bEmT\353\242\332T\2055X\177\326Z&\266"
+	.ascii	"\264"
+	.string	"\"\352\345X\200\204\250a,\310\024CffHD\2440I3\006\240\002\221\251\252\036\021P\261CN\321,Pv\266\003BV:}\330]\317\024!E-s\305\316\262m\027\362\326\037\fh./\325\022\305u\377\377l\345`A\031\005\332\227\332\260i\255\315\317N\372T\201\254\236\007\021v\020Bv\270\247\371M.\206P\301y\2604W\020\230\tq\245\330t\313\024,\004\207\232\246R\376^\362\220p\216K\370\335\2372j\r\346z*Z\274fs\207\r\305IvR\034\016\020\207\366\003\211\200P\bb\301\nS\312yS\036\354oKu\206\347\356\241\314\3312\206q\"a\273\202\026\326\303\007\300\337\216BZx\\\301 \250;=\202&\234C\334\322\375\202\321\362\236\226\322\r\304o%\3437c\231\rUB,\271\261\207\364\307\240\"\374:M\t\210]\204\315\311\007)S\\Z\343Y'N\005\350u\356\275n-\203"
+	.ascii	"\205te\312\200\247f\250*\225\027r\030\204\322\247\317\237\025"
+	.ascii	".\241\035\205\336\231\351\037"
+	.text
+	.section	.gnu.lto_performInflightAccelerationCalibration.61.db0c74fb9cb707fb,"e",@progbits
+	.string	"(\265/\375`X\f\0359"
+	.ascii	"\272]\244\024?P\350M\007\334K[Q\001Zc!"
+	.string	"\310_\222\340z\037@\315\312\360D\204\314\n\025L\324j\033\367>\006\347\347\304\013\271\313\370\202q\037\005w]\362\006Pxhx\f\322\233\354\275\367\336)\245\024)\001)\001?\001@\3475uVW\347tuFW\347su6W\347W\235=un\021\031\020\025\331\2704yB\310[\344o\322\335;\357\274\240~\272\351\215l\223\271\271\347\232\216\231e\036\275\206\241\314\274\025\337\356\275,\017f\266\317n9f\271\302\205\266\221>\324\373%\265\343\342d\321\275H\b}\262\026s;s\2775\\\333q?\236\232\356\331\\\023:\367\"%0\226\332'#\333\t\355Sm\001h\237\3342'j\244\361\246\\\326\322\330@\272\367^=\026\3766\221\315\252\267\275$\f\262\300UM\321\223\311|o\271S\017+\321\bY/\025[h>XT\307Q\363\251\025M\247\"]\210P<\230z\240r\204\255Y**G\2364\320\264"
+	.string	"\004\022[\363\251=1\203\221\322\004u\0305'\276\232MML\n\367^ \256\246\036\256\034Y\353\224I\243ih~v\331Z3\361\251\261\231\t\356\275-\327Ta\324\242\270\231\244\337|P\354\223d\311\310\231\351\004\250\n\242\226k\037b\304\314=\365p\357e'\0329\322\334\324\314\215\200\231A0\263\204\002g\036\311\344\364\025%\362k$\242\017\r\233.i(}\254%yK\364\223\303\251$\241\255(c\367\235\340\261\037\246\337\210\0264l:\f\314$:\320\026_\313vb\203\361\007\332'\372Xhy\307\270\363\367\3764\237\326\353\343\315xh\237\347\322|=y$t\036\236\371\302+x\307\273\177;\303\002]\247\357Vp\016\024\336D\024xDFe\376\027\241\347\f/\030\357\275\032\230U\264\234\025\352\275\027C\234\036\\\023\222[\302\320>\377/\270\335\365\233\206\023\306\302\205\013\264O\1776\357\316\222\361"
+	.string	")\362\345\277\255\273\320\376\027s\205\316<\022s\327\265]\027\367\026\366\372\362&\366\311\375\205\366\331\317\201\214\224\"\334Z\231\3771#\315\374\333\356\275d\374V\230\263:\256\033\253\221\315V\253sU\320\231A\352\274 \350\254"
+	.string	"\350L\005tN\260:O\001\235\021"
+	.string	"\235\245V\347(\325\371"
+	.string	"\320\331"
+	.string	"\320\031\212u~J\235\013\244\316\004Vg\247\325y\300\352,`u\016\260:\003P\235\233Rg&\325y\t\350,\004:\007\201\316,\320\031\030\3138\001\337\205\213k\311\"\340\205}~\307"
+	.string	"o\304\"\301\333\206\252[\t\360\302>D\313;"
+	.string	"OeX\225\364)-\270\246\214\224<\312P\365\"\200\317\340v\307\326\364i\037\242\343\232\003g\273\365\2022\267`Z1\336D\316\241go\271\350\354\311\270\231\220\231QfL\361MY\006\206\262#\361$`\255\231\366\350Ml\217h\237\354\225\2763J(e\2216\300\356B\231^\314\325\230~\2752h\331\353\267\361j(\315\372\023\r\023\017iGm\252\337\326>P\253\317\372f;d\207V4\033\242\304aU\322\205\274\340\232\222`Tz\332\322\247}\202\216k\020\332\201hI\031\375\354\303"
+	.string	"\243\233\255K\376@R\n\337\311\264\230\214~\233\310(\370\354\013\337\375\320\212f\225\264\254\222m\232\246\364A*)\251'\265p\255\232,ob\026\332g\360\255\n\311\350\245\226\n\211\375\365\016\370\033\016)J\253T\346\177\376)\204ff\032\355H\313I\331\215>\350"
+	.string	"\341M\004\201\366\031\225TZ\375\372)\016\375I\253\324evx\202\240\335\246\325o*\214\324_\373\364\216\177~\033w\367\275\3672\275\025~\"\243f\316Pc`;\272\314\261\032`b)bx\341"
+	.string	"3\001\303F\026\r\032ab"
+	.string	"\330k\202\21500\034]b_4\276\274\274\272\256\306\304\302\306l|\215]\331"
+	.ascii	"\353\252q\345%6v5A\001\207\335\370\022\273\302\021\026&v\305"
+	.ascii	"\"\313\372\2550\327\243\275\2627[\242\340\314\355\224\266\212"
+	.ascii	"7\221[\256\325A\177\324\226\213\314\236\214\235\257\233\216E"
+	.string	"\370 A*\024\332t<\302\001\r\031C\3231\t\337\333bn\272v4D\336\212o\312\252\367\243\247Gd\304\340\253\276\323*-x\005\317\340OJh_\314\374\257\315\371tmh\261\370\236\326\r\203\236\005\277\301-\216\352\025\374I)\301S\341\311K\260\234\372;v\020\374\224\233\226z\004u\350H\375\332\347\350x\027\365r\206SqBpI\031\370\2507\365\322*\3019\360Rnk\025\240\336\300\237xhh\332h\251vP_\302\314\226\"\034\033\266\256\321\031\345\035\2703F\341\267\261+\351\247\1771\247\245=>\375/Q.\203\005^\356\357\257\273P\002_\340;\216\300\247y\212\216\254\323\277\245\361\023\341\307a\327%\317lu0\232qz\254\274D\307\001Of\330\300\350c\316A\036f\330uF\007\263\305!\351_\006<V\235_\200\374\250q(\251\224clD$\210\202$I\322\030\220\002\021)\233\325\003\021"
+	.string	"\255c\214M\215(u\n\033scPk\3464\031\264\334Vy<w\317(\335\n\021z\023\267\320\212\355\212\243\035\210/J\203[;\374\352\222\001\267+H\\\255\0045c\267\031\367\321\361\375\323\371\022G~~h\004\261\023\205\274\370\223(\251ra\253\316\3126\325\226V\034\311\021d"
+	.string	"\216\\4\t\211\t,\361\007\236x\203\220\355\237\332b\256\261$-$\323\2146\256\001\260\213\345\251\024\256\220\304\227\201N\245[\333We\321\362\271y\030o\260\206%\315#\022\364p\315\302\200\303\332L"
+	.string	":\237\210\323B\021w\267\305D\234\032\2630y\335m\207\274\202\270o1f\034>R\351\260\207\267\2479n\250U\353\367\234\302\331\363U\276\005I$\221<\221\231I\005/\205\241\320zT9\330\200\007\307\220G;\373\326@\231$m'\3430\034\016B\240\241B\256\001\210\216\244\"\342_h\202n\024\245O\003\270"
+	.ascii	"t)x\037\004\231\352Qw\252n[\206\262V6\334\213\227\024\fx\271"
+	.ascii	"\231\017r\350E#\351g&\201\327<\260\033#\021,\006P\005\3555T$"
+	.ascii	"\336x\025?\003\017\020bLF\305\261\360\234;c\233\224\336Wbk\322"
+	.ascii	"\3107\270r\262\217\326'\370]3\205^\261\026 \252\331\003\200\017"
+	.ascii	"\203\234\024\234Hh\332M\307\224:\375\003K\224u\2045r9\200A\350"
+	.ascii	"\250\036&\214\277(I\213\031\376\305\240p\362\022\271\"r\016\372"
+	.ascii	"\300\324\n\316\0350\236\027;\242y2\275\240\023\365\004\271\253"
+	.ascii	"\314\356)\f\303m\002\022\306Z\363X\032Cf\210\312Rz\264\324\277"
+	.ascii	"\267\021\333\253=%\207\263\t1f\232\b\177n\200}\026\276\362\266"
+	.ascii	"\210\243\244(\263\234c8\343\224JB\303m\026\223\005\222\3418\t"
+	.ascii	"\363/Mq\226\032"
+	.text
+	.section	.gnu.lto_accUpdate.63.db0c74fb9cb707fb,"e",@progbits
+	.string	"(\265/\375`\355"
+	.string	"u\f"
+	.string	"\206WVB"
+	.string	"s\233\016\270\t\350n\013:\005h/\372\3178Hh\372\313\344\2024\214\305\337\0042\322\020\340\177{qJ]\337!P+\311#ID\352\275\252|B\255<\217\202\306\n\f2m\375\001\262\264\211\224)\005B"
+	.string	"A"
+	.string	"E"
+	.string	"/@=\332\263y<L\331\317\360 rQ\332]KOx\236z\2374=\037\300\350\363\2512\271N\tNl\230dF\240)\004G\211\035gy~\030\20521#\273\353\004G\"\356x\333\020l?\260?!_\276\330!(\325\204\375\267\224Ft\260\242\330'\375\030Mg\246_\375G\210\222\017\r=vA\274\004\331\033\261\206\212\214\355\247}\225\257x'q\270f\027E\006\215\335P\201\027T\217\016\037B=V\001\352\rT*\005\027\035\241\004\342"
+	.string	"\371\36012\001)\273\337A\030$\007^h*\003\022!\375\330\276\360\026\035\003\366v\027\222\0019v\267A\313Yt~\212Gg(\311\203\217~\t\365x=\313\023\205\312\212\223\025R]'\343$X\270<Y\204\n\232\003\016g\3434\276D\264-\363l8\214\203]\327\306\352\270\255\323\260\316\322\262M\307\272\270\316\022A\340\r\003\306Y\236m\343\254L\370\211>\362)H4\021H\214\332\027\226\007=\351gw7\024"
+	.ascii	"2\003\303\341\327X\270jI\317\024&\324\2550\317c!:\232\030 8`"
+	.ascii	"\b[\341z\271$\233\266\034\214\272\204\325\254F\003w\244\245="
+	.ascii	"\032\230\332\003"
+	.text
+	.section	.gnu.lto_setAccelerationTrims.64.db0c74fb9cb707fb,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"\005\b"
+	.string	"\362\01797Po\322\001\240\363)\311\217\242\007\224\205\206\024M\272\200\301_W\246/\207\342\326\320\275\303\261\367\320\342\232\021\022\307nE\024\242\021\214R\350\033\016b\2731\262\311\336)\005Xm\230\234\332\311(\247\300\327F\233\231\307\242\330\003v]\226\254tV\r\253R\313\254\216\274h\225\233\003O\b\214J\317\234Tj\272=\265\260d\207\213\223\bN\370A?\344\" \177\303\021\237w\356\321\377T\217\261%\345\205$z1v\027z\020\303>\265\273kX\262o\372\037e@B\221P\331\255\210\201\331S<\341\320\330\376\263\357\361\217\355&\320\005vK+&\273]\202\0252\217\356NP=f>P=z\263Y\336i\354KH(F\\vW\302\214o\177\233\177\220\007p\243\320\037\300\302\356\372q#\213\033\3366\202m\006\333\035\001\t"
+	.ascii	"0\223\241\214\351\3373\\\234-\005C.\3016\253)\340./\332I\006"
+	.text
+	.section	.gnu.lto_setAccelerationFilter.65.db0c74fb9cb707fb,"e",@progbits
+	.string	"(\265/\375`\025\001}\r"
+	.string	"&[_D"
+	.string	"\2216\035\360h\371g\370>\265\257\323\365\353\\9w\234\220\233\336\321Y<\366\223\3310\005\264\314@M\210\231\277\240QVz\271.\177G\377\377\236m\321C\270\234\310\224\274\216\b<\204\355\237>m\"eJ\001J"
+	.string	"I"
+	.string	"I"
+	.string	"\033\032\360\201\353\021\300\007X\217y\001\326\243?\273\306\303\017\373\024\214\n'n\354.\246\036\276\374^i~\276Fd3\"\201\257.\rW\324\323\002)\245\372\330\335\267<UH(\231\032\221\335u\216H\031\356x\333\fl\217\330\017\005\317\335\005\255+\366M\177\374\351NM\177C"
+	.string	"f\206(\265{af\307\306D\027!~\272\375\320G\231\343\227\270\211\357'\277\270@\f\327K*\206\215\335\005y\364\202\353\361\243:\307v\246\375\021'\361\335$r\334\355\260\002f\003\206\260\345GV\005\357\020\374wwUK\366XW\007'\032)\231\303v\204\253\360\\\273\213\300O\361\027\316gy\264\004\317Su\221\301a\212\352\243\270\213\310g\261I(?z\364C\326c\334 #\202\303I\316\330!\230Z\262\003\3366!\253(\214\200L\024<(i\240i\tH\262\r\264}\266"
+	.string	"\326B>\334\006\312\272\016IG\3232\314\3538\357\323\361\260\317\226y0\255\363\260\220\002\346J:\035\006\342\270\016\343\204{]i\371%\243E\314\211\242TZ\362Q\337\200\320\301\"A\236\252b{\244\003\022"
+	.ascii	"2\003\376\031C\301q\314\371]\3102\203\034MA2VZ\224}\3412P\027"
+	.ascii	"G\\8\270\253\2521b%:\270K\300\200G\215\354\017\245\f"
+	.text
+	.section	.gnu.lto_accZero_saved.2.83.db0c74fb9cb707fb,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\031\001"
+	.string	"\005\001\006\025\001\002?\202\210\200\030\1773\273\0014\273\001\274\001\273\001"
+	.text
+	.section	.gnu.lto_angleTrim_saved.1.84.db0c74fb9cb707fb,"e",@progbits
+	.string	"(\265/\375 *=\001"
+	.string	"\370\035"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\031\001"
+	.string	"\005\001?\202\210\200\020\1773\273\0014\273\b}{\274\001"
+	.string	"\002"
+	.string	"_D\030"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_accDetect.part.0.96.db0c74fb9cb707fb,"e",@progbits
+	.string	"(\265/\375`\253\0015\020"
+	.string	"\346\035kH\340\2626\035@\016R\r\200I\005T<L\261F\017_E\255i\265\372x\327\315\232"
+	.string	"3\304\200\032\220@Q\373\276N\214\247~1\323\023\202\023*\021\357\303<4@"
+	.string	"4x`\3452\030\211\200\347\230\206\016R\246M\366N)T"
+	.string	"Y"
+	.string	"U"
+	.ascii	"5{\211\366\352\2638y\027\376q\005\036|v7\364j\006\333\353[8E"
+	.ascii	"e\\\331v\212\n\351\323K\232\230\263~8\340\b\331-\271Wz\342\247"
+	.ascii	"\323\231\235\374\251\222A\235\036\366\004+|\260z^2!>\t<\003\260"
+	.ascii	"\262\273\336D\334\365\266\037\330\256`O\001\001;\207\031d3\276"
+	.ascii	"\306\366\370\032\257c\232,\233\032A\247\216\311#\273&x\304$l"
+	.ascii	"\257\256\3619%"
+	.string	"\023\332aS\255X6\355\3078\016\371\234\222\266\032\001\301\3729y5\204r{\211F\3725\2671\350\325/^\222\207a\332P\253\215\306\315\020\237\335r\301\253\033l\257&/\240=.\363*\317\033*tl\240(\223\374\200f\373\3445@\0034\273\353\300\347y,\203\217\342\325\342\313\274\352E{=\354\241 =`z^@R\263\310\244-\323\354\331\322\031\333\323\257\241\034$$vc\212\020\331\022\325F\212\357\374\256\377uj\337\376\315\350\313\370\214\007\237H\001\2340@\303\327B\277\260+\265\204\035\213\347u SH\372\302j\017e\004\212H]\370]\370<\257\343\304\020\024G\237\310\215D\235\013\347\205\"\207\202\300 \206/\344H \030r\240gKg|\330#\354\300\341\342\231\377I;\375@\275\222\2420\224\266l\007\230\363\"\315\266\020# @B\004\235\331\006\306d\361dc\f\221\b;\002tOi\257\332"
+	.ascii	"@\236G\230c\220\337\002\356\203\371\022!\035L?\2244\016\334s"
+	.ascii	"\271{\372\b\256'\247/\t\333n\333<K\036\370\373H-\261/\344\013"
+	.ascii	"/\205+\026\273X\013\253\021T\303KLQx\377\265e\f"
+	.text
+	.section	.gnu.lto_accInit.part.0.99.db0c74fb9cb707fb,"e",@progbits
+	.string	"(\265/\375`S\006\245#"
+	.string	"\326~\330B\200jM:\263\264`\357\327M,\312\346\341"
+	.string	")\323\327\377k|N\300\361f,\240\3661V\033\265\211\032\243\360\003\324g\212\363\214\312\237Y\371/\315{ ;\t%[M\3166\030A\266\021B\b\331;\245\277"
+	.string	"\302"
+	.string	"\310"
+	.ascii	"\326\360$\221U\326\356\232\241\277\005e\2336\016\333\274H\377"
+	.ascii	"\203\272\227\\\370[\252)Wj"
+	.string	"\277\313\265p\334K\316\261\335$P\320\354\376$\\t\205\362\342\354\006\306\213\341\t\214\027\355s\261\205\013PS\026.\340\360\371\037\226\2177\221\243\003L\330\356\217v\2612q}\370\273Kz\336\310\224\305Jr\024\303J\001\234>\231\024u#j\344\346\202$?\212\\\026\316\212,\2402E\204\306B\001\024\272t\320\222LZ\362\303w\322\367\261\353\013\352L\r\tg\264\007\225\024\025i\217\252\352\341\267\336\240\352\313.O\027U\325\353.\234\355\256\214\212G\351\200\003 \223v\327\327\035\271\217n\273\217\355\030\266\b\f&\022^\215\262\235\342pTx\275y\r\023\r\321\242{\245\321^q6JG6\213\257\251\031a\355.\2064W\263\344?\271h\033\023}\357\242\3174^\374\326\035|)\0246HG\203\264^\271\0028\335\335(W%\266\251M\223Z\026\223Q\227d\214z$\251\305\222:$\251\353\177?\035\251\217"
+	.string	"\311I"
+	.string	"\253]\037\301D\213DL\023\345cN\023\374\260~L\231\2012\215\244\335\216\034aW\031\260\254\260\345\375\220L\346el\230F\335\221C\227\204\266\363Ia\361\257<\001\373~\230s\371]\376\030(\317xb\314f\306\373-\325\t/4Ya\273\213t\321\037\312\255\rL\244Xe\325\2523Zl\343\\\001\036$\200\355n\006E_\004\"\204\b\021\365=!b\035\353\245"
+	.string	"\351h\020\221Xc>C\2712,\254\357z\0036e\fiU\262^\215Jc\255-\270\366\360\350!\373\203NH\311\177\342\021$H\214\027k\255Ud\f\371\304z\365\347\202\002U\205\321\362u\332\006\310WH\202=7\332%\016\314\371\211\005\t\336\316gQT\221\353\277\273[\353\225m>\006\206\212\336\324Az|\264P\036\003\303Eo~\350\216\217\307\3000\250\350\271\321\316\362@$ew!\320\261\r\024\301\370v\243ne\377\3136\224\r,\261v\nh\332\333\036<\244,\222\205p\221V\252\206\320\227\024]\344\003\364\\\237\203\342"
+	.string	"\326\256\356=95\005q\252\003v\361\324t\243\026\302\250\325\300\331j8\205`rj\202!#F\315\304\r\227c*\340\245\tN\267\246\0315\234\r\206mi\251F{\302\335\236\234lO4\247\246Z\f\332\022\356\2116\201\201o2l8\332\214\333\rG3O\267*\361\267\376\201O\2230g\314\377\034M\263:IWwF\246\254\332\347\024\332;\253\024\240<jGt\307\f\257`O\220\216\006e\365\312?\263\2142\237Wh\2163K\271\313\303`\272\243\274s\313\311\345\354rv\031/\312\352\267\376"
+	.string	"\317\231-Z\261ze\323\t\031\253\242\223\021\351d\355!\341d\245K\352\3032\302\311\032\253\267\342\345F\312jG\203\236\321\260\216\265\2546\207\016\364=\317\244\350\2768\002\353\331\226\361`\177\250q8\345\030RdDFDd\244I\322\001`\002\031Ce\364\022\240\265I\207\r\341\250\244\260\377\214\001\tp,\0179o\332\370'1\270\2776\037\255\034\271\322\272\345\216$99f'\265\212\235\211dH\b\242|\266\261\214\273th\231\301\324\364\250\016\301\246(\f\335XJk\300\214w\320b\344\371Nu\375&=\346\220\b\256a.\215\272\275a\333\317\316\323\217\332@(J\335\311\253\235F\200\266\257\370\365\320\253\254\210\255\353Y5\343]9/\363\321\376\317\276\330"
+	.ascii	"\372D?N\361\365\310\007%\365\005s\3130@\376l\037lP\363\202\305"
+	.ascii	"|\335\034'\364B28\371\206C\307\302\260\tW\377j\364\322\323\002"
+	.ascii	"\177)g\335C\031\326%h*\276Qx\247\001M\210F\235%\300!\261\305"
+	.ascii	"\247\205\237A\371\f\312\274 y\310Y\247j)\263\375}fiCv\323E\020"
+	.ascii	"T\244\214\276D\001\326\033>\333\024'0@\017\272\354\355\367^\315"
+	.ascii	"Il\247\316\004!\r"
+	.text
+	.section	.gnu.lto_accUpdate.part.0.101.db0c74fb9cb707fb,"e",@progbits
+	.string	"(\265/\375`x\n\2154"
+	.string	"zY\230\023EPdR\007\323\326b\254(\345}\321\313g\020\022\200\023\266\241A &)Z\321/\354\271\244\361\033q\032.o\026\023,\224\021"
+	.ascii	"P\244\005\200\0300\336\207&\221\276\031\255`q\246\002#\255\264"
+	.ascii	"\335v\357-SJ\001\037\001\024\001*\001\216\305\263\274>\327u."
+	.ascii	"\362\313\225\243#\303\3139/9\333N\256\263\306\025N\316\253\310"
+	.ascii	"pic\2641Pd\264S\3618\032.mvJ\220f[\316\231\306\332\016\207\325"
+	.ascii	"\r\004\366\277G\261\374\315FQ4\207}\365\177\267\273\371\224\327"
+	.ascii	"\337lx1\347\263\271-9G\231\234\355\007\256\263\035\365\241\326"
+	.ascii	"Y\327\205Zg\273]Jwc}u\277\335s<\372\314N\207c\031G\3159\037\235"
+	.ascii	"\305hmc_\243\336?\374:\021h(\f\002\177>\267\327\262+\376\342"
+	.ascii	"\333\216tb\257)\316\223\250[\332\362\206\204=\035\310\314\207"
+	.ascii	"f\315\027\"\r\t+\363\340\252\204\307%\217\247\371*"
+	.string	"[\207\274\2140\035\016\310\003W\242\203.>\376\327k*\022\366\303}?\334\355\342Hi\276\310V#\234#)\371\032\373\336J\3149\017\301\226\253\203\357\002\323\372\366\227D\314\331g\202\361\360uUj\216\3311\004\333Z\207\320\020\211\003\004S>v:W\3123\303\004\023\363\017\362b\257)\347\334\236L\363\016\362n\037\321\335\032\272}\\\002j8x]\205\356\016\236\306\203\317\201p4\"\\\316\316\3313\030{]\332\324\223r_n\254\330\331\253\223h\035\307\220\276Q\376\236n\037\343dH\264\257u\t\023&Zg\035Ci\303k\272\215\341\2343\022cg_\265\335'<\314U\360\231s\236\320\376\305\301\240h_s\266S<\2753\237Zg\035\316\027<\311B\275\223\374\352cg\343\242{\306g\335\356w\222\373\215\324\3736\272\337\006\334\357#\367\333\250\367]\300\375&\340~\017p\277\005\364\276\213\334o\242\341w"
+	.string	"\366{\310\243\356"
+	.string	"|\337B\356w\220\360\273(\374&\002\271\337\303\340\267\360\367\035\004~\003\177\337?\367\333\347\372\276{\255\373\315\366\276\327\3367v-\336\337~\373\204\243\025\240f\316^\325>9\b;=\342Z\334\247^\327\020$`\365\325\232\307\266p\034\352\2316jVF\227 H\220\321WE[\370NL\2256j\316\321no\347\322ez\205.\355\212K\333\351\032\250\005\253\215\312h\006\373\nl\313?^\365\250\226\210\213\270\1779\246\365U!\277|\2110\230\320\r\342\271D$\330\".-\277@\247"
+	.ascii	"\261\263\201j> \314\252\271K\356\272\370\213\374\317\305@\330"
+	.ascii	"\231\354\241\033\342\327z\337\214>\351\004\340\221\316\254#\304"
+	.ascii	"C\274\316-\3770}\020\355Mk\235)\304F%F\266\322\3770\020w\277"
+	.ascii	"l\357\221wf\020\033\2670\262\333\375H!\260c\366y\223\270\334"
+	.ascii	"\036\347\363.y\233\274O\236\264\316\002\2613\305|\370\207W2\\"
+	.ascii	"x\311\257N9\365}s6z\234|L\036\037\366.\276"
+	.string	"B\321\352\240S_Gs\316.>k\177\241m\017\253\220\336\325q;/\364\225\362\272\275n\255\263=\354p~\240\207\027\350X\017;\333w\307\266\030\337\375\222?\356b\362\307\236Gz\207}\3159\347\226\201?n\261\003\3113\303\325\324\372j\263\030\357}#zbp:N\303\347\0349+f\261/\377\304\341\320\300\016\216\007\005\317;\021\b\236oV\f\374\242%o\312b'v\303\341B\205v6\336&\203\206\r\033Zg\213\346\230u\222_\255\341\001VR3\236V+\027RU#X@\301\220\372\260b\nC\213\026TU\305\206j0E%\005\343\251*\252E\024\024\324\323\321\252\212\312j*\312\3528%\365\344\342\bUeul\220\324T/\242\252\2160\250\250\252\216\357\236\361Y7%\261\0261\tG\201BA\302\006p\222\021#9ib|$\277DI\222\367\256k\2355\200{T\302\034a#lkF\230"
+	.string	">*\200\215\324\322\n0=Z\021'\001\334\243\342c:"
+	.string	"\023\031\342\024\024\""
+	.ascii	"\023\341\001\370\361p!)\302\002\314\262\362\216v9+\263\370|3"
+	.ascii	"\313\017\323"
+	.string	"3g\345\227\205\310\252\266\257![g\213\360\361\315\224\301\223\275oCq\215\341\1778\005\237>\210\260\307\371\253=\351\323t\233&_\354{@i\275[[\255\263\001p\2115\320\261\344W\201\226|\206\330\331W\355\220\205_\375\355j\273\337\034\257\327;s\b\037Q\317(1RH\341\001\350xy\004\313\3309\203=\210\235w\\\250(\235\203\264\243\346\275z\274nB\330\253\370C\331\3424\335\306\"|\020v\351\347x\311\334\234\223\316\304\341\024\300\256\253\337\262\327\354\235\331E\034\344\001\200\316\250Q<\004\025C\246HF\024$IR\350p\002\021\242:\326\001\022\200\0265g\025c\344N\271\206\3757tHt\213(\217\021N\016\035%\225\254\035\252\026\262\3059\034\323OE3\210%\004\031\271\331\247\032s\360bZ\n\0246U\031\3222\370\235}\216\3424y\341\234Uf\271\375\362\325\307\t\257\253\322\332f\304i\240"
+	.ascii	"\340<\035\252\310\177B\241P\223Wp\202\210\231\034N\340\214^\016"
+	.ascii	"II\225\325!\334\001G4Q\231$AQe\222\261\221\260b\302\367\005\277"
+	.ascii	"\340?\242\027|\006a\356\013\227[\f\b\021xRv\244\345\312\210r"
+	.ascii	"\272\023V\304Qs\352:~\322@%\016\276\255e!\300\2256=P\030\346"
+	.ascii	"JtO\017\037\232\362\375c\343\323\257$\311\327\335\022f\200\242"
+	.ascii	"\003\026S\332X\252\033My\030\315\204\332\230\262\"\233\r@\016"
+	.ascii	"\350E*,\360D\333\371\243\\\200K\275\257\347\224MP.\346\305\""
+	.ascii	"\305D\330\312ek(9\343!V\210\277\022)\345\205\"o\314\325\340B"
+	.ascii	"\261\2422\232U\3460\201\351z\" &t\350\020\230\341\002\224\302"
+	.ascii	"\200\240\2640)\271\246]\027\305A?\232\3022\004\332\271\263\213"
+	.ascii	"\252\365*\320\022/3\302\177\006'\020\337\341\270\007\224\343"
+	.ascii	"\272s\214O\0328`\373\311<X\2011\004A\374\230\213\375\033a\031"
+	.ascii	"4\256;\363\212>D\344\315+i\2614\367\366\f\265{^\243\243\230\b"
+	.ascii	"\025r\346e\003f`GM\201@\2427\350$\366N\2624\233/z\317\216\374"
+	.ascii	"P\356t\255lr3\215\211\311\022\201\n"
+	.text
+	.section	.gnu.lto_setAccelerationFilter.part.0.102.db0c74fb9cb707fb,"e",@progbits
+	.string	"(\265/\375`\001\002\005\022"
+	.string	"\346cxG\340\322&\035P\003P\f\037\247>\210\272\216\t\347\252\004\261\345\232q\3625D\0066T\022\333\273\037\023\243\031\313\371\235\267\255C\357\301\211D\340\363\035\346x\256y\350\236!B\027\\\361 d\220I\255hH#{\313\235Ra"
+	.string	"c"
+	.string	"e"
+	.ascii	"s\267f\250hw\226\362\351\003\333'\311M\264\317\370\022\355\363"
+	.ascii	"\364y\026\266Y4n\331I\237\241\330\023\335\360\360\323cw\271O"
+	.ascii	"=a\275\234\335\032[\227\032g\3137\255\364<$&s]J\222"
+	.string	"\335\035\221\311H\003\273{\241\307\031\331+\252\210\n\020\217%\237\246\225\335\365\026\342\326n\273\202m\026;:\b\353\212zc\235_\265\2615S\364|\320-\265h\235\321QF_$\200\002\022\273\037\226\200l\3154J\361\240\237\347\321\276\037t\037_\b\210\345\023\231\331\312h\256\343\003\271\370O\353/|\264\271h6\030D8\224v\267\301\366y\"\357\353\260\374\036\237xX\237\301D\002\373\202\241|Z\243\375\235\267h}\006\343\227\252\351W\004\331\001+\021\023\227l\022\257\252Sm\b\021\342c>\201\251\313\376Q\206\021\244\230\355\r\257!!\005iw\023\030\235\306\004\n]\247}N}LDT\325\303\224N\364\"\030?\307\336\367i\310\b\373\302\207\300mw\021\3701.\003\203\237\363i\2270>\366\351\207z\241\017\260\221\344c\347\025\227\254\327\335*\220C';\260\25440\260\360\362\300\363\026\264t\340\nD\201"
+	.ascii	"\354\251\240Bp\325\245\276\226\317\363:N\225\nU\250O\305\241"
+	.ascii	"\300\316\205\363R*NE\200\303\227/\305\255\3020\305\235l\307\177"
+	.ascii	"\325\306\357\371\226c\206\216\227\306X\177\2517\2368\023\345"
+	.ascii	"'\234\250\251\324\031\333N\271\324h\302\207\207L\374a\275\334"
+	.ascii	"\335U\275\261] ( `\0021\227\334y\003#j\266&\"\372BY\006\2425"
+	.ascii	"\260#O\303\214\240\371cg8\255K\305%\rY\230(\254\215\375\262\304"
+	.ascii	"\230\005\241\221\325\"\275\246^`\\z\030\206Z\300\264\207&$\023"
+	.ascii	"\214\212\313\275\343\336J\241]fA\333e\263@'\232\215\033n0i\271"
+	.ascii	"\266\367\004\214\007"
+	.text
+	.section	.gnu.lto_.symbol_nodes.db0c74fb9cb707fb,"e",@progbits
+	.string	"(\265/\375`\324\003\315\021"
+	.string	"6\032fI\300\030Q:(XV\246\250\030\266\242\260\2554\240\261\307\231\321m#\b\342\202\226\330l\3332\272\0202b\327\355\003l\2214@\326V\220\230\316\b\022N\\=\021\002\373\325\276}2\256U\345\257+\263\324\353\243,!Dn\231\002N"
+	.string	"["
+	.string	"P"
+	.string	"Y&\274H%\311\362GB\037\013\275\275J\204O\201p)\017\036\305\301\213\300\233Ci5\370\023Zk\315\331\264\r\255\211\201\317\265^\f~\202\374oY\027\300\300\377a%\311\372\2634]C\311\035\320\337?\021\217\375j\255u\246\023\320\377\337\031N\366\304A\0235\360\267\301CcF\f\334\016O\016NF\355[\342(a\003I\364\203F\364w\033\324\345G\016\021}\203\3234!z\206o\034\021\321\001\242\025\310\030Y\t\362\241e<4\202\257C\037\250@\034:\206n\350o\321\360%\031\256\004C_\013}\356\002\315\302\254\202\214B?=B\221k,E}\244\336\362\013\305\267\002&\3261\367EC\204\370\270BN\231\004B\206\321-"
+	.string	".;\204\\\3130\372Fp\375#/\372Hv\372B.\372<\235~\223\026}\"\026}&+\372C9\375$*\372f\212>\225\375\377\263\276\240\350\007\337\036U"
+	.ascii	"\306a}K\212,&\221#\207\274\325\310k\326F\336\322\300\3107\333"
+	.ascii	"\310\003bF.\031\255\200! \247i\305\333\333\365\361rt\322V\274"
+	.ascii	":\025\227t0\221K\346\356\256\326\032\023\331$\023\371\304[\221"
+	.ascii	"O\275\335\231\310\251\236\215\371\270\022N\250a\020\304\231F"
+	.ascii	"C\212\nZ\351\300\002)\"\242\007\021\240 ,\231\221\210&\230\030"
+	.ascii	"\222\036w\304X\214\314[Q\033\017\204nY\227Qb\261\227\002\035"
+	.ascii	"\306\345\020\216\326\230\252c-)\345lZ\032\013T\206I\020\t\"A"
+	.ascii	"L|\317#\"\231\354\347\321\306\204\201\305i\305\376\025sLq\004"
+	.ascii	"\315\321\215\320 \222\004A\337\034\274\020~\243\243\326\f\225"
+	.ascii	"\314uk\220\361\232\207\027]\3211E\307V\027\374\237\222\205!\321"
+	.ascii	"l.\277\345)\321W\235Gw\325R\200YM_}4\250PB\337\001\271\302Q\003"
+	.text
+	.section	.gnu.lto_.refs.db0c74fb9cb707fb,"e",@progbits
+	.string	"(\265/\375`\272"
+	.string	"\305\b"
+	.string	"6\330=+PeJ\322\001\020r333333333\213\257\306\207\024\364\344\177\350\377\377\372\353\377\377'mLml\215\220 \262\311\226)."
+	.string	"4"
+	.string	"1"
+	.string	"\237p\035r\335\265\316Z_\255\253\365e\037,o\260k\360+\371\022\365\016\365o\375B}\204\357\326\267\354L\365\225\237\352\225\352\305\253\370\002\b\371\r\3173<\277\260^\341\371\204D\357$\036\201\365\003\366\034\367\005\3567\3555\355\007\332g\326_\020\335\002u\n\373\310zH\366\307\323\033\371\214\347\247\247+X\023d\317\344c\326O\360%\211C\262/&<\312G\374r\364\314\307\006\203q#\373{\037M8Bz(\337I\207\354*q\314ov\001]E\243~\200\217\031|\210QR/xW-\035\023+xqJ\005\372\223x{\317\262\257\336\304\311a\365\032\240\306\327\373\032\301s\302Q\372\241\356d7\310\347d\337\344\001\n"
+	.ascii	"_\033\365D\230\212\033\253d\256\337\242\220\201\205\326\231@"
+	.ascii	"\253*Z\324\213\271\306\301\240\001"
+	.text
+	.section	.gnu.lto_.decls.db0c74fb9cb707fb,"e",@progbits
+	.ascii	"(\265/\375`\254E\305,\001\232\004&pX LI9\351\352r&\202\252\231"
+	.ascii	"\272\335\252zfg\377\266\252\251\277{\352w\367\326G\204\254\264"
+	.ascii	"\265U\204\356\277\271\373\374\256\311\341\272\235n\025\031\375"
+	.ascii	"\025!;\275f:=\003\203C\277\335\226\247\377<\370}%\244r\305\273"
+	.ascii	"5~\266\324\362i\224\254\377_\2705!{\313\235\002\372\005\020\007"
+	.ascii	"\016\007Bo#*v<U\365\335\300\r\377d\303\235\254\033\320\016\325"
+	.ascii	"\007\005Q}\320\237J\260\327\017\317\213+%N}\177\006\301\357\340"
+	.ascii	"\205\356a\315\246\260\362\005\032\177su\220\252\354\256\336\372"
+	.ascii	"M\346\256>A\003\331aJf\252\"\327\027\2560\035e\023/\006z}\364"
+	.ascii	"\017\036\027>Vl\235\361\341\005\377Fi\036]\205\244\307M\353\035"
+	.ascii	"\327\f\377\376\300_V\037\264&\353\006\364\247\372\240gV\037\364"
+	.ascii	"\267\007\306\311\272\001\255N\325\007\355\320WI\236\336\234\231"
+	.ascii	"\253\264\276\277.\340_(\374\273\204k\256>h#\273e\364\2147\262"
+	.ascii	"c<\204\210\34705\362\346\254T\253\006;\265jp\272\371P:\202\336"
+	.ascii	"[6\370V\016\327\251\027U\215\244\205\222\214\276]\365\367SC5"
+	.ascii	"U\347\260\255i\212\321\267\243Z\252*\357\326S=\246dF\3431\345"
+	.ascii	"\310\243\357\355\033f!\347\234\353\335\320\233\273\241_\326\r"
+	.ascii	"hN\365A\377v\261\001f\202\302\304H\337\277[4\013\353\364\204"
+	.ascii	"\225\323rNf\270H\027\310\210\364m'\021,1\222\327\367\026\t\276"
+	.string	"\231>\332$\033V\323\202\352\025\315\324*Z\251\227\252\262\233*\363\225L-\363[\215\204\020\321MuY\267\330$\327\215\022-\027\311n\252G*\026\233d\263\200\334\023\263\233*\230:\306&\331\360\212#,\2309'_\313\272\251r\251_\254\331\024f\262\324\202\231s\322\303\217\007\017\036<\344\314\335Iy\311\271\235\201r\336\346\224\271\357m\027nS\331Te\315\253vluM]\356(\241f\r3\257\242U4;g\316Yx\\9g \017\0360\224\351A\003\275x?:/`}\335\350{;\003\2776i\033\243\2466\253\262\336\3254hw\365Iu\262\243\224\314S!\324\311\200\373\361`\357\320\2560\321\373\326\202\337j\370\257g^\321\240\345\234-\300y\261\3642\243o\b\241\3273hX\024\027\356\372\276\213\340\212U7\240\032\252\017\372\316\201k\230*\246*7\250uI\236\336b\263\344H\337\267\025~\335"
+	.string	"\265yyu\003\364MU\275T9;5,\372\276\225p\235\253]\252\222\254\226\375\236ae\264\234\223:V)\306\225\265\276\257\035P\236\274\274\274\274\332\001}m\342\232\245j\251J\f\252\334C\210\270=\236e#9'yt\332\020i\203\327\367\225\211_1@k^\305"
+	.string	"}\225\303q@\350\017.j\334\372\276:\301l\325J]\356\270m\324\230W\352[UV\270\272\006W\321\252\332\316\231\263\222\023\256\234\263\007 \01787pP\261@o\225\037\333\254\302\306\244\357\253\027~m\322\226V\313\242T';g\316XK\270r\316\225Ju\253\312*\245By'\337\301/\364*\245>\251N8\250\310\031\353\212G\213\024\245W3\347\354\301\303\217\207\323\216yG\006\337W\025\370A\374!\374\017\340g"
+	.string	"\177\004\376k\222W\265\277\232\325\263\352\244b\345\314\224s\266\340\246*\212\331\223\276UIM\253J\240\312\344\025Im\362S)\231\2239g\236Zf\307\022U\337\236\272\001=\b\370\002\245,\342;\270\0049W \264\346\345U \264\"\021zM\362\327\"\325\210\017:\205L\346\264\2343\217e\223\322\264\246oW\037\364\030\360\033\203\250\033P\264\372\240g\253\033\320\f\352\006\364V\037\264\247\372\240O\326\r(\256>\250\n\025\374w\312o\r`\017\360\327.\177\245\003a\212\216\335\261\005\260\004\260\003\370\033\315j\360\272\236\312\245\316\235\375wr\271\332\343\257P\334\336\201\003\374X`3"
+	.ascii	"A\211\377\232\325\277\266\3512{\301\337\032\370{\003\026h\206"
+	.ascii	"\222\277Z\275\356]~\373\363\337\002\3777\2504~k\301o70\240\303"
+	.ascii	"\177W\370{\310_1\260=\377\261\374-\302Kw@\364\177\315\231\337"
+	.ascii	"\021\227\001\177\207\300\362\374\365\311_1h\007l\360\235\377"
+	.ascii	"Bq\373\375/\336\337:v\347\257/\314\376\032\243\302x\317\177\313"
+	.ascii	"\202\374\325\316\352\324\267*\027\330\234\024\016 \367\327)\027"
+	.ascii	"\372\257\320_\205\324/2+\377\235t\005m\265\247R`s\376\377<\005"
+	.ascii	"\333\373\355\315\337G;\027\203\377u\007\370\033\005\372_1\366"
+	.ascii	"\374\237B\027\273\374\r\202\275\177\203\260\366\257\367\267\375"
+	.ascii	"W\214\326q\266.\351-\366ik\335%\357\3574\177\275\3536l\376\212"
+	.ascii	"\367\237\303_\313\204\351\020\202\376\233\364w\2105\177}Qa\374"
+	.ascii	"\365\310\177/lZH\347\277\300\277\366\377\272\336\317\377\362"
+	.ascii	"\374\227\362\177\312\377(p\377\253\374\217k\274\347\374W\256"
+	.ascii	"\366\216\363_,\377\357\376\2479\233\377xu\312\361\177\337\376"
+	.ascii	"\326\372[\307\3379\376\316\372\033\353o\034\177\357\330\352\250"
+	.ascii	"\277m\374}\325w\377y\376\023\205\277\233\177\323\375\315\345"
+	.ascii	"o,\177W\371{\312\337n\177\257\375\215\344\357\344\337`\177{\375"
+	.ascii	"\r\344o\037\177o\375\315\343\357\340\337$\370\333\3677\212\277"
+	.ascii	"\213\177\207\360\267\320\337\"\370{\370\367\321\337*\374=\364"
+	.ascii	"\267\211\277A\360\267\007\376\346\300\337\016\370\233\001\177"
+	.ascii	"\213\370\273\203\277\021\360\367\006\177\033\340o\002\374\235"
+	.ascii	"\301\337\030\374}\301\337?\177W\360\267\206\2773\374\275\363"
+	.ascii	"\367\315_c\374\265\203\277\216\375\025\352\257d\376Z\367W0\177"
+	.ascii	"\345\362\337\313_\333\374\325\352\257\026\374w\362\327\377\217"
+	.ascii	"\373\353\335_{\376\212\377\312\346\257m"
+	.string	"\177\315\360\277\356\257k\177U\363W&\177\265\373+\006\377\233\374\325\314_\313\374\225\371\3271\177\025\363\3270\177\375\362W/\177\245\373\353\334_\267\374U\356\257Z\376\232\345\257\313\277\302\375\365\355\257V\376Z\345\257T\376:\345\257n\177\225\362\327(\177\245\340?\n\177\305\360\327\336\377\340\377\267\377\033\362\362\362\362~<\364\347\340\375B\016\bJ52\310\3472g\246\254\243\bYTLY2\234\320\262\25028\241e\345#\323\217c\206\251\234utB\3139\003\023\323\261\004\026\225\023\232R\316\340\204\226\251\262\n-T5'\263\216\231\t+g\310LY)\243aQe\340\304\224E\345\204\246D\225\301\t-\213*\243e\345\236\314\2444\305\202)Oe\310hYd2\032\026U\217\023\032\026\225\023ZVXm\262\230\253z\241d\371BT5sb\312QPVJS=K\247$V\246\313\271\2465\345\251\274\314y"
+	.ascii	"9[aM\321)\311\250lK\313\250\245&JX5\231s\006\202Z\322\302\312"
+	.ascii	"L\313c\315K'!X9\013Y*\312P9\347\274\200cr\231y\324\345\021\207"
+	.ascii	"U~j\312\371\202\234\314\031*\347c\315\313\234\3631\347|3e\225"
+	.ascii	"\314\231F\217\023\027\024T\316\310\037\250lulk\312\271\323\276"
+	.ascii	"\260Q9\241ia\t\265%A\343\312+\222\307\352\364\204\225\2712]\326"
+	.ascii	"\024F;\232\345\247\234s5\203\271\250^\224\351\233<b\206\210\214"
+	.ascii	"\276k,\033\f\331\205\030Z\337\347\334X\323|U\332\246U#\0022\231"
+	.ascii	"\217\034\272\332\312\232\315<\205\344\240]\250\340\361\243\357"
+	.ascii	"]\217L\211\225&}\217c\207\217S\306\332\265\f\027A\252\372\036"
+	.ascii	"\207\213Es\306\266\320l`\264\234\231)"
+	.string	"\203!\f\033\232\261\276\3114$im+\310t\027\317\2278\2716L;\006lFWW\337\312\245\226\246\0165#\363%\213\261a\204\204i*\373&o\230\230\243\031\030\027\250U\017\271\026\2764\331\221\303!\327\306\313\351\276\262\344\330\3217i\00119\272\272\3309\024H$\331\\\266`\347\005\2220\032\\\232\\\270\321\304\305\226Jw\036\261\"\246$\327A\347nn)L\213\255\001$\212\024\267,\313\272\f\273\301\205\345v\271\005\004:uQ\222>\372\3328\241[,\r\330\302!\326\327\332+\030\360$c@\341\200C\026\221\242\225\366V\363\260\033\033*O\254\250\021\257\2504\253"
+	.string	"\201\265\335\320A\245\2177h\266,\2612\305J\351m\201S\023EJ\3052\266\306\306\213\333\333zl\252\310x\365\205a\333\272\205F\206\240\223\001\327l\032mm\3256\3522\255\204\221\270\206\372\233\206m\353\032]U\227iW\f\0133\212}b\241X\266\252\264m\326\311\255\232]\373\217mk\027l\223c\003\256\200`fM\025\f\027C\256\033\320\212U}\320\343`\301LB\300dg\327\3678RpgY\033\226\354E\006`\307\"lMk\326al\324\007MS\022\320\262\301D\332\253#Vt\235\254Kd>\222\351\360E\225/\342\357!f\335\245\2216\311u\223D\253G\347h\035-\304\232M\365\242\216"
+	.ascii	"\351\034\326\254\277\352\227\272L\313JU \276\262\024ak\266\027"
+	.ascii	"k\326_\252\232M\262E@k\0073\347lf\245\254\214\016^mE\330\232"
+	.ascii	"J\213\304\242\331\244Mb\225\330#\266\314.\261g6\255*\255\231"
+	.ascii	"\235z\337h,k\326Dz\216\303\222S\316U\013\3702+\302\326l/\326"
+	.ascii	"\254\301\3241u\271#+\035?\360\"S\204\315\203\207\233!I\360\216"
+	.ascii	"\374\334\261\0376|\240\365=\316\025\376o\305,\021[\244*\255\021"
+	.ascii	"\353%e\203D!9\201\020\033\366A\323T\257\005\227\037Lk\304\336"
+	.ascii	"\260<\264\022\340\306\366\205\313\303M\336\025&$\276\026\354"
+	.ascii	"\213\216G^\337\343H\r\371\272Kf\354\320:\232\333\257S\213\220"
+	.ascii	"\037\312\276\307Y\201\217\341\f\346\262]@P\037:\240\222X\270"
+	.ascii	"\200\264P\032\"\366\343\026\b\006 m\306\322\372Z\037\026\007"
+	.ascii	"\224\2139\263\276\366\004u\313\026\252+5}m\017\273u\266\020e"
+	.ascii	"\005\230\255\272\345\312\323\322\013v\207\016\0346\346V\222\276"
+	.ascii	"\307\260\344\005\035hW\217\037Q9nu8\211\002\227\325\327\272`"
+	.ascii	"q\374\357a\252\254%R8\264r\264\210\301\242\264P\311\323k\251"
+	.ascii	"\n\216\254\256\303\371\322\"\327\365\265X\030\300\214y{\322\367"
+	.ascii	"h\352\226\377\275S\313.\314Z\337c0\303\307\300U\303Z\321\300"
+	.ascii	">\270XE\351{\f5j\320\220K\313t3ni\274\016\375r\224\242\006\003"
+	.ascii	"\f\033\003\306\232\030m@\372\276\227\207_\225\266\005\013\303"
+	.ascii	"\211\020\026M^\334\302@\346d\0169j\340\342`\364=\032[\365\277"
+	.ascii	"\2673G\266\006\245\357o\253\250v\240\264\344,Ke\247zvtl\212\364"
+	.ascii	"}\317\016\2777\006[(\036(G\"3\372\276'\207\337\201u\321b\352"
+	.ascii	"\226\272D6@L\314\266\260OUi]t\335[\253q\374\307E\217\261Nu\211"
+	.ascii	"\354\311LukL\234**\236\030A\257uj5\266I\207\222\313\256\260,"
+	.ascii	"\252\322:\335\251\231\335\254\3134\022\206\2501o\225\020-.\350"
+	.ascii	"\375o\231\254\212\252\264Mv\251\215U\342\260\344D\302\2311"
+	.string	"\333\324x\315\206\303\222\023\tQ\22601\224\036Qx\240\367\275)\370\267J\366\250\303b\315\253K\236\315\030Z@.\243\364}\217\t\316{\215\352R\361\326\367\2753\374\252\274\230^\363\272-\270\030c}\337\033\303\357\r\301\357\005\301\357\240\331e\032M]\246\225\200k\222\246\357\252\262\233m\227V\326l2u\313\3161\231\245pX\264\365`6w\200x\025\031C\357{O\370\2021)\271\322g\332L\326\321\251\273r\023\322\367=%|\214\207\217\315\340\3431\370x\016\037[\301\307O\360\261\032>V\202\217\2238\203\352\203\036{\341c\036\270\271\360\340xA\211K\337\343\031X\254\315l\222k\204\245\250,\275\245\265Te\313]\256\317z\312\007MS\027X\202b\312\365\362p\034\226\234\262\222\013 \272\232yVM\0177\311\216*7\360\375M\034~=[\003\252\313\035\"\004a\022\205\b\263\2474Z\253qXr\242"
+	.string	"\225&mw\333\351\345\234\225\306\005E\254\241\236t\250\313\264\022lF\2309'\247\264\333\335v\230z2\323\2170f\035\233\322l@(\217\035xC\232W\032KSi\270\266\322o\035\327U\252\262\247\264\224\377x\3709\223 i\342Qp\1773\003\377\246\n\377\246\005\376\215\022>z\207\217\226\301G\277\340\243K'?}\034\243E\252\357\3215\374\277\225\315\244*\273I'y\035\353#\377I\346\334\004I\247\355\0343\344\214C\f\227\221_\250I/\351\264\272D&s\025\005b\350\312Xi\346\234\374\361\340\301\252\2019\203\004\275G\243\360\337iJp\332\214]\265\351\373\277*[I'I\346\237\0352 O8\372\376\264\303?\307\340\237t\270\346\272\001\375\231\005\377m\344m\3667X\207u\022\004\347\022\026o+\3726Y\227\275\223=\226;\271"
+	.string	"\254\234\225:\311\263&g%\236Z5\250U\203+\246\005D\211\336\237p\270\213\004vl\372\376\307\352\355\355\304\362\203u<\003\342k)\253\252\252PAD\352\304r\306\355\350x\202$,\356\212\016\255\037>t\254\220\271c\202\353\255^b\343\004g\276T\251ba\374`Y.Z\360\332\204\235m_m>\272\246L\271b\365,"
+	.ascii	"O\324P\241\2223\262\203\016\226\2525\252\276\267\340\251\355"
+	.ascii	"o;\335\352Y\226\252J\264\244\261\321D\2130i\341\025\345\247\033"
+	.ascii	"\2247-#}\317''\224-\254\033CN(M\005$\n\b\232\n\254(\371\351D"
+	.ascii	"\311\271V\321\324dFb\035\313\030\340\206\0253B\232\331\311\252"
+	.ascii	"\003\221\216\033p\247\332\3175\270<$lY'\223\237M\376\336M\027"
+	.ascii	".og}_A\026>\227\374T\376\275\263\306\0130B\372\276\202+\374\237"
+	.ascii	"i\177/g\007\\\\\231\276\257@\006~\005Sgg'\222\037\234\307\344"
+	.ascii	"x0s\2720\305tA\373\211d-\307I\t\315X\337\363\210\326\022/1\276"
+	.ascii	"\366\245FD\331\206\310\211\234\311z\226\245:\b\242\205\304J\224"
+	.ascii	"V5\312~&\317\236\254\334\365=\213\234d\377{<SX\224\2619\311\316"
+	.ascii	"\2616\034;\224\250\344\254\251Q\246\313i\344*\255\220,\261e\337"
+	.ascii	"S\354kT\316\2340\277|}\235`\365,K9\240\252N\b\216]\0133NC~\202"
+	.ascii	"]\271\2629\272\262\256\256\323\353\007\313\216y\002\306FX\316"
+	.ascii	"\310\016M\303L\\\2173\310O\2576Md\230\244\371\337\003\361e\353"
+	.ascii	"G\337o\300\302@N \366\253\236e\251\237\261\263/\\\315\234\221"
+	.ascii	"\035n\221.Pk}\257\341\f\376O\037\247\217\266!BZV\242\352\340"
+	.ascii	"\2265'\245\231\247\250p\220\301\307\022\254\3575\034\301\377"
+	.ascii	"\271un5\213\313\324\223s\216+\266<\205\344\340\264!\344\253\256"
+	.ascii	"\3575\364\310\373\t\325`\035V\2257\357\344!\264\224\225\310:"
+	.ascii	"|uYq\240\243\003\213\211\327w\307\215\213\031L\322\372^\303\025"
+	.ascii	"~5\022uJ\321M\331-#X\252N\030u\271C\204!p\314\234\223g\214\323"
+	.ascii	"\206Z\030\346\231\325d\354V\034\027"
+	.string	"\216\363\205S\307\251u\272p\346\250\3123\353l\241\311/tf\235T\"\030\271\302\31499\207\006\310r\347F]\f\207%'\022\310\276\2346N\031\347\025\216\223 e\314\346y\343\304\252\312\323F\032\220\016\236\227&\031z\377\363\352\264bkQcE\337\263\006\332\233\013\034}\357\023\006\377\347\214\252<i\004a\363\243\357\211\274\030\026\307\026.\356\326B[\221+}\357\343\005\337G\016\337G\312\371\002sa^\261\341\3734\301\367Q\202\357s\206\377S\312n\241Y9\023\327\367>d\370dq\2728\237\376\036\217\030\233\016&}\3573\004\377l\361\277g\201\036X\230\364\275\365n\350\271\342\247\323\337\3537 \\P}\357\323\205\177\2528\233\376\336\016\335\217%f}\357\303\003\377db\222wfF\337s\t7\371\324\330"
+	.string	"\303\225\332\215\032}\3773\377\\\372\317\343\2514\202<6i\372\236\256n@u\252\017\332OB?3N\234\024fY\337S\320\246\331\274l\200\356\272\352\f,\030sk~\331\344\200\221S\263\303\353\025\321\272\202\247\346\211\222\354K\\\024\262LvW\327n\252\226SV\364=\005^0\0324\327\216\204\r`w\312\222+G_;\n\224\2301s\275\324/\263\262fX\333}\005\321\002\204\f\231*\\b\\q2\372\236\202\027c\306\330\257\236\274$7\3065\206\n\f*}\237\341\016\213\021#\242\255\254\031\226\221\310\0167\tY\231\226\226\271\373e\356\202\271`\272t\271^\200\360\216=\264\262\271\025t\277^^g\257\364\360B\033\363\277w\313\274\220:\372>C\023\374\f@\266l\261s\367d\3128|p\345\214\344"
+	.ascii	"\003Y\331\024'}\237\201\207\026-u\013\006\025Zz\220\345\334\231"
+	.ascii	"\335y\351\373\f*\342\3562\356Fa\301r\243\200\310\230\351\234"
+	.ascii	"\225\211\"\322\367=x\370=_\360\177\341^\225\027\256Y\364Te\\"
+	.ascii	"'\267\305\314S"
+	.string	"H\016n\260ly\253\322\367=k\370\277eUy\313\256\225^\003\276\250\256\225\377&\257\331\255\202\243\003N\r\262/\025\354\244\207\026X\337\367$\261\022'h5\330\216\220\251\t%\361\342$N\215\271d\210\223\263\257\325eZ\345\222\242\306D\362\265\235^\316T\212\260](\267\355\272])\227\355F\271S\256\332}R\225w\355*\177\231\334&\277ew\355\246}m\207)\231Op\343\345\211\026\262\231s\306A\2629\321i\270\357q\0017V\335\200\026\240\372\240\357\251\302\357\221\302\357y\302\357a\201\337\323\204\337\263\204\337\223\361y\330\340\363\250\301\350\262n@\037\246\372\240\347a\216\215}\035y\266\200\335\"`W,,\354\212m\250\321V\241\210\215YB\344WL\007\r\222%Y\337\243i\033\377{h\234\324\0325}\317\003\207\317\343\004\377\367\253*\357\227]\336\343Y\2462\301H\013+\315\234\221\034\234i\320\344"
+	.string	"\323\367<c[7\310\326\365Bs\256I,\251\251\214\234\352p\275z]^ZO}Op\202\333\205\217\032\312\250\332\b\023\223\261\313\365\333uZy\371r\322\367\372\270@nf\240Q\003\273@\356\217J\307\274\333\301$\314\033\227\"m\376\367\354\231\033I\246\364=\217\027>O\026\017\036]WF\233\022*\357\205\027\032y\217gY\252\003\027\312\232a9S\341"
+	.ascii	"\007lFUV\337\357T\301\377\315\361\207\020Q\2257G#E@b\035\311"
+	.ascii	"\200\3602\353Q\321Q\243\331\367;F\262f\\\255\256\252\271ij\002"
+	.ascii	"P5\230;b\370;Cn\334\031\027\253\2178\263\341'PWL\035\370;0\360"
+	.ascii	"+\221z\255\356\214{U\325n\336\001\305,s\360\235&|\035;\374_\032"
+	.ascii	"4\352\030\021v`))\025\300\213\252\254\331\314\231\n\007:_\311"
+	.ascii	"\250$}\257\223\005#\221Pt\304\360\177c(o\f+\305:e%\255\006xe"
+	.ascii	"\331\201\377\373\342J]\030]%\202P\021\027\2468\270\216\016|\235"
+	.ascii	",\374+U/\225\362R\3251\035\262\222R\001\272\310$9\270N\013\370"
+	.ascii	"\265\216AY\234\305\215\2529\347\214\314G2\"\212\034\247:\374"
+	.ascii	"\027\3527\212g\205\335\224\332SUB\022\305|rA\001%U\314t\316y"
+	.ascii	"\002\243EM\213j\007d\277^\3005\365}N\032\374\233\357\361W\351"
+	.ascii	"Jw\005\3169\037\223Y\352\247H\226\262f3#\221\035\320\257%sX\267"
+	.ascii	"\351wE\215\301\003\315U\361\277\227\223\346\355\352\305Uq\231"
+	.ascii	"\\\200\205\221\321NY\007\315S\220\247\273T\231\270.\306\215\276"
+	.ascii	"\317\251\202\377\327\367\217f\245\251\234s\325\231\314SK9\350"
+	.ascii	"__\317Z;\374:\325\326\001\374\2779\203\220B\316KM\2269\347z\006"
+	.ascii	"{\255\005"
+	.string	"\305\243 1\205\024FHH\277\n|\214Ebj\004La\364\023\006G\020^\240\0304\300\317\213\202\210\204A\242\261X\201\221Q\222P8\024\336\030}\351\b\202E\324\230\026\217\322#\264\230\364\200!1\005\221\216\206\027\005\r\211)\210.\250\300\220\230\202\250\202\027\005\245*\374Nx\030\221\252\360;\241\363\242\240\017\034Rb\222\361\227\236\270yQ\220Q\230\036\r\021\177C\023\037r^\024T42\372\001\213\214\277\243\017+\f\211E\306\241\360\346\304/5\272\306\242p\b<O\030\205A\242\021\232\302\b\tiD\206\021L\240\2001(,\301\307\227\036\005\215\302$\342\007\340\t\001\030S\024\212\030^\024\364a\030D_\024\004<aA\212\023A\343\320\002C\302\021)\212_\321\347EA\024H\241\004\024>\030S\"\342\317\230\201\n\300\241\021\211\2248$\301\223\002iH\342\307\370\242 \244\244!\221\310\367#\376\220>"
+	.string	"\013"
+	.string	"\024&\341\bO\364Y\364\021!\345\030}B\"\244SH\204d\323\021\004\2137\005\322\020x\211F$;\224\336\f\245\305\244[\274y\n\"\321G\204\024\244\223\202\310ACjL\215\220\216\206$4(\246F\300\024$R\024\200\300\237\005#"
+	.string	"\340\004 \360\007tB\005\033\322\"\207\363EADI&\322\241\017CF\301$\023\351\320\260\002DI&\322\241^j,\246@\301w\201\361EA'>\b\207GGC "
+	.string	"B\244\350\242o\350\227$\202\240\211\035\020&Z\310D\2070\321B\277\016\361k!\026:\004\013-\224\242\211\251\321(8\002\020\370\353\215\200\004c\022\211\023H\024"
+	.string	"\002\17787\277\235\342P:\304\323\003\021d$\376\220\202\214\300\324\330s4$\232"
+	.string	"\001\b\f\215)\212\037\n\003H\205\303\022Faz\224\022\223\212\277\264\002\006HQ\004\215\300\021\302!\t p\004\007\023\025D\220\t\313#\024t\024$\246\220\032\021\t\177\031tB\004\r\245(~E\037\217\206\021\302\022\016\220\341W;\b\372\331\021DB`\216\211\240\321\217\004\0208\342\2108<AL\2210\360\021!ap`\220\230\nS\"\374\005x\240"
+	.string	"\017>`\341\346\037\204"
+	.string	"\"\004\020\350?\bAH(\004\017\204\360=\020\262\032\0164\002\201?\233\372\322\241a\005\210)R\232\232\310)\372\200\300\337i|Q\220\001\214:\302\021\214i1%\336\024}\024\f\375\322\023\222\220\2164\020\215&\bG \246\306b\220(=!5\006\211\031HB:\332 \034!5\006\211+\334$%!\035\365\030\203\302\022\204#\030\203\302 J4\232"
+	.string	"\024&\2150\364KO"
+	.ascii	"\002Gh(\372P\244%\200\300\037\026\2160\364K\211\250\261\350\013"
+	.ascii	"\"\241p\"-\221\"\245H\301W\202\t(\340\244"
+	.ascii	"@\341\317X\024\006\261\321w\201\022\2560h\202\260\bD\203HE\373"
+	.ascii	"\242\240b\222\t\240\242\217D\210\022pH\204(\2417"
+	.string	"\204\026\213)qh\350w\003\f\021\264I>\024\351P1\311\004.\372R`\020EZ\242\230d\002'EJa,&\231\270)&\231\260\021\020\362\001\201?t\205\337\t$J\214@\323\241!\t\024)1'\305\320/=\341g\374\r\365\214<\276\233\027\005\031\201IDc1D\321\307BjL:\312\240\002ph\344\363\241Fa\322\020\350\363\335\020S\341\nC\237\357\246HL\213IB\237\017\017\t\203*\370|hQ\030D*\372|7\302a\260\0304J}\276\236\321g,\006\215z^\024TL\221R\030\0250\224\022\177EE\005|(\032\203&>$\t\211\024\300B\2220h\244\200\005x\340\363\340\003\026>\244CIF@a\360\003\261\230\364\001\004#\013\251\320\350'$\246Fa\3207\364K\211EF$\237\317\002\024)\021\311\347C\215\305\240\221\317\207\376\214\277!\237\017%\376\212\2007\035A\260\350\363\241*"
+	.string	"\207FWH\0244\032\001\004\376\260\361EAIHG\276!1\005Q\212\"H\034B@\352;\001\204\b\020\036$!\035\371\b\207Ac\222\321\260\230\0221\024}\032R\037\nIHG8\250\321(\251\230\236 \034\006\215\300\324\230\226HB:\242"
+	.string	"E:d\215\276\020\035\030\375P\020S\243\260\004\"a\320\b\351\350\207\002\020\370\363)2\016\207G("
+	.string	"\201\277\236\321p\370"
+	.string	"\337\231\002\205\0270\026\177)\005\214#\206R\343o\b\t\003F)\0208\242\030\0042\372Bt`\024\006o\214'\322!\237\321\202\027\r\240\230\344+\002\032\203&\f\tG\030\031\r\211>\024\024}D\301\023\302!\tbjL\217\206Ix\004E\276\023HF> \360\207!\365\355\b\211\202F?\037\020\370\353\031}\037\030\205\301\244\233\224\370[a\210\370+\362\001\201\277\034\343\211t\b\350EA\030|\210\224\022?\030\207C\342\007\234\025~)l\021"
+	.string	"FFC\342-\002\032\203Hg1M2\372\241@\223|\305\243 1\205\"0x\364\023\246(a,\"\n\032\235\330`\364y d\024\006o\016\002\b$2\300\200\005\"\200\201A\302a\320\370#\246F)\020\370\373P$\016\213\302\264\370A\030\374\035}"
+	.ascii	"\022\213\037\2024X\341G\264Cb\312\001 \360wsT\207\305\323\342"
+	.ascii	"\242\222L\346\234yv\324\310I\245\311q\272\261\265\300c.)DI\330"
+	.ascii	"\034\252u\256%i\252U\241Y'\222\027\202\304\331\350ke\205bU\021"
+	.ascii	"X\332\216\3368\212\225\200\247\035Q\250\r\036\246\260\027\252"
+	.ascii	"P\033\350\325533\302\003\250k\320\260R\353{ .\370Gk\234\311$"
+	.ascii	"Z\232\210\320\270Vn\270\316pT\315\250r\357\330L\031\202\"Q\031"
+	.ascii	"7i\342bl\3219r\246\315\261oU\025\332B\235*\363a\t)\003\256\231"
+	.ascii	"\2210:\240-\2400\242(\265}Aa\240/.\f)P\272\210\330ya\353{\240"
+	.ascii	"6\374\243T'\030Z\230;6S\027\f*u\243x\300\352\220\200\241Q\247"
+	.ascii	"W\02200i}Q\027\350\323Q\250\243P\215B\331\274<tl\213\022\364"
+	.ascii	"\242,P\026\327\216\204#\221\256\262f\330\026FW\240+\256]O\b,"
+	.ascii	"\013\220\n\374\243Mu\214\f\025xLP\025W\214\016+\307\023\323\355"
+	.ascii	"\262\314:\"\\\372&s\244\244\266\260\224\260\2041Y\210\241\307"
+	.ascii	"\223\213W\027++h\246\273\313\246\212\2533O\315\215\032%[Pg\233"
+	.ascii	"\263\271,\313\343\301\306\353\001e\236r\364=\361N\274\313\246"
+	.ascii	"\346\251\005\020q\341G\315]q\227w\205\327\367\313\3170_\316\246"
+	.ascii	"\235\313\311\307\263,u\263\366\246\303J3;!;\340\230\2710\313"
+	.ascii	"b\346g\363g\232\020\".\006\207\r\231S\352{\332}\007y\345\t\263"
+	.ascii	"\357\3173'\232\277\207\301+\007\032X\337\3778\301W\300Y\f*\252"
+	.ascii	"\276g\231\026\"\346\211L\337\223\314\335\220]\232/\234\3148-"
+	.ascii	"\271\245\276\247\230\263\256*\377v\216y\222g\347\311\212%o}\377"
+	.ascii	"\223\004\277\376\r5A\375\033z\202\351=\261\221#\253\357o\224"
+	.ascii	"s5\270\312\272t9\351\230,Y\331\032awd\350,\216\261\034dk}\377"
+	.ascii	"\323\225\345YN. j^\361\344\210\r\346\232\245-T"
+	.string	"\\\316-L?\354\266\310\255\241\013\243\205\307\322\234Q;\265X\257\034Q\002\204\227\250#\202szL\256\305 \216tH!\244\020\t\r\247\305\203\025@0HT\034\226\312\323d\017\023@\204\013\355tY\234'!Tf\206F\222\244PX\306\337\246T\231\253d&\354p\244_(\253\315\214&O\272\354\231m\312\274z\272\252\322A\256 O\362\023;\207N`sf\241\200\315:\2060\f\004\343\215\346\330\302'\347\2523b:\375F\037\216\326\2758g\266\362\\\232\0024\317\206s7j\2240\337\227}\226X\202c\023\251\217\322\027\177o\337\270\f}\311\227\025g\310\241\200\032\323\306\326\234e\324!\3700J\024\242\027\344y\243\370(\232\2740\314dL\216\201\215\240\373\375,\301\234=\326\304\373\363\032\204l\325tE\347\274\301\2538\006M\242\206S(\030;\225\027\221\231~\204\350\013\244\241\223Z\036\321w\236\036\003"
+	.ascii	"\003\234+\254\345By\310\025&\373+\351N\024\257\236\2344\361+"
+	.ascii	"\200\201R\027\341@]P\303\261j"
+	.string	"]\002\226G\333\275\361p\235q\274\373\334\217\334Lh\245\261\336\225\316\305`\210G\300\214\234/\025;\224\026\013\346:\343_9\023\312j\"B\035j\361\330\220\254\224\277\033h\001v\326\r\362d\017\216\025\202F4\213~\022@\307r\371\253B\260\336d\254\3409\340\306\tSi\276uX\007!_U8\006\304\320\3449\226\216\373\351\332\324\\\033\241 \303\235\002\032\240W\256W\201\240\273\006\261\3037\024\375\f\261\303+\272\244\251\317&\t\276\206\350!\204\025\035\b\254\241Q\027$)\327z\240\254-e\362\236\273\233\270n\371\376\244S\313\203\371\354\\\022\234_:\210G\217B\317\201\257\244/\200\002-\211O#\235\233\356} @H\330\207#\004>\261%\003?y.~C\025\377\352\353\224\343\251\330\273\275\271s\006\354\317\266 u\326RO\260\206M/\245>\324\207\251w\370\266t\204@2\352!\350W \254*\245"
+	.string	"\224\236\257\331\232\246[!\007\314JEX=b\030K\252\310\324` l\355*\220\003oQg\341\247\241U\\\305;o\3370\24190c\023\255;\313\367$2\276 \350\302h\332\246\304\347\331\231\272\356\310uk>\263\277\262\007\377V\207z\207RJ\243g\323\340\216\210\215|gN\272\230#\377\320\017\nrBK&\3035\341\020"
+	.ascii	"V|\314,\3079aU\034\231\213\323[\356\231\n\361\212\242\032M\213"
+	.ascii	"\013\037? \0057\230/h\2731\330\334\257\210\211\355j\0202C7d\360"
+	.ascii	"\f\\\026)5t\213\032$\304\347\342n\201\257>\007\303O\203\211\b"
+	.ascii	"\b>\031\366!\305-\342\205'\377*\001\305n\260\031]\317k\252\002"
+	.ascii	"r\037\333\215=\235N\364\215t(\306m\371\315&ym\300v\002/\314\367"
+	.ascii	"\035CJ \331\206\312\341R\352&J\025\235S\235@\t\177(\221\355\211"
+	.ascii	"g7\t=\215\245\251\223\235\246\274L2\235m]'\337\022T\030a\307"
+	.ascii	"7G\266y\031\0179\227p\007\037\026\002I\3572z\225\2159\257 "
+	.string	"\016\013\363[\316\212\237\204\035&\0163\037\250J1kg\025~W\274\003\251\307\2646\314\345\004t\"b.l\021\314e&9U\214:\270\203\005\241\372~\311\017\334\r\311\\Y,\r\355$\310\220\352\305\242\371\317\360\b\201D\013\241B\353fj\376}\301\351\300\216cjDk\206D\027\323*t\337\373\346\227\223\305\277\234]1\tf\302\277\354X/HJH\030\370\227\330\026%\375\034\250XN\236c)\361*\235Q\347\222[\f\207F\0032\314\346\354\341\262W\272\350b\021|\305\320\342\355y\275`\354\224\322\226\377\314\317B\207\200\034\270k\027\204\333>\200\260\006L\334\321\255\nH\202\"\033P\"\226\300v\250R\231\240\367\013\363\257\t\033\276=\345\366\301\304L\342\006\224\203\340\004\251\365\364eb(\202%\225<WO\224\327\320YZ\254"
+	.string	"YL\223]\343r\b\365E\002fv!\223\222\213\257\233\214\252mEH\367\024\245\200\t\003\231\372\013\347j\2638\3708\003\2110\322\3628\361\211\211\020\251\3311\325\ra\271\202\341>\206\030\265\250lQ\365\2354\234\3110\372\367\360\264n\223`\376\356zB\240oW\251V\"M\363\357\375\273`1x\330\246\246\2428\355\364\333|\363\314u\267\274\247e\212\270\177\033\323\277X\341W\376^T\025,@3o\245\024\266\232\004\177\201b\2325\232\331Q\360\365@6\333FH\277N\346\017hFP\220\241n\262\002\273e\302\n\273(\200\206V\334h\233\3348v\372<\200T\207\3069<:#)!C\211F\361\324k\277\016\372\003\030\022\203'x\201\200\204\004U\300\342\305]\037C\007\323h\225\037\023yXa8\320~~\243g\026\270=\370"
+	.ascii	"~\177y\025*\214\245\351\210\336\273\326\004a}K\307\252\002{\217"
+	.ascii	"x\313\317g\225\276\nX\034\357-\370 \204S\274\035\035\351\207"
+	.ascii	"%\316\225H\225\227z\026k\227\207C\200\004\213\0176\036("
+	.string	"U\244 k\344\367\240\251\330yV\260\374\2539Q@uo$\355\016\316\025\274o\211`\177<\373\212mI\273i\346\232\370\013\236\325\354?mD\211\326'TZ\265y\354\001c\313\337\371\315\372p\2665\300\366\266\253W\320\016\355e\322116\220\005\363\204\313j\326h\t\2334\035`\341\016)\201sI\363\346o\372\325\371_\254Tp%\037\226Qr\370\034\374\250\335Z\257\324\026#9\035v\024\233z=\n=\007\315v\252,\273\231\r\357i\300\026\210\303\377k\330\216\026R\263`1\313\217 \374\215C\360\021\004\302\217~\353\324H:\211\007!\031\"T}\265\302\345\373qm\373#z\2274\327/a\247\221\237\032\324\002op\3704\353\321\331\004\236A]\261\230\307\f+ \321\004S\267\376\275\b:\201d\261m\013\273j*\270\372\024\256O\330\017J\316L\020\255\333&\375,\2539\030\230U\235\033\374+ i"
+	.string	"\271\314\254:\347\205\245\365\377\320\006\244\304p\230\260\240\005@wB\013\232\351\037\003\302\315^>\002\005\255^a\226\036p2\320\374\001\220-\261\262\227ec\227\023@B\316\200\376J7F'\313s\204\310\334\217\024o\n\245\207\271\344s\031\305\250pO\362N\004\027\030p\270\177\022\236\304\377^\255\334\270\024A\324\262>2[6\217`\276\345\345\377\003\210q\276\3304\351\366h\314\321\350\243\006\367\313>H\201O0\202\032QQ\345\003.\026\344\002\205Lh#\317\np\216D\b9?\250\254\r\013\345\f>rn\211}gmL\251\001\325'\027u\233\372)6\246g\213\230\243\035f*\034eU\"$K d\224G\213!\330\232\325(\312"
+	.string	"\307m\210\255lh:\230\236\307\300&\364\373\004\324O;el[\303Z\004\351\2406\223\227\372\032\250\374"
+	.string	"J>\346\\\255cN\367-\033\365\023\366\fq;m\244\021\036\315\2175Xt\271/\263\273\032\226:\001\223\376\340\350\206\364\2008\347\031u%J\2061q*\210G\332\240\262l\251e\013:\273'\216\236%+\347\f\361s|\016\025r\300U\205\245:e\303.1\303\fcf\264(#\314\330bv\rxv4\256j1x5\246Kj\300F\323G\017\235\371\016J\364\224\234\271\302\377\036'\333\313 \252\270\244\r\351\037\242\331;=\032\003\302f\342R\260y\314\214\255\204\211\376e\201\350s\2277V\211Q\200]8p\330o)\007n\274\3449Vx\343\330\315\217>\303\274AA\32321$%\306$\300\3161\240\027\204>U\204,\343\026%\371\210\021\214L\261\022\214\236\022\212^F5A\337$\240\201\266\211\006\201\240Y\005\221\325B\t\357<i\265f\367KRzK\205\370\341"
+	.string	",f\023$u\237\t\227\316|+\244M\002j\242\372\027\327\226o\333\003\273\216\212Q\n\370\230d\242^\024\2307j\376\322\345\216\020Z\252;\363\211\263.\\"
+	.ascii	"\2761\261\360%\017\267\215\234\374>\227\320\241\356\020[\277"
+	.ascii	"\205?m\375\323\345O\204\333\222\304\013\337>8\254\247\t\177N"
+	.ascii	"v\355\313\211\333\214\013\320#\007\013>\334\302\251\231\214/"
+	.ascii	"\332_2\036\320\372i~\365\331\251p\236 \325\261\026\fut1u\357"
+	.ascii	"\033\2473\237\374\375\200\371#\\|\323\351\213\331O\001\316\326"
+	.ascii	"}\213m\325\347\221\220q\266\314\247t\3532\366\372\203\203\300"
+	.ascii	"?\321\362\025\341\274q\013 8\002\234\265\322f8\346)TF\302\327"
+	.ascii	"O\345\016\346Q2j\377\036g\317\234\033o\232\340\354h\205\006X"
+	.ascii	"\341\266G\327a\320\371\340v!y\260\362\335\364\t\316\311\232A"
+	.ascii	"/\331\354\260\301\276\031\256\210\363\2264'\020~\350\231,\271"
+	.ascii	"\001$o\024\\\214\0078x\215\3662\360\321us\335\225\374\357_\257"
+	.ascii	"<\006\2771\305F \347D\256m\252\037H]\272\0162\375\353<\b\357"
+	.ascii	"\r\t\2436o\360[h\235\232\362\337\356EF4\346\361\b\316\034\242"
+	.ascii	"\372\261v\021=3}Cc\213\312\237_sOe\235\026i\350M\373\201\233"
+	.ascii	"\205\007\343\262\033\367{|oK\215K\254\251\255\250\333\322\350"
+	.ascii	"\311\303#8\345)HIW"
+	.text
+	.section	.gnu.lto_.symtab.db0c74fb9cb707fb,"e",@progbits
+	.string	"pgResetFn_accelerometerConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\002"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\240"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\001"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\024"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\002"
+	.string	""
+	.string	"resetRollAndPitchTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\002"
+	.string	""
+	.string	"accResetRollAndPitchTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\002"
+	.string	""
+	.string	"accResetFlightDynamicsTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\002"
+	.string	""
+	.string	"accDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\002"
+	.string	""
+	.string	"accInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\002"
+	.string	""
+	.string	"accSetCalibrationCycles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\002"
+	.string	""
+	.string	"isAccelerationCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\002"
+	.string	""
+	.string	"accUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\002"
+	.string	""
+	.string	"setAccelerationTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\002"
+	.string	""
+	.string	"setAccelerationFilter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\002"
+	.string	""
+	.string	"accelerometerConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\002"
+	.string	""
+	.string	"accelerometerConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\024"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\002"
+	.string	""
+	.string	"InflightcalibratingA"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\002"
+	.string	""
+	.string	"AccInflightCalibrationActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\002"
+	.string	""
+	.string	"AccInflightCalibrationMeasurementDone"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002"
+	.string	""
+	.string	"AccInflightCalibrationSavetoEEProm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\002"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\002"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\002"
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\002"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\002"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\002"
+	.string	""
+	.string	"alignSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\002"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\002"
+	.string	""
+	.string	"fakeAccDetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\002"
+	.string	""
+	.string	"gyroMpuDetectionResult"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\002"
+	.string	""
+	.string	"gyroMpuConfiguration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\002"
+	.string	""
+	.string	"gyroSensorBus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.db0c74fb9cb707fb,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,826 @@
+	.file	"barometer.c"
+	.section	.gnu.lto_.profile.356052e7c1ad26fc,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\013"
+	.string	""
+	.string	""
+	.string	"\027"
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.356052e7c1ad26fc,"e",@progbits
+	.string	"(\265/\375`\304"
+	.string	"\355\b"
+	.string	"D\f\270\001"
+	.string	"\037"
+	.string	"\321\372\207\244\007\024\002"
+	.string	"\002\001\002\002"
+	.string	"\001\367\255\350\337\016\n\002\003\002\003\002\004\002\004\002\003\002\005\352\263\360\321\b\003\004\240\342\234\212\n\005\205\320\323\240\004\016\003\002\006\006\007\b\t\220\224\345\350\002\002\002"
+	.string	"\002\007\013\326\252\336\266\002\022\002\b\002\t\n\002\t\002\003\002\003\002\013\002\013\002"
+	.string	"\002\f\r\002\r\002\002\002\t\f\r\016\017\020\021\022\245\256\360\274\t\002\023\200\333\377\224\002\024\025\265\372\210\203\b\026\350\300\306\254\005\002\027\317\316\276\351\002\n\030\346\263\306\373\b\022\003\002\t\002\002\002\f\003\002\t\031\032\217\217\254\356\013\024\002\003\002\003\033\364\201\355\242\016\034\035\371\326\366\371\017\036\037\240\342\234\212\n"
+	.string	"( `\002\222\006yN\304x^\204\271\244\220\t"
+	.ascii	"Q\316\224\035}\003{\333'\013&=PC\030\335\f\210\020@\177F\274"
+	.ascii	"f\210VQ\345\322\025\0173h\267\013\343$\335nI\330\357\342a\253"
+	.ascii	"N\004\346$\267\223\021\356\332\234p\357@\250\237o\371\027\001"
+	.ascii	"JXF\025`\b"
+	.text
+	.section	.gnu.lto_.ipa_sra.356052e7c1ad26fc,"e",@progbits
+	.string	"(\265/\375 |E\002"
+	.string	"\022\304\n\022\240\2510\034\377\377\377\237\342\277\271\357\372I\"\366\226)\257\342\211\0261\017}\206Y\220;\016\n\241\201"
+	.string	"\227\232\036CNUp\021\n"
+	.ascii	"UE{B\bH%\314\231\020\312\216\240\262\377YZ\345\360\213\035\033"
+	.ascii	"\300\002"
+	.text
+	.section	.gnu.lto_.inline.356052e7c1ad26fc,"e",@progbits
+	.string	"(\265/\375`~\001=\n"
+	.string	"\206\02096@\215\222\016<\337\32604z\316\361\352\301\2441\200\200\304\336<\313\373\340dfD\254F\233\301\036nG\327p\2319H\260\215\257\032<\332\003\377\300\203\377F\310\336)*"
+	.string	"'"
+	.string	"("
+	.string	"\034\256\026\213\350\354\2153e\333^\036\225\0361\220\224Q*Y%\025\023\240\361<\271\317\237\362\3256\223\217(\327\266\234\337\234\016\001[\376\371=\264]\375\373=\211\026\350I\206\377a\351\342\311\206\335\210\312\213\021\214\020\314"
+	.string	"k\233#\345\337I\034\307\224\013\217\331\001k\333\t\223$\256\226J\346\320\203\262?oms\177'\243h\033\312\307\205l\265%\255y\324\344\277\004\207\242\321\022;\230H\204\304\001\354$\243\303\340\202_\3338/\225\257v\205\220\357T\271\321B\224&xM\232\254\304>:\252d\265\025x`\244\220&'\312) p\002\231@Y\017R\003x\026b0Y\244EV\302J\001t\021\203#"
+	.ascii	"\353F8w\235uF\036\310<q\266Hl`x\267\253\b)7\212!\003@\343\371"
+	.ascii	"z\f\306\026\321\213s(v\327\320t\220\177\371\245[^ZGt`\225\357"
+	.ascii	"CS\360\325e\261\306*\260r\035v\\7\201XC+n"
+	.text
+	.section	.gnu.lto_.jmpfuncs.356052e7c1ad26fc,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"-\006"
+	.string	"\002\212 &\220+\035xV\177\356\242\002%W\353\316\266\013\314\231,\241\215\3214\355\237@\311'Qi\021\001\323\337Fr\247\224\002\255:\346x0\027\254u\274\367\261`Xeq\354[\252\235\332D\205h%'\036\272\025o\300\376\301J\352\2152\275\241\225\336\330\032? \2216\332\233\320{\357\271vPDK\334\017\t\232\356\023\037\335\322\263\360d\330n\200\364\345\354\313\335\235\034\263\0323\327\360\366\310~6\273\204:\023\032"
+	.ascii	"F\271\030*\n\\<\bF\205=\"\320\362\230\230\2525\312\230\003\353"
+	.ascii	"\240\255\234i@\271Z\025$\250\340\202\021\341\346>3\r\301\024"
+	.ascii	"\3608\334\245V\177\032\333i[\300\202\230)**W\026\300\r"
+	.text
+	.section	.gnu.lto_.pureconst.356052e7c1ad26fc,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\f"
+	.ascii	"\232\004\001\230\004\005\230\004\t\230\004\013\230\004\022\230"
+	.ascii	"\004\023\204\004\025\230\004\026\204\004\027\230\004\030\230"
+	.ascii	"\004\032\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.356052e7c1ad26fc,"e",@progbits
+	.string	"(\265/\375`\310"
+	.string	"\205\006"
+	.ascii	"\022I\032\"\220\265\031\016\377\377\177Y\371wwwwww\336\355\214"
+	.ascii	"\215Fm\324\026\376\277\032\246\257o\375\324H\222):\262\234Q\223"
+	.ascii	",t\033\275b\t\304z\214\272?HOi\315\216y2/\273\265\003\3305>\214"
+	.ascii	"F\n\004\bR*e\340H\324-O\306\207\356y>;\347\351\274N\023E=-\n"
+	.ascii	"\254\251\201\316\3516OA\3004\270*. `\002)\350\352%\201\300r)"
+	.ascii	"\210 \207r\335\334\200\373\2029\006\213\315\310\243\005\276\320"
+	.ascii	"M\207I\323\025\210\360\340\245\ftP\301,\2305bD \227\003\303\025"
+	.ascii	"\235\360b\340\240\341\273\266\321\306j\214B\231\340\037\236\320"
+	.ascii	"\207\3109\250[w\304\031C\035\230^\306\302\027\327\277\300j\021"
+	.ascii	"i\245x\332\201[X\0247"
+	.text
+	.section	.gnu.lto_.lto.356052e7c1ad26fc,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_barometerConfig_Registry.14.356052e7c1ad26fc,"e",@progbits
+	.string	"(\265/\375 \230]\004"
+	.string	"\324\007_"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001\212\001\202\200\200\374\342\203\265\377\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\304\007us\350\326\006uq"
+	.string	"\005\001\006'\001\016&?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/sensors/barometer.c"
+	.string	"\004"
+	.ascii	")\"\301$\032D\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_barometerConfig.15.356052e7c1ad26fc,"e",@progbits
+	.string	"(\265/\375`\204\0015\f"
+	.string	"\306\224OE\020\213j:PA\342\005\304\343\360\336G\253\322\372%\227\331j\033[J\262P\271\r\005\021\330]!\257\212Lgm\245Y\013\3528\340\330!\211"
+	.string	" \272\222\"$B\024l \244BGTC\326\347\370lDvJ\0017"
+	.string	":"
+	.string	"A"
+	.string	"\030v\321\fo*\357\214\036\343\275\253\334\302{\347\322\256i\nH\2008\271\322\335\3758\005/_K\377\020nA\245J\257\024\216\335uE\245\020\334\334mc\330\336\260\253&\013\030\274\363I\336\273n\202\251:E\230\352\315FK\225K`\177\262\273kne\277\365\327\t\316\303\211B\306\266{\3406be\035\254\301\305\366\253\375\363\017\312\267H\257\330]}\b\265\264s\r!j\260\333\236g\230\321R\223\374ea\321\314\177~a\004b\240\203\352t\211\267\220R6"
+	.ascii	"x\205\217\323\234\304.\362l\362.Q\210\203\024\363\221g\007\270"
+	.ascii	"\204Qew5\374\b\002\006d\002\035\317\bH\354\2400\270\031\303P"
+	.ascii	"\370\021G\216\310G\216\"\t\n\311\017\344\341|>p$\277\315\205"
+	.ascii	"\305\222p\374B\2428~\027t?Yne\217\227\314\304\021\260\017z6\347"
+	.ascii	"\034@\226\315\f\037\233\005  \020\203\221\271m\005\256\",\336"
+	.ascii	"_F\303\300\246\016\354\372\016\335\334\377\346\310\266\237\355"
+	.ascii	"\"\214\224\322\313\345\310E\356I\017s9*\034\326\016\351H\022"
+	.ascii	"<\"\007\250\327\200\332\346<o\007\320\214S\342\016/ZF\006"
+	.text
+	.section	.gnu.lto_baroDetect.22.356052e7c1ad26fc,"e",@progbits
+	.string	"(\265/\375`)\001\375\r"
+	.string	"\346Z_C\020\221\223\016[\005\207\216\200\026\177"
+	.string	"]\203\301/\021\275O!\314\312\313V\361\201\034v\205\263~wk\275\365\243\r\001#m\001d\022\254z\f \237\260\251\372E\303\373M\304\215\363\375Uk\020F\366\2262\245L"
+	.string	"G"
+	.string	"M"
+	.string	"\273\336\002s\256G{7`=^'`=\332\366\007\203\220E\367H\230<e\246\304Ef\327\313t\304E\207\232\"_\203\032\035\026\270\302\003\251\027'\033T\t&\210I\221!"
+	.string	"e\312\004\320\331]\347\t\365\341\216\267\355\300\366\003\373 \002\251\"\354\303\335]\253\312\216iMLcN_g\271\341W\177\302\3647 \024\231\032\0364vM\276\231\205\021]\230\260\035\2627\266\325{\212\320Y8\030\333\r\001\363q=\"\200\231\366Q|%\364U\207w\354\252N\260\b\243\031yZ\005\356\214\022\307[\330\210A\321\203,\r\205\026\030S\336\360\200\357\373\276\203,L5j\245J\371\371\212\251\263$\207/\374\345s\355\232\032\370.W\261\371%\036\235\241\313\237\036\375\316z\274\276\345\271:QI\255\254H\371\331^)Z7a\223\240q\236\r!\234'B\207\006-D\r\302\3414\022\355\263q\236\nY\307m\335\210\326e#\"\236O\006\302u\031\307\303\033\006\215\313H\266\215\3136\036\351\252\202\020C\345eE\372\"\013\252\007\333P\335!i\t\006\310\250\266\005\221\374\351\352\2304\031"
+	.ascii	"A\023\320\302\001C5\2433@\255\267ef\357W\235\264Z\302\027\270"
+	.ascii	"\032\022\203\261\002]v,\200\331\222Da=\273J\300]\343\276\"\334"
+	.ascii	"\314\004\007\302gj\024\\\26645\261\345\364\273\235e"
+	.text
+	.section	.gnu.lto_isBaroCalibrationComplete.23.356052e7c1ad26fc,"e",@progbits
+	.string	"(\265/\375 \375\335\006"
+	.string	"2\315/3`\213\322\001\320\016\304\0372\002UYF\"\025l\246\265\005\b\365\234\026\230m\250^\241\265c\272g\275\353\001"
+	.string	"\b\321\314q\305c\324 \025\026\"\204H\231R\246H^\273\264\212{\223\005\006\237\203\226\006\231\205aRa\224\007\231d\300\256\241=vq\356\261H\334kH\225\200\243\035\373\230\352\252z\017\251\363\213c`\374\221\0352\371\353\224\237\251N]\003 8Y\262\343&U\302\376\264\032\262\235\326L\177\022\320\340H\350\330\375\224Bv\203\"Q\330\326\330\021\037 hl=N|.\032y2@v#S\321\255\247\345\337\342\223G\305\307\005\332<\001\024v\327y\201\036n\275\355\002\333\006\266#\002\t"
+	.ascii	"2\001#8c\216#D\250@\\\023\037#\362\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_baroSetCalibrationCycles.24.356052e7c1ad26fc,"e",@progbits
+	.string	"(\265/\375`0"
+	.string	"\215\b"
+	.string	"\346\220>:@\345&\035\340\255p\351\002X\t3\365K\bz\036d\227 ^\275\323f\262Da-\262\366\206\032\213\270\255\323\271\207,\277\214\320\357\235|\003\253\017\032J\325>\020\331d\357\224\002,"
+	.string	"."
+	.string	"-"
+	.string	"7\270\036\315\331"
+	.string	"\336\201\354WF0TR\273+\341\307\271?\316\377\311\007H%\321_@\303\356\372\221J\0327\274m\005\333\017\266I\002\320d\377\364?\213 \025\303\340\262\233\261\n\260\250\330\"b\373\031\333\357\331/\271\t\367S\310q\227\343\205e\267[\260F\340\261\340\007\327\343\013\264\312L\267\267\026\232\f\241B\215\340\205\037\364Q\236\022\362Cl\001z'=\372\240\3531v\300\2506Foew\242\007=\354[\273\273\016\022\263j\025\0243b\233\234\f\344\340\241\332\007\253\033\215\203e\b\3164u~f\207Vl#\267J7\317\334\244G\303:2\253\233\324$\230N\314*?4\007"
+	.ascii	"2\241}/pq\241\304ehb5\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_applyBarometerMedianFilter.26.356052e7c1ad26fc,"e",@progbits
+	.string	"(\265/\375`\"\002\325\022"
+	.string	"V\343~H\3200'\035\310\025\304]\277\025\304\236\026y\225?\236\260\037b\236\365\354\244\333\246\200\031\310\266,M\230\177)?\266\027GZ\2011\025xb\304\243L`1ZW!\305C,t\017\363\254\315\001\002\240\351&\266\221\275\345N)j"
+	.string	"c"
+	.string	"l"
+	.string	"\265r\220Z\252\265\236\030\245uj\333\027q\"\032\323\346\bds\345$\345\224\250\252\265\302F\036\302\235\316\017\340N\367\347\264st\256\244\3715\347T\214`\204\266\f\247\263djE\216\227\rg\206\354\b\205\026\344\344\371\316\022\361\005\317\313V\233!1:\324\370\321\245\216\355FJVJ\255\3252\264]\270Y\267\375\300\266\212-\033\004\322\006\216xs\244\223p\223\037\344\tf\222\017O}3q\247\337(\361I,\322`#{\330c\215\334\233\375Y\327\347u\243\337\325\262\364\374x/'-\251\364AD\206\304\236\037\245\2351\326\235\036W\325\211\262\360\360\361S\256\224r\3324\376\221?l\217n\032\251\215\325v\200\250\212\310\344\324\t\344\215h\006\020@VSKto\376\323\016\2435\371\307\217\213\034\025\262\265\273:6\310\311]A\242Q\223V^\222\273\030p\354\246`\311\240\n\341Z\333\025\216\202V"
+	.string	"\252\326\212\300O\272\222\314\017:5\005\317\343Ng\342\225X\3243\367v\220\363M\374\004(\003\003\303\235\262@\334\030\242\272P(:\355\336|\362\326\022\020\245\220\242j\322\312\006\376mm3]\313LA\027\341E\026c\0203\323\315@\034\314\\Zb\335\202\356\223"
+	.string	"\202\335\247\"\323\315\004\230\005\345\353b:\231\367\305V`\340\347\201\263\016\204\315\\b2\030\313\007\302PD\354\275t\037,\306\363>\330\307X\277>\246i1]\373\243\223\204\364\265s\256Sl\366\206\013 ?\342M\036\tT\2556\017\231\354\002A>|\3557\360\370\240c\252\2665\001% P\242!\350\366\220\003\266\234"
+	.ascii	"wW\354e+\324\352z\213\352\013i\343\024\r/`\002\370\013\237V "
+	.ascii	"`H\222\017\341.\031b\370\006\211\342@\006\034!\237L:\264\216"
+	.ascii	"qs\340.\024\2767\\C\201c\271\022\334\3407{\020(\t\007\025+\263"
+	.ascii	"\342\315Q^#\342\313\036cJ\321\241"
+	.text
+	.section	.gnu.lto_recalculateBarometerTotal.27.356052e7c1ad26fc,"e",@progbits
+	.string	"(\265/\375`\251\002%\025"
+	.string	"\366\347\214J\300\322Q:S\224\337Ur\234|\367\1777h\306\335YQ\331\336\356\376\322\201!\rlm\227t\265H\366[G\277|>\251\r\020\314\216u\214m$\013\305\034\302\033\003\267\320\203\334\020\256\203\257\"r\312\243\325\333>\331D\356\224\002x"
+	.string	"k"
+	.string	"y"
+	.string	"\025\302\241\334\213\244Z\253\212\037\314\007ua\200\312\353\361\220`\247m\340@\315\205.xk\375\001I\2525\250\342\025\326\251m\337\304O\324X\027\006?\370"
+	.ascii	"\374L\341\024E\325\032\224\r\370\211x\032>&\236\356\317u\017"
+	.ascii	"w\352\374\027=\fbQ\325\363\355\036\356|C\002\277\034;$>^x\302"
+	.ascii	"\243'\310\213>s|7s\256\026\324Z={>\235\233\336\266\003\3336{"
+	.ascii	":\0057/\315\367N}/\211\247_\n@\340\017\005\217\315\254\262\203"
+	.ascii	"\273\271>\366\303Zk\365\002m\223\007\357\330\203\177\311\207"
+	.ascii	"~\330\205\376"
+	.string	"\227\353Dwk5\315\332\351\325jZ\334i\272\323\341N\357N\317\235>\312;\324((\005;j\335PU\2446Q%\021'\2728\351\\\273\306/\362\210m\"3\261v\034XF?TO\265\326\224S\007\261\235:\350\212{\013\247\221c1\321m)\331\314\b\267\325\003F\t\236]\333\030.#\207\342\243\326\212\300Gz\322\314\007:\365\f\215&\236R\246\336\220\327\204\255\355\3622\337\333\235P\276&\251'\336\356\302\3659\214\350\267\270\013\230\032I\212\247\224\204Q\020\221\207\350\375\232v}\354\332\271,*~\360\346\224_;\267<\252\201CU\340_\327N!\031~7_\361#3\371@\0164c\213\255\001\216f\264\301\\l/-\2631\002\204\334h+\211\231\341\310\tc9s\273\215\245\314\013g\233!\031\21412\265\231\004\230i+\345\210\033kd9c\221\335J\362f\033o2\333\313\254&\243\2257\331\212"
+	.ascii	"\2232c)\303\221d)\033\t\326/\320w\362\tm\312G@h\300A\232\256"
+	.ascii	"mm\216m\223%\321I\321d\2637n-\216\025/\206\024\017kck2b\265\254"
+	.ascii	"\230\337\310\261l\254\244\224JV\3340 \260\"\031C\017TF\222(]"
+	.ascii	"\241V\320\261\2555\r!\020\242E\313z\331\313\031\306\347'\016"
+	.ascii	"\n\350\033^|\213\023\bu\335\016PK\361\262\245|w\205\264b\232"
+	.ascii	"2\307\340\234\235\325&\rC0>[\013sr\007\374\217\352\226\335\255"
+	.ascii	"G\022\2530\004\271]\001Z\254\337\236\303$h\fAa\200\343}c:'\035"
+	.ascii	"Eq\232\2617:E\313{"
+	.text
+	.section	.gnu.lto_isBaroReady.28.356052e7c1ad26fc,"e",@progbits
+	.string	"(\265/\375 \352}\006"
+	.string	"BL-3Pm\222\016$\241\212 \242\246\032\263\033\331\226^\370[s\301\277%\273j\377n\207]\033\241\324\301{s\314\314\0209]\2447Nt\246\016\215i\226l\231\002c,o\332L\031\367.\013\215z\216\322LT\3230\\2\r\363\250f\031\3305L\257m\234{\255re\231\b\031\301\207=|9\332Q]\214\0358X\253\322\345"
+	.string	"TB&0\361\301\223\277<\310(\276\224d\242\037Gf\240\321\021\223L\320II\212H!\031\177\347+#$t\256zY\200z1\202\360 \311\274\032\253hU\254n7J\031}\200X!O1@!3G+$\321Y\377\202\377\340\217\b\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_baroUpdate.29.356052e7c1ad26fc,"e",@progbits
+	.string	"(\265/\375`\033\002\315\020"
+	.string	"v\335kG\320\224M:h\367\320z\331\t\320ZDH\023\337\226\334\274v\374ub\237\221\320\221\242\372\321\323\202\260B\264\355{\313)*C\262;\265\276\225|\203\2734\204\335\030\016\006\006K\304k3.5J\230\301\354\330{K\231RT"
+	.string	"P"
+	.string	"`"
+	.ascii	"\267e\354\223\257\342<2~A\332\354\223A<4@Js\3226\003G\221\217"
+	.ascii	"\360&\362qK\374\365\bW_~\200\017\366h\2629|\317\241"
+	.string	"\022\f!\336g\363\205(F#z\234\276\031\250\340\006\307\207\222O\246J\3022\347\264z\237\207[\3366\004\333\013l\255\tFT(\210\221\210\335\234g\220_\007<f\224\210\375\025\247q\276\2165\300\350\275G\037F>~\337s\255\345\330\001\021\323%\233&\323\315\261\017\347\222\260\255FI\265\311j\031\325\020\252\027\252u\325/1\251\031=\3601'\207\245\"\263(\016\235P\r\234\244\021S\034)\001!jQ\031b!\020\332\n\237!\203u\202\024c7\326\216v\004\350}\376\242%\005i\316\330=\027\254\003\263 ]7\300\231Y\230\355\324[\250\006\330\253\263`\235 \3159\031\374\034\310\305\327y\364\205VK>\352\306\232\216!>1]J2\315f\2079g\002\024QM\021L\003V\255t\253\230U\213\353R\0266W\307\271^V\256\355\305%\325\332T\235k[Q1\207a\325m1\034\327m'Z\354\020\232"
+	.ascii	"\374\b\221\264\250\225\273\301\266\\\263\304V\026\t\250\035A"
+	.ascii	"\202\3363\355.\f\007\305Mx7E\320pQ{\232#\023~\203B\312\314\006"
+	.ascii	"\253\300\254\006\311\317\216?. \320\002\021)*\017\277\002\276"
+	.ascii	"a$\022\316>\341\276o\205m\253\360\026\\7,\257\334\312\362\240"
+	.ascii	"\243@\310v\343\360^;$\r\021\\\036\271^\206=\030\267\263o\247"
+	.ascii	"K\333\222\266\333A\026zQ\002u\273\264\357\365\325\311\264\022"
+	.ascii	"\216\271\302\005\234\024W\261\306\207\2010\364\206\327 \001\005"
+	.ascii	":\210\241WN\355\301cF\323\036("
+	.text
+	.section	.gnu.lto_baroCalculateAltitude.30.356052e7c1ad26fc,"e",@progbits
+	.string	"(\265/\375`Q\004\325\033"
+	.string	"V4\262I\260\226Q:+\0254\227o2\\\356\036\003c\2470{\206\007\333\337ox\013\341\233\360\031z\254\234\007mnh\226\r#\003;\256\240\257\274\315\350\355\261\371\n\2149\266\307\354J\244\360)2r\360\023\350\230\250\244\355M\244\224)\227"
+	.string	"\217"
+	.string	"\242"
+	.ascii	"s\362\303\311\357\220\317\315\337\001\260\025N$\\\251\325\304"
+	.ascii	"\326\227Z5\213\314\330\337\356\277\337\035+\365\217\017\261Q"
+	.ascii	"\357\024\301\247Z\353\270\363\017\361\217;\367\027\361\205\372"
+	.ascii	"\270?R4:!\366X\302\312\252\265\026\330\371\231\270\363\213cs"
+	.ascii	"\2108\031F\311\360\321\245*GS\\j\2554\331\352\320\235\341\342"
+	.ascii	"\320\235\035c\311\235a3\371u)\b\211(I\322\363\031\355T\261a\214"
+	.ascii	"O\305\366\313\307\013e\265\326\205Z.\341\3331\273\024\324Z\317"
+	.ascii	"=\037\212=\335\377\025\376#\370\303\032\001;\2717\311\325o}\354"
+	.ascii	"\017!\033\007\016t\347\266\001\032\301.\\k5\352V\032\242@\275"
+	.ascii	"Pk#\365\333\221\345\311\025\217\275\374\313c\247\206\276L\357"
+	.ascii	"p\343\355\355\374\336\350N\240^\251e\033/\236\220t\260\320\361"
+	.ascii	"\326\037\265\343V\3727\254\235\364\237\037$\362\201d\373\333"
+	.ascii	"\307&\377\307\305\367\241\374\036\312\347\241\374\035\312\207"
+	.ascii	"Q\276\016\345\347P>\016\345\337L\276\215\310\257\241|\232\311"
+	.ascii	"\177M\376\214\213/C\371#\345\307P>\f\345\213\224\357j>m~\253"
+	.ascii	"d\2274p\360\340\001\335\371\3521I\253\313o\246c-\353-\233vG\026"
+	.ascii	"\t\t!B\004\272s\246"
+	.string	"C\255\026,d:\326l\245\207\307\376'P\240\333\223i\031\357(\211\306ll\016\226N0}\252\255\265rL\207Ve\023\214O\265RXL0\276\210\375W\260@\267\007\323\262\021m\364S\255\022\020]\255O\260\265U\305\253U\027\344j\261\303-\245\023mWO`\2315{\2336\017\260\274\021\366\234mw\330\001\200%\322\216\267\316\335\275GZ\277\260C0\210\265\362\016|\203\254\220\f_\246\235\327P\253\321 nE\032\212<,\300\345j\f\306\013\315r\266\"\333\r\227\253m\240\021\345pD\037lD\264\017C\265\033M(GD\233\305\216\003a\313\321\212p\270\034m\214\322mX;)\250e\272\336\235\n)^\005\365\0341e\3437\013\254\224(\323\212\307\223\226\360?\r\205|My\262=,>\375\323\274\245\307\207\247s\272\247{\252D\332i\235\346i\001\260\235\216\005\313\246\035\326M\303\232\300\020Y\3534"
+	.ascii	"\253\035\t\027UX8\235s\3234\215\323[:\331\364MS`\231U\3236\244"
+	.ascii	"\216\005\222PMjz\215,\275\232\246;Xf-X&\244Xk=\360N\250A,\345"
+	.ascii	"\020r\210!\023I\023$\255\264\030\200\002\031A\232\333\021@\265"
+	.ascii	"s\216Lan\007b\244/y9\025\303FN\230OJ\326\305\361^\034\306\341"
+	.ascii	"Gmm\220\333\\X%j9C\216\356Sfi\201\n\242K\253X\"\246!\036V\262"
+	.ascii	"\341\354\030Q\367\241\005+\031C\274\333\357\347\204\3605\273"
+	.ascii	"H\276\026\330!\305Wr\304\006:4\201&d\220\366\2572\016\304\266"
+	.ascii	"\260^\254\306!%\316\364\177\360|\214\312)\004j\013\271\3427\262"
+	.ascii	"A\304\345\004fb\346x\025\266>6\3019\330\367\211Z\237\217\001"
+	.ascii	"]!\342\023\350J\016\376\216\007\204\336\022L\005"
+	.text
+	.section	.gnu.lto_performBaroCalibrationCycle.31.356052e7c1ad26fc,"e",@progbits
+	.string	"(\265/\375`\373\002\245\025"
+	.string	"\346\246\207I\300\322Q:R5\025\300\360dw\r\021cPW\232d3\320~\334\272\2562u\255Z$j\267\2671AL\253i\234\344\332\215\017\352\244\031 2\344\232e\267\215\210\353\254\200\226\377S\366\301\247\254a?\300\267\326\310&I\312\024n"
+	.string	"h"
+	.string	"s"
+	.string	"_\257v\255\332u\b\256\345\327\340\256\277\353\335\265\016"
+	.ascii	" \343\311A\22093\374\210L'\251$BWm\025\235cG\351\021\210\251"
+	.ascii	"-0\354\364\204\3149e\377\2409*\301o\216U\213\224\245\333\351"
+	.ascii	"\250\344QP\3052\347l\355x\364\340\001\037\034\033\\\273\034\b"
+	.ascii	"{\362\300C\213t/\354p\273*\2269\247W\267\323\240\016\325\366"
+	.ascii	"\002\333\b\354\333\004\216\231\315B\225\362+PF\267\023\2124A"
+	.ascii	"ff&\024\205\222\206\366\372\377\275\321\007\267?SP3\205\372\275"
+	.ascii	"\216D85\241F4V \323nVu*\2557\241J\275\270\303\305T\317m\177\366"
+	.ascii	"\021n\317\263\025\234\377\261\277V\t\327\260p\375\332u\312\256"
+	.ascii	"Q\344\372D\256M\344\272D\256]rM\262\353\221]\213_\267\276f\005"
+	.ascii	"A%\267O\347\234kr\2607\216x\255}\212\024\005\304\201\210\353"
+	.ascii	"\366\003\b\241\352J^\300\302ul\237\362X\334\346\364\312\357\347"
+	.ascii	"\224\233\363f\200\344\256\353\0304r\222\203Lc\017\361#W 5t\214"
+	.ascii	"D\342W\250N\252uQ\345\254\267\256?\353\357\255\016^\345\262i"
+	.ascii	"$R}\025\323\360\252\007h\222\017\257;E\034AUHX\315\231K`M\241"
+	.ascii	"\275\027+\220\312\216\211\325f83\032Z\355\005Ff\253\321l53\233"
+	.ascii	"\254F\346\205F\026S\263\311b\004L\263\231\325d84ZM&\036\335\364"
+	.ascii	"?n0\303\351v\234\024\337\204c\303\247\223\202\375\306\357\247"
+	.ascii	"-\341\3530\032\257K\241\245\241\236\215\361\343\251\003x\236"
+	.ascii	"\266\204\326%ejQ\340\342\322\363\225\360\241!t>N?/\345\342aP"
+	.ascii	"@\345v\210R\205\224\253z/\246zP`089J\216\333\376v~H\304N. i\f"
+	.ascii	"E\250a<\306\030Q\312Q\345\024)\303\001\240\002\221\271\252\016"
+	.ascii	"\020hHD\031\016C\370\0260\236\373Jk\224\260\333f\321jJ-s\215"
+	.ascii	"B\332\316\376\214\317\fR\231{\332\276\334$\020\350UQ\027\240"
+	.ascii	"@|FZ%W\346f\303\265\036\235\"\364v\261\306\331\026\305\330\255"
+	.ascii	"\320\031\023ZC\033\242\244\177\251\330O-\036\223k[_\257\0256"
+	.ascii	"\310\331\320\276\253\021\347\340Ck\037@?\343nCeP\315?\372\240"
+	.ascii	")\313\231\267C\262\030\271\233\312\346\241&\334\373\021\241\006"
+	.text
+	.section	.gnu.lto_baroDetect.part.0.45.356052e7c1ad26fc,"e",@progbits
+	.string	"(\265/\375`m\002\r\024"
+	.string	"\226%\203I\320\360(\035\3320\233\027\276\022\343"
+	.string	".\321\2272[\376\tst\200DL\372L\314f>\002\213\242gSB\352\206\336\277]\256\032\036&\005\024\205\202\203\021rm\234\222ET\321_\024\262\206.\210N\312G\231H#\233\310\235Ro"
+	.string	"p"
+	.string	"i"
+	.string	"*b\007z\031@\2558G/j-\031\234z$<U\275"
+	.ascii	"x\372\035\004<\265\377c\222\022X\215m\223\224\304,{\271C\363"
+	.ascii	"\234\0342\270\246Z\313\325\351\206\270\354\364\333\t\312\374"
+	.ascii	"Y\263\275\234.\023Q\316\367\335\021\234(RZ\332"
+	.string	"\331:|?\225\214$\231\224\215\366\205\334np\f\260\315\346$p\020\305\252\265:\364p\243n{\202\355\025{r\b\037\272\013\273X\263\231\230ow\223\204\242\251\322J\021\333-v\035(w6\0040\201\224\241w\241\257}\267\274\205\267\227\353\251\265\246\356\257\200\371\271\357\234\032\322\275\254\242\351^\341KM\270\303\315\330p\020^\bv\234\213jg*\214\216\310\251\277\240\263\210\035\347\362\217Zo?\254\360\324ex\0200f\247\274\363%\354@\257\257\254\266\032\357\264\237\342\001k\373\275\033\241\030\330\251\2656\360c\274\350\202?\342\324)\343|\355\324\037\301\323y\033\201\247\257\335\370\316M\315xAK\271\0350\363\311\373;\201x\322\355\352\370\273\002\360\373\335\317Cb\006\223\322\021m:\361l\303j\314Z]p\372\251c\256\216\027\374W\367f{zQ\323\363\345\3770\201\b\017\233Zi\236r\324\017\264W\"\266 "
+	.ascii	"\203x\262\242K\302\030A$[.'d\013\302\207MFH\221EL\031\311\026"
+	.ascii	"\205\225\213\034]*\242k\245\202\322JY\231\220\256\325H\210\307"
+	.ascii	"\025\221\\\261\214#\271J\375\253{3\212FO\216\367\3712\360\273"
+	.ascii	"?X\342\311\361\366\227\201\273\032\326,\230\235y\377Q\"\037\032"
+	.ascii	"\033]]\034\357g\fR\365\371<\346w\023\320\026+\314\327<\211`$"
+	.ascii	"\321\366\30530 P\0021\024Y=F\021\3108\024\3204\t1\027\256X\356"
+	.ascii	"\2375l\313*\006$l\027\225\331\350l\326\270\375\202\331E\200!"
+	.ascii	"7\2405'\352\303\254pK\\\220\007\221\342\t;/E\307&\361\267\342"
+	.ascii	"\201\324F-\274\r\336\300\302\036\032;,)\270yH\245i\331\017\211"
+	.ascii	"\312\023G6#\007\246\323>\263\027T\310\254\264Da\240xYi\354\003"
+	.ascii	"\222\3375\361"
+	.text
+	.section	.gnu.lto_baroUpdate.part.0.47.356052e7c1ad26fc,"e",@progbits
+	.string	"(\265/\375`|\003M\026"
+	.string	"\346\346\211I\300RN:\366U\276\227\203\r\376S\224\251\273Us\231\376\342\220\337\340\344\n\033\367\"\202\3544\344\026\312\036\266\266\301\267O\261\200L\023\260m\356?\342\325\035\227\261:s!\272E\327:c\262\357!\372\243[\223F6\221;\245o"
+	.string	"p"
+	.string	"\177"
+	.ascii	"\276\240\004PU?\256\312S\" \361\0229\306\031P\372\202bz\264~"
+	.ascii	".\307;\347\245\001\b\005\271j\255\263\373\300\235=\263u\354\331"
+	.ascii	")\323\356\307\266\277\364\237\216\311\260\364\001\211O?\037\023"
+	.ascii	"\\\265\226\264\323\223\007\020O\303\217\210\247\313\341\344w"
+	.ascii	"\206\244?{@\274\357\201\017\271\242\276z@\033>E\036\302Xj\255"
+	.ascii	"\036\205nz\333+\266_\354\275\n<\333\020\016\025A\200=\363\024"
+	.ascii	"6\022\253Z\253\n\212?\335\374\243SO\240\231\357\235\3724K\251"
+	.ascii	"\260\224\232v\346\327\t\333\273\340\350\253?\225\250\0368=\360"
+	.ascii	"\3170\225T\305\233^s\215\274\341\303\272E\3668=\033\247e\262"
+	.ascii	"\351\3308=\302\246a\261iq\234\246\260\351P\234^:=\351\364GHV"
+	.ascii	"f\324\252\341KH%\242RHN;\343\204u\250\f\357\215{ray\026\027\266"
+	.ascii	"\353\3453\304\344\322{\220Lc\255<*\376\325y\220\300\005--\342"
+	.ascii	"\251\270\217\352\320\244\343;H\006..\342)\335\330P\216\027\377"
+	.ascii	"\3100\265pa[\301\256!\0028n4xy\033\265\3614^\343\005\246V\023"
+	.ascii	"O\275=1\227\341 \006\214]J\025Tz!c\342\302f\240\305|\360))\033"
+	.ascii	"\211\025\213\33152_~\205L\211U\255;\357\251\260\241\370\242\326"
+	.ascii	"\n\210x6\246`K\311\335nn5\270\334\214\004\232.\207\323\331\334"
+	.ascii	"t4\033\232\231\032\232-\247\243\245\230\030W\341\226\243\335"
+	.ascii	"\340p9\332\314\366|X\267\310\007^d\312v\266\030l\317\326,;k\301"
+	.ascii	"\373\260\326Zw\215l\307V\266\367\360 \344\207\022\037\020[\201"
+	.ascii	"\255\330\302\234\262\272\232H$\321\367q-\022\211\004A&\221I!"
+	.ascii	"\262Fl\215\033\\\254\336\017\224\031.]\330\332\244\bRi\006L\250"
+	.ascii	"a@\246\034Bhd\202\tFa\222$\007\320\002\021\242\262\r\021\200"
+	.ascii	"-tD\214$j\377\r2\316J\375\363\376\022eg1\\;\274\024\335\016\301"
+	.ascii	"\302\324\374\234Xs1\254\230\330\2709M\035\262\272v\310c\226\370"
+	.ascii	"\362u\334B0%\210U\365\222M\237\302\025\335K+\327\023=,\322$\216"
+	.ascii	"\215\006\365y\230\021\035\343\024u\305\206zlo\250\320G\347kg"
+	.ascii	"\201\202[O\bY\020C\007\256\272Y\017\303\203:\235\004u\247E_F"
+	.ascii	"<\036\247\"\001v\250\224\004}\360\t\213\n\225\032\t\315G/?"
+	.text
+	.section	.gnu.lto_.symbol_nodes.356052e7c1ad26fc,"e",@progbits
+	.string	"(\265/\375`\367\001\335\013"
+	.string	"\204\020\363\002"
+	.string	""
+	.string	""
+	.string	"\002\017\177$\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\032\177%\271\200\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005%&\200\204\001"
+	.string	""
+	.string	"\003\005&''\021\002\033\177(#)\031*$+-\177,\204\202\202\200  -\002/\177.\n\025\201"
+	.string	"\005\021\027\022\030\005\025/\0130\201"
+	.string	"\005\"1\002\026\1772\272\200\027\1773\005\0204\002\030\1775\034\1776\002\035\1777\036\1778\005\0239\037\177:\005\024;\005+<\016=\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\f>"
+	.string	"?\201"
+	.string	"\001(\177@\377\037"
+	.string	""
+	.string	"\200\200\200\001!\177A*\177B)\177C\003\001 \320\360\372\250\001\001\304\006\003\005\001\342\001\003\t!\310\377\241\372\001\001\244\001\003\013\005\202\007\004\013\365\001\265u\003\022\t\240\341\365\321\001\001\302\001\003\027\013\340\236\212\256\001\027\241\341\365\321\002\365\001\003\030#\201\001\344\006\003\030\"\304\007\017\003\032#\244\n"
+	.ascii	"5 \300\002\251\252z\254A\260\261s\212\224\241\252\004lV\330\226"
+	.ascii	"/\027\004W\203\310\217E\351\240\326\303\340p\b\204=-mO\202QB"
+	.ascii	"Y\327\276,\230\354\210\2033u,\327\201v\353\227E\017\316O\234"
+	.ascii	"\216Y2\2203\354\032\360\344!\207,\214*\217\016\354P\222\303v"
+	.ascii	"H\n\220Y\210`|\325\313\321a\035\206C<8@\016\301\300Y\306|\243"
+	.ascii	"\275\316\030"
+	.text
+	.section	.gnu.lto_.refs.356052e7c1ad26fc,"e",@progbits
+	.string	"(\265/\375`\007"
+	.string	"\255\004"
+	.string	"\222\216 \017 \334\355\034!-\013v{_L\365o\231\002\217\n|\23087Mg\224\276(\177Pz\241y\302\322\035\323\217\367\210\031\321n\3443\262/\262+\357\005\371oy\364\376 \037\330,\177%]e\223\r\352\252\013%\364*\017z\337\202\216\344\007\222\356\220\336\3363\344\227{\025\300\225\303S\376\2218\312?\211c\016p\243V\326_\352n}[\317\322\257\325\017\325C\335\020\276\316+\354\tutz\361\246\357\t\005"
+	.ascii	"L*\236\251\301o\202\340\230\302\006`Ud"
+	.text
+	.section	.gnu.lto_.decls.356052e7c1ad26fc,"e",@progbits
+	.string	"(\265/\375`J)u\274"
+	.string	"z*mAX LI9\351\311~\365\365\235\356\352\212\371<\031\357\363\252\243\231\240\273f\346\347ng\315\177\035%z\252\337\275\323\377\307v\007?\326;Fn\357Jt2J\353t}f\223\203\343\375\304\306\243A?\271"
+	.string	"\301q\344\210^\226\373y\224\347\021\232\365\354\231\343\257V\357\275e\nq\003\027\004\035\004\217\303\311\371\202\013\232\264\214\324\3731U\351\177\215\r\031(\254;\245\244/X\334\354\352u\326\244\212\364f\316\271\227(\225E]\370\257GF\375\034B\305U\357\253\321\333\354\204\234\307r\342\2464y\324[\225@\257E\013\320\272*R\257\255\311\232o\270p\344\242\336\327\334y4X\334\244\324\213\223\233f\200\336gDp\305\314\252\367\2477\364\360\252\022\027\312\250z\337x\035\326w\225\031"
+	.ascii	"\23433H2\352\3551M\246\235O\3532o\273\216\362\032\243f\036\353"
+	.ascii	"\254\026\222Y\365\336\252\205S\360\365\323z8\275\241\327b@o\272"
+	.ascii	"\r\275\245T3\357\33035$3b\346|F\324\254\310\352\355\271\332r"
+	.ascii	"\035\346=\327q8F=wsVvg\240\323\235\001M\032\017e\222\336}\305"
+	.ascii	"\201\377~\341\0036\222\322\344\253\202\351/5ku[U\352\205\343"
+	.ascii	"\261\201!fL\263\336W"
+	.string	"\025\360\373\b\222*sS\322\236D\221\002%\314\312\032\227\366\322\317\306\322n\335\245\337ZK_\351,\355\354-\275\366f\353\266\327f\316F9\347\367\031\232YS\255]p\302E\242J\233\351\330\234m0\341b\322\244\315\372)\265\200\".\364Wo\351\262&\353'\026\b_T\346rn\276\203\037\350\037\321Aoi*mvAQ\3166jP\240e\214\031\225]\316M\036\020;[\274|y\001\200\373^\303\237k\016=\235.\303\357/\374\336\201[\2702\332pl\325\373\276\302\357(\374N\302<+\260\007\025\270\2479\364\332I?i'\006\r\345#:\270M\"\311_91\020\211\001\206z\177\002~c\320\353\274\306\240w\022\260\210\006\340N\322c\355\374\320K\336b\335<\215\262\231\23397w\252\326\231\262$\365\276\004\376\257\344\001\250\312\035\\\007\277?\364l^^\177\350\275\342\2375\207^\206\346\320\253\317\346"
+	.string	"\366\267\221\376\302\300*\275`f\262\234\233\032v\2322\230\256\352}\2639\364po\350\375m\201n\252&:\002((@\202\bY!~\213\342\2576!\330\277\257\252\003\376\332\200\252\007\224\265\223w\370-S\375\340o\016T\005x\360\327\004\224\250\035\274\003\377I\270\240"
+	.ascii	"\277\325Q9\370\373\002\025\370\273f\002\225D\035a\363w\360<\277"
+	.ascii	"\275\300\375\255\t\232\250\002} \300_{\"\212\317\371k\233\t4"
+	.ascii	"\277eQ\177\376\037\240\367\333\020\374}\243\372\324\r*\210\377"
+	.ascii	"\027\374\266\001\377\263\374o\341\277\225\377\\\376w\371\217"
+	.ascii	"\345\277\226\377[\376\277\375\277\362\3473\374\326\367\367\335"
+	.ascii	"\337f\376\206\341o2\177"
+	.string	"\343\375\035C\355v\373\273\356o\272\212\200\377;\277\315\373k\317_9\374\365\346\257\276\277\332\277\366\337y\177;\371\273\354o\347\337I\376>\3627\326\337a\177\177\375=\344o \177S\375\375\343\357\255\277w\374\235\365\367\325\337U\177G\375\r\343o\250\277\235\376n\3617\322\337\303\277\213\376.\301\337\022\370\233\303\337\310\377y\377\357\376\313\3757\341?\334\377%\177\223\340o\026\177\247\360\367\006\376^\361w\006\3766\376}\342\357\342\177\273\277\205\376C\371;\350\357\023\376\376\375\r\202\277?\360\367\315\337\367\357\377\307\373\037\346?\212\377`\376\177\371\377\365\377\304\377\265\377:yyyy?\215\207\337W\364c\020\025O\233\314R\002\346\250&o3\235\034\\\206\333\301\262\345\024#\257\327r\362f\220\255\320\305\255\232\251W\222\332\222\250\301\240F\027\005EL\275M7C6\262\212\343\n\321\325\316Y\355\372N\204\254\204\362"
+	.string	"v&\207gWV\367v\326\272J\006\204\036S^J\205h3+Z\304\352\035CC%#\b\025$\370=\260\236*\246\206\013]\r\262z\337\363\362R\345\352\\\343uFZN \311\311\\^.C\274W\003\277\302\325/\257`\016\246\306\265TN\212\361p\307\224\303\263\313R\313\236\277\276\360\032\327w;F\236\230\320\365]\317\213\327\215\244,\370\257\177/+\2279g(\232f^\026\341\364\232\246\273\347\317i\333\005\310\366\277"
+	.ascii	"<\320\314\311\266\253:\334e\246\244q\017\371\177\346lT\225\004"
+	.ascii	"\241\352\311\250*Ji\254*'\215\266\222\032\226\271*\2514\226\263"
+	.ascii	"\206ld\224<\301\314\032\224\306\362S>\312\362\324\271Y\225\314"
+	.ascii	"F\314\254!\033e\245\007%\243\252'\2451\345\223\006\245\261\252"
+	.ascii	"\247<V\2253d#\345\262\205Q^j\310cUa\362\030\363)\203\322\030"
+	.ascii	"\363Ii\254\212F\267P\212\363zb\273\262\352\321hJF\271\211iJ\271"
+	.ascii	"\314\360Tj2\363[\316M\206\224\227\005\310y\212\271|SF\365Y\321"
+	.ascii	"\263\251\310\211\222\331\201\251\310\212\231\215\236J^\314\234"
+	.ascii	"\275\212Td&\016\222\315g"
+	.string	"\316\352g\362j*\277@\312\331\002\246\234\223\235\2379\347d\316\331\267\234j\346\274B\006%.&\246\234\245x\230\362T\022\r)\347J\006w\366\2444f\305\004Bs\216q\345\244f\262\271\362[\325\022\217%\217\344\027t\230\353I\0051W\265\313\305\363\261\004\213\302\\\266\270\321$\251RDYo\315R\265\264\263\272\275\231c\2252\332\314zz;=X\266\340\310\351p\263\361\354\311\271\343R4\344J\231\035\027\253#+l\355\343\212\024\265\260\246\276\323\251\311\271\352K[]\253U\332Y\331j\013\257.T*Ll\325\251\357\212\300U\266\nU\325\222\f\360\342\244f\007\342\226uMi\001_\232\334\034z?\243Y\342\264^\231\261\032E\365\236\006\t3\215\325&M*Ze\326$\027\024)\335(_sG\246\232L\207&gf\030\327\224jV\241T'\365I\215R\317\252\224vV\264\212\364\272\254O\025\255\326"
+	.string	"\233\203\301D\205\250\262\025\252\214+1\256*\205VgT\031\375\224jf(\033/\231\213]\r\r20+\nne\322nK%d\226\3402\262\234%k+(\227\274\222\341\220A2\303\244\336\352\264W\316\344P*\311\t\343\352\242\246\344\256GS\2171`\030\311\216\224$\221\031>\360I\324f\255*\"V\217\264\2636\253\325\253\215Ju\236\257f\275\252`\375\224\312\220\215\342\314x@\334P9\212\362\325\273'Q\301j\217jD'\251!\347\034L\270r\316_5\254\235\025\354`\025G\345\321O2\021\202@\231\3139\203\350"
+	.ascii	"\342ByYm\351]\"\265H;\253\221:\344\225F\275q\236f\316NHtU!u`"
+	.ascii	"F*W\375qA\221\222\bS\312x@\200\300RX\230\222\325\273\2778\204"
+	.ascii	"\004\311ia\326\325\305\253\002\261\211!\365\2342\003\377^o\362"
+	.ascii	"q\264\266\374\013\325\307\343\256\026\233\f\260z\177\227\360"
+	.ascii	"\257\021\376\315\370$~\240\312\243\352\250,\364\223\354\004\233"
+	.ascii	"\223\271\277\356\250[\355\254<\252\326o3g\262(\225G\315\321f"
+	.ascii	":\311fv\322\300\023\252)\036\020:=\272\214\200\365\356m\025|"
+	.ascii	"\205\030-i\253Y\025\353\027\t3''\256F\232W\275\267g\370\266\f"
+	.ascii	"\337\036\301\267`\370\326\013\337b\341[&\356lg\340\346\261K|"
+	.ascii	"\233\2043\304\200_\313`\017q\270\306p\361"
+	.ascii	"\003\214\031\343\211_\251`\021i\3706\311\236\340W0\374\346\213"
+	.ascii	"\245\"bg\356\352]r\301B\225\226V\213W\027\001g\365\336:Y\035"
+	.ascii	"\2359a\372U\201\351\306\3501\335\314R\314\244\030\003PQ\021c"
+	.ascii	"g\227\225\246z\204rP\261]\030\2771\316\226\247\344\254\312\254"
+	.ascii	"\201@!\302\244\336\373\364\013\365\327\370\272lYC\002\003_\247"
+	.ascii	"\337%\r\025\276x95\37558XlVtZ\340\353([\264\270K\215$;\361\200"
+	.ascii	"=\311\301\270!\343\202N\311\305\357\222\0261.ot=+Nf\360Z\300"
+	.ascii	"?\272G7\211\207\231\f\243\001\221\344\027\273\236\336\2279\030"
+	.ascii	"x\027\3517i\002N\036\311\234\254\242[T\351@ \313\312\247\236"
+	.ascii	"\264\033p\\vy\351B\b\r<\236B\354\360\177\2237\331_\2562C\316"
+	.ascii	"Vwg=\037I5-\370M\244-\224\333g;-\024\233g\225\244\262\n!\236"
+	.ascii	"L\205\350Y\341\261\364\2527\206\246\221oiF\02325\374\376\322"
+	.ascii	"b\267\274\321\340b\335\276\256\274Y\270~b\201\020\204m\316\202"
+	.ascii	"\261uP\300\314\001Y\273\232\303\272Y\341\302\263g\254\031{g\313"
+	.ascii	"X\030\332i\355\354\227[,6K\363\007\262v\266K\033\2271=\236:W"
+	.ascii	"\313_\b\203\263u\366\005Kw\363\304\207\226(c,\231v\332:2\020"
+	.ascii	"\035r`\360b\027\326\243\263b\316\\\320H\252\327\206\351\261\265"
+	.ascii	"\245+\034r\355\264sI?\316l\325k\343\376B\213\244\213\245\247"
+	.ascii	"\305@3\322V\205\2173\205\217\343d\275\340-s5pZ\340\343\034\341"
+	.ascii	"\343d\374\033\030\354X\225:+\326\315LK\333\213\2422\270\366\364"
+	.ascii	"\206\236e\263V\354\225\277f\247\310Y\216&r\370\266\215\004\026"
+	.ascii	"\2564\251\367\332*\267kk=\270\230\340\360\255\013\226\312_\243"
+	.ascii	"\363\266Uv$\013\276m\241I^\335\214z\255\032F\272\231\362\301"
+	.ascii	"\246\006\024*\032\365\336\252\375\366\314\242\331\264\023r6\""
+	.ascii	"A\336\2312\365Z)v\312m\232\215\222m\032\007\314\234\2256m\307"
+	.ascii	"L\316\312\235\356\f\2723\270E\254z0\351\335\337\230\341\2775"
+	.ascii	"\207^N\035\320\255\331\215\025\265\271\233 M\226X'}\007\005\344"
+	.ascii	"c\356\246\n\377\346\005\276]\322\266\254ly\207\201\276\336\254"
+	.ascii	"\022\253\304:;\370\360}M!\273r\322d\361\332b\322\226$I\337\211"
+	.ascii	" \226m\2304\233\366H\345\3629\263\300\314\335.,\243$G\356zGa"
+	.ascii	"XD\274pX\230\005\"B\346\020\225\203\350\236x\301\262El\021\373"
+	.ascii	"\305Sf\211C\004mF\024#\267_\266\215\205\2561\262+\326%\225\243"
+	.ascii	"\336\3338\341\333 m\2078\355\220&\353\311J\245\006`M\033%~7Y"
+	.ascii	"\317\313\313\002\021a\fr\313\b\026 >\272\254^\274\341\333\036"
+	.ascii	"m}\330,\373\243\236Q\241\203\250g\026\374\232*g\266\336N\273"
+	.ascii	"\325_@\300\312\371\351\303\013\314\0323`\\_I\360-\013mw\330\035"
+	.ascii	"\225N\0031fM\027~W\272^\016\233\225\303b\351\320a\261:/\303 "
+	.ascii	" \252\211\234\311[\032s\213e\341\204<{\324\373\032,\374\032\031"
+	.ascii	"W\366\252\032\335$\222\374d\223tD\307\234]\316R!h\312\214\301"
+	.ascii	"\361\345m\206e\316\260U\275\234\273\311tZ\336\270\255\252)j2"
+	.ascii	"\222fW\260+X*\234\254@L\207\f\006\216\0306n\251zN\307k\013\355"
+	.ascii	"\253^K\303\326\240q6Y9m\r;e\203\346\004H\230\264-_\230\224\336"
+	.ascii	"\246\302\210\310\325{\334\206\217\233\340\337\312\260K\033U3"
+	.ascii	"\b-\224r\206\022\221\327\304E\360\261\016\030\355\2640z\216'"
+	.ascii	"'\303\210(\363\224\303\263\3035\236\354\322B=\r'\227\230I\322"
+	.ascii	"\2319\354\002\3377\306.\331%\353\244A\236m\272u\252t7HS\232\220"
+	.ascii	"z-S\233\331\240\215a\211Q\257}Q\351\252\332\330[\221o\r\277\347"
+	.ascii	"\332*\311\331\026=\347\201\305S\016oH^6C\334W\206\357\003\202"
+	.ascii	"\037\242\355Q\225\263HO\273\231\354\356,\207\270o\n\337\227\214"
+	.ascii	"\3411\330\"\234s\356'M\251\036,\205\f\006\234U\336\026\325\344"
+	.ascii	"\232\220;\367*\202C"
+	.string	"\240\021\205\2410%\016q\202\210\204G\017\250\0218\024D\203<\024\211\210\031R\214\200X\274CC\300\3401\025\242\360\203\034\nm\220\002r(\034\332\200\203\022\277\022\036\244\360\203\006!\207\202C\341\217\361\210\374\371\031\001\321\250\"%\016})\200\350\320M\217Cb\220&E:\024\032\207zW\341C$L\207H\343O0E\212\242\260Q\221\002\211~\206D\"\"b\320\002\022!\b\n\221\"\240\340*|(`\302\b(~RT\310\bL=\204 H\0342\201\032\211&vX\024\211&*H\257\302\247\210$\032\205~@#\260\370\023\324 8D\336\fST#\315\361\207\223\376\206BE\232\241P\321\242$\020\036/\213\"1x\215i\321\006\241C!\341\020\320\027\204\036\2217\210\036}7\376\204\212>9F\240\212\340eaL\217B!\024\003\033D\370\004\241+\200G\016DFb\n#Z\024@\320\020I4F"
+	.string	"\rB\246\302t\310\001\034n\216\350P\220E\212\242\bAh\030\304AS\242\211!Q\230\002\215(\b\207\200&\216\302\0164%|\216>\"4=\262@\361#B\242\330AS`P1\003\030\034\203\320\240\035\033\021>\251\021X\364I\203h\212\236\340\200\002\n:\250`\b\230\022M@\215\0354\214\360a\021\004D1@\264\201\207\204O\nh\320p\204t\210\032\215\310\240\005\277!\004R\364\210b@\250\330\001\375\241)0E\201,!\275"
+	.string	"xp\b\024\006\241\025\b\201\305P\261\b\264\340A\241\021\035\242B\370\034\224\330\240\204\007)\370\356\301\007\">\020\321\273\007\037"
+	.string	"\001}P\002\b\277\004\220\005\3629\2420\242\351\220\020\002<\350\017\305\361\327K\257\302\007\001&*@S\340\02028\004\f\326\244\302\"\212\024\350\t\264\310\302\204\337\b%\240\270A\203C`z\034\nq\372\263\300\bw(,ax\f\366\204\305\243\275\n\237#\022]!4\006u8\376L\214\030\341\306\304\210\021jz\276\340\b\241E\376\360\361w\342\210D\341\306\267\002\r:\"Q\350\245H\314\0028\204\006\375\212H\234\246F`z\304\306\264\204\340\020\t\201\242\005\212\310_\212\n\365V\240A6\035r"
+	.ascii	"\321\b\f\301\207\032\221)\320\210\026\211P\023~+\320\0235\351"
+	.ascii	"o\004\211t(\364\r\021\211!\374h\322\253 \300\211E\324\370\223"
+	.ascii	"\022\211\306\237\233t\bx\374\t\tS\f\211&4\240E\026\351\021\211"
+	.ascii	"\302N\372\023\002\232@\024\372\206\307\340OX<\342\240A\341\n"
+	.ascii	"4h\347xD\215AA\300_p\2040\003j\004\216 \310\bT\221\223\376<\360"
+	.ascii	"\245C$1\370C\207\212D\300\243\206\024\305\241\037z\024\022\207"
+	.ascii	"?\235\364W\002(\035\n\221\370\nP\200\t\017\031 !\0028\350cDS"
+	.ascii	"\224\350\347h$\036\207\350\361g(\004\022\375\004\215\307\037"
+	.ascii	"\237\001\f\241+~)\202?\242\021\210\302\315\230u\352\335x&\205"
+	.ascii	"$\271Kc`\356\316 9\242|\362\324\245^8|\346\202\235\223z\357\327"
+	.ascii	"\375\272b5I\033.+R0z\256\330\rk\242$\303t\303.X\r\024\226&Kb"
+	.ascii	"L\034e\352\232\315\2333\033e0\330\254\327\222!\\\210\304p\332"
+	.ascii	"A\201j\252%\271\321\020r\261|]\312!yA*\035.\213{.\001\261X;-"
+	.ascii	"l\304\301\340E\246\006\214[]\262\353\f\326\212\302C\362"
+	.string	"\243\306]\031;t\374\360q\223h\334\316\304\320\302\325d\275\250#\030\232\324\036\266\312\r-g\251\267\371\205\343\344\244\305\254\367j\331\023\230\311Yy\265\352\345qw\374j}\307\3676DIyY(\322\261\022\003\266\243\336\250_\034Q\027\353\252\345\214\264\324)C\205\214\f\035\277Xf7\336f\350\250\367\346\270\331\241\034y\323\272\372m\242Jv\t\251\367\326\270U\327\312\nO\311$\207\177o\310\211m\275\325{\231\030I'\313\207\273\304\304\3562s\246~\\\341\250\367\332"
+	.string	"\372\245\242\231\261vC\253\336\233\336\320\2733.\215;E5\005\345D\303\277+\020\t\342E\303GA\226\333\335\327WK\351)\223uT\365^\251\032\250\244\036\001\203v\250r\351<\007\323\020\241\221\221\021\031I\222\2441\022\n\020\204Ci\034)2>\022\300$I\2162\307\320\210\210$)I%\355\035\024\230\201E\002\037\256"
+	.ascii	":\304\323\276Po\005z\312O\210A\204\265\356\310\021\274y\336W"
+	.ascii	"W\215 j\312\f#?\024\337\341a\024;1o\007\301\240\330zrV\321\253"
+	.ascii	"\364\230\217\037K({\243\025C\302\222\213\313\336\b-\307($\246"
+	.ascii	"\202\333\367\203\213\265lR\fx50\204o\203\007\275\332q\363\001"
+	.ascii	"\367t\314=\007\217\375m\306\317\244\212\024R\233k\263\247\344"
+	.ascii	"x'\272\341Au`\005?\325\330\203\315\226\202\342\275\363\306d\021"
+	.ascii	"\347p\300ns\370\21614\361@\334\251\361\006\323vs1\t@\337(6\315"
+	.ascii	"\343\033\362\304\202\333\225\345\377\252\037&(.\234\266\343\254"
+	.ascii	"\317\244mj\372\253Aq\300\342\314\007\347\2474\210\206)\007\335"
+	.ascii	"\210\351\230\025\346\200\013\311\035\340\0168+\370\244\313\177"
+	.ascii	"9P>X\234M\301\220\006\3662\360e\261f9\317\fa\037G\342YD\027\314"
+	.ascii	".*\274\337\346\001\374\304\223p\316>\317\006\365@\033\273{\324"
+	.ascii	"93\362\341\340\033\277\005h<\316\355\304+m\212@\231P\202\217"
+	.ascii	"\371\217X}\344x[\262E\214R\250\f\327\016\002\263\302\361Mg>d"
+	.ascii	"\315\017\263\222zb\214\223\035\333\347\320+\036\025B\273#l\314"
+	.ascii	"e"
+	.string	"\341\204\265[*\001\203M\345\370R\016\t\341v\3708\335.\330\310|.\270\261\036\001\226\214\325\347XL\315\021\353\366\277\324t p\200\006\b\207\207\005\022\025\206B\036\236D2G8<,\220\250\220\344\016\300`\t\246\341\223\235\230\327\264pJ\365\256\306w\347\364\264\216\022\367\327\277\222\034D;\266c\033?\003\341q\211\350\313X\020\241\3410\212\262\017\271]P\315%\361\013\363\026\033\031\212\347\243C\321\b\312\343\253\236\007\220\302\033:\206\032\351\266B1d\235\257\251\320\310\335\263\356\363F\276i\n\275j\346\201j\341\371{*\333@\rQ\205[\356\323\237/\022\247\246{;<\022\305\226m\320I\215\222\330@\374\346\346\215\326e\034jE@\225\321f\343\033\224z3\321\221\246.\2257QsxD\255o\300\2028@\021\"\002\267O4\370]]\274\320X\3676\007\032\270Q\276\377\222\345\255w\226Wh\307\317K"
+	.ascii	"\316 D{\330\304\265\330\306\321\356\251MZ\021\224\2063@\374\271"
+	.ascii	"\177\316\3619\367\317\177\252u\325\025\274e\"\224\263\023tAt"
+	.ascii	"\221]%6~\265!\272\354\303\244#,\347\360F\334WDcOY\321\306\247"
+	.ascii	"\257\316\314Z\363\254z\035\030\270\204\b\f\333&m9\006\25256X"
+	.ascii	"\201\356\037\b\032\201J\271\305L\311\230\225I\311\251\003\235"
+	.ascii	"H+\240`\217\205v\222\207\037\013\013sm\370\3714\244(\302\347"
+	.ascii	"\004\254\305\232\017\204\b\270xy\350\017\355\034<\366\304$\271"
+	.ascii	"\234\322\262:\203\250]\333\370`x\330\304\320~t!\317)r\034\352"
+	.ascii	"\320Z\364\350\007\211\255zN8\243=t\035u\354()J\212\001\276\276"
+	.ascii	"5\307\257E39\231\321\351\361=\350\027\262\273x\267\200\353\201"
+	.ascii	"]Nr\2620\251\330\016\232\324z2\257\264\037\373\340\267 \202\275"
+	.ascii	"\244\3505\237\225\271\245Bs\013\016Q\021\316\351\350\354\036"
+	.ascii	"\200\321J7\202\254\331\021\230\330#\002!(\031\336\3461'\303@"
+	.ascii	"Jc\3323\266+\352\376\024\007\270\366y\235q\265'T\264\275k\216"
+	.ascii	")\203\226\310=\032\350UAJ\231P\220\252"
+	.string	"\004b\027\220\206<\361\001\t$-\361\304\335\340C\256(gQz\2118>\004 mH\001\373j\272(\324#\032G\357[C+\223\273\342\227\231 \300\262\211r\355\233xu\265\016c\025Nv\037\004\336+\021\354\260\001\002b&\360\037$\021?C\r\327\360s\252\nG>\256\320ya-'\tW\306\236\247*#4'\213)\177<3\1778S\037x\252\373/(\254rh\342(9S2\013\322^7G\b\343setrZ\003=|\003\275K\217\2661AS\373GV\302\276o\r\273\244\351\260\277\342\204_\231\246\254\357\3309\352\022\362Y\363 \330=\007hI\216@9\263h\220\350\325\315\311\270\241\017\302y\245BH\341\016N\022\235?\347\201\375o\352\234F\204\317^\245\266\b@ \317s\357\327\365\265\351\245\373\304\322\2077\005\365\177\026\254\363\307\214\242\3303\261\202C`P\264\246\003J\200\227\025\320T}"
+	.string	"[\215\206\334\004\317\003n\025\271\253\334\340e\265j\347\212\225\033B!\300\254\367\332\275\303#\330\352h\241\364\345\342c\355\375\271\025\366|\204\t6"
+	.string	"\226\332\027f\340>\034\235\345M\b\321\200y7\231yL\306\225\202e4o\020\030\207NH\024\271\331E3\0348\376j\036\222\003\311\244\302\3655\354\303\030A\214e\032T\316\256\371H\211^\200\217OW\350\350\031+\355|\031_\2017\017af\237\3359p\261\217\\\376\373\346Y\370.\037UPh0u\024\340_DO\360\0340\315\273O\300\314\260\266\3465d\240\273}6JC\357\315{N\2603h>\2114\272\204\361"
+	.string	"\025\0311\311q?@c\265@\f\272>\272\364jFN\006\253\260\244R!\340\305\214W\327\013\030\f\300*\316M\215\233<k\213s\264\213\346?\267\034\310\363|`@?;\303\t@X\206\261U\360\255\035\3124\263\006\364\t\375J\031Z\217\200\254\266\242w\262#\3557\242\2079\364t\326\216\301\237\233nb\306\332\206\261\213\314\375\215Nz\361\232\343p\256\202\261\262\3758V\rC\347\324\343\3442"
+	.ascii	"\342\247\021@\2719??\241\242O\231A\003\233\262\2234\240\020\203"
+	.ascii	"\\\3618\005\207\205\305\201\215\225\242\032- o\261' \202=\266"
+	.ascii	"\360\227\242\0136|\316\313\354V\304X\215d\246\024\260\340$o]"
+	.ascii	"\347\361\227\006\020\355\356b\200>g\002[\023+\200\275\255\234"
+	.ascii	"Q\313\305\353\213\253!\027V\\o:\275\203E\371c\237c\275\003|\203"
+	.ascii	"\351\217\277n\260\263\267\333*\007\234\216\312\262D\233\r\326"
+	.ascii	"\020*_A\376;S\257_`\362\204dv\312\2411e\177\306\217\003\373\003"
+	.ascii	"\333\236HX\240/\031:\204\205\352#\376\344\247\253(\317H\270A"
+	.ascii	"\246o\325W\t\217\206\375'\373M\360@\272\235\036\215f~\322>\267"
+	.ascii	".\226\355~\376#\357%\307\016\252\217B\365%\311\200\343M\2729"
+	.ascii	"\302MJ\237\024\326(\230$j\212\374\031\370\\\035@>WqN\371\\4\013"
+	.ascii	"\246o\030\016?\250\374Gf\3774\336\333\346z\2038]<6|\234n\355"
+	.ascii	"\377\030\216\235@}@\361\323\356\231\344\213\263\216\373\\\232"
+	.ascii	"M\3621\336\363\200g\364u`t\261\302\t\343\243_\347,\237\034\273"
+	.ascii	"\270F\232\217\031\023\375\235\325\022\307\0303\303>\276\026\\"
+	.ascii	"p\236\341\355\341\335\216\371<\325A,w\356\\A\b6\017\331\252\025"
+	.text
+	.section	.gnu.lto_.symtab.356052e7c1ad26fc,"e",@progbits
+	.string	"pgResetFn_barometerConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\001"
+	.string	""
+	.string	"baro"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"P"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\001"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\016"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\001"
+	.string	""
+	.string	"baroDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\001"
+	.string	""
+	.string	"isBaroCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"baroSetCalibrationCycles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\001"
+	.string	""
+	.string	"isBaroReady"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.string	"baroUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\001"
+	.string	""
+	.string	"baroCalculateAltitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\001"
+	.string	""
+	.string	"performBaroCalibrationCycle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\001"
+	.string	""
+	.string	"barometerConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\001"
+	.string	""
+	.string	"barometerConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\016"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\002"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\001"
+	.string	""
+	.string	"quickMedianFilter3"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\002"
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\002"
+	.string	""
+	.string	"powf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.356052e7c1ad26fc,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
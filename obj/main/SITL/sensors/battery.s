@@ -0,0 +1,1418 @@
+	.file	"battery.c"
+	.section	.gnu.lto_.profile.5a05a1340a43bf59,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.5a05a1340a43bf59,"e",@progbits
+	.string	"(\265/\375`d\001=\f"
+	.string	"\024\020X\002"
+	.string	"%"
+	.string	"\337\374\225\265\016\034\002"
+	.string	"\002"
+	.string	"\002\001\002\002\002\001\002\001\002\003\002\004\001"
+	.string	"\002"
+	.string	"\001\240\342\234\212\n\002\003\004\005\006\246\300\251\343\t\002\007\b\361\312\235\227\007\b\005\002\006\n\253\353\330\347\r\006\002\003\004\013\f\252\315\215\326\r\004\002\007\002\004\016\371\235\265\200\0060"
+	.string	"\002"
+	.string	"\003\001\002\001\017\352\263\360\321\b\020\021\354\206\342\366\006\022\234\236\237\233\f\b\002\t\023\303\232\323\226\004\024\341\354\356\262\003\020\n\002\004\025\026\264\312\272\256\005\f\013\n\002\004\002\f\002\r\027\032\251\331\204\340\001\002\033\274\272\250\314\001\001\002\004\002\016\002\017\003\002\004\034\373\325\227\324\f\016\002\020\003\035\303\366\326\240\b\006"
+	.string	"\002"
+	.string	"\036\200\224\310\322\016\002\037\300\253\277\314\017\002 \317\356\361\267\004!\350\300\306\254\005\002\"\207\312\266\244\016\002#\320\374\270\356\001$\325\241\220\227%\265\224\221\027&\335\223\302\325\004'(\240\342\234\212\n"
+	.string	"< P\202A\320\334\rf\212\204\321\366\n/3\025\2301\266\301\227-\031\213\016\026\320\025\346\220\301\254;\023\0136u^\267\300\037\205\231O\t\032\266\177\367\314Z\313\373\336\f\224\320$ \207\001/\300\003\300\001\360ZV\372\024cW\n\337\270\026\376,8Xp\023\327\304\034\340'\300;\001(\003,jf\021\200E"
+	.ascii	"\326\317\270\341V\3074M\304\355\2547\332\210\371]v3\264\2030"
+	.ascii	"\234\210-\356\307eX\207\346\334"
+	.text
+	.section	.gnu.lto_.ipa_sra.5a05a1340a43bf59,"e",@progbits
+	.string	"(\265/\375 \231\315\002"
+	.string	"\202\004\r\023\240]\016\377\377\377\377\303f\267\360\314\034qs\337J\222RNkV\223\232\323\224f\004\355\343\314\006p2\373\037\270$\023\231\307\032\253\027\223\330a\205U\361\n\017"
+	.string	"(15\343\362\214\264\022p\346\b|\200'\024\202cH\231"
+	.string	"\013j\022\202"
+	.string	"4/\345\254\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.5a05a1340a43bf59,"e",@progbits
+	.string	"(\265/\375`\271\0025\013"
+	.ascii	"b\216360q\222\016\200)%\276`N\226\016;\031\357$\325\365H\301"
+	.ascii	"\374\207\236\273A\021\021\341\321\315<#E\207\026\260@i\204\357"
+	.ascii	"\377Ly\267\0207;\353\355=\354\336-\005?\224H\016\243\006\r\226"
+	.ascii	"\232\022\317\"\304>\332\006\314`\323>\222H\373@/4W\332'\201\250"
+	.ascii	"\366\211V\030[\016\231T\233T\235_\003x(\223Q\224\210._pLB \006"
+	.ascii	"\241F4*\036\251\320\007[^\2702\250@\334\262s\301\273\276\313"
+	.ascii	"\231\215\233w\201oY F*'eb\315:\313\377XY\227 \0351\034\004g/"
+	.ascii	"\001?\271\\\265o\340\317\t\261\223g\314\372\005\020u\375\226"
+	.ascii	"Z\246\\F`\264\257\177\0347l\333\3539<iK\201oq\230\323\266\364"
+	.ascii	"\b'IC\2501I\212D\252B;\033kp\002\031*3\017\022`DI\001\004\225"
+	.ascii	"\200\n\224\340\324\304\\\376\036\270\fq\325\322\361\202v4VV\240"
+	.ascii	"vo\220\361\351~\334\205\321\241\240\277\001R\272\2773\323\310"
+	.ascii	"p\006\332\f\304\226P\302\351}n\faV\016.\310N5\261j\\d\300\354"
+	.ascii	"F\245\321\311-+\203\361\252\002\226\025\257\265\375\246*>\377"
+	.ascii	"7u5\304\t6EH\202 m+\320\205\275E\013>\252\323\377\n\373o\374"
+	.ascii	"\316\336\035\331\246_\036G\352\237\327\363\026\374\352\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.5a05a1340a43bf59,"e",@progbits
+	.string	"(\265/\375`\256"
+	.string	"\305\005"
+	.string	"\002J\036&\200K\322\001\235\004=\201L\036\006\236g\020(f\212\301\272-\t3@&\266m\233\302:\272i\330B\262'i[\246\177\344!\377x\3077\236\361/\024\177\342\021\377\301\341\363T\222\210\254\2526\226\351\275\367\272&\261\256\273\006\241s\332h\212\376\302C?x\301\315\264\230~\357$q\271J\331J\211\275\202\213\232\200\016\0165\360\200o\255uQ\254\213\352\254\224D\374\374\r\367\022\031"
+	.string	"\b+\310\243\340\260\200\271g\200\201\260\260\271\311bQP\305\013b\306\300\254\263\266YU\333\301@\305\023\222\202\007\312H\301\272L!\307'\211\250\016\376\264\b\232"
+	.string	"q\321\314\255"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.pureconst.5a05a1340a43bf59,"e",@progbits
+	.string	"(\265/\375 D\325\001"
+	.string	"B\204\r\026\240\3250\006\177\372\377\377j\325\003\376\277m\333=\231n\265-\2052.\360\200\003|r\311#\007\271\3079\3368\343\026\2278\342\2073\\\341\204\033\234\340J\251\252A"
+	.text
+	.section	.gnu.lto_.ipa_modref.5a05a1340a43bf59,"e",@progbits
+	.string	"(\265/\375`i"
+	.string	"]\004"
+	.ascii	"r\305\017\025pU\r\007\374\377\377\277kh\345\226\353\357\336B"
+	.ascii	"\356\037K\231\002\003\226W\256<\3677\307\226b\345\t\231r\203"
+	.ascii	"\260u\262\366t\030_\022\253\\\225sxa&\324\211\312\223\316S~\032"
+	.ascii	"\\\314@$ \340\002\0313\017f1o\254\030X\3019\211%\033J\320\302"
+	.ascii	"\3075\215\230\221\027M\307I.\207>\206\025_\030:\330\177\233\203"
+	.ascii	"\2131\016\254s,\355\f\324\364\223\345\035bD\203O\263\007\347"
+	.ascii	"\021\366\"\364\205q2\260\255\240n"
+	.text
+	.section	.gnu.lto_.lto.5a05a1340a43bf59,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_batteryConfig_Registry.57.5a05a1340a43bf59,"e",@progbits
+	.string	"(\265/\375 \230u\004"
+	.string	"\004\ba"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\203\334\361\031\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\364\006us\350\307\006uq"
+	.string	"\005\001\006'\001\024\213 ?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/battery.c"
+	.string	"\004"
+	.ascii	")\"\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_batteryConfig.59.5a05a1340a43bf59,"e",@progbits
+	.string	"(\265/\375 w\r\003"
+	.string	"\244\004j"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\001\n\005\001\006\177\001"
+	.string	"'}\001\002\005\001\006{\035\001\036#!+?\202\210\200\330\001yw\305\001u\304\001s\303\001q\302\001o\301\001m\300\001k\277\001i\276\001g\275\001e\274\001c\273\001"
+	.string	"\t"
+	.string	"/\"\340\356Tm"
+	.ascii	"\261\227\273\232\026@3)\242\f\240\b"
+	.text
+	.section	.gnu.lto_batteryUpdateVoltage.60.5a05a1340a43bf59,"e",@progbits
+	.string	"(\265/\375`\324\001\205\020"
+	.string	"\246\335lG\340\264&\035$&\363\253.\214a'|\201\n(\240!g\030\006\004\033\216&\330\020Dr\335\307e\273\355n\255\216y\374\006\"\275\017cz\353\251\2702u\002A0\021\300"
+	.string	"\224C\301\304M\335\257,e\322\366&[\246\024X"
+	.string	"R"
+	.string	"\\"
+	.ascii	"/\315K\355\004\346\245[v\221\317l\366;B`v\020\355.\027c\274\365"
+	.ascii	"\321\224Z\324\226\237@\206\017P\346\372hS\361\tSB\245\202 \355"
+	.ascii	":\327n\2600\002\312R<j%\241\027DH2\230\266`&\b\212\023YLu\024"
+	.ascii	"aw\255\240\314\304\275\335\266\213\355\007\266\032\b~\216\353"
+	.ascii	"\370\374\233K\273\274\350\301K\377e^j\204\020S3\203\223\363\322"
+	.ascii	"\"{\006\323\b\303\276\266\273\353Xc?\347\237Q\035U\255$\223\f"
+	.ascii	"\021\022\224\241\335\230\"&\033\312\0374H\266\257\366q\034\247"
+	.ascii	"\365\234\021\006\260\353\302\347gw\326\300\f\266K\004\001='\302"
+	.ascii	"\030\315\246\004\340)\n\025(\211P\013m\200~v\237\323\266\373"
+	.ascii	":\350\367\274\207\206\r'=x\232\250iw\035FD!\211\3502Im\017)="
+	.ascii	"\350\023\236\241\020\026]\336lVfwS8\350\320(9\342\322&\237\001"
+	.ascii	"\316\204\361\"\246\306\002;Cb\272\304\366\352; \266\335\230\203"
+	.ascii	"\337\205.\325b\201\245\352<\317\005%\300(\225\020^\307b\235X"
+	.ascii	"\270\317[}\252\356\343T-\247\024\207\362>N\005\305\253\017\235"
+	.ascii	"\307\261V+\217#\315^\3276\326X\202\215\360\025a\243\003jO\240"
+	.ascii	"\020\243k\352Wf\214,\017:\220\025\377\306\025L\246y\031\243\254"
+	.ascii	"\301C\311\nY\002\3721\206\f\001& \220\002\241\261\344\006\263"
+	.ascii	"B\217H\214k(\020{sv\361_\003\274\354L\304:\317!\327?<\346\211"
+	.ascii	"\3662\030G;\333|\347\215T\342uC\201\363r\264\277\002F\024\260"
+	.ascii	",\013j\210\330\365zk\333\250\256]\304pt\300%\033\022\035\215"
+	.ascii	"\324\310L=\335\277\033m\t4\202\200\002"
+	.text
+	.section	.gnu.lto_updateBatteryBeeperAlert.61.5a05a1340a43bf59,"e",@progbits
+	.string	"(\265/\375`@\0015\r"
+	.string	"\326\327VB"
+	.string	"q\234\016/\266s\264\312z\264\004D\346\037\243\303wx\272\b(G\227/=\007}\260\222a\023\326\025\361\217\352)g0\253\252t\243\rG{W\255\377\227\376\b\201G\225@\245\371\002\374\337\233l\231RD"
+	.string	"A"
+	.string	"E"
+	.ascii	"\237\277,\262O\036~l\345\224a\002\t\216\335\305d\207\213"
+	.string	">+\251\"_AL:\217\3734P\243z\310+\021`\213\316\273pI*Y\004\300\024\310\3053I\255 \330]k\347Y\270\255\333^`\373\200\375\017\001\021@\372\356\323\007Y\237R~\344\252a\003\352\023\3010\322\321\016I*O\366\3458\216)\226\036\266\252\245u\2611\003Cc\227\302\230c\305\371\002\204\355\373\"\037\t\035ee!cw\257O;d_\001%\311\371'~A\211\234\3528\230\002cH\025\376\n\265vk\002C,\007\022\037\205O,\273\334\277\377c}\352\200\225p\372Pv\027s\023\376g\371\330\n\033.&\344\n`\270HA)\351\016\373\341I||\017\016\336d@\032\307\343\3210\3006-\333:\234\r\3534\3208\3006\332\206e\n8{\300\3210O\226i\330\025\216^\255\364p\202\033\342H\222\374\022\177\265\273;+&)\036\240$U\001P\3133\313\206\260\351;\013(\031!\006\036"
+	.ascii	"3\241\233)\006\340\005\017r\201\354\300aS\r\017H\261T\342\340"
+	.ascii	"\312g\006\272\306\022 .\350\307S9\024\335\3511s1\263\215d6\026"
+	.ascii	"Rm\327\0055\240L\27441\3169\230\302_\016i\032s\252Q\340D\347"
+	.ascii	"\226'"
+	.text
+	.section	.gnu.lto_batteryUpdatePresence.62.5a05a1340a43bf59,"e",@progbits
+	.string	"(\265/\375`#\b\245,"
+	.string	":M\334\020C`\246\316p\013\344\262\345f\352(z\244(\0027\220\022\345t)\030p>)\016\312V\253\303\260\260\206#|\261\357I\034\371\302^\265\341<\331j\f\353\022D*\2274.\354\240\325n7\242M\366\336IJ\031\373"
+	.string	"\335"
+	.string	"\377"
+	.ascii	"g/z\366\236\357\375\331\333\357\345\007IyG\037H\267\257Y\256"
+	.ascii	"7\232|\326:\224\313\021f2\2671+\271\373\334].\303-\220\2370\024"
+	.ascii	"!3\237\230\306\226\253\331\007#K+\225Q&6J\031=\271(e\224\331"
+	.ascii	"\215\337\026\250\\Z[\2661\201\2402\272U\r\204\334\006\203)\306"
+	.ascii	"r\275Q\265\246\245-o]\227\t\030])\225\321\025\356\306\341\245"
+	.ascii	"\332\312qm\304\270\274u]\251N\204\205<\024\024\n\002\002\376"
+	.ascii	"\374T_\212\236o\341\262S2O\321,\006\017\251qP\355\rH\013\005"
+	.ascii	"\035\1774\020\232\262#[\231\217\006\372\"\240vc\350\b9;\362O"
+	.ascii	"\223\2203\036\374\343\001"
+	.string	"\307Mle;Ze+3\266\357\214:\222\311\301h\312z\234Fg\206\274!v\252\2421:<\201f2\372Bfc'\323\272\256\374\306Mf&\326\355\213\260\256\353v\321\354\214\227\210wY\301\356v\330\365\031\003hJ\230f\306Zo\325\377F\360\226\022\352\272\2169X\316\302ZL\234\270\272J\031U\377\032hjG7%\267H}\177:_!6in\221\246\367\235\207G\364\351\245\354\216\236\207H\304\272\271\377\311T\270\212\326\362\332\276\300\302J\031\375\331\356\316\310\3573qo\263x\212\226\272\256\253\203\345(,%\305\362\032\243\253\202\253\271\310\3502\327\237D\013rtS\206usw)\326G\356\362\233\315fs\237\266\033\305m\274P\254\344}:{\0210\223\367\200\332\353\224\3666\251\275L\276^\003i\357\022\367*qo\322{\221\336[ \355%\360\336\243\367\016H{\005\274\327(\355\rp\366\026\235\275"
+	.string	"\316^\242\264w\210{\203\276^\241\2637\350\354\005z/0\355\375y\357/\355U\321^\037\332\233\006\004\276"
+	.string	"\n\037=\312\243\273\321\252\200\325\247Xg\300\215~\364Tn\310&\340\003.\360\035\033\001\347\270;\245\321\331\313\021)\304\275"
+	.string	"_\266c5\0302XY\035x\200O\355!\356\235\3414\033.W\254\303!\255\003\236\345a\202\367sd\002(R\300\374\236\266j\321\223t\020a\226)z\324[\216\270'\305"
+	.string	"^t\244\270\341\221\350}"
+	.ascii	"O\257\f\233\f\235\210\216\314\320\031\216\317$B\360\222;'\343"
+	.ascii	"\006\022\225a\244\301Sh\003\365\247\007_Ud\216h\0243R<\326\371"
+	.ascii	"\216\334>\0230\343\205\301\202J1\202\223\2359\244B?B{c\336-\317"
+	.ascii	"1\030\016\036@\200H\031\025:\212\346M\322\210\340P\257Z\233#"
+	.ascii	"\356\245G.s/\327uE\237\026\364.\323\274r)\320\203\236$7dS\017"
+	.ascii	"\364\364\270"
+	.string	"\266\206\327u]\317#\027x>\343a\322\375\034(\202\275t\3719\2030;=\374#\367w>\204_[[YXh\326\026\212+0\017A\260\253\t\\]^\026\262\264\256\300\266\272B|\245\030Z\254)\027^Y``W(\250\276\274\272\276Vd}Q\255Hq\305E\205\345\365E5\245\264],\262\274\250\300\272\272\274\250\200\3130>\327\247ip\253\013\273\330r\327 \221\224S\2543\344\364\335\235j\262b\323\235\354zF\323\321!W\222F\246\177\351\241pIPm]\327\007\333c-C\230\024:\021\272\t\335\f\234i\256\303\f\034\035bE\2171,x\3446cH\227\216\202y\327\024\276Y-\035Ub%i<\327#\367p\037\t?\261(yZ\251\236\317N\024&x\030\322<q`\360\302\334\261\203\003.\017\217i\034\211\214\t\022\303J\247\360\364\244+\031\241\236\364\007G\344\020y\204u\263\215mY\226"
+	.ascii	"\035\031\206\205\016D\207\033f\233\261\326S\323\233\223\005"
+	.string	"\270F\247\374\251\374\224\262\032\235\r5\352\007N\266\2134G\302\031W\340FGzJG\340\005(p\0348\001\200\251\250Q$(\021B\210\231\031\021\321$\005Ic\200\002\221)\263n\021\220%UD\025\270\231\003LF\215Y\252G\266\017\254!\225VKG\177\247\260\332O\203\241p\370\0079\002'\314/\022\n\232%;\264\305\215f\307\335\211\034<\035\003\325\324\005\317=\272\\\353\236\246\264\2503\235P\032\263\234X\036f\016t*\212\2748\020M\0330\356\214\220\310*\001u\300\020V\322\353\255^5\270\320,\263d\323\f\301\007\354Oik\017F#\267O\237j\253\013\003\223\003\002\371w\216\206\237\0328\304jX\3568\376\361\026v\206\332\t\264.\353\004\026\035S\rR\025\002dg\343}\221\300\275\020,n\203M\022\034@\217)\327a\365\345\306\264\222\241@Z/I\001_\021\370\231\360\352\271\336\032\332\231\311"
+	.string	"\030lq\177*\r\371~\265\021\n\346o6\033'\021L\320I%\261\232\254\333\037b\312>}$~\325::\n\345\001\033l\315J\302\212O\006\271(_a@\205\022!:\214\373\236]17\2266\3551\353Qk4\241\013FI"
+	.ascii	"\221\212\374\325\224\231\202-\024\342\304z5b\341m\241\365\345"
+	.ascii	"G\273\2630\201\301Ht;\265.\004J~\357\262n\013B<\206H\346P\312"
+	.ascii	"\004\334f\374\007"
+	.text
+	.section	.gnu.lto_batteryUpdateVoltageState.63.5a05a1340a43bf59,"e",@progbits
+	.string	"(\265/\375`\227\004\275\027"
+	.string	"\006)\217K\300\360*\035\372L1osk6\246\226\250\203\351\235\205\231\251\t\256\326\251\357\t\275K\24677y\326\0356\212\223\255y\330\\\215]A4\361p\263{\243,\212\242 \250\022\242)\3560UAv\277\rT7B\b!\204\020)e\ny"
+	.string	"l"
+	.string	"|"
+	.ascii	"|\261\371\315|^\376\002@mhQ\240W\353\204a\215\032\034\2014\374"
+	.ascii	"\337\364+?\322\362fj)3C\353\241QkU\265\314\256l\212\236fI\216"
+	.ascii	"b\363\312\267\\\235\265\033\313\246h\310\215\355\002\237\346"
+	.ascii	"\215\r\307e\271\"O7\232\013\217!\271\027\230\025\213l0\"H\316"
+	.ascii	"\262\204\333\214\333B\013z\223\221\251Z\353\346l0\"\227\253Z"
+	.ascii	"\353\271v{\331\233\366\277\320\177\002\277\030!$z\276!\266\203"
+	.ascii	"M\315\240\363\3359\222\271(\344\216\347Z\245\325\330\374\313"
+	.ascii	"\373\217\324\024d\340\324\312\262\030\270V\007\200\264\360\215"
+	.ascii	"\177=\354\016\345[s\230\nom\307\257\n\271\343\266\201\237\022"
+	.ascii	".\306\303\237'\343\326\375+\326Z\353;\346g\276\007\363;\230\237"
+	.ascii	"j>\252\371'\221\317\321|\023\363\323\346\243\314?\233o6\277\024"
+	.ascii	"\371d\363G\016g\227>\"\2365\235\2301\266\356\033T\032\t\341$"
+	.ascii	"\235Wk\025[w3\267C4\343\245\227=\266\331\037?.62\036\236\354"
+	.ascii	"\022\301\246H`\326:\033\371\002\255O\301\002\026\213\334\221"
+	.ascii	"\354\375\321\354\304\036\267\267(JHZ-rG\261\227G\210\343\356"
+	.ascii	"^\332\2157\330\237\022\263\326:\362-\261&\034|kv\274\211\313"
+	.ascii	"E\356\310]\372\202\224v1\036~A\354i(\310\3026\266}\276#8'\021"
+	.ascii	"\201\360j\245\244\260\030\250`/\027\354\244\005S\235\224\260"
+	.ascii	"LT$/\230J$\300]\017Z/U\212\313\365R\245\274\330\212\33319k\366"
+	.ascii	"8\004c-\373~\330\257\3044\306\021N\022\352\321\035\2759\241G"
+	.ascii	"\013\020\342`\034ut\351{!bM\275\n\247\216\013\026f\353\236\352"
+	.ascii	"\263w\267\003\234\361RQ\252S#\240\022\256\364\t\002IT\243\247"
+	.ascii	"65\252?~\034}\002\022q\364\376\204i\233V\034h\245\275=4g\243"
+	.ascii	"*\206\002b\250Qh\343\020D$IQ\212\013\215\001\340\002\021\261"
+	.ascii	"a\035\021\340\250t\f\331\230l3\022\r\013%\302@1\243\275\251\322"
+	.ascii	"\321\252\312\f\303J\237\233f\"\304\352\317\360\203\370X \027"
+	.ascii	"\317A\237\324\362z\204\025kR\201\332w\376\210\017rl\251\364!"
+	.ascii	"9\036\227\275\371\360\020\370C\023\270\306\2003F`\001Kvn)k\224"
+	.ascii	"!\200t:Q\257t\033|~\234\254?\016{\247#\0345\305=4\217\306\007"
+	.ascii	"\214\2367\312\0368\255\375ZGN^3\212\374\275\207\335\347\022|"
+	.ascii	"T\326\302/\334\236\376L\260\375\354\200\243]\b\311 p/\2003\274"
+	.ascii	"\240\f\202bd\344\314\235\260\013+\204\032"
+	.text
+	.section	.gnu.lto_batteryUpdateStates.64.5a05a1340a43bf59,"e",@progbits
+	.string	"(\265/\375`V"
+	.string	"E\b"
+	.string	"2\01766Po\322\001\220\242\006\304\252\377\205\3609\313Q\213r\224\215\3357V\347\225\f\220F\004\256gd\240X\276\002\325\376,\221B%\240\372Y\214\260I\267?#D\312\224\002\356l@\227\205a\034\205\027/\030?V|\237\005\216\347u\256\3706\003\206\r\326\3650\b\257\227\351\366\324\352(\341\244\024\322\315\252\037\f%\334J\352U\365\021-\233\207'\025\343\223\336A_\303\0161\317\275\362#\300\253\253\201\005\013GE(O\017\232\021*m\020D\236s\212\220J\233jv\247\245^\330\247VG\366\323\372t>}\001\215I\312\201\313\356\304\311\264\245\212d\303\3663\316l\225w\031\373\020\024\t\220\227\335}\212\361\354\231\371\3578\206\023i\317"
+	.string	"\204\335ur\"\212[o\233\300v\201mS\023"
+	.ascii	"3\241\001(p\365\335\001;\320\030p\227\324j\340\030\020\202\347"
+	.ascii	"\214\024u\017\332\245)x\315\313\\\303Y\206\360/\343\202K\267"
+	.ascii	"h\347\023"
+	.text
+	.section	.gnu.lto_getBatteryState.65.5a05a1340a43bf59,"e",@progbits
+	.string	"(\265/\375 \366\275\006"
+	.string	"B\r03`m\322\001\300No\210\231\034&}O:\036\313\250\323\361\231S\212`ZC\275\207\223\354\006\272J\350]\222\3542\030\243\220\347Z\325\033\257\221\354-eJ\001\276T2P\252*\313\302\243\340Da$\352a\030,\r\357\002\251W1\360\344 \301WM\023|Q\334\353'\225\322\321\007\373\036\217\226\177\341\214&\177\335\371\032\350.5@\242\223\231\0359\251\024\366\333\356\256\365c;\235:@\"\222P\262\013\221\235l\210\003\301\260\275\261#_\343\033\033[-Z`\002\236\021\317\207\311n|\224\027@w\355\004\320\235V\334zZ\3769\3362:\262\013\343<\001\024v\327ya\021\267\336\366\201m\004\333\023\001\007"
+	.ascii	"2\001\0238#&\016\345\256!Y\210<\334\025S;\311"
+	.text
+	.section	.gnu.lto_batteryStateStrings.66.5a05a1340a43bf59,"e",@progbits
+	.string	"(\265/\375 \314\265\005"
+	.string	"D\nq"
+	.string	""
+	.string	""
+	.string	"O"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\237\366\320\277\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'9\206\b{\by\276\002\005\001'C\206\bwu\301'L\206\bsq\303\001"
+	.string	"?\202\210\200 o3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\fNOT PRESENT"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/battery.c"
+	.string	"\tCRITICAL"
+	.string	"\bWARNING"
+	.string	"\003OK"
+	.string	"\006"
+	.ascii	"O\221\006\001\003\302y\346\321\240\362\033@\021"
+	.text
+	.section	.gnu.lto_getBatteryStateString.67.5a05a1340a43bf59,"e",@progbits
+	.string	"(\265/\375`S"
+	.string	"%\t"
+	.string	"\306\021@8@\255\322\001\370\250\013\301\204_\020f\272;:\244\256~;\031\345\234\031\200\004\3466\314:W\fB\220\030~\345Q\274\212\2025'\360 \002\356\337\t?\271\332'\233\354\235R/"
+	.string	"."
+	.string	"0"
+	.string	"&K\013v\301R\331\255\324\365\003\332\347\345\002\332\247\334x\3501\344?\365,\246z\221J\025\217\226\206\335u$\225L\267\274m\004\333\n\266S\002\266\243\245\214\216Y@\314\204\341d\027#\204m\311tu\370\252\327\317E\f0\n=vw\373\264?\366\366y\033do>\310C@\016\021T\216'\331dG}\272\353h\035\371\324\023P\302\017\327G\276\372|\224%<\361\244O\337\243}F\371\372\203\325k%C\024C\273\216\242\324\260\237\255<\005\326`&<\016\0043\016\364\363\272\217\303}\224\363\220\331P\215\367QL\201\273\b\316\243`\327yt\253\242g+OR\032\210\344\310\266)\336\202\270\354Z,\370\254\f"
+	.ascii	"2\241\365/\260Z\302#\235\2333q\216\324}\256\341DL8\250B\027T"
+	.ascii	"8\342\256\230\332I\006"
+	.text
+	.section	.gnu.lto_batteryInit.68.5a05a1340a43bf59,"e",@progbits
+	.string	"(\265/\375`'\003E\025"
+	.string	"v\243\201H\340P\2471^\016\013\211\357\024\316\353\201K}\214\370\004\"\217\260\030\322\270y226\335\343\025@S\216\337\207D\204X*\270\300\250+?\204\350\343.\256O\2633\324\211\247\350\2339\266\300\035\t\306*\345\332\226{K\231Rl"
+	.string	"f"
+	.string	"s"
+	.string	"\017"
+	.string	"\322\203\206\203\247{9\234<\256\t\352J\330\276\313\243]u\242\234\373\244\031\231\243\336\275W\254#>>\264\340W\351\350\323\245\223,k\017K\254,}QD\226\037\016n"
+	.ascii	"P\306X\001:N$d\352w\240\177*\224\236\310\222\346\365{a\311\360"
+	.ascii	"\\\345\355K\020\323\253\371(q\224\206#\367^S\262\364p\267n\333"
+	.ascii	"f\033\201]]\002K\024\374\235\203\256prb\017\332()\364\244\251"
+	.ascii	"\016\206\211\2535?\351J*0\226\320hI\305\372Hw\241\262\302\302"
+	.ascii	"b\017\206(r\037\372QK\316\307\217Y\237\305[\3040\314f<\244^="
+	.ascii	"\214\365\203.\004\343\3578\003\215\236<\350\323\354A\020\007"
+	.ascii	"\311g\207\215\2366\321\215V\021\366\353y\236W\25686\245\246\247"
+	.ascii	"\0166\306\237\032\264\206FR\006L\022\031\2371\006\215C$$\013"
+	.ascii	"\030\354@\3700\026\252\001\355@?\300\213\352Q\362\206x\244F\263"
+	.ascii	">\002\324~P\362\241\2632o\265\326\312\271"
+	.string	"\035\356\315\ry\351t\2305\232\345)&!\233z\r\366u@\021\025\216b\331\206\360\246\b\255{q\n|\335w\022&\230\230\330\203\257\241Q\323\225\020\b\375\2123\235\264\356\265\235\364s\017N\021\241\311`//(\026\304\231,6s\201\315D\227\025\224\0261E6\023E\n8v\001&\023_b1\231\350\"\262\275\342\034\350\255\335i\332\352\315\347\375\013M\374P\375\265\353\261\343\211\222\217\235\215y\223:H\315u\234tb\2008\374\034\024\212\347\336L\3717\\\325\372\307\036{\320\224\27439\236G\331\256\2524Y\275{k\017\341\272\301\321\036)\036O\250a8\352\0203GA\224\264(i\016\320\002\021\271)\017\021p\301\203\265\255\226\326\"\214\360C\342HB^\252\233\330\266\032\246\365H\023Vq\321\177Y\025\207c=_;H%-\277<\205(\350U\303Q\314:.G\355\345\333e\217\016\374\004\367\236\007"
+	.ascii	"L\277\314uH=Po:\346\276C\302\231\206\376\r\b\341\021\016\361"
+	.ascii	"a\231\240\247\227\260\243\365\\W\375\260\277\3004J\307N-%\026"
+	.ascii	"4]\350\026\227\317I\246\377\247\022E/\353k\"P\021\3106\234q\347"
+	.ascii	"q\201\340\026\031h4 \253\002"
+	.text
+	.section	.gnu.lto_batteryUpdateConsumptionState.69.5a05a1340a43bf59,"e",@progbits
+	.string	"(\265/\375`\230\002-\022"
+	.string	"& sG\340\320(\035\332\215`\321*9w\306\375/\025\343\030\230\325\270\275\204\027\223S\245 PB(>\005fz\364\207\307HQ\253\252\376P?a~\300\204<a\020\222i^\360\334.\fwe\342\020$\230md\023B\244L)^"
+	.string	"Z"
+	.string	"]"
+	.ascii	"\337\273\227\374\262o\374\006bc\r\006\027\036\242\335\005\365"
+	.ascii	"\303_'\215\276\350u\234\346\313\217##\331l\345\244\220\321'"
+	.string	"\364\"\303\201\214x\211\311\030G<\300\314\334\0130s)\315.d\327\222\034K\252\355!B/3\034\310\356\036\347\231a\026\313\214#\273\353\224\315`\356\322m\353\330f`gK(/\261\372vY\026\370\267\353P\360m\336\271\225\222\227\275\363S\274w\327\330\302\243\303\006\313\"\373\026K\245\331\347Vi\354\327\356\310\2459.\255\232\316L\277$ gF\204\030\273\033\212xlP\367s\363\332\355\347\370\266\004\n^\257\251|+\"\366\324h\300\261{3\360\316\007\002%%\336\273H\003\005Q\016Oi\276\212G%`\203\2633\364\221\266\351\224\227E\275\355\277\351 \023\024\323\025\373\266\273\235\212\247\n\300\366\024\357Q\361m\034\242P\336;\325\333\030\212\201eQ\236S\232\177\342\245f\217\324O\234\360\244\336\304P\356\356\212*\315\267\340]Mvj\260\344\016\333\001(UJ\2252\241\204\016B\224\311\245\nO\254\260\301"
+	.string	"\237D*\260B\227\313d\002\266X\253\226*l\201\252\224\t\005<\261Z\240H\001\257&\204,\320\265Z\261\300\322\rv\2451\316?\030\265 \230\306H\006\352V"
+	.ascii	"\215\376\302\347cw?\2459*\247\017\261#\343\301]@\370\341\024"
+	.ascii	"\001\007\037\022\266\230'\361|\026oA\"!8 \320\002\251!\363\263"
+	.ascii	"d\221\263\355o\262\237{\333\367n,\256p\344\346u\3672e\241-\334"
+	.ascii	"^\2755\3541\b\305\225/[\371V\215\270\360\255\273\360`\375\222"
+	.ascii	"/\372s\233U\244\313\200\354Y\246\322\356e#\233\371\250\332M,"
+	.ascii	"5\024=\036Q\203\006r\202\244\025\311n\321r\\4ap/\2702\234\263"
+	.ascii	"\002\023\334\202\033\355\205\241\020z\273\321h\365\325\243]\207"
+	.ascii	"\217\3452"
+	.text
+	.section	.gnu.lto_batteryUpdateCurrentMeter.70.5a05a1340a43bf59,"e",@progbits
+	.string	"(\265/\375`\273\005=$"
+	.string	":AL\016B\200\252Mc\306\2358\330\254\201\357\223\353\233\3772?\251i\266\217\247o3\356\243h\0268\376\267%n\342\245\224\261\223\320\r\177gf\371\263n\211\376D\343e{%\203\002\216W\253hD\366\226{K\231R\320"
+	.string	"\304"
+	.string	"\332"
+	.ascii	"\266\205\321\300AF\034z0\265\3308z\032\336)\024dg]\021N:\203"
+	.ascii	"y\322\277r,7>t-\213\314v\322\276a\333NR\233\355S\373]\367:\377"
+	.ascii	"\225\303\265{\261\322\210\335;\234`\t\346\311\243\033\331\223"
+	.ascii	"\343\007\330\223>\355<\037&\271\007\223$\270\005\355\336\213"
+	.ascii	"\253H~\336&T3KK\216\225\236\376\357\266\t;\236\b\261A\323\305"
+	.ascii	"U+\223\356\024\344\346\021\024\251 \264\034!\234\215\361\363"
+	.ascii	"7RT\243Q\217&\302s\tR[&\201\275\303\222.z\310cI\r\321!4\005e"
+	.ascii	"\213\030`I\t\031\307\nj\314"
+	.string	"\272\376`\371\030\362:Z\200B\253\272M=\215C\200\202q\016v\0325\005\244\264L\272\367\232\n\247|\334C\267\315\3066\317&Y\004^UE\365V\313>\3014Z\211jQ=\226s\200R5\234\022\fs\002<\231\227!\321d\302\204\255e\221\375\251T[W\332\214\004\350\207\027Sa\336\353t\241\037\346bN\370Z'\235B\205\n\273B\211^\350\2413i\210O\365g:b_W\265f9g_[d\251\363D\001\331\367\362/9_\313\272\027\364\302\027\366\344k\025&ZV^TN\264h\017\201\264f\331\257\305b\261\350z\304\266\324\t\256\3456z\330-\240\244.\262Q\337\376\365\023\331\250k6j\323R\2276j+DM\326\250G\223\272\226\324\324R_\301\307\\\241\351A!\346\336\036EA\227H\222\331\272\226?\354$\255\366\355\017\375-\347\022\327\363='\023_\353\244\317\255\363\311\371\304\236$+"
+	.ascii	"(:\\d\234h\321\326j\326m\206\310\231;\346\222\035\353P\236,v"
+	.ascii	"\034\320\242\223\260\366)\345\234B/\034\253\365\272z\252\277"
+	.ascii	"3@\023\005HI\303\n\250\007\324\360)\302\007N\003+\247\027\275"
+	.ascii	"P@=\227\177k,\b\021\330\346Cc?\210\326N\235\023\254@\332\002"
+	.ascii	"z\253\266\206\r\2673\203N\366O\021C;\373\321A\236"
+	.string	"\023uF\205\204\3638\227\343<HhVU\365\035\250\220\350\273\241\246\302\033\365\305\311\275b\343\227\375\035\354I\021w\215Y\027\225{\357\203\257\361\275\277[\231In\2056f]h\367\352>\260]A\3214\333\036\236\346\203y\357\323\005\177\354h@\204\0301\302\236\254\265\334R\306\365ET\3154abf\025\206\201\324\223\021\303\327\204c\332--\355r\bzM>%\037\t\237\256\347\302E\b\235\f\237o\307\203\341\273\365L\350\226b\224\3601\351x\274\246\034\221sH6x:\237O\251\005\256\307\333\365\230t=\034S\f\245%\\\216\327\303!)\360n\206\216\207\363\355v<\234m\350\364z\304\264\002\3757w\322x\357\2756z\213\267\261\"\361I\315\017\366\363\030\013D\374\321A\026\252Y\246f\204\017\341\341*+%\274V\243\272\\P #\006\240L\240F\265V\315z\"9\225\320\013}\024\254?'\250f"
+	.string	"<\301\264_\201-k\202j\032\244\002\322\242\237\234\257\345s\311\213\262R\220r\207\213\252\006\325m\306\332jT)\036\035V@Z4Ym\035\373\350(s\242E\244\363\261\030\363\336\213\301\001o\250q \310\224bfFFFd$M\322\001\200\002\0212\243\036\020`(3\323d\030\003\315\2729\344:\305\033\240\017Q\3159\260m{&\261\307\372+45\341A\204ow#f\356\rm\307"
+	.ascii	"\237\206P\314\230\3353M\201\323\323\335\033'3#\360\021[N\003"
+	.ascii	"\016\375H\274F\262\220Hh\235.\207t\021\337\355-\353\275\205z"
+	.ascii	"[\2301\267\331\350U\316\316\353\205b\341\275\021hz\301\216\246"
+	.ascii	"\260\330\216l\361g\305Qo4)\257q<\025+\272\374\246p\222\307\223"
+	.ascii	")q\233\033\234A\321\3538\322\240\274\340\b\371\007\022\tE\r\031"
+	.ascii	"\260\327\216\270B\363 \302r\216\343\205u`s\b7\274\270uY\221\266"
+	.ascii	"+\266\371\367\037\0065W-\211\027\177I\2230\361\355\266n\002\312"
+	.ascii	"\035\2142\036=O\224gw\311\355qQ\317\205\232\274Q\310\200(\272"
+	.ascii	"\025\255\245\006"
+	.text
+	.section	.gnu.lto_calculateVbatPidCompensation.71.5a05a1340a43bf59,"e",@progbits
+	.string	"(\265/\375`\307"
+	.string	"e\013"
+	.string	"\266UN@ O\234\016 \006\230Q[\032\021\210\322\320\311a6lr\026\224\312\255\237d\310p\2153\031\226\r\362\326\007\005\032\225\227\362\205l<\200\001%\246\240\024\377fC\361\200\213\345Q\004!\262\267\224)\005:"
+	.string	"="
+	.string	":"
+	.string	"'d\354nU\271\200\351\021>\300\364\250\035\256\035jj\276\344\002C\274X\321y\241C*\303\225\342q\260\262\273\367xnx\242L\311ew\235\235\207\341\216\267\275\300v\002\373\n\002>\\\335`\353\277;\237~\234p\020a\321\300\305\256\205\021\221\005\211*>\374\373m\315\367\360\344\237KT\350\302\200QH\205\030\273k\340\321\007\250G\177\304Ihv\t\222<t<\204\302\204\"h\215\264\257\b\371.U5\364T\345\360L\327\314\007\f.g\330\316\376\341\241v9\004~\211\233\220\340w<\372\003\312w\217>hz\274JF(D|[\216\330$Q*\207\003\230\365"
+	.string	"\243a"
+	.string	"\300\032\313\007\263:\035L\246\312\260+\343XY\305q\200\331T\032,\253,\004|A\260\260\252s]X5!m\207\232\272I\321\"]\372\332\311\355n\005T7l\253R4\200"
+	.string	"\3314\023"
+	.ascii	"seY\203m0bf\202\007G\006\254\340\006[\260\013\205\035\3352\031"
+	.ascii	"\272\206\207L\220\240\342}L(\213\332\006\270\006\215\302g\250"
+	.ascii	"!\333U\312"
+	.text
+	.section	.gnu.lto_calculateBatteryPercentageRemaining.72.5a05a1340a43bf59,"e",@progbits
+	.string	"(\265/\375`q\004\325\035"
+	.string	"\206x\302H\240VN:\305\030\0359X\026J'\260X\357X;\034\313\036\320\025W\3358\343\354Iy\326\224t1\325#\361i\330\0246)`\233\276\020\256\341\2168:\3544z\375[T\274{\322\342P\213CS\357xb\367&r\247\024\252"
+	.string	"\234"
+	.string	"\265"
+	.string	"Q\224\264\220d\2125/$\031Er\343[?\326\247}\257*\266\342=\336e\337L\342?\fC5v\365\241\317\345\333\265\356\303\351[M#yd\234\372\242\341`<\255\271N=\235\307\251\2476\t\373v:m'?\313\267c\005G\262\312\346e\303\005\032Ij\03585\202\361\324\n\02689x\255\031)\252\215\026R][HR+\2672\036|\245\342\316\240o{ ^Y\031\233\022\226x\245:\215\021R]\304\tM\334\204Qs\271>Q\bK\021"
+	.ascii	"I\222\317\372<!\204\232\323\366\200$I\317)\241\212\333v\333!"
+	.ascii	"l'\331\2420_/\302\363k\234\372\203\222R=-\332s]@\f0.\303I\222"
+	.ascii	"d\211]\030\016\326\257\007\256*Q\263\213}!\037\022\364k\030D"
+	.ascii	"o~\252WO\277\266\030`;V<\3155[\013j.\f\373\"\271/\354#\243o\335"
+	.ascii	"Eu\232\350X\367P\235\026\032\247\203\306i\240:\375S\247}\352"
+	.ascii	"tO\235\346\251\323;\342\264\3168\2353N\343\214\3237u\332\246"
+	.ascii	"N\327\324i\232:\215\023\247g\306i\031\333\364\255N\307\320i\030"
+	.ascii	":=\326i\033\235\256t\232\322i\261N/\235\236\342\364\003\374\244"
+	.ascii	"\005\337\232\035*\233Y\334^JM\302\235L\030\233\314\354\241\234"
+	.ascii	"\ro+\263\364\212\224\032\2053iR\362%\026.`\300POo\233@\307\330"
+	.ascii	"\216!\355\331\243\001ibPf^j\007\316\263=\353Y\246Y\312\035Vc"
+	.ascii	"\226g\357u\221\307\214#8\314\200`\201\331\230\025\277\312'\343"
+	.ascii	"\326\205\331\227Ll;\356K4\333\006\205I\251\031y\020\343\242H"
+	.ascii	"\362\351\210n]\240\262\322J\334\271t_VA\3155\357\212\333\343"
+	.ascii	"\244Ds\206\203i\030I\222d\340#y\222\r\034:t\250\247\273\007;"
+	.ascii	"\033\026\355\334_U1+\321.\276\251\026mP\216\033\326\335\310n"
+	.ascii	"\001\025\222\214b\340\007NBbJ\002\352z\271%_\257\347\333\375"
+	.ascii	"4\001\225v:\021:\b4\274\017:\340\022o\367\343U\260\361\016\251"
+	.ascii	"\351\307\003\002u\036rL?\037\323\022\217)\267\244\244\353\345"
+	.ascii	"v?\246\034\222\220}\"x\277\034\320\347\373\345nZO\027\277/\374"
+	.ascii	"\260)\324\b\346KX\021\361hG$Q\233'\362\241=a{h\237\365\243`\221"
+	.ascii	"\205\354i\241\304J\263FcDK#v\241%\332w\005\255\320\212_@\233"
+	.ascii	"\263Ak\240\253\344\361\263@>[\263?\333\340Ki\205\333\235\365"
+	.ascii	"\331\\WY\245\263;\021\036\205Lgg\331\331\360\211@\305\331\234"
+	.ascii	"-\360UZ\335\254\314\342\254\317\225\262\312foj\026\2676\373\322"
+	.ascii	"*Q\250A #\221AJ)g\"\231\321\264\260\325\200\002\031#+\017\020"
+	.ascii	"XfE\311p\303cE*3\366\213\312s\226\322\306}\2363G\205\332X#b\001"
+	.ascii	"\270*,\254\343m\306\3741h\204\"\222/\032#\205x\351u>\027\361"
+	.ascii	"\356\377/r\f\r\235\362\017\300\271\305\331<~,D8<I!\233_\nsX\027"
+	.ascii	"\rP\233\r\317\212\320N\260\t\245\223\236\0348\250Lz\ti\201\315"
+	.ascii	"\032\264\025\345LF\003\006\242\331\322\223t\360\214\302\357z"
+	.ascii	"\200\320\211\257\373\324\206\2620\332\325\203z\256;\376H\tx4"
+	.ascii	"Z\":*\252;\237\330YRD\276\177j"
+	.text
+	.section	.gnu.lto_batteryUpdateAlarms.73.5a05a1340a43bf59,"e",@progbits
+	.string	"(\265/\375`Z"
+	.string	"-\t"
+	.string	"&\321?80\257\322\001\204\361\024\255\230\356M\247\034\227\250\251\353\252\265\314\255E\222\212\365$2M\013\365\037\360\026j\321\257EmSP\200\306 \305\317iA\2153A\313\326\310\3362\245."
+	.string	"."
+	.string	"2"
+	.string	"z\3625\236\335\275\353\0330D]b<J\203\231\211\213@\250\222\003+\017\360\256kE\370\251j<\273k\005C\213{\273\355\004\333\007\266S\002Z\263c\237\306\r\373r#\313\276\372\033A\206\n\303\313\356\252\026\263\262\355\344\303\3669>\331-\217\265\366$/\212\021\230\335\235\221\343\247\313\030\001(\027\262/\242\336\242\315J\242%2\217 \021\026\225\322l{\017\201"
+	.string	"\330U!\370\257\303\"\374\216o.\231\364\3407\337\224\371\366\250\231X\001\201\245\002\016uJ\235\210D\372\200\246\327q\336H\344\315\321\302\247a\206:ov\n\3149\210\272I\342\270nrb\251\313\215,+h\310R\361\223\033\265\271\007=\350\r"
+	.string	"3\241\305/\306\326Pq\330\233\250\266@\n\212\270\355\206"
+	.ascii	"]\303\t\230\340/\343\022\227\313\224B\355\001"
+	.text
+	.section	.gnu.lto_getBatteryVoltage.74.5a05a1340a43bf59,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\035\007"
+	.string	"\262\31514Po\322\001\240<>\343D\304\324\016?\020\301V\226L\246j\347\353P\334\032j\275{D\226\221v\203\326\231\252\252b\254\366?\327dC\225 \206%\233H\231R\326`8\260\302\260\f\303\273\240um\252\353m\0322\017O\003\257\2071\260\005Q\301\207Y\026|T\334K\253\"\353\001H'lG\234$\003\330]\005\177\344Q\302\347\2703\247\223\327\356\374\216\006\210\200r\263\343'\025\303\276\264*\262\235N-\360@qX\331\255\330Z\366\304\231t\330\366\330\224\377q\020\217\263\214\033\026\323hDQ\302\262\033\237\300\t\246\273\374\300t\247\032\317\236\231\377\220K*)\233\026\372</\013\273\353\324B\027\267\3366\202\355\004\333\031\001\t"
+	.ascii	"\002\013\255\262\030\207\"\036\031\002r\r\277\215\030Y\210<\334"
+	.ascii	"\025S;\311"
+	.text
+	.section	.gnu.lto_getBatteryVoltageLatest.75.5a05a1340a43bf59,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\035\007"
+	.string	"\262\31514Po\322\001 [\243\217\240\261\200i\315\006\025_\307G\177V\317\327\241\2705\324z\367\210,\343v\037\2653UU\305X\355\177\256\311\206\252\341\003\221M\244L)\336d<\260\272.M\203\263\340\263:\225\345:\016\032\216\333@\313e\016\374\036*\350\256\367\240\303\304\375\264J\262\"\210T\3026\304G\260\200\335]\360E\036#\374\2157{>\371\354\315\377\250@\210(Kv\f\245^\330\237VI\266\323\251\006\035*\034\224]\212\322\313\2464\023\016\333 \033\343{\374\003d,\243F\005Ur2A\342\262\033\335\300\013\250\267<\001\365\246\031\307\236\230\177\220O-,+\331(\364\004`\330]g6\262\270\365\266\023l+\330\306\b\t"
+	.ascii	"\002\013\255\262\030\207\"\036\031\002r\r\277\215\030Y\210<\334"
+	.ascii	"\025S;\311"
+	.text
+	.section	.gnu.lto_getBatteryCellCount.76.5a05a1340a43bf59,"e",@progbits
+	.string	"(\265/\375 \350\205\006"
+	.string	"\"\214-4Pm\222\016$\203\310\n"
+	.string	"\240h\036.\300"
+	.string	""
+	.string	"\360\2555\027\374[\330\322\377w{5\247E\350FE\327\214\231\2316\007\027\244\226i\315\230C\207\265O\266L\001g.\2327]\027F\301Y\257\262\250\311r\324\002\206\301e\236\345.\003W\r\323sWU=g\311\262M\204\215\300\323\034\276\033\345\300\256\305\232\r\366S\351n*\225\260\005Hxp\364Y\007\333\304\227\222M\364\343\330\004BH(\217L\320\350$G$\020\214\237\363\226\017\0208c\315*@\225\013\221\207\016\223\314\3145\212bE\354V\243\224\214\222\217O\250S\004H\310\314\361\023\212\350\255\177\301o\360C\004\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_getAmperage.77.5a05a1340a43bf59,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\025\007"
+	.string	"\362\r24`m\322\001@\023\341\262o\344\303\224\203\257\031\200\373\217\210\002\260\202\025\242Y\324{\207\232\354\006\272J\350]\222\254\274\230&B\236\273\3034\320c\357-eJ\001\326`8Q\252\252\314\002\244\342Dm$\nn\0302\rP\023)\210)\360\344 EXMS\204\226l\337VC\326\013H#l?<\304\n\330\335\004\037\344\031\204\237qgN'\177\335\371\235w\227*\360\001\312\221\235}R+\354\267\325\220\355t*\202\350&$\273\023\243\225-q#\033\266=\266\305\347x\207\307V\3130\260\247q\"!\242\262\273\360r\202w\327>\360\356\364\342\326\323\362\357\361\226\"B\271\260\317\023@aw\235\027Fq\353m\033\330>\260m\021\b"
+	.string	"\002\013\255\262\030\005\205"
+	.ascii	"]\303iC\214\230\261\207\273bj'\031"
+	.text
+	.section	.gnu.lto_getAmperageLatest.78.5a05a1340a43bf59,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\r\007"
+	.string	"2N23pm\032\003\240,1`3\257\230\n\030\214\0016\001\301T\211\303\355\\$d5\301\201\335\245B\213\2725\323\377\334]\314t \342s\222\256\355\226R\312\224\002\325`8s\252\252\314B\244\246\2446\023\0257\f\231\206\250\231T\304\030T:L3VR\316h\311\356w\027\252\273\200\\D\333\007\207X\001\377\023j\020g\020u\206a9\235\346\313\260\356H\206\315\t|\200\332\250\315>\315U\264~\377_\027j\333\332\\\201\312\211\034\371'F+7\201$\033m=\255\245\346p\207\247\326\31300IC$!\"\372\037/&\220\f\237\007$Cwa\313\315\252\355\341\227\202Rra\0377"
+	.string	"\205\377m\027F\341:\267=h\213\320\326\"\007"
+	.string	"\002\013\255\262\030\005\205"
+	.ascii	"\357\232\227\205 \303]1\265\223\f"
+	.text
+	.section	.gnu.lto_getMAhDrawn.79.5a05a1340a43bf59,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\r\007"
+	.string	"\362\31513`O\322\001\334"
+	.string	"\f\270\300P.\004\031)\030\246 \025\334\004\243\202\321\032\322\266\035\"\262\213\266{r\323\017\303a\201\341\\"
+	.string	"\371\270X\361\b\221\275\245L)\336d:Q\242(\315\302\233\"\2348\322\3648\f\232\206\267\211\323\313\024\030:H\361Q\020\306w\301\366m\325\302\212\ti\204\355\207\217T\001\273\233\340\213\034\203\3607\356\334\361\344\255;\337\023\335\245\n\204\2042\2631P\352\205\375\266ja;\235j@q\002Uv'2\2265q%\035\266?\366\305\367\370\307\307U\3034\256\210\243E\202dew\037\346\004\321]\373@t\247\031\257\236\225\177\220\267\024\224\314\272@O"
+	.string	"\205\335uZW\305\255\267}`\033\3016F\b"
+	.string	"\002\013\255\262\030\005\205"
+	.ascii	"]\303o#F\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_batteryUpdateVoltage.part.0.103.5a05a1340a43bf59,"e",@progbits
+	.string	"(\265/\375`\245\001\335\016"
+	.string	"\226\032_E"
+	.string	"\223\223\016\033\271]\220\236\250\002y\023\221\220\024~\200&\223e\242I<\277\334h\356\335\212\030\263\266\316XT\006\337H<\032\330\240D\017\366e\250\277\252ci\2100\002^7\317\303\006\265h\224|\262\267\224)\005G"
+	.string	"R"
+	.string	"I"
+	.string	"6v?\222G\217`\217\006>\340z\204\027p=f\217_a\373\304\301(\233\307\277\325^\006\007\313Lkw\265G5q\3245!\312\177\314=\252\226\013W"
+	.ascii	"-\036\236\001\016ALv\327\330\207;\3366\002\333\020\354\374\004"
+	.ascii	"\273\033v|,\211x\203\202\346\344\024\223\025\r\031`\215\210\035"
+	.ascii	",Z\213\341\023\361\314_\230\234B\340[uX\240C'\247\265\373i\217"
+	.ascii	"\376\260\303\334\246\313Xmr\262\373-N~\2143"
+	.string	"\230\323?\225d\260)\020\"\217\316\264\317\272\013\324?\025{vK\324\0045@!\253\335U\340\3178\215\320vrr=&\216\252\3075\365,?l\321eP\300v7\201\017\3431F\376\211Gs(y\325\243\217\242\236\024\215\nV*wR_\254\360p\325\305\276\3220\246\365JgL\037;\020\"dD\236\340=\330F\"\007%\322\326u\026B\037\207JL\335V*\201$h^\307y\244\315\323H\"\320H\013u\236VR\300\\\205\255\323J\034\327i\231\355<\\uq\203\0249R\272bU}\261\rI\216sC\025F\370\215\215\352\260Rm\217<( \220\202\241+\233\003\377\006\303\n\031\230\017\307\315\230\302`\\(\017\357\341\036mwBX\013n'\353\n7\315\214\256\355H\265\027\331\236\211\3160\233p\243Q\2207\004\336\205\007&j\302\274\f\255\301\021\013\217\022\214=\351\236\351B;\365\202\266\313\302\002"
+	.ascii	"\362\342wJM?\301\214\001"
+	.text
+	.section	.gnu.lto_calculateVbatPidCompensation.part.0.117.5a05a1340a43bf59,"e",@progbits
+	.string	"(\265/\375`\361\002\025\026"
+	.string	"6\351\215H\320\362&\035R\001\240\006\331f\020\273H\"\217zF\210 )\215^\307\nqx\026\216\200\250\r\305\2257\326\277(\217\177\3571l\325g}S\030\333d0J\2354#\013\005\370\350\f,<\327\23359~\020K6\221;\245u"
+	.string	"|"
+	.string	"v"
+	.ascii	"Gr8\342\334\322\215+\2643\343\217\016?\375\023~\002ivJv<.L\355"
+	.ascii	".\312\247\023\200\237&p;\266\375\022/\232\261\237\2741H\350<"
+	.ascii	",\334(Q\355\256\370\331:\201\357\323\373\200\357S?|\346\236\312"
+	.ascii	"9\343\257\\\336\220\016\0308<4\367V\256\245K\034\036\rW\022\036"
+	.ascii	"\235\327\332\335#]\346\360\344\244\024\360\271r\355\256\301\r"
+	.ascii	"\367w\333+\266i\266\266\002\237\364\310'-\362I"
+	.string	"\203\240\364\352\223\376>\351\271\222\366>i\235\322rJ\237\244\004A\220]\fUA\326g\272\020\361\243\313\235\325\215(N\213\302&\324\331[\b\324\263\233\242\372\\\201s\214+W\301\306c\221\303F\021\325\352F\024\247\270\n\031\307\024\030\2032,\270\361\243\007\325\356(~z\004=\373\312\201i\310W\372\222\035\372\366$\033\310q\263\314\223\034\342h\032\332\335P\375#\234\003\253\342\307\270\f\007\017XX\276\317\225~\210\016\243\251\252\237~7\"'\253\354\351\324\357\246\256\236\232D\335\f\221\252\352\t\331M\331\020.\365\002wu*\376\213G\301|\241O\307ZZ\276O\251\001\244\232\210\214\344\356\322\250\002\331~\371\256\254\020I;t\022\210\375\026\207z\361\205,A&\217\363\351\313\276\317\253\002\037LD=5\262J*\220uz\253?6\353\223\016\003vI\251\271\330^2\021f&\223\315`&v\241\305&\274`+"
+	.string	"\fK\271\321b6\333+\202X\243\315j0\261\232\b\363\362\222\2110ZML9\361\214B\214&\332f3\232\030\332\226\367V\177,5T\031T\ry\032gi\216m\226\036\351\327\351@\302F\215\346\254\367\274\021\r\365\363\221{:\b\0174|\326R\267[s@DG\324r\327\003\324OET\235v3V\n\352\211\023\203\317h"
+	.string	"\356\006= p\002!;\343\006ac\274bE\034\0226e\354Av\365,\270\001Z \344L\34704t5\264\256\334\026\221\032\376h \262;5\006\343\337x\322v\224\247\3603\213&\350\221\207\021\376\303\3652\342\002,\220>\246*^\005\241\240\255\fk\204\3412x\023\256m\3555\201\333\241\233% \342\331\221\346&l[\352.\217\325"
+	.ascii	"\020\261\034\342]d\263D\003\205=7\253\327;7\206\272\260\346\202"
+	.ascii	"j\364Y\343\333\326\023\336\030"
+	.text
+	.section	.gnu.lto_.symbol_nodes.5a05a1340a43bf59,"e",@progbits
+	.string	"(\265/\375`o\004e\022"
+	.string	"F\034kH\260\230M:<\300v\331i\356\375%\341c\365\rA\321xj\022'\016\271e\024\301>\360yZ&$\251\353|8C\177\377(1~\232tF }3\303\313\303\314\314\254\341c\"(\356C\376.\330\271e\276\245\335\344\226)T"
+	.string	"Z"
+	.string	"W"
+	.string	"\377!c}\037\222+l\366:R\316\3259\340\227\310\260\362h\365\215\234i\311\364\241d\314\231\030\250a(\262\372N\022&\306\271\\.\312A\343\310\006.\006\264\371\026\013\300"
+	.string	"\260\311\377\212U\201l\376\357j\030\326\035\177\377F16Uk\255\tZG\376\237*\002\031>1\320\314\237EPM(\005\320\205\232\371\363\324x|j?B?A(\200V\264\276\242\013\0136\263B?\t\205\276\321\204>\222\235\376\021\t}#\021\372E\244N\237HN\237H\342\364\201\334\364\207H\233\276\020\t\341K\263\346T\036\374\tM?\b}\321\372\343\354ES\326\001\256\217w\214b}\334\025\261\254xq+\217\240\230l\260V\274\266\230\025\216\0273\226dV\274\343\212\273CHCI0\035\237\350C1\321\217R\242/\205D\177\312\210>\223\210~S\210~\022\210~\223\017}%\017}'\035\3727\016\375\243\r}%[k\375\013h\350W\331\357\331\275q\345\351\326\021\340\235M\271\2740\202M\325\027\336\246=Q\255u\200\013\367\254\364\0040"
+	.ascii	"\021\244\334\362\242\334b\203Q\366\304=\240\224CF\214\262j\224"
+	.ascii	"QV\2113\312\035no\005\306\223\016\032e\237\032 e\0177\363\261"
+	.ascii	"gk}\254\262\201\037w\343\336\351\326\203FN\250Q\b\305\201\271"
+	.ascii	"QXX\334\322\032\320\002!\242\242\003\021\240\224\347\214!\201"
+	.ascii	"\220\204\022\320\205yb8\272$\2772O\033\327\r\205i\226\246\007"
+	.ascii	"\222\315\227\310\363\257=p\351\274\245-\201tc\220\b\232c\024"
+	.ascii	"Ns\024\017\375cjd<\240\322\f\245\210\273Q4B\367\235\312\327\217"
+	.ascii	"\001\330\233*W|\252L/\203><\353\300\200\354\252\323\342\366d"
+	.ascii	"\332`,\004\3555\254:\233\242`\366\217g\262Mei\216\2627(<\220"
+	.ascii	"e&\315\206\037\020S\3071\016tS\2615Ez\367\221\264\361\313U"
+	.text
+	.section	.gnu.lto_.refs.5a05a1340a43bf59,"e",@progbits
+	.string	"(\265/\375`\273"
+	.string	"\005\t"
+	.string	"\306\2259+P\205(\3510333333333\025\2410\207nw\300!\024\373"
+	.string	"^\201\177\240'\354\203\374\326\032i\373\244\221M\266L\001)"
+	.string	"-"
+	.string	"-"
+	.string	"'\362\333\206\324\316S\365\364b\331N\267\264W\326S\360%\355\020\365\217vF\276[?\341G\355\211|G}\342\267?}\003\004\r\3223\254\276\240\272B\353\t\256#\264\037\254n\220\277Q]\223\237i\035\343\372\245=\222\357\350?\371J\361\0249!=C|!\336<\312\321C\006\351\ty\365\360\266\037\320S\276\364\360\310u\206\370Z=UW\355\330zY\035\320\330\230\201\213\016@\321#\236\016\321\376\341\351\016\375\023\340\006\023\013\224f\240\367\235\251"
+	.string	"\246\227Z\272\303z\366\225;@-\271B\256\257VaO\362\033\371\013|\347Q\234I\257<|\362\360\207\344\033\221\017\025"
+	.ascii	" D\352x\013\306R\3356\3266O\327}CD\333B\023\326\205C\355z[a["
+	.ascii	"\213v\305\236cn\314\245\f\245\216\261C\224EU\231\2501z\340\206"
+	.ascii	"\003]U\024"
+	.text
+	.section	.gnu.lto_.decls.5a05a1340a43bf59,"e",@progbits
+	.string	"(\265/\375`]1\245\316"
+	.ascii	"\3527\305DV JQ9\351n\032\364\247\346m\307\0349\270nv\337\017"
+	.ascii	";\004\001\036\264\272\t\216\353\f\365\362\325\274\366\337\231"
+	.ascii	"im\336% \030\206\221\232\221\325\207u\214\354\006\034\357\373"
+	.ascii	"\234\027\020$iU[l\b\311q\314\255<\365\007)\256\243\324\327H/"
+	.ascii	"\333\375\323\355\357\275e\n{\003R\004s\004-\246\307\330\334\203"
+	.ascii	"\035\246\3134\230&\323\205M\330k\013\266\227\367\227\006<^s^"
+	.ascii	"\212\250\353(:7\347\032R\234\034\330\335i]\005\232\265`Wi+\375"
+	.ascii	"\\\013\001\360\355\257\267l \242\005\333\257\243\350$\327L\365"
+	.ascii	"\301\232\326\225\007\017?\036<x\3600\004|\342\022\363\203\273"
+	.ascii	"\331>C\t\256\025z[\210\336jAo\353\320\3332\364\247}\206\235%"
+	.ascii	"\347\031\343J\333\r,\326E\367\365\024\240\r!eP\276,\350\373\016"
+	.ascii	"\375\363\r\375_\373\f;\3176^?\337y=\005g\331y8ge\367\005:\335"
+	.ascii	"\027\314\324\365P\036\031\342\267\022\364\375\003}`\277@\333"
+	.ascii	"I?\351\225CC\371\006\"~\223F\262YN\231!e\006\247\3207\207a\027"
+	.ascii	"6\207\341E\200\3624"
+	.string	"\006:\016;+\214\251/&r\2756\345F\234\305\357$k\355\2463\223s\323\315\231\363\372\216\353\265\345\032\316\2569\237\203_\350-\327o\355\266aE\316\315\032\027\250\264\340\024%0\347\325\303\217\007\235-~;\236C|\007\240\037\2016[\267\365\332\241\227\274\225t\222\317(\327\274\346\274\356X0B\266#\026\237\003\364\335ax\013\013\273\303\360@\250m\fC\236\366\031\376\215\244\003\272\244[b\246\326f}\344B\265h\346\265\234\327\236\231#vD\224\026\367Y\243\365\332im\344\330H3\253\345\274\346\\%\214)q\026[\320>C\334\030\206\357\"\337\321\313\"\032h\270\323@\303\257\3553D\033\303\220\f\024\024HF\350\371\355\230\026\002\376\306@\006\007\177w\210\001\342\352\026\340\277\234\025\006\314\017\377{\201\t=u+\310`\203\205\300\241\334\235\2777`K\020\217\374M\370\333\373[\022\032,M\003~\233\303"
+	.string	"\f\013\260#H\350`q\254\002.\350d;\260\"2\370\004\377\305\360\367\337\373\002m\210A\276\022\252\034\350\267`\376N\301r\300c\257\374\355\201\337\n\375\026\304o\203~\373\341\267\036~\233\301o1\370_\363\333.\307\277\3353v\324\211\337\3747\303\206\373\374\266J\003E\022\260\002\260\027\374\207\373\017"
+	.string	"\376\237\360?\203c\360\333<\313\301n\370o\3446\277\265\3617\006l\005\377\241\224\375\315g)\370;\213\325`\177\376\206\200\315\360\r\277e\341\277\230\377a\376\013\376/\374?\346?\230\377\204\377\001\377\017\376/\363\237\314\337`\377\257\374\257\362\037\217\311\337u\1777\371{\356\357\270\277\351\376~b\315\376\206\373\333\315\372\374\337\371\257\330o%\370-\317ou~\213\376\026\377M\370\367\340\337\202\177{\371\373\357o\277\277\265\374\335\367\367\363o)\177\333\375\r\345o\036\177k\375-\343\357\030\177_\375m\3657\363\357\251\277\245\376\216\372\373\351o\342\337\313\277\225\177\347\277C\3607\b\376\376\300\337\352\337\035\370\333\3707\322\337G\177\253\370\373\002\177\027\375\235\342o\r\374\235\201\277O\370\333\204\277K\370\233\204\277E\370[\002\177\237\370;"
+	.ascii	"\177\207\370\333\304\337 \374]\342o\232\277\321\277I\374_\362"
+	.ascii	"\267\320\337\f\370{\304\337\037\374\355\301\337\"\376\336\340"
+	.ascii	"\357\240\277\r\360w\001\376\006\372\217\342o\n\376\217\360w\206"
+	.ascii	"\277'\370\333\347\357\236\277m\376\256\371\273\377\376\177&\377"
+	.ascii	"\347\376\253\375?\362\337\002\377\357\376k(,,,\374\321\023?\n"
+	.ascii	"\370_\320\023J\224\220\371\303\371jA\227\004\254\272u-\340j\226"
+	.ascii	"\177\177\266KMfz\261\200P\256\006\210Z\027\272.\266\310\016\335"
+	.ascii	"\340\024\030\200~~Ot\017\275\275\3226\213\275b\265\264\033\232"
+	.ascii	"\345P)\033h\177(\035z4\r}\267\333\320\212\025\273\206\346\237"
+	.ascii	"'95\360\2262\300\370\370\214d*\233\025O(\037p\004\323\004\257"
+	.ascii	"p\265\260\332\026:\n\036\372\220\273aQ\3307f\361Qf\236\325\313"
+	.ascii	"\263T2x>-\225\023\034\346\326\273EFxf1\225\270\032,0\346\027"
+	.ascii	"\3644qSV;\305Fa\245\221le\263Bn\320.0g\254\0176hE\236\274\371"
+	.ascii	"pb\355\234\330\273a\316\2756\251\230wO\236\330(h2\347\23729,"
+	.ascii	"\240\032(\262\037\203Pn\243\350\230\325\375\tZ|0\326\307P\335"
+	.ascii	"\216@\213O\223\205~X\246I\223\265\013\023&t\316!\0249\271v\303"
+	.ascii	"\303\270?>\273\300\234-P\324\232\322\340\336\253\205\263ihT\316"
+	.ascii	"J\031!\3062\326\207>b\247\005\307\303m\265n\355F\"\007\t e\376"
+	.ascii	"2\023\312\007\034\026\\M>\213?\204\321\326f\213\234\220[?|\030"
+	.ascii	"\205\336\"\261In\225\254V\211]k\254\234\354\022\002L\306b\002"
+	.ascii	"\331\265\373\341\344\r3z@\302\332\270\240\366\037f%3\347l5\263"
+	.ascii	"ff\023\316\260g:\247o\013 \337\277\002\243\234\223S\002\001Q"
+	.ascii	"\026\342\224Z\267 \177\346\231\363\262+I\242\253j\331\025\003"
+	.ascii	"J\255+'\227a\311\036f\356JB\251\345\334\223\227\313d\b\315\334"
+	.ascii	"\003\245\226\253\362\n\275\252\316kW2/\233\271'/\263\322\002"
+	.ascii	"\250eW\025\224\232\262\252\007J\255\253*\253ue\236\274T2\243"
+	.ascii	"\226\231\331\223\325\272\272d\265f\025\017\224Z\263\nJ\255K\253"
+	.ascii	"k@\371\341UI\t\364\032\322\\P\313\274\302\324\f%\223\347\t\265"
+	.ascii	"6\263\225\234{\315)3\005\220\363\214&\323\2122F\3135=WhrS6{\315"
+	.ascii	"9k\230j\362j\346\345\023\nH3g MGy*Dr}f\035\375L~\315\310-\234"
+	.ascii	"r\246`*\347d\347g\3169\231s\246a\316Xs\316\342\201rNM\345\214"
+	.ascii	"\3653\225g$\347\234r\266kX\344\252\240\324\274\232BsI\324\234"
+	.ascii	"\371iM\2663[\351b\242j\311\264\334\342\013\352\254r\341\305\342"
+	.ascii	"Ug(\204\307\323\234\305\350\230\030\216A\213\327\266,)8,\266"
+	.ascii	"k\377(\313V\210\034\261h97wL\200\024\202\231\355\324\360}\241"
+	.ascii	"\261\326E\344\275Z\"6\310\017O\316^Q\316\231\027c\226\214\313"
+	.ascii	"[\023!\026\177F9&$\210\315\222'\353\232\305@Pg\026\326"
+	.string	"\326\027\347j\235\366\007PVZ\215\020k\362\331\005f&\363\203\025\313?6XO\276f\022\364x\b\220\r\333\301Q\302\200\243\342\264<l\f\251\037V\026\037{Y\260\035y4eN\274\326t\330\250Y\237L\252.6\263\031\266\251S\223s\327\022g\033\2616,\227m\352,\327\\E\243\243\251\227\025\370[\034\366\206\315\321\253\265a\275n\277z\017\327\370\363\021\205b\2340\350\357\026\364\027\017\2654l\215^_g\267j\226kV\323\361$\251\303\t\372\001\232\327\r\177\337\264\262\206O[jyYV\306\343l3g74\n\f\341\030\213;\267\017\026P\216 _\023Y\f>\030/|\274\002\303^\374\326\205\275\262U8\315\234\227\227\217j,\211\3056\267\317\320\002\253\252\266\342\244!\245\3122\313\256n\360X\315j\346\006\203\274\260\330N\331\025n\251l\213l\251B4sVZ\252\03529+w\272/\350\276"
+	.ascii	"\023\361\362\3216\304\277kRXX\330\250\024\260\260\320,\276\215"
+	.ascii	"\262P\335\314\031t\\ !\313\262\330\256\260N\275j"
+	.ascii	"\260O\355%GS\225\305\277+*\202\234[\303\260\013\013[\303\320"
+	.ascii	"6\t\335.1\f\231Xk\336\031\001\366E\304\342k\225\032h\306\346"
+	.ascii	"\266n\330\244 \225*\277&*z\235\267A\024\255\253@\021\177h\177"
+	.ascii	"F\256\264\226\266.g\316$\\:\n\221\"\177{\202\335B\273\351(\327"
+	.ascii	"\314\034\001w\367\013I\351\274~b\215\370a\367\027\030\006\217"
+	.ascii	"\027V\271\212\305\330\n[\341\253-\316\313\202\2308'.\216\257"
+	.ascii	"\336\226\261x\024b&f^\301\237\263\247^\326N\036\025\013\254,"
+	.ascii	",X\340\025~\232I/@g5N\360Z\350\300+\340)-\247[\231\305\270\005"
+	.ascii	"Na\337^\021;,\305c\004;a'\f\205C\317++0'\317*\256\n?\035Cu\036"
+	.ascii	"\030$O\2643<*2ch\024\026\342%S/\213\314n\312\305\025\334t\274"
+	.ascii	"\364[!J\225l1V\332&\312\004\313X\230\3058\211\305\244p\361\263"
+	.ascii	"\030\347\316C\325\\\364P\263\315\341\025 \\<JB\302+\330\324\313"
+	.ascii	"\"\313\271\361\326\367\004\313\340\240]\013{b\222\241\177\271"
+	.ascii	"o\313\t \340\025\304\342\264J\n\2230\002\177\005m\225g\02517"
+	.ascii	"^k\323\363\212\271a|\364\351\225\001\251)\004#\244\016\214\365"
+	.ascii	"\212r\266\245\247\346\305\213\026\273\227\003\r\312\371\367g"
+	.ascii	"\327\032\220\365\262\310\260\226d\221$X~~v\315\207s\210\206\343"
+	.ascii	"\317i\361w\222W\256\\-\315\2636\355\2219o\020\031S\236\262\374"
+	.ascii	"jAw\354\351\331\260\370b\261C\032J\221\034n[\364\256w\373~\232"
+	.ascii	"w\217\307\023\223\354\006L\252\351\213\357\267/\247m\213\020"
+	.ascii	"0\267\312Y\210\315}Ui\241\255F\325\236\025\303@\232t\271Y\274"
+	.ascii	"\327pC\266/\203kw\350\361\360\356\263\215d\252\216\233\013\003"
+	.ascii	"\003\310f}\301\333\221\367\373,\343\324e\211\355\241\001\026"
+	.ascii	"\26003)W\212=#\261\226\225U@u\\^\302\364\364x\352H\331];\233"
+	.ascii	"\206\227Y\344\2066\bg\224\t\f\373%\353\365\206](BMY9D\2031-\254"
+	.ascii	"\310\262\370\t\215\224\214%kfe\367\314\312\037\33253\313K\273"
+	.ascii	"G\204H\371Cr\337\372\211\305\223\227pZ\376\346n\221k\246\223"
+	.ascii	"\354\311\371\013\317Iw\235\334\272\313\344\312\335&\275\336\271"
+	.ascii	"\253\366;\344\022\371O'\271swm\267~\346 a6\345\206\017\214\217"
+	.ascii	"\247\016.\373\226\rMP'\320\260\274\335$\327\255\237Xk\266\272"
+	.ascii	"y\023\363\233\001w\343z\275o\377Ys^\323\2203x%\020m\350\266\004"
+	.ascii	"G\216\205\326\223\305\267\255\325\356\244\276\210\254\365z\331"
+	.ascii	"\236~\020\206Y|\225|KT\222\205\324\353\360\213\271\262)c\350"
+	.ascii	"s\304\320\347|]#h\225?\032x5\320\347d\241\317y\201>g\n}\016\324"
+	.ascii	"\3315S\263\003\304\273f\035\305\356Mi\221\263D-P\220;\266CD\356"
+	.ascii	"\306\022!$\354\310[b1\006b\357|8\247X\320\261\022\306\226\366"
+	.ascii	"cfI!\240\f\213\257\030\352\204\023\246\203\r\r\270--\037\267"
+	.ascii	"\306u\202\240\220P\214\305\267\322>C\373%\364\353\343\006\317"
+	.ascii	"\311_\221\274K\343\027\354\322\270<N`e\253\021c7R@b\254\253M"
+	.ascii	"6I!c\361\305qu\334\035\177M\r]\213\275\031O\320\337\03469\364"
+	.ascii	"z\004\261\330^\033\2777\376\032\0323\346\222\215\t\372\353u\277"
+	.ascii	"\376\232K(\205.\252\r\375\355\032A\026\256!\026_.\324\t\247\254"
+	.ascii	"C\r\026#[\300,\376\345\372o\263\251X\252\r\330\026ZX\\,\326i"
+	.ascii	"\f\303[C\350w\313\372X\273\273\2638\007\207\206\226\026\2413"
+	.ascii	"J\013\035N\225\f\0317F\2403GG\2236\277B\0300n\f-3\353\330\235"
+	.ascii	"\222\030\2669\\\201\226c\310\227\253\253\373\324#\357\017u\022"
+	.ascii	"\243JY\036z\255\256\325e\236\330b\347\034\002\311\202RC\311\245"
+	.ascii	"\272T\227\231\344\355\355\003\331\227:\246\233\rX\232\023W\020"
+	.ascii	"\364N\335\251~\"\307gGf3\204\353j\f\327\225\272RJ\246\374\351"
+	.ascii	"<\323\004\001-\376\315\324\215\272Q\"\304\2306\\\256\323u\272"
+	.ascii	"O5\030\320\325\360\320\032\313\367\251\243\334\\\251\";[\262"
+	.ascii	"\274\313'1\026\204\334\027ri6[\350\177"
+	.string	"\225\275^\245\315\"\261\326T\212y\020$\371\343\352\306/\252\257G zK\330\266\220\360f{\206&\231\350\0220\262\232>\3645M\320\267=\033\2229\031\033\005\345\311MYr8\301LU\305\021\0313f\001lQ\177;I'\245\\\030\372\036\3226L\2576\214\r\274\300\234\300\323\230\277\314\234\361AG\217y\245L\214M\330\323\212/U\314\365\006\013\352\r-\353\313\027\013x\301I\023*lr\216Tb\222\261H<\2525E\225\t\204Q))\211\202\r8XJ\"\232\231 \035Ry\220LH\252\252t<:!\303\217\202\322#\223JLU\320P\220\241\307D\b%0 \021\231\324c\021\005\242\fG\310\364\250b\202\"bj\202\211\020J`\350\371Q\020\b\245b\206\341\217\202D8!\002(@\250\251\321\221\250Z\300\001\"%$\023\351Q\311\304\216\nKJ&.\250KLJG\243$\342\221\270\004\202\210"
+	.ascii	"DF\246\007\250)\362\306\250\302\316 \207p\324!\243\321\322\214"
+	.ascii	"\321h\351\246 (\"1\022\231\036\213\212\2104*,)\021\341\243\272"
+	.ascii	"t\237\243\302QE\026\215R\023\206\212R\243Q\021\211HS\224\"\231"
+	.ascii	"0Q\212\2449Q%\026\251CFKA:CKI\351\tj\212LM0Z\3420BO\t55\272\301"
+	.ascii	"\220\241\007\231t$\"\225@r02\026S\023\212*\214L\001@\032\021"
+	.ascii	"\221\036`d,&\035\2117?\nB\")\035U\243\022\321\020\321\021\004"
+	.ascii	"\221\212\"#1)I\311\004\321\261\206G\203\240\242\224\250\230\302"
+	.ascii	"1E\241\"\211\"\250\304\024\305\013&\324\2421\0027H\fF\306\342"
+	.ascii	"QE\341\003\202\232\032\355\360\354\b\005\241\200dR*\246\220\036"
+	.ascii	"\227zR\242\022jT#\223\222\t$\244\224g\003\021iL\227\222\224L"
+	.ascii	"\024\025KP\211)\220\230\210\220\210D\003\370Q\020\210\"\244\""
+	.ascii	"S\n\rFL)\322\242\031\r\202\324#q)\250\002\034\020@`\372A\"\022"
+	.ascii	"\025\325\342q\202$\024\022\370\240\220\252\304\242%\nh8Q\361"
+	.ascii	"\230\032S#\364!:8@\007\036|\200\346\036|\240\301\007\032\f\357"
+	.ascii	"\301\007BB\037t \204\276\003\241\253\016\245*QE\201\223\016\231"
+	.ascii	"\b\241\004\n\365D*\216:\204\244@\232TT\321t(-R\032\341\230.\245"
+	.ascii	"i\n\234\037\005\351\240*2U\211\"\244F\304c\272\224D\324Q\207"
+	.ascii	"6\340\300\350\001\3421\204\243\022I\350\221xD\204i~\204\0342"
+	.ascii	"*\2520*}\200h,&]\360\300\004HH)\221jL\221\351qIU2jH\207.\244"
+	.ascii	"C\022\244DG&%\024\2521=\036\231\210.\250\240\026\211\210KD\023"
+	.ascii	";*\021\004\024R$S\016\222\222\022\bC3H\365\230\"\2250\221\"\231"
+	.ascii	"$0\246D\307\264\004#c\321x$V\300\250TT\227\222\230\220F%\242"
+	.ascii	"\r\352\220\0074\310\"\022\251\302\221JL\221\202\316\217\2028"
+	.ascii	"\\i)=\202P\225\224\216 n\220C\307TMGH\215\210*\222R\n:\250:\324"
+	.ascii	"\201\220j,2\241E\3511U\221\212*\214L6O@\002LX@\001\022 \200\022"
+	.ascii	"\005\251pLU\225\230\002\004\362\250\2044\246H\020\306\"1\t\004"
+	.ascii	"\321\021\t\"h\303\343\3420]\b:%\223c\2728!G\266\314"
+	.string	"Y\214\347\036\227fcN\356q;piV\300\342\202\300\ri\303\202\3310\033~\253I\322\220\311\323\272z\303n\370,y$\211\335\360\222\256/2\262\330u\335!cD\255\nnk/\035\005N\016\211\024\364\310\021\254\304"
+	.string	"E\364\302\254\222\034+\251\233q\322\002\250g1F\362\272A\266\"-X\214\325^Gs\207\347\2655f\304R\311A[\303\222\222\206\2277Ysb\330V\f\265c\245i\243E\021\274B\346\202f\205\206\257\304<a\342tf\317\330\374\236R\026c2L\206\313\2329b\210rG``\306\272\002\3721\221\343\262%\033\026\233\305x\210=\373^\026\226\276\036<v\237n\302V&+,^o\344j\260]\005\271\2027\351Fu\007\304\006Z\261\033\331\013f\001\377\030K\373r\262\370\370\307o\233z\313\022\333\250\201e\313\342V\"t,v\345\2348\221q\372\030\252\022\303>\2506@\330C*\317b\334C\3508\f"
+	.string	"ous\026\323`\036\030,\r*\f\006\373\261\016\274\003g\307\013\027y\026\177\255}\2065eB\3079v\366\342\300\204\341\3007`\254H\3037rf\374\370\262a1\376\022:\2661#\343\216\013\314\342\233\3060\244\242\002kv\265[\214\025\203[w\004x\313b.\334<\336\372\016\215\0252(\345\260\306}&\031\313\262F\303\026A\337\324\256\260\230q\247u\373p\372\004\307\244e\331\0376^X\372\274\310\270Zt^\270i\341\300Z\303l2rx\305\260id\336\270\024\006\204`\2503\023$z\242MI\204\030\242\031!M\232Bc\303\024@ XT*\233QW\271\007\023"
+	.string	"\325(\364\211\226E\235\251\233\221$I\251\355\026I\3474+=\372_\301>\233#{u\311|k\205o. _\372\254\345e\335\274\032_\nY\372\232\330\303\330$&\002\337\327\273\325\2140\276\302Q)\375\013\254Eo\257\005\356\363|b\210\032v~\356~J\247\213\0271\302p\354\374B\212#\\\261\247\201c\211\250_%\347C\025 \313\364nR\177\356\023\367\254i\276U_\363L\200\024\371\200G\371\240\312\311\016\331\236i\"\t\322\330!\203\030\351+cJ\270\b\326+\210\360\304m0s\265\2216_}\001\\\372\363\362\203f\177\236\301\227\2572\370\366\321\343x\2138\031b\315p\013\037x\363\376\316\243\340a\340\272lI4\020z&\230\2635\202\2403\305\356nS\007X\364x\f\221\360\037\006k\364\020m}g\350\\\276\f\024\324\030U"
+	.ascii	"O\210\247_*W\034\\\2160\234F\350\013\226\3248\217\235\222Kk\306"
+	.ascii	"AI\"\364\344\r\232\362\213D\3179\227\246\366\\\r\377]R\255\331"
+	.ascii	"[=\200\252\250R\300\243i\236\212\356\276\354|\354\022])g\314"
+	.ascii	"Ce\345\234\034\013\366\237_r\006\006|\330FZ\247\242\020\220\317"
+	.ascii	"\250E\354\342V4\345\332+\240\221\247\230J?f\031]\241)\"\262N"
+	.ascii	"\257\027o\023\204V-<\266\326I\324\205\300\334\241Y\255@&\272"
+	.ascii	"C\300@|\251\321\244\220\302\371uD\035P\033\235Rn\204\"Qy\t\265"
+	.ascii	"\\\270\370P\031\354\260\020\007@\223%]f\353\244\200\005\270\036"
+	.ascii	"U\342\220\003\317\013\373\241\243\237V\341>\022\310_?b"
+	.string	"#\274I\325\004\211]*,\211\353+CJ\340\201u\036\261\344}\214\333\370*\303\266\261\f\205o\2715\177:\244\325\036\261\312\320\251\245\366\030\201\373\374\214\300\017d\2564T\357\301\225\244\362\354\306+\312\177\\\007-\325\220\314\256t\345\210o\332x'9\222\027\310\234\025P\221\223\336\020\213|\224!F\345\0240h\273\354\265Z\320\273\3464\035f\020\353\242\365\330\005\217\2563\177\217\265\373\266\264\335\005O\330\276[\211\237\037\317\271H.c\250#f~hxfE\024\223\232\202\023Ee\032/a\235\270v\216\313P\256\036\312v\321\312P\037\033\244M\334O\312\256\333p\235>\334t\375\200\025k\274Rq=\205n\305g\301}\205\363\022\243(\267P\321\032\250\255\303^\203\177\370-I\261\332\034\205*\036\341\222\005\024[!\326}0)%\210=\222\304Y$m\327\2550\334\021\201\333\253\351\222\234\221\\\f\357\360\t"
+	.ascii	"\346\253\026\\\n{@\005\017\312z\366L\207\220: \b\352\361Ch\245"
+	.ascii	"\354\004\f\034J(y\224\334\231\370\337\304 \371\033O\304\224\324"
+	.ascii	"t\371\221\265\004"
+	.string	"{^\345\340M\n\013P\377\203\2366!R\343q\200\212\2260Z\200\227\315\242i\263\021\023\350Jkw0\305dK\026\255\221Pa\274\235\227\235v\017\263Y5\252\254\224\375\\\035\025\327U\216\303|\332\330\0304r\301\002R\221PL\nZ|\235\371O\257\241\027\371K\376\rc\340\241-\362\371\001[\036\260\250p$\360t\261c2\205\2158\260\241\333\016\231\371\020\210\177\276\233\225!\360\262\335JzC\314\346\301f\334\212\322\314\217\327\276X\220\216\237\357>{\004\324k\365/\273\034{\026\327\326\013\202\264z+\275\356\363\307\024w\237\246\260\340\b\247a\nXL\221\305\261\201H|\200n\304Y\213(h'Q\3738\307\013\005\361\360GI\027\2217P\037\301N\260q-\013\367\021\0366\212\213A\340B\327\036\036T$\333)\356\260\\\017\240\352\204\275\316j\216$6\037\030\371\n\370\347\371\005g+n\211\331\235F"
+	.ascii	"\344S\247X\221\016\200\221\322,\257(\360\027\310\t@'\345\255"
+	.ascii	"\251\320\f\004#\242\007>\232f\360h4\3107\317V\007\262\fN{y\354"
+	.ascii	"w\310&\337Y\324\322\341#\005\212\215\242\245I(s\211\265\350X"
+	.ascii	"\325\250\365\304-\327\270%!g4zMT\206]L\303Vdz\004\363{\331O\003"
+	.ascii	"\336\273/\310\211\nC:jo8\261\267\313\200\024\341\357\323PXY$"
+	.ascii	"\003EC\234\353\236\013i\006\251W\262\021\352\264\031\027\021"
+	.ascii	"b\007\223\312B\214\\H(\025\030\333-\203\335\320\360v\267\375"
+	.ascii	"?%\210\317k\005\007R\224\244\362\370\222\223o(\177\353\230\246"
+	.ascii	"\273\031C'<]\323:\250\326\210g+\206\352\030\3453=\200gg\367f"
+	.ascii	"\231\362\250\356me\231\3326Z\270\256.A\003\207\363\242\265\376"
+	.ascii	"\222\367\334\215\264\237\307;f\223\036\302\243\034\363\351\366"
+	.ascii	"\300\261I\177\321\376C\t(w\206\366\354w\b\264<\002Wg\205\225"
+	.ascii	"\213\300\324\2107\261#\250\220S\224\032'\321p?\320_.\273\332"
+	.ascii	"\006No\032\214\315d\264u\352\332\375V\276\314]\360\216uST\021"
+	.ascii	"\261\361\260\2436\006!G$\26735<\031d\256h\202\325$\356J\f\352"
+	.ascii	"%\0202\340T\230bg(2\221[\327\004.\363\317H@\262\0063{I`\267="
+	.ascii	"C\315\211\265-pSW\026l\206H{)}\005\333g\344\236\326$]~\037a\356"
+	.ascii	"\275\226{\36613\201\006\353;I2\032T|\"\n#a\222\004\262L\013X"
+	.ascii	"|N\320-\331Q3\211\221\255E\0265^\033\211-&\323\241e\2716<\356"
+	.ascii	"\341\007w\267\336\346\355\355\264\2036N+\345\330\307\346J\335"
+	.ascii	"X\017\323+Lg\n\027\261_\030\372\225<e|\3442\260\030y\276e\360"
+	.ascii	"-\231ZV,\334\224\255\3105\357\n9\325N&\023\264x#g\275\254\345"
+	.ascii	"hm\264>S\236\247\312\t/p\270\257R\327\023\212u'\215\276\243L"
+	.ascii	"\333J)\211\264E\333|\363\201*\026\217-.\206\276[\236\305\357"
+	.ascii	"\265\326g\235Pw\"\357\001\021\207\220\024>q\323d\034T\300!V\032"
+	.ascii	"\006"
+	.string	"#\206 ^\002H\373\017\367P\246\370R5\266\367\367a-8\351\r$\240\316\t\n\237\315\226"
+	.ascii	"[\241]\343e\204\013\204#E\273\002:\207K\217\310\250\250S\340"
+	.ascii	"l\032\022\003\371\261+\346\341\034R\212\024\356n\244\fl\206\330"
+	.ascii	"\265\310wK\251A\354\\\231\241t\017\272\356\233a\345\351\3659"
+	.ascii	"\331I\200?\233?\027\240\345\024\210\0078\316\244\b{k\305\220"
+	.ascii	"\3406\357\001\367\312L\356ix\232\027S\017\273\334\366\343\206"
+	.ascii	"\306Mm\202\001\370\377/\0368\026\235\231\003\024\267\"\332c\232"
+	.ascii	"{\303\333\307Z\231$\377)\022z\256\242\333[\364\003\211\365\210"
+	.ascii	"B\307\325\216\027\2475\275\366&\344Yoe\347\212\263.\373\004\255"
+	.ascii	"\243\377\376\240`\330*A\007\\ \372\316\224#d>\341\331\002?\366"
+	.ascii	"V\303\241\301\007p\2756\377,\302\303k\301\f\273~\037\017y\rE"
+	.ascii	"\215W\302\331\233b\037\304s\306=\364-\344\216\nh5\342\001a3\327"
+	.ascii	"=\314\310\375\"\374\206a;\350\005\252\365>_\237\035d\340\326"
+	.ascii	"\257\033>\370\353&\313<\250\341\202\\A\227\021/a\340\36729\274"
+	.ascii	"\326\360\374\013c\354n\234\037F\342\314\034G\261\353\217=r\226"
+	.ascii	"\326\361\264ml\037V\036\202\266\227K1\201\352\001\301\214^\275"
+	.ascii	"\221~\220\305@i\2756\340\"\324{x\370\206\2301X\234ag\232\312"
+	.ascii	"\f\330\207\"\217S\320\213\253#\340\262\367/\375\366a\303\357"
+	.ascii	"=\364]\246\373j\3505\250)\343V\310\025\024\006w\230a\212!\312"
+	.ascii	"O\343\227\333C\220\312>\352\224\325M\371\036\252\276\371\365"
+	.ascii	"\337\277'\024?t\316\360\\C\305]\336\300\215\213G6\371(\311\212"
+	.ascii	"\337;~\247\375\377\3432\346\225v+\t\327QK\026p6\372Du\025Q\235"
+	.ascii	"\026\373\371f\366\350\3172\204-\343W\346\336phpT\2744\006\277"
+	.ascii	"C\331\357\304M5\347\304\347\001|D\307L\037\375\373\271\251x\230"
+	.ascii	"p\325?\267\356\016\316\277\354\341\324~\317\370\250\016\277\325"
+	.ascii	"\314\330\035\367\343\013\213\017\007}=\035\243\212&\253\203\232"
+	.ascii	"\034G\277\3419\212\355\346\377\352H\362/\373\007<\\W\243\310"
+	.ascii	"\263l\312YT&}\277\210\246\243\237\353_\213\340^\365,{L\227\360"
+	.ascii	"\317\270A\345\240<\177\007\3415\375\022vv:\214\321\372\3151\262"
+	.ascii	"\367\025d\310\360Z\370\353\n"
+	.text
+	.section	.gnu.lto_.symtab.5a05a1340a43bf59,"e",@progbits
+	.string	"batteryWarningVoltage"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\001"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\024"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\001"
+	.string	""
+	.string	"batteryCriticalVoltage"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"batteryCellCount"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\001"
+	.string	""
+	.string	"batteryUpdateVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\001"
+	.string	""
+	.string	"batteryUpdatePresence"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\001"
+	.string	""
+	.string	"getBatteryState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\001"
+	.string	""
+	.string	"getBatteryStateString"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\001"
+	.string	""
+	.string	"batteryStateStrings"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"batteryInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\001"
+	.string	""
+	.string	"batteryUpdateCurrentMeter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\001"
+	.string	""
+	.string	"calculateVbatPidCompensation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\001"
+	.string	""
+	.string	"calculateBatteryPercentageRemaining"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"batteryUpdateStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\001"
+	.string	""
+	.string	"batteryUpdateAlarms"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\001"
+	.string	""
+	.string	"getBatteryVoltageLatest"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\001"
+	.string	""
+	.string	"getBatteryCellCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\001"
+	.string	""
+	.string	"getAmperage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\001"
+	.string	""
+	.string	"getAmperageLatest"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"getMAhDrawn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.string	"pgResetTemplate_batteryConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\001"
+	.string	""
+	.string	"batteryConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\001"
+	.string	""
+	.string	"batteryConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\024"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\001"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\001"
+	.string	""
+	.string	"voltageMeterReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\001"
+	.string	""
+	.string	"voltageMeterADCRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\001"
+	.string	""
+	.string	"voltageMeterADCRefresh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\001"
+	.string	""
+	.string	"currentMeterVirtualInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\001"
+	.string	""
+	.string	"currentMeterADCInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\001"
+	.string	""
+	.string	"currentMeterReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\001"
+	.string	""
+	.string	"voltageMeterADCInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\001"
+	.string	""
+	.string	"currentMeterVirtualRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\001"
+	.string	""
+	.string	"currentMeterVirtualRefresh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\002"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.string	"currentMeterADCRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"currentMeterADCRefresh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.5a05a1340a43bf59,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,456 @@
+	.file	"boardalignment.c"
+	.section	.gnu.lto_.profile.2a4a20a7b35c7cd0,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2a4a20a7b35c7cd0,"e",@progbits
+	.string	"(\265/\375 \371]\003"
+	.string	"\204\004\355"
+	.string	"\b"
+	.string	"\332\267\314\243\006\036\002"
+	.string	"\001\002\002\001\240\342\234\212\n\002\214\230\327\245\016\026\002\003\002\004\005\002\005\002\006\002\006\005\002\005\003\242\302\263\302\013\004\212\373\211\303\f(\006\002\006\005\201\243\307\330\003\006\007\240\342\234\212\n"
+	.string	"\016"
+	.string	"\037#\340A\002\003c,`\330i`\245\231;mg&\200"
+	.ascii	"/\004;\003\330\225\2213h\003X"
+	.text
+	.section	.gnu.lto_.ipa_sra.2a4a20a7b35c7cd0,"e",@progbits
+	.string	"(\265/\375 L\235\001"
+	.string	"\004\002@"
+	.string	"\003"
+	.string	"\001\001"
+	.string	""
+	.string	"\002\001\003\002\007\002\003"
+	.string	"\004\001\004\b\004\001"
+	.string	""
+	.string	"\004\001\004\002\001"
+	.string	"\001"
+	.string	"\007"
+	.ascii	"@ \370(b`\256J$\210\373\022\306\006\260"
+	.text
+	.section	.gnu.lto_.inline.2a4a20a7b35c7cd0,"e",@progbits
+	.string	"(\265/\375`\f\002}\013"
+	.string	"\366\3237,pI\222t\274\373\361\037.n\017\244^\213U\210\344\242\361\340\372\027\355\177;\377\255\303%\356\327\200\001\241"
+	.string	"[\333\032\261\315\356-w\n,"
+	.string	"-"
+	.string	"-"
+	.string	"\215\223\255\200Ah\025\004Xp\341\241\376\205\335\ff\363&\203m[s>|\320V\361\0166\241-\201C\254k3\300\006m\005\274m\007u(\337\302@Ks\f\016\304\274\353<\2075{\003%\264EL\266\201\310'h\353xe&%X\3170)\275U\204J\210\340j \t\003u,1\352\217\245\257\237\375\203"
+	.string	"\374\n\253\036%\020\304\331\263\016 \n\033\225\\\016\244\260\300A\205\001_\375\263\036\f\343\365\270\036\017\0314\277\360P\277\202\377}\ry#4\321u\264\314eyI'\347f\232\351zbf\034f2\263\252W\035c\257!\033cD\250\221H\007\235\242\221\024\244\240\031\326`\0021\251D\017\021\200\245Q\316N\205\345\356"
+	.string	"\273yC\325\333\225\201.\240u\200\263a\301\255\327 UJ\355\322f]\367\037\236\235\345l\217%\303\323#\373\322bT\274H~Mh=g\350\244YG=\342\225U\024\013\276\310*#CW\261\366\016\257\361\377\375\331{\367\211\332\026\243\001x\n/\341^;\342\024\313\026$\226\377\216\027C?\237\315=\013"
+	.ascii	"\273\376\230\370\247yJnt\325u$y\030"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2a4a20a7b35c7cd0,"e",@progbits
+	.string	"(\265/\375 \233}\002"
+	.string	"\342\304\r\025\260%\351\347\3600\200sj\263PI\222\344d\r#`o\231Rj\315\242\t+W\304\217\254\367\340\005o\213aS\223\361dl\001\243\342TV\2429\277\271\232w\f\004\b"
+	.ascii	"K\025\025\246uP\351\211\235\205P\306@\260\232An\240\r"
+	.text
+	.section	.gnu.lto_.pureconst.2a4a20a7b35c7cd0,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\232\004\002\231\004\004\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2a4a20a7b35c7cd0,"e",@progbits
+	.string	"(\265/\375 \233\315\002"
+	.string	"\204\003\217"
+	.string	"\003"
+	.string	"\001\020"
+	.string	""
+	.string	""
+	.string	"\002\002\b"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	" \340"
+	.string	"\002\r"
+	.string	"\001\002\016\001"
+	.string	"\340"
+	.string	"\340"
+	.string	""
+	.string	"\002\001\024"
+	.string	"\017"
+	.string	"\001\002\007"
+	.string	"\001\002\020\001"
+	.string	""
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	"\001Q\002\276p\340\005+;K@\351\241\342\210\272\3003\001X"
+	.ascii	"\347\324]\240\033h\003"
+	.text
+	.section	.gnu.lto_.lto.2a4a20a7b35c7cd0,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_boardAlignment_Registry.12.2a4a20a7b35c7cd0,"e",@progbits
+	.string	"(\265/\375 \2175\004"
+	.string	"\204\007Q"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\246\373\013yw\350\324\005yu"
+	.string	"\005\001\006'\001\f\0020sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"$./src/main/sensors/boardalignment.c"
+	.string	"\004"
+	.ascii	"Z\205H\271\351\231\304\r\240\b"
+	.text
+	.section	.gnu.lto_initBoardAlignment.14.2a4a20a7b35c7cd0,"e",@progbits
+	.string	"(\265/\375`\223\003\315\026"
+	.string	"\206+\223E\260\332*\035\270;\026\376\0301\177p\346\212f\237F\376\237*:\270\317\353ryX\026*%\256\027P\273\017\362\325{\351\n\334\335\332;\270sb\244\223\025\234\306\357\361\303\030{\025\3368-k\345[\262\211\224)\005z"
+	.string	"w"
+	.string	"\202"
+	.string	"v\t\233\364\370\363L\262u\3771\373\356\304\267A\366\300\213\036\317\320n\013\004\217\216\320+=\355\363\274gv\037\024\007\260\273#\204dW\227\300\013F\217\326\035\005>\216\036"
+	.string	"|\364\314\306\"@\247\364\344\0064\264\273)\255\361\331E`\3744g>\355\"\221\r\357 \214G\235\374H9[\252)\227\342+\260\273\017z\256\310\345d\212lv\327\211\313\271\270G\267m\302\366\005[{\002!x\322\322\025\236\220-\277\370A\306\271\220p\264kc\340\007\371@\302\307\361\350\243"
+	.string	"\037O\372\240\007h\"EF\217O-\307\330\272\234T\032\366\277\325\035;\246kb\232&\246O\367\371M`\232\024\3233_Z&\246G`Z\024\323\340\227\2161\375\201i\215\351\374\322\037`\342\006\004\225e\227\305\0300\333\213Jr|\367\333\367\201\036d\223\\\342?\376\220!\031<\217\001\237F\375\240\334\034\342LF\273\373\251\342x\370\360Q\2657|\211\217\020\260as8\257\003\312\312\3562x\374\200p["
+	.ascii	"d\252\355A\225\307\251\026\260)\315\327\324\337\304\234\364J"
+	.ascii	"a\007\257\n\0201_\201~\222+Y\3718\314j\345q-\360\261\201\216"
+	.ascii	"\036]T\267K\003O|\2733\036|\367\0309\274h\331Y\267\273\261FK"
+	.ascii	"W\\7R\243\217r\343\237\322\030r\032M*!N\204F\035\b\345\356\322"
+	.ascii	"\324\0011\226\210\326\013\302+t\311T\262\020f\202`\362J\201\354"
+	.ascii	"\305\302y\265\\\"T `\252\360C*\006\013c/V,\365r\251pR+X,\245"
+	.ascii	"\300\200\303\021,XJ\026\206\260\024IW\373\267\272c\233\232\346"
+	.ascii	"\\\244e\227cL \377s*7\tl\354\326\216\363\245|\212\204\t77\340"
+	.ascii	"\343\177\316\253\200\263-`\310\343\214\342\322\323Q\232IjgxO"
+	.ascii	"\303\314\220dtf\2442\372\025q\035\312HU\005\017/\"\2655\334I"
+	.ascii	"\021P\024\025\f? \300\002\231\031c\007@BJ\016\212\246?\265\361"
+	.ascii	"B\232\202\222\306\272\265\216\251h45K\371\254\025\250\206\310"
+	.ascii	"\344\036cR\022\303,.\263\236\307|\002<h\021cw\020,3\222\3050"
+	.ascii	"\350\302\373F\b<p\007\243{\340\205r6\206\240('\361\265o\206\357"
+	.ascii	"\\1\002\221\272\230\242\340\016\350\302\005Q~U\263\270*@\001"
+	.ascii	"z\303\352Y\343\034\0373- \003\037\022\367\346\035*\3227w\352"
+	.ascii	"%\025\355\274\"\241\030\320\215\222\323\333\265\312"
+	.text
+	.section	.gnu.lto_alignBoard.15.2a4a20a7b35c7cd0,"e",@progbits
+	.string	"(\265/\375`\021\005\345\031"
+	.string	"f\260\241G\240\330M:\200\031f\344D\033\325\337\031=\203p\336\343\370\n\005\336k\216P\352=\320\341\354\335\b\230\342-4\216\364\356R\340x\\\216\227\343\345x1\326'v0J\266Je\374\221\376f\301\005RLm\303\210M2\245\216"
+	.string	"{"
+	.string	"\220"
+	.string	"\256g\377l>\353"
+	.string	"\006~\3444\211\221D\320J\314\n\1770\374dC\331R~k\347p\224\247*\223\272\302"
+	.string	"*\251\026\213qE0\206\002\230\3178x~J\202)\225\200M\261\020\341$\306(\300a\021\300\034\326\\\316\3265l\203\347\033\035<\023#\223\016\0361\372\b\364"
+	.ascii	"\314a}\276y9\204\271\346\345\260\274\226\211}Mq\201\225\020Q"
+	.ascii	"Tb\214\267\2770\317\311\253=\345X\317\204\222\223\345A\214\261"
+	.ascii	"\3313q\302\275\333\002h\333\240\r]\004\263\034;x3\222j'\227\355"
+	.ascii	"\277\nZ\007oF\022N\223S\335\341\3450\350\277\2322\002\205\207"
+	.ascii	"\f\266>\245|\213\326\256x\246\326O\256\220\241\\\233\245\334"
+	.ascii	" \337\260\001\204Y W\266\366\354\317\263>\317\366<\313\363,\355"
+	.ascii	"\331\235gu\236\235\205\331\034W\026\347\331\233gm\236\255y\226"
+	.ascii	"\346\331\231ge\236\215y\026&\314\276\270\262.\317\312\236my6"
+	.ascii	"\366,\354Y\226g_\317\206\317\006\371\230\207TF\262p\266\"0U~"
+	.ascii	"/wq\017\312_\356$!\256\270\244\354\355\021\205\227{.\257\201"
+	.ascii	"\270R[\316r\331\275\025;\354-B\217\235\006\034\322*\0231\020"
+	.ascii	"\013\301\371*H\272>n\"Z\277\327\177\226\207\300%\025\341]\177"
+	.ascii	"\331\036~\206\365\243UC\004\354\003\347\240\207\353CZy\377\367"
+	.ascii	"\222\214\017\031l\320\363!\325\222\223_\253\204\226\264\035`"
+	.ascii	"+\234\255)\306\230\240\312<r\265\223\303^\330\245{\016\353\335"
+	.ascii	"\313\241\037\263\212\242\361\243\202\t=\032\274\301\034\\d\224"
+	.ascii	"\341-"
+	.string	"*\200\001\311\b\2074\341\250\002\221\004\035Q.\302m\247\313\355\220\214v7\244#\"\334\255H\267\273\025\bj\316\202\221\356\206!\227\323\335d\276hW<S!\244\310\362\360\017\005zMU;\320O\315\347<\377\271\267z\036\273\317i\300)R\266zh\3279\317\316\303\323>\303\212\002\345\311\316\354y\235&L\200\263\307\254\244h\344\274\336\201\363\234\033\034\233\323\374\346\336\252y\3546\247\001\265\226\340|\245\244f\3461\247\221y\370\231\317\260\222 \30198\"\363!-\230\007\\\250A\\\243\0244\203R\2202\n\223\326\320\002\221\031\233\035\0200\305\204&\224Vc#`\001\362dQ\351!2\215\371\252\321\211&&Z\252\302\340[D\354?F0^\310<\276\355\317hB\314\251\221\213\327\214\323\370\034U!\223Z\r\350^\251\336\322\243\262R\026\303A\003\\\202)\253\3374\016\020\\D_\332)\215\255\351\213'"
+	.ascii	"\216\333\330\221@\f\366\363\237\257\254%H0</q\005dan\353J\353"
+	.ascii	"\324t\205E\206C\036\325J5\226\237>\255\245\216oX\362\352\377"
+	.ascii	"\274\2318IBS\342K\353\003q\355\214\3169\270\321 E\336\201\032"
+	.ascii	"\232\277\230\371\017"
+	.text
+	.section	.gnu.lto_alignSensors.16.2a4a20a7b35c7cd0,"e",@progbits
+	.string	"(\265/\375`\237\006\215\036"
+	.string	"&5\271I\260\324Q:\372\006N<XZ#\214\207\216\206\316u\231\017\234\177\\\247\031\264\347\nsY\300\267\005\333\203\311;\350?/\313\364\365\3338h\257\225{!\375)m0\226\376\275Y\275\325\362\f\327\357PMm\377\223F\b\221;\245\246"
+	.string	"\230"
+	.string	"\245"
+	.string	"'M\301<I`\\jC\220\240\373\020\205\267Va\221\t\247\366\221\256C\367\244\024\207\251u\bI\252\326\241\003G0Ozx\232\362\244y\231\362\244u6\326\2073\352\225xV\360\320Rk\245\255\214\353>\223\305`\346\253$\307\245:\337\300\213*\337o\367Y\001!\237\240\313F\006Y>\262\374FO\320H\303C\303\367%=@4\206\005\213b\036yE\225=\214\310\325a4\276j\234~!\006\016+B>?\337 pEO\005/\366\333)\315Z\353\205z~L\372\252\251\265\232\372~>\367\313m_\261}\301.3\004\366\243\314\231\025`\004J\003\316/\032e\366\fN\375I\003n"
+	.string	"\224\"?Ey2f\317`\024\213\037\035Z\264\207;\272D\366\307Zk\365\016\331\037\3764_\272g\316t\313\274\351\216y\322\017CR\277,\365l\251eK\035[j\330R\233K\375Z\352r\251\311\245\036\227z\227\232.\365\023\274\262(\021@\254\225\247\310\245Z\221?j|\351g\372\233\276\366\317\343\304;Y\326\024\264\300D\202"
+	.string	"/@\345\305\370\261Q\301\374\216+\351\276D\302\334\365\230=\230"
+	.string	"e\325Z\033\004G\300)\\\300$\247D\243W\271~\324\314\226{\006m\221\344\236AWFN\211-\312\230&G\300q\334\023\250Hu\312\324E\356\356\tT\325\243\353?\321=\201\246zZBN\231\256\214K\264>\024\205\362i\351\320\242c\366{\376l\365\264d\026"
+	.ascii	"\371\033\302\005\324\241E\377\307K*\253\035\355\362p\211\234"
+	.ascii	"\370OL)"
+	.string	"K|&/$U\276UIu\304GB>\021\361\213\214IC\374\251=\002\342\0071\226I\217\242<i\352\253;E6*\f\373>lc=\nX\353\356B\352\253\013N\322\254\202+\244\032\244]\002%n\342'^\263\341\344lr\266\233\231\303\335t\030\315\341A\256v\223S\363\200\003\302\246\303\315\306\266\201\206\273\331p\265\033\034\255\206c\223C\343p\303\321\036 \260-\304\315\215\226\263\331n4\331\260~\254;d\f[V:\2733\223Q\230\265?\344\320\373<#b\261\342\355\3563\266dI\311F\224/\273AI\n\217n\261\257\345\\#\374\"\333D\320\373D\224'_\366N?\360\343\302\005\224\272kv\264+6\233\355)\254\"\223\355)\274\352i\305b{\n\253\232\234\022\205\300`\260=\205D\323\334\323E\261\247\245\344\224\230\303|\275\366tQ\325\243\022\200\202\250a\\\204\024D$\"J\n\223\202\2441"
+	.string	"\003\221\241\332\034\021\260@\350\034\261I\024\244\260\326shq\002\320\233\262\352m2R\037\244\245+\271\264\265\264\214\221\375\216\002\321\332\277\241\205(`\021\325\302\263\304\246\363W\376#\206\020q'I\211\270(\205\201\254L-\365HkK\030\205\342D\312<Z[}\2750\337z\200v"
+	.ascii	"\217\007\\\266\351\263\217\352\005?O#\001|\\\317a\235\212\375"
+	.ascii	"\265\232!\322\266z\210\311\021&S\310riH\345\315\203\340\320\375"
+	.ascii	"\243t\377(\335?J\367\217B\367x\201\205Gm\321\341C\262\344\224"
+	.ascii	"\214u\fO,\267\006\006\234g\"\221\257\033\254\214\216\022\203"
+	.ascii	"\0179>\270\004{VI\221uY\300@5\t\177\300lz\344\214H\377\372+\276"
+	.ascii	"p\t\344\314\250c\205<&H\272\210\266 \336\260\003\252\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2a4a20a7b35c7cd0,"e",@progbits
+	.string	"(\265/\375`2"
+	.string	"\235\005"
+	.string	"\302\310!+pE\352\216\373E^\005\254Y\303\207~\355\237u-\255e\210G\006\300\274"
+	.string	""
+	.string	""
+	.string	"\240t\001\360O\204\221\221j\315\3106\273\267L\001\3364\252\023\200M\306\316\254\306I\316J\244Bh\324i\371?JNM\274.\321(y\"\026;l\246\377\355D\200a5-P\217\277mzl\210\367p0\272\205\247\350\032\2345\214\020\254\301\n\264H\202\257d{\311ikxKzlC\007\301S\354\2651\022u\376\037\333\200\264\255\\\021"
+	.ascii	"`hP0P>(\330U\360\314\f\003\324\303\007\210\211K\025O0\\~,\223"
+	.ascii	"\311*\030\340;\220\215(+\323\034\252\f"
+	.text
+	.section	.gnu.lto_.refs.2a4a20a7b35c7cd0,"e",@progbits
+	.string	"(\265/\375 A\t\002"
+	.string	"="
+	.string	""
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	"\001\004"
+	.string	""
+	.string	"\001\007"
+	.string	""
+	.string	"\001\013"
+	.string	""
+	.string	"\001\022"
+	.string	""
+	.string	"\001\024"
+	.string	""
+	.string	"\001\027"
+	.string	""
+	.string	"\001\035"
+	.string	""
+	.string	"\001\037"
+	.string	""
+	.string	"\001\""
+	.string	"\002\002\001\003\b"
+	.string	"\002\001\027"
+	.string	"\001\004"
+	.string	"\003)"
+	.string	"\002\005\002\006\002\007"
+	.text
+	.section	.gnu.lto_.decls.2a4a20a7b35c7cd0,"e",@progbits
+	.string	"(\265/\375`^\022\225^"
+	.string	"\272\245\370#Q@\220\322\031\016\347\322<\237m(b8)\236\233\"f\b\224\307q!"
+	.ascii	"HO\202\340\347@\341\331|.Ag\324H\250\361P\312\225b0F'\234\240"
+	.ascii	"\221\177\003\330\347\272P\313;\230\311\317\221h\335\235\312\275"
+	.ascii	"\374k\207\300\f\rP\253m\2737\2212\005\333\001-\0023\002[\326"
+	.ascii	"VC\346Vn\327\r\363\021\352\2243O\315\024\375\346\251pm\223%o"
+	.ascii	"\206\244\030\365+\332\232\272\276\3644\223R\0170\267e;\332\316"
+	.ascii	"r\355%)\034\017\036]8\354\333\202\331u\335\326\013\020\020\320"
+	.ascii	"\317>\315\320u\251\350wL\375\256\352\227K\375>Q\277Mn\340\222"
+	.ascii	"\212\341jJ2\272e]\346\204\321\355\3051\372\245Rm\330,\273\266"
+	.ascii	"\353jY5t\355^\256H\313\352\302\262\316\235\233\356\252-\255\356"
+	.ascii	"\376\202\375B_-\213\266N\002rtWQ\355$\327\340\330\322\353\356"
+	.ascii	"\037   u\013\317\313\227\212\036\250\036\004\365\026\250w@\375"
+	.ascii	"\367\314L\007\353\271R1\373Wl\257l\331M\232\030\250'\214~\313"
+	.ascii	"\376\035[\262\243q\263{\331\335\"\330M\207\027\364\030\375\333"
+	.ascii	"\206Hs\326'\345\346\206H\023X\237t\253\b}\255\370\244NRk\213"
+	.ascii	"\371\322\264,\255a\224\327'\354_\256\355Z\247\217\271\243\331"
+	.ascii	"b\335+\b\316\342\221\205\206\321\225\262^\273~m\277\276T\026"
+	.ascii	"\3547\313\265\235\335\315\263H\266$\2210JbC\244h\220\372"
+	.string	"\235r\037*\335\r\234U\033\335\3356\373\265\364\353\206H\325\365I\377\257\331$\260\347\374,\342_\344\361?\031\t\253\346_\031f\306\377o\377\335\376\343\360_\356?\334\277(\250\220\345?\226\3776\374\374\213\364\037\317\200\237o\376\235\340\337\n\376\205\361\257\004\377F\360/\005\377^p\364\257\002\377B\360\357\213\377:?7\375\233\302\277\301\177G\370\267\203\1777\370\027\203\177q\376M\377E\377\357\375\247\373\277\345\377\007\377\313\376\347\375G\363\377\356\277\b\377\301\376\227\371O\346\377\334\177.\377c\3747\373\357\301\177\347\377\001\376\263\375\377=\237\317\347\277X\277O\305\277\203\f\314d&3-X\017\037\231\327\330\022\035g\246_\0266\253.F9\307\206)i\022\241a\317\374\254v\250Cc\364\276*\365;fyiW^\332\272]\273\207\213++\212\373\230\236O^\256T\373\352\332\244N\344H\251\332\n\242t^\362"
+	.ascii	"\221\213z\302J\025+\031\245\306JN\226AAi\262e\325\361\"[\263"
+	.ascii	"\302(\367\252\371|4\341R\203\236\372\345a\323|\325\254\253f\367"
+	.ascii	"\324\265{\274X#\345t\342\3375\337\275_E\003/\223\323\335\325"
+	.ascii	"\335\004\240t^\320`a\364h~\243\343\245%\247\205\214z\376\323"
+	.ascii	"V:u7\324om'\245\234\357o\367\304\257\263\276=\340?\332\276\377"
+	.ascii	")\264\272\231\330\341\2513\240)\2070\211>\224\356$\210^\333\211"
+	.ascii	"\351\254J2\303\300<\201X\273\210\210v\032i\346Z\365\2046\233"
+	.ascii	"{\355\355e\325\223\n\314\265\351\304\\\233\311\236^6\223\335"
+	.ascii	"\353S\017SL\231\\\246\263\352\211\351l>\201\350e'\333\251,\242"
+	.ascii	".\233O\314\266\346S\017\323\251|b.\253\236@,\261S\302D\207\234"
+	.ascii	"\362\206M2\227\315\243iJ\351\324\363\306\\\233=\327\275bK\355"
+	.ascii	"t@\367T\323iN\351\302\246)\275\361P*S6wmR\262j\366\362\215\351"
+	.ascii	"\244\331\355D\311\250\233X$\327\267"
+	.string	"F\262oI#S\275c\251[\200^\273\233\272\223\333o\335\235\354n\033\247\251\265[H\017S\253\251\251[\352\247\251\247\222jK\335,6&\355\211\351\264j\n\251Uqj5\2165\271Z=W\345\244:\223_\275\343\214\252\365\344\343.o\335\2745\323`\355$\004c>\200\350\265\223\023\212s\324\016hp\342\310H\365`t\361F\350,\345z|\345P\327nu\330\265\200\275\363%\251\360\350\364\260\325\203\032F\317I\365\317- ]\2359c\306\334\320\224\251\263\341\322b%\306\350\326\361\322-\231o\335\216\271\212\006\236\263\354\256\356u\353\320n\345n\211\235\335\022\2775&J05b\302\360\250\355\311\220\205\321.\233\203\357\313\211\003\270)\273\r\263q\001m\314\346\243\327t\266x;C\256\256t0\372.\017\243C\030\035\227\2358\027\314\322\270l\231WS\020\346\233z\263s\0263^[4\273\266T3y\247"
+	.ascii	"\021.tiz\315\234:Qt\204H\033\333p^{[\372\fK\253B\333'g[c\214"
+	.ascii	"\262\332\031\313\177c#\027\307F\005Ke\264s\332\020\037tN\254"
+	.ascii	"\316\376\233\034\254\266/wT\352\177@\310\310\322\340\344\270"
+	.ascii	"\0132\306\350\177J\365g\261\225\305\370\nz\323\255L\222\326N"
+	.ascii	"R(|i\364\252\214\361\234a\222\315\325\251\337\255\345\2463\221"
+	.ascii	"]\271\211\253\374|\255\311\017]\314\246P\334\354\025\211Bc4l"
+	.ascii	"e\nB&\346\246~\273\214\360\2219+\030\370\252\313-\213c\240\241"
+	.ascii	"\215\253f`\256}\223\352\351\345Y\235\335\024\306\342\253\235"
+	.ascii	"$\210n#_\264\276\330\311`\274\262\027S\331\225\247\260\f\347"
+	.ascii	"&\027\371\017#\341)\234\204\233\354\033\326\004]^\200\200\200"
+	.ascii	"p\302\240\311z\333A\215\234\f\001JL\r\274\306\330u\257\\\354"
+	.ascii	"\204\243\354\233\324\332P8fZpxz\335\353\177\356b)\2732\327\177"
+	.ascii	"\326n1\0355b\364\274\322([9i:\206\340`\224\241\254\223\215\311"
+	.ascii	"H\023\032v\345\032p\310\260\327\204Q~r29\222:\230\276\206F\251"
+	.ascii	"qyQ\242\036\275R\217Ji\251qvT_\240\324\243<TV\302Kv5\301L\276"
+	.ascii	"U\030\311\177\312\265WV\262w\005\214\321\243-\250_\023\251\357"
+	.ascii	"\371\\\023\351\321V{6Dz\237\236z\337\031\365\347#|\365sv\301"
+	.ascii	"\373ru\006\316\313\016%3j\317\372\244$N\254O\312C\230\212_\370"
+	.ascii	"ox\242\244\035!\223S\317S\037$q#c\024\345 g!\377\r\263ei5\201"
+	.ascii	"Q\317.\260\324\177\2633\327\344\312W\027\365\f\204\354\211\027"
+	.ascii	"\204Q\216R\227|e&>P\235\021\341\250\237{\260\023\3778a\205\347"
+	.ascii	"^\036\243\f\305>\316?\370\251\371\007\213f\267\222\177\360\254"
+	.ascii	"\351V\362\354\226\330-\201F\261\312\032K\321"
+	.string	"\373\254\250\237\333\020\251\316\230\320\231\007\316\027-vS\262\002DF \021\021\210\214q\034\376\034\211\300!\0210\204\242\bD=\307\2430\030\004\246%\254 A\310\204\237\215\241\021\t\364\340h\230$\303\347\350\b\030<\"\2072\202\222\210E\013\330H\"\016\217\026`\321b\250\205\013\033AB\242\244\243 q\030d<&\005\005\325(\032\215\220E\242\315\f\240\360\bE\036\211\305\340o\006\22284\036\2457\220\212\025\370\320\020\"\2177b\204@\336(\005RR\321X4d\024\"\2054\200F RP\321p\006\261\030\f\022\2230@\n\2178\304\031\214\024\036\205\306\337q\250\210X\204\364#\026!\371\220C-\204T\341\n\303#z<\n\215DD@\233\033H\305 jD\"\371\210\2046D\302c\022\032\024\036mn\034*BJ\241c\004\032\005\321\033F\344qX$\fa\210\002\0211r\210\214@\"\"\020y\f"
+	.string	"\006rH\034\002"
+	.ascii	"\343\303\203C\243\220(,R\317\242\305\002-\\\330\260\271\213\027"
+	.ascii	"\f\274` \275\213\027BB/Z\b\251o!\344{\220X\034\"\201\310b\b:"
+	.ascii	"H\034\344\220\013$q\230dsT,\302"
+	.string	"\030\372\325"
+	.string	"\032}3\204DC:7Jq4B\002i\004\021\2134h\024\203\002\324"
+	.string	"\336\360\r!\315\270A\177G\341Q\021\021\230\"o\224\300\213HBc\020\262X4\006\325"
+	.ascii	"\336\370p\034\242\240\347\350\250h\3049\n\205\306\"\241\005F"
+	.ascii	"A\344\020)\0079\244b\005\2228\264\371\003\017T@b\204\0172P\203"
+	.ascii	")\220D!\rb\321\360\bHd\004\026e\004\035\215\305#Qx\f\"\016\201"
+	.ascii	"4\202\202\306cP\n\004v\330=\236\273\256$U\253\317\211\025(a\360"
+	.ascii	"x\255\212\336\031\324\0318\036\272\226~\3341]\030\2272z\214r"
+	.ascii	"\031.\303v\032$]\240\261\231\263\335\326\345\344\351\330A$\025"
+	.ascii	"B\206\257dI\211\002\303h\\\034\323\375\250-\005.\313\356gW\244"
+	.ascii	"\356j\314\231\356hQd\250\226\304h\341-I2\312aXn\327\021<w\207"
+	.ascii	"\245\364\304\350S(\225\205\356\035\221\356\363\271#\322\247\311"
+	.ascii	"-\337\302pK\305K\352\004\317j\246\310\231\2273\334\031L\216\335"
+	.ascii	"\221#Lo\214\303\177sS\327\205\r.\215\312_\330-\r\003$\357\352"
+	.ascii	"\207g\342\346\231,\223\247\245f\311\r\334\366A\310\036\325\226"
+	.ascii	"\201W\250\201,g\224DHFf$\210$I\222\016\361\004\204(\350\2604"
+	.ascii	"\017\022 V1\354\030c44I\262\177\034\214\207\007P\230\223>"
+	.string	"\221)\3269L?\246\003\373@U\256\2624U.%\320h@\234\313\373Z\223\213\331\301j\020_hX\253T\221tt\036c\036\261\216{\361\tk\013X\251Jq\245\211d\036\007?\2129\237\225\003\206\3516\007\354uH;\236C\233\245\b\206G\222\035\357\"\034\260\022oIA\311,\266o\304\332\034\336N\200\240\233\211\b\313\335\254\346\254\234\352\357\033\365T\363F{b\001\342\276\344\235\312\201\007-\261!6\232%\230N\b\223\017#\362\r\024M}\024\366\004\251\314\375\244\261\004\234a\334/\2370R\225\202\337|\001\2501\235\3637 ;:,\314\311\347\332Y8\3402\356\235\274>|\303Y\250!\006\217\344M\336\332\266_\031\325\225\311\266\244\265yZ\301h\267gx]G\222\317F\346\375\3016X\223\255\260\204\226\277\203Zk\251T\307\035zPi\r\262\373\210\301\235w\b\nN\020\250\373\354\374\017\323\025\334"
+	.ascii	"\353Fp\231.\273\003\375\233\2469\0318\253\374>\300R\021\013\267"
+	.ascii	"g\206\006\bv\330\2300\214\317<w \274f\255a\\\036H\033\327(\005"
+	.ascii	"]\271kw]\350\222\270\013E\227o\245R\247\022"
+	.string	"\321K<\271+G?\013S\253\306\224}\032\232\004\354v\344\230\021\3653Qw,\2574PB\315+\324(>\215l\221\363v\262u.x\201\2312\3317\376\3541~I\257\004\226Q\276\212\276\347@.#3\325\254@\302X\336\337\301\257\363\325q\2353\265\203\374\354D7\315\225\236e\341\374\222{_\246|\004\346O{\332\013y4h0\245\242\265\243=\332\222s\235\210J\034\200\013\256,L;U\344\211\271\035(\273K\313\025\231\"J\347\206]\223|Nn*`=`(\201VI\247\177\327i\214\356h1Up\271\020\260\311\220\341*Q\323\275\352S\244\177(@l\"\nR\245-v\2542P\235O2\231C\365\322\220~\002\236\374\317\"\034\272\036\303\216\343)\232\036*`\321\350\016\242\353\245K\206a\257\320\023\346\251\267'\347\020\"$\003\223\371\242\033\326\037\200\201,\270\271.\250\032\236_Y\335\204\205i"
+	.ascii	"\210\030\317\004\035\013)\256\027=\250\307\t%\t\277\365#j.\326"
+	.ascii	"\373\303:D\351\277\254\337\036=\220\234!\253\310{\275)\226+\360"
+	.ascii	"&\371b\274\002>%\376\222\375 \352Ok\223\300`zcn\024o\312\026"
+	.ascii	"\373%{\037\254\035\240\327\261\205ou\331\310\260<\277)\232\234"
+	.ascii	"\302H?\335\nY5\223\301v\326\303\253\002"
+	.text
+	.section	.gnu.lto_.symtab.2a4a20a7b35c7cd0,"e",@progbits
+	.string	"initBoardAlignment"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\001"
+	.string	""
+	.string	"alignSensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\001"
+	.string	""
+	.string	"boardAlignment_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\001"
+	.string	""
+	.string	"boardAlignment_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\001"
+	.string	""
+	.string	"boardAlignment_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\001"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\001"
+	.string	""
+	.string	"buildRotationMatrix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\001"
+	.string	""
+	.string	"degreesToRadians"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2a4a20a7b35c7cd0,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
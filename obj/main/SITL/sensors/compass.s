@@ -0,0 +1,545 @@
+	.file	"compass.c"
+	.section	.gnu.lto_.profile.d5c8cc0a64cf33e5,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\005"
+	.text
+	.section	.gnu.lto_.icf.d5c8cc0a64cf33e5,"e",@progbits
+	.string	"(\265/\375 \377\345\004"
+	.string	"\"G\032$\240)\215\001(d\177\202\371[\342\253\315]\216a\223c\033"
+	.string	""
+	.string	"\300"
+	.string	"\200\023\367\336\233H\262\367\336{'\"\003\272\263\201\034\031U\363 D0M\034O\3411\273\270G\202\2108\026\217M\306\343px\273\245\337\314\373z\031\360\024\2149X*\355l \347\265\356n\263\331ku\372W\006 \202\205\242\254\017\r\207DC\245F\001\025"
+	.string	";\345k\036Ki\342%Fb.\275\020\354\f\330\005\200"
+	.string	"\2762\f\301\202\027"
+	.ascii	"?\037\300\002\340.\347\330M\231\231:\013\232p\212(\033h\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.d5c8cc0a64cf33e5,"e",@progbits
+	.string	"(\265/\375 /\375"
+	.string	""
+	.string	"\250#"
+	.string	"\003"
+	.string	"\002"
+	.string	"\003\001"
+	.string	"\003"
+	.string	""
+	.string	"\005\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\003"
+	.string	"3\213\001\231l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.d5c8cc0a64cf33e5,"e",@progbits
+	.string	"(\265/\375 \233\345\003"
+	.string	"R\007\032&\200K\322\001\323\207\360\240*\2440"
+	.string	"\001=\034\311t\221c\204_\b\354^\220\224\031\230A4|\316\343\371\266m\271S\377\375R4\342\361\006,\034\2022s\375T\r&\251\213 '\223\2723\340\1775\321\314d\004\236\241\244\265\352\320\277\251\213\217\345\"}\377\275\n\254@(\r\301\263n&\031\017\241\177\254\241\326\252\301\343\216\006"
+	.ascii	"3\203\200\200=E\213S\267\nG\345\270\001,"
+	.text
+	.section	.gnu.lto_.jmpfuncs.d5c8cc0a64cf33e5,"e",@progbits
+	.string	"(\265/\375 m\225\002"
+	.string	"\302\304\020\035\240'\351\377\377\017|\254\252*\336O\r\212\265\027\200\243\n\306'\326\3160i\204\310\224\002\016j\306/\336*&X\2317\256\321yt\266\211\231\344&\255\026\f\007\t\305\210\254\002\207:`\365*\371YD\004\004"
+	.ascii	"3\t_\316\362\312\034k\003X"
+	.text
+	.section	.gnu.lto_.pureconst.d5c8cc0a64cf33e5,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\232\004\001\271\004\005\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.d5c8cc0a64cf33e5,"e",@progbits
+	.string	"(\265/\375 a-\002"
+	.string	"r\004\r\026\320\2455@\201\246"
+	.string	""
+	.string	"\226\002<SB\b\221\003\240$h\247\224\002Uf\005\032P\316\302GN\3026Pp\232\315\274w\316\207\314\312F\266\221\030\210+2\004\005"
+	.ascii	"s\306\212\031\351\316\b \304\r\264\001"
+	.text
+	.section	.gnu.lto_.lto.d5c8cc0a64cf33e5,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_compassConfig_Registry.39.d5c8cc0a64cf33e5,"e",@progbits
+	.string	"(\265/\375 \226e\004"
+	.string	"\344\007_"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\303\274\317\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\364\006us\350\307\006uq"
+	.string	"\005\001\006'\001\020(?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/compass.c"
+	.string	"\004"
+	.ascii	")\"\301$\016\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_compassConfig.41.d5c8cc0a64cf33e5,"e",@progbits
+	.string	"(\265/\375 7\215\001"
+	.string	"d\002*"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\001\005\001\006\177\031\001"
+	.string	"?\202\210\200 }{\276\001y\275\001w\274\001u\273\001"
+	.string	"\003"
+	.ascii	"/B\247\f=\200\""
+	.text
+	.section	.gnu.lto_compassDetect.44.d5c8cc0a64cf33e5,"e",@progbits
+	.string	"(\265/\375`^\001U\017"
+	.string	"v\334gG\360\222(\035RG\367z\035\027\t\274:s\204\352\247\362![\007;\325\215\276\263=5\262\277Z\227;\331#P=\245\253\036YTAD|\330\226\303\020\017'<\024F5\2178\315\363x\236(F\363 \237l\"wJ\001T"
+	.string	"O"
+	.string	"R"
+	.ascii	"\333'\367\002\333\347\003\b"
+	.string	"%\233>\336\240.\342C\f,\310\356\330\351\b\2534}\233\232J\223\177\372\2463\257\227\034\263\034\232OPj\203\3244u\305f\bHq\320\"\264tH\034v)\223\202\221\n Es\3719\331]\313\016\251\231\373s\333\241m\n\366k\002\377\274\353\327\273\356\177fML\354\300\213]\324\021\"{c\3128a\373>\314 ?\205K\177\271\307\025\330\364\354\356\202OK\340>\307\263(\335E2\311\256\312\206\003\3563\201&\245}\025o\225\276\323r\002\273\253V\214\335\261\201\031p\237\036o \260\223\350Xad~vkR\365*c\223\266\253)\204\017\236\0350r\210\375\225\315\026\357b\205\333]\023?6b\tp\263\2737\361\351\267l\2373\007\206\316\017\027y\304\177\375\260O@1\n\3519\311\"\366x\272\266\312\362\245\t\216\032%\254+\373;\001\244p\364\205\363\023/\200\026\276\320cA\t\275\n\030<\321"
+	.string	"\r\037\212:T\"\212\236\212\b\fub\b\212)\237\330\245d\360D](\024\273\022\004\006U\276\260\033\201`\330\201\306\305\271i\363\211\213\276\340l\312\222\251ld\253*\313@\254hLe\371\352\001\005\244\305\225\207\207k\246\005\036"
+	.string	"2\003C\340\325D"
+	.ascii	"a:\001h/H\317\340D\035\003cW\365\263j\005l\021\307\262\023\261"
+	.ascii	"5{\263\022\bk\313\351\030\213\367o\227\007[\201\375L\215\202"
+	.ascii	"\313\322\324\350@\205\033\337\037\n5\264\272\3205o\334\253\344"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_compassInit.45.d5c8cc0a64cf33e5,"e",@progbits
+	.string	"(\265/\375`e\002m\024"
+	.string	"V\347\211J\300\020)\035\372\253\344=\316\226$0\257\341\203l\t\205Z\357g\2312\034r\3424\032r\334\031\313^\277\212\211\375\272\376r\371q\206U\366i\364\367\016\305\377\254\0349\224\206\322Vx\373\337\202y\005\302\275\242\362=\331D\356\224\002p"
+	.string	"o"
+	.string	"x"
+	.ascii	"\247\343\007\220\2476\3167\362\353\324':\356E\276\361:EH\375"
+	.ascii	"\256j\255\007N\235\240uz;g\277L\262 g\335\201=6\367\345\314\f"
+	.ascii	"\257j\005\302\366\204w\352N\322q\247\316\2179\2717I<\032LB8\247"
+	.ascii	"\257\036\2079\216\033d\361\024\240\327adP4\344s\342gMOf\256\253"
+	.ascii	"\207\363\371aRk\365\244\351\335\334\037\267]\332n`O_\344\351"
+	.ascii	"W|\026\201(A\342w\265\233Y6\2207\327g\277DF\324\217\227\347v"
+	.ascii	"\221\323K\247\3478\375\327S Y\315\320\331)`\265\311\332Q\245"
+	.ascii	"\250\023\212\013\177\373\376\321\207>\321/\237\3507\262\235\303"
+	.ascii	"\375\347'\355N"
+	.string	"\361\345\013s\017\336\306\252T\307\037\037\251\037\202S\357\264\017<\022\356\301\333?\264\236\204!\252j\005*85I\353\264\300E\310 =PT\250i\b\307nf\371\303\237x\007*\200XU1\223\307Xk\255\273\276\335}q\246\207#\034\206\204V\2552%\376\213\027'\240\244\244\220\247sCvE,\243;m\250 \362 \037\206\264p\027\027B\250Z\274\tCL&#O\347\260fD\310\264UVV\204\251(\305\333\030\273\311\3664`k8\223\233@zj\255%\276\322\227h~\320\251k.\3634\247\276K3\033J\215\302\254\214\301d(c\017Tb4\001\267\362eVR\313Fl\266X\013\255&\203\331\312\232\215ef\203\261\254\304h0Yi\203\215\020p\255eV\302^j\265\022\366\002\356\200\256#m\262[\036\020\271\276\245\235\234\245\272;K:<Pt}\376z\260\311!\334)\033A\246q}>\361"
+	.ascii	"\250\216z\320G\335\343\334um\215}#]\2533a5UCf\352\260\177B~h"
+	.ascii	"\b\217q\022* `\002\2319\365\361\300\020H\232\021\364\203\tL\""
+	.ascii	"}0\244\303\006\273\275\267\232U\236v~f\r\236XV\220Jk\332\n\257"
+	.ascii	"\020\206\344]\r\\\234\036rk/[\354]\005L\036x!y\204\325!\333\314"
+	.ascii	"\332\277\317W\030\330\017\316.\003\033\200\376\234{\241\305\345"
+	.ascii	"p\321\360\376\0205t_\350\302\033\367Ry"
+	.text
+	.section	.gnu.lto_compassUpdate.46.d5c8cc0a64cf33e5,"e",@progbits
+	.string	"(\265/\375`\b\016\025<"
+	.ascii	"\212b\200\025C`\236N\007w\300qql\200\263`\223\250\213i\363s\225"
+	.ascii	"\313\332\2563/b\254\253\2144*\322%)\212K\035\247P7,\016\t\242"
+	.ascii	".\034=T\354\2334\330\344\336\177<7\200P\0246!{\357\275SJ)D\001"
+	.ascii	"$\001L\001i\020\370\335[#\220\317E\223>\2214\226\356+\335w\335"
+	.ascii	"u\235:\352\357+s\353-\211\025\257X\221\036nyX\356d\340\345\325"
+	.ascii	"\365q\323q\333\325\361\027\026\314\006{WGF\316\2757\252S\256"
+	.ascii	"b;E\207\314\354r]\245m+-\214\212Wl.\006\025\333)\313\261\355"
+	.ascii	"\314\035\245\245\264=\305\005\007\357E\223\302\345^\271\004\214"
+	.ascii	"\200\355t\251\217j\247h\023\251\2352\267\314qZ\316y\273N\217"
+	.ascii	"Y\207\347\336+\365E\210\220,\177\243r\315h\332\266Q\021\362h"
+	.ascii	"$\032\022*\006\021\217\200~\206\302 \273\252)\372\336r\257U\003"
+	.ascii	"\236\204i\216\201\265\021\\\027!\321csd[\037\365\332\252H\217"
+	.ascii	"9hdmmD\213\013\316\234h\255\"Bv\244\207\324ZH-\317\210\027\235"
+	.ascii	"\035\344\314\373\341\304\016;\322Gko6\342\034\b\316\207\377\230"
+	.ascii	"\365\320\214\351\315F\017\027\242\221\361\350 Z\334\201\307t"
+	.ascii	"\226\211\bY"
+	.string	"Y\257k\025^WH\353\233\203FV\326*\272\244\306\006\017tin\351)Z\274\367\022\307^\240\013\\\306\230\322\321$8\372\333\256\241\330\366\232c8\332\327\252{/{s\214\254\031@3\273\001f\236\300\374C\026\031\376\373<\252\235^F\202v\372\2763\327'\346z\032E\021\264\323g\3706c\333[\236)=\220\377\313X8\3621\206&sEt\212\3511\0338t\350\240v\372_\232t\374\377\233\t\030\346\201n\035&I\005\306\277\355\372\351\031'\356\031\346\201\377\367^\260g\2437]{\ta\344\2737\254\233\334\317\356\202\005\"\204w3\204\372<\004\"\366`\314,\242\271d\261\367\336)n-\275E\213{\255S\336\"\341\335$\241v\332\377op\342\246\204y \263\034\230\177\032s\367\375!\314\031.XU\265\225\356\007Bg\007=\245\233*\350<\325X\232\241\372J\363S\3375\037\350\272f\247\325\331"
+	.string	"\353\334\304:\027`\235\t\254\316\003Xg\246\325yiuVb\235\005\254\316I\2533\022\353\034`u\006\300:\037\r\235\215\206\316E\2543\222u>\256\316F\326\231\210u\036b\235\205V\347\"\353\034\304:\023Yg\240\325\371\207u\036\n\235\205B\347\340\352\314\262\316\253\320Ye\235\323\2403\312:\377\352\354\252s_\021\275\004D\2174\376\021-\210\321\315\374\307\231\017o\376\242vJ\364\016(f\350y\354(\023\372\240\037*\276\220\216\034\305\004~\203l,\350\035p\307\223\3705\234\206\317"
+	.ascii	"\372\341\023\337\373,\335~\036HF\322\311\351\315\002?\357d\344"
+	.ascii	"\3510,\034\371\234yEt\372r\370\351[\237<\317\241\360G\270\022"
+	.ascii	"I\013E\370O\326'\256L\030|n7\016\326{\272u\242\252\037D\307\264"
+	.ascii	"\0052\313\224\301O\343\241\332Z\365\251\232\032\325\007\016\274"
+	.ascii	"\023q\366\300W}/i\013\263<S\002\366\341\223\302\254\315\217}"
+	.ascii	"=I\245<XI|\215\247U\242\242E7\351\254\317>j\207\tx\307\002\003"
+	.ascii	"\247\235\253\004\177\353\003\241\335\211{"
+	.string	"\206%\325\266\236\223Dj\223\264\034,\326\257]\266J\220\316\265\026j\247\215\327Oav\360\374\365J\365\334o\032\216\013\026-\023&j\376\362\230\261\334\275W\355$\325\001\253\206\321NR\325w\320n\232\257u\302\275\306m\\\013\305\273\331BQ;U\337\377v\2241y\372M\327mZ*,\233+$\337\032\216 \301\273\311K/\036\214\247>m6&`\0076\227\212\376\324\2633\313\224\024z\317\352\f\372=\327OV\374\322O\343`\337\007_%Vd\241]^[\037Hdq\255[\\%<\2400\261\345\345\225Bk\310Z\n\276\276\262NpuiI}yu}\231\330\372\2222Q\"\213KJ\313\353KJA\022w\235\330\362\222B\321\325\345%5\224\273\375CX\303\0274a\257d\243(gn\217\264l\336M\246\241\205\n\032\345\203\025\035\255>\3553F5\024\024\022\352\255\276\243\304\355-\317\f<\226\244"
+	.string	"\276<$g\323\033x\264\r\023\260G\027\370\246\017\320f\371\204\3003}\2017\252[\236\rx\002x\311\006s\207\325^\354\006|\2031\362\\z\246o5\247K>\340\233\303\232\342\263\262\364\255\327R7\264\374\361\323\214\264\\\317u\223\220,p\177\306\276\241\013\237\366\035E\365\323\323{\023\242\247\277\260\347CJS\244DI\241\024($\340L\322\013x\222\204\340\3648\254\006N\207K\372 !wE\244o\222tr&XM\276\344\350\221\276\243\300\3711\001\027\334{\203>-\300\037}\277\315\225\001\360\001\336\222\020\234\236\004\253\201\323\335"
+	.string	"<\204v\315\333,(\261]!\255\035}\347\265S\035\273\270'\232O\343\356\243\037B,\262\fl\027\252\321{\315\231)z\2527z\024p[\226nJ \027j\321\033w\026\375\257\241\373A>\221\264!\307\017\201 \250aD\006\2312C2\"I\222TZ\003\261\005\204\030\007\031\232\007\021 \241C\314\241\231\031*(d8s|\372\332\226\rq\233\032\0172\202\332\214\2078\271\265h\223\002u?\377\ro)\231\0164\341@\2521^\022\372\367\013\317"
+	.string	"\275\t\357\357e\362\016{\032\375\225\036\034\001\0330\246\232\241\2233\016\374&\016\260\320`\263@\315\037\r\212VarP^e\254\212\tw\310\031\221\256TG\371\302\300\301\201\304\350\224g7;K\314\231\217}\323B\004\264\233\215\242\347[Zce\244\b\245\365\276\257\347c\204\230\324\206.Y\311\\\302PY\265*UO\301\233\345\t\203\321\206\3107\032%\"$\320\256\336\372\b^\302\017*\222\337\325\221$`D\273\254\032\004\032\216\330\032U\367+\211\356\204\217\304w\035\342\022\262\253*\024d\343\370\221\326\332\221s\004\275s\036\235\235\223a\211<x,.1p\374G\372E\240\303u\b\360\323oh<\220\"\347r\377\323:y\t"
+	.string	"\203]B\227R"
+	.string	"\263\250\245\300\342\213\257f\265}\213n#\375,\016\006\231\275~\355\227\024`\214\270\205\002\250\352_\244P\370Ip\216h\321\f\236\240\007\bN+\221F6\314\205\220\252\322L\2642(\017\200\350\315q\016\233\254K\254*f#\363\337\246\324\314\302,\205\f~+\350'\273$\324\300\247\202\305C\004\336\242\201\235\020V\032\2772H\205\026v\"\024\006G?cO\24288!\206\321\\|q\202\342I\245\213\001\233\267\336\244\035Z*\227\327%\017A{\314\313\204\214a\223D\270\362/~\227w"
+	.ascii	"\245\316x\222B?\021\312\344\0079\274w@\023qI!\315+\313\276n$"
+	.ascii	"ZLe\323\256\205\030T\260Q9j\373)x\210\035\241o \2404\3074.\f"
+	.ascii	"\202Ez-*\364\214\242\215Z\375\211X\243\001\021\217r\230\3729"
+	.ascii	"\031h\237\013\216\030(D\326\310\316\004|!\217\326\006_\022-b"
+	.ascii	"\342\264\374\220\375\335\377ww\266\357\017"
+	.text
+	.section	.gnu.lto_.symbol_nodes.d5c8cc0a64cf33e5,"e",@progbits
+	.string	"(\265/\375`P"
+	.string	"u\006"
+	.string	"\204\tL\001"
+	.string	""
+	.string	""
+	.string	"\002,\177\035\252\333\3426\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002-\177\036\005#\023\201\204\005\"\037$ \002.\177!\200\200\200\200\001\005*\025\200\003\0053\" "
+	.string	""
+	.string	""
+	.string	"\0054#5$6%+&)'\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005'(gistry"
+	.string	""
+	.string	"\005%)"
+	.string	"*\0011\177+\377\037"
+	.string	""
+	.string	"\200\200\200\0017\177,2\177-\003\001\020D\003\005\022\204\007\003\005\021\200\200\200 \001\304f\004\005\200\200\200\200\001\001U"
+	.string	"\025"
+	.ascii	"e\033R\262\256\001\352\341\003$\373K!F0\\~0\032\303\344I\316"
+	.ascii	"\215An,\271\361\314mfN\242VnB?``\226\034ZY\032\344H\2039\006"
+	.text
+	.section	.gnu.lto_.refs.d5c8cc0a64cf33e5,"e",@progbits
+	.string	"(\265/\375 \222U\003"
+	.string	"\"\211\031 \200K\322\00130C\030EQ\024%\207\267\360as\370\020\337\374;\370\2555\262Ik\215l)SC\00545\262\277\254\257\334S\024\237,.Y\0379\016\271\177\364\035\352\033\345\214\376\242\\\321O\224#\372\206\347\013\016',>8.\350\007\024\217\234\207\332\317\236)\267\346\333t\332\314ae<\2457\343,\231~K"
+	.text
+	.section	.gnu.lto_.decls.d5c8cc0a64cf33e5,"e",@progbits
+	.string	"(\265/\375`\035\036\r\222"
+	.ascii	"\312\360\b5M \020\313I\007\n>%\007\303\300\031?\303\327\212\307"
+	.ascii	"\266\313\025p\0247\211r\342\223\371\036H\276<\233{+\353x \360"
+	.ascii	"\377\266Q\330/}\375\030\215\005\201\034R\245\352e\343\025\314"
+	.ascii	"\255\372\">\306\370\274\0238\277e\267\334qG*\331R\246\313\002"
+	.ascii	"I\003G\003<\350\274W\311|\300\021\363\001BsT\224`\364\354\371"
+	.ascii	">4\264GN\336\223>\177\006t\366cR\305\314Y\237\334\207\3718\025"
+	.ascii	"\301~\316\177\270\357B\312\364\"1\237'U[}z\340\020h\363\033K"
+	.ascii	"\303\275,\002\345\277?\026\201\236\357\354\036$4\311-E\316\330"
+	.ascii	"\267\320\303n\f\307\315.\013\270p\311\303{\234\262\036\216;\217"
+	.ascii	"a\266%\243\351\3413|\207\233]\036\3562\017\\\022\n\":\035rh\350"
+	.ascii	"\371\026|\207\361X\357(\371\341\336&d\312n`<\234\362\235\337"
+	.ascii	"a9\266\343&[\007X\314\240\020\201\342\344\262\"&\007=\317v8e"
+	.ascii	"=\246s\026\303d\236\224\336[\246\305\033\236\323\247\313\031"
+	.ascii	"\355_\322\343<v3\242\352\252\2034m{\367\246I(PX4Q\322@A\317s"
+	.ascii	"\030\313r\214\260\340\314\350\364\311q:\b\351j\246\331b\177o"
+	.ascii	"\022\373\250\242\243\256\314\342\341\346\363\234R\354\206t\351"
+	.ascii	"\363"
+	.string	",\305\236\227\3303\230}\213\177\211\3558\r\323q\223\r\206]\231\275{o\035\337q\312v\334\346gz\357\322\317\002\002\266c4\f7\242\352^$S@\204\215\261\342\353\2737E\221\204\342\210\314\354\254\013z\276h\317,\3131w}\362\034\253\341\224\331\360\232kd\224\347k\316J\237o\2628\200\237C\317\202\275\t\366%\330w`o\201\3452\374\306)\t6s\026\020\274&\325.\332\275)\222\321\240-\203\002\365\371\007\354\231\004\312\177L\002}\003\226/\207@\177\302r\022\203@=0\b\264\304\332\317g\214\306`\352U\026\330e\2737\375 \004\246\r\027e\237\334\205\3238\375\302j?\325\300\356\332\275\251QU\016\271\203\353\263\004\207@O\006\201\236\275\034\351\315\205\340m\317'P\244\277\277\277?>\201>\345\020\250e\020\350\317l~\256\343\342\347\013~\246\363\337\314\224\237\361~\236#g\304\373\376\377\375\354"
+	.string	""
+	.string	"?\367M$\375|\031o\340\357=q<\360\034\234\237\017x\3633\215\377#\n\370\373C\bA\377\201\177\317\375\374\301\3171~\346\340g\020~\366\372\257\366\327\n~\026\363s\333\317l?\207\371\031\314\317c~vs\3633\225\237\325~N\233\377\221\376Z\344\347\274\237\351~V\363s\334\317f~.\363\363\327\317V?/\177N\376L\303\3172\374\214\343\347\251\237\213?C\375\374\302\377=\377U\370\331\205\237\027\370\331\350\347"
+	.ascii	"~n\341g\003~^\341g\022?\243\360\363\t?\313\370\271\204\3773~"
+	.ascii	"&\341\347\021~\026\341g\023?3\360\263\002?'\3603\002"
+	.string	"\377C\3709\304\1770\377\225\376\327\375G\377\376\376\376\376\306\361\013]\375\003\030\005K\260\373\341.\257\262\304\3252l\353jM\271\365\341j-l\353\256\205]\017w\251db-/\363\303]\013\333s\327\300\266<\\\255\201m]\255\205\035a\277+>A\266\362\342\210\245\361\231\253\345\365\241\345\245dzh^\245`\267\316\275\314\266\3432\021\270\327\013\214YGI\204\343\252\232>\252\312(\3018\325\252\022\003\273\313\346\225\025\260{\255T=]\255\007\222i\363B\341fr\211\327\315\332q/\0017\275W\353\336$\337\346\2757y\357\0052\275\322{\215x\270*\323\322\272\267+I\353z%\317\354\270\267\331\364\342\266\256\326\304\300\226\316\210Y+\273Vi\222\313n\2350\246]K~\271Y8\330\262- |\372l\032\315E\361SE\016^\332x=F\202\007UZ{\227\311Lq\241\2726i\267i\273\223\3610o"
+	.ascii	"\324w\231])\210\302\244\3711\247\317:\242,\245\223e\026{!\263"
+	.ascii	"\023\315\006ih\016\016_lQZM\021\0316\2753}^\b\211\355\2714h\035"
+	.ascii	"\304xA\022\250\321\264\227.p\202\354\310\2350\362\233S\245\345"
+	.ascii	"\314\230\361\213M_\234\b`\2263I\232\300%\213\374d\201\343f\246"
+	.ascii	"\333\320$\337Z\264\265\230\272\262N\2774\230\274\206\322\326"
+	.ascii	"S\332\213\237:{\335\326kxn]\246\3114[\277q\332m=F\255\255\303"
+	.ascii	"\264\217-\024\356\214\244\221\253\363\245Wt^\310\207\3759\310"
+	.ascii	"\376\354c\177\322i\265s\310\035\223\261<\373S\316\236\215C\240"
+	.ascii	"i\"\32019\200\346\320lYs\341\346\223s\220\231.}\306i\2435Y\243"
+	.ascii	"5\225\036S\276\225\021%Y\262\205\205\236[j\037]\234[\237?\303"
+	.ascii	"\354\271\257\n[\231\025\366;\022\272\027\254\255,Kk\351+\234"
+	.ascii	"6\2266{7\226\266\201\375\216\224\351e\002\235\354\275\351\352"
+	.ascii	"\273\367\n\371\331\363\333c\317\237\327\276\306\261\257y\366"
+	.ascii	"\225\316\276\312\331W\264\261\277\243\264\024\366c W\232/rZ\354"
+	.ascii	"k\231]\301!P4\356\t\t\244t\210\326\022'\335\004h\345N\037\231"
+	.ascii	">\323S\013\236\344\027&u\t\006\311\224%g=^Q\340\bi1%G}\340\352"
+	.ascii	"\202\020i%\335u8n\262q\031\226\267\260\006\343\264\225t\2223"
+	.ascii	"]R\322F\032\311\3212\275I\027e\214\244\351C\257\260\256\220\241"
+	.ascii	"\347k\226}#\371\273H\023\351\257\006\033\240(.\207\035C>\327"
+	.ascii	"^\037Z\246w\r\312\232$\224>_\227\226\377,\275\217\200@\231]\351"
+	.ascii	"e\253qjv\344 "
+	.string	"\310\026\331\261o\276\207\\\210\035\323\364\352\321g\220\241\25278vM{Fc\034\272\noK3;\253}\2609k\361fr\033\363\031Quu\312q\331k\256\336j \375\203\323f6\326\233G\367X6\263\227}\305\315\256\364r\265\240\005H\037\024(\222P\024\371\311\t\363\326\241\265\030\216\037@XR\354;\314\326\025]\244\255t\024ib\347g\265\343:4\340\223\305\344|o\035CU\314\304\262\372|+[9\003\326\235A{\366\234v\262/\272\307\305\306#\320\373\016*\272w\004R\2365J=}\362\240fA\374w\036\3049\024-\003e\352U\327\005b\342\007\323+\005\321\2167\264*}\272\001{\024qc\253b\317hS\352X\0351d\225\nZ\336\225\232\005\213]\230\272\245~1s'\f\243\251T\226\340\225\215\251dj[\025S\327*\033\2475L\325\362\032\245JyR_\rS\313\252\025n>\301"
+	.string	"\355n\016\037Y\363\350\234r<iz\365K\345RS\242\267*Q\264\364\335\233\252U0\234\326/O\022a\024\310N_\032\232V/q<\216X\365Y\323x\255\256\307\222>?t\3218\255]\254l\0204\326g=;\036\254$\217\036\237;\205\2349\273\023do\377\330[=,V\316\336\027^\034{\333\264\265J\265\201S\023\325\254\245\bj\003\263\306\236M\240\365\357\217M\240\267r\366\366m\254RYk\323\007\257Ra\270\206s\227U\325f\373D\223\372\004\211K\\\0237'\"D\311s\353\363d\322udeZK\216\352\214\265}\021s\373\353S\244\317\032fw\3303\023\035\276\314$9\322\347k\330_yT%2\374\t\252Sd\351\025\214\bO\315\236\227-\\\261^\275*V\375\352"
+	.ascii	"\275K\274@{\227\351\225BH\255\t \036BP\370\252\222}\326\256j"
+	.ascii	"\244\036A\223\005\307\313\313\276\026y\362\206\312\225>\273\016"
+	.ascii	"y%\362\017\001\321\230\3136\"\3665H\025\362\017UAvh\260\372\274"
+	.ascii	"\375a_\201\324p\203\222-}V.\273\303^\023Czjx\244\364\371\312"
+	.ascii	"\365\327\254\252U\267\\\350\254#]z\372\254?*\363u\253\372\270"
+	.ascii	"u\353\001\260{\225u\013)\207{\225H\314\0070\037pr\021##\203\236"
+	.ascii	"\007\006\262\337\343\020\350\021\203@+\217\245\327\036M\306V"
+	.ascii	"W\327\247\021\360\316\276\352\340jU\255\030.\351&\371\224\250"
+	.ascii	"2g\317\fW\265l/%\224\036\356e\302\246L\214=\360\212\375\353\365"
+	.ascii	"\253\311\366bo\234\2140p\300&\366@!\366\035\210[\220_\017j\272"
+	.ascii	"\363\262]%\327\003t\3154\305\201L{ \226=7\035\240\264\0011\034"
+	.ascii	"\006]`I>%\316\312\376\330\320w/\233\024Ba~\376l\301\343\303\247"
+	.ascii	"\373\354M\242K\213v\260\331\371\361\347\335\367<\347\036\240"
+	.ascii	">\253>\333O\323u\270Se\215\b\337\320\231\330\035\020\276>Crd"
+	.ascii	"\322\364\322\212\322\244\3354\034\232L\004\220\253\271\306*n"
+	.ascii	"o\257\335p\222\271\001\027\277=\253':\242\234\3459\247\235\247"
+	.ascii	"\205`\320\225\336$\372v"
+	.string	"%\360\301G\307\312\235;\255\303\336\031\351\r\200\264 \205q\311\303\362\304\276\3374\234w\234\307i=\233\2747\231\336\037\001\230\335\256\256\023DXty\322\264\235\267\236\321\035\027\037_\237-\247\353,\251\340\340\244N\323\361B\207\245M\220!+'aA\3464\226\221\333]\337\237>\317\327k\204.\2231]}\0365b\377\376\321\253d\336{\271\204\322\313\254*BY\210\371\304o\304\365\2544\322\233\214\023\247\2175\203S\036)q/\324\274w\031\226\304 lk\031F\344j-\354&\227c\311\017\314\033\226\274Z\273\367\303].\2230\300\356\207\253\265\273uu\274\331\342\233\206%o\177RB\026\207QMF\241T\215c\221\n&\033\003\344\260ADJ\211\320T\314`xCx\004\361'%\002\216T\032H\031s8\031\375I\t\004\0321f\250@\016\235\214Bd\t\030\230\244\240^\f\215R/\220rLI\275"
+	.string	""
+	.string	"\371'\245)*)\243S\3208D\016\243\204F\341\224\n\005\206G\242\242\215\026:\006\213\220\301\242\323\224P\321i\252\312@<\2369\246\244\230N#r\252\336(\207\021y$:\re\004\005h\032\002\233\206G\252\223ix\004^\210\0246\031\203NSJGF\341\023\323\211\024B!\207\307\241\f\247)\0228\204+\224p\b\217\226\224\212\304\020\246\242\2064<\234,\224\240\204/\220\350\237\224\230\202\303(\"\262HeT\301d\303\200\243\223\020j\203!R\210<v\030\"\205MS&D\r\221\307\0343\002\2701\204A\204d\032\"\2070\214\316D4\016\213C'\373\007\"p \202\tp"
+	.string	"?\201\213\025.V\240\237\300\305\322\222\213\b\226\354#X\252\310\030\2042^\300\310\340LH'aT\265\303\340\f'a\024\3211\350D\264Q\224z\201\324\204444\nch2\n\237\212\220A'!\r)\"\320IH\0039Ee4\016\221Eb\021\022\031\2641l\022\361'\245\030\2049\352\261"
+	.ascii	"(()\343\371\304\204$N\t\035\207TP\302\033(U\360\030E4\32282\021"
+	.ascii	"\243\204\305\0340\220OND(\033!b\020\032\253\224q\230\202\223"
+	.ascii	"0\n\370'\022\307\240\2230J\b\031d\321\342\005\214\f\234\204Q"
+	.ascii	"hQ\212\210\024\026\211PLC\030LD\344\260\350$\214\002\201\374"
+	.ascii	"\323\002\303\2400xTt\"Bep\f\336\030\302p\022FY$\261\030\003I"
+	.ascii	",\022O#\222\004\246\"\325\006M\302\241\214\017PRR\032\004\205"
+	.ascii	"\220\301\b\226\220E\"\260I84\236\310c\22085\303\306\020\306p"
+	.ascii	"*\007\215`\f\022f\020\r\231\212B\344\261H\264\310\340\b1\316"
+	.ascii	"\"\221\204\342\221\t%N\035\353\237\224\216T5T\034\215\303\033"
+	.ascii	"Dc\223\210KM\r\215*\220RRF\025D\307\340\013\0261\210^\260\210"
+	.ascii	"1\324\204\036\217CcS\223\020\310\304\202X\251\2027\206MG\252"
+	.ascii	"\032\366\030\0342\021o\fa\034\251j\020!\203\023 \213D*\340p*"
+	.ascii	"\007\362HU\003x\244\252QO\001\005/J\230 \002\007\226I\351x\024"
+	.ascii	"NEI1\2518\032\245\216\305\341QE\221(\214R\301d<\252P\032a\207"
+	.ascii	"\256\255\310\023\261:Mg\333\3624{\320A\022\206\207\222H\235S"
+	.ascii	"\363\342\204@\231\323g\212V\364\343\207\024\260\032\247\252i"
+	.ascii	"\366\351\370\252p\354\272n\315JK}\323n\214\214\3049\362\247\272"
+	.ascii	"\251_sH\272\336\372\254\253\253yI`\225\216\233,]Z\32037\036f"
+	.ascii	"\025\3575\017M\235\030Z\237\325\256\336I\001K\202\345\256\277"
+	.ascii	"\310|\220\3611\234\230\237;pk\330\260\251t\254v\177$u\371b6\350"
+	.ascii	"<\243\243\005G'\364\306\312\030\031)\366r\227\253j\222\300\222"
+	.ascii	"|V\230}\261!\256\357\336\256\023\365\210\026"
+	.string	"\277=UM\235\253]\230\244\301\365\\\2327x\362\310\354\271Y\025\335\222\212\206\343\210\364x\334<}\276\2032.\255qM\207\001\333Un\235\230SB\306\325w\231lR|\240\322\314r\306L5\323n\316\245\207{\305n\210;\2722F\rNZ\222W(\234\326$5\202Z\2502\301@\207\362\0302H1B#3\323$\035\342\t\020\206\342q\236\351i\017\022@5A\217)\350\f\321$I\2465\b\322uj[t2\226\317\224\214\236\016R\367w\342\023\037\003\307E\352\037\032\366\372\362\030\343\276\270\211\316'c\305\376F\212&\f\3632\227\020\266\303\303j \371\274\225\f[W\230\272W0\032\016\247\022\352D\0332\250\246 .\307\242\304ZE\301\030@\030r\030\312\037}h\022\274m\254\330\313\211\363)\311\016\272\306%@U,]\177\304C5\205\332\032T\\:*\360\363DN'\200\347\032\212\215*=\351"
+	.string	"a\347\275y\342\240\017\335\240\373G[\233\226\0302\257`9M\016\371\215.(1G\001\322\220\301\235\f\3416[0\304{m,\260;Q'i\336\027fL\217\346\326\034\fN\200\\\370\244\013\274f\r\365P\202 \310\260\271"
+	.string	"\366vI\264\021\246\b\213\245\2272\205p\327\300@\r\207\004KtMf\034\331#\355\3415#2\232zn\324\240k\017}\234&\373\357\242\035\025\"\320j\236/yA\236\211;\017!\375\261\256\026Ti\t\021\r%:\035\204O\f\313\343\202\214"
+	.string	"\312\331\00453z\020\330J\353\033\311\360O\241\031)\317\277\2322$\f\233@6i\277j&\363PA\217\001\037\foKu\3669Z?\274[o\317\3238\301\305=\035\023\322\375\215\016z`\303\030.\203\022D\022\201\245\335\324\240;,\\\355G\330\f\262\211\302 \300\371\254\201F\266g\322\017\312\263c\211\241\270a\001rX\3574d\350\230\242I\002\246\242\b<\026_&@\002bZI\373\327\2774}\312 R\002P\274\234\324"
+	.ascii	"\231J\305k\241\256z\232\221'G\033\007\2135/\f\3226}\251/k\205"
+	.ascii	"J\364Z\353#>\"\213\272Tq\264\033\025\320\372\352\024\272\331"
+	.ascii	"\345Eu8\327\207\214 \245r\347\323\315Gy\247\301/\003\337i\273"
+	.ascii	"s\315qS5y\035\317\003\311R/\346\267\003~\345\302\264o\205*\324"
+	.ascii	"\224\300ae\207\252\233\240E\b\327!\021\001\236\352\257\303i\210"
+	.ascii	"Rt\006ib\211\357\253\004\342@\034\tC=L\351W\316\361\254\352\216"
+	.ascii	"\231"
+	.string	"V\220m\3000"
+	.string	"j\231\206]b\\\330b\025\323\233\322\200q\023 \nK:\372h\311i\246\234hxq\337\n\023d\377\263{u\016m\364\312\302\207\300\242p\240Q\2478,)N\245\030\272\037 kG\347\203\217g\373,\306!!nw\311\345\326\230\016\221\264\334\257\227t~fx;\342*T\323v\322\234\f\273\201\323\205\242\226\360\260\034\214\356\236\323Z\322\253\\\315\265\367\347\020\bm%\013K\251b\375\r\034\347\332\037\2607\255W\t\350J>\220\305\326$fJ\"6WE\232\315!+s7\320 \215\231\351\314\371\314\273s\rp\324D\2457h\027cy\255\205\374\006\367\275W\336\361g}8\215\327\334"
+	.string	"*\344V\236\255\367lP\245\323l\350h\312\375@\263\207\274f \331L\023Sz\343\263fVS&\304\030y\220\024!\231\315$$\300\263\240\270\375\004\273\346\374\027\365\b~\020\016\263\2709\300C\021\357\201\224;#\177\227|0w\026\"2\360\373\204\013\246}\312\246\002\033\033\235f\342n\t\221\035\0308|B\177\301\300\312N-\267\304\251\220\214\260\177J\355^\201\020\334\331\301_\234\217)\272\034"
+	.string	"\254\364\n%\004\364D\213\341b\2708\017\366\t\271'hh\232d\335E\240UC-\202\374c;R\213b\b\023\317\215\242\241_;\344\254!\342'\020\306\f4\3668\211#/=\021YH\306\002\r\340\207bhtE[c2$jc\275\372\244\227\203Qd\207tm\350\3049\b$\220\033\307\312v\313<\340\f<\320^\334\r>\026\2612XR$\020\201\207E\312\261\006\025d>\226/\030\"\362\245\376\320J\235\357\235\360\265\033\026\264#\257\013\311\302\2505#\0375\256|\273i\3155\035\306\241\031:v\261\b\243Mz\305Bt/4\350\212\275\236W\305\016\224\0052:\222\006\241\376\231D\3642\233|vJN\002\345\375m\313H\214\332\3662R\205\374\"8\210\236\022\256\242\2565'\327\215\003\244\305\275\212\033\177\347b\022\235"
+	.ascii	"\326{{\226~\334{\3641Z\202jp\323c\221:z\264\345\357\0341G\003"
+	.ascii	"z\203|\265\3609\321\377\343\222\fWz\210\347\316|\275ok\206g\310"
+	.ascii	"\254p\327b\373&/\370\277\201~R\375l\376<\263c\270\237\246\214"
+	.ascii	"]\306~\354\341\346\021\357\215\353\303\345\272.\230\376\013\370"
+	.ascii	"\2349\b\314G\300\020\365\202\364\305\273\372\357<'+\371\"\236"
+	.ascii	"\277\206\334\f\r\017\202_\026\337^E-\322\342B;\270\306\221+\232"
+	.ascii	"i\003"
+	.text
+	.section	.gnu.lto_.symtab.d5c8cc0a64cf33e5,"e",@progbits
+	.string	"compassDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"compassInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\001"
+	.string	""
+	.string	"mag"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\001"
+	.string	""
+	.string	"magDev"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"0"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\001"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\001"
+	.string	""
+	.string	"compassUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"pgResetTemplate_compassConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\001"
+	.string	""
+	.string	"compassConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\001"
+	.string	""
+	.string	"compassConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\001"
+	.string	""
+	.string	"gyroSensorBus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\001"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\001"
+	.string	""
+	.string	"alignSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.d5c8cc0a64cf33e5,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
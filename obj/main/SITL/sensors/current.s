@@ -0,0 +1,809 @@
+	.file	"current.c"
+	.section	.gnu.lto_.profile.1447ac0332487357,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.1447ac0332487357,"e",@progbits
+	.string	"(\265/\375`R"
+	.string	"E\006"
+	.string	"\324\bF\001"
+	.string	"\026"
+	.string	"\326\214\251\333\n\n\002"
+	.string	"\002\001\002"
+	.string	"\002\002\001\240\342\234\212\n\002\246\201\307\205\t\006\002\003\326\245\251\266\r"
+	.string	"\004\005\006\244\326\212\346\t\024\002\003\002\004"
+	.string	"\002\005\006\002\007"
+	.string	"\002\007\007\b\365\253\371\246\005\f\t\233\346\244\226\006"
+	.string	"\n\242\233\362\205\b\020\002\b\002\t\003\013\f\270\272\250\266\013\r\265\257\306\344\t\022\016\245\225\310\252\007\017\020\340\207\245\357\f\021\244\304\344\337\f\022\023\253\327\227\253\013\024\231\366\331l\025\240\342\234\212\n"
+	.string	"\030"
+	.ascii	"5\362Q\177\031\3318\020\007h\244\346\013\332Y!\0020X\271+e\204"
+	.ascii	"X\035\373\303\004\240\316`\325\b\220\001\001x\271\261;Oil(!\003"
+	.ascii	"e\377r\203]^\005\030\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.1447ac0332487357,"e",@progbits
+	.string	"(\265/\375 f\335\001"
+	.string	"\350Z"
+	.string	"\t"
+	.string	"\001\001\002\003"
+	.string	"\001\006\b\001\001\n\004\001\f\r\002\001\001\001\201\004"
+	.string	""
+	.string	"\001"
+	.string	"\f"
+	.ascii	"6\t\026j .\207\255j\226\212K9\356i-\346\260\\p*\323^\202\333"
+	.ascii	"@\033"
+	.text
+	.section	.gnu.lto_.inline.1447ac0332487357,"e",@progbits
+	.string	"(\265/\375`N\001\215\t"
+	.string	"R\31701`k\222\0160\264\247\200\372\330\220\254\336\026y\221\352\306\004DC\005\006M\374\3466o\377\337\340\202P\353\nF\241U\025s|\333Z\t6K\266\334)_\371\334\255*\273\314R\017\303D\003^\270\320\341q\220n\326\267Y\226jd<P\340\215r\273\312\021\022\212`S:S\275\213\r\213\243\312\271MD5\341\310\207\204G(\340\211\344\237\3150\325\314\232]eW_X\246\240\314\024\210L\275\373\253\270\251\234C\210\246r\216\215\232\201\247?\004-a\244\376e\232M\202W>\337\203\202dfA\0377\205\310L\202\243\277\361\237\260\346\n\231\331y\rR\343\205\231\231\330\350^\351/"
+	.ascii	"\375\303 Ff\266\227\256A. P\002Q\252\252\007\352\003\320G\262"
+	.ascii	"-\270\230\nM\030\215\210]x\035e7\024\344\270{\204\304p\366\204"
+	.ascii	"\013B\337\004\017c`\340\205\234KxL\350\205\213\275xB\2315\026"
+	.ascii	"\224\240\230n.\320\f\257C\332\365\240\371\204\242\360\330\240"
+	.ascii	"\306t\260\370\347\313qYx\315b\302;\307o\330\326(\332\321\335"
+	.ascii	"\261\r\247\206\031$\234V5\340\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1447ac0332487357,"e",@progbits
+	.string	"(\265/\375`E"
+	.string	"\235\005"
+	.string	"\022\211\035'\2205I\007\357\364\227\237\303\337\321\317n#6#\032\266'\317\235]\201\377\030wn|\277\212mh\344\267E\016!2\311$\257\177\252\355\031z\313\367P\326\224^\353\035\375+\2051D\322\302\213[\222Tm\2656\017V\334\t~\340N\310\222\034(9\320\217U\203\013\020\004\002\032\262\021E\t"
+	.string	"M\023I\364f\3263\253\323Q\365p\365L\326\264\310\324\366\3223\341\214\031"
+	.string	"wF\013a\016\3235\005r\340b\341\005\035\016Ac@\004\325\313@\f\001a\210\013s\f4AS\210k\270\302@\036\212\227\b\013\204\030Z\3174\301Jp\266\250\fY"
+	.ascii	"7"
+	.text
+	.section	.gnu.lto_.pureconst.1447ac0332487357,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\232\004\002\232\004\003\230\004\006\232\004\b\232\004\t\230"
+	.ascii	"\004\n\232\004\f\232\004\r\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.1447ac0332487357,"e",@progbits
+	.string	"(\265/\375`_"
+	.string	"\205\004"
+	.string	"RF\024\037\240'\351\377\243\356\377\377]\205\324\371"
+	.string	"\177\037\216\r\373\377\277\265}d\222[s\2445\"e\n#\024\213\003\362\263\313\255\273Ih\037\024\315\022\373P\f*\371\366)(\017\024\320\371\224;E\213\361\243o\267\376\255\360\2347d\312\257lpuz&\002\033"
+	.string	"0\b\311\022X\303\200`0\360\n\240\017&\303\203\364\255\202\001\2717l\001&\200\003\n\363\023\324\002X\267&\"\r\243w\3324\024\244\300\005>=0j\022\304m\t\376\022\310"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_.lto.1447ac0332487357,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_currentMeterReset.17.1447ac0332487357,"e",@progbits
+	.string	"(\265/\375`k"
+	.string	"\315\b"
+	.string	"FP<80q\323\001 @S\030y\235\201\265\031J~c\2161O\003\237\240@\177\2057\306\232n6\f#gC,G\001#\"E!\212\243\346,\266Q\b\327\262\372\323\266{\247\024)"
+	.string	","
+	.string	"-"
+	.string	"\237\366l\231\203\245=\n\306\205J\270\273Tr\334{\364\374\227\034`D\n=r\032v\327qD\322\270\345m\037\330^\260\177\005\276\351\217U\005\022S@\263\233\221\252Y\324|\361\270l?\332\0379\211w\023\350\002\273\037L\313.\250\340\004\353\323\340\t\252O\353\003U\247\360\363\024\316\307I\004\341\266\304O&\254\335e\360M(*\002J\035\237>\250\372\234.,\341\214(\246l0\024\345\206\375\315\356\256\345\3475\3532\3174\326\351\264\254\326\017F\271\272qZ\306Q\r\342\301C\261\312\321\216\201\267\210\254\322n\333*\275\300\375f\345g\207\020\224HZp_\t\017"
+	.ascii	"2\241c\034\030\027\006\\\003\016\242`1(\306Q\224h*l\310\004V"
+	.ascii	"0\357\022@\263\232\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_currentSensorADCConfig_Registry.22.1447ac0332487357,"e",@progbits
+	.string	"(\265/\375 \230m\004"
+	.string	"\364\007a"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\303\336\261\023\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\315\030us\334\007uq"
+	.string	"\005\001\006'\001\004\200\002?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/current.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_currentSensorADCConfig.24.1447ac0332487357,"e",@progbits
+	.string	"(\265/\375 &\025\001"
+	.string	"\320\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\031\001\220\003?\202\210\200\020\177}\274\001{\273\001"
+	.string	"\002"
+	.ascii	")C\017\240\b"
+	.text
+	.section	.gnu.lto_currentSensorVirtualConfig_Registry.28.1447ac0332487357,"e",@progbits
+	.string	"(\265/\375 \212\r\004"
+	.string	"4\007S"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\346\321\027\007yw\350\347\006yu"
+	.string	"\005\001\006'\001\004\201\0020sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/current.c"
+	.string	"\004"
+	.ascii	"\\\005N\271\t4\311\033@\021"
+	.text
+	.section	.gnu.lto_currentMeterADCInit.32.1447ac0332487357,"e",@progbits
+	.string	"(\265/\375`U"
+	.string	"\365\b"
+	.string	"F\220=:0\3456\035\036nx\202\b,U]\234,\223\"\254\243\250\007\237\273R\313m@\340\315X\302\034\004\374o\212\215p\210\022\005\005\004\265\007\245\232\277\253eP\213\036\252\272\221\275S\n)"
+	.string	","
+	.string	"0"
+	.string	"\337\370\263g.\232\366'\343\005\212fw\351\004\371w\371\371'\371@H\002/\003\026v\3272$e\334\363\2669\266;\266k\002\226%<\371\360\226\357]\267\354\t\n\371\320rE#5\232\240-\202r~\330\257v\226\354\212\200#&Ae\027c\004\260)\353E\304vn9\213\314\210\307Za\034\003X\354\2128?=E\023@9\352\363\240i\\\304\306%\017n\230\253\363\237.z\006\246]\321C\277\344&!?\344\001\306<\240-\2535\204\321\256r\335\226ut\3734h\024\253\035\365 \230\203\310*\005q\\\245\033q_\355,\231\241#%\232\025.\220s\344r\207+\017"
+	.ascii	"2\241\377/0x\f\024s\001\310\031\f\004\311@k\200\022\004\241\031"
+	.ascii	"\027F\262`\361\313\020\340\322-\332\371\004"
+	.text
+	.section	.gnu.lto_currentMeterADCRefresh.33.1447ac0332487357,"e",@progbits
+	.string	"(\265/\375`\t\005M\037"
+	.string	"Fz\310H\220VN:\20074\002\301\213\364\016.8"
+	.string	"s\241\026\243\332"
+	.string	"\367:\317\373bE\022\201y\020\222Y4\253\273o\226n\273\322o7#\031\340\231\213a\342\317x\222\314\233\016\007\366\377\377\377\377\377\377\261j\2114ir\247\024\247"
+	.string	"\251"
+	.string	"\271"
+	.string	"k\345Y\215\217\375d\277\327\327\276\037\344I\273g\021\007\263\0053,\"l2\277\214wVv\261\217\371?\334\363A\234:\230{\\e7j\255S\276\017\367^\332\236z\030\325Y\225\342\024{\221\346Vk}p\276\334\177\271gw\275\007\361^#\316*\344,A\002\205[\255]\003^:\301\371R\206\236\332\327\361\035\304#\251\314\253\325\205\231\220Zk\001\0238_\n\375f\367R\367\232\335K\023m*\357\232Q\037v\002+\fK\255\325\2672N<%\372\377:\357\230Uuj.\250\265\232\036\263T\334{\333E\266'\330\245\211+\264\237r\243\355\2006hwf\306-;M\036`\367\263@[\232\031\271\254\350\234\315\375\331\377\270\016\216E\033\326\226\"\2353"
+	.string	"J\340v\323\007\372\243\271F@Z\254]m\225\335eE7\206}]]\030\266I\235dR#\361\250\217Lj\243\"\223\232\210G=\364\261[\350\244\016:\251\201N\352\037\223\332\307\244\356\341Q\363\230\324;:&u\016\217\032\347d\367\315ImsR\327\234\3244&\365LI-SR\307\224\3240G\376/%u\317\244>\357u\233&\265nG\275%5-\251/\300\345\206\222"
+	.string	"q\265\242\230\323R\003P\330x\214\\gwr\366fup6gOf\016\177\342\004\307fo~\366\232\265\031r\232\255\331\245\331\227\321\335\325M1\252\371\320\357\301\316D\351\254\265\370\243\257\344K\"HPR\332Q\250@\177\244+Db\253l\356w\227b+itKZ{\351jT>l\265V\004~\222\247]\300\220!\303\356\345\277^rm\211\035\337\220\326h\223V\027f\314q\264H\253C\333p$G\216\366"
+	.string	"\024d\221\255h\215VJK\314\310E\264B[\2644\314hch\211\366X[>f\016/\322\341\254\365\n\201O\344h?\237\306K3\001\351\217\300\335\313\2415\263\332p \213t\316A\001\302\241ST\210&'\247\246'\027\240\223\324\323oi\370k\320\3442d"
+	.string	"\034\376<H]\030\n\177N"
+	.ascii	"\314d`\b\005\f\006A0\371\204\301(!\024P\350\203j\372=\371\230"
+	.ascii	"\202B\237\201\037GI\001\203\276aTT\320\327\353*\376\353'\020"
+	.ascii	"\034k\305\265\362\314\216g\241\222\373\361mf5h\305\031\325d6"
+	.ascii	"\316\311\227\031p\364\312\361-f{+\243e\225<\262\n\331Z\265\202"
+	.ascii	"\271\271\261\253Z\213E0\033\263"
+	.string	"?\027fw\320\214n/\253\333s\3154#\327\223&\362\270\025'\317*\177c\200\301\201\203\335\313\336>\371\244!prH{\351mT'\025\335Z0\223C\372\254\r\341R\242\254\330J\366\354\316\372\360l\317\352\3206<X\250Q \305\220c\312\f\215\210L\"i\232\003\220\002\221\251\233m\022\200\306P\351\244D\0236\327\377\f\"\214\007\265\f`\311\274^X\342-\032\030~\2027U\235\331\345\002\335\352F\322\347\200Qh\272\202u\216 \256\371\204\304\032]b\365|r\203\nk\224(\203\007\236\\\221E\221s)~\205YD\306\024-\304=A2\3207\0020\370b\234\212\267\231\025Y\364\303\217\257\306\315|P\335e2\225\215\004\342\245B\276]qWEC7\365\340\260o\2205y\376\301y\273K%C\345\023\362Q*P9\030\252&\312\b\303\273\270\t\b\333\bT\202\273\353\272_kf,\303\274\372\246"
+	.ascii	"\352\340\304? \371\213WO\003"
+	.text
+	.section	.gnu.lto_currentMeterADCRead.34.1447ac0332487357,"e",@progbits
+	.string	"(\265/\375`\004\001u\013"
+	.string	"&\025L@ m\234\016$\004\202\001\314\251\231\262\202\333\033Y\264\227\313\007\224\305K\270\250\020\230\341\026\220fM\237``T\306\311\357\207\020\027"
+	.string	"f\240\024>2\\+\373\244\241^\320J\001>\020#\267\2252\2456"
+	.string	"8"
+	.string	"<"
+	.string	"\273\241\305\037\222G\207\337\260\036%\327\260\036\355\331'\036\216\366\247\005\tN)v\367\322\006\367\236\236\177\t\237|\241\317\323\"\300\356:\277\220\350\326\333\356\260\rb\037\fZ\021\241J&P\256\354\360\223\312\300~dw\327\n\3327\3751\323\232\351\314\364'\027!Jx\254v\025\254Vl*~p@\261\375\264\017\341\021\274\233<\317\330\005Gt\b\217\032T1D J\251v\346\031\322\004\201c\270\220Jy\200Rq\2655\267p\352\264\312\210\344\261\036\225\304\207\302\006^\201\223\354n\210?\341\0248>\351\321\007:\371\357\321\357X\217\017[\326e\232h\354\322m\262m\343`\027\267i\334&\343\256M\006\243\271\260\215\273.\034\326\nd\333\325i\332vQ\302}d\025\264"
+	.string	"\021)\220\"\260\252\215\271\007\354\0348"
+	.string	"*g\3370\300\242\n\030"
+	.ascii	"2\241\241/0<(/\324\202\031\301\227\335\346\203!\260\030\220\020"
+	.ascii	"\204\375\004\212\301\033\200o\025\262lA\030\245\244[\023\354"
+	.ascii	"\251\210!\325\335\001f]\302jV\243\301]^\264\223\f"
+	.text
+	.section	.gnu.lto_currentMeterVirtualInit.36.1447ac0332487357,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\315\006"
+	.string	"r\315/2`M\323\001K\241\007\322\270\201\rA\324 \301\200\207+\020\234+\224X\307\022>v@\263\027\301_;%\b\202\002\034\021\013\024l\004\302\250\321\266\2252\245\216*\226I\202\360\022\275\nR\325$UoRHXx\021\254^\245\300\024\203\004\237\205\242\340\243h{\325 t6\214B\370\311\201\333\343\201\376\3155\213 \333\305<\372\032\337\270\370\027wn\260\362\361\316\267\236;\333\341!\037\235\034$[\204b\266\206\245V\330\237\254jl\025(\371\200Bv':#\273\271\016\f\333\247\370\262A\256e{\316F\202#\262\273O-~=/\377\031\017\210\031\354\tp\260\273\316\230\241\270\365\266\rlC\266\263\b"
+	.ascii	"3\001g8\203\004\3365\256\211d!\340\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_currentMeterVirtualRefresh.37.1447ac0332487357,"e",@progbits
+	.string	"(\265/\375`\036\004\365\033"
+	.string	"6s\263I\260\226Q:4G+\021\256\347\306\204\241f\r\317\270\003\r{\335\361\216}\234\033\207\234\231\274\207\243\303\224\271\341\267\377`Q+\320 JF?G\022\030\261\346+#|\023\006\352x7\204\243P\250$\237A\373?!\204\310\235R\227"
+	.string	"\220"
+	.string	"\244"
+	.ascii	"M@\367\341\rW:j\255\260\2136\220\r\273Ha\366R.\204\251\275\030"
+	.ascii	"T8JA\017\032p\241e\302R\333\001\004\335\203A\262g\241\342AUk"
+	.ascii	"\220\201%\264.\372\324>\217'\351\016\314\331U+\214*!\265V\006"
+	.ascii	"^\320\272x\340\004\306\213\341e\306\213\326\331W\017\032\325"
+	.ascii	"3\001A\301\244\245\326:\333\031\327}\024\303\245:\237\244\340"
+	.ascii	"\362\375\204>\276~C\027[<<\361\324\243\033\340w\206\007j\255"
+	.ascii	"g:M\361\343QJR\250\265\232\372~,n\362\266yl\233v\b!^|W\276tE"
+	.ascii	"(\024_,\342Q<\255Z{\021|\250\007!\341\323\270\350\236\222\336"
+	.ascii	"W\216\027\277\017\234@\331\002\334\321,;\310\243[d?\254+\303"
+	.ascii	"6$u\rI-#\251i\016\374\013,\365"
+	.string	"\fI-s\247;\346K\377\200+\3750\017\376\002\226:\366\245\373\265\324\256\245n-5\271\324\343H-.u\270\324\273\324T\244\376\r\f\251\311\002#\265\252\310\352R\231\210R6\356t\373>\374''O\265\204V\264~\024Ua\325Z\025\\\364\316\217\007\255&w\202\223\2233^\224\3317\235&\251\300A\224\004\\\222k)q\255\324\325\216q\213\374\247\273\260\252\256B\005w\270\003\366\265)\354\026\222\\\202#\367]\231Y\272\255\025\223\234D\344\024rg\366\006\312\211\024\263\244\325y$\356\270\244\227\017\247\002aD\\\tJV;\200\273pc\366V'\221\203{j\334\r\327\206\351Dz\355kw\377\245F\324y\304\243Y\342\026=\\\031E\016\263/\206r\320Z\253\320>h\024\260\262\241\033=\252\364(\027\323\265C\234H\316\300\224Zk\004\177\310\245h5\233m\274\030\006\267\322\254\321.\2306\334\316\216\206"
+	.string	"?\245\311\341V\232e\006\035\237\n@%\006[\t\323,o#L\032\035[\317\215&\232\025l&M\347\247\203\211\243\225"
+	.ascii	"\340Z\003\323\307v\273\231\250\315p\267\022\347c\303\315|xh="
+	.ascii	"\263\332\r7kp\343\362\307v\233\231ey\233\301\202\273\207g\272"
+	.ascii	"\205#B\266`\355\226g\033\016\257\222\213\031Q\301\311\261Y\017"
+	.ascii	"DYN%5+\305Q1\243(\024\213\357\212le\266fE\250\223\210\027u\240"
+	.ascii	"\225'&\325\023\262\262\232z\265\356\020\320\254l\177\036\305"
+	.ascii	"\226fk\246N\254\002\353\332\330\222I\316#^\223;\374\211\243\002"
+	.ascii	"P\250Q,E\225A\b\ndD\002\231\005-\314\030\200\002\2212c\007\020"
+	.ascii	"hGCI\306b[\326Z\211\253q+\244\235\205e\025]\033\3060\240\347"
+	.ascii	"\026\332\206\202X\253\372\033\352\351\366\221l=\355h\374\372"
+	.ascii	"\241\037:D\342\341n\256}\276'uj\005(L\033\351\2606`g\232\216"
+	.ascii	"\201r\352\027\256\206{A\325l\216R\\Cf\216=3\215\nK\373\\R\222"
+	.ascii	"l8\224h\244\225\205\"\272\366\2447\274\004<&B\033ux\215+\260"
+	.ascii	"\225\341\022\375\332A\312/\006@(\3105Y\255\222\273\222D\350W"
+	.ascii	"\025\001\205-\234\2737\253\017\223\262\333\016\376\003"
+	.text
+	.section	.gnu.lto_currentMeterVirtualRead.38.1447ac0332487357,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"\375\n"
+	.string	"F\324I@ \347(\035\220e\225\247p\002\335\335\237\205\217G\240\226\3225 e\002\t\317K.\204\230%\200a\264\206\035\213\256Y\210\30166\bD\261\202T%RT\367\342#\005\b\212\322sH\345\266{\247\0244"
+	.string	"6"
+	.string	":"
+	.string	"v\320N=~!;\325\256\220\235\032\264\r|T\355Y\003>X\nv\267\316\221\203\227\240\177\224\037\204(\323\245\301\304\356Z\206\250\220{\336v\203m\b\373\035\0010\361$c\366h\222S\304\376fw\3273e_\3747RZJ\351k\234\032\002\236\226]\220\330\202u\321V\t\307\366\245}\223\237\200\027KO\330M\t\230\331\035\037\0020\237\372:}\221\023\241\225"
+	.string	"&b\334\245\202\204\346\323\006\235\205\265\321uT\253Rv:\003\204\007\254\361\225O\333\335\b?\345*#\177uj\016\222|x\352\223\262\323\317N\013A\036'\342@\324\233G\024\342<o\264\325\317\353\276\020\367\325\320\307\002T7\357\253\036\006w\031\234WE]\347U\316\270\337\354L\231\002\200\3534=,\247\275]F\026\340\036\363I\274|\361\025"
+	.ascii	"2\241Q/0<\250^\320\206\260\007\017&\233\n\201\020\260<\310\r"
+	.ascii	"\336q\024\035La\243\224\364j\202=\0251\244\272\273`\324%\254"
+	.ascii	"f5\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_currentMeterRead.39.1447ac0332487357,"e",@progbits
+	.string	"(\265/\375`\316\002-\024"
+	.string	"\006\244\200I\300\324M:d&W-}9\340\003y\n\271#$X\200\025n\266P\375\272\007\227\340\206dQ\220\020EJ\352\3506\366B\341\351X\233\254\240=\026\025\005\323\324\366)\224\005B\021\032W!\204\260\037\354\nY\020B6\331;\245j"
+	.string	"a"
+	.string	"s"
+	.string	"7\031\003\330=\241\264\333\305\235\270A\370\232\340&\337\253\367\002\337\253a\266\324q<{\235\n\020BT\273;\322\024\207\035\374\252G'\314\317\335\200\324\314\301\241\227\024\311\276\320\346\365\203\207\351]w\002I\271\247\0324\233SoAm\211\304"
+	.string	"\032\215g\342\224\023\365\334g\b\232lN0\302\356z\316h5wx\3332\333\016l*\006Fl\234l\322\035\373\264,\313\322T\307\256\323a\235\006\353\364w\240\237\376\366\237\3447;*!\023\230vG\224G\266\251\336ha\373>\215\353^\036d\0050j&^lQ\350C0\017\362\001\024Q5\333\356\212\2576\214-\276N\321\366\304}\006\354@1/\331\32592\206\257\306\205\237\366m\377\201=?|\246Q\021'\034/L\371\222\205\353hA\320\371\302s\250\234\370xU\n)IM\222\fpu\034\023\b\353HG \025_ U\335\274r\243\226"
+	.ascii	"\236]\007\026\277'\346{\245;fS\3279\303m\264\302\335}\340\023"
+	.ascii	"\275\310\345\367\274z\303k~\366\372^?z\335'T\t\234\332\317-6"
+	.ascii	"\313\373\314jM\224\3568\300e\276\323\003\255\230\031\362\004"
+	.ascii	"E3\003$\313\205\325\252\030X\246W(.-,\222\344\260\032_\244\353"
+	.ascii	"\325\302z\215-,*\255qE\276F\024\004vi`\221\243\213\313E\216\""
+	.ascii	".vo\251\316s\227p\263\253\n\022\2432ow\027Ly\217jDD\265r\036"
+	.ascii	"\240\013\242\030\f\376!\257\336\364\241O\026\"l5\033\221\330"
+	.ascii	",\317$\373)\372L&\2456\205\n\3633{t\306SS9G\225\356x\227{I; "
+	.ascii	"\300\002\021\301\333\006\263B[\315\3009\347\247\213\323\002\260"
+	.ascii	"\341$\300\243<\211B\340\374\347W\nD\257\352\334\244\t\221#Cm"
+	.ascii	"\316`\255(\224[0^$\360jE\303\303{\003\005l\t\213X0\234\023\257"
+	.ascii	"\207\355R\211\2510xX\346\200\005\306xX\314\375`\241\260\216\351"
+	.ascii	"\353\006\006\243\260\345C\"V1\020\211!\272\027\3667S\337\013"
+	.ascii	"V\247\204.qra\030\216R.S\036)3\232cu\211="
+	.text
+	.section	.gnu.lto_currentMeterRead.part.0.50.1447ac0332487357,"e",@progbits
+	.string	"(\265/\375`\360\001\235\020"
+	.string	"\206\035iH\340\2228\035\320\024\355\216\005\224\017\036\326\324\023\323\016\f}\374\026Q= \\?\340Wi\201\021\324\311\261\216\347\277`\026\352\241a\360\251J\031fg1!\214\321y\300\240\3178\336;\016e\330\226\025\233\030E\277\333\336)\005Q"
+	.string	"S"
+	.string	"R"
+	.string	"+\236\330.\331\340\325\f\266W\223'\360y\335.\340\363j_\206m\324\212G[\347\244\313\236\346\205\210V\221\335\355^\251\213\217\247S\033}\327\007\350\310\340\300XB\234\276<\t\221\024\034\030K\211O\222k\240\t\273\353\315\304]o[\202\355\007\366\374\020/M\1779\201\017\225\212\3355\331\2479\314\346|\362\227\r\264"
+	.string	"\242\232\261\273\334\t\365i\240|\2279\333\237A\275\2052+l\352\304\202WS\231\327\030\337B\361\310.\213\033\007\333+\002\215\363\234'Q\2179\025 \227\304\212\347\264\017s\326\370\230\323\003\354\006\247\317+\235\251\byi\016\317\361m\273\013\301\227\035G\007\377\345\325#p^\005\374\274\236\276\374\314A\261R\301\260R\263g\322\026S\355\332\322\225\r\232\246'\377\t\232\376\246`\026R\355\216\350\341\331\025U\026\3433\277}\377\306c\342_\326jnD\033\001\033\276\031z%oT-*)\221\27404\211:1\004E\222'v\244\317d\324\211B\261+9`\320\203\027v%\020\f;\356\256SH\021\333\t\222\242)\246\224\266\330\246\026\336c\346`\370\354\213P:\303yh\350~\274\356\2404$\033\262\3032\271\216\0130l,\272\315\007\300\245\006\204\347\277\0040 \220\002\021\263\343\006"
+	.ascii	"\nPs\017\022\201tC\3723\246`x\234\330`\255\301\341T\201\006\314"
+	.ascii	"^nj\243t\216\002\202gkN\246\300\006\017C\270\033B\210<0\302\037"
+	.ascii	"\203\214\212\022\b+aJ'nS\320v\327\275,A\243T\366d\212\275\332"
+	.ascii	"\377H\372c\350f(\302\220\307\313\235\244\325nc\312\032\003\200"
+	.ascii	"\366\216\236LKOxc"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1447ac0332487357,"e",@progbits
+	.string	"(\265/\375`$\001e\b"
+	.string	"t\013 \002"
+	.string	""
+	.string	""
+	.string	"\0022\177\033\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005#\021\201\204\001\021\177\034\272\200\202 \177\035\005\037\017\005\022\f\200\003\002!\177\036\005\023\037\002\"\177 $\177!\002%\177\"\005\031#&\177$'\177%\377\377\377\377\003\005\034&\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\032'\005\030(setdata"
+	.string	""
+	.string	"\005\026)\024*\020+\017,"
+	.string	"-\001)\177.\037"
+	.string	""
+	.string	"\200\200\200\001(\177/+\1770*\1771\003\003\027$\003\003\026D\003\006\031$\003\006\030\344\007\003\t\r"
+	.string	"\323\243\362\362"
+	.string	"\001\242\006"
+	.ascii	"$ \260\002\031:\333\001l!\017\242\203\224\006ai\030\3521\340"
+	.ascii	"p\001\271\222\245{I\030\013\213\020\b\016\314f\f\230\261\031"
+	.ascii	"o\225\220\356\024\270\007\021\303\320\305}G%s3\235O\307\214\027"
+	.ascii	"$:\2449\214\223.`\204\027\236\225\201\337\360\257\361\0335\301"
+	.ascii	"x\002"
+	.text
+	.section	.gnu.lto_.refs.1447ac0332487357,"e",@progbits
+	.string	"(\265/\375 \243M\003"
+	.string	"\262\t\030\032\220)\351\377\377\377\377\377\377\300E\253BU\375\255\355\033b\263\2154\"\267\224)3\034\020\261\251\205\211\002~\364\333gW*\300\r\333\205\355f\317\354\227\355$}m/\235 o\004\354\323\257\376:R3\272\027\335\212~\242\217\350>\240'\240_\016W\272\023\364\007\372H\363\360\225\305\273\337\236\177#\001"
+	.ascii	"\376N\204("
+	.text
+	.section	.gnu.lto_.decls.1447ac0332487357,"e",@progbits
+	.string	"(\265/\375`\347!%\230"
+	.string	"J\364\2545Q0P\322I\007\312Ug&"
+	.string	"\001pG\300\374\273\377\335YP\032I\303\377=^\315D,\023\236\215\240\225\202\213\277\261\265\0039\304\265\r\264\020Z\251\310\n"
+	.ascii	"AAir0\344\340\265"
+	.string	"\037\371\311\035\275\352CDK\375\3450\247\343\223h1\325\020\331R\246\325\002H\003T\003\317\271\265\t\3525\275\367\231F\310p0\314\205\036\335\312d8\220\241#\270\314s\247\203\240i\203\266\255\347\021B;8\310#\204#V\246\2237\263V\343\324\247\233\230\226V\375j\230C\250\266\374X\312\246\002\311\240\037K\331<\220\221f\312\177\034\206\241\354\307^\316_\030\f\223&~L\236\313\344j\202\225h&=n\221U\345\313\036\204<\035\266\376\334\205\013\330\225\223\266z\336\302P\346\302|\375\2747*\315\213\002c.\254\205\367t\226<\227\311\004\005V\242\204\nv]\312\b\325\367\215\365=ce=\306\302P\020\234\345|\205\245\257Y>\3573\314\017\246\251V\3370\326\032\356e\020B\036\034d\020\3027sm\356 \344a\017\302\237\255\200\030\2165\311\352\321\352\035\2077)O\266V\253|X\301pTe\001\256\177"
+	.ascii	"\255\315l\311\033\237\325q\024^\323\261\271w\313\r\214\247\260"
+	.ascii	"\035C\271\216\245\224\370\240\346\230~9\255\352yo=KYm\023J\353"
+	.ascii	"\331c#\005\b\023<3:F\3435\233\346\\\227p\375\2302\035+\3418\233"
+	.ascii	"\346\264\221\301\225\365\204\2350\224\351X\356<\307M\230%>\324"
+	.ascii	"\b\241K\343\022\252\227\262\007!\016\233\255p\037t\234\306\330"
+	.ascii	"A[=k\255\347\263\266\313\261\224\215\301\214P\231\336{\231\260"
+	.ascii	"\033C\371\215\331\316elv\365y/\333\275\367\017\374?\3477^\302"
+	.ascii	"k\0058\335\273\205\025\300\326Z\323]\340\275\267\304\207\022"
+	.ascii	"7L6\212H\205\352\217\326\223\260\236\203\365\024\254\374\344"
+	.ascii	"4\206\036\nG\317I\370\3546\314\347\215\336{w\270K\212\262\253"
+	.ascii	"\325\377\254g\265\007\260\2747\202\337\2542\334{\357\220\017"
+	.ascii	"E\370^C\260\007\241\372d\017\302\225;\bWH\001\300\337L?c0\346"
+	.ascii	"\001\374M\003\235\223.3s'?s\001\376\026\343\341G\305\204\363"
+	.ascii	"\374\255\343\177\333\377\267\207\371\231\n\030\274\017\377G\374"
+	.ascii	"7\341?\003\377\377~\356;\002\177\337\370\031*b/\313\317P\260"
+	.ascii	"\350]\347\357)\025\362~k\342\377\226\377|?\357\370o\177\373\301"
+	.ascii	"\317R?\313\370y\352\347\030?C\375\354\374\231\306\225\237[\374"
+	.ascii	"\354$\375\277\363[\025\376O\371_\367\237\312\207\177\303\370"
+	.ascii	"\331\312\317v?G\371\271\354g\262\237\305~\376\372\331\353g\036"
+	.ascii	"?S\375\\\343\347\013~^\341g\025~N\341\347\022~&\341g\021~\006"
+	.ascii	"\341\347\016~\326\340\347\024??\360\263\b\377\341~.\361\263\003"
+	.ascii	"?\373\374\257\362\263\002?7\360?\372\263\211\237G\374\274\300"
+	.ascii	"\317\b\374<\374\231\377\247\371\017\370_\314\377\020\376\377"
+	.ascii	"\375\347\362\037\357\377\335\377'\377W\374G\361\337\356\177\316"
+	.ascii	"\340\340\340\340\257\222\370\205\034\374\037\212\002t\315f\006"
+	.ascii	"\266\026\331\2026\006\313\334\234\005k9\246U\262\2449\231\213"
+	.ascii	"\203v\\\203\361<]n\216aJ\242#x\246'\030\346\346\326LV\236\313"
+	.ascii	"\224%\n,'\217\331\306\245\337\336L\330\355V\t\3415\341\226\""
+	.ascii	":\232\254\226,i6\276w0+\354\b\216S\221\032WZm\266\232\274\"C"
+	.ascii	"\334Z\275\260\tzh\257\361u\336[u\255^TV\330\221\341\020!g`D\337"
+	.ascii	"k5\200\353X\243\215u\232\360^~jI9o\225\223\304\337\317wZg\221"
+	.ascii	"f\001\274\241\215\274\217\374H\237\255\312{\225\317+\305m@\252"
+	.ascii	"\252H\334 \301\202F&\311\373\354_p\356-@\370\026\370\343\256"
+	.ascii	"\3256\353\246\272#\372\245\251\325\003v\331\177\233\033\256'"
+	.ascii	"\223\264\325F\362\245%\257\254\212\315 \240\021(\255\276\311"
+	.ascii	"X\212pJ\222\254<,\353k\230\254\177\377\302\273t\336{e\324<\257"
+	.ascii	"\223\t\347\\\303L\342\317a{\365^\0024x^\245\224.bV1\271\245U"
+	.ascii	"\210[#\275\227\271\245\304`k\212\271E\325\214n]%s\210\262\307"
+	.ascii	"y\267\224\315\350\275=\227\311T\252\320\272=\315\350\235\272"
+	.ascii	".\362\246\370>\267\224\227\251u{.\363.C4\231[S\315\350r\252\247"
+	.ascii	"\031\335\232\272\321\255\313s\231K\247\023\363:{nt\313\357F\265"
+	.ascii	"\246x\232Q\255\251ft\013\007\3335\271\324ME\351\302%\204\375"
+	.ascii	"\232\314\033#\352j\351\344\2216\237Z\227\357^f{q\235\b\334{\245"
+	.ascii	"\345\344[R\361\034\2234\006\023\223\245\026\203\210b\342\322"
+	.ascii	"\272Li\263\210\326\275E\230\212n\024\004\312\247\364v\261T\271"
+	.ascii	"\343\352B\275\270w\200\373\2747\352^%_\351\275Wy\357\035"
+	.string	":\257\236\367\342\340i\202EE\335[\365!\352^)\233\274\270\267\331\372\346\246\232Q.\255\237&J\242`\267\351\251d\260\313\267\345\\\243\312\264\013\365\267\202M\315\b\323\352\315\\\2166\032\035f\267\244a\326<=\237:\202zRd\372\213\356\211\025??\2573\264\275\232\007+\235#\360@2\345\350\0312\301\272\2563\264\273:\210\312|\336\031:Lh\252L\3340\265y\365\265\332@\230\344H\237|Y\246\255W\205\220h\0376{\177Xl\\=\232\307\316\2251}KZ\355\035\375\004\003MY\253W\233\326\277\235\316\320v\352\255\016\236Wy\243\027$+,\360:\235&t\300\001\341\032k\365\226\312*\003nz&e5g\026\343,\356g\n\256\241l\340\305Mi\300M\243\242\304M\2778/WW6\327W\215\243stV\337h\254\326j\252\266bhWu\215\367S\3038\353\252\236q9\035\346\363\n\271"
+	.string	"\316\352L\325\\\223\017"
+	.ascii	"\365\266l\275\025\262\336v\255\267=\326[\256\365Vk\275\305Zo"
+	.ascii	"q\254\267T\353-\2155\004w\020\266\026{\020*`_tSM\337W\227\030"
+	.ascii	"\340\332\314v\301\320~qUM\353\231c\2276\356\344H\bwH\b{\331\255"
+	.ascii	"l\246\367\262\357QDp\034\3465\273\367\331K\365\336%\263\b\035"
+	.ascii	"f\0215P\274\226P0\203ir\274\214e\351\201\206\3170\224\323\260"
+	.ascii	"\231<\026\264\001\267\023Z\266\3336\272\034<\266\200,q\333\263"
+	.ascii	"\002\343\261\376&\307\372$Ob\243\254v\245\030jUEb]\342ve\005"
+	.ascii	"\275\215\252AQA\263j\227\342\204\206\246\325\322\206Mv\374X\352"
+	.ascii	"\3009c\025F\213}v\r[d\013\211\264U{v\271:5\270i\377\300\223:"
+	.ascii	"s\363TV\326?0`\273\313)\022Pt\214\325\231\350\361\222\216MYo"
+	.ascii	"\307\330\222A-\231\035\343g\210\270\254\260#I-T\177m\253\035"
+	.ascii	"k\016JF\020\237`k\226H\rh\332\210\264zk\244\003Y\270\367\331"
+	.ascii	"C\305\231\325*\212\237\333\033\204G\236\350(C\204\255\330\217"
+	.ascii	"\"\002\206Z1K\204\237W\352\202\301*&\330\013m\306`\220\265\331"
+	.ascii	"\022\021>q\244\244\202h}}5\030\017\266\225\211\367\224\246\325"
+	.ascii	"s\220\262>n\275\254\017[\243\205\027\034z\350%\321\241q\344\257"
+	.ascii	"L\2536\210\025b\201\330.\373\003\214\275q\273\343\206\345A\002"
+	.ascii	"\013M:&\264)s\201\202\246\3123\252\244\210_\253V\207\345\262"
+	.ascii	"q\002\245w\265\305\341G\236\327\r\255\266\325\032\2329\231mY"
+	.ascii	"\026M\025'N9l\340\242\203\254U\213\265\276\260\221\216\260\351"
+	.ascii	"S\363\022\244\325[\254\337Z\331\253\206\262\252\002\323"
+	.ascii	"\352\247\354A\250s\345\347\026G\177\261\331\331\221QA-U\213\251"
+	.ascii	"\313\263\271\031WU\006o\254g"
+	.string	"2n+o?\206\266\025[\3036\253\356\214\022\\pW&n\302r\350\371h\225\306\2239\204q\343\315\006j=\233\211i\3013>3]\306\314J\032{\215T\261K\373\304\322*\236\313\214\3532\215\321g\272\214\216\262\347\336\035x`N;\303\312\260R6\312N1\324\306\260\312w\230\376\373\007\251\215\321hX\220\245?00\273\333\003\374\222\352\250-\346^\n`jvp\326g\237,\223ubi\325\363\312\270\201#\342#G\340\275O\030\026\212\241\366\351\037@\344\230\331\022x&T\177\353d\2338sOVM\255\332\246\250\035\214\035v\353o]0\324\276\330i\nC3\244U\313\274\027'\345\023\214C\251\321\244\354\256n\375J\267~]\353\3015\313\024\013\017m\375Z\266~5\262~\035\262~\355\022\3542Q*b\360\312\004\266\336\035\024S\253\r\330c\030j@\223\311IC\226\306\214\216\365l\200\220\007\331"
+	.string	"\341W\254\265Ip\007a{i0=\375mv\220\314\365x\253\261\276\277\210"
+	.ascii	"\304\312[\253jsyw\371m\332\356\013,\312\271\276\267t\337o\243"
+	.ascii	"\3037\244-"
+	.string	"\255\325\257\315\365\315W\3636(\346F\253\255e}1\024\034\301\001+.\253\265\374}\245\363z\217\005\001f\030DC\246\325\306\322Y\336{\255g\225j\275\007\201\326\275\313\336\3339s\357r\207Y\004\263\b\025\t\327\227\233P\375\020p=\037{\020\346p\007!\317\375\274\245\035\204\316\252\347e\273\301\2132Ek\365\303&\353\335]\257\255Y\311\n\013\264UrN3dvv-\306wn\225\203\302\331\b\301j\376h\365C\252'OzJ[\031\031Wiu\357)61\246d\271\255\266\024^\243\353\033\033\322jG\351%\221*`\276\264\332Pz\271FgxE\317\320\005\305$1\271\242\230$\016)-\r\200TB\"\032%\215E\240$\023\200T\244x\321\t\241!\242\017\362X\204\301\3508\004\342\250h4\022\213\200\222E\016Z\034))\245\350y\321\t\"\243\3211\211\364)\016-\035\t\031\215|\216\310%\237"
+	.string	"\216\216\226\214\306$\3430\031$\214!\351X\224L2\016Y\020\213Gj\262\210D*\"\t7 \001\204\016/:\001\202\t\036\254\360I\026\211\216\304d\b\027\204\222\216\200\212\307$\240\035\344\220\007;$p\350\244q)\t\bh\250\230<&))-!\007\b:1I\034J\026\221:GJHE\023\030h\241\224\004t@\362E'\224\226\222\216DAH\304#Q\311GH\001!\343\322\006\311\"\362\306\310\242\2175\310 \"%\234d\220\221H\251\306H\244d\2133\030!U$\262x\034\032\"\016[(%\t\251\311\240\t\206\307\244\222\035*\032\211\214\216\210\303\241\"rI5&\031%\205\212\310\341\217ADJ'r\216\304\"!\265\3051\2114\"*\226\220\300\020Q"
+	.string	"\021\003\b\200TL\"[\2540\240\bY<\262(\226\22042z"
+	.string	"\244\"E\207d\021\331\343\300\211\344\221\250tb\210X,A\200\013\031\035\213\306\"\321z\b$h@\202\td\030~\202\n\034\250\300\001\341'\250\340\347\247\002\t~\326K\360c\223I"
+	.string	"\222B\311\027\235`\341cLBBJ\022\""
+	.string	"E\213F\006\r\021\227^0jA\307\201\026\372\247\205F\321B\377\020\033\005\261\177dh\0242\364O\213>\026\223GF\033$\211\031\030\t\r\021s\212AC\036\360\034%%e\020TS\300\322\n\244\"E"
+	.string	"\310 \"#\026\306$  \025)V|(\036\021\205\2205\311 \t~\222E$\013\026I\302$2H'\211,&\211 \350 \203\216\210K\311\243\021\n\003$_d\300\223\224\212G\237dR\322\321\347f\003\033dP\212\020\216\305d1\004\002R \255\305$1\271\302\030\003\361\250\242\210\210\224\223\fB\361@\322h4<\005\024"
+	.ascii	"\2058A\004\016V\241\023Ic\361x\\\022\362A\036\223\220\306\"\322"
+	.ascii	"\307hDD\362\021:\"}N\024P$\"\036\213JH\304\225L\232U2\221\262"
+	.ascii	"\033c\347#\f/\007\240\2250\177[\316Z\355\322\305\376\365\325"
+	.ascii	"\272\027l\270\204\213\3134\314\355_\bX/p\264j\277X\2771\027_"
+	.ascii	"U~SAA\027N\270\034\033|\32130\314\326M\256#^xM(\365\f3\305\361"
+	.ascii	"Z-\237\345\263}\035p`\252\313\n\013\264[n\373x\215\303\237\023"
+	.ascii	"\035\240 \232X\025\216\f-\275U\006\215\024#{6\252*\311{A\226"
+	.ascii	"\245\203\330\3014X3\260\330(:R\264\301.=\261\035*%Tdy\r\246s"
+	.ascii	"$nI\332\025\313cJ\223LW\253ww\326\212\020\216\b\332\3242]0vx"
+	.ascii	"\267V\004\207OyO\252\016\254\341\032\323E\256\257\256\316\332"
+	.ascii	"\351u\341h\231z\321B\345\326N\016\247\271\004L\322\252\235b\325"
+	.ascii	"v\270\332\266\330\220\343\033\342\310\334\352\224\334\272)\261"
+	.ascii	"Q\354\036\316U\252]\251\241\334\2243\031\201\267YE\342&\rF\332"
+	.ascii	"\225&\267Qn\241\240\210\340^\326#F\366\226\255\332'\267N\252"
+	.ascii	"\356\350\246t\326\211\030\217\350\030\331\372\006\324lLM\265"
+	.ascii	"j\347\356\345E\274@\311\035\nN\225\226@\0376\356x\\zL\255\332"
+	.ascii	"7\313\204\241\267\263p\327\241kj\263\013[o\003\007\202\256\250"
+	.ascii	"\222\3310H\322\024CF\251\231\221\221$I\0072\n\020\004C\201\242"
+	.ascii	"\3471\037\022\300\0241\0162\246\230B#\"\"AR\220\244Pc:\321\325"
+	.ascii	"\200\002\227h&`+\311\374\214B\213\242\240\361W\024\341\354\263"
+	.ascii	"\275\221O\216\005\332\242\ne\370\315\276\337\255~\253\361\343"
+	.ascii	"B\234\205tM\2570\313-\315\360lD\234\276\302\361\206`\300R\373"
+	.ascii	"U\312Oa\204"
+	.string	")>\013\324\234\244N\305\363\313{\264\267y8\026\375\245\304\0350F6{}$\306\017\321\372[J\t\371\354\201\370\242\214\001`\f\215\030\244\026fW\301.\226C%\267\030\312uc\277adg\341ni\220u=\361.\030Z\b\360I\370\321\237\255\033\267?\355R\356\251~\334\220\021R+g\321\321\006\272\371\341v\005\262j\003l\300\256Fd\334P\001/\265K\003`\033v\322\322\253\253\262\b\023o\267\303\016 2\370\377?\232\264{\365l\242H\306\214V\327\376H\260\352\375\214\353Y\025\347\002\024E\rqL\260\202\035\315\261\226\312f\302JW\351\303\246\242\276\317\355\033\344\202\201[\354\367\027\003?\355\303lh\265\344r['y\003\021\215\237j\232\3323tJX/\325\252\371\2740\341\205(t\030\225\202\312M\220\351\314\205sq9\200x\ne\235\326\323H\372\311\216\325\365\322\2630\337@-ie\342["
+	.string	"\263U\230Qk\023\001\355\232\220\202V\247g\247\363\233\f\373\206\313\373\023xW]\226%\341\200\355\030\242\bS\301\035\273\330\\\342\340IO\230\242\216\217\311\2721"
+	.string	"\340\301\005\215\260\342\346J4\227[y4B\373jD\250!^\346\215n\220\364!Slj\371\001\232[,=f\032\036\002\341\347\227\335\250\211\231/\306\032@\237\355Q\211\245\024\025\255C\nlx\234\364_\372\016\2336}\340D"
+	.ascii	"\351R\274\245k\275\356mQ\224P\203j\f\371\017\033\206\270\023"
+	.ascii	"c\356\3314\227\345\227\227\034\320y\301\030\314 \245p 1\036~"
+	.ascii	"!\020\332-\027\256m\217m\260\211\353\243\025"
+	.string	"\224_\317\030\016^\252F\3451\020)t2\326\271$\361\327\201\262q\031f\272\204\242\bs8u\360\357q\265u\251\334o\312f\211{<\201\n=\226\031|\253\321\t\307e\343"
+	.string	"\346}58\306*\366\013\252\252\363T\002\3541C\321F\021\\\001\035\252\302bG,\2644S\340s\350N\246\026a\323\331\3558];\227oB\213&\207UE\334A"
+	.ascii	"zC\254\233\347\327e\224\244KE\b\271\240$I~\211n\006%\223\035"
+	.ascii	"\374\367\212\240K\324\320\264\333\257\210\021\264\202W\201\317"
+	.ascii	"g\346\203\266~\213\016\273\232$\013\t\331;\306V\317\377\036#"
+	.ascii	"\fs\250\202\305\200\fd\271d\374\017\234\\e\374\216l\024\255\177"
+	.ascii	"\320\\\002U\324*WX\016\024\320B\327\2049\371\326'a\203\313\r"
+	.ascii	"/\366\001\204f\272,r\330H\306\004\f[\316\241\366\324\273\363"
+	.ascii	"\027\003\363N\013\301|\246\300\260p\035\020\224\264\322(\200"
+	.ascii	"\030}\\fV'\245\347\271\342\3476\200\343\213\357}*\335\204\212"
+	.ascii	"{Q\235I\370'IK\324kC\3460\245\227-qT\n\335\0220\223\022\344\374"
+	.ascii	"\364M\205\243fp"
+	.string	"\017\224\210O\r\316\326\017\016\300\035$@\223\217A^\324%\271\023te\213\212\342$\002\360\336\361\356\fW\232\001\002\355\004oH\300\300\026\364H\006\201\244\n\213\037P\307sF\253TU0G\323.\316\371\004\331\034\256c\022\b\016\207\"\223`\bU\276\355\245\022\213\006\022\t`\212|\217\3211\371Q%\341\334\2274\204\304p\r\322\310\257\325\354l^\222\301h\320\230\030\343\206o#\321\177\377\237\351\223\017\001\"\251!\2368\240\274\357Rd\355\205\356%\f|dd\244H\371\245\027\343b\224d`\323\251\335\303*\370\2545\f^\314\326\273Y/\252\364\300&\335=D\221Q\312F9\032\020\006J<Yb(\"\202\271\315\005A\021D>Z\361\017\262'\376In8\005\342\223\225AY\316\362d*\371\227\200\016*\375\310a\300\025c\027\254o\031!\322\320s\360\237xv\\\307w\033\233>\234\221\274_\224\371\177"
+	.ascii	"\314\272\316\372\265\214\275{w\251N\321\324\022\263;\215IM`\030"
+	.ascii	"\343\022c1pw\274\201.\"\265\b6[\\r\2142\215\250\231\020\345\235"
+	.ascii	"\3708V\304\327\031v\226.4\007\331\347\361\r0{\206\375\313\231"
+	.ascii	"Q\"\331\177\212\023\330\\\\\007Y&^$a\271\377'\215'/\037\216{"
+	.ascii	"\333\274/&\214\230\031\025g\230\355)\034\342H\227w|\0068~\357"
+	.ascii	"\371|T\3444%\323\235a\247\367\336\360\314\217L\251#F+\306\260"
+	.ascii	"v\327\256\035\347\376\n\025J\243\312\251\"\321\221\307\223\362"
+	.ascii	"*kq<Z\216\267\021\005|\252\346\302\343/5\315nb\333\r\322\233"
+	.ascii	"6q\340:\217\302\213\322\213\243\307\301\003\301\334\276w\377"
+	.ascii	"\335f\311S\302\026\177?\200\033\214\275\341\337C\333\306\365"
+	.ascii	"C\370\264\333+c\314}\2347\331F\231\027\177z\336\251{1\311l?^"
+	.ascii	"7\23727`Xk\035\360k \274\206\237\200\336*\347\206\357\356\316"
+	.ascii	" \354\332\310\330{\255:\327\371\324\335\223\301Ms\365#\231_A"
+	.ascii	"\256-\276\370q\223\330\260\370\t\311\351\212u\t\304\363\270+"
+	.ascii	"\361\333\343#~\244=\241\212c\241\241}i\365kP\320\n"
+	.text
+	.section	.gnu.lto_.symtab.1447ac0332487357,"e",@progbits
+	.string	"currentMeterVirtualState"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\001"
+	.string	""
+	.string	"currentMeterReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\001"
+	.string	""
+	.string	"currentMeterADCInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\001"
+	.string	""
+	.string	"currentMeterADCState"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\001"
+	.string	""
+	.string	"currentMeterADCRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\001"
+	.string	""
+	.string	"currentSensorADCConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\001"
+	.string	""
+	.string	"currentMeterADCRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"currentMeterVirtualInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\001"
+	.string	""
+	.string	"currentMeterVirtualRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\001"
+	.string	""
+	.string	"currentSensorVirtualConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\001"
+	.string	""
+	.string	"currentMeterVirtualRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\001"
+	.string	""
+	.string	"currentMeterRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\001"
+	.string	""
+	.string	"currentSensorVirtualConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.string	"currentSensorVirtualConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\001"
+	.string	""
+	.string	"pgResetTemplate_currentSensorADCConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\001"
+	.string	""
+	.string	"currentSensorADCConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\001"
+	.string	""
+	.string	"currentSensorADCConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.string	"supportedCurrentMeterCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\001"
+	.string	""
+	.string	"currentMeterIds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\001"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\001"
+	.string	""
+	.string	"adcGetChannel"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1447ac0332487357,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
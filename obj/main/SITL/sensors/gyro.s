@@ -0,0 +1,1695 @@
+	.file	"gyro.c"
+	.section	.gnu.lto_.profile.a5bf0a8a39e58656,"e",@progbits
+	.string	"(\265/\375 \020\201"
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\007"
+	.string	""
+	.string	""
+	.string	"\027"
+	.string	"\036"
+	.string	" "
+	.text
+	.section	.gnu.lto_.icf.a5bf0a8a39e58656,"e",@progbits
+	.string	"(\265/\375`c\001\215\f"
+	.string	"\364\021W\002"
+	.string	"\037"
+	.string	"\301\253\327\240\001\004\002"
+	.string	"\002\001\002\002\002\003\002\247\271\241\257\013&\002\004\002\005\002\006\002\007\002\b\002\t\n\n\002\013\004\f\002\f\004\002\t\003\240\342\234\212\n\006\352\263\360\321\b\007\207\367\223\361\n\026\r\002\t\016\002\t\017\007\b\230\342\247\336\017"
+	.string	"\t\n\215\227\255\355\016"
+	.string	"\013\244\232\260\377\t"
+	.string	"\f\320\270\337\253\r\026\002\002\020\006\002\007\016\022\231\360\226\364\013\b\006\002\007\023\267\333\331\374\n\024\371\273\225\274\003\004\026\343\276\225\266\002\n\004\027\360\325\274\224\003\024\002\f\002\020\002\002\002\t\002\021\002\t\002"
+	.string	"\002\020\002"
+	.string	"\002\t\030\314\273\261\266\b"
+	.string	"\031\202\335\331\235\013"
+	.string	"\032\210\217\311\240\001\002\002\004\002\022\033\357\374\365\310\013\023\034\342\263\346\345\n\b\004\002\023\035\346\313\275\213\001\004\036\340\224\272\374\f\"\002\024\002\t\002\f\022\n"
+	.string	"\020\002\r\002\007\037 \204\347\236\272\006\002\002\025\002\023!\216\365\211\237\b\023\"\330\251\351\345\004\004\023#\273\364\245\224\t$\230\201\323\205\017%&\240\342\234\212\n"
+	.string	"2 `\002b\352\270\003]\b\365\232<\247\330\215\330\270\207\364\216\213_dN6\2165\331\024\253\227{\233\005k\346m\243\300"
+	.string	"U\232\333\266\n\324g8v\302<R\304\021\246\204Q\347\b\fpW\243\240\321|\360>L\026\372\013\274e"
+	.string	"\016\260\357X\222vg\302\2158\2546\240\203\222\326\0262\343"
+	.ascii	"\223\004\310{\330\303\026\036\013vw\367\364+\312\020"
+	.text
+	.section	.gnu.lto_.ipa_sra.a5bf0a8a39e58656,"e",@progbits
+	.string	"(\265/\375`\247"
+	.string	"M\005"
+	.ascii	"\022\307\023\030\220\315r\177\353\376\377\377\377_\300\351\351"
+	.ascii	"i\364\202\033\375\354\267-eJ\001J\375m\231\025\312D2#C\346c\001"
+	.ascii	"\031\2260\215\024z\307nc\345dl1x.k;\032\\\241\237\030B\017x\207"
+	.ascii	"\3353\013\2230\005r\226\324\346\362;\027\236\t( \200\002\262"
+	.ascii	"\272:\344 0N\026<\226\327\334BB\035=\344yX\203\242v\245\032\036"
+	.ascii	"F\222\016\337\023P \007\366ov\205@1`\001\312G\344\200\004.(H"
+	.ascii	"F|\324\275\021H!`\022\030t\034\227\001{l\254\345<+\352\335\251"
+	.ascii	"\343\026T\\?%\370\342B\r\001"
+	.text
+	.section	.gnu.lto_.inline.a5bf0a8a39e58656,"e",@progbits
+	.string	"(\265/\375`^\005\225\026"
+	.string	"\026\037kF\360\260(\215\001\260\31645\2317l ,\275 \304\260Z\036nu?\002fb>/$0\236\002\2235\007\2258U\221\257\326\376\267"
+	.string	"\236w ,RCp\334d\261Q\336e\274\272\324\306\037\325P\311\223\266\245\334)V"
+	.string	"S"
+	.string	"]"
+	.ascii	",\025\3213B\307\350h:\216\344\246[\251b'\207K\204\351\356\320"
+	.ascii	"\3019"
+	.string	"=\211\262\234\340)Qa\373Q\t\341\303\026\020\225%p\302\206J\023\250\353\205\234\361B;\271\346\274\373H\372\360\037e\236\256\224\331\335\320\2732\307\006\n\207P>\214e\314\3127Cz\324\033\205q\b F\3568\222\254\331\366\322\026ZK\016\204\271\243\027zX\342\330]P\256\262\354\320B{y0i\344\361o\237aw\275w\345\356\256\316\2356x\326v=\322\313\264v\343\263\323 _1\244\027\003g\203\203C\243\273/a<\243\205\374\200\222\262\002\217\307\372\307+W\005S\022\247\024\3064\305 \246\330}\245\355\356\2531Cc\205\210\206\345\306\213\225(\341\320\004\316,E\301\250\324Wz\310\224\300\037\303\324fwE$\351\262\353\235\036 `\325\f\364\260\264\335J\032\b\024\036\270\217\251\006\030\025\032\021\005I\230?7>\265\325\247\273O5\353>=\337}\020\246\177\210&P\004\232\247\300\250\310\030-\262\n"
+	.ascii	"b%|%\013\233\036\332I\005\006\r\317\002Q\004]\225\360\034\312"
+	.ascii	"Rg\347\247\206\301\007H/"
+	.string	"O\264\001n\256\245\265\335\023n\323.\225\211\331\365\270TB\0270\225&K\330RY\262\206\330\365J\027\310CTY\320$\023\200\202\250\021E\211\246\204\202&%Ia8P\"2Cw\036\022\340EA\306$B\210hF\224SZ\317\322f`%\002EL\343\312\216\324\262\321\232\206\2307\340\222d\007\361\301\3308\332\350\371\266\343\315X!\200\324/\016\346\2240\245\374V\034\2063\212\261\n|_*\240g\236\365\244\235\344\204\273\374\006d9\003\023\214\227\277\357H\243\225\n\262d\017L\252\306\230\026x\237u\357\265\004\262\270\327\316\341\227\340\275\343\230\220\266e-\013.\356Pdq(\251f\247Q\n\345!\035\267\364\261\263Qp\247\177\356\351;^\343\\\330K\265jA{\317\252\225>\255\322\240\377\266A_\370\243\236e\212\b[r\036!0y\305O`v\374\330\327\375\016 Aw\355-\237\334\031\311J\211\027"
+	.string	"\344JE\035\372$\033\204hy"
+	.ascii	"T.\306,\031\027\254\336Wp\241@\023M\016\372\352P\216a\227\363"
+	.ascii	"\241\222x\343\363\2163\206\034\036\255\352\220@\020\001\222."
+	.ascii	"\305Ie\017\227\304\300J\240P\253QL\255\352\330\237\356\303lE"
+	.ascii	"\005x"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a5bf0a8a39e58656,"e",@progbits
+	.string	"(\265/\375`u\004M\016"
+	.string	"V\023=4@\305(\035s\356\3361\224q`4fA-\361\032\206aX\270\265\b\244\301\017'\3720f'\354\033P-85\332m)\376\331\331pT\324 *\333\226)\245)"
+	.string	"/"
+	.string	"0"
+	.ascii	"\376\260=\314\322$\264Ix\377\231\214#\360\257\004\376\232g\365"
+	.ascii	"\264\330\177\233gW\333do\315.\327\236\300\337\317\263\253)\305"
+	.ascii	"\"h\207\360\276\326\f\201\257l\236\233\007\333\207\251\245\265"
+	.ascii	"\326L\301\360\262O\356\265f\017\332\036\274\335\214\003\255@"
+	.ascii	"[i)\002+\300\005\300\022\265U@\240\037V|~o7\025\275\324k\227"
+	.ascii	"\2424\265\233\214\035Vg\267\rJ\245\236\351L\256\t\276%\036\261"
+	.ascii	"ZL\206ea0\274@\304\0161\2103\r\005m\333w\026Z\320'\257a\222\334"
+	.ascii	"\350\310\224\343\310Svtt\254\375(\364r(\305\242\230\033\253\022"
+	.ascii	"Z\017\007\241\355`\336\263\0178\227\213{\322\340_\004Y\250\001"
+	.ascii	"=\347\220I\005i[\032\003`\202!\206\314\352\022`\201I\006$a\002"
+	.ascii	"\013\"\243\2242SC\241\322\262\313\325\337gg\326\324\031\343\024"
+	.ascii	"\275\027y\271H\034\201-\227\255dm4\375H\204r\247\272\246\265"
+	.ascii	"\310Z\210\tZ\026\325gm\224<\224\246]\376'\022+\205K\001\303\224"
+	.ascii	"AE\362\005s'\003E\300\220m\204b!\030ob\203L\357\320;\031\023"
+	.ascii	"\031\214L\226\t\232i\277n\006T<\321`\003\313A\253\336\005\341"
+	.ascii	"\234\357\203[\266w\345F\303\217\365\203\026h\330\224\303\213"
+	.ascii	"-+\265-w\206\367\207w\233\003:|\3225S<\307:\200\2308z\366:M\244"
+	.ascii	"F\"\223\260\231r#e\340\033\303\f\336J\201\240\216\374X,\242\b"
+	.ascii	"\264\032l\3633E\025&"
+	.text
+	.section	.gnu.lto_.pureconst.a5bf0a8a39e58656,"e",@progbits
+	.string	"(\265/\375 J\005\002"
+	.string	"\242\004\017\026\220Mc\270\030B33\263\310]\204\301\351i_\031jT\tY2#5N\247tF\027\032\237\323\031\233-\346\\N\345\2623\271\310=\256q\213\033q\033n\302Wp\201{\354\356\252"
+	.text
+	.section	.gnu.lto_.ipa_modref.a5bf0a8a39e58656,"e",@progbits
+	.string	"(\265/\375`\331\001E\n"
+	.string	"\202M*/pi\222\016\344\022z\210\250\322\205D@=U\225\211\252t\225\256*\215x{\240\332#lk\255D\350\243\337\246RE\003\035\314\376&k\245L\001?@Dd\330_q\034\023(\204L;`VE1o\rr\251\212\201\330EU\322\306\2242\f.\370)\225S;'\037\221 *\307\260\243\344\351\261\244/}<\034\315\234S\271\245\214\035:\360G\233\315\305\005\274\005\t0\357\273\342\032\372}\021\213\201OK\347\344\237J\371B\373\216\237T\271B!\b\222\372\325\032\232\253=\326\274W\355\224\366\371\216\304\355\255A\216\013\354|'\002N\2501Mgn\210\223\215\335\200\002\031#+\017\021@Ej\214JA\262\307\032cr\344\265\237%\035\007%T\304\"\242,\330\206"
+	.ascii	"\237E\254\203'\341\236\241\350KN\335\373\005r\350/\220?\341\245"
+	.ascii	"\267&`B_-\271{9\\\360\370\320Y\002\f\260]@\f\237\r\307y\r\n\202"
+	.ascii	"H\221\213\270a\310$~e]}b\220+gl\205g\030-\030\201\362I\003&\206"
+	.ascii	"\244\021FhFa\bp\322\207\252\202\255\227\"p\025'{\315\370\330"
+	.ascii	"\356=]If\200\224\334i\354T'\fFI\001"
+	.text
+	.section	.gnu.lto_.lto.a5bf0a8a39e58656,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gyroConfig_Registry.35.a5bf0a8a39e58656,"e",@progbits
+	.string	"(\265/\375 \225U\004"
+	.string	"\304\007a"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\206\200\200\374\342\303\306\342\021\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\325\006us\356\005uq"
+	.string	"\005\001\006'\001\030\212 ?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/sensors/gyro.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_gyroConfig.37.a5bf0a8a39e58656,"e",@progbits
+	.string	"(\265/\375 \220\335\003"
+	.string	"\004\006\203"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006'\001\364\003\005\001\006\035\001\344\035\001''\001\310\001\254\002\220\177\035\001\332\035\001\0040\005\001\006}\001"
+	.string	"?\202\210\200\370\001{y\306\001w\305\001u\304\001s\275\001q\275\001o\303\001m\302\001k\275\001i\301\001g\300\001e\277\001c\276\001a\275\001_\274\001]\273\001"
+	.string	"\n"
+	.ascii	")2@LQwL\031Si\255(\2210\207\245D\0333\374\001\024\001"
+	.text
+	.section	.gnu.lto_gyroSensorBus.38.a5bf0a8a39e58656,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"E\007"
+	.string	"\322\21525`O\322\001\304\0251\004\350\321\f\307\234\234F&]}"
+	.string	"\247\273Ig\216\326\220\266\355@cCh\337\214$ I\302\360\n\315\026\240\017\2044\325\321 \233\354\235R\266\252(;\021p\31289\327\204\034\t\210\r\264\344\204\325\201\343\304%aE\214\022Ru\277\262\031\310vC\247v\274\n\205\202\347S,\020\262\335u\370\363Q^/|\220?w<\355\364\317\367L\177\t!\207aWPs\035\366\245u\034v\023\230\201ip\331\335\250\241\331\227\327\022b\373cS~\311M>\306\fj6\2422H4Xdv+t}\301\364\027p\202\351\317y\034{\303\374\237\\\032\371\210\241\"\320\033\300\303\356\272Q\321\350v\267\275`\233\301\266H\n"
+	.ascii	"2\003\302\360\030a\315!,\307$\3055\261\032!\264\020\231\270+"
+	.ascii	"\246v\222\001"
+	.text
+	.section	.gnu.lto_gyroMpuConfiguration.39.a5bf0a8a39e58656,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"E\007"
+	.string	"\322\21525Po\322\001 ;\313\035\341/\016\037q\277\021\n-\023\302\304\335-[\016kQ\353\335\bm\b\267+\266833\3511\\Y\261b\\\301\300\233\217\310&{\247\024\276\254(7\017p\31285\230\t5\020\016\031x\311\t\255\002\307\b\214\204\0231JH\325}I\246\312v?\247v<\211\004\202\347G(\f\262\335e\370\363G\257\025\276\350\317\033N;\375\3639\323\337\301\307Y\330\325\323\334\206}i\235\206\335\250\214\225\205\223]\214\027\227Uy)\035\266;6\345\203<\244c\214\240f\241\212eta\322\262[\241\353\007\246\277\200\013L\177\216\343\330\033\346_\344\322\207\b\205\202<o"
+	.string	"\r\273\353FA\241\333\335v\202m\005\333\036\001\n"
+	.ascii	"2\003\302\360\030a\315!,\307$\3055\261\032!\264\020\231\270+"
+	.ascii	"\246v\222\001"
+	.text
+	.section	.gnu.lto_gyroMpuDetectionResult.40.a5bf0a8a39e58656,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"E\007"
+	.string	"\322\21525`O\322\001T"
+	.string	"\006.5\024\006E\n\332\006\276`\374W0\336M\352\034\255!m\333\201\306\206\320\276\031I@\222\204\341\025\032,J\037!\253\212\307A6\331;\245\266\252(7\021p\31285\327\204\032\t\210\f\264\344\204\325\201\343\304%aE\214\022Ru\177\222\021\310v?\247v\274\t\205\202\347K,\020\262\335u\370\363I^/\374\321\2377\234v\372\347s\246\277\204\217\303\260\253\2479\221}i\035\207\335\250\r\226\206\226]\215\030\230]y*\036\266;6\345\207\\\244c\314\240f\241\001QJ\006\312\313n\205\256/\230\376\002N0\375\271\216co\230\377\221K #\027\n\362\274\001<\354\256\033\005\205nw\333\013\266\031l\177\004\n"
+	.ascii	"2\003\302\360\030a\315!,\307$\3055\261\032!\264\020\231\270+"
+	.ascii	"\246v\222\001"
+	.text
+	.section	.gnu.lto_gyroDetect.41.a5bf0a8a39e58656,"e",@progbits
+	.string	"(\265/\375`6\001\205\016"
+	.string	"V\234eF"
+	.string	"\223\223\016\263#\362}\371R/\332\316\202*\r\035\003\026\\\265c=\032\t\004\013\b\375\331\314\242WY\374\r\351\007~,\203s~\300\217\244\325]\372O\367S]*D\021\274LF53\356\312\240$\357\275\367N)P"
+	.string	"O"
+	.string	"T"
+	.string	"\0161\333\276\211\257L\366f\250\002?040\270rv\303\f\301\t\324\323\371\001\365T\306\334\373\224\321\363\337\372\234\251\301\361\201\247\317\016\227s\001\215\316*\004\242\246"
+	.ascii	"\022\027R\274\365\350\002\266\304\b\340\301\356:~\340\206\233"
+	.ascii	"\336v"
+	.string	"\004\333\016\354\307\004+\034\226\270c\207\247(a\354\317\225)\373\254\333\363\360\2372\372\001\036\342\225\223C4c7\303\216\217}\321\030#\316\372m\223\337\362\307gy\330I\003F\343\262\271\331\r\025\234Z\204\305h\377\304Q\230\036\256\034d7e\003c7\0249\001v\032\257\320\017T\333!w\241\031P\355n\003\237\305[\220\270\304$\3763\251\247\237\251Y\361\351\360\r\225\214\b\251R/\271\226\rT\324\261'Nio\025\342\277\313\322\313\213\307\rJ\236\354\227\252\335]E\t\333]\006\276\013%\005\244\2229\365W\352i\210\007\034\020\001\0327J\031\341F\020@(\332\2104Id\343TH\262\216\333\272\023\255\313NJF\0232\022\327e\"\005\274Q\320\270\314\302\266q\331'\334\317\225)\277\306\313\017\031\272W_\342\303\213\350{\325#]l{d\210C\217\027\213l\231 \361\227P\355\021)\3763H\306\216\025"
+	.ascii	"|E\331X<>-\220\236\255\300E\007\326X\230\r\362@\350@EF\200[\333"
+	.ascii	"Aac\233k\270\330\026%iasB1\237:\007\355\002R\002\255\272iJ\241"
+	.ascii	"\240"
+	.text
+	.section	.gnu.lto_gyroInitSensor.42.a5bf0a8a39e58656,"e",@progbits
+	.string	"(\265/\375`\036\004\215\032"
+	.string	"\226/\250G\240\\M:\214cZP\257o\206\177^\336z\215"
+	.string	"g\253#U\220\227\027x\376\323\366\026\375\242\0262\n\314V\317\2112}\217\033\026\020\322\300%\216\202\351\376x\335\201(\263\240^p\344H\270\006\223n\204\354M\244\224)\224"
+	.string	"\207"
+	.string	"\232"
+	.string	"\267\262\342\\xA\263\344`\347%\204;c\037\363\277K\313$\264\272\030+\240\326\")\250Z\313\007g\020\356|\271;tg\2700\272\363\377#L\020\372\270\345\021\016\320\006\r\242)lj-e]d\307\rA:\277\346\361;\264\341\367\004\314\325R\233!:~,\350ci\016\216h\006\317\335-\002\036\274\035\257\n\216\307~\"N\306\027\273\201\273q\177\rr_v\344\340l\337N\025\221\253\335\355\201&9~0\203<\265\3263\211\323\261w\355\377\035\377y\376\257BI\242\354\254n\274u"
+	.string	"\274\375\373\374\360\222\260\216\335z\350_'\030\n\310?\305RQ\021\326Z)L)\261\242\002\031$;\2771\350\316\355\335-\2035\\l\274*=j\334\373K\033\267\321\277_\355\242\037\344\353l\323\036\266\272\335"
+	.string	"\347\277\\|1\344\343P\276\013\344\207\223\017R>\235\374I\371\337\344\367\371\374\361\267\200,)\007\344H\215\346\225\025G\317M\245\232Y\226l\323\356/\364\335]\374\226+Eh\233\202b\001"
+	.string	"\032\213\324\252\242r\265\210\224\245\244\013\373\267\260`.\274\310|\331)\f\0316l\240;\333\n\251E\200\273g\203\315\241\003/\031v\214\250\207N\033\364\260R]h\357\323\327\363\303n\001\021\365\365\362\254t\334\335=E\364FK\210\260\326[\026\356yC\311U\216IW\233m4\322_\304>\215\006\216\276V\366\312\210\2230\301K\232\240;\305(^\222\232\332\036m\241\201\372\346.\240:k$\253*M\230\251^\257\327f\027PX\353\364yF\316\306X\326T\t\3516z\020\205\365\200?\264\036\030(h=\032^\037p\356\003aF\013J!\003\242\315\200Z\374"
+	.string	"\311Z\250\350a!\363\241\001\311 \020\370\314\305\017M\366b6\243\311\304\262\266]tj\006\313\351\t\334\035\351\3566\203\231$\247'^\250}\265\215\377\257>O\255m\241\003\016\320\377xdL\302K\236\271h\241\272\365\020(.\331\254\221\211\001\254\235\315M\365H-:\"Q\261O\354\312\334x\313\311\226\031\221\254\304\236Qg\224\022\360\366q\372b\220\217J\313\033\241\214\301\351\231%\345\352\177dZ1c\224\002a\002M\25014\343\020c\nM\221H\320\202\222&\007\220\242\0313\353\021 =\246\224\325\210\356\031~:\303\302\236\272\360\345T !3!\362"
+	.string	"I!\330\020\263't\207\342#\310\240\022\275|]=\350.\301{\022\031E\211S~\314P\3756\307\215\235\324oN\266\231\017\271\227"
+	.string	"\005\245\227c`7N\220K\304\016\025\300q\001\177\251=6,h\003\231\210\002)\352\257\375\375M\201\253@\225B\315\300\305\0132\270\300\036\317L\357\333\3476\242%\240\320\217\017\336\316v\235"
+	.ascii	"\221\263\236qD\344yf\005\t\322!\272\001\366\362\367\333Oy\350"
+	.ascii	"\253\242\300?"
+	.text
+	.section	.gnu.lto_gyroInit.43.a5bf0a8a39e58656,"e",@progbits
+	.string	"(\265/\375`:"
+	.string	"u\b"
+	.string	"\026\220;8@\305(\035\340\271\320\252\357t\364H\306\204\013Ea\3541\242\310\362\323\274E<m\311tm\324\232\256\273\221\351\357w\030\206\207\371\314\004\024Y\006`?\206\2425\262\267L)*"
+	.string	"+"
+	.string	"+"
+	.string	"\013!\213\316\235H\327XY\244V\273\\|\031\027]E\376=\016;T\252Y\332\256\026\206\335\265\316\322\305\375n\373\3006\202\355.\226\r\222\320Ok\tJW\3616\233\333\364a\330\207\273\273~&\333jhaV'\r#\273\244"
+	.string	""
+	.string	"\266\263H8l\207\354\213\025\002Oq:\327\345\221\372\t\037&\245\243x\233-Jp\233T\022~\3249m\340\264;\372\364?\016\222\371\033\267\034\241\351\347-_\253<\326d$\006\342\304\f\223\331g\223\305O\307\301\0235X\0263\005\226\017\033,BH\211\305\013\267\207\373L\360\031\214\336\204\005\364\250\213\\\001!\001\013"
+	.ascii	"2\241\311\037\330\316\204\nr\006\003!\331\023\204\026\357\302"
+	.ascii	"\267\004#\341\2323\t\363\t"
+	.text
+	.section	.gnu.lto_gyroInitFilterLpf.44.a5bf0a8a39e58656,"e",@progbits
+	.string	"(\265/\375`\247\b\005*"
+	.string	"jH\320\017@P\346M:\253\210\004\003|r\334\272\306\362\265F\334\356\037{-\032\214\327\377\021\331\371\223\317\376h\363h6\3139\235\246i\232\350\247\031\312?\t\217c\302l@\0066bwwk\322\b!r'\031\346"
+	.string	"\341"
+	.string	"\351"
+	.string	"bz\367\336\023\351\317~\033\007\377\346p\324\263\005I\271\276\322\267&J\364\356UJ\375\344\f\351\317\242i\231#PP\257,\302}\257\230\244\t\267\314W{\033\365kF\016\340^.v\356\334\253\234\342\006\351OV\236"
+	.string	"\3723\275"
+	.string	"\364'\263\312\274\350J\263\373\267=\2576H\367\336\252\3662\004r\337T\236}\246z\342P\030\004\376R\037z\232mU\276oC\002DyI0\256\023\261\330a\226\013\343>5\006\215,,\313\203\b\314|U\261@\004]\302\254\374\007\367)-hdaV\236\232L\020\336\220\326\2076\345\250o\303\333\3155wk\022l\312O \030\222\223}QA\t\234\311\201a\004d_W\332\f\202u\331&\364%f\026\357\275o\273]\002v\264\326\267\341\336\3136\t\026v^:\363_0\363\013f\337\241G\340"
+	.ascii	"rj\333\335\346\265g\264\353\337]\306EP\247n:C\006\316\262\313"
+	.ascii	"J\3427\324\233\261\267@\233\332\332!\327\034y\305\367\264\220"
+	.ascii	"\373\234\013\206\021\303>\031\243\227\346\330\"\255\315\250\361"
+	.ascii	"\300\354^\343\223\314V\317s\225\336{+\360\361\244\300\261t\027"
+	.ascii	"\306\b\372\363X\356\334\222R\214veV\036m\2271\277\327u]\271\271"
+	.ascii	"0/\210\272\333\271\b\205Z~\272\362w:\333\271\351k\177\201\333"
+	.ascii	"93\275\016\2353\261-\017\333\262\020\265\034\fZ\006\266\345\037"
+	.ascii	"\320r\372\263\354\373YFQ\313gj\331\364Yn\324\262E-\237\301\223"
+	.ascii	"\244A3\326{\237\254\224n\335\231\207\314\355\374u~:\277\333\317"
+	.ascii	"\0267\006\256\330\305t\273\304h)3\207\377F\207\345\340\236\260"
+	.ascii	"H\037\207/\207\203?\335\200\244\\_\005\234\210\t}(x\217\220z"
+	.ascii	"*\031\025\315\021^^\335\231\370I\253K\273\214\203K\024\252\317"
+	.ascii	"\345)ub/\231:\261m\232\237\311\235\361\361=8\261\241\372jw+R"
+	.ascii	"\354hWV`\317F\333lf\025\215\252\306>\311Eds\261S\243}\244\236"
+	.ascii	"\261\021\243\263O)u\"\255\231\255\307\212\250\230\325\264\347"
+	.ascii	"\251"
+	.string	"l\016\240vIFW\224e\301\354\336\3136\236Hms\273\273{\357\005\325\315\021q\270\036\263\016_~\370y6\263\377\366\223\016\317\255\215h\210\021o;d\340jw\217^\350\227s;\306e+9\220;\233;\273\314\020\337\356M\312\334;\210O\350\007\320\237X\0041\363\242\364^\256\213\261M\336&a\312\334\261\333@\302X\227\335cf\022\007T\"\275\267\253\002\377\317\351N\240Pa\237T\201\376\354\366\315\305I[\273\367^\263\251m\007[XBj\230?<\240?\266\260\200\370\030bb\210\025\217+ >\256\264@\f \"\342F\017\035\247\n [Qei\r\301Q\265\245\225\265\305\343j\253\212\007V\215\035UVZ[UTO\234\325\343J\253\352GV\226VUPi\274y\233K\333S?\223\352\214}d\223(\\\320\3472(u&\246!S/\350\253-\037U\260\302\03660\212:e\330\177ja"
+	.string	"8\257\275^\3273@\203\375\324l\275\250\034\355\023\353$\330\030\342\320\245\255\001\233\211]b\225`\311\260I\324*7t\305z\251Y,\022\330\217[\205]\246E\335b\217\313@}\202\277\250>\227\251\324\227\226\200K\035\325W\303\243\262\305\376uZ\246z\371u\212e\234\327^J\303\336\265R\016\032\247\244~\001\363I\252\030Ii\037\356'\335\362\327eqG^\311\033\273\314\032\326\325O\327\275\306(_\027\273\341\220f\216\355\013\200\247\250A8\307\030C\212FF\024\264 I\261\030\320\002\221)Z7\02101D\212\020\315H\n\n\nZ\237\003Q Iq\202\201-\025\211\357e8G\262\321\024\357\364d\323\251a\356\327\200\221\244\272HH\342\332CY@\363K'\215K\202\275EN\211\317\t06\301J\351W\314\314~\317\324"
+	.string	"\326\227GM\206\277\210T\370\336f7\372le\351\020m\200\243\177\r%\374\201\270C\223\325\007\005Q\243K"
+	.string	"r{\b\327^\257xcr\261\\'\240\313M\037\352 \232\031r\260\246@\203\244\361\323\3242J\266\223g\304\203l\017\225L\2324\346\261\240\001\222wx\364R\211X\340\341M\033\177\013|\343\273]\323\362z`\312\225\223:t\002_\262\350LD_\335\031\001"
+	.ascii	"\206\346\327@\307\372\370;\307.9\r\266%\331\035\357\355\027\341"
+	.ascii	"\356\333l\217H\221P\325\026q\213G\231x\361S\253\335\246\240\236"
+	.ascii	"\245\022\346\013\0352\021h`\b\333}\361\302Ag\034\220;\006S\020"
+	.ascii	"\327\330\213UE]1U\234\007R\335\206\337\212'T\003\260$\263\252"
+	.ascii	"\007n4\220s\335_h%\254\306\362\344\022[\236\273\021\314\330\""
+	.ascii	"\302M\320\204\330\b.5"
+	.text
+	.section	.gnu.lto_gyroInitFilterNotch1.46.a5bf0a8a39e58656,"e",@progbits
+	.string	"(\265/\375`\006\005%!"
+	.string	"\206\274\322G\200ZN:[\212*\026q\241!\371\367o\363\354\036\fo\340|<O\306\257q\313\216\306\251\226\321\371\306\242M\246\004\375Y\n\013g\210Y\016\331\226\0020\247\224\fB'g\017\247\364\250\337\327kc\310\022B\310\226;\311\272"
+	.string	"\265"
+	.string	"\304"
+	.ascii	"J\0067\371Cz3\310~g\307<\205\251\362\256\223\021\253B+\257E\374"
+	.ascii	"\026\023\233\367\016\221\213\220\336\344\325W\346Cy\024\342\263"
+	.ascii	"v\\\300\275VhY\356U:`\005\351MV\276w\336L\277s\336d\"\363\362"
+	.ascii	"J\254{\260\264cW\233{\357\257\215p\337*\317i%^\227\242\247i\273"
+	.ascii	"\022\371\350\205\256\037@s\206L\026\257\263<6\251\037\026\202"
+	.ascii	"\331\261\246\006\212LU\035=\223,\323\020\231\252\372i\027\300"
+	.ascii	"\215\261\271\331\r\260I\375\260\275(%\310w=U3'\351\343v\227t"
+	.ascii	"\252\035 \311\303\006\335{/\366\n\2254\326\212^\270\367rE&\247"
+	.ascii	"\3169gf-f\216\301l\305\002\346\201\234\231CR5\3259f\245\261\366"
+	.ascii	"\025\363\333\b\227\325\203\333\212\331\367\2573PZ\371'\255\354"
+	.ascii	"\363\260sOZ\231\247\367\261\363\316\267~\336\247\374:\317\372"
+	.ascii	"\001\274\354\254\313\251\234\352*\243i\345\263+\233he\213Vn\264"
+	.ascii	"r\355\312'\340S\003\206F\334\275Qsp\356\232I\266\344a\377\327"
+	.ascii	"_\366\217\3352\237\371Z\370f\274+c3/\260\245QJ6&L\213R<PI\316"
+	.ascii	"\300\335{\205R,\017\343\213\361\316\2138<\025>X\263Q\323\346"
+	.ascii	"\346\227\275X\030\300\322\206\337"
+	.string	"b\032\221\006\001\223\0027\344{\361\356&\277\312\255\f\177\345FZ\224J\261\364\270\002wo\354k\263u,\321\2308a\201\255w\262\233L\226mH\252\333W|4*\026H\347\004m\331W;\333\312k_C\361\223N\333-\270\312t\327\266]\327\034\253\324\256\323\3356\316\261\314x\246\323\327\265\337uK\266T;\226\031\315\236\006j\025om\274\006'\212\313\376tO\007\271\276\350\364O\333xS;\312]\253\215\220\247\356+\366\351\236n\301\345\305\251\276a^\373t\211\267\263\243\034O\027\330\032\362\024gOW1OO\214u\216\037\306(\236\226\242\313\275\254`\026B\365H\241\363&O_\354\277-a\334d\351\364\333\302R\354(7D\224\300\355\336\246#\231\213\316\345Ez\357\225\300?sq\244\343\206d\307\371\302#\034C\226\304\251$<\032&-\205X\"B*\032&\025\0057\f\310\321\301\310\b\2504\314"
+	.string	" G\007\030DJ@$\324D\016\023="
+	.string	"\006\227^\374\204A\240\020\251H\370C:\032\242\361#\n\n\177\017\200\030X\243(\370S\002\002\203\277\235\262\351m\325\365\264\313\232\265\2466\352\372\212wG\320^\233GN\006\3275\224\203\353\272\026\271\275\367\336\264\301u\335\3537Y\306=\005\t\252?\206s\247\317F;m\346\f\032\352\221loU\027\231oFF"
+	.string	"\236\3612\034&\270\335{)x8\031\0207\033\244}$\225\257\321\376\023\\\023\243x\333\230\263ov\004[\342\272\357\275E\264\257\352\333lf\021$\352\221;\035\304\243\213\001c\250Q<\304\bC\204\261\021\021\t\024\244I\213\001p\002\241\2513\017\020`G3M\322\034\215\b\321\3367\347\003{\224\230\374v\231\343\215\246(\313JB\b\234\211=\335\233\242\037"
+	.ascii	"H!k\321Qk\270\2628R/\216\345\326r\036\325\037a\0043\325\207i"
+	.ascii	"\236\r].\"\261\317\237\207\016\220\343\255\275\362t \326\205"
+	.ascii	"\3660 S\360\027\022,\360\230\313\255i\017\331\235\341\177Lr<"
+	.ascii	"\006\350\266\264\273D\326\2039c)btd\227z\366\241@\272\314\\("
+	.ascii	":a\b\340\030G\236\307C\"\220\264\\6\303\301\246$F\b\036vCq\216"
+	.ascii	"5`\302'_\310<~v\001\327[2\330l\354=\3354\256\006TtC\240\350\364"
+	.ascii	"\312\3772\306\224\006Y\317\023\225VU\357o+\250\001"
+	.text
+	.section	.gnu.lto_gyroInitFilterNotch2.47.a5bf0a8a39e58656,"e",@progbits
+	.string	"(\265/\375`\006\005U!"
+	.string	"\326|\324I\200\030R:g\222\020}\017E\035R\324S\030<C\203\026\236\022p\005\330\177\n\177\263\344\023S\341\375\"\016k\335\276\376\f]W\223\242\266e\022Q\266\001\020\216\304\336\356#\232\317\231F<DY\025\243\305F\b!D\356$\003\274"
+	.string	"\266"
+	.string	"\307"
+	.ascii	"\367*\031\034\345\017\353\321\240\363:;f/&\313\273MF\254\n\255"
+	.ascii	"\374\326\360\\L\214\336;D.\302z\224go\231\037\345R\206\327\332"
+	.ascii	"q\001\367Z\251a\271W\351\200\025\254GY\371^zt\275Nz\224\207\314"
+	.ascii	"g\256\304\272\037\213;~5\357\275\2766\302\375Sy^\355\360\272"
+	.ascii	"UM\321\263\355\220\257^\370\372\2016Kd\222x\335\311k\223\372"
+	.ascii	"qB@;\332\325@\221\251\252\253i\026T\032\"SUO\317\005\314\262"
+	.ascii	"5G\273\2016\251\037g/*\t\362_N\026\305I\372\370\271K6\331\016"
+	.ascii	"\220\344q\006\335{\277\274}J\032\255U/\334{\331\"\223Sg\2343"
+	.ascii	"\363\0263\307`>\227\001Hv\244G\017\004\r\033$U\321\3161+\215"
+	.ascii	"\266\257\230\337F\246\026\024\267\0253\320\305\316?\253e\237"
+	.ascii	"\325r\317\311\316<\253\345\235\336\313\316:\347\372y\367\372"
+	.ascii	"s\256\365\003\370\331Y\207cy\325YVW\313i[FU\313\247j\271U\313"
+	.ascii	"\266-\237@\001%`~h\356\215\232\213\273l\250Y\326\311~\261\377"
+	.ascii	"\354/\373\311|\346g\341\243\361\356\214\321\302\226PF\253YYp"
+	.ascii	"%J\355<e\365`\336{\205\326+'\343/y\0276\024\236\n\177\254\331"
+	.ascii	"x99*v^,\fcq\302s1\215X\203\214Ma\n\371a\274;\312\007{\025\341"
+	.ascii	"\255\334X\211R\353\025(+\314:\035\304\243\211\f\324h\353h\272"
+	.ascii	"\2318a\241\255w\263\243J\232kH\252\333W|5*\347\217\256\211\332"
+	.ascii	"\231\376\332\371\264\274\006\352'~Rzv\213\2562\335\266\317\266"
+	.ascii	"j\216Uk\317\351\356\363\315\361\314x\246\024\250m\377\353\247"
+	.ascii	"Y3\355xfDy\372\247U\300\2711[\\T\327\351\323<\r\354\372\222\323"
+	.ascii	">m\003n\355(\367\255\246\020\247\356+\356i\236n\321\325\245\311"
+	.ascii	"\272a^\367t\t\270\264\243\334N\027\340\032\362\024)O[1NP\214"
+	.ascii	"v\216O\306(\356%\005\227wY\301,\204\354\221B\351\321\235\376"
+	.ascii	"\362>-a\332h\345\364\333B\023\354(7D\224\340\355\336\342\221"
+	.ascii	"\314E\337\362b\275\367J\340"
+	.string	"\247\2718\312y\013\301#\034C'\211T)x$LZ\n\261D\204T$L*\002n\030\220\243\203\221\321OI\230\001@\216\0160\210\224~H\252\t\034&z\360\003.\275\360\005\201\277 RQ\320\207t4D\303G\004\f\372\036\374\360\257F\021\320\247\364\373\001};e\361m\365\365\365\313\022\266b\033u}\305\273#j\257\321#)\203\353\372\311\301um\213\374\274\367\336\265\301u\335\3533i\242q\n\022d\177\f\251N\247\255\366\332\314\0314\330#\371\274UMd\276\031\031\001x\306\313p\230\360v\357\245\340\341d@\034m\260\366\221T@\255\366\235\230EFq\2671i\037\355\b\322\300\236h\025\355\\\367\275\227\250\366\225}\243\315,\202\204=2c\250a8\304\bC\204\261\021\021\t\024\244I\213\001p\002\241\2513\017\020hG#M\322\034\215\b\221\336'\347\004\373\225\030\374.\231#\217\246(\313J:"
+	.string	"\234\351\236\356\235\242\003"
+	.string	"$\220\265\300Q;\204\2638R'\216\245\326\272y4\"\300T_\247yv\264\345\"\032\373\362y\346"
+	.string	"=j\355(O\017\261\236\264\007\002\031\202\277\320`)\217\271\334\232\364\220\325\031\376\307\223cb@nK\271Kh=\304\031\225\"\240#{\326\363\207\342\322evF\2210\210\305\n\3368\362<\035\322\201\245\345\262\331\016\016'1Z\360\260\033\212\363\323\360\016M\276\2009\376\271"
+	.ascii	"..\311.\217\261\361\211\323\210\032d\021\023\201\242\323+\357"
+	.ascii	"\341\024S\026d-/*\345\252\336\337NP\003"
+	.text
+	.section	.gnu.lto_gyroInitFilterDynamicNotch.48.a5bf0a8a39e58656,"e",@progbits
+	.string	"(\265/\375`\027\002]\022"
+	.string	"&cxG\320\224M:$BpD? $\314\211Bv*\273F\021\260\025\324\246\265\205V\253\220\200\272\303\214\347(\332\2662\n\226\006!\276\363\350=5`\177\201\\\215\345w!\027\362\226d\343I\030\334\200\323\247d\220\275\345N)c"
+	.string	"a"
+	.string	"f"
+	.string	"\252\013\331\234\300\256\017\020\243\3350\305\020\266O\207?\240}n7\240}Ze\017y(c\037s\201\002vdw9\215a\275\fo\031U\237R\243\312/ay\335\001\022\037`k\365)\007\354n\200V\216\234\020wZ7Q\322\350\271\236\350\021\226f`\253\347\261\204ew\035\301\226\212[\273m\3176\006;r\b\332\347]KD\300\025\2548\263\303U\324\037\373\337\335\265\372\330\247\017\335\246\013\375\332a\267\312\350\250\3217ap\024\244F\310n\212Y\222E\232<\200\016\373\207\354\343\360\211`\226m+\236-G\f\206\205\355\363\177\371d\207\277\241\372\320\211m\305\203"
+	.string	"\004r\025\331]\224OS\330>\033\310G\3736\036\024\254\223\250\266K\206x\320r[\\f\302\3044?\322\260\222\264\273\0256\274G\207\317\007Qo\017\337\361!v\243\027\243R\361`J\373\274\236\350',\216j\b\261\342LuwWj\223\250:\312s\3134\033FD<h\322\005\256 \244\034]\3311\335\205\244]\326A\233\304u|\333\356\256\370E^\t\001I3>}\233\037\f\315\213l\t\201\232\351d4\027"
+	.string	"F\251t^\r\b\356\363\272O&\365q20/1\034\312\3738\025\005\356F\244<n\246\353<\356\024\356\277\352\363\372\366C\206\304\322\233\251?6)\351IU)\242\\u\307\266S\256z#/%\234\210\344RJ\270\352I\377bi\246\343\272\2113'\210\177\213f\322\253c/r\001\234\335* @\002\203\224\231\035g\021\230\242\310\343Y\020Z7CfiKBj\262\264+P\333\341\002"
+	.string	"*,\204\240x"
+	.ascii	"\020\302\243\021\344\344!\215=\364\234\305\356\265\273\007[\036"
+	.ascii	"\224a\037\220|\274\211b\223a\020\254\001\225\207V\277v\343Al"
+	.ascii	"\244\317\243\334(\006W\344\021\225p/\035\"\264\301\336\336\376"
+	.ascii	"\200\177\312\235\353=\001"
+	.text
+	.section	.gnu.lto_gyroInitSensorFilters.49.a5bf0a8a39e58656,"e",@progbits
+	.string	"(\265/\375`\177\001M\r"
+	.string	"\306\330WA\020\221\232\016;G0\366\220\200\214\200n\310}\343\240\033\271"
+	.string	"\2268x\252\016D9\037\026\377\210\226\320\373_\253j\375Vw\256\336\263\322U5\002zm\365U\350J'\227\357LHD\204\354-eJ\001D"
+	.string	"="
+	.string	"F"
+	.string	"$^\202\373\207\341\037\273\235\032/\273\036\021\033\220\036\355y"
+	.string	"\350Q:"
+	.ascii	"\350\321\234}#de;\004\"l\260\244\310\261\273\226z8\367\344\374"
+	.ascii	"\273|\3628\3353Z\260\273N\217\303\341\326\333.`\373\200\235\003"
+	.ascii	"\002-01\337&glOJj\007\373pw\327\332\261\377\375\225\246)\230"
+	.ascii	"\2364-\301t\244i\b\246\243\246!L\253\2463\323\377\250\\\\p\256"
+	.ascii	"\001fw\303\214\314~\242\214\020\036\266\237\366\003\nA\210\220"
+	.ascii	"A;G\205J\336\202E\324\004\037T\341\365\025\230\nUhF\213\314\210"
+	.ascii	"*S+\265M&\344=\023X\321\316\327T\021\226\035>9\212L\332UQ\340"
+	.ascii	"\233\370\211\n>\210Go(y\357\321G\201\036\257\377\002Z\266i0\022"
+	.ascii	"\312\327H\246]\220`mZ\266i\260\315\322\230\224\234X\227\266Y"
+	.ascii	"#\002\234Q\3004\313B\226i\226\207gs\270\332\261DC\307g\243)\016"
+	.ascii	"I\006$\027\216\217\212v\006II\251\006\223R\016\036\343e\212T"
+	.ascii	"zp\030/\242\030\220\204\001! \020\203\221)\207\003\230G\221\032"
+	.ascii	"/DFc\314\022\rB\320W\334\343\236\333\225\354s\241\013\313\344"
+	.ascii	"\375\025\246\270gk}\261\357\301v\253$\301\304\270\t\305],\215"
+	.ascii	"Qe\310t\367c&\354\020\232u\n\300\345E[\311"
+	.text
+	.section	.gnu.lto_gyroInitFilters.50.a5bf0a8a39e58656,"e",@progbits
+	.string	"(\265/\375 \372\275\006"
+	.string	"2\315/4PO\222\016 [|\035\335\251\2011\354"
+	.string	"\272\245!D\251v\221\226\334\030\314\266=\222\213bD\304\346`\035QU\315\030c,\020Q\263\013\215\267\314m\020\"Sw80N\tO\212P\372x\244\367Q@Xx\235(=N\301\220\301\023_\003\204\361i\260\254\013eT22\220\223\030\323:Rl\312d\202j]\222\2268\334\217F?L\255V\243;a\032=DD\253\365F\005#\233p\325cUs\034_\200\314\314]\350\335@\312\312U\215\223L\213\027\227\314\"\024\220\277\232\251g)\346\221\004!\025\024&-\231\371\\G\2516\352V\244\002\326U\265\005\034d\346\315\272.\272\353o\360o\376\215\007"
+	.ascii	"3\001K8\023\360\370\032\273\f\3622\004\270t\213v>\001"
+	.text
+	.section	.gnu.lto_isGyroSensorCalibrationComplete.51.a5bf0a8a39e58656,"e",@progbits
+	.string	"(\265/\375`L"
+	.string	"\r\t"
+	.string	"f\221?80\221\322\001\200\003\\8),e4\226\030\245uE\225\0373\322\243\351\364\375\372V\277\3170\242]\333\354\361e1\332P\240\003\213\320\354Z\034\224kG\214\022F6\331;\245/"
+	.string	"/"
+	.string	"/"
+	.string	"\266\335\360P\262\351\035\214Up\002\242r\271\331\355$$\271\351\317\344_\345\023\"\256\331\252u\372\003\210\330]\277U+\344\206\267\255`\333\301\366L\217\0022\037\255\273lvY\263\234\215\2112\023\333%\273c\373=\373(O)=F\372\300\356\013\007f\267c\360\002\367\350\356\006\333#w\202\3551\262\224\347[F\036\032\273\236E\203\333\365\200X\341\3308\200\225<\372\244\355\361\320S\023C\275\231\335\235\036\034\261\257\355\356\032\276\254=\366C\370\034tVQH\"\300\240\317\244\035\025\262\322YE\241*E\026\024\027\022D\253\374 xb\204\250\314\230\223\312N\267\267\006\023P0e\177\264\035jp{Q\005\f"
+	.ascii	"X\211\"34\030q\r\307\2622\343b>\306t\325\263\214\313(<\215\207"
+	.ascii	"\352\020\306tM2"
+	.text
+	.section	.gnu.lto_isGyroCalibrationComplete.52.a5bf0a8a39e58656,"e",@progbits
+	.string	"(\265/\375`I"
+	.string	"\355\b"
+	.string	"\226\321?8@\217\322\001x\355\222t!\346-\202\2640\004X%\3659\3423\230\312a,\220U\300\017\365\325\251#\304`\017\272/\243\250\372\350\212\234\304\316\255"
+	.string	"\300\005=2\322\244L)0"
+	.string	","
+	.string	"2"
+	.string	"#{s\202\302\310\244\207+\224@\253\303\204\022\263\033F\r9\351I\362\357\272\303\247\222\235R\030O\200\206\335u\236R\034\267\336\266\201\355\003\333/\001\nb_\263\372a;\255\232NM\200\214\225\272\212e\0275\233\331\026-&b\373>\354\240\350/3\250VHvw\273f\213\354\355\332\355*\246\330\2273\037\264\304O>\005.\240\271\233P\f\254v3\026\302\227x>\353\232-B\371\3235?\264\271\226z\360\b#)/\017\030X\312\231\035~\031\356p\270\356\002\"z\035\347\201<^\004E<|b\247\363\"\207\300\334\204\247\213\025\034\327\305-,\335\252w\375\033\032\255P\006\246\244\237\375\317&Uu\023\n"
+	.ascii	"2\003\3020\r\314i\230Mesi\027\306\023\214\221\202\262\034\256"
+	.ascii	"e\2230\311"
+	.text
+	.section	.gnu.lto_gyroStartCalibration.57.a5bf0a8a39e58656,"e",@progbits
+	.string	"(\265/\375`\371\001\305\021"
+	.string	"\266`tG\340\262(\035R\275P\313EY\305\222\321j3"
+	.string	"\316\236\237#\207K\330\272\301,\326\212\261\027\220$\363\342\323o\365}ax\024tj\025\365\270^\2628a\006\365}"
+	.string	"\372\303c\216<\0306\013X\367\324\032\331\335\344N)\\"
+	.string	"\\"
+	.string	"`"
+	.ascii	"v\351\362%\3331\332\"\n\\\247\265L\027\032\242\325\330\r\023"
+	.ascii	"\030\301\350\322.;\350\341\314\232jvXT\f\355n\247!\356\372\224"
+	.ascii	"\"\215.\237\033!\265\314^\237\034.e\030\242H\006`\266\022\265"
+	.ascii	"4\213\211\n\354\356o\0363\314Vb\344Fv\327\261e\266\341\346n["
+	.ascii	"e\233\304\216\f\002\":\300\342\355qw_\352\326T5\271\b\201\020"
+	.ascii	"\362\301\261\022\177\330a,\252\214}\321j\214=\243I"
+	.string	"3z$\2439\031=O\373\365\321/\t\b\212\371\344\324\270\320\237p5\334\200\254\r\3313\302\366}\024\267\251<\205K\265\027\037`h\273\373\3605;\3458\026y\371\261\331\335\024[%\022N\247\332e\211\227\033\261\037\235\0350\240\243\346HIz\031\tNG*yX\202L\345\200\236\232\234F\0322\023\261x\363m6\371Nj\264\273\013\374\026\327\361|\232KWP\251\346\345\324\333~\340\305c\003s\203\003\2137\253Her~\245`\373\212\263h\3714\376N\342[.\375\223yy5\020\253\317C9\201\023<\013\247\006\251\225\247\002IPX\240W\302\362LF\205|\240J\252c\201\037ke\302\352V\336I\325\241@V\0272\300\337\005\023\260C\371>\260+\205\260k\214KN\204>t\30046U\346\2559\343\264\227\034C<\036\356\256T\375\315\243\007\227\036/\222\276f\007\357A\021\230\251\371\301e@\b"
+	.ascii	"\004\3431\"\004+ `\0021F\271\003c\300\235!\027\013\274kw\314"
+	.ascii	"mh]\204\361\342\244@\273\221B\322\203\315&\033\356\026!\205\321"
+	.ascii	"\223\241jsd\023`q\211\254v\234w\023\300\355\b\036\345\002\343"
+	.ascii	"\020U\210\213S\b\326D\345(v\"\361k\024i\270\217-M\226\240d\261"
+	.ascii	"K\0320aqm\026}\2362o\337\364&\2042"
+	.text
+	.section	.gnu.lto_isFirstArmingGyroCalibrationRunning.58.a5bf0a8a39e58656,"e",@progbits
+	.string	"(\265/\375`\006\001\275\f"
+	.string	"\026\330UB \217\232\016\323\255\030P1\3005Bb\227\033\217O\260\361\331\r\022\240t\007\177\257\027@u-\363\232,1\375\341\"\fU\365\217\210\260R\002\020\020Q\340b\325\026\t\002\007S\034z\345\266\355-eJ\001D"
+	.string	"A"
+	.string	"G"
+	.ascii	"\236\234@A\210\263\177&$\001PL\210\264\304"
+	.string	"\330\375(\335\360\354\021jf~F\203\201\206\316\005\304y\036\001\\8\2348\n\251\032n\203\233\335}\312s\204\373df4v\327\t\342,\334\322m7\260]\300\376\204\252\341\200A\313\221\375}RK\354\303\325\220\355t\214i\b\323\227\264#\261\241\234P\025\337\222\214d,\212\b\323\301\366}\225{ _\261\262\274\264\350D\037\027\3710\031^|x\264A\354\351\361v\210\003)\317\022\025b<.R\334s\347#*\002+<o\334\205C\200\311\356\266\240\345\"\036\370'\217\356\260,\351\336\rxx\021u*+\271\273\036u&]\023F\b\026[\306\330g9\210\314?q\004,\017z\3641\351\361\001\356p\254\353c\203\302.\013\363\2500\312\203\303A\007\325\2710\2123\300\026\204\352\242$X\326EM\237v\270\032r\302\003OE\360\324\021\333Q7\232~\234\032\365\"3\264\034IQK\374+\324P%A}\030"
+	.ascii	"K\204\236\337\206\2073e \fn\244:C;0%\331\204\224`\342\364\263"
+	.ascii	"\b\250\204\210\3737\204\342\232Xd\342\237\0137U@3y\212\330\226"
+	.ascii	"p\355a\205OU\003\251yz\273J\031"
+	.text
+	.section	.gnu.lto_performGyroCalibration.59.a5bf0a8a39e58656,"e",@progbits
+	.string	"(\265/\375`\236\013\255<"
+	.string	"*h\344\026?@\346\316\030i\217\264M\260\375\327\241(/\024E\201)\033\254\233\351\327\026\032\005\345I\023\365;\264:c|@\327q\025\375\002{\234\377\373\313m\003(+g\357\231%\212\356\253{\213\334)\245\024]\001D\001b\001\314\3112\202\314\032J\377\372\270\003\311\304X\202R_\272\366M\356\214\225C\021G\277\0263\243\303pR\214_\341\324\312_\003~u\037\013"
+	.ascii	"t\346\213y\006s\362K\037[I\267t\026n/\334\\\272\213\333|,\330"
+	.ascii	"/\332\333;\016\355\356\030\276\357\273\240W\006q\354u\251\330"
+	.ascii	"Lv\257\265\324\350,\034%\r\274{\3377\331+s\r\346d\257k\322\231"
+	.ascii	"\243\246\334\246\342\350\345\373\204\363C\252\235\271\255t\236"
+	.ascii	"\333z:\332\350}\341\b\303\274/\225\001'8\366\312\324Nb{=6\223"
+	.ascii	"\355\225]f<\001\304^\247\224\235\035\262-\207\357\373B}\022\376"
+	.ascii	".R\233\211\334m\346\221\321\262\250%R&\221CG#\273\026\337]n\344"
+	.ascii	"\231\263\231Gsm4\267\2543\223S\342EsX\330\274-.\247\305\006O"
+	.ascii	"'B\202v\244\225k\2354R\200\213\"\325\343\206\266\244\221\305"
+	.ascii	"\253\274;%\237\245\213\231\2563\223\372\320\240\231\221\342R"
+	.ascii	"`3\325\231\251\371\221\311\r-\255\215E\005\3235Bz\320,\255\230"
+	.ascii	"\364\346\255\260\003\311\234\355A\263\265\366\322^v6\346\353"
+	.ascii	"\220.\026\037\210\035\256\265gbE\245 \2628\3113\250\177{\351"
+	.ascii	"\017"
+	.string	"vw\364\270\241\035i7Rx\337\227=z\206\326\214\324\314\315\202\231K0#\273\004\314\033\272\216{\305I\356}\337*\346\n]\315j\222\263\320t\264\346\270z\027\224\252t:\330^[O\215\320]\037\366[\323\344L\361\343\270\351\231~\255\307\2407|\340\324\201\272 6V\033\003\353\364M\337cu\016\336\351W?2\304\2507V[\003\353\340]p\214\312S\fg\350A\r\307\367}\251\270\335\364\033\016\354\001\204w\024\004\333k\324\267\230>\340\364\273k@\336\3526!\216\357\013\245\342f\343\352\215\340\246\353\265\251M\202\355\225\351\033\260\017<\361+\234\346\351\205y\342\277\357\353\374\217c\246>\275;\354\254o\312\017\307\334:c\265\316\023Z\347\253\245\263\204\245\263U\353\034\241u\256Z:CX:S\265\316SRK\347\250\245\263\203\246v7h2\315O\255\263S\353\334\324:3\265^\367R\3635+\265\316"
+	.ascii	"Z\347\244\"g\244\"g\346;\037\275\263\321;/\337\271\250un\337"
+	.ascii	"\231(\351\254|\347$\322\031I\344<\244t>\0169\033\223\316\354"
+	.ascii	";\257\357\\D:\377;\373\220sS\370%{P\273\302\247C}\201$\022z\335"
+	.ascii	"\254c\2344\231n>5i8\211\345\257\355L\243i\266 w\220\2029l\006"
+	.ascii	"j\030\b\240a\013\236\246UTe4\275BQ\213\363\244\323\267'NW}\004"
+	.ascii	"\b_E\365\r\247!\250\341\fN\304\207P}\253\361\263>6\344+\377\347"
+	.ascii	"\366\326$_\371=f\330\340\223o\224\323\204\247\b\335\320\3071"
+	.ascii	"\016\266\301\257\316@8{\204P\027tD>3?9\232\233d\312\315\374\314"
+	.ascii	"-c\327\207\013\004\b;\364\3107\372\221!B\360\247 \356\020\266"
+	.ascii	"\243C\337\201\332\240\357\354\001R\356\354\030?\216\271q\260"
+	.ascii	"\307o${\354e\336\003\0077\035\273E\\5\357\250\253\3666\244\\"
+	.ascii	"\002\245E\271\361\210\313\346\035}\372\016l\2440\204E\334@\337"
+	.ascii	"\311\206`\247|\270a\351/\274\345dS\337_\340\246yzP\316\276\361"
+	.ascii	"\315\215\023s\250\013\245?]\274\247\252\207\271yNUw\022\2203"
+	.ascii	"~G\211\204\261\317\276\311u\0313\\?\021\261\220VRtO\361\375\327"
+	.ascii	"_\331\214M\377\213\337d\210\203\334$\375'\247\244\005\271KZK"
+	.ascii	"5\320\225\334\177\377)\031\003\310\275\322\364'\313\200\037\255"
+	.ascii	"$\377NSK\f4f\3758f>\356\025\247\252\313\244\367d\031p\235\264"
+	.ascii	"\036\367\211R\030\265B\207}\232\274\237\331\215\342N\361\216"
+	.ascii	"\362\022\364\235\314\215\307E\033\275\343\342MU\271U\272\320"
+	.ascii	"\315\203\262c\240\337\370\306\006\030%\262\24094\272P\240\220"
+	.ascii	"\361\305~\255\260\301UD\321\242\251\342\253\313K\305\207\027"
+	.ascii	"\315\0252\270\274L\254h\301\225%\343E\227\213.\032\315\fK\036"
+	.ascii	"\220|\342\251\351u#\005\324\227W\363\353E\327\027\324\213\025"
+	.ascii	"\\.\240Nx}A=\r\340&\214./(\031\315\246\027T\222\032\326\326\024"
+	.ascii	"\302\376\331\306\004\360R\242|bbc`\223\036\3003\030\233>y\313"
+	.ascii	"\3530\024x\242\205\224\3649\244f\360\216\264\274\033\214\017"
+	.ascii	"\313\f\346\007\fP\225\320\fsJY\031#\272FzG\334#\314rf\260A`\205"
+	.ascii	"\274\243H\337f\332"
+	.string	"\236\357\\r\261\314\367\332#\234\363%\\`\211\256\323\311\366\312|+\251 ^\032\2263\333\025c\231]2\227G\363\021\222\021\320\007\b_\321\307\261\357h\254o,\355i>\346\234Zx\313\221`}k\351\366\343x\210P)\365O\350\013Z\351\313\030\264\322\367\237.\276\357\373\0229\265\322K}{i\017{\323<\356\205\360D\031T\036\275\303\371[\226\0019ws\237(\261[\242{\214~\371G_\240\320\030\225\to\364\b\374\212\236\350\227?\340\316\330\264\375\242o\247\236\360\255\326\036\351\337\223\016\027\304\347\325O\220\360WV\022\312p\006oc\263\372.\343G\334+\r\350kY\355\347F\260\210\212vo\002\r\247yc\276\364\305\301KF\370F\303[\036\200\354\250a,\306\230c\206dDD$I\2224\006\220\002\221\031\253u\003\021`14\307H\332\fs~<\243\206\275\027\267a\231\220\227\310\3525\210{"
+	.ascii	"dQ\277\301kE`\361M \324,\211l\030\307\323x\020\204\027Wc\335"
+	.ascii	"\013 \374\274\360V\r\257\2608X\254\250q\367\261\354;\252A\237"
+	.ascii	"\213cf\253x\254\3148\250\004\031\034\205m\021\024\210\225|\265"
+	.ascii	"!\203\363[\354\270\300\266\023A0\300\322\337\3125\207\352N\343"
+	.ascii	"\002\003.\216\274\230\272\036\254\367\206"
+	.string	"\217\027\022\333\303\324\244\344\216~\211Ib\251\331a\335\355\"&\031b\205\"\230%\030\fY\317\207Q\226\272\363\020o.1\320E,5K\214oYb\265\343\364\273P\266\r\241\317\033\034\307\350\205c\331\030\202-D\036EB>d\316\236\r\237\346nz\246(\275\354\312\367;\\\r\226\276\262gj\240\255\354\335\2672~\017\355[\364\240\023\t:\342p\b\213`pCK\277\013\346\023\030k\bm\204\207\034\367\254\220\002R\203\275\b\342\317\315\364\3177\270\3160\0360\245\200\276|6\177\324\333\344\f\030\327\027\033\362\234f\223\006\017\364l\230w\231\305\350\220-\211\207\206\356PV\340K@\263\224\036\337\033h\313\233h\237\377-\376\006\360<9?(x3\320\270\242\306\305\017\326Ab\374\325\314\332\225\027i\332%$\007\023\037\233\001\023-\221h\376HHO\2574L*\370KO\243\325R\304xX\006TR\004\261"
+	.string	"$\030c\334\362\260F\271\220\246\037\""
+	.ascii	"\377g\002\270k\374r\004\251p\361\016\316>\357\365\037o\267}\301"
+	.ascii	"K\25357\na]\341>V=K\274\305\020\374\372\213WSGb\323h\373\206"
+	.ascii	"\232\013\211^RQ\023\322\251"
+	.text
+	.section	.gnu.lto_gyroUpdateSensor.60.a5bf0a8a39e58656,"e",@progbits
+	.string	"(\265/\375`\240\006%!"
+	.string	"f\267\304F\200\334M:\273Z\253\344V\215\021\222T\002\0248\343Q\223+\355T\276j\357bi.9\023n\033~\350\017K^\337*\354,7{\246\330\376\224\372\006\206C\250Q\373\270\273\254\265\363\307\317\017?\374\215\020i[\246\024\242"
+	.string	"\247"
+	.string	"\300"
+	.ascii	"\353\262\\\223\344\232\326\326K\3277p\364\345\311\030(ZN\350"
+	.ascii	"\231a\255q\264S\301\220eY>\330\303\\|h\372\313\022\264\352\252"
+	.ascii	"\265\336N\332.\354\333\311\337l\177\355w\335\353\274\360\305"
+	.ascii	"q\265\016!Z\251u\230\344\004\266\223\036>W\236\264}\250<\351"
+	.ascii	"\323V\363a\260\032i5\241\0223\326Zu\224\310\271\347K\262F\367"
+	.ascii	"\364\237^\376\353\265%@8\2753T~U'mU\257\001\375\244\242\226\326"
+	.ascii	"\024Xu\311q\373\365j\2710B\316\376\365\245\361\233\3325'\324"
+	.ascii	"Z\275\276\337\215\333\274\355\023\266\033\330\245\234U4|0\210"
+	.ascii	"\362\344\021}\330\023(!\353:\225\333!N\\! H\026T|\025\220\314"
+	.ascii	"\026\234\203\031\257\250\250W\224\224\222x\222&j\353\030\267"
+	.ascii	"K}J\351\203 Q\364\311\376\024\026\007\212>)\016\226\326\320|"
+	.ascii	"U\026\361(#\006\024\355\245\2131\331j\255\020\240h(Q\024<r\322"
+	.ascii	"\177Q\236<"
+	.string	"\375\327\021\\1cc\345%\204\332\243=\354-\305\302:\023\222\231\016\261mk\244\333\372\350\302\337\310\\\027\365\254s<k\"s=d[\343\314\265\220\271\0162\327@\345\372\307\\\373\230\353\233\271\356)\327<\346\332f\256M3\273\022G\221\250\227\212Go\217^\257s~},H\007G\313\037\3003.\241\020\235#'N\020\005\242Bo\334\264\t\372\241@?\373\0325\031>\206&ao\263\362\344\317\031.\037\232\006M\361F{\250\217\2312dn<\264'\351b\302\200\341\241Sf\243_*\034\bR\270\027\245\001]rb>7&-\251\215\006@\233J\322\343R\341iA\013\337\242\3648E-G3\351\323\212\224\221\264\244\244\031U\032\324\036\027<\313\205c)\326Z#\330\030n\226\341cA,\022HZ\226\001\315p\225\325Zk\215CyDy\314X\002\366f\f\232\207y\303\257p0P\fs\207[\361"
+	.ascii	" Xk\024\204\223~\274\235S\023S\207\036/1\330\361Z\224\3209\361"
+	.ascii	"vNMLN\272&\023#P\350\226xN:\006\001\274K\301\304\323\251\330"
+	.ascii	"\355x\272\333\020\212\370\tP\264G,WG\016\034k\266\222\326F\r"
+	.ascii	"\032F#T\025\333[`e\270\n\200\340\271c}g\017\240\205\2611N\037"
+	.ascii	"@\316\253\253\362\244\n\240\232-\243n\213\250\220\023\213@\216"
+	.ascii	"\026\321\023O\"+u\026"
+	.string	"\261y{\033u\032\261O$g\326\336wf\225's\364l\200h\\B\203\031\257\246H\004k\304\344\324\332\373\\\243OF\332!JD\355\223\353t\262\367\271A\020\251#\n[\232\322\202;HD\224$\372\252\220\350\020\216H\225\366\343\003\200\204\250aD\007\025bC\022&HAAA\222\016\260\002\221\031\253u\021p%3N\005C6\245J\333\001X{\001P\335\300\004\244\213$Op\24540B\013\311\217\334I\251\236<\302\307\003\201\303*\307\244`\356@Pi\340\307\034\364u\203`.'=\177{\242F\031O\240X\373\363,!C\220/\336&\006$\352\200\364\231\371\206j\255\320\026m\331KBf(\007\361\023\340\3130&gln\334P5\340\222\244\244\2756\365j\344\273\252\2626[0\363\233\253\270y\261\211'C=g\024\237\270pRb<\376t=\371\006\267\373\364 \317\f=z\002\376d]\342"
+	.string	"R\200\302\3745@I\254Vxvm\364\273\227S\005\035\233\343\033\226M7\377\316D\306\206\225\221i\004\306\004+\243\353\"uJ\262\3014\257\243``<\032\034G\035\315\035"
+	.ascii	"/n<\350\006\233\217\270\325\272K\327\313\361F\302o\316\370\203"
+	.ascii	"I\312\377\020H\327\3645\235\3114\354j"
+	.text
+	.section	.gnu.lto_gyroUpdate.61.a5bf0a8a39e58656,"e",@progbits
+	.string	"(\265/\375 \372\275\006"
+	.string	"\362L/4Pm\222\016$G/bv\025G\002^\317\310\"\201,\241,\0277h~\034\266\355\243\332\250#\224~\361\317\316\314LTUw\204(\"\2117\177\2741Bd\no40N\tO\212P\352p\244\327Q@Xx\233(=M\301\220\201\023_\003\204\361a\260\254\373\\N02\217\223\330\322\n*6]2=\265nHC\016\267\243\321\017S\253\325\350N\226F\017\021\321j\2359\271\310&\\\365X\325\234\306\027 \335\347\335"
+	.string	"\n\311U\320Hf\305\212JfQ\211\307_\314\324\233\024\343H\202\217\020\205HJf>\267Q\252\215\272\005\251\200uUm\001\007\231y\263.\213\356\372\033\374\231?#\b"
+	.ascii	"3\001K8\023\360\370\032\327D\267\020\360\313\020\340\322-\332"
+	.ascii	"\371\004"
+	.text
+	.section	.gnu.lto_gyroReadTemperature.62.a5bf0a8a39e58656,"e",@progbits
+	.string	"(\265/\375`\320"
+	.string	"%\013"
+	.string	"6SI@ \345*\035\3408\216\030\237p\2011\022\236.\277\354\t\257\0248\206\022v\363\320\303\245\356\020D\244;~\255\265\306\037\004\225\250\177\367\021\b "
+	.string	""
+	.string	"\220\211\r\271\201B\354\354\352\346DK\310\336)\0055"
+	.string	"5"
+	.string	"9"
+	.string	"\266\002\273\033\326\223\243\376U\212\362/\273Ai\246\376\211\274~\t-\234\016\301d}\017\272\330\310e\247\037\346\212R\202\211\3355-\315\220\033\274m\n\333\016\366+\002\364\345A\377\2449\370\312A\022@\205\246\242=\373L\321jb\377\333\352\262O}\220C"
+	.string	"f~\306\333\005\351\035\330\0348\203b\373\033\243\354\001?_\273\220\202\363\b.\237\335&\202\330\355\252^\266\224$v\265\352\337x%\271\216\232\242\272XK\246\232\244y\275\250\t`Q\003\266\305\237\244\006\233<KI\341\265\273\021+\247m\370\260\2036\235\002\366t\304\321\004\n\311Q$G\0372\034\205,D\241g$\303\016\203\305\214\317\030j\210\342\030n\316\375\267\325\345\002^,\247\252\253\217C?;\f\350 \364\027\214\003\330\035\274\225\036\023\030"
+	.string	"3\241\267(\306\350\203\235m\357\302\032\007\342\315\302\026'\314\"\020_\250$\001F"
+	.ascii	"\337- \202\253/\354\372\203\205\227\246\265\271\210\013\243\003"
+	.ascii	"c\363\313\020\342\322M\325\316\024MA\001"
+	.text
+	.section	.gnu.lto_gyroGetTemperature.63.a5bf0a8a39e58656,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"m\007"
+	.string	"B\21635Po\322\001\240\234\222\3745\250\030\241\b~\310\324\032\241\256iG%\216\362\tA\255w#\304\".\362\255\211\f\"\345R\263?\266\202K\214>\362a{7)S\n\376x`\024=<*B*\004\242^\b\302!\342}\"\365<\006\206\022\240\370( \214\217\263\3553\253%+\302\245\027\266'^R\035\330\324I*\nZvw\341\316\037\371f\341{\334Y4\312cw\376H\001D\256<\331\233\225\312a?\263Z\262\235N\rx9\311\256\261\354j\234bV\305\241|\330&\331\034\037\344!$W\035\214\313J0\245d\230\300\354\356\0238\201\346.?\240\271\323\216W\317\312\277\366\206\025\315\005\313\254\347\206aw\235X\266q\353m+\330\356\3306\005\n"
+	.ascii	"\023\013\275\263\030\276\020\237\257{f\260\3105\2747\302e!\310"
+	.ascii	"pWL\355$\003"
+	.text
+	.section	.gnu.lto_gyroRateDps.64.a5bf0a8a39e58656,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"}\013"
+	.string	"\206\226O? m]8\327\b\231"
+	.string	")\bR\230\013\354aXKQ\217\204\n\300;\006![\026{\371F\204\313\020dp\357\337\335\277a"
+	.string	"\t\b>\fA}L\331\240\305\b\252\365ES\377\332K\233H\231R="
+	.string	"9"
+	.string	"?"
+	.string	" \221c\223\313\266o\341\027B\026}(\030\201\024\n\254R\n\305\356n\030\337\310\216\3455\262c\032\341\242\247\310\177\206\007 \211#B\023\370\324"
+	.string	"\354\256345\270\365\266=lW\354s\001\251\020\354_\273\273\326\007\326>\376\331\225\2764\255\232NM?r\221\342\204\351\242j\227AK\305\226\300V\023l\207l\211\355L\373\3421\204>Z\204-v\035T\b\261\273\025\007$\356 \254\302\\\354\314?h.\247\016\367\260\341t\362aG1(\321\366\316\301*\312iwCl\317S\035\007kw/\032\276\241\200/\341\230?P><\346\203\262cW\nj5\312\226=\202\001\037\347"
+	.string	"w9c\351<\004\233\355\363\272\357\243\371\266\017\207\363l\031\357\333,\035\356\bh\274\315@\327y\233d\334[\323\311HI\276T\323\227Vd\244\252-`@\366\360\322I\002\005\235zU\275\211\005$\002\022"
+	.ascii	"2\003\302\260K\273\232\307,\003\241!X\022^\016\002\252Scd\263"
+	.ascii	"\\\020z\314\346\"]Pq\253\225\016\214\021\320\204\221\222b\272"
+	.ascii	"&\031"
+	.text
+	.section	.gnu.lto_gyroUpdateSensor.part.0.111.a5bf0a8a39e58656,"e",@progbits
+	.string	"(\265/\375`/\006M#"
+	.string	"f}\325D\200\236M:e\207eHp\030\302\205M\321\n\241@?L\240q\274\206v\354\3642{\303\273\252\326\016#\221\312\205\250(&\f\225n\034\001]\3352C\225\236\364'\022\321"
+	.string	"\340\245\210\241\265m\204\020B\344N)\266"
+	.string	"\275"
+	.string	"\306"
+	.string	"\366\315\312\257\034\313\213\377\354\004\344\r\224Z\353\213\030\377\371Ve\f\260\013\254\326z[\337\n\225}\273\231\322\237T\2472#\300Ywd\231R\373a\0273Oe\306\213j-2\366\245\326\263\351\242\r\224\027}>i\274X\376h\274h\177\212m\252,\233\366\235\237\276\032\300\211\024\033W"
+	.string	"\325Zu\027\367\210\367\341y\223\324|I\216b\270\264f\372\274\227!Q\233\254\255PA\255\365d=J\222P\265V\333\022\037\037{\\\274\252AC\212\245\305\343\033\036\350:\343\221\323\262\n\223\330\020\251s\263S\034ZU\224\002x\215\204\252\265\372\275\037\267\355\266\277l\177\260\307\001\001F\274\265\327-b+%\345\250\221p\324G7j#\033uQ\215\232hH\210:\207\243\026\302\tQ\337p\324\266\033u\315F]\326\250\311\261\244\026K\352\220\244\336\217\335\364\347\177\002\341\223\260\241\256Zu\004\323\252\020\321L\311\307~0\037c'\006T\336-\361N\237\016'\006/\274\373\351\323q\"[@\2600n\021\326\255\323\267\343?$_\300"
+	.string	"U\253\223\311v\f\267\330\0335zC\032\270\311q\305\003P\255\247\356bh\337\337\3622\337\31470__\\\366\272\243\3225iN\202y\036\224Z\376\363\311\306\250\234u.\357b\336\213\305,Y\235U\213\374)\001\2021]\364\202\362\342R\250%\366\355\220x\362a\3251\237\234\fhF9\035sJ\004\340m\3077X=z4\030v9&\225\322\2664\270\306D\021\013k\033'j\301\337\034\216\004S\250Pa\274x\254=\345\326\226\034\2631h"
+	.ascii	"\035\327\266pa<V\271G\023b\265<\357\337\313B\346\306\256\021"
+	.ascii	"\227\3070\222\353\342'\307\212\006\262\277\346l0\370_\316\240"
+	.ascii	"\201\036K\303x\221\\\222\227\346\253+lK\334p\307\275\240+&U\033"
+	.ascii	"\256\306e?K\023\342e\342\376\314K"
+	.string	"l\303]1Wyz4(\343h8@\360\325Z\035\330\035~\306\303\223\017\304\315\204h\002\326Z\237\312\320\020\341\177\315\030/\356\336\354\272*d\322\272\302\314z4\350\375\326Zyt\003>QB\302\204\250r\207\002\206\210P\203\315#\022HM\3050\241\333MI\355T\220\330\351T\240\020\221B7bj\247K \300R+HL\351XHIM\351n\207\352mU9\247\306\364\332\234Qi\351\342h:\335\373\371\315\331\207\265\326J\"8]\245=\331\305 @\006\375\342`\351\252\242A'-\265r\031\200!\264\312$\222\243<\3323\215\330<bz\231^\343E\031\\i\320\266\206\026i}\264I\273\024\264\035%\023\311\007\231I\220V\311\313L\311\323\216\226\006\327\031\332h\024(J\007D+Z\243%\257\f\025\355\377\210{\f#Q\037\242]\301u\026e\013\267\271\265\320\016\361\331\263\344zrM\216G\bM\254"
+	.string	"\035\367\266\266-n;\b\251\261\274\200\202\250\221D\203\024bffDFI[\230\016\200\002\031*+n\021\2005T4#\222\322\f\233\001W5t\316\306\330+\325\222]\213k#\360\306\306\225a\232\327(~\326\265\311\205\214\207w\225F\210CT<+\203$<#\240u2g)X\353`;~\315nb}\210,J\357\222\330<"
+	.string	"u\b\354\027*}\312Q\300N\223\352\243\202\313\256\330\217R\3360\244\007\271\237\307\226\252\354x4\002\250\352\021\364\360~\237w\206\233\317 \356[\314\266\202\251;\356\207|MB\200I\221x\3476`\267\320k6\317\024\206\035\210\037\024%\366/\0243H#\353\244\3374\323\260\0133\355\340:\263\276\021U\213\314\314\3609vE\203\317\360\2500\362\324M\267\325ug\037\241\241m"
+	.ascii	"\244\020\t:a\333,\324z\213\362\232\277\032F\370\370\224\b%f\253"
+	.ascii	"$\022\211(Id\257\244\036Z[F\260\322V\231\b'\316\2214/>|\353\320"
+	.ascii	"\030\t\013\236hp\312\024L\005"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a5bf0a8a39e58656,"e",@progbits
+	.string	"(\265/\375`\312\005\335\025"
+	.string	"\366!\200H\240\226J:\300+HB\322;\355\3007"
+	.string	"\005knVw\265\004\025^\003\334\026\254\260\032|\3047\022H\335u\360J/x\263O\235\302\n+\2540\3450s1S\355Q\365:n\211h\033\205(P\250\212\"\215\020\271e\ng"
+	.string	"r"
+	.string	"k"
+	.string	"\355CWX\331\212\341\324=4A?\t\202>\222m\352\207\355\265\230x\225\253\3765K}\260\345\337\357\367S\352^R\347P\244\306\241\\y5\264\254E\216\272"
+	.ascii	"\255ei\356\201~\025jD\026\275IH\364\263\360\377\232Z6\001\266"
+	.ascii	"\244"
+	.string	"1vc\250\223xB\377\nkYV\"\177\377f3\026\254\265\326\240\326\241\377o`\001dP}'$\372h#\372i\"\372LB\364\325@\364\327>\364\237x\350\033\331\332\241\177d9<\334`\023\376*\254\260\256PTi\020\020\376QXQSXTWTVPU)z\276&\213\f\004B\f}\256\013\335d\241\231*\364\022\345Ae\213\214B+Mh$\t}\024\241\207 \264\320\203\016\242\016\232\247A\357P\006\rD\027\364\225\354S\377(\b,\372\312\240\034\2135D\\\233\b\256o\3130\265\027=\221\311suB`\244\351P\246\361m.\213\013\337\016e\032sg\256\310\020\343\241\354b.\200 C\330z\224q\006(\267|-\327Z\265z(\337\316}\031\224\037k>\224\367\334\263\365\360\221\003\347\374\224s\256\352/9\321\357\242\352{M\365\313L\364\315\244\372bQ\375\261\022\375_\263w\303YK\247"
+	.ascii	"\261q\306\003o\026$k8\213\004_\244\354\273\260\340hAI~)wE\222"
+	.ascii	"]|\273F$\337\2143\354\264\223\341\001E2\334\202\266\003q^\343"
+	.ascii	"\216\305s\351Y[\024\035D;v\372\216E\257\230\221\305\035\272\221"
+	.ascii	"o\345\2020#K-\230\033yc\370)F\247c\334)\004\303-g\035\202a\335"
+	.ascii	"O\216]\276\200r\001`\250Q\024B\301\326\210\222\224\2444\214\001"
+	.ascii	"\360\002\231\242J\007\021\340\224E\310\030\021\tDD\002\271\200"
+	.ascii	"\036v\023\221\344\006\t%l+W\374\340\204\331pfE\310\360\021\301"
+	.ascii	"D\027\324$e\322\230x\016W\325P\240\007a\270\272\212Y&\317q\215"
+	.ascii	"\340V5=5\003\203\310\215\226\024Q\013ZPD\255\360\005\226\366"
+	.ascii	"\314\325\314\033X\210Oe\231\031\304^0L<k\372f\342\305\300^\257"
+	.ascii	"\021\271J*n\037Ux/\210-:\020\257(/\353\353M\245\030(=E#I\210"
+	.ascii	"aT\243&1\302\234\360!K(\"\204\335>\007\374\353\331\316VD&\263"
+	.ascii	"\033x\273\253wT\242s\017\365\017"
+	.text
+	.section	.gnu.lto_.refs.a5bf0a8a39e58656,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\265\005"
+	.string	"\262N#\025\300\032\251\003(\202\242(\330z\r\022\004A"
+	.string	"~\220\264-e\nWzi\253\345\356M\351\204\307*\271\b\247\034\237\034\227\034\177\264!\351c\317\365\243?\213;\214\247\373\256\035i\262\033\013^\326yUtC{\250};6L4\003\332\263\366\253}j\3176B\035\032\325\220.\334CP\277B\232B\350\321\240\013\356\037\2507m\n\032p"
+	.string	"\017'\253\303\025\307#\305\007\351\231\342*\335\2501\353/\367\221{\206\342\210\364\275\273N\344|f\002\017"
+	.string	"Y\203,!\360\356\0060\\]\r\3221m\324TQ\3146"
+	.ascii	"\226k\242Tt\310(b%\341\n\330\ti\313\031"
+	.text
+	.section	.gnu.lto_.decls.a5bf0a8a39e58656,"e",@progbits
+	.ascii	"(\265/\375`\365^]\215\001j\220\256\217U \fQ:\215\001\235\370"
+	.ascii	"O\206\035\377=\316\267\264\263s<i;\210x|\216\236\2470\352\207"
+	.ascii	"\243\271\350M\n\210U\316\201\255\n\023\360\004\307\213=v\223"
+	.ascii	"\321+\246#\224\261\221Z\tw\317\221\335\0169Qa\371>\343g#\246"
+	.ascii	"\262s\023\030\033\231\225[n)\245L\001\275\007\370\b1\t\026\037"
+	.ascii	"\235\322tv\213\335\321\344e\312\342\243Q\372\371O?\253\321sS"
+	.ascii	"\230\224\330\260\370\031O\337\203+V\314ZU:\252\006\204\205Y9"
+	.ascii	"\213\2452\355\025;\366\332\244\252]\261d\266J\245\243\352\331"
+	.ascii	"O{n@\034r\256\244\2202\226q\025\273f\343|<\341\242b\255T\246"
+	.ascii	"\255\362*\266\3146\251tk$ ikb\030_Yw\031\377\267R\354\224\312"
+	.ascii	"\264q\026.\212}\323\340\244$\341\fY3\316:\261P48)I\210s\322\324"
+	.ascii	"S\204\304\005\311\370\231\213\376\355\333\255\333\316\n7/0\026"
+	.ascii	"\3336\234\031Ttq\026?O\321\226\3555\252+\305\234\305\317"
+	.string	"O\364+\363z\366\311\367\260V\026\032d\026?3\321\317e\3729L\337\203&\226i\321*\335\232\210,Q\230X\265\312\264Ml\032\b\020l\023\273\304Z\005\231\230[*g\305\233\231e\260\210\227\030Y\306\31724\006{R\323b\317\254\331\336\331\331\313A\345\313\342g\026\372\331I\377d\243\177\252\321?\367\364\317:\375\023\213\376YEkP}\362\3177\375SM\237y\344\267E*\233\375\262:o\177P4,\266]\326He\236\212\365\272yb\356\264 V\230\202X\374s\211F\261\367\336\365T2z*\371'\230\326\251>\371\267D\264*\033\033\244^\2410\342\314\244X\\\377\204n\211\274U\201\372\263\370\347\020\235\253O\376[\365\311\326\207\375Q\231A\026\310\317&\346f\356\275yj\031 NS\026\377\344\241M\260w\r\31250\260\006\345\237T\372\247\f\213u\231mW\352,\376\tew`?mu\354"
+	.ascii	"*\001dc\361q\031}\\\247m\225\2657,\216\333*k\343 @\270\316\223"
+	.ascii	"\255\302{7\325\272A\260\326\rN*D\232\3202>\316\242\217\245\350"
+	.ascii	"\323U\237\3740\365'[\031A<<~4\335Y||\246\357j\336er\215p\212"
+	.ascii	"j.m\f;U\231\026\306\205,\214\252g\241D\200ZZ\300\351E\323\302"
+	.ascii	"\260R\317\242\301I\271\233v|\350\352\253+\353\333{s\b\342\300"
+	.ascii	"\0017\001r\305J\343c\025\372\225\r`P\245\003\002\001#P\316\234"
+	.ascii	"\2244-TmV?\rNJ\023\344\2424\353\336>\225\340\315\336Xk\\cMaM"
+	.ascii	"6\246\r\225nM\304\333\230\007\026\312>\235J\360\251g?m%i\326"
+	.ascii	"\275\277\376\3256\026\252\006\006\005\233\230{\t\342\311\026"
+	.ascii	"\271\276\275\367\177\353\302FY\025\266\205]aY\330\027VY\231\026"
+	.ascii	"\312\2468\020\223\003\320\331\204I\037\033\f\370\367L\377\212"
+	.ascii	"\351_/\375\253\245\177\261\364o\225\376\215\241\177W\350\236"
+	.ascii	"\372\223m\365\311\037\352O^\003d\231\310\324IY|\333\247\377\327"
+	.ascii	"4UMe\326\276Z\346u\257\2229\020s"
+	.string	"\357({\357{\300W\317\004\231.\354\315C\217ko\346\353\330/\324W\321\3243\225\216\212\271aT\032{S\376\372\366f\002q\340p\333\360\3160\311\370\026L\377\365\214\231\034@\262\034\200\026W3\265\fs\003\005\313\212\270\340a\361\255\225\276\245\322\267S\272\356\372\223{\252O\276e\241\377\n\3465\357\257u\325\256\342\205`\357\247\275w\005\247\223\025s*,\256b\352\230W\274\032fW\274\017\256\366n\252x<\177{7\361\324\272A\255\033\340\260\254\"O2\276M\241\353\027\241W0\367\311K*&\317M\001\304\005\f\2139\250>\371\025P\277\256\321\226Y\177\362\206\352\223\337\254>\031\255r\251vi\374VX\374:F\277\322\351,@<1r\250)-~\205\242\357\301[\235r\315\226\372\311\217\033\315\275\231\377\353\225:W\231\025K\215;f\356\275\266\367~=\373\205*\226J\245\312]\263\345~\372\021\243"
+	.string	"u^\236\314\365\355\315\344"
+	.string	"\304a\347I\037\033\032\031W\251VxZ\020Q\241e\361+S\225\023\372\303*\305\302`\"d\205\305\307\200\206;\n\372\f\320uY}\362\351\352O\256N\352\223\312\274\240B9\b\020~\231\316\366\330\336L\036LCK\217-\213\357\201~\275 \327\300zA>\001te\326\237\fT}r\275\252>Y\254\216U\264\253tq\265\327\366f^8\321\260\2045Y\\\311jYeV\264\277\232\325\263\343\263\253\235\2667s\3476\321\320\342f\261\006\365'\343\352\223y\2326\b\267\372uC\346\t\f\f\f\254\033\362\231\365'\353\352\223\255\220M\335\200A\365\340\203\013\346@m\270\002\267\017\377iU\205\240p\017p\237?o\340\257F\356\206\353?_\340\257(\376\252\364W#D\376Z\202\245\377\022\240\002\002\030\341\257f\376\232\207&\303-\n\276"
+	.string	"\344\257\036\324\017\250\352\220\n\366W\023\024"
+	.string	"\367\374?\003\252#\260\"8\b\377\231\343\277I\277\275\302<\377\355\301\301{\342\267Yx\307\252a\035\234Se\374W\005\306\371\257\013|S\305\376\212\200\277z\335%\326\177\225\373\353\227\277^\251v\177\375\240.G\025\323\201\377\032\016\364c\364\277mp\306\370$\374\247\212jA\210\277\336\331\f\324:'/@\233\377\262\261\340?\177~"
+	.string	""
+	.ascii	"r\376\234\200\277\336\231\370k\230\002\334\240\233?{\360[\266"
+	.ascii	"\243\177\346\340\267l]\354\362\326\333\007\343\354\252\371m\214"
+	.ascii	"\027\340\032p~<\360\333\240\253-\b\300<\350\317;\302\022\370"
+	.ascii	"\346\277B~\353#\315\007n\0214!@\241Zp\306\212\340\033\374\371"
+	.ascii	"\374/\r2\2775\341\267\027\370\355\tw\357\2778\364~\373\301oS"
+	.ascii	"\370-\b7\357\277Xx\277-\372\355\006\277\005\372-\n\277\r\372"
+	.ascii	"m\372[\022w\314\325R\377~;\364W\300+\346\277a.\230\377\032\356"
+	.ascii	"\227\377z\371\277\202\b\236\200\3774\373\357"
+	.string	"\216\005r\355\376\333\244\356\277\027\202\177\026\300o\331\272\320\375\225\351\257G\252\026\237\325\272\\\376\213d\313\325\362\337,\277]a\275\330$w\256\351?\007\3775\374_\341b\271\301\003\374\371\202\377\212\340\257d\256\324\244:\202\277&)[b\301N\344\177\345\376\032\344\177\226k\205\354\277T\376\212\344\257?n\\\327\177\245\374\225\353\257\035 \212\340\302\375\307\371\317\036\277\215\372-\324o\245~\353\342\267\313\337\302\370-\213\337N\375v\305oc\374v\306o[\374V\371[\031\277}\361\337\006\374?;\206?\227\340\277\037\370o\b\376+\374\257\007\376\313\201\377\202\340\277%~\353\305\355\277%\374w\003\377\325@\333\177\236?\253\375\227\355\277j\377\005\373/\327\177\265\376\233\365\337\034\377\255\361\337\251\377\276\370\257\362\277L\377%\301\177\221\377\035\301\177\221\376\313\302\177\213\376\233\376w\350\277\016\370\357\001\376\273\341\277\004\370\257"
+	.ascii	"~\333\366\337\r\376\233\301\177\001\360\337\240\377\372\374\367"
+	.ascii	"\302\177\203\377\305\371\257\376o\376/\376\257\375\355\337o\317"
+	.ascii	"\3746\357\267^~[\367[\272\337n\371\255\334o\245\374\326\355\267"
+	.ascii	"N~\253\366[&\277E\373\255\330o\225\374\265\004\277\245\372\317"
+	.ascii	"\345\257O\377\217\376\n\370\333\255\377(\374V\353\267G\177\365"
+	.ascii	"\340\267\304\277\032\371\353\206\337\016\377Z\366\333!\277\005"
+	.ascii	"\362[\037\277\315\372\355\325_\311\374_"
+	.ascii	"\341\257&\370\253\005\177\255\373+\006\277\315\361[\034\277\255"
+	.ascii	"\372\355\215\337\332\370m\215\337\322\370m\322o\215\377O\370"
+	.ascii	"m\361\267H\277e\341\267\"\370O\342\257g\376:\346\257b\376\312"
+	.ascii	"\344\257i\177e\376u\311\177\264\377F\377\347\376[\020\030\030"
+	.ascii	"\030\370\347\214\375=\t\370C\224\tpM\322\270\266\n&SU\272\270"
+	.ascii	"\332\\;\f\326R\2471\231m\027{\357jF"
+	.string	"sM\305(c\361\026\312F\312\2125\026\037\203\030\375\237B^\231\247\220s\b\004\326\366\236\322\300\313\214\252\203\033-1\025P,>\265\202<\\\354\271Y|\fu\372\030\264\350\377\004\362\312<\201\34017d|a_}{\271\354\340\030\340N\037|x6\262\312z\234Y$(#\004\213\305\307\340ub\235W\266F\013#0,>\006\037\247\0253\347M\207\023\0319\374\202uyaSp\3302\370o\315\016\255*h\2267\245<o\2346\316*/]+\356\025&/x'\225\323\211C\252\313\213\263\306\251\344R\244\314\314\342\237\233i\r\327\331\223\265\n\336\275u\354q\215\341\300\035\270o\r \233\277?5\201M4\326\3522\271P\265\254\025M6e\272N\345\231\242\322\345\274\200\253{iv\023\223\b]Le\200}\225M\023Z\204\251\f\260O\350Tb\277kW\351\200@`\254M\263\r\006\264Ud\272\312"
+	.string	"\223\354\315\024:\235\366\325\343+\003LrJ\235*\316\345\371\342\234:c\234-N\030'\213S\306I\343tq\2568g\234Q\225y*O(l\346\257{\247\022\237\261V;\312p\330\360\255\241\322"
+	.ascii	"\037\203\r}\fQ\372\027\364"
+	.string	"\364/h\321\277\020\247\177\301L\213\300\245\177a\207\376\332\f\375\267\372\223\177a\353\367\200\321o\326\237\374\036)\372=J\364{\256\364{X\350\r\365'\237g\215\3761\337\365,\223\031\330\225f\233*k\374X\220\251\022\253\222\265\266\247w\202\212\252\f\353\255\305`\222\344F^\020\030\234\225\017\213\177\214\207\307\004[\204\211qY,\306\3160\323b\213\305\347\311\323\370\n\337\341\035\030K\004\250\345\b;(P\307w\270\n\266r\315\226\025\260[\322\304Yw\330\007\216\273fK\024\262\236h\301\\0\035\266\303[p\027\034\006\177\301^0\030\\W\231\370\016_9\306\202\347\262\250\334@4'\\U8\334\232{3\361\035\226\273KD\200Z\216`W\206s`+6\274\231\344\232\370\356\256\271\201\"@-oZ\240]i\356\315\3049t\340\033\301\247\236\275\263\332n\232;\234\005\337\270f\313\n8ai\002\3416pf"
+	.ascii	"\201\360y\264\350\n\305\254?\271'L\365\311\347y\323\347Y\323"
+	.ascii	":V\306\224Q,>\317\230>\317\017=\005\2352\353\303\263\370<1\364"
+	.ascii	"\033V\202\333\256\331\022\005\247\260\346\033\016\202\221\\\263"
+	.ascii	"%\005\262\224H\301p\330\2552\361\033N\362\206\301\360\r\030\037"
+	.ascii	"\300\2028\350\3348\213K\241q\333\217y\340\036\230M\307/E\334"
+	.ascii	"\017\213\243`\260\036`\274X|\236\255\261\032\036\202\231l9+;"
+	.ascii	"\025\2549\262,\3151-M(x\r;\301Op\223\312\304j\230yl\206\317\260"
+	.ascii	"\032^\202\245\251#\345\310\023(\035\374\343\264c&?\016\303bw"
+	.ascii	"\263W{?\005\223\334P\276Y\214\321\204\216\323t\246Li\312\262"
+	.ascii	"\370j\252O\316\240\251\247\037\354\242\037\244\242\037t\323\017"
+	.ascii	"2\321\030\354\372\223o\360K?\230\245\037\\j$?\376\201\201\340"
+	.ascii	"#\266~%i\376\260\370\013\357|))\013\263\370\301'\375z\246U\306"
+	.ascii	"5\204\214\213\013\027\301^\330He\342.L$\n\333\326\335\344\272"
+	.ascii	"\260\220%M\0169m\212\21508\370A&\375\0354\372;d\364w\364\364"
+	.ascii	"w\306\350\357X\321w\327\237\374\301\211\276\226]\177r\316\022"
+	.ascii	"\353z:\327\017\207\217$\026\177'\211\336\241\343\241\277SC\007"
+	.ascii	"w\234t\260Y}2\276\361_5\267\017\333\310\361\221\305\217\312b"
+	.ascii	"*\315&$\013\314\342\353\234\321*\330\236\352\236SY[\023\212\215"
+	.ascii	"\353\305\226\266\346\n$l\315\246\266\0248\006\236\30230\r\274"
+	.ascii	"\3042p\r\034\205aT&\226\302,\216[`\027gX\n+Q1p_\232}\034r\250"
+	.ascii	"\336\224a2\340\353P\321\366\252\376\344\001T\237|\235&\372:h"
+	.ascii	"\372:L}\0352}\2350}\0350}\235/}\235.}\235-}\235\035\232gW\237"
+	.ascii	"\334\346\002\376i6z,\322X|\235e\233\277\031]\2007,\276\177n;"
+	.ascii	"G\264\274]\261\370\372]\357\377\rO\026#^`\356v\244M\311\023\213"
+	.ascii	"\237\343\247s^\365\311<\315\352\223\315\314\341\341uY\374zf\346"
+	.ascii	"\346]\275J\267\206\221p9s\313T\3465s\371\260\231\273w\233\301"
+	.ascii	"'\346\236B\241t)\003\274\312.h]\031?Gn\303%\303\344\271\371b"
+	.ascii	"&\307\232\305\317q\323\317a\352\335\315r\341\323\321g\361s\300"
+	.ascii	"\364\177\3616\354\254\371\342\224d\214\230\273*^\342,\016\303"
+	.ascii	"4\273\021\204\313\342\347\364\320w\327\311\305r\315\226#d\005"
+	.ascii	"i\"\271\273\\\256\335e\276i\025hB\356\227\013\346z\251\314{w"
+	.ascii	"\263\374j\271[\356\356\234=R\351\326\366\236\372\340\bS\330\027"
+	.ascii	"\316\231/mE4\276t\267Kerp\353\230<V\253\215\0234\213\237\303"
+	.ascii	"\244_9\31070\260r\220\217sFc\272\372\223\037\245N\037g\213\276"
+	.ascii	"X\376\253v\327\356\025{5\267\204\352\315b9\234?'3]\026\037\247"
+	.ascii	"\212\276\007lUoQ\356V\351\326*W\2251p\247R\351\326D\030\301k"
+	.ascii	"\216A\271[\360fo9\2617*W\312\215\273U\256\225\312\274Sn\333\257"
+	.ascii	"\333};f\356\375$4\345>\301\240\267\303+M\337\336\233\003\252"
+	.ascii	"\243N\356M\007\037\007L\327\253\372\2233T\237|\234\"\3728@\364"
+	.ascii	"qv\350\343\334\320\307\211\241\217#\245/]\375\311\rh\302\201"
+	.ascii	"~\232\002e\214IZ\245Kb\305\205\366\233f\025\202\275\323v\366"
+	.ascii	"\342\230"
+	.string	"D,\276gB\277h\r\320\342\021f\361\275f\027\3600i\274\340\301\374]\222\227\265[X|\313N3\270\024\026\037'\205~e\313a\255\202L=\333\311N\311\2657\323\n\271bv\210\335\252t@p\330_\363\202]\256+\344*\271F.\221Kv\217\334!\327\353\216\335 \367\353j\335\256\033v\213\334\255\233\344\"\251\314+f\365~\241\256\n\253D\213\305\313\321\343\033\253[*\035\214\017]p[\200}ml\240\236\031\2632\271\312\013$\206\006^L[\200}w\337\024\032\234\224$\244\301k\332\032W6\253\322\255\211\250\022\330D\002f\217\004o\366n\362\343j\363\333\032W\314\366\260A\320\"p[\200}]\256X\365bghpR\356\r\343\203\256\256-\300\276+f\303l\026&\234\"L[\200}L\352Z\215\362A\027\337X\236=\243\301II\202\337\236Ec\377x\364\340,\r*[U\351\2506\023\337"
+	.string	"\272\246\230\266\306\025\263<"
+	.string	"-\222+f\223\334-\370\304\334C2\231\251-\300\276\332&V\335\252\226J\267\266\233\2626tu\331\002\354\263B\256\230\345\262G\202O\314\315\204\026\351\332\002\344"
+	.ascii	"\224\313T\341)9\340\037[:\210\244Y\374\233(\372\377\345q\263"
+	.ascii	"n\217\312\274>n\016\333\346\342\210b2D\307\305\022\001jy\303"
+	.ascii	"\342n\353\372\270+n\214;\"-`\364q@\003\265<Qi|wX\205\t\022h\361"
+	.ascii	"o\312\256\254\260\023\033@\262\216\346\327\352\254\373\332zb"
+	.ascii	"\361"
+	.string	"o\220\350\337d\335*\">^0-\376M\324\275qmd\026MH\302.\325\257\r\234\"\200dk\026\337\0327\352E\213/f\026_\032A/S9\374,\2762\356\214sF\234\n\274\031\326\312\332iq\341ta\344\2745\265\232\364\335\251\273\314]B\266\242\256\324\357R\207-.\013\226\305\267\305\215\232\302r\"\025\365\027:uz\\\236\3141O/\247+<\256\013;\2263\206\305\336\263\370\262\300\301#3'\305\352\314J\223\327\324\327\\\264\316\256?\2712\253O\276O\307#{;,\276v\242_\231\327\351\267\351\ni\212\341\262\37061\341A\001\243\317"
+	.string	"\217\314p\222g\361\365\020}\335\303\262Y\363\305\306\314\233\305\327-\374\326\240Ok\316\266\364\335\256\251b{vj,\266j4\227\024S\21247|w\\\200\244\t\322\243\253M\254\21553\242\013U\016\213\217\336\351W\246-\303w\363e\254-M\363\226\257\352\242\321\341\203\b\231\272\204j\206\033\231=\036\2719\300\033{V/\207\221qZZ|tN\037\225\242\273"
+	.ascii	"]\265'%VLe\3321v\013\220\007v\214\345b\303\004\325\336\330l\321"
+	.ascii	"\331+\326\300\3410`jTTSi\261\375r\223E\306\214+\026\037\315\322"
+	.ascii	"\277\365R\231\366\356{:[\303\206\035^0,>\032k\367\377\306\376"
+	.ascii	"\270#\343g\361o\355n\353\226[\315\206\305]\320\275\251\272\263"
+	.ascii	"\347\327\255B\026\265\303b\364\313Z\241\341UI\261\030\365\262"
+	.ascii	"V\200Q6\2360h\"B\004\345\002\322\233\314NH\023E\343\025\325T"
+	.ascii	"\344(\227[\025\215=\030\026\243[ez\364@\265p\\5\27425B\216j\355"
+	.ascii	"\344\320\221\226g1\032\204\001Osw\026\243@\356F\307\244\361\302"
+	.ascii	"b\364\307m\006\207\364(\243a1\352\343n\250\325\223?4\347\017"
+	.ascii	"\233V'F\327\305\312\n\315\252\342\322jOpT\241XG\263\366x\316"
+	.ascii	"\\`Yc1\272\303\312\212%m,F\257\356&w\306\326\274\200\r\265\201"
+	.ascii	"\332@s\024\251]|\004\001\202\3428\232c/\347\tM\354\213\305h\025"
+	.ascii	"z\227\325\005\214\305\350\rke\203\271\242\271$F\f\264F=\333R"
+	.ascii	"\n\200\373\322L\302\203C\254\252\f\215\2435\356\013\036\313\245"
+	.ascii	"\305\350\214\323o\007\257\355E\026\213Q\031W\352\215\315\327"
+	.ascii	"\005BP)T\n\235\322\342:\247\364\321qY\036\235\332"
+	.string	"\013\246\305\265\241\355`\301\002}\001\2447\031\332\220\346\336T\033\200\316\356\300\240.\216\276h\336\365Y\214\266\020K\"7\343\002\033\250\023\352\204*\273x\245\351\323P}j`\250\212\243J2G\270\266P\2505L\376h@\241)\316\260f\300\311\351\320q%1C\237n\033\232/,g,\376\005Ok\236\003\327\240L\025Men\252+\2462\004\260\232\373\"\327\267\22586\024\371\260\312\202\356\243LYr \2237\254\334\346\031\360\277A\301\334\315\235Y|\rQtf\363\374\367\337\234U1\360\276,\276\0065\375g\277\377F\007H\226-e,\276\0063}\rah\320d5@sYuM=\254\251 i\236\325\33430\266\330x\374\277\251 PK\005\0333f\362T\206.'0)w\210\335\2662\206\f\231\3546\245,\316\3360\263EHn>\363\355\001B\361A\261\370h\316\035\377o>\214\321\332\262\370"
+	.string	"\200\242\247g\371\352\017/\261e\255\2227fi\361\0010%FL\306\003\"\213\001&%\r\0133\3121\317xvK\276\204\271\315\274E\352\317\317\342[\360E\377\031L\006s\233\020X\333MS\033\250d!\271\321\267\227r\035\\ B\007f\361-8\242\377|\227\357\316\"8\312\333^Ru\220\205\330\001\276Y|\013z,y^c\346%\331N\310i7m5"
+	.ascii	"\016.\253\021\013\204\263\270\016ma\003\312\232\305\267\200J"
+	.ascii	"\277\2169\311O\302@\271348)I\030\343\302\226\335*\035\020\b "
+	.ascii	"\311\242$\303e\271\266\274f\316b\227\334\031[\270\266\344.\231"
+	.ascii	".k\311s\231Ke\346,\371M(g\311Q\2644\367f~AS\204.\210\263\223"
+	.ascii	"\353ipR\222P6&\313Y.\331\n\233W\221*}\371J\306R\231Y\356;l\304"
+	.ascii	"\364\225e\374g+\271\312\033\213*\025\026g*is-xX\374 0\372\317"
+	.ascii	"S*3\307\2510\322f\313\342,\345z+\230X\264\b\352\242\037\024\247"
+	.ascii	"s\233\276k\346h\323\017z\242\037\304D?\210\251\377\374\344\316"
+	.ascii	"H\303rf\213\305\017\032\323\231IV\343\t{\363\001\305\342\347"
+	.ascii	"&\377oP\020\302\005\212\3058\315\316\025\341za\3613Z0\314"
+	.string	"\226\0233\213\237\317\240\004\236\261aq6\323PA[\034\340\344h\263\252b>\233\375\271\210\245\321B`\0335\026[f\316\226*\315%\026?\350\206~UR\363\326\363X\336\312d$Pm\030\037\340\370pt`\361l\034\221\201\307\314\330Q\026\347$9,\213\37577S\\\330\341\260\370A0\364\263\022 uD\216Xl\353\251\344\214\344\031\354\277A\307\226ON,~\320\013\375\374\225\217\3747\267M\226)+,~P\n\375\354\365\377\346\004x;\224X\234\215h(\2404\034\334\2149\323\323\342z6\362\347.\334W\361B\340\242\212\212\214\305\301\352\223s\021\241g.[dmn\316\342\235\352\223\0174'DH\036r\023\206K7\315\311\b\313Z\317C>\320\"\306\214S\3013\340\304\264X| \267\037?2\020{\265\367\206\332(\274\200\3155\371\276\230\331\002$\310\216\027\231\232&\026\037h\254G\217k\325"
+	.ascii	"\260(\\A\"eRdY|  YYW\r_\330W\037\016\025;-d\026\037(\307\216"
+	.ascii	"\035y\352fo\261\374#\214\224\21359rd%]\30106L\344t<[\341 y3\360"
+	.ascii	"\252X\300\230\242\303\342W\340%W\345\252<E\002S\366\332\021\366"
+	.ascii	"\225d\212X\236\217'3fd\0337{\211&wi1q;\314P=\3338\2714\377\002"
+	.ascii	"->\232\\\343tBE\345H\256\221i\004\243L\201Q#\330V\327$\205\305"
+	.ascii	"\257@\210\3161r\214kU\367\356\342\221RW\301\215\274\314\313<"
+	.ascii	"\365\263\204)\247\307\2148+y\252\313+\313\205\305\257`*\273\310"
+	.ascii	".r\024\237P\027S~"
+	.string	"\361\034u\2634\223\205\252\202\246\314\"\2638\333r\300Q\220\225Y\311\224\203d\n\0308+PPg\033\231*\375#\205\233\226\305\247`,?\345\247\334\324\263\235\364\376\2706\025\325\206\233\2764M2\213O\301\017@\300\3344\007\207\332\210r\241\264\370\317L\317MC\376\226r\026\347}\232Q=\371u\261\370\f\274!\220\263\303\272vx\211\027\225\017\213O\001\2144i\316\2776\f\202p\251\302\346\347\037\016\220 V\224X|\2529\375\202]oJ'~kn\3240\363\025E+\205\270\350\321\207\2318@jh\321\261\331\373\336y\246\3660\235\354\222p\355M\265!\b(fn\237f~\236a\362\327#\317\342\223\314Y\346\377\215N\214\035}ne\370\272\210D\325\370\332\026\215\330\236S\023\023\321\213\"\363\227\367\345\313\231wD\007LS\017\314\211\3673OG\331\204\206\314\342\023\3149&\313\211\030\032c\304\300\361"
+	.string	"\322D\365WU\006\314\031\006\263\370\302\n\243\373\301\242\377\323\313+\363\364r\026\321+\366n\242\372"
+	.ascii	"\007\247c\245E\017-\213\377\263\246\353\352\356_=\333R\032\274"
+	.ascii	"\246\2764\373\366\246\332\300\343\347\003k"
+	.ascii	"M\022\272\323\235hz\357\315\304\334RAK\272\350\fyRA\303\007\026"
+	.ascii	",\347\026\267\036Qp\232(\317\374\330\242\205g\033\251\353\241"
+	.ascii	"%\013\031\251\246Y\0266bjr\314\3258':\206\234\261\370?Rq\217"
+	.ascii	";\345\354\336{s\241mwK\232\233\n\307\2063\314\232\326\335)wZ"
+	.ascii	"\t\023\203\005\214\225\263J\336W\240\227\037<jVs*\250\334\034"
+	.ascii	"9=\342\322\264\261\370\031\3744\034\334)\245\356]\346\003\216"
+	.ascii	"\r:@\300\322\326\234Rn\024Y\21727\213\237!\017\312\351\006\345"
+	.ascii	"l\313{W\346\225\324rS-7D\211r\266\325\275L\223\255\354\240\332"
+	.ascii	"pF\321\0302\306\366\263\r\245\362e\204\212\331\217#s\200\026"
+	.ascii	"?\303\234~\0064}[UO'NlUen\251\fG\340\344:\310q\314\277\025\026"
+	.ascii	"?\003\226\376O5\346\251\206\365\360\371\264y\020\341\332\233"
+	.ascii	"\252\003\234\262%V\330,~\006\034\372?\231\374 @\250\314\223\211"
+	.ascii	"\265\222\302IQW'\243oo\271\016t\326\230\255\021\323Gv\262\023"
+	.ascii	"\355={o\247\275u\344\310d]g?\321,\2203a\246X|\226\235fVrH\001"
+	.ascii	"c\306l1%\305\0251pgJ\322\316%\370\212N\023\326\2154>]\364\177"
+	.ascii	"\2121O\261\233\206\231\316\366\024\216\212\2632\032}{Sup\252"
+	.ascii	"A\323\003\317\342\373x\351\237\\g\327O#?\215\234J\352\336{Sm"
+	.ascii	"\2462\037\314M\205}\365m\252\345\206\377<\362S\311\231d\006W"
+	.ascii	"\025(\213\221\234`\325\fME\021\213\357\343\003\311\371\245c0"
+	.ascii	"o\3108\277N\257\273\306\204S\336\262\333\345\253\312\212\305"
+	.ascii	"\367\251\322\377\353\355\237w\323r\357\r\343d\356\245\223N\376"
+	.ascii	"\353\353Y\353\206\177\247\336\032\200\377\370G\001\003{?\235"
+	.ascii	"\t\263\367\256g\264\227[S\225\006\373\244\333"
+	.string	"\373\t\213\t\002XSOX5\224iXS\027\224iX\233\351i\213\351\302rc1)\323\366\276\360\364\304$\342jJ\231\326\264/(\323\366\324NQ7U7\023\213i?]\355\013\373i7\355\264\253)\r\224OXS\312\264\246\251\013\3124\254\251\235\206\265{\366S\323r\305\323^^\330iX|;\355j\252G\231v5\245L\303b\253~,\302h\310 \023&\310\226\332E\371\264\243^\340hZ\366\320)\231W;\314\336u\rj/7\335\336\001\330\033\307\3252LS\215\372\346D\027\345\024\245\351\2522\367\336A/\234\262\256\366\023\035S\335t\312\257\253\275\277\234\214\366\213\275\367\376\200\211I\267\203T:&\0368\266\013\250\275-\330\314\275_\354\315T7\335\336\233i\357\215.q0\367\276\321\243\344z\361bo*\240\027\033\007\023\034\324\336vm\314\333\2242-\353J(8I\344\361hX$\216(Z"
+	.string	"I\274 %\201L\217\206\226B\024\0251h\201\004\2424\211T\022\001Q\004\222H\242\322\b\226PH\223\303#\245\241\243\341P\006\311\241\361\310\304y\243\016\311b\212Dt\034\032K un\324\241\250H<&\221\024\034\035)\025\213\306\"\232\024\246-\020\2219\231\"\221R\244|\243\016ir\250Bz\224\2044$\221LI\\ \231\216\300\3233\"\005\023\222\304b\t>Ib\261\204\235$\261XB\206\3430=\nq\"%\322FH\245\024N\244D\304\023\251\b\242\343\220\2508L\2228\221\022e\270Q\007\344\321\321p\310(9D\362@\002\343\321(i,\242&\206\351\021N\"\213\306\241\323D\262H<\036\345\033u\330"
+	.ascii	"9DL\"\211\311a\222\004\013\310\341\n\307\364H\211(5\032Bj J\217"
+	.ascii	"J\f\221D\021Hb\317\215:x0\022+\3107\352\220\26204!\3440B\312"
+	.ascii	"\302\320D\360F\035\204)\0221YT:z\0302\221A2%\201s\243\016&\254"
+	.ascii	"P\002\t\017\032\2600d<\n\221\036\215!x\226\222\214!\2047\352"
+	.ascii	"\220\244d<\026\t\217i2E\032\036\207I\036\206\0060TT\032\221s"
+	.ascii	"\"\205EI:Ia\261(\351,\026%\335\264\005\"\022/%\031\207\3601\231"
+	.ascii	"t\277\263t\024\372\020\245(Q\212T\302H\364\303\344\220HX\224"
+	.ascii	"\324!(L\223\303#d\252BQ\222\005\310$\021ir\250BN2\035a\005\242"
+	.ascii	"a\252\002NQ\221X,*\2510\002I\024@P\232L\217\222\220"
+	.string	"\214!F@\0223\340\321A\344\217\320\b\021\031\206\210H\303\342\222\b\013@\b\031\r%\215(d\240 x\001)M\"\227H\\\030qt\244T\3441\221d\002\005' \225$\260\323\363\241C\3628L\352PT\001Q\232<\016\223$\220C\r\024\025\211H\307\b$\221G\242\t\r\316\033u(R*\221\022y :\"*\225H\211\214'\024)\225H\211nF@:\032M\034\323$\nn\324\341\002$QJ\304\363!\3421-\246E\372\037\204\200\200\020D@\201^\204\005|X\300\207|\021\026 $\264\200\020\204\364C\020\272\311\244\361\270T\204\205rRa\232\264\264\002\206THT\002\013\310\341\n&\206pRaJd<\341\230&\245i\t\035\244\220\350\310h\204L\217F+$\213)Rz\302x\202\361\270T\244\001\222\261\230\022\t\207\212KH\036\023IG\3024i)\211\241\005#\241\211\244\243\236\026\214X"
+	.string	"\341\2010E*\005S\244\222\320\230\314\021\022\002!l\301(\003\b\241\t\023\306\244\322P\322\204\021\211\034\"\026\215H\307\241\021P\013F\302\"\021\351g\004B!R\322Q\230,.\211\b\"uN\244\"\212\306\234\fI\241O\022)<\022M` J\217\216\210&r\222E%c\210\034\024)Q\221x\")\221(*\022O\030\221nR$\321XLE(%M\030I\030\217KE=&\222LH\256@$\224L\312I\223\303$\362d\241\206P\301\246\311a\222\204\220\361\270T\204a\347\230L\301D\222\tI\023Fd\217\220\220O\362F\035"
+	.string	""
+	.ascii	"b\311\"\205DC\245\021\020K\004?\224\260B%,\210\022VhhA\f\255"
+	.ascii	"\020\n\013\002\205\025Z\262 t\216\311\024L\364\024G,\035%%E\240"
+	.ascii	"\270$\342\230&\217\210#\214\206\222\306\342\317\215\220B\343"
+	.ascii	"q\251('\205 <H\221\210\311$\243\321\204dZt\034&\203&B\210\210"
+	.ascii	"\300\225\364\bE\305!\035\244\260\004\361h\030\302x\\*\272\200"
+	.ascii	"\244\204\274\311\033u@\032%"
+	.string	"\207H\036\212F$$\343PQ\210t\221\302\023)Q\022\211\236p\002\t\242#\243\020)\223 AZ\024\"\345\343\360\304M\336\250\003\001\222;\305\021\311\024\231\036Q\244\020\003\3210UA)\t)\3031\231Bq\3041M\"\211E\251\ni\222x\324\200R\022\322OqD\232$\036I\200\026\215\304\344\360\250TD4Q4\206PJB\352I\022\213%$\211E\342Oq\004\3210=\346ar(\202h\230\252\020T\034\261sL\2460TT\302\200\361\2704B\005H\341\211TDqD\232\034\022%)\351\033u &Q\244\026\034\323#\242\342\220\004b\022E\352\223,\232\260H\341P\252\002\013C\303\022GG\303\020\304$\212\364\0021\211\"\305I\244\220\230D\302D*\"MZZAXB\n$r\322\241\3420\211,\022uRh\201\022p\221\230B\0219\224\211I\310{\243\016H\245\022Ha\b\020%\344\204"
+	.ascii	"Q\302\rQF\"\323#\021\321\020\035\002A\274J\302\023)\021R\251"
+	.ascii	"\204F\n\323!\342\211T\004R\251DN"
+	.string	"\232\264\224D*\225@\221J%nz4\034B\236\306c\312\001\343q\251H'\205 <H\026\211(J\202\241\n!D\340$\205!\b%\213D4=*%\207\3074\t)M\346\230H:\272\251p\247\005\022*\220&\207*\030\217KE9I\241\b\311\"Q\tE&\031\217\"\216)\021\361\004Q\204R\022\022\317\221\321(\001\341\271D4LU\030&\207D7I\036!z\243\016\311!\245c\022\t\002)D\221&\225\220.\2600d<\022\ns\262\250d\034\022\n\321cZ$\201Q(D\221\307\024\251T\024\n5Q\221\310\202P\230\221Eb\022R(D\213F\"\222x\224\n\2057Ia\022I<\352\271Q\007d\232\264\224D"
+	.string	"Qz\034\032!\021\340\001\231$\226\360\240T,B"
+	.string	"\n\245\"\361\b\001\037\204 \fA\004\024\036R\"\245\243\241\"\321\303\021\251\344A\001I\024i\361hX<\246\311\"QH4L\217F\311$\241\260\202\023\3511I(\314I$\361H(\314\303\344\220H(\314\307\241\321\020N[ \"\205\302\314\302\220\361\b\247\302b\021\361h(\f\026\213\210G\0210\036\227\212n\2227\352\240\224\204$4\036\227\212\206\206\206\036\220\307\364\004\361Hd\200\033\223\322\243\207\244\321x\364\220\223\nU\370"
+	.string	"\302\207\020\224\222\220|\212FbR\351\310\210L\2178Ha\206THB)\t)''\217\224\220\251\nE#19\224&S\021JIH\030\222\302\242\341\nF\"Z4\\\201\230D1\201d\261\004\245$\244\235+@\001!4\300"
+	.ascii	"\n#\350\241\016\306\343R\221\007\344\321\210,\246H\017E\342\020"
+	.ascii	"\311\303\320\021\351\241C\320u\f\035C\3278\206\006tu)\003\354"
+	.string	"\333T2t\rMC\256L\215\031\r=co\021\243\266e\251\264\370m\221qBa\262\024B\226\026_\003\"\372\3270\330\362\333\214 _\246\354\021\313\204ES\215e\346k\002\206\267\246\245\246$P\306E\017\035\225\325\350\360\263\323\302\374RK\362E\273`B\233\364\265\301\320-P\345\224\233\225\024\315\342E\326\021w%\215^\201N\341\314Y\201\022D+\357\025\272-S\320X\254\2414\224~\002\233\n\373J\242\201T`\240~z]\342\310^\332\351\372i\213\315*\316\342\243\321M~S\216\034\321M\232i\t\232@\031a\230z\312\027\323M\357\233\245\207\227_\236\305\317\200\017m\203\2669\333\336\323\004\326%\0039\324\017\365C\331\0341\013\373J\202\262\3212\203\332a\3613P\242\177tMS\225a\247b\211\366\235h/\326\276\322\324\240Z\301,,\272/i\270\212\354\215q\262\030\345C\371\32037{Y\206"
+	.ascii	"V\370P3G\317\\\273\033eS\234\234\305h\231\fl\350\037m\326\030"
+	.ascii	"\343#\243B\346OG/L^\213=4\007>+\023&\247w\236\341\211\262C\352"
+	.ascii	".\017\315jR\007\245\004\357\314\373ad\213\2161\230\r\317\307"
+	.ascii	"\323\227\030|D\371UeE\030lcM\033+H,vC\277\230q\355\275{t\306"
+	.ascii	"\234a[\263\370\031\304`f\240\002\213\362\222\243\202HM\331\241"
+	.ascii	"jA\272%\201A\320\272\263\255\212\314\352\214\3058hf\224\324\240"
+	.ascii	";\207``\215\254\n\027\024\214\r\233\231\226\305<:RRZW\0263\307"
+	.ascii	"\366f\0063\222!*\340\262\234J\372\374\212@aN\255\201\002\003"
+	.ascii	"K\306K\313[\323\346J\325\202c'\265\307%g\005'\357\r\r\231\305"
+	.ascii	"L\034&kp*\320*\027\210.3\"d\005J\005\215\003\263\321\325eq\345"
+	.ascii	"jS\0038\305f\361\203Q\246D\245\240p_y}O,\006J\242\307d\206\276"
+	.ascii	"\235Ev\264Pcs{&\343{\372b\263\330\211\023\224\255\252\331\251"
+	.ascii	"\031\313bPXxE9"
+	.string	"\312\266wN\231\313\032\263\030}\202B9\265\256\254\220@\261_E\242\212\240\301\240\213\222\243bJP\265\373Eg3\235m)\324m.\315W\337VRm\3101ka\326\345\354\250\332\321& @\270\236N\202\344K\223\305(\223\007\251\264HiZ|\024\rM\373op\274z\244\201Y|\f\316\364\021\240\317hLMY\214\232]\357K\317\005\237\305(\363T\250\300\364\375X\262%\313\316\311bt\f%\253\314\317\241eg\362\004\245\250p2g\3611\020\323\257\237\313'\250\237\313h\330\215\024\035=\260,>\372\344K\025\327\227\021#(X=\333R\031\r\255\214\\\237\265\352\222\242\205\344(\330m\212\300E\032,\026\243G\002\206\267\2503\222\243bT.\345 \210:\244\f\325\214\314\246\031\003\223\025@0HL$\223L\226\305\365\023\200\004\214\313\224q\240&\031SfHFD$\005\005)J\226\003\013E\210\227"
+	.ascii	"_\300\214\367\247\306sH7W\350\276\007w\224\234\200\227|\030\347"
+	.ascii	"\370E\n\273\206\247\237\334\365\255\220\266\273l\036\357\233"
+	.ascii	"$vWQ\232\306\353\001\375\326\214\027\361\020\343\351\336\274"
+	.ascii	"\317\266>\263\247lD\013\026\365MQHlE\353Z+<H\350\020\017\006"
+	.ascii	"\221\217u\214\247\022\026*q\234\030\324\017\212D2\022\372\233"
+	.ascii	"\036c6\037\024\223g\352\327\373\247\270*\332\2261^5\275#}\315"
+	.ascii	"C\377\023{G\217\364!$j\222\001\315+\034\272\265L\240_\245$I\347"
+	.ascii	"GHt\355\370\244M\325\2620u\365\r\315\257"
+	.string	"al\240#&\023\273\270\257\365\360p\007\bT\017{R\375yh-\f^a\364h\210\214\005\035t\t1\357l;\250\253\222\211\210\367\002D&\245\235\314\027\003\3525\360\343\204\360K\267\fe}vMv\370\363\1771\212yec(9\265$L\020\202\261\234\305R\325\360.\245\025t{\034\303\270\207Ux\323-\221\f7\016\315\264\335\3456\262\032\021\ff\235\207Np\233\214N\307\313,U\261\320\221\305\244\032\002\367\351\372\033\347\035Z\335\370f\203\373\002\007\243i\303\341\226y\341\3312\222?$\204\260\317\250S\346\227'k\274~\3561\3755\003\232`_\f\020/o%t!\322#\277\333Wn\036\327vm\016\\R\304`\311C\224x{\030tb\231\346d\316Z\016PC\242jn\300\230\b\305sI\023j\035\366\303\347,\001\334\257\023\371\232:)w{!s\242\214\2342\336\310K\027$\372\3570\202\004"
+	.ascii	"|\t\004\344n\345\207\350\347I\275\361c(\355(n\336N0\334\317b"
+	.ascii	"\n,\321\t\347\224Q\257\005H\277\242\274\035\326\260\323P\204"
+	.ascii	"-&\024\204\311\261r-d\tg\337\231\341\346`x\355\220>\211w\201"
+	.ascii	"\360\203p\367\213\037\223W\215\206\006\240\371\\\376\250\024"
+	.ascii	"\215\024\217P#\037\315\013\203\3433G\215 c\025\022B\002i\205"
+	.ascii	"%F\340\246\275u\377l\n\221\335=\002\225hV\306t\214\236\342\215"
+	.ascii	".Te\323d>\260\200\346\265\236\203\024!\244\243\003\221\320}\250"
+	.ascii	"<Z\306\230\363\273\211J\370\253\343p\022\345\020\333\034\302"
+	.ascii	"\025\261\200f=\330\2669XA\271\267\245\263w\035\300P8\337\244"
+	.ascii	"\005\351=\373\270\227b}\276)\220\305\nR\302\037\340\327\202\222"
+	.ascii	"\237\334\212\223\347B\210\f3\177<\376\265I<\360\275u\373\\\334"
+	.ascii	"s\375R3\b\\\326\206\026\f\223\350\327\"!\343\217\232\261u\221"
+	.ascii	"\334\346|\212\315K\205\203\001_\301\013~\327s\255\315\2759\351"
+	.ascii	"\240\310Z\037\2507\222i*8b'o\330\316q\003\017\360W\252\226\256"
+	.ascii	"$\267\317R\242\220\314'\237\030\025a\023\315\022\006\362\326"
+	.ascii	"\024\214\301\315\335\376"
+	.string	"\215\367\270\267f\237_\236\265\276S\030\374\333\337\316\266\340\035\314\367\030\f\314\r7\355\240J\367$V_\274\247fI\216\300\316\233\277\177A\220\275kR\004T\351\377cp\234\\\222AA\360\370\372\217n3\024\256\205o@\3265\260\037\262\272\f\023\337\257\001d\254\3623\377\201\322\342t\210i\374?f:\317\220\301\301\274\332\035\005\231\222n\336zy-x%6\017\376\334\234\005\250\374|\326\207\213\230]fX\346%\246\243\026W\213\252Uhw\311K\031\336\327 \226p\313f,X\316\216\035@@lp\016&\265\342\017\215\267[G\377YR\r\257[!\255(\016\033\372\034^o"
+	.ascii	"\333\211\006\020>\270\374D\216DL\362\3065\223\201 \004\025\022"
+	.ascii	"\004Xk\272}\036A\347\253yMTr\027\300l\232fq\006\302\321vY\212"
+	.ascii	"\357`U\333\3359<\364\n\313\247\016\235\320\243a\313\205\024f"
+	.ascii	"\270\212\325\257\001\323\306\370\204\210\r\2703p\271\242"
+	.string	"h\256\333\361\326\224$\006\203Bn0\0234\t\260\3412\220\260\266\275-uD\263\007G\213{\344\262Ypl\301\330>\r\320\201\210\206\004\017\322 \307\3547\351-\303p\265dx\352\030\270\0077n\211\364|H\213\032\3218#\026\204\031\220\206\317\301W2\214\f\203\202\335t>\027\266\2055\371v[\344\225tU\347>t\376?\231\035\226\022\220\215\335\210\350\213\026\241\3148\337\266\004\f\0032\322\004B\377\263\225\366\277E\277\354\221s}\334\237B\217\356\247\310&\001\264\035\370\006\214\217\327#\360E\005\371\230\bc/\212?\256?\351\022\265kP\027\335\244\303\215\340=Z\270@n\0049\360UQ\307rAR\013\021R\250\013)u\347.\001+$jC\226\177\330\210\305\243>.0l\2006\"\203&\224\233Y\253\013\235\243\357P\224\022\324\345^\221\3272e\f\315\374\005*O\\\223\254sA~\351\334\r\330A"
+	.string	"y\364\341F\345\200uU\204\3050\034\276\267\026N\277\207S\005h(\026[\367\026\357N\2755\332U\236\253\337DW\214\310Y\227\227\t\217\315k\305\221\035\350\257\013\361\313\tV\013 \2462"
+	.ascii	"\242\355!C\353\325{\330f9\211b@\007\275j\306\003\273\310\331"
+	.ascii	"\3511\336\033\2016\301S\2215\n\244M\211G\265\205\240|\350\367"
+	.ascii	"\353\323\244A\022\227 \302\247\f\001\343\353\021\036s\232\ft"
+	.ascii	"\215r\222\334\323\024\353:H\220\220wa\036\231!\211s\236\0216"
+	.ascii	"\314?\250\t\2015\342\244H\026\017\354\341\217\177T\322\211\217"
+	.ascii	"@|\246K/\324\237r2)\267\332B\323\305T\257\340\351\327\356\226"
+	.ascii	"\251B\216\240\276\007\346za=\213\035\206\301e)\r\364\324% <\177"
+	.ascii	"_\031\275\345\314\364\031InKk\272\021\201T\271\301\013Nu\376"
+	.ascii	"\035>\261Q\323\032)\236\351\017\320\253\337\017\242;\020A\215"
+	.ascii	"\t\315[\271\357$xD|b\006k\213\266\320\330\300\254\240\210\356"
+	.ascii	"\264\373\251p\024 @\273;M\033e\216\331\361\035R\303\223\270-"
+	.ascii	"\305m\016Y\300\005H#J\346\024m\271\201\243\316>\034\233\327\372"
+	.ascii	"DJ\031\323\266\337\005J\327\n\227\242\216\310i\203[\021\271\035"
+	.ascii	"\273A\235\230\316\260\3411\332z`\2013.\222\027\3104=\216\022"
+	.ascii	"\202n\227\2779]%\360g8\304g\230\273\204Ww\237\276\003\227\030"
+	.ascii	"\261S\360\372\307Lnb\r\252\363\033\b<\317\n\t\221\3733h"
+	.string	"\373\0055\3273v\t\221\235\317;T\032\003\213\330\2637\310n\345\271\260\3225l\252\271&\247qh\222\033U\325c\364/\300\0020_\337\275\307\265\nK5\277\335\023\247\256\031\252DNsY\212c8\316\241A\032R\313\243\305\304\025\233t\374K\374\237\260>\310`\\\rZ\304\310V\352]L\215,0Q)\251D\276\251)\021\n'\016r|\237\307\352\343\220\242\251a?\232\027\270*P\271<\334\371\305>\013\224\035\313\375{\326\nd\205\246\020N$\370\372H\330g&\017p\345\227\357\362b\241{ZH\204\315[\357\177\316?n-\261\031\256\246>\251c\343\324L\356\027tX\001#\350|\346\301/\026V\343\312\346\034N\242\031\001W)\264ip\tN\356\253|\013\234\221\325\266c\022\363\354\027Q\316\234\355\257\241@\271\352\235\205\023\334\027\247\270\254\314\253\366\334p\024\366\303\027\236\013a\305\t\234\036`P\273"
+	.ascii	"\320X\240\017:'\b\243\201^qJ\373\215\375\361Y\360h/\332\375\214"
+	.ascii	"\\\322\247\321\370\221\r@\214\017S\254\363\355\204|\247\022o"
+	.ascii	"h\217\222\t\007\227\240\242'\211!_\234A\2620|1K\277\301\271&"
+	.ascii	"\201\212\232)\315\320\332\222O\245\355\226/V\233\\\345\346\260"
+	.ascii	"\271V\277\234\362\335R\356\034\367\273N\376$L\034\034\026E\267"
+	.ascii	"\342\307!\371\226\255*\3702|\240\351\325C\\\\\224\272\226M\037"
+	.ascii	"\001\003\024\366s\311\341=\002A\004$0\020\034?!\343\022D\366"
+	.ascii	"\376p4\030\n\306\337\300\250~\220\217\241 \201\200\336\n\215"
+	.ascii	"\267|\b\340\242\377R\013xa\323\034\031\242\255\335\noO\253\232"
+	.ascii	"\025\334V\231\021\337H \307\375?\002\366\367\244"
+	.string	"\323\245\325\001\017\313\366<\234\314P>\317\302M\217\323w\350y\205N\330>6\365S\364\256\2360\0240\210\322y\220\320\375\030\242\202\371\240\350\340<\222\300\205\301d\330\016\034\262\020\376\361\362\207\331Q\002Iv\307\004a\313\310\037\0362\336ev\205\340\215\310R\307\203\031\004\363Y\214\370\303\251\321\327h\037\371?i\376\206\256\\P\022\220Er[;\304rT\323?\254C\321\362\256;\205\267!\372o\007LJT\315\376J\0076_P\351O\346\005\327\314\375Z\230\312[1]*\234\365\205\034\246\035\365(d\005\026'2\021x\023dB\232]\204{7H\372\366\324\324\033\241\207\244\251\337\317\363\371\207\270U\353\b\363\267\t\037\021\005\212\322\"\230\334\230\016\033\"\303\n\254\271*'\r\210\016\r\334O\202M\313\0225e\307\211\324QZ\267\203\337@\3717hx\257\367\304\035\033u\031\373\037H\232\332k\303Kg!"
+	.ascii	");k>\271\351\035\247\276\232\263\372\306\250\022-\330\231\252"
+	.ascii	"\354\265odn\373\030i\305\315,8-t\0244\221P\022\210\331\376Ii"
+	.ascii	"h\253\371,\237\030p\\\371\243\273\211\362\211p\312\333\341\200"
+	.ascii	"u\322\337\273&\240\007\232\322n\346\347 \312+-\037(\361hK\323"
+	.ascii	"-\203\217\367\262\021d\271\034\232\b\030\276\027\342\314`\263"
+	.ascii	"\212k\262\353\210m\007\352\232\211\355C\326\262\217M\215\272"
+	.ascii	"\215\323q\354I\263\341\350\374\357\371\331\021@A\027u\342U\306"
+	.ascii	"\n \275\375p\374b\324\277\261\"\351;i\204KlK\203/j\367\225b\205"
+	.ascii	"\251\266\224\241%\331\325\216\t\210\031s\201\306\243\376\004"
+	.ascii	"m\230\032\210\360E\311D\360l\314\036\204\245\242Yy\031\3164s"
+	.ascii	"\205@D,\341j\005\204\206)\372\301\3746\226\364\377\266\353\f"
+	.ascii	"\335:\323\352\213&h\207`\264\3408\264\261B\311g\214\215e\331"
+	.ascii	"p\317\261\325\352\036\336\225q\241\322\3040\003\002\235 x\013"
+	.ascii	"\354\024\\#>\0235\f P\301\002\216H\252[\204\345p]D\362\245\245"
+	.ascii	"\032xF\300(gA\006MT\254\374\211\003uK\351\340q\fB \204wj\310"
+	.ascii	"*\026\262\220s\360\337^\363\370#\307\037\367 \207\001A\374\304"
+	.ascii	"~E<\036\370\016p\203Tz\311Y\377\b~Ujm\207$s\251}\265x\325BRN"
+	.ascii	"v\223nMu\b\n"
+	.ascii	"\321\030Q\327W\372\3608\242\017\363>\0356\265\357\232\352\261"
+	.ascii	"S\2406\016B\251p\311C\251D\210\356\323\271G\243\303b\003e\266"
+	.ascii	"\336\304t\345\260{u\274\222\305\212i\320X'$<\302M`\334\001_\241"
+	.ascii	"L\356\f\325C\021\035Hg+\363\243\241\330{ \230@\f\362\237\006"
+	.ascii	"I\316^2g\023G\361B\020\3024G\230\242\224\3533\335\302\236\031"
+	.ascii	"\376\234?\211!B\007\024\242\234~4\245{\346\342\3617\224\206\246"
+	.ascii	"\313\346\004\345\201x\253\031\303\320\275\305\344\336\025\201"
+	.ascii	"\320\360\352l\250\333\035\374:,\367(\221\206O\237\301\341\356"
+	.ascii	"\243\333\247\320M\246\340\306\301\203LzE\253\237\225\376\273"
+	.ascii	"\323\337\231\024\251\214\235\271\r5k\265\027\304)\324D\375\210"
+	.ascii	"\002I\316\225\344\324\037M!u\r\"\031\nQ\364\324Eo4X\200U\350"
+	.ascii	"\361B\257\232\354\021\036F\f\334\033\375/"
+	.string	"\202[\214\254\233\370\030\n\n\376\262/\303~X\325\356\246Q\022F]\247DbC\037\370\tAi\225\376\t\373J\037M\336tXoH\233%\001~\2073w'\346\210\372\016\037I\265\376\362;y;+\262\333\230\2739\341X\327\3601\277\214\376\217q\001\222\337\320\206_\341\033\033\037\374 \312\207\230\226\365\020\352b\356\321\350s\t1\346\335T=\3435Z)\312\313\310\303i\036\3155\315\370m\233\023<\345\332`\367\365~n\026\227\3147\263\276(\352F\244\354\212P\313x<g\21671\364\377V\277;z\235LW\352O\276y\005\347\207\341tw2.`\320\257\211~\032\t/\030?\026\271u2\302\363\023\275\004<\376^\370\300p\244\306\230\347\346.\253q)\003\274\257\224\277\177Z\177\306'F\2735H\332\370\234b\273\352\346\233\306\032\221\326X<n8\344\316\340\326\001_M\273p\302\177$\003no]d"
+	.string	"7\274\315\003g\027\362\245\305\263\323\335\311\267S\360\371\362\337\343\266.\027\372\244\342\224\330e\211\243\354n\351\207K\321\366\304\361\303\031@\242\3626W\357f\3129\343p\374\322<\2125\006r0\271b]\003M\017\347\363\253\030S,\313\263=cc\2141\035\377\215b\255\2763\353(\0261\037\235\326\362lz\030\035=\354\366(\322H\274\3054\357\200bB\377S}\2713\216]\361\301\243\223\005w/8\334\224\223[\337&\316m\021?R/\261\314n\347\325\300\267\342\375\365\375\316\341\207\354\344\024,\004\275\253\321\273\357]\276\243\221\037\300\265\227\250S\346+\235\017\234\2023\234\327t\247\202^\260]\027\300\307\372\211)w"
+	.string	"-\240\236c\371\305\270\375J1"
+	.ascii	",\276\340D\350[\306\364\234\257J\347\305\360\362\236\211\305"
+	.ascii	"#\375_W"
+	.text
+	.section	.gnu.lto_.symtab.a5bf0a8a39e58656,"e",@progbits
+	.string	"gyro"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\002"
+	.string	""
+	.string	"firstArmingCalibrationWasStarted"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\002"
+	.string	""
+	.string	"gyroSensorBus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\002"
+	.string	""
+	.string	"gyroMpuConfiguration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\002"
+	.string	""
+	.string	"gyroMpuDetectionResult"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\002"
+	.string	""
+	.string	"gyroInitFilterLpf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\002"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\030"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\002"
+	.string	""
+	.string	"gyroInitFilterNotch1"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003"
+	.string	""
+	.string	"gyroInitFilterNotch2"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\003"
+	.string	""
+	.string	"gyroInitFilterDynamicNotch"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\003"
+	.string	""
+	.string	"gyroInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\003"
+	.string	""
+	.string	"gyroInitFilters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\003"
+	.string	""
+	.string	"isGyroSensorCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\003"
+	.string	""
+	.string	"isGyroCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\003"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\003"
+	.string	""
+	.string	"isFirstArmingGyroCalibrationRunning"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\003"
+	.string	""
+	.string	"gyroUpdateSensor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\002"
+	.string	""
+	.string	"gyroUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\003"
+	.string	""
+	.string	"gyroReadTemperature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\003"
+	.string	""
+	.string	"gyroGetTemperature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\003"
+	.string	""
+	.string	"gyroRateDps"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\003"
+	.string	""
+	.string	"pgResetTemplate_gyroConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\003"
+	.string	""
+	.string	"gyroConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\003"
+	.string	""
+	.string	"gyroConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\030"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\003"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\003"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\002"
+	.string	""
+	.string	"nullFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\002"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\002"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\002"
+	.string	""
+	.string	"firFilterDenoiseUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\002"
+	.string	""
+	.string	"biquadFilterApplyDF1"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\003"
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\003"
+	.string	""
+	.string	"fakeGyroDetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\003"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\003"
+	.string	""
+	.string	"isArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\003"
+	.string	""
+	.string	"schedulerResetTaskStatistics"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\003"
+	.string	""
+	.string	"devStandardDeviation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\003"
+	.string	""
+	.string	"devPush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\003"
+	.string	""
+	.string	"devClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\003"
+	.string	""
+	.string	"firFilterDenoiseInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\003"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\003"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\003"
+	.string	""
+	.string	"biquadFilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\003"
+	.string	""
+	.string	"filterGetNotchQ"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\003"
+	.string	""
+	.string	"gyroSetSampleRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\003"
+	.string	""
+	.string	"alignSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a5bf0a8a39e58656,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
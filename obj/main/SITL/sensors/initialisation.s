@@ -0,0 +1,405 @@
+	.file	"initialisation.c"
+	.section	.gnu.lto_.profile.91041dff02f3d3a9,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.91041dff02f3d3a9,"e",@progbits
+	.string	"(\265/\375 )-\001"
+	.string	"\370\035"
+	.string	"\003"
+	.string	"\314\324\377\306\r\004\002"
+	.string	"\002\001\002\002\002\003\004\365\246\231\344\006\005\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.91041dff02f3d3a9,"e",@progbits
+	.string	"(\265/\375 \031\255"
+	.string	""
+	.string	"x\r"
+	.string	"\001"
+	.string	""
+	.string	"\003"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.91041dff02f3d3a9,"e",@progbits
+	.string	"(\265/\375 R5\002"
+	.string	"\002D\016\032\300%\255\001F\343\377zs\255\251\363|e\3373\364\377\201[$!pm)S\337\330\223\352\306\216z\322Hyk\310\356\356\212Q1\024\022\004\303\256\200\035\020\202Ar\005\004\003"
+	.ascii	"4C\247%\224\r\264\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.91041dff02f3d3a9,"e",@progbits
+	.string	"(\265/\375 Y=\002"
+	.string	"\264\003M"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\004\0036"
+	.string	"wus"
+	.string	""
+	.string	""
+	.string	"\001\300\004\001"
+	.string	"\300\004\002x"
+	.string	"\001\002\006q\001\001\006q\001\177\001\377\001\001\002\006(\001"
+	.string	"\006(\001\377\001"
+	.string	"\002\377\377\377\017"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"x\232\245\234\345m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.91041dff02f3d3a9,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.91041dff02f3d3a9,"e",@progbits
+	.string	"(\265/\375 $\365"
+	.string	""
+	.string	"\260\030"
+	.string	"\001"
+	.string	"\002\002\b"
+	.string	"\001\002\t\001"
+	.string	"\002\n\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	" \340\r`\001"
+	.text
+	.section	.gnu.lto_.lto.91041dff02f3d3a9,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sensorsAutodetect.54.91041dff02f3d3a9,"e",@progbits
+	.string	"(\265/\375`J\001\345\016"
+	.string	"\326\233eF\340\2246\035\270mxhxH[>p\356\350qsj\371\301M\230#\304\356\344CRDz\311\346"
+	.string	"4\373\177\353H\004\345E7\320UgWa\025.\235\244X\023\2320BG \034\347\002\314T2<}\262\245L)R"
+	.string	"O"
+	.string	"P"
+	.string	"O\205r\236\230+\304D+\205\340\230\027x\216Y\001\203\027\207&0\233\343\212\241ad\316\225\266,\036^\256\206\376U\2271P\374\020\307\321e\211\257<\320\352Q\244d4I\001\247\027\342UW\021cI5s0\347\264\212#\211\033\273\355\t\266\033\330\237\t\343\f\027\rI\223\274\305\253\305c\027\345\207\235lMF\254\260\3111\351\313\231\332\237\213^\314\266\344\304r\265J;\262W%]\224}9W\306~\352\316\244zW\255\252\376\307\003\020\"A^;d5OI\216L\026\346\003\306S\277\375\342\253\374\t))\235c\266\205\0130;\262\356n\202\030$6\206\343\310\340\231\323\204\342\333\370\r\r\033TT:\307t?57\034\\\264F\n\226\\\224\355"
+	.string	"\372\265C\233^t\001\223Wn\303y\346\234(~\315e|\360]\0343K\247\027\217\371]\347\330w\003\03560\264\201\333\203\316\013\261\002\300\241\023Q\307\201\240\217\003\001\342@N\304i\237\327}\242\355\323D\034\210E\013y\237vb\300]\313\346i`\327y\332gE\272\234+\223m\313\214\nW\213\264%\023\320\335\323|\007\004\305\231\223t\321\216p\035\022\006\340\334<\007\205\n\001\032"
+	.ascii	"2\241w)\360\372\037/2\001l\006\002\006\376\232\374\r\355K\265"
+	.ascii	"\026\300\030\362\310h\200`\004\033\r\b\203\035\253\031\242\\"
+	.ascii	"=Y\213i\304\205\26153\3750\026\022E4\250\210\341.[\325\350\024"
+	.ascii	"M\355\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.91041dff02f3d3a9,"e",@progbits
+	.string	"(\265/\375 \334\375\003"
+	.string	"\264\005\330"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\0026\177\013\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\0058\f =\r<\0055\016\201\204\001"
+	.string	"\017\001;\177\020\377\037"
+	.string	""
+	.string	"\200\200\200\001:\177\0219\177\0227\177\023\003"
+	.string	"\t$\003"
+	.string	"\b\320\360\372\250\001\001\204\001\003"
+	.string	"\007\244\001\003"
+	.string	"\006\204\006"
+	.string	"\016"
+	.ascii	".C\303\031\265\365\006\007j\007@\347\003\271\300\245\006\026"
+	.ascii	"\f\227\037\230\306\022\017\\\003\335\242\265\220\001"
+	.text
+	.section	.gnu.lto_.refs.91041dff02f3d3a9,"e",@progbits
+	.string	"(\265/\375 \023\231"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"\002\006"
+	.string	"\002\003\b"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.91041dff02f3d3a9,"e",@progbits
+	.string	"(\265/\375`\347\023\rd"
+	.ascii	"\232\251X%Q@\220J\352Z\032h94\210\2775\026\236\260af7\177\301"
+	.ascii	"\274\006\305\212\213\345\373\340\221\210\317\217{z\370W\315h"
+	.ascii	"\314?\220\022X\003\314\257\004\272\360\312#\262\321};!}\375?"
+	.ascii	"\033\227\232\214\201/b\210\355F\032K\230A\351326\331;\245\024"
+	.ascii	"\021\002B\002:\002e\336\254\204\271]i\265\254\331u\234\236k6"
+	.ascii	"]\327o\032N\267\3515M\327\316v\323q\334jZ\216\275\333\310\230"
+	.ascii	"\251\231\3513e\\&\322\364\230\037\364\377\312\311\025\206\255"
+	.ascii	"\307\364\263\n\202'\\\372\213\371\210\333M\203i/\375$\"\301W"
+	.ascii	"\027\271\377\226O\2248\321n\032M\217\371)\266\257CE\025\036u"
+	.ascii	"CE@d\314\234"
+	.string	"\211\022 e\271\356\240\376\024\271\354V\227=\352\302\245T`\262\266<e?^n7\227\273\314\035\322r\271\233\227\350\331b\332\371\241i\340\022'\030-\212\375\227\317\034\2579q\332\313\375A\355\273\376\240ro]\022\035\344r\363\270|\326\035\324\336\322\\\332\031\242\273p\213\265\032\363\214\355\267\256U\003\231\024\034\227;\204\212\336\335u\b\225U\270A\335!\355\003PK%%\304S\346\316\322h<kg\316ty\312\035\306|\324h\035\245\231\375l\246L\330\344\376\037K\237\265\263\321\332\n\367\2256\343\264e\023\314G\334h=\326e\036n\374/\257\006\210Bf\214\315\356\277-\032*B\221b\244t\251i\177wP\203\232\203\312-nS\351f;\211\272\n\367\224\016\343\235c\373\314\377\026h\307\215\r\220\246\247l\301\345&c\003\304\376\004\027p\271\211T\240&R\231\347\246\315d\356\031\272e3W\376\037\377\177"
+	.string	"g[se\347i\213\035qK\341\240&\253\332\007B\317\264<\311\361\324\375\362\263;\250=\315A\005\321\035\300\230\033J\177\021\241\310(\3457\377[!\2377nNN<\345\266;\250\2679\250\314\215B{\260\002\016fn\303\3347\220E(f6{b\356\325\006s\263\314\354\201\231C\374\230\331"
+	.string	"f\267\302\334G\34662\267\n\314\235\002s\017\231\233\211\271I`n%\346\216\301\334\"0s\025\346\016\201\271A`n\016\230\373\003\346\306\200\231\3430s\026f\306\302\314_\314\034"
+	.string	"3\2571\263\337\335\335\3351\363\2239]\200\031\bK\3133Z<\315\263\264\323\325\034\215\335\212_\251A\315\315\334\353\t\234\234\253\371\231W)F`\206G\235]QJ\226$m\313M\231\367u\231\267\3442\257\3532\257\310\345\375\031O\310u\252n\230@\234<e\236\217\33354\361\266\212\217y\322\225xpB\246X\276\344\326\242\332\313\017\357_\031\306E\346L\227\342Q\\\314\251\370\024o\266\323\307\374\331\2278\223\276\342c.\005&\327w\316\236\203$[\301\241\204\314\300\3457\306\034\207C\365\263\252\375\035\033\314|\2313\273\377v\347G\023\f\013\200\324g"
+	.ascii	"\353\266\344\224\272\26500\037*k>\214_\354`=uOr\234\236:\024"
+	.ascii	"\224\255\206!\306'>a\\e\264<a\367r$9\220\264a5w\322E\266\024"
+	.ascii	"\213d\271\234\222\335\264m6\0075\tP\226\242\227\013`\227Mx\227"
+	.ascii	"O=\341r\031\332\351]\276\203=\207\353\340\241\257.\347\341[\375"
+	.ascii	"\254\n\372c\234\331P\021O\027\033X\276\324\224M\370\226+\335"
+	.ascii	"\310OQ\350\177\210\223\353\377\2178\222v\372\026o9\013~\325\317"
+	.ascii	"\346\005L\256\024\021P\224\356P\202EFMcp\255v\272\021/2\324\376"
+	.ascii	"\227\tq\"t`F\374\005\307\362\340\204\274 \215l\250\250\350f\211"
+	.ascii	"!\255\210\232r\332u\231\235\b\f>7\314\222\224\311\362!\033Z\250"
+	.ascii	"z\246e]\346,\316\321ec\315\212\323\370\222\343R\255/T`\236r\332"
+	.ascii	"\343r\232\274\234F]\277r*\377\321\317\346\212/er\377\017\304"
+	.ascii	"\203\264\323\257\334\252\031\346W\336\302\007V\202\244\375 I"
+	.ascii	"\002\005LM\031u\273i\223#\0250\236z\017\257j\247\373p\027R1\345"
+	.ascii	"\373\370\304\001QS\342)\243_\356\t:\254\2462\252v\031\265r\031"
+	.ascii	"%\273\214\266\227Q%\227Q#\227\321\254\333C\250\325e\224\307e"
+	.ascii	"\024\307e\324\351\202\200\343OG\031\300\224-\240\2716\2167\206"
+	.ascii	"\245\226\226\023\373\221\343z\376=x\310\241\005\305Sn\343Ff\336"
+	.ascii	"\331P\267\203\310\0337z\261\317\210i\263\363\324\351E\177n\177"
+	.ascii	"\250\251\030\215N4\\\366\265K\242m\016r\334\364\250\201\241\355"
+	.ascii	"j\355\213\027\271c9\260\306\340\274\331\200V\266d\215\323\207"
+	.ascii	"\314\031)\244\233\rVa^j<\365\272\024NW\022\fJ\033n}P#\025\030"
+	.ascii	"3OY\207kn\256\313$h\276q\212HM\t'\314\356\223\\D\b\035y6\271"
+	.ascii	"\273\354q\355rN\227\363\270n\177J\325JV\211H\275\274\310\326"
+	.ascii	"\250\271\036\347*\\\b\037\2729C\222\236\262\307\215\031\341\237"
+	.ascii	"\351\023\227\326\036\361\324\321\034\261\247\201@K\310\023OQ"
+	.ascii	"\207\343v:\234\207I\215b_d\303\360\250s92M\330\336\332\351o\376"
+	.ascii	"%=\212}1\0028(*\273\377*\021;nA\324\304y\312\352\225\313\316"
+	.ascii	"\346Ov1,\306\335\356\3777\222$\033\031\354\276\252\212h\247I"
+	.ascii	"\222,/O\335\315\333v\272\222`Ey\352m\356c\234\f{\233\367\034"
+	.ascii	"\377\353\277\365\266\364\337\330}\300O\367\001<\265#F)j\312*"
+	.ascii	"\326eu\3522;\263\372\306\344\377\357\340\265\237t\352\341\346"
+	.ascii	"u\0231\3734\332\b0s\372h\006\377\3056%\335Mbf\374\301 \236y\317"
+	.ascii	"\377\343\262(\301r\352\270\354\201d.\277x\334*\n%\177YD2\377"
+	.ascii	"\205\376x,\256P\276\020\222\371So\203\206\251\376vY\374\243\362"
+	.ascii	"\205\376\370F\020\310\343r\n\3114N\t!\231\313\251g.?\350\217"
+	.ascii	"\306\344\215\343'\205\236\271\\\363L\345T\020\222\251\234B2\227"
+	.ascii	"?\372\r\251fn\212M\211"
+	.string	"\005\326Q\220\307\317!eeL\006=\221\255\362\337\376\273\371\364I\004\376\255\224\3117c\217>sz\346p*3*\t\220r\302R\376\361\211T\242\374W\342\244\364\357@\261}~\221~\026\205X}\324\323\177\001R\377\305\376\347\377\027\377_'i\325\376\373\bBrII\375W\rI\275U\021\355\351\337\233pgSH&\226\362\bm\214\311\365Pm\261\271\376m\231\274\314b\224\217bs\271\246x\314y\352`6\2600\327\246\365r}\355GHT\234Y\026/\\\305\207M\217+se\334N/s.\327\ty\377\030\026'\367_%\302\331\202\200\361\362t\013/\b\025\223.e\227\273\305\342^?;\377\001,0\310Bii\375\375|\b\374~>\035V2\372\300\002\203,\210D\037\323\f\341\217g\355\255\330\300JF\031\274`\341b\004\210\022~\302%\244u(D\002r\221\264\002u7\2473V\226X\303\205"
+	.string	")+\260$\024R\320\343\261\277\225]\223\204l\323\004B\374\003\016\327\340*\343\262\003(\032@\221\342\004\035N\241\202\204\n\022*\247Pqt\244\002\305\321e\024G(\313\252\353\260\211\365\rW\246\031\353\213\236JcMB\331\245\t\204C\037\005:)\313JF\f \005\240\263\262\276\245\246\337\222\357\267\303\022{@&\0271\326\025+S\215\027=\026-\\\360\254\277\240\217%\006\201\227\355m\300\"\r\002[\004\211?\025\310DDY\311\210\330\264\322"
+	.ascii	"\016\223\b \366\220J\260\340A*\301bG"
+	.string	"\325\371\225"
+	.string	"\242M\275K\354\255 6\301\340\321\241\261&\021\233`\250l\323\255\341[Z\223zLM\227e\207>\226x\207l\213_\260\251\002\246\r\210=\032\353\212\035\246\246\036\273\312PY\311\310"
+	.string	"bO\0060FP\2104\\\331u\306\312T\203%6\301"
+	.ascii	"b{2|/\204@\235 \361\327\0032\021{\326\037\220\306\232\004D$\256"
+	.ascii	"\303\244$_\357W\002\030\264\016}&$\r}J>l/\205\016\033l\022\376"
+	.ascii	"z\353\022\323\f\037Q(\006\323Ro%\002\205\301\237\245\225\006"
+	.ascii	"\333Cq\304.\371z1~=\341\320\007\203\207\225\214\n`!\323:\034"
+	.ascii	"\301\n\205\303\021<\304\236\312\366J\230`\203\300\246\313\017"
+	.ascii	"<\200\004\242\003\r,\270?\243\240\020\310\372\210\300%\037\220"
+	.ascii	"\005\006\201#\210C!1\270\022G\004\201\276\031#~C\342\b\243\004"
+	.ascii	"\326\031@\226I(\314\200]e\f}\354O\f\244\025\023\b\2075d\334("
+	.ascii	".h\332\350\212\350\nr\332\254T\005\361\264\005\352\321\241CK"
+	.ascii	"y\303\303\354\254\321m"
+	.string	"yA\242F\2407eV\024\324\227\016\232`Z<}r\243`.*\313S\364\210\036\307TAQ\245N\234R\276x\312\027\b\372\350\243\306\026{\035&\224wt\227\b\033\026\226\240EF\215>m\246<\303\272L\r\243C\016\234\2719s\334mH\211\2469\233\303\305IW)\306A6/\3231\235\313\031R\242pvD\033\300A\301\3618\354r~\224l\241}y\352v\016\207\027\201\204\250\2010\210\020432#\"B\222\024\322\001!\005\204 )\241\273\036\021\0201\204hl$I\nRj\f\036\254\205g\023\005\300r\tB\021\013\227\\\200$\274\304q,\266\231\n\206\247[\223|*\322\300\377\343\252~\211\225e|\216\037D%\346_\336p\377wa\240U\007C\002,\206\335\262\2726\210;\372So\341\324)\200T\276\305I\301\247a\016\322\226\261,r\362\217\227n$\372\335\002\034\212Z\034\023\373\217\322"
+	.string	"\034\"s\332z8.\023\0207'B\270\213\"<\353V\211~\220\241?\013F\312\2713\022\277G\f\351\257\360\252\021N\023\337\212\3713\034\247\261"
+	.ascii	"\343"
+	.string	"\370'2{fH\240&\364>\336\236\317'\\\3351\r5\201_\272+\001\330\007\331[\001\265dl+\r\332\002\001{\374\327\276\215Xt\253YX\354f\331D\207\f\312\206\222B\257\3172\0232\t\013\n\320\332\355k\267@1(\214\244J\373\241|\177^\234\247\331\016N\220\215\264\360,\251\022\02527\3361#\031\355\035\226y*P\225\341A\343G\032N\355\\s\3132\276\3433\021\244<\307\260\237p4,\231\371\021\347\270\345IQ\262H\327Qg\202\026O\017=\365\333\274zyP02e\tS|\232\023\320K\020\277e?\036mK\304Yb\363\323\347\324\212\004\242\260sn\222|\337hZE\251\020U\226\001)\222\352\301\027\231T\fD\340\023\205\"-\3544\202\"\214\351\325/\3210f\304m\002G\260j\002\354\021b(\346Z\214\013\227\211q\211\303)\274\273\301\301\215\304 N\231\310\362>\2059X"
+	.ascii	"\204\260\225\336\271\204\t\314[Q-\r\3146\310Qz\334\206\230g["
+	.ascii	"v\024P\202-Z\234\3655\n2@\253\256-\027\352\364\\\231\t2\2425"
+	.ascii	"a\212\026\316\370L\340\353r2`B\267\346P\020\367\246\234\001\360"
+	.ascii	"\036\313ixp\3702\334'\334\343\244\236-\t\270\313^\001\310\323"
+	.ascii	"A\230/VS\340C7\233\367 \016\2749N(\315xF+}-\267\024\306z\330"
+	.ascii	"\210o\300\b\34398\024-\242a\230\375\314\356m\334\t\022\322\007"
+	.ascii	"@\253\f\257\357\270\326!h\f\001.\253\033\036v\241+\262\033\031"
+	.ascii	"\302\221\364\363\323\332\254\201\241\025l\335h\253\240\202\200"
+	.ascii	"!\034\251\273\344>\027t\2634\3010`\244\013\0061\007W\2447A\246"
+	.ascii	"\310\022Jh\325\266\343\024\232\255AJ\316\227\201A\253;\314\243"
+	.ascii	"V0/jD\304\352#\206)\305\241E\322\242\340\271\307\365\336\200"
+	.ascii	"~\f\273\260R4\353\333D}\254\230\273Po\213\345\233vP\366\315\232"
+	.ascii	"\371\324r#\270).v\223\217E\334\032\0253e\366d\f`\326\310\276"
+	.ascii	"\335\321\305\345\f\354(\2108\220\022\b\310.\nE\027\346\215\236"
+	.ascii	"\332\300\013\224\rw\2025vK\346Q\327@\261\341\240\262k\314w\266"
+	.ascii	"F\234\025dp\206)u<\"\243\001\316:\337D\\\201\303\375\370\033"
+	.ascii	"{m]\346\026\207\032m<\016svf=\231\271\n"
+	.text
+	.section	.gnu.lto_.symtab.91041dff02f3d3a9,"e",@progbits
+	.string	"sensorsAutodetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\001"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\001"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"baro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\001"
+	.string	""
+	.string	"baroDetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\001"
+	.string	""
+	.string	"compassInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\001"
+	.string	""
+	.string	"accInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\001"
+	.string	""
+	.string	"gyroInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.91041dff02f3d3a9,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,757 @@
+	.file	"voltage.c"
+	.section	.gnu.lto_.profile.fdc84e1b0ac8241b,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.fdc84e1b0ac8241b,"e",@progbits
+	.string	"(\265/\375 \363%\005"
+	.string	"\364\007\347"
+	.string	"\025"
+	.string	"\217\211\332\324\013\004\002"
+	.string	"\001\216\235\241\221\t\002\231\331\257\376\003\b\002\001\002\001\002\002\002\003\003\240\342\234\212\n\004\314\341\206\214\004\004\002\002\003\005\371\265\336\203\t"
+	.string	"\006\360\262\252\346\013\n\002\004\001\007\b\333\326\241\250\n\t\376\367\374\375\004"
+	.string	"\n\274\205\242\255\006"
+	.string	"\013\f\357\313\212\236\006\r\016\244\310\245\335\004\017\314\251\277\367\n\020\374\322\374l\021\022\242\302\263\302\013\023\024\240\342\234\212\n"
+	.string	"\016"
+	.ascii	":bZ|S\320\242\352\220\327\f\272P\r\365\n\023j%\004\214;g!\317"
+	.ascii	"\373\257\020\226\033h\003X"
+	.text
+	.section	.gnu.lto_.ipa_sra.fdc84e1b0ac8241b,"e",@progbits
+	.string	"(\265/\375 mE\002"
+	.string	"\224\002a"
+	.string	"\f"
+	.string	"\001\001\002\004\005\003\006\b\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\t"
+	.string	"\001\n"
+	.string	"\001\013"
+	.string	"\001\f\001\r\016\002\001\001\001\201\004"
+	.string	""
+	.string	"\001"
+	.string	"\r"
+	.string	"\270"
+	.ascii	" \240\3120pb\247\231\234\031`\007P\203\34020\204\312\340\227"
+	.ascii	"06\200\005"
+	.text
+	.section	.gnu.lto_.inline.fdc84e1b0ac8241b,"e",@progbits
+	.string	"(\265/\375`N\001\205\007"
+	.string	"b\214$)\200)I\007V =\260\330\230\200\204\027\b(\"\260\f\374\364h\001\031Sn\0241\233\340x\240\2775\333\332n\204\220-w\n\277p\330\347\025\375\342\305\202FD \217\036\200~\254\375\366`\330\205\177\261\204\204U\370\036\021\210\2032@\303(\226\267OM\234\2765\232\225\377\263:\367'\007U\306\215\271\027\216oN\343 2s\240\177\b\225\310L\201\023Cf6|R72h\213>\370\352zr\257jffzF\261?\252m\033\343\326Z+y\346\022\004' \200\002\021\273\262\003\334 "
+	.ascii	"\025\275\b\001h\221\034\201XsD\036!\221\314\221\224\247\027\260"
+	.ascii	"\242\245\303`\327\r\020\001\337=\303\220m\271a\212pi\245\272"
+	.ascii	"$\342\f6\224\267\363\312\302\316\b\023\315\341l\206}\271\261"
+	.ascii	"1\204\273\3319%p;\3556\272n\230\327P#_\035Z1\207"
+	.text
+	.section	.gnu.lto_.jmpfuncs.fdc84e1b0ac8241b,"e",@progbits
+	.string	"(\265/\375`G"
+	.string	"\345\005"
+	.string	"\022J (\200)I\007s\005hTX\361\301X\031X\255~D7p\007\037\2171\022\017\250+\210qA\374\206\254mv\023\262e\222\001$\257\177\250\325C\004\002\252ge\362MH"
+	.string	"\362\241(\023\303J\203-\020\252y\252yN\260\213\031\262\017\f\343@\320+\236b\247\214tT\257\321\033\370\"d\301\355\275\330/\326\331P\344\240\2213\271\304\023\n<\202\013\f\035\342\204f\206\235\n\221f\tUS\257\236\t?\b\027"
+	.string	"G\220\373\331\270$\326\004p\202\246-\313\037\240\"\241c\r"
+	.string	"\354\325*.\214q#\214V\274 0\034\2610\337L\340\335\331\005\332d\264\260"
+	.string	"\b\006\246\251\\Y"
+	.ascii	"7"
+	.text
+	.section	.gnu.lto_.pureconst.fdc84e1b0ac8241b,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\f"
+	.ascii	"\232\004\002\232\004\004\232\004\005\200\004\006\232\004\b\232"
+	.ascii	"\004\t\270\004\n\200\004\013\200\004\f\232\004\r\232\004\016"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.fdc84e1b0ac8241b,"e",@progbits
+	.string	"(\265/\375`\031"
+	.string	"\265\003"
+	.string	"\302\304\016\027\260'\035\200$y\220\230S$\355\340\256\206#\2150\246\326\204`)S\027\306A"
+	.string	"?[U\"[\204\220\363\035M\253P\256\362\256\374\255\347|(WMe\237\261'\023~6\317 \030"
+	.ascii	" \204f6\030:\314\304\264\003\203\301 \346\200\212G8B\220\312"
+	.ascii	"\001\2647\fP\233\300l\267\316\f\323D]\326S\206]\351\002e`g\307"
+	.ascii	"\316\301\272\314^F\036@\021"
+	.text
+	.section	.gnu.lto_.lto.fdc84e1b0ac8241b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_voltageMeterReset.16.fdc84e1b0ac8241b,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\205\b"
+	.string	"f\320;6P\217\032\003 M\017\b\271\357\214\255n=^\322\352\026,)H\264\316\016e\263\027\006\b\206\275\207u@/\2723\343*F\217\311@0\b\036\3300a+\211\224)\005)"
+	.string	","
+	.string	","
+	.string	"\231e\275\226\305\037\352fqd\264`\377g\364\260g\350\325\026q@\31142\004h\370_X2m\270\321m\021\332.\264]\t\247\326+\033\312,\245b\220\362k\304^\376\222' \232\266\206\255SVy^\211<\360\237PJ\376O\241\t\031\313~.\310,3&\b,\267\023n\311\026\027\314\241\254\2550I(\363\237\241\036\261\270\020@}X\326\242\314R\232\270B\\H0\326~#\030;Zc\376\2771\234\006\322<\262\235\215\366\300\001El\024\263\343\266\356\243u\363\003\301\361\314\016\327\315\315A7\t\215\233\240m\343\246\346\2731\217\247:\250^\244\210Q\007\013"
+	.string	"2\241!\034\030.XIQ\362)\262!cY\301\274K"
+	.ascii	"\315j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_getVoltageMeterADC.18.fdc84e1b0ac8241b,"e",@progbits
+	.string	"(\265/\375`K"
+	.string	"\035\t"
+	.string	"\306Q@80\221\322\001#\202)h\026\235q@C\325\264n\034&\372N\024x)sg\250\326p\363Jk\003F\316\345e\263a`\240\020\205\330\255Y\251\220\312%\364\333o\233\310\235R/"
+	.string	"0"
+	.string	"."
+	.string	".P\207\013+\245f7\234\016\037\300\271\364\034\200s\251\037\377\036?\377$\327b\033/`K\365\330a\330]G\260\345\272\365\266\013l#\330\236\tQ\243/;\261\230P\313n\306\314fa\344J\210\355\224\375\261\255\321NPH]fa\335\345\240Q\331\r\017l\340\271\264\355\213|$\345O \204\005\276\370\211\004\001lw\027Jn\342\371 \227\236@\305\203\227>J/\003jD\275j,\254\233U\234\331\241*\252\207}m\365e;Z/\373\003\025[\203\251$M\022m\016\243\323\003G1\275\216\363L\2337M\245\021\304$u\336\024\205\314El\335<q\\7?\341^[}Y\007V\212a\037\345\003\301@;\013"
+	.ascii	"D\023Z'\306\345#\251\232Pl\202u^h/\241\272&RbA\240:D4]\363\t"
+	.text
+	.section	.gnu.lto_voltageSensorADCConfig_Registry.22.fdc84e1b0ac8241b,"e",@progbits
+	.string	"(\265/\375 \230]\004"
+	.string	"\324\007a"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\202\200\200\374\342\203\357\321\033\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\345\030us\350\355\007uq"
+	.string	"\005\001\006'\001\003\202\002?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/voltage.c"
+	.string	"\004"
+	.ascii	")\"\301$:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_voltageSensorADCConfig.23.fdc84e1b0ac8241b,"e",@progbits
+	.string	"(\265/\375`'\001}\r"
+	.string	"\346Y[C\020\221\223\016\030\002%Lp7\207\201\227\326Sa\267\241\311\327"
+	.string	".\256\360\365\345*\210\213\177\220\364\027a-F\035\fl\020L\256\024c\250\252*]\271n7\036\202\334Q\021\247\035^\335-\"mo)S\nF"
+	.string	"H"
+	.string	"G"
+	.string	"2\356\201\330\177/\031N5v\367\322\017\376\241w\303\334\036\241\346\346W *7\340\201\205\353D\217p\263\273\034\335\005\270IR'\222PD\311\365+G`\302\202\353J\236\025\310\356:\271\216\303\235\271\355\314\366\002\373Z\273$\251\033\333\022U\240d\376\263\177\272\347\257X\363h\227\270\211\355\237WX\242\r\026\352\203\231\261\273\035\217V`=n\3405i\177\304IlO\2610"
+	.string	"\300\216|\032R\354z\t\354a=\332\273\200\314\243\365"
+	.string	"\231Gov\273PM\250\243\b\201?\371\t\n\021\322\345e\027\303\271G\037U!\304?\361'd\036\017\270\220:\2142\345\250\327\237\316\240\205\311\013.f\224)U5\331\236(\265\264\273\"k\311~\312\037\377\335\371\364\253*\006F\001\226\237{: NH\003},w><\r8!\007\230\204K\3130\r\344\321.\320\207\363\340\352d\332\365A\300\030\004Ov\2050,\2734\336^KV\271\205\242\3212R\021G5\271r\241\036W\230$\331v\307SQHB|1F\322\306\341n\031"
+	.ascii	"2\003\376\031\322\340E?\256\304\212S\267q\272\b\316$s!\314b\\"
+	.ascii	"3\346G\224(.\013\241=U-\007rV\035\313\332\002MX%\020\0277D\224"
+	.ascii	"\rv\332\333s\300\237\224;\327|\002"
+	.text
+	.section	.gnu.lto_voltageMeterADCRefresh.26.fdc84e1b0ac8241b,"e",@progbits
+	.string	"(\265/\375`\230\004\255\034"
+	.string	"\026u\267H\240VN:\304\212\260\214\215\3416\035\032\307AC\257Qk\352\364\344\330\300>%!\307\215\265\367\243\250\364\347\316\013W\030'<\271\036_e\256\214o\307\312!)L)\3539/\215q?\207b\361}hs\267\266\t\221;\245\240"
+	.string	"\223"
+	.string	"\254"
+	.string	"e\007r0\245\373\360\rF\231\222I\334\207g`\220\351\250\265\342\354o\371^?\032\367\265c\201\355\\\3571|W\211^\223\256>Aa\335\030\262\275\324\035\207\276\234\337\321\227\366\263|\243q/\017 \030^k\311Vo\324\202\034\255\262\324\312U\340\245\r\330^.\316C\373\312\271f\324\037gD\035\277\324Z}+\303\344\034\276$w\016\375\032\003\254\007\240!V\224bzI\366j\2559)(\2627MH9M\022\307\324\367\306\023\260\"+JM}\326\030\324Z=\213R)nz\333\034lo\260\311\256\264\b8_\234\333\203Z&\327\366{\026We\304,M3\315"
+	.string	"f\201\333F\037\346\213\265\375\361wQ\334b\366\264L\273Kes9\315\317Z+\2237\206]\233\026\242\323=:\035d\233\006\242\323<:\375s\233\366\271M\367\330\246y\350\364\016\235\326\241\3239t\032\3076}C\247w\265i\033:]C\247ut\232\206N\347\350\364\f\235\226y\327}\373\327]\273\326\275\345\364,\247\037"
+	.string	"\227\302\t\001\261ZO\244\211\251fe\021\033\357\372\277~\255\257\375\260\256D\036@\033\004\341N\210\226\212Y\031\320\236K\225\361gw\226\267;hD\036>\373\023\224v\217\321\236\365Y\236.<\333\023\341L\210\266\306\022%<{\262*\243\2130\037@uvgi\027b\013\241\017\2409\253\263T\b\316\3566g\027\215\230\303i\246\371fq\366Qc\016f\tGBD4\305\245EV\255O\t\376\3036\360\261\t\344\356\205\230\327\211\254Z\253\002#?B\241\202\205\371\342\005\372\362f\005\234\031o\273\333\203\2354Va\211\0323\367\266s\214\330d7\277>\021\f\363E_\354C2\3704^Z\303o\276\370\222\274\321\002\366\240\364\023\336\200G\"@\374*l"
+	.string	"\n\201IGF\034rFw\321\020\260\303/\351(8\302\207$\f\"\205"
+	.ascii	"\"\371B\030\375@\370\212\204H\276!\236\203\"\200B_R0(\364\341"
+	.ascii	"\270\232\2761\260n\013Sa\326\264N.\227\312\013\224\354\277DK"
+	.ascii	"\253y+\3375\261Dw\267V\\y\235=M0'k\255\225\\*\3336Z\257\362\345"
+	.ascii	"\214\312\324UZ\315\332\350\266\206fuI\236[\232\223}fs2;S[\231"
+	.ascii	"}\230\320\332\303\255O)\261O\312\022XJ\003\032-H\276@y\024\007"
+	.ascii	"\017\350\313\037_\242\270\362R\324\322[\241\345moy\307P\250a"
+	.ascii	"0%\225qFf\202\031\t\022H\013\213\305\220\002\231#b\035\021p!"
+	.ascii	"E\310\246$\252\326;\374\n\276V\341\360\202\204\365\265\206\362"
+	.ascii	"\"A\362gI\023s\252VX\211PJ\325Y\033\330\361\253\202\361\376\273"
+	.ascii	"d\002k\021u`+\b\337\246\020j0su\232G\263\236Y\331\251\313\211"
+	.ascii	"3\366tj\026\212<\003\267\270\246\207\265\337@r}\372\001\374\256"
+	.ascii	"\337=L\017)\247\220\254\367\233YR@\210\356\277n\204\320\301\030"
+	.ascii	"*\370(\327\305^|\205\200\212&\274\017\003\2439\342\321H#CD;G"
+	.ascii	"\215\215~\363q\311\233n|\361\006\321\203\303\356\356l\377S\235"
+	.ascii	"9S\001"
+	.text
+	.section	.gnu.lto_voltageMeterADCRead.27.fdc84e1b0ac8241b,"e",@progbits
+	.string	"(\265/\375`\r\001e\f"
+	.string	"fVRA\020Q\234\016H\225YA\361E\305\004\024\353\362x\3201\263\352\002\033\fw\022\214\250W\222\r\210^\253\025S\024\305M\360\207\245\024\002"
+	.string	"\214\220,\342\r\210'1v\222\354\n\277\307\217\326\221\333\356\235R<"
+	.string	";"
+	.string	"E"
+	.ascii	"\327\356"
+	.string	"\207\0311v\313\003\246X\257\005.\240z\225\034@\365j\321\306\361R\304~D\3220\332\261\273\030\rq\361S\364/\3725v6\237\037\013v\327s\354p\270\351m\033\260m\261\357! \354KvwM=\366C\177=\350\247tz\322\351[\023\222\006\345\264\273!\325cM\2654\302\366'\266g\371\024\342C\232\001#\233A\324!\201\365\352\322\372\264\177\342(\304\203.8%T\211\027.&\275J(\023\247\366\345$\316z\213\020\023\340\306GS\275\322\032c\016C8\013\356\"O\bl[\370\nO\204\264\241`t\025\022\374\317\253\301\t\363c\205\352\365\364\"O<@\234\231\262\313\315\244\001\337\026n\rB2[\327e\017,\232\203\f\304Ze\273da\306\243\200\201\237\007v\033\210u\230\214\303\264\017\304*\004\354E\330>,\364\274\017\233\224{\311R\217\031\2200q(\006Ojk\227Aul\207\301]\001\032"
+	.ascii	"\2263\241\214\351\3043\f\267\352\030h\003/\002M\240\273i\310"
+	.ascii	"\362\0069M\2572\226]\250\306\215\320\\f\235\373\226\265\331\312"
+	.ascii	"\360\2265\027\336b\230\027\204\337\324\024\270\027LM\001wy\321"
+	.ascii	"N2"
+	.text
+	.section	.gnu.lto_voltageMeterADCInit.28.fdc84e1b0ac8241b,"e",@progbits
+	.string	"(\265/\375`\027\001\345\f"
+	.string	"\346\326SB"
+	.string	"Q5\0358\0354k\032\354\3465=/\272\344\037\322\225\\?\241|X\343\004\377\217\256\220\257\033,h\t\021\344\177\bLF`l\005\200\252\252\252\313j\343\303\343\307[\022T\005cK\210\354\275wJ\001@"
+	.string	"?"
+	.string	"B"
+	.string	"+\226\205\025\216\335\325\346\006S\371\275\322)?_\202\361x"
+	.string	"\020#\241\b\276R\312\356N\304\n\224\"K\242H\322\021\246\317\177\234\300\207\221P4]J0\273k\031\212\031\356\353\266\025\330\266\330\227\020s\242\354\021\224rwA\317\223\375\324\375+\023\211a\221\261\213a\207\216m\325\026!\236\272}\325I\370\037\316^\017 \370\236\002a+B\222b\005\303\306\356Xyu\001\354\365\231?\273\306G\016\3732\307)\365DN\022\213o\227W\334r\264\033\022\340\243\330\230\370\t\016\275i\\\013:\331\013cr\300\315\272*\367A\034\030x\t\317\367\360\352\007\021\344\303W{\002\005\371\320W\375\027B\\\264H\023\234\001\234[s\3316\231\017\003\016\202\346u\234\347\331<\315\303\311t4M\347i\027"
+	.string	"\346\032l\235\366\341\270N\313\306\375<y\034\013a\265BS\344:QN 2\177\320U;\310\253\370g\351\240\353S\245\341\006\310\214Q\036"
+	.ascii	"2\003\3769\006\324\201 \255\330\337N\247\255]\310\330\341\030"
+	.ascii	"\243<K\370\254\243\215Y\205+ou\232\252\300;\003\313*Ty\206\007"
+	.ascii	"\263\030\230+\227{:#S\265cR2^\256\b2\203[e\247e=G\371I\244s\315"
+	.ascii	"'"
+	.text
+	.section	.gnu.lto_voltageMeterESCInit.29.fdc84e1b0ac8241b,"e",@progbits
+	.string	"(\265/\375 \302E\005"
+	.string	"\262I$-pU\323\001"
+	.string	"\345\276s\f.\240\035\250\265\216\347\370\177B\212\213\226\220Q\333\251_\247b\233PU\261\362\033e\332\037\334%\344\026\355-S\246\244\2521]\2209\221\225\316jUUZ\217)\")Z\245t\360\224TT^sR\031y\337\330!(\261b{\031\214\030{\005\377\357\330\331\320\300\t-\276\177\033\0208h\360\331\330\336\310\230\r\260\236\346\373m\026O\300\177\0313\213-\304\274\333\331\202\306e\013\t\214\377\206\032wY\307\265\235\260\255\260\355\b\007"
+	.ascii	"3\003\316\231\021\340\313\3512\376e\\p\351\026\355|\002"
+	.text
+	.section	.gnu.lto_voltageMeterESCRefresh.30.fdc84e1b0ac8241b,"e",@progbits
+	.string	"(\265/\375 \302M\005"
+	.string	"\262\211$.pU\323\001"
+	.string	"\345\276s\214\020\001\355\200\357\013\267\340\352q\214\230@\215\214\332N\375:\025\333\204\252\212\341\026\\\251\177\001\034#\267vo\231\002\256&\253Aa\2209\221\225\316zYU^\017*\"+Z\345t\360\224XTbsR)y\337\330!(\261b{\032\214\032{\005\377\357\330\331\320\020\032-\276\3772 p\321"
+	.string	"\324\261\275\2223\033`=\316\367\313X>\001\377e\334l\2660\363\256g\013\033\247-$0\376\033n\034f\035\327v\302\266\302\266#\007"
+	.ascii	"3\003\316\231\021\340\313\3512\376e\\p\351\026\355|\002"
+	.text
+	.section	.gnu.lto_voltageMeterESCReadMotor.31.fdc84e1b0ac8241b,"e",@progbits
+	.string	"(\265/\375`\235"
+	.string	"\255\n"
+	.string	"\246TKB \3078\035\220\305\321\251\027"
+	.string	"\035\201u\276\213\203\303;\331!=\203t\223Zf\246\220\2511\350\004\342\017\332\005_\330\240ua\022\312G\002\300V)\221\337\033X\375"
+	.string	"\202\210n\325\030H\037\273\243\355\224\0027"
+	.string	"7"
+	.string	"8"
+	.string	"\342W'\326vQ\257\004\273c\205)2\247\026\355\006\037S{\227J\205@lw;\355\345\342\247\350\237u\205\322\t\3453acw=K'\226[\273m\t\333\033\373\023\001\273+\263\007\313\200*"
+	.string	"`\373~\353d\350\003\354\261@\265\273\334\251\035\262\271\323s\266\265i?\300\005\210\037E\020\r\233\3222e\214\177\330N3w\330N=\247mq\021?@a\bb\007\267\223&\271\013dH\355.\206_\300\004\344\303\234\372\242\355\364\344g\214\251D\255\034\214\346\314\036ISs\261\217\260\273k\255\305\376\370O**c0\215W\237\027z\034\013\237\367\341\001u|5\254\036\316\035\215\007\302\tEjI\007~\025\374x`\367\t\341x\272\316\007v\232\b\327\021\357\353\302Z\277\216\033Gg}#+e\345H#\371\006~\3225\016"
+	.ascii	"\2473\241L\2130\334GX\023\023\260\243&\t\2510\274\313\024@C\240"
+	.ascii	"\302\025`\304\227\212\007\356\334\242\235O"
+	.text
+	.section	.gnu.lto_voltageMeterESCReadCombined.32.fdc84e1b0ac8241b,"e",@progbits
+	.string	"(\265/\375`u"
+	.string	"\245\t"
+	.string	"\206\222C< \005)\035`\305\365\266\b&\023f\266\310\2078\321\255\213\001\220{\36240\226s\227u;\260\335\262\252\r\201\\\243\221I"
+	.string	"B\003\210\305H\356Y\200A@\306\245q\264\312fd\247\024/"
+	.string	"1"
+	.string	"1"
+	.string	"W\340>=O\340>-\332\262W\326\036\246\006\004F\333]\272\235\\\274\024\375\277>\220R}\\\nH\354\256eJEro\267\315`\033\302\276A7\0214\273\"5"
+	.string	"k3c*~\313\307\322\253+d+\273\333}\332%\273\373|g\373\322~\353,\342]\246#\354\256pfv\253\203\033<\237\256\001\264\223\270\217\3368\214T\300\332\335\007\337\305\243\303G\371\364M\334\347\307\313\224\220YIK\347$kvE\311\315\304~\300\356\256\267\225}\327/\347A,\2407\362(\b\034\372x\026\240\021\306\307AC\360\013E^HE\027\240\f\032\002C\372Y\360\247\341\201t\364} \355\352\351\257O\004\030\331\231\2356\224\377\362\217\016\0373sd\002\r"
+	.string	"s\311\"\3236\030\351#"
+	.ascii	"\211\t\330Q\223\204T\030\326e\036S\241\001\025\255Y]\001\327"
+	.ascii	"\362B\230d"
+	.text
+	.section	.gnu.lto_voltageMeterRead.34.fdc84e1b0ac8241b,"e",@progbits
+	.string	"(\265/\375`+\001\325\r"
+	.string	"\366\231^F\360\2226\035P\220\316\201\177rB\245*\270\235\204q\023\363\246\252\007v\310\031\200\216\335t\265?\361\307\rG\277*\ny\222VL\322\nO\216\002|\006\236\023t\016\\\360\223#\263*\226\312W\346F\221\354\275wJ\001I"
+	.string	"G"
+	.string	"L"
+	.ascii	"\247\346\354\036\007_\3662Dp\220\311\331\335*S\234;\2352r>\352"
+	.ascii	"\005nTN\037\336S\243\263\231\361X>-\226\313\251\340\323\021b"
+	.ascii	"\200\267"
+	.string	"2?5(n\216z\354\340u1\212<\330]G\222\007\342\256n;\202\355\006\366\275\037vt6Eq\270\260}_\346\341\311c\330\200\313\213\317\264\273\327\251}b_\247\277lG\3601\334O(\367\354\266\350T\353\324\240\365h\337t\030\334aR\f`\367D\016\033\273 \003/\260N\021\374S\235\316\023\250\002(\325\351\303G\026\036p>\023\220Q\334\2117\202\324\230\230U\224\322\306\240!\236\344)U\336\202\364\245\244,9\300S\252\313\237\\b~\330\360X\211Cl\260\213\262d\177\356\356Z\266\330?\375\3620\377\255\004\251\257\204\212\021r\007\270\001\032&\302BTBI4\t\b\2330\"\252\220e\250\233\226m&\330VMJFB\225D\333*\350\2003\013\230VEY\246\325\013\034\035u\b$V\b\316HvT\226h\374\241)\234\206\372\240\311yV=t\35032\001/\273\353\300\237\331p\301_\021\031"
+	.string	"2\003\302p\323\204\365\t\250\364;\236\306\342GM\202T\034\313\306"
+	.ascii	"h\260PR\213\272\030g\257\271\314Fh`1\334\013\354oj\n\334\013"
+	.ascii	"\246\246\214\273\031L\0061h\336DcPP"
+	.text
+	.section	.gnu.lto__reset_template_115.0.35.fdc84e1b0ac8241b,"e",@progbits
+	.string	"(\265/\375 /M\001"
+	.string	"\370\""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\001\n\356"
+	.string	"?\202\210\200\030\177}\275\001{\274\001y\273\001"
+	.string	"\003"
+	.ascii	"@D\312-\003(\002"
+	.text
+	.section	.gnu.lto_voltageMeterRead.part.0.45.fdc84e1b0ac8241b,"e",@progbits
+	.string	"(\265/\375`\324\001]\020"
+	.string	"f\235hG\360\262&\035 s\264\t\245\252\030\242\364i\025 +\246m\363I\275\327\226a\001%\002\246\030zL\273\tf\354A4\0255\337\244\216(\357\bmJ\030\324\fX\371\217h+\362Z~\351P~W\035\372\266H6\221;\245Q"
+	.string	"S"
+	.string	"T"
+	.string	"-\240\236]q\301\247\025\204>-^\300\366\031z\200\355\323\376\013\333\252\027\2076\220\213,\366<%@\274\210\354n\367\251+\036^\245\026\372\260\233\314Z~b0\037\256\037_2\313\371\211\301\214\270,\2716\022aw\035\"q\317\333\206`\273\201-)\004\037U\276\343\0033\326\211\335U\261\317\363\230\315y\345;&\240\242\206e\263\273\334\212\364a\250|\2309\333\327Q\375\305\"'\354*&\301\2475\3471\302\277X,\332M\341\303 \364i@\343,\345E\325qR\003\304\025\361b)\355\337\334\025\036'u"
+	.ascii	"\273\001\237\312\303E\310G\223n\303\023\321\370"
+	.string	"p\360\321>\215\313PHhz<\350y\215\222?\363\3711\203I\336\345\3338l\237\327\217\2272blX7\256\225\f\222*c\325\256\255\266\354MZ/\376r\223\376\b\002\037\022\326n\210 \240E1e-\256\363\333\367g\004\030J\022\364P\236i\232t\342\241\214P\032\276\016\335\t\374N)\336\251K)\215L\035\t<u'\005\374m\360\300\016\365}`\307][m\331\260K0\261E\202\254\264\305\252*c[+|\207\016\261p\035\236H6\253\311\341\243*\222\315\\\270|\3418<\223\037\376\r\017#\177&\265\005- \220\002\231\033\225\007\344$\206\233\004A\334\220\002\030S0\312'F3\006\243\023\353m\030`\307\214:\343s\343\025\206P\332\007b\314\221\201lm\237\265\222\247#\354\030t\223(\302\307\024t\356f\027\023\264\267\312\213L\211\327\360\037H=\206h\206&\fi\274\364$-\3546S\026\032"
+	.ascii	"\264w\364$-=\301\214\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.fdc84e1b0ac8241b,"e",@progbits
+	.string	"(\265/\375`#\001\265\007"
+	.string	"\322\n*1pI\324\001\374\177V\341\372\341\223c\272\023\303\277*\3739\327\361w\361\361\007"
+	.string	"\004\002\007\373\240\377\237\374\377\334\322J-\255\264R\023$\345\216[\356\024F\200\320b\242BC\235\230P5V\023\027&&vL,\270d\362\211\344\035\264m\317\215\310#\2603\304y\b8$iGT \036\032(\f\025\005\212\303\201\341'\301Qr:\344\366\207v.\373\304\276]\327\224\340\231u\254\212$\365k:\244{\221>\240\266\004<\3226\267\236\367]"
+	.ascii	"\354\356F7\320h\303o!\210\3640.\366\355\f\n\250\273ky^\251m\235"
+	.ascii	"\001  \300\002\021\263\322\001\f| DI\203\344\231\341\36508\\"
+	.ascii	"`\"\271\260\214\bF\371\031\215\347F\346F`\031\323\032\034\332"
+	.ascii	"\3719>\267\370\034\353/s\350\201?(y0\200\373rv/\360;r\2700N3"
+	.ascii	"\r\037!\2056\020x"
+	.text
+	.section	.gnu.lto_.refs.fdc84e1b0ac8241b,"e",@progbits
+	.string	"(\265/\375 Q\265\001"
+	.string	"R\304\n\017\240)\035\377\377\234q\206\366\333mN&\231\002:\361\\\246\266p\260\306d1YF\207Q2\272M\210o@n\252\371.\225z\004\002"
+	.ascii	"Q\205b\215PP"
+	.text
+	.section	.gnu.lto_.decls.fdc84e1b0ac8241b,"e",@progbits
+	.string	"(\265/\375`J\036\035\213"
+	.ascii	"\032\344\0342R0\022JJ\007\372\371av\177\bA!2\f\311\246\357\367"
+	.ascii	"\356\326*\017Cw\236'u9\264~\344\226\254\352\275\273o\272\370"
+	.ascii	"/\177\177B\336\266\237\f\3565\275\034\20693\272\363\200\252l"
+	.ascii	"\254((B\353\035\343\034\272n\217w\024S\304\210Fm%[\312\024\232"
+	.ascii	"\002\020\003(\003\235\276\321\324\263\230\031F\323\251\271\267"
+	.ascii	"y\366\034\202\3618\312gX\210\367z/\364\336{\206\313\254'\242"
+	.ascii	"7\230|\335\273:\340\343\200\016\230\272!n\\\352;\207\372\226"
+	.ascii	"R\177&\203BM\372\020\005\353\364\3471ww\355!!\0317\327\251\230"
+	.ascii	"\235\036PF\312\312\250\217 \n\243\351 yn\322\211\354\311b\\\307"
+	.ascii	"P\030\315\256"
+	.string	"j\352\323\2232\273{W0\034\206\3558\312u\234vVc)\\\307S\370\213Nr\275G\021NfTm\277.I\27435\365\342\243\242\r\331\342\241\3233\231*\224\005\315.\f\013\226\032\330\025&Q\204\330\320\236>\270\265\t\265y\241\331U\261\3624v#\343\347Z\024\273\265\037\236\246cs\357\225\036\324\356\275q\f\004\317q\027\206c9\246c.\034\004G\371\215\267\234\2370\364\351zo\362\336{\016\373\205~\246\302a\374\306Z\236V\002\352\336+Z#\234uQVx\367^\007|\034\020\301TS\316\005\220\236y\250g*\365\034\245\236\225\352y\206zF\252\257A=\r\352e\250\217\241\362\2701\t_:T\373G\005\365\035\250L\306e\034E\301g\3471\026{\rr\275\353\275\353N\023AS\366\244\323c\240\3767\273\001aw\305\tP\317(|vo\217Q\370\376S\233G\370x\230\204\257\233L\302\267"
+	.ascii	"\217\360\235`\022\276\237\2350\030\257V)\325\274dW\271\366p\362"
+	.ascii	"\310YX\247\314\204\233\234W^r\025+n\217a\027\354\336\313\253"
+	.ascii	"\004\315{\221\274\356\350\335\213\334aN\2009\201T\311\326\021"
+	.ascii	"3_\372V\2772\t\237\312#|,F\374\275\224\376}\302\212)\027\361"
+	.ascii	"\367\321\177\177\353p\233\277\217\3708\377}\303\317B\244\374"
+	.ascii	"\334\203\032\217\273\336\361\277\356\177\030\376\375|\363\263"
+	.ascii	"\315\317,\374\254\363\363\006Z?\247E\371y\013\355%\3763\360\037"
+	.ascii	"\305\377\263\237\307\256\300\337P\274\212\360\263\362\347\250"
+	.ascii	"\237k\374\374\364\363\214\237\241~\236b\3623\361g\247\237\221"
+	.ascii	"K~k\202\200\233\240\376\355\364\377\314\1773z\367\375\335\364"
+	.ascii	"3\330\317C~\346\372\271\3713\363g\035?\337\370y\3713\325\317"
+	.ascii	"D?G\360\363\n?\247\360s\t?\217\360s\b?\177\3603\007?\273\370"
+	.ascii	"\271\305\317\025\374\314\342g\007~F\3613\316\377\263\377y\377"
+	.ascii	"\305\374|\300\177/?\227\370\271\200\237\007\3709\200\237\371"
+	.ascii	"\347\235\237s\376\353\375\037\363\377\356\377\372\277\201\377"
+	.ascii	"l\377w\366\366\366\366~K\303_3\343\027\200\202P\025\f\254\235"
+	.ascii	"\250Wg\013K\326\317OnG\230\256%o'\275ru\341\215\255Mp\240\314"
+	.ascii	"\300\221\024\323tS\212\2541\341\264\233\271g\235\021d\315\226"
+	.ascii	"\020_\322\220|\375\253\225\360]\336\313\274\026\356\212\252\355"
+	.ascii	"k\347\352\212\3333\311[\211V\221\356*\322^\276{ymV-/s\371\363"
+	.ascii	"\367\016o\257\03430^ep\300\241uP\217\367r\031\223\252\r\257\255"
+	.ascii	"l)\342%\207\267\016]\305\007\221\033\2356\222f\252Sp\330\320"
+	.ascii	"\362\2645\220H\341z\036\3111\353a\005\227\227vQq\236\031a!|e"
+	.ascii	"c\362j\250\324\247B\250\347$\334B\336AzHO\251\367\231\002\234"
+	.ascii	"\027\273\273\304\221\342\351\233\372\364L}7\373\206\267\363\316"
+	.ascii	"\006\302L\013\236\314\331]&\363\347\306y\326\346\365\343\r\344"
+	.ascii	"u8\267\204\2104c\266\334:}\231\366\221v\231\361\201\243S\256"
+	.ascii	"\235\036?\232\320I\325 y\262\366\325i\264\267:\371\377\346X\201"
+	.ascii	"\2422\326\351S\"\352\337\277\357\"\227\367^\0335\353]:\341\370"
+	.ascii	"\270\206\371\347\317a\313\n\330\377>\301{\217bsdT\035\322\220"
+	.ascii	"X?q_\343vo\322y\314\300i\225t\332\240\204:\3571i\344\330\263"
+	.ascii	"\274\316\243\022zo\317M"
+	.string	"&\217.\232\267G\t\275Vw\306\233\025\337\325y\274\311\346\355\271\311\213<\241L:\255\224P\244U\217\022\352\264\272P\347\345\271I\344\022*y\227=\027\352\024s\241M+\036%\264i\245\204:\231|\245|[\263\202\316m)\231\2132y\251\246\262\220K\0367\345\332\274s\3672\031\215\273T\340\336\254\346r\016i\003\2539\271Q9\235!\233\274\336{\t\230r\332j\336\244\233\262\253yo\227\023\322\235\222\340\270\272]!\354v\344\312\272R4\356-\340\256\367N\335{\344\353v\357=\336{\177\313\254\365\336+\036\345sj\352^\246\317\324\315:J\241qo\223\321\251Y)\241[M!)c\320\347}Z\217\374\274s\316\245\n=:\271Rc\324\247\325\215\273\237\356a\223\\/\324&n\f\01724Y\321\316\352\253\f\202\254\367\250\343\224\266d\246\310\351\302CSL\016\353J\030\006m\353\364}u\276\353\346"
+	.ascii	"5zZey\235\n\t\275w\214\360-\231\353\335\341&yN\254\350h\033l"
+	.ascii	"\021\033a\236\326t4\216\016\203F\305\353\211\332Vm\203\243}\343"
+	.ascii	"iXs\315\261H\035Z\322~|\374\263\254:*\262\305\f\316\327\222\265"
+	.ascii	"\271\246\352\251\232\031`ws\235J\255I\233(\035yh:\275\035\242"
+	.ascii	"~\005\247\301\212\300\211\347:\301]=\357meGu\r\2166T'\3373\232"
+	.ascii	"\306Y\305\212\206\352\247F\352\034\327[\365\333\312\272\301\004"
+	.ascii	"\357\336U\tj\344\0065\275\315\241\3720\t\237m=\365}\247\362^"
+	.ascii	"_\216\232\350cN\232$i\362\350\324\263\t\037\357\261\t\337;\013"
+	.ascii	"\032\275\233-:\271\273N\363|n\230nq\315>k\344\366\310oc3\245"
+	.ascii	"\207\017'\0168\3746?\2638\254g\020\36577\374\370a\207<\301R\241"
+	.ascii	"\230ea\t\271\035R\267\023&\365\303\231Nm\020+PM\320tj\201<\355"
+	.ascii	"J\030\232\235\226\257\255J\357f\312\351\264\\>4$G\326\254\323"
+	.ascii	"\r\303\266u\313\305h\277\032o\253\r6A\250\277\372\225mr\330\255"
+	.ascii	"b8!Q_x\3672\177p\344\354\300\310\265\326m\363i8Jd\231%\235Z,"
+	.ascii	"\333\343[e]tt\017\036?)\\A\220^p\364\260\356\344l\026o\261]N"
+	.ascii	"%ni;DIb\346\203\372[&G-\263\2652 \273H\253\237*7\020\241\202"
+	.ascii	"w\227WR\364\340\340\306\203S\275\305\301V\207\325q@\032U\333"
+	.ascii	"WNr\211\rCtz\033\033Vlo\330\033\235\005.*K\n\225L\027\021,3*"
+	.ascii	"sg\361\375vi\227\r%=\362\334\353\343L\r\007\210/ZF\326\270\274"
+	.ascii	"\355\270X*\253d^\034)\340\332:\315y\227tj\247~Q;\242de\352\031"
+	.ascii	"LL\217\231[#\323w`[\354\314\364\031\257,y\326\211\335\230<7\031"
+	.ascii	"\345\213\335S\227\351;\235c\317\275\\mO(+e\243\254\322\322\260"
+	.ascii	"58j\237z\210\373\330\247\026\202\321\330-H\006`Z\342\312\034"
+	.ascii	"q\323I\305\034L\t'e\007L\350\354\356]\235Z\317\"\331\215\271"
+	.ascii	"^\033\"\320\220l1\223v\006G\255\323}\326{\311\b\310\311\353\202"
+	.ascii	"\307\304\227\376\026i\217j5\260\236:\265\227\241lQ\\\3144\034"
+	.ascii	"\355\275\235\247\034\320\030\351\264\321\034\f\324\261F\324\253"
+	.ascii	"\344\220\322\203\226N\257\346P\257V\251W\221\215\247\006a"
+	.ascii	"\307\243MO\375\017O\375o\214\372\237\027\365\277\2701w\320\037"
+	.ascii	"\310\264\335!\033N\213\224\323\233\332_\272\256\303\3746;J\324"
+	.ascii	"~D\177P\337`B\030\262%\332i\312\257\342k\272\267\227\337\246"
+	.ascii	"\331\216<\247\252\250\357\271\356\362\333\350\314\031)s\202\246"
+	.ascii	"\276\345\242{dvt\332q*\215_\023\0247<\242hau\372\216\373\033"
+	.ascii	"\210\016\202\327\031\366\320\230\351\364sL\302\227\303#|\375"
+	.ascii	"&\364\206\023\321\266f\327\244S\234\237\226\372\326\302\275\205"
+	.ascii	"\243\275\245\265\260\\^V\212\032\275\035a~J\265\265\364\217\006"
+	.ascii	"\212\036\263\003\217\036\262\374\236\264\344\345\350t\005\303"
+	.ascii	"\251\252\"\322dC\266p/\330N\225{\307\326)\026,\255\004\013U\333"
+	.ascii	"\227\017?\336\222\320Q\241\322V\276\236*\031\2541\265\265\267"
+	.ascii	"\025'\227\365v\332U\032\211\203\246\356\271J\2312EN\353\231\023"
+	.ascii	"\205\022\353\242DM\255\241|\257\\\025U\333\327\315\224'\026/"
+	.ascii	"?\242Di\250\312s\235\202`{\326H\205\311\233\321\351}6\324\262"
+	.ascii	"\262>\023\213\332\220\345\020\362%\372>S\207\300\275\371\350"
+	.ascii	"\264\315:\007_i\022\344,\315\030G{\254\241d\300\274\327*\002"
+	.ascii	"\2476\033'I\312\374\200R\325\302\r\024\007\335\025\233\372\344"
+	.ascii	"IC\325+\026\204\252\r\317\247\247c\352\356e\336\320\232\267."
+	.ascii	"#f\001\301#\240Qi\210\302\320\204\"\243\026H@G\302$\242\261\030"
+	.ascii	"\0244jR*\022&\005\021\213MA\002()5\t\205C\341\317H\344\213aH"
+	.ascii	"D2\016\205"
+	.string	"?\027\200A\245\324\030,.\005\227|\033\214\360\301\210#\001\025\031\001\203\212\304`\214$\242\021\001JA\241\020\2104d\frPd\004\314\221\241\304\304\324\242\347H@\037\230\340\301\213 c\360\210\b4\236x\241h\2504\024$\016\207v\212F\036\b\233\206CFA#q\310\304\324T,@\006\323p\350\204\361H@LMC\342\021\321\022\220\bd\n*Z\240H\330$B\350B\327\024\211p\214D\302#\246\032\341\021\223\r\316\220TL\213\305 \321\310\b\370\223\3014,J\211F&k\024\024\036%)\001\177F\301bS*\034&\031\213\202\305\337\211DGL@92\210\306b\322Q\260\004\004\230\200 \270\360`h\034r\321\342\206\215\202\302$\030K\303!\003\210C\343\020\204\241\027\032\370\b\360B\003c\222\320\003#\340\b\031@\"\261\305R\320X\224\361\202H\001\244b\220\350B\260\204!\027-P0\006\217"
+	.string	"\200"
+	.string	"\310H\0042\001\031\001\203%\f0\002\002\240\025BBJLKA#\021\221\210\004\221p\003c\260\030,\341\210\351\304\213\222\210Aa\360H\275\004,\036`1\201\f\277OP\001\004\025@\340\373\004\025\b\tU\300BH=\013!k$R\021A\221D\220\310\310\003\236 \021"
+	.string	"Fb0I\211)\311\250\324\264\024@\221\350(\311\005\341ph\310E\213\027>A%`Q\321\306H4\301O\t\030#F\222Q1H4\002a\304\3101\036\311D\323M\221H\307(\250\032o\302x$\240 \341piiXd\300\207LAb\220q8$\006\211P!\243\213DF\300&\030\222`\350@"
+	.ascii	"\243\205`\264\n\030-\004l\025\300\026\222\241U\310\320B2\332"
+	.ascii	"W$\n\032\201\306\027C.Z\020\203\306 \b\002l\260c$b!d\024&5\251"
+	.ascii	"\247\200\202\241\023'\204\300\201Z\004"
+	.string	"\024T$\016\213\302`1H\230\004\\\n*\"\026\203\200J\030\005\211A\243R\222\013\302\023\202G@\243\3220F\017\021\210T\224\372\320^8rg\206p2eH:\366F#\211\024\013\246\343\326dO\210\032\177I\317\240\261\342\225\326T\201\344\320\326\303F\261\\wc\2720\351\324\222Y2{\326\301\361\306\307\216e\364\366\214\323\204\321\223\322\251-\263f@\244Uq\351T\254\212\030\335\235j\303l\230\035\343\345\362xw\001\234\026\023\307\317o\237\334\216Y\2615\356\031g\305,\364\306\353\255K\032\261$uf7l\352\255\023\023,\210azu\312cB\267\253U[\243\241\327\004J\235\020+ \2304\220\364H\006I\327i\221\333g\021\013f\343p\3561\354V\375\322\260x1\361\256\222\371#\302I\224\023.<\334\202\335\366\240b\305\301|y\305!;\265Jn\2230\265L\261\373\262I~\233\033\035|@y"
+	.string	"S\377@\230\016+\253N\255\327\301\274\013\214\224\230N\355\016\257\202\303\224\303\003b\273\332\266\340\234:\265Hl\016\034=\233\325\341:S\236\312\330vP_\003\237-\202\\\250R\3310\210\022\231\"\006\251\231\021\222$I:R\n\020\004\203i \351\245\017\022"
+	.string	"\0251Q2\207\020\321\214\244$)Hac3c@\370\325\301D\032\036\246H\357\234X\244\337\263#N\226\003I\224\377\260\"\351g\325\211rQ\023?\300\363,|\345\326\217\333V\326\364\276\317T^\241\246\f\376\202b\017\243\343;\355\252\003\314\314D\004#+r\237\013\307\3217\351\255\266\312\"\277\310\020\377,\346\225\323w\275U)\243&\235\022\342\364\300a%\rm\332\\\255pg\222\344\342@\256\223\347b\204\303\253\006\240\332<\230WI\367@\306\310X^\330\3111\216K\374F\f-j=\331?.\006\334@Y\332\214\nfD\311\204\240\242\013\362mG\022:\340H\017s\026,\341\310\340\210gMM\241\332\363\353\312\220J\rr\007\346KC\003\2315\005\344\321\030\3320\005\300\250\020\335\315\370\343\354\025\232 %\227"
+	.string	"\320\274\235\"4\327h\216\215\214\324\273\n\375\024\240Hv\243\004\351?\302\367\204\022\264\214E\0162vM\275xYF\302"
+	.string	"\3246\005FM\332\246\005=y\251%KK\374Oy\310\202\013(\306\250\212\030\t\020\377\f\207\303\376\235\020%p\306j}\022R\023\233\214\220\256\227V\250>\250\220\350q"
+	.string	"]\257\217R\032p\037\341k\255:\2232\177\350\233\016f\035mSkNZ~:y\032\371*G\017\314U\230\306PP\b\357\205b\366\177\216\n^mH\340F\230l\373\030q\213\317cb\225\342\206"
+	.string	"\032\224\236\334PL\317\361-f\312\324P\370w)\231IrxJg\216F\301\274\266\017\240\345\007^zlW\311\274(\233\203\365\317\262C\005VOw\254\013\372\320\274\243\007\373\373\220\375\353u]\363\341\0325H\273\353^\320W\352\301\315\346\0303\274B\341\201\211\335\364\027Er\307\235l\363\226B\321\303\310\246\254\003:}!\363\306\006CK\311\210\377\270\n\262\350`\233\020_[K\362SPM\370\204\361\3761=\361p\351\f\213d\342\251O(\354\337\b\033\250Y\230O&\005Z\037\270Iq\215H:\204nvVM\321\356W\333\272\220\277\2034]\261~6\340\2621\235jN\274'!\005Ha-]\234\254\021I\360l\017#\017\002\323Q9l\357\315\r\3252E\2759\234Y)\020\310\027\370\222\337\340\243\2579\024\\;\352,>"
+	.string	"nZ\201N\013\374P\241\346\276>Ts\316\3024\350\225\231\244\007\020\246X\nh\215OR\033\003\314'V\274\"\377P,_\211w\270\027\352\242t=\374C\002;\205\033\236Q\2158w\005\314,P\017\002>\034\351u0\r\b<\377MX0!\0050\207z\272~\202\223\305\021\311\032>b\223\332c0\341\003(\320\256\021\331\261\366\tl\326\302\332\320i/\227\037b\026f\200"
+	.ascii	"n\260\021\217\260K\tT\313\303"
+	.string	"a\320\200WC#\005x\017\203\177\313\342N-,W\2144\257\274\201\0052\243\3005\256\255\243*J\254"
+	.string	"\217\373'\270\r\322\232=\004N\021\267\333\002\254\213\374\005I\204\245J\326\3569\243vI]\033\177\016\231\217nKq\227\365@Q\002\016\220\311pn\361\317\340\376o\257\020\3025Nc\324\366s\230\372\317XH\026\024\223%\373w.\371\317F\320\300\342DM\343E\315\371\336\221W\267\340\216\f\245\300\361\302AlFE\\\211!\262%8h\t`\253z\020_\201\246>\251o!\255\2763c\375+\275\2011.\203\236\036lg\247\241\237\001\234}\212"
+	.string	"\2545\265\270\2740\312\372\033\007\331\031\223\324d\026\207\224\342h\021\316\252\341\277`\001\303\351\202k\221{\t\357@\356\201\023\004g'\231(\nw\226's\313\347UBG\277\236\003\020.\037\327\351Vt4\006\313"
+	.ascii	"\301\356\367U\366\336\264\261\030\347\f\355\253j\320\031\343"
+	.ascii	";\347\210\207vs\005\006\346\237\032t\022b\373\206\362[\355a\b"
+	.ascii	"\276\256S\375\303K\361.E\2129\031\214&\345\301\240\236\\\256"
+	.ascii	"\360\245\346\324\370\247s\361h<\367=\325\365\2311\336\324\216"
+	.ascii	"R\277X\277z\375\230\241:4\033b\377z\2313\215\357\364\311\225"
+	.ascii	"]f\331\300|\002A\374)\026\314\316H\3427k\027=U\2776Yaov]?\313"
+	.ascii	"M\016\373\330\350\220\3712\372Fo\336\013>\2164\203\267\241\362"
+	.ascii	"i\346\242e\335\343\276\303d\313\213\021\374\t\240/=g\356\216"
+	.ascii	"\316_\375-J\247\323\205\342\023\326E\204\003\363\375)\216>\367"
+	.ascii	"\022+\307\273j\355!\367n!\367v\375\017\356\326\321\035\357\027"
+	.ascii	"\220\224e1\177\227\324\370U\005\255"
+	.text
+	.section	.gnu.lto_.symtab.fdc84e1b0ac8241b,"e",@progbits
+	.string	"pgResetFn_voltageSensorADCConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\001"
+	.string	""
+	.string	"voltageMeterADCStates"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"("
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.string	"voltageMeterReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\001"
+	.string	""
+	.string	"getVoltageMeterADC"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\001"
+	.string	""
+	.string	"voltageMeterADCRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\001"
+	.string	""
+	.string	"voltageSensorADCConfig_SystemArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\001"
+	.string	""
+	.string	"voltageMeterADCRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\001"
+	.string	""
+	.string	"voltageMeterADCInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\001"
+	.string	""
+	.string	"voltageMeterESCInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"voltageMeterESCRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\001"
+	.string	""
+	.string	"voltageMeterESCReadMotor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.string	"voltageMeterESCReadCombined"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\001"
+	.string	""
+	.string	"voltageMeterRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\001"
+	.string	""
+	.string	"voltageMeterADCtoIDMap"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\001"
+	.string	""
+	.string	"voltageSensorADCConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\001"
+	.string	""
+	.string	"voltageSensorADCConfig_CopyArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\001"
+	.string	""
+	.string	"supportedVoltageMeterCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\001"
+	.string	""
+	.string	"voltageMeterIds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\001"
+	.string	""
+	.string	"adcGetChannel"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\001"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.fdc84e1b0ac8241b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,3152 @@
+	.file	"target.c"
+	.section	.gnu.lto_.profile.518b89b757251988,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`\232\004\275\027"
+	.string	"$!\216\005"
+	.string	"_"
+	.string	"\332\257\241\365\003\032\002"
+	.string	"\002"
+	.string	"\002\001\002\001\002\002\002\003\003\214\371\251\252\002\020\002\004\002\004\002\005\006\002\005\004\251\312\235\263\b\005\262\363\241\265\003\006\240\342\234\212\n\007\264\225\203\334\016\026\002\002\002\007\002\002\002\b\b\t\n\237\213\327\275\006"
+	.string	"\013\f\337\333\256\234\004"
+	.string	"\r\256\234\262\364\013"
+	.string	"\016\017\020\315\263\303\201\005\036\t\004\n\002\n\021\352\263\360\321\b\022\023\025\310\373\201\350\r\002\026\256\310\242\256\007"
+	.string	"\027\331\304\230\327\017\004\002\013\030\234\362\341N"
+	.string	"\031\032\251\306\315\231\b"
+	.string	"\033\204\270\345\243\006Z\002\f\002\f\r\002\r\006\004\n\035\036\353\252\315\223\t\037 !\"\251\240\317\360\006#$\260\200\235\264\b\002\002\016\002\016%&\374\337\261\233\001'\316\225\216\324\007"
+	.string	"(\301\325\215\205\016"
+	.string	")\274\205\242\255\006"
+	.string	"*\225\221\315\200\006"
+	.string	"+\210\377\206\247\006"
+	.string	",\271\303\275\241\r\n\002\017\002\020\020\002\020-.\230\336\335\312\001/\325\304\221\227\001(\0020123\315\343\301\244\01345\210\263\211\216\b"
+	.string	"67\263\330\307\3138\261\213\233\205\b\n\016\002\0169:;\264\251\257\307\f<=>\367\267\311\301\004"
+	.string	"?@\222\321\201\352\t\b\020\002\020A\211\307\340\277\f\002B\314\345\244\232\005"
+	.string	"C\362\357\204\233\017"
+	.string	"D\202\220\306\317\004E\201\226\204\312\r\006\002\021\002\021\002\r\002\022FGHI\333\217\352\217\004\002JK\313\322\375\213\007"
+	.string	"L\236\376\250\313\b\rM\350\300\306\254\005N\222\252\354\340\007"
+	.string	"O\202\321\322\374\007\004\021\002\023PQ\360\251\206\306\017R\320\316\356\206\001\026\002\024\002\025\026S\310\342\324\f\002TU\317\253\250\341\002"
+	.string	"V\267\365\200\366\004W\312\327\230\375\t\"\006\002\006\027\002\n\002\030\002\031\002\030XYZ[\243\230\253\364\r\n\004\002\004\\\373\220\322\206\007"
+	.string	"]\200\240\232\214\f"
+	.string	"^\324\226\242\363\f"
+	.string	"_\202\275\352\302\f"
+	.string	"`ab\240\342\234\212\n"
+	.string	"s\250A\301\300\030BiDA\222$\225\016p\002bUE\007\021"
+	.string	"YdhDDDFA\232Bi9x\300 x\342W\bR>\365\307\303r\001\367\361_%\260\262.\361\0329\251\356\244;\374\265\221\270\346\337\241\005\253\377\240\2257n\231\356\3037\337\253\212\223)\255\216Q\335+\213\202}\367Ax\245\3308\276c\323O\210&\257\233\252\027\272H1\215\265\373r\020\023 \237\226]\300p&,\341\006\371\305\240.4\020\254y\376{_\001\332"
+	.ascii	"B\272Ij3\276\313\341\364z\027\366\231g\340\367\026&.\0134\376"
+	.ascii	"\323\307w>\274\365\242\331_K\003\275\377\257\225&?\355\033\001"
+	.ascii	"\227\002\213se\203=\f\037u\253]\332\237\355\340i*/j\304\304\247"
+	.ascii	"\023\244px\215\277\025Qy}\224\203\334\276z`=%o\030"
+	.text
+	.section	.gnu.lto_.ipa_sra.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`\261\002\315\n"
+	.string	"\262\314%%0U\322\030\300\300\300\200v\030\030\030\251\247V\246\033\021\325\031\277\312h\241\203zR\303\233\201\031-\231{K\231R\276\270l{\267\354\311\342\312*)\207r\242I\211\221\234#\247\310\206\234 \037\237\307\245\2451\003{\251\261\216\331upl\354\032\236\201qa\241g\005\305\204\351\363&\210\207=\035\032\030va\327\263\n\233\200\360'\230\325\276\352p\314\263`\3756\202o@\300M\300\251hm"
+	.ascii	"\273PF\243\317\3666\344\306\317\244\236V\372\212\360\274\016"
+	.ascii	"\3148v+\341\305\004d\250p\224\215$)H:`\002!VV\036\022\340\246"
+	.ascii	",\204j%F\214m\354\177\007L\305r\266J\037\261\217|\020\023\263"
+	.ascii	"0#(\017Ev\353-4\250%\230\344\315\210\006\217\306z\2218y\356\265"
+	.ascii	"\036\210\240\005\216~vL\266\026\2652\226B\340\243\214\210\b7"
+	.ascii	"\222\311\221\255\033!\0341\220\227&\315R\351\246AP9\004u\024"
+	.ascii	" }\304\0369~\212\026\244\024Q\266\211\321\247\261\201\355q\231"
+	.ascii	"6\264\032}n\303\366\372\266P\031\301[Z\021rf\005\202\337M\244"
+	.ascii	"\31123\315\236> n\274I6\242\342\211w\234\030\252\3207\272\303"
+	.ascii	"\230u\003.\356\273\254\326k\352\271\016\254\203\216\363\376~"
+	.ascii	"\022\223\004\214"
+	.text
+	.section	.gnu.lto_.inline.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`\374\ru&"
+	.string	"6i\222J\240\326Q:3\326|sD\320\277x\334\016\006,F\016\346\177\260\314\n\375\342\ra\365\305\261N"
+	.string	"\353\373\325\\g\003\257\303k\241\177\265\207\304+\274\0013^iX\277\300\031~H\365\2323\244k\257\303\231\265\257\254\375\266\245L\001p"
+	.string	"{"
+	.string	"\204"
+	.ascii	"J\310\256*\271\333\216\246h\232\363q\332-\274\375@&\352\356\035"
+	.ascii	"\223\367\373\n\254iw\033x\355\373\377\306h\372\343\352\177\332"
+	.ascii	"\357"
+	.string	"\343\356\356\223\377\032\344ew\373\274\036Me\263\3634M\331y\325(\251\311x;\313\316-\230)\351T\265\3473\257\212\0051*\312\375\276*\006e\303\312\003\363\265\217\347\256\267\341}}\r\252E\253%P~\374}\256\373\n\335\267\037xN\266_\335lk\313\327\226\263\177\317\332\201\230\370\343\006\025\363\007V\260*\257\035\313D\250*)\225Gk\34476\377\036\007\360*/u\267\355\002\026M+;\211zj2s\326\307<\204\340Pr{\315\321\024\210aN\363\030\332\321\224\205TCC\270z\200\334%\324J\362'?\177_\325\352\356\332s\266}\321\335\302\377\307_\270\243\351\356\215\177\325G\021\231\205\306\377\0069\270\367Xw\323t\301\333\343\376{|\304\361\r\357\362\177\352qxWV\363\fN\301\232Dv)q\307p\341h\272d\3411h\177\020\203%uX\351thl)\022e\316\237\n\2470\301\330\335"
+	.ascii	".!\002\307\320f\320r,\213ML!Vb\311\"\306\034\302\036K\212\313"
+	.ascii	"\013\314\377\343\253\036YQ'\200<\034#2\345\307\263\201\016Uw"
+	.ascii	"\323\234={\234_\200\223\001/h\036^\375\216\202\331\023 XY\020"
+	.ascii	"wug\361\2578\232V H\244\244\b\221\236\232\302rWaL\361\345X\030"
+	.ascii	"\227\231,\246+\306\234\243\370g\337\272@uL\013\330\027\021\322"
+	.ascii	"\312\013D-\322\205j\270G7q$e\224#"
+	.string	"\\M\252\261$C\346%H\310\314\002\274[{|\034a\333 \027}a\002\373q\202:2\304s\021!v>\356\017\250\007\236\354\0358\374o\252\341\024\226\215\2575\234\3022\277\341\346\302H.\267\2103;^\002\274\313W\313-\"\356\032\034\354vg\201'\250\301\275\241!\031I\222\024\2269\221\004D)\306\244\206v\022@C%\305\263,B\306($\022\214D\"\"A\242\002\205I\032\003<\323\236\312:\"$\022\026i\260\334j\272\212\022\246\242\233\224\232tr\030Z\025\235\r\210\013l\035\222\317\244\016\302\331\223\223\344\336\217G*0\253\216\365\314\020f,\036\373j\251\211\314\215\007\232\376\006\026-\311\211f^\373\260!\274;\201\305lJ\310<|\351\2014\231-\203\024kD\370\210\254\312\346r\251\266\251\006\355P\304W\321\252I\007\232B\370\244\3237h\320\307v\313\325\246w\251\247]S\371\t\230\031\202\t"
+	.string	"\240\250r\373k\002!v\237\347\226\r\351\366T\332\200\271\370\352\201\251\323\036Y)\021\200B\204\210\275\030\005_\022e/P:Q/\226\317\311\246\232\217\021\305Z\366}\336\031\334b\365\352S\343\255\340]\037F\231IG\224l\307\0222#0\024\346t\261x\377>U\366\234-w\321Ne\276\016Xf\312}R\031Y;l\245\317\305\334\224N\270\2600-\245\250\210\301\313af\t\016#a\033X/\210\177\271~F\350H\r\374\025fR\355+{\306\342\313\346\326B4\356{,\363\275\233 \200k\021>\004\354\2529\352\032\333\217qv\b\244pS8[\223g$\341U4\364S(\347^\216h\361\3270/EpCtD\336\211\222\006\200\251]h\022=\016\301\036v\f\342\277\334\302\365\206c\255\353\021\\\t\315FN\202osZ\340\261\340\235\322\342d"
+	.string	"\330\0173\211\253\b\216\334\266\026\f!\367\027\201\"\\N\350\025@\302\005"
+	.string	"\335$\321\243]\340\266;\205\337k!\305\232\245j\017\251\034\372^L\f.U\315S\362\325%\021 _u\217\265?\342\r\020\350\337O=\317\013\327\246\005a\324\025<@\366\0365\374m\016\211\017\013\202\321\336\363\250\322,\322;\007\344h\026\237\3429\370\237\203\301\266\227\372\351H\224t\377+\202\234\207\022yA\023\276\310L\245@\330^H\260"
+	.string	"n\206x'\200\330\324\252\235]\013\327\321ex1\212\240\236#z\020u\323k"
+	.ascii	"F\300\001\375,\006\343\023'\374\262\0033'\034\364pVeF\030\255"
+	.ascii	"0\346\217\033\007\354\002\255w\315\006\2556\304d\033\301\236"
+	.ascii	"k\372\363\212\223\274U\310\024H\362\251\370\362\256\"<iV\002"
+	.ascii	"\016sQX\340\t"
+	.text
+	.section	.gnu.lto_.jmpfuncs.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`\362\033\025P"
+	.string	"\332k\364\026?`.5\007T\210Pc\276!\250\024\356O|Ld\365x,\003\216juv,\245*H\023\331\275\311\032hm\313n\215\301'\360!\216\026b\246\300\207\210\002\\@\270\377\017\373\r\271t\313$SY\001a\001`\001~\317\316\240\336j\275\r`\355/\350c\025\244x\004*$\274:1\021/8\365*\203W\245\254\375\003\330\314J\235YB\366\031\030x\360\300\022\240`_\022^\361\242\002\224\360\212\351\250\326\002\262o\t\257x\213x\361\225\2633\353{\232\"\211\027\304\204\327\246;\342\265\201\354\3672\341\265)\213x\261\273\352p\314\340\230Y\007d{g\340\233\205\370\213\377\337\335\003\201\017\n\301kS\025\361\272\253\237\273"
+	.string	"\001\002l\037\242\\\345c\004\257MH:\274\273\265Pb\034\376\376\324\373\206\017w\032^\f\303_\320s\266\016\b|1\265\211\372D\215\342\031\256z\341`\020\277z\255mr\353\352\247J\301+8)\f\255\357\001\237\n^\3010w\254\340\025\300#\265\f\013^\001\254\021\357gGQ\035-x\375\246\250\\\360\372)\021o\027\274^@\342\375\254\254\034\325\213oP\277\340\365\022\021-\200\373`\360\372z\304\340\365\317\214\301\253mT\006\257\326\314\031\274\242\342\375\254\033k\333X4x\255\022\357\347Rgggg\252\265j\032\360\255\227\275\252\006\257V\274\237\203\267o\355ec\355\032k\317\316l\002\260g\026\304&"
+	.string	"\337\252V\375\017\216\333\017\216u\307\216\357\373\265\326/x\323\n\367\002U\002\001\210\210\367\233z\313\340\325'k?\214\301\r\367\243j\301k\324\"\021\314\374\253>\226^\027\274F\375)\363\202\327\2501\342\305_\300\007\003~\370Q\354'%\352\211\030\360\277\207\002e\351\235@\r\232`\377\215\330/\322#\373[\006|\334_\314\004\r^\241\346,\201\022\353\372\240\216\210\027?\031\022/\336\261\001\337U5\r^\237\346\210\027\264\266\247\246\247\343/8\376\017\261\277{\323\213\363\366\210\025\201\343\255\r\373\373\375\332\233\203\327\2470\326\002"
+	.string	"`{t\300\031\236\363\323\021\227\361\345\225\315\262\331\f\030\371\005\355\325\354\302\235\313\275\205\373\226;\013\033*\362\253\r^\255\361\376\341\204\013x5\204\265\366\232poB\324\204\310\226"
+	.ascii	"\377\275\304\024\211\021S\"\334=\204\273\203pw\017\356\276AC"
+	.ascii	"\211\"Eh\374\305\217\341]l\306\337k\355\004\254\317\335\252,"
+	.ascii	"\017^CA\342\375\264\336\277\252<\234#\336\357K\202;\325\2450"
+	.ascii	"M\204J\275>x\r\277x\211\223z\200\360\032&yd!Dr\312$\b\374\357"
+	.ascii	"A\327\337\267x\354\203\216\354\030\370_\257\020\350U\252\357"
+	.ascii	"^\017\370b\\\177\r\341\325\t\223x\325\317U\373\205e\214\016\341"
+	.ascii	"\325\311\217j\023\341\325\251\216x\255\036\373+\376bUQ\217\021"
+	.ascii	"^\235\310X\331\377\036r\345\340\312\0222Y\313?td4\227\033s\252"
+	.ascii	"Q\034\356\314Y\337\314Q\205See\320\200!B6sU6\317\214\232:E\313"
+	.ascii	"\\6c\300\030\361\265\273\245\034PT\347.\025\266M\222\243\006"
+	.ascii	"\247\252\200\246\274]\312;qg\312;\251,deq\210\220u\347\306\345"
+	.ascii	"1\035\311"
+	.string	"\274O\324\324\350>q9\357H^\f\030.\272l\351>wWfy\245+Q\027n\226:\260\236<\244BK\\\326c\343>S4\217\2258\363\274i\305\030\321e\323\235{\247u\005\337g:\346x\272\022\315\271\321\334:-\323\331\0343\356\314\344\250S\324,\311\221\307#\233\345U\232+y:\262&K\263Fy_Yy\247S4\3474y\352lh\331t:\356+\364V\242?\310vY)X\330P4W\320\2714=s9\036.\247[\357r\212\3626YzU6\352HXH\315\363\226\265\256L\363\356\334\273L\232c\366\262\361\306\364j\237\351\251\263e\023#`\234\373\307\030\b\017\251p\027\260j\021\262y\226\351X\366\320d&\367H\232c\272u\252u\347\3269}\273\215^\023\274&\264\260]\335nc\n\017\251x\265\b9k\264<\315\314e#\265F\257\256r\246r)x\r\320F\274\277sX\301k"
+	.ascii	"0\342\375\035\216/N\232%\t\035o\247;\364\016\215r\275y%\314\262"
+	.ascii	"+\335#o\200\2074=f\216;\345\235=F4\201\200\335-\315VdM\202NG"
+	.ascii	"r\307\333\235\347\226Y\216\272\005\267Q\357\234`\307>g\234\345"
+	.ascii	"\001\327\267q\247y\314cf\371c\314\355\364V\340!\020\255\234\216"
+	.ascii	"\264\016hm\207Y\346x.L\037]9-\315\362\001\026\026\026Y\333\272"
+	.ascii	"\307\326h\3562\361\225\323=\246("
+	.string	"\003\247\355so\235\267\316\221\346H\226u$.\227P\340\341\326\326\027W\266\3212\211\"w C\307\034.\2338\261\225QXyH\3262\215F\013\323\344\331Bo\036X\201\r&\345XXXii\252\b#u\016,\312i;=O\022g\214\005NK5\252a\204\351t\212\376@\301\244\334::\356qGs\262\226#\200\3573g\262\314\215=\3142\201\207e\033\262v\2650r\2373t\343\036;w\327\224\207\244\346\345\36443Z\346\255\232\207:-\267\017\232\207\020\274\312\307\3650\035\365\276Qyx\246\231\324\271r\304=\360pB&s\265l\313\032H\211f+\021\255\211\231\324\344x\346r\330\216\333\2313\277rhy\215\330B\001\206\345U\373:\215F\232z\223\3058K)\017\303\320\335\t\226\321Z\356\240\307F\224W \201\372\250\361@\246\224\232\021\021I\222\2440\214\001\341\004\204(\351\240t\346\001\022"
+	.string	"2Q\n\204I\f\202J\031C\f\"2$2\242$IJRX\016\205\2229\022R\277\263A\247\024\261\267\307\240p\247c\234\325\224\030\333\350\021\023\"\200u\303\332\335\275\313o\233\301\246=\202\232\020\224\003\273\326\264!+{zY`J\305\3364r"
+	.string	"\324\206F\214!j\016\377\026\002\262\303\240\312\272B\352L\2424\037\316\026k\021<\264S\303\365\324H1\272D\247\241\037\b\255\202&`,[7\236-{\226\301J\026\336\335\275\370\240\351FL8)\356\2428f\026lA\304.`\210K\nY\343\330\020-"
+	.string	"\021M\001V\366HB\013\026\327\013)3\234\210\3255\t/$\340^\323\\\375\223\013W\022~r\314K\017D\275\225\355\246\224.\312\274\342pa\261\354\334,I\020f\237\302\0324\305\024\\\367'\022\\]\202\203\251\214\235\220[\030\007\020\346\241\025R\305\221^\370\250\354\362`Q\277\213N\255]\251\025\216rh\\g\257\372\257\352O:\303s\307\222A\275,G\243\354\030\252\030\235\247\302\342\001g\331"
+	.string	"\361\3200u\320\256\355l\023\004\222\250W\f\r3\177\363R\374\267\334\247H\033\304\233\3004\374:\347=\232\371\243\211X\341\351\303k\361\206FUB\322\264\220\256j\254Xs\236\240(\237\271\007\275\207~%$\001\320\033$\366O9\374[Q\376\303*M\205D\354\030L\314 !\002%\256\263S\r\225]T\301l\237\222\221\032\243\260\325EW\231m*\365\"\334\0242\272/\023Z\253\363\275\t\3021ul\230:\002\003\320N\234\354^\024\325o\271\357-\0334$\021j\251`\250$_\310\345\004+\334\255\213\364\364"
+	.ascii	"\320\246\353\023A\201\270\364\r\005\201\262\023\320\333\230\332"
+	.ascii	"\346\r7\230\350x\024\350\021=\206\3511 y\\}\243\224\236r"
+	.string	"_xT\361\340r\007\215${\354\256#\310 V\177Q\n\221+\026\266n(7|\306\177B\305\353\351 M\251\3443\\\303D['7?,\265\325\214\2603\247#\243\323\336\223q\371\247\032m\266\201PV\005y\020\216A\304C\346S\360o\3405i\020ZH\273U\024i\270l\200}\005\025Q\370\246\025\306z\"l\272@\302C\017\\\345L\312\3063\356g\351\024~\343\300\350\332\n\034\365\361\371\343\252\b\336v\244\016\0024\227B\336\237\304\002\317?\254\265\016\346\211\355\bW\370\227CI\220\322\362#\033Qa~\211\335|%\376%\370\333\363\373Y\261{\263T\016l\024\035\372\375\233b\220\340e\241U,B\307\271\215\312\216\230\n\361F,"
+	.ascii	"z\237K\342\"\211>\034\017\301\326\036|\332j\204\3210\016\rE{"
+	.ascii	"\350\277\021\243\250\b\020"
+	.string	"\315^7I\275\305\341\272\336\026,F\t\252\210\350\377Q\367@\022\006\372\017\333\300\231\355\320\230,\336\262\224}7\300\016\377I\2741\306\260\031\021\230\t\233<p\361\027\376 %\217\252\266\274\320W\b\372\322j\305-\211\224i\247\273\361T\353\242t\310\201\002\202\020\323\205\245\256\277\"\034\212\244]\2164\002\210\327%'0\341\265\264*\006&xe\355\030m\f\270\205\217\r\303\221JU\016\263)\375\027d\337-\241:\n$h\241\030\353\n\210\243\255A>\362\241\262\217f\025\024\3249\t\005\334r`\263\030\031\337E\225\360\360.0a\f\253,\325\277\210\240rxv,\034\225\ft\337\036\034\013.1\030\253\2106\356nH\371\361\033[\003\t\246\331\006O/\302\030\002\262\3417\317\263\315\217Y\364\211{{\246nh6Xkx.}\026\315\3308\301\377|Y\363$\370\302\223V\221\302!Q\202F\345D4J\362"
+	.ascii	"\375\363E\007\307\346\317\232\004\201\351l\351\351\342w\343e"
+	.ascii	"\266f\337z\303\215Q\034d\331\276\002\255\204:\215\365\267\257"
+	.ascii	"\310\375\\\245\022\232M#6\021b\233;\240K`9\322\002R\236\024N"
+	.ascii	"\365v\205\225\263+P\220\332i%\017.n(\007\335\227\210\237\211"
+	.ascii	"="
+	.text
+	.section	.gnu.lto_.pureconst.518b89b757251988,"e",@progbits
+	.string	"(\265/\375 \241=\004"
+	.string	"\022\312 &@U2\034\215\313\300\345\344\320u\021\246a\030x\007w\317\177\243\273\323\317\350\331\335\262u\301\320\260\365\315\313C\331\001\333e\267l\026_\331*;\305Q\\'n\342%N\342#.\021_B\034\304\365\341\036\336a\304\241\264\341\032\236\341\204\341\027n\341\025N\341\023J\022B\020\376\340\016\273a1\f\256\205\255\260\023\366 \3549\330d\340\005N\260h\300\005<`\020\200w6\3077F\232\235\021R\021J)\230"
+	.text
+	.section	.gnu.lto_.ipa_modref.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`\026\004M\020"
+	.string	"6\225A:@\345h9\030\346(\212\002\\\315\240\353~^UQ\024\201\253Jj\255\315*qw\t\\U\364#x\205G\203\265\310\007a\202&\273\303\243\002l\375\006y\022\216C\204\273m)S+"
+	.string	"1"
+	.string	"6"
+	.ascii	"\035@y\315s\020\260\363\374t\232NU\271\252\023T\016j\246y\177"
+	.ascii	"\177s\356)\237\351L\225\247:Q\345\250f\377\002\357N\370\315\202"
+	.ascii	"3@\031q\333*oU\233\254rV\265m"
+	.string	"\317\017\363S:p`\r?\303T\340-*\027u\256\312W\n#\360\240\327`s \346\275`\273\376\264l\036^\263\233\225\374\037\327\267\255\177\354\034\211\324\211e$\234\004\034Y\204!\004\371\303\243\343U\345\330h\253\221=\271S\371\251\233\f\f\256skw\225\027\026\255\240\230\220\b\207F\246N;\324\205F\246\256\263L\351\030\230\373Rj\247\201RT@si\371Y\272\362\257N\b\002mUR\036P\316\216\036\345\344i\362-\001\235\364\312\031\200\203\250!I\352l\223Jac3`\202Q\212l;\021@\235bT\242iA2\355o.\224)\302\267\254\255\247\237^m\224k+w-\266~\216\273\337\215(1\026B'\256\f,\022\330\255\376\276\234oY^C\324\327@U\231\236L)C\3438\271\333\320\321b}CW\034\037\215j\362We\334\017\207\220\324\375U+E\013I#5\261\201e\261a\222\004\361"
+	.ascii	"\t\311\361\205\235\025\022(43P\264\323\037\360;dnQ@TA1Q_\200"
+	.ascii	"n\223\r\200\302\00116\3130\222\016E\3279\264\034\004\351\353"
+	.ascii	"\001\346\203\305gs\217g\rJ\262\206LX-\316a<B\365\216\363\325"
+	.ascii	"\223\360\377\027k\277)q48A\030\020\030\320\301\004o\347k\037"
+	.ascii	"\245\241\b\236\305{h\227U\336!f\\Q\327\312=\003\030\2231\035"
+	.ascii	"\210\n\314\206\224\252\034\026\251\361\256\345%\021d!\225\361"
+	.ascii	"\211\026\212\350%\002\253W\246"
+	.text
+	.section	.gnu.lto_.lto.518b89b757251988,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_simulatorAddress.84.518b89b757251988,"e",@progbits
+	.string	"(\265/\375 \\\341\002"
+	.string	"\027"
+	.string	""
+	.string	""
+	.string	"9"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001'\002\206\b\177\212\001\206\200\200\374\235\362\300\232\036\004}\273\001"
+	.string	""
+	.string	"\n127.0.0.1"
+	.string	"\013/root/repo"
+	.string	" ./src/main/target/SITL/target.c"
+	.text
+	.section	.gnu.lto_lockMainPID.89.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"-\007"
+	.string	"BN23`M\323\001H\001\220$\243\005\263\332\036\231C\021\002u0\003\265\"-\375\266=\016\360\033z\276k\313\"\260\215\207\220\035\330\316bt\263@\203\264\275\245L)\316L\007\t\006\b\320\322(T\030\0136,`\030`\246\332\300I2\345\240\251\240EQ\025\274l{\267\332Q\2258*\341(\037\362\221\013`\227\363\350o\027\331\370\034\177~\270\362\361\317\277\240?\033\"\"\037U\245\t\315\354-K\315\260\357V;\366\323\352\006>Oa\331\255hYY\224W\342\261\215\331\027\377\363\017\3146q\333\206v\f\017\n\022\225\335\205\322\005\240?\367"
+	.string	"\350O5\216=1\377 w\035\027'Q\313\236Q\301\356:\243fq\353m\023\330\236l{\002\t"
+	.ascii	"{\311'cz\366\206}\017\026\272\206\357F\f-D&\356\212\251\235d"
+	.text
+	.section	.gnu.lto_sendMotorUpdate.90.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"u\007"
+	.string	"r\21634`o\032\003\024\022R,\341\206\221\377>\372\260\203\016\327\017\370`\260@\325A\366P\017G\357\r1J\3554\0043z\031\242\b\035^\257\234z\264]\331\244L)\355P\b\n\007\t\022\363,X\034L:0p\032d\307\272$E\320\352\301cI\254\252,\251\341n\314a\310`\243\373\300\212f\236\200\2332Y\344\222k`\205\304\243\n\342\272&G\213\314e\001\377\307\263\026\361HD\375\341X\211\354y:\326\331\344\330NP<\317>\023\215\316\002n-\267=\310\321\032\363\377\205\241\026nJV!\375\030/.\357\"\nH[k\252\265,\346<\356\321\311\005\251\345\277\204\035\326\374\264\332!\316L\320\346\007P\360\277o\2022\\\350\266\233\266T\333R\013"
+	.ascii	"{\3117c\332\371\206\217Lc\300\021\200\361\036\225!]\306\277\214"
+	.ascii	"\013.\335\242\235O"
+	.text
+	.section	.gnu.lto_updateSensors.91.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`j\007u#"
+	.string	"*@\260\rD\200\330*t{\206N%T\034"
+	.string	"r\373L\3045\237&H-\350\"\355x\224H\317!\007L\220a\324\335\375\237J\326\024\205\025\244\354\342\261~\207a\231\367:\222(\335Eq\022\304I\020G\345\031\331\233H)S\301"
+	.string	"\256"
+	.string	"\323"
+	.ascii	"2\224\037C\371\303\311\207\231\374\227\311w\241|!\345\323\311"
+	.ascii	"\237\223\037\234\374\016\362\271\371+\340f\b\234\336\021\270"
+	.ascii	"\037\255\227\254$\226Y\252\222\251\214Q\307FG\243\226\226\242"
+	.ascii	"\307\337\234\221\270\205\202\266;\226\007\207M\276\221}\303\235"
+	.ascii	"?\207\177\270\223\016\377/\377\213c\337\3006G\207\265\251\225"
+	.ascii	"-/H\255\311\250\023]v>\271:t\247\313\342\320\235\007\373\375"
+	.ascii	"6\331V\205k?\314\344\254\324Z\211\355b\301v\006\233\301\2760"
+	.ascii	"\310\260\235&6\030\004\200\346#o\006I\026\304\321s[\033\"?p\007"
+	.ascii	"\213n \354f\220c\301\241"
+	.string	"\217*4V\307r\b\344\007f!\201Z\353\371\fYbO\367\277\203\377\b~\341\215t5\360\202\335\342\253\201r\257\233r\205h\260\300\305Ewr\007\275\330^\223\021\307\327\337@\267'\300\361\2211\226\177\201\354\335\206/\214w\035y\317\216t\347\366\211\0212\322\336\320\304x\371'\307\270[\374\033\254\315\366S~\026\345cQ\376\025\345[Q~\221\362\253(\237\212\362\247(\237\2709v\245\204|\250\311\177\022\362\235&\277I\310g\232\374%!_i\362\223\202|$\312?\242|#\312/\242|\242\311\037\232|\241\311\017\242|\240\311\377\231|\237\311\357\241|\236\311\337\231|\035\312\317\241|\034\312\277\241|\033\312\257\231|\232\311\237\231\374\365\317\321\351\235\026B)\2331\266g,BX\2756\235\226\t\373\273\242\274a\233\276i\234\336\376#H\340={\221Y\207=\253q\260\372\246\367\f\360\252m\360\374\306\364\350"
+	.string	"s\372\252\246sz\347h\272f\246idzf\227l\023&\274S\246\017\311\n\033\353\310\016[\330\033\007\323\303\227\206q\351\227\250M\222\347\3227b/\355M\351\241\206\305tV\237\313\002w\271\334\017\241\264czy,\222RN\204\215\271)\263i\257]Y\022\274\r\362D\205\223\27221\265\372\303\220\325*\206\024\354\331B\271\262\031c\274|w\2609\257\fP\214\227"
+	.string	"\326\2101@[\255dW\277\326\026\331r\251\225,"
+	.ascii	"\0210\026\024x\366j\255\013\243\003"
+	.string	"\335\331-\263\243\357\212\222W\004\257 \225\241\302\227\261\213x\341\330\325u\324\372\371\342\302\320\327\222:\300\240\300\002\342\327\026\005/\343\027\361\202\005c\027Q\313+\003Q\252\350G\f[^\304\257\343\321\2138L\212-\001\261\036\233@\254\324L\355\324P\375\033@\360\324P\\\215\305\245\320S\027\233\332I\213q\357\262\fh\352\275[j&,\306\365\273Rd\251\327\217O\231\324J\035e\266Ej\253\030\331n/\301\006*\330\300\244\236(L\250\245\275\355pQ\033\365Q#\365\337\340\201\024\244~A\263\352\243\2526\232\352\"*\304\236\"jbo\335P\023\t\365P\013\251\004\265P\224\277 6\252\256\002j\252^\272\237\006\362\351\237\026R\351i\237>cq\357I\017\037\t\265\2647e\261\255x\272\330\333c\247y\234L\341\003\242\"0\231\f\200\204\250a4\343\0359D\022$)*H2\034\360\002\221\221\"7\021"
+	.string	"\241b\220\241Am=\263\031\310W\264\247T\214\027,/#g\221\341\022\005\277\022\b)\t\25025\313\026\004\004\202\217,\302\270\013\260\201\031\004\334\373\211\271\205\371\343\340?h\267u\245\320C;\333@z\007m\327\243\002\f\377!$k\363\305\306\201[\247\260\211\f\261\220f\361<h>|\262\342\232\215)\214{\n>\001#\256\\\376\325\277\306\237\213\024$"
+	.string	"22\270\340i\302i\024\262\370y'\034\2419?@\237\373\326\252zHu\361\203\037\033g\300D\226"
+	.string	"6G\n\232\232Z\322\002P<K\330\347(\355E\221\215\311\256g\377\213:\t:\211\312y@\356\200%7\360\251e\310\020\334)\376h<26vgQ\333\303V\035"
+	.ascii	"W\263\246B\336\360\265\377\312\363\354z\274\301A\230\206\324"
+	.ascii	"\354\371\217\230\006\203\233\3426^\r"
+	.text
+	.section	.gnu.lto_updateState.92.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`]\t\2355"
+	.string	":`\350\024AP\246N\007\003\320\330>~\354\352\212\277 \031(\024I\261\207\250\006\263\324\202#L\370\036\030,Sk\024\021\275\364\356}\340\031\302\331\3354M\277R\035\271k\341\337Z\234\325\335v\267\275\367\336I\246\0248\001 \001F\001\257\317y]\273\034\237\323\255\334\353\346\325\3628m\200\311\027\207\353n}\256\035\316\233\246\363,\226}\210!d\024f\316\231j\325jw\343r\335.\037\234\031n\004\262I\032\214\325\3215\316F\313\333<@\360\225\314F\266-M\222\305\352(\202\323\323x\\w\333?\034\256\r,\261\"\245\214\243\335?\272[G\261\237\3616Wv\213\306\335^\177\343\032\213q\266\f;\261:\3529\311\227R6 \236\207a\277\"`j\314\234\223\035\222A\316|L\346-SZ\362\31289\332Q\253\343n/\343j\257\257\tq"
+	.string	"9[Y\263\31499\241\203\253\243\235t\001\251\243\253/\245\216\366\333-\310\223X\262\273m!\272)\3129\007\377\212\277\336\262\277UM\321\363\361\333\316\032\273\274e\225\236\240L\354\211\377T\020ebM|MP&vt\3658\207\210S\337\023\326\344D\220sn\215C\214\236\f\210}\\\216\214`'\223\242\2569\357\022\346\004\237\251Y\034\24121'\376g\024\230\"(G\306\257\023\270\210\310\307\225\216\213\030\205\030\253 r\316\215\213F1o\240w\367\230\356\266\352\376A\005\215\267\\\243\362ov\276\277\215\266;_xQ\267\234\033\022\3139w\203\257\234\275\024\374\237\357C)B\334l\374\377>d\266\347q=*\332\2654\326\n\354\305\025\251\243\370\035d92\275\377\214\263DC\246\027n6\001\334\355\342\005\366\"\323c-uK>\246\360\273:"
+	.ascii	"v8W\302X\213\022\274[\006\r\354\305v\245O\325\245\3611\301\276"
+	.ascii	"\253;)\304o\326\355g~+\335.n\016.\356\r^\347\255\301\305\235"
+	.ascii	"\301\305\215\301\305-\345r\274/\270\270-\270\270\243\\\334PI"
+	.ascii	"\270+ \341\246\340t\274\203G\270\237\216pOpqKpq;\271\270#\270"
+	.ascii	"\270!x\322\273\311\327\334\0178\2337\223\213{\311\305\255\324"
+	.ascii	"\342\006\300\342Nbq#\261\270\217X\334.\213\033\310\342n\201\270"
+	.ascii	"Y \356\037\020\367\312\342VY\334)\213\033eq\237,\356oqc\026\267"
+	.ascii	"{Xzk\303\213c\266\345\361\222\031I\223Q\316\203\316\241\271\034"
+	.ascii	"\367:w:\356Iw6\3677\377\341\025\253\370\327\355\355tN\247\335"
+	.ascii	"\256[8\001t|+\205\257\360\336ti\360)\274\2220M\242a\227\247\017"
+	.ascii	"\276\353\021\373\274*\235\360O\022~\302\253v\210}_\007P\222\354"
+	.ascii	"/Z\352\364\022\036=4\034\003\341#\274\323\273\235\267\020\246"
+	.ascii	"\0314L\023r@\302\206\251\276YGx\bo\003{5\316\270\213\213\007"
+	.ascii	"\f\030\251\243\021\236\200\2375\257\353w\213+_\2645\347,\005"
+	.ascii	"\341}\216+ \343\303lDS\236\340Iq\244\354\333h\373\363\373\365"
+	.ascii	"\331\1776\304\243\0207\177\177\352\021\313\004\361*\200\330\224"
+	.ascii	"u`H\322r\367\207f\023Q\323\257?\305\245\216(\306\001>\360\335"
+	.ascii	"\257\227\027\fV\003&\317\327wy\240\2650k\350\233\265\\wc\005"
+	.ascii	"M_`\t\231\266:\352\247\337\364\230n\230\246H\375\247,GD\351\303"
+	.ascii	"-\371\"E\355\217hg\364\234\013p\222\267]\352j\274\320\253F \217"
+	.ascii	"\220\357\275"
+	.string	"\310\227\314\253\366\252\245\216\272\032\037$b\315\331K\317\005\275f:\204\b\354E\021i\034\211\022q>\205\f\343c\016\277\253\231\376\017\272\307\007yD\277\035\317\363Z\316G/\261\027{\231:\372n\305\275>\341wA\326\234\277\244\332\371\230@\241EH\352(\372\352\034\036\2765/\334\fUVZW\247\n$+\213\252\252\206\326\325\252\265U\203\013\353*\345\302\272\252a\305#\307\326\016*\253, \217\034.\250\266vX\335X\267t\364\370\256zJ1u\302Ep\313\nG\026\325V\360*\007\025\217`U\226V\360\tAc\365\260\312\nnaae\005\333\244\227\237\371\2554\b\257\027\342\366\305\356\220\216\307\316\300\265\261\\g\316e\037\374\315\235\311\206\233\r\205\035\016\223\275d+\236\202\251\274Q\246\274dd\351[\3455kc\\\372\206\362\242=\321[zu\256\211T\372>\276gGX\230(\275\312\326\307\267\006"
+	.string	"'\301v\212{"
+	.ascii	"~\200\232Dy\222\214>\356\212{\030I\022\222I\236\0245\377\275"
+	.ascii	"Y\273\235\227\030\353\243Vp%\3041.)>\342\032\276\210\333\271"
+	.ascii	"'Q\216\365\251O?,\310&D7i\373\203\364\302\027\351F\302F\336+"
+	.ascii	"\275\304l\212{G\337\364H\377wC:\356\267\177\364\250\036\0211"
+	.ascii	"L\362\306\300\314-\337\200\357\276\017\273px\340\247v\206\030"
+	.ascii	"\276}\247s\247\271DB\2747\346\206\317\360\0344\374\206G\033e"
+	.ascii	"x\245\2668<\251\267\360\030\336\207i\027^\352\321\273\250\207"
+	.ascii	"z\013\177\272e\301D\336\263!Q\317 \213+\3373\250\363\016\224"
+	.ascii	"\200\262\250q,\205\020t\250HDD\232\202\024\322\030\200\002\221"
+	.ascii	"\2512v\021\200ET4\223$\323\030\036\206\177\307(\357\375\n\022"
+	.ascii	"v}0Jr\204\b\354\314\302*\222\376:0\036\311\302\233\343b\354\375"
+	.ascii	"\324\001(\272\257Y\216\307\220\301\200^\214i\343\246v`z^\200"
+	.ascii	"\265\214o\327\374\301P\003\361\261\215\244n\234\243\013~16N\237"
+	.ascii	"\\\313U\b$\270\270H\244\255\257\241\346D\300\004g\266\256\201"
+	.ascii	"\033?!(^\003\345\013\260\2558c\375g\243\300\315\b\037A\304+\250"
+	.ascii	"\0063XK%\346\352OW\206~\274^3({ h\007\006)\373\315\310\232W\025"
+	.ascii	"\327\006d\005\364N6\207]\356\277I8*L\264z\241\244\034\356\t\237"
+	.ascii	"c\333q\300\006\203\2075\032\271\032\244\344-\200\366\226Qj!\236"
+	.ascii	"\352m\031\262\254\357\204x*\253v\311\241+\232a\r\2778s\242W\370"
+	.ascii	"\374\334\203\233\270\362\005\320F`\023@\303DX\325 \331i\025\302"
+	.ascii	"\032\316\025\223\361\360\224F\247\243\311\034\326\005\346Wfk"
+	.ascii	"\032\221h}\244P,\321\032Z\3733\320\017\006\331l2\227\240NR\221"
+	.ascii	"E\0227xr\243\033\250\001g\301\004\203\316L\250o\324]\350\350"
+	.ascii	"\213\314f\200L_y\224\017\263;\204\264c4r\013\3118\327\316\023"
+	.ascii	"\374%r\277\216\234\265\"\354\252\031\370\262\324B\370\326\234"
+	.ascii	"\216\020Py\224\256\006"
+	.text
+	.section	.gnu.lto_onStatePacket.94.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`\322\001\355\020"
+	.string	"\246\236oH\340\222*\035\220\202R\226Y\305\233\327\264~\265\365\024\371\2763\355\257\nt\0205G\n\343;\027\005l\212\367h\264Y\235(x\323]\323\037S\026\206\365\241\271a\332\020\025\357\370q\006\343q\335o\321\327A\b!{\357\224\002["
+	.string	"V"
+	.string	"Z"
+	.string	"\227\251X\020v\202e#\262\273\"\205\371\263GS\007?\257\206t\246\3749\023\204,U\007?%\313\366\031\242d\231_\371r\017"
+	.string	"\214\313\253"
+	.ascii	"\230\227\207\265ALf\305qZJT:\253a\343)W\223\336\366\372\002\306"
+	.ascii	"\016Y\272|\202\020v\327\223,G\334#\267m\302\366\003\3739\001"
+	.ascii	"\265\273\202o\305\320H\0066\273\"v\212\354\316\253q\361\332o"
+	.ascii	"\3776{l\327\254\013U-\341\r\326\022\262\273%\367\354\300\236"
+	.ascii	"\262\323H}\246\342\221]\024:\013\302{$\365\323~\214\307R\227"
+	.ascii	"\361\341\003v];hv"
+	.string	"e\t,\206\367,\273\201\357^x\002\337=\247\354\234;\026U\371\257\273\273\237\002\234\033\026\236\303\371\333o\240@>vWN\372\270\333\330\340\267\270g\023j\236D}\035<\314\223\376\344t\273\025U\035\310\265\206T\372\362Oq-\227\216\220\272|\020\267\356\253\024\324JA\373\261\232:\264\007\220\031\216\322\227-SM\020\211X\214\251\313~\243\233N\243\221\303\370\225\306\f\026F\241\013\240OL$T\210@A<\215(\245\320I\034\211B)\342I\311$\232\220\230\244a,\211'\022\251$z\366\324\345\t7\273\025\312\"\003\322\227K^i\200\031\032\217\325\324\361g\372*\337\315\367\333s\240\020\324\374v\032Q\230;\216\021E$\302\2202OVZ 7#( \200\202\231\272\363\273\363GlW%$E(\nI$\211\240$D7AK\026\034\t\243\311Zj\211.\213 \032\265\342q\027\330j\361?.\030o"
+	.ascii	"\332(\210x}\257@3M?,\257\333\372,T6\226\006\352\267{\260\005"
+	.ascii	"\260B$\006\277\016\362\210u\362\352\325\310\3170]\202\f"
+	.text
+	.section	.gnu.lto_physicsUpdate.95.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`'\004\305\030"
+	.string	"6\254\230F\260\034'\035\274\n\007\272_BT\005\034e\204\315^\247:\024\215V\036\f \r\271\321\233\336c\n\352H\267\366@\373\372c\347\306\024\321e\362K\323\266/\356\2428\352*p=\371\027\276\251)\257\214XB\210\334)\005~"
+	.string	"x"
+	.string	"\220"
+	.string	"\256\022\322v\204GG:4\273\313\340\237!\204\377X\336ql\177\332\327]\311\354D5>`7h\n\322.\351\300b\370\317\344\013\200\377\302\023"
+	.ascii	"\377yf\2339\231\333\024\221#8\234\260\331]Q\211X\357\221\267"
+	.ascii	"7g\377<\2353?\245a\311\021\350\226F\034\355\237'`wsp7\274\007"
+	.ascii	"3\007\3166"
+	.string	"=#=\2567\372\202$M#\256\307gJ\303\356z\2168\0367x\3331\333\023l/\026/\362R~\302\335\332G\037\312\243\270\360\207\376\031\366\363\003\024c~4\353\2464_]\336\323\306n-\301\324\337\262\330\376\344G.\375!\3130\322\374\370\3177\222\362l\201\002R\233Q6I\233*d\377\253A\266\316\211\376\325\213n\225N\207s:5\247\3019\375\315ioN\353\234\236s\372\005TOo\266T8\332\325\021\365f\231\276\244\"/\272}\3227b\362&\263\027\005)])\201A\002\222qi 7\342c<)b\\J\340\371\256\265\223k\002u\245\264\004\365\205q\331`W\342`@'_\\f0q/\255\013;\246O\003\244YB\222\344i\027\227\nr'\316\245\025\346|e\334\342Z\\b\330\355.\005\033\305\263\264,\344\376a\271\321E\245.PI\265\031\245\272\2734U!\265S\374\212\025\025."
+	.ascii	"\271\241\032\340\277\031f|\252\271\347T\\\206\273+AIU\271`!Z"
+	.ascii	"\315\251'_\276\016\354\246\034\211\205\317+@>3\\\236\354\005"
+	.ascii	"C\335\263\003\202\204\007\036Q\266\202E\314%\023_\370\270\\\210"
+	.ascii	"=1 q\207e\030\214\0251Q\006\203\305D\034r\377\325 \213\370\301"
+	.ascii	"TS\233\017L\326\255\005<y7\265\ro\363!B\016\312\346\320\001g"
+	.ascii	"\310Mi\366\327\320\370h{\270\232\017a\250_r\217Hwe\364\361\251"
+	.ascii	"\220UN\252\243\3524\031\\\2459\034\\\245_S\344dc\266\271\267"
+	.ascii	"\273\3535\270Ju\364A\2224\335\204\330f\224SiB\374\t\215\210\237"
+	.ascii	"1\023U\250Q0\246\030\203fDf$\315&I\007\300\002\221\261Z\007\022"
+	.ascii	"\340EE\312\fEF\227\247\375\016;\371Y\3371\316C\321\276C\023\227"
+	.ascii	")\327\315\363\004-G,\314\036\334l\017\026\250\316\252\267e\263"
+	.ascii	"\341\357\224f+I\223\230mX\357;`\230\331\275\311\fA\322\302\312"
+	.ascii	"!\3304\230\306\206\177\240\330VF \347\351\"\237\031\326\223\246"
+	.ascii	"<<\bF\240\263\273\035\327k9_\335\374J\202bJa\320X\032JN]\264"
+	.ascii	"\221 !\301as4\213\221\221S\374\350s\233\346\207\355}i\325\366"
+	.ascii	"[\001*\323nS\2429\253E\2407\t*\355r-J^\236t\022\342\017"
+	.text
+	.section	.gnu.lto_onPhysicsTimer.97.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`\240\001\035\020"
+	.string	"\026^kG\360\220*\035\360q\006\362\217\352\222\345\032\376\022+\375\230\367\310"
+	.string	"\327\303\303i\274E\2725\207\351c*)\326\330"
+	.string	"\252\271\264\261p6OH\230\310\330\231\2549C\332~\r%\227\027\fO\250\027fvD\210\354\275wJ\001T"
+	.string	"T"
+	.string	"U"
+	.string	"\035\333\353\346\003\266W\2036\215\217)\253i\271l\210\305\354n7[\240\244\343M%\370J\247\004}\330\t\274f\241xz\245\232\324\311\b"
+	.string	"b\212\206\310\300\320.\273T\211(IK\240|^\366\002\256\227PD\271\324(\330]\313P\354po\267M\262-b\377E+\233{\354\365\323\307\356s\034D\013\246B0\333=\231\271\261\265J#\361\330\355\253\370\262\330\310\327\204\003\027\306\200\001\263;\032xu\202\315\3539\266\345x\024\340Sd0\267\033\302\006\310\346\325\203^\332?q\027\370\227\206\013\330]\271\260\330\035\017\270\333\274z|R\346tw\227N\326G\266Onn1\256\027\223\017(9\343\216\374\312W\2046\273$\017}\226\253"
+	.ascii	"\371\"^-!$\037\206\266W{DA>tg\346\232s\305EJ\234\336$\235v\205"
+	.ascii	"\013\362\3416/\373W3\023\265\222y\262\307\223\234,\373!)20\236"
+	.ascii	"\001%\321\bd\362| \022\006\217S2\211<\013\336\366y\023\036\210"
+	.ascii	"<\0214\376|,p \322\2403y\020>\217\251\023\201<\241\356\363\225"
+	.ascii	"\272\017\017\217H\336\327\231F\243\257\343\214\373\271b\320\242"
+	.ascii	"F2Q\016 \257rZ\250CF\313\307\223\260s\314Z\352d\031\204er\223"
+	.ascii	"\363 \267\371\251r\247\006lFI\" `\202At\347\001{\362\t\r;\267"
+	.ascii	"\201\243X\212\023\214\003\3026\320-\255\265\013\260\303\002\217"
+	.ascii	"kl\374C\2612\214U\232X[I\2019MW\374:kr\263\256]\021\241\0055"
+	.ascii	"\261\247e?\303h\227\245a\364\272\207\310\032d\200\372A\236(w"
+	.ascii	".\363\004"
+	.text
+	.section	.gnu.lto_ioThread.98.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`O"
+	.string	"U\t"
+	.string	"f\221A:@\217\322\001\340>\274\310/\002\235\203\225F>\036\334cp\316\302\317` \255\361+\241|S$t0\214#f\253\375c\035+\341\344\342\002\336\360dF\305d]ZK\310\336)\005/"
+	.string	"/"
+	.string	"3"
+	.string	")\261\r\224\230\335\262\272<\201\346\\w\001\3159\352\361\361s\364\377\272A\310\314\013\214\312\212\374\334,\354\256\247j\305\272\351m\203l3\330n\t-{\233/\230\3533\227]\216\232\314\3028\026\020\333\243\315\261\375\371\022\307\036\260\333\"Y\331-\021\\\273s\266\375\221\273F;VP~\2606\001\0225\021\232\f\203\246\f0\375\023\223}p\023\320\n\347(:\215\004\020\252\2423\203eP\322\333\264-.\346U\036\250-M\226\242\244]\222\223v\330\337\226\006\376|H\247\317C\362\2760B\004\226:\236\350\2216\217B\016\242\206\207*~\020\241'\326S\3113\325Q\210\252!\217\301\211/\254\"\b\206\225S\356\267\245\255\372\f"
+	.ascii	"{\311'c\272\373\206\227\214-<Vwl-\2326\273&b\230\020.\201\022"
+	.ascii	"@e|\265\363\t"
+	.text
+	.section	.gnu.lto_printUsage.99.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`[\007\025%"
+	.string	"6?\336C\220\3566\007\2447\243N\rG{\372\030FQ\321\034f\001\0204"
+	.string	"\240\304\325p\253\357\021D\216-\226\256l\365\2225i\336\200k5\342\277\360\3474V\370l\026t#\221#\002PK\311\260\235\214v\2232\245\301"
+	.string	"\335"
+	.string	"\312"
+	.string	"\376`d\270/\370/3\217\360\035\376\322\007R\023\247\344j\274Oy\217{/,\306/\325`\344\253,\373\270\357\322\"@\023\024M\377I\177i\003\004\337\271\237/\352?ymS$g\303:\271\343\234\252U\342\376*\324&q\377\250\177\226\255\376\325\352\253Z\335\253\325\273Z]U\253\333Z\275~\3657\340\202\3729S(\332\243\320 4\327\231\2212\344\356_\335_\313o\271}\224\214\037\200\242I\302H\241(\316\345\257\357;\307}\001\357\273\357\tx\337\371\315=\317\343\232\240\253(;nx\001\204\242\350\3132\371\333\327\233\377sy"
+	.ascii	"O>\234\276\256(\240(\352\365\311\307\217w\373\356~\300\335F\271"
+	.ascii	"\253\3108>+K\003\265JoH\224|\251'\206I\245Qg\254\254l*\220g\037"
+	.ascii	"W\321\233\223'_\352"
+	.string	"\361\210\362\204\006yV6\005\325\t\272I\231\362\245\235\024\225\377\343\247\26324\201T}nU\256|i\267\003\352\367\350QY\031\032(\233\347\226%\300m\313\227\252\360p\371;^\346CQ\364\201\177\235\267\223\344\017\345;\267\200\001\203\367\235\26522\201\242\276Z\351(-}\251*K\234\227\343e6\270\224Ky\337U\353\221\031\002'\327\341K\355\234,\270\177\363\341\275\204\370R\313\006\301w\217{7L#\276\324.\301\222\263\261FM\032\003Vr5\254\023\2323$\276\264\246Ur5^\252\304\211/\3751\367\303\274\030\031\376P\034E\212\372O\337\371\247\360\276{\353\205a#dF-\344\002j\373\314y43\255\f\317}\346\017\316ji\242\242k\346\r\332\316Q\324\027\257\330\227\226\257\326\370\202X\212\231a\b\272FQC\360\026\354\001\004\007E\227\274\n.\231\257&\361\326\242\355\222M\"\222F4\211\370"
+	.string	"\"\346*g\033\311Y\244\250\302\310C\2121\233%\306\027\353\363\206$x=\334\0047$\2721T\\\275\315\\^\233\r\274\033k\032-_\0171<#\301\255I\321\345\272w\311Y(4\231\305]\346\023W\023]\t\270\006\352\263"
+	.string	"\036AR\3453#\016MKL\257\215k&\270_\244\b\216\257\231\251_F\327s\211\315\327\316\331|\r\341\320W\2416\211\t>\271\031\226\206\177\365\323q#R\344KWA\214\324\034\267#\001\316j\235DE\367\206\030\353\226\2117\036\263\211mx6\003/\323\253\303l\006*5"
+	.ascii	"E\0278\274\241\t\206\3672\275.$\211\210a-f\322\225\315\030\265"
+	.ascii	"\t\033\217\342\276e6\313\033\222L\261\023\334\256\330\221\321"
+	.ascii	"\336\331f;iw\203&.\357\326\247\271b\273`T`p\2256\304\264\006"
+	.ascii	"\307\353\254\026\rfDTto\211\2676\221!\2067h\272`n\003I\023o\030"
+	.ascii	"\370\222\340\245\345\033\202\370\332p\230\307\033\202g\213K\212"
+	.ascii	"\256m\023O\025z&\352\030+\312\021>\204m\"\355\342\032h\346\255"
+	.ascii	"oM\244\221yv34%\201\210\035y\213\001\f"
+	.string	"\2064f\223v\301\r\206\327\314\232\304\232\024[G0\030R\321\325\373,\003\200\231\250\2410%\215432\"\222$\005I\007\320\002\221!c\035\0210\245\223\f\021\205M\n\255\377\006-\234\261&\344\267\300\177u\227\225\251\240\331\225\020o\001\245\325\314\370\202U\234\"\374&K\026\2028n\340*H\216\237\324\2518\036!\026\336\\\333F(@\242U\310\210\267\201@\217:k|C\261\\eu:>d\342\\\236X\367'?\207n_\210W\261+!\005+h\355'PpM\n\220DH\b\307\rCZ\216\251\213\302\321Yl\016\024\016\b\371$a\203L&6\200\250\373\370\237\240\t\255|P\032M\225\241U\367\355#D9\322d\022mhr\377<\037{\031\374?\201\262K5\343o\321\306]\006\237\317\321G]6\276OES\017\255z\374\fh\232\027/\342\312\0231-tL\313\324\313\023\310\021:z\260\317"
+	.ascii	"\326\252\3235B(h\347\364\007\f\343\020\257\001\373\246s',m\374"
+	.ascii	"\266e\035@\320\021\375\300\312\363!\034\002\277\033\315j\323"
+	.ascii	"m\341v\324\225\202\243<\365D}\365:h\366Q\201N-\214\374\007"
+	.text
+	.section	.gnu.lto_targetParseArgs.100.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`,\026\245Y"
+	.ascii	"\312\223$!P0\320\322\032\003LG\214#\364$8\222\214\030\213\036"
+	.ascii	"\365\222\024V\323\177\343q\320K\026aq\322\265\017\271H.W\215"
+	.ascii	"\"4\214\255\027$\316@\331\224\035/"
+	.string	"\346\226.\020|\016w4d:\317'1\256\f\021g\357\036jSU\225l[!D\246\224R\001\002\320\001\002\002\316m\353\374k\235}\2553\333:\177\353\354\255s\313\300b\005\312W\313^\253\353\231\327\316w%I\237u\243\365\317\237\271\251\316\265\260:\266\271\2403.K\313\331h5n`\314\316\006s\\\353\204\313[pJ\227+U3m5ZxakC\255<3T\272\n\363\220=h5~A\306\265%\366\276\357\320\003\346a\373\204=\245\323x\210\306p#\254eKg \024\251\312\336\253v\213\016;\261\243\3661\004@v\347\226\322,\264\231\333-\334\350\234\367\365Zk{\337\262$f\240\f\330e\314\301\366\261\001\300\366q;s\213\365\230\333Q\030\216\203\357\333\365\244\355}\337$6\002\333Wl\236_\373\330\336\371\265\217]\346\274.\003{\333\n\024\247\013f\336\3675\376\0206r\267E\024\t\020\""
+	.string	"\020"
+	.string	"\020\025\207\204\202>x"
+	.string	"\372\351\340\323c\304\263\243\223\203scSC\034\n\203\300\366\347c\337]n\217\356\231U\325\256\244Z\004\027e\021`-\204\225"
+	.string	"\252\2609\b"
+	.ascii	"\272\260\2504\021;\200\236[\r}\007Ucy\254\220<\233\t4\315\213"
+	.ascii	",R\227&?\372\016J\205\335\361Q\245\013\232\017\221\265\020Y\024"
+	.ascii	"\017\032\353\017ciM\304\004*\346\036\210\272\260\2404\020\033"
+	.ascii	"B\213\220\031\372\016\n\205\005\332\242\313j&\320'\376\303\035"
+	.ascii	"\244>l\003g\350\322\372\016\232\204}!N\232\t4\314{X7\362EL\337"
+	.ascii	"A\221\260\f\274\365\260\352\264\366\252+\246\0335\261\344\232"
+	.ascii	"\207wXgi'&\315\371\262\004gz3g\223\245\306\nQm\311\360\206\031"
+	.ascii	"1\251P,(\005\"i\215\374n\300\226\370\236X\275\240\320l\021\""
+	.ascii	"`%l\005!\001\310\017\037\335\005\215:\2338X\326\204<+\341\025"
+	.ascii	"\025\313\356\360b\242.\250\021\234\357\264fW\260\242\211Y\273"
+	.ascii	"\260\344\332[\007\336\367e\177^a5\017\320\314\216\206\231i`\336"
+	.ascii	"! (\276\347\206\260\037t\306\3515q*\327\376\263{\371\027\322"
+	.ascii	"\304\322\322\263\353\277\255\302I\361\2328}\341G\001\027\n~\363"
+	.ascii	"~\026i\261\231-=\005\036m\317j\177\356\272\245\357\272 \376\255"
+	.ascii	"\0236+\230&N\307\354|'\236\375\207\003a8\025\374\306oi\035\242"
+	.ascii	"\272\306\254\252\2151\361'\276\341\234iz\\\350Y\335\317Mm\341"
+	.ascii	"\302\373i\342\233\332\235\245%\345\361\245\327\364\021\274\007"
+	.ascii	"\007\334G\370\202\0337~\355\353o\235k\322\350\224_\271\253\335"
+	.ascii	"4(1\243'\345h\212a\232gX,v\021\240W/n\305\016\345\001\306w\260"
+	.ascii	"\363\330Au\035\354\317*:o\262;\237r\316d\247\322\261\346/\273"
+	.ascii	"T\016*h\270\3238\317\224\211\205\331\300}Csl\217\333\f\216'd"
+	.ascii	"\270\313P%\021\303=\206y$\217;\314\024\021\031\270g\220b\177"
+	.ascii	"\276V[J^./\334_\374m\206\373\265\017\230\342\265f\021\013{\337"
+	.ascii	"\327\250\0133\347\001\337W\252\267p|\2162\261\260\227\3535j\337"
+	.ascii	"\321\023\247)Xm\275D<\315\343\231\240\304\372\254\343\255\326"
+	.ascii	"\\\230\200\357;\325O\356\273\336\202\001\367\221\366q\006L\336"
+	.ascii	"O\246_\323\321\373\311<b\354\254zT/\305\\\306\364\377b\356\002"
+	.ascii	"\360\266\302\370\275\030\206\320\371\205\320\331\205\320\331"
+	.ascii	"\002\241s\013\2413\013\241\363\212v\256\200\350\254\242\235S"
+	.ascii	"\020\235Q\2643\005D\347\245v>At6\321g\315H\215\326|\324-t\033"
+	.ascii	"u\224n\021\355<\324\316B\355\034\324\316\037\206\316\036\332"
+	.ascii	"\031\250\235\177\332\271C;\373\264sO;\363\2643\007\241\363\216"
+	.ascii	"\320Y\247u\316i\235q\202\3167@g\233\326\271\246u&\266\316\303"
+	.ascii	"\326Y\330:\007[g`\033]&\255\003\210\235o0fue\330\rHf\347\225"
+	.ascii	"\210D\231\362k\327\275q\371\374\027\2735\032\023\251\336w\n\204"
+	.ascii	"\316\3070\243\023\243\363>\267\026\302\266\306t\246l9z\376\213"
+	.ascii	"\225\372\350\207\244\214\331\002\206\312m\340\005\334}t\253y"
+	.ascii	"\030\267\312\310\216\347y\256\0166\312\255\372\271Uj.\203\313"
+	.ascii	"#\311\313\3736\373\351Z\001\233\r\244\250}F/\342\312\025\301"
+	.ascii	"\373y\364<S&V[o\364\245\270\233}\277\n\226\2263\036\244\030Y"
+	.ascii	"99\337\n\311\301V\365#\206n\264\273+\273!4\352\316\001\354j\271"
+	.ascii	">\206\322\330Q\275\024\217p\234 n\tE*\367\b\007\300#8\257\300"
+	.ascii	"u\257\352\307U\037\257mV=\235\033\023\374\316\025\242\305\346"
+	.ascii	"o\236\205s\246I\362\243\346v\207\374j\210\270F\274\2376_l\326"
+	.ascii	"\325|pJ\231\020\232H\205\313y\201\202\317\301`T%C|\356*/\276"
+	.ascii	"\253`!\376\320I\246\252\211T2\034\027I\034\356-\317l\370\334"
+	.ascii	"k.\276\327\334\206?\324\312\263\346h\"Uzc\301\022g[;\332\303"
+	.ascii	"c\n\237\273\315\202\3576*\302\257\321\302\223\342h\"\265\211"
+	.ascii	"M\213"
+	.string	"&\236\206\266W5\013>\367\225\026\337W\\\b\376P\253j\365\251&R\203\324\260xfW\0057c7!\260\367}\021\340\276s\026\214\206ta\002\237\373\215\305\367\033\031\360\203S\272H\257M\244j\331\021W<\273\230\217\261\233\353\204\333\332~\\\314\252jc@\270gu\373\334q.\024w\314\373\271\342;\256\201^\366B\320\242\207C\332~\353\204\2135z\246\217\326\327\2527\354v\311~\354*\370\n.\331\003\021D\360k_\353\244\206\221\2616qz\203\360\327D\202%\357\347\222\337\267S\352\25454qZ&XA\022\022X\350\230*\276\002\337s\313\251\370\226;\342\373v\217\216\206&N\251\300\024EJT\343P|\n\366\271\347\002\254L>A\025\223O\305c\223\023\2232\312\t\3713d'd\f%\031!2\250\361\224\204:\036m8*yT\036k0%\231\240\2124\2162\236j\024\243\232\220Q l"
+	.string	"U\224\201\244\301\324\201\023\222\210\2337PR2=\321\320 )J\211\214a\264\3414#\351\003\033NH\032I\006 \220\001\002\t|0\2027P\212\201\244!C\031e<\312\260A\243\311\tiLF\3310\366(\241\236^y\214\322@\003\024\312\344\023\224\260\203\246#TTqF\222\t\3304#\311\304r\223\322\t\026%V\030\225\307\031I&\245\321\t\311T\303\330\224\2142*\025\371\t\352\2304*\237\236\222\306a\331T\277\027O\020D\317\2527\365LF\3410\236y\271e\031C\247u\203m\031!\350a<\2733\312\314\222g\025\321\004}$\217\302\262\nl6\fW0gE`=\364\304\032\212\220\030\372\346B\344\345\276H\021\340*\364\177\202\331t\210\320\367\231\303\300\005\032\342\277\370\272\027\364\375\304l\352\025\364H_\242:sS.\001|\350R\361\341YD\251R\020\\\313/C2"
+	.string	"\233\275V\264E}\366x-S!"
+	.string	"\374\027\223\260\334\033\002\342\343\206Y\305\366\354Q\3029|\253\275\3262L\263\201-\305"
+	.ascii	"\233MV\304s\277V\373\254\345\236\017\330c\275\bK\032xYf\271\347"
+	.ascii	"\313\275\337\322\272\274\301\313\235\030;\347K5^\327\031\"\016"
+	.ascii	"\377R\\ 3\363\261Iq\025\033\371\363\3601\314\276x}\b"
+	.ascii	"\036~D\024\213t\bh\007\t+F\200^\207\371\254\n\375\350 \361\363"
+	.ascii	"\311(\2345\250\303;\037\3569f\352\254H\207\327\021\362d\373\340"
+	.ascii	"\363T%|^\031}\363\320\363S\216\367\034\363\"}\317\3370u\3545"
+	.ascii	"\267\230~m\343\256l\001:j\236+\317\303\210\256Y\243\321\346\360"
+	.ascii	"H\337h\232L\230~e4\034\276\177D\327\244trd?J\036pv\033\220\314"
+	.ascii	"Hn]^9\201\366\271R\300f\007)r\231.\216F\273+!\201\302\250"
+	.string	"QD\304\234S3\"\"\242 I\2224\0061\006\204 dF\265\r\021\2604\307\030CS#I\222\326\016\200\263<\fh\341Q\303\001P(\363\037\342I{\220\204\224B[^\312z\0309\231\207U\013\332t^\362\223$\n\310 m]\244\263[Q\261\255\372\310\017HQ\323\037\306\\\352M\200\354q\022\013\353\234\306\233\322\253\022\204k\363ifAO%\367\030\202\303\022\336\237\353|{M3\265\037b\223\024z\3306H \036\216N\207_\365C\222C\215\021\260F<;\270S\023\\F\364\250bQ\"nj\316\270-\237\316c\267\363\f\333\207I\3430\305\223\244\007\213\004\310+kwt\215c]l\334\316\3226\013!{\326\247\272v\373\227\2067\356\345\2463\200\350\354\213l\0174\031>\264\230\005^\022\t\037\207\375\206\227\273K\016\235\240\024\177\024\332]\036\205yJ\300\311XS@\315\323\362\203J\331\303`"
+	.string	"0|\207O\210z\212\024+\300\350_\004\220\016\002\t\025Pn9\037\354\030\242L}\262gX\212\254\357\r&\225\303\312\314G\212\230\023\251\304\031I\240(\0013\247\362\236\026N\324\327\244\244\024\"\261\204]'\350!\205\262\225\327\267\210\362\364\200\265\376\207\232`q\242J\215\335\305\330\tl\001\321\361\302\244\351w\277\2336"
+	.string	"\260\357*f>Li\375\321zG\302\313\256fL\211R\330z'\341a\326fv\254"
+	.string	"\325d\376\230\027\023\233\220\340\230\023\353\217V\332\031L\024\230"
+	.string	"\206\020F\361\241}MG\330\257\210X\236\031\031\034\305\326\331\261\2233\021\214>R\333+$\327u\362\005\304\211\025\002\016\331\273\016\346Iw`T\036\227\246P\036\342\342\n\311\302\347^\274@\311\274\203\367\207+\331B\220\265\344\033L\230\260a\205\316\020\262\207C\222\2549&\252\024\0310h\036fJ\016#\r\037T\362H\2547\371h\021M\201\266N\317\327\365|\320+\256II>\234\037\211\263\242\307\373&p\325uX\0172w\325\257\340,\232\357\342\177\2770\376\376\270\017\017\336\3577\346\317\207g\216\210\370)\354\325\321\320\244\327\304\354\321;\t1\216\374\222\375\371P'\3217p*\353\264\325)\334\013#\247(\022}*\025N\204v\213\277|H9\310t\306/rV\022\225\371\225\006^1\342\f\342\355\200\246\333%\311!\203"
+	.string	"Bz\034\302\343\020\243#\002\327v\2503B\217\361\0371fy\250AG\024\322\232\210U\303\360\205\331\034\026\256\243\220"
+	.string	".8\215\\\351L['\372\264\301\316\256\1779)\274\364>\"\347\321<[9L\232H\206\232\370n5Z\313\342\274\340\322\261bfI\235\244I\336a\352\024\246O!d@\214\247\200\302,"
+	.ascii	"\205\021\314\037"
+	.text
+	.section	.gnu.lto_systemInit.101.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`~\fe="
+	.string	"\372f"
+	.string	"\027BP\244N\007S\232\365\354>#\0173\265\305\004\304v2?\023\003Y\332UN\202u\"\312\332.{0\3218\300\"\024h\236u\250H\220N\303\356\215\256\242\003\033\003w\366\235\024\371\377\257#uw\223)\245@\001Z\001g\001S_\333\233\254\257Q\336\375\342\371>\355\257\262\266gX\350\205\243\335\324\350c\266n'\276\230H7\324\223\337y#\3617\323\177/\341o%\374\235\264~#\021\277\003\020\277\001\340\357\243\3776\372\357\"\377&\372\357!\377\026\372\357#\361\333\210\277\203\360w\021\177\003\3757\373\337\353\177\023\377\033\377\367\373\267W\360\260\303h\035\3009.\026\346}\305\016\373\274\325\325\213\022\277s\307\353c;\024\267s\375\256\375\374-{\275\006\0338>\205\357\373B\371\332RE_[Ob}%z"
+	.ascii	"\326\327v\273\3458\325\355e\202\333\363EE\317\373\276R\270\315"
+	.ascii	"]WJB:2*\"\032\022:\032\203\212@\354J\304\357\266\003Q\230\222"
+	.ascii	"E]\251\223\222 y\244$\177\3647\206\304\310\033\035\301\363\246"
+	.ascii	"\2701\267/j\"\032\372\033S#\266qc?^\310\205\224\255\371\221\250"
+	.ascii	"\240\220\017\217\377\215\371 &\211%\231z\334X\332\033;\350o\f"
+	.ascii	"-n\354\354\213\r\344qcfDd_\317\366*=\222y=\2611qB\0373X\210\310"
+	.ascii	"\272\210x\310\234\343\371\203\221q\375\003Qx\337\267\177JV\346"
+	.ascii	"\275\344\335\336\324\355/\272\215\325\330\305\004\216\251~\301"
+	.ascii	"\301\235)z\331c\350l~%\220\257jV\005r-\026\350\301w\2739\334"
+	.ascii	"\035\357S \354{\201xU.-Y\354X'u\350\364(J\335\006\223%ha+\353"
+	.ascii	"\201\356T'\224s\346\276\275OY\\\325\244\352\205\017\001\331`"
+	.ascii	"!2x\367\207\273V\245V\355\302Q7\203n\220\242\264)T\005\256jX"
+	.ascii	"\3305 \315\t\306lP\276b\025yn\272~O'\277"
+	.string	"\335e\003t\337\212k\234\215\333f\304}{c]$\256\222\367\351\212\375J`Z\325\351\233\372z\373\261N\3654\356\\\002\2673\216\306e\342\312\271s\357\3239\326\245c\241\274\335\255c\273];\027O\350\017\316k\206\243m\340\273-`x\n\334Q\345\302\321v9rY^\317\300\266\3739\230\f\0338p`}=q6E\217\035\001\357\030c\"v\252\367} r{_\251OC\024\245\027D\220h\277pt\257\0041\312\037c\354R5.=\347\322~&\372K\177a}}\034\324\236\305\265\320h?\322(R\244`}u\314t8\306l\353\017\333\350\333\257\320\350\216r+\312\206\340\353TQ\332\300\311\327\356\245\025\273V\325S\330\205\243}|\247\372\224f\361}\267|\332.\305\363Z\264\037\361\265\257\232\357\001\330\251\231I\226s\352O\311uR>/\317\321\345\272:\273\214\367>M\302\0010\022v?R4"
+	.string	"p\363\271\235\262\367}\273\237\272\336w\353@"
+	.string	"\354R2\\\177x\007"
+	.ascii	"{\2373B\272C-z:\214\216\260\n(G\230\301\231\034\303\"(l\364$"
+	.ascii	"G\311+J\237N\212\243sV\214\226Dy\021n\247\321\204\t\225\334\367"
+	.ascii	">\205Zb\245\bK8\00344{\302C\230(I\306\242\245(}\035oDF\2060&"
+	.ascii	"\343BD\315\316\304C\371\021\013\265\345>\266/\222\273\360\345"
+	.ascii	"\276>\277\034\346}\372\204_\b\2151)\204\364\036H\373\225\351"
+	.ascii	"/G,\341\214\r\221\2007b\247\276Z>\203\224\323\024\245N\347\321"
+	.ascii	">\255\371\324\364^\357\261\276\0321\203\2634\036\336\251o\226"
+	.ascii	"\007\221mx|\217\f(\230\007\007\251\257#\023~\331\347\310or\234"
+	.ascii	"L\230\t\363\234\\\207O\325\353m\355\311\215\241 \234\363\372"
+	.ascii	"q\274\230V\276\223\363\274Os\036\326\327 \f\342\f\r\335\203\271"
+	.ascii	"\263\203&\024\006fX\224z\230<\356&\246\b\216#f\303\343\305\314"
+	.ascii	"\247\210\253\354T\271z\240\271\031\321\274\364\275\262\237\242"
+	.ascii	"\324\361\316T{\310\005!1S\330\233 u\326Px)w\252\033u\271\\/\326"
+	.ascii	"\251\377\272`\177\374\320\375\262\341\202\201\261\356\rW\354"
+	.ascii	"}\212\f.\250\260\224+\332+\252\252\001-V\263u.c8\227O\247\022"
+	.ascii	"\372,\320F*d2\231\244BFx\"\333&\264m\201\305t\321\202\270@\242"
+	.ascii	"\205\302\370\200%\003D\013eb1\021\264q\206\206\252\005Id\013"
+	.ascii	"U\266.\226T\315\253\3669\305|j\255\310j\352\345\224\322\tm\225"
+	.ascii	"\255\025\026SK\351\"k\351\034\260l\341l\226h2\227\234M\350\224"
+	.ascii	"r\351l\233L\001Y\315f\007\002\335\344l:\235\313\266\305T\263"
+	.ascii	"\303\022\252\244\312\202\321.\241\312\245\323\202\2006:=\221"
+	.ascii	"N\355U\323\231\265"
+	.string	"\\fMA\333(*d\273\234\302RB\237XL\005\235L&\241L\254\r)\256\226\320\247\326\023\205\021t\351\304=\225\3540b\203\b)\350\322\312\251\204Ja1\225WRS\316\247T\262\355f\326\322)\005m6\235RG\352\353\230HQ\320\260\272\205\271\032\272z>c\273sZ\376!x\347\017\241a\241\222\225\0313e^\260\214\023\020'IL\230)\214O\264\316\232\301\317\342N}1a\332\230\260\353\021\364\253z\345\265,\207\240\315\373n\345 \337\227\207xY\243\326e\312c\twg\266\337k?\2456]\332r\035\326\233\322\351l\344\365\332\257\370\276\257\203-K8(J\027 jvwHJ,\336=\003\226+\031IV\302,\037\020/\034\365\303;)bGIX\b\217\325#\005\200\374\250a(\006\225S\210fD\202H\222$\351\260\002\221!*n\003\021\3200'\031DC\222d8\236\245\321\361\006"
+	.string	"4\b\231\252oja\265=\206\211\314P`~\346\367\261h\232\337\272RD\357\357]\032R\261\024a&JH\334&\221\264\bF\006\374\346\260\234\177\271E$\236\236`\205\016:\234\356\352\301\333\331X\237(\004s\023\204,\035\310\362\206#\247\307iJt;\004\257\241\215\277\r\317\277\333\\\034\222G_\231\246L\362\214\026-R\262t\224"
+	.ascii	"\352xi\234\202I\356r0\376\204\013\002\272\252\344P\2605_\354"
+	.ascii	"\021o\261\351\241%\\\022\277\026r\276\324\243\216\013Uub\321"
+	.string	"OH\214\321\262l\032\205]\177%k\t<\235\367\361K\252\210kn\331:\237\236\023\377'\367\325\210\216kl\343\353s\377G`R\333\351@\365K\276d\321D@N\304#\215%|M\222m\201d\033a-J\036\301V\343\227~\226\375'G=g\246@\307\211>\f\202\350\r0\335\231\034\245\222\266\2020\200\313A\247\002\346\036\352g\350\334\257\356\321\352\313,\335\215\202\306\242\016\366\275\0372\324\330v\033\255\rp7T\004\216\373\3712\337\304\026s\255\326\243\345#\021\333b^\303\366\020m\220\345\247Jt\002\337\371\241\b\247E5\307\261\235\253\002\247\013$p\372\346w4[\037\300J\003\232rS\214\250\227\304xYv\245\330z1\377\020\026\321\263\016![\r\214\271\245\032y\2267\364]\352(Q\334B\264w/$_0,5\n\274\210r\003$\211\036\371*h&P\203\013\227{)\206\004f>\232\265\207"
+	.ascii	"\360d\257?\340\250$X\327\207k\330\240\200\022\006\3161\345!\341"
+	.ascii	"\240\241ng!\002\366\231\333\205\372\026\034\247\317]!\3674\227"
+	.ascii	"\031\260\324"
+	.text
+	.section	.gnu.lto_systemReset.102.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`N"
+	.string	"\025\t"
+	.string	"vQ@9 \223\322\030\017j4&4\3129\007\240\032PD\"8\034)l\240\023\300\357Fd\037\213a\004a\346\354G&\340\021\036r0P\003\247-$,4\033\2214\305\b\344\354-S-"
+	.string	"0"
+	.string	"1"
+	.string	"\225\244\366Se\033N\313\277\242Y\317\263\261W5p\t\032\251\241\325Z\351\\Y\326J\326\273\354\036j\255\313\226\311\311>\367/\370\035\376\235/,|\206\215\331\270a7\216"
+	.string	"\021\252\260\333\257:\344\266\336\227\r\331\300f>3\2209~l\224S\345\027\240N\327\257|\273\204W\016\314\366"
+	.string	"\325%\356&\2056 \337\013n\347\233N\243\2209\376\312\354\214\367\262\214J\311m\355\366\246\270\335v\036\320\350\240x\310\332!\371\252\017\243D\3661\307;\031#\210^\350IX\250<1\\\205%\201O\244\b\n\210\t*z(\320$\322\214\224IEO`HI\243?\r\017\244\342\367\201T\324\275\323\365\023\310\205\375\212\013"
+	.string	"{\345s5\266x\214\350\270\023\247\332\222\346\376\360\\\305\205\321)\330\3742\004f"
+	.ascii	"\n"
+	.text
+	.section	.gnu.lto_systemResetToBootloader.103.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`Z"
+	.string	"u\t"
+	.string	"\266\021B9 u\322\001\220\274\336\201\270\301\240Dj[(\005B\334\355\300\2004\224\237\374\261\236\027s\b\302\235\323X\227\315O\361\313\304:\002\324\265\333\232\324\034\363D\256\211$\202\266L)/"
+	.string	"2"
+	.string	"2"
+	.string	"\265\236\334\222j\215\003\222\261\375\223cv\321i/\265`\306\244D\307Vk\225\321\345\261o\314\367v\016\265V\357\f%\345\216\267M`;\3026Q\335\3727\240\315p\233\0167\234\363\b \221\n\347l\330\307~\346\323\334\264\363\343\203d$\022e6M\266\261\305>@\215,\366\327\357\022`zj~4\024\003\273p\273bU\n\2526\201\365/J\217\266\307B\215\034\3479\323\217q\313\265\237\235\363]\245s\217\006<B* {\263i\355\027\315X\251\205D\231\003F\370&\206G5BJ\037\250*\234\340\234\260x\315\020\204\201\253\003\263R\022*\b\n\031\316\326\347\205r\303\345\275$\353\003e\ne\3121?\031R\372\311S\347;\r"
+	.ascii	"{\345\273\232\215\224\261\303cD\307\235\246.v\031\366\241\271"
+	.ascii	"?<Wqat\n6\277\f\201\031\200\002"
+	.text
+	.section	.gnu.lto_ledInit.104.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`<"
+	.string	"\325\b"
+	.string	"\226\020?;0\345(\035\2003\226\246&\035jS,B\340Si\205\022\355o\201\034\222\246\203}\314\241\260m\200\240\364o\305\026\202\223\3140\"g\300\002\2072\026\n\305\240x\006\277\355\266wJ\001+"
+	.string	"-"
+	.string	"/"
+	.string	"\005\234O\2036\315\303\224=P\225\210\264jv\227J\224\203\217\240\177\326\003N(\323c\007bw\035O(\222[\336v\202m\315vK\273\273\226)[nT&\237i\355\216\004"
+	.string	"\260\256)\243\342\261\375h\177\345+\360,\035'\330M\301\304\354\206\r\246\330\247\303\033p>\261\007\235G=\341^\246\214\275X.\017\371\341N\364_>\233\341.%;|j`!\017\n\237\366\006G\374\311\013\257\225\013D\232\354\320\024\345\211\375M\316\262\254\216H\237\212\020wA! \032Y\220\272\210\020\247}\245\272\325o\300\240L\233\370H\320\312\211\274\255R\322h\303\240 \357\243\031\202\273\f\316\243\265\013\n"
+	.ascii	"{\311'c\261\204g\300E%\317@\002\206\\\202mVS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_timerInit.105.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`\004"
+	.string	"\025\007"
+	.string	"\342\f15`O\322\030\024H\b3\204\016\003\024\322&:\035\271\357\206\200\f\371\2331\b\374\031f\257\"r\210M\266\212\301\221\256{#XN\267\034C\177\003\017}\322\366\226)C\bg%\362DH*TM\210\201A\260\341\301\343\020'%!?3\212\252O(\202$E\204\005[\023\224\214\323\262d\354h\253\217\304\201q\3314\336\306"
+	.string	"nU\251\370\004M\261XA\247\013NG<\320\35112\234f#\300\264l\034\017{\rsO\344u\263\217\364oS2\321\027\231\335\217\032\232\335&\226\223_;_\037\243\032\311\022\224J<Vfv7\276\021\275\324]\253\242\250@6\302\324\0050\354\356.\033\201\350O\177\203\177\341\017\t\n"
+	.ascii	"{\3117c\361\2013\300\370\024y\332\347\032\236\026\302x\031\002"
+	.ascii	"\\\272E;\237"
+	.text
+	.section	.gnu.lto_timerStart.106.518b89b757251988,"e",@progbits
+	.string	"(\265/\375 \306M\005"
+	.string	"BI#-pU\323\001"
+	.string	"\225\254~\374\367\377\004o?\341l\374k\034#&P\363)1;\313\212N}:\274<\340\200\275OQ\334\264Y\262wJ\001\266\250\304\002\241P\355b\314JS\007V5\324\232\020\245&g\217k\252\226eS\245p/\277)\"%v\310Ei\261\037\255\374\354\030\201\232\203\004v)\003\001\373\021x6\266/y\263C\0171["
+	.string	"3\223\016\300\356\252\274|{\334\374sN\350<\356qp\330]\307\316\253\334\362\266\r\266)\333X\t"
+	.ascii	"{\3117\323\342\234\031\002\276\3345<-\204\3612\004\270t\213v"
+	.ascii	">\001"
+	.text
+	.section	.gnu.lto_failureMode.107.518b89b757251988,"e",@progbits
+	.string	"(\265/\375``"
+	.string	"=\t"
+	.string	"\006\322A90\221\322\001 \206\2657\314IC\217\204\0321n\377\251rC\302\200\315\322\234)|d6\260\341\302\370?\212M#\023\210\276S\206\206u\216k\355#\037<\357\276%{\357\235R."
+	.string	"1"
+	.string	"/"
+	.string	"\247\376\354\230\207\262\035\230\215h\250\324\354n\225!\226\361\373\224\361\363\017b\237\036\227\036X\354\221C\332]\307\027\254\343\246\267M\262]\262\315\022\0332)\226\240}\332\037\347\234\221\374\205f\227\343\306fk\324E\344c\373\321~\311M\276\3230\f\260\373\261\322\262\033\032\270vNC\007m\247\363\002[\022\364\247\004?ww\245\004mo1\312\207Ga\005\310v]\177Ut\\\b\005\247\266\305E\374\313?\371e03\265\f\331\262\303V\224 \366i\366\240\bB\"\221\310\201Cu\n\234\307\212H\231\036\032@\034\252SM\237F\t\f\245\205\272\342 <\323\252J\244L\252z\362(\352(\344n\202\363\352\252\353\274\372\261m\216\037\013"
+	.ascii	"~\311\005\346\344\354*`[\356], VS\202{q;m\266\f\334\270Bq\002"
+	.text
+	.section	.gnu.lto_indicateFailure.108.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`{"
+	.string	"\225\n"
+	.string	"\346\023LC \2138\035HH\200-d)"
+	.string	".\324\210-_\235\033\306ZK>\001"
+	.string	"#\247,\306<\257\210\22700\3022\302IL\255~Uat\376\230<\335E\302\023\274\340eL\240)\311F\253\206~\361I\333;\2454"
+	.string	"7"
+	.string	":"
+	.string	"\256\332\263\355\023\225g\330%*\317\034\332\031N\256\226\342\001\213"
+	.string	"\205\r\273[\251\202\207\237\241\377\b\277\210#\352\323\302\331]Oq4p\323\333\256\260-\262]\006\330\356\256\251\312~\353\237\030\204\003\006\343\027h\330-\320\201\303\226\231\205\006\266\217\261=I_\300\340\332]\2155\264g\376\264\017\341\254\360-"
+	.string	"\276\354\"\250\340\332%5\001\246\272\331\354\225\272\257\202\236\367U\f\271\307\226\252\254\275\016\224\001\250"
+	.string	"[\346\244\227\360\t\246\210\325n\352\342IKq.\236\331()\363\2421^c9\200\242l\0225i\002\373\001~\370Xl\231L\246\244\373x! \222m\343\363@\333\211\211\023\201\266\016\217\316\326}'Q\210\373\310"
+	.string	"I'\217\003\344\272R\367a\272\2177\302\354\331tF@D*\330\231|\034XI!nT=_\013"
+	.ascii	"\3369\312^\222\310\330#?k\203\263{\256\241\2550^P\345\b\250\333"
+	.ascii	"\340Z^\b\223\f"
+	.text
+	.section	.gnu.lto_nanos64_real.109.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`\236\001]\017"
+	.string	"v\335fD\360t\224\016\030J\325\305a"
+	.string	"\325\220\345\374;\2705\222\210\367.1\2164$\267\2228\331.\006-\036\266\236z]o\365\227\267\241\301\"2\307\005O\n\305\340\343\341\322\257E\006\242\260\333\377\215\020\262\267\224)\005S"
+	.string	"L"
+	.string	"T"
+	.ascii	"\227\231\023\373\213\324?\324g}\354C\250\200\315\320v? x\264"
+	.ascii	"\327=~?>\213\267HY\245\034VX-\007`\263\r0\216\354~\236\277\013"
+	.ascii	"\330\036\273\007\330\036\265\304UO\225\177\331+\2140!\303\365"
+	.ascii	"Z=9\b\273\353t\275@\334z\333\006l+\260"
+	.string	"\263A\266)C\336\345\214\241\203\206\204\266\242+\373[\245\222\260\017W]l\247?0\355\201\351\016Ls4\275\201i\rLw\232\346`z\203\351\250i\b\323\n\323\251\351\003x\207\025-E~\274\0163d\327C-\311\366\2107N\374\373\355\224\0034P>\314\243A\244\274\353\321'm\217\2342x\211EU\335\364-\026\250QuG\312e!\250\004\200\304l\\\bLf\327\0164\354\262\n\244\252\276\225B%k\276\246\246\221\026\315\266p\231\250\333\335\005W%\222\243\007\213\213\030+k\356\3621\227\221:W\202\007\246S\032\305D\002\205\b\023\274\023(\245tr\362.\204ND\036J\311\344\231\224x\204\001T\362N\243Q\311\343|{\270\352\362\321\022\226\252\030\005wE<\240\305d\315\036\375\350[<:\272\251G\343\254\205\202\243\032\355l\224\243\003p\314\204f\033}\215\227N5\234v\312\005\221\021\3713\036\037"
+	.ascii	"{\311'c\272\211\f\263&\373\265dI\365\206\320\306j \205c6B\301"
+	.ascii	"\254 ?\260\034\020\210\260m&\321y\013+\301\202\360\262\020D;"
+	.ascii	"=\343\033z`g\t\365\267\260\013\343\3055\213\fc\213S\215\203;"
+	.ascii	"\246Z(N\212\351\232d"
+	.text
+	.section	.gnu.lto_micros64_real.110.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`\313\001}\020"
+	.string	"v_nF\340\322&\035\240\237\013d\364\003Y\245\321\237\2656{\247:\030\365\216\217\035\244n\307\013\334\216\357\0247\360M\022\006\242\215Fya\250Lc\\\017\357\303\372\021wX4-\231&\304\261\302"
+	.string	"kk\333\244\221\275\245L)X"
+	.string	"S"
+	.string	"\\"
+	.string	"\366m\307\3704\237|\316\"\346\036\314\310\346\330w0\321C\243\266\253\241\300\243;\356\361;\342\247\270\212\030\313\250\205\232X\316I\217Q\005 !\273^g\357"
+	.string	"\266G\356$\333\243\206\270\314S\306?\355\013>\354\004\231\331\314<I\tv\3279\263\271\271\365\266\t\330>`\347\203?\247\271p3\003\267_&\344g\316 \243\241!\265\032\235\261\275\231T\020\366\341\252\216\355\364\n\246U0\235\202i\024L\237`\332\244\351\022Ls\232&\301\364\006\323\021\246\241\246\025\246S\323'9\206\023G>t\344|\347\306n\206\217\310\342\210D$\356\375\001\234\226\024\275p\371-\356\002\306\037\361h\226K~\366\350\273l\217$=\220\210\250\251\033\016M\214_@\301a\307\206\036\242\241\265S\276/\210\302nL"
+	.ascii	"\324\250\227\361\320\344gU\250\261\006\313i-\325\001<|\256\251"
+	.ascii	"\nDV\263!\234\346\342v\027\3015\036\311\020\202\263\302'\226"
+	.ascii	"\237\271|/\260\364\n\n\003\007\n\032t0\026\313K\005\326Eh\251"
+	.ascii	"\270\272\225\327K\207b\342\026\t\254W\007kiyu'o\017WuVj\022S"
+	.ascii	"\032\303\300]\017)\265\237\374\254\322\225^f#\366\343fw}\222"
+	.ascii	"R\225\246\220\214\007\245\233\246t\353!+qRNQZRd\322SIM\032\240"
+	.ascii	"\210P\013FI?\203\244\001! p\002\2312Z\017{\362\211M\333I\303"
+	.ascii	"\006\304>\361\331\337\335h6\017\203\325<\272(\372\312\275\203"
+	.ascii	"\257\204\206h\215]e\026\227\206-\266es\223\213\216\030\370\321"
+	.ascii	"\360Ld\310\351\3078V{\344\333\0167\261\004#D\247\343\276c\242"
+	.ascii	"\205\")\246\353\221\001"
+	.text
+	.section	.gnu.lto_millis64_real.111.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`\313\001e\020"
+	.string	"v\337mF\340\322&\035PC\004z\356\024\333\013\006\323[\325R\215\226\256\272'\247\005\315\035\305\004|\301\007\212\033\370&\t\003\321FCk\246F\231\306\270\036\336\207\365#\356\260hZ\b!Ya\232\n\326\326\266I#{K\231RX"
+	.string	"Q"
+	.string	"\\"
+	.string	"\366m\267\3704\233v\316\242\345\036K\310\336\330\203@\221\223\243\266\313\341\300\243;\356\361\033\342\353\\E\213]\024CL\214\306@N\321\205\236\036\273^g\357\001\266G\356\"\333\243\222\270\313\323\305?\355\rD\330\020\315d^\236\243\005\273\353\234\311t\270\365\266\013\330N`g\204\334\f\301\355\225\n\371\231\323g\350\306G-F_l\357%u\204}\270\273k\255\261\235V\301t\n\246Q0}\202i\023L\2274M\202iN\323#\230\336`:\3024\324\264\302tj\372\"\327\240C\263\203\210\34661v7|@\266F\004:q\357\017/Z~\213\273`\361M<z\245\222\237=\372*\333\343H\337S\"j\3526\0033\343\031R|\300\341!\007H\306\332&\337\347ca76"
+	.string	"j\324\313p`\362\263*\3248\224r\032K\225@\321\3165Uy\310j\266\204\323Z\334\356*\270F\033B73+vb\371\231\313\363\234\246\022+\2604J\211\003\b\f\036t\260U\312\353\004\326M`\235\264:\224\327JWBb\027\205\325\253\203\271\\\257\316\344\355\341j\215JIb\nc\026\270\033\302\244\306\223\237S\252\322\313h\304~\030"
+	.ascii	"JS\232?2\234\223n\212\322M\207\354\306\244\234\236t$\250\244"
+	.ascii	"&\222\226T@\220\037\026\f\222^h\244\234\216\004\005! p\202\231"
+	.ascii	"2:\017\373\363\311L\333m\303\006\304>\361\331\357\3660\t\313"
+	.ascii	"\246\303`4\217\027E\265\362\356\330+! ^cw\231\207K\003\213m\253"
+	.ascii	"\271i\242#\006~4<\023\031r\3727\216\335\036y\265#6Ftb\234;\226"
+	.ascii	"-\024I1]\213\f"
+	.text
+	.section	.gnu.lto_micros64.112.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`l\001\315\016"
+	.string	"\346\333aC\020q\224\016H\333]\2033\025h\f\030\341\275\366\2772b\007\355\342zfg\312\253O\230\256\314qN\373\375#\213U\016S\367q\204 \002Os\006\233\300\341\f-&m\200G_|m\237\020\262I\222)\005O"
+	.string	"G"
+	.string	"L"
+	.string	"\265\252\032\247B"
+	.ascii	"b\215\350\0170\225\016\257\030?\004\206\3558\303z\205Y\2304\364"
+	.ascii	"\023\r\243\021\007TN6\254`1~]?\023\320\f9\013\320\f_\302!g\250"
+	.ascii	"\266\312\f\\P\254\022\212\310\271-\21016K( \334\273\255\201\266"
+	.ascii	" mr\001\351\322\346\351z\t\341\"]\324~\242<\211\326Y|J\333,\307"
+	.ascii	")w\003\263\032\230\315dY\f\314r0\273\301\254\006\2630\313fY\366"
+	.ascii	"0\233Y\326\00183p\254ZV\301\212\321ClGt\301\226\023N\371\231"
+	.ascii	"\371\326$\366hl\317s\367\212'B;\374v{)H,\303hkBY\312\242\031"
+	.ascii	"j\307\230\262\303\177\305{\375\233g\267\207\202\264\302\360\017"
+	.ascii	"\260a\362\363\366^u\013\273\b\325&z\241\223.\031\326\035\315"
+	.ascii	"\320\0079\275\320a\032e\254\\\266\025J\002\026<$\257\310\207"
+	.ascii	"\003\b\r\036t\240\221\b\237\020PG\"!\244\323\211|J\272\017\217"
+	.ascii	"z(\214|:\220\307\363\3514_t\026\237\302\271\307\350\244j\316"
+	.ascii	"i\313$\016\247\026\330\r\325\027[\005\261\330K\206\030G\0052"
+	.ascii	"\327d\276\271\240X\336ks\031\tN,\224\t\363\030.\3458\346\001"
+	.ascii	"  P\002A\352\262\016{\362\2111\315 \031\236\326\"\351hZ\235m"
+	.ascii	"o\376^\304\3120\360C\260fK\204\312cU\027 \213\200\205FE\213\207"
+	.ascii	"\021~\236g\\\315b\363h\f\r\237g;\213,\264\206-gq\376\004\210"
+	.ascii	"\021\213\013\2336\t\235\f"
+	.text
+	.section	.gnu.lto_millis64.113.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`l\001\325\016"
+	.string	"&\234bD"
+	.string	"s\224\016p\t\243\027\257\330\225\231\306\244\242\031\2230\206\365\304\030\037T^\220\"\350\204\003\n\347\003\365\332\217\020\020gU\320\227]\020\336%\006\325\202\016\240A(9p\022\325\347I\271\371-!d\023)S\nN"
+	.string	"G"
+	.string	"N"
+	.ascii	"'>\312\334O\036\200\305\261\367\020\243\"\302\265\033\"xt\267"
+	.ascii	"=\372-gqbO9h\030\2218\240\002bC*f7\354\034\236@\366\270]@\366"
+	.ascii	"\250&\356==\377\2503\200ai\201(\242\247\266"
+	.string	"`w\235 \312\207[o\333\200\355\020;\267\340F\223\245\003\305\"\251\310\016E\251%\354c\273\273\326\024\333i\316O\367&\246\271\230\326`\351LLo1\255\305t\026\323\021KcXZc:\261\364\003pl\264\244V_i\355vx\375XV\234\201\342\247kf\252\035\337\rMS7\275\313\027\"\323\250\232\376[Azq\030^M\260\312\252\3541\323L\t\323\250\352\362\271T7\212\351\277\024\244\024\006\325\0019J\327\324\177.\277\305]x\376\t_\360\344\301G\337\223=^CL4z\224F\371\362\226v\005\223|\026>%\352\021\020\007\020\032<\350B$\021@\"\241\256D\202\210\247\033\001\231t \035\177(\220\200\272\320\347\003\352\270p\217\255\246p\2643R\2229\345x\365\317\264c\304\213\017\025\252\265\025\274^/\031vG\0054\312iT\203ai}\256\215\312H`\252\261R\312h\214\203<4\243\017\037"
+	.ascii	"{\311'\3234\0031<\275\026I\007M\033\3166\325\374\347\"\254\f"
+	.ascii	"c\370!e\r,\0212\036+\353\002\204E0\013\215(Z\3040B\234\347\305"
+	.ascii	"\270R\026A\036h\f)|.\266\263(\013\242k\316\037\002\304\250\305"
+	.ascii	"\3055m\022&\031"
+	.text
+	.section	.gnu.lto_micros.114.518b89b757251988,"e",@progbits
+	.string	"(\265/\375 \374\315\006"
+	.string	"\362L/3`M\323\001\203\022\204dS\016\223\262PC1\322JV\022X\241\r\201\221F\324\001\333*]\030\254\005\360&\247\243X8\251\256!!\263Pk\311\336R\246\024\276H\t\013\007\n\220\3020D\013\005\037\032,\016\360\022#\240\024y\202\300DHMS\204\225m\257\034\247\321\245\032_\235\246gsr\345\307/m\211\211<v%\300\320\250eoVj\206}\267\312\261\235v\231\376s\035\355#\236\335\212\217\311\212<\220\r\333\031\273\342k\357\310\2702\240\270\262\201\016\307\346\243dw\203\321\003\240?w"
+	.string	"\350O5^=+\377\036G \321B\260\314zR\nv\327\211e\026\267\336\266\200m\311\366E\t"
+	.ascii	"{\311'\323\342\2533\236\206\360\\\303!G\274,\004\031\356\212"
+	.ascii	"\251\235d"
+	.text
+	.section	.gnu.lto_millis.115.518b89b757251988,"e",@progbits
+	.string	"(\265/\375 \374\315\006"
+	.string	"\362L/3`M\323\001\203HE\326D\006\233\254\263P\212\221V\262\222\300\nm\b\2144\242\016\330V\351\302`-\20079\035\305\302Iu\r\t\231\365Edo)S\n\256L\n\f\b\013\260\2624DJ\005!\034(\017\260\022%\340$\231\212\260DXQT\204\321\266W\215S\tS\214\257N\323\2239\301\362\343\227\366\004E>\273\026d`\364\262\267+U\303\276[\325\330N\273L\377\271\215\307E<\273\026\037\223\ry \034\266/v\344s\336q\261uP\201i\004\233N\346\243dw\203\322\005\240?\367"
+	.string	"\350O7n=-\377\235'\214pH2\355z\002\030\354\2563\323.n\275\355\001\333\223m\214\t"
+	.ascii	"{\311'\323\342\2533\236\206\360\\\303!G\274,\004\031\356\212"
+	.ascii	"\251\235d"
+	.text
+	.section	.gnu.lto_microsleep.116.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`\276\001\365\020"
+	.string	"\306 sF\340\360&\035\332\203\0319\002\337\377\211\344\031\277D\375O<z|~w\032u\245\311\365\251)\200\314\r\203^#\375[\365r\264\217\313\027|;\024C=\264\003`K\004\306\223#\"\036\3434\355\320\334\f\355\275\245L)_"
+	.string	"Y"
+	.string	"^"
+	.string	"\2734\003\346@\016K. \036\276\223\304C\263l\033\247\341\354"
+	.string	"\035 \232\037\035\273\313)\bk\262\016\343\323d\371\004l\214\\F6X\353p\304D\315\343L\276\2475\0261D`2\017\001\217\212\020'XL\352\273\277\02464:#\033\254\346\371\241`w\235/\330\206\373\343\266+\330>\261S\003\246\265Re\366O\210\206DXc\366{\376\020\230\2161\ra\372\275\264j:5}\221cX\362YBj}\326b7C\023\217\275\301\027$^\373\355\277\363\311\246\335\207\365\332\313\310\022\3559\240\320\261%\355j(p\350\003 \207\337\221\247\375\331yX\357\261`"
+	.string	"\2737;.\002.m]\213j\324lOe6\371\323\334\351\220br\207E\362+\336\241@^\266\312J\376\365\364\267\03367\031m\345\333\335U\225\251\035\341\035K\376\274\224RUO\323\343\343\350\036\212\327\324\317\234pe\223C\364z\352fF4=\336\022\355\324\273\026=\332\335\023\3051#\347\303,\007L69.\253LA\271PxN1i\360\200\201\003n\205RQ\241\2548\t+(,\\\212\312\2053)qj\002J\305\255R)\025w\242\3555\346\005L7\246$\030u\371\345\355\336$H\252\215\200*\363\257@\036b2\242\306\374n\241\030\225\304G\251\310\017ZY(\3077\214x\030\025\006]\350\020 m\b(\361/\250'\034\246\022\001\037"
+	.ascii	"{\311\027\323\360R=\340\273\302va\017\013k\n\346\241\220\202"
+	.ascii	"\213S\005fA\t\026\343lu\031\254\266a\333\210h\263a\027a\210K"
+	.ascii	"\230\273\212\221\317\313H\253\3054H\021\252pp/\234\242\022\334"
+	.ascii	"\033\337\237\b\202\2120\3505\233\301\332Y\006"
+	.text
+	.section	.gnu.lto_delayMicroseconds.117.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`c"
+	.string	"E\t"
+	.string	"\246RA90\345(\035\200\013\267\221\260i\037Q\304^\016G\261\376\365\207\005\342\3072\264\001\202g\265\037\227\200\266\\r\306\337u\201\221o\200\310\025v\006M'\230\222E\373\377\336R\246\024/"
+	.string	"/"
+	.string	"0"
+	.string	"\235\017`\016\337\0050\207\336l\226w\033K\3202\241\b\001\260\273Q5\276=7\377\260o\270\325\351\2319\330]'\267\262\270\365\266\013l\033\330\327V\226\375\327\0175\3752\255\231\316L_\363Z(WY\331\255\230\005X\031$\351\340\330~\332\367\270k\373K\302\233]\f\221\330n\347q\324\034\006V}\352Q\235\244^U\257*I\375\343 \036\3619\034\341X\236;\364\035\303\034\246n.\240^\003R\\/*\027T\316\354\356\224\232a\377\355\356\006$S:\364IX@P\210%\021\203\006*\305\207\006\220C\fi\244\370\351x\004!\322bi4\322\"\247\333\277U\2265-0\031JS\316\344S\233d\312s\356L\350)\f"
+	.ascii	"{\311'c\372\200\032\016\316\236T\206\232\312\334\230v\031\030"
+	.ascii	"p\t\201XM\001wy\321N2"
+	.text
+	.section	.gnu.lto_delayMicroseconds_real.118.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"E\007"
+	.string	"\022\01635Po\322\001 \033\345\r\341:tf\227\222\236\211k\260\240\001\252\251\312\311\031\"\211\2612\211\b)\243\365\2566"
+	.string	""
+	.string	"\"\016\030C\355\237\005\272\241m#do\231R\242\210,\310\223\260\200\240\020\261\020\303\365\301\342C\303\307!\202.Q\364tjA\204\256\210Y\326\0259\334\r\377H\325\234T\272\212gQ\230\371Z\211\211\364V\202SJw\361\264\226\323\362q\264\206\377\337Gjm\262\023\302R\213WP\376\214\030\230w\324\t\b\247\255\263u\210E2\233(\272\3717JL~\256\240Qc\252\343\200\312\0244@e\252Y\353b\316\343\002%\026\f\222\227\377\361u8sf\265G\274\331F\2323s\360\277\271\2154\334\347\266\003m\r\332~\004\t"
+	.string	"{\311'cZ\366\f\003g\237\301\274K"
+	.ascii	"\304j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_delay.119.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`\027\001=\r"
+	.string	"V\031[C\020\221\223\016;6$LY\252\243V\027\207r\242<\254Z\221\330\212\370[\372w'"
+	.string	":\342\007\221\370\026\204\032\256\371<\022+\243P\300OUn\222;\273\t\257\201\200\021`!\274U\272\271YB\366\2262\245I"
+	.string	"G"
+	.string	"D"
+	.string	"\216qoe\013\260\324(y\241\331\335KU\fS{\204\232\232o &\005\327\211\036\24152\t\001\240\033\301\016\324I\346\245\347\206nKH\342\344\372\322\033\274p\231\301u'Ok\301\356:\271\256\303]\335\266\004\333\n\354\207\0040\335]Z\354\232\244j\366\2132\"N\372\355\277\344\216\355\375\204vR\206"
+	.string	"\353b\317\201\206\245\346\264\353\035xt\202\315\243\275\315\323~\211\233\320\336\"b\316\356\007\020*v=\004\2766\217\236\023\250\036\341\007T\217\326\034&\033\337\006ww!'\255\231\213T6\310B\236\363cL\251\217DaV\214:u\225\366\005\fy\316\322<\231h|\233\212lO\224\232b\277c\005u\262\242\330o\3719'\335\226\246U\323\251\351w\004\300P\t\031\366\311B1\004\222\366\340x\020\301\001\204+\373\230\200}\262\253\002\205\017\310\345\201\205.\016\217A!\037\330\225\201@\330\325\361\366\212\342\215\f\017\337\210nQS\224\001\013\222D\231\243\252\020E\311\215\221L\331\322k\252\276h\030\261e\352\372\231\026"
+	.string	"{\311'\323\360\316&:\313T\236\016n"
+	.ascii	")\263\257\t\233\203,\225j\314(/\024\265\306\267d\247\341\240"
+	.ascii	"PY\006M\300\251W\002qqK\225\252e\240^6\t\363\t"
+	.text
+	.section	.gnu.lto_timeval_sub.120.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`\273\003\315\030"
+	.string	"F\356\236G\300\226M:\025\034\214\315;\230\312\n\030"
+	.string	"\347#\006M`\221\024\346?"
+	.string	"\021\0230#v\244\177(\220\001\035c\367v\377\022\315j\304\027DP*-\205\223\375\216\301`o\006\324K|\024\007<t\310\021I#dK\231R\211"
+	.string	"v"
+	.string	"\217"
+	.string	"\357\031f\345\023\327\n\302\216E\324\203S\371|S\354O\320\330\265\270\262\313;\360\317\rB G\002nVi\n\006\203\037_\026<\355K\335\207\355\274\243\343\354B]\021\331\345!\360,\374g^h\333\347\361\0366[+\362h\350tv+rA\270\354\356\254\3472\360_|\016\370Og\334\366\250i\363_\016(L]u-\351\220\036\235\2565:\245\330\263\273\357=\231t\267\314\227\203\335u.\351R\334\337mO\260}\301\216"
+	.ascii	"\002]6\017)U\206\375\270\ne\3074\317y"
+	.string	"\377\200c\335;\007\362\013\370\217?\300\251n\331\255n\0350\235\223\351X\246q2}\223i\233L\327d\232&\3233\231\206eZ&\3231_:\214\351\227\246AM\177\231\216\231\326Lg\246_ \237\266t\344\210\361^\325.\212.0\333\3443r\343X?\325ou\265o\377\312\317\302\262\226\211,;\027Wv\227Bx\233_\0253\nS\032=.JGg\364{\222\343\222\321\030\205i\f\202\213\272%\021\222Q\003\037~D\bC\214\276\367\310\344I\253K|i\250\267\026\270\243/\215\335z[p8@\335\321W\311q%\335\b\374\024\324\343^D\375\364\265$\307\245[T\234\3664P5\352\247\005\267\343\226]\276\246\252>\353\031n=+\270\250[\356.\222\252\f\247^;Lm)\245\227\"\026R\003Lq\210\017\241-\360\205`\030\021\356\356k\034\201\377\256\n\236\204\354\244\2222@ADC\361eT\253\375"
+	.ascii	"q \032\n\215^\342E H\020\005\325@\003%\250\260A\202\206YQ\220"
+	.ascii	"\207\332O\321l\350\303O\210\031P\215h\226\240\3074\021A\265Y"
+	.ascii	"\021\215V\233\301x{\205\362\263\036\241\t\212\206W\221k\262\221"
+	.ascii	"wr\2312=\353w\252j\342RPe\271\246\027\351\373\200:\312d\233G"
+	.ascii	"{\222\364\346\034\345\321\307\024Gs4\265\344t4\211)\001&8\332"
+	.ascii	"\340\tI\027\251\033\335\242UY\302b\2435z#S\033\375\302\324hl"
+	.ascii	"\352*\n\215*\021\2320\202F\312\223%,\001C\250Q,\347\0202\304"
+	.ascii	"\261\222QT\2204-\006\200\242\031$\363\021\220\241T\3144i\251"
+	.ascii	"\r,\032\355\241O\b\r!E\t\033\224)\035\377\371`\3357son\246\207"
+	.ascii	"O6\355?\340+\226A\215\337\314\266\020\361\211L\313\326\374\266"
+	.ascii	"L\224\273\221\307\232\330\374\231b\361\246\3508\t\200|\201s\276"
+	.ascii	"\227\304\250\227\220\030Oy\304\241\374\bC\200\263\246\026xpb"
+	.ascii	"\031\334\032o\201\306\234<h\2435\211\240@V\032\205l\200b:m-\013"
+	.ascii	"\367\371^e\005t\214\230\244\024\315\227\345nC\002\025"
+	.text
+	.section	.gnu.lto_motorDevInit.127.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`B\002E\024"
+	.string	"\366\344\205J\240\024R:\024\207P\026\257\350\354\315\013o\003C\343\374\f\203<<,h\276&\020\005\206\177\030\365\244\332l|\264}\017\311\314\3767\217\372\201]\030]H\324ps\023F\220\304\360(<\260\017)A\216^\310f\362\t!r\247\024o"
+	.string	"m"
+	.string	"o"
+	.string	"\025\270\300f\371\321\300\023 ?\226\037@~\264\316\266:\220E- \264\204\203\264Uk5w\205\313\213\300[\244\272\223\243\270T\347#\375\200\357j\346\244\270EA\250\007DA-b\275\035\035\305\327\216\211\251"
+	.string	"\275\033Qe\310\025\212\013Ouz6T\214\321\363\275\360\t|B\214\250\204\275\236\323W\204Z\253)\257\307s\277n\333\306\366\006\233j\b\206\375\350/_\364\217O\272w\251\351H}"
+	.string	"%SF|\206\204zW\272\252\265\304\320H\3551:\301x\322\355\327\360\205\216\371\301\333\320=\311O\257<\365$\266\204\242\260j\255'\037}\241\374h\">f3H\321\375(\304I\352N\312\305\204\005\236\206\356E\"(I\255\331\3458(?\222\320S\373C'\322}\306\210\227\324\372\023\305T\003:\266]\336O\344.\3252\252\252\241]\027k\255UT\360]\330v\220Z\342q\343\263\243C\377'i\267\334\3514\320\300\266\314\233^\004"
+	.ascii	"\251\265\252\3348\323\314\007\372h\0174\232\360\343\t\237UP\026"
+	.ascii	"\r\035\212\373\202\247\365c\367\267\276\322\227l>\220A\340\350"
+	.ascii	"y8\036\221q\277\020|A\214\250\202Gh\350\320\006\316\320\3755"
+	.ascii	"\025\311\361y\177\0342\247Km%W\213\201\2358\230\030\013'\214"
+	.ascii	"\313\214\005\3662\343P\263I\270\331r6Z\314-(\0252\254`0s\347"
+	.ascii	"\313M\2263k3\031\315l\271\341L\024\023\333>\23473g\263\335\314"
+	.ascii	"\030\260~\177L!\005\026\027\026\315\356|\034\367s\034\352d\221"
+	.ascii	"\311\310\217G:\002\037S[>CY*\310\375\355\250\241].\227\356K\007"
+	.ascii	"\316\006w\270\232\306\3759E\306\302v\253\350\311w\0030 `\002"
+	.ascii	"2F\351\001\376\030\253\344\261?\311h[\361d\304\021\346\016\255"
+	.ascii	"\257\231\332\223\te`\021\003<\226R\331\005\245]X\360s\301\201"
+	.ascii	"P\213B:/\316R`\343\"\262\255\327\256\b\303\244m0\343\n\207\004"
+	.ascii	"Yl'$(\310'\272\355\366\226\341\273\311\\r\260\027>{\224/K{t\276"
+	.ascii	"\227H\001o\001|\311\026/\2629L\371u\365'"
+	.text
+	.section	.gnu.lto_servoDevInit.128.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`I\001\355\016"
+	.string	"\326\033fG\340\224(\035\350\342\317\201\234\200\033\2226\240\001\035\361\242\207}PO\232\350\234p]\226$\304\213\253\323)xZ\213T\226\002~\034\321\030\326K\241\f\256y\214\357\022\2452\364`\007\216\225E|\304\254G\032\331d\313\224\002R"
+	.string	"N"
+	.string	"P"
+	.string	"A>\262\266"
+	.string	"\215\217\0217Fv\267\223*\314]\033oM\301OM*\350\327<\201\252H\030\203\211\246O\355\223*\301#\200(B\013\361\350\234\270\353\032#\206\252\275\220\271\274\353\013TDlb0Q\346\372\221\260\273V\030\321\304\275\335v\213m\n\366O\001\376\347)\030-!:\246\343\330\330%1C\26293G\213\267n\177\364]\006\331\301\003\360\255\227/j=\260h\200\354\354\216\f>\035\201\373<\310\366\325~\214\313"
+	.string	"?\003\304\005\354\316\350\270\261;6p\307}z<\201\355\223\373\200\355\323\240\0358;P)B\235\371\3676\233\345/\317"
+	.string	"\004\333\037^cCI\217\335\r\321\370\r\311g\361i\016.z\230O\337e\373T\300\032r\322\231U^\336uM\246\222\205\261W\222\223\316\244|\245zpH\271\262G\223\206xP.,g\354\355\255[\245\006\035D\030F'"
+	.string	"TV2\214\274\t^\313'\"\201\234bR\341\302\211\205\256$R\371PJ\335h\005\205\245K\371H\235\t\002{\032D_W\362\274\257\003\215\373\232s/\0249=;'\031N\271r\tLnr\256P\307\250\314\346G\b=rmwW\223\253\277l*7y \f\033"
+	.ascii	"\200X{\311\027\323\020\232\257\266\226\211\345\301\214\276\253"
+	.ascii	"\261\323\022\013\364\270\035\3069\033s`\232\n\233\006aZ\202v"
+	.ascii	"[\344\b%\236.\016\270p\315\352J\320.\016\213({\351\252\361\202"
+	.ascii	"\"\362\272\346\023"
+	.text
+	.section	.gnu.lto_pwmGetMotors.129.518b89b757251988,"e",@progbits
+	.string	"(\265/\375 \372\325\006"
+	.string	"\322\214/5Pm\222\016\004\210\022z\"\252c\301$|\234Cj~]\f<\276[\270o\177\267\265\306\246\357F\032\373\3160j\002 \246\326\035\360\034\225\227\230\035M,!2\005o&\004\205\203\204hq\026*\215\025\035\0304\rqSA\304)3\365\300\251\242EQU\304l\331\027z\221\353\222\231U\273!\335\".G\341\022\227\253Vx/\2510\223\275\317o\036\3674\276\226|\241w\026QJMN2-VT\262\004\222t\374\235\307\\\217~t\306^\305D\226A B\241\030A\311\334\342[\005\244\302K\003\244\302\267Q\254\016\273\005\251\301g4\322@\236:\200\202\314\334i\240\213\376\372\017\374\323\217\021\t"
+	.ascii	"{\311'\323\342\255\243s\205P\\\023a#\360\026\"\027w\305\324N"
+	.ascii	"2"
+	.text
+	.section	.gnu.lto_pwmEnableMotors.130.518b89b757251988,"e",@progbits
+	.string	"(\265/\375 \361\205\006"
+	.string	"\362\013-2PM\324\001 \007\230\n\005\260?\025\320\020(^\250\311t>\220X\021\365\032)\203\356&C\302\035\2506\226H\251\022S\353`u\346\026T\214\255\367N)\216\036\004\205\203\004JI\013\025\242\250\003\003\324@\243\nA\037\002O\017R\245\3244U\332x{\311\031`|+`&%\374W\214\017\362\220\312\347p\204\025\257}\372\026\3639KN\302\213.\314\342\305\366\260(3\354\003\254\344l\351\214\200\335SLv).\226\375&I\207\3557\276l\224{\033;\340a\231\020Q\331]*5~=^\376?.\240m\330c@\301\356:j[\305-o\333\261\375\330\266\b\t"
+	.string	"{\3117c\361\2003\244\305\027\272\206\273\2050^\206"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_pwmAreMotorsEnabled.131.518b89b757251988,"e",@progbits
+	.string	"(\265/\375 \354u\006"
+	.string	"\362\213,3Pm\222\016$\241*\026\352\212g] U\003\350\326\232\013\376\243\032q\263\177\267\303\274\001\250\220\307\276\263\214\325\200\214**v\360\2346x\302\370\366\311\226)g\246\204\005\004\005Wi\030\036\246r\017\r\030\007\227y\021n\272LAh\236\253(\3529K\226m\"l\027O\373|;\352a\335\215%6\330\253\322\335T*a\013\270\360\340\350\263\0166\214/%\233\350\307\261Q\260\253$'\231\240\221I\216H!\034?\347-\023\024p\266\232i\200\0040\212\211\217\222\314\314\265\214ZE\353\026\353\301G\004\344\nu\212"
+	.string	"\006\2319^!\213\336\372\017\374\323_\021\t"
+	.ascii	"{\311'\323\342\2543r\206P\\\023\001#\362\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_isMotorProtocolDshot.132.518b89b757251988,"e",@progbits
+	.string	"(\265/\375 \317\325\005"
+	.string	"\344\tm"
+	.string	""
+	.string	""
+	.string	"."
+	.string	""
+	.string	""
+	.string	"("
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\312\347\243\307\235\266\004\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\300\200\200\370\305\207\214\273\024\217\250\300\001\177"
+	.string	"}52"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\357\330\001\221\216\217\236v\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\203\003\202 \006\177\001\200\300\013/root/repo"
+	.string	" ./src/main/target/SITL.c"
+	.string	"\n"
+	.ascii	"{\311'\323\"\030>*\254V\001\271\206\013F\214&D\016w\016\326\316"
+	.ascii	"2"
+	.text
+	.section	.gnu.lto_pwmWriteMotor.133.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`\271"
+	.string	"E\013"
+	.string	"\346\226O>\020Q\225\016+\200i+R\002\352\200\351%\177\260D&A\204\337\370\234\242<"
+	.string	"\311\261\232\213\032fLh+\215\214 \017a\001h-\034\020)\030\277\231F\212\220r\216\323S6\264\211\224)\005;"
+	.string	";"
+	.string	">"
+	.string	"\207\316\264\rX\272\257,Xw;\254Z\273\037\3051;tg\317\370\207Z\002*\r%\326\215\335\215\372\341\335\263\363o\342\021\317\024zB\022\354\256\3233a\270\365\266\013\330F`\237A\177\366\357\207`i\230iL\323\252\351\304\322\007\200\2516\\\006k\367\302\013\307\272\240\013\020\266/\261\255i\237\304Kt\377\334\302\221\335\0270Z\273K\261%;\234|\300\343\020\273\200G\326l\233WC\025jv\220bd\212\351;J9R!\252zR\210Q\276|M=\211\306O\034\005\307O\271\363\311{\207\376\347qx\255\300\201\305\210\f\242|\331_(\325\203}l\365d\177\025\332G\302\005\004)h\0176\031hLe\201\003\005\r\242G\203\300]<q\223\271h\"\206\353\304\312\304\333\004\215\213\236m\343\242\344\333\353\311\231\r\021.\221\216\f\3256\350+8\001P\273{\300Oq\025\021\374\324a\017"
+	.ascii	"{\311'cq\347\3150.<\344\215\202a`\374\305\270\256\214\261\250"
+	.ascii	"\366\\\310\257g\026\020*\314\001wy\321N2"
+	.text
+	.section	.gnu.lto_pwmShutdownPulsesForAllMotors.134.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"\225\007"
+	.string	"\222N56Po\322\001\220\216\232G*\244\221\214\030\376\217;\255Q\213o\216L_\016\305\255\031\260\357\331gp\273bowe\202\241V\210\257\255\212uF\226\326`k\233\354\235R3tE\005\031g\004\t\330\303ix`p\200\363\003!;\023\206\": \350\221\023\220C\340(\361\221p\306(\241\246\356\255u\247\205\217}Y!9\013\373\027\306\027y\275|\017S\210\332\261?_\204\371{()*S\306Bj+\273\216\232\333\260o\255;\331nSR\263\267\244v1V\252=y$(\333\327\330n\31568\240\317*\354vM&#\273\265\300\020\340\317\324Vy\355\330\001\020\215\213\224\313\356B\307q\372F\375\207<"
+	.string	"+\215\3362\t\273\353\206\2252nw\333\033\333\b\266Q\001\t"
+	.ascii	"{\3117cz\366\206Ea\032t!\327\016v\250\324dp\227\027\355$\003"
+	.text
+	.section	.gnu.lto_pwmCompleteMotorUpdate.135.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`\301\005\r "
+	.string	"6\371\304I\240VN:\204\007gz\310s\344\213C&\320\347\216\317p\375@\2575\n\375\025\006\330\271k\321\0021.\025[\373\016\016\035\360\376\222\f*c\205<m\361\r\"\274\312\037\205\340\375\273j\202\343-\246\264\314\314Z\262\211\334)\005\256"
+	.string	"\240"
+	.string	"\266"
+	.string	"~\217\373\370\275\350/\232\372\244N\262\262\253\032e\265\326\237S7(>\247<\265\375\246<\265=\247\215@\301\357<Lxk\245\342\362\252\265x\300<\333\251\177\366\225\027eT\236\253\031\301,\263Z+oc\230<Y\274\313\371;\356f\253\225\224\334\371\363q\303\245\343\016\224\372-\312F\n\250zq\366'*\240\310\235\222\261\340\261>"
+	.ascii	"\207\n\251"
+	.string	"Y#c\2169\244t\303 \231 j\353x\255\023\263\274\321\342\264\026\244u\nC\254K8lq\222\305W7l\"w\265\326c}>\r\231\346\254\005\325Z=\205\303\025w\356\266\211\330~`\323\030\001[\345\022\345\267\003\020*M\023\315\270\271\253O*\355\236\210y\341\367X\257\021\322%\313X\323.\331\305\245\271\304c\216(/o\225\355s\036?\200g\335=/\336<szg\247u\312\351\034:\215C\247o\310i\233r\272\206N\323\320\351\031rZWN\313\320\351\030:\235#\247q\345\364\215N\333\350t\215\234.\313iJ\247I:\275\344\364\334\351\027\250\271\362\205k\370\260#\265\246H\003S\307\250\261\306\263\376\342\247}\373?|- \017\362{\226\301^W\324\2430\273\032\"d;\335\221?\226s\001V\252\330,\324\224\224\335\250\255\343\r\272D\347\004wP\255\215.\250#\314\364\327\321\214\323T+\220"
+	.string	"\317>\3315K6\345H\26353K\243\333\231(PtgF\231u2\326$fer\033\203\333\234\222/\021\2337Xy\212kbu\333$H\216\330\366V[[\271\265\003\0073R\236\031\351\332\006\272\321];d\316\360/\r2d\265\326\005]\367\332\300\241\250\250<\335%B-\344\322}0\f\317\356\222{\2470\246\231\346\271\273\024\314\251\f8\323\f\234\313\310Vke\340\027\371\326\221O\343\324\036\220\250\217T\236\316\275\213)&VF\340L#\227\230 j\213l\003H?\372PdD\344#\321\263\371@\220\350\t)\365|\275$\234\215\200$X\210@\304\363\035yP*\362\361@ \025%\361\214\224F\360\200v\356\2058R\342\371z=%^\256X\037\004\\&\334n\332\016\204\346\205^\236+\243\215\333\022\375\363\235"
+	.ascii	"\363?\2166d\253\025x\241o\3663\b\021\206\206&P\230\027\356\354"
+	.ascii	"\205x\321\201\300\3518\303\266\304!\327\361\267\234K\t\237\206"
+	.ascii	"+\020\315\013\211\312S\235=\326I\034SS\254\240jKt-\214\372\354"
+	.ascii	"R!\177\336\263O=\373\036'\313%\366\254\317\316"
+	.string	"\300\020\353r\242\312\331,\356\322!\303\3622\r\0270`\340\302\331\234\233\305\261\331\233\245Y\022\036q\250QD\207\021\222\031\221\221 I\222B\253\001\300\002\221\231\262y\021 94\320`\340\3343;I\331\253\002\016\204`\265\241\274|\264\372\277\370\352\220\211:\302>\370\311\211\323\357.z\263$\251\243\220.\225id\322\345_B\272*\345P\374\207_W\330@\3133\224ag\305\362xDn\250\305\312\316T\263U\002|\366\"\221z\264\361\022\350\007\017\244\237\357#\370\260q\214u1\002)\210\310\3205\t\004\333n)(}O\236l\026-\205\364k\253s\210DJ\276\370\260\213\2358\341\342\332\267\331\001\315\211\314.\232\023,\027}c]\202N\371\213\t\022n\232\371\036\003\211\267x\272\350\302\346f\236\006\001A\212\252\305\276\201A\034\fW\307\237\"\245\305\337d:\r\240\036\003\373C\006\324\023\203\253\"\334m"
+	.ascii	"e\224\315%Km\bU\003"
+	.text
+	.section	.gnu.lto_pwmWriteServo.136.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`u"
+	.string	"\355\t"
+	.string	"\006\324F=0\305*\035\236\013\371^o\267\347\371*\345\230\322r\272j\312wE\325\177\336\032x\003\001u\233\305\354\224he\210;\316`\330P|qcTa\275\315?e\243\274\241\356\343\267M\266L)3"
+	.string	"4"
+	.string	"3"
+	.string	"\034\216\273!.\331n\330\361\314\\\372\263\007<dmB+@\nv`wg\034\371w\375\374\243\\\003\252NW\214\303\356ZA\025\310\035o[\301v\203\375\202\252>fk\t8"
+	.string	"\330\356G\r\301\322\244J\211\355olG\265o\362\223\357\241c\326\354\262\264\310v\267\343O\346\222s\204\313\345\366\203\313\245U\355\205\317wW\f\376\353)\030>\311\245I&=x\351\233.\227\007\tlQ\243\026\360\230\305\370\210y\315b\251\004(\255\331\341I\243\210\375m\343\312~\370ow\375qSk\234\251\002\224!5\270\211\221H:\344\201\220x\210\230%\216\302\003\225\346H\004\262\230!\2174=\034w\027\2347K]\347\315M\270\3376\256\2341\260BC\305\016k\264\275qXg\300\332\335\013"
+	.ascii	"{\311'c\032\202\032&\234\301\027\343c\332\345\032\276\230\205"
+	.ascii	"\202Pa\"\270s\213v>\001"
+	.text
+	.section	.gnu.lto_adcGetChannel.137.518b89b757251988,"e",@progbits
+	.string	"(\265/\375 \374\375\006"
+	.string	"\002\31506@o\222\016X\240\352\203\340Z\330]`\211e\017\211\360\323r\346S\r\230\375\233\333\331\266t\001\314\264\315\362!wZ\237"
+	.string	"\317\354:f\372\003$i\374n\226\020\231\002\022\027\206U\020\026f\213\303\340\260\320\020\267\353A\253\266\210ET\023\321\322*\"GsFqiq\3132-f\272,Gi>\020\364\235\347A\217\357%a\307\277\313\210\324\025\223\314\214RK\252L( \177\3473?|op\320\251\210\3050\223\243\344$\263+8\002t\372\357\250!\235\271\315\305\307\263\031\261`\220\2202\273\030\320\001\252\323\253"
+	.string	"\325\t~\224\353\343nG\252"
+	.string	"J)\205D\236>LBf\376B\"\215\016\373\023\374\b\377F\t"
+	.ascii	"{\311'\323\"\030>*,V\001\271\206/\230`\211\2510\246k\222\001"
+	.text
+	.section	.gnu.lto_FLASH_Unlock.142.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`\"\001\365\r"
+	.string	"\326\030_G\360\262&\035\262\370\360(g}\375f\213M\344\3550sB\355\363-\204S)\312Sy\300,\231VN\323t8Dge\005U\251>\006\353\352\310\361\253\226\037fw\003)\002c\300b\021\017\207 n\2425\331[\312\224\002K"
+	.string	"G"
+	.string	"J"
+	.ascii	"S[\023O\035\223q5\345\217\200\336\261\220\233\313\005\241\fU"
+	.ascii	"\215\030\340\315c,\300\372\201\202\004\334\020\r\274\274\037"
+	.ascii	"\021X\243\033\023\2044>\220\200"
+	.string	"\2528 \210\204\320w\256\034\300\225*\310\311\234\323\372\201\036n\220\333n\261-\301>K\330\227\245\347F\215\366\260T\033C\006\375\367\375\316\035\370\250x\345P\255g\273<\335\022\366\343\\\034[\325\253j\275\372\"\007\204l\264\256c\306\234\035\206|L \371\223\302\366EN\3318\356:1\t\360|,\027\2579\003\022\200\356f\027\200)\370[\177\341r\2400g\316\325\277\227\220\225\206\340\322\2061\351?g\254\365z\270\335\005w\264B\236\257h\211\260\2113\230\372,\356\232\361s|\341$\375\023v\251\253\022\302\320\001A\243C\352\303#h\304ZC\036\331\266\225\b\031\203\222\254\005\305\304u2\245RF\001\206\304Y\210Y\251\360 \245\301\2062\241\304$\223M\005B\212\206*\271t#\224\026\36322i\244\356\244\231d\346dJ\235\206\342\270N\023\271\346\027\347\204fU\307\002\250=\"\355z\017\241\323\302&\032"
+	.ascii	"{\311'\323b\2351 ?\324m\212\001u\260+s\320\3408F48\001\355~\205"
+	.ascii	"9(\005\312\030\002\245]\305\002WX\355\026\f\366\271\206\373\f"
+	.ascii	"\341_\306\005.\337M\323\004Fbt\253\314"
+	.text
+	.section	.gnu.lto_FLASH_Lock.143.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`\342\001e\021"
+	.string	"f\337rG\320\324I:$\237\201D\301F\324\270U\324\032\304\357S\025\\\013\221\032\377}*d/\370\2230\017N:B,\230D\214\213\367c\226\006!\007\327\032\375\245\343"
+	.string	"\313\027O*N"
+	.string	"\0178T\331\262YpF\2647\2212\245`"
+	.string	"X"
+	.string	"\\"
+	.string	"M\346<\261\305dB\305 3l\337e\036\233\3527\243Y@\351G\320R\326\234\263\333\030\347\271\214\334*\217\377]\242\f=\246\200C\347\270\001*zH\251\200@\\\003\251\032+\\\340\217.\267 |J\241\002\372p+Q/\246\216t-\001\326TO\\\346\234V\033\210\342>\271m\032\333/\266v\001\337\247\226\200\\q;R\227\204\177\343\267\035\377\3103\234\350\343\310G]ZxD\213\250G\267\264\tI\224\213\365\b\371\325\220\303\310\217.\261T\373C\b\275\355{\244\337\004\223\223\220\226\225\317~\366\355\323\205a\237\233[d\257Z\252:\252\232S\265^\375"
+	.string	"\t\250\240\222~\0250\371(wA%-B%\242\343x\223LX\225\205\265\242q\355\013\030~|\304u\020V\331\020\240\334\3726o'\371\317\310'\235\207G\300h\316\236\333|\035\337A\343\037=:\346y\362\321\226\325\274\202\366[\342\366I\260B\026.ep\337OR\327\266\271\321\333\f\200\311\351\246eU\333Na\311Q\300\362\332 \003\021\313y\315\330x\263\030\232\027\330\203\030\t\031\f\330k\211\221\201\201u:\262\032ZL\247\353\300!v\323y\264\234\256\345\345\231\007\031\255\323\231\315h\235\3536\277E.=\353#\021\250\r!\302\356\347\"4\204d\304\003*\367I'\002S\273m\002J\255cy\264)T"
+	.string	"\332\317\276\220\017\021a\001\026( p\002\231Q\272\003{\344\023\263X=\306\224\f\232m/\270Ku\rK\371\332;@\231\252\254\221B.\314\201\177\340\216\353u\263\206\033\2571\\\001\302%a\255\374z\304]\211\3006x\003\2469D\261\350\301I;c\271\322\265{u\354s\303\375b(\017C"
+	.ascii	"\315\357\314\343\033:\352\345\315"
+	.text
+	.section	.gnu.lto_FLASH_ErasePage.144.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`\252"
+	.string	"\025\013"
+	.string	"V\325L@0m\224\016\3038\026\217\267\362jesUa\353F\335fQ\327\237K1\f\037\260\221\355I\303\316\f\254\2017y\376d\255\245)\337\261\356\235|\020\320{\037\330@,F\024m\212\337\310\336r\247\0249"
+	.string	";"
+	.string	"8"
+	.string	"(v\277I\371\206u\031\257a]*\205o\217\n7?b\001"
+	.string	"*\021\242\363>\217\222\tW\f/\024)\273\373\r\207\020<\020\204\021\313\356\032v\236\204[\336\366\3056\210}\216\337\257\n}+\226T\037ab7\302J\265(\351\301\202m\217=\261\r\241\375\f\327\340\371\347\340\031\273\243\017\035v?\017O\311\245?\211m\377\3021x\274]\036p\336G)%:\005\235\243~\016UIV\275\0360\201\b\301\024\366O\235\016\022\273\334;\337t\016\232_\341\322\r:\360\335\245\337\261.\257\023\021\251\225h\005\007W\366\367\201J\262\037WG\366\003\232ve\032M\210\201k\203\031p\341LE@\201"
+	.string	"\004&\347\332d\030\316T\200"
+	.string	"\223`f2mV(\306\026\\\331\344`X6'\337>^G\361\233u\224\212\023(NA\216\321\002\252\332\030\003\370\022"
+	.ascii	"{\311'\323\b\260\341+{`\f\230 T/\354}\302\216\307-\350B\236\217"
+	.ascii	"\331k\311\330\203v\005)\001\215\032g\250!\333U\312"
+	.text
+	.section	.gnu.lto_FLASH_ProgramWord.145.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`\270\001\025\021"
+	.string	"\246`tG\340\322&\035A~A%\377\223\214g\203gS\267\357W\203[\020\017\346z\343X\345\362\205\013t\317\325\261\255]P\216\rv\232\211\354\016\201\017\250\375\034M\034)X\216\230x3\214Y\206j-\363FN\354\336{\357\224\002^"
+	.string	"Y"
+	.string	"`"
+	.ascii	"\324`f\333G\361\0248f\255\274\\_\212\212\030O\321\322.\250\235"
+	.ascii	"nRO\347\t\324S9\342\254W:ed\371\207]%gI\210\367\265^G>\237\323"
+	.ascii	"\314\347\263\344{\221|:QN\223\236\022^\311\367\232\n~\320\br"
+	.ascii	"\330c\207/'F\223\203\335u\364\276\017\267\351\266el\277\330O"
+	.ascii	"\n\031T\361\336\251\257\252\247\227&$\037!O\314\025C\033lE\031"
+	.ascii	"d_\206a\030Z\002\331\037\372\263\203\177\245\321tF\307\031\375"
+	.ascii	"\021\025 1\003E\273=a\221=\2425"
+	.string	"L\330\306\261Il\313\370\241\r\006\260\033b\b\203\030\355\2578\013\234\203\034.`\027\b\207\321.\270\300Z\366\247\366\006sz\311\226\253\244\322$b)\311\322\003\217\030\022\r\0203Y\245\235\232\211\367Le\313\006\002\242\3653\243\214=`;d\\8\221\320\213\307\240\371\f\245\335M9\205\001\356\235\243\236FYm<\336x\365\234\2202\310U^Z\200\351\320\211D\354\273P\035P\332u\335\363\213\336\202\363I\234:\036A\200J\325l\335I\206;\255n\270\223\315\211KL\307Q\240\331\272\024\327IxYiy\300\002\241\302\t\352\006\303\246\201v11\3334\f\n\313\204\b-\332\n\225\352\266\225V3\263\321h0\235JC9\231\263Au\332\212\343:m\256\004\232g\325\037\305~\216\\2g\356\356\326\001\221\312\023\335\310\245\200\320\356\316\275\227l\247A\202! \220\002\2311\364\272\345\357\305\300\223\f\277\307\360"
+	.ascii	"K\2652\001\031\247\361\034\303 \302m_p\264\206\342\363!\316*"
+	.ascii	"b\237\305 \232\326\342a\313\037\\0}\204`\354I\310\247\271\002"
+	.ascii	"\303\271+\b\032\244J\372\273\272\312\220\246\033\325\366A\001"
+	.text
+	.section	.gnu.lto_uartPinConfigure.146.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`<"
+	.string	"\255\b"
+	.string	"f\320=9Po\322\001\345"
+	.string	"I@\345*\021-\355\013\037\027\2024\222!Ziq23k\210\363\336d\261\205\r\265\241FQ\013\205\315B\031\023\353\004J\224`\345\260\2330\"m\357\224\002*"
+	.string	"-"
+	.string	"."
+	.string	"\330/\203v\314kj\017V!\036+2\273;\345\310\301G\320\377\352\001\341\251\364\b\360\331]\307\360\004r\313\333N\260\035a[\025k\211\262\345\300\013\311\3513.\273\03754\313\272ZJ8\266\037\355\253\216\002>E\343\235]\024\f\313ne\360\314~\271\336"
+	.string	"\373\225\275 u\277Y\211r\326:amH\016c\361\365*$\201\324\256\351\341Ef\372(\374\26212\342C/\264LX\035\262d\327R\224\"\3667\273\033\336(\351\243\032\251#\342&:\257\241\343 (4\216n\240\021\201C\236\007\t\007\320\3746\021\325\276\331qZ\305\fQ\213\351A\2607\332\350\374<\217NN\n"
+	.ascii	"\305,c/Id\354\001\237\265\300\331-0\344\022l\263\232\002\356"
+	.ascii	"\362\242\235d"
+	.text
+	.section	.gnu.lto_spektrumBind.147.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`0"
+	.string	"\225\b"
+	.string	"6\220=:0%'\035\315F(\037\334\250(\027\305\221\346\334E\205\360\263\030T\343\nd\350\023d\334\210&\327XRE4Q\217E\264\340B\245S\311y\364<\207N\322\322\223A\244\355\235R)"
+	.string	"-"
+	.string	"-"
+	.string	"\277\374\3315\257\251MX\231\214\264\330\354\356\224(\377\036?\377\253\013\204'\3601"
+	.string	"bw\035\303S\311-o{\301\366\204mU\022e\313\202\031\232\323o\\vI\002"
+	.string	"X\326\005\223\322\261\375h_u\225\357+\0377\330E\255^v\253\203g\366\313\365\b\330\257\354\007X\234\225(g-\031\026\210\f1\026_\317R\"H\355\232\036nd\246\007\206_v\207G|\350\206V\fKD\202v\005\243<\261\317\331\335u\306\340\266\bQ\211z\032\332\2104\020\3322\270N\202\203f\006y*.(,\246\247\205\350\307\233\334\366\021M\020%M\217\202\273\221F\247\327utv\352>\t"
+	.string	"{\311'c\032\370\f\007\316B\201y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_options.4.165.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`k\003\025\022"
+	.string	"\244\034\231\003"
+	.string	""
+	.string	"\306"
+	.string	"\005\001\006\324"
+	.string	"\001\177?\202\210\200 }{\274\001y,w\273\001u,\005\001\006\025\001\017\005\001\006\325"
+	.string	"\001\220\002\005\001'\002\206\bs\005\001\212\001\206\200\200\374\230\330\320\370\022\001q\300\301\277\001\016\2155\234\254\3647q\305\306\001y-\304\r\214;\206\bo\3607m\312\313\311\f\213F\206\bk\3547i\317\320\316\013\212R\3507m\324\325\323\n\211]\3447i\331\332\330\t\210i\234\254\3407q\336\337\335\325"
+	.string	"\001\207o\206\bg\234\254\2747e\342\343\341\025\001\007\206}\206\bc\2707a\347\350\346\006\205\206\001\206\b_\2647]\354\355\353\005\204\216\001\206\b[\2607Y\361\362\360\004\203\233\001\2547e\366\367\365\003\202\251\001\206\bW\2507U\373\374\372\002\201\263\2447U\200\002\201\002\377\325"
+	.string	"\001\200\275\2407U\204\205\203\002\300\002S3\206\0024\202\002\376\001\375\001\371\001\370\001\364\001\363\001\357\001\356\001\352\001\351\001\345\001\344\0015\340\001\334\001\333\001\327\001\326\001\322\001\321\001\315\001\314\001\310\001\307\001\303\001\302\001\276\001\275\001"
+	.string	"\005help"
+	.string	"\013/root/repo"
+	.string	" ./src/main/target/SITL.c"
+	.string	"\005seed"
+	.string	"\nacc-noise"
+	.string	"\013gyro\nmotor-tau"
+	.string	"\013max-thrust"
+	.string	"\005mass"
+	.string	"\rphysics-rate"
+	.string	"\b"
+	.string	"\007eeprom"
+	.string	"\fsim-in-port"
+	.string	"\rout\taddr"
+	.string	"\ttcpinstance"
+	.ascii	"_\250\021`\022a\304\244\274R\351p\223Di\003\020@\222.Lvw\"6\242"
+	.ascii	"x\210\246\214\375\023S\3525\225t\375m\365s\260\266\364\016\331"
+	.ascii	"\343\331~\026s!\233\f$\304v\314\255\207-i\3246)\212=\016\254"
+	.ascii	"\225\270\237_\031\241.\001\226\nf\002\241\203\265\330\006*\274"
+	.ascii	"\261,\233\363\336\027\367\230\357]i'\344=\263\343\372\006\372"
+	.ascii	"\321\276dP\374#\332\024\373SS"
+	.text
+	.section	.gnu.lto_pwmCompleteMotorUpdate.part.0.223.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`s\001=\016"
+	.string	"6\032]F"
+	.string	"\221(\035\3305\032\211(X\032\256X\245\f@\260\232\002\211\035\326~\330D\256\326\211\332g\006T\356\031?\202w\031\032\001\306-\322\215\251Q5\001\311v'|\037\342\360\336\252"
+	.string	"@\210\216\310X$\210l\262wJ\001D"
+	.string	"K"
+	.string	"I"
+	.string	"\033eZ\340Ikw\013|\232f\237\016?"
+	.string	"\373\314."
+	.ascii	"\373<h\333\013\361g\313xX\262\035\320\004\303jfw\351\247\004"
+	.ascii	"\361\3572^\237\257\272\324\210px\f\360\213C\264\273\316:\334"
+	.ascii	"\363\266\017\330V`\177FG\361[N\034\305w\026\307|7\3543\314\200"
+	.ascii	",\243\354\323s\335G\361\374\225\257\274\t=\025\203B\336S<bgU"
+	.ascii	"4^v"
+	.string	"C\031mP\350{\212\007\266\024D\200&\255\335\320\300\247\023d\237\017\275\3714\211\227\370n\3020\234\215\021\\\266\373\241\342/\325\017\361i\t\\<\310\247\317a\251\t\361 \376\352/\2511\002\306\005\251\212\222\304\362\372\265\273k9b\313\350\001\301\213]\r7l\354\207\271\342\344+\277\313\257ri\337w9\313O\321\342\331c!\\\221\220\250w\035\251:\332jW5\315\tB\311D\352R5\263\351\303\240\301\002\022\355N\016\266RG;P%\215\2326\216~<\256\021N\033\355j\335\350\306v\274\034\261\350CV\260\224\222\3046\200\310\271]`g=F# \303\342-P\0174\215u\230# \220\002\241\262;\277\363C\207\264u\013E\203\225I\003O\223ec\361\330\356]\013&\317#\356\206R2\322\335dkP\210\336^\234I\177\254\223\246\342%\t\007\206Bb^ Yw\275\214d\245(\0034\246,5"
+	.ascii	"h\357\334\250E\277\353\215\001"
+	.text
+	.section	.gnu.lto_FLASH_Unlock.part.0.224.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`\033\007\375'"
+	.string	"\332E<\017Dp\252M\007/\032\233\201E\204\210\252\002\005\021K\302\003*$9z\005\256\256\245st,\374f\233\022(\023\257-\274\205\006p.1\330\354\336QJ@\026\226\265\306\337\233{(\356\357#\021\332dK\231RJ\001\336"
+	.string	"\311"
+	.string	"\353"
+	.ascii	"\367v%\007\335!\226\f\223\336\322\215lgn\356+m\344\326\322h\274"
+	.ascii	"\333r"
+	.string	"v\206\265\244u\303CZ\326\004\202\331\026i\243\263`9\201\343\005\363:6\026\264\263`\325\033v\274`:-65V\334\356=6h\313>\263-\037\033\251lk\266Q\331is\2476\230w\273\266]\205\231mx1\312\254\247\217e\227@J\034\236\271\335{}m\377H\243\255\313\231\270\322\326\367\035\312\255\373\n\266.)WO6j\303^\363\022\253\b\214\by\353'^?\334|<nV\250\340\326\274\302:\035z\211[\3520\206\347h\345\315\342\226\322N*\002&\326\225\367\305U\317{o\243m\371\327\037\223\302\373\022\326\f\203\332p\351\264=\307\227\226\273\200\336\341\226\356\275\334Y@\232\207\232\231\217\314m\231K\020\001\314$\232\274\211\365\317\255\0172\232\177\\\360\317\220b\032\206\344\336|\246\344\3466\245?\363\211\024\336Dn\264n\035he\332\336\332\204\037\344\357O\322\231\203\366O\306\314W\245\377\007\375"
+	.string	"B\262my \366\347\016\323b\256V89\375!\366)\3626\366\227'\363^a\023\241L\341\204\036\363\317\2057\321\377\344\372 ss\351.4\270\315X\n\2067\261-7\214\262m\177\247\255\024\364\323VL\303\262<\351O\306\277\353O&\223I~#\314\325\031)\347|d:\033\341\234\005\224\316\001\252s\321;\023Ug\336;\003x\347\241\352\274{g\335;\347\032\331lVg\\u.{K\263\265\316\265:\177u\366w\356\0055\375BT\fE\276U\344YD\377c\376\270\025S3\334\223\215i\336\003\221wx~\235P\241\246\322k\013\200\367'\227 "
+	.ascii	"\017,\276\201\320\3116\266\033\323\021 !(\221N\013\364\246&\374"
+	.string	"\340\320\267\261\375\240cGed\246\260\273\204|\206\352\223\242\233\002@\246\224\007\272\226\004I\273_\204\035\270n\017\212\244\333\212fIL\341\213\0363\252\004e\"\f\323y\256P'N\273\317\261\351\276B1\215U\340-\247\355\347\276\323\332\016\032e@\031*\305\024Z\350\241T\320*C:\271\257PD\363\335\311>}\306\352\223\261\371\366\037\313\037(\310;I\216{>\336f6e7V\331i\035\207\351@\331\275YpZ\r\275\302m\326\226501\225\033:x\023\315?\207mp\217\242x\306\200\227\317\034b\304\232\362#\024\315\274\205\325\267\357g\303B\004\374?\254\253R:+\374\254\244\200WI\254S\300\r\256\236uVO? \024\003\326QY\235Q\277)\251\247\026\tX\347;\243\246\224N\f\347\257\206T\325\351\240W\245\324;\243~QOTS\247\023\f(\252)\031&Xxh\322 \202\303\212\007\334"
+	.string	"\370\277\032RMSVF3\324\003\021%>4\371\254~.\200OV>\031RO1|P\300*\337\203\223\251f\374\200>+**\240\317\273\336\245\254\327\342\357z\035\370\021\017T\213\313\024\366\234^[$\377B\372\\\330\0057\302\201\346\360&\036\375\271\345;T\360\231f3e[\243\347!\351x\021\243\340\314h\027\372U6Q\3007\230\341\232\262\2676\255\241:\306\334Z\007x \222M\202\363\276\327\332\3509\230L'\366@}x\023\003<\026\230\332\360\203b:L&\203\210\276\215>D\177"
+	.ascii	"1\205\235\366\332\006\200\216\250\201 \346\230C\210hDDA\222$"
+	.ascii	"i\f\220\002\2211#z\021p\261\203HFhZi3\320&E\252W\3372[\215\026"
+	.ascii	"G!\266\032b\252\347q\245J\032\202yT\365\207\376J\005\325T\351"
+	.ascii	"\304xi%2\3303\373q\316\023i\225\276\021\221\323\205,N\035\204"
+	.ascii	"\360\225\001\257\277?C\354\211jb\214\201\214\226>\377\266\301"
+	.ascii	"YO\363+0.\357\341\332\234\222\315\257\257\r\030\326Mj\201p6\234"
+	.ascii	"\306\211\021q\300\031\235\b\251\0011\330\322\341\226\243\365"
+	.ascii	"\236\311M8\221\"V\334\262i\016w\271\354/\206\343\3174\331\037"
+	.ascii	"\267\2115_\343\002N\317EI\002\022L\215\374\300pgS\030\315\003"
+	.ascii	"\300\263D\017\317X\254Q\377 `\346`\375\"\3045\217r`\232\217\003"
+	.ascii	"\220m\277\252M\235\032\377\216\351F3\213\221\3022\316\241\302"
+	.ascii	"\362\214\032\032\3478\255'5h\245\020;\370+\223\323xz\001\323"
+	.ascii	"\267\203{\b\320\ns\237\215:\222%Em\313\232\267\227=\220\r\244"
+	.ascii	"804\022\351\022\333\342\272\034]z\264Lb\230N\223\274\267\203"
+	.ascii	"\206>C^\032"
+	.text
+	.section	.gnu.lto_FLASH_Lock.part.0.225.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`\204"
+	.string	"\335\t"
+	.string	"f\222C9@\257\032\003\230E\026\r\301\304\031\203\301\270\022r\345:\317\213`\301\203j\264\252\364a\272\233\276n\266\3616O#t\362\246\fTn\007\341\345&M.\327Jk\223[\312\224\0020"
+	.string	"3"
+	.string	"1"
+	.string	"\007\261\235\312\260\312N\271\215v\013\306\022\027\t\313\275\267\236N\217\253>%\247\362W\237\031\230\306\345\3009"
+	.string	"\316\275\327\230\215\233\336\366\306\366\307\266J5W\240\344_\247>\352r\372\371\361\006\260\025Zl\344`\311\233\2343O\356\334\2352[J\237\343F\024\201\330\275\030\267\226\333AM>\354\217)\273\353N\0036\254\235m\371)3\2075/\346\234\331\016\220\237\007'\270l\376\220\217\330\237\304j\367\266\376\242\300\264j\302\251m:\311\277\354\271\346\312\276\310m\026~\316D\200\242\317N\220N\236hI\236)\344\215lX\002A\357A\364\331\016\004\203G\241\263\340\200\340O\323\3714x\252\bJ\204 \261\222B\240Q\375BS\325x\266%0\254\242\r\021"
+	.string	"\177\311\017\347\f\374*6\006r"
+	.ascii	"y`\204+\006\f\023\003g\304\242\316\351\264\320f\312N\003\300"
+	.ascii	"\265\007\334h\021\375\2562\006"
+	.text
+	.section	.gnu.lto_FLASH_ErasePage.part.0.226.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`X\001\245\016"
+	.string	"\366\233aD"
+	.string	"\261&\035{2WX\020\311\310\374<\306\263(\276\031S\314.\373pc\353-\220n[\365\212uC\267E\204+\2016`\272\361\030L\331\376sQ\225v\304S4`8\300\356?\001\303G]$\223\275\245L)M"
+	.string	"N"
+	.string	"J"
+	.string	"\353%xt\206=\332{\307\365\210\335\300\365h\316\276\361\330E\001\201\271I\231\251\261\273\231~8w\250\0319\377\207\331\2454\\\341\001\034\0254\006\244N\260C%D\367\325\023C\312\224Y\340\021@\310\356\032\333p_\267\335\300\266\002\3735\0010\raZ/\363'L\237#Y\026p\330U\371ll\207\270B\304\fg\023{N\236*\265\262\353!0\353%H6\341\330V\013K\366\350\201\366W\234\335\261Iv\347y\031\3561'\036\336fX\361\323>\211\303\220\036sr\002\273..Z\033\237\365W\345\340\264T_\234zU\017,\233S\346\330GA\341,T\273\245w4?Qr\233\030\273\013b\3425\"\037\304\243/l\371\356\321\337\274\275_\\\217\327\257\216\301`\335|)7J\371\245\276X\343\341\356\256\325\305\216\351\030\333\006\322FF\030L"
+	.string	"\205>\020\002X\344\343\201\004\007\021\262\021(\244}FY\005\222OI&\242m\331\207\307\"\013 -\033\211DZ\326yHIMV( \241\376\273[\\Q\355\020I\276\263\007\245(N\215zL\025\352S\240f\230\362\323\267\260d\320\240F\2302\037"
+	.ascii	"{\345\357\301\002\314\205-\202\032\241\2566\327+\256Cl.\036\256"
+	.ascii	"7\324\264\360\030\f\023\223M\334\366\027\004 \017\214\270K\024"
+	.ascii	"\236!\344\274\232\325\246\025,\2411\027\304\322C!\341H\316>\334"
+	.ascii	"\271\3128\311\340:\232\232\374\256\202\007"
+	.text
+	.section	.gnu.lto_FLASH_ProgramWord.part.0.227.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`[\001\315\016"
+	.string	"F\234dF"
+	.string	"\223\223\016u0\306\n\264\204*\232\364)\336\235/ZZ\372\262\016\203A\270\006UW\254\301gxdQl\231\320\255\364Q\205\202\321\037\377\353\376q\210M\331\221"
+	.string	"\t\307\366G\013\327?1a6$\231\354-wJ\001L"
+	.string	"P"
+	.string	"L"
+	.string	"\366e\274\306t\033\227\013\330e\361\320\331\r\025|\232\323>\035\336@\366\251\235@\366i\320\376\021\262{\002\325\300R5^\273\313\351\213\203\327(A\377t\275\353&.^;T+\023\217\003.\001\224\354\256\265\023\367\274m\220\355\n\366[\001\361\255\377\236\310Bdg\227Dlg[L\0351l?\307-\336D\2044\253\230\3350\201\355\026\317\352\310\254\340>\355\273@\373c\233\354\217\306\343\200\277)\311pW:\3434L\277)\331\263+\023\204\201\366\271\311\307\267\300\333\270\204\204[\"\306\217\001\250\253F\032\252\001\202O\333\353\020\257\362s`(z\240\364\344\251W\001\221\252:U}\244R\300\304\230\375\033!J>\f\237%\373T\375\b\025\327\250w]\344\205#\005{\211\261\2503Vy\271\273ke\331Y\364<\316/\263h\235\321\001\016"
+	.string	"\002\264`ds\260\255\214\\\b}\036\205Q\367\251x\237\004\f\020P\036\234\230X8 b\331\320}\230_(\324I\247\220\234L\210\200\302\221D*_G\3428d\350F\\\312\347\201#\331\354\255\210>\216\344y\037\367\261\035/WY.yQ\030\253\352\214\355O\2346\236CC\001\232\335\034"
+	.ascii	"ze\211^\326\360\266-\206\247a\260\017(\032A*\236\231\241\002"
+	.ascii	"\362\300\210r\t\020\214\212Dn\206\261A7\2450\215\344\024\f\206"
+	.ascii	"\205\360\213@\n\227\031ar\316;\334iE\\\313F9GS\350\273\n\036"
+	.text
+	.section	.gnu.lto_.symbol_nodes.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`x\022\3755"
+	.string	"\312U@\022F\200\232\316p\377\346\317\334E\037\351\324\f\301w@\327\352\355l\360{\333\200U\034\271\310}\306\314\316|\327\206&G\221\256\313a\371s\247\"\201b\272\003'\261'\022~\311a#\261\336\0277\274\354"
+	.ascii	"\227\330]\356$\003\022\001\003\001\025\001\233&\253w\256\244"
+	.ascii	"\200f\264\372\222^4\245\222^\2712Io\034\222w\0359\024\023\253"
+	.ascii	"\027\256\274:\227\221?)\322\373F\244\327\255\034\261_\346\001"
+	.ascii	"\247'Y%z\303\224\"6l\310z\t9\224\325o\004\371\223Y\325\013\246"
+	.ascii	"\004\322\333\266b\251\230?z\331|\364\256\225\346\221\233\372"
+	.ascii	"\264\367L\217^3T\275eJ\036\275d\312\251^d\231b\253|G\357\261"
+	.ascii	"\374\260]@\334\207\216\275\"\265e9\226\013\216\325\022\265d&"
+	.ascii	"\324yH`\323\241\365\033\275k\371\324\373\305\303Z)\205'\023\033"
+	.ascii	"\275^j\364\323\234\372h%\215\376\230r\306Us\2118\\\251\351I\303"
+	.ascii	"-r2\231L\236\251/\246\324\260S\314\f\013\206\340\024\n\321\245"
+	.ascii	"\376Y\251\242\027\355\302\252]Z\026\252\352\336\206z\307\224"
+	.ascii	"\0256\2139a\305\256\324{V\206X,I;f\362\356\321\3632vK\214\336"
+	.ascii	"\264\022\3519\020\374\3508\314\335\2759\205\302sk\267w\305\206"
+	.ascii	"\007p\236\347y\030\275\306rwwZ\004},E\375!h\237\310\213~\021"
+	.ascii	"a\337\bQ\037"
+	.string	"\253<\373G\222}$w\375$m\372J\354\372Wl\372R\352\372Q\350\372K\326\364\243\324\364m\244\3517\231\353;A\323\237\222\353\007\211\353[\301\365\251\336\372\251[\037H[\277\007[\277j\255\357t\246?\305L_\254L\237H\246\177\005\331\267r\354\207\251\365\301\326\376WZ\277\nZ\337kL\237\212\230~\215\263>\2230\375,\263\276\026\230\376\226\261\377\343K_\210\227\276T\227\276\216\237\347\271\373S\354\357x\231\002.\217\261\3452L-}\032d\375\031Y\372M\345X\177\210\245\317T\222X3\023+\346b\006\314+\275jV\372Ka}$\260mc~\365\217\366\210\004j\354U\3720\274\372FT\326\316\234\322/R\373\250\224\376\013b_\030\245O\324\265l\340\214\256\016\245\177\226\\Kg>\331:'{gn\2269\244\034o\322\233d\322\273\346[\275j\264:A\020\376\342\001\007\035pp\217\r\030,"
+	.string	"\002\002B\002\325\005\371(Q\220\205.\fr0\310.\326\353ti\243[: \273H]\240g3TX\244?\033\225\335\262\001r\2125\205\372\317}-\022\310'P; \017\255C\304\377T9c \377\254u@\376!2\220}\332"
+	.string	"\031\370\353\341\331\321I\357\200\214\263\366nT\004nFv\233\004r\360\004\3768\270\246"
+	.string	"?=\366\274\252\356ml\345x\324\020`\241\363\3236\037\177u\363\361\215\372\346c\036zN\252\255^\013\347c\336z\364%\343\342z\340\244G\037\343\250r>\316A\377\303\241\265l>\036\220\376C\006\254\377E%-\032\037\353\244s>\326Y\323\370x'}"
+	.string	"$\327\306\3718\270&"
+	.string	"\031\340L"
+	.string	">\261\307\035\316^\305\242&^\217\203k\246\307=\365'\303c\024\177\031\036\343\2548\351\332KW^\272\336\2447\350W\365)\n$\263P\360"
+	.ascii	"\316#\263O\232\266\374C\327\345\034\365%\017\260$YVm\331({\306"
+	.ascii	"\3010\274\244v\227\266\3075[\270(\"\251\2365\343\241\227<\013"
+	.string	"\206yT_\265\253a\021\002kd\036\272\3075\362M\372\031+\2325~m\312X\334\266\255\321\310?\351\371\316\215\356\355H[\344\037\364\013\246|\326/\230\362I\201\350\237\344\"2=\306\026\371\027v\305\3512\266\310=<*\017\272\223>I\325A\177!;\230(]i\213U]~,\345<EU\375H\315I\377{R\202\203\205e\366%\365\206\230^\030\330\2233\251\275\024\271~}\250\326m\221y)r\0356m\221o\250\266l\335\"\013mq\213|\264\037jK\035\372\266L\313\211\324p\325l\331\321\226\361\216\360\005\232\220]\tX2\326Q\037\301\350h\265k\226\214\2030\226\214\207V\312vaX)\234\200\310\247\352\332(\234v\206\b\266s\333\305W\215\266\013\003\007\013\0330p\202\007\026*\274h\002w\370OLJ.h\002\003\327\243A\374\243\202\020\304=\341\277\306\225\305\265A\213\034\343\232\332\265 \356"
+	.ascii	"!\201@\250a$\b\271$\"#I\222d9\341\005\304)\246\216\334\021\200"
+	.string	"\034\346\244aFDDD\242!\351\001Wvl\234h\212\",\224\036c\241\374R\353\002\026\210\007\005\"\245{\004\215\350m_W\270\230{|\305\030\3417\214\353\235\200]\273\007Ub\2376C<\233\025P\323@\2073\356\342\2207'd\334\366\\\236!\035\364\264n'\222\303\377\313\332@}\034\t\005\3675J@\030r<\206 \266\005\236\356\233\242\221\230\270\366\251fU\274@u\353\344.\30661@\266t\224S\356o\301<\235\232\200\202\n.\274Z3\376\013 \357\320\227yw\013\364qziK\224H\324\2429;AX\214\212\204\f\314\323\241\033\3702\335xX\022HP\260J02=\213\332\272ug\332\2657LT&$$$L\333\346\333@\313\215`k\366\353=\320\037j\212x\315]\f\300[H\215\323\345\311\347\300t\302RX\036\251\005jy\273\365\332\360}=m\303M\004t\034\245\371\033\350\033"
+	.ascii	"[$\266\"\007\354\222\340\350\231\340+JY\234\302\030\007Ca\243"
+	.ascii	"by\262k<\013\305S\245\344y6\315\263i\236M\363l\232g\323<\233"
+	.ascii	"\346\3314\317\246y6\315\263i\236M\363l\232\227\005\230\251\340"
+	.ascii	"[\333\250:\317\2111\267(\317\222\316w\r6>\007Zc9Y\330\2504\332"
+	.ascii	"\255\350!~\3242m\322\302N\271\365{\375\037\037\342\013\316\313"
+	.ascii	"a\227\377\272\324\031\272R\232V$:\246\216\3059]'k\016\202\212"
+	.ascii	"G\320qK\330\016\316G\274e]\364FX\334\364\304\324F<a\004\325\243"
+	.ascii	"\317\340D\337\363\226c\303\3418\002\331T+Z+\300U\204\016\016"
+	.ascii	"V\213\323\021`\371wMc\262\332\3248\271\032iG\353\222\242\372"
+	.ascii	"c\223\321i\322\006Z\r\325my@\261f%w\274\353{\022xG\037tnH\377"
+	.ascii	"\223\210\353+\313V+\347\341\323\013\346\234\245\213\254n\210"
+	.ascii	"\225\203\270\226(\"PIXG\305.\233\365\272&\365*\325\217C\274\037"
+	.ascii	"\336\274\230\226\312'\013V\001"
+	.text
+	.section	.gnu.lto_.refs.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`\200\002=\022"
+	.string	"6p\200>"
+	.string	"\2176\351\336\306\347\361\327\317\225\023\316\004\372\377\377\377\377\377\377_w\351\377\277`\371}\217\332\277\377\2738\315\377\303\346q\220)\237a\340\367\343\n\3779rw[kjfo\237\254\331-Se"
+	.string	"o"
+	.string	"w"
+	.string	"\315\244Fo\227\227^o"
+	.ascii	"\335\343\375\246\313?\3577\266\317p\035\263\375\245\313\275\355"
+	.ascii	"7\357\263\355\261.\277\270\267p\037\271\227\270\336\355\214\355"
+	.ascii	"jy\263\304\310\343\225\347\225V\316U9V\275U}U}\254~\252^\262"
+	.ascii	"\344R\225\227\272b\371\022\337\213\317\305\317\210\237\305\307"
+	.ascii	"\342[\324O\323R5(_\312o_z\211C\222\307\236\376\013\027-X\254"
+	.ascii	"P\241b\353\247\350\310"
+	.string	"O\331~\024`\337\004\370\227\330\364Gl~\021\232~\b\315\017\202\343?\211\277\t\365w\350\344\nb'\371~\024\273\350\3730\366\320\367 \261\037\370\276@\354\003\276\377\210\335\363}\207\352\340\367\032N\377\266\276\361}\006\354\227\357\275M\337\276\327\246\236}\217i\272\345\373\nG\237\276o\314\rP\200<\035\247\365\fCC\371J\353\323(W\300(\3648\212\311\023r\t'\215\320\273\207\204\360\241\017\272\345\223.\355\241\347&u \235\"7\350\030\203~-`\360\271`\005\324X\202~\225\364\212\310O\t>K&\241Fr\351\312\245\021\002\351\021Q>\n\273(\354a\250\207B:\210H\357\204\177\t\037#\344/-\277\262\334\nuKH\237B\203\262-\220\374\372|\365\371@~\364/u\033\362v\251\241_\333[\\\257\270\257ty\3442\304KN\311I\020\344$#\247\364\321\350E\241\225\207\243\310A\324\1778o"
+	.string	"\374\002\243\234"
+	.string	"\370\002\246\377\330\274G\226{\246\357\330<\207z0\346`\225k8\217\301r\214G\256e\362K\224[]^}\242G\216\2374/m\337Ob"
+	.string	"\247\274/\344\322$j\241wD9\310\371\317\32250Z\017\033"
+	.ascii	"\247d\254\230\373(\206.\213\031\250\b\303\300\036\260\307\262"
+	.ascii	"V\b\366{v\211\271\004,VY$\232\353\231\343\\\205\3578)\025\260"
+	.ascii	"eRJxU\301\264\n\001q_\005\003!b\255 \261\f\004\031\"PR"
+	.text
+	.section	.gnu.lto_.decls.518b89b757251988,"e",@progbits
+	.string	"(\265/\375`~\250\365\277\002\036\206D\337\017U\0208%\3514\006v\235*\004EU@\004U"
+	.string	"\005U\024\004\004U0D#\031\021\212\240\250(*\210*\252\242\210XG\216\240\302(x\202W6?\253\205\213\t]\273\027\305{D\315\311\332@\034[\355\312\372?!K\377\217*"
+	.string	"\334\0305\262\267\334r\313-e\n\366\r\220\017\177\020\027J \022\331\234\334\215\332"
+	.ascii	"\206OgL\016\3473\312)\345~qpN\371-\303tGw\232m\023K\025\317\021"
+	.ascii	"\316_]l\027\264\355\345@\337\300\300\313\201\376\3178(+_\r\035"
+	.ascii	"t?0\322\371u\302]\243\026z:p>\237d-y)\260\340\3745h\037\001A"
+	.ascii	"~v\206\031i\3603\245*\357t;\305N$Z)$\271\202\245\346\327v\262"
+	.ascii	"\235L\316&\247\223\363\355~\235n\377\231\344Ts;\327\316%?B\256"
+	.ascii	"N\260&\016,5?@\267\023\310\317.\334X\353\023v\200\265#,5?@\267"
+	.ascii	"3\f3]\270\245V\347\n\001\326`\334'XX`y\311\277_\307;\225\274"
+	.ascii	"J\r\267\026?p\376\352\263\277\356l\334\2742\032\304\215\321g"
+	.ascii	"\332\007\274f\345J\016\347\253z\373\377iv\236\335\257\023\355"
+	.ascii	"B\3161\025>.\320\316\"\347\021\017x\230\355\216\024\210$8\260"
+	.ascii	"\324\374\332\266\371\241\204\022\326-lmi:\377\347\221\263\354"
+	.ascii	"\f,i\r\347\223l\bG\222#\234\257\016\331\247\221_\0258|\332p\276"
+	.ascii	"\nd\377\347\330I\204l\211\213\020\316\347\0208\030T\206\020\030"
+	.ascii	"~8_\355\332Ww\354\2536\366U\251}\265\305\276\312\334W\333\375"
+	.ascii	"\261+\2433h\257\214>}\314\374\374\361\030\001\034YK\3039={p\220"
+	.ascii	"n\245AQy\341$D<\274p>\002\264N\035\036\3600/\300U\265uv\335\257"
+	.ascii	"\223\353\334\361\013x\362(\343:o\2348\220\2022\232P-\371]#+L"
+	.ascii	"Mt\276\355\225\321\337=\316\034*\254\204\2308\177k\355\357\032"
+	.ascii	"g\326\205?\202\370\332p\376f\332\337G\373?\261\334\226\354\b"
+	.ascii	"\323\261\361\266\254\265\326\003\343\212)\355\241dj\254\006\356"
+	.ascii	"\0336\r\221\272\243q\367v\221*pBVU<:;.p\376\317\031Jp\\r\340"
+	.ascii	"|R\255GqyJp\376\036\332H\360Z\013?F\252\212)\037yC\276\366\322"
+	.ascii	"\323\241\355\231\032\313:u\276\366\242\266\255\024\225,+Ky|A"
+	.ascii	"\227\n\306\213\342\"\357\357O\311\022\314\026\245G\036\032\240"
+	.ascii	"\226K\344l\302U\276v\341\306(\020\205)\357d\2361\316\242S\351"
+	.ascii	"L:e\234O\347\321\271\342\024:\221N\2463\352t:\245\316\026\247"
+	.ascii	"\212\023\3069t.\235)N\026'\324\351\342|q\022\235A\247\3219u\277"
+	.ascii	"\316&|\366s\347\344"
+	.string	"A\343\262\005\001\267\f\323\235M\330\216\204\263\211\266\203\202\274\270Y\374p\037\023\0239r\274/\274<\025ym\333\304[\270P\231\3414\236\037Up8JO\020\253,\272\272\017g3+%\022\345)\257m[\254\244\r?i\341\307H\005\232\352\312;\333*\230\310\030.\013\002\226\207w\005\357\265\360c\244\n\005\031\362\321\305/\253m\233F\262\340\276\026~\214\324\237\251\024X\212\210\025\316&<\005\317\235\315\254t\b\017T^\333\266\200\201\270/\206\225\254\263\tk\301}\036\3600/\240\005x\255\3748\306\331t\366\234@\027n\251m\217@\350\252\352\302\244\004)W[\2224 \377\347\317O\240\037\213a!\267\356\004/l2\226\250\300\371\364\231\371\371\363\230 Y\033\340\r\234c\310\366\220\311\215\321O\305\366\323\255\375\224\306~\352\264\237\022\355\353\300}}e_K\331\327L\366\265\221}\355\265\177\277p\337\255\243"
+	.ascii	"\217&*8_\333\330\323\333;G\324\236\350a,A0\236\245#\234\257\245"
+	.ascii	"\3665\323\276F\332\327A\373z\347\3560oTT|p>\272e\037\255\262"
+	.ascii	"\217\306\355\243Iv\007\271\343\271_\304\n\267\356\004\355\006"
+	.ascii	"(zx\002q\236\2319\226{\314\005\373\013[\202\363\321\"\373\303"
+	.ascii	"\225\321?\216\202\343.\222\034L\254\276^\345\302\016\206b-Z\004"
+	.ascii	"\301\371\350\327>\312\265\261\033~\273_w\303N\256\313\310\274"
+	.ascii	"zp>\212\265_\320\336M\037\245\332?fk\002\323\367dJ\263\tf\222"
+	.ascii	"J\311;\022\204\363Q"
+	.string	"\027\373\350\321\276Fkjg\020Q\21395\234\344\345\354iM\t\316Gy\366\263\337\376q\032F\013\226=\311\005a4|\006s\005\307\306\205\363\263\225\375\fe?\253m\\\004\033\271_o\303do\302\274 \001*\322\206\363\363\221\375\3736\375\202\3736\375<d\337\334\3347\352\312\350\f\202` \353_\232\021\2723\020\351\306\2160t+\006\037\017\316N`\370\205\225\037\347\300>\360\026\336\201\233X\013s\341\036\230\007\376\302]X\007\366\302?\356\027\006\3037\216\2630\016\252\031w\355I\036\006\303W\030\313\004mJl~I[\224\330\270\260\024\006\303Swm\247\016\257\306\323\330\334\252\254\234dE\301huZ\270Sb\363\023\261\002\006\303-0\323\213N\263-\022\241E\211\315\257m\2331d\320e\261h\362#B\243\211\337\224\330\2700\022\030^\361\247\304\306\205\237\3000\3245\333\301\313*\001\345\003\002\343\205"
+	.string	"\262L{e4\316:\266\215v\350c\013\035\022\316\317R\373\271i?\267\330\317D\373\271g\337\366o\337\250\276}\233T\366E\223\3337/nc#%\033G\215m\314\204\361\022vq\314\204\225.b\205\013{Z\037m\333\304L\271mw\356\r\341\345\336\020\3205\033;At\376\td\377\304\261q\326\215\321?c\354\237L\0337\361\021\210\241\0269\036.\234\177l\244\177\354n\004\301y&\360\353\362\231\031\351;r\266\305H\026\332\3452\206\333\037Yg\177E\374\236\366\242\343\241m\331\312\260\017V\201\2110\023\367\340!\234\002\013\341\037\\\204\203\356\027\006\302:\307;\230\007\020\003\335.\327\314\003\036f\346\002\313\303@7\357\356]\270\261\027|\234\345\265m3\013\006\272Z\236v\341\226\232\" Sb\343j\333v\313\325p\322\361!\353\346\225\321\247\213\262\217\235\354c\265}\\\266;"
+	.ascii	"\331\3079\3661\214}\334b\037\007\3557o\214>n\367o\226}\257\\"
+	.ascii	",\367\013\304\325\373\255r\255\\\355i\266bm\333\204Q\345\364"
+	.ascii	"^\214\341\374[e\377\202\3200\201\201\201\201\027\204\376\255"
+	.ascii	"\333 \\\031\235\341\356\250\\\272\254\027nT\354z$Q]5}\264m\013"
+	.ascii	"\243\246\375\355`\201\363\235\273t\277uW\356\"V\370\251\003\244"
+	.ascii	"\365\321\266\355\255S!\252mwn\035\f\227\266\335\201\2717\204"
+	.ascii	"{C\310^S7\214\350\374+e\212\224\263\346\016%\234o\224fO\333\266"
+	.ascii	"\037\204B:\252\234p\376m\262\211\264\325\3757\356\272]\270\353"
+	.ascii	"\344\276\335'\367\253\311e\373\207f\333\366\234](\027\311]{2"
+	.ascii	"\003\3452y\232\320\f7\004\374\027M\211\223\231%\327\354\302-"
+	.ascii	"uh\333\031oYm\333\376\372\370\257\221\013\345\222]\263\026~\214"
+	.ascii	"\332v*\310\002v\270\bu\371\265m[\302\207\022J(\241\204\0224\221"
+	.ascii	"\016!C/\371\027j\357\346\225\321\227yc\364/\213}\026\354\237"
+	.ascii	"`\377W\355w\355\277h7mXW\266\363\207\363M2\363\253\326\200\032"
+	.ascii	"1\274p>o\214~\0066n\257\214\006\341\306\350\024\216\374\232\375"
+	.ascii	"w\354\026y\2320\252m{\332\266\335\340\264zQf\206\363-\233\371"
+	.ascii	"="
+	.string	"\022\243\215\226\232\355X\333\2660'\232\222\037.8\343\033\243\377\200}\264\033\243o\363\312\350\0177F?\357\306\350\377\016\021r\0021\242\004'D\f\206I[\027\027b7\210\366\262\302c\204\363U\330\377\005\022\226\346I!9\301\371\277a\377\355q}\334\346\311\034\212j\307\332\266\351\341\205(\256\225\302\371\377\375\272\315\013\326l?\250}t\200=p\276\t\373\367\3071"
+	.string	"\322\256p\274\337\2742z\337\030\315B\356\320\301\007\033\002\031\003\031\023fdU&*\325"
+	.string	"]\221\312\240Ai\006\350\013\322\230?\353\024\203\037G\2419\251\207\037\265I;\374h\211\024\0065\301\237\276\374\330(\035\336\234\032Fp\273\263\013\004\376\024P\313\360O\365R\341\237\006\377T\375\323\375\247\372O\321?\305\177z\227\277V^\007\376'\376\317\377\347\375q\340\177\242\033\374\032\206\313\1772\311f/\376\376\363)\023Q\213\266\374\030\207"
+	.ascii	"\376\374\301\257\265\374\332\357\307'\330\350u\020\363\357\004"
+	.ascii	"\3749\003\235\005\223\320a\204\377\344\242\227\372\376S\350~"
+	.ascii	"\340GA"
+	.string	"\360k\276\037]\361\337\f\350\275\037\255\321z\267\313\352\2169\273\240U\032\313\255:\341\3168\001\323?l\200\034\344\356\334\325_\275\371O?}\345R\371o\335\235\242K0\341\327y4\334\017\017\341O\255\350P\215\377\225\273s\327@\316R\213\367\203\372\201\373\241\206\377~x\376U\031\264\025\025\206{BvR\025\360g\026M\236\344\025St\225\377\037n\303\371\200{\370\325\017\266\272.\374\325av\001\340\365\216\376[\313\237Oh\274?\023U\300\367\353;M\345\327\005\370o\227\335k\030\301\026\212\377\030\374\373\312\257\353\376lB\323\325\375Z\356\3174\"\320S\376\353\177O\2711\261\344\317D\035\345\3172\234\206\0214\233H1\310\fP\377\031\244eF\220e\370\313\277\233\342\376\023\204\r\030`\221) \364\373o\236\247\377~\301\tBv\300\n\316\016,\334h\375\237A('\227\245\213\3402\3776\376z\346?3"
+	.string	"\207?\300!`\017\277f\341\311\257\033\360\237$x\001n\235\374\372\355"
+	.ascii	"\332MO@\277\360\353\266\377\254\323l?\306\302\200\316\300\257"
+	.ascii	"\233\350\023\364\b\210&t\007\230\374\271j\t~3\376\247\013\224"
+	.ascii	"\374:\005?v\241\327t\362\327j'\240\336\265J\362\237@\271\204"
+	.ascii	"{2e\316\240\373\301\3569\277\332\202\037\345\241\221\374\030"
+	.ascii	"J\332\257\313d\32014\031\035\372\366\237\372\327F~]\344\277#"
+	.ascii	"\364\330\257\211\350!\377)\247\205\240s\377\271\265\330\177\207"
+	.ascii	"7xU4O\007\311\"\362E\267h \372\352\260\333\221pst\363\327[\277"
+	.ascii	"\316\202Z\371\265\325\315\272\352\016\177=\343\n\177"
+	.string	"Mu\203\277\226q\327_\307\270\352\177O\320S\277\226:\3574\f\035\365\343\021h\250\263\016\035\036\365\223~\361\353\246\037\237\320.h8\347\322\263\037\035\376\267\003\322L\377\311E/\375\267y\360\327V\316+Z\351GM\320-\376\223\347\035~\335\365k\026\377u\200>\372\377\344P\376\213\200\333\302\235\271\t\370\177\344\377U\300\217\222\320\002\254\002m\244\213\376\363\356\327*\256\004\016\302\237N\371\365\007?\016\322(\210\256\013W\002z\250=\314\257qh\034r.\327\345q:\321Cw\362?\212\026\372s\f\177\236\341\327A\277\226\371oW\212\377$\350\237\377#\370\357\207\377\"\310$\bA\001\264\217\224#\340\337S\177\276\323=\377\237\374\232\347\317zz\347\277\333\237\267h\235\277\375\272=\243\234P\256\201\323\240_\360_\312=\370S\260\037e\341\307*t\016?\016\322(\364\211\257\377\226\341G\265~\354\246q\3209y"
+	.string	"\377\367\277)\360\353\345\257\225\377\361\237&\371Q\020\374:\371k\024\374\332\004\277&\301\2573\360\353\027~\355\200_'\340\327\"~}\302\257M\3705\t\277\006\341\327\034\374Z\203_\253\277N\177\215\177\364\357G\257\374(\335\217:\371\321\262\037\005\373\321\255\037\315\361\243V?\n\343G\233~4\351G\205~\264\375Q\034~\364\346G\215?\312\376(\361G\023\360\243!~\364"
+	.ascii	"?\n\342G=\370\321\227\037\335\177\376\373\363\336\237\361\376"
+	.ascii	",\367g$\177F\373\263\331\237\211\374\271\203?c\360g\365\317\315"
+	.ascii	"?\177\375'\340\237}\374\231\353\317<\3763\313\237u\374Y\353\317"
+	.ascii	"Y\177\256\361g\253?S\3759\306\237\237\376\354\364g\026\177^\361"
+	.ascii	"\347\243?\027\375\371\347\317.\3703\013\376\254\202?\243\370"
+	.ascii	"\363\362\317\311?#\377|\363g\023\1776\376y\304\237i\376\\\374"
+	.ascii	"3\361\317$\370s\b\376\334\201?o\340\3173\374Y\206?c\340\317\024"
+	.ascii	"\370\263\013\177\206\300\237\035\360g\026\376\254\302\237E\374"
+	.ascii	"9\205?\207\370\363\001\376\\\302\237A\3748\313\237\013\360\347"
+	.ascii	"\001\374\371\203?\313\374y\375\263\376s\376\363\375\317.\377"
+	.ascii	"\251\345?\261\374\347\335\177\326\375\347\334\177F\371O(\377"
+	.ascii	"\371\344\307/\370q\320\177"
+	.string	"\353~\254\342\277r\377\205\373\357\224\377n\375\247\211\377~\370o\316\177g\374\327\205\037\253\340\277'\374\247\341\177\224\377b\377\233\377\311\344?\227\374\347\323\177\272\370O\241\377\f\372O\346\177\002\375'\317\177\352\374\247\013\376\363\304\177\346\374\247\315\177\226\370O\232\377$\376'\t\376S\004\377\t\202\377\364\300\217\005\360\2374\374\247\006\3763\003\377y\201\377|\300\177\036\340?K\370O\020\377)\302\177\202\360\237\036\374g\207\377\f\376\347\372\237\373?\323\377\216\3701\335\217\347~\034\345\307P\376\333\360\343\267\037\263\360c\034?\306\3721\215\037\313\370q\324\1773\360\343\246\037\033\375\270\350\307B?\006\372o\363\343\235\037\267?n\301\177\035\360\343\025\374W\373\361\211\037+\177|\3741\n~\314\376\370\004?\036\301\377\272\037{\340\307\033\370\261\f?\306\300\217)\360c\027~\334\200\037'\340\3073\377\355\376k\340\307'\374\330"
+	.string	"\377\365~L\302\177\263\376\233\343\307#\374X\204\037\017\340\307\031\374\027\357\277w\377e\370\357\334\177\241\374\327\353\277]\377\265\361\337\253\377\326\370/\215\377Z\375\257\341\277U\377\225\300\177#\360\337\016\377\205\371O\345\277\224\3773\374\027\362?\354\277\351\377\266\377\t\b\f\f\f\3743\020\3735\b\372]"
+	.string	"BF\255\t\007\200\336~\332\335\222AO\333\356\210 \354\322\002\352,\255K\353.\225\024v4M8"
+	.string	"\342\246LI\347VHK\223{:\267\273\324A\365\341|\276K\345\277\n\263\365'$\267$J\224+\204\310\224\366\022\"\203\013\316\007"
+	.string	"\331\376S()\224\033\026\201% -\322\213\214$9\214\374\332\226\211\tBf\020$'\234\017"
+	.string	"\026;eK\331R\025\272p<u\362\264\312\371f\205\313\017\347\363\245o\2002\2624\323\267\324\315E\f8\252\033\245\331V\001\242E\b\316i\033"
+	.ascii	"\200v\332D\005\201\200Y\230,y\301\215\254\fg%h\226\2704\0368"
+	.ascii	"\237\003.\333*\323x\331\351\320\366\370\fe\215\245hi\216\273"
+	.ascii	"w\206\031m\"A\376fx\370e\001jq\311B@\f\246\254\264\231\226\245"
+	.ascii	"F\322\257\264H\232\226\222\245b)\220\324,]K\317R\037)Xz$\035"
+	.ascii	"\222\022I\303R$\251Z*$\035K\223\244?\322 \367+EK\275\236i\324"
+	.ascii	"\020\312\273\200UDX\314\274\250\247<\024H\306R\036\032\214\027"
+	.ascii	"hSS\\\244D\377\314\016-YY]\262.\340\215\300\254\f\367\317\350"
+	.ascii	"\310X[. U\021"
+	.string	"\002R\264\224+\355\232\252r\001g\250X\341\277\2008t\022`V\017\250,\033)\362.Z\212\226J5\315lE\261r\001S\264\364j\003S7\262\270\332\266\231\227\\\351\030S!\237\003&\373\034\034\331iW\306Js\004\252\300\202\3639 \262\317\301\216}\016\250\3669h\332\347@h\237\003\235\375\017u\373\037\306\366?\334\330\377\360b\377\203\316\376\006{\373\033\324\355o\360\266[\330`\311\376\006f\373\033\b\331\337`\307\376\006/\3667\360\331\327"
+	.ascii	"\313\276\006M\36658\262\257A\330\376S\247\247P\177\372\"}\202"
+	.ascii	"\343\301C\016\347\313\2742\332\303\215\321\027p\346\251\223Y"
+	.ascii	"^\217\242\246\324\005RY\217\02483\235\361\320\373\301\371\032"
+	.ascii	"\334\330\377S\026\251R\332\342~\245K\351\212\337\224H\005VV\333"
+	.ascii	"\266H\351\321\213N\207\266\235\262\221\225"
+	.string	".\245I\351\321\205[\302\202E\315\257m\333\017%\224P\202\220H\013\352l\347k\320\263/\203e_\306n\377\251\321\323\243?\277\245D:IK)\312\b\316i\321\314S\243\236$#X8\2537F_&n\037\355\312\350t\250G\030\267C\203FP\032tr\201h\266+^\212\240\310,\331i\n\273\023\264m\031\237V\023.8\377\251\317S\346\237\376\244@DVJIp\306hWF\227pct\316\232y\352\023\024U\204\b\316)\317\032\203MM\317,\325\331SGYv8_\306G\332\006\352.G\224\304\220\201\263\006l\212\265m\313\301\255\362\342o\r\347\313T\355%d\\\364\226\373\245\377\376\207\352\320Z^t\232\355\221Na%4\362\004\004\244\265\0261\263*\032y8g\311\242\237\334\266m\333\245V\347J\013\200isZ~2P\373\327|{FOQ\200\334\370\366\324\277'\251\"8s\220\3561\223"
+	.string	"\341\254\261\240:\264\225\013\267\224\263\266\\\321z\367Kc\321y\032KQ\327\255\nJ\262\323\3712F[[\251k\2410\313p\316u3\327U\304\260\230]\332\356K\333\351\273\023\207\016\232\t\232J\007\246\214\232\340|\231\237\375\f"
+	.ascii	"\367\257\345\364\234\246\273\341H\021&\316\227\353\312\350\r"
+	.ascii	"n\214\326Sf\256\345\252\256x\234\341\254\301\215\321Z\312\237"
+	.ascii	"s\350(\267nuA\247\002\006\316\027\312\314u\034\312\243\005\223"
+	.ascii	"\r\234=\200\323O\370h\300U\301Y?\301\323E\256\256\260p>\337\361"
+	.ascii	"\376\253\301%4\246\234\340\354\346\326\244\312\3765\033\033\332"
+	.ascii	"\256F*\031\320Y\036\024\315\344\232\211V\202\333\266m\263R\""
+	.ascii	"3\\\344\265KF \236A\222\375\353%J\204Wf;\206p\326J\356\332\226"
+	.ascii	"\033e8k$Zmg\ts\333\323j:\311mr\204\306\220@\241O\240\021\024"
+	.ascii	"\2345\232FC[TO'\203!\373\327G\256\317~M\244\315\256\035\226+"
+	.ascii	"~>8_\264+\243Q\270\231\353#g=\236\304\300\331\210&;\201\205\006"
+	.ascii	"\033\316\317\240\207\221\"z\214\210\352\007g\"\233\355j\351\t"
+	.ascii	"\347g@c\037\001aeb\032I\3578\233Y*\220\f\263<!:\210\036r\277"
+	.ascii	"\264\230\006r\375\204\216\035\323\211\351\346\221\274\266m\226"
+	.ascii	"P\302\207\022P\243\027S\234\354\374\f\230\3663`\356\307\374\355"
+	.ascii	"_\203\351\257\242V\f\006\316?`r$\361R\202\363c\354\366\257\225"
+	.ascii	"\254\036\250\030\017\215\244w\274\350th{\204\374\310\302\221"
+	.ascii	"\261^t:\264<S\274\2642\226\214\256\274\266mj\036:G\246q6\321"
+	.ascii	"6\220\020.\215\365\317h\036\372F\306RaI\030\226\232\237\356\241"
+	.ascii	"\267\264\017\355\245\2734\327\375\322<\264\216"
+	.string	"\343f\333\366|\310I\276\264\004\275\350\035I{\251g\250\005\316\217i\262\037S\266\037\323c?\306j?\306\305~\fs\203\320W\372\n\025\302\300\b\003AR\344u\331\277\246\241i\300\300@ok\253_\317\320U\267}\273J\303\031\303]\031}\200\033\243\265\214\231k*\037sY\364p6\341\306h=\265\032\231K\372\302\371\030L\321R\317@\242\206\347N\213\2673\2345\214\037\235\242\243\256]\216\223\022\025\205\363\365\323\3145\224\023%y`8\013\265\023\323\023\323\036\316M\227j\212\236\024\234\217A\222\315\244\2214\213\227\263mwzd\351%\355\342~i&\335\342b)\377\214f\322J\031+\235\001$\207\222\026\230X=t>\006V\373\030(i\026:\211J\335\024\275\"\267x\223\201\205\3631(\332\307\200\271\177\255B\027i\243k\267\353\304\246n\340|\231\\\031\335\301\215\321\232h\346Z\205P\217N\254\013g"
+	.ascii	"\350\241\343\351\204m5\301\371\327A\367K\007a\254\025 r\350x"
+	.ascii	"\360\333Ft=\376\212p\376\355\272\250\035\352\207j\321@\021H\301"
+	.ascii	"l\333\244\020\332\256$\231\360\263\303V\260\005\301PkG\204\340"
+	.ascii	"\254}~\224\nz\247{\204Q]\366\274\2644\217\326\321;\272\275_\272"
+	.ascii	"\007\r\374E\273i\177Zt\017\nh\205\313\325\262\374t\017\332\345"
+	.ascii	"RI\361\214`=\371\265ms\235\262\027V\267\346{h\356{\350\261\357"
+	.ascii	"!\307\276\007\254}\01746\3723stK\027-Bc8\337\203\324>\212\207"
+	.ascii	"V9j\345V\320,\273m[\235f[\304\301\222\245%\020\351\334\216\033"
+	.ascii	"JW\216f9\332\267\332\005\236\341\341|t\017\345\373\325\363\312"
+	.ascii	"o.\f\347{h\332(\026T\357\277*\214\252\022\344\007\316\307\036"
+	.ascii	"X\220p\253\366\224\\\341\254\256Y\177WX8\243y_\373\257\246,\244"
+	.ascii	"\200\f\301\371|g\215\377\352\313\026\021&`8\337\203\317\376\357"
+	.ascii	"\361\257\333\035\243\266m\221"
+	.string	"\320fk\304#\324\377\375E\357\005\361\017\357y\007\360?\267\355apA\333\366\234e\265m{\367v\216\263\235&\020Z\024\256m{\244t\" u\304\024\223:\362\300\354\221Rb\212I\035y`\212I\265:=X:\036\214Z)\035\246X\333zh\333\266m{zt^\210:b\212\355\264\036\230b\355Q\353\023wt\333\246\224N\333\023\325zh{\332\235V,\352\b\004f\217\324\021Sl\347\310\003SL\352\250\025\223j;\264=;F)zZ#\017\255\230\324\225V,\352\250\003S,\352\210)&U\344\226\005\315\360J2\313\262r\272:\314\236V\005\221\323\216Q\0078f3\252\245k\333;\366\323\032\265pm;\200\266u\2122\242\333Q\272h<p*x\312v\242n\263m[\016\210x\246\242\332\0368\235\333\3021uD\265\255\016\236\022-Q\333\266\255\n:M\270\326\352\302\351\304pj\207~\332\026"
+	.ascii	"m\263m\211\332V\347\266pm\333\352\264m\233\03295\333\326E\007"
+	.ascii	"f\026\021Q\333.} j\235t\322~\332\026\217\331\241\0351\305\246"
+	.ascii	"\242f\322\206\210e\265@M\235\313\034\212j\263Z:)\243-\246\023"
+	.ascii	"\326\016\265m{\365v\326\321\n,8\203\320A\311\256\263\213za\244"
+	.ascii	"#\207\366\240s\267n\250i\311\n\316\317\2732\032\2352sT\016\337"
+	.ascii	"\030kk\303y\030\345\013\215\222\315Tf\333\036\251\260#\254\003"
+	.ascii	"\330\376\321'G\343~\024\016\205r\355\202\264fT8\337\261+\243"
+	.ascii	"9\2701\372\216\315\034}\"L\202\004dI\216/4\007\372\2462\333v"
+	.ascii	"\005\b8P7\016`b\314\330\231\202\363;\334\330:\320\255\263\231"
+	.ascii	"U\001\036\025yL\3206\264\311\375B\331P6\224\0135k\341\307h\006"
+	.ascii	"\036\242<6t\311\335`\244\200CK\240\037\007%\224\220\207T5\201"
+	.ascii	"\332\3710{\373\250\230\020\016.\\U\004\264\310\310\272P"
+	.ascii	"3\264\013\r\342\001\0173\006&eD\306\262\214`\241cE@\\\270\261"
+	.ascii	"\027\320|\240fh"
+	.string	"\031\026W\036j\206\016\341@[YuA\362C\325P%\350\031\232\004MC\221\240k(\332\375B\315\320#\350\020!~\177\030\344\303\334\330\207\251\332\207\211\332\207Y\332\207)\332\207\2732\3720\314}\230v\377\245o\247pe4\020\035+qE8\377e\312\376\217\202\241\315\373\205\206\241=\274\320\037xYm\333D\303\320/\364\007\006xuz<N3*{Bt\376K\214\375\243?P\037\301.?^tA}\240=\276n\f\305\300\371/C\373/>\373\303.\373\303,\033\335z\221\024m@8\243;f\216\362\360\251\032B\302\231\204\033\243?\314\333\037F\331?\232uT\353Gg\2408n]N\330W \316\270\352\312h4\306\314\321\254\225\031\304\274\272:z\343Gm\240X\267.\365\361\313\013\304\0313\257\214\016\341\306\350\2136s\364*\314-I\017\316h\215\037\265Bi\b\217d\311\272\2013\316\2722\272"
+	.ascii	"3f\216V\3417\254\035(\234G\230:J\365\2431P\031\232E\\\237\037"
+	.ascii	"\3168\352\312h\002H\315\034\235R\201\230[\214p\026\341\351(\214"
+	.ascii	"\037\205B\243n]\320\251\n\020\ng\234wet\210\0273G\237\2069\354"
+	.ascii	"\204\304p>\001\351h\013T\t]\272_(\022\332\204u\244\216t\332\035"
+	.ascii	"\2464Mg\311\004\225\311\254\350\212\013T\t]\312XIPrO8\243L3G"
+	.ascii	"]<\346k\256\211\bg\b\004\336\030\235\333&\232\204\262\370U\364"
+	.ascii	")E\322\031\316\037\266\355\253\273F\017\030d8\357\366~M\177\210"
+	.ascii	"\266\321\243\377&\301R\262\214';(\234\177\224\b%B\213Pf\fl\\"
+	.ascii	"P\025\371%\b\350h\017\347\017\203\354\017}\354\037M\361\373\205"
+	.ascii	"\246@\20500\232a*E^kdd\002\032tvW\205\007\347\017\265\366\207"
+	.ascii	"4\366\217\372\034e\376\350\017\nt\355pUP\0236\234\357we4\314"
+	.ascii	"\215\321h\317\314Q\237\035\030\230\304\n\347\027t\347\367\013"
+	.ascii	"\335\301@.\320luV+8\346\264\374\246\366\217\352\240\255\032Z"
+	.ascii	"\037\022\316\201)s\307\n!8\177\250\264\377|\2772\340i\267\032"
+	.ascii	"\251D\202\270\310\033\006\355?k\371\375\312Z\362\237\312l[\244"
+	.ascii	"\024p\\\231\323\362k\215\214L\310[\324(~D}8_\370\266/L\262\377"
+	.ascii	"\314\367\354\367\347\276\234\345\326\r\207\b\331\221\202\363"
+	.ascii	"\255\2722Z\346\306h,6\363\314\267\273(Qau%c\311z/\232\260\200"
+	.ascii	"\3039\217]\031\375\"7F\347\274\231\347+K\224\236\024\301\371"
+	.ascii	"c7Fg+\177\306\313U\256\235\n\027et8\237cWF+`h\346\371nK\323\210"
+	.ascii	"\t\3353\225?\327e\273"
+	.string	"\260f\317\017\316'\327\225\321\t\230\233y\246\313<\270\216@\341\314B\224g\271?K\311S\256\335\260\252\351\n\347\354we\364\317\342f\236\243\240.R\004&\341|3'\317P\376\374$\303\211\030\262\232\201\363\231\\\031\035|\233yv\242\271\230\177^8\257M\236\335\376\314\226\333n\035\272e*\210\013\316\247\321\225\321\"\230\314<7I\245 I[\202\363\214\332\363\222?\257e%\327\016\006/\210G\017g\264\352\312\350\257%\231yV\223j\n\275\341|\265\033\2433\222\377\236\3454$)T\244\300\371l\257\214\316g3\317h)\210\021e\2053\nG\236\315\352N\300eNn\n\347\\6\363|d\310dF\036\316\037\214=\223\375\271H6r\353N@\243\306\n<\234\263\321\225\321\007Bd\346y,'\231B\362\303\371ab\317C\376\374\225a\250@\372\201\363Iwet\0162\363,\026\344\"\303\006\017\234\033"
+	.string	"\366\f\344\317\315\034\226\332\210\302\354\303\371\314\2732\372\001_3\317`APv\370pv\200\327\363\217?\367\310>\324\026Pn\230\341\234\271\256\214>\221\033\243s\327\314\263\227\337\016\":p\376\020\256-\234\275\037v:\236\267\376\274#\363\300x.\276h\340|\363\256\214\026\300\215\3219\307\314\263\216\227.\235\027X8\007 \337\310Y\031\307\252e\207\332\026\316x\354\312h\003\334\030}&\231y\276q\3628\223\262\205s\256\221\257\356W"
+	.string	"\262\215.]]\376p\276\220l\377\006@\337\300\033"
+	.string	"m\205k"
+	.ascii	"\026\t\202\363\205@\362\214,\224e\207\033\316\027r\355\247e\031"
+	.ascii	"'s(*LG\333\266\035\356\223\022\245*\234/\304\261\377\034#C\351"
+	.ascii	"uyj\232\272i.\372\206d\030Y\350\005\255\257\034\225\245\356W"
+	.ascii	"\206\221\2272\214\334\"C\001]\211\363\362\203Y\233\322\223\245"
+	.ascii	"\363\237\241\362S\335\221;)\234\363\013&\346\231\016\316\017"
+	.ascii	"\006\356?7\335\257\354\364*B\017N\261\226M\013\316Y)\273\370"
+	.ascii	"\257\336\276\265#'\234\377\354\"3\255[bM\262d\246\274d75\206"
+	.ascii	"\207\363\203z\373|w\357\277\252\235\024q\331\202\363\203v\373"
+	.string	"\317,F\334\265\260\201s>:\255\\\"a_Y~h\371\350\314\313\3521\223\205n\344\345\244\274\"\027e\243\254\"#\335\257|\364\347\241L\004xb\311\314\0137\026\003[\327E\313G\347\225+\257|\224\203238C\347+\353\345\314I\022\330K>\233WF\267pc\364\203B\366\203@\366\021\220u2\317\214\f\224\177\262ONq\27723\367d\346\251w\356\235\315,5h\216K\236\225\314<\371\316\2773\314h\223\001i\301t\377\3143\363\344\222\333\227\235fk\364\202\024[H\270\332\266yb\005\251\323Z\363\203<\362N\032\3246\345\n\347\007i\354\007\241\366\txv\271_$\234\201M\230\023\256I\017\027\316\017\262\330\277$\35030\360\222\240\037\034\332r\277\316\277S\213\330\337\331w\372\275\3644\333\243\264\216i\013\311\332\3446\003(\347\257ug\226!\223\267\264$8\177}\262\2772\331_\317\366^"
+	.ascii	"N\320n\2402\241\362c\017\347\257C\366\327\260\375\325\307\376"
+	.ascii	"\272\265\277b\355\377\254r\332i (\261''\336I%K\213%:\234\251"
+	.ascii	"\234u\247\335KO\263]\241\201\356\204\362\356\356\327I%7\333\266"
+	.ascii	"l\205\252 \273\234O\273\237\341\235\202\017p\013\316_\245\366"
+	.ascii	"\177\322\315\005;L`\272qC\250\365!J\247/\350D\264\345$5\222\027"
+	.ascii	"6%\304q\241V\025!8\\\250\341,\314\322\267\013\257\256\006\235"
+	.ascii	"\320\206\320\206ju\277\210xdq\345\340;\323\333\262\262\022\326"
+	.ascii	"\270@\332\242\f\270\020i\355\r\237 \235\035\ti\\X\203O\b\334"
+	.ascii	"\027\222\324/%\234\201\201\036\021\226[\013`0\331\250.\234\261"
+	.ascii	"\226\336\340i\001\005g\341\224PF:E\365\343B(C\030\003\306\214"
+	.ascii	"-M\273\207^\215.%0\205M\302&a\224\316W\026\322\2136\246\020\352"
+	.ascii	"\302\2505\"\025`+p\026>\255;Z$ \"\234\205/\216Gvt\204\263\320"
+	.ascii	"\t\2271y\023+\241]\272\220i)\230\343C\224\316\025\026\224\206"
+	.ascii	"\002\225p\265\314%\020\230\257G\320\020*B\027\022\t\t[\304\034"
+	.ascii	"\021a\271\355\024\315\266#\341\212\013[\\\310B\304\n_\273\253"
+	.ascii	"\322\007\207\363\205II\322rL\021\252\020\"\261m\311\201\263\260"
+	.ascii	"Hht\277\276&<Js\322\322\004\347\033\240l\243h\3336]\323\302\241"
+	.ascii	"/a\na\n(q^J*\262|\340|\003d\t{\204=B\240\227,C\201J\360\334]"
+	.ascii	"Q\222\237\013\201\326`\240b\366\340,\364\321wA\261)mU\206\256"
+	.ascii	"\200x"
+	.ascii	"\f\341|\003L\001\036P\270\363!\352\274\353\242\304\346\007\243"
+	.ascii	"C\313O\212P\347\302\235'$_U\204-\0135&\3026P\225\013\344q\262"
+	.ascii	"Q\305c/)\330\005\353L\3211E\n\3167\200\220\336\203|z\301?\253"
+	.ascii	"`\022\230&U7\354\374\036\374{p\213\210\025\356\246Fm\251\262"
+	.ascii	"\246%K\337\236\001z\354\036\274\263\013^\201J\337\3200&#'U\036"
+	.ascii	"\274\362`\236\210\025\236\026\f\202\201\203\212\025\274\325m"
+	.ascii	"i\212O\247\270Q\0030\b\347 \025@\270\007\343\340\202t^\3016\""
+	.ascii	"*-\277U\316\t\213j\312\203t\017\316\211X\341mD>^LrRV\2673\236"
+	.ascii	"\026,p\016F\321)p\374\260\371A\3413{\020\315,\350\344\002i\213"
+	.ascii	"fh`=q\275,\331\302\342\211\355A'\017\276\241\221M\245\300\371"
+	.ascii	"A\267sL\255\212\031\316\301\266`\223\257\335\032\201sCp\016*"
+	.ascii	"\t2A\353\206$\2111Yb\003\213\313\020\316\315%s\314&\316\301\265"
+	.ascii	"\365M)K\037\316\301\264\240\332\020,\201PA\265`\222\264+G\326"
+	.ascii	"\322\246\033\217N\020\t\032\210\344G\303\207Z\f@\346\020\234"
+	.ascii	"\203gua\017\002\t\206\005\313\262\n\260\032qI\332O\217\307\020"
+	.ascii	"!\017\226=H&b\205\257e#in4p\016\032Y\377\204w3\222\370\340\374"
+	.ascii	"`\221\225\347WW$:7\244p\016\216\251\200RdQ\222p\016\022\t\321"
+	.ascii	"\344\212\211\033\316\017\016\371\257j\200\306\0232\234\363\375"
+	.ascii	"\232\016\212\341\276\0348\200xp\016\006\301eppKs8\303u=\370\243"
+	.ascii	"+\b\206\275\232g\333f5y\242\244\221\360GD\245\345\3272\271@\244"
+	.ascii	"pAL\236|=\b\206\377\372\214\354\350\361\240\217_\025V)\273\272"
+	.ascii	"\201\363A4w\320\013D\217\340\216\340\216 \007nDR{Q<\224\250\360"
+	.ascii	"xp\213F\0161\032`9\226\250p>\b\241\032\017^\325\b\346x\nM\236"
+	.ascii	"(a\"\336\206\002\225\254k@\260Vd=\230\343A-\021+|\r\246I\230"
+	.ascii	"P\023\216\340\215\027#-Gw\301\033A\254'\031*P74H\337\225(8\333"
+	.ascii	"8\007C\271+B\250\274\005\247\202V\331G\r\313\233\323\252z\320"
+	.ascii	"\352mA\273\257+)\234\2033n\005K\r)n8\007\251\336\246\367D\215"
+	.ascii	"\211sP\206\032d\273Q\203K\260f'\211\214&:<;\312^<\b\025|\021"
+	.ascii	"\204\361\324\201R*\266\205\231%\030\365 \f\334\227v$\355+\370"
+	.ascii	"\024"
+	.string	"\244\305\203.Z\004\233>D\351\\Y\241i\350\317\313\257e:\201\020\312y\025\301\021lR\243b\236\275\341\034\\z\220\351Wq\232\237\213!8\237\204\031;\250\244\"\001\335@\303\371g\321\224\017Z\013\242\237(\230\324!\351C\313\323\326\024\227\2447\345n\n\351\301\244\007W\210X\001\227\t\233z\342\222\004\215\202G*\026 UhV\362\374t\370\331\341\034,\n\252 \241(\270\363`Op'(t\312\375\005\303\204\302\240\340\374\007\201\036\024z0H\304\n\307\343\342!\267\203s0\305_\226\336\220\344\341\374 s\315!Cl\013\347\340\217\016\274\241+8\007}\276&\\\232\363\233\021\344!\201\271\372\255~\301\366\344\262E%.\311\357\205I\322\317\330\226\007\333\257\201\"V\370\332T\363\007\027\234\327.\253\016z\345\304\305\007p8Vd&\204\363\312E\005\f\266\020\223\322\005\347\365O\r\334\031\262\022\303\371!"
+	.ascii	"\253\312V\340\274jY\363\340`\370\371\340\374\325-\205qu\003\t"
+	.ascii	"\347\223\320Z\261\262\366A\351&=\342\222\316?)\177f|_\373pY\233"
+	.ascii	"\213\037o8\257"
+	.string	"z\353^\213\035\246\034>L\216;$_8\257Xp\231\025\264\036=8\257Wp\031\336\030\226S\336\023(H\177\301\264\033gT\266P\241\262\342i&\212\275\255\032y\252\321\212\244v\275\373\032X\205\213\227\336\334\334Z\247\2319\304\330z\312[\245\234\234\320}\255\273\033\n\267 \255\002\340m(?\224u\312\317\236\366\311I\3535\305%\371\251;r=\314U\312\327)ky\210\221\266*8\257QV%P9\226\370p^\343\356\206\215\270\005\305(\300\334\356\372\332\326\265>\271L\005\034\3559?>\025N\276\256J\344\246\360\310\300y}[\335\214<a\303\342&\203\007\033\226\021\235\013\240,8\257?V6\230+XTOp^\277\326&?\304\210\002q\006\373\252\006\2662\331m\no5\342\222\374\204_E\272\232\326%_\231\254\301q\3312\003\347\363\255J\242\210\2708Q\262\256\241i1\204\244\234TK\232/"
+	.ascii	"q^\321\326$\371\206\212\031Np^\323V$[\272X\2101)[\317`\002\213"
+	.ascii	"\350\256p^\217\254f/OQ6\214\234\215\255dk\020.?\037\234\327\""
+	.ascii	"\253\021\025l'\317kL\310J$m\342\361\303\204\363:d\355\242\002"
+	.ascii	"u\204\211\263\030\f\rf\224(\234\277\002Y\203\374\252~\223\342"
+	.ascii	"\323\342\374\002\200\355\265\271\206\315 \353K\303\371\005\330"
+	.ascii	"*@\326\332\343\253\217_\r\006!\333Q\302\371\005\230\261\377\325"
+	.ascii	"\353W\207<\272Z@\234_\200\250\375\002\270\310\312Z\267\254\216"
+	.ascii	"\276\262.W[R\225\225\307\327\255\265\254\304$\017\f\347Uk\335"
+	.ascii	"\221\366\203\206\316\272c\325\301\304\247H\n\rJ\237\240\305("
+	.ascii	"\262\346Xq aa\245\200E\322\342\274\324#=\366xp~\001|h\320X\257"
+	.ascii	"4YX\234\227~[#C\252\361\365*\257\370\213\222\322j[\312\032\036"
+	.ascii	" \316\037a}Z\237\326\252\013"
+	.string	"\244-\272AR(\261\241nR\330\270\326\031_\253\202\262<\375\341\274N\255Tk\024 \274+*\031I\252\024\021\312[\204DX\200\025Yc\340\033\247\030\213\255+\234W\250U\352KK\226!\251\025\306\312\304\302\347\310\331\032\025\226\325\266m\007\241\335\336\2211\234?\202\335>\237\032\334\032j;\202\363Gp3\372\232\264\032\255Ng\024\005l\rUq\341\3272\227@\274\bY\221\222\241\364\325\351k\223\210\025\216w\244\0322\004\347\325\305\257\225\336\020&\316_\231T\034we]p^\227\326\026\307#B\262\343\005\316+\213[)\013\253r\302\371|\270\314\311T\024\036\234W\244\257+~UE\362$C\n\347\217\360c\377\353\321\257\246F\344\232\262p\376\b\\\373#\340X\203V\241UE\026j[\236\024\232<tm\273\004B\003$~@\326\241\257*\276\022E\240\013\020/\234\177\\\344\215\357\307\bR\373#\274"
+	.string	"\004\\\231\031\3506\333\245(\235+3]dqI~X\310\310\035\213._\231_\201D\254\360\265\267*\243;\234\327\236\325g\375\371\325\2356\347e\206\363G`\261\177\002\220\026G;+\317\257\336\037.\310|p\376\b*\366\252\243\002\306\370c\002\003\347\265=\341\305\026\030\\p\276\032X\025gc\007\316\370R\031\372\2701\347\004\347\217"
+	.string	"\324\327\247\376}\210:\247\350\005S\004\326\210\262\345\352\237\236\212\003\343\302Y\325r\303\320\030zK\260pV\375\262p\261bE\335\373\020u\316\005\311a\304\325\266K \326\242\237(*\275\253{r\177]\372pV\261\\!Y\256d\361\201\263z\345\224;\305X\274\275\300Y\315;\345\324\260'L=\344\262\366\256tp>\001\3626\035\235\212\367!J\247O\373\030\222s\342\327\266K \264\225!4\274\273\253xmf||8\253T~\266\271\352\244"
+	.ascii	"qV\355~\026&#-\016g\265\356g0fat5\b \266\177U"
+	.string	"\355KUS\345\"P\325lu\202T\214\234L8_Hey1%\323%uA\241x\177QYpV\245\\\215\"\214z\332\341\303\206s\334RP\025?\234O"
+	.string	"\035\373'\330)\366\243m\n,OuS\327T&g\230\321&\013\362\225\247\272\235E\316#-\374\030\251AAz\270\251Mt\222\007<m\373\364B\373\r\305\345\371\251p\352\023\025\212\372\246:\271_\252\233\312\366\341\203\3326\005\205O\230O\200\243}\002\350\354\213"
+	.ascii	"\250.\301]>\260\332p\276\bw\252\022\021\240\354\213\220\004\t"
+	.ascii	"\222[\027\201\245\006\364\370\313j\215\226L\320{GG\232p\276\b"
+	.ascii	"d\373W\321\320n]\006\013\233\323\342j\215\226Lx\221\232\373:"
+	.ascii	"\302\371\"\364P\213\250ET30\250,t\205\022\265\253#W\315T\036"
+	.ascii	"GY\314\262\037D\274\244\3242\225lI\n\232\226\2226g\255m\275\031"
+	.ascii	"I\275\242"
+	.string	"\350\366\350p\276\bX@\200\250D\364\262\233\f/\030C\256\022a\013\362TE\310\032\306\267\003\211*D\025#\372\261\203\204I\b\205\227DJ\r\222\256P\033\262\262\207\363Ex\261\177\265\2516\357^\356i\266GZ\b\r\241<\277\326\210\211\t\036l\300m\341|\021\210\324/\365\013\n\306\234\226_\320*\b\210\016\316\027a\307\313K\365\341\"\375\221\226*\351\022\345\323\343\252\217L#\r\212\333\343\342\202a\247\362Py\250Y\351\217\2556\247S\204\363\007\340\246CG\232%\007N\302\303\b\f\347\017\340k\377\252\226\252u\316m\240m\251\252R\246\243\001\350\260aC\315\312qt\343g\210\336\215\373\245f]\276\037\037g8\253X\031\01335S\344\235\3550\3532\202\363\007@\245\326Pk\250V)\2160'\020/9\2100\315\300\371\0038\252\252R\255T\276\024\207\216Y\216\031RV\230I\305\221cj\b\347\207"
+	.string	"\250R\251T)`\027\227\274\034\2077\344\007\316\017\001O\215R\243\324\0304R(\035'\020\250\021\247#'5\206:\025\023\244\"iJ\225\342\233\263\321v>i\207JZ\254\bSa\204"
+	.ascii	"\367\364tB\271Gm\273\303\225*\205\320DIIuzq\324\007$,Hm\272\352"
+	.ascii	"TE\351o\352\205\352B\217g\253\312\205\312\244\003K\335\025\221"
+	.ascii	"a\220\"-@K\032H\024\266)c8?\2042\225\205\312\0023\235m\373\344"
+	.ascii	"\224*\205\205\320c\377\352\212\373\245\2568\241`\251V\205\353"
+	.ascii	"\372\021\202\216\375\253G\367K=:\345\326\366\352Du\221\205@c"
+	.ascii	"\253L\225\251\026\335\266eJ\333vq^t*\256\026\255epb\2018\253"
+	.ascii	"A*\321\231\213&\016\"uH\r\t\027\317\217\227\027Wr\200\251BZG"
+	.ascii	"QV\223\037\316j\212L\343E\021.\026!\250\355[\365\007\267Qm\233"
+	.ascii	"\225\252u-\345%\031\361\201S}\256\376\254\r\267\362fL\341\254"
+	.ascii	"\366\250;S\224\244\001\341\254\362\250;>T\324IQw\320\276\236"
+	.ascii	",5\324\035U\207\003\026Tv\250:\347\016\324\bT\231\322Q\227.\177"
+	.ascii	"Y0T\260\251\300\371!\bm.\\\266\337m\333-;!\037c4p>\b{[\266l\277"
+	.ascii	"\277\264\227 6\277@\234\017B\334\356\333}\333\217\311V\221<T"
+	.ascii	"\t\217\222\220,\337~Q\300\344\350@X\262\267\267\261l\375\310"
+	.ascii	"\252\262\242E\037\316\007\001\355\312\225\215\245+O\013\225\036"
+	.ascii	"CX\356\236\335\026\334\215\"V\356^d\001\301\273{\312\363A\205"
+	.ascii	"\312\226S^\033\034\227\032\316\007!\007]]\332\023\001\036\346"
+	.ascii	"\005\266Rda\355\2030cO\221\262\345\322\236\016m\\{\217tl\005"
+	.ascii	"\2010\265\017\302\213(Q\366\221+:\301\"'V\244\340|\020\2226\024"
+	.ascii	"(\373\310;\264.\364\333\321e\262\270B\202\363A\370\331\337ow"
+	.ascii	"?y\362\264\017\315\326Fj\345\312\234\226\337\007]Z"
+	.string	"\214\352\b\211\001d\267m$\333\355\344\272m\220\221z\346\303\225\367A\337\376\007w\373[\311\335L\232<\355\266?F\032\030\231\202\225\367\301\333\376\007e\373i\377\261\b/6z<]\341\374\215\344n5${-\355\271\355\217\221*$\343F\336\007_\373\037`\355\337\264G\247\245\245O>\254\245\315i\371i\030X\254\226\340\374\017\244\316\316\366\2216\034sZ\\\200]tQ8\377\203\244\262\262}\004\204\266m\177Z\024t;\216\344\035\321\"\024x$\355y@\013\246%\234\377\001\020\021\"\333\310\217\254\374\202'\217l\027\3716R%\211\222#I8\3571\035\243\217/\317\352k\231EZ\217\267,A\202l!\\Y\355\022\027\210\241Q\222\026\224\330\267\220%B\212\200\340|>\035\343\277z\316\035]\365\240\022\026f#\253]r\002\201\2378\335\035\341|\001\300\355\r\266\301R\300\006\354\260\312b\322\005\n\022\234/"
+	.string	"%{sm\256\375c\267:I\330\031\364c\366\346\343\373G\320i\314J \316\347\333=\376\253C<\037G\002{l/%GM$M*\022\324\013\032\273K\267X\223\232p\r\301\371\0020\333\233\307\346\221\002\356V\247\205q\201\320chk|8_"
+	.string	"<\266\016\035\255\006\203\302\005b%\313*R\201\363\005@c\0373\335\255\365\265\2650\323m\266E3P\346\264\270\004"
+	.string	"\225\225EC"
+	.string	"EXXV]\366C\334}u\365\265\334\241\355\231\202\312\302\262o\302\3354\2766\215\257]\240\3359J!\007\2249-\277"
+	.string	"\324\355\177W\355*\334\227\026!\243\342$\335;;\352\302\371\001\310\3321bl*\007\004\031\313k\227\226@\004\311\266\264P\022\225\226\367-#\016\251\256\305\371\001\210\33206\214-\225\301\326\321\234\226\237z\226\"\306\324\371\276\245\276\226w\330\375\300\201\363\003\220\244\264\235\2246\324\3237\324\311\345\2245\005\347\375b/\355\245\335\324\200\037]\262\326;!w\177.\276\233\206,\214\204-\341\274\2310V\216\246\266"
+	.ascii	"\354\354{P\267\207\366\212=\264Y\354\244o\0260IOw?6\321\2116"
+	.ascii	"\322;\354\264-O\333>=\245oP\250\256\364\r\341\374o\025\337H\373"
+	.ascii	"h\211\316O\006\316\333H/\271\250\312\202\363=p\333EUwcHMp\276"
+	.ascii	"\007e\373\036\354\330\233\271\2036s\247\330)R\300&W`\326d\004"
+	.ascii	"i\201\363=\240\261\357\301"
+	.string	"\322\376\367\317\3769\253:\320\024\227\304\325\266LLX\241,\345Y\341\374\016\376\366\367\316\335==g\325L\333\306xJ\301\256`\331\277g\225~\032x\267\316\326\301\321A\224\375{\251\350\277\264\313_\n\310\345\\R\300\255\323\266i0\346\264\270\332\245%\020C\24222)8\003v\240d\277\003 {\251\337^\252E\267\355mF\025\031\235\357~\245Z\342t`\031\301\231\217/\315r[\243\276t\007\f\224\310\326\221Z\337\375J\263\240=\2204\225p>_\306\372\257\242S}wg8\277\203\032\373\035\020U\251\222b\311\242s\345)\226\027,R\354\362\362r[\027?*yVp<i\361\365f#h\b\347\003 p?\265\273\351\335\335\323\264\221\006D\2420\345\265\001K\242R\006e\007\214\310e1\277D\210\023\2109G\022+\233\314\301\311#\220\313b^\036\215\347K\204P\226X\026oP8\"on\2204"
+	.ascii	"8\032\213I\225\245)&\215\030,\215G\030\330e\221M\322\030\217"
+	.ascii	"0,\215G\030pjrR\033\220\306`M\215\013/\021\"iBY\264\201\265\311"
+	.ascii	"\251aK\320(\331\344\313K\204`i\212I\022Gc\016E"
+	.ascii	"\033\034\226\003J\030:\274D\b\024\330d\316\262\310\216H\217\305"
+	.ascii	"\243\212\003\r\313\001\234\232\2344\207\230\301Kd\260$\326\030"
+	.ascii	"U\366\306\270\\\262$\210&h\22064C\034\344\262\206\341\321\210"
+	.ascii	"D\201P\271\264\311)\216`_\330\300\246F\333\344 \227\311\2452"
+	.ascii	"%qD\332\004\2177\030mj\216\311\234%\233D\036\367\322\210\202"
+	.ascii	"\315/\021\002\207fI\\\2625\340\320l`\202\006i\223CrI\224\351"
+	.ascii	"\220D&\223lr\271T\036\2214(\r\322\206\210<&\223,\221\330a\204"
+	.ascii	"^\262\312\033\366fDZSd\223#\320\232\243\361\004\233\32466\354"
+	.ascii	"r\004j\202e\225#\320\233\"\233\\*o\330\033\342\221\305A"
+	.string	"\276\034Y\034\344\r{3b\037Y\034d\315\b\315\326\224\260Y\033\343\b\234\233e\312*\22164#4{4\332\034\215\310\343\246A\332\330\024o\364\221\305A\216@k\216l\r859\3511\207\003\034@\032\205,\211\032\326\346\004\362h\202\306\205\f\226E\244\315\b\024\207]\3260|\211\020$\216\306\344R\251\301\td\262\304\022yLG\024Y\233\234\003\016\315\r{\243\225\313\034\034\342\321\270\2641\346\334@$\276(\22798\331\306&\347xD\036\323e\361&\211\034\241G\350%[\303\222\255!\347\306\210\302\210\017\313b\316\006\\X\2625\344\334\0301X\276D\210\016\264\222\bC\242\270<Yb\007:(I\024m*\300\222(*sV6Y<Q\223,^`h\202\246\270T\262\304\224U\201\261\006\242\t\232\342\262\006\342\321(\003\021\246\346h\224\200\220M\346,\223\305\234\016&h\2206\023`\223\310\t\324"
+	.ascii	"\2634\036aX\227\254\005hj\212\303\233\0234\250H\034\222l\rJ\033"
+	.ascii	"\033\027\222\310\n(\217'\2205\313\234\0225\334\234\300\t\300"
+	.ascii	"\315\t\032Tc\362\0037'p\206Jc\006l\322\205\233\023817'p`\226"
+	.ascii	"\254\005nN\340\b\225zi<\302 \244\200\362\346\004N\007\245fmj"
+	.ascii	"\214\302\033r\224D\233\"\016\354\215q\031D5P\326\034\2214\254"
+	.ascii	"\f9\024m\330\032\0178,k\263j\235\302\314\316\"B,\225E\033\275"
+	.ascii	"\314A\236\b\b\261\314A\242\333hcc\274\2711*\323t\205\020J\365"
+	.ascii	"\205\205\020\035\206\t\b\301\336\030\227Ke\321\006\206]\026\227"
+	.ascii	"\301$\215\361fhSd\223D\025XP\"\217\305\243\260\002\354\262Hc"
+	.ascii	"\2549\032a\202\313dqY\303\2724\036aH.\215G\030jX\2334\311\326"
+	.ascii	"\024\2216K$R\002H\0336X\262J\226\0037\354R\231\2032\310*s\326"
+	.ascii	"e\022I\303\021\006\230\031\226I$\r\254\262(\001\034\232ep\277"
+	.ascii	"D\b6\211\244\231!\221,.q\220\272\346\310*a^\200\201\206\243\261"
+	.ascii	"(\203\t\032\244M\320CM\022\371\201\233b\222\0042I\303\207\032"
+	.ascii	"`H\024i`\225\305$\00540A\203\214a\215\301\303K\204@\032k\226"
+	.ascii	"J\231d\222\255Y*u\315f_\204&h\2206\307\016\020/P\203\0131T F"
+	.ascii	"\203\024B,"
+	.string	"\223E\234\020I\344\022)\003\273dmpn\220\023\2709\201\023\200\016\f\331e\221\003A\245\222M\326\324\270\220D.\213697Fe\007\226DQ\331\201\345\321\230\304Y-\020|\211\020\254\211\342\b\"2\231\003\t\032\232b\t.\260&\212#Ve\022\251<\2625\f\227/\021\002E\022\005\024\311\030\0249E\"\212\342\r\f\212\344\212S\274\241I\242I\266\306\210\0032\211CD\221$*snP\276\240`mpr^\030aS,\261\342\300\324\030\325\021I\242\021GID\221\334\200\2551&\223,\016H\342\321\b\002\221D\216\r\316\007\017KV\311&\221\313\234\"\261\346h\274\201\270,*\21179\311\245\t\026G\331\201\220\265)\322(\327%\321\250T&\2034\311\032\343\rz4\336l\0234l\t\032\024\305\233\r\243\264)\342`\203\304I\262\313#\f4\311\r\224,\233$\301\276\300\332\2208\272pS\234"
+	.string	"\0168#0\250\261A\226P\262\311\0226\260\313\"\016\306%\215\013l\rR\206\244\261\370\341h\244a\2259D\024\305\033\"\212dp\351A\222]\016\217F\032l\212\306$\253\364\200\302\006\024\034H\026\227\312uIT\201\005\226\310\342\344`CM\022I\303r\200\245)&\227\036bl@\032\367\222\230\\.\213/K5\311\232H\"?\2004n\032\216\310\227${c\264AIcT\346P\002GH\303\0219\024\262\304\032\030L(\2136\214\240Y\227J\233\034\032\222\354\362\310N"
+	.ascii	"\007\366\005vY\344\200\320\006I\203\\\"\2234t\200\341\346\004"
+	.ascii	"\r\036nN\320P\303\322\034sP\036;\300*s^rH.\331\033\326\206\265"
+	.ascii	"a\211,\241|\201U\346x0q4\306\300.\213K\245j\202\006\031\003\273"
+	.ascii	",\326\340\344\254,\221\255A\312\300&sl\214\305\021\303\345K\204"
+	.ascii	"\250am\210\313\022$\2146G\244Q\231dq8\032\325\0326\006e\316\262"
+	.ascii	"\270TzX\022S%\211\242\rH\243\206y\211\020K\024,q\211\203\\\262"
+	.ascii	"$R\320\354M\361\230I$\213De\261DJ\242h3\"\333\024q8S\245\222"
+	.ascii	"\245\241)\352\022\2000\202\031\023\240J\022I\027Xe\262H\003\314"
+	.ascii	"i\214I\366\310\222\330W\201\205\023Xh\001E\372\026\026\220\302"
+	.ascii	"\002R\320oa\00133\013`af\237\205\231S\205\020\312#\322\270\304"
+	.ascii	"A\252\354MQ\003\254\215\261\002\024`i\214\032,a\210\304\364%"
+	.ascii	"B\210P\022Q\260\313\234\033\017D\275<\346 i\210\3044\311\036"
+	.ascii	"O \211\304T\231d\2259G\"q\327\034\215&\210D\255<\032q\224"
+	.string	"DbzD\032\225F\033\226HT\227\304\245\322h\323\341%B\234P\303&\213%\224'(`\211\202=\332\024\217Ivy4\226X\342\020\211\033\340\300&q\210DM\324D\315\252\300\250$\022\265\t\032d\f8Hd\fGc\361FX\303\036I\030m\212iqY|\341\006\231\304a\331\025\211C\222U\n\227&h\2709\201\243\227D\023Gc\f859\252\211\2431\206\233\0238\351\322\004\r75#\364R\371\245\272$\266\260<\032s\322%\221\205\231%1\271\304Y\036\2159*ksC\016\262F\277D\210$rISd\223HcrI\303\004\220\306\241\222\230dmj\216\305\013 \215A\0234\305\033ll\2124\373%B\2308\032mpjrB\250\031\201\215J|4\022\22355E\0234HepI,*\2039\330\030o\212#\210G\243r]\022\325e\022\211\363\022!\216F\024\226\354\321\270d\217"
+	.string	"P\225:YSSD&Y\025\020\217F\345\306\201\206M\346e\022\211\223\22355\305\234dqH\2625(\215\273\206eq\224\304\340\222\310\302\314\362hL\227\304e\022I\303\f7'p`\226\304\031`\310H#^\022'\220do\214\313\227\034\234e\016\222xs\002\007\005e\222\305\301\230\254\031\301\276\300\342\344`\003Q\006\030l\b\336\030\227\347\222\310\201\tL\340\306\270\334I\032\232\323\206=\036\213%hR\326\246HS\303:\003\253\264\311\301\t\236@\332\214H\2628\314\300\322$\221#\2065\254\315\r\305#\233\276D\b\006\320\2608{Ido\214K\"q\323\260J\"\016K\275$\2228\"m\224D\033\233\"\2152\007%\221\350\201\206U\036\2118,S\n\304"
+	.ascii	"C\005\362K\204X\322\344$\227J\024\224"
+	.ascii	",N\016K\024\224K\343\r(\344\034I\234\200\"\347h\2649A\005\026"
+	.ascii	"\210,\264\200\002\005\266&\307\206\346hD!\251\314A!\001\"jXe"
+	.ascii	"\3161\207\270ur\211#\254)\262\311\227\344\022g\2704&O\bk\216"
+	.ascii	",qD\316\r\254\262x\303\220U\026o \342\344\230\240)\336@\234\001"
+	.ascii	"\006\"L\315\221%\2628\024\225\304\031` \n\225I\326D\262xC\334"
+	.ascii	"Gc\261\004\rQ#\217\254\215q\0041\025\241$Q\264\031AL\227\304"
+	.ascii	"\264\306\006I\f\036orl\2204\304d\016\r1\310\332\334P\\\342@|"
+	.ascii	"\031\221s\3032\211,\241$\252K\342\f0\020W\0234H\033\"\272$\252"
+	.ascii	"\300\302\210\021H\"Q]\262\312\021#\220\304t\006\030\210\301%"
+	.ascii	"\0164l\r\222\206\270g\200\2018,.\2135D\266\306x\202\270R \006"
+	.ascii	"\030*@\234\001\006\342^*\2156\303\02197\020\225l\222e\223#\210"
+	.ascii	"\302%\221U\201Q\251W\250)\342\020\211\232\255A\336\020Q%1\270"
+	.ascii	"\244\321\354\215q\231\367fkr\226\306\345\262\270\331e1\231kX"
+	.ascii	"\026\247\006d2\007\022\231\206\246x\262\313\342\262\206\033d"
+	.ascii	"\315\261\230\f*\2076H\244\004\210\350\261hT*s\212\026`\223E\234"
+	.ascii	"\032\224\305\022\035\226/\b\213%p"
+	.string	"l\\X_\"\204\r[\203\274\251)\346\244@\004%\221\204q\304\0219\001\033\266\006)CM1'\005\036\224\312\342M.\261$qdc\270I\026\325\242q\231d\217\306t\251\314I\226\260\001E\361FE\032\227E\016\2609)H\"m8Q\314\341ey,.\225G\344\004\330\033\243\rI\344\022y\343\201D1\371\302J\242\230|!\310*\215H\r\320\320\024\367\222(\002\001\313\2431g\327\260\2542'\213%h\362\2225AS\304!\336\324\214X_\002\204#q\330$\nK$2\211B\320\250D\342\bqn\212K%{c\\\2529\340$\211\311\242M\016\211c\221\230sc\374\240\202\034P$Y\033\226\206\246HL\026\331\243\321\206\230sc\354`Y\314I\001\361\2104.\213\313#kL\"\21197\306\fT\220\003\nb\016K#\r\322\206\305A\210L\346@BU\022q`_\240\241)\356+@\001\023"
+	.string	"\241\003\032\260\300\246\t\021\203\r0\324\200\302\222%\221,.Q8\032\2137(\320$\225(\204\370\340\377\213R\020\306\024Q\333\002\255q[`E\201b!\004\007\026h\365\222\024l_t\224\375q\275\254@a\360\330\230{AZ\373\202u\\\2000_\216V<\037[\244\340\275\030\255u\227\310\n\224\316K\021z\204\267\302b\374\274\250X\237P\r!k\022\r\241a\314>#B\177\031\372\323\242\023LH\203\305\212'8\337\0363\177\021\202\211r\306\207\025\224b\267\360\tcb\376%\305\257\237\320\261[w\002'\255\0302p\316Of\376\302dj\203Q\003\350'\363Iy[\361\342\363\227\237\377\364\221\322\230b\206\245\n\347\227\236\231\277\370\340\037TL\0328\353\027\236\035\342\021\216)/;/\2006\204\236\274\350\274\264sC\334\212t\371K\373\017\0035\226\331\233\020*\234\321*3\037v\3111\372\212\264"
+	.string	"\323&TB\214\260\340\222B\r\343b \231\362\207j\tw\2128\001\334\262\241ddt\345\320\202\243\274\r\361\370m\026\272\253)\212O\226t(*\nj\256oe\322\204n\247\213/\230\244\252\215mq\331\233\222\255\226\030\341\351\005\255V.'\031K\260h\271R\003\206.J\306P\336\t\007#\267\"\320\210\225S.\313\300a\326\243\312\366\023\273\323\002\330\\\232\353r\345.\330\264\355\364\310x\250\bg\320\210\242\202\2023]\215\f\"j8\377\204\235\341\024\341N\0133(8\377"
+	.ascii	"Z\366\033\336_\024+a\221\0348\334\342\204@h\033\013\300#(B\255"
+	.ascii	"\262\030mp[:\017LE\332\023\341\217)!\244@'Z\312\246\212\002\325"
+	.ascii	"\365\206R\301p\311\b\343\341&\024\243\242v\366\327\206\336\320"
+	.ascii	"Cwe>lB2\241\022\021+!M\334\324\025WE\2200Q\255$\200eH\306\022"
+	.ascii	"\241\335\220\305\235\232\023%h\023\306\373\202j\327\204X\206"
+	.ascii	"AL\376\232j)\263**\n.Ipk\215L\247*\355C$\017\222\271\371\274"
+	.ascii	"\261\300yx6Dk+\373\352\201\363\201U\205\363\320\f\227\331\020"
+	.ascii	"\242\243\306\021\224N\330\302Q\305\225\225\005\243\222P)\221"
+	.ascii	"i\240\223N\210K\207\021<\007\203Df\207U$\350dI\013\bP\224\007"
+	.ascii	"\272\006\232W\326\220H\020lx\203\b\324\223!\351\234\026{B\223"
+	.ascii	"\023\022\244\303oM\270\330\211\005\257\254-\272\334E\005\t\376"
+	.ascii	"\245>\220|\374\001\021\356l\361\3721\003\347\256\017\177t\r\233"
+	.ascii	"F\235\266\325\001\322\026m\260\203\210J\353\212\312\252j\330"
+	.ascii	"\374\020L\304\n_\033z=\351\261\3625\3641\3541\364\032\332\370"
+	.ascii	"0\307\177\277\2066\206[C##>\020zDrH/?j?\376\206:>\334\372\220"
+	.ascii	"\207\210\025\236\226\337vh\371\341\374\341\216!\216\017\265~"
+	.ascii	"UH\365b\007\017\347\037\200\307\036\336\3700\353W\207|WxH\341"
+	.ascii	"\374\003\340\330C\254\003\\\355a\215\246\230\22399:\234\177\200"
+	.ascii	"\252\375\017ih\3452\2541+V\371\007\206{\001\204\243\n\210\n\243"
+	.ascii	"3\235\031C\320'.\274\234P\221\241R{-\342d\230]2\270\274\261\030"
+	.ascii	"\030\013F\n\b\013\333TF2\344\245C*C\021\206\025\255\320\001#"
+	.ascii	"\273\341\024J\200\250\2422\225\341W\214:*Py\257\212\212\037\346"
+	.ascii	"\360\305\207Ou:L,N\331\357\205Kim\254\211\tS\346\303\351\312"
+	.ascii	"\305\252b\330tR\202\204\t\260\bS\325\324R\212%k\221sc\241\264"
+	.ascii	"^\335\253\037\243\032C\026\037\266\300\322\002F\023\316\303\244"
+	.ascii	"u\357\334\3122R\207\363pE\360\b\246*\253H\222!\322\352\224\252"
+	.ascii	"\350\361G5<\312\177X\204\306\244\f\215\2522\323^\337\316\260"
+	.ascii	"\350\256\201!\t\3532T!\214\312\"\004\311\214!Q\372\344\250\257"
+	.ascii	"\252\306P\332\243\3724Y\271\"\264\217\2009QR#H\330\302\351\252"
+	.ascii	"\n\006\316C\240\363\005\201\201\201\201\\\332vg\b\204\207)\206"
+	.ascii	"\314\017\201\336\204I\351\270\230;\272\251\345\246\350\352\206"
+	.ascii	">*\236\327\221\0302p\316T\302\250\270.%gC\036u\017\t\016(\255"
+	.ascii	"\341\216\372\207d\311\312\r\2343\2250\212\354\256\005\026\316"
+	.ascii	"\302?\341\2370\360\030\354\324H\271\020\305y\371\265KI ~a\227"
+	.ascii	"\013\003\321\237\273\2758\234\205\200_\333\177E\300\244\340,"
+	.ascii	"\344\362\265\264\315\311\024\324\001x\366/\334\202\026iy\262"
+	.ascii	"\244\005\025zA\031\220(~\353V\226\2705\247,\350\033\325\337\017"
+	.ascii	"\236\276`\2166\035\n\022\333\342\023\356\371\030\271\371\340"
+	.ascii	",\334\273u\2017\366\206p\026\336\t\357\204X\324\210xd\341%*L"
+	.ascii	"\334\256\\\210\305\b\206^\034\316\302\274tG\030G\305G\005\316"
+	.ascii	"B+\031+\305\023\202z\302YX%\355\351\241:{\201\263\020\357V\212"
+	.ascii	"\342\344d\230\340'\204\2730N\b'\264\3531\024\250\204\215\252"
+	.ascii	",P8w\241\335\205u\"V\370\332]\242\243\302\b\316\027\322\t\345"
+	.ascii	"\2027\234\232pi\022N\351\361\224\205'\234\"\224\262\003\345G"
+	.ascii	"\227\006l\246`/\204Za\024!\224)N\234\250V0\342\274\374\254\220"
+	.ascii	"\350\001\341|\023\226\034\271\320\354\210\320m\307P\240\022?"
+	.ascii	"\03000\031O\204L.t\273\260m\330\002\n+\f\347\013"
+	.string	"\331`\244v\222\330p\02669\341\254\332\261\272\022\256\t\227\374\345!\221\351\340a\343M\250D\337\021\321r%\004g!\232P\rP/\205\024!\021\273?\271$B$D\240"
+	.string	"\3658\320LW0\314\204i:O\035\023R\026\207\263\360L\303\375W7\270\352Bd\335\223\"7\32536d\210\220\354C\324y\027\250\304\246q\364\300sa\344B\262,\\Rr\340,,\262R\36101J\033[\273\330\230\232\032\023\022Y\253\226L\361\2612\343x\356\274\300\300\204b\037\242\316\271+_Y\\\333\310'IY\220\013\305\326NT\301j\303Y\bd\335\201\344\313\253\007ga\330\245\242\203\234\350\220p\0266\277\226F\343\0163\t\203\220\222<iuu\t\177|\210:\251\340\210\363\342\322y<\200L\371\270\360\307\265a$F\034\316\302\036\031\330Xq\004g\241W\206\342\361\241\326E\245C\207p\013G\234\227j&\306L\342q\341\2260E\213\030Bp\026\006\214\035\2504cN\226\006\213,\223P\226\251A\024C\316)EE\243A"
+	.string	"3\026"
+	.string	"088\036\220\210\3320\307\007\024\200\022n\310\200d>\243\213Y\026\"\346\f"
+	.string	""
+	.string	"P\200\200(\022"
+	.string	"Jb\211 a\"\374=\002*~$k5\242x\243\031\321/\367\257y\337t\277~-\200l\251\330\350\316\036y8\207\257\322\223\\\262\336M\347\026\266%\373J\0247\226\005\203d~B\216F\273a4\274\013\342\205Y\3004\023k$\256[2^r\225\020\370\316\300IW\016Nn\215\274\013\262\232\224\231{I\222\335I\216\f\372\375\340a\024\001\241\244_"
+	.ascii	"\246\355b?\002\336\270Y\2150-\311?N\312\241p -v:\026\277Po\256"
+	.ascii	"\001q\005\200\f\004\330\026\332_\350D|=r\2168.\242\304\3630)"
+	.ascii	"2\002@g\"\262Z\242\217\022\034HLD\340\207R\260\340YC\267\231"
+	.ascii	"y\037\020+u\210\027\2038l\032\030\367e\347{Z\017\021\253>6c\365"
+	.ascii	"\344\277\321\275\207\202Z\236\243\225\030\366\310\017\242`\346"
+	.ascii	"b\230{\204\365\356\200\244\017\022\353\331\344\205\364u#k\311"
+	.ascii	"R%\036\021K\207*\277~=\335\356\352*\330\nB\247\243\017/>X"
+	.string	"\217\022\257\301\037&\222\177*>@\202\343\354`_5\006E>DS\220\n\002!\373\347\367\b\274\327a\301G\336\223\322\246\270d\207\215Hp=\340\2440\210m\226\375\366\254\245\376\tK?\347\360'\nk\025\305|\310'\217s\217\340J,\037n\036\377t\373u\n\204$\372v\002{VD\2154\013HF_\323\257\210\270|\362\236\240\327g\306\362a[\347\035Z \312\253\037\013:\312\r\312*\332xt0\0326\0274|E\332\241\215\347\337e\253V\332/[)\302\326\274\353\224\215\323\252\205I\227Vu5\271\255\201\033\035\350\231\026\311\332\3141(\036M\335U14=\306\247\r(\233\311c\211\227\222J#~E\277\025\334\354\335&\034\333\201\354\005\ny\356\b\214\374\266\302\236\326\3057\277\265\214\277\324:\326\3232X\033\217\315o\364\210G002YZ\\\033V\250Q\325\342C,\034(\363\315\207\256\262"
+	.string	"\233\2458*\201a\025R\325"
+	.ascii	"Q\351\232\235?\350\304o\342\321Bh\201\330[X.\026\363\206\"N\365"
+	.ascii	"\177Rd\340\016\2328\036\267\243\366\024\035\363\243\310\323q"
+	.ascii	"\205S\252\0176\345\307LD\004\264\326\033|\361\310\n4"
+	.string	"\261IR\034Y\337[\315CK\235[\275\330\226d|\337L-]\347\356\034\024\240\255 \300n\321Z<zI\265\260\344Y}\231\370\226\370\261\211\375{ z\3227\234Ngqj\242=I`4I\306\202\037\027a\327\352*\330\370M\216UMQ09S\377\371\027}5s\313s`\310`LrSH#\tK#3\2613]\t\254r\234`q\366y\333ku\020)\317.X\365-O\331h\306\016Lj\367\226\224,\025\247\352\333\266\232\334\213msI\257\025N7\"(Q-\310\267=\210\320\027\314\367[/\235\027\036#\366\375\217\335\377{\2300\356\251gD%\\\002F\024\037.<GY\205q'\r\177W\337\212\241\276\257\322i\243\334\257\307\351\f\bl\315_\303n\3254\314\023\373\2729\210\255\251\305jf\320\002\347\336j\302\023\036\025\\\270\231u\005vt\0228)\235\221\3532`\360\232;\032B\334"
+	.ascii	"\274L\210\361\314Y!7\032\241\207\303\204\013G\262\360\362W]\333"
+	.ascii	"\221K\026\2120Q\377:\310\217\267\334\240J\242\211y\b\034`\331"
+	.ascii	"\301\264\207{\302Y\007*\032)\247\250\347G\002\334\262\215<\331"
+	.ascii	"\270Q\016|\262\260\b\307\370y\tG\333\337\301w\236\336%\033\317"
+	.ascii	"\207\177:\021\377\334\0370\031CX\023<\270\244\267\317J\f i&d"
+	.ascii	"\366\n,\227\204\350\f\306\337\361\374\004\250H-}\335\211\204"
+	.ascii	"X1\210^>\3707\367\320v![l\317\201\335G\301\004/6~Q\327]S\024"
+	.ascii	"x\256#\314\335\375\321\316\272(=\222;\024\213\032o\362x\301-"
+	.ascii	"P\033\226+\001\036\303\006\207\230\323\036\352\245|a\005\331"
+	.ascii	"j\227\264\222m\0312\250\030\244\222\030\013\302\2579y\332\367"
+	.ascii	"S^\372\0336/\322^\243\312-q\004\206\007\305\302\022\246\032\276"
+	.ascii	"\0277\362\316u\203\2379q\210\275}v*\304\373\265\262\307\261\362"
+	.ascii	"\336\265\271K\266\374c\276\260\001\265u\2332\031\tY\234\223\031"
+	.ascii	"^\254\267\277\205;]\376\tJun(p\007|\364\363\224\301\240\371}"
+	.ascii	"\264\253\004i\326{\351N'\037\022\273\300\023\035k\t,\374:\314"
+	.ascii	"L\310\024!\211)\224q\244l,<\021\262\276'\216T$O:e\351\241!\342"
+	.ascii	"\375X\236\352\304\311\027{\333\303\345\016\250\002n\362\311\217"
+	.ascii	"8\037\316p=M\021\316?\366\223QC\366\020\330rW\264\244\342\203"
+	.ascii	"z\035'\272q\032H\372\342\2057\246v\343f\375~\314J\227\025\222"
+	.ascii	"\"9\252~\314\017\271A!\243\234c\215_\313\303J\25676\251\365\323"
+	.ascii	"\343qx|nN\216\354\310\316\232\275\355\201\356\265\3427O\0337"
+	.ascii	"\360ou\002Mb.\031\241\347A\355\232\320r\204^\365\2556\rk\342"
+	.ascii	"\301\317\220\002\t\2227%\211\021\254X\335\217\363\004k\216\203"
+	.ascii	"\374_\033\240\005#\017c{\013D\235%~\262O\304\367\021A\364\306"
+	.ascii	"\245,\305\313_\312\207N\270\2440\0134P#\265\277\354\212\335\204"
+	.ascii	"%\002\265\341k\334\022a\354\216\002\366w\362\333.\"l\231\025"
+	.ascii	"%\373\372\201P\225tu\021\230\022\004.\"r\347\3572\210\311\262"
+	.ascii	"f8\213\347qa/L\274;\253\233\243\245]\023\305d/\363\312\331c\206"
+	.ascii	"\200U\2029\240`$\242>\340\253\320\212\"\367\271\367@\354\265"
+	.ascii	"~\310\004\367IJ\231\001\334wf\330d\354\023~\341\221;L\270\026"
+	.ascii	"\205p\207\007\224\f\027\236\227\361yj\203\272\256L%%\253W7)\214"
+	.ascii	"\234\260\245\300\244\031\244\033U-\177\230V\203#\340\353s8Q\351"
+	.ascii	"W\225\231\254\322e-%\363\261\001m\346\224XIr\260\267\233\362"
+	.ascii	"\201\261\260k\\,y?\230\253\251\\K~\201?\030\361)\246k\352\371"
+	.ascii	"U(L\333\255o\237)Sr\231;W\375g\254\007dm\325\0205\001[\362\177"
+	.ascii	"\342\244\316\001\355\257<\033\360\322\254\020\312~\230\200NC"
+	.ascii	"X\355\tP\267G\201$\033\245\322\277r\230\002+\311\251\231\023"
+	.ascii	"\351\240\377\363\273\r\232\b]\321\257E\247% \226\257\373\037"
+	.ascii	"2\307\330\250n\214\255V\302\325"
+	.string	"!N\213\330\007u!9\037:8U\3500\004w\r\367\3152C'bY\335~Nu<\330E\b\222\300\267\317\215\036\321\274\325\361\306\266\252\353%\020\254\030\253\260\274\035\215\\\310\246\331\240\021\237[M\362@\272\256\b\373\304.\253"
+	.ascii	"<\030\027\"\344\332\240\223\252\367G\016$2\326f)X0\215\370,\360"
+	.ascii	"\273s\341\362\214\260/\373\326 \026\306(&2\246\366Z\273\335\241"
+	.ascii	"\227\346\351q\033\222>\013A\377\250\334\202%\003\322C{I:\361"
+	.ascii	"\252\233\232`\374\357*\357\233F\2714\366\247ei0\315\235<\221"
+	.ascii	"\021\346\220\341 \213\215R \0013\341\n:j\264\211,v\321\304\312"
+	.ascii	"\330\270\007\270.1\0061j\264x\330\2254\260\345\235\307\2006H"
+	.ascii	"\250\204\276\315\264`8\330\035\232\257J\t\036X-\007{.9\354\205"
+	.ascii	"?V/`\2635\345\271\260WLQdK(q\324\212\0010%\256o\005\005f%\002"
+	.ascii	"\376 \2368/\205\274\353|\0045)s \253\247\335\215\034V\240\216"
+	.ascii	"\355K\342\0017,/c^l\313\271a\t\350i\221\377\215]\266\367\227"
+	.ascii	"Q\036\305\345\264\241\3635\0071\334\n[J\333\350\367\020\005\""
+	.ascii	"\376&\312y@\320\352%9\022\372W\234/4\3700\006\25127gp\235\036"
+	.ascii	"\343\347-\\\232\326\356\315VX\tY\271d\213\240\r\323\321\227\227"
+	.ascii	"\206\033\242Z\b)|xa\211h\021_\315\177\214oi^\227-T\263b\032$"
+	.ascii	"\236\324\216\226\024\360\210\035@\022^\331\016\177TY{3\204^\257"
+	.ascii	"\363;V\207\240\300\277\232\235\356\226\274EY\027\r\323u\261\243"
+	.ascii	"dW\026\177\265\263v\\\274\216\353\376:\272\230\006&\242\261\212"
+	.ascii	"e.lm!Y\235\374\325\331\251n\250\315%\306\314A\032|T\022\023\036"
+	.ascii	"\260\252!\317\335\354\033\377/\030\036N\206)\b=^\2177\306\026"
+	.ascii	"\223\2267\340\b\307\273\242H\217}g\251|B-\326\234\310\226\013"
+	.ascii	"\270\225lU;\322\232\275\f\315\031\257\017\016u\277\204\031\006"
+	.ascii	"G\375K\311\214` \337\2005\377B\352\375\331\271\330\213C\365\\"
+	.ascii	"\246p\375\337\347\2449\325\355\353\323\327\322\021dF\237\317"
+	.ascii	"\360\270(\212Z\3352Z\357\341-\240\346\200\003\256\362?\315e\033"
+	.ascii	"\220\213^\304\025\237Y\031\"\001\341\036\353}\321\315?t\004\311"
+	.ascii	"\204&a!\001\326\260\332\277\234\256EIcS\227\336\357!\272\"\002"
+	.ascii	"h\230\315p\032g\244\355<\325\024`(\326\204\303i\2518\313\236"
+	.ascii	"4k\234\217J\351\237\344B\313\367\367\244jg\tn=\022Q\226\224\210"
+	.ascii	"\t\347\013O\r\214\345n\224\267\224\364\313\0324`,\311\275\033"
+	.ascii	"\312\335d\361\235\255\367\024$\337O\351\310\342\250\321\360O"
+	.ascii	"\361M\213\252 \236\330%\255\241ET-p\273\216\316\223\f\304x\336"
+	.ascii	"\254\006D\246%\020o \240V\212>\362\016\230\345\223\007\232\244"
+	.ascii	"\244\310\fd\230}\264\033\363\224s\243Y\254\225\305~`\221d\021"
+	.ascii	"\251\376O\351\341~\247#!\240\005Q%]]2\221l\315\025\335\305\205"
+	.ascii	"\r\002\211\2475\362\275>\004\346\302@\007\226&w4B\321\332\\\361"
+	.ascii	"\263&\366|\336\330\001\333\214L}\02264\213\267\360:*\245\311"
+	.ascii	"\346\341\313\321\250\t%PpT\n\254zc\332Z\312\212\030!\341\272"
+	.ascii	"\323\323T\350\365\033\300\230\264\243U\265<\254\230\212\221\205"
+	.ascii	"7\361\350\001IiR\030\251\325\036K\263<c\302z\376\205)\255\223"
+	.ascii	"x\252P\200\024\236\327\371v\224\332\314\"\341\023\273_\306l\332"
+	.ascii	"\215\033\226\325g\341\327\001\367\237\"\235\002\344\376$\202"
+	.ascii	"\n\026\274\016U?\366\273=\002b\007\031\np&O!\353R\375\266X\307"
+	.ascii	"\214h1\343*\232\263\017\3509\310\034$\215`L\026\001\241~"
+	.string	"\254Z\341\224\241+/\200\001\272\201\312\324\r\300cf\332y@\251B\034)\324j]\335\223\3500\260\\\223\354|\373ke\016>\356\272\345V\373H\214P\034\207\326\250]\252\024\223\200\332nc\037Sk\006\354\017\343\231\354\0369>\344\333k\030\301\351B\177\272\265n\020\325\210\020[\307Y\333M\016Z\356\273Q\027\260\36018\205\364\200\005Fe\027\330\3443\035\216=:!*\262#!\324\241\254\257\002v\210\t\273\237\213 \270u\322\353\373X.\361X\314}\325\217\336f?Sa\273\016(\313\016\337\224\021J\321\367\263?\265\242\353\371\223\007\255-\016\223\356T!b5\234\221u\3063\\'_`SB*\214K,\217>\231\2725\317\t\235\364d\021\222\303\257 M\311\260\376\305\033\366B\323\b\326eC\242.\276\241b\004{E\220}\335HQ\366\020\331\203\027\274\325\275\240\276\\\3708\262\006\020g\301\340\264"
+	.string	"\342\tg\225\317\342&8\004^^\355\030d%\001u\0208\227(\237x\327#\363\245H=\366\2446y\226\004\254\3212\2322\202\026\313W'\005\264\354\213;\335\211~ ;=\f\236Y\273T\347\243\343D\034\336\237\3768\365\003\253\t\256\024\225{n\301-\027\356\342\236\351\022\342@\354Q/8E\322\227n\215\350\272\036\035\250\200&\266\357\235\327\031\027\271u\356\235\001\362o\337\254\3269^\337\020\333>\254;\022\215J\357gZ\007\323I\020\270\3159\316\300\363\2679\330\200\273\334va\007\205\336T"
+	.string	"\303P>\342\0372\236\245\213\355\255\034Iu\227\200-\344\002\265{\r\362x(\2024\357_\203 >\337\227\333\013\245\323h\324h+8<\345\013!<\235|:\020\177\304\206v\246\203w\244\272\231\211\302LJ\3575\006\024\246\303}H\005\3765Rc\353l\235(h\033\267\252c\001?\372\310Q>;\231\323\324:\327#\303\313\313\203Z\330\220t\215&(a\030\214\225\202\021)\031\254\320\005\017\234wS\222H\214`\r\357l\324\224M!\277\246\203p\344\251H\343\377M\336\205\023\212I\003\325/QBD\373\325\257\361\231\265\322\225\031k\tkZ\2704.\223\234\245\242\013\301A\021\023\332\016M\"\245(LO\221\n\b_L\273\277\264q\326=\242\220\206\213\225\331GB\266\362\f\016\370\372\321\223m\221{\222\261\bR`\347bK\006\275\224\200y\200\237W\337W\243\217^\022\255V\252"
+	.string	"}\221\200\221}4\2401W\025==\330l\307h\376{\310\320\177\247\303\270\377\267\215;_\375L\201\027>\001\001\202\022c\003\365\367\212\262[\331\277j\316U\246\332\256\300\033"
+	.string	"X^s\206\207X\017U\300x\272\222\257A\336\2042\375=6\031l\332<\300\276\341\3479-C\261\0039\326_\320\314-\214\005\250\026\336\032\022\037\374S\225\024\371\340g\230\033@\r\"'\375\"\231\005\313]\366"
+	.string	"\306\364\036a\320\357\323~\204\341\214\377`o\301*F\227m\214\363H\031\323\031\270N!\314.\340?\003\331\007\320^\bl\203\213\221J\\\310UBx\266\374\210\320\276\365\242\024\005Q\3070\352\030\334\327\035\217V\3255?"
+	.ascii	"\254\215\244\254\341\022\211\025\3512_\343\254!\373\244q\247"
+	.ascii	"\210a8\246\230A\233\212\033g(8\026\330\227\233\350gE/\260\013"
+	.ascii	"J\017e\374\201\"\016\3669\230\001\340g\211\353\031\352i\214\023"
+	.ascii	",QZ\0272\325)\245^\033\203)\224[\377\037\214\366\031\301M\354"
+	.ascii	"\225\013_\216\261\244\341\344\262\324\313\322\277\237\017\256"
+	.ascii	"p(2\3117\026\351\350\267\346\002}\355\370\007\365h\020_\314;"
+	.ascii	",'x\242R\366\331\177\f\027\257\327\267\272\017@\245\024s\266"
+	.ascii	"\037\267$\363\300\267\243\213I\036\264"
+	.string	"vQ\3019\f\026\204]\233F\036\212\005;\215\233[\344\243\366\365\017,\nu\242<E\200x\353\344\214t\364\2743\341\257\2119\372n\036\023\240[\350\273\266\317\275"
+	.string	"\331\345\006\352\347\272B0\3737|#\004x\225\342}\246\366a\0313\263\353\335\320\330\212\007\324%\254\336\256\244C#\363\374\031\002\276\3348\306\032\307\237[\257\260\315&\305\035+\250s|\023\225kBa~R\336Z\221\024A\265\013f\301P\221\005\023\241\023\322\023d\325\236\205\350\006%\301\327\242M\246*\027_7[\243\220S\255\334\311\374#\0048\243IrC\310\354\3638=_\223\370"
+	.string	"\236\215\335\206\322\356D\253\037+We\t\237\336\033\234\263\345\005\362\330\227\f\211\332\002[{\227\345\274~\252\313\326\372~\250\320\n&\311\227\235\341[;\202_\211T\232\337[X\\\2609\344\022A\006I\343\347i4|A=\222\031\207R\200t\202\024\275\300\324\t%m\314\315\035\321\274\\\206L\334\006S\007e\230c\255\365\r}C\t^\311\275D\023\217\320!{xj}\213\374\367\374\343\263v\221_VO6Kzq(c\317\220*\247\302\235\300\021\021\276\260\002\177G\217(3v\320\260$f\324\016\006\214"
+	.string	"?\006\"D|\366W\022i\325a\007t\220X{tX\270\007\224\341q\263&\343\220+}E@\322\354\321\323\364\374\271\301\370\266\317\250s\352D;;*:7\023+uX6\231c\307\2308S@5\321\223\205\373U1\321a\023h$\360\230\374^\223\311\243\017:\021\257\256\244\272\177\207\370\366\230\330J\031\304:\036@\307\244\320\211W\227g;\026:\234&\3530\251\fQ3\0376\0130\\xSpf?y\004:\3604(iA\367\3024\310\013PY \230\321u('7\322=\360\302\323\246\267\037*\322<91g\204j0\315v\321\275C\fJ\271\021\016\234\013\301\033\346\367\034(\227(:R/I\300/\025\306\005*\211\230R\3423\022\"\3778\035\324A]\246^C\217\267\221bj\b."
+	.ascii	"W\375\031@\255\206\353\371\003-\257=e4\001\270\205*02{YE[\030"
+	.ascii	"`\0044\227"
+	.string	"B\013\203\262\200\366\334\314}L<FA\360\017&n\251M\344,C\311z3U\221\260\312\214\304\337947\344H!\244\361Fl\021GM\025\\\260e?im!W\2733QH\233\236\374\025o\210\370>\210\203\274\215O5\017\003\277*\006\017\360z=\367\325[Y\212\375-\302=mX\364\fsJ\253L\323\334\273qbiK\300\276{\353\346\350\374\305\322\351\021\234@\237\326\231\301\262Cb\300\323\251\316\216C\356\226\222$i\004\322\261\375m\306f\326\234\021\347\347\325\300\202S\300\251.\365\310\310\320\364\212\205\3420\204\"\213\331\253\301\206\3405f\036zR\037\256M\367\232\264\220r`r\376\031\204\351\321\212\267\303\206sl\330\\\362\031\032\3006\263\274\262A\202\221j\352\337g\243\337$\243\374\374\027\002\233\316\251\230\234E9\241\2044\005a\016q\3237\204\205\255\220b\343\326\002\314f\246\232\273)\3360v"
+	.string	"\032#\031\262\232\fI\004\276\r\300C _\377\np\026\235\230!sU\013\006\322\024\220\b\203y\271\225\252\322\032B>\024\312\317U\355\222h]V\203\342\rCeD?g`O\253\005r\265V\f\245\257@)a\265\325MY\025k\027\223/\2163[w\341e\273\254qJ\314\332\3534\027CHc}\256\002\021fD-\247\303\"9\213\340`W\234.\273\034[P\244!\346\240\304m\373\325\314\303}p\325\221\n\230\265\334\3445\262\275\021,\361\214}\372*\346\302@)k\237\240bC'\233j\f\276\301z\330O\350\331Net\203 \317\002\200T5-\3460tbKp\274\363\272\262H\f\177y\340\366~j\355\005O\312o]\022\2615\263\356Lz\002bd\310\260F\241\243\355\211\216 g\342\005\200\255\322\317\020$@7\001\211yk\007kfV"
+	.string	" \245\356\001\313\373!j\024#\033T/.\275C_;\354\214\370:#?B\237\325AT\206rS)}[\374"
+	.ascii	"y\350>S?\344g\276G\373K\267\005\240\34032B\327\003>\377:\214"
+	.ascii	"c:\036\326\r`%(|q\3565\200\200<H\240N\324+Um\200xl\033\020\342"
+	.ascii	"e\006\254\267?4'\272\3140\2308*\340\236\242\340\003u\266\376"
+	.ascii	"\334\342\331\373\314\007\210\262\272\302=\3006\0060\277\265\274"
+	.ascii	"\347m\205\347x`~1\317\364h.Z74#\3461\271C\202@\312\224`\275\321"
+	.ascii	"1\242\354\030\316\r\361\253\227C\233\314)\216\266\364\177\215"
+	.ascii	"\2139\t\3523N\376-q*\376}\222(\215Y\005\2759\311\330\316\202"
+	.ascii	"\223\272|@\215O\247a\t\024o8\003\255\330\336H\221\360\037\002"
+	.ascii	"~rZ\nl$\312\202c"
+	.string	"\242r\211-_\340iQ!\307\350FU,\302\031\272\344\036\207\347X\363\370\326\320m\231\237u9\353C&\347v\370\b7\335\027\bHJ[\f\021\374*\236&>\f\247u\247\006\306I%s(H\351\026\333\366\"\003d\020\"\036$*\n\211\350\311\226\277\254\331\f\031\321\027\006\310+?)\037x\301\226\354i\356\216E{_\231c\203\027\332k$V\266;}\271\321W\036D\325\nGf\326=\032\237\020{B.\230\243,\217\246)\366\023xN\373\362'Ex\270\353\220\343\363=\003\243R\277\337\231\342o\017,,2PI>8\031\n(\034\327C'1vG\243\007\216\347P\370@0\003;B\257\346L\241^\n\241u\326$\300t\021\361\023\361x\356\013;\230\212\320\206=\360\003Z\\9w\332u\363\003\215k(\302q!\204t\226z\376\364\213a\352@k\220ie\321\037\"D\205\275,t\315q\240w"
+	.ascii	"\261?\356\363yi@\253?\210\227\210\216\305\275\021\303,y\260\203"
+	.ascii	"\310\363\017\263\354b>\253\013\026\311\3716h\016T\002@RU\275"
+	.ascii	"(\314\024td\375\030\373?\224\352U\347\352\b\020\344\236\026\021"
+	.ascii	")g^\020Ma\234\361\347\370\352\300EID\215\022\016\326/M>\321\034"
+	.ascii	"\244q"
+	.string	"+\220\373rZ\313\r\252\261gWP\215.\b\310\314\253\220\271\345\021B#\024\224w]|\2166Gde\030\254w\236\236\242\002\346T\370\347\367\023\212\313\361\006\373\201\371\334\364:@\332\017\025\230s\301B\314\267\2008\333\235\371R\361\264\340\266\003\236\316\2077\033\241b\004\350\201=\312\237\237\231\276\277\304\367\373x~\221\371\200\340o\342\034?\307c\226\243\334\036\251\275\304|\227\300C\256\315\357\372\3156\353]\273\215\276\347\363\303\310\007#\357\263\031\276G\232A\305\217\220\375\301z;\260\2279\360{\243k\324?9M\354\270]>\253\335\f\357\375z\216T~\204{\263\347w\322?\035\253\217\371k\354\rq\355q\370\276\355`\270H\260S\351\237\221\007C\22364\366\241W\246\312\376\325|\270i\243\236\301\375?Yf\300e\037\334\2500\353\342`\321>\376\313\343:oUY\262\253\276J\230\254\320\351\t\261|B"
+	.ascii	"\366\274\355\036s=\241\352\335V~]\264>\247N\371A}\231X\262\354"
+	.ascii	"\227%\352u\275\305\354?\237K\276\374\267\302\177\325\203\274"
+	.ascii	"\2515\307\310\032kb\224\275\342\211\001d\346\235\332\341K\023"
+	.ascii	".\r\027\311\313\342\0307\232\215\322\036(\376[3< \31653\236\031"
+	.ascii	"#\357\243\302"
+	.string	"t\203\021\363\356\311\\\214=L\"<M\232\035\250\227\327\275\020\002\360@\336\355\210+E\037\206:e0\276\345\236z\237H=\031\243}\305\353\272\225\367\r\330a\337\265z\343\330\357\264iU3_\334\247*\305+\002t\177\207\025\264\377DN\264d\354"
+	.string	"\212\361\206\244\031\226\376\373\310\273^\340\246\2675\3746Z\375\260\323\226+\005>\217~\177j\240\020\243b\335V\252i\330d\n\324\337U\035\347\346\222g8;\214\213j\371\034d\356\234l>\0351\352o\360\253>Bu\266E0\302>\267W\350'\244&\006D\375%\255\275\320\353\272\340W\261}\224(\307\0228\t\237%\271\237Q\243^\244\374\211\276'V\331\016\266v\302@\306Ao#\367\n\243\233\310\271\204\235\223\210\263!\321\005\365\216\201\376\177\246s\375\372\023\022\177:\304k\030\334\0072\277\277\352\347\334yj\214\374\217\255\347~\304\337\024\316\373\300D'xG\331\317\202\020\334\353L\243{\347\0172\276\374(/\244\210\317\277&J\365!p\233\202t\372\3447\321\247\273\306\203\267\\n\371z\250}\007\307\231O"
+	.string	"\373\331\353Y\3751\375;\235\361\321~\341\323;\303!\275\2343\340Z\213\236_\261-\250\317m[\033\231\231x\350\371gV\350\310('\346\374\300\210l\t~.\273m\261\035\013u+\257\253B\247\006\261\342Y\376\317#\317\357\255;\177\372\204\017\326_\032ds\315\377\376x\3529\017\255\376\213\271\025t\fm\341\211Q?Zy\244Xo\023\033\024\343+\021'i\364\204\371a\314\367tk\001|\330\313\375\230]\177\265\312\357\017\3566\324\207\226\236k\\\013\371\026\207\377MZc\3367\304\203\274\2416\274\tb\242+\262\027\354\230\337\217\317\271\225\017\265\207\350A'o\240o\224~\320\341\214\f\277\211\225\301\224\267\304\217\001t.\217Y \257\234|\213\177\031\355\236S\252\303\337\177\36187\346"
+	.ascii	"\215\227dM\236SRl4\306\346?"
+	.text
+	.section	.gnu.lto_.symtab.518b89b757251988,"e",@progbits
+	.string	"eepromData"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	""
+	.string	" "
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\002"
+	.string	""
+	.string	"lockMainPID"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\004"
+	.string	""
+	.string	"sendMotorUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\004"
+	.string	""
+	.string	"targetParseArgs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\002"
+	.string	""
+	.string	"systemReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\004"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\004"
+	.string	""
+	.string	"ledInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\004"
+	.string	""
+	.string	"timerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\004"
+	.string	""
+	.string	"timerStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\004"
+	.string	""
+	.string	"failureMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\004"
+	.string	""
+	.string	"indicateFailure"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\004"
+	.string	""
+	.string	"nanos64_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\004"
+	.string	""
+	.string	"micros64_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\004"
+	.string	""
+	.string	"updateState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\004"
+	.string	""
+	.string	"millis64_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\004"
+	.string	""
+	.string	"micros64"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\004"
+	.string	""
+	.string	"millis64"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\004"
+	.string	""
+	.string	"micros"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\004"
+	.string	""
+	.string	"millis"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\004"
+	.string	""
+	.string	"microsleep"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\004"
+	.string	""
+	.string	"delayMicroseconds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\004"
+	.string	""
+	.string	"delayMicroseconds_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\004"
+	.string	""
+	.string	"delay"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\004"
+	.string	""
+	.string	"timeval_sub"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\004"
+	.string	""
+	.string	"motorDevInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\004"
+	.string	""
+	.string	"servoDevInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\004"
+	.string	""
+	.string	"pwmGetMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\004"
+	.string	""
+	.string	"pwmEnableMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\004"
+	.string	""
+	.string	"pwmAreMotorsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\004"
+	.string	""
+	.string	"isMotorProtocolDshot"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\004"
+	.string	""
+	.string	"pwmWriteMotor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\004"
+	.string	""
+	.string	"pwmShutdownPulsesForAllMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\004"
+	.string	""
+	.string	"pwmCompleteMotorUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\003"
+	.string	""
+	.string	"pwmWriteServo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\004"
+	.string	""
+	.string	"adcGetChannel"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\004"
+	.string	""
+	.string	"FLASH_Unlock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\003"
+	.string	""
+	.string	"systemInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\004"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\004"
+	.string	""
+	.string	"FLASH_Lock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\004"
+	.string	""
+	.string	"FLASH_ErasePage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\004"
+	.string	""
+	.string	"FLASH_ProgramWord"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\004"
+	.string	""
+	.string	"uartPinConfigure"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\004"
+	.string	""
+	.string	"spektrumBind"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\004"
+	.string	""
+	.string	"_Min_Stack_Size"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\004"
+	.string	""
+	.string	"_estack"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\004"
+	.string	""
+	.string	"timerHardware"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\030"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\004"
+	.string	""
+	.string	"fakeAccDev"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\003"
+	.string	""
+	.string	"fakeGyroDev"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\003"
+	.string	""
+	.string	"stderr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\004"
+	.string	""
+	.string	"optarg"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\004"
+	.string	""
+	.string	"imuSetAttitudeQuat"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\004"
+	.string	""
+	.string	"fakeGyroSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\004"
+	.string	""
+	.string	"fakeAccSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\004"
+	.string	""
+	.string	"quadModelStep"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\005"
+	.string	""
+	.string	"ioHandlerAcknowledge"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\005"
+	.string	""
+	.string	"ioReactorRun"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\005"
+	.string	""
+	.string	"udpSend"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\005"
+	.string	""
+	.string	"fopen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\005"
+	.string	""
+	.string	"fseek"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\005"
+	.string	""
+	.string	"ftell"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\005"
+	.string	""
+	.string	"rewind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\005"
+	.string	""
+	.string	"fread"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\005"
+	.string	""
+	.string	"__errno_location"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\005"
+	.string	""
+	.string	"strerror"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\005"
+	.string	""
+	.string	"pthread_mutex_trylock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\005"
+	.string	""
+	.string	"tcpSetBasePort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\005"
+	.string	""
+	.string	"getopt_long"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\005"
+	.string	""
+	.string	"strtoul"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\005"
+	.string	""
+	.string	"strtod"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\005"
+	.string	""
+	.string	"strtol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\005"
+	.string	""
+	.string	"quadModelConfigDefaults"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\006"
+	.string	""
+	.string	"pthread_join"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\006"
+	.string	""
+	.string	"ioReactorStop"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\006"
+	.string	""
+	.string	"clock_gettime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\006"
+	.string	""
+	.string	"pthread_mutex_unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\006"
+	.string	""
+	.string	"udpRecv"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \006"
+	.string	""
+	.string	"nanosleep"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\006"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\006"
+	.string	""
+	.string	"traceIsReplaying"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\006"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\006"
+	.string	""
+	.string	"ioReactorAdd"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\006"
+	.string	""
+	.string	"ioTimerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\006"
+	.string	""
+	.string	"udpInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\006"
+	.string	""
+	.string	"quadModelInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\006"
+	.string	""
+	.string	"pthread_create"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\006"
+	.string	""
+	.string	"ioReactorInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\006"
+	.string	""
+	.string	"pthread_mutex_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\006"
+	.string	""
+	.string	"traceWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\006"
+	.string	""
+	.string	"fclose"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\005"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.518b89b757251988,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
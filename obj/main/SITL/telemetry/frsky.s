@@ -0,0 +1,1593 @@
+	.file	"frsky.c"
+	.section	.gnu.lto_.profile.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375 YM\002"
+	.string	"T\003U"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\007"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	"\013\r\016"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	"\022\023"
+	.string	"\027"
+	.string	""
+	.string	"\030"
+	.string	""
+	.string	"\032"
+	.string	"\033"
+	.string	""
+	.string	"\034"
+	.string	""
+	.string	"\035\036\037"
+	.string	""
+	.string	"$"
+	.string	""
+	.string	""
+	.string	""
+	.string	"0"
+	.string	"\007"
+	.ascii	"(!\\\302\200\313q\206]\302P\342\236`.\001"
+	.text
+	.section	.gnu.lto_.icf.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375`\303\002\035\021"
+	.string	"\206\027\\F\360r\2351"
+	.string	"\305\246\242e\325\t\f\376(\004\334\246\270\256\300\303\354s:\330\3132\031\254\231i\215\256,D\301\001{\016\213\303\342\2608,\016\213\223_2'\315H95\274\357O\242a[\222$\"{\345\312\315M\002D"
+	.string	"B"
+	.string	"L"
+	.ascii	"\3710\327I\002"
+	.string	"\301\347\203\307\237eax\225\\\333\301BN\253\257\252\230-\025\236\355\356\357\277{\337n\337\275;\346Zh\311\252\337\213\024\221\023\256\276\376`\n\023\261\024\356\377v\355\237eq2\241\320B\032\327\n\343\376\336\307\337\376c\217\304\353,m\361\242\370g\2369\250\326(A\301\202\230\2636\271\001B\312`\266cn\177y\376\345\366y\223\245D\035.\226\343_kIg(&}\257\037>?s3\017\247\2160\f&\001\233q\240L\020\003:\317\347|\263\221^'J\001\337\t\032C\003hn\251\242\032\001\020\216\230[\231\340\022\221\034\312G\213\363c\267\026\371\200V\360t\362s\266\327\217P\316Fp\302c\035\223\221Zm4\373;<\3369\003\311\212C\032\036\241d\252\007\016\310\223\327\006l\205F\003\215M>r\2040\270'a\003+\304\202C\350\2212\025\324\025\"J\322\320\227\246#1@\tN\276n\027\\\314"
+	.string	"A\200G(\231\352\300\347\237\252Iv\300\320`\240\300\375\335\337\235{\306\217$v\225x\004R\250q\235\200!\002e\020IZ\320\302\032P\202Q\254\3126\022@\005\222\304<u\304L\373\337\001\027\330\007\332\"\033\201)\273\216\326;\315m"
+	.ascii	"\262nw,*F\001\"\252\266\347\207\023\303%Q@B\177\nD\r\257H\350"
+	.ascii	"\237\006\344\217\201\322\326'\273\307\277\202v\223\203\320\024"
+	.ascii	"\335n\230\354\232\262f@wP\314\340\317\004E@\007\371\346\217\263"
+	.ascii	"b\f\002>\2659w\263\334\244N\244=X\317\0217L\371c7\276\340\223"
+	.ascii	"\324\361^4\223\343\216\264.\253iY\271\024(\325`\221^\256\201"
+	.ascii	"\357!\345F~\"\013\323}\332\034\344\021\303\f8*\323i\274_"
+	.text
+	.section	.gnu.lto_.ipa_sra.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375`\336"
+	.string	"-\005"
+	.string	"\344\003\322\001"
+	.string	" "
+	.string	"\002"
+	.string	"\001\002\001\001\002\004\007"
+	.string	"\001\b\001\t\013\r\016"
+	.string	"\001\020\022\023\024\025"
+	.string	"\001\027\030"
+	.string	"\001\032\033"
+	.string	"\001\034\035\036\037#$&(*"
+	.string	"\001+,\001\003-"
+	.string	"\003."
+	.string	"0\001"
+	.ascii	"6 \320\202\321\232\016\224\342\276\222\325e\213K[$\232\340\001"
+	.ascii	"c\\\3348\025\321\004\342\320\300j\307\204\n\301A\016\346\016"
+	.ascii	"\333\307\016F\356\b\223\341\344f\007\002\"\303\310\235p\f.\316"
+	.ascii	"\n\370\027\215\236p\333\210\260a#\303\310E\302\366\271\203G\367"
+	.ascii	"!\2649s\261\035aQf7l\204\235u\340\216}a\216hs\b"
+	.text
+	.section	.gnu.lto_.inline.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375`:\te\031"
+	.string	"\326\235lI\320\360(\0350EoLZ\326\372\0341\213J\360}\226\261\203\265oD\027Ht\356\263\315\300\3649x5B0\003\0069F\030\376\333A\030\344j\203\324\213\306\002M\340\217\222C5Z\230\231i\313\032\302|\200|C*\331r\247O"
+	.string	"U"
+	.string	"_"
+	.string	"1\212\313\315"
+	.string	"J\271\212\337'\273\311\036&\313I\226\240m"
+	.string	"\365Est>\334\234\32661t\024P\376L\226&K\020\320\206\331\265=\302\250\207\3673la\374Wy\275\r\350\177Z\311~\355\377\227\250m\223\235\236\236\261\275\371i%6\313\241+6y\032\266%3:\364\177\305\037\266\370y~\354lq?m\\\233\306P\336/at\351\263\305\351\312\252\242\035\316\217\301\362j\272\020\237+\313\225\265\200\366\314\340\260Y\327\027W\230\005:\022\302\371\374B\003\355\b6\230k\001b\216\013\301\305T"
+	.ascii	"\216\373\300\035\236\001 (\013\270\211\370\tr\331\341\301\335"
+	.ascii	"H`\225l7\374o!\375Oq\200\r{NM\2438\"\032"
+	.string	"R\031\3610\310 \251\250Sl\215\376\213\324\323+\264c\364\200\203M\372\357\242\217\244\004.\251\306jS\324t\036X<b\307\226F\206F\203k\2667\241[Q\213E\237\377!2\212\344\220\221\253\004\266m\021j\232-GDc\325c\263\321K\331\205,w\265\362E\253\003\207\013&N\3542@A\237\002\004Z^\333\341\226=\311\322\244\302+\025t\202z\bj2\340\2340\211\2522\201gDM\b\333\034;;\\\350\224\335\017\013\031\224\034\033\317\002\213Of\314\316\374\037\340q\305\177\024\233|\357U\200\255\250\321\2552SR\232\024jLc`\"\"sU\335\022\300\263T\001\321\021\242\210\320\031(\220\221\300\202\231 A\013Z\224\026\0031\311\322\323\036bsfcj\324A\331v\r5\021\336Q/92K\340ml\260\306\363\322\020\316\357\254]\003\216\324$\221\247\277\325>\220x}MS\031X\031\316\242\351"
+	.string	"\361*\371\222k\312\202G\034\2246\242\333\221wq\220sf\005\354\376\355Z.2\244\"\227\373\243\266P\030v\310_\234\307\"\0078\373T\223V^n\007\343R\264\303\214@\266Q\032\330i'\021\373\231u\003\370\265[\023\f\221\354\264e \262\013\016\223F\021\233\215\325h\327\002%p\341\325\035\023\374\n-\361\232\007X\233\037\215\345\246y\206\375B\002\332\374\r\f=\216E\265h"
+	.ascii	"M\3600\332\3443\222\262\335\214\322\200\257\342\177U\366\266"
+	.ascii	"\204\tS\347K\301\307u)>\207B\007{\323\2474\231^\255\001=]zK\004"
+	.ascii	"\320\220]\207\245\240\020\372\275xr\261\204\023\312)\367\333"
+	.ascii	"\022\255\246\024\363\275\364\317|\212E%H.'\037\246\220\362\f"
+	.ascii	"\fI\"\331J\257\t\221\244\256g&\003\365\337\300\372PNs'\233\016"
+	.ascii	"\rg\333\373.g\263\223\337A\346N'\245_d\250\227\266\270\271\215"
+	.ascii	"\235.\341\241\232\250\317C\337\216\340A\315\032\005\315\307g"
+	.ascii	"\3300\004\317\245?+\0348\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375`\306\t\255\023"
+	.string	"&\024E7P\205Lc057\341\"C\206\344\276\t\323\211\363\021D\314\314L{)\021\210\314>3\307L\f\273Y\257\215\254\325\354w\272\243\347\273\365Pj\274y@\022\271SJ\001/"
+	.string	"5"
+	.string	"<"
+	.string	"\006e\r\312\333\277\347Dc\255X\313\223\342\341\236\025\362\215\321\016\362\235\004m\254C\317\307W\035_nc\347s\263\277}v\237\022\373\365\032q\005\"w\322\026\276\033&\277\201I\206@\n&\023\303\354\361\004p'\333\221\007j\265\220;\tr'oQ!~\371_\255\034\276\002\336T\251\274I\243\271\032\362o\037\016\034\020\334\234N(T*\365-\"\321H\2111\231.=\200\270\245R\331l\276\217\3434\232\317\307\031\266\3142\214\215i\226\264Y\021\237q\006\233q\357fW(\224L&>|\341r\016G\365f\333\326$\t\3030t\027\332\222\2074j\025\022>A\240]~C\365"
+	.string	"\333\373\036\001H\264\334\357\276\347\201\276\255\304\200p\271`0\026\340T\307b\341p\272\030\003\200\273\250!\3015\222\244\220\2555\300\002\t\210\2526\007\022@\001r\b\3030\fB\f\021\302\b!\204\210\274\240 \265\354\254\001\361\240\251\031y\337\004\371\254\243\233)\034C\021\226\240h\255h\234C)l\2236=f&\310\274\n'\361w\203\363\257~\t\253I\317O\223\334\276\304\344\331=\346My\332\217`+\227r\217HO\266\207Zc\r\324\240[6\311\t\332a"
+	.string	"\255\354N\210\354W\343&\007\263e\207"
+	.string	"\347T5\353\347\364lM-8)\243\261\316\255\217oa\323\327.\361W\251\325z\264Dk\225\302\033D\333\227"
+	.ascii	"\251\301\005\205_p\242_\333\271\251\365Q\272B\270\224wJc\372"
+	.ascii	"Q`S\276\325\257\346c<\304C|\250\220\017]\215\343\261\217!c\200"
+	.ascii	";\310\212\006\224\303\216\rTYD]C\240\206\376>\0028\331H.\365"
+	.ascii	"\006]T\277\026\254\256\024\256\343\347h\230\005\026=D\253_\t"
+	.ascii	"\b\254\270e\026\"\302)\323\215\214\314\001f\n\271\310t\237\372"
+	.ascii	"1x\371\034W\302\374\207\354]\201X\215\030\342\233!\261\306\003"
+	.ascii	";\n\354\347`8\324\261\322{p\267\024\021\233\274\237u&\376\303"
+	.ascii	"\007^\345F\022\201*^\\y\255T\216\203\256\256\023\203c\201\375"
+	.ascii	"\267\246\0179\363i,\240\317V\261\266\257\024"
+	.text
+	.section	.gnu.lto_.pureconst.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375 e\205\002"
+	.string	"R\006\023\034p\213\032\003\005\016\257\376\177UUu\221\360\277+\223\353\237l`\033\335\350b\322\032\031\376p\207\254!c\370\302\025\236p\204\037\334\340\004\037\270\300\003\016\360\313-\257\234\362\311&yd\203\374q\307\033g|q\305\246'F\256pw\220"
+	.text
+	.section	.gnu.lto_.ipa_modref.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375`\025\002\345\b"
+	.string	"\322\312\037%pE\032\016\204N\377\377\377\377\377\377\377\377\254\326Z\227l3Mt\211\022\370c\361\231\211\317\017\2001\222\020)S/\227\365\2232cEMP9\324.a\345\230\003\220D\f\032\344=~\347x\362W\245\301(\370\354\341mA\305\225\330!@\374@\373k\017\374\031\376\352l\355V\3330\177!*\217\332gUNu\272N\246\234\251\262\314\251\354?\316\223\\\240\\b@\271+\177\302\301\275\2554\001K\250\021]hi\n\nu\253\001\220\002\0312\253\007\021\300\021\"\020\325\fQA\2623\007S<\247\222`\303\340\2766\205\332\2748\321k\2341(\211\365\374\340n\252#h&^u\017\177 \230?"
+	.ascii	"\257\345\257\307\031.d\220\t\355\324A5P\3239\352\260\372Y\001"
+	.ascii	"4\235\212\227b\352[\264\232u\217\306\005\270\2460d\371\\D7\260"
+	.ascii	"s\024\277B\021\204ZpA\265\340#\331\236\335\023\277\003La\037"
+	.ascii	"\017\213\006\305\034l\265\304\3249\2463\257\1779\315\377\006"
+	.ascii	"\303\006\301\337\373\2712\003"
+	.text
+	.section	.gnu.lto_.lto.8b31529782867c45,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_serializeFrsky.97.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375`S\001\255\r"
+	.string	"&\231ZC\020\221\223\016[\311\330\203\245\343\332\203\351\366\270>\360K\245\017\002\256\371\334\376B3\364\364d\305\375Mwk}\267\fX"
+	.string	"\332I\344)RUU\273\272\256\341\371\211\206\310db\303\300\376f\311\336[\312\224\002H"
+	.string	"B"
+	.string	"I"
+	.ascii	"\334\207\265P!PT\350\330\335K=<t+\302\247\031\362\237\372F\333"
+	.ascii	"D\267\2425*\207\0308\333\205|\037\233\312\365\201\234hl\b\260"
+	.ascii	"\225\236\200\325\312\215\247\236\0316R\246\325`w\235\332f\272"
+	.ascii	"5\267Mb;\201}\020\0016J\271\303\346D\251(\373\332u]ge\261\337"
+	.ascii	"\362\303L?M\253\246S\323\007\3601\263\002\211\331\325\320\315"
+	.ascii	"\254\n\302 a\373\034\333\231\266\202\005\241\267\234XwO,\\\354"
+	.ascii	"r\b|@s\350\220\215\343\001\327\254*\262\214\314J\f\370R \245"
+	.ascii	"F\276\310\261\352\360b2\310\024\251\3512#\246_n\031\321W\033"
+	.ascii	"(\251\310>\367\023 _\204-\230\344\265C\337$\036^\325\344b\202"
+	.ascii	"\303(\273\217\320N*U\224a~\022\241\016H)\201\"\235O\347\301\263"
+	.ascii	"H\bHBI\006\341\002e\037l\004\233\200}.\222\b\235\221K$+\271B"
+	.ascii	"\b\330C\001\313\256\217\307\223]\034n\377VY\034\360P\215\224"
+	.ascii	"\364vw\255\247V\250O\217\322c\224\335\nU5\301<\206\224j\0217"
+	.ascii	"i{*d  \320\202\021\301\362\223C\313&\360\336\025\264B\240#3\016"
+	.ascii	"/\\>\254.[\200\024\201\373\267\372\256d\"\017\260\025x\031\367"
+	.ascii	"6\330\023?\261\267MNb\326\265i\307V\335\344\360\221K\223I\025"
+	.ascii	"\233>\307>\362j\\c\017"
+	.text
+	.section	.gnu.lto_sendAccel.99.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375`4\003\225\027"
+	.string	"&\255\227F\300\330*\035$p\243\312V\254\321\034\273W \221o\347\265\030\004(\314ME\377\337\016\017\037\337P\201\3551\373\215]\023u;\334c\231\202\350\272\256\262(\241\363[$l\335\207\345\261\231ti\312\006\322\310&R\246\024}"
+	.string	"{"
+	.string	"\210"
+	.string	"\322\277q\034\366h\021\327Y{9s\316\361\322\026a\217\227\372\035\217~\215\333x=\347!\"\314\204\270\343\226\3047\347\214\271t\002\361\262\300O\341%\370Rx\351\227-\345\272\027\023t;B\343\2612\347L\255\013\357A\335\r\352\353\022\\}\371\n\303\247f\203]\202\2449'"
+	.string	"\333\bP\201\222\260\311\024\234\201\342\373\235#\320\351\325l(\256\240\007sNk\315v\342\016o{e;eo-\373\005\241S\205\366\213\351\317\356\234\023\266{\263u2\375\347\266\260Cj\230\220\372$\325\246\222\250~\221j\227\357nR\313s\367HT\217\241Z\024\252C\241Z\224j\020H\035\206j)\325\240T/\250VP\375\001#\257\211L\2219K\374d\231L$/\306w\177\356j\337\337\361\235\317\303\243\275`\346\345\272\316{\242g\305\345\363,\230q]G\bq\312"
+	.string	"\355n=|s\352P\342\003\242\r\3003\243!\256\334\320~\206\004\264\342J*3_\270\240=\3557\341F(4xbWx\021\0133O\210\204\333"
+	.ascii	"J\016\\\271Je\346\263\275\341B.\3108\2601<H\206\003/\346\234"
+	.ascii	"\f\200\234\247\301\307]\232F\245\n\277\363\030\026\275+\274]"
+	.ascii	"\303\370\300\254\366\244\310\211\251\225\334CB\237\326\005p\026"
+	.ascii	"f\337\307\177\334\3708\327\330\350k6\341\345i\217\343\312\373"
+	.ascii	"q%Gw\367=>\360\020\341W\367\263\0252\375\361(\255\327\3344(\227"
+	.ascii	"\315\007\326\206\224\213\325R\335\2508\250Z\251\0165\032nR4\254"
+	.ascii	"\017)\024\001\257<\250X\251\326j\305J\215\272\330?\267\205!\004"
+	.ascii	"a\022[\231\334\233A*\266e\267\207\306|\264$d>\332\303\310\021"
+	.ascii	"\005G\261\034\004\235\340\243m\001\247\350\364f+L\2455\255\b"
+	.ascii	"W\205\366{\331\2228\356\313\002\300\365f?\001\352\262\376.\202"
+	.ascii	"\004}\215\264.+\3029\241\375\306%\355y\034\205[B\373\211v\334"
+	.ascii	"\367\314\224\370\034\213M8s\306\f\2046> P\002Q\312l\036c\241"
+	.ascii	"}'\006\222P\206\310\256\030,\325\337n\023c\35258D\013\031\304"
+	.ascii	"G\037\267C\001\335!\342x\016\251\305s0F\252\340\tt\003\r0sW\340"
+	.ascii	"\312\213n\264\326.\306\"\311\3627fP\336\305\261\330\306\317~"
+	.ascii	"s\245\320\035K\320\342\353\2300\356\003\233)\232\343BS\217\225"
+	.ascii	"\336\355\300+\201\327\331\2608[\240\246\030`\246\315rU\037\003"
+	.ascii	"Q\376E\210|k\213\354\371\031Im\t\362\205C\004v\221k\241\217\341"
+	.ascii	"\237r\347zO"
+	.text
+	.section	.gnu.lto_sendBaro.100.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375`\267\002}\023"
+	.string	"F\243yG\340\320(\035+\307\223\235 [\026\2546\t\224\322S:\002\016\352\230\201\031\260\034Ok\214\346\3703\030h\300\037?j\016\226\320M\213,\005j\216\034\322 \247\030\244X\304\205\301\257\250\002\323\365)\032\255\221F\366\2262\245c"
+	.string	"["
+	.string	"j"
+	.ascii	"\366\247B\262\034\334G\274\346\337\370\263GHX+\\\207\225/b\204"
+	.ascii	"duZ\005on\020\221\230\331\2511'-\344\322\t\274K?\304mZ\016\302"
+	.ascii	"\r"
+	.string	"p|\227v\213\375]\306\317,{\306i4S4#\003\206\0234\347\0047\303YW\226\377\232\217b0.W\321\2029\2475\006s\341\336\3336`[\304\336\222\2455\201\227u\261\277s\036\026\177f\324\212>\266\322]\226\3666W[O\016YKs6\315\245;c?\316\225\261\243\332\324\251?:u)\252=^\273;\244\372\213jR\247\036uj/\252\273\250\226Q\035\245z\243Z\243\372\001>\240\237\023\2149-\344\204\346M\3324\274\366\333\327\t*d-\217\216\365X\322\f\367m\307\0366\344\355~[\232\321x\r\201\250i\375Z\211\003}\314\2779\003\331\3559]\323Za2\227\346\254\273+\002\033j\275\370\352\212p^\037\\~\360\024&\"1\354\223\243\b\017\320\3149\025\234\270-\202?\2734JJJw\371}\315C8\340<\330\230>L|\254\226\210\031\251[\334>\235\003\252\373\344\264JaIA"
+	.string	"W)U\250\022J\bU\340\004\024\023\025\360$\305\002\236\004\030E!L\201*\024*\005~\264\326\343\\\031\273\346\036\217\215[k]\006\321\220\177\030n/\353b\020%\255\257\243s\022O\314\255[\322Zc@r\273\035p\343\025t\237\307\225+\362y\331\\\230\234~B\004\267h\023*0b1z\317\355\255\360\3669\007\320\023< \220\002\241\301\352\006\262B\177MA\364\312\240\334\026\005\241,N3~\033\307\267\0362(\003\306](\231\242I\322\275\f\006\\th\324\006\243\307m\343\017m\3416\214=\306!n#N\326\b/\243\001\036\267\030\342J\234\222\205\271E\262\205\204$\253c\316\3134\304\2035r\372\205\375b6d\254G;/\226\027\365$^"
+	.ascii	">\0266\213&3pt\027\2618\230\350?\200\306\347\300V\034-\337\333"
+	.ascii	"\005tn!\320'"
+	.text
+	.section	.gnu.lto_sendGpsAltitude.101.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375`1\003\365\025"
+	.string	"\226\347\210I\300\322Q:S\0019\033Q\220\002\234\001J\376\263\016\211\227\347_aY'\3764\250T\234\342:J\252\337\277\336\360q;\247\362\226#\260n\345\3777\031\225\206\""
+	.string	"\204\316\025\0176\267\r\204@\304\366{\214\326\022Bb\245L)o"
+	.string	"m"
+	.string	"y"
+	.ascii	"\257\361\240\217\342B6i\234\367\314\200h\352\240\215c\223\007"
+	.ascii	"W\0172\351\233\370\t\332y9\343L\032y\210\250r\314\33139\350\223"
+	.ascii	"\361 \200\017\b\017\352\005\204\007M\263\243\336\373\231\242"
+	.ascii	"\356\007\017\321\324\234\263\\\021\247}\265J\363\305\025\326"
+	.ascii	"\r\247\363\225\207/\211\333Y\225\3149\037t\335\200\263\251\212"
+	.ascii	"+sN\353\r\327\341\006o\033\201m\025{\177\0020\376\356\240cb\372"
+	.ascii	"[,<\b\356\326\250*\301\253i\225\335\263\351\352\354\257\346\372"
+	.ascii	"\330\242\332%\252CF5\b\031\252[\243\232u\337=\212jQT\207\347"
+	.ascii	"\361\356\r\325\n\252O\300\325C\243\224\232\223C\325\217\351\004"
+	.ascii	"*\215"
+	.string	"\270\357\347]\355\377lr}\271\243\242\027\335\347\033\231\264S^4\233\" \033\237(\345e\363\241\233q\222\020}\272\243\276O\301\002\375m\\\326\266v7\306\275\321QvM\273\272@O<T'\267\213\311\265\252\342CND\315t/\205\016Y\227\354\254\216\375\030\227q\301\337\271\001\213\376\306\022\036\f\331\013]\225~=r\253\325\351\234Sg]\023~%\244\300\261\243>l;\370\213\232\002P.^H\240\226\276\342\216!?x\213\234\0036\204+Ex\265\234\205Ki\330\223^\f\374\3149U\220\276\"\263\303&\324\314`f2-\243]Pnbhd\024\312\033\331\f\026\203\311\300fe\005\230\226X\351\"\243)QH<c\001&+g33\262\222\354\325\276\232\353\343\377\350\350Y?'\304\320\024\245\340\356j\b\372\210\024\302\251\2666\022\304\210\232\334\377\375\367\0049'\021e\2116\304\317\270\303\247p\177\364"
+	.ascii	"?\030\271\032\b\271 \333\332\361h-\271\037u[\353\332Ie\240\262"
+	.ascii	"i\225G\224\265\001A\250A4\303\240b\312\210P \"2\013\013\035\200"
+	.ascii	"\002\0312\273\r\020PUB\243MZ\003\250\222\n=\201\"J'\347\201\262"
+	.ascii	"\330\242`\275\375\020\276g\"\345\365\263\224\236T\377J|\200\230"
+	.ascii	"\320/M\332\004;\307\004]Y\227\240~/Z\330\221\202\271\030\020"
+	.ascii	"~\026\355#c\221\220\375S\321q\256\267:\375\326\206^\215\0162"
+	.ascii	"\215VQi\344h\\8`{\227I\276\353\213\265\004P\351&3+\246\233\022"
+	.ascii	"~\032\260\374\332B\364M\251\375\300\350\321\003\224\002\375\223"
+	.ascii	"(\271\263\031\\\005"
+	.text
+	.section	.gnu.lto_sendThrottleOrBatterySizeAsRpm.102.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375`\303\004\025\037"
+	.string	"\346y\307H\220\232Q:\204\350\332\355}$:\351\016\324\226\342Z\323\005\006e\256\276\305\335\353\343\334\250\3719\351\300\332\376\376\221(\355\310j%O\\!F%"
+	.string	"\3407b^xV\033\2118\3358\370\t\360\310,f\266\021\262\t\2212\311\264"
+	.string	"\246"
+	.string	"\266"
+	.string	"['0\211\216\242\363%\355<\364%_\207b\335\b\323\253\026I\213i\367DN\334\027Y\331\256\321\202\335\255\234\316:e&\0212)\323\364\252\355\027V\202\324Z\233\366W+{i\264\240\351VND<Z\365ma2U+\021\301\313Mp\276l\331\356v\307\234(UM\0342\240\216\250\251\265\332\032\307w?MZ\222\315\273\275yDU\005\030\344\375,\362\007M\363h\353\004\214=j\270\210:\375\025\237\270<a\234$\017\224q\202f\026\374\221<,v"
+	.ascii	"_T\301=\013B\221D\265\326S\235W\004}\314\346Q\255u\031\030t\361"
+	.ascii	"\205}wa\354n\205]2J\333Ew\326K\364k\336\356\271\376d\304~\270"
+	.ascii	"I7>\360F_\316\372F\316\\Yk\242z|\334%\372\270\205\273'k\337\330"
+	.ascii	"\305\341\255\301x\207px\205N\374\006\341\360\002\375\300x}px"
+	.ascii	"{n\374\362P\336\035\031\257N\316\263\2764\031\357\354J\2761\030"
+	.ascii	"/,\306{\306"
+	.string	"xM\030/=yK\223\2274y\233\362~\300\f\r\026\007WjeqlS\277J.\036'\376\306_\311\237ur\367\306\375\226\326\366\013)\257\332/yqeL\336d\367\254\245\223\327\342\344\202\312\361\340|ID^\207\"y\222\335\225\2448kE\303+\261\246m4$\r\324\233\036\037)\216\226\315f\260\276\b1\355\025\350\256\205\013|`\331'B\343\327\274/\024\253 Re\013\377.,6\302\220K\224\326C3~`y!;\247\271\353\311\253g|\026\227\0374\352B8\036\333\374j\355\t\350&\233\272y\362\341\343c\321\277\326x\326Z\033\354\275~%\303~\370r\2216l\240/\273eX]k\270vx\227C\007>\220\326/\376@\264\272\276|\315\343Z+\257[\2705\272sf\301\372\362c6\373\327\350{\247\227\241\242|\237r*N\036>|\240/\337\247:\001-P\326(\370\352D\321i.\306"
+	.string	"\300\353\365JK:\020:$\013\0304\344p\023n%t:\\N\204n\246\373&\0251\221P\312\205\2601\345t7\023\267\0227\235\355\304\b\020&lI9%[Qmq(n9\233\016\207\313\331d\304\336\373\006\325O\2554_\275\366\235-\334\332P\327\336\345\260\036\022\352=1\250\205\202\372E\316\206\225/@\315>\373\305\247!\276\335\t\271\230\035\325Y\353\217\301\036\314\303\354\254vD\"D\240/M\003O\254\b\2712[\270<u\306\253\334\247\240/\036&u\346\212\314\351X\257\330\r\300@?\r\324\261a\032\237\376\351\237\264}z6$\363\364&"
+	.string	"\367\364\336(\201\002\037\310\323=\035\033v\341\351o=U\250A\030\343\2243J)23\024\315l\232\016`\002\23123\017\021\260\035u\214\266\031\366\357\013JL\274\373{d\t\273"
+	.ascii	"W8\251\331Or\rJ\251\364\2710gd\314\210\303\250N\264\231\331\312"
+	.ascii	"\262!\347\344y\220\177\377\253r\001\245f\025\002\032\323RW\203"
+	.ascii	"Z(H\256\373\025\003\f\353\223\265A\224\306\217\223\317L\365J"
+	.ascii	"q\262\037\2715\304\253q\357\311Ny\321\031\342\364\021z~\301\271"
+	.ascii	"\311/<\310\200V\222\317\352P\205D\340\373'\256X\227S\215O\276"
+	.ascii	"\024\036y#\026\207\252/\326\020\262\333)\366~\226\2176\301*\343"
+	.ascii	"-KD\237\253\nd'\370|\261\215\274\221\205\336!G\236'\371\341n"
+	.ascii	"J\370\003"
+	.text
+	.section	.gnu.lto_sendTemperature1.103.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375`\224\001E\017"
+	.string	"\306\334cE \217\223\016E\270\210\207\361G\\\002N$V\245\324\220F\031\272\r\354\022\323\200\235\234\032\221\320O\353\264}K]\353f`\3733\250\223\372"
+	.string	"\212\020\240\004\247\2400$\316oe`\370\027\216\020B\b\331[\312\224\002O"
+	.string	"K"
+	.string	"Q"
+	.string	">\b\315\007\370pB6U\260\026\024\227\027s\206\005.m \273\364W\236\"\371\0073@\301]\332$6w\251\234Av\213\207\031&\226\262B\022\001c\316\331m\312AW\220\177\324\265\222I\311\025S0\347\264\226L,\334{\333\003lw\330\212 \327\245\266O]cH\3040\205\264e\207\"]\024\373q\356\211\035\325\334\245\336.\265\026\325\331U7&\325\227T\307\250\336\250\326\250~"
+	.string	""
+	.string	"*)\022\314\314Y\241%c\256d\214\206\253~\373~\210\253|\026s\266\346\003\004\312p"
+	.ascii	"\003k%\231v\343v\220X\241\025\272\273\222\305\310\203H[\326|"
+	.ascii	"u\343\214\021\006\2217\207\361\2629\347\001\377\345%\036\370"
+	.ascii	"\247K\207p8\327\345\367\250\023P!\323!\245\233\313\266\372rA"
+	.ascii	"S\237\270M\\\326\326\034\024\266\304\376\210\267x\374\223;#\372"
+	.ascii	"\322H\237{\343\001r<\237\203\016\374>\236\210\007\301\373t\021"
+	.ascii	"B@D\272\315\347\351<\004\270#\301\373\272O\247\363u\\\030z\234"
+	.ascii	"{\342\243\236\301lX\205V\344\r\3158\260\315v;\315\\\213\355I"
+	.ascii	"\254,\356\265\032'\027#\326\206r\353\253\032\200\350K>\313\027"
+	.ascii	"\230Vo\355r\001$ P\202Af\231cbB\363\310\3008\324\277\025\304"
+	.ascii	"\254\261\306<\304U\216\2231B\254\321F\004E4\024\002=>r\034,\016"
+	.ascii	"#IV\2479\\\306\020/\326\310\354W\311\305,d\250\317\016\313r\224"
+	.ascii	".lq\220\350'\200F\347\300V\234,\257\355\3028\267\020\336\023"
+	.text
+	.section	.gnu.lto_sendSatalliteSignalQualityAsTemperature2.104.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375`\242\005\365\""
+	.string	"\n@\300\rK\220TR:9\2215\212\323\363Og\234\200\250\013\272\336\3312cC\211\013<\025\247,\257X\007U\254\270l\300>\177\306\246J\302\240'U\301\373\246\020\030\334;\023\216f\341\204\345\327\206&\255\210\210\210?r6K\b!D\356$\003\310"
+	.string	"\272"
+	.string	"\312"
+	.string	",\264\266\003\005\363\263\256\305\337\342\225\031\210\201o\351In\027lK\374\037\274\376\004b\260t\037*\324\233#\345*v5P\177\366\221\274\362y\274\207\357\307\025\352\005S\205\\cj\367&\023\374d\005\352\317"
+	.string	"\247A\177\332\313\240?\331\307\214\366\244\325Mm$\021nY\271\367\356\332\306}\307\335\324\024=\315\266>~\032\204t2$2\035\007\366\023o\002\252\242\246\256\232\005\312hHy\023()3\207J\311\213\177]\300\025\324\224M\323\240\255\027P\352\250\212\212q\324D\2406\204-G\024\2324O7\206A{\302\270\271\022\233l\347\210,L\237{\357\221\267ND\240\265i\320\275\227\355\220\030u^\317\314X\314\374\200\371\254\nk\302%\177x\021\020\352\275M\r\370a'2\244\032\1772\021\317~\370s\301I\240?\337)\2214\254\343\317\2661'\201\266\213\3147o\327`N-\367\360\334,\353R\313;W\236uR\31397\3138\251\345\233k\235mV\31354\367:\317\310\254\226c`p\226s?\236_R\313.7\313+\3162.\265|K-\2537\313\251j\031M-\237\247e\363\264\334\250e{Z\276\001"
+	.ascii	"V\312 \230\335\373\324\246\345\222\235a8\256\374\265~\257\377"
+	.ascii	"x\223\371J>\230\020n\027[\236\344\177\275\353A|\367b\245\312"
+	.ascii	"\004U#4KS\273\367:P\177\372\230\227A\271\016\204ye\024O\006\215"
+	.ascii	"3\232\331\364\267\376cd\"\\\276t\332@\3074+,j`h\0279E\0264\013"
+	.ascii	"\3237nia\312t\212,h\r\323/\355D\001E[D\326\331\204\237Q0{\224"
+	.ascii	"\n|\001\003\006\364'z\200\006\033\326\361\254yR\323\366kJ\352"
+	.ascii	"\306\362\030\3074\37345\023\363\311^V\224AH\b"
+	.string	"\375\031\323\007r\033\346uE\352ti\231>\3621K\204\313\237\220\247\263\021\364l\227f\033\244\002\264ml\373\354\016G.\341\362f\027Y\207\232}(Yg\352uh\267\331\027J\001\217\344IT\360\215\254a\203\375p\003\372\263{w&\365\263m\267\367^\246\356\"[\343=\240\266Ed\2155Y,\314\314\341b\036\216\330\356\254\264+o\230~'\216z\335;\257Wdd\304\353\r)\335\230\350g\251\204R\322\210\335RR\217w\3043\342\365v&\212\206\216vDIJ\273\037\035#\235\340%\355zHHI\2735\371\273y\273\006\037yUy\205\354\327@\\\027\331\252\377:\316\252\215*e\345\357\275\004r\355\324\303\323=\272\346\351\013\227R\276\266n\247\371J\235\336Y[\247\017F\323k\003!\305\202c3\235k\232\376\024\363\326E\333u\225\303\211\252\0340\323\026f\230e)Q\276\205\f\254{\331\274\3677"
+	.ascii	"\3273\375-\301\253[\343\332\\\013\252\205P\373\326\017R\001\325"
+	.ascii	"\376\327O\250c\233pi\305X<\351H}l\016N\3474\316XEM\033\247s\306"
+	.ascii	"\264\340\322\307\3364_+\202\004\373\241M\337\004h\250A(\302\030"
+	.ascii	"T\214\031\221\021\222\202\244i\fP\0021\306\314\354\021\220-D"
+	.ascii	"EDZ(\264\337\001\023\230,p\234N\021m\252C\200:~{\317%\341\256"
+	.ascii	"\357!y\211g\346\345\233\016\320\201\250\t\206v\334\2563\177\020"
+	.ascii	"\356\200\325\302\003D<\004\354\221\211W+\036\366\"\r|v\326\007"
+	.ascii	"#\324\032Ik\310\305\273\201\3419\302L\251\235\020\"\024)\037"
+	.ascii	"#\310\374<,\341CI\372\f\202\272uk\221\360\361 \200l\251\304\021"
+	.ascii	"\245\371\030\360}\034:\212\370\262\226>0qd[G\321.\030\306Hr~"
+	.ascii	"0\204\333/\360\363\365\373.V\351\321\fr>\b\017]\025\321\250\225"
+	.ascii	"k\206*\021\326\316\257 \200b\235\303\210\2757\333\325\036kU\346"
+	.ascii	"]\353\320\250\251\231\2477\207\033UC\377H&uo\255\033\240\351"
+	.ascii	"\007\034\333^\203\257\b\275-J\r"
+	.text
+	.section	.gnu.lto_sendSpeed.105.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375`E\003\375\026"
+	.string	"\346(\221J\240\326Q:\305K\254\b_\347\n\025\336\3009\330j\361\351\327\n\037\336,\256O\3105(\033\036\330\354Q\325m\373\366\360\\^\254V\250S\023\361\372\310\003^\205g\364f\371X(\2354b\221\022\256\231\225V\032\210\335\233H)Sw"
+	.string	"t"
+	.string	"\201"
+	.string	"\363\373b\233\376\362A+\274\004\250r\347\037\364\227;\307ez\371m\261.r\033\324@V\033d\321\206\242$\265\nav\336"
+	.string	"\271\023\266,t'/"
+	.string	"\272\363\271\377\310\nMT\226\322\025\321S\223Z\253\254\2256\267cs\356+\264\343\022\227\201Pz>\243\355\261\200\210\037F\245o7\262T\2250\262L\313\035|C\314\254\231Z\353\271\347\373\260\237\373\377\301\177\006\177\257\b3\226\206\316\027\270\363;4\336\036\215\356\334^\246%\240\304\211EP\307\305_\270\343N\372w\254\215\364S~\214\344\303H\376\213\362],\276\n\311O!\371\345\006\367-\312gQ>e\361'\345\217\224\337\224\317\223\277\002VTT9(\326\352\241\030\245R\315\251\023\033\334\375\227\210\343\0215J\375\240v\210\033\342\276O\bdp\353\004DV\024\254a\222\214\005\344\006\013\341G\265\305\261c}&\372\215=\373"
+	.string	"\3450\242{\354\321\212\267\364\372qw//\305\216\213o5\217Ob\024\211\256b\260\037\260\346\031G?\026>\220\275\016\372W\377e\250\205\376\345\261=j_\340'\324\324\320\235\257\336\246\345))'\277S\330\035\025\032XX\0356\nr\344\310\340h\365tzr\3027\226T\221\350N\372\017\335\276"
+	.string	"\243\310\020?\371\177\2636~\006\374\263\255\221\3432\244\326\232 \267\305\231\315zhpx~j\266\234\36271@;>6\f2 \333mF\233e\230\335d<:64\331\215\315G\026\343\362Z\317\314&\273\325j6Y)\324\355X\033\3513\272\336\215-\f\263e\b\252\026f\365\227H\334\026\361\210\310\322f\365\264\342M\355\202\320\t\"\252\006oi\027 EH\312\372\330\227Veo\324\256H\365\370\351\\/*\355\352\026\220\t9[\245]@$\274\253\026\216\365w\030\201\206\267\367\035\006I\250QD\304\220R\210Fdd\024\250\264\320\001\260\002\2219\353\006\020hV\244i\306\263l\362$\306\b\266d\225_\204\216\266\312\301\244c#-\330\026\257\237\367\271\220"
+	.ascii	"A\372\313\267\266L\265\246\210Y\222D\270@gy\"\223\363`\f\237"
+	.ascii	"\263\226\323s\223Na\322\245\b\023\237\023>\263\274!\315\207B"
+	.ascii	"\202\325I\033\032\241\f\311\304\361\233\222E\357\273\021\251"
+	.ascii	"\333\326\273;X\335\3565\372]\3560\215_\034]!\006\232\376\256"
+	.ascii	"\210rT\250s\277;\025\024}Q\263\366\311&(\324"
+	.text
+	.section	.gnu.lto_sendTime.106.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375`\201\002U\023"
+	.string	"&d}H\340\262(\035\243?B\fx\324\275\316\b\225\007\350(|D\241J\333\240\376Ssm\367\367\331\230\232\270\025\376\367\027U\346l\307\2020\363\005\300\241\020F\034\307#,\371V\202\005\213J$j\003=R\332!do\"eJ\001e"
+	.string	"c"
+	.string	"h"
+	.string	"\340$\361\341jt\030\200\217~\212\337\330\241[~s\004\236\360\321n\261\303G\3576\207\376\211\243p\335\306\005|\305\200\270\234\017;\346\274\231<:\001\370Xr\001\362\321{"
+	.ascii	"\371h\227\235\343\267\020\363\023\341\001\006\247\307\234\323"
+	.ascii	"\264 \356\272\272\374\333\016`&\363\272~\016\346\234\326\231"
+	.ascii	"\314\314\275\267}\3006\212\275$\001j\247\250\350g_\0033\266]"
+	.ascii	"l_\366-\246[c\337\233sN/\215\r\252G@\265\210T\223>\365\bT\207"
+	.ascii	"\200j\020\251\016os\213\242\372\373\324R\252\243T{Q\275Q\255"
+	.ascii	"Q\375\002%\237\033\017\202\346\3340\364c\356\242n\304m~\373\271"
+	.ascii	"V\fZ\216\327#c\305q\255\236\022-\037g\001J\353*X\002\367q\022"
+	.ascii	"&\350g>\356\020h\273\227}9\256\\\005\340\315#\275\215{\331\217"
+	.ascii	"]oo\273\307C\347\007Fh\300\b\214\221U\026\034Hj\237\233GZd]\362"
+	.ascii	"r\027\177\221\362k>\241\3643\224"
+	.string	"|\024\331\337\\u;>h0\035\362[\\w\327\003\222\351\032\334E\212V\3671:\270\017\307/\310\257h\017$3\021\323!\207\001\254\257*\254\244N\250\325\347\323\tK\312Je\301\304\242b\241TP\031P,\323\n\006\n*\246\223je:!qJ\003Jeb\245R*Sx\203\335\233Kc;\250\263\261\203m,\027v\330\2254\\?\367m\270\317\035A\355\007FH\264_\220L\027#\020R#\344\272\033\204\006\310>\347\245\235\0314\030iKFKZQ-\350=\227;\332QM\207L\250\244&\0014 \300\002\021\272\252\003\"B\207L\001+\313\270i\363%uF%\030\3106)\310<&\331\216`\032\002~\231\214\316`#\271\327PB\331m\367\223\250\016\216|\022\002\341\035\303^\321\270\317\254\345\267\322\242U\315\310\272\322J\247\205\2374\307\274!\307E`\016\301\270\242\271\n0\306\270\b8\200\3507"
+	.ascii	"D\367WN\201{\320>2n(\320\231\027\255 \003"
+	.text
+	.section	.gnu.lto_GPStoDDDMM_MMMM.107.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375`\212\003\215\030"
+	.string	"\306.\237G\260\230M:\360\345\261\241\301*u\346\t\312c0\270\355\025\002\317\3210Q\245nl\020\207g\267\037\035s\275'9r\350B\366\321^\317\234\316\270,\254\266\340o\364\003\224\017\304\276\315\2571\360\322\030\332F\b!I\246\024\216"
+	.string	"z"
+	.string	"\212"
+	.string	"\257(\024\017\240\210x^X9x\"j\025\211h\371\220\262\341$\306H\300_\031\264\271\363\r\234q\f\001\210\211G9NX\305\2703\320\004-\177\335\265\234\255k\330\006\316NDu\305\230\242\207U\214\321@\013\264\374\361\270\006\364\347\031\006\372+\256m\342\035\213\030\266\240\201\244CJ\2141\366\025\306\371\363\236\270:\354q%)\025\371+a\217E\251\204\377\242t\344\361\304\030-\345\004\241\224\313\f{b\214\315$\245\021.\350\266\022\332Bh\217$M\271\314j\200\343|\301T\024\235\024\243\314jw\271\274\212\326^<Sk\034\266"
+	.string	"?\271;:\206rs\034\345\342\330\311\016\020fo\236\265y\266\346Y\232ga\317\316\204Y\0310\033\003fa\300\354\013\230u\t\263-`\366\005fY\300\254\013\314\266\276l\350eA/\373=\353=\373g\363Y\017\200\3110\022AI\214!\262\252\304\"\337\017\030~\262\241\354(\277\265ux\207\245\0320K\\\f\201\376\322J\322\223\327[X\356\372\353\326-\355\234\245I|\003[w\265n\023TJ\220\256d\214\261\350WQ\317\300\360\026r09J*m\201l5k\305x\244\240\366\341\252\f\265\013\177\245\325\322I5\320_\370\220\tk\212\223yX\347;G@U\245k\002\257s7p\007\360;\350\375\273\177\337{B\321-\r\241"
+	.ascii	"\022]\"`\376\267.F\316\363\307\302\271O\201j\007\322\025\357"
+	.ascii	"\310\213\350^\2018\3179\202\251,]\267 \240\233\005\037\020Hv"
+	.ascii	"\341\033f\264\013i\340p\223\331\300[\020\320l\326\201\026\366"
+	.ascii	"\347\300\207\f7\033\206\330\007\233\220\214&\323 \023\212m\230"
+	.ascii	"\371\320b?\266[\354\300NkA2[L\250V\263\305^;#{\361L\023f\024"
+	.ascii	"1z\2567o+x\210\213\223\236\330\374\346\031.\251\271\315?+\272"
+	.ascii	"&\232\317\274\346\307\322-\345\246\f;\315\255\213\001\273w\245"
+	.ascii	"\363\231{\350Q\205t\345\223\021\022s\031\230\277<\006\346\006"
+	.ascii	"\272\374\305\345&A\025\305ky\353\343\253\237V\214QA\035\244G"
+	.ascii	"\026@\250A8\004\211C\004*\031\t\243 \005\205\271\006\200\002"
+	.ascii	"!\272\242\007\020@\306\306D\205a\r3\362\243\355\275\372\303\017"
+	.ascii	"\320\034\240\375\017\231\336\247+\246\351f\346e\004\315\356?"
+	.ascii	"\006\252\025\3636\272\257\n\340\337fK\3003\241/\306\361\332\036"
+	.ascii	"/\220'\t\260\265\277\304(8D\332NM\247\271\032\355\214\034\020"
+	.ascii	"~\310\250D\331\200\352\026\345~\232p9\023\305j\244/>=$\234{\273"
+	.ascii	"\027ZFcyR\013?j\360?\301\204?\004\037\334+8T\335\360\243\002"
+	.text
+	.section	.gnu.lto_sendLatLong.108.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375`\246\b\335#"
+	.string	"&\177\325E\220\236\315p\340\353\213\360\331D\035\342a\273M\226\341\334 k\221NH\t\024b\225\370\034\252^+\373D}*\372\304\b<J\200\326$\204$m\223\320\t\001_\267pP!\030A\240\001\306K\315\356\275\367\2262\245\302"
+	.string	"\261"
+	.string	"\305"
+	.string	"\n\026\364\304\262\256EB\314\212\204\215%\252\311r\236\347\243\374\312\316q\211;\261\005\262\022>\024\347|\264\202\005%\376\304\204y\022)\237\370\2702s\236A\b\346G"
+	.string	"\027:\307^r&\27579a\236SL\255(_f\316\323\305\322G70?\332\304\323\310\253\217\344I\256\244\367 \212\357\234g\217(S\3163\330\344\005\301\327\310\217\346i\344G\373Gl\234\217f2?\272g\227y\020\310Y\006\351\242\022\2629\317\023\267?\336;9\212\253=\377\302\343\370\252R\234\234\361Q\305\n\025c|\305\244.<\306\b\250\222\022\205rt\305\270\360\372\253\232R-\037\234\347i\365U\275\270\313\333\376`;\202m\206\t\337\231\224\262_\215(-\263\203R\272>\354\213\347\366\260M5\316T\337Hu\023S\251^\"\325\t\276u#0\325\007L\265\022\2516\220T\252\013\220j\244s\335G\246\232\200\251\266\231\352\001\246\332\210T\027\021\225\352!R-t\257;\310T\003\231\352\037R\355S+\325=\244\232v\260\233\307T\357\230j\235\007\177"
+	.string	"\244zF\252qH\265Y\252\313RM\222\352\221T\213\245zK\265\222\352K\240\211u\241\020v\236-\312\304\316\341He\310\267~\256\337\353\007\373\233|Q\003\346{I3L\343\345\177\241\331\202\306J\013\031\227\217e\314\212\2051#[>\225V\303\251M!\212\353CU\210/G\227\365\023)\256\017\223\256)u#\212]Ya\277\032H;z\356\350\220\351\354\277\370\324\326\247gk?\363\335\036\332\372`<K\333\345\331{\251\260i\206\200\330"
+	.ascii	"\235\314\375\243\346g?,\"\332\242\235\001\327\f-\321\336\324"
+	.ascii	"\035Z\001\300\260\025dRZ\346\232\n\255\357u\001\203\336\027\264"
+	.ascii	"B;\003\202\241\"\323\r\332\177\375\006\344BE\346\f\027j0\317"
+	.ascii	"\363d\240{\341\225\212\240i\223\2046 l\300\252\024\032:\352\257"
+	.ascii	"\373\ni\243\265mJ\314\307\354|\240\235rz_\216\374h\264\337r\036"
+	.ascii	",-V\001\364N.\354\340\373\332\036>\350}\266\251\330\024\366\301"
+	.ascii	"px2\201>\n\362cP\327A9\205\3600\333\300\333\355rcN'b\204\255"
+	.ascii	"\003\317\311t\356f\342\303\b\036\007\234\t\036\224\356I\007B"
+	.ascii	"\007\205\013\341\301\351\t\227\343\215\300\335\212\274\023\241"
+	.ascii	"\343\341"
+	.string	"\240v;\036\316\301\250\213\347haM\307\227h,\263\375yl\030\265R>!\236\347\016\007o\362\013\277cf\311\325l\375\253+r\334\036\326u\326qp\251\253\340\354O\245n\232ZG\004p\020\260\251\r\333^\213\201\2445P`\223\312-\200\264>\327\321\"\225{\264\307R\241\034k\223D\350\200\214\003J\nCio\245\211i\233\226\226\211\334\245\004\353o!\330\004\344\"\330S\311@\212\361\340\224\005\356\246\277\333^kT*q\334\2547\277\032QK\317\2711T\234\365\261\216\365\t\001\200\260\250qT\005\031*\021\221 )(H\013\303\001 \003\021\251M\033\021\360\2503\n1)\023\303\306\376\006\031\237\"\237\027\253\205\216\334\272\207\277x1r\220\024J\372w\331\316\352{Q\363\214\020\222\274\275'\2518D\032C\013\332\217\322V\272\305\234\274E\342\301(Yv\2373:\222\343\312h\375\354\210\262*\244b\315"
+	.string	"\324X\2628\224\274\356m\252$\201Pa[\0272%\277\311\321U\024i\365,\023eJ\302\034Z\223\2649\356\310\320D\302\270\034\330\266\361(b\256\254\326\317\007cq\231\036'\356f\0202\025\007s^4\236\232\361\234\305\252\3731\267\rT\235}\277i}\"\246\234h\226\335\320v|\\\216\331~@IC\204\264\243\273\256\370\223nL\366Lt\217l\252\177\337i\b\365B\370\323C\375\205\214\bU\221I\221\347\3738S\005\364\005\313RtL\rl|\347\3737\\"
+	.ascii	"\013\222\\\313U\311\256\217\240k\366\240N4\t\304T\267\357\273"
+	.ascii	"I\202J\323k\250^G\201\333_\271\f\334-\313\024F\253\001"
+	.text
+	.section	.gnu.lto_sendFakeLatLong.110.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375`;\001\035\r"
+	.string	"v\331YB\020s\232\016\\7\007\232\b\252\003\304i1\234!\361\254\351\210dDQmG$\200\235Y\026\353m\344u\2556\221Y\321\262\177\235\316\"M"
+	.string	""
+	.string	"\342\b\3058\270&\344\037\314\035\2676 \021\262\267\224)\005F"
+	.string	"?"
+	.string	"I"
+	.string	",\336b;(EA7`\273\030\"R\354~`\360\350\021\352\321\337\rH\217\324\tH\217\336l\036\377Zv2\021\242C\f\220\335\265\264\304\267\347\346?t\021oE\3459I\330]\247\267\002\342\326\333\326\330v`_&y\357\321?\221\036\257\225\013\215  .G\366\347I%a\037\356\356ZYl\230\2464=iZ\312t\204i\250i\325tf\372\001\016\340\320A\241\307\256\207\221\220\025\305\031(\016\372\355?\344\312\017\223R\222NQ%E\020Sr\030/\242V.5V\200\240\332\036y\310\004"
+	.string	"\204{>T\241\376\307'\207\214\303\264\354\256\027t\273\234&U\365\037\025\236\034\371\232:\r\371\314xs\230\214\332\355\036\370.\376\302\301?\361h\316I\026\264,\273\242/\022\024\023\216v\301B\321:\330\006\313\200u,\r%\0256\326\245q,\222\004\3166`\232\325\3112\315\252>\356p\225e\202\214\210S\217S\340\356\210\b3/9\262\200\374\367\320U`\207gc\030\362\236\323\306\rQ\247*\246\032\004\027"
+	.ascii	"3C7\r\354p\357+[Sj\227\005`\t\200\fp\007x\005\274\001\370\346"
+	.ascii	"ALNF?KR\274\270S1\226\341FH\325\366\341\202\321\253&\001\253"
+	.ascii	"\200sy!L2"
+	.text
+	.section	.gnu.lto_sendGPSLatLong.111.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375`g\002\r\023"
+	.string	"\326\241{I\260TN:t\002\\p\316eb\234\004\256\367\207\246\347\354\237\352d+\367-\252%\357\211\255\2060\316L\376\246\366Y\330\002\246\356\226u\347\226\315\357\250^Y\337\330\342\rw\242\201\201v\320|\373\340|\030k4\262\367\226)\005d"
+	.string	"`"
+	.string	"l"
+	.string	"\20619\365\370\225\357\324\344\002\276S\337\354!\037\215\352k\205\322\317S\222Z+(\213~\373G\247\334\233\377\335\017d!\tE\334?*\223%\025\212%>g\313P\n\256\024\321g\272\350\340\375\234\210\271\2253\301\326\324\221\024\261g\256"
+	.string	"%\205\337}C\210\271\335\227\203Z\2537\024G\334\257\333\336`{\201\275cN\2171\363\221N\375\241\266\017O\375\332wz\371\002\302\203I'c\362\362\357\\e\032Y\265c\251\b\317v\331#n%\221\375Yk\255\226C6]O\272\226s\275r}\025\002B=j\240j\005\352ZRy\224J\351\272\357\256\375\357|\342\273\370\213\333u;.\271"
+	.string	"5\027\325\304\242V\021/\247\0010\337\325\250\320lUH\304\025~\243\206A\317\302\251.\304\330|\n\006\323\263!C\320\223\222\022%H\213K\367\250\327\240F\264\226\260\216\204\232\246$\362\037\373Vn\222S\220\3178\215\230\217d\0207\373\360\346;]9sd\202g\273\356\021\367\275\362\001j!%\221m\337%\006'!\271Ub\033\3472l-v\316\237d,F\265\326\231\031h\263\031\214\032\026c\313\251\3214\2006\232NL\026\343\020\323\001;\340\330\310@\030\255\006\306\260x\346!F\003uf3\032x2\326\243\340\361\310\036\357\314ZU4\270\356\337\202\361\031X\373\001\204\023\274\036\211{\221\225\017(Z`?~\027a@/\264%L\330\207\006pE\202\227\2238O\005\024\236\003\007\326\225\325\224(A?\230\244\264\0351 \260\002\221\2522\007\"\340\r\343PX"
+	.string	"\f\202\201\260 h\005\206Z\2652\262r\2701\302@\220F\343\036\354C\036\027\262\270\022\024oh\232\327D9tXj\350"
+	.ascii	"\003\261\335\232\305\200x\264^\016&\030\032\020\020\236@\202"
+	.ascii	"\235R\331\016D;\366=\252e\263\213\324\346\342:\fc\333\220\356"
+	.ascii	"l\357\345<[\200\223\214\332\020\363\005Z\242`\341\230\001"
+	.text
+	.section	.gnu.lto_sendVario.112.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375`x\001\265\016"
+	.string	"v\033`D\020\221\223\016\t\267\2439 \344\3464\270\330w{\245\bQ\233\021I\036\275\262K$<\241tq\234\232E\375\243&ly,\324\347H\353&\004\005(\202\"p\347\224\250\243\365\366U\025\272I%\204\220M\244L)J"
+	.string	"I"
+	.string	"N"
+	.string	"\340\303\t\332r\310\\V^d\354\206\036\2176\240=\372!\216:9\b/\210\341\036\355\023\233{L\316 ;\306C\226\3154\264\030\221\230\261\273\235f8\350\t\362\177\372FJAyf\tv\327IJ\271p\353m\023\260\255\261S@1\323\243\236*\0234J\241l\331\241(u\305\376\265\252b_\351\rKkX:\273\322\330Sw\214\351+\246\363J\177#\200\352\205\310\314\256\205V\215]E\325\206\247~\373\376\210\247\374\026s6H\b\b\224\361"
+	.string	"\372\"@B\002\253\267\256\233:G%Q\266|M\325\214Xn\360\024#\032\030\366\346(\274\002,\273\213"
+	.ascii	"\346'\036\370\246G\223p8\330\343\365\247{t\220\371\200:\240\275"
+	.ascii	"h\2320\030\266\264\213{\005\346L\335AAQ\354\227\270\213\3077"
+	.ascii	"\271c\222'\231`\017\237{\363\001r<\237\203\016\374>^\211\007"
+	.ascii	"\301\373t\021HFJ\272\315\347\351>\006\270#\301\373\272O\247\363"
+	.ascii	"u\\\030\372\265\252b\237\256\261P\261\n\251\310\034\211uD\305"
+	.ascii	"\024\200i\346\322\250\037\261\264\324K7L1\025X\034\271\251\237"
+	.ascii	"b \222'\371-WP\n\" @\002\242\3142;\362B\203HA\370\031\376\277"
+	.ascii	"\214\220\335\346\230\302\270\3558\231\021:\213Vd\330\022o?,\331"
+	.ascii	"mB\316\352r\016\227i\210\2075\262\373\025z1\017\031\251g\207"
+	.ascii	"\261\034u\027X\034D\364\017\240\3419\200\025w\313\207v\241\234"
+	.ascii	"[\b\357\t"
+	.text
+	.section	.gnu.lto_sendVoltage.113.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375`?\004]\034"
+	.string	"\026u\266I\260\226Q:\353\2265\213\0013>\001E\n\305\325\374|\234\036\247\245gw\247\236o\024\340=\257[y\361\203_\376\216*\007\367N\366\3519(\035\360\226\362\323to\030\324\361\237:xp\305\355#\3603\216XB\b\211\225;\245\237"
+	.string	"\223"
+	.string	"\247"
+	.ascii	"\037\372=|B\t\001\205|(\237B\337Q$3\nV\022\013~Q@\253\007\317"
+	.ascii	"q\035\366\351\021\307a\021F\f%`\255\365\274h\217\260\317\213"
+	.ascii	"\364M\267q\241\317\033w\322\375iH\206\364\252H,\256\230\030\224"
+	.ascii	"\027e\255\323x\r\335\203De\215*{PY\246$(/\276\016`\274H?3^\364"
+	.ascii	"\001\004\272\003\213dF\257\272\253\312b\25258\340\242\t\224\027"
+	.ascii	"\255\263\243<\270TI\026XzB\253Z\353lW\\w\252\363/\274\351+at"
+	.ascii	"J6\250\265\232\372J\230\270\367\266\003\330\206`\267\204\001"
+	.ascii	"K\265\326\004Q\377\361\343\377.\272\006D\357\003\032/\326l\254"
+	.ascii	"\305\225R\023\215#\232e\007wtU\330o\325Ma\237\324='5\217I-\333"
+	.ascii	"qQ\353\230\324\261\017\357\034\234\233\007o\330\237n\233\003"
+	.ascii	"\357\032\222\232\306\244\2361\251eH\352\030\222\372\345\242\206"
+	.ascii	"!\251_Hj\227\222\272\205\244>Ij\027Im\226\324\245IM\232\324c"
+	.ascii	"I-\226\324\255\222zKjJR_\300\247\230\254\250l\230\252\225D\326"
+	.ascii	"U=\"J\265\370\360\007\376\301\377\351#\025\355\373<\002H\236"
+	.ascii	"\304\003\005\013\026\306\213<{\035\007pB\211R\323\315\276,\016"
+	.ascii	"\314\211F\227}\331\367\222Z\326\245\264\331\026*\036\026l\317"
+	.ascii	"\275\331C\351\235\330\335gt\355\271\347]\331\254k\257\344\304"
+	.ascii	"\307}Fsa{(\274\253\335\207\234\b\221\377s\320\005z\337\205\361"
+	.ascii	"\242\271$\016\0372\222\312\025\327f\351\2207\203\334rO\357 \343"
+	.ascii	"\270\344\236\347b\334\034a\017\253\265\273\342\236\247T\263\255"
+	.ascii	"\205YQr\237\221\356.L\310s\261\243Y\376\322\245KzX\031>"
+	.string	"E\244\240\211\020\332\254I\220\357\355\305\023k8\220\"\004\366\206K\321\n\004\271\327\200h9\333\255\302\311\201v\263\r\321D\220\271\020B7\0076[\355\307\364\217\201\241\017A\270\016\263!\\\256\006\242f\253\345f!<\320@\314~pA3\0031\337D\324p\263\334\355\206\233\235\301\243\267\352\246\300p\345\310\321\356L\263Q\356\2532\2634\343\312\354\314\236'\025\2632;\241j\352D\343kc\252^t\t\206lge\353\372]\321\331\235\0339\314\352\354\313O\n\017kGc\353\017#H\240\367\345ll]?\252^\316\276\307i\225%NT8\013\263\027\276f\312)I\016\254\261\207I\317\322!\212\244#\352\"\346Y\313\220\326\310~P\25018\343\210b\006\231\241\031\232)M\013c\220\002\221\252\262:\021\320!\204l\323B\233\001]\246c\370d\222\313v\347\204\007\"=77\226a\235\257\334\370b\302k\002"
+	.ascii	";\214\350#\321\272\220\2435\234\360\374\022Y\315\203\226\334"
+	.ascii	"\367\224\340\311\323Q\024\376\341\210\360\203\307\006?\375\250"
+	.ascii	"\224fH\2708\020Dr\0349\230j?\273\221\272c\036\247\375sg^c\025"
+	.ascii	"\363\003\376\024\n&\240\315\365.\214\253\277g{\316\331D~\206"
+	.ascii	"}\004:~p\340\242\241\356\"\006_\002\254\030)\312\366\036L\371"
+	.ascii	"\027\215\2713\255j\236\3265u\201}\200\246\205\322\377"
+	.text
+	.section	.gnu.lto_sendVoltageAmp.114.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375`c\006\325#"
+	.string	"\212@\344\rE\220\234M:\004B\375\026\377\203\230I\371g\334{\262}\367\327\252WZ\203\n\222\367\252\347\203\313\001k\327`1{\367c\217\270\307\253 \253\261d\213\344*\006\310\225\234\366\t\">?\020{\330\326,!\233H\231R\311"
+	.string	"\264"
+	.string	"\317"
+	.ascii	"=tK\303R\b\n7a<\\\035\313\317\362\315\256pAi\307\207\016\232"
+	.ascii	"\022\0265\265\303\327R\341\302\216gI\322\371\030\226A6\b\273"
+	.ascii	"\246\356"
+	.string	"p\240}\372W\216\305\276\231\307\207\336\247\261\333\247\315\303\276}\216\257\362\315\237\272\025\245S\365\240\225]\264\246-\255\262\262\034F\370\264\004\332\247\317s\343\247\236\300\370i%\233\354C'%\371$\253I\313\235\262,w\333\344J'\307)\256*\371$\210\252\003\331\371\235\321\n\3728I\202\370z\315)X\344\243-\370\364\211\013\002E\335\226\037*>\353\003\306\254\316h\005\213|E\bQd\210\340\202LbN,I\233W]\201\004\177\252$\210\262,\255N\301!7\355\266K\333#\3541He\211\341\313\301\314\360\205\237\246QC\357\364\351\327\030?\013\354\252IS\205jI\317\354\341Ow\211}\261,\313\322\253\304&\325\rj\352\242\232\232\001\251^0\252u\244Z\301\271\356\00455QM\215\240\246\036\252\251\205Hu\320\201Qm\200T\003\035\353\316\235\352.p\255\373\207T\373\220j\001\244\032GS\007 \325"
+	.ascii	"F\365\215\246\266\221\352\032\251\246M59\325#\251\236\244Z$\325"
+	.ascii	";\252u\252Oa\210\214\330\021WY\0069\313S\206M\257(\347\372\261"
+	.ascii	"~\255\237\352\242\375/\373V\307+\210\2120j\212\313\357\342\342"
+	.ascii	"\221\016\324\026\027\357\323\234;\037\372[\264\002\r\326\332"
+	.ascii	"\004\365s\202\247\254k\356\022\263\030\307\355Y\261!q7m\306%"
+	.ascii	"\325"
+	.string	"\220U\241\312\211;w\004\003J\375\310v\305=P\312o\367[\036\341\312\215v\241#\206D\024\322\240\003\033\2646\241\235\246={`\337D\3235\2608\341\033\340\236\237\236YH\201\326\307*aB\357\224[\240\265\t\307\232r\373\254k\2344V\005V\367U/zj\363\033\303\332\243a\b\315\320\352\226\021(\003\3522\267\227\321Bk\035\323\372\260\037v1\033\276\320'R\350\235R\214\237B{,\317\021A\023e\005\352P\234\242\302\366,\306/\f\2535L\212\307\366\212\203\261\240\225%\023\006\177\314\311\264p\361\342\305\370\371%\231\2441\263\321\305\364\350`\307x\030\236\005'e\274\031F\276#$\0259\214d\350\270\371\316\233a\344;BR\221\324\343\371|F0p\2161!\251F\216\236\214]R\317\307\263\301;\342\371v7h\030\331\330\305\350\345\330M 2\022\016^o\347CB\352\355n\303\245\257\222\252\207"
+	.string	"\0133+[\332\037)\316\2658k\013`\201D\370\355H\230\220\372\254\377\365\257\243\02034+\263\tX\237\235z\200R\023\267\002vz\001F\005X\334\315\376\263\001\036L\251\363\033\273\362\342@tF\204@\017\202\275\327\007p\021\003\265\264@\267\013>\366\333\352\024\254\317\225`\025$\330w\331\366\206\346\016\306\237\265\025=\321\371\215]I\3756\024\331)\272\231\233\001\035\006\373-"
+	.ascii	"\3733\322\266\301\326V\004\003J\221K\023q9I\037\342\3602\300"
+	.ascii	"!wj\310\314\366\354ln}\250q(\002\025S\210!\022\021IAA\232\016"
+	.ascii	"\240\002\221!\253n\021`\251T\212\344\032\262\261\337\001B(\020"
+	.ascii	"\335\027\271\364\206\034\013\"\230\2606z\335qS\260-W:\rP\337"
+	.ascii	"V\355G^\355\200\363\352]\207\017\377Ir\303\264\013\360\352O\223"
+	.ascii	"\024\230\346\\\270\210\276\267\207\247`3\304w\302\261\374s#\263"
+	.ascii	"\370\326\001_.\017s\003\236I\217\0251.\320\246\246\032D$\020"
+	.ascii	"\377\b\3568\334nw\343s\033\243e\330t;\254\343\016\003Z\245\261"
+	.ascii	"\337\036Yd\204\213|\363\035\373wu@7\236H\263\006F[\233,\352\235"
+	.ascii	"\201s\366O\005\024\237\376\261880\220}\366\323\242\025\324\205"
+	.ascii	"\267\261FG\005\266*\034x\245B\025\335?\205.\036\225\336Q|\341"
+	.ascii	"\322\234\2603W\245?ZF'\034\351\302\264\f\253D\024\013\300\212"
+	.ascii	"z\213A9 \272\035\270\376qSZ\236\315\020\321l\203\345`VtV\003"
+	.text
+	.section	.gnu.lto_sendAmperage.115.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375`\234\001m\017"
+	.string	"\006\035eE"
+	.string	"\221(\035\255\263\374\364\364s\362\360\266\232rg\363\312y\326\016\266\367"
+	.string	"\307\301\025O\331\2404\034\200\265\376"
+	.string	"\227\333\007|\360\021L\006\210\b\005\250\027\005\301OT\234\035j\235\b\331\026\206\020B\b\331D\312\224\002O"
+	.string	"N"
+	.string	"R"
+	.string	"\236\217\025:@\343DIpjI\271\346\034\r\\\372"
+	.ascii	"w\351\253\2762y\312\fn|\230s~\227\266\211\375]\352\347\217=\343"
+	.ascii	"c\207\271\251\270F#\\sNp9\374s\375\370G\275#\245\200\256[\310"
+	.ascii	"\234\323JJ\271p\357m\023\260\215\300\326\220\030^\230T\245\220"
+	.ascii	"\306\354Q\244\273"
+	.string	"\301~6W\203\235\251=M\335ij.Sog\335\232TK\251\336L\255\231\372\0014XI\345\2650\306\211\022\2631]\310\024\036\316\372\355\373\"\316\362Y\374\331\036\037\037\317S\226+.\246\224\307\017\341\361\0211\353\356jk\004\363\276\272\333\215\023\020\"?x\213\b\210\2359\212\020\023c\316\t\322\372\211\b\376\351\322#\032\215v\371=\352*c\305\305\244Z\025\350Lt\253\255\f\235\232\305\255B3\267\356\260\260 \373$^\202\343\237\274)\321\223J\264Kn\277\272\200\235;\203\361h8\"\004\320#vB\222PB\330\001'\214\210\220\200\031\221\003b\006xC!\024\301\316f#\202\337\030:\352\nZ\214\257\227\320\212\314\241\233\266\333z\247\032r\265=\267+\027\300\211\306\t\214C\275\365Y\r\034\350I>\313\027\254\030_/\217\351zk\035\225D\032# @\002\242\214\272\036\362\2007L\225\2608\017\372Y"
+	.ascii	"\335\303xC\231\303\236!\273\304\215\035\rH\334\213\020Y\343\240"
+	.ascii	"\034\345s\311`\023\223\274\316s\276lC<XC\257\237gW\263\220\235"
+	.ascii	"\200\355@,\207A\345\360g\300\n@\224\0070\372\363^\250t\213\366"
+	.ascii	"=\001"
+	.text
+	.section	.gnu.lto_sendFuelLevel.116.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375`=\003\265\026"
+	.string	"\206\350\216K\260\322U:sn\306;\236\321C@\347\202\213'k\301\316\n(\377\027=\264\350n8\362\b\206\301*\344\224\214\330\323y\305\367\267\264\241\200b\350\235i\341\3665<\262e\252\n\"h \037J\326\320\371\b\276,j\204\020\"wJ\001w"
+	.string	"p"
+	.string	"}"
+	.string	"\300\036\037\360\346\233(1\271](\363\312\t+\316\202\037\013`\217Z\205#'\215"
+	.ascii	"u\322\017\376g\346@\233M\304\363\244=c\237'\307\3238\033\307"
+	.ascii	"\205<\325\024\361\264\013\352Qk\205m\210\343N\216Kq\276y\342"
+	.ascii	"\022\312\235\004z\212\327\313\371h\236\020\017`iH\203\250\227"
+	.ascii	"\363e\365j\306W\255\365>\2477=\035\245\346I\255\325\224\327\343"
+	.ascii	"p\227\267}\301\366\003{o\002)\256b\346\377\334\342B\317s)O\246"
+	.ascii	"\366C\017\320\241\206/\250CC\213\266PG\027\204\375\261\356\216"
+	.ascii	"mR\267>\274Y(j\020\223zeR\237)jU\212:eR\227(j\322\244\036M\352"
+	.ascii	"-\251)I}\001\005|3h\305Zq\212?\252\022i4\342\303\337\276\217"
+	.ascii	"\342C1\007\032\005\210D\214M\264\317\337O|\350\003\371\264KL"
+	.ascii	"p\267\003= \020\256\024\301\200\r\031*\r\222\306\022\300\036"
+	.ascii	"_pt\321\221\237\037\224\\t\327'J\240@\317\363\211\237\200$tb"
+	.ascii	"\242\273\373\242\335\223Q\036C\206\001\222J\002\030t[\273 \247"
+	.ascii	"\037Zk\315\255S\312/\206\341\215\032\352\303v\205\037\245\210"
+	.ascii	"\330\026\356B%\204\247\326\252\300\350-V\374\337I\307d\262\362"
+	.ascii	"\344\367>\247D@\036_\360gT\255P--\362\260\242N\272\217J\247\326"
+	.ascii	"\257\232\315\331\017f!\201a\261\255\314`/\264\331\214\026#`\273"
+	.ascii	"c$7\027\230Z\006\330\255f\223\315d\032d6\330K\313\312\f\026\253"
+	.ascii	"\301\300HBL\333 \253\301l4Z\rv\ni>\326\335\361\271\003\035LN"
+	.ascii	"L4\253#[/\326\266V\365k\002Y\326~\207\"\027dY\277\0346O.z\256"
+	.ascii	"?\004\372j\3175\335\351\350\226\024yA\034.\t=\215\274\334\325"
+	.ascii	"\232\332\360\320\321\242\267X\034\267\334\377\374\200Q\320\315"
+	.ascii	"\022q\207.B\250!@\344\020R\316\320\f%MR\2521p\002\031\312\252"
+	.ascii	"\007\021\200\261s\212\210\nw\003\035\252\344\251\222\303\335"
+	.ascii	"\270C2\242\337a>\264\021\316\006KN/\311Qh\356\210c\007)\034W"
+	.ascii	"\210$\366:t\373\242\340\001\321\017\271\236\317\301\367\234A"
+	.ascii	"\362Mr\341\376v4u\222\375\3505\366\213k\205\216\302<\316<\353"
+	.ascii	",\247L\362\314C\333o\363\364\306\307*\020\r\327\313V\270[H\316"
+	.ascii	"\006\264\215\330\365\204\362\004\tH4C\330\345\036\327\n\236\366"
+	.ascii	"\202XPt\205\255}\363\202\032"
+	.text
+	.section	.gnu.lto_sendHeading.117.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375`Y\002\005\022"
+	.string	"\306_pG\340\322&\035\243^n\t\017\245PC\"\365\316\270"
+	.string	"\270k\216hbFT\034\037\035p\210yn\372\376\321m\233{\"\f\366)\006^\222\201\311b\215Q\210B\343\276\207\016\276\320Y\251\212\236Y=K\324\032!\233H\231RX"
+	.string	"V"
+	.string	"`"
+	.ascii	"\340EKqF#\202\276\210\021\022\360c\006\020\227q\306,\bU\210C"
+	.ascii	"s\216!\227N0\272\364q\036k\271\350\222\036\357\322n\261\275K"
+	.ascii	"\3153\313\276\361\261fr630$\206\346\234\337\2028\353\312\362"
+	.ascii	"\177s\322K\306\345\3121\230sZ_2\033\356\275\355\003\266El\375"
+	.ascii	"\021\251\025\375ke\273\364\366\261\2338\320\240\301\201\265\264"
+	.ascii	"\310\036]\272\037\354ks=\330R]\222joSw$M=\332\324\334e\367&\325"
+	.ascii	"R\2525M\255\232\372&\003\261\031\240\2139c\212|L \351cs\331o"
+	.ascii	"\177\307\366\270\0240\235\035\037q\231\237c\317\036!a\005%\017"
+	.ascii	"\364\257m\271\355\302 \030\335m\237s\315QC\026T\202\250\373\200"
+	.ascii	"\355\253+\362\022\302e\b\377\211@\"dKx\013\223S\315\311Y\240"
+	.ascii	"\020\b\3159\025"
+	.string	"\254\270\017\005?\2744JJ\312v\371\375\315\325\2068\243\301\211\t(\241(\255\366\314\220\3242\356\237\315\336\032D\303\272\3307\361\023\030\374\320\001\253\373\344\004\246\260\250&|\240j\205RAU@\255>\013(&*\337\211\212\345;\025p\352\002J\365\255R)\325\347\215\255\337\274\201\216Y\217Yk]^\007 \223\206\334\337\371\316\035\300\200\224\200\214!\317sk0\264\275\316\003\360\274\200\265:\322v\333\205<\226\264\037\351\216\026@\210\343\205\310\245E6)\267\276,6 p\002\231:\263\rb\300\031\346\336a\263$@w\031\003\230i\035\013\233\206\b\246!\314\357\311\214f0\377\271k\331\207\276\215L\364\271\241\036\206\257\023\327O\215[\262\231\231\3038\332\202\327\fYmb&\257s\316\313h\2107kh\364C\302\325\034\310\331\310V\001\rF\215<\355\211\260\340x;-(n\276<D0\260\364\f}\n\270"
+	.ascii	"\220\345\201\243\270\214<\276\027\224n\321\276'"
+	.text
+	.section	.gnu.lto_frSkyTelemetryWriteSerial.118.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"5\b"
+	.string	"6P:6Po\322\001\343D\271\325\373\275\377\371\022~\362\232u>\\Ou\367\336.n\rmP\364\023\026!\345"
+	.string	"$iQU5\002uf()\027(\324\320=\2324)S\n("
+	.string	"+"
+	.string	"*"
+	.string	"\257\334\331/\377@\366'!#\023\230\335\205\372\361\356\331\371'y\307#\205\236"
+	.string	"\n\273\353\364H\033\267\336v\201m\313vJZ\262o\372U\323\231\351o\006N.\026+\273\032)\231EU*#\266\357\261\235i#$t7]Xw;N(\273\337\201\r8\001jShy\317\004\031\032\262_\362\217\363E\\\001\312{\257|\320\346Uj\207C\365\032\020\3232\232\021e\312\376B\251\036\3665\033\016W\372\2628\b-6@.n\330\007\213\3006(\361\300\360\201W\324\240%\340l\002\213p\313\262\b=\337^\263ZZ`A\211\024\303\234\274f\t"
+	.ascii	"3\241\253\037\270X\346 \230v\271\2067`\302S\251q\340\316-\332"
+	.ascii	"\371\004"
+	.text
+	.section	.gnu.lto_initFrSkyTelemetry.119.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375`="
+	.string	"\025\b"
+	.string	"\262\21776@o\323\001\230\321\223\210UJ\016\266\317\315L\261S\2309h\302:\013\272{\330\022\23336d|z\342\261i<S\024U\207\235\007\254\"\220\211\304\3504!R\246\024\2760\235\206\2631\304n\343\260\fs\300\270\370\320\260\220\305k\343DL\2015\bl\213\234\246m\321\002\367\323jH\241%\364h\205S}\221\217\\X&C\262\362 \277\332\232,\377\245\022\200H\341\205z\276\372!\007)|\017k\033\312\337T\247r\364\251x\262\344*\247GT\266D\227\377\256\003\240\225\320B=\033\364R7\354O\253!;\323\371\364\003\fXN&Hv3J/\033R&\"\333\267\334\261S\016v\354KD\030#\227\335\215\312\361\316\263\343\377\343\002\337\307{\002$\354\256\363\373h\334z\333\007\266\021l\243\004\r"
+	.ascii	"3\241\317\037\030\317\\\005\266\201\024`\257\271\232\027\240"
+	.ascii	"BqMD\030\002y\031\002\\\272E;\237"
+	.text
+	.section	.gnu.lto_initFrSkyExternalTelemetry.120.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375`\225"
+	.string	"=\n"
+	.string	"\226\322E> \345*\035\300\313\031\260#rU,"
+	.string	"v\246\315\002\360\260\027J\002q\300\n\034z\217)m\303\330d\241\211\215\256\233=0J\300\261\307i\t\004`\314\002d5\252\336\231\346\366\t!{\247\0240"
+	.string	"3"
+	.string	"5"
+	.string	"\343\017\274w\233\033x\357,\332\002>\222\354]d\035+\004v\227\316\221\213\227\242\377\224\017\270^\254K\215\303\356Z\272^\260{\336\366\202\355\013\333\267\366\307\237\373\354\227^\0076\243\032\260\353q\263m\255\2031\261}\216m9\252\020\b\226\203\026@\342\322>\312e\342g\253\027\354\306l/\273c\203\0316\357\034{ng\314\026\037\265\326\33407}\226\267\250P\251\024\b\200\0239}\332UV~\2113ByW\350\275\323\304\310\024\bi\311\233=\262\344\024\261\317\355\356z\306\002\240\250V$\220>\246\372\201\032\017_\351S!@\221)\202\"\034M\324P\307 O8B\325\020\r+\370\225>\322\007R\223\350S\242\240\212\242\036\005\2370\276J\301\323\251R\316\030\022"
+	.ascii	"?\013b(\031b\347o\231}\003t\033\334\002\260\032p\001\326XT\226"
+	.ascii	"7\204e\327(V\030\017\224\bF\004\250(\340./\332I\006"
+	.text
+	.section	.gnu.lto_deinitFrSkyExternalTelemetry.121.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375`\022"
+	.string	"=\007"
+	.string	"b\31515pM\322\001p*T%\260\b\240\322MD\202g\201m\006f\013`\335"
+	.string	"\353o\r\271\020\331\205\310)\2234\220\357\n"
+	.string	" 0\004\270\f\177\025\362\301\356M\366N)\276X\252\205J\023dE\251\211\231\f\223\222\r\n\b\030y\241UZ\004<9L*\251i\242R\312\366\321>\017\334\264M\343<\t\3735\372 \017\251\017\231L<,\300>\257\242\377q\254\3625\f\241q\277\016}M<4\3008,<T8.dg\033\367.\354G\373<v\364M\003\245D\234\354R\204V\326\004\226l\330\276d\313Fy\226\261'\031\231\020\001\355\256|\030\267\356,\377\035\017\270:\233;\200\203\335\265\273:\025\367\273\355\001\333\004\266?\001\013"
+	.string	"3\241y\037x\304\\"
+	.ascii	"\266\201\274\217\024y\256\341n!\214\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_freeFrSkyTelemetryPort.122.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375`\226"
+	.string	"e\n"
+	.string	"6\322E? \345*\035\300)'!\027\017\001p\360&\204\b13\246\254j`j\002\263\261\317d"
+	.string	"E\215\365\373\253\273b\020\225V2\353"
+	.string	"OU\b 2v\241\241\215L>\243Np4\215l\262wJ\0012"
+	.string	"2"
+	.string	"5"
+	.string	"\353Q\220\233\316\321i\362\357\372\300H\236\316q\234r\235\031\030\222\002R\305!x|\260\334\365\211A\246\346\334,\354\256\347Hn\334\365\266\031l'\3307\b\257\247\007\260\232\325\253\0035ov\3544i\313>\267\224e\177\372\233\333\266\fPz\331\325\270\025XZu\031\261}\216Mv\355\261\220}\313\354BV\356\006U\001V\256N\216\362\224ZR+\005t\363\324\256\260\230\037M\020cBS\321\323$e2f\324\245\356\324A\205F5\t\330\177\035V\362E<\"\315\217\257>\251\013\376xF\021!\361\301\033\211\242\017\374$>\2217\001\321"
+	.string	"z\0371\344y:\016)>\321\023\205\241\350qb{\312r\265\355"
+	.string	""
+	.string	"(\232\342h\013\354\374\225\313\300\020\004\352\036\024"
+	.ascii	"3\003\356\031\022\370\300S\266C\r\315a\3419\270\003\224\f\004"
+	.ascii	"\367\t\326\261`\001\032\022\261\"\310\260\240\013\271\003c\375"
+	.ascii	"e\\q\351\246jg\212\246\240"
+	.text
+	.section	.gnu.lto_configureFrSkyTelemetryPort.123.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375`g\001M\017"
+	.string	"\206\034gF\340\264&\035\244\356\210\016D\223V\250EB\377 \334\304\244\265\263\244h\335\021\355l\376#A@\026\211j\273\251\336\321\336\355tc\365~\333\r\317\313|6\236\203\r\006#\220nX?S\242\026b\276\242\275\267\224)\005T"
+	.string	"M"
+	.string	"O"
+	.string	"B0h\307\366If\331@N\323\331\222\235\242\233\030F\273\273i\212\263\016\237&\313\027\320\325\034\216\370{\b\\x"
+	.ascii	"2\351^\217D\243\310\nRg\223\372P\206v\2640\351l\236\001\023'"
+	.ascii	"~\376\342\371\241se\226\254\354\256\223\353D\334\361\266!\330"
+	.string	">`?G\252G<,`\262Yv=@\340P\323\304\253\005\237\242W\032\261/\373\214\306\217\031%\223\347\016}\231xx\305\341Q\001\223\225he\315\246\271Rs\354\277U\024vLG\230\206/\3754\255\231\316\247?\3405\232\221\220\016<vC\324\216l\3714\357 \372g\377 \372\021\342\273\204\b\325\236@!\317E}\213\2435\266+\\\206\313\t\321\356\252\3704\016\245Mgw\241\006\230\251>\375M\222\326_b\252\352\211\217\217\031A.\233\356\363\002`\367\245\342\367\034\006\214\037;t\314\351\024\0173.\245\314\304\250R\027\266\231\324\312t2a0\255\266\f0.\247\255\224Rm)(Fi0\245\266\025\n\225\332H\264\326WZ\352\202\232\223@A\001\242\335\3269\337\306\203\0260`a\211\207\033j78\022\027\202!\t\362T1\352\207\216z\210\f\375\210\352\003\275\206\312\217\271AK\213\016n\b\201\035"
+	.ascii	"2\003\3020\337\n\213\023\210\026\335\241\253\325#l\303\232,\201"
+	.ascii	"@\256\325\2145A!/\305l4\023\fv5R1\306\321\330'G;\0268\177\240"
+	.ascii	"B\".\371\210Gg\302w\r\027\223\t\3602\330x\346 \264W\\ME\001"
+	.text
+	.section	.gnu.lto_hasEnoughTimeLapsedSinceLastTelemetryTransmission.124.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375`K"
+	.string	"\025\t"
+	.string	"V\022B8@\255\322\0013]\206\037X\255\027E\256%Q\354\237\231|}sV\001X\273\265\r\241\273\246$\025\336c\201\304\306\362\301,ydb\256\027\034\241\331\222<\006\331d\313\224\0021"
+	.string	"1"
+	.string	"0"
+	.string	"\004\333\245m'(\224\374\035\334`\375\265\222\"Q\331\005g\324\370w\375\374\203\334aDU\262j\231\256"
+	.string	"\f\273k]\265\\w\274m\003\333\013\266e\001\261_\213j\215\352o\020\256\224/\334e\205\263\225\311\223\227\355\222m\261\255j\037\366\217\322c$m`).T&\273 \202\017\002.1/\330.\265\007\233F\031%J\n\206\322\320\217Z\324\370\n\017\324C.B\362;\034\022\351W\227\276h\273|\274pX\2344\264A\223\306\f\373\332\356\256#\206\345\003\240\r\207\263i\360<\\\327\2054\002\326dF\022\240.b\216:\217\353p\034\316\233\236\315Cgj:\320\314\\\374\231\340\272\351}>\335\264\200{\313\2109E\224=;)\b"
+	.ascii	"2\003\302\260\215\341\210\206\262\244\313(E\215\177\350\020\306"
+	.ascii	"tM2"
+	.text
+	.section	.gnu.lto_checkFrSkySerialTelemetryEnabled.125.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"-\007"
+	.string	"\322M25`M\323\001@\203l\361\302\t\330Yf\020x\241(\3200\360\206\226T(\020b\232c\016\321.B`\274\336-\260\001$\230q\211\342\243\020Lx\3074\"eJ\001\276X.\210*:\274+Z\020\003#\240\365$\036\0320\357\022\253g)05\001\343\263(*\276\251\333G\253\036\325s\032\231jvEa\200\262\233}\273\252~\003\322.\362\021\013\337\303\025W~\273\344_"
+	.string	"\227\256\002\031Y\206\354N\223\312a?Z\365\330Nk\246\037\rl\224p\347\234\354vB+k\"\201>lg\354\311\t\n\031c\357>\035\002\220\213\r\211\312n\367\264\343\330\023\363\037r\006\215\223\262q\232g\300\302\356:7\016\343\326\333>\260\215`\373\023\t"
+	.ascii	"2\241Y\037\370\201\211\021\241\002qML\031A\226\0209\3349S;\237"
+	.text
+	.section	.gnu.lto_checkFrSkyTelemetryState.126.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375`d\003=\031"
+	.string	"6\354\241J\240ZQ:\240'\353{ \2305\006\320ayq\273\366\367\330y\345\323\216y<\367\035_\204`\2621D\311\303~\377\346\342]\312^qW\336\3429\304*\3429\243ux\205\033p\r\372\ng\373T\221\302\264F\032!D\356$\003\215"
+	.string	"\202"
+	.string	"\222"
+	.ascii	"+\230\317\223\366d\033\263\227\257H\367\345C\025\032\026\357"
+	.ascii	"\275h\337\270\355g\213e\256Jrlk"
+	.string	"\343\267v\267\237\307\361\336:\213\250+\272OGd\315\321\201\222\335\323\211:u\f\020\304\213\317\247\343\331\025N\215\030\274\227-,9\326\020-\301r\006X~\024\235;\026v\034\007\f\361H];\241Q\001\225\2231A\266G\033\251*A\016<\016Q\307\033\r\314\240\341t\245\333\027\273\234\265+\235{/\333t\027\343\f\340\314\354\304\314\020\230{B[\202\254\031\346\017\337T\343\357\340\331\t\373\364Dy\362}\245\037\330\t\247\214~*\316V1\2579\333=\346\217\267\217\230\255e\232\322\262\253\264\314\372z6I\313\343h\271\255e\333\226/\340e%'%\364A\324Y\326;Tu\346F\221Oz|\375\231\0374\302/\242F)~\211\017t\360\300\366U\305\315m\275C-\033)\222\245\342\275\353\202\223\314\300<\311\377\235i\305\227\030\203\3724\344\336{\236d\016O\315\276\271\224Ce\330\300\201Cyr\354\003\277"
+	.string	"8<2\372\251St\204\241\261\352\036,\206`*J\215\r\027dR\031\335P:\244P\237\202Y\224\204a(*\034\272\022\250\354n!L\336\004\310\303\207\017\345\311\356r\210\372D\344\327g\005\211\354\036\023,v\031jS\361^\334SV\316M(\306\351K|d#F\224'Y}\246\223:\265\251\314\223\204\024%\215*J\333\264\323\276\231K\360\330\247\266?EL\212\n\352\233\335\021a@\365k\345\033D02\024;0\r!d; `=\0210"
+	.string	"\311z^\034kP+\341C\023\201\326h?2\036\331\216\354\007\355!\001\343Ac4\037\264\201\r\317L\310h\350\317lFC\317\025\367\361\366\021\263\016\256s?%\\\351:\271\276\241\\^|i\025\260\314\024*\330\247l\221\020\301D\345\b\034\351rcu\217\237\344f\177\370;\342+R\231\335c\2326-\022\214\034W\304Hiy\020\026\313q5M_\350I\316V1\025W?\370\0047!\020\243\237\372\262c3[\270`\003I\250Q(e\224dJI0\022P0a\2500\035\220\002\221\241\265\003\020pg\333\312\034O{1\323\332(\0336,Q\n\215\005\336\310dx\003\003\206\321r/\r[XZ[\236\356\003\275J\260+p.\214\254\376b\003\243R[\360:\211J\263"
+	.ascii	"\267;\201A^&m\231)\036\037\244X\343K\020\f\203P\307\312Aw-\317"
+	.ascii	"V\201\360/\222/B\340\360e\277\361\033\2014\3329R\032\230C@\024"
+	.ascii	"O\203`\377\204\025$XND\232\005\275\034\372\355\2522\250\022\231"
+	.ascii	"mN\274\335t\315\214\032"
+	.text
+	.section	.gnu.lto_handleFrSkyTelemetry.127.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375`!\002\355\022"
+	.string	"\266\243\177I\300\020)\035@\260\037\352 E\035\022L_\235\333\016\202C@\225\t\024;\0169\035\321"
+	.string	"\273b\001\016\341\325\373\242?\355\233\330\016\334c\320\375\016\022:\254(\212\242\351\222-n\3558(\b\372R\017WPj\276\221\275\345N)k"
+	.string	"c"
+	.string	"n"
+	.string	"\034\247\037\357"
+	.ascii	"O\347_\340\251m\266\324}9U\300N\321\f\021U\255U\\\017\267}\005"
+	.ascii	"\322\271\322\346\267\306\333W\001\016b8\235\257\232\023N\256"
+	.ascii	"17C\234Dd\b\307\tr\316\0026I\027\\\243\314\354`\272\211\n\307"
+	.ascii	"\031\2713dg\244\344\032q\363\365\304s\363\336%\205qF\312\325"
+	.ascii	"H\255\325R7Z\2709n{f[\264%-1\362g\373pry\366\367\367\373\375"
+	.ascii	"\27486(\355\002\245[\007\272YTzN\351\235\322r\245\017`\300\013"
+	.ascii	"\\\323\320\216\321>\371j\205_U]\242+@\034\350\267\357\223x\220"
+	.ascii	"\035\372\345>#\330E\215\250\265\206\247\366\213\035\236\376="
+	.ascii	"\207\276\317\177l\007\202"
+	.string	"\371\220\361\325q%D3\345CU\253\317\300\251C\002\340\251\334\004;\031\254=Z\260\223\3529\224N\022oV\035\006l\355{\227;\032\236\033\215&%\327\262\266\265\317\205\300\335\350&`b((\340\251k\037t\020\016C\033Bi\247\250\310\353X\353\221\253Y\2621\205\333\233d\032:\202\261\313s\r\374\236\bA\311\310\033\366\207NT\363?X\306\"\257;\365Y\300\323\357{\007QQ\"\307\346g\027\022d+k\230H-\245e\346@\254\315h1\225\030\204\030M\\y`\242\"\302f-\242\b\001\313\"\304f\"M&\233\211\241/\346\2133\022\263\270Yk\255+\017i+` \257\363\356\255\003\270<\333/\351\271~Q\023\322\322ot\\h\240.\340\334\023\241\030,\336\302\245\001\t\311\036\330\325\350\331\355\"]7\343/\001\345\356>g\203\342)JL`\260( \260\002\231\031\355\"\001\2531\252\207\374\025"
+	.ascii	"\355C\252\203\004B\331\032\r\021\320\361d\314b\260\267\006\226"
+	.ascii	"P\300\203f}\335\020\005\374\354|\336\340\201\243\244]\331\344"
+	.ascii	"\265@\242\234\323R\037\210ph\0036\177\235\311\020\265S\264\305"
+	.ascii	"\200\2729\200\221\347B\t\226\244\264\027%\334\225\024,\n"
+	.text
+	.section	.gnu.lto_serializeFrsky.part.0.149.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375`\256"
+	.string	"u\n"
+	.string	"\346\022E?0\251(\035\320\316\217,\024\316f\300.\244\313\274i\330'\203b\342\335\353r\224R\225\223_\300\377\330\366\024\226\344\255\273\342\f\233\t\003\035<j\263\352\027\253\250\016n\244\243<#mo)S\n1"
+	.string	"5"
+	.string	"0"
+	.string	"&\211\230\263'\274#\260\230\252"
+	.string	"\b\003\n\273\033\017u\300\271k>\316?\241J\327w\317\023\212\344y\371\303(v\327\225\222\033\336v\204m\b\373\022\001\224Kl\355\206\274,\254"
+	.string	"\b\341\300Y\267\237\200\344w\266\260\254\331\220\276\032a"
+	.string	"4\034Z\323\326l\270\257F\326\335"
+	.string	"\016\036\354v\017\207v\250\034Z\016\217\300\016\251\351:\301\322\256;\002\305Wc>\264d_\301\027t\370\006\f\n\345O\207~\210rx\325\221V\005\023S\276RU\326\367\267\232\262_:_\372\001\234\215c\361\334\311\2102@\332E\024i[\346\3114\262-n`p<\261\243\201b\206\301\037\216L\213\333\347\243E\213\355\374[M\271\342\202\004\223z\250\252lc9\221\r\002\027"
+	.string	"D+0\036\214\033\350\300=`\260\247\370\211Um\203\367"
+	.string	"\n\227\215\234\306\234nH\bv\300.v\332+\252\207\316U6\375v\256"
+	.ascii	"\234x.\243c\336ym\031\003"
+	.text
+	.section	.gnu.lto_checkFrSkyTelemetryState.part.0.216.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375`\304\001\215\020"
+	.string	"&\234gG\360r\225\016\260(\034\252\301\264\017\367\0042\2200\223S\243\361D\266\204\336\250\306\003\227\267o\375\301+\341\243\315\230[<ZpE9X\224\2216\026qN\260\260\367\304\267\034\265\325\336\367\367\341\325\344\3755\331d\357\224\002O"
+	.string	"S"
+	.string	"U"
+	.string	"\233\242\276Mew:\2577a[\005\363\312\246yI[O\215|\311\355v\027|\245\035\276\272Gg]\371\234\030\353\336t\305,\234z$=r\204"
+	.string	"\020ky\0052l`q\335'\205\230\313\234\002^ERv\327\233\013\367w\333\013l'\260\247\2015\022\310\266\312\222\224\307\227\264\327a&\314\200\257\324\376\n\031\277\004Ic\267\273(\256C]\306\036\034\344\356\346~\363U\270s\202\242:n4\3546?\205OPV\307\215\004X\345\27680.]\314n\267,y\365\201\r\312?\3612\365\233UH\027#v\003wyD\007\211\035-\3122\375\214\361\250p\203\322\231\355\323w\272\202\363\321\232B\354\2778\214\223\357\301\022J\363\256\322\367z\212\341\366Cf#[f\315\2443\323zo)\007\273N_\304\253\335\002\310v_5CVC\225\361\341\271\323^\260\026\0367\013b\300\313L\341)\364a\320 \f\255|F\nT\306p\3441\213\t\nBIt"
+	.string	"\242DS(\nC\241\t\034\201>\"\220E,\201&$&E\bE\320D\"\211`\307\366|J\013u\361\350,\374\374\032\267\021>"
+	.ascii	"\371\240\357\025\301m'\213y\214\317\250\"hvA8\363\324\327\211"
+	.ascii	"H32 \200\002\221c\347\001\223\022hX\271\260:\002QA#\355\370\r"
+	.ascii	"\0374\017\220yp\235Yk\243=\357\330Xn\203\252Y)ys\204q\214\327"
+	.ascii	"\n\223\\\233\250g\273\300^2\253\376\307\031\260\367\213)\302"
+	.ascii	"\276\036\362\013q\bs#\270a\305w\252\026\234\255~\203\306!~Z\300"
+	.ascii	"|ml&\261|N\267\320\232\262\306@\250\275\027\241iu\334\273\360"
+	.ascii	"\030"
+	.text
+	.section	.gnu.lto_handleFrSkyTelemetry.part.0.221.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375`\301\007e)"
+	.string	"\232El\017Ep\236Nc+p\317\007\002~\312yA\243\226?\212\203R\037j\236XCzaRz\003$\26653\264\365\020\027>\"\255a/D\264\220\013S,l"
+	.string	"\023\017h\330\327\223y\236\023\305X\032\r!{o)S\n\342"
+	.string	"\334"
+	.string	"\341"
+	.string	"N\221O\257\342\344\341\221N\177:\354b\352\2538\t\t\221+q\227\324\241\004\233[W\244\203\237~\300\373)t\002\350O\363\002\320\237\247b\373ih\325\206s\344q-\320\225e\212ln]\327\337\317{\344\352\201~|z|i\217\207\267CO\363Z"
+	.string	"\252\017u \262\237\250eu\374\217)\301\306\034\326\335\206G\323W7\005'\304\372\224]\301\261K\313\312\370\036\264;\270\352\362\355\212\264\254\262\236b!\360\032\006\261=\004ZV@\316\003\304kxeynC \246\220\327\260hww\033\032\247,\272+R{\2005\251\267-D\037?-\025\261\307M\263\201\322\213\034\037\242\r\223@\325\022\252\224(\264\327\207x\303\024Z\327\365c\2679\210R\326\0068\200]\321\272\256~\024\222;\300\355\377l\213\260w\022\002(\216\354\251\374\261\367\260d\245\321)\245.\224\275[\276"
+	.ascii	"n\256\327\210\335\263\356I\255}=\353\224\307\272\227Z\363\364"
+	.ascii	"X\363R\353]j\215\366\254O\237\265\231Z\337\324\332\366\254?d"
+	.ascii	":\331\362c\\\327\252e\235u\310\251\306\344VN\306D\024\236\254"
+	.ascii	"$\004\205<V\021Q\210a\245\0026\256\233\245\022L\214\201\346Z"
+	.ascii	"D\036\255\236\324\201\004\233[\205H\007K\006\026@\036\2552\250"
+	.ascii	"\241+\363\373\371\263\233\366}0\017\023\343IO(\276\211a\257\365"
+	.ascii	"\212s\346\324"
+	.string	"\212\313%\263'~\227\237\371hfO\t\330\330\300\276d<\351wib\304\222\341\233i\371\026\031\347B\303\n\003\033\333\020\002\357\247\221\274\013@\313\f\230)\256\353\372+'\263S7=i\242+\270\257u]\323&\357|+O\376X\025\352NG\205\242FQ\245\250R\320\237<\367j\332\360\3240\224w\203I7B[G\345s\3240\336\272\n+\370q.G\255\342s\375\264\206\r\033n\215+,tbQv\311!\311G\207,kz\374X\247L\333\335\2555\337\355\036\204\242w\247D\315\214\240\003\354\323\334'\234\363^\355\004x\3241\206y\310\362F\347\374\020\3676\347\336ka_G\363ny\001\216;\241\346\r&\317\370qo\343\004\"D\210;\243hG\312\275]\327\025\352\336-\333A\350\275)\222m\204\266\316\367A\250\275\367~\252(e\227\366\337\016g$\202\004\t\364\247\275\037\373\002\25028c\330"
+	.ascii	"\3533\367\027\324\277\026\022^(\373h\336\326\302\347r\t\023\366"
+	.ascii	"T&\320\237\277_\373y\3241f\025\243\354\362\304Q\2316 k\007^1"
+	.ascii	"\324\024DbbB\221\342\267\024\004.\275@ZR\021\004\002\217N\032"
+	.ascii	"\300\027\327GCM-\226\202I\277\246 \023\222\022\222\013$\246\337"
+	.ascii	"\013\026(\224~G\301\245\337P\220"
+	.string	"\2010\220\202?& 0\370Km\333\027E])\240\036{\325sOV\265\374\235\373\030q\205\346K.\312.\331\244\211\r\371\271[fp#\324gw\370\024\020\351\"\347\223Zbz_v\253\206F\327C\303\\W\255\f?\373\225cvi\013\366iGSw\f8S{\250?,\230\2566\233\343D<9\323M\311\3723;\302\321\374\305\027\216\366sq\031\261\344|WjA\322\262\304\204\204\245Jh\357g\205\356\204\332j\021u\313\236\252w\223\246\264\t{G\274\2204I\222dT\225\304\255\311:\240\2142\206\307\b\345\271>1&\267ct5\266\332\365:\252\223\233\211[\3275\200\262\250\201@\306\024C#2\"\022$I\222t\300\002\221)*n\020`uCMc\270\312\333\330d\026\324F\334\325\320eZ%\263\311\001&(\030\223\217\307\347D\235\353\325\\\242\274_\272\002&\354zCb\211\275sv\\"
+	.string	"\212\2339.\372]\323\222\352\3012\360/H\212\343\310z\367m\276\315ww\304\207\"\366\037.S\306\037y!#7\274\265v\277\364\177\265\037\215\\a\r\201\326\315\361(\342P\326T\265*$\332\027\213\231\033\321,\212\224?\354p\367gk\322\276p\232\346\204g\005>\364\345|U\005\270\370\027a\005\211Zw\037<\204\277\330\224 \212\214\203\024\371\006hn\230\334\001\0331\304\301\235\\\254\226\007D\020\024\331\337\t}\024\374^\330H\322\024\317"
+	.string	"\272\t\275p\333\325\365\225k\026\375\023\255\312\214)\325\003\225i\2053CcMSS\370\3040["
+	.ascii	"\340]\243\323^%\006\337:W\372\016\001\310\202\273D~\347\264X"
+	.ascii	"\314\230\343\210\n\302\350\322\243\\<\026\306~9\301Z\236\304"
+	.ascii	"\363U^\223_\361\240t\375\364\376f\177\212M?\214\370\2269\352"
+	.ascii	"\200'\377\374\245\377\027\344H\245D}\275Y_\310\272\3655\371\353"
+	.ascii	"\277\224\030\245i"
+	.text
+	.section	.gnu.lto_.symbol_nodes.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375`\321\n]#"
+	.string	"\246t\273@\200.5\007"
+	.string	"\017:\305\030\350\341\022\257\234\032p$\032\236\2409>\1775\237\267??;d\321\345\234n\345\212: \235\272\370i\350\213\235Q\246^\373\177\235_o#\260\356a\t6\021\"i\247\024\255"
+	.string	"\247"
+	.string	"\251"
+	.ascii	"\215^\264\226y\345\"7\243\026}\307c\221\375\316mE\366\254N\205"
+	.ascii	"OI\341Q<*\177\342\241\310\335\347D\356@&r\267]\211\334\212:\022"
+	.ascii	"\271\023\215\310\335%\302\251x!r#\002\221\373\320\007\257\342"
+	.ascii	"y\310m\250\353\220\273\020\207\334\203\276\r\271\001ih<\031r"
+	.ascii	"\377\301\340N\356\205\334~,\344\346S\301\227x\024rsM\360&.!\367"
+	.ascii	"\236\356s\271\\.B\356-\b\331\321\356A\327\361\0344\235\006\271"
+	.ascii	"!u\337\3557\223Agug\232\253\005\271\027\005P\340I\274\356\376"
+	.ascii	"\314\3634\315t\347\3566Q\374\232\246i&\310"
+	.string	"-\250\353n\021+\343\005\277u|\021\rq\037\352\270\245+\256b\032\202\347\322\207*\330:J%^\221\025W\360K_\342{\353\252\322\025\303\325\3374M\253\227\322\1778\367<E\316`\275\256\253D\334\305,\271\242\347u\235\365\356\352\322\002\007|=\025\n^\347\362N\n\333\204\016\202\373\266\003\335\017\311~\023\222\375H\220\354V@\262\237?\2623\361\221\275H\217\354Pxd\227\262#\273\022\035\331\221\270i\232\335\265\034\331M\307\321^[\335h66r\347:\233\033\361\252rO\252\221[\022\215\334\221\272\031\271\037u2r;\212\321v`\344\016\254\270\262\264\307\264\017U\260\215\212\272!\033\256\340\027\005\005u\305\360\\;\250\331\354\202\337\354\235pN(\016\206\312\256\267\262+;cl\271\222\254\354\301\217\225\275\330\212\352\323\205\215\354S,v\301/\346]\344\354Y\003\240\351\301\323\273\254/V\256\312\246\377X"
+	.ascii	"_C\255\2653U\326:\251e\213\203\241\270\020\305\225\345\255Z\253"
+	.ascii	"\322ZJKei,-S\222%G\021\374\312\267\340\327,_DC"
+	.string	"\\\353*y\307Sd\3033\365\356M\273\225\345E>\330\202*\323-I\326\2739F\240\214y1\375x\272\227G\207\334\274\230~\f\r\252\356Z\300hY\231\272\340\352\016\b\214\035.x\352m\336m\251\301\372\223`\312\200 &\206\006H\305\326\020\262\272R\017\336\274\265\302te\201\020A\252\300\333\034\020x@\340\361\005U|K\034\2761\024_\001J8\206\377[E\374_\024\3760\035\361\207k\r\277\310>\341\037O\031\3761\235\341\037W\237\035\"\243\005\205\177\344j\200\037\226\222\370a\353\022~\030\313\204\237<\233\360\223l\211\337i\365\366\343\006\r\026\032~\033\203\001_\253]\362\204\245b\310\326\036\334\342\035\347L\031/\nj\377\335\026\324>lC\225F\243]1\200\341\250Q0\316i\250 %IRh\r\300\0021\031\342\346\021`\020\212q\314\242QT\220\266\003'\340$\371(h\277\027u\247m\334\233"
+	.ascii	"\373\200\247\333Q\265\017\244\032\240\277\2365\264V\bb\336^\330"
+	.ascii	"$ax\020Fk\n\022\007\022)5\243\262J\272\332\"_\320\037\203]\342"
+	.ascii	"\311\375r\272\317[\034\333\315\234\234\212\235\2153!\361s2)\330"
+	.ascii	"\371\022\374A\316y\241\311\024"
+	.string	"\221m'\241B\265\354\327<k\254\034\374\255W\b[\364\325\232.\362^\274 \232h\263dn\rjpR$\337\277\005w\020d\375\232\033O\024\025\263A\215\351W\324\357r+]z\277\337\243\320\373\274\217\fK\224\246\262\037\332\007\222\305\266t\234mb\rc\350T\301}j\234\n\324\3648\345\256\001f\212\033V\312\303\261\246\232\026\313\375\250\205\344\235\335d5\f\322M)\212\257\356HM\370.bwp\332\312h~\024\375(\372Q\364\003\212\177\277\336\211!\200l\247\343\347\231$\201V\261,t\303\026\002\3549Q\362a\375:>\210L\323\006\3234\337lr\227\035\350G\263\337\224Bp,\027\202\243\323X\300\223I\351\247\353ir\332\344\240\241\311\021\3631\314\315v\022\210\030\330\022\342\215hh%\004Z\027\277J\310\225\003\034\"\334\324\265@#\271\320\tW\254\r\2170Y\261\313QA0\2314)\\A\326"
+	.ascii	"\265\n"
+	.text
+	.section	.gnu.lto_.refs.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375`\216\001\035\013"
+	.string	"\006\330>,Pe8\3510333+;33333!\027X\246<\263\211Y\030\3324\024u0?\214Y"
+	.string	"\277\366\026I\351\233\225\204\220\275S,"
+	.string	"2"
+	.string	"6"
+	.ascii	"\357\361\235\350\213\367P\377\351\267\267\323\235\373\306}\021"
+	.ascii	"\354\246\317\372\331\233\365\352cgr\227\271+\336,"
+	.string	"|\265Y;\327\211;\370\370I \220\317\007s{\003k\367\276y\317Hx\223\034\355\342#\336\310/\320\037\320\027\320\017\320\267\364+}I?\242`\274E\207\360E\277\232\342Y3\372Q\237\tS\337A\371'j&\005\347V\234-\034\327\t\353\007\345\021\b\337&\007m\310\200\rU\322v\3363\357\202\026YW}Jz\317\300D\002\367\004\301'\220\227\372\215\276\023\357T\357\"\274\211\236\231p6\r\240?\231'\250\021\013g\036\276\231\267:\2703\263!\307i\006\274\254\205<\213c\205\226\234Qx6\254\344\227~\025\341T\364\001( @B\243\324\331\r\327\3409\0260\"R\212\207\256\034\260x\347\034\243\244\022JxPL39\354\034\274cY\355\301\241\351\260\017`\313\346\016\024\343p&\347\2122\205\305p\252\r\360\213i\201\301\272\332,\233\007|\022\2600G>\002\332\242I\016C\344\362\005i\213\257+\273"
+	.ascii	"\004\013\243=\241hG\233 \334\001"
+	.text
+	.section	.gnu.lto_.decls.8b31529782867c45,"e",@progbits
+	.string	"(\265/\375`\317_\035\213\001\212\207\362\215U \ni:\215\001\004\272\b0\302A\rFQR\215\032\342\021\275\005\200\302"
+	.ascii	"\202\024\370J\221B\232&\232\223\251\\`\"\f\331\035\0305R\261"
+	.ascii	"\275[\227\245\351\b\226\306-w:QE^0\\\327\t\243'v\377SZu\224\221"
+	.ascii	"\034p\344\263\034\323r\357-\245\224)\325\007\345\b4\t\037\274"
+	.ascii	"B\324\215\313{\033\255\305`\310Z\f\3120J\214cf\276.\323\327I"
+	.ascii	"\264\255\232\343\226\345\002\b\234\233\034\334%K\023\0357\337"
+	.ascii	"8\331M\334\017\"7_\343\320\377}c\221\027NI\345\0132\307\315\227"
+	.ascii	"\263h\377\177J.=t\322\334x\311a\254\352\330iC\001\021\022\307"
+	.ascii	"T\22066\025\312\322\020I\303\206m\307\035\037Wn^c\226\251J\306"
+	.ascii	"\271\371\032\n\315=s\313\\27\3155c\221W\315\r\363+\306\232\021"
+	.ascii	"Ss\203\\0\370J\225N\203R\223\334{\377j\0313\347x\321\266X4\214"
+	.ascii	"<\236Y\270\334\222{#\325\334\265\333\205\221j\372\305X\232$\026"
+	.ascii	".\026m\350\311\302\206j#\347\2707R\315\355\262\237\354x@%y\367"
+	.ascii	"\204no\244\022\021\2349\2632C"
+	.string	"\371'\030]\301\036\231?\221\372\347\327\375b\311\262\030\261\273\371g\017}\323\256\232E^/\337BAB\324\314\2147\257\330{o\3730\346\3710\346\317\030\372&\235\276\311F_\315&\231's\317\314\204\300t\341\251\2729\013\020\0251K\346n.S\3027\260\220u\271\371\346\232\266e:n\325\320\317\336[wbW2\216V3\216w\212\306\255\032\212\262\260\243\270\246\216b<\366\314Pr\237P\215QaI\365\270?,\233\231\b1u\266l\307\255\262lf\"\300\372$/\362\212\335\261Kv\245\334(\327\312\305r\303\356\225[\345B\271T\356\024\213\274`\367\310/\222\233\344J\036.\330\rB\347A\3105\222\001J\212\004,\270\344\235\252q\253\360\225*\235e,\306\265\001vo\334\034!\270\250\372\221\321\006\206\231\013v\265.\327P\024r[\001QU\341QC\2677R\311\204\3522\346\244\202|\235|y\315"
+	.ascii	"\243r\363\315,}\213\274M\276\3120hOE\274~\277\376\017\037\034"
+	.ascii	"\256\302\336`{\357\f8\315\221/\262\233/w\273\376\377d+_XCn\276"
+	.ascii	"K.\023\213\334\340\036\221D\027\t\237\263\261\233o\336\320\267"
+	.ascii	"\033\230\370\356\316n`\336\214\2413\322&\2317\263G\346K>F\212"
+	.ascii	"\230fW\350\314Af\2578iLn\276D\356\020\344V2\253\264)b\346\346"
+	.ascii	"\227t\364\3137\372\245\231\273E47\225\007\316\315/\323.\020-"
+	.ascii	"7\253B\223+\252%7\277\004\273>\312&\372%\022\3752K\277\264\322"
+	.ascii	"/\245\364\177s\\\034G&bunf#\252\320\207J\033 7?\337\351\013\354"
+	.ascii	"\221\371|G?\277\321\317d\264\206K\365\023\205$\372\201\203\307"
+	.ascii	"\207\331\315\317i\372YLw\260G\346\221W\306\215AD\225u#\312\315"
+	.ascii	"0\224\206\324\202\270Ar\363\263\021\375\377\272\270/,\362J\335"
+	.ascii	"\250\213\334\233l\357\375\016\240\354\234!\243\205\035\005\265"
+	.ascii	"\343\270\367\276R\267\205\2353dD\356\252\016\216md\242\354\275"
+	.ascii	"\2258\340\340b\305\3451b\346g*}\254G\037'\365\177\215\030N(^"
+	.ascii	"~\f\271\371\277Ov?aF987\337\212\201\251S\306m\314\233Z\234\330"
+	.ascii	"\357"
+	.string	"\301\r\232\337\316\331:\213\307\362\261\311\273\355\035\333\307\312\331;Kg\363\330\024\254\035\273\307\306Y=\026i\355,\235\333:\026\356\031\271w\324\336\373\026lK\n\307\264\337C\233\0323g\254\032\313f&\342\213\234$\226,u\035\274\3319C\345\336Zf\216{\357\177@\306\242Y6\254\005L\231\003\366{\260vv\215ec\331\314D\350Y\223\344\362\333\262.tk\277-\013C\307C\2334^~[\366\177\370\300\332\331/\026m\b\357\235\005w\334\033y+\346\367pkg\341\3309\031Z\354\255\345C\2028iY7\350\366\336\034(q\020\364\026\003\212\r\r\262e\263If\006{d\036\037\365\361\017m\343X9\026\211\301\272\335\276\261b^\032\221\033\271\367&\262w\212@Y\335|\234C\213`o\213\301\264ww\026\203y\334B_{d\376\346\321\277l\364\257\2301\313\226\355TY\"\343\346_\244\376-b\323"
+	.ascii	"\361\201\372\202u\363o\017\215\346\327J\237m\217\276u\243o\271"
+	.ascii	"h\013Q\264\222M2o\203\350\333\027Z\203M2/\324\035l\222y\f\350"
+	.ascii	"\020l\222y\021\332\232\3313\213\244\300j\371\207\017\216\237"
+	.ascii	"\3046\330\336H\"\241>R\372\330\335\374\005\350[\nL{g)0\257A["
+	.ascii	"\260G\346\315l\222\371[\262\337R\261`v\fK\315\320\332f{#\213"
+	.ascii	"\31213S\2147\3330[\305\"\355\330o\257X\261g"
+	.string	"1\255M\2667R\b\033q\244I\273\371\002\233df{d\336Z9Q\333\376\340W\337j0\211\356\356\356\356\254\006\363H\233dj{d\376\330\002\004\020A\332\025\301\225\363c\273\002\b\3002\215\300 \314\377\r\232\352\350~|'\331\204\200\337\364\022\002\337\320o\236Y\240\177\263\001M7y-\033d\030\001S\332\217}HapF\226\304\225:M#\b{Y\320\254\360,\351\374\337`\004\346o\336\375\230\250\tc\275\375v\003O\332\022\277\265\036\270\005\277I\200\3376\031\231\203C`\007\263\300s\357\374\374M\267\037[\267\037\177\311\371\361\005,\345\277rq\376[\347\267\0368\321o\236\3711\025\234\037\033\215\360\237\337\264\340w\205\377\375\300\177\247\376\353t\t~\323\310\177\237~\273\356\377\216\340\267D\337\340\315\217O\020\022U\002\310\357\372\374\030\314ua\342\031N\301o\372X\363_\027\377\025\301\177\253\376k\374"
+	.string	"\316l\007\022V\036\0301\365_\013\267\350\206\370\257\210\337\256\327\304\"@\230P?^\300\177\307\324\374\207\273\334\177\357L\\\261[\370\315\021\374\266\004\372-P\232\337\256B~\3417C\360\333\362\267\346\361\374\227\016\243\371/\366\3431\3775\260\276\3507/\364\370\261\0171\337\200\350G\277\251\244\204\337v0a\205^\216\3417\177\237\373q\230\377\316\255\341\017\327\204+\201\037\203\371o\230mR2\221\341\030\374&\217J\237/7\372\315\013\374\367\315\217\275\374\230\247\206E\360[\242\264\377\232\375x\003XH\227k\336\304"
+	.string	".\001.X\256\301ov]\023\377\035\361\337\b\374\227\304\1771\360\337\245\377\312\370o\005n\302\n1\001\226x4\376\213\376w\317\026\023G\372\315\b\3746E\373\357\004\005\370\357\006\007\370m\361\277uZ\224\376\017\340\277\0042\374\370\f\313'\370\315\020?\256`\354\267L?\236\240\351Z\016\364\233\n\370\261\330\217\253\374x\312\217\233\3748\311\217\217\374x\310\217\265~\234\365c\035?\256\372\261\324\217]\374\230\351\307Q?\356\375\330\370\343\021\3748\004?f\361c\024~\274\376x\370\343\340\217S\374\270\351\307\276\037{\340\307\033\370q\006~\214\201\037[\340\307&~|\302\217K\374X\002?.\341\307$~<\342\307\"~\f\342\307\r\3701\003~\354\301\217?\374\230\303\217\017\360\343\002\374\230"
+	.string	"?\336\340\307\002\370q"
+	.ascii	"~\214\301\217)\370\261\005?\236\340\307\027~\214\364c\243\037"
+	.ascii	"\023\375X\350\307A?\266\377u\372\357\335\177\373\374V\370\337"
+	.ascii	"=\277\355\360\337\272\337\236\360[\336oG\370\357\366\333\237"
+	.ascii	"\377\322\375"
+	.ascii	"w\356\267M\377\265\363\337\304o3\370-\321o?\370\257\334\177-"
+	.ascii	"\277]\377{\347\277p\377\245\363\337\267\377\236\3757\341\277"
+	.ascii	"X\376K\366\337\261\377\"\377+\344\277V\376[\345\277`\377\275"
+	.ascii	"\372\257\325\177=\374\267\303\377\245\337\376~\353\201\337\366"
+	.ascii	"~{\342\267\350oI\374\026\350\267\366\267\377?\366_\375\177\346"
+	.ascii	"?\006wwww\277\220\007\277\221\234_\004\256T\312\033S\346$K*\267"
+	.ascii	"\256\204R\347*n-\237}\255\215\321\371Io\372\2119G\346\003\352"
+	.ascii	"\346'\261\3213\204\224I\320\222^e\020<'\003\224T\376\002\226"
+	.ascii	"\334\252rtR\036K&\245\222rI\371Uv\225M,\262\364*sx\225\\`8\264"
+	.ascii	"L\3758;\002)\263\254\034K\257R\253\314\002r3\276\375\3600\013"
+	.ascii	"\3432\312%\022\353\246\n\213\236\233\237\264U\036)\215\be9\263"
+	.ascii	"\303X\026yiD\217\213=Zn.\211\3405|\206\030\207\bU9\306\021S\016"
+	.ascii	"\271rLh0\221\273\371IX\372IV\372IR\372Hw\372Hz\364\221\342\364"
+	.ascii	"\221\340\224>xx\205i\335\270\371Hd\364-\262\354\301\343\310\026"
+	.ascii	"\022$;^\362\310@\003\t\225\233/W\352\320sU$\005\035%\226}c\343"
+	.ascii	"\206\256\304*sd1\032\241n>R\027}\244,\372HV\364\221\230\350\277"
+	.ascii	"\254\021GE\f\227YyUN\235f\216\270aRN\345;%T\\\262\234*\245\320"
+	.ascii	"\224S\371Ln\333K\356\312\251\334&\333\0312\"\367\323P\334U9\243"
+	.ascii	"\244*i\224Ve\225E\226S%\214\2271J\031S\345Tn\222\305\fE!\367"
+	.ascii	"S\206\256;{\210\252\311T\232\n\271T\263G\346\221x\350#\325\320"
+	.ascii	"\357\240\317\355ZSBe>\"\254\311I\356\215\334#\342\213[2O\236"
+	.ascii	"\263lf\"\222u\222\345.\243\312\247|W\032\313\026\245\213\362"
+	.ascii	"\205E\226P\267\233\223\351R\370BG\254\204\312x\326\340\222%T"
+	.ascii	"\256\263h@J\206\346\326\216\034\215\362\221d\350\037\335\351"
+	.ascii	"\037\351\321?\252\243\177\324F\377\350\213\276\034\233df=Ag\276"
+	.ascii	"4\271\273\371GcY\356(L\377\250\211\376Q\022\235\223@ihXV7\377"
+	.ascii	"\b\207~\223\337\206\214\026\366^\222\026\227\353Xd\206\203\313"
+	.ascii	"np\231e+\222\247\234i\241\3432c\346[1q\270\034\347d:\331\315"
+	.ascii	"\"\363\333/\234.\307\267,'\303\020\203R\027\205XE\210\235\316"
+	.ascii	"7\242\3237\272\243o\004\247o\024G\337\250\215\276\221\2315\231"
+	.ascii	"Mf\263\310\334\3664|\216j\256\334\236cn\313h\256\034\2236/2t"
+	.ascii	"\034\fa\325\250SF\347\033u\3217\302\242oTE\337\310\211\276\305"
+	.ascii	"\002E\314\213\f\235\230,%\257Y6\263\275k\030\240k\313\213\f\035"
+	.ascii	"\332\223\030cSI[&&;\261s\214\032t\265y\221\241\033\223\311d3"
+	.ascii	"9L.c\221Y\314\177m\344\257,&G\271q]^^d\204"
+	.string	"\226p\275\201R!\2039\323\334\332\204\335|#\243~\007T\244\034=Ta\222\226\273\344/\231K\366\222\267XdV\313Z\262ZF\243\222\234r\273\246d\265\034\026E-[\311g\370J\025\004\332,\341 \223\251\333T\206\362\213\354\364\213\334\264Y\317kn\354\346\027\235\321\267`\271,\217\035If\311d\031\213E\346\262,v\345\312\0259\226e\344\225\263\362\300IU\033\031:\016\200\224\374\370\021G\347\027\215\321/:\323/\302\242_tE\277(L\277\350\250_\024D?i\223\314\027\345\320/\272\322/\242\241_\024C\277\310\250o\001\217\276\2056\372\026\326\350\273\263\327\006:\n\f\032X\356\312J\370\\\331\371\272\371-+\271tn\234\251\304\310EGg'+\271sj\222v\262\222{\347\352\261lfy\312\232d>\346%\231INb\221YI6\362|$#\311Jn].\362t\242}\341\242\243\333{#"
+	.string	"\317\2362@\031h\333$\323j\331#\363\026\236\350L\344\003Qz\364\334|\013J\364\265\253\313;j\\"
+	.ascii	"\305\270\225E\227}`3<'\004\027U\020\340\312J\346\301)\320\030"
+	.string	"\3531\206yhpr\265\225E\367\341\203\354\003\213\3358\214<\236e\\G\222}\356\035\236\302W\252~h\2141I\356\275\373d\037\230\006\266\272\352\340\244m+\213\356\332\310>0\026\\\206\221j#p\025I\356\275}\3407\214G\303\327\227\255,\272<$\003\311Z\271G\336\312\\\371G\346\221\205\344\254\034\304\"\263\017L\347\227\356\246\220}`\033\370J\006(\251\275\257<p\"\266\225E\267\367\316>p\226\333e\331\212l\343S\b_w\266\262\316'evcJY\307\222,%d7\237(\217\376\237q\344\0339\207Ef\254L\205\3372\r\032X\222\344\252l#\004\027U?1\336,If,l\227[p\031 \214\227%j\034\234wi\242\260t\3165\254\344\030\271\203s\365lu\246\243\b\227\234Ef\253\266&K\264\334|\"5\372DhzF\236\222a*\0312\205|2CF\f\343\223)1\236e"
+	.ascii	"1\351\023fvs\206\221\367\224\f8Wn\316R\026\315\215\225\217\272"
+	.ascii	"\233\263\213\374\342\306\332\213\267\027\026-\315\f\250\034\025"
+	.ascii	"\244\226DRv\363\211\2642T6\232]G\226\320\310O\317F.kh\266n\306"
+	.ascii	"|\362\376\377\243\255\266\316\250\362\306wmu\326hq+\277\240\312"
+	.ascii	"\004\351\203\265\004\315\211\261\341n\306{\200\336\342\316|!"
+	.ascii	"\302\322'z1\207\351\364h%oz\334\301sX\317mc\266\345`\271c=\346"
+	.ascii	"\234'1uo\370Nr\017\016/Ln\376\220\030}\213\304v\216\223\227K"
+	.ascii	"\023\030[\342\216\223q\025\352\320\250\261q\363\3450\334\377"
+	.ascii	"\237!8U\322\300\334\374c\270:CSm{\253\016\246\363\243G\016\037"
+	.ascii	"*7\177\210\213\376P\231v#\002\363$E\307\315\037\232\242\337\001"
+	.ascii	"\216\203\317\246\300\301r,\022\307\301Z~\367\\>W\212\203\321"
+	.ascii	"\260\033\313\206eaG\301\245)q\020T\246\305\02703\273\301bp\333"
+	.ascii	"\020-\3076\370\215Eb7w\203\267\3405\313fF\342I\227d\276j\302"
+	.ascii	"\365\306\314l\230\215E\3426\274\306\fV\223\001J\212D\236\260"
+	.ascii	"d\033\036\203\313d\200\222\"\261v\226\324`\216\254\0311\363\207"
+	.ascii	"\226\250I#\004#\355+\316\031\214\006\350\006\026\333\332\315"
+	.ascii	"\037\332\322gnit\2658s\363\207t\350[\344\353`2\207C\202\006G"
+	.ascii	"\330\315\037\262\241?4\245?\004C\277\2035\334\005{\261lf\"\320"
+	.ascii	"\200\301a,\022\257\341/x\r#7U\020\f/qU\206\230|Q\t3\363\205\332"
+	.ascii	"\350\f%*K\232\233\261\032N\023\202\363\021\246\311\315\027*\243"
+	.ascii	"/\364E_H\213\276P\231\276P\230\276P\227\276\220\021}!!\372BY"
+	.ascii	"\270\354\307d6\315\316\261\347\325\332\225/7_(\2076\355\221y"
+	.ascii	"\241\030\372B[c$\006\242 D\214on~\205\244\276\201{`\344q\004"
+	.ascii	"\024\215$\030\266\202\303,\022Wy\025\354\003{\205\340\242j\002"
+	.ascii	"PS\311*\230\312\321d\200\222\332F \035\272RhS\207\201\003\016"
+	.ascii	"rY\2212?t~\005'\3726\355\b\006\313VD\004/4\017L4\250I\301^\370"
+	.ascii	"\0076\222\001J\252\0042[\222I\036\306\354\270dJ\322\214\022\r"
+	.ascii	"\226\315L\204\032\030\366\302\307\207Y\022%i\313\260\027F\202"
+	.ascii	"\3014b\244\315\006\335\336\373?\216\202\247\340/\f\005;\301O"
+	.ascii	"\260\024\334\304\"\261\027\356*\313\260\320\331\031\345\007%"
+	.ascii	"\365"
+	.ascii	"\203\334\364\203\330\350\007\225\321\017R\323\017:\323\017\272"
+	.ascii	"\242\037\004\245\310}\212k\243\272\371AC\260\020<\304\"1\021"
+	.ascii	"\f\344\266\fg]\t\271\367\026-\3145\364T\264w\220:G\"8\b\346\262"
+	.ascii	"lX\310}eT\307\rJ\024\334\345-\017\0263\037\350\215\3761\027\336"
+	.ascii	"\n\352\023\346\243\017\336\302@\206\2520\231\021\344\346\003"
+	.ascii	"q\321\007*\323\007\262\242\355\266I\346\201\242\350\037\347\270"
+	.ascii	"\30250\017\017\224g0\316\274\270\031\353\300;\216y`\254\215y"
+	.ascii	"x\240\265\267\021\363 \332\263\267\221\310Z\f\254\305 O\341b"
+	.ascii	"\242\305\314\007\372\322\030\207\207\343\034-\212\314\270\272"
+	.ascii	"y\003{d\036(\211>\020\021}\2216\311\324`\217L*\\e\333\350\251"
+	.ascii	"\203q\363\201\260\250\200\250\364\f%\242\032>\262H\335\374\237"
+	.ascii	":\375\0166\206\302W\252\264\026\";0\f,\303\"q\f\034e\206c\340"
+	.ascii	"\026X\312\262\231mc\r\r\360t-QS\342@H\013\235\035\0163\273\300"
+	.ascii	"/\210d(y\201\004\314E\227\376O\017l\274WX\216\300\270\371?U\370"
+	.ascii	"\351\007\206\276\326\243\317f\217L\213\264I\246\222=2\237\274"
+	.ascii	"\2435\322&\231V\312\036\231\327j\364\177\361\374\352\371\225"
+	.ascii	"\273Z\027*\250\355q\201\343\346\207\271y\214\214y2r\363\265\030"
+	.ascii	"m\337x\370\305sdVa!\267\331\336\233\b\253\211q\261\347\346\353"
+	.ascii	"-\332n{d\336\270{\341n\3627\356\326\371\207N\240\334\\\201m\f"
+	.ascii	"\032,g\230\222\356\210\207\317\214\233\221\025\250\250\220h\235"
+	.ascii	"`\312;:n\362<"
+	.string	"!\203\324\262\316lx1\331\366p\211\273;\325\314;\"9ZBf\234i\347\220\035W\345\352\252\331\3218\343R\3621\231\324\241\233\333\002g\210\316\314\033\030'\232]]\026$S7\237Y\316,\347\231~2;\236f?\317\210\342\324\210\320\231s\314\223\344\351\346k\220\324'\226\023\213\007^\360h\320F\377'\231\371\003\211<\305\224\264p\233\031Y`Q\202\236\034\237\344\\\371)\206e\246\214\224\323\313,\223\347M\313\f\f\354\254b\3056\225\345\322\221\005fu\350\211\"v\206\375\254\"\345F[\227i\274mG\310\262\334|\r\214<\371\223sJ\007\273_\240\t\321\221<rc\311\213\023\312\317)\247\2249\031^\340H\211\222\321l\221\361FH\2372q\032\330X\262\344l\002\006y\367\244\001P\334`\371\372\331\3044f)\"%\316\315'\223\323\353+)$\315\353\354b3\203ck\r\00633V\307\033\006"
+	.string	"u\244\270\334|\271\n\\\330\224q\271K\222\304\274C\n\203\272\323g\n\f8?n~"
+	.string	"\346\212\0249\217\214Q\273{\202\275\034\271\2533\362\363\b\320\020\036O`7_\356\244\301\246G\217Y\234\255\255s\210\222\326\323\035\raPz\274~\304\250\231ad\310)\204\307q\013\225\233\317 \025\356\342\264\261r\363\003 \346\344\n@\025--\363\016i\317\f*WBk\256\322\254n~"
+	.string	"t\360\340qf)i=\331\321P7\003\312\036\"uas\262N\037)\350\320\342s\363\331\303'$\313\332\315\317@N?\003\270\253\253S\207\222\326\223\235\005\204Q\273{\022\344\246\205\346\t\353\247\216\223\206M\022\247m\314\315g\216\013\346\205\024(S7\2378J=s\254pIr\363y\343>1F\275Hs\363i\343V\021\201e})s\363Y\343r\331\251\301\201\361\243\314\310\233*7?\2035\372\377\317\030\217qVY\261M\245\024\226\304\322\220\347\330t\251\235T?\253\364\033\272=0n>e\2344\376\377\\$k9\276N\032\347\024\031\032g\220\224\345\035hke\316\031\367H\205,!;\342d"
+	.string	"F\377\247\324)u\2534\214\275\267v"
+	.string	"\255\315\370Z+R\302\006\345\346g\260\245\377\323\305\351\342\306\211\200\265\237\344\316<3\274\274\350v\025\231\002xP\253\222\272\371\030\310\351\377\214:\243\256\231\bXb\373*h\fF\026\330e\263\305\313\034\233\363\351|:\215$L\253\257[w\346v\347\247\361\247\353\213k\306\315\307"
+	.ascii	"\311\207\217yG\342)\351\256\315\211"
+	.string	"\245\311\024\017\263\317\315;!9,lU\252\376\377\230j\250\366\324\335|\fhh;;kW\303\304\341\326\307\306\315\277`N\247\220B\266J\341\253L##E\347\346_`F\337\224\263\346\334\\y\007Kmc\020\0038\251!\246o\313;\246\035;f\23690\330\253\313\214\0357\233y~\"ZY\276n6\357\224w\376\377d\253\344\034:\267\377?\266\016\231;57\377\002\"\3727\343\342Lc\b_m.\300\241\353\324\311Vx\204\274\206\214\345\270\371\027@\351\233n\326|C\232o\267\212\3046^i\340e\314\0029}{\253L8\246\0348q\342d+\375\264\267\016(&O\242l,,\r\272\255K\230!7\337\0026}\013\310\332L7m\331\252M\233l\245\307\254\001\005\264c\307\017\0337\337\002$\372\026\310\320\277\251\346\026i\2521\331\206d\340\341:\002%\327\214yn6\327X/*\025\330\351W"
+	.ascii	"G\377&\032\2134\321\224g\"\230i\031\273Bp\002\245\307+\b\016"
+	.ascii	"F\034%7\277\002+\3727\315\230\261h\371IlS\001\275\370\272\323"
+	.ascii	"\207no2\005\3007\324\256\230\335\374\nj\220!\023gG\036-FL\266"
+	.ascii	"\2625\3000"
+	.string	"y\022\345mm-N\307\232/_\372x\321jju\350\216d\272K\227\017\312@Q\340D\337<\263&\232yfn\271]z\253i\031H\354(0\242O\001\017}{\273L3\263\024\216TeeH\322P\320b\354\377\360\201)f\222Y4\275\217'\232\f)s\372\031\342\\\271\302\204\214\025+\331\352\255\307\321\354\311\0233\314\r\315\021\312\315\260\233`APJ\264\362\334|s\212I\345\377\031J3\345\353\310\315\317pE\233QL)TW\334\304n\376\315@e\003\";q\246l\271\371\007:\332%Y\222\201I\2237\311Vw\357\275\217g\026\"}\222\031\204\350\233Gkz!M/\213\326\341\324\322b*\231\241\207\276\265h&\023&v_x\224()\357\352\264\305\255\3355?\322H\201C\202$N\3301\215\021#k\306\270\350\337$r\2134\211\224|D0\323\3325:|my\221\031BsSK\336|"
+	.string	"P\321B\204d+\273w\232//\375\233\\\267H\223\253\264\023\001Kl?\235\\\274\270\350\204\342\242\330\321\272\371"
+	.string	"X\242\201"
+	.string	"\311V\0266\324\2332\307 =\314\254\036\346\017so\213\324\242\252\332XU\032\314\037>|\\8vWy\020\006"
+	.string	"7\364'\270\3237\261\254\271c\307u[\200\023\2507}{\335\314\2337\254\231#\307e\303\325\341\253\006\233\276\275lL\0336\262\025\037\256\t\310\364\315*k^!\315\253k\206\245\266q+\204/(&O\350v\025\262"
+	.string	"\237`\212\276\275f&\025\325\205\243\367\336O\310M\205A\256\006\226\006+fn\306\331\315\237@K[\2449U\322\345(\261\375\264\362\311\002\243\333\033\253"
+	.ascii	"?]l\222o7\177\002\030\372&\224\031u\263\305[\2302\354\336{c\355"
+	.ascii	"';\037\344\370b\362\204ncUi\370\315\0307e\250\221\202\322\344"
+	.ascii	"f\023\306\317\317\3161\247\353\346\313\231R\377\177\202\370\320"
+	.ascii	"\370*r\363oJ\231/\272\by\262\202\261\325\366\250\3412]\334(\032"
+	.ascii	"\\an>\2063\372\376\3466V\355\275\257J\344\256\202\252`\376\366"
+	.ascii	"\266\264V\303"
+	.ascii	"/d\261\315\340\177\376ST`o\027h\344\354\275m\036\375\225f\344"
+	.ascii	"q\301.\331\366\216\332z\022a\313*j+\207\024\331\226U\221\024"
+	.ascii	"\331\326~\212Z\362TT\265\267\236\244\310\366.\212\212z\022\241"
+	.ascii	"e%Ef\334ERd\333j\267h\263\262\033\271\365\264\243\264v\321\216"
+	.ascii	"\332\306M\246eu\201T\324\226\225\024\231\321\252H\212l\313j\223"
+	.ascii	"mm\013;\312X\005#jW\025m\262-;\233L\313\312\202\024\231\226\225"
+	.ascii	"\024\331\326\034['c\t\016\034c\344(Yb\331HEm\032S=\214U\026\330"
+	.ascii	"\244\220Z[\316\336\326\314\305\256\332l{g\260w\017\255*9\306"
+	.ascii	"\034V\r\212\215\006\324\026\243\226E\356\2751LAqi\355(\266'\273"
+	.ascii	"\331\244\232h\355\335\004\252iO\355\275\267\007OH\266m\304\262"
+	.ascii	"=\005\351\261g\270\330{\202\215\334{j\357'\273\331\366\336O{"
+	.ascii	"\357\263\252\007r\357\035\026\244\216SS{c)M\355\036O^\\\354}"
+	.ascii	"\315\346\250YI\221qiy\360RFv\334/\220OVj\206\326>n9[U\232\354"
+	.ascii	"\351\312\236\261\367\266x\364\321\252\306\235\233\341\314'\323"
+	.ascii	"\215\021/sn>\206\"\310\241\2726Ts7\367Q\372\201\343I\231\233"
+	.ascii	"\217\001\210\336\223\3135x\304`\271\371\030\246tY\367S%\213"
+	.string	"\231-7\037\303\013\244VRF\013\330\315\345\334R\235\2254r\245\334\220\036\031rcn\276\022\233\316\203\347\216\246\003\243\n\312\235\322N\2050+7[\312$\021\327\220.(7_\251L\377e\\\t\007W\247\024C\307\r\033+8\250\233\237\301~\017i7\316DR\343\2033U\222baJ2Z\320\204\035\315XI\272)\325n\327y\326\206\353HWr\351r\343,\033\326\002\274\314\264)\333\3127\345[\t\247dS\272\225le\234rN)\307\"K7e\232\227j\3125\317\037\240m9\221|q\035\351\334\224^\3125\313f&\"\017\227\344Z\351\246,\203\335\240\270\216Q\314</\200\314)e\253e\223L${d^\tK_\251\205\376\205;\372\027\316\350_\270R\216\021b\313\341\246\345\346_HR\212\321Q\202\261Sy\204<\271\371\027\242\312/\022\330\321\227\200\215\276\004`\364%\250\242Og\223\314K"
+	.ascii	"D_\202+\375\227Z^\236\275\370A\266\306\354\345\331\323\256\326"
+	.ascii	"\005\rC\216O\335\315e\026\017/\315\026\200$\310\224\233\261="
+	.ascii	"2\377\022.H\313\021O\027,\032\204R\200\003\025\205lL\0021b\300"
+	.ascii	"\211\275\0343\333{_\bb\202#\f\334\315\037<\274\0243\243\254\001"
+	.ascii	"I\341\312\225\2727\\\224\235A\242\261R\205\354\306X\214\213\324"
+	.ascii	"-\276z\330\b;\225\2565`\304\334|k\306\306\333\021\254\234RJ\261"
+	.ascii	"\310\222J\031eFB,"
+	.string	"P\240\223\372\023\241\2420\004\002A\254h\223\211\r\200?\324D\321\2336\250M+\032\344 \034\006\203\303\236\360\207\022WU8\354\375\200\340!\310\207\246$\320\025\025\341KW\234\220\242\2276\205\230@D\005>\341\017\005R\211T\370\013\022\3235\365!\235\251:\004\366\210R\336jA-\256\350\272t\341M\0338\244(\3167mH\203\277u\202\225\247\232\220\006\177\253V\177@\340/h.\tS\247\341P\320\2336\224`\202\204%\016k\312DDS\364\206\300\020)q\030\202\350M\033|?'_\272\242*~k\017\204\212^ \365\r\203\304\037z\264\022\207%|)\360\004*|\300\005\302\341OU\177AU\210\022M\254*ZB\332\023\376\226|\251\352\204\226\220\006\177&\232\230\212C\341\003T\264\311\303J\034\226H\211($H}\031.\254x\300\004\026\214\322\340\317D\n\354\261\b\261\252(P\b\t\350\023\242M"
+	.string	"PJ\321K\233z\026\254Ho\332\240\002\207\304U8\354\361zD\016=\024>!\032\f\016C\364\210?o\332\300K\203\277UX$r\350\241`B\201#\230\204\277 \021\r\n:\235\240\202HA\360[r"
+	.string	"q\002)p]\207\304\246\n\322\340\317\004\223\360\347CS\022\300TEZ\0020-\216\360\tSU(e\252\340\024\0041\024\344a\003\020\230\206\020\032\376\210\250\005\204:l\360\245\304b\2577\201\025\277\021\252\023\023\321R\211\2414\005:BU\323^\01759\360A\003\035:P2\t\207%\254h\t>a\252\006\005\213\022H\201=\026=\375A\005\301b\375\001\321\"\005\200\250\220\351\267\224\256? \020]\321%\2370U5\f\211\350\211\354\301'LU\013 T\247\021|\302T%\032\022Q\007\370\204\251\252{=\024\373\204\251\3723\324a\303JD\235F\244 \370%\035\255\304a\211\021)\261\330\003\300J\034\226\370Y\n\246\253\312bI\202\233`\202\t&\360\206\353R\211\021\210\336\373\021Sa\312\244\357\001\b\007"
+	.string	"!\204\025\347CH@\207\004t0\037B\002<xH"
+	.string	"\b\036\364A\360\200S\036\223\360GD\233\226\326\2257\"\r\242D\fo\332@\301\nT\370\013\032\241\260\242'TH"
+	.ascii	"\004\246\275U\230\252)\321i\035\nW\364\204\n\f)\317(\345!\245"
+	.ascii	"=bq\270DL\327\324\204U\230\022\211\305\236Q\b\242\025u\200\005"
+	.ascii	"R\265(\244\256\304\024\b\"D\252\026\221R&\224\210^ XT\205\303"
+	.ascii	"^\006\365\247\246\304tUY4\255\350\t\025Co\332`\201\3123\3277"
+	.ascii	"m \246k\032\034\022\321\023!\206D\364\004R\272\242\300b\017\210"
+	.ascii	"\366~\314\265\250Y\240\300\324\307s*\352uu*\362V\"\272\252\332"
+	.ascii	"i\002C\"zBH\345\251HE\f\211\350\211\037\247\"oM\231\314\025\b"
+	.ascii	"bHD\035p\246\304\342\232\232\030\022\321\023D*o\351H8\374\251"
+	.ascii	"\304T\305i\001 0\355\005\245L(1u\n\242Z\210\002J\024\321\004"
+	.ascii	"\"\250Waq\030\002\bL{?\2530\355\021\323\022L\302\237\360\207"
+	.ascii	"\006S\242\205\224\227\256\350\2724\224\256\350\252\226,\326_"
+	.ascii	"\017uB{\232\0051]W\364\304\271\362\324\024\310$\004AL\201\305"
+	.ascii	"\007$\275iC1\370\343\26061\375\200(\224\200\300!17\365\326\237"
+	.ascii	"S\211\002\312\002\2530Q@\211"
+	.string	"+\252\203!|\351\212\006\177\253\232\006\251\301\020\303\037\021U\241\203!V5=a\256\303&\325\t\025\252\034.X\321\245`Qh\252<tEE,\251NLE+\020\305*\2577,Aub\022ZQ \026\016\201\270\t\b\304@\224\267Tb\204\n\2764uZ\nJUbq\030\302',\016\211L\025\234\206\276\246\f\034\252x\305\017\005N\203C\022+~(\316\237o(\r\016I\fM\020\177>\"\325\211\t\277iC\nL3Py\275\036Z\256o\332 \200UH8bM\325\224x\252<#\037\232\236Pt\n\"\021\327\022\302\021\304tU\177L\351\tE\247`\022\n\247p\370[Qb\261\350\024\264\260\376\204$\bG\254?\341\317$\256%z\302\342\b\037\232\236\320\353\201@Ry*R\021\275\036\252\205#|hJ4W\225\367sZB\221\212H\235X\230\340\221Pb)(\355\t\321U\025\376\364\312\233"
+	.ascii	"\tY\370+!T{\346\317I\305o\332\240\026O`Py!>\220\020\024\342\003"
+	.ascii	"\t?>SUS\242\317\207\236\275\017?\\\344\251H}j\361\204Vyi\357"
+	.ascii	"\247\"\025\241\026O\004\245N,V\265x\342T\213'\360\b\036x\275"
+	.ascii	"\036j\242\200\236\020B\004\b3\365\rC\250H\211\025X\370\320\364"
+	.ascii	"\004t"
+	.string	"E}?+\021\357|\323\206\265W$\256\352\007\225\267\"]\213\301\242\024\275!\220\3073Waq\330\343\361Nb*Da\310\343\235*1U\213B\036O\373\204\277\024<\236\251\n\177N*\217w\002S\036\357g\345\255\352\017h\341M\033\324\324\211\305z"
+	.string	"_JD\233\324\003pP\327\337\t\016E!\323\001V\024\205?\340\001<"
+	.string	"\201\007B\b+8\244\276\"\260'\374q \252E\016\bXW\244B *$\246\253\360\307\363\241)\261iu\342\361.\250H\211N<\236\271\252? \217g\242+\352\343\361L\"\332\324\313)\b~*\217g\246\350\r\2019\345\t\231~@\2247$d\372\001A\364z\250^\337\264\241\350\024\344\r\211,\230z=\224"
+	.string	")\357\204\016\037t"
+	.string	"\241\350\024<\022\016\177k\0218TS\"\220\312CJyKE\247`\020q\250\nS\325\\\201E5=!]S\021E\247\240\221\212\324\207\231\204?\240S\020]\352\365\320\243\263i\035\016\203K\275\036\372\003\034\016\035\300+\323\236p\002\253\212\246%\254 |\351\212\372\234*"
+	.ascii	"L{=\020\352\017\203pD\272\376\210\027`\221b\211\210\"i5\032\376"
+	.ascii	".\\0J\241\242&\b\207\277\265',\242\250\220\362H\220\300I\r\252"
+	.ascii	"NLE+R\237\220\204tE\211\276\"z\202\267bx\"E\017\005\236\220`"
+	.ascii	"}\323\006\016*1U\361#\372\210k\211T\305/\355\245'(\255<\020<"
+	.ascii	"\244\350\241'\200@4\304\n\"\220\312\253`\201\2258,\001D\177\304"
+	.ascii	"T\265\220\002O\240&T\230\304\364\207\342\267\nS\337\017(\345"
+	.ascii	"\245\276\241\t+q\350\004\224\372\206\301\234\362&\260\022\207"
+	.ascii	"NB\252p\370[\235\206g\272\242'\370\212\350\t\235\202\340\267"
+	.ascii	"\224\202\340\267\244W\355CS\022\304\n>4%\361\241\203U\370+j\340"
+	.ascii	"\0175ALQ\240(:`\305Za}\323\006\325\211\211\303\360\207\024"
+	.string	"\f\006\203Y\345\005\203\301\240\t&\210\020!\202I)\030\364\371|\345\2336`\360\241SJ\344\260\016\207D\016A*\217\351\207B8\fQ\264\242\026V\036\b\036V\341\357L}\305\365\307$\034\226\260\3427b(\001\325\211\251\250\251\267\376PP-\370\322\225\230\252\020\376xF+R\240SQ\004\n \332\004\224\362F\370\210\303a\b\325i\204\244\025\r\022\207(x\351\212\n\177>\342p\330Ky\353OX\201\240\365',\002\t\207?\365\327K\211N*\212B\005\357\002\020UALW!\t>aq\270\024$\242@\020\353:l\222\300\204\nBM\213@\324\002\276\237\023R\312\204\256\300\241\n\036\020\230\366x+q\350\224\022\217\212+\272\252<_\352\023\246\353\2124\203\nL\205B\264\251\307\353\021\225\204\303\337\372S\207NI\036V^\b\253\360W<\323\025%\362>\240\304uE\312K!\374\001U\240\301\243#"
+	.string	"\001!.\250\200\004F\320\275\r,R\250D\024\034X\020\3274\230\002\323\225\203\360\207\0069\364\210*\207\r\031\256e\007\032\"vg\335\215\253\375\006\n\315\236\233\363\3449\351lU\003\320\360p\035\351\346\302\236\306\236\346\364\234[xt\274\311\231D{\304\310\336\234re\2322]\324\260\334|\001\234\321w\356d\2537\251\343W2\231\255\300\200\021"
+	.ascii	"\020\375\237qg\225\2401\251\":\340\304>\240\345\b\247\316\255"
+	.ascii	"\322gpl2\350\234:40\343\306\305\333y\004H\b\034\232\343\034\323"
+	.ascii	"\030e\255\352\213\333\331D\033\031\233B&\347\234\222\205\316"
+	.ascii	"\212\2168g\325\220\\\026\224!l\330\234ond\334\033j\357,$\347"
+	.ascii	"\236\031sz\320m,\033\032\376\323\315\3177\017S\272\240\223\247"
+	.ascii	"\355\346\263\315\303h\2733+nn>\333\036\346<\243"
+	.string	"\206\353\307\315\227{\230\033^\250\244\271\371\032\354\321\377\311\326e\346ha\207\266\306\fK{j!C\215)#J\312^r\363y\346D\3633\315\3174\367L\203\357\356\31407Y\314|\222\301#\270\273\273\273\333\263\267\361$sO3g\231\237dNt\312\211\"e4\307d\235I\013\206\244\250\203\022$z<\224r\020F\035B\312\330\220\314(\351#\025@0PP$\225\312\265\331v\023\200\303\212\252U\211$'\035\204FFF\002\031IAAQ\n\313\001c\261\260\237c7\370\005\266<\260/\023\013\237\336\033h\321\332\325\324\224p~*\251\fO\333\315\222M0\360\360\276o\254\257~IMF@5)T\032xS\316\3367\364\360\360\026@\226m:\226|\366\217r\217\325\307\2054\005\247Y\236\336\fAH\306\032\036\310\343\020\257\266\217\2570y\202j^\351a\360\f\251#A\264V\024\236\332\177\327\265%"
+	.string	"\302\024\271\305\366H\262\353\3437\300\005L\301&\202\272g\204\037\013 \2257\032fH\271.w5\242\027f\375y\001\031\211\272WQ\301\361\240ws\202\0016eJ\326Pd\036j2+\336\375~\244\200\004\230\020\b\215\365\223\020c9\"p\034W\312\235\303(\320_\347c\n\306FB\016\1771\347\330\303\\\224\231G/\035I\224\365\205 \227\341\\\240\020\316 \350h\254\002\241\324\005\203U\212B\"\204d+\024\307\006e\027\256}\322\355\030vb\302\336\036#\317F\340:y\217\f\271\216\242\3164\025\303\216\254{\272P\363(H\307\223\202\233J5\003E\272\2351GL\232\324\322\335\226}7hgh\360\332pW\365\030\260+/\375G\212\321\304J\334\266B?\255 ~\216\177\331\362y\245!\346M\256@\355K\323\273\245\316\255i\245z:RbR"
+	.string	"^/T\316\334\207t\327\337\323\237\320\005\354~\355\370?\002\314\312Q\253\030\350\352\022\372M\037l0^\301\331\247\240%\f\302\302\223O\241q\333\206\237\345]\205d\250\360v A\013\361t\033\304)\253\332Uy\355Std\366\320kG\230]\306\352\324\231[lh\013\331S\333*gf\0344\354\343\016\005\333\356\356\232"
+	.string	"\266\242\247\276\034*\210\2312J\325\034\242\217\"\\\221\203\226\224\034\204\371RMS`]\363\322\330G\320[\264\321\316\272\b\005\031\r\thB:\313c\231\203C!\374G\007\342\272\222\242\305\260;\343\262\340\024\024\350\235;\n\247LC\3315Q(u\264\310X\277$X\245[\361\031\002p\310\322\270M\035\251f\376q\n\227\253\203\352y\364\242Cu\277\324?\321\326\357\033\"8\r\270@VWUR5\327\006\212\233\376+\256\036\277]b\216\016Xns\2450\361\266v\230\234x\343\024\020\255m;\340\365g6~\260\214]L\213tF3]\321\260\373=_\035\027\273\363\036\351zK\356\021\267\201V\271\344^(\220\243\007\216wn_5\315\311E0\r/\346\343\354\2171);\220{yJqe\231f\333E\354\210\201#\255D\212\361b\231O_\227c@\251\236\021\003x\r\347\374\207\315\224\270\274\021\332"
+	.ascii	"\0042\004\f\235p\305\202\302\353\361\252\247\"\013\226@\365\317"
+	.ascii	"\203Hf!\323=\001\2733\001\023^\nn\022\2516=\302\022\232g\216"
+	.ascii	"\360\264\216\207mu{\325\223\031\340\b\376\353\032\210\307^\\"
+	.ascii	"\375b\363y\227\275,\037\032\236\360H7\016\025{\355\255\342\340"
+	.ascii	"\327Z(\336\3479\250\232\362\340\307\026\3111L\370\276\215@\254"
+	.ascii	"\232\255\235\236\323 \303w\013\336`\230z\336\016\177+\002\226"
+	.ascii	"\331\233\b\302\311k\340w\326\2466Cb\037\352,P7,\376"
+	.ascii	"\025Hq\221\0229\367\013R~_88\025\007\325#\222uU\312[f\270\013"
+	.ascii	"$\365\016\300\2422\323\003\212:NO\202\252\252\257pX\204\273^"
+	.ascii	"vEg\324\344\356\344\037*\220\345\036l\350c\217Q\333\r\272\247"
+	.ascii	"\005\320O\344v3t\316\302\277\273K\335\320[\"ssRK\227>\212\323"
+	.ascii	"@\212\344\322L#\340\376\272\252\034\271\363\330\304zt\3320 \007"
+	.ascii	"@\r\366M$5\206\330\213\251\365\356\255\277\"B\3573r\244\265d"
+	.ascii	"\333\236\251Dg/\363#D^\3021\nQ'\242\032teZ\266\377\376\223[\304"
+	.ascii	"(T*B\324\344\023\237e7@\262t\243\353\356\371\207$8\006\211\035"
+	.ascii	"\376\364\2642CY\017>\223{\373i\302\212*0\320\002\260\333\301"
+	.ascii	"\2358L\370\001)\254*u\330\344\350\260\310P\331\266,\215\212\276"
+	.ascii	"X\024\345\225}\351v\326\t\243\2342\022-#=\270D\031z\350\373\211"
+	.ascii	"\334\2515\356\310@\220U\256`\277\234s&\216"
+	.string	"=\251\3668\246\207\351UU\372\377\273\225\333\370\301\320d\255\207<\021RA\273\311\346\367\207E\355\271(\252\030\252\341\002INSFlM\262B\250\303\240]\365A#\223v\340\034\344\263\0169\346\323\366\2542\f\200A\241\324\033z\351K\370\220d*\016S\243X@\363\372\300\205\300fL\036v\fc(\033\333B#\266\311\374\021\366\225\310\\\300\343\327\241\275\211a2eUnaA7\265p\256\367\"r(\210\3379\2300\200\253\003}\323r\bh\255r\330\206\035\032,\214\210,\3671_\031\255\353\034\025\343\221\376<\320\036US)+\215l\3416\225\007\355\254\241\234Y\240\214\235\\\354\276\022\322\237\254o\344\312\032Z\rKZ#q\233\002\356\t\"\220\332\fk\343\210F\277b\315jH|M\373\306\3334b1|\202j\212\366\2476\033MK\324ZpT\315Q.\202\334\334=\003\347\226&\270\354\331M\""
+	.string	"\212c\321\354-\"\020\233\221\214\226\203\313q\254\345\340\326\334h\342f\271\304\371\364\260X\216C\033+\\\240\311NM\254\362\2126+3.\t \305^\304+\311\025z\372(>\334\351\024"
+	.ascii	"\372\346\305\354\274f+9\205\353\217\200\251\2400\321\211\334"
+	.ascii	"\033\340\204g\354v46\220\314\036\212'\r\231\203\202\336ySdH\242"
+	.ascii	"0P\223\247"
+	.string	"\227\244\"\356N-\340\317-\0057\034\260;\226^\277t\337\234\264s\024\316\020%\203\371\362\361\240#\270\321+\356(7\223x|\277\361D\350LO\243\311\233E\016&\304\267\236\344\240\3449LK\"\272T.$\246D\240d\027x\177\350\361\265\007\035\377e5\330\352\237\242\nzs\241\032'\317\375\224\276\035\201i\246c\3254_,\301;\207\363?'\004\206o\210\033e%\3636\211\013\322\231\336Co\374~1x\222\225\np\215\262\"\225'K;\300.h\305\002\037\254\302#L:.@#?\214AOy\316$\360\3461x5\375\203\353\360\027F\306\366\013\337\347JG3M\251\020\001\235\242\307TE\321\303\314H\237B\t\202\207\244\265uR\211\330\253\333J\2556r6#\016=\263c\246\356o\273*\305\352B\241\361\351\326\022\264]\322\376\312\r\202\372(\020\004sR\bQ\275\027\033\023QhF\375\3751"
+	.string	"\230\275\201_\216\f\210\253Z\\\333\332\205\033\342IF9>y\206U\2232F\211C\033\224\260\303\032)\240\2719e\255T*\262\241\244\354\242\266Me\376\301\2506ys\226#\233\306\320,\005H\341Z>\037T\306\213\310\t0\322a\2756\260\033\241\004l\321\222\223\007\274\2551\262\340+O"
+	.ascii	"A0\2752`\341\363\225\225\211@\251&\020\336\362\377\021p\t\231"
+	.ascii	"\003\364Z\030@\200\275\334\242\312\247\256\021-\316\317\336\007"
+	.ascii	"\t7\301%D"
+	.string	"YW\234z\350\251\373\r\346\325)\351\026\237P\264\362\343\005S\320q\341\246|C^\037]\374\234\276\234\002~\214\n\242\\\255\333\256\230\351\3041I\t\312\202/\302\004\202\265\371\"w\234&~AN=\273X8\026\303\035\324\323t\311\211)\235f\016E\220\243\204\243\221\034\203\203q*w~\241i\255\272\325\226R\225\331\264\372O^8\306h\240I\354x\335\203\254 7T\266\212,\337{\375\357Q\r\315\355i\002U\231\350R\223\257\364\237\325\357\220s\0351; \215\320^\376>:\214\245@\217\"?\247>\255\304\246\360\232\302yqv6\2624\203\365\td\223;n\346\340\324\350<\"\3331\354&b\003\254\237\330 7\017\t\225\332\337\030\224G4\036\034\275cP\246\020H\001\325\342\022\367\367t\341D$r\240%j\3606\321o\355G;~\323L\256\260\013\274J\300\313\270\314\327\3259\212\231\214\274\006\255"
+	.string	"Ji\261\344\241\333\254jL\255\225\204\271\nS\350\272T"
+	.string	"~\243\314\223\030UPs\376p\030\247\304B\344\030\266t\323*\007=\025"
+	.ascii	"\237\370\271&\343\356\222]_\300\370\351\341[\n\236\351\302\265"
+	.ascii	"\035\220\374\313@n|\"O\304B\304E\340 V\245\236o\034\304[]\250"
+	.ascii	"\3710\350\237m\r\034`\350\017{>\276\351\343\237\312I\332G\310"
+	.ascii	"S6\t\300\335\373\rBt\212\242p\301\354P;(-\274\217'\362@\311\251"
+	.ascii	"4\254\260\342&%A-\343\325\033B:\237\344j\227,f\200\347\356:\007"
+	.ascii	"\263-3\217\233G>0=\226\347\264\264\\\350\357\025\237kJ\035\225"
+	.ascii	"\217r\026\360<Qg\206\017\373\t\017>\n\257\341qL'z\226\3243\256"
+	.ascii	"\245\237\357\353)\326\206\007g\3128c\250>Z\366\310\256`\257\273"
+	.ascii	"\221\310S(7\352-\263P\267\017F\304=\270|\004\003\003\367C\210"
+	.ascii	"\007\245\334\003A\205\241p\203\367\331\363\261\2361x;\031\273"
+	.ascii	"\224\006t\033*\246\306\254\375\t\357\341H)\032+\341\353C|\323"
+	.ascii	"\345\363\237\253\021Tz\325\255\351!\201_\307:\370\013\376\366"
+	.ascii	"y\334\342\2129\030\037\341W~)c"
+	.string	"\261\3568h\354*\221\377\024\275W\022\004G\016\025.#\201\326\251j\2224\326~\365\361\231\231\256\367\272\205\235\335r;\302\266\232\343v\177\017<h\342\231\017\026\023\273\302\225\311\215\207A\035rh\247\306,\2027\247q\310M\025\336\272[e\373\302QV\206\373\242\204PW\331e\027b\177\261*\002\305i\\\254`=`\f?\026\022\244\370\023*\206\274\340e\002\rJ\001\340l\254E\025\210\234\237\023\245\\\023P\\\3006t\374T^\346\335\030\220{,J\213\006\321\016\264\261%!\213q\207\253h`\203:%?I\354s\350\302}\2079\"\376\255\232\222\225\243\246\004\273:E\241j\373\027l\243\006-\265\340\270\214\2017\277\210u(\354r\211c\353\027\373\374\020\271\236)\202\277\344\031\214\261\253\203\307\341\204\312\3304J\025\307\255E\330\372P\331\3276\276X\2572\255\242\300\234:\\&\216\273\242y\370\326\215\227"
+	.string	"\n\332B\316+.F\325r\005\221\026=\241\tF\326Q\005H\236\242\273\267A\372\341\345$\307\006\016i/\342.\350\210\f\230w\224\006\265T\002\357}\360Kk\003\311\245\267)\360\022\376\327t\"{\017\022/\335\370C(\024:\230\246G\255\243\001\251\332\221\325g\025mC<\356\311\300\025\234\032~\254\362\"'f\225R\202\321\355\326V\304-2\211\224\003\027 :l\323\326\242\214"
+	.ascii	"\361\374\004Z\312&\004N\205\026\316\240\207\027\277\320O\312"
+	.ascii	"\326\031\316zU\262\210\332\305\314\317\361"
+	.string	"\322\330Bj\234\354\037\032,b\206\225\3213\340K\366m\371\223j\360\t\264T@\231\245Wl\372\277\002\346\312\227\333\270\242\227\3402p\241%Z\3211\024\013t\305\020\253\342X\024!"
+	.string	"\0043\023/?2\215\357\266\277t\371Md\002\253U\361L\236)+\204\300\013W1X\214\362\323\305\243A\303\243E\250c;X\330\030o\034\277\302<sD\265\t}\227\231\334\241\344\314Y\324u.\3104\332\362\200\306\375\321\254\357\351h\033\232\035\317\331r\037R\266\371}\312A>lk\233\374w\244k\245\307\3360o\211o"
+	.ascii	"^#}+z=\365)\334\347\274\233\220\357E\223\246\321\356?\264_@\300"
+	.ascii	"\036\224\250\005\271\225\327\242m\263\372\231\271q\256\277d\376"
+	.ascii	"#\213\177q\235@~\023\177\033\332.i|\231\001\216z\236M\274\213"
+	.ascii	")\0174\277\302t\ttrq]\225{9x\365z\241\003-p\326^e\372\003pg\321"
+	.ascii	"\216\326v\276\216\215b\362s\311\035,\360@\351\333\006\363\303"
+	.ascii	"y+\346X\360\353\346 \371\334\253\325\306Sq\335\344}\006r\230"
+	.ascii	"\261\237A$gazO\177\276\354dp\025\304W\330?\2237\\\302v? q~\206"
+	.ascii	"\017\206\270\313'\303\0038-\237\365\024B\366N\334\034\350u]\345"
+	.ascii	"#B\351\264\355\315\3265v\356F\272|\272/\333\220\266\033g\376"
+	.ascii	"=i\364\241[cV\331\325\301q\370\\3\2248\252\373\324\365&\336\037"
+	.ascii	"\211\332[\017\261\322|\306\361\373~\203\2707{\371\221\262~y\371"
+	.ascii	"\365\303\271\302zC\f\235x\375\277,\276%\237\274Q\365,\372\370"
+	.ascii	"}\305\237\343\r\333\210_\3719\343\343F\234E\204S`vS\327\256\013"
+	.ascii	"\375\344\350qU\377C\367Wh\333\177\177b\277\b,\346\375\377\371"
+	.ascii	"\367$=\177\342`\007\321la\274\237\266\336\202\373'\245?\f\270"
+	.ascii	"\353\362\347\r{]?\305\222\323\327\303\307\031\271\336\340\371"
+	.ascii	"'\377r=\347x<\351\313\343\357c{;\267?(\334S\2722\356\232\352"
+	.ascii	"\005\f\356\210'\270\177\360\247\367\f\326'\272\242\330\212\235"
+	.ascii	"w@\306\360s\240\\[\2068\206D?\214\327\375\231\231\325\266K_,"
+	.ascii	"\332\345m\250\262?\310\320\367O\330\215B\336It\331&\346\216\320"
+	.ascii	"^O\350\343K\331s\226\026\331Z\357Y\373\311\200\234\2215\203\315"
+	.ascii	"\335\323\2348GWy\273z\350\321\370\245\212\337\347>|87\007z\207"
+	.ascii	")N\235\200\356c\233\327\256"
+	.text
+	.section	.gnu.lto_.symtab.8b31529782867c45,"e",@progbits
+	.string	"frSkyTelemetryWriteSerial"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\003"
+	.string	""
+	.string	"initFrSkyTelemetry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\003"
+	.string	""
+	.string	"initFrSkyExternalTelemetry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\003"
+	.string	""
+	.string	"deinitFrSkyExternalTelemetry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\003"
+	.string	""
+	.string	"freeFrSkyTelemetryPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\003"
+	.string	""
+	.string	"hasEnoughTimeLapsedSinceLastTelemetryTransmission"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\003"
+	.string	""
+	.string	"checkFrSkySerialTelemetryEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\003"
+	.string	""
+	.string	"checkFrSkyTelemetryState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\003"
+	.string	""
+	.string	"handleFrSkyTelemetry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\003"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\003"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\003"
+	.string	""
+	.string	"telemetryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\003"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\003"
+	.string	""
+	.string	"telemetrySnapshot"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\003"
+	.string	""
+	.string	"baro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\003"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\003"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\003"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\003"
+	.string	""
+	.string	"telemetrySharedPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\003"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\003"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\003"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\003"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\003"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\003"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\003"
+	.string	""
+	.string	"determinePortSharing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\003"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\003"
+	.string	""
+	.string	"telemetryDetermineEnabledState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\003"
+	.string	""
+	.string	"telemetryCheckRxPortShared"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.8b31529782867c45,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1228 @@
+	.file	"hott.c"
+	.section	.gnu.lto_.profile.93693f2592a244e9,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.93693f2592a244e9,"e",@progbits
+	.string	"(\265/\375`?\002\245\r"
+	.string	"D\0213\003"
+	.string	"("
+	.string	"\253\311\215\336\017\020\002"
+	.string	"\002"
+	.string	"\002\001\002\002\003\002\004\002\001\002\005\001\352\263\360\321\b\004\305\247\352\203\001\020\002\001\002\006\007\005\240\342\234\212\n\006\007\367\204\337\240\t\n\002\b\002\b\001\002\t\b\t\366\250\336\342\016\b\002\n\002\n\002\013\002\f\n\013\262\346\207\376\004\004\b\002\b\f\365\244\367\371\t\r\222\236\322\377\007\f\002\r\001\016\002\016\016\017\020\021\022\332\347\266\246\t\023\321\215\254\225\b\022\024\242\302\263\302\013\025\026\241\345\215U\036\017\002\017\b\002\b\027\030\347\315\304\334\003\002\031\032\316\360\265\355\b\006\033\212\356\204\207\t\006"
+	.string	"\002"
+	.string	"\034\035\200\250\351\255\013\024\002\001\002\020\036\376\264\311\341\006\032\002\021\002\022\023\002\022\023\024\037\240\230\276\313\f\f\002\001\r\001\002\020 \217\212\275\204\016(\023\002\021\001\002\005!\307\354\376\303\t\"\221\230\365\332\016\004\025\002\025#$\203\363\265\203\004\013\002\f%\366\271\244\326\006\004&\234\332\232\260\003\n'()\240\342\234\212\n"
+	.string	"I\250Q5aH@*\224\230\016p\202\241*\033\017\022\340$\"\310\264\300\340\204\331\326\377\034\320\354\327\035\206\255\225\310?%\013\002\354#\366hD_0\264$-=\230\345\255\215\223\004/\342\303I\376\022+6\335\25656B\230\214v\241.=\366dT-0/BbMd\231\362en\207"
+	.ascii	" \327#<\317#-$\016\270l0\0338L\325\374)\345\335\272\227\371n"
+	.ascii	"s\251\245\275\325\035-\245[\223\017gP/\351\275\301n\300,\266"
+	.ascii	"\354\277Z\303?)\216\323\371\304K\255\327\003\264U.\276\004"
+	.text
+	.section	.gnu.lto_.ipa_sra.93693f2592a244e9,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\375\003"
+	.ascii	"BD\016\031\260\2511\f\3030\fS\207a\230C\215\264R\243\026t\240"
+	.ascii	"\032h\233\334;\245\356n\245S\223\024A\353Y\377\217sk\230EA\016"
+	.ascii	"c\213\211\035\376\340U@e\302\336\233x\005  `\002\302\350\016"
+	.ascii	"1\200\027\221\334c\206oaP\260\202\201\b\336A\300KB\026\202(\202"
+	.ascii	"\0071\024\242\307\265\213Z\2030P\r8w\332\307X\354\234\366\177"
+	.ascii	"\356\3256j\221\006\300\254~\305\034\367\207\261q,"
+	.text
+	.section	.gnu.lto_.inline.93693f2592a244e9,"e",@progbits
+	.string	"(\265/\375`\021\004\005\023"
+	.string	"\026Y\\G\360\260(\215\001\330\367\270\251\324\347\372wh\rw88\320\324o.\315\221\345\232\367S'j\332\317\307\261!\215A%N<\243q\220\351aI\364\300\031xN\351\275ln\216\224\375\303\036\257\241=kA\236\264\275\345N\001@"
+	.string	"I"
+	.string	"N"
+	.string	"\340\350\215Oa<\205\037O\241\366\223\266\330\356zH/\273\333\355\211\277\374CS\373OwwG%\272aw;\236 \325uD[TdV\237\367d\216\314\212\204I?\222H\025\005\325\207\356\273;\2353\0264d|\036\275\334\004\355%\354.\370\235\277\323\230\362\321B|\240u\032a){\235\274J\003\250 \233\271x|\212\323\001e\004\307\241?Q\316\354\202\2449\220FN\226\250\206\233V\212\r\202lq\323Z\301\r\322\237\223\242\341\356\232>\260\315?Y\362d\354\275\317\024\2401j\310\006@\355=\311\302\t\221\032\231\304\240)\301M`D\3336\241\364\223\235K2\006\346ba"
+	.string	"\243j\241\200\334\265p\210\325h0\203\306\205\265\340\2169\237(\205\221\343A\205\350\355\r\245\001?\370\272 sQ"
+	.string	"\006\205\311\211\001\213h\315j\205\305\211x\361b#:d\f0\225\024\217\232\223\230T\267\202\217\323\225"
+	.string	"\344S\020\273\033\340Id\206\335u 2\002\271+\230\213%\265bc\202\343\217O\241\2473\273\033\232\355\356\207\036n\250a\251b\244\346f\223R\2261P\002Q\204\316z\022`$a\007A1\022\224\324Zj\265w+\030\0055\332\254\034d$9;\221\3640\245D\201F\001*\214g"
+	.string	"ps\\\224h\262i\303\305\026L\264Z\355\222\356\237R\217\265|\207.\001f|`\271\323\334e\324o\335\222\315\3247Y\214qQ\006\234R\002\311]=\260k\2146/H\251"
+	.string	"\351\201\355\315\r\256Ap\031\207\325^>\234\227\017P^\2535\357\341\301G\333\302w\300\247F\213\242\006z\210\242w\377\3563\374"
+	.ascii	"\243A\350\352\\\017_\227\273\351\016\270P\021T\273:\006\001\200"
+	.ascii	"\027d\307\234\264L\006\237\315\372\020\226{\245\273\212\315\270"
+	.ascii	"\343\004\252)v\005\376\"\256\261X&\260\001\361yl\262\310@`\245"
+	.ascii	"|\324\017\003\202\311g\211\237\366\"\025\232\235u\320:\314\252"
+	.ascii	"\f`\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.93693f2592a244e9,"e",@progbits
+	.string	"(\265/\375`\354\002m\013"
+	.ascii	"\002\317-/`k\222\0160\f\033\002TB*\257J*\b\002\200@w@%p\002\340"
+	.ascii	"\223 \002p"
+	.string	"\216\2214\246\305\207L\377\317\224T}\325\206\333\022\"\223\f\224\030\270\360|\2711\356\217R\235/f$\025\2668\001\3411\255\036\220\261\311\326I\244I\331\244LR\326\360+\013%\203\nI\nWt\333B0M\215\006H2@\343\317\034#$$\343\366\314\025\"Y\013}9~\271\016Q\240\265\326f\213\344l8\233\035$\372\303\225\3173\304\36567\3566#\225\016\225\220/\300\025O\361\023\027T\035\206\034Wr\314ek\3565\327\031\321\325\341\2533)UG.\362Q\246\236\021UGQ\250AE\350hhQ3\355\006P\"q\316\212\007\021\2208\205\024bjj\2123m\007\206\243\274\335\374t\350\r!`\343\317\013X\254\242v\310 \313\343<6Y\033\370\236\004?\223z\027\317\345+\032>\356z\"\244v\374-0\t\366$\213>3\273MeT^\364\bDlO\235\022\270\350\316\350\251P\246\315\240\035"
+	.string	"\002\302\023\362\202\006\026\276\271\205\233\355\301H\305\b\360\r2\026DQ\207\351\361\030\351\020"
+	.ascii	"\225\177\007\332\377\021\036\tA\300\0253\240c\347\344o\310\214"
+	.ascii	"Q\023\354\266M\b\355v\236\t\017\260\376\245\177\3267\326\206"
+	.ascii	"\226\007\310D\263\323\202.\017"
+	.text
+	.section	.gnu.lto_.pureconst.93693f2592a244e9,"e",@progbits
+	.string	"(\265/\375 G\375\001"
+	.string	"r\304\016\030\240)\035\377hn\376\377\377\237\253\260W\275\265\377\266\321G\3647\206\226\0353\232\320}\2463\233\217\371\226O\371\222\211\314c\032w\315b\022s\270\302Sp\201\253\346\237-3\223\002"
+	.text
+	.section	.gnu.lto_.ipa_modref.93693f2592a244e9,"e",@progbits
+	.string	"(\265/\375`\r\002]\n"
+	.string	"\022\017+-pi\222\016\374\237\0257\033nn\356U\255VUU\215"
+	.string	"\022"
+	.string	"%!\365\001\324\326o\377\311'm!$\365\220\242\036AW\021Y\"e\n?DH8"
+	.ascii	"\374\215\362\206\232T\022E*\345\225\366x\2553\353H\221a4\003"
+	.ascii	"\262o\035'\211\322F\264\230\263\343\304|\035\304\\\261\241\223"
+	.ascii	"\241]\350Th\247\264\320OOc\246\033\003)-\352\231P9\224\360E\370"
+	.ascii	"\203{\301K\345\022\201S\016\374\234\224K:\235r\247\371/sF\232"
+	.ascii	"\362\246\312Q\001^*\236\220\316\326\316\370;6\277[\363[\237\217"
+	.ascii	"r\326\031u>\345O\225\205;\016\370^\004G\250\021E\006\031\221"
+	.ascii	"\226\0245c`\002\031s\265\033\021p\031cV\225\244\225\354\307\034"
+	.ascii	"\352\0320\354QXV\031 \214\345:,\303\213\365\216\204e\310]\037"
+	.ascii	"\263\3266\371\364R\022o\213\352\300\305\036g\226\233\212\f\257"
+	.ascii	"\367\260\013UmU7\005b\027=\270\354\367\\\323\244\276\200\036"
+	.ascii	"\336\222B\021\033\0318|&*t3?\232\262\377\240.\361\242\221\354"
+	.ascii	"\311\375\240\256\2102\002Fo\263\270@\317y\222|\347A\\\b\345\023"
+	.ascii	"\007$\317z\344\002\021P(\222\350\220\352c\276\334\300i\352\371"
+	.ascii	"+\367\f"
+	.text
+	.section	.gnu.lto_.lto.93693f2592a244e9,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_initialiseMessages.53.93693f2592a244e9,"e",@progbits
+	.string	"(\265/\375`\363\001\005\016"
+	.string	"\026VSC\020O5\035@z1)R;-u\254\357D\347\220\257\213+\236/\032\034&Cp\346\255\022\241\207\017\220m\210\271\273o\320a@\003\373 \204\032\254t"
+	.string	""
+	.string	"\002\005 \272&\002\002@\032\f\233mMvJ\001:"
+	.string	"?"
+	.string	"E"
+	.string	"\035\373\036^z\216\262\001\330v\315\366\330\333\265\272\371c\303\270IZ\311\250TA\225\356.\227q\370\347\365\343\377t"
+	.string	"\244\b\364*)\260\273\256\244\b\303\235\335\266"
+	.ascii	"\333\003\354\232!\233\n\343\330\035SWI\360;\\\263fSOn\"\345\004"
+	.ascii	"N=\351\227\247\254BP\n\031\3106C5\033\331\327\330l\203]\241\310"
+	.ascii	"\370\260\254"
+	.string	"v/\304@\026\325\\%\333\367\315\237\235\243\\=8\002/\323W\207u\325\003\305;\026`\272\356<Oa}\b\361nbCeB\031\334\325\322@\244\322[\310\274\004\t\311\2302\031\344_\344\245\035\234\365UH\273K@\204\326\212\2451\306\032\363\244Z\356\216\210\345G=D\356.\242\b6\3408\241\350}\336\003O\344 d0\037\327\205\032\356\022\300`\004/\344D\020\f\271\315\034\177\372\2045\003\035\263\220\177\342\300_\270H5 x\013\026\033'O'\370\212\217\327\210\377\264\202\253H\341\n9 \020\003\0311\325\0012 \035\326\220\302\252H\244\3050\2153\031,\214\221\271\270\022z\371\212\301(\202\316\360C1}3c\3161\227\254\314\005d\f\276\034\032\371\b\214\222i\002N\37503\\C@h0\3031\004I\bl\f\343\"\211X\302\003Q]\034\022\\\343\267\025\177]\033c\225\226cw`4\262A"
+	.ascii	"\242\270\211\374\271\027`\272E[\237"
+	.text
+	.section	.gnu.lto_addGPSCoordinates.54.93693f2592a244e9,"e",@progbits
+	.string	"(\265/\375`\301\005}!"
+	.string	"\306\377\326B\220\254Ic\230\016\357\357\353\261?\221\303\350\236C\007@\322\206\006R@\212Dr+"
+	.string	"\275\026\215\334a\016SP!\212\377\245\250\363d2\231\243\266\033:\b\034\021=\356\321/\266\205\215\220M\366&I\246\024\277"
+	.string	"\266"
+	.string	"\307"
+	.ascii	"\240\354\007\312\322@\331\203\262\362\2235\206\036:h\222\264"
+	.ascii	"\314\271\343,\317<\363\225!\261\230m\305\036\363[\273\212\257"
+	.ascii	"\030K{\332\216e\2056x\204aD\256\220\250\300\264\263\225\030\341"
+	.ascii	"LR\013\313"
+	.string	"16g\316\t\"\364WSq\330\316b3\302I\026\216S\262\314\231\223\207\344\257\035B\177?\262R\216h\220<?\331\031J\026\355g\342\020\242\203l\316\251T\013\241?\"\232ek&n\262\263\223\032\006\232s\b\030\2629yJE\n\375\225g!\320_\350 \320_wm\034\363\214LO\021\033\247\340\231s\342^\304;\313]m,\266m\365\260aY\3130\347\254\334\352\341\303\275\333\026\2655\321\202N\001\337\017G\344\312\002\302e\272c\300\237v\213J\374\237\266\306\350\3624\272\314\214=-yVZ\032\257\351z\001\215\356[\3502\023\301n\310\263\226gC\236Hk\332\234s\366CZ\250'\247&K\261\231\354\304\306Y\314UJ\262\025\027\311c\356\221\241\330F7Y\n\237\354\204\233\254\204\233l\204P\026\302M\266\350&\373\300&\353 \224%\ne\033\204\262\f>\331\005\237\354PMVAM6\001(\213"
+	.string	"\224="
+	.string	"\312\032"
+	.string	"e\013|\262B7Y\002\237l\320Mv\300M\026(\224\375\271\311\n\270\311\372\330d\003\204\262"
+	.ascii	"B\331\236P\366\366\311\332>\331\260&[\253\311\202\001\b\236\340"
+	.ascii	"\306r\340\005\216\340\322\216\310uC\213\r\374\200\320\r\374p"
+	.ascii	"\306\036\323\013\374\204\327Y\0263]\350\025\274\356\210`\004"
+	.ascii	"\336\242\360\231\240\0238\315\313\330\323\022\343\244\007\265"
+	.ascii	"\031\3606\205\313$}\300\375\303\313\314\330\003z\033\3451?\007"
+	.ascii	"\n\225\376c&\366\004\274\225r\030o\321Q\272\200\333\207\227\226"
+	.ascii	"\261\347\3636g\263\251p\316\331T\177\331\005\241\022r\323U\003"
+	.ascii	"\364\3675[t\002\334\247\316\002\215\036\340N\342\0256.\001\360"
+	.ascii	"\236+\335vD.\244\0038m\315\f\360\366\236\333et\335\031{ZjlO\272"
+	.ascii	"E\260->\272\355\025\272\344\210e\341\221.\340\340\035=\374SW"
+	.ascii	"\033\021\254\366\243\033\364\013\020|\355;x\303\271|R9\254WQ"
+	.ascii	"\265x\025U\207\251\234\np\252\312\212\205-\247\002\206\216J\027"
+	.string	"\305\"\314MEaa\345:|\360\260\301\247RK:\235\325\n\334\214+]\256E\216EN\207\253\242\212j\201\223\272\302\302-\r\325\312E\356\n\247\263\262\272\302\365\360\246?\244\034\352\234\321\372\215Rx\373\301o&\234\302i^\236>\341N\202$L\354Ix\033\302n\236.\341\376\361u6\366\"\274\035a6\020\036\341\206:\204;b\257\350m\t\253\201z\321\355\343K\316\330{\360\326\204\3238\370\203.f\272\203[\311W\233q\t\321\033\034\352^#r9\235\350'3\366\264\270\230\301\0330\270\210/\2632/\370\323\202/]\021\313\206\356\324\364\241/E\021\301\024\274\351\036{ZdNp\005\001a\250A,\002\211S\020\221\221\202\264\240 i\r`\002\221\222\216s\021\360\2314GS\036\005\251;TI5U\307\364E!9j\ne(\375<N6\200\006\246\030\002\026\024A\364d\021\245\3414\026\226\367\204"
+	.string	"\211\021\217\213\204N\336\b\"\351\005i\"\320 \"k\343\226\3736\001\203\361\352\212\251>\002\356\r"
+	.string	"+T\3320\004\033-\267\013q\254yO\005K f\306\263\21475\357\024\244S\303\317vX\247\214\346$\016Z\201\253\004\376\343\004:\372\245\200;\240S\344\020>a\3069[gi"
+	.string	"\362h\017\307\330\261\256\013x\237\005\344\fA\03465+\256\367\2133jr7\b\035\302\021{\266\2264\t\262"
+	.ascii	"3a\006[\007\021i\242*\314\250\005\370\376"
+	.text
+	.section	.gnu.lto_hottPrepareGPSResponse.55.93693f2592a244e9,"e",@progbits
+	.string	"(\265/\375`\367\001m\020"
+	.string	"V]kG\320VM:\020\035\230\026\274>:\347.2E\351\316\271l\355>"
+	.string	"\310K\030\354\202x|j\214&\240\2055MK\326hyHt\354\210jR\\\205u\b\252\334\003i92\b\201\357\332d\335\207\3555!{\223-S\nV"
+	.string	"O"
+	.string	"Y"
+	.ascii	".\033\311i;\373\032\024\022\265\242\335\365\242\316]\357\270"
+	.ascii	")\267\250.\377\365Nm\316\325|\002\bk.U\302\021\333\202\335%\205"
+	.ascii	"\"t\233:%\224\260\230\331<n\fn\204\240 \205\261\2554\324\342"
+	.ascii	"\310{\256&B\032U\356ew\255\262pv\247\334v\b\333\021l\205\020"
+	.ascii	"\227]68\210y\371\370\236\257\300\216\236\360\300\364\310\246"
+	.ascii	"\2754\346\330\337vw\035q\354\363\374\\T\253\252\037@\300l\310"
+	.ascii	"+\262{\342(\312\nI \030$\333W\3733N\303u\236\231\017\330\305"
+	.ascii	"\t\372\331\245\261x\245\2734\355\245y\331\235\300\274t,GM\033"
+	.ascii	"\303\177\030H!R\213\321\344/d7B1\346\370\255\251Q\203\217\221"
+	.ascii	"\230\032\331\316\360\036-\005D6\235\307)\001\221\216\357\370"
+	.ascii	",3/5rLn<\3320\307\201r\361k1\034JD\237\231\227[\220l\211S\367"
+	.ascii	"\001\273\335\230\213_\3436>t\273{\027\227^\311h\037\214i\265"
+	.ascii	"\372&T\240 A\305\247\026\026\013\334\340\265T\254/\365u\370X"
+	.ascii	"\236\007\224)\345\235T+\257\005\201\301\230O\345\261@P\345\221"
+	.ascii	"h\373m#\216_`\221\246+\240\\\264-\\\320\313\274\305\227\n\316"
+	.ascii	"A\020\037\363\001P\216\242\035\243$?r;8\037\017\244\220\3413"
+	.ascii	"$\246F\n\304\311\320\212-) \200\202\031\312\352\232\243\b\305"
+	.ascii	"KT8\221\335\334\324\262\f\267\332P\033\233\340^\n\303\267\324"
+	.ascii	"N\227\251\332\366\213)\025\255`\305\325\334\001\211\356\021\361"
+	.ascii	"\344\230@\233\375\002\343RO\b/\354\204#\257Z\256\244s\330\027"
+	.ascii	"\026\246l\260\3153Et\211P:d\313\217\352\370m\332\224\237\347"
+	.ascii	"\032P"
+	.text
+	.section	.gnu.lto_updateAlarmBatteryStatus.57.93693f2592a244e9,"e",@progbits
+	.string	"(\265/\375`\342\002\205\026"
+	.string	"\346)\224I\260TRc\372\301\020\207|\202\374T\323o\005\n+<\354h\302\027f1\377\2352"
+	.string	"\247\247**\304\314\013B}f\317W\314\3109\344\256\276S\350\367\221\367\243=>H\323kx\027}\016\030\273j$\256\276\221-\267\224)\005}"
+	.string	"t"
+	.string	"\203"
+	.ascii	"\267\250rk\006\260\333\003\344\251}\027/\352\235\230\363\332"
+	.ascii	"\275A]J\367\026\025X\005v\353\342O\312[\330m\345\255{v\325\213"
+	.ascii	"C7\306\263\203\347h\353\336{\253%\336{i\311J{\376\215'\t\016"
+	.ascii	"u^\366"
+	.string	"\334\002\030\366\234$Q\244\200\200\310\206\036\310\001?O#b\303\035ZI\004V7\262dC y\"<\021\274\361\364\303\360G\351\313\301\275\32748\fq\277n\333\264\035\301\256*\001?||\364h\022\352#\351l\350\203%\365H\277PH\"\352Wu\354\342\217V!\373\344\275\367\272\006\331$\265\255\2446)\251k\226\232FR\317Hj\031I]r\342\017\273\321\375\"\251)I\375\223\331\225T\203\246{\205G#7\312.\241\270\321o\337?:\222\0353\3570\\ET\305nm\236\035\273\375\215\216\331\305\277\350\335\b\007\246\003\0026\203\307\311\352\006\024\336\204\263\300v\271\216\n\t\250\356\275,9\316d\341\302\313Ky\373\252vJH\021b]\"\217\202W\326\331T\024a\321\207\270\254\224j\025\262\315x\352\363\243e\204\332\241\\6\251\266\027\325\315T\326\252I%\320\005TA\253\265z\236#G2\206\333\310"
+	.string	"\273w\207\305\247\361\0329\237\350\3260\246Y\336\322\352\223L\020e\265\244\316\352\201)~\364h?\306e\304\370D\226\231\241\017\336\3723\345\255\254\n\b\346\231;]x;\363<s\032\002\2301\271\233\033\023\207{"
+	.string	"Af\230\225\363\324m\270\361v\247Icr0\317[\215L\216\346\006\263\273\271\255\024\260\256\203\271\273\235:\335\356\026+\372N\336\032\344\226!Q\276\372+\253\320\324}h\271G\226\247\232\202tY*\341PDX\320\216+\355\t\177\302\301\356T\323b\200\212(\247\274\215\255\300\332\302\362\321\243\217\200|8\310*\364\224\222\326\235\221\307\354x<\036\237R\276*\255oAL\002\37685 p\002\2219\343\rZD\231\343\351\nWm\001rh\035\020k\267\004u\036\314;\023L\007\354\310\266"
+	.ascii	"R\004\272K;i\0077\374l\036\254R|\022\027<\322\210.\337v\270S"
+	.ascii	"\021\352\361\340\243\251\2752\030\257\236\276\243\031\253\250"
+	.ascii	"\315\t\357\034\242-\tN\235\216\342j\t5()\005a\224\206\021\317"
+	.ascii	"F`\266\247t\023\rG:\033\345f\f\257\310\353T\200\036\3517\031"
+	.ascii	"\254\356\250-\215\002"
+	.text
+	.section	.gnu.lto_hottPrepareEAMResponse.63.93693f2592a244e9,"e",@progbits
+	.string	"(\265/\375`o\007\005&"
+	.string	"\nC\234\016Dp\250M:\007\350\004[@\260\317\021\3443\006\350pZ\252\003\t\260\267\202"
+	.string	"\252`\210\t\367\0345\337\023\265\361\306Y3\220\246\266\224\250U\260\267K\305\f\300,"
+	.string	" N\361\345\270\322P\244V\032M\232\334)\005\315"
+	.string	"\306"
+	.string	"\341"
+	.ascii	"?\277\315\357k\305\022\346\232\253\371l\324\300hs\203\341\253"
+	.ascii	"\201\36148\242h8\3634\037\r\232\031$Xm_X>\032\326\315hE\3318"
+	.ascii	"\2526\232 \231r\301$\3633\377\350\323,\230\345\226\345\233\225"
+	.ascii	"]L\326\307h\231\\<L\262&C\364\324Z+\230/\243p\007"
+	.string	"\3631\237\314\247Xp\353F\207\300\363Uk\335\362\305|\276\264\273\334\313\326\277\3140k\0313\307\260\220\236Z\215S/-\301|yD\313\323\366\251\375-\347\022|\221\306\221jM\262V\246V#\003O\231/m\274R\356\245\371\244\334K\007\355\266\033\231\324\227\231\r\301\270\325Zy\273\344\301\323\240\377\260\353\210=\270N\207(\324ZM\211=|\334{\333\bl\243\260\207\330\002\021\306,\342vF\360\346\320y\035\0226q\202\236x\"\367\022jO\366\004_\222\201\212\217s\033\305\345\334\371zU\316\356\035N\225Yk\205\340\277\221\341S\232\363\204F\356\245\316\212\0347?]\364\3156z\321Ub\037W7\211}RK\021Q\0378\251\243>vC\235\324\006v\324\005N\352\247\237\335N;\352\246\223\232iGM\340\244\036\360\264{iG\255tR\013 \242N:\251\003\\\355F\"\242>\332Q\033\355\250\213Nj"
+	.ascii	"'5\321\216\372<\251w;j\335\216\332\324Q\017\351\250sG\336\345"
+	.ascii	"\213?}\220Td\343\220\247\326\035o\204*\262D\223\362\261\377\354"
+	.ascii	"O\373\325~\344}7G\372lm\326\212\277<_\001Mx\206I8Ek\264L\177"
+	.ascii	"\204Y\250\320"
+	.string	"\034Z\027Ss\260\n%\006\257L\2408\212\366l\216\243\002$\rX\221\t\013\035\022X\246\305\201YZ\002{#b\216\003\026\214\336X\332\001{\036b\310\206\311\256AW\332\2454\007\265P\2574\213\240]\224Ki\217\346Sb\307@\\\376V`\r\354\026z\236;m\201=\221\2624\302\344\323\376\314\301\260\027r\332\247\255Qv\3345\255\323\036\2170\213\327\231\251.H\253\001\2233\213x\240\021\n\230\2705\355\217\237\0223\003+\032\240t\3751\013\030\350\211\246hB\2206\226\313R\031\376\347H\344\323\265\341}\210\204!\223\352\360=\007Vj?L\2327\232\034\324\036x\023&\275\350\233\243\366c\366\360\266*\2459'\362\201\332\250\375\2200@\303\344\230?\374\016\210?\026W\275\030\245/E\026\220\005\260\005\225U\317h\005\225\325\276\260\352\255OE\017\330\342\027c\310\247\242\207\205\345\353\320\201\312B\221\253\032"
+	.string	"\201\277\025\274\255+\240\317\312\327\302\007\344\271`\321\263\342U]a\361\032<\371\367\302w\305\003\376~W\274\323\330u\\\335$~\330\3153a\310\256\3652"
+	.string	"%\364\210\335^\225#Z"
+	.string	"\347\022-\256\3200Iu\274\334s_\306\354(\314\262[B\213\350v\26782\346\3526\267&Lz\325\231r\255\\\271\346\336\212\031\331\3206\241Cpd\210|\034\334*\227\333\241\275\360H\271\271\275\2251oH\007\235\320 Z<$\220\340\225\005?\312=\333\021\244\271\001+\n\200B{$\255\200=\322&\035\205\311"
+	.string	"+\205\356@\332"
+	.string	"{\036c\310\206\311\365\363\031\271\243EZ\032Gx\304h\2176\200\217\250Q0&\021B\344\020\211\214\202$IZ\003\300\002\021\261\343\034\021\200)D6#\242%)(z\013!\325h5\3135\223\"\362NP\211\2505\241k\025\036\233X'\375\037\242\365,\351(\030\030\353)\024\037\270\3460\366\215\373\340\356(\337+\301\313\017\340\204M\2524\036\320\257\342\302]h\341"
+	.ascii	"\241>\271\371V\017Z\220\005\301\217\353ab<\262\030/\2307\r\240"
+	.ascii	"=\227\177\310\177ddo}o@\016\036\325\337{\020/\210\241\270\020"
+	.ascii	"\361d\343\321]\255\357\323\302\314\001\225\2748x\232\\\222 3"
+	.ascii	"\306\370\360\202\235\315\216\b\0043\205\277\223b\245\241u0\016"
+	.ascii	"\326`\037\204\275d\027E\031\223{\033\237\370\215\302\245\276"
+	.ascii	"\325\246:$\201\262|\277\004\334\236\\\031\372\310\301\313\035"
+	.ascii	"\264\237\034\003\260\226I*\363;\273\225\002+\313\202\365\035"
+	.ascii	"T\271<\237'Bm\213\225\375iZ\265#\242\376\264\032i>\305@~\316"
+	.ascii	"^!{V\312\320\364ra\207\326\354\241B\007\265@\326\037"
+	.text
+	.section	.gnu.lto_freeHoTTTelemetryPort.65.93693f2592a244e9,"e",@progbits
+	.string	"(\265/\375`B"
+	.string	"\035\b"
+	.string	"\222\21776`m\322\001({\250\352\376*\2400\367q\005\374.\004\233\371\313$\032\250\223\253\371\215\240\336;\024\t\354I\336\235t\bMB\3010\243\243u\210\2529m\267\225;\245\326d\262\354J\230\034,\253\254j\241\312&\203\002\20255\230\303\314\004\370j\250\260\231]\02761\336\336\262:\212\"S\312\351\243\021\366-\351\177\274d]\233\215|,\350N!\016\324=\322CIV>\224\204W\373\001\002\236\263\200\204n\366I\357\360\370\031\346t\340\271G\277#\037\257\261+\t\221,>0e{\033\324\013\373\226\335]\353\310>\364\345E\246\017\345 d\227\"\245\262#QD\303\3661\326\354\223{\030{\220o\242\364\355\356\324\356\332\241\346\177\343"
+	.string	"\034h;\274\030\354\256!\007\252\270\365\266\007l\023\3306\t\r"
+	.string	"3\241\333\037\270\320\\"
+	.ascii	"\333\246\310^\205\036\260^\247X\337U\026\312e\224\227!\300\245"
+	.ascii	"[\264\363\t"
+	.text
+	.section	.gnu.lto_initHoTTTelemetry.66.93693f2592a244e9,"e",@progbits
+	.string	"(\265/\375`N"
+	.string	"\275\b"
+	.string	"\306\220<7@s\322\001\030\002\222\375\373\212\005\377\244\374*+\033G\320?<8\027\343\221[#\271\2339\031\032T\343[\264{d\207\2010\272\266J\317\034\375"
+	.string	"\031\253D\232\224)\005)"
+	.string	"-"
+	.string	","
+	.string	"\3661\223\354\230{$\373\226UF\212fw\241\216\234\364$\371?9'\236\272'@\302\356:\343i\343\326\333>\260\215`{&\245\\\371\312\200S\\v\305(\037\257\003\036\034\337\205v\266\327\245\212\330\337\254\242\354L\347\323\347\020\200\274,\260\354j\254j\366\263\\L\034\037\237I;\247\372*_\371d \020\f\226G\371\325~\b\345cj\201\252\343\303\320\316W?\345\236\205_bMd\371\242\353V\246\242L\376t8Nk\200\243\215\313B\031D\306\301\b\007O\b~\266\t\3301\260&\221m\220\323\264\rb\336~\263\212R\b\371Jj\262@\332\f\236|t\252\002\r"
+	.ascii	"3\241\363\0378Ns\017X\004\311\200\025\346j^\200\n\3055\021a\b"
+	.ascii	"\344e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_flushHottRxBuffer.67.93693f2592a244e9,"e",@progbits
+	.string	"(\265/\375`\250"
+	.string	"M\n"
+	.string	"FSF=0\305*\035\300\370\363\217\031J\177a\007\007\317y\324h\033\264H\"\342\241\"\034k\207\230\363\200\367w\357\007\223\304\210A\"F0Vz0\310"
+	.string	"\001+:\262\t&\236w\004\221-eJ\0014"
+	.string	"4"
+	.string	"3"
+	.string	"\253\037_a\001\304\021\364Mr\244R\307e$\311\fm\366\372\352j1\212T~\230\276_]\202\300P\304\321t\345\022\346\234Vq\274\270+\267\335`\033\301\376%(\233\005\322gR\264\231\367d\253z\257\326\253?P\020\002`\3015g\251V`\306\266\227\207\355[\374\261eg\245&\267Q\252h\r\230sv\253a\251\237o2\273$\272\3332! \347\234S.\3126\247_\273#\241\027}0Z\220}\221\217P\370\034\236\360\350\305o\276\247\362\355\273\030'\252\214\220\326\326\225B\032w\003\326`\302\360s\350<`\350q\274\007/\354 6\f\234N\003v:\214\201\277\b\017\354\302\357\003;\013k~OVP\305B+\3326\225]\225\225\b\030)\315\004\252ks>\275\030\022"
+	.string	"2\003\353<\222c\313\363uP\\hh\354"
+	.ascii	"\205\370\312K\027\241 \314K\320W-\253\274`\021d\206\333\244T"
+	.ascii	"\315\001\365\210I\230O"
+	.text
+	.section	.gnu.lto_workAroundForHottTelemetryOnUsart.68.93693f2592a244e9,"e",@progbits
+	.string	"(\265/\375`\037\002\355\022"
+	.string	"6e\200H\320\322(\035\313\234\223]"
+	.string	"\230>T\005\361\304\216E\272\t\332I\357\b\253gY\201DuC\214\225W\035\263V\017\300\337\247h\324\032\314v\315\324\031\210\346\320\031\213\215Ah\332\236"
+	.string	"%\225G\265\217\002R\322\310\336r\247\024h"
+	.string	"e"
+	.string	"o"
+	.ascii	"N`G\335U\274\336\223A\002\330Y\b\022\b\276\317\023\371h?\305"
+	.ascii	"y^\317\325\334d7'H\320\256\356\200Q\276O\353.\300\373\374\036"
+	.ascii	"\300\373\364\313.\272n\304\232J\340\320v?v\367\244\"\376\272"
+	.ascii	"\324\370\362M+!5\033\354\362\346Zb\233\311\223\335\375\356\321"
+	.ascii	"\306&\213\321\264\262\273\2165[\207{\336\366\002\333\n\354\250"
+	.ascii	"!'3\205\331g\361\0265>\316\241L|M\306\373\274N\\\022\016\317"
+	.ascii	"\207X\\\262u\262\2507\373rw\327\232c\277\347/y\356'\031\001\357"
+	.ascii	"s\177\2176y\321\236\214\2362Z\316h\225\321\361\3217\021)\202"
+	.ascii	"\365\310\201\242\305\307\356\206\245\244\3051g\230\270\317o\377"
+	.ascii	";\203\266}h>\030\207\317\005\221\216\321\256\016\3453\236\306"
+	.ascii	"\035M)\006\341C-\337\356\252\370B.\022>\\\215\36795\344\210\006"
+	.ascii	"RN~7\340\201:\242\021j\350\240\335\310\342\356\302To>\320\245"
+	.ascii	"VX\261c\026\201\330\236p\031ARM\267!UP\343\r\232R\354(/\252*"
+	.ascii	"\201\037\232\220\314\024\376\203\372vg*\376\213\303H\371\270"
+	.ascii	"O\253^^\274\317\250$7!\244\034\030\257\366\205U|\315\0013\254"
+	.ascii	"\020\306\025\303\342j\2051\240\312%\\IU\212\205r\315\260`>\247"
+	.ascii	"R\\\256\320\302\211\246\345R\255T\030T\256\023\013\006\265:\245"
+	.ascii	"Z3\247\224\002\016cT\255\223+\f['P\027\273\\\315\361wv\200tD"
+	.ascii	"E\210th1\"\250\237\332\314\023\213d\024S\231Mj\343G5\036\003"
+	.ascii	"\342\247%z\017{\006\236\317\342}o\340yj;x\020_3\251\\\020\n\363"
+	.ascii	"\324$ `\002!\202\2127\305\320\r\007\223\035~\201qN\013T\023S"
+	.ascii	"W\351\032R[\024\202F\340h\216\035\\\205\214<Yf\327\333E(\265"
+	.ascii	"\303\360\314-ab\207%'nFF\337Z\335\340\013\301( \341k\024SX\016"
+	.ascii	"\227\3413G\277,\255\217\006\273\244\001\313\312m\027\326\003"
+	.text
+	.section	.gnu.lto_hottConfigurePortForTX.70.93693f2592a244e9,"e",@progbits
+	.string	"(\265/\375`:\001\215\r"
+	.string	"\026\032\\C"
+	.string	"s\233\016\273\277E\013\"P\006\240&\231\177\353D\230\201\367T\017\337s\330\352\035p\201\312\367\031\020\361?\274\226\001A\232\265\312\326u\373;\255\253\252^\365\n\2419\333\020\n\340\233\020\021Y\332D\312\224\002H"
+	.string	"D"
+	.string	"K"
+	.ascii	"\036\261\263\307g\006\3317n\002\261\231\020\340I\212\035\273"
+	.ascii	"\253\351\207\203\036)M\220\377\322/\357#y\034\235\302\276\321"
+	.ascii	"\225\032"
+	.string	"@\222\261\001\300WB\0318\245\330x\351\211\341\023ef\024\354\256\323\3734\334\325m/\260\215\300\376\210y\357\321\367T\217Q\017\376\200\311\f\036(\241\fm\223(u\305>\265\252b\3074\026\323\027\225\2664\0353\235\231~\206\341\350\020\243\201\216\335\f\241\217}\211/D\330\276o\342\340\310KXG0$v7{tyoS=^u\004\223-\036\351\244\272\362\203T\230\276\364DiIq\241Q\222=\034 \f\303\032\007\251.\305\364\027H\242\fm\351\245\2179\371q\320\021\216\202c\355n\002\337\245\343|\226O\365h\351\005\336\364\023\037\237\305\025<\001\326\204t\035\007A\373t\272\215\263I\330:m\302F\204\243i:\036-\204\2009\n[G\3538\256\243e\246\320U\205\001\207\227\220\212\342Y<\325v\320\"5\306\300\270\213\034'\017\224\200\314\213TW[\263\345=\0270Q\022\373*\276\302\302\203M\030"
+	.ascii	"3\003\336\231\361\371[\023\273o\0202\006\231\t\201?(x\022\207"
+	.ascii	"\031f\257\r+\037\266\321ok\215\t{\205Z\361H\t\342\232h@\023{"
+	.ascii	"P!^\256\030\227\256g;O\351\250\321*("
+	.text
+	.section	.gnu.lto_hottConfigurePortForRX.71.93693f2592a244e9,"e",@progbits
+	.string	"(\265/\375`L\001\005\016"
+	.string	"\306\332^C"
+	.string	"s\233\016\273\277\240\023\320\315\220\030\223ZoW\006\312|\370\266\004Q\325\276b\300\312\302\301\321\025\027\330\326\274\226\001A\232\265\312\326u\3735\"\255\252z\325+\204\346lC(\220\326\234\"@\275\211\224)\005J"
+	.string	"G"
+	.string	"M"
+	.string	"\321>\261\263\307g\376\330>n*\261#&b\250\260\b\262\273\232\222\370\347\261\322\374\370'\375\372@\320\243\350\025\006\212\256\225\201\321\r\020\002@\224*\001JD\352\244g\007\320\313\034i\260\273\316\017\374p[\267\355\300\366\002\3731\001-\326\320\311\177\217~\307z\214\372\322\025\244\340\020\262\022\312\3206y\251#\354W\253,vLg1\215U\351K\3231\323\231\351\007\300\200\274\330\220"
+	.string	"d\327CHdOq\306\t\333\367U\274t\362\027\253(\205bw\263\007\366[\334\305\006\n\232\374\247\261\036\257*J\245\3137B\351I\254LOz\256\270\354\200\311\201\222C< \fC\035'\2610\315\364\034F^\206\276\024\323\363P)\362\222-<f\003`w\031\3700\035\347\267x\254\307K\257\322M_\341\361\003\316\224t\035WA\363p\272m\263]\330:\r\203\306d\243e8\035\255\344\200\271\f\033G\3538\216\243e\246\320\225\305\017H\247\220z.\2206\204\bI#\305\311SP|\361T{\002\214\324\330\243\306e\374@\205\250\b\344ob]\355\314\226\377\214 EA\001\032"
+	.ascii	"3\003n:\004\314\342\243\021lb\367\r\002a _!p\rUN\342\006\303"
+	.ascii	"\354\265\301JXx\230\255\016\3154&\330\025\312\342\221j\304\205"
+	.ascii	"\321\200\306\366\240L\27441\316\271\236\342<U\243\306\245\240"
+	.text
+	.section	.gnu.lto_hottReconfigurePort.72.93693f2592a244e9,"e",@progbits
+	.string	"(\265/\375`W\001\265\r"
+	.string	"&WWD\020\257&\035"
+	.string	"\007\356|U@{\367\351\252\247\203\333\243:\003MFl:\220\275\356\337\347!P\223\370\372T\213~\357\25586\021\037t\346\324Ia\004"
+	.string	""
+	.string	""
+	.string	"D\250\202\254\002"
+	.string	"\001\250\260\225\320\366&R\246\024D"
+	.string	"?"
+	.string	"F"
+	.string	"+\2539\247\\\n\027=BkU\344\217\036!\315W\002\006\350\032\\\035\210Z+\302\202\203\361\320E\370Z\005@V\022\256\356\303\342\310\204\274\334\344\352\240\343T7\030sN+\251\203pon\033\201\355\001\366/\004(!\337\202\031\200\364\244C\037\024\017\2777\371=\323\310\204\222\207\326\330\250\221\356\311\2765\227\304V\265^\375K]L\234\\E3\347\203\232\231\231\202,\236\355_\026\331)\216*\231\233\n.!\001\327\315\370Nt\330\320\275N-bJ[\362THX"
+	.string	"\324\366dz\2229--)nG\3669\242\257\341+\034\035\237O<$\340\225\214\234\250\376PT\201+T+\225aD\240\230\326\241\370\315\370P|\250\214\375\f\017\356\\l[v@\202\264\r\363`\t\260M*\3300\340\221\035\255C^\bp\266"
+	.string	"\323\344\226e\232\274P\363Kb\f\217\345b\007K1\305\250x\312CH\357\345\273\377\341 >\230\206F<\204\"3\030XF\2448\300=m\b& \260\002\031!\364\001\262\002\326\207\360\361\322Q\373(\366\341\236GsY\202\030\037%\211\033p\300\314Ao\343X\310"
+	.ascii	"\343\270\21486\251p>\267\305\240\023\225\215\316\272\033\327"
+	.ascii	"S\035\216K\353\004h\206K\365\341\337\307\005\346G\261\306\350"
+	.ascii	"H\273i\203\200hE\227\200\002"
+	.text
+	.section	.gnu.lto_configureHoTTTelemetryPort.73.93693f2592a244e9,"e",@progbits
+	.string	"(\265/\375`\314\001E\021"
+	.string	"favG\320\362&\035P\267\333B\376[\250\314\031\322\233\302\323\217\334\n\253\332\251\312\202\347\323/\022Q\304\305'\336\340o\3430"
+	.string	"H\005\017%\250v\003p\022-\315\305h\356\341J\274\357\035D\031\244\253]#\013\322\366\336r\247\024b"
+	.string	"\\"
+	.string	"a"
+	.ascii	"\227#\0270/\343E\346\245av\215\327\204\366*\246r\224x\354.\247"
+	.ascii	"A\207]5eT\b\363A\276\330U\233\207\317X\302\303\364\"\344\303"
+	.ascii	"\211\"2\212~$\207\307\220\317B\034\331\335\325w\0035\032(\272"
+	.ascii	"\340\024\362\331\304\025\323\016\022?:\324\371r T\241\354\256"
+	.ascii	"\241\354\333po\267=\301\366\211\r\001\0047\320\207\375\023G1"
+	.ascii	"\343\017Y\302\013^v\351\277\346\345\265\207\b\350\203\021O\r"
+	.ascii	"\234\262k6Pg\366\343\356\256\025\310>\355\236\022"
+	.string	"ZF\350\250\320\n\241\277z\213\032\217\033.K\273\031\246~,\f\t%\342\264\337\376\217\274\362M\334\bv\032\315\026\323\2605I\355\330\330\255\221\\\232d\013p\252>\301|\207\275\202\351/\230\333\031\314\250v\003\007\3602\251q{4f{\345M-\001\204v\367\304O\252\300*\231\261\273Q%\216\223\324\331\237\\\200 \212\n\324\232\252,H4\374\340K\255m\367\346\304Wz\n\b\376\320\245_\272n^\252\252B,\365\240\351\317\210\244(\325\231g\346\225\005)*/\230\256\345\305\244x\256.f\345\026\023\317\353\\8\n.\217\365\302\212\300\3628\230\326\312\013\327\342zq&\005\334\305\260\\\234\327u.nU\253y\\\224\032\265Q\021\200\366\001\004\3602\253\306\240O\023\321\323\324\231_\202\005\206\270\235f\202H\355\344\254P\237fN\325\221\231R\217\024\344\223#\206T\377\351P2)**:d8\006\004\036"
+	.string	"2\241\304\017!m\204\310v\257\217m\177\201\025\216m\203\320\3468\260\b\311\314\306\\\203\355'\254\327\205v\240Ep\033(\304\030\"O$\210\344\302\206TX\341\273\313\300\256\216"
+	.ascii	"\330\022<I\030\355\275\002\006\200\210\253j\364\256\002\005"
+	.text
+	.section	.gnu.lto_processBinaryModeRequest.78.93693f2592a244e9,"e",@progbits
+	.string	"(\265/\375`:\003\215\026"
+	.string	"\266'\216I\260PR:\256\237e\347n&:\272\325\227u\305na\273\352jC\331/\217\231~\247/  (\013\025\302>\306[\310?\253o\033q\336\252\006\352v_~\320\177Q\373A]\237\225G\251}<\233ck\2556Bb\367N)y"
+	.string	"s"
+	.string	"y"
+	.string	"v\t\002\337\215b\\w\205UQ\273\303\021\037\230\235\264\317\356\372\360g\315\241\255\232%\260\335\265\325\017\367\23563IY\245>\337\274u\234\301\337i\263c\001s\224\314\020\236\033\235\2232\003B\252\r\001\202\027d\037W\036h\334\351!!\200:T\206\005\324\221\201\354\356\217N3\004ih\255\241\005g\312\017 b\320y\200:\225\232\267\3355=\2037w\355\266;\330.\261\253\203\345I\352\261\030\206n\030wW\344&|\341\354g\201;\\\221\223\265~X\001\303\21444\207=\234\241\325\307~=\036\217a\256=vIm\226\324\345\215\376ZR\037"
+	.string	"\004*\033\241W\013\324\256\315\021\307\026\311\025 l\337\251\311&YDKgr9\222I\016$\\l\021W\202y\222M\264>\374\b\373\345H\256-\236\210v\367\305\206\261k'i\3156\245\001\r|\241\223~\200B\177\242\224.\376\002\227\222\313\225'\253TU\321N\202\0371#\311\342e\215\340\023/\305\363\205,a\205\376\\)O\226\365N/\200CU\224#C\217&\002\021\203d\325\307\274\362\365<J3h\250\230i\024\344,\245\255\263@\177\276zL\035\2134\365\347\237\270"
+	.string	"\033\305\037\035;\020\021H\252B\371Q\3562\231r4\234\273O>\nw\315v\177\027\376|L<^n\247\242\2023\235B\322\353\351&\330`v\275\034K\216B\256gkY\301\261\330Rv<\033\311"
+	.string	"\353*\344v\266\236N\267\263\325\2062\257=&\277\212aF\231:\343\227\370\217~\373\3211\331\356.\255\372\\\235+\351['\0358Z`Z\227\241`\301\311I\226Q\305Wqf\3060\353\225R\3347s\344\004J\337\352\305\030\0068\\y\362;\\^g\2157\035\006J\007N\026\321\256\314O\177\352T\001E\250a4\306\230Rdj&\224Y\022\265\001\240\002!1\273\001\020Xv$MZ\0033\214\004\232*\365x\032\231\276\300[\r$v\001\277\033\353\315v\210#\b\372\333\260_\310\204\034\031\210\360\217\362\317\340"
+	.ascii	"\033\352\360\002{\272KK\023?C\211 +\200}h1\230|\003\315\024\342"
+	.ascii	"\351*`\303\347\274\332I\206\376^\340rHO\b\f\370\033z\326\354"
+	.ascii	"\370\230N\031\265\270\347\306`Tk\256)d,\253\321W\035\246\344"
+	.ascii	"\322\267F\324\320DE?\256b\246~,0J\325"
+	.text
+	.section	.gnu.lto_hottCheckSerialData.79.93693f2592a244e9,"e",@progbits
+	.string	"(\265/\375`0\004\335\034"
+	.string	"6\264\272I\240\230Q:\n\250?cr\365\214\003\256\365\t\332u\364\021V\233\022>,\037d?\222\201\013\257G\357\327\375\250,\340\222\233]\307\026\222-\245b\017O\216\321a\330q\201f/\326a\246i\206\336<\024\243\331F6\331R&\031\251"
+	.string	"\224"
+	.string	"\250"
+	.ascii	"o\002\272\323\317\276L3\006\024$\246y*\330\004\256\217\263\313"
+	.ascii	"\352G\372\233\372q\201v\277\374\264a\222HK\277a"
+	.string	"\031\3234i]\343@/a/\027YG\332\f\264\207\005y/\017\300^5T\364\327\253\206Z|\350\202]\324\300\f\030Y\257\032\"\242\263(\304\337\245\310\037'B\246J\021\030IYQ\023\374Q\231\025\031^\312 \n\036\031lm\021f\305PQtJ\021\\M\215\251\t\236\2402\241\034\3002\350\343\246\264!\"H5\301\036\215\201I\232\372\360\007v\f\0251\223\022L\323\\\006\006U|i\276\273Ev\027g\227n;8>\360\343\036W?\276?<\013\233\256\214\232\210\202\270\270{\362\270\217vO\315\236\261\373\363+\373\323\367\346N\177\354Q_\033\222\267\254\274\260\312\373\252\274.\312KR\336:\362\216#/\255\274=\3622\345\375\200G\3310z\201\304\324ZNS\250\270e\022G*\244\237\377\323\037\365f\272\373\335K\355\226?\220C}\270eT\0013D\341R\205'\237\031/f\366\300X\351\230\340b\320"
+	.ascii	"\350\247\317\214w\232B\020\316\\\t\313\230\346\231\340\343>p"
+	.ascii	"\235w"
+	.string	"/\fXS?\224\222\\\006`\374\247\216M\300\251\b5\205v\254\307>\n\035=.n\024\332\227:Sq\302\242!%\214\022\331GJ\376\304*\326{&o\362\263\201\003\207\372\361\365\363\222\365b\227\204\301\"T\373hu\265\333C\222n\001N\304o\031a2\034\373HW\367G\216D\327\323\241C\375H\366\310\262\204e\303\2735\033\037\2704UX\020{\315\333-%\037\017\312\021n@u\361\261\026g\371\240du\037\355\336\247\332t\200&3PS|\254\265\3346}\253\337\031\032~\357\336B\360\201\3343_\363v/\344CL\354ql\037xn\273[\016\216\316\266\353\361@\243Ca\247\263\225 a\313\275t:[NG'\207\324\341r\265\233\205\035\217-\227+Q\003\260\265\005\273\035\016\004\255'\267\263\355\330D\330v4\236[\316\016\255\226\323\321\026\020X\334\b[\216\266\303\341r\264\3624/!\250{e"
+	.ascii	".{\367\002\006Y\227]e\244\b\362;\023\304\305U\340#I\nX\226\313"
+	.ascii	"\272i@q\361\261\326\367\344\335A\221_\320\013\366jW\303\272\227"
+	.ascii	"\374V\364\314W\217\303\037\225O\275iWg(\006\371Q\365H\331\025"
+	.ascii	"\262G2d\230\210d\\{\027G\003\037xC\254L?\222\214\232\210>EE\314"
+	.ascii	"RP\250QDF\0203\206\241\221\021\t\232\244 9\200\002\0211\264\016"
+	.ascii	"\020P\250h\232\026\0032\236g\233\240H4\227f\223\265\004\031\220"
+	.ascii	"c\374\373\002\207\035\225\033\013\027\033a\370\232\371\003\020"
+	.ascii	"69\274\265\350\327\331\306\356\316\005\3036'\210\314?\215\376"
+	.ascii	"\203\320\354@\236I]\302\350\2432hv\227\252\t\217\300\270L\274"
+	.ascii	"x\350(\202M\34799&`\312\362\240$\310`:\314\364D\275\350\324\031"
+	.ascii	"\325\304\\\340\215\212\367\207Us'\367spt\230\324pH\316\370p\035"
+	.ascii	"\252\324\334\326\250\017\314\264J\354\364\020L\372\374\274\036"
+	.ascii	"\265n\303}\322$\243\315\252\002"
+	.text
+	.section	.gnu.lto_hottSendTelemetryData.80.93693f2592a244e9,"e",@progbits
+	.string	"(\265/\375`\020\003\r\024"
+	.string	"\346b{H\340\320(\035\332i\177\270\276\0209\357\022\032\353a\267\002p\224\207-\221Qr\301\032\201\370\004;\317\240\340\016\261\267\375\261\224\030U\365\2305\034\346\373\204c\214\361\006q\312\023\216p"
+	.string	"\r\246\261\272l \326~#\233H\231Re"
+	.string	"["
+	.string	"j"
+	.string	"~\016\301\250\033q\236\343Z^\302\250Q\b\274\264[l\360RA\273\3305V0S\226@\307\202\314\017\322\2343\334\233\273\\z\253.\276\354\362\270k\215\016\332\021\220hs\257T2\347\374n3D5\321\346\353\215\330^\324"
+	.string	"\020_<\225\321\215\306w\2564\"M\265T2\347\264\326D\f\367w\333\fl\217\330;\003\337\345w\205B\3038\323\235MjKX\321\327\374\235\243L\210EI6h+\263s4]\017\366\275\271\035l\251^\251ZD\325!R\255RuJ\325 \253\006=5J\325'U\233T]\362\324\337\252\245\252=U\257\252U\325\037\360\361s\013\022_\341h\316\013;\036\263H\246"
+	.string	"a\007F\034\274\017\225\253Z?\327\340\204"
+	.ascii	"\314U|\305\004\024\026\353\273T\255\202\034Icj(%\350 \233\022"
+	.ascii	"J\001\331\347\25687!l<\343\256\334\353dzx\272\326]\337\256\007"
+	.ascii	"\324\332}\206QG\342\037j\266\242\265\353\323]\231\317Q\317\214"
+	.ascii	"\027\335a\335\023\257\335\370\356\256\357\253\373\030\033Mw\366"
+	.ascii	"{\356"
+	.string	"\343\362s\254\302\242\257\261\004F!\211\305^\016B\n\260\030K\205\365\200\025\013!\264NTB\024\330JH\"\300\257\b,X\030{\275`!\230\233\275d\2664\t\356j}\234\214\225H\214\220\0251\n\331\343J\013\256\001\231\036\250%:\360oQ\033\3406\263\213\021q\202\321\332\322\236\\\2306\2053\316`.SNiO\263a\306\342-X\026\230\230|\227\337~\347\005t|\220l<:\204#G\250aX\245\230)\233 \242$e\026\306\340\002\021\231\"\017\021p9c\246$l\314v\022\206\376+\345Efv\032\330Y\265#o(\274\371\227\b\332@\327\004\001\301\325\220\240|C\372\333\026V\305Jc\317UX\177\302\245B\314_\303\347\030\305\340t\360\205\256C\2420T\212\3041\371\330.c\365\213\311XL\250\226z-\312\360a\303{P\f:v\206\003]`Ma\n5\324o5_\303\234on\232I"
+	.ascii	"\340`\272\210\236%\025lk)%W\001"
+	.text
+	.section	.gnu.lto_checkHoTTTelemetryState.83.93693f2592a244e9,"e",@progbits
+	.string	"(\265/\375`$\001u\r"
+	.string	"\306\230ZC \215(\035\024\201\372\224Y\275\311\004p\005\360\304\271\003)S\202\326\202\351\007\200R\200\231\215Iy\236\315\364\251j\005evbt\341\200ez\320\030\004\230I,\3405&8\t\270\214\341n\326\222M\244L)G"
+	.string	"D"
+	.string	"E"
+	.string	"!\311jT%\022<\254\354\256\246\027>z\0261\315\221Oz\206\031y\f"
+	.string	"\216\034\263"
+	.ascii	"!`\233\335"
+	.string	"\315\200\246T,\003\005\374`\001~X\305\206\227\206\263\236\023\300\b\231\027\215\335u\236@\n\367\345\266\021\330&`\377A\250R\266\330\341\227\232\262\217\255Z\260\277\272\343\323\231\351\003\320\274>\025\023\225KI\204\033\322\222bSb\210\f_\375\366\317r\306\031\003F_\2116\244pC\262\n \256\325\312nx\361\350\013\314\243G\366\353\001Y\324\237\260Z&L\311\242\" @N\250\246\242\246n\264J\230\222\305~\353&\"\006\034\227=\246^\0045\002\223W\333AG\376\024ucR\222\375\222\207\036>\006\177\204\362\247G?\224=^\317zD\241D\240\b\233\207\207s \301\346\331\340|\n\030\370\330>\032w0<\257[\240\205@\336\306m\236\315\323>\034\034N\353\200:4\f\001\356\032l \315\353:\220\226\tK\327(\351\227u\264C\254H[\001G\376\344\273TT)\237\222\216Br\302\001\323\224/\n\032"
+	.string	"\306IEfh0\262\267"
+	.ascii	"W\004\312\232}\240\030PW\0245\254\b\027\206j\262P\371z\034\217"
+	.ascii	"3\275\300\302X9\264[a\350\032N\210\211\"\325\345\200u\300\345"
+	.ascii	"w3\217\257\206Tu\272\327\026("
+	.text
+	.section	.gnu.lto_handleHoTTTelemetry.84.93693f2592a244e9,"e",@progbits
+	.string	"(\265/\375`\361\002}\026"
+	.string	"\246'\222L\240\326Q:\300p\254b\255\375\bu\320!\256\027#\203KT\365q\300\005\035\257\247q\007\216\3147\266\323\277\271\332\2775\207\363\355\302\226\346R<\205\357\205\037\300\365y^\n\243\341\274(\034\323\340\234B\n\300\345\377F\b!D\356$\003}"
+	.string	"s"
+	.string	"\202"
+	.string	"7\313\0178o\362\217y\311\221-\356\f\206UO\362\311\275\227\326,\376\373+EO\263l\373\343\303T\340_\017\n=-\031\310\370\020\365, b\031\303\321\025\343\307\273 \001\tY\264\304\317\025\225g\351\026\204\332cM\022/\313\227-)'+\252\207\222\345\307\3050\246\356\330._\212UA1UX\262`\255P\362\343]\262\200\204\254Ec\356\275l\207\252\2103\354\314\\d\346\006\314\r 7\337?\276D\"r\315 \006\355\312\214\024\332.b~\257\353\272r\0231\233\226e\250e\030j9}\322\217\236\226\333\264\374"
+	.ascii	"*ZF\352C\254\367\376\254R\356\225\351\343\005\337\351O8D\234"
+	.ascii	"\033O\346\034\311\263\256\251\034\346+}I\347H^@\234\022\273\311"
+	.ascii	"\254\303\034\273\3311f\276e\276\215\033\177O\352\300\257{U@\365"
+	.ascii	"\270\027\251\200\023\2447\013\234\345\f?\036\001\320\351\252"
+	.ascii	"h<1\023R\233:\325\004\n\265\232\205\013\004h\\\t\260oz\020[z"
+	.ascii	"o\360\307\201`\340\033\335\344\f6\333\231\274\341\354\207\374"
+	.ascii	"\344kC\216\240l\3554\220\231(Yi\225]\304*&\216\2479SK\364\251"
+	.ascii	"\241\324\244\210\025\254\321N\373<G\302\3578\017\232\032\033"
+	.ascii	"\233\363&\254\377\364\003C\311\243\242\321Jqa\245h\366\235\357"
+	.ascii	"\031\246$;6\n\363s\034\312\3077\342\234\316~\250;\003\274\032"
+	.ascii	".WS\241w\203\333\355|7\031\337`z=\235\006Z\316\256\207\313\341"
+	.ascii	"6\340z\264\233\032[\216v\333\361h0-\254\343\200\333\321z:\335"
+	.ascii	"\216\026C\006\337D1\301\026\226\367\336\373r\371\035\035\330"
+	.ascii	"\017\271l`\320\221\021Z)\357\354\236aB\202\365,\336\003\031\373"
+	.ascii	"\241\314y\263{\266R\241-\026mf\b\021\354\361\367iB\201<\021\241"
+	.ascii	"1\352\354\"\035\227Y\371$\350d\375\245\033P\223F\206L\264\253"
+	.ascii	"\002@\250\021\260(\250\230a\250H&)(H\222\016\320\002\021\261"
+	.ascii	"\353\020`g\333\024\206\003\"\240Z\324\235\222m\342\b\247\213"
+	.ascii	"\220L3@\203R\242\302\207}X\034\263\347\217\213P\223\n@\231d\212"
+	.ascii	"\t$m\212\374\376\217%\253\262\217}s\2029\331\214\305Q\224\367"
+	.ascii	"\242g\257\324\\\356@ \243k\216\027\344\261\217\323\232\326\247"
+	.ascii	"\251?\226CX\004\307D%*\024b\\\370I|\374\007\005\265\n\250\224"
+	.ascii	"<=\025Y\\{\252"
+	.text
+	.section	.gnu.lto_hottPrepareGPSResponse.part.0.108.93693f2592a244e9,"e",@progbits
+	.string	"(\265/\375`\375\004\375\033"
+	.string	"F\262\254H\260\230M:\301J\204\252Nb\320\200pP\037\334\231\350\336\211\206\246V\270b\371Zy\215W\207\003\241z\257\327\r<\0161\202\300\210\177?\221\273\247"
+	.string	"\223\313\364\310\007\255\365/\224\376x\213\301\2660\215z7\262\211\334)\005\224"
+	.string	"\211"
+	.string	"\235"
+	.string	"=\037\214ET\231\017UE\212\314\330\241\032B4\204(i\n\307\005\372)e\364\250\235\007\034\001\253\317\347\007\271\020\336\243v\264b\321\025I\277-\265\002\013|\272\001\375\274\2211Ky\240\321\241\212"
+	.string	""
+	.ascii	"\253\013\237\245\264\377\343O\274C\025}V\353\222\023\254Z\201"
+	.ascii	"\006>]\200~\032\370\232\370IO\023?\355\377l\033\371\314\263\263"
+	.ascii	"\034\310T\0375&)*L\255\325\366\2716\316\373\312\220\347\247\370"
+	.ascii	"\316\264xq\211\363\360\025\241\326j\n\343\236\267\235\300v\b"
+	.ascii	"{\366\004*\026|"
+	.string	"\372G\216\304\307\277\361\351\237\022\362J\237\b>$~~\217u\033\022\253\246\247#\331%\267\2067|Xw\311\246\322:0\351\032\225\316yI\323\2504\316\245\356\331\251\356\033*-{I\333P\351\232\2274\r\225\216\275\244g\2504\354U7\025\245_\242\264(J\317\227tx\340\277\242\264\024\245?\200\246\300G\255,\272\310T\032\363H\216_\375U?\325/\365\320\276} F\376\324\211\334\310\261\034\273\262\032\222VC\257\0016\373\030NTj\326\236\360+4[\263!\026\n\267B\004\201\311\025^\305\202\003&*\017b(!~\322\254,H\326\326Sl\355\f\327\232\331\030\245;s\325\343\202\255\255\341Q8\324\202\265\326\005>\024\024;\376\215\"\245.\260\275\013\247\251\245+\265^Aq_+j\365\234\b\334Y\342\\q\347\227\236\016$\331\345p\347>\211\253\303\235\354h\223paHW[9\362+w\327\376"
+	.string	"B^\3111\032\275Ma[\304\231\334lKF\003J\344\332\252\330#\236u\203\020\264y\236dt\300Tk@\270\334\366\214cPn\336\350\3303\244\373\321\001I\310\005\311F\237[.7f\330\331P\301\306<\007t:\034\t\333NH7\232\030\201F\235\355\304\317\315\204\215G(g;\020\300\270\240Q\310\246\303\341\204l1\333\362\273\344\bG\213\344\335\255a[\207\307\313\324VgC-^\217\217\3415=\b\212\261\300 \270\205\241\266\262\035S\232~\007C\333\234\331\322\300\364\270p\326\346\375\370\227\331\342\354}?-\353\345;\361fg\353\341\367\244'\003IvA\275\313\216"
+	.string	"\227Q\300\026\237\233])J\232dkKx\026\233\225]\312i6_\250\201,e\221b\212DHQI\2224\006\220\002\231\242\353\034\021`)tp\204\202\244|\036t\273H\311\363\216\302\016>\025UI\037\0076\026-\241\257\025\274\003\366B\334\377L\332\r\032\023\016\264b+P\334\213It]\321\376\3547\004:?\241'\254\244RbM\257_\004<\245\tl\013n\255\324\023q@\240~\306\354"
+	.ascii	"\177*\332\317\250\272\263\217\336rP\314_\213\211\027\202h\307"
+	.ascii	"\177\004FG\231\3233\n!\372\227\261%FI\227\332\032\304&\304\021"
+	.ascii	"CJ\263\275`\237`\356k\317\226\300\317\364\255#,\271\347\217\207"
+	.ascii	"l\023\013\351\301\340x\255\313EVp>@\377h\01622)MZI&\261\342\013"
+	.ascii	"0<_\177\346\321\306\017"
+	.text
+	.section	.gnu.lto_configureHoTTTelemetryPort.part.0.109.93693f2592a244e9,"e",@progbits
+	.string	"(\265/\375`\007\001m\f"
+	.string	"\246\026RB o\224\016\240J(h*"
+	.string	""
+	.string	"\340\202\234\207\001\215\261|\020\314:9\265\036\350\253#\336\002\347j\277!\331\324\301\tN\333\352s\205,P\f\321\005\007\220*\354\321\304\311+4\n:!\226l\262wJ\001:"
+	.string	"@"
+	.string	"D"
+	.string	"\246\\\227\223\023\260.\253\017\260.\357\3016\347\271\263U\274f\354CR&\217ow\347e\344\360\356\021V\235/z\004\200\262p(\340\225\304\262\273\276.\334\362\266\023\330n`_\013\245J\261\307G\200\374)P3*,0\2410\361\355\326y\351zA\373\006]\204#\206\017\354>\007\347w\030\253\3347B\236\224\352\242\274Wc\227\006\361\020\3357B\227\310\273@RL\030\331\255\224\313\360\247K\237Z\227\222\r\"\337\212\021LY\002m\017\004\370\223\337q\006\"\036\213\021R\024\301\210\341X\275\332\335u\274\260+\004\032\0012\354RH\265X\r\262D\207s\374\203\363\307B\222\020\241\"q\342\373\360m\306T\016x84\263u\024l\032\355`\276T\266\215b&H\333\262M\366 \333&'\343`3/\232gV\f\230v2mn\224j\023\263\r\037/l\031E\222c\214\030\327X>\310C4\276\20674\033"
+	.ascii	"V\025@\231\372\020\347\f\374\0320f \035\002\004D\301\260\\\""
+	.ascii	"\377\f\201\347B\002\233\200&\336\220\3040\341J\005;\352\016\322"
+	.ascii	"YS\210m\247\356\351\264e3o\247\005\340\332\003n\264\210~W\031"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_checkHoTTTelemetryState.part.0.111.93693f2592a244e9,"e",@progbits
+	.string	"(\265/\375`\002\001}\f"
+	.string	"F\226P?\020O5\035w\0325,\352\021"
+	.string	"H\2671\321\316\034\367N\372\242\357\337\276B\360\351\376\263\023\205\216\2351i3\240!\367*a\225\357\252n\274\254\213\277\277\005\254Q\255\023\326\254C\367&{\247\024;"
+	.string	"<"
+	.string	">"
+	.string	"\2064^\277\3016\250\344\321Vq\362\302:4\270 \274`\273\313\275\322\325\307\323\231\215\376\034\231B\247/\037\340EiB\204I\302'\200g\030\225\335uc\302]o\233b\273\200\3750\273\244X\213\255PKd\270\353\267\357{xio\016\337\301\216\024\247\335\335B\337w\201|\322\233-\231\200\336\022]:\007o\257\226L\306\267\304G\210\\\222f!\002\b\026l\227\204\274\006(\226\377\321B\320\023.`,2\346\251_z\r\346G~<\240!\373\257\177\370\370\030\334\361\314\217^}\217\366z\372\362\002V(P\255\223h\306&U\231f\317\226\246\354l\372\332<\021\240\020\235GcA\240\240\323$\260p\f\034\370t\034\207/\021\020\364\026p\341\007v\233N\323\201\034\007c\331p\227\257\303E\006\330c\320}\034\350y\0377\237-M\271\"\242\016(UY\324\374\021'!b2\031\355\225\262Z\021\036"
+	.string	"\305\241r@\221\033)\006\007]\262x\"d\023\034\002\246B\236\240\232\300z\237b}[Y\b\210\202a\256p\3424\261\235\212\006U\320\236\261D]N:\026\ta\030*\234\316P6\363vZ"
+	.ascii	"\256=\244\260\320l\351\te\f"
+	.text
+	.section	.gnu.lto_handleHoTTTelemetry.part.0.112.93693f2592a244e9,"e",@progbits
+	.string	"(\265/\375`1\002\235\022"
+	.string	"\026\"zI\340\322&\035PwT\324\250\220\221\215\310 ]TWh\217\207\177\007a*\360d["
+	.string	"4Z2\332\242\256\250\312\242m\2155\230ms\333\035\254\210\363`\254!\304X\236P\365&\276/\331\256\023\266\234_\375\210\204\020\"eJ\001e"
+	.string	"g"
+	.string	"_"
+	.ascii	"\367Pn\362\335\353.\340\273g\237\204\355\227\216a\366\216\223"
+	.ascii	"?\363$\004\r\n\271\2469gxo=\034\366\317\353VA\230OR\213\375S"
+	.ascii	"\017\354\261\341\230\3250\274\353R4"
+	.string	"\310\270`b\243G\307\251f\243\333\231\320\200f%\265\233.\205)\311\307\213\25685\231j\200\203\240\313\234\323\"\031n\221\333\226\261\235\300\326X X\260\220\374\025fiyY\205\022#\177h\307Y`\032j\2326\244\212m\263\264\264\254:\371C#Y\2325\r5\315I\206\367\374\024?b\331X(nDs\234O~\300\240\361O<\327:\316,\266!\255\365\213^\366\351d\325\223\257\023\271:r\326t\254j\277\304M\300N\344\362\310\234<GHs\222\b\356YE$\273\333\355'\004\311\264\264\337\342.\\011\337=]\t\267\034\020}qC\013\332\365\261\255\372\276\016p9l4\210\375\244+\251\374\017F\245\364\263{~\352\273\367}\321;\021\267\234\220\255FK]\037/\370-\313\262\364v\260Auw\362_P\255\237\372#z304'\255\02429xJ\001*\006\"\nf\301jF\034G\326\013"
+	.ascii	"\277\254\254V)\bak\\\211(QF\\\20530\rP\341\313\250\nW\b8\025"
+	.ascii	"A\034\303U*5\206\247\273\324\254\314\373n\3169\277\335\030\n"
+	.ascii	"n*\204vJ\324\026\037\350g>pcC\r\331\306\274_\034 \036\025\274"
+	.ascii	"\0029K;Fsy\274w\217\244\034\037\335\372x\300\210\273\276nG\334"
+	.ascii	"\f\r0 \300\002\221\243\233\003\021\n\200yN@\021\234\210\357;"
+	.ascii	"\314b\257\371ycXi_\267w\334\320j\201]/\320=\264,\370\323\200"
+	.ascii	"l\306tK\016\027\315\226\261\001\001\033B\017\366\212\344\"G\300"
+	.ascii	"\032\272>-\312\2541\203\275\335\201\360\311\261C\366\362\226"
+	.ascii	"\263X\333t\331\265\300\250\274\374j\343a\241\0202\247.o\356\265"
+	.ascii	"t\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.93693f2592a244e9,"e",@progbits
+	.string	"(\265/\375`\021\005\255\025"
+	.string	"\206\340|K\220\026R:\300t2\322;\257\365wA\372q\030Jb\3436M\323'\302\250\347\006\220b"
+	.string	""
+	.string	"\360\027`#\273\231\3355\213"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\207\306\202\013.`!\271\345p\\\336b|\253\377\221Wo\207>\306\277\177@H\254\3342\005c"
+	.string	"f"
+	.string	"i"
+	.string	"\375'\324\301\215\r\372S\224\001o\301\213\344O_\b\037\217\307(\n\372R4A\f\002\231\0033\244\201\002\244O\377\007\355\351C\321\236#)^<}\037;5:\375'\232C\203\323\027\322\333\r"
+	.ascii	"\237\257u\350\315\253\310\377\271\336\257H\3767Xm\b\220\025\b"
+	.ascii	"\254L\177\377R3\026Vk\2555\355C\377\227\264+\372Z*\372FR\364"
+	.ascii	"\217\240\350o\235\350/1\321\307*\321\317\"\321W2\242_DD?I\210"
+	.ascii	">\222\255\265\376/ \372V\373\341\344[x\300\221\035\006\220\034"
+	.ascii	"\372D\350\206>\225\206>\220\f=\022C\377\274\320w\262\320?\025"
+	.ascii	"\232\207R\350;\241\300\3324\241w$\234x\214\320\367\242\020\372"
+	.ascii	"]\017lr\025\b\f\376\002,5V1\252\030\355\207=\226\224z5\336s?"
+	.ascii	"e)\230CV\343_\215\201v\221\252\220\254nX\270<\367C\250\264\240"
+	.ascii	"f4\336\242=\223)"
+	.string	"\036C1\032\227\247l6\233\361\006md\374[\206\272zA\243'\033~\021\207jb\274\305\245IABD3\306fp\306\344\037\215\311+\224\201qi\264{$\305k*\346\274\2139\0077\317\2456\266jp\341x\233\345bG\220\332\013\257\313\t\213+\307\343-2\265\300l\324\321\223\216\035\214\016\f%\212R\032\336v\274\306\345\0338\204Mfv\274E0\035\003\341\350rt\002\270,>\307e\321R\227\027f\021\300\205e$A\211a\303\265\314n\274b\\:\374\"\022\371ll\nw\223\202\204\264|6\326\321l\274r.M\023\025\214\\\250a\f\n\252\222\214\244\240\2444\215\001\200\002\241\262\262\r\021\240\220\006\225\"QI$\022\310P=\003\022)\342\227\313f\266oc\345]\0308\330r l\337l\305\321\331o\265b\r\354\345\214\313\227\343U\354\354\267\371\251\365\301 k8\032\337\323\020\246.\376B\001"
+	.ascii	"v\375v\006Q\366;\317\177Nr_\363o\264 \267\273\267\217\216\233"
+	.ascii	"\245\211C\211+\212\020\336xFT\372\367BG\240\300\332_\027l\314"
+	.ascii	"n\006\320\301=!\310\316$n \202@\266`x2\316\233\260\243\211h\342"
+	.ascii	"\"\273SE=\262\361\204\037N\251'\235\357\345\017\024A\252\256"
+	.ascii	")\017\376?\b\374\323\237ZP?G\335\254P\003"
+	.text
+	.section	.gnu.lto_.refs.93693f2592a244e9,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"]\b"
+	.string	"\266\3267%\220%I:\377\377\377\377\377\377\377s\261\b!\213\320\377\225\375\266\375\366m\263\2374\322\032\261\244\355F\b\331[\246*"
+	.string	"."
+	.string	"."
+	.string	")\277\352\003G\262\247{\274on\234U\352G\352\231\272\221zJ7B\375\240\216\250\037\352Ew\324\005|\325~\356\257\177\276\005\002}\035\276\260tu\350\271\274\261\324p\214(}\241{\265\256\222O\3456ZG\311\003\371\221\364l=)\177X\307\2447\031I\013\307,\334\231\037\007\351LtLl\200\237\246c\"\360kZ\320\021\371\r\323\031\346\017\255\033Xo\354Y{$\1771]1\237\254'\366G\351\247L\260\222\317\226\277\332\037\213\204n\\|\233\t\030c\363U<\240\343\t\300\217\242\237j\200\003\200+\360\r\370\013\037\361\0044\"\334\013~\202\177\360\017\277x\017"
+	.ascii	"\020\204\2125\r\202\344\354\225\262\340B\nv\365\034,\322p3\213"
+	.ascii	"\013\3228\003\022\235_\261\267oX\311N~\342hU\024"
+	.text
+	.section	.gnu.lto_.decls.93693f2592a244e9,"e",@progbits
+	.ascii	"(\265/\375`^S\325N\001\352)BxT \fQ9\351\024\013\267\214\377\321"
+	.ascii	"\374\344H\\\254BV\316\356\250\330\177T\220\356,\271\363\274\003"
+	.ascii	"\267k\016\273\376\330\256\321Su'\347\221\345\265\342\2007;\203"
+	.ascii	"\037_i\035}\370T\006l.\301\217\025\252\301c\023\252e.\235\261"
+	.ascii	"\212o\375\356\376\267%d\023\271Si\006|\007\255\007'\024y\360"
+	.ascii	"\340\001\270\245u\327\005\337\2472\360\323$>:\007\037u\203o\321"
+	.ascii	"\256\230l\340\366\232\254\267z\3146\335r\326:@\022\256\2261C"
+	.ascii	"\206Z\325\026\262\216a\355l3,+\225\003H\322\314\377\273\254\315"
+	.ascii	"\372\254\235\364\023\313&\3250\314\310\332Fk\331\346VN\272\321"
+	.ascii	" \311\222\r\334^\316L $^f\232\374\334&\277\267:2O\372\036=\303"
+	.ascii	"\317@\207\223e\217\023\226\264\222f\322I\032\205^Z\266\026k$"
+	.ascii	"\357\033\215\343\255\305\372\004\333v2\227\2776\2572\274\034"
+	.ascii	"m\005T\n\345((\262\336!\326<\306\360\214\336b\375\243\217\234"
+	.ascii	"P\256$@\006\t^\316\331\203\207\"\017\036<x\270\\\346\3442\340"
+	.ascii	"=\332\004\037\005\303F\212\222\224\310Q\353{\024\007\2765k\""
+	.ascii	"-\244\255N&\034\206\241F\004\257\213tX\017\261lM\244\203\274"
+	.ascii	"}\330-\031\200\365\0270J(Gy\205-\337\232Hs\365\0270\212\231\261"
+	.ascii	"F\\\251\2511\226s\366P\344\301C\317\221\037?\320\340\373{\007"
+	.ascii	"\377\342\341\3375\270\201t\227e\273\\{\361D1\363\332\220-\311"
+	.ascii	"!}\177\313`\0279\347l/\227\376.\227\3766\361\357\034\376y\303"
+	.ascii	"\277j\370x\226(\375e\202\177\223\340\337#\3302-QZd\207\322\337"
+	.ascii	"!\270\265\272\263\272\306[\253\261.b\304\177\242Z\353\346\254"
+	.ascii	"\264\366\002\240\265\027\240rG\224j\351\375\365\302\277;pSu\225"
+	.ascii	"e\303\240i0\203\272\210\035)j}\177\263\360-\006\351\331\327g"
+	.ascii	"1H\177\241\360\341,Q\372\363\r\376\331\006w\266D)\007;\224\206"
+	.ascii	"\210j(T\315\013\231\262oC\265\322\326\341y\242\204s\246\357\355"
+	.ascii	"\033\334\235\226\272,v)\264y\373\215\314\314\375v\317\322\261"
+	.ascii	"z\366\216u\323I\373\306\366\3318\235-\237"
+	.string	"\205c\347\330<k\307\342Y9\226\315\326\261w\267ll\233_f\316Q9\347[37\276%\225\337\210L\230-]l\230\2704hP\346d\260\306\332\001\321\234\271\274,s\316\037!g\333ls\213\001dj\314~#[\307\212\261cl\323\315\2038b\360rf\336J\371-s\312\3362g&3n\215Q\0310\313\234\231\314_\304\b[\307Z\261m\3003g\037l\22693\215n\353X4\326n\303\213\234\271z`@c%\214\326^\316\331C\221\007\037;\031Mj\f\340\332\246%J7\330\241\364\347\t\370\247\017l\323\330:\313\246\301\252\271=c\261\034U233\347\034d\363\302\240\260\372\376\274\201I\220\263\325\220\332\276>\253!\375\031\205\333\016\245\3577\370\335\304o\271\246\245\273n\316\220\314@k\n\261`z\354@\305m\365}\357\300\326\213\375b\331\354\334o\271\330\267\3374\256\274\2263\023\350T\336"
+	.string	"\363\326\367\266C\032\324\327\327\327g;\244\357+|\355P\372&\035|K\006\337\246\200\205\232\340\"/\314\301\022\245\267R\270\203%J\337\204CX\242\364\027\300\034X\242\364%\260M\263j\226\255\002\033\345\"F\374L\246e\263\234\231A@w\234\334\241\323\367\013\300\267k\237 -\2178\006|[Aj\373l\005\351\033\013\331\241\364n\226(\375\355Y\005A\314\033U_}\177\373\344\267e\326\254\3039E\305\225\335rfV"
+	.string	"\342;\0035\326\367LK\224b;\224\376\375u&\317!\307"
+	.string	"\315\025k\201\216\355\267\026\306\316\260\377\f2w\237\037u\362\333\276\337v\320\277\277'\370\255\207\277\201\277\265\363\333\005t\317\337@!\376~sr\375\266\303o1\260 \376\363\307\337\"(\372\277\001\305\034\024\316\337gN\037S\316\036{:4p6\265\340\361\237:\376s\353o\031\017\300\217\276}%I\250\321\231N\355|\200\026\227G\371:\223-Z\313/\374(\330\337g\026\\\263\260\026\254h\340\032~\024G3]\234\013\370\255\006\260\316\253\377\244\361\237T\377Q\264Y\375\375u&\273\001\347k1\344\227&jL%\217\322\202\305\203~\364\351\357\25739\366\2016\362w\003N\030\306c\320\310S\352o%\250\372\237\030D\375M\302\377(\347\373\357F\251\203\340)\370Q\r\234\031@\375g\002\224\035\350\340\177~\264\351\357\2573\371wV\376\317\243\022\374-v\212\360\367\024\t\376\316\177#o\341Om\230\323"
+	.string	"#\370{\031|\317\217\332\371m\226\337\252\375V\313o=\370\255\333oS\370m\211\337\262\370\355\007\277\255\362\333\"\277\035\376\026\313o\331~K\374[\307)\202\337:\371\255\225\337\226\375V\356\267\305\337\002\277\001\004\377\351\342?Y\374\347\372\237\307\323\311z\371\207\037\345\373-\331o\333\376GY\361[\027\277\365\300\3374~\207\352,\376V\003g\323\177\376\020\377\2438\006\377\271\342\267\034\350\035h\002\376\336;\231\376\306\360[\016~\213\374\255\002\354\035+\342?\227\376\026\301\251\342\357\021l\340{\363\367\205\2777\374M\364\367\377\276\340o\n\376\026\372\233"
+	.string	"\177[\360\267\317\377(\337\360\002\374g\322\177\r\374G\361\237)~\013\354\020<\303\217\326\375}\377\266\177W\370\033\203\206\262J~k\344\267W~\273\345\264\340\267]\254\027\016\374\347\006\376\023\003'\372\321\t\374'\322\177R\340?C\370O\022\377\311\200\377\344\340?5\370\317\017\377y\200\377\354\360\237"
+	.ascii	"\370O\240\377\304\377\231\376\347\375\033\315\337t\177\177\371"
+	.ascii	"\317\376\317\377}\347\357:\177\363\375=\347o\275\277\355\376"
+	.ascii	"N\363\367\230\277\303\374=\3677\227\277\343\376\206\373\333\312"
+	.ascii	"\337T\376n\373[\355o\346\337g\177\233\375M\366\367\330\337L\376"
+	.ascii	"\026\373[\311\337\313\277\217\374\r\366w\327\337\\\177\373\370"
+	.ascii	"{\307\337Y\377\325\374\026\370\367\325\337V\177\213\340\267\026"
+	.ascii	"\376V\361\367\361o\016\374\r\202\337v\371-\007\376\246\3617\325"
+	.ascii	"\3372~\253\201\277O\374=\365w\003\376~\3617\324o\005\360?\312"
+	.ascii	"\337\311\277K\3607\t\376\036\301\177\244\277C\360w\213\277]\374"
+	.ascii	"\315\342o\344\337O\177\257\177\007\377\356\300\337\036~\373\345"
+	.ascii	"\267^~k\302o\317\337\332\377O\376\233\375O\361\377\313\377\f"
+	.ascii	"}}}}?\217\333/D\202\277\003\034k^\\FW\242\254-3\ff\322NQq\345"
+	.ascii	"eN\323u\205\327\222P2U\316\331\276\301K,\255\274\276I4+-3\344"
+	.ascii	"\212\232\276\037B\303\364\201\363!\245F_\346Z\3169\350G\315\024"
+	.ascii	"1p\372\2424P1o\264\260\365\375\020\026\214R!\315A\003\323\367"
+	.ascii	"CPP\031A?\312\033V\350\306\320)`\234\031p\266\364\375\220\027"
+	.ascii	"\206\361\342\305\351\345H(g\2579\313\241\032\370G\241n\331P\250"
+	.ascii	"K\207g*\347,\006\240e5\t\263\227\257\256\fp\013i\360\217*\321"
+	.ascii	"$\232D\263\206_\223+?\202\364a\200\243\260P1\273s;k6\324d4\023"
+	.ascii	"\277X\302\243F\035:g\227\246\032V\337;\247\311\250])\323\367"
+	.ascii	"\026\272\340\377\362\335=t\315\213^\230=\333\326d\300PA\311i"
+	.ascii	"\255_\231\026/\2678f\256\034\326\235\0338z?Q\300\b\001\243\367"
+	.ascii	"FG^\017(}\363\322.Wxh\372\336"
+	.ascii	"B\024\374\377\266\271l\356\232kw\361\356\235e\273nn\235\233\313"
+	.ascii	"\274hN(W\370\r*\f\036\0355d\324\214\251\273nn\0320xhd\310\244"
+	.ascii	"qs\313hP\226\267\244\310C\320\0319n]\200\367\026n\340[\200\302"
+	.ascii	"\257\020\347\236\261kmC\350\364}\0051\327\3143\220\017\030\234"
+	.ascii	"\233\262\357+T\301\257P\206_\341\013\377\227\256\t\204%\311\233"
+	.ascii	"\253\346\305\364\224iA\"\247o\230\323\006\333\232\225\276\257"
+	.ascii	"\200\003[&\n=\327\367v\302\214%\022\252e\2778\322sU\313\267&"
+	.ascii	"u\256\021)\327\212\225\232\225\330\024\336\330-\263M7\017\264"
+	.ascii	"\314\301cr"
+	.string	"\007\217\313\365r\277\334\271{\345\302\335-\027\314\225\273]\256\226\373v\261\3348\313v\263\334(\277m\327\355E7\313e\356\341A\271l\033\240\246B\330b\203\367b\331s'\224+\334\246&\003/\313Mr\227p u\3053\203L\f\274\233\345\232]4\253,!z\036<\244PV\324P\260\340\336*J\250\314\312\372^\210\016\337\262\335\024\250\310QI\206\365\375\357\224_*\277\210\021g\363\223\263Y\316y\303\t\206\310\222\265\276\207\323V\377y.\332\222\255 }/\244\005_\246%J\357f\207\322\013I\301\377e[s\203\262F\r\363*A\363vB\337\377\226\355\252\3354f.J\317\310\204y\351{\2411|\241$\370BA\236\334\263 9Uzg\372^h\007\276On\\\262\037\261,+$}/4\205\257\023\241\214\037$\007?H\r~\020\030\374\240,\370\277K\256\222\345\tiw}\233A?w\312\310"
+	.ascii	"\351\373 *\370Ag\370AI\360\203\276\360\203p\3403\355P\372\337"
+	.ascii	"\"\027F\312\003\306\033\222\276\267h`\270,[\252\314\026:!N\256"
+	.ascii	"\234\2713\213c\327G7\245J\027\033*\315\273\024\336\3148\351\330"
+	.ascii	"\361\265\224\030+r\320\350\300\234\270\301\273\243\241\027\243"
+	.ascii	"J\025\217\226j\274.\313\250\273\037h\310\354\356\216\270\251"
+	.ascii	"Z\266\261\"\203\206\246\224\003R\307\t\335\231\331\330\0268w"
+	.ascii	"So^k\356t,\215\346\330\315y\033s'e\317\316\216\031\037\235\245"
+	.ascii	"\231'PwaT=\226\367\305\325q\211\334\250\313u\275.\330\255\272"
+	.ascii	"5\356\220+\343\n\271[\027\352J\335|q\234}W\353\306\2709\356\324"
+	.ascii	"\335q\255\316;\327\306\355qo\334\344\355\272<.\326\rr\177\\\252"
+	.ascii	";\343\322\270@\356\327\275\272\312\353\343f\3350\313va\234v\352"
+	.ascii	"\356\306\212\200Y\232\205\271{Ks\347\344\313.\217j\251\346\356"
+	.ascii	"\2045wF.\214\223\r\002\260`\025\001\243\272\310\230\221\201\373"
+	.ascii	"\240)|\340\034|`\035>\020\f>\360\n>p\n>\360\f\037\250\004\037"
+	.ascii	"\b\206\017\334\302\007b\341\003_\340\003\361\341\003\255\301"
+	.ascii	"\007\022\203\017\364\206\017\204\206\017\224\004\037\350\013"
+	.ascii	"\037\310\006>\220\f\374\237>\374\0377\370?g\360\177\276\340\377"
+	.ascii	"\300\341\377\250\341\377\210\341\377\200\341\377\354\300\377"
+	.ascii	"\271\302\377y\201\3573\007\377\347\034\222\030H\352\346\372\376"
+	.ascii	"\347\227\323\013v\322\245\305\255o\027\03788\312\262\372\336"
+	.ascii	"\307\016?\003!@\316\314\306\260D\025\211\321c\251D\322\224\221"
+	.ascii	"\244JW\216 I\316\314\306\316+\031\226I\243j\251ug\331R/\354\206"
+	.ascii	"TY-\177\324\325\031\365\260\263L,\273\030T\3113\26310\254\021"
+	.ascii	"\277e\2367\352\346\2343tl\355\265\024\224\235\221\226\321u\320"
+	.ascii	"\226\347\216\272\273*gr,G\033\034|fw\314Z\252\355\330\235\235"
+	.ascii	"0~\313\234ZBwf6\346\005\344\314l,\253\257\371\033\351\250c\323"
+	.ascii	"}eK#\037uj\260\330\250\243\003D\214\021\217\2725M\347o\251\""
+	.ascii	"nK\313\264\242j\251l\347d\311e\333\200I\241\fU\227\246\306\017"
+	.ascii	"(gfc\347\222S\355|r\236\235cg\222\023\312)w\256\235[N+\247\221"
+	.ascii	"\323\354\324rf9\243\234R\316*'\334\251\344\274rN9\311\316\267"
+	.ascii	"\363\204\223\311\331v\242\235l'\363tr\246\235b'\225\263\311\231"
+	.ascii	"\302\271<Q8\261\234e\347\221\323\355\214;\271X\266\023\311\031"
+	.ascii	"\366s\310I\344\326\350\313\342\300:3\033\313\231)u\"9\245l\333"
+	.ascii	"\b\024\222gf{93\177t\346\254\350e\340\336g\rw\323\022\245\007"
+	.ascii	"\260C\351}P\300\367!\202\357\303\003\337\207\006\276O\024~O\034"
+	.ascii	"\374\2364\370=M\374\036.\370=p\370=n\370=L\374\2361\374\236%"
+	.ascii	"~O\030~\017\027~\317\026~\317\025~\317\024~O\306\347\331\303"
+	.ascii	"\347I\203\317\303\005\237\307\r\237g\f\237G\t>\217\021|\036 "
+	.ascii	"\370<7\360y\250\360y\224\370\370\r>.\203\277g\211\322\343.\370"
+	.ascii	"\330\n>N\303\307L\3601\021|\374\205\217}\340c,|\034\205\377\253"
+	.ascii	"\203\377\323\303\347\322s\032\316\317\013\2212'\300\351.m\327"
+	.ascii	"\006\017N\343\231\315\265\024\234F\353(\300(\241\234\221\364"
+	.ascii	"\341\345\234-\023N\2735\027\240\222\231\223\3006Wz-\247\3434"
+	.ascii	"_\357Y\266\206\323n\336y\375\246_4\234\236j2`\0243'7$\301\313"
+	.ascii	"@+\261*0?\027\315\226(=\234\035J\377k\342\377\270\340gp\246\255"
+	.ascii	"\304\330\265\231\266\262\315\260\007dI\203W\246\277\352\360,"
+	.ascii	"\023L\213\261M7\017\360\356\322\364\232\256k4\255\246\357\232"
+	.ascii	"M\267\261lmGF\315\262I\027\267\006\3172\355\332K\317\331\246"
+	.ascii	"\233\007Y\330\340\331\365\030\333\006L2\263U\317\021\240\234"
+	.ascii	",D\226\026\356\177p\370\2775\374_\031\376O\t\376/\f\377\207\003"
+	.ascii	"?\215%J;\214\317\2278\261\276\276\377M\341\377\224\035\372\013"
+	.ascii	"3\210\347\314\233\036n}\237\362\341\247x\370i\032\334[4\364\274"
+	.ascii	"Q\331\302\352\3734\016\247\320q@\245P\316H\336\360\264t\026\313"
+	.ascii	"\326r-\327R\232\212m\206]2)\032<\334){^^\322{\213\305J\225\345"
+	.ascii	"\225\306\322p\226\255\343\336U\254\304\365\333\215\301|\223w"
+	.ascii	"<\003\243\203\357S1\374\024\t~J\004?\365\302\177O\261T\254\235"
+	.ascii	"\345\312\360\313\312\002%\256\257=c\364\2362\224^m1\263[\316"
+	.ascii	"9\350\204\323\"U\247\357\323\037\370\351\r\234\276\325\232\255"
+	.ascii	"\327,[G\201bg\231\326_@\236\234\273\352\230EifOO\333\240U=\313"
+	.ascii	"7v\250R6sR\3304g\244wi\325\2277\024\232\364M\325\244jR;\233\257"
+	.ascii	"B\360\245\245vI\226xQ\365\275\005e\370O\353\370|l\250\301z\322"
+	.ascii	"\227ifeU\204+E\203Z\235p\267'\247oZ\346,A____\235\234\225i\231"
+	.ascii	"N\317\244f\236\226\271\265\027X{A\320/\315\330\2242\275i3\245"
+	.ascii	"\263lE\351\2301P4x\364\275\005b\270\004\331\026\245\357\263E"
+	.ascii	"\351\237\212\371\001l\242\365\r\351\233zI\275\244`z,\347\236"
+	.ascii	"\202\361\300\335\224Z\337\364\013\232\367#w%\r\232\037\251\\"
+	.ascii	"*\227r\261\371J\003\264\264t\313S.j:\216\234\3207\325\202\346"
+	.ascii	"8\251\366\2564o\201\214+WR,\326+\207\0172\233#\316XZ\334S,@N"
+	.ascii	"l\214I\242\325c\210\254\265\365}\005vTN%}\013a3\f*`9\360\200"
+	.ascii	"\210\330@\002#\205\247o\251\02593\256\234\261R\345\316\2450\303"
+	.ascii	"\f\330\235.m\264\250\251\245R\260\2449\240I\0316\267\247RP-\334"
+	.ascii	"\026\346\004M\337t-]\202\007\366\326\226Fiz\271\321\225\247\301"
+	.ascii	"\315\013V\312v\353(\270\233\252\202\306\370\251B\027\245\n\224"
+	.ascii	"\263\263\024\212M\313VEO\362\204\350"
+	.ascii	"\355\311\241K\002\2272\237B1\263W'F\337\024\r-R$\013\216%(\220"
+	.ascii	"\221\245f6-[]x\002\245\306\313\036Y\2143?\312\236\232\265\026"
+	.ascii	"\020\034\266\346Y\025\023&\351\230\027\2358Vb8\232<\035\263m"
+	.ascii	"5\272\244\005\251@\271\\\246b!"
+	.string	"l\206\021Em\017\217\247\n\b\024\035K\236\212\365\334\017\030\031#^J~\230\311\314&U\222&\341\311[c\027\005\204\332\261\024r\207\004\tz\304\246e+\007\214\021\242\207\016\231\342\004N\f\021\"\251\221\"\234\237\260=\301\313y\253\303y\205H\337\234\264\310S#=Av$\315\2124\343\304q\353\373\ro@~ iX\021W\322\r\003\344\342\226\230\355\345\274\325\301\247\216k.)\344iX\021k\004\315\230-}\323 \027\r\017\f'M\252\372\246`h\f5hU\214\364M\277\256\225\253\214\202\001\246o\352\325sAf>\342\272\364M\273.\232\245\003w&\306-\2132\304\314Y\337o`Z=\325\262J\177\234g~r2-[\375\336\276\220Q\262\227\247\266:\370@\231\001\205\256\357\237\352x\372\343\251\017\021#~\207\307\230\234Q\366M{\034\270\005&\016\257\357\323\035)\217\237\247g\t\330Z\223\276\337"
+	.ascii	"\004\037\001i7\260\260\372\2469~\367\237\247\305\356\250\334"
+	.ascii	"\364M\267.\367\237\347g\013\315\236\220\276\207\223\342\370\317"
+	.ascii	"s\206\361\"\003\3257\255\221\332\260l\377\222\33683\b\030\007"
+	.ascii	"C\312\227\276\337\240\003\337\376KZ\002\373/i\212\3654\353\347"
+	.ascii	"\341\211\363\001\326\325\367\033\262\360\237^\375<\277)gv,\373"
+	.ascii	"~C\025\376\006\251TF*#\255*\342:\321`Ac2\226\363V\207+d\316\023"
+	.ascii	"5}\323\252\224\212\207/\007\227\235\276\351\f%\260\266,}O\301"
+	.ascii	"\030|\n\276\340?\235\232\352\271\007\270e%V\0079\2572\275\nG"
+	.ascii	"\232M\372\236\002\"\370O\245R\251\326\272If\266\272\200\346E"
+	.ascii	"\026\267\227\257\270\030\300\b\356j\252\357'\260\223F\245Qqg"
+	.ascii	"\360\237*S%\252u\224\225Y\034<\311\233@K\232\323\214\202\375"
+	.ascii	"\310\323k\023{\321\367\023\254\335\371\035\024\f'sV{S\207I\337"
+	.ascii	"O\200\004\327\251\203\356\310\221\346\343%G\336\352\373\tp\304"
+	.ascii	"A\347\304A\371\344\310A\371p\322\f\235%PoM\030\234\275\243|Q"
+	.ascii	"wD\354\240yZ\2040\223}?A\306\3270\346\356\016\325+\352\242\f"
+	.ascii	"\022\243L\002\243/\252G\226\307\326\354\213\266A\363p\036cr$"
+	.ascii	"\317M\017\224[\034>\274;\307G\f\212I\017\274\323\216\217\222"
+	.ascii	"\017\256\256/\312\306\212\231\207\367U'\006\004F\337k\200\303"
+	.ascii	"?\252\006M\203\332\2413l\316\3126\206X\2224x\032\326\36050)\203"
+	.ascii	"\246)\203\2421c\006E\203\223\351\216\255\016XJ\031\2721g\216"
+	.ascii	"\242\001\232\311\341\361\315\370\317\023\224#\262\327\367\032"
+	.ascii	"\272\3605\300h\242c\232tt(\230\315WqR\034\025`\243c\331\367E"
+	.ascii	"m\360\213\340\302\204y2\246\250\f{A\347\274\240`i\316\226\311"
+	.ascii	"eu\225\267\256:|\371\202\202i@\313\333\352\300\023\205\013\307"
+	.ascii	"X\337\027q\341g\270\203\217b\261\250\334\026\224\213m\303y\371"
+	.ascii	"\243\022"
+	.string	"\303\016\317\215\026-h\033N\366\310\312@\207\237!\016\337\332\2664.\016\005\273P\316\031*g\037=R\254\264\ffppi`\370\215e\321*\277\210\021h\n\250\225\326\272\027\310\311\240\205\217\241\017K\221\202R\221\243\234r\364\222A;\223f\356?O\032\306\252\316\234\276\307`\307\306\206\266\201\211b\331\320\266\2628&\216\276\207\303\203z\305Y\363\326\367\030\342\360Q(\026US\273{\003(\353\232\202o\357^\372\243L\246m\263B\031\212\314\227\345\020\374\243gg\266\255('\3638\224\245\371\300o-\213\232\261\241f\255U\224\223nB\224)1\\a22\024\f\347\234\305,\353\340\2611\024\314\t\221\031&L\222\344a\301?*&v\365\274B<IsS\242dD\2231DI\360Q$\026]\262\241\313\333<\247\262\262\213\203'J\210\302\360\355m\n\271\020\364\b\3169\217i\022f\f5r\364\310M\276"
+	.string	"c\247/\032\206\026\371\317\023dW\265\314\201\026A\211p\241\361\245H\230\253\203J\226.Cn\224\037\037`:\320\364=\234\213\366\237\347\227\265\005\016\253\357\211\244\360\327\027\nfs\316Y.\357p\216\202\241c\304\220L\351\373\013o\360\217v\335\262\241]\250\325\003\334\270\262V\210%\\l\340\200T\352\340\360\372\376\002\035\376Q\256[6\224\013\255\272Qi9\271\332\361A\266\227\363\226\001x\222\320\341\331\365\375\205)\370(\017\213\372`C}\364\334QVf\r\300\311\030\246\001~a\t\276\355\271\364h\r\324\306\321\033\277\201\356\260W9\347\255\234\314\013Ag\353\252\303\217\3528\272\003\250J\030\324\r4\207\235\224.4rl\331\253-\2610]r\220\\\362.\r\305q\206\001q\220y\231\351\373\013:\360\177\373\376\323\254\274\3129g\241\314|\005\365\223\376\366\026\265\266\303\017dO\033\200\3777\347c"
+	.string	"\0053\277X+\223s\266zx\311\233r\007\207\2146s\216\352J>\240\013+\252\013\307\324Z\027V\205\251\265\256\234\214B\222\254p\225\273\222Sk9W\210\212Jz\300\2055\265\246\314\025\246\3262V~1\006\313ffW2Gq\345\n9*+\363\032\027\026\207\251\250.\254\2515%V\205\251\265.\254\274\326\225\205r\224\362*FT\276\252\220\327\272\334\3445.,\241\2515.\254\251\265\2567\313'cL\215\032}e\206\334\261W\246\2422\215*\036\312+\241\346\024\223+\247\311\331\272I\345\253\334\3149"
+	.string	"9\363\340\272J\243\304a\341\240\2324\240RPrYf\316YC\025\224\027W\216j&mnN\211q\345,\006\305\224\253r\316Y\203$\263\231\207\330f\362\213G\246\222\312y\202\314\314\271*\347\244\315\315\234s2\347\374\273\342\301\314Y\207\320\324\262\252*\347\255\242\252\314#yE*\347vS\003\2075\025KC\025Ec\211 \024(\214GC\032\206\204P\220@\242\004\365(l\241t\024\036-\025\207\310\0222\224\300@\202\250\304\005GuUO\224\320P\302\t\022\037\2640\212pT\227\226\206G\024J\304'#\023rCz\301\003\013\224\212C\025\027\212\303\246\243\272\252J\027|\316\364\241\370t\004\221\244\002"
+	.ascii	"\310\237\222\260g\2518\\\207\302\013\270 AER\221FbR\020RQu2\002"
+	.ascii	"\317\364a\2518<\256H\020\252\322\0231\2518\004qD>\201\300@$>"
+	.ascii	"\025\213\306\342o\r\252 \030\"\323\026\306#\323j,\376T\bU\342"
+	.ascii	"]Ud\223\2526\r\327\t\326 \362\004rH$\016\233\3223}0\201\"\004"
+	.ascii	"$\020\253\272t\024\256H2\022K\250Gc\211\2403}P\032:)\251\253"
+	.ascii	"\220\305pM\"\201\024^@U26\035\207\302\241\225\204R\320:,\016"
+	.ascii	"+\254G\343\b\352Q\005\321\t\022\037`@\026\215NH\225\004\244\021"
+	.ascii	"@P\217B'\365X\001\262\004\322\b ()\t+\370\210\370pT\233\206("
+	.ascii	"\200\206T\242RQ\3104A\206\025I*S\222\005J*1\205\260\370\001\323"
+	.ascii	"\205\tB|X\217B\247\017\353\3218\002\n\024\306\243\013~\202B|"
+	.ascii	"@\252\353\360x\001\240p\025z\240TT\221\326\325\310D\264\222@"
+	.ascii	"\201\242\202\321\207\2431\002K\305\341\n\243\2218$\\\205\036"
+	.string	" \255HR\231J\f\255H\365\351\003*\t\252\222\361\204\tGaq\b\001$RM2\036\235\212~kQE2\242@\252\253\t\020 \201C\322\261\304\022\362\304\272\032\231z\226\212C\245\242\212\204\fa]\215L@I*\t\353jd\032\302"
+	.string	"\t$\254\253\361\210\t\371DTQ\001\003(\216\306\b\254G\343\b\352\361i=\032GXW#\023^\217Bd\tE\n\254\253\361\350h\214"
+	.string	"\211\025Gc\213\013\220*rH\024\016\327aqh\241I]\221& aP\233\206(\216V\244\220\210\001\371\004\001u\025*9=\025=ixT\213\352\022\276\006\033 `\003\016\\\374\316A\007!:\b\221\236\203\016\214\214:\330\300\b\177\003\243S\r.\025\207G!\023\322\272\256Ad\tj\323p\305j0\002\027N\220\370\340I\352\222\020\211TO \215"
+	.ascii	"\302\272\032\231\200\353j\3018\314\220\301\302\n\244\360D\361"
+	.ascii	"I\305\217\032\f\001\203\023\262\t\351\264T\301\205\252T\fA]\205"
+	.ascii	"G\245'a\212\240\013c\212\025IBb\n\f\353\231>\200@\036U\026\303"
+	.ascii	"\243\322q\035Ae1T\223T\022\212V$\tS\020\211\302\022.\216=\310"
+	.ascii	"\340\217\005\326\243q\004\242pxT\221B*1\205\020\005\213\364\250"
+	.ascii	"\016U\f\327\242\2524\354Q\203\252\222\361\304z4:\365\250J\306"
+	.ascii	"\246\253\006)\260\036\215"
+	.string	"N@\310\242q\270:\031\177\352*$A\351I\230\002\253 \030\"\251 \030\"\341\025\037\177\224\204\352\021q(DqTU\250x\202\200\213\365\007\2114\002\b@B&\216|\220D@\022\341\bI\204\324\304Q\260I\311\307\304Q0IE\006/\360A\020it\3721q\024\fB\252\353\220\250\256Bd\020\351\264\004\344b\250\"\2506\031\231\200D\242\361\270\"iX\354A\"\205NM\306\244\240J\\*\n\201\230\232z\220HdPm\032\256A\244\323\322\217\211\243 \021\331\004<\246\030\262\3401\022\221\301Q\310\224\024T\325\243\212\236\365L\033\234\214+\222\007\031\004\001\351D\360\004\211\017\202(PP\340\b\250\256&\244\b\256G\341\212\354\t6\tU \244\223\252\246\b.\025\207\305\243\260\005\220\3220x4\"\213*\222\307H\004\262\351($\n\201L\004\215Dd\240\301\210\r\022`$\"\003\rFlp\024L"
+	.string	"\221\250&\375L\034\031\231\020\261\256\302\024AF\"\234\232\324\0255q\024\3541q\024\\\213\352\361\370\224\304c\342(X\034\n\233\200&\216\202N\302\244\340\272\nS\364\2308\n\"3PW\3411E\323\220\230\344c\342(\330\344tD\213\303\246$\025\031L\032\036\327$\225\250\376\2308\n*\251\252\023\362\207\f\"\r\025\215C\344Qe\361\263"
+	.string	"\221\250&\371\250K\302\243\352\324$\304\305\026\302\243\007L$\232\360Z|2\226 \022\325$\236\265\250&\035\325\021\226\212\303\342P\330\244\036\205\324\240\272\nW$\240\272\nW$\272\006Ed`\302:L\022:\t\223\260\tGu]\205)~k\020\251\022\227\212$\216*\361\351\003\2423}xj\032\202X\231\226\206D\025ED\242\361x\231\222\326\241\023\332Bh\302\311\"m!<\236\253\0207\225PRWa\323pE\252>\310\246\022\306\341Q\310\0027\225X\221j\212\024\237\351\303jdB:\t\213H\020\034V!R\323S1E\006\205\253\320\203\242q\270>\021\215HH\247\245\n\353\231> \235\226@\030\207\027V\242\360D\n\223\214&\220NK@\253\220x\256A\021\031\254\305\341\257h$\236LD\342I\024\006\221F"
+	.ascii	"\341GIU\235\220|T\344\361\311XB\251\370d<.\3758\031\225\230."
+	.ascii	"\321\210<]\fU\234D\243\021\002ATm2\036\271\030\252\370=a5\251"
+	.ascii	"(\\\221C%\240\332d<2\242(\032\207k\222z\034*\005!\235\226\316"
+	.ascii	"3}\270\340F'\365\bb5\032\217 |\220\301\245\241\212\242\261D\205"
+	.ascii	"U(\264\00670Z\213\303\237\252\364\264\016\227\212F\023.\206\021"
+	.ascii	"0\212\200tZ\252\300\224\264\016[ \205\224\324\365\250\262(\016"
+	.ascii	"\203\026\\\250D\247'\017T\020\205L=j0\002JG\243\261\004\322\t"
+	.ascii	"\004\242U\330t4\252\b\252\253\2608T:\032\215Ijp\035\026K\360"
+	.ascii	"Y\207\305\247\236\242q\210\034&\251G'\244P\005\213\240\t+\220"
+	.ascii	"G\025\031\210B\026Gu-\206\240T|2\"5\035\205D\022\030P I \325"
+	.ascii	"'\242\320\002JC\247\013\352\222p%\032Y\004\211D5)\270\036\215"
+	.ascii	"N\352q\350i\025\256\310\240\222\252TTW\027\352\006$Q-\026\205"
+	.ascii	"LI\301\244cQ\3218\\\207H\243\023\221\321\032\344`-\016\237~W"
+	.ascii	"\200\002Jp(A\004\020p\322\207u52\2010\341\270\252M*Q]A\024\207"
+	.ascii	"\302&\020IG$\210\017\024\250\253\360\030\024!<\256.\324\340\212"
+	.ascii	"\342\220\310B\3304\364\377G\004\2351\227VG\313\220_\330\232\254"
+	.ascii	"+\275\276i\225\274\0307\272\336\365\013\302\223\314y\271U\243"
+	.ascii	"\303/\310\017\354'\204J\0265?\260\337\227\23157e(\025\231\016"
+	.ascii	";\272\237\227\275\373\311\255\005q\323\367\034\332\340\377\007"
+	.ascii	"DO\317k\354K\337\256\273\343\306\307\357\007\232;ylW|PY[\303"
+	.ascii	"g\247/\017\036\251YW\2230{\034"
+	.string	"\344t\350@\301\276tq\200\202o\334\370m\335f)\213\2446\366\260\232o\376\303q\306\321\342\243N\337s\020\202\377\237\215\024\213\332TX\216\032)\024 \034\037M\202h\265\001\367\274\230\211\361\313J\315\322p\201Q\365\375]\375\256P\260;7\016Z?\032?\032(XU\025\274\276_\214_\214\037\325\b\2711\277\031\377Q\371\320\325\005Q\323\367'\343\356\001U%Q\266\365=\234\313\331\270R\006\246\357\001\300\006\377\277\251#V|(\021\322\367'\365\223J\355x\214\232t\001@\013\376\177/\302\006\340\245\214TT*\326\263e\007\t\030\250tL\304\231e\225\022\354J\311\021\346\225D\265\306\262\\\305\375\262\024<D\215l\255\357\r\330\266\207\226\343Nj\004\214\315\334\322\016\272\203\n\021\250\257\276)\235N\347\244u\236\32293\245\003\200:A\326^\020\244\203\n\027%\351\335\3333C\213\023\307\310\020=\275\036K"
+	.string	"\300H\363\322<t\007\017\215\345\035\306\303Cw4\027W\316\313\037\025\030t\360,\340\202\037\206\r\250c\202\004k\232'1\243\034CH\031\232\231\3314\035\003\026@Ph@\036\023\252\343\\\017\023"
+	.string	"\303\310\312\3543UQ1\246DDD$I\371\244PX\016\207\017\352gv]\321\221r\351\264\314\364\b\340\322\220\3631\3776{\314\\\\\001t\202\321\313\204\036X\r\276\222\241\312\034?\222\034\310\264\270\250\233\241\242\364y'\367$}\024/(\210\230\001\210H}\rr\f\231\304h\022\224}\037\0358\r\260\304_Ui\242\262\024\006.\346\326\247\221\0266X\361D\333\\\232y\200\017\307\0228*\215\030\\\333\272\222\304\214\206\304\245?\273\232q\312$yV\2057\230\224\223\"#g\203\256\002F\347\274\005Aq\250\313v-\366T:s\270%\233\207\331\360\222\020#\331\r\217\205\337\223\224"
+	.ascii	"\312\341c\251\007:\374\307Q(=\216\211\254\363\323\214w\347Z\302"
+	.ascii	"\313Z7\337.\226\305T\244\361\326\2305\216>\311*\3372\345\027"
+	.ascii	"(o\377\305'\256\336\324\006) \343\210\206\261\013\021=8\352\256"
+	.ascii	"\370\256 K\236\217\321"
+	.string	"\214\335>\tR\013I\306\371d\232\316\233C\244\325+F\201?\351V\203%\240\\\177\320\243vb\307\323\273\002qD\200\"t^\217\252\006a\246>J\304-KA\3059\324T<\304U"
+	.string	"\373\310\"T\200\241\216\307\310j\200w\301\272\262\267\2104"
+	.string	"\271\241\3567x\217\224\241|S\032\331\bP\025X\217\346\311K\301\037\032\367-\214vr\214:EDx\323\363\242\2572\264\374\037l\363\363"
+	.ascii	"\n\213\376\360\241\313\377\323\263\351\347L+\201\253\341q*(%"
+	.ascii	"\303\021\016\312\212\242\340\b\037\210k\222#\221\342\336\264"
+	.ascii	"\205\333@\320\202}\033\300\374/\370/l\020\203D\214\310nF\017"
+	.ascii	"[\223DfUL\220\207!\301\221\034\333\033a\247\005\316\263_\236"
+	.ascii	"\265\025\202\207S\"\013\356\246<~#\230N\372\231\260\350cX0\304"
+	.ascii	"\001-L6\275\0078h\352\253\266\255r\356\230t\240\210\346\210\307"
+	.ascii	"\260\0341s\203\243\206\231vl\b\366{\277\374Zv\327t\220f\262m"
+	.ascii	"8\305\007}\020w\020\266s\036\252\034\033\364\360ST\343\024\377"
+	.ascii	"M\306^\207Mf<ZD\241\017\362\241\210\352\3419\376\231S\301\031"
+	.ascii	"Ga\271\360\024\260I\177\200\020\240\211\201(\301\352\204T70\177"
+	.ascii	"]>5\322;\027C_\205\276\325\305D\246\035\f\322\211\213w\335=G"
+	.ascii	"\035\260\362|H\303\002\004\375\207q&\233\246\371y\234\246k\203"
+	.ascii	"P\273_\tr9\310>\0201\335\340\017`\333\207\344^Z\332\263^O S\211"
+	.ascii	"EV\201\017\034\324<\235\030\361\b\254\n}\373\334\346"
+	.string	"fp\320_\210\273\230\n\263\2132Z\002\203q\326\225\346\213NkO\"\321w\207\350\342Z\237\313>\273D\234\n\326\033\247\337\222f\224\352%\tt\r\231\020M`\201I\3718\356\271\277mx6Q\"u~\2251sZ\272\217o\203P\212\222$Vg\241\002\340\2001\246%\316\254\343hm\352\016N\367^\300\004\304\215\007~\020\213\235\032,\005\033\312\271zH\371\235\301gv(\206\001V\003\032\344\001\021\251\272\350\013\242\277\231\352\276P\241\016\347\024\252\200U\257\257\032D\364\225\021\017\032\016y\337r\264\"\260\302\177\237\232\221\220\207\235\0368Un\007P\250\\a\200\032\342\213\017\215\267\373\241m1\030\343\257~\373\037\3101\263\327\321$i\241[\2275\235\026\277:P\376,\226\n\216\313D\002\004w\034\325\323\203j\366\345\362\027@\263\312\343\373\202\352uZ\316^\324\n\343\334\tyF\276\337<L\277\030\251\013"
+	.string	"\251f`zU\342\033\350w5\232\377R\360\343\264j\270\270\350\230\210\377Sd\224\340\320\020\031\020\332xC\244\312\2647\312\375~G\030[\177H\023\367\240\036[\275\232$\247f\t1\356\0220\266\250\013\002\021\266\243:\306\020\251\236\264b \315\3474y\020aB\177T^\245\3460\313\350\255Dx?\376\001\242\200u5)\f\347\037\343\366\\D\237\275\341\260\237S\306\2416+\244\n-\343\201\220\002{}-\230-\374\262f\347,i\244\317\247\355\326^\006\365\357\254F\226%\0317B\222\206U5\370\033|\365\277\316\016\361AbQw\233\204\257|=\321\214P\264k\213=\346\276b\005\236\005%7\215\2662&j\200#\347\245\312\372\377\351\025"
+	.string	"\353\376\302\356\277*YG<\316\275>\342\3534\320]\230[\035w\3418\024\rL\3622\230r\224\372\250\033A\211x\233P7\244\247o\207<R\034\360\007)\037v\223L:\002\3720\240\352\225g\317\026_T\016R\370\240\320\356\223\231\343\310\275#\246l\347\336:\277\327k\005\270\355\202\243\270\034~\211\3724\355\266|\360'\236\005\333\205!h\262a\372\035s\306\246\222\215\304\213V\321\264\222\335\022\265\t\236\262%DW\375Z\217*\226\245\br\366\336rzV\035\007`\324\203\027h\261 \350\036\363\303i|h\222\336\253\217\302\246\025*\244)\303\211\312}'\020l1SA\212\006\r\305U\241_-#*\300I\237y\243\360\310=\226\217r<L\t\311J\004\240'z\006&\213\334r\301P\377"
+	.string	"L\330r\362y\237g\231I\244\247\\\036q\364Z\310Q\307Z\307`\300\362\227\307\364\353\025!1\332\257gJ\264\225+L\354\231\315\212\300\336s\243\212\215\006\021rH\371\336|N\222\363\217[</h\0263yu\025\035v\236\200\325\2708\254\222\315Y\1773C\234sR\013\004\330\004\005j\2210t|\244\371_\242#\330\363$z\212\016{\305\246!4\023\215&\n\t"
+	.string	"\224E\363\020X\020\374\310\211\206\177\2774\317\231@L\256n}G\220\2072\032\314\003\260@\260?\206\322l\313\304S\355\343\230\307\242*\234@?\224\367\245\r^!7"
+	.ascii	"Ut\316'\351\217W\244\272\250\341{g\3010\336\240\252X\035\354"
+	.ascii	"O|FG8\205\246{\204(~\220.\031\016\305\004d\013\207 \226\016\022"
+	.ascii	"b\331\3401Z\034,\336\207\223\312\353\021\331sC,[\322S@\037F\366"
+	.ascii	"\341\317\370~\325<7\344]\315\276\204\256\232\317I\247\025\252"
+	.ascii	"\243!f\340\227\013\2135\245\315\203\360\002$\327\340 S~&\211"
+	.ascii	"\177\373\2110\367\\\352L\"\264\302\020\342/>\017IS\375\360M\314"
+	.ascii	"\302\t\361\352m?!\212v\006Ru\375\202\375\324Q\002k\n\356\366"
+	.ascii	"\003\257\022`\355\240Sx=\021\f8\025H4\274\017z\246/\337\361\312"
+	.ascii	"\361\250\377z\325\323\275\321\231F\277\372\314\305\364p\337\360"
+	.ascii	"\016GM\376\0029\351\252\275\n\315\341\305\352\360\352\270n3 "
+	.ascii	"\022\344t\020UN\35105%\264\356\264.l\344\307\315\336\370%kS\377"
+	.ascii	"X\212\363\362S\250<\345e$;\263\013\t\206j\254q\232m\022Py\321"
+	.ascii	"\177\312\340V\217\343\240\310\250\277\247<\355\357\221\3275\246"
+	.ascii	"\271&\3344:0J\021\310\027\224[\275&\211\027\216\247c\223\203"
+	.ascii	"\224R\311#e\250\233\332*\307\3122\"\227\276\020A\027m]~\235:"
+	.ascii	"\343k\025kz\377\305\022d\344F\252\237%\270\222%@.\257P&\331!"
+	.ascii	"\200%C\215T\227\3348\002\fL\313\034\312\217\321P\306\313+\263"
+	.ascii	"\206CcV\242\355O\224V\nsvs\034\312\256\360%\357\337\262\217\270"
+	.ascii	"\004UBV\210l_\307\251\301\343{\273\030\224Y\312\356\252\013\353"
+	.ascii	"\267\024\374a.\005\317\256\235bA\225\306\326\300\201g-\377oG"
+	.ascii	"\374\370\313\234\375\215\331\346\314\375f|\b\215+*g\327\346a"
+	.ascii	"]\001\004y\304j\002?\300"
+	.string	"\337\273v\r\353\246\322Q\355%\235\217Lb8\341\r\024N\343HL\240$w\365\263\f\356\266\030|\035/\207;\300\214\345\234T\006\nH\212\236H\301\373\177eIR6_jK\257\025\327\n\035\327\251\313\3068\262\024<\260\211\".\375\267C7\035\344\020\356\245\362\320\234\362\362Ch\366\bdj&\301^C%\254\303\333\366\223\274'\3628U\225a\373\221k\317\360\344[\331R\351\005\377\327|[\222\013\337\327V\245\352\r\312\366\024\237rN\277\311\003\\p\205\201\352|\237\"\223a\342\342\342V\336\221I\r\222\344\267\313u\324\304\313ePN\371=Z\251,:J\256\364\025rA[\276\200\016\275\020\243Z\036\256~Q\222\364A\277\264/\026\246\325\231^N\354X\320\263\034\323(\003\344\220\001\f\257\rT\223<\305\353\263%\265\233|\2040\364\202\307\314\t\276\200o\3548\240\343\373&\330\376_\301@\034\327\202"
+	.ascii	"\005\002v\003\374\017\342\277\222"
+	.ascii	"\001\277[4\340k(m\230\2606h\236\370\3253gR\373\341\253!\251}"
+	.ascii	"\207\270;\264$\321\317\205\351\344f(\223\001c\0306\035N\2142"
+	.ascii	"\274\265\005\322\203\251`\3020\307^\360\006fI\363\304\002\306"
+	.ascii	"/e\21163\366w\206\027\335\363@Y\246-)"
+	.string	"\357\\9\340\212\242\362\b\203\221\033\226\312]\377B\021\216\301\204\347p\f\177 \344\344 7\316\367\257\363;\234:,<mg\244\223@\352Q\324\314Q\205\311\200\351\027\364P\307a\226\252Rx\257\361\224\r\324\311\377\242}\206\027\233?ZSE\026_\0351 \220\236\234\330p\200`\2125\307\215g\366$1\342R\255\005\027\363XsH\036\024\342rY\220'm,\262\342\264\017\\\033g\244,\360\301`\033A?]C\t\004D#\227\004\275@=\264\242\323\213\202\302\205`#\272\241Z\335\376\021\247\270\226{`\235t\345\006\250\274%\246>\r\355H\022c\3148\034\305)\310\331/\252\340\003D\233\204{M\277u\343\tkU/\207\002\360uS\300\344G\345\302\322\361\030r\221j\240}\313\234\364&*\006\f'\200Y\017\365\020\200;\033\361\224\223N\277=\225|%\247\3464\300\314\334\215\353\337\364#\232\235\267d"
+	.ascii	"\037\370\2377\235\037\361\341\277\\}\024\3475\020\214#\255sM"
+	.ascii	"\274\303\177\316\2443\234\372O\273\215S\367h\3714\205?y\313a"
+	.ascii	"]\t\353\327\342\305\003\374e\265\225\237\3007nO\273\242#\017"
+	.ascii	"\177$\\\032\360\033\"w\305?\036\034\254}\336\271\231\265\177"
+	.ascii	"*\335\007\342\020\204c7\035\260\374\255\370\326\254\364\251r"
+	.ascii	"X\244I\327\036\317\357\210\244\265@\301\363g\347\257\t\353\f"
+	.ascii	"\2110\212\372s\360*\340<\324$\252\031\022\3630\341\263\006\236"
+	.ascii	"\220\3535\3541(\373\243\312>\232\017\225\027/\367x\334=i\335"
+	.ascii	"<(\366\374\377\306\032_\233\223fj\020\310\211\270\177do\253\221"
+	.ascii	"\336\021\257t\351S\223\177\340[\270\372\234\317P\322\030\377"
+	.ascii	"\327\353\325\367\242\347mz\013\217\370u\206\347 \230\315\002"
+	.ascii	"\333p.)\325i\242\234\b\322\373\272/\345\017\023>yr\277\376\342"
+	.ascii	"\377\036\223\375\343\342#+s9\302+\020\376\357\336\302\323\362"
+	.ascii	"\n\316\017\bMg\365\003B\037\303\037\226Oo\232]i\361\206?\016"
+	.ascii	"\343a\210\303\312]\300\205\235\n\371[\304\333\302\363U_\n=O\202"
+	.ascii	"\215Y\355\342\270\025\311\233s}X\226B\321\247\355C=\207\216\243"
+	.ascii	"{Cq\350\305d\306\037\315\211\305\373\220\377N\265[\360O\377\235"
+	.ascii	"0\006wE\007\356\330hF\247\263\217\241\223\266\351\360\347\302"
+	.ascii	"c\334%\331\034\224,u\036\335\1771$\277\326\217\352\364\021\331"
+	.ascii	"\252.\261\325\272\002"
+	.text
+	.section	.gnu.lto_.symtab.93693f2592a244e9,"e",@progbits
+	.string	"addGPSCoordinates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\002"
+	.string	""
+	.string	"hottPrepareGPSResponse"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\002"
+	.string	""
+	.string	"hottPrepareEAMResponse"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\002"
+	.string	""
+	.string	"freeHoTTTelemetryPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\002"
+	.string	""
+	.string	"initHoTTTelemetry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"configureHoTTTelemetryPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\002"
+	.string	""
+	.string	"checkHoTTTelemetryState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\002"
+	.string	""
+	.string	"handleHoTTTelemetry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\002"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\003"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\003"
+	.string	""
+	.string	"telemetryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\002"
+	.string	""
+	.string	"telemetrySnapshot"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\003"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\003"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\003"
+	.string	""
+	.string	"serialSetMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\003"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\003"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\003"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\003"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\003"
+	.string	""
+	.string	"determinePortSharing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\003"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\003"
+	.string	""
+	.string	"telemetryDetermineEnabledState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.93693f2592a244e9,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
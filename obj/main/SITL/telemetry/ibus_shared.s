@@ -0,0 +1,213 @@
+	.file	"ibus_shared.c"
+	.section	.gnu.lto_.profile.1ed81717cac267c1,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.1ed81717cac267c1,"e",@progbits
+	.string	"(\265/\375 '\335"
+	.string	""
+	.string	"\230\033"
+	.string	"\002"
+	.string	"\257\366\357\244\b\006\002"
+	.string	"\001\240\342\234\212\n"
+	.string	"\002"
+	.ascii	"\271\2156\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.1ed81717cac267c1,"e",@progbits
+	.string	"(\265/\375 \031\205"
+	.string	""
+	.string	"@\r"
+	.string	"\001"
+	.string	"\002"
+	.string	"\003"
+	.string	"\002"
+	.ascii	" \223\r`\001"
+	.text
+	.section	.gnu.lto_.inline.1ed81717cac267c1,"e",@progbits
+	.string	"(\265/\375 \\u\002"
+	.string	"\344\003P"
+	.string	"\001"
+	.string	""
+	.string	"\025\373\233\254\225\002i\001"
+	.string	"\002\001\001\002\001\001\002\004\036\243\254\373\301\003h"
+	.string	""
+	.string	"\006\200\200\200\200\002d\002"
+	.string	"\002"
+	.string	"\004\311\256\364\302\002f"
+	.string	"\004"
+	.string	"\002c"
+	.string	"\f"
+	.string	"\001\004"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"/i\200\263_\312\342=\327\202\001\026"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1ed81717cac267c1,"e",@progbits
+	.string	"(\265/\375 \031\255"
+	.string	""
+	.string	"x\r"
+	.string	"\001"
+	.string	"\002\001\001\017\177\002"
+	.string	"\177\002\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.1ed81717cac267c1,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\205\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.1ed81717cac267c1,"e",@progbits
+	.string	"(\265/\375 $\325"
+	.string	""
+	.string	"\220\030"
+	.string	"\001"
+	.string	"\002\300\005\300\007"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	":\3427\200\005"
+	.text
+	.section	.gnu.lto_.lto.1ed81717cac267c1,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_isChecksumOkIa6b.25.1ed81717cac267c1,"e",@progbits
+	.string	"(\265/\375`\312\003E\033"
+	.string	"\206\363\260J\260\226Q:\261\311\355D\343\342&\206\0277\256\354NRw\206\206\265\021`f\335\331\360\205\245{\030h\027.\367\240\313\t\222\260\266\030\254\336*\215\177A\355\363g&\007\2461\251C\241%e\001\203GF\037b3\322\b!r\247\024\235"
+	.string	"\221"
+	.string	"\234"
+	.string	"\246m\221\376\334\361\326\252\0332\325\212\324\300\024(\265o\364\034\263\353 q\226Zw?\246Z\317\006\206P~\364y\026\371\261\274\013\371\021B\204\231i?\207|.\224\342\306#J\255gk\205hT<o\221\322^\242\310Q\\J\363\217~\240\367\353\005\225r&^\032\200\261\"\350(\033?A\224\024\025\350\206"
+	.ascii	"\255r7\221u$\006\223\037\331\350(\242z|f\254r=\242\004)OM\270"
+	.ascii	"\\\215\2125\200\276\007\2366\rkA\245\034\320)\252B\255\325\024"
+	.ascii	"En\305\235\272m\"\333\031\354E\n10)j\226I\375B\251]L\335\222"
+	.ascii	"\242fIQ\257"
+	.string	"\374w\253\\\307\277\372\371\003\020\251M\223ZE\251S%u\231\242F\231\324$\245\036U\324\342\227\356MQ\323\222\372\003\026\030$\244b\203g\365\031N\251F\306\246\242/\375\277\373J\377\371@\233>fO\372\222\377\3037\213}\207/\2740\322\031\325Z\315'\371>b\357\221\363j\373I\241\340\t\2370\2241\337g\363\243\337;R\354<t\n\360\234\365gBQ\022\243\005\037m\241\374\270Bo\317\354\342\222D\312;\b\271K\367GO\200\344W\013\372\204\265qy\016\340b\347\324\204\032w\340SCN\302\215\331\377x\031\305\251\b\335\341\360:$\314\342dVe\277\2447\344\004\225\342\022\317!\2772;\376l:\261\326Z\305\345=\207TY\001\373\246\"(6\035ka6fi\020\033\215\032\035\372eY\3733q\330\361\211|\022\344\307\227=\316\205\312\256\326e\017<\202'\303^\320w\243\266IBzrk"
+	.string	"\373}\013\034\303\233\220\207\016\355\263F\227g_\302\220\224'\357\316.\251e\004\0045\277\321\211\205p\275h\\%\215\f\204\210\227\r){\205p\315hP\331\345\340\303\0136C\023\353\020\323\361P\323\332\201\311^7/\233\227\254%\242f\346\246\345\202\305Z\016\016\030g\304\013\326\222\341\340\300Z\346\311\363\335\231\242\026\234\222\fn\266l\001\236\255\331\334\226=Y.O|\020\374\311@\355\316,\273R>Q-\313\232\332\250\312]m\252U\373\365\202\276\357\256\254\351-\250F\207wa\321\023\205\\\236\017\374\006\236\360\006D\224\331rq\026E\230]\324\322%\360\302IO\t\271(\331NID\212\273\332qo\273A\333E\250A \205\fc\304(\"(\025UU\320\244\0030\002b\024\333s\021\02023SX\3318!\251R\374\035RmnZ\026\362\232S\332\203\3221wy"
+	.ascii	">&\275C#\317\212J\b\302K\377\320zv\252\213\250\302\224\340\305"
+	.ascii	"`\274*`\223\225\3532\241K\250\334g\325N\364\320\016\365\261\206"
+	.ascii	"e\226\026\005.\27526V\235`\333>Y\311A\326\354P \361\347Ks\275"
+	.ascii	"i\223\351)v\345\005\240\350Yo\321W\355`\016Gp\216\351\001\374"
+	.ascii	"}z\307\007$\b\353\305\201\236lE.\364\340\204\335x1\212\n"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1ed81717cac267c1,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\031\177\002\360\372\2508\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\013\003\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.1ed81717cac267c1,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.1ed81717cac267c1,"e",@progbits
+	.string	"(\265/\375`6\004\r "
+	.string	"\n@\324\rG\220\234M:"
+	.string	"\005\360\327\275\273\267\020,\001\b\2444<\006H{\n%$\273\033V^\326\341\037&~\260\266\243o\2340\035\246\t\351\244\254\335\311\327&\026\314\023"
+	.string	"\235\022A\0070w\337\267\210\354Ht\204\210\021Kd\n\263"
+	.string	"\300"
+	.string	"\313"
+	.string	"\217\372u{\340\177\335\177"
+	.string	"\347T\375q\370\230VQQ\277\024\202\250O\351\2628\375a\026\232-\324L\251|BY\242\244V\177\252\272\265z\330\357$S\335\223C\375_6\244\025ZcM(\332{e\257\222]\262Pb&\224\357Y\177\235\305`0i\203%\024\227\3116\331\312`\237\270\002\006\307tP\352\222\277\022\340\2311c\210/\024\035Dz\235\330\300\357\030\034\222^\006\343\006\227\301\350\272\007Fr\r\214\266\027\330.`\033\202m\022\266\277l\203\331\366\262-\242\212m\036{u\330\356b\373\212\355'\266\241\330\026mw\331\016\203\301`\320\266\b\333t\354\030Wu\222\324\221\023\212.A\206\366\370\335\371\237\206\254\376\344\361\214\366ze\273@\366\200\215\255\203\337vl"
+	.ascii	"\220\037*\254\rY\004\313.G\370s\031\360d\272\373\353\017\355"
+	.ascii	"\375n\314\314\364\241\351\265C\317\377t3\363GIs\367\247\276\243"
+	.ascii	"fzT@\372\323\275\376td=\372\336w\276\231\331\373\241f\372C\327"
+	.ascii	"L\177\276\267;\013\230\367\241O\177j\326\254\277\323L}\350\314"
+	.ascii	"\304j\203ba\265\261\261_f\3572\242\246v\247\017\320\254\276\207"
+	.ascii	"\375\233\345\364\323\301?\345;\303v7v\213\007\224\301\323\332"
+	.ascii	"\371\266\376O\020\305\243\362\275\0074\215\370~#\274\244G]\320"
+	.ascii	"U\340\203,P\347c\352PN\277\202\327\007]pH\277Xw\215^0r\275\354"
+	.ascii	"\227\255\021\026\214\267k\275,\333\325\327p\b\235)W\241\350\263"
+	.ascii	"\007\306\320\213\364F\030c\301\340F\330\362\326\335\332."
+	.string	"b\257\036\035\261\204\304x\023\347\247\027\t\263* \222P\334-\313e+\320ry\263\254\026\357\364\352\323\2353ltd\205\242\227\b\351\005\032\t\004\203\301\340\002\215?{`\024\367Gz\323\305\362F\331\272Q\366\212\227\367\357\330\362\240G\360\211+\316\245\244\200xx\240c\254\246x\257\330\0250\254\026\317\277`\247\352\310\227S(\256V\270U\326\212Wk\251\360\364\276Z\342\277\333m\320\263\333@\306U\265\273\032E/\221\233\265W;SB\326\320\tE\273Y)\266wdTo\322|@\271\243\322\205\022n,sHKM\265%\244\332,w4$\344\244 \017\":\204\240\345J\0247\244\237\334Q\005\013d\212\232m\311\250\274\331\214\230\312\034\256E\b\002~`\333\212\362F\313\331l7\232\200%\233M\303\221\314\304\020R\207\024 \230\232p)je\222\021N\311\3075\245[\251\242DA\372\302\320\204!\"\026"
+	.string	"LTD\241\210\302h\242\"!\241\242!!\322CB\261\334\021QN\205R\023"
+	.ascii	"g\310`\3643\342\303\006\262\026t\242\274!%\341\216pM&\224h-n"
+	.ascii	"\271\222\251\\*s4\025JHL\264\332\rG\013r`1b\026\214\203\356\327"
+	.ascii	"\325\317\b\360C\316\323\2348\227:\201\3545\343\005\013\323\303"
+	.ascii	"\005GW\214P\3342=V<\256*211Tex\241\270c\026\270\325]\373\345"
+	.ascii	"\361\224\252\317\352\321\3624%6 P\0021\246\252\366\224\223jv"
+	.ascii	"\307\225!`\254\035h\005\377\237\2132#\245\231kb\246\357\204\032"
+	.ascii	"V\263R^ \242d;\264\203c\004\205\353\026\251\375|M\f\237\261\013"
+	.ascii	"\322n\266\245\235\261nT\353\272 $4\213\270\036\024\356\017\022"
+	.ascii	"\270 \260\247\250\376E\353\031\240L<\f$\n\016\340\210\202t\030"
+	.ascii	"|\002\003F\360\334\024\b\256\236j[\241\365!\273\002\263\263\004"
+	.ascii	"\313\215\326N\256v\250E\213\256\225\203\002F\223P\227a("
+	.text
+	.section	.gnu.lto_.symtab.1ed81717cac267c1,"e",@progbits
+	.string	"isChecksumOkIa6b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316"
+	.string	""
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1ed81717cac267c1,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1053 @@
+	.file	"ltm.c"
+	.section	.gnu.lto_.profile.62932cfd9c98698f,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.62932cfd9c98698f,"e",@progbits
+	.string	"(\265/\375`#\001]\t"
+	.string	"\022\31516Po\322\030"
+	.string	"\177/t\035\305\017\357\215\356\301sa\242\\Y\343\275\362x\315\326n\274\231\231\231Y\354\314\314&]px{\034\306\210\021\265\2667\331d\223M\222\224\001*; \024\307\260\240\220\200"
+	.string	"\207\031)\"e:\200\303\271vvf\314\372\\\263y\352"
+	.string	"\361\340\024lr96\366\223-#Oi\203q\274\244|\020\334 a\"\032\320\300\341P\236LTt\002\303n\003%\024"
+	.string	"`\205\210\234R\332\276\3251\036\337fw\341\341\346\276\357:\276\257\365j\270\201\366\201\310\260\220\373Z\2775\030\213\nF\351\332\267\372e&d*\021Y\2336\362!\351\236\256\230\367@\341B\252\226\035\020\212\333]\327\243\303\212\306H9\372&+ @\002\305\330\235\003\020\361]j\354I\by\203}\240\270\035\3469\314\\\365\265M\302T.`|p\020\360\314}\\\241}a6\272\327L\260\017\347t\200r\203\337\206\360\202\0368\214\221]\300\31603\036`\300\202\242\fl\353\344\005\236\346;\030\204"
+	.ascii	"\367\002\347\007\365\002\0361\3715\322\376\305\035\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.62932cfd9c98698f,"e",@progbits
+	.string	"(\265/\375 \317\365\002"
+	.string	"d\002\303"
+	.string	"\017"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\001\002"
+	.string	"\001"
+	.string	"\001\003"
+	.string	"\004\005\007\n"
+	.string	"\013\021\022"
+	.string	"\001\025\026\027"
+	.string	"\032\035"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\030"
+	.ascii	",\0014\343\252\002C\346\030\212\211\025#\026{\220\3610\r\300"
+	.ascii	"\003.\032A\t\026r\200\004\013\271\034\205V\301\021\305\205M\357"
+	.ascii	"p\036k\211w9[\323\236\r`\001"
+	.text
+	.section	.gnu.lto_.inline.62932cfd9c98698f,"e",@progbits
+	.string	"(\265/\375`K\003m\f"
+	.ascii	"\022\317460\217\222\016 \376\333\224\3576\277\230\226\207\316"
+	.ascii	"\207\261%G\036\220]>\"\360\232\343\203AU\201\327\223\001\t\214"
+	.ascii	"\030\360D\252\360/j\237\3729"
+	.string	"\205/\332\367\215l\222\002\233>(\"\313\301\206\322\360\bM0\2140b~Ov\261\002\261\b\211\240\204T\200\006\275;\340\312\353\251\006Z\372cr\331R+l\201\314\350m)\225\216lM\364H\371\322b\231`{2)y\006\307F\242\315y\367;9\265\f\257e\245\035\265\346\335\245\204\210\230\330P\030i\261J\022\316\270\177\240\227\266\006c\357~M\346\022m?\003\f\343\350mJ\005\332C\236\332\"|\r\343uC\222\262\036\214\266\332\357a\034\306\315\313S\204\371Q\266m\226\177'\335n\347\220\252\266\235\347|-\004P\250QIidf\306\305\372\006\200\"\232\272\342\001\022@C=\003\361\214q\b9\203\230`\206\322li\355\006\"\b\370\262\244\256vP\330?\034\220\212\241;\204\330\222j2\250\037\377\363Q\313C\001%\213i\345\212\342\321\344\032\265\177\242G\313\007\212s\274&\210/?H\302O\303$\270"
+	.string	"@Y\tK\272+\"\271\026\373\353&\326~\272^\t\032o\3224\2348\261|\340\224\215\265\222K\220\265P{g\017}\253\316"
+	.ascii	"2#\223VA\223\331H\320\341\312\033\272\341\007F\205\355\314\030"
+	.ascii	"\245\021\034\352\250\264\357\3062!\243xd\222\f\201\206vg\036"
+	.ascii	"\001\bq\312\345\274\2254\237"
+	.text
+	.section	.gnu.lto_.jmpfuncs.62932cfd9c98698f,"e",@progbits
+	.string	"(\265/\375`m\003\275\t"
+	.ascii	"\222\212!(\200\031&\035\230\ty\212\034\346\255\327\223\310\210"
+	.ascii	"\314X\235\004,\340M4\225\013\203W\202"
+	.string	"\255\305\3056^\234\025\033I\223I\006$Y\3277\307\233\366\206\223\350\016W2\022\220\bW\334\"\310\017\327\003\003\222\005\244B2!\017J\322\305M\270\013\023w\206\201e\201\240\336^7\305\375&\020EGk\034\342Z*\334_\307\327\365U\300\363\030\255]\002(\211\3010\234\246iq\345mV\345p\345L*\244\314x\036T\021\001R\250qYFD\013*\031\346\220\302\272\262\016\022\340\361\201\b\342!d\f6\210\0053\361\314\244\345\226\016e\313\265\007r\013\250\020\371i2\230cK\242m\326~G\220#C\300c\366fP\346\206P\260\223\271Y\364\017\260\370\257\335\035\241lf\342#\332\352\r\016\3060\271\314%\242\274\007\370\277\301\023\327qo\334\251Pw\202\210\243\251>8\347\224 \311\275\001\252\273(8\343\344\347\b\355H\307\206\354\374\004\202\314\333bAr\"$\250\306\024\tY\373\221\323\252\254K\004X"
+	.ascii	"\332\265\211\260\234\213\315\322\330\326jBF\336\237\303\357\372"
+	.ascii	"\251\nj\017"
+	.text
+	.section	.gnu.lto_.pureconst.62932cfd9c98698f,"e",@progbits
+	.string	"(\265/\375 2\221\001"
+	.string	"."
+	.string	""
+	.string	""
+	.string	"\017"
+	.ascii	"\230\004\003\230\004\004\230\004\005\230\004\007\230\004\n\231"
+	.ascii	"\004\013\230\004\017\230\004\021\230\004\022\230\004\025\230"
+	.ascii	"\004\026\230\004\027\230\004\032\231\004\035\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.62932cfd9c98698f,"e",@progbits
+	.string	"(\265/\375`\020"
+	.string	"\205\003"
+	.string	"D\003\004\001"
+	.string	"\t"
+	.string	"\001\002\026\001"
+	.string	"\005\021\022\002\002\027"
+	.string	"\001\002\027\025"
+	.string	""
+	.string	"\026\027"
+	.string	""
+	.string	"\002\002\013"
+	.string	"\001\002\013\001"
+	.string	"\002\030"
+	.string	"\001\002\030\032\003\031\001"
+	.string	"\002\032\035\004"
+	.string	"\031"
+	.string	"])\254\354A\023\017\006\306ASz`\261=\250\267\263\004\342\216B,\b\356Ucfj(jnV\241\266\"\256\2460\216\265\237\307:\317h\032\353img\016\330V"
+	.ascii	"7"
+	.text
+	.section	.gnu.lto_.lto.62932cfd9c98698f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_ltm_initialise_packet.114.62932cfd9c98698f,"e",@progbits
+	.string	"(\265/\375`\276"
+	.string	"u\n"
+	.string	"\326SG>0\251\270p\324\027\357\025_\364\3551\220v\307:8b\207\340\352I\346\020z\230%\3248T"
+	.string	"\264\267\267)`?\325\352\243\205<NXa\214\026B`\254\337\242\351/\023~\027\233\b\2212\2454"
+	.string	"2"
+	.string	"7"
+	.string	"!\353\256\b\203\003\273#\204\037\026\2169\264!|4\331\312\b\2124@\302\356nZ\362\360\031\372O\271&\226D\317\n\305\356:\305\022\310\255\267\335`;\302\276&*T\204Q\266\354Q\224Jb\377\332\335\265\236\354\247~M\323W\246U\323\251\351_2\226\003\214\201\335\217\026kWX\002\024\333\277\330\316\264%&\302\247\002\244\nV\220\004R\337 \304dI\207{Av\265;//\232\301CE\366\003\\"
+	.string	"h\303\343\311\216]-T\023L\017e>\200\217!\377\304\034\237\274x\314\377d\307\024A\030\034M\007v2o2\035\330\331@\037\310u\\\207\003\267\f\316E\267m>\317\226\301\330\323\340\276\r\364\274o\273\214\373k\365TAa5\322\016[R\365*p\251f\322T\025\363 \022"
+	.ascii	"3\241\307(\260\016\275\022x\367+&/\226W5\b\002\006<A\225\013"
+	.ascii	"^0\007,F*\221\217j/]0T\251q\340\316-\332\371\004"
+	.text
+	.section	.gnu.lto_ltm_serialise_16.116.62932cfd9c98698f,"e",@progbits
+	.string	"(\265/\375`\217\001\375\r"
+	.string	"\326\232[A q\223\016%5\346\216\240E\232\317\347`z\250,v(\246\223\277\021G\246\202'\276\034\314.\326\236M|\337\030\326\234,\037i`\240 H\00105Be\203p0x\020\333\273\021i{o)S\nG"
+	.string	"C"
+	.string	"L"
+	.string	"\031mg\332?q\024\240\237P\360\333\345\200\222\262\273y\270\243\372\003p\002\360/?"
+	.ascii	"\376\031d\327\370\026b/\035^\214T\334\330\335KA\034\364\004\371"
+	.ascii	"'\335\322JH\236\227\005\273\353\324J0\334z\333\bl'\260SAnw\327"
+	.ascii	"\352\301vi\215Kg`:\2724\306\245-\230\256~\362\303L?\227v/\255"
+	.ascii	"\231N\227\276\200\013"
+	.string	"\t\032\006R\273\027R9v\345\305\030a\373\246\267\314x\212\227>\337\314\240\305\304\356\306?\373c\307\277\032uq\315FF\257\032\375(\203\350,\336b\203\201\200\300\277\214*\f\026\0341S\243\372%\bY^\363\201\nJb\177\305O#\276\bsD\362\232\b\374\213\372\322\003\260l\320pM\365\200zm`r\032\241B\231\2627Q\352\007\373\001\023\356\315G\346\t\271>\035\017\226a!\230\347\212\360\300Avm:#\327G\001s$`\235\313\303\341t\256\270\205Nzu*\261\022R\2211*\226:\305\310\260\236V\352\233R*\275\351\251:\375\bU\335*\020\252\352I\3570A\261\200\022e\312\001# \260\002!\262\352\"\340\r\217IXR\303_\f\371\243\205\361G<8?\216\345\026\035K\215\363u\013\343\353\222\031\036\375\340\242<n\250\326\264-\316'\332n?\"\333\357-\r\022o\345\307\bb\310H\223"
+	.ascii	"\265F|Z\001K^\\\220\f"
+	.text
+	.section	.gnu.lto_ltm_serialise_32.117.62932cfd9c98698f,"e",@progbits
+	.string	"(\265/\375`u\003\235\023"
+	.string	"\006$yF\340\320(\035\353\007\276\231\321\265Y\244o]\022\271\030\273\204/\004\212\301\027\364+1D\"6\206\347u\177\374\364(\030[\346\264\321C\361\220S\f3\020\302\030\255\367\201Z\244\030\370h7^\273&\3547\262I\222)\005e"
+	.string	"Y"
+	.string	"g"
+	.ascii	">\037v\202rj\314\340\230(\310#|\363b\\\017\020\201\2101~\206"
+	.ascii	"\355K\373\031v_[g\353\020\0261s\rLK1^\340\351\211\021\207R\002"
+	.ascii	"$\303\023\253<\303\316)\317\260\263V\206q\034\342\b\303\n\033"
+	.ascii	"\211\0331\306\3267x\346\234\325\266q\351&\023\343\034\031\210"
+	.ascii	"16o2\023\334\273m\200\266\005\332\216\025\266\"Z\346Z\\-\257"
+	.ascii	"\241u\027\237\241}\326\344Y\226\227-\201Y\222gW\317\216xY\221"
+	.ascii	"gU\317\206x\331\024\314\202<\213z\366\344e?`\326\3035\266\251"
+	.ascii	"\313~\317v\300l\251\313\222\236\035\301\254\327e\341\263\035"
+	.ascii	"\314\276\313\346\263\0260\372\031\002@\024\243\204\\\216(\004"
+	.ascii	"\003 \207\037\340\375 \177w\024[\021\311\005\362L\1777\203"
+	.string	"&\027\241\310\344>\276\321`\3357\271m\024j\346q\217\212ke\3053d\375'\\\340\3702_\362\372f\301+}\353\t\204\307\264.a\023.u\207\302Z\322\267\026\317\260\344\2761\312E\205\031Z\346n\033\333\203s\206\361L'y\3236S\313\\M\367\021\320\330\b\016\\\225\224\227\214\245\365 &s\275\\,.Y\213\201\202\004\257\226J\314\245\225\302*\254\201+\326\222\301`\261\326\207\243\331\306$\035 !\332kE\3058\275\343(\030\247\357\037\257w^|\334;\337m+*\275cU\342Q\265\b\371\350\252\241\020\322S\257sX\244\356\034\217\223~\354\335\303\373\350\344Y\320Y\251\030y\367U\212\021x\221\3278(Dn\234I\250qX\245\22435a\224QRP\255\001\020\003\021)u\003\021 \245T\210\241`\023\363\002;\017'\001\257\336\336\367\326\004c\271\332\037\006\311\370\036&\226\227rH\264\006\302"
+	.ascii	",\3560\263!\007\017Gn\243\241\244\003$\034\n\360<&\321'\331|"
+	.ascii	"=&\366\374\361nc\021\355\311x\245*i\214D\004Hv\212\365 eN\266"
+	.ascii	"\371\337\007\201\260\\'\324Q\037Q\340\211P\267\257J\216r\357"
+	.ascii	"N*\335\r\350\023\261\206\n\360~ax*"
+	.text
+	.section	.gnu.lto_ltm_gframe.119.62932cfd9c98698f,"e",@progbits
+	.string	"(\265/\375`]\005\345\036"
+	.string	"\366\267\277G\240\230J:\301{Ab\373\366r\365\234B\306\231\262\036\372\247\023\177r\261\256)\200\021S\341\016\030\242\264\005 \366~B\013\234\241\0047\307\035\343\301\345\353`f,\210{\001\262\245\277`p\250\2416Z#d\023)S\n\244"
+	.string	"\235"
+	.string	"\262"
+	.string	"\242:\234\352\r\325\032\252OD\343DM\027\246,U\234)S\246M%6\036\366\333\367\203\274L\252\211\224M\246hZ\377\361\240\235\363\210\217y\302\331\327\247=\302\316}\356\305\234\363\201\004\344\303\246vT9eo\315\304\215\262\f\016\370t\321\355\323\244\255\345A\257r\3442\343+\023S\226%oe\234\374(\316p\225\364\251>\276\354\272E\346\007dq1\353\263\304\225\2069\240U\270+\313\362\006x\245\033\026mAY\221\003\366\302\0365.,\027\273\246"
+	.string	"\372TG\005eYZ\177@\254\373v\333$l\033\331\323E\273\023\313\310\275\306pI\022n\327\220\253]\341GB\350l\0137r\341\207JY\226FD^$\311\257\361i\fJ\372\237\222\370\251;v\021\0026V\245g\324\354\213\332\213\335.?\204\370\315"
+	.string	"\304\212\225\216\261\215\356\276A\264\2318\350\177\337\213\375(~,\322\254\226\312\016\366t\273\354\207\345\306\260\247zh\252\205p\352\240\251\336M\265\016\247\006\302\251\177D\265\317T\367<\354\346\021\325;S\255#\252sD5\316T\337\214j\033Q]#\252sSMsS\343n\352\333\250\036E\2658\252gC{_V\357T^ej\006I\203\206\370)\264k\266\306F\244\271\rZ?H\332 q\224\370\224\2575\3715L\346 u\350\177\244\016\3613h\037\274\316Z\013-\232\315\341\226f\357k\253\232r\001\342mq\253Y\256z\364x\\\215\004KC\272\335\026\007\343\fl\024w$}<\n\224'\"\333X\220\316\265\311\037\013v\341\316%\340k\263\031\274I\003\235\227\035\234\311\203\317%H>\341\216R\220"
+	.ascii	"P\013\271\321D\033B\004\375\317J\304\207\270]>\023\373\362\232"
+	.ascii	"\033\303\341\217\304]\020@\242H\270\331\321\255,\255\214|$O\202"
+	.ascii	"t+\313\322\300)\210\237\001KORQI\"\2304$}x\332Pc\245\002MQ\035"
+	.ascii	"xRPQKMK\035\226\242x\036\23004\361\224\240>\360\n\004\260\323"
+	.ascii	"\323\022\024/\312\311\t\212\227\013V]A\325\366\306\355\362\321"
+	.ascii	"\216\271\237\022\217\262B\375\224x\261\343\276\314\332\366\237"
+	.ascii	"\022y\366\204M\244>\373\263~\231\231\237\305i\371\354\313^\264"
+	.ascii	"\025\306\327\266#\243[\235\335\261\351v\026h}20@{2\235\335\351"
+	.ascii	"Y\236\325\351)\363\255\310\331\236\265*\316\346l\210vU\246\247"
+	.ascii	"g|\2638^\216\272\334\354\210\205fS\2636/\276\205\344B\340Ev]"
+	.ascii	"\013)C@\226$\327\354\305N\240\352\214mlh\257\374\327Ehi6d\250"
+	.ascii	"Q0d\025#\204\210F\244II!\215\001\200\002\031\"\253n\021@\251"
+	.ascii	"cL\321P\330b\326b\244\264\032^Ax7\205S\004o\212\013\354\247\214"
+	.ascii	"\240D\252`*\007^\342\020\273\360g\nT%Z\025d@\203\334\277\271"
+	.ascii	";\004\310b\262/c@\256\337A\373\374i\026cd\025f1/?x\207\346T^"
+	.ascii	"\t\275\352\356\035\f\364\246\004\232\253\303A\216\231\366\232"
+	.ascii	"\214\263\2416\2228\307\317\310\311\214?qy\343\206\032\264g\352"
+	.ascii	"F!\210=\320B\336>\016@\342\032n\246\033\242\241\t\205\247\300"
+	.ascii	"\351\310\355\260\234\216\bO\351\352%\306{\325\346wi\376\270\225"
+	.ascii	"^\344\027.\351Z!\177?'\202Y\315\017\022\356\023\343c\223\036"
+	.ascii	"q\226\275\323:NC\202\317\232\214\234\344dS\250\230\243\307a5"
+	.text
+	.section	.gnu.lto_ltm_sframe.120.62932cfd9c98698f,"e",@progbits
+	.string	"(\265/\375`\376\006u$"
+	.string	"\032B\370\rD\220^M:y^\316\n\3242\002 X\217\222\316\364R\2248\321\244.U5\352\300rN\376\377o[\227R\007TX\0374\307\003\300\0011P<\221JV\344\202\270@\205\243\202\"\242\315\3106B\b!R\246\024\304"
+	.string	"\302"
+	.string	"\317"
+	.string	"\236\215j\331\250&A\3658\252EP\035\202jPTo\250VP}\t@:\316<03\347\2151?3,\364\202\344\\\177\327\325\276_\345Vd\334\347\005\353\311\260\247\214\001\323\261\336\241\374\313.=\343>\207\370\225\017\355\031v\371\020\374\223{\271\354\312b\201|\350\t\024v\347\322\031I\005M\2525Z\222\314\351s\360\320K\344C\357l9\367m\315Q\353\nO\312\2369\247m\213|wZ9\223\221\243\030\202\253;\177\274 \273\312!u\032\220\227@~\350\354h\210\016\037\227\365 \321\340\350\215<\321*\244\001V-P\016*\320h\316y\257\037)\301\341Cu\2740\347\264^\345\320q\327n\233\215m\r\266X%a.Fwkj\022\037\352\326\206\350\021\233\255\226l\211\0300\242\006\3109'Y\200\207\220\027\b\232s\216\004\304H\002\342"
+	.string	":\366\r\260o\316\031\016\035\353\215\321\320\301\325\332r\001\032\004+M\220"
+	.string	"\235sJ\355j\371I\242\320\336\353$\232(p\252\224\217u>I\374\n\255\225\327\243:\226gq\362\217\330\005N\177\205\023\037~\307!m\232\364\246t\314\366Q\351j\331\007\347\022\261C\365R\250V\"\325\rHuR\250f\020\252\027\204j\005\244:\001\251F\032\325GED\243\372"
+	.string	"\2506"
+	.string	"\252\013\200j\002\240z"
+	.string	"\250\036\002\325\002@\265\320\271\356"
+	.ascii	"\357\272\203F5\200P\r4\252k\243\232\026\252\313Q\003w\2400d\320"
+	.ascii	"_e\020\0376\330\177}\310\306V\326\223\336g{`\266\345j\034\336"
+	.ascii	"ojL\266\263\r\327X9\371\217\\\331~\\R\316\206qe^~b=\004\352\340"
+	.ascii	"\345\2360\004*\256\315\241\203Q\270\342\236\367\233Rs'\021"
+	.string	"\334p!X)\261\207\277q\262\331\037\356\006D\222\2339g\205\207>\233\267\021\341\037y\350\021$H\210\017\301-\353\374\021\353\022R\177\271\301\210v\t&\375\225\025\013\236\260\252\225\242\351\213D\242-Z\023H\270\360v\224\253e\2460\262\2179\323\022r\257\023\231\260F\315#\222aBp\t(\273N,\201\265\265\353\304s\221\371\251\257\023\203\266F\fq7\205\332(T\350\257viX\350\204Q\255\224\177\235\250K\264\n&\267\025P\270\\\213&\247'\026'rO\265\333\n(\334-\207\"\027\343D\356\211f\025\021p\271'\233\214\250\334\rw{\272\345l/\234P\340l*\242b\330\"\020\031\n\306-\312\226\203\202\212\262\225\276\251\203s\211\370L\314d\225E\373\2552\277\031\321\006\330\032^\327@\007\207\330\234\251\2452\222\036-\322\372V\324\nie\275\243\275\225/e\351\341\375\026h\225\202\005\332\005:\245"
+	.string	"\300&X\177\312X\202\375\224\337\306VV\220\036\320\002X\b\f6\300\002\r\201\341\355\250-\203\265\362~J\333\332\336\312O\320\322\224\276\306\242\264\241\362s\360\244\365\301\372$\355\301\256]\3264\351-\255\330\257\352(m\271K{\036\226\036\335\256I\223\322n\2275Hz`\033\254\377\265{\262\363\242\261R\366\355<\200\222\250AT%\221242\"IA\222\fk\320\002\021*\3426\021@%vjL\242BkU\245\006\2749\037Mc\307?\017\0066\206\bCU\337\341\327\327\220A\2521\370\260'\002\216\035c\237\321Fpmv\021\260&\337\202T\323+\341\314\302\304\222\306\266\366d\266k\306O\210\254\275\361t\211Y\361?\024O.\216\215\327\245\201\300\326A\245\n\3404\241G\335\026\002"
+	.string	"\320rEB\034\007zB\003\342v\364\234\377\217\362\315l\023\342\217|ri6}\367uZR\032M\344\315\374qF&\346\221\350\004\201$\301K6KAs\274R\233vs\240h,\211n\032\366\2764\006\211\004U-h\036[\314ZX\222\336W\235s\263\025"
+	.ascii	"\233\355\236\322\277\234^\n\351\364\206\310L\020\3430 \213Y\315"
+	.ascii	"R\2133N\321\251z7\234\347\312Z\237\340\241\006\024@\252\212@"
+	.ascii	"\203\f\367g\360.\311q\002\313f4\370\226\311c#3%a\270\255[j"
+	.text
+	.section	.gnu.lto_ltm_aframe.121.62932cfd9c98698f,"e",@progbits
+	.string	"(\265/\375`\025\002\345\017"
+	.string	"\366\\eF"
+	.string	"\223\223\016\033\017e\353\225\214\365\377&\253\370F\253j\301\b\035\331\243\221h\240\350\223\001\002P\327c\213\026V\274\317\2612p\237\366m\333\330JB2\232\311\020\t\320\016\032\257G=\313\251\316\210\021K\366&R\246\024M"
+	.string	"G"
+	.string	"Z"
+	.string	"\253jU\365\005"
+	.string	"\250\341\301"
+	.string	"gNVL\310\204E\035\024\266\357\333<dy\215M^\334\243\315bs\217\347\254\262}\334\325\232Z\f\313\345&\310\234\263\333\230\253\256*\3774\337\300\227\226\253\346`\316i\005_F\334{\333\006l\037\260\325&\321()z\360\321O\221\217\337\320\2273\023\2564\346M\315\342\276!\355\223\007=h}\245\200\201\330\026\333\365\351\236\260\237\3155aK5)S\217\242Z\224\251A\253\346T\375Q\365\226\251=\253\326T-U\0353u\266\352*J\220\200\001q\013\372,\267\355\247\302m\350\324\240\261m\350{\315x\264\365\310\325\216\363\270\322\34493d\304\210;a"
+	.ascii	"\315\326\266pAd7\323\335\275\313\220\317\007\310\257n\002\021"
+	.ascii	"+>\215\331\306p\030\031\032\264l\r\2779Q\320\243\364\027\036"
+	.ascii	"\202\326\234sA\213\273\330\340\313<.\215\230R*\335\007T\3123"
+	.ascii	"y*^\252\343\200rb\352J\250\225n\204\200O\035<T\227:\235P\035"
+	.ascii	"\347Z\235\346\020\200\300v~\254\366s\001\035-i\375\360A\004="
+	.ascii	"h\221\020\327\361\035+\022HH\344#i7\030\321\216|\034\3171\301"
+	.ascii	"\2271\205\022=X\"\037E\373\360g\005- \260\002)\032\262\r2 \017"
+	.ascii	"\177\220\260\254\221p\343\207\366\200[\223/k\007 R\315&T\006"
+	.ascii	"\241\034\3378\216p\210\317\203=\304\262\352^\237rxo\314\276\""
+	.ascii	"\234\361}\260\036\362Sn\001\214?\313\211,ct9\357wO\333\336\313"
+	.ascii	"\361\006\346/j\373\202\0269\233\231\035\340\006\235\215\2767"
+	.ascii	"\001vn!\300'"
+	.text
+	.section	.gnu.lto_ltm_oframe.122.62932cfd9c98698f,"e",@progbits
+	.string	"(\265/\375`\215\002-\022"
+	.string	"v\340pG\340\262(\035\341-\364{\350\302hQ\230-\331M\262\r5\273hC\231\353|R\2140\026\227\3466\361\364\217\033\030\002;a,\244}\305a\020\004\205\202\225s0%l\356\n@\031%v\373\366\277\375\353\371{\023)S\n["
+	.string	"S"
+	.string	"c"
+	.ascii	"\272\352\0070\301\330P\320cN\016\273\037\223'\342@\330\276_\342"
+	.ascii	"9,?6\026;\\\237\031\2779N\313I\370\201\217\2109\247\350\321n"
+	.ascii	"\261E\217+\262\314\316\361pf\202dj@\023>\346\234\337\312\\v\225"
+	.ascii	"\371\267y\250\366\342r\005-\230sZk/\035\356"
+	.string	"\275\355\002\266\r\330\213 s\316\004\376\211\243\240\340\323<\032%E_K\221\217_P\217N\0167\323\235C\352\0267\fi\277.\350kV\026;<\031\326\305\016i\272\037\354{sc\354\250^E\265J\252SQ\215\212\352ST\233\244\272$\325\244U\217V-\243:zjo\325\353\251\0036W\035\267\230\333\215m\2654^\343\361\223H\325\256\366 \f\3551.\203\304AI\211|T\355\272\370\311\201h\310S\353\343@\210\240\341\270\277X\361i,\301\304D>\246\3668\377\206\231\233\007\233?A\226t<'\365v=\221\257P\261\013\352\2511\002wR]\373\204E\340\253+\002\352f\272\013y\212\026\200f\215\270b*\037\006X\254\345j\251\264b_\005\224\023\327\307\202\255|#\002\374\262\320\202}\261\327\013\366\211\302\331\275\2711\266\315\031\344B\344v\314\226f\020\035-i\375\034\034\244\r\331F\373\234\037\270\365"
+	.ascii	"u'\037\323\236n\230\344\226\326\017wJ\373\020\265\3625\240n\200"
+	.ascii	"\214\213Z+h\243\351\316:\r\342>9 \220\002\0212k\007bB\347LA\274"
+	.ascii	"*\340\272;('\323 q\274XG\267\240\307\360 (\270\n\034\213\333"
+	.ascii	":&\204gdl\304\003\3418J\034/3\033\332Ec \324xP-Y1\235\3059\211"
+	.ascii	"\372\315+\tC/\314.r\365<2W\032\032\301P\216\342\004\337D\305"
+	.ascii	"\274\314\223\227Yu\273\017\356Pr/\3551fg-f,l\333\215\270\263"
+	.ascii	"\0302\322$@\266\376k\027\320\271\205`\236"
+	.text
+	.section	.gnu.lto_process_ltm.123.62932cfd9c98698f,"e",@progbits
+	.string	"(\265/\375`\207\001\345\r"
+	.string	"\206\231ZB\020\217(\035 gz.\3502\322\277\001D\016\211\001\300\351 Xn\222\2160'b\232=\334\216V[\3457\265\263#k\337\274\027\025\215\003TH"
+	.string	"\240\021@1\214A\364J$^;\252?\331{K\231RH"
+	.string	"A"
+	.string	"I"
+	.string	"V\311\312I\245\305\356^Zr\321\255\b\237\246\310\267606ntk\302\343+\340\022b\205\206;\275"
+	.string	" \0276S\302\220\277\f\027r\325p\2457`w\177\362\214\300i\231\326\306\356:7N\302\215\271m\007\266\t\330\037\021\207W\370\202\302\205\b);\303\264\037|\3447'K\006\225\246#\0335J%\261\377VG\354L\307L\303L\277Lk\2463\323\337lR$\f\260\330\005\351^\254\n\2460<o?\303\"\273\345(\223\r\330\002\0167Y\271\200\210\236\230\252 \305D)W*\251\360\245\005vd\233\r/\223v'\003\300\242!ww\244J\342s\342\323\237\034S\"\345D)W\3769\361\372\324y\022\321\262\263\217\362\016\036\337\202!\200\362\333\241\017\212\001\346\320\350\204<\256\217O\b\353`\036X\350b\320\221\240sq|@\227\206"
+	.ascii	"g\r\260\317\025\312\262\317\225\201\332\277\325\221\003\"T$\325"
+	.ascii	"\034u\345\233\nRv\316\234\023\241FE\200\342\301\224\372=Q\025"
+	.ascii	"\352M\024\264\354>\250\302\n),M\332\001\" \240\202!\261\362\001"
+	.ascii	"#B\227\027X\342\235\326e\221\314\bS\332{N\275\232\331`,P\212"
+	.ascii	"o\341\327\225\214\025C\013U\341\035+Nda\222\021\005>\2704*b\374"
+	.ascii	"Fw\270\030\031\3404\330x&\021\007T.\200\341^\312\215\272\267"
+	.ascii	"\265K\017"
+	.text
+	.section	.gnu.lto_handleLtmTelemetry.124.62932cfd9c98698f,"e",@progbits
+	.string	"(\265/\375`C"
+	.string	"e\b"
+	.string	"\302O970\221\322\001\200\324E\217R`\017\007%\f\356a\303\241\300\230N\207F\224\347\373\333^\377\336\020\022\361\265\230D~a`\200\306C\265?\023\031\370L=<![\312\224\002\376tB\034\b\2166N\013i \215\203\016\r\013!\370\331 `\247\300\242\007m\203\234H\264A\216k\357Ai\352\355\356\276,\355\b\211\374\312\252\247D\221yi\250K\331\225\201\244E\2256\366E>R\362A<\"\345W\307|Rv\354\372\326\r.fj0P\031m\327)\265\303\276\306\030\243\225\303~\372\330@\314+\201e\267\"\336\354\n\226\022b\373\034\233l\230\273>\366&.\023%4\273\013\325\343\246?M\223/\320\235\376\002X\327\207\220\241\302\342t\251G\360\332xy\353I\321\2512\001<\273\353\\u\0267v\333\n\266\017l\237\004\016"
+	.ascii	"2\003\352\f\027^\330\252\202\200+\200j\037\244\214\210;d\b\020"
+	.ascii	".\243\274\f!.]K\32340\005\005"
+	.text
+	.section	.gnu.lto_freeLtmTelemetryPort.125.62932cfd9c98698f,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\r\b"
+	.string	"B\21766Pm\323\001\200+\325FE5\251m\263\f\213\277]\344\032\267\341w\252\3641;a\033\231\177\372\035\274\232%I,\252\252\2322\246\2769\214\275\t\207\032\273\277\334)\005\316`\250K39\3265Q\223f\272\346\202B\00253V\303\304\b\270b\230\254yU\2255/\335\336\262\312\305\r\264\222\362Q\b\373\224\364C>\242\252\315F>\026p\027!\017\322=\022DI>\217$\341\325vx\200\327<\020\241\231}\321?<\376\2069\035x\355\321\357\310\307k\264\360B\242\212\017\374\354.\203\212a\337\262\312\331\207\276\374\006\362T\016Pv'\276\322\226\304\021\016\333\277\030\263O\336i\354EJ\022#ow\247f\034;\304\374w<@\333\262C"
+	.string	"\204\3355\3246\212[o\233\300\266\201m\223\016"
+	.string	"3\241\333\037\270\320\\"
+	.ascii	"\333\246\310^\205\036\260^\247X\337U\026\272\206\373\205\340"
+	.ascii	"/\343\202K\267h\347\023"
+	.text
+	.section	.gnu.lto_initLtmTelemetry.126.62932cfd9c98698f,"e",@progbits
+	.string	"(\265/\375`;"
+	.string	"\005\b"
+	.string	"\222\01776PO\323\001 \017Q\363*\304\325\030FD\225\0267\223v\270\n9J\370\007ZB\246w\372c\351\201\034\366\352L#\211\025\363\246[\305\374\024\002F\247\021+eJ\001\2666\227\326\201\237L\213W\354D\rB84\\\320\312$\340\346\300XD\314\240\206a\031\254\274\275fu\304\360\361\201\324\302\251>\312S\254\310\341\270Ty\223_\355\207+\337\245\032\210:>\f\345|\365O\356U\370#\306<\223\357\241>%\251\213\001e\311T\016|\202\262)>\371\356Z \342\370.\224\263=.\025\304\276fudg:\237~"
+	.string	"\201\007\313\302\313\356Fif\277i\205\304\366+o6\314=\221\275\212F\006Ifw\241\206|{n\376K.\320\205\270'\200\302\356:\273\220\350\326\333F\260\235`\273%\r"
+	.ascii	"3\241\317\037\030\317\\\005\266\201\024`\257\271\232\027\240"
+	.ascii	"BqMD\030\002y\031\002\\\272E;\237"
+	.text
+	.section	.gnu.lto_configureLtmTelemetryPort.127.62932cfd9c98698f,"e",@progbits
+	.string	"(\265/\375`w\002\325\024"
+	.string	"vg\213J\260\022R:rJ\230\361\007b;\327'\200#\306HO\331\233J\354\244A\337\020\024\224\277\360\331Us\371}\366\266\325\215\240_|\333zm\352\257s\216\272\334\202?\313]\013\207\337;\355\254[\2123\244\360\252\225\220\275\267\224I\006s"
+	.string	"o"
+	.string	"w"
+	.string	"\027\376\273\177\321\266\366D\017\336.\314\031uH\214M;\276\253Z\215\016|\256\201\3613\345\001\350\247<"
+	.string	"\372\271\267]\0377\002\252g\372\331-a\325Z_\255\342\267\213t\312\346\333\236\244\247s\321\304i\210\351si\322\003!Sj\255\255\236\216[&x!\302\311\244\227\223-\246!.^t\346\351\355\230E\226Z\3532\257W\342;~w?\354\256\202]\216\021\273\"+\373\022\206\225\275\022\316\314Xk}\320'w\353\367\004C\330)Z(Yu\003\367\206\276c\222\254t\234\265\373\243#\335\354\2036\303\214\317\373\334\317\350\347\373\347\307\303\027<\201\343\341\256Q\216\033\270{Yk\255\333\277]\327\205\337\221\221w\024yE\312K'\357\224\274\262y\273y\231y\217r\237*\254\037.R\265\366\f\211\324\252\031\305\"<\233\317\200\322\3367\240(w\241b\357:x\300\347\215-\353O\353\354.\204CE8\331\201"
+	.ascii	"\250\326*6\216OH\210\343!\315\237&,\330;\275\006\005Y\341\205"
+	.ascii	"\276\320O\332%W>\241(\034\017W\366\354\037\206v\313>I\3221\303"
+	.ascii	"F\316\302\233`\306Zu+{\032g\272\260\013\213\305\350g\367\354"
+	.ascii	"\001\002\371\202\263\201\207\232B1$\237C]-\3407\344v5/\005\035"
+	.ascii	"d25.2\033L\202\f\007XL\311\306Tf6\232\227\207\232M6\223\321\310"
+	.ascii	"l\257\232\031\330\354\025\253mx\251\fX\232\006Y\355e\243\321"
+	.ascii	"j\257\226\021\356\262\262\340:'6\3606t\177\343T62nA\276\005\351"
+	.ascii	"g\001\340\220\217H\b\216\207,uD\345\243\r\334\007}FH~\016%\331"
+	.ascii	"\361\355\236\332\325#\315C\243c\037i\005\216 9\254t\234\265c"
+	.ascii	"\357\245>E\333\007\355\255\250\245\245\007\017\b\201, `\002!"
+	.ascii	"B\313\016\362\320,\"\364\n@*\220{;\"\355|l\204\024\250bIsb\004"
+	.ascii	";\362\202\2611E\266p\243\0361\344\346\221\035\334\035\234\006"
+	.ascii	"\343\237_\253\327\2335B\271\351+\207d)Q\002\f\034r\370\312\323"
+	.ascii	"\213e\b\311!\b\363\204$|\306Y\217\004\354<\202bK8\311\370\366"
+	.ascii	"\n\265+\023>\367\272F\357RP"
+	.text
+	.section	.gnu.lto_checkLtmTelemetryState.128.62932cfd9c98698f,"e",@progbits
+	.string	"(\265/\375`\337\002\345\025"
+	.string	"F'\214K\300\360*\035\370go\247\303\027\265\022\372\177\215\\\233\223s\256\271\361:\036\203\354\213\n\350\002\344\324a\262\036\341\204\233\267\317?\305\235X yZ\226\241s\226\004eQ \203f;\230\267\275\375\372:\354\322\003um#\204\020)\223\fx"
+	.string	"o"
+	.string	"t"
+	.string	"\253:y\325\312v\225\236\226\250\007j!\363\202\251\326z6\211\313\236B\235\314\222\034\233e\373\331S\301\363\317\017\020\007e\226\210\250\331\375t\203F\227cs$\t\302\t\261p2#\200\025J\276\363\274\200\217f\307\345i\273\223\367\321\354:\360\030RkU\341l\334\343"
+	.string	"\235\220\310\302y\030\023\020\177\273\347\234?\340j\314fI\255u\371\206\253\371\252\276\273,v\227\301.\033\005.^\366'vC\013\377vr\337R\236|?\347\254\353%\361tr4.\356\2465\356\336\356\273X,\026\267ovI^\326w\276+\3465G\336\222yG\346\355\346\275"
+	.string	"\221!\017\204\t\234FJ\353L\221G\035\2223R|\347\337\375^\347\301\230\247;\"\345\016\334\363\220(\220}\007&d\226\326\231\005\302\024\310Tk\212\340\344\0368\235\334\215\3312\314F\035\0355}p\331\273\024*\360o\253\016\261\365l\3670.d\341\302\311Iy\262\354\363\234\213F\330\360tXH\374\345\312"
+	.ascii	"\274\253\202\362o\333=\373\326\020\022U\220\335\363\371\3300"
+	.ascii	"\240\007\301dXY)O\216\335D6\232\376\323\t\223\306\356\355a\312"
+	.ascii	"\356\373R\374\336u\275\370\267\356\023\033[\317\316\304\237."
+	.ascii	"Fwo\377R\276Szr\330X\307\356{\036\250K\013e\002\006\264\225\202"
+	.ascii	"\302\322@\002\007\224\205\300\252\214\270b\255\363\005\026C]"
+	.ascii	"h\013\215\235,+(\256S\005\326r\216\200\354K\003\n;c\257\027\354"
+	.ascii	"T\245\264\217\265o\266\204\326\265\217\265\326\232\272\317\215"
+	.ascii	"\f\334\330\360\200Kw)\213z\250\310\264\004\302\254\336\007\035"
+	.ascii	"< :\r\027\b&&\345IV?\370\217\020L\250\b\254!\335\260\326\263"
+	.ascii	"}-\035\3668\255Z\004\205\314,\270\303\354\336\256\332lX\017\216"
+	.ascii	"> \200\002\2511\263\r\275\245\"+\336\274\204\333rO\006\213\264"
+	.ascii	"\323*\236\304\205\333\236\257\367\315z\333\356\310\202\223\320"
+	.ascii	"bY97\200\274O\305f\\\224\205/\332\004Q\0134h\266|\302\022\244"
+	.ascii	"\215\322\n\017\312xhIr]\301\037O\t[\336\320\022q\300\365\031"
+	.ascii	"\351\325\3415)& \fi,\336\315\330\211\213\302\322\r\340\f]\211"
+	.ascii	"@\211\373\343vI\356qL\217b\fc\270A\263c\364@F\302y\374\315}\316"
+	.ascii	"\276A\326\272\240"
+	.text
+	.section	.gnu.lto_handleLtmTelemetry.part.0.163.62932cfd9c98698f,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"E\n"
+	.string	"\206RD= \345*\035\3478x\"@\024\021avcWWw\220\356"
+	.string	"\261\t\307\256aH2\223\301\231vmwwmH\242v\331M\200\312\b@X\b\034\361~\001\024\001h\373\025\033\331D\312\224\0023"
+	.string	"2"
+	.string	"3"
+	.string	"\247Gn\265;\371\004!\352Q9\005\031\215\025b|\271\204V\315\245 \\q\234\030\022\217\307\256\025\241J\325\340\235\3063\347\364@\306\255\271m\006\333\b\366\2737\335\227\267;7\327e\253\372\221\263\3202\247\305\215\300\344\210+\"\366c&{\263y<\314\266\351\302'{\3463\220y\232\f\305\211\2009\247|\334\217\007\nc\222b\343\366U+\240\2012\267\303\373o\300FZ\273/\333\245\356\353Pb[\351"
+	.string	"\373\262\317J~\210'Hz\326\243O\352\036\277\217\235\023\200\245\225\322\376tB H\222>\320\013y \017\224\020\017\r!\371\371F\262s`Q\204\367IP$\372\344\306\266~]\266'\265\252\250Q{$\241gYU"
+	.string	"\274\250\026\345}\025"
+	.ascii	"8\243\027\f\204c\272`u.\2171\253\330\026@\036\030\341\212A\017"
+	.ascii	"\321p\006/\352\206N[6\363vZ\020\256\275\234B\265\032\0063\204"
+	.ascii	"F\235{m\031\003"
+	.text
+	.section	.gnu.lto_checkLtmTelemetryState.part.0.165.62932cfd9c98698f,"e",@progbits
+	.string	"(\265/\375`-\001\215\r"
+	.string	"\346\226UD\020q\233\016\030cV\206\3005\032\"\343\001%\237\360@P\032$-\025\275\016\262\036&\266\004\213\2517\213\241\333\337m\276\3170\231\256$\314\001X\021J{h\024\212\356\376\035\241\232\002\003\367\254\331\266\367\336)\005A"
+	.string	"?"
+	.string	"E"
+	.string	"\236}\343\"\210=\213\021\027RN\273k\275\316\017\367N\247\254\236\017\340\3638\225 _\206O:\240De\f\360\231\250\202\321D\303\303K\f_IJ\001\257\027\316\356\0323rS\267\375\300v\003\373#\0012D\374\344\267\357\237x\312\350)LYHv\367'7\341\243\270\322lH\027;\213<\364QX\263\361.v\007<\304\ra\240\"\2268\355\212\t^\215"
+	.ascii	"3\272\037\222\354\252z=\t\333$\021\007\323\205\205:c\245\304"
+	.ascii	"\322\002\207\034MJb\314\t\332\026Q\237\037Qj\230\244\016\373"
+	.ascii	"*\276B\344\2070($\017\022\242^?i\20068\204$\037\262EN\320\263"
+	.ascii	"\236\356\364`S\351S\004\026l\330\ri\331\261\035jW\b\353D\230"
+	.ascii	"pa\022:\037\007\020D\327\247\200=\231\214\303\254n\343\256\354"
+	.ascii	"\302.\316\372P\350d\226g\003Y\031\003\326*\\\233\305i\332fU\266"
+	.ascii	"\3459\037\263D'\370\216\362_\034F\227i\032\365z1\255\234r<& "
+	.ascii	"`\002\231\223\347\001q\022\340a\033aK\013\304\002\215\312q\n"
+	.ascii	"\3303O\250a\306h\202\033\233\243\343\277,\206\332\002\246$H\310"
+	.ascii	"\273\021V\f\251\027/.\320\3728>\200\023V\272KYpY\355\016\215"
+	.ascii	"=\304p\274\244\207\276\312\340\267k\205\260\274\307\3254\030"
+	.ascii	"\367.5\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.62932cfd9c98698f,"e",@progbits
+	.string	"(\265/\375`t\004\205\022"
+	.string	"\026\034gE\360\224\223\016\3608E\037\225\177\327Bua;i\257 r\326\356\237\357\373.\323\325?I\007\311'A\354\220\211\330\214\340\034x\006\236\232t\220\016\322A\346\003?\346\246U\234\362\r\266C\256\232(Eh7\271S\nP"
+	.string	"V"
+	.string	"Q"
+	.string	"\323\363>\003{\233\230\237$\314zI|y\t\351\362\021\262\345\"X\326I\n\254\221D\323O\310\356&Jk\037\022\201{\222\264V\262\262\356\211\003\326G\"g!R\355\177S\200\213H\333\327\364\274\211\303^\333G\315As\316\251\2626\022m\313\020\001,:\354Sp\330\253\330\260G\241aO\"\303\376\373\234\323^\301\260\247\371\005[\360\216\nVI\237(\230\207\364i\202C)a?c\204\257\200\360\032\371`\335\212\016\314#\033x\210d\260n\262`\375\023\275\231C[\255VK\301\232I\002\023\221\b\356B\036\330\323 \005"
+	.string	"\276N\323\315\013i\252\205\232f+ME(`H\373\272L1U\b\312\342\217\036\235\031\316\324d\3124\364e`\207\351\345\205\367@\230\226\214\251\366uR3\357\n\257R\251%K\335\264\025\006>\005R\354\252\327\367\324Lg\375\260o\341a\377Bf\037\306V,\234b\250\237FG\220\237\021\247W\352\021\207u\003\003\2063\020\034\326\r\024Ng\036Y71rb8\305\276\253\215\rp\347e\324\222\242&\227\024\225\021)\b\031'\001\242\016\330cg;\321\013\365\327\360\341\311\3016\275J\333\364\250\237\262MKrS\025p\364\211R\001a\250A\034\312\261\234\222\372\024\032\003\360\002\251\231q\016\021"
+	.string	"\rvJ*\tDr\n\343\001\370\374\341\"Q\235\350C\302\204\310z\357\343~L\312\036/\222\3605\035\361\300\200t{b\177W\\`\242"
+	.string	"\322\264\337\243\260_d\r\276\b\356;\001\347\263A\355H\030Fv\265v\373\021\025@2\177\351\255\341\034\370\022\201J'J}\002\366\337;\"\013D\033\f\206Z\251\r\301\276g\320\302\337ri4\314\004\013\317\247\256\260\tw\313m9\002\033\r\321\20263\3261R"
+	.ascii	"\300\351m\035\305\226Jno\373\261\331R4^x\013@\013\274|R=\335"
+	.ascii	"\315W\001"
+	.text
+	.section	.gnu.lto_.refs.62932cfd9c98698f,"e",@progbits
+	.string	"(\265/\375`\207"
+	.string	"=\007"
+	.string	"v\2252$@i\2334\006\3030\f\3030\f\3033\254\b\025\352:r\351h\350\277\276\375X\033\032~?2\262f\267L\001#"
+	.string	"'"
+	.string	")"
+	.string	"\013\250\021\266\217mPC[g7\365a\233\226(:\333f'\352e\253l\244\"\351R'u\325\333&oA\333X'!\322J\032I\231EG\335\33026T/\0207\333\304F\324\312\341:\\\230\214\025\351%]\251\242,\260\035\260\313</\317\365t\222\n\352\004[\004\373@m\240n\3302\354\205Za\0015O1\241\330P3l\0276\201:!\375H;\026C\321>\265\213\232\211>\034\254D\nK'\332\246\226\t\360\222\360\036\021\224\311\301\326c\2162@.J\242Ej\307\b"
+	.string	"\271\nm\363\004\t"
+	.ascii	"\312)\376&\201\236PD\307\341\244\250\321p[\036a\2666u[N\253\366"
+	.text
+	.section	.gnu.lto_.decls.62932cfd9c98698f,"e",@progbits
+	.string	"(\265/\375`\3775\305\343"
+	.string	":X}LW JIJ\035\234\216g*x\376\355\263\254\202\002\030w\177\036\235\365\265\212\204\255\333v\353\320\377\336\034\323O\3253%Dx\337S\350w\360\350\326\205X\020\255#J\3216)N\3234m\222\0247\241hZ\325\024m\305 \2152,B\025#U\245Q>r\322\244L2\005A\004\250\004\336\004\230I;\266\241\177_\017<\234l\234<\357\244|6\372\245\240Rg\357(1\351\216\327q\243\357\344\364L\337t\331\2402V\230\024\004\211\354d\352C\r\230\375\233>\351:#\230Q2\343*\373|\353x\374sp"
+	.string	"6\231\240\033\f\217\241\275\340\373\354\270\251\375J\225\242\270\377\215\307\3616n\364\227~\206\177\327\321'\005\177{;\245<Q\374\322\327\370\244\240\022\272\233*@\301\201e\272\367F.\0012Fg\1770\332\337\213~\032\217t\243 \276\271s.\030\250\242\244-:\004{_\020\300\333\327wA"
+	.string	"\375\331\264\177\232>q="
+	.ascii	"\201\227\003\220\2113E\352\256\371\371"
+	.string	"a\324d\241E\345}\376\027;\370\006\223/)P\364\031\332\r\013\322\354\375\324\327\365d\306\323\211\321\323\353\206\005\227:{\351\343\350\331U\205o\311\334\305C\362B2c\246\335+h{gTn\330e\003\023A\253\314+\277\350\227W\357No\337\273\270d>y\313\334\274;\346\356\335\350\345\273q~\273\\9\337\201\356\275\334{\363\\\276\253\345\266]6\246\017\260\246<n\027.D\021\323\004&:\024Pn\030\346j\352\250\227\f-\276+\345NI\361\242I3\303-\206to\250\337-w\236\313w\327.[\210\030{?AQ\360\243n\n\216\351\336P\022;$\200ER\274\250(\310W\314\021#\255\254\317\3762t\230\273\263'I\250\317\367\316\351n\366\016\201\327\206L}}v1\327\316\335i\362\326\024S\220\317\327\313\375r\243\030\\:\277uW\352?%tC\237\b\2310\257\317:\327\003\360?\251\375b"
+	.string	"\304}}\027\003\240_<\235\241`\267\013\034\027 \030\227\0279h>\002'f\344s\364\276\335-\320\275\003\\\342\006\245VE\373%\3238e\256\312\214i\202\345f\311\311;\n\303%\013K\222k\345\006\211\022R\024\324U\363\334\345\304\301\312\2455\261\317~\235\332/\016\355W\206v\020h\235V\337\262\337\323H\327\227\317W\354\216\335\250\210K\346\032p\3408\331\265\265\366f\313\271)\223\345\326\343\263\027\265_\021\300\333wE"
+	.string	"}\250+`A\273\t\332?\320\367\3532\271\321\021\027\314/\327\355r\232%t\177\355\r\315\241\341r\267\003\354\263\243\320~\233\370\207\256\315\201\347h\277#\2009w\004\320_Wp="
+	.string	"\363\345"
+	.string	"<\301v="
+	.string	"\035z\225\270\337\254\253%\0023\215\234\033lo\250\206\034\350\322\321\217\317\016\275\036\200\372r"
+	.string	"j\t\212\300\332={xAG\320\003My\202go\270_#\367\257\300\375-\320\302\341~m\\\031iK."
+	.string	"\367\234\200\032\356\337\243\364\033Hr\277:\016\360\030h\316x\215{.\200\317\270g\016\356\327\356\221\356\364i\310\375Q\236\331\311\020>\201;~\273\035\334/\207\017\356W\307\375\206p\277\036\334o\007\334o\006fv\274\002w\234\305\301\334\271_\326\375\202\300\375\036\277\002F?\303/p\307y\356\267\005\367\233\302\375z\300\375^\300\001\356/\303\375~\340~\271|\f\367\273"
+	.ascii	"\367g\272_\021\334\037\206\373\275\362/\334/\t\356_\024\001\367"
+	.ascii	"K\344~Qp\277t\277t\177\n\024\275\322O\270\343;\f\300\304\b\340"
+	.ascii	"\356\333s\334q\324\375'\020\002\375 X\301m\334q\226\373\177\300"
+	.ascii	"\375\211\334\277u\177\026\356\277\272\177\006\334\337\002\356"
+	.ascii	"\317\202\373\253\340\376\017p\377\022\334_\001\356\177\302\375"
+	.ascii	"/p\177\034\367\017\200\373S\340\376!\334_\002\367\337q\377\017"
+	.ascii	"\356\337\301\375i\334\177\203\373\353\270\177\320\375k\334\037"
+	.ascii	"\350\376\330\375\257\373\355s\277d\334\357\030\367\253\347~\361"
+	.ascii	"\334o\030\367\013\306\375\326\271\3379\367\013\347~\335\334o"
+	.ascii	"\026\367\273\346~\251\270_&\367{\346~1p\2773\356\236\305\335"
+	.ascii	"\305\270\337)\356\016\346\356Rw\327\342~\307\334\257\230\373"
+	.ascii	"\215\342~\241\270\337\034\356\327\311\3756\271_\027\356w\351"
+	.ascii	"~\225\3567\351\356+\334o\b\334\257\b\367\253\335]\313\335Ipw"
+	.ascii	"+\356\256\323\327\327\327\347\016\334\3565L\367\001\300\005\314"
+	.ascii	"\345S\022\363K\231\244\201\371\365\224\264\277\236\266\316^*"
+	.ascii	"\2331\226\273\251a\177=\331\355/g\222\016\363\313\231\304\374"
+	.ascii	"z2r\261\304\330\302\242Tf\n\204\314\355\301\\n\032GN\312\246"
+	.ascii	"\016\033\023\352\334q{_\260\027\273\031\200\275\235\234\3158"
+	.ascii	"%\216;V\304F\243\b\212\322y\241GE>\234{\311\306D\342\334\033"
+	.ascii	"I\021\320>\332 \te\333B.[\362\207\3236z\261\267\004G{'\357f\333"
+	.ascii	"{'\367\3363M'\350\336M:\314\347\321\321\336L;G\333)I\366b\357"
+	.ascii	"\007\223\033Kb~\371p\362\2205\371zn\030\320\344}\356\270\247"
+	.ascii	"\246\376Jrm\243;\375L\252\001\3463\225\025{[kU\234\360\031p\213"
+	.ascii	"\02029'xJ\020o\206\030*\237\335\206J\227\221\315\310gI_\354\306"
+	.ascii	"\304^\312\225UV\330;\233{\t|\033[\256I\031\241\307\245\310\n"
+	.ascii	"G\301Q\032%J1\\\200|\031\322\005j\306S\335\223\352\212\027n\202"
+	.ascii	"\267p\030\326\302P\360\022\354\004s\341'\370\013C1\023\254\004"
+	.ascii	"\203\341,\334u\2438\212\255\034_a\254\030\364x\246\260l\021\301"
+	.ascii	"Qq\322\377\301c\357Y\365IjO\016\204\310Iq\024\033\301G\360\262"
+	.ascii	"H\235=\246Ad\360\302\203d\r\373p\277g8\212\177\320\341(N2CD\n"
+	.ascii	"\013\315fNF\225\215\013\362\ra\223\324^#\325^\203E{M\024\355"
+	.ascii	"5X\332k\214`\251l\267$jF\216gM\022\317PC\246\250\214I\f.B#\247"
+	.ascii	"\235\346L;\215\022\3554A\264\323$\351\0352\3325\233\036\021\325"
+	.ascii	"\256\245t\n\275C\273\216\241\335\361\016\354\344\245\206\245"
+	.ascii	"\374\214\235t4\3354Y\223a\255\t\347h\002\263\203\3533\0230\255"
+	.ascii	")\205\303\3037\260\r\254\204\223\360\022\256q\243\030\007F\302"
+	.ascii	"8\256\026|$V\204\005\303h\312=\237\230]\244\030\007\246\261&"
+	.ascii	"\375\0371n[0\251\263\213\334\342x0\016,\343\266eI\313\360\355"
+	.ascii	"\220 \221\303%\017,-\230}\246\211\366\231)\3553A\260\321\375"
+	.ascii	"\212\n\231A\30236\216\r\22010\345g\007\222\321\016\234\323\016"
+	.ascii	"4\323^\005\277\300@/\247<\321r\341x\371u\303K\306C\227\332\305"
+	.ascii	"\224\223\r\\\004\225\205\346\003\f+q\022\005\0312\350>;N^\275"
+	.ascii	"so0\033#Kgt\2375\340q\274\201Vf=\364\276ooFm\310\026#]{\237\345"
+	.ascii	"\245u\322\275\027s\303\264\256\354\275\331[\331Q}\322\255\275"
+	.ascii	"\277\362X\222\301\272\246\336\363\375\230/\363dn\364\367\036"
+	.ascii	"\317?\357\247\277\367\316\027K\206\220\222\356 \022\222\243\265"
+	.ascii	"\233\374\333c@\250v\240\225v\024s\327.\213T\372r\327\356\262"
+	.ascii	"A\201`\026\327\345\257\312\272H\265\374\026\351\227/o\367t\357"
+	.ascii	"\345\353\036\314\337}\230\033}\251\307\311=\337\270\224y\221"
+	.ascii	"\276\364\331n\230\031\235T\372p\267-\210\367\3461\367\334\033"
+	.ascii	"\032\3143\033\362\334\220\035\370\324\016\374\241\035\250C;P"
+	.ascii	"I;\220\251\375\227"
+	.string	"\247=\356z"
+	.string	"\276\233\215\2252$}q\337\366k\323\376K\323\376#\323\277\006\242F\354\tS\322g\377ei\377\035\321U^\355\323n\364\255\240\221yR\371+\276\247\225?\373\253\340\022\272\223j\214\220 A\"\310T\343K\232\316\376\013\242\375\267C\373oI\373\357H\373\377"
+	.ascii	"\002\205\263\232\276\330\317\360Qv\r\003H9\377\311\207\f\257"
+	.ascii	"\243-\261\357\361I\227\rj+\225\027H\261\301Y\215=\331Oy)_v\243"
+	.ascii	"/\3661h\211\375\220\207\272lL;i\267\201\324\023\316\n'\312\307"
+	.ascii	"[\325M\2062#\326\305M\211\232v\024F\256\236G\214\200}\364\237"
+	.ascii	"|\223w\362Ln\364\303\336\313\237\310\027\361\374a\377u\3330\364"
+	.ascii	"9\023\365\221%\275\322\250k\267,\302\372g\330KY}\330#\371.\314"
+	.ascii	"\325|\200[\024\211\235\\eog\005\263\347)\3323\227\346\032\036"
+	.ascii	"\311\363\232\322~\265\266^\353\332a\350\230\206\3415\004\372"
+	.ascii	"J~\311\215\376\326g\371O\335-\317(\260\376\n\352\371[O\365W\227"
+	.ascii	"\rl+\2236\240j\266\361\325\314\020C\fp:{n\322\236\215\264g\246"
+	.ascii	"\376$_u\243~\366VB\250$\205|\366\2745\321\214\237\001\035\363"
+	.ascii	"i\307S}3\247\035g\321.-\323\216\243h\307a\372\356`&\372\241\376"
+	.ascii	"ex!\376P\037\344f\t}\250\274\267\362^\013\202\367Z\360;\233A"
+	.ascii	"\351\005\314\216\267\264\343*\355`P\332\307\002Rh\3376\344+*"
+	.ascii	"\303\227/9\314\231M\027\347\225\344\235\3470c\267\b\\\033\225"
+	.ascii	"\317\031\f>\242\201qUu\3649\333a\263\227\333\212R\344s\226^\274"
+	.ascii	"\254\\\302X\373\234\353nX\216\026\217\262\264\317\231\356\262"
+	.ascii	"\3351c\\b\334+\270\211\220\267%Lp\016\227\347N\334\r\343\t\220"
+	.ascii	"\034R\234!7\242`\304y\236\313ry3\310\270\310u\311W\240\314x\003"
+	.ascii	"R&\255\256CQ\226,\371m\307\231\264\373`\n\224\001U[\230l\361"
+	.ascii	"\374\206\321t\024\352\n\356sf\313nSR bn\271\215Mm\351\211\t\004"
+	.ascii	"\230Z\222\026\2144\301\027f\024lv\023EK\223(tV\254\344\265\035"
+	.ascii	"*ce\370\310\206\364\355]\361\274\346t5At$\265\362\030\r\033\036"
+	.ascii	"\036\030\226*Ur\032\007eK\232Vo\205\206\030\231\213\361\234F"
+	.ascii	"#5\345\303\310\210\231YF\353\240$Y\267\204\261bp\211\341\314"
+	.ascii	"3\332C\341\210a\302\266\204\203\f\332\2418\224\\v\2736\322\365"
+	.ascii	"\252\253\261dD\316\323\"5F\346\271L\277M\371b|\316Q\362\230\273"
+	.ascii	"\323<\0213\034Scb\270\n\r+D\376\305nzb\226\226\245\334\270\033"
+	.ascii	"\036@\232\3408\350p\342\344\206\2010\342\354\251*\314T\303\f"
+	.ascii	"lUrJ\224d0\020\230\240[\251\005\245\250$VaTG;\203\345(\214#\033"
+	.ascii	"I>7\301Q\264#c\262h\307A\270\352xrW^B'\315]y\353\332E)K\302\304"
+	.ascii	"$\177e\257\033\315]\031\372\265\223\2454\266\302\350\354\033"
+	.ascii	"\272\264o\250\322\276\201J\373\206)\355\033\212\0349\222\263"
+	.ascii	"t^4ih\274aIi\300\330X\232\346\254\214\325\244sk\373|\3652\360"
+	.ascii	"um\310\241sU\026\222\223`\350\223\004\037d\254n4W\345\251{#f"
+	.ascii	"GRG\316\236\223\3346\r\320\354\330\321V\3649#\341\361L\025\227"
+	.ascii	"Dv\343\363o\303\013\355\032\306\004\211\346 \371y\367\023\002"
+	.ascii	"oY\322\335d\312 \250'\205\371\374l$Hu\205\n\226\317\256\341M"
+	.ascii	"\317p\2439*C\371\315QYH.\262\2236 S\212Jr3\027\343\312I\316\236"
+	.ascii	"\213\270g\0310\214\333\246\201\275\227)\350\035\321\372\234\207"
+	.ascii	"\360x&\302\034\203\365\271\206\211v\rF\264\215\206\036?~<T\356"
+	.ascii	"\260\3654\3449\335\315*\031\360\2145\231a\234\316\374\244\364"
+	.ascii	"\201\324\230S\006\031\254\tF^\356q\233@\275\314>C\277:0U\321"
+	.ascii	"\220\343\3417\232y\340*\311\240\030\031\026\032\215\224\026\351"
+	.ascii	"\334\024''\0205\222\334\232\246\032\013\035\220#WM7\232\2330"
+	.ascii	"Z\t[\251\224\202\212l\bSf\302M>NPI\351\304\260\264\204\365\364"
+	.ascii	"\276IRnMVxM9\246\355\263\353\320\3206l\354\364q\2715Mq\272\324"
+	.ascii	"\226\210\351)e\245\207\332\331I\273\023T\\9t\315\334|\246.b:"
+	.ascii	"\225O)\244\222\260\320\264@!\313S3\3124\214\362Q>\302z:yq\320"
+	.ascii	"\370\370B\346\316K{\016\020f\226\301\304z\300\275/\324\211\324"
+	.ascii	"\214\021\003\353\335\335\334\233i\001\3219\351fb\032\361X\306"
+	.ascii	"\352\324>{\216\222\366\340\324E^\346\027\267M\357\347\314\023"
+	.ascii	"\030bA9\355A\265\\\224\213\364\202R\22299%u\027\206\257i\351"
+	.ascii	"\215\252\257\257\006\206\024\2761\306\005&\204\314\215b2\327"
+	.ascii	"\016\004(\247Ry\001UR\335\322\364\251\260\276\212\344\0303\006"
+	.ascii	"\353Y\240G\220"
+	.string	"\306t\212\365\266\310\334\3058\326kC\022\345\344\263\007\213\360\360n[Nvm$\005H\325-Y\355]%\203\337\023^\336U\2250ap2/\273\266R\315\f\2629)\346\343{\242g\304\316\016\203\021C\346\3264\305\371\361\305o\024\177\301u \2009w\215\023SN\246\f\202O\272\214I?c:\377\274\237\376\262\334\2411\371\3548M\3557e\272t\301s\034\260s\222I?\273\034N\233R\227}\367\366\206\341\364\336\373\312\223\213c\270\354\266\305%.\f\210\005\211o\257\315\315\355\336\335+-nM\323\0332-Q\254\345\231\230\271\225O)\250z\2705M\303\262Dq\226\333vb\306IQ\224t7\241\031\370\r\227v\234\206\325\034[ql\005\257i\350FB@\322\255\311j35G\270\343+7\212\327~YeP\034m?\037x^n\220\264\277\262\271\367V\372Aw\263\350\306\357\357\336\021\3568\027\337"
+	.ascii	"\270{\336\333=\005\t{+\373\246a\364\224\230R\307\347\355?\266"
+	.ascii	"\275\227OI\020\236\222\226O8\230_O;\271\214Jjh\356\247$\363k"
+	.ascii	"o\r{\271L\212\340\334\032\230_;i\273hK\272\033\372\224\334K\347"
+	.ascii	"\326\260\227[YA\253\260\306H\364\271I\221\323\263\022\251"
+	.string	"\240B\002\021(0\256B\307`\217\221\350\323a]\333\265\247\303\212\225=\026\2079\016T\302\204\210\325\204\325Ge\213D\325G\207E\036Y\343\312\316\254-\021\331\302\t+\230\260\302D\273\376 U\026\303cQ\305\212<\252\310iM\030\217AA\307a\213\313\n[\260@5@\227\275,\260\335P\323:P\t!\"\262e{\326\242\211#\021\304\360\307\n\331\325\003\213<\026\217*\212*q\270\n\261=D\241\026\304v\030\002\253\266\200$\252\034X\232\240\265eaX!\374\200\034\002\361c$\006uV\244O\207\036\243\003zV\244\n\364\201\305p\005\032\212\330p\242D\213T\205J\004\265'\254\305\036\243\n\004\002\347D\211\236\025h\310\346\004\265E!\313\256\303#R\310\306\201J\020!M\020!9\020Y\026\231\177\214\304 \244j\223\303\376\f\205k\020\2615\016!M\f\331\037\2658\302Z\343@%~\210-T#"
+	.string	"\326\240#\220>\266A*\322G\255\321"
+	.ascii	"E\007<:C\344p\306'hW\026CUH\270\262\304\242Jl\211F\2420\250-"
+	.ascii	"z\360!\021\271\032\327\037\355\033tp\200\016R\020\315x\n\017"
+	.ascii	"Nxp\002\350)<\340\341\361\240\003\036\355\035\360\340V\370c$"
+	.ascii	"\"U\240\025\253p\204\016\016T\302\002\r\252\316"
+	.ascii	"\217\361x\002\021q\204#\n/\260:=k\213\\[\030\211\033\210\326"
+	.ascii	"\242\320\220\b>E\025\250f\025\216\240\202\025\"\301C\253\006"
+	.ascii	"!\217>\302\265U\215\304\036\344\3618\\\205-\321H\001\233\226"
+	.ascii	"h\034\252!\016W\244\020\253\372\264\020\302\300\202E\372DPT["
+	.ascii	" \327\326h\302\212 \244Z\f\241m\217@\037V`C`\241\207(\324A(l"
+	.ascii	"\221\034\206\204=k\217qm\211\326\020lq5\032U\240\241p\210\334"
+	.ascii	"!\262G!\017<B\rTdK\264\nY\030\211\305\026j\020\207v\303\221\030"
+	.ascii	"A\004\254\360\207\350c<\252\330\300\202U#`\034\362\271Y\205&"
+	.ascii	"|\020b\203\210\326\036\243\tk\253\"\205DG\027X\f\325\242\013"
+	.ascii	"\037X\341\n\016\306#\221E\256-f\326\037\265-\036Y\260Y\177T\344"
+	.ascii	"*\024\244j\343\013*R\004\240\020\202"
+	.string	"tk\034:\252(\026\327!Mk\\\207\3105\205\037#qE\352\254\302\025\301\265U[\366\007CK\034\252B\352P\303\200\\\333Vua\246\025\262k\361\307\030\002r-\0169\300C\253\352 \025=k\253\006\021[v\265a\203T\034\211H\265\205\016R\321\262\253\013@\355@%\332#\020+\244\032\331\nZuE\320\220\021\310\n\325V\025a\250x\\\301\n\375hh\035\250\004+\364c\342H\354\320\026U\314\n\325\341\361\004V\350\007\247U\213\330x,b\240b\021\257=C-\261-\252\302\025)\220p\323\263\256B+lV\0269tT\321c\034:\"\177n\204\216=@\271xd1\021\321\007\027\217\307\006\b\177DD\237\231uhT[\226\330\023\\\203\216%\034W\030\256HbO\016+\364\203_P\221\330\201J\f\005\021M\264@?\304\242\317N\261xDf\240aK\024\372\315\274\240\302\200\331u\250\250\266"
+	.ascii	"\266\016T\302\004\213\\[\020\221=!\374(\264\"M\264\307#\322\204"
+	.ascii	"\r\262MamA\\\207\253\n;\255\260\003\036\026C\325\205bQUA\204"
+	.ascii	"\254a\2057,\264\310c\nE\225\210\\Y\235\265\350\202\272B\013 "
+	.ascii	"r%\372\020[\343\332C\254Y\205k\3171\0025k\3171(\257B\t\264\310"
+	.ascii	"\243\020\016k<\022[\241\343\314\332\252*\364\f\251.\350\265\003"
+	.ascii	"\304\025\272\025\246\230i5\362\246G]Kh\205\032\240h\215\304!"
+	.ascii	"\355\tH\200\212\n(\200\002\tzX\"\250-\232\200\001\331\256Akq"
+	.ascii	"mM\030\211j\220\211!\2225QB\202\"Q]\001\271\372\370\f5\200\250"
+	.ascii	"\275q\312S/&T\016\035|\033p\362l\312a.P\333\362\"\307\323\r\017"
+	.ascii	"!.\2700\341*\317;2F\237\177K_\210\220\001)\363\273a\003\243Y"
+	.ascii	"\2315\313j\274\t\361\302\372R\312s\321\351V\216\244\274V\003"
+	.ascii	"\204\356\312\263\t\006I/,\007\224\017\032sUPUx\237\217rZ\003"
+	.ascii	"\300\030\0011\272v8\\\214y\002\205\332\214\361\b\263\361\223"
+	.ascii	"\201\341\276\274\350\221\371|#\347$\213\230\317]\312\330\361"
+	.ascii	"\200\201\327\202S\265\267\030P\255\033$$\"\316_\035\320\310\227"
+	.ascii	"i\336o\231\321\342\234@\214>\377\224?\245\227\247\335o\3776^"
+	.ascii	"\273\273y\225\354\240\245/\227\005\305\360\250\n\222\313\334"
+	.ascii	"6\2675\243\242\317{{\231\217\207\013\013\315\312&\3113\0317\306"
+	.ascii	"3_\016\223Z\332Uv\003\246\205\231s6\301\303\313\323\251\233\003"
+	.ascii	"\317\252+\347y\236^\335h\013\204\244\250#S4b \2139\244\020Sh"
+	.ascii	"df\246I:\203\024@@X`.\232\216\2465\037\023\200\323\347\363\231"
+	.ascii	"\034\247\235R$22SPV*\303\001\027\202\032\003\246p,%\200\\\221"
+	.ascii	"\265\225\016QD\243\200K\334\025\022\\;\030\301\302\375\313\241"
+	.ascii	"\330\f\3112\200\033\003X\006V\255B$\252Q\237\252\244\225PP\017"
+	.ascii	"\237\rFl\277\202'\026\341\227\f\265N\206\023\217\342/\253}x\343"
+	.ascii	"\314\265D^\247\r\037F\373g-\215|\200\312\254\270\177#Sq\2224"
+	.ascii	"\212\301\275]/\3427\005\353\201s<\370\216\030\222\311PK\244@"
+	.ascii	"n\235S\243\263\247\n\203\376\007\303\020\005\007G\376\206AKk"
+	.ascii	"\252PAfz\254\214e"
+	.string	"\354\305P\3554\004:uu\322\023\005\206t_\373\003\217d\022\036\363B\346Cm\217N8k\357\027\3764\233]\226\032@\201\301IT/Y\322\307\254\305\3227=\365\\\320\366Lq\221\245\244G\304\216pMA\\64\263j\231\241Q\246\2732\364\245UP\3224\007_*\240Zd\003\002a\343^\2026v\371\002\023\240b\354\275\211\275\301\373\372\222\261\306\357\270\274\346\272\333(\354\210\354\306\007y\255\363jI\210=\264\225\006\275\254%\371\f\342\262\032S\276\232\005z#y\246\001\261\210_\353\205\017(LGwLu\"\214\177\216\266\202WgJ\344\220\221`\307\341M\b\302\254\3712R\275e\310j\257\205\304\311\024/\0313\023\223o\316\355?\216s\311\220\375T\345\037QZ#h\t\241\020L\264\221E\300\334d<c\254.Q%\360\271\300s\315\360\003\207\036 \307\360\361\205\264\354\177\211.!\256\234B&"
+	.string	"\336BVF.S\020\270^\206\250\2161\r\351\210\232\n\253\367\203\206\336Bh6\320\362#\324V$\220!\212(H\273\361]\360\222R\265\367\343"
+	.ascii	"\335w\020(\211\363\2251\226\301H\321\335\357\\\233\033\352\003"
+	.ascii	"\276\022\315\364:B\3772M\311\201\317\227r\022\310dA\341E\243"
+	.ascii	",~\016v\207\257C\020\344\300\366\233_zV\364\320\213Mru[\262\232"
+	.ascii	":T\373\210\261\302c\216\351@y\325}aI\022\314\365\225\327\373"
+	.ascii	"\262\342\320\377\361H\203\323\025\315\276@\216Z\264(\227\220"
+	.ascii	"\341]a\311i\2028\346\370\213\234\301\236\343>\317\t\203R\363"
+	.ascii	",\303\2735\003;\307\257\340 \004\207N\021\223"
+	.string	"_\231\236\326\336\034 \025M\342\032.d\036F'C'\305\326K\302<\027\310\362K\260u\233\002i(K\023\227\210\255\2123>~\250\227\321\334t\032\227m\021\340\352\203\211\002|\236G0\374<F\007\327u\357w\204Z\216\237\2561\224\247\321\235\030\\\372\354m\237\217\351\005-n\250\034?C+Kn[\021\336~\364\372\260C8\301l\374\037z\310\325\234\315z;\200\027\366\327\373'\373\326\033\223Q\211apx{1\314\246V\001|\250\345w\327\021\300*\035Yrd\263\306\365\033%\307\225\337k\337\376\036\371n\016p\355Si\277\036R\241\230T\250\267\277&\360]\n\375Sug\210;,q\376\301\334\372C\246\331\016t\365~V\262\005Qs\267\274my@\210d4\215\371\222\356:J\312-\207c\251\373\211\363T\2445\326h\027\200\361\2646\243>;%]\025w\340\r\007\034\352\013|Mc\362\365\021"
+	.string	"\207\037\231\206Hf\375h&\346\220]\2633\327\241\256C2\213[\210\017\264,\354\354\002\334\351\231\341\030\357\213\354\031\221\t`\362p\251\246gk\013~\372\177:o\031\274`\2173\365\340\345\023\013n|\376\034}e\336\246\"\321\237\024\003e\313\270\272\311ru\2137\b\006!\254\357\215\f\210\007\376/\314\\J\202y\332\304\351Q\257\234\321x\2011R\314\353;\251d(\212\306\b\217\216\022[\251\232Z\220\b\356\343\355x\361h5\346\346\032"
+	.ascii	"y\"\225\237\232:\200\016\024\212\220Q&\252\f\201O5\215\324\241"
+	.ascii	"j\034\252\270\365\261\037\314\225[\321\205/\225\007:X\262\337"
+	.ascii	"\3730\212\313\341<\333\255\212\265\341T\3021\355\f"
+	.string	"\205.kB\351\363\344\"\036<\b,Lb\211\344\347"
+	.string	"\302`H\367\253\f5\227\335\277\352L\236\332\272\243\330\032\243\245\303+\3218y\325|Lt\223\233\351$\257\370\377\366\230\2303\035>q\243\257Q\230\352\304\377&E\032\275\004sY\375\033IZ\334P\025j_\220c\212\324xhmP\243\372\253\"Dn\322\372\007\370\227O*\321R\204\005z\3464\257\033\322\306jr\247\\\332K\006X\367\306G\177N\325\221\346\377@\232\320R\377R\371\320\271!\307\215\237\310s\235\024|E\230\\\237\034\240\241\362W\357)\343TO,\344\005\375\206\013Vb\225\260\276\260A\313}I~\345\033\305\251\354\340\177\223\216\322\205\365\362\320\335:\265\013\032\212cZ\313\323v\225hq\354\221oN\341\245\373<g\362W\370\262d\225PF\2233\211\212\027Xg\361\3343z\265\326\347\304R\372\211\265\327\036\200l\034&\227\232\264b\247\017\007f\320b\022\274$\035\301\031T\007"
+	.ascii	"g1n\357,\001\272n\210\321"
+	.string	"\234es\224\246\311\255\2552RG\326\344^\363\3469\003>\013\244Z\217\200\372FwVQ\332\177x\001ot\006\333\220\225\346\f\330\267S\365\376\361kiJK;d\275\037P\247\246\224\020*\2175\262K\310m$\244\307z\203\375\344WH\226\025\005\024y\336\254$O\267\255\222\200k\353\2014\260\216\340z~\331C\302\373\005\021\"\357\244Z%\021\303ak\316\3234K5\262\206\263\210\n\304\247'\252\201\236\273\002\266X@\366\0131\306u\023X\023\350\207l\377\217\016_\013\356\332Fg\334\242\t\361\3762\3550\314\270y\303\330\336\223\306g\253\2029\0077\364co^\357i\263\233\305<d\224F\344\007\005\270\035\261\325\304\220\r\215\023\347E\276\002)B\020\207\017\227\213g\3349l\215\236\020E\337\231\247\207G\342\\\231\235\350\3411~(\022\352\036\362\031\273\200\375\373\213\351\020\214\240\301\314\030H\356\245e\272"
+	.string	"\023\234\005\2436\277[X\223\355\316\017\330B%\030rBan6\036\025\t\213\335B"
+	.ascii	"1\372\246\202\"L\347\350\331\271\2768z9'j\336\263\333\231#/\303"
+	.ascii	"\003T\366\024^\016\273"
+	.string	"\2257R\263\356\310\375\317\250!\311\007V\tPT\345\356(4\026\373\3657\3073\344go\031\3173\224T1x\025?K\330\021\357!\034L\323\037\316\272\201\240\275\272\206\371=\320\345~\326(\211\036*C\217+(\332~\324\347t\257\317\177F(\341\337\216v\276,\024u\022/D\\;;\325J~\034\211\n\023\200\372\0134\340,$\2538\226iH\226\320\366\007\273\225\003\352\377\315\222\231\330\303X\246*u\204\232W+3\321R)\254\242\313\200\347D\017$P\237\223\376a\232\271|>O\206\352\276U\367*\020\365\033\360)\001\335\354\343\313\3744\243B\025\340=\271\331pK\243J\220\235\036\037*\021d\302\206\335\331-A%-\b\215ML\275\273'\331\006\034\032\304\355\227 \004\211\331\265I\345\007\242\305\016\367\211B\362@\217\n\242\360JE\216\021>(|>\251\355Fc\210\357\0061\244~\205O\260\244\026"
+	.ascii	"\250\264)\017\340VYm\025\177TKd/\357\016y_\340\261N\265\304\353"
+	.ascii	"\013\210v\022\206A!\027k\237\314\030\321\254\331\273\340\265"
+	.ascii	"B\225g\262Fd3\204\n\253s\t\253J\237\352\333\277\314\006\2228"
+	.ascii	"\200D\030!Q\375\200\303\212\276\026\202\271\256M0E\2301\207\237"
+	.ascii	"h\036o<\314T\240}\016\343D\214\314W3%8tLrcW5$\fD\343\013y\234"
+	.ascii	"2I\242\202\"\233\250k\324\016\271:\237\372Z\235Y\353\3646*\\"
+	.ascii	"-\3017\n>|]\232q\332\203\257\030n\355'/\326Y\240ud<5q#\345.c"
+	.ascii	"\026\331\215T\307\354\367\342!\3563\345\357\314\177Q`M\365N\202"
+	.ascii	"s\324\351\251d\036\201\031\210\344\2445\317\027\177l\315\343"
+	.ascii	"\343p\360\341;om\262F\355\202\335\021\317\257\314\275\003\334"
+	.ascii	"\375\335\025\026=\003\360\t\211\355\226\257<<\260\267\t8\224"
+	.ascii	"\336\004o\207\333\341\352\361\241\334\371\334[L'\230C\366x\032"
+	.ascii	"\206+\260\"4\\hP\363\353\365m\312\203\302:\342\345^\347\264G"
+	.ascii	"'\370\311\0239\267\377%{*:\013\276\026\023\373\314\365oJ\347"
+	.ascii	"\2612\024\306\036\371\217\r\361\007\377\326\230\007\352\243\261"
+	.ascii	"\001\204\306W[\030\037\226\237\346\263^\224\367\200\350\357~"
+	.ascii	"\036s\370k\363\\\341G:\365\262W\350F\373\233\307\351\345\334"
+	.ascii	"\245\354\262\b0!:\305\300\342w\236$\216\374\033\260\312\2055"
+	.ascii	"m>\316P\023\031^X=m\036\215.\375\003\3565\245\247^\342\030yp"
+	.ascii	"\036TF\354G\261\025\3015\277\356\013\206\236K\355r\033\340\245"
+	.ascii	"\361\344T\354\311a\271\334\342Z\323F\255\335v5\356\265|W"
+	.text
+	.section	.gnu.lto_.symtab.62932cfd9c98698f,"e",@progbits
+	.string	"handleLtmTelemetry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\002"
+	.string	""
+	.string	"freeLtmTelemetryPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\002"
+	.string	""
+	.string	"initLtmTelemetry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\002"
+	.string	""
+	.string	"configureLtmTelemetryPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\002"
+	.string	""
+	.string	"checkLtmTelemetryState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\002"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\002"
+	.string	""
+	.string	"specialColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\002"
+	.string	""
+	.string	"modeColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\002"
+	.string	""
+	.string	"colors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\002"
+	.string	""
+	.string	"telemetrySnapshot"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\001"
+	.string	""
+	.string	"GPS_home"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\001"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\001"
+	.string	""
+	.string	"rssi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.string	"telemetrySharedPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"telemetryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\002"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\002"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\002"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\002"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\002"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\002"
+	.string	""
+	.string	"determinePortSharing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\002"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\002"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\002"
+	.string	""
+	.string	"telemetryDetermineEnabledState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\002"
+	.string	""
+	.string	"telemetryCheckRxPortShared"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.62932cfd9c98698f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
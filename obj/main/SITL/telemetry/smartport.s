@@ -0,0 +1,1915 @@
+	.file	"smartport.c"
+	.section	.gnu.lto_.profile.349192fe9412b535,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.349192fe9412b535,"e",@progbits
+	.string	"(\265/\375`0\004\345\021"
+	.string	"d\024$\005"
+	.string	"2"
+	.string	"\264\345\206\245\002.\002"
+	.string	"\001\003\002\003\004\002\004\002\005\002\005\005\002\005\001\352\263\360\321\b\002\003\242\302\263\302\013\004\005\006\240\342\234\212\n\007\b\t\n\223\200\370\250\004\024\006"
+	.string	"\007"
+	.string	"\002"
+	.string	"\013\f\r\016\202\333\245\355\005<\b\002\t"
+	.string	"\002\n\002\t\b\002\t\017\020\021\022\023\024\262\223\326\254\006\n\002\013\025\353\244\313\346\t\b\005\002\005\026\352\322\337\327\t$\002\n\002\f\r\002\r\027\030\031\032\033\221\332\200\244\004\016\r\002\r\034\235\307\215\326\n\n\001\002\001\035\036\212\375\214\372\001 \t\t\002\t\037\301\265\207d\006\002\016\002\016\003\002\003 !\"\264\323\233\314\007\b#\301\206\307\333\b\004\002\017\002\017\002\020\002\020$%&\231\341\314\324\004'\312\346\352\224\005\n"
+	.string	"\002\021\022\002\023)\270\237\251\345\013\004*\215\356\376\354\n\006\016\002\016+\366\271\244\326\006\004,\241\350\333\275\004\324\001"
+	.string	"\002\024\005\002\025\001\002\026\002\005\002\026\027\002\030\002"
+	.string	"\021\031\002\030\002\032"
+	.string	"\001\032\002\033\032\034\035\002\005\002\035"
+	.string	""
+	.string	"\004\002\r\002\r"
+	.string	"\002\036\002\036\002"
+	.string	"\002\037 \002!"
+	.string	"\005"
+	.string	"\002"
+	.string	"-.\276\225\250\364\n2589\240\342\234\212\n"
+	.ascii	"\200\207\250\261=)\0329i\2451p\202RV\344\006\021\360X\242\234"
+	.ascii	"\033Ii*\205\366\r4\262\214~A\226\023\217\355\3662^\375\007\023"
+	.ascii	"7\271\030\2258t\001U\231\025\201J~}:\277\202\306\037a\377\227"
+	.ascii	"\363\r\307'.3\276B\306\241\031\007\352M\016\260s\324\006\257"
+	.ascii	"\321\302\267\3006\367\332)\315$\371\270`\324\nq\027B\032\261"
+	.ascii	"\033q=/q\332t9\252\315\220\032\231R\315uH\033JE\\6\234_u\344"
+	.ascii	"\2442\202\260G\214\211C\036Tam\020\307_\246\035\0023\250\253"
+	.ascii	"\233\215\321\322e\270\305J\fs\220\3577\240I\353\032\223\016\030"
+	.ascii	" [\3436\364\354:\2045\350E\243\232 \233\024\314\315P\270\005"
+	.ascii	"\372G\235u\375\3164&IJu\302\224\232\031\027\212\364\205C\352"
+	.ascii	"\246\244\334\245;\226\033b\355&cX\003?4`\226z\370\374\025e\""
+	.ascii	"\224[\221L7\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.349192fe9412b535,"e",@progbits
+	.string	"(\265/\375`S"
+	.string	"\215\004"
+	.string	"B\205\017\027\200e\032\0035A\023\230\2328\004\340<\0279#\357v\372-eJ\001\252\256\002\364JO\352\234T\212\024z\234f\t>\265g\226S\331~\333-YCv/\2065\370\0264\026\261\207\007\002% `\202\201\256z\020R\226aL\001\327\003\232\222\020\006\234\210\344\034\031\273\346\272\311o\307\324\262\270\211\240\001\\R\r\346\340\310\002\024\3169>v-\220\004\004s\024!\"y"
+	.ascii	"\001\026\335\tz`\315\205\305?\026\213\3034\022\207\031\203\266"
+	.ascii	"\246\0257"
+	.text
+	.section	.gnu.lto_.inline.349192fe9412b535,"e",@progbits
+	.string	"(\265/\375`!\006e\032"
+	.string	"\326#\200I\300RN:\302\223>\017\254|\253\352\003\235\311\253:\205\212\236\243\007c\371RE\250\334\232\333\377\346\034g\366\334\272\232\204Fq\352:\366\236\203 \350\264\2151`u]J!\354\026\253\262\314e\020\221\t\2205w\022Kv\222)j"
+	.string	"h"
+	.string	"j"
+	.ascii	"u\345O\277\036W7%M\311\225\331[\372\351d\246\257\027\246o\367"
+	.ascii	"a\350\264b\230D>HM7\005+n\352\246zP\021Li5u\23179QF\242\251)"
+	.ascii	"n\006\331\241\344\023M\253+\350\373\270\2076\207Z\253\316\026"
+	.ascii	"m\327\276PD\236\0028\231\330\313bk\257)\2626Na\355\033\034\363"
+	.ascii	"\302\314\022STK\023\354\021\003\240\005\317`\330\326S\f'\023"
+	.ascii	"\223\254\367^q\356\332\276\225#\fw#\256\252\257p\213\253JH\314"
+	.ascii	"\216\371V\257H\021\315\264\255\340\353\217\b\322\341\371\306"
+	.ascii	"\034w\204\255o\345\004m\347\204\366\314\224\302\352\020E\341"
+	.ascii	"\266m"
+	.string	"\337\257wfj\031\375\360@\260lv\337\312\2658A\203-\227\342\261\241\"4U1Ua\231Z4J\"\321t\003.\177N\004m\243|\367dh\2622\023\bQ\212\034\026hn\325##KB8\300k\021^'L\2209_?`\220\234f\2037%M\346\216\343s\264\223\371\244O\266L^\317\205\326\255\002\236\030d\371\344\375\244|`\313\223t\204t\334'\306\315\260\306l\317\276k\231p\366\232\335\026\033\265\266k\360\336x\301+\254wm\232B[\336\235}w\237\220\327\n\030\320\364\200\004b\306,\nS\256\200xA\"\023\016\245\337\350\007\272\2713\244\313\252\344\345P;CX#v0\346f\027\211\027Y27\bm\013\240\262}\271\017\237\243]\001\234\020=(\b\230\001\312o*\333r\247e\2555\346\232a\250\021\254\367V\276L\244\237$\235\224\262\312\213G\202\222\003\366\325Z\307\230\0371\355\324\240\331"
+	.string	"\005\035\200\235\250q\26523SS\222\242J:`\002!DT\347\001\022\240E9E\235\221l\206&lA\n;\373\006\002\006\030\362"
+	.string	"=\210\204\311\225\212\220\311U\302\020\017\214\271\376\206)(\331\0074\023\214pH\337\217\230\226\005-\002nj\370a\315v\327\020\034\226C \214\3639AG\203\327\236\204j\265\025\256\214\226\204\230\241\202n\354\\\253\243\314\243?\213H\371\3062\370\201\0257\313\312\013y_W\356\201\310\030\355|\313E\321p\t\303%\222X\201)^|\372\322`fW5\312\347\363\266UM\264\224\325\360\307L\0226\373\200!PL|\n\364)\342+\024\347\243\255\206y]!=\341]?L\256g\3033Tt\230\2631\233=\300X\254PE\013I\213\363\275"
+	.string	"\231}\213\365\321;=\244@\213\n C\256\342&+O\024\336\332\272\346M(!\360\373\377q\255\265\374@\243\221\377\374\321 \004M\fpw{\223q\332^\023)\304\3222\363\350\364\345\344\036\2674\362,{\310\3417\351\357\232\032(G\314\330\215\rP\370E\256\250\023\252\305\260S\\\376\347I\206U\372\237\252ct\032`"
+	.ascii	"\344Xyz~}\025\255)\254\350\0264\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.349192fe9412b535,"e",@progbits
+	.string	"(\265/\375`F\t]\032"
+	.string	"F\"kA\020\261$\035"
+	.string	"\322\217\3005Q\376\302\n\353z\021\221\334X\266\":\317r\260\367\007\350@\247\300\001\322\306P\005\nR"
+	.string	""
+	.string	""
+	.string	"\310\302\007c\303\022k\231\0055\205Ju\237c!\333E\324\276\255\334)\245L"
+	.string	"Z"
+	.string	"Z"
+	.string	"~[\342\247\2353\316\265n\367\364\344\220\035\362CS\332\233'~UN\362V?\177\024\204\\c\223\260\235h\032{\204\375\352\346\270\333\317ub\332\t\302\335\356zZO\323o=\215\303\266\361\243m\036S5\246\334\276\364lvA\372\341 6\306\340\265\212\t7K\212|\311\2316p\3071w\030\002\276\371\222\033n\026\027o<yk\023\235K\370*\013\336p\344\276\215\240\252D\236\245\0030\207\261\t\037QP\260%\260B\343\334\022\256\274\247\b\3568\200\207\247\205G\256,<\322A"
+	.ascii	"\"\373\002Z\322O\177\027\307\035m\022\025\n\037?\331'#\275Yx"
+	.ascii	".9*T\205\272\234_\370n\357\201d \231IE\357\275\347\022\222v\304"
+	.ascii	"\303\227\253/w{\2709/\270f\2035\033\314)\343\216\301\275iP[\223"
+	.ascii	"\210u\374\227Dr\266\270[m\266\245\266!\024$\330\357yE"
+	.string	"k\023\264\247\f\356\204c;K\r.\355\263\311\325\246\224\267\367\306E\326\230\030\323\233\361\340\365 \266\234\330\221\331\221i\271A\264\r\377?\b\004\252\021\341\341\006\250\302*\f\261\242\367\354\231\350\311\b\360h\370r\315=U\252JaX($z!T\be\227\n5|a\030\f\377\006B\204\3040\206\345E*`\3359ve\035=r\376X\257<r\r\200\312\250\361L\252\212D\013\222\222\024\2065\220\002\021\242*\326\001\021\220$K\020C\312\210\220\310(H\222\222B\206\003I`\341\304E\357`\210[3\341\361\220\376\302\344\001\253\365\272\203&\363@\361'\335yJ\001\313\300\256*i\021h\374\032\371\206hEM\372a\b:E2d\021\311z\223\363\216\307\350\353\017\002.\"\007\351F\240E[\224|)f;\3372\301\017\372{\346bg\3721\310\313\255\300#\036R\256\332\317\320\225\222\320@\366\361\003p\274"
+	.string	"\025\361V\002\3747S\245^\276\240\324x\247\217\305\370\301\365PA\003\240F~\260\361\300\344'\002\370\f\031 \355\002j\373\265~\241de\204\355X\354h\335\257\246K\035\005\tzh\200`V2|\2171\230\260\306F\"\221\215p\364\347\251K!v]\202\367\204^\211\254\3052\242\206\t\304/\036`\365?\324\220\315dnKv\217\034\216\231\203\2305\337\361\366\3363m\373\233\004A\226\3302\303N\361p\324\257\343\001\207\026\325\316\367\032\207\344\037\013\377l\n1)\324\240\223/\003\342\310\343%\226\200\246\2227\312\b\304\035\3338\026\264\025b8\237\306\3239rz\ba"
+	.ascii	"\263\276\315\2554\324c\205\270\007\250\211W\004\233[\241\247"
+	.ascii	"\206\225Z<q\266=\267h\300\260UX\350\203 I\204\232*\261ex\001"
+	.ascii	"\257\013\264\364\211\303\277>{\243\300\225rfc\001\266T\226\021"
+	.ascii	"\363\030D\315\035\034Z\245@Q\021\342\002\272\262\233@x;i\312"
+	.ascii	"\002\357\030"
+	.text
+	.section	.gnu.lto_.pureconst.349192fe9412b535,"e",@progbits
+	.string	"(\265/\375 ;\331\001"
+	.string	"7"
+	.string	""
+	.string	""
+	.string	"\022"
+	.ascii	"\232\004\n\232\004\016\231\004\024\232\004\025\231\004\026\231"
+	.ascii	"\004\033\230\004\034\230\004\036\231\004\037\230\004\"\230\004"
+	.ascii	"#\230\004&\230\004'\231\004)\204\004*\230\004+\230\004,\271\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.349192fe9412b535,"e",@progbits
+	.string	"(\265/\375`-"
+	.string	"M\004"
+	.string	"\222\206\020\022 54\034\033Lh\261a.\324/\025\237\353I2\005\352\016\033\272\311S\262\213"
+	.string	"\030\213\365\\;\3634\n$\302\203z\252\335c\027x!\257\301\202\023,E\267\211v\351\231^-~\234\236\r\004.\021\036"
+	.string	"1\333P\005:\b,hH^\312`Su \340\247\316@\260=\343\273\212"
+	.string	"q5!\032\217\200\345n)\0138\013\203B\210c\3613\254"
+	.string	"D\003\324\270\260_]\232\231"
+	.ascii	",x\231b\027\314f\340\005\030\002"
+	.text
+	.section	.gnu.lto_.lto.349192fe9412b535,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_frSkyDataIdTable.110.349192fe9412b535,"e",@progbits
+	.string	"(\265/\375`\030"
+	.string	"\255\005"
+	.string	"\002\310\035(`o\032\003\237|\342\3621\354|\244\237a\200@`\241\221\350V\020\004A\320r\274\020Y\203\331\355\035\344\017\022\332d\247\035\360\307\220#K\236\334M\271\262\345\313\2303k\366\336\314\271\223\330\363\347o\320\337\241E\217&]\332\364i\024\342\324a\021\275\332`(\246c\272SYE\231Y\327[\005\304\235v\202:XL\343\262J\b\2546\271\202a\347\333\364\332\202C8\026\036"
+	.string	"0c@"
+	.string	"\270\007\206\201+0\347\300e6G\244\334"
+	.string	";\320\330\215d\204\203\201+`\016\\\006F\300]\320\020\b\006F\300]\320\020\b\003\327@\0230\005\277\334H\261z"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_smartPortDataReceive.128.349192fe9412b535,"e",@progbits
+	.string	"(\265/\375`\326\007U+"
+	.string	":IL\020Fp\252\325\030N\036\322A\203\307\021\252\n\023]\300M\f4\t\257`c+\025\204>\323y\374M<# \316\203GdU]\261,D\031h\232\205\241\203\216U\227\242\255\312\005\030\331.\270+K\210\224RJ\231RJ\001\362"
+	.string	"\334"
+	.string	"\372"
+	.ascii	"\re\351\007\245|\215\025\230\230I6\337W"
+	.string	"\311\240S\016b;\375\241\356\314\235l\256\246n\302\304\351\373\362\b\203\345}\225\016\030\002\333i\256{j\247\336;\265Snb.k%\220w\305\322\032v5\337\367\005>V7\265\257\307\333\351zr\270\233k\253\321ZvUS\364\275\211\233ftj_O\213\210\363V\241e\357\206\264n\210\020\357\311\n\3429 \215\003\262\303o\024\234\270\rV<\026\330*\352p[\201\332*Dk\260\"\216\033\336\352\260\306\300a\253\266\212T\276\242\021\242\2329\032\254X\205\332\354\f\305j\306\241\253\rV\314\201\376\336\367\255\031\245<E\027\034\305\324\270\031\243\320\336\031+\262\336*j9\032\224\304\222<\3631C\253\037\r\242b\274r3B\241n\222\262\255^\266O\031\205\356\253\320\373\276\354D\343\214f\237f\356\027\314<\201y\265\005_\335\357b\271&K\277\202c\326\221\213\352kd\201\341\006}d\222\312m\245\257$\265"
+	.ascii	"\001B(\326\354)]%\304\272ELI\023\251\334^-\205\210;\213E\230"
+	.ascii	"\360&v\312mB\355t\265*\3234{\362'\263\321\222S\374G\262\263\231"
+	.ascii	"T\240\007\240\343\316r\f\312\355p\316\231G\024y\023\177\276\227"
+	.ascii	"\335\032\251\243<{#|'f\245\223?\222\271\377\371|>\371\257\230"
+	.ascii	"\177\335\244\033\250\2414\377t\223f\037\327\331\347:\367\\g\236"
+	.ascii	"\353\274s\235u\356\334\343\3169\327\031\347\3167\326\331\265"
+	.string	"9\333j\3165\326\231\266:\2676g\266\346\274\262\316*\353\234\322\234\321\326\371Yg_\235;\b\001\236c\016\254\"\317T\2762\236x^3\251\226\"\r\245UO\035u\224\271{\311\265V\366\223\246\277\267\340\244\316\320\206P\302\0314^p\355\007\227k\350\264O`\207\331\221\213jlY\205\310\355\221p\332\214\205\025\236\001\257\361\206\233\247\3178\235\344\204\331\222\3247\353r\316\327\215\263\252\332#\231I\345&\3536L+.\\P;M\303\314\224\230\271M \005\221OMV#\341z\022\343\254\317\255f\250=\302l\276\357S\023\271\3234\023\003wV\247\234ahH\355\224}o#\205$\375\365{\350T_\254\211q\312t\372\352\267\324Q\350O\260\364\33307g\254\200\tCHs\031\034\3574\237\242p\264\217l\"\225LK\243\354\347\271\303\264\230%\r\0336\250\235\266ae\356\023/Yl/\251\350\373V"
+	.ascii	"\377g\346\320\301\233\210\376\017\252\273\264\227#\017\037>\250"
+	.ascii	"\235\3767\b\322\002\204Z_\326G\n\030pdv\324R\214\227\352Ob9\266"
+	.ascii	"\305\177\265\"[\342S\303%2\322Gr-\220R|Qs\321\003\245 \222\n"
+	.ascii	"\245\340\210\243\025\300\245\240\222\321\221\021\n#%`\212\023"
+	.ascii	"#\216\200E\301\025\300\007\005\030I\205Q\020\250\204\204\024"
+	.ascii	"\004\326\224o\013=\275\260\321\367}_\237\357c<\233I\355\275\357"
+	.ascii	"5\204\r\251x\277\373\036\273{\336k\b#\345\024\352~G\324}*fe\t"
+	.ascii	"\225\2011e\224\336#\231u0?z\310\t\033\323\265\305i\2127\254p"
+	.ascii	"e\346\2304\333yTR\223\023\0205(/%f\266*.\030\272Gr\317\337\276"
+	.ascii	"}|?\233\271\250=\337RFp\237#\363'\334\377\004\241\272}\212$\312"
+	.ascii	"\222\351\345<\360\206\212\217"
+	.string	"\236Gr/{\210\351\034~\341~\317\350\r\350}~\252m\"\225\366\003\256\216,\307\334\022D<b\034\237w\277\025\353\0222\275\234\265\347v\016m8&\217\311<\266w+\3765\332\035\177\332\267W]Bf\224\2430\367u\366l\376:\201\n\364\001\200\253\250a4&\021C\252Fd\202\244(Ic\200\002\021\251\263n\021p=c8R\265g\362\240\276\361\276\004\346-!\264\017)\351%C=\313\333\217\031z\244\033\3267>\372\253\033\230\213&\323K[\342\n\\u\367\327I<\226\2020Up\203\036\"\225;\022\351[\254\231\022\362\035F&\212\bC\275\271\231\271?\363|\246'\231\372\031\210\375\304\362\374\344\314JE\212\302n\030MT-I\205\363.\257\306\236j4\307\340\264\210\370D\214\324\277\337\375;\205\201>\226\334\006\250\234>m[\325a\270\341a\323\2514\364M\032\237n\307s\277g\316j/\363"
+	.string	"\221\006CX\236\303. y\017\313JZFv=\346a\036\f"
+	.string	"\325\230R\215\\\321]\007A\331\024\322+\366i\0059e(v\210F\002\310\265%I\235/"
+	.ascii	"\330b\301\f\343V\352Z\243\255[\343N5\rxS\301\252\377\226~\212"
+	.ascii	"\227#\022\016\240\306u/\030\025\035K\2713\325\325\370\0313!d"
+	.ascii	"\0135\265\334\2130\300\255~ \3528\b.\240\374\250\261\3330d\251"
+	.ascii	"\373\271o\314\303\033\202\024\262\242\211/\013\033\346\237\276"
+	.ascii	"\027\326\251\\H\031\220\033K\231o\301\336\013\375~\224\003#\030"
+	.ascii	"\374\020R\212\344\256\006"
+	.text
+	.section	.gnu.lto_smartPortSendByte.129.349192fe9412b535,"e",@progbits
+	.string	"(\265/\375`\221\002m\024"
+	.string	"\026&\206I\320\322(\035\323\236(b\204DrP\2426E\202\254\025X!8o@U\016+\271\013\n\023\\C\245\2261|\265\333}p\334b\277B\257\372\006&\270\202d\200\272\366!'\316\315\305e\215\360\026\237\204\tX#\233\020)S\nq"
+	.string	"h"
+	.string	"r"
+	.string	"<J+\343W\362 \352*y\320\252\366J\003\331\203h\274s\342\206d\3149*\360\002\324A\313\354\036\037{f\350\343S\3431\3159Y;\342\262\207\022\374Ve~\315\303\017\227\037\203\024\031b\220\334n\276\021! 'j\n\346\374\003p\313\371~)G;J$7\233\257"
+	.string	"\316\006\316yW\r7\232j\3102\347\264\332n\035n\324m\213\266\037\330Z#\372d\2175\2729\373\337\\\036{u\242\372\3566\371\370\227<\350O\205j\221P\215\222\352P\325R\252AU\177\240z\245ZA\365\007 "
+	.string	"\302\205\360!\261H\343\334\360$d\346"
+	.ascii	"\211L|\367\333?\317#>\213\353d\337\311\240\314\306\311\001B\217"
+	.ascii	")\210i\3161\301A;@\035\f\240W\311U\373*\276B\366q\346%s\006K"
+	.ascii	" \267\244K\262\321 \240\334\220(\\\271\022z5\247\231\226\260"
+	.ascii	"\341\216>\247\364[p\b\\\021\235\335o_s\232\351\223Qn@\246v7\302"
+	.ascii	"R\315CJ=\344.\222\272\366K\005\275\315(\030\266\306\276\320_"
+	.ascii	"\304\370?~\301\364\266\203>l\027\307\250Ig\366\031?\216D\354"
+	.ascii	"\346N#\277\024t7l4\210O;\215L\355\367\274\247\3700\242!\265\300"
+	.ascii	"\321\002-\261\2650-\261\365\265\356\226JL\204\301\304D\227W\f"
+	.ascii	"kF\214\271^.\013\256\030\353\302\213\313\213\325\022cX*\007\f"
+	.ascii	"\203q\211\254\030\f&\262F\306\371o.\217YfK\013W\253<\026\305"
+	.ascii	"\216\246?]F\236\354j[h\324tNP\252\025\331\226\336\215\223\311"
+	.ascii	"\242V\265\277\301\321P\273\002\303E\315\351E\023d\004\364\314"
+	.ascii	"9\377c\262\253\003\207\016\251\007bw\200vIrs\236\221%\0011 \240"
+	.ascii	"\002\031\261\342\003Bh\305c\204\270\264j\257\334\206-8\344\021"
+	.ascii	"\007\367\317\215\342\272\360g\007r#\260:\341\305\220\350\262"
+	.ascii	"|\344\340u\244C\373\316\006\357\306\254\324l\231\345f9j\225\275"
+	.ascii	"\3530\223\266\265\305[I\303nl\346V\341x\366\3602\203\214\213"
+	.ascii	"`\016\214HhG\346\346\236\032\241\024\201#\276V\274\360\373\266"
+	.ascii	"y(\224\2451\2365j\\\020\n"
+	.text
+	.section	.gnu.lto_smartPortSendPackageEx.130.349192fe9412b535,"e",@progbits
+	.string	"(\265/\375`x\002}\024"
+	.string	"\206'\211I\300\322Q:S\005\233a\211\230Q"
+	.string	"\025\031\352\224C\217\243\213\212\311\215\267p,\222q\252\361\223q\330\222\267\266\343\217;\247\353\233v\352\306\224\231&\001\006\250 \210]\250\203\263\036\"\202\200\204\246\350,\337H>\331D\312\224\002r"
+	.string	"k"
+	.string	"y"
+	.string	"\265\2173\0270\347O\225\203\361'\341\245\370\001\341\245U\355\005\fj\027\242\361\316\351cCi\316Q\305\t\304K\327\354\250\217$\346\252\304\013\034oj\316\331\332\021\016\017\2167\250\265Kp\265\346\363\256:;l\227`H\016\f\026"
+	.ascii	"t7`\003\250\023C9\335M\301\024:\337\373\2562\240nM>\235\316u"
+	.ascii	"\025a\316i\305\321\345\334\341mg\260=\301\326\240\373c\233\224"
+	.ascii	"|\374I.\364\217\274w\207|\274EU\257\244:\224j\031\252AU\257T"
+	.ascii	"\253\252\177\362\036\246)\036,\2779=\374\202L&\031\003\305{\377"
+	.ascii	"\356j\337\276\221\357kq\027\265\367RD\333\007\321\347\264$5\347"
+	.ascii	"(A\274D\001\177\236E|\242\027\325\276\223\021\247\222\210\353"
+	.ascii	"\321\220\232S\t\301\245\037\210\227\001\324^\265\277\342C\001"
+	.ascii	"5pI"
+	.string	"[\262\006\225d\305\315\221\330z\340x\262Q \367h;8\347\234\340\002=%\fY\223\375\016\322\f\r>7\375\035\255\356\356\221\222^hL\3703\2737r<\n.n\311\336\367\0036PEMFA7\375\355\252x\362\001d\315\322\033\235\027\023q\276\266\f\203\036\307(7k\363\310~YHI\270\252\313\204\337\235\200\b&\037\241\0375\372\263G\233.P\017D\207\r\016.\177\315^\353\242\271Z\300\026\n\260\230kfa\345\327\nm&\203\241\315\\\261\230\326\314\214\006\213\301.\300h\255\027\027W\254\365\232\305\264V\nX\006\003\233\265h2\331\254%2\316\357\217e\017\023\225T\315\336,\003\316\031\002\302w\277\024\221\376\314R?\026\256\302]\255\n\256Jn\270\253\003\307\003\256\334\177wp\317\273\201\034QT;r\201\314\202;Z\223e9-\341\222\324\271\373^\201C- \220\202\031\262\233\007b\3004\317"
+	.ascii	"\037\274\\\213\2711w\2654a\277\302n\t\365\230B\032\030.\314\231"
+	.ascii	"\261\206\263`\251$TynP\311=\204\006\026\314(\314\307\351\230"
+	.ascii	"1\322^k\307\215\205t\bu\004cd1\361<!\277\257\300\226\004\313"
+	.ascii	"/\256\307`\317\375:\336\270\314\217\033\356\325h7c\265A\207$"
+	.ascii	"\362\272\304\023"
+	.text
+	.section	.gnu.lto_smartPortSendPackage.131.349192fe9412b535,"e",@progbits
+	.string	"(\265/\375`0\002\005\021"
+	.string	"6aqE"
+	.string	"\261&\035\331-\346\233,~J\235?\374\377\260\351\306}\317O\311\002\231\334\315\312\035"
+	.string	"=\370\236\366\257?h\241Q2\001\204J2\251\240\364\326@\020t\036x\036\003\262!3\020\346\230\345a\315\022B6\2212\245Z"
+	.string	"X"
+	.string	"_"
+	.string	"\007\036\255`{\024\3114|\t\3607-\016\355\312\264\022l\217\004\260L\373#N\002\274M\005\307]\016=;\273!\002\213l\217\037\017\220=\346A\262G\203v\215\2074\253\325"
+	.ascii	"\241rZ\273\313\251\207\203O\320\277\352\241T\214\313Sk\260\273"
+	.ascii	"\316T\214\206[o\333\200\355\005v\232\bO\341\030\351ud5\003\345"
+	.ascii	"z\311\227\035\272\244v\260\217\355\356Zg\354\337\374\244\333"
+	.ascii	"\374\243\230\026i\351PLoZZ\213\351LK\307\230\306bZ\263t\306\364"
+	.ascii	"\005|C\330\272\361\200\265\213\341\325c}b\013\020\327\371\355"
+	.ascii	"_\345\221\217\363\034\360:,\333\206pPC#h7C,\326\246>\214\307"
+	.ascii	"\3004\335\364?\037$\325\224\204\245\312\324w\361\027\0325\323"
+	.ascii	"\377\240\\/*N\322\250$\253\027\246\376\316Y$I1\035Y\355@\271"
+	.ascii	"T\375\025_\241$\220\237\252z\224k\273y\262\221\246\216\254l\\"
+	.ascii	"p\301\344\313W\037\305S\240D\320!\342\203\257:E\234\034\255\324"
+	.ascii	"\243\337e\217\001&\245.\245\245\244\242\245\224(\250\311I\272"
+	.ascii	"$\344\363:\225\317+\235V\270\026\3573\235L)\246\217\233pR:q%"
+	.ascii	"\336\n\027R\300\235\212\311\343\276\256\363\270Q\270\307Vg\f"
+	.ascii	"\201\207\317\213\302\230\005\333\225ap\235?\350&_\006\220?q\325"
+	.ascii	")\204\206\347\266\204\223|\312 :|,\250\213E\352\367\\F\f\251"
+	.ascii	"h@H\277' \300\202\021\242\343\006\243\320\255\306\330C\006G\233"
+	.ascii	"\3038\013\371(\327\241\r\346|\215yi.\316`\016\266\371\022\343"
+	.ascii	"s\310\236\373\3014\337\352|\320\026\215\352\n\030\003\357\202"
+	.ascii	"7\007bgF,\001aw\363\3068\3542dn\273\313g\255?j\033\003+\324\320"
+	.ascii	"-/\004A\006"
+	.text
+	.section	.gnu.lto_initSmartPortTelemetry.132.349192fe9412b535,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"e\b"
+	.string	"F\220:6@o\323\001\233\222\\"
+	.string	"pm\332\200\357\242\342\340H\007\260\26652\264\365\310\226\340\365\215\211\355\277a\216\355\204\b\\\3533\216\201hIaR]\020\036\"V\312\224\002("
+	.string	"+"
+	.string	"+"
+	.string	"\257\274\331+\367<\366&/\026\244\226\335\205\332\361\355\271\371\017\271@\027\342\236"
+	.string	"\t\273\353\354B\030\267\3366\202mh[%T\032\034\202\262#>\371\356: \n}\024\312\331\036\227\312a\037\263:\2623\235O?\200@#E\241\264{Qr\331o:\001\261\035$/\261\256\315\206\372\244(U^\344W\273\001\313w\251\005\242\214\257B9_\375\221{\022\376\207\263\316\344w\250OI\352X@Yr\2662Z\3148Z\324`\036\370\211\332\205]\016\227\006\037\0304\030\264\242\007f\016\234q\256\b\265,\213\260\362\366\230\325\221\0276>\220N8\325\017\f"
+	.ascii	"2\241\317/0\\,\0200\310\305\\\315\013P\241\270&\"\f\201\274\f"
+	.ascii	"\001.\335\242\235O"
+	.text
+	.section	.gnu.lto_freeSmartPortTelemetryPort.133.349192fe9412b535,"e",@progbits
+	.string	"(\265/\375`k"
+	.string	"=\t"
+	.string	"\306P>8@\255\322\001\374\254 \226\330t\021\245\371K}\360\277\017\315NF\271\360\321\250ZG\246\231\331\235f\004k'!T\3038\370Ut\3025\016\315\347\217\221>:\262\375\367N)*"
+	.string	"-"
+	.string	"1"
+	.string	"\366/&\331%\177Y\354A\036\034`\262\335\245\261\342\244C\222\177\214\003|\247\322\241f\260\273\206\337)\342\216\267M`\233\332\017\b\276\312!\021\374w\351\213\346\345\243T\265P\256\t\023\234\331\257\022\214\024\366-\033S\366\241\257\235\265\222\241\034\230\354B\314VvD\212\\8\367\370\307\206\323\351\314K-%\244\305M\237\3430\256\373|\346e\201\212\004\225\021\373hnh\022\035\262\330\204\217\266\302\002\374g\201\206X\262\357\272\306(\326`\274\332y\274\232\341@4T\275\215\333\0206\217&p2\034\325T\020\305\f\270\363l\225z]W\351\345\265\267lLI\326J\345\304\024\031\354o\246\003\021"
+	.string	"3\241#(p\363\273"
+	.ascii	"l;*G\2442\202mSd\257B\017X\257S\254\357*\013]\303\375B\360\227"
+	.ascii	"q\301\245[\264\363\t"
+	.text
+	.section	.gnu.lto_configureSmartPortTelemetryPort.134.349192fe9412b535,"e",@progbits
+	.string	"(\265/\375`>\002\315\023"
+	.string	"F&\206I\300RN:\342k\354O/\213\354\270C\315"
+	.string	"\364\343ni\254\340\237\034Zho\247>\033\341\033\016\204H\276Y[\363\265\321\024\331z\203\"'2\023\211"
+	.string	"#a\352\340\300p7\f.w\245,\364\241\246\266\215\220\275\267\334)\005s"
+	.string	"g"
+	.string	"r"
+	.ascii	"\277\r!\016D\270D\345\343\243\326\"\223O'\b?K.\200~\312\223\320"
+	.ascii	"O\337\354\036/\352\251g*\261K\262\252\265\3066\305"
+	.string	"o\007\351\224\033o\276\253\207;\030\2228\225\br\224\242Fz\035$\211\016\241\2359\342r\244w#Kj\255\257\036\207\270R\201\220\207\246\221\236N\276\224\252Z\234\350\021\247\267\213\021L\251\265:\362z!\356\360\2661\330^`\307[W\277\335a\2014\265\353\263\r\375Z8\232\272\211C\354\303\270\221\215\377\343\031-\236\367\351\323\350\347W\347\007\313\304PN.f\331E\272\270>\373\262\326Z\275<\366\1777lF\273\300\350\026\215\016g48\243\251\214\236\033-7zc\364\003\334\205\224\325\017\226\252Z?daU\251\371\264\342\277\337\376\211\374\362_|\350\366\266\004\226x^ke\325Y\234\355\to\242P`G\255\025\305G\322P\001\245\247\326\032.\030d\343\352\007.lc\224k\351\202K i'B\027\263<\227\356wEr1\313\237q\271sM\210\354\236tn9\323\222\334\013Q!\347\372\342\235n\240"
+	.ascii	"\222\313\343\313\350.\200\"G<\354r\031\262\260\326\033\024?\351"
+	.ascii	"1^\374\237O\303\304\304\320\317]X\020T524\030\333\314\312\313"
+	.ascii	".'\266\032m\306Vk\231\325\3042\324l\262\231\354\202\314\026\223"
+	.ascii	"\201i\231\305\\j5\261\223\003\246\315\310j1\033\215V\213\275"
+	.ascii	"\212r\2275%\267:\320@\264\0314\210\347y\027\347xb\t\310\211\256"
+	.ascii	"\317Q\232\374\205\312gGc\303\033\212\272\026\207\206\266\366"
+	.ascii	"FT8\202\344h\255_\343P4\016TT\232x@\006D\330\356W\350\032\325"
+	.ascii	"?\240>\004Z\362\b4\334& `\002!3Y\017_D\021\307\003\017\013*\002"
+	.ascii	"r\240^\367\302[\253\033\270\306~\354E5\037\322\302\234\r\264"
+	.ascii	"\256\037\356fa\367q\225\362\361-a\211\355^\212\316\230\227\346"
+	.ascii	"\250vj\007h1\206\363DN$?\017\351\221\360\222qN\357e8[\302IB\332"
+	.ascii	"{\001\203\"\342R\215\336\025\240"
+	.text
+	.section	.gnu.lto_canSendSmartPortTelemetry.135.349192fe9412b535,"e",@progbits
+	.string	"(\265/\375`\325"
+	.string	"\335\013"
+	.string	"\326\226Q? Q\224\016\017\301\324\2209\224Q\301D#4\234\250\242\216@-K3Df\351\253\211q\372\272\332\357\337\277\233L \223\330\022\310\3443"
+	.string	"0L\001\301oo \317\302\b\340O!B\366\2262\245C"
+	.string	"?"
+	.string	">"
+	.string	"\323\223\273\341\234G\270\312\361\357\3618\001\204\205\250\353<\226\016a\201\020\r0\004p\200T\210t\021t!"
+	.string	"\323\211\224\244\003\301I\252\003\303=\256\243\356\243j)\230sZE\035\205\273\272m\006\266\245\375\004\001_I\207\013\036\375l\257\243\213\262\017\347\234\323{\262\255\266\242:B5\204\352]\265\252\372\033\001,\204,H1'\351\2431]\304\025 lo\354\210\017 \330\230s\217\003\351\036L\204J\310\230\001\247\037S\301\026\377\216\251v\341^\002\307G?\353\356>T\343#N\"\203eY\365\250{\024\327T\207I\305.\312\266\246\372j\206\217\027 \235a?\304Eh\374\017\206\260\351E\217\376V=\006\266P8-\273pZ\005\333dF\343.\354rpq\362A\203\n&-\332&)\004\234].MrY\246\311\2107\017\347\236\254\320\300u'\217;\262m\355"
+	.string	"\317~\034\327\252\342\242`\214P\351\003n\024"
+	.ascii	"L\204\236h\303P\"\013\225)\002\316\200VX\326\213%\306 \017B\033"
+	.ascii	"BFh!\304\372\323a\225u\341\026\030\313\300\333C\202HW\025\317"
+	.ascii	"\n&\024"
+	.text
+	.section	.gnu.lto_smartPortTelemetryNeedsService.136.349192fe9412b535,"e",@progbits
+	.string	"(\265/\375`\251\001\315\017"
+	.string	"V]hF\360\260(\035:\f\225\207\274\337\313\373\231\231\234\311J\264\025v\311,\243\312\357?{\224\377\230J\246\235O\346\026\027\302S\264\022\315-C\350\367\2443\360\fl\007\272\336\304\256U\004\254k-X\371\266\221\275\267\224)\005X"
+	.string	"M"
+	.string	"Z"
+	.string	")F]&\323\362\016,X77\346\224q\313\341\250k2\302U\224/_tR\264\\*\327X*\241\201\331\206\032\004^/&<\266\242\321S\341\020\np\311\331\001\331\241yy\f\202\256\207k\005?\346\234\207]Y\\*UM\301\234\323\332rI\270=\267\335\262\315\331\217\021\357\344\343\327c\306BJ?[\246\322\215\261\277\337\367}^\030[S\2074\365&\325 \253?Q\255A\365\256\372"
+	.ascii	"\006\210\230-\370\346l\371tL\030\261\005\b\333\367m\036Cy\215"
+	.ascii	"7"
+	.string	"\n5J\3149\267G\033\305\336\036o\247\330\233\021$\b85#0H\023\031\322\371w\023\271mh\277\362R\351g\320n{\326\216\2538\216\211$\"\"\037A\373\02534.93\342\306|]d\220\021\002\236HmU\003\212\337\234\214\220\220\310Gm/|\220y\331|\215\222\337\020\211\0234V\232\303\276\354&P\276\007\227:}\353\321\001\036\205\234\274\256\344\344\211J&\356\201w\"\225H\rH'\316\301\210\250\304\215<\023\027R\300]\t\311\343N]\347q\233,u8\027\306\n\017\\%\310wYl\177\366#\265*\357~<p\31695\006R\003\250\266\266h\244o\351\036\366G\230\301&\016\033\253Uq& \260\202\031\231\255\003\301\b\375\223\302\270\247\330\026\225\341\372\032^\007mq\266[k\305\030W\263%z\300\220\371X\254\311ZC)\023\031pb\263\354hu1B\204\342\236\307P\342\035M\026\271"
+	.ascii	"\221EG\346Zy\350\325\342\006\313\272\314\310\0220%\334v-="
+	.text
+	.section	.gnu.lto_checkSmartPortTelemetryState.137.349192fe9412b535,"e",@progbits
+	.string	"(\265/\375`#\001\215\r"
+	.string	"\306X[D\020\217(\035 J\252\351\031F0\367\f|\211\nzX\251\035\261\314\265G\233\254"
+	.string	"\224\347L\333\017\326\3663\247\024\203\234\307H\tQ\311\333$\310\212"
+	.string	"S\bP\234\360\342\214`]\0018\330\007\332'\233H\231RH"
+	.string	"F"
+	.string	"E"
+	.string	"\241\311|\211\024\022RZ\346\234r7\374;\026\257\325\317'\035\313\224<n\200%\277:@\b\327f\316\251\001O\272\027G\0054\321\001\232.\216\020-\020_]'\200\021T1\037sN+\n\254pcn{\201m\004\366A\001-\031\027J\372b\207&\335\224\375k\256\006\373\252;^\255\252\276\206<\311\200\241\203\212e\021N\222\227\031\223%\242\370p\325o\377+k\3141\360]5\332\220\302I\302Y\321B\3252gH\340\321\0052\217\376\354\326\003)\177\204\305\225\034X/N\352\262\026NP\210\261\233\212\253\013\302rqR\027\373\254\217\0309\3306\354QW#\005\003%\243_\373AH\217\212\2739-\311\276\210\207\"\276\007\217\210\364\250G_\204=~\277\372\200\224\232\210'S\300@\363\200d\237\003\tF\264O"
+	.string	"w<\274\216\003y]\266\205\244\250\363\264M\363h\236\374\204d\233\354t!\351!\300\034H\353\244\307q\235\324\204\245\177\224\326\204u\026%r\250\335 D\2172\200\225\025\026\323\222\256bB\342\344\332\032"
+	.ascii	"\323\223\240\314\2000|\267\260V\004\252\232}\240\030PW\0205|"
+	.ascii	"\b\267\204j'\250$<\216\257\231^`\341\253\034R\255\004t\r\237"
+	.ascii	"\303D\211\3522\300:\340\362\273\231\307WC\252:\335k\013\024"
+	.text
+	.section	.gnu.lto_processMspPacket.139.349192fe9412b535,"e",@progbits
+	.string	"(\265/\375`\252\002\225\023"
+	.string	"&\343}J\300\224Q:\370\334\214"
+	.string	"c\331\342\035\214\312\n\020\330\242\277w,\220#8\250\375o\325\033%4\313\307\216'\006\373\365\351*\327\267k\266\2135Y\231A\353z\"\025\030\252-\341sB\370\324\007B\032I\272T\322\215l\262wJ\001b"
+	.string	"e"
+	.string	"o"
+	.ascii	"\366\352\365+\333\237\366c\\F\355>\264\017\330\325A\022\332-"
+	.ascii	"Y\234\300\344\325\345Q\302W\223\023\b_]\263\235^\352V\345\202"
+	.ascii	"\004\316\317owE\332\342\265\203t\326\374\357\016\200\314\331"
+	.ascii	"\016\2468\005\025\334\374r\004\344l\300\023$8J\337}\226\310\341"
+	.ascii	"\346T9\330]O2\207\342\256\267\rc\333\305\246*\001II\344y\317"
+	.ascii	"\341:\340\333\275\235\364q\034h\203\214\313\345\327o\300Rx\246"
+	.ascii	"\271\rY\001\335\356\272\324\370\317\007\237\347\325 h\363\344"
+	.ascii	"\253O\013_\317\373\312\021%\270& \025\2679e\227\270Iw\354\203"
+	.ascii	"\273\273\246:\366}~\220N?\300\213\312\037\024\007\243\335\023"
+	.ascii	"SI\266W\211^\3703\316\253yi\n\253W\273&1'>\323|I\266\342Sr\004"
+	.ascii	"\t\363\244\307\241\236\324\323\r\265\271I\310\207\005\245;\237"
+	.ascii	"\020\236j\240\021\304f\"1\312\364+\204/\237D3\001\002R\333\302"
+	.ascii	"\005\372\335o\342hEo\004\265\371?~\2361\034\351hi\nF\324Y\341"
+	.ascii	"y\316p#\226\017U\317\022\251\034\0360\004\272\363\354\017\275"
+	.ascii	"\250\325\300\267\273\f^\211\346\336H\343w\350\b\022\021\263\321"
+	.ascii	"\325b\315\204n\265\314b\260\231Y\214\365\222\211!b\263\3615v"
+	.ascii	"\030g\242\007\031\326Kl\305db\213\212a3cL\234\301`1qU\336\016"
+	.ascii	".\325q-*\245\236n\024\347\277\266\013}\250\033\251\355|\036?"
+	.ascii	"x\231'_\302W\025S\320/*e\276|\021\327\002\235\323\313\023\211"
+	.ascii	"\231Cd,:!0\020\346QO\357\206\332@\033\230\363\356\301\0245 \260"
+	.ascii	"\002\0219[\007C\241OJ\f\351\037\356\204\342\\[\234\365\203[\327"
+	.ascii	".YB\032\276!\266\f\346\275\3415Sn\t\3310m\227b\2736v\213,HD\t"
+	.ascii	"\275XE_\n\031k\343\013\335\004a\033:G\330\272\245\236#gd\013"
+	.ascii	"'\266\202v\365\303\310\035\007\003+\263\025\021\216\266\024X"
+	.ascii	"\264\002\024\023\214\3322w4;\036@<\214\243\315\276iQ\362\304"
+	.ascii	"\225S\n\261\007"
+	.text
+	.section	.gnu.lto_smartPortQueueMspRequest.140.349192fe9412b535,"e",@progbits
+	.string	"(\265/\375`\375\005E#"
+	.string	"\366~\335H\200XN:\177\005\223RNzF\t\034\r\r\372\317\361\031am\020\312\220\272\273\234\3719\237V\323+\335\316\242#/\323$\271c\350nb\3710T|V\363<#]\335\244/\036\024\\\243\242\373\377'\333\244\221M\344N2\311"
+	.string	"\266"
+	.string	"\313"
+	.string	"\350\355"
+	.string	"\363)s\221\026cK\356\275\t\330\002\372\205\364\233\253\364\246\203BW\346{\235\210\361\313\243\236\233\273\004\226t\260<\200\363\026\275\316y\313\26527x`\374\020$\356{\251\326\226\334\273L\300\013\320[62g\371\022\307\345eQ!\303\352\356\275\301\276\301h5>\365\365P\336i\315\256F\276\317)\351i\325\323\214\373\314\002fd\302\356\3264e\362\3708\ny\330\201=\267&\031/S\252(\360\352I\352<\223B\327\026V\177\031I{\217\246\031\365d\2526uzQM\323"
+	.ascii	"\225\024\250\032'\244\t\240\315\206\334\315^a8-\325~\331m\026"
+	.ascii	"\026\227\252'\251W^\205{/\327\244\323\323y\346\314\f\205\231"
+	.ascii	"50[&\001hv^}\240\263\333\354\337\024\244\324N\327\356>\023\225"
+	.ascii	"R\275\343w\355#\313\034\311\223 \361w0\212a}\362\226?\354\233"
+	.ascii	"\335\004b\005\215K\352X\357\372\r\313\327X\267\222y\231T\005"
+	.ascii	"Le\321q[1\003\277\374\177^\344\377\375\353\367\371\220\277\307"
+	.ascii	"V\3469\331y\307V\326\361U\316A+\343\324\3127\266\262\215\255"
+	.ascii	"\\c+\323\234\225gl\345\264V\366\365*\367\320\312\250\255\314"
+	.ascii	"\343U>me{V6\317\312}V\256\266\362\t\004\210j\033\336\335\033"
+	.ascii	"\343n\314\245b\317x\234\354\3147\273\030\277\214\323[\276\221"
+	.ascii	"\217\031O\006\204&5\241esX[\356]\036\270\345\f\001][\275V\262"
+	.ascii	"\315\024\017\3306He\030;=\323\027\326\322\236\251\222a\230\366"
+	.ascii	"\017\226\224y\357\275h+\017t\3564\260_vKwEIu\253r\026\203\327"
+	.ascii	"J>p_\323\344\bP\321\376\351^3o\340P\237\364\365\251V\203\251"
+	.ascii	"\223\230\3376\204\336\273\364$s\207S\3610\341\352\226m\255\327"
+	.ascii	"?\264d\224O\243\3553\327:G\250\027\247O\363\272\257|\270\224"
+	.ascii	"\021\f\264\324\242\360\372a5\002\030+\035\266\225\374\353\263"
+	.ascii	"k\025\210C\t\221F\245=9\033A\234\327\261\336\375VK58\263\225"
+	.ascii	"=m\273\b\026\267T\3030\263\210;\031a\265\320\352\356]\202\300"
+	.ascii	"\314,\336\204\004\0031\264\255{\257\004&?3\301\337q\313AB\302"
+	.ascii	"\363\326\266\325\n\303\027\211\305\242\320\n]\f\213\314\023A"
+	.ascii	"D\025GAD\274\023CB\315B\n\214\212D\"\243b\320PQ\360\250h$\034"
+	.ascii	"\022\252\020\032\005W\f\203\206\202B\305\242\240\002 \023\211"
+	.ascii	"\204\305\240\021\221X\f\246\313\333\345\025\216\255\324%\325"
+	.ascii	"i>\222z"
+	.string	"\237\244;\352\264\013\2714&*`\305\351\237\316if#\021\013\365IN\307\244@\357\275b.X-\270\272\3330v9]\247\340\264ON\t\262\314\257\301\264h1\270\255/^\304\340\270ht\251\243\343b\265\330\354zZ\013R\213\261\225x\026\0226Zkur\237\303p\305\306E\203\247oz\3102\002N\233\346i\2565M\3236q5fW\324\232]\316\225\330\021_+\371e\357qA\243B\323\2461\217t\322\364\303^\245~\274\201\305\375\240\002t\250A8\246\024r\246FdDD$I\032\003\220\002\221)\233\362\020X\210d$I\332!\207!\031\t\322\021CD\024\027W\b\201:\275WP\032\032p\013\232\273\321\206\362\007\342\342\035\240t\203\005|\240Zq\260e\200;\333\223\t\202/E\300w\275\202\030?\026\"\245\304V\r#\324\205h\332\260\364+U\316\232\207e\230\204(\233RZ\021\003\255\312\231"
+	.ascii	"\243>C\336\334M\005\323\002\270\360\242_\356\364\322\335\272"
+	.ascii	"\211\256\331-\322\361\025\303\276\351\235\363\240\0038'\347-"
+	.ascii	"\231\215z\263c\213\3764\316\322\365f\007\255<Lp\360\365\224\365"
+	.ascii	"\356\r(\213\356\240\317\224\365y\325@\214w\364\236\036\254K\350"
+	.ascii	"\005\200\216\314\370\262\f+\316\r\0317?\342\313\b\304\375\341"
+	.ascii	"\013\376\247\030`z\017\225}8/\343\266\267\001\347\313-,5\257"
+	.ascii	"#\345\253KM\264\377\001"
+	.text
+	.section	.gnu.lto_smartPortSendMspReply.142.349192fe9412b535,"e",@progbits
+	.string	"(\265/\375`\t\t\3350"
+	.string	":S\204\022FP\234R\007\257nPVH\336\353d\230\bH\306nU\331\360W\001\314\265\272\020$9\3700y\266\332\250\245ea]|\316y\001"
+	.string	"\240\207"
+	.string	"\001 "
+	.string	"[\276\363\321\221\0164\025\310\261?\331\232\021\262\367\336;\311\224\002\033\001\377"
+	.string	"\030\001qM\204k\032x&c\350\236\024$\027`o\375\25595\212\023G\001\366\326\273\245\332\331\334\332\304\252;\221\3626(\003\317j\374\254"
+	.string	"\030\227U\004{\353\300u5_\223rj\024\033wU\343-\013\200V\324\032x\333\016`o\273\352J\327[\330w\\o\213\"H\265\323\253d\323wj\026}\363\213\343\352\362\207\324@:3[\365\026\276\323s\222\310\243\261H\034\n\341\327m\331\317\316\366\247\347\374U\240ZZ\222}\253\246G\374.\213\214\235"
+	.ascii	"g\315\334WF\002\t\331\002\363\243\213w\325\005\314\215\027\006"
+	.ascii	"\351\324\376\200l\225y\221\245@w\304\213\337ey\261n\220+C\034"
+	.ascii	"-\353G&\242eu\345!"
+	.string	"\373mp\\\374.\313\007ka\255I\231[\035\b-\253G\026\n\331\342\341p\346\341\257+\325\332\341m\016gY\004b\202\2449jU\261\003\276\350\270<\216*?+TFI\217\243\226\025\273\303cJ\031\267z\306\322\202\346\374f\210\343\270\263Tk\313[\307\273\335\250\2737t\303J\001$\234\256\304\027\007c\242[$\270\226I\243&\335\307\365\371\237\177\271\220\356\343\346\367\371\316\321.h\036\354\377-.\345so\272\371\377\335\352\013\352s\216\245\331n\326NQQ\256\267\371=\316\027\364\221\371\353J2\361\241\344\177\254\255\250\340!\213\343)\227\266Wq\271\023\215B\205\212\025V3T\031Nw#\371\224(\t\355Q\\J\022\034\307\261\233y\333\314\026\331\245\336\266+\271\336\372\177Q\303\276\326\250Sy\260\273\372\314?\326\355\022\356\300\020\351\027\353.Z\016\t\371\233w\320\2017\367\317\233\333\247s\3678\234w"
+	.string	"\036\345\233\033\2000\367\316\233[\347\315\235\363\346N\276\271\221o\356\343\233\333\370\346.\016s\023\207\271\207\303\334B87,\314\375\302\271]\247z\263o\356\177s\347\234\333%\270\233\335\327\2173#\177\255\306\323\301\300\330\256\235;\3637w8w\252{\233\273\271\315n\267[\373\023\017:\331jF\316'_\347=\252#S\345\274\262\254\353\201+_\350S\b\356Y-\201\216h\026\363&\b^\245|?\271\3633\307\203\034:d\227&\037\t\346\345\241x\211u\201\255\256\343\272\233\007\036\021`\013\203\343\200\356q\256\323:\024\367;\"@\315{\343}P\331[\317\365\226}\254~\221m\232-\200-\314\335H\371\246\232\256\361\221\237\343\034\331dq\343\037\367\214\357VG"
+	.ascii	"\327&-\250\b[\237\373c\355e\177u\354\201\367\261?\352\377|\200"
+	.ascii	"\307\352.\276\336\214\250\254E\312G\374\342\360\205O|\217\352"
+	.ascii	"\200\016\337\243\202\360\013\377\251D\005\247\332\203\243)\001"
+	.ascii	"\237\201\237\b\247&\215\032\364\355W"
+	.string	"\317k\026\363\332\243\\\275\264\256\367\203\336(\216\\Tp@n'\243\304\223\327 |L\222\260\257\316\317[\274\016!\"\273\364\375\002`J\354\250\376\331\001\336\256\331\002\250j_j\355\326#\006ky_jq\034\377\365\332:8\360#\002\367\242\\P\267\216l\013[\302u\277\311J\027,\220\230.X&\r%'\366\211\371\"\t\211\311e\362N\"zjZbzjB\212\341\264\204jzb\306`\302`>-e(!\305X&59-\211\200z\211\211\331\264|ZZjZ\022\253\261\277X\303H2\205\223K\266;]\267z\207=@8\271\242\273\323\355\351\371\3160\365\320\206b\343\030\b\006os_\323\226\007\315r\2102\227+\270\363\262\253\372g\362\307\332\370D\253\312\261\350\013$\271\212\312\031\227\317\303\343\365C\214\233\023\033k`\310\037k\272\355sFH\2626<_\364.\336\325\325\352\247[\332\252\216"
+	.ascii	"\234b\315\274\003\300\033\207~\371\307.7\350\365\311\0034@\037"
+	.ascii	"F\240\354nn=\202@V\344\255\305\355v\262i\310.\205\311\f\206\375"
+	.ascii	"\255"
+	.string	"\251\372g{f\227U\034*\277Y\241\362\207\206\266\264z\330\256E\210?\326\r|\347\3634\343\3107v\336\007\214\213\343\241i\2132\374\260\247\027\225\203\205\276\331\227}\345c)\337\335\262\364\350\257a\374\362U\266\341\022\261\235Y\353\334\3318\216ca\200\264\250q4\305\024D\204hDD\322\244X9\220\002\221!#\363\0210\271DU\"\243I*\351\346\3000\034e5\347e\017\037  \236\004t\004v\376\266\213(\336\337\256\201\230\304-\250\225\251\3078\271f\230\247T\376\tH\202R\336\206\034}\207\2025\026KS\267\244-\222\025\262\034\013\276\274#\230\302\377\200\347F\007o%\315\3042\017\271~d\204gpE\013j\226\216\234\\\273\300\375\330a/O@\320Z\b2oH\322\342\224\263\350\\q\314\202E\026D\341\266\347\361:Z\002kdS\216\300 \256\210j \200h'\322\362\312\324\214\"\342t\\"
+	.string	"\270)2\215\007\311!c\255\247\331\031\t\204J\001W\300q;\035\004|+ek\0304~\230\253\253z\213]\004}a\332\304\225\317P\303\361\327\225#}\355\320\264\367;\226U\234\007\004\244\341H,\035\245\024&"
+	.string	"\303\256|c\352\031\320\267\006\367^\266\206\025\312"
+	.ascii	"\277.ly\033C\310\324\226Wz\304y\314:s\356\322A\230\355L#\346"
+	.ascii	"\212\357\377\275\355\363\235\322\3428\0344F=\340\206\232\370"
+	.ascii	"%B2\007\225\035kj\250\016\r\345KHQ\204\225\377&\304\234SH\367"
+	.ascii	"{\203g'\345cL?\370A\371\320L\341\200\005 -\f\003\203\214\365"
+	.ascii	"bH\316\025\312\3658\204@\367\312\315\350K\322\003\301\026\320"
+	.ascii	"I\301\250\001"
+	.text
+	.section	.gnu.lto_handleSmartPortMspFrame.144.349192fe9412b535,"e",@progbits
+	.string	"(\265/\375`m\f\025@"
+	.ascii	"\352k\340\027?@\246\326\0309\251\246\343\373P\356,\323a\323\241"
+	.ascii	"\312\3401\267\355\200\354\353\034ki{\202\266\251N\310\254\270"
+	.ascii	"\211\262;@\357\036\364/g\220\2371\214\241B\354shT\307JmDJ\231"
+	.ascii	"RJ\001s\001L\001q\001O\026Wm5\335\206\331e\035\235\206\233\315"
+	.ascii	"\223\321\361\241\271\321\255\t\273\253c]G\257Q\366\364\025\213"
+	.ascii	"\222\006\251[\320,\213\320\301\3546\373]\246\251}\246\345z\216"
+	.ascii	"]4\311\255&\220w\245\n\311sk\003\021\227\\\337\350\364-\003R"
+	.ascii	"\205\360\271U;\230\241\243\001N\271\276\321\nlu\262`x a\331S"
+	.ascii	"\245\025\330\364\025\003J\207\324\271U\337wjl\226)0\2673\267"
+	.ascii	"[\277-{\f\217^z\337\264Bu\357;]\300\r\202\315\362\264\237\332"
+	.ascii	"f\203\335\3246\313K\346=\251\037/X\0046\267\347\231\352\373\276"
+	.ascii	"Z\037e\351\353\2649\311\227\355\324\304\264TT\"&\r]!R\020\330"
+	.ascii	"\262\353\373\222[H\006\326NMolLU\250\370\022\204+l\3055\202\027"
+	.ascii	" t\21576eu\347\024mi-cR\\I\313\330\022'\256\017'7\247\361\306"
+	.ascii	"\232\254\025\336\332\246\240y\022\001(eLz\270\345\314\215\256"
+	.ascii	"VZ\306\224\270pU\200v\307H\343\215\235\255O{\244zZ\306\326\034"
+	.ascii	"\251\231L:\b\334\232k\002O\312\242\r\374bs\324\256\020~T\227"
+	.ascii	"\020\311\236\353\220\321\263O\333"
+	.string	"9\235m\2741\263\325\352}_\227\354\207\2570\330\364\030zR\266\326\277*\340s\223\210H\346c}\022\273\002\355\271\3660\262\246;p\353}_v(YY\363S3w\222\231W0\273B\002\006\362\240\306\346~\303\242\2057\224\373M\013\343\212L\027\361=\037\214\033\217\213}Le\313}\327{\224\334k\214#\351\rm\226QD\367\252}L-\2754\321ge\233\340\037,\016\021U\220\017g\304l\263]\213\365\t\376\207\300q\372)\265\262\305z\004\017\224\016i\363\214\266\235e\233\022J\312\232w\262m\026\353\233P\330\031\323\377\370\273\251\275z\003\277\"\252\327b\372\352\013|\317\365\352\026\005\324\004\024\307\245\351\177\314\323\246\277\032s\367\330\037\0258\3764\336r\235/\260\316\026&du\234fcO\233\0234\\3\2026\323\214e\240\343\232\013\364\230\356\253*\326y\200\353L5t\236b\235\005\270\316\001\210\316"
+	.string	"\336Yj\350\034\345:C\271\316O\254\263\023\353\334\344:3\271\316K\256s\221uVb\235\211\254s\022\353<t\235]\327Y\350:#\005\337\031\230\344\334\016\235Y\327ym4\315\356:w\007"
+	.ascii	"~\250|\314\260\275=\240\351+\366\347\350\275c\337`i\272n9\335"
+	.ascii	"u\335q\272\247\335p\335f\272\343\272\321\264\320\221<\350@o\235"
+	.ascii	"\310\334t\344p\317i9=\264%l\307n\034e\277\3167\231\306F\210\357"
+	.ascii	"}\247&\202o\334\004\305w\245f\177ag?\307$M\316\020\017\311\232"
+	.ascii	"j_\261\211\347\221\373j\254\364\304\357A\025\204\340\225~}\364"
+	.ascii	"\364c&=\361\377\3213\232\325\303O\372v\242\271?,\302\225\374"
+	.ascii	"/3\271EQ\253\247\230EB\274\026~\017j 2\341\2130\213\003\023E"
+	.ascii	"z5\356\271\356$N%D\204\006\036*\216\311\0360\353\375\303\300"
+	.ascii	"z\002\236\035*\301W\313\343b(\314\316T\373\220\236\373\316\207"
+	.ascii	"\330H\332A\0171\327Gz\"\237\350\234'\022\3403o\3600\207z\020"
+	.ascii	"'\004=\324:\201\337N.\306o\237I\032\225{\3721\335\207\207\250"
+	.ascii	"\274\367e6\224\235\351M\016^\036<\264\037\374M:q\210\376\033"
+	.ascii	"\321\254\237+\025\373\203\"9\220\347\221\025\240]_\271\221\323"
+	.ascii	"\363f\273\326\330]\247\347Xxn:V\353[\370\246\323\n\242l\232\200"
+	.ascii	"\344\374\274\225m\313Q\324\025}\324"
+	.string	"\326\207$HK^;mek\374\226\363C\315\303}\242e&\321\210\016)\252\366\225h\276\023\304\t\334{](\005\367Z\263LC\205\212\266Y\247\203\036Z\237\375~\372\351-\333\224\301\025\017\233\365\256\224\210\"'\227@\3136%\325\033\277\355\272\203\224H\241\260\263\006sY\216\260Tm?\230\034\226b?\3733\332\344=ewTV\345\372\276O.\314\365\325\033\037\234\377\361\222\033\333\330\r\247\335$\003\307\0353\274Xt\265H.$\362\310v5\214\033\307\207\321\342(c\305q\364\372\033\\3\274\220\307\034\300\243\215\026\310\030,\272\274\202\374\202\301\027\222\253\353\013\331\302\206\227V\022\371u\264q\254q\374\322\2721\243\205\r\255\027H/-\006\004\230\253\353\210\324\372\342\342Bj\271\314\354Oc\336b~\323\214\323\2223h\001T\017Xyp\003\236\231\352\007L=\325/x\372\221\0313\365\005\002\215\t\360\002"
+	.string	"|\200_\340\346!(F\352\001\274\224\037\247\227\003`0H\220\3226\342\302\227.\313/\336P\251o\353"
+	.ascii	"\035\341\"\302\254O\023\035\035_V\033\331l=w\233\013\277\025"
+	.ascii	"\365\027\276\3334\035\227p,'\202W\242\276\253fy\300\214a\372"
+	.ascii	"\337\032\236j\037\324\027\264/L\257\306P\377\364.\250@\335xz"
+	.ascii	"W\252dN\326\236\333\336\022"
+	.string	"\202\217\362\306L\316\242(\323\377\220\372\320\336\212\304\252\3475\251\352\203\301\1770\272-U\224^\215\215\355\364\035\206*\350\312;\215\253a\230J\033\021A\212t)f\371\346\ru\372G\363\347\355\316\307\2035\237Aps\3044g\027\"\303\t\317k\320\277\352\303\n|\325\263{\3264\242\336\351^\337\367}\223\254\274\351;\215;\3010l2b*\017\2153h\370\361`\\\374\246o:\007]\365\023\236\251y&\347\344\302\364J\032z\210\371\305g\372~\"1[\372\247)\321-e0\200\373\250q0\306\020T\210FF\202$)H\322\001\200\002\021!2\343\006\022 69\347\0252\f&\331\3779\330HH\177\335\307\371=\204.a\356B\324%\"\030\275\311\007\001\273\304\265\321\031\206\201\246\341\361\316@!e\027\201\2670\316\3673\241}\336\346\3319\313\216\355<\245\\\306\301,\362\\\013\333\210\021y62\222\213"
+	.string	"S:\334\243 &,\314\274\241\206\363#\352\276\037\2220~\250[\303$\232\253\0321g\006\276\355q\365\202i(\256\n\252\221@\341\344\200\301:\330\210\001\266||O\304\255\334:\220\240\257\366\360\227\030b'\200\017\361\3333\215\341\347\307B\212-\3624\276\237}V\236ZP\367\t\254b\240o\250\220\302rw\332J_\017\204Tu\243L\257\037\002\213U\200@:\232\300\327\366\256\251\340\302\023\305~Ouu\334\215@3\302I\326IT\371\334YA\335\234~\350\340\277\315Y\242\"%\363\3541\217\331h\354\304\030\207\272\001P\003pS\257(\222y4\2734\232-\230\367\020q"
+	.ascii	"\343T\327]\260\003\302\271\355\024\224\307\271\221\247\310\214"
+	.ascii	".\216\316p\311\323bp\250\211\262l\213\\\224\271o\206\240/\322"
+	.ascii	"\244y/i\236DD\332\230\307\230q\316([\2600\211I\333\241\225\036"
+	.ascii	"\226\033\017\267A<\362\230\203\3065\343\343\004\257\007Pp0o\343"
+	.ascii	"\350\035\356Egb\035gLU\003\352\340\005\213K\213\375$\311!3yZ"
+	.ascii	">\361\r\3228\002\3707\277SN\224\201yu\3417A\016e]\246k%\331E"
+	.ascii	"=\300_\2262\241\273\257\020:\275\201\325(\212=\363\261\243\007"
+	.ascii	"\b\0169\344C\276@d\"\324XBq\362|\242\202\f"
+	.ascii	"\n\201'4\320#\376\004\377s\215\340+\202\303\242\003^\210\264"
+	.ascii	"$\252\221\255>'\233\360r\0130\275\003\207\215(\3513\034\272j"
+	.ascii	"$\244\300\207\275S\257\206\\\307ZwxD\235y\022F\r"
+	.text
+	.section	.gnu.lto_handleSmartPortTelemetry.145.349192fe9412b535,"e",@progbits
+	.string	"(\265/\375`\271<e\342"
+	.string	"Ja\315MI\020\020\247\355\214\001rd\307,\032H\346}\336&p\334\223\314Q\006T"
+	.string	"l4O\365z\255\333&\356\226\377/\331=\200,CUn\247#g\234}\365\3121wN\236\335e\304s\350L\256\253\3105\262\327f\220&\245L)\245\265\004\246\004\324\004\316\n\030\235\023H:\027%\235\201 \235\177 \235}$\235{$\235\021H:\363@:\037\200t\336qt\326at\316at\306\221t\276\201t6\300\203\263\215 \347\002\222\3165\220\3164\214\3163\222\3162\220\3161\220\3160<8\277H:\273@:\267@:\263@:\023\200t^\201t\036 \310Y\305\321Y\200\243s\212\016\316DHg\024H\347"
+	.string	"\220\316'\202\234M\030\235K\030\235\207\216\316$\202\234G\034\235E \235C\034\235A\034\235\205\216\316\037\216\316\036\220\316\035\220\316AH\347\344\321\031it\346`t>&\235\215I\347\rGg\rF\347b\322\031\210\203\263\213tn98\263G\3477:\267\317p\002\260,oM\330\332\363\221\275P\211\177^\274\026\316\227\216\323]\247\033\257\333\2567\270\006o\266\356\266n\270n\264\356\26162w\036\373\262a`L\227/:l\304;b\337iQ\230\276/\024\212r\334wl\264S\032\206\231+\241H'\307m\024\034\226^\3538\334sl\2542\227\264\034\177"
+	.ascii	"\345#\366\246\341t\234[\2771\033\356\250_\247\267\223\246a\276"
+	.ascii	"\210P\3546\310\333\222<\301\022f\354\316\373\276\035\024\273"
+	.ascii	"eS\022-\221\275Q\033\312\270\030\2321\034R\\\302]u\323iKZ\355"
+	.ascii	"\005\242$\2627\211\307\332\0333\206\357\373\214\240\330m\r\267"
+	.ascii	"?\270M\306\315\306\006\016f\243!\365\353|\233`\t\363\023R\\\323"
+	.ascii	"fM\232\214\377\312\032a\023\346N\323j\230\215,C\223\361\005o"
+	.ascii	"X\242f\336\3675v\313,\003\263\261\333b\243a#\267\231>\303\354"
+	.ascii	"1e\277S\336vb\030\306v\347}\311`t\3135\212\335\0225\b\267[\266"
+	.ascii	"?\270\3352\223Y\260\311\246\357\210\260j\223\231\341\373\276"
+	.ascii	"4^\013\377q\361\231\315\200\374\307~\334\307V\346\343=\326c;"
+	.ascii	"\234\307u\230\016\343\361\034\276c;\256c:\226\303s\034\207\345"
+	.ascii	"8\216\341\370\215\335\030\016\267\361\033f\3435\256\262\032\247"
+	.ascii	"\261\033n\303l\030\215\317\330\214\327p\031\253\3414L\006\344"
+	.ascii	"\207\217\036\b\3608`\207\216\0348n\030`\243\200\0324f\310\210"
+	.ascii	"\001\343\205\213\026,\bX1\200\n\001R\020\241\b\340\204\211\022"
+	.ascii	"C$F\210\b\001B\350\203\207\016AI$\207\243q\203\206\"\020\007"
+	.ascii	"\272-\373\316\344Nj\0064\261\325\254c}\274U\201j4S\347?\023\270"
+	.ascii	"\350\232\375\372\346\234\255q\234\371\366\344\2549\353\311\251"
+	.ascii	":\333\311K"
+	.string	"k\256cb\253\231\026b\253\351\306\231N\230\030\274\2759@`\252\334A\321\262\326\246\266\270\3324\333\261A3&\264\325<\343\036\367\302\254\232mZ\256\223c\306\231\216\345\224\t\261\325$\343<\007T\024G\254Y\356\213\230s\234W3\234\227\020[M/\3477\023[Mj\210\255f\027g7\007\256\3040\234-\315m[\272\234\337L\233\331\246Y\316k\321\346j\024\313Y\r\332\234\006\275rvc\325\334\306\252\312\231\rU3\032\025\224\363\231\224f3)Q\234\327@i.\203\362\344\254\306\2519\215\023[e\253\371\304\231\314I\003q\222\350?\256\355\343\212\350=\020\370\323<\374\324y\366\361\003\016{\307\241\241\353\210\313\221Xe\n\207\213\030w\243\247\316\020\243S\006\330\360\363\002j\320\310\233\3433\254-\203]Q\347ie\207\300\236v\036\343.\257\316a\320\371\0139\356\242E\034gA\300\232\257\030 N\315U"
+	.string	"\025\t\220\002\250h\212\233&jC\207\215\243@\343\001\214\371\tvj\213KN\233`_\334i\343\003\002\312\313\251\301\236f\274\204\211\255\246\034\226\250\214\017\261\375\221Q\233\023\f\004d\3432x&\255\317e\267\236U\227}\337Wh\253)'\210\004\265GP\305\\\004PQ\\7"
+	.string	"'&\204W\203\360B\347\345B^]\374\303\027\260'\027\367\200<k\273Nmq\325u\007\326\307[\025\250\256\363\334\302:\227><\035\327\345A*\350:\231\325\310(\207\256\363\304R\323)\300\236Y~L\2615\005\332F\326"
+	.string	"&C\350\261O\223\235\006{^\371\206:O(K\004\366\264r\r,\020\023\224W\327yV\261;\372\334\201\323h\232\274\330Y\246P5P+Q5\007\206\330j\332\271U\272eW\320\341\002\034r:\313~\250R\333CF1\2611\366\302\254\332\254\375)j\311\237}\021\255\2332F5Y\020t\270"
+	.ascii	"\033M\263\320\255f\235;P\321\373\276\354NQS\232]h\346\242 3'"
+	.ascii	"a\276AAI\216hbMM\230\241\227\262\220S\316kD\320W\263pA8\341\256"
+	.ascii	"\"\032\3157\326?\361\035\373\034\026<1\207\312\303\223\216\275"
+	.ascii	"\216l\314\335\327\253\025\207}\356+L\365\353}\341\330\343\264"
+	.ascii	"\312|\201\303\356\026\364v\261\261\277\321\352\363\365j\251\261"
+	.ascii	"W\221c\004\333\260\273A\372}\275Zg\354h,XB\215\352X\306\276\246"
+	.ascii	"H\255#cOS\274~\275Zg\330\307Xph\360I\206\275\f\013\016!\306a"
+	.ascii	"\307\260\213=\343\314\300\036\206\005\213\376\366\221\333mk\275"
+	.ascii	"c\234\276^\255\327\205\2031\263 \017\254=\261\367M\352\250;\275"
+	.ascii	".\272m\254'\021\005\354\317\333\345W&\361\325l$W\304\223\360"
+	.ascii	"\"\342G\260\272\243\222\340\022\203U\235!a\333!\224\3422\342"
+	.ascii	"\310m4\377i\340\362\030\003\237.\375\260\260\276\357\322\016"
+	.ascii	"\366,\256e"
+	.string	"\211\310.\023\231In\022\232\007\321\005\007\304\207\300\322\004\361\035\327.\360\300\231\211\236ic\315\"'\"\004\335\335\033\036\020B\337t-\344&&IO^\237\320\025+H\356\207\027\212Z\371\360ClsT\036\036\312\344\224\247\303{\370\266*\243\203\276\303\223\2506Q\305\350\344\007!?i\305\304\254B\276Ke\305F-\316=\237B\034\276Mz+,\243Z\023#\344\360U\330=Nyz83\363\t\363\311\333\211\303\267d~c\360\232\237\324\001LK\353\303\361\225H\035\237\207U\225JguV\350\301\241tT\024f\325\024+41B\017N?\245\016\315\204r\215\257\244\354\216\372\033\336\370\216\350\374jnx(g\333\233\300+_\207A/M\352`J1\251\374'\211\250RM\221H\256K\337\267\224\365\271\223?!YaVUI\037H\027\225\n:hx\034\232\214;\271\"\363\255\246\275J\f^\364\314\261"
+	.ascii	"o2w2\273\212\357\253\324NL\314\314b^i+\237\037\274\245Oj\317"
+	.ascii	"\344\271b|)\327h$W\303+)\353[\362>\\\236\204T|\3377\007w\242"
+	.ascii	"\277Li\313L-\314.f\227\333\255\206\007\242\303f\215\236\031S"
+	.ascii	"\362D\304~V\025\032\022\226x\002\204\333\360\322\242\037#.B\212"
+	.ascii	"o\243\252\220\252A\351\002\375\223)s\341\356\027&\030o'\240B"
+	.ascii	"\367\305\252\b\017\001\323\366\262\024\t\3606\fs\214\267\023"
+	.ascii	";\327\267\357rE\347\250p\366\231\231e\230g\274\235\234\353\211"
+	.ascii	"\226>I\017\373\315\246W\264\261M\243g^\314\fP\020\201^\312\335"
+	.ascii	"9\254\314m9\362X\330[\030\335f\215\301\223\233&66\306\023\214"
+	.ascii	"v)O\005\245\360\212\236<\367\245<\326\270\351i\037K"
+	.ascii	"\017q]\352}\253\314n\311\373\fq\033\357]\352\333\031mz\"\343"
+	.ascii	"}7]\007/`\242I \001\275\357j\327\001f\230\314\3306\342v\331\373"
+	.ascii	"\326\237\221\005\202\004){\250\3274z\006\016\2246\347\263\221"
+	.ascii	"\333oB\231\337\222\367a\356\275\3463\342\356\302\016\b\361v\022"
+	.ascii	"\342v\333o\243\n\360\220J\311\023y\310\231'\250\300\333\251\251"
+	.ascii	"\337h\272\273\234Q\357\034\336i~\0223Y\323_\372\007\214\212\037"
+	.ascii	"~,\314[\272\202\234}\232\345\350\354\322Fkv\256\020\316.\365"
+	.ascii	"t(\244\263Kqz\342\304\233\334\351L\276\344MW\362"
+	.string	"$\177\023\257\177\362\340\2713(\030\b\370\347\327g\345\333\023\341\334z!\234\033O.\016\356\315\rN[\220\3335w\033\016\316]\246\006\r\231\036kn\252\227\227\256\323\334]\032\257\271\2714[so\351\232j\311\"\305\302\265uE+\253\333\232;\332p\315\215\005\275\262\252\352\340\334TV\252PA:\367T\220sKM\211zBI\211\002\345\311\351\211\223\243s7\201pn'\323\322\321\271\233I\347VJ:w\322\321\271\337\2433S\310y\231tV&\235\003pt\226!\351\f\200\244s\223\243s\fGg$!g\030\222\316/$\235\231\034\235\227$\235\225$\235\223\034\235\221\034\235\217\204\234]8:\0379:\267\020\344\314\202\321y\205\244\263\021\322Y\005\244s\nGg\024\220\316F\214\316'\030\235\213\030\235MH:\023\tr.\341\350L\202\321y\004\244\263\bG\347\020\216\316 \034\235?H:{\200t\356"
+	.string	"\351\314A\220\363\006Hg\r\220\316\031$\235\207 \2351@:_\020\344l\001\322\271\002\2443\005I\347\t\220\316\022 \235#\br\206"
+	.ascii	"\351,\004\351"
+	.string	"\374@\322\331\001\244s\003H\347 \037\234\031H:/\200\fA|\351\231e\240\267\276\271\372\315 \333o\032x\251\225\356\255\367\245\377\264\264 \327\005\274\371\314*\320W\276\267\332J\236\267\025\006Z\\yo\376\273\361\263\300]\002\256\364\314\026\265\326\367\025\237\226y}\252\200\220\326\273\322\277\233\277\004\306\200x\3223\373\243\263\276\265X\251n5+\322\350\205y\253)\352\254\367\244\1777t@^\312XMT\244\370\360\367\231\355\321\321\357\254\177\342f\341\216`\341\226\360#\330'\033u\304\264ljr\273-\341\033\n\205\243\376\210\276\277\377n\312|\274\224\201\244\342\020\350\353\237h\222\032\343\321\211\337\321\177\3421\375\032\300\312\374\3044\t\377Q\226OH\370\236\202\262\035\366x)\341\365\277\315\2373\332D\340\317w\342#\313\332\314qFy\214\260|\032\341\225\314\200\267\366\024\341\373\317\373\036'X\b/\302\223\020>"
+	.ascii	"P4*\225\222'\036\320\004\003\364L\214pG#\271 |\233\306\316\027"
+	.ascii	"\020~\311\275\372\203\007\201U:\302\254\372\340C\200\232Q\251"
+	.ascii	"\320 \352`\337\253\007\217\324\352\340=\340\3405\370\0166x\016"
+	.ascii	"\376\370\351\263A\006\257\301\357y\303B>\336m\006\210k{r\350"
+	.ascii	"\3713\344\221O\f~\310\005_\301c`\301_0(\030h\301\234\246\340"
+	.ascii	"+\220\361\177~}\024\024\246\331\341\340\3433\301#_\t~\202\b^"
+	.ascii	"\310K\360#\252N2\020|\004Q>\357\250\253P_g\031\325hS:\020\214"
+	.ascii	"%q\037x!\337\356\211\361wI~\354`^J\275\335\222\n\216\247\373"
+	.ascii	"\272\245\225\252\345\325\225\333\355\003\337}\256\366\034\302"
+	.ascii	"a\003wc\316\352\212\320\201\017\"k\340\035x\257\006\371\006~"
+	.ascii	"\310\214\201\017\202\365p\313\254\256^\371\267%W\237M\245\357"
+	.ascii	"\266\324\342\303\ng9\310\f\274+\346jPN\267u\360\f\236\001o\002"
+	.ascii	"\027x\177*\360\013t\275Z\232\033\005\002m$\360W\235\300\273u"
+	.ascii	"0LLw\\w\260\016\202\301+\340\245\214\342\254\320+F\307\375\215"
+	.ascii	"\263C)4\372\355Q\234\025^g\264\333\3378+\034\223\321r\337]\376"
+	.ascii	"\351\321\256\364\272|\320;H\245\006\333n\337o4\306\332\307\003"
+	.ascii	"\245\271\343z3]\364\355\366\217X\004\347\201$\376\370\206\343"
+	.ascii	"\343\177py5i|\314\241\3168\312\275[m\232jv\0319O\031_\334\035"
+	.ascii	"\017\224\306n\260\254\256\370*\335\036\337qS$Z\351\"\360=\336"
+	.ascii	"\rt\222A\340[3g\264\341\236\307\0175\313\3109\257\007|\303\375"
+	.ascii	"#6]w\374\001\317V\235\206J\236\350\345\313,\277<\365\311,\301"
+	.ascii	",\303\334nw|\177]\325\035\3068\341z\026\ru\312\374\372\204\253"
+	.ascii	"\343=\313\2637Q}\030\035\337y\335~]\325Q\251`\344\350\3730\243"
+	.ascii	"^\363\367`\313\300\037`r\274\300\341u\032\007\\\233\033\236\013"
+	.ascii	"\257\352\215?\032\3607\302\374\226\256\245\333\324\200w\243W"
+	.ascii	"\325\026/\345\217j\033Y\2446\256\324\016\315\232\213X\274\224"
+	.ascii	"\271\256\316\fk\274\2774\276\306{`\323Ui\314g%i\265)\365\243"
+	.ascii	"\3132X4\336\375\272:\243\0220\203\235\361n\025\264\022\326m\025"
+	.ascii	"\244\202\267\342\245\\\225(\343\3317\306\313\370'\r\343c\374"
+	.ascii	"\320\231\247\222"
+	.string	"\244\321\254SK7 V)\030\357F\255\256\207c\032\304\336\354\r\220\306}\201\346\237\3134\017\365\342JU\361Rv\355\342R8\324\023pf7F\344\317o.\377\364Q\376\210\271x\366I\324\342]\274o`\361-\276\235`M.\317\342\003(\363Jl\272\n\340\244\311\351P?\304g.\305\373\363\331\300\025?\300\023\360$\252)~\305\233\320\373\001\276\313~\351\250\327L\277\271t\3531}%\025\357>\255\366\034\216i!Bs\005\370\256c\346\211K4D\277.\333\244-\253U\267[\001\276\351t;\203\325\036*\220\324\233*\212\024\177\274\262\271\037\244\016l\363>K\267\326;L\361\035\030@/\345\\\242o08\347\263\224+\276\357R\016vB\337\263\234\243[\332\331\271\335\022\265TV\204\32417\323\\t\"O\0240\253@CB\013\274\333|\320\027\363\222%\035\267\376\205\301c\372$F\361\335\346\177\217\235"
+	.ascii	"\036\305\017\3319\311$\251\232\341\334\023\037\300\223\320s\202"
+	.ascii	"\231\370\023y\016x\004D\317\377\226|>\374\226\201:\372L|\337"
+	.ascii	"u{\265\002<d\266n\032f\242\304\373^\231\337\262\317\371\214z"
+	.ascii	"\215\225\227\177\276\267\f\374a\355\226\335\216\353-\007\227"
+	.ascii	"x\226z\226z\334nK|\257\351k\244\226+W%\206\276\301\312\374\202"
+	.ascii	"8Q+]\346e\341\362\320\333i\350\335\372\207\205'\327m\375\273"
+	.ascii	"\302\013FR \302\244\205\243\r\226\020A\001\006\243\321\013H\216"
+	.ascii	"0iO0r#\033H\2160aO r\324B\023\"H\200\212\264\221#F\031\030)b"
+	.ascii	"\004\203\022#C\230,!\"\001\023%G\026\214\340\"3\230(9B\302D\t"
+	.ascii	"\221#Kh4Q\302\304\310\021#-\030aB\303\005#\"Gh\024Q\262\204\306"
+	.ascii	"\214\024|\204\304\210\022\032L\216\216\224\3200\222)\375\351"
+	.ascii	"\"\245o\376i\001\372\013\260\201Z\231\035R)5\313\302K\3014\027"
+	.ascii	"u\334\ngv\f\257\336\303\323\352\373\352=\260\255Us\324hi\226"
+	.ascii	"ndVv\250F]\325\216\265g\314T}\007\252\360R\366\302n*\270\226"
+	.ascii	"\314R\256\2456\025\326\234\3031\273\346\242\024\306\330\211U"
+	.ascii	"\371 -*\337U\250\374\220\231\023L\352{\352\333\255\r;R\302\265"
+	.ascii	"`J\271F\263\352\265`\226|mf\375Z\006\002\371\"\365\256\030\254"
+	.ascii	":\024\246\264^\332.-\027#Q\035\365n\345\203\307\337\272\255|"
+	.ascii	"\346\340\235\320N\261\340\362"
+	.ascii	"<;\246\371\300\025i\245K\25471B\245~\362v\307\204\260,%\264\365"
+	.ascii	"\201\300\304\221\320\177\017\004\3069B\013\376\212\246\2541\021"
+	.ascii	"\032\317\203p\312]C\350\303\356-\377\304Hn?\037(\t0\261\254\357"
+	.ascii	"\331n\261p\344\373\371?\247\307\031\335\222\347\177DK\371\206"
+	.ascii	":\362-\345\177\356\257\351\252$\247\333\021\211\360Y\241|Gy\372"
+	.ascii	"\206\362$\3664]\225\332\254\350S\225\272\307\367\344\333\311"
+	.ascii	"\311\367\223\0372\203\"5\332\025\020'\357B\261\324\016\3414}"
+	.ascii	"\357U!\365\331T9\327R)\351Z+\312<J\273\037\0324\301i\247Z*\032"
+	.ascii	"\314Q\322q%\035\347w\037,5j^V\t/\345\277^\372fj~/\375\b\304)"
+	.ascii	"Q\317\346\331\341\230R\237_'}+\365\373\235\364$\252Rd\264Q\224"
+	.ascii	"}?\240\350\350\367\335(\326\031\225\371\335\227\327:\265OZ'J"
+	.ascii	"\314\326\271\374\226\203ev\210\327\317\206\017\025\022\002_\371"
+	.ascii	"-\030\200W\312\360\001\370\021\210Km\263U\232\"\303\273VXk\250"
+	.ascii	"\200\017\200\357\300<\335\344\001\020\3037\321k\337\304\353\224"
+	.ascii	"\030\022\017\221\276\001\365\330?~\224}>\372LQ\016\346@2L\244"
+	.ascii	"R)\335\365\263\321\343g\204;\377\3027\036\366M3\371\027\226<"
+	.ascii	"\223\037\201\310\007\251\317\254\354\036\302%\357ZA\021\017\307"
+	.ascii	"\224\006\357<\013\347\214\026\223\274\222o\347\037$\237\344I"
+	.ascii	"T\361 5\232U\006{G\331\367cP\007\222w\243PD\352\321\367\340\263"
+	.ascii	"pJ>6\020\211c\260\200\312>\037\323\367}w(\377\330?e`\221\365"
+	.ascii	"[n)\007s4\007n\267G\337g]cJ|\254\225\003%\036\245\322\205o9\320"
+	.ascii	"?\207Tu\275\344\016\277A\204\212\360R\266\303\254\336C\321a\266"
+	.ascii	"\216\367\t\267\3332Ns\370\307P\021Y;~\261\024EIv\250\206wX:\216"
+	.ascii	"\026\247\357\363%{]\270~\235c\201Yu\344?\200\026\036R\375T\036"
+	.ascii	")!\274\335\302\267\240r\017+\307\306\265\360M\006ZH\035s\273"
+	.ascii	"\354\\\201\360R~\213k\030Q|3D\315\020\276\300\276\357\026\220"
+	.ascii	";j\226\274\345\314\230\006u\034\345\241\322\217[!\036\323'U\331"
+	.ascii	"\2656\315\r\233\306V"
+	.string	"P\206\306\262y?\314\256a\315\234\002=,K\306\246\341nf\325\332\240S\236\240>\341\236\3518=\247Dl\327\354\231k\025k\3704\371\334\344y)\200i\037\254\360-\330\2572q\205\177<=r\036\274\224\235\003\030\335W4,)\033\260W\272\275\376\211\245B\t\r\215\276\370T\341\215Rx#\257\302\267\200sFQ\370\024\222\3300H~\247\307\316\260\344\363:k\3302\320\343\300Px\277\353\033S\362\372\366\362F~(\260\330\301K]\0164\200\3218\2342`\263\272\275\374\323\t\237\344\323d\277\214Z\320\372e\031\330\200V\257\023\276\005\373\330\r^\352\032\334\030Z5x,E\236\303\026\333\305\250\317\246,\227e`\257\231\262[\212\274K\005%\244\362\007*x\33020\301\204w\253\2362j\272\255z\250C\256\027\270\3233kAO\277\273\376\211\325b\005\r\024#\362\305\356z\"\277\201\253\312\326tU\302"
+	.ascii	"\205\326\364\335\351_\315\317\005w\025\370\223g\226\202\326\362"
+	.ascii	"=e\241\f\223\261`A\362\215\226\367'\377j\177\025T\215M\340N\236"
+	.ascii	"Y\t:\313\267\026\337\262\027\026\264\205\002 k\226w'\377jt\023"
+	.ascii	"TI\211\300\233\236Y\bZ\372\235\245\200=.D\005H\360O\351{\323"
+	.ascii	"\277ZY\004\202B\334\371\314>\320X\276\245\336\225\370z\027\004"
+	.ascii	"/e\203\345\335\371\237\246G\310\232\003\316\364\3146\320\\\337"
+	.ascii	"X\332\n\213m\017\bvs\2753\375"
+	.string	"\247\3459`%\032\204\354\250sa\205\261h\246G%SjfD\222$)4\006\223\027@P@0(Y\005=\306\007\023\200O\312\362\360D\317\342$T\203\323\2242\034\302\"\372\240!I\355\241j\323\001\346*\021\233Vn\237\252\312 \236\210\374 \344z\312\\3\234\307c\254\231\242-\251\354\274\013\337+3E!\376\233p\213\261\201\217\354\3346K#\017\n\243\240\t`\361\021\005\363\314\266 d\257[\353;3\307bL\3101\207F\024\330\031\351\031\360J\265Q\232\226\005\340\tK\360\376\217\310\361:\030\035\347&*\203\241b\325\260\030\023V\301\r`\257A\233R\310TA\227!6\272kXpI\f\n$\336\321\317\307#p\303\002=D\035C\333\330\276*1/6h\036\365\\\030\366\342\312\363\263\324\274\223\236 \222\003\3024\373\251\204\275\275\020\301\221\242Ru\254\3244\204(=\037\343%\212\303\254\356+"
+	.ascii	"]\303\217Y\203\335!Q6\222\206\366O\261\271\316\234\315\275\016"
+	.ascii	"\306\306b\037\201\001\273Z\350\243\201B\362l\354\026\224@\216"
+	.ascii	")\"F\022j>d \212\021\367\036\357s\324\037t\345A{\275\3679\f\314"
+	.ascii	"\205\247\243\340\"\\\355C\366\303\346D\363]}[\210\332]x\276\323"
+	.ascii	"\325\003S\255\235;Y\242\370\324x\315y\333\262\371Y\223\201h\276"
+	.ascii	"\366\003\246\372Uw\364\276\270\247\0363\005\242\243\335\205\356"
+	.ascii	"\300o\315\266\273\241+\b\245\375\331\362(\277\005]\022u\3741"
+	.ascii	"\345?20\024\251a\200\360\342\331\360a7\234\345Z\264|\202\257"
+	.ascii	"j*\016\035q\301\240\0378\0033\321\033w`\322\247\"\273\362\307"
+	.ascii	"\301\254\332\016\207\311\213_\221a\215\263mv\333\0310\321\337"
+	.ascii	"J\317\2643~\024\262\324\005L\257;Ydn\223:\271x\274:\316\377\r"
+	.ascii	"\372\016\305\3516\242O\023\274K|!PU\3224\273\202\263\351\242"
+	.ascii	"\305>\221A\002\227\316\312\022\356\007\360b\300\310\230\200{"
+	.ascii	"i~\305\027\017?\t]\230U\205'\243\366\006\367M\310\373^\270-\346"
+	.ascii	"\311\315~\326s\004\271\307>S\323\304'\314{\227\036LU\364P_o\255"
+	.ascii	"\273?U\031y\207\024\347\tz>\351\347|@\231\242\252\347m\201L\037"
+	.ascii	"\352\234\214\r\245\372\322\223#M\225\352\307\226|\016\035\251"
+	.ascii	"\337D7\351\016\311\023\f\036\2516\361\373\376I\356D\354y\333"
+	.ascii	"\007\305\316\256\353ZGjA_wm[\224\341\203\022f\325$\327\001p\262"
+	.ascii	"4[\236e'd\203X\021\364\233\341\036?\364F\221C\366\023<\340\232"
+	.ascii	"\335\\\226\356\341\f\303\bm\253\034\223\306\347\341f\017}\221"
+	.ascii	"\314"
+	.string	"\364\370\247\213\353J\005v\241w\217\212\337b\205\202L\363\266Rh\264\220Wd\217E\263*\200E\033L\261]\333\200n\311\324\032\244\241v\343\327\336\332\333\314S\367\216\212\302\274\177\3238\"\271V\330\305\370\254\023\031\334\003q(\204~\327R\310\370\222\315 \006s\233\334\261B\213\276!\fIx\277UP\322\030\fi\226\226;\356\366\216c\2647\334\2378\032\0320\254\277\\\2005\230\002\302\266\017\271$\377\225]\216\233a\321\230\310Jc\257`l\316\340\301{\217\342\r\236WH\271\017\376\237\337\346\202\367\220KH\227I\350!\217\216@\246\f\031\373\234\247K\344O7\224\251\270\272\200O\343\024)v2M\343\2002\223x\251T\370\013\032\021\336\320pDE3\226@m\226\332\313\013\247^\271\234MGk\373\303\007oV\241\n\023\254\303\275\355YN\336\250\377\007i\260\252\032\266z\215\367\255\016\374\343-PO\232"
+	.ascii	"/e\367\211\212\201\366\003\321HkBD@\326\324C\277%\013\371\227"
+	.ascii	"\330(\222r\242\227h\361<Y\332\032\\i\327\337\036L\035h\247\220"
+	.ascii	"I\321D\231!7\224l\023\3572"
+	.string	"\351{);\252<\310[m\035v\255\017n'4l\301\254_ \223\340$\322\214\206}\364\305\007\324\343\256\017 'c\354\027\301-\234w\n\323\003\\\237\223?\205xz\360\353w\241\001\236\023\277M\023\346\261K\333,\bk\237\004I\270R-\367\332\020\263\266\371\363\310\205\315\206\f\345\320\002\300|0\340\212!\242Q\322\226\231\177\32699^\215\260\232\327\334\267\316\373\253\233\216\242\200\340\274\252\213T\256\374\352\251\247\227?\251\360\276\275\261L\035Z-\"\035\225g EP\243\3721'\254 !\30258\240\266#h\214\316\n\337\017\201\230\326\316\3725\323\237\006\262\227\034|\025[\250v\335\033e\3632\246H\255\367\317y\017K\016\367\304Q\211\037\305\201P\340\310\217P\361\313\233+J\032\377\202\023"
+	.ascii	"\371\357\005\341\304l\303Yz\2146\323 ^h\311V\246\276\242\355"
+	.ascii	"-\023\024+\305a\256\202zFi\n\002a\017\237\252\340\320\2009y\314"
+	.ascii	"\240!\224\313\276R\306\276\013{h\026\234\b\347\315\361\207\351"
+	.ascii	"t)\b\377I\364\272-\033\322\302e\276\257\317\204\331\020\034\237"
+	.ascii	"}&\232\356\365$\356\316\360\2350\351./\376\364"
+	.string	"\347\201\b\375\2424\373\343\257\024\356\017Z\262\3227\340e\267\"^ \223\360\340\217\251/7\314ff\341\252\354\307\331\304\214r<a\360^\260\227\246\3506\3678\350\007\243\253^`O#\0265RQ\034tqw\273\270\2247\313\006\0071\361\017\030\215\351\204\243\236?\311H\321S\372^i5\354Q\013\260\225\245{$\304*\256\202\"hv\226\356Q\023k6\352\214G\017]\353b\004\364\355\312g\007\334}y\f\314Zn\353\006\020$,\221\335\361\177h\027\352\222X\351\025L\254\332\200<\343\3555\300A\004\004\226M\307\242\363\2766\3572\266\273W\203=K\214\251\362#\335\021\247\323^\013\313\260\025z\356D/\357j\362\037\247\013\203\330\376i;\223\257 \306L\b\332\3054\327\365'\262g\220%8=\223\224\020.L\202)M\020\377\274,\353\002-\016\203\353\2409\356\354;\262\223\034\277e\350\323<t\300z"
+	.ascii	"\210XA\207\234Z\232\367\021\244\214\030-\307?\\\216#$\361~n\265"
+	.ascii	"\025,$\013\353$H//\212\215\222\251\304\354\033+\363\\\273\263"
+	.ascii	"\r:\367X\005\342\302\323L=\212\344;\3041\030\251\371\247"
+	.string	"\206\3348UA\305\344\002\352\371F\027\212j\222|\357N)\235\024_r\236hS\312\301\265`\304\200{\320\314\262\210\036C\217\205\206M'\270g\303\266\272\251{\234\242\302U;\031\324W\026\344\234\f1\302\342\316Y/\347\020\232\231\222J\205\251\006\027\220\315\352\001\256\206\344\004\242\254\320z#F\332[\316\204\373\026Qb\023\034\250t,`\006\322\265reA\223\201l\277cx\334\356\002\001\267\362.2&6\311\013A\243\252B<#\312\211w\006\362pKh\340\f\223c\266.\371\211\200\254*\204\246(-\211\\\262n\234\350&Qj6>P\341K\034tn\024\361\322U\251\030\b1\363\240\266$\212VW\303\241[\0069\261\034\220P8\300\205~&,\243\200\004\3111 \bn\304#!\222\246\246\210`\332\222\343J\312\356\213\211\261\330\277\243\023\207\273\210d\266\324|\r`\345\332\324\334y\241\203iG\237G"
+	.ascii	"\275'1\322\037D/\225\004\030\347\211\234\353\206l\202\026\233"
+	.ascii	"q\320.\252\271t\252\020\243d\b\250++\367\333\037$\204a#|\214"
+	.ascii	"5\307\327\211*]\240\217A,\002K\277\277\225\n{8v\333\332S\372"
+	.ascii	"\330\022\237\321\305\276r\242\353\266\336\205\260\356\223\021"
+	.ascii	"\321\317\250R\241\246\022\360/\227\351}\\w\271\254\307q\307\320"
+	.ascii	"\034\312\214\254\373\331\325gv\013\207L\261\021H\027:C\n\021"
+	.ascii	"\026\332\220\270GIM{\274\033f\024RD7`\245\271\206\004\210\372"
+	.ascii	"\250\361\017^\036\035}\026;Jh\220\315\241\253kT\242\246\"\322"
+	.ascii	"\2415\213[\233\202\303\br\247:\214\022Q\007\035V\256\204\207"
+	.ascii	"\217\344\017\310\024\267|\266u;\035/\304\020O\227\0324\t}\222"
+	.ascii	"nD{\373_\313\213\321\217*8\027\233\034;\327\032)<3\317\237\202"
+	.ascii	"\367A\344\025%\237};\370\213\362\363\244.\215\021\023W;\256\210"
+	.ascii	"\332\306\346\210\231\255=C 1\334\316:\354\025C9@\241\253\206"
+	.ascii	"\016\351\252\324\034\235I\251\321hnN\027\001\340\244x\207*]\022"
+	.ascii	")\265\b\344\336\242\216R\250\276\317\032\221\3504C9\213c\016"
+	.ascii	"\201L\322\016\355\034\345U\2039\274D=2\317\356G\315\232\r\022"
+	.ascii	"g\324\222\376\263h5\231\3327S\306\360\204\241r\016\305\002\r"
+	.ascii	"(#\230\344\""
+	.text
+	.section	.gnu.lto_smartPortProcessMspRequest.part.0.189.349192fe9412b535,"e",@progbits
+	.string	"(\265/\375`F\006\325#"
+	.string	"f\375\327Fp\236Q:3@\344\376\311\033A\313\222\2630\202\302\022^\350.b\327t%f\004\244\240w7\376G6\t;\354\266\214\377\r\330v\027YT\326\244\016r=\005P\340\3573\321\272j\272\267\343\332\320>\341\266[&\031\271"
+	.string	"\272"
+	.string	"\317"
+	.string	"\030n\267\017:\201\363b\314\247r%s\216\233N\306\317R\215j\271[,O\277\"T\020\225\274E\013r\230\266\231_\345V\232~E\330\311[\274WY2\f\302-W\270\335\n\350\246\346\213=\361\30787\345\351I\247\016J\336\034\305(\227\222>\351\364;U\304U\3358\303\2747\371\340\226%\334n9\371\002\347\355\355\004\316\333\334\355\2410\363S\221S\346\264'\221\027\345\342BU%\317\275ww[\267\236\336\332j\237)\037\352\266\211VW\267\001Y]\275\332\020\034\317\354"
+	.ascii	"`%esp\226%\347co\033V\303\356\001?\321\f\367^\276\031\317\350"
+	.ascii	"\231y\0043o`>\263\002\225\373ix\2706jy\320\234\301\265Q\323S"
+	.ascii	"\337K\210\307\263Z\265\230\271\304Y\253\n\2622\251\336\303\314"
+	.ascii	"$^\246\204\235R#bf\031's\"\200W\032\330\275\267\202\230\217A"
+	.ascii	"\301Wr\313)\222\234\316\333Z\355\224\332\223(\257]O\365\207\017"
+	.ascii	"\346ax|%\334\363\365\211\276\363\366\225\217\027\363(\326#\252"
+	.ascii	"\233]\265\270\236\267\335j\204Y\327\254C\233s\271f \240f"
+	.string	"\034\332|\3035\243\266\371<\226\263E\233m\267\346j\233\033m\276\220\201\242\260{\253\232}.\226\375\322\365)\277\227\037\313+\363\371Z\226\234\363\362\364.@\250\342\275\305-\347\222\276\013\320v{$/\224\211\264b[_\"\361\211)\222\345\233\353\013\354(\306\374\322\316\031\226\355O\223\234\334\304\266\221&I\271\322\256>1\355:\357\200\r\365\311\272\206\021\021\262\251N\3264Z\352h\207\354!\223\324\211\316\314\030\263\030\027\236\334\024\n\375\301\035Y\313\263\326\240\317z\262\367I\237\3508\304\371\034\r\241\355\341\024J*\326'\262\002\032\025\212k=\353\307\316\300\2706tsEx^\311\251\224\337\261\303\246\t\266f\353\225\254\341u\204tP'\177\364\004a\372\034 ?\347j<\fhi}\317f8<\016\23473\312\312\210F\345\335\0305@\2737\352D>\233\267\351\340\301\310\210?|\215OH\311!\256\346\350"
+	.ascii	"\322\354g@\021HH\312\017\331\3613t\2434\332\252\r\301\036\013"
+	.ascii	"^\022\323\271B\211W\203\300\036\214\027\275\037\312\274\b\301"
+	.ascii	"\337\022S\360\227\244\004\3345\375\202=\245^\213^p\347\302\227"
+	.ascii	"\244\264\343\375\200\273\b\013x\211\251\367\333\005\227\226~"
+	.ascii	"\273\0343\3673D\325!W\013\264\335[\244\2109\326M\236\320\377"
+	.ascii	"\362%\322MH:\004\217\231T\205b]e\326\360\245\220\211rUW\337D"
+	.ascii	"x\027\276\314\260\206\344*\352\325\347\tPe\346\320Bp\025\255"
+	.ascii	"@5\310\317T\223a7\371Vq\365)\221\006\302\253\310\037>n\225\302"
+	.ascii	"\024\036=Q\320\312\374\241y\370\230hy\304D\267&\322\360\020\351"
+	.ascii	"\364\225R\002\264{o\232\325;R-\020_a\3070\333:N8y1\217a\235\003"
+	.ascii	"\2552\322\232Dc\272\325E\3348\272*\r\200\206\250\2018\304\024"
+	.ascii	"cJHF\n\232\024\n\215\001\220\002\021\"+z\021\220\265cS\222Di"
+	.ascii	"3\300\326I\322D\212\207\223\230\372\2739\n\220\210\007R\200\033"
+	.ascii	"\325y\244\341\221\024\037\271\231\235zU\177\tLV`\226\217\374"
+	.ascii	"\270\200)\353|\264\321V\025\347P\021\314\3256\007l]\tD\027\333"
+	.ascii	"\213\344%\373\036#%v\353\204\036\244\314\021\244\275\372pL\371"
+	.ascii	"\262m\374\323\351\372\230G\200\347E\252\3663X?k\230g\316\342"
+	.ascii	"\240\022\235\357\214\245r\242\006\356:3yzD\232\035\334\241,$"
+	.ascii	"\316,\262\350&n\272\317h\360c\331f'\204\231\262\210s7x\375\f"
+	.ascii	"`u}\200\267\035\341\267* \353.\217\034e\216\361\231M\213(\371"
+	.ascii	"\207\211\030j\204\007\n\354\317Uj\262\032\r\300\020\006\247\037"
+	.ascii	"\231\210\257N\230\367\311\370\311\322\f[\261Z,\001\225T\263c"
+	.ascii	"\330\205\237\305\203\271\356>\231\006j\350v\305\2671S\371\315"
+	.ascii	"\025xhI\242\006\214\352\032\003\201\377i\367\335\232G\206z\340"
+	.ascii	"\243\002"
+	.text
+	.section	.gnu.lto_configureSmartPortTelemetryPort.part.0.192.349192fe9412b535,"e",@progbits
+	.string	"(\265/\375`z\001e\016"
+	.string	"v\031\\D\020\221\232\016H\251\367\211\\\354*D\321o\377\337\367\370\177\0015\017\f~\360C\361\006z\035\030\331s\300~\3239\266\306\032\302F\200'\243\220\002\221B"
+	.string	"(\252\352\320\227\373\355\225\224\353\361\003\321\2266\331;\245D"
+	.string	"K"
+	.string	"H"
+	.string	"U\212\031\035jvk\347\323\t\252\317\216\027\240>\247\023\240>/\302\366\027\032\264k\274\222\3661\031JJ\224v\227~J\016\007/\343\004\372\242K"
+	.string	"'\027\036\007|\342|v\327\025\206{\336\266\002\333\036\366a\0041D\3619\3443\2420a\222qA\303RZ\222\332\261\211\237\b9\304@%Y`P\"\243T\332\255\364\323\265\222\366\021\220\034:\t?\006\315\356Z\321\177\371|\030[\365\273\213\210;H\352\236\204\257\266>=\342-\340]D*Q\030R\344?\243|\025\237\311 h\032\365\311\261y\021\342\337(?\3462\233\277b\t]\274\311\247\337Q\237\207y\\\361@\003\205\345\306H\274\211R\305r\372\264\273k\231b\317\350s:-\002Pv+\334\344X\rs\305\207\277<~\340\351@\266\314\003-\260\374\341\361\270\r\344q\227\326\321\020\347a\032\026\001\363(Hvi\364\203\353\250\347\2007\020\306Qo\3338j\331\216\227)\376\214\310\221\245\224*\322g\361\026\036\r\256\313\306\304F\200hc\016d\334"
+	.string	"b\006G\315(( `\202aN;{\001\342\325\314\016\020s\006sMJf`\025\246\200{\222\3713\307a\2601\273\332v\310\b\306\246y\357(b\255W\356d\202\335\260?\030\246\263\035Lp\0239B\334\303\276\265\302\356\2419\"\206i3v\356\247\256\262\375\226V"
+	.ascii	"\023\257\034m\323Oxc"
+	.text
+	.section	.gnu.lto_checkSmartPortTelemetryState.part.0.195.349192fe9412b535,"e",@progbits
+	.string	"(\265/\375`)\001M\r"
+	.string	"\226\327UC O\234\016 \347#\242Q\250\225\206\223\326\321\013S_xrw\n\354\032\314^\031\337\003\304\331Nl\326\364\257\007x\202j\305\307\207\260#\004m\210PB^\006\022\212\250b\324\270\035j\024\330h\223\275S\n@"
+	.string	"A"
+	.string	"E"
+	.string	"\273\342\200S\027\230\234~\203m\023\207C\373\305\305\f\373\021)\"\220\264vw;\235\030\036~\312+\364e\252\343\364\371\361\024\326\310BD\207\204K"
+	.string	"\277\262\314\356z2\341\246\267m\300v\002\373\026\002;?\354K\372\031\345\200\212\335\215\222\031{\201\236\320\360\221\337\276\357\341\243\255\271\364\016\2462P\354\256V\362\375\021\223/Z\263/\030\323W\2409\316\301\332\251/\230\360+\260r\022w\343\262\302\205H+1X!\033\314'q\326\206\323\351`\247\004T-<D|\022\026\"\243"
+	.string	"\242\005CC~\372c\347@>\345\n\204y\262O\362\017$_e\321H>u\352\217\260\323\317\217\247\250B<V\025P\262DN\020\317\353Wu\344\341\0264\250\036\006\034\b\201\002R\005\005\260\306\362y]\350\363\270\217h+y_\375TO\3756\020\207\373l\032O\264Y\004\270\013Uo\373\272\316\333\344\257\235\037\316\240\346\2039A\fb~\211\233"
+	.ascii	"5\265b\247Y! `\002\031\303\266\003\322&\250\302 \257\214\361"
+	.ascii	"C\227\274J\344 \301\005|\310\034\235\374,\246\316\023\330d\275"
+	.ascii	"\017\326\267\267\360Dk\230#\\0\213\355D\203\t\332\307\022\227"
+	.ascii	"Q\214=\016\263`\f5@k\312R\003\340\366\320X\b[z\202\032\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.349192fe9412b535,"e",@progbits
+	.string	"(\265/\375`\271\007} "
+	.string	"\266u\303BP\346M:\353\216\006\243\200\025(\t\210\370A\276},tnl~>\367R5\2545\362r\271`\256\t\344\313\337\377\277\357\356\377\377\275B\305\267\013(\001t\022(4\267\007 O\247\273\367-\362%I;\262"
+	.string	"\255"
+	.string	"\264"
+	.string	"2\362\265b`=\025\006&\224\266\254\231\027\371\256\353\"_\256\005\316S1\026\013\\HuW\344\307\245\030c\004*\362\323\244)p#\025E>\225\023\371Y\251\211\263\225\370\232\352"
+	.string	"3j\200\367T\bO;h$\362\271p\363k+\312\210\3746EbY\226\025\221\217\225\206\370\030\020\027\2432x\230\365h\037\016\346]Q\264\327C~W\332\001G9`G\033\360\243\003[\306\350i\310\337J3\340E\030~Fu3\b8\321\005\214\310\002\036T\341e\024\260!\2651\276\313NaE*\306\330\307\266-\013\207q\306\030N\327;\032\215F'\344\263)\306\030@[wJ?\300`\373\220w\200\347\004\003\006;\t\372\002eso\""
+	.ascii	"\373\227\274R\353\245%\001\330?\367\304\254\264:Q\270\235\336"
+	.ascii	"R\270\237\344o\321\312\367\342\346#\263\362\303\332|-\307\312"
+	.ascii	"\377:\233o%\347_q\222\357\325$\377\215I\376rI"
+	.string	"~\333U\276\233\222\374\264$\371d\220\344\253\035\311/c$_Y$\037\313Y\226\305\270\211H>\330\207\bP1\226\020\354\f\362/@\236\374q2\037\037\353\361#\217\213\355x\027\035\207Ss\234\013\016,H\275\201\0175R~\355\331\310\257\222Z\345KIk\344G\251\312\207B\343Yf\344?I\003\276\344q\023M\233\227(\006\375{>\035s\262\311izj25\346\037\354\346\251\251\330,h\2539\005\355\324FAS\261I\320VRM\375s\343\214\375c\312\031;\370\026\215\355s\345\212}\350q\037;5G\034W\354'\217\3042\213\rD\n\211\315\324\376\201r/L8\354a{\225L\236.\341\260\225\\\347\324\260\223\352\340w8`\031\26665l`\373\347\333\355\256\020\243%aW-\t\333\007}\2326EL\217\357\356/\347\220\236#^\263\3247\336*\350\204`W\265\037.\305\226\300`3A\337{"
+	.ascii	"\275\315\251`3\271\357f\227$\035\034\027l\001\317\007\b8\325"
+	.ascii	"{\005!\323\273d\332\347}{\351q\021\327N\315\3367\027\036\235"
+	.ascii	"\220\211\351\326N\311\332+}\345\305\331\333k\237\356\233\265"
+	.ascii	"\177\006\271l\225\317\264\227\270\366\321\2367k\257\240W\355"
+	.ascii	"\021$\221\344\220\367\001\336\354\370\020\327\376\361\376w\305"
+	.ascii	"\256\216\270v\215\347\221\356\234\255\021\327nb\276\b\347m\303"
+	.ascii	"\316\265\231\336\253x\346\344\031\327VjO@y<\016\327Nb\276\003"
+	.ascii	"\215\251-\222Z;\ty\003u`g\306\265\203\355\3254zc\301\265\201"
+	.ascii	"\3117\036\035\237\262\250\265\177\317\265\335\330\266\034\341"
+	.ascii	"\272\265\235\244\326\376\023.\001T\377\375\235gsoOPM\250\016"
+	.ascii	"\200\211\250a\020\306\023\223\004\231IA\251\260\214\001\320\002"
+	.ascii	"!\242\242\016\021\200\034\351\025#\022\214D3AA\272\001V_/\017"
+	.ascii	"\274\222.\264\264\360\274\324\375\023.\003i\0043;=\007d\274\025"
+	.ascii	"_p\232$xA1_\307\211\316!eKy\241=l5\217tw0%z\177\261\211yk9\347"
+	.ascii	"*\324\345<\335T\346n\217\350Q\212\354\270=\260\241\273$\273\023"
+	.ascii	"O\375\206z.h\257\317\003\022Y\225\232\307C\205\252\352*@K@\207"
+	.ascii	"[\246\362\\t\027\345B\273i\256\351\207.\242\215\335BB\320\027"
+	.ascii	"\244c\315\275;E\307\006\177mfK8 {\260\177\305\375\027E\270\235"
+	.ascii	"#\353\311\3204\211\246\277XI35Q\266\tK\210J\271\f\354\003\341"
+	.ascii	"\013\024\025i\302\030\230\374\023\356Ph\241\201\246[\312~u:^"
+	.ascii	"\324\t\245\264\033\356\347\035\262^$\2723\365z\\\212\202M}K\207"
+	.ascii	"\237s\217\325\236\273d5"
+	.text
+	.section	.gnu.lto_.refs.349192fe9412b535,"e",@progbits
+	.string	"(\265/\375`\327\002\265\023"
+	.string	"\226.\202E\340\260(\351\330`>Ff\370\306t\024\326?\304\354\237\274#1\341\002\332\001/\304\336\232\006\352C\206\031f\230a\206\031f\230\241\334a\332\336mA\030\240\f#\373\304?\360\237\030\355\243\366\177\301\377E\237\264-Sg"
+	.string	"k"
+	.string	"i"
+	.ascii	"\377\321uW\251\263\274\276\"\345)\257wt\275\344u\222\327\267"
+	.ascii	"\256#\325\237\250\273\270\234\305\365\025\327U\\?\205\236$z\216"
+	.ascii	"\313A\334o\334w\270oh\016n\226\255\313\266\217i\035\005\324a"
+	.ascii	"\333\207x\362\257\335\365\351\253\317\253>\035\245\365\270u\017"
+	.ascii	"Onj'\365\273\354\243N\017\301\377\364=\332w\264\016\263k\355"
+	.ascii	"\3615\233s\304\016\212}CUs\221\006\265\372\007\225o1\357\304"
+	.ascii	"\034\306\256\305f\354-+\264\211\352Eb\376\251\372\207\352Y1G"
+	.ascii	"\245\372)\365\036\252\356\305\027\305\374\023\277\223\352Z\352"
+	.ascii	"\023\2257~\352\346\200\277\301\327\340\035\332\327x\360~\016"
+	.ascii	"\244\374\r^>M\327\007x\017\323\365\227\322\273\230\372\212\227"
+	.ascii	"\317\274<V\352'\245/\351z\210\351"
+	.string	"\277.\035\026z\222\354#\255\016\322\372/\373J\364\251\326\243<\371\311\363\036\240n\002\275\007\237\203\357y=\204\237\337(\233X\373\276#\237\344\235\327\3756\321\326^\227\344\"\330=\260\327`_\221\001@\0228\034\351)\322\220\274\363u\370\352\032\354\205\203\300a\247\347\327\373\352\207v\344\336\304=\211\313\273V\037\241\362Q\314E\261s1\003\237.\362\023\247\305\212\024\263\317\02376\262O\022\"@\264\364\234q\371\234\340@F\300g\202\226\317\030\330'\002\003\331\223\300\215\03295,\337\016+\337\f\030fTz/\250|-T\240 !\002\204\007\r\030\004\370.\220Q\020#\373\036\310\336\0026h\304\376\234\0312b\300x\201\303B\005\212\233\022#`\177\210\232\331\377!\3734\262_\203\354ab\375%\366.\261\336\222\362+\261\237\211z\212\350c\2416 \320\0029\353b\204\\q\213\222\306\205\242\252\270\207\017F"
+	.ascii	"\002\026\002\210;\027\254>\246$\004\204\013V\210q\242`8\244\210"
+	.ascii	"c\202\301\200B\026\267\206c\301\314\200\204\210;\230\020\305"
+	.ascii	"\361\301\244\220q\n\026\n\201\343\366(\002\321\220\037:\344\330"
+	.ascii	"\342\351\211L)e\350`\"y\205G\316\031Q\254\204N\245\200>L\341"
+	.ascii	"F\326+\225\002"
+	.text
+	.section	.gnu.lto_.decls.349192fe9412b535,"e",@progbits
+	.ascii	"(\265/\375`0s\235\347\001\212%{\260T \fY:\215\001\326'\207\362"
+	.ascii	"\372\254\267sZ\237\237'\312r3\b\035l=\272`~t\345\215SdO=0*\263"
+	.ascii	"9\036^\232)\212\203\321o-\221Iv\273t\266\211\007\013\013\301"
+	.ascii	"uzI\207\023\205|\252\202R\t1Qj3\276!\027\265\311\275\267\224"
+	.ascii	"R\246\255\t\025\013U\013\277\"\372\307=\256\227\3546\225\006"
+	.ascii	"\357\346\037\363\300U\277'Jm\334\244\211C\367\346\214}\273l\354"
+	.ascii	"B`\027^\226\230\006\276\201\245\260\025\206\302;p\024\316\201"
+	.ascii	"g`\035\270\006\236\3026\260\f\214\003\307\300T\266\211\253\360"
+	.ascii	"\323\361\013\f\343\031\357\315\262\371\207\300L`\312\256\234"
+	.ascii	"\333\307fF\313\035\234\245\323\333\tp\352\356p\025\336x\311\302"
+	.ascii	"\235\221\320\013s\227\367\333\267\273fo\2717\323\276\335=4!p"
+	.ascii	"\213/\3136\270\352\352\331\271\036\2747\0175K\\\205\233nW\217"
+	.ascii	"\022sK\245E\270\264\272\366\366\336;g^0\241\341A\266p6\b\345"
+	.ascii	"`\201\320k7\372ZN_\267\351k2}\275\324\327@\260R\306\023\333\202"
+	.ascii	"q\363u\024Nrs\347\350\360-\261U\335\374\364\214\346K\341\364"
+	.ascii	"S+\372\251\227~\252C?m\322G\327\350\243Yt\207'\372\250\020-\302"
+	.ascii	"\006\241G\251\364\317>\375_;5doN\224n\276j\322\240\341\231\362"
+	.ascii	"E\310\0274\367\214U\336\216(7\327\241\\\244\356\346n\376\211"
+	.ascii	"f\356\312]2w\3145s\313\330\346\245\273p\277q\266\354\331\214"
+	.ascii	"\316\312]08\212\224V[\002s\327&\246n\351\226%\213\216\356\206"
+	.ascii	"\261z\230\271\246\233\310\276\334]-[\306\230Y\206\321].v\256"
+	.ascii	"'\211\271\243\020p\247f\313\327\336L!\03797g\\z\362\3170\315"
+	.ascii	"c\201\320\237D\364O\035\367\213-3#\022\347\346\237-\364}\273"
+	.ascii	"]l\363z\371\276\260\003d\355L\351\346\025{\357m\357\206\246w"
+	.ascii	"C\237\327\350\3478\3753\033\204>W\321_\263A\350\267\330 \364"
+	.ascii	"\266y\261\260=`I\21637\337\265{\345\227\355\252]6\023\256\366"
+	.ascii	"V\272l>r\366V\362\261v\003k7\310N\262\220TA\363\263\024\375\337"
+	.ascii	"4\2641mI\272n\225_\264\377Z\271\315\035;\304,\335<\202\rBQ\013"
+	.ascii	"\204^*!~\253`3SWj\334|\336\263\260\013G\274\306\226\314\254\036"
+	.ascii	"z\243E\034+S\244\316\26276`\2440\2774\247\332l\245-/\363Z\335"
+	.ascii	"\256\236s\357+\264\345\336\333\2761\357\021\265\273\313\274I"
+	.ascii	"n\030U\372\304\034#\266\267\367\376\177\307n\331%\273Ql\3632"
+	.ascii	"\357\223_\261\013\205g\r\22348t\262e\002\241\317Y`BV\206\030"
+	.ascii	",|7?\353\320\377o\223\373e\233\327\311]r\373v\275\232L\256TO"
+	.ascii	"\022\206\275\177\200-\235\\%W\312\302U1\367\214\0048\351\001"
+	.ascii	"goo\246\220\007\017y\211\214\316\013\232\217\337\350\343<}\254"
+	.ascii	"F\037\327i\273m\020z\221\334\245mn\270\\yC\226\246n>\026\243"
+	.ascii	"M\260\267\335\200\332\276>\273\001=\356\242\217\257\350\377\032"
+	.ascii	"\331\300\344J\217 E\256\326\221\032|d7\013\351\301\303\252S\""
+	.ascii	"r\207p\365\330\203\273Y\b\3637dJ\035\225\233\217\301\364O\300"
+	.ascii	"a\347\204@\265\241q\2530s\231\2325\311\270\333{\277\204\254k"
+	.ascii	"e\347z\222~\366\322\\\214%\326\005r\203\334\037\266y\263n\216"
+	.ascii	"_\035w\307\355\235\361\207\270Y\227\307\365\321\223\304\334I"
+	.ascii	"\251\220(\253\274\275\2757^\263\202&L'\377\367\352\327\307o\311"
+	.ascii	".\225\235\373@\005?<\2515\256\233o\217\020\277W@\250T\025s\237"
+	.ascii	"\231\321\250\212\273\231\001\026\b=\236\322\271\312\006\241'"
+	.ascii	"\213\243\177\335\350\337<}k\\\033\266)tol\037+fI\206\216\233"
+	.ascii	"\177\317\350\023l+\204\276\317\n\241\277et\3366\b\025\262A\350"
+	.ascii	"\177\247@\320LX\254\204I\315\3351_b,Eux#\267\364%\003\352\002"
+	.ascii	"\026\2565RP\2771t\300\262l\271\271\371\302\020\3025\244\224\245"
+	.ascii	"\335\374\273E\277u\261i=\277\275\261\372\314\326`,\325b,\255"
+	.ascii	"\2243\233\326\303\364\263\231\262\240\226f_\344\220\335\3318"
+	.ascii	"QdQ\\\234\300\3308\013wF\"\013\2347/6\315\302\235\221\b\233\363"
+	.ascii	"\337\026\267\351:\335';\307\362]\246\373\342*]\027w\311\312\271"
+	.ascii	"\333\366\331\346M\262in\325X\273\0131\367f\332{\337\206\375!"
+	.ascii	"~\022N\270IV\316\316Y\270\252\0048\331\013a\306\242\341\260\344"
+	.ascii	"\264B\225\232\022~+\345\212M\303Q\244\264\031\331\213\260\233"
+	.ascii	"d\261\330-\"\\H\375`\214y\272\333\233y[\366\207\270IV\214-\303"
+	.ascii	"\341io\254!\030\374\340\303\002eoo\246\007!\017\036<x\360\200"
+	.ascii	".\245\221)\301 [8]1\302\300n\376\265\241o\233\366\315\236\233"
+	.ascii	"\225\244!7\377\326\315\355\336O\302\tW\303\263w\330\336\233\003"
+	.ascii	"\376\242\345Uv\363\333X\275\377\277\f\305\253*\310\315\026\317"
+	.ascii	"\346\331&\bv\315-\033\333\346\247\022s3\367f\372\334\"|T\310"
+	.ascii	"n\376\261A\350\265@\350/\224\276\005\001\305}}\026\004\364WI"
+	.ascii	"g\246\rB\177\326\006\315\031\364,\n\232:f\356\232SCr\363\177"
+	.ascii	"\333\264u\226\216\271\205P\2611C\336n\276%\243o\277h\246\317"
+	.ascii	"\2059M\346\304a\033c\311\370\270\201b#g6f\314\302\361$\231\021"
+	.ascii	"\265u\363m\022\033\346y\354\352\002V\262\361E\355\346[#\3726"
+	.ascii	"K\337\332\320\267O\372\307\002\241\267[\377v\213\226s\211d,\315"
+	.ascii	"\315\266\315\272\331\346\0056\313I8\3418il\207\355\r\347\303"
+	.ascii	"3\007l\214\217\233\277B\337^\200\332>{\001\372\243\326\300\002"
+	.ascii	"\241G\241o\001}\025\264\245b\253\330f\007\213v;\305\232\375\307"
+	.ascii	"\304\334e{3}~rkv\234\335|\006\350[+\007\300\330>\341A\372\266"
+	.ascii	"\003\352\323\327\327\327g;\240\327Z\003\033\204f\013\204\216"
+	.ascii	"`\201\320\303\331 \364L\013\204\376v\3142S\260,Yg7[\346\265P"
+	.ascii	"l\224[\246\025;\t'\234\207i\207\355\315\264\314\274\267\222\265"
+	.ascii	"\033\364X\273\301\351vD\211\f\315\366\311o\301l\330\005\330)"
+	.ascii	"\306\325>\333\233\211\301\207i\003\352\307\315g\332 "
+	.string	"T[ t\315\334\177\264\214\367g\273\377pt\251\333\217\303d\272\r\262\231\337\222\350\300Vp\271\013\3451\016?\221\303\344J\370S\264\377\356\374\266\312o\325~\333\374q\006~\034\201\037w\340\317\035`\360c\r~|\301\2179\370\361\207\037w\360c\005\374y\003+\303\262`\331~\373\345\317\034\262\005\027\314\177\355\376{\346\277x\377\035\361g\re~kg\331\374\366\356\277@\277\325\373-\231\337\236\375\326\354\317d\376\233\200\233\376v\314\1775\374\266\314\177u\376\013\342\317c\376\313\363[\0357\377\227\202\377\352\377\026\340\317b\376\374\023\367\343-\177\206\373\355\332o\275\374V\313o\267\374\027\303o\271\374\231'\314\237{\200\371s\372g\375\345\317gZ\366\222G\220s\202\314]~k\204\310\335\354\375Y\310[^\362\200\273\301\177\205\376\177p\002\212\020\331\217\271\\\356U\277N\377\274\001.\177\366\200\325\300\026\300\""
+	.string	"I\336\362\237\003\3773 \215)\265\310\205"
+	.string	"\035\223\215l\331\003\277m\300\225\021D\b\300EYM\210\355r\326\347Pz\374\031\315\354\267\032\374\326C\036\232\362\333\r\376,\345\267\001\370\255\007\177.\373m\007V"
+	.ascii	"?f\222\311pW\036\373s\224"
+	.string	"\377\033\370_\301\177\020\316\301\237\006\305(\241\374Y\370[\b\210\375y\004\177&\301\217\233\236\374v\304o\035\360\333\020V\304\217K\360c\023\330\0024\200(\263\370s\030\206\213r\333\256[\216\257\2742\377\321~\002\367\035\212\306y\311o+\320\247\363\247}\377m\273n\371\006Z\222\337\026Y\250\337\326\370\261\360\307R\331\313r\340\377\211s8\3343\370S,v\266\002?N\223w\027\216\343\346\30722\327\237\235\226?v\223e\374\370\005\222\337\036\3756\305}\376\364\314\217\255\344\255\377r>\377\300J\340=\177\352\365\343)\277M!\037\371\377\201\317w\376\024\307\237A`\344\003\233\202\334/\374i\324\217\211\340 F\221\213\374y"
+	.string	"Z?\336q\271\034\202\310\377\017\236\341?\b\347\360\303\352\304\214\377\033\374i"
+	.ascii	"\376\254\377\333_\003\375y\310\237\177\374\031\353\317W\177\326"
+	.ascii	"\361\347\252?G\375\371\351\317I\177.\301\237\327?\037\377\234"
+	.ascii	"\342\317\303?\003\377\314\201?\237\370s\n\177&\341\317\"\374"
+	.ascii	"\031\204?\007\340\317\035\374y\203?g\360g\016\177\266\340\317"
+	.ascii	"B\177\016\3723\206?_\370\363\357\317\347\237\361\217\363\376"
+	.ascii	"l\177\334\367c\276\037\323\3758\316\217\337\374\330\315\217\333"
+	.ascii	"\374x\315\217\355~\234\346\307u?\226\373\261\230\037\303\375"
+	.ascii	"\230\313\217\333~\314\366c\265\0377\177l\366\343\261\037C\371"
+	.ascii	"\361\223\037\207\340\307N~\374\365\343\256\037/\177L\344\307"
+	.ascii	"B~\374\343\307W?\336\361c\253\037\337\370q\215\037\317\370m\007"
+	.ascii	"~\013\202\037K\375X\306\177(?&\372-\317\217c\374'\363\037\316"
+	.ascii	"\217_\374\270\351\267!~|\202\037\233\340\307-\374\266\001?F\372"
+	.ascii	"-\002~\254\374q\321o+\370\361\360?\332\177\016?F\361_\356\177"
+	.ascii	"\233\037{\340\307\300\037?\340\307)\374\227\315\177\027\360_"
+	.ascii	"\005\374\037\372/\002\376{\200\377n\370o\005\277\365\372\355"
+	.ascii	"\326oS\374\226\307ow\374\326\370\333\342oM\374\226\205\337B\340"
+	.ascii	"\267)\374\366\001\277%\361\333\020~\353\341\267\035~\373\363"
+	.ascii	"[\237\337\366\374\366\302\377(\377\303\3767\375\357\362_C___"
+	.ascii	"\337\277\223\201\237\2026\177\005\260\004xo%(K*g\3133*fM\261"
+	.ascii	"eZ\330r\315\311\022}C\325\346\274\324\260}\355\315L\315\270Q"
+	.ascii	"9\323\220\177\301\230\376\005[\372\027\004\321\277 \207\376\005"
+	.ascii	"T\372\027\300\320\277@\t\265r;\227D\202c\312\315\347 G\237C\236"
+	.ascii	">\2079\375\243f\350\024(jv\274\270\371G\247\240b\026*\3062\315"
+	.ascii	"\315\277yQZK)\"s`lIA\227\250\264q!\266D\241\214\3345\343p\331"
+	.ascii	"B\303P(\250\022\264\b\352\205v\241CP#(\027:\206&A\301\320(\250"
+	.ascii	"\026\272D\237\240DP2\364\b\312D\231\240R\320"
+	.string	"2\264\t\272\004\375B\235\240Hl\023\025C\201\034\r\202\ny\316;~\313\366\364\265$;\341\274\335Ii\001\345\215\306\216\345\324\220%\025\217\245\214\"l\350\214\036K\262S\316\226;\246\2639ig\037\332R\n\252T\305\311\311\235\030z\003\375\201\231K\b,\345\270#C\305N\275\363\r\216\"\245\323\226\272\3048r\227deIv\362\251\335\355\315l\002\263l\250\030\372\002\311\035*\206\356\346\335\336\314#;\262\"\t\310\031\316\006\241o\276\351\037\255:\372\343Gk\2406\320\254\233\265f\351\312\315X?'tX\232\334|\016X\364O\300!c\211\366@}\240<l\023\275Bs\034\325qg\334\266\331\021\265D\257P+;\207e\f\033\017?9 qy:\237\303\227\306\\\372\034\220\350s8\242\361\220\020G\253v\230hT\331\272\371\034\210h{g\203P\f,\020z\016<\3649L\351sP\322\007\200\235>"
+	.string	"\276\350\003@\212>"
+	.string	"\232\350\003@K\037"
+	.string	"6\364\001\320B\337\2026\372\026\220\321\267`M\337\002&\372\026\\\351["
+	.ascii	"C\177\303\236\376\0062\372\033\330\3647\220\351o\350\322\337"
+	.ascii	"\340C\177\203\223\276\020\237\276\020\236\276\220\027}\241\263"
+	.ascii	"so'Ls\214\214\233/\244\344t#\024D\377g\233\023\217o\006\236\327"
+	.ascii	"\315\314\023/G9\262\204ec/\217\235xY\312\211\227\311r\231\205"
+	.ascii	";\313N\302\2609\363\3165\347\235m\236xg\232\237jN\273\023/\237"
+	.ascii	"\235h,\\\225\025,X6\f\260F\016\027\235\254\263m\020j\257,\020"
+	.ascii	"\372\n\370\364\031\0200\351\351\335\374\n\330\350L\005\312\t"
+	.ascii	"\206J\003&Js\302\366\316\270\023\352D\"\302\205T\004\262x\334"
+	.ascii	"59\305\310t\334\275\270l\035\224\314\230\023\266'%\356|\262L"
+	.ascii	"\314\\\246S\262\264r\225l%s\301Q\244~2\310\220\344*g\\~\313_"
+	.ascii	"f\214\240D\314\234\260=\313v\306\2350p\035f\256A k\310\335\336"
+	.ascii	";\356\\\236_\035\274\330\346\204\355\325\235eN2'\334)w\316\235"
+	.ascii	"c\3160'\335)\3464c\233g\334\311\365<%\233I\211\313p\247\023\207"
+	.ascii	"%\247\275g\230\240dlN\330\236e;\343\316\030V/I\204W\336\234\260"
+	.ascii	"t\311\2248dB\371\313\026\217#e7\277\0020\375\377|;\271\234]l"
+	.ascii	"\363\364rbY\236l\"\\H\375dH1r\327v\276(\263\345\345d\236U\262"
+	.ascii	"\006\340\306\246\265\267\347!\355\373\302T\245\363\251\305\315"
+	.ascii	"\f\221\276\233_\301\221,?\335\250\340\030\222u\363\351v\212I"
+	.ascii	"R\001\020\375\nf\234W\202@1\371\326\324^(-q\222\366SM\007\311"
+	.ascii	"\234'g7\237h\247\024(\030rQn>\233v\216\314\324\01687\237V\256"
+	.ascii	"\324Y\243\255\351\314\331I\305lg\355\256\310\224\27133\224Kk"
+	.ascii	"K\306\224\237fhm^\260n>\307N)\377\177z\n\213J\324)\345,\023\223"
+	.ascii	"&L\225\255\323k\211\313\017\2623j\247\356\305Vs\363\031E\347"
+	.ascii	"\214]\027\266\271\377\2773K\017\215\332\315\247 \214>\005i\347"
+	.ascii	"\023}\244\214\216\266\233OA\2233\354\004\273c\316\266\231\323"
+	.ascii	"\311O0\264.)\013\234\256\223I\217\034\033W\220\334|\nv\234KN"
+	.ascii	"%\027-\311S\363L\362S\211e\362\300\361\002\206\306\315osz\375"
+	.ascii	"\377\365\310\211\251a\271\371?\275\272z\240\304l\254\256\223"
+	.ascii	"\353\247g\206\017\354\346S@C\237\002(\275%\344\203%\251\t"
+	.string	"\216\233OA\222~\t\247\221S\206\223\263\310y\3046O#g\224\220\221S\352$b\341\252~6\223\032\265\273\035.-\330\302\320|\0229s\234B\202TY\0169\265l\363$r\"\347\324\211\303\302\235\251\260$mF\222\2542h\376\177\0029\203\330\346)\344\374\321\343\314\342\260\344\244\002\233'BN\035'\017\016KN*\264Q\271\323X\264\332\210\240\371Am\364\177f\235XOj^s7\237>tjT\301\265\335\374 :\375\3376\317\253s\265\350r\363\203\340\364m\363i\316\035WS\304\213\215'7?\250\213~P\233~\320\232~\t'\216\223\352\264a\341\316HxiV\235V\266y\3428o\2348\316\031vn\347\211\355\214\227\036$^`O\320\374 -\235\2310\231}\271\371\254q\322\270\240f\207[\222\233\037t\245\037\204C?hJ?\bJ?\210I_\303\236\276\206;}\rh\3645\224\321\327"
+	.ascii	"F_\303\025}\rf\372l\362\371!D\251\314\315\327\300D\307e2\230"
+	.ascii	"\271LaI\306\335\271t\2728\231l\363lq\266\310e\362\033\021.\244"
+	.ascii	"(\260\004u\267\367>[\234J\367\302a\311i+\371\030\201\013\216"
+	.ascii	"\230\252"
+	.ascii	"=\017y\312\020.=t>\220\034\375\333\304\333`\341\2064\240\313"
+	.ascii	"\212\231^\223\273\374&\313\345;\016KN\022\330\322\274[s\267\263"
+	.ascii	"e\033'el:\254\205\3457\331\315\335\266\276\356\362\233\234\267"
+	.ascii	"A\n%\242%\326\325w&e8yN\226\223\371\316\235\343\330f~\223\367"
+	.ascii	"\316)R\366\342d\310\007b\242\017\264\324\007\032\242\017t\245"
+	.ascii	"\017tC\037HJ\037\310I?\303\034\273\233d'&\352\346gH\223\321\344"
+	.ascii	"4\266\231\325d3%\314\345\2724\313\254&\237\311u\031\322\324y"
+	.ascii	"e\301ig\330HA\3633\030\321\177\256\313ts\236\354\230\223\351"
+	.ascii	"\262\231\0361$1~\334\374\f4\3643@\351gp\241\217\241O\377yL\006"
+	.ascii	"\223\303\\\266\017\234T\236\2724\335\234\305\204x\036\323bH\214"
+	.ascii	"\0317\203`\201\320c\330\323\307\260F_\246\rB;X \264K\366b\307"
+	.ascii	"\350\301y\"\323\005C\027\275E\310\207j\207\231\323\315\3070E"
+	.ascii	"\277\204fV\303Q\244t\025!VnY\213m\346,y\355,K\276\222\333,\334"
+	.ascii	"\331V\242\362`M\227\326\236\220\207\013U\366\342\330@3[\306\342"
+	.ascii	"\003\343HS\221\233\217\301\211\215O\377\307\fZN\2733\244h=\335"
+	.ascii	"\374\037/h?n\372?c\372p\026\b\375\235\230\326L\033\204Z'\255"
+	.ascii	"\\Vvy\326\344\270\260q\363\177\256\264\335\026\b\375\217\013"
+	.ascii	"m\245,\020\372g(\230\315N\225\345\232\264,\226\237\300\241+\362"
+	.ascii	"\342\346K7\007\217G\030\026\330\263W\334\224\232\245\233\217"
+	.ascii	"\305zX&Zd\252o\271\247%vg\006$\013\251rW\344\t\021'P\356\312"
+	.ascii	"\262W\276\262zT\342\372\226{y\007\217\004t\275ue\256\234$;\311"
+	.ascii	"J\3622\177e$yIn\222\231\330f\366\312F\236\217\344\255\347\023"
+	.ascii	"r\274\351(\302\325\267\334\013\363\312>\362\017\013wF\202\r\332"
+	.ascii	"\235W\036\222\022I\352[\242l\232|\270\021\312\366\312\006\241"
+	.ascii	"\032,\020z\237-\372>R\364}\272\364}r\350\373$\341\310A.\300\335"
+	.ascii	"\240\253r\363{\320\350\367p\311Y\026\212\r\220%7\277\247Lc\365"
+	.ascii	"p\351\367\370\320\357\241\322\2770G\177\357B\234\376\0056\375"
+	.ascii	"g\253\214#\343\310U\231*}\323\"\203$S\341\275\374dwG\225e\204"
+	.ascii	"y\261l\231\n\207\301r=L?{o\365\335\355\2753\025\236\303nz\224"
+	.ascii	"\230;\251\307n*\317\31052\215|#\333\260\315L\225\243\236\245"
+	.ascii	"\362\224\224L\205\227\340\267\036&\346N\342\300\205\007\006f"
+	.ascii	"\317COT\022\250/<\371\3346\b\375\232\005B\177AL\377\302\022\375"
+	.ascii	"\022\230\254^\230e~\312KV\317\302\ri@\233\031%\\Fw\007\007\363"
+	.ascii	"Y\2703\022wi\356\262\213\374\"7\345\026\331)\303\31012\224m\346"
+	.ascii	"\247\347\244:<\007\367%\200\r\215Y~\302o\332\324\334\225\345"
+	.ascii	"\247\274u\216\364\270i\323Zf\310\277\260\245\177\001K\377\002"
+	.ascii	"\016\375\013R\372\027\\\350\363\264\3217c\203\3208X\316N\027"
+	.ascii	"\266$}7\237G.\016\017\234>\217\026}\0365\215\3656\350\250Y\251"
+	.ascii	"\232\272\371<M\364\031\214\327\243\364\263\367\226\332]\033\274"
+	.ascii	"\30661\033\314\006\233\301u\026nHvBe\203\207\\e/\353\r\315\267"
+	.ascii	"m\322\334\341<lg\233\030\357\027\r\036V\223\237\242\214\221\372"
+	.ascii	"J\212\001\211\243\363yr\350\363\324\320\347\231\322\347y\241"
+	.ascii	"q\335\355Jg\264Ea\273\331\262\tqL\267\226\305\205\234\233\317"
+	.ascii	"\343B\177\207O\377\307cp\031L\3066\261\334\343\370\226bp\231"
+	.ascii	"\234\245\034\206\303e=L\314=\245\203$N\310\203\007\017=UTi\270"
+	.ascii	"\350\374\035<\375\0353\372;q\372;[\364\257\226&Q\300\300\354"
+	.ascii	"\3417\f\206\267X\270\263\275\251\006\300\345\003\f\314\236\333"
+	.ascii	"\327\0132\250\2627\314\344vY\270![I\311\003\256800\270\013\366"
+	.ascii	"\202\301`.\370\213m\342\267\337\262a%ao\330\211eZ\270\252\235"
+	.ascii	"\204g\002\027\027\030\230\275\275\231\036.le\225a\302\223\265"
+	.ascii	"\244jtc\236\334\374\035 \372%<i\262d\"\301\202\331p\026|\005"
+	.ascii	"\273\3415\333\304m8\r\267a5\260\2730\253\327\243\364\263\231"
+	.ascii	"\226\234`\2616\f\345\013\267\341(\030\rG\221\212\300\230\255"
+	.ascii	"\273\275w\336\002g\203\365\344\357\360\320\337\211\241\233\302"
+	.ascii	".7d7_g\216\276\r\303U\260\231\326\235\025|\206\251\330&\256\202"
+	.ascii	"\247\224 \005\227\rY\356\275\253\3401\\f\341\316\266\322\224"
+	.ascii	"\tJ\246\230\by\360\240s\244G\2179\235\257SF_G\213\276\016\226"
+	.ascii	"\273a2\"Z\222\210\334|\035+\372:f\372:d\372:K\364u\264\364\357"
+	.ascii	"l\020z\235\035\372:U\372:4\364u\244\364u\234\364\177o\364\177"
+	.ascii	"t\372\2772\372n\234\004{\3654\245\236\374\270\031{\375\230\013"
+	.ascii	"wY={\365\303\005\367\342\346+e\203P\016,\020j\337B\034/u\322"
+	.ascii	"\356\300\2420\022ldG\007\330V\025#\030\313\352\341\262\245n\222"
+	.ascii	"b\345\204\2542U\210`-\274\205\217\340\"\266\211\215` X\b\036"
+	.ascii	"r\265\3342\267\023\323\017 T\314\214`\0376\r\227-\265\231\224"
+	.ascii	"\246\021|\265q\0314\253\274\257\275\231>clP\230x\362\017\007"
+	.ascii	"\371\177:_\334\340X\336\374\037\030\375\037\232\376\257L\377"
+	.ascii	"\027\246\377K\242\377C\242\037{Pp i\362\220i\2022c+5\313{oe\242"
+	.ascii	"\216\3503=mx0\tb\304\246i*j\340`\374\212"
+	.string	"\350#U|[_~Z]]\324\2240\2719H\220\337\220\2548TzX/*\311\215\237\220\377\206\320\3402\026D\204#?~\244jvlG\241RPYk\330\310\230\255\345\346\213\240\003\013\213\004Pss\276\302\314P\233r\303\203\307\357*]\203\312Z\373\302N\236\344z\364\370\357\252\215\02481;+\253\237\016;\266\2434xMiu\355\341\320\373\032\313\361\237\216&5\304pE]1ZefkSS\277*\267\035\272+/I7\376\253\322t\326\310\234\030-7\377l\\0MM\230@\335\374\253\221\302\250\203\202f\344\346\037\r\033'+15}\271\371G\345\023\306\203\215\313\315\277\031\266L\2345\271'\033\207\247\020)#\026\005\006\214_\324\bv7Y\001\202\343n\357\252\016\027\264jl5\305\370/\352'\343\202\033\030W\344d@e/M\030e\200\314\341bg\344\267\364[\372=\t]%\341%"
+	.ascii	"\013\223\001L\310H\3719\375\367\224F\231\ri2w\363\217\351\327"
+	.ascii	"\344u\007D\255\351\347\002\356\315\006V\335\206\263\267\251_"
+	.ascii	"\213\013\007\2004Nh)\f\036\264\270)h7\372\372~IvlG\tiYS\263e"
+	.ascii	"\017_\321\352\203\363\333\377%\351\004\311\221\024F\007\247\247"
+	.ascii	"wv\363\007\320\244\247\247\371\204\256\222\360N\260\001\005E"
+	.ascii	"l\017\017\351\032\253{s\315\247\345\364,\305\3040\273Y\307\351"
+	.ascii	"Aka\367\346\346\2070F\303\321{)\030$\\h2n\326nR0k|`\264R\247"
+	.ascii	"4\013\232,djxx\232\215\031\315\005\356\314\325\232k6\270\217"
+	.ascii	"j\r\337\315:Os\271@w\325\204JX\2324\332\216\204\264\235)99\254"
+	.ascii	"\250\271\266\263s'\025\035\224\020.99}F\350\n\217\261\243\322"
+	.ascii	"\373\312n\342\270\326\352\256\317\3502{r\236n\326s\232\356\026"
+	.ascii	"i\273\341Eg\006o\221\321\245H\266\262\322\306\005H\\\234&c\177"
+	.ascii	"\230Kh\304\356l\036V\223\2471\327d\212\200\0012\343f-Fs\311-"
+	.ascii	"\274\344\\"
+	.ascii	"\341\370\362E\207\261?\314\245\272.w6\210\330\326\0210\327a\356"
+	.ascii	"\266s\345\243i/\004\027Y\236Ew\261c;\312\004/=\340\354}!\323"
+	.ascii	"|\362v\335E*\035cc&\211\313\377\337\2112ua\270\\oYZ\255\341\003"
+	.ascii	"Km,\301\321r\363\265\334%;f\030\201r\363=\3149\273n\236\3516"
+	.ascii	",\346g/\355\275\264\273\311l\311\351n\247I\335\2226\265\353\266"
+	.ascii	"k,$\234p7\3334\263\034r\263f\273\242\327t\332\355x\336\256\354"
+	.ascii	"\345\270Y\243Y\331\021ss1\346f]\305\006\221\001'\206\312\377"
+	.ascii	"\343\3013bC\353\215\276\207\274$\327_I\364\024<\3062w\325U\022"
+	.ascii	"\236\001\230@-\321\333\333NU\035z`\330a\001\201r=\345Z\n\t'<"
+	.ascii	"\2151\310\224)"
+	.string	"7\353\262[\"k\2468\335|=\246\311\376\337\217\013Ms\316\315\367\200E\353(\"\354\200\343C\316\315\327\314!b\216(\271\371\332\273\241Z\354i\240\330\224\354\270Y?\271\335\205f\224!:t\030\230\2541K7\353&\332\211m\276\213\006;\323\247\207\255\211J\227\233\357\241\251o\337\005=\201}\027T/\271f\362\377~l<\200`\335|\017e\372\327J\376_ZE.\307\022\212\276\207/$Ht\227\035\333Q\"\200\352\202\223\205\300yRw\263\356\322\\op\\\361\335\254\227C fm7\337\003\r}\017P\372\3775\021\"\372\210\320\025\036\263G\245\367\265wU\207\037\224\217(V\332\310\365\021\233\306\003d\214\221,]\204\207\231\264\325\350\"Z\353\227\207\346\f\323\205\321\263\224c)\344\346\013`O\377Z\210\026b\323\364\323\336XV:mP[`0\034\201cr\363\005`\006\004\210e\346$\346\216\322"
+	.string	"%k\f\233\275-\265%\204\020kRN^YYh\030\275\344t\225\255,\251a\373\332{K\bh\230\026\262\245\233/"
+	.ascii	"\034\372\327>\264\017t\212\335\\L\373\307\223\324\006\224\326"
+	.ascii	"\f\335\002JT\030;\036=\250\320\351w\200\323\277\326a\233Z\207"
+	.ascii	"\325\323-\230\366\025\021\224\355*qRf\344\346wX\323\277\266\262"
+	.ascii	"\262s\r\250\272J\312\323@\017*kmo\357-!\340\032kQ\316n~\207\037"
+	.ascii	"\372\206f\322Uk4Pr\326\201\207~\207\032\372\327T\267MM\245k4"
+	.ascii	"\240jl'\245h^X6.\330}\341]\335\254i\210\231\2755o~\207(\375\016"
+	.ascii	"0\364\257\243n\233:J\303"
+	.string	"\300\353[\352\334\265)\261\271YK\331.0\020\342\350\203 \247\177\r\343\266\251ah\250\006\234]m\252\021\274|\200\201\351\261B\267vw\263\216\361,\225\247\3160k\262H\271\371 \260\351\203\300\324\267M\254nj\352&\375\364s\332\035\250\321\021\302\217\214\315\0178\332\311\332\274\262-!\314\2355\036Th\334|\020\220\350\026\272\305\023\020\256\364\222^:\335\364\026\362B\343\031{\023\344\353\346\203\320\244\223tR\252v&\355\364\361\003O\316L__\252\246B\2213\035\033s2\346\334\374\017\322\364\237\362\3356S\276t*3\215\355\244\036\265+U!\374\270\342\356\316\334\374\017\230\3508qb\\\030\353\022\246w\363?\320\241\377\364\315\2334*3\367\324\216\224&\0374\351?u\343\346\242\021b\356\031>-\266\344\264is\272\315\251\352\200\026\021\343#s\363\003PF\343\245k\360\362\362\272X4@r\244\335\374"
+	.string	"\234\351\007\340\207\235]\213\257"
+	.string	"\274\320O\317\3304M\232\313&\264q\0310\253\274\257-U\025\302\316\025\227\227\262\233\357A\034}{\331P3i\235\031::ke\207U\336\336\256\252\352\2603\343\305^\222\233\357A\027}\017\222\220I\345\310\234n\350\336\226y\025%\265\253\244:\224)s\272\035I\363"
+	.string	"\207~\007n\304\210ir\352"
+	.string	"L\227.)\\\232\2470O\341|\344\300!\243\004\246\t\337\234\0130_\232ta\243\003\225\003A\326\231/^\356\023=\203\314v\272\371\035\240e\311\222r\321If\254\362\366\322-O\271\314ar\346\306\315\251\026\253\327\004\343\344L\332\377\037\n&J\016\234\233\337\301W\333\017;\247A\322\317^\262\333\352\340\310\225\265\224\315\316\351\275L\255D!\351\200\210~\007Yii\251Z\224\221\267y\252\306\345\225\025\343\346w"
+	.ascii	"\225RI\251\244M\273\367\336U\033\323\245\245V\2366\343\340\b"
+	.ascii	"\351rsZ\3056\263\302\236\334\3746x,\254\r\224\233\317\201^YY"
+	.ascii	"jF\204\310\224\247f\2772:\270\250\335\234J\371\225\205a\336\231"
+	.ascii	"\305\355%1s\3639 \023e\354\314\213>\007lP~$\200\213\312\322,"
+	.ascii	",/}b\347\362\256\332Iy#pA\341 L\237\003$N\234\330\271\021\322"
+	.ascii	"*M:\3568\260\241\3774\211m\246I\322\257\fR\0240\263J\231<\375"
+	.ascii	"\372S%\351\222\253\245\301\270p\271\271\031\325\021\342)\223"
+	.ascii	"\004\024\371\341\344\346\0378\033\204\336\030\026\b=\007I]]v"
+	.ascii	"\316\346\240\323E\212\244\313#<\236\"y\272\364Qb%G\222\233\323"
+	.ascii	"-\035(YqfnN\217\240ev\310eArsj$\307\221)\323\346\346\267\271"
+	.ascii	"U\377\177\027\230D`\370\270\371\033\254\021!b\231\226\271\243"
+	.ascii	"\322\026f\232\350[\246M\203\b\261L\r\232\232\030\321\337`\207"
+	.ascii	"~\352\303"
+	.string	"\246Y)U\372\303\352i\240\304\334R;B\234l@C\177\203'}k\365\320\247<lze\233\351\225M\313\314=\245\003D\354N\337\3324\364i\016\233\356h\246;.\224\020s\317\330\221r\304\213\276\275P\350\255\230Mq\374$\234\220R\245V\226\231w\325\306s_Vy_h\372\032\204\335\270a\347\354\317^*\023\266\034\242\237R\331\264F3\255a\347,sG\351\264\bc\225\267\267\245\230!\\\203\033\372\326\316\241\351\214t\206\335K\205lY\345\355i\240\244S\251!8P\276\334\374\f\356t*\003%C\344J\335\315\317@\214\376\323\030?\036r\265\330f\032\003\025#\304\334I=@\300\254\245/z\364`\264\001\323\351\223SS\220 T\316nN]\310\340s\241\345\346g D\3376\323\026L,\360X[\263\364\224)\323\265x\242\272\371mR%\271\2728p\251R\232\324\002\316[Y\232d\323\360\360"
+	.ascii	"b5w\363\237nt\016\023\270\346\2247M\364\r:'\203T\004Z\314\271"
+	.ascii	";\312wt\316\217\302A\343\3444J\266\236nF\345\2048\312\307\363"
+	.ascii	"\342\005\027\233\233m\237\005B\1772\230\341\3066Q7\350\\\007"
+	.ascii	"\346N\332i\321g\225\267\227\301\326?\332\346h\336\265B\347~\222"
+	.ascii	"\260\366\017\216\253\n\034\375\243th\036\272\346\372\370Q\302"
+	.ascii	"\332\277%\227\330\335\226\222\n\341\030\334\351\243u\350\231"
+	.ascii	"\243h\216\006\305\323{\357$\346\216\n\021f\225\367\265\253\244"
+	.ascii	":\374\350\335Q\274\253\261\021\343\352\352\346\267A\355\376\377"
+	.ascii	"n\2249qt\330\035U\203C\016\213\032\032\207\2058\215)\263D\017"
+	.ascii	"M\203\201`!N{\357-D\342M\315\331\315\307`\213\266\277\375\375"
+	.ascii	"\321\255$\265\367\236q2\267\324\022\017\372\333\333\323\332\016"
+	.ascii	"\377\005\213-\007\377\363_\002\n0w\023\232\260\275\267e\243\275"
+	.ascii	"\324\224rh\260O\270\275\231\260\222\032\2005\305\204u\303\251"
+	.ascii	"\fk\n\203S\031\326Nb\332J\302 \265\261\222\234\312\366\306\300"
+	.ascii	"\304\224D\342j\312\251Licp*\333S\273\205\230)\273\231XI\233\351"
+	.ascii	"jc\330L[i\227]Mi\340\304\2045\345T\2464\205\301\251\f"
+	.ascii	"kj\227a\355\237\315\244$\365\304\264\2450\3542,\274]v5\365\343"
+	.ascii	"Tv5\345T\206%\307\332\301\320\223\2721\027\206$\315r91m\031P"
+	.ascii	":\224\244~\340\234\230W\333\314\336\366\314\305\226\332p{s\260"
+	.ascii	"\267\216+)3J7\354\332\022\234\214\245\246\322\325\006\250\245"
+	.ascii	"\254\253\315\004\227d7\234S\222\253\275\223,\031m\250\275\367"
+	.ascii	"6!\211\t\267\211X\270\244\037:v\f\027{[\260\231{C\355\235d7\334"
+	.ascii	"\336;i\357\235J\351`\356m\365\343\264\204\202\332\273J\bj\353"
+	.ascii	"H\272\342b\357{V\2676\345T\226u\025\342\312\224\262\345nb&Y\247"
+	.ascii	"\030W{\271\315`I\351\262\244(;\306\336\333\256\321\313)\252\274"
+	.ascii	"\233\217\201\020\375\243f\320\2713^/\250\334\214\312]'Zfn7\037"
+	.ascii	"\203\034\372G\313\220\301/\236\260Q\273\231\311\023\025U\344"
+	.ascii	"j\214\030\0302\236h\334\214\306\335\375p\223s\3631x\001\027\206"
+	.ascii	"\307\bU\032\2710(\030%q\224@\335\374\245\251\307\244\307\315"
+	.ascii	"\277@O\377\316@{\202\276\241laU\356\272\240Z\320-(\0274\013\352"
+	.ascii	"\005uC\261\240m\266\211\276\241W\3207\264\nj\245'"
+	.string	"ED\"\343q\204\017\213\"R5\221<&\223\017\030\032\325\241\240aPGI$\201\202\222\370s\243\017 \324$\322\032T\211\322\224\004\006F\025y\354\031\032\211D\032T#\361(\251\256\352P\203\252<\026\205>@!\021\020\251<\332\031\032\203GG\307\021\302\024\206A\325\304\361\304\220\b\013\f\203\252\t\"$\024J\235\035\021\026 BB\241\3341A\204\204B\231!\271\226 BB\241L\325$\0222#\217\212\214\304\344\252\244\240XD2\032\217\306t\005\252\" *\321\026\216I\243\365hL\211\202j1\263@\n\217\324#\364F\037\324#\342j\301\nT\262\240\036\021W\255$\026\213\304#\264\310H\\\211A\f\334\350\203\004N\2540\004bU\213\222\301\024\302cq\204\232<\216\360\031\252kP\005q\025\242\240\fb@\035\036\217\222\304 \320\210\r7\372PD$*\201\341\034\201\204U\253\303#\013>7\372"
+	.string	"T\217\210\253\021)\231\201\262(XL\241\310H<J\006w\316\020!>\254\306\021!V\275\n\205A\274jX\207+\004\327 \t\026)\206\222D?\253q\304p\005!UHT\221T\207\224CU\235"
+	.string	"\006C\243:d\f\n7\034\251\253\222\305\020\005j\222\310\202\022+\321H\244\200C\007C\265\210\"h|\300\206\236\f\222\307\022I$\341\007\026\214\360aM\006\221\037JlPd$\016\215j\t\026E$\013\310\237\021B\240*q\210\017!P\225\347\320\250\016\005\255x\200Z\024L!\f\226\030\032\325!ue\341\200\241Q\035JI\370\020\002uhU\006\213\277\022t\b\360a\250\"\225G<\312\"1x\242\002\025IE\252\300\220\002\236\002|(2\022\211\210\220\326!ue\201\242G\213\370p\204\244L!T\215\204:\352\021\361\304\252\fJ@h\250\307"
+	.string	"\037\326dp\035*\022W\243\005\220\304\024\312\037eP\005 \245\272\262p\300\n\023$V`\221\221\230\f\032\r\231P\201)(\225\252\360\230,\261*\217%\220\312#\240\023\032X\024\221\030N\3700<\022\236?\244\222\205!\26584\006\215*\270\220\230T\215j\221\276\t\004\020\201"
+	.string	"\"V\244\027q\200\021\0160\002z\021\007\b\021\342"
+	.string	"\004\b\241O\200\020\330\204\017\353\215> \201\352\032L\202\020z\220\"\250&Q"
+	.string	"\203\310\265G\tT\327\240\211\3421\271\032\217B a2\025\241\256A\023\302d*bHd!i\264\246I\243U+\3255\230<I\254P\"it\302\310b\370\023qD\256x@\013A\r\b\223:J\240Z$\022\035\223%\206D$\317z\243\017C\"\222\204U\002E\f\211H\264\204]\301\016\211H\334B\220\205\216\b\214\200D\310\"\217\b\214z\210\210\216+\222\020h$\\\217\306\f*\222\305\nL\252k\221H\004\304\260\032\211\307\022H\244\241\221\210\201\nvZ\bj\340\bihHD\366(\215*\362\3508bH,\261\006Q\250"
+	.string	"2\022YXQ\030\022\221?>,V\242\n\342JT\032\325\241\242\252B-\376\254B\225\210\bH\035\036\217\200kRE\256P\201k\221\270\002\215G\021\020\223G#\241\023jq]\217I\243\023\024\030\211A\b$\217(\034%\325\225\250\341H\\\203&V\004\213\252\211\f\253Q\021Q\305\300\320QR]\207@&Z\b\262\300\260\022\217\210\022P\327`\262gX\3643,\036\215\224j\322h\005\256F\342\021\271\252J!\365\210\270\352\260\b\026\325\341\216Z,2\0065"
+	.string	"\251@\023F\312`r\304\220\210\314\300\"\251\2528\n\325$\320H\031L\n{n\364A-\252Ba\220\003%P(\f\236k"
+	.ascii	"\326\013\306\024VU\251&S%0\3030\250\232@B\036iH\256%\214)$\325"
+	.ascii	"UI,RM\250+1\211\001$\344Q\2201\005u%&[H\223HH\310\243\237\225"
+	.ascii	"h\\\301\230\302J4\022\321\344"
+	.string	"ZBhDJa\030TM\b\205(hP\002U\250$\204\302\2406\2460\f\252ItU\002\211\310!\"\225\204\212dq\002\270B\211\241\035#Q\257@\n\254\220\215\304\022F\245\020%\"\225\370F\037\224H(6(\201#HXag\004\t+\374\206\250R\251&\207\303`*$\201\210\221\200*\324\241\022\t\205V\002U!Q\205JB\211\204bGE\262X\225H(R%\022\n\f\201\020@\2410\210\266\02041\202\004\n\250:<\216P\241&yX\f\203\252\211\340\032\034\376V\037`z\243\017\253\020)\271*IP\002W\250+\322\021\206\024\302c\021\bDW#\322Q\b\004\246I\325\330\302\021\bL\225IU\211d\004\002\365\320HL\001\004\242J#\021\251\004\002\323\242\n\004\376V\340\252$\026\177n\364A\251\"Y\254\"\f\325d\320H)\002\b\345JD\001\002\311X$\302\n$#\261(\202\t\004"
+	.ascii	"\022@\304\n\020\352\020\251(4\022A$\225H \f\260\256P\215\305"
+	.ascii	"\2401\251\256F\"p\030T\223F+\022\b\254@\205\232D\002\201\350"
+	.ascii	"\252$\026\201@4\270\006\207@ \252\212\200\250\004\002\321\024"
+	.ascii	"\302c1\253@c\021\261\030\004\366\030\213\210E\024\204\302\240"
+	.ascii	"^o\364\001\ty\004<&Y\024\t\205A\001\250@\023#\2340\002\001\220"
+	.ascii	"\220G@J5\251\243\004jP\201CH\310\243\035\324\304\252\222@B\036"
+	.ascii	"eP\241\016q\221\221XD\036\005\207\204\302 \220\321z<\036\r\t"
+	.ascii	"\205\301\237*4R`U\006U\t\254(\f\32558DZ\240\250\n\205((\211\033"
+	.ascii	"n\364\001\204\362\202\025A#\361(C\013k\020\205\n\n\212EU\270"
+	.ascii	"\032U\245\232D\256G\343\032D\241b\203\n\314\240\0025\250\302"
+	.ascii	"$\322q(\251\256*\013\253QM&\221\204\031F\370\254A\007\\@U\"]"
+	.ascii	"P\256I\265\210\302\bU\211\244A-\n&\203\0308BR\032\217B\016J\242"
+	.ascii	"RM\252\253\222\205\321\032D\241\242G\t\034\0022\036\211\312\244"
+	.ascii	"\252\"\275@\261\250\nw\324\242`RE\036\005\265\261\205`\222\204"
+	.ascii	"\021\nGz5\"\035G\024\213\252\360\267\032UaR-Qd$\032\211\301#"
+	.ascii	"5\371\243\002\3255\270\016\365\250kpU\236,V\2420\210\f\n5\213"
+	.ascii	"\244\272\256A\024\351\nT\252\305\"#\nI"
+	.ascii	"\265\210\364\200\240\033}@:\"\202X\215\212\210E\"\241b\361\230"
+	.ascii	"\314F\302\225\210<[\b\262\300J\264\205`\022\257A}4b\250\256\301"
+	.ascii	"#\342\252Tw\224G#\216\304dP\205>\032\261*U\024\250\276\321\207"
+	.ascii	"\365h\244D\006\215kp\350\b\311\210*\201\3015H\302x$\256H\305"
+	.ascii	"\343\220\022Y\204a\275\321\007%\262\b\304\221\250a-\006\2612"
+	.ascii	"(<J@\211,\272\260\006\21385\036\213\330\250X\304\305 p\250\004"
+	.ascii	"\004x\206\252\212\034\332Q\225I\244\343\210\241\021\351\230,"
+	.ascii	"\342A\036\207F\271xT\342\025D\"\254\036\035UXA$JU\2411\270*\211"
+	.ascii	"\303\036\365\350\250\302\361\204\217\022Y\204\207j\na\020\211"
+	.ascii	"*\201\352Q0\231\302\317p\205\344QiT\225z\270\202z\024L\022\245"
+	.ascii	"\303\025T\244bPE\032\\\203\303,L\n\361\215>`X\203?\352\020i%"
+	.ascii	"\026\031\217\022XAL\3418\001%\262\b\203\221p%\266\240\374\031"
+	.ascii	"\252kRUa$fX\241\026\221H$\210\212A#\035\025\230\3020y<\216P\""
+	.ascii	"!\020\264\006\217\222G\"\240\272\006\215\304a\362x\024\252\300"
+	.ascii	"\225h\264\300\316J4\"\351\030\217D%Q\250&\221\312 \221\n \213"
+	.ascii	"\024\312$Q\005\305\240\212\244\272\032W\030\032\221\216CG\311"
+	.ascii	"`\021\205u=\032QpB\211\202RE*\006/0$\"5\250E\301\265xT\001,\026"
+	.ascii	"U!pM\036\221j\022\bi\r\256J\340P\035\032\325u\205\312AYT\215"
+	.ascii	"\306\240\221\020(L\n\031\217\304\225\250<\"\203B\250k0\t$!\230"
+	.ascii	"\\W\250\300\024FbQE\360\bh\315p$VP\201\022XD$2\036GdH\241\f\262"
+	.ascii	"`D\"\342Q\201+P\200T\036)\221E\030V\250C\343\n\352\032L\016\221"
+	.ascii	"\202(\200+\216(R\b\203E\024\024$\203F\302|\243\017H\345\021\b"
+	.ascii	"\244\362(H"
+	.string	"\t\\\325\024\302`\t\244\362hg\275\321\007\"$\024GA5\271*A\030\217GGG!\006C\243\212\225@\"$\024J4\271\"1\021\022\n\234\256E$\245\232D\215G\342*T\223\304\341o\375\006\303\340\261\310\"\210L\225\300U\251\"\205@5\201T\262\260&\217%\202\206GB\254\212\200\250\314h\362\230L\252\347z\243\017 \224IU\00519\344\360#RM\202X\217\307$\210\235\344ZBUAT\205\252\t\241\025H\200\020)\204A\024\305bp\304\212\244\216\022\310s\2015y,Q\f\022\223\252\362G-\242\b\236P\201&U\"\021q5\252C\242\216\nT\207G\026\326\344\021\251\243\016\217GY\005R`M\036\221\027\224\306#qE\036Su\r\232\030\"\005QhU\004\304!U\004\304!\275\002E\254F\"R\272\352aPU!\3113\f\252*\254@\022JX\215D$}\003\030`\204\006\026\230"
+	.string	"\004\264\360\303\232<\"\327d\360H\t\202ErU\217\324\242\272\2020\022\203G \204I%\210\017\032\024\211\301\023I\225\210\b\311\001+V\236\342\361\350"
+	.ascii	"\340\371\377\227\367\303C3C\212\315\315(Z\336\223\2153?\363\263"
+	.ascii	"\263RR\373\203\250+Z]{\273\212F\207\237\335O\210\225\266:5\277"
+	.ascii	"4e\312\360\300R)'Vg\342~h\360\223[Y\020\274\233/\202\234\276"
+	.ascii	"m\376\352R\270=\227d\317\314\177t\037\330\373\254\207\357\b\214"
+	.ascii	"07\377\346B\374g\006\0034\267+7\247?\271\032p\314\212@\335\314"
+	.ascii	",\253\253\022\246\315\315\232\t\227\220873\253Xy\021\"FO\311"
+	.ascii	"A\263\353\373\305\245\\\254\354\0350\340\240P$i\366\334\204\371"
+	.ascii	"]\231\271\002\022\003\314\365\323\2326}[\276\244j\016\310\213"
+	.ascii	"\001\304\013\212\367\243\242\001F\327\3457Dn\t\365\326\345\b"
+	.ascii	"\02586\\\322%\t5l\304hk\373i\ta\365\313\362\237\026\275\305\265"
+	.ascii	"\245\355\346\237\233\235{\241%\367$M\377?,\332\216K\2345Ila4"
+	.ascii	"$\331\241\335\374[3\341jo\245\237\332\357\312\177k\373\267"
+	.string	"\346s\275\232Ts\320\374\377\320\376K\313\263\341#\307\315?+\277&\223e\025\272\233\325x\241a\023\273\371G\345We\310\222\n\226\333\375Nj/\311^\335\357LO\221\001\026'\310\317L\267\211\371\241\264u\231o|udnf\346\2457*\035e\351W\2228)g\310\256\217\fD\207\0132cQ\264|t\231]\224\314\213\033Y/\230l.\220U\315y\203\242\311\350\355@\362\023\323|:\364n\334\374s\342\344\027\246\223\366\336\263\312\333\373\201\375\027f\267&\004M\327\222\215\221\244\233/\302\227\376\177M~:\310\234\206\340\270\371\307\344\376\226\374\276\376cr\346\217I\006r|\254\335\300\307\312\312\226.T\311\257\312\20372.\222\244S\3135|1\274~I:@\324xYv\245Q_mRl\\O\232\b\231\223\262\345/\252\307,\210\013\250d\204\317\324\005\250TQ \030iA\224\303\244\203\210!\344F"
+	.string	"\003\025"
+	.string	"0XX$\224\n\246M\347"
+	.string	"\024"
+	.string	"\016Y\302\240hJ(nQ\324*\244H\b\030 "
+	.string	"\220\024\001\031\246\350\305q\211\337\266\376\270f\351l\374\315>"
+	.ascii	"\275\306\021,\330\243\232 \223\212\330\030\223w_\244\013$r\310"
+	.ascii	"]O\370\0173;\021\\\325\216\263x\356~\234Lnv\346:\376V\024o\027"
+	.ascii	"A\236\021D\272\332\203\251\2156v\234O\032\267\262[\177\230\326"
+	.ascii	"\246!\344.\233Dp8\236\002\265_\036\254`\344\250\245Ue\325\321"
+	.ascii	"Z\306j9\263\245\007l\b\345\303\221K\315\2060q\272<oB\361\200"
+	.ascii	"s7p\212\225Ug\233\025X&\0232\204]\345\b\246C\027\335\241\240"
+	.ascii	"\004\246O\207\235\3051\212\254\320\307R\206\342\204\365$#\303"
+	.ascii	"\342|\254\224\016\230YnL\261K)\224\330\030\216\020d\006q\343"
+	.ascii	"\354(C\\_\326o\376'\250\001r\2678\322\340\366\245\032\252\006"
+	.ascii	"\265p\372\255\005\025\007\036K\026\212)\315@\032\260\303\026"
+	.ascii	"\027\340%9\332\223\213\250\250\342\211n\333\246\271R\020{\352"
+	.ascii	"\020\310\354er\267\200\016>(p\031^KT\017\306b\222\370^ \n\304"
+	.ascii	"\365\\\301\250\355\372\343\243\017\327\213\333\262\235\221\210"
+	.ascii	"\023\341\333\f[\246\373WL\213\316;\204\b\225\004\353\361/B\013"
+	.ascii	"\"\304\336\350\3071b\356E\303781\027\343A\237dXJTE\215y\020\241"
+	.ascii	"1\276Z\2240\004\247\275\371w\f:\227\232\301\373\245z\325\025"
+	.ascii	"\351\r\334\347z\003\022)\305e\351\210\021j\220\032\022\024O\323"
+	.ascii	"k\177\257kq\345\177\370\233\313\337K\023\210; \257u\243\nn\243"
+	.ascii	"M\206\262\316\247\235\326YP#&\202\206Z\311I\036\274\266\261!"
+	.ascii	"p\263\210I\013\337\313\276s+~\314`\3738K\013`\336GR]\023\206"
+	.ascii	"\325b\320R\223\235\223\233\376\333'b\341\215KHtV`\346\220\334"
+	.ascii	"\216Q\036l\016cG\343\221\017]\254\346\003\267\221\2450s\356\216"
+	.ascii	"\246h=\272\2423V\377\327\177\335\233\300\370\017\337x\234\233"
+	.ascii	"QA\234vM=\250\204\016+\2518K*\004\241\250\257\216z`N\263\372"
+	.ascii	"\2705\240\277\303\242\244:|K\231\2706hnz\265\312\224\343\361"
+	.ascii	"!\324WX\330h\t\205\230B\221\345\252\221]\247\337\324X=e\336\232"
+	.ascii	"l\272\352\231\260\274j\247@\356\274 \306\221\001\273\231\310"
+	.ascii	"\274\273\234\367%\215:i\036\301\232\251I+3\266\265\257\366\020"
+	.ascii	"V\177K\350.\023\253Y\021*\313W\313\006\237w\300*\256#\304h\327"
+	.ascii	"/\255F\210\357`\037U\331BW\017\361o\\e\355\312*\002\243\355\024"
+	.ascii	"BZ\226&~R\274\331Q\230\177L\243.\230\330\241my>\326\201CI`\355"
+	.ascii	"\215\004\224+&T,\333\363\360\207~\342\036\246GJ\265\2140\327"
+	.ascii	"r\347\333\267x\312>rP\267\027\242~\307\255t\200\304d\005h\360"
+	.ascii	"\230y6\221\365\006ud\375\336d\006J\244K`\243\222\223\004\210"
+	.ascii	"\033\354?\233i\242\005\334\031\346g\036\205\247\262\271U\017"
+	.ascii	"m\307\2163\312\276\216C\203n:L\252\025\372=\025I\324\207\tS\342"
+	.ascii	"{.)e\371\013U\265RGGKl\240\t\356\317\3257\304w\027 \022\007\325"
+	.ascii	"\005\212\273]\006jQD\360\035,\177s\225\267\rkJ`\256U{!\325\276"
+	.ascii	"\377\316\001\242\264\346\275FX`\001\310$\363\216\262\b\334\242"
+	.ascii	"\026:\241\210\346_ \346\322P\326\b\327m\0215\303\332t\350w\036"
+	.ascii	"\305C\277SB\026\263\314\033^9N9\352\276\247*\222\266\203\206"
+	.ascii	"7J\323a\026\375\256\227^\027\310!\216\234v-'\344\250M\202/-\236"
+	.ascii	"\341\320\\\236b\034\005\214\220\2533q\333\371\006\300\361\236"
+	.ascii	"\200I(7>\353w\347b|aU\034\013\335\315uP\034K\037*\3548\006e\320"
+	.ascii	"\261\016E\263\367\316\227\255mZ\331J>(1i\n7\231\302|\311\354"
+	.ascii	"\f\035\345E\\\340\023\002@\237s\263\207\034>\020\215#\357\325"
+	.string	"w\035~_\201V8\304\225\342\220|5\207 \217\206Op'b?\365X7\020]Bhh\336Ew\3419\376\350\233\241L\212\221^*\001\352R\221i^\254\264\276C$\004\253`\376b\356'\376\016\307E\242\245\260\037c%\031\302\3568I\002\270.\005\265\247\004V!\322qH\371\216.\177\220#jLK\345r_3\326e\260\252t\337\345B\235\375\272&_,\243L\317\205\241\230j\240\337\353Mq\350\302\246\212\276\317?\325\327\244m;\f<\216v73\002T\240I\330?<\275\232\356N`fq\361\367k\n\"<\227\203\330\343\265\366\021\246}\034\335\324v7\fj\367p\340\276}HH\276\272\376\017\344Z<@+[\037\246\316\331\316\373\2463\227\271\221\200\210E\332\322\n{8\001l\312\263\210\305\276\177Jw\242\\\277\016\256\303k\231\037!ZS\256\257\245F\217Q[\261\t \367<gI\350\263"
+	.string	"\017\237\031\300\235\327\213\357w\361R\266\332/Pi\230\206\262}K\315G\330q\272wg\023\347\002Z\317*\272\247\310\263\257\035\027\304\376\343\325]\367D\206w\272h\373u\243#\303\3250\007*2j\007\277@!`2\210\311\251\375\027|F\343\244\032\364qH\tJ\f\024\264\365\372\215\367O\023u\367\347\225\b\337\b|\223h9\220\316\3038\373\261\360\007\n\337R\013ef\314\344+\343\343N\317\343\"\311\r\262\0355\203\234\004A\346wx\204q\304%\200\233f\n\334\"\311M\345\024\2165=\b\257>\363\224\232\206\361\3254\373\330\257\270`:\034(m\355\365\243\214f\352\203L\361\007\270#\271\325\004\344(q\301\320(\261'\331\2101U\347\373S\362SU\331F\211\264\273\350\201\203]2q\353\345\214.\205:\373\311N>jrqOY\346\300.=\304\223\365)\261\2629\203\307Z\036\231\340L\374\366\304\334"
+	.string	"\037\351\233\230X\357Sj\212\332i\027\036\267\370\322\355\3557S\311\344\233vU\031\214\317\2635u\025<T\274v\221\344\005/\244\026\271\235DC.\337\267\302\264\346.t\301\342\0365=\375\037\211\353\354X\340\214\b\311\345I\372\007\252\304R\232!\273\275\230&%1l\314\256\324\255c\247H\240#\305\353xv\r\024\244o\344\340\307#pC\347o\255\r\3333\301j\250\230\225"
+	.ascii	"\213\212\316\017Iy(oT>\037p\203\257\324\314\300\026+"
+	.string	"\205\371\235\344\263*\033M\002\203\363\333\256\276,n\270E\366@\245\234\210\272J\214\203S\337\331\206\3206\002\215\251\002\034\016w{\257\345xR\032\247Q\251F\033ZB\005/\252\363\0241\216\036f\310,\256R\265\320\370\207)0r\\\"$\311\227{\301\335fC\265+\025\344\317\005\213=R\361T\252\"\002\020xd\027L\340Z\bP%1\202\301Y!\226t\221\214K\371\311J\\\302\225\20367Y\331\324\026\253\032\353p\226p\311M_c\265\212<\315\240\323`\351\376r\272\002\023\252k\177\0033\r-m\017\315\373\246!d(\216WQ\332\240\232\026\366\304\223\302}\324\035\341=\224\303\fdH\270^:\"U2\007\033\263\363\034\241q\240\250j\017\247s\251\263\035\013\030\363\273H\244\246\005_\021\312\270\316\215\241\316\246\347\360\362\201\2060n\301r\354\t\021&\007\034\252\007\341\201\360\301\364%`\222z\312\264"
+	.ascii	"\003\326/,:gZ\221\361E\013\3372`\222\372\220\320<\356\003\341"
+	.ascii	"\367V;"
+	.string	"\017\001\361\203\206\377#8\030I\326r\270\032\225\036\002\177\031=\215V\364 \200N\351C4\272P\223-1\005\236\267\377\027\303p\357\374\277\211\263\360B=9\232\031\335\225?H\277X\232o\335\301u\337W+\020\260&_\201O\025R\337\030$/\270\036U\227\031eL\271\027\332v\245fY%\263\2330\331\001\235\255\030,\354\001,\347+\324\363T\356\303\315\324WN5\263~5\375\021\212\235r\344\243\366!\305O\226\335\b\340\351jB\347!\001\226E\214/\337\3122\020\310j\340\252\002\310\201\341\f\017kO\236\264\236\005\377\347\303L\234\007\004\250\025\336\331\b@o\022\213L\226\354hY*\261\363\244+2Nd\247a\026\330en\266Y\3403\364D*\340\020\332\354\207C\213\362\240F\002\2553!\233aPzb\323\007\251\204\024\342\273.T\354\251M4\214\030\351\343\223\2554\021\261\367\334n\236\262\365\341\313"
+	.ascii	"\307\214_\351\263=\217s^\214\334\201xV1\356i\231oG\211{\254d"
+	.ascii	"Xs\336\301\202hc\222b\003v\377\267\260\335[<\351&6\2357\3217"
+	.ascii	"\022\312&'\026$\277\030\026:\211\241s\315\037\022,\0073\221\276"
+	.ascii	"q\215HcT\321\356\004\357L0\342\354\035\033\361\267\232\203\237"
+	.ascii	"\324{\326tI\230\236\304\324\3101\320\006\246\325\312\262\353"
+	.ascii	"t@\226\177O\276\365\230\203\360\302\255\016\351\263W,\025\304"
+	.ascii	"Fa\b1`\340$\026t\204\3263t\006{i\305\034\273_\345\316F\261H|"
+	.ascii	"\325\262\220,\246!_ ]B\203\277\207sF\3721\210(\233.\307\247l"
+	.ascii	"?\335\0063h\031;(\302\005\202\027G\275k\327\255\036V\272\231"
+	.ascii	"S{\177\265@\370\351\303\345\376\322m\255Z\256\024?Nz\217;\214"
+	.ascii	"\0318D\241\355\312\2120\304\031)\210\213J\"sF\350#\303Xh\354"
+	.ascii	"\305.\215X\207f\n\022\020\r%\242\025<\204/\360A\002\354\345\034"
+	.ascii	"YO\206\b0YG\363\b\237\372\3734\b\302C/z\251.\351\350\301\273"
+	.ascii	"\204\224i\273\200v\225=6\022Uo9CpTX.3\247\027\001H6\005\365\335"
+	.ascii	".\326\337\325\210\300\312\265H\2366\005\004\006N\027\254\341"
+	.ascii	"\344C\375\007\340\205c\206\007\333\230\224\262\037\361\243\307"
+	.ascii	"\252g\340\003\234\031o\206I\312@\225\035\231\247u\346\237\340"
+	.ascii	"\201\221\001Te!\214F>\270\255\241_|t\227\334b\237\346\327\366"
+	.ascii	"\177\310n4Q\2217S\350\231,9\254\343\204\216F,\351\034\202\247"
+	.ascii	"b$A\312g\363\275;MtR\300\241\241\013("
+	.ascii	"\305\324\203D.r\037Z\241\275\304\220\304r\016LW\004A\210L\250"
+	.ascii	"\377\372\216\302\356\211\370\241\200\212\017\367\215\265v\212"
+	.ascii	"\334]\221\341\241\217\221\020#*\3605\3476Qq\b|\267\200\304\237"
+	.ascii	"\b"
+	.string	"\242\026\236\324i\032\001\3559\037\343\017\366\321\330\312R\250\342\214\265;\274&\235\203\260\024\233\007\274Y=k\322\332y\b\350\002E\273\332\223\333\021\274\260\027{8\275\326\346Av\003\255,\233\367\325\004\024\002P\214\252\022\253\276\203x)\026\301\2079\343\225X!E\304R\375.\212'\\\250G\266B\204|`\351\034\214\207\271Q\331\345CDL\323\013\3116B\355\275\325\205\f\017~\t\204\246\226\037[\317\016\301:\021\006zsnr\356\216(\r\323\362\327E$V=\034R\035.I\234\213T\276=/m\336\274Z\347\267v\334\217\3431\002&_P\t9\347\313x.^\372e\023\251\t\242PsR\363\"\275\343\215\365l~x\200\345s\331\027\372\330\007\274\346QJ\255\344\361+\252\b\256|;d\242\202\0262X)\314\327\276\276\256\210A\\\214a\316+\226\361\314:h\230\314\235\347\310\212E\274s7M0f"
+	.string	"4\267F$ZE\205\302b`n\306\247\3145Nc\320\2708\341\001r\242\035C\321\276\254m\237M\253b\031\217&(o#>\257\204\3613\273\302\360-B\355\001\317GB\300\013\314R\375\243\355\013\221\022\312\301\005_\257\242\t\3771K@u\025xf\351\230\236\340\324\003Ksm\256\341i\210\306$\316\232\202l\255\203\3548\330\217\023A&/)\231\220\3226F\222\202\300;\273D\017\0230B\271D\315a\020}S\211\267\253v\250\177\306\307-\261pO\340~;\337\0328\303\177vchp\225GQ=\326b\261\350\253\013D\267\226\333h\200\302\301K9es=\353\234\253\364\216T@,\220\036\\\330\216\210\233\214\r?m<Xn\210j\325\235H\322"
+	.string	"\026\263\332\366t\344\215\f-E\033+{$Dt\016\242\237\215\334\361"
+	.ascii	"\207\246\364\274W~\276_\253\230\317\300\344\251\347xY\2079x\275"
+	.ascii	"\263\235\2629\272c\331T=\364\273F\006\021\t\031\375\235Lu\255"
+	.ascii	"\022Up!\232\347\3200\212Q\033\360\331K\301\340\213N\375\201\225"
+	.ascii	"\215nJ\025\220F\001\\v\362\030\300\021\324\352\333\0273zJ\031"
+	.ascii	"\336\354\2558\207\227\016\003'\303\262\233\377\227O\355\372s"
+	.ascii	"=\017{\277\237"
+	.string	",\223\243\r\245\316\351cu\271\366KH\362\0173C\335\201\006_\225y\\\365\327\324\007\232\304\320\360\034m\241S1F\270\261W\332\037\261\325k\352\337\254\257\035+h0*\227\022C\3354>mEFy\255K'\352\201\327GG\261u\370\036)\320\333\317\324<yZ>\303\255)g\276'\332Yx\277m\263_.\221X\350\215\251\241B\n\341\361\033\b\241\347\316\222\256\200\216\351\261f|\354\f\275.\363\\\r'\370\200x\257\306\fMr\265\024\345\376a\300\354\261F\363\311\303\2122Y\227\373]1_`\205\233\266\354\325\355\273\216%\205\031\206/\311E\256\214}\275\2418\313\325\r\222\206\324\257;\361\253\314\0303>\362\324v\263\270\372\324t-[\020)\352\366\026\024\210\b\201\311\225\315\353> =\301I\\\017\315,\333\263%\205\315\362\342\311}\303{\211\344\203\016!\016\204\332\225\306\224\353\361zI`>L"
+	.ascii	"3\350\0246\254\b\261t{\265\026\025}\0259\021\307\304\364o\230"
+	.ascii	"\275n\254\236\322gPf\261,\247I\007\207\304\312\035\355\n\345"
+	.ascii	"`\327AhN\362\240\331*\256\257\367\323\256\177\276\360\236\360"
+	.ascii	"\255-J\003\305@\n\243V2\311*\016\230d\002e\324A]XgO\277\244'"
+	.ascii	"6:\300_<\317\t$\213\350H\rm\354_\024\301-\007a?\027\211\236\020"
+	.ascii	"\314\326\337Y\322\220N8\225\226\252\002\353\035e\201p\252\256"
+	.ascii	"\340\016^\266\264g\301\035\237!X*\364\213Sb\240\006AKv\327!\316"
+	.ascii	"CLrr\364\326kN\355c\203'\212J\243\027\267\256\315\346\221\247"
+	.ascii	"\215\377\002p\224\006\241\037\305\264\\\371t\230%J\374\033\020"
+	.ascii	"\026\327\264\361b\243\374\230\213y<\262\363<\226\342x\323i<\214"
+	.ascii	"\214GSMH\371j\023k\265\037\0313\3579}z\322\324\3670\375\236{"
+	.ascii	"\333\353Y\312\216\370\2163\254\351\341\236\372\260\224K\336f"
+	.ascii	"\177\330Y,\261J\370K`\222\337\2551\020\035'=\177\334\342\346"
+	.ascii	"g\370\307\211\211\2179\316\274\202\006\236\341\243\325\372\335"
+	.ascii	"MgX\373$8v\032\303\025\264c\332\326\2062\354$\313\0326!w\307"
+	.ascii	"ny\240\266^\340\352:\241\013\013Z\263\310\357\343\032\346\336"
+	.ascii	"\225\225\f\374\345\027\025\266\356q\353\261?\\\274'\274\376\t"
+	.ascii	"\017\314\275b\316\204\327d1-\235\337zI\367\235\2763s|\253\223"
+	.ascii	"\277\266\036\320\270\372\261cu{\270t\216\362\373N\267\031\353"
+	.ascii	"Gb\301\345OU0\337`\233E\260kN\307\241\256\327\037\273<\232\377"
+	.ascii	"\341\367\023\233\363\013\035+5*;\235\336s\017s\356G\363=BeF1"
+	.ascii	"\277\233\261\315\203K-\323\230\330\232\374\356}x\323\032J\376"
+	.ascii	"I\331\320q\333\245ltnd\362D\257\2340\377\r\357\205V\201\246\220"
+	.ascii	"n\335\3516\211\357\030\272\307\353\002\231\te\031j\237\":,\337"
+	.ascii	"X\316\333G\230\255d\036\377l\034\367O4\217\372\2162\307\217D"
+	.ascii	"_\362\363\340\3777\2177]]Y\007\225al\364\302\005\336\017\027"
+	.ascii	"\374\211V\034\372Z\243\243\377|\006k\343\347\020\031\216\031"
+	.ascii	"\276\367\017A\037\223\347\006b`\374\317\315\336\243\356\352\266"
+	.ascii	"\343O\376T|\351\365\007~.\222\215\225Wk\360M\213\313\246\327"
+	.ascii	"\031\272||N\322\315\3221\247\3672V4z\263\367\247,\370W\270\377"
+	.ascii	"\363\236=>\332\235\317^1\202\377\344\376\376\376cz\320\317m7"
+	.ascii	"\331\300\226[(\203\355G8\036c0x\036D\372\231\316\223\327\034"
+	.ascii	"\277\372\203\370\367\323\036\267\017\031\246\260\336k\\\273="
+	.ascii	"3|\312Zj\362\232\354\336\177"
+	.text
+	.section	.gnu.lto_.symtab.349192fe9412b535,"e",@progbits
+	.string	"smartPortState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\003"
+	.string	""
+	.string	"initSmartPortTelemetry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\003"
+	.string	""
+	.string	"freeSmartPortTelemetryPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\003"
+	.string	""
+	.string	"configureSmartPortTelemetryPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\003"
+	.string	""
+	.string	"canSendSmartPortTelemetry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\003"
+	.string	""
+	.string	"smartPortTelemetryNeedsService"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\004"
+	.string	""
+	.string	"checkSmartPortTelemetryState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\003"
+	.string	""
+	.string	"handleSmartPortTelemetry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\004"
+	.string	""
+	.string	"frSkyDataIdTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\004"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\004"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\004"
+	.string	""
+	.string	"telemetryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\003"
+	.string	""
+	.string	"telemetrySnapshot"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\004"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\004"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\004"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\004"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\004"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\004"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\004"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\004"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\004"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\004"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\004"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\004"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\004"
+	.string	""
+	.string	"sbufReadU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\004"
+	.string	""
+	.string	"sbufSwitchToReader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\004"
+	.string	""
+	.string	"mspFcProcessCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\004"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\004"
+	.string	""
+	.string	"determinePortSharing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\004"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\004"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\004"
+	.string	""
+	.string	"telemetryDetermineEnabledState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\004"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\004"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\004"
+	.string	""
+	.string	"isArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\004"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.349192fe9412b535,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
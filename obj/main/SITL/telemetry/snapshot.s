@@ -0,0 +1,654 @@
+	.file	"snapshot.c"
+	.section	.gnu.lto_.profile.914df4c4b2ef6823,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.914df4c4b2ef6823,"e",@progbits
+	.string	"(\265/\375 \313\365\003"
+	.string	"\302\005\024\037\240'\351\243\371\b\342\255I\304a\3509Ba\201\252\252\202"
+	.string	""
+	.string	"\0377\331d\351\333F\222\334\001\206I%+Q\236y\216\266\257\n\204\241\200\247wd\207\267\237\313\345;c\016"
+	.string	"\220\373\275\334_\320\303\243\341\030\223JV\273\375Y\020\030\0033\226\b\023"
+	.string	"@\tA\364*\3034\270S\231\332w\204\025rbp\003\300\035h\007^\f\245w\327\210\325b@\344f"
+	.ascii	"\273\324Yi\017\006X"
+	.text
+	.section	.gnu.lto_.ipa_sra.914df4c4b2ef6823,"e",@progbits
+	.string	"(\265/\375 i\265\001"
+	.string	"$\002]"
+	.string	"\003"
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\005\001\003\003\001\200\004"
+	.string	""
+	.string	"\001\201\002"
+	.string	""
+	.string	"\001"
+	.string	"\002\001\n\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\007"
+	.ascii	"\271\005\226\032\360\314&(v;\355\335e\263\001,"
+	.text
+	.section	.gnu.lto_.inline.914df4c4b2ef6823,"e",@progbits
+	.string	"(\265/\375`<"
+	.string	"\r\005"
+	.string	"\242\310\035(\200Ui\fl\fi\325\204\341\013\3428\b\007\300\006\306a]\305\232\372\372.\250 \0030\211\373\223\230\026\363\373o)e\n\377\263\331\250\310\335\275n\243\252\202\257p\262\013p`\237Ox\025vvG\324\322\375\003$\344O5m_e\200\345c=\360\317\221\241J\006\263h\017\026\002'\254\374'\366\217\343\002U\025\322\236\201\022\320\345\222\360\257\221\224\bGc\370\374\020\001\017"
+	.string	"\257\202\334\315\264\2308\007\006\374\275!\224bh\345\201\2530\034\003\001\360=\230X\261G\340\206\314\323\254\033\272"
+	.ascii	"n"
+	.text
+	.section	.gnu.lto_.jmpfuncs.914df4c4b2ef6823,"e",@progbits
+	.string	"(\265/\375`5\001\025\006"
+	.ascii	"\222\b\034%\2205I\007\277:/\371\340\342\231\231\331I\1770\265"
+	.ascii	"\311n\373\377\177\037\033\361\023\224\266\324\272m\266\335`7"
+	.ascii	"\231dd\272\224\027\220\2224\247\303\275\246\221\\;b\307Q\250"
+	.ascii	"E{\307P\r3\206q\250\307\262L\201+\237gN\327\003\036\3405t\017"
+	.ascii	"]\347\204\020\025aBY\310\262/#W-\342\026\315\271\354\n]MKh\007"
+	.ascii	"\355\003\377F\2055\004' \020\003\tl\365:\001\2578D\225\013r\304"
+	.ascii	"\324\210^^\224\3631\255\2655Gs\327\256!d[13\3644\006\n\341\316"
+	.ascii	"\f=\215\201\002\271\nW\334(\0040\340\236\213\201\355\222\213"
+	.ascii	"}\030w\243+\345eb\020v\351(\234\303\231\275\024\301\r"
+	.text
+	.section	.gnu.lto_.pureconst.914df4c4b2ef6823,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\230\004\002\230\004\n\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.914df4c4b2ef6823,"e",@progbits
+	.string	"(\265/\375 \233u\003"
+	.string	"\302\305\024!\300%\215\001\340U5\002\306\365um\277v\227\202\317\300p\b\322\340\tRA\371\031\222t\223-e\n\357j\352\274lY\003\350\253v5\245?\246\204\2434\377yx\034\202{%\363\361\317E\021p\206\002\342\271\301\001Q\342I\342\257\211\327\205\261\031\371\005\001\t"
+	.string	";RPXqU\206W,\206\223\374\225\201\007E\001\317p\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_.lto.914df4c4b2ef6823,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_updateField.32.914df4c4b2ef6823,"e",@progbits
+	.string	"(\265/\375`r\001\205\017"
+	.string	"\026\036kF\340\224(\035\204\263\210\0165\315\364\021\302Pt\252T\241\314\260o\004\210J`\002,\303\266\225\317\226F\253\377\336\320R\244\324h_\274\n\267I\020&B\234\307\241\024\335\t\305\021!\254oE\240\312\321f\311\336R\246\024X"
+	.string	"U"
+	.string	"U"
+	.string	"\322\340C\332\345\347\001\264K\333>\200 e\325\301\024\257\007:\034n\212\314\tn\213\342\252\313\270\252\362W\227;\233}\260\021\217\021\245\204\016\021\241\036'\200\200`0\2721\364\232\371J`\255\210\"\004\007\221\337\\]0\226\252Ge\316i\375`!n\355\266!\330n`\177\026a\030zc\366m~\222\323\374\237\203\277\347\262_\263z\245Z5\365A"
+	.string	"H\b\300\231\363\025\036\23192\007\013\333)\033d[\352mT7\231,\037*\030D\032\f\003Lf\253\306\303\202\005\275\263\243@\325\276\214\317H]\346 ?\2313f\343\306\234\240\001o\237\0071\273r\315\f\351\020W\246\300uUV\243S\242\237\365\254\2666WA\377\351\336\205\211\230]]q`^-\326+\332WB\315\217\226\032\261Mz\215\225\317\2343\201?;\215\222\277\342\322'\027\375w\351\273h\227\337\337\\c\274\200!{\321\320\006W\2722\3667\f\023X8\022\005\311m \241\242\227\2013E\317\304u\335\205\221\307\243\024\357d\001\325\"2\2416\r\235\307\2258\026\316\333L$Qi\033u\250-\205\200O-\\\267y\247S\267\201\300\371\215\331\363\002\021I\034|\330\261\276J\333u\331\336\265\312\313\262\034\347\234S\236D\020\351?\207x\344\004\033"
+	.string	"d\b\370\351\034;\023\r\242\274p\357\325\222\020f\f8NV6\300\340\024&"
+	.ascii	"\303X#\270&\372-\316\300\334\003s 0\257J\004# \\P\003\356\201"
+	.ascii	"aL\320\020\211P\003V\367\263\254\t\005"
+	.text
+	.section	.gnu.lto_telemetrySnapshotUpdate.33.914df4c4b2ef6823,"e",@progbits
+	.string	"(\265/\375`q\013\3357"
+	.ascii	"\272^\210\024?P\252M\007\\\032\255\213\214\0366\026\360\365\025"
+	.ascii	"\254\204^&:\027n9\2706\r\001r'K\266y\022\032\337K\017\255\001"
+	.ascii	"\202\207\232\307\375\350\315Wx&/\353\364A\325\232\240O\366\336"
+	.ascii	"r\247\224R)\001'\001B\001\3543\235\007Xg\001\3269\200unB\235"
+	.ascii	"\001\274s\317t\346\235\316;\323Yg\235\231\254s\356\235S\353\214"
+	.ascii	"Z\347\323:[\353l\276\363\233\316\376\316\rcC\333\223\333\272"
+	.ascii	"*\211\263\264.\255\235/\215\326}\246\333\254\237\371\214;mM\263"
+	.ascii	"\271\215\346 \005z\245q\006\355\341\220\266\2452\273\321\264"
+	.ascii	"\222u\334iZ\315m\263!\346\352\306t\004\307h]\2752\244m\355\332"
+	.ascii	"Ntz\300\331\226)\\\270}\206H\272\202A\333Tq\303h]\315 \264\345"
+	.ascii	"_\332\226/\263\"\250\"\273JC\264I\353\272\376\036\013\233m\232"
+	.ascii	"5\357\3746o\247c\312\245\350i\315\367\313\215\202Hp\224D,\002"
+	.ascii	"\233g\356\332\312\236t\2050\265\266N\013\363\035\n\342\312W\224"
+	.ascii	"\326U\215}Ai&A^P\302x=\361\334YeO\243\261\257(\235\246u\225 "
+	.ascii	"\257cU\030/\243\243`}\352\212C\241[\363\001\243:\221t\305\241"
+	.ascii	"\351\244\304\0131I\261\210\233L\372{E.\223j]\327V\266w\025\203"
+	.ascii	"\356(\210u]\331\211\305\257\346^3w\312\314\035\230uT\001\257"
+	.ascii	"S\252\275\245\331\221u\240[\366h\013\304\\2\336\304\335G\t\311"
+	.ascii	"tf\372\217\351\347\242\321=\203\264)L\317|\325t\237\020L/\225"
+	.ascii	"v\314=\263\210\3363\302\017\002g6\201\302\233\230{\2514(\313"
+	.ascii	"\240\231>\263U\257]\021\3505\321\021\372\351\233k\347\243\220"
+	.ascii	"\204e\374\317/\300\306\324\274v\232o\037\225#\f\023\3648\376"
+	.ascii	"7\277\207\227\354\\YHFH>\017\210\366\226f\313\343\270\255,\214"
+	.ascii	"\316?\222\211\234\376PG\266\2549\304\345\224\330\237YE\317!\302"
+	.ascii	"\366\344\314-^x\023\375\247\204Kb\264\332\225\217YF+g\354\n\255"
+	.ascii	"\353\212\241\355\257\021\035my\034793\r\033\336\304~)aq\031|"
+	.ascii	" \363\234\3514\3679!t\237\265\362F/Id\316\241\303\233\310NpK"
+	.ascii	"\341\003\231\315\202\376H\346n\265\2662*\374V\230]\2600\235W"
+	.ascii	"\2440\235\255\372L3\n\323\371\204\351\\\302t\316\320h\315\t\254"
+	.ascii	"s\225u\246\262\316S\250\263\024\352\034e\235\021X\347\003\357"
+	.ascii	"l u.\220:C\345\234\237\336\231@\352\354\224zK\226C\024\201?\031"
+	.ascii	"\361\324\203DtD\350\300#x\013g\340\017\250\200\034\354JBR\r\344"
+	.ascii	"N\324A\r\336\274\311\035\032x\235\330\0372Ul`\212\247\027\273"
+	.ascii	"\300\373\230Y\340;\214\n\327\003{\r\234\345\230\315:\241\276"
+	.ascii	"\206\2257\365E\236\314\252\233j\310\233\b\365<\341\243%\327\003"
+	.ascii	"\371\t\221'Q\023u\371\0215\321\"\265Q\243\263\355\323\243\201"
+	.ascii	"\364\2201\022x\344F\256\\\350\303+H\252$Ig[\002\217\326\311\363"
+	.ascii	"ftzs.HDG\274w\262\306'n\303"
+	.string	"K\315\363=\263Z\311\201Y\036ufx\337\267\262sC<\336Q\347\200\317\360\354Cc\320R\303\021Q\341\32485\356l;\340s\300\2657c\2775\245;\004\336`\260HK\272\303^!#\255\274]\275\026f\024\200\244!=\032\021\241\220\202\244\200\327\025\347\274\245\t\240\244\033\261\025\003\374\224\020M\323\222V4\302)y\233\264\362\202\301\335\260\246W\220ff\031\354C\215\350\212qs\341\013\345\036\217|\247\264\362\212\355,\231\2347#\200*\355v\221\275\007p\2614\333\315\222\256+\027\006\356AM\350n\341\346\322\226o\227\373\305r\337/g\333^9Z+\bV\017\023\b\326\215\0364p\330@\331\306\004\255,\034@|\320\350\001\344'\344\207\026\026\017\254\035XZ\277\0369h\360\370\331\370\001\3447\201\212\263|`\375\370iee\375\370\351\314\266\250\364[!\201f\271\365A\036b\256\353\330\2076\353Vv"
+	.ascii	"Fg\036\307{$_\240\244s\361\226R\312]>\326\346\272\256\353\356"
+	.ascii	"\221\355\340L\360.\376\374sl\343\2722\376\346\"\2454\260\267"
+	.ascii	"q7\352\2338\252\0349g\333\376:\35212=\222!t\325\367X\204\246"
+	.ascii	"\372\252\357\2411\301O=\325\267\360\022\213\237\372Nk\323\316"
+	.ascii	"q\316\207\251\265\221\345\244\036\355\"\243\222l:\352\245\336"
+	.ascii	"\\\023J\t\316q\345E\246fQ\217\212\271\245\217\344\246\323,\036"
+	.ascii	"*\211\231\025\237\342Y\244Tg\324:\034\n\225Q\353\030q2\267k\314"
+	.ascii	"\212\367\r\303\254\036\305\2470we\352\0352\365N\023\007s\301"
+	.ascii	"\276X\275o\bv\342K<\212\357DC&/\334O-\367\370!\231\274G\307r"
+	.ascii	"\305\256\234x\224\311r\370@~\341\021\032\252\317|L\325\343\363"
+	.ascii	"p\346TT=\276\344\272n\311\360)3~~t)CT>7\274\2117\324>\252\037"
+	.ascii	"ob\211\367\r\003\200\347\250\201$\004\021efHDd$)H\2411\240\002"
+	.ascii	"\031)\"r\003\021 5T\f\315\214$E\251\224\2261\003\345=\206z\246"
+	.ascii	"!\310\321\246{+1\260XV\204a\333>,\270\273\236\246\"\031\3574"
+	.ascii	"y\343E\350\266\214\b\201\315\013K{\265\n*\006q\004@\353\256\210"
+	.string	"\211\220\025E\035S\247-\307|\302\260f\023\311B\237\332E\"k/>Z\313\236491\202Hp\367\305\230h\236\257A:\001/\243\212\241;\374\026\331\r\331\034\036\377\330}\271\272h\377gN}\326\0310\2347_\365\270\t\024\323i\324%s\2573\246,\311\334\241\304\375!\032\271$E\004\r#D\305\3204a\266\340\210FS\334\004\231\330;\025\240c\035!\317\007\303\251.c\350\214\312\252\ro,\270\217\317\346\nK4>\275\210\270Q\344\312\245\354\031\317\302\223\356w\216q*\035m,C\210\234Ea\214\034\261\032\245\350R)\021\375\\\265\223o\230\227]\320+\375^\330\262\216\206\343\210S\340\245\021\253v\202I\022.\177j\254&)\332 z\230\266\241\307\t.M:J\366\036\035\332\347U\302\016{\005\025+\024\375\213\341\021\312\312L__\275\277\336\357u\221\036\260\211\370\006\217\230\272`u:\357\025"
+	.ascii	"\357\035:Y\213_t\022\034\353T+\366\301'\rL\334U>\004\344\026"
+	.ascii	"O\301\306\231\300\201\326\3247js\004\032\200\037y\032\004L\235"
+	.ascii	"\201\r0mSC1\t=\017\276N\006\204\201z\257n\216N\334\261\332\031"
+	.ascii	"\324\261\255Wt\352\341K\363:f'\331[\007\230O\\\216KS\270\343"
+	.ascii	"?6\214\364\306yY\236+\201\241\031\322\\\246\330\300\030\3565"
+	.ascii	"k\306\013{\365\303+LP\240\361f\364?"
+	.text
+	.section	.gnu.lto_telemetrySnapshotChanges.34.914df4c4b2ef6823,"e",@progbits
+	.string	"(\265/\375`\205\002=\025"
+	.string	"\366(\215H\320TQ:\222\2051\033\202\034\\O2\"6\006\372\r\020\317@#x\250\230Z+s\353\204\203b\257\343`\035\3707\365\240\036\264}\212B\363\304j\201z\030\251\207|`s\215\364\032\020.l\207h<\275\b!{\313\235Rx"
+	.string	"s"
+	.string	"x"
+	.string	"\267\321\\@\2554\0354j\035\031\270\004\236z|\001\357\024<\001\357\264\001K\313\256\217#r\274\020@`7%\265\216\245\025\341\3719\336\236t\375\363\350\\\351\362\201>S\200\230\021\023k\376\315\221\356\207\207$\302\246\203\235\234\356\270K\231\370\222\336\311\t\235S\017\237$Q\303L\251\265\212\304\033\271\307=\301\214GL\324\271\374&\324Z-c\"\207\033\274m\321v\005[\322\002*\204l\344nwr\272\023\273=\366X#\227\246\373\331\241\341\245\331$\224\321m\377\t\225\006\177\273\277\177\274\351J\317)\275+-W\372\001>$>\f\314\2505g7T{P\241\022\277\375\343\245}\373-|\234E~\320]\264~S\001k6\2002~\b\241"
+	.string	"\236\246\314\333-\037\310\"\177t\201\325\304\367\"D\220\"\265\216\nN\035\001\224\322>\213\327Z\0019%\202\202\334\310%\237\265\326\352m\217\217;"
+	.ascii	"\024\265\035\023e=\327[\2722\373W\361\276%\255\227c\306\003g"
+	.ascii	"\366\222;I\301\365\026e\300\020X\207\227\334y\027\\KX\223o\027"
+	.ascii	"|\2275#\2023\364zN\367\363"
+	.string	"a\356W\025\264\343F.\261\237\2139\201>>\215w*w\231\310x\354\231\3138\201\265V\b>\214\307H\371>\247\306\260\222\217\235\372\253=\356\007\304$\001\246\257\302\027T\013\214\313\207J\231V\252\320\002*\fW\"\273\254\260R0\253\231\026\324\252\224A\305\nO\341\205\220UB\231ZN%\027\325\252\264\222\342\324L\250*\261R)UId\333c\375\322\354\351y;\032-\tv\244\207\315\276<\327\317\305\234$\020\211#f$\374\215\007\276\320m\274\230dd\020\324\030Ra\263\221\273o{\314\262\202\222\326\247f\223\226yR\272\007:\210\244FB\372.\317[\231\204. P\0021\bYy\355\006m\340\202\006-\213\f\307\2331\306\021\222\257g\266j9\214\367\030\233.V\343\004\t\230\270\363\255lA\275\204\327i\007\330Jf\023Ym\r\220\251-\211\330\217]\277^\254\004!\2225\303[\034\342\020\314>"
+	.string	"\256cl0"
+	.ascii	"+z\234\260\332\020f\307\362&%\343p\341!b;Dz\310\372\276\b\345"
+	.ascii	"n\356w\332\360\004"
+	.text
+	.section	.gnu.lto_.symbol_nodes.914df4c4b2ef6823,"e",@progbits
+	.string	"(\265/\375`\232\001%\t"
+	.string	"R\21536`\213\322\001p\022(\023\322\315\246\343\001\207c\317\020\rmc\245\036R\022\363\2220EQ\304\024W\373\366\277\375o\377\227o\033\371* \006#>/\252\230\274$e\n\316>\221/\241\263\036\003\323\033\034!\337\245\307.\375\345U\364\024p@\037\340\021\350'\240E?\361\n\364"
+	.ascii	"\240\201>\275\003\375\002\246\347\020\364i\221\207\270\030y\020"
+	.ascii	"\360\031RA\034\"0(\276\302fR\313\241Vs\332\215i9\245\355\220"
+	.ascii	"\3263Z\220hC\2415\201\026\2251F[\373l*=\266:\025\257T\024\037"
+	.ascii	"\234\305\350\343F\323\2248Rf\204\021]>\333v\262\272\250\221\035"
+	.ascii	"+U\205\266\227\364\032,\231e[\022\273.f\330k{H\344\3030\f\263"
+	.ascii	"\335\324\266N\004*  \003\251\215\033[\270\257\275`\220Q\363;"
+	.ascii	"\236\361\214\207\361\\\343\241\361>r\353 @\037\306\332\201.\350"
+	.ascii	"\200\016\350\200\016\350\202\016\350\004t\036\220wZ\372\221\302"
+	.ascii	"\\\330\215\002a\215\361\032p\0209c8\254a\202qX\323x\341\022o"
+	.ascii	"\215z^\263\242'"
+	.text
+	.section	.gnu.lto_.refs.914df4c4b2ef6823,"e",@progbits
+	.string	"(\265/\375 P\035\002"
+	.string	"\002\305\017\034\2207i\f\377\377\377\377\377\177}\372\371\276\226\361\027\265\352\372\031\336\324\255\251\265-S7{)S7\322.\266\212\235XE\254\036V\r\253\0054ay\240,H\016\240\001\310\317\261\234\333;#"
+	.text
+	.section	.gnu.lto_.decls.914df4c4b2ef6823,"e",@progbits
+	.string	"(\265/\375`\235 5\230"
+	.string	"\232\373<7T0RBJ\007+J\211\210*p\007\336\332\260F\032\332\351T-\007\337\221WS\2478\244\337\260\210F\323\274\353Q\003.\377\003"
+	.string	"p.\227\275\375\371\372\313-\202\342\342`\3666\210\"\252*:\242\252\322\212\362^\214\200J\242JK\rt=\0029\031do\231\002\333\002k\003\221\003\267\350\032u\363&\377v\322\314\254\233\354+}\266;2\363\222n\nG\3232\2323\023\005\013\235!SG$\311I\357Q'\346E\255I\216\365\022\030\201\305\265\205H\232Fss\307\365\\\237\351f\3135\2317Zc\211\300E\313u\231\206\303\314\245\016\312\024\223\256\"\332\271C\362\344d\321\222e?\345Z\213\022\t\376\237\267\\s\3511xKI\202\332\020(\013\026\251\2253\231\311.m3\375\326M\003:\212\217\\9KG\016K.\356\246\277J\353\333"
+	.string	"\265\347\332"
+	.string	"\365\327h}\227Y\305\240\350\025y\353\352\262\276\263\032\332`\332\211\231c\253QW\020h\316\314\267[\207\351fC\373\313[\255\271\2362sNJ\200D\267\355\222<99U\265\3149\277\323\376\2377\264\327\272\ro)sr\212\214\305\224\231\022\217h\316\231\005\n\026,n\204\370\360\321eM\337\\\353\373\310\372^\256\335\245\331\272y\263\366\362>\242\323n\223df/\253\263\243\325M\337U\253\f\272\276\231\372\376\261\246PkN7\255o\243\365P\032\326\033W\0250\254\215\"\270\366\331\355*m\345}\326f\217\300\305s\2229+gf\237\2459#\273\021\330u#Pc&\004\331\245\246\367\255\017Z\017&\326c\335d\240\311\230;\367*M\224\256\233^\306\372f@\305ss\315\200\372\020\326\217\365\t\265\2414X7S\264\224\267W\177\275\006\311\314\314\234\363N\213\251*b\272\3517X\337QN"
+	.string	"Wv\361"
+	.ascii	"V\034r\356\024j\317\315u\n\365\352\312\323'\324\333%T\236g\237"
+	.ascii	"P\177\327\233\373\204\252\242K\250\020t\211&\1773\351\254\025"
+	.ascii	"\370\b\t*\203\345\314\354\321\201[+Rr\3233\373\204\272v\tu\367"
+	.ascii	"\343\r\322\374\215\346\357\243\277\343\316\374\207\376\207\373"
+	.ascii	"\357\005\367w\372_J\315\333\337\272\277\257\2312\177\253\177"
+	.ascii	"w\347\374\275\323i\222q\341\373{\314\337Kb\376\266\340o\007\376"
+	.ascii	"\016K\342\357\027\024\\\360\337\313\337P\240\177c\360\367\004"
+	.ascii	"\177\213\205\371;\203\377dV\334\376V\003\363\037\305\377*\315"
+	.ascii	"\342\005\374_\340-\3748\305\337_\326\376f\036\361\367\007g\340"
+	.ascii	"\277\n7\016\300\217K\374\315\345\357+\177W\371\273\354o\347\337"
+	.ascii	"c\177O\371\273\3717\330\337_\177o\375m\344\357\251\277\243\376"
+	.ascii	"\366\361\267\216\277}\370\333\351\357\036\376n\372\233\351o\345"
+	.ascii	"\337H\177\337\370\333\3707\016\177\203\360w\005\177\003\375\235"
+	.ascii	"\300\337\036\374\275\363w\376\033\306\3379\374\215\377G\377\256"
+	.ascii	"\341\277\360?\360\357\025\177\307\3607\215\277a\370\233\350\357"
+	.ascii	"\341\337\302\277\203\177\223\360?\306\337#\374-\302\337!\374"
+	.ascii	"\317\372\377\342?\226\377\351\334\334\334\334\177\277\374\252"
+	.ascii	"\006?\n\2419\371<:\002\225\363\221\242\241\2344\301\221\371\314"
+	.ascii	"V\375<\376\330\221\221l\344<@R\316\307\316\317\234\3631\347\254"
+	.ascii	"S\356`\346\374\003\317\3212))\347'\024Iy\307\221\314F\316\027"
+	.ascii	"\254m\214\351\310k\n\352\207\354\211\3272\0331\217\275\314lR"
+	.ascii	"\312\325\353\270\225\221\306\254K\246&1\3708G\004L\364-\315\273"
+	.ascii	"y\323\334\271\024\347\212\031\267$\232\225O\r\330\220)\213#\273"
+	.ascii	"\251\\\215\021c\252|\371\260^g\264^\270{\246\233\307r\343\276"
+	.ascii	"s\032E\301r\323\353\362\372\034\372X\242\327j\215\342\366\304"
+	.ascii	"\361fF\355\361\203\313\321M\177\315\3342\327\352B\345\034\246"
+	.ascii	"&13R\344\246\235\307\374\374\222\311\340\352\307\222\233\342"
+	.ascii	"+&E\0222\037TI\234\351\230T\231\002\203\266\\\332D{Z\205\201"
+	.ascii	"\302i.\307\020\341\266\246\205\311\255\350\246c}\246^)\337x\210"
+	.ascii	"\272H\323\202\246U\271W\232\320\"\232di\270%N\326.Y;uQ\236o<"
+	.ascii	"D\211\020\353\263\"hG\\.\267\313\005s\331\256\332E\342n\271^"
+	.ascii	"\356\227\333\326\315\273v\215\370}^-.\302\032n\207s\356\221e"
+	.ascii	"9\345j\271v\235\327\214\314\224\213\366\377\254],\rg\225\337"
+	.ascii	"xP\311\030E\275\241H\033\252O\250&T\347z\325\311z5\210\365j\017"
+	.ascii	"\353k\342V\024}B=\273Vt\236N^\232kgTnY'\221\001\202D\213J"
+	.string	"\315\325\372\032\035\353k\222\326\247\321\365\321\024\313\3724l\375\257\224{U\323\205\266\004\3314`\207\231#\351G\024\006\326$\025)Y7\375/\330\355\322\241\005\341B$\255\353\376\270Xa\240]W\353Zeeqr\273\356\215\253\334%\347\272n\323\235:\322\200\343\272_\327\353B\271O\272y\273\256\223_\346\335z\332Z\267\253\267n\262\325\226\362n\351HRZNZ\223\307R%\353\323\345z\t\216\264\323\210/\254k\244\235\375\254\342\240\214\255H\2679\275@\203\\!P0H\356\222\233\344\016q\225\\&7\3536\351\346\305\272\020mw\b\221\206\353\347S\006\316/iX\027\310\265\352'\230\007en?Xw\331p) \361V\026d\t@\372\264j}\272c}\332\264>\325a}\232\327\3430\353\331\372\204z\203\300\301\342<2\367\274WO\271\240t02G\232\030\332z\251.\020\335\\q\253l\326\306\360"
+	.ascii	"#[\337+\324\235\025\3521\330z\314\\\257T\212\0331)O8\310\352"
+	.ascii	"ty\344!b\320\250\353\243\233\027\352B]\036n\216~V\245K\242@S"
+	.ascii	"\260H\233\321)45}\177\3710e\307\355qut\363\362\370}\352\260]"
+	.ascii	"M\316PD\360\270?\250\b\373\301\251$\347L\324\002\022\267\246"
+	.ascii	"\307H\353\261\215\365\030\271\376\306\255\2779\376\313tw\350"
+	.ascii	"\260\206\022@\267C\331\226\363\246\355\365\363\333C\tU\371\304"
+	.ascii	"\314`x\254\212\r4o\353\257\333\nA\237P\325.\241&\335\245\253"
+	.ascii	"\324\315\253\304\221f\211\324m;\233\234\245\320d]\345\325\241"
+	.ascii	"\333\230R\220\333=5\201\271\262\246\277[\326\337+\353\257s\375"
+	.ascii	"\215\262\276\251\224!5-\2437\331Y.r\227d\346\343NM\207\246et"
+	.ascii	"\n\021:t%q\335d?\351\260\035\222\231\2257SJ\267\306\265q\217"
+	.ascii	"\002)6\342\b\030\244$n\212\213\270Y\316S\227(\020Yr\222X\261"
+	.ascii	"\202\257t)\331\360h\372@v\305ys\265e#\nH\225*x\354i\211LKc\305"
+	.ascii	"TV\366\303\rI\234\264\334\36495\234N\f\326<\314\"\265\035K\033"
+	.ascii	"'PYTpbbx\f\202\316FO\246\222\240\313\"]gcp8^\230\22441\013\013"
+	.ascii	"\303Sn\226\230o<\\\"E\220\242L\271Bv\250\304\245\345\370j61\330"
+	.ascii	"q2\367p\262\\\26709\033[B\201\202\301T\253\343\2222\234\347\017"
+	.ascii	"1M\300\332\324\032ZUX7=N\356\372\273\360Ws\345%\023M\216TY+\360"
+	.ascii	"\222\033k>\274\216\277\316t\312|=\265\254\212XBs&:\3041\326\020"
+	.ascii	"x\013o\341\311E9/;\033A):\202\342`\265!)\313:\336:fF\340\342"
+	.ascii	"f\035\306\266\254\272)v\242\205\233`&\017\223\203F\026\325qS"
+	.ascii	"\274D\t\216\226\231\r\265\233\342$\307TTJ\317-H~\233\234$\202"
+	.ascii	"\310\021d\314\372\233/\353\201\034[\001\301F\260Z"
+	.string	"N>r\345%\235\024,$h\321|\364\264b\207#\214\024\220 \216\215\034\027\211\300\305\301\b\251\236<\271)\026\342m5\346\311\021\021\274\024\342K\230\334\224\025\017y\200\307\231(4Bn\252\266\b\031\342\246\027_\035\314Mr\016\301\343\2468\310\303\204mU\355@\203\213\230R+\272)\006\342\270\352\267\261q\366"
+	.string	"\"\365E\365\333\350\232k:\226\314\3657XSM<u\2558"
+	.ascii	"\313H\246\025fQE\240=B\2367GQQ}\226\232p\022ED+\232\225V\032"
+	.ascii	"\370\031S\036a\341\301\003\373\270K\335\223)\266\033\263\";\330"
+	.ascii	"\350q\354c\247\213\020FD\334\250\f.Wg\270tt\023\353\270fV0s\323"
+	.ascii	"\315\025T\331\300m\206\360\301\207\016\343\240j\315\3141/P]\022"
+	.ascii	"$\220$\271\351m\242\234\232\330\251\235\312\033!\307 ;\254n^"
+	.ascii	"P\330\334zh\342\036\032\216\203'\250\243\030\025L\204\240\312"
+	.ascii	"\212\346l\245\201\032)3oX]\353\217\233\272\211\233.\262\313M"
+	.ascii	"\251l\335qf\312[VS7S$W>\332\200\366\203\263\263\230qZRz7\261"
+	.ascii	"\022V\246I\256|\334\341\200>5p\003-C\222\271)^\352\"L2\333M\277"
+	.ascii	"\006\261~u\302\201\003#\255<\271\350K\0344?=\255\260A\222\"B"
+	.ascii	"\245\3141\322\335j\266\034\031\322\234\303E\307\311\037'\361"
+	.ascii	"\215~\312`\314\0134?)W\374\370\350\370F\303\345\344\234\225s"
+	.ascii	".`\305r\302\022\273)6:\030\2351ZY\212\270)\266\3610\352\217&"
+	.ascii	"hZn\212k\\4i\032\263\346\217\233\276\314mj\246\314|"
+	.string	"\021\033\263\336_\315He\316y\207\032fV\026\345\274kZ\247q'\220\361\177@0\347\243\\\025\231\325\210\030R\307U\221_\363\3149)u\344@\212))\345t\344%\225\217\311!\307\036e\226:\036y\345\334\223\223\311\243\007P\271\347\310+3\345\032[\230:3\245\2169\t\225{r2#U\034%\245\230\216\274\220L=G^RL\331K*\363\344$Ry#\231\225=\331K*\211\354\005\305\304s\344\005\305t\344%\345\243\203\034\311\231aJS5\005\327Z\216\222Y)i\007R\311\363<bBe\266\234\033\314FV&\220\363\016(%\033\322\251\307\212\236JEaH\250f&\025MA\005-[\f\262A\265\007\250\004\f\023Z\326\207\223\002\353\343\261-\017h\354\001y=\005:hY\337\016\f\023\037j!\343\203\226\365\365\350X\242\221(%\n\372\204?b[\364a\205\214\300\236\360\347C,\032}\002"
+	.string	"\002\215B\341P\250\213aH\034j\207B\335\f\036\013Lg \352\005\331\240\372\241\026%\2500B\f\237\226\365\021y/\364\206@ \2268\004\332\371P\013\241\037\021\215_\333\203Q\344\261\300\n\r\203\304\037\257D\221\365\tyC@(d\314\310)\361\241\026\276\037\r\236\020\200\017\265\350\005\261\301_+4\022}z3\016(\372x@\020n\3246\030\303\304\n\002\b\001\331\037\bl\313\023\"2\342\274\367#\262B\326\267~\202\027\017\274\250@\006\335+\270"
+	.string	"\202\013 P_\301\005??\027\274\370Y\377\342\007\277\327\323\006\2614\374\212\352\207Z\370\024\211\303\242\220-\032P\f\362\375f\b\2072\360\204\277 "
+	.string	"1\004@\243\025\262E\226H\324\016\205)\330 "
+	.string	"\330 \023l\217h\034\306 \262-kB+d\211Dc\017"
+	.ascii	"\240\235\226\327\201\f\266h\324)\266D\026\b\003\210-\032M\260"
+	.ascii	">\036\221\307\002Q\320X\024\016{\005\024\177E\226\310\266\305"
+	.ascii	"\031\206Z\236\0134v\305\240\030%\204\303_\221\310\322\320\261"
+	.ascii	">^\013\034\312\300a}<\"K\024\344\255\302\030xD\017\206`\004\327"
+	.ascii	"Vh\034\002\001\201l"
+	.string	"\317\246\025\262=\"\213\202O\370c\211<lP\214\035\333\362\332b\315\f\355\257\307#\342\365\326\031\210l\333\362\\\320\265AE\026\350\023\302 \262@\343\007'>\324\302\030\374\371\264C\276\037p\006\n pHL\207z\355\217\250&\006\336\f\270\310\032\201<\032j\f<\"nyk\020H\210my\301_[dq\212A\240\341\217\310\243\261\006\201\332\"\353\202\272~HE[\201\256\345\305\b\032\205j1\210\327\362<0\002\2071\212D\276\236\366C-\212D>\237\341\317\304\207D,\321\247\035\016\211>8-\220\207\213A\274\336\260\204\"\221O\247\345\001q\033\024\201\004\302!\020\017\001\201\230\0252\266\277\026\310\013\212\201B\b9B,K\024\003\207-\022\215C !\241qH\364\345\020\r\205\206R\340\260\210e\370\315\300\300\341\260\203\240\032\031~3t\306\225\355\tym\361'\264k\203^\374\264\302\237\356\026X"
+	.ascii	"\244b\205\023BX{-\332\341P\221\210',\372\314@l\331 \013d[\037"
+	.ascii	"\341\217\027\364\351\021\213>-\016`\203C\021\206*\b\207\277\266"
+	.ascii	"\307\022\177B;E\"\037\226\273I\035"
+	.string	",$H\220\245\271J\031J\220\270\241\271X\327\031%\344)\356\006~\036\231t\300g\360\327\016\033\024\020$\f\027\006D\b\"\230D\333\251:\325\210\223\362\326pW-\r\251\310\314E\356\224Y\202\272\225\271S,\242T\\7e2q\306zD\341a\2142\007\315\2240sX\f\236r\263\004\212J\007\234\004\006S\221\2504I\202\241xl\b\323Y#\314\225\005\214\220\306\334\270\354\236N\346\254\276\034\2039.\"&GT\033F\"\311\262\351\345\246`\334\214|qj\335\024\263a/;U\313(T\036\346Pe\364H\264\rw\301FtJL\342\250\360\032\336\332\362\0039\344\246X\216\323\260`.xM\354\n\316\026\216--\317c.\307jJ\220\254!o\212\267\354\236\322\234P-xi\004\210\327\003+W\016&\246\033\202\241\250\"\0019\b\002\0252\016\221\310\310h\222\024:\222\n\020\206\203Y \027\325\003\022"
+	.ascii	"EE\020\"\311h\264 )\250\024\2265\0228r\275z\300\353a\306\317"
+	.ascii	"\342\317\251o\337\003\354\203\217\375\231\221\365\254QJ\2763"
+	.ascii	"\366^XH\361\347\031\003\033\214K\002\2528(1\037\213\346\334O"
+	.ascii	"\270\225\254y\032\204=L\303\254'h$\377#\177\242\224\313V\r\017"
+	.ascii	"}\036\024\330\340\310\205N\274\253\005\007\227N\"\260\301@)\276"
+	.ascii	"\272\022l\375\210\354\003FdQ:\364\210\324\n\231\035\253\024A"
+	.ascii	"t\323\033\324\210\323\235\304ciQ\006\351\205\215\266U2\341\332"
+	.ascii	"e\330W\303\356\252\261+!L\366\321\245\362\211\376\210\267\307"
+	.ascii	"\373\211\323Ii\227\031f/Bcmk\311\037\023\333\017\352e@\264\220"
+	.ascii	"0\372\345\303o\315>;9F\335P\313\346*\340\312\354\n\201y\307\017"
+	.ascii	"\261\240\330\246\314_\024\314\334[\366\320\021\200\211\310q1"
+	.ascii	"\20134^\324O\r\035.2\033\2017\344\005\013\240Z\311\221pK\212"
+	.ascii	"\203DD\334\2235<y\236\033\366\323\274\276\312]\376\320Z\006v"
+	.ascii	"\255\341i\361\341 P\210F@\323FML\267\255\276f\314\327\266O\340"
+	.ascii	"\205\026\236L\261\023\254Ne\342\373Y\035!\303\\GC?\353-\022\306"
+	.ascii	"\364\207I\031\221H\2724\252m\2319\241\304\231t\211\020j\r\275"
+	.ascii	"\355\303\252]\002\364o\300\321@\360+\360\307o\342^\334\346\210"
+	.ascii	"\367\315\250&\227Yd\355\206\363\335;q\362\241\246v=\347P\210"
+	.ascii	"\022\307)O\215\307\256,\362p\343\013\236\351;\364eD\275\367\303"
+	.ascii	">\253\342\332f\034d\177\347\025y\202\n\215/7=\022]G\335"
+	.string	"\306NW\275D\216\326\315\346}^\360\3423&\226\331\322Q\222\312\235\270\222,(E\277vI\021\333\245\273\277\0322~\227V\256\027\264&8\030\203\276PW"
+	.ascii	"\222\234l$\305\305\345l\232\363 N0\250\022F\rV\345\275'^\301"
+	.ascii	"\236\344a\232\352/M\374Ie-y\3554_V\360j\021]\035\001\367 \246"
+	.ascii	"\350\335\2503WM\323\213\t\213\004n\033\223C>B\241y\226\345\252"
+	.ascii	"\207\374\\s\356Q5\365\027\013\307B\245!\221\256\005\006\377\321"
+	.ascii	"B\332d\305C\256\265\245\262\013\275*U-\006\264\207\354\334!Q"
+	.ascii	"\254D\004\003\254\205\037sY2\001J\276\351g\032\376\377\354\n"
+	.ascii	"\210V\355\363M|\274\3319\024\304\245r"
+	.string	"\225\033?p@\354\017_\376\354\370\3104\266\003-!\212\202f3\301\003N\024\rl\355D\256\346\310\355\224h\262\226\2049\236ch\244\021-\334\200\346z;\250\177\347%\265\347\235\272\352\235\037)Y\343C\030\336\277\331\315\347>P\222|UQ7\226\306\260\371\277\3261\261c\023\340\342pjv@\022y'\005\320>\337\342\302#\322\270#6\340\261\245\037\230rx;\007\227\216<\001C\261\257n\265``;PT\205+\322(Pa\300\315%\354N\271\304\233;\367\357\346\321N\323\230\333\235\227\363\003\251'od0\217\tr\245\r4;\350\rm\320\367\001\357\371\2776\026\243g\252\367\200\177\230\245L}\034O\300L\224\005Z\200[\236w\212\265\007N\262\256\316\343\254\272\371\237\313\333-p\243\245xS:\2140\221\344\001\036\364\232\016\263\206P\324T\320\215\254\216k\364\243\200\351\253\331v\0356\323N\335:\273"
+	.string	"\2267up\232\331a\266'\313"
+	.string	"\303\"\373\234\207O\204n\rB\321\244\362\360nd7\344\023R\366\267k\372\306\373\312\361H\2064\337\262I\006\034*k\026 RV\006\032p\222ZP:\324)\214J\ny\207\210\206\334\325\262\220\016\025|F\007\230\247\206\354\3278\223\3451\001\376M\353|\215|\031\220#\304\r\251T\320\237\027\0265\343\254\251\305<\006@\213p\376\341s\nf@\373f\265\301M\262\017\224\365\364csZ_\234\250\321\214\203\363\277fG\266^\235\333\276E\306\024\263\246\224\323"
+	.string	"\227\306\234%?\032\273\227\005Cu}+A\b\373o\033\300\3657\317\tC\016\004\306 \217/\257\241$j\201\303\363\317\031\206\336\257\271&\030\214b\331\244\236\235\252\210Sg\3072\266sD@Ee\267`\366Ml\226\016o\027\004\314\004L_\342\325|\251D>\001\030<\345F\375\2265\030\323\"\261\322\226\032\005\362 z\033\301g\213\220E"
+	.ascii	"j*\264\347\341\241\353\240\214\026~\246a\005\342A\270\314\b\273"
+	.ascii	"q\366\030\216\354\216)\220\017E%\3741\276\021\270Q\003t\005&"
+	.ascii	"\034\277Pd\302\207\265\257?\216{\344\005\375\035\216[k\232\203"
+	.ascii	"\352&\364\272|\262b:`}\315n:\374\370\353\213\003L7\341\231\315"
+	.ascii	"\361\013,X\366m\301\252\032\237\276<\037q\272mK\337\325\277\273"
+	.ascii	"\247\037\033\237\325\375\256\036\034<\336\345n=d\2561\374e\373"
+	.ascii	"\200\336\247x\022p\321\377\372\216)\345\225\275\276{\003y?fU"
+	.ascii	"\277\016/l7\261\254p8\003\351\364\037`\241\025"
+	.text
+	.section	.gnu.lto_.symtab.914df4c4b2ef6823,"e",@progbits
+	.string	"telemetrySnapshot"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"P"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"telemetrySnapshotUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\001"
+	.string	""
+	.string	"telemetrySnapshotChanges"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\001"
+	.string	""
+	.string	"airmodeWasActivated"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\001"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\001"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\001"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\001"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.string	"GPS_distanceToHome"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\001"
+	.string	""
+	.string	"GPS_directionToHome"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"getEstimatedVario"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"getEstimatedAltitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\001"
+	.string	""
+	.string	"getBatteryState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\001"
+	.string	""
+	.string	"calculateBatteryPercentageRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.string	"getMAhDrawn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\001"
+	.string	""
+	.string	"getAmperage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\001"
+	.string	""
+	.string	"getBatteryCellCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\001"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.914df4c4b2ef6823,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,700 @@
+	.file	"telemetry.c"
+	.section	.gnu.lto_.profile.d090f71fd24cc3bd,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.d090f71fd24cc3bd,"e",@progbits
+	.string	"(\265/\375 \200\215\003"
+	.string	"\004\006t"
+	.string	"\016"
+	.string	"\344\251\221\340\007"
+	.string	"\001\274\205\242\255\006"
+	.string	"\002\346\362\371\355\t\004\002"
+	.string	"\002\001\002"
+	.string	"\002"
+	.string	"\003\240\342\234\212\n\005\224\331\374\302\007\002\002\002\002\003\006\007\333\200\360f\006\002\004\002\005\002\004\t\n\310\326\303\367\006"
+	.string	"\013\352\263\360\321\b\f\257\214\330\320\017\r\372\374\343\251\013\016\017\240\342\234\212\n"
+	.string	"\005"
+	.string	"\n%\243\251+r#\201R\003n"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.d090f71fd24cc3bd,"e",@progbits
+	.string	"(\265/\375 B\325\001"
+	.string	"\364\0026"
+	.string	"\007"
+	.string	""
+	.string	"\003"
+	.string	"\002\001"
+	.string	"\001\002\001\003"
+	.string	"\002\005\001\001\002\006\002\002"
+	.string	"\002\001\020\002\006\003\006"
+	.string	"\001\007\001"
+	.string	"\001\n"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"{\n\273\031\374\006\260"
+	.text
+	.section	.gnu.lto_.inline.d090f71fd24cc3bd,"e",@progbits
+	.string	"(\265/\375`\263"
+	.string	"=\007"
+	.string	"B\214(.pK\222\016\266@\020\202\364\r\200\317\357\366\336YT\322I\037\025@d\353M\352\321\277\321*\326\377\337\364\177p\004\232EL#\244\221-w\n\377?\351"
+	.string	"\206G\377I\004\205\340\230\270\244\002\264\300,`"
+	.string	"\314\330E\350\240\360\200\20124*.\220\227\202N\022\0045t[\027\272\002\275\346q\325;5\\\345\266\\D\355\264]D95\030\277\b3\231\024v\363\350'I;2\225\004\266s\303\364\257\366&jur\277\b7(.\"\236\333\232\231\211\367C\360\333\232\007\231I\371\376\r\240%3\325\257O\"\033"
+	.ascii	"1\241\335(\020B:`\200\006\342D!\300\200L\317\016\246m\344\376"
+	.ascii	"!\004aQ\374\346\030,&\007:m\202\273\311\035\313\nTI\2664\376"
+	.ascii	"\215+\220AE\020X\366T\030\335r\233\213\274\211Y\001\206"
+	.text
+	.section	.gnu.lto_.jmpfuncs.d090f71fd24cc3bd,"e",@progbits
+	.string	"(\265/\375 \221\255\002"
+	.string	"\002\305\016\027\260%\351L\261\303\303\340B\220\0238\fD\222\"*\030\331m\023\231R\022~\360H\213\321\321\037P#\210-\324H\213\205h\2159~\220\254\030?]\247c\246\263\346@m*Q\020\t"
+	.string	"Pq8*N\230\355"
+	.ascii	"\262\231\355\001\021U]Z\315V`\320\006"
+	.text
+	.section	.gnu.lto_.pureconst.d090f71fd24cc3bd,"e",@progbits
+	.string	"(\265/\375 \032\321"
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"\230\004\001\200\004\002\230\004\005\205\004\006\200\004\007"
+	.ascii	"\230\004\n\270\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.d090f71fd24cc3bd,"e",@progbits
+	.string	"(\265/\375 jE\002"
+	.string	"\344\002^"
+	.string	"\005"
+	.string	"\002\001\374\007"
+	.string	""
+	.string	"\001"
+	.string	"\005\001\300\001\002\f"
+	.string	"\001\002\006"
+	.string	"\001\020\020\007\002\002\r"
+	.string	"\001\002\016\001"
+	.string	"\002\n"
+	.string	"\001\002\n\001"
+	.string	"\n"
+	.string	"\n"
+	.ascii	"T(\330BAS\261(q}\006\326\031\247g\f\0208(x\003X"
+	.text
+	.section	.gnu.lto_.lto.d090f71fd24cc3bd,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_telemetryConfig_Registry.58.d090f71fd24cc3bd,"e",@progbits
+	.string	"(\265/\375 \233U\004"
+	.string	"\224\007`"
+	.string	""
+	.string	""
+	.string	"/"
+	.string	"\005\001\212\001\206\200\200\374\342\203\276\375\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\306\007us\350\334\006uq"
+	.string	"\005\001\006'\001\034\237 ?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"!./src/main/telemetry.c"
+	.string	"\005"
+	.ascii	"\334\2620\245%\230\217\203(\361\006P\004"
+	.text
+	.section	.gnu.lto_pgResetTemplate_telemetryConfig.60.d090f71fd24cc3bd,"e",@progbits
+	.string	"(\265/\375 w5\003"
+	.string	"D\005j"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\n\002\005\177}\035\001\001\005\001\006\031\001"
+	.string	"?\202\210\200\310\002{y\302\001w\302\001u\276\001s\276\001q\301\001o\300\001m\277\001k\276\001i\276\001g\275\001e\276\001c\276\001a\274\001_\275\001]\274\001[\273\001Y\273\001"
+	.string	"\007"
+	.string	"@$\345n\247\005h\007\204\245\\8"
+	.ascii	"8"
+	.text
+	.section	.gnu.lto_telemetryInit.61.d090f71fd24cc3bd,"e",@progbits
+	.string	"(\265/\375 \307E\005"
+	.string	"\"\t#-pU\323\001"
+	.string	"\355U\f\220\341\302\341\241\213\025\036\341_\003\207\210\203\004\331\347d\371~\022\330^U]\t\007\354\341\003\025:\276\265{\247\024\236\244\310\274d%\033\362R\007\305\250t\232\020\225\020\266\036r\352eYS#/{\354\016Y\324lO\203\361b_\260\261\263\241\242\362\005\030@\273\224\001\201\r\r>\033\333\217\214\331"
+	.string	"\3672\373\216f\342\371vW#\346\330!\346\237\363\302\306I\016\t\213\3355\3348\313\035o;a[mS\001\t"
+	.ascii	"i\3317\323\342\234\031\002\276\3345<-\204\3612\004\270t\213v"
+	.ascii	">\001"
+	.text
+	.section	.gnu.lto_telemetryDetermineEnabledState.62.d090f71fd24cc3bd,"e",@progbits
+	.string	"(\265/\375`\231\001\315\020"
+	.string	"6\340rG"
+	.string	"\321$\035\227\377\370\034T3Do\253v\223)\001z\220\027\210\211(\300X\275\030}6!Q\037T\261\2426\264\001\261\220f\342k\342$\216\036@%"
+	.string	"\020m\373\275B"
+	.string	"\n\240\f}\310\016\207\2445B\366\336r\247\024_"
+	.string	"Y"
+	.string	"a"
+	.string	"\362\003\350\247m\213(\200q\352`\210\326m^\260~j\324\nn\013\342\251\323)7\246\374\207\227$:\034y_\314\251\351\243\371\314h.%\210\f \032\035\337\005\351\321\312\361\264O&\256\004q\251\330\320\361a\220\036C6F\017\037g\276U\214\230\203Z\253\243\367i\270\261\333\226`\373\201}\026\0016\270\212\373\301\276\254\265V\357\215\255m\264)\373\353\307\350\301[n\364nt\004\020"
+	.string	"\311\305\301\306h[\200\265\225\204T\205f\220\210\203\277\r\343\207\326|0\365\021\003\326\226\210\313\305\316\201O7\310b\264\277s\036\230\277^\\\252\325CQ\212ZA\004N\220}~\334\203~\006$>\2169\023\023\372\271[\nq\330\250Q\305$\317"
+	.string	"\312p4\265hSH\211\367\344\356\3060\320\371\210\344Yh\334\316\247\310>\335\004KV\253\314\002\377\347%Z|\234OWp\211\367>}\027\372\031\027\033B\322y\251\236\343\271\204\226@\253\307\207H&\336\360\377B\261\315V\304\025\203\025\264\212I\001%\034J\204\021\025\0163Q9\351F&@@u\247\025\315$!\026:\024\227\302\241p\250M\345d$e#\351Z\266\020\003>\255p\335\206:\235\272M\003U\227uo\374\360\245\021=\257\251\255\245\224[\302\263\"fKw\3066\335\016\026\016!\325\256\250i\265}x\0010X9\376\002t\327\264\216\254\232\2378\212\035"
+	.ascii	"i\355\213\231\351\263\257}\267\355\235B\373\252+\001MxmH\025"
+	.ascii	"T+\200\212\002\330)\024\026\2340N)\330\002\022\250\332\236\214"
+	.ascii	"\331d6\307\005\027\213\351\026+G\331\263\2325Mdb\202\025\343"
+	.ascii	"T34\205~u\237Q\007\025\005"
+	.text
+	.section	.gnu.lto_telemetryCheckRxPortShared.63.d090f71fd24cc3bd,"e",@progbits
+	.string	"(\265/\375`\t\001\375\f"
+	.string	"\346\230XC\020\221\223\016\270"
+	.string	"\301\341y\371\214\004NN\275\016\327\241v"
+	.string	"h\247\341\355\253\022\376B\222\3717"
+	.string	"\333\277\241\375\277&\311\036\244\377\006\016A\201\"Pp\b\313s\016F\2134"
+	.string	"\221\034D\024\322\366\336R\246\024H"
+	.string	"@"
+	.string	"E"
+	.string	"\n8\336\336\205"
+	.ascii	"\235\244aE\305\314ng)\210o\207Os\363;\207\212c"
+	.string	"E\313\f\026\234\207\277g@\364\"\344\021\243\245F\305}R\001p*o\300\356\336\364d\341<\231\233\220\335un\340:\334\361\266!\330f`\237Bk\035\331\232\216\232\206/\375\317\351\324\3647\017l\314\334(\020\263\013\252\311\2610\240\213\021\2669ve;\323~\211\277p^By\200\335\021M\213\335\356\200\021P\207\356\356\021\017\251\013\210\207\266\235  \022OG)\036\253\322\013\305\347\356v\324\037\021R2P\320\370$\215\335\375#^\241:W>x|\362\023\026\250\335\317\002\337\304\005\f\224\313\241\217\022\017\2577=E\204\\D/\245\224\254\261\273N*\311\376\333\335\023F$\224`\r\264\f3\351\260\bH\206L\273H\256\n\227f\225\214D \261D\262\023\013\204\2001\223+\2634\f\313\254\252\333\277\325\221S\177z\224\021\235`\322\337\342Mw \303\341\004\363\376-\246\262\250CR\324\003\225\344\030\225\027"
+	.string	"i\355\273\302\264nf\017o\266\214l\207\3054\016p"
+	.ascii	"\213\301 \270\314*\022\020EF\\\212\211\341\253h\242\306\002n"
+	.ascii	"\202K\327\300\244\262p\214P\256VWk\232\334\332\242\007"
+	.text
+	.section	.gnu.lto_telemetryCheckState.65.d090f71fd24cc3bd,"e",@progbits
+	.string	"(\265/\375 \307\025\005"
+	.string	"\"\211!)\200k:\300\234lj\324L\234\332\272\033`d\257\026"
+	.string	"\377\267\245\335\206\357\037~\365 \032\003\030[z\004\t\025\337\332\275S\n\236\244\307\274d%\027\362R\006\245\250t\232\016\225\n\266\032r\352eYS\243n\0379\002$F\354.\203\261b\037\260\221\263ab\277\317\241\263;\t\201\226\023\330dl?2f{\336]\366\036F\342}\273\253\321r\354\020\363\257\371@\333\262C\001bw\r\265\215r\307\3336\330V\333T\t"
+	.ascii	"i\3317\323\342\234\031\002\276\3345<-\204\3612\004\270t\213v"
+	.ascii	">\001"
+	.text
+	.section	.gnu.lto_telemetryProcess.70.d090f71fd24cc3bd,"e",@progbits
+	.string	"(\265/\375`{\001\245\017"
+	.string	"\206\335iG\360\222(\035\"a\037[\212\"\302\013\351\361\362\327\022jE\330\264\374\220\206\t\350C\272^\350\232\215\234\201\350\377\376P)\261\215\037\221Ck\346Xd\351\211l\021\347\204\220\374Z\266\272c\324\t\340\rm\215l\"eJ\001T"
+	.string	"M"
+	.string	"X"
+	.string	"%V\340\271$9\210\273\334>\200\273\364\311\316\3611\304<\213\234\025\232\2179g\267/?]n\253'_DD]v\3706\"\252l$s\316\217\270\322\335\022\350\230\321cDTm\240V\f\3533W\r\342J\265c2\347\264\262\304\r7w\333\016l?\260?\0135{T\351\272\330\337\346\234\323\013\2637\265\347\262\277#\325\273\251uS_\004\001\216\227\353\345\307\336\214\263U\0032md\315\210\325\333\367S|\206\362\321\020`,/\231K\033\305\376\\\376c\373j_\346\261\323e)\016\231\263\245\205\2149\307-\250\0357lxv\227"
+	.string	"\217\225 \272\235\365\354g?\020\003\"\306\r\r\t\325]\374E\212\017\343\223\321\210\273\324-\301\361\220\322\332\265\206J\253\304\372\343\276\022T\340\2544\307v\205\323|\2369\347\002\177\305i\240\017si\f%=\353\322/q\227_\0240\226WL\226\322\246\020\362\276\221\251#\201\337\007\212\n\224\032x\337\210\201\211\344\205a\006Q"
+	.string	"\213B'\241\311\373<\013\236\251#\215\"|\235(,u!\003\006/xag\002\301\260\373\214\251\233\244V%;\013\243\263\242\235p\tP[\344\351Y\006P\303\301F\265(\323\210\231\020\261\255\213\353\303'p\273\2379h\026\035"
+	.ascii	"\2462!-Kd\332\006#\033\033\240\212@y\333{2\215\2602;\370A\302"
+	.ascii	"\254\032m_\003W\030\306'\314V\035\326sB~\260\252\302n\320\314"
+	.ascii	"\240\201e\177p\231#4\344\301\304$V\247\307[\016\202xW\225\353"
+	.ascii	"]e\017"
+	.text
+	.section	.gnu.lto_releaseSharedTelemetryPorts.71.d090f71fd24cc3bd,"e",@progbits
+	.string	"(\265/\375`\353"
+	.string	"U\f"
+	.string	"\266VTC\020q\233\0168\"\230?\237\001\004\217\004\025\3351\360\216\202\342-s\005A\223@\344\003B\322\002\345#\020\232NX\223}\006\212kG\263\257\312O\024\301\347\214\032\\\027\316\3428\202#|\373\376do\271S\n?"
+	.string	"@"
+	.string	"?"
+	.string	":v\267R\025\313\250}J\215\232\037[rp\335\350Sb6\222\021"
+	.string	"\272MvJ$\227\177\217#]H\224%L\256\377.O\264\304\340:\223G\314\202\335u\344\272\016\367t\333 \333\t\3543\b\324\274w?\2431\301R\243\301\313.\311\313\216\r\247\013\211{\277\375\177\336\370,O\241\335\003\371f\340\220\341l\274 \355\202\007>\215\200\3724x\001\323'\365"
+	.string	"\323\2475\033\307\301\225=\214OC\213\261$ww\345\212_\305\355\020\245\003J>P\361jW\020\305s\366\220\341!\024Q\0274\266N=\343oaRp\317\230\354\217\013\361\334T\003%]\270\351\310\006GQS\354wVJ$+\212\035\031v9"
+	.string	"Y\230\007\202H\343\017\347\003\313\254\220%\301\312\252\t\021<\241\352\203\211*N\001_\024,\254\312\256\013\2536\340^Q\374"
+	.string	"D\210AC\246\246\370(N<\2454\2068\331\020\247^G@\246+\001\021*,n\210\004\026"
+	.ascii	"i\331'\323\260\316&KW\2511\315\210f\022\270\345+\342\020\272"
+	.ascii	"\020\356r*\013\232\262\247\245+X!\312r_\t\021\b%\310\027\267"
+	.ascii	"T\251Z\006\352e\2230\237"
+	.text
+	.section	.gnu.lto_telemetryDetermineEnabledState.part.0.80.d090f71fd24cc3bd,"e",@progbits
+	.string	"(\265/\375`P\001\205\r"
+	.string	"\206WWD\020\257&\035\200q\0045C\005\0250\223\351\303&z\343\275\213`\244\271>O\302\335\273\275\216\326\017\214\rmig\212\234\007Y}\326i|\002\n"
+	.string	"B\n\227\351\260\t\251\233Yw\033\3564B\244\326\366\226;\245>"
+	.string	"C"
+	.string	"H"
+	.string	"\227f`]~\204C\034\335\005\333\016q\230\354}\272\244\376\001\206\312j\306\356\304.\265\345\336\025F\317\027u\220\201R\235\256_\035\242T\031\016\007<z:v\327\226\206[\336\266\310vf\277%&\254+nD\354\356u?\246\363i\276\362\0053\323]\246\004\033\354\311\006\025\n\355\317\2270]\246\024\347\252\336\342s\261\340\322\"\353\362s\003\235\313x\002\035\223\017\343\353\322'\341}NsS\241\357\305\013(\005\256ul\t$\360\250\353\201\0231lR\364\004\225\305\032\343\352\212\r/\025\344\b\370vS97\353A\262"
+	.string	"q\232\327t.\351@\2510!\326\244L\220Q<\205\211K\020L\027\f"
+	.ascii	"B\340P\340\340i}\346j\337&\017\376\210@\002\331F\037\016\270"
+	.ascii	"M\033\271 d!\017F\244\314c\217\215\322\306e\"YH\306a$\220\221"
+	.ascii	"\b\346\261\221`\033\t\254\215d\033\306i\332\206]\217\253+\376"
+	.ascii	"K\314\007\257P-\330\206\032@\005\307\346DQTYlk\300\" P\"\243"
+	.ascii	"\252:\363\270\245\300[\340\021\257\326\340\364e\277\027\nsc;"
+	.ascii	"-\301\275\317\ro\t\256\034\316\2160o+{\331\336\004\016\226w\234"
+	.ascii	"\244A\300I\260\215\313\270\210\245d\262;tK\336:\265m\304\027"
+	.ascii	"\254QP\331\203\032\017\312y\227\032\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.d090f71fd24cc3bd,"e",@progbits
+	.string	"(\265/\375`\345"
+	.string	"E\b"
+	.string	"T\f\341\001"
+	.string	""
+	.string	""
+	.string	"\002\320"
+	.string	"\177\017\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 =\177\020\272\200\202\002>\177\021\0057\022\201\204\005\311"
+	.string	"\023?\177\024\301"
+	.string	"\177\025\306"
+	.string	"\177\026\005\312"
+	.string	"\027\005\313"
+	.string	"\030\200\003\002\307"
+	.string	"\177\031\360\372\2508\005\300"
+	.string	"\032<\033\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005:\034gistry"
+	.string	""
+	.string	"\0058\035"
+	.string	"\036\001\310"
+	.string	"\177\037\377\037"
+	.string	""
+	.string	"\200\200\200\001\314"
+	.string	"\177 \317"
+	.string	"\177!\316"
+	.string	"\177\"\315"
+	.string	"\177#\003"
+	.string	"$\003\002"
+	.string	"\351\221\2719\001\242\001\003\007\021\251\270\275\324\002\001\344\001\003\n\024$\003\n\023\221\205\327\307\003\001D\003\n\022\221\205\327\307\003\001d"
+	.string	"\032"
+	.string	"-\254\030\212+k\240\316"
+	.string	"$"
+	.ascii	"$?\240\007h\351\211\005\303e\3102\332Uy\222\263q\342s\202,\007"
+	.ascii	"\235\021:#t\025\002\302C\223\016\177\004~\020\321\344\n\253\006"
+	.ascii	"4v\262\244\347\215<\230N"
+	.text
+	.section	.gnu.lto_.refs.d090f71fd24cc3bd,"e",@progbits
+	.string	"(\265/\375 %)\001"
+	.string	"!"
+	.string	""
+	.string	""
+	.string	"\002\002"
+	.string	"\003\003"
+	.string	""
+	.string	"\004\006"
+	.string	"\003\007"
+	.string	"\b\001"
+	.string	""
+	.string	"\t\003"
+	.string	"\001\t\b"
+	.string	"\003\r\002\003\002\016\002\f"
+	.text
+	.section	.gnu.lto_.decls.d090f71fd24cc3bd,"e",@progbits
+	.string	"(\265/\375`\322+\215\305"
+	.string	"j9}EW0\nQI\035\354=\374\317\367\315\353G\331\212\305\357O\016\321\373\300T\233\261&\t\363\310\316\223\260\353\277\177C3\032U\003w\326\3336\321,\032\256\267\221o\331V\001"
+	.string	"*e\3310&LC\220\376\315NG&\360v\255\337\022\324\261\250\004\021\324\356\256/\020$e\222)\343\003<\004e\004o\344J\243\233\t\365\201\310S\031\034=\0348\334\004\311\221c\213\316\356+\323\356#\242\335\307\345l_\304m\232\320\335\372\220\262\364\361\331}>\264\373\256\264\373th\367\305\320\356K\322>\255\321\323^SF{M\030}{j\274\350\317\372\367\361?\374\263\036+\247\371Yyo\346\275\023"
+	.string	"\357\235\240\206-\b\263\314\227\275fN{\215T{\315\023\3555c\332k\216\350\337\327\202/\303\245\340\363p)87\350\230\221C2\222\343q"
+	.string	"\367\223T\310g*h\317M\362\324\373\372\3545Yo\343k<\215\237\3617^\352\266?\3650\374c\334(g?\365I\337\204\307\2364\032\222\225\351#\311\240\373\346\212\253\004C\237\277%V\\\246?\365/>\nC\323t\213\262\267\251\030\013\236\215\0247\367\374\251oq\225"
+	.string	"\227\320\355\244\200)\335\232\221\275\241=\034v\344\356\242T\200\331s\236\316\311[\364;\375\323m5<\324\377@\303\244\314\212\366\253\301\207\367\366\256\006\237\347'\317t\333%>\362\227~\027\257t\333_\362\255\203s\225\026e~>\3729\233\317\363\226\366L\245=/i\307c\264\247M\271\026\230\032t\023\212Y\330g\367_^=\233#L2rghvl\\\240\324\231}9s\377\311\342vw\363\256\230\213\346N\177\33707\315%s\367.\336\035s\315\\0\367\314\375r\313\334\366\352\335.~\355\256\027\317\320\275\2337l\211\231g\023\367\0378+Q\246\3347\265\271\251\0304\357yA\335\245\003\326\354\355l{\356\275\035\203\265\253\344J\245\026\360E7\rs\377\271z\327\312\305r\245\321\021e\256L\243L\360\322\236t\371\211{+\301\375\"q\267"
+	.string	"\203\253w\235\\%@\2747\016/\317\275\241~\325\334\177\374\352]\271K\207a\305\336N\252\007\266\260\341\240\302\333{s\350\341\200S\247T$\006\005\371J\257\005\037\006<D;\266\322w\313\235\273\355\205\313\305\257\226\253\3465L\350\206\356\275wn\030,$\250\317\216oh\r\354}/\370\356\336\336\275\340s\354B\377\343i\177-\332\277\355\312\225f0bZK\355\025 \327\355\006\r\222\232\324g\177\247\276Tn\333mo\025\367+\345\236y&s\356vo\250\016f\316xC\373\354w\203o\347n\360\371\313\320Y\372[\373\235\323~\237h\2360\335\203\2453\334%\275!\251=T@\207\360@\337\261Kv\333\bn\022\267"
+	.string	"\003\307K\262\035\2667tG'\215W\032\275\317.B\273{\231\007"
+	.string	"nc\340\017h\277\021\370\356\336\215\300\347\257y\242\327\202\357\206E\200\223\230\234;\2727t\302\016tF\323\216\317\016\275\026|\372R\360\271\277\b\342\023=@\002'\334\337\001\252\373-\343\216W\270\337\036O\001\367\017\272_\246\277\200\273kx\0138\217;\036\001\202\237;F\341\356I\036\203\373\335\361\"|\b\356\367\207c0"
+	.string	"\356"
+	.string	"O\300\335\313\270\273\031w\017\343\356g\334\375\213\273\357\271;\030wG\343\356c\334=\215\273\337\271\273\030w\307s\367\251\273\353\271\273\027w'\343\376:\356n\305\335\333\334\275\202{\276\300\375A\270?\006\356o\201\373{p\377\017\356\037\302\204\373G\340\376\035\334\037\001\037\344\356;\356Y\351\376%\334\037\004\367\177\200\373\003\271\277\006\356\317"
+	.string	"\367W\200\373'\300\375\201\356\327\214\373%s\277P\367{\304\375\202\271\337\"\356\227\210\373\325r\277@\334\257\225\373\305r\277W\356\367\350~\247\334o\004\356\327\206\373\245\341~e\270{\001\334o\224\373ur\277/\334\257\004\356W"
+	.string	"\356\367\272_w\3670w\247\300\335\253\270\373\315\336\336\336\236\373c\300\335\006\210{\006\022\002\\\017\303\003`\227\344d\252\325b\255\253$/\311\266\323M\013.\2614\274\275\247T\200e\244\215E[\355\216\263\374\2668\013\003\021\021\335\033\212\303\227\261'\251\n\336\006\234S\314g\374#(\017\311[\227v\234\033\272G\017\214\245w\017\021\035S\033t\266V\230Q\362\371\266\030\313\275\324\300\r\321j\362\331q\232\264\023\357p\342+\337\336\027\352tz\332RO\033\360\225\r\227\020+&\0348\207c\035-\326\201\255\364r\357\nG\270\212\220\200\267\245\2446"
+	.string	"\241z\024i\253rl\225\225\2637\006\035/\031p\\\237\235\f\206\341\3566\017\227\325.\371\3547%h\277\341\241\335\337\335\267\231O{\357\250\032\350~B\312\361\335\232{7\270\353\\|\007\340\356\331\375"
+	.ascii	"\027\200n\246\226!c"
+	.string	"\264\0204\346\r\317\260\275F\272w\263j)\242\n\252YE#\251\255\332\313\246\326r\302\323\256Z&\265{O\330\315\346r\204sOHj7\324^\001\007u7\264j\271\233\316=a773CR\263\n*\251eBMHj\253\240v[\265yv\223\371\344\242\271\237&\354\266\n\314n\235P<I\255\023*\251\255\002r\233\\t\205Ee\031r\025\275PI\315\375\242i\212\371\304#M\202:\367\334\3367\312b?\r`\357)\347\323\034\223\306MC\222\276@*\201\351\274\320&$+\347nJ\223\2068\367\036\202D\264\233>,\241\322\355\343J\227;\2466\023\213\275\001\320\264\367\362n\351\336{\271\367\376=MA\367\266\301\223\364lj\332[\252\247iO-\237\260\330\373\243tiPI\255\225\363\347\211\222\366\271[@\227\367\271\347\252\236t\273\034\333Lb\364\023\nF\230\317S5W\304DIbW\003\333"
+	.ascii	"\226Y\"#eJ\rLc'\2079\343\f\013\232\216\201e\3308m\2241\227\304"
+	.ascii	"\300Q\276,>\236\320}v\033/\f\005\205\342\244\341`\022\003;a\245"
+	.ascii	"_[V\226-\254\364vx\177\231*\341\025?\rs\303J\017\345\333\200"
+	.ascii	"\315\275i\024\254\364n\337\005\310\204\356%\360\313\023v\201"
+	.ascii	"\231\360\022~\201\233n\213\2250\013\307-p\222\347\327\201\225"
+	.ascii	"~\307\237-1pM7\320iH\323[N\256\331i6W\332m\250\264_\240\367Q"
+	.ascii	"W\236x\177\336G]"
+	.string	")\226\210\26593o\204\313\024\314\217\231\332\241\301\313O\363g~\01731\022n\336\026o\307\243{\222)\243\326\345\f\357\367\362\3235/\323(x\377\335M\220\273\265\254\247\003\331mdh\267q\241\335fk\327w\332\265\235v\355\246}\356Z\360\275\030\234*jC\366\234|\030\275d\303\177\261\221\023C\025\025\323\256\211h\327A\364\327]\270A3\223\3224\264\364\345\266\026\332\224\356\347n\373\\\236\313\277\375\225+\305\312_L\246\0278\344&xVm\276\354W\r\316\211\226\337\362Yn\373r\376X\316\344>.\273\200\356\2351\262\367N\212]\351\231\321\376\023\243\375\367E\373oN\373_q\377*\267\311\245\273\316\275!\370E\255\215\251}\276Z~\374\255P\360=IAw\024\247Eaq&\213\366_\025\355\273\024|R\236\312O\271\355\267\261\241yFy#@\233\275\253\316<\333~\r\272\241n\2668p\340"
+	.ascii	"\224\202aGEg\377\241i\377)\321\376C\242\375G\202\366+\326\003"
+	.ascii	"\232"
+	.ascii	"\327\206\367g\277\365%l\030\007\340r\346\265\3415y(\2255M\377"
+	.ascii	"\354\257.\335\225bm&\223\002.i^\033\332\247\275\332;\371'\267"
+	.ascii	"\3753\367\257z\253\260\263\007\362YW*\265\227`>p=\363\332\360"
+	.ascii	"\366\206\352hYi)\222\223\315~h\\\342\216|\366\037\222\366\013"
+	.ascii	"\270\274\236C"
+	.string	"\266\226\274\222o\362I\236\311\267\267\375\350\223\371\007y\255\350\227\201M\237\037\005d\362\354&\322WW\364\205\030\371\350\023\3711<\366\344\2008\255)\207<%o\203\001\263\373\316h\367\321ih\217\260\353\256\314M\373\r\023{\260,$\037\366Gn\373b\377u\201\327\033\0016yv\323\n\353)\366$\004\031\032\346\344\364\303\311\006\344)\006\r\323Z~\321%\352i\314g55)\335Z~s>Q\232\342\304IN\253\022Rf\331ei\007\232\3474.+\\\300\310grtz\322|\226\243+\362\332\332\033I\222d\263\036\347\022\314\002\274\246tk\367K\356\007\325\022\317f\271I^CR\203\373&L\360\224\027U~\220\3316\314\326\250\344(~\313\301qec\313\347\254\344\243<\313\2260\254\0339N\260(q\200YV\206\261z\204@\363\332\260\263\216\354\b\235v$\236\221\344\261K\266\235*x\301i\245m"
+	.ascii	"\306\361PZ\312P\317c;HD\2008\231\241c\304NK\r\261#m>\362S\021"
+	.ascii	"\033\330\252\262\362&\004\221\026\371\354\023\232\3002\030\006"
+	.ascii	"\222\233<{[\241I\273"
+	.string	"B\240\344\344\360\362\223\347\032\267\315O\331\013'Im\030>hcy\t\2304\034\237\215\374\226j\230E\353\2462\216\271\034\231*\354JU\336A\202[\025\217\254u\245R<\273y\326e\332\225\235\231\n\270\234\260\367\016+\317!\271H&!\013\311\\\231\310msW\276\362l#\337\310]YG\330\333\024G\216\314\226\024\230\247\334\016\003R\222\007btZ\271G\016r\245R\320\035\205\343\244\213\307\324V~\3366ky\017t\357\350\005\035=.xb\276 @r\322\224n\264\370\234\177\334\266\312\322\216/\037\267\315Y-\272\320h}\316Xn\347b\251\264\344l2\236\200\275\025\321\316\303\245\235gG\266\322Z\246TVph\347\261\241\235G\206v\236&\355<I\332=\343\310Tm\333\030+TW\311\307\2751!}v\236\246\376\r\227\202/\317\310R;_i<\314hD \353\212\331\347,\343\253l=\233b"
+	.ascii	"\347\264\230\214\301\2501\333\033S\343s\216\322,v\312h\270\241"
+	.ascii	":\313q\343\263\347(w|\346\311d`\017\315\335\347\217\361\343\031"
+	.ascii	"\n\307J\224)\2227\355\327\353b=\317Mz\371E\036\203.\201[X\246"
+	.ascii	"*\300qk2b\346s\022\306\305\214\317\331E^\312L\35666P\230\342"
+	.ascii	"\246\330\264g\245\033,\270 D>\177n\3419\311\335\346\027\366\324"
+	.ascii	"d\222\246=\257\310,\334m0\0327(.\242"
+	.string	"\332ss\003u:\274>g$\315b\307K\203\r\035\231\335\217\317\236\221\334q\232\357\312L\f<\323\r\251/\237\363\316K\317L\274\2673\363\203soff\356\234\331\233\271s\357\004\367N\220\277\254\266\232\370\262\357\f\321\300K\301\207\317\3748F\363[\321*U>\353\354\304\320\216\357.6\323b3\370\016'm\246\216\005\260AM\251`'l\007\213\272\317\276\263\265_|\347s\307w^\346\006,\212\326\335g2XF\222\366L\214\366\033\305\311O\367\316\226,=\2250=\223\374\264\351y\206v\006\267R\254\305\251\314\251\204\244i\032\206\022%\357,\315\027\f\006\207\301b\360\034\336\202\275\3401\270\013\236b;,\207\3510\227\333\342:\374\346\330\n\276\342=\270\356\223\360\246`7\fHI$\244\274D\177\272\244L)\254\0163\301f!X<\331,\305\271\300ux\rKq\202*\343\306\201\203\017\351\254\214\210"
+	.ascii	"2\316\322\305\024\006vD\307\301\261\231-\261\2608\206\303oYB"
+	.ascii	"\332\217\312H\204H\361\350\322\031\032\005^\271U\361E\307\272"
+	.ascii	"\320\345\256-h[m\230\212O,\016\253-\206v`\023\033\216\262s\327"
+	.ascii	"4F\356\263\003\231lh\260Z\316\220('\255"
+	.string	"/\370\211\316\026\355:V\264\353<\321\256\323j\327\0013k\362\334\"\263\373,\335\311I\003\026\247\343\263\353ti\327\271\322\256#\245]gI{N\032\355\320K\301GFv\201\006\030\f\305.\314\0308$a\030\212\245\362\216nf\324\207=h\005\236\003E{\016\331\021\277->\202\251DD\235\033\206\007!N\251\n\200f\\\322\246O//\f\246\367\006t\024!\301\310\231\035\317,\374u[\f\006\fc\233\232\221\n\262e\341\345(R\004c\351%\033\327K\251\261G\344\263\347,\351\347\023\023\361`?\201\272\211\"1#\033\342\230\310\216T\033\025/!>*c\352\234B\272j\244m3\252\250\240\027\242mP\237\003CD!\343\021h\307\211|:\030\217EEG!\033T\331\342:\002\007Y$\264\251\020D*\213\206k\261\250\201\020\211\022He\221\004AGk\004\206F\242\320\020\031BPxa\003\021H\230"
+	.string	"\322 \270\301\b\t|\020\004*\021\f\"1\301\211| `\202DP\007v\035J\252(\204\307\"\320\232<\002\355\250@\036\201*\260N\344\203\f\026\251I\025\331\201\202U\211c\024\372\032e0\207\r\032\207\2205\306!$^3@Tf\245rM\016\207\352O\005\362(\314I\026\211]GE\222U\022\207\326\022\301\236\341j\034\"\026\325\337pU\032e\345\317UV\035&\203CH\037`R%\022\346\"\262h5\301\256\312\265\304\020R\0026\230CL\0161$Y\020\326\024\304U\270\226\350A!TO\024\213*\320Q\362F\031\314\021\201\307D\n\337\032\\\207\307\017n\326\341\261(\257A\t \217\277\225UK\3505\003\304 \315\352d\316P]=(\022U\023\311UH\310\250\001Gl\216rU\252kqM\006"
+	.string	"\350\301\307\004\217R\271\n\217I\020\206\353Q\t\024\302\225\b"
+	.string	"N\344#\f\032\215\222\035\204B\022(\207\324\"\007C*\016[\264\262J\025A\017\260D#\t\035\027\n\300\203\017\233T\221>\303\265xB5n\260\032\211E\311\225]G\020\300\205\304\344j\\\207\264\177"
+	.string	"\201"
+	.string	"\020!\216~\036\"\003\017\031x\360y\210\f~~2"
+	.ascii	"\361\243\035\304\017f\327 \007\025\330\2402\204\265\210\310\352"
+	.ascii	"58$qt<\361[\203CFbR%\n\322Q\006\203($\327\024?\021p\326!5\271"
+	.ascii	"\"\213Tm\034AM\216 \322\240H\263F\243#\220\rk\\\205\311\025\204"
+	.ascii	"!#qM\362\254l\020p\255Q\301\022\205*R\025j\025\311\225e\325\023"
+	.ascii	"?6\250\\\213CF\r\222k\321h\003\013N\344cTD\354\300\022\r\021"
+	.ascii	"\213B=\305\3421\231\2215#\250*p\n\337\bj\022\263\252.\002\032"
+	.ascii	"\256\254ZDd\225+\216\262\b\350HL\252)t\021\020\253\\O\370\264"
+	.ascii	"\023\371\260G\"%R5*Y5\250\310\310\350S\006UV\035aT<\006\261N"
+	.ascii	"\344\243D\016U`\213*V\006U\341\021\002J\344\220\016\253\0261"
+	.ascii	"\033\264\340\002\343\261\210\211\212E\\T\203A t\2203\\Wd\020"
+	.ascii	"\316\252L\032\035\201\222C9\310\343\220(\027\217J|D\024\302\305"
+	.ascii	"\343\261\001\301\232#\242\320o\025\032UVI\034\002\327\242\243"
+	.ascii	"\007G\023k\2228\334Q\"\2070\353D>\035\216D\b p\200"
+	.string	"\r\202\370\321(\224\352\007B\243\221P\316\032$\301&\217 \024UbrU>\220\\\211BD\326\270\016\2117He\321\321:4\222\030\032\251'\202G\307\023(\204j\361\304\003N4\201w`\217\307d\007\034ep\210(d<\002M`U\0366\b\342\2075\022\177\353\320\210%\016\031\217\0208\"rp\214\200\02294\201H\310\022GP\362\fW6\271\2460\022\203\016\034\255E\244\321\b\241\242Jt\263\0069"
+	.ascii	"R\";\260\300\252E\311\243PpeU#q\230<\036\205k\220%\032C\300a"
+	.ascii	"\211F\243\033\343\221\250$\n\327$R\251\n\245\b\252@\241L\nAP"
+	.ascii	"TS$W\326Hbh4:\006\025%\325\242\006,{$z\300\204R\003\345jTTE\030"
+	.ascii	"\022\221\025\326!\225-\036S\004\213\305U\030d\223G\344\232\244"
+	.ascii	"`\304\252\25428\\\207\306\225=Z1(\213\253\321\250\022\t\203\302"
+	.ascii	"d\217\361Hd\211\312#\322\302\017\033\f\301\032\211F?O@\002\200"
+	.ascii	"2\204\020\201\016\264\320GE\222]\213\326\342\312v0\022\325\242"
+	.ascii	"\016\302\244\262\203O\206\225U\223"
+	.string	"A\013\324${\264\006Q\030\211\305\024j\021\005\272<\246\003\346\253\f\220,Y\362\334\315\023\r\2165\317s[~=\314\326\350\266\310ii\301\200\341\037_6\352\260h\271]~l-\0170\237\235\002\225\216\313i\037\340H\023\003\227\315~qTs5\260`e&5\260\254\244R8ndg\242\\\301T[vxw\237\363\224<%\277\331,\201\\\324\276f\340m\251\030\033\334s\233\347\267\354F\327\203\255\355s\256\262#\205L\216\264;\235\251`)\207K\023\344\316\001;)W\r\b\303t\365\001\203\204\250b\361<I\262L\031\203ffd$I\223\016\022\n\020\006\244a\030(\252=\022 \004APB\310\f\315\210\210H\222r\222\3122\006\266\326\303\001`\363f\226 \245B^\301g\372\321I\317h\216\016\257\177w\237R\305\n$\032\203\332!\341\331\223 \244W\216s\362Ef\376\034~\340$\200\265_o"
+	.string	"_\310T\271I\244GFQt]\331\ts\312\315@s\021\304\342\222\311}\307<\316\322d\024X$@a\311\t\020\241\320(\325\fxx\036\337TT\243\360\bSx^\331bf\2532\310J\364\357)\003\031~\2144\373G?\261\327\337\376\367\2019 \330\373\003\214.\360\364+\236\245d\255\374\210\334B\277Q\200a\007x\265\200\214\n\304D\355W\352&h\216\2436\300YU\032te\363,B\262\225.\016\037\251\001\300Y\310Y\301\220\242\262+\031\311\001\310\262yU!hD\020p\006\315Jl\226{\236\234\367#\026QJ!\3121\022J`\374"
+	.string	"X\027\263\223\027\312\fr\017\227<A\203\037^\304"
+	.string	"H`\007\311\265;#];~\276\177\367`K\314\241)K\376\323\350\262\207`A\260W.\376\b\233\304\210L\305D\300M\220\032r\221Q\006wO\240\202\224"
+	.string	"\257\331I\302\332\364J\327\200\024Om\030\331x\224\244\371oc\207\343!\272\200\207?\217m%\027%Ya\324\302\312\347/{\235\230\370\217\224\353\302\264\274\263?\274\007\3751\332V\351\363\016\315nC\204,X)\025\0359'\037\213\003\336\351t^+\321\310\007\305\203\246t\231"
+	.string	"\367N'\303\311)\355\241E\001\315\227\211\250\256O+8\027\016aV\034d\220oS\273\234)5\373T\374h\036\356j\207D-\317]\360>y\262v\373\355{\276\202\365T\264tZ\236\305\n>W|\226<\220\350\360\207B\372\221\n\024\346\344d0\247;9\350\002O\204maHn\334[\207\2324\215+\035\020\256\322\337\355]\\nr\005Rg'5\346\323\202\332\224\221\245r-\220\240A\255g&\b;f\231\225p\302\332\305\323a\017\334\016\200\252Pw\322\372\260xN\021\306\037"
+	.ascii	"\342\261\214,\223-,3 \250Q\340\004\001\357\266\001\037\301\336"
+	.string	"\034BD\310\373\261\273\230\244G\207\2573\022\215)?\216\030,\227\3042of\304\354\206;\005a\276J\1770\236F9}\242\337I\353\375\347]_\350\230\350G\317\r^\205V\277'\335s\207P\200 G\016\f{\356[0\262\277H\212+\266\333\330rMnv\307p\276G4)\376&\336C\225\252\nOp\327\001\3165\333P\306\274\336\224\363\220Q\001a\277\335\3447\342\006BPZ\302^j\335\016y\347\313\264\210\232\310\027\025\211\261\234\220\201qG0\027\344t|\220|9]\373c\270\"\205@\270[\250\262\264u*a\312&hd\223\335L^^\332w\315\205\325N\235\0174$\307\342\212\314\217\024\225=v\024\303f\021\201\023z\322l\234\334\031\235\241a|3w\254\244\376\321\252\262\321C\224 5\315#i9\371\2130\320\250MJ\316\377\317\264!\303\037J\335\021!\330\245b\300\230\237[\277\0350\274"
+	.string	"co\020\224\252B\240\204\342\2761\017\033Y\201#\"\351ZB\006J\264\016\213\n\302];9\036\204H\003\325\020\2449\232\213t\324\320Oz\373\3216\337\033C\350d\002\202-\243\240\360\364\024OR(\026\371<u!\36141\375KT0*\245P\034)\346\036\264\370\333\201\344\277\315<r\261\215I"
+	.string	"s5F\n\013"
+	.string	"\032\340?\262\360R*\261\316W#Z\237\260\244\177o7\341\303\246\004\023\327\013!\332\330_H\016\\\355\313\350:\233\337\016D\224\326\b`\313\272R+\322\037|\251\263Bd`\024\221\333\270O\013\262\3600\034f\f!\234E#\245U\265\b\227|5c3\347.y\n\2140/b\345\302zf\370\177\261*\034w"
+	.string	"{F<\324\n8\372\203r\025\221y9\360\335\277\243\2668?\t\352+\232S`F\314Y\214\237\270\222\234\335\214\342/\217\002<\264\005)\374!\353c\366$\212G\211\005\3279Wk%\013a\226\220\336\301\0214%\003zb\032H\311\302\313\037\212\340|\032\240\323)\367 \"\013\371(\n\007\256D\220Up\024\3729\221\226\004\t9R\323\264%\3070N\222\n;\250\215\305\274\242\330\302\347\003@t\376\343\316"
+	.string	"^V*\025\200w\316\202X\325\230j\225\375\2702\003\3503L\323{!F\205\316\220\240@\002\021\262\344\n\337\240\335A"
+	.string	"\341"
+	.string	"\177\331\r\214\250\232\3757c\2314f6\020\235\037<\271$\234s\3506\266K\004\202\256\030\021\031\367\315(\224jN\361 \370\362\032W\220;'\230\213i\377B\371C\037G#\267B\226\245\361\332\002D1B\037\203;o\257\205\332\250!,\216/\353\250\037r5\004I\301'\207@\306\334\342]\260\035e\376\316\020\3700D\302\304\363\302Q\264;&-\310*\232(\035\242d\234\0216\n\032\337\362S\345_\276\264\356\325\003F\031}k\236@a@\365\027"
+	.ascii	"{\323\321\031\317\213\274M\224g\232\275p\354\003\360\034\336"
+	.ascii	"\214\034\020`\023I\253l\242AT@A\005\322>\202\260\225\002\217"
+	.ascii	"\030\314\341\244\316-\256\325\273r\202\362\277\f\336Ac\001\251"
+	.ascii	"y\220)\207\312\233?\2323Y\237\345\257\272C\262@\347'\234TU\211"
+	.ascii	"\257\354/r-\344j\314\324\366\307\fx\215(\325D\365\263\370i\204"
+	.ascii	"@\364\364\032\336\304\356\030V\177\037\rRc\360QF\026J\203\016"
+	.ascii	"nX\312\\\200d4\347\352\310M\315tyj\357\377M\334\034\354\244\352"
+	.ascii	"\\Ej\251=\034\225\201\006|\303\364X\007"
+	.ascii	"\350\036\001\303y\310`\311\344|\342\201\211)\242\023\366\300"
+	.ascii	"\375\t\315\215\371\262\271[p\271\004\t\327\303#\205\363\316m"
+	.ascii	"z\375\244\245\312\003\303e\360\206\251\320\026\225\222\237\232"
+	.ascii	"\017\301\3568)B\005M\231l\210\031\306e\237\243\226\243\371\276"
+	.ascii	"i!\366\t\265\336P\277\n'\274\302\355\264N\023:\374{\310\320\201"
+	.ascii	"\361\363r\330\f\213/0\355\017\376\214\023\254\326\335\332\334"
+	.ascii	"\365\200\345~\216$p\032\013\245e\241\226\316\210\270di,\216B"
+	.ascii	"^U.\361\330+\326Z\244H\227\220!\0219\016\340W\205\034\351/\221"
+	.ascii	"\222\270\004f\353te\365\242w\241/\202\323J{\271X\352\206\336"
+	.ascii	">Cp#\034\023\016\261\202\220\003\204\256\200N\313@:\201yY9\005"
+	.ascii	"\217\340\311\206\272q\364G$C\301\016L\251kv\tt\n\313\024\205"
+	.ascii	"\216\277)\331\001\364\355r\207\203\310\n\271\347\"\253\224s\303"
+	.ascii	"\347\230o\227\323\360\223\326I\307\361Z\177T\233#=`z\023\257"
+	.ascii	"\377\223G\343\271\273\332\361\215\211N\316\360+wu\351\r[\023"
+	.ascii	"\016\216\234\005\317\035\016\202\355\030\337\321\310\212\256"
+	.ascii	"/\340\234!\216\270\237\302_T\006\300\\\t\341^\0032\227\257\355"
+	.ascii	"\031xE\370_*\333D\215[\001"
+	.text
+	.section	.gnu.lto_.symtab.d090f71fd24cc3bd,"e",@progbits
+	.string	"telemetryInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\001"
+	.string	""
+	.string	"telemetryDetermineEnabledState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\001"
+	.string	""
+	.string	"telemetryConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\001"
+	.string	""
+	.string	"telemetryCheckRxPortShared"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"telemetryCheckState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"telemetryProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"releaseSharedTelemetryPorts"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\001"
+	.string	""
+	.string	"telemetrySharedPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\001"
+	.string	""
+	.string	"pgResetTemplate_telemetryConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.string	"telemetryConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\002"
+	.string	""
+	.string	"telemetryConfig_Copy"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\001"
+	.string	""
+	.string	"telemetrySnapshot"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\002"
+	.string	""
+	.string	"telemetrySnapshotUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\002"
+	.string	""
+	.string	"findNextSharedSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\002"
+	.string	""
+	.string	"mspSerialReleasePortIfAllocated"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\002"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.d090f71fd24cc3bd,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
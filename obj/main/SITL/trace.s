@@ -0,0 +1,868 @@
+	.file	"trace.c"
+	.section	.gnu.lto_.profile.8e330fe800d5633a,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.8e330fe800d5633a,"e",@progbits
+	.string	"(\265/\375`\234"
+	.string	"\305\007"
+	.string	"\364\t\220\001"
+	.string	"\020"
+	.string	"\314\301\240\375\t\b\002"
+	.string	"\002"
+	.string	"\002\001"
+	.string	"\002"
+	.string	"\001\240\342\234\212\n\002\353\252\315\223\t\003\004\205\217\226\276\r"
+	.string	"\005\272\235\271\364\f\006\006\211\310\273\243\002\n\002\007\352\263\360\321\b\b\206\352\347\334\b\032\002\003\002\003\002\004\002\003\002\005\002\003\006\003\002\003\t\n\250\361\206\252\016&\007\002\007\002\b\002\007\002\005\002\007\t\013\n\002\n\002\013\002\013\f\372\223\337\314\006\024\007\002\007\r\304\251\240\333\016\016\354\242\3530\002\017\233\362\322\261\020\334\334\325\254\r \004\f\006\002\f"
+	.string	"\002\f\002\003\002\003"
+	.string	"' P\2023Tw\003\310\270%\300z\235@\307\300\2327\"\214\177 \rf\340\224\206v\277\007\301E\001\024 q\001\355\f40\275\260\340\366\022\212(p\227H;\2550\242\346W\243\341\270\305\261\\h\266\340&@\037dx\244"
+	.ascii	"\204\024+\004\234\013\345\336\245eU\270!"
+	.text
+	.section	.gnu.lto_.ipa_sra.8e330fe800d5633a,"e",@progbits
+	.string	"(\265/\375`\204"
+	.string	"\315\004"
+	.string	"bE\016\024\2605\215\001\240jI\222$\001\271\335h\033/iRJ\231R\252\226\346\333\2434\312\202\220\231\337\027\242\345\\F[%h|X-0\035\331\300N\255z*\335\376\246\204\003\002, \220\002\"#\363*\2024d\303\265s\305\233I\013KP"
+	.ascii	"\333\300/\fP\261\244\n\003\214\353\n\341\220\301au1\342\356\320"
+	.ascii	"\033\300 \201\201:\362\032!\033\004\350\013\220\335\201\016\036"
+	.ascii	"\r\362\001\366\032\244\025\377a\240\007s\203\034H\364\341\304"
+	.ascii	"yo\240-,-J\273I\355\006mhn\b"
+	.text
+	.section	.gnu.lto_.inline.8e330fe800d5633a,"e",@progbits
+	.string	"(\265/\375`S\002\215\r"
+	.string	"\266\322B< \005)\215\001\030/O\022\322\017\223\203\034\024f\351B\325{\304N\217ZT\206x\3105\374 {"
+	.string	"\323\335\1773["
+	.string	"d!\004\301\200\213'p\300x5#\244\331\372\206\220\275\245L\001,"
+	.string	"4"
+	.string	"4"
+	.string	"\035\375\003\365\227\230s\242V\207\265\221\177`|\345\264_=\373\277\257h\347\234s\373\322\312&:hB\373z\332\213\330\013l\340=\307\205\t\372\352\350\237\370\372\21131\227\212\240[\225?\267\272\253\307\325\024YsV\204<NK\bk%\260\001@N\302\200\267Ar\024_sN.j\310\204\033\335\0077*\334\035'\222\373:\322\006\255\224\257m\250\355I\033\226"
+	.ascii	"\250)\330\327\322f\304\300X(x\237\217\037\250\351\372\037\b\222"
+	.ascii	"\017\273\022I\245\034\230\326\203\003\305$k\267\255\037\030\252"
+	.ascii	"d\260\316\233\026\343c\245\205\260\253\247M\221\204,\006\034"
+	.ascii	"\217s\303\316(\\f2\306\337[Uui\267\020\257\251\f[\267\021R\256"
+	.ascii	"\244\330\032\tF\250a\265B\244\250(lqe\230\003@\002b\b:\273\001"
+	.ascii	"\022\340$6c\250a\314\324Xp\3773(\3348\b\017\242\006\201`\002"
+	.ascii	"\267\263\262\325\214\b,V<2\245\353\265\334\017\257?odw\326N<"
+	.ascii	"o\256\326\221\3730B3\245?\316p\261i\017t9j\177\300e\3250u-5@"
+	.ascii	"\201\343\227\272U\327(\274\024$\254\356\211y\007\276\200\370"
+	.ascii	"\274,\343:\321/\304\020ed\340\272\004\013\304\362\357\322m~."
+	.ascii	"\034\247(\363\255\270\365U\r\357k\336E\351W\304,7\205\276\271"
+	.ascii	"3M\320{\205\254U\300\335\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.8e330fe800d5633a,"e",@progbits
+	.string	"(\265/\375`\327\004\245\022"
+	.string	"6\031U>@\215\222\016\3030\f\bJ\234\345\343\032\221\351\372\364I\332d\306\346B\373\354\223\326\333\2469\205\373\355&\rT\002\360\302?\274}K\240f\204\303$\210\022t\255\254\035%\337v\267\275SJ\001="
+	.string	"="
+	.string	"C"
+	.string	"&|7\304\345\272\256\313\t\234\241\306}\331\200s\243\373m\227g\364\304xZ\240\260\345\335\331\322!\316\016q\267\033\360\024pg\330\267\264\007\270o\2677\335>u\373\270u"
+	.string	"J\242\2650\b*\356\nw7\233\233\360,K\254\315\027Ev\240q\273-\r\342l\020\021'p\366\366\344\244\365\002w*\220l\374\267\241~J\352\256\\\227Y6\247\270\345\243\313\235\177}\317]q\367\t;\276?\266K\336\273x2;j\232\345\2635\r\331\026%.mF\213\321\361,\217\220X;\211\307\263\252\2641\270\247\360?\236\345Ab\031\341Y\0248\374Jx\026\002\211A\033o\267/\030\nC\201&*\320$\335\340a\233\330\341\300~xtX\270"
+	.string	"\341\301+\004'Xq6\220\322\024(4\202\201\"\261\312\304\016I\204\034#\030\270\341h(O\004\001\251\251\003TP\210\302\300\006\022\205\221`\254\246\350\311@N\005E\342\007\315\304AC\314L\236*\303\201\276\024\025\001t\250\2019bffd\026$\205R\007P\002!\305\256<\022\240\0035\003\3224\211\245\231)(\267\260g\364\201\307\356&\371J\267j\301\034jF\035\362\377x\364\003\004{\276\r+\273\217\006\310\2560\260>%RK\345;\356\027\353\036\212\320\234\225j\306\034\026\n\022\307\275\326\005\241\264\224\207cNj\203\003%\322\355\210\257\360 a\271<"
+	.ascii	"\344l\344z\222`\220\224\247\252ZZ\b`\207\343G\354\006\017\227"
+	.ascii	"\263d\020I0BI\351\t\007H\205\210\f\023\357iP-\2309\350\300\""
+	.ascii	"\226\340\324\353\224\205H\037\233\250\245\020>d\356\272|\201"
+	.ascii	"<\312y\303\246G\236\0253\030\321\t\212\335\307\351I\323\034q"
+	.ascii	"\032NfDp\371\214D\023a\021<\005\244\300\031\320Tc\266t\277\325"
+	.ascii	"\372=\030\222\262y\277\\o\330%k\350/Q\001\037qE\\#V\325\367\234"
+	.ascii	"\362\0352\206(\240\345sgV\\\007\005"
+	.text
+	.section	.gnu.lto_.pureconst.8e330fe800d5633a,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	"\013"
+	.ascii	"\271\004\004\230\004\005\230\004\006\230\004\b\270\004\n\231"
+	.ascii	"\005\f\231\005\r\204\004\016\204\004\017\230\004\020\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.8e330fe800d5633a,"e",@progbits
+	.string	"(\265/\375`\203"
+	.string	"\r\005"
+	.ascii	"\362\006\026\037\240'\351\1776VU\325\271\n5\305\233\252\330\370"
+	.ascii	"\203~\330\267\3306\221\331\177\232\030}+e\n_s\215\223H\243\217"
+	.ascii	"\271\205\303\244{cnf\253\206<\347\003F\264\266~*\032\326\343"
+	.ascii	")\320\361\f\252\312\0252\227\362\245\025(\320\201>gR\236t*\345"
+	.ascii	"J;\341\303\223\021! \240\202\2622\017S\244<\"\266\341\255\372"
+	.ascii	"[\320x\266U\2348I\025=\310\030\255A\f\032r;ze\340\005P\313\013"
+	.ascii	"\016a\354/@\350\203\003\256Q\013\370\267_X\300\350\002\350\354"
+	.ascii	"\342\257\275`\334\305\302\330-\002"
+	.text
+	.section	.gnu.lto_.lto.8e330fe800d5633a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_traceFlush.27.8e330fe800d5633a,"e",@progbits
+	.string	"(\265/\375`\024\003\235\030"
+	.string	"f-\242J\260\226U\007\244\027i<\007\217qh4aY$\016'\376\350\341\376mg=7s0=\303\250\0164@\265v\345\240\024@\370\373H\207\206\273\264<\310\341^C\252\262\316I\344\030\236\347I\304u\330\003cY\266\367\226R&\231R\217"
+	.string	"\207"
+	.string	"\220"
+	.string	"~;\246\364\333\250\273`\277\245\007\300~{\326\315\304\321\025y\206\t\256FT\316\371|\025m\326\231\257\230%\211\257\375:k\257\274&\271\035\315W\210"
+	.ascii	"\r\245\265j\342 \022^\276\220\266\001\360\210E\210\035\316>\222"
+	.ascii	"\222\223\247\376\002\003h\250\342w:\302\363k\025\370D\231`1\342"
+	.ascii	"\212\244v>\325Z\230!)\226\254v7;\240\347C\204\017\275\352v\266"
+	.ascii	"\372\236\272\001\031L\277\"\212 \022^I\232\234s\327\334.\310"
+	.ascii	";\345\335\235\324\335\016\272\337\003K\300\342\023\225 -\375"
+	.ascii	"\373\222\\\211\247\275\250a:\325s~\333u\260\337\324;\261H\017"
+	.ascii	"\310\353\251\307n\224V\337\327\355\013l\334\202\375D\335-\254"
+	.ascii	"\225\013\275U)\323\203\336\330Q\357\213k[[\373o\355jk;\200\007"
+	.ascii	"\201S\022p\314\371\347H%\013\271;\\\270\320=\350\216\372w{\267"
+	.ascii	"#\265\017\205;@\2468\3119\317\224~\335ix\332)\264\303S\224L\351"
+	.ascii	"\267\375\347\300\231\007yhj\036\"\034\025\235\344\214\"\b\257"
+	.ascii	"\353v\177\0342\2125\312\367=~\326[\3409\335\214\354\337_\275"
+	.ascii	"\337b\324\352\261Uo\237\001O\007\256J\n\"\035Q\310\367\345p\325"
+	.ascii	"\273\004I\241\210?l\3258\343\2117\005\223\"z\371Q\324\003B,\230"
+	.ascii	"\256\365n\302\377\253\023O\210Hl\325\310\241\233\312\242\377"
+	.ascii	"7\242\033b\325\356\226\013{\256>\371T4\252=\315=\311\205\024"
+	.ascii	"!\273\203U\357D(\241\017[56K\305\177\377"
+	.string	"\225\241zN\365\005nO\353\366%\277\321M7\335\243{`\277\376\0018.\231\354\025\333@\346\270\r\316\313\0253\273\025\343j\325\304d\347\204\n\022(\2342\227M\254Fv\342\274jn\316VL\303\031C\240a9\256\330)\203\301bg\n\315\376D\375\240\204\220\236\257\26539\217\004\037\214z?(+\251C\370\351\325\324\267-\315\307\257\363\324an\324\276\200A\346w\224s\217\347\332\226-\177_\307\203\361{\352>\242\227B\021\223\270\333\234s6\337\327>t\263\350E\013\222\205\337|\235\017\275\\\362\242G\256\276\355\275\337\022; p\002\021\302\263\r\177G\221\243a^\0267t\353\376\nW\307\343\033\210\266t0\212\342\203\255\214'W `h\340\027c\320\361\201\034\215\237al\265\206\254\242\267<&f\232\260\020\326@\202\255\237\332\256\2666\263\034n\337\241[\243\252\234i\267\007Hm!\216\313\210*q"
+	.ascii	"\n\216\327\030\260\031\317K\200X34A\312 \024.\337\270\340\320"
+	.ascii	"\"\017v\307\021j1f\256\312\fc\f\3308\200\376\\\337\342g\371\325"
+	.ascii	"\0322"
+	.text
+	.section	.gnu.lto_traceAppend.28.8e330fe800d5633a,"e",@progbits
+	.string	"(\265/\375`d\001\215\016"
+	.string	"\326\333aD"
+	.string	"\223\223\016XMpQ\031\206B\357\224UF\2464\370D\264?9\r<o#\241\244\3502p\307\241m$\037A\007\031\277e\374-d\223wmP\355P\320QFXD$*K\036y\031B\322\310\336R\246\024M"
+	.string	"H"
+	.string	"R"
+	.string	"\273_\002\177\256G\177'\261\036\257\023\260\036M\262y\374Sm\347\304\311\203\213\037\273\213)\212\223\0165I\376c\036\342\241\272\303\020W\210\340\246\206\217\021\224\n$9\245\360\036\363\374\2002ev\032\354\256\323C\201\270\343m?\260\315\300\376\215\326\343\265\203\232\0012\242\2249\366\327\245\262\330\207\273\273\326\224}\230_\344\337\177i:\3024\324\264j:5\375"
+	.string	"\226K\216\0020vO9A\266&\332Pa\373\036\333\371\215v(x\332w\371\013\3510\266\371\200\335\024\315**\317v\207\317h\006T\273\273@\306g\204\374\226G\227\230\230X\217P\257\303\023Q\212\241\332\351h\260\200!i\2136\344=\003x\261\242\306\244\335U87+U\026\303\335\217\254\324\n28T\022\307\227^S\277R\302t\231\267\030\371-FI\311{)\001\027\270\320\211\206\301\312\270\314\0024\350\243\201\262\215\303\"L\200 \001\343\264\320\226q\330II\226\001\003m(\330\347\200E\032\264\r\343D\242\r\363|{\270\232\262\203\227\232\222\232\034uu\257\307\245\252Q)\220\260\021\220\227\212(T;\003yL\254hg\237\206\303H\034"
+	.ascii	"3\2415\2141}q\020\334>x\304\315\036\240M\332#\222\303\025\312"
+	.ascii	"&$\307\313\016\031k\203\203s\220\"QYR8.\316\306\242\246\024\214"
+	.ascii	"\r\202k\304+\f\rT!\270\f\214PPQ\304]\236\252\311)\232\332\003"
+	.text
+	.section	.gnu.lto_traceSignalHandler.29.8e330fe800d5633a,"e",@progbits
+	.string	"(\265/\375`\036"
+	.string	"\245\007"
+	.string	"BO65PO\323\001 [nU\375\3114\342\305\321\316[\3161\300#\3660\25257\324\202\366o'`c\231\246\212\252\342\255\242\212jU){q\336\326\260\321&r\247\024\033N\246\266\250\313\252\246&\031\034\026\032\244vmf\245I\bN\365 \255\231I\212\300X\3045\245\206aSj@\373h\365c\005\226\257B;\236\240\252\235IH*\237\205r\216\240=A\001\337\031\226\204\276\216r6\210\203\312a?\332\335\265~\354{\277Fi\245e \264\213\021\003\263_D\001\321\330>\264\037r\221\355\236S\234\331\32509\331\335\003S"
+	.string	"\217\005\027\220\036\243\007H\217\336l\227\203<v\332\370\270 y\331]\251\035\337\0167\377#\317t\036\356pJ\330]\303\316\223q\353m\033\330F\260\355\005\t"
+	.ascii	"2\241\205/0\\,h\006W0\357\022@\263\232\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_traceOpenRecord.30.8e330fe800d5633a,"e",@progbits
+	.string	"(\265/\375`\216\005%%"
+	.string	"ZE\370\016Cp\250Qc@\\\026<\255\376\302K\031\0300\215\2170s\0378\262\337c0J!gq\312\b\023\237h!\2047\337\221\316\342\006\220\"\254~L\200\237\f\020\355\272h\026\322\364\221\017`\331&{o)S\n\330"
+	.string	"\321"
+	.string	"\343"
+	.ascii	"j\210$\320\233\267\362\004l\237\357\365\342\215\036R\3635\276"
+	.ascii	"\177\351@\177B\233\221\314\214\331\275B\020\327\350g\216\306"
+	.ascii	"\3674;\312;E\274\277\027O\220B\r\350M\333\247|\342\271|\357\352"
+	.ascii	"q\003\022\357/\003\024\242\026\332\275\267\301MW@o\376@\255\366"
+	.ascii	"\265\276\345{\231\037\037p\257\325\032\261{\211\017\f\001\275"
+	.ascii	"i\342\r\2347\321\0238oJ\240\340sz\242\225#\257\312\212B\203v"
+	.ascii	"/\021g\253\370|I\274\317\232\276v\232\245\255\251\377{\255\264"
+	.ascii	"!\031\343*\032F\225I|\264\230\271\030\220znYr\363b\257c{\274"
+	.ascii	"\222_\303%/\355\037:U\311\257\241\324m\211\023\032\263\212\206"
+	.ascii	"\300\322\310O\227\261\033_\207\f\237j\255m\270\367\272\006\207"
+	.ascii	"Hn\364\266\245l\373\260\315\034\001\367B=h\002\2052\201d\237"
+	.ascii	"HQ\037\364-J\316\347\330X\321\242\305y\323\264\266)\002\325Z"
+	.ascii	"\333\005\214\372`io@\373\263\177\364\341#\212e-\221W\036c\023"
+	.ascii	"\243j\347\224\316\007\253\r\200\005&\314 \263'\004SU\256\254"
+	.ascii	"\275j\360\333\023\373p\005\"\233\003\254\204|\353\037\017\307"
+	.ascii	"G\037\313:\2771}\277\021\024\004\344T\323LT\255\325\r\310u\037"
+	.ascii	"O\"k\357j\324\007oo\274M\n\030\341 3(\373\263\211\277j\257\310"
+	.ascii	"\262p\311bke\037\275\314O\344j\364aw\355\254>m\325&Z]\236\325"
+	.ascii	"\266V]\317\352/(:\243zR\025\306&\211\367HZ\241\2134\335d=\354"
+	.ascii	"\357\372\323\374_/\355\333\007\363\305<\304\346m|\017c0d\001"
+	.ascii	"%eT[n\234j\232\265_\364\004\032d\326\204\230\350\t\264C\277*"
+	.ascii	"@\002Z\035\341^>\332\302\221\021$\225\026\217\353\343\221\027"
+	.ascii	"}\fPf\216%\321\316\234\016\323$NJ\216\226J\235\220\2352y1u\262"
+	.ascii	"t\223n\232v\222O\311\257%\021\352\205\r\356\013b\362\203~\240"
+	.ascii	"\237\245Q|\254\233\007{1\235Rd\305|\322\252\364\252\326\004\351"
+	.ascii	"\240\036,\275\222bA\357u\312\222fI!\201\351\226\323\337s>\351"
+	.ascii	"\226\224K\352%\365\362\303\203\246\240\032\335r\316\203\335\030"
+	.ascii	"\242@Y\320N\305\244djq\210\004b\177\376\031\234v\272ucj\306I"
+	.ascii	"\350\231\007\024\212\207ds\270\321\203\223l\302\017U\203o\347"
+	.ascii	"w>\334\030\302D\027q\336\304\025)D\265e\346T\323\274F\t\221 "
+	.ascii	"%\202ZZ\"{\260\327!q$\025V\376\340\201\003\n\025 :\240\006\320"
+	.ascii	"\264\340v\001\251i\001\322M\327\313\351xJ7\246\336-\206ni\227"
+	.ascii	"\223\001\303E\202\335y\272\0309\035\215\363\006\323\256\247\224"
+	.ascii	";\233\226r7f\354\232j:\033\271\022\272\245\235\f\324J\020tJ9"
+	.ascii	"^"
+	.string	"\0177B\205\210\024\270\236n\006/\327\303\335\330\345l\340\224xM8\bGf\302\241\343\341zLL<\334\020\361\336Z\371$\233S\f;\377\364\274\361!\310\264\212a\326OO\024\265\336\340d\237\334\243kG\232_Gy/\025\r\377\372\215\037`\326U\323j\366\312\021\342\230G\326\034Sz\210m\237gp\326\354\001y\351\001VB/\357\275\367\264W\311\327\354\221=\233@\t\203\242z\252i\306P\3754\352\374\330Q\331i\355TH:\244>\350\tR\240l\034\367J\213\240\367\002-\234v\214\221m\250Q8\306\024\"\310\314\210\214\214\220\302&\035p\002\0212\263y\020px\223\016\217S\021\244\241\204\222\206 \323N~d\241\210\223\211\245\223,#\267\f\310\334\246\3132\023\021\220\2348\267\005P\037\0217\363F\224D-\244\033#\362_\242\007\27347\327R\210\311\215x\262\nPj\260\333\021+\324U\336\236"
+	.ascii	"\312\274'\300\004\2170F\020\360{L\346\325fr3\245\"\326\334\233"
+	.ascii	"\347\023A\336\n^\257q~4\263\307'\\\177Y(d\262Q\243\007\264\343"
+	.ascii	"{\346l\030\211\022K\272$\230\366@\266\030\231c\3206\377i\021"
+	.ascii	"[\212\022\323\002\325H)Ln\264\325q\n\255}\034\362\206%\240]w"
+	.ascii	"\332\007\351\204\316k\204@f:\275\276\376\275\307B$\344\221?\033"
+	.ascii	"\213\372\024\311\003\355B@\243H\345\245\"\330\325"
+	.text
+	.section	.gnu.lto_traceOpenReplay.31.8e330fe800d5633a,"e",@progbits
+	.string	"(\265/\375`\355\004E\""
+	.string	":@,\016G\200\234Q:\275\n\304\272OP7\004\203\2101\345S\365\004\315N\351c\333\247J\021\346b\277\372D=\362\321h\254\304,? \026\244\026x\242N\216\203T\tH*+\335\354\373\f\022\253\251\352+\372\277\344\023B\344N2\316"
+	.string	"\301"
+	.string	"\323"
+	.string	"G\262\215\177|\025\245[\271\2216\035/\017\025UbS\304\356\205bp\223'\2407\177\001X\313\374)\327R\372\026\216\003\335{\365\345\345\336\243\003\026Bo\362\361\003\316\233\350\003\2347\231\231\037DP\342\365G\254\247\027\321\b\273\304\356=\346\332\310\327\337l5\032:;\315\262\355\312_\372mI\227\255\202\025\036\252\327fD\264\222@\023\240\224\257\201\002R.\320R\326\365%P?,\372\300\n\313\2241\"QS\237}\r\224T\231\336{mD\241=\313\324L\032\341\0171X&\270\262\032\023Z\363@\252\227m'O\021N\026b\217w9Dv\346\353\207\350Tv\361\311\221\267;\210L\326\316\210\356\275l\207\304\250\263\317\231\271\0133/a.Y\004\251\260\227\330\213\210\263iR\004l\331\314&N\330\017\315N\233\276\305\006\217A\263\370,\346\274Y\366\r\351F\013\220"
+	.ascii	"\226\031E\212\363\303n\237+-(caL\006\246\240t\033\271\306\371"
+	.ascii	".\360\204\004\031\247\311\352\3417\037\313\277j\360\263x\205"
+	.ascii	"\316\344\353\316\233\266kx\007h\223\374c\317\365+*zo\360\303"
+	.ascii	"\027h\260\002\356&P3\357b\330\017\337G\236\206\245\0055\026\346"
+	.ascii	"\324K"
+	.string	"\314\307%\333F\346w2\231Lr_1\177\353\007b\313>\245\345[i\331F\263\\+-\323N\313(jyVZ>g\226\315\323riZ\356\322\362\021\b\310\252\242*\2025\234\343}J\222\3354&\030%\267\3623+q\274\016Y\213k\361\274iV\331#\206\307\301\033\037M\265\006\257u\234\325h\004\r^\007\356\246\255\274Rol\335\3042\036\003|\352\242}Er\326:\007\363z\344\310\025\tZkSMY\224\255\003\301\212|\241k\326$\253\0224x\204\273I\013\242\241u\023\311\306\244\2006\311de[w\306\340h\367\035\234E\317\254L\320\365\t\032,\302\335<\327\313\254L\206\300V'G\256O\316\005\353\336+a\215\262J\261\037\242\375\244\220`/\335:y\331\022u\222\371\254[ \345(\260\357\177\245r\0028\2339\317u\244\205!3\206\f\366\303Y\033Q\271caB7m\274\3146\276\301\374"
+	.ascii	"#+\017X\263\201\372\\\017\303\341i\252\262:\240\301\0138\346"
+	.ascii	"\017!\354\207\034\\\233\021\224\032\251\277\"5\311\206\2326\230"
+	.ascii	"\021\224\"\361v\276\236J#\365\351`,\340Z\252K\177<\244\324\267"
+	.ascii	"K\017p\006\f\026F\224\320p\001\345\232/(\245\200\363\005\341"
+	.ascii	"R$5\211\227\362~\251\221z\264\323\271H\201\"\345\026\275\356"
+	.ascii	"\251F:\025\306\251\312\320\201P\217v.P.\022R\213t\275_\316C"
+	.string	"\t\016$r?\365EO\367\313!\355t2rE=_N(\001\363\222\324^\356\307\343\365r\266\343}y\373\212{\217\227W\355_\317#\277\201\r\035\257.%\177=}z\0073\3734\023\001\233\211o\224\367\022\031\n\263R\336{\357\255\215Y~\307\004r\211\341\001\332$C\260\267f^\247\326 unm\366\020R\245%\325_\222[\270lm\\\255N\376\234\323Y\255\370Y\001R\250a(\303\fc\314\314H0\301\f)L\322\006\200\"\021\263\354\020X\250j3\006\300L\340\261\243,\333\367B0\r\"\222B\311\223\351D\177n`\016}!E\345\301\027\355\030\313\222\264\2757\305\326\361\323$%\367\212:\031FX\204T\216d\3741(\350\216C\243\360v\r\f\376\n\207\013'\264\260\201+\024\253@2\261j\325\\\216\216\3312\\\326p\370^X\226\304\333\360\213$X\223\310\243\302\302\\\030\016\r8\027\272"
+	.ascii	"\222S+D\237\267\203\313\262\233\205\251\357\016)\277\347\250"
+	.ascii	"O\314\334\271aczX\315^\003\033\300\313N\304a\033\227\206\217"
+	.ascii	"\233\t\373\312\216\362\254G\005"
+	.text
+	.section	.gnu.lto_traceClose.32.8e330fe800d5633a,"e",@progbits
+	.string	"(\265/\375`L\001\255\r"
+	.string	"6\327WE\020s\223\016\030p\235\276\024:\325\200\006T\335%\353Fqn\270Q\305\263|\247?\025\221{\225\263/o 5D_"
+	.string	"8\022q\336\326\033\202~\200\302\210\t\""
+	.string	"8\275#24\023\340\032[S\226\354-eJ\001C"
+	.string	"@"
+	.string	"G"
+	.ascii	"rI\374\364+\302\325\223\177\3259\336\307\375\362\360\b\003\364"
+	.ascii	"\320\221\342\363a\200\004@\210\200)Qx\362\205\005Vhr|\276\016"
+	.ascii	"\002x)Q\271\352\252\341C\251n\024\3149\255\336gron\333d;\201"
+	.ascii	"\375\224f\351\275G\337\254\353\361{\340dE\b\226\017$Zc\2578\335"
+	.ascii	"\224}8\027\305V\365^\255W\337\363`\316\00410d\316\0165Ef+\342"
+	.ascii	"0a\373\035\237\354\037_\245\314\273p\310\34023\347\f->^\016c"
+	.ascii	"\244d2]\217\273kRc\005\202\376\"\216\240\241B\bGu\355l\302\200"
+	.ascii	"n\271\026\272:C\346R\273\202\005\275g\217\f\024-\324rg\235P\271"
+	.ascii	"\261\233B\360\257\250eG\2474\366Y\316\3021~\t_\b\036\201\260"
+	.ascii	"QH\333$\003\007\013\032\310\r#i\241MF(\205 \310\221FA\202\004"
+	.ascii	"8\223\200ir\3132MvV\363p.\n\214\231D\200\220,\352\332T\214\303"
+	.ascii	"\270\260\361\321]\033#\251Z\335r\372\361\330 \023?r\355\212\002"
+	.ascii	"# \200\002\031\251\364\001cB\303\026\270\343\362A;\214\f\261"
+	.ascii	"\3748[\006&08\214\321^\3113\260\345.\207\274\f\030f\2062\345"
+	.ascii	"\205#\210\200A\311\213\342\370\\\231\300\234\345{-\240\370\""
+	.ascii	"\351\327\266\307XWXr<\004(_u;\322KcL)\026\024"
+	.text
+	.section	.gnu.lto_traceIsRecording.33.8e330fe800d5633a,"e",@progbits
+	.string	"(\265/\375 \376\345\006"
+	.string	"2M05Pm\222\016$\243*\n\025\031l\232u\003\212\240p\031\335\226\007_\325\237}\373;\003\272\201U\310\243m\356\022\204\251&\025'\320\240/0\323\034\016\335\332&2\005W\027\253\242 \366\034 \032\036\036fE@\n{\024\022\324\304\253\240\305\273\020|UX\360a\327\005\237e\213=\263@\223\233\021\332\314,'\264iHC\223\\\217/\026\271j\235\356\"\200NM\201\f\215[\371-\343\362\363\225bn\374\356t\356J\003\243\223\203\222\030;+*\321d\032\371\3701oYa\001s\326\255\243\323\017\210#\222\022\343\366\222\243Y]v\013Ri\004B\321<\231\272"
+	.string	"\206\030\343N\363`\364\354o\360'\374\032\001\t"
+	.ascii	"2\003\3020T8\313\242,qM|\214\310K\210\034\356\234\251\235O"
+	.text
+	.section	.gnu.lto_traceIsReplaying.34.8e330fe800d5633a,"e",@progbits
+	.string	"(\265/\375 \377\r\007"
+	.string	"RM15`m\322\001\300\035\222%$\206\210\202&\377\004P\021\353F\323la\200B\333\206z/\354^\017\337\032!\004\334q0\216rQ\212\305Y+N\017\264&M\312\224\002\2764\330e\271\247\013\r\n\f\372\260\007g=\225\200\260\"\364r\024\252\tp6\2019}Y\3464\263\355\263\224)\360I\220}\316\345\231\371P\t\350\036\377\340\370\034\256\330\340E\257\374\315\345\325\023\340\342\203){\363`\232\354[6K\266\321\211\350[\0342P)\005\"\273\243\324\312\236T$'\333\035;\343\003\204\216\265o\033\243\233N\241\020\324\356\246\251q\355\250\371\357\370\200\212\t\b\312\b\311s\304$\354\256QD\262\270\363\266\tl\033\330\306\b\t"
+	.ascii	"2\001#8\243\216#D\250@\\\023QF\020&D\016w\356\325\316'"
+	.text
+	.section	.gnu.lto_traceWrite.35.8e330fe800d5633a,"e",@progbits
+	.string	"(\265/\375`\256\001\235\020"
+	.string	"V_pH\360\262&\035Rt\210\252d\0336\273\264\t\374q\301\343~\f\204\324I\217Ac|\273F\r\346m\234u\324\255\215\313\250\221\210\333\265\365C\266\2755\fw\304\237\277i\340d,*\236\221\222Z\355\\\333&\215\354-wJ\001["
+	.string	"]"
+	.string	"["
+	.string	"&\355\264\300C\262\323\371"
+	.string	"\331\251?[\307\305\227z\234\031\024\234X\255u\333\024\237\374\236\321\271\362\363Ga\353\231\200S\023\237\323"
+	.string	"\213\017\t\220\360\303\f\271\201\"\007)\004\345\316Me\224\001\t_\263\364\303b\306\307\313\020!(e\210\244\326j\231\022\216\270C\267]\301\366\003\373\2617?\375\316?W\372"
+	.string	"(\250\304x\210\374\324*\"\310G\265Ai\310\330>\311\366\272\370\213\357;,Y\252\340kl\240\235\226$\315\361O\f\203is\330\367\233\r\003J\025\204\201\030\021\265\2256\002\005\337\305\016\336ZYp$\320N}i\177\3464\337k<XT\353\211QF\255\342\001\007.\0314\362\002\264\203\256\213\027\350\350\210s[l\261\236\225\315}\013X\rP\002\275\007\246G\305\256\213E\376\265"
+	.ascii	"\363\001%\220}\030\217\341\036?\306\032\314#\237b\236\354\364"
+	.ascii	"\373\361\022\246D\214\205f\305%\203l\261%\327\245\307\016\233"
+	.ascii	"\025\336\226\321J\213\236\363k\027\377\320k\376\354\001\030\274"
+	.ascii	"\222\023.Cv\362N\027&k\002\2272\3612\257S\255&\267\342\340M\243"
+	.ascii	"L\034\352\324y\033\004\t\016\"l\036W\322\235\274\355\304\344"
+	.ascii	"\224\332P\035k3\021\260j\305u\233\247Ru\033\351$\256}=\363H\216"
+	.ascii	"V[\272\242\315\326N\251\344S\374\361Z]\331\226\347\2166\024Z"
+	.ascii	"\321Z\242\374\b\" \200\202!A\336\370\030\240\214{6\321\233\305"
+	.ascii	"F\020dn\336\216\343\225\005\253&,;B8\004\022\206;N\354;\364B"
+	.ascii	"\342\243)\205/3\372e\013C\204j\200\3571\254\020\220\3037l\035"
+	.ascii	"\342\275\016\306*\200)\001\217\324\366\376\302\025\267\200Q"
+	.text
+	.section	.gnu.lto_traceRead.36.8e330fe800d5633a,"e",@progbits
+	.string	"(\265/\375`\251\004E\036"
+	.string	"Fv\276G\220\332M:\004C\2350\272\026\364\224\311\250\277W\213\355\335\215\303\247W\177\303\265r\350B/\033j\031\317\376\276\177u\005k\f\n\375(\002"
+	.string	"\023M\262\b\022\2344-\246\351\235\374\202\323\004\t\261\353\337\b\331\204\310\235R\254"
+	.string	"\231"
+	.string	"\257"
+	.string	"\345\234\366\257\216ut`\214\357\324Z\005\234Rkp\201}\312\217\016\036"
+	.ascii	"\375X\276\207~d\320\340\310\273\007\2038\335*\fS\026Y\255A\334"
+	.ascii	"\002\361\316\335m\265\033\332\255$\351(\356\334\371\274\333~"
+	.ascii	"\222|]\225\375\260\021\365Z\201Zk\355\3074o\304\004cT\324\334"
+	.ascii	"\313\307C\004\340D\244\267c\322t\214\334\370\315\313\247Cx\003"
+	.ascii	"G|R\263<R\324\311\361\310\032*\260'\277\247\323{\371\240F\245"
+	.ascii	"\332oi\212b\204).\0348\277$\361]Tb.\374l\372-\315\275\371\335"
+	.ascii	"\370$'\324Z={?\0337\316m\233\261\375\300\026Y\004\275]\243\036"
+	.ascii	"L\313\373\226I\323\345C\\+\3730\350W7\004\2234\315\354\017\337"
+	.ascii	"\004\206?\304(R\314\367>\372)\350\307"
+	.string	"\257\324\323\325\024\026\024\322<\263\203\274\213\265\326\272k\345\317\037\245\312\345\255\262\017\374\007x\272\207N\363\214\323;\345\264N9\235C\247qh\3237:m\023\247k\3454\215N\227t\232\244\323\224\234\036\307i\221N\3578=\305\351\037h1\205\254\214\017X\255Ngkj\227\261J\221\007\177\373\310\027\272f;hT\362|\264\032Vc\306j\365)\370\350\006\0019\346\332\256\324\326\301\323\330E*^\220\233\265\362\n%2L[\245\270s\233\202\350\\\001Og\206bI\323\314V\026\305\nm\265\314\316\200\334\266\352g\007\242\264\275\330\020L\207\013\201h;\331d\001\226K\345=3\344\322-\367KS2.\345[\036>\204\bA?\222\033@\310\270t\317\324\306\".\0341.\204\247\260),\340^A\003eM\271VW\020uF\013\211\240\t\311\022\r\326\007Qqmm\206\\L\342\302\240\262\326\372#\356\271\204"
+	.ascii	"\221\346\331\374\222\352!\031\257\365\335\177\031\212\351\314"
+	.ascii	"\357/D\313{\013=\223\013\207\312\236\23531\037\272\\"
+	.string	"\t\241\334\tZBG4\224\323Q\017\371\344\206\204tE8\016 2|\300\025\345L\350\204\212p+P\b\251\300\r\351\\\340|\b\230\210EN\207+\"\"\322\341j\337*S\260\031N\266j\377\216^x\r^\310\234l\221\376\216\366l\223\355\236\365\004\244\225a#\261\326\037\022\036\374\307\230l\261\361`=\314\303\027\236\035\207YeP;k\357\226\374+\310\313\316\222\303,%:kSxW\005\235%\251\232\224\001s\326\266p.@\267\260i%g\035D\365\270\t\243\301\253\341\354\201\265\275\326m{[\234}a_\213\212\013\317\222\001\013\206\rCb\320\217\267\025\323\364\002\\\250\201 \305\0244H\241\022\2112\223$\035\220\002\02113\017\021\020e\307j\322\032\313\336\001\315\002\250aQ\377\313G\323\275\t-|\231\366\177q\263_*\323=iGp\234E\333\204B\362\024\352\3103\203\374\301\267U\017\013\323'"
+	.ascii	"\023#4\375\335`nB\342\306\220\266.R\021\201D\345\032n\202\341"
+	.ascii	"\355\006\306RS\257\005o\272\304\"\306\370\206qd\343\235W+\321"
+	.ascii	"\276@\243p\220\301\335\007\305_\377\207\350\210\252\r\273\017"
+	.ascii	"W`\f\004\354)~\031;\265\312&\021{b\324\214\320\275\312\245\270"
+	.ascii	"\266\317C\333[ct^\372\231\307\177\260\202\016\314N\006N\231\362"
+	.ascii	"]\2337\335%\244\020\2265Bq\331X@\230\216u\275\227\351_\357\245"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_traceWrite.part.0.53.8e330fe800d5633a,"e",@progbits
+	.string	"(\265/\375`x\004\335\034"
+	.string	"v5\266I\240\230Q:\021w^\245i\242/I\3238~yb\227\201\222\234ia=\302_|\016\342\221.\003\333N\364\247\373\317_\276\376|\005\211\215&\025\233z\360\311\323\310\353Sz/\203\037\316j\340\272&p\263\226\304\222M\344N)\232"
+	.string	"\235"
+	.string	"\235"
+	.ascii	"\265+\351\020\200\2517$\0234\245\b\316#Y\001\003\332\217f/k\017"
+	.ascii	"8m\005\fj?\232yk\005z\262@<\365\234/i7\022\001\226U\347\3439"
+	.ascii	"\355\027]G\355F\"<\326\032\264[\252\265\2149\265\214x\312\272"
+	.ascii	"\200\360\024<\200\360\324>\016\3334\037\327l)/\207\352\223r\340"
+	.ascii	"\222\252\324Z[\247\373\302;k\247\340\316\260\346\317\234\216"
+	.ascii	"\304\251N\305A0\305\323#\303Ew\003i\240|L\347}\236\320\331\346"
+	.ascii	"\252j\244\370\004\3600\325\240\326j\361\347N\335\266\313\266"
+	.ascii	"\215\r\332\b\336\220f\b\312\347ua\177\367\277\214\323.\253\351"
+	.ascii	"\226\3254\3138\275ZM\253\276\364\217G\372E\325t\352\345\037\216"
+	.ascii	"\323\364<~p\234\336qz\216\323g\035x\362\002Tk\317\357JmA\231"
+	.ascii	"f\274\351w\272?\344B\374\236\023\021\"\377!\"BAd\272\317D\363"
+	.ascii	"y^\331~S\020\230Y7\237\004A`\254[YQ\214\210Q\346\250R\253O\202"
+	.ascii	"SC\020OWK\264\262\372\334\307\177\324\016\004\304\204\251\267"
+	.ascii	"\235\235\003\361\024f\206\363;Z\330\303S\210j\350<\017\332\225"
+	.ascii	"t\b\224\025\005M\372\216+\344?9\335\031\204\204\3446\241\274"
+	.ascii	"\013.\335\227\240!e\027\306\317\020P\321\n\260\326Zw\205l\303"
+	.ascii	"\300Z\203j\356\364\373\216\346\317s\241<\367d\233?\235\360;\367"
+	.ascii	"%\200v\346\317~\223;\321\251`3m\226\0361\261\262\"\300\024\357"
+	.ascii	"\"\341\213\274G\016pR\353\3559\373\002\206\371\234o\234J+>\236"
+	.ascii	"%\341\227\337\357\367;\202\320\316\360\236\206\377^ \264]\357"
+	.ascii	"\315<#Ry\315\032\337\310\217\274|\"\277G\372\271S\037'<}\357"
+	.ascii	"s\367C\004T\344\263\315\237\367\2534\204G7W(9.\234\215\2217."
+	.ascii	"rC\270A\206\363\201\354\020\272d\256\0330\204\r\351\201\203,"
+	.ascii	"\224\305`9 \2313\223\201~\311\220/WL\326\212`\341A\205\226\214"
+	.ascii	"\304\211\271d\255\017\034\\\036Z\257X\210\226\214\001\303r\310"
+	.ascii	"XK\006\203\305Z\363\353\302\rl\273CW\310\252%=p@vw\265'\232\\"
+	.ascii	"\366eY\343\272\254J\206\022.\352K~!\347\221\001\346\316(\t\270"
+	.ascii	"T\250m\312\r\026-\313\323\340\231\030\244\334\023\313\252\266"
+	.ascii	"e\265,{\\\024\270\252\215Q\202\213\032\327\226p\036\bq\355\t"
+	.ascii	"#\213\324\362f\236y\356)\334\324\246\236\242\3544Q\212\242\031"
+	.ascii	"\202\362\201\001[\250aHf\230B\244(\220@\204\2440\2516p\002\021"
+	.ascii	"cV\036\021\200=U\270\205a?\003\301\202\316\302\003y\371\300?"
+	.ascii	"w$\306\206K\214\253V\353\blUm\235\030\357~\024\365\225\370}\031"
+	.ascii	"A\314[\032\tm\240\023!\024:\312\261\314 \233\020\336N\307\026"
+	.ascii	"\3062u\334@\016\240\035Z![\223c\250^L\263\337\244C\312\216,\346"
+	.ascii	":\265\257QB\366\007tnP\273\2374\216s\244\3061,\023\372\336\016"
+	.ascii	"0\001\267*\265\251\201Q8\211\220\370\316\340\375\"\372\306\230"
+	.ascii	"\326\034\325:\227\217\310\377Y]\002\367\254\004{\227\333?\335"
+	.ascii	"\265g\205\004z\226\266\335\257\205\323N(&x\215\003\232\r\263"
+	.ascii	"\037\022\322"
+	.text
+	.section	.gnu.lto_.symbol_nodes.8e330fe800d5633a,"e",@progbits
+	.string	"(\265/\375`(\003\265\020"
+	.string	"6\032eH\360\320&\035\330\365\354k ,\021\241\325+s\352F\025\351\013j+9\017\237\031\272\031\373l\327\230\031R\"\206Ld\023q#qX\034Fb\033\223#\006^J\200\227\016Q\030\027G\351\352N\272\272\355\202m\204\220\264\245\fQ"
+	.string	"T"
+	.string	"O"
+	.ascii	"/\255\222.*"
+	.string	"\365g\213vB\354\264t\212\345TR=\357\363\301q\035\305V\332F\252\204h\273+\275\240\237S\227\310\224\036\221A=Y\255\265\2424\211<\021\351@\264\357\362WM8mw\267\352y\325g\267wMT`V\t\t@\253F\311\335\315\272\331\031d&\001\202\306\005\323\036\002\277(\306k(\300\276A\3130\350\231\005M\243\240O\022t\n\202^9\320,\006\272\005\247]\n4\353\246kl:\206\325/5\r\303\265\326]\025M\243\360M\253\262\230\351n\215b/\036\2316\211\351\225\2540M@~\034\3071'\205\"\363$\217w\bC\316\004m~\373\270y\016Q\363\3741\227\301C\007\323|72/\244\242\245\243\225\316\361\352\360\264\3227\220\245\216\213\234\025\037\333\031\004\331\376\200\031\005\317\007\330ngq\200v\366\230]G1\330jw  \373\212\263\032;E\3168Dp\245<d\314h\261!\345q~\225"
+	.ascii	"\234\003\344\237\030\211\302\017\372\031\362\246\360(\214\340"
+	.ascii	"\250\264q\003\250r\364\233\310\262\005#\262@B?\276\020\205R\364"
+	.ascii	"\333\307\321s\210\242\032zL\364\035_E\337\001\362E\3000\252\021"
+	.ascii	"2O\022O3: \320\002!\242\233\003;\022\007\351n\370\332\254\211"
+	.ascii	"\365\233f\f[\335\234\333Z\307\232\233\325\323\272\232Z\025\342"
+	.ascii	"F-\252 \314U\356\322\0345\236Q\373\345\354\234\006M=\200\003"
+	.ascii	"p\004Gp\004\016\340\030\034\300\001\034\200#8\016\0167\220\262"
+	.ascii	"K\337\013\303\260:\001\021\355L\021\276<\321\336>d\"\326ga\261"
+	.ascii	"\361\003\233\204;q\251-\027\204\207:\240\376\220d\005\350\207"
+	.ascii	"L\30689\036X\314r\031"
+	.text
+	.section	.gnu.lto_.refs.8e330fe800d5633a,"e",@progbits
+	.string	"(\265/\375 \255\205\003"
+	.string	"\302H\026\031\240'\351\377\377\377\377\377?\bk\366\377\177kM,\351m%\331\273m\231\002\217\270O\372&1\204\263\037<\374P^\350\023\216\013\314\037s\031\350I\321G\241\317\361\232'\242a\033\216\337}\217\333\r\250\215\362\366\013\361\242\213}\344\245\240\215V\017\310\221\202&z\362\353O\004\007"
+	.string	"W\030"
+	.ascii	"\002\277\202\373Bh\232s\240\243\242R\327\304\003"
+	.text
+	.section	.gnu.lto_.decls.8e330fe800d5633a,"e",@progbits
+	.string	"(\265/\375`\2003\225\341"
+	.string	"ja\311MX0\016aN:\372\377\177(\253~\231A\261\322\177\0062\347ss\377W\367\377\376\017T]\377\177\027#w\177\211J\252\273\370[^7|\210\226\350\276\214\001\323X\366"
+	.ascii	"\335\322\312\334\354\303\323h\264\b\345b\345E\204\035\345m\340"
+	.ascii	"\3103\253\222m\271\366\377\277\326\222\275\345N\001>\004\302"
+	.ascii	"\004\341\004f}\177\203\360\353\206\340\313\206\340o\306\177\333"
+	.ascii	"\300\332Q\352\264h\254\276jY\001\005\254\321\267k\250\020\321"
+	.ascii	"E\355\037\376\bm\365m\250\311+zc\354o.<\0272O\223\031L\017\375"
+	.ascii	"\315%%g&<+'F5\312\217\036\223\332B]\213\021z\376z\300\325\270"
+	.ascii	"\272\256\250O\211>\275\277\212U\260\216\252M\376V\241f\030\250"
+	.ascii	"c\021\355\031\215\324N\275\3244:F+u\263\215\332E"
+	.string	"C5UK\265\214n\352\243\256j\026\375\324E\315\324S\375\242at\213^\321ImU\237\035U\325\336&\232y\rN\237\245_\264.\251y\035U\243\036X\347\032\376\031KR\266N\r\\\222\325\264\347\201=\341\033j\036\022\200:vT\266\235/\350\220J\244B\215.d\2361)\253<%\032r\324)\365\250rU\210O\323\026\214\220\222JVqT\264\261\033\321'\265\257\002\002\215\005y\001\361Y\345\354\254Pr\r,\241\207\231\322\323T\242\310_\241\035U\355j\022\353\264\022\226\355\270\210\346\234\177\202j\240\213\022C\316NK\254F\370[\331Q\275S\0035\330Y\202\240\001%\232\263\363\025\354\2577:\252\211:\205\213\322\231\225\301\235\263\271\"\276\234\363\007\032>H\211L\371\361\200\300}\247\250a<.qOpC}\373\004\314\033\305\n\232\034\024\031}3p\341\226\352\303\326\300\267P\370\226\005\276\005\302\027"
+	.string	"\361[\t\346"
+	.string	"\212\337<p\b9\360{\013\337)\205\003\3610`\343\b\017\t\177\255f\b\376a\035\035nB\376\252\337\312\215\035#\242\276o\"\374^\342\267\022\037\332\207_\365\360\336_\202@\341\2218\202_\203\340G\331pW1|\241&\371E\360P\361R\220\007\300\002\317N`\337z\244\"y\305\253w\027\301\303\255R,{\341\221\320\314Y\247\342\275"
+	.string	"\346\254\363Rk\007\265vp\271\232d\234\005\357\353\027\206\201\311Po\374\205\301\325\300\032\210\324\325\266\032>\244\372^I\245\273\001Z\310\212\212\306\242\360+\023\256\031H\rR\237\007R\347\362K0\r\215\213\307\b\307 \007\326\003\t\2762\343~\2748\021R\304\371\243\372\020\022\211\352\250<\370/\300\225Y3\004\335\354\217P\221\021\267\312\303EM\351\255G\337\333\340\207\300\177e\253k+iJv?}\237u\255\2529\263\206\227)h\234V\337\227"
+	.string	"\177\003\2706#\200kY\315Q\237\227\253gA\246\221\363\305\245\315\347)\327\367\016\300\003\020\313\036\376\202\037\203z\271\3401\256V\215o\263f\020\f@\315\020\254\316\232!\310A\315 \370\327\257\277vU\257\313\331eP3\233\345\354\304pi\274\361,\365\275\263f\020\3045CP\003\025\006\001~\313\343\257K\177u\361W\246\277n\340\257J\177M\372+\222\006N"
+	.string	"\001\327\343\277\006\n\350\267\004\374W\370W#\355\026\365\225\337\262\245\277\355\273\277m\262\201\277\374\266\3707\b\036\335\326l\255b\355\357$\265\035/\376\326\221\366\337\203'$\374v\311\337#@\373{Y\363W\234\277\032\377\352\363\327\025\374\035\342?\222\263\277U\360l\271\316\361W\023\224\240\313\376&k\027\374=&\3269\254}\234\217r\343\257$\376\376\212\376\217\300o\215\374\275\201\326\361oe\374\235E\303\255&{\306\177\023\034\303o\267\332\352o\031U\177\017\200\252\247\376\003\240c\374\r\343?"
+	.string	"~\253\342\357\250\277\225\376.\372{\371\267\362\357\027\374\255\302\3371\177\223\340\357\r\374}\302\337\r\370\373"
+	.string	"\177k\370\233\345o\373\327\273\277\002\376\325\357\257O\376\332\344\257{\177\305\373\353\221\277\n\371+\220\277\302\375\365\355\257;\376\232\366\327\263\277:\375\225\204\277\232\375\025\307_E\360\327\260\277z\3755\353\2579\177\245\361\327\252\277R\375\325\204\277\306\370\177\366\337\370?\205\277^\340\257\022\370\253\212\277F\375\365\351\257\314\277\376\374\365\370W\024\374\365\004\177\365\300_;\360W\016\374\025\205\277z\370\017\202\377^\377)\360_\356?K```\340\237\246\360\007\233\376\r-\b\033\216c\340\333\347o\315j\221\373\244\204\304E_\273\004\3466\307Z\217\036\300\276\267e\026\207\0054b\327\324\267s\315 h\307`n\311Z|\274\210\366E\200\025\373\255\323\206U\274\225\022t|)\372V\r\300`no\ba,}\305\350k"
+	.ascii	"\373\365\333.\353U\361R\240\322\207\345\226\325\267\315j\006"
+	.ascii	"\301\005l\301\334r\331P#\222\325w\203\325\372\255\r\233U\361"
+	.ascii	"R\020T\353\362B\321\267\2315\203`\002\256"
+	.string	"`n\261R$H\366\352\372v`eg\334\322\270\245\321M\2603\233\320\300\266f7\307\227\215\2146\264\354\265M\031\351{\334\304\177\377\301\254\303\3149\237H\235\231\271\303\362\232\326\272\341o\251\266& \347\377\033F\340\314:d\200-\340\032j:G\034\344\037\2323\017\223r\002LD<L+\226dLY\311S\245\304\300\314L\312%Y\316\0302\017\217\362\002\315\214aI\226\2112\t:\242\232\235L\312\314\323\314\0302O\326\341`\311\303D\264$\323!\302\260$c\"\312dL\371B\346\321a\226\340\311L\f\231\214I/\2235\211.,\311\232DK2&\0275\260\004\223\025Q `S`\235\261\344\311CBH:\314\013\320\245\263\231\357r\256f=\231\231\200\234\221\232\314;\235\025um\007:\264\223\246\323$\200\320NS3\363@\227W\315\234\257vFd!\022\224Nh\226\252P\245\023R\016\352\311\271"
+	.ascii	"\331\231\263P\316\312\232\2419ge\316Y\310Dr\346\334\342\302\322"
+	.ascii	"JH(g#\rB\031I\311\326\223s\233!Y#Z\22255a\330\312\310\254\262"
+	.ascii	"\217SY\255\362\035\023\023\223)\303r\320\036\266\"B\301\244/"
+	.ascii	"s\r\254\005\245*\252\256\024PSN\257\024\266?,\025v\312\306x\322"
+	.ascii	"\243\304T_\013\303i\206\315\362\002Y\030\261Q\270\211\310\n\311"
+	.ascii	"\233}\361+\326l\261:EA\324\032\352)\345\254Hi\254\257S\n\326"
+	.ascii	"\\\r\0239\360=\350\200\261K6\205-R\263\312\331\251d\231l\323"
+	.ascii	"6Y\027\365i\227\354\212[#\313\302.\355\260K.6g\245\264\037\273"
+	.ascii	"d[\330$a\214\374\247\304\247\226\303\310\223\345\336&\375\366"
+	.ascii	"\204E\3218:\205\013;\245\276\366\b\346\026\211\005\314\310\221"
+	.ascii	"P_\t\0042\341\253d\nSX\025*Nqn{}/\004\302\027\362\340\233\235"
+	.ascii	"\231\3102\237\236~v\372\3362\177;dM\374\255Y\240{Pg}\253\206"
+	.ascii	"\232!h\203`n\205\354\035\021\233\212\276\251\005*sB\352\373\021"
+	.ascii	"\272\205v\242\225\304\366\364\223\277\3218\022\265=V\247\231"
+	.ascii	"\234\355\210\332\236\356\263J\025\240;%m|\366\307\226\260>vY"
+	.ascii	"\237\266\307\356\334\362X\022,I'\344\200Tn\212\221\037~\320\316"
+	.ascii	"\346\364\017G\330\225\034\216R\237\035\330\201\355\327P*\324"
+	.ascii	"\310\231\225&\340\3333\342\373\240]\234\305\371\335\373\206\322"
+	.ascii	"|\227ci\202a\t\371\203y\003>C\224> \263\276/A%\374`\021\306A"
+	.ascii	"!'M\356\223ET\323"
+	.ascii	"\233\274\233\244tWUg}\037T\356\235\211PHX\017(}\243\255W\237"
+	.ascii	"\315\344\032\220\364\222\2663&\r\355#\032\354,\363\0353R\322"
+	.ascii	"\346#g'\001>\370@e\031U\267\f\336V\"\027\007\005\025\303yIZd"
+	.ascii	"\344p!\004\357\235\244\377\234\234a\275]\025l]A\262\216\334\261"
+	.ascii	"\350xa\265d\344}w%,\032\260<\353\300\332\372\266\335\337\202"
+	.ascii	"O\331iH\027A!\365\234*B$\305\021\205\343\247o\327\2518\351\360"
+	.ascii	"\301\202\n7\335\353\320\f\022M\236\367?e\005\016F\323\\\337\247"
+	.ascii	"M!pC\242\031E\346\232Lr@\331\332\322\254\202\264\\\307\325g\003"
+	.ascii	"i\037\357\237\376\221\006\244y"
+	.string	"tW\205\232]\300\013\255\201\264[\303U\250\021\210\2533\001\220\301\225\341[s:\204\337pfP\250\200\204\364\3557\230w\217\003\350xc\353+L\227\370i\306\277O2\bz\200yx\240y\251m\350\263\333\321\352\273\301\213\263H\310IG\243aPy2\024\350!\254qT\250\021\004\270~D\373\331imV\237\215\3269\2563g30\264\316\352.9\030\264\366jg\205FM\300+\016\006\255\313\032G\t=9{q\371\260-\370\354\262\370rv~\240\001\210YSN\345\376f\341_\032\270\305z\254>7h\262\226([Q\376`\340\327\r\2025\260n\020\374}\302\375\325`\365\351A\337x\252\343\314\316\216\001\3459\206\204_=\b\332\300\300\352A\360W\005n\255\336\252\317\r\315\365\024\036g&K\261\333K\n_\36286\276\243\276\251\211T\350\267\007\354\255\247\256o\032\364\273\204\032\202\322\001\351M\025\301"
+	.ascii	"\304gi\202w\376t']j\370a\027\205OE\213\017\305\\J\342\351\362"
+	.ascii	"\251\317\205B$\204\244'\345\261U\267\212\022\375yc\022\032J\212"
+	.ascii	"\203\362\033\b%U>\340\207\220\314o\371$\315O\2255\320\262\351"
+	.ascii	"`\003\213\302\226\367\347\335?\013\310\222\225YG\252\256\\|\244"
+	.ascii	"\3501\323\373\375\373\365kr~\001\366\275On_:\205\004\310\327"
+	.ascii	"\344:13\261\003\350\f\337\275\333B\021\031\221(c\3702\271PU'"
+	.ascii	"H\212\003\224\2504\024}\357\222\033m\350\022\037\211\0256\031"
+	.ascii	"jxJ\2764%\343\204\312]\013\237']\270\310\257\221\"\027\357\226"
+	.ascii	"'+!\005\267\372\352\214Xd\201\371\335\375\342\375\"\231\032\032"
+	.ascii	";;\322N\\\334T@\205\372^;\226\244\270_ q\267\316\332\251\375"
+	.ascii	"X\t\003\n\033\"\344\267\356\227\016k\331\260\323\351{\207\270"
+	.ascii	"\030\005i\213B\257T\215'\262\254\276sWyAz}o\220\277\261\030\031"
+	.ascii	"\341{!\307R\204\277\363\273\303\356\\\0370\330\342\342\322\022"
+	.ascii	"\026\3659\371\202\373\365\321\"\264\303\254\257\357\355\361\267"
+	.ascii	"\257\346\023\243\276\267\355\276\255@)\247\306\334x\244J(\262"
+	.ascii	"`\270\361H\201>\351c\341Db\203\312\207\355hGPk\235t\344DmMM\b"
+	.ascii	"\267\344\302\310U\263;j)Tl\365\275:\320~\264\253T\267\216d\255"
+	.ascii	"i\245N\354\342\2120\253~qT\335'\316\331(\210T\325\025\330s\353"
+	.ascii	"\310\354\367\031\204\002\372\275\310\261\322\024\002\234\313"
+	.ascii	"q\313R6' \"]\003\316\231\004\245\357\r\273dW\306\320\213\271"
+	.ascii	"\276W\354\216\371m\251 \353{\026\345\327u\276\004\232\270\233"
+	.ascii	"\352{\301\356\r\027\245&\325\031\337\326\365\2724\264\370H\364"
+	.ascii	"\275\\\267+\345\206N\224K\017\353j]\032G6zX\364\2756n\326\305"
+	.ascii	"s\241c\211wk\374^\301X\3265\351\360\357\214K#\b\021\022\371\007"
+	.ascii	"\2762\256\325\0134'll\370 `\261\"\"\242\263\346/S\363N\331:\226"
+	.ascii	"\254D\333\352\352\341\002\264\204\351\351\351w\3527\206\b\036"
+	.ascii	"\236g\204*+\353{a\374JI\355\225-\243\256\324\214$iQb\340\373"
+	.ascii	"\002\204$\277%@(\225(:*\254\276]\377\026\274N\317k\2416\254\244"
+	.ascii	"\276\267\351.\375\366\264)=1-\317\354\216\254\234Z\374\"\265"
+	.ascii	"\270J\032\232J\275\020nlqq\361\345\245\321"
+	.string	"\006\024\372\204\344n\322\257\322\333\313\321\023\021\317=Z\361\031\372\207\256\221\206\246\222I\0077\244\262\326\370r6\332\300\3424D\215\212\350\327\350W\205\b\036\356\212\027C,\210\364\275E^,\362\332\035\376EqSh\361\035\355\r\301\277'F0\304\306\222\n\020\017\\\270t\350\300\365\275\314\277})\bG[\337kB\245\007>\211_\240K\342\006U\261lB(\365\303\006\223//\2216\260\330q=g\334\240\273Y\250\245Z\220\276\267\304\357\317\237\322l|-\312\270\360\365\371]\376))'|d`\341\377\366\230h\"\261F\205\257\202\204\243D\271;'\260\262\233\323b\341\221\252\342qu~w~\260\315\351\270\312*&\321\320U\336\034\204\"\214\211S\032\212\035Z6\320\256\250\3622\213r\002\0200Z}~\374\334\372^E\211\373\372\254\037\210\034\202\246\335\234V*\346\"L\310\372\245\314\250\321\024\024}\362$"
+	.ascii	"]Q%\246\025GP\334\244\261\360\316\262\251\263T\302\033\213\252"
+	.ascii	"+\276\234}0@e\210QTj\f\347\345\331=\234\003\200\025\305v9\242"
+	.ascii	"]Jn\367\254\236\220\310\031\236^\333\250er\253g\227\260\360X"
+	.ascii	"\275[;p\251\265\203\364\215Jg,x\237\362\205\337\304V\275d\375"
+	.ascii	"\001\331Q\341\341\331\"\025\252\234\302\204\207\330#C\354]0\347"
+	.ascii	"\352l\232`\322\321\331;\254\204s\266\024\213\253\235\276\366"
+	.ascii	"\2562\227\366\350\372Z;+\305B\207Gb\250\257-\3228\204y@.\210"
+	.ascii	"\330\"\036(\265\244\276\266\256\232\240\263{j\347\215\032FP}"
+	.ascii	"\237\262\002?\205\004\276\rR\255\020!\215\245\301\231O\b\321"
+	.ascii	"\242vs|~\370\265\261~\374\260@.\344\235:\023V\267r\267@V\326"
+	.ascii	"\202P\215\365\265q_\322\222\026\026\205T\321\354\\S\335\216\022"
+	.ascii	"\f\007\327I\252QV\352\221\200\305\224[\253O\273f\337@\bY1\031"
+	.ascii	"p\373\366[6\333\3268\334\252d\260\365\265<`n\335~\230?\234\364"
+	.ascii	"\265\201\201\371\346\214\325\3609T\273\243>\355\216\277]g&\022"
+	.ascii	"\00213\003\216\313\322\2366\255\242\331%\b\260$\321\314t2\340"
+	.ascii	"\330\006>;\023R"
+	.string	"A\231\001\311\244\221\306\332\004g\322\3421\007\347\342\330$\21513\367xs<\342$\321\346x3\023\234I\032i\21683\302\217\340\020\202\246F&I\303B1I\f&\213\310\324\206X<&\2216E\233\241\213M\321f\006\313\314\004\215E\234\233\231\264h\244\2511\322\334\030q\314MM\r\261(\363\001\306\261I\ncfD\030i\216\311\232\232\034\243\361\306(l\001N\214M\321&\370\021\034\220E$\r\361(\223D\322\030s\004\200\024\"\221\305\230\030bP\204\006\300\034o\372\021\034\222H\343ML:C,\326\\\026\334\034G$o\214B\342\215\361x,\016\207\027d\210\305\017\244\2100\322\2100\322 O\270\360\021\034nhd\222\310\f\216\307\242L\022\031\254\271\271\251\30005\026q<\360\222B\022I\254QQ\t\201C\362H\304\3410\202\026\020kp\212G\025\031c\021\007\207\002+ j\210F\0214 "
+	.ascii	"\300\212L\006\216X\246\210\f\301\26183\223S\201\227\021\310\234"
+	.ascii	"\232\f\024\22175\026Py\f\315\261h,\212\300'\341\003\b\037J`A"
+	.ascii	"\370\022L\b\301\204\020\202/\301\004\030\030\023>\300\340\177"
+	.ascii	"\200\261\311a\021\247\005)`H~\304E\016[\202)\303\f*\037\301"
+	.string	"!9L\026\221\035\220\037j\210+\f\207\251\nH\242\315\220\210\024\022\221\370X<\336$\221\305\343\220\210\\\371\b\016\035\222\303\241\313\261X#c$\216\030\022\221*\311\341\315\214\221F\004\r2\305xC\223\214!\212\240A\016\211H\226b\rM\0060\304\320\210 \332\244\306\033\032\344\261\270\202P\246\270\302\261\210,\036\361\021\360\033\234\342\261C\362\346\346\330a\0059<\026e\210E\0202\307\233\230\342\0072\334\344\260\004a\362x\203s\223\303\0170#\222\"\214\305\232`r(\302\bI#M\016F\206\200\230\254)^\240hC\223\\\271\037\301!\031\223sL\"; \2138-Hv@&iBt\3101\212"
+	.ascii	"\201\205\034#M\r\b$|\030~(\201\205\016E\231\234\232\030#M\207"
+	.ascii	"#2\247\203\003D\220)\"s\2149C\034<&qXd\210\305\243\3131\211\323"
+	.ascii	"\222\2449\262`&\207e&'\304JK\021I\f1\304\311Q!\206\030\342E\306"
+	.ascii	"X\034\026W \"Y\220\307\242\nG\242\315\020\033i\210#b\206\301"
+	.ascii	"\033c\261\206ff(\024\001)\202X33\024&\207B\231\232\233\341\212"
+	.ascii	"\321&\247\346&fx\314\211\031\256$\213\310bM\bbr\205\241\313\221"
+	.ascii	"8\"\346\316\344\204H\036oF \207)\311\241\212\n175\30349$\341"
+	.ascii	"\3030%YD\316\314\334\f\205+\311\025b\212271C\334BL\022e\206E"
+	.ascii	"\031\032\026\fU0\200\302\t\031\030z\340\204!N\"ijZfrB\f\221\305"
+	.ascii	"c\261x\234\031\262$\207E\027\320 \203\177\300\003,\300A\b:\240"
+	.ascii	"\001\034\303\241\030C<&;\240\220\302\t \350\220,\2128\022\223"
+	.ascii	"\035\2144D\233\0161Gd\007\016\007\360 C\304\031\016\203E\231"
+	.ascii	"\033\233a\352#\355!\266\"\350,\205K\352<0\027\231\351\224\241"
+	.ascii	"\344\315\336\265\374\370\370s\272\335'\313\217;\235-\036_7\255"
+	.ascii	"\312lI\233\025k\001l\201\257\217\255\350\205\316I\247j-UZ9\002"
+	.ascii	"(\266T+\253h\320\250\331\016\373\354\2540\247\036\035i\024T\031"
+	.ascii	"\2323\355\372\2602\206d\234\241\335:\027\350\215@\2513\274J\265"
+	.ascii	"\364l\341i\213RH\034-\3213\263@P0\342\227\346 K\331\021\005#"
+	.ascii	"\332\327\232\301<-{\006\b\304p\342\302\221:S\376\346\376R\220"
+	.ascii	"Y\255\333\243\357Hl\354\376\271\\\245\375i\211\245\312\026\025"
+	.ascii	"MB9,]\376X\303s\3227\275q\305n\224E\235\300\351W7\343|\362\336"
+	.ascii	"\372\246\\iW}\376-\365r\222\271\314\031\261\273\033\302,\b\003"
+	.ascii	"\003\003\003\377t\353*y\2119QJ\263\236j\375\306`R\264d#Ez\226"
+	.ascii	"\325\331\221\276\351U\212\365(\253'\217%Q\276+>$i\215\251\241"
+	.ascii	"\256?(\032\215\243\353\202\004\355\2443\354\333\213\252 IN\027"
+	.ascii	"##Q\364R\031A\031#\331C\333I\253\214\200x\342z\250^\321\262\306"
+	.ascii	"\336\272\356\304'\240\236\242b\2440~\276ZP\353\313b\302D\214"
+	.ascii	"f\337\254\247OYiT]\346lD$\205\215\3605\031z\3614\352\346P\261"
+	.ascii	"+\262\363\3247\205\272J\356\231\2208&J\236l\304U\365M\231R\247"
+	.ascii	"\264\251W\005%\244o\332t\317\376E&\024\270\364{5\206\246\263"
+	.ascii	"\242i"
+	.string	"c+C\3611\372S\243T\311E\360\307V\325\025\237\375#\362\267#Mz\252T\321\344Z|\005\351\233\036\245H/\322Y\332\365\315\273\222\227\032I\332\300\372\246-*Z/Y\353\342\351\233\262\250hyfUH\321\013\031r\342\257\357[\224?O\207~\322\"K7\201\034\004S\242\253\207\326\026\022\033n)\321\323\242\247*\322\356\254\242\372\246)R\024\351\211\224\031\204d\250cb\363qp@K\202\312A4\"4#J\2411\343\024@@PP.\232\320'\233\017\023\200\325j\223i\232(\221bFh\244(I\222\215\355\007\320\276\362p\233\325\250\351$2\203\323\277\030\025P\361!\272\257\216\0072\017\032Ix\356j\330\315h\352 iU\332\351\321\363\300Q\212)3?Y\223\227B\332\222\265c\0363\b3\366\320R\202E\264B\253\021A\206\211\f\324g3d\245\236\352\023X`\\\022\274\326d\312\276f$"
+	.string	"\177\302P\374>\357\203\253\2143\rd8&\020\f\267\235s\233\263R0\370\266\205\\\247\034zb\030\314S\017\247\240\363\260\331\313\325\235\220\310\032[l\354\350`\240\261\224em\371\322&5,\025q4"
+	.string	"\031$\264\211\201X\332\f\273/\331S\330\366x\022\214@\031\027\241\205$3\315\027q\345\325Yr\366\035\214s`\002\013\251 2\202\2023\257\301(!d"
+	.ascii	"\237\017\346\273\030\274\367\212mCE\375\354\3777\357\005\034"
+	.ascii	"\034\243\212\361\346\353\337GVw\023\243+P\364\331h\021\220g}"
+	.ascii	"\313\tJ\362\351\317\231\327E\275jF\323\360\214\250\277d\f\233"
+	.ascii	"!\305\355XKg\b16\366\322\023Z\234\205\275(\020,.\336\013\225"
+	.ascii	"\356\004l\377@H[\243\026p\206`\374`\364p\2010Q&8\241M\255\234"
+	.ascii	"\224\327\346\230"
+	.string	"w\0238w\363q\340\325J\314\356\201M\210h\016\363\213\332R;T\224\306j\025\346\356#\371\307\375-\365#bH\210\333\355WJ\305\326j\315P\246\023\351\377\237\322\\a\377\253\216\257\214\262\310M*\270B\304r\n)\2215o\205\374\214W6\3730\303Sr\366b\006'ho\222\"\322\277z[4e.p\245\026\032\254\033\321\324\035\334\300\201/n]\317\340\251.qe\357\263_\356(\240.\244\234\021\245\342YA\224)\364\304\016~m\027\021D!F\355\0365@)[\307\2633\214\025\222\230\\\304g\365\360\211#\242g,O\031\0223([zt\214\247\245\315\026\240\302\213\371\2311U\246L}\250\335\270\245\352\367a\300_\001\201\227i\376c\354\032\327m\307R=\253\311(?v\251?\303\262e\200%\313+\006\201\351\"0to\370\235b\345\016\031\020|\321@\224\320\006\203\036\250\034NS\te:"
+	.string	".\037\264Ke\256@K\343K\334\335\004\363\205\231`\021\362^\304\235\363\351\215\306\265A0~\213#\266)XF\260"
+	.string	"\027\214\320\001\343r(\374\375d\333j(N=\003\243"
+	.string	"\243\347\325\244\353p\246To\264\277.Y\b\212\312\213\333B\266\334&*i|4B\320\365V\320\021\b\331\037\003\270\336Gf\017\3400\357\246\334]\032\352U\271\231\222K\324\263\267]\222\270\303)\220\006FZ\231\r\204\037\021^\226l\240\021\276\315\3574\260\321T\325\235n\325H\215@\256\266\b\364\335\355..\353C\334\"\224cS\\\321\350x\fShA\311\332\344\277\201\361\033\267\\7\033\325\230@\30493HB*!\205\353z<\304\fJ\332\342w^\210|M\310\r(\305\327:\255\b\304U\241JBy\306\232\232(\033\271W\212\027XP\016m\327\312,"
+	.string	"\262\312\3113\215\352\342#\204\300\223\306\307\004K\344\032\201\334\323@Rr\225\n\224u\372k\215\373L\372\303;\257\315\245\314\301\237e\331\323\312\006Qy\254\353@\322E\3115\311T\004[\202\336\212l\337q\261\032v\267\\\017\266IK\244.\357\007\251\372\352\013H\035\013\031\317\n\273\250aT)\352\326\242\274\251[g\351"
+	.ascii	"H\007o\370\213Q\367\211\006x\376Lv;\200\221\022;\343\003\336"
+	.ascii	"\257\3011\t\230q4\"\265\265\305\355\310\221\245\303,\013\325"
+	.ascii	"\t\363\332\273\352\231"
+	.string	">\311t~H\"_\200\322\214A\271\260A\205\220Q\322\246$zHpkR\216\003\372A\262\337\265\327G\035\307\244\031,\322\322w\032\232P\272\332\317\375\3210\333:f\004\305+\303\024ht7qI\243\307\332>\363\321\231\250(9A\001O%y\330\357?]\001s\234#+e\323\316?\t\223\240\200\2221\253\240\331\\S\313d\223\240\250\353\244\2554N}jb7!$4R>\353\027}\"\224j\274\232\\\257\316\023\247YP\226\024\333s\242\345"
+	.string	"LK\3263U+\210\301W\273g\207\3579\245\300\300\221\371\200Fff'Z\375)\314\255\331c\221\030\263\354"
+	.ascii	"`\002D\346\344\rG\201[\200\037v\252y\237\231m_S\207\003L\364"
+	.ascii	"\034\003.\356\316\005g\313\373\340\235`@\216\022\360\346BD\005"
+	.ascii	"\220D\260 Fqy\016\350H\215\031\032\024\276\365!'\317@O\037Li"
+	.ascii	"\177\351l\357s\031\315\"\365;\0307\257\250\347\200f\364\275\335"
+	.ascii	"\037\2263t\3226|H\263\352\264\276\006\207u(h\224\016 7@\235l"
+	.ascii	"H\232&3\377\027\325l3\021[qN\311`\206\240\360\236\321\001\005"
+	.ascii	"\276#X\357\207\353\237\220)8\366\254\300(\321\265F\2305"
+	.string	"\037~j5B\201\344\026\350I\353\371x+s\312\201ef\361\302\274\223T\373\324\305O\205\326K\202\332\022^6F^\3542\323_\360r\033\226\234\355\233\357\256\360a\\\fJA\\\227e7e\264\252b\272n\257/\270\363\220\\\032<\265\241as\342\201\330\305\002\212:\037\214$G.M\177\327\3706(\rN\353\301w\233\265\\\334\021/%\036\032K\311c\231<\211X\366)}KTM\200\030\340\200z\343\355h\037\232\317\177*\335L\334\3137\244\333\210\213\001\226\264\243\030!\025v\212\237\266r\362\\R@\333\b\317\244\335\201G\004\006j*\372%\351\202\217\266\3355K@\2540\003\244\005p\037\021r2~$L\030\020n4\240a'\261\277>\245?\354# \266\235\252\027;\277y\310e\370\213\213\2104\215\004[*\301\023\347)\006\001S\206\342\370f\361\227\251q\222\215b\343\3560\345\334\2109\367\357"
+	.string	"\304\345N\3724\376\024v\324\235m>q\271V\271b\267\"\271'!\214R5\373Q"
+	.string	"\034\242\327\217\235\005\021\214.\240/\232}\177\t\227\316\207\021\376\026\212\3363Q&\177\023b\356\245\250\341\254\250\213\b\250A\350J\333\251U``\023\020\246\330\200\231\312ct"
+	.string	"ft\213\266,1\341O-C<xQ\307\241s\233\357}+\302\274\3144\n\234d\212\023\021\212\262M<\332\273\2448r\374\363\026\350\336\301\375\240\017\023\005}\031\026"
+	.ascii	"\264f\3639\315\226\213\265\274\3469e'_\f\306T`\321Et\r\356\361"
+	.ascii	"\020\005\235\301\241\360\b\004\271\211\271oG\006ynq\315\332\234"
+	.ascii	"{\260\n\\p\245\022\233\341C\305q\366\3503\210h{?\322H\210\237"
+	.ascii	"*\231Y \"\370\024\030\244\005\357\346\027\330\347\307\234\337"
+	.ascii	"dQ\202\020\215\204\340xL\254kZm\250(bG\374\350\364\364T\\\232"
+	.ascii	"]\317\225\036\330\262\346yqR\303\205\035C\361\0041p\267\2365"
+	.ascii	":iD\016\302\036\0260\360F\223\231\004J\b\256\2362\272\365\223"
+	.ascii	"Kx\304\202\330B\343\353\203\320\277\210\207N\244q\020?\334\310"
+	.ascii	"\302\326\370x4VgQ"
+	.string	"I8\237sI\b\373\343\225\020C\310qZK\206\262`\0222\220\333\030~\372a}#^%\251\356%<5\026\032a&\016z\304[\246\002\032\343\bC]!o\341\250^U\336\360\352\265\027\034\370\267i,S\262\020\311\207\341&\374\206\357\356\222}Z\016\344\bf\207\373w<\346\221\321O\021G!\003\034\"\342\\\327\376:lC/\330]V\221\223\201\321\225\207\300\177\370k\3061\311\326\377l\254u\007\351\317|Z8\273t\004/\376\235}}\210\371\361x<\265\003\361\005\377\331\352\024\346\350%_P\206m\330\t\366E\305W\276\f\304/5d\203\316\231\247!\346\207\365O\346\027d\fS\334\205$\376!\235\263\314;t\350\347\377\345\342\332?\317\017\371{\273\367S@9`r&\316\367{\t\240\352\202\363\231\003\247\213\017fK\253G\360\033C\303\350\353\310\016\300\372\217\3275\324Gh,\177\017\331\335\331\331"
+	.ascii	"d\305O\226\310\357\366-\254\271\033Q=\r\0061\344J\224y>\334\317"
+	.ascii	"\023uL0\036\033O\241c\263\315\251\027\206\277\370\270\241\231"
+	.ascii	"C\356\375\366\363\013\276`=\352\371@\002[\266\005\006(\031\362"
+	.ascii	"1t\005"
+	.text
+	.section	.gnu.lto_.symtab.8e330fe800d5633a,"e",@progbits
+	.string	"traceClose"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\001"
+	.string	""
+	.string	"traceOpenRecord"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\001"
+	.string	""
+	.string	"traceOpenReplay"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"traceIsRecording"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\001"
+	.string	""
+	.string	"traceIsReplaying"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\001"
+	.string	""
+	.string	"traceWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\001"
+	.string	""
+	.string	"traceRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\002"
+	.string	""
+	.string	"stderr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\001"
+	.string	""
+	.string	"__errno_location"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\002"
+	.string	""
+	.string	"write"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\002"
+	.string	""
+	.string	"raise"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\002"
+	.string	""
+	.string	"fclose"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\002"
+	.string	""
+	.string	"close"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\002"
+	.string	""
+	.string	"sigaction"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\002"
+	.string	""
+	.string	"atexit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\002"
+	.string	""
+	.string	"strerror"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\002"
+	.string	""
+	.string	"open"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\002"
+	.string	""
+	.string	"fread"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\002"
+	.string	""
+	.string	"fopen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.8e330fe800d5633a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
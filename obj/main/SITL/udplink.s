@@ -0,0 +1,498 @@
+	.file	"udplink.c"
+	.section	.gnu.lto_.profile.6db34777c97e9802,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.6db34777c97e9802,"e",@progbits
+	.string	"(\265/\375 \177\245\002"
+	.string	"\224\003s"
+	.string	"\003"
+	.string	"\276\245\340\344\001\026\002"
+	.string	"\001\002\002\001\002\003"
+	.string	"\002\001\002\004"
+	.string	"\001\307\323\215\314\006\002\305\213\272\360\001\026\002\005\002\006\007\004\002\004\006\002\006\002\007\002\007\002\004\002\004"
+	.string	"\013"
+	.string	"J\311\200{\273\211\225"
+	.string	"\340\220\314\306\177j\r\262\356\212\345n\337"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.ipa_sra.6db34777c97e9802,"e",@progbits
+	.string	"(\265/\375 \2505\002"
+	.string	"\360\234"
+	.string	"\003"
+	.string	"\004"
+	.string	"\003"
+	.string	""
+	.string	"\001\001\201\001\001\002\001"
+	.string	"\001"
+	.string	"\001\003"
+	.string	"\005\003\006\002\002\004\005\001\022"
+	.string	"9\t\200\213Qq\270\004"
+	.ascii	"\t@\233\025\004`a\251\201\246\002\350<\f,^\231\221r\003\330\320"
+	.ascii	"i\025\320\311\006\260"
+	.text
+	.section	.gnu.lto_.inline.6db34777c97e9802,"e",@progbits
+	.string	"(\265/\375`8\001\375\n"
+	.string	"&R<6@o\222\016\031\217\021C\r"
+	.string	"d\304\353V\334\020\370\007\037;\353\243>\206\3135\262`l(\036n\264\231\007\202\341\271\206\t\013\033\006\321\353\377\376\266u\263\204\310\235\002/"
+	.string	"/"
+	.string	"*"
+	.string	"[U/&\222\316oN\205j1y6\277\246\350~\254\270)\266\b\202\232\222\026,MK\356G\006\013k\t\257q\344,R\023(\004ow?\001\203Nn\354\0012\217\205\334\306\312\345!s\261\213\031\264$\203\303\004/\352\375\356\273\357\240\024,\02518\346\242w\301\300!\007\363q\202\321{\003\250\320LA\254>x\321\267\376"
+	.string	",\204\b\315\314\264\276!3\035vwL\350HfrF\267\307\302\037;\017\007\235\360\367\034\320)\3438\216\332\205\357'z?\355\267m\326\336\252\222\231\331\325D:$4\256\037u%\"\305C\340:+:\f\301\254$7\262\262\226\\\346. P\242b\346\370\033\t0\023\f\017\226\334[\021\f\034\036WP\227\322\263W\303\225\367\262\2730\343R\006\257\026\310\0365\373\200\223@{;#\354\375Qe\2064\\\002\311\211\244\201^&\204\001\036\220l\3259\001\\\3004"
+	.ascii	"@\303\260\b\353@\026\001u \213\343\263C\030f\371\005\027\300"
+	.ascii	"uk\245\001\221\207\201\035\272\352\272\242\f\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.6db34777c97e9802,"e",@progbits
+	.string	"(\265/\375`\335\001\345\b"
+	.string	"2\214#(\200)I\0073Bm\206\b\351~\2261\305\030]~o\201\245[SI&\244\017\021$\204\333\332\377\004\355\033\301\233\310$\003\374A\341`Q\200\265\326Z8\216\2630\343\306s\240\317\031\224@/\351J\237\2701\231\243g\177\246\222N\320\3575?zY~n2\333\341\033\356d\264\275"
+	.string	"A\006\233\225\267RS\"5\227\274\262h\255\031\221\020\254\374\254T\224\023RoEzE\352\274\2229x\333\303\355\231L\001=\244w\364\356\275\376\215\210\205\b? \220\302\302\242\007\330\r\340\033\0303\376\3032\r\214P\303`\261\322\035\204R\354b;\271\271\260\312Ik\310!TH\2078\233\340\005\0011bgn+p\366\f\351\005\210r\023\243\007\3025!\n@\220 $\360\326.\302\327\002\023Q\334\007tZc\020\301/p%\223\bI"
+	.string	"\347\272\030\233,'% \224\033_\330\220\003\310\300vA\302\246C\302-\354q\007N\221l\0301\261{"
+	.ascii	"\033\264Dj\262\302\215ak\266\262&\205r\003"
+	.text
+	.section	.gnu.lto_.pureconst.6db34777c97e9802,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\232\004\001\231\004\002\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.6db34777c97e9802,"e",@progbits
+	.string	"(\265/\375 \243\325\002"
+	.string	"\222D\017\031\2405\351\377\347\302\340A1[GU\364\fLDk\355'\2042\311D\356\024'\n\203\240\371\333\262V{{\300\340\335Q\360\256\004S:K`K\300\\\021\265o\333\212\366@\373\034\374M\013"
+	.string	";5\0211\231\025F\200\350\226\323.\255\020%\f m\346U`\333"
+	.ascii	"\340"
+	.text
+	.section	.gnu.lto_.lto.6db34777c97e9802,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_udpInit.7.6db34777c97e9802,"e",@progbits
+	.string	"(\265/\375`I\005%#"
+	.string	"\312@,\016Bp\250M:"
+	.string	"x\227\23600H\345\301\210\006\321\232\201\016\2220\016Y]A=\333\344\t\0321/\r;\327\307z[\275\233\2225S\177\311\030#\004D'\372\020h`\030=0\213\367@\322\b\331R&\031\314"
+	.string	"\271"
+	.string	"\324"
+	.ascii	"\273\347\236\270\272\335E\263EZ\321p\300\202\366V\253\217\247"
+	.ascii	"\217\373\241\234P\341\274\231\256\003_\364\226Fg\252\371d\266"
+	.ascii	"\270H\265.\031\344\246\326\032\265\031x\355F\235\n\347\335\207"
+	.ascii	"\271\230\363B\034W\252\225I"
+	.string	"\0277\265\n\243VB\371q\205\345\356\356\301<\355\334-~\320A\241 \031+\303\250\326j2\270\001\362#}\001\362c;\371\3712G\216\264\371\334'\001\275^\376\313\3549:\025\207\017\035\250 \332I\032\341\355\215\242\035p\214\032(\243\362;\361L\006\024\3431\310)m`D\211\232\0350\214*\360\223g\213\016\250\203\233N5\2513\334\001\301h\2123\265\023\357\204\305\207\031sNC\255u\371\007\374\361E\372\356\222\355\256\215\335\361B\277\2639\324\251\252\370\277]\272S\026\254f\355\325\216\266\310\031\322}\266R\177\267\030\272\205\261\243}\357\362\016g\213e\255\325\302\376\215\n\027\002\320j\255\227\202\203\374\310x~p:V:\233\363\267H\356\302\220\301\377\275\257\245\270G\254\275\026\352\304+\021\223\004\323\020}q\334\256\020\214\373l\367\2646\223\335\222\327A\363:}\355o:\231?\301\315\374L\027\376\004H\336"
+	.string	"\315\253k\336\244\346E\312\361\226$/\331\274c\363\322\346\355\346\345\346\375\203O\031\262\231\261\202\244\331\204\265,\356Q\3353\302\251r4\377\356\367j\276fW\267\276\247\331\036\003\027L\253\265\352|\273\272\217\017\377\225]`G\222Foa\334\343\017\360\021\275A6\365\307\304%"
+	.string	"\363B[,y\f\242\240\232\021\007\275{\252\235\320)fP\225 \030[\032\270\005\354\324\3735\033:\220\3779\350\257y\351V\204\207\241\267\260\366\332\216\213K\320N\275<f\306\007A\356z8\033\210][ "
+	.string	"\030\2160B\204\200\001|\355\220O\017\320\273\"F\234\370\247$\377r\262\003\364\262\230\026\260\367\331\332\241\355\2228\237\022\037\227\310\356\341\234\237\020\246\336=q=]%"
+	.ascii	">\177\202jF\276h\323q\355l\221\005\214\2154\240v\323\346!\240"
+	.ascii	"3@\3008n\227\370\351Q\347\336M\261\202\377\353f \326^;g\213M"
+	.ascii	"m\020\332\270\333--\250\026F\211\351Y\220Os\342\312i)A)\001"
+	.string	"\373BJ\213\252k\213\307U\243\205\271\305u\325\302\364a\271\210\242\341\303\272\212\021E\301\002\013\013\027h\230<+_\214*\254+\263\267\3453\245xXY\335\343\315\350\361Jl]\225\\\275,-\332\263\262\242\242t\253\244``]\305\320\262\362\231!L\200(ar\361\\\364\250\270L\254+*\031fUo\313\224r\332,-^\317\344\312\312\352\231:\341\327im&\233#\243\222{:\2126cmH)\352&\312X\033\316\241k\262\335\325\365j\370j\260\255K\246\336\326\312>{7Z\373\361&\227\324\275\241\033\024\0178\013\222l\244'g\024\376/\211\321\026wmLH\255\300\211\2270_\034w'e?\332\310.\222\251\277\306e((\214\035\021\031\313)OtVQ\200\266\347\225#:\263,\265\035\332\321\342\017\356\0017q9\275pb\250a,\246\020c\n\221\004\024\314HA\222tp\"\021\203E\017\021"
+	.ascii	"2\032\273\205\264g\237\336\304\177D\305\264\024\265(#\221\002"
+	.ascii	"\270\301\036\016\273\265\b\024\025\203R\205\303C~2\351\004\341"
+	.ascii	"\270\261\331!h\373F\340\355\363\036B\373U\035:\005?\"\310\374"
+	.ascii	"f\206\016#\232\257\226a^\021%)\030\037\303e\335\247\232\013}"
+	.ascii	"\030\201\232\230\332\013h'\306%\177\270\366 \204M\346Z\242!w"
+	.ascii	"l%t\207I\337\310pHFF\224\335\310\216K\223;\361I<i\261\343\250"
+	.ascii	"\036\362\214t:lut ;\337\345\351\204\245/\310j\312O<\202\341\261"
+	.ascii	":\375\335W(\001\375\037\t\314\321m\2477\302\317\365\224\234\267"
+	.ascii	"t\tH\3505\007\320YV\322\243T\220\314\233\b\333\367*"
+	.text
+	.section	.gnu.lto_udpSend.8.6db34777c97e9802,"e",@progbits
+	.string	"(\265/\375`\355"
+	.string	"=\f"
+	.string	"V\326PA\020S\233\016?\036"
+	.string	"\b\3044\261\016\274\231\237\001\305Ip\004\024\300dBD\024M\002\n\001\260o\367:\250\236\334z\363\233q\267\005@\006\214\2012$\243\374&Hv\200$|\354\217o\335\310\2262\245<"
+	.string	"="
+	.string	"@"
+	.string	"V`9\345\317b\333_q\026\235\215\022\341\003<a#\344\304cw\243\346\003\252S\360\002\252SZ\342\335\263\363\177\272\201\323\016O\244\364\264 \354\256\323\023\tq\353m\037\260\355\300~\207\351\313O~\353&\177\365\357\207UZ\251t\302\364A\362\306s\350\330\005\261\322cqP4R\330\356l\214m=\331\240\322 M\254Rc\301\323~\311[t\377H\017\260;\242b\306\356\227 Zi\252\355\311\362\236*\334\021Z\262\375\271\f\243dH\b\244\244fL\224<\206\206\007)\236\r:\f\315\262\273\f^d\270p\027$(H\325\251\253\345\303\023a\312\025\373+\245\222\260\017WGl*\030\207l\004/\356\352@h\316\346\023\312,\210:\030\342\204\n\022(D\016\363l\027\027C\331\005\212\234m\0247\005\254\211\260-r\232\266E\314\267\267/\2521\251\007\253^\364!?2\t\340XuEp+\033"
+	.string	"_\211\"34\030Ae\261\320\207(\250\302Ju\361T\251\265j\335s\223\314\326"
+	.ascii	"\355=zk\271\220\333\332\f\362\214\345@\025\202\313\300\b\b7\250"
+	.ascii	"\032p\017\f\023\250\310\340D\217j\245#L2"
+	.text
+	.section	.gnu.lto_udpRecv.9.6db34777c97e9802,"e",@progbits
+	.string	"(\265/\375`\217\005-$"
+	.string	"JA4\016H\200\332Q:;\234dH\204\304f\020X\217\"3\226o\370pOexH\372\345\315=\265\312\230p\253Z5\332\314\303\211\376\211]\331f\372\347g\356S\3252sOxx\325"
+	.string	"g(\320fQY\022\360\277\344\023\262\345N2\320"
+	.string	"\303"
+	.string	"\315"
+	.ascii	"C\252k\3030\315\252F\244?\177w\357A\277\240R\251\252T\n\030"
+	.string	"\2523\367\212\201\360\342&\220\215\345=>@z)\025\374d\016\251\255g\316\260\273k\343\212\252\250\241\320X\233P\271\270L\025\b\257\314\337\372\023\341\227Q\347\335;DK\354\336%\003n\220\376\344e\372&W\n\231\233\032n\330\"k\305(l\356\275=\240\373\240?\355{\320\237M\204w\267\313\263\255\302\2477\364\264]\205\374\243\324S\tH3e\033!<\220\277\331\n[\254\234\374jL\327\225T!+\272s,Z 2b=m{1\023\262s\274a)$\211\234\035\313+\216\343\260\332$V\357c\271\200%`\322\276\216V\2577\243{/W\343\221\307\031wf.\302\314+\230\317\250\314\234\342f\276\237\2511#\235\354\367\262\254{o\204\237@\264,I*\325L\325\266n/lN\320tc1/\245\352\001\035\\U\334C\230\207\356u\026:\224?\350\\?\320\231\377OZ\231\300\227\377\200\264r\317\233g"
+	.ascii	"\270\312\274\264\362.\2472OZy'\255\254\203\253\234\223\253\254"
+	.ascii	"\313U\316\351*\343p\225S]\345\033\2562\212\253|\346*\333\264"
+	.ascii	"r\343*\327\264\362\023\360\230\3034\246\326Z\247-\357\216\266"
+	.ascii	"7\267\3139"
+	.string	"\206\344\315\337\353\377\372\255\374cg~\031\037\013\353\232C\366z]\213\205Ff\211\202Y\310\237r*\017;\031\353\304~E\370\261\030FC*\253%\346\214\211\364gZ\345`\302[\001\032\005\027\331R\274\340o\235\256p\316C\364B\205\276+\r\3474\263\211\207\235\250Qt\235\223k]\3335D%\270\316=\355?\215\353[Z\030q,mf\024\017S\321jp\214l\235\366\213qnj\237\201\376\364\255)(\207iL&h\243\371|\262\002$\215\030\331\316\256\215\366\tV\264\262}\366Y\246\030\247\373g-\250\355\023\337\024u\027]\205\221\202\034\3266\017\377\342\363\311\252j\265_$ydljyn\242o\002\335Wa\230L\206\314\342\\\270\231\336{#\360\317@\034\245F\242\320\237\357\223\235\327\245\225t\2625U\333\316\306b\007?z\250Oce\034G\353\022c\243\272\271\275\367^\333X\037B\001\364P\017"
+	.ascii	"#&\207\265\215\371>4JGG\rLj\3212\202\225\351\007\243\203\277"
+	.ascii	"\247\006.\035\005\241\232~KJ\301\334\257\206\022\320\372\202"
+	.ascii	"\276$k\031\211\350\005\223\022\f\247$"
+	.string	"\250\236\207\022\033H\364\202?\027O\276`\217I\311\267\324Cz\002\366\210\202\270\311\351\367\324\01365=\365t\313\373\036\302NI\266nB\034v\234\241D\357\351i6\232\352!C}\001\255\304\260\367\n)\372\330\177\206+\345\265P\037\254\030'\210\212\360I\312\323\n\036\324@\275kf\013\027\352\215\274\266\327GK\255\341\246\216Z\201\254]\353\254mM\245qq(Y\314\030\316\226!=S\215\247\321*d\026c\217\335\241\320\177\035A\216 I\245\032\003hp\304n\215\265\340;}%?\365e\017\353p3\347\177@_v\262\020F\235f\026A\242\336\270\3236v\250q,\245\020BF\241\nh\204$\205Ikp\002\021\2722\036\020pY\2234\006_\250D\205\031\267S\373\016\213;\202\353(\301_8\221Z\2033\357\365\020\214\237\002\344$\200\221\321\t\256\254Tzg\312\016\272\300\316v o\347Bg\326s"
+	.string	"\350\262e\241t-\270V\261\3615\303\034\004\301\351\301\031"
+	.string	"H\242\017\322g\327\034\345\272\232\212S\273\352\006\261r\305\317\314\212\006\217\376|\270\214"
+	.ascii	"e\204S\327F\301\356\003^x\315\322HJ33\200\006.\022\250 \355\310"
+	.ascii	"Q\322\200Dtb;\205(-&\026\0310\n\322\214\215\204\253-x\b|\307"
+	.ascii	"\"\334\021$\006\322\2040\355\274^\370\020\3104\300\375\212\306"
+	.ascii	"\375\321\030\r\2416a=\\F\320\227,4\020x\360)\r\204|k\202\312"
+	.ascii	"\326aKI\360\250\230A{\334\354H\f\377\253O0JM\002\024bb\346\017"
+	.text
+	.section	.gnu.lto_.symbol_nodes.6db34777c97e9802,"e",@progbits
+	.string	"(\265/\375`\320"
+	.string	"]\006"
+	.string	"\204\t\314\001"
+	.string	""
+	.string	""
+	.string	"\002\007\177\026\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\b\177\027\t\177\030\220\302\215\036\001\017\177\031\377\037"
+	.string	""
+	.string	"\200\200\200\001\016\177\032\020\177\033\r\177\034\f\177\035\013\177\036\n\177\037\022\177 \024\177!\023\177\"\003"
+	.string	"\tD\003"
+	.string	"\b\231\324\265\372\003\001\244\001\003"
+	.string	"\007\344\304\006\003"
+	.string	"\006\007\003"
+	.string	"\005\244\n\003"
+	.string	"\004\374\221\344\216\002\001\244\013\003"
+	.string	"\003\350\222\217\247\001\001\244\016\003\001\nd\003\002\f\210\341\206\017\001\344\013\003\002\013\320\375\346\035\001\204\017"
+	.string	"\025"
+	.ascii	"ka\f02\310\n6\353\032\365j\r\016\324\016\200\016\200\016\200"
+	.ascii	"\016\200\016\200\016\200\016\200\316\007r\203\227\376\024\f\227"
+	.ascii	"=\251\272\r~\270\326\034\003"
+	.text
+	.section	.gnu.lto_.refs.6db34777c97e9802,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.6db34777c97e9802,"e",@progbits
+	.string	"(\265/\375`n\030%w"
+	.ascii	"\352\310D,Q0R\312I\007\366{\256\276\357\272\237z\376\373\230"
+	.ascii	"\317\357\330\311:f\025\231\025mu\027\377gf=w\377\177\217S\276"
+	.ascii	"v\377\347l\r!\027\3016\230\370\366s<@%\001DD\021DD\021\220\331"
+	.ascii	"U\273H\266U\211T\325e\246\2572\232D\342&R\246P\002\263\002\305"
+	.ascii	"\002\177\367^\025*j\244\\\201\022\253\261\334\327\314\307`\316"
+	.ascii	"}\374%\204\262\311}\226Q\3240\243\230y\022)\"K\3559M=\217\251"
+	.ascii	"\250\013\026S\317`\352%\300\302Z\320&\233\212\004\344\013\337"
+	.ascii	"\275\315-|\307v\314\205\235\214\307=\234\243p\232\032\330\257"
+	.ascii	"\203\307;0\033\332\354\032\"m\0214\303\3436\266\202:\233\324"
+	.ascii	"\264#2|\034\307x<\307u\\\027\344\332\243?3\257\257{\233*nT\250"
+	.ascii	"P\201\026!\343\242\003\215=we\021\"\311\331\r\301R\317S*\323"
+	.ascii	"\361\025v\246`\036\316r\034\367\231\242\346m\242uV\224_m\317"
+	.ascii	"L\3529E\212\016\016r\212\364|Cm.\221\216`\023)\034;\331\n\277"
+	.ascii	"\331\346\275\227\340\3279[a7\256R\243l^'\f\320\314\274\376\356"
+	.ascii	"m\336\250\240\3411\007\344\310\332\367\250<\205\251\260\023\207"
+	.ascii	"\237\34736\373P\331\274e\3676mD\300\321\265Mi{\024\3243Nj\303"
+	.ascii	"8\351a\250\007A=\263!\300\302\035`\b\227\347DL[^\3239K)\2216"
+	.ascii	"I5\257M\002;<\333\332\n5P\177\201\312\227M\244#vT\313%\322\023"
+	.ascii	"l\"=;\031\312\317M\030\214\237\240\313$\346=\273\267I\242\003"
+	.ascii	"/\036ym\231\214\313\316Ox\354\021Pp49v\301\356\275\374d\002\346"
+	.ascii	"\275E\374\304F\360\336\"\033f\024\314(,\223+\256(\251\275\216"
+	.ascii	"zn^\200\242K\301\205\352[=\301%\322\026M6\221\252\\\"\375Y\307"
+	.ascii	"\317HJ\376\213a,\257\237\003\370\331\346g\001~\006@\375\231\346"
+	.ascii	"\347\341S@\340g\023@W\340\357\243$W\3416\177\007\375\034\002"
+	.ascii	"\222\377ov\377\341~&\341\310\3770\377{`\035\214\374\307\343b"
+	.ascii	"\327\1770\377\267\374\377\373\331\005\256\237\327\"\377\307\320"
+	.ascii	"@\344\277\003\377S\374<\344\347\255\025\177\367\374\234\365s"
+	.ascii	"\324\317\313\237k\370\231\350\347\031?\313\3709\205\237a\374"
+	.ascii	",\302\317\030\374\\\301\317:\377\237\377y\370\237\345?\340\317"
+	.ascii	"\r\374\007\372\231\201\377\307\237O\374\234\300\317\006\3747"
+	.ascii	"\341?\337\317\004\374<\300\317!\376\017\376/\363\377\207\377"
+	.ascii	"\202\377\003\377\227\360\177\201\377r\377\355\340\340\340\340"
+	.ascii	"\3378?J\343/\201\026\fg\203\311\212\001\205<\260a\241\265u6\221"
+	.ascii	"\363\222\021\033rm{\253w\244HTxOm[\310\237\234\244M\210\227\266"
+	.ascii	"\367\343\276\377\303\020HOS\252\310\250\357?\275EM\367\336\247"
+	.ascii	"\231\346m2\nq\236a\306\371E0\312\n\\4\003\346\275aub\324#R\212"
+	.ascii	"x\234\270\377\2727I\3426o\323\262\314*\271|\222\305\211D\363"
+	.ascii	"\376\030\340\226a\335e\323\312\3112o\337\346\345\253\264rza\331"
+	.ascii	"d6-\233\314\344\210\253d&\357m:\215X\236\025%yYf\345\264,c:\221"
+	.ascii	"\270\312\233\274eE?T%\323i9\307t\032\261,+rZ*\255\234H8\251\343"
+	.ascii	"B\303\261W\004\310\316\245\362.)Q\0255\215\250[6\231\027\357"
+	.ascii	"^>\273q\233\024\270\227\212\331\204W\204\003\263\031\325-\031"
+	.ascii	"\251\0251\271y\357%@\311\350\212y\225uK$\314{\221\030\375\\\245"
+	.ascii	"\t\222\315\272\253\305uI,\252\233t\343\336\002\224\356M\362\255"
+	.ascii	"\273\367&\357\275\302&\252\346\275;F,\273\224\224\356\225\272"
+	.ascii	"Q\272T\311\266\033\367\366Y\0276\247e\331\025S\247\rJY\327=j"
+	.ascii	"&\271\353\342Y5\251eI\347M\272\367r\030\265\313)\007\230\266"
+	.ascii	"UMG\226Q?\332\266U_\261\363r\215\365\032\267#4\271\035\324\333"
+	.ascii	"\300\227K\231\215\245\304\345\222\371\250\242\271\022\027\247"
+	.ascii	"\326=4\360\003\322\003\254y\f\357\302\364@\217\354\230j\002\225"
+	.ascii	"\303\220&\330\260-0\211\216\226\002\023%\344\252\355%p\352\034"
+	.ascii	"_U:\032\007vvTC\335tT/u\323\023\f\037o|7*\206S\350\254\030I\355"
+	.ascii	"\233\357)]\322\302\261\334\242\276\353T\246\016\223\242\003\320"
+	.ascii	"M}GQ\377V\352$\2336,6\2727\016vvRR\0335"
+	.string	"\022\327I5oR\250\005\207\233\340\237\212\025\252\030YZ\373F\372;\331E}C\b\346\275J\0217\234yGm\373F\037\261\363s\275<\257Q\t\352\265}C\2516\334\177.m\245\316\333FZ\206\f\216\263\2666}\203\252\362\355\3739\373\226\304\231\034\304\021A\346\316\350\253L\nU9%\r\354\207>a\223*Wgm\177\026\f\264AmLK[\006\274\031J\361\262g4\250\262\223?\002\nx\f\357q\037\327I]\324\013\330\022\340\037\203\215a1\206r\200\321\362\203\256&y\\|\367^2\374\307b\330\217\303\260\017\354\3441?{a\275\3374\357UFQc<\256;\023!n\t\207\215a\264?k\224#\256r\b\023>3\036\303]\030\357\200\033\356\315\201H\215\321\225\265)\001]\262\310\264E\233\332\217\314i\243-\252\2042=\261\022C\304\254,H\226-Kfh\22302;\320$2\274\277\300\037"
+	.string	"\224\211jBq\374\030\332\350\2017fjp\020]\3360\223`N\274-\357\300<`\342,\203\3328\272D\217x8\202\242\205\336\260\001\233\272N*\252\3743\035\353\n\263\244-j\364/ \312\250\bQk\213\026u\026^\230\021)m\321$z\221|x\223\361\241\177\260"
+	.ascii	"\317f\313\fK\224\340\373\207\033^\304di\333\201\177\006\242\211"
+	.ascii	"\365\320\266\001\345\256\\\371\370\323\352hkB\327\266\377R#\275"
+	.ascii	"\367\027\275\366c\035pw`_\302*\035\242\304\304\274\375\206eK"
+	.ascii	"VLm;\314\237\367\242\303\237\230\266\r\006\006\231\225\272\266"
+	.ascii	"\335\367\347\320\312\325\023_\333\346\373\027*{X\310\264\335"
+	.ascii	"\233\371\303\373\361:\357\t\367\005\352\357^)\2344-\316\212\254"
+	.ascii	"\313;o&i\2070\\\3326\227?\257\303\257\314\306\023\204\225\322"
+	.ascii	"R\217\271\271\367\225\271\276C\357B\334\344\330e\022J\201\333"
+	.ascii	"\333\001\302\211\303\211\005\313\373\356m\027\001\005\327S\277"
+	.ascii	"\274\356\212\332v\017o-Rtn|YZ\313?\2449\222U\246\304\211\372"
+	.ascii	"\025\352XT\335\365\032\211^R_\333\346\341\317\020R[\376\2004"
+	.ascii	"\335\333\351V\225eE\026\345\216G\227\027\2257\034\225\216\263"
+	.ascii	"T\3565j\3214\302\273K*\034\033,c\202MV\336q)\204D\270\004\377"
+	.ascii	"R\240eE\350\326\332\366\333\333\271\305Nn\254mW\231\341\221#"
+	.ascii	"\017\3113\310\334\225\231.\3653Uko\266\265v\343\261\313D\203"
+	.ascii	"\026\244\213\324\r\235\224\034\332\336n\\\005u2\025\367\266\303"
+	.ascii	"FI \216\273\266-\005P}\363]\326l\265\033f\262\257\205\223\345"
+	.ascii	"\035\330\337]J\341\214x\333\"\222\366VK\235J\226\242\374\311"
+	.ascii	"d\307G\325\266\2374\2320.M\314\r\255\317\2424a\0315\003\357\214"
+	.ascii	"\240\2305\024.v[\314\236\250\367\353\0375JNB\222\264\355\261"
+	.ascii	"7\331?\034>\035q5\235LW6\330\276\324\333#K\226t\230z\357E\357"
+	.ascii	"\255\342\322%\324\013\314\003\343\344\035\326JKb9\3326Xs\335"
+	.ascii	"\247#\245\266\335\344z\274\225\346\344\324\266\231tV\024\034"
+	.ascii	"]\031Uz\205I\020p\353\310\221V\302R"
+	.string	"\027\315c\313\362\364e3\005\245\224\347\365Vbq\200\343\023k\333I\232Kms\"$\331\266\221\374\213\b5g\020\252\316\272r\245\305\250\355\355\225\372\006\322A\336Z\327j#j\3632\361\025_\226\247\277+%\205\223\0026Y\022\330\3656\362g\210{"
+	.string	"\f{E\2064\027\352\026\306D\311U$\377a!\304\003\003\262\270\312\020\203\305J\334\321!\022ivt\210D\232\224F\320\220\f\025)\fZ}\216Ed\272\026\323U(h-\"i\376\303\302\004\320z\354\2211\363\037\026-\034\215C+R"
+	.ascii	"  \242\3431\350(\\\213H\032E\032\351\212<\006\365\314\354\350"
+	.ascii	"\b\361\300\200\214A<\032W #Q\f\"\221\304\177X\344\360\b\r\361"
+	.ascii	"\0200,\316\350\tRe\360\024\201,\fAC?k\320Q\350s4\306\2605z\212"
+	.ascii	"0|\216\305\022V\343\021\004!\037\"\341{\214C\305c\261\005\365"
+	.ascii	"\023\354\254\330q\021\203\360.^\264x\321\"\275\213\027::/vt\324"
+	.ascii	"\357\350\240+\2618\203\021\231\256\304c\021h\270\026\221D\037"
+	.ascii	"\031\351J\214@\202\365h$\002\342\251\261\366\020\r\255\310\034"
+	.ascii	"dQH\2065\347\005\020O\r\341J,\3220\256D\242\332SD\022k\254\351"
+	.ascii	"JD\372\034\203\220D\242\210\236\"\222\210Xc\025\376\207\305\332"
+	.ascii	"S\004*\"s\2202 s\210\216-\254\210\201\350h\004Z1\301\016q\307"
+	.ascii	"E\f\020\314@\362\320 \016\221\2531\006\021\351#\203H\244Y\211"
+	.ascii	"3\216F\021\204|\210\206\377A\361 \241\342P\316\032\0244\224\003"
+	.ascii	"\002((h\003\342\314P\261\306P\261\004\244Q\365\221\321Fd\037"
+	.ascii	"\215\304\031=AH\020+\221\007\tB\006 #\r\036\0314+\361?,\216\306"
+	.ascii	"\234\265x4\256\305cN\321\207\b\250\347h\314\031B\022\345\024"
+	.ascii	" \\\211Cd\0324T\234\201x4\"\325\032=\305!\273\016\005\t\331!"
+	.ascii	"\236\237\036"
+	.string	"{\013,\340\340\304\t#x\240\366\260\230q4\002\t\371\020\345\210`\002\b%\344\254\305\026\206x\326\234\243\221\207FN\317\0202\207\305\211!\037\037\036\373\205F\025\301\212;\242\004\315B\225\\7\314\274\320e\037\017\243e\02256\313\361\345\t\211[_\231\331\0056w\272 \255\351\020G\0046\305\303\310]M\235\330\240VW\036\f*`\\~\027\204\026\037p\177E~\320\032\244\022\206\b\021\0230SmQ (\020tk\230| H\2302\177W\nJ\310\321-T\353\214\213\237\230V\220\263\277\275\266h\020\266\362\221$\004\211\372TK\352Rh\026\033\255\271\t\212\330\262\013KB\261\216feq\245\361\265E\257\376\264{\356\031i\213Z\241\314\2779\255\300\265E\177\240\314!i@\210\264E\251P\246pk\260\313\236\217\252\024\207\335Y\236\217*2\261)\335\003D\327Z`\027\264\007\017((Lg\302\036\206"
+	.string	"2\331\201N\245_?\300\226\240S\re\363L\343\222\263R\217\364\243Hh\024\n_w`_\"\306\274\212D\3518\032\025\342-K\025\035mQ\250?m\236_\331Z[\364\t\315\341\345\245M\314y\275\357yq\013k\213:uV\315]\201\357\250\201,\207 4\"##\"\"I\222\244\0031\005\304\030\346(u\334\022\240\2459\255\020DB\243I\312\247\220\326\312\027\200\004\242\001\225\031>\306@\272\374\021\016\203H\305.h\307\210M\230"
+	.string	"\024:\247\327|\343\350r\350\023\360:\2553j@\314\034\026\250V%\220'\361g\201\007\006C\004\266b\254\353\024u\361\250\306\200\332\334\0213>5\353\251\n\3205>\267\354\3303\360\005X\003\n\246<\223sD\305\251"
+	.ascii	"\007\203\240-.E\343\235'~j\240\337\214^\007A\235\222<\327\345"
+	.ascii	"\020\263\360\"\320\365fOJ4\037\271\311\251i\202\264?'\210\321"
+	.ascii	"\2529\273^\020:\231\013C:\356\307\202\374s\220*\2134~\221B+6"
+	.ascii	"\325\b<\233Bg\030\330. \241\035\362\024\361\350]$}\302\214\224"
+	.ascii	">\335S\316\303\364pTo\036AuT\02057\325\357\001\312\f\362\020"
+	.ascii	"^\302\r*[\277\311,@\202\211\020\371A\247\244&0\205L\t\2070%\330"
+	.ascii	"W\233\301\375\3652\200:\276\367\322t\006\027\316R\354\241\007"
+	.ascii	"\240\273?h^\302\002\242R'b9\241][j\243WjQ\\\270\340)\274I:\252"
+	.ascii	"E\211~\005h\244\003\016$J\023D\354K)\005\267\2412\226f\026y\350"
+	.ascii	"\312\371H\t\330\325\327\200\304\317\t\251\020\375\243\353\307"
+	.ascii	"Y\302T\316\021|\262\202\004\002\302\322\263h\266$y\311\036\317"
+	.ascii	"\313]\325~\351\315\020\f^\221Br8<]\007\026\246;@u\241\340\255"
+	.ascii	"\226\374\364\016x\024\004\035\261\333\006\2730\227kiC\232\333"
+	.ascii	"\201\367\207\346\245\243\303D\371w\f\234\025\210NJ\003l\nl\237"
+	.ascii	"\336\241\353\275\301:\206e\262\343\337\024sN\347\003&#n\340N"
+	.ascii	"\313\355\310\257\204\0263\340\207\310\266\241\025gqZ\362\332"
+	.ascii	"\265m\346\336\334\340\314<\244\255|\367\177`\2166\202\270\003"
+	.ascii	"`E\007\262\346K\2159.\252\363Y]\250\200\300\352k\230\257\301"
+	.ascii	"\244\004\200\006C_\211\314\025\216j\375\352\264e\327\207\337"
+	.ascii	"\r\202\026_\331\310\211J\360O\324W\373\240C;TGen\300/\305U\210"
+	.ascii	"t_@b\215?Mf\244\234\312\266y\f\205\020\231\336\275\340Z\205y"
+	.ascii	"<\371\240\030RO\246\323\030\254\006\002/\025\030\251\204\224"
+	.ascii	"\344\335\214\361dp\222F\0017CF\t\304\352\322\372m\320\323\033"
+	.ascii	"g\242\347\373\277\312!\003\036\024\301\n_\356\212\230\311\320"
+	.ascii	"+@\352\274\347\207\b\3460>\222\256\347\034\345\271\211\033"
+	.string	",a>\245r\230#\261m\001QT0\0337s\260\031@\r\230\203\357\023\262\236 h\322\023\335\235x~\350\270\342\315\\\302mf\221\027\254\f2\265\2102\325\372\030\370\231\203Ul_\331\215\035ly2\335\274\004\374\367\362\222\"\370\3440\024\207\211\017\214/\367\270\026\311\216y\315\301\031H\302\3213\021I\254\327\275m\273\311?\001\t\250\201\364\277A\3041\207\030x\332`D\020\005y\347\202\221\305\002y\307\313\003\217\371mw`\362\350m< \334\032\\\215\235 gD\237\203h\350\250\301\0226\006\2600&N\371\223\257\310\232\252L\rl\212\246u \257\035\231\255\310*6\320\306\215FlQeS\376\222\232(?\035A8\006\354\252\302\256\242\313\375\351\202;\035\006?%\"\312\355\037\n\020\3074\221\376\307\3346\340\307!\2670\307Pp\r\356L`\236\364N\230\342Ix\226\366L\257\007\307\033\377\264\342\177"
+	.ascii	"n\326\222\003\233\223\273#\375\215\306#\347\037\335\272\263\372"
+	.ascii	"%\327\230\371~\374\217\024G\024\271\261\306\005\371\027\331("
+	.ascii	"\202M\313\017\200\017\362\001\337\016\362\027^\210l\353\007\346"
+	.ascii	"*"
+	.text
+	.section	.gnu.lto_.symtab.6db34777c97e9802,"e",@progbits
+	.string	"udpInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\001"
+	.string	""
+	.string	"udpSend"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\001"
+	.string	""
+	.string	"udpRecv"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\001"
+	.string	""
+	.string	"bind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\001"
+	.string	""
+	.string	"inet_addr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\001"
+	.string	""
+	.string	"fcntl"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\001"
+	.string	""
+	.string	"setsockopt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"socket"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\001"
+	.string	""
+	.string	"sendto"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\001"
+	.string	""
+	.string	"recvfrom"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"select"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.6db34777c97e9802,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -49,5 +49,7 @@ const char * const debugModeNames[DEBUG_COUNT] = {
     "ALTITUDE",
     "FFT",
     "FFT_TIME",
-    "FFT_FREQ"
+    "FFT_FREQ",
+    "DSHOT_TELEMETRY",
+    "RPM_FILTER"
 };
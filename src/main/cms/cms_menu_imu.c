@@ -40,6 +40,7 @@
 
 #include "fc/config.h"
 #include "fc/controlrate_profile.h"
+#include "fc/fc_rc.h"
 #include "fc/rc_controls.h"
 #include "fc/runtime_config.h"
 
@@ -185,6 +186,7 @@ static long cmsx_RateProfileWriteback(const OSD_Entry *self)
     UNUSED(self);
 
     memcpy(controlRateProfilesMutable(rateProfileIndex), &rateProfile, sizeof(controlRateConfig_t));
+    generateRateCurves();
 
     return 0;
 }
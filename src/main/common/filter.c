@@ -144,6 +144,25 @@ void biquadFilterUpdate(biquadFilter_t *filter, float filterFreq, uint32_t refre
     filter->y2 = y2;
 }
 
+void biquadFilterUpdateLPF(biquadFilter_t *filter, float filterFreq, uint32_t refreshRate)
+{
+    biquadFilterUpdate(filter, filterFreq, refreshRate, BIQUAD_Q, FILTER_LPF);
+}
+
+/* Sets notch coefficients from the sine and cosine of the centre frequency, keeps the filter state.
+   Lets callers that move many notches every loop derive sin/cos cheaply instead of using trig functions. */
+void biquadFilterUpdateNotch(biquadFilter_t *filter, float sinOmega, float cosOmega, float Q)
+{
+    const float alpha = sinOmega / (2.0f * Q);
+    const float a0r = 1.0f / (1.0f + alpha);
+
+    filter->b0 = a0r;
+    filter->b1 = -2.0f * cosOmega * a0r;
+    filter->b2 = a0r;
+    filter->a1 = filter->b1;
+    filter->a2 = (1.0f - alpha) * a0r;
+}
+
 /* Computes a biquadFilter_t filter on a sample (slightly less precise than df2 but works in dynamic mode) */
 float biquadFilterApplyDF1(biquadFilter_t *filter, float input)
 {
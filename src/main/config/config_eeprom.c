@@ -47,12 +47,17 @@ static uint16_t eepromConfigSize;
 typedef enum {
     CR_CLASSICATION_SYSTEM   = 0,
     CR_CLASSICATION_PROFILE_LAST = CR_CLASSICATION_SYSTEM,
+    CR_JOURNAL_COMMIT        = 0x80,    // journal entry that completes the entries of one save
 } configRecordFlags_e;
 
 #define CR_CLASSIFICATION_MASK  (0x3)
 #define CRC_START_VALUE         0xFFFF
 #define CRC_CHECK_VALUE         0x1D0F  // pre-calculated value of CRC that includes the CRC itself
 
+#define ERASED_RECORD_SIZE      0xFFFF
+// flash is programmed in words, journal entries start word aligned
+#define JOURNAL_ALIGN(size)     (((size) + 3) & ~3)
+
 // Header for the saved copy.
 typedef struct {
     uint8_t eepromConfigVersion;
@@ -78,6 +83,17 @@ typedef struct {
 } PG_PACKED configFooter_t;
 // checksum is appended just after footer. It is not included in footer to make checksum calculation consistent
 
+/*
+ * Saves only append the PGs that changed to a journal following the saved copy, instead of erasing and
+ * rewriting the whole config. A journal entry is a record as above followed by the CRC of the record,
+ * padded to the next word. The entries of a save are followed by a commit entry, entries after the last
+ * commit are from an interrupted save and are ignored. When the journal is full or damaged the config is
+ * compacted by a full write.
+ */
+static const uint8_t *journalStart;
+static const uint8_t *journalCommitted;     // end of the last committed entry
+static bool journalClean;                   // only erased flash follows journalCommitted
+
 // Used to check the compiler packing at build time.
 typedef struct {
     uint8_t byte;
@@ -95,8 +111,11 @@ void initEEPROM(void)
     BUILD_BUG_ON(sizeof(configRecord_t) != 6);
 }
 
+// Result of the last scan, cleared whenever the EEPROM is written
+STATIC_UNIT_TESTED bool eepromContentValidated = false;
+
 // Scan the EEPROM config. Returns true if the config is valid.
-bool isEEPROMContentValid(void)
+static bool scanEEPROM(void)
 {
     const uint8_t *p = &__config_start;
     const configHeader_t *header = (const configHeader_t *)p;
@@ -137,19 +156,94 @@ bool isEEPROMContentValid(void)
     // include stored CRC in the CRC calculation
     const uint16_t *storedCrc = (const uint16_t *)p;
     crc = crc16_ccitt_update(crc, storedCrc, sizeof(*storedCrc));
-    p += sizeof(storedCrc);
+    p += sizeof(*storedCrc);
 
-    eepromConfigSize = p - &__config_start;
+    journalStart = &__config_start + JOURNAL_ALIGN(p - &__config_start);
 
     // CRC has the property that if the CRC itself is included in the calculation the resulting CRC will have constant value
     return crc == CRC_CHECK_VALUE;
 }
 
+static uint16_t journalEntrySize(const configRecord_t *record)
+{
+    return JOURNAL_ALIGN(record->size + sizeof(uint16_t));
+}
+
+static bool isJournalEntryValid(const configRecord_t *record)
+{
+    const uint8_t *p = (const uint8_t *)record;
+    if (record->size < sizeof(*record) || p + journalEntrySize(record) > &__config_end) {
+        return false;
+    }
+    uint16_t storedCrc;
+    memcpy(&storedCrc, p + record->size, sizeof(storedCrc));
+    return crc16_ccitt_update(CRC_START_VALUE, record, record->size) == storedCrc;
+}
+
+static void scanJournal(void)
+{
+    const uint8_t *p = journalStart;
+    journalCommitted = p;
+    journalClean = false;
+
+    while (p + sizeof(configRecord_t) <= &__config_end) {
+        const configRecord_t *record = (const configRecord_t *)p;
+        if (record->size == ERASED_RECORD_SIZE) {
+            // end of the journal, entries after the last commit are from an interrupted save
+            journalClean = (p == journalCommitted);
+            break;
+        }
+        if (!isJournalEntryValid(record)) {
+            // interrupted write
+            break;
+        }
+        p += journalEntrySize(record);
+        if (record->flags & CR_JOURNAL_COMMIT) {
+            journalCommitted = p;
+        }
+    }
+    if (p + sizeof(configRecord_t) > &__config_end) {
+        // full
+        journalClean = (p == journalCommitted);
+    }
+
+    eepromConfigSize = journalCommitted - &__config_start;
+}
+
+bool isEEPROMContentValid(void)
+{
+    // the EEPROM only changes through writeConfigToEEPROM, a successful scan stays valid until then
+    if (!eepromContentValidated) {
+        eepromContentValidated = scanEEPROM();
+        if (eepromContentValidated) {
+            scanJournal();
+        }
+    }
+    return eepromContentValidated;
+}
+
 uint16_t getEEPROMConfigSize(void)
 {
     return eepromConfigSize;
 }
 
+static const configRecord_t *nextRecord(const configRecord_t *record)
+{
+    const uint8_t *p = (const uint8_t *)record + record->size;
+    record = (const configRecord_t *)p;
+    if (record->size == 0
+        || p + record->size >= &__config_end
+        || record->size < sizeof(*record)) {
+        return NULL;
+    }
+    return record;
+}
+
+static bool recordMatches(const configRecord_t *record, const pgRegistry_t *reg, configRecordFlags_e classification)
+{
+    return pgN(reg) == record->pgn && (record->flags & CR_CLASSIFICATION_MASK) == classification;
+}
+
 // find config record for reg + classification (profile info) in EEPROM
 // return NULL when record is not found
 // this function assumes that EEPROM content is valid
@@ -163,8 +257,7 @@ static const configRecord_t *findEEPROM(const pgRegistry_t *reg, configRecordFla
             || p + record->size >= &__config_end
             || record->size < sizeof(*record))
             break;
-        if (pgN(reg) == record->pgn
-            && (record->flags & CR_CLASSIFICATION_MASK) == classification)
+        if (recordMatches(record, reg, classification))
             return record;
         p += record->size;
     }
@@ -172,13 +265,54 @@ static const configRecord_t *findEEPROM(const pgRegistry_t *reg, configRecordFla
     return NULL;
 }
 
+// find the latest committed journal entry for reg + classification
+// return NULL when the PG was not changed since the last full write
+static const configRecord_t *findJournal(const pgRegistry_t *reg, configRecordFlags_e classification)
+{
+    const configRecord_t *found = NULL;
+    for (const uint8_t *p = journalStart; p < journalCommitted; ) {
+        const configRecord_t *record = (const configRecord_t *)p;
+        if (recordMatches(record, reg, classification)) {
+            found = record;
+        }
+        p += journalEntrySize(record);
+    }
+    return found;
+}
+
 // Initialize all PG records from EEPROM.
-// This functions processes all PGs sequentially, scanning EEPROM for each one. This is suboptimal,
-//   but each PG is loaded/initialized exactly once and in defined order.
+// Each PG is loaded/initialized exactly once and in registry order. writeSettingsToEEPROM stores the records
+//   in registry order too, so the record following the last match is tried first and a scan of the whole
+//   config is only needed for PGs that were added, removed or moved since the config was written.
 bool loadEEPROM(void)
 {
+    if (!isEEPROMContentValid()) {
+        return false;
+    }
+
+    const configRecord_t *expected = (const configRecord_t *)(&__config_start + sizeof(configHeader_t));
+    if (expected->size == 0) {
+        expected = NULL;
+    }
+
     PG_FOREACH(reg) {
-        const configRecord_t *rec = findEEPROM(reg, CR_CLASSICATION_SYSTEM);
+        const configRecord_t *rec;
+        if (expected && recordMatches(expected, reg, CR_CLASSICATION_SYSTEM)) {
+            rec = expected;
+        } else {
+            rec = findEEPROM(reg, CR_CLASSICATION_SYSTEM);
+        }
+
+        if (rec) {
+            // resynchronise with the stored order
+            expected = nextRecord(rec);
+        }
+
+        const configRecord_t *changed = findJournal(reg, CR_CLASSICATION_SYSTEM);
+        if (changed) {
+            rec = changed;
+        }
+
         if (rec) {
             // config from EEPROM is available, use it to initialize PG. pgLoad will handle version mismatch
             pgLoad(reg, rec->pg, rec->size - offsetof(configRecord_t, pg), rec->version);
@@ -194,6 +328,8 @@ static bool writeSettingsToEEPROM(void)
     config_streamer_t streamer;
     config_streamer_init(&streamer);
 
+    eepromContentValidated = false;
+
     config_streamer_start(&streamer, (uintptr_t)&__config_start, &__config_end - &__config_start);
 
     configHeader_t header = {
@@ -232,14 +368,107 @@ static bool writeSettingsToEEPROM(void)
     config_streamer_write(&streamer, (uint8_t *)&invertedBigEndianCrc, sizeof(crc));
 
     config_streamer_flush(&streamer);
+    // drop the journal, leave it erased for appending
+    config_streamer_erase_remaining(&streamer);
+
+    const bool success = config_streamer_finish(&streamer) == 0;
+
+    return success;
+}
+
+// true if the latest stored copy of the PG matches the PG in RAM
+static bool isPgStored(const pgRegistry_t *reg)
+{
+    const configRecord_t *record = findJournal(reg, CR_CLASSICATION_SYSTEM);
+    if (!record) {
+        record = findEEPROM(reg, CR_CLASSICATION_SYSTEM);
+    }
+    return record
+        && record->version == pgVersion(reg)
+        && record->size - offsetof(configRecord_t, pg) == pgSize(reg)
+        && memcmp(record->pg, reg->address, pgSize(reg)) == 0;
+}
+
+static bool isConfigStored(void)
+{
+    PG_FOREACH(reg) {
+        if (!isPgStored(reg)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void writeJournalEntry(config_streamer_t *streamer, pgn_t pgn, uint8_t version, uint8_t flags, const void *data, uint16_t size)
+{
+    static const uint8_t padding[3] = { 0 };
+
+    const configRecord_t record = {
+        .size = sizeof(configRecord_t) + size,
+        .pgn = pgn,
+        .version = version,
+        .flags = flags
+    };
+    uint16_t crc = crc16_ccitt_update(CRC_START_VALUE, &record, sizeof(record));
+    crc = crc16_ccitt_update(crc, data, size);
+
+    config_streamer_write(streamer, (const uint8_t *)&record, sizeof(record));
+    config_streamer_write(streamer, data, size);
+    // the CRC is written last, an entry cut short by power loss fails the check
+    config_streamer_write(streamer, (const uint8_t *)&crc, sizeof(crc));
+    config_streamer_write(streamer, padding, journalEntrySize(&record) - (record.size + sizeof(crc)));
+}
+
+// Appends the PGs changed since they were last stored to the journal, as one committed save.
+// Returns false when the journal has to be compacted by a full write.
+static bool writeChangesToJournal(void)
+{
+    if (!isEEPROMContentValid() || !journalClean) {
+        return false;
+    }
+
+    const configRecord_t commit = { .size = sizeof(configRecord_t) };
+    unsigned required = journalEntrySize(&commit);
+    bool changed = false;
+    PG_FOREACH(reg) {
+        if (!isPgStored(reg)) {
+            const configRecord_t record = { .size = sizeof(configRecord_t) + pgSize(reg) };
+            required += journalEntrySize(&record);
+            changed = true;
+        }
+    }
+    if (!changed) {
+        // nothing to write, saves without changes don't touch the flash
+        return true;
+    }
+    if (journalCommitted + required > &__config_end) {
+        return false;
+    }
 
+    config_streamer_t streamer;
+    config_streamer_init(&streamer);
+    config_streamer_start(&streamer, (uintptr_t)journalCommitted, &__config_end - journalCommitted);
+
+    PG_FOREACH(reg) {
+        if (!isPgStored(reg)) {
+            writeJournalEntry(&streamer, pgN(reg), pgVersion(reg), CR_CLASSICATION_SYSTEM, reg->address, pgSize(reg));
+        }
+    }
+    writeJournalEntry(&streamer, 0, 0, CR_JOURNAL_COMMIT, NULL, 0);
+
+    config_streamer_flush(&streamer);
     const bool success = config_streamer_finish(&streamer) == 0;
 
+    eepromContentValidated = false;
     return success;
 }
 
 void writeConfigToEEPROM(void)
 {
+    if (writeChangesToJournal() && isEEPROMContentValid() && isConfigStored()) {
+        return;
+    }
+
     bool success = false;
     // write it
     for (int attempt = 0; attempt < 3 && !success; attempt++) {
@@ -15,10 +15,14 @@
  * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <stdbool.h>
+#include <stdint.h>
 #include <string.h>
 
 #include "platform.h"
 
+#include "common/utils.h"
+
 #include "drivers/system.h"
 
 #include "config/config_streamer.h"
@@ -53,9 +57,6 @@ extern uint8_t __config_end;
 #  define FLASH_PAGE_SIZE                 ((uint32_t)0x8000)
 # elif defined(UNIT_TEST)
 #  define FLASH_PAGE_SIZE                 (0x400)
-// SIMULATOR
-# elif defined(SIMULATOR_BUILD)
-#  define FLASH_PAGE_SIZE                 (0x400)
 # else
 #  error "Flash page size not defined for target."
 # endif
@@ -68,7 +69,8 @@ void config_streamer_init(config_streamer_t *c)
 
 void config_streamer_start(config_streamer_t *c, uintptr_t base, int size)
 {
-    // base must start at FLASH_PAGE_SIZE boundary
+    // base must start at FLASH_PAGE_SIZE boundary, or be preceded by erased flash on the same page
+    c->base = base;
     c->address = base;
     c->size = size;
     if (!c->unlocked) {
@@ -220,40 +222,52 @@ static uint32_t getFLASHSectorForEEPROM(void)
 }
 #endif
 
+static int erase_page(uintptr_t address)
+{
+#if defined(STM32F7)
+    UNUSED(address);
+    FLASH_EraseInitTypeDef EraseInitStruct = {
+        .TypeErase     = FLASH_TYPEERASE_SECTORS,
+        .VoltageRange  = FLASH_VOLTAGE_RANGE_3, // 2.7-3.6V
+        .NbSectors     = 1
+    };
+    EraseInitStruct.Sector = getFLASHSectorForEEPROM();
+    uint32_t SECTORError;
+    const HAL_StatusTypeDef status = HAL_FLASHEx_Erase(&EraseInitStruct, &SECTORError);
+    if (status != HAL_OK) {
+        return -1;
+    }
+#else
+#if defined(STM32F4)
+    UNUSED(address);
+    const FLASH_Status status = FLASH_EraseSector(getFLASHSectorForEEPROM(), VoltageRange_3); //0x08080000 to 0x080A0000
+#else
+    const FLASH_Status status = FLASH_ErasePage(address);
+#endif
+    if (status != FLASH_COMPLETE) {
+        return -1;
+    }
+#endif
+    return 0;
+}
+
 static int write_word(config_streamer_t *c, uint32_t value)
 {
     if (c->err != 0) {
         return c->err;
     }
-#if defined(STM32F7)
     if (c->address % FLASH_PAGE_SIZE == 0) {
-        FLASH_EraseInitTypeDef EraseInitStruct = {
-            .TypeErase     = FLASH_TYPEERASE_SECTORS,
-            .VoltageRange  = FLASH_VOLTAGE_RANGE_3, // 2.7-3.6V
-            .NbSectors     = 1
-        };
-        EraseInitStruct.Sector = getFLASHSectorForEEPROM();
-        uint32_t SECTORError;
-        const HAL_StatusTypeDef status = HAL_FLASHEx_Erase(&EraseInitStruct, &SECTORError);
-        if (status != HAL_OK) {
-            return -1;
+        const int err = erase_page(c->address);
+        if (err != 0) {
+            return err;
         }
     }
+#if defined(STM32F7)
     const HAL_StatusTypeDef status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, c->address, value);
     if (status != HAL_OK) {
         return -2;
     }
 #else
-    if (c->address % FLASH_PAGE_SIZE == 0) {
-#if defined(STM32F4)
-        const FLASH_Status status = FLASH_EraseSector(getFLASHSectorForEEPROM(), VoltageRange_3); //0x08080000 to 0x080A0000
-#else
-        const FLASH_Status status = FLASH_ErasePage(c->address);
-#endif
-        if (status != FLASH_COMPLETE) {
-            return -1;
-        }
-    }
     const FLASH_Status status = FLASH_ProgramWord(c->address, value);
     if (status != FLASH_COMPLETE) {
         return -2;
@@ -291,6 +305,22 @@ int config_streamer_flush(config_streamer_t *c)
     return c-> err;
 }
 
+// Erases the pages following the write position up to the end of the area given to config_streamer_start.
+// Pages are only erased when the first word is written to them, this leaves the rest of the area ready
+// to be appended to.
+int config_streamer_erase_remaining(config_streamer_t *c)
+{
+    const uintptr_t end = c->base + c->size;
+    uintptr_t page = c->address;
+    if (page % FLASH_PAGE_SIZE != 0) {
+        page += FLASH_PAGE_SIZE - page % FLASH_PAGE_SIZE;
+    }
+    for (; page < end && c->err == 0; page += FLASH_PAGE_SIZE) {
+        c->err = erase_page(page);
+    }
+    return c->err;
+}
+
 int config_streamer_finish(config_streamer_t *c)
 {
     if (c->unlocked) {
@@ -24,6 +24,7 @@
 // needed, and updating the checksum as it goes.
 
 typedef struct config_streamer_s {
+    uintptr_t base;
     uintptr_t address;
     int size;
     union {
@@ -40,6 +41,7 @@ void config_streamer_init(config_streamer_t *c);
 void config_streamer_start(config_streamer_t *c, uintptr_t base, int size);
 int config_streamer_write(config_streamer_t *c, const uint8_t *p, uint32_t size);
 int config_streamer_flush(config_streamer_t *c);
+int config_streamer_erase_remaining(config_streamer_t *c);
 
 int config_streamer_finish(config_streamer_t *c);
 int config_streamer_status(config_streamer_t *c);
@@ -15,6 +15,7 @@
  * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <string.h>
 #include <stdint.h>
@@ -24,12 +25,53 @@
 #include "parameter_group.h"
 #include "common/maths.h"
 
+// registry positions ordered by pgn, larger registries fall back to a linear search
+#define PG_REGISTRY_INDEX_SIZE 128
+
+static uint8_t pgRegistryIndex[PG_REGISTRY_INDEX_SIZE];
+static bool pgRegistryIndexBuilt = false;
+
+static void pgBuildRegistryIndex(void)
+{
+    // insertion sort, stable so the first registration of a pgn is found first as before
+    for (int i = 0; i < PG_REGISTRY_SIZE; i++) {
+        int j = i;
+        for (; j > 0 && pgN(&__pg_registry_start[pgRegistryIndex[j - 1]]) > pgN(&__pg_registry_start[i]); j--) {
+            pgRegistryIndex[j] = pgRegistryIndex[j - 1];
+        }
+        pgRegistryIndex[j] = i;
+    }
+    pgRegistryIndexBuilt = true;
+}
+
 const pgRegistry_t* pgFind(pgn_t pgn)
 {
-    PG_FOREACH(reg) {
-        if (pgN(reg) == pgn) {
-            return reg;
+    if (PG_REGISTRY_SIZE > PG_REGISTRY_INDEX_SIZE) {
+        PG_FOREACH(reg) {
+            if (pgN(reg) == pgn) {
+                return reg;
+            }
         }
+        return NULL;
+    }
+
+    if (!pgRegistryIndexBuilt) {
+        pgBuildRegistryIndex();
+    }
+
+    // lower bound binary search
+    int low = 0;
+    int high = PG_REGISTRY_SIZE;
+    while (low < high) {
+        const int mid = (low + high) / 2;
+        if (pgN(&__pg_registry_start[pgRegistryIndex[mid]]) < pgn) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    if (low < PG_REGISTRY_SIZE && pgN(&__pg_registry_start[pgRegistryIndex[low]]) == pgn) {
+        return &__pg_registry_start[pgRegistryIndex[low]];
     }
     return NULL;
 }
@@ -0,0 +1,100 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "platform.h"
+
+#ifdef USE_DSHOT_TELEMETRY
+
+#include "drivers/dshot_telemetry.h"
+
+#define GCR_INVALID 0xff
+
+static const uint8_t gcrDecodeTable[32] = {
+    GCR_INVALID, GCR_INVALID, GCR_INVALID, GCR_INVALID, GCR_INVALID, GCR_INVALID, GCR_INVALID, GCR_INVALID,
+    GCR_INVALID, 0x9,         0xa,         0xb,         GCR_INVALID, 0xd,         0xe,         0xf,
+    GCR_INVALID, GCR_INVALID, 0x2,         0x3,         GCR_INVALID, 0x5,         0x6,         0x7,
+    GCR_INVALID, 0x0,         0x8,         0x1,         GCR_INVALID, 0x4,         0xc,         GCR_INVALID
+};
+
+/*
+ * Decodes an eRPM reply from the timer values captured on every edge of the line.
+ *
+ * Every edge marks a 1 in the 21 bit gcr stream, the run length to the next edge gives the number of bits.
+ * Nothing follows the last edge, so the final run fills up the remaining bits. Captures are taken from a
+ * timer free running to 0xffff, so differences are computed in 16 bits to cope with wrap around.
+ *
+ * Returns eRPM / 100 (the unit used by the esc sensor), or DSHOT_TELEMETRY_INVALID if the reply is damaged.
+ */
+uint16_t dshotDecodeTelemetryPacket(const uint32_t *edgeTimes, uint8_t edgeCount)
+{
+    if (edgeCount == 0) {
+        return DSHOT_TELEMETRY_INVALID;
+    }
+
+    uint32_t value = 0;
+    unsigned bits = 0;
+    for (unsigned i = 1; i <= edgeCount; i++) {
+        unsigned len;
+        if (i < edgeCount) {
+            const uint16_t diff = edgeTimes[i] - edgeTimes[i - 1];
+            len = (diff + DSHOT_TELEMETRY_BIT_TICKS / 2) / DSHOT_TELEMETRY_BIT_TICKS;
+            if (len == 0 || bits + len >= DSHOT_TELEMETRY_BITS) {
+                return DSHOT_TELEMETRY_INVALID;
+            }
+        } else {
+            len = DSHOT_TELEMETRY_BITS - bits;
+        }
+        value = (value << len) | (1 << (len - 1));
+        bits += len;
+    }
+
+    uint16_t decoded = 0;
+    for (int i = 0; i < 4; i++) {
+        const uint8_t nibble = gcrDecodeTable[(value >> (i * 5)) & 0x1f];
+        if (nibble == GCR_INVALID) {
+            return DSHOT_TELEMETRY_INVALID;
+        }
+        decoded |= nibble << (i * 4);
+    }
+
+    // xor of all nibbles including the checksum is 0xf
+    uint16_t csum = decoded ^ (decoded >> 8);
+    csum ^= csum >> 4;
+    if ((csum & 0xf) != 0xf) {
+        return DSHOT_TELEMETRY_INVALID;
+    }
+
+    // eeem mmmm mmmm, period in us = m << e
+    decoded >>= 4;
+    if (decoded == 0x0fff) {
+        // slowest representable period, motor is stopped
+        return 0;
+    }
+    const uint32_t periodUs = (decoded & 0x1ff) << (decoded >> 9);
+    if (periodUs < 10) {
+        // faster than 6M eRPM can only be a corrupt reply
+        return DSHOT_TELEMETRY_INVALID;
+    }
+
+    // eRPM / 100 = 60 * 1000000 / 100 / period, rounded
+    return (600000 + periodUs / 2) / periodUs;
+}
+
+#endif
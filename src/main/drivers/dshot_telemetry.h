@@ -0,0 +1,29 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#define DSHOT_TELEMETRY_INVALID     0xffff
+
+// the reply is sent 5/4 faster than the command, 16 timer ticks per bit at a 20 tick command bit
+#define DSHOT_TELEMETRY_BIT_TICKS   16
+// start bit + 16 bits gcr encoded into 20
+#define DSHOT_TELEMETRY_BITS        21
+// one capture per edge, a reply can't have more edges than bits
+#define DSHOT_TELEMETRY_INPUT_LEN   (DSHOT_TELEMETRY_BITS + 1)
+
+uint16_t dshotDecodeTelemetryPacket(const uint32_t *edgeTimes, uint8_t edgeCount);
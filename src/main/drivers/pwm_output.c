@@ -47,6 +47,9 @@ static uint16_t freqBeep = 0;
 
 static bool pwmMotorsEnabled = false;
 static bool isDshot = false;
+#ifdef USE_DSHOT_TELEMETRY
+bool useDshotTelemetry = false;
+#endif
 
 static void pwmOCConfig(TIM_TypeDef *tim, uint8_t channel, uint16_t value, uint8_t output)
 {
@@ -269,6 +272,9 @@ void motorDevInit(const motorDevConfig_t *motorConfig, uint16_t idlePulse, uint8
         loadDmaBuffer = &loadDmaBufferDshot;
         pwmCompleteWrite = &pwmCompleteDshotMotorUpdate;
         isDshot = true;
+#ifdef USE_DSHOT_TELEMETRY
+        useDshotTelemetry = motorConfig->useDshotTelemetry;
+#endif
         break;
 #endif
     }
@@ -294,10 +300,18 @@ void motorDevInit(const motorDevConfig_t *motorConfig, uint16_t idlePulse, uint8
 
 #ifdef USE_DSHOT
         if (isDshot) {
+            uint8_t output = motorConfig->motorPwmInversion ? timerHardware->output ^ TIMER_OUTPUT_INVERTED : timerHardware->output;
+#ifdef USE_DSHOT_TELEMETRY
+            // bidirectional dshot idles high so the ESC can drive the reply on the same line,
+            // an N channel output cannot capture the reply and its ESC gets plain dshot
+            if (useDshotTelemetry && !(timerHardware->output & TIMER_OUTPUT_N_CHANNEL)) {
+                output ^= TIMER_OUTPUT_INVERTED;
+            }
+#endif
             pwmDshotMotorHardwareConfig(timerHardware, 
                 motorIndex, 
                 motorConfig->motorPwmProtocol,
-                motorConfig->motorPwmInversion ? timerHardware->output ^ TIMER_OUTPUT_INVERTED : timerHardware->output);
+                output);
             motors[motorIndex].enabled = true;
             continue;
         }
@@ -414,6 +428,12 @@ uint16_t prepareDshotPacket(motorDmaOutput_t *const motor, const uint16_t value)
         csum ^=  csum_data;   // xor data by nibbles
         csum_data >>= 4;
     }
+#ifdef USE_DSHOT_TELEMETRY
+    // an inverted checksum asks the ESC for an eRPM reply on the signal line
+    if (motor->telemetryEnabled) {
+        csum = ~csum;
+    }
+#endif
     csum &= 0xf;
     // append checksum
     packet = (packet << 4) | csum;
@@ -19,6 +19,7 @@
 
 #include "platform.h"
 
+#include "drivers/dshot_telemetry.h"
 #include "drivers/io_types.h"
 #include "drivers/pwm_output_counts.h"
 #include "drivers/timer.h"
@@ -115,6 +116,16 @@ typedef struct {
     TIM_HandleTypeDef TimHandle;
     DMA_HandleTypeDef hdma_tim;
 #endif
+#ifdef USE_DSHOT_TELEMETRY
+    bool telemetryEnabled;                  // false for outputs that cannot capture the reply
+    volatile bool isInput;
+    uint16_t dshotTelemetryValue;           // eRPM / 100 of the last valid reply
+    uint16_t dshotTelemetryErrors;
+    TIM_OCInitTypeDef ocInitStruct;
+    TIM_ICInitTypeDef icInitStruct;
+    DMA_InitTypeDef dmaInitStruct;
+    uint32_t dmaInputBuffer[DSHOT_TELEMETRY_INPUT_LEN];
+#endif
 } motorDmaOutput_t;
 
 motorDmaOutput_t *getMotorDmaOutput(uint8_t index);
@@ -142,6 +153,7 @@ typedef struct motorDevConfig_s {
     uint8_t  motorPwmProtocol;              // Pwm Protocol
     uint8_t  motorPwmInversion;             // Active-High vs Active-Low. Useful for brushed FCs converted for brushless operation
     uint8_t  useUnsyncedPwm;
+    uint8_t  useDshotTelemetry;             // Bidirectional DShot, ESC replies with eRPM after every frame
     ioTag_t  ioTags[MAX_SUPPORTED_MOTORS];
 } motorDevConfig_t;
 
@@ -174,6 +186,13 @@ void pwmDshotMotorHardwareConfig(const timerHardware_t *timerHardware, uint8_t m
 void pwmCompleteDshotMotorUpdate(uint8_t motorCount);
 #endif
 
+#ifdef USE_DSHOT_TELEMETRY
+extern bool useDshotTelemetry;
+
+void pwmStartDshotMotorUpdate(uint8_t motorCount);
+uint16_t getDshotTelemetry(uint8_t index);
+#endif
+
 #ifdef BEEPER
 void pwmWriteBeeper(bool onoffBeep);
 void pwmToggleBeeper(void);
@@ -22,6 +22,8 @@
 
 #ifdef USE_DSHOT
 
+#include "build/debug.h"
+
 #include "drivers/io.h"
 #include "timer.h"
 #if defined(STM32F4)
@@ -54,6 +56,80 @@ uint8_t getTimerIndex(TIM_TypeDef *timer)
     return dmaMotorTimerCount-1;
 }
 
+#ifdef USE_DSHOT_TELEMETRY
+static void pwmDshotSetDirectionOutput(motorDmaOutput_t * const motor, bool output)
+{
+    const timerHardware_t * const timerHardware = motor->timerHardware;
+    TIM_TypeDef *timer = timerHardware->tim;
+    DMA_Stream_TypeDef *dmaRef = timerHardware->dmaRef;
+
+    DMA_DeInit(dmaRef);
+
+    motor->isInput = !output;
+    if (output) {
+        // ARR preload is off with telemetry, the period is restored immediately
+        TIM_SetAutoreload(timer, MOTOR_BITLENGTH);
+        timerOCInit(timer, timerHardware->channel, &motor->ocInitStruct);
+        timerOCPreloadConfig(timer, timerHardware->channel, TIM_OCPreload_Enable);
+        motor->dmaInitStruct.DMA_DIR = DMA_DIR_MemoryToPeripheral;
+        motor->dmaInitStruct.DMA_Memory0BaseAddr = (uint32_t)motor->dmaBuffer;
+        motor->dmaInitStruct.DMA_BufferSize = DSHOT_DMA_BUFFER_SIZE;
+    } else {
+        // free running counter, edges are captured as timestamps
+        TIM_SetAutoreload(timer, 0xffff);
+        timerOCPreloadConfig(timer, timerHardware->channel, TIM_OCPreload_Disable);
+        TIM_ICInit(timer, &motor->icInitStruct);
+        motor->dmaInitStruct.DMA_DIR = DMA_DIR_PeripheralToMemory;
+        motor->dmaInitStruct.DMA_Memory0BaseAddr = (uint32_t)motor->dmaInputBuffer;
+        motor->dmaInitStruct.DMA_BufferSize = DSHOT_TELEMETRY_INPUT_LEN;
+    }
+
+    DMA_Init(dmaRef, &motor->dmaInitStruct);
+    // a reply never fills the input buffer, it is collected in pwmStartDshotMotorUpdate
+    DMA_ITConfig(dmaRef, DMA_IT_TC, output ? ENABLE : DISABLE);
+}
+
+/*
+ * Collects the replies to the previous frame for all motors and switches the channels back to output.
+ * Called once per motor update, before the new values are written.
+ */
+void pwmStartDshotMotorUpdate(uint8_t motorCount)
+{
+    if (!useDshotTelemetry) {
+        return;
+    }
+
+    for (int i = 0; i < motorCount; i++) {
+        motorDmaOutput_t * const motor = &dmaMotors[i];
+        if (!motor->timerHardware || !motor->timerHardware->dmaRef || !motor->isInput) {
+            continue;
+        }
+
+        DMA_Stream_TypeDef *dmaRef = motor->timerHardware->dmaRef;
+        DMA_Cmd(dmaRef, DISABLE);
+        TIM_DMACmd(motor->timerHardware->tim, motor->timerDmaSource, DISABLE);
+
+        const uint8_t edgeCount = DSHOT_TELEMETRY_INPUT_LEN - DMA_GetCurrDataCounter(dmaRef);
+        const uint16_t value = dshotDecodeTelemetryPacket(motor->dmaInputBuffer, edgeCount);
+        if (value != DSHOT_TELEMETRY_INVALID) {
+            motor->dshotTelemetryValue = value;
+        } else {
+            motor->dshotTelemetryErrors++;
+        }
+        if (i < DEBUG16_VALUE_COUNT) {
+            DEBUG_SET(DEBUG_DSHOT_TELEMETRY, i, motor->dshotTelemetryValue);
+        }
+
+        pwmDshotSetDirectionOutput(motor, true);
+    }
+}
+
+uint16_t getDshotTelemetry(uint8_t index)
+{
+    return dmaMotors[index].dshotTelemetryValue;
+}
+#endif
+
 void pwmWriteDshotInt(uint8_t index, uint16_t value)
 {
     motorDmaOutput_t *const motor = &dmaMotors[index];
@@ -62,6 +138,13 @@ void pwmWriteDshotInt(uint8_t index, uint16_t value)
         return;
     }
 
+#ifdef USE_DSHOT_TELEMETRY
+    // the reply to the last frame was not collected (e.g. dshot commands), drop it
+    if (motor->isInput) {
+        pwmDshotSetDirectionOutput(motor, true);
+    }
+#endif
+
     uint16_t packet = prepareDshotPacket(motor, value);
 
     uint8_t bufferSize = loadDmaBuffer(motor, packet);
@@ -86,6 +169,14 @@ static void motor_DMA_IRQHandler(dmaChannelDescriptor_t *descriptor)
         motorDmaOutput_t * const motor = &dmaMotors[descriptor->userParam];
         DMA_Cmd(motor->timerHardware->dmaRef, DISABLE);
         TIM_DMACmd(motor->timerHardware->tim, motor->timerDmaSource, DISABLE);
+#ifdef USE_DSHOT_TELEMETRY
+        if (motor->telemetryEnabled) {
+            pwmDshotSetDirectionOutput(motor, false);
+            DMA_SetCurrDataCounter(motor->timerHardware->dmaRef, DSHOT_TELEMETRY_INPUT_LEN);
+            DMA_Cmd(motor->timerHardware->dmaRef, ENABLE);
+            TIM_DMACmd(motor->timerHardware->tim, motor->timerDmaSource, ENABLE);
+        }
+#endif
         DMA_CLEAR_FLAG(descriptor, DMA_IT_TCIF);
     }
 }
@@ -142,9 +233,25 @@ void pwmDshotMotorHardwareConfig(const timerHardware_t *timerHardware, uint8_t m
 
     TIM_CCxCmd(timer, timerHardware->channel, TIM_CCx_Enable);
 
+#ifdef USE_DSHOT_TELEMETRY
+    // complementary outputs have no input capture, the motor is driven without telemetry
+    motor->telemetryEnabled = useDshotTelemetry && !(output & TIMER_OUTPUT_N_CHANNEL);
+    TIM_ICStructInit(&motor->icInitStruct);
+    motor->icInitStruct.TIM_Channel = timerHardware->channel;
+    motor->icInitStruct.TIM_ICPolarity = TIM_ICPolarity_BothEdge;
+    motor->icInitStruct.TIM_ICSelection = TIM_ICSelection_DirectTI;
+    motor->icInitStruct.TIM_ICPrescaler = TIM_ICPSC_DIV1;
+    motor->icInitStruct.TIM_ICFilter = 2;
+    motor->dshotTelemetryValue = 0;
+#endif
+
     if (configureTimer) {
         TIM_CtrlPWMOutputs(timer, ENABLE);
+#ifdef USE_DSHOT_TELEMETRY
+        TIM_ARRPreloadConfig(timer, useDshotTelemetry ? DISABLE : ENABLE);
+#else
         TIM_ARRPreloadConfig(timer, ENABLE);
+#endif
         TIM_Cmd(timer, ENABLE);
     }
 
@@ -191,6 +298,12 @@ void pwmDshotMotorHardwareConfig(const timerHardware_t *timerHardware, uint8_t m
 
     DMA_Init(dmaRef, &DMA_InitStructure);
     DMA_ITConfig(dmaRef, DMA_IT_TC, ENABLE);
+
+#ifdef USE_DSHOT_TELEMETRY
+    // kept to switch the channel between output and input capture
+    motor->ocInitStruct = TIM_OCInitStructure;
+    motor->dmaInitStruct = DMA_InitStructure;
+#endif
 }
 
 #endif
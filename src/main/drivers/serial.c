@@ -71,6 +71,17 @@ uint8_t serialRead(serialPort_t *instance)
     return instance->vTable->serialRead(instance);
 }
 
+void serialReadBuf(serialPort_t *instance, uint8_t *data, int count)
+{
+    if (instance->vTable->readBuf) {
+        instance->vTable->readBuf(instance, data, count);
+    } else {
+        for (uint8_t *p = data; count > 0; count--, p++) {
+            *p = serialRead(instance);
+        }
+    }
+}
+
 void serialSetBaudRate(serialPort_t *instance, uint32_t baudRate)
 {
     instance->vTable->serialSetBaudRate(instance, baudRate);
@@ -102,3 +113,17 @@ void serialEndWrite(serialPort_t *instance)
     if (instance->vTable->endWrite)
         instance->vTable->endWrite(instance);
 }
+
+// NULL when the port has no zero copy writes or not enough contiguous space, use serialWriteBuf() instead
+uint8_t *serialTxReserve(serialPort_t *instance, int count)
+{
+    if (instance->vTable->txReserve) {
+        return instance->vTable->txReserve(instance, count);
+    }
+    return NULL;
+}
+
+void serialTxCommit(serialPort_t *instance, int count)
+{
+    instance->vTable->txCommit(instance, count);
+}
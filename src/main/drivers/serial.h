@@ -105,9 +105,15 @@ struct serialPortVTable {
     void (*setMode)(serialPort_t *instance, portMode_e mode);
 
     void (*writeBuf)(serialPort_t *instance, const void *data, int count);
+    // Optional, count must not exceed the number of bytes waiting.
+    void (*readBuf)(serialPort_t *instance, void *data, int count);
     // Optional functions used to buffer large writes.
     void (*beginWrite)(serialPort_t *instance);
     void (*endWrite)(serialPort_t *instance);
+    // Optional zero copy writes, txReserve returns count contiguous free bytes of the transmit buffer or NULL,
+    // txCommit sends the first count bytes written there. Nothing else may be written in between.
+    uint8_t *(*txReserve)(serialPort_t *instance, int count);
+    void (*txCommit)(serialPort_t *instance, int count);
 };
 
 void serialWrite(serialPort_t *instance, uint8_t ch);
@@ -115,6 +121,7 @@ uint32_t serialRxBytesWaiting(const serialPort_t *instance);
 uint32_t serialTxBytesFree(const serialPort_t *instance);
 void serialWriteBuf(serialPort_t *instance, const uint8_t *data, int count);
 uint8_t serialRead(serialPort_t *instance);
+void serialReadBuf(serialPort_t *instance, uint8_t *data, int count);
 void serialSetBaudRate(serialPort_t *instance, uint32_t baudRate);
 void serialSetMode(serialPort_t *instance, portMode_e mode);
 bool isSerialTransmitBufferEmpty(const serialPort_t *instance);
@@ -125,3 +132,5 @@ uint32_t serialGetBaudRate(serialPort_t *instance);
 void serialWriteBufShim(void *instance, const uint8_t *data, int count);
 void serialBeginWrite(serialPort_t *instance);
 void serialEndWrite(serialPort_t *instance);
+uint8_t *serialTxReserve(serialPort_t *instance, int count);
+void serialTxCommit(serialPort_t *instance, int count);
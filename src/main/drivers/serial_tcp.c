@@ -24,12 +24,21 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <arpa/inet.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
 
 #include "platform.h"
 
 #include "build/build_config.h"
 
+#include "common/maths.h"
 #include "common/utils.h"
 
 #include "io/serial.h"
@@ -37,78 +46,241 @@
 
 #define BASE_PORT 5760
 
+// a full transmit ring is polled until the reactor makes room, a client that stops reading gets its data dropped
+#define TX_WAIT_POLL_US     100
+#define TX_WAIT_STALL_US    100000
+
+// ring indexes and flags are shared with the reactor thread
+#define RING_LOAD(x) __atomic_load_n(&(x), __ATOMIC_SEQ_CST)
+#define RING_STORE(x, v) __atomic_store_n(&(x), (v), __ATOMIC_SEQ_CST)
+#define FLAG_TEST_AND_CLEAR(x) __atomic_exchange_n(&(x), false, __ATOMIC_SEQ_CST)
+#define FLAG_TEST_AND_SET(x) __atomic_exchange_n(&(x), true, __ATOMIC_SEQ_CST)
+
+// the reactor's ends of the rings
+#if defined(SIMULATOR_LOCKSTEP)
+#define RX_HEAD(s) ((s)->rxReceivedHead)
+#define TX_TAIL(s) ((s)->txSentTail)
+#else
+#define RX_HEAD(s) ((s)->port.rxBufferHead)
+#define TX_TAIL(s) ((s)->port.txBufferTail)
+#endif
+
 static const struct serialPortVTable tcpVTable; // Forward
 static tcpPort_t tcpSerialPorts[SERIAL_PORT_COUNT];
 static bool tcpPortInitialized[SERIAL_PORT_COUNT];
 static bool tcpStart = false;
+static uint16_t tcpBasePort = BASE_PORT;
+static bool tcpOffline = false;
+// firmware -> reactor wakeup, for new tx data and for rx space freed while paused
+static ioHandler_t tcpKick;
+
 bool tcpIsStart(void) {
-	return tcpStart;
+    return tcpStart;
+}
+void tcpSetBasePort(uint16_t port) {
+    tcpBasePort = port;
+}
+
+// reactor thread
+
+static void tcpClose(tcpPort_t *s)
+{
+    ioReactorRemove(&s->connection);
+    close(s->connection.fd);
+    s->connection.fd = -1;
+    fprintf(stderr, "[CLS]UART%u\n", s->id + 1);
+}
+
+static void tcpReceive(tcpPort_t *s)
+{
+    while (s->connection.fd >= 0) {
+        const uint32_t head = RX_HEAD(s);
+        const uint32_t tail = RING_LOAD(s->port.rxBufferTail);
+        // one slot stays empty to tell a full ring from an empty one
+        const uint32_t space = (tail > head) ? tail - head - 1 : s->port.rxBufferSize - head - (tail == 0 ? 1 : 0);
+        if (space == 0) {
+            // the socket keeps the rest, the consumer asks for more once it has made room
+            RING_STORE(s->rxPaused, true);
+            if (RING_LOAD(s->port.rxBufferTail) == tail || !FLAG_TEST_AND_CLEAR(s->rxPaused)) {
+                return;
+            }
+            continue;
+        }
+
+        const ssize_t count = recv(s->connection.fd, (uint8_t *)&s->port.rxBuffer[head], space, 0);
+        if (count > 0) {
+            RING_STORE(RX_HEAD(s), (head + count >= s->port.rxBufferSize) ? 0 : head + count);
+        } else if (count < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            return;
+        } else if (count < 0 && errno == EINTR) {
+            continue;
+        } else {
+            tcpClose(s);
+            return;
+        }
+    }
+}
+
+static void tcpSend(tcpPort_t *s)
+{
+    while (true) {
+        const uint32_t head = RING_LOAD(s->port.txBufferHead);
+        const uint32_t tail = TX_TAIL(s);
+        if (head == tail) {
+            return;
+        }
+        const uint32_t count = (head > tail) ? head - tail : s->port.txBufferSize - tail;
+
+        ssize_t sent = count;
+        if (s->connection.fd >= 0) {
+            sent = send(s->connection.fd, (const uint8_t *)&s->port.txBuffer[tail], count, MSG_NOSIGNAL | MSG_DONTWAIT);
+            if (sent < 0) {
+                if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                    return; // EPOLLOUT continues
+                } else if (errno == EINTR) {
+                    continue;
+                }
+                tcpClose(s);
+                sent = count;
+            }
+        } // without a client the data is dropped, like on a disconnected uart
+
+        RING_STORE(TX_TAIL(s), (tail + sent >= s->port.txBufferSize) ? 0 : tail + sent);
+    }
+}
+
+static void onConnectionEvent(ioHandler_t *handler, uint32_t events)
+{
+    tcpPort_t *s = container_of(handler, tcpPort_t, connection);
+
+    if (events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) {
+        tcpReceive(s); // reads the pending data before noticing the close
+    }
+    if ((events & EPOLLOUT) && s->connection.fd >= 0) {
+        tcpSend(s);
+    }
 }
-static void onData(dyad_Event *e) {
-	tcpPort_t* s = (tcpPort_t*)(e->udata);
-	tcpDataIn(s, (uint8_t*)e->data, e->size);
+
+static void onAccept(ioHandler_t *handler, uint32_t events)
+{
+    UNUSED(events);
+    tcpPort_t *s = container_of(handler, tcpPort_t, listener);
+
+    const int fd = accept(handler->fd, NULL, NULL);
+    if (fd < 0) {
+        return;
+    }
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+    fprintf(stderr, "New connection on UART%u\n", s->id + 1);
+    if (s->connection.fd >= 0) {
+        close(fd); // one client per port
+        return;
+    }
+
+    const int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    s->connection.fd = fd;
+    s->connection.callback = onConnectionEvent;
+    RING_STORE(s->rxPaused, false);
+    // edge triggered, the handlers always read and write until the socket or the ring is exhausted
+    if (!ioReactorAdd(&s->connection, EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET)) {
+        close(fd);
+        s->connection.fd = -1;
+        return;
+    }
+    fprintf(stderr, "[NEW]UART%u\n", s->id + 1);
 }
-static void onClose(dyad_Event *e) {
-	tcpPort_t* s = (tcpPort_t*)(e->udata);
-	s->clientCount--;
-	s->conn = NULL;
-	fprintf(stderr, "[CLS]UART%u: %d,%d\n", s->id + 1, s->connected, s->clientCount);
-	if (s->clientCount == 0) {
-		s->connected = false;
-	}
+
+static void onKick(ioHandler_t *handler, uint32_t events)
+{
+    UNUSED(events);
+    ioHandlerAcknowledge(handler);
+
+    for (int id = 0; id < SERIAL_PORT_COUNT; id++) {
+        tcpPort_t *s = &tcpSerialPorts[id];
+        if (!tcpPortInitialized[id]) {
+            continue;
+        }
+        if (FLAG_TEST_AND_CLEAR(s->rxResume)) {
+            tcpReceive(s);
+        }
+        if (FLAG_TEST_AND_CLEAR(s->txPending)) {
+            tcpSend(s);
+        }
+    }
 }
-static void onAccept(dyad_Event *e) {
-	tcpPort_t* s = (tcpPort_t*)(e->udata);
-	fprintf(stderr, "New connection on UART%u, %d\n", s->id + 1, s->clientCount);
-
-	s->connected = true;
-	if (s->clientCount > 0) {
-		dyad_close(e->remote);
-		return;
-	}
-	s->clientCount++;
-	fprintf(stderr, "[NEW]UART%u: %d,%d\n", s->id + 1, s->connected, s->clientCount);
-	s->conn = e->remote;
-	dyad_setNoDelay(e->remote, 1);
-	dyad_setTimeout(e->remote, 120);
-	dyad_addListener(e->remote, DYAD_EVENT_DATA, onData, e->udata);
-	dyad_addListener(e->remote, DYAD_EVENT_CLOSE, onClose, e->udata);
+
+static bool tcpListen(tcpPort_t *s, uint16_t port)
+{
+    const int fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        return false;
+    }
+    const int one = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons(port);
+
+    s->listener.fd = fd;
+    s->listener.callback = onAccept;
+    if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0 || listen(fd, 10) != 0 || !ioReactorAdd(&s->listener, EPOLLIN)) {
+        close(fd);
+        s->listener.fd = -1;
+        return false;
+    }
+    return true;
 }
+
+// firmware thread
+
+static void tcpKickReactor(bool *flag)
+{
+    if (!tcpOffline && !FLAG_TEST_AND_SET(*flag)) {
+        ioEventSignal(&tcpKick);
+    }
+}
+
 static tcpPort_t* tcpReconfigure(tcpPort_t *s, int id)
 {
-	if (tcpPortInitialized[id]) {
-		fprintf(stderr, "port is already initialized!\n");
-		return s;
-	}
-
-    if (pthread_mutex_init(&s->txLock, NULL) != 0) {
-		fprintf(stderr, "TX mutex init failed - %d\n", errno);
-		// TODO: clean up & re-init
-		return NULL;
-	}
-    if (pthread_mutex_init(&s->rxLock, NULL) != 0) {
-		fprintf(stderr, "RX mutex init failed - %d\n", errno);
-		// TODO: clean up & re-init
-		return NULL;
-	}
-
-	tcpStart = true;
-	tcpPortInitialized[id] = true;
-
-	s->connected = false;
-	s->clientCount = 0;
-	s->id = id;
-	s->conn = NULL;
-	s->serv = dyad_newStream();
-	dyad_setNoDelay(s->serv, 1);
-	dyad_addListener(s->serv, DYAD_EVENT_ACCEPT, onAccept, s);
-
-	if (dyad_listenEx(s->serv, NULL, BASE_PORT + id + 1, 10) == 0) {
-		fprintf(stderr, "bind port %u for UART%u\n", (unsigned)BASE_PORT + id + 1, (unsigned)id + 1);
-	} else {
-		fprintf(stderr, "bind port %u for UART%u failed!!\n", (unsigned)BASE_PORT + id + 1, (unsigned)id + 1);
-	}
-	return s;
+    if (tcpPortInitialized[id]) {
+        fprintf(stderr, "port is already initialized!\n");
+        return s;
+    }
+
+    if (!tcpStart) {
+        if (!ioEventInit(&tcpKick, onKick) || !ioReactorAdd(&tcpKick, EPOLLIN)) {
+            fprintf(stderr, "TCP wakeup init failed - %d\n", errno);
+            return NULL;
+        }
+    }
+
+    tcpStart = true;
+    tcpPortInitialized[id] = true;
+
+    s->id = id;
+    s->connection.fd = -1;
+    s->rxPaused = false;
+    s->rxResume = false;
+    s->txPending = false;
+#if defined(SIMULATOR_LOCKSTEP)
+    s->txDropped = 0;
+#else
+    s->txStalled = false;
+#endif
+
+    if (tcpOffline) {
+        return s;
+    }
+    if (tcpListen(s, tcpBasePort + id + 1)) {
+        fprintf(stderr, "bind port %u for UART%u\n", (unsigned)tcpBasePort + id + 1, (unsigned)id + 1);
+    } else {
+        fprintf(stderr, "bind port %u for UART%u failed!!\n", (unsigned)tcpBasePort + id + 1, (unsigned)id + 1);
+    }
+    return s;
 }
 
 serialPort_t *serTcpOpen(int id, serialReceiveCallbackPtr rxCallback, uint32_t baudRate, portMode_e mode, portOptions_e options)
@@ -117,7 +289,7 @@ serialPort_t *serTcpOpen(int id, serialReceiveCallbackPtr rxCallback, uint32_t b
 
 #if defined(USE_UART1) || defined(USE_UART2) || defined(USE_UART3) || defined(USE_UART4) || defined(USE_UART5) || defined(USE_UART6) || defined(USE_UART7) || defined(USE_UART8)
     if (id >= 0 && id < SERIAL_PORT_COUNT) {
-	s = tcpReconfigure(&tcpSerialPorts[id], id);
+        s = tcpReconfigure(&tcpSerialPorts[id], id);
     }
 #endif
     if (!s)
@@ -128,10 +300,14 @@ serialPort_t *serTcpOpen(int id, serialReceiveCallbackPtr rxCallback, uint32_t b
     // common serial initialisation code should move to serialPort::init()
     s->port.rxBufferHead = s->port.rxBufferTail = 0;
     s->port.txBufferHead = s->port.txBufferTail = 0;
-	s->port.rxBufferSize = RX_BUFFER_SIZE;
-	s->port.txBufferSize = TX_BUFFER_SIZE;
-	s->port.rxBuffer = s->rxBuffer;
-	s->port.txBuffer = s->txBuffer;
+#if defined(SIMULATOR_LOCKSTEP)
+    s->rxReceivedHead = 0;
+    s->txSentTail = 0;
+#endif
+    s->port.rxBufferSize = RX_BUFFER_SIZE;
+    s->port.txBufferSize = TX_BUFFER_SIZE;
+    s->port.rxBuffer = s->rxBuffer;
+    s->port.txBuffer = s->txBuffer;
 
     // callback works for IRQ-based RX ONLY
     s->port.rxCallback = rxCallback;
@@ -144,116 +320,181 @@ serialPort_t *serTcpOpen(int id, serialReceiveCallbackPtr rxCallback, uint32_t b
 
 uint32_t tcpTotalRxBytesWaiting(const serialPort_t *instance)
 {
-    tcpPort_t *s = (tcpPort_t*)instance;
-    uint32_t count;
-    pthread_mutex_lock(&s->rxLock);
-    if (s->port.rxBufferHead >= s->port.rxBufferTail) {
-        count = s->port.rxBufferHead - s->port.rxBufferTail;
-    } else {
-        count = s->port.rxBufferSize + s->port.rxBufferHead - s->port.rxBufferTail;
-    }
-    pthread_mutex_unlock(&s->rxLock);
+    const uint32_t head = RING_LOAD(instance->rxBufferHead);
+    const uint32_t tail = instance->rxBufferTail;
 
-    return count;
+    if (head >= tail) {
+        return head - tail;
+    }
+    return instance->rxBufferSize + head - tail;
 }
 
 uint32_t tcpTotalTxBytesFree(const serialPort_t *instance)
 {
-    tcpPort_t *s = (tcpPort_t*)instance;
-    uint32_t bytesUsed;
+    const uint32_t head = instance->txBufferHead;
+    const uint32_t tail = RING_LOAD(instance->txBufferTail);
 
-    pthread_mutex_lock(&s->txLock);
-    if (s->port.txBufferHead >= s->port.txBufferTail) {
-        bytesUsed = s->port.txBufferHead - s->port.txBufferTail;
+    uint32_t bytesUsed;
+    if (head >= tail) {
+        bytesUsed = head - tail;
     } else {
-        bytesUsed = s->port.txBufferSize + s->port.txBufferHead - s->port.txBufferTail;
+        bytesUsed = instance->txBufferSize + head - tail;
     }
-    uint32_t bytesFree = (s->port.txBufferSize - 1) - bytesUsed;
-    pthread_mutex_unlock(&s->txLock);
-
-    return bytesFree;
+    return (instance->txBufferSize - 1) - bytesUsed;
 }
 
 bool isTcpTransmitBufferEmpty(const serialPort_t *instance)
 {
-    tcpPort_t *s = (tcpPort_t *)instance;
-    pthread_mutex_lock(&s->txLock);
-    bool isEmpty = s->port.txBufferTail == s->port.txBufferHead;
-    pthread_mutex_unlock(&s->txLock);
-    return isEmpty;
+    return RING_LOAD(instance->txBufferTail) == instance->txBufferHead;
+}
+
+static void tcpRxConsumed(tcpPort_t *s, uint32_t tail)
+{
+    RING_STORE(s->port.rxBufferTail, tail);
+    if (RING_LOAD(s->rxPaused) && FLAG_TEST_AND_CLEAR(s->rxPaused)) {
+        tcpKickReactor(&s->rxResume);
+    }
 }
 
 uint8_t tcpRead(serialPort_t *instance)
 {
-    uint8_t ch;
     tcpPort_t *s = (tcpPort_t *)instance;
-    pthread_mutex_lock(&s->rxLock);
+    const uint32_t tail = s->port.rxBufferTail;
 
-    ch = s->port.rxBuffer[s->port.rxBufferTail];
-    if (s->port.rxBufferTail + 1 >= s->port.rxBufferSize) {
-        s->port.rxBufferTail = 0;
-    } else {
-        s->port.rxBufferTail++;
-    }
-    pthread_mutex_unlock(&s->rxLock);
+    const uint8_t ch = s->port.rxBuffer[tail];
+    tcpRxConsumed(s, (tail + 1 >= s->port.rxBufferSize) ? 0 : tail + 1);
 
     return ch;
 }
 
-void tcpWrite(serialPort_t *instance, uint8_t ch)
+static void tcpReadBuf(serialPort_t *instance, void *data, int count)
 {
     tcpPort_t *s = (tcpPort_t *)instance;
-    pthread_mutex_lock(&s->txLock);
-
-    s->port.txBuffer[s->port.txBufferHead] = ch;
-    if (s->port.txBufferHead + 1 >= s->port.txBufferSize) {
-        s->port.txBufferHead = 0;
-    } else {
-        s->port.txBufferHead++;
+    uint8_t *p = data;
+    uint32_t tail = s->port.rxBufferTail;
+
+    while (count > 0) {
+        const int chunk = MIN(count, (int)(s->port.rxBufferSize - tail));
+        memcpy(p, (const uint8_t *)&s->port.rxBuffer[tail], chunk);
+        tail = (tail + chunk >= s->port.rxBufferSize) ? 0 : tail + chunk;
+        p += chunk;
+        count -= chunk;
     }
-    pthread_mutex_unlock(&s->txLock);
+    tcpRxConsumed(s, tail);
+}
 
-    tcpDataOut(s);
+// Free transmit space for at least one more byte, or 0 if the data has to be dropped.
+static uint32_t tcpTxRoom(tcpPort_t *s)
+{
+    uint32_t room = tcpTotalTxBytesFree(&s->port);
+#if !defined(SIMULATOR_LOCKSTEP)
+    if (s->txStalled && isTcpTransmitBufferEmpty(&s->port)) {
+        s->txStalled = false;
+    }
+    // the reactor makes room as the socket takes the data, without a client it discards it
+    for (uint32_t waitedUs = 0; room == 0 && !s->txStalled; waitedUs += TX_WAIT_POLL_US) {
+        if (waitedUs >= TX_WAIT_STALL_US) {
+            s->txStalled = true;
+            fprintf(stderr, "[STL]UART%u\n", s->id + 1);
+            break;
+        }
+        tcpKickReactor(&s->txPending);
+        delayMicroseconds_real(TX_WAIT_POLL_US);
+        room = tcpTotalTxBytesFree(&s->port);
+    }
+#endif
+    return room;
 }
 
-void tcpDataOut(tcpPort_t *instance)
+static void tcpWriteBuf(serialPort_t *instance, const void *data, int count)
 {
     tcpPort_t *s = (tcpPort_t *)instance;
-    if (s->conn == NULL) return;
-    pthread_mutex_lock(&s->txLock);
-
-    if (s->port.txBufferHead < s->port.txBufferTail) {
-        // send data till end of buffer
-        int chunk = s->port.txBufferSize - s->port.txBufferTail;
-        dyad_write(s->conn, (const void *)&s->port.txBuffer[s->port.txBufferTail], chunk);
-        s->port.txBufferTail = 0;
+    const uint8_t *p = data;
+    uint32_t head = s->port.txBufferHead;
+
+    while (count > 0) {
+        const uint32_t room = tcpTxRoom(s);
+        if (room == 0) {
+#if defined(SIMULATOR_LOCKSTEP)
+            // the tail only moves at tcpLockstepSync(), waiting here would never see it
+            s->txDropped += count;
+#endif
+            break;
+        }
+        const int chunk = MIN(MIN(count, (int)room), (int)(s->port.txBufferSize - head));
+        memcpy((uint8_t *)&s->port.txBuffer[head], p, chunk);
+        head = (head + chunk >= s->port.txBufferSize) ? 0 : head + chunk;
+        p += chunk;
+        count -= chunk;
+        RING_STORE(s->port.txBufferHead, head);
     }
-    int chunk = s->port.txBufferHead - s->port.txBufferTail;
-    if (chunk)
-        dyad_write(s->conn, (const void*)&s->port.txBuffer[s->port.txBufferTail], chunk);
-    s->port.txBufferTail = s->port.txBufferHead;
+    tcpKickReactor(&s->txPending);
+}
 
-    pthread_mutex_unlock(&s->txLock);
+void tcpWrite(serialPort_t *instance, uint8_t ch)
+{
+    tcpWriteBuf(instance, &ch, 1);
 }
 
-void tcpDataIn(tcpPort_t *instance, uint8_t* ch, int size)
+#if defined(SIMULATOR_LOCKSTEP)
+void tcpSetOffline(void)
 {
-    tcpPort_t *s = (tcpPort_t *)instance;
-	pthread_mutex_lock(&s->rxLock);
-
-	while (size--) {
-//		printf("%c", *ch);
-		s->port.rxBuffer[s->port.rxBufferHead] = *(ch++);
-		if (s->port.rxBufferHead + 1 >= s->port.rxBufferSize) {
-		    s->port.rxBufferHead = 0;
-		} else {
-		    s->port.rxBufferHead++;
-		}
-	}
-	pthread_mutex_unlock(&s->rxLock);
-//	printf("\n");
+    tcpOffline = true;
+}
+
+void tcpLockstepSync(tcpRxObserverPtr *observer)
+{
+    for (int id = 0; id < SERIAL_PORT_COUNT; id++) {
+        tcpPort_t *s = &tcpSerialPorts[id];
+        if (!tcpPortInitialized[id]) {
+            continue;
+        }
+        if (s->txDropped) {
+            fprintf(stderr, "[lockstep]UART%u dropped %u tx bytes\n", s->id + 1, (unsigned)s->txDropped);
+            s->txDropped = 0;
+        }
+        if (tcpOffline) {
+            s->port.txBufferTail = s->port.txBufferHead;
+            continue;
+        }
+        RING_STORE(s->port.txBufferTail, RING_LOAD(s->txSentTail));
+
+        const uint32_t head = RING_LOAD(s->rxReceivedHead);
+        uint32_t visible = s->port.rxBufferHead;
+        while (visible != head) {
+            const uint32_t end = (head > visible) ? head : s->port.rxBufferSize;
+            if (observer) {
+                observer(id, (const uint8_t *)&s->port.rxBuffer[visible], end - visible);
+            }
+            visible = (end >= s->port.rxBufferSize) ? 0 : end;
+        }
+        RING_STORE(s->port.rxBufferHead, head);
+    }
 }
 
+bool tcpRxInject(uint8_t id, const uint8_t *data, uint32_t length)
+{
+    if (id >= SERIAL_PORT_COUNT || !tcpPortInitialized[id]) {
+        return false;
+    }
+    tcpPort_t *s = &tcpSerialPorts[id];
+    if (length > (s->port.rxBufferSize - 1) - tcpTotalRxBytesWaiting(&s->port)) {
+        return false;
+    }
+
+    uint32_t head = s->port.rxBufferHead;
+    while (length > 0) {
+        const uint32_t chunk = MIN(length, s->port.rxBufferSize - head);
+        memcpy((uint8_t *)&s->port.rxBuffer[head], data, chunk);
+        head = (head + chunk >= s->port.rxBufferSize) ? 0 : head + chunk;
+        data += chunk;
+        length -= chunk;
+    }
+    s->port.rxBufferHead = head;
+    return true;
+}
+#endif
+
 static const struct serialPortVTable tcpVTable = {
         .serialWrite = tcpWrite,
         .serialTotalRxWaiting = tcpTotalRxBytesWaiting,
@@ -262,7 +503,8 @@ static const struct serialPortVTable tcpVTable = {
         .serialSetBaudRate = NULL,
         .isSerialTransmitBufferEmpty = isTcpTransmitBufferEmpty,
         .setMode = NULL,
-        .writeBuf = NULL,
+        .writeBuf = tcpWriteBuf,
+        .readBuf = tcpReadBuf,
         .beginWrite = NULL,
         .endWrite = NULL,
 };
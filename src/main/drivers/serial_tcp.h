@@ -18,33 +18,47 @@
 #pragma once
 
 #include <netinet/in.h>
-#include <pthread.h>
-#include "dyad.h"
+
+#include "target/SITL/ioreactor.h"
 
 #define RX_BUFFER_SIZE    1400
 #define TX_BUFFER_SIZE    1400
 
+// The serial buffers are single producer, single consumer rings shared without locks between the firmware and
+// the io reactor thread. The reactor receives straight into the rx ring and sends straight from the tx ring.
 typedef struct {
     serialPort_t port;
     uint8_t rxBuffer[RX_BUFFER_SIZE];
     uint8_t txBuffer[TX_BUFFER_SIZE];
 
-    dyad_Stream *serv;
-    dyad_Stream *conn;
-    pthread_mutex_t txLock;
-    pthread_mutex_t rxLock;
-    bool connected;
-    uint16_t clientCount;
+    ioHandler_t listener;
+    ioHandler_t connection; // fd is -1 without a client
+    bool rxPaused;          // rx ring full, the reactor stopped reading the socket
+    bool rxResume;          // space was freed while paused
+    bool txPending;         // data was written, the reactor has not been told yet
+#if defined(SIMULATOR_LOCKSTEP)
+    // the reactor works on these, the firmware only sees them once tcpLockstepSync() publishes them
+    uint32_t rxReceivedHead;
+    uint32_t txSentTail;
+    uint32_t txDropped;     // tx bytes that did not fit the ring, reported and cleared by tcpLockstepSync()
+#else
+    bool txStalled;         // the tx ring did not drain, writes drop instead of waiting until it is empty again
+#endif
     uint8_t id;
 } tcpPort_t;
 
 serialPort_t *serTcpOpen(int id, serialReceiveCallbackPtr rxCallback, uint32_t baudRate, portMode_e mode, portOptions_e options);
 
-// tcpPort API
-void tcpDataIn(tcpPort_t *instance, uint8_t* ch, int size);
-void tcpDataOut(tcpPort_t *instance);
-
 bool tcpIsStart(void);
-bool* tcpGetUsed(void);
-tcpPort_t* tcpGetPool(void);
+// UARTn listens on port + n
+void tcpSetBasePort(uint16_t port);
 
+#if defined(SIMULATOR_LOCKSTEP)
+// In lockstep received data and free transmit space are only published at frame boundaries, so the firmware
+// sees the same bytes at the same virtual time however the host schedules the reactor thread.
+typedef void tcpRxObserverPtr(uint8_t id, const uint8_t *data, uint32_t length);
+void tcpLockstepSync(tcpRxObserverPtr *observer); // observer gets the newly published bytes, may be NULL
+// replay: the ports don't listen, received data comes from tcpRxInject() and transmitted data is dropped
+void tcpSetOffline(void);
+bool tcpRxInject(uint8_t id, const uint8_t *data, uint32_t length);
+#endif
@@ -24,12 +24,14 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "platform.h"
 
 #include "build/build_config.h"
 #include "build/atomic.h"
 
+#include "common/maths.h"
 #include "common/utils.h"
 
 #include "drivers/dma.h"
@@ -243,28 +245,110 @@ uint8_t uartRead(serialPort_t *instance)
     return ch;
 }
 
-void uartWrite(serialPort_t *instance, uint8_t ch)
+static void uartReadBuf(serialPort_t *instance, void *data, int count)
 {
     uartPort_t *s = (uartPort_t *)instance;
-    s->port.txBuffer[s->port.txBufferHead] = ch;
-    if (s->port.txBufferHead + 1 >= s->port.txBufferSize) {
-        s->port.txBufferHead = 0;
-    } else {
-        s->port.txBufferHead++;
+    uint8_t *p = data;
+
+    // copied in up to two parts, before and after the end of the ring buffer
+    while (count > 0) {
+        int chunk;
+#ifdef STM32F4
+        if (s->rxDMAStream) {
+#else
+        if (s->rxDMAChannel) {
+#endif
+            chunk = MIN(count, (int)s->rxDMAPos);
+            memcpy(p, (const uint8_t *)&s->port.rxBuffer[s->port.rxBufferSize - s->rxDMAPos], chunk);
+            s->rxDMAPos -= chunk;
+            if (s->rxDMAPos == 0) {
+                s->rxDMAPos = s->port.rxBufferSize;
+            }
+        } else {
+            chunk = MIN(count, (int)(s->port.rxBufferSize - s->port.rxBufferTail));
+            memcpy(p, (const uint8_t *)&s->port.rxBuffer[s->port.rxBufferTail], chunk);
+            if (s->port.rxBufferTail + chunk >= s->port.rxBufferSize) {
+                s->port.rxBufferTail = 0;
+            } else {
+                s->port.rxBufferTail += chunk;
+            }
+        }
+        p += chunk;
+        count -= chunk;
     }
+}
 
+static void uartStartTx(uartPort_t *s)
+{
 #ifdef STM32F4
     if (s->txDMAStream)
 #else
     if (s->txDMAChannel)
 #endif
     {
-        uartTryStartTxDMA(s); 
+        uartTryStartTxDMA(s);
     } else {
         USART_ITConfig(s->USARTx, USART_IT_TXE, ENABLE);
     }
 }
 
+static void uartWriteBuf(serialPort_t *instance, const void *data, int count)
+{
+    uartPort_t *s = (uartPort_t *)instance;
+    const uint8_t *p = data;
+
+    while (count > 0) {
+        uint32_t bytesFree;
+        while ((bytesFree = uartTotalTxBytesFree(instance)) == 0) {
+        };
+
+        const int chunk = MIN(count, (int)MIN(bytesFree, s->port.txBufferSize - s->port.txBufferHead));
+        memcpy((uint8_t *)&s->port.txBuffer[s->port.txBufferHead], p, chunk);
+        if (s->port.txBufferHead + chunk >= s->port.txBufferSize) {
+            s->port.txBufferHead = 0;
+        } else {
+            s->port.txBufferHead += chunk;
+        }
+        uartStartTx(s);
+
+        p += chunk;
+        count -= chunk;
+    }
+}
+
+static uint8_t *uartTxReserve(serialPort_t *instance, int count)
+{
+    // the space must not wrap around the end of the ring buffer
+    if (uartTotalTxBytesFree(instance) < (uint32_t)count || instance->txBufferSize - instance->txBufferHead < (uint32_t)count) {
+        return NULL;
+    }
+    return (uint8_t *)&instance->txBuffer[instance->txBufferHead];
+}
+
+static void uartTxCommit(serialPort_t *instance, int count)
+{
+    uartPort_t *s = (uartPort_t *)instance;
+    if (s->port.txBufferHead + count >= s->port.txBufferSize) {
+        s->port.txBufferHead = 0;
+    } else {
+        s->port.txBufferHead += count;
+    }
+    uartStartTx(s);
+}
+
+void uartWrite(serialPort_t *instance, uint8_t ch)
+{
+    uartPort_t *s = (uartPort_t *)instance;
+    s->port.txBuffer[s->port.txBufferHead] = ch;
+    if (s->port.txBufferHead + 1 >= s->port.txBufferSize) {
+        s->port.txBufferHead = 0;
+    } else {
+        s->port.txBufferHead++;
+    }
+
+    uartStartTx(s);
+}
+
 const struct serialPortVTable uartVTable[] = {
     {
         .serialWrite = uartWrite,
@@ -274,9 +358,12 @@ const struct serialPortVTable uartVTable[] = {
         .serialSetBaudRate = uartSetBaudRate,
         .isSerialTransmitBufferEmpty = isUartTransmitBufferEmpty,
         .setMode = uartSetMode,
-        .writeBuf = NULL,
+        .writeBuf = uartWriteBuf,
+        .readBuf = uartReadBuf,
         .beginWrite = NULL,
         .endWrite = NULL,
+        .txReserve = uartTxReserve,
+        .txCommit = uartTxCommit,
     }
 };
 
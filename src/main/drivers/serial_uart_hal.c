@@ -27,6 +27,7 @@
 
 #include "platform.h"
 
+#include "build/atomic.h"
 #include "build/build_config.h"
 
 #include "common/utils.h"
@@ -328,6 +329,40 @@ uint8_t uartRead(serialPort_t *instance)
     return ch;
 }
 
+static void uartStartTx(uartPort_t *s)
+{
+    // must be protected, since it is also called from the receive ISR (e.g. for CRSF telemetry)
+    // and the DMA complete and TXE interrupts modify the same state
+    ATOMIC_BLOCK(NVIC_PRIO_SERIALUART_TXDMA) {
+        if (s->txDMAStream) {
+            if (!(s->txDMAStream->CR & 1))
+                uartStartTxDMA(s);
+        } else {
+            __HAL_UART_ENABLE_IT(&s->Handle, UART_IT_TXE);
+        }
+    }
+}
+
+static uint8_t *uartTxReserve(serialPort_t *instance, int count)
+{
+    // the space must not wrap around the end of the ring buffer
+    if (uartTotalTxBytesFree(instance) < (uint32_t)count || instance->txBufferSize - instance->txBufferHead < (uint32_t)count) {
+        return NULL;
+    }
+    return (uint8_t *)&instance->txBuffer[instance->txBufferHead];
+}
+
+static void uartTxCommit(serialPort_t *instance, int count)
+{
+    uartPort_t *s = (uartPort_t *)instance;
+    if (s->port.txBufferHead + count >= s->port.txBufferSize) {
+        s->port.txBufferHead = 0;
+    } else {
+        s->port.txBufferHead += count;
+    }
+    uartStartTx(s);
+}
+
 void uartWrite(serialPort_t *instance, uint8_t ch)
 {
     uartPort_t *s = (uartPort_t *)instance;
@@ -338,12 +373,7 @@ void uartWrite(serialPort_t *instance, uint8_t ch)
         s->port.txBufferHead++;
     }
 
-    if (s->txDMAStream) {
-        if (!(s->txDMAStream->CR & 1))
-            uartStartTxDMA(s);
-    } else {
-        __HAL_UART_ENABLE_IT(&s->Handle, UART_IT_TXE);
-    }
+    uartStartTx(s);
 }
 
 const struct serialPortVTable uartVTable[] = {
@@ -358,6 +388,8 @@ const struct serialPortVTable uartVTable[] = {
         .writeBuf = NULL,
         .beginWrite = NULL,
         .endWrite = NULL,
+        .txReserve = uartTxReserve,
+        .txCommit = uartTxCommit,
     }
 };
 
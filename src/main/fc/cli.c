@@ -149,7 +149,11 @@ static uint8_t cliWriteBuffer[sizeof(*cliWriter) + CLI_OUT_BUFFER_SIZE];
 static char cliBuffer[CLI_IN_BUFFER_SIZE];
 static uint32_t bufferIndex = 0;
 
-static bool configIsInCopy = false;
+static bool defaultsInCopy = false;
+
+// batch mode applies a sequence of commands, like a restored diff, without confirming each of them
+static bool cliBatchMode = false;
+static uint16_t cliBatchErrors;
 
 static const char* const emptyName = "-";
 static const char* const emptryString = "";
@@ -389,63 +393,46 @@ static bool valuePtrEqualsDefault(uint8_t type, const void *ptr, const void *ptr
     return result;
 }
 
-static uint16_t getValueOffset(const clivalue_t *value)
+// offset of a value in the given profile, whichever profile is current
+static uint16_t getDumpValueOffset(const clivalue_t *value, uint8_t profileIndex)
 {
     switch (value->type & VALUE_SECTION_MASK) {
-    case MASTER_VALUE:
-        return value->offset;
     case PROFILE_VALUE:
-        return value->offset + sizeof(pidProfile_t) * getCurrentPidProfileIndex();
+        return value->offset + sizeof(pidProfile_t) * profileIndex;
     case PROFILE_RATE_VALUE:
-        return value->offset + sizeof(controlRateConfig_t) * getCurrentControlRateProfileIndex();
+        return value->offset + sizeof(controlRateConfig_t) * profileIndex;
     }
-    return 0;
-}
-
-STATIC_UNIT_TESTED void *getValuePointer(const clivalue_t *value)
-{
-    const pgRegistry_t* rec = pgFind(value->pgn);
-    return CONST_CAST(void *, rec->address + getValueOffset(value));
+    return value->offset;
 }
 
-static void dumpPgValue(const clivalue_t *value, uint8_t dumpMask)
+static void dumpPgValue(const clivalue_t *value, uint8_t dumpMask, uint8_t profileIndex)
 {
     const pgRegistry_t *pg = pgFind(value->pgn);
-#ifdef DEBUG
     if (!pg) {
+#ifdef DEBUG
         cliPrintLinef("VALUE %s ERROR", value->name);
-        return; // if it's not found, the pgn shouldn't be in the value table!
-    }
 #endif
+        return; // not built into this target, the pgn shouldn't be in the value table!
+    }
 
     const char *format = "set %s = ";
     const char *defaultFormat = "#set %s = ";
-    const int valueOffset = getValueOffset(value);
-    const bool equalsDefault = valuePtrEqualsDefault(value->type, pg->copy + valueOffset, pg->address + valueOffset);
+    const int valueOffset = getDumpValueOffset(value, profileIndex);
+    // the copy holds the defaults while dumping
+    const bool equalsDefault = valuePtrEqualsDefault(value->type, pg->address + valueOffset, pg->copy + valueOffset);
 
     if (((dumpMask & DO_DIFF) == 0) || !equalsDefault) {
         if (dumpMask & SHOW_DEFAULTS && !equalsDefault) {
             cliPrintf(defaultFormat, value->name);
-            printValuePointer(value, (uint8_t*)pg->address + valueOffset, false);
+            printValuePointer(value, pg->copy + valueOffset, false);
             cliPrintLinefeed();
         }
         cliPrintf(format, value->name);
-        printValuePointer(value, pg->copy + valueOffset, false);
+        printValuePointer(value, (uint8_t*)pg->address + valueOffset, false);
         cliPrintLinefeed();
     }
 }
 
-static void dumpAllValues(uint16_t valueSection, uint8_t dumpMask)
-{
-    for (uint32_t i = 0; i < valueTableEntryCount; i++) {
-        const clivalue_t *value = &valueTable[i];
-        bufWriterFlush(cliWriter);
-        if ((value->type & VALUE_SECTION_MASK) == valueSection) {
-            dumpPgValue(value, dumpMask);
-        }
-    }
-}
-
 static void cliPrintVar(const clivalue_t *var, bool full)
 {
     const void *ptr = getValuePointer(var);
@@ -2220,6 +2207,8 @@ static void cliExit(char *cmdline)
     *cliBuffer = '\0';
     bufferIndex = 0;
     cliMode = 0;
+    // a batch without 'batch end' doesn't carry over to the next session
+    cliBatchMode = false;
     // incase a motor was left running during motortest, clear it here
     mixerResetDisarmedMotors();
     cliReboot();
@@ -2621,32 +2610,6 @@ static void cliRateProfile(char *cmdline)
     }
 }
 
-static void cliDumpPidProfile(uint8_t pidProfileIndex, uint8_t dumpMask)
-{
-    if (pidProfileIndex >= MAX_PROFILE_COUNT) {
-        // Faulty values
-        return;
-    }
-    changePidProfile(pidProfileIndex);
-    cliPrintHashLine("profile");
-    cliProfile("");
-    cliPrintLinefeed();
-    dumpAllValues(PROFILE_VALUE, dumpMask);
-}
-
-static void cliDumpRateProfile(uint8_t rateProfileIndex, uint8_t dumpMask)
-{
-    if (rateProfileIndex >= CONTROL_RATE_PROFILE_COUNT) {
-        // Faulty values
-        return;
-    }
-    changeControlRateProfile(rateProfileIndex);
-    cliPrintHashLine("rateprofile");
-    cliRateProfile("");
-    cliPrintLinefeed();
-    dumpAllValues(PROFILE_RATE_VALUE, dumpMask);
-}
-
 static void cliSave(char *cmdline)
 {
     UNUSED(cmdline);
@@ -2665,6 +2628,69 @@ static void cliDefaults(char *cmdline)
     cliReboot();
 }
 
+#ifdef USE_CLI_VALUE_INDEX
+// compares the first length characters of name to valueName, the order is that of strcasecmp
+static int cliCompareValueName(const char *name, uint8_t length, const char *valueName)
+{
+    const int result = strncasecmp(name, valueName, length);
+    if (result == 0 && valueName[length]) {
+        // name is a prefix of valueName
+        return -1;
+    }
+    return result;
+}
+
+STATIC_UNIT_TESTED void cliBuildValueIndex(void)
+{
+    static bool built = false;
+    if (built) {
+        return;
+    }
+
+    // insertion sort, the table is sorted once when the CLI is entered
+    for (uint16_t i = 0; i < valueTableEntryCount; i++) {
+        uint16_t j = i;
+        while (j > 0 && strcasecmp(valueTable[valueTableNameIndex[j - 1]].name, valueTable[i].name) > 0) {
+            valueTableNameIndex[j] = valueTableNameIndex[j - 1];
+            j--;
+        }
+        valueTableNameIndex[j] = i;
+    }
+    built = true;
+}
+#endif
+
+// find the value named by the first length characters of name, NULL if there is none
+STATIC_UNIT_TESTED const clivalue_t *cliFindValue(const char *name, uint8_t length)
+{
+#ifdef USE_CLI_VALUE_INDEX
+    cliBuildValueIndex();
+
+    int low = 0;
+    int high = valueTableEntryCount - 1;
+    while (low <= high) {
+        const int mid = (low + high) / 2;
+        const clivalue_t *value = &valueTable[valueTableNameIndex[mid]];
+        const int result = cliCompareValueName(name, length, value->name);
+        if (result == 0) {
+            return value;
+        } else if (result < 0) {
+            high = mid - 1;
+        } else {
+            low = mid + 1;
+        }
+    }
+#else
+    for (uint32_t i = 0; i < valueTableEntryCount; i++) {
+        const clivalue_t *value = &valueTable[i];
+        if (strncasecmp(name, value->name, strlen(value->name)) == 0 && length == strlen(value->name)) {
+            return value;
+        }
+    }
+#endif
+    return NULL;
+}
+
 STATIC_UNIT_TESTED void cliGet(char *cmdline)
 {
     const clivalue_t *val;
@@ -2732,119 +2758,135 @@ STATIC_UNIT_TESTED void cliSet(char *cmdline)
         eqptr++;
         eqptr = skipSpace(eqptr);
 
-        for (uint32_t i = 0; i < valueTableEntryCount; i++) {
-            const clivalue_t *val = &valueTable[i];
+        // ensure exact match when setting to prevent setting variables with shorter names
+        const clivalue_t *val = cliFindValue(cmdline, variableNameLength);
+        if (val) {
+
+            bool valueChanged = false;
+            int16_t value  = 0;
+            switch (val->type & VALUE_MODE_MASK) {
+                case MODE_DIRECT: {
+                    int16_t value = atoi(eqptr);
+
+                    if (value >= val->config.minmax.min && value <= val->config.minmax.max) {
+                        cliSetVar(val, value);
+                        valueChanged = true;
+                    }
+                }
 
-            // ensure exact match when setting to prevent setting variables with shorter names
-            if (strncasecmp(cmdline, val->name, strlen(val->name)) == 0 && variableNameLength == strlen(val->name)) {
+                break;
+                case MODE_LOOKUP: {
+                    const lookupTableEntry_t *tableEntry = &lookupTables[val->config.lookup.tableIndex];
+                    bool matched = false;
+                    for (uint32_t tableValueIndex = 0; tableValueIndex < tableEntry->valueCount && !matched; tableValueIndex++) {
+                        matched = strcasecmp(tableEntry->values[tableValueIndex], eqptr) == 0;
 
-                bool valueChanged = false;
-                int16_t value  = 0;
-                switch (val->type & VALUE_MODE_MASK) {
-                    case MODE_DIRECT: {
-                        int16_t value = atoi(eqptr);
+                        if (matched) {
+                            value = tableValueIndex;
 
-                        if (value >= val->config.minmax.min && value <= val->config.minmax.max) {
                             cliSetVar(val, value);
                             valueChanged = true;
                         }
                     }
+                }
 
-                    break;
-                    case MODE_LOOKUP: {
-                        const lookupTableEntry_t *tableEntry = &lookupTables[val->config.lookup.tableIndex];
-                        bool matched = false;
-                        for (uint32_t tableValueIndex = 0; tableValueIndex < tableEntry->valueCount && !matched; tableValueIndex++) {
-                            matched = strcasecmp(tableEntry->values[tableValueIndex], eqptr) == 0;
-
-                            if (matched) {
-                                value = tableValueIndex;
+                break;
+                case MODE_ARRAY: {
+                    const uint8_t arrayLength = val->config.array.length;
+                    char *valPtr = eqptr;
+
+                    for (int i = 0; i < arrayLength; i++) {
+                        // skip spaces
+                        valPtr = skipSpace(valPtr);
+                        // find next comma (or end of string)
+                        char *valEndPtr = strchr(valPtr, ',');
+
+                        // comma found or last item?
+                        if ((valEndPtr != NULL) || (i == arrayLength - 1)){
+                            // process substring [valPtr, valEndPtr[
+                            // note: no need to copy substrings for atoi()
+                            //       it stops at the first character that cannot be converted...
+                            switch (val->type & VALUE_TYPE_MASK) {
+                            default:
+                            case VAR_UINT8: {
+                                // fetch data pointer
+                                uint8_t *data = (uint8_t *)getValuePointer(val) + i;
+                                // store value
+                                *data = (uint8_t)atoi((const char*) valPtr);
+                                }
+                                break;
 
-                                cliSetVar(val, value);
-                                valueChanged = true;
-                            }
-                        }
-                    }
+                            case VAR_INT8: {
+                                // fetch data pointer
+                                int8_t *data = (int8_t *)getValuePointer(val) + i;
+                                // store value
+                                *data = (int8_t)atoi((const char*) valPtr);
+                                }
+                                break;
 
-                    break;
-                    case MODE_ARRAY: {
-                        const uint8_t arrayLength = val->config.array.length;
-                        char *valPtr = eqptr;
-
-                        for (int i = 0; i < arrayLength; i++) {
-                            // skip spaces
-                            valPtr = skipSpace(valPtr);
-                            // find next comma (or end of string)
-                            char *valEndPtr = strchr(valPtr, ',');
-
-                            // comma found or last item?
-                            if ((valEndPtr != NULL) || (i == arrayLength - 1)){
-                                // process substring [valPtr, valEndPtr[
-                                // note: no need to copy substrings for atoi()
-                                //       it stops at the first character that cannot be converted...
-                                switch (val->type & VALUE_TYPE_MASK) {
-                                default:
-                                case VAR_UINT8: {
-                                    // fetch data pointer
-                                    uint8_t *data = (uint8_t *)getValuePointer(val) + i;
-                                    // store value
-                                    *data = (uint8_t)atoi((const char*) valPtr);
-                                    }
-                                    break;
-
-                                case VAR_INT8: {
-                                    // fetch data pointer
-                                    int8_t *data = (int8_t *)getValuePointer(val) + i;
-                                    // store value
-                                    *data = (int8_t)atoi((const char*) valPtr);
-                                    }
-                                    break;
-
-                                case VAR_UINT16: {
-                                    // fetch data pointer
-                                    uint16_t *data = (uint16_t *)getValuePointer(val) + i;
-                                    // store value
-                                    *data = (uint16_t)atoi((const char*) valPtr);
-                                    }
-                                    break;
-
-                                case VAR_INT16: {
-                                    // fetch data pointer
-                                    int16_t *data = (int16_t *)getValuePointer(val) + i;
-                                    // store value
-                                    *data = (int16_t)atoi((const char*) valPtr);
-                                    }
-                                    break;
+                            case VAR_UINT16: {
+                                // fetch data pointer
+                                uint16_t *data = (uint16_t *)getValuePointer(val) + i;
+                                // store value
+                                *data = (uint16_t)atoi((const char*) valPtr);
                                 }
-                                // mark as changed
-                                valueChanged = true;
+                                break;
 
-                                // prepare to parse next item
-                                valPtr = valEndPtr + 1;
+                            case VAR_INT16: {
+                                // fetch data pointer
+                                int16_t *data = (int16_t *)getValuePointer(val) + i;
+                                // store value
+                                *data = (int16_t)atoi((const char*) valPtr);
+                                }
+                                break;
                             }
+                            // mark as changed
+                            valueChanged = true;
+
+                            // prepare to parse next item
+                            valPtr = valEndPtr + 1;
                         }
                     }
-                    break;
                 }
+                break;
+            }
 
-                if (valueChanged) {
+            if (valueChanged) {
+                if (!cliBatchMode) {
                     cliPrintf("%s set to ", val->name);
                     cliPrintVar(val, 0);
-                } else {
-                    cliPrintLine("Invalid value");
-                    cliPrintVarRange(val);
                 }
-
-                return;
+            } else {
+                cliPrintLine("Invalid value");
+                cliPrintVarRange(val);
+                cliBatchErrors++;
             }
+
+            return;
         }
         cliPrintLine("Invalid name");
+        cliBatchErrors++;
     } else {
         // no equals, check for matching variables.
         cliGet(cmdline);
     }
 }
 
+static void cliBatch(char *cmdline)
+{
+    if (strcasecmp(cmdline, "start") == 0) {
+        cliBatchMode = true;
+        cliBatchErrors = 0;
+    } else if (strcasecmp(cmdline, "end") == 0) {
+        if (cliBatchMode) {
+            cliBatchMode = false;
+            cliPrintLinef("Batch ended, %d errors", cliBatchErrors);
+        }
+    } else {
+        cliShowParseError();
+    }
+}
+
 static void cliStatus(char *cmdline)
 {
     UNUSED(cmdline);
@@ -2973,6 +3015,25 @@ static void cliTasks(char *cmdline)
 }
 #endif
 
+#ifdef USE_MSP_STATS
+static void cliMspStats(char *cmdline)
+{
+    if (strcasecmp(cmdline, "reset") == 0) {
+        mspResetCommandStats();
+        return;
+    }
+
+    cliPrintLine("MSP command    calls  max/us  avg/us  total/ms");
+    for (int cmdMSP = 0; cmdMSP < MSP_COMMAND_COUNT; cmdMSP++) {
+        const mspCommandStats_t *stats = mspGetCommandStats(cmdMSP);
+        if (stats->callCount) {
+            cliPrintLinef("%3d %14d %7d %7d %9d", cmdMSP, stats->callCount, stats->maxExecutionTime,
+                stats->totalExecutionTime / stats->callCount, stats->totalExecutionTime / 1000);
+        }
+    }
+}
+#endif
+
 static void cliVersion(char *cmdline)
 {
     UNUSED(cmdline);
@@ -3068,15 +3129,8 @@ static void printResource(uint8_t dumpMask)
     for (unsigned int i = 0; i < ARRAYLEN(resourceTable); i++) {
         const char* owner = ownerNames[resourceTable[i].owner];
         const pgRegistry_t* pg = pgFind(resourceTable[i].pgn);
-        const void *currentConfig;
-        const void *defaultConfig;
-        if (configIsInCopy) {
-            currentConfig = pg->copy;
-            defaultConfig = pg->address;
-        } else {
-            currentConfig = pg->address;
-            defaultConfig = NULL;
-        }
+        const void *currentConfig = pg->address;
+        const void *defaultConfig = defaultsInCopy ? pg->copy : NULL;
 
         for (int index = 0; index < MAX_RESOURCE_INDEX(resourceTable[i].maxIndex); index++) {
             const ioTag_t ioTag = *((const ioTag_t *)currentConfig + resourceTable[i].offset + index);
@@ -3274,57 +3328,148 @@ static void cliResource(char *cmdline)
 }
 #endif /* USE_RESOURCE_MGMT */
 
-static void backupConfigs(void)
+// load the defaults into the copies of the configs to do differencing, the active configs are left untouched
+static void loadDefaultsIntoCopies(void)
 {
-    // make copies of configs to do differencing
+#if defined(TARGET_CONFIG)
+    // the target defaults are applied to the active configs, they are swapped with the copies afterwards
     PG_FOREACH(pg) {
         memcpy(pg->copy, pg->address, pg->size);
     }
+    pgResetAll();
+    targetConfiguration();
+    PG_FOREACH(pg) {
+        for (unsigned i = 0; i < pg->size; i++) {
+            const uint8_t defaultValue = pg->address[i];
+            pg->address[i] = pg->copy[i];
+            pg->copy[i] = defaultValue;
+        }
+    }
+#else
+    PG_FOREACH(pg) {
+        pgResetCopy(pg->copy, pgN(pg));
+    }
+#endif
 
-    configIsInCopy = true;
+    defaultsInCopy = true;
 }
 
-static void restoreConfigs(void)
-{
-    PG_FOREACH(pg) {
-        memcpy(pg->address, pg->copy, pg->size);
+// dump and diff are output in steps, whenever the serial port has room for more
+typedef enum {
+    DUMP_STEP_VERSION,
+    DUMP_STEP_NAME,
+    DUMP_STEP_RESOURCES,
+    DUMP_STEP_MIXER,
+    DUMP_STEP_SERVO,
+    DUMP_STEP_FEATURE,
+    DUMP_STEP_BEEPER,
+    DUMP_STEP_MAP,
+    DUMP_STEP_SERIAL,
+    DUMP_STEP_LED,
+    DUMP_STEP_AUX,
+    DUMP_STEP_ADJRANGE,
+    DUMP_STEP_RXRANGE,
+    DUMP_STEP_VTX,
+    DUMP_STEP_RXFAIL,
+    DUMP_STEP_MASTER,
+    DUMP_STEP_PID_PROFILES,
+    DUMP_STEP_RATE_PROFILES,
+    DUMP_STEP_SAVE,
+    DUMP_STEP_COUNT
+} dumpStep_e;
+
+typedef struct cliDumpState_s {
+    uint8_t dumpMask;
+    uint8_t step;
+    bool sectionStarted;
+    uint8_t profileIndex;
+    uint16_t valueIndex;
+    int stepBytesSent;              // output of the current step written by earlier passes
+} cliDumpState_t;
+
+static cliDumpState_t cliDumpState = { .step = DUMP_STEP_COUNT };
+
+// a dump pass only writes the part of its output in [cliDumpState.stepBytesSent, end)
+static struct {
+    bool active;
+    int offset;                     // output of the step so far in this pass
+    int end;
+} cliDumpWindow;
+
+static void cliWriteOut(void *port, void *data, int count)
+{
+    if (!cliDumpWindow.active) {
+        serialWriteBuf(port, data, count);
+        return;
     }
+    const int from = constrain(cliDumpState.stepBytesSent - cliDumpWindow.offset, 0, count);
+    const int to = constrain(cliDumpWindow.end - cliDumpWindow.offset, 0, count);
+    if (to > from) {
+        serialWriteBuf(port, (uint8_t *)data + from, to - from);
+    }
+    cliDumpWindow.offset += count;
+}
 
-    configIsInCopy = false;
+static bool isDumpInProgress(void)
+{
+    return cliDumpState.step < DUMP_STEP_COUNT;
 }
 
-static void printConfig(char *cmdline, bool doDiff)
+// dumps the next value of the section, returns true when all values are done
+static bool dumpNextValue(uint16_t valueSection, uint8_t profileIndex)
 {
-    uint8_t dumpMask = DUMP_MASTER;
-    char *options;
-    if ((options = checkCommand(cmdline, "master"))) {
-        dumpMask = DUMP_MASTER; // only
-    } else if ((options = checkCommand(cmdline, "profile"))) {
-        dumpMask = DUMP_PROFILE; // only
-    } else if ((options = checkCommand(cmdline, "rates"))) {
-        dumpMask = DUMP_RATES; // only
-    } else if ((options = checkCommand(cmdline, "all"))) {
-        dumpMask = DUMP_ALL;   // all profiles and rates
-    } else {
-        options = cmdline;
+    while (cliDumpState.valueIndex < valueTableEntryCount) {
+        const clivalue_t *value = &valueTable[cliDumpState.valueIndex++];
+        if ((value->type & VALUE_SECTION_MASK) == valueSection) {
+            dumpPgValue(value, cliDumpState.dumpMask, profileIndex);
+            return false;
+        }
     }
+    cliDumpState.valueIndex = 0;
+    return true;
+}
 
-    if (doDiff) {
-        dumpMask = dumpMask | DO_DIFF;
+// dumps the current profile, or all of them followed by the selection of the current one
+static bool dumpProfilesStep(uint16_t valueSection, const char *name, const char *restoreName, uint8_t profileCount, uint8_t currentProfileIndex)
+{
+#ifdef MINIMAL_CLI
+    UNUSED(restoreName); // cliPrintHashLine() is empty
+#endif
+    const bool allProfiles = cliDumpState.dumpMask & DUMP_ALL;
+    const uint8_t profileIndex = allProfiles ? cliDumpState.profileIndex : currentProfileIndex;
+    if (!cliDumpState.sectionStarted) {
+        cliPrintHashLine(name);
+        cliPrintLinef("%s %d", name, profileIndex);
+        cliPrintLinefeed();
+        cliDumpState.sectionStarted = true;
+        return false;
+    }
+    if (!dumpNextValue(valueSection, profileIndex)) {
+        return false;
     }
+    cliDumpState.sectionStarted = false;
 
-    backupConfigs();
-    // reset all configs to defaults to do differencing
-    resetConfigs();
+    if (allProfiles) {
+        if (++cliDumpState.profileIndex < profileCount) {
+            return false;
+        }
+        cliDumpState.profileIndex = 0;
+        cliPrintHashLine(restoreName);
+        cliPrintLinef("%s %d", name, currentProfileIndex);
+    }
+    return true;
+}
 
-#if defined(TARGET_CONFIG)
-    targetConfiguration();
-#endif
-    if (checkCommand(options, "defaults")) {
-        dumpMask = dumpMask | SHOW_DEFAULTS;   // add default values as comments for changed values
+// outputs a part of the step, returns true when the step is done
+static bool printConfigStep(uint8_t step)
+{
+    const uint8_t dumpMask = cliDumpState.dumpMask;
+    if (step < DUMP_STEP_PID_PROFILES && !(dumpMask & (DUMP_MASTER | DUMP_ALL))) {
+        return true;
     }
 
-    if ((dumpMask & DUMP_MASTER) || (dumpMask & DUMP_ALL)) {
+    switch (step) {
+    case DUMP_STEP_VERSION:
         cliPrintHashLine("version");
         cliVersion(NULL);
 
@@ -3333,117 +3478,214 @@ static void printConfig(char *cmdline, bool doDiff)
             cliPrint("defaults");
             cliPrintLinefeed();
         }
+        break;
 
+    case DUMP_STEP_NAME:
         cliPrintHashLine("name");
-        printName(dumpMask, &pilotConfig_Copy);
+        printName(dumpMask, pilotConfig());
+        break;
 
 #ifdef USE_RESOURCE_MGMT
+    case DUMP_STEP_RESOURCES:
         cliPrintHashLine("resources");
         printResource(dumpMask);
+        break;
 #endif
 
 #ifndef USE_QUAD_MIXER_ONLY
-        cliPrintHashLine("mixer");
-        const bool equalsDefault = mixerConfig_Copy.mixerMode == mixerConfig()->mixerMode;
-        const char *formatMixer = "mixer %s";
-        cliDefaultPrintLinef(dumpMask, equalsDefault, formatMixer, mixerNames[mixerConfig()->mixerMode - 1]);
-        cliDumpPrintLinef(dumpMask, equalsDefault, formatMixer, mixerNames[mixerConfig_Copy.mixerMode - 1]);
+    case DUMP_STEP_MIXER:
+        {
+            cliPrintHashLine("mixer");
+            const bool equalsDefault = mixerConfig()->mixerMode == mixerConfig_Copy.mixerMode;
+            const char *formatMixer = "mixer %s";
+            cliDefaultPrintLinef(dumpMask, equalsDefault, formatMixer, mixerNames[mixerConfig_Copy.mixerMode - 1]);
+            cliDumpPrintLinef(dumpMask, equalsDefault, formatMixer, mixerNames[mixerConfig()->mixerMode - 1]);
 
-        cliDumpPrintLinef(dumpMask, customMotorMixer(0)->throttle == 0.0f, "\r\nmmix reset\r\n");
+            cliDumpPrintLinef(dumpMask, customMotorMixer_CopyArray[0].throttle == 0.0f, "\r\nmmix reset\r\n");
 
-        printMotorMix(dumpMask, customMotorMixer_CopyArray, customMotorMixer(0));
+            printMotorMix(dumpMask, customMotorMixer(0), customMotorMixer_CopyArray);
+        }
+        break;
 
 #ifdef USE_SERVOS
+    case DUMP_STEP_SERVO:
         cliPrintHashLine("servo");
-        printServo(dumpMask, servoParams_CopyArray, servoParams(0));
+        printServo(dumpMask, servoParams(0), servoParams_CopyArray);
 
         cliPrintHashLine("servo mix");
         // print custom servo mixer if exists
-        cliDumpPrintLinef(dumpMask, customServoMixers(0)->rate == 0, "smix reset\r\n");
-        printServoMix(dumpMask, customServoMixers_CopyArray, customServoMixers(0));
+        cliDumpPrintLinef(dumpMask, customServoMixers_CopyArray[0].rate == 0, "smix reset\r\n");
+        printServoMix(dumpMask, customServoMixers(0), customServoMixers_CopyArray);
+        break;
 #endif
 #endif
 
+    case DUMP_STEP_FEATURE:
         cliPrintHashLine("feature");
-        printFeature(dumpMask, &featureConfig_Copy, featureConfig());
+        printFeature(dumpMask, featureConfig(), &featureConfig_Copy);
+        break;
 
 #ifdef BEEPER
+    case DUMP_STEP_BEEPER:
         cliPrintHashLine("beeper");
-        printBeeper(dumpMask, &beeperConfig_Copy, beeperConfig());
+        printBeeper(dumpMask, beeperConfig(), &beeperConfig_Copy);
+        break;
 #endif
 
+    case DUMP_STEP_MAP:
         cliPrintHashLine("map");
-        printMap(dumpMask, &rxConfig_Copy, rxConfig());
+        printMap(dumpMask, rxConfig(), &rxConfig_Copy);
+        break;
 
+    case DUMP_STEP_SERIAL:
         cliPrintHashLine("serial");
-        printSerial(dumpMask, &serialConfig_Copy, serialConfig());
+        printSerial(dumpMask, serialConfig(), &serialConfig_Copy);
+        break;
 
 #ifdef LED_STRIP
+    case DUMP_STEP_LED:
         cliPrintHashLine("led");
-        printLed(dumpMask, ledStripConfig_Copy.ledConfigs, ledStripConfig()->ledConfigs);
+        printLed(dumpMask, ledStripConfig()->ledConfigs, ledStripConfig_Copy.ledConfigs);
 
         cliPrintHashLine("color");
-        printColor(dumpMask, ledStripConfig_Copy.colors, ledStripConfig()->colors);
+        printColor(dumpMask, ledStripConfig()->colors, ledStripConfig_Copy.colors);
 
         cliPrintHashLine("mode_color");
-        printModeColor(dumpMask, &ledStripConfig_Copy, ledStripConfig());
+        printModeColor(dumpMask, ledStripConfig(), &ledStripConfig_Copy);
+        break;
 #endif
 
+    case DUMP_STEP_AUX:
         cliPrintHashLine("aux");
-        printAux(dumpMask, modeActivationConditions_CopyArray, modeActivationConditions(0));
+        printAux(dumpMask, modeActivationConditions(0), modeActivationConditions_CopyArray);
+        break;
 
+    case DUMP_STEP_ADJRANGE:
         cliPrintHashLine("adjrange");
-        printAdjustmentRange(dumpMask, adjustmentRanges_CopyArray, adjustmentRanges(0));
+        printAdjustmentRange(dumpMask, adjustmentRanges(0), adjustmentRanges_CopyArray);
+        break;
 
+    case DUMP_STEP_RXRANGE:
         cliPrintHashLine("rxrange");
-        printRxRange(dumpMask, rxChannelRangeConfigs_CopyArray, rxChannelRangeConfigs(0));
+        printRxRange(dumpMask, rxChannelRangeConfigs(0), rxChannelRangeConfigs_CopyArray);
+        break;
 
 #ifdef VTX_CONTROL
+    case DUMP_STEP_VTX:
         cliPrintHashLine("vtx");
-        printVtx(dumpMask, &vtxConfig_Copy, vtxConfig());
+        printVtx(dumpMask, vtxConfig(), &vtxConfig_Copy);
+        break;
 #endif
 
+    case DUMP_STEP_RXFAIL:
         cliPrintHashLine("rxfail");
-        printRxFailsafe(dumpMask, rxFailsafeChannelConfigs_CopyArray, rxFailsafeChannelConfigs(0));
+        printRxFailsafe(dumpMask, rxFailsafeChannelConfigs(0), rxFailsafeChannelConfigs_CopyArray);
+        break;
 
-        cliPrintHashLine("master");
-        dumpAllValues(MASTER_VALUE, dumpMask);
+    case DUMP_STEP_MASTER:
+        if (!cliDumpState.sectionStarted) {
+            cliPrintHashLine("master");
+            cliDumpState.sectionStarted = true;
+            return false;
+        }
+        if (!dumpNextValue(MASTER_VALUE, 0)) {
+            return false;
+        }
+        cliDumpState.sectionStarted = false;
+        break;
 
-        if (dumpMask & DUMP_ALL) {
-            const uint8_t pidProfileIndexSave = systemConfig_Copy.pidProfileIndex;
-            for (uint32_t pidProfileIndex = 0; pidProfileIndex < MAX_PROFILE_COUNT; pidProfileIndex++) {
-                cliDumpPidProfile(pidProfileIndex, dumpMask);
-            }
-            changePidProfile(pidProfileIndexSave);
-            cliPrintHashLine("restore original profile selection");
-            cliProfile("");
+    case DUMP_STEP_PID_PROFILES:
+        if (dumpMask & (DUMP_MASTER | DUMP_ALL | DUMP_PROFILE)) {
+            return dumpProfilesStep(PROFILE_VALUE, "profile", "restore original profile selection", MAX_PROFILE_COUNT, getCurrentPidProfileIndex());
+        }
+        break;
 
-            const uint8_t controlRateProfileIndexSave = systemConfig_Copy.activeRateProfile;
-            for (uint32_t rateIndex = 0; rateIndex < CONTROL_RATE_PROFILE_COUNT; rateIndex++) {
-                cliDumpRateProfile(rateIndex, dumpMask);
-            }
-            changeControlRateProfile(controlRateProfileIndexSave);
-            cliPrintHashLine("restore original rateprofile selection");
-            cliRateProfile("");
+    case DUMP_STEP_RATE_PROFILES:
+        if (dumpMask & (DUMP_MASTER | DUMP_ALL | DUMP_RATES)) {
+            return dumpProfilesStep(PROFILE_RATE_VALUE, "rateprofile", "restore original rateprofile selection", CONTROL_RATE_PROFILE_COUNT, getCurrentControlRateProfileIndex());
+        }
+        break;
 
+    case DUMP_STEP_SAVE:
+        if (dumpMask & DUMP_ALL) {
             cliPrintHashLine("save configuration");
             cliPrint("save");
+        }
+        break;
+    }
+
+    return true;
+}
+
+// continues the dump while the serial port has room for the output, rather than waiting for it.
+// Each pass only writes what fits in the transmit buffer, a step with more output is run again from
+// the same state in the next pass, skipping the output already written.
+static void cliDumpProcess(void)
+{
+    const uint32_t txFreeRequired = MIN(CLI_OUT_BUFFER_SIZE, cliPort->txBufferSize - 1);
+    bufWriterFlush(cliWriter); // nothing pending when the room is measured
+    uint32_t txFree;
+    while (isDumpInProgress() && (txFree = serialTxBytesFree(cliPort)) >= txFreeRequired) {
+        const cliDumpState_t stepState = cliDumpState;
+        cliDumpWindow.offset = 0;
+        cliDumpWindow.end = cliDumpState.stepBytesSent + txFree;
+        cliDumpWindow.active = true;
+        const bool stepDone = printConfigStep(cliDumpState.step);
+        bufWriterFlush(cliWriter);
+        cliDumpWindow.active = false;
+
+        if (cliDumpWindow.offset > cliDumpWindow.end) {
+            cliDumpState = stepState;
+            cliDumpState.stepBytesSent = cliDumpWindow.end;
         } else {
-            cliDumpPidProfile(systemConfig_Copy.pidProfileIndex, dumpMask);
+            cliDumpState.stepBytesSent = 0;
+            if (stepDone) {
+                cliDumpState.step++;
+            }
+        }
+    }
 
-            cliDumpRateProfile(systemConfig_Copy.activeRateProfile, dumpMask);
+    if (!isDumpInProgress()) {
+        defaultsInCopy = false;
+        if (!cliBatchMode) {
+            cliPrompt();
         }
     }
+}
 
-    if (dumpMask & DUMP_PROFILE) {
-        cliDumpPidProfile(systemConfig_Copy.pidProfileIndex, dumpMask);
+static void printConfig(char *cmdline, bool doDiff)
+{
+    uint8_t dumpMask = DUMP_MASTER;
+    char *options;
+    if ((options = checkCommand(cmdline, "master"))) {
+        dumpMask = DUMP_MASTER; // only
+    } else if ((options = checkCommand(cmdline, "profile"))) {
+        dumpMask = DUMP_PROFILE; // only
+    } else if ((options = checkCommand(cmdline, "rates"))) {
+        dumpMask = DUMP_RATES; // only
+    } else if ((options = checkCommand(cmdline, "all"))) {
+        dumpMask = DUMP_ALL;   // all profiles and rates
+    } else {
+        options = cmdline;
+    }
+
+    if (doDiff) {
+        dumpMask = dumpMask | DO_DIFF;
     }
 
-    if (dumpMask & DUMP_RATES) {
-        cliDumpRateProfile(systemConfig_Copy.activeRateProfile, dumpMask);
+    if (checkCommand(options, "defaults")) {
+        dumpMask = dumpMask | SHOW_DEFAULTS;   // add default values as comments for changed values
     }
-    // restore configs from copies
-    restoreConfigs();
+
+    loadDefaultsIntoCopies();
+
+    // the output follows from cliProcess()
+    cliDumpState.dumpMask = dumpMask;
+    cliDumpState.step = 0;
+    cliDumpState.sectionStarted = false;
+    cliDumpState.profileIndex = 0;
+    cliDumpState.valueIndex = 0;
+    cliDumpState.stepBytesSent = 0;
 }
 
 static void cliDump(char *cmdline)
@@ -3487,6 +3729,8 @@ static void cliHelp(char *cmdline);
 const clicmd_t cmdTable[] = {
     CLI_COMMAND_DEF("adjrange", "configure adjustment ranges", NULL, cliAdjustmentRange),
     CLI_COMMAND_DEF("aux", "configure modes", NULL, cliAux),
+    CLI_COMMAND_DEF("batch", "apply commands without confirmation", "start\r\n"
+        "\tend", cliBatch),
 #ifdef BEEPER
     CLI_COMMAND_DEF("beeper", "turn on/off beeper", "list\r\n"
         "\t<+|->[name]", cliBeeper),
@@ -3538,6 +3782,9 @@ const clicmd_t cmdTable[] = {
     CLI_COMMAND_DEF("mode_color", "configure mode and special colors", NULL, cliModeColor),
 #endif
     CLI_COMMAND_DEF("motor",  "get/set motor", "<index> [<value>]", cliMotor),
+#ifdef USE_MSP_STATS
+    CLI_COMMAND_DEF("mspstats", "show msp command stats", "[reset]", cliMspStats),
+#endif
     CLI_COMMAND_DEF("name", "name of craft", NULL, cliName),
 #ifndef MINIMAL_CLI
     CLI_COMMAND_DEF("play_sound", NULL, "[<index>]", cliPlaySound),
@@ -3603,6 +3850,12 @@ void cliProcess(void)
     // Be a little bit tricky.  Flush the last inputs buffer, if any.
     bufWriterFlush(cliWriter);
 
+    // input is only read once a dump is done
+    if (isDumpInProgress()) {
+        cliDumpProcess();
+        return;
+    }
+
     while (serialRxBytesWaiting(cliPort)) {
         uint8_t c = serialRead(cliPort);
         if (c == '\t' || c == '?') {
@@ -3688,7 +3941,15 @@ void cliProcess(void)
             if (!cliMode)
                 return;
 
-            cliPrompt();
+            // the prompt follows the dump
+            if (isDumpInProgress()) {
+                cliDumpProcess();
+                return;
+            }
+
+            if (!cliBatchMode) {
+                cliPrompt();
+            }
         } else if (c == 127) {
             // backspace
             if (bufferIndex) {
@@ -3707,9 +3968,10 @@ void cliProcess(void)
 void cliEnter(serialPort_t *serialPort)
 {
     cliMode = 1;
+    cliBatchMode = false;
     cliPort = serialPort;
     setPrintfSerialPort(cliPort);
-    cliWriter = bufWriterInit(cliWriteBuffer, sizeof(cliWriteBuffer), (bufWrite_t)serialWriteBufShim, serialPort);
+    cliWriter = bufWriterInit(cliWriteBuffer, sizeof(cliWriteBuffer), cliWriteOut, serialPort);
 
     schedulerSetCalulateTaskStatistics(systemConfig()->task_statistics);
 
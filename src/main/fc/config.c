@@ -310,6 +310,7 @@ void activateConfig(void)
 {
 #ifndef USE_OSD_SLAVE
     generateThrottleCurve();
+    generateRateCurves();
 
     resetAdjustmentStates();
 
@@ -569,6 +570,7 @@ void changePidProfile(uint8_t pidProfileIndex)
     }
     systemConfigMutable()->pidProfileIndex = pidProfileIndex;
     currentPidProfile = pidProfilesMutable(pidProfileIndex);
+    pidChangeProfile(currentPidProfile);
     beeperConfirmationBeeps(pidProfileIndex + 1);
 }
 #endif
@@ -70,4 +70,5 @@ void changeControlRateProfile(uint8_t controlRateProfileIndex)
     }
     setControlRateProfile(controlRateProfileIndex);
     generateThrottleCurve();
+    generateRateCurves();
 }
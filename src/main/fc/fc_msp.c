@@ -51,6 +51,7 @@
 #include "drivers/serial.h"
 #include "drivers/serial_escserial.h"
 #include "drivers/system.h"
+#include "drivers/time.h"
 #include "drivers/vcd.h"
 #include "drivers/vtx_common.h"
 #include "drivers/transponder_ir.h"
@@ -66,6 +67,7 @@
 #include "fc/rc_controls.h"
 #include "fc/rc_modes.h"
 #include "fc/runtime_config.h"
+#include "fc/settings.h"
 
 #include "flight/altitude.h"
 #include "flight/failsafe.h"
@@ -1208,6 +1210,157 @@ static bool mspFcProcessOutCommand(uint8_t cmdMSP, sbuf_t *dst)
     return true;
 }
 
+/*
+ * Bulk access to the settings of the CLI valueTable, by index into the table.
+ * Replies hold as many entries from the requested index on as fit into the reply, the number of entries is part of the reply.
+ * Settings of the PID and rate profiles are those of the current profiles, as in the CLI.
+ */
+static void serializeSettingsInfoReply(sbuf_t *dst, uint16_t first)
+{
+    sbufWriteU16(dst, valueTableEntryCount);
+    sbufWriteU16(dst, first);
+    uint8_t *count = sbufPtr(dst);
+    sbufWriteU8(dst, 0);
+
+    for (uint16_t i = first; i < valueTableEntryCount && *count < UINT8_MAX; i++) {
+        const clivalue_t *value = &valueTable[i];
+        const int nameSize = strlen(value->name) + 1;
+        // type, range and name including the terminator
+        if (sbufBytesRemaining(dst) < 1 + 2 * (int)sizeof(int16_t) + nameSize) {
+            break;
+        }
+        sbufWriteU8(dst, value->type);
+        switch (value->type & VALUE_MODE_MASK) {
+        case MODE_DIRECT:
+            sbufWriteU16(dst, value->config.minmax.min);
+            sbufWriteU16(dst, value->config.minmax.max);
+            break;
+        case MODE_LOOKUP:
+            sbufWriteU8(dst, value->config.lookup.tableIndex);
+            sbufWriteU8(dst, lookupTables[value->config.lookup.tableIndex].valueCount);
+            break;
+        case MODE_ARRAY:
+            sbufWriteU8(dst, value->config.array.length);
+            break;
+        }
+        sbufWriteData(dst, value->name, nameSize);
+        (*count)++;
+    }
+}
+
+static mspResult_e serializeSettingsLookupReply(sbuf_t *dst, uint8_t tableIndex, uint8_t first)
+{
+    if (tableIndex >= LOOKUP_TABLE_COUNT) {
+        return MSP_RESULT_ERROR;
+    }
+    const lookupTableEntry_t *table = &lookupTables[tableIndex];
+    sbufWriteU8(dst, tableIndex);
+    sbufWriteU8(dst, table->valueCount);
+    sbufWriteU8(dst, first);
+    uint8_t *count = sbufPtr(dst);
+    sbufWriteU8(dst, 0);
+
+    for (unsigned i = first; i < table->valueCount; i++) {
+        const int nameSize = strlen(table->values[i]) + 1;
+        if (sbufBytesRemaining(dst) < nameSize) {
+            break;
+        }
+        sbufWriteData(dst, table->values[i], nameSize);
+        (*count)++;
+    }
+    return MSP_RESULT_ACK;
+}
+
+static void serializeSettingsValuesReply(sbuf_t *dst, uint16_t first)
+{
+    int space = sbufBytesRemaining(dst) - 2 * sizeof(uint16_t);
+    uint16_t last = first;
+    while (last < valueTableEntryCount && space >= getValueSize(&valueTable[last])) {
+        space -= getValueSize(&valueTable[last]);
+        last++;
+    }
+
+    sbufWriteU16(dst, first);
+    sbufWriteU16(dst, last - first);
+    for (uint16_t i = first; i < last; i++) {
+        const void *ptr = getValuePointer(&valueTable[i]);
+        if (ptr) {
+            // values are stored little endian, as MSP sends them
+            sbufWriteData(dst, ptr, getValueSize(&valueTable[i]));
+        } else {
+            for (int j = 0; j < getValueSize(&valueTable[i]); j++) {
+                sbufWriteU8(dst, 0);
+            }
+        }
+    }
+}
+
+static bool isSettingValueValid(const clivalue_t *value, sbuf_t *src)
+{
+    if (sbufBytesRemaining(src) < getValueSize(value) || !getValuePointer(value)) {
+        return false;
+    }
+    if ((value->type & VALUE_MODE_MASK) == MODE_ARRAY) {
+        // array elements are not range checked, as in the CLI
+        sbufAdvance(src, getValueSize(value));
+        return true;
+    }
+
+    int newValue;
+    switch (value->type & VALUE_TYPE_MASK) {
+    case VAR_UINT8:
+        newValue = sbufReadU8(src);
+        break;
+    case VAR_INT8:
+        newValue = (int8_t)sbufReadU8(src);
+        break;
+    case VAR_UINT16:
+        newValue = sbufReadU16(src);
+        break;
+    case VAR_INT16:
+    default:
+        newValue = (int16_t)sbufReadU16(src);
+        break;
+    }
+
+    switch (value->type & VALUE_MODE_MASK) {
+    case MODE_DIRECT:
+        return newValue >= value->config.minmax.min && newValue <= value->config.minmax.max;
+    case MODE_LOOKUP:
+        return newValue < lookupTables[value->config.lookup.tableIndex].valueCount;
+    }
+    return false;
+}
+
+// the payload is a sequence of setting index and value, the values are only set if all of them are valid
+static mspResult_e mspFcSetSettingsValues(sbuf_t *src)
+{
+    sbuf_t check = *src;
+    while (sbufBytesRemaining(&check)) {
+        if (sbufBytesRemaining(&check) < (int)sizeof(uint16_t)) {
+            return MSP_RESULT_ERROR;
+        }
+        const uint16_t index = sbufReadU16(&check);
+        if (index >= valueTableEntryCount || !isSettingValueValid(&valueTable[index], &check)) {
+            return MSP_RESULT_ERROR;
+        }
+    }
+
+    while (sbufBytesRemaining(src)) {
+        const clivalue_t *value = &valueTable[sbufReadU16(src)];
+        sbufReadData(src, getValuePointer(value), getValueSize(value));
+        sbufAdvance(src, getValueSize(value));
+    }
+
+    // any setting may have changed, so refresh what is derived from them like the MSP_SET_* commands do,
+    // settings only read at startup (e.g. the motor protocol) still need MSP_EEPROM_WRITE and a reboot
+    validateAndFixGyroConfig();
+    gyroInitFilters();
+    activateConfig();
+    pidChangeProfile(currentPidProfile);
+    return MSP_RESULT_ACK;
+}
+
 static mspResult_e mspFcProcessOutCommandWithArg(uint8_t cmdMSP, sbuf_t *arg, sbuf_t *dst)
 {
     switch (cmdMSP) {
@@ -1223,6 +1376,27 @@ static mspResult_e mspFcProcessOutCommandWithArg(uint8_t cmdMSP, sbuf_t *arg, sb
             serializeBoxReply(dst, page, &serializeBoxPermanentIdFn);
         }
         break;
+    case MSP_SETTINGS_INFO:
+        {
+            const uint16_t first = sbufBytesRemaining(arg) >= 2 ? sbufReadU16(arg) : 0;
+            serializeSettingsInfoReply(dst, first);
+        }
+        break;
+    case MSP_SETTINGS_LOOKUP:
+        {
+            if (sbufBytesRemaining(arg) < 1) {
+                return MSP_RESULT_ERROR;
+            }
+            const uint8_t tableIndex = sbufReadU8(arg);
+            const uint8_t first = sbufBytesRemaining(arg) ? sbufReadU8(arg) : 0;
+            return serializeSettingsLookupReply(dst, tableIndex, first);
+        }
+    case MSP_SETTINGS_VALUES:
+        {
+            const uint16_t first = sbufBytesRemaining(arg) >= 2 ? sbufReadU16(arg) : 0;
+            serializeSettingsValuesReply(dst, first);
+        }
+        break;
     default:
         return MSP_RESULT_CMD_UNKNOWN;
     }
@@ -1276,14 +1450,6 @@ static void mspFcDataFlashReadCommand(sbuf_t *dst, sbuf_t *src)
 }
 #endif
 
-#ifdef USE_OSD_SLAVE
-static mspResult_e mspOsdSlaveProcessInCommand(uint8_t cmdMSP, sbuf_t *src) {
-    UNUSED(cmdMSP);
-    UNUSED(src);
-    return MSP_RESULT_ERROR;
-}
-#endif
-
 #ifndef USE_OSD_SLAVE
 static mspResult_e mspFcProcessInCommand(uint8_t cmdMSP, sbuf_t *src)
 {
@@ -1295,6 +1461,9 @@ static mspResult_e mspFcProcessInCommand(uint8_t cmdMSP, sbuf_t *src)
     int32_t lat = 0, lon = 0, alt = 0;
 #endif
     switch (cmdMSP) {
+    case MSP_SET_SETTINGS_VALUES:
+        return mspFcSetSettingsValues(src);
+
     case MSP_SELECT_SETTING:
         value = sbufReadU8(src);
         if ((value & RATEPROFILE_MASK) == 0) {
@@ -1418,6 +1587,7 @@ static mspResult_e mspFcProcessInCommand(uint8_t cmdMSP, sbuf_t *src)
                 currentControlRateProfile->rcYawRate8 = sbufReadU8(src);
             }
             generateThrottleCurve();
+            generateRateCurves();
         } else {
             return MSP_RESULT_ERROR;
         }
@@ -1552,8 +1722,8 @@ static mspResult_e mspFcProcessInCommand(uint8_t cmdMSP, sbuf_t *src)
         // reinitialize the gyro filters with the new values
         validateAndFixGyroConfig();
         gyroInitFilters();
-        // reinitialize the PID filters with the new values
-        pidInitFilters(currentPidProfile);
+        // reinitialize the PID filters with the new values, swapped in by the pid loop
+        pidChangeProfile(currentPidProfile);
         break;
 
     case MSP_SET_PID_ADVANCED:
@@ -1604,9 +1774,6 @@ static mspResult_e mspFcProcessInCommand(uint8_t cmdMSP, sbuf_t *src)
         break;
 
     case MSP_EEPROM_WRITE:
-        if (ARMING_FLAG(ARMED)) {
-            return MSP_RESULT_ERROR;
-        }
         writeEEPROM();
         readEEPROM();
         break;
@@ -1664,10 +1831,6 @@ static mspResult_e mspFcProcessInCommand(uint8_t cmdMSP, sbuf_t *src)
 #ifdef USE_CAMERA_CONTROL
     case MSP_CAMERA_CONTROL:
         {
-            if (ARMING_FLAG(ARMED)) {
-                return MSP_RESULT_ERROR;
-            }
-
             const uint8_t key = sbufReadU8(src);
             cameraControlKeyPress(key, 0);
         }
@@ -2073,61 +2236,456 @@ static mspResult_e mspCommonProcessInCommand(uint8_t cmdMSP, sbuf_t *src)
 #endif // OSD || USE_OSD_SLAVE
 
     default:
+        // we do not know how to handle the (valid) message, indicate error MSP $M!
+        return MSP_RESULT_ERROR;
+    }
+    return MSP_RESULT_ACK;
+}
+
+typedef enum {
+    MSP_HANDLER_NONE = 0,
+    MSP_HANDLER_COMMON_OUT,
+    MSP_HANDLER_COMMON_IN,
+#ifdef USE_OSD_SLAVE
+    MSP_HANDLER_OSD_SLAVE_OUT,
+#else
+    MSP_HANDLER_FC_OUT,
+    MSP_HANDLER_FC_OUT_WITH_ARG,
+    MSP_HANDLER_FC_IN,
+#endif
+    MSP_HANDLER_4WAY_IF,
+    MSP_HANDLER_WP,
+    MSP_HANDLER_DATAFLASH_READ,
+    MSP_HANDLER_STREAM_SCHEDULE
+} mspHandler_e;
+
+#define MSP_FLAG_OUT            (1 << 0)    // reply is filled from the current state
+#define MSP_FLAG_IN             (1 << 1)    // request payload is read
+#define MSP_FLAG_DISARMED_ONLY  (1 << 2)    // rejected with an error while armed
+#define MSP_FLAG_ACTION         (1 << 3)    // has an effect besides the reply, never pushed by a stream schedule
+
+typedef struct mspCommand_s {
+    uint8_t handler;    // see mspHandler_e
+    uint8_t flags;      // see MSP_FLAG_*
+} mspCommand_t;
+
+// indexed by command id, commands not listed are unknown and rejected with an error
+static const mspCommand_t mspCommands[MSP_COMMAND_COUNT] = {
+    [MSP_API_VERSION] = { MSP_HANDLER_COMMON_OUT, MSP_FLAG_OUT },
+    [MSP_FC_VARIANT] = { MSP_HANDLER_COMMON_OUT, MSP_FLAG_OUT },
+    [MSP_FC_VERSION] = { MSP_HANDLER_COMMON_OUT, MSP_FLAG_OUT },
+    [MSP_BOARD_INFO] = { MSP_HANDLER_COMMON_OUT, MSP_FLAG_OUT },
+    [MSP_BUILD_INFO] = { MSP_HANDLER_COMMON_OUT, MSP_FLAG_OUT },
+    [MSP_REBOOT] = { MSP_HANDLER_COMMON_OUT, MSP_FLAG_OUT | MSP_FLAG_ACTION },
+    [MSP_ANALOG] = { MSP_HANDLER_COMMON_OUT, MSP_FLAG_OUT },
+    [MSP_DEBUG] = { MSP_HANDLER_COMMON_OUT, MSP_FLAG_OUT },
+    [MSP_UID] = { MSP_HANDLER_COMMON_OUT, MSP_FLAG_OUT },
+    [MSP_FEATURE_CONFIG] = { MSP_HANDLER_COMMON_OUT, MSP_FLAG_OUT },
+#ifdef BEEPER
+    [MSP_BEEPER_CONFIG] = { MSP_HANDLER_COMMON_OUT, MSP_FLAG_OUT },
+#endif
+    [MSP_BATTERY_STATE] = { MSP_HANDLER_COMMON_OUT, MSP_FLAG_OUT },
+    [MSP_VOLTAGE_METERS] = { MSP_HANDLER_COMMON_OUT, MSP_FLAG_OUT },
+    [MSP_CURRENT_METERS] = { MSP_HANDLER_COMMON_OUT, MSP_FLAG_OUT },
+    [MSP_VOLTAGE_METER_CONFIG] = { MSP_HANDLER_COMMON_OUT, MSP_FLAG_OUT },
+    [MSP_CURRENT_METER_CONFIG] = { MSP_HANDLER_COMMON_OUT, MSP_FLAG_OUT },
+    [MSP_BATTERY_CONFIG] = { MSP_HANDLER_COMMON_OUT, MSP_FLAG_OUT },
+    [MSP_TRANSPONDER_CONFIG] = { MSP_HANDLER_COMMON_OUT, MSP_FLAG_OUT },
+    [MSP_OSD_CONFIG] = { MSP_HANDLER_COMMON_OUT, MSP_FLAG_OUT },
 #ifdef USE_OSD_SLAVE
-        return mspOsdSlaveProcessInCommand(cmdMSP, src);
+    [MSP_STATUS_EX] = { MSP_HANDLER_OSD_SLAVE_OUT, MSP_FLAG_OUT },
+    [MSP_STATUS] = { MSP_HANDLER_OSD_SLAVE_OUT, MSP_FLAG_OUT },
 #else
-        return mspFcProcessInCommand(cmdMSP, src);
+    [MSP_STATUS_EX] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+    [MSP_STATUS] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+    [MSP_RAW_IMU] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+    [MSP_NAME] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+#ifdef USE_SERVOS
+    [MSP_SERVO] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+    [MSP_SERVO_CONFIGURATIONS] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+    [MSP_SERVO_MIX_RULES] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+#endif
+    [MSP_MOTOR] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+    [MSP_RC] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+    [MSP_ATTITUDE] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+    [MSP_ALTITUDE] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+    [MSP_SONAR_ALTITUDE] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+    [MSP_BOARD_ALIGNMENT_CONFIG] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+    [MSP_ARMING_CONFIG] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+    [MSP_RC_TUNING] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+    [MSP_PID] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+    [MSP_PIDNAMES] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+    [MSP_PID_CONTROLLER] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+    [MSP_MODE_RANGES] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+    [MSP_ADJUSTMENT_RANGES] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+    [MSP_MOTOR_CONFIG] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+#ifdef MAG
+    [MSP_COMPASS_CONFIG] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+#endif
+#ifdef GPS
+    [MSP_GPS_CONFIG] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+    [MSP_RAW_GPS] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+    [MSP_COMP_GPS] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+    [MSP_GPSSVINFO] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+#endif
+    [MSP_ACC_TRIM] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+    [MSP_MIXER_CONFIG] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+    [MSP_RX_CONFIG] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+    [MSP_FAILSAFE_CONFIG] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+    [MSP_RXFAIL_CONFIG] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+    [MSP_RSSI_CONFIG] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+    [MSP_RX_MAP] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+    [MSP_BF_CONFIG] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+    [MSP_CF_SERIAL_CONFIG] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+#ifdef LED_STRIP
+    [MSP_LED_COLORS] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+    [MSP_LED_STRIP_CONFIG] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+    [MSP_LED_STRIP_MODECOLOR] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+#endif
+    [MSP_DATAFLASH_SUMMARY] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+    [MSP_BLACKBOX_CONFIG] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+    [MSP_SDCARD_SUMMARY] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+    [MSP_MOTOR_3D_CONFIG] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+    [MSP_RC_DEADBAND] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+    [MSP_SENSOR_ALIGNMENT] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+    [MSP_ADVANCED_CONFIG] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+    [MSP_FILTER_CONFIG] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+    [MSP_PID_ADVANCED] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+    [MSP_SENSOR_CONFIG] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
+#if defined(VTX_COMMON)
+    [MSP_VTX_CONFIG] = { MSP_HANDLER_FC_OUT, MSP_FLAG_OUT },
 #endif
+    [MSP_BOXNAMES] = { MSP_HANDLER_FC_OUT_WITH_ARG, MSP_FLAG_OUT | MSP_FLAG_IN },
+    [MSP_BOXIDS] = { MSP_HANDLER_FC_OUT_WITH_ARG, MSP_FLAG_OUT | MSP_FLAG_IN },
+    [MSP_SETTINGS_INFO] = { MSP_HANDLER_FC_OUT_WITH_ARG, MSP_FLAG_OUT | MSP_FLAG_IN },
+    [MSP_SETTINGS_LOOKUP] = { MSP_HANDLER_FC_OUT_WITH_ARG, MSP_FLAG_OUT | MSP_FLAG_IN },
+    [MSP_SETTINGS_VALUES] = { MSP_HANDLER_FC_OUT_WITH_ARG, MSP_FLAG_OUT | MSP_FLAG_IN },
+#endif
+#ifdef USE_SERIAL_4WAY_BLHELI_INTERFACE
+    [MSP_SET_4WAY_IF] = { MSP_HANDLER_4WAY_IF, MSP_FLAG_OUT | MSP_FLAG_IN },
+#endif
+#ifdef GPS
+    [MSP_WP] = { MSP_HANDLER_WP, MSP_FLAG_OUT | MSP_FLAG_IN },
+#endif
+#ifdef USE_FLASHFS
+    [MSP_DATAFLASH_READ] = { MSP_HANDLER_DATAFLASH_READ, MSP_FLAG_OUT | MSP_FLAG_IN },
+#endif
+#ifdef USE_MSP_STREAM
+    [MSP_STREAM_SCHEDULE] = { MSP_HANDLER_STREAM_SCHEDULE, MSP_FLAG_OUT },
+    [MSP_SET_STREAM_SCHEDULE] = { MSP_HANDLER_STREAM_SCHEDULE, MSP_FLAG_IN },
+#endif
+#ifdef TRANSPONDER
+    [MSP_SET_TRANSPONDER_CONFIG] = { MSP_HANDLER_COMMON_IN, MSP_FLAG_IN },
+#endif
+    [MSP_SET_VOLTAGE_METER_CONFIG] = { MSP_HANDLER_COMMON_IN, MSP_FLAG_IN },
+    [MSP_SET_CURRENT_METER_CONFIG] = { MSP_HANDLER_COMMON_IN, MSP_FLAG_IN },
+    [MSP_SET_BATTERY_CONFIG] = { MSP_HANDLER_COMMON_IN, MSP_FLAG_IN },
+#if defined(OSD) || defined (USE_OSD_SLAVE)
+    [MSP_SET_OSD_CONFIG] = { MSP_HANDLER_COMMON_IN, MSP_FLAG_IN },
+    [MSP_OSD_CHAR_WRITE] = { MSP_HANDLER_COMMON_IN, MSP_FLAG_IN },
+#endif
+#ifndef USE_OSD_SLAVE
+    [MSP_SET_SETTINGS_VALUES] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN | MSP_FLAG_DISARMED_ONLY },
+    [MSP_SELECT_SETTING] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+#if defined(GPS) || defined(MAG)
+    [MSP_SET_HEADING] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+#endif
+    [MSP_SET_RAW_RC] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+    [MSP_SET_ACC_TRIM] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+    [MSP_SET_ARMING_CONFIG] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+    [MSP_SET_PID_CONTROLLER] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+    [MSP_SET_PID] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+    [MSP_SET_MODE_RANGE] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+    [MSP_SET_ADJUSTMENT_RANGE] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+    [MSP_SET_RC_TUNING] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+    [MSP_SET_MOTOR_CONFIG] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+#ifdef GPS
+    [MSP_SET_GPS_CONFIG] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+#endif
+#ifdef MAG
+    [MSP_SET_COMPASS_CONFIG] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+#endif
+    [MSP_SET_MOTOR] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+    [MSP_SET_SERVO_CONFIGURATION] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+    [MSP_SET_SERVO_MIX_RULE] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+    [MSP_SET_MOTOR_3D_CONFIG] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+    [MSP_SET_RC_DEADBAND] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+    [MSP_SET_RESET_CURR_PID] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+    [MSP_SET_SENSOR_ALIGNMENT] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+    [MSP_SET_ADVANCED_CONFIG] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+    [MSP_SET_FILTER_CONFIG] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+    [MSP_SET_PID_ADVANCED] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+    [MSP_SET_SENSOR_CONFIG] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+    [MSP_RESET_CONF] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+    [MSP_ACC_CALIBRATION] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+    [MSP_MAG_CALIBRATION] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+    [MSP_EEPROM_WRITE] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN | MSP_FLAG_DISARMED_ONLY },
+#ifdef BLACKBOX
+    [MSP_SET_BLACKBOX_CONFIG] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+#endif
+#ifdef VTX_COMMON
+    [MSP_SET_VTX_CONFIG] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+#endif
+#ifdef USE_CAMERA_CONTROL
+    [MSP_CAMERA_CONTROL] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN | MSP_FLAG_DISARMED_ONLY },
+#endif
+#ifdef USE_FLASHFS
+    [MSP_DATAFLASH_ERASE] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+#endif
+#ifdef GPS
+    [MSP_SET_RAW_GPS] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+    [MSP_SET_WP] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+#endif
+    [MSP_SET_FEATURE_CONFIG] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+#ifdef BEEPER
+    [MSP_SET_BEEPER_CONFIG] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+#endif
+    [MSP_SET_BOARD_ALIGNMENT_CONFIG] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+    [MSP_SET_MIXER_CONFIG] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+    [MSP_SET_RX_CONFIG] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+    [MSP_SET_FAILSAFE_CONFIG] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+    [MSP_SET_RXFAIL_CONFIG] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+    [MSP_SET_RSSI_CONFIG] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+    [MSP_SET_RX_MAP] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+    [MSP_SET_BF_CONFIG] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+    [MSP_SET_CF_SERIAL_CONFIG] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+#ifdef LED_STRIP
+    [MSP_SET_LED_COLORS] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+    [MSP_SET_LED_STRIP_CONFIG] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+    [MSP_SET_LED_STRIP_MODECOLOR] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+#endif
+    [MSP_SET_NAME] = { MSP_HANDLER_FC_IN, MSP_FLAG_IN },
+#endif
+};
+
+#ifdef USE_MSP_STATS
+static mspCommandStats_t mspCommandStats[MSP_COMMAND_COUNT];
+
+const mspCommandStats_t *mspGetCommandStats(uint8_t cmdMSP)
+{
+    return &mspCommandStats[cmdMSP];
+}
+
+void mspResetCommandStats(void)
+{
+    memset(mspCommandStats, 0, sizeof(mspCommandStats));
+}
+#endif
+
+#ifdef USE_MSP_STREAM
+#define MSP_STREAM_MAX_COUNT 8
+#ifndef MSP_STREAM_BURST_SIZE
+#define MSP_STREAM_BURST_SIZE 256
+#endif
+
+typedef struct mspStream_s {
+    uint8_t cmd;
+    uint16_t intervalMs;
+    timeUs_t nextPushTimeUs;
+} mspStream_t;
+
+static mspStream_t mspStreams[MSP_STREAM_MAX_COUNT];
+static uint8_t mspStreamCount;
+static serialPort_t *mspStreamPort;
+
+// the replies are pushed to the port the schedule was set from, once the ack has been sent
+static void mspStreamSetPortFn(serialPort_t *serialPort)
+{
+    mspStreamPort = serialPort;
+    setTaskEnabled(TASK_MSP_STREAM, mspStreamCount > 0);
+}
+
+static mspResult_e mspFcStreamScheduleCommand(uint8_t cmdMSP, sbuf_t *dst, sbuf_t *src, mspPostProcessFnPtr *mspPostProcessFn)
+{
+    if (cmdMSP == MSP_STREAM_SCHEDULE) {
+        for (int i = 0; i < mspStreamCount; i++) {
+            sbufWriteU8(dst, mspStreams[i].cmd);
+            sbufWriteU16(dst, mspStreams[i].intervalMs);
+        }
+        return MSP_RESULT_ACK;
+    }
+
+    // command id and interval in ms per stream, an empty schedule stops the pushes
+    const int count = sbufBytesRemaining(src) / 3;
+    if (count > MSP_STREAM_MAX_COUNT || sbufBytesRemaining(src) % 3) {
+        return MSP_RESULT_ERROR;
+    }
+    mspStream_t streams[MSP_STREAM_MAX_COUNT];
+    const timeUs_t currentTimeUs = micros();
+    for (int i = 0; i < count; i++) {
+        streams[i].cmd = sbufReadU8(src);
+        streams[i].intervalMs = sbufReadU16(src);
+        streams[i].nextPushTimeUs = currentTimeUs;
+        // only replies that need no request payload can be pushed
+        if (mspCommands[streams[i].cmd].flags != MSP_FLAG_OUT || streams[i].intervalMs == 0) {
+            return MSP_RESULT_ERROR;
+        }
     }
+    memcpy(mspStreams, streams, count * sizeof(mspStream_t));
+    mspStreamCount = count;
+    mspStreamPort = NULL;
+    *mspPostProcessFn = mspStreamSetPortFn;
     return MSP_RESULT_ACK;
 }
+#endif
 
 /*
  * Returns MSP_RESULT_ACK, MSP_RESULT_ERROR or MSP_RESULT_NO_REPLY
  */
 mspResult_e mspFcProcessCommand(mspPacket_t *cmd, mspPacket_t *reply, mspPostProcessFnPtr *mspPostProcessFn)
 {
-    int ret = MSP_RESULT_ACK;
+    mspResult_e ret = MSP_RESULT_ACK;
     sbuf_t *dst = &reply->buf;
     sbuf_t *src = &cmd->buf;
     const uint8_t cmdMSP = cmd->cmd;
+    const mspCommand_t *command = &mspCommands[cmdMSP];
     // initialize reply by default
     reply->cmd = cmd->cmd;
-
-    if (mspCommonProcessOutCommand(cmdMSP, dst, mspPostProcessFn)) {
-        ret = MSP_RESULT_ACK;
-#ifndef USE_OSD_SLAVE
-    } else if (mspFcProcessOutCommand(cmdMSP, dst)) {
-        ret = MSP_RESULT_ACK;
-    } else if ((ret = mspFcProcessOutCommandWithArg(cmdMSP, src, dst)) != MSP_RESULT_CMD_UNKNOWN) {
-        /* ret */;
+#ifdef USE_MSP_STATS
+    const timeUs_t startTime = micros();
 #endif
+
+    if ((command->flags & MSP_FLAG_DISARMED_ONLY) && ARMING_FLAG(ARMED)) {
+        ret = MSP_RESULT_ERROR;
+    } else {
+        switch (command->handler) {
+        case MSP_HANDLER_COMMON_OUT:
+            ret = mspCommonProcessOutCommand(cmdMSP, dst, mspPostProcessFn) ? MSP_RESULT_ACK : MSP_RESULT_ERROR;
+            break;
+        case MSP_HANDLER_COMMON_IN:
+            ret = mspCommonProcessInCommand(cmdMSP, src);
+            break;
 #ifdef USE_OSD_SLAVE
-    } else if (mspOsdSlaveProcessOutCommand(cmdMSP, dst)) {
-        ret = MSP_RESULT_ACK;
+        case MSP_HANDLER_OSD_SLAVE_OUT:
+            ret = mspOsdSlaveProcessOutCommand(cmdMSP, dst) ? MSP_RESULT_ACK : MSP_RESULT_ERROR;
+            break;
+#else
+        case MSP_HANDLER_FC_OUT:
+            ret = mspFcProcessOutCommand(cmdMSP, dst) ? MSP_RESULT_ACK : MSP_RESULT_ERROR;
+            break;
+        case MSP_HANDLER_FC_OUT_WITH_ARG:
+            ret = mspFcProcessOutCommandWithArg(cmdMSP, src, dst);
+            break;
+        case MSP_HANDLER_FC_IN:
+            ret = mspFcProcessInCommand(cmdMSP, src);
+            break;
 #endif
 #ifdef USE_SERIAL_4WAY_BLHELI_INTERFACE
-    } else if (cmdMSP == MSP_SET_4WAY_IF) {
-        mspFc4waySerialCommand(dst, src, mspPostProcessFn);
-        ret = MSP_RESULT_ACK;
+        case MSP_HANDLER_4WAY_IF:
+            mspFc4waySerialCommand(dst, src, mspPostProcessFn);
+            break;
 #endif
 #ifdef GPS
-    } else if (cmdMSP == MSP_WP) {
-        mspFcWpCommand(dst, src);
-        ret = MSP_RESULT_ACK;
+        case MSP_HANDLER_WP:
+            mspFcWpCommand(dst, src);
+            break;
 #endif
 #ifdef USE_FLASHFS
-    } else if (cmdMSP == MSP_DATAFLASH_READ) {
-        mspFcDataFlashReadCommand(dst, src);
-        ret = MSP_RESULT_ACK;
+        case MSP_HANDLER_DATAFLASH_READ:
+            mspFcDataFlashReadCommand(dst, src);
+            break;
 #endif
-    } else {
-        ret = mspCommonProcessInCommand(cmdMSP, src);
+#ifdef USE_MSP_STREAM
+        case MSP_HANDLER_STREAM_SCHEDULE:
+            ret = mspFcStreamScheduleCommand(cmdMSP, dst, src, mspPostProcessFn);
+            break;
+#endif
+        default:
+            // we do not know how to handle the (valid) message, indicate error MSP $M!
+            ret = MSP_RESULT_ERROR;
+            break;
+        }
     }
+
+#ifdef USE_MSP_STATS
+    const timeDelta_t executionTime = cmpTimeUs(micros(), startTime);
+    mspCommandStats_t *stats = &mspCommandStats[cmdMSP];
+    stats->callCount++;
+    stats->totalExecutionTime += executionTime;
+    stats->maxExecutionTime = MAX(stats->maxExecutionTime, executionTime);
+#endif
+
     reply->result = ret;
     return ret;
 }
 
+#ifdef USE_MSP_STREAM
+static void mspStreamPushed(mspStream_t *stream, timeUs_t currentTimeUs)
+{
+    stream->nextPushTimeUs += stream->intervalMs * 1000;
+    if (cmpTimeUs(stream->nextPushTimeUs, currentTimeUs) <= 0) {
+        // too late to catch up, keep the interval from now on
+        stream->nextPushTimeUs = currentTimeUs + stream->intervalMs * 1000;
+    }
+}
+
+/*
+ * Pushes the replies of the scheduled commands that are due, all of them in a single burst.
+ * A reply larger than the burst buffer is pushed on its own.
+ *
+ * Called periodically by the scheduler while a schedule is set.
+ */
+void mspSerialProcessStreamSchedule(timeUs_t currentTimeUs)
+{
+    static uint8_t replyBuf[MSP_PORT_OUTBUF_SIZE];
+    static uint8_t burstBuf[MSP_STREAM_BURST_SIZE];
+    mspPacket_t packets[MSP_STREAM_MAX_COUNT];
+    mspStream_t *pushedStreams[MSP_STREAM_MAX_COUNT];
+    uint8_t *burstPtr = burstBuf;
+    int packetCount = 0;
+
+    for (int i = 0; i < mspStreamCount; i++) {
+        mspStream_t *stream = &mspStreams[i];
+        if (cmpTimeUs(currentTimeUs, stream->nextPushTimeUs) < 0) {
+            continue;
+        }
+
+        mspPacket_t command = {
+            .buf = { .ptr = NULL, .end = NULL, },
+            .cmd = stream->cmd,
+            .result = 0,
+            .direction = MSP_DIRECTION_REQUEST,
+        };
+        mspPacket_t reply = {
+            .buf = { .ptr = replyBuf, .end = ARRAYEND(replyBuf), },
+            .cmd = -1,
+            .result = 0,
+            .direction = MSP_DIRECTION_REPLY,
+        };
+        mspPostProcessFnPtr mspPostProcessFn = NULL;
+        mspFcProcessCommand(&command, &reply, &mspPostProcessFn);
+
+        const int len = reply.buf.ptr - replyBuf;
+        if (len > MSP_STREAM_BURST_SIZE) {
+            sbufSwitchToReader(&reply.buf, replyBuf);
+            if (mspSerialPushPackets(mspStreamPort, &reply, 1)) {
+                mspStreamPushed(stream, currentTimeUs);
+            }
+            continue;
+        }
+        if (len > ARRAYEND(burstBuf) - burstPtr) {
+            // stays due for the next burst
+            continue;
+        }
+        memcpy(burstPtr, replyBuf, len);
+        reply.buf.ptr = burstPtr;
+        reply.buf.end = burstPtr + len;
+        burstPtr += len;
+        packets[packetCount] = reply;
+        pushedStreams[packetCount] = stream;
+        packetCount++;
+    }
+
+    // the replies are built again next time if they do not fit into the transmit buffer
+    if (packetCount == 0 || mspSerialPushPackets(mspStreamPort, packets, packetCount) == 0) {
+        return;
+    }
+    for (int i = 0; i < packetCount; i++) {
+        mspStreamPushed(pushedStreams[i], currentTimeUs);
+    }
+}
+#endif
+
 void mspFcProcessReply(mspPacket_t *reply)
 {
     sbuf_t *src = &reply->buf;
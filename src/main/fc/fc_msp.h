@@ -17,11 +17,25 @@
 
 #pragma once
 
+#include "common/time.h"
+
 #include "msp/msp.h"
 
+// MSP v1 command ids are a single byte
+#define MSP_COMMAND_COUNT 256
+
+typedef struct mspCommandStats_s {
+    uint32_t callCount;
+    uint32_t totalExecutionTime;    // us
+    timeDelta_t maxExecutionTime;   // us
+} mspCommandStats_t;
+
 void mspFcInit(void);
 void mspOsdSlaveInit(void);
 mspResult_e mspFcProcessCommand(mspPacket_t *cmd, mspPacket_t *reply, mspPostProcessFnPtr *mspPostProcessFn);
 void mspFcProcessReply(mspPacket_t *reply);
 
-void mspSerialProcessStreamSchedule(void);
+const mspCommandStats_t *mspGetCommandStats(uint8_t cmdMSP);
+void mspResetCommandStats(void);
+
+void mspSerialProcessStreamSchedule(timeUs_t currentTimeUs);
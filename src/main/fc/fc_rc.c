@@ -21,6 +21,7 @@
 
 #include "platform.h"
 
+#include "build/build_config.h"
 #include "build/debug.h"
 
 #include "common/maths.h"
@@ -97,35 +98,51 @@ int16_t rcLookupThrottle(int32_t tmp)
 #define SETPOINT_RATE_LIMIT 1998.0f
 #define RC_RATE_INCREMENTAL 14.54f
 
-static void calculateSetpointRate(int axis)
+// Rate curve coefficients, derived from the rate profile only when it changes:
+// angleRate = x * (linear + expo * x^3) / constrain(1 - superRate * |x|, 0.01, 1)
+typedef struct rcRateCurve_s {
+    float linear;
+    float expo;
+    float superRate;
+} rcRateCurve_t;
+
+static rcRateCurve_t rcRateCurve[3];
+
+void generateRateCurves(void)
 {
-    uint8_t rcExpo;
-    float rcRate;
-    if (axis != YAW) {
-        rcExpo = currentControlRateProfile->rcExpo8;
-        rcRate = currentControlRateProfile->rcRate8 / 100.0f;
-    } else {
-        rcExpo = currentControlRateProfile->rcYawExpo8;
-        rcRate = currentControlRateProfile->rcYawRate8 / 100.0f;
-    }
-    if (rcRate > 2.0f) {
-        rcRate += RC_RATE_INCREMENTAL * (rcRate - 2.0f);
+    for (int axis = 0; axis < 3; axis++) {
+        uint8_t rcExpo;
+        float rcRate;
+        if (axis != YAW) {
+            rcExpo = currentControlRateProfile->rcExpo8;
+            rcRate = currentControlRateProfile->rcRate8 / 100.0f;
+        } else {
+            rcExpo = currentControlRateProfile->rcYawExpo8;
+            rcRate = currentControlRateProfile->rcYawRate8 / 100.0f;
+        }
+        if (rcRate > 2.0f) {
+            rcRate += RC_RATE_INCREMENTAL * (rcRate - 2.0f);
+        }
+
+        const float expof = rcExpo / 100.0f;
+        rcRateCurve[axis].linear = 200.0f * rcRate * (1 - expof);
+        rcRateCurve[axis].expo = 200.0f * rcRate * expof;
+        rcRateCurve[axis].superRate = currentControlRateProfile->rates[axis] / 100.0f;
     }
+}
+
+STATIC_UNIT_TESTED void calculateSetpointRate(int axis)
+{
+    const rcRateCurve_t *curve = &rcRateCurve[axis];
 
-    float rcCommandf = rcCommand[axis] / 500.0f;
+    const float rcCommandf = rcCommand[axis] / 500.0f;
     rcDeflection[axis] = rcCommandf;
     const float rcCommandfAbs = ABS(rcCommandf);
     rcDeflectionAbs[axis] = rcCommandfAbs;
 
-    if (rcExpo) {
-        const float expof = rcExpo / 100.0f;
-        rcCommandf = rcCommandf * power3(rcCommandfAbs) * expof + rcCommandf * (1-expof);
-    }
-
-    float angleRate = 200.0f * rcRate * rcCommandf;
-    if (currentControlRateProfile->rates[axis]) {
-        const float rcSuperfactor = 1.0f / (constrainf(1.0f - (rcCommandfAbs * (currentControlRateProfile->rates[axis] / 100.0f)), 0.01f, 1.00f));
-        angleRate *= rcSuperfactor;
+    float angleRate = rcCommandf * (curve->linear + curve->expo * power3(rcCommandfAbs));
+    if (curve->superRate) {
+        angleRate /= constrainf(1.0f - rcCommandfAbs * curve->superRate, 0.01f, 1.00f);
     }
 
     DEBUG_SET(DEBUG_ANGLERATE, axis, angleRate);
@@ -173,6 +190,71 @@ static void scaleRcCommandToFpvCamAngle(void) {
         pidSetItermAccelerator(1.0f);
 }
 
+#define RC_SMOOTHING_FILTER_CUTOFF_RATIO       3     // cutoff is a third of the rx frame rate
+#define RC_SMOOTHING_FILTER_MIN_CUTOFF_HZ      10
+#define RC_SMOOTHING_FILTER_UPDATE_THRESHOLD   0.1f  // relative cutoff change before the coefficients are updated
+
+static biquadFilter_t rcSmoothingFilter[4];
+static float rcCommandRaw[4];
+static float rcSmoothingFrameIntervalUs;
+static float rcSmoothingCutoffHz;
+static bool rcSmoothingFilterActive;
+
+static float rcSmoothingFilterCutoff(void)
+{
+    const float cutoffHz = 1e6f / (rcSmoothingFrameIntervalUs * RC_SMOOTHING_FILTER_CUTOFF_RATIO);
+    // stay well below nyquist of the pid loop which runs the filter
+    return constrainf(cutoffHz, RC_SMOOTHING_FILTER_MIN_CUTOFF_HZ, 0.25e6f / targetPidLooptime);
+}
+
+// Second order (PT2/butterworth) low pass on rcCommand, run every pid loop. The cutoff follows the
+// measured rx frame interval and the setpoint weighted D term differentiates the smoothed setpoint.
+static void rcSmoothingFilterApply(uint16_t rxFrameIntervalUs, uint8_t interpolationChannels)
+{
+    if (isRXDataNew) {
+        for (int channel = ROLL; channel < interpolationChannels; channel++) {
+            rcCommandRaw[channel] = rcCommand[channel];
+        }
+
+        if (!rcSmoothingFilterActive) {
+            rcSmoothingFrameIntervalUs = rxFrameIntervalUs;
+            rcSmoothingCutoffHz = rcSmoothingFilterCutoff();
+            for (int channel = ROLL; channel < 4; channel++) {
+                biquadFilterInitLPF(&rcSmoothingFilter[channel], rcSmoothingCutoffHz, targetPidLooptime);
+                // start in steady state to avoid a transient when switching modes, DF1 state is the past inputs and outputs
+                rcSmoothingFilter[channel].x1 = rcSmoothingFilter[channel].x2 = rcCommand[channel];
+                rcSmoothingFilter[channel].y1 = rcSmoothingFilter[channel].y2 = rcCommand[channel];
+                rcCommandRaw[channel] = rcCommand[channel];
+            }
+            rcSmoothingFilterActive = true;
+        } else {
+            rcSmoothingFrameIntervalUs += (rxFrameIntervalUs - rcSmoothingFrameIntervalUs) * 0.1f;
+            const float cutoffHz = rcSmoothingFilterCutoff();
+            // only pay for the trig when the rx rate actually changed
+            if (ABS(cutoffHz - rcSmoothingCutoffHz) > rcSmoothingCutoffHz * RC_SMOOTHING_FILTER_UPDATE_THRESHOLD) {
+                rcSmoothingCutoffHz = cutoffHz;
+                for (int channel = ROLL; channel < 4; channel++) {
+                    biquadFilterUpdateLPF(&rcSmoothingFilter[channel], rcSmoothingCutoffHz, targetPidLooptime);
+                }
+            }
+        }
+
+        if (debugMode == DEBUG_RC_INTERPOLATION) {
+            debug[0] = lrintf(rcCommandRaw[0]);
+            debug[1] = lrintf(rcSmoothingFrameIntervalUs / 1000);
+            debug[2] = lrintf(rcSmoothingCutoffHz);
+        }
+    } else if (!rcSmoothingFilterActive) {
+        // nothing to filter before the first rx frame
+        return;
+    }
+
+    for (int channel = ROLL; channel < interpolationChannels; channel++) {
+        // DF1 keeps the state valid when biquadFilterUpdateLPF() changes the coefficients
+        rcCommand[channel] = biquadFilterApplyDF1(&rcSmoothingFilter[channel], rcCommandRaw[channel]);
+    }
+}
+
 void processRcCommand(void)
 {
     static float rcCommandInterp[4] = { 0, 0, 0, 0 };
@@ -191,7 +273,14 @@ void processRcCommand(void)
         }
     }
 
-    if (rxConfig()->rcInterpolation) {
+    if (rxConfig()->rcInterpolation == RC_SMOOTHING_FILTER) {
+        rcSmoothingFilterApply(currentRxRefreshRate, interpolationChannels);
+        rcInterpolationStepCount = 0;
+        readyToCalculateRateAxisCnt = FD_YAW; // throttle channel doesn't require rate calculation
+        readyToCalculateRate = true;
+    } else if (rxConfig()->rcInterpolation) {
+        rcSmoothingFilterActive = false;
+
          // Set RC refresh rate for sampling and channels to filter
         switch (rxConfig()->rcInterpolation) {
             case(RC_SMOOTHING_AUTO):
@@ -228,11 +317,12 @@ void processRcCommand(void)
             for (int channel=ROLL; channel < interpolationChannels; channel++) {
                 rcCommandInterp[channel] += rcStepSize[channel];
                 rcCommand[channel] = rcCommandInterp[channel];
-                readyToCalculateRateAxisCnt = MAX(channel, FD_YAW); // throttle channel doesn't require rate calculation
             }
+            readyToCalculateRateAxisCnt = FD_YAW; // throttle channel doesn't require rate calculation
             readyToCalculateRate = true;
         }
     } else {
+        rcSmoothingFilterActive = false;
         rcInterpolationStepCount = 0; // reset factor in case of level modes flip flopping
     }
 
@@ -244,7 +334,9 @@ void processRcCommand(void)
             calculateSetpointRate(axis);
 
         if (debugMode == DEBUG_RC_INTERPOLATION) {
-            debug[2] = rcInterpolationStepCount;
+            if (rxConfig()->rcInterpolation != RC_SMOOTHING_FILTER) {
+                debug[2] = rcInterpolationStepCount;
+            }
             debug[3] = setpointRate[0];
         }
         // Scaling of AngleRate to camera angle (Mixing Roll and Yaw)
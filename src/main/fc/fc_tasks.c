@@ -268,6 +268,34 @@ void taskCameraControl(uint32_t currentTime)
 }
 #endif
 
+#ifdef USE_MSP_STREAM
+static void taskMspStream(timeUs_t currentTimeUs)
+{
+#ifdef USE_CLI
+    // the MSP port is taken over by the cli
+    if (cliMode) {
+        return;
+    }
+#endif
+    mspSerialProcessStreamSchedule(currentTimeUs);
+}
+#endif
+
+static bool taskPidProfileCheck(timeUs_t currentTimeUs, timeDelta_t currentDeltaTimeUs)
+{
+    UNUSED(currentTimeUs);
+    UNUSED(currentDeltaTimeUs);
+
+    return pidProfileChangePending();
+}
+
+static void taskPidProfile(timeUs_t currentTimeUs)
+{
+    UNUSED(currentTimeUs);
+
+    pidProcessProfileChange();
+}
+
 void fcTasksInit(void)
 {
     schedulerInit();
@@ -283,6 +311,7 @@ void fcTasksInit(void)
     }
 
     setTaskEnabled(TASK_ATTITUDE, sensors(SENSOR_ACC));
+    setTaskEnabled(TASK_PID_PROFILE, true);
     setTaskEnabled(TASK_SERIAL, true);
     rescheduleTask(TASK_SERIAL, TASK_PERIOD_HZ(serialConfig()->serial_update_rate_hz));
 
@@ -412,6 +441,14 @@ cfTask_t cfTasks[TASK_COUNT] = {
         .desiredPeriod = TASK_PERIOD_HZ(50),        // If event-based scheduling doesn't work, fallback to periodic scheduling
         .staticPriority = TASK_PRIORITY_HIGH,
     },
+
+    [TASK_PID_PROFILE] = {
+        .taskName = "PID_PROFILE",
+        .checkFunc = taskPidProfileCheck,
+        .taskFunc = taskPidProfile,
+        .desiredPeriod = TASK_PERIOD_HZ(100),       // event driven, runs once per profile change
+        .staticPriority = TASK_PRIORITY_LOW,
+    },
 #endif
 
     [TASK_SERIAL] = {
@@ -631,5 +668,14 @@ cfTask_t cfTasks[TASK_COUNT] = {
         .staticPriority = TASK_PRIORITY_IDLE
     },
 #endif
+
+#ifdef USE_MSP_STREAM
+    [TASK_MSP_STREAM] = {
+        .taskName = "MSP_STREAM",
+        .taskFunc = taskMspStream,
+        .desiredPeriod = TASK_PERIOD_HZ(100),       // stream intervals have a 10ms resolution
+        .staticPriority = TASK_PRIORITY_LOW,
+    },
+#endif
 #endif
 };
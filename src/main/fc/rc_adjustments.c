@@ -225,11 +225,13 @@ static void applyStepAdjustment(controlRateConfig_t *controlRateConfig, uint8_t
     case ADJUSTMENT_RC_RATE:
         newValue = constrain((int)controlRateConfig->rcRate8 + delta, 0, 250); // FIXME magic numbers repeated in cli.c
         controlRateConfig->rcRate8 = newValue;
+        generateRateCurves();
         blackboxLogInflightAdjustmentEvent(ADJUSTMENT_RC_RATE, newValue);
         break;
     case ADJUSTMENT_RC_EXPO:
         newValue = constrain((int)controlRateConfig->rcExpo8 + delta, 0, 100); // FIXME magic numbers repeated in cli.c
         controlRateConfig->rcExpo8 = newValue;
+        generateRateCurves();
         blackboxLogInflightAdjustmentEvent(ADJUSTMENT_RC_EXPO, newValue);
         break;
     case ADJUSTMENT_THROTTLE_EXPO:
@@ -242,6 +244,7 @@ static void applyStepAdjustment(controlRateConfig_t *controlRateConfig, uint8_t
     case ADJUSTMENT_PITCH_RATE:
         newValue = constrain((int)controlRateConfig->rates[FD_PITCH] + delta, 0, CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX);
         controlRateConfig->rates[FD_PITCH] = newValue;
+        generateRateCurves();
         blackboxLogInflightAdjustmentEvent(ADJUSTMENT_PITCH_RATE, newValue);
         if (adjustmentFunction == ADJUSTMENT_PITCH_RATE) {
             break;
@@ -250,11 +253,13 @@ static void applyStepAdjustment(controlRateConfig_t *controlRateConfig, uint8_t
     case ADJUSTMENT_ROLL_RATE:
         newValue = constrain((int)controlRateConfig->rates[FD_ROLL] + delta, 0, CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX);
         controlRateConfig->rates[FD_ROLL] = newValue;
+        generateRateCurves();
         blackboxLogInflightAdjustmentEvent(ADJUSTMENT_ROLL_RATE, newValue);
         break;
     case ADJUSTMENT_YAW_RATE:
         newValue = constrain((int)controlRateConfig->rates[FD_YAW] + delta, 0, CONTROL_RATE_CONFIG_YAW_RATE_MAX);
         controlRateConfig->rates[FD_YAW] = newValue;
+        generateRateCurves();
         blackboxLogInflightAdjustmentEvent(ADJUSTMENT_YAW_RATE, newValue);
         break;
     case ADJUSTMENT_PITCH_ROLL_P:
@@ -318,6 +323,7 @@ static void applyStepAdjustment(controlRateConfig_t *controlRateConfig, uint8_t
     case ADJUSTMENT_RC_RATE_YAW:
         newValue = constrain((int)controlRateConfig->rcYawRate8 + delta, 0, 300); // FIXME magic numbers repeated in cli.c
         controlRateConfig->rcYawRate8 = newValue;
+        generateRateCurves();
         blackboxLogInflightAdjustmentEvent(ADJUSTMENT_RC_RATE_YAW, newValue);
         break;
     case ADJUSTMENT_D_SETPOINT:
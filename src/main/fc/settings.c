@@ -75,6 +75,7 @@
 #include "sensors/gyro.h"
 
 #include "telemetry/frsky.h"
+#include "telemetry/mavlink.h"
 #include "telemetry/telemetry.h"
 
 // Sensor names (used in lookup tables for *_hardware settings and in status command output)
@@ -226,7 +227,7 @@ static const char * const lookupTablePwmProtocol[] = {
 };
 
 static const char * const lookupTableRcInterpolation[] = {
-    "OFF", "PRESET", "AUTO", "MANUAL"
+    "OFF", "PRESET", "AUTO", "MANUAL", "FILTER"
 };
 
 static const char * const lookupTableRcInterpolationChannels[] = {
@@ -304,6 +305,11 @@ const clivalue_t valueTable[] = {
     { "gyro_notch1_cutoff",         VAR_UINT16 | MASTER_VALUE, .config.minmax = { 1, 16000 }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, gyro_soft_notch_cutoff_1) },
     { "gyro_notch2_hz",             VAR_UINT16 | MASTER_VALUE, .config.minmax = { 0, 16000 }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, gyro_soft_notch_hz_2) },
     { "gyro_notch2_cutoff",         VAR_UINT16 | MASTER_VALUE, .config.minmax = { 1, 16000 }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, gyro_soft_notch_cutoff_2) },
+#ifdef USE_RPM_FILTER
+    { "gyro_rpm_notch_harmonics",   VAR_UINT8  | MASTER_VALUE, .config.minmax = { 0, RPM_NOTCH_HARMONICS_MAX }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, gyro_rpm_notch_harmonics) },
+    { "gyro_rpm_notch_min_hz",      VAR_UINT8  | MASTER_VALUE, .config.minmax = { 50, 200 }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, gyro_rpm_notch_min_hz) },
+    { "gyro_rpm_notch_q",           VAR_UINT16 | MASTER_VALUE, .config.minmax = { 250, 3000 }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, gyro_rpm_notch_q) },
+#endif
     { "moron_threshold",            VAR_UINT8  | MASTER_VALUE, .config.minmax = { 0,  200 }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, gyroMovementCalibrationThreshold) },
 #if defined(GYRO_USES_SPI)
 #if defined(USE_GYRO_SPI_MPU6500) || defined(USE_GYRO_SPI_MPU9250) || defined(USE_GYRO_SPI_ICM20689)
@@ -393,6 +399,12 @@ const clivalue_t valueTable[] = {
     { "dshot_idle_value",           VAR_UINT16  | MASTER_VALUE, .config.minmax = { 0, 2000 }, PG_MOTOR_CONFIG, offsetof(motorConfig_t, digitalIdleOffsetValue) },
 #endif
     { "use_unsynced_pwm",           VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_MOTOR_CONFIG, offsetof(motorConfig_t, dev.useUnsyncedPwm) },
+#ifdef USE_DSHOT_TELEMETRY
+    { "dshot_bidir",                VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_MOTOR_CONFIG, offsetof(motorConfig_t, dev.useDshotTelemetry) },
+#endif
+#ifdef USE_RPM_FILTER
+    { "motor_poles",                VAR_UINT8  | MASTER_VALUE, .config.minmax = { 4, UINT8_MAX }, PG_MOTOR_CONFIG, offsetof(motorConfig_t, motorPoleCount) },
+#endif
     { "motor_pwm_protocol",         VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_MOTOR_PWM_PROTOCOL }, PG_MOTOR_CONFIG, offsetof(motorConfig_t, dev.motorPwmProtocol) },
     { "motor_pwm_rate",             VAR_UINT16 | MASTER_VALUE, .config.minmax = { 200, 32000 }, PG_MOTOR_CONFIG, offsetof(motorConfig_t, dev.motorPwmRate) },
     { "motor_pwm_inversion",        VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_MOTOR_CONFIG, offsetof(motorConfig_t, dev.motorPwmInversion) },
@@ -618,6 +630,13 @@ const clivalue_t valueTable[] = {
 #if defined(TELEMETRY_IBUS)
     { "report_cell_voltage",        VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_TELEMETRY_CONFIG, offsetof(telemetryConfig_t, report_cell_voltage) },
 #endif
+#if defined(TELEMETRY_MAVLINK)
+    { "mavlink_ext_status_rate",    VAR_UINT8  | MASTER_VALUE, .config.minmax = { 0, TELEMETRY_MAVLINK_MAXRATE }, PG_TELEMETRY_CONFIG, offsetof(telemetryConfig_t, mavlink_extended_status_rate) },
+    { "mavlink_rc_chan_rate",       VAR_UINT8  | MASTER_VALUE, .config.minmax = { 0, TELEMETRY_MAVLINK_MAXRATE }, PG_TELEMETRY_CONFIG, offsetof(telemetryConfig_t, mavlink_rc_channels_rate) },
+    { "mavlink_pos_rate",           VAR_UINT8  | MASTER_VALUE, .config.minmax = { 0, TELEMETRY_MAVLINK_MAXRATE }, PG_TELEMETRY_CONFIG, offsetof(telemetryConfig_t, mavlink_position_rate) },
+    { "mavlink_extra1_rate",        VAR_UINT8  | MASTER_VALUE, .config.minmax = { 0, TELEMETRY_MAVLINK_MAXRATE }, PG_TELEMETRY_CONFIG, offsetof(telemetryConfig_t, mavlink_extra1_rate) },
+    { "mavlink_extra2_rate",        VAR_UINT8  | MASTER_VALUE, .config.minmax = { 0, TELEMETRY_MAVLINK_MAXRATE }, PG_TELEMETRY_CONFIG, offsetof(telemetryConfig_t, mavlink_extra2_rate) },
+#endif
 #endif
 
 // PG_LED_STRIP_CONFIG
@@ -761,6 +780,43 @@ const clivalue_t valueTable[] = {
 
 const uint16_t valueTableEntryCount = ARRAYLEN(valueTable);
 
+#ifdef USE_CLI_VALUE_INDEX
+uint16_t valueTableNameIndex[ARRAYLEN(valueTable)];
+#endif
+
+uint16_t getValueOffset(const clivalue_t *value)
+{
+    switch (value->type & VALUE_SECTION_MASK) {
+    case MASTER_VALUE:
+        return value->offset;
+    case PROFILE_VALUE:
+        return value->offset + sizeof(pidProfile_t) * getCurrentPidProfileIndex();
+    case PROFILE_RATE_VALUE:
+        return value->offset + sizeof(controlRateConfig_t) * getCurrentControlRateProfileIndex();
+    }
+    return 0;
+}
+
+void *getValuePointer(const clivalue_t *value)
+{
+    const pgRegistry_t* rec = pgFind(value->pgn);
+    if (!rec) {
+        // the parameter group is not built into this target
+        return NULL;
+    }
+    return CONST_CAST(void *, rec->address + getValueOffset(value));
+}
+
+// size of the value in bytes, arrays included
+uint8_t getValueSize(const clivalue_t *value)
+{
+    const uint8_t typeSize = (value->type & VALUE_TYPE_MASK) >= VAR_UINT16 ? sizeof(uint16_t) : sizeof(uint8_t);
+    if ((value->type & VALUE_MODE_MASK) == MODE_ARRAY) {
+        return typeSize * value->config.array.length;
+    }
+    return typeSize;
+}
+
 void settingsBuildCheck() {
     BUILD_BUG_ON(LOOKUP_TABLE_COUNT != ARRAYLEN(lookupTables));
 }
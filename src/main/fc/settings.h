@@ -135,6 +135,15 @@ extern const uint16_t valueTableEntryCount;
 extern const clivalue_t valueTable[];
 //extern const uint8_t lookupTablesEntryCount;
 
+#ifdef USE_CLI_VALUE_INDEX
+// valueTable indices ordered by name, filled by the CLI
+extern uint16_t valueTableNameIndex[];
+#endif
+
+uint16_t getValueOffset(const clivalue_t *value);
+void *getValuePointer(const clivalue_t *value);
+uint8_t getValueSize(const clivalue_t *value);
+
 extern const char * const lookupTableGyroHardware[];
 
 extern const char * const lookupTableAccHardware[];
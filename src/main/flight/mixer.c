@@ -63,7 +63,7 @@ PG_RESET_TEMPLATE(mixerConfig_t, mixerConfig,
     .yaw_motors_reversed = false,
 );
 
-PG_REGISTER_WITH_RESET_FN(motorConfig_t, motorConfig, PG_MOTOR_CONFIG, 0);
+PG_REGISTER_WITH_RESET_FN(motorConfig_t, motorConfig, PG_MOTOR_CONFIG, 2);
 
 void pgResetFn_motorConfig(motorConfig_t *motorConfig)
 {
@@ -90,6 +90,7 @@ void pgResetFn_motorConfig(motorConfig_t *motorConfig)
     motorConfig->maxthrottle = 2000;
     motorConfig->mincommand = 1000;
     motorConfig->digitalIdleOffsetValue = 450;
+    motorConfig->motorPoleCount = 14;
 
     int motorIndex = 0;
     for (int i = 0; i < USABLE_TIMER_CHANNEL_COUNT && motorIndex < MAX_SUPPORTED_MOTORS; i++) {
@@ -120,6 +121,11 @@ float motor_disarmed[MAX_SUPPORTED_MOTORS];
 mixerMode_e currentMixerMode;
 static motorMixer_t currentMixer[MAX_SUPPORTED_MOTORS];
 
+// currentMixer with motor and yaw direction folded in, rebuilt only when either direction changes
+static motorMixer_t mixMatrix[MAX_SUPPORTED_MOTORS];
+static int8_t mixMatrixMotorDirection;
+static int8_t mixMatrixYawDirection;
+
 float pidSumLimit;
 float pidSumLimitYaw;
 
@@ -385,6 +391,19 @@ void pidInitMixer(const struct pidProfile_s *pidProfile)
     pidSumLimitYaw = CONVERT_PARAMETER_TO_FLOAT(pidProfile->pidSumLimitYaw);
 }
 
+static void mixerUpdateMatrix(void)
+{
+    mixMatrixMotorDirection = GET_DIRECTION(isMotorsReversed());
+    mixMatrixYawDirection = GET_DIRECTION(mixerConfig()->yaw_motors_reversed);
+
+    for (int i = 0; i < MAX_SUPPORTED_MOTORS; i++) {
+        mixMatrix[i].throttle = currentMixer[i].throttle;
+        mixMatrix[i].roll = currentMixer[i].roll * mixMatrixMotorDirection;
+        mixMatrix[i].pitch = currentMixer[i].pitch * mixMatrixMotorDirection;
+        mixMatrix[i].yaw = currentMixer[i].yaw * -mixMatrixYawDirection * mixMatrixMotorDirection;
+    }
+}
+
 #ifndef USE_QUAD_MIXER_ONLY
 
 void mixerConfigureOutput(void)
@@ -423,6 +442,7 @@ void mixerConfigureOutput(void)
         }
     }
 
+    mixerUpdateMatrix();
     mixerResetDisarmedMotors();
 }
 
@@ -451,6 +471,7 @@ void mixerConfigureOutput(void)
         currentMixer[i] = mixerQuadX[i];
     }
 
+    mixerUpdateMatrix();
     mixerResetDisarmedMotors();
 }
 #endif
@@ -466,6 +487,9 @@ void mixerResetDisarmedMotors(void)
 void writeMotors(void)
 {
     if (pwmAreMotorsEnabled()) {
+#ifdef USE_DSHOT_TELEMETRY
+        pwmStartDshotMotorUpdate(motorCount);
+#endif
         for (int i = 0; i < motorCount; i++) {
             pwmWriteMotor(i, motor[i]);
         }
@@ -543,42 +567,45 @@ void calculateThrottleAndCurrentMotorEndpoints(void)
     motorOutputRange = motorOutputMax - motorOutputMin;
 }
 
-void applyMixToMotors(float motorMix[MAX_SUPPORTED_MOTORS]) {
+static void applyMixToMotors(const float motorMix[MAX_SUPPORTED_MOTORS], float mixScale)
+{
+    if (!ARMING_FLAG(ARMED)) {
+        for (int i = 0; i < motorCount; i++) {
+            motor[i] = motor_disarmed[i];
+        }
+        return;
+    }
+
+    // Conditions that are constant for all motors are resolved once per loop
+    const bool failsafeActive = failsafeIsActive();
+    const bool failsafeDshot = failsafeActive && isMotorProtocolDshot();
+    const float motorOutputLimitLow = failsafeActive ? disarmMotorOutput : motorOutputMin;
+    const bool motorStop = feature(FEATURE_MOTOR_STOP) && !feature(FEATURE_3D) && !isAirmodeActive()
+        && rcData[THROTTLE] < rxConfig()->mincheck;
+
+    const float throttleOutput = motorOutputRange * throttle;
+
     // Now add in the desired throttle, but keep in a range that doesn't clip adjusted
     // roll/pitch/yaw. This could move throttle down, but also up for those low throttle flips.
-    for (uint32_t i = 0; i < motorCount; i++) {
-        float motorOutput = motorOutputMin + motorOutputRange * (motorMix[i] + (throttle * currentMixer[i].throttle));
+    for (int i = 0; i < motorCount; i++) {
+        float motorOutput = motorOutputMin + motorMix[i] * mixScale + throttleOutput * mixMatrix[i].throttle;
 
         // Dshot works exactly opposite in lower 3D section.
         if (mixerInversion) {
             motorOutput = motorOutputMin + (motorOutputMax - motorOutput);
         }
 
-        if (failsafeIsActive()) {
-            if (isMotorProtocolDshot()) {
-                motorOutput = (motorOutput < motorOutputMin) ? disarmMotorOutput : motorOutput; // Prevent getting into special reserved range
-            }
-
-            motorOutput = constrain(motorOutput, disarmMotorOutput, motorOutputMax);
-        } else {
-            motorOutput = constrain(motorOutput, motorOutputMin, motorOutputMax);
+        if (failsafeDshot && motorOutput < motorOutputMin) {
+            motorOutput = disarmMotorOutput; // Prevent getting into special reserved range
         }
+        motorOutput = constrain(motorOutput, motorOutputLimitLow, motorOutputMax);
 
         // Motor stop handling
-        if (feature(FEATURE_MOTOR_STOP) && ARMING_FLAG(ARMED) && !feature(FEATURE_3D) && !isAirmodeActive()) {
-            if (((rcData[THROTTLE]) < rxConfig()->mincheck)) {
-                motorOutput = disarmMotorOutput;
-            }
+        if (motorStop) {
+            motorOutput = disarmMotorOutput;
         }
         motor[i] = motorOutput;
     }
-
-    // Disarmed mode
-    if (!ARMING_FLAG(ARMED)) {
-        for (int i = 0; i < motorCount; i++) {
-            motor[i] = motor_disarmed[i];
-        }
-    }
 }
 
 void mixTable(uint8_t vbatPidCompensation)
@@ -586,33 +613,35 @@ void mixTable(uint8_t vbatPidCompensation)
     // Find min and max throttle based on conditions. Throttle has to be known before mixing
     calculateThrottleAndCurrentMotorEndpoints();
 
+    // Motor direction only changes on arming, rebuild the signed matrix when it (or the yaw direction) does
+    if (mixMatrixMotorDirection != GET_DIRECTION(isMotorsReversed())
+        || mixMatrixYawDirection != GET_DIRECTION(mixerConfig()->yaw_motors_reversed)) {
+        mixerUpdateMatrix();
+    }
+
     float motorMix[MAX_SUPPORTED_MOTORS];
 
+    // Calculate voltage compensation, the mix is linear so it is applied to the PIDsums instead of every motor
+    float vbatCompensationFactor = (vbatPidCompensation) ? calculateVbatPidCompensation() : 1.0f;
+    if (vbatCompensationFactor < 1.0f) {
+        vbatCompensationFactor = 1.0f;
+    }
+
     // Calculate and Limit the PIDsum
-    const float scaledAxisPidRoll =
+    const float scaledAxisPidRoll = vbatCompensationFactor *
         constrainf((axisPID_P[FD_ROLL] + axisPID_I[FD_ROLL] + axisPID_D[FD_ROLL]) / PID_MIXER_SCALING, -pidSumLimit, pidSumLimit);
-    const float scaledAxisPidPitch =
+    const float scaledAxisPidPitch = vbatCompensationFactor *
         constrainf((axisPID_P[FD_PITCH] + axisPID_I[FD_PITCH] + axisPID_D[FD_PITCH]) / PID_MIXER_SCALING, -pidSumLimit, pidSumLimit);
-    const float scaledAxisPidYaw =
+    const float scaledAxisPidYaw = vbatCompensationFactor *
         constrainf((axisPID_P[FD_YAW] + axisPID_I[FD_YAW]) / PID_MIXER_SCALING, -pidSumLimitYaw, pidSumLimitYaw);
 
-    // Calculate voltage compensation
-    const float vbatCompensationFactor = (vbatPidCompensation)  ? calculateVbatPidCompensation() : 1.0f;
-
     // Find roll/pitch/yaw desired output
     float motorMixMax = 0, motorMixMin = 0;
-    const int yawDirection = GET_DIRECTION(mixerConfig()->yaw_motors_reversed);
-    int motorDirection = GET_DIRECTION(isMotorsReversed());
-  
     for (int i = 0; i < motorCount; i++) {
-        float mix =
-            scaledAxisPidRoll  * currentMixer[i].roll  * (motorDirection) +
-            scaledAxisPidPitch * currentMixer[i].pitch * (motorDirection) +
-            scaledAxisPidYaw   * currentMixer[i].yaw * (-yawDirection) * (motorDirection);
-
-        if (vbatCompensationFactor > 1.0f) {
-            mix *= vbatCompensationFactor;  // Add voltage compensation
-        }
+        const float mix =
+            scaledAxisPidRoll  * mixMatrix[i].roll +
+            scaledAxisPidPitch * mixMatrix[i].pitch +
+            scaledAxisPidYaw   * mixMatrix[i].yaw;
 
         if (mix > motorMixMax) {
             motorMixMax = mix;
@@ -624,10 +653,10 @@ void mixTable(uint8_t vbatPidCompensation)
 
     motorMixRange = motorMixMax - motorMixMin;
 
+    // Desaturation is folded into the output scale instead of normalising every motor
+    float mixScale = motorOutputRange;
     if (motorMixRange > 1.0f) {
-        for (int i = 0; i < motorCount; i++) {
-            motorMix[i] /= motorMixRange;
-        }
+        mixScale /= motorMixRange;
         // Get the maximum correction by setting offset to center when airmode enabled
         if (isAirmodeActive()) {
             throttle = 0.5f;
@@ -640,7 +669,7 @@ void mixTable(uint8_t vbatPidCompensation)
     }
 
     // Apply the mix to motor endpoints
-    applyMixToMotors(motorMix);
+    applyMixToMotors(motorMix, mixScale);
 }
 
 float convertExternalToMotor(uint16_t externalValue)
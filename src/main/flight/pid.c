@@ -165,9 +165,27 @@ typedef union dtermFilterLpf_u {
     firFilterDenoise_t denoisingFilter[2];
 } dtermFilterLpf_t;
 
-void pidInitFilters(const pidProfile_t *pidProfile)
+static biquadFilter_t biquadFilterNotch[2];
+static dtermFilterLpf_t dtermFilterLpfUnion;
+static pt1Filter_t pt1FilterYaw;
+
+// filter coefficients of a profile, the trigonometry is done here so applying them is only copying
+typedef struct pidFilterSet_s {
+    filterApplyFnPtr dtermNotchApplyFn;
+    biquadFilter_t dtermNotch;
+    filterApplyFnPtr dtermLpfApplyFn;
+    union {
+        pt1Filter_t pt1Filter;
+        biquadFilter_t biquadFilter;
+    } dtermLpf;
+    uint16_t dtermLpfHz;
+    filterApplyFnPtr ptermYawApplyFn;
+    pt1Filter_t ptermYaw;
+} pidFilterSet_t;
+
+static void pidComputeFilterSet(pidFilterSet_t *filterSet, const pidProfile_t *pidProfile)
 {
-    BUILD_BUG_ON(FD_YAW != 2); // only setting up Dterm filters on roll and pitch axes, so ensure yaw axis is 2
+    memset(filterSet, 0, sizeof(pidFilterSet_t));
 
     const uint32_t pidFrequencyNyquist = (1.0f / dT) / 2; // No rounding needed
 
@@ -182,60 +200,124 @@ void pidInitFilters(const pidProfile_t *pidProfile)
         }
     }
 
-    static biquadFilter_t biquadFilterNotch[2];
     if (dTermNotchHz) {
-        dtermNotchFilterApplyFn = (filterApplyFnPtr)biquadFilterApply;
+        filterSet->dtermNotchApplyFn = (filterApplyFnPtr)biquadFilterApply;
         const float notchQ = filterGetNotchQ(dTermNotchHz, pidProfile->dterm_notch_cutoff);
-        for (int axis = FD_ROLL; axis <= FD_PITCH; axis++) {
-            dtermFilterNotch[axis] = &biquadFilterNotch[axis];
-            biquadFilterInit(dtermFilterNotch[axis], dTermNotchHz, targetPidLooptime, notchQ, FILTER_NOTCH);
-        }
+        biquadFilterInit(&filterSet->dtermNotch, dTermNotchHz, targetPidLooptime, notchQ, FILTER_NOTCH);
     } else {
-        dtermNotchFilterApplyFn = nullFilterApply;
+        filterSet->dtermNotchApplyFn = nullFilterApply;
     }
 
-    static dtermFilterLpf_t dtermFilterLpfUnion;
     if (pidProfile->dterm_lpf_hz == 0 || pidProfile->dterm_lpf_hz > pidFrequencyNyquist) {
-        dtermLpfApplyFn = nullFilterApply;
+        filterSet->dtermLpfApplyFn = nullFilterApply;
     } else {
         switch (pidProfile->dterm_filter_type) {
         default:
-            dtermLpfApplyFn = nullFilterApply;
+            filterSet->dtermLpfApplyFn = nullFilterApply;
             break;
         case FILTER_PT1:
-            dtermLpfApplyFn = (filterApplyFnPtr)pt1FilterApply;
-            for (int axis = FD_ROLL; axis <= FD_PITCH; axis++) {
-                dtermFilterLpf[axis] = &dtermFilterLpfUnion.pt1Filter[axis];
-                pt1FilterInit(dtermFilterLpf[axis], pidProfile->dterm_lpf_hz, dT);
-            }
+            filterSet->dtermLpfApplyFn = (filterApplyFnPtr)pt1FilterApply;
+            pt1FilterInit(&filterSet->dtermLpf.pt1Filter, pidProfile->dterm_lpf_hz, dT);
             break;
         case FILTER_BIQUAD:
-            dtermLpfApplyFn = (filterApplyFnPtr)biquadFilterApply;
-            for (int axis = FD_ROLL; axis <= FD_PITCH; axis++) {
-                dtermFilterLpf[axis] = &dtermFilterLpfUnion.biquadFilter[axis];
-                biquadFilterInitLPF(dtermFilterLpf[axis], pidProfile->dterm_lpf_hz, targetPidLooptime);
-            }
+            filterSet->dtermLpfApplyFn = (filterApplyFnPtr)biquadFilterApply;
+            biquadFilterInitLPF(&filterSet->dtermLpf.biquadFilter, pidProfile->dterm_lpf_hz, targetPidLooptime);
             break;
         case FILTER_FIR:
-            dtermLpfApplyFn = (filterApplyFnPtr)firFilterDenoiseUpdate;
-            for (int axis = FD_ROLL; axis <= FD_PITCH; axis++) {
-                dtermFilterLpf[axis] = &dtermFilterLpfUnion.denoisingFilter[axis];
-                firFilterDenoiseInit(dtermFilterLpf[axis], pidProfile->dterm_lpf_hz, targetPidLooptime);
-            }
+            filterSet->dtermLpfApplyFn = (filterApplyFnPtr)firFilterDenoiseUpdate;
+            filterSet->dtermLpfHz = pidProfile->dterm_lpf_hz;
             break;
         }
     }
 
-    static pt1Filter_t pt1FilterYaw;
     if (pidProfile->yaw_lpf_hz == 0 || pidProfile->yaw_lpf_hz > pidFrequencyNyquist) {
-        ptermYawFilterApplyFn = nullFilterApply;
+        filterSet->ptermYawApplyFn = nullFilterApply;
     } else {
-        ptermYawFilterApplyFn = (filterApplyFnPtr)pt1FilterApply;
-        ptermYawFilter = &pt1FilterYaw;
-        pt1FilterInit(ptermYawFilter, pidProfile->yaw_lpf_hz, dT);
+        filterSet->ptermYawApplyFn = (filterApplyFnPtr)pt1FilterApply;
+        pt1FilterInit(&filterSet->ptermYaw, pidProfile->yaw_lpf_hz, dT);
     }
 }
 
+static void biquadFilterCopyCoefficients(biquadFilter_t *filter, const biquadFilter_t *from)
+{
+    filter->b0 = from->b0;
+    filter->b1 = from->b1;
+    filter->b2 = from->b2;
+    filter->a1 = from->a1;
+    filter->a2 = from->a2;
+}
+
+static void pt1FilterCopyCoefficients(pt1Filter_t *filter, const pt1Filter_t *from)
+{
+    filter->k = from->k;
+    filter->RC = from->RC;
+    filter->dT = from->dT;
+}
+
+// Filters of an unchanged type keep their state so the D term does not glitch, new ones start from zero.
+static void pidApplyFilterSet(const pidFilterSet_t *filterSet)
+{
+    const bool notchKept = dtermNotchFilterApplyFn == filterSet->dtermNotchApplyFn;
+    const bool lpfKept = dtermLpfApplyFn == filterSet->dtermLpfApplyFn;
+    const bool yawKept = ptermYawFilterApplyFn == filterSet->ptermYawApplyFn;
+
+    for (int axis = FD_ROLL; axis <= FD_PITCH; axis++) {
+        if (notchKept) {
+            biquadFilterCopyCoefficients(&biquadFilterNotch[axis], &filterSet->dtermNotch);
+        } else {
+            biquadFilterNotch[axis] = filterSet->dtermNotch;
+        }
+        dtermFilterNotch[axis] = &biquadFilterNotch[axis];
+
+        if (filterSet->dtermLpfApplyFn == (filterApplyFnPtr)pt1FilterApply) {
+            if (lpfKept) {
+                pt1FilterCopyCoefficients(&dtermFilterLpfUnion.pt1Filter[axis], &filterSet->dtermLpf.pt1Filter);
+            } else {
+                dtermFilterLpfUnion.pt1Filter[axis] = filterSet->dtermLpf.pt1Filter;
+            }
+            dtermFilterLpf[axis] = &dtermFilterLpfUnion.pt1Filter[axis];
+        } else if (filterSet->dtermLpfApplyFn == (filterApplyFnPtr)biquadFilterApply) {
+            if (lpfKept) {
+                biquadFilterCopyCoefficients(&dtermFilterLpfUnion.biquadFilter[axis], &filterSet->dtermLpf.biquadFilter);
+            } else {
+                dtermFilterLpfUnion.biquadFilter[axis] = filterSet->dtermLpf.biquadFilter;
+            }
+            dtermFilterLpf[axis] = &dtermFilterLpfUnion.biquadFilter[axis];
+        } else if (filterSet->dtermLpfApplyFn == (filterApplyFnPtr)firFilterDenoiseUpdate) {
+            firFilterDenoise_t *denoisingFilter = &dtermFilterLpfUnion.denoisingFilter[axis];
+            const int targetCount = denoisingFilter->targetCount;
+            firFilterDenoiseInit(denoisingFilter, filterSet->dtermLpfHz, targetPidLooptime);
+            // the window position is only valid for the window size it was filled with
+            if (!lpfKept || denoisingFilter->targetCount != targetCount) {
+                const int newTargetCount = denoisingFilter->targetCount;
+                memset(denoisingFilter, 0, sizeof(firFilterDenoise_t));
+                denoisingFilter->targetCount = newTargetCount;
+            }
+            dtermFilterLpf[axis] = denoisingFilter;
+        }
+    }
+
+    if (yawKept) {
+        pt1FilterCopyCoefficients(&pt1FilterYaw, &filterSet->ptermYaw);
+    } else {
+        pt1FilterYaw = filterSet->ptermYaw;
+    }
+    ptermYawFilter = &pt1FilterYaw;
+
+    dtermNotchFilterApplyFn = filterSet->dtermNotchApplyFn;
+    dtermLpfApplyFn = filterSet->dtermLpfApplyFn;
+    ptermYawFilterApplyFn = filterSet->ptermYawApplyFn;
+}
+
+void pidInitFilters(const pidProfile_t *pidProfile)
+{
+    BUILD_BUG_ON(FD_YAW != 2); // only setting up Dterm filters on roll and pitch axes, so ensure yaw axis is 2
+
+    static pidFilterSet_t filterSet;
+    pidComputeFilterSet(&filterSet, pidProfile);
+    pidApplyFilterSet(&filterSet);
+}
+
 static float Kp[3], Ki[3], Kd[3];
 static float maxVelocity[3];
 static float relaxFactor;
@@ -279,8 +361,50 @@ void pidInitConfig(const pidProfile_t *pidProfile)
     crashSetpointThreshold = pidProfile->crash_setpoint_threshold;
 }
 
+/*
+ * Profile changes while the pid loop is running are done in two steps, the filter coefficients are computed by
+ * pidProcessProfileChange() from a background task and pidController() swaps them in before its next iteration.
+ */
+static const pidProfile_t *pidProfileChangeRequested;
+static const pidProfile_t *pidProfileChangeReady;
+static pidFilterSet_t pidProfileChangeFilterSet;
+
+void pidChangeProfile(const pidProfile_t *pidProfile)
+{
+    pidProfileChangeRequested = pidProfile;
+}
+
+bool pidProfileChangePending(void)
+{
+    return pidProfileChangeRequested != NULL;
+}
+
+void pidProcessProfileChange(void)
+{
+    // a set that has not been swapped in yet is replaced, the newest request wins
+    pidProfileChangeReady = NULL;
+    const pidProfile_t *pidProfile = pidProfileChangeRequested;
+    if (pidProfile) {
+        pidComputeFilterSet(&pidProfileChangeFilterSet, pidProfile);
+        pidProfileChangeRequested = NULL;
+        pidProfileChangeReady = pidProfile;
+    }
+}
+
+static void pidApplyProfileChange(void)
+{
+    pidApplyFilterSet(&pidProfileChangeFilterSet);
+    pidInitConfig(pidProfileChangeReady);
+    pidInitMixer(pidProfileChangeReady);
+    pidProfileChangeReady = NULL;
+}
+
 void pidInit(const pidProfile_t *pidProfile)
 {
+    // supersedes any profile change in progress
+    pidProfileChangeRequested = NULL;
+    pidProfileChangeReady = NULL;
+
     pidSetTargetLooptime(gyro.targetLooptime * pidConfig()->pid_process_denom); // Initialize pid looptime
     pidInitFilters(pidProfile);
     pidInitConfig(pidProfile);
@@ -385,6 +509,10 @@ void pidController(const pidProfile_t *pidProfile, const rollAndPitchTrims_t *an
     static bool inCrashRecoveryMode = false;
     static timeUs_t crashDetectedAtUs;
 
+    if (pidProfileChangeReady) {
+        pidApplyProfileChange();
+    }
+
     // Dynamic ki component to gradually scale back integration when above windup point
     const float dynKi = MIN((1.0f - motorMixRange) * ITermWindupPointInv, 1.0f);
 
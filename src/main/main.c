@@ -20,17 +20,33 @@
 
 #include "platform.h"
 
+#ifdef SIMULATOR_BUILD
+#include <stdio.h>
+#endif
+
 #include "fc/fc_init.h"
 
 #include "scheduler/scheduler.h"
 
+#ifdef SIMULATOR_BUILD
+int main(int argc, char *argv[])
+{
+    targetParseArgs(argc, argv);
+#else
 int main(void)
 {
+#endif
     init();
+#ifdef SIMULATOR_BUILD
+    // boot time benchmark, the real time clock starts in systemInit() at the beginning of init()
+    printf("[system]init took %uus\n", (unsigned)micros64_real());
+#endif
     while (true) {
         scheduler();
         processLoopback();
-#ifdef SIMULATOR_BUILD
+#if defined(SIMULATOR_LOCKSTEP)
+        simulatorLockstepUpdate();
+#elif defined(SIMULATOR_BUILD)
         delayMicroseconds_real(50); // max rate 20kHz
 #endif
     }
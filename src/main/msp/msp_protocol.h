@@ -269,6 +269,10 @@
 #define MSP_MOTOR_CONFIG         131    //out message         Motor configuration (min/max throttle, etc)
 #define MSP_GPS_CONFIG           132    //out message         GPS configuration
 #define MSP_COMPASS_CONFIG       133    //out message         Compass configuration
+#define MSP_SETTINGS_INFO        134    //out message         Name, type and range of the settings from the given index on
+#define MSP_SETTINGS_LOOKUP      135    //out message         Value names of a lookup table from the given value on
+#define MSP_SETTINGS_VALUES      136    //out message         Values of the settings from the given index on
+#define MSP_STREAM_SCHEDULE      137    //out message         Commands whose replies are pushed and their intervals
 
 #define MSP_SET_RAW_RC           200    //in message          8 rc chan
 #define MSP_SET_RAW_GPS          201    //in message          fix, numsat, lat, lon, alt, speed
@@ -295,6 +299,8 @@
 #define MSP_SET_MOTOR_CONFIG     222    //out message         Motor configuration (min/max throttle, etc)
 #define MSP_SET_GPS_CONFIG       223    //out message         GPS configuration
 #define MSP_SET_COMPASS_CONFIG   224    //out message         Compass configuration
+#define MSP_SET_SETTINGS_VALUES  225    //in message          Set settings by index, all or none are set
+#define MSP_SET_STREAM_SCHEDULE  226    //in message          Set commands whose replies are pushed to this port and their intervals
 
 // #define MSP_BIND                 240    //in message          no param
 // #define MSP_ALARMS               242
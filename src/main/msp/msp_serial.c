@@ -21,16 +21,26 @@
 
 #include "platform.h"
 
+#include "common/maths.h"
 #include "common/streambuf.h"
+#include "common/time.h"
 #include "common/utils.h"
 #include "build/debug.h"
 
+#include "drivers/time.h"
+
 #include "io/serial.h"
 
 #include "msp/msp.h"
 #include "msp/msp_serial.h"
 
+// bounds the bytes a port without complete commands, e.g. flooded with non MSP data, can take per call
+#define MSP_PORT_RX_BYTES_PER_CALL 256
+// once exceeded the remaining ports are processed on the next call
+#define MSP_SERIAL_PROCESS_TIME_BUDGET_US 500
+
 static mspPort_t mspPorts[MAX_MSP_PORT_COUNT];
+static uint8_t mspFirstPortIndex; // the port processed first on the next call
 
 static void resetMspPort(mspPort_t *mspPortToReset, serialPort_t *serialPort)
 {
@@ -132,9 +142,14 @@ static uint8_t mspSerialChecksumBuf(uint8_t checksum, const uint8_t *data, int l
 
 #define JUMBO_FRAME_SIZE_LIMIT 255
 
-static int mspSerialEncode(mspPort_t *msp, mspPacket_t *packet)
+static int mspSerialFrameSize(int len)
+{
+    const int hdrLen = len < JUMBO_FRAME_SIZE_LIMIT ? 5 : 7;
+    return hdrLen + len + 1; // header, data, and checksum
+}
+
+static int mspSerialWriteFrame(mspPort_t *msp, mspPacket_t *packet)
 {
-    serialBeginWrite(msp->port);
     const int len = sbufBytesRemaining(&packet->buf);
     const int mspLen = len < JUMBO_FRAME_SIZE_LIMIT ? len : JUMBO_FRAME_SIZE_LIMIT;
     uint8_t hdr[8] = {
@@ -158,8 +173,15 @@ static int mspSerialEncode(mspPort_t *msp, mspPacket_t *packet)
         checksum = mspSerialChecksumBuf(checksum, sbufPtr(&packet->buf), len);
     }
     serialWriteBuf(msp->port, &checksum, 1);
+    return mspSerialFrameSize(len);
+}
+
+static int mspSerialEncode(mspPort_t *msp, mspPacket_t *packet)
+{
+    serialBeginWrite(msp->port);
+    const int frameSize = mspSerialWriteFrame(msp, packet);
     serialEndWrite(msp->port);
-    return sizeof(hdr) + len + 1; // header, data, and checksum
+    return frameSize;
 }
 
 static mspPostProcessFnPtr mspSerialProcessReceivedCommand(mspPort_t *msp, mspProcessCommandFnPtr mspProcessCommandFn)
@@ -209,47 +231,86 @@ static void mspSerialProcessReceivedReply(mspPort_t *msp, mspProcessReplyFnPtr m
     msp->c_state = MSP_IDLE;
 }
 
+static void mspSerialReadPayload(mspPort_t *mspPort)
+{
+    const int count = MIN(serialRxBytesWaiting(mspPort->port), (uint32_t)(mspPort->dataSize - mspPort->offset));
+    uint8_t *payload = &mspPort->inBuf[mspPort->offset];
+    serialReadBuf(mspPort->port, payload, count);
+    mspPort->checksum = mspSerialChecksumBuf(mspPort->checksum, payload, count);
+    mspPort->offset += count;
+}
+
 /*
- * Process MSP commands from serial ports configured as MSP ports.
- *
- * Called periodically by the scheduler.
+ * Processes at most one command of the port, returns true if one was processed.
  */
-void mspSerialProcess(mspEvaluateNonMspData_e evaluateNonMspData, mspProcessCommandFnPtr mspProcessCommandFn, mspProcessReplyFnPtr mspProcessReplyFn)
+static bool mspSerialProcessPort(mspPort_t *mspPort, mspEvaluateNonMspData_e evaluateNonMspData, mspProcessCommandFnPtr mspProcessCommandFn, mspProcessReplyFnPtr mspProcessReplyFn)
 {
-    for (uint8_t portIndex = 0; portIndex < MAX_MSP_PORT_COUNT; portIndex++) {
-        mspPort_t * const mspPort = &mspPorts[portIndex];
-        if (!mspPort->port) {
+    mspPostProcessFnPtr mspPostProcessFn = NULL;
+    bool commandProcessed = false;
+    uint32_t bytesLeft = MSP_PORT_RX_BYTES_PER_CALL;
+    uint32_t bytesWaiting;
+
+    while ((bytesWaiting = serialRxBytesWaiting(mspPort->port)) && bytesLeft) {
+        if (mspPort->c_state == MSP_HEADER_CMD && mspPort->offset < mspPort->dataSize) {
+            // the payload is read in bulk, the bytes after the frame are left to the next pass
+            const uint8_t offset = mspPort->offset;
+            mspSerialReadPayload(mspPort);
+            bytesLeft -= MIN(bytesLeft, (uint32_t)(mspPort->offset - offset));
             continue;
         }
 
-        mspPostProcessFnPtr mspPostProcessFn = NULL;
+        const uint8_t c = serialRead(mspPort->port);
+        const bool consumed = mspSerialProcessReceivedData(mspPort, c);
+        bytesLeft--;
 
-        while (serialRxBytesWaiting(mspPort->port)) {
-
-            const uint8_t c = serialRead(mspPort->port);
-            const bool consumed = mspSerialProcessReceivedData(mspPort, c);
+        if (!consumed && evaluateNonMspData == MSP_EVALUATE_NON_MSP_DATA) {
+            serialEvaluateNonMspData(mspPort->port, c);
+        }
 
-            if (!consumed && evaluateNonMspData == MSP_EVALUATE_NON_MSP_DATA) {
-                serialEvaluateNonMspData(mspPort->port, c);
+        if (mspPort->c_state == MSP_COMMAND_RECEIVED) {
+            if (mspPort->packetType == MSP_PACKET_COMMAND) {
+                mspPostProcessFn = mspSerialProcessReceivedCommand(mspPort, mspProcessCommandFn);
+            } else if (mspPort->packetType == MSP_PACKET_REPLY) {
+                mspSerialProcessReceivedReply(mspPort, mspProcessReplyFn);
             }
 
-            if (mspPort->c_state == MSP_COMMAND_RECEIVED) {
-                if (mspPort->packetType == MSP_PACKET_COMMAND) {
-                    mspPostProcessFn = mspSerialProcessReceivedCommand(mspPort, mspProcessCommandFn);
-                } else if (mspPort->packetType == MSP_PACKET_REPLY) {
-                    mspSerialProcessReceivedReply(mspPort, mspProcessReplyFn);
-                }
+            mspPort->c_state = MSP_IDLE;
+            commandProcessed = true;
+            break; // process one command at a time so as not to block.
+        }
+    }
 
-                mspPort->c_state = MSP_IDLE;
-                break; // process one command at a time so as not to block.
-            }
+    if (mspPostProcessFn) {
+        waitForSerialPortToFinishTransmitting(mspPort->port);
+        mspPostProcessFn(mspPort->port);
+    }
+    return commandProcessed;
+}
+
+/*
+ * Process MSP commands from serial ports configured as MSP ports.
+ *
+ * Called periodically by the scheduler. Every port gets to process a command unless the time budget
+ * runs out, the ports that missed out then go first on the next call.
+ */
+void mspSerialProcess(mspEvaluateNonMspData_e evaluateNonMspData, mspProcessCommandFnPtr mspProcessCommandFn, mspProcessReplyFnPtr mspProcessReplyFn)
+{
+    const timeUs_t startTimeUs = micros();
+
+    for (int i = 0; i < MAX_MSP_PORT_COUNT; i++) {
+        const uint8_t portIndex = (mspFirstPortIndex + i) % MAX_MSP_PORT_COUNT;
+        mspPort_t * const mspPort = &mspPorts[portIndex];
+        if (!mspPort->port) {
+            continue;
         }
 
-        if (mspPostProcessFn) {
-            waitForSerialPortToFinishTransmitting(mspPort->port);
-            mspPostProcessFn(mspPort->port);
+        const bool commandProcessed = mspSerialProcessPort(mspPort, evaluateNonMspData, mspProcessCommandFn, mspProcessReplyFn);
+        if (commandProcessed && cmpTimeUs(micros(), startTimeUs) >= MSP_SERIAL_PROCESS_TIME_BUDGET_US) {
+            mspFirstPortIndex = (portIndex + 1) % MAX_MSP_PORT_COUNT;
+            return;
         }
     }
+    mspFirstPortIndex = (mspFirstPortIndex + 1) % MAX_MSP_PORT_COUNT;
 }
 
 bool mspSerialWaiting(void)
@@ -270,6 +331,7 @@ bool mspSerialWaiting(void)
 void mspSerialInit(void)
 {
     memset(mspPorts, 0, sizeof(mspPorts));
+    mspFirstPortIndex = 0;
     mspSerialAllocatePorts();
 }
 
@@ -324,3 +386,35 @@ uint32_t mspSerialTxBytesFree()
 
     return ret;
 }
+
+/*
+ * Writes the packets to the MSP port using the given serial port as a single burst.
+ * Nothing is written unless all the packets fit into the transmit buffer.
+ *
+ * Returns the number of bytes written.
+ */
+int mspSerialPushPackets(serialPort_t *serialPort, mspPacket_t *packets, int packetCount)
+{
+    for (int portIndex = 0; portIndex < MAX_MSP_PORT_COUNT; portIndex++) {
+        mspPort_t * const mspPort = &mspPorts[portIndex];
+        if (!mspPort->port || mspPort->port != serialPort) {
+            continue;
+        }
+
+        int size = 0;
+        for (int i = 0; i < packetCount; i++) {
+            size += mspSerialFrameSize(sbufBytesRemaining(&packets[i].buf));
+        }
+        if (serialTxBytesFree(serialPort) < (uint32_t)size) {
+            return 0;
+        }
+
+        serialBeginWrite(serialPort);
+        for (int i = 0; i < packetCount; i++) {
+            mspSerialWriteFrame(mspPort, &packets[i]);
+        }
+        serialEndWrite(serialPort);
+        return size;
+    }
+    return 0;
+}
@@ -54,7 +54,10 @@ STATIC_UNIT_TESTED uint32_t crsfChannelData[CRSF_MAX_CHANNEL];
 static serialPort_t *serialPort;
 static uint32_t crsfFrameStartAt = 0;
 static uint8_t telemetryBuf[CRSF_FRAME_SIZE_MAX];
-static uint8_t telemetryBufLen = 0;
+static volatile uint8_t telemetryBufLen = 0; // set once a frame is complete, cleared by the receive ISR once it is sent
+static bool telemetryInTxBuffer = false; // the frame was built in place in the serial port transmit buffer
+
+STATIC_UNIT_TESTED void crsfRxSendTelemetryData(void);
 
 
 /*
@@ -74,6 +77,9 @@ static uint8_t telemetryBufLen = 0;
  *
  * CRSF_TIME_NEEDED_PER_FRAME_US is set conservatively at 1000 microseconds
  *
+ * A pending telemetry frame is sent by the receive ISR as soon as an RC channels frame is complete,
+ * so it goes out at the start of the gap before the next frame from the master.
+ *
  * Every frame has the structure:
  * <Device address> <Frame length> < Type> <Payload> < CRC>
  *
@@ -133,6 +139,9 @@ STATIC_UNIT_TESTED void crsfDataReceive(uint16_t c)
     if (crsfFramePosition < fullFrameLength) {
         crsfFrame.bytes[crsfFramePosition++] = (uint8_t)c;
         crsfFrameDone = crsfFramePosition < fullFrameLength ? false : true;
+        if (crsfFrameDone && crsfFrame.frame.type == CRSF_FRAMETYPE_RC_CHANNELS_PACKED) {
+            crsfRxSendTelemetryData();
+        }
     }
 }
 
@@ -195,27 +204,46 @@ STATIC_UNIT_TESTED uint16_t crsfReadRawRC(const rxRuntimeConfig_t *rxRuntimeConf
     return (0.62477120195241f * crsfChannelData[chan]) + 881;
 }
 
+/*
+ * Returns a CRSF_FRAME_SIZE_MAX buffer to build the next telemetry frame in, or NULL while the previous frame is still waiting to be sent.
+ * The buffer is the free space of the serial port transmit buffer when the port supports it, so the frame is sent without another copy.
+ */
+uint8_t *crsfRxBeginTelemetryFrame(void)
+{
+    if (telemetryBufLen > 0) {
+        return NULL;
+    }
+    uint8_t *buf = serialPort ? serialTxReserve(serialPort, CRSF_FRAME_SIZE_MAX) : NULL;
+    telemetryInTxBuffer = buf != NULL;
+    return buf ? buf : telemetryBuf;
+}
+
+// queues the len bytes built in the buffer from crsfRxBeginTelemetryFrame() for the next telemetry slot
+void crsfRxEndTelemetryFrame(int len)
+{
+    __sync_synchronize(); // the frame must be complete before the receive ISR can see its length
+    telemetryBufLen = MIN(len, CRSF_FRAME_SIZE_MAX);
+}
+
 void crsfRxWriteTelemetryData(const void *data, int len)
 {
-    len = MIN(len, (int)sizeof(telemetryBuf));
-    memcpy(telemetryBuf, data, len);
-    telemetryBufLen = len;
+    uint8_t *buf = crsfRxBeginTelemetryFrame();
+    if (buf) {
+        len = MIN(len, CRSF_FRAME_SIZE_MAX);
+        memcpy(buf, data, len);
+        crsfRxEndTelemetryFrame(len);
+    }
 }
 
-void crsfRxSendTelemetryData(void)
+STATIC_UNIT_TESTED void crsfRxSendTelemetryData(void)
 {
     // if there is telemetry data to write
     if (telemetryBufLen > 0) {
-        // check that we are not in bi dir mode or that we are not currently receiving data (ie in the middle of an RX frame)
-        // and that there is time to send the telemetry frame before the next RX frame arrives
-        if (CRSF_PORT_OPTIONS & SERIAL_BIDIR) {
-            const uint32_t timeSinceStartOfFrame = micros() - crsfFrameStartAt;
-            if ((timeSinceStartOfFrame < CRSF_TIME_NEEDED_PER_FRAME_US) ||
-                (timeSinceStartOfFrame > CRSF_TIME_BETWEEN_FRAMES_US - CRSF_TIME_NEEDED_PER_FRAME_US)) {
-                return;
-            }
+        if (telemetryInTxBuffer) {
+            serialTxCommit(serialPort, telemetryBufLen);
+        } else {
+            serialWriteBuf(serialPort, telemetryBuf, telemetryBufLen);
         }
-        serialWriteBuf(serialPort, telemetryBuf, telemetryBufLen);
         telemetryBufLen = 0; // reset telemetry buffer
     }
 }
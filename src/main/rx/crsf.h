@@ -75,8 +75,9 @@ typedef union crsfFrame_u {
 } crsfFrame_t;
 
 
+uint8_t *crsfRxBeginTelemetryFrame(void);
+void crsfRxEndTelemetryFrame(int len);
 void crsfRxWriteTelemetryData(const void *data, int len);
-void crsfRxSendTelemetryData(void);
 
 struct rxConfig_s;
 struct rxRuntimeConfig_s;
@@ -336,3 +336,25 @@ void scheduler(void)
 
     GET_SCHEDULER_LOCALS();
 }
+
+#if defined(SIMULATOR_BUILD)
+/*
+ * Time until the next time driven task is due, zero when a task is waiting to run.
+ * Event driven tasks are checked on every pass, so a lockstep simulator can skip the time in between.
+ */
+timeDelta_t schedulerGetTimeToNextTask(timeUs_t currentTimeUs)
+{
+    timeDelta_t timeToNextTask = INT32_MAX;
+    for (const cfTask_t *task = queueFirst(); task != NULL; task = queueNext()) {
+        if (task->checkFunc) {
+            if (task->dynamicPriority > 0) {
+                return 0;
+            }
+        } else {
+            const timeDelta_t timeToTask = cmpTimeUs(task->lastExecutedAt + task->desiredPeriod, currentTimeUs);
+            timeToNextTask = MIN(timeToNextTask, MAX(timeToTask, 0));
+        }
+    }
+    return timeToNextTask;
+}
+#endif
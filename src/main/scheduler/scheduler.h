@@ -118,6 +118,14 @@ typedef enum {
     TASK_RCSPLIT,
 #endif
 
+#ifdef USE_MSP_STREAM
+    TASK_MSP_STREAM,
+#endif
+
+#ifndef USE_OSD_SLAVE
+    TASK_PID_PROFILE,
+#endif
+
     /* Count of real tasks */
     TASK_COUNT,
 
@@ -163,6 +171,9 @@ void schedulerResetTaskStatistics(cfTaskId_e taskId);
 
 void schedulerInit(void);
 void scheduler(void);
+#if defined(SIMULATOR_BUILD)
+timeDelta_t schedulerGetTimeToNextTask(timeUs_t currentTimeUs);
+#endif
 void taskSystem(timeUs_t currentTime);
 
 #define LOAD_PERCENTAGE_ONE 100
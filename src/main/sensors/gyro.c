@@ -28,6 +28,7 @@
 #include "common/maths.h"
 #include "common/filter.h"
 
+#include "config/feature.h"
 #include "config/parameter_group.h"
 #include "config/parameter_group_ids.h"
 
@@ -51,15 +52,19 @@
 #include "drivers/bus_spi.h"
 #include "drivers/gyro_sync.h"
 #include "drivers/io.h"
+#include "drivers/pwm_output.h"
 
 #include "fc/runtime_config.h"
 
+#include "flight/mixer.h"
+
 #include "io/beeper.h"
 #include "io/statusindicator.h"
 
 #include "scheduler/scheduler.h"
 
 #include "sensors/boardalignment.h"
+#include "sensors/esc_sensor.h"
 #include "sensors/gyro.h"
 #include "sensors/gyroanalyse.h"
 #include "sensors/sensors.h"
@@ -99,6 +104,16 @@ typedef struct gyroSensor_s {
     biquadFilter_t notchFilter2[XYZ_AXIS_COUNT];
     filterApplyFnPtr notchFilterDynApplyFn;
     biquadFilter_t notchFilterDyn[XYZ_AXIS_COUNT];
+#ifdef USE_RPM_FILTER
+    // rpm notch filters, one per motor and harmonic
+    uint8_t rpmNotchHarmonics;
+    uint8_t rpmNotchMotorCount;
+    float rpmNotchQ;
+    float rpmNotchOmegaScale;               // motor eRPM / 100 to fundamental notch frequency, in radians per sample
+    float rpmNotchMinOmega;
+    float rpmNotchMaxOmega;
+    biquadFilter_t rpmNotch[XYZ_AXIS_COUNT][MAX_SUPPORTED_MOTORS][RPM_NOTCH_HARMONICS_MAX];
+#endif
 } gyroSensor_t;
 
 static gyroSensor_t gyroSensor1;
@@ -115,7 +130,7 @@ static void gyroInitSensorFilters(gyroSensor_t *gyroSensor);
 #define GYRO_SYNC_DENOM_DEFAULT 4
 #endif
 
-PG_REGISTER_WITH_RESET_TEMPLATE(gyroConfig_t, gyroConfig, PG_GYRO_CONFIG, 0);
+PG_REGISTER_WITH_RESET_TEMPLATE(gyroConfig_t, gyroConfig, PG_GYRO_CONFIG, 1);
 
 PG_RESET_TEMPLATE(gyroConfig_t, gyroConfig,
     .gyro_align = ALIGN_DEFAULT,
@@ -129,7 +144,10 @@ PG_RESET_TEMPLATE(gyroConfig_t, gyroConfig,
     .gyro_soft_notch_hz_1 = 400,
     .gyro_soft_notch_cutoff_1 = 300,
     .gyro_soft_notch_hz_2 = 200,
-    .gyro_soft_notch_cutoff_2 = 100
+    .gyro_soft_notch_cutoff_2 = 100,
+    .gyro_rpm_notch_harmonics = 0,
+    .gyro_rpm_notch_min_hz = 100,
+    .gyro_rpm_notch_q = 500
 );
 
 
@@ -447,12 +465,112 @@ void gyroInitFilterDynamicNotch(gyroSensor_t *gyroSensor)
     }
 }
 
+#ifdef USE_RPM_FILTER
+void gyroInitFilterRpmNotch(gyroSensor_t *gyroSensor)
+{
+    gyroSensor->rpmNotchHarmonics = MIN(gyroConfig()->gyro_rpm_notch_harmonics, RPM_NOTCH_HARMONICS_MAX);
+    gyroSensor->rpmNotchMotorCount = 0;
+
+    const float looptimeS = gyro.targetLooptime * 1e-6f;
+    const uint16_t minHz = gyroConfig()->gyro_rpm_notch_min_hz;
+    gyroSensor->rpmNotchQ = gyroConfig()->gyro_rpm_notch_q / 100.0f;
+    // eRPM / 100 -> mechanical rotations per second -> radians per sample
+    gyroSensor->rpmNotchOmegaScale = 100.0f / 60.0f / (motorConfig()->motorPoleCount / 2.0f) * 2.0f * M_PIf * looptimeS;
+    gyroSensor->rpmNotchMinOmega = 2.0f * M_PIf * minHz * looptimeS;
+    // keep clear of nyquist where the notch collapses
+    gyroSensor->rpmNotchMaxOmega = 0.48f * 2.0f * M_PIf;
+
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        for (int motor = 0; motor < MAX_SUPPORTED_MOTORS; motor++) {
+            for (int harmonic = 0; harmonic < gyroSensor->rpmNotchHarmonics; harmonic++) {
+                biquadFilterInit(&gyroSensor->rpmNotch[axis][motor][harmonic], minHz * (harmonic + 1), gyro.targetLooptime, gyroSensor->rpmNotchQ, FILTER_NOTCH);
+            }
+        }
+    }
+}
+
+static uint16_t gyroRpmNotchMotorRpm(int motor)
+{
+#ifdef USE_DSHOT_TELEMETRY
+    if (useDshotTelemetry) {
+        return getDshotTelemetry(motor);
+    }
+#endif
+#ifdef USE_ESC_SENSOR
+    if (feature(FEATURE_ESC_SENSOR)) {
+        const escSensorData_t *escData = getEscSensorData(motor);
+        return escData->dataAge < ESC_DATA_INVALID ? escData->rpm : 0;
+    }
+#endif
+    return 0;
+}
+
+/*
+ * Moves the notches to the current motor frequencies. Only one sine and cosine is evaluated per motor,
+ * the harmonics follow from the angle addition theorem and all axes share the coefficients.
+ */
+static void gyroUpdateRpmNotch(gyroSensor_t *gyroSensor)
+{
+    gyroSensor->rpmNotchMotorCount = MIN(getMotorCount(), MAX_SUPPORTED_MOTORS);
+
+    for (int motor = 0; motor < gyroSensor->rpmNotchMotorCount; motor++) {
+        const uint16_t rpm = gyroRpmNotchMotorRpm(motor);
+        // stopped or idling motors hold the notches at the minimum frequency
+        const float omega = MAX(rpm * gyroSensor->rpmNotchOmegaScale, gyroSensor->rpmNotchMinOmega);
+        if (motor < DEBUG16_VALUE_COUNT) {
+            DEBUG_SET(DEBUG_RPM_FILTER, motor, lrintf(omega / (2.0f * M_PIf * gyro.targetLooptime * 1e-6f)));
+        }
+
+        const float sinOmega = sin_approx(omega);
+        const float cosOmega = cos_approx(omega);
+        float sinHarmonic = sinOmega;
+        float cosHarmonic = cosOmega;
+        for (int harmonic = 0; harmonic < gyroSensor->rpmNotchHarmonics; harmonic++) {
+            biquadFilter_t *notch = &gyroSensor->rpmNotch[X][motor][harmonic];
+            if (omega * (harmonic + 1) < gyroSensor->rpmNotchMaxOmega) {
+                biquadFilterUpdateNotch(notch, sinHarmonic, cosHarmonic, gyroSensor->rpmNotchQ);
+            } else {
+                // pass through
+                notch->b0 = 1.0f;
+                notch->b1 = notch->b2 = notch->a1 = notch->a2 = 0.0f;
+            }
+            for (int axis = Y; axis < XYZ_AXIS_COUNT; axis++) {
+                biquadFilter_t *axisNotch = &gyroSensor->rpmNotch[axis][motor][harmonic];
+                axisNotch->b0 = notch->b0;
+                axisNotch->b1 = notch->b1;
+                axisNotch->b2 = notch->b2;
+                axisNotch->a1 = notch->a1;
+                axisNotch->a2 = notch->a2;
+            }
+
+            const float sinNext = sinHarmonic * cosOmega + cosHarmonic * sinOmega;
+            cosHarmonic = cosHarmonic * cosOmega - sinHarmonic * sinOmega;
+            sinHarmonic = sinNext;
+        }
+    }
+}
+
+static float gyroApplyRpmNotch(gyroSensor_t *gyroSensor, int axis, float gyroADCf)
+{
+    for (int motor = 0; motor < gyroSensor->rpmNotchMotorCount; motor++) {
+        for (int harmonic = 0; harmonic < gyroSensor->rpmNotchHarmonics; harmonic++) {
+            // DF1 as the coefficients change every loop
+            gyroADCf = biquadFilterApplyDF1(&gyroSensor->rpmNotch[axis][motor][harmonic], gyroADCf);
+        }
+    }
+    return gyroADCf;
+}
+#endif
+
 static void gyroInitSensorFilters(gyroSensor_t *gyroSensor)
 {
     gyroInitFilterLpf(gyroSensor, gyroConfig()->gyro_soft_lpf_hz);
     gyroInitFilterNotch1(gyroSensor, gyroConfig()->gyro_soft_notch_hz_1, gyroConfig()->gyro_soft_notch_cutoff_1);
     gyroInitFilterNotch2(gyroSensor, gyroConfig()->gyro_soft_notch_hz_2, gyroConfig()->gyro_soft_notch_cutoff_2);
     gyroInitFilterDynamicNotch(gyroSensor);
+#ifdef USE_RPM_FILTER
+    gyroInitFilterRpmNotch(gyroSensor);
+#endif
 }
 
 void gyroInitFilters(void)
@@ -574,6 +692,12 @@ void gyroUpdateSensor(gyroSensor_t *gyroSensor)
     gyroDataAnalyse(&gyroSensor->gyroDev, gyroSensor->notchFilterDyn);
 #endif
 
+#ifdef USE_RPM_FILTER
+    if (gyroSensor->rpmNotchHarmonics) {
+        gyroUpdateRpmNotch(gyroSensor);
+    }
+#endif
+
     for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
         // scale gyro output to degrees per second
         float gyroADCf = (float)gyroSensor->gyroDev.gyroADC[axis] * gyroSensor->gyroDev.scale;
@@ -590,6 +714,11 @@ void gyroUpdateSensor(gyroSensor_t *gyroSensor)
             DEBUG_SET(DEBUG_FFT, 1, lrintf(gyroADCf)); // store data after dynamic notch
 #endif
 
+#ifdef USE_RPM_FILTER
+        // Apply motor rpm notch filtering
+        gyroADCf = gyroApplyRpmNotch(gyroSensor, axis, gyroADCf);
+#endif
+
         // Apply Static Notch filtering
         DEBUG_SET(DEBUG_NOTCH, axis, lrintf(gyroADCf));
         gyroADCf = gyroSensor->notchFilter1ApplyFn(&gyroSensor->notchFilter1[axis], gyroADCf);
@@ -40,6 +40,8 @@ typedef enum {
     GYRO_FAKE
 } gyroSensor_e;
 
+#define RPM_NOTCH_HARMONICS_MAX 3
+
 typedef struct gyro_s {
     uint32_t targetLooptime;
     float gyroADCf[XYZ_AXIS_COUNT];
@@ -60,6 +62,9 @@ typedef struct gyroConfig_s {
     uint16_t gyro_soft_notch_cutoff_1;
     uint16_t gyro_soft_notch_hz_2;
     uint16_t gyro_soft_notch_cutoff_2;
+    uint8_t  gyro_rpm_notch_harmonics;         // number of notches per motor, at multiples of the motor rotation frequency, 0 is off
+    uint8_t  gyro_rpm_notch_min_hz;
+    uint16_t gyro_rpm_notch_q;                 // Q * 100
 } gyroConfig_t;
 
 PG_DECLARE(gyroConfig_t, gyroConfig);
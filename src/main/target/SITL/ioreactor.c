@@ -0,0 +1,122 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+
+#include "ioreactor.h"
+
+#define IO_REACTOR_MAX_EVENTS 16
+
+static int epollFd = -1;
+static ioHandler_t stopEvent;
+static volatile bool running;
+
+static void stopCallback(ioHandler_t *handler, uint32_t events)
+{
+    (void)events;
+    ioHandlerAcknowledge(handler);
+    running = false;
+}
+
+bool ioReactorInit(void)
+{
+    epollFd = epoll_create1(EPOLL_CLOEXEC);
+    if (epollFd < 0) {
+        fprintf(stderr, "[reactor]epoll_create1 failed: %s\n", strerror(errno));
+        return false;
+    }
+    running = true;
+    return ioEventInit(&stopEvent, stopCallback) && ioReactorAdd(&stopEvent, EPOLLIN);
+}
+
+bool ioReactorAdd(ioHandler_t *handler, uint32_t events)
+{
+    struct epoll_event event = { .events = events, .data.ptr = handler };
+    if (epoll_ctl(epollFd, EPOLL_CTL_ADD, handler->fd, &event) != 0) {
+        fprintf(stderr, "[reactor]add fd %d failed: %s\n", handler->fd, strerror(errno));
+        return false;
+    }
+    return true;
+}
+
+void ioReactorRemove(ioHandler_t *handler)
+{
+    epoll_ctl(epollFd, EPOLL_CTL_DEL, handler->fd, NULL);
+}
+
+void ioReactorRun(void)
+{
+    struct epoll_event events[IO_REACTOR_MAX_EVENTS];
+
+    while (running) {
+        // no timeout, without traffic the thread sleeps
+        const int count = epoll_wait(epollFd, events, IO_REACTOR_MAX_EVENTS, -1);
+        for (int i = 0; i < count; i++) {
+            ioHandler_t *handler = events[i].data.ptr;
+            handler->callback(handler, events[i].events);
+        }
+    }
+}
+
+void ioReactorStop(void)
+{
+    ioEventSignal(&stopEvent);
+}
+
+bool ioEventInit(ioHandler_t *handler, ioCallbackPtr *callback)
+{
+    handler->fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    handler->callback = callback;
+    return handler->fd >= 0;
+}
+
+void ioEventSignal(ioHandler_t *handler)
+{
+    const uint64_t one = 1;
+    if (write(handler->fd, &one, sizeof(one)) < 0) {
+        // counter saturated, the reactor has a wakeup pending anyway
+    }
+}
+
+bool ioTimerInit(ioHandler_t *handler, ioCallbackPtr *callback, uint32_t periodUs)
+{
+    handler->fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    handler->callback = callback;
+    if (handler->fd < 0) {
+        return false;
+    }
+    const struct timespec period = { .tv_sec = periodUs / 1000000, .tv_nsec = (periodUs % 1000000) * 1000 };
+    const struct itimerspec spec = { .it_interval = period, .it_value = period };
+    return timerfd_settime(handler->fd, 0, &spec, NULL) == 0;
+}
+
+// returns the event count, or the number of timer expirations
+uint64_t ioHandlerAcknowledge(ioHandler_t *handler)
+{
+    uint64_t count = 0;
+    if (read(handler->fd, &count, sizeof(count)) != sizeof(count)) {
+        return 0;
+    }
+    return count;
+}
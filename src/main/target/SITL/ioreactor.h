@@ -0,0 +1,44 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// epoll based event loop, all SITL sockets and timers are serviced by the one thread running ioReactorRun().
+// Handlers can be added and removed from any thread, callbacks are only called on the reactor thread.
+
+struct ioHandler_s;
+typedef void ioCallbackPtr(struct ioHandler_s *handler, uint32_t events);
+
+typedef struct ioHandler_s {
+    int fd;
+    ioCallbackPtr *callback;
+} ioHandler_t;
+
+bool ioReactorInit(void);
+bool ioReactorAdd(ioHandler_t *handler, uint32_t events); // EPOLLIN, EPOLLOUT, EPOLLET, ...
+void ioReactorRemove(ioHandler_t *handler);
+void ioReactorRun(void);
+void ioReactorStop(void);
+
+// eventfd and timerfd helpers, the callback has to read the fd with ioHandlerAcknowledge()
+bool ioEventInit(ioHandler_t *handler, ioCallbackPtr *callback);
+void ioEventSignal(ioHandler_t *handler);
+bool ioTimerInit(ioHandler_t *handler, ioCallbackPtr *callback, uint32_t periodUs);
+uint64_t ioHandlerAcknowledge(ioHandler_t *handler);
@@ -0,0 +1,200 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <math.h>
+#include <string.h>
+
+#include "quadmodel.h"
+
+#define GRAVITY 9.80665
+
+// motor positions in units of the arm length projected on the body axes, and the sign of their reaction torque
+// in mixer order: rear right, front right, rear left, front left (props in, rear right and front left spin clockwise)
+static const double motorX[QUAD_MODEL_MOTOR_COUNT] = { -1, 1, -1, 1 };
+static const double motorY[QUAD_MODEL_MOTOR_COUNT] = { 1, 1, -1, -1 };
+static const double motorYaw[QUAD_MODEL_MOTOR_COUNT] = { -1, 1, 1, -1 };
+
+void quadModelConfigDefaults(quadModelConfig_t *config)
+{
+    // about a 5 inch freestyle quad
+    config->mass = 0.5;
+    config->armLength = 0.11;
+    config->inertia[0] = 2.5e-3;
+    config->inertia[1] = 2.5e-3;
+    config->inertia[2] = 4.5e-3;
+    config->maxThrust = 7.0;
+    config->yawTorqueRatio = 0.012;
+    config->motorTimeConstant = 0.03;
+    config->linearDrag = 0.2;
+    config->angularDrag = 2e-3;
+    config->gyroNoise = 5e-3;
+    config->accNoise = 0.1;
+    config->seed = 1;
+}
+
+void quadModelInit(quadModel_t *model, const quadModelConfig_t *config)
+{
+    memset(model, 0, sizeof(*model));
+    model->config = *config;
+    model->attitude[0] = 1;
+    model->acc[2] = -GRAVITY;
+    model->randomState = config->seed ? config->seed : 1;
+}
+
+// xorshift32, the noise has to be reproducible
+static double randomUniform(quadModel_t *model)
+{
+    uint32_t x = model->randomState;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    model->randomState = x;
+    return ((x >> 8) + 1) * (1.0 / 16777216.0); // (0, 1]
+}
+
+static double randomGaussian(quadModel_t *model, double stdDev)
+{
+    if (stdDev <= 0) {
+        return 0;
+    }
+    if (model->hasSpareGaussian) {
+        model->hasSpareGaussian = false;
+        return stdDev * model->spareGaussian;
+    }
+    // Box-Muller, the second value is kept for the next call
+    const double radius = sqrt(-2 * log(randomUniform(model)));
+    const double angle = 2 * M_PI * randomUniform(model);
+    model->spareGaussian = radius * sin(angle);
+    model->hasSpareGaussian = true;
+    return stdDev * radius * cos(angle);
+}
+
+// rotate v by the quaternion q, or by its inverse
+static void quaternionRotate(const double *q, const double *v, double *out, bool inverse)
+{
+    const double w = q[0];
+    const double x = inverse ? -q[1] : q[1];
+    const double y = inverse ? -q[2] : q[2];
+    const double z = inverse ? -q[3] : q[3];
+
+    // t = 2 * (q.xyz x v), out = v + w * t + q.xyz x t
+    const double tx = 2 * (y * v[2] - z * v[1]);
+    const double ty = 2 * (z * v[0] - x * v[2]);
+    const double tz = 2 * (x * v[1] - y * v[0]);
+    out[0] = v[0] + w * tx + (y * tz - z * ty);
+    out[1] = v[1] + w * ty + (z * tx - x * tz);
+    out[2] = v[2] + w * tz + (x * ty - y * tx);
+}
+
+static void quaternionIntegrate(double *q, const double *rate, double dt)
+{
+    const double norm = sqrt(rate[0] * rate[0] + rate[1] * rate[1] + rate[2] * rate[2]);
+    if (norm < 1e-12) {
+        return;
+    }
+    const double halfAngle = 0.5 * norm * dt;
+    const double s = sin(halfAngle) / norm;
+    const double dw = cos(halfAngle);
+    const double dx = rate[0] * s;
+    const double dy = rate[1] * s;
+    const double dz = rate[2] * s;
+
+    const double w = q[0] * dw - q[1] * dx - q[2] * dy - q[3] * dz;
+    const double x = q[0] * dx + q[1] * dw + q[2] * dz - q[3] * dy;
+    const double y = q[0] * dy - q[1] * dz + q[2] * dw + q[3] * dx;
+    const double z = q[0] * dz + q[1] * dy - q[2] * dx + q[3] * dw;
+
+    const double n = sqrt(w * w + x * x + y * y + z * z);
+    q[0] = w / n;
+    q[1] = x / n;
+    q[2] = y / n;
+    q[3] = z / n;
+}
+
+void quadModelStep(quadModel_t *model, const float *motorCommand, double dt)
+{
+    const quadModelConfig_t *config = &model->config;
+
+    // motors
+    if (dt != model->motorAlphaDt) {
+        model->motorAlpha = config->motorTimeConstant > 0 ? 1 - exp(-dt / config->motorTimeConstant) : 1;
+        model->motorAlphaDt = dt;
+    }
+    const double motorAlpha = model->motorAlpha;
+    const double arm = config->armLength * M_SQRT1_2;
+    double thrust = 0;
+    double torque[3] = { 0, 0, 0 };
+    for (int i = 0; i < QUAD_MODEL_MOTOR_COUNT; i++) {
+        const double command = motorCommand[i] < 0 ? 0 : (motorCommand[i] > 1 ? 1 : motorCommand[i]);
+        model->motorSpeed[i] += (command - model->motorSpeed[i]) * motorAlpha;
+        const double motorThrust = config->maxThrust * model->motorSpeed[i] * model->motorSpeed[i];
+        thrust += motorThrust;
+        // thrust acts along -z, torque = r x F
+        torque[0] -= motorY[i] * arm * motorThrust;
+        torque[1] += motorX[i] * arm * motorThrust;
+        torque[2] += motorYaw[i] * config->yawTorqueRatio * motorThrust;
+    }
+
+    // rotation, I * dw/dt = torque - w x (I * w)
+    const double *inertia = config->inertia;
+    double *rate = model->rate;
+    const double momentum[3] = { inertia[0] * rate[0], inertia[1] * rate[1], inertia[2] * rate[2] };
+    const double gyroscopic[3] = {
+        rate[1] * momentum[2] - rate[2] * momentum[1],
+        rate[2] * momentum[0] - rate[0] * momentum[2],
+        rate[0] * momentum[1] - rate[1] * momentum[0],
+    };
+    for (int axis = 0; axis < 3; axis++) {
+        rate[axis] += (torque[axis] - config->angularDrag * rate[axis] - gyroscopic[axis]) / inertia[axis] * dt;
+    }
+    quaternionIntegrate(model->attitude, rate, dt);
+
+    // translation
+    const double bodyForce[3] = { 0, 0, -thrust };
+    double force[3];
+    quaternionRotate(model->attitude, bodyForce, force, false);
+
+    double previousVelocity[3];
+    for (int axis = 0; axis < 3; axis++) {
+        previousVelocity[axis] = model->velocity[axis];
+        const double accel = (force[axis] - config->linearDrag * model->velocity[axis]) / config->mass + (axis == 2 ? GRAVITY : 0);
+        model->velocity[axis] += accel * dt;
+        model->position[axis] += model->velocity[axis] * dt;
+    }
+
+    // flat ground at the starting height, resting on it stops all motion
+    if (model->position[2] > 0) {
+        model->position[2] = 0;
+        if (model->velocity[2] > 0) {
+            memset(model->velocity, 0, sizeof(model->velocity));
+            memset(model->rate, 0, sizeof(model->rate));
+        }
+    }
+
+    // sensors, the accelerometer measures the acceleration without gravity
+    double specificForce[3];
+    for (int axis = 0; axis < 3; axis++) {
+        specificForce[axis] = (model->velocity[axis] - previousVelocity[axis]) / dt - (axis == 2 ? GRAVITY : 0);
+    }
+    quaternionRotate(model->attitude, specificForce, model->acc, true);
+    for (int axis = 0; axis < 3; axis++) {
+        model->gyro[axis] = rate[axis] + randomGaussian(model, config->gyroNoise);
+        model->acc[axis] += randomGaussian(model, config->accNoise);
+    }
+
+    model->time += dt;
+}
@@ -0,0 +1,65 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Rigid body quad X model, used by SITL in place of an external simulator.
+// All state is in the simulator convention of the fdm packet: NED earth frame, FRD body frame.
+
+#define QUAD_MODEL_MOTOR_COUNT 4
+
+typedef struct quadModelConfig_s {
+    double mass;            // kg
+    double armLength;       // m, motor to center
+    double inertia[3];      // kg*m^2, about the body x, y and z axis
+    double maxThrust;       // N per motor at full throttle
+    double yawTorqueRatio;  // Nm of reaction torque per N of thrust
+    double motorTimeConstant; // s, first order lag from command to prop speed
+    double linearDrag;      // N per m/s
+    double angularDrag;     // Nm per rad/s
+    double gyroNoise;       // rad/s, standard deviation
+    double accNoise;        // m/s/s, standard deviation
+    uint32_t seed;          // noise generator seed, runs with the same seed are identical
+} quadModelConfig_t;
+
+typedef struct quadModel_s {
+    quadModelConfig_t config;
+    double time;            // s
+    double position[3];     // m, NED
+    double velocity[3];     // m/s, NED
+    double attitude[4];     // w, x, y, z, body to earth
+    double rate[3];         // rad/s, body
+    double motorSpeed[QUAD_MODEL_MOTOR_COUNT]; // 0..1
+
+    // sensor output of the last step
+    double gyro[3];         // rad/s, body
+    double acc[3];          // m/s/s, body, specific force (-1G on z at rest)
+
+    uint32_t randomState;
+    double spareGaussian;   // second value of the last Box-Muller pair
+    bool hasSpareGaussian;
+    double motorAlphaDt;    // step time motorAlpha was calculated for
+    double motorAlpha;
+} quadModel_t;
+
+void quadModelConfigDefaults(quadModelConfig_t *config);
+void quadModelInit(quadModel_t *model, const quadModelConfig_t *config);
+// motor commands in mixer order (rear right, front right, rear left, front left), range 0..1
+void quadModelStep(quadModel_t *model, const float *motorCommand, double dt);
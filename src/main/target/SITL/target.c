@@ -22,6 +22,9 @@
 #include <string.h>
 
 #include <errno.h>
+#include <getopt.h>
+#include <pthread.h>
+#include <sys/epoll.h>
 #include <time.h>
 
 #include "common/maths.h"
@@ -31,6 +34,7 @@
 #include "drivers/serial.h"
 #include "drivers/serial_tcp.h"
 #include "drivers/system.h"
+#include "drivers/time.h"
 #include "drivers/pwm_output.h"
 #include "drivers/light_led.h"
 
@@ -47,20 +51,39 @@ const timerHardware_t timerHardware[1]; // unused
 
 #include "rx/rx.h"
 
-#include "dyad.h"
+#include "target/SITL/ioreactor.h"
 #include "target/SITL/udplink.h"
+#include "target/SITL/quadmodel.h"
+#include "target/SITL/trace.h"
 
 static fdm_packet fdmPkt;
 static servo_packet pwmPkt;
 
 static struct timespec start_time;
 static double simRate = 1.0;
-static pthread_t tcpWorker, udpWorker;
-static bool workerRunning = true;
+static pthread_t ioWorker;
 static udpLink_t stateLink, pwmLink;
 static pthread_mutex_t updateLock;
 static pthread_mutex_t mainLoopLock;
 
+// built-in physics model instead of an external simulator
+static bool usePhysics = false;
+static quadModel_t quadModel;
+static quadModelConfig_t quadModelConfig;
+static double physicsRate = 1000; // Hz
+static float motorsOutput[QUAD_MODEL_MOTOR_COUNT]; // mixer order, 0..1
+
+// where to find the simulator and the configurator, several instances can run side by side on one host
+#define INSTANCE_PORT_STEP 10
+static int instance = 0;
+static int tcpBasePort = -1; // UARTn on port + n
+static const char *simulatorAddress = "127.0.0.1";
+static int simulatorOutPort = -1; // servo packets to the simulator
+static int simulatorInPort = -1; // fdm packets from the simulator
+static const char *eepromFileName = NULL;
+static char instanceEepromFileName[32];
+extern uint8_t eepromData[EEPROM_SIZE]; // fake EEPROM, below
+
 int timeval_sub(struct timespec *result, struct timespec *x, struct timespec *y);
 
 int lockMainPID(void) {
@@ -73,24 +96,8 @@ int lockMainPID(void) {
 void sendMotorUpdate() {
     udpSend(&pwmLink, &pwmPkt, sizeof(servo_packet));
 }
-void updateState(const fdm_packet* pkt) {
-    static double last_timestamp = 0; // in seconds
-    static uint64_t last_realtime = 0; // in uS
-    static struct timespec last_ts; // last packet
-
-    struct timespec now_ts;
-    clock_gettime(CLOCK_MONOTONIC, &now_ts);
-
-    const uint64_t realtime_now = micros64_real();
-    if (realtime_now > last_realtime + 500*1e3) { // 500ms timeout
-        last_timestamp = pkt->timestamp;
-        last_realtime = realtime_now;
-        sendMotorUpdate();
-        return;
-    }
-
-    const double deltaSim = pkt->timestamp - last_timestamp;  // in seconds
-    if (deltaSim < 0) { // don't use old packet
+static void updateSensors(const fdm_packet* pkt) {
+    if (!fakeAccDev || !fakeGyroDev) { // sensors not detected yet
         return;
     }
 
@@ -137,6 +144,30 @@ void updateState(const fdm_packet* pkt) {
     imuSetAttitudeQuat(pkt->imu_orientation_quat[0], pkt->imu_orientation_quat[1], pkt->imu_orientation_quat[2], pkt->imu_orientation_quat[3]);
 #endif
 #endif
+}
+
+void updateState(const fdm_packet* pkt) {
+    static double last_timestamp = 0; // in seconds
+    static uint64_t last_realtime = 0; // in uS
+    static struct timespec last_ts; // last packet
+
+    struct timespec now_ts;
+    clock_gettime(CLOCK_MONOTONIC, &now_ts);
+
+    const uint64_t realtime_now = micros64_real();
+    if (realtime_now > last_realtime + 500*1e3) { // 500ms timeout
+        last_timestamp = pkt->timestamp;
+        last_realtime = realtime_now;
+        sendMotorUpdate();
+        return;
+    }
+
+    const double deltaSim = pkt->timestamp - last_timestamp;  // in seconds
+    if (deltaSim < 0) { // don't use old packet
+        return;
+    }
+
+    updateSensors(pkt);
 
 #if defined(SIMULATOR_IMU_SYNC)
     imuSetHasNewData(deltaSim*1e6);
@@ -165,47 +196,387 @@ void updateState(const fdm_packet* pkt) {
 #endif
 }
 
-static void* udpThread(void* data) {
-    UNUSED(data);
-    int n = 0;
+#if !defined(SIMULATOR_LOCKSTEP)
+static ioHandler_t stateHandler;
+
+static void onStatePacket(ioHandler_t *handler, uint32_t events) {
+    UNUSED(handler);
+    UNUSED(events);
+    int n;
 
-    while (workerRunning) {
-        n = udpRecv(&stateLink, &fdmPkt, sizeof(fdm_packet), 100);
+    while ((n = udpRecv(&stateLink, &fdmPkt, sizeof(fdm_packet), 0)) >= 0) {
         if (n == sizeof(fdm_packet)) {
 //            printf("[data]new fdm %d\n", n);
             updateState(&fdmPkt);
         }
     }
+}
+#endif
 
-    printf("udpThread end!!\n");
-    return NULL;
+static void physicsUpdate(fdm_packet* pkt) {
+    quadModelStep(&quadModel, motorsOutput, 1.0 / physicsRate);
+
+    pkt->timestamp = quadModel.time;
+    for (int axis = 0; axis < 3; axis++) {
+        pkt->imu_angular_velocity_rpy[axis] = quadModel.gyro[axis];
+        pkt->imu_linear_acceleration_xyz[axis] = quadModel.acc[axis];
+        pkt->velocity_xyz[axis] = quadModel.velocity[axis];
+        pkt->position_xyz[axis] = quadModel.position[axis];
+    }
+    memcpy(pkt->imu_orientation_quat, quadModel.attitude, sizeof(pkt->imu_orientation_quat));
 }
 
-static void* tcpThread(void* data) {
-    UNUSED(data);
+#if !defined(SIMULATOR_LOCKSTEP)
+// steps the physics model in real time
+static ioHandler_t physicsTimer;
 
-    dyad_init();
-    dyad_setTickInterval(0.2f);
-    dyad_setUpdateTimeout(0.5f);
+static void onPhysicsTimer(ioHandler_t *handler, uint32_t events) {
+    UNUSED(events);
 
-    while (workerRunning) {
-        dyad_update();
+    // catch up on missed periods, the model time follows the real time
+    for (uint64_t expirations = ioHandlerAcknowledge(handler); expirations > 0; expirations--) {
+        physicsUpdate(&fdmPkt);
     }
+    updateSensors(&fdmPkt);
+}
+#endif
+
+// all sockets and timers are handled by this thread
+static void* ioThread(void* data) {
+    UNUSED(data);
 
-    dyad_shutdown();
-    printf("tcpThread end!!\n");
+    ioReactorRun();
+
+    printf("ioThread end!!\n");
     return NULL;
 }
 
+#if defined(SIMULATOR_LOCKSTEP)
+// The virtual clock behind micros() and millis(), it only moves on in simulatorLockstepUpdate() and the delays.
+static uint64_t lockstepTimeUs = 0;
+// the clock runs up to the timestamp of the last FDM packet
+static uint64_t lockstepFrameEndUs = 0;
+static bool lockstepStarted = false;
+static double lockstepTimestampBase; // in seconds
+static uint64_t lockstepTimeBaseUs;
+static double lockstepLastTimestamp;
+
+static const char *recordFileName = NULL;
+static const char *replayFileName = NULL;
+static traceRecord_t replayRecord;
+static uint64_t replayStartUs;
+static uint32_t replayFrames;
+static uint32_t replayMismatches;
+#define REPLAY_MAX_REPORTS 10
+
+static void recordSerial(uint8_t id, const uint8_t *data, uint32_t length) {
+    traceWrite(TRACE_SERIAL, id, lockstepTimeUs, data, length);
+}
+
+static void replayMismatch(void) {
+    replayMismatches++;
+    if (replayMismatches == REPLAY_MAX_REPORTS) {
+        printf("[replay]more differences are not shown\n");
+    }
+}
+
+static void replayFinish(void) {
+    const double realSeconds = (micros64_real() - replayStartUs) * 1e-6;
+    printf("[replay]%u frames, %.3fs in %.3fs, %u differences\n", replayFrames, lockstepTimeUs * 1e-6, realSeconds, replayMismatches);
+    traceClose();
+    exit(replayMismatches ? 1 : 0);
+}
+
+// Feeds the inputs recorded for the next frame and checks the outputs of the last one, in the order they were
+// written: the motor outputs, the serial data and then the fdm packet that starts the frame.
+static void replayFrame(void) {
+    if (!replayStartUs) {
+        replayStartUs = micros64_real();
+    }
+
+    while (true) {
+        if (!traceRead(&replayRecord)) {
+            replayFinish();
+        }
+        if (replayRecord.timeUs != lockstepTimeUs) {
+            if (replayMismatches < REPLAY_MAX_REPORTS) {
+                printf("[replay]record at %.6fs read at %.6fs\n", replayRecord.timeUs * 1e-6, lockstepTimeUs * 1e-6);
+            }
+            replayMismatch();
+        }
+
+        switch (replayRecord.type) {
+        case TRACE_MOTOR: {
+            const servo_packet *expected = (const servo_packet *)replayRecord.data;
+            replayFrames++;
+            if (replayRecord.length != sizeof(pwmPkt) || memcmp(expected, &pwmPkt, sizeof(pwmPkt)) != 0) {
+                if (replayMismatches < REPLAY_MAX_REPORTS) {
+                    printf("[replay]motors at %.6fs: %f,%f,%f,%f recorded %f,%f,%f,%f\n", lockstepTimeUs * 1e-6,
+                        (double)pwmPkt.motor_speed[0], (double)pwmPkt.motor_speed[1], (double)pwmPkt.motor_speed[2], (double)pwmPkt.motor_speed[3],
+                        (double)expected->motor_speed[0], (double)expected->motor_speed[1], (double)expected->motor_speed[2], (double)expected->motor_speed[3]);
+                }
+                replayMismatch();
+            }
+            break;
+        }
+        case TRACE_SERIAL:
+            if (!tcpRxInject(replayRecord.port, replayRecord.data, replayRecord.length)) {
+                if (replayMismatches < REPLAY_MAX_REPORTS) {
+                    printf("[replay]UART%u dropped %u bytes at %.6fs\n", replayRecord.port + 1, replayRecord.length, lockstepTimeUs * 1e-6);
+                }
+                replayMismatch();
+            }
+            break;
+        case TRACE_FDM:
+            memcpy(&fdmPkt, replayRecord.data, MIN(replayRecord.length, sizeof(fdmPkt)));
+            return;
+        default:
+            break;
+        }
+    }
+}
+
+static void lockstepWaitForPacket(void) {
+    if (traceIsReplaying()) {
+        tcpLockstepSync(NULL);
+        replayFrame();
+    } else {
+        tcpLockstepSync(traceIsRecording() ? recordSerial : NULL);
+        if (usePhysics) {
+            physicsUpdate(&fdmPkt);
+        } else {
+            while (udpRecv(&stateLink, &fdmPkt, sizeof(fdm_packet), 100) != sizeof(fdm_packet)) {
+            }
+        }
+        traceWrite(TRACE_FDM, 0, lockstepTimeUs, &fdmPkt, sizeof(fdmPkt));
+    }
+
+    if (!lockstepStarted || fdmPkt.timestamp < lockstepLastTimestamp) { // first packet or simulator restarted
+        lockstepTimestampBase = fdmPkt.timestamp;
+        lockstepTimeBaseUs = lockstepTimeUs;
+        lockstepStarted = true;
+    }
+    lockstepLastTimestamp = fdmPkt.timestamp;
+    lockstepFrameEndUs = lockstepTimeBaseUs + llrint((fdmPkt.timestamp - lockstepTimestampBase) * 1e6);
+
+    updateSensors(&fdmPkt);
+}
+
+// Called after every scheduler pass. Each pass takes one microsecond of virtual time and the time in which no
+// task is due is skipped. Once everything due up to the end of the frame has run the motor packet is sent.
+void simulatorLockstepUpdate(void) {
+    if (!lockstepStarted) {
+        lockstepWaitForPacket();
+        return;
+    }
+
+    lockstepTimeUs++;
+    const timeDelta_t idleUs = schedulerGetTimeToNextTask(micros());
+    if (lockstepTimeUs + idleUs <= lockstepFrameEndUs) {
+        lockstepTimeUs += idleUs;
+        return;
+    }
+
+    lockstepTimeUs = MAX(lockstepTimeUs, lockstepFrameEndUs);
+    traceWrite(TRACE_MOTOR, 0, lockstepTimeUs, &pwmPkt, sizeof(pwmPkt));
+    if (!usePhysics && !traceIsReplaying()) {
+        udpSend(&pwmLink, &pwmPkt, sizeof(servo_packet));
+    }
+    lockstepWaitForPacket();
+}
+#endif
+
+static void printUsage(const char *name) {
+    printf("usage: %s [options]\n", name);
+    printf("  --instance=N          offset all ports by %d * N and use eeprom_N.bin\n", INSTANCE_PORT_STEP);
+    printf("  --tcp-port=PORT       UARTn listens on PORT + n (5760)\n");
+    printf("  --sim-addr=IP         address of the simulator (%s)\n", simulatorAddress);
+    printf("  --sim-out-port=PORT   udp port of the simulator for the motor outputs (9002)\n");
+    printf("  --sim-in-port=PORT    udp port for the sensor data from the simulator (9003)\n");
+    printf("  --eeprom=PATH         config storage file (%s)\n", EEPROM_FILENAME);
+    printf("  --physics             use the built-in quad model instead of an external simulator\n");
+    printf("  --physics-rate=HZ     model step rate (%.0f)\n", physicsRate);
+    printf("  --mass=KG             (%.3f)\n", quadModelConfig.mass);
+    printf("  --max-thrust=N        thrust per motor at full throttle (%.2f)\n", quadModelConfig.maxThrust);
+    printf("  --motor-tau=S         motor and prop time constant (%.3f)\n", quadModelConfig.motorTimeConstant);
+    printf("  --gyro-noise=RAD/S    gyro noise standard deviation (%.4f)\n", quadModelConfig.gyroNoise);
+    printf("  --acc-noise=M/S/S     accelerometer noise standard deviation (%.4f)\n", quadModelConfig.accNoise);
+    printf("  --seed=N              noise seed (%u)\n", quadModelConfig.seed);
+#if defined(SIMULATOR_LOCKSTEP)
+    printf("  --record=FILE         write a trace of all inputs and motor outputs\n");
+    printf("  --replay=FILE         run on the inputs of a trace and compare the motor outputs\n");
+#endif
+}
+
+void targetParseArgs(int argc, char *argv[]) {
+    enum {
+        OPT_INSTANCE = 256,
+        OPT_TCP_PORT,
+        OPT_SIM_ADDR,
+        OPT_SIM_OUT_PORT,
+        OPT_SIM_IN_PORT,
+        OPT_EEPROM,
+        OPT_PHYSICS,
+        OPT_PHYSICS_RATE,
+        OPT_MASS,
+        OPT_MAX_THRUST,
+        OPT_MOTOR_TAU,
+        OPT_GYRO_NOISE,
+        OPT_ACC_NOISE,
+        OPT_SEED,
+        OPT_RECORD,
+        OPT_REPLAY,
+        OPT_HELP,
+    };
+    static const struct option options[] = {
+        { "instance", required_argument, NULL, OPT_INSTANCE },
+        { "tcp-port", required_argument, NULL, OPT_TCP_PORT },
+        { "sim-addr", required_argument, NULL, OPT_SIM_ADDR },
+        { "sim-out-port", required_argument, NULL, OPT_SIM_OUT_PORT },
+        { "sim-in-port", required_argument, NULL, OPT_SIM_IN_PORT },
+        { "eeprom", required_argument, NULL, OPT_EEPROM },
+        { "physics", no_argument, NULL, OPT_PHYSICS },
+        { "physics-rate", required_argument, NULL, OPT_PHYSICS_RATE },
+        { "mass", required_argument, NULL, OPT_MASS },
+        { "max-thrust", required_argument, NULL, OPT_MAX_THRUST },
+        { "motor-tau", required_argument, NULL, OPT_MOTOR_TAU },
+        { "gyro-noise", required_argument, NULL, OPT_GYRO_NOISE },
+        { "acc-noise", required_argument, NULL, OPT_ACC_NOISE },
+        { "seed", required_argument, NULL, OPT_SEED },
+#if defined(SIMULATOR_LOCKSTEP)
+        { "record", required_argument, NULL, OPT_RECORD },
+        { "replay", required_argument, NULL, OPT_REPLAY },
+#endif
+        { "help", no_argument, NULL, OPT_HELP },
+        { NULL, 0, NULL, 0 }
+    };
+
+    quadModelConfigDefaults(&quadModelConfig);
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "", options, NULL)) != -1) {
+        switch (opt) {
+        case OPT_INSTANCE:
+            instance = atoi(optarg);
+            break;
+        case OPT_TCP_PORT:
+            tcpBasePort = atoi(optarg);
+            break;
+        case OPT_SIM_ADDR:
+            simulatorAddress = optarg;
+            break;
+        case OPT_SIM_OUT_PORT:
+            simulatorOutPort = atoi(optarg);
+            break;
+        case OPT_SIM_IN_PORT:
+            simulatorInPort = atoi(optarg);
+            break;
+        case OPT_EEPROM:
+            eepromFileName = optarg;
+            break;
+        case OPT_PHYSICS:
+            usePhysics = true;
+            break;
+        case OPT_PHYSICS_RATE:
+            physicsRate = atof(optarg);
+            break;
+        case OPT_MASS:
+            quadModelConfig.mass = atof(optarg);
+            break;
+        case OPT_MAX_THRUST:
+            quadModelConfig.maxThrust = atof(optarg);
+            break;
+        case OPT_MOTOR_TAU:
+            quadModelConfig.motorTimeConstant = atof(optarg);
+            break;
+        case OPT_GYRO_NOISE:
+            quadModelConfig.gyroNoise = atof(optarg);
+            break;
+        case OPT_ACC_NOISE:
+            quadModelConfig.accNoise = atof(optarg);
+            break;
+        case OPT_SEED:
+            quadModelConfig.seed = strtoul(optarg, NULL, 0);
+            break;
+#if defined(SIMULATOR_LOCKSTEP)
+        case OPT_RECORD:
+            recordFileName = optarg;
+            break;
+        case OPT_REPLAY:
+            replayFileName = optarg;
+            break;
+#endif
+        case OPT_HELP:
+            printUsage(argv[0]);
+            exit(0);
+        default:
+            printUsage(argv[0]);
+            exit(1);
+        }
+    }
+
+    if (physicsRate < 50 || quadModelConfig.mass <= 0) { // same lower bound as for an external simulator
+        printf("invalid physics model parameters\n");
+        exit(1);
+    }
+
+    // explicit ports and paths take precedence over the instance defaults
+    const int portOffset = instance * INSTANCE_PORT_STEP;
+    if (tcpBasePort < 0) {
+        tcpBasePort = 5760 + portOffset;
+    }
+    if (simulatorOutPort < 0) {
+        simulatorOutPort = 9002 + portOffset;
+    }
+    if (simulatorInPort < 0) {
+        simulatorInPort = 9003 + portOffset;
+    }
+    if (!eepromFileName) {
+        if (instance) {
+            snprintf(instanceEepromFileName, sizeof(instanceEepromFileName), "eeprom_%d.bin", instance);
+            eepromFileName = instanceEepromFileName;
+        } else {
+            eepromFileName = EEPROM_FILENAME;
+        }
+    }
+    if (instance < 0 || tcpBasePort + SERIAL_PORT_COUNT > 65535 || simulatorOutPort > 65535 || simulatorInPort > 65535) {
+        printf("invalid instance or port\n");
+        exit(1);
+    }
+    tcpSetBasePort(tcpBasePort);
+
+#if defined(SIMULATOR_LOCKSTEP)
+    if (recordFileName && replayFileName) {
+        printf("--record and --replay can't be combined\n");
+        exit(1);
+    }
+    if (recordFileName && !traceOpenRecord(recordFileName)) {
+        exit(1);
+    }
+    if (replayFileName) {
+        // the trace starts with the config storage, the run doesn't depend on a local eeprom.bin
+        if (!traceOpenReplay(replayFileName) || !traceRead(&replayRecord) || replayRecord.type != TRACE_EEPROM || replayRecord.length != sizeof(eepromData)) {
+            printf("can't replay '%s'\n", replayFileName);
+            exit(1);
+        }
+        memcpy(eepromData, replayRecord.data, sizeof(eepromData));
+        usePhysics = false;
+        tcpSetOffline();
+    }
+#endif
+}
+
 // system
 void systemInit(void) {
     int ret;
 
     clock_gettime(CLOCK_MONOTONIC, &start_time);
     printf("[system]Init...\n");
+    printf("[system]instance %d, tcp %d, eeprom '%s'\n", instance, tcpBasePort + 1, eepromFileName);
 
     SystemCoreClock = 500 * 1e6; // fake 500MHz
     FLASH_Unlock();
+    traceWrite(TRACE_EEPROM, 0, 0, eepromData, sizeof(eepromData));
 
     if (pthread_mutex_init(&updateLock, NULL) != 0) {
         printf("Create updateLock error!\n");
@@ -217,40 +588,63 @@ void systemInit(void) {
         exit(1);
     }
 
-    ret = pthread_create(&tcpWorker, NULL, tcpThread, NULL);
+    if (!ioReactorInit()) {
+        printf("Create io reactor error!\n");
+        exit(1);
+    }
+
+    ret = pthread_create(&ioWorker, NULL, ioThread, NULL);
     if (ret != 0) {
-        printf("Create tcpWorker error!\n");
+        printf("Create ioWorker error!\n");
         exit(1);
     }
 
-    ret = udpInit(&pwmLink, "127.0.0.1", 9002, false);
-    printf("init PwnOut UDP link...%d\n", ret);
+    if (traceIsReplaying()) {
+        printf("[system]replaying a trace\n");
+    } else if (usePhysics) {
+        quadModelInit(&quadModel, &quadModelConfig);
+        printf("[system]physics model at %.0fHz\n", physicsRate);
+    } else {
+        ret = udpInit(&pwmLink, simulatorAddress, simulatorOutPort, false);
+        printf("init PwnOut UDP link to %s:%d...%d\n", simulatorAddress, simulatorOutPort, ret);
 
-    ret = udpInit(&stateLink, NULL, 9003, true);
-    printf("start UDP server...%d\n", ret);
+        ret = udpInit(&stateLink, NULL, simulatorInPort, true);
+        printf("start UDP server on %d...%d\n", simulatorInPort, ret);
+    }
 
-    ret = pthread_create(&udpWorker, NULL, udpThread, NULL);
-    if (ret != 0) {
-        printf("Create udpWorker error!\n");
+#if defined(SIMULATOR_LOCKSTEP)
+    // FDM packets are received, simulated or replayed by the main loop
+    if (!usePhysics && !traceIsReplaying()) {
+        printf("[system]lockstep, waiting for the simulator\n");
+    }
+#else
+    if (usePhysics) {
+        ret = ioTimerInit(&physicsTimer, onPhysicsTimer, 1e6 / physicsRate) && ioReactorAdd(&physicsTimer, EPOLLIN);
+    } else {
+        stateHandler.fd = stateLink.fd;
+        stateHandler.callback = onStatePacket;
+        ret = ioReactorAdd(&stateHandler, EPOLLIN);
+    }
+    if (!ret) {
+        printf("Create fdm handler error!\n");
         exit(1);
     }
 
     // serial can't been slow down
     rescheduleTask(TASK_SERIAL, 1);
+#endif
 }
 
 void systemReset(void){
     printf("[system]Reset!\n");
-    workerRunning = false;
-    pthread_join(tcpWorker, NULL);
-    pthread_join(udpWorker, NULL);
+    ioReactorStop();
+    pthread_join(ioWorker, NULL);
     exit(0);
 }
 void systemResetToBootloader(void) {
     printf("[system]ResetToBootloader!\n");
-    workerRunning = false;
-    pthread_join(tcpWorker, NULL);
-    pthread_join(udpWorker, NULL);
+    ioReactorStop();
+    pthread_join(ioWorker, NULL);
     exit(0);
 }
 
@@ -298,6 +692,15 @@ uint64_t millis64_real() {
     return 1.0e3*((ts.tv_sec + (ts.tv_nsec*1.0e-9)) - (start_time.tv_sec + (start_time.tv_nsec*1.0e-9)));
 }
 
+#if defined(SIMULATOR_LOCKSTEP)
+uint64_t micros64() {
+    return lockstepTimeUs;
+}
+
+uint64_t millis64() {
+    return lockstepTimeUs / 1000;
+}
+#else
 uint64_t micros64() {
     static uint64_t last = 0;
     static uint64_t out = 0;
@@ -321,6 +724,7 @@ uint64_t millis64() {
     return out*1e-6;
 //    return millis64_real();
 }
+#endif
 
 uint32_t micros(void) {
     return micros64() & 0xFFFFFFFF;
@@ -337,14 +741,25 @@ void microsleep(uint32_t usec) {
     while (nanosleep(&ts, &ts) == -1 && errno == EINTR) ;
 }
 
+#if defined(SIMULATOR_LOCKSTEP)
+void delayMicroseconds(uint32_t us) {
+    lockstepTimeUs += us;
+}
+#else
 void delayMicroseconds(uint32_t us) {
     microsleep(us / simRate);
 }
+#endif
 
 void delayMicroseconds_real(uint32_t us) {
     microsleep(us);
 }
 
+#if defined(SIMULATOR_LOCKSTEP)
+void delay(uint32_t ms) {
+    lockstepTimeUs += (uint64_t)ms * 1000;
+}
+#else
 void delay(uint32_t ms) {
     uint64_t start = millis64();
 
@@ -352,6 +767,7 @@ void delay(uint32_t ms) {
         microsleep(1000);
     }
 }
+#endif
 
 // Subtract the ‘struct timespec’ values X and Y,  storing the result in RESULT.
 // Return 1 if the difference is negative, otherwise 0.
@@ -446,9 +862,18 @@ void pwmCompleteMotorUpdate(uint8_t motorCount) {
     pwmPkt.motor_speed[1] = motorsPwm[2] / outScale;
     pwmPkt.motor_speed[2] = motorsPwm[3] / outScale;
 
+    for (int i = 0; i < QUAD_MODEL_MOTOR_COUNT; i++) {
+        motorsOutput[i] = motorsPwm[i] / outScale;
+    }
+
+#if !defined(SIMULATOR_LOCKSTEP)
+    if (usePhysics) {
+        return;
+    }
     // get one "fdm_packet" can only send one "servo_packet"!!
     if (pthread_mutex_trylock(&updateLock) != 0) return;
     udpSend(&pwmLink, &pwmPkt, sizeof(servo_packet));
+#endif
 //    printf("[pwm]%u:%u,%u,%u,%u\n", idlePulse, motorsPwm[0], motorsPwm[1], motorsPwm[2], motorsPwm[3]);
 }
 
@@ -468,16 +893,19 @@ char _Min_Stack_Size;
 
 // fake EEPROM
 static FILE *eepromFd = NULL;
-uint8_t eepromData[EEPROM_SIZE];
+uint8_t eepromData[EEPROM_SIZE] __attribute__((aligned(FLASH_PAGE_SIZE)));   // pages are erased at page boundaries
 
 void FLASH_Unlock(void) {
+    if (traceIsReplaying()) { // the config comes from the trace and is never saved
+        return;
+    }
     if (eepromFd != NULL) {
         fprintf(stderr, "[FLASH_Unlock] eepromFd != NULL\n");
         return;
     }
 
     // open or create
-    eepromFd = fopen(EEPROM_FILENAME,"r+");
+    eepromFd = fopen(eepromFileName,"r+");
     if (eepromFd != NULL) {
         // obtain file size:
         fseek(eepromFd , 0 , SEEK_END);
@@ -486,15 +914,16 @@ void FLASH_Unlock(void) {
 
         size_t n = fread(eepromData, 1, sizeof(eepromData), eepromFd);
         if (n == lSize) {
-            printf("[FLASH_Unlock] loaded '%s', size = %ld / %ld\n", EEPROM_FILENAME, lSize, sizeof(eepromData));
+            printf("[FLASH_Unlock] loaded '%s', size = %ld / %ld\n", eepromFileName, lSize, sizeof(eepromData));
         } else {
-            fprintf(stderr, "[FLASH_Unlock] failed to load '%s'\n", EEPROM_FILENAME);
+            fprintf(stderr, "[FLASH_Unlock] failed to load '%s'\n", eepromFileName);
             return;
         }
     } else {
-        printf("[FLASH_Unlock] created '%s', size = %ld\n", EEPROM_FILENAME, sizeof(eepromData));
-        if ((eepromFd = fopen(EEPROM_FILENAME, "w+")) == NULL) {
-            fprintf(stderr, "[FLASH_Unlock] failed to create '%s'\n", EEPROM_FILENAME);
+        printf("[FLASH_Unlock] created '%s', size = %ld\n", eepromFileName, sizeof(eepromData));
+        memset(eepromData, 0xff, sizeof(eepromData)); // erased flash
+        if ((eepromFd = fopen(eepromFileName, "w+")) == NULL) {
+            fprintf(stderr, "[FLASH_Unlock] failed to create '%s'\n", eepromFileName);
             return;
         }
         if (fwrite(eepromData, sizeof(eepromData), 1, eepromFd) != 1) {
@@ -505,26 +934,31 @@ void FLASH_Unlock(void) {
 
 void FLASH_Lock(void) {
     // flush & close
-    if (eepromFd != NULL) {
+    if (traceIsReplaying()) {
+        return;
+    } else if (eepromFd != NULL) {
         fseek(eepromFd, 0, SEEK_SET);
         fwrite(eepromData, 1, sizeof(eepromData), eepromFd);
         fclose(eepromFd);
         eepromFd = NULL;
-        printf("[FLASH_Lock] saved '%s'\n", EEPROM_FILENAME);
+        printf("[FLASH_Lock] saved '%s'\n", eepromFileName);
     } else {
         fprintf(stderr, "[FLASH_Lock] eeprom is not unlocked\n");
     }
 }
 
 FLASH_Status FLASH_ErasePage(uintptr_t Page_Address) {
-    UNUSED(Page_Address);
+    if ((Page_Address >= (uintptr_t)eepromData) && (Page_Address < (uintptr_t)ARRAYEND(eepromData))) {
+        memset((void*)Page_Address, 0xff, MIN(FLASH_PAGE_SIZE, (uintptr_t)ARRAYEND(eepromData) - Page_Address));
+    }
 //    printf("[FLASH_ErasePage]%x\n", Page_Address);
     return FLASH_COMPLETE;
 }
 
 FLASH_Status FLASH_ProgramWord(uintptr_t addr, uint32_t value) {
     if ((addr >= (uintptr_t)eepromData) && (addr < (uintptr_t)ARRAYEND(eepromData))) {
-        *((uint32_t*)addr) = value;
+        // like flash, programming only clears bits
+        *((uint32_t*)addr) &= value;
         printf("[FLASH_ProgramWord]%p = %08x\n", (void*)addr, *((uint32_t*)addr));
     } else {
             printf("[FLASH_ProgramWord]%p out of range!\n", (void*)addr);
@@ -32,10 +32,18 @@
 //#define SIMULATOR_IMU_SYNC
 //#define SIMULATOR_GYROPID_SYNC
 
+// run on a virtual clock driven by the FDM packet timestamps, as fast as the simulator allows
+//#define SIMULATOR_LOCKSTEP
+
+#if defined(SIMULATOR_LOCKSTEP) && (defined(SIMULATOR_GYROPID_SYNC) || defined(SIMULATOR_IMU_SYNC))
+#error "SIMULATOR_LOCKSTEP already runs everything in step with the simulator"
+#endif
+
 // file name to save config
 #define EEPROM_FILENAME "eeprom.bin"
 #define EEPROM_IN_RAM
 #define EEPROM_SIZE     8192
+#define FLASH_PAGE_SIZE 0x400
 
 #define U_ID_0 0
 #define U_ID_1 1
@@ -249,4 +257,6 @@ uint64_t micros64();
 uint64_t millis64();
 
 int lockMainPID(void);
+void targetParseArgs(int argc, char *argv[]);
+void simulatorLockstepUpdate(void);
 
@@ -0,0 +1,197 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "trace.h"
+
+#define TRACE_MAGIC "BFTRACE"
+#define TRACE_VERSION 1
+#define TRACE_WRITE_BUFFER_SIZE (64 * 1024)
+#define TRACE_GAP 0xff // empty record, bridges time gaps too long for one record header
+
+typedef struct traceFileHeader_s {
+    char magic[8];
+    uint32_t version;
+    uint32_t reserved;
+} traceFileHeader_t;
+
+typedef struct traceRecordHeader_s {
+    uint8_t type;
+    uint8_t port;
+    uint16_t length;
+    uint32_t timeDeltaUs; // since the previous record
+} traceRecordHeader_t;
+
+static int recordFd = -1;
+static FILE *replayFile = NULL;
+static uint64_t lastTimeUs;
+
+// records are collected here and written with plain write() calls, so the signal handler can save them too
+static uint8_t writeBuffer[TRACE_WRITE_BUFFER_SIZE];
+static size_t writeBufferUsed;
+
+static void traceFlush(void)
+{
+    const uint8_t *p = writeBuffer;
+    size_t remaining = writeBufferUsed;
+    while (remaining > 0) {
+        const ssize_t written = write(recordFd, p, remaining);
+        if (written < 0 && errno == EINTR) {
+            continue;
+        } else if (written <= 0) {
+            break;
+        }
+        p += written;
+        remaining -= written;
+    }
+    writeBufferUsed = 0;
+}
+
+static void traceAppend(const void *data, size_t length)
+{
+    if (writeBufferUsed + length > sizeof(writeBuffer)) {
+        traceFlush();
+    }
+    memcpy(&writeBuffer[writeBufferUsed], data, length);
+    writeBufferUsed += length;
+}
+
+// keeps the trace up to a crash or ctrl-c, the default action runs once the handler returns
+static void traceSignalHandler(int sig)
+{
+    traceFlush();
+    raise(sig);
+}
+
+bool traceOpenRecord(const char *fileName)
+{
+    recordFd = open(fileName, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (recordFd < 0) {
+        fprintf(stderr, "[trace]failed to create '%s': %s\n", fileName, strerror(errno));
+        return false;
+    }
+
+    traceFileHeader_t header = { .magic = TRACE_MAGIC, .version = TRACE_VERSION };
+    traceAppend(&header, sizeof(header));
+    lastTimeUs = 0;
+
+    atexit(traceClose);
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = traceSignalHandler;
+    action.sa_flags = SA_RESETHAND;
+    const int signals[] = { SIGINT, SIGTERM, SIGSEGV, SIGABRT, SIGFPE, SIGBUS };
+    for (unsigned i = 0; i < sizeof(signals) / sizeof(signals[0]); i++) {
+        sigaction(signals[i], &action, NULL);
+    }
+    return true;
+}
+
+bool traceOpenReplay(const char *fileName)
+{
+    replayFile = fopen(fileName, "rb");
+    if (!replayFile) {
+        fprintf(stderr, "[trace]failed to open '%s': %s\n", fileName, strerror(errno));
+        return false;
+    }
+
+    traceFileHeader_t header;
+    if (fread(&header, sizeof(header), 1, replayFile) != 1 || memcmp(header.magic, TRACE_MAGIC, sizeof(header.magic)) != 0) {
+        fprintf(stderr, "[trace]'%s' is not a trace\n", fileName);
+    } else if (header.version != TRACE_VERSION) {
+        fprintf(stderr, "[trace]'%s' has version %u, expected %u\n", fileName, header.version, TRACE_VERSION);
+    } else {
+        lastTimeUs = 0;
+        return true;
+    }
+    fclose(replayFile);
+    replayFile = NULL;
+    return false;
+}
+
+void traceClose(void)
+{
+    if (recordFd >= 0) {
+        traceFlush();
+        close(recordFd);
+        recordFd = -1;
+    }
+    if (replayFile) {
+        fclose(replayFile);
+        replayFile = NULL;
+    }
+}
+
+bool traceIsRecording(void)
+{
+    return recordFd >= 0;
+}
+
+bool traceIsReplaying(void)
+{
+    return replayFile != NULL;
+}
+
+void traceWrite(traceRecordType_e type, uint8_t port, uint64_t timeUs, const void *data, uint16_t length)
+{
+    if (recordFd < 0 || length > TRACE_MAX_LENGTH) {
+        return;
+    }
+
+    while (timeUs - lastTimeUs > UINT32_MAX) {
+        const traceRecordHeader_t gap = { .type = TRACE_GAP, .timeDeltaUs = UINT32_MAX };
+        traceAppend(&gap, sizeof(gap));
+        lastTimeUs += UINT32_MAX;
+    }
+
+    const traceRecordHeader_t header = {
+        .type = type,
+        .port = port,
+        .length = length,
+        .timeDeltaUs = timeUs - lastTimeUs,
+    };
+    lastTimeUs = timeUs;
+    traceAppend(&header, sizeof(header));
+    traceAppend(data, length);
+}
+
+bool traceRead(traceRecord_t *record)
+{
+    traceRecordHeader_t header;
+    do {
+        if (!replayFile || fread(&header, sizeof(header), 1, replayFile) != 1 || header.length > TRACE_MAX_LENGTH) {
+            return false;
+        }
+        lastTimeUs += header.timeDeltaUs;
+    } while (header.type == TRACE_GAP);
+    if (header.length && fread(record->data, header.length, 1, replayFile) != 1) {
+        return false;
+    }
+
+    record->type = header.type;
+    record->port = header.port;
+    record->length = header.length;
+    record->timeUs = lastTimeUs;
+    return true;
+}
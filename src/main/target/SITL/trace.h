@@ -0,0 +1,52 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Binary trace of everything going into and out of a lockstep SITL run, see README.md.
+// A file is a header followed by records, each record is an 8 byte record header and its payload.
+
+#define TRACE_MAX_LENGTH 8192 // largest payload, the config storage
+
+typedef enum {
+    TRACE_EEPROM = 0,   // config storage at start up
+    TRACE_FDM,          // fdm_packet from the simulator or the physics model
+    TRACE_SERIAL,       // bytes received on UART port + 1
+    TRACE_MOTOR,        // servo_packet at the end of a frame
+} traceRecordType_e;
+
+typedef struct traceRecord_s {
+    uint8_t type;
+    uint8_t port;
+    uint16_t length;
+    uint64_t timeUs;    // virtual time
+    uint8_t data[TRACE_MAX_LENGTH];
+} traceRecord_t;
+
+bool traceOpenRecord(const char *fileName);
+bool traceOpenReplay(const char *fileName);
+void traceClose(void);
+bool traceIsRecording(void);
+bool traceIsReplaying(void);
+
+// timeUs must not decrease from one record to the next
+void traceWrite(traceRecordType_e type, uint8_t port, uint64_t timeUs, const void *data, uint16_t length);
+// false at the end of the trace, a truncated last record counts as the end
+bool traceRead(traceRecord_t *record);
@@ -56,11 +56,12 @@ int udpRecv(udpLink_t* link, void* data, size_t size, uint32_t timeout_ms) {
     tv.tv_sec = timeout_ms / 1000;
     tv.tv_usec = (timeout_ms % 1000) * 1000UL;
 
-    if (select(link->fd+1, &fds, NULL, NULL, &tv) != 1) {
+    // without a timeout the socket is just read, it is non blocking
+    if (timeout_ms && select(link->fd+1, &fds, NULL, NULL, &tv) != 1) {
         return -1;
     }
 
-    socklen_t len;
+    socklen_t len = sizeof(link->recv);
     int ret;
     ret = recvfrom(link->fd, data, size, 0, (struct sockaddr *)&link->recv, &len);
     return ret;
@@ -46,7 +46,9 @@
 
 #ifdef STM32F4
 #define USE_DSHOT
+#define USE_DSHOT_TELEMETRY
 #define USE_ESC_SENSOR
+#define USE_RPM_FILTER
 #define I2C3_OVERCLOCK true
 #define TELEMETRY_IBUS
 #define USE_GYRO_DATA_ANALYSE
@@ -55,6 +57,7 @@
 #ifdef STM32F7
 #define USE_DSHOT
 #define USE_ESC_SENSOR
+#define USE_RPM_FILTER
 #define I2C3_OVERCLOCK true
 #define I2C4_OVERCLOCK true
 #define TELEMETRY_IBUS
@@ -125,6 +128,8 @@
 #define VTX_TRAMP
 #define USE_CAMERA_CONTROL
 #define USE_HUFFMAN
+#define USE_CLI_VALUE_INDEX
+#define USE_MSP_STREAM
 
 #ifdef USE_SERIALRX_SPEKTRUM
 #define USE_SPEKTRUM_BIND
@@ -137,4 +142,5 @@
 #define GPS
 #define USE_NAV
 #define USE_UNCOMMON_MIXERS
+#define USE_MSP_STATS
 #endif
@@ -51,18 +51,19 @@
 
 #include "telemetry/telemetry.h"
 #include "telemetry/crsf.h"
+#include "telemetry/snapshot.h"
 
 #include "fc/config.h"
 
-#define CRSF_CYCLETIME_US                   100000 // 100ms, 10 Hz
+#define CRSF_CYCLETIME_US                   100000 // 100ms, 10 Hz for each frame in the schedule
 
 static bool crsfTelemetryEnabled;
-static uint8_t crsfFrame[CRSF_FRAME_SIZE_MAX];
 
-static void crsfInitializeFrame(sbuf_t *dst)
+// frames are built in place, frame must have room for CRSF_FRAME_SIZE_MAX bytes
+static void crsfInitializeFrame(sbuf_t *dst, uint8_t *frame)
 {
-    dst->ptr = crsfFrame;
-    dst->end = ARRAYEND(crsfFrame);
+    dst->ptr = frame;
+    dst->end = frame + CRSF_FRAME_SIZE_MAX;
 
     sbufWriteU8(dst, CRSF_ADDRESS_BROADCAST);
 }
@@ -77,23 +78,11 @@ static void crsfWriteCrc(sbuf_t *dst, uint8_t *start)
     sbufWriteU8(dst, crc);
 }
 
-static void crsfFinalize(sbuf_t *dst)
+// returns the frame size
+static int crsfFinalize(sbuf_t *dst, uint8_t *frame)
 {
-    crsfWriteCrc(dst, &crsfFrame[2]); // start at byte 2, since CRC does not include device address and frame length
-    sbufSwitchToReader(dst, crsfFrame);
-    // write the telemetry frame to the receiver.
-    crsfRxWriteTelemetryData(sbufPtr(dst), sbufBytesRemaining(dst));
-}
-
-static int crsfFinalizeBuf(sbuf_t *dst, uint8_t *frame)
-{
-    crsfWriteCrc(dst, &crsfFrame[2]); // start at byte 2, since CRC does not include device address and frame length
-    sbufSwitchToReader(dst, crsfFrame);
-    const int frameSize = sbufBytesRemaining(dst);
-    for (int ii = 0; sbufBytesRemaining(dst); ++ii) {
-        frame[ii] = sbufReadU8(dst);
-    }
-    return frameSize;
+    crsfWriteCrc(dst, &frame[2]); // start at byte 2, since CRC does not include device address and frame length
+    return sbufPtr(dst) - frame;
 }
 
 /*
@@ -120,14 +109,15 @@ void crsfFrameGps(sbuf_t *dst)
     // use sbufWrite since CRC does not include frame length
     sbufWriteU8(dst, CRSF_FRAME_GPS_PAYLOAD_SIZE + CRSF_FRAME_LENGTH_TYPE_CRC);
     sbufWriteU8(dst, CRSF_FRAMETYPE_GPS);
-    sbufWriteU32BigEndian(dst, gpsSol.llh.lat); // CRSF and betaflight use same units for degrees
-    sbufWriteU32BigEndian(dst, gpsSol.llh.lon);
-    sbufWriteU16BigEndian(dst, (gpsSol.groundSpeed * 36 + 5) / 10); // gpsSol.groundSpeed is in 0.1m/s
-    sbufWriteU16BigEndian(dst, gpsSol.groundCourse * 10); // gpsSol.groundCourse is degrees * 10
+    const gpsSolutionData_t *sol = &telemetrySnapshot.gps.sol;
+    sbufWriteU32BigEndian(dst, sol->llh.lat); // CRSF and betaflight use same units for degrees
+    sbufWriteU32BigEndian(dst, sol->llh.lon);
+    sbufWriteU16BigEndian(dst, (sol->groundSpeed * 36 + 5) / 10); // gpsSol.groundSpeed is in 0.1m/s
+    sbufWriteU16BigEndian(dst, sol->groundCourse * 10); // gpsSol.groundCourse is degrees * 10
     //Send real GPS altitude only if it's reliable (there's a GPS fix)
-    const uint16_t altitude = (STATE(GPS_FIX) ? gpsSol.llh.alt : 0) + 1000;
+    const uint16_t altitude = (telemetrySnapshot.gps.fix ? sol->llh.alt : 0) + 1000;
     sbufWriteU16BigEndian(dst, altitude);
-    sbufWriteU8(dst, gpsSol.numSat);
+    sbufWriteU8(dst, sol->numSat);
 }
 
 /*
@@ -143,17 +133,18 @@ void crsfFrameBatterySensor(sbuf_t *dst)
     // use sbufWrite since CRC does not include frame length
     sbufWriteU8(dst, CRSF_FRAME_BATTERY_SENSOR_PAYLOAD_SIZE + CRSF_FRAME_LENGTH_TYPE_CRC);
     sbufWriteU8(dst, CRSF_FRAMETYPE_BATTERY_SENSOR);
-    sbufWriteU16BigEndian(dst, getBatteryVoltage()); // vbat is in units of 0.1V
 #ifdef CLEANFLIGHT
+    sbufWriteU16BigEndian(dst, getBatteryVoltage()); // vbat is in units of 0.1V
     const amperageMeter_t *amperageMeter = getAmperageMeter(batteryConfig()->amperageMeterSource);
     const int16_t amperage = constrain(amperageMeter->amperage, -0x8000, 0x7FFF) / 10; // send amperage in 0.01 A steps, range is -320A to 320A
     sbufWriteU16BigEndian(dst, amperage); // amperage is in units of 0.1A
     const uint32_t batteryCapacity = batteryConfig()->batteryCapacity;
     const uint8_t batteryRemainingPercentage = batteryCapacityRemainingPercentage();
 #else
-    sbufWriteU16BigEndian(dst, getAmperage() / 10);
-    const uint32_t batteryCapacity = batteryConfig()->batteryCapacity;
-    const uint8_t batteryRemainingPercentage = calculateBatteryPercentageRemaining();
+    sbufWriteU16BigEndian(dst, telemetrySnapshot.battery.voltage); // vbat is in units of 0.1V
+    sbufWriteU16BigEndian(dst, telemetrySnapshot.battery.amperage / 10);
+    const uint32_t batteryCapacity = telemetrySnapshot.battery.capacity;
+    const uint8_t batteryRemainingPercentage = telemetrySnapshot.battery.remainingPercent;
 #endif
     sbufWriteU8(dst, (batteryCapacity >> 16));
     sbufWriteU8(dst, (batteryCapacity >> 8));
@@ -197,9 +188,9 @@ void crsfFrameAttitude(sbuf_t *dst)
 {
      sbufWriteU8(dst, CRSF_FRAME_ATTITUDE_PAYLOAD_SIZE + CRSF_FRAME_LENGTH_TYPE_CRC);
      sbufWriteU8(dst, CRSF_FRAMETYPE_ATTITUDE);
-     sbufWriteU16BigEndian(dst, DECIDEGREES_TO_RADIANS10000(attitude.values.pitch));
-     sbufWriteU16BigEndian(dst, DECIDEGREES_TO_RADIANS10000(attitude.values.roll));
-     sbufWriteU16BigEndian(dst, DECIDEGREES_TO_RADIANS10000(attitude.values.yaw));
+     sbufWriteU16BigEndian(dst, DECIDEGREES_TO_RADIANS10000(telemetrySnapshot.attitude.values.pitch));
+     sbufWriteU16BigEndian(dst, DECIDEGREES_TO_RADIANS10000(telemetrySnapshot.attitude.values.roll));
+     sbufWriteU16BigEndian(dst, DECIDEGREES_TO_RADIANS10000(telemetrySnapshot.attitude.values.yaw));
 }
 
 /*
@@ -239,38 +230,52 @@ void crsfFrameFlightMode(sbuf_t *dst)
 static uint8_t crsfScheduleCount;
 static uint8_t crsfSchedule[CRSF_SCHEDULE_COUNT_MAX];
 
+// frames made from the telemetry snapshot are only built again after the field they send changed
+typedef struct crsfCachedFrame_s {
+    uint32_t seenVersion;
+    uint8_t length;
+    uint8_t frame[CRSF_FRAME_SIZE_MAX];
+} crsfCachedFrame_t;
+
+static crsfCachedFrame_t crsfCachedFrames[CRSF_FRAME_GPS + 1];
+
+static int crsfWriteSnapshotFrame(uint8_t *frame, crsfFrameType_e frameType, uint8_t field)
+{
+    crsfCachedFrame_t *cached = &crsfCachedFrames[frameType];
+    if ((telemetrySnapshotChanges(&cached->seenVersion) & field) || cached->length == 0) {
+        cached->length = getCrsfFrame(cached->frame, frameType);
+    }
+    memcpy(frame, cached->frame, cached->length);
+    return cached->length;
+}
 
-static void processCrsf(void)
+// false while the previous frame is still waiting for its telemetry slot
+static bool processCrsf(void)
 {
     static uint8_t crsfScheduleIndex = 0;
     const uint8_t currentSchedule = crsfSchedule[crsfScheduleIndex];
 
-    sbuf_t crsfPayloadBuf;
-    sbuf_t *dst = &crsfPayloadBuf;
+    // the frame is built straight into the receiver's transmit buffer
+    uint8_t *frame = crsfRxBeginTelemetryFrame();
+    if (!frame) {
+        return false;
+    }
 
+    int frameSize = 0;
     if (currentSchedule & BV(CRSF_FRAME_ATTITUDE)) {
-        crsfInitializeFrame(dst);
-        crsfFrameAttitude(dst);
-        crsfFinalize(dst);
-    }
-    if (currentSchedule & BV(CRSF_FRAME_BATTERY_SENSOR)) {
-        crsfInitializeFrame(dst);
-        crsfFrameBatterySensor(dst);
-        crsfFinalize(dst);
-    }
-    if (currentSchedule & BV(CRSF_FRAME_FLIGHT_MODE)) {
-        crsfInitializeFrame(dst);
-        crsfFrameFlightMode(dst);
-        crsfFinalize(dst);
-    }
+        frameSize = crsfWriteSnapshotFrame(frame, CRSF_FRAME_ATTITUDE, TELEMETRY_SNAPSHOT_ATTITUDE);
+    } else if (currentSchedule & BV(CRSF_FRAME_BATTERY_SENSOR)) {
+        frameSize = crsfWriteSnapshotFrame(frame, CRSF_FRAME_BATTERY_SENSOR, TELEMETRY_SNAPSHOT_BATTERY);
+    } else if (currentSchedule & BV(CRSF_FRAME_FLIGHT_MODE)) {
+        frameSize = getCrsfFrame(frame, CRSF_FRAME_FLIGHT_MODE);
 #ifdef GPS
-    if (currentSchedule & BV(CRSF_FRAME_GPS)) {
-        crsfInitializeFrame(dst);
-        crsfFrameGps(dst);
-        crsfFinalize(dst);
-    }
+    } else if (currentSchedule & BV(CRSF_FRAME_GPS)) {
+        frameSize = crsfWriteSnapshotFrame(frame, CRSF_FRAME_GPS, TELEMETRY_SNAPSHOT_GPS);
 #endif
+    }
+    crsfRxEndTelemetryFrame(frameSize);
     crsfScheduleIndex = (crsfScheduleIndex + 1) % crsfScheduleCount;
+    return true;
 }
 
 void initCrsfTelemetry(void)
@@ -304,15 +309,13 @@ void handleCrsfTelemetry(timeUs_t currentTimeUs)
     if (!crsfTelemetryEnabled) {
         return;
     }
-    // Give the receiver a chance to send any outstanding telemetry data.
-    // This needs to be done at high frequency, to enable the RX to send the telemetry frame
-    // in between the RX frames.
-    crsfRxSendTelemetryData();
 
-    // Actual telemetry data only needs to be sent at a low frequency, ie 10Hz
-    if (currentTimeUs >= crsfLastCycleTime + CRSF_CYCLETIME_US) {
+    // Actual telemetry data only needs to be sent at a low frequency, ie 10Hz.
+    // Spread out sending the frames over the cycle, so each of them is sent every 100ms.
+    // The frame is queued for the receiver, which sends it in the gap after the next RX frame,
+    // so a slot only counts once its frame was queued and no more than one frame per RX frame is sent.
+    if (currentTimeUs >= crsfLastCycleTime + CRSF_CYCLETIME_US / crsfScheduleCount && processCrsf()) {
         crsfLastCycleTime = currentTimeUs;
-        processCrsf();
     }
 }
 
@@ -321,7 +324,7 @@ int getCrsfFrame(uint8_t *frame, crsfFrameType_e frameType)
     sbuf_t crsfFrameBuf;
     sbuf_t *sbuf = &crsfFrameBuf;
 
-    crsfInitializeFrame(sbuf);
+    crsfInitializeFrame(sbuf, frame);
     switch (frameType) {
     default:
     case CRSF_FRAME_ATTITUDE:
@@ -339,7 +342,6 @@ int getCrsfFrame(uint8_t *frame, crsfFrameType_e frameType)
         break;
 #endif
     }
-    const int frameSize = crsfFinalizeBuf(sbuf, frame);
-    return frameSize;
+    return crsfFinalize(sbuf, frame);
 }
 #endif
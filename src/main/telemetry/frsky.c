@@ -63,6 +63,7 @@
 
 #include "telemetry/telemetry.h"
 #include "telemetry/frsky.h"
+#include "telemetry/snapshot.h"
 
 #ifdef USE_ESC_SENSOR
 #include "sensors/esc_sensor.h"
@@ -178,17 +179,17 @@ static void sendAccel(void)
 static void sendBaro(void)
 {
     sendDataHead(ID_ALTITUDE_BP);
-    serialize16(getEstimatedAltitude() / 100);
+    serialize16(telemetrySnapshot.altitude.estimatedCm / 100);
     sendDataHead(ID_ALTITUDE_AP);
-    serialize16(ABS(getEstimatedAltitude() % 100));
+    serialize16(ABS(telemetrySnapshot.altitude.estimatedCm % 100));
 }
 
 #ifdef GPS
 static void sendGpsAltitude(void)
 {
-    uint16_t altitude = gpsSol.llh.alt;
+    uint16_t altitude = telemetrySnapshot.gps.sol.llh.alt;
     //Send real GPS altitude only if it's reliable (there's a GPS fix)
-    if (!STATE(GPS_FIX)) {
+    if (!telemetrySnapshot.gps.fix) {
         altitude = 0;
     }
     sendDataHead(ID_GPS_ALTIDUTE_BP);
@@ -233,9 +234,10 @@ static void sendTemperature1(void)
 #ifdef GPS
 static void sendSatalliteSignalQualityAsTemperature2(void)
 {
-    uint16_t satellite = gpsSol.numSat;
-    if (gpsSol.hdop > GPS_BAD_QUALITY && ( (cycleNum % 16 ) < 8)) {//Every 1s
-        satellite = constrain(gpsSol.hdop, 0, GPS_MAX_HDOP_VAL);
+    const gpsSolutionData_t *sol = &telemetrySnapshot.gps.sol;
+    uint16_t satellite = sol->numSat;
+    if (sol->hdop > GPS_BAD_QUALITY && ( (cycleNum % 16 ) < 8)) {//Every 1s
+        satellite = constrain(sol->hdop, 0, GPS_MAX_HDOP_VAL);
     }
     sendDataHead(ID_TEMPRATURE2);
 
@@ -251,15 +253,16 @@ static void sendSatalliteSignalQualityAsTemperature2(void)
 
 static void sendSpeed(void)
 {
-    if (!STATE(GPS_FIX)) {
+    if (!telemetrySnapshot.gps.fix) {
         return;
     }
+    const uint16_t groundSpeed = telemetrySnapshot.gps.sol.groundSpeed;
     //Speed should be sent in knots (GPS speed is in cm/s)
     sendDataHead(ID_GPS_SPEED_BP);
     //convert to knots: 1cm/s = 0.0194384449 knots
-    serialize16(gpsSol.groundSpeed * 1944 / 100000);
+    serialize16(groundSpeed * 1944 / 100000);
     sendDataHead(ID_GPS_SPEED_AP);
-    serialize16((gpsSol.groundSpeed * 1944 / 100) % 100);
+    serialize16((groundSpeed * 1944 / 100) % 100);
 }
 #endif
 
@@ -342,11 +345,11 @@ static void sendGPSLatLong(void)
     static uint8_t gpsFixOccured = 0;
     int32_t coord[2] = {0,0};
 
-    if (STATE(GPS_FIX) || gpsFixOccured == 1) {
+    if (telemetrySnapshot.gps.fix || gpsFixOccured == 1) {
         // If we have ever had a fix, send the last known lat/long
         gpsFixOccured = 1;
-        coord[LAT] = gpsSol.llh.lat;
-        coord[LON] = gpsSol.llh.lon;
+        coord[LAT] = telemetrySnapshot.gps.sol.llh.lat;
+        coord[LON] = telemetrySnapshot.gps.sol.llh.lon;
         sendLatLong(coord);
     } else {
         // otherwise send fake lat/long in order to display compass value
@@ -362,7 +365,7 @@ static void sendGPSLatLong(void)
 static void sendVario(void)
 {
     sendDataHead(ID_VERT_SPEED);
-    serialize16(getEstimatedVario());
+    serialize16(telemetrySnapshot.altitude.varioCms);
 }
 
 /*
@@ -377,7 +380,7 @@ static void sendVoltage(void)
     uint32_t cellVoltage;
     uint16_t payload;
 
-    uint8_t cellCount = getBatteryCellCount();
+    uint8_t cellCount = telemetrySnapshot.battery.cellCount;
     /*
      * Format for Voltage Data for single cells is like this:
      *
@@ -389,7 +392,7 @@ static void sendVoltage(void)
      * The actual value sent for cell voltage has resolution of 0.002 volts
      * Since vbat has resolution of 0.1 volts it has to be multiplied by 50
      */
-    cellVoltage = ((uint32_t)getBatteryVoltage() * 100 + cellCount) / (cellCount * 2);
+    cellVoltage = ((uint32_t)telemetrySnapshot.battery.voltage * 100 + cellCount) / (cellCount * 2);
 
     // Cell number is at bit 9-12
     payload = (currentCell << 4);
@@ -412,7 +415,7 @@ static void sendVoltage(void)
  */
 static void sendVoltageAmp(void)
 {
-    uint16_t batteryVoltage = getBatteryVoltage();
+    uint16_t batteryVoltage = telemetrySnapshot.battery.voltage;
     if (telemetryConfig()->frsky_vfas_precision == FRSKY_VFAS_PRECISION_HIGH) {
         /*
          * Use new ID 0x39 to send voltage directly in 0.1 volts resolution
@@ -423,7 +426,7 @@ static void sendVoltageAmp(void)
         uint16_t voltage = (batteryVoltage * 110) / 21;
         uint16_t vfasVoltage;
         if (telemetryConfig()->report_cell_voltage) {
-            vfasVoltage = voltage / getBatteryCellCount();
+            vfasVoltage = voltage / telemetrySnapshot.battery.cellCount;
         } else {
             vfasVoltage = voltage;
         }
@@ -437,24 +440,24 @@ static void sendVoltageAmp(void)
 static void sendAmperage(void)
 {
     sendDataHead(ID_CURRENT);
-    serialize16((uint16_t)(getAmperage() / 10));
+    serialize16((uint16_t)(telemetrySnapshot.battery.amperage / 10));
 }
 
 static void sendFuelLevel(void)
 {
     sendDataHead(ID_FUEL_LEVEL);
 
-    if (batteryConfig()->batteryCapacity > 0) {
-        serialize16((uint16_t)calculateBatteryPercentageRemaining());
+    if (telemetrySnapshot.battery.capacity > 0) {
+        serialize16((uint16_t)telemetrySnapshot.battery.remainingPercent);
     } else {
-        serialize16((uint16_t)constrain(getMAhDrawn(), 0, 0xFFFF));
+        serialize16((uint16_t)constrain(telemetrySnapshot.battery.mAhDrawn, 0, 0xFFFF));
     }
 }
 
 static void sendHeading(void)
 {
     sendDataHead(ID_COURSE_BP);
-    serialize16(DECIDEGREES_TO_DEGREES(attitude.values.yaw));
+    serialize16(DECIDEGREES_TO_DEGREES(telemetrySnapshot.attitude.values.yaw));
     sendDataHead(ID_COURSE_AP);
     serialize16(0);
 }
@@ -575,7 +578,7 @@ void handleFrSkyTelemetry(void)
         sendTemperature1();
         sendThrottleOrBatterySizeAsRpm();
 
-        if (batteryConfig()->voltageMeterSource != VOLTAGE_METER_NONE && getBatteryCellCount() > 0) {
+        if (batteryConfig()->voltageMeterSource != VOLTAGE_METER_NONE && telemetrySnapshot.battery.cellCount > 0) {
             sendVoltage();
             sendVoltageAmp();
             sendAmperage();
@@ -88,6 +88,7 @@
 
 #include "telemetry/telemetry.h"
 #include "telemetry/hott.h"
+#include "telemetry/snapshot.h"
 
 //#define HOTT_DEBUG
 
@@ -185,32 +186,34 @@ void addGPSCoordinates(HOTT_GPS_MSG_t *hottGPSMessage, int32_t latitude, int32_t
 
 void hottPrepareGPSResponse(HOTT_GPS_MSG_t *hottGPSMessage)
 {
-    hottGPSMessage->gps_satelites = gpsSol.numSat;
+    const gpsSolutionData_t *sol = &telemetrySnapshot.gps.sol;
 
-    if (!STATE(GPS_FIX)) {
+    hottGPSMessage->gps_satelites = sol->numSat;
+
+    if (!telemetrySnapshot.gps.fix) {
         hottGPSMessage->gps_fix_char = GPS_FIX_CHAR_NONE;
         return;
     }
 
-    if (gpsSol.numSat >= 5) {
+    if (sol->numSat >= 5) {
         hottGPSMessage->gps_fix_char = GPS_FIX_CHAR_3D;
     } else {
         hottGPSMessage->gps_fix_char = GPS_FIX_CHAR_2D;
     }
 
-    addGPSCoordinates(hottGPSMessage, gpsSol.llh.lat, gpsSol.llh.lon);
+    addGPSCoordinates(hottGPSMessage, sol->llh.lat, sol->llh.lon);
 
     // GPS Speed is returned in cm/s (from io/gps.c) and must be sent in km/h (Hott requirement)
-    const uint16_t speed = (gpsSol.groundSpeed * 36) / 1000;
+    const uint16_t speed = (sol->groundSpeed * 36) / 1000;
     hottGPSMessage->gps_speed_L = speed & 0x00FF;
     hottGPSMessage->gps_speed_H = speed >> 8;
 
-    hottGPSMessage->home_distance_L = GPS_distanceToHome & 0x00FF;
-    hottGPSMessage->home_distance_H = GPS_distanceToHome >> 8;
+    hottGPSMessage->home_distance_L = telemetrySnapshot.gps.distanceToHome & 0x00FF;
+    hottGPSMessage->home_distance_H = telemetrySnapshot.gps.distanceToHome >> 8;
 
-    uint16_t altitude = gpsSol.llh.alt;
-    if (!STATE(GPS_FIX)) {
-        altitude = getEstimatedAltitude() / 100;
+    uint16_t altitude = sol->llh.alt;
+    if (!telemetrySnapshot.gps.fix) {
+        altitude = telemetrySnapshot.altitude.estimatedCm / 100;
     }
 
     const uint16_t hottGpsAltitude = (altitude) + HOTT_GPS_ALTITUDE_OFFSET; // gpsSol.llh.alt in m ; offset = 500 -> O m
@@ -218,7 +221,7 @@ void hottPrepareGPSResponse(HOTT_GPS_MSG_t *hottGPSMessage)
     hottGPSMessage->altitude_L = hottGpsAltitude & 0x00FF;
     hottGPSMessage->altitude_H = hottGpsAltitude >> 8;
 
-    hottGPSMessage->home_direction = GPS_directionToHome;
+    hottGPSMessage->home_direction = telemetrySnapshot.gps.directionToHome;
 }
 #endif
 
@@ -233,7 +236,7 @@ static inline void updateAlarmBatteryStatus(HOTT_EAM_MSG_t *hottEAMMessage)
 
     if (shouldTriggerBatteryAlarmNow()) {
         lastHottAlarmSoundTime = millis();
-        batteryState = getBatteryState();
+        batteryState = telemetrySnapshot.battery.state;
         if (batteryState == BATTERY_WARNING  || batteryState == BATTERY_CRITICAL) {
             hottEAMMessage->warning_beeps = 0x10;
             hottEAMMessage->alarm_invers1 = HOTT_EAM_ALARM1_FLAG_BATTERY_1;
@@ -247,31 +250,32 @@ static inline void updateAlarmBatteryStatus(HOTT_EAM_MSG_t *hottEAMMessage)
 
 static inline void hottEAMUpdateBattery(HOTT_EAM_MSG_t *hottEAMMessage)
 {
-    hottEAMMessage->main_voltage_L = getBatteryVoltage() & 0xFF;
-    hottEAMMessage->main_voltage_H = getBatteryVoltage() >> 8;
-    hottEAMMessage->batt1_voltage_L = getBatteryVoltage() & 0xFF;
-    hottEAMMessage->batt1_voltage_H = getBatteryVoltage() >> 8;
+    const uint16_t voltage = telemetrySnapshot.battery.voltage;
+    hottEAMMessage->main_voltage_L = voltage & 0xFF;
+    hottEAMMessage->main_voltage_H = voltage >> 8;
+    hottEAMMessage->batt1_voltage_L = voltage & 0xFF;
+    hottEAMMessage->batt1_voltage_H = voltage >> 8;
 
     updateAlarmBatteryStatus(hottEAMMessage);
 }
 
 static inline void hottEAMUpdateCurrentMeter(HOTT_EAM_MSG_t *hottEAMMessage)
 {
-    int32_t amp = getAmperage() / 10;
+    int32_t amp = telemetrySnapshot.battery.amperage / 10;
     hottEAMMessage->current_L = amp & 0xFF;
     hottEAMMessage->current_H = amp >> 8;
 }
 
 static inline void hottEAMUpdateBatteryDrawnCapacity(HOTT_EAM_MSG_t *hottEAMMessage)
 {
-    int32_t mAh = getMAhDrawn() / 10;
+    int32_t mAh = telemetrySnapshot.battery.mAhDrawn / 10;
     hottEAMMessage->batt_cap_L = mAh & 0xFF;
     hottEAMMessage->batt_cap_H = mAh >> 8;
 }
 
 static inline void hottEAMUpdateAltitude(HOTT_EAM_MSG_t *hottEAMMessage)
 {
-    const uint16_t hottEamAltitude = (getEstimatedAltitude() / 100) + HOTT_EAM_OFFSET_HEIGHT;
+    const uint16_t hottEamAltitude = (telemetrySnapshot.altitude.estimatedCm / 100) + HOTT_EAM_OFFSET_HEIGHT;
 
     hottEAMMessage->altitude_L = hottEamAltitude & 0x00FF;
     hottEAMMessage->altitude_H = hottEamAltitude >> 8;
@@ -279,7 +283,7 @@ static inline void hottEAMUpdateAltitude(HOTT_EAM_MSG_t *hottEAMMessage)
 
 static inline void hottEAMUpdateClimbrate(HOTT_EAM_MSG_t *hottEAMMessage)
 {
-    int32_t vario = getEstimatedVario();
+    int32_t vario = telemetrySnapshot.altitude.varioCms;
     hottEAMMessage->climbrate_L = (30000 + vario) & 0x00FF;
     hottEAMMessage->climbrate_H = (30000 + vario) >> 8;
     hottEAMMessage->climbrate3s = 120 + (vario / 100);
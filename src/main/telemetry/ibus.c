@@ -122,6 +122,12 @@ void handleIbusTelemetry(void)
 }
 
 
+bool ibusTelemetryNeedsService(void)
+{
+    return ibusTelemetryEnabled && serialRxBytesWaiting(ibusSerialPort) > 0;
+}
+
+
 bool checkIbusTelemetryState(void)
 {
     bool newTelemetryEnabledValue = telemetryDetermineEnabledState(ibusPortSharing);
@@ -20,6 +20,7 @@
 void initIbusTelemetry(void);
 
 void handleIbusTelemetry(void);
+bool ibusTelemetryNeedsService(void);
 bool checkIbusTelemetryState(void);
 
 void configureIbusTelemetryPort(void);
@@ -125,6 +125,7 @@ static uint8_t dispatchMeasurementReply(ibusAddress_t address)
 
     switch (sensorAddressTypeLookup[address - ibusBaseAddress]) {
     case IBUS_SENSOR_TYPE_EXTERNAL_VOLTAGE:
+        // not from telemetrySnapshot, shared IBUS is answered by the rx driver also without FEATURE_TELEMETRY
         value = getBatteryVoltage() * 10;
         if (telemetryConfig()->report_cell_voltage) {
             value /= getBatteryCellCount();
@@ -74,10 +74,10 @@
 
 #include "telemetry/telemetry.h"
 #include "telemetry/ltm.h"
+#include "telemetry/snapshot.h"
 
 
 #define TELEMETRY_LTM_INITIAL_PORT_MODE MODE_TX
-#define LTM_CYCLETIME   100
 
 static serialPort_t *ltmPort;
 static serialPortConfig_t *portConfig;
@@ -126,30 +126,24 @@ static void ltm_gframe(void)
 {
 #if defined(GPS)
     uint8_t gps_fix_type = 0;
-    int32_t ltm_alt;
+    const gpsSolutionData_t *sol = &telemetrySnapshot.gps.sol;
 
     if (!sensors(SENSOR_GPS))
         return;
 
-    if (!STATE(GPS_FIX))
+    if (!telemetrySnapshot.gps.fix)
         gps_fix_type = 1;
-    else if (gpsSol.numSat < 5)
+    else if (sol->numSat < 5)
         gps_fix_type = 2;
     else
         gps_fix_type = 3;
 
     ltm_initialise_packet('G');
-    ltm_serialise_32(gpsSol.llh.lat);
-    ltm_serialise_32(gpsSol.llh.lon);
-    ltm_serialise_8((uint8_t)(gpsSol.groundSpeed / 100));
-
-#if defined(BARO) || defined(SONAR)
-    ltm_alt = (sensors(SENSOR_SONAR) || sensors(SENSOR_BARO)) ? getEstimatedAltitude() : gpsSol.llh.alt * 100;
-#else
-    ltm_alt = gpsSol.llh.alt * 100;
-#endif
-    ltm_serialise_32(ltm_alt);
-    ltm_serialise_8((gpsSol.numSat << 2) | gps_fix_type);
+    ltm_serialise_32(sol->llh.lat);
+    ltm_serialise_32(sol->llh.lon);
+    ltm_serialise_8((uint8_t)(sol->groundSpeed / 100));
+    ltm_serialise_32(telemetrySnapshot.altitude.bestCm);
+    ltm_serialise_8((sol->numSat << 2) | gps_fix_type);
     ltm_finalise();
 #endif
 }
@@ -190,7 +184,7 @@ static void ltm_sframe(void)
     if (failsafeIsActive())
         lt_statemode |= 2;
     ltm_initialise_packet('S');
-    ltm_serialise_16(getBatteryVoltage() * 100);    //vbat converted to mv
+    ltm_serialise_16(telemetrySnapshot.battery.voltage * 100);    //vbat converted to mv
     ltm_serialise_16(0);             //  current, not implemented
     ltm_serialise_8((uint8_t)((rssi * 254) / 1023));        // scaled RSSI (uchar)
     ltm_serialise_8(0);              // no airspeed
@@ -205,9 +199,9 @@ static void ltm_sframe(void)
 static void ltm_aframe()
 {
     ltm_initialise_packet('A');
-    ltm_serialise_16(DECIDEGREES_TO_DEGREES(attitude.values.pitch));
-    ltm_serialise_16(DECIDEGREES_TO_DEGREES(attitude.values.roll));
-    ltm_serialise_16(DECIDEGREES_TO_DEGREES(attitude.values.yaw));
+    ltm_serialise_16(DECIDEGREES_TO_DEGREES(telemetrySnapshot.attitude.values.pitch));
+    ltm_serialise_16(DECIDEGREES_TO_DEGREES(telemetrySnapshot.attitude.values.roll));
+    ltm_serialise_16(DECIDEGREES_TO_DEGREES(telemetrySnapshot.attitude.values.yaw));
     ltm_finalise();
 }
 
@@ -248,17 +242,11 @@ static void process_ltm(void)
 
 void handleLtmTelemetry(void)
 {
-    static uint32_t ltm_lastCycleTime;
-    uint32_t now;
     if (!ltmEnabled)
         return;
     if (!ltmPort)
         return;
-    now = millis();
-    if ((now - ltm_lastCycleTime) >= LTM_CYCLETIME) {
-        process_ltm();
-        ltm_lastCycleTime = now;
-    }
+    process_ltm();
 }
 
 void freeLtmTelemetryPort(void)
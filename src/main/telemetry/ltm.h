@@ -19,6 +19,8 @@
 
 #pragma once
 
+#define LTM_CYCLETIME_US 100000 // 100ms, 10 Hz, handleLtmTelemetry() sends one cycle per call
+
 void initLtmTelemetry(void);
 void handleLtmTelemetry(void);
 void checkLtmTelemetryState(void);
@@ -68,6 +68,7 @@
 
 #include "telemetry/telemetry.h"
 #include "telemetry/mavlink.h"
+#include "telemetry/snapshot.h"
 
 // mavlink library uses unnames unions that's causes GCC to complain if -Wpedantic is used
 // until this is resolved in mavlink library - ignore -Wpedantic for mavlink code
@@ -76,9 +77,9 @@
 #include "common/mavlink.h"
 #pragma GCC diagnostic pop
 
-#define TELEMETRY_MAVLINK_INITIAL_PORT_MODE MODE_TX
-#define TELEMETRY_MAVLINK_MAXRATE 50
-#define TELEMETRY_MAVLINK_DELAY ((1000 * 1000) / TELEMETRY_MAVLINK_MAXRATE)
+#define TELEMETRY_MAVLINK_INITIAL_PORT_MODE MODE_RXTX // ground stations request the stream rates
+
+#define MAVLINK_CMD_SET_MESSAGE_INTERVAL 511 // newer than the bundled common dialect
 
 extern uint16_t rssi; // FIXME dependency on mw.c
 
@@ -88,49 +89,113 @@ static serialPortConfig_t *portConfig;
 static bool mavlinkTelemetryEnabled =  false;
 static portSharing_e mavlinkPortSharing;
 
-/* MAVLink datastream rates in Hz */
-static const uint8_t mavRates[] = {
-    [MAV_DATA_STREAM_EXTENDED_STATUS] = 2, //2Hz
-    [MAV_DATA_STREAM_RC_CHANNELS] = 5, //5Hz
-    [MAV_DATA_STREAM_POSITION] = 2, //2Hz
-    [MAV_DATA_STREAM_EXTRA1] = 10, //10Hz
-    [MAV_DATA_STREAM_EXTRA2] = 10 //2Hz
+#define MAVLINK_MSG_SIZE(len) ((len) + MAVLINK_NUM_NON_PAYLOAD_BYTES)
+
+typedef struct mavlinkStream_s {
+    void (*send)(void);
+    uint16_t length;            // bytes sent by send(), to check the transmit buffer has room
+    uint8_t messageCount;
+    uint8_t messageIds[3];      // messages in the stream, for SET_MESSAGE_INTERVAL
+} mavlinkStream_t;
+
+static void mavlinkSendSystemStatus(void);
+static void mavlinkSendRCChannelsAndRSSI(void);
+#ifdef GPS
+static void mavlinkSendPosition(void);
+#endif
+static void mavlinkSendAttitude(void);
+static void mavlinkSendHUDAndHeartbeat(void);
+
+static const mavlinkStream_t mavStreams[] = {
+    [MAV_DATA_STREAM_EXTENDED_STATUS] = {
+        mavlinkSendSystemStatus, MAVLINK_MSG_SIZE(MAVLINK_MSG_ID_SYS_STATUS_LEN), 1, { MAVLINK_MSG_ID_SYS_STATUS }
+    },
+    [MAV_DATA_STREAM_RC_CHANNELS] = {
+        mavlinkSendRCChannelsAndRSSI, MAVLINK_MSG_SIZE(MAVLINK_MSG_ID_RC_CHANNELS_RAW_LEN), 1, { MAVLINK_MSG_ID_RC_CHANNELS_RAW }
+    },
+#ifdef GPS
+    [MAV_DATA_STREAM_POSITION] = {
+        mavlinkSendPosition,
+        MAVLINK_MSG_SIZE(MAVLINK_MSG_ID_GPS_RAW_INT_LEN) + MAVLINK_MSG_SIZE(MAVLINK_MSG_ID_GLOBAL_POSITION_INT_LEN) + MAVLINK_MSG_SIZE(MAVLINK_MSG_ID_GPS_GLOBAL_ORIGIN_LEN),
+        3, { MAVLINK_MSG_ID_GPS_RAW_INT, MAVLINK_MSG_ID_GLOBAL_POSITION_INT, MAVLINK_MSG_ID_GPS_GLOBAL_ORIGIN }
+    },
+#endif
+    [MAV_DATA_STREAM_EXTRA1] = {
+        mavlinkSendAttitude, MAVLINK_MSG_SIZE(MAVLINK_MSG_ID_ATTITUDE_LEN), 1, { MAVLINK_MSG_ID_ATTITUDE }
+    },
+    [MAV_DATA_STREAM_EXTRA2] = {
+        mavlinkSendHUDAndHeartbeat, MAVLINK_MSG_SIZE(MAVLINK_MSG_ID_VFR_HUD_LEN) + MAVLINK_MSG_SIZE(MAVLINK_MSG_ID_HEARTBEAT_LEN), 2, { MAVLINK_MSG_ID_VFR_HUD, MAVLINK_MSG_ID_HEARTBEAT }
+    },
 };
 
-#define MAXSTREAMS (sizeof(mavRates) / sizeof(mavRates[0]))
+#define MAXSTREAMS ARRAYLEN(mavStreams)
+
+// time between two sends of each stream, 0 when the stream is off
+static timeDelta_t mavIntervalUs[MAXSTREAMS];
+static timeUs_t mavNextDueUs[MAXSTREAMS];
+static timeUs_t mavNextStreamDueUs;     // earliest of mavNextDueUs for the enabled streams
+static uint8_t mavFirstStream;          // streams are tried from here, so all get a turn when the link is full
 
-static uint8_t mavTicks[MAXSTREAMS];
 static mavlink_message_t mavMsg;
-static uint8_t mavBuffer[MAVLINK_MAX_PACKET_LEN];
-static uint32_t lastMavlinkMessage = 0;
 
-static int mavlinkStreamTrigger(enum MAV_DATA_STREAM streamNum)
+// messages due in one run are packed here and written with a single serialWriteBuf()
+static uint8_t mavBatch[MAVLINK_MAX_PACKET_LEN];
+static uint16_t mavBatchLength;
+
+static void mavlinkFlush(void)
 {
-    uint8_t rate = (uint8_t) mavRates[streamNum];
-    if (rate == 0) {
-        return 0;
+    if (mavBatchLength > 0) {
+        serialWriteBuf(mavlinkPort, mavBatch, mavBatchLength);
+        mavBatchLength = 0;
     }
+}
 
-    if (mavTicks[streamNum] == 0) {
-        // we're triggering now, setup the next trigger point
-        if (rate > TELEMETRY_MAVLINK_MAXRATE) {
-            rate = TELEMETRY_MAVLINK_MAXRATE;
-        }
+// appends mavMsg to the batch
+static void mavlinkSendMessage(void)
+{
+    if (mavBatchLength + MAVLINK_MSG_SIZE(mavMsg.len) > (int)sizeof(mavBatch)) {
+        mavlinkFlush();
+    }
+    mavBatchLength += mavlink_msg_to_send_buffer(&mavBatch[mavBatchLength], &mavMsg);
+}
 
-        mavTicks[streamNum] = (TELEMETRY_MAVLINK_MAXRATE / rate);
-        return 1;
+static timeDelta_t mavlinkRateToInterval(uint16_t rateHz)
+{
+    if (rateHz == 0) {
+        return 0;
     }
+    return 1000000 / MIN(rateHz, TELEMETRY_MAVLINK_MAXRATE);
+}
 
-    // count down at TASK_RATE_HZ
-    mavTicks[streamNum]--;
-    return 0;
+static void mavlinkSetStreamInterval(uint8_t streamNum, timeDelta_t intervalUs)
+{
+    mavIntervalUs[streamNum] = intervalUs ? MAX(intervalUs, 1000000 / TELEMETRY_MAVLINK_MAXRATE) : 0;
+    mavNextDueUs[streamNum] = mavNextStreamDueUs = micros();
 }
 
+static uint8_t mavlinkConfiguredRate(uint8_t streamNum)
+{
+    switch (streamNum) {
+    case MAV_DATA_STREAM_EXTENDED_STATUS:
+        return telemetryConfig()->mavlink_extended_status_rate;
+    case MAV_DATA_STREAM_RC_CHANNELS:
+        return telemetryConfig()->mavlink_rc_channels_rate;
+    case MAV_DATA_STREAM_POSITION:
+        return telemetryConfig()->mavlink_position_rate;
+    case MAV_DATA_STREAM_EXTRA1:
+        return telemetryConfig()->mavlink_extra1_rate;
+    case MAV_DATA_STREAM_EXTRA2:
+        return telemetryConfig()->mavlink_extra2_rate;
+    default:
+        return 0;
+    }
+}
 
-static void mavlinkSerialWrite(uint8_t * buf, uint16_t length)
+static void mavlinkResetStreamRates(void)
 {
-    for (int i = 0; i < length; i++)
-        serialWrite(mavlinkPort, buf[i]);
+    for (unsigned i = 0; i < MAXSTREAMS; i++) {
+        mavlinkSetStreamInterval(i, mavStreams[i].send ? mavlinkRateToInterval(mavlinkConfiguredRate(i)) : 0);
+    }
 }
 
 void freeMAVLinkTelemetryPort(void)
@@ -165,6 +230,7 @@ void configureMAVLinkTelemetryPort(void)
     }
 
     mavlinkTelemetryEnabled = true;
+    mavlinkResetStreamRates();
 }
 
 void checkMAVLinkTelemetryState(void)
@@ -173,6 +239,7 @@ void checkMAVLinkTelemetryState(void)
         if (!mavlinkTelemetryEnabled && telemetrySharedPort != NULL) {
             mavlinkPort = telemetrySharedPort;
             mavlinkTelemetryEnabled = true;
+            mavlinkResetStreamRates();
         }
     } else {
         bool newTelemetryEnabledValue = telemetryDetermineEnabledState(mavlinkPortSharing);
@@ -188,10 +255,8 @@ void checkMAVLinkTelemetryState(void)
     }
 }
 
-void mavlinkSendSystemStatus(void)
+static void mavlinkSendSystemStatus(void)
 {
-    uint16_t msgLength;
-
     uint32_t onboardControlAndSensors = 35843;
 
     /*
@@ -222,11 +287,11 @@ void mavlinkSendSystemStatus(void)
         // load Maximum usage in percent of the mainloop time, (0%: 0, 100%: 1000) should be always below 1000
         0,
         // voltage_battery Battery voltage, in millivolts (1 = 1 millivolt)
-        (batteryConfig()->voltageMeterSource != VOLTAGE_METER_NONE) ? getBatteryVoltage() * 100 : 0,
+        (batteryConfig()->voltageMeterSource != VOLTAGE_METER_NONE) ? telemetrySnapshot.battery.voltage * 100 : 0,
         // current_battery Battery current, in 10*milliamperes (1 = 10 milliampere), -1: autopilot does not measure the current
-        (batteryConfig()->currentMeterSource != CURRENT_METER_NONE) ? getAmperage() : -1,
+        (batteryConfig()->currentMeterSource != CURRENT_METER_NONE) ? telemetrySnapshot.battery.amperage : -1,
         // battery_remaining Remaining battery energy: (0%: 0, 100%: 100), -1: autopilot estimate the remaining battery
-        (batteryConfig()->voltageMeterSource != VOLTAGE_METER_NONE) ? calculateBatteryPercentageRemaining() : 100,
+        (batteryConfig()->voltageMeterSource != VOLTAGE_METER_NONE) ? telemetrySnapshot.battery.remainingPercent : 100,
         // drop_rate_comm Communication drops in percent, (0%: 0, 100%: 10'000), (UART, I2C, SPI, CAN), dropped packets on all links (packets that were corrupted on reception on the MAV)
         0,
         // errors_comm Communication errors (UART, I2C, SPI, CAN), dropped packets on all links (packets that were corrupted on reception on the MAV)
@@ -239,13 +304,11 @@ void mavlinkSendSystemStatus(void)
         0,
         // errors_count4 Autopilot-specific errors
         0);
-    msgLength = mavlink_msg_to_send_buffer(mavBuffer, &mavMsg);
-    mavlinkSerialWrite(mavBuffer, msgLength);
+    mavlinkSendMessage();
 }
 
-void mavlinkSendRCChannelsAndRSSI(void)
+static void mavlinkSendRCChannelsAndRSSI(void)
 {
-    uint16_t msgLength;
     mavlink_msg_rc_channels_raw_pack(0, 200, &mavMsg,
         // time_boot_ms Timestamp (milliseconds since system boot)
         millis(),
@@ -269,24 +332,23 @@ void mavlinkSendRCChannelsAndRSSI(void)
         (rxRuntimeConfig.channelCount >= 8) ? rcData[7] : 0,
         // rssi Receive signal strength indicator, 0: 0%, 255: 100%
         scaleRange(rssi, 0, 1023, 0, 255));
-    msgLength = mavlink_msg_to_send_buffer(mavBuffer, &mavMsg);
-    mavlinkSerialWrite(mavBuffer, msgLength);
+    mavlinkSendMessage();
 }
 
 #if defined(GPS)
-void mavlinkSendPosition(void)
+static void mavlinkSendPosition(void)
 {
-    uint16_t msgLength;
     uint8_t gpsFixType = 0;
+    const gpsSolutionData_t *sol = &telemetrySnapshot.gps.sol;
 
     if (!sensors(SENSOR_GPS))
         return;
 
-    if (!STATE(GPS_FIX)) {
+    if (!telemetrySnapshot.gps.fix) {
         gpsFixType = 1;
     }
     else {
-        if (gpsSol.numSat < 5) {
+        if (sol->numSat < 5) {
             gpsFixType = 2;
         }
         else {
@@ -300,40 +362,35 @@ void mavlinkSendPosition(void)
         // fix_type 0-1: no fix, 2: 2D fix, 3: 3D fix. Some applications will not use the value of this field unless it is at least two, so always correctly fill in the fix.
         gpsFixType,
         // lat Latitude in 1E7 degrees
-        gpsSol.llh.lat,
+        sol->llh.lat,
         // lon Longitude in 1E7 degrees
-        gpsSol.llh.lon,
+        sol->llh.lon,
         // alt Altitude in 1E3 meters (millimeters) above MSL
-        gpsSol.llh.alt * 1000,
+        sol->llh.alt * 1000,
         // eph GPS HDOP horizontal dilution of position in cm (m*100). If unknown, set to: 65535
         65535,
         // epv GPS VDOP horizontal dilution of position in cm (m*100). If unknown, set to: 65535
         65535,
         // vel GPS ground speed (m/s * 100). If unknown, set to: 65535
-        gpsSol.groundSpeed,
+        sol->groundSpeed,
         // cog Course over ground (NOT heading, but direction of movement) in degrees * 100, 0.0..359.99 degrees. If unknown, set to: 65535
-        gpsSol.groundCourse * 10,
+        sol->groundCourse * 10,
         // satellites_visible Number of satellites visible. If unknown, set to 255
-        gpsSol.numSat);
-    msgLength = mavlink_msg_to_send_buffer(mavBuffer, &mavMsg);
-    mavlinkSerialWrite(mavBuffer, msgLength);
+        sol->numSat);
+    mavlinkSendMessage();
 
     // Global position
     mavlink_msg_global_position_int_pack(0, 200, &mavMsg,
         // time_usec Timestamp (microseconds since UNIX epoch or microseconds since system boot)
         micros(),
         // lat Latitude in 1E7 degrees
-        gpsSol.llh.lat,
+        sol->llh.lat,
         // lon Longitude in 1E7 degrees
-        gpsSol.llh.lon,
+        sol->llh.lon,
         // alt Altitude in 1E3 meters (millimeters) above MSL
-        gpsSol.llh.alt * 1000,
+        sol->llh.alt * 1000,
         // relative_alt Altitude above ground in meters, expressed as * 1000 (millimeters)
-#if defined(BARO) || defined(SONAR)
-        (sensors(SENSOR_SONAR) || sensors(SENSOR_BARO)) ? getEstimatedAltitude() * 10 : gpsSol.llh.alt * 1000,
-#else
-        gpsSol.llh.alt * 1000,
-#endif
+        telemetrySnapshot.altitude.bestCm * 10,
         // Ground X Speed (Latitude), expressed as m/s * 100
         0,
         // Ground Y Speed (Longitude), expressed as m/s * 100
@@ -341,10 +398,9 @@ void mavlinkSendPosition(void)
         // Ground Z Speed (Altitude), expressed as m/s * 100
         0,
         // heading Current heading in degrees, in compass units (0..360, 0=north)
-        DECIDEGREES_TO_DEGREES(attitude.values.yaw)
+        DECIDEGREES_TO_DEGREES(telemetrySnapshot.attitude.values.yaw)
     );
-    msgLength = mavlink_msg_to_send_buffer(mavBuffer, &mavMsg);
-    mavlinkSerialWrite(mavBuffer, msgLength);
+    mavlinkSendMessage();
 
     mavlink_msg_gps_global_origin_pack(0, 200, &mavMsg,
         // latitude Latitude (WGS84), expressed as * 1E7
@@ -353,36 +409,32 @@ void mavlinkSendPosition(void)
         GPS_home[LON],
         // altitude Altitude(WGS84), expressed as * 1000
         0);
-    msgLength = mavlink_msg_to_send_buffer(mavBuffer, &mavMsg);
-    mavlinkSerialWrite(mavBuffer, msgLength);
+    mavlinkSendMessage();
 }
 #endif
 
-void mavlinkSendAttitude(void)
+static void mavlinkSendAttitude(void)
 {
-    uint16_t msgLength;
     mavlink_msg_attitude_pack(0, 200, &mavMsg,
         // time_boot_ms Timestamp (milliseconds since system boot)
         millis(),
         // roll Roll angle (rad)
-        DECIDEGREES_TO_RADIANS(attitude.values.roll),
+        DECIDEGREES_TO_RADIANS(telemetrySnapshot.attitude.values.roll),
         // pitch Pitch angle (rad)
-        DECIDEGREES_TO_RADIANS(-attitude.values.pitch),
+        DECIDEGREES_TO_RADIANS(-telemetrySnapshot.attitude.values.pitch),
         // yaw Yaw angle (rad)
-        DECIDEGREES_TO_RADIANS(attitude.values.yaw),
+        DECIDEGREES_TO_RADIANS(telemetrySnapshot.attitude.values.yaw),
         // rollspeed Roll angular speed (rad/s)
         0,
         // pitchspeed Pitch angular speed (rad/s)
         0,
         // yawspeed Yaw angular speed (rad/s)
         0);
-    msgLength = mavlink_msg_to_send_buffer(mavBuffer, &mavMsg);
-    mavlinkSerialWrite(mavBuffer, msgLength);
+    mavlinkSendMessage();
 }
 
-void mavlinkSendHUDAndHeartbeat(void)
+static void mavlinkSendHUDAndHeartbeat(void)
 {
-    uint16_t msgLength;
     float mavAltitude = 0;
     float mavGroundSpeed = 0;
     float mavAirSpeed = 0;
@@ -391,7 +443,7 @@ void mavlinkSendHUDAndHeartbeat(void)
 #if defined(GPS)
     // use ground speed if source available
     if (sensors(SENSOR_GPS)) {
-        mavGroundSpeed = gpsSol.groundSpeed / 100.0f;
+        mavGroundSpeed = telemetrySnapshot.gps.sol.groundSpeed / 100.0f;
     }
 #endif
 
@@ -399,18 +451,18 @@ void mavlinkSendHUDAndHeartbeat(void)
 #if defined(BARO) || defined(SONAR)
     if (sensors(SENSOR_SONAR) || sensors(SENSOR_BARO)) {
         // Baro or sonar generally is a better estimate of altitude than GPS MSL altitude
-        mavAltitude = getEstimatedAltitude() / 100.0;
+        mavAltitude = telemetrySnapshot.altitude.estimatedCm / 100.0;
     }
 #if defined(GPS)
     else if (sensors(SENSOR_GPS)) {
         // No sonar or baro, just display altitude above MLS
-        mavAltitude = gpsSol.llh.alt;
+        mavAltitude = telemetrySnapshot.gps.sol.llh.alt;
     }
 #endif
 #elif defined(GPS)
     if (sensors(SENSOR_GPS)) {
         // No sonar or baro, just display altitude above MLS
-        mavAltitude = gpsSol.llh.alt;
+        mavAltitude = telemetrySnapshot.gps.sol.llh.alt;
     }
 #endif
 
@@ -420,15 +472,14 @@ void mavlinkSendHUDAndHeartbeat(void)
         // groundspeed Current ground speed in m/s
         mavGroundSpeed,
         // heading Current heading in degrees, in compass units (0..360, 0=north)
-        DECIDEGREES_TO_DEGREES(attitude.values.yaw),
+        DECIDEGREES_TO_DEGREES(telemetrySnapshot.attitude.values.yaw),
         // throttle Current throttle setting in integer percent, 0 to 100
         scaleRange(constrain(rcData[THROTTLE], PWM_RANGE_MIN, PWM_RANGE_MAX), PWM_RANGE_MIN, PWM_RANGE_MAX, 0, 100),
         // alt Current altitude (MSL), in meters, if we have sonar or baro use them, otherwise use GPS (less accurate)
         mavAltitude,
         // climb Current climb rate in meters/second
         mavClimbRate);
-    msgLength = mavlink_msg_to_send_buffer(mavBuffer, &mavMsg);
-    mavlinkSerialWrite(mavBuffer, msgLength);
+    mavlinkSendMessage();
 
 
     uint8_t mavModes = MAV_MODE_FLAG_MANUAL_INPUT_ENABLED;
@@ -509,37 +560,131 @@ void mavlinkSendHUDAndHeartbeat(void)
         mavCustomMode,
         // system_status System status flag, see MAV_STATE ENUM
         mavSystemState);
-    msgLength = mavlink_msg_to_send_buffer(mavBuffer, &mavMsg);
-    mavlinkSerialWrite(mavBuffer, msgLength);
+    mavlinkSendMessage();
+}
+
+static void mavlinkSendCommandAck(uint16_t command, uint8_t result)
+{
+    mavlink_msg_command_ack_pack(0, 200, &mavMsg, command, result);
+    mavlinkSendMessage();
+}
+
+static void mavlinkHandleRequestDataStream(const mavlink_message_t *msg)
+{
+    mavlink_request_data_stream_t request;
+    mavlink_msg_request_data_stream_decode(msg, &request);
+
+    const timeDelta_t intervalUs = request.start_stop ? mavlinkRateToInterval(request.req_message_rate) : 0;
+    for (unsigned i = 0; i < MAXSTREAMS; i++) {
+        if (mavStreams[i].send && (request.req_stream_id == MAV_DATA_STREAM_ALL || request.req_stream_id == i)) {
+            mavlinkSetStreamInterval(i, intervalUs);
+        }
+    }
 }
 
-void processMAVLinkTelemetry(void)
+// SET_MESSAGE_INTERVAL changes the interval of the whole stream sending the message
+static void mavlinkHandleCommandLong(const mavlink_message_t *msg)
 {
-    // is executed @ TELEMETRY_MAVLINK_MAXRATE rate
-    if (mavlinkStreamTrigger(MAV_DATA_STREAM_EXTENDED_STATUS)) {
-        mavlinkSendSystemStatus();
+    mavlink_command_long_t command;
+    mavlink_msg_command_long_decode(msg, &command);
+
+    if (command.command != MAVLINK_CMD_SET_MESSAGE_INTERVAL) {
+        mavlinkSendCommandAck(command.command, MAV_RESULT_UNSUPPORTED);
+        return;
     }
 
-    if (mavlinkStreamTrigger(MAV_DATA_STREAM_RC_CHANNELS)) {
-        mavlinkSendRCChannelsAndRSSI();
+    const int messageId = command.param1;
+    const int32_t intervalUs = command.param2; // -1 to stop, 0 for the configured rate
+    for (unsigned i = 0; i < MAXSTREAMS; i++) {
+        for (unsigned j = 0; mavStreams[i].send && j < mavStreams[i].messageCount; j++) {
+            if (mavStreams[i].messageIds[j] == messageId) {
+                if (intervalUs == 0) {
+                    mavlinkSetStreamInterval(i, mavlinkRateToInterval(mavlinkConfiguredRate(i)));
+                } else {
+                    mavlinkSetStreamInterval(i, intervalUs > 0 ? intervalUs : 0);
+                }
+                mavlinkSendCommandAck(command.command, MAV_RESULT_ACCEPTED);
+                return;
+            }
+        }
     }
+    mavlinkSendCommandAck(command.command, MAV_RESULT_UNSUPPORTED);
+}
 
-#ifdef GPS
-    if (mavlinkStreamTrigger(MAV_DATA_STREAM_POSITION)) {
-        mavlinkSendPosition();
+static void mavlinkProcessRequests(void)
+{
+    static mavlink_message_t mavRxMsg;
+    mavlink_status_t status;
+
+    // a port shared with the receiver is read by the RX driver
+    if (mavlinkPort == telemetrySharedPort) {
+        return;
     }
-#endif
 
-    if (mavlinkStreamTrigger(MAV_DATA_STREAM_EXTRA1)) {
-        mavlinkSendAttitude();
+    while (serialRxBytesWaiting(mavlinkPort) > 0) {
+        if (!mavlink_parse_char(MAVLINK_COMM_0, serialRead(mavlinkPort), &mavRxMsg, &status)) {
+            continue;
+        }
+        switch (mavRxMsg.msgid) {
+        case MAVLINK_MSG_ID_REQUEST_DATA_STREAM:
+            mavlinkHandleRequestDataStream(&mavRxMsg);
+            break;
+        case MAVLINK_MSG_ID_COMMAND_LONG:
+            mavlinkHandleCommandLong(&mavRxMsg);
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+static void processMAVLinkTelemetry(timeUs_t currentTimeUs)
+{
+    // streams only go out when the transmit buffer has room for them, so a slow link lowers the rates instead of dropping bytes
+    int txRoom = serialTxBytesFree(mavlinkPort) - mavBatchLength;
+    bool throttled = false;
+
+    mavNextStreamDueUs = currentTimeUs + 1000000;
+    for (unsigned i = 0; i < MAXSTREAMS; i++) {
+        const unsigned streamNum = (mavFirstStream + i) % MAXSTREAMS;
+        const timeDelta_t intervalUs = mavIntervalUs[streamNum];
+        if (intervalUs == 0) {
+            continue;
+        }
+
+        if (cmpTimeUs(currentTimeUs, mavNextDueUs[streamNum]) >= 0) {
+            if (mavStreams[streamNum].length <= txRoom) {
+                mavStreams[streamNum].send();
+                txRoom -= mavStreams[streamNum].length;
+                mavNextDueUs[streamNum] += intervalUs;
+                if (cmpTimeUs(currentTimeUs, mavNextDueUs[streamNum]) >= 0) {
+                    // fell behind, e.g. after being throttled, don't send a burst to catch up
+                    mavNextDueUs[streamNum] = currentTimeUs + intervalUs;
+                }
+            } else if (!throttled) {
+                // the first stream that didn't fit goes first next time
+                mavFirstStream = streamNum;
+                throttled = true;
+            }
+        }
+
+        if (cmpTimeUs(mavNextDueUs[streamNum], mavNextStreamDueUs) < 0) {
+            mavNextStreamDueUs = mavNextDueUs[streamNum];
+        }
     }
 
-    if (mavlinkStreamTrigger(MAV_DATA_STREAM_EXTRA2)) {
-        mavlinkSendHUDAndHeartbeat();
+    mavlinkFlush();
+}
+
+bool mavlinkTelemetryNeedsService(void)
+{
+    if (!mavlinkTelemetryEnabled || !mavlinkPort) {
+        return false;
     }
+    return cmpTimeUs(micros(), mavNextStreamDueUs) >= 0 || (mavlinkPort != telemetrySharedPort && serialRxBytesWaiting(mavlinkPort) > 0);
 }
 
-void handleMAVLinkTelemetry(void)
+void handleMAVLinkTelemetry(timeUs_t currentTimeUs)
 {
     if (!mavlinkTelemetryEnabled) {
         return;
@@ -549,11 +694,8 @@ void handleMAVLinkTelemetry(void)
         return;
     }
 
-    uint32_t now = micros();
-    if ((now - lastMavlinkMessage) >= TELEMETRY_MAVLINK_DELAY) {
-        processMAVLinkTelemetry();
-        lastMavlinkMessage = now;
-    }
+    mavlinkProcessRequests();
+    processMAVLinkTelemetry(currentTimeUs);
 }
 
 #endif
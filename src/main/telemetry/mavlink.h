@@ -17,8 +17,13 @@
 
 #pragma once
 
+#include "common/time.h"
+
+#define TELEMETRY_MAVLINK_MAXRATE 100 // Hz, highest rate of a stream
+
 void initMAVLinkTelemetry(void);
-void handleMAVLinkTelemetry(void);
+void handleMAVLinkTelemetry(timeUs_t currentTimeUs);
+bool mavlinkTelemetryNeedsService(void);
 void checkMAVLinkTelemetryState(void);
 
 void freeMAVLinkTelemetryPort(void);
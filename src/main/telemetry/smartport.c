@@ -5,6 +5,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
 
 #include "platform.h"
@@ -58,6 +59,7 @@
 
 #include "telemetry/telemetry.h"
 #include "telemetry/smartport.h"
+#include "telemetry/snapshot.h"
 
 enum
 {
@@ -183,11 +185,24 @@ static bool smartPortFrameReceived = false;
 #define SMARTPORT_MSP_SEQ_MASK   0x0F
 
 #define SMARTPORT_MSP_RX_BUF_SIZE 64
+#define SMARTPORT_MSP_REQUEST_QUEUE_SIZE 4 // requests the radio may send ahead while a reply is being sent
 
 static uint8_t smartPortMspTxBuffer[SMARTPORT_TX_BUF_SIZE];
 static mspPacket_t smartPortMspReply;
 static bool smartPortMspReplyPending = false;
 
+// complete requests, answered in order of arrival, the oldest stays queued until its reply is sent
+typedef struct smartPortMspRequest_s {
+    uint8_t cmd;
+    uint8_t size;
+    int8_t error;       // SMARTPORT_MSP_* error to reply with instead of running the command, -1 for none
+    uint8_t payload[SMARTPORT_MSP_RX_BUF_SIZE];
+} smartPortMspRequest_t;
+
+static smartPortMspRequest_t smartPortMspRequests[SMARTPORT_MSP_REQUEST_QUEUE_SIZE];
+static uint8_t smartPortMspRequestTail = 0;
+static uint8_t smartPortMspRequestCount = 0;
+
 #define SMARTPORT_MSP_RES_ERROR (-10)
 
 enum {
@@ -339,6 +354,12 @@ bool canSendSmartPortTelemetry(void)
     return smartPortSerialPort && (smartPortState == SPSTATE_INITIALIZED || smartPortState == SPSTATE_WORKING);
 }
 
+// the receiver polls the sensor, without received bytes there is nothing to answer
+bool smartPortTelemetryNeedsService(void)
+{
+    return smartPortTelemetryEnabled && canSendSmartPortTelemetry() && serialRxBytesWaiting(smartPortSerialPort) > 0;
+}
+
 void checkSmartPortTelemetryState(void)
 {
     bool newTelemetryEnabledValue = telemetryDetermineEnabledState(smartPortPortSharing);
@@ -374,6 +395,55 @@ static void processMspPacket(mspPacket_t* packet)
     smartPortMspReplyPending = true;
 }
 
+static void smartPortQueueMspRequest(uint8_t cmd, const uint8_t *payload, uint8_t size, int8_t error)
+{
+    // a request repeated before its reply was sent, e.g. resent by the radio after a timeout, is answered once
+    for (unsigned i = 0; i < smartPortMspRequestCount; i++) {
+        const smartPortMspRequest_t *queued = &smartPortMspRequests[(smartPortMspRequestTail + i) % SMARTPORT_MSP_REQUEST_QUEUE_SIZE];
+        if (queued->cmd == cmd && queued->error == error && queued->size == size && memcmp(queued->payload, payload, size) == 0) {
+            return;
+        }
+    }
+
+    if (smartPortMspRequestCount == SMARTPORT_MSP_REQUEST_QUEUE_SIZE) {
+        // the radio sent too far ahead, it resends after its timeout
+        return;
+    }
+
+    smartPortMspRequest_t *request = &smartPortMspRequests[(smartPortMspRequestTail + smartPortMspRequestCount) % SMARTPORT_MSP_REQUEST_QUEUE_SIZE];
+    request->cmd = cmd;
+    request->size = size;
+    request->error = error;
+    memcpy(request->payload, payload, size);
+    smartPortMspRequestCount++;
+}
+
+// starts the reply to the oldest queued request once the previous reply is sent
+static void smartPortProcessMspRequest(void)
+{
+    if (smartPortMspReplyPending || smartPortMspRequestCount == 0) {
+        return;
+    }
+
+    smartPortMspRequest_t *request = &smartPortMspRequests[smartPortMspRequestTail];
+
+    if (request->error >= 0) {
+        initSmartPortMspReply(request->cmd);
+        sbufWriteU8(&smartPortMspReply.buf, request->error);
+        smartPortMspReply.result = SMARTPORT_MSP_RES_ERROR;
+
+        sbufSwitchToReader(&smartPortMspReply.buf, smartPortMspTxBuffer);
+        smartPortMspReplyPending = true;
+    } else {
+        mspPacket_t packet = {
+            .buf = { .ptr = request->payload, .end = request->payload + request->size },
+            .cmd = request->cmd,
+            .result = 0,
+        };
+        processMspPacket(&packet);
+    }
+}
+
 /**
  * Request frame format:
  * - Header: 1 byte
@@ -395,7 +465,7 @@ static void processMspPacket(mspPacket_t* packet)
  *       - 2: MSP error
  *     - CRC (request type included)
  */
-bool smartPortSendMspReply()
+static bool smartPortSendMspReply(void)
 {
     static uint8_t checksum = 0;
     static uint8_t seq = 0;
@@ -449,14 +519,9 @@ bool smartPortSendMspReply()
     return false;
 }
 
-void smartPortSendErrorReply(uint8_t error, int16_t cmd)
+static void smartPortSendErrorReply(uint8_t error, int16_t cmd)
 {
-    initSmartPortMspReply(cmd);
-    sbufWriteU8(&smartPortMspReply.buf,error);
-    smartPortMspReply.result = SMARTPORT_MSP_RES_ERROR;
-
-    sbufSwitchToReader(&smartPortMspReply.buf, smartPortMspTxBuffer);
-    smartPortMspReplyPending = true;
+    smartPortQueueMspRequest(cmd, &error, 0, error);
 }
 
 /**
@@ -472,7 +537,7 @@ void smartPortSendErrorReply(uint8_t error, int16_t cmd)
  *   - payload...
  *   - CRC
  */
-void handleSmartPortMspFrame(smartPortFrame_t* sp_frame)
+static void handleSmartPortMspFrame(smartPortFrame_t* sp_frame)
 {
     static uint8_t mspBuffer[SMARTPORT_MSP_RX_BUF_SIZE];
     static uint8_t mspStarted = 0;
@@ -497,11 +562,16 @@ void handleSmartPortMspFrame(smartPortFrame_t* sp_frame)
     // check start-flag
     if (head & SMARTPORT_MSP_START_FLAG) {
 
-        //TODO: if (p_size > SMARTPORT_MSP_RX_BUF_SIZE) error!
         uint8_t p_size = *p++;
         cmd.cmd = *p++;
         cmd.result = 0;
 
+        if (p_size > SMARTPORT_MSP_RX_BUF_SIZE) {
+            mspStarted = 0;
+            smartPortSendErrorReply(SMARTPORT_MSP_ERROR, cmd.cmd);
+            return;
+        }
+
         cmd.buf.ptr = mspBuffer;
         cmd.buf.end = mspBuffer + p_size;
 
@@ -535,11 +605,9 @@ void handleSmartPortMspFrame(smartPortFrame_t* sp_frame)
         return;
     }
 
-    // end of MSP packet reached
+    // end of MSP packet reached, the reply is sent after those to earlier requests
     mspStarted = 0;
-    sbufSwitchToReader(&cmd.buf,mspBuffer);
-
-    processMspPacket(&cmd);
+    smartPortQueueMspRequest(cmd.cmd, mspBuffer, sbufPtr(&cmd.buf) - mspBuffer, -1);
 }
 
 void handleSmartPortTelemetry(void)
@@ -570,6 +638,8 @@ void handleSmartPortTelemetry(void)
         }
     }
 
+    smartPortProcessMspRequest();
+
     while (smartPortHasRequest) {
         // Ensure we won't get stuck in the loop if there happens to be nothing available to send in a timely manner - dump the slot if we loop in there for too long.
         if ((millis() - smartPortLastServiceTime) > SMARTPORT_SERVICE_TIMEOUT_MS) {
@@ -580,6 +650,12 @@ void handleSmartPortTelemetry(void)
         if (smartPortMspReplyPending) {
             smartPortMspReplyPending = smartPortSendMspReply();
             smartPortHasRequest = 0;
+            if (!smartPortMspReplyPending) {
+                smartPortMspRequestTail = (smartPortMspRequestTail + 1) % SMARTPORT_MSP_REQUEST_QUEUE_SIZE;
+                smartPortMspRequestCount--;
+                // have the next reply ready for the following slot
+                smartPortProcessMspRequest();
+            }
             return;
         }
 
@@ -599,22 +675,22 @@ void handleSmartPortTelemetry(void)
         switch (id) {
 #ifdef GPS
             case FSSP_DATAID_SPEED      :
-                if (sensors(SENSOR_GPS) && STATE(GPS_FIX)) {
+                if (sensors(SENSOR_GPS) && telemetrySnapshot.gps.fix) {
                     //convert to knots: 1cm/s = 0.0194384449 knots
                     //Speed should be sent in knots/1000 (GPS speed is in cm/s)
-                    uint32_t tmpui = gpsSol.groundSpeed * 1944 / 100;
+                    uint32_t tmpui = telemetrySnapshot.gps.sol.groundSpeed * 1944 / 100;
                     smartPortSendPackage(id, tmpui);
                     smartPortHasRequest = 0;
                 }
                 break;
 #endif
             case FSSP_DATAID_VFAS       :
-                if (batteryConfig()->voltageMeterSource != VOLTAGE_METER_NONE && getBatteryCellCount() > 0) {
+                if (batteryConfig()->voltageMeterSource != VOLTAGE_METER_NONE && telemetrySnapshot.battery.cellCount > 0) {
                     uint16_t vfasVoltage;
                     if (telemetryConfig()->report_cell_voltage) {
-                        vfasVoltage = getBatteryVoltage() / getBatteryCellCount();
+                        vfasVoltage = telemetrySnapshot.battery.voltage / telemetrySnapshot.battery.cellCount;
                     } else {
-                        vfasVoltage = getBatteryVoltage();
+                        vfasVoltage = telemetrySnapshot.battery.voltage;
                     }
                     smartPortSendPackage(id, vfasVoltage * 10); // given in 0.1V, convert to volts
                     smartPortHasRequest = 0;
@@ -622,20 +698,20 @@ void handleSmartPortTelemetry(void)
                 break;
             case FSSP_DATAID_CURRENT    :
                 if (batteryConfig()->currentMeterSource != CURRENT_METER_NONE) {
-                    smartPortSendPackage(id, getAmperage() / 10); // given in 10mA steps, unknown requested unit
+                    smartPortSendPackage(id, telemetrySnapshot.battery.amperage / 10); // given in 10mA steps, unknown requested unit
                     smartPortHasRequest = 0;
                 }
                 break;
             //case FSSP_DATAID_RPM        :
             case FSSP_DATAID_ALTITUDE   :
                 if (sensors(SENSOR_BARO)) {
-                    smartPortSendPackage(id, getEstimatedAltitude()); // unknown given unit, requested 100 = 1 meter
+                    smartPortSendPackage(id, telemetrySnapshot.altitude.estimatedCm); // unknown given unit, requested 100 = 1 meter
                     smartPortHasRequest = 0;
                 }
                 break;
             case FSSP_DATAID_FUEL       :
                 if (batteryConfig()->currentMeterSource != CURRENT_METER_NONE) {
-                    smartPortSendPackage(id, getMAhDrawn()); // given in mAh, unknown requested unit
+                    smartPortSendPackage(id, telemetrySnapshot.battery.mAhDrawn); // given in mAh, unknown requested unit
                     smartPortHasRequest = 0;
                 }
                 break;
@@ -643,20 +719,21 @@ void handleSmartPortTelemetry(void)
             //case FSSP_DATAID_ADC2       :
 #ifdef GPS
             case FSSP_DATAID_LATLONG    :
-                if (sensors(SENSOR_GPS) && STATE(GPS_FIX)) {
+                if (sensors(SENSOR_GPS) && telemetrySnapshot.gps.fix) {
+                    const gpsLocation_t *llh = &telemetrySnapshot.gps.sol.llh;
                     uint32_t tmpui = 0;
                     // the same ID is sent twice, one for longitude, one for latitude
                     // the MSB of the sent uint32_t helps FrSky keep track
                     // the even/odd bit of our counter helps us keep track
                     if (smartPortIdCnt & 1) {
-                        tmpui = abs(gpsSol.llh.lon);  // now we have unsigned value and one bit to spare
+                        tmpui = abs(llh->lon);  // now we have unsigned value and one bit to spare
                         tmpui = (tmpui + tmpui / 2) / 25 | 0x80000000;  // 6/100 = 1.5/25, division by power of 2 is fast
-                        if (gpsSol.llh.lon < 0) tmpui |= 0x40000000;
+                        if (llh->lon < 0) tmpui |= 0x40000000;
                     }
                     else {
-                        tmpui = abs(gpsSol.llh.lat);  // now we have unsigned value and one bit to spare
+                        tmpui = abs(llh->lat);  // now we have unsigned value and one bit to spare
                         tmpui = (tmpui + tmpui / 2) / 25;  // 6/100 = 1.5/25, division by power of 2 is fast
-                        if (gpsSol.llh.lat < 0) tmpui |= 0x40000000;
+                        if (llh->lat < 0) tmpui |= 0x40000000;
                     }
                     smartPortSendPackage(id, tmpui);
                     smartPortHasRequest = 0;
@@ -666,12 +743,12 @@ void handleSmartPortTelemetry(void)
             //case FSSP_DATAID_CAP_USED   :
             case FSSP_DATAID_VARIO      :
                 if (sensors(SENSOR_BARO)) {
-                    smartPortSendPackage(id, getEstimatedVario()); // unknown given unit but requested in 100 = 1m/s
+                    smartPortSendPackage(id, telemetrySnapshot.altitude.varioCms); // unknown given unit but requested in 100 = 1m/s
                     smartPortHasRequest = 0;
                 }
                 break;
             case FSSP_DATAID_HEADING    :
-                smartPortSendPackage(id, attitude.values.yaw * 10); // given in 10*deg, requested in 10000 = 100 deg
+                smartPortSendPackage(id, telemetrySnapshot.attitude.values.yaw * 10); // given in 10*deg, requested in 10000 = 100 deg
                 smartPortHasRequest = 0;
                 break;
             case FSSP_DATAID_ACCX       :
@@ -736,7 +813,7 @@ void handleSmartPortTelemetry(void)
                 if (sensors(SENSOR_GPS)) {
 #ifdef GPS
                     // provide GPS lock status
-                    smartPortSendPackage(id, (STATE(GPS_FIX) ? 1000 : 0) + (STATE(GPS_FIX_HOME) ? 2000 : 0) + gpsSol.numSat);
+                    smartPortSendPackage(id, (telemetrySnapshot.gps.fix ? 1000 : 0) + (telemetrySnapshot.gps.fixHome ? 2000 : 0) + telemetrySnapshot.gps.sol.numSat);
                     smartPortHasRequest = 0;
 #endif
                 } else if (feature(FEATURE_GPS)) {
@@ -776,15 +853,15 @@ void handleSmartPortTelemetry(void)
                 break;
 #ifdef GPS
             case FSSP_DATAID_GPS_ALT    :
-                if (sensors(SENSOR_GPS) && STATE(GPS_FIX)) {
-                    smartPortSendPackage(id, gpsSol.llh.alt * 100); // given in 0.1m , requested in 10 = 1m (should be in mm, probably a bug in opentx, tested on 2.0.1.7)
+                if (sensors(SENSOR_GPS) && telemetrySnapshot.gps.fix) {
+                    smartPortSendPackage(id, telemetrySnapshot.gps.sol.llh.alt * 100); // given in 0.1m , requested in 10 = 1m (should be in mm, probably a bug in opentx, tested on 2.0.1.7)
                     smartPortHasRequest = 0;
                 }
                 break;
 #endif
             case FSSP_DATAID_A4         :
-                if (batteryConfig()->voltageMeterSource != VOLTAGE_METER_NONE && getBatteryCellCount() > 0) {
-                    smartPortSendPackage(id, getBatteryVoltage() * 10 / getBatteryCellCount()); // given in 0.1V, convert to volts
+                if (batteryConfig()->voltageMeterSource != VOLTAGE_METER_NONE && telemetrySnapshot.battery.cellCount > 0) {
+                    smartPortSendPackage(id, telemetrySnapshot.battery.cellVoltage); // given in 0.1V, convert to volts
                     smartPortHasRequest = 0;
                 }
                 break;
@@ -10,6 +10,7 @@
 void initSmartPortTelemetry(void);
 
 void handleSmartPortTelemetry(void);
+bool smartPortTelemetryNeedsService(void);
 void checkSmartPortTelemetryState(void);
 
 void configureSmartPortTelemetryPort(void);
@@ -0,0 +1,124 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+
+#ifdef TELEMETRY
+
+#include "common/utils.h"
+
+#include "config/parameter_group.h"
+
+#include "fc/runtime_config.h"
+
+#include "flight/altitude.h"
+#include "flight/imu.h"
+#include "flight/pid.h"
+#include "flight/navigation.h"
+
+#include "io/gps.h"
+
+#include "sensors/battery.h"
+#include "sensors/sensors.h"
+
+#include "telemetry/snapshot.h"
+
+telemetrySnapshot_t telemetrySnapshot;
+
+// version of the last update that changed each field, indexed by telemetrySnapshotField_e bit
+static uint32_t fieldVersion[4];
+
+static uint8_t updateField(void *current, const void *next, size_t size, uint8_t field)
+{
+    // the first update sets every field, even those still at zero
+    if (telemetrySnapshot.version > 0 && memcmp(current, next, size) == 0) {
+        return 0;
+    }
+    memcpy(current, next, size);
+    return field;
+}
+
+void telemetrySnapshotUpdate(void)
+{
+    telemetrySnapshot_t next;
+    memset(&next, 0, sizeof(next)); // padding takes part in the comparison
+
+    next.battery.voltage = getBatteryVoltage();
+    next.battery.cellCount = getBatteryCellCount();
+    if (next.battery.cellCount > 0) {
+        next.battery.cellVoltage = next.battery.voltage * 10 / next.battery.cellCount;
+    }
+    next.battery.amperage = getAmperage();
+    next.battery.mAhDrawn = getMAhDrawn();
+    next.battery.remainingPercent = calculateBatteryPercentageRemaining();
+    next.battery.state = getBatteryState();
+    next.battery.capacity = batteryConfig()->batteryCapacity;
+
+    next.attitude = attitude;
+
+    next.altitude.estimatedCm = getEstimatedAltitude();
+    next.altitude.varioCms = getEstimatedVario();
+    next.altitude.bestCm = next.altitude.estimatedCm;
+
+#ifdef GPS
+    next.gps.sol = gpsSol;
+    next.gps.fix = STATE(GPS_FIX);
+    next.gps.fixHome = STATE(GPS_FIX_HOME);
+    next.gps.distanceToHome = GPS_distanceToHome;
+    next.gps.directionToHome = GPS_directionToHome;
+
+#if defined(BARO) || defined(SONAR)
+    if (!sensors(SENSOR_SONAR) && !sensors(SENSOR_BARO))
+#endif
+    {
+        next.altitude.bestCm = gpsSol.llh.alt * 100;
+    }
+#endif
+
+    uint8_t changes = 0;
+    changes |= updateField(&telemetrySnapshot.battery, &next.battery, sizeof(next.battery), TELEMETRY_SNAPSHOT_BATTERY);
+    changes |= updateField(&telemetrySnapshot.attitude, &next.attitude, sizeof(next.attitude), TELEMETRY_SNAPSHOT_ATTITUDE);
+    changes |= updateField(&telemetrySnapshot.altitude, &next.altitude, sizeof(next.altitude), TELEMETRY_SNAPSHOT_ALTITUDE);
+    changes |= updateField(&telemetrySnapshot.gps, &next.gps, sizeof(next.gps), TELEMETRY_SNAPSHOT_GPS);
+
+    if (changes) {
+        telemetrySnapshot.version++;
+        for (unsigned i = 0; i < ARRAYLEN(fieldVersion); i++) {
+            if (changes & (1 << i)) {
+                fieldVersion[i] = telemetrySnapshot.version;
+            }
+        }
+    }
+}
+
+uint8_t telemetrySnapshotChanges(uint32_t *seenVersion)
+{
+    uint8_t changes = 0;
+    for (unsigned i = 0; i < ARRAYLEN(fieldVersion); i++) {
+        if (fieldVersion[i] > *seenVersion) {
+            changes |= 1 << i;
+        }
+    }
+    *seenVersion = telemetrySnapshot.version;
+    return changes;
+}
+
+#endif
@@ -0,0 +1,79 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "flight/imu.h"
+
+#include "io/gps.h"
+
+#include "sensors/battery.h"
+
+// Sensor values shared by all telemetry backends, sampled once per period by telemetryProcess()
+// so a value is read and converted once however many protocols send it.
+
+#define TELEMETRY_SNAPSHOT_PERIOD_US 20000 // 50Hz, the fastest any backend sends
+
+typedef enum {
+    TELEMETRY_SNAPSHOT_BATTERY  = (1 << 0),
+    TELEMETRY_SNAPSHOT_ATTITUDE = (1 << 1),
+    TELEMETRY_SNAPSHOT_ALTITUDE = (1 << 2),
+    TELEMETRY_SNAPSHOT_GPS      = (1 << 3),
+} telemetrySnapshotField_e;
+
+#define TELEMETRY_SNAPSHOT_ALL (TELEMETRY_SNAPSHOT_BATTERY | TELEMETRY_SNAPSHOT_ATTITUDE | TELEMETRY_SNAPSHOT_ALTITUDE | TELEMETRY_SNAPSHOT_GPS)
+
+typedef struct telemetrySnapshot_s {
+    uint32_t version;               // incremented by every update that changed a field
+
+    struct {
+        uint16_t voltage;           // 0.1V
+        uint16_t cellVoltage;       // average cell voltage in 0.01V, 0 without a cell count
+        int32_t amperage;           // 0.01A
+        int32_t mAhDrawn;
+        uint8_t cellCount;
+        uint8_t remainingPercent;
+        batteryState_e state;
+        uint32_t capacity;          // mAh, from the battery config
+    } battery;
+
+    attitudeEulerAngles_t attitude; // decidegrees
+
+    struct {
+        int32_t estimatedCm;        // baro/sonar estimate
+        int32_t varioCms;
+        int32_t bestCm;             // the estimate when there is a baro or sonar, GPS altitude otherwise
+    } altitude;
+
+    struct {
+        gpsSolutionData_t sol;
+        bool fix;
+        bool fixHome;
+        uint16_t distanceToHome;    // m
+        int16_t directionToHome;    // degrees
+    } gps;
+} telemetrySnapshot_t;
+
+extern telemetrySnapshot_t telemetrySnapshot;
+
+void telemetrySnapshotUpdate(void);
+// returns the telemetrySnapshotField_e bits changed since *seenVersion and moves *seenVersion to the current version,
+// every backend keeps its own seenVersion
+uint8_t telemetrySnapshotChanges(uint32_t *seenVersion);
@@ -46,11 +46,10 @@
 
 #include "telemetry/telemetry.h"
 #include "telemetry/srxl.h"
+#include "telemetry/snapshot.h"
 
 #include "fc/config.h"
 
-#define SRXL_CYCLETIME_US           100000 // 100ms, 10 Hz
-
 #define SRXL_ADDRESS_FIRST          0xA5
 #define SRXL_ADDRESS_SECOND         0x80
 #define SRXL_PACKET_LENGTH          0x15
@@ -169,7 +168,7 @@ void srxlFrameRpm(sbuf_t *dst)
     srxlSerialize8(dst, SRXL_FRAMETYPE_TELE_RPM);
     srxlSerialize8(dst, SRXL_FRAMETYPE_SID);
     srxlSerialize16(dst, 0xFFFF); // pulse leading edges
-    srxlSerialize16(dst, getBatteryVoltage() * 10);   // vbat is in units of 0.1V
+    srxlSerialize16(dst, telemetrySnapshot.battery.voltage * 10);   // vbat is in units of 0.1V
     srxlSerialize16(dst, 0x7FFF); // temperature
     srxlSerialize8(dst, 0xFF);    // dbmA
     srxlSerialize8(dst, 0xFF);    // dbmB
@@ -199,8 +198,8 @@ void srxlFrameFlightPackCurrent(sbuf_t *dst)
 {
     srxlSerialize8(dst, SRXL_FRAMETYPE_TELE_FP_MAH);
     srxlSerialize8(dst, SRXL_FRAMETYPE_SID);
-    srxlSerialize16le(dst, getAmperage() / 10);
-    srxlSerialize16le(dst, getMAhDrawn());
+    srxlSerialize16le(dst, telemetrySnapshot.battery.amperage / 10);
+    srxlSerialize16le(dst, telemetrySnapshot.battery.mAhDrawn);
     srxlSerialize16le(dst, 0x7fff);            // temp A
     srxlSerialize16le(dst, 0xffff);
     srxlSerialize16le(dst, 0xffff);
@@ -248,20 +247,16 @@ bool checkSrxlTelemetryState(void)
 }
 
 /*
- * Called periodically by the scheduler
+ * Called by telemetryProcess() every SRXL_CYCLETIME_US
  */
 void handleSrxlTelemetry(timeUs_t currentTimeUs)
 {
-    static uint32_t srxlLastCycleTime;
+    UNUSED(currentTimeUs);
 
     if (!srxlTelemetryEnabled) {
         return;
     }
 
-    // Actual telemetry data only needs to be sent at a low frequency, ie 10Hz
-    if (currentTimeUs >= srxlLastCycleTime + SRXL_CYCLETIME_US) {
-        srxlLastCycleTime = currentTimeUs;
-        processSrxl();
-    }
+    processSrxl();
 }
 #endif
@@ -19,6 +19,8 @@
 
 #include "common/time.h"
 
+#define SRXL_CYCLETIME_US 100000 // 100ms, 10 Hz, handleSrxlTelemetry() sends one frame per call
+
 void initSrxlTelemetry(void);
 bool checkSrxlTelemetryState(void);
 void handleSrxlTelemetry(timeUs_t currentTimeUs);
@@ -23,11 +23,13 @@
 
 #ifdef TELEMETRY
 
+#include "common/time.h"
 #include "common/utils.h"
 
 #include "config/parameter_group.h"
 #include "config/parameter_group_ids.h"
 
+#include "drivers/time.h"
 #include "drivers/timer.h"
 #include "drivers/serial.h"
 #include "drivers/serial_softserial.h"
@@ -52,9 +54,10 @@
 #include "telemetry/crsf.h"
 #include "telemetry/srxl.h"
 #include "telemetry/ibus.h"
+#include "telemetry/snapshot.h"
 
 
-PG_REGISTER_WITH_RESET_TEMPLATE(telemetryConfig_t, telemetryConfig, PG_TELEMETRY_CONFIG, 0);
+PG_REGISTER_WITH_RESET_TEMPLATE(telemetryConfig_t, telemetryConfig, PG_TELEMETRY_CONFIG, 1);
 
 PG_RESET_TEMPLATE(telemetryConfig_t, telemetryConfig,
     .telemetry_inverted = false,
@@ -68,7 +71,12 @@ PG_RESET_TEMPLATE(telemetryConfig_t, telemetryConfig,
     .frsky_vfas_cell_voltage = 0,
     .hottAlarmSoundInterval = 5,
     .pidValuesAsTelemetry = 0,
-    .report_cell_voltage = false
+    .report_cell_voltage = false,
+    .mavlink_extended_status_rate = 2,
+    .mavlink_rc_channels_rate = 5,
+    .mavlink_position_rate = 2,
+    .mavlink_extra1_rate = 10,
+    .mavlink_extra2_rate = 10,
 );
 
 void telemetryInit(void)
@@ -167,37 +175,111 @@ void telemetryCheckState(void)
 #endif
 }
 
-void telemetryProcess(uint32_t currentTime)
-{
+/*
+ * Each run of TASK_TELEMETRY services the providers that are due, round robin, until the run has used up
+ * TELEMETRY_TASK_BUDGET_US. The first provider of a run is always serviced, a provider that did not fit goes
+ * first on the next run.
+ */
+#define TELEMETRY_TASK_BUDGET_US 150
+
+typedef void telemetryHandleFn(timeUs_t currentTimeUs);
+typedef bool telemetryNeedsServiceFn(void);
+
+typedef struct telemetryProvider_s {
+    telemetryHandleFn *handle;
+    telemetryNeedsServiceFn *needsService;  // cheap check for pending work, NULL when the handler decides itself
+    timeDelta_t periodUs;                   // time between two services, 0 to service on every task run
+    timeDelta_t budgetUs;                   // execution time reserved for one service
+} telemetryProvider_t;
+
+// for the handlers that don't take the time
+#define TELEMETRY_HANDLER(name, handler) static void name(timeUs_t currentTimeUs) { UNUSED(currentTimeUs); handler(); }
+
+#ifdef TELEMETRY_FRSKY
+TELEMETRY_HANDLER(frSkyTelemetryProcess, handleFrSkyTelemetry)
+#endif
+#ifdef TELEMETRY_SMARTPORT
+TELEMETRY_HANDLER(smartPortTelemetryProcess, handleSmartPortTelemetry)
+#endif
+#ifdef TELEMETRY_LTM
+TELEMETRY_HANDLER(ltmTelemetryProcess, handleLtmTelemetry)
+#endif
+#ifdef TELEMETRY_JETIEXBUS
+TELEMETRY_HANDLER(jetiExBusTelemetryProcess, handleJetiExBusTelemetry)
+#endif
+#ifdef TELEMETRY_IBUS
+TELEMETRY_HANDLER(ibusTelemetryProcess, handleIbusTelemetry)
+#endif
+
+static const telemetryProvider_t telemetryProviders[] = {
 #ifdef TELEMETRY_FRSKY
-    handleFrSkyTelemetry();
+    { .handle = frSkyTelemetryProcess, .budgetUs = 100 },
 #endif
 #ifdef TELEMETRY_HOTT
-    handleHoTTTelemetry(currentTime);
-#else
-    UNUSED(currentTime);
+    { .handle = handleHoTTTelemetry, .budgetUs = 50 },
 #endif
 #ifdef TELEMETRY_SMARTPORT
-    handleSmartPortTelemetry();
+    { .handle = smartPortTelemetryProcess, .needsService = smartPortTelemetryNeedsService, .budgetUs = 100 },
 #endif
 #ifdef TELEMETRY_LTM
-    handleLtmTelemetry();
+    { .handle = ltmTelemetryProcess, .periodUs = LTM_CYCLETIME_US, .budgetUs = 50 },
 #endif
 #ifdef TELEMETRY_JETIEXBUS
-    handleJetiExBusTelemetry();
+    { .handle = jetiExBusTelemetryProcess, .budgetUs = 50 },
 #endif
 #ifdef TELEMETRY_MAVLINK
-    handleMAVLinkTelemetry();
+    { .handle = handleMAVLinkTelemetry, .needsService = mavlinkTelemetryNeedsService, .budgetUs = 100 },
 #endif
 #ifdef TELEMETRY_CRSF
-    handleCrsfTelemetry(currentTime);
+    { .handle = handleCrsfTelemetry, .budgetUs = 50 },
 #endif
 #ifdef TELEMETRY_SRXL
-    handleSrxlTelemetry(currentTime);
+    { .handle = handleSrxlTelemetry, .periodUs = SRXL_CYCLETIME_US, .budgetUs = 50 },
 #endif
 #ifdef TELEMETRY_IBUS
-    handleIbusTelemetry();
+    { .handle = ibusTelemetryProcess, .needsService = ibusTelemetryNeedsService, .budgetUs = 50 },
 #endif
+    { .handle = NULL } // keeps the table valid without any telemetry protocol
+};
+
+static const unsigned telemetryProviderCount = ARRAYLEN(telemetryProviders) - 1;
+
+static timeUs_t telemetryLastServiceUs[ARRAYLEN(telemetryProviders)];
+static uint8_t telemetryNextProvider = 0;
+
+void telemetryProcess(timeUs_t currentTimeUs)
+{
+    static timeUs_t snapshotTimeUs;
+    bool serviced = false;
+
+    // one sample of the sensors shared by all providers
+    if (telemetrySnapshot.version == 0 || cmpTimeUs(currentTimeUs, snapshotTimeUs) >= TELEMETRY_SNAPSHOT_PERIOD_US) {
+        telemetrySnapshotUpdate();
+        snapshotTimeUs = currentTimeUs;
+    }
+
+    for (unsigned i = 0; i < telemetryProviderCount; i++) {
+        unsigned index = telemetryNextProvider + i;
+        if (index >= telemetryProviderCount) {
+            index -= telemetryProviderCount;
+        }
+        const telemetryProvider_t *provider = &telemetryProviders[index];
+
+        if (provider->periodUs && cmpTimeUs(currentTimeUs, telemetryLastServiceUs[index]) < provider->periodUs) {
+            continue;
+        }
+        if (provider->needsService && !provider->needsService()) {
+            continue;
+        }
+        if (serviced && cmpTimeUs(micros(), currentTimeUs) + provider->budgetUs > TELEMETRY_TASK_BUDGET_US) {
+            telemetryNextProvider = index;
+            return;
+        }
+
+        provider->handle(currentTimeUs);
+        telemetryLastServiceUs[index] = currentTimeUs;
+        serviced = true;
+    }
 }
 
 #define TELEMETRY_FUNCTION_MASK (FUNCTION_TELEMETRY_FRSKY | FUNCTION_TELEMETRY_HOTT | FUNCTION_TELEMETRY_LTM | FUNCTION_TELEMETRY_SMARTPORT)
@@ -53,12 +53,18 @@ extern "C" {
 
     void cliSet(char *cmdline);
     void cliGet(char *cmdline);
+    const clivalue_t *cliFindValue(const char *name, uint8_t length);
     void *getValuePointer(const clivalue_t *value);
 
     const clivalue_t valueTable[] = {
-        { "array_unit_test",             VAR_INT8  | MODE_ARRAY | MASTER_VALUE, .config.array.length = 3, PG_RESERVED_FOR_TESTING_1, 0 }
+        { "array_unit_test",             VAR_INT8  | MODE_ARRAY | MASTER_VALUE, .config.array.length = 3, PG_RESERVED_FOR_TESTING_1, 0 },
+        { "unit_test_lpf_hz",            VAR_INT8  | MASTER_VALUE, .config.minmax = { 0, 100 }, PG_RESERVED_FOR_TESTING_1, 0 },
+        { "unit_test_lpf",               VAR_INT8  | MASTER_VALUE, .config.minmax = { 0, 100 }, PG_RESERVED_FOR_TESTING_1, 0 },
+        { "b_unit_test",                 VAR_INT8  | MASTER_VALUE, .config.minmax = { 0, 100 }, PG_RESERVED_FOR_TESTING_1, 0 },
+        { "unit_test",                   VAR_INT8  | MASTER_VALUE, .config.minmax = { 0, 100 }, PG_RESERVED_FOR_TESTING_1, 0 },
     };
     const uint16_t valueTableEntryCount = ARRAYLEN(valueTable);
+    uint16_t valueTableNameIndex[ARRAYLEN(valueTable)];
     const lookupTableEntry_t lookupTables[] = {};
   
 
@@ -84,10 +90,38 @@ extern "C" {
     PG_REGISTER_WITH_RESET_FN(int8_t, unitTestData, PG_RESERVED_FOR_TESTING_1, 0); 
 }
 
+#include <string>
+
 #include "unittest_macros.h"
 #include "gtest/gtest.h"
+
+static std::string cliOutput;
+static const char *cliInput = "";
+static uint32_t txBytesFree = UINT8_MAX;
+static int txOverruns;
+static serialPort_t testPort;
+
+static bool cliOutputEndsWithPrompt(void)
+{
+    return cliOutput.size() >= 4 && cliOutput.compare(cliOutput.size() - 4, 4, "\r\n# ") == 0;
+}
+
+// runs the cli with room for 100 bytes each time, as the port transmits them, until the prompt follows a dump
+static int cliProcessDumpAtTxRate(void)
+{
+    int passes = 0;
+    do {
+        txBytesFree = 100;
+        cliProcess();
+    } while (!cliOutputEndsWithPrompt() && ++passes < 100);
+    return passes;
+}
+
 TEST(CLIUnittest, TestCliSet)
 {
+    // cliSet() confirms the value on the cli port
+    testPort.txBufferSize = 256;
+    cliEnter(&testPort);
 
     cliSet((char *)"array_unit_test    =   123,  -3  , 1");
 
@@ -115,6 +149,91 @@ TEST(CLIUnittest, TestCliSet)
     //EXPECT_EQ(false, false);
 }
 
+TEST(CLIUnittest, TestCliFindValue)
+{
+    for (unsigned i = 0; i < ARRAYLEN(valueTable); i++) {
+        const char *name = valueTable[i].name;
+        EXPECT_EQ(&valueTable[i], cliFindValue(name, strlen(name)));
+    }
+
+    // only the given length of the name is matched
+    EXPECT_EQ(&valueTable[2], cliFindValue("unit_test_lpf = 3", strlen("unit_test_lpf")));
+    EXPECT_EQ(&valueTable[4], cliFindValue("UNIT_TEST", strlen("unit_test")));
+
+    EXPECT_EQ(NULL, cliFindValue("unit_test_lp", strlen("unit_test_lp")));
+    EXPECT_EQ(NULL, cliFindValue("unit_test_lpf_hz_", strlen("unit_test_lpf_hz_")));
+    EXPECT_EQ(NULL, cliFindValue("a", 1));
+    EXPECT_EQ(NULL, cliFindValue("z", 1));
+}
+
+TEST(CLIUnittest, TestCliSetDirect)
+{
+    testPort.txBufferSize = 256;
+    cliEnter(&testPort);
+    int8_t *data = (int8_t *)getValuePointer(&valueTable[2]);
+
+    cliSet((char *)"unit_test_lpf = 42");
+    EXPECT_EQ(42, *data);
+
+    // out of range
+    cliSet((char *)"unit_test_lpf = 101");
+    EXPECT_EQ(42, *data);
+
+    cliSet((char *)"unit_test_lpf_hz=7");
+    EXPECT_EQ(7, *data);
+}
+
+TEST(CLIUnittest, TestCliDiffWaitsForTxSpace)
+{
+    serialPort_t port;
+    memset(&port, 0, sizeof(port));
+    port.txBufferSize = 256;
+    cliEnter(&port);
+
+    int8_t *data = (int8_t *)getValuePointer(&valueTable[2]);
+    *data = 42;
+
+    // nothing is output while the transmit buffer is full
+    txBytesFree = 0;
+    cliOutput.clear();
+    cliInput = "diff all\r";
+    cliProcess();
+    EXPECT_EQ("diff all\r\n", cliOutput);
+
+    // the rest of the input waits for the diff
+    cliInput = "get unit_test_lpf\r";
+    cliProcess();
+    EXPECT_EQ("diff all\r\n", cliOutput);
+
+    // the diff never writes more than the transmit buffer has room for
+    txOverruns = 0;
+    EXPECT_GT(cliProcessDumpAtTxRate(), 1);
+    EXPECT_EQ(0, txOverruns);
+    EXPECT_NE(std::string::npos, cliOutput.find("# master\r\n"));
+    EXPECT_NE(std::string::npos, cliOutput.find("set unit_test_lpf = 42\r\n"));
+    // the version step doesn't fit in one pass, none of its output is repeated or lost between passes
+    EXPECT_NE(std::string::npos, cliOutput.find("# version\r\n# Betaflight / UNITTEST"));
+    EXPECT_NE(std::string::npos, cliOutput.find("# reset configuration to default settings\r\ndefaults\r\n"));
+    EXPECT_EQ(cliOutput.find("# version"), cliOutput.rfind("# version"));
+    EXPECT_EQ(cliOutput.find("# master"), cliOutput.rfind("# master"));
+
+    // the active config is unchanged
+    EXPECT_EQ(42, *data);
+
+    cliOutput.clear();
+    txBytesFree = 100;
+    cliProcess();
+    EXPECT_NE(std::string::npos, cliOutput.find("unit_test_lpf = 42"));
+
+    // values equal to the defaults are not part of the diff
+    *data = 0;
+    cliOutput.clear();
+    cliInput = "diff\r";
+    cliProcessDumpAtTxRate();
+    EXPECT_NE(std::string::npos, cliOutput.find("# master\r\n"));
+    EXPECT_EQ(std::string::npos, cliOutput.find("set unit_test_lpf"));
+}
+
 // STUBS
 extern "C" {
 
@@ -126,6 +245,9 @@ const uint32_t baudRates[] = {0, 9600, 19200, 38400, 57600, 115200, 230400, 2500
 
 uint32_t micros(void) {return 0;}
 
+uint16_t getValueOffset(const clivalue_t *value) { return value->offset; }
+void *getValuePointer(const clivalue_t *value) { return CONST_CAST(void *, pgFind(value->pgn)->address + value->offset); }
+
 int32_t getAmperage(void) {
     return 100;
 }
@@ -158,8 +280,12 @@ void tfp_printf(const char * expectedFormat, ...) {
 }
 
 
-void tfp_format(void *, void (*) (void *, char), const char * expectedFormat, va_list va) {
-    vprintf(expectedFormat, va);
+void tfp_format(void *arg, void (*putp) (void *, char), const char * expectedFormat, va_list va) {
+    char buffer[256];
+    vsnprintf(buffer, sizeof(buffer), expectedFormat, va);
+    for (const char *c = buffer; *c; c++) {
+        putp(arg, *c);
+    }
 }
 
 static const box_t boxes[] = { { 0, "DUMMYBOX", 0 } };
@@ -195,7 +321,6 @@ void beeperOffClear(uint32_t) {}
 void beeperOffClearAll(void) {}
 bool parseColor(int, const char *) {return false; }
 void resetEEPROM(void) {}
-void bufWriterFlush(bufWriter_t *) {}
 void mixerResetDisarmedMotors(void) {}
 void gpsEnablePassthrough(struct serialPort_s *) {}
 bool parseLedStripConfig(int, const char *){return false; }
@@ -245,12 +370,19 @@ const char* const buildDate = "Jan 01 2017";
 const char * const buildTime = "00:00:00";
 const char * const shortGitRevision = "MASTER";
 
-uint32_t serialRxBytesWaiting(const serialPort_t *) {return 0;}
-uint8_t serialRead(serialPort_t *){return 0;}
+uint32_t serialRxBytesWaiting(const serialPort_t *) {return strlen(cliInput);}
+uint8_t serialRead(serialPort_t *){return *cliInput++;}
+uint32_t serialTxBytesFree(const serialPort_t *) {return txBytesFree;}
 
-void bufWriterAppend(bufWriter_t *, uint8_t ch){ printf("%c", ch); }
-void serialWriteBufShim(void *, const uint8_t *, int) {}
-bufWriter_t *bufWriterInit(uint8_t *, int, bufWrite_t, void *) {return NULL;}
+void serialWriteBuf(serialPort_t *, const uint8_t *data, int count)
+{
+    if ((uint32_t)count > txBytesFree) {
+        txOverruns++;
+    }
+    txBytesFree = (uint32_t)count < txBytesFree ? txBytesFree - count : 0;
+    printf("%.*s", count, data);
+    cliOutput.append((const char *)data, count);
+}
 void schedulerSetCalulateTaskStatistics(bool) {}
 void setArmingDisabled(armingDisableFlags_e) {}
 
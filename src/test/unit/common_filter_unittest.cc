@@ -145,3 +145,38 @@ TEST(FilterUnittest, TestFirFilterApply)
     expected = 7.0f * 26.0f + 6.0 * 27.0 + 5.0 * 28.0 + 4.0f * 29.0f;
     EXPECT_FLOAT_EQ(expected, firFilterApply(&filter));
 }
+
+TEST(FilterUnittest, TestBiquadFilterUpdateNotch)
+{
+    const uint32_t looptime = 125;
+    const float Q = 5.0f;
+    biquadFilter_t reference;
+    biquadFilter_t filter;
+
+    biquadFilterInit(&filter, 100, looptime, Q, FILTER_NOTCH);
+    filter.x1 = 1.0f;
+    filter.y1 = 2.0f;
+
+    // sine and cosine of harmonics are derived from the fundamental by angle addition
+    const float omega = 2.0f * M_PI * 237.0f * looptime * 1e-6f;
+    float sinHarmonic = sinf(omega);
+    float cosHarmonic = cosf(omega);
+    for (int harmonic = 1; harmonic <= 3; harmonic++) {
+        biquadFilterUpdateNotch(&filter, sinHarmonic, cosHarmonic, Q);
+        biquadFilterInit(&reference, 237.0f * harmonic, looptime, Q, FILTER_NOTCH);
+
+        EXPECT_NEAR(reference.b0, filter.b0, 1e-5f);
+        EXPECT_NEAR(reference.b1, filter.b1, 1e-5f);
+        EXPECT_NEAR(reference.b2, filter.b2, 1e-5f);
+        EXPECT_NEAR(reference.a1, filter.a1, 1e-5f);
+        EXPECT_NEAR(reference.a2, filter.a2, 1e-5f);
+
+        const float sinNext = sinHarmonic * cosf(omega) + cosHarmonic * sinf(omega);
+        cosHarmonic = cosHarmonic * cosf(omega) - sinHarmonic * sinf(omega);
+        sinHarmonic = sinNext;
+    }
+
+    // filter state is kept
+    EXPECT_FLOAT_EQ(1.0f, filter.x1);
+    EXPECT_FLOAT_EQ(2.0f, filter.y1);
+}
@@ -0,0 +1,288 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/utils.h"
+
+    #include "config/config_eeprom.h"
+    #include "config/parameter_group.h"
+    #include "config/parameter_group_ids.h"
+
+    #include "drivers/system.h"
+
+    typedef struct testConfig1_s {
+        uint32_t value;
+        uint8_t bytes[5];
+    } testConfig1_t;
+
+    typedef struct testConfig2_s {
+        uint16_t values[64];
+    } testConfig2_t;
+
+    typedef struct testConfig3_s {
+        uint8_t value;
+    } testConfig3_t;
+
+    PG_DECLARE(testConfig1_t, testConfig1);
+    PG_DECLARE(testConfig2_t, testConfig2);
+    PG_DECLARE(testConfig3_t, testConfig3);
+
+    PG_REGISTER(testConfig1_t, testConfig1, PG_RESERVED_FOR_TESTING_1, 0);
+    PG_REGISTER(testConfig2_t, testConfig2, PG_RESERVED_FOR_TESTING_2, 0);
+    PG_REGISTER(testConfig3_t, testConfig3, PG_RESERVED_FOR_TESTING_3, 0);
+
+    #define FLASH_PAGE_SIZE 0x400   // as config_streamer.c uses for unit tests
+
+    uint8_t eepromData[EEPROM_SIZE] __attribute__((aligned(FLASH_PAGE_SIZE)));
+
+    extern bool eepromContentValidated;
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+// flash operations done, once the limit is reached the power is lost and no more operations complete
+static int flashOperations;
+static int flashOperationLimit = -1;
+
+static void setValues(uint8_t seed)
+{
+    testConfig1Mutable()->value = 0x01020304 * seed;
+    for (unsigned i = 0; i < ARRAYLEN(testConfig1()->bytes); i++) {
+        testConfig1Mutable()->bytes[i] = seed + i;
+    }
+    for (unsigned i = 0; i < ARRAYLEN(testConfig2()->values); i++) {
+        testConfig2Mutable()->values[i] = seed * 1000 + i;
+    }
+    testConfig3Mutable()->value = seed;
+}
+
+static bool hasValues(uint8_t seed)
+{
+    testConfig1_t config1;
+    testConfig2_t config2;
+    testConfig3_t config3;
+    memcpy(&config1, testConfig1(), sizeof(config1));
+    memcpy(&config2, testConfig2(), sizeof(config2));
+    memcpy(&config3, testConfig3(), sizeof(config3));
+
+    setValues(seed);
+    const bool equal = memcmp(&config1, testConfig1(), sizeof(config1)) == 0
+        && memcmp(&config2, testConfig2(), sizeof(config2)) == 0
+        && memcmp(&config3, testConfig3(), sizeof(config3)) == 0;
+
+    memcpy(testConfig1Mutable(), &config1, sizeof(config1));
+    memcpy(testConfig2Mutable(), &config2, sizeof(config2));
+    memcpy(testConfig3Mutable(), &config3, sizeof(config3));
+    return equal;
+}
+
+static void eraseFlash(void)
+{
+    memset(eepromData, 0xff, sizeof(eepromData));
+    eepromContentValidated = false;
+}
+
+// power cycle, the config in RAM is lost and reloaded
+static bool reboot(void)
+{
+    flashOperationLimit = -1;
+    eepromContentValidated = false;
+    setValues(0);
+    return loadEEPROM();
+}
+
+static int saveOperations(void)
+{
+    flashOperations = 0;
+    writeConfigToEEPROM();
+    return flashOperations;
+}
+
+TEST(ConfigEepromUnittest, TestSaveAndLoad)
+{
+    eraseFlash();
+    EXPECT_FALSE(isEEPROMContentValid());
+
+    setValues(1);
+    writeConfigToEEPROM();
+    EXPECT_TRUE(isEEPROMContentValid());
+
+    EXPECT_TRUE(reboot());
+    EXPECT_TRUE(hasValues(1));
+}
+
+TEST(ConfigEepromUnittest, TestSaveWithoutChangesDoesNotWrite)
+{
+    eraseFlash();
+    setValues(1);
+    EXPECT_LT(0, saveOperations());
+
+    const uint16_t configSize = getEEPROMConfigSize();
+    EXPECT_EQ(0, saveOperations());
+    EXPECT_EQ(configSize, getEEPROMConfigSize());
+}
+
+TEST(ConfigEepromUnittest, TestOnlyChangedPgsAreAppended)
+{
+    eraseFlash();
+    setValues(1);
+    writeConfigToEEPROM();
+    const uint16_t configSize = getEEPROMConfigSize();
+
+    testConfig3Mutable()->value = 42;
+    // 6 byte header + 1 byte PG + CRC and the commit entry, padded to words
+    EXPECT_EQ(5, saveOperations());
+    EXPECT_EQ(configSize + 20, getEEPROMConfigSize());
+
+    EXPECT_TRUE(reboot());
+    EXPECT_EQ(42, testConfig3()->value);
+    testConfig3Mutable()->value = 1;
+    EXPECT_TRUE(hasValues(1));
+}
+
+TEST(ConfigEepromUnittest, TestJournalCompaction)
+{
+    eraseFlash();
+    setValues(1);
+    writeConfigToEEPROM();
+    const uint16_t compactedSize = getEEPROMConfigSize();
+
+    int compactions = 0;
+    uint16_t previousSize = compactedSize;
+    for (uint8_t seed = 2; seed < 40; seed++) {
+        setValues(seed);
+        writeConfigToEEPROM();
+        if (getEEPROMConfigSize() < previousSize) {
+            EXPECT_EQ(compactedSize, getEEPROMConfigSize());
+            compactions++;
+        }
+        previousSize = getEEPROMConfigSize();
+
+        EXPECT_TRUE(reboot());
+        EXPECT_TRUE(hasValues(seed));
+    }
+    EXPECT_LT(0, compactions);
+}
+
+// Loses power at every flash operation of a save from the given state, after the reboot
+// the config must be either the old or the new one and the following save must succeed.
+static void testPowerLossDuringSave(const uint8_t *flash, uint8_t oldSeed, uint8_t newSeed, bool powerSafe)
+{
+    memcpy(eepromData, flash, sizeof(eepromData));
+    eepromContentValidated = false;
+    setValues(newSeed);
+    const int operations = saveOperations();
+    EXPECT_LT(0, operations);
+
+    for (int limit = 0; limit < operations; limit++) {
+        memcpy(eepromData, flash, sizeof(eepromData));
+        eepromContentValidated = false;
+        setValues(newSeed);
+
+        flashOperationLimit = limit;
+        saveOperations();
+
+        const bool loaded = reboot();
+        if (powerSafe) {
+            EXPECT_TRUE(loaded) << "power lost after " << limit << " operations";
+        }
+        if (loaded) {
+            EXPECT_TRUE(hasValues(oldSeed) || hasValues(newSeed)) << "power lost after " << limit << " operations";
+        }
+
+        setValues(newSeed);
+        writeConfigToEEPROM();
+        EXPECT_TRUE(reboot());
+        EXPECT_TRUE(hasValues(newSeed));
+    }
+}
+
+TEST(ConfigEepromUnittest, TestPowerLossDuringJournalWrite)
+{
+    uint8_t flash[EEPROM_SIZE];
+
+    eraseFlash();
+    setValues(1);
+    writeConfigToEEPROM();
+    setValues(2);
+    writeConfigToEEPROM();
+    memcpy(flash, eepromData, sizeof(flash));
+
+    // the changed PGs are committed together
+    testPowerLossDuringSave(flash, 2, 3, true);
+}
+
+TEST(ConfigEepromUnittest, TestPowerLossDuringCompaction)
+{
+    uint8_t flash[EEPROM_SIZE];
+
+    eraseFlash();
+    setValues(1);
+    writeConfigToEEPROM();
+    uint8_t seed = 2;
+    uint16_t previousSize;
+    do {
+        memcpy(flash, eepromData, sizeof(flash));
+        previousSize = getEEPROMConfigSize();
+        setValues(seed++);
+        writeConfigToEEPROM();
+    } while (getEEPROMConfigSize() > previousSize);
+
+    // the single config area is erased before it is rewritten, only the outcome of a completed save is checked
+    testPowerLossDuringSave(flash, seed - 2, seed - 1, false);
+}
+
+// STUBS
+
+extern "C" {
+    void failureMode(failureMode_e) {}
+
+    void FLASH_Unlock(void) {}
+    void FLASH_Lock(void) {}
+
+    static bool flashPowered(void)
+    {
+        if (flashOperationLimit >= 0 && flashOperations >= flashOperationLimit) {
+            return false;
+        }
+        flashOperations++;
+        return true;
+    }
+
+    FLASH_Status FLASH_ErasePage(uintptr_t Page_Address)
+    {
+        if (flashPowered()) {
+            memset((void *)Page_Address, 0xff, FLASH_PAGE_SIZE);
+        }
+        return FLASH_COMPLETE;
+    }
+
+    FLASH_Status FLASH_ProgramWord(uintptr_t addr, uint32_t Data)
+    {
+        if (flashPowered()) {
+            *(uint32_t *)addr &= Data;
+        }
+        return FLASH_COMPLETE;
+    }
+}
@@ -0,0 +1,143 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/utils.h"
+
+    #include "drivers/dshot_telemetry.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+static const uint8_t gcrEncodeTable[16] = {
+    0x19, 0x1b, 0x12, 0x13, 0x1d, 0x15, 0x16, 0x17,
+    0x1a, 0x09, 0x0a, 0x0b, 0x1e, 0x0d, 0x0e, 0x0f
+};
+
+// builds the 21 bit line code for a 12 bit eeem mmmm mmmm value as sent by the ESC
+static uint32_t encodeReply(uint16_t value, bool corruptChecksum)
+{
+    uint16_t csum = 0xf ^ ((value ^ (value >> 4) ^ (value >> 8)) & 0xf);
+    if (corruptChecksum) {
+        csum ^= 0x1;
+    }
+    const uint16_t packet = (value << 4) | csum;
+
+    uint32_t gcr = 1; // start bit
+    for (int i = 3; i >= 0; i--) {
+        gcr = (gcr << 5) | gcrEncodeTable[(packet >> (i * 4)) & 0xf];
+    }
+    return gcr;
+}
+
+// timer captures for every edge, a 1 in the line code is an edge
+static uint8_t edgesFromLineCode(uint32_t lineCode, uint16_t start, int jitter, uint32_t *edges)
+{
+    uint8_t count = 0;
+    for (int bit = DSHOT_TELEMETRY_BITS - 1; bit >= 0; bit--) {
+        if (lineCode & (1 << bit)) {
+            const int offset = (count & 1) ? jitter : -jitter;
+            edges[count++] = (uint16_t)(start + (DSHOT_TELEMETRY_BITS - 1 - bit) * DSHOT_TELEMETRY_BIT_TICKS + offset);
+        }
+    }
+    return count;
+}
+
+TEST(DshotTelemetryUnittest, TestCapturedReplies)
+{
+    // 1200us period, 50000 eRPM
+    const uint32_t hover[] = { 1234, 1249, 1283, 1312, 1328, 1380, 1408, 1426, 1444, 1456, 1492, 1505, 1520, 1552 };
+    EXPECT_EQ(500, dshotDecodeTelemetryPacket(hover, ARRAYLEN(hover)));
+
+    // slowest period, motor stopped
+    const uint32_t stopped[] = { 40001, 40033, 40046, 40063, 40078, 40114, 40129, 40142, 40162, 40190, 40207, 40226, 40238, 40258, 40274, 40321 };
+    EXPECT_EQ(0, dshotDecodeTelemetryPacket(stopped, ARRAYLEN(stopped)));
+
+    // 100us period, timer wraps around during the reply
+    const uint32_t wrapped[] = { 65498, 65515, 65530, 46, 59, 92, 109, 139, 158, 170, 206, 236, 254, 283 };
+    EXPECT_EQ(6000, dshotDecodeTelemetryPacket(wrapped, ARRAYLEN(wrapped)));
+}
+
+TEST(DshotTelemetryUnittest, TestAllPeriods)
+{
+    uint32_t edges[DSHOT_TELEMETRY_INPUT_LEN];
+
+    for (uint16_t value = 0; value < 0x1000; value++) {
+        const uint32_t periodUs = (value & 0x1ff) << (value >> 9);
+        uint16_t expected;
+        if (value == 0x0fff) {
+            expected = 0;
+        } else if (periodUs < 10) {
+            expected = DSHOT_TELEMETRY_INVALID;
+        } else {
+            expected = (600000 + periodUs / 2) / periodUs;
+        }
+
+        // alternating early and late edges, runs up to 6 ticks off still round to the right bit count
+        for (int jitter = 0; jitter <= 3; jitter++) {
+            const uint8_t count = edgesFromLineCode(encodeReply(value, false), 100 * value, jitter, edges);
+            ASSERT_GE(DSHOT_TELEMETRY_INPUT_LEN, count);
+            EXPECT_EQ(expected, dshotDecodeTelemetryPacket(edges, count)) << "value " << value << " jitter " << jitter;
+        }
+    }
+}
+
+TEST(DshotTelemetryUnittest, TestBadChecksum)
+{
+    uint32_t edges[DSHOT_TELEMETRY_INPUT_LEN];
+
+    const uint8_t count = edgesFromLineCode(encodeReply(0x52c, true), 0, 0, edges);
+    EXPECT_EQ(DSHOT_TELEMETRY_INVALID, dshotDecodeTelemetryPacket(edges, count));
+}
+
+TEST(DshotTelemetryUnittest, TestInvalidGcr)
+{
+    uint32_t edges[DSHOT_TELEMETRY_INPUT_LEN];
+
+    // 0x00 is not a gcr code, in the lowest nibble
+    const uint32_t lineCode = encodeReply(0x52c, false) & ~0x1f;
+    const uint8_t count = edgesFromLineCode(lineCode, 0, 0, edges);
+    EXPECT_EQ(DSHOT_TELEMETRY_INVALID, dshotDecodeTelemetryPacket(edges, count));
+}
+
+TEST(DshotTelemetryUnittest, TestWrongLength)
+{
+    uint32_t edges[DSHOT_TELEMETRY_INPUT_LEN];
+
+    // nothing captured
+    EXPECT_EQ(DSHOT_TELEMETRY_INVALID, dshotDecodeTelemetryPacket(edges, 0));
+
+    // runs add up to more than a reply
+    uint8_t count = edgesFromLineCode(encodeReply(0x52c, false), 0, 0, edges);
+    edges[count - 1] += 2 * DSHOT_TELEMETRY_BIT_TICKS;
+    EXPECT_EQ(DSHOT_TELEMETRY_INVALID, dshotDecodeTelemetryPacket(edges, count));
+
+    // glitch shorter than half a bit
+    count = edgesFromLineCode(encodeReply(0x52c, false), 0, 0, edges);
+    edges[count] = edges[count - 1] + 3;
+    EXPECT_EQ(DSHOT_TELEMETRY_INVALID, dshotDecodeTelemetryPacket(edges, count + 1));
+
+    // reply cut short by the next motor update, the missing edges shift the nibbles
+    count = edgesFromLineCode(encodeReply(0x52c, false), 0, 0, edges);
+    EXPECT_EQ(DSHOT_TELEMETRY_INVALID, dshotDecodeTelemetryPacket(edges, count - 3));
+}
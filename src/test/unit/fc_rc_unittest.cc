@@ -0,0 +1,336 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "build/debug.h"
+
+    #include "common/axis.h"
+    #include "common/maths.h"
+
+    #include "config/parameter_group.h"
+    #include "config/parameter_group_ids.h"
+
+    #include "drivers/io.h"
+
+    #include "fc/controlrate_profile.h"
+    #include "fc/fc_core.h"
+    #include "fc/fc_rc.h"
+    #include "fc/rc_controls.h"
+    #include "fc/rc_modes.h"
+    #include "fc/runtime_config.h"
+
+    #include "flight/imu.h"
+    #include "flight/pid.h"
+
+    #include "rx/rx.h"
+
+    #include "scheduler/scheduler.h"
+
+    void calculateSetpointRate(int axis);
+
+    PG_REGISTER(rxConfig_t, rxConfig, PG_RX_CONFIG, 0);
+    PG_REGISTER(rcControlsConfig_t, rcControlsConfig, PG_RC_CONTROLS_CONFIG, 0);
+
+    float rcCommand[4];
+    int16_t rcData[MAX_SUPPORTED_RC_CHANNEL_COUNT];
+    uint8_t debugMode = 0;
+    int16_t debug[DEBUG16_VALUE_COUNT];
+    pidProfile_t *currentPidProfile;
+    controlRateConfig_t *currentControlRateProfile;
+    attitudeEulerAngles_t attitude;
+    uint32_t targetPidLooptime;
+    bool isRXDataNew;
+    int16_t headFreeModeHold;
+    uint16_t flightModeFlags = 0;
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+timeDelta_t rxFrameIntervalUs = 0;
+bool fpvAngleMixActive = false;
+
+#define SETPOINT_RATE_LIMIT 1998.0f
+#define RC_RATE_INCREMENTAL 14.54f
+
+// the rate curve formula as it was evaluated before the coefficients were precomputed
+static float referenceSetpointRate(const controlRateConfig_t *rateProfile, int axis, float command)
+{
+    uint8_t rcExpo;
+    float rcRate;
+    if (axis != YAW) {
+        rcExpo = rateProfile->rcExpo8;
+        rcRate = rateProfile->rcRate8 / 100.0f;
+    } else {
+        rcExpo = rateProfile->rcYawExpo8;
+        rcRate = rateProfile->rcYawRate8 / 100.0f;
+    }
+    if (rcRate > 2.0f) {
+        rcRate += RC_RATE_INCREMENTAL * (rcRate - 2.0f);
+    }
+
+    float rcCommandf = command / 500.0f;
+    const float rcCommandfAbs = ABS(rcCommandf);
+
+    if (rcExpo) {
+        const float expof = rcExpo / 100.0f;
+        rcCommandf = rcCommandf * power3(rcCommandfAbs) * expof + rcCommandf * (1-expof);
+    }
+
+    float angleRate = 200.0f * rcRate * rcCommandf;
+    if (rateProfile->rates[axis]) {
+        const float rcSuperfactor = 1.0f / (constrainf(1.0f - (rcCommandfAbs * (rateProfile->rates[axis] / 100.0f)), 0.01f, 1.00f));
+        angleRate *= rcSuperfactor;
+    }
+
+    return constrainf(angleRate, -SETPOINT_RATE_LIMIT, SETPOINT_RATE_LIMIT);
+}
+
+static float maxSetpointRateDeviation(controlRateConfig_t *rateProfile)
+{
+    currentControlRateProfile = rateProfile;
+    generateRateCurves();
+
+    float maxDeviation = 0;
+    for (int axis = FD_ROLL; axis <= FD_YAW; axis++) {
+        // step in fractions of a unit as rcCommand is interpolated between rx frames
+        for (float command = -500.0f; command <= 500.0f; command += 0.25f) {
+            rcCommand[axis] = command;
+            calculateSetpointRate(axis);
+            const float deviation = fabsf(getSetpointRate(axis) - referenceSetpointRate(rateProfile, axis, command));
+            maxDeviation = MAX(maxDeviation, deviation);
+        }
+    }
+    return maxDeviation;
+}
+
+TEST(FcRcUnittest, TestRateCurveDefaults)
+{
+    controlRateConfig_t rateProfile;
+    memset(&rateProfile, 0, sizeof(rateProfile));
+    rateProfile.rcRate8 = 100;
+    rateProfile.rcYawRate8 = 100;
+    rateProfile.rates[FD_ROLL] = 70;
+    rateProfile.rates[FD_PITCH] = 70;
+    rateProfile.rates[FD_YAW] = 70;
+
+    EXPECT_LT(maxSetpointRateDeviation(&rateProfile), 0.01f);
+
+    // centre stick and full stick
+    rcCommand[FD_ROLL] = 0;
+    calculateSetpointRate(FD_ROLL);
+    EXPECT_EQ(0, getSetpointRate(FD_ROLL));
+
+    rcCommand[FD_ROLL] = 500;
+    calculateSetpointRate(FD_ROLL);
+    EXPECT_FLOAT_EQ(referenceSetpointRate(&rateProfile, FD_ROLL, 500), getSetpointRate(FD_ROLL));
+
+    rcCommand[FD_ROLL] = -500;
+    calculateSetpointRate(FD_ROLL);
+    EXPECT_FLOAT_EQ(referenceSetpointRate(&rateProfile, FD_ROLL, -500), getSetpointRate(FD_ROLL));
+}
+
+TEST(FcRcUnittest, TestRateCurveExpoAndLinear)
+{
+    controlRateConfig_t rateProfile;
+    memset(&rateProfile, 0, sizeof(rateProfile));
+    rateProfile.rcRate8 = 120;
+    rateProfile.rcExpo8 = 30;
+    rateProfile.rcYawRate8 = 90;
+    rateProfile.rcYawExpo8 = 100;
+
+    EXPECT_LT(maxSetpointRateDeviation(&rateProfile), 0.01f);
+}
+
+TEST(FcRcUnittest, TestRateCurveHighRates)
+{
+    controlRateConfig_t rateProfile;
+    memset(&rateProfile, 0, sizeof(rateProfile));
+    rateProfile.rcRate8 = 255;
+    rateProfile.rcExpo8 = 50;
+    rateProfile.rcYawRate8 = 150;
+    rateProfile.rcYawExpo8 = 20;
+    rateProfile.rates[FD_ROLL] = 80;
+    rateProfile.rates[FD_PITCH] = 90;
+    rateProfile.rates[FD_YAW] = 100;
+
+    // the curve is steep towards full stick, only float rounding differs
+    EXPECT_LT(maxSetpointRateDeviation(&rateProfile), 0.01f);
+}
+
+TEST(FcRcUnittest, TestRateCurveBeyondFullDeflection)
+{
+    controlRateConfig_t rateProfile;
+    memset(&rateProfile, 0, sizeof(rateProfile));
+    rateProfile.rcRate8 = 100;
+    rateProfile.rcExpo8 = 10;
+    rateProfile.rates[FD_PITCH] = 50;
+
+    currentControlRateProfile = &rateProfile;
+    generateRateCurves();
+
+    // headfree rotation can push rcCommand past full deflection
+    rcCommand[FD_PITCH] = 700;
+    calculateSetpointRate(FD_PITCH);
+    EXPECT_FLOAT_EQ(referenceSetpointRate(&rateProfile, FD_PITCH, 700), getSetpointRate(FD_PITCH));
+    EXPECT_FLOAT_EQ(700 / 500.0f, getRcDeflectionAbs(FD_PITCH));
+}
+
+TEST(FcRcUnittest, TestRateCurveRegenerated)
+{
+    controlRateConfig_t rateProfile;
+    memset(&rateProfile, 0, sizeof(rateProfile));
+    rateProfile.rcRate8 = 100;
+
+    currentControlRateProfile = &rateProfile;
+    generateRateCurves();
+
+    rcCommand[FD_ROLL] = 250;
+    calculateSetpointRate(FD_ROLL);
+    EXPECT_FLOAT_EQ(100.0f, getSetpointRate(FD_ROLL));
+
+    // coefficients are only updated when regenerated
+    rateProfile.rcRate8 = 200;
+    calculateSetpointRate(FD_ROLL);
+    EXPECT_FLOAT_EQ(100.0f, getSetpointRate(FD_ROLL));
+
+    generateRateCurves();
+    calculateSetpointRate(FD_ROLL);
+    EXPECT_FLOAT_EQ(200.0f, getSetpointRate(FD_ROLL));
+}
+
+TEST(FcRcUnittest, TestRcSmoothingFilter)
+{
+    controlRateConfig_t rateProfile;
+    memset(&rateProfile, 0, sizeof(rateProfile));
+    rateProfile.rcRate8 = 100;
+    currentControlRateProfile = &rateProfile;
+    generateRateCurves();
+
+    rxConfigMutable()->rcInterpolation = RC_SMOOTHING_FILTER;
+    rxConfigMutable()->rcInterpolationChannels = 1; // RPY
+    targetPidLooptime = 1000;
+    rxFrameIntervalUs = 9000;
+    debugMode = DEBUG_RC_INTERPOLATION;
+
+    // first frame at centre initialises the filter in steady state
+    memset(rcCommand, 0, sizeof(rcCommand));
+    isRXDataNew = true;
+    processRcCommand();
+    EXPECT_FALSE(isRXDataNew);
+    EXPECT_EQ(0, rcCommand[ROLL]);
+    EXPECT_EQ(0, getSetpointRate(ROLL));
+
+    // step to half stick, rcCommand and setpoint are smoothed towards it every pid loop
+    float previousRoll = 0;
+    for (int loop = 0; loop < 100; loop++) {
+        if (loop % 9 == 0) {
+            rcCommand[ROLL] = 250;
+            rcCommand[PITCH] = -250;
+            isRXDataNew = true;
+        }
+        processRcCommand();
+
+        EXPECT_FLOAT_EQ(-rcCommand[ROLL], rcCommand[PITCH]);
+        EXPECT_FLOAT_EQ(rcCommand[ROLL] * 200.0f / 500.0f, getSetpointRate(ROLL));
+        if (loop == 0) {
+            // no staircase, only a fraction of the step passes in the first loop
+            EXPECT_LT(rcCommand[ROLL], 25);
+        }
+        if (loop < 20) {
+            EXPECT_GT(rcCommand[ROLL], previousRoll);
+        }
+        previousRoll = rcCommand[ROLL];
+    }
+    // butterworth response settles after a small overshoot
+    EXPECT_NEAR(250, rcCommand[ROLL], 1.0f);
+    EXPECT_NEAR(100.0f, getSetpointRate(ROLL), 0.5f);
+    // cutoff follows the rx frame rate
+    EXPECT_EQ(lrintf(1e6f / 9000 / 3), debug[2]);
+
+    debugMode = DEBUG_NONE;
+    rxConfigMutable()->rcInterpolation = RC_SMOOTHING_OFF;
+}
+
+TEST(FcRcUnittest, TestRcSmoothingFilterSteadyState)
+{
+    controlRateConfig_t rateProfile;
+    memset(&rateProfile, 0, sizeof(rateProfile));
+    rateProfile.rcRate8 = 100;
+    rateProfile.rcYawRate8 = 100;
+    currentControlRateProfile = &rateProfile;
+    generateRateCurves();
+
+    // clear the filter from an earlier test
+    rxConfigMutable()->rcInterpolation = RC_SMOOTHING_OFF;
+    processRcCommand();
+
+    rxConfigMutable()->rcInterpolation = RC_SMOOTHING_FILTER;
+    rxConfigMutable()->rcInterpolationChannels = 0; // RP, yaw isn't filtered but its setpoint is still recalculated
+    rxConfigMutable()->fpvCamAngleDegrees = 30;
+    fpvAngleMixActive = true;
+    targetPidLooptime = 1000;
+    rxFrameIntervalUs = 9000;
+
+    // a constant command doesn't move when the filter starts, nor when the cutoff follows a faster rx
+    float setpointRoll = 0;
+    float setpointYaw = 0;
+    for (int loop = 0; loop < 200; loop++) {
+        if (loop == 100) {
+            rxFrameIntervalUs = 4000;
+        }
+        if (loop % 9 == 0) {
+            rcCommand[ROLL] = 300;
+            rcCommand[PITCH] = -300;
+            rcCommand[YAW] = 200;
+            isRXDataNew = true;
+        }
+        processRcCommand();
+
+        EXPECT_NEAR(300, rcCommand[ROLL], 0.01f);
+        EXPECT_NEAR(-300, rcCommand[PITCH], 0.01f);
+        if (loop == 0) {
+            setpointRoll = getSetpointRate(ROLL);
+            setpointYaw = getSetpointRate(YAW);
+        }
+        // the camera angle mix is applied to fresh setpoints, not again to the previous loop's
+        EXPECT_NEAR(setpointRoll, getSetpointRate(ROLL), 0.01f);
+        EXPECT_NEAR(setpointYaw, getSetpointRate(YAW), 0.01f);
+    }
+
+    fpvAngleMixActive = false;
+    rxConfigMutable()->fpvCamAngleDegrees = 0;
+    rxConfigMutable()->rcInterpolation = RC_SMOOTHING_OFF;
+}
+
+// STUBS
+
+extern "C" {
+    bool feature(uint32_t) { return false; }
+    bool IS_RC_MODE_ACTIVE(boxId_e boxId) { return fpvAngleMixActive && boxId == BOXFPVANGLEMIX; }
+    timeDelta_t getTaskDeltaTime(cfTaskId_e) { return rxFrameIntervalUs; }
+    bool isAntiGravityModeActive(void) { return false; }
+    void pidSetItermAccelerator(float) {}
+    uint16_t rxGetRefreshRate(void) { return 0; }
+    bool failsafeIsActive(void) { return false; }
+}
@@ -0,0 +1,364 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/streambuf.h"
+
+    #include "drivers/serial.h"
+
+    #include "io/serial.h"
+
+    #include "msp/msp.h"
+    #include "msp/msp_serial.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define FAKE_PORT_BUFFER_SIZE 1024
+
+typedef struct fakeSerialPort_s {
+    serialPort_t port;
+    uint8_t rx[FAKE_PORT_BUFFER_SIZE];
+    int rxHead;
+    int rxTail;
+    uint8_t tx[FAKE_PORT_BUFFER_SIZE];
+    int txHead;
+    int readCalls;
+    int readBufCalls;
+    int nonMspBytes;
+} fakeSerialPort_t;
+
+static fakeSerialPort_t fakePorts[MAX_MSP_PORT_COUNT];
+
+static fakeSerialPort_t *fakePort(const serialPort_t *instance)
+{
+    return (fakeSerialPort_t *)instance;
+}
+
+static void fakeWrite(serialPort_t *instance, uint8_t ch)
+{
+    fakeSerialPort_t *fake = fakePort(instance);
+    fake->tx[fake->txHead++] = ch;
+}
+
+static uint32_t fakeRxWaiting(const serialPort_t *instance)
+{
+    return fakePort(instance)->rxHead - fakePort(instance)->rxTail;
+}
+
+static uint32_t fakeTxFree(const serialPort_t *instance)
+{
+    return FAKE_PORT_BUFFER_SIZE - fakePort(instance)->txHead;
+}
+
+static uint8_t fakeRead(serialPort_t *instance)
+{
+    fakeSerialPort_t *fake = fakePort(instance);
+    fake->readCalls++;
+    return fake->rx[fake->rxTail++];
+}
+
+static void fakeReadBuf(serialPort_t *instance, void *data, int count)
+{
+    fakeSerialPort_t *fake = fakePort(instance);
+    EXPECT_LE(count, fake->rxHead - fake->rxTail);
+    fake->readBufCalls++;
+    memcpy(data, &fake->rx[fake->rxTail], count);
+    fake->rxTail += count;
+}
+
+static const struct serialPortVTable fakeVTable = {
+    .serialWrite = fakeWrite,
+    .serialTotalRxWaiting = fakeRxWaiting,
+    .serialTotalTxFree = fakeTxFree,
+    .serialRead = fakeRead,
+    .serialSetBaudRate = NULL,
+    .isSerialTransmitBufferEmpty = NULL,
+    .setMode = NULL,
+    .writeBuf = NULL,
+    .readBuf = fakeReadBuf,
+    .beginWrite = NULL,
+    .endWrite = NULL,
+};
+
+static void fakeReceive(int portIndex, const uint8_t *data, int len)
+{
+    fakeSerialPort_t *fake = &fakePorts[portIndex];
+    memcpy(&fake->rx[fake->rxHead], data, len);
+    fake->rxHead += len;
+}
+
+static void fakeReceiveCommand(int portIndex, uint8_t cmd, const uint8_t *payload, uint8_t len)
+{
+    uint8_t frame[5] = { '$', 'M', '<', len, cmd };
+    uint8_t checksum = len ^ cmd;
+    for (int i = 0; i < len; i++) {
+        checksum ^= payload[i];
+    }
+    fakeReceive(portIndex, frame, sizeof(frame));
+    fakeReceive(portIndex, payload, len);
+    fakeReceive(portIndex, &checksum, 1);
+}
+
+static int commandCount;
+static uint8_t commandCmd[16];
+static uint8_t commandPayload[MSP_PORT_INBUF_SIZE];
+static int commandPayloadSize;
+static uint32_t commandDurationUs;
+static uint32_t fakeTimeUs;
+
+static mspResult_e testProcessCommand(mspPacket_t *cmd, mspPacket_t *reply, mspPostProcessFnPtr *mspPostProcessFn)
+{
+    UNUSED(mspPostProcessFn);
+
+    commandCmd[commandCount] = cmd->cmd;
+    commandPayloadSize = sbufBytesRemaining(&cmd->buf);
+    sbufReadData(&cmd->buf, commandPayload, commandPayloadSize);
+    sbufAdvance(&cmd->buf, commandPayloadSize);
+    commandCount++;
+    fakeTimeUs += commandDurationUs;
+
+    reply->cmd = cmd->cmd;
+    sbufWriteU8(&reply->buf, cmd->cmd);
+    return MSP_RESULT_ACK;
+}
+
+static void testProcessReply(mspPacket_t *cmd)
+{
+    UNUSED(cmd);
+}
+
+class MspSerialTest : public ::testing::Test
+{
+protected:
+    virtual void SetUp()
+    {
+        memset(fakePorts, 0, sizeof(fakePorts));
+        for (int i = 0; i < MAX_MSP_PORT_COUNT; i++) {
+            fakePorts[i].port.vTable = &fakeVTable;
+        }
+        commandCount = 0;
+        commandPayloadSize = 0;
+        commandDurationUs = 0;
+        fakeTimeUs = 0;
+        mspSerialInit();
+    }
+
+    void process(void)
+    {
+        mspSerialProcess(MSP_EVALUATE_NON_MSP_DATA, testProcessCommand, testProcessReply);
+    }
+
+    int repliesOnPort(int portIndex)
+    {
+        int replies = 0;
+        for (int i = 0; i + 2 < fakePorts[portIndex].txHead; i++) {
+            if (!memcmp(&fakePorts[portIndex].tx[i], "$M>", 3)) {
+                replies++;
+            }
+        }
+        return replies;
+    }
+};
+
+TEST_F(MspSerialTest, TestPayloadIsReadInBulk)
+{
+    uint8_t payload[180];
+    for (unsigned i = 0; i < sizeof(payload); i++) {
+        payload[i] = i;
+    }
+    fakeReceiveCommand(0, 225, payload, sizeof(payload));
+
+    process();
+
+    EXPECT_EQ(1, commandCount);
+    EXPECT_EQ(225, commandCmd[0]);
+    EXPECT_EQ((int)sizeof(payload), commandPayloadSize);
+    EXPECT_EQ(0, memcmp(payload, commandPayload, sizeof(payload)));
+    // header and checksum bytes one at a time, the payload in one go
+    EXPECT_EQ(6, fakePorts[0].readCalls);
+    EXPECT_EQ(1, fakePorts[0].readBufCalls);
+    EXPECT_EQ(1, repliesOnPort(0));
+}
+
+TEST_F(MspSerialTest, TestPayloadSplitAcrossCalls)
+{
+    const uint8_t payload[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    uint8_t frame[5 + sizeof(payload) + 1] = { '$', 'M', '<', sizeof(payload), 100 };
+    uint8_t checksum = sizeof(payload) ^ 100;
+    for (unsigned i = 0; i < sizeof(payload); i++) {
+        frame[5 + i] = payload[i];
+        checksum ^= payload[i];
+    }
+    frame[sizeof(frame) - 1] = checksum;
+
+    fakeReceive(0, frame, 8);
+    process();
+    EXPECT_EQ(0, commandCount);
+
+    fakeReceive(0, &frame[8], sizeof(frame) - 8);
+    process();
+    EXPECT_EQ(1, commandCount);
+    EXPECT_EQ((int)sizeof(payload), commandPayloadSize);
+    EXPECT_EQ(0, memcmp(payload, commandPayload, sizeof(payload)));
+}
+
+TEST_F(MspSerialTest, TestBytesAfterFrameAreLeftWaiting)
+{
+    const uint8_t payload[] = { 1, 2, 3 };
+    fakeReceiveCommand(0, 1, payload, sizeof(payload));
+    fakeReceive(0, (const uint8_t *)"#", 1);
+
+    process();
+
+    EXPECT_EQ(1, commandCount);
+    EXPECT_EQ(0, fakePorts[0].nonMspBytes);
+    // the CLI entry character must still be there for the next pass
+    EXPECT_EQ(1u, fakeRxWaiting(&fakePorts[0].port));
+
+    process();
+
+    EXPECT_EQ(1, fakePorts[0].nonMspBytes);
+}
+
+TEST_F(MspSerialTest, TestOneCommandPerPortPerCall)
+{
+    for (int port = 0; port < MAX_MSP_PORT_COUNT; port++) {
+        fakeReceiveCommand(port, 10 + port, NULL, 0);
+        fakeReceiveCommand(port, 20 + port, NULL, 0);
+    }
+
+    process();
+
+    EXPECT_EQ(MAX_MSP_PORT_COUNT, commandCount);
+    for (int port = 0; port < MAX_MSP_PORT_COUNT; port++) {
+        EXPECT_EQ(1, repliesOnPort(port));
+    }
+
+    process();
+
+    EXPECT_EQ(2 * MAX_MSP_PORT_COUNT, commandCount);
+    for (int port = 0; port < MAX_MSP_PORT_COUNT; port++) {
+        EXPECT_EQ(2, repliesOnPort(port));
+    }
+}
+
+TEST_F(MspSerialTest, TestTimeBudgetDefersRemainingPorts)
+{
+    commandDurationUs = 300;
+    for (int port = 0; port < MAX_MSP_PORT_COUNT; port++) {
+        fakeReceiveCommand(port, 10 + port, NULL, 0);
+        fakeReceiveCommand(port, 20 + port, NULL, 0);
+    }
+
+    process();
+
+    // the budget runs out after the second port
+    EXPECT_EQ(2, commandCount);
+    EXPECT_EQ(10, commandCmd[0]);
+    EXPECT_EQ(11, commandCmd[1]);
+
+    process();
+
+    // the port that missed out goes first
+    EXPECT_EQ(4, commandCount);
+    EXPECT_EQ(12, commandCmd[2]);
+    EXPECT_EQ(20, commandCmd[3]);
+
+    process();
+
+    EXPECT_EQ(6, commandCount);
+    EXPECT_EQ(21, commandCmd[4]);
+    EXPECT_EQ(22, commandCmd[5]);
+}
+
+TEST_F(MspSerialTest, TestNonMspFloodIsBounded)
+{
+    uint8_t garbage[600];
+    memset(garbage, 'x', sizeof(garbage));
+    fakeReceive(0, garbage, sizeof(garbage));
+    fakeReceiveCommand(1, 1, NULL, 0);
+
+    process();
+
+    EXPECT_EQ(1, commandCount);
+    EXPECT_EQ(1, repliesOnPort(1));
+    EXPECT_GT(fakeRxWaiting(&fakePorts[0].port), 0u);
+    EXPECT_LT(fakeRxWaiting(&fakePorts[0].port), sizeof(garbage));
+
+    for (int i = 0; i < 10; i++) {
+        process();
+    }
+
+    EXPECT_EQ(0u, fakeRxWaiting(&fakePorts[0].port));
+    EXPECT_EQ((int)sizeof(garbage), fakePorts[0].nonMspBytes);
+}
+
+// STUBS
+
+extern "C" {
+    const uint32_t baudRates[] = {0, 9600, 19200, 38400, 57600, 115200, 230400, 250000,
+        400000, 460800, 500000, 921600, 1000000, 1500000, 2000000, 2470000};
+
+    static serialPortConfig_t portConfigs[MAX_MSP_PORT_COUNT];
+    static int portConfigIndex;
+
+    serialPortConfig_t *findNextSerialPortConfig(serialPortFunction_e function)
+    {
+        UNUSED(function);
+        if (portConfigIndex >= MAX_MSP_PORT_COUNT) {
+            return NULL;
+        }
+        portConfigs[portConfigIndex].identifier = (serialPortIdentifier_e)portConfigIndex;
+        return &portConfigs[portConfigIndex++];
+    }
+
+    serialPortConfig_t *findSerialPortConfig(serialPortFunction_e function)
+    {
+        portConfigIndex = 0;
+        return findNextSerialPortConfig(function);
+    }
+
+    serialPort_t *openSerialPort(serialPortIdentifier_e identifier, serialPortFunction_e function,
+        serialReceiveCallbackPtr rxCallback, uint32_t baudRate, portMode_e mode, portOptions_e options)
+    {
+        UNUSED(function);
+        UNUSED(rxCallback);
+        UNUSED(baudRate);
+        UNUSED(mode);
+        UNUSED(options);
+        return &fakePorts[identifier].port;
+    }
+
+    void closeSerialPort(serialPort_t *serialPort) { UNUSED(serialPort); }
+
+    void waitForSerialPortToFinishTransmitting(serialPort_t *serialPort) { UNUSED(serialPort); }
+
+    void serialEvaluateNonMspData(serialPort_t *serialPort, uint8_t receivedChar)
+    {
+        UNUSED(receivedChar);
+        fakePort(serialPort)->nonMspBytes++;
+    }
+
+    uint32_t micros(void) { return fakeTimeUs; }
+}
@@ -0,0 +1,742 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "blackbox/blackbox.h"
+
+    #include "build/debug.h"
+    #include "build/version.h"
+
+    #include "common/streambuf.h"
+
+    #include "config/feature.h"
+    #include "config/parameter_group.h"
+    #include "config/parameter_group_ids.h"
+
+    #include "drivers/pwm_output.h"
+    #include "drivers/serial.h"
+
+    #include "fc/config.h"
+    #include "fc/controlrate_profile.h"
+    #include "fc/fc_core.h"
+    #include "fc/fc_msp.h"
+    #include "fc/rc_adjustments.h"
+    #include "fc/rc_controls.h"
+    #include "fc/rc_modes.h"
+    #include "fc/runtime_config.h"
+
+    #include "flight/altitude.h"
+    #include "flight/failsafe.h"
+    #include "flight/imu.h"
+    #include "flight/mixer.h"
+    #include "flight/navigation.h"
+    #include "flight/pid.h"
+    #include "flight/servos.h"
+
+    #include "io/beeper.h"
+    #include "io/gps.h"
+    #include "io/ledstrip.h"
+    #include "io/serial.h"
+    #include "drivers/transponder_ir.h"
+    #include "io/transponder_ir.h"
+
+    #include "msp/msp.h"
+    #include "msp/msp_protocol.h"
+    #include "msp/msp_serial.h"
+
+    #include "rx/rx.h"
+
+    #include "scheduler/scheduler.h"
+
+    #include "sensors/acceleration.h"
+    #include "sensors/barometer.h"
+    #include "sensors/battery.h"
+    #include "sensors/boardalignment.h"
+    #include "sensors/compass.h"
+    #include "sensors/current.h"
+    #include "sensors/gyro.h"
+    #include "sensors/voltage.h"
+
+    #include "telemetry/telemetry.h"
+
+    PG_REGISTER(accelerometerConfig_t, accelerometerConfig, PG_ACCELEROMETER_CONFIG, 0);
+    PG_REGISTER_ARRAY(adjustmentRange_t, MAX_ADJUSTMENT_RANGE_COUNT, adjustmentRanges, PG_ADJUSTMENT_RANGE_CONFIG, 0);
+    PG_REGISTER(armingConfig_t, armingConfig, PG_ARMING_CONFIG, 0);
+    PG_REGISTER(barometerConfig_t, barometerConfig, PG_BAROMETER_CONFIG, 0);
+    PG_REGISTER(batteryConfig_t, batteryConfig, PG_BATTERY_CONFIG, 0);
+    PG_REGISTER(blackboxConfig_t, blackboxConfig, PG_BLACKBOX_CONFIG, 0);
+    PG_REGISTER(boardAlignment_t, boardAlignment, PG_BOARD_ALIGNMENT, 0);
+    PG_REGISTER(compassConfig_t, compassConfig, PG_COMPASS_CONFIG, 0);
+    PG_REGISTER(currentSensorADCConfig_t, currentSensorADCConfig, PG_CURRENT_SENSOR_ADC_CONFIG, 0);
+    PG_REGISTER_ARRAY(servoMixer_t, MAX_SERVO_RULES, customServoMixers, PG_SERVO_MIXER, 0);
+    PG_REGISTER(failsafeConfig_t, failsafeConfig, PG_FAILSAFE_CONFIG, 0);
+    PG_REGISTER(featureConfig_t, featureConfig, PG_FEATURE_CONFIG, 0);
+    PG_REGISTER(flight3DConfig_t, flight3DConfig, PG_MOTOR_3D_CONFIG, 0);
+    PG_REGISTER(gpsConfig_t, gpsConfig, PG_GPS_CONFIG, 0);
+    PG_REGISTER(gyroConfig_t, gyroConfig, PG_GYRO_CONFIG, 0);
+    PG_REGISTER(ledStripConfig_t, ledStripConfig, PG_LED_STRIP_CONFIG, 0);
+    PG_REGISTER(mixerConfig_t, mixerConfig, PG_MIXER_CONFIG, 0);
+    PG_REGISTER_ARRAY(modeActivationCondition_t, MAX_MODE_ACTIVATION_CONDITION_COUNT, modeActivationConditions, PG_MODE_ACTIVATION_PROFILE, 0);
+    PG_REGISTER(motorConfig_t, motorConfig, PG_MOTOR_CONFIG, 0);
+    PG_REGISTER(pidConfig_t, pidConfig, PG_PID_CONFIG, 0);
+    PG_REGISTER(pilotConfig_t, pilotConfig, PG_PILOT_CONFIG, 0);
+    PG_REGISTER(rcControlsConfig_t, rcControlsConfig, PG_RC_CONTROLS_CONFIG, 0);
+    PG_REGISTER(rxConfig_t, rxConfig, PG_RX_CONFIG, 0);
+    PG_REGISTER_ARRAY(rxFailsafeChannelConfig_t, MAX_SUPPORTED_RC_CHANNEL_COUNT, rxFailsafeChannelConfigs, PG_RX_FAILSAFE_CHANNEL_CONFIG, 0);
+    PG_REGISTER(serialConfig_t, serialConfig, PG_SERIAL_CONFIG, 0);
+    PG_REGISTER_ARRAY(servoParam_t, MAX_SUPPORTED_SERVOS, servoParams, PG_SERVO_PARAMS, 0);
+    PG_REGISTER(systemConfig_t, systemConfig, PG_SYSTEM_CONFIG, 0);
+    PG_REGISTER(telemetryConfig_t, telemetryConfig, PG_TELEMETRY_CONFIG, 0);
+    PG_REGISTER(transponderConfig_t, transponderConfig, PG_TRANSPONDER_CONFIG, 0);
+    PG_REGISTER_ARRAY(voltageSensorADCConfig_t, MAX_VOLTAGE_SENSOR_ADC, voltageSensorADCConfig, PG_VOLTAGE_SENSOR_ADC_CONFIG, 0);
+
+    int32_t AltHold;
+    int16_t GPS_directionToHome;
+    uint16_t GPS_distanceToHome;
+    int32_t GPS_hold[2];
+    int32_t GPS_home[2];
+    uint8_t GPS_numCh;
+    uint8_t GPS_svinfo_chn[16];
+    uint8_t GPS_svinfo_cno[16];
+    uint8_t GPS_svinfo_quality[16];
+    uint8_t GPS_svinfo_svid[16];
+    uint8_t GPS_update;
+    acc_t acc;
+    uint8_t armingFlags;
+    attitudeEulerAngles_t attitude;
+    uint16_t averageSystemLoadPercent;
+    controlRateConfig_t *currentControlRateProfile;
+    pidProfile_t *currentPidProfile;
+    int16_t debug[DEBUG16_VALUE_COUNT];
+    uint16_t flightModeFlags;
+    gpsSolutionData_t gpsSol;
+    mag_t mag;
+    int16_t magHold;
+    float motor[MAX_SUPPORTED_MOTORS];
+    float motor_disarmed[MAX_SUPPORTED_MOTORS];
+    navigationMode_e nav_mode;
+    int16_t rcData[MAX_SUPPORTED_RC_CHANNEL_COUNT];
+    uint16_t rssi;
+    rxRuntimeConfig_t rxRuntimeConfig;
+    int16_t servo[MAX_SUPPORTED_SERVOS];
+    uint8_t stateFlags;
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+static controlRateConfig_t controlRateProfile;
+static pidProfile_t pidProfile;
+static pwmOutputPort_t motors[MAX_SUPPORTED_MOTORS];
+static timeUs_t currentTimeUs;
+
+static int configActivations;
+
+static serialPort_t streamPort;
+static bool streamTaskEnabled;
+static bool streamPushFits;
+// commands of the pushed packets, one string per burst
+static std::vector<std::string> streamBursts;
+
+// a request to the FC and the reply it gave before the command dispatch was changed
+typedef struct mspRecordedPair_s {
+    uint8_t cmd;
+    const char *request;
+    int8_t result;
+    const char *reply;
+} mspRecordedPair_t;
+
+static int hexToBytes(const char *hex, uint8_t *bytes)
+{
+    int count = 0;
+    for (; hex[0] && hex[1]; hex += 2) {
+        char byte[3] = { hex[0], hex[1], 0 };
+        bytes[count++] = strtoul(byte, NULL, 16);
+    }
+    return count;
+}
+
+static void bytesToHex(const uint8_t *bytes, int count, char *hex)
+{
+    for (int i = 0; i < count; i++) {
+        sprintf(hex + 2 * i, "%02x", bytes[i]);
+    }
+    hex[2 * count] = 0;
+}
+
+static mspPostProcessFnPtr postProcessFn;
+
+static mspResult_e processCommand(uint8_t cmd, const char *request, char *reply)
+{
+    // reads beyond the request find zeros, as in the serial input buffer
+    static uint8_t requestBuffer[MSP_PORT_INBUF_SIZE];
+    static uint8_t replyBuffer[MSP_PORT_OUTBUF_SIZE];
+    memset(requestBuffer, 0, sizeof(requestBuffer));
+    const int requestSize = hexToBytes(request, requestBuffer);
+
+    mspPacket_t command = {
+        .buf = { .ptr = requestBuffer, .end = requestBuffer + requestSize, },
+        .cmd = cmd,
+        .result = 0,
+        .direction = MSP_DIRECTION_REQUEST,
+    };
+    mspPacket_t replyPacket = {
+        .buf = { .ptr = replyBuffer, .end = ARRAYEND(replyBuffer), },
+        .cmd = -1,
+        .result = 0,
+        .direction = MSP_DIRECTION_REPLY,
+    };
+    postProcessFn = NULL;
+    const mspResult_e result = mspFcProcessCommand(&command, &replyPacket, &postProcessFn);
+
+    EXPECT_EQ(cmd, replyPacket.cmd);
+    bytesToHex(replyBuffer, replyPacket.buf.ptr - replyBuffer, reply);
+    return result;
+}
+
+static void resetState(void)
+{
+    PG_FOREACH(pg) {
+        pgReset(pg);
+    }
+    memset(&controlRateProfile, 0, sizeof(controlRateProfile));
+    memset(&pidProfile, 0, sizeof(pidProfile));
+    currentControlRateProfile = &controlRateProfile;
+    currentPidProfile = &pidProfile;
+    for (int i = 0; i < MAX_SUPPORTED_MOTORS; i++) {
+        motors[i].enabled = i < 4;
+        motor[i] = 1000 + i;
+    }
+    mspFcInit();
+}
+
+// every command without a payload, followed by commands with payloads and the replies they change
+static const mspRecordedPair_t recordedPairs[] = {
+    { 0, "", -1, "" },
+    { 1, "", 1, "000124" },
+    { 2, "", 1, "4254464c" },
+    { 3, "", 1, "030200" },
+    { 4, "", 1, "00000000000000" },
+    { 5, "", 1, "4a616e203031203230313730303a30303a30304d415354455200" },
+    { 6, "", -1, "" },
+    { 7, "", -1, "" },
+    { 8, "", -1, "" },
+    { 9, "", -1, "" },
+    { 10, "", 1, "" },
+    { 11, "", 1, "" },
+    { 12, "", -1, "" },
+    { 13, "", -1, "" },
+    { 14, "", -1, "" },
+    { 15, "", -1, "" },
+    { 16, "", -1, "" },
+    { 17, "", -1, "" },
+    { 18, "", -1, "" },
+    { 19, "", -1, "" },
+    { 20, "", -1, "" },
+    { 21, "", -1, "" },
+    { 22, "", -1, "" },
+    { 23, "", -1, "" },
+    { 24, "", -1, "" },
+    { 25, "", -1, "" },
+    { 26, "", -1, "" },
+    { 27, "", -1, "" },
+    { 28, "", -1, "" },
+    { 29, "", -1, "" },
+    { 30, "", -1, "" },
+    { 31, "", -1, "" },
+    { 32, "", 1, "00000000000000" },
+    { 33, "", 1, "" },
+    { 34, "", 1, "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000" },
+    { 35, "", 1, "" },
+    { 36, "", 1, "00000000" },
+    { 37, "", 1, "" },
+    { 38, "", 1, "000000000000" },
+    { 39, "", 1, "" },
+    { 40, "", 1, "01060a0100000000" },
+    { 41, "", 1, "" },
+    { 42, "", 1, "0000" },
+    { 43, "", 1, "" },
+    { 44, "", 1, "0000000000000000000000000000000000000000000000" },
+    { 45, "", 1, "" },
+    { 46, "", 1, "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000" },
+    { 47, "", 1, "" },
+    { 48, "", 1, "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000" },
+    { 49, "", -1, "" },
+    { 50, "", 1, "00" },
+    { 51, "", 1, "" },
+    { 52, "", 1, "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000" },
+    { 53, "", 1, "" },
+    { 54, "", 1, "" },
+    { 55, "", 1, "" },
+    { 56, "", 1, "01050a00000000" },
+    { 57, "", 1, "" },
+    { 58, "", 1, "00000000" },
+    { 59, "", 1, "01" },
+    { 60, "", 1, "" },
+    { 61, "", 1, "0000" },
+    { 62, "", 1, "" },
+    { 63, "", -1, "" },
+    { 64, "", 1, "0000000000000000" },
+    { 65, "", 1, "" },
+    { 66, "", 1, "00000000000000000000000000000000" },
+    { 67, "", 1, "" },
+    { 68, "", 1, "" },
+    { 69, "", -1, "" },
+    { 70, "", 1, "00000000000000000000000000" },
+    { 71, "", -1, "" },
+    { 72, "", -1, "" },
+    { 73, "", -1, "" },
+    { 74, "", -1, "" },
+    { 75, "", 1, "0000000000000000" },
+    { 76, "", 1, "" },
+    { 77, "", 1, "" },
+    { 78, "", 1, "" },
+    { 79, "", 1, "0000000000000000000000" },
+    { 80, "", 1, "010001010000" },
+    { 81, "", 1, "" },
+    { 82, "", 1, "0300000000000000" },
+    { 83, "", 1, "" },
+    { 84, "", 1, "0000" },
+    { 85, "", -1, "" },
+    { 86, "", -1, "" },
+    { 87, "", -1, "" },
+    { 88, "", -1, "" },
+    { 89, "", -1, "" },
+    { 90, "", 1, "00000000000000000000" },
+    { 91, "", 1, "" },
+    { 92, "", 1, "000000000000000000000000000000000000" },
+    { 93, "", 1, "" },
+    { 94, "", 1, "0000000000000000000000000000000000000000000000" },
+    { 95, "", 1, "" },
+    { 96, "", 1, "000000" },
+    { 97, "", 1, "" },
+    { 98, "", -1, "" },
+    { 99, "", -1, "" },
+    { 100, "", -1, "" },
+    { 101, "", 1, "000000000000000000000000000000001001000000" },
+    { 102, "", 1, "000000000000000000000000000000000000" },
+    { 103, "", 1, "00000000000000000000000000000000" },
+    { 104, "", 1, "e803e903ea03eb030000000000000000" },
+    { 105, "", 1, "" },
+    { 106, "", 1, "00000000000000000000000000000000" },
+    { 107, "", 1, "0000000000" },
+    { 108, "", 1, "000000000000" },
+    { 109, "", 1, "000000000000" },
+    { 110, "", 1, "6f000000006400" },
+    { 111, "", 1, "000000000000000000000000" },
+    { 112, "", 1, "000000000000000000000000000000000000000000000000000000000000" },
+    { 113, "", -1, "" },
+    { 114, "", -1, "" },
+    { 115, "", -1, "" },
+    { 116, "", 1, "41524d3b414e544920475241564954593b4245455045523b4f53442044495341424c452053573b424c41434b424f583b4641494c534146453b414952204d4f44453b46505620414e474c45204d49583b50524541524d3b" },
+    { 117, "", 1, "524f4c4c3b50495443483b5941573b414c543b506f733b506f73523b4e6176523b4c4556454c3b4d41473b56454c3b" },
+    { 118, "", 1, "000000000000000000000000000000000000" },
+    { 119, "", 1, "00040d131a1b1c1e24" },
+    { 120, "", 1, "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000" },
+    { 121, "", -1, "" },
+    { 122, "", -1, "" },
+    { 123, "", -1, "" },
+    { 124, "", 1, "000000000000" },
+    { 125, "", 1, "0000000000" },
+    { 126, "", 1, "000000" },
+    { 127, "", 1, "000000000100000200000300000400000500010000010100010200010300010400010500020000020100020200020300020400020500030000030100030200030300030400030500040000040100040200040300040400040500050000050100050200050300050400050500060000060100060200060300060400060500060600060700060800060900060a00070000" },
+    { 128, "", 1, "0a0032003c003d003e003f00" },
+    { 129, "", 1, "0a0000000032000000003c000000003d000000003e000000003f00000000" },
+    { 130, "", 1, "0300006f0000640000" },
+    { 131, "", 1, "000000000000" },
+    { 132, "", 1, "00000000" },
+    { 133, "", 1, "0000" },
+    { 134, "", 1, "d40000000d100209616c69676e5f6779726f00100a086779726f5f6c70660000010020006779726f5f73796e635f64656e6f6d001014036779726f5f6c6f77706173735f7479706500000000ff006779726f5f6c6f77706173735f687a00020000803e6779726f5f6e6f746368315f687a00020100803e6779726f5f6e6f746368315f6375746f666600020000803e6779726f5f6e6f746368325f687a00020100803e6779726f5f6e6f746368325f6375746f666600000000c8006d6f726f6e5f7468726573686f6c6400100209616c69676e5f61636300100c106163635f68617264776172650002000090016163635f6c70665f687a00" },
+    { 135, "", -1, "" },
+    { 136, "", 1, "0000bc00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000010000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000" },
+    { 137, "", 1, "" },
+    { 138, "", -1, "" },
+    { 139, "", -1, "" },
+    { 140, "", -1, "" },
+    { 141, "", -1, "" },
+    { 142, "", -1, "" },
+    { 143, "", -1, "" },
+    { 144, "", -1, "" },
+    { 145, "", -1, "" },
+    { 146, "", -1, "" },
+    { 147, "", -1, "" },
+    { 148, "", -1, "" },
+    { 149, "", -1, "" },
+    { 150, "", 1, "000000000000000000000000000300001001000000" },
+    { 151, "", -1, "" },
+    { 152, "", -1, "" },
+    { 153, "", -1, "" },
+    { 154, "", -1, "" },
+    { 155, "", -1, "" },
+    { 156, "", -1, "" },
+    { 157, "", -1, "" },
+    { 158, "", -1, "" },
+    { 159, "", -1, "" },
+    { 160, "", 1, "000000000100000002000000" },
+    { 161, "", -1, "" },
+    { 162, "", -1, "" },
+    { 163, "", -1, "" },
+    { 164, "", 1, "00" },
+    { 165, "", -1, "" },
+    { 166, "", -1, "" },
+    { 167, "", -1, "" },
+    { 168, "", -1, "" },
+    { 169, "", -1, "" },
+    { 170, "", -1, "" },
+    { 171, "", -1, "" },
+    { 172, "", -1, "" },
+    { 173, "", -1, "" },
+    { 174, "", -1, "" },
+    { 175, "", -1, "" },
+    { 176, "", -1, "" },
+    { 177, "", -1, "" },
+    { 178, "", -1, "" },
+    { 179, "", -1, "" },
+    { 180, "", -1, "" },
+    { 181, "", -1, "" },
+    { 182, "", -1, "" },
+    { 183, "", -1, "" },
+    { 184, "", 1, "00000000" },
+    { 185, "", 1, "" },
+    { 186, "", -1, "" },
+    { 187, "", -1, "" },
+    { 188, "", -1, "" },
+    { 189, "", -1, "" },
+    { 190, "", -1, "" },
+    { 191, "", -1, "" },
+    { 192, "", -1, "" },
+    { 193, "", -1, "" },
+    { 194, "", -1, "" },
+    { 195, "", -1, "" },
+    { 196, "", -1, "" },
+    { 197, "", -1, "" },
+    { 198, "", -1, "" },
+    { 199, "", -1, "" },
+    { 200, "", 1, "" },
+    { 201, "", 1, "" },
+    { 202, "", 1, "" },
+    { 203, "", -1, "" },
+    { 204, "", -1, "" },
+    { 205, "", 1, "" },
+    { 206, "", 1, "" },
+    { 207, "", -1, "" },
+    { 208, "", 1, "" },
+    { 209, "", 1, "" },
+    { 210, "", 1, "" },
+    { 211, "", 1, "" },
+    { 212, "", -1, "" },
+    { 213, "", -1, "" },
+    { 214, "", 1, "" },
+    { 215, "", -1, "" },
+    { 216, "", -1, "" },
+    { 217, "", 1, "" },
+    { 218, "", 1, "" },
+    { 219, "", 1, "" },
+    { 220, "", 1, "" },
+    { 221, "", 1, "" },
+    { 222, "", 1, "" },
+    { 223, "", 1, "" },
+    { 224, "", 1, "" },
+    { 225, "", 1, "" },
+    { 226, "", 1, "" },
+    { 227, "", -1, "" },
+    { 228, "", -1, "" },
+    { 229, "", -1, "" },
+    { 230, "", -1, "" },
+    { 231, "", -1, "" },
+    { 232, "", -1, "" },
+    { 233, "", -1, "" },
+    { 234, "", -1, "" },
+    { 235, "", -1, "" },
+    { 236, "", -1, "" },
+    { 237, "", -1, "" },
+    { 238, "", -1, "" },
+    { 239, "", 1, "" },
+    { 240, "", 1, "00000000" },
+    { 241, "", 1, "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000" },
+    { 242, "", 1, "" },
+    { 243, "", -1, "" },
+    { 244, "", -1, "" },
+    { 245, "", -1, "" },
+    { 246, "", -1, "" },
+    { 247, "", -1, "" },
+    { 248, "", -1, "" },
+    { 249, "", -1, "" },
+    { 250, "", 1, "" },
+    { 251, "", -1, "" },
+    { 252, "", -1, "" },
+    { 253, "", -1, "" },
+    { 254, "", 1, "0000000000000000" },
+    { 255, "", -1, "" },
+    { 204, "46460028320a1400000a3c", 1, "" },
+    { 111, "", 1, "46460028320a1400000a3c00" },
+    { 202, "2832142933152a34162b35172c36182d37192e381a2f391b303a1c313b1d", 1, "" },
+    { 112, "", 1, "2832142933152a34162b35172c36182d37192e381a2f391b303a1c313b1d" },
+    { 116, "01", 1, "" },
+    { 119, "01", 1, "" },
+    { 134, "0500", 1, "d40005000d020000803e6779726f5f6e6f746368315f687a00020100803e6779726f5f6e6f746368315f6375746f666600020000803e6779726f5f6e6f746368325f687a00020100803e6779726f5f6e6f746368325f6375746f666600000000c8006d6f726f6e5f7468726573686f6c6400100209616c69676e5f61636300100c106163635f68617264776172650002000090016163635f6c70665f687a0003d4fe2c016163635f7472696d5f70697463680003d4fe2c016163635f7472696d5f726f6c6c00100209616c69676e5f6d616700100e056d61675f68617264776172650003b0b950466d61675f6465636c696e6174696f6e00" },
+    { 135, "0001", 1, "000201014f4e00" },
+    { 135, "", -1, "" },
+    { 135, "ff", -1, "" },
+    { 136, "0300", 1, "0300bc00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000010000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000" },
+    { 225, "000001", 1, "" },
+    { 136, "0000", 1, "0000bc00010000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000010000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000" },
+    { 225, "0000ff", -1, "" },
+    { 225, "0f27", -1, "" },
+    { 214, "dc05dd05de05df050000000000000000", 1, "" },
+    { 104, "", 1, "e803e903ea03eb030000000000000000" },
+    { 35, "0001000408", 1, "" },
+    { 34, "", 1, "0100040800000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000" },
+    { 118, "00", 1, "000000000000000000000000000000000000" },
+    { 118, "10", 1, "100000000000000000000000000000000000" },
+};
+
+TEST(MspUnittest, TestRecordedPairs)
+{
+    static char reply[2 * MSP_PORT_OUTBUF_SIZE + 1];
+    resetState();
+
+    for (unsigned i = 0; i < ARRAYLEN(recordedPairs); i++) {
+        const mspRecordedPair_t *pair = &recordedPairs[i];
+        const mspResult_e result = processCommand(pair->cmd, pair->request, reply);
+        EXPECT_EQ(pair->result, result) << "cmd " << (int)pair->cmd << " request " << pair->request;
+        EXPECT_STREQ(pair->reply, reply) << "cmd " << (int)pair->cmd << " request " << pair->request;
+    }
+}
+
+TEST(MspUnittest, TestArmedCommandsAreRejected)
+{
+    static char reply[2 * MSP_PORT_OUTBUF_SIZE + 1];
+    resetState();
+
+    ENABLE_ARMING_FLAG(ARMED);
+    EXPECT_EQ(MSP_RESULT_ERROR, processCommand(MSP_EEPROM_WRITE, "", reply));
+    EXPECT_EQ(MSP_RESULT_ERROR, processCommand(MSP_SET_SETTINGS_VALUES, "000001", reply));
+    EXPECT_EQ(MSP_RESULT_ACK, processCommand(MSP_STATUS, "", reply));
+    DISABLE_ARMING_FLAG(ARMED);
+    EXPECT_EQ(MSP_RESULT_ACK, processCommand(MSP_EEPROM_WRITE, "", reply));
+}
+
+TEST(MspUnittest, TestSetSettingsValuesActivatesConfig)
+{
+    static char reply[2 * MSP_PORT_OUTBUF_SIZE + 1];
+    resetState();
+    configActivations = 0;
+
+    EXPECT_EQ(MSP_RESULT_ERROR, processCommand(MSP_SET_SETTINGS_VALUES, "0000ff", reply));
+    EXPECT_EQ(0, configActivations);
+    EXPECT_EQ(MSP_RESULT_ACK, processCommand(MSP_SET_SETTINGS_VALUES, "000001", reply));
+    EXPECT_EQ(1, configActivations);
+}
+
+static void processStreamSchedule(timeUs_t timeUs)
+{
+    currentTimeUs = timeUs;
+    mspSerialProcessStreamSchedule(currentTimeUs);
+}
+
+TEST(MspUnittest, TestStreamSchedule)
+{
+    static char reply[2 * MSP_PORT_OUTBUF_SIZE + 1];
+    resetState();
+    streamBursts.clear();
+    streamPushFits = true;
+    currentTimeUs = 1000000;
+
+    // MSP_ATTITUDE every 20ms and MSP_ANALOG every 100ms
+    EXPECT_EQ(MSP_RESULT_ACK, processCommand(MSP_SET_STREAM_SCHEDULE, "6c14006e6400", reply));
+    ASSERT_NE((mspPostProcessFnPtr)NULL, postProcessFn);
+    postProcessFn(&streamPort);
+    EXPECT_TRUE(streamTaskEnabled);
+    EXPECT_EQ(MSP_RESULT_ACK, processCommand(MSP_STREAM_SCHEDULE, "", reply));
+    EXPECT_STREQ("6c14006e6400", reply);
+
+    // both are due at once and share a burst
+    processStreamSchedule(1000000);
+    processStreamSchedule(1010000);
+    processStreamSchedule(1020000);
+    ASSERT_EQ(2U, streamBursts.size());
+    EXPECT_EQ("108 110 ", streamBursts[0]);
+    EXPECT_EQ("108 ", streamBursts[1]);
+
+    // a burst that does not fit into the transmit buffer is retried
+    streamPushFits = false;
+    processStreamSchedule(1040000);
+    streamPushFits = true;
+    processStreamSchedule(1050000);
+    processStreamSchedule(1060000);
+    processStreamSchedule(1080000);
+    processStreamSchedule(1100000);
+    ASSERT_EQ(6U, streamBursts.size());
+    EXPECT_EQ("108 ", streamBursts[2]);
+    EXPECT_EQ("108 ", streamBursts[3]);
+    EXPECT_EQ("108 ", streamBursts[4]);
+    EXPECT_EQ("108 110 ", streamBursts[5]);
+
+    // a reply larger than the burst buffer is pushed on its own, MSP_MODE_RANGES has 80 bytes
+    streamBursts.clear();
+    EXPECT_EQ(MSP_RESULT_ACK, processCommand(MSP_SET_STREAM_SCHEDULE, "6c1400221400", reply));
+    postProcessFn(&streamPort);
+    processStreamSchedule(1110000);
+    processStreamSchedule(1130000);
+    ASSERT_EQ(4U, streamBursts.size());
+    EXPECT_EQ("34 ", streamBursts[0]);
+    EXPECT_EQ("108 ", streamBursts[1]);
+    EXPECT_EQ("34 ", streamBursts[2]);
+    EXPECT_EQ("108 ", streamBursts[3]);
+    streamBursts.clear();
+    EXPECT_EQ(MSP_RESULT_ACK, processCommand(MSP_SET_STREAM_SCHEDULE, "6c14006e6400", reply));
+    postProcessFn(&streamPort);
+
+    // a schedule with commands that need a payload or that change the state is rejected as a whole
+    EXPECT_EQ(MSP_RESULT_ERROR, processCommand(MSP_SET_STREAM_SCHEDULE, "6c1400ca1400", reply));
+    EXPECT_EQ(MSP_RESULT_ERROR, processCommand(MSP_SET_STREAM_SCHEDULE, "741400", reply));
+    EXPECT_EQ(MSP_RESULT_ERROR, processCommand(MSP_SET_STREAM_SCHEDULE, "441400", reply)); // MSP_REBOOT
+    EXPECT_EQ(MSP_RESULT_ERROR, processCommand(MSP_SET_STREAM_SCHEDULE, "6c0000", reply));
+    EXPECT_EQ(MSP_RESULT_ERROR, processCommand(MSP_SET_STREAM_SCHEDULE, "6c14", reply));
+    EXPECT_EQ(MSP_RESULT_ERROR, processCommand(MSP_SET_STREAM_SCHEDULE, "6c14006c14006c14006c14006c14006c14006c14006c14006c1400", reply));
+    EXPECT_EQ(MSP_RESULT_ACK, processCommand(MSP_STREAM_SCHEDULE, "", reply));
+    EXPECT_STREQ("6c14006e6400", reply);
+
+    // an empty schedule stops the pushes
+    EXPECT_EQ(MSP_RESULT_ACK, processCommand(MSP_SET_STREAM_SCHEDULE, "", reply));
+    postProcessFn(&streamPort);
+    EXPECT_FALSE(streamTaskEnabled);
+    processStreamSchedule(1200000);
+    EXPECT_EQ(0U, streamBursts.size());
+}
+
+// STUBS
+
+extern "C" {
+    const char * const buildDate = "Jan 01 2017";
+    const char * const buildTime = "00:00:00";
+    const char * const shortGitRevision = "MASTER";
+    const char * const debugModeNames[DEBUG_COUNT] = { "NONE" };
+
+    const uint8_t currentMeterIds[] = {
+        CURRENT_METER_ID_BATTERY_1,
+        CURRENT_METER_ID_ESC_COMBINED_1,
+        CURRENT_METER_ID_ESC_MOTOR_1, CURRENT_METER_ID_ESC_MOTOR_2, CURRENT_METER_ID_ESC_MOTOR_3,
+        CURRENT_METER_ID_ESC_MOTOR_4, CURRENT_METER_ID_ESC_MOTOR_5, CURRENT_METER_ID_ESC_MOTOR_6,
+        CURRENT_METER_ID_ESC_MOTOR_7, CURRENT_METER_ID_ESC_MOTOR_8, CURRENT_METER_ID_ESC_MOTOR_9,
+        CURRENT_METER_ID_ESC_MOTOR_10, CURRENT_METER_ID_ESC_MOTOR_11, CURRENT_METER_ID_ESC_MOTOR_12,
+    };
+    const uint8_t supportedCurrentMeterCount = ARRAYLEN(currentMeterIds);
+    const uint8_t voltageMeterIds[] = {
+        VOLTAGE_METER_ID_BATTERY_1,
+        VOLTAGE_METER_ID_ESC_COMBINED_1,
+        VOLTAGE_METER_ID_ESC_MOTOR_1, VOLTAGE_METER_ID_ESC_MOTOR_2, VOLTAGE_METER_ID_ESC_MOTOR_3,
+        VOLTAGE_METER_ID_ESC_MOTOR_4, VOLTAGE_METER_ID_ESC_MOTOR_5, VOLTAGE_METER_ID_ESC_MOTOR_6,
+        VOLTAGE_METER_ID_ESC_MOTOR_7, VOLTAGE_METER_ID_ESC_MOTOR_8, VOLTAGE_METER_ID_ESC_MOTOR_9,
+        VOLTAGE_METER_ID_ESC_MOTOR_10, VOLTAGE_METER_ID_ESC_MOTOR_11, VOLTAGE_METER_ID_ESC_MOTOR_12,
+    };
+    const uint8_t supportedVoltageMeterCount = ARRAYLEN(voltageMeterIds);
+    const uint8_t voltageMeterADCtoIDMap[MAX_VOLTAGE_SENSOR_ADC] = { VOLTAGE_METER_ID_BATTERY_1 };
+    const transponderRequirement_t transponderRequirements[TRANSPONDER_PROVIDER_COUNT] = {};
+
+    void accSetCalibrationCycles(uint16_t) {}
+    void activateConfig(void) { configActivations++; }
+    void beeperOffClearAll(void) {}
+    int blackboxCalculatePDenom(int, int) { return 1; }
+    uint8_t blackboxGetRateDenom(void) { return 1; }
+    uint8_t blackboxGetRateNum(void) { return 1; }
+    bool blackboxMayEditConfig(void) { return true; }
+    void changeControlRateProfile(uint8_t) {}
+    void changePidProfile(uint8_t) {}
+    float convertExternalToMotor(uint16_t externalValue) { return externalValue; }
+    uint16_t convertMotorToExternal(float motorValue) { return motorValue; }
+    void currentMeterRead(currentMeterId_e, currentMeter_t *currentMeter) { memset(currentMeter, 0, sizeof(*currentMeter)); }
+    uint16_t disableFlightMode(flightModeFlags_e) { return 0; }
+    void generateRateCurves(void) {}
+    void generateThrottleCurve(void) {}
+    int32_t getAmperage(void) { return 100; }
+    armingDisableFlags_e getArmingDisableFlags(void) { return ARMING_DISABLED_NO_GYRO; }
+    uint8_t getBatteryCellCount(void) { return 3; }
+    batteryState_e getBatteryState(void) { return BATTERY_OK; }
+    uint16_t getBatteryVoltage(void) { return 111; }
+    uint32_t getBeeperOffMask(void) { return 0; }
+    uint8_t getCurrentControlRateProfileIndex(void) { return 0; }
+    uint8_t getCurrentPidProfileIndex(void) { return 0; }
+    int32_t getEstimatedAltitude(void) { return 0; }
+    int32_t getEstimatedVario(void) { return 0; }
+    int32_t getMAhDrawn(void) { return 0; }
+    uint8_t getMotorCount() { return 4; }
+    timeDelta_t getTaskDeltaTime(cfTaskId_e) { return 0; }
+    void gyroInitFilters(void) {}
+    int16_t gyroRateDps(int) { return 0; }
+    bool isMotorProtocolDshot(void) { return false; }
+    void loadCustomServoMixer(void) {}
+    void pidInitConfig(const pidProfile_t *) {}
+    void pidChangeProfile(const pidProfile_t *) {}
+    pwmOutputPort_t *pwmGetMotors(void) { return motors; }
+    void readEEPROM(void) {}
+    void reevaluateLedConfig(void) {}
+    void resetEEPROM(void) {}
+    void resetPidProfile(pidProfile_t *) {}
+    void rxMspFrameReceive(uint16_t *, int) {}
+    serialPortConfig_t *serialFindPortConfiguration(serialPortIdentifier_e) { return NULL; }
+    bool serialIsPortAvailable(serialPortIdentifier_e) { return false; }
+    void setBeeperOffMask(uint32_t) {}
+    bool setModeColor(ledModeIndex_e, int, int) { return true; }
+    void stopPwmAllMotors(void) {}
+    void systemReset(void) {}
+    void transponderStopRepeating(void) {}
+    void transponderUpdateData(void) {}
+    void useRcControlsConfig(pidProfile_t *) {}
+    void validateAndFixGyroConfig(void) {}
+    void voltageMeterRead(voltageMeterId_e, voltageMeter_t *voltageMeter) { memset(voltageMeter, 0, sizeof(*voltageMeter)); }
+    void writeEEPROM() {}
+    void GPS_set_next_wp(int32_t *, int32_t *) {}
+    bool IS_RC_MODE_ACTIVE(boxId_e) { return false; }
+    bool sensors(uint32_t) { return false; }
+
+    timeUs_t micros(void) { return currentTimeUs; }
+    void setTaskEnabled(cfTaskId_e taskId, bool enabled)
+    {
+        if (taskId == TASK_MSP_STREAM) {
+            streamTaskEnabled = enabled;
+        }
+    }
+
+    int mspSerialPushPackets(serialPort_t *serialPort, mspPacket_t *packets, int packetCount)
+    {
+        EXPECT_EQ(&streamPort, serialPort);
+        if (!streamPushFits) {
+            return 0;
+        }
+        std::string burst;
+        for (int i = 0; i < packetCount; i++) {
+            EXPECT_EQ(MSP_DIRECTION_REPLY, packets[i].direction);
+            EXPECT_LT(0, sbufBytesRemaining(&packets[i].buf));
+            burst += std::to_string(packets[i].cmd) + " ";
+        }
+        streamBursts.push_back(burst);
+        return 1;
+    }
+}
@@ -34,11 +34,21 @@ extern "C" {
 PG_REGISTER_WITH_RESET_TEMPLATE(motorConfig_t, motorConfig, PG_MOTOR_CONFIG, 1);
 
 PG_RESET_TEMPLATE(motorConfig_t, motorConfig,
+    .dev = {.motorPwmRate = 400},
     .minthrottle = 1150,
     .maxthrottle = 1850,
     .mincommand = 1000,
-    .dev = {.motorPwmRate = 400}
 );
+
+typedef struct testConfig_s {
+    uint8_t value;
+} testConfig_t;
+
+// registered out of pgn order, on both sides of PG_MOTOR_CONFIG
+PG_REGISTER(testConfig_t, testConfig1, PG_RESERVED_FOR_TESTING_1, 0);
+PG_REGISTER(testConfig_t, testConfig3, PG_RESERVED_FOR_TESTING_3, 0);
+PG_REGISTER(testConfig_t, testConfig2, PG_RESERVED_FOR_TESTING_2, 0);
+PG_REGISTER(testConfig_t, failsafeConfig, PG_FAILSAFE_CONFIG, 0);
 }
 
 
@@ -83,6 +93,24 @@ TEST(ParameterGroupsfTest, Test_pgFind)
     EXPECT_EQ(400, motorConfig3.dev.motorPwmRate);
 }
 
+TEST(ParameterGroupsfTest, Test_pgFindEveryRegisteredGroup)
+{
+    EXPECT_EQ(5, PG_REGISTRY_SIZE);
+    PG_FOREACH(reg) {
+        EXPECT_EQ(reg, pgFind(pgN(reg)));
+    }
+    EXPECT_EQ(&motorConfig_Registry, pgFind(PG_MOTOR_CONFIG));
+    EXPECT_EQ(&testConfig2_Registry, pgFind(PG_RESERVED_FOR_TESTING_2));
+}
+
+TEST(ParameterGroupsfTest, Test_pgFindUnregisteredGroup)
+{
+    EXPECT_EQ(NULL, pgFind(0));
+    EXPECT_EQ(NULL, pgFind(PG_GYRO_CONFIG));
+    EXPECT_EQ(NULL, pgFind(PG_RESERVED_FOR_TESTING_3 - 1));
+    EXPECT_FALSE(pgResetCopy(NULL, PG_GYRO_CONFIG));
+}
+
 // STUBS
 
 extern "C" {
@@ -0,0 +1,146 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <cmath>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/axis.h"
+    #include "common/filter.h"
+    #include "common/maths.h"
+
+    #include "config/parameter_group.h"
+    #include "config/parameter_group_ids.h"
+
+    #include "fc/config.h"
+    #include "fc/runtime_config.h"
+
+    #include "flight/imu.h"
+    #include "flight/navigation.h"
+    #include "flight/pid.h"
+
+    #include "sensors/acceleration.h"
+    #include "sensors/gyro.h"
+    #include "sensors/sensors.h"
+
+    extern float axisPID_P[3], axisPID_I[3], axisPID_D[3];
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define GYRO_RATE 100.0f // deg/s, held while the setpoint is zero
+
+static pidProfile_t profileA;
+static pidProfile_t profileB;
+static rollAndPitchTrims_t angleTrim;
+static timeUs_t currentTimeUs;
+
+static void runPidLoops(const pidProfile_t *pidProfile, int count)
+{
+    for (int i = 0; i < count; i++) {
+        currentTimeUs += targetPidLooptime;
+        pidController(pidProfile, &angleTrim, currentTimeUs);
+    }
+}
+
+class PidProfileChangeTest : public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        resetPidProfile(&profileA);
+        resetPidProfile(&profileB);
+        profileB.pid[PID_ROLL].P = 80;
+        profileB.pid[PID_ROLL].I = 20;
+        profileB.dterm_lpf_hz = 50;
+
+        gyro.targetLooptime = 125;
+        pidConfigMutable()->pid_process_denom = 2;
+        gyro.gyroADCf[FD_ROLL] = GYRO_RATE;
+
+        pidResetErrorGyroState();
+        pidStabilisationState(PID_STABILISATION_ON);
+        pidInit(&profileA);
+
+        // long enough for the D term filters to settle on the constant gyro rate
+        runPidLoops(&profileA, 2000);
+    }
+};
+
+TEST_F(PidProfileChangeTest, TestSwapKeepsState)
+{
+    const float dT = targetPidLooptime * 0.000001f;
+    EXPECT_NEAR(0, axisPID_D[FD_ROLL], 0.01f);
+
+    // nothing changes until the coefficients are computed
+    pidChangeProfile(&profileB);
+    EXPECT_TRUE(pidProfileChangePending());
+    runPidLoops(&profileA, 1);
+    EXPECT_FLOAT_EQ(PTERM_SCALE * profileA.pid[PID_ROLL].P * -GYRO_RATE, axisPID_P[FD_ROLL]);
+
+    pidProcessProfileChange();
+    EXPECT_FALSE(pidProfileChangePending());
+    const float ITermBefore = axisPID_I[FD_ROLL];
+    runPidLoops(&profileB, 1);
+
+    // the new gains are used from the next iteration on
+    EXPECT_FLOAT_EQ(PTERM_SCALE * profileB.pid[PID_ROLL].P * -GYRO_RATE, axisPID_P[FD_ROLL]);
+    // the integrator carries on from where it was
+    EXPECT_NEAR(ITermBefore + ITERM_SCALE * profileB.pid[PID_ROLL].I * -GYRO_RATE * dT, axisPID_I[FD_ROLL], 0.01f);
+    // the lowpass keeps its state and only the coefficients change, a filter starting from zero would see
+    // the gyro rate jump from 0 to 100deg/s in one iteration
+    EXPECT_LT(fabsf(axisPID_D[FD_ROLL]), 50.0f);
+}
+
+TEST_F(PidProfileChangeTest, TestNewFilterTypeStartsFromZero)
+{
+    profileB.dterm_filter_type = FILTER_PT1;
+    pidChangeProfile(&profileB);
+    pidProcessProfileChange();
+    runPidLoops(&profileB, 1);
+
+    // the pt1 has no history to keep, the D term sees the step of its output
+    EXPECT_GT(fabsf(axisPID_D[FD_ROLL]), 1000.0f);
+
+    runPidLoops(&profileB, 2000);
+    EXPECT_NEAR(0, axisPID_D[FD_ROLL], 0.01f);
+}
+
+// STUBS
+
+extern "C" {
+
+uint8_t armingFlags;
+uint16_t flightModeFlags;
+attitudeEulerAngles_t attitude;
+gyro_t gyro;
+int16_t GPS_angle[ANGLE_INDEX_COUNT];
+
+bool sensors(uint32_t) { return false; }
+void systemBeep(bool) {}
+
+float getSetpointRate(int) { return 0; }
+float getRcDeflection(int) { return 0; }
+float getRcDeflectionAbs(int) { return 0; }
+float getThrottlePIDAttenuation(void) { return 1.0f; }
+float getMotorMixRange(void) { return 0; }
+bool mixerIsOutputSaturated(int, float) { return false; }
+void pidInitMixer(const struct pidProfile_s *) {}
+
+}
@@ -671,6 +671,7 @@ TEST_F(RcControlsAdjustmentsTest, processPIDIncreasePidController2)
 extern "C" {
 void saveConfigAndNotify(void) {}
 void generateThrottleCurve(void) {}
+void generateRateCurves(void) {}
 void changePidProfile(uint8_t) {}
 void pidInitConfig(const pidProfile_t *) {}
 void accSetCalibrationCycles(uint16_t) {}
@@ -44,6 +44,7 @@ extern "C" {
     extern uint32_t crsfChannelData[CRSF_MAX_CHANNEL];
 
     uint32_t dummyTimeUs;
+    int telemetryBytesWritten;
 }
 
 #include "unittest_macros.h"
@@ -269,6 +270,28 @@ TEST(CrossFireTest, TestCrsfDataReceive)
     EXPECT_EQ(crc, crsfFrame.frame.payload[CRSF_FRAME_RC_CHANNELS_PAYLOAD_SIZE]);
 }
 
+TEST(CrossFireTest, TestTelemetrySentAfterRcFrame)
+{
+    const uint8_t telemetry[] = { CRSF_ADDRESS_BROADCAST, 2, 0x21, 0x00 };
+    crsfRxWriteTelemetryData(telemetry, sizeof(telemetry));
+    // only one frame can be pending
+    EXPECT_EQ(NULL, crsfRxBeginTelemetryFrame());
+
+    telemetryBytesWritten = 0;
+    dummyTimeUs += 10000; // start a new RX frame
+    const uint8_t *pData = capturedData;
+    for (unsigned int ii = 0; ii < sizeof(crsfRcChannelsFrame_t) - 1; ++ii) {
+        crsfDataReceive(*pData++);
+    }
+    EXPECT_EQ(0, telemetryBytesWritten);
+
+    // the last byte of the RC frame opens the telemetry slot
+    crsfDataReceive(*pData++);
+    EXPECT_EQ(true, crsfFrameDone);
+    EXPECT_EQ((int)sizeof(telemetry), telemetryBytesWritten);
+    EXPECT_NE((uint8_t *)NULL, crsfRxBeginTelemetryFrame());
+}
+
 // STUBS
 
 extern "C" {
@@ -277,7 +300,9 @@ int16_t debug[DEBUG16_VALUE_COUNT];
 uint32_t micros(void) {return dummyTimeUs;}
 serialPort_t *openSerialPort(serialPortIdentifier_e, serialPortFunction_e, serialReceiveCallbackPtr, uint32_t, portMode_e, portOptions_e) {return NULL;}
 serialPortConfig_t *findSerialPortConfig(serialPortFunction_e ) {return NULL;}
-void serialWriteBuf(serialPort_t *, const uint8_t *, int) {}
+void serialWriteBuf(serialPort_t *, const uint8_t *, int count) {telemetryBytesWritten += count;}
+uint8_t *serialTxReserve(serialPort_t *, int) {return NULL;}
+void serialTxCommit(serialPort_t *, int) {}
 bool telemetryCheckRxPortShared(const serialPortConfig_t *) {return false;}
 serialPort_t *telemetrySharedPort = NULL;
 }
@@ -0,0 +1,166 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <math.h>
+#include <string.h>
+
+extern "C" {
+    #include "target/SITL/quadmodel.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define GRAVITY 9.80665
+#define DT 0.001
+
+static quadModelConfig_t noiseFreeConfig(void)
+{
+    quadModelConfig_t config;
+    quadModelConfigDefaults(&config);
+    config.gyroNoise = 0;
+    config.accNoise = 0;
+    return config;
+}
+
+static void run(quadModel_t *model, const float *motors, double seconds)
+{
+    for (int i = 0; i < lrint(seconds / DT); i++) {
+        quadModelStep(model, motors, DT);
+    }
+}
+
+TEST(SitlQuadModelUnittest, TestRestingOnGround)
+{
+    const quadModelConfig_t config = noiseFreeConfig();
+    quadModel_t model;
+    quadModelInit(&model, &config);
+
+    const float motors[4] = { 0.1f, 0.1f, 0.1f, 0.1f };
+    run(&model, motors, 1);
+
+    // too little thrust to lift off, the accelerometer reads 1G up
+    EXPECT_DOUBLE_EQ(0, model.position[2]);
+    EXPECT_NEAR(0, model.acc[0], 1e-9);
+    EXPECT_NEAR(0, model.acc[1], 1e-9);
+    EXPECT_NEAR(-GRAVITY, model.acc[2], 1e-9);
+    EXPECT_NEAR(1, model.time, 1e-9);
+}
+
+TEST(SitlQuadModelUnittest, TestFreeFall)
+{
+    quadModelConfig_t config = noiseFreeConfig();
+    config.linearDrag = 0;
+    quadModel_t model;
+    quadModelInit(&model, &config);
+    model.position[2] = -100;
+
+    const float motors[4] = { 0, 0, 0, 0 };
+    run(&model, motors, 1);
+
+    // weightless
+    EXPECT_NEAR(-100 + 0.5 * GRAVITY, model.position[2], 0.01);
+    EXPECT_NEAR(GRAVITY, model.velocity[2], 1e-9);
+    EXPECT_NEAR(0, model.acc[2], 1e-9);
+}
+
+TEST(SitlQuadModelUnittest, TestHover)
+{
+    const quadModelConfig_t config = noiseFreeConfig();
+    quadModel_t model;
+    quadModelInit(&model, &config);
+    model.position[2] = -10;
+
+    const float hover = sqrt(config.mass * GRAVITY / (4 * config.maxThrust));
+    const float motors[4] = { hover, hover, hover, hover };
+    // let the motors spin up first
+    for (int i = 0; i < 4; i++) {
+        model.motorSpeed[i] = hover;
+    }
+    run(&model, motors, 2);
+
+    EXPECT_NEAR(-10, model.position[2], 1e-6);
+    EXPECT_NEAR(-GRAVITY, model.acc[2], 1e-6);
+    EXPECT_NEAR(0, model.rate[0], 1e-9);
+    EXPECT_NEAR(0, model.rate[1], 1e-9);
+    EXPECT_NEAR(0, model.rate[2], 1e-9);
+}
+
+TEST(SitlQuadModelUnittest, TestTorqueDirections)
+{
+    const quadModelConfig_t config = noiseFreeConfig();
+    quadModel_t model;
+
+    // rear right, front right, rear left, front left
+    const float rollRight[4] = { 0.4f, 0.4f, 0.6f, 0.6f };
+    quadModelInit(&model, &config);
+    model.position[2] = -10;
+    run(&model, rollRight, 0.05);
+    EXPECT_GT(model.rate[0], 0.1);
+    EXPECT_LT(fabs(model.rate[1]), 1e-9);
+
+    const float pitchUp[4] = { 0.4f, 0.6f, 0.4f, 0.6f };
+    quadModelInit(&model, &config);
+    model.position[2] = -10;
+    run(&model, pitchUp, 0.05);
+    EXPECT_GT(model.rate[1], 0.1);
+    EXPECT_LT(fabs(model.rate[0]), 1e-9);
+
+    // rear right and front left spin clockwise, the frame turns the other way
+    const float yawLeft[4] = { 0.6f, 0.4f, 0.4f, 0.6f };
+    quadModelInit(&model, &config);
+    model.position[2] = -10;
+    run(&model, yawLeft, 0.05);
+    EXPECT_LT(model.rate[2], -0.1);
+    EXPECT_LT(fabs(model.rate[0]), 1e-9);
+    EXPECT_LT(fabs(model.rate[1]), 1e-9);
+}
+
+TEST(SitlQuadModelUnittest, TestNoiseIsReproducible)
+{
+    quadModelConfig_t config;
+    quadModelConfigDefaults(&config);
+    quadModel_t model1, model2;
+    quadModelInit(&model1, &config);
+    quadModelInit(&model2, &config);
+
+    const float motors[4] = { 0, 0, 0, 0 };
+    run(&model1, motors, 0.1);
+    run(&model2, motors, 0.1);
+    EXPECT_EQ(0, memcmp(model1.gyro, model2.gyro, sizeof(model1.gyro)));
+    EXPECT_EQ(0, memcmp(model1.acc, model2.acc, sizeof(model1.acc)));
+
+    // noisy but centred on the true value
+    double sum = 0;
+    double sumSquares = 0;
+    const int samples = 10000;
+    for (int i = 0; i < samples; i++) {
+        quadModelStep(&model1, motors, DT);
+        sum += model1.gyro[0];
+        sumSquares += model1.gyro[0] * model1.gyro[0];
+    }
+    EXPECT_NEAR(0, sum / samples, config.gyroNoise * 0.05);
+    EXPECT_NEAR(config.gyroNoise, sqrt(sumSquares / samples), config.gyroNoise * 0.05);
+
+    config.seed = 2;
+    quadModelInit(&model2, &config);
+    run(&model2, motors, 0.1);
+    EXPECT_NE(0, memcmp(model1.gyro, model2.gyro, sizeof(model1.gyro)));
+}
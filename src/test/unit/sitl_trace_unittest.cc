@@ -0,0 +1,124 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+extern "C" {
+    #include "target/SITL/trace.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define TRACE_FILE "sitl_trace_unittest.bin"
+
+static traceRecord_t record;
+
+static void writeTestTrace(void)
+{
+    uint8_t eeprom[TRACE_MAX_LENGTH];
+    memset(eeprom, 0xa5, sizeof(eeprom));
+    const double fdm[17] = { 0.001, 0.1, 0.2, 0.3 };
+    const uint8_t msp[] = { '$', 'M', '<', 0, 101, 101 };
+
+    ASSERT_TRUE(traceOpenRecord(TRACE_FILE));
+    EXPECT_TRUE(traceIsRecording());
+    traceWrite(TRACE_EEPROM, 0, 0, eeprom, sizeof(eeprom));
+    traceWrite(TRACE_SERIAL, 2, 1500, msp, sizeof(msp));
+    traceWrite(TRACE_FDM, 0, 1500, fdm, sizeof(fdm));
+    traceWrite(TRACE_MOTOR, 0, 5000000000ULL, fdm, 16); // past 32 bits of microseconds
+    traceClose();
+    EXPECT_FALSE(traceIsRecording());
+}
+
+TEST(SitlTraceUnittest, TestRoundTrip)
+{
+    writeTestTrace();
+
+    ASSERT_TRUE(traceOpenReplay(TRACE_FILE));
+    EXPECT_TRUE(traceIsReplaying());
+
+    ASSERT_TRUE(traceRead(&record));
+    EXPECT_EQ(TRACE_EEPROM, record.type);
+    EXPECT_EQ(TRACE_MAX_LENGTH, record.length);
+    EXPECT_EQ(0xa5, record.data[TRACE_MAX_LENGTH - 1]);
+
+    ASSERT_TRUE(traceRead(&record));
+    EXPECT_EQ(TRACE_SERIAL, record.type);
+    EXPECT_EQ(2, record.port);
+    EXPECT_EQ(6, record.length);
+    EXPECT_EQ(1500u, record.timeUs);
+    EXPECT_EQ(101, record.data[4]);
+
+    ASSERT_TRUE(traceRead(&record));
+    EXPECT_EQ(TRACE_FDM, record.type);
+    EXPECT_EQ(17 * sizeof(double), record.length);
+    EXPECT_EQ(1500u, record.timeUs);
+    double fdm[17];
+    memcpy(fdm, record.data, sizeof(fdm));
+    EXPECT_DOUBLE_EQ(0.3, fdm[3]);
+
+    ASSERT_TRUE(traceRead(&record));
+    EXPECT_EQ(TRACE_MOTOR, record.type);
+    EXPECT_EQ(5000000000ULL, record.timeUs);
+
+    EXPECT_FALSE(traceRead(&record));
+    traceClose();
+    EXPECT_FALSE(traceIsReplaying());
+    unlink(TRACE_FILE);
+}
+
+TEST(SitlTraceUnittest, TestTruncatedTrace)
+{
+    writeTestTrace();
+
+    // cut into the last record, as a crash while writing would
+    FILE *file = fopen(TRACE_FILE, "r+");
+    ASSERT_TRUE(file != NULL);
+    fseek(file, 0, SEEK_END);
+    ASSERT_EQ(0, ftruncate(fileno(file), ftell(file) - 4));
+    fclose(file);
+
+    ASSERT_TRUE(traceOpenReplay(TRACE_FILE));
+    int count = 0;
+    while (traceRead(&record)) {
+        count++;
+    }
+    EXPECT_EQ(3, count);
+    traceClose();
+    unlink(TRACE_FILE);
+}
+
+TEST(SitlTraceUnittest, TestNotATrace)
+{
+    FILE *file = fopen(TRACE_FILE, "w");
+    ASSERT_TRUE(file != NULL);
+    fputs("this is not a trace file", file);
+    fclose(file);
+
+    EXPECT_FALSE(traceOpenReplay(TRACE_FILE));
+    EXPECT_FALSE(traceIsReplaying());
+    EXPECT_FALSE(traceRead(&record));
+    unlink(TRACE_FILE);
+
+    EXPECT_FALSE(traceOpenReplay(TRACE_FILE));
+}
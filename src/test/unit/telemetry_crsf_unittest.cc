@@ -52,6 +52,7 @@ extern "C" {
     #include "sensors/sensors.h"
 
     #include "telemetry/crsf.h"
+    #include "telemetry/snapshot.h"
     #include "telemetry/telemetry.h"
 
     bool airMode;
@@ -91,6 +92,8 @@ TEST(TelemetryCrsfTest, TestGPS)
 {
     uint8_t frame[CRSF_FRAME_SIZE_MAX];
 
+    telemetrySnapshotUpdate();
+
     int frameLen = getCrsfFrame(frame, CRSF_FRAME_GPS);
     EXPECT_EQ(CRSF_FRAME_GPS_PAYLOAD_SIZE + FRAME_HEADER_FOOTER_LEN, frameLen);
     EXPECT_EQ(CRSF_ADDRESS_BROADCAST, frame[0]); // address
@@ -117,6 +120,7 @@ TEST(TelemetryCrsfTest, TestGPS)
     gpsSol.groundSpeed = 163;                 // speed in 0.1m/s, 16.3 m/s = 58.68 km/h, so CRSF (km/h *10) value is 587
     gpsSol.numSat = 9;
     gpsSol.groundCourse = 1479;     // degrees * 10
+    telemetrySnapshotUpdate();
     frameLen = getCrsfFrame(frame, CRSF_FRAME_GPS);
     lattitude = frame[3] << 24 | frame[4] << 16 | frame[5] << 8 | frame[6];
     EXPECT_EQ(560000000, lattitude);
@@ -138,6 +142,7 @@ TEST(TelemetryCrsfTest, TestBattery)
     uint8_t frame[CRSF_FRAME_SIZE_MAX];
 
     testBatteryVoltage = 0; // 0.1V units
+    telemetrySnapshotUpdate();
     int frameLen = getCrsfFrame(frame, CRSF_FRAME_BATTERY_SENSOR);
     EXPECT_EQ(CRSF_FRAME_BATTERY_SENSOR_PAYLOAD_SIZE + FRAME_HEADER_FOOTER_LEN, frameLen);
     EXPECT_EQ(CRSF_ADDRESS_BROADCAST, frame[0]); // address
@@ -156,6 +161,7 @@ TEST(TelemetryCrsfTest, TestBattery)
     testBatteryVoltage = 33; // 3.3V = 3300 mv
     testAmperage = 2960; // = 29.60A = 29600mA - amperage is in 0.01A steps
     batteryConfigMutable()->batteryCapacity = 1234;
+    telemetrySnapshotUpdate();
     frameLen = getCrsfFrame(frame, CRSF_FRAME_BATTERY_SENSOR);
     voltage = frame[3] << 8 | frame[4]; // mV * 100
     EXPECT_EQ(33, voltage);
@@ -175,6 +181,7 @@ TEST(TelemetryCrsfTest, TestAttitude)
     attitude.values.pitch = 0;
     attitude.values.roll = 0;
     attitude.values.yaw = 0;
+    telemetrySnapshotUpdate();
     int frameLen = getCrsfFrame(frame, CRSF_FRAME_ATTITUDE);
     EXPECT_EQ(CRSF_FRAME_ATTITUDE_PAYLOAD_SIZE + FRAME_HEADER_FOOTER_LEN, frameLen);
     EXPECT_EQ(CRSF_ADDRESS_BROADCAST, frame[0]); // address
@@ -191,6 +198,7 @@ TEST(TelemetryCrsfTest, TestAttitude)
     attitude.values.pitch = 678; // decidegrees == 1.183333232852155 rad
     attitude.values.roll = 1495; // 2.609267231731523 rad
     attitude.values.yaw = -1799; //3.139847324337799 rad
+    telemetrySnapshotUpdate();
     frameLen = getCrsfFrame(frame, CRSF_FRAME_ATTITUDE);
     pitch = frame[3] << 8 | frame[4]; // rad / 10000
     EXPECT_EQ(11833, pitch);
@@ -276,6 +284,7 @@ uint8_t useHottAlarmSoundPeriod (void) { return 0; }
 attitudeEulerAngles_t attitude = { { 0, 0, 0 } };     // absolute angle inclination in multiple of 0.1 degree    180 deg = 1800
 
 uint16_t GPS_distanceToHome;        // distance to home point in meters
+int16_t GPS_directionToHome;
 gpsSolutionData_t gpsSol;
 
 void beeperConfirmationBeeps(uint8_t beepCount) {UNUSED(beepCount);}
@@ -289,6 +298,8 @@ uint32_t serialTxBytesFree(const serialPort_t *) {return 0;}
 uint8_t serialRead(serialPort_t *) {return 0;}
 void serialWrite(serialPort_t *, uint8_t) {}
 void serialWriteBuf(serialPort_t *, const uint8_t *, int) {}
+uint8_t *serialTxReserve(serialPort_t *, int) {return NULL;}
+void serialTxCommit(serialPort_t *, int) {}
 void serialSetMode(serialPort_t *, portMode_e) {}
 serialPort_t *openSerialPort(serialPortIdentifier_e, serialPortFunction_e, serialReceiveCallbackPtr, uint32_t, portMode_e, portOptions_e) {return NULL;}
 void closeSerialPort(serialPort_t *) {}
@@ -310,6 +321,22 @@ uint16_t getBatteryVoltage(void) {
     return testBatteryVoltage;
 }
 
+uint8_t getBatteryCellCount(void) {
+    return 1;
+}
+
+int32_t getMAhDrawn(void) {
+    return 0;
+}
+
+int32_t getEstimatedAltitude(void) {
+    return 0;
+}
+
+int32_t getEstimatedVario(void) {
+    return 0;
+}
+
 batteryState_e getBatteryState(void) {
     return BATTERY_OK;
 }
@@ -49,6 +49,7 @@ extern "C" {
 
     #include "telemetry/telemetry.h"
     #include "telemetry/hott.h"
+    #include "telemetry/snapshot.h"
 
     PG_REGISTER(telemetryConfig_t, telemetryConfig, PG_TELEMETRY_CONFIG, 0);
 
@@ -175,6 +176,8 @@ gpsSolutionData_t gpsSol;
 uint16_t GPS_distanceToHome;        // distance to home point in meters
 int16_t GPS_directionToHome;        // direction to home or hol point in degrees
 
+telemetrySnapshot_t telemetrySnapshot;
+
 
 uint32_t fixedMillis = 0;
 
@@ -0,0 +1,272 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/maths.h"
+
+    #include "config/parameter_group.h"
+    #include "config/parameter_group_ids.h"
+
+    #include "drivers/serial.h"
+
+    #include "fc/runtime_config.h"
+
+    #include "flight/failsafe.h"
+    #include "flight/imu.h"
+    #include "flight/mixer.h"
+
+    #include "io/gps.h"
+    #include "io/serial.h"
+
+    #include "rx/rx.h"
+
+    #include "sensors/battery.h"
+    #include "sensors/sensors.h"
+
+    #include "telemetry/telemetry.h"
+    #include "telemetry/mavlink.h"
+    #include "telemetry/snapshot.h"
+
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wpedantic"
+    #include "common/mavlink.h"
+    #pragma GCC diagnostic pop
+
+    PG_REGISTER(batteryConfig_t, batteryConfig, PG_BATTERY_CONFIG, 0);
+    PG_REGISTER(mixerConfig_t, mixerConfig, PG_MIXER_CONFIG, 0);
+    PG_REGISTER(rxConfig_t, rxConfig, PG_RX_CONFIG, 0);
+    PG_REGISTER(telemetryConfig_t, telemetryConfig, PG_TELEMETRY_CONFIG, 0);
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define TASK_PERIOD_US 4000 // the telemetry task runs at 250Hz
+
+static uint8_t rxBuffer[MAVLINK_MAX_PACKET_LEN];
+static int rxPos;
+static int rxEnd;
+
+#define TX_BUFFER_SIZE 256
+
+static int txBytesPerSecond; // 0 for a port that keeps up with anything
+static int txQueued;
+static timeUs_t txDrainedUs;
+static int writeCalls;
+static int messageCount[256];
+static mavlink_command_ack_t lastAck;
+
+static timeUs_t testTimeUs;
+
+// queues a message from the ground station
+static void groundStationSend(const mavlink_message_t *msg)
+{
+    rxPos = 0;
+    rxEnd = mavlink_msg_to_send_buffer(rxBuffer, msg);
+}
+
+// runs the telemetry for a second and returns how often the task had something to do
+static int runOneSecond(void)
+{
+    int services = 0;
+    memset(messageCount, 0, sizeof(messageCount));
+    writeCalls = 0;
+    for (timeUs_t endUs = testTimeUs + 1000000; testTimeUs < endUs; testTimeUs += TASK_PERIOD_US) {
+        if (mavlinkTelemetryNeedsService()) {
+            const int writesBefore = writeCalls;
+            handleMAVLinkTelemetry(testTimeUs);
+            // everything due in one run goes out in one write
+            EXPECT_LE(writeCalls - writesBefore, 1);
+            services++;
+        }
+    }
+    return services;
+}
+
+class MAVLinkTelemetryTest : public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        rxPos = rxEnd = 0;
+        txBytesPerSecond = 0;
+        txQueued = 0;
+        // the defaults of telemetry.c
+        telemetryConfigMutable()->mavlink_extended_status_rate = 2;
+        telemetryConfigMutable()->mavlink_rc_channels_rate = 5;
+        telemetryConfigMutable()->mavlink_position_rate = 2;
+        telemetryConfigMutable()->mavlink_extra1_rate = 10;
+        telemetryConfigMutable()->mavlink_extra2_rate = 10;
+        testTimeUs += 1000000;
+        freeMAVLinkTelemetryPort();
+        initMAVLinkTelemetry();
+        checkMAVLinkTelemetryState();
+    }
+};
+
+TEST_F(MAVLinkTelemetryTest, TestConfiguredRates)
+{
+    const int services = runOneSecond();
+
+    EXPECT_EQ(2, messageCount[MAVLINK_MSG_ID_SYS_STATUS]);
+    EXPECT_EQ(5, messageCount[MAVLINK_MSG_ID_RC_CHANNELS_RAW]);
+    EXPECT_EQ(10, messageCount[MAVLINK_MSG_ID_ATTITUDE]);
+    EXPECT_EQ(10, messageCount[MAVLINK_MSG_ID_HEARTBEAT]);
+    EXPECT_EQ(10, messageCount[MAVLINK_MSG_ID_VFR_HUD]);
+    // the task only runs when a stream is due
+    EXPECT_LE(services, 2 + 5 + 10 + 10);
+}
+
+TEST_F(MAVLinkTelemetryTest, TestRequestDataStream)
+{
+    mavlink_message_t msg;
+    mavlink_msg_request_data_stream_pack(255, 0, &msg, 0, 0, MAV_DATA_STREAM_EXTRA1, 50, 1);
+    groundStationSend(&msg);
+
+    runOneSecond();
+    EXPECT_EQ(50, messageCount[MAVLINK_MSG_ID_ATTITUDE]);
+    EXPECT_EQ(10, messageCount[MAVLINK_MSG_ID_HEARTBEAT]);
+
+    // stop all streams, the task only runs to read the request
+    mavlink_msg_request_data_stream_pack(255, 0, &msg, 0, 0, MAV_DATA_STREAM_ALL, 0, 0);
+    groundStationSend(&msg);
+
+    EXPECT_EQ(1, runOneSecond());
+    EXPECT_EQ(0, messageCount[MAVLINK_MSG_ID_HEARTBEAT]);
+}
+
+TEST_F(MAVLinkTelemetryTest, TestSetMessageInterval)
+{
+    mavlink_message_t msg;
+    // MAV_CMD_SET_MESSAGE_INTERVAL, 100Hz attitude
+    mavlink_msg_command_long_pack(255, 0, &msg, 0, 0, 511, 0, MAVLINK_MSG_ID_ATTITUDE, 10000, 0, 0, 0, 0, 0);
+    groundStationSend(&msg);
+    memset(&lastAck, 0xff, sizeof(lastAck));
+
+    runOneSecond();
+    EXPECT_EQ(511, lastAck.command);
+    EXPECT_EQ(MAV_RESULT_ACCEPTED, lastAck.result);
+    EXPECT_EQ(1, messageCount[MAVLINK_MSG_ID_COMMAND_ACK]);
+    EXPECT_EQ(100, messageCount[MAVLINK_MSG_ID_ATTITUDE]);
+
+    // back to the configured rate
+    mavlink_msg_command_long_pack(255, 0, &msg, 0, 0, 511, 0, MAVLINK_MSG_ID_ATTITUDE, 0, 0, 0, 0, 0, 0);
+    groundStationSend(&msg);
+    runOneSecond();
+    EXPECT_EQ(10, messageCount[MAVLINK_MSG_ID_ATTITUDE]);
+
+    // a message no stream sends
+    mavlink_msg_command_long_pack(255, 0, &msg, 0, 0, 511, 0, MAVLINK_MSG_ID_HIGHRES_IMU, 10000, 0, 0, 0, 0, 0);
+    groundStationSend(&msg);
+    handleMAVLinkTelemetry(testTimeUs);
+    EXPECT_EQ(MAV_RESULT_UNSUPPORTED, lastAck.result);
+}
+
+TEST_F(MAVLinkTelemetryTest, TestThrottledByTransmitBuffer)
+{
+    mavlink_message_t msg;
+    mavlink_msg_request_data_stream_pack(255, 0, &msg, 0, 0, MAV_DATA_STREAM_ALL, 50, 1);
+    groundStationSend(&msg);
+
+    // 19200 baud, a quarter of what all streams at 50Hz need
+    txBytesPerSecond = 1920;
+    txDrainedUs = testTimeUs;
+    runOneSecond();
+
+    // serialWriteBuf() checks that nothing overflows the transmit buffer, and every stream still gets a turn
+    EXPECT_GT(messageCount[MAVLINK_MSG_ID_SYS_STATUS], 0);
+    EXPECT_GT(messageCount[MAVLINK_MSG_ID_RC_CHANNELS_RAW], 0);
+    EXPECT_GT(messageCount[MAVLINK_MSG_ID_ATTITUDE], 0);
+    EXPECT_LT(messageCount[MAVLINK_MSG_ID_ATTITUDE], 50);
+}
+
+// STUBS
+
+extern "C" {
+
+uint8_t armingFlags;
+uint8_t stateFlags;
+uint16_t flightModeFlags;
+uint16_t rssi;
+int16_t rcData[MAX_SUPPORTED_RC_CHANNEL_COUNT];
+rxRuntimeConfig_t rxRuntimeConfig;
+telemetrySnapshot_t telemetrySnapshot;
+serialPort_t *telemetrySharedPort = NULL;
+int32_t GPS_home[2];
+
+uint32_t micros(void) { return testTimeUs; }
+uint32_t millis(void) { return testTimeUs / 1000; }
+
+bool feature(uint32_t) { return false; }
+bool sensors(uint32_t) { return false; }
+float getMotorMixRange(void) { return 0; }
+bool failsafeIsActive(void) { return false; }
+bool isAmperageConfigured(void) { return false; }
+bool isBatteryVoltageConfigured(void) { return false; }
+
+static serialPortConfig_t testPortConfig;
+static serialPort_t testPort;
+
+serialPortConfig_t *findSerialPortConfig(serialPortFunction_e) { return &testPortConfig; }
+portSharing_e determinePortSharing(const serialPortConfig_t *, serialPortFunction_e) { return PORTSHARING_NOT_SHARED; }
+bool telemetryDetermineEnabledState(portSharing_e) { return true; }
+bool telemetryCheckRxPortShared(const serialPortConfig_t *) { return false; }
+serialPort_t *openSerialPort(serialPortIdentifier_e, serialPortFunction_e, serialReceiveCallbackPtr, uint32_t, portMode_e, portOptions_e) { return &testPort; }
+void closeSerialPort(serialPort_t *) {}
+const uint32_t baudRates[] = {0, 9600, 19200, 38400, 57600, 115200, 230400, 250000, 400000, 460800, 500000, 921600, 1000000, 1500000, 2000000, 2470000};
+
+uint32_t serialRxBytesWaiting(const serialPort_t *) { return rxEnd - rxPos; }
+uint8_t serialRead(serialPort_t *) { return rxBuffer[rxPos++]; }
+static void txDrain(void)
+{
+    const int drained = (int64_t)(testTimeUs - txDrainedUs) * txBytesPerSecond / 1000000;
+    if (drained > 0 || txBytesPerSecond == 0) {
+        txQueued = txBytesPerSecond ? MAX(txQueued - drained, 0) : 0;
+        txDrainedUs = testTimeUs;
+    }
+}
+
+uint32_t serialTxBytesFree(const serialPort_t *)
+{
+    txDrain();
+    return TX_BUFFER_SIZE - txQueued;
+}
+
+// the flight controller's messages, decoded on a channel of their own
+void serialWriteBuf(serialPort_t *, const uint8_t *data, int count)
+{
+    writeCalls++;
+    txDrain();
+    txQueued += count;
+    EXPECT_LE(txQueued, TX_BUFFER_SIZE);
+
+    mavlink_message_t msg;
+    mavlink_status_t status;
+    for (int i = 0; i < count; i++) {
+        if (mavlink_parse_char(MAVLINK_COMM_1, data[i], &msg, &status)) {
+            messageCount[msg.msgid]++;
+            if (msg.msgid == MAVLINK_MSG_ID_COMMAND_ACK) {
+                mavlink_msg_command_ack_decode(&msg, &lastAck);
+            }
+        }
+    }
+}
+
+}
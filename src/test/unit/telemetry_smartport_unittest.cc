@@ -0,0 +1,382 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "config/parameter_group.h"
+    #include "config/parameter_group_ids.h"
+
+    #include "drivers/serial.h"
+
+    #include "fc/controlrate_profile.h"
+    #include "fc/fc_msp.h"
+    #include "fc/runtime_config.h"
+
+    #include "flight/pid.h"
+
+    #include "io/serial.h"
+
+    #include "msp/msp.h"
+
+    #include "sensors/acceleration.h"
+    #include "sensors/battery.h"
+    #include "sensors/sensors.h"
+
+    #include "telemetry/telemetry.h"
+    #include "telemetry/smartport.h"
+    #include "telemetry/snapshot.h"
+
+    PG_REGISTER(batteryConfig_t, batteryConfig, PG_BATTERY_CONFIG, 0);
+    PG_REGISTER(telemetryConfig_t, telemetryConfig, PG_TELEMETRY_CONFIG, 0);
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+// physical IDs from telemetry/smartport.c
+#define SENSOR_ID1      0x1B    // telemetry and MSP replies
+#define SENSOR_ID2      0x0D    // MSP requests from the radio
+#define SENSOR_ID3      0x34    // spare, not answered
+#define SENSOR_ID4      0x67    // spare, not answered
+
+#define MSPC_FRAME      0x30
+#define MSPS_FRAME      0x32
+
+#define MSP_VERSION     (1 << 5)
+#define MSP_START_FLAG  (1 << 4)
+#define MSP_ERROR_FLAG  (1 << 5)
+#define MSP_SEQ_MASK    0x0F
+
+#define PAYLOAD_SIZE    6
+#define REPLY_SIZE      30      // bytes of each MSP reply in the benchmark
+#define REQUEST_COUNT   8
+
+static uint8_t rxBuffer[64];
+static int rxPos;
+static int rxEnd;
+static uint8_t txBuffer[64];
+static int txLength;
+
+static int mspCommandsProcessed;
+
+/*
+ * Simulated SmartPort master and the MSP client of the radio, as in the configuration Lua scripts.
+ */
+
+static void masterSendByte(uint8_t c, uint16_t *crc)
+{
+    if (c == 0x7E || c == 0x7D) {
+        rxBuffer[rxEnd++] = 0x7D;
+        rxBuffer[rxEnd++] = c ^ 0x20;
+    } else {
+        rxBuffer[rxEnd++] = c;
+    }
+    if (crc) {
+        *crc += c;
+        *crc += *crc >> 8;
+        *crc &= 0x00FF;
+    }
+}
+
+// polls a physical ID and returns the frame ID of the answer, 0 without one
+static uint8_t masterPoll(uint8_t sensorId, uint8_t *payload)
+{
+    rxPos = rxEnd = 0;
+    txLength = 0;
+    rxBuffer[rxEnd++] = 0x7E;
+    rxBuffer[rxEnd++] = sensorId;
+    handleSmartPortTelemetry();
+
+    if (txLength == 0) {
+        return 0;
+    }
+
+    uint8_t frame[1 + PAYLOAD_SIZE + 1];
+    int length = 0;
+    for (int i = 0; i < txLength && length < (int)sizeof(frame); i++) {
+        frame[length++] = txBuffer[i] == 0x7D ? txBuffer[++i] ^ 0x20 : txBuffer[i];
+    }
+    EXPECT_EQ((int)sizeof(frame), length);
+
+    uint16_t crc = 0;
+    for (int i = 0; i < 1 + PAYLOAD_SIZE; i++) {
+        crc += frame[i];
+        crc += crc >> 8;
+        crc &= 0x00FF;
+    }
+    EXPECT_EQ(0xFF - crc, frame[1 + PAYLOAD_SIZE]);
+
+    memcpy(payload, &frame[1], PAYLOAD_SIZE);
+    return frame[0];
+}
+
+static void masterSendFrame(const uint8_t *payload)
+{
+    rxPos = rxEnd = 0;
+    txLength = 0;
+    uint16_t crc = 0;
+    rxBuffer[rxEnd++] = 0x7E;
+    rxBuffer[rxEnd++] = SENSOR_ID2;
+    masterSendByte(MSPC_FRAME, &crc);
+    for (int i = 0; i < PAYLOAD_SIZE; i++) {
+        masterSendByte(payload[i], &crc);
+    }
+    masterSendByte(0xFF - crc, NULL);
+    handleSmartPortTelemetry();
+    EXPECT_EQ(0, txLength);
+}
+
+static uint8_t clientSeq;
+
+// requests with up to three payload bytes fit one frame
+static void clientSendRequest(uint8_t cmd, const uint8_t *data, uint8_t size)
+{
+    uint8_t payload[PAYLOAD_SIZE] = { 0 };
+    uint8_t checksum = size ^ cmd;
+    payload[0] = MSP_VERSION | MSP_START_FLAG | (clientSeq++ & MSP_SEQ_MASK);
+    payload[1] = size;
+    payload[2] = cmd;
+    for (int i = 0; i < size; i++) {
+        payload[3 + i] = data[i];
+        checksum ^= data[i];
+    }
+    payload[3 + size] = checksum;
+    masterSendFrame(payload);
+}
+
+typedef struct clientReply_s {
+    bool started;
+    bool error;
+    uint8_t seq;
+    uint8_t size;
+    uint8_t received;
+    uint8_t checksum;
+    uint8_t data[64];
+} clientReply_t;
+
+// returns true once the reply is complete and its checksum matches cmd
+static bool clientReceive(clientReply_t *reply, const uint8_t *payload, uint8_t cmd)
+{
+    const uint8_t *p = payload;
+    const uint8_t head = *p++;
+    if (head & MSP_START_FLAG) {
+        reply->started = true;
+        reply->error = head & MSP_ERROR_FLAG;
+        reply->size = *p++;
+        reply->received = 0;
+        reply->checksum = reply->size ^ cmd;
+    } else {
+        EXPECT_TRUE(reply->started);
+        EXPECT_EQ((reply->seq + 1) & MSP_SEQ_MASK, head & MSP_SEQ_MASK);
+    }
+    reply->seq = head & MSP_SEQ_MASK;
+
+    while (p < payload + PAYLOAD_SIZE && reply->received < reply->size) {
+        reply->checksum ^= *p;
+        reply->data[reply->received++] = *p++;
+    }
+    if (p == payload + PAYLOAD_SIZE) {
+        return false;
+    }
+    EXPECT_EQ(reply->checksum, *p);
+    reply->started = false;
+    return true;
+}
+
+/*
+ * Runs REQUEST_COUNT requests and returns the number of master rounds until the last reply arrived.
+ * Each round the radio can send one frame to the sensors, then the master polls sensorIds.
+ * A sequential client waits for each reply before sending the next request, like the current Lua scripts.
+ * Like them the client only takes reply frames from SENSOR_ID1, a reply frame from another ID is a gap in the sequence.
+ */
+static int runBenchmark(const uint8_t *sensorIds, int sensorCount, int window)
+{
+    clientReply_t reply;
+    memset(&reply, 0, sizeof(reply));
+    int sent = 0;
+    int answered = 0;
+    int rounds = 0;
+
+    while (answered < REQUEST_COUNT && rounds < 1000) {
+        rounds++;
+        if (sent < REQUEST_COUNT && sent - answered < window) {
+            const uint8_t data = sent;
+            clientSendRequest(100 + sent, &data, 1);
+            sent++;
+        }
+        for (int i = 0; i < sensorCount; i++) {
+            uint8_t payload[PAYLOAD_SIZE];
+            if (masterPoll(sensorIds[i], payload) != MSPS_FRAME) {
+                continue;
+            }
+            EXPECT_EQ(SENSOR_ID1, sensorIds[i]);
+            if (sensorIds[i] == SENSOR_ID1 && clientReceive(&reply, payload, 100 + answered)) {
+                EXPECT_FALSE(reply.error);
+                EXPECT_EQ(REPLY_SIZE, reply.size);
+                for (int j = 0; j < REPLY_SIZE; j++) {
+                    EXPECT_EQ((uint8_t)(answered + j), reply.data[j]);
+                }
+                answered++;
+            }
+        }
+    }
+    EXPECT_EQ(REQUEST_COUNT, answered);
+    return rounds;
+}
+
+class SmartPortMspTest : public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        rxPos = rxEnd = 0;
+        txLength = 0;
+        mspCommandsProcessed = 0;
+        acc.dev.acc_1G = 512;
+        freeSmartPortTelemetryPort();
+        initSmartPortTelemetry();
+        checkSmartPortTelemetryState();
+    }
+};
+
+TEST_F(SmartPortMspTest, TestSensorSlot)
+{
+    uint8_t payload[PAYLOAD_SIZE];
+    // telemetry on the main ID only
+    EXPECT_EQ(0x10, masterPoll(SENSOR_ID1, payload));
+    EXPECT_EQ(0, masterPoll(SENSOR_ID3, payload));
+    EXPECT_EQ(0, masterPoll(SENSOR_ID4, payload));
+
+    // the radio scripts only take MSP replies from the main ID, the spare IDs stay silent during a transfer too
+    const uint8_t data = 1;
+    clientSendRequest(101, &data, 1);
+    EXPECT_EQ(0, masterPoll(SENSOR_ID3, payload));
+    EXPECT_EQ(0, masterPoll(SENSOR_ID4, payload));
+
+    clientReply_t reply;
+    memset(&reply, 0, sizeof(reply));
+    do {
+        ASSERT_EQ(MSPS_FRAME, masterPoll(SENSOR_ID1, payload));
+        EXPECT_EQ(0, masterPoll(SENSOR_ID3, payload));
+    } while (!clientReceive(&reply, payload, 101));
+}
+
+TEST_F(SmartPortMspTest, TestRepeatedRequestAnsweredOnce)
+{
+    const uint8_t data = 7;
+    clientSendRequest(100 + 7, &data, 1);
+    clientSendRequest(100 + 7, &data, 1);
+
+    clientReply_t reply;
+    memset(&reply, 0, sizeof(reply));
+    int replies = 0;
+    for (int i = 0; i < 20; i++) {
+        uint8_t payload[PAYLOAD_SIZE];
+        if (masterPoll(SENSOR_ID1, payload) == MSPS_FRAME && clientReceive(&reply, payload, 100 + 7)) {
+            replies++;
+        }
+    }
+    EXPECT_EQ(1, replies);
+    EXPECT_EQ(1, mspCommandsProcessed);
+}
+
+TEST_F(SmartPortMspTest, TestOversizedRequest)
+{
+    uint8_t payload[PAYLOAD_SIZE] = { MSP_VERSION | MSP_START_FLAG, 200, 100 };
+    masterSendFrame(payload);
+
+    clientReply_t reply;
+    memset(&reply, 0, sizeof(reply));
+    EXPECT_EQ(MSPS_FRAME, masterPoll(SENSOR_ID1, payload));
+    EXPECT_TRUE(clientReceive(&reply, payload, 100));
+    EXPECT_TRUE(reply.error);
+    EXPECT_EQ(0, mspCommandsProcessed);
+}
+
+TEST_F(SmartPortMspTest, TestThroughput)
+{
+    const uint8_t mainId[] = { SENSOR_ID1 };
+    const uint8_t allIds[] = { SENSOR_ID1, SENSOR_ID3, SENSOR_ID4 };
+
+    // one request at a time, as before the request queue
+    const int sequentialRounds = runBenchmark(mainId, ARRAYLEN(mainId), 1);
+    const int pipelinedRounds = runBenchmark(mainId, ARRAYLEN(mainId), 4);
+    // a receiver polling the spare IDs too doesn't change anything
+    const int allIdRounds = runBenchmark(allIds, ARRAYLEN(allIds), 4);
+
+    printf("SmartPort MSP, %d requests with %d byte replies: %d rounds sequential, %d pipelined (%.1f reply bytes per round)\n",
+        REQUEST_COUNT, REPLY_SIZE, sequentialRounds, pipelinedRounds, (float)(REQUEST_COUNT * REPLY_SIZE) / pipelinedRounds);
+
+    EXPECT_EQ(REQUEST_COUNT * 3, mspCommandsProcessed);
+    // one reply frame per poll of the main ID is the limit, queued requests keep every poll busy
+    EXPECT_EQ(sequentialRounds, pipelinedRounds);
+    EXPECT_EQ(pipelinedRounds, allIdRounds);
+}
+
+// STUBS
+
+extern "C" {
+
+uint8_t armingFlags;
+uint8_t stateFlags;
+uint16_t flightModeFlags;
+
+acc_t acc;
+pidProfile_t *currentPidProfile;
+controlRateConfig_t *currentControlRateProfile;
+telemetrySnapshot_t telemetrySnapshot;
+
+uint32_t millis(void) { return 0; }
+
+bool feature(uint32_t) { return false; }
+bool sensors(uint32_t) { return false; }
+bool isArmingDisabled(void) { return false; }
+
+static serialPortConfig_t testPortConfig;
+static serialPort_t testPort;
+
+serialPortConfig_t *findSerialPortConfig(serialPortFunction_e) { return &testPortConfig; }
+portSharing_e determinePortSharing(const serialPortConfig_t *, serialPortFunction_e) { return PORTSHARING_NOT_SHARED; }
+bool telemetryDetermineEnabledState(portSharing_e) { return true; }
+serialPort_t *openSerialPort(serialPortIdentifier_e, serialPortFunction_e, serialReceiveCallbackPtr, uint32_t, portMode_e, portOptions_e) { return &testPort; }
+void closeSerialPort(serialPort_t *) {}
+
+uint32_t serialRxBytesWaiting(const serialPort_t *) { return rxEnd - rxPos; }
+uint8_t serialRead(serialPort_t *) { return rxBuffer[rxPos++]; }
+void serialWrite(serialPort_t *, uint8_t ch)
+{
+    if (txLength < (int)sizeof(txBuffer)) {
+        txBuffer[txLength++] = ch;
+    }
+}
+
+// replies REPLY_SIZE bytes counting up from the first request byte
+mspResult_e mspFcProcessCommand(mspPacket_t *cmd, mspPacket_t *reply, mspPostProcessFnPtr *)
+{
+    mspCommandsProcessed++;
+    const uint8_t first = sbufReadU8(&cmd->buf);
+    reply->cmd = cmd->cmd;
+    for (int i = 0; i < REPLY_SIZE; i++) {
+        sbufWriteU8(&reply->buf, first + i);
+    }
+    return MSP_RESULT_ACK;
+}
+
+}
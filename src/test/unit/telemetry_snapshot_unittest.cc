@@ -0,0 +1,140 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "config/parameter_group.h"
+    #include "config/parameter_group_ids.h"
+
+    #include "fc/runtime_config.h"
+
+    #include "flight/altitude.h"
+    #include "flight/imu.h"
+
+    #include "io/gps.h"
+
+    #include "sensors/battery.h"
+    #include "sensors/sensors.h"
+
+    #include "telemetry/snapshot.h"
+
+    PG_REGISTER(batteryConfig_t, batteryConfig, PG_BATTERY_CONFIG, 0);
+
+    uint16_t testBatteryVoltage = 0;
+    uint8_t testBatteryCellCount = 0;
+    int32_t testEstimatedAltitude = 0;
+    bool testHasBaro = false;
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+TEST(TelemetrySnapshotTest, TestFirstUpdateSetsAllFields)
+{
+    uint32_t seenVersion = 0;
+    EXPECT_EQ(0, telemetrySnapshotChanges(&seenVersion));
+
+    telemetrySnapshotUpdate();
+    EXPECT_EQ(1, telemetrySnapshot.version);
+    EXPECT_EQ(TELEMETRY_SNAPSHOT_ALL, telemetrySnapshotChanges(&seenVersion));
+    EXPECT_EQ(1, seenVersion);
+
+    // nothing changed
+    telemetrySnapshotUpdate();
+    EXPECT_EQ(1, telemetrySnapshot.version);
+    EXPECT_EQ(0, telemetrySnapshotChanges(&seenVersion));
+}
+
+TEST(TelemetrySnapshotTest, TestChangedFields)
+{
+    uint32_t seenVersion = telemetrySnapshot.version;
+
+    testBatteryVoltage = 168;
+    testBatteryCellCount = 4;
+    telemetrySnapshotUpdate();
+    EXPECT_EQ(TELEMETRY_SNAPSHOT_BATTERY, telemetrySnapshotChanges(&seenVersion));
+    EXPECT_EQ(168, telemetrySnapshot.battery.voltage);
+    EXPECT_EQ(420, telemetrySnapshot.battery.cellVoltage);
+
+    attitude.values.yaw = 900;
+    telemetrySnapshotUpdate();
+    gpsSol.numSat = 7;
+    telemetrySnapshotUpdate();
+    EXPECT_EQ(TELEMETRY_SNAPSHOT_ATTITUDE | TELEMETRY_SNAPSHOT_GPS, telemetrySnapshotChanges(&seenVersion));
+    EXPECT_EQ(0, telemetrySnapshotChanges(&seenVersion));
+}
+
+TEST(TelemetrySnapshotTest, TestConsumersAreIndependent)
+{
+    uint32_t fastConsumer = telemetrySnapshot.version;
+    uint32_t slowConsumer = telemetrySnapshot.version;
+
+    testBatteryVoltage = 160;
+    telemetrySnapshotUpdate();
+    EXPECT_EQ(TELEMETRY_SNAPSHOT_BATTERY, telemetrySnapshotChanges(&fastConsumer));
+
+    attitude.values.roll = 100;
+    telemetrySnapshotUpdate();
+    EXPECT_EQ(TELEMETRY_SNAPSHOT_ATTITUDE, telemetrySnapshotChanges(&fastConsumer));
+
+    EXPECT_EQ(TELEMETRY_SNAPSHOT_BATTERY | TELEMETRY_SNAPSHOT_ATTITUDE, telemetrySnapshotChanges(&slowConsumer));
+}
+
+TEST(TelemetrySnapshotTest, TestBestAltitude)
+{
+    uint32_t seenVersion = telemetrySnapshot.version;
+
+    gpsSol.llh.alt = 120; // m
+    testEstimatedAltitude = 5000; // cm
+    telemetrySnapshotUpdate();
+    EXPECT_EQ(TELEMETRY_SNAPSHOT_ALTITUDE | TELEMETRY_SNAPSHOT_GPS, telemetrySnapshotChanges(&seenVersion));
+    EXPECT_EQ(12000, telemetrySnapshot.altitude.bestCm);
+
+    testHasBaro = true;
+    telemetrySnapshotUpdate();
+    EXPECT_EQ(TELEMETRY_SNAPSHOT_ALTITUDE, telemetrySnapshotChanges(&seenVersion));
+    EXPECT_EQ(5000, telemetrySnapshot.altitude.bestCm);
+}
+
+// STUBS
+
+extern "C" {
+
+uint8_t stateFlags;
+attitudeEulerAngles_t attitude;
+gpsSolutionData_t gpsSol;
+uint16_t GPS_distanceToHome;
+int16_t GPS_directionToHome;
+
+bool sensors(uint32_t mask) { return testHasBaro && (mask & SENSOR_BARO); }
+
+uint16_t getBatteryVoltage(void) { return testBatteryVoltage; }
+uint8_t getBatteryCellCount(void) { return testBatteryCellCount; }
+int32_t getAmperage(void) { return 0; }
+int32_t getMAhDrawn(void) { return 0; }
+uint8_t calculateBatteryPercentageRemaining(void) { return 0; }
+batteryState_e getBatteryState(void) { return BATTERY_OK; }
+
+int32_t getEstimatedAltitude(void) { return testEstimatedAltitude; }
+int32_t getEstimatedVario(void) { return 0; }
+
+}
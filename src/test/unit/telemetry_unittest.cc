@@ -0,0 +1,199 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <string>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/time.h"
+
+    #include "config/parameter_group.h"
+    #include "config/parameter_group_ids.h"
+
+    #include "fc/rc_modes.h"
+    #include "fc/runtime_config.h"
+
+    #include "io/serial.h"
+
+    #include "rx/rx.h"
+
+    #include "telemetry/telemetry.h"
+    #include "telemetry/ltm.h"
+    #include "telemetry/mavlink.h"
+    #include "telemetry/snapshot.h"
+
+    PG_REGISTER(rxConfig_t, rxConfig, PG_RX_CONFIG, 0);
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+// the handlers log their calls and take their cost off the fake clock
+static std::string calls;
+static timeUs_t currentTimeUs;
+static timeDelta_t handlerCostUs;
+static bool smartPortHasData;
+static bool ibusHasData;
+static bool mavlinkHasData;
+static int snapshotUpdates;
+
+static void serviced(const char *name)
+{
+    calls += name;
+    calls += " ";
+    currentTimeUs += handlerCostUs;
+}
+
+// run the task at a time, returns the providers serviced in order
+static std::string runTelemetryTask(timeUs_t taskTimeUs)
+{
+    calls.clear();
+    currentTimeUs = taskTimeUs;
+    telemetryProcess(taskTimeUs);
+    return calls;
+}
+
+TEST(TelemetryUnittest, TestProviderPeriods)
+{
+    handlerCostUs = 0;
+
+    // everything is due at the start
+    EXPECT_EQ("frsky hott ltm jeti crsf ", runTelemetryTask(1000000));
+
+    // one task period later only the providers without a period
+    EXPECT_EQ("frsky hott jeti crsf ", runTelemetryTask(1004000));
+
+    EXPECT_EQ("frsky hott ltm jeti crsf ", runTelemetryTask(1000000 + LTM_CYCLETIME_US));
+}
+
+TEST(TelemetryUnittest, TestNeedsService)
+{
+    handlerCostUs = 0;
+
+    smartPortHasData = true;
+    EXPECT_EQ("frsky hott smartport jeti crsf ", runTelemetryTask(1104000));
+    smartPortHasData = false;
+
+    ibusHasData = true;
+    EXPECT_EQ("frsky hott jeti crsf ibus ", runTelemetryTask(1108000));
+    ibusHasData = false;
+
+    mavlinkHasData = true;
+    EXPECT_EQ("frsky hott jeti mavlink crsf ", runTelemetryTask(1112000));
+    mavlinkHasData = false;
+}
+
+TEST(TelemetryUnittest, TestBudgetRoundRobin)
+{
+    // three providers with a 50us budget fit in one run, the next one due goes first on the next run
+    handlerCostUs = 50;
+
+    EXPECT_EQ("frsky hott ltm ", runTelemetryTask(3000000));
+    // mavlink reserves 100us
+    mavlinkHasData = true;
+    EXPECT_EQ("jeti mavlink crsf ", runTelemetryTask(3004000));
+    mavlinkHasData = false;
+    EXPECT_EQ("frsky hott jeti ", runTelemetryTask(3008000));
+    EXPECT_EQ("crsf frsky hott ", runTelemetryTask(3012000));
+
+    // the first provider of a run is serviced even when it takes longer than the whole budget
+    handlerCostUs = 1000;
+    EXPECT_EQ("jeti ", runTelemetryTask(3016000));
+    EXPECT_EQ("crsf ", runTelemetryTask(3020000));
+
+    // back to one run for everything that is due
+    handlerCostUs = 0;
+    EXPECT_EQ("frsky hott jeti crsf ", runTelemetryTask(3024000));
+}
+
+TEST(TelemetryUnittest, TestSnapshotPeriod)
+{
+    handlerCostUs = 0;
+    snapshotUpdates = 0;
+
+    // the last sample was taken at 3020000
+    runTelemetryTask(3030000);
+    EXPECT_EQ(0, snapshotUpdates);
+
+    runTelemetryTask(3020000 + TELEMETRY_SNAPSHOT_PERIOD_US);
+    EXPECT_EQ(1, snapshotUpdates);
+
+    runTelemetryTask(3044000);
+    EXPECT_EQ(1, snapshotUpdates);
+}
+
+// STUBS
+
+extern "C" {
+
+uint32_t micros(void) { return currentTimeUs; }
+
+telemetrySnapshot_t telemetrySnapshot;
+void telemetrySnapshotUpdate(void)
+{
+    telemetrySnapshot.version++;
+    snapshotUpdates++;
+}
+
+uint8_t armingFlags = 0;
+bool IS_RC_MODE_ACTIVE(boxId_e) { return false; }
+
+serialPort_t *findSharedSerialPort(uint16_t, serialPortFunction_e) { return NULL; }
+serialPort_t *findNextSharedSerialPort(uint16_t, serialPortFunction_e) { return NULL; }
+void mspSerialReleasePortIfAllocated(serialPort_t *) {}
+
+void initFrSkyTelemetry(void) {}
+void checkFrSkyTelemetryState(void) {}
+void handleFrSkyTelemetry(void) { serviced("frsky"); }
+
+void initHoTTTelemetry(void) {}
+void checkHoTTTelemetryState(void) {}
+void handleHoTTTelemetry(timeUs_t) { serviced("hott"); }
+
+void initSmartPortTelemetry(void) {}
+void checkSmartPortTelemetryState(void) {}
+bool smartPortTelemetryNeedsService(void) { return smartPortHasData; }
+void handleSmartPortTelemetry(void) { serviced("smartport"); }
+
+void initLtmTelemetry(void) {}
+void checkLtmTelemetryState(void) {}
+void handleLtmTelemetry(void) { serviced("ltm"); }
+
+void initJetiExBusTelemetry(void) {}
+void checkJetiExBusTelemetryState(void) {}
+void handleJetiExBusTelemetry(void) { serviced("jeti"); }
+
+void initMAVLinkTelemetry(void) {}
+void checkMAVLinkTelemetryState(void) {}
+bool mavlinkTelemetryNeedsService(void) { return mavlinkHasData; }
+void handleMAVLinkTelemetry(timeUs_t) { serviced("mavlink"); }
+
+void initCrsfTelemetry(void) {}
+bool checkCrsfTelemetryState(void) { return true; }
+void handleCrsfTelemetry(timeUs_t) { serviced("crsf"); }
+
+void initIbusTelemetry(void) {}
+bool checkIbusTelemetryState(void) { return true; }
+bool ibusTelemetryNeedsService(void) { return ibusHasData; }
+void handleIbusTelemetry(void) { serviced("ibus"); }
+
+}